@@ -0,0 +1,141 @@
+/**
+ * @file        LESDK/Common/BatchFind.hpp
+ * @brief       This file implements resolving many object paths in a single pass over the object table.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+// #include <vector>
+
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/ObjectIndex.hpp"
+#include "LESDK/Common/TArray.hpp"
+
+
+namespace LESDK {
+
+    /** Fewest table slots worth handing to a worker thread of its own. */
+    inline constexpr INT k_batchFindMinSlotsPerThread = 1024 * 16;
+
+    /**
+     * @brief       Finds the objects named in @p FullNames with a single pass over @p Table.
+     * @param[in]   Table - The object table, normally @c UObject::GObjObjects.
+     * @param[in]   FullNames - Full names as passed to @c UObject::FindObject, duplicates and nulls are allowed.
+     * @param[out]  OutObjects - Receives the object found for each name, or null, at the same position.
+     * @param[in]   NumThreads - Number of threads to split the pass across, including the calling one.
+     * @return      Number of names for which an object was found.
+     *
+     * @remarks
+     *   Names are parsed and hashed into object index keys up front, and names with a segment that
+     *   is not in the global name table are dropped before the pass. Every object in the table then
+     *   costs one key computation and one hash probe; name text is only compared on key matches.
+     *   If several objects match a name, the one in the lowest slot wins, regardless of threading.
+     *   The table must not change during the pass, which holds during loading screens.
+     *   Templated over the object type for late binding.
+     */
+    template<class UObjectLike>
+    INT FindObjectsBatch(TArray<UObjectLike*> const& Table, std::span<WCHAR const* const> const FullNames,
+        std::type_identity_t<std::span<UObjectLike*>> const OutObjects, INT const NumThreads = 1)
+    {
+        LESDK_CHECK(OutObjects.size() >= FullNames.size(), "output span must be as large as the name span");
+
+        std::vector<std::atomic<INT>> BestSlots(FullNames.size());
+        std::unordered_multimap<DWORD, size_t> WantedByKey{};
+        WantedByKey.reserve(FullNames.size());
+
+        for (size_t i = 0; i < FullNames.size(); ++i) {
+            BestSlots[i].store(INT_MAX, std::memory_order_relaxed);
+
+            FObjectPath Path{};
+            if (!Path.Parse(FullNames[i]) || !Path.ResolveNames())
+                continue;
+            WantedByKey.emplace(CombineObjectKey(Path.ClassHash, Path.PathHash), i);
+        }
+
+        UObjectLike* const* const Objects = Table.GetData();
+        INT const NumObjects = static_cast<INT>(Table.Count());
+        std::atomic<INT> NumPending{ static_cast<INT>(WantedByKey.size()) };
+
+        // Once everything was found below Slot, scanning further can't change the results.
+        auto const IsSettledBelow = [&](INT const Slot) {
+            if (NumPending.load(std::memory_order_acquire) != 0)
+                return false;
+            for (auto const& [Key, Index] : WantedByKey) {
+                if (BestSlots[Index].load(std::memory_order_relaxed) >= Slot)
+                    return false;
+            }
+            return true;
+        };
+
+        auto const Scan = [&](INT const Begin, INT const End) {
+            for (INT Slot = Begin; Slot < End; ++Slot) {
+                if ((Slot - Begin) % 4096 == 4095 && IsSettledBelow(Slot))
+                    return;
+
+                UObjectLike* const Object = Objects[Slot];
+                if (Object == nullptr)
+                    continue;
+
+                auto [First, Last] = WantedByKey.equal_range(HashObjectKey(Object));
+                for (; First != Last; ++First) {
+                    std::atomic<INT>& Best = BestSlots[First->second];
+                    INT Current = Best.load(std::memory_order_relaxed);
+                    if (Current <= Slot)
+                        continue;
+
+                    // Paths are big, so they are only parsed again for the few objects whose key matched.
+                    FObjectPath Path{};
+                    if (!Path.Parse(FullNames[First->second]) || !ObjectMatchesPathText(Object, Path))
+                        continue;
+
+                    while (Current > Slot && !Best.compare_exchange_weak(Current, Slot, std::memory_order_acq_rel)) {}
+                    if (Current == INT_MAX)
+                        NumPending.fetch_sub(1, std::memory_order_acq_rel);
+                }
+            }
+        };
+
+        INT const MaxThreads = std::max(1, NumObjects / k_batchFindMinSlotsPerThread);
+        INT const NumWorkers = std::clamp(NumThreads, 1, MaxThreads);
+
+        if (NumWorkers == 1 || WantedByKey.empty()) {
+            Scan(0, NumObjects);
+        }
+        else {
+            INT const SlotsPerWorker = (NumObjects + NumWorkers - 1) / NumWorkers;
+            std::vector<std::jthread> Workers{};
+            Workers.reserve(static_cast<size_t>(NumWorkers - 1));
+            for (INT i = 1; i < NumWorkers; ++i) {
+                INT const Begin = i * SlotsPerWorker;
+                Workers.emplace_back(Scan, Begin, std::min(NumObjects, Begin + SlotsPerWorker));
+            }
+            Scan(0, std::min(NumObjects, SlotsPerWorker));
+        }
+
+        INT NumFound = 0;
+        for (size_t i = 0; i < FullNames.size(); ++i) {
+            INT const Slot = BestSlots[i].load(std::memory_order_relaxed);
+            OutObjects[i] = Slot != INT_MAX ? Objects[Slot] : nullptr;
+            NumFound += Slot != INT_MAX;
+        }
+
+        return NumFound;
+    }
+
+    /**
+     * @brief       Finds the objects named in @p FullNames with a single pass over @c UObject::GObjObjects.
+     * @param[in]   FullNames - Full names as passed to @c UObject::FindObject.
+     * @param[out]  OutObjects - Receives the object found for each name, or null, at the same position.
+     * @param[in]   NumThreads - Number of threads to split the pass across, including the calling one.
+     * @return      Number of names for which an object was found.
+     */
+    INT FindObjectsBatch(std::span<WCHAR const* const> FullNames, std::span<UObject*> OutObjects, INT NumThreads = 1);
+
+}
@@ -0,0 +1,221 @@
+/**
+ * @file        LESDK/Common/ClassHierarchy.hpp
+ * @brief       This file implements an SDK-side cache of class ancestor chains for constant-time IsA tests.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+// #include <vector>
+
+#include "LESDK/Common/Core.hpp"
+
+
+namespace LESDK {
+
+    /**
+     * @brief
+     *   Lazily built cache of class hierarchies, so that "is this class derived from that one"
+     *   is a depth comparison and a single load instead of a walk over @c SuperField links.
+     *
+     * @remarks
+     *   Every class gets a record with its depth and its root-first ancestor array, found through
+     *   a chunked table indexed by the class' @c ObjectInternalInteger. A record is current while it
+     *   names the class, the class' super pointer is unchanged and its generation is the latest one.
+     *   The generation is bumped by @ref Invalidate whenever a class is allocated or destroyed, which
+     *   @c TObjectTracker does from object hooks; without them, call it after classes were unloaded.
+     *   Stale records whose ancestors did not change are refreshed in place, so records are only
+     *   replaced when a class really changes and are simply kept until destruction: their number is
+     *   bounded by the number of classes ever seen. Readers never lock and never write shared state.
+     *   Templated over the object type for late binding, see @c LESDK/Common/Misc.hpp.
+     */
+    template<class UObjectLike, class UClassLike>
+    class TClassHierarchy final {
+        struct FRecord {
+            UClassLike const*                   Class;
+            /** Classes get their super link once serialized, after they were allocated. */
+            void const*                         Super;
+            std::atomic<DWORD>                  Generation;
+            INT                                 Depth;
+            std::unique_ptr<UClassLike const*[]> Ancestors;
+        };
+
+        static constexpr INT k_chunkSize = 4096;
+        static constexpr INT k_maxChunks = 4096;
+
+        using FChunk = std::atomic<FRecord*>;
+
+        std::atomic<FChunk*>                    m_chunks[k_maxChunks]{};
+        std::atomic<DWORD>                      m_generation{ 0 };
+        std::vector<std::unique_ptr<FRecord>>   m_retired{};
+        std::mutex                              m_mutex{};
+
+    public:
+
+        TClassHierarchy() = default;
+        TClassHierarchy(TClassHierarchy const&) = delete;
+        TClassHierarchy& operator=(TClassHierarchy const&) = delete;
+
+        ~TClassHierarchy() noexcept {
+            for (std::atomic<FChunk*>& ChunkRef : m_chunks) {
+                FChunk* const Chunk = ChunkRef.load(std::memory_order_relaxed);
+                if (Chunk == nullptr)
+                    continue;
+                for (INT i = 0; i < k_chunkSize; ++i)
+                    delete Chunk[i].load(std::memory_order_relaxed);
+                delete[] Chunk;
+            }
+        }
+
+        /** Checks whether @p Object is an instance of @p Class or of any class derived from it. */
+        bool IsA(UObjectLike const* const Object, UClassLike const* const Class) {
+            return Object != nullptr && IsChildOf(Object->Class, Class);
+        }
+
+        /** Checks whether @p Child is @p Class or is derived from it. */
+        bool IsChildOf(UClassLike const* const Child, UClassLike const* const Class) {
+            if (Child == nullptr || Class == nullptr)
+                return false;
+            if (Child == Class)
+                return true;
+
+            FRecord const* const ChildRecord = GetRecord(Child);
+            FRecord const* const ClassRecord = GetRecord(Class);
+            if (ChildRecord == nullptr || ClassRecord == nullptr)
+                return WalkIsChildOf(Child, Class);
+
+            return ClassRecord->Depth < ChildRecord->Depth
+                && ChildRecord->Ancestors[ClassRecord->Depth] == Class;
+        }
+
+        /** Returns the number of super classes above @p Class, or -1 for null. */
+        INT GetDepth(UClassLike const* const Class) {
+            if (Class == nullptr)
+                return -1;
+            FRecord const* const Record = GetRecord(Class);
+            return Record != nullptr ? Record->Depth : WalkDepth(Class);
+        }
+
+        /**
+         * @brief
+         *   Marks all records stale, e.g. after a class was allocated or destroyed.
+         *   Records are checked against the live classes again on their next use.
+         */
+        void Invalidate() noexcept {
+            m_generation.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        /** Returns the number of records replaced because their class changed, which are kept until destruction. */
+        INT GetNumRetired() {
+            std::scoped_lock const Lock{ m_mutex };
+            return static_cast<INT>(m_retired.size());
+        }
+
+    private:
+
+        static void const* GetSuper(UClassLike const* const Class) noexcept {
+            return Class->SuperField;
+        }
+
+        static UClassLike const* AsClass(void const* const Field) noexcept {
+            return reinterpret_cast<UClassLike const*>(Field);
+        }
+
+        static bool WalkIsChildOf(UClassLike const* Child, UClassLike const* const Class) noexcept {
+            for (; Child != nullptr; Child = AsClass(GetSuper(Child))) {
+                if (Child == Class)
+                    return true;
+            }
+            return false;
+        }
+
+        static INT WalkDepth(UClassLike const* Class) noexcept {
+            INT Depth = -1;
+            for (; Class != nullptr; Class = AsClass(GetSuper(Class)))
+                ++Depth;
+            return Depth;
+        }
+
+        bool IsCurrent(FRecord const* const Record, UClassLike const* const Class) const noexcept {
+            return Record != nullptr && Record->Class == Class && Record->Super == GetSuper(Class)
+                && Record->Generation.load(std::memory_order_acquire) == m_generation.load(std::memory_order_acquire);
+        }
+
+        FChunk* GetChunk(INT const Slot) const noexcept {
+            if (Slot < 0 || Slot >= k_chunkSize * k_maxChunks)
+                return nullptr;
+            return m_chunks[Slot / k_chunkSize].load(std::memory_order_acquire);
+        }
+
+        FRecord const* GetRecord(UClassLike const* const Class) {
+            INT const Slot = Class->ObjectInternalInteger;
+            if (FChunk* const Chunk = GetChunk(Slot)) {
+                FRecord const* const Record = Chunk[Slot % k_chunkSize].load(std::memory_order_acquire);
+                if (IsCurrent(Record, Class))
+                    return Record;
+            } else if (Slot < 0 || Slot >= k_chunkSize * k_maxChunks) {
+                return nullptr;
+            }
+
+            std::scoped_lock const Lock{ m_mutex };
+            return BuildRecord(Class);
+        }
+
+        FRecord const* BuildRecord(UClassLike const* const Class) {
+            INT const Slot = Class->ObjectInternalInteger;
+            if (Slot < 0 || Slot >= k_chunkSize * k_maxChunks)
+                return nullptr;
+
+            std::atomic<FChunk*>& ChunkRef = m_chunks[Slot / k_chunkSize];
+            FChunk* Chunk = ChunkRef.load(std::memory_order_acquire);
+            if (Chunk == nullptr) {
+                Chunk = new FChunk[k_chunkSize]{};
+                ChunkRef.store(Chunk, std::memory_order_release);
+            }
+
+            FChunk& Entry = Chunk[Slot % k_chunkSize];
+            FRecord* const Existing = Entry.load(std::memory_order_acquire);
+            if (IsCurrent(Existing, Class))
+                return Existing;
+
+            // Ancestors are copied from the super class' record, building it first if needed.
+            UClassLike const* const Super = AsClass(GetSuper(Class));
+            FRecord const* const SuperRecord = Super != nullptr ? BuildRecord(Super) : nullptr;
+            if (Super != nullptr && SuperRecord == nullptr)
+                return nullptr;
+
+            DWORD const Generation = m_generation.load(std::memory_order_acquire);
+            INT const Depth = SuperRecord != nullptr ? SuperRecord->Depth + 1 : 0;
+
+            // Most invalidations change nothing about a given class, its record then stays in place.
+            if (Existing != nullptr && Existing->Class == Class && Existing->Super == Super && Existing->Depth == Depth
+                && std::equal(Existing->Ancestors.get(), Existing->Ancestors.get() + Depth,
+                    SuperRecord != nullptr ? SuperRecord->Ancestors.get() : nullptr))
+            {
+                Existing->Generation.store(Generation, std::memory_order_release);
+                return Existing;
+            }
+
+            auto Record = std::make_unique<FRecord>();
+            Record->Class = Class;
+            Record->Super = Super;
+            Record->Generation.store(Generation, std::memory_order_relaxed);
+            Record->Depth = Depth;
+            Record->Ancestors = std::make_unique<UClassLike const*[]>(static_cast<size_t>(Depth) + 1);
+
+            for (INT i = 0; i < Depth; ++i)
+                Record->Ancestors[i] = SuperRecord->Ancestors[i];
+            Record->Ancestors[Depth] = Class;
+
+            // Lock-free readers may still hold the replaced record, so it is kept.
+            FRecord* const Published = Record.release();
+            if (FRecord* const Replaced = Entry.exchange(Published, std::memory_order_acq_rel))
+                m_retired.emplace_back(Replaced);
+            return Published;
+        }
+    };
+
+}
@@ -433,6 +433,38 @@ void LESDK::TerminateConsole() {
 }
 
 
+// ! Eager resolution of generated static references.
+// ========================================
+
+LESDK::FWarmUpResult LESDK::WarmUp(INT const NumThreads) {
+    LESDK_CHECK(UObject::GObjObjects != nullptr, "");
+
+    std::vector<WCHAR const*> FullNames{};
+    for (FStaticRefTable const* Table = FStaticRefTable::GetFirst(); Table != nullptr; Table = Table->GetNext())
+        FullNames.insert(FullNames.end(), Table->GetNames(), Table->GetNames() + Table->Num());
+
+    return WarmUpObjects(*UObject::GObjObjects, UObject::GObjIndex, FullNames, NumThreads);
+}
+
+
+// ! Batched object lookups.
+// ========================================
+
+INT LESDK::FindObjectsBatch(std::span<WCHAR const* const> const FullNames, std::span<UObject*> const OutObjects, INT const NumThreads) {
+    LESDK_CHECK(UObject::GObjObjects != nullptr, "");
+    return FindObjectsBatch(*UObject::GObjObjects, FullNames, OutObjects, NumThreads);
+}
+
+
+// ! Direct native calls.
+// ========================================
+
+bool LESDK::CallNative(UObject* const Object, UFunction* const Function, void* const Parms) {
+    LESDK_CHECK(Object != nullptr && Function != nullptr, "");
+    return CallNativeDirect(Object, Function, Parms);
+}
+
+
 // ! Non-member global variables.
 // ========================================
 
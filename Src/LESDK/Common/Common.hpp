@@ -1,11 +1,26 @@
 #pragma once
 
 #include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/ClassHierarchy.hpp"
 #include "LESDK/Common/Frame.hpp"
+#include "LESDK/Common/FrameReader.hpp"
+#include "LESDK/Common/NativeCall.hpp"
+#include "LESDK/Common/InvokeBatch.hpp"
+#include "LESDK/Common/FunctionHandle.hpp"
+#include "LESDK/Common/DynamicInvoke.hpp"
+#include "LESDK/Common/NativeReplace.hpp"
 #include "LESDK/Common/FString.hpp"
 #include "LESDK/Common/SFXName.hpp"
 #include "LESDK/Common/TArray.hpp"
+#include "LESDK/Common/InlineArray.hpp"
 #include "LESDK/Common/TMap.hpp"
+#include "LESDK/Common/ObjectIndex.hpp"
+#include "LESDK/Common/BatchFind.hpp"
+#include "LESDK/Common/ObjectIterator.hpp"
+#include "LESDK/Common/ObjectTracker.hpp"
+#include "LESDK/Common/StaticRef.hpp"
+#include "LESDK/Common/WarmUp.hpp"
+#include "LESDK/Common/WeakObjectPtr.hpp"
 
 // This header *must* be at the end.
 #include "LESDK/Common/Misc.hpp"
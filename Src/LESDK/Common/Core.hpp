@@ -80,6 +80,7 @@ class UFunction;
 class UState;
 class UClass;
 class UProperty;
+class UBoolProperty;
 class UEngine;
 class UWorld;
 class USystem;
@@ -0,0 +1,425 @@
+/**
+ * @file        LESDK/Common/DynamicInvoke.hpp
+ * @brief       This file implements calling script functions with runtime-typed arguments over cached parameter layouts.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <variant>
+// #include <vector>
+
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/FString.hpp"
+#include "LESDK/Common/FunctionHandle.hpp"
+#include "LESDK/Common/NativeCall.hpp"
+#include "LESDK/Common/ObjectIndex.hpp"
+#include "LESDK/Common/SFXName.hpp"
+
+
+namespace LESDK {
+
+    // ! Parameter layout tables.
+    // ========================================
+
+    /** What a parameter holds, as far as marshalling is concerned. */
+    enum class EScriptParmKind : BYTE {
+        /** Anything not listed below, only ever passed zeroed. */
+        Unknown = 0,
+        Byte,
+        Int,
+        Bool,
+        Float,
+        /** Object, class, component and interface-less object references. */
+        Object,
+        Name,
+        String,
+    };
+
+    /** One parameter of a function, as found on its @c PropertyLink chain. */
+    struct FScriptParmInfo {
+        INT                 Offset{ 0 };
+        INT                 Size{ 0 };
+        EScriptParmKind     Kind{ EScriptParmKind::Unknown };
+        QWORD               PropertyFlags{ 0 };
+        /** Bit of the 32-bit field that holds a @c Bool parameter. */
+        DWORD               BitMask{ 0 };
+
+        bool IsOut() const noexcept { return (PropertyFlags & k_propOutParm) != 0; }
+    };
+
+    /** Flattened parameter layout of a function, built once from reflection data. */
+    struct FScriptFunctionLayout {
+        /** Parameters in declaration order, without the return value. */
+        std::vector<FScriptParmInfo>    Parms{};
+        FScriptParmInfo                 ReturnValue{};
+        bool                            bHasReturnValue{ false };
+        bool                            bHasStrings{ false };
+        /** Whether some parameter owns memory but is not a string, e.g. a dynamic array or a struct holding one. */
+        bool                            bHasUnsupported{ false };
+        INT                             ParmsSize{ 0 };
+    };
+
+    /**
+     * @brief       Tells the marshalling kind of @p Property from its class name and size.
+     * @remarks     Properties of an unexpected size or with a static array dimension are @c Unknown.
+     */
+    template<class UPropertyLike>
+    EScriptParmKind ClassifyScriptParm(UPropertyLike const* const Property) noexcept {
+        struct FKindName {
+            WCHAR const*        Text;
+            UINT                Length;
+            EScriptParmKind     Kind;
+            INT                 Size;
+        };
+
+        static constexpr FKindName k_kindNames[]{
+            { L"ByteProperty", 12, EScriptParmKind::Byte, sizeof(BYTE) },
+            { L"IntProperty", 11, EScriptParmKind::Int, sizeof(INT) },
+            { L"StringRefProperty", 17, EScriptParmKind::Int, sizeof(INT) },
+            { L"BoolProperty", 12, EScriptParmKind::Bool, sizeof(UBOOL) },
+            { L"FloatProperty", 13, EScriptParmKind::Float, sizeof(FLOAT) },
+            { L"ObjectProperty", 14, EScriptParmKind::Object, sizeof(void*) },
+            { L"ClassProperty", 13, EScriptParmKind::Object, sizeof(void*) },
+            { L"ComponentProperty", 17, EScriptParmKind::Object, sizeof(void*) },
+            { L"NameProperty", 12, EScriptParmKind::Name, sizeof(SFXName) },
+            { L"StrProperty", 11, EScriptParmKind::String, sizeof(FString) },
+        };
+
+        if (Property->Class == nullptr || Property->ArrayDim != 1)
+            return EScriptParmKind::Unknown;
+
+        for (FKindName const& Entry : k_kindNames) {
+            if (NameMatchesText(Property->Class->Name, Entry.Text, Entry.Length))
+                return Property->ElementSize == Entry.Size ? Entry.Kind : EScriptParmKind::Unknown;
+        }
+        return EScriptParmKind::Unknown;
+    }
+
+    /**
+     * @brief       Walks the @c PropertyLink chain of @p Function into a flat parameter layout.
+     * @remarks     @p UBoolPropertyLike is the type bool parameters are read as to get their @c BitMask.
+     */
+    template<class UBoolPropertyLike, class UFunctionLike>
+    FScriptFunctionLayout BuildScriptFunctionLayout(UFunctionLike const* const Function) {
+        FScriptFunctionLayout Layout{};
+        Layout.ParmsSize = Function->ParmsSize;
+
+        for (auto const* Property = Function->PropertyLink; Property != nullptr; Property = Property->PropertyLinkNext) {
+            if ((Property->PropertyFlags & k_propParm) == 0)
+                continue;
+
+            FScriptParmInfo Parm{};
+            Parm.Offset = Property->Offset;
+            Parm.Size = Property->ElementSize * Property->ArrayDim;
+            Parm.Kind = ClassifyScriptParm(Property);
+            Parm.PropertyFlags = Property->PropertyFlags;
+            if (Parm.Kind == EScriptParmKind::Bool)
+                Parm.BitMask = reinterpret_cast<UBoolPropertyLike const*>(Property)->BitMask;
+
+            Layout.bHasStrings |= Parm.Kind == EScriptParmKind::String;
+            Layout.bHasUnsupported |= Parm.Kind == EScriptParmKind::Unknown && (Parm.PropertyFlags & k_propNeedCtorLink) != 0;
+            if ((Parm.PropertyFlags & k_propReturnParm) != 0) {
+                Layout.ReturnValue = Parm;
+                Layout.bHasReturnValue = true;
+            }
+            else {
+                Layout.Parms.push_back(Parm);
+            }
+        }
+
+        // Parameters are laid out in declaration order, the link order is not relied upon.
+        std::ranges::sort(Layout.Parms, {}, &FScriptParmInfo::Offset);
+        return Layout;
+    }
+
+
+    // ! Dynamic invocation.
+    // ========================================
+
+    /** Reasons why a dynamic call may be refused; nothing is called in that case. */
+    enum class EDynamicInvokeError : INT {
+        None = 0,
+        /** No function with the given path exists, or no object was given. */
+        NotFound,
+        /** More arguments were given than the function has parameters. */
+        NumArgs,
+        /** Some argument can't be converted to its parameter. */
+        ArgumentType,
+        /** Some parameter owns memory the invoker can't construct or free, e.g. a dynamic array. */
+        UnsupportedParm,
+    };
+
+    /**
+     * @brief       A runtime-typed argument or result of a dynamic call.
+     * @remarks     @c std::monostate passes a zeroed parameter, and stands for results of unsupported kinds.
+     */
+    template<class UObjectLike = UObject>
+    using TScriptValue = std::variant<std::monostate, bool, BYTE, INT, FLOAT, UObjectLike*, SFXName, std::wstring>;
+
+    /**
+     * @brief
+     *   Calls arbitrary script functions with runtime-typed arguments, e.g. from console commands
+     *   or configuration. The parameter layout of every function is read from reflection data on
+     *   its first call, and later calls only go through the cached table.
+     *
+     * @remarks
+     *   Arguments are converted to their parameters where this is lossless: bytes and integers
+     *   widen, integers pass for floats and bools, and text passes for names. Missing trailing
+     *   arguments are passed zeroed. Out parameters are written back into the arguments, and
+     *   strings are owned by the parameter block only for the duration of the call. Functions with
+     *   other parameters that own memory, such as dynamic arrays, are refused, as whatever the
+     *   callee put there could not be freed.
+     *   Natives are called directly, everything else goes through @c ProcessEvent.
+     *   Layouts are cached per function object and may be looked up from several threads,
+     *   also while another thread calls @ref Reset.
+     */
+    template<class UObjectLike = UObject, class UFunctionLike = UFunction, class UBoolPropertyLike = UBoolProperty>
+    class TDynamicInvoker final {
+    public:
+
+        using Value = TScriptValue<UObjectLike>;
+
+    private:
+
+        std::unordered_map<UFunctionLike const*, std::shared_ptr<FScriptFunctionLayout const>> m_layouts{};
+        mutable std::shared_mutex m_mutex{};
+
+    public:
+
+        TDynamicInvoker() = default;
+        TDynamicInvoker(TDynamicInvoker const&) = delete;
+        TDynamicInvoker& operator=(TDynamicInvoker const&) = delete;
+
+        /**
+         * @brief       Calls the function with full name @p FunctionPath on @p Object, see @ref Invoke.
+         * @remarks     The path is looked up on every call, hold on to the function for hot paths.
+         */
+        EDynamicInvokeError Invoke(UObjectLike* const Object, wchar_t const* const FunctionPath,
+            std::span<Value> const Args, Value* const OutReturnValue = nullptr)
+            requires requires { UObjectLike::template FindObject<UFunctionLike>(L""); }
+        {
+            UFunctionLike* const Function = FunctionPath != nullptr ? UObjectLike::template FindObject<UFunctionLike>(FunctionPath) : nullptr;
+            return Invoke(Object, Function, Args, OutReturnValue);
+        }
+
+        /**
+         * @brief       Calls @p Function on @p Object with @p Args.
+         * @param[in]   Object - Context object of the call.
+         * @param[in]   Function - Function to call.
+         * @param[in]   Args - Arguments in declaration order, out parameters are written back into them.
+         * @param[out]  OutReturnValue - Receives the return value if given, or @c std::monostate if there is none.
+         * @return      @c EDynamicInvokeError::None if the call was made, otherwise why it was not.
+         */
+        EDynamicInvokeError Invoke(UObjectLike* const Object, UFunctionLike* const Function,
+            std::span<Value> const Args, Value* const OutReturnValue = nullptr)
+        {
+            if (Object == nullptr || Function == nullptr)
+                return EDynamicInvokeError::NotFound;
+
+            std::shared_ptr<FScriptFunctionLayout const> const LayoutRef = GetLayout(Function);
+            FScriptFunctionLayout const& Layout = *LayoutRef;
+            if (Layout.bHasUnsupported)
+                return EDynamicInvokeError::UnsupportedParm;
+            if (Args.size() > Layout.Parms.size())
+                return EDynamicInvokeError::NumArgs;
+            for (size_t i = 0; i < Args.size(); ++i) {
+                if (!CanWrite(Layout.Parms[i].Kind, Args[i]))
+                    return EDynamicInvokeError::ArgumentType;
+            }
+
+            static constexpr size_t k_inlineSize = 512;
+            alignas(16) BYTE InlineParms[k_inlineSize];
+            std::unique_ptr<BYTE[]> HeapParms{};
+
+            size_t const ParmsSize = static_cast<size_t>(std::max(Layout.ParmsSize, 1));
+            BYTE* const Parms = ParmsSize <= k_inlineSize
+                ? InlineParms
+                : (HeapParms = std::make_unique<BYTE[]>(ParmsSize)).get();
+            std::memset(Parms, 0, ParmsSize);
+
+            // Strings are constructed in place, so that whoever writes them may reallocate them.
+            if (Layout.bHasStrings) {
+                for (FScriptParmInfo const& Parm : Layout.Parms) {
+                    if (Parm.Kind == EScriptParmKind::String)
+                        ::new (static_cast<void*>(Parms + Parm.Offset)) FString{};
+                }
+                if (Layout.bHasReturnValue && Layout.ReturnValue.Kind == EScriptParmKind::String)
+                    ::new (static_cast<void*>(Parms + Layout.ReturnValue.Offset)) FString{};
+            }
+
+            for (size_t i = 0; i < Args.size(); ++i)
+                Write(Layout.Parms[i], Parms, Args[i]);
+
+            if (!CallNativeDirect(Object, Function, Parms))
+                Object->ProcessEvent(reinterpret_cast<UFunction*>(Function), Parms, nullptr);
+
+            for (size_t i = 0; i < Args.size(); ++i) {
+                if (Layout.Parms[i].IsOut())
+                    Args[i] = Read(Layout.Parms[i], Parms);
+            }
+            if (OutReturnValue != nullptr)
+                *OutReturnValue = Layout.bHasReturnValue ? Read(Layout.ReturnValue, Parms) : Value{};
+
+            if (Layout.bHasStrings) {
+                for (FScriptParmInfo const& Parm : Layout.Parms) {
+                    if (Parm.Kind == EScriptParmKind::String)
+                        std::destroy_at(reinterpret_cast<FString*>(Parms + Parm.Offset));
+                }
+                if (Layout.bHasReturnValue && Layout.ReturnValue.Kind == EScriptParmKind::String)
+                    std::destroy_at(reinterpret_cast<FString*>(Parms + Layout.ReturnValue.Offset));
+            }
+
+            return EDynamicInvokeError::None;
+        }
+
+        /** Returns the cached parameter layout of @p Function, building it on first use; it outlives a concurrent @ref Reset. */
+        std::shared_ptr<FScriptFunctionLayout const> GetLayout(UFunctionLike const* const Function) {
+            {
+                std::shared_lock const Lock{ m_mutex };
+                auto const Found = m_layouts.find(Function);
+                if (Found != m_layouts.end())
+                    return Found->second;
+            }
+
+            auto Layout = std::make_shared<FScriptFunctionLayout const>(BuildScriptFunctionLayout<UBoolPropertyLike>(Function));
+            std::unique_lock const Lock{ m_mutex };
+            return m_layouts.try_emplace(Function, std::move(Layout)).first->second;
+        }
+
+        /** Drops all cached layouts, e.g. when the functions they describe may have been unloaded. */
+        void Reset() {
+            std::unique_lock const Lock{ m_mutex };
+            m_layouts.clear();
+        }
+
+        INT NumLayouts() const {
+            std::shared_lock const Lock{ m_mutex };
+            return static_cast<INT>(m_layouts.size());
+        }
+
+    private:
+
+        static bool CanWrite(EScriptParmKind const Kind, Value const& Argument) noexcept {
+            if (std::holds_alternative<std::monostate>(Argument))
+                return true;
+
+            switch (Kind) {
+            case EScriptParmKind::Byte:
+                return std::holds_alternative<BYTE>(Argument)
+                    || (std::holds_alternative<INT>(Argument) && std::get<INT>(Argument) >= 0 && std::get<INT>(Argument) <= 0xFF);
+            case EScriptParmKind::Int:
+                return std::holds_alternative<INT>(Argument) || std::holds_alternative<BYTE>(Argument);
+            case EScriptParmKind::Bool:
+                return std::holds_alternative<bool>(Argument) || std::holds_alternative<INT>(Argument);
+            case EScriptParmKind::Float:
+                return std::holds_alternative<FLOAT>(Argument) || std::holds_alternative<INT>(Argument);
+            case EScriptParmKind::Object:
+                return std::holds_alternative<UObjectLike*>(Argument);
+            case EScriptParmKind::Name:
+                return std::holds_alternative<SFXName>(Argument) || std::holds_alternative<std::wstring>(Argument);
+            case EScriptParmKind::String:
+                return std::holds_alternative<std::wstring>(Argument);
+            default:
+                return false;
+            }
+        }
+
+        static void Write(FScriptParmInfo const& Parm, BYTE* const Parms, Value const& Argument) {
+            if (std::holds_alternative<std::monostate>(Argument))
+                return;
+
+            BYTE* const Address = Parms + Parm.Offset;
+            switch (Parm.Kind) {
+            case EScriptParmKind::Byte: {
+                BYTE const Byte = std::holds_alternative<BYTE>(Argument) ? std::get<BYTE>(Argument) : static_cast<BYTE>(std::get<INT>(Argument));
+                std::memcpy(Address, &Byte, sizeof(Byte));
+                break;
+            }
+            case EScriptParmKind::Int: {
+                INT const Int = std::holds_alternative<INT>(Argument) ? std::get<INT>(Argument) : static_cast<INT>(std::get<BYTE>(Argument));
+                std::memcpy(Address, &Int, sizeof(Int));
+                break;
+            }
+            case EScriptParmKind::Bool: {
+                bool const bValue = std::holds_alternative<bool>(Argument) ? std::get<bool>(Argument) : std::get<INT>(Argument) != 0;
+                DWORD Bits;
+                std::memcpy(&Bits, Address, sizeof(Bits));
+                Bits = bValue ? (Bits | Parm.BitMask) : (Bits & ~Parm.BitMask);
+                std::memcpy(Address, &Bits, sizeof(Bits));
+                break;
+            }
+            case EScriptParmKind::Float: {
+                FLOAT const Float = std::holds_alternative<FLOAT>(Argument) ? std::get<FLOAT>(Argument) : static_cast<FLOAT>(std::get<INT>(Argument));
+                std::memcpy(Address, &Float, sizeof(Float));
+                break;
+            }
+            case EScriptParmKind::Object: {
+                UObjectLike* const Object = std::get<UObjectLike*>(Argument);
+                std::memcpy(Address, &Object, sizeof(Object));
+                break;
+            }
+            case EScriptParmKind::Name: {
+                SFXName const Name = std::holds_alternative<SFXName>(Argument)
+                    ? std::get<SFXName>(Argument)
+                    : SFXName{ std::get<std::wstring>(Argument).c_str(), 0, true };
+                std::memcpy(Address, &Name, sizeof(Name));
+                break;
+            }
+            case EScriptParmKind::String:
+                *reinterpret_cast<FString*>(Address) = std::get<std::wstring>(Argument).c_str();
+                break;
+            default:
+                break;
+            }
+        }
+
+        static Value Read(FScriptParmInfo const& Parm, BYTE const* const Parms) {
+            BYTE const* const Address = Parms + Parm.Offset;
+            switch (Parm.Kind) {
+            case EScriptParmKind::Byte:
+                return Value{ std::in_place_type<BYTE>, *Address };
+            case EScriptParmKind::Int: {
+                INT Int;
+                std::memcpy(&Int, Address, sizeof(Int));
+                return Value{ std::in_place_type<INT>, Int };
+            }
+            case EScriptParmKind::Bool: {
+                DWORD Bits;
+                std::memcpy(&Bits, Address, sizeof(Bits));
+                return Value{ std::in_place_type<bool>, (Bits & Parm.BitMask) != 0 };
+            }
+            case EScriptParmKind::Float: {
+                FLOAT Float;
+                std::memcpy(&Float, Address, sizeof(Float));
+                return Value{ std::in_place_type<FLOAT>, Float };
+            }
+            case EScriptParmKind::Object: {
+                UObjectLike* Object;
+                std::memcpy(&Object, Address, sizeof(Object));
+                return Value{ std::in_place_type<UObjectLike*>, Object };
+            }
+            case EScriptParmKind::Name: {
+                SFXName Name;
+                std::memcpy(&Name, Address, sizeof(Name));
+                return Value{ std::in_place_type<SFXName>, Name };
+            }
+            case EScriptParmKind::String: {
+                FString const& String = *reinterpret_cast<FString const*>(Address);
+                return Value{ std::in_place_type<std::wstring>, String.Chars(), String.Length() };
+            }
+            default:
+                return Value{};
+            }
+        }
+    };
+
+}
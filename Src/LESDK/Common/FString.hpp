@@ -522,6 +522,10 @@ static_assert(std::is_copy_constructible_v<FString>);
 static_assert(std::is_move_assignable_v<FString>);
 static_assert(std::is_move_constructible_v<FString>);
 
+// FString only owns its heap buffer, so arrays of strings may be reallocated in place.
+template<>
+struct TIsTriviallyRelocatable<FString> : std::true_type {};
+
 inline FString::FString(const_pointer const InStr)
     : FStringBase{}
 {
@@ -0,0 +1,155 @@
+/**
+ * @file        LESDK/Common/FrameReader.hpp
+ * @brief       This file implements typed readers for the parameters of natives, like the engine's P_GET_* macros.
+ */
+
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/Frame.hpp"
+
+
+namespace LESDK {
+
+    /** @c EX_LocalVariable opcode, followed by the property of a local variable. */
+    inline constexpr BYTE k_exLocalVariable = 0x00;
+    /** @c EX_InstanceVariable opcode, followed by the property of a member of the context object. */
+    inline constexpr BYTE k_exInstanceVariable = 0x01;
+    /** @c EX_EndFunctionParms opcode, terminates the arguments of a call. */
+    inline constexpr BYTE k_exEndFunctionParms = 0x16;
+    /** @c EX_LocalOutVariable opcode, followed by the property of an out parameter. */
+    inline constexpr BYTE k_exLocalOutVariable = 0x48;
+
+    /** How the parameters of type @p T are read from a frame. */
+    template<class T>
+    struct TFrameParm {
+        /** Whether plain variables passed as arguments are read where they are, without going through @c GNatives. */
+        static constexpr bool bInPlace = true;
+    };
+
+    // Bools are bitfields, so only the engine knows which bit of a variable to read.
+    template<>
+    struct TFrameParm<bool> {
+        static constexpr bool bInPlace = false;
+    };
+
+    /**
+     * @brief
+     *   Reads the arguments of a native call from its frame, in order, the way the engine's
+     *   @c P_GET_* macros do, finishing with @ref Finish like @c P_FINISH.
+     *
+     * @remarks
+     *   Arguments that are plain local, member or out parameter variables are decoded here from
+     *   @c FFrame::Code and read, or referenced, where they live; this is what nearly all arguments
+     *   of frames built by @c ProcessEvent are. Any other expression is evaluated through
+     *   @c FFrame::Step. A native using the reader thus does no more work than the engine's own.
+     *   Templated over the property type for late binding, see @c LESDK/Common/Misc.hpp.
+     */
+    template<class UPropertyLike = UProperty>
+    class TFrameReader final {
+        FFrame&     m_stack;
+
+    public:
+
+        explicit TFrameReader(FFrame& Stack) noexcept : m_stack{ Stack } {}
+
+        TFrameReader(TFrameReader const&) = delete;
+        TFrameReader& operator=(TFrameReader const&) = delete;
+
+        /** Reads the next argument by value, like @c P_GET_INT and friends. */
+        template<class T>
+        T Get() {
+            static_assert(!std::is_reference_v<T>, "use GetRef for out parameters");
+
+            if constexpr (TFrameParm<T>::bInPlace) {
+                if (BYTE const* const Address = NextVariable()) {
+                    if constexpr (std::is_trivially_copyable_v<T>) {
+                        T Value;
+                        std::memcpy(&Value, Address, sizeof(T));
+                        return Value;
+                    }
+                    else {
+                        return *reinterpret_cast<T const*>(Address);
+                    }
+                }
+            }
+
+            if constexpr (std::is_same_v<T, bool>) {
+                UBOOL Value = 0;
+                m_stack.Step(m_stack.Object, &Value);
+                return Value != 0;
+            }
+            else {
+                T Value{};
+                m_stack.Step(m_stack.Object, &Value);
+                return Value;
+            }
+        }
+
+        /**
+         * @brief       Reads the next argument by reference, like @c P_GET_INT_REF and friends.
+         * @param[in]   Fallback - Receives the value of the argument if it is an expression without an address.
+         * @return      The variable passed as the argument, or @p Fallback.
+         * @remarks     Bool out parameters are never packed with others, read them as @c UBOOL.
+         */
+        template<class T>
+        T& GetRef(T& Fallback) {
+            static_assert(!std::is_same_v<T, bool>, "script bools are bitfields, read out parameters as UBOOL");
+
+            if (BYTE* const Address = NextVariable())
+                return *reinterpret_cast<T*>(Address);
+
+            m_stack.Step(m_stack.Object, &Fallback);
+            return Fallback;
+        }
+
+        /** Skips the end of the arguments, like @c P_FINISH. */
+        void Finish() noexcept {
+            if (m_stack.Code != nullptr)
+                ++m_stack.Code;
+        }
+
+    private:
+
+        /** Decodes the next argument if it is a plain variable, returning its address, otherwise leaves it be. */
+        BYTE* NextVariable() noexcept {
+            BYTE* const Code = m_stack.Code;
+            if (Code == nullptr)
+                return nullptr;
+
+            BYTE const Token = Code[0];
+            if (Token != k_exLocalVariable && Token != k_exInstanceVariable && Token != k_exLocalOutVariable)
+                return nullptr;
+
+            UPropertyLike const* Property;
+            std::memcpy(&Property, Code + 1, sizeof(Property));
+            if (Property == nullptr)
+                return nullptr;
+
+            BYTE* Address = nullptr;
+            if (Token == k_exLocalVariable) {
+                Address = m_stack.Locals + Property->Offset;
+            }
+            else if (Token == k_exInstanceVariable) {
+                Address = reinterpret_cast<BYTE*>(m_stack.Object) + Property->Offset;
+            }
+            else {
+                for (FFrame::FOutParmRec const* Out = m_stack.OutParms; Out != nullptr; Out = Out->NextOutParm) {
+                    if (reinterpret_cast<UPropertyLike const*>(Out->Property) == Property) {
+                        Address = Out->PropAddr;
+                        break;
+                    }
+                }
+                if (Address == nullptr)
+                    return nullptr;
+            }
+
+            m_stack.Code = Code + 1 + sizeof(Property);
+            return Address;
+        }
+    };
+
+}
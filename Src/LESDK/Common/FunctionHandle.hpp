@@ -0,0 +1,246 @@
+/**
+ * @file        LESDK/Common/FunctionHandle.hpp
+ * @brief       This file implements typed, layout-checked handles for calling script functions.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/NativeCall.hpp"
+
+
+namespace LESDK {
+
+    /** @c CPF_ReturnParm property flag. */
+    inline constexpr QWORD k_propReturnParm = 0x0000000000000400;
+
+    /** Reasons why a function handle may refuse to bind to a function. */
+    enum class EFunctionBindError : INT {
+        None = 0,
+        /** No function with the given path exists. */
+        NotFound,
+        /** The function has a different number of parameters, including the return value. */
+        NumParms,
+        /** The parameters add up to a different size. */
+        ParmsSize,
+        /** The return value lives somewhere else, or exists only on one side. */
+        ReturnValueOffset,
+        /** Some parameter has a different offset, size, or direction. */
+        Parameter,
+    };
+
+    namespace Detail {
+
+        /** How a C++ parameter type of a function handle maps to a script parameter. */
+        template<class T>
+        struct TScriptParm {
+            using Type = std::remove_cvref_t<T>;
+            static constexpr bool bOut = std::is_lvalue_reference_v<T> && !std::is_const_v<std::remove_reference_t<T>>;
+        };
+
+        // Script booleans are 32-bit bitfields.
+        template<class T> requires std::is_same_v<std::remove_cvref_t<T>, bool>
+        struct TScriptParm<T> {
+            using Type = UBOOL;
+            static constexpr bool bOut = std::is_lvalue_reference_v<T> && !std::is_const_v<std::remove_reference_t<T>>;
+        };
+
+        /** Parameter block layout of a script function, computed like the script compiler does under 4-byte packing. */
+        template<class R, class... Args>
+        struct TScriptParmLayout {
+            static constexpr INT k_numArgs = static_cast<INT>(sizeof...(Args));
+            static constexpr bool k_hasReturn = !std::is_void_v<R>;
+            static constexpr INT k_numParms = k_numArgs + (k_hasReturn ? 1 : 0);
+
+            INT     Offsets[k_numParms + 1]{};
+            INT     Sizes[k_numParms + 1]{};
+            bool    bOuts[k_numParms + 1]{};
+            INT     ParmsSize{ 0 };
+
+            template<class T>
+            static constexpr INT AlignOf() noexcept { return std::min<INT>(alignof(T), 4); }
+
+            consteval TScriptParmLayout() {
+                INT Offset = 0;
+                INT Index = 0;
+                auto const Place = [&]<class T>(bool const bOut) {
+                    Offset = (Offset + AlignOf<T>() - 1) / AlignOf<T>() * AlignOf<T>();
+                    Offsets[Index] = Offset;
+                    Sizes[Index] = static_cast<INT>(sizeof(T));
+                    bOuts[Index] = bOut;
+                    Offset += static_cast<INT>(sizeof(T));
+                    ++Index;
+                };
+
+                (Place.template operator()<typename TScriptParm<Args>::Type>(TScriptParm<Args>::bOut), ...);
+                if constexpr (k_hasReturn)
+                    Place.template operator()<typename TScriptParm<R>::Type>(true);
+                ParmsSize = Offset;
+            }
+        };
+
+    }
+
+    template<class Signature, class UObjectLike = UObject, class UFunctionLike = UFunction>
+    class TFunctionHandle;
+
+    /**
+     * @brief
+     *   A call-site handle for a script function with the C++ signature @p R(Args...),
+     *   resolved and checked once, then invoked without any lookups.
+     *
+     * @remarks
+     *   Non-const lvalue reference parameters are out parameters, copied in before the call and
+     *   back after it; @c bool maps to a 32-bit script boolean. Binding checks the parameter layout
+     *   computed from the signature against @c ParmsSize, @c NumParms, @c ReturnValueOffset and the
+     *   parameters on the @c PropertyLink chain, and refuses functions that do not match.
+     *   Like generated wrappers, parameters are copied bitwise and results are moved out bitwise.
+     *   Natives are called directly, everything else goes through @c ProcessEvent.
+     */
+    template<class R, class... Args, class UObjectLike, class UFunctionLike>
+    class TFunctionHandle<R(Args...), UObjectLike, UFunctionLike> final {
+        using Layout = Detail::TScriptParmLayout<R, Args...>;
+        static constexpr Layout k_layout{};
+        /** Size of the parameter block passed to the function, as @ref Check accepts it rounded up to 4. */
+        static constexpr INT k_parmsCapacity = std::max((k_layout.ParmsSize + 3) / 4 * 4, 4);
+
+        wchar_t const*          m_path{ nullptr };
+        UFunctionLike*          m_function{ nullptr };
+        bool                    m_bNative{ false };
+
+    public:
+
+        constexpr TFunctionHandle() noexcept = default;
+
+        /** Creates an unbound handle for the function with full name @p Path. */
+        constexpr explicit TFunctionHandle(wchar_t const* const Path) noexcept : m_path{ Path } {}
+
+        /** Resolves the path given on construction and binds to the function found, see @ref Bind(UFunctionLike*). */
+        EFunctionBindError Bind() requires requires { UObjectLike::template FindObject<UFunctionLike>(L""); } {
+            UFunctionLike* const Function = m_path != nullptr ? UObjectLike::template FindObject<UFunctionLike>(m_path) : nullptr;
+            return Bind(Function);
+        }
+
+        /**
+         * @brief       Binds to @p Function if its parameters match the signature of this handle.
+         * @return      @c EFunctionBindError::None on success, otherwise what did not match; the handle is then left unbound.
+         */
+        EFunctionBindError Bind(UFunctionLike* const Function) {
+            m_function = nullptr;
+            EFunctionBindError const Error = Check(Function);
+            if (Error == EFunctionBindError::None) {
+                m_function = Function;
+                m_bNative = GetNativeThunk(Function) != nullptr;
+            }
+            return Error;
+        }
+
+        bool IsBound() const noexcept { return m_function != nullptr; }
+        UFunctionLike* GetFunction() const noexcept { return m_function; }
+
+        /** Calls the bound function on @p Object. */
+        R operator()(UObjectLike* const Object, Args... Arguments) const {
+            LESDK_CHECK(m_function != nullptr && Object != nullptr, "function handle must be bound");
+
+            alignas(16) BYTE Parms[k_parmsCapacity]{};
+            INT Index = 0;
+            (CopyIn<Args>(Parms, Index++, Arguments), ...);
+
+            if (!m_bNative || !CallNativeDirect(Object, m_function, Parms))
+                Object->ProcessEvent(reinterpret_cast<UFunction*>(m_function), Parms, nullptr);
+
+            Index = 0;
+            (CopyOut<Args>(Parms, Index++, Arguments), ...);
+
+            if constexpr (Layout::k_hasReturn) {
+                using ReturnType = typename Detail::TScriptParm<R>::Type;
+                alignas(ReturnType) BYTE Storage[sizeof(ReturnType)];
+                std::memcpy(Storage, Parms + k_layout.Offsets[Layout::k_numArgs], sizeof(ReturnType));
+                if constexpr (std::is_same_v<std::remove_cvref_t<R>, bool>)
+                    return *reinterpret_cast<UBOOL const*>(Storage) != 0;
+                else
+                    return std::move(*reinterpret_cast<ReturnType*>(Storage));
+            }
+        }
+
+    private:
+
+        template<class T>
+        static void CopyIn(BYTE* const Parms, INT const Index, T const& Argument) noexcept {
+            using Type = typename Detail::TScriptParm<T>::Type;
+            if constexpr (std::is_same_v<std::remove_cvref_t<T>, bool>) {
+                UBOOL const Value = Argument ? 1 : 0;
+                std::memcpy(Parms + k_layout.Offsets[Index], &Value, sizeof(Type));
+            }
+            else {
+                std::memcpy(Parms + k_layout.Offsets[Index], &Argument, sizeof(Type));
+            }
+        }
+
+        template<class T>
+        static void CopyOut(BYTE const* const Parms, INT const Index, std::remove_reference_t<T>& Argument) noexcept {
+            if constexpr (Detail::TScriptParm<T>::bOut) {
+                using Type = typename Detail::TScriptParm<T>::Type;
+                if constexpr (std::is_same_v<std::remove_cvref_t<T>, bool>) {
+                    UBOOL Value;
+                    std::memcpy(&Value, Parms + k_layout.Offsets[Index], sizeof(Type));
+                    Argument = Value != 0;
+                }
+                else {
+                    std::memcpy(&Argument, Parms + k_layout.Offsets[Index], sizeof(Type));
+                }
+            }
+        }
+
+        static EFunctionBindError Check(UFunctionLike const* const Function) noexcept {
+            if (Function == nullptr)
+                return EFunctionBindError::NotFound;
+            if (Function->NumParms != Layout::k_numParms)
+                return EFunctionBindError::NumParms;
+            // The engine may or may not round the block up to its packing, see k_parmsCapacity.
+            if (Function->ParmsSize != k_layout.ParmsSize && Function->ParmsSize != (k_layout.ParmsSize + 3) / 4 * 4)
+                return EFunctionBindError::ParmsSize;
+
+            INT const ReturnValueOffset = Layout::k_hasReturn ? k_layout.Offsets[Layout::k_numArgs] : -1;
+            INT const ActualReturnValueOffset = Function->ReturnValueOffset >= 0 && Function->ReturnValueOffset < Function->ParmsSize
+                ? Function->ReturnValueOffset
+                : -1;
+            if (ActualReturnValueOffset != ReturnValueOffset)
+                return EFunctionBindError::ReturnValueOffset;
+
+            // Parameters are matched up by offset, the link order is not relied upon.
+            bool bSeen[Layout::k_numParms + 1]{};
+            INT NumSeen = 0;
+            for (auto* Property = Function->PropertyLink; Property != nullptr; Property = Property->PropertyLinkNext) {
+                if ((Property->PropertyFlags & k_propParm) == 0)
+                    continue;
+
+                INT Index = 0;
+                while (Index < Layout::k_numParms && (bSeen[Index] || k_layout.Offsets[Index] != Property->Offset))
+                    ++Index;
+                if (Index == Layout::k_numParms)
+                    return EFunctionBindError::Parameter;
+
+                bool const bReturn = (Property->PropertyFlags & k_propReturnParm) != 0;
+                bool const bOut = (Property->PropertyFlags & k_propOutParm) != 0;
+                if (Property->ElementSize * Property->ArrayDim != k_layout.Sizes[Index]
+                    || bOut != k_layout.bOuts[Index]
+                    || bReturn != (Layout::k_hasReturn && Index == Layout::k_numArgs))
+                {
+                    return EFunctionBindError::Parameter;
+                }
+
+                bSeen[Index] = true;
+                ++NumSeen;
+            }
+
+            return NumSeen == Layout::k_numParms ? EFunctionBindError::None : EFunctionBindError::Parameter;
+        }
+    };
+
+}
@@ -0,0 +1,344 @@
+/**
+ * @file        LESDK/Common/InlineArray.hpp
+ * @brief       This file implements arrays and strings with inline storage, which only allocate past a fixed size.
+ */
+
+#pragma once
+
+// #include <algorithm>
+// #include <cstring>
+// #include <memory>
+// #include <span>
+// #include <string>
+// #include <type_traits>
+
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/FString.hpp"
+#include "LESDK/Common/TArray.hpp"
+
+
+/**
+ * @brief   Dynamic array keeping up to @p InlineCount elements inside itself, for SDK-local temporaries.
+ * @tparam  T Element type.
+ * @tparam  InlineCount Number of elements stored without going through @c GMalloc.
+ * @remarks Past @p InlineCount the elements spill to @c GMalloc and grow like a TArray does.
+ *          Unlike TArray, this type is not engine-compatible and must not be a member of engine structures.
+ */
+template<TArrayElement T, UINT InlineCount>
+class TInlineArray final {
+    CONTAINER_TYPEDEFS(T, UINT, INT)
+
+    static_assert(InlineCount > 0);
+
+    using Base = TArrayBase<T, false>;
+
+    alignas(value_type) BYTE    InlineData[InlineCount * sizeof(value_type)];
+    pointer                     Data{ reinterpret_cast<pointer>(InlineData) };
+    size_type                   CountItems{ 0 };
+    size_type                   CountMax{ InlineCount };
+
+public:
+
+    TInlineArray() noexcept {}
+    TInlineArray(std::initializer_list<value_type> List);
+    ~TInlineArray() noexcept;
+
+    TInlineArray(TInlineArray const& Other);
+    TInlineArray& operator=(TInlineArray const& Other);
+    TInlineArray(TInlineArray&& Other) noexcept;
+    TInlineArray& operator=(TInlineArray&& Other) noexcept;
+
+    pointer GetData() noexcept { return Data; }
+    const_pointer GetData() const noexcept { return Data; }
+
+    size_type Capacity() const noexcept { return CountMax; }
+    size_type Count() const noexcept { return CountItems; }
+
+    [[nodiscard]] bool Any() const noexcept { return CountItems != 0; }
+    [[nodiscard]] bool Empty() const noexcept { return CountItems == 0; }
+
+    /** Whether the elements are still stored inline, i.e. nothing was allocated. */
+    [[nodiscard]] bool IsInline() const noexcept { return Data == reinterpret_cast<const_pointer>(InlineData); }
+
+    void Clear() noexcept;
+    void Reserve(size_type Capacity);
+
+    void Add(const_reference Value) { Emplace(Value); }
+    void Add(value_type&& Value) { Emplace(std::move(Value)); }
+
+    template<typename... ArgTypes>
+    reference Emplace(ArgTypes&&... Args);
+
+    void Append(std::span<value_type const> Values);
+
+    void Erase(size_type Position, size_type Count = 1);
+
+    reference operator()(size_type Index);
+    const_reference operator()(size_type Index) const;
+
+    /**
+     * @brief   Returns an engine-compatible view of the elements, for passing them to the engine.
+     * @remarks Inline elements are moved to @c GMalloc first, so that the view never refers to memory
+     *          the engine could not reallocate or free. The array still owns the elements though,
+     *          so the engine must not grow or free them through the view.
+     */
+    TArrayView<T> AsView();
+
+    std::span<value_type> AsSpan() noexcept { return std::span<value_type>(Data, CountItems); }
+    std::span<value_type const> AsSpan() const noexcept { return std::span<value_type const>(Data, CountItems); }
+
+    [[nodiscard]] inline iterator           begin() noexcept { return Data; }
+    [[nodiscard]] inline const_iterator     begin() const noexcept { return Data; }
+    [[nodiscard]] inline iterator           end() noexcept { return Data + CountItems; }
+    [[nodiscard]] inline const_iterator     end() const noexcept { return Data + CountItems; }
+
+private:
+
+    void DoGrow(size_type LowestBound);
+    void DoMoveTo(size_type Capacity);
+    void DoTakeFrom(TInlineArray& Other) noexcept;
+};
+
+template<TArrayElement T, UINT InlineCount>
+TInlineArray<T, InlineCount>::TInlineArray(std::initializer_list<value_type> const List)
+    : TInlineArray{}
+{
+    Append(std::span<value_type const>(List.begin(), List.size()));
+}
+
+template<TArrayElement T, UINT InlineCount>
+TInlineArray<T, InlineCount>::~TInlineArray() noexcept {
+    Clear();
+    if (!IsInline()) {
+        sdkFreeTyped(Data);
+    }
+}
+
+template<TArrayElement T, UINT InlineCount>
+TInlineArray<T, InlineCount>::TInlineArray(TInlineArray const& Other)
+    : TInlineArray{}
+{
+    Append(Other.AsSpan());
+}
+
+template<TArrayElement T, UINT InlineCount>
+TInlineArray<T, InlineCount>& TInlineArray<T, InlineCount>::operator=(TInlineArray const& Other) {
+    if (this != &Other) {
+        Clear();
+        Append(Other.AsSpan());
+    }
+    return *this;
+}
+
+template<TArrayElement T, UINT InlineCount>
+TInlineArray<T, InlineCount>::TInlineArray(TInlineArray&& Other) noexcept
+    : TInlineArray{}
+{
+    DoTakeFrom(Other);
+}
+
+template<TArrayElement T, UINT InlineCount>
+TInlineArray<T, InlineCount>& TInlineArray<T, InlineCount>::operator=(TInlineArray&& Other) noexcept {
+    if (this != &Other) {
+        Clear();
+        DoTakeFrom(Other);
+    }
+    return *this;
+}
+
+template<TArrayElement T, UINT InlineCount>
+void TInlineArray<T, InlineCount>::Clear() noexcept {
+    std::destroy(Data, Data + CountItems);
+    CountItems = 0;
+}
+
+template<TArrayElement T, UINT InlineCount>
+void TInlineArray<T, InlineCount>::Reserve(size_type const Capacity) {
+    if (Capacity > CountMax) {
+        DoMoveTo(Capacity);
+    }
+}
+
+template<TArrayElement T, UINT InlineCount>
+template<typename... ArgTypes>
+TInlineArray<T, InlineCount>::reference
+TInlineArray<T, InlineCount>::Emplace(ArgTypes&&... Args) {
+    if (CountItems == CountMax) {
+        // Arguments may refer to elements of this array, which are about to move.
+        value_type Value(std::forward<ArgTypes>(Args)...);
+        DoGrow(CountItems + 1);
+        if constexpr (std::is_move_constructible_v<value_type>) {
+            return *new (Data + CountItems++) T(std::move(Value));
+        } else {
+            return *new (Data + CountItems++) T(Value);
+        }
+    }
+    return *new (Data + CountItems++) T(std::forward<ArgTypes>(Args)...);
+}
+
+template<TArrayElement T, UINT InlineCount>
+void TInlineArray<T, InlineCount>::Append(std::span<value_type const> const Values) {
+    if (Values.empty())
+        return;
+
+    const_pointer Source = Values.data();
+    bool const bAliased = Source >= Data && Source < Data + CountItems;
+    auto const SourceOffset = bAliased ? static_cast<size_type>(Source - Data) : 0;
+
+    auto const Count = static_cast<size_type>(Values.size());
+    if (CountItems + Count > CountMax) {
+        DoGrow(CountItems + Count);
+        if (bAliased)
+            Source = Data + SourceOffset;
+    }
+
+    std::uninitialized_copy_n(Source, Count, Data + CountItems);
+    CountItems += Count;
+}
+
+template<TArrayElement T, UINT InlineCount>
+void TInlineArray<T, InlineCount>::Erase(size_type const Position, size_type const Count) {
+    LESDK_CHECK(Count > 0, "");
+    LESDK_CHECK(Position + Count <= CountItems, "");
+
+    std::destroy(Data + Position, Data + Position + Count);
+    Base::DoRelocate(Data + Position, Data + Position + Count, CountItems - Position - Count);
+    CountItems -= Count;
+}
+
+template<TArrayElement T, UINT InlineCount>
+TInlineArray<T, InlineCount>::reference
+TInlineArray<T, InlineCount>::operator()(size_type const Index) {
+    LESDK_CHECK(Index < CountItems, "");
+    return Data[Index];
+}
+
+template<TArrayElement T, UINT InlineCount>
+TInlineArray<T, InlineCount>::const_reference
+TInlineArray<T, InlineCount>::operator()(size_type const Index) const {
+    LESDK_CHECK(Index < CountItems, "");
+    return Data[Index];
+}
+
+template<TArrayElement T, UINT InlineCount>
+TArrayView<T> TInlineArray<T, InlineCount>::AsView() {
+    if (Empty())
+        return TArrayView<T>{};
+    if (IsInline())
+        DoMoveTo(CountMax);
+    return TArrayView<T>{ Data, CountItems, CountMax };
+}
+
+template<TArrayElement T, UINT InlineCount>
+void TInlineArray<T, InlineCount>::DoGrow(size_type const LowestBound) {
+    Reserve(FEngineArrayGrowth::Grow(LowestBound, CountMax, sizeof(value_type)));
+}
+
+template<TArrayElement T, UINT InlineCount>
+void TInlineArray<T, InlineCount>::DoMoveTo(size_type const Capacity) {
+    pointer const Allocated = sdkMallocTyped<T>(Capacity, Base::k_defaultAlignment);
+    LESDK_CHECK(Allocated != nullptr, "");
+
+    Base::DoRelocate(Allocated, Data, CountItems);
+    if (!IsInline()) {
+        sdkFreeTyped(Data);
+    }
+
+    Data = Allocated;
+    CountMax = Capacity;
+}
+
+template<TArrayElement T, UINT InlineCount>
+void TInlineArray<T, InlineCount>::DoTakeFrom(TInlineArray& Other) noexcept {
+    LESDK_CHECK(CountItems == 0, "");
+
+    if (Other.IsInline()) {
+        Base::DoRelocate(Data, Other.Data, Other.CountItems);
+        CountItems = std::exchange(Other.CountItems, 0);
+        return;
+    }
+
+    // Spilled elements change hands without being touched.
+    if (!IsInline()) {
+        sdkFreeTyped(Data);
+    }
+    Data = std::exchange(Other.Data, reinterpret_cast<pointer>(Other.InlineData));
+    CountItems = std::exchange(Other.CountItems, 0);
+    CountMax = std::exchange(Other.CountMax, InlineCount);
+}
+
+
+/**
+ * @brief   Null-terminated wide string keeping up to @p InlineLength characters inside itself,
+ *          for formatting names and paths without going through @c GMalloc.
+ * @tparam  InlineLength Number of characters, not counting the terminator, stored inline.
+ */
+template<UINT InlineLength>
+class TInlineString final {
+    CONTAINER_TYPEDEFS(WCHAR, UINT, INT)
+
+    // Always holds the terminator once anything was appended.
+    TInlineArray<WCHAR, InlineLength + 1> Storage{};
+
+public:
+
+    TInlineString() noexcept {}
+    explicit TInlineString(std::wstring_view const InStr) { Append(InStr); }
+
+    /** Returns the characters, always null-terminated. */
+    const_pointer Chars() const noexcept { return Storage.Any() ? Storage.GetData() : L""; }
+    const_pointer operator*() const noexcept { return Chars(); }
+
+    size_type Length() const noexcept { return Storage.Any() ? Storage.Count() - 1 : 0; }
+
+    [[nodiscard]] bool Any() const noexcept { return Length() != 0; }
+    [[nodiscard]] bool Empty() const noexcept { return Length() == 0; }
+    [[nodiscard]] bool IsInline() const noexcept { return Storage.IsInline(); }
+
+    void Clear() noexcept { Storage.Clear(); }
+
+    TInlineString& Append(std::wstring_view const InStr) {
+        if (!InStr.empty()) {
+            DoDropTerminator();
+            Storage.Append(std::span<value_type const>(InStr.data(), InStr.size()));
+            Storage.Add(L'\0');
+        }
+        return *this;
+    }
+
+    TInlineString& Append(value_type const InChar) {
+        DoDropTerminator();
+        Storage.Add(InChar);
+        Storage.Add(L'\0');
+        return *this;
+    }
+
+    /** Appends an ANSI string, widening each character like @c FString::AppendAnsi. */
+    TInlineString& AppendAnsi(char const* InAnsiStr) {
+        DoDropTerminator();
+        for (; *InAnsiStr != '\0'; ++InAnsiStr)
+            Storage.Add(static_cast<value_type>(static_cast<unsigned char>(*InAnsiStr)));
+        Storage.Add(L'\0');
+        return *this;
+    }
+
+    bool Equals(std::wstring_view const InStr) const noexcept { return static_cast<std::wstring_view>(*this) == InStr; }
+
+    operator std::wstring_view() const noexcept {
+        return std::wstring_view{ Chars(), Length() };
+    }
+
+    /** Copies the string into an engine-compatible FString. */
+    FString ToString() const {
+        return FString{ Chars() };
+    }
+
+private:
+
+    void DoDropTerminator() noexcept {
+        if (Storage.Any()) {
+            LESDK_CHECK(Storage(Storage.Count() - 1) == L'\0', "");
+            Storage.Erase(Storage.Count() - 1);
+        }
+    }
+};
@@ -0,0 +1,157 @@
+/**
+ * @file        LESDK/Common/InvokeBatch.hpp
+ * @brief       This file implements calling one function on many objects with a reused parameter block.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <span>
+// #include <vector>
+
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/DynamicInvoke.hpp"
+#include "LESDK/Common/FString.hpp"
+#include "LESDK/Common/NativeCall.hpp"
+
+
+namespace LESDK {
+
+    /** Outcome of an @ref InvokeBatch call. */
+    struct FInvokeBatchResult {
+        /** Number of objects the function was called on. */
+        INT                         NumCalls{ 0 };
+        /** Number of those calls that went straight to the native, see @ref CallNativeDirect. */
+        INT                         NumNativeCalls{ 0 };
+        /** Wall time spent in the batch, including parameter resets. */
+        std::chrono::nanoseconds    Elapsed{ 0 };
+        /** Whether the function has parameters the batch can't manage, in which case nothing was called. */
+        bool                        bRefused{ false };
+    };
+
+    /** Does nothing with the results of a call, the default for @ref InvokeBatch. */
+    struct FIgnoreInvokeResults final {
+        template<class UObjectLike>
+        void operator()(UObjectLike*, void*) const noexcept {}
+    };
+
+    /**
+     * @brief       Calls @p Function on every object in @p Objects, filling its parameters only once where possible.
+     * @param[in]   Function - Function to call, resolved by the caller once for the whole batch.
+     * @param[in]   Objects - Objects to call the function on, nulls are skipped.
+     * @param[in]   ParamsInit - Called with the zeroed parameter block to fill in the arguments.
+     * @param[in]   OnResults - Called after every call with the object and the parameter block, to read results.
+     * @return      Number of calls made and time spent.
+     *
+     * @remarks
+     *   The parameter block is allocated once and 16-byte aligned. Between calls the out parameters,
+     *   which include the return value, are restored to what @p ParamsInit left in them; inputs are
+     *   not touched again. When an out parameter is a string, which the callee may reallocate, the
+     *   block is instead destroyed and @p ParamsInit runs again before every call.
+     *   String parameters are constructed before @p ParamsInit and destroyed once the batch is done,
+     *   so @p OnResults must copy out whatever it keeps. Functions with other parameters that own
+     *   memory, e.g. arrays or structs holding strings, are refused.
+     *   Natives are called directly, everything else goes through @c ProcessEvent.
+     *   Templated over the object type for late binding, see @c LESDK/Common/Misc.hpp.
+     */
+    template<class UObjectLike, class UFunctionLike, class FParamsInit, class FOnResults = FIgnoreInvokeResults>
+    FInvokeBatchResult InvokeBatch(UFunctionLike* const Function, std::span<UObjectLike* const> const Objects,
+        FParamsInit&& ParamsInit, FOnResults&& OnResults = {})
+    {
+        struct FOutRange {
+            INT     Offset;
+            INT     Size;
+        };
+
+        FInvokeBatchResult Result{};
+        if (Function == nullptr)
+            return Result;
+
+        std::vector<FOutRange> OutRanges{};
+        std::vector<INT> StringOffsets{};
+        bool bOutStrings = false;
+        for (auto* Property = Function->PropertyLink; Property != nullptr; Property = Property->PropertyLinkNext) {
+            if ((Property->PropertyFlags & k_propParm) == 0)
+                continue;
+
+            bool const bOut = (Property->PropertyFlags & k_propOutParm) != 0;
+            if (ClassifyScriptParm(Property) == EScriptParmKind::String) {
+                StringOffsets.push_back(Property->Offset);
+                bOutStrings |= bOut;
+            } else if ((Property->PropertyFlags & k_propNeedCtorLink) != 0) {
+                Result.bRefused = true;
+                return Result;
+            } else if (bOut) {
+                OutRanges.push_back(FOutRange{ Property->Offset, Property->ElementSize * Property->ArrayDim });
+            }
+        }
+
+        auto const Start = std::chrono::steady_clock::now();
+
+        static constexpr size_t k_inlineSize = 512;
+        alignas(16) BYTE InlineParms[k_inlineSize];
+        std::unique_ptr<BYTE[]> HeapParms{};
+
+        size_t const ParmsSize = Function->ParmsSize;
+        BYTE* const Parms = ParmsSize <= k_inlineSize
+            ? InlineParms
+            : (HeapParms = std::make_unique<BYTE[]>(ParmsSize)).get();
+
+        auto const InitParms = [&]() {
+            std::memset(Parms, 0, ParmsSize);
+            for (INT const Offset : StringOffsets)
+                ::new (static_cast<void*>(Parms + Offset)) FString{};
+            ParamsInit(static_cast<void*>(Parms));
+        };
+        auto const DestroyParms = [&]() noexcept {
+            for (INT const Offset : StringOffsets)
+                std::destroy_at(reinterpret_cast<FString*>(Parms + Offset));
+        };
+
+        InitParms();
+
+        std::vector<BYTE> Initial{};
+        for (FOutRange const& Range : OutRanges)
+            Initial.insert(Initial.end(), Parms + Range.Offset, Parms + Range.Offset + Range.Size);
+
+        bool const bNative = GetNativeThunk(Function) != nullptr;
+        bool bFirst = true;
+
+        for (UObjectLike* const Object : Objects) {
+            if (Object == nullptr)
+                continue;
+
+            if (!bFirst) {
+                if (bOutStrings) {
+                    // Restoring the bytes would bring back a string the last call may have freed.
+                    DestroyParms();
+                    InitParms();
+                } else {
+                    BYTE const* Source = Initial.data();
+                    for (FOutRange const& Range : OutRanges) {
+                        std::memcpy(Parms + Range.Offset, Source, static_cast<size_t>(Range.Size));
+                        Source += Range.Size;
+                    }
+                }
+            }
+            bFirst = false;
+
+            if (bNative && CallNativeDirect(Object, Function, Parms))
+                ++Result.NumNativeCalls;
+            else
+                Object->ProcessEvent(reinterpret_cast<UFunction*>(Function), Parms, nullptr);
+
+            ++Result.NumCalls;
+            OnResults(Object, static_cast<void*>(Parms));
+        }
+
+        DestroyParms();
+
+        Result.Elapsed = std::chrono::steady_clock::now() - Start;
+        return Result;
+    }
+
+}
@@ -0,0 +1,140 @@
+/**
+ * @file        LESDK/Common/NativeCall.hpp
+ * @brief       This file implements calling native functions directly, without going through ProcessEvent.
+ */
+
+#pragma once
+
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/Frame.hpp"
+
+
+namespace LESDK {
+
+    /** @c FUNC_Native function flag. */
+    inline constexpr DWORD k_funcNative = 0x00000400;
+    /** @c CPF_Parm property flag. */
+    inline constexpr QWORD k_propParm = 0x0000000000000080;
+    /** @c CPF_OutParm property flag. */
+    inline constexpr QWORD k_propOutParm = 0x0000000000000100;
+    /** @c CPF_NeedCtorLink property flag, set on properties that own memory. */
+    inline constexpr QWORD k_propNeedCtorLink = 0x0000000000400000;
+
+    /**
+     * @brief
+     *   A minimal script frame over a caller-owned parameter block, as built by @c ProcessEvent
+     *   before it calls into a native function, including records for the out parameters.
+     *
+     * @remarks
+     *   The output device part of the frame gets a table of no-op virtuals, natives only
+     *   reach it when reporting script errors, which are then dropped instead of logged.
+     */
+    struct FNativeFrame final : public FFrame {
+        static constexpr INT k_maxOutParms = 32;
+
+        FOutParmRec         OutParmRecords[k_maxOutParms];
+
+        /**
+         * @brief       Builds a frame for calling @p Function on @p Object.
+         * @param[in]   Object - Context object of the call.
+         * @param[in]   Function - Native function, its parameter bytecode is read by the native.
+         * @param[in]   Parms - Parameter block laid out like the function's @c *_Parms struct.
+         */
+        template<class UObjectLike, class UFunctionLike>
+        FNativeFrame(UObjectLike* const Object, UFunctionLike* const Function, void* const Parms) noexcept {
+            Vfptr = const_cast<FVirtual*>(k_vtable);
+            Unknown1 = 0;
+            Unknown2 = 0;
+            Unknown3 = 0;
+#ifdef SDK_TARGET_LE3
+            Unknown4 = 0;
+#endif
+            Node = reinterpret_cast<UStruct*>(Function);
+            this->Object = reinterpret_cast<UObject*>(Object);
+            Code = Function->Script.GetData();
+            Locals = static_cast<BYTE*>(Parms);
+            PreviousFrame = nullptr;
+            OutParms = nullptr;
+
+            // Same order as the parameters, the engine looks records up by property.
+            FOutParmRec** Last = &OutParms;
+            INT NumOutParms = 0;
+            for (auto* Property = Function->PropertyLink; Property != nullptr; Property = Property->PropertyLinkNext) {
+                if ((Property->PropertyFlags & (k_propParm | k_propOutParm)) != (k_propParm | k_propOutParm))
+                    continue;
+                LESDK_CHECK(NumOutParms < k_maxOutParms, "too many out parameters");
+
+                FOutParmRec& Record = OutParmRecords[NumOutParms++];
+                Record.Property = reinterpret_cast<UProperty*>(Property);
+                Record.PropAddr = Locals + Property->Offset;
+                Record.NextOutParm = nullptr;
+                *Last = &Record;
+                Last = &Record.NextOutParm;
+            }
+        }
+
+        FNativeFrame(FNativeFrame const&) = delete;
+        FNativeFrame& operator=(FNativeFrame const&) = delete;
+
+    private:
+
+        using FVirtual = void (*)();
+
+        static void NoOp() noexcept {}
+
+        static constexpr FVirtual k_vtable[16]{
+            &NoOp, &NoOp, &NoOp, &NoOp, &NoOp, &NoOp, &NoOp, &NoOp,
+            &NoOp, &NoOp, &NoOp, &NoOp, &NoOp, &NoOp, &NoOp, &NoOp,
+        };
+    };
+
+    /**
+     * @brief       Returns the C++ entry point of a native function.
+     * @return      @c UFunction::Func if bound, otherwise the @c GNatives entry of the function, or null.
+     */
+    template<class UFunctionLike>
+    tNative* GetNativeThunk(UFunctionLike const* const Function) noexcept {
+        if (Function == nullptr || (Function->FunctionFlags & k_funcNative) == 0)
+            return nullptr;
+        if (Function->Func != nullptr)
+            return reinterpret_cast<tNative*>(Function->Func);
+        if (Function->iNative > 0 && GNatives != nullptr)
+            return GNatives[Function->iNative];
+        return nullptr;
+    }
+
+    /**
+     * @brief       Calls native @p Function on @p Object by jumping straight into its C++ entry point.
+     * @param[in]   Object - Context object of the call.
+     * @param[in]   Function - Function to call, must be @c FUNC_Native.
+     * @param[in]   Parms - Parameter block laid out like the function's @c *_Parms struct, results are written back into it.
+     * @return      False if @p Function is not a bound native, in which case nothing was called.
+     *
+     * @remarks
+     *   Skips what @c ProcessEvent does around the call: no parameter copies, no script event
+     *   bookkeeping, no virtual dispatch. The function object is only read, so calls to the same
+     *   function may overlap across threads and re-entrant calls. Templated over the object type
+     *   for late binding, see @c LESDK/Common/Misc.hpp.
+     */
+    template<class UObjectLike, class UFunctionLike>
+    bool CallNativeDirect(UObjectLike* const Object, UFunctionLike* const Function, void* const Parms) {
+        tNative* const Thunk = GetNativeThunk(Function);
+        if (Thunk == nullptr)
+            return false;
+
+        FNativeFrame Frame{ Object, Function, Parms };
+        void* const Result = Function->ReturnValueOffset >= 0 && Function->ReturnValueOffset < Function->ParmsSize
+            ? static_cast<BYTE*>(Parms) + Function->ReturnValueOffset
+            : nullptr;
+
+        Thunk(reinterpret_cast<UObject*>(Object), &Frame, Result);
+        return true;
+    }
+
+    /**
+     * @brief       Calls native @p Function on @p Object directly, see @ref CallNativeDirect.
+     * @return      False if @p Function is not a bound native, in which case nothing was called.
+     */
+    bool CallNative(UObject* Object, UFunction* Function, void* Parms);
+
+}
@@ -0,0 +1,201 @@
+/**
+ * @file        LESDK/Common/NativeProfiler.hpp
+ * @brief       This file implements counting and timing every entry of the script VM's GNatives table.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <utility>
+// #include <vector>
+
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/Frame.hpp"
+
+
+namespace LESDK {
+
+    /** Number of entries in @c GNatives, i.e. @c EX_Max. */
+    inline constexpr INT k_numNativeSlots = 0x1000;
+    /** First @c GNatives entry of a native function, entries below are bytecode tokens. */
+    inline constexpr INT k_firstNativeSlot = 0x70;
+
+    /** Counters of one @c GNatives entry, summed over all threads. */
+    struct FNativeSlotStats {
+        INT                         Slot{ 0 };
+        QWORD                       NumCalls{ 0 };
+        /** Time spent in the entry, including entries it called in turn. */
+        std::chrono::nanoseconds    TotalTime{ 0 };
+        /** Time spent in the entry itself. */
+        std::chrono::nanoseconds    SelfTime{ 0 };
+    };
+
+    /**
+     * @brief
+     *   An optional profiler for the script VM, which replaces every entry of @c GNatives with
+     *   a trampoline that counts and times calls to the original entry.
+     *
+     * @remarks
+     *   Every thread running script gets counters of its own on first use, so the hot path
+     *   takes no locks and touches no shared cache lines; @ref Collect sums them up. Nested
+     *   entries, e.g. the argument expressions of a call, are subtracted from self time.
+     *   Trampolines may still be running after @ref Uninstall, so originals are never cleared.
+     *   Not part of @c LESDK/Common/Common.hpp, as its trampoline table is heavy to compile.
+     */
+    class FNativeProfiler final {
+        struct FThreadCounters {
+            std::atomic<QWORD>      NumCalls[k_numNativeSlots]{};
+            std::atomic<QWORD>      TotalNs[k_numNativeSlots]{};
+            std::atomic<QWORD>      SelfNs[k_numNativeSlots]{};
+            /** Time spent in nested entries of the entry running on this thread. */
+            QWORD                   ChildNs{ 0 };
+        };
+
+        static inline tNative*                                      s_originals[k_numNativeSlots]{};
+        static inline std::atomic<tNative**>                        s_natives{ nullptr };
+        static inline std::vector<std::unique_ptr<FThreadCounters>> s_threads{};
+        static inline std::mutex                                    s_mutex{};
+        static inline thread_local FThreadCounters*                 t_counters{ nullptr };
+
+    public:
+
+        FNativeProfiler() = delete;
+
+        /**
+         * @brief       Replaces every non-null entry of @p Natives with a trampoline.
+         * @param[in]   Natives - The table of @c k_numNativeSlots entries, normally @c GNatives.
+         * @return      False if the profiler is installed already.
+         */
+        static bool Install(tNative** const Natives) {
+            std::scoped_lock const Lock{ s_mutex };
+
+            tNative** Expected = nullptr;
+            if (Natives == nullptr || !s_natives.compare_exchange_strong(Expected, Natives, std::memory_order_acq_rel))
+                return false;
+
+            for (INT i = 0; i < k_numNativeSlots; ++i) {
+                if (Natives[i] == nullptr || Natives[i] == k_trampolines[i])
+                    continue;
+                s_originals[i] = Natives[i];
+                Natives[i] = k_trampolines[i];
+            }
+            return true;
+        }
+
+        /** Puts back the original entries, except where someone else replaced a trampoline since. */
+        static void Uninstall() {
+            std::scoped_lock const Lock{ s_mutex };
+
+            tNative** const Natives = s_natives.exchange(nullptr, std::memory_order_acq_rel);
+            if (Natives == nullptr)
+                return;
+
+            for (INT i = 0; i < k_numNativeSlots; ++i) {
+                if (Natives[i] == k_trampolines[i])
+                    Natives[i] = s_originals[i];
+            }
+        }
+
+        static bool IsInstalled() noexcept { return s_natives.load(std::memory_order_acquire) != nullptr; }
+
+        /** Zeroes all counters; calls in flight on other threads may still be counted. */
+        static void Reset() {
+            std::scoped_lock const Lock{ s_mutex };
+            for (auto const& Counters : s_threads) {
+                for (INT i = 0; i < k_numNativeSlots; ++i) {
+                    Counters->NumCalls[i].store(0, std::memory_order_relaxed);
+                    Counters->TotalNs[i].store(0, std::memory_order_relaxed);
+                    Counters->SelfNs[i].store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /** Returns the counters of all entries called so far, by descending self time. */
+        static std::vector<FNativeSlotStats> Collect() {
+            // Summed up in place, a slot per entry is too much for the stack.
+            std::vector<FNativeSlotStats> Stats(k_numNativeSlots);
+            for (INT i = 0; i < k_numNativeSlots; ++i)
+                Stats[i].Slot = i;
+            {
+                std::scoped_lock const Lock{ s_mutex };
+                for (auto const& Counters : s_threads) {
+                    for (INT i = 0; i < k_numNativeSlots; ++i) {
+                        Stats[i].NumCalls += Counters->NumCalls[i].load(std::memory_order_relaxed);
+                        Stats[i].TotalTime += std::chrono::nanoseconds{ Counters->TotalNs[i].load(std::memory_order_relaxed) };
+                        Stats[i].SelfTime += std::chrono::nanoseconds{ Counters->SelfNs[i].load(std::memory_order_relaxed) };
+                    }
+                }
+            }
+            std::erase_if(Stats, [](FNativeSlotStats const& Entry) { return Entry.NumCalls == 0; });
+
+            std::ranges::sort(Stats, [](FNativeSlotStats const& Lhs, FNativeSlotStats const& Rhs) { return Lhs.SelfTime > Rhs.SelfTime; });
+            return Stats;
+        }
+
+        /**
+         * @brief       Writes the @p MaxRows entries with the most self time to @p Stream as a table.
+         * @remarks     Entries below @c k_firstNativeSlot are bytecode tokens, the rest are native functions by @c iNative.
+         */
+        static void Dump(std::FILE* const Stream, size_t const MaxRows = 64) {
+            std::vector<FNativeSlotStats> const Stats = Collect();
+
+            std::fprintf(Stream, "%-8s %-7s %14s %14s %14s\n", "Slot", "Kind", "Calls", "Total (us)", "Self (us)");
+            for (size_t i = 0; i < Stats.size() && i < MaxRows; ++i) {
+                FNativeSlotStats const& Row = Stats[i];
+                std::fprintf(Stream, "0x%-6X %-7s %14llu %14lld %14lld\n",
+                    static_cast<unsigned>(Row.Slot), Row.Slot < k_firstNativeSlot ? "token" : "native",
+                    static_cast<unsigned long long>(Row.NumCalls),
+                    static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(Row.TotalTime).count()),
+                    static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(Row.SelfTime).count()));
+            }
+        }
+
+    private:
+
+        static FThreadCounters& GetThreadCounters() {
+            if (t_counters == nullptr) {
+                auto Counters = std::make_unique<FThreadCounters>();
+                std::scoped_lock const Lock{ s_mutex };
+                t_counters = s_threads.emplace_back(std::move(Counters)).get();
+            }
+            return *t_counters;
+        }
+
+        template<INT Slot>
+        static void Trampoline(UObject* const Context, FFrame* const Stack, void* const Result) {
+            FThreadCounters& Counters = GetThreadCounters();
+            QWORD const OuterChildNs = std::exchange(Counters.ChildNs, 0);
+
+            auto const Start = std::chrono::steady_clock::now();
+            s_originals[Slot](Context, Stack, Result);
+            auto const Elapsed = static_cast<QWORD>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - Start).count());
+
+            // Only this thread writes its counters, so there is no need for atomic read-modify-writes.
+            auto const Add = [](std::atomic<QWORD>& Counter, QWORD const Value) {
+                Counter.store(Counter.load(std::memory_order_relaxed) + Value, std::memory_order_relaxed);
+            };
+            Add(Counters.NumCalls[Slot], 1);
+            Add(Counters.TotalNs[Slot], Elapsed);
+            Add(Counters.SelfNs[Slot], Elapsed - std::min(Elapsed, Counters.ChildNs));
+            Counters.ChildNs = OuterChildNs + Elapsed;
+        }
+
+        template<size_t... Slots>
+        static constexpr std::array<tNative*, k_numNativeSlots> MakeTrampolines(std::index_sequence<Slots...>) noexcept {
+            return { &Trampoline<static_cast<INT>(Slots)>... };
+        }
+
+        static std::array<tNative*, k_numNativeSlots> const k_trampolines;
+    };
+
+    inline std::array<tNative*, k_numNativeSlots> const FNativeProfiler::k_trampolines =
+        FNativeProfiler::MakeTrampolines(std::make_index_sequence<k_numNativeSlots>{});
+
+}
@@ -0,0 +1,238 @@
+/**
+ * @file        LESDK/Common/NativeReplace.hpp
+ * @brief       This file implements replacing the bodies of script functions with C++ implementations.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+// #include <vector>
+
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/Frame.hpp"
+#include "LESDK/Common/FunctionHandle.hpp"
+#include "LESDK/Common/NativeCall.hpp"
+
+
+namespace LESDK {
+
+    /**
+     * @brief
+     *   A @c tNative entry point that calls @p Impl with the arguments of a replaced script function.
+     *   Only one function may be bound to every @p Impl at a time, see @ref TNativeReplacements.
+     *
+     * @remarks
+     *   A native has two kinds of callers. Script calls it with the caller's own frame, positioned
+     *   at the argument expressions, which are evaluated one by one with @c FFrame::Step like the
+     *   engine's @c P_GET_* macros do. @c ProcessEvent and @ref CallNativeDirect call it with a frame
+     *   of its own, whose locals already hold the parameters, which are then read in place.
+     *   Parameter types map like those of @ref TFunctionHandle; out parameters are not supported,
+     *   as script callers only expose their addresses through the engine's @c GPropAddr.
+     */
+    template<auto Impl, class UFunctionLike = UFunction>
+    struct TNativeThunk;
+
+    template<class R, class ContextType, class... Args, R (*Impl)(ContextType*, Args...), class UFunctionLike>
+    struct TNativeThunk<Impl, UFunctionLike> final {
+        static_assert((!Detail::TScriptParm<Args>::bOut && ...), "out parameters are not supported by native replacements");
+
+        using Signature = R(Args...);
+        using Layout = Detail::TScriptParmLayout<R, Args...>;
+        static constexpr Layout k_layout{};
+
+        /** The function currently bound to this thunk. */
+        static inline std::atomic<UFunctionLike*> s_function{ nullptr };
+
+        static void Exec(UObject* const Context, FFrame* const Stack, void* const Result) {
+            Invoke(Context, Stack, Result, std::index_sequence_for<Args...>{});
+        }
+
+    private:
+
+        template<size_t... Indices>
+        static void Invoke(UObject* const Context, FFrame* const Stack, void* const Result, std::index_sequence<Indices...>) {
+            alignas(16) BYTE Evaluated[std::max(k_layout.ParmsSize, 1)]{};
+
+            // Frames made for this function hold its parameters already.
+            bool const bOwnFrame = Stack->Node == reinterpret_cast<UStruct*>(s_function.load(std::memory_order_acquire));
+            BYTE* const Parms = bOwnFrame ? Stack->Locals : Evaluated;
+
+            if (!bOwnFrame) {
+                (Stack->Step(Stack->Object, Evaluated + k_layout.Offsets[Indices]), ...);
+                // Skips EX_EndFunctionParms, like P_FINISH.
+                if (Stack->Code != nullptr)
+                    ++Stack->Code;
+            }
+
+            if constexpr (Layout::k_hasReturn) {
+                using ReturnType = typename Detail::TScriptParm<R>::Type;
+                R ReturnValue = Impl(reinterpret_cast<ContextType*>(Context), Read<Args>(Parms + k_layout.Offsets[Indices])...);
+                if (Result != nullptr)
+                    *static_cast<ReturnType*>(Result) = static_cast<ReturnType>(std::move(ReturnValue));
+            }
+            else {
+                Impl(reinterpret_cast<ContextType*>(Context), Read<Args>(Parms + k_layout.Offsets[Indices])...);
+            }
+
+            // Evaluated arguments are owned here, e.g. strings built by the expressions.
+            if (!bOwnFrame)
+                (Destroy<Args>(Evaluated + k_layout.Offsets[Indices]), ...);
+        }
+
+        template<class T>
+        static decltype(auto) Read(BYTE* const Address) noexcept {
+            using Type = typename Detail::TScriptParm<T>::Type;
+            if constexpr (std::is_same_v<std::remove_cvref_t<T>, bool>)
+                return *reinterpret_cast<UBOOL const*>(Address) != 0;
+            else
+                return static_cast<Type const&>(*reinterpret_cast<Type const*>(Address));
+        }
+
+        template<class T>
+        static void Destroy(BYTE* const Address) noexcept {
+            using Type = typename Detail::TScriptParm<T>::Type;
+            if constexpr (!std::is_trivially_destructible_v<Type>)
+                std::destroy_at(reinterpret_cast<Type*>(Address));
+        }
+    };
+
+
+    /**
+     * @brief
+     *   Replaces the bodies of script functions with C++ implementations, by making them natives
+     *   bound to a thunk, and puts the functions back the way they were when done.
+     *
+     * @remarks
+     *   A replaced function gets @c FUNC_Native and its @c Func pointed at the thunk, so the
+     *   script VM and @c ProcessEvent both call the thunk instead of running the bytecode.
+     *   Functions with an @c iNative index are dispatched through @c GNatives and are refused.
+     *   Everything still replaced is restored when the registry is destroyed, e.g. on unload;
+     *   a function is only restored if its thunk was not replaced again by someone else since.
+     *   Templated over the object type for late binding and testing with synthetic objects.
+     */
+    template<class UObjectLike = UObject, class UFunctionLike = UFunction>
+    class TNativeReplacements final {
+        struct FSaved {
+            UFunctionLike*      Function{ nullptr };
+            DWORD               FunctionFlags{ 0 };
+            void*               Func{ nullptr };
+            void*               Thunk{ nullptr };
+            /** Unbinds a typed thunk on restore, see @ref TNativeThunk. */
+            void              (*Unbind)() { nullptr };
+        };
+
+        std::vector<FSaved>     m_saved{};
+        mutable std::mutex      m_mutex{};
+
+    public:
+
+        TNativeReplacements() = default;
+        TNativeReplacements(TNativeReplacements const&) = delete;
+        TNativeReplacements& operator=(TNativeReplacements const&) = delete;
+
+        ~TNativeReplacements() noexcept {
+            RestoreAll();
+        }
+
+        /**
+         * @brief       Replaces the body of @p Function with a raw native @p Thunk.
+         * @return      False if the function is null, indexed into @c GNatives, or already replaced here.
+         */
+        bool Replace(UFunctionLike* const Function, tNative* const Thunk) {
+            return Replace(Function, Thunk, nullptr);
+        }
+
+        /**
+         * @brief       Replaces the body of @p Function with a call to @p Impl, see @ref TNativeThunk.
+         * @return
+         *   False if the function can't be replaced, its parameters do not match those of @p Impl
+         *   as checked by @ref TFunctionHandle, or @p Impl is bound to a function already.
+         */
+        template<auto Impl>
+        bool Replace(UFunctionLike* const Function) {
+            using Thunk = TNativeThunk<Impl, UFunctionLike>;
+
+            TFunctionHandle<typename Thunk::Signature, UObjectLike, UFunctionLike> Handle{};
+            if (Handle.Bind(Function) != EFunctionBindError::None)
+                return false;
+
+            UFunctionLike* Expected = nullptr;
+            if (!Thunk::s_function.compare_exchange_strong(Expected, Function, std::memory_order_acq_rel))
+                return false;
+
+            auto const Unbind = [] { Thunk::s_function.store(nullptr, std::memory_order_release); };
+            if (!Replace(Function, &Thunk::Exec, +Unbind)) {
+                Unbind();
+                return false;
+            }
+            return true;
+        }
+
+        /** Replaces the body of the function with full name @p Path with a call to @p Impl. */
+        template<auto Impl>
+        bool Replace(wchar_t const* const Path) requires requires { UObjectLike::template FindObject<UFunctionLike>(L""); } {
+            return Replace<Impl>(Path != nullptr ? UObjectLike::template FindObject<UFunctionLike>(Path) : nullptr);
+        }
+
+        /** Restores the original body of @p Function, returning false if it was not replaced here. */
+        bool Restore(UFunctionLike* const Function) {
+            std::scoped_lock const Lock{ m_mutex };
+            auto const Found = std::ranges::find(m_saved, Function, &FSaved::Function);
+            if (Found == m_saved.end())
+                return false;
+            RestoreSaved(*Found);
+            m_saved.erase(Found);
+            return true;
+        }
+
+        /** Restores the original bodies of all functions replaced here. */
+        void RestoreAll() noexcept {
+            std::scoped_lock const Lock{ m_mutex };
+            for (auto Saved = m_saved.rbegin(); Saved != m_saved.rend(); ++Saved)
+                RestoreSaved(*Saved);
+            m_saved.clear();
+        }
+
+        bool IsReplaced(UFunctionLike const* const Function) const {
+            std::scoped_lock const Lock{ m_mutex };
+            return std::ranges::find(m_saved, Function, &FSaved::Function) != m_saved.end();
+        }
+
+        INT Num() const {
+            std::scoped_lock const Lock{ m_mutex };
+            return static_cast<INT>(m_saved.size());
+        }
+
+    private:
+
+        bool Replace(UFunctionLike* const Function, tNative* const Thunk, void (*const Unbind)()) {
+            if (Function == nullptr || Thunk == nullptr || Function->iNative != 0)
+                return false;
+
+            std::scoped_lock const Lock{ m_mutex };
+            if (std::ranges::find(m_saved, Function, &FSaved::Function) != m_saved.end())
+                return false;
+
+            m_saved.push_back(FSaved{ Function, Function->FunctionFlags, Function->Func, reinterpret_cast<void*>(Thunk), Unbind });
+            Function->Func = reinterpret_cast<void*>(Thunk);
+            Function->FunctionFlags |= k_funcNative;
+            return true;
+        }
+
+        static void RestoreSaved(FSaved const& Saved) noexcept {
+            if (Saved.Function->Func == Saved.Thunk) {
+                Saved.Function->FunctionFlags = Saved.FunctionFlags;
+                Saved.Function->Func = Saved.Func;
+            }
+            if (Saved.Unbind != nullptr)
+                Saved.Unbind();
+        }
+    };
+
+}
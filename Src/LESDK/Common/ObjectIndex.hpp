@@ -0,0 +1,674 @@
+/**
+ * @file        LESDK/Common/ObjectIndex.hpp
+ * @brief       This file implements an SDK-maintained hashed index over the global object table.
+ */
+
+#pragma once
+
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+// #include <vector>
+
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/SFXName.hpp"
+#include "LESDK/Common/TArray.hpp"
+
+
+namespace LESDK {
+
+    // ! Case-insensitive name text hashing and matching.
+    // ========================================
+
+    /** Folds ASCII letters to upper case, which matches @c _wcsnicmp in the "C" locale. */
+    constexpr WCHAR FoldNameChar(WCHAR const Char) noexcept {
+        return (Char >= L'a' && Char <= L'z') ? static_cast<WCHAR>(Char - (L'a' - L'A')) : Char;
+    }
+
+    /** Seed for @ref HashNameChar chains (32-bit FNV-1a offset basis). */
+    static constexpr DWORD k_nameHashSeed = 2166136261u;
+
+    /** Continues a case-insensitive 32-bit FNV-1a hash with one character. */
+    constexpr DWORD HashNameChar(DWORD const Hash, WCHAR const Char) noexcept {
+        return (Hash ^ static_cast<DWORD>(FoldNameChar(Char))) * 16777619u;
+    }
+
+    /**
+     * @brief       Formats a non-negative name number into a decimal character buffer.
+     * @return      Number of characters written (at most ten).
+     */
+    inline UINT FormatNameNumber(INT Value, WCHAR (&OutDigits)[12]) noexcept {
+        WCHAR Reversed[12]{};
+        UINT Count = 0;
+        do {
+            Reversed[Count++] = static_cast<WCHAR>(L'0' + (Value % 10));
+            Value /= 10;
+        } while (Value > 0 && Count < 11);
+        for (UINT i = 0; i < Count; ++i) {
+            OutDigits[i] = Reversed[Count - i - 1];
+        }
+        return Count;
+    }
+
+    /**
+     * @brief
+     *   Continues a name hash with the instanced form of @p Name, i.e. the same text that
+     *   @c SFXName::k_formatInstanced would produce ("Name" or "Name_N"), without allocating it.
+     */
+    inline DWORD HashNameInstanced(DWORD Hash, SFXName const Name) noexcept {
+        SFXNameEntry const* const Entry = Name.GetEntry();
+        UINT const Length = static_cast<UINT>(Entry->Index.Length);
+
+        if (!Entry->IsUnicode()) {
+            for (UINT i = 0; i < Length; ++i)
+                Hash = HashNameChar(Hash, static_cast<WCHAR>(static_cast<BYTE>(Entry->AnsiName[i])));
+        } else {
+            for (UINT i = 0; i < Length; ++i)
+                Hash = HashNameChar(Hash, Entry->WideName[i]);
+        }
+
+        if (Name.Number > 0) {
+            WCHAR Digits[12]{};
+            UINT const NumDigits = FormatNameNumber(Name.Number - 1, Digits);
+            Hash = HashNameChar(Hash, L'_');
+            for (UINT i = 0; i < NumDigits; ++i)
+                Hash = HashNameChar(Hash, Digits[i]);
+        }
+
+        return Hash;
+    }
+
+    /**
+     * @brief
+     *   Compares the instanced form of @p Name against a (non-terminated) text span,
+     *   ignoring case. Nothing is formatted or allocated.
+     */
+    inline bool NameMatchesText(SFXName const Name, WCHAR const* const Text, UINT const TextLength) noexcept {
+        SFXNameEntry const* const Entry = Name.GetEntry();
+        UINT const Length = static_cast<UINT>(Entry->Index.Length);
+
+        if (Length > TextLength)
+            return false;
+
+        if (!Entry->IsUnicode()) {
+            for (UINT i = 0; i < Length; ++i) {
+                WCHAR const Char = static_cast<WCHAR>(static_cast<BYTE>(Entry->AnsiName[i]));
+                if (FoldNameChar(Char) != FoldNameChar(Text[i]))
+                    return false;
+            }
+        } else {
+            for (UINT i = 0; i < Length; ++i) {
+                if (FoldNameChar(Entry->WideName[i]) != FoldNameChar(Text[i]))
+                    return false;
+            }
+        }
+
+        if (Name.Number <= 0)
+            return Length == TextLength;
+
+        WCHAR Digits[12]{};
+        UINT const NumDigits = FormatNameNumber(Name.Number - 1, Digits);
+        if (TextLength != Length + 1 + NumDigits || Text[Length] != L'_')
+            return false;
+
+        for (UINT i = 0; i < NumDigits; ++i) {
+            if (Text[Length + 1 + i] != Digits[i])
+                return false;
+        }
+
+        return true;
+    }
+
+
+    // ! Object path parsing.
+    // ========================================
+
+    /**
+     * @brief
+     *   A non-owning view over a single name in an object path, along with
+     *   the names it may resolve to (the split "Name_N" form and the unsplit one).
+     */
+    struct FObjectPathSegment {
+        WCHAR const*    Text{ nullptr };
+        UINT            Length{ 0 };
+        SFXName         Names[2]{};
+        UINT            NumNames{ 0 };
+
+        bool Matches(SFXName const Name) const noexcept {
+            return (NumNames > 0 && Names[0] == Name) || (NumNames > 1 && Names[1] == Name);
+        }
+
+        /**
+         * @brief       Looks the segment text up in the global name table without adding to it.
+         * @return      False if no name with this text exists, i.e. no object may be named like this.
+         */
+        bool Resolve() noexcept {
+            NumNames = 0;
+
+            WCHAR Buffer[1024];
+            if (Length >= std::size(Buffer))
+                return false;
+            std::memcpy(Buffer, Text, Length * sizeof(WCHAR));
+            Buffer[Length] = L'\0';
+
+            for (UBOOL const bSplitName : { TRUE, FALSE }) {
+                // A lookup miss may leave the name untouched, so start from a readable entry.
+                SFXName Name{};
+                *reinterpret_cast<QWORD*>(&Name) = 0;
+                SFXName::GInitMethod(&Name, Buffer, 0, FALSE, bSplitName);
+
+                if (NameMatchesText(Name, Text, Length) && !Matches(Name))
+                    Names[NumNames++] = Name;
+
+                // Only names ending with "_<digits>" can have an unsplit interpretation.
+                if (Length < 2 || Text[Length - 1] < L'0' || Text[Length - 1] > L'9')
+                    break;
+            }
+
+            return NumNames != 0;
+        }
+    };
+
+    /**
+     * @brief
+     *   Non-allocating parser for "Class Package.Outer.Name" object paths,
+     *   i.e. the format produced by @c UObject::GetFullName and consumed by @c UObject::FindObject.
+     */
+    class FObjectPath final {
+    public:
+
+        static constexpr UINT k_maxSegments = 64;
+
+        FObjectPathSegment  ClassName{};
+        FObjectPathSegment  Segments[k_maxSegments]{};
+        UINT                NumSegments{ 0 };
+
+        /** Hash of the class name, see @ref HashNameInstanced. */
+        DWORD               ClassHash{ k_nameHashSeed };
+        /** Hash of the dotted path following the class name. */
+        DWORD               PathHash{ k_nameHashSeed };
+
+        /** Set by @ref ResolveNames, objects may then be matched by comparing 8-byte names. */
+        bool                bNamesResolved{ false };
+
+    public:
+
+        /**
+         * @brief       Splits @p InFullName into its class name and path segments.
+         * @return      False if the string is malformed or nested deeper than @ref k_maxSegments.
+         */
+        bool Parse(WCHAR const* const InFullName) noexcept {
+            NumSegments = 0;
+            ClassName = {};
+            bNamesResolved = false;
+            ClassHash = k_nameHashSeed;
+            PathHash = k_nameHashSeed;
+
+            if (InFullName == nullptr)
+                return false;
+
+            WCHAR const* Cursor = InFullName;
+            while (*Cursor != L'\0' && *Cursor != L' ') {
+                ClassHash = HashNameChar(ClassHash, *Cursor);
+                ++Cursor;
+            }
+
+            if (*Cursor != L' ' || Cursor == InFullName)
+                return false;
+
+            ClassName.Text = InFullName;
+            ClassName.Length = static_cast<UINT>(Cursor - InFullName);
+
+            WCHAR const* SegmentStart = ++Cursor;
+            for (;; ++Cursor) {
+                WCHAR const Char = *Cursor;
+                if (Char != L'.' && Char != L'\0') {
+                    PathHash = HashNameChar(PathHash, Char);
+                    continue;
+                }
+
+                if (Cursor == SegmentStart || NumSegments == k_maxSegments)
+                    return false;
+
+                Segments[NumSegments].Text = SegmentStart;
+                Segments[NumSegments].Length = static_cast<UINT>(Cursor - SegmentStart);
+                ++NumSegments;
+
+                if (Char == L'\0')
+                    break;
+
+                PathHash = HashNameChar(PathHash, Char);
+                SegmentStart = Cursor + 1;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief
+         *   Resolves the parsed class name and segments into @c SFXName values once,
+         *   so that candidates can be matched without touching name text at all.
+         *
+         * @return
+         *   False if some segment names nothing in the global name table, meaning no object
+         *   can have this path. True otherwise, including when @c SFXName::GInitMethod is not
+         *   available, in which case matching keeps comparing text.
+         */
+        bool ResolveNames() noexcept {
+            bNamesResolved = false;
+
+            if (SFXName::GInitMethod == nullptr || SFXName::GBioNamePools == nullptr)
+                return true;
+
+            if (!ClassName.Resolve())
+                return false;
+            for (UINT i = 0; i < NumSegments; ++i) {
+                if (!Segments[i].Resolve())
+                    return false;
+            }
+
+            bNamesResolved = true;
+            return true;
+        }
+    };
+
+    /** Combines a class name hash and a path hash into an index key. */
+    constexpr DWORD CombineObjectKey(DWORD const ClassHash, DWORD const PathHash) noexcept {
+        return PathHash ^ (ClassHash + 0x9E3779B9u + (PathHash << 6) + (PathHash >> 2));
+    }
+
+    /** Continues @p Hash with the dotted path of @p Object ("Package.Outer.Name"). */
+    template<class UObjectLike>
+    DWORD HashObjectPath(DWORD Hash, UObjectLike const* const Object) noexcept {
+        if (Object->Outer != nullptr) {
+            Hash = HashObjectPath(Hash, Object->Outer);
+            Hash = HashNameChar(Hash, L'.');
+        }
+        return HashNameInstanced(Hash, Object->Name);
+    }
+
+    /** Computes the index key of @p Object, i.e. the key its full name parses into. */
+    template<class UObjectLike>
+    DWORD HashObjectKey(UObjectLike const* const Object) noexcept {
+        DWORD const ClassHash = Object->Class != nullptr
+            ? HashNameInstanced(k_nameHashSeed, Object->Class->Name)
+            : k_nameHashSeed;
+        return CombineObjectKey(ClassHash, HashObjectPath(k_nameHashSeed, Object));
+    }
+
+    /** Checks whether the full name of @p Object is @p Path by comparing name text along its outers. */
+    template<class UObjectLike>
+    bool ObjectMatchesPathText(UObjectLike const* const Object, FObjectPath const& Path) noexcept {
+        if (Object->Class == nullptr || !NameMatchesText(Object->Class->Name, Path.ClassName.Text, Path.ClassName.Length))
+            return false;
+
+        UObjectLike const* Current = Object;
+        for (UINT i = Path.NumSegments; i-- > 0; Current = Current->Outer) {
+            if (Current == nullptr)
+                return false;
+            FObjectPathSegment const& Segment = Path.Segments[i];
+            if (!NameMatchesText(Current->Name, Segment.Text, Segment.Length))
+                return false;
+        }
+
+        return Current == nullptr;
+    }
+
+    /** Checks whether the full name of @p Object is @p Path by comparing resolved names along its outers. */
+    template<class UObjectLike>
+    bool ObjectMatchesPathNames(UObjectLike const* const Object, FObjectPath const& Path) noexcept {
+        if (Object->Class == nullptr || !Path.ClassName.Matches(Object->Class->Name))
+            return false;
+
+        UObjectLike const* Current = Object;
+        for (UINT i = Path.NumSegments; i-- > 0; Current = Current->Outer) {
+            if (Current == nullptr || !Path.Segments[i].Matches(Current->Name))
+                return false;
+        }
+
+        return Current == nullptr;
+    }
+
+    /** Checks whether the full name of @p Object is @p Path, preferring resolved names if there are any. */
+    template<class UObjectLike>
+    bool ObjectMatchesPath(UObjectLike const* const Object, FObjectPath const& Path) noexcept {
+        return Path.bNamesResolved
+            ? ObjectMatchesPathNames(Object, Path)
+            : ObjectMatchesPathText(Object, Path);
+    }
+
+
+    // ! Hashed object index.
+    // ========================================
+
+    /**
+     * @brief
+     *   Hashed index over the global object table, keyed on the class name, the outer chain
+     *   and the object name, so that full-name lookups do not format any strings.
+     *
+     * @remarks
+     *   The index is built in one pass over the object table and never owns objects:
+     *   every hit is validated against the live table and the live names before being returned.
+     *   A miss falls back to a linear (still non-formatting) scan whose result is added back.
+     *   Single objects may also be added and removed as they come and go, see @c TObjectTracker.
+     *   While every allocation is reported that way, see @ref SetTracked, paths still missing after
+     *   a scan are remembered along with the table count and the number of objects added so far,
+     *   so repeated misses return at once and, once the table grows, only the slots added since
+     *   the last scan are looked at. Otherwise an object may reappear in any freed slot, so every
+     *   miss scans the whole table like the engine-side lookup does.
+     *   If @c SFXName::GInitMethod is set, queries are resolved into names up front, so paths
+     *   naming nothing return immediately and candidates are compared as 8-byte names.
+     *   Templated over the object type for late binding, see @c LESDK/Common/Misc.hpp.
+     */
+    template<class UObjectLike, class UClassLike>
+    class TObjectIndex final {
+        struct FEntry {
+            UObjectLike*    Object;
+            INT             Slot;
+            DWORD           Key;
+            INT             Next;
+        };
+
+        /** Where the last scan for a missing path stopped. */
+        struct FMiss {
+            DWORD           Key;
+            INT             NumScanned;
+            QWORD           NumAdded;
+        };
+
+        static constexpr size_t k_maxMisses = 4096;
+
+        std::vector<FEntry>         m_entries{};
+        std::vector<INT>            m_heads{};
+        std::vector<INT>            m_slotEntries{};
+        std::unordered_map<QWORD, FMiss> m_misses{};
+        INT                         m_freeList{ -1 };
+        INT                         m_numEntries{ 0 };
+        /** Number of objects reported through @ref Add, which negative results are checked against. */
+        QWORD                       m_numAdded{ 0 };
+        bool                        m_bBuilt{ false };
+        bool                        m_bTracked{ false };
+        mutable std::shared_mutex   m_mutex{};
+
+    public:
+
+        using ObjectTable = TArray<UObjectLike*>;
+
+        /** (Re)builds the whole index in one pass over @p Table. */
+        void Build(ObjectTable const& Table) {
+            std::unique_lock const Lock{ m_mutex };
+            DoBuild(Table);
+        }
+
+        /** Drops all entries, the next lookup rebuilds the index. */
+        void Reset() {
+            std::unique_lock const Lock{ m_mutex };
+            DoReset();
+        }
+
+        /**
+         * @brief
+         *   If set, every allocation is trusted to be reported through @ref Add, so that misses
+         *   may be remembered and only the slots the table grew by are scanned for them again.
+         */
+        void SetTracked(bool const bTracked) {
+            std::unique_lock const Lock{ m_mutex };
+            m_bTracked = bTracked;
+            m_misses.clear();
+        }
+
+        bool IsBuilt() const {
+            std::shared_lock const Lock{ m_mutex };
+            return m_bBuilt;
+        }
+
+        INT Num() const {
+            std::shared_lock const Lock{ m_mutex };
+            return m_numEntries;
+        }
+
+        /**
+         * @brief
+         *   Adds @p Object, found in table slot @p Slot, without building the whole index.
+         *   Lookups of added objects are then served from the hash table even before it is built.
+         *   Any entry previously recorded for the same slot is replaced.
+         */
+        void Add(UObjectLike* const Object, INT const Slot) {
+            if (Object == nullptr || Slot < 0)
+                return;
+            std::unique_lock const Lock{ m_mutex };
+            DoInsert(Object, Slot, HashObjectKey(Object));
+            ++m_numAdded;
+        }
+
+        /**
+         * @brief       Drops the entry recorded for table slot @p Slot.
+         * @param[in]   Object - If not null, the entry is only dropped if it still refers to this object.
+         *                       The object itself is never dereferenced, it may already be freed.
+         */
+        void Remove(INT const Slot, UObjectLike const* const Object = nullptr) {
+            std::unique_lock const Lock{ m_mutex };
+            if (Slot < 0 || Slot >= static_cast<INT>(m_slotEntries.size()))
+                return;
+            INT const Index = m_slotEntries[Slot];
+            if (Index != -1 && (Object == nullptr || m_entries[Index].Object == Object))
+                DoUnlink(Index);
+        }
+
+        /**
+         * @brief       Finds an object by its full name ("Class Package.Outer.Name").
+         * @param[in]   Table - The object table, normally @c UObject::GObjObjects.
+         * @param[in]   FullName - Full name of the object as produced by @c GetFullName.
+         * @param[in]   Filter - If not null, the found object must also be of this class.
+         * @return      The object, or null if no live object has this full name.
+         */
+        UObjectLike* Find(ObjectTable const& Table, WCHAR const* const FullName, UClassLike* const Filter = nullptr) {
+            FObjectPath Path{};
+            if (!Path.Parse(FullName) || !Path.ResolveNames())
+                return nullptr;
+            return Find(Table, Path, Filter);
+        }
+
+        /** @copydoc Find */
+        UObjectLike* Find(ObjectTable const& Table, FObjectPath const& Path, UClassLike* const Filter = nullptr) {
+            DWORD const Key = CombineObjectKey(Path.ClassHash, Path.PathHash);
+            INT const NumObjects = static_cast<INT>(Table.Count());
+
+            QWORD const MissKey = HashMissKey(Path, Filter);
+            INT ScanFrom = 0;
+            QWORD NumAdded = 0;
+            {
+                std::shared_lock const Lock{ m_mutex };
+                if (UObjectLike* const Found = DoFind(Table, Path, Key, Filter))
+                    return Found;
+
+                NumAdded = m_numAdded;
+                auto const Miss = m_misses.find(MissKey);
+                if (m_bBuilt && m_bTracked && Miss != m_misses.end() && Miss->second.Key == Key) {
+                    // Added objects would have been found above, only slots the table grew by are new.
+                    if (Miss->second.NumScanned == NumObjects && Miss->second.NumAdded == NumAdded)
+                        return nullptr;
+                    if (Miss->second.NumScanned <= NumObjects)
+                        ScanFrom = Miss->second.NumScanned;
+                }
+            }
+
+            {
+                std::unique_lock const Lock{ m_mutex };
+                if (!m_bBuilt) {
+                    DoBuild(Table);
+                    NumAdded = m_numAdded;
+                    ScanFrom = 0;
+                    if (UObjectLike* const Found = DoFind(Table, Path, Key, Filter))
+                        return Found;
+                }
+            }
+
+            // Either the object does not exist, or it was created or renamed after the index was built.
+            UObjectLike* const* const Objects = Table.GetData();
+
+            for (INT Slot = ScanFrom; Slot < NumObjects; ++Slot) {
+                UObjectLike* const Object = Objects[Slot];
+                if (Object == nullptr || !ObjectMatchesPath(Object, Path))
+                    continue;
+                if (Filter != nullptr && !Object->IsA(Filter))
+                    continue;
+
+                std::unique_lock const Lock{ m_mutex };
+                DoInsert(Object, Slot, Key);
+                m_misses.erase(MissKey);
+                return Object;
+            }
+
+            std::unique_lock const Lock{ m_mutex };
+            if (!m_bTracked)
+                return nullptr;
+            if (m_misses.size() >= k_maxMisses)
+                m_misses.clear();
+            m_misses.insert_or_assign(MissKey, FMiss{ Key, NumObjects, NumAdded });
+            return nullptr;
+        }
+
+    private:
+
+        /**
+         * @brief
+         *   Hashes @p Path, and the class filter if any, into the key negative results are remembered under.
+         *   Resolved names identify a path exactly, otherwise its text is hashed ignoring case.
+         */
+        static QWORD HashMissKey(FObjectPath const& Path, UClassLike const* const Filter) noexcept {
+            QWORD Hash = 14695981039346656037ull;
+            auto const Mix = [&Hash](QWORD const Value) noexcept {
+                Hash = (Hash ^ Value) * 1099511628211ull;
+            };
+
+            auto const MixSegment = [&](FObjectPathSegment const& Segment) noexcept {
+                if (Path.bNamesResolved) {
+                    for (UINT i = 0; i < Segment.NumNames; ++i)
+                        Mix(*reinterpret_cast<QWORD const*>(&Segment.Names[i]));
+                } else {
+                    for (UINT i = 0; i < Segment.Length; ++i)
+                        Mix(FoldNameChar(Segment.Text[i]));
+                }
+                Mix(Segment.Length);
+            };
+
+            MixSegment(Path.ClassName);
+            for (UINT i = 0; i < Path.NumSegments; ++i)
+                MixSegment(Path.Segments[i]);
+            Mix(Path.NumSegments);
+            // Filters are told apart by address, like the engine's own class checks.
+            Mix(reinterpret_cast<QWORD>(Filter));
+            return Hash;
+        }
+
+        void DoReset() {
+            m_misses.clear();
+            m_entries.clear();
+            m_heads.clear();
+            m_slotEntries.clear();
+            m_freeList = -1;
+            m_numEntries = 0;
+            m_bBuilt = false;
+        }
+
+        void DoBuild(ObjectTable const& Table) {
+            DoReset();
+
+            INT const NumObjects = static_cast<INT>(Table.Count());
+            m_entries.reserve(static_cast<size_t>(NumObjects));
+            DoRehash(static_cast<size_t>(NumObjects));
+
+            UObjectLike* const* const Objects = Table.GetData();
+            for (INT Slot = 0; Slot < NumObjects; ++Slot) {
+                if (UObjectLike* const Object = Objects[Slot]) {
+                    DoInsert(Object, Slot, HashObjectKey(Object));
+                }
+            }
+
+            m_bBuilt = true;
+        }
+
+        void DoRehash(size_t const ExpectedEntries) {
+            size_t NumHeads = 64;
+            while (NumHeads < ExpectedEntries)
+                NumHeads <<= 1;
+
+            m_heads.assign(NumHeads, -1);
+            for (INT i = 0; i < static_cast<INT>(m_entries.size()); ++i) {
+                FEntry& Entry = m_entries[i];
+                if (Entry.Object == nullptr)
+                    continue;
+                INT& Head = m_heads[Entry.Key & (m_heads.size() - 1)];
+                Entry.Next = Head;
+                Head = i;
+            }
+        }
+
+        void DoInsert(UObjectLike* const Object, INT const Slot, DWORD const Key) {
+            // A slot holds one object at a time, a new object in it means the old one is gone.
+            if (Slot >= static_cast<INT>(m_slotEntries.size()))
+                m_slotEntries.resize(static_cast<size_t>(Slot) + 1, -1);
+            if (m_slotEntries[Slot] != -1)
+                DoUnlink(m_slotEntries[Slot]);
+
+            if (static_cast<size_t>(m_numEntries + 1) > m_heads.size())
+                DoRehash(static_cast<size_t>(m_numEntries + 1) * 2);
+
+            INT Index = m_freeList;
+            if (Index != -1) {
+                m_freeList = m_entries[Index].Next;
+            } else {
+                Index = static_cast<INT>(m_entries.size());
+                m_entries.emplace_back();
+            }
+
+            INT& Head = m_heads[Key & (m_heads.size() - 1)];
+            m_entries[Index] = FEntry{ Object, Slot, Key, Head };
+            Head = Index;
+            m_slotEntries[Slot] = Index;
+            ++m_numEntries;
+        }
+
+        void DoUnlink(INT const Index) {
+            FEntry& Entry = m_entries[Index];
+            for (INT* Link = &m_heads[Entry.Key & (m_heads.size() - 1)]; *Link != -1; Link = &m_entries[*Link].Next) {
+                if (*Link == Index) {
+                    *Link = Entry.Next;
+                    break;
+                }
+            }
+
+            m_slotEntries[Entry.Slot] = -1;
+            Entry = FEntry{ nullptr, -1, 0, m_freeList };
+            m_freeList = Index;
+            --m_numEntries;
+        }
+
+        UObjectLike* DoFind(ObjectTable const& Table, FObjectPath const& Path, DWORD const Key, UClassLike* const Filter) const {
+            if (m_heads.empty())
+                return nullptr;
+
+            for (INT i = m_heads[Key & (m_heads.size() - 1)]; i != -1; i = m_entries[i].Next) {
+                FEntry const& Entry = m_entries[i];
+                if (Entry.Key != Key)
+                    continue;
+
+                // Entries may outlive their objects, so only trust what the table still holds.
+                if (Entry.Slot >= static_cast<INT>(Table.Count()) || Table.GetData()[Entry.Slot] != Entry.Object)
+                    continue;
+                if (!ObjectMatchesPath(Entry.Object, Path))
+                    continue;
+                if (Filter != nullptr && !Entry.Object->IsA(Filter))
+                    continue;
+
+                return Entry.Object;
+            }
+
+            return nullptr;
+        }
+    };
+
+}
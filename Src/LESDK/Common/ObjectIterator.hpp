@@ -0,0 +1,351 @@
+/**
+ * @file        LESDK/Common/ObjectIterator.hpp
+ * @brief       This file implements per-class object buckets and typed object iterators over them.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
+// #include <vector>
+
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/TArray.hpp"
+
+
+namespace LESDK {
+
+    // ! Per-class object buckets.
+    // ========================================
+
+    /** An object along with the object table slot it was seen in. */
+    template<class UObjectLike>
+    struct TObjectRef {
+        UObjectLike*    Object;
+        INT             Slot;
+    };
+
+    /**
+     * @brief
+     *   Buckets of live objects grouped by their exact class, so that enumerating the instances
+     *   of a class only visits the buckets of that class and of the classes derived from it.
+     *
+     * @remarks
+     *   Buckets are built in one scan over the object table and then kept in sync incrementally.
+     *   Until allocations are reported, see @ref SetTracked, every query compares the table against
+     *   a shadow copy of it, which is a linear pass over pointers and only touches the buckets of
+     *   slots that changed. Once allocations are fed through @ref Add, normally from the
+     *   @c StaticAllocateObject hook, the table is no longer looked at: only the bucket entries about
+     *   to be returned are validated against it, so objects that went away are dropped as they are met.
+     *   Removal never dereferences the removed object, which may already be freed.
+     *   Templated over the object type for late binding, see @c LESDK/Common/Misc.hpp.
+     */
+    template<class UObjectLike, class UClassLike>
+    class TObjectBuckets final {
+        struct FBucket {
+            UClassLike const*                       Class{ nullptr };
+            std::vector<TObjectRef<UObjectLike>>    Objects{};
+        };
+
+        struct FMatches {
+            DWORD                                   Version{ 0 };
+            std::vector<FBucket*>                   Buckets{};
+        };
+
+        std::unordered_map<UClassLike const*, FBucket>      m_buckets{};
+        std::unordered_map<UClassLike const*, FMatches>     m_matches{};
+        std::vector<UObjectLike*>                           m_shadow{};
+        std::vector<FBucket*>                               m_slotBuckets{};
+        std::vector<INT>                                    m_slotPositions{};
+        DWORD                                               m_version{ 1 };
+        bool                                                m_bTracked{ false };
+        mutable std::mutex                                  m_mutex{};
+
+    public:
+
+        using ObjectTable = TArray<UObjectLike*>;
+
+        /**
+         * @brief
+         *   If set, @ref Collect trusts that every allocation is reported through @ref Add
+         *   and does not compare the table against its shadow copy.
+         */
+        void SetTracked(bool const bTracked) {
+            std::scoped_lock const Lock{ m_mutex };
+            m_bTracked = bTracked;
+        }
+
+        /** Brings all buckets in sync with @p Table in one pass over it, only touching slots that changed. */
+        void Refresh(ObjectTable const& Table) {
+            std::scoped_lock const Lock{ m_mutex };
+            DoRefresh(Table);
+        }
+
+        /** Drops all buckets, the next refresh rebuilds them. */
+        void Reset() {
+            std::scoped_lock const Lock{ m_mutex };
+            m_buckets.clear();
+            m_matches.clear();
+            m_shadow.clear();
+            m_slotBuckets.clear();
+            m_slotPositions.clear();
+            ++m_version;
+        }
+
+        /** Records that @p Object now lives in table slot @p Slot. */
+        void Add(UObjectLike* const Object, INT const Slot) {
+            std::scoped_lock const Lock{ m_mutex };
+            DoRemove(Slot);
+            DoAdd(Object, Slot);
+        }
+
+        /** Records that table slot @p Slot no longer holds an object. */
+        void Remove(INT const Slot) {
+            std::scoped_lock const Lock{ m_mutex };
+            DoRemove(Slot);
+        }
+
+        /** Records that table slot @p Slot no longer holds @p Object, if it was the object recorded for it. */
+        void Remove(INT const Slot, UObjectLike const* const Object) {
+            std::scoped_lock const Lock{ m_mutex };
+            if (Slot >= 0 && Slot < static_cast<INT>(m_shadow.size()) && m_shadow[Slot] == Object)
+                DoRemove(Slot);
+        }
+
+        /** Number of objects whose exact class is @p Class. */
+        INT CountExact(UClassLike const* const Class) const {
+            std::scoped_lock const Lock{ m_mutex };
+            auto const Found = m_buckets.find(Class);
+            return Found != m_buckets.end() ? static_cast<INT>(Found->second.Objects.size()) : 0;
+        }
+
+        /**
+         * @brief       Appends all live objects of @p Class or of a class derived from it to @p OutObjects.
+         * @param[in]   Table - The object table, normally @c UObject::GObjObjects.
+         * @param[in]   Class - Class whose instances are collected.
+         * @param[out]  OutObjects - Receives object references in no particular order.
+         */
+        void Collect(ObjectTable const& Table, UClassLike const* const Class, std::vector<TObjectRef<UObjectLike>>& OutObjects) {
+            if (Class == nullptr)
+                return;
+
+            std::scoped_lock const Lock{ m_mutex };
+            if (!m_bTracked || m_shadow.empty())
+                DoRefresh(Table);
+
+            // A new object may reuse both the slot and the address of an old one, which the shadow
+            // does not tell apart. Validating may re-bucket objects and create buckets, so matches
+            // are looked up afterwards.
+            for (FBucket* const Bucket : FindMatches(Class))
+                DoValidate(Table, *Bucket);
+
+            for (FBucket const* const Bucket : FindMatches(Class))
+                OutObjects.insert(OutObjects.end(), Bucket->Objects.begin(), Bucket->Objects.end());
+        }
+
+    private:
+
+        static bool IsChildOf(UClassLike const* Child, UClassLike const* const Class) noexcept {
+            for (; Child != nullptr; Child = reinterpret_cast<UClassLike const*>(Child->SuperField)) {
+                if (Child == Class)
+                    return true;
+            }
+            return false;
+        }
+
+        std::vector<FBucket*> const& FindMatches(UClassLike const* const Class) {
+            FMatches& Matches = m_matches[Class];
+            if (Matches.Version != m_version) {
+                Matches.Buckets.clear();
+                for (auto& [BucketClass, Bucket] : m_buckets) {
+                    if (IsChildOf(BucketClass, Class))
+                        Matches.Buckets.push_back(&Bucket);
+                }
+                Matches.Version = m_version;
+            }
+            return Matches.Buckets;
+        }
+
+        /** Drops entries of @p Bucket whose object left the table, and moves objects whose slot was reused. */
+        void DoValidate(ObjectTable const& Table, FBucket& Bucket) {
+            INT const NumObjects = static_cast<INT>(Table.Count());
+            UObjectLike* const* const Objects = Table.GetData();
+
+            for (size_t Position = 0; Position < Bucket.Objects.size();) {
+                TObjectRef<UObjectLike> const Ref = Bucket.Objects[Position];
+                UObjectLike* const Live = Ref.Slot < NumObjects ? Objects[Ref.Slot] : nullptr;
+                // Objects in the table are alive, so reading the class of one reusing the address is safe.
+                if (Live == Ref.Object && Live->Class == Bucket.Class) {
+                    ++Position;
+                    continue;
+                }
+
+                // Removal moves the last entry here, which is then checked in turn.
+                DoRemove(Ref.Slot);
+                if (Live != nullptr)
+                    DoAdd(Live, Ref.Slot);
+            }
+        }
+
+        void DoRefresh(ObjectTable const& Table) {
+            INT const NumObjects = static_cast<INT>(Table.Count());
+            INT const NumShadow = static_cast<INT>(m_shadow.size());
+
+            for (INT Slot = NumObjects; Slot < NumShadow; ++Slot)
+                DoRemove(Slot);
+            if (NumObjects > NumShadow)
+                DoReserveSlots(NumObjects);
+
+            UObjectLike* const* const Objects = Table.GetData();
+            for (INT Slot = 0; Slot < NumObjects; ++Slot) {
+                UObjectLike* const Object = Objects[Slot];
+                if (Object == m_shadow[Slot])
+                    continue;
+                DoRemove(Slot);
+                if (Object != nullptr)
+                    DoAdd(Object, Slot);
+            }
+        }
+
+        void DoReserveSlots(INT const NumSlots) {
+            if (static_cast<INT>(m_shadow.size()) >= NumSlots)
+                return;
+            m_shadow.resize(static_cast<size_t>(NumSlots), nullptr);
+            m_slotBuckets.resize(static_cast<size_t>(NumSlots), nullptr);
+            m_slotPositions.resize(static_cast<size_t>(NumSlots), -1);
+        }
+
+        void DoAdd(UObjectLike* const Object, INT const Slot) {
+            if (Object == nullptr || Slot < 0)
+                return;
+            DoReserveSlots(Slot + 1);
+
+            UClassLike const* const Class = Object->Class;
+            auto [Found, bCreated] = m_buckets.try_emplace(Class);
+            FBucket& Bucket = Found->second;
+            if (bCreated) {
+                Bucket.Class = Class;
+                ++m_version;
+            }
+
+            m_shadow[Slot] = Object;
+            m_slotBuckets[Slot] = &Bucket;
+            m_slotPositions[Slot] = static_cast<INT>(Bucket.Objects.size());
+            Bucket.Objects.push_back(TObjectRef<UObjectLike>{ Object, Slot });
+        }
+
+        void DoRemove(INT const Slot) {
+            if (Slot < 0 || Slot >= static_cast<INT>(m_shadow.size()) || m_slotBuckets[Slot] == nullptr)
+                return;
+
+            FBucket& Bucket = *m_slotBuckets[Slot];
+            INT const Position = m_slotPositions[Slot];
+            TObjectRef<UObjectLike> const Last = Bucket.Objects.back();
+
+            Bucket.Objects[Position] = Last;
+            m_slotPositions[Last.Slot] = Position;
+            Bucket.Objects.pop_back();
+
+            m_shadow[Slot] = nullptr;
+            m_slotBuckets[Slot] = nullptr;
+            m_slotPositions[Slot] = -1;
+        }
+    };
+
+
+    // ! Typed object iteration.
+    // ========================================
+
+    /**
+     * @brief
+     *   Iterates over all live objects of class @p T (and classes derived from it),
+     *   in the spirit of UE's @c TObjectIterator.
+     *
+     * @remarks
+     *   Matching objects are snapshotted from per-class buckets on construction, so objects
+     *   created while iterating are not visited and objects destroyed while iterating are skipped.
+     *   Usable either as a cursor or as a range, e.g. `for (ABioPawn* Pawn : TObjectIterator<ABioPawn>{})`.
+     */
+    template<class T, class UObjectLike = UObject, class UClassLike = UClass>
+    class TObjectIterator final {
+        std::vector<TObjectRef<UObjectLike>>    m_objects{};
+        TArray<UObjectLike*> const*             m_table{ nullptr };
+        size_t                                  m_index{ 0 };
+
+    public:
+
+        /** Iterator over the live objects of the snapshot, for range-for. */
+        class FRangeIterator final {
+            TObjectIterator const*  m_owner{ nullptr };
+            size_t                  m_index{ 0 };
+
+        public:
+
+            using iterator_category = std::input_iterator_tag;
+            using value_type = T*;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = T*;
+
+            FRangeIterator() noexcept = default;
+            FRangeIterator(TObjectIterator const* const Owner, size_t const Index) noexcept
+                : m_owner{ Owner }, m_index{ Index } {}
+
+            T* operator*() const noexcept { return reinterpret_cast<T*>(m_owner->m_objects[m_index].Object); }
+
+            FRangeIterator& operator++() noexcept {
+                m_index = m_owner->SkipStale(m_index + 1);
+                return *this;
+            }
+            void operator++(int) noexcept { ++*this; }
+
+            bool operator==(std::default_sentinel_t) const noexcept {
+                return m_index >= m_owner->m_objects.size();
+            }
+        };
+
+        /** Iterates over instances of @c T::StaticClass() in @c UObject::GObjObjects. */
+        TObjectIterator() requires requires { T::StaticClass(); }
+            : TObjectIterator(UObjectLike::GObjBuckets, *UObjectLike::GObjObjects, T::StaticClass()) {}
+
+        /** Iterates over instances of @p Class in @p Table, as bucketed by @p Buckets. */
+        TObjectIterator(TObjectBuckets<UObjectLike, UClassLike>& Buckets, TArray<UObjectLike*> const& Table, UClassLike const* const Class)
+            : m_table{ &Table }
+        {
+            Buckets.Collect(Table, Class, m_objects);
+            m_index = SkipStale(0);
+        }
+
+        explicit operator bool() const noexcept { return m_index < m_objects.size(); }
+
+        TObjectIterator& operator++() noexcept {
+            m_index = SkipStale(m_index + 1);
+            return *this;
+        }
+
+        T* operator*() const noexcept { return reinterpret_cast<T*>(m_objects[m_index].Object); }
+        T* operator->() const noexcept { return reinterpret_cast<T*>(m_objects[m_index].Object); }
+
+        /** Number of objects captured on construction, including those destroyed since. */
+        size_t Num() const noexcept { return m_objects.size(); }
+
+        /** Starts a range over the objects the cursor has not passed yet. */
+        FRangeIterator begin() const noexcept { return FRangeIterator{ this, m_index }; }
+        std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+    private:
+
+        /** Returns the first position from @p Index on whose object is still in the table. */
+        size_t SkipStale(size_t Index) const noexcept {
+            for (; Index < m_objects.size(); ++Index) {
+                TObjectRef<UObjectLike> const& Ref = m_objects[Index];
+                if (Ref.Slot < static_cast<INT>(m_table->Count()) && m_table->GetData()[Ref.Slot] == Ref.Object)
+                    break;
+            }
+            return Index;
+        }
+    };
+
+}
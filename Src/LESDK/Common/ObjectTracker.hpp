@@ -0,0 +1,120 @@
+/**
+ * @file        LESDK/Common/ObjectTracker.hpp
+ * @brief       This file implements incremental maintenance of object lookup structures from allocation events.
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "LESDK/Common/ClassHierarchy.hpp"
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/ObjectIndex.hpp"
+#include "LESDK/Common/ObjectIterator.hpp"
+#include "LESDK/Common/TArray.hpp"
+#include "LESDK/Common/WeakObjectPtr.hpp"
+
+
+namespace LESDK {
+
+    /**
+     * @brief
+     *   Feeds object allocation and destruction events into an object index and object buckets,
+     *   so that both stay current as packages stream in and out without rescanning the table.
+     *   If given slot serial numbers, also clears them so that weak object handles go stale.
+     *   If given a class hierarchy, also invalidates it whenever a class is allocated or destroyed.
+     *
+     * @remarks
+     *   Events normally come from engine hooks, see @c LESDK/ObjectHooks.hpp, but any source works.
+     *   An object allocated into a slot evicts whatever was recorded for that slot before, so even
+     *   without destruction events nothing stale is ever returned: lookups validate against the live
+     *   table anyway, and reused slots are corrected as soon as they are reused.
+     *   Once started, the index remembers misses and buckets rely on allocation events alone,
+     *   neither scans the table for objects in reused slots any more.
+     *   Templated over the object type for late binding, see @c LESDK/Common/Misc.hpp.
+     */
+    template<class UObjectLike, class UClassLike>
+    class TObjectTracker final {
+        TObjectIndex<UObjectLike, UClassLike>&      m_index;
+        TObjectBuckets<UObjectLike, UClassLike>&    m_buckets;
+        FObjectSerials*                             m_serials{ nullptr };
+        TClassHierarchy<UObjectLike, UClassLike>*   m_hierarchy{ nullptr };
+        std::atomic<QWORD>                          m_numAllocated{ 0 };
+        std::atomic<QWORD>                          m_numDestroyed{ 0 };
+
+    public:
+
+        TObjectTracker(TObjectIndex<UObjectLike, UClassLike>& Index, TObjectBuckets<UObjectLike, UClassLike>& Buckets) noexcept
+            : m_index{ Index }, m_buckets{ Buckets } {}
+
+        TObjectTracker(TObjectIndex<UObjectLike, UClassLike>& Index, TObjectBuckets<UObjectLike, UClassLike>& Buckets,
+            FObjectSerials& Serials) noexcept
+            : m_index{ Index }, m_buckets{ Buckets }, m_serials{ &Serials } {}
+
+        TObjectTracker(TObjectIndex<UObjectLike, UClassLike>& Index, TObjectBuckets<UObjectLike, UClassLike>& Buckets,
+            FObjectSerials& Serials, TClassHierarchy<UObjectLike, UClassLike>& Hierarchy) noexcept
+            : m_index{ Index }, m_buckets{ Buckets }, m_serials{ &Serials }, m_hierarchy{ &Hierarchy } {}
+
+        TObjectTracker(TObjectTracker const&) = delete;
+        TObjectTracker& operator=(TObjectTracker const&) = delete;
+
+        /**
+         * @brief       Synchronizes the buckets with @p Table once before allocation events start arriving.
+         * @param[in]   Table - The object table, normally @c UObject::GObjObjects.
+         */
+        void Start(TArray<UObjectLike*> const& Table) {
+            m_buckets.Refresh(Table);
+            m_buckets.SetTracked(true);
+            m_index.SetTracked(true);
+            if (m_serials != nullptr)
+                m_serials->SetTracked(true);
+        }
+
+        /** Stops trusting events, the index and buckets go back to scanning the table and weak handles go stale. */
+        void Stop() {
+            if (m_serials != nullptr)
+                m_serials->SetTracked(false);
+            m_index.SetTracked(false);
+            m_buckets.SetTracked(false);
+        }
+
+        /** Records that @p Object has just been allocated into its table slot. */
+        void OnObjectAllocated(UObjectLike* const Object) {
+            if (Object == nullptr)
+                return;
+            INT const Slot = Object->ObjectInternalInteger;
+            if (m_serials != nullptr)
+                m_serials->Clear(Slot);
+            m_index.Add(Object, Slot);
+            m_buckets.Add(Object, Slot);
+            InvalidateIfClass(Object);
+            m_numAllocated.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /** Records that @p Object is being destroyed, must be called while its fields are still readable. */
+        void OnObjectDestroyed(UObjectLike const* const Object) {
+            if (Object == nullptr)
+                return;
+            INT const Slot = Object->ObjectInternalInteger;
+            if (m_serials != nullptr)
+                m_serials->Clear(Slot);
+            m_index.Remove(Slot, Object);
+            m_buckets.Remove(Slot, Object);
+            InvalidateIfClass(Object);
+            m_numDestroyed.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        QWORD GetNumAllocated() const noexcept { return m_numAllocated.load(std::memory_order_relaxed); }
+        QWORD GetNumDestroyed() const noexcept { return m_numDestroyed.load(std::memory_order_relaxed); }
+
+    private:
+
+        void InvalidateIfClass(UObjectLike const* const Object) noexcept {
+            // Classes are the instances of the one class which is its own class.
+            UClassLike const* const Class = Object->Class;
+            if (m_hierarchy != nullptr && Class != nullptr && reinterpret_cast<UClassLike const*>(Class->Class) == Class)
+                m_hierarchy->Invalidate();
+        }
+    };
+
+}
@@ -104,6 +104,7 @@ private:
 
 static_assert(sizeof(SFXPackedIndex) == 4);
 static_assert(sizeof(SFXName) == 8);
+static_assert(TIsTriviallyRelocatable<SFXName>::value);
 
 
 template<bool WithRAII>
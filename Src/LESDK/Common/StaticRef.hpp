@@ -0,0 +1,146 @@
+/**
+ * @file        LESDK/Common/StaticRef.hpp
+ * @brief       This file implements thread-safe, once-resolved object references used by generated code.
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "LESDK/Common/Core.hpp"
+
+
+namespace LESDK {
+
+    /**
+     * @brief
+     *   A lazily resolved pointer to a named object, e.g. the @c UClass behind a @c StaticClass()
+     *   or the @c UFunction behind a generated script function wrapper.
+     *
+     * @remarks
+     *   Resolved pointers are published with release semantics and read with a single acquire load.
+     *   Concurrent first callers do not each run their own lookup: one of them resolves the object
+     *   while the rest wait for it. A lookup that finds nothing is not cached, the next call after
+     *   it retries, so references to objects from packages loaded later still resolve eventually.
+     *   The constructor is @c constexpr, so references with static storage duration are constant
+     *   initialized and safe to use during dynamic initialization of other translation units.
+     */
+    template<class T>
+    class TStaticRef final {
+    public:
+
+        using ResolverType = T* (*)(wchar_t const*);
+
+    private:
+
+        static constexpr DWORD k_stateEmpty = 0;
+        static constexpr DWORD k_stateResolving = 1;
+        static constexpr DWORD k_stateResolved = 2;
+
+        wchar_t const*              m_name;
+        ResolverType                m_resolver;
+        std::atomic<T*>             m_object{ nullptr };
+        std::atomic<DWORD>          m_state{ k_stateEmpty };
+
+    public:
+
+        /**
+         * @brief       Creates an unresolved reference.
+         * @param[in]   Name - Full name of the object, e.g. @c L"Function Core.Object.GetNetIndex".
+         * @param[in]   Resolver - Lookup run on first use, normally @c UObject::FindObject or @c UObject::FindClass.
+         */
+        constexpr TStaticRef(wchar_t const* const Name, ResolverType const Resolver) noexcept
+            : m_name{ Name }, m_resolver{ Resolver } {}
+
+        TStaticRef(TStaticRef const&) = delete;
+        TStaticRef& operator=(TStaticRef const&) = delete;
+
+        /** Returns the referenced object, resolving it first if this is the first use. */
+        T* Get() {
+            if (T* const Object = m_object.load(std::memory_order_acquire); Object != nullptr)
+                return Object;
+            return Resolve();
+        }
+
+        /** Returns the referenced object if it has already been resolved, without resolving it. */
+        T* GetIfResolved() const noexcept { return m_object.load(std::memory_order_acquire); }
+
+        wchar_t const* GetName() const noexcept { return m_name; }
+
+    private:
+
+        T* Resolve() {
+            bool bWaited = false;
+            for (;;) {
+                DWORD State = m_state.load(std::memory_order_acquire);
+                if (State == k_stateResolved)
+                    return m_object.load(std::memory_order_acquire);
+
+                // Someone else just ran a lookup which found nothing, don't repeat it right away.
+                if (State == k_stateEmpty && bWaited)
+                    return nullptr;
+
+                if (State == k_stateEmpty && m_state.compare_exchange_strong(State, k_stateResolving, std::memory_order_acq_rel)) {
+                    T* const Object = m_resolver(m_name);
+                    if (Object != nullptr)
+                        m_object.store(Object, std::memory_order_release);
+                    m_state.store(Object != nullptr ? k_stateResolved : k_stateEmpty, std::memory_order_release);
+                    m_state.notify_all();
+                    return Object;
+                }
+
+                if (State == k_stateResolving) {
+                    m_state.wait(k_stateResolving, std::memory_order_acquire);
+                    bWaited = true;
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief
+     *   Registration table of the full names behind the static references of one generated
+     *   source file, used by @ref WarmUp to resolve all of them up front.
+     *
+     * @remarks
+     *   Tables link themselves into a global list during dynamic initialization, which is
+     *   single-threaded, so no synchronization is needed. The list head is constant initialized.
+     *   Tables unlink themselves on destruction, so short-lived tables may be registered as well.
+     */
+    class FStaticRefTable final {
+        static inline constinit FStaticRefTable* s_first = nullptr;
+
+        wchar_t const* const*       m_names;
+        INT                         m_numNames;
+        FStaticRefTable*            m_next;
+
+    public:
+
+        template<size_t N>
+        explicit FStaticRefTable(wchar_t const* const (&Names)[N]) noexcept
+            : m_names{ Names }, m_numNames{ static_cast<INT>(N) }, m_next{ s_first }
+        {
+            s_first = this;
+        }
+
+        ~FStaticRefTable() noexcept {
+            for (FStaticRefTable** Link = &s_first; *Link != nullptr; Link = &(*Link)->m_next) {
+                if (*Link == this) {
+                    *Link = m_next;
+                    break;
+                }
+            }
+        }
+
+        FStaticRefTable(FStaticRefTable const&) = delete;
+        FStaticRefTable& operator=(FStaticRefTable const&) = delete;
+
+        /** Returns the most recently registered table, follow @ref GetNext for the rest. */
+        static FStaticRefTable const* GetFirst() noexcept { return s_first; }
+
+        FStaticRefTable const* GetNext() const noexcept { return m_next; }
+        wchar_t const* const* GetNames() const noexcept { return m_names; }
+        INT Num() const noexcept { return m_numNames; }
+    };
+
+}
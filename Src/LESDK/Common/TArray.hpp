@@ -7,6 +7,8 @@
 
 // #include <algorithm>
 // #include <concepts>
+// #include <cstring>
+// #include <functional>
 // #include <initializer_list>
 // #include <memory>
 // #include <span>
@@ -19,7 +21,89 @@
 template<typename T> concept TArrayElement = true;
 
 
-template<TArrayElement T, bool WithRAII>
+/**
+ * @brief   Decides how much a TArray grows, and how its allocations are rounded by the allocator.
+ * @remarks @c Grow returns the new capacity for at least @c Count elements, @c Quantize the number of bytes
+ *          the allocator actually hands out for a request, which growth may fill with elements for free.
+ */
+template<typename T>
+concept TArrayGrowthPolicy = requires (UINT const Count, UINT const Capacity, SIZE_T const Bytes) {
+    { T::Grow(Count, Capacity, Bytes) } -> std::convertible_to<UINT>;
+    { T::Quantize(Bytes) } -> std::convertible_to<SIZE_T>;
+};
+
+/**
+ * @brief   Growth matching the engine's own arrays, @c DefaultCalculateSlack in UE3,
+ *          with about 3/8 slack rounded up to the bucket sizes of its small-block allocator.
+ */
+struct FEngineArrayGrowth final {
+    /** Requests up to this size are served from fixed-size pools, see @c FMallocWindows. */
+    static constexpr SIZE_T k_maxPooledBytes = 32768;
+    static constexpr SIZE_T k_pageBytes = 4096;
+
+    static constexpr SIZE_T k_poolSizes[] = {
+        8, 16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 288, 320, 384, 448, 512, 576, 640, 704, 768,
+        896, 1024, 1168, 1360, 1632, 2048, 2336, 2720, 3264, 4096, 4672, 5456, 6544, 8192, 9360, 10912, 13104,
+        16384, 21840, 32768,
+    };
+
+    static constexpr UINT Grow(UINT const Count, UINT const Capacity, SIZE_T const ElementBytes) noexcept {
+        if (Count <= Capacity)
+            return Capacity;
+
+        SIZE_T const Wanted = static_cast<SIZE_T>(Count) + 3 * static_cast<SIZE_T>(Count) / 8 + 16;
+        SIZE_T const Quantized = Quantize(Wanted * ElementBytes) / ElementBytes;
+        return static_cast<UINT>(std::min<SIZE_T>(Quantized, static_cast<UINT>(-1)));
+    }
+
+    static constexpr SIZE_T Quantize(SIZE_T const Bytes) noexcept {
+        if (Bytes > k_maxPooledBytes)
+            return (Bytes + k_pageBytes - 1) & ~(k_pageBytes - 1);
+        return *std::ranges::lower_bound(k_poolSizes, Bytes);
+    }
+};
+
+/** Growth to the next power of two, as in earlier versions of the SDK. */
+struct FPowerOfTwoArrayGrowth final {
+    static constexpr UINT Grow(UINT const Count, UINT const Capacity, SIZE_T const ElementBytes) noexcept {
+        (void)ElementBytes;
+        UINT NextCapacity = std::max<UINT>(Capacity, Count);
+
+        // https://graphics.stanford.edu/%7Eseander/bithacks.html#RoundUpPowerOf2
+
+        NextCapacity--;
+        NextCapacity |= NextCapacity >> 1;
+        NextCapacity |= NextCapacity >> 2;
+        NextCapacity |= NextCapacity >> 4;
+        NextCapacity |= NextCapacity >> 8;
+        NextCapacity |= NextCapacity >> 16;
+        NextCapacity++;
+
+        return NextCapacity;
+    }
+
+    static constexpr SIZE_T Quantize(SIZE_T const Bytes) noexcept {
+        return Bytes;
+    }
+};
+
+
+/**
+ * @brief   Whether values of @p T may be moved to another address bitwise, skipping their constructors and destructors.
+ * @remarks Holds for trivially copyable types; specialize it for types that only own heap memory, e.g. @c FString.
+ *          Arrays of such types grow through @c sdkRealloc, which lets the allocator grow them in place.
+ */
+template<typename T>
+struct TIsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+template<TArrayElement T, TArrayGrowthPolicy Growth> class TArray;
+template<TArrayElement T, UINT InlineCount> class TInlineArray;
+
+template<TArrayElement T, TArrayGrowthPolicy Growth>
+struct TIsTriviallyRelocatable<TArray<T, Growth>> : std::true_type {};
+
+
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth = FEngineArrayGrowth>
 class TArrayBase {
     CONTAINER_TYPEDEFS(T, UINT, INT)
 
@@ -41,6 +125,8 @@ public:
     template<bool DerivedWithRAII>
     friend class FStringBase;
     friend class FString;
+    template<TArrayElement U, UINT InlineCount>
+    friend class TInlineArray;
 
     TArrayBase() = default;
     TArrayBase(std::initializer_list<value_type> List);
@@ -73,12 +159,27 @@ public:
     reference Insert(size_type Position, value_type&& Value)
         requires (std::movable<value_type>);
 
+    template<typename... ArgTypes>
+    reference Emplace(ArgTypes&&... Args);
+    template<typename... ArgTypes>
+    reference EmplaceAt(size_type Position, ArgTypes&&... Args);
+
     void InsertRange(size_type Position, size_type Count, const_reference Value);
     template<typename InputIt>
     void InsertRange(size_type Position, InputIt First, InputIt Last);
     void InsertRange(size_type Position, std::initializer_list<value_type> List);
 
+    void Append(std::span<value_type const> Values);
+
     void Erase(size_type Position, size_type Count = 1);
+    void RemoveAtSwap(size_type Position, size_type Count = 1);
+
+    template<typename Predicate>
+    size_type RemoveAll(Predicate Pred);
+    template<typename Predicate>
+    size_type RemoveAllSwap(Predicate Pred);
+    template<typename EqualTo = std::equal_to<>>
+    size_type Dedupe(EqualTo Equal = EqualTo{});
 
     reference operator()(size_type Index);
     const_reference operator()(size_type Index) const;
@@ -91,11 +192,12 @@ protected:
     void DoDestroyContents();
     pointer DoEraseUninit(size_type Offset, size_type Count);
     pointer DoInsertUninit(size_type Offset, size_type Count);
+    static void DoRelocate(pointer Destination, pointer Source, size_type Count);
 
     size_type FindNextCapacity(size_type LowestBound);
 
     [[nodiscard]]   static pointer  DoAlloc(size_type Count);
-    [[nodiscard]]   static pointer  DoRealloc(pointer OldData, size_type OldCount, size_type NewCount);
+    [[nodiscard]]   static pointer  DoRealloc(pointer OldData, size_type LiveCount, size_type NewCount);
                     static void     DoFree(pointer Data);
 
 public:  // Standard container compatibility.
@@ -117,56 +219,56 @@ public:  // Standard iterator compatibility.
 };
 
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::~TArrayBase() noexcept {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::~TArrayBase() noexcept {
     if constexpr (WithRAII) {
         DoDestroyContents();
     }
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::TArrayBase(std::initializer_list<value_type> const List)
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::TArrayBase(std::initializer_list<value_type> const List)
     : TArrayBase{}
 {
     InsertRange(0, List);
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::pointer
-TArrayBase<T, WithRAII>::GetData() noexcept {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::pointer
+TArrayBase<T, WithRAII, Growth>::GetData() noexcept {
     return Data;
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::const_pointer
-TArrayBase<T, WithRAII>::GetData() const noexcept {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::const_pointer
+TArrayBase<T, WithRAII, Growth>::GetData() const noexcept {
     return Data;
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::size_type
-TArrayBase<T, WithRAII>::Capacity() const noexcept {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::size_type
+TArrayBase<T, WithRAII, Growth>::Capacity() const noexcept {
     return CountMax;
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::size_type
-TArrayBase<T, WithRAII>::Count() const noexcept {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::size_type
+TArrayBase<T, WithRAII, Growth>::Count() const noexcept {
     return CountItems;
 }
 
-template<TArrayElement T, bool WithRAII>
-bool TArrayBase<T, WithRAII>::Any() const noexcept {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+bool TArrayBase<T, WithRAII, Growth>::Any() const noexcept {
     return CountItems != 0;
 }
 
-template<TArrayElement T, bool WithRAII>
-bool TArrayBase<T, WithRAII>::Empty() const noexcept {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+bool TArrayBase<T, WithRAII, Growth>::Empty() const noexcept {
     return CountItems == 0;
 }
 
-template<TArrayElement T, bool WithRAII>
-void TArrayBase<T, WithRAII>::Clear() {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::Clear() {
     if (CountItems != 0) {
         // Can't use Resize() because it requires a default-constructor.
         DoDestroyRange(0);
@@ -174,24 +276,30 @@ void TArrayBase<T, WithRAII>::Clear() {
     }
 }
 
-template<TArrayElement T, bool WithRAII>
-void TArrayBase<T, WithRAII>::Reserve(size_type const Capacity) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::Reserve(size_type const Capacity) {
     auto const CurrentCapacity = this->Capacity();
     if (Capacity > CurrentCapacity) {
+        // The allocator hands out whole buckets, so whatever it rounds the request up to is usable.
+        SIZE_T const Quantized = Growth::Quantize(static_cast<SIZE_T>(Capacity) * sizeof(value_type)) / sizeof(value_type);
+        auto const NewCapacity = static_cast<size_type>(std::min<SIZE_T>(Quantized, static_cast<size_type>(-1)));
         if (CurrentCapacity == 0) {
-            Data = DoAlloc(Capacity);
+            Data = DoAlloc(NewCapacity);
         } else {
-            Data = DoRealloc(Data, CurrentCapacity, Capacity);
+            Data = DoRealloc(Data, CountItems, NewCapacity);
         }
-        CountMax = Capacity;
+        CountMax = NewCapacity;
     }
 }
 
-template<TArrayElement T, bool WithRAII>
-void TArrayBase<T, WithRAII>::Shrink() {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::Shrink() {
     if (CountItems < CountMax) {
         if (CountItems != 0) {
-            Data = DoRealloc(Data, CountMax, CountItems);
+            // Reallocating within the same allocator bucket would release nothing.
+            if (Growth::Quantize(CountItems * sizeof(value_type)) == Growth::Quantize(CountMax * sizeof(value_type)))
+                return;
+            Data = DoRealloc(Data, CountItems, CountItems);
         } else {
             DoFree(std::exchange(Data, nullptr));
         }
@@ -199,13 +307,13 @@ void TArrayBase<T, WithRAII>::Shrink() {
     }
 }
 
-template<TArrayElement T, bool WithRAII>
-void TArrayBase<T, WithRAII>::Resize(size_type const NewCount) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::Resize(size_type const NewCount) {
     Resize(NewCount, T{});
 }
 
-template<TArrayElement T, bool WithRAII>
-void TArrayBase<T, WithRAII>::Resize(size_type const NewCount, const_reference const Value) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::Resize(size_type const NewCount, const_reference const Value) {
     if (NewCount > CountItems) {
         Reserve(NewCount);
         std::uninitialized_fill(Data + CountItems, Data + NewCount, Value);
@@ -215,93 +323,128 @@ void TArrayBase<T, WithRAII>::Resize(size_type const NewCount, const_reference c
     CountItems = NewCount;
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::reference
-TArrayBase<T, WithRAII>::Add() {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::reference
+TArrayBase<T, WithRAII, Growth>::Add() {
     return Insert(Count(), T{});
 }
 
-template<TArrayElement T, bool WithRAII>
-void TArrayBase<T, WithRAII>::Add(const_reference Value) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::Add(const_reference Value) {
     Insert(Count(), Value);
 }
 
-template<TArrayElement T, bool WithRAII>
-void TArrayBase<T, WithRAII>::Add(value_type&& Value)
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::Add(value_type&& Value)
     requires (std::movable<value_type>)
 {
     Insert(Count(), std::move(Value));
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::size_type
-TArrayBase<T, WithRAII>::AddUninit(size_type const AddedCount) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::size_type
+TArrayBase<T, WithRAII, Growth>::AddUninit(size_type const AddedCount) {
     auto const OrigCount = CountItems;
+    this->Reserve(CountItems + AddedCount);
     CountItems += AddedCount;
-    this->Reserve(CountItems);
     return OrigCount;
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::reference
-TArrayBase<T, WithRAII>::Insert(size_type const Position) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::reference
+TArrayBase<T, WithRAII, Growth>::Insert(size_type const Position) {
     return Insert(Position, T{});
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::reference
-TArrayBase<T, WithRAII>::Insert(size_type const Position, const_reference Value) {
-    LESDK_CHECK(Position <= CountItems, "");
-
-    pointer const Inserted = DoInsertUninit(Position, 1);
-    new (Inserted) T{ Value };
-
-    return *Inserted;
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::reference
+TArrayBase<T, WithRAII, Growth>::Insert(size_type const Position, const_reference Value) {
+    return EmplaceAt(Position, Value);
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::reference
-TArrayBase<T, WithRAII>::Insert(size_type Position, value_type&& Value)
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::reference
+TArrayBase<T, WithRAII, Growth>::Insert(size_type Position, value_type&& Value)
     requires (std::movable<value_type>)
 {
+    return EmplaceAt(Position, std::move(Value));
+}
+
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+template<typename... ArgTypes>
+TArrayBase<T, WithRAII, Growth>::reference
+TArrayBase<T, WithRAII, Growth>::Emplace(ArgTypes&&... Args) {
+    return EmplaceAt(CountItems, std::forward<ArgTypes>(Args)...);
+}
+
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+template<typename... ArgTypes>
+TArrayBase<T, WithRAII, Growth>::reference
+TArrayBase<T, WithRAII, Growth>::EmplaceAt(size_type const Position, ArgTypes&&... Args) {
     LESDK_CHECK(Position <= CountItems, "");
 
-    pointer const Inserted = DoInsertUninit(Position, 1);
-    new (Inserted) T{ std::move(Value) };
+    // Arguments may refer to elements of this array, which are about to move.
+    if (CountItems == CountMax || Position != CountItems) {
+        value_type Value(std::forward<ArgTypes>(Args)...);
+        pointer const Inserted = DoInsertUninit(Position, 1);
+        if constexpr (std::is_move_constructible_v<value_type>) {
+            return *new (Inserted) T(std::move(Value));
+        } else {
+            return *new (Inserted) T(Value);
+        }
+    }
 
-    return *Inserted;
+    pointer const Inserted = DoInsertUninit(Position, 1);
+    return *new (Inserted) T(std::forward<ArgTypes>(Args)...);
 }
 
-template<TArrayElement T, bool WithRAII>
-void TArrayBase<T, WithRAII>::InsertRange(size_type const Position, size_type const Count, const_reference Value) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::InsertRange(size_type const Position, size_type const Count, const_reference Value) {
     LESDK_CHECK(Position <= CountItems, "");
     LESDK_CHECK(Count > 0, "");
 
     pointer const Inserted = DoInsertUninit(Position, Count);
-    std::fill_n(Inserted, Count, Value);
+    std::uninitialized_fill_n(Inserted, Count, Value);
 }
 
-template<TArrayElement T, bool WithRAII>
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
 template<typename InputIt>
-void TArrayBase<T, WithRAII>::InsertRange(size_type const Position, InputIt const First, InputIt const Last) {
+void TArrayBase<T, WithRAII, Growth>::InsertRange(size_type const Position, InputIt const First, InputIt const Last) {
     LESDK_CHECK(Position <= CountItems, "");
     LESDK_CHECK(First <= Last, "");
 
     if (First < Last) {
         auto const Count = static_cast<size_type>(Last - First);
         pointer const Inserted = DoInsertUninit(Position, Count);
-        // TODO: Should we maybe move here if possible?
-        std::copy(First, Last, Inserted);
+        // Elements are copied, or moved if given move iterators, e.g. `std::make_move_iterator`.
+        std::uninitialized_copy(First, Last, Inserted);
     }
 }
 
-template<TArrayElement T, bool WithRAII>
-void TArrayBase<T, WithRAII>::InsertRange(size_type const Position, std::initializer_list<value_type> const List) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::InsertRange(size_type const Position, std::initializer_list<value_type> const List) {
     this->InsertRange(Position, List.begin(), List.end());
 }
 
-template<TArrayElement T, bool WithRAII>
-void TArrayBase<T, WithRAII>::Erase(size_type const Position, size_type const Count) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::Append(std::span<value_type const> const Values) {
+    if (Values.empty())
+        return;
+
+    // Values may be a part of this array, which growing would free.
+    const_pointer Source = Values.data();
+    bool const bAliased = Source >= Data && Source < Data + CountItems;
+    auto const SourceOffset = bAliased ? static_cast<size_type>(Source - Data) : 0;
+
+    auto const Count = static_cast<size_type>(Values.size());
+    pointer const Inserted = DoInsertUninit(CountItems, Count);
+    if (bAliased)
+        Source = Data + SourceOffset;
+    std::uninitialized_copy_n(Source, Count, Inserted);
+}
+
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::Erase(size_type const Position, size_type const Count) {
     LESDK_CHECK(Count > 0, "");
     LESDK_CHECK(Position <= CountItems, "");
     LESDK_CHECK(Position + Count <= CountItems, "");
@@ -310,63 +453,143 @@ void TArrayBase<T, WithRAII>::Erase(size_type const Position, size_type const Co
     DoEraseUninit(Position, Count);
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::reference
-TArrayBase<T, WithRAII>::operator()(size_type const Index) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::RemoveAtSwap(size_type const Position, size_type const Count) {
+    LESDK_CHECK(Count > 0, "");
+    LESDK_CHECK(Position <= CountItems, "");
+    LESDK_CHECK(Position + Count <= CountItems, "");
+
+    // Fills the hole with as many elements from the end as fit, without shifting the rest.
+    DoDestroyRange(Position, Count);
+    auto const MoveCount = std::min<size_type>(Count, CountItems - Position - Count);
+    if (MoveCount != 0) {
+        DoRelocate(Data + Position, Data + CountItems - MoveCount, MoveCount);
+    }
+    CountItems -= Count;
+}
+
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+template<typename Predicate>
+TArrayBase<T, WithRAII, Growth>::size_type
+TArrayBase<T, WithRAII, Growth>::RemoveAll(Predicate Pred) {
+    // Single pass keeping the order, each element is tested once and moved at most once.
+    size_type Kept = 0;
+    for (size_type Index = 0; Index < CountItems; ++Index) {
+        if (Pred(Data[Index])) {
+            std::destroy_at(Data + Index);
+        } else {
+            if (Kept != Index) {
+                DoRelocate(Data + Kept, Data + Index, 1);
+            }
+            ++Kept;
+        }
+    }
+
+    auto const Removed = CountItems - Kept;
+    CountItems = Kept;
+    return Removed;
+}
+
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+template<typename Predicate>
+TArrayBase<T, WithRAII, Growth>::size_type
+TArrayBase<T, WithRAII, Growth>::RemoveAllSwap(Predicate Pred) {
+    // Does not keep the order, but only moves the last element into each hole.
+    auto const OrigCount = CountItems;
+    for (size_type Index = 0; Index < CountItems;) {
+        if (Pred(Data[Index])) {
+            std::destroy_at(Data + Index);
+            if (Index != --CountItems) {
+                DoRelocate(Data + Index, Data + CountItems, 1);
+            }
+        } else {
+            ++Index;
+        }
+    }
+    return OrigCount - CountItems;
+}
+
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+template<typename EqualTo>
+TArrayBase<T, WithRAII, Growth>::size_type
+TArrayBase<T, WithRAII, Growth>::Dedupe(EqualTo Equal) {
+    // Like `std::unique`, for sorted arrays, but destroys the duplicates instead of leaving them moved-from.
+    if (CountItems < 2) {
+        return 0;
+    }
+
+    size_type Kept = 1;
+    for (size_type Index = 1; Index < CountItems; ++Index) {
+        if (Equal(Data[Kept - 1], Data[Index])) {
+            std::destroy_at(Data + Index);
+        } else {
+            if (Kept != Index) {
+                DoRelocate(Data + Kept, Data + Index, 1);
+            }
+            ++Kept;
+        }
+    }
+
+    auto const Removed = CountItems - Kept;
+    CountItems = Kept;
+    return Removed;
+}
+
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::reference
+TArrayBase<T, WithRAII, Growth>::operator()(size_type const Index) {
     LESDK_CHECK(Index < Count(), "");
     return Data[Index];
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::const_reference
-TArrayBase<T, WithRAII>::operator()(size_type const Index) const {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::const_reference
+TArrayBase<T, WithRAII, Growth>::operator()(size_type const Index) const {
     LESDK_CHECK(Index < Count(), "");
     return Data[Index];
 }
 
-template<TArrayElement T, bool WithRAII>
-void TArrayBase<T, WithRAII>::DoDestroyRange(size_type const Offset) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::DoDestroyRange(size_type const Offset) {
     if constexpr (!std::is_trivially_destructible<T>::value) {
         std::destroy(Data + Offset, Data + CountItems);
     }
 }
 
-template<TArrayElement T, bool WithRAII>
-void TArrayBase<T, WithRAII>::DoDestroyRange(size_type const Offset, size_type const Count) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::DoDestroyRange(size_type const Offset, size_type const Count) {
     if constexpr (!std::is_trivially_destructible<T>::value) {
         auto const Bound = std::min<size_type>(Offset + Count, CountItems);
-        for (auto Index = Offset; Index < Bound; ++Index) {
-            (&this->operator(Index))->~T();
+        if (Offset < Bound) {
+            std::destroy(Data + Offset, Data + Bound);
         }
     }
 }
 
-template<TArrayElement T, bool WithRAII>
-void TArrayBase<T, WithRAII>::DoDestroyContents() {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::DoDestroyContents() {
     Clear();
     Shrink();
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::pointer
-TArrayBase<T, WithRAII>::DoEraseUninit(size_type const Offset, size_type const Count) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::pointer
+TArrayBase<T, WithRAII, Growth>::DoEraseUninit(size_type const Offset, size_type const Count) {
     LESDK_CHECK(Count > 0, "");
     LESDK_CHECK(Offset <= CountItems, "");
     LESDK_CHECK(Offset + Count <= CountItems, "");
 
-    if (CountItems >= Offset + Count) {
-        if (CountItems != Offset + Count) {
-            std::move(Data + Offset + Count, Data + Offset + CountItems, Data + Offset);
-        }
-        CountItems -= Count;
+    if (CountItems != Offset + Count) {
+        DoRelocate(Data + Offset, Data + Offset + Count, CountItems - Offset - Count);
     }
+    CountItems -= Count;
 
     return &Data[Offset];
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::pointer
-TArrayBase<T, WithRAII>::DoInsertUninit(size_type const Offset, size_type const Count) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::pointer
+TArrayBase<T, WithRAII, Growth>::DoInsertUninit(size_type const Offset, size_type const Count) {
     LESDK_CHECK(Offset <= CountItems, "");
     LESDK_CHECK(Count > 0, "");
 
@@ -376,94 +599,90 @@ TArrayBase<T, WithRAII>::DoInsertUninit(size_type const Offset, size_type const
         Reserve(NextCountMax);
     }
 
-    // 1. Find number (N) of elements to be shifted right.
-    // 2. Copy N elements from [Data + Offset] to [Data + Offset + Count].
-
     auto const MoveCount = CountItems - Offset;
     if (MoveCount != 0) {
-        auto const MoveBegin = Data + Offset;
-
-        if constexpr (std::movable<value_type>) {
-            if (Count >= MoveCount) {
-                std::move(MoveBegin, MoveBegin + MoveCount, MoveBegin + Count);
-            } else {
-                std::move_backward(MoveBegin, MoveBegin + MoveCount, MoveBegin + Count + MoveCount);
-            }
-        } else {
-            if (Count >= MoveCount) {
-                std::copy(MoveBegin, MoveBegin + MoveCount, MoveBegin + Count);
-            } else {
-                std::copy_backward(MoveBegin, MoveBegin + MoveCount, MoveBegin + Count + MoveCount);
-            }
-        }
+        DoRelocate(Data + Offset + Count, Data + Offset, MoveCount);
     }
 
     CountItems = NewCountItems;
     return Data + Offset;
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::size_type
-TArrayBase<T, WithRAII>::FindNextCapacity(size_type const LowestBound) {
-    size_type NextCountMax = std::max<size_type>(CountMax, LowestBound);
-
-    // https://graphics.stanford.edu/%7Eseander/bithacks.html#RoundUpPowerOf2
-
-    NextCountMax--;
-    NextCountMax |= NextCountMax >> 1;
-    NextCountMax |= NextCountMax >> 2;
-    NextCountMax |= NextCountMax >> 4;
-    NextCountMax |= NextCountMax >> 8;
-    NextCountMax |= NextCountMax >> 16;
-    NextCountMax++;
-
-    return NextCountMax;
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::size_type
+TArrayBase<T, WithRAII, Growth>::FindNextCapacity(size_type const LowestBound) {
+    return Growth::Grow(LowestBound, CountMax, sizeof(value_type));
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::pointer
-TArrayBase<T, WithRAII>::DoAlloc(size_type const Count) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::pointer
+TArrayBase<T, WithRAII, Growth>::DoAlloc(size_type const Count) {
     return sdkMallocTyped<T>(Count, k_defaultAlignment);
 }
 
-template<TArrayElement T, bool WithRAII>
-TArrayBase<T, WithRAII>::pointer
-TArrayBase<T, WithRAII>::DoRealloc(pointer const OldData, size_type const OldCount, size_type const NewCount) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+TArrayBase<T, WithRAII, Growth>::pointer
+TArrayBase<T, WithRAII, Growth>::DoRealloc(pointer const OldData, size_type const LiveCount, size_type const NewCount) {
     LESDK_CHECK(OldData != nullptr, "");
-    LESDK_CHECK(OldCount != 0, "");
     LESDK_CHECK(NewCount != 0, "");
 
+    // Bitwise relocation is all `GMalloc->Realloc` does, which may also grow the block in place.
+    if constexpr (TIsTriviallyRelocatable<value_type>::value) {
+        pointer const Reallocated = sdkReallocTyped<T>(OldData, NewCount, k_defaultAlignment);
+        LESDK_CHECK(Reallocated != nullptr, "");
+        return Reallocated;
+    }
+
     // We cannot use `GMalloc->Realloc` here because copy/move constructors may need to be called.
     pointer const Allocated = sdkMallocTyped<T>(NewCount, k_defaultAlignment);
     LESDK_CHECK(Allocated != nullptr, "");
 
-    auto const MoveCount = std::min<size_type>(OldCount, NewCount);
-    if constexpr (std::movable<value_type>) {
-        std::move(OldData, OldData + MoveCount, Allocated);
-    } else {
-        std::copy(OldData, OldData + MoveCount, Allocated);
-    }
-    std::destroy(OldData, OldData + OldCount);
+    DoRelocate(Allocated, OldData, std::min<size_type>(LiveCount, NewCount));
 
     sdkFreeTyped(OldData);
     return Allocated;
 }
 
-template<TArrayElement T, bool WithRAII>
-void TArrayBase<T, WithRAII>::DoFree(pointer const Data) {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::DoRelocate(pointer const Destination, pointer const Source, size_type const Count) {
+    // Moves elements to uninitialized memory, leaving their old places uninitialized; ranges may overlap.
+    if constexpr (TIsTriviallyRelocatable<value_type>::value) {
+        std::memmove(static_cast<void*>(Destination), static_cast<void const*>(Source), Count * sizeof(value_type));
+    } else {
+        auto const RelocateOne = [](pointer const To, pointer const From) {
+            if constexpr (std::is_move_constructible_v<value_type>) {
+                new (To) T(std::move(*From));
+            } else {
+                new (To) T(*From);
+            }
+            From->~T();
+        };
+
+        if (Destination < Source) {
+            for (size_type Index = 0; Index < Count; ++Index)
+                RelocateOne(Destination + Index, Source + Index);
+        } else if (Destination > Source) {
+            for (size_type Index = Count; Index > 0; --Index)
+                RelocateOne(Destination + Index - 1, Source + Index - 1);
+        }
+    }
+}
+
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+void TArrayBase<T, WithRAII, Growth>::DoFree(pointer const Data) {
     sdkFreeTyped(Data);
 }
 
-template<TArrayElement T, bool WithRAII>
-std::span<typename TArrayBase<T, WithRAII>::value_type>
-TArrayBase<T, WithRAII>::AsSpan() const noexcept {
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
+std::span<typename TArrayBase<T, WithRAII, Growth>::value_type>
+TArrayBase<T, WithRAII, Growth>::AsSpan() const noexcept {
     return std::span<value_type>(Data, Data + Count());
 }
 
-template<TArrayElement T, bool WithRAII>
+template<TArrayElement T, bool WithRAII, TArrayGrowthPolicy Growth>
 template<typename Allocator>
-std::vector<typename TArrayBase<T, WithRAII>::value_type, Allocator>
-TArrayBase<T, WithRAII>::AsVec(Allocator const& Alloc) const noexcept {
+std::vector<typename TArrayBase<T, WithRAII, Growth>::value_type, Allocator>
+TArrayBase<T, WithRAII, Growth>::AsVec(Allocator const& Alloc) const noexcept {
     return std::vector<value_type, Allocator>(Data, Data + Count(), Alloc);
 }
 
@@ -471,16 +690,17 @@ TArrayBase<T, WithRAII>::AsVec(Allocator const& Alloc) const noexcept {
 /**
  * @brief   Dynamic array compatible with Unreal Engine, without RAII semantics.
  * @tparam  T Element type.
+ * @tparam  Growth Growth policy, see @ref TArrayGrowthPolicy.
  */
-template<TArrayElement T>
-class TArrayView final : public TArrayBase<T, false> {
+template<TArrayElement T, TArrayGrowthPolicy Growth = FEngineArrayGrowth>
+class TArrayView final : public TArrayBase<T, false, Growth> {
     CONTAINER_TYPEDEFS(T, UINT, INT)
 
 public:
-    TArrayView() : TArrayBase{} {}
+    TArrayView() : TArrayBase<T, false, Growth>{} {}
 
     // TODO: Remove the constructor, since TArrayView should be constructed via cast from TArray.
-    TArrayView(std::initializer_list<value_type> const List) : TArrayBase{ List } {}
+    TArrayView(std::initializer_list<value_type> const List) : TArrayBase<T, false, Growth>{ List } {}
 
     // Copy semantics on this type make a field-wise copy, without copying the contents,
     // and move semantics are disabled. Make sure to avoid double-free operations if using
@@ -491,7 +711,17 @@ public:
     TArrayView(TArrayView&& Other) = delete;
     TArrayView& operator=(TArrayView&& Other) = delete;
 
-    template<TArrayElement T> friend class TArray;
+    template<TArrayElement U, TArrayGrowthPolicy G> friend class TArray;
+    template<TArrayElement U, UINT InlineCount> friend class TInlineArray;
+
+private:
+
+    // Views memory owned elsewhere; returned as a prvalue, since moves are disabled.
+    TArrayView(pointer const InData, size_type const InCount, size_type const InMax) : TArrayBase<T, false, Growth>{} {
+        this->Data = InData;
+        this->CountItems = InCount;
+        this->CountMax = InMax;
+    }
 };
 
 static_assert(std::is_copy_assignable_v<TArrayView<int>>);
@@ -503,16 +733,17 @@ static_assert(! std::is_move_constructible_v<TArrayView<int>>);
 /**
  * @brief   Dynamic array compatible with Unreal Engine, with RAII semantics.
  * @tparam  T Element type.
+ * @tparam  Growth Growth policy, see @ref TArrayGrowthPolicy.
  */
-template<TArrayElement T>
-class TArray final : public TArrayBase<T, true> {
+template<TArrayElement T, TArrayGrowthPolicy Growth = FEngineArrayGrowth>
+class TArray final : public TArrayBase<T, true, Growth> {
     CONTAINER_TYPEDEFS(T, UINT, INT)
 
 public:
-    TArray() : TArrayBase{} {}
+    TArray() : TArrayBase<T, true, Growth>{} {}
     explicit TArray(size_type Capacity);
     TArray(size_type Count, const_reference Value);
-    TArray(std::initializer_list<value_type> const List) : TArrayBase{ List } {}
+    TArray(std::initializer_list<value_type> const List) : TArrayBase<T, true, Growth>{ List } {}
 
     ~TArray() noexcept {}
 
@@ -526,7 +757,7 @@ public:
     // We need to be able to seamlessly get TArrayView from TArray.
     // Until the new container types are tested, I would like to avoid implicit casting.
 
-    TArrayView<T> AsView() noexcept;
+    TArrayView<T, Growth> AsView() noexcept;
 };
 
 static_assert(std::is_copy_assignable_v<TArray<int>>);
@@ -534,30 +765,30 @@ static_assert(std::is_copy_constructible_v<TArray<int>>);
 static_assert(std::is_move_assignable_v<TArray<int>>);
 static_assert(std::is_move_constructible_v<TArray<int>>);
 
-template<TArrayElement T>
-TArray<T>::TArray(size_type const Capacity)
-    : TArrayBase{}
+template<TArrayElement T, TArrayGrowthPolicy Growth>
+TArray<T, Growth>::TArray(size_type const Capacity)
+    : TArrayBase<T, true, Growth>{}
 {
     this->Reserve(Capacity);
 }
 
-template<TArrayElement T>
-TArray<T>::TArray(size_type const Count, const_reference Value)
-    : TArrayBase{}
+template<TArrayElement T, TArrayGrowthPolicy Growth>
+TArray<T, Growth>::TArray(size_type const Count, const_reference Value)
+    : TArrayBase<T, true, Growth>{}
 {
     this->InsertRange(0, Count, Value);
 }
 
-template<TArrayElement T>
-TArray<T>::TArray(TArray const& Other)
+template<TArrayElement T, TArrayGrowthPolicy Growth>
+TArray<T, Growth>::TArray(TArray const& Other)
     : TArray{}
 {
     // This relies on InsertRange always copying elements...
     this->InsertRange(0, Other.begin(), Other.end());
 }
 
-template<TArrayElement T>
-TArray<T>& TArray<T>::operator=(TArray const& Other) {
+template<TArrayElement T, TArrayGrowthPolicy Growth>
+TArray<T, Growth>& TArray<T, Growth>::operator=(TArray const& Other) {
     if (this != &Other) {
         this->DoDestroyContents();
         this->InsertRange(0, Other.begin(), Other.end());
@@ -565,8 +796,8 @@ TArray<T>& TArray<T>::operator=(TArray const& Other) {
     return *this;
 }
 
-template<TArrayElement T>
-TArray<T>::TArray(TArray&& Other) noexcept
+template<TArrayElement T, TArrayGrowthPolicy Growth>
+TArray<T, Growth>::TArray(TArray&& Other) noexcept
     : TArray{}
 {
     this->Data = std::exchange(Other.Data, nullptr);
@@ -574,8 +805,8 @@ TArray<T>::TArray(TArray&& Other) noexcept
     this->CountMax = std::exchange(Other.CountMax, 0);
 }
 
-template<TArrayElement T>
-TArray<T>& TArray<T>::operator=(TArray&& Other) noexcept {
+template<TArrayElement T, TArrayGrowthPolicy Growth>
+TArray<T, Growth>& TArray<T, Growth>::operator=(TArray&& Other) noexcept {
     if (this != &Other) {
         this->DoDestroyContents();
         this->Data = std::exchange(Other.Data, nullptr);
@@ -585,10 +816,10 @@ TArray<T>& TArray<T>::operator=(TArray&& Other) noexcept {
     return *this;
 }
 
-template<TArrayElement T>
-TArrayView<T> TArray<T>::AsView() noexcept
+template<TArrayElement T, TArrayGrowthPolicy Growth>
+TArrayView<T, Growth> TArray<T, Growth>::AsView() noexcept
 {
-    TArrayView<T> View{};
+    TArrayView<T, Growth> View{};
     View.Data = this->Data;
     View.CountItems = this->CountItems;
     View.CountMax = this->CountMax;
@@ -0,0 +1,84 @@
+/**
+ * @file        LESDK/Common/WarmUp.hpp
+ * @brief       This file implements eager resolution of the objects referenced by generated code.
+ */
+
+#pragma once
+
+#include <span>
+#include <string_view>
+#include <unordered_set>
+// #include <vector>
+
+#include "LESDK/Common/BatchFind.hpp"
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/ObjectIndex.hpp"
+#include "LESDK/Common/StaticRef.hpp"
+#include "LESDK/Common/TArray.hpp"
+
+
+namespace LESDK {
+
+    /** Outcome of a warm-up pass. */
+    struct FWarmUpResult {
+        /** Number of distinct full names that were looked for. */
+        INT                         NumRequested{ 0 };
+        /** Number of those names that were found in the object table. */
+        INT                         NumResolved{ 0 };
+        /** Full names that matched no live object, e.g. because their package is not loaded yet. */
+        std::vector<WCHAR const*>   Missing{};
+    };
+
+    /**
+     * @brief       Finds all objects named in @p FullNames in a single pass over @p Table and adds them to @p Index.
+     * @param[in]   Table - The object table, normally @c UObject::GObjObjects.
+     * @param[in]   Index - Index primed with every object found, normally @c UObject::GObjIndex.
+     * @param[in]   FullNames - Full names as passed to @c UObject::FindObject, duplicates are allowed.
+     * @param[in]   NumThreads - Number of threads to split the pass across, see @ref FindObjectsBatch.
+     * @return      Counts of requested and resolved names, and the names that were not found.
+     *
+     * @remarks
+     *   The pass itself is @ref FindObjectsBatch over the distinct names. Templated over the object
+     *   type for late binding.
+     */
+    template<class UObjectLike, class UClassLike>
+    FWarmUpResult WarmUpObjects(TArray<UObjectLike*> const& Table, TObjectIndex<UObjectLike, UClassLike>& Index,
+        std::span<WCHAR const* const> const FullNames, INT const NumThreads = 1)
+    {
+        FWarmUpResult Result{};
+        std::vector<WCHAR const*> Wanted{};
+        std::unordered_set<std::wstring_view> Seen{};
+
+        Wanted.reserve(FullNames.size());
+        Seen.reserve(FullNames.size());
+
+        for (WCHAR const* const FullName : FullNames) {
+            if (FullName != nullptr && Seen.insert(FullName).second)
+                Wanted.push_back(FullName);
+        }
+
+        std::vector<UObjectLike*> Found(Wanted.size(), nullptr);
+        Result.NumRequested = static_cast<INT>(Wanted.size());
+        Result.NumResolved = FindObjectsBatch(Table, std::span<WCHAR const* const>{ Wanted }, std::span{ Found }, NumThreads);
+
+        for (size_t i = 0; i < Wanted.size(); ++i) {
+            if (Found[i] != nullptr)
+                Index.Add(Found[i], Found[i]->ObjectInternalInteger);
+            else
+                Result.Missing.push_back(Wanted[i]);
+        }
+
+        return Result;
+    }
+
+    /**
+     * @brief
+     *   Resolves every object registered through an @ref FStaticRefTable in one pass over
+     *   @c UObject::GObjObjects, so that first calls into generated wrappers do not have to
+     *   search for their @c UClass or @c UFunction. Meant to be called from a loading screen.
+     * @param[in]   NumThreads - Number of threads to split the pass across, see @ref FindObjectsBatch.
+     * @return      Counts of requested and resolved names, and the names that were not found.
+     */
+    FWarmUpResult WarmUp(INT NumThreads = 1);
+
+}
@@ -0,0 +1,225 @@
+/**
+ * @file        LESDK/Common/WeakObjectPtr.hpp
+ * @brief       This file implements weak object handles validated by object table slot and serial number.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <type_traits>
+
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/TArray.hpp"
+
+
+namespace LESDK {
+
+    // ! Per-slot serial numbers.
+    // ========================================
+
+    /**
+     * @brief
+     *   SDK-maintained serial numbers of object table slots. A slot gets a serial number the first
+     *   time a weak handle is made to its object, and loses it when that object goes away.
+     *
+     * @remarks
+     *   Serial numbers are cleared from object allocation and destruction events, see
+     *   @c LESDK/Common/ObjectTracker.hpp. Without those events a reused slot, often at the same
+     *   address, would keep its serial number, so none is handed out until @ref SetTracked is set.
+     *   Storage is allocated in fixed chunks which never move, so reads are lock-free.
+     */
+    class FObjectSerials final {
+    public:
+
+        static constexpr INT k_chunkSize = 1024 * 64;
+        static constexpr INT k_maxChunks = 512;
+
+    private:
+
+        using ChunkType = std::atomic<INT>;
+
+        std::atomic<ChunkType*>     m_chunks[k_maxChunks]{};
+        std::atomic<INT>            m_lastSerial{ 0 };
+        std::atomic<bool>           m_bTracked{ false };
+
+    public:
+
+        constexpr FObjectSerials() noexcept = default;
+
+        ~FObjectSerials() noexcept {
+            for (auto& Chunk : m_chunks)
+                delete[] Chunk.load(std::memory_order_relaxed);
+        }
+
+        FObjectSerials(FObjectSerials const&) = delete;
+        FObjectSerials& operator=(FObjectSerials const&) = delete;
+
+        /**
+         * @brief
+         *   Sets whether slot reuse is reported through @ref Clear. Serial numbers handed out before
+         *   are dropped either way, as slots may have been reused while nothing was reported.
+         */
+        void SetTracked(bool const bTracked) noexcept {
+            m_bTracked.store(false, std::memory_order_release);
+            for (auto& Entry : m_chunks) {
+                if (ChunkType* const Chunk = Entry.load(std::memory_order_acquire)) {
+                    for (INT i = 0; i < k_chunkSize; ++i)
+                        Chunk[i].store(0, std::memory_order_relaxed);
+                }
+            }
+            m_bTracked.store(bTracked, std::memory_order_release);
+        }
+
+        bool IsTracked() const noexcept { return m_bTracked.load(std::memory_order_acquire); }
+
+        /** Returns the serial number of @p Slot, or zero if it has none or slot reuse is not reported. */
+        INT Get(INT const Slot) const noexcept {
+            if (!IsTracked())
+                return 0;
+            ChunkType const* const Chunk = FindChunk(Slot);
+            return Chunk != nullptr ? Chunk[Slot % k_chunkSize].load(std::memory_order_acquire) : 0;
+        }
+
+        /** Returns the serial number of @p Slot, assigning a new one if it has none, or zero if slot reuse is not reported. */
+        INT Acquire(INT const Slot) {
+            if (!IsTracked())
+                return 0;
+            ChunkType* const Chunk = FindOrAddChunk(Slot);
+            if (Chunk == nullptr)
+                return 0;
+
+            ChunkType& Serial = Chunk[Slot % k_chunkSize];
+            INT Current = Serial.load(std::memory_order_acquire);
+            if (Current != 0)
+                return Current;
+
+            INT const Next = NextSerial();
+            return Serial.compare_exchange_strong(Current, Next, std::memory_order_acq_rel) ? Next : Current;
+        }
+
+        /** Clears the serial number of @p Slot, invalidating all handles made to it so far. */
+        void Clear(INT const Slot) noexcept {
+            if (ChunkType* const Chunk = FindChunk(Slot))
+                Chunk[Slot % k_chunkSize].store(0, std::memory_order_release);
+        }
+
+    private:
+
+        ChunkType* FindChunk(INT const Slot) const noexcept {
+            if (Slot < 0 || Slot / k_chunkSize >= k_maxChunks)
+                return nullptr;
+            return m_chunks[Slot / k_chunkSize].load(std::memory_order_acquire);
+        }
+
+        ChunkType* FindOrAddChunk(INT const Slot) {
+            if (Slot < 0 || Slot / k_chunkSize >= k_maxChunks)
+                return nullptr;
+
+            std::atomic<ChunkType*>& Entry = m_chunks[Slot / k_chunkSize];
+            ChunkType* Chunk = Entry.load(std::memory_order_acquire);
+            if (Chunk != nullptr)
+                return Chunk;
+
+            ChunkType* const Created = new ChunkType[k_chunkSize]{};
+            if (Entry.compare_exchange_strong(Chunk, Created, std::memory_order_acq_rel))
+                return Created;
+            delete[] Created;
+            return Chunk;
+        }
+
+        INT NextSerial() noexcept {
+            // Zero means "no serial", skip it when the counter wraps around.
+            for (;;) {
+                INT const Serial = m_lastSerial.fetch_add(1, std::memory_order_relaxed) + 1;
+                if (Serial != 0)
+                    return Serial;
+            }
+        }
+    };
+
+
+    // ! Weak object handles.
+    // ========================================
+
+    /**
+     * @brief
+     *   A weak reference to an object of class @p T, in the spirit of UE's @c TWeakObjectPtr.
+     *   Stores the object's table slot, the slot's serial number and the object's address, so
+     *   resolving it is a bounds check and two comparisons, without rescanning the object table.
+     *
+     * @remarks
+     *   Handles can only be made while allocations are tracked, see @ref FObjectSerials::SetTracked,
+     *   otherwise they are left unset. A handle never resolves to another object reusing its slot,
+     *   whatever its address or class, and all handles go stale when tracking stops.
+     *   Handles are trivially copyable and hashable, so they may key SDK containers.
+     */
+    template<class T, class UObjectLike = UObject>
+    class TWeakObjectPtr final {
+        UObjectLike const*  m_object{ nullptr };
+        INT                 m_slot{ -1 };
+        INT                 m_serial{ 0 };
+
+    public:
+
+        constexpr TWeakObjectPtr() noexcept = default;
+
+        /** Makes a handle to @p Object using @c UObject::GObjSerials. */
+        TWeakObjectPtr(T* const Object) requires requires { UObjectLike::GObjSerials; }
+            : TWeakObjectPtr(Object, UObjectLike::GObjSerials) {}
+
+        /** Makes a handle to @p Object using @p Serials. */
+        TWeakObjectPtr(T* const Object, FObjectSerials& Serials) {
+            if (Object == nullptr)
+                return;
+            auto const* const AsObject = reinterpret_cast<UObjectLike const*>(Object);
+            INT const Slot = AsObject->ObjectInternalInteger;
+            INT const Serial = Serials.Acquire(Slot);
+            if (Serial != 0) {
+                m_object = AsObject;
+                m_slot = Slot;
+                m_serial = Serial;
+            }
+        }
+
+        /** Returns the object if it is still alive, otherwise null. */
+        T* Get() const noexcept requires requires { UObjectLike::GObjObjects; UObjectLike::GObjSerials; } {
+            return UObjectLike::GObjObjects != nullptr ? Get(*UObjectLike::GObjObjects, UObjectLike::GObjSerials) : nullptr;
+        }
+
+        /** Returns the object if it is still alive in @p Table, otherwise null. */
+        T* Get(TArray<UObjectLike*> const& Table, FObjectSerials const& Serials) const noexcept {
+            if (m_serial == 0 || static_cast<UINT>(m_slot) >= Table.Count() || Serials.Get(m_slot) != m_serial)
+                return nullptr;
+            UObjectLike* const Object = Table.GetData()[m_slot];
+            return Object == m_object ? reinterpret_cast<T*>(Object) : nullptr;
+        }
+
+        bool IsValid() const noexcept requires requires { UObjectLike::GObjObjects; UObjectLike::GObjSerials; } {
+            return Get() != nullptr;
+        }
+
+        /** Checks whether this handle was ever made to an object, regardless of whether it is still alive. */
+        bool IsSet() const noexcept { return m_serial != 0; }
+
+        void Reset() noexcept { *this = TWeakObjectPtr{}; }
+
+        INT GetSlot() const noexcept { return m_slot; }
+        INT GetSerial() const noexcept { return m_serial; }
+
+        std::size_t GetHash() const noexcept {
+            return std::hash<QWORD>{}((static_cast<QWORD>(static_cast<DWORD>(m_serial)) << 32) | static_cast<DWORD>(m_slot));
+        }
+
+        friend bool operator==(TWeakObjectPtr const&, TWeakObjectPtr const&) noexcept = default;
+    };
+
+}
+
+
+template<class T, class UObjectLike>
+struct std::hash<::LESDK::TWeakObjectPtr<T, UObjectLike>> {
+    std::size_t operator()(::LESDK::TWeakObjectPtr<T, UObjectLike> const& Handle) const noexcept {
+        return Handle.GetHash();
+    }
+};
@@ -69,6 +69,14 @@ namespace LESDK {
         OwnerName = Name;
     }
 
+    Initializer::Initializer(ISharedProxyInterface* const SPI, char const* const Name, void* const InModuleBase) {
+        LESDK_CHECK(SPI != nullptr, "");
+        LESDK_CHECK(Name != nullptr, "");
+        ModuleBase = InModuleBase;
+        ProxyInstance = SPI;
+        OwnerName = Name;
+    }
+
     void* Initializer::Resolve(Address const InAddr) const {
         void* OutAddr = nullptr;
         SPIReturn SpiReturn = SPIReturn::Success;
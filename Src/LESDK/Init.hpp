@@ -87,6 +87,8 @@ namespace LESDK {
     public:
 
         explicit Initializer(ISharedProxyInterface* SPI, char const* Name);
+        /** Constructs an @ref Initializer for an explicitly given module, e.g. when not running inside the game. */
+        Initializer(ISharedProxyInterface* SPI, char const* Name, void* InModuleBase);
 
         void* Resolve(Address InAddr) const;
         void* InstallHook(char const* Name, void* Target, void* Detour);
@@ -78,7 +78,7 @@ public:
 	TArray<class UAnimTree*>                           lst30;                                            		// 0x0240 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
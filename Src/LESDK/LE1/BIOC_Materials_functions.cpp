@@ -28,18 +28,30 @@
 
 
 
-class UClass* UBioGlobalResources::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioGlobalResources::pClassPointer { L"Class BIOC_Materials.BioGlobalResources", &UObject::FindClass };
 
 class UClass* UBioGlobalResources::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class BIOC_Materials.BioGlobalResources" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class BIOC_Materials.BioGlobalResources",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
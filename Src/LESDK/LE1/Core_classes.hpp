@@ -181,10 +181,14 @@ public:
     class UObject*                  ObjectArchetype;                    // 0x0058 (0x08) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
     static class TArray<class UObject*>* GObjObjects;
+    static ::LESDK::TObjectIndex<UObject, UClass> GObjIndex;
+    static ::LESDK::TClassHierarchy<UObject, UClass> GClassHierarchy;
+    static ::LESDK::TObjectBuckets<UObject, UClass> GObjBuckets;
+    static ::LESDK::FObjectSerials GObjSerials;
 
     void AppendName(FStringView& OutString, SFXName::FormatMode Mode) const;
     void AppendName(FString& OutString, SFXName::FormatMode Mode) const;
@@ -205,14 +209,10 @@ public:
     FString const& StaticFullName() const;
 
     template<class T> static T* FindObject (wchar_t const* const ObjectFullName) {
-        for ( int i = 0; i < (int)UObject::GObjObjects->Count(); ++i ) {
-            UObject* Object = UObject::GObjObjects->GetData()[ i ];
-            if ( ! Object || ! Object->IsA ( T::StaticClass() ) )
-                continue;
-            if ( Object->StaticFullName().Equals ( ObjectFullName, true ) )
-                return (T*) Object;
-        } 
-        return NULL;
+        UClass* const pClass = T::StaticClass();
+        if ( ! pClass )
+            return NULL;
+        return (T*) UObject::GObjIndex.Find ( *UObject::GObjObjects, ObjectFullName, pClass );
     }
 
     static class UClass* FindClass (wchar_t const* ClassFullName);
@@ -635,7 +635,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x2C ];                            		// 0x0060 (0x002C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -650,7 +650,7 @@ public:
 	FPointer                                           VfTable_FExec;                                    		// 0x0060 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -683,7 +683,7 @@ public:
 	FString                                            TextureFileCacheExtension;                        		// 0x014C (0x0010) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -698,7 +698,7 @@ public:
 	unsigned char                                      UnknownData00[ 0xA0 ];                            		// 0x0060 (0x00A0) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -713,7 +713,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x10 ];                            		// 0x0060 (0x0010) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -728,7 +728,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0060 (0x0008) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -743,7 +743,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x48 ];                            		// 0x0060 (0x0048) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -772,7 +772,7 @@ public:
     */
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -787,7 +787,7 @@ public:
 	unsigned char                                      UnknownData00[ 0xF0 ];                            		// 0x01AC (0x00F0) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -802,7 +802,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x5FC ];                           		// 0x01AC (0x05FC) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -816,7 +816,7 @@ class UInterface : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -832,7 +832,7 @@ public:
     class UField*                   Next;                               // 0x0068 (0x08) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -858,7 +858,7 @@ public:
     class TArray<class UObject>     ScriptObjectReferences;             // 0x00C8 (0x10) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -874,7 +874,7 @@ public:
     int                             StructFlags;                        // 0x00E8 (0x04) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -899,7 +899,7 @@ public:
     void*                           Func;                               // 0x00F8 (0x08) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -928,7 +928,7 @@ public:
     class UProperty*                TransientPropertyLinkNext;          // 0x00C8 (0x08) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -943,7 +943,7 @@ public:
     class UStruct*                  Struct;                             // 0x00D0 (0x08) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -957,7 +957,7 @@ class UStringRefProperty : public UProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -971,7 +971,7 @@ class UStrProperty : public UProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -986,7 +986,7 @@ public:
     class UClass*                   PropertyClass;                      // 0x00D0 (0x08) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1000,7 +1000,7 @@ class UComponentProperty : public UObjectProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1015,7 +1015,7 @@ public:
     class UClass*                   MetaClass;                          // 0x00D8 (0x08) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1029,7 +1029,7 @@ class UNameProperty : public UProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1045,7 +1045,7 @@ public:
     class UProperty*                Value;                              // 0x00D8 (0x08) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1060,7 +1060,7 @@ public:
     class UClass*                   InterfaceClass;                     // 0x00D0 (0x08) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1074,7 +1074,7 @@ class UIntProperty : public UProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1088,7 +1088,7 @@ class UFloatProperty : public UProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1104,7 +1104,7 @@ public:
     class UFunction*                SourceDelegate;                     // 0x00D8 (0x08) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1119,7 +1119,7 @@ public:
     class UEnum*                    Enum;                               // 0x00D0 (0x08) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1135,7 +1135,7 @@ public:
     DWORD                           Unknown0xD4;                        // 0x00D4 (0x04) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1150,7 +1150,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x00D0 (0x0008) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1165,7 +1165,7 @@ public:
     class UProperty*                Inner;                              // 0x00D0 (0x08) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1180,7 +1180,7 @@ public:
     class TArray<struct SFXName>    Names;                              // 0x0070 (0x10) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1195,7 +1195,7 @@ public:
     class FString                   Value;                              // 0x0070 (0x10) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1213,7 +1213,7 @@ public:
 	unsigned char                                      UnknownData01[ 0x18 ];                            		// 0x0090 (0x0018) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1227,7 +1227,7 @@ class UTextBufferFactory : public UFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1245,7 +1245,7 @@ public:
 	unsigned char                                      UnknownData01[ 0xC ];                             		// 0x0088 (0x000C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1261,7 +1261,7 @@ public:
 	struct SFXName                                     TemplateName;                                     		// 0x0068 (0x0008) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1278,7 +1278,7 @@ public:
 	unsigned long                                      bIsDirty : 1;                                     		// 0x0078 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1296,7 +1296,7 @@ public:
 	unsigned long                                      bIsDirty : 1;                                     		// 0x0078 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1322,7 +1322,7 @@ public:
 	unsigned long                                      BioLoadConsoleSupport : 1;                        		// 0x00B0 (0x0004) [0x0000000000000000] [0x00000020] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1337,7 +1337,7 @@ class UHelpCommandlet : public UCommandlet
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1352,7 +1352,7 @@ class UBioCoreBaseObject : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1367,7 +1367,7 @@ public:
 	TArray<struct FBioDlgToken>                        Tokens;                                           		// 0x0060 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1382,7 +1382,7 @@ class UBioBaseTlkFile : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1398,7 +1398,7 @@ public:
 	class UClass*                                      OwnerClass;                                       		// 0x0070 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1416,7 +1416,7 @@ public:
 	unsigned char                                      UnknownData00[ 0xB0 ];                            		// 0x0060 (0x00B0) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1435,7 +1435,7 @@ public:
     TMap<SFXName, UFunction*>       FuncMap;                            // 0x00F0 (0x48) - NOT AUTO-GENERATED PROPERTY 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1460,7 +1460,7 @@ public:
     unsigned char                   UnknownData17C[ 0xA4 ];             // 0x017C (0xA4) - UNKNOWN DATA
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
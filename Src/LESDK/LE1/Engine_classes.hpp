@@ -3358,7 +3358,7 @@ public:
 	class UPackage*                                    LoadedPackage;                                    		// 0x0078 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3623,7 +3623,7 @@ public:
 	unsigned char                                      TransitionType;                                   		// 0x08DD (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3684,7 +3684,7 @@ public:
 	unsigned char                                      TravelType;                                       		// 0x0A80 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3870,7 +3870,7 @@ public:
 	unsigned char                                      m_eRadarType;                                     		// 0x0283 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4151,7 +4151,7 @@ public:
 	unsigned char                                      CsgOper;                                          		// 0x02A0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4165,7 +4165,7 @@ class ABrushShape : public ABrush
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4184,7 +4184,7 @@ public:
 	unsigned long                                      bProcessAllActors : 1;                            		// 0x02C0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4210,7 +4210,7 @@ public:
 	unsigned long                                      bInclusionaryList : 1;                            		// 0x02D4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4226,7 +4226,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x02D8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4245,7 +4245,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x02D4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4265,7 +4265,7 @@ public:
 	unsigned char                                      StreamingUsage;                                   		// 0x02DC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4282,7 +4282,7 @@ class ALightmassImportanceVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4296,7 +4296,7 @@ class APathBlockingVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4336,7 +4336,7 @@ public:
 	unsigned long                                      bWaterVolume : 1;                                 		// 0x0310 (0x0004) [0x0000000000000000] [0x00001000] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4371,7 +4371,7 @@ class ADefaultPhysicsVolume : public APhysicsVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4388,7 +4388,7 @@ public:
 	float                                              RBPhysicsGravityScaling;                          		// 0x0318 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4411,7 +4411,7 @@ public:
 	unsigned long                                      bAllowLadderStrafing : 1;                         		// 0x0350 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4431,7 +4431,7 @@ public:
 	TArray<class APortalTeleporter*>                   Portals;                                          		// 0x02C4 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4449,7 +4449,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x03B0 (0x0004) [0x0000000000000021] [0x00000001] ( CPF_Edit | CPF_Net )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4467,7 +4467,7 @@ public:
 	float                                              Priority;                                         		// 0x02D8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4482,7 +4482,7 @@ class ATriggerVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4500,7 +4500,7 @@ public:
 	float                                              LastValidAnchorTime;                              		// 0x028C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4519,7 +4519,7 @@ public:
 	unsigned long                                      bFadeOut : 1;                                     		// 0x029C (0x0004) [0x0000000100000020] [0x00000001] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4556,7 +4556,7 @@ public:
 	unsigned long                                      bSafeBaseIfAsleep : 1;                            		// 0x02C8 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4597,7 +4597,7 @@ public:
 	unsigned long                                      bIsLift : 1;                                      		// 0x0314 (0x0004) [0x0000000000000000] [0x00000080] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4633,7 +4633,7 @@ public:
 	unsigned long                                      bCurrentlyActive : 1;                             		// 0x0294 (0x0004) [0x0000000100000020] [0x00000008] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4678,7 +4678,7 @@ public:
 	unsigned long                                      bLogPoolOverflowList : 1;                         		// 0x02F0 (0x0004) [0x0000000000044000] [0x00000002] ( CPF_Config | CPF_GlobalConfig )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4741,7 +4741,7 @@ public:
 	unsigned long                                      bShowOverlays : 1;                                		// 0x05B8 (0x0004) [0x0000000000000000] [0x00000100] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4794,7 +4794,7 @@ class AInfo : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4836,7 +4836,7 @@ public:
 	unsigned long                                      bSentinelStreamingLevelStillLoading : 1;          		// 0x0344 (0x0004) [0x0000000000002000] [0x00000080] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4875,7 +4875,7 @@ public:
 	float                                              AutoSelectHeight;                                 		// 0x0298 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4898,7 +4898,7 @@ public:
 	unsigned char                                      FileType;                                         		// 0x02A0 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4916,7 +4916,7 @@ class AFileLog : public AFileWriter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5028,7 +5028,7 @@ public:
 	unsigned long                                      bHasStandbyCheatTriggered : 1;                    		// 0x04AC (0x0004) [0x0000000000000000] [0x01000000] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5199,7 +5199,7 @@ class AMCPTools : public AGameInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5216,7 +5216,7 @@ class AInternetInfo : public AInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5235,7 +5235,7 @@ public:
 	unsigned long                                      bUserAdded : 1;                                   		// 0x029C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5278,7 +5278,7 @@ class APotentialClimbWatcher : public AInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5297,7 +5297,7 @@ public:
 	unsigned char                                      RouteType;                                        		// 0x02A0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5314,7 +5314,7 @@ public:
 	class UWindPointSourceComponent*                   Component;                                        		// 0x0284 (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5332,7 +5332,7 @@ public:
 	unsigned long                                      bSoftKillZ : 1;                                   		// 0x0294 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5471,7 +5471,7 @@ public:
 	unsigned char                                      m_eBioMaxPath;                                    		// 0x0797 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5565,7 +5565,7 @@ public:
 	unsigned long                                      bPredictRespawns : 1;                             		// 0x02F4 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5620,7 +5620,7 @@ public:
 	unsigned char                                      CurrentFireMode;                                  		// 0x03C4 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5733,7 +5733,7 @@ public:
 	unsigned long                                      bMustHoldWeapon : 1;                              		// 0x02AC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5784,7 +5784,7 @@ class AKeypoint : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5798,7 +5798,7 @@ class AClipMarker : public AKeypoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5812,7 +5812,7 @@ class APolyMarker : public AKeypoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5826,7 +5826,7 @@ class ATargetPoint : public AKeypoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5841,7 +5841,7 @@ public:
 	class UMaterialInstanceConstant*                   MatInst;                                          		// 0x0284 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5862,7 +5862,7 @@ public:
 	unsigned long                                      bPaused : 1;                                      		// 0x0298 (0x0004) [0x0000000000000020] [0x00000004] ( CPF_Net )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5938,7 +5938,7 @@ public:
 	unsigned long                                      bShouldSaveForCheckpoint : 1;                     		// 0x0380 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6003,7 +6003,7 @@ public:
 	unsigned char                                      LocationDescription;                              		// 0x041C (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6070,7 +6070,7 @@ public:
 	class AActor*                                      m_aContainingActor;                               		// 0x0420 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6087,7 +6087,7 @@ public:
 	unsigned long                                      bIgnoreSizeLimits : 1;                            		// 0x0390 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6107,7 +6107,7 @@ class ASFXDynamicCoverSlotMarker : public ACoverSlotMarker
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6129,7 +6129,7 @@ public:
 	unsigned char                                      DoorType;                                         		// 0x0398 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6150,7 +6150,7 @@ public:
 	class AController*                                 CurrentUser;                                      		// 0x0384 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6166,7 +6166,7 @@ public:
 	class ALadder*                                     LadderList;                                       		// 0x038C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6181,7 +6181,7 @@ class AAutoLadder : public ALadder
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6201,7 +6201,7 @@ public:
 	unsigned long                                      bJumpLift : 1;                                    		// 0x03A8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6221,7 +6221,7 @@ public:
 	unsigned long                                      bExitOnly : 1;                                    		// 0x038C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6239,7 +6239,7 @@ public:
 	struct FCoverInfo                                  OwningSlot;                                       		// 0x0384 (0x000C) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6253,7 +6253,7 @@ class AObjective : public ANavigationPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6267,7 +6267,7 @@ class APathNode : public ANavigationPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6285,7 +6285,7 @@ public:
 	unsigned long                                      bManualSizing : 1;                                		// 0x038C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6310,7 +6310,7 @@ public:
 	unsigned long                                      bRespawnPaused : 1;                               		// 0x03AC (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6350,7 +6350,7 @@ public:
 	unsigned long                                      bPrimaryStart : 1;                                		// 0x0388 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6366,7 +6366,7 @@ public:
 	class APortalTeleporter*                           MyPortal;                                         		// 0x0384 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6410,7 +6410,7 @@ public:
 	unsigned long                                      bForceObstacleMeshCollision : 1;                  		// 0x0420 (0x0004) [0x0000000000000000] [0x00000400] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6429,7 +6429,7 @@ public:
 	unsigned long                                      bOpen : 1;                                        		// 0x0424 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6447,7 +6447,7 @@ public:
 	unsigned long                                      bMoving : 1;                                      		// 0x0424 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6467,7 +6467,7 @@ public:
 	class AActor*                                      m_aContainingActor;                               		// 0x0384 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6492,7 +6492,7 @@ public:
 	unsigned long                                      bCanTeleportVehicles : 1;                         		// 0x03AC (0x0004) [0x0000000000000001] [0x00000040] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6513,7 +6513,7 @@ public:
 	FString                                            Text;                                             		// 0x0284 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6547,7 +6547,7 @@ public:
 	unsigned long                                      bNotBlockedByShield : 1;                          		// 0x02E4 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6583,7 +6583,7 @@ class ARigidBodyBase : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6598,7 +6598,7 @@ public:
 	class USceneCaptureComponent*                      SceneCapture;                                     		// 0x0284 (0x0008) [0x000000000408000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6614,7 +6614,7 @@ public:
 	class UDrawFrustumComponent*                       DrawFrustum;                                      		// 0x028C (0x0008) [0x000000000408000A]              ( CPF_Const | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6630,7 +6630,7 @@ public:
 	class UMaterialInstanceConstant*                   CubeMaterialInst;                                 		// 0x0294 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6646,7 +6646,7 @@ public:
 	class UMaterialInstanceConstant*                   ReflectMaterialInst;                              		// 0x0294 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6660,7 +6660,7 @@ class ASceneCapturePortalActor : public ASceneCaptureReflectActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6681,7 +6681,7 @@ public:
 	unsigned long                                      bCanTeleportVehicles : 1;                         		// 0x02B4 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6700,7 +6700,7 @@ class AStaticMeshActorBase : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6716,7 +6716,7 @@ public:
 	class UAudioComponent*                             oAudioComponent;                                  		// 0x028C (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6733,7 +6733,7 @@ public:
 	int                                                MaxStaticMeshComponents;                          		// 0x0294 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6750,7 +6750,7 @@ public:
 	class UStaticMeshComponent*                        StaticMeshComponent;                              		// 0x02A4 (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6769,7 +6769,7 @@ public:
 	unsigned long                                      bRecentlyTriggered : 1;                           		// 0x0290 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6798,7 +6798,7 @@ public:
 	unsigned char                                      ComponentType;                                    		// 0x0085 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6885,7 +6885,7 @@ public:
 	struct FScriptDelegate                             __OnAudioFinished__Delegate;                      		// 0x0298 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6921,7 +6921,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x00A4 (0x0004) [0x0000000000000003] [0x00000001] ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7036,7 +7036,7 @@ public:
 	float                                              ScriptRigidBodyCollisionThreshold;                		// 0x021C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7097,7 +7097,7 @@ public:
 	unsigned long                                      bTreatAsASprite : 1;                              		// 0x0228 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7117,7 +7117,7 @@ public:
 	unsigned long                                      bBlockComplexCollisionTrace : 1;                  		// 0x0290 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7131,7 +7131,7 @@ class UCameraConeComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7151,7 +7151,7 @@ public:
 	unsigned long                                      bAlwaysRenderIfSelected : 1;                      		// 0x022C (0x0004) [0x0000000000000002] [0x00000004] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7171,7 +7171,7 @@ public:
 	unsigned long                                      bDrawLitBox : 1;                                  		// 0x0238 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7191,7 +7191,7 @@ public:
 	unsigned long                                      bDrawLitCapsule : 1;                              		// 0x0234 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7209,7 +7209,7 @@ public:
 	int                                                ConeSides;                                        		// 0x022C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7232,7 +7232,7 @@ public:
 	unsigned long                                      bDrawLitCylinder : 1;                             		// 0x0240 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7252,7 +7252,7 @@ public:
 	class UTexture*                                    Texture;                                          		// 0x0234 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7269,7 +7269,7 @@ public:
 	float                                              Height;                                           		// 0x022C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7289,7 +7289,7 @@ public:
 	unsigned long                                      bDrawLitSphere : 1;                               		// 0x0234 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7303,7 +7303,7 @@ class UDrawPylonRadiusComponent : public UDrawSphereComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7317,7 +7317,7 @@ class UDrawSoundRadiusComponent : public UDrawSphereComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7344,7 +7344,7 @@ public:
 	float                                              DefaultLifeTime;                                  		// 0x0250 (0x0004) [0x0000000000003002]              ( CPF_Const | CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7362,7 +7362,7 @@ public:
 	float                                              CachedTexturesTimer;                              		// 0x0250 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7413,7 +7413,7 @@ public:
 	struct FLightmassPrimitiveSettings                 LightmassSettings;                                		// 0x02A8 (0x001C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7437,7 +7437,7 @@ public:
 	TArray<FPointer>                                   Elements;                                         		// 0x0250 (0x0010) [0x0000000000803002]              ( CPF_Const | CPF_Native | CPF_Transient | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7458,7 +7458,7 @@ public:
 	unsigned long                                      bIsScreenSizeScaled : 1;                          		// 0x023C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7486,7 +7486,7 @@ public:
 	unsigned char                                      DepthPriorityGroup;                               		// 0x00F0 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7529,7 +7529,7 @@ public:
 	unsigned char                                      ViewMode;                                         		// 0x00D4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7554,7 +7554,7 @@ public:
 	unsigned long                                      bUpdateMatrices : 1;                              		// 0x0174 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7578,7 +7578,7 @@ public:
 	float                                              FadingIntervalTime;                               		// 0x00FC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7598,7 +7598,7 @@ public:
 	float                                              FarPlane;                                         		// 0x00F0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7615,7 +7615,7 @@ public:
 	float                                              ScaleFOV;                                         		// 0x00E8 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7632,7 +7632,7 @@ public:
 	float                                              ScaleFOV;                                         		// 0x00E0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7651,7 +7651,7 @@ public:
 	float                                              Speed;                                            		// 0x009C (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7667,7 +7667,7 @@ public:
 	float                                              Radius;                                           		// 0x00A8 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7688,7 +7688,7 @@ public:
 	unsigned long                                      m_bNoCollisionFail : 1;                           		// 0x0088 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7709,7 +7709,7 @@ public:
 	unsigned long                                      bGiveDefaultInventory : 1;                        		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7724,7 +7724,7 @@ public:
 	class UClass*                                      ActorClass;                                       		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7739,7 +7739,7 @@ public:
 	class USoundCue*                                   AmbientSoundCue;                                  		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7753,7 +7753,7 @@ class UActorFactoryAmbientSoundMovable : public UActorFactoryAmbientSound
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7768,7 +7768,7 @@ public:
 	class USoundNodeWave*                              SoundNodeWave;                                    		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7782,7 +7782,7 @@ class UActorFactoryAmbientSoundNonLoop : public UActorFactoryAmbientSoundSimple
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7796,7 +7796,7 @@ class UActorFactoryAmbientSoundSimpleToggleable : public UActorFactoryAmbientSou
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7811,7 +7811,7 @@ public:
 	class UApexDestructibleAsset*                      DestructibleAsset;                                		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7826,7 +7826,7 @@ public:
 	class AActor*                                      ArchetypeActor;                                   		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7840,7 +7840,7 @@ class UActorFactoryCoverLink : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7854,7 +7854,7 @@ class UActorFactoryDominantDirectionalLight : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7876,7 +7876,7 @@ public:
 	unsigned char                                      CollisionType;                                    		// 0x00A4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7890,7 +7890,7 @@ class UActorFactoryMover : public UActorFactoryDynamicSM
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7914,7 +7914,7 @@ public:
 	unsigned char                                      RBChannel;                                        		// 0x00D0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7929,7 +7929,7 @@ public:
 	class UParticleSystem*                             ParticleSystem;                                   		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7943,7 +7943,7 @@ class UActorFactoryLight : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7957,7 +7957,7 @@ class UActorFactoryPathNode : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7980,7 +7980,7 @@ public:
 	unsigned long                                      bCastDynamicShadow : 1;                           		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7994,7 +7994,7 @@ class UActorFactoryPlayerStart : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8008,7 +8008,7 @@ class UActorFactoryPylon : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8025,7 +8025,7 @@ public:
 	struct SFXName                                     AnimSequenceName;                                 		// 0x009C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8041,7 +8041,7 @@ public:
 	class UStaticMesh*                                 StaticMesh;                                       		// 0x0098 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8055,7 +8055,7 @@ class UActorFactoryTrigger : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8070,7 +8070,7 @@ public:
 	class UClass*                                      VehicleClass;                                     		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8104,7 +8104,7 @@ public:
 	struct FReverbSettings                             m_ReverbSettings_Override;                        		// 0x0244 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8125,7 +8125,7 @@ public:
 	unsigned long                                      bStasis : 1;                                      		// 0x00A8 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8147,7 +8147,7 @@ public:
 	unsigned long                                      m_bIsPhysicsSleeping : 1;                         		// 0x0068 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8177,7 +8177,7 @@ public:
 	class ACoverLink*                                  m_oCoverLink;                                     		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8208,7 +8208,7 @@ class UBioEngineEnums : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8224,7 +8224,7 @@ public:
 	unsigned long                                      ShouldPlayNextFrame : 1;                          		// 0x0060 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8240,7 +8240,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0060 (0x0008) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8257,7 +8257,7 @@ public:
 	FString                                            SourceFileTimestamp;                              		// 0x0080 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8272,7 +8272,7 @@ public:
 	TArray<unsigned char>                              StreamingData;                                    		// 0x0060 (0x0010) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8287,7 +8287,7 @@ public:
 	FPointer                                           VfTable_FTickableObject;                          		// 0x0060 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8303,7 +8303,7 @@ public:
 	int                                                Value;                                            		// 0x0070 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8319,7 +8319,7 @@ public:
 	struct FRotator                                    Rotation;                                         		// 0x006C (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8333,7 +8333,7 @@ class UCameraMode : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8365,7 +8365,7 @@ public:
 	unsigned long                                      bNoSmooth : 1;                                    		// 0x00B8 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8415,7 +8415,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x38 ];                            		// 0x0060 (0x0038) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8430,7 +8430,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x7C ];                            		// 0x0098 (0x007C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8445,7 +8445,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x14 ];                            		// 0x0098 (0x0014) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8460,7 +8460,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x218 ];                           		// 0x0098 (0x0218) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8475,7 +8475,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x10 ];                            		// 0x0098 (0x0010) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8558,7 +8558,7 @@ public:
 	unsigned char                                      bAltFire;                                         		// 0x04A5 (0x0001) [0x0000000000000004]              ( CPF_Input )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8832,7 +8832,7 @@ public:
 	unsigned char                                      NetPlayerIndex;                                   		// 0x07B9 (0x0001) [0x0000000000200002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9212,7 +9212,7 @@ public:
 	class ADebugCameraController*                      DebugCameraControllerRef;                         		// 0x0068 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9294,7 +9294,7 @@ public:
 	unsigned char                                      UnknownData01[ 0xC ];                             		// 0x0098 (0x000C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9310,7 +9310,7 @@ public:
 	FString                                            Text;                                             		// 0x0070 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9325,7 +9325,7 @@ public:
 	float                                              PlaybackDuration;                                 		// 0x0060 (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9340,7 +9340,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x34 ];                            		// 0x0064 (0x0034) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9355,7 +9355,7 @@ public:
 	float                                              CurrentTime;                                      		// 0x0064 (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9371,7 +9371,7 @@ public:
 	TArray<struct FPresetGeneratedPoint>               Points;                                           		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9386,7 +9386,7 @@ class UCustomPropertyItemHandler : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9421,7 +9421,7 @@ public:
 	unsigned long                                      bRadialDamageVelChange : 1;                       		// 0x00BC (0x0004) [0x0000000000000001] [0x00000100] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9438,7 +9438,7 @@ class UKillZDamageType : public UDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9453,7 +9453,7 @@ public:
 	int                                                FirstColoredMip;                                  		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9468,7 +9468,7 @@ public:
 	float                                              Constant;                                         		// 0x007C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9488,7 +9488,7 @@ public:
 	unsigned char                                      ParamMode;                                        		// 0x0098 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9503,7 +9503,7 @@ public:
 	struct FInterpCurveFloat                           ConstantCurve;                                    		// 0x007C (0x0014) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9521,7 +9521,7 @@ public:
 	unsigned long                                      bConsistentValue : 1;                             		// 0x0088 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9536,7 +9536,7 @@ public:
 	struct FInterpCurveVector2D                        ConstantCurve;                                    		// 0x007C (0x0014) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9553,7 +9553,7 @@ public:
 	unsigned char                                      LockedAxes;                                       		// 0x008C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9573,7 +9573,7 @@ public:
 	unsigned char                                      ParamModes[ 0x3 ];                                		// 0x00C8 (0x0003) [0x0000000000080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9590,7 +9590,7 @@ public:
 	unsigned char                                      LockedAxes;                                       		// 0x0094 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9610,7 +9610,7 @@ public:
 	unsigned char                                      LockedAxes;                                       		// 0x009B (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9630,7 +9630,7 @@ public:
 	unsigned char                                      LockedAxes[ 0x2 ];                                		// 0x0097 (0x0002) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9645,7 +9645,7 @@ public:
 	unsigned char                                      UnknownData00[ 0xA44 ];                           		// 0x0060 (0x0A44) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9660,7 +9660,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0AA4 (0x0008) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9676,7 +9676,7 @@ public:
 	FString                                            Desc;                                             		// 0x00A0 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9696,7 +9696,7 @@ public:
 	unsigned long                                      bUseColor : 1;                                    		// 0x007C (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9710,7 +9710,7 @@ class UEditorLinkSelectionInterface : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9724,7 +9724,7 @@ class UEngineTypes : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9744,7 +9744,7 @@ public:
 	unsigned long                                      m_bBioSoundCuesFixedUp : 1;                       		// 0x009C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9765,7 +9765,7 @@ public:
 	int                                                NumLoadErrors;                                    		// 0x00B8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9789,7 +9789,7 @@ public:
 	int                                                NumCharacters;                                    		// 0x0174 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9808,7 +9808,7 @@ public:
 	TArray<float>                                      ResolutionTestTable;                              		// 0x0178 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9824,7 +9824,7 @@ public:
 	struct FFontImportOptionsData                      Data;                                             		// 0x0060 (0x0094) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9844,7 +9844,7 @@ public:
 	unsigned long                                      bIsPaused : 1;                                    		// 0x0074 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9863,7 +9863,7 @@ public:
 	unsigned long                                      bIsLooping : 1;                                   		// 0x0070 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9918,7 +9918,7 @@ public:
 	unsigned char                                      Default3PSplitType;                               		// 0x01C3 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10004,7 +10004,7 @@ public:
 	struct FGameplayEventsHeader                       Header;                                           		// 0x017C (0x0018) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10022,7 +10022,7 @@ public:
 	TArray<int>                                        EventIDFilter;                                    		// 0x0194 (0x0010) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10051,7 +10051,7 @@ public:
 	class AGameInfo*                                   Game;                                             		// 0x0194 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10089,7 +10089,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x58 ];                            		// 0x0060 (0x0058) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10107,7 +10107,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0088 (0x0008) FIX WRONG TYPE SIZE OF PREVIUS PROPERTY
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10130,7 +10130,7 @@ class UInterface_NavigationHandle : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10147,7 +10147,7 @@ public:
 	int                                                ActiveTab;                                        		// 0x0070 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10171,7 +10171,7 @@ public:
 	unsigned long                                      bImportedTrack : 1;                               		// 0x008C (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10187,7 +10187,7 @@ public:
 	struct FKAggregateGeom                             AggGeom;                                          		// 0x006C (0x004C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10203,7 +10203,7 @@ public:
     unsigned char                                      UnknownData00[0x60];                            		// 0x0070 (0x0060) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10221,7 +10221,7 @@ public:
 	unsigned char                                      UnknownData01[ 0x1DC ];                           		// 0x0198 (0x01DC) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10236,7 +10236,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x44 ];                            		// 0x00D0 (0x0044) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10250,7 +10250,7 @@ class UDemoPlayPendingLevel : public UPendingLevel
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10264,7 +10264,7 @@ class UNetPendingLevel : public UPendingLevel
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10306,7 +10306,7 @@ public:
 	unsigned long                                      bShouldTestForPurpleLevels : 1;                   		// 0x00CC (0x0004) [0x0000000000004000] [0x00004000] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10321,7 +10321,7 @@ public:
 	unsigned long                                      bIsProceduralBuildingLODLevel : 1;                		// 0x00D0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10337,7 +10337,7 @@ public:
 	float                                              MaxDistance;                                      		// 0x00DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10352,7 +10352,7 @@ public:
 	unsigned long                                      bNeverAutoStreamOut : 1;                          		// 0x00D0 (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10366,7 +10366,7 @@ class ULevelStreamingPersistent : public ULevelStreaming
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10382,7 +10382,7 @@ public:
 	class UModel*                                      SourceModel;                                      		// 0x0070 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10409,7 +10409,7 @@ public:
 	unsigned long                                      bVisualizeAmbientOcclusion : 1;                   		// 0x008C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10424,7 +10424,7 @@ public:
 	struct FLightmassPrimitiveSettings                 LightmassSettings;                                		// 0x0060 (0x001C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10438,7 +10438,7 @@ class UMapInfo : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10452,7 +10452,7 @@ class USurface : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10473,7 +10473,7 @@ public:
 	struct FRenderCommandFence_Mirror                  ParentRefFence;                                   		// 0x00A0 (0x0004) [0x0000000000003002]              ( CPF_Const | CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10573,7 +10573,7 @@ public:
 	unsigned char                                      LightingModel;                                    		// 0x03C5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10587,7 +10587,7 @@ class UMaterialExpression : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10602,7 +10602,7 @@ public:
 	unsigned char                                      UnknownData00[ 0xEF4 ];                           		// 0x0060 (0x0EF4) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10616,7 +10616,7 @@ class UMusicTrackDataStructures : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10631,7 +10631,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x300 ];                           		// 0x0060 (0x0300) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10663,7 +10663,7 @@ public:
 	unsigned char                                      UnknownData03[ 0x28 ];                            		// 0x01A4 (0x0028) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10685,7 +10685,7 @@ public:
 	unsigned char                                      UnknownData03[ 0x4 ];                             		// 0x02B0 (0x0004) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10700,7 +10700,7 @@ public:
 	TArray<class UObject*>                             ReferencedObjects;                                		// 0x0060 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10722,7 +10722,7 @@ public:
 	unsigned long                                      bGameplaySessionInProgress : 1;                   		// 0x00D0 (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10741,7 +10741,7 @@ public:
 	unsigned char                                      AsyncState;                                       		// 0x0094 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10786,7 +10786,7 @@ public:
 	TArray<struct FIdToStringMapping>                  OwnerMappings;                                    		// 0x00B8 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10816,7 +10816,7 @@ public:
 	int                                                VersionNumber;                                    		// 0x00A8 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10842,7 +10842,7 @@ public:
 	TArray<struct FStringIdToStringMapping>            ViewIdMappings;                                   		// 0x0060 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10866,7 +10866,7 @@ public:
 	int                                                TitleId;                                          		// 0x00BC (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10893,7 +10893,7 @@ public:
 	int                                                RatingId;                                         		// 0x00C0 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10947,7 +10947,7 @@ public:
 	unsigned long                                      bUseBuildIdOverride : 1;                          		// 0x0158 (0x0004) [0x0000000000004000] [0x00000004] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10987,7 +10987,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0100 (0x0008) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11001,7 +11001,7 @@ class UPackageMapSeekFree : public UPackageMapLevel
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11024,7 +11024,7 @@ public:
 	float                                              PP_ShadowsMultiplier;                             		// 0x0088 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11071,7 +11071,7 @@ public:
 	unsigned long                                      bSentSplitJoin : 1;                               		// 0x05E0 (0x0004) [0x0000000000022002] [0x00000008] ( CPF_Const | CPF_Transient | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11107,7 +11107,7 @@ public:
 	unsigned char                                      UnknownData01[ 0x14 ];                            		// 0x6058 (0x0014) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11122,7 +11122,7 @@ public:
 	class UNetConnection*                              Parent;                                           		// 0x606C (0x0008) [0x0000000000202002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11136,7 +11136,7 @@ class UDemoRecConnection : public UNetConnection
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11151,7 +11151,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x18 ];                            		// 0x0060 (0x0018) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11166,7 +11166,7 @@ public:
 	TArray<class UPostProcessEffect*>                  Effects;                                          		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11194,7 +11194,7 @@ public:
 	unsigned char                                      SceneDPG;                                         		// 0x0084 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11235,7 +11235,7 @@ public:
 	unsigned char                                      OcclusionQuality;                                 		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11250,7 +11250,7 @@ public:
 	class UMaterialInstance*                           Material;                                         		// 0x0088 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11264,7 +11264,7 @@ class UBloomEffect : public UPostProcessEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11279,7 +11279,7 @@ public:
 	int                                                BlurKernelSize;                                   		// 0x0088 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11303,7 +11303,7 @@ public:
 	unsigned char                                      FocusType;                                        		// 0x00B4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11325,7 +11325,7 @@ public:
 	unsigned long                                      bEnableReferenceDOF : 1;                          		// 0x00D0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11344,7 +11344,7 @@ public:
 	unsigned long                                      FullMotionBlur : 1;                               		// 0x00E4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11373,7 +11373,7 @@ public:
 	unsigned char                                      PostProcessAAType;                                		// 0x011C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11388,7 +11388,7 @@ public:
 	class UMaterialInterface*                          Material;                                         		// 0x0088 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11407,7 +11407,7 @@ public:
 	unsigned long                                      FullMotionBlur : 1;                               		// 0x0098 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11429,7 +11429,7 @@ public:
 	unsigned long                                      CastShadow : 1;                                   		// 0x0060 (0x0004) [0x0000000000000001] [0x00000080] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11444,7 +11444,7 @@ public:
 	TArray<class UMaterialInterface*>                  Materials;                                        		// 0x0064 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11459,7 +11459,7 @@ public:
 	class UStaticMesh*                                 StaticMesh;                                       		// 0x0074 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11492,7 +11492,7 @@ public:
 	unsigned char                                      PathColorIndex;                                   		// 0x00C9 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11511,7 +11511,7 @@ class UAdvancedReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11525,7 +11525,7 @@ class UCeilingReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11539,7 +11539,7 @@ class UForcedReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11554,7 +11554,7 @@ public:
 	unsigned char                                      SpecDirection;                                    		// 0x00CC (0x0001) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11568,7 +11568,7 @@ class UFloorToCeilingReachSpec : public UForcedReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11583,7 +11583,7 @@ public:
 	unsigned long                                      bClimbUp : 1;                                     		// 0x00CC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11598,7 +11598,7 @@ public:
 	unsigned char                                      SpecDirection;                                    		// 0x00CC (0x0001) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11613,7 +11613,7 @@ public:
 	unsigned char                                      SpecDirection;                                    		// 0x00CC (0x0001) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11627,7 +11627,7 @@ class UWallTransReachSpec : public UForcedReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11641,7 +11641,7 @@ class ULadderReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11655,7 +11655,7 @@ class UProscribedReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11669,7 +11669,7 @@ class UTeleportReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11685,7 +11685,7 @@ public:
 	struct FGuid                                       m_Guid;                                           		// 0x0070 (0x0010) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11701,7 +11701,7 @@ public:
 	unsigned long                                      bTickWhilePaused : 1;                             		// 0x0068 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11719,7 +11719,7 @@ public:
 	struct SFXName                                     BaseLevel;                                        		// 0x0070 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11763,7 +11763,7 @@ public:
 	unsigned char                                      RootMotionMode;                                   		// 0x0116 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11790,7 +11790,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x2C ];                            		// 0x0060 (0x002C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11804,7 +11804,7 @@ class UServerCommandlet : public UCommandlet
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11824,7 +11824,7 @@ public:
 	struct FScriptDelegate                             __NotifyPropertyValueUpdated__Delegate;           		// 0x00B0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11907,7 +11907,7 @@ public:
 	unsigned long                                      bIsSearchInProgress : 1;                          		// 0x0160 (0x0004) [0x0000000000000002] [0x00000004] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11947,7 +11947,7 @@ public:
 	unsigned char                                      GameState;                                        		// 0x0100 (0x0001) [0x0000000040000002]              ( CPF_Const | CPF_EditInlineNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11962,7 +11962,7 @@ public:
 	unsigned char                                      UnknownData00[ 0xE8 ];                            		// 0x0060 (0x00E8) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11977,7 +11977,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x5C ];                            		// 0x0060 (0x005C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11998,7 +11998,7 @@ public:
 	int                                                InstanceIndex;                                    		// 0x0094 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12012,7 +12012,7 @@ class USmokeTestCommandlet : public UCommandlet
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12038,7 +12038,7 @@ public:
 	int                                                CurrentPlayCount;                                 		// 0x00F8 (0x0004) [0x0000000000202002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12057,7 +12057,7 @@ public:
 	int                                                NodeUpdateHint;                                   		// 0x0090 (0x0004) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12092,7 +12092,7 @@ public:
 	float                                              SampleDataGain;                                   		// 0x01F8 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12107,7 +12107,7 @@ public:
 	struct SFXName                                     WaveParameterName;                                		// 0x0094 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12131,7 +12131,7 @@ public:
 	unsigned long                                      bInitialised : 1;                                 		// 0x010C (0x0004) [0x0000000000202000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12166,7 +12166,7 @@ public:
 	unsigned char                                      UnknownData04[ 0x48 ];                            		// 0x0148 (0x0048) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12203,7 +12203,7 @@ public:
 	unsigned char                                      SleepFamily;                                      		// 0x0129 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12225,7 +12225,7 @@ public:
 	unsigned long                                      m_bSupportsStaticMeshes : 1;                      		// 0x00DC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12244,7 +12244,7 @@ public:
 	unsigned long                                      ReentrantFlag : 1;                                		// 0x00D4 (0x0004) [0x0000000000002002] [0x00000001] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12293,7 +12293,7 @@ public:
 	unsigned char                                      MipGenSettings;                                   		// 0x00F7 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12340,7 +12340,7 @@ public:
 	unsigned char                                      AddressY;                                         		// 0x01B2 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12357,7 +12357,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x5 ];                             		// 0x01B3 (0x0005) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12372,7 +12372,7 @@ public:
 	int                                                ShadowmapFlags;                                   		// 0x01B4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12387,7 +12387,7 @@ public:
 	class UForceFeedbackWaveform*                      TheWaveForm;                                      		// 0x0060 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12454,7 +12454,7 @@ public:
     unsigned char                                      UnknownData01[0x26C];                           		// 0x01E8 (0x026C) MISSED OFFSET
     */
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12471,7 +12471,7 @@ public:
 	unsigned long                                      bSplitNavMesh : 1;                                		// 0x02D4 (0x0004) [0x0000000000002002] [0x00000001] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12487,7 +12487,7 @@ public:
 	FPointer                                           VfTable_IInterface_NavMeshPathObject;             		// 0x02C4 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12509,7 +12509,7 @@ public:
 	unsigned long                                      bReverseScriptedRoute : 1;                        		// 0x04CC (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12539,7 +12539,7 @@ public:
 	FPointer                                           VfTable_IInterface_NavigationHandle;              		// 0x0284 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12554,7 +12554,7 @@ class ACrowdPopulationManagerBase : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12568,7 +12568,7 @@ class APathTargetPoint : public AKeypoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12585,7 +12585,7 @@ public:
 	unsigned long                                      bPreserveInternalGeo : 1;                         		// 0x028C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12605,7 +12605,7 @@ public:
 	FPointer                                           VfTable_IInterface_NavMeshPathObject;             		// 0x0284 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12619,7 +12619,7 @@ class UCoverGroupRenderingComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12642,7 +12642,7 @@ public:
 	class UMaterialInterface*                          BadTargetMaterial;                                		// 0x0310 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12656,7 +12656,7 @@ class UNavMeshRenderingComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12670,7 +12670,7 @@ class UPathRenderingComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12684,7 +12684,7 @@ class URouteRenderingComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12698,7 +12698,7 @@ class UInterface_NavMeshPathObject : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12712,7 +12712,7 @@ class UInterface_NavMeshPathSwitch : public UInterface_NavMeshPathObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12727,7 +12727,7 @@ class UInterface_NavMeshPathObstacle : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12746,7 +12746,7 @@ public:
 	float                                              AddedHeuristicCost;                               		// 0x0074 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12763,7 +12763,7 @@ public:
 	struct FVector                                     Direction;                                        		// 0x0078 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12779,7 +12779,7 @@ class UNavMeshPath_EnforceTwoWayEdges : public UNavMeshPathConstraint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12797,7 +12797,7 @@ public:
 	unsigned char                                      EdgeType;                                         		// 0x0088 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12815,7 +12815,7 @@ public:
 	class AActor*                                      GoalActor;                                        		// 0x0084 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12838,7 +12838,7 @@ public:
 	unsigned long                                      bOnlyThrowOutNodesThatLeaveEnvelope : 1;          		// 0x0090 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12857,7 +12857,7 @@ public:
 	unsigned long                                      bSoft : 1;                                        		// 0x0080 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12878,7 +12878,7 @@ public:
 	unsigned long                                      bAlwaysCallEvaluateGoal : 1;                      		// 0x0074 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12899,7 +12899,7 @@ public:
 	unsigned long                                      bKeepPartial : 1;                                 		// 0x0098 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12920,7 +12920,7 @@ public:
 	FPointer                                           CachedAnchorPoly;                                 		// 0x00D0 (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12938,7 +12938,7 @@ public:
 	FPointer                                           PartialGoal;                                      		// 0x0078 (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12955,7 +12955,7 @@ class UNavMeshGoal_PolyEncompassesAI : public UNavMeshPathGoalEvaluator
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12985,7 +12985,7 @@ public:
 	unsigned long                                      bUltraVerbosePathDebugging : 1;                   		// 0x0110 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13031,7 +13031,7 @@ public:
 	int                                                CacheIdx;                                         		// 0x0068 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13048,7 +13048,7 @@ public:
 	struct FVector                                     Direction;                                        		// 0x006C (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13068,7 +13068,7 @@ public:
 	int                                                MoveFlags;                                        		// 0x0078 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13088,7 +13088,7 @@ public:
 	float                                              MinDistBetweenSpecTypes;                          		// 0x0080 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13105,7 +13105,7 @@ public:
 	class AActor*                                      GoalActor;                                        		// 0x006C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13122,7 +13122,7 @@ public:
 	struct FVector                                     GoalPoint;                                        		// 0x006C (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13144,7 +13144,7 @@ public:
 	unsigned long                                      bOnlyThrowOutNodesThatLeaveEnvelope : 1;          		// 0x0084 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13163,7 +13163,7 @@ public:
 	unsigned long                                      bSoft : 1;                                        		// 0x0074 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13184,7 +13184,7 @@ public:
 	unsigned long                                      AllowStartNodeToBeGoal : 1;                       		// 0x0078 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13203,7 +13203,7 @@ public:
 	unsigned long                                      bKeepPartial : 1;                                 		// 0x0088 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13219,7 +13219,7 @@ class UGoal_Null : public UPathGoalEvaluator
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13245,7 +13245,7 @@ public:
 	unsigned long                                      bShouldDoAnimNotifies : 1;                        		// 0x02CC (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13294,7 +13294,7 @@ public:
 	TArray<struct FSkelMaterialSetterDatum>            NonExtremeContent;                                		// 0x02E0 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13310,7 +13310,7 @@ class ASkeletalMeshActorSpawnable : public ASkeletalMeshActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13324,7 +13324,7 @@ class ASkeletalMeshCinematicActor : public ASkeletalMeshActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13339,7 +13339,7 @@ public:
 	TArray<class UAnimNodeSlot*>                       SlotNodes;                                        		// 0x02D0 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13365,7 +13365,7 @@ class UAnimMetaData : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13381,7 +13381,7 @@ public:
 	unsigned long                                      bFullControlOverController : 1;                   		// 0x0070 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13396,7 +13396,7 @@ public:
 	TArray<struct FTimeModifier>                       KeyFrames;                                        		// 0x0074 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13410,7 +13410,7 @@ class UAnimNotify : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13426,7 +13426,7 @@ public:
 	class UClass*                                      CameraLensEffect;                                 		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13441,7 +13441,7 @@ public:
 	int                                                FootDown;                                         		// 0x0060 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13456,7 +13456,7 @@ public:
 	struct SFXName                                     NotifyName;                                       		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13476,7 +13476,7 @@ public:
 	unsigned long                                      bSkipIfOwnerIsHidden : 1;                         		// 0x0078 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13494,7 +13494,7 @@ public:
 	unsigned long                                      bCheckForBasedPlayer : 1;                         		// 0x0074 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13511,7 +13511,7 @@ public:
 	struct SFXName                                     NotifyEndName;                                    		// 0x0070 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13525,7 +13525,7 @@ class UAnimNotify_Scripted : public UAnimNotify
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13552,7 +13552,7 @@ public:
 	unsigned long                                      bUseBoneLocation : 1;                             		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13572,7 +13572,7 @@ public:
 	unsigned long                                      bIgnoreIfActorHidden : 1;                         		// 0x0074 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13600,7 +13600,7 @@ public:
 	unsigned long                                      bResampleRequired : 1;                            		// 0x00AC (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13616,7 +13616,7 @@ public:
 	class USkeletalMeshComponent*                      SkelComponent;                                    		// 0x0060 (0x0008) [0x000000000408200A]              ( CPF_Const | CPF_ExportObject | CPF_Transient | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13647,7 +13647,7 @@ public:
 	unsigned char                                      CachedNumDesiredBones;                            		// 0x00E4 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13671,7 +13671,7 @@ public:
 	unsigned char                                      BlendTypeAlpha;                                   		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13702,7 +13702,7 @@ public:
 	unsigned char                                      ForcedAimDir;                                     		// 0x0164 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13722,7 +13722,7 @@ public:
 	unsigned long                                      bSkipBlendWhenNotRendered : 1;                    		// 0x010C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13738,7 +13738,7 @@ public:
 	unsigned long                                      bPassThroughWhenNotRendered : 1;                  		// 0x0110 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13756,7 +13756,7 @@ public:
 	unsigned long                                      bForceLocalSpaceBlend : 1;                        		// 0x0140 (0x0004) [0x0000000000000003] [0x00000001] ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13773,7 +13773,7 @@ public:
 	unsigned long                                      bDontBlendOutOneShot : 1;                         		// 0x011C (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13793,7 +13793,7 @@ public:
 	unsigned long                                      bIsPlayingCustomAnim : 1;                         		// 0x0114 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13818,7 +13818,7 @@ public:
 	int                                                SingleAnimAtOrAboveLOD;                           		// 0x0114 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13838,7 +13838,7 @@ public:
 	unsigned long                                      bSkipBlendWhenNotRendered : 1;                    		// 0x0118 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13858,7 +13858,7 @@ public:
 	unsigned char                                      Type;                                             		// 0x0138 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13872,7 +13872,7 @@ class UAnimNodeBlendByPhysics : public UAnimNodeBlendList
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13886,7 +13886,7 @@ class UAnimNodeBlendByPosture : public UAnimNodeBlendList
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13912,7 +13912,7 @@ public:
 	unsigned long                                      bSynchronizeNodesInEditor : 1;                    		// 0x0150 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13936,7 +13936,7 @@ public:
 	unsigned long                                      bUseAcceleration : 1;                             		// 0x014C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13953,7 +13953,7 @@ public:
 	int                                                PendingChildIndex;                                		// 0x0134 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13969,7 +13969,7 @@ public:
 	TArray<unsigned char>                              SourceRequiredBones;                              		// 0x0110 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13985,7 +13985,7 @@ public:
 	unsigned long                                      bEnableMirroring : 1;                             		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14000,7 +14000,7 @@ public:
 	float                                              ScaleByValue;                                     		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14015,7 +14015,7 @@ public:
 	float                                              BaseSpeed;                                        		// 0x0104 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14039,7 +14039,7 @@ public:
 	unsigned long                                      bAdditiveAnimationsOverrideSource : 1;            		// 0x0128 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14065,7 +14065,7 @@ public:
 	TArray<struct FSynchGroup>                         Groups;                                           		// 0x0100 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14088,7 +14088,7 @@ public:
 	unsigned char                                      RotationBlendType;                                		// 0x0118 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14110,7 +14110,7 @@ public:
 	unsigned long                                      bUseSavedPose : 1;                                		// 0x0160 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14168,7 +14168,7 @@ public:
 	unsigned char                                      RootRotationOption[ 0x3 ];                        		// 0x0137 (0x0003) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14195,7 +14195,7 @@ public:
 	TArray<struct FAnimBlendInfo>                      Anims;                                            		// 0x013C (0x0010) [0x0000000004400049]              ( CPF_Edit | CPF_ExportObject | CPF_EditConstArray | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14223,7 +14223,7 @@ public:
 	struct SFXName                                     AnimName_RD;                                      		// 0x01B4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14240,7 +14240,7 @@ public:
 	unsigned long                                      bDrawSlider : 1;                                  		// 0x0070 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14257,7 +14257,7 @@ public:
 	TArray<float>                                      Weights;                                          		// 0x0094 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14277,7 +14277,7 @@ public:
 	float                                              Weight;                                           		// 0x0084 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14293,7 +14293,7 @@ public:
 	TArray<struct FMorphNodeConn>                      NodeConns;                                        		// 0x0074 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14308,7 +14308,7 @@ public:
 	float                                              NodeWeight;                                       		// 0x0084 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14336,7 +14336,7 @@ public:
 	unsigned char                                      AngleBoneAxis;                                    		// 0x00C5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14360,7 +14360,7 @@ public:
 	unsigned char                                      BoneAxis;                                         		// 0x00BC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14396,7 +14396,7 @@ public:
 	unsigned char                                      BlendType;                                        		// 0x00D0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14428,7 +14428,7 @@ public:
 	unsigned char                                      JointAxis;                                        		// 0x0113 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14451,7 +14451,7 @@ public:
 	unsigned char                                      FootUpAxis;                                       		// 0x0134 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14495,7 +14495,7 @@ public:
 	unsigned char                                      AllowRotationSpace;                               		// 0x0147 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14524,7 +14524,7 @@ public:
 	unsigned char                                      BoneRotationSpace;                                		// 0x0101 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14543,7 +14543,7 @@ public:
 	unsigned char                                      HandlebarRotateAxis;                              		// 0x0115 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14565,7 +14565,7 @@ public:
 	unsigned char                                      WheelSteeringAxis;                                		// 0x0119 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14585,7 +14585,7 @@ public:
 	unsigned char                                      BoneRotMode;                                      		// 0x00E5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14612,7 +14612,7 @@ public:
 	unsigned char                                      ChainBoneAxis;                                    		// 0x0150 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14638,7 +14638,7 @@ public:
 	unsigned char                                      EffectorLocationSpace;                            		// 0x011C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14654,7 +14654,7 @@ public:
 	float                                              TwistAngleScale;                                  		// 0x00DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14696,7 +14696,7 @@ public:
 	unsigned char                                      KeyEncodingFormat;                                		// 0x0122 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14714,7 +14714,7 @@ public:
 	class UBioAnimSetData*                             m_pBioAnimSetData;                                		// 0x0078 (0x0008) [0x0000000004020001]              ( CPF_Edit | CPF_EditConst | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14731,7 +14731,7 @@ public:
 	struct SFXName                                     m_nmOrigSetName;                                  		// 0x00D0 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14749,7 +14749,7 @@ public:
 	unsigned char                                      RotationCompressionFormat;                        		// 0x0075 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14763,7 +14763,7 @@ class UAnimationCompressionAlgorithm_BitwiseCompressOnly : public UAnimationComp
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14779,7 +14779,7 @@ public:
 	unsigned long                                      bStartAtSecondKey : 1;                            		// 0x007C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14799,7 +14799,7 @@ public:
 	unsigned long                                      bRetarget : 1;                                    		// 0x008C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14815,7 +14815,7 @@ public:
 	float                                              MaxAngleDiff;                                     		// 0x007C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14829,7 +14829,7 @@ class UAnimationCompressionAlgorithm_RevertToRaw : public UAnimationCompressionA
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14848,7 +14848,7 @@ public:
 	unsigned long                                      bAnimRotationOnly : 1;                            		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14868,7 +14868,7 @@ public:
 	TArray<int>                                        OffsetSkeleton_dep;                               		// 0x0094 (0x0010) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14884,7 +14884,7 @@ public:
 	class USkeletalMesh*                               BaseSkelMesh;                                     		// 0x0070 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14899,7 +14899,7 @@ class UMorphWeightSequence : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14914,7 +14914,7 @@ public:
 	class UDecalComponent*                             Decal;                                            		// 0x0284 (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14928,7 +14928,7 @@ class ADecalActor : public ADecalActorBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14942,7 +14942,7 @@ class ADecalActorMovable : public ADecalActorBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15008,7 +15008,7 @@ public:
 	unsigned char                                      FilterMode;                                       		// 0x0371 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15029,7 +15029,7 @@ public:
 	class UMaterialInterface*                          DecalMaterial;                                    		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15045,7 +15045,7 @@ public:
 	TArray<class UDecalComponent*>                     ManagedDecals;                                    		// 0x0070 (0x0010) [0x000000000448000A]              ( CPF_Const | CPF_ExportObject | CPF_Component | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15059,7 +15059,7 @@ class UDecalLifetimeAge : public UDecalLifetime
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15074,7 +15074,7 @@ public:
 	FString                                            LifetimePolicyName;                               		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15090,7 +15090,7 @@ public:
 	float                                              LifeSpan;                                         		// 0x0074 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15105,7 +15105,7 @@ public:
 	TArray<class UDecalLifetime*>                      LifetimePolicies;                                 		// 0x0060 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15121,7 +15121,7 @@ class UDecalMaterial : public UMaterial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15138,7 +15138,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x0294 (0x0004) [0x0000000100000020] [0x00000001] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15158,7 +15158,7 @@ class AFogVolumeConeDensityInfo : public AFogVolumeDensityInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15172,7 +15172,7 @@ class AFogVolumeConstantDensityInfo : public AFogVolumeDensityInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15186,7 +15186,7 @@ class AFogVolumeLinearHalfspaceDensityInfo : public AFogVolumeDensityInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15200,7 +15200,7 @@ class AFogVolumeSphericalDensityInfo : public AFogVolumeDensityInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15222,7 +15222,7 @@ public:
 	unsigned long                                      bAffectsTranslucency : 1;                         		// 0x00CC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15243,7 +15243,7 @@ public:
 	float                                              ConeMaxAngle;                                     		// 0x00F8 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15258,7 +15258,7 @@ public:
 	float                                              Density;                                          		// 0x00D0 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15274,7 +15274,7 @@ public:
 	float                                              PlaneDistanceFactor;                              		// 0x00E0 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15292,7 +15292,7 @@ public:
 	float                                              SphereRadius;                                     		// 0x00E8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15308,7 +15308,7 @@ public:
 	unsigned long                                      bNothingSelected : 1;                             		// 0x0094 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15322,7 +15322,7 @@ class UActorFactoryFogVolumeLinearHalfspaceDensityInfo : public UActorFactoryFog
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15336,7 +15336,7 @@ class UActorFactoryFogVolumeSphericalDensityInfo : public UActorFactoryFogVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15352,7 +15352,7 @@ public:
 	class UApexStaticDestructibleComponent*            StaticDestructibleComponent;                      		// 0x0294 (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15373,7 +15373,7 @@ public:
 	unsigned long                                      bAssetChanged : 1;                                		// 0x026C (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15388,7 +15388,7 @@ public:
 	FPointer                                           ComponentDynamicResources;                        		// 0x0270 (0x0008) [0x0000000000003002]              ( CPF_Const | CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15402,7 +15402,7 @@ class UApexStaticComponent : public UApexComponentBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15418,7 +15418,7 @@ public:
 	FPointer                                           ApexDestructiblePreview;                          		// 0x0278 (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15437,7 +15437,7 @@ public:
 	int                                                InstancingRandomSeed;                             		// 0x02EC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15454,7 +15454,7 @@ public:
 	unsigned long                                      bSmoothInterpRollScale : 1;                       		// 0x0328 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15469,7 +15469,7 @@ public:
 	TArray<class UApexComponentBase*>                  ApexComponents;                                   		// 0x0060 (0x0010) [0x000000000408300A]              ( CPF_Const | CPF_ExportObject | CPF_Native | CPF_Transient | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15495,7 +15495,7 @@ public:
 	unsigned long                                      bSlowStart : 1;                                   		// 0x0098 (0x0004) [0x0000000004000003] [0x00000004] ( CPF_Edit | CPF_Const | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15515,7 +15515,7 @@ public:
 	unsigned long                                      bDynamic : 1;                                     		// 0x0128 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15530,7 +15530,7 @@ public:
 	FPointer                                           MApexAsset;                                       		// 0x0070 (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15545,7 +15545,7 @@ public:
 	FString                                            Caption;                                          		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15559,7 +15559,7 @@ class UInterpFilter_Classes : public UInterpFilter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15573,7 +15573,7 @@ class UInterpFilter_Custom : public UInterpFilter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15599,7 +15599,7 @@ public:
 	unsigned long                                      bIsSelected : 1;                                  		// 0x0098 (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15616,7 +15616,7 @@ public:
 	unsigned long                                      AllowDeferredActorAttach : 1;                     		// 0x00AC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15630,7 +15630,7 @@ class UInterpGroupDirector : public UInterpGroup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15647,7 +15647,7 @@ public:
 	class AActor*                                      GroupActor;                                       		// 0x0078 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15663,7 +15663,7 @@ public:
 	unsigned char                                      SavedPhysics;                                     		// 0x0088 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15677,7 +15677,7 @@ class UInterpGroupInstDirector : public UInterpGroupInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15694,7 +15694,7 @@ public:
 	int                                                m_nNextKey;                                       		// 0x00A4 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15715,7 +15715,7 @@ public:
 	unsigned long                                      bSimulateCameraCutsOnClients : 1;                 		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15733,7 +15733,7 @@ public:
 	unsigned long                                      bFireEventsWhenJumpingForwards : 1;               		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15757,7 +15757,7 @@ public:
 	unsigned long                                      bOverrideDirty : 1;                               		// 0x0130 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15773,7 +15773,7 @@ public:
 	float                                              CurveTension;                                     		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15790,7 +15790,7 @@ public:
 	struct SFXName                                     SlotName;                                         		// 0x00C8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15805,7 +15805,7 @@ public:
 	unsigned long                                      bPersistFade : 1;                                 		// 0x00A8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15821,7 +15821,7 @@ public:
 	struct SFXName                                     ParamName;                                        		// 0x00B8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15836,7 +15836,7 @@ public:
 	struct SFXName                                     ParamName;                                        		// 0x00A8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15851,7 +15851,7 @@ public:
 	struct SFXName                                     PropertyName;                                     		// 0x00A8 (0x0008) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15866,7 +15866,7 @@ public:
 	struct SFXName                                     MorphNodeName;                                    		// 0x00A8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15881,7 +15881,7 @@ public:
 	struct SFXName                                     SkelControlName;                                  		// 0x00A8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15895,7 +15895,7 @@ class UInterpTrackSlomo : public UInterpTrackFloatBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15911,7 +15911,7 @@ public:
 	float                                              CurveTension;                                     		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15926,7 +15926,7 @@ public:
 	struct SFXName                                     PropertyName;                                     		// 0x00A8 (0x0008) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15954,7 +15954,7 @@ public:
 	unsigned char                                      RotMode;                                          		// 0x00DD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15969,7 +15969,7 @@ public:
 	TArray<struct FParticleReplayTrackKey>             TrackKeys;                                        		// 0x0090 (0x0010) [0x0000000004400000]              ( CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15988,7 +15988,7 @@ public:
 	unsigned long                                      bFireEventsWhenJumpingForwards : 1;               		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16004,7 +16004,7 @@ public:
 	float                                              CurveTension;                                     		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16018,7 +16018,7 @@ class UInterpTrackAudioMaster : public UInterpTrackVectorBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16033,7 +16033,7 @@ public:
 	struct SFXName                                     PropertyName;                                     		// 0x00A8 (0x0008) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16047,7 +16047,7 @@ class UInterpTrackColorScale : public UInterpTrackVectorBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16066,7 +16066,7 @@ public:
 	unsigned long                                      m_bBioRequiresPreload : 1;                        		// 0x00B8 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16082,7 +16082,7 @@ public:
 	struct SFXName                                     ParamName;                                        		// 0x00B8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16097,7 +16097,7 @@ public:
 	struct SFXName                                     PropertyName;                                     		// 0x00A8 (0x0008) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16115,7 +16115,7 @@ public:
 	unsigned long                                      bFireEventsWhenJumpingForwards : 1;               		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16129,7 +16129,7 @@ class UInterpTrackInst : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16144,7 +16144,7 @@ public:
 	float                                              m_fLastUpdatePosition;                            		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16160,7 +16160,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0070 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16174,7 +16174,7 @@ class UInterpTrackInstAudioMaster : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16188,7 +16188,7 @@ class UInterpTrackInstColorScale : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16203,7 +16203,7 @@ public:
 	class AActor*                                      OldViewTarget;                                    		// 0x0060 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16218,7 +16218,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16234,7 +16234,7 @@ public:
 	unsigned long                                      bFirstUpdate : 1;                                 		// 0x0064 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16248,7 +16248,7 @@ class UInterpTrackInstFade : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16263,7 +16263,7 @@ public:
 	TArray<float>                                      ResetFloats;                                      		// 0x0060 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16278,7 +16278,7 @@ public:
 	float                                              ResetFloat;                                       		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16292,7 +16292,7 @@ class UInterpTrackInstMorphWeight : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16311,7 +16311,7 @@ public:
 	unsigned char                                      m_nSavedPhysicsMode;                              		// 0x00C8 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16326,7 +16326,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16342,7 +16342,7 @@ public:
 	class UObject*                                     PropertyOuterObjectInst;                          		// 0x0068 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16358,7 +16358,7 @@ public:
 	struct FColor                                      ResetColor;                                       		// 0x0078 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16374,7 +16374,7 @@ public:
 	float                                              ResetFloat;                                       		// 0x0078 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16390,7 +16390,7 @@ public:
 	struct FLinearColor                                ResetColor;                                       		// 0x0078 (0x0010) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16406,7 +16406,7 @@ public:
 	struct FVector                                     ResetVector;                                      		// 0x0078 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16420,7 +16420,7 @@ class UInterpTrackInstSkelControlScale : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16435,7 +16435,7 @@ public:
 	float                                              OldTimeDilation;                                  		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16451,7 +16451,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0068 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16468,7 +16468,7 @@ public:
 	unsigned char                                      Action;                                           		// 0x0068 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16483,7 +16483,7 @@ public:
 	TArray<struct FVector>                             ResetVectors;                                     		// 0x0060 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16499,7 +16499,7 @@ public:
 	unsigned char                                      Action;                                           		// 0x0064 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16515,7 +16515,7 @@ public:
 	unsigned char                                      BaseProperty;                                     		// 0x0068 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16530,7 +16530,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16546,7 +16546,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16562,7 +16562,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16580,7 +16580,7 @@ public:
 	float                                              ReferencePlane;                                   		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16594,7 +16594,7 @@ class UMaterialExpressionCameraVector : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16608,7 +16608,7 @@ class UMaterialExpressionCameraWorldPosition : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16623,7 +16623,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16640,7 +16640,7 @@ public:
 	struct FExpressionInput                            Max;                                              		// 0x00A0 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16659,7 +16659,7 @@ public:
 	int                                                SizeY;                                            		// 0x007C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16678,7 +16678,7 @@ public:
 	unsigned long                                      A : 1;                                            		// 0x0080 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16695,7 +16695,7 @@ public:
 	unsigned long                                      bExpanded : 1;                                    		// 0x0080 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16710,7 +16710,7 @@ public:
 	float                                              R;                                                		// 0x0060 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16726,7 +16726,7 @@ public:
 	float                                              G;                                                		// 0x0064 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16743,7 +16743,7 @@ public:
 	float                                              B;                                                		// 0x0068 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16761,7 +16761,7 @@ public:
 	float                                              A;                                                		// 0x006C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16778,7 +16778,7 @@ public:
 	float                                              Scale;                                            		// 0x0084 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16795,7 +16795,7 @@ public:
 	float                                              Max;                                              		// 0x0084 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16811,7 +16811,7 @@ public:
 	float                                              Period;                                           		// 0x0080 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16827,7 +16827,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16845,7 +16845,7 @@ public:
 	unsigned char                                      OutputType;                                       		// 0x0090 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16860,7 +16860,7 @@ public:
 	class UTexture*                                    Texture;                                          		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16878,7 +16878,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x00A4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16897,7 +16897,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x00C4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16912,7 +16912,7 @@ public:
 	struct FExpressionInput                            InXY;                                             		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16929,7 +16929,7 @@ public:
 	struct FLinearColor                                LuminanceFactors;                                 		// 0x00A0 (0x0010) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16943,7 +16943,7 @@ class UMaterialExpressionDestColor : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16958,7 +16958,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x0060 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16974,7 +16974,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16990,7 +16990,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17006,7 +17006,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17025,7 +17025,7 @@ public:
 	struct FExpressionInput                            ALessThanB;                                       		// 0x00E0 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17040,7 +17040,7 @@ public:
 	TArray<FString>                                    ParamNames;                                       		// 0x0060 (0x0010) [0x0000000000400041]              ( CPF_Edit | CPF_EditConstArray | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17054,7 +17054,7 @@ class UMaterialExpressionMeshEmitterDynamicParameter : public UMaterialExpressio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17069,7 +17069,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17083,7 +17083,7 @@ class UMaterialExpressionFluidNormal : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17099,7 +17099,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17113,7 +17113,7 @@ class UMaterialExpressionFoliageImpulseDirection : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17127,7 +17127,7 @@ class UMaterialExpressionFoliageNormalizedRotationAxisAndAngle : public UMateria
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17143,7 +17143,7 @@ public:
 	int                                                FontTexturePage;                                  		// 0x0068 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17159,7 +17159,7 @@ public:
 	struct SFXName                                     ParameterName;                                    		// 0x007C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17174,7 +17174,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17190,7 +17190,7 @@ public:
 	float                                              Exponent;                                         		// 0x0080 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17209,7 +17209,7 @@ public:
 	struct FExpressionInput                            ALessThanB;                                       		// 0x00E0 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17223,7 +17223,7 @@ class UMaterialExpressionLightVector : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17237,7 +17237,7 @@ class UMaterialExpressionLightmapUVs : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17253,7 +17253,7 @@ public:
 	struct FExpressionInput                            Lightmass;                                        		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17270,7 +17270,7 @@ public:
 	struct FExpressionInput                            Alpha;                                            		// 0x00A0 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17284,7 +17284,7 @@ class UMaterialExpressionMeshEmitterVertexColor : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17300,7 +17300,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17315,7 +17315,7 @@ public:
 	struct FExpressionInput                            VectorInput;                                      		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17329,7 +17329,7 @@ class UMaterialExpressionObjectOrientation : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17343,7 +17343,7 @@ class UMaterialExpressionObjectRadius : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17357,7 +17357,7 @@ class UMaterialExpressionObjectWorldPosition : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17371,7 +17371,7 @@ class UMaterialExpressionOcclusionPercentage : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17386,7 +17386,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17404,7 +17404,7 @@ public:
 	float                                              SpeedY;                                           		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17420,7 +17420,7 @@ public:
 	struct SFXName                                     ParameterName;                                    		// 0x0070 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17435,7 +17435,7 @@ public:
 	float                                              DefaultValue;                                     		// 0x0078 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17449,7 +17449,7 @@ class UBioMaterialExpressionEffectMatFractionEnabled : public UMaterialExpressio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17469,7 +17469,7 @@ public:
 	unsigned long                                      DefaultA : 1;                                     		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17488,7 +17488,7 @@ public:
 	unsigned long                                      ExtendedCaptionDisplay : 1;                       		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17503,7 +17503,7 @@ public:
 	struct FLinearColor                                DefaultValue;                                     		// 0x0078 (0x0010) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17518,7 +17518,7 @@ public:
 	unsigned long                                      bUseViewSpace : 1;                                		// 0x0060 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17532,7 +17532,7 @@ class UMaterialExpressionPerInstanceRandom : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17547,7 +17547,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x0060 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17563,7 +17563,7 @@ public:
 	struct FExpressionInput                            Exponent;                                         		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17577,7 +17577,7 @@ class UMaterialExpressionReflectionVector : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17594,7 +17594,7 @@ public:
 	struct FExpressionInput                            Position;                                         		// 0x00A0 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17613,7 +17613,7 @@ public:
 	float                                              Speed;                                            		// 0x00A8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17629,7 +17629,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x0080 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17646,7 +17646,7 @@ public:
 	unsigned char                                      SceneTextureType;                                 		// 0x0084 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17661,7 +17661,7 @@ public:
 	unsigned long                                      ScreenAlign : 1;                                  		// 0x0060 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17677,7 +17677,7 @@ public:
 	float                                              Period;                                           		// 0x0080 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17695,7 +17695,7 @@ public:
 	float                                              HardnessPercent;                                  		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17710,7 +17710,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17726,7 +17726,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17745,7 +17745,7 @@ public:
 	unsigned long                                      UnMirrorV : 1;                                    		// 0x006C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17762,7 +17762,7 @@ public:
 	unsigned long                                      bDecompressNormalMap : 1;                         		// 0x0088 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17779,7 +17779,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17793,7 +17793,7 @@ class UMaterialExpressionFlipBookSample : public UMaterialExpressionTextureSampl
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17807,7 +17807,7 @@ class UMaterialExpressionMeshSubUV : public UMaterialExpressionTextureSample
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17821,7 +17821,7 @@ class UMaterialExpressionMeshSubUVBlend : public UMaterialExpressionMeshSubUV
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17835,7 +17835,7 @@ class UMaterialExpressionParticleSubUV : public UMaterialExpressionTextureSample
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17851,7 +17851,7 @@ public:
 	struct SFXName                                     ParameterName;                                    		// 0x009C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17865,7 +17865,7 @@ class UMaterialExpressionTextureSampleParameter2D : public UMaterialExpressionTe
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17881,7 +17881,7 @@ public:
 	unsigned char                                      Channel;                                          		// 0x00A8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17895,7 +17895,7 @@ class UMaterialExpressionTextureSampleParameterMeshSubUV : public UMaterialExpre
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17909,7 +17909,7 @@ class UMaterialExpressionTextureSampleParameterMeshSubUVBlend : public UMaterial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17923,7 +17923,7 @@ class UMaterialExpressionTextureSampleParameterSubUV : public UMaterialExpressio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17937,7 +17937,7 @@ class UMaterialExpressionTextureSampleParameterCube : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17951,7 +17951,7 @@ class UMaterialExpressionTextureSampleParameterMovie : public UMaterialExpressio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17966,7 +17966,7 @@ public:
 	FPointer                                           InstanceOverride;                                 		// 0x00A4 (0x0008) [0x0000000000003002]              ( CPF_Const | CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17981,7 +17981,7 @@ public:
 	unsigned long                                      bIgnorePause : 1;                                 		// 0x0060 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17998,7 +17998,7 @@ public:
 	unsigned char                                      TransformType;                                    		// 0x0081 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18014,7 +18014,7 @@ public:
 	unsigned char                                      TransformType;                                    		// 0x0080 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18028,7 +18028,7 @@ class UMaterialExpressionTwoSidedSign : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18042,7 +18042,7 @@ class UMaterialExpressionVertexColor : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18056,7 +18056,7 @@ class UMaterialExpressionWindDirectionAndSpeed : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18070,7 +18070,7 @@ class UMaterialExpressionWorldNormal : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18084,7 +18084,7 @@ class UMaterialExpressionWorldPosition : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18107,7 +18107,7 @@ public:
 	unsigned long                                      ReentrantFlag : 1;                                		// 0x00F4 (0x0004) [0x0000000000001002] [0x00000004] ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18135,7 +18135,7 @@ public:
 	TArray<struct FTextureParameterValue>              TextureParameterValues;                           		// 0x0128 (0x0010) [0x0000000000400003]              ( CPF_Edit | CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18155,7 +18155,7 @@ class UBioMaterialInstanceConstant : public UMaterialInstanceConstant
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18175,7 +18175,7 @@ public:
 	unsigned long                                      bAutoActivateAll : 1;                             		// 0x013C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18207,7 +18207,7 @@ public:
 	unsigned long                                      bAllowMultipleInstances : 1;                      		// 0x02B8 (0x0004) [0x0000008000000003] [0x00000001] ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18229,7 +18229,7 @@ public:
 	class UParticleSystem*                             ParticleTemplate;                                 		// 0x02A0 (0x0008) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18247,7 +18247,7 @@ class AParticleEventManager : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18314,7 +18314,7 @@ public:
 	unsigned char                                      ReplayState;                                      		// 0x0359 (0x0001) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18370,7 +18370,7 @@ class UDistributionFloatParticleParameter : public UDistributionFloatParameterBa
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18384,7 +18384,7 @@ class UDistributionVectorParticleParameter : public UDistributionVectorParameter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18398,7 +18398,7 @@ class UParticleDataManager : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18422,7 +18422,7 @@ public:
 	unsigned char                                      EmitterRenderMode;                                		// 0x0098 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18436,7 +18436,7 @@ class UParticleMeshEmitter : public UParticleEmitter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18450,7 +18450,7 @@ class UParticleSpriteEmitter : public UParticleEmitter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18464,7 +18464,7 @@ class UParticleSpriteSubUVEmitter : public UParticleSpriteEmitter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18478,7 +18478,7 @@ class UParticleEmitterInstance : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18492,7 +18492,7 @@ class UParticleBeam2EmitterInstance : public UParticleEmitterInstance
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18506,7 +18506,7 @@ class UParticleBeamEmitterInstance : public UParticleEmitterInstance
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18520,7 +18520,7 @@ class UParticleMeshEmitterInstance : public UParticleEmitterInstance
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18534,7 +18534,7 @@ class UParticleSpriteEmitterInstance : public UParticleEmitterInstance
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18548,7 +18548,7 @@ class UParticleSpriteSubUVEmitterInstance : public UParticleEmitterInstance
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18562,7 +18562,7 @@ class UParticleSpriteNxFluidEmitterInstance : public UParticleSpriteSubUVEmitter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18576,7 +18576,7 @@ class UParticleTrail2EmitterInstance : public UParticleEmitterInstance
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18590,7 +18590,7 @@ class UParticleTrailEmitterInstance : public UParticleEmitterInstance
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18619,7 +18619,7 @@ public:
 	unsigned long                                      ConvertedModules : 1;                             		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18644,7 +18644,7 @@ public:
 	unsigned char                                      LODValidity;                                      		// 0x0064 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18659,7 +18659,7 @@ public:
 	unsigned long                                      bAlwaysInWorldSpace : 1;                          		// 0x0068 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18675,7 +18675,7 @@ public:
 	unsigned long                                      bApplyOwnerScale : 1;                             		// 0x0098 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18690,7 +18690,7 @@ public:
 	struct FBioRawDistributionRwVector3                AccelOverLifeRw;                                  		// 0x006C (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18704,7 +18704,7 @@ class UParticleModuleAttractorBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18722,7 +18722,7 @@ public:
 	struct FVector                                     EndPoint1;                                        		// 0x00BC (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18745,7 +18745,7 @@ public:
 	unsigned char                                      SelectionMethod;                                  		// 0x00C0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18766,7 +18766,7 @@ public:
 	unsigned long                                      bUseWorldSpacePosition : 1;                       		// 0x00DC (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18780,7 +18780,7 @@ class UParticleModuleBeamBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18802,7 +18802,7 @@ public:
 	unsigned char                                      ModifierType;                                     		// 0x00F4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18836,7 +18836,7 @@ public:
 	unsigned long                                      bApplyNoiseScale : 1;                             		// 0x0148 (0x0004) [0x0000000000000001] [0x00000080] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18860,7 +18860,7 @@ public:
 	unsigned char                                      SourceTangentMethod;                              		// 0x00F1 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18885,7 +18885,7 @@ public:
 	unsigned char                                      TargetTangentMethod;                              		// 0x00F5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18899,7 +18899,7 @@ class UParticleModuleCollisionBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18926,7 +18926,7 @@ public:
 	unsigned char                                      CollisionCompletionOption;                        		// 0x0138 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18940,7 +18940,7 @@ class UParticleModuleColorBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18957,7 +18957,7 @@ public:
 	unsigned long                                      bClampAlpha : 1;                                  		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18973,7 +18973,7 @@ public:
 	struct FColor                                      DefaultColor;                                     		// 0x0070 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18990,7 +18990,7 @@ public:
 	unsigned long                                      bClampAlpha : 1;                                  		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19007,7 +19007,7 @@ public:
 	unsigned long                                      bEmitterTime : 1;                                 		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19021,7 +19021,7 @@ class UParticleModuleEventBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19036,7 +19036,7 @@ public:
 	TArray<struct FParticleEvent_GenerateInfo>         Events;                                           		// 0x0068 (0x0010) [0x0000000002400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19052,7 +19052,7 @@ public:
 	unsigned char                                      EventGeneratorType;                               		// 0x0070 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19067,7 +19067,7 @@ public:
 	unsigned long                                      bStopSpawning : 1;                                		// 0x0074 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19086,7 +19086,7 @@ public:
 	unsigned long                                      bInheritVelocity : 1;                             		// 0x00C4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19100,7 +19100,7 @@ class UParticleModuleKillBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19118,7 +19118,7 @@ public:
 	unsigned long                                      bKillInside : 1;                                  		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19135,7 +19135,7 @@ public:
 	unsigned long                                      bFloor : 1;                                       		// 0x008C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19149,7 +19149,7 @@ class UParticleModuleLifetimeBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19164,7 +19164,7 @@ public:
 	struct FRawDistributionFloat                       Lifetime;                                         		// 0x0068 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19181,7 +19181,7 @@ public:
 	unsigned long                                      m_bUpdateSeed : 1;                                		// 0x0070 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19196,7 +19196,7 @@ public:
 	struct FBioRawDistributionRwVector3                StartLocationRw;                                  		// 0x0074 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19214,7 +19214,7 @@ public:
 	struct FBioRawDistributionRwVector3                DirectionRw;                                      		// 0x00F8 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19234,7 +19234,7 @@ public:
 	unsigned char                                      SelectionMethod;                                  		// 0x0088 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19249,7 +19249,7 @@ public:
 	struct SFXName                                     EmitterName;                                      		// 0x0074 (0x0008) [0x0000000002000009]              ( CPF_Edit | CPF_ExportObject | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19273,7 +19273,7 @@ public:
 	unsigned long                                      Velocity : 1;                                     		// 0x00C4 (0x0004) [0x0000000000000001] [0x00000080] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19291,7 +19291,7 @@ public:
 	unsigned char                                      HeightAxis;                                       		// 0x0114 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19306,7 +19306,7 @@ public:
 	struct FRawDistributionFloat                       StartRadius;                                      		// 0x00C8 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19321,7 +19321,7 @@ public:
 	struct FBioRawDistributionRwVector3                SourceMovementScaleRw;                            		// 0x0074 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19335,7 +19335,7 @@ class UParticleModuleMaterialBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19351,7 +19351,7 @@ public:
 	TArray<class UMaterialInterface*>                  DefaultMaterials;                                 		// 0x0078 (0x0010) [0x0000000000400041]              ( CPF_Edit | CPF_EditConstArray | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19366,7 +19366,7 @@ public:
 	TArray<class UMaterialInterface*>                  MeshMaterials;                                    		// 0x0068 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19381,7 +19381,7 @@ public:
 	unsigned long                                      bUseEmitterTime : 1;                              		// 0x0068 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19402,7 +19402,7 @@ public:
 	unsigned char                                      ChainMode;                                        		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19416,7 +19416,7 @@ class UParticleModuleOrientationBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19431,7 +19431,7 @@ public:
 	unsigned char                                      LockAxisFlags;                                    		// 0x0068 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19445,7 +19445,7 @@ class UParticleModuleParameterBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19460,7 +19460,7 @@ public:
 	TArray<struct FEmitterDynamicParameter>            DynamicParams;                                    		// 0x0068 (0x0010) [0x0000000000480041]              ( CPF_Edit | CPF_EditConstArray | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19506,7 +19506,7 @@ public:
 	unsigned char                                      EmitterNormalsMode;                               		// 0x00F0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19520,7 +19520,7 @@ class UParticleModuleRotationBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19536,7 +19536,7 @@ public:
 	unsigned long                                      bInheritParent : 1;                               		// 0x0094 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19551,7 +19551,7 @@ public:
 	struct FRawDistributionFloat                       StartRotation;                                    		// 0x0068 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19567,7 +19567,7 @@ public:
 	unsigned long                                      Scale : 1;                                        		// 0x008C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19581,7 +19581,7 @@ class UParticleModuleRotationRateBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19596,7 +19596,7 @@ public:
 	struct FBioRawDistributionRwVector3                StartRotationRateRw;                              		// 0x0068 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19611,7 +19611,7 @@ public:
 	struct FBioRawDistributionRwVector3                LifeMultiplierRw;                                 		// 0x0068 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19626,7 +19626,7 @@ public:
 	struct FRawDistributionFloat                       StartRotationRate;                                		// 0x0068 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19641,7 +19641,7 @@ public:
 	struct FRawDistributionFloat                       LifeMultiplier;                                   		// 0x0068 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19655,7 +19655,7 @@ class UParticleModuleSizeBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19670,7 +19670,7 @@ public:
 	struct FBioRawDistributionRwVector3                StartSizeRw;                                      		// 0x0068 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19688,7 +19688,7 @@ public:
 	unsigned long                                      MultiplyZ : 1;                                    		// 0x0094 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19706,7 +19706,7 @@ public:
 	unsigned long                                      MultiplyZ : 1;                                    		// 0x0094 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19724,7 +19724,7 @@ public:
 	unsigned long                                      EnableZ : 1;                                      		// 0x0094 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19742,7 +19742,7 @@ public:
 	unsigned long                                      bEnableZ : 1;                                     		// 0x0094 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19758,7 +19758,7 @@ public:
 	unsigned long                                      bProcessBurstList : 1;                            		// 0x0068 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19776,7 +19776,7 @@ public:
 	unsigned char                                      ParticleBurstMethod;                              		// 0x00C4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19794,7 +19794,7 @@ public:
 	unsigned long                                      bIgnoreSpawnRateWhenMoving : 1;                   		// 0x0098 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19808,7 +19808,7 @@ class UParticleModuleStoreSpawnTimeBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19822,7 +19822,7 @@ class UParticleModuleStoreSpawnTime : public UParticleModuleStoreSpawnTimeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19836,7 +19836,7 @@ class UParticleModuleSubUVBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19851,7 +19851,7 @@ public:
 	struct FRawDistributionFloat                       SubImageIndex;                                    		// 0x0068 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19868,7 +19868,7 @@ public:
 	unsigned long                                      bUseEmitterTime : 1;                              		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19884,7 +19884,7 @@ public:
 	struct FBioRawDistributionRwVector3                SubUVSizeRw;                                      		// 0x0094 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19899,7 +19899,7 @@ public:
 	struct FBioRawDistributionRwVector3                SubImageSelectRw;                                 		// 0x0068 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19913,7 +19913,7 @@ class UParticleModuleTrailBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19935,7 +19935,7 @@ public:
 	unsigned char                                      SelectionMethod;                                  		// 0x00AD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19951,7 +19951,7 @@ public:
 	float                                              MinSpawnVelocity;                                 		// 0x0070 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19967,7 +19967,7 @@ public:
 	unsigned char                                      TaperMethod;                                      		// 0x008C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19981,7 +19981,7 @@ class UParticleModuleTypeDataBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20008,7 +20008,7 @@ public:
 	unsigned long                                      bRenderTessellation : 1;                          		// 0x0080 (0x0004) [0x0000000000000001] [0x00000080] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20035,7 +20035,7 @@ public:
 	unsigned char                                      EndPointMethod;                                   		// 0x0139 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20067,7 +20067,7 @@ public:
 	unsigned char                                      TaperMethod;                                      		// 0x00FD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20093,7 +20093,7 @@ public:
 	unsigned char                                      CameraFacingOption;                               		// 0x0082 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20112,7 +20112,7 @@ public:
 	unsigned char                                      PhysXRotationMethod;                              		// 0x00A8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20156,7 +20156,7 @@ public:
 	unsigned char                                      EmitterShape;                                     		// 0x00D2 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20172,7 +20172,7 @@ public:
 	class UPhysXParticleSystem*                        PhysXParSys;                                      		// 0x0078 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20203,7 +20203,7 @@ public:
 	unsigned char                                      RenderAxis;                                       		// 0x008C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20225,7 +20225,7 @@ public:
 	unsigned long                                      SpawnByDistance : 1;                              		// 0x009C (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20251,7 +20251,7 @@ public:
 	unsigned long                                      RenderTessellation : 1;                           		// 0x0084 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20266,7 +20266,7 @@ public:
 	TArray<struct SFXName>                             RequiredModules;                                  		// 0x0068 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20286,7 +20286,7 @@ public:
 	struct FRawDistributionFloat                       AlphaOverLife;                                    		// 0x012C (0x0024) [0x0000000002480009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_NeedCtorLink | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20307,7 +20307,7 @@ public:
 	struct FRawDistributionVector                      StartLocation;                                    		// 0x0150 (0x0024) [0x0000000002480009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_NeedCtorLink | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20334,7 +20334,7 @@ public:
 	unsigned long                                      SizeMultiplyZ : 1;                                		// 0x01E0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20375,7 +20375,7 @@ public:
 	unsigned char                                      PC_HeightAxis;                                    		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20414,7 +20414,7 @@ public:
 	unsigned char                                      PC_HeightAxis;                                    		// 0x01E4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20438,7 +20438,7 @@ public:
 	unsigned long                                      MultiplyZ : 1;                                    		// 0x0150 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20461,7 +20461,7 @@ public:
 	unsigned long                                      MultiplyZ : 1;                                    		// 0x0150 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20476,7 +20476,7 @@ public:
 	unsigned long                                      bInWorldSpace : 1;                                		// 0x0068 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20492,7 +20492,7 @@ public:
 	struct FRawDistributionFloat                       StartVelocityRadial;                              		// 0x0098 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20507,7 +20507,7 @@ public:
 	struct FBioRawDistributionRwVector3                ScaleRw;                                          		// 0x006C (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20523,7 +20523,7 @@ public:
 	unsigned long                                      Absolute : 1;                                     		// 0x0098 (0x0004) [0x0000000000000009] [0x00000001] ( CPF_Edit | CPF_ExportObject )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20537,7 +20537,7 @@ class UParticleModuleEventSendToGame : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20587,7 +20587,7 @@ public:
 	unsigned char                                      OcclusionBoundsMethod;                            		// 0x0146 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20608,7 +20608,7 @@ public:
 	int                                                ClipIDNumber;                                     		// 0x0070 (0x0004) [0x0000000000001001]              ( CPF_Edit | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20650,7 +20650,7 @@ public:
 	unsigned char                                      PacketSizeMultiplier;                             		// 0x00BE (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20690,7 +20690,7 @@ public:
 	unsigned long                                      bDisableClientSidePawnInteractions : 1;           		// 0x03A4 (0x0004) [0x0000000000000000] [0x00000080] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20720,7 +20720,7 @@ public:
 	float                                              MaxImpulseSpeed;                                  		// 0x03B0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20744,7 +20744,7 @@ public:
 	unsigned long                                      bScalingToZero : 1;                               		// 0x03A8 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20768,7 +20768,7 @@ public:
 	unsigned long                                      bBlockPawns : 1;                                  		// 0x029C (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21017,7 +21017,7 @@ public:
 	unsigned char                                      PreStasisPhysicsState;                            		// 0x064C (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21314,7 +21314,7 @@ public:
 	unsigned char                                      StuckCount;                                       		// 0x06C0 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21427,7 +21427,7 @@ public:
 	unsigned long                                      bHoldingDownHandbrake : 1;                        		// 0x080C (0x0004) [0x0000000000000000] [0x00000800] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21478,7 +21478,7 @@ public:
 	unsigned long                                      bUpdateActor2RefFrame : 1;                        		// 0x02B4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21505,7 +21505,7 @@ public:
 	unsigned char                                      ImpulseCount;                                     		// 0x0298 (0x0001) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21525,7 +21525,7 @@ public:
 	unsigned char                                      ImpulseCount;                                     		// 0x0294 (0x0001) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21543,7 +21543,7 @@ public:
 	unsigned long                                      bThrustEnabled : 1;                               		// 0x0288 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21559,7 +21559,7 @@ public:
 	class UMaterialInterface*                          LimitMaterial;                                    		// 0x0220 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21578,7 +21578,7 @@ public:
 	unsigned char                                      ImpulseFalloff;                                   		// 0x0234 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21610,7 +21610,7 @@ public:
 	unsigned long                                      bInterpolating : 1;                               		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21647,7 +21647,7 @@ public:
 	unsigned long                                      bEnableForceMassRatio : 1;                        		// 0x00E4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21676,7 +21676,7 @@ public:
 	unsigned long                                      bWheelSpeedOverride : 1;                          		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21701,7 +21701,7 @@ public:
 	unsigned long                                      bIsDriving : 1;                                   		// 0x00F4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21724,7 +21724,7 @@ public:
 	float                                              EngineRPM;                                        		// 0x0148 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21747,7 +21747,7 @@ public:
 	float                                              TurnInPlaceThrottle;                              		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21790,7 +21790,7 @@ public:
 	unsigned long                                      m_bIgnoreSelfCollisions : 1;                      		// 0x00F4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21808,7 +21808,7 @@ class UPhysicalMaterialPropertyBase : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21827,7 +21827,7 @@ public:
 	class UPhysicsAssetInstance*                       DefaultInstance;                                  		// 0x00D8 (0x0008) [0x000000000440000A]              ( CPF_Const | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21855,7 +21855,7 @@ public:
 	unsigned long                                      bHasFixedBody : 1;                                		// 0x00EC (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21888,7 +21888,7 @@ public:
 	float                                              DebrisLifetime;                                   		// 0x0064 (0x0004) [0x0000000000005000]              ( CPF_Native | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21903,7 +21903,7 @@ public:
 	int                                                ParticlePercentage;                               		// 0x0060 (0x0004) [0x0000000000005000]              ( CPF_Native | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21948,7 +21948,7 @@ public:
 	unsigned long                                      bInstanceAlwaysFullAnimWeight : 1;                		// 0x00D4 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22010,7 +22010,7 @@ public:
 	FPointer                                           DummyKinActor;                                    		// 0x00D8 (0x0008) [0x0800000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22077,7 +22077,7 @@ public:
 	unsigned long                                      bMaintainMinDistance : 1;                         		// 0x0120 (0x0004) [0x0000000000000001] [0x00000200] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22091,7 +22091,7 @@ class URB_BSJointSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22105,7 +22105,7 @@ class URB_DistanceJointSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22119,7 +22119,7 @@ class URB_HingeSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22133,7 +22133,7 @@ class URB_PrismaticSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22147,7 +22147,7 @@ class URB_PulleyJointSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22161,7 +22161,7 @@ class URB_SkelJointSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22175,7 +22175,7 @@ class URB_StayUprightSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22232,7 +22232,7 @@ public:
 	unsigned char                                      Side;                                             		// 0x014C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22268,7 +22268,7 @@ public:
 	unsigned char                                      Coordinates;                                      		// 0x03A1 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22285,7 +22285,7 @@ public:
 	int                                                ForceFieldChannel;                                		// 0x02C4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22309,7 +22309,7 @@ public:
 	unsigned char                                      RBChannel;                                        		// 0x02D4 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22336,7 +22336,7 @@ public:
 	unsigned long                                      UseSpecialRadialForce : 1;                        		// 0x0304 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22351,7 +22351,7 @@ public:
 	class UDrawCapsuleComponent*                       RenderComponent;                                  		// 0x0308 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22386,7 +22386,7 @@ public:
 	unsigned char                                      Coordinates;                                      		// 0x0390 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22408,7 +22408,7 @@ public:
 	unsigned char                                      ForceFalloff;                                     		// 0x02FC (0x0001) [0x0000000000080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22437,7 +22437,7 @@ public:
 	unsigned long                                      BSpecialRadialForceMode : 1;                      		// 0x0318 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22467,7 +22467,7 @@ public:
 	unsigned char                                      Coordinates;                                      		// 0x0374 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22483,7 +22483,7 @@ public:
 	class UDrawBoxComponent*                           RenderComponent;                                  		// 0x0384 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22501,7 +22501,7 @@ public:
 	float                                              CapsuleRadius;                                    		// 0x0384 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22520,7 +22520,7 @@ public:
 	unsigned char                                      ForceFalloff;                                     		// 0x02F0 (0x0001) [0x0000000000080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22536,7 +22536,7 @@ public:
 	float                                              SelfRotationStrength;                             		// 0x02FC (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22562,7 +22562,7 @@ public:
 	unsigned long                                      BSpecialRadialForceMode : 1;                      		// 0x0308 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22577,7 +22577,7 @@ public:
 	class UDrawCapsuleComponent*                       RenderComponent;                                  		// 0x030C (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22602,7 +22602,7 @@ public:
 	unsigned long                                      BSpecialRadialForceMode : 1;                      		// 0x0304 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22617,7 +22617,7 @@ public:
 	class UDrawCapsuleComponent*                       RenderComponent;                                  		// 0x0308 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22647,7 +22647,7 @@ public:
 	unsigned long                                      bForceApplyToProjectiles : 1;                     		// 0x02B4 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22675,7 +22675,7 @@ public:
 	unsigned char                                      RadialForceMode;                                  		// 0x02A5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22690,7 +22690,7 @@ class UForceFieldShape : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22710,7 +22710,7 @@ public:
 	class UDrawBoxComponent*                           Shape;                                            		// 0x0060 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22731,7 +22731,7 @@ public:
 	class UDrawCapsuleComponent*                       Shape;                                            		// 0x0060 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22753,7 +22753,7 @@ public:
 	class UDrawSphereComponent*                        Shape;                                            		// 0x0060 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22784,7 +22784,7 @@ public:
 	int                                                PI_LicenseePackageVersion;                        		// 0x036C (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22802,7 +22802,7 @@ public:
 	int                                                PrefabVersion;                                    		// 0x0088 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22823,7 +22823,7 @@ public:
 	unsigned long                                      bOutputObjCommentToScreen : 1;                    		// 0x0084 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22844,7 +22844,7 @@ class USequenceFrame : public USequenceObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22859,7 +22859,7 @@ class USequenceFrameWrapped : public USequenceFrame
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22885,7 +22885,7 @@ public:
 	unsigned char                                      GamepadID;                                        		// 0x00D8 (0x0001) [0x0000000001002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22949,7 +22949,7 @@ public:
 	unsigned long                                      m_bBioForceReUpdate : 1;                          		// 0x0190 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22970,7 +22970,7 @@ public:
 	class APrefabInstance*                             OwnerPrefab;                                      		// 0x0194 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22986,7 +22986,7 @@ class UPrefabSequenceContainer : public USequence
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23003,7 +23003,7 @@ public:
 	class UPackage*                                    oDependentPackage;                                		// 0x01A4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23020,7 +23020,7 @@ public:
 	unsigned long                                      bCallHandler : 1;                                 		// 0x00F4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23034,7 +23034,7 @@ class UBioSeqAct_BlockForTextureStreaming : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23050,7 +23050,7 @@ public:
 	float                                              m_fRange;                                         		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23070,7 +23070,7 @@ public:
 	unsigned char                                      m_eEventType;                                     		// 0x0124 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23088,7 +23088,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x0118 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23106,7 +23106,7 @@ public:
 	unsigned long                                      bOpen : 1;                                        		// 0x0118 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23122,7 +23122,7 @@ public:
 	class USoundNode*                                  ApplyNode;                                        		// 0x0100 (0x0008) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23137,7 +23137,7 @@ public:
 	unsigned long                                      bPreferController : 1;                            		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23157,7 +23157,7 @@ public:
 	unsigned long                                      bPersistFade : 1;                                 		// 0x0118 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23190,7 +23190,7 @@ public:
 	unsigned long                                      bCheckLineOfSight : 1;                            		// 0x012C (0x0004) [0x0000000000000001] [0x00000400] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23215,7 +23215,7 @@ public:
 	unsigned char                                      PlaySpace;                                        		// 0x011C (0x0001) [0x0000008000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23234,7 +23234,7 @@ public:
 	float                                              DamageAmount;                                     		// 0x010C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23253,7 +23253,7 @@ public:
 	unsigned char                                      CollisionType;                                    		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23268,7 +23268,7 @@ class USeqAct_CommitMapChange : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23285,7 +23285,7 @@ public:
 	unsigned long                                      bIncludeVarComment : 1;                           		// 0x010C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23305,7 +23305,7 @@ public:
 	float                                              AdjustVolumeLevel;                                		// 0x0114 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23325,7 +23325,7 @@ public:
 	unsigned long                                      bDisplayOnObject : 1;                             		// 0x012C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23341,7 +23341,7 @@ public:
 	FString                                            OutputLabel;                                      		// 0x00F8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23358,7 +23358,7 @@ public:
 	unsigned long                                      bOpen : 1;                                        		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23374,7 +23374,7 @@ public:
 	float                                              Distance;                                         		// 0x00F8 (0x0004) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23391,7 +23391,7 @@ public:
 	struct SFXName                                     SocketOrBoneName;                                 		// 0x0110 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23407,7 +23407,7 @@ public:
 	struct SFXName                                     PropertyName;                                     		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23425,7 +23425,7 @@ public:
 	float                                              Z;                                                		// 0x010C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23441,7 +23441,7 @@ public:
 	float                                              VelocityMag;                                      		// 0x0104 (0x0004) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23458,7 +23458,7 @@ public:
 	unsigned long                                      bObjectFound : 1;                                 		// 0x00F8 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23476,7 +23476,7 @@ public:
 	unsigned long                                      bCancelled : 1;                                   		// 0x0108 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23498,7 +23498,7 @@ public:
 	unsigned long                                      bPickClosest : 1;                                 		// 0x012C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23529,7 +23529,7 @@ public:
 	unsigned char                                      PointSelection;                                   		// 0x0170 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23544,7 +23544,7 @@ class USeqAct_ActorFactoryEx : public USeqAct_ActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23564,7 +23564,7 @@ public:
 	unsigned long                                      bStartWillRestart : 1;                            		// 0x011C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23585,7 +23585,7 @@ public:
 	float                                              NextLinkTime;                                     		// 0x0118 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23599,7 +23599,7 @@ class USeqAct_ForceGarbageCollection : public USeqAct_Latent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23617,7 +23617,7 @@ public:
 	float                                              RemainingTime;                                    		// 0x0130 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23677,7 +23677,7 @@ public:
 	unsigned char                                      PrimePhase;                                       		// 0x01D4 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23703,7 +23703,7 @@ public:
 	unsigned long                                      bNeverAutoStreamOut : 1;                          		// 0x010C (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23720,7 +23720,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x0120 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23737,7 +23737,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x0120 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23754,7 +23754,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x011C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23777,7 +23777,7 @@ public:
 	unsigned long                                      bStopped : 1;                                     		// 0x012C (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23796,7 +23796,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x0124 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23830,7 +23830,7 @@ public:
 	float                                              OldFocusDistance;                                 		// 0x0168 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23848,7 +23848,7 @@ public:
 	float                                              OldMotionBlurAmount;                              		// 0x0118 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23869,7 +23869,7 @@ public:
 	unsigned long                                      bStreamingActive : 1;                             		// 0x013C (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23887,7 +23887,7 @@ public:
 	unsigned long                                      bShouldBlockOnLoad : 1;                           		// 0x011C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23905,7 +23905,7 @@ public:
 	unsigned long                                      bIncludeObjComment : 1;                           		// 0x0108 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23924,7 +23924,7 @@ public:
 	unsigned char                                      ManualCoverType;                                  		// 0x010C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23946,7 +23946,7 @@ public:
 	unsigned long                                      bFalloff : 1;                                     		// 0x0114 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23961,7 +23961,7 @@ class USeqAct_Nuke : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23985,7 +23985,7 @@ public:
 	unsigned long                                      bUseEmitterLocation : 1;                          		// 0x015C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24009,7 +24009,7 @@ public:
 	unsigned char                                      PlaySpace;                                        		// 0x011C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24029,7 +24029,7 @@ public:
 	class USoundCue*                                   SoundCueToPlay;                                   		// 0x0120 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24044,7 +24044,7 @@ public:
 	struct FMusicTrackStruct                           MusicTrack;                                       		// 0x00F8 (0x0024) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24061,7 +24061,7 @@ public:
 	unsigned long                                      bTryToLeaveVehicle : 1;                           		// 0x0100 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24076,7 +24076,7 @@ public:
 	TArray<struct FSwitchRange>                        Ranges;                                           		// 0x00F8 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24090,7 +24090,7 @@ class USeqAct_SetBlockRigidBody : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24106,7 +24106,7 @@ public:
 	class AActor*                                      CameraTarget;                                     		// 0x0104 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24124,7 +24124,7 @@ public:
 	float                                              ScalarValue;                                      		// 0x0108 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24141,7 +24141,7 @@ public:
 	struct SFXName                                     ParamName;                                        		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24158,7 +24158,7 @@ public:
 	struct SFXName                                     ParamName;                                        		// 0x0110 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24175,7 +24175,7 @@ public:
 	int                                                MaterialIndex;                                    		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24194,7 +24194,7 @@ public:
 	unsigned char                                      MeshType;                                         		// 0x010C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24209,7 +24209,7 @@ public:
 	struct SFXName                                     TrackBankName;                                    		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24224,7 +24224,7 @@ public:
 	unsigned char                                      newPhysics;                                       		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24238,7 +24238,7 @@ class USeqAct_SetRigidBodyIgnoreVehicles : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24252,7 +24252,7 @@ class USeqAct_SetSequenceVariable : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24269,7 +24269,7 @@ public:
 	int                                                ObjectIndex;                                      		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24287,7 +24287,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24305,7 +24305,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24321,7 +24321,7 @@ public:
 	float                                              FloatResult;                                      		// 0x00FC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24338,7 +24338,7 @@ public:
 	unsigned long                                      bTruncate : 1;                                    		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24356,7 +24356,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24374,7 +24374,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24389,7 +24389,7 @@ public:
 	int                                                ListEntriesCount;                                 		// 0x00F8 (0x0004) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24407,7 +24407,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24425,7 +24425,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24441,7 +24441,7 @@ public:
 	unsigned long                                      DefaultValue : 1;                                 		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24458,7 +24458,7 @@ public:
 	float                                              Target;                                           		// 0x0108 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24476,7 +24476,7 @@ public:
 	unsigned long                                      bIsUpdated : 1;                                   		// 0x010C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24496,7 +24496,7 @@ public:
 	unsigned long                                      bSetRotation : 1;                                 		// 0x0118 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24513,7 +24513,7 @@ public:
 	class UObject*                                     Value;                                            		// 0x0100 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24530,7 +24530,7 @@ public:
 	FString                                            Value;                                            		// 0x0108 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24549,7 +24549,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24567,7 +24567,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24585,7 +24585,7 @@ public:
 	float                                              Z;                                                		// 0x010C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24604,7 +24604,7 @@ public:
 	unsigned long                                      bAutoDisableLinks : 1;                            		// 0x0110 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24620,7 +24620,7 @@ public:
 	TArray<int>                                        AutoDisabledIndices;                              		// 0x0114 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24636,7 +24636,7 @@ public:
 	float                                              Time;                                             		// 0x00FC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24651,7 +24651,7 @@ class USeqAct_Toggle : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24666,7 +24666,7 @@ class USeqAct_ToggleDynamicChannel : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24681,7 +24681,7 @@ public:
 	unsigned long                                      bLevelStartupEventForceOff : 1;                   		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24706,7 +24706,7 @@ public:
 	unsigned long                                      bTraceWorld : 1;                                  		// 0x0134 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24721,7 +24721,7 @@ class USequenceCondition : public USequenceOp
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24736,7 +24736,7 @@ class USeqCond_CompareBool : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24752,7 +24752,7 @@ public:
 	float                                              ValueB;                                           		// 0x00E0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24768,7 +24768,7 @@ public:
 	int                                                ValueB;                                           		// 0x00E0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24784,7 +24784,7 @@ public:
 	struct SFXName                                     ValueB;                                           		// 0x00E4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24798,7 +24798,7 @@ class USeqCond_CompareObject : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24814,7 +24814,7 @@ public:
 	FString                                            ValueB;                                           		// 0x00EC (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24828,7 +24828,7 @@ class USeqCond_GetServerType : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24846,7 +24846,7 @@ public:
 	int                                                ValueB;                                           		// 0x00E4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24863,7 +24863,7 @@ public:
 	float                                              ValueB;                                           		// 0x00E4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24877,7 +24877,7 @@ class USeqCond_IsAlive : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24891,7 +24891,7 @@ class USeqCond_IsConsole : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24905,7 +24905,7 @@ class USeqCond_IsInCombat : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24920,7 +24920,7 @@ public:
 	int                                                NumNeededLoggedIn;                                		// 0x00DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24935,7 +24935,7 @@ class USeqCond_IsSameTeam : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24949,7 +24949,7 @@ class USeqCond_SwitchBase : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24968,7 +24968,7 @@ public:
 	TArray<struct FSwitchClassInfo>                    ClassArray;                                       		// 0x00DC (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24988,7 +24988,7 @@ public:
 	class UClass*                                      MetaClass;                                        		// 0x00EC (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25006,7 +25006,7 @@ class USeqCond_SwitchPlatform : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25036,7 +25036,7 @@ public:
 	unsigned char                                      WhoTriggers;                                      		// 0x0125 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25055,7 +25055,7 @@ class UBioSeqEvt_DisengagedCover : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25069,7 +25069,7 @@ class UBioSeqEvt_EngagedCover : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25083,7 +25083,7 @@ class UBioSeqEvt_HearNoise : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25097,7 +25097,7 @@ class UBioSeqEvt_LoadingScreenClosed : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25111,7 +25111,7 @@ class UBioSeqEvt_ProximityAlarm : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25127,7 +25127,7 @@ public:
 	float                                              MaxSightDistance;                                 		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25142,7 +25142,7 @@ public:
 	struct SFXName                                     NotifyName;                                       		// 0x0128 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25158,7 +25158,7 @@ public:
 	struct SFXName                                     ConsoleEventName;                                 		// 0x0138 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25172,7 +25172,7 @@ class USeqEvent_ConstraintBroken : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25186,7 +25186,7 @@ class USeqEvent_Destroyed : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25200,7 +25200,7 @@ class USeqEvent_GetInventory : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25214,7 +25214,7 @@ class USeqEvent_LevelBeginning : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25228,7 +25228,7 @@ class USeqEvent_LevelLoaded : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25243,7 +25243,7 @@ class USeqEvent_LevelStartup : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25258,7 +25258,7 @@ public:
 	float                                              StayOpenTime;                                     		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25284,7 +25284,7 @@ public:
 	unsigned char                                      EventType;                                        		// 0x0158 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25300,7 +25300,7 @@ public:
 	float                                              MaxDistance;                                      		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25317,7 +25317,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x0140 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25334,7 +25334,7 @@ public:
 	float                                              MinCollisionVelocity;                             		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25348,7 +25348,7 @@ class USeqEvent_SeeDeath : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25363,7 +25363,7 @@ public:
 	FString                                            InputLabel;                                       		// 0x0128 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25385,7 +25385,7 @@ public:
 	unsigned long                                      bResetDamageOnToggle : 1;                         		// 0x0168 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25411,7 +25411,7 @@ public:
 	unsigned long                                      bAllowDeadPawns : 1;                              		// 0x0158 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25436,7 +25436,7 @@ public:
 	unsigned long                                      bAimToInteract : 1;                               		// 0x0164 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25453,7 +25453,7 @@ public:
 	struct SFXName                                     VarName;                                          		// 0x0088 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25469,7 +25469,7 @@ public:
 	int                                                m_srValue;                                        		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25484,7 +25484,7 @@ public:
 	int                                                m_srStringID;                                     		// 0x0094 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25507,7 +25507,7 @@ public:
 	unsigned long                                      bShouldBakeAndPrune : 1;                          		// 0x00CC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25522,7 +25522,7 @@ public:
 	int                                                bValue;                                           		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25538,7 +25538,7 @@ public:
 	class UClass*                                      ExpectedType;                                     		// 0x00A0 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25553,7 +25553,7 @@ public:
 	float                                              FloatValue;                                       		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25569,7 +25569,7 @@ public:
 	float                                              Max;                                              		// 0x0098 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25584,7 +25584,7 @@ public:
 	int                                                IntValue;                                         		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25600,7 +25600,7 @@ public:
 	int                                                Max;                                              		// 0x0098 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25615,7 +25615,7 @@ public:
 	struct SFXName                                     NameValue;                                        		// 0x0090 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25632,7 +25632,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x00A0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25646,7 +25646,7 @@ class USeqVar_ScopedNamed : public USeqVar_Named
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25663,7 +25663,7 @@ public:
 	class UObject*                                     ObjValue;                                         		// 0x00AC (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25680,7 +25680,7 @@ public:
 	class UClass*                                      PawnClass;                                        		// 0x00B4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25697,7 +25697,7 @@ public:
 	unsigned long                                      bCachedList : 1;                                  		// 0x00CC (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25712,7 +25712,7 @@ public:
 	struct FMusicTrackStruct                           MusicTrack;                                       		// 0x00B4 (0x0024) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25727,7 +25727,7 @@ public:
 	TArray<struct FMusicTrackStruct>                   MusicTrackBank;                                   		// 0x00B4 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25742,7 +25742,7 @@ public:
 	TArray<class UObject*>                             ObjList;                                          		// 0x00B4 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25762,7 +25762,7 @@ public:
 	unsigned long                                      bCollidingOnly : 1;                               		// 0x00D8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25781,7 +25781,7 @@ public:
 	unsigned long                                      bReturnPawns : 1;                                 		// 0x00D8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25798,7 +25798,7 @@ public:
 	FString                                            StrValue;                                         		// 0x0090 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25818,7 +25818,7 @@ public:
 	float                                              FloatValue;                                       		// 0x00C0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25833,7 +25833,7 @@ public:
 	struct FVector                                     VectValue;                                        		// 0x0090 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25852,7 +25852,7 @@ public:
 	unsigned long                                      bIsPlaying : 1;                                   		// 0x0294 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25866,7 +25866,7 @@ class AAmbientSoundMovable : public AAmbientSound
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25883,7 +25883,7 @@ public:
 	class USoundNodeAmbient*                           SoundNodeInstance;                                		// 0x02A8 (0x0008) [0x000000000440000A]              ( CPF_Const | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25897,7 +25897,7 @@ class AAmbientSoundNonLoop : public AAmbientSoundSimple
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25917,7 +25917,7 @@ public:
 	unsigned long                                      bFadeOnToggle : 1;                                		// 0x02C0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25938,7 +25938,7 @@ class UDistributionFloatSoundParameter : public UDistributionFloatParameterBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25960,7 +25960,7 @@ public:
 	unsigned char                                      DistanceModel;                                    		// 0x0130 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25976,7 +25976,7 @@ public:
 	TArray<struct FAmbientSoundSlot>                   SoundSlots;                                       		// 0x0158 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25995,7 +25995,7 @@ public:
 	unsigned char                                      DistanceModel;                                    		// 0x00E0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26010,7 +26010,7 @@ public:
 	TArray<float>                                      InputVolume;                                      		// 0x0094 (0x0010) [0x0000000000400049]              ( CPF_Edit | CPF_ExportObject | CPF_EditConstArray | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26025,7 +26025,7 @@ public:
 	struct FRawDistributionFloat                       DelayDuration;                                    		// 0x0094 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26040,7 +26040,7 @@ public:
 	TArray<struct FDistanceDatum>                      CrossFadeInput;                                   		// 0x0094 (0x0010) [0x0000000000480049]              ( CPF_Edit | CPF_ExportObject | CPF_EditConstArray | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26056,7 +26056,7 @@ public:
 	unsigned long                                      bLoopIndefinitely : 1;                            		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26070,7 +26070,7 @@ class USoundNodeMature : public USoundNode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26085,7 +26085,7 @@ public:
 	TArray<float>                                      InputVolume;                                      		// 0x0094 (0x0010) [0x0000000000400049]              ( CPF_Edit | CPF_ExportObject | CPF_EditConstArray | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26101,7 +26101,7 @@ public:
 	struct FRawDistributionFloat                       PitchModulation;                                  		// 0x00B8 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26117,7 +26117,7 @@ public:
 	struct FRawDistributionFloat                       PitchModulation;                                  		// 0x00B8 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26137,7 +26137,7 @@ public:
 	unsigned long                                      bModulateVolume : 1;                              		// 0x0124 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26155,7 +26155,7 @@ public:
 	unsigned long                                      bRandomizeWithoutReplacement : 1;                 		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26170,7 +26170,7 @@ public:
 	TArray<unsigned char>                              QueuedAudio;                                      		// 0x01FC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26241,7 +26241,7 @@ public:
 	unsigned long                                      bShowWireframe : 1;                               		// 0x03D0 (0x0004) [0x0000000000000001] [0x00020000] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26281,7 +26281,7 @@ public:
 	unsigned long                                      bPhysicsMeshDirty : 1;                            		// 0x02EC (0x0004) [0x0000000000003000] [0x00000002] ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26297,7 +26297,7 @@ public:
 	class ATerrain*                                    ParentTerrain;                                    		// 0x01C4 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26312,7 +26312,7 @@ public:
 	TArray<struct FTerrainFilteredMaterial>            Materials;                                        		// 0x0060 (0x0010) [0x0000000000400003]              ( CPF_Edit | CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26338,7 +26338,7 @@ public:
 	unsigned char                                      MappingType;                                      		// 0x00D4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26352,7 +26352,7 @@ class UUIRoot : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26427,7 +26427,7 @@ public:
 	unsigned long                                      bSupports3DPrimitives : 1;                        		// 0x021C (0x0004) [0x0000000000000002] [0x00000080] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26598,7 +26598,7 @@ class UUIComponent : public UComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26616,7 +26616,7 @@ public:
 	class UUIEvent_ProcessInput*                       InputProcessor;                                   		// 0x0098 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26632,7 +26632,7 @@ class UUIEventContainer : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26655,7 +26655,7 @@ public:
 	TArray<struct FPlayerDataStoreGroup>               PlayerDataStores;                                 		// 0x00A0 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26683,7 +26683,7 @@ public:
 	struct FScriptDelegate                             __OnInitialize__Delegate;                         		// 0x0090 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26735,7 +26735,7 @@ public:
 	unsigned long                                      bIsRuntimeAutoCompleteUpToDate : 1;               		// 0x025C (0x0004) [0x0000000000002000] [0x00000040] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26776,7 +26776,7 @@ public:
 	unsigned char                                      CurrentEvent;                                     		// 0x0168 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26844,7 +26844,7 @@ public:
 	unsigned char                                      bYAxis;                                           		// 0x020A (0x0001) [0x0000000000000004]              ( CPF_Input )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26873,7 +26873,7 @@ class UPlayerManagerInteraction : public UInteraction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26915,7 +26915,7 @@ public:
 	unsigned long                                      bIsUIPrimitiveSceneInitialized : 1;               		// 0x0220 (0x0004) [0x0000000000002002] [0x00000010] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26954,7 +26954,7 @@ public:
 	TArray<struct FUIAxisEmulationDefinition>          AxisEmulationDefinitions;                         		// 0x0070 (0x0010) [0x0000000000404002]              ( CPF_Const | CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26970,7 +26970,7 @@ class UUILayerBase : public UUIRoot
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26997,7 +26997,7 @@ public:
 	unsigned long                                      bEnablePostProcess : 1;                           		// 0x0130 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27034,7 +27034,7 @@ public:
 	unsigned char                                      StackPriority;                                    		// 0x0099 (0x0001) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27059,7 +27059,7 @@ class UUIState_Disabled : public UUIState
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27075,7 +27075,7 @@ class UUIState_Enabled : public UUIState
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27092,7 +27092,7 @@ public:
 	struct FVector2D                                   StringExtent;                                     		// 0x010C (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27113,7 +27113,7 @@ public:
 	unsigned char                                      WriteAccessType;                                  		// 0x0080 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27145,7 +27145,7 @@ public:
 	struct SFXName                                     Tag;                                              		// 0x00A4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27176,7 +27176,7 @@ public:
 	unsigned char                                      UnknownData03[ 0x48 ];                            		// 0x01C4 (0x0048) UNKNOWN PROPERTY: MapProperty Engine.UISkin.SoundCueMap
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27210,7 +27210,7 @@ public:
 	struct SFXName                                     StyleTag;                                         		// 0x00E0 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27264,7 +27264,7 @@ public:
 	unsigned char                                      MaskPostProcess;                                  		// 0x0515 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27333,7 +27333,7 @@ public:
 	unsigned char                                      VertAlignment;                                    		// 0x0071 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27354,7 +27354,7 @@ public:
 	unsigned char                                      FadeType;                                         		// 0x0094 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27378,7 +27378,7 @@ public:
 	class UUITexture*                                  ImageRef;                                         		// 0x0134 (0x0008) [0x0000000014400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline | CPF_EditInlineUse )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27425,7 +27425,7 @@ public:
 	unsigned long                                      bReapplyFormatting : 1;                           		// 0x01BC (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27536,7 +27536,7 @@ public:
 	unsigned char                                      WrapType;                                         		// 0x085F (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27606,7 +27606,7 @@ class UUIComp_ListComponentBase : public UUIComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27628,7 +27628,7 @@ public:
 	unsigned long                                      bReverseSecondarySorting : 1;                     		// 0x0090 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27647,7 +27647,7 @@ public:
 	unsigned long                                      bReapplyFormatting : 1;                           		// 0x0070 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27684,7 +27684,7 @@ public:
 	unsigned long                                      bDisplayColumnHeaders : 1;                        		// 0x0150 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27699,7 +27699,7 @@ class UUIDataStoreSubscriber : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27719,7 +27719,7 @@ class UUIDataStorePublisher : public UUIDataStoreSubscriber
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27734,7 +27734,7 @@ class UUIListElementCellProvider : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27748,7 +27748,7 @@ class UUIListElementProvider : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27762,7 +27762,7 @@ class UUIAnimation : public UUIRoot
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27779,7 +27779,7 @@ public:
 	unsigned char                                      LoopMode;                                         		// 0x0078 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27797,7 +27797,7 @@ class UUIConfigProvider : public UUIDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27813,7 +27813,7 @@ public:
 	FString                                            ConfigFileName;                                   		// 0x0094 (0x0010) [0x0000000000C02000]              ( CPF_Transient | CPF_NeedCtorLink | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27828,7 +27828,7 @@ public:
 	FString                                            SectionName;                                      		// 0x0084 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27843,7 +27843,7 @@ public:
 	class ULocalPlayer*                                Player;                                           		// 0x0084 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27860,7 +27860,7 @@ public:
 	FPointer                                           VfTable_IUIListElementCellProvider;               		// 0x008C (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27884,7 +27884,7 @@ public:
 	FString                                            LastInviteFrom;                                   		// 0x00F4 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27921,7 +27921,7 @@ public:
 	FString                                            BusyText;                                         		// 0x0174 (0x0010) [0x0000000000408002]              ( CPF_Const | CPF_Localized | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27950,7 +27950,7 @@ public:
 	FString                                            IsPlayingThisGameCol;                             		// 0x0114 (0x0010) [0x0000000000408002]              ( CPF_Const | CPF_Localized | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27972,7 +27972,7 @@ public:
 	unsigned long                                      bWasErrorLastRead : 1;                            		// 0x00AC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27998,7 +27998,7 @@ class UUIDataProvider_OnlineProfileSettings : public UUIDataProvider_OnlinePlaye
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28017,7 +28017,7 @@ public:
 	FPointer                                           VfTable_IUIListElementCellProvider;               		// 0x008C (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28035,7 +28035,7 @@ public:
 	TArray<struct FAchievementDetails>                 Achievements;                                     		// 0x0094 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28067,7 +28067,7 @@ public:
 	int                                                PlayerStorageId;                                  		// 0x00C4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28088,7 +28088,7 @@ public:
 	int                                                SettingsId;                                       		// 0x00C4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28106,7 +28106,7 @@ public:
 	class UUIDynamicFieldProvider*                     SceneDataProvider;                                		// 0x00C4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28136,7 +28136,7 @@ class UUIDataStore_Color : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28155,7 +28155,7 @@ public:
 	class UUIDataStore_GameResource*                   GameResourceDataStore;                            		// 0x0114 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28179,7 +28179,7 @@ class UUIDataStore_Fonts : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28196,7 +28196,7 @@ public:
 	TArray<struct FGameResourceDataProvider>           ElementProviderTypes;                             		// 0x00FC (0x0010) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28220,7 +28220,7 @@ public:
 	struct SFXName                                     CurrentGameSettingsTag;                           		// 0x0164 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28241,7 +28241,7 @@ public:
 	struct FScriptDelegate                             __OnRefreshDataFieldValue__Delegate;              		// 0x00AC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28265,7 +28265,7 @@ public:
 	unsigned long                                      bRefreshTeamDataProviders : 1;                    		// 0x0114 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28303,7 +28303,7 @@ public:
 	class UCurrentWeaponDataProvider*                  CurrentWeapon;                                    		// 0x0104 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28320,7 +28320,7 @@ class UUIDataStore_Gamma : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28334,7 +28334,7 @@ class UUIDataStore_Images : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28353,7 +28353,7 @@ public:
 	class UClass*                                      ProviderClass;                                    		// 0x00E4 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28375,7 +28375,7 @@ public:
 	class UUIDynamicFieldProvider*                     RegistryDataProvider;                             		// 0x00AC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28390,7 +28390,7 @@ class UUIDataStore_Remote : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28413,7 +28413,7 @@ public:
 	int                                                ActiveSearchIndex;                                		// 0x00F0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28472,7 +28472,7 @@ public:
 	int                                                NumTotalDownloads;                                		// 0x01D0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28511,7 +28511,7 @@ public:
 	unsigned char                                      CurrentReadType;                                  		// 0x0144 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28531,7 +28531,7 @@ class UUIDataStore_Settings : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28548,7 +28548,7 @@ public:
 	int                                                SelectedIndex;                                    		// 0x00C4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28575,7 +28575,7 @@ public:
 	TArray<class USessionSettingsProvider*>            SessionSettings;                                  		// 0x00CC (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28591,7 +28591,7 @@ class UUIDataStore_StringBase : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28607,7 +28607,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x48 ];                            		// 0x00BC (0x0048) UNKNOWN PROPERTY: MapProperty Engine.UIDataStore_InputAlias.InputAliasLookupMap
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28632,7 +28632,7 @@ public:
 	int                                                PlayerIndex;                                      		// 0x0104 (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28650,7 +28650,7 @@ public:
 	TArray<class UUIConfigFileProvider*>               LocFileProviders;                                 		// 0x00AC (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28665,7 +28665,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x48 ];                            		// 0x020C (0x0048) UNKNOWN PROPERTY: MapProperty Engine.UICustomSkin.WidgetStyleMap
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28683,7 +28683,7 @@ public:
 	TArray<struct FUIProviderScriptFieldValue>         RuntimeDataFields;                                		// 0x0124 (0x0010) [0x0000000000402001]              ( CPF_Edit | CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28718,7 +28718,7 @@ public:
 	struct FScriptDelegate                             __CanSupportComplexPropertyType__Delegate;        		// 0x0094 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28737,7 +28737,7 @@ public:
 	class UObject*                                     DataSource;                                       		// 0x00B4 (0x0008) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28759,7 +28759,7 @@ public:
 	class AGameReplicationInfo*                        GameDataSource;                                   		// 0x00BC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28774,7 +28774,7 @@ class UInventoryDataProvider : public UUIDynamicDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28788,7 +28788,7 @@ class UPowerupDataProvider : public UInventoryDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28803,7 +28803,7 @@ class UWeaponDataProvider : public UInventoryDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28817,7 +28817,7 @@ class UCurrentWeaponDataProvider : public UWeaponDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28831,7 +28831,7 @@ class UPickupDataProvider : public UUIDynamicDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28845,7 +28845,7 @@ class UPlayerDataProvider : public UUIDynamicDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28860,7 +28860,7 @@ public:
 	class UPlayerDataProvider*                         PlayerData;                                       		// 0x00BC (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28879,7 +28879,7 @@ public:
 	struct SFXName                                     PlayerListFieldName;                              		// 0x00D4 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28897,7 +28897,7 @@ public:
 	unsigned long                                      bIsAListRow : 1;                                  		// 0x00D4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28919,7 +28919,7 @@ public:
 	unsigned long                                      bSkipDuringEnumeration : 1;                       		// 0x00B4 (0x0004) [0x0000000000004000] [0x00000002] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28956,7 +28956,7 @@ public:
 	unsigned char                                      EditboxAllowedChars;                              		// 0x015D (0x0001) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28975,7 +28975,7 @@ public:
 	FString                                            Description;                                      		// 0x00E8 (0x0010) [0x0000000000408002]              ( CPF_Const | CPF_Localized | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28990,7 +28990,7 @@ public:
 	struct SFXName                                     ProviderTag;                                      		// 0x00A4 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29011,7 +29011,7 @@ public:
 	class UClass*                                      ProviderClient;                                   		// 0x00BC (0x0008) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29035,7 +29035,7 @@ public:
 	class UUIDataProvider_OnlineProfileSettings*       ProfileProvider;                                  		// 0x009C (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29099,7 +29099,7 @@ public:
 	unsigned long                                      bBlockUpdatesAfterStackModification : 1;          		// 0x0204 (0x0004) [0x0000000000002001] [0x00800000] ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29169,7 +29169,7 @@ public:
 	struct SFXName                                     ClickedCue;                                       		// 0x0520 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29187,7 +29187,7 @@ public:
 	class UUIComp_DrawString*                          StringRenderComponent;                            		// 0x0570 (0x0008) [0x000000000608000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_Component | CPF_NoClear | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29217,7 +29217,7 @@ public:
 	unsigned char                                      IconAlignment;                                    		// 0x059C (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29267,7 +29267,7 @@ public:
 	unsigned char                                      ScrollbarOrientation;                             		// 0x0610 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29302,7 +29302,7 @@ class UUIScrollbarButton : public UUIButton
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29317,7 +29317,7 @@ public:
 	struct FScriptDelegate                             __OnButtonDragged__Delegate;                      		// 0x0528 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29333,7 +29333,7 @@ public:
 	class UUIComp_AutoAlignment*                       AutoAlignment;                                    		// 0x0518 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29357,7 +29357,7 @@ public:
 	unsigned char                                      ButtonLayout;                                     		// 0x05A5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29403,7 +29403,7 @@ public:
 	unsigned char                                      RegionType;                                       		// 0x052C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29420,7 +29420,7 @@ public:
 	class UUIComp_DrawImage*                           ImageComponent;                                   		// 0x0560 (0x0008) [0x000000000608000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_Component | CPF_NoClear | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29447,7 +29447,7 @@ public:
 	class UUIComp_DrawImage*                           LabelBackground;                                  		// 0x0570 (0x0008) [0x000000000408000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29475,7 +29475,7 @@ public:
 	unsigned long                                      bResolvePosition : 1;                             		// 0x0878 (0x0004) [0x0000000000002002] [0x00000001] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29505,7 +29505,7 @@ public:
 	int                                                ModificationCounter;                              		// 0x0530 (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29523,7 +29523,7 @@ public:
 	int                                                PrefabInstanceVersion;                            		// 0x05B0 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29609,7 +29609,7 @@ public:
 	unsigned char                                      ScenePostProcessGroup;                            		// 0x067B (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29695,7 +29695,7 @@ class UUIState_Active : public UUIState
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29709,7 +29709,7 @@ class UUIState_Focused : public UUIState
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29724,7 +29724,7 @@ class UUIState_Pressed : public UUIState
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29738,7 +29738,7 @@ class UUIListString : public UUIString
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29757,7 +29757,7 @@ public:
 	unsigned long                                      bDirty : 1;                                       		// 0x0088 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29774,7 +29774,7 @@ public:
 	struct FStyleDataReference                         TextStyle;                                        		// 0x00BC (0x0030) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29793,7 +29793,7 @@ public:
 	class USurface*                                    DefaultImage;                                     		// 0x00C4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29815,7 +29815,7 @@ public:
 	unsigned char                                      ClipAlignment;                                    		// 0x00B3 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29831,7 +29831,7 @@ public:
 	class USurface*                                    ImageTexture;                                     		// 0x00FC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29851,7 +29851,7 @@ public:
 	struct FScriptDelegate                             __OnScriptTick__Delegate;                         		// 0x0068 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29867,7 +29867,7 @@ class UUIStringRenderer : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29882,7 +29882,7 @@ class UUIStyleResolver : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29899,7 +29899,7 @@ class UUITickableObject : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29915,7 +29915,7 @@ public:
 	TArray<class UUIEvent*>                            UIEvents;                                         		// 0x019C (0x0010) [0x0000000001502002]              ( CPF_Const | CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29934,7 +29934,7 @@ class UUIStateSequence : public UUISequence
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29950,7 +29950,7 @@ public:
 	unsigned long                                      bAutoTargetOwner : 1;                             		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29976,7 +29976,7 @@ public:
 	unsigned long                                      bPropagateEvent : 1;                              		// 0x015C (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30001,7 +30001,7 @@ public:
 	class UUICalloutButtonPanel*                       ButtonPanel;                                      		// 0x0160 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30023,7 +30023,7 @@ public:
 	FPointer                                           VfTable_FCallbackEventDevice;                     		// 0x0160 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30040,7 +30040,7 @@ public:
 	struct FMultiMap_Mirror                            ActionMap;                                        		// 0x0160 (0x0048) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30055,7 +30055,7 @@ class UScene : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30069,7 +30069,7 @@ class UBioEffectsMaterials : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30091,7 +30091,7 @@ public:
 	int                                                MaxInstanceCount;                                 		// 0x02EC (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30119,7 +30119,7 @@ public:
 	float                                              Mass;                                             		// 0x02EC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30149,7 +30149,7 @@ public:
 	float                                              SwayScale;                                        		// 0x02B8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30164,7 +30164,7 @@ public:
 	FPointer                                           FoliageSceneProxy;                                		// 0x02C4 (0x0008) [0x0000000000201002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30178,7 +30178,7 @@ class UActorFactoryInteractiveFoliage : public UActorFactoryStaticMesh
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30197,7 +30197,7 @@ public:
 	unsigned long                                      bToggled : 1;                                     		// 0x029C (0x0004) [0x0000000100000020] [0x00000002] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30215,7 +30215,7 @@ public:
 	class UParticleSystem*                             ProjectileEntryEffect;                            		// 0x028C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30231,7 +30231,7 @@ class AFluidSurfaceActorMovable : public AFluidSurfaceActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30271,7 +30271,7 @@ public:
 	unsigned char                                      InfluenceType;                                    		// 0x0284 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30337,7 +30337,7 @@ public:
 	unsigned long                                      bTestRippleCenterOnDetail : 1;                    		// 0x0318 (0x0004) [0x0000000000000001] [0x00000400] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30355,7 +30355,7 @@ public:
 	class USpeedTreeComponent*                         SpeedTreeComponent;                               		// 0x0284 (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30394,7 +30394,7 @@ public:
 	unsigned long                                      bUseBillboards : 1;                               		// 0x0300 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30411,7 +30411,7 @@ public:
 	class USpeedTree*                                  SpeedTree;                                        		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30426,7 +30426,7 @@ public:
 	class USpeedTreeComponent*                         SpeedTreeComponent;                               		// 0x0064 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30452,7 +30452,7 @@ public:
 	unsigned long                                      bLegacySpeedTree : 1;                             		// 0x00BC (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30485,7 +30485,7 @@ public:
 	unsigned char                                      FBMethod;                                         		// 0x01F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30505,7 +30505,7 @@ public:
 	int                                                MaxTextureSize;                                   		// 0x0108 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30527,7 +30527,7 @@ public:
 	unsigned char                                      Format;                                           		// 0x0108 (0x0001) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30554,7 +30554,7 @@ public:
 	unsigned char                                      Format;                                           		// 0x0138 (0x0001) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30583,7 +30583,7 @@ public:
 	unsigned char                                      MovieStreamSource;                                		// 0x015F (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30603,7 +30603,7 @@ public:
 	unsigned long                                      bRenderOnce : 1;                                  		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30624,7 +30624,7 @@ public:
 	unsigned char                                      AddressY;                                         		// 0x011A (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30642,7 +30642,7 @@ public:
 	unsigned long                                      bSkipNextClear : 1;                               		// 0x012C (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30659,7 +30659,7 @@ public:
 	unsigned char                                      Format;                                           		// 0x0100 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30677,7 +30677,7 @@ public:
 	unsigned long                                      bIsChild : 1;                                     		// 0x00D4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30696,7 +30696,7 @@ public:
 	float                                              FadeOutTime;                                      		// 0x007C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30720,7 +30720,7 @@ public:
 	unsigned long                                      bIsFrozenRendering : 1;                           		// 0x07FC (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30747,7 +30747,7 @@ class AMatineePawn : public APawn
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30786,7 +30786,7 @@ public:
 	unsigned long                                      bHightlightOneWayReachSpecs : 1;                  		// 0x06C0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30801,7 +30801,7 @@ class ALightVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30817,7 +30817,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x028C (0x0004) [0x0000000100000020] [0x00000001] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30833,7 +30833,7 @@ class ADirectionalLight : public ALight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30847,7 +30847,7 @@ class ADirectionalLightToggleable : public ADirectionalLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30861,7 +30861,7 @@ class ADominantDirectionalLight : public ADirectionalLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30875,7 +30875,7 @@ class APointLight : public ALight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30889,7 +30889,7 @@ class ADominantPointLight : public APointLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30903,7 +30903,7 @@ class APointLightMovable : public APointLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30917,7 +30917,7 @@ class APointLightToggleable : public APointLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30934,7 +30934,7 @@ class ASkyLight : public ALight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30948,7 +30948,7 @@ class ASkyLightToggleable : public ASkyLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30962,7 +30962,7 @@ class ASpotLight : public ALight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30976,7 +30976,7 @@ class ADominantSpotLight : public ASpotLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30990,7 +30990,7 @@ class ASpotLightMovable : public ASpotLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31004,7 +31004,7 @@ class ASpotLightToggleable : public ASpotLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31023,7 +31023,7 @@ public:
 	int                                                MaxLightComponents;                               		// 0x02A0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31094,7 +31094,7 @@ public:
 	float                                              OcclusionMaskDarkness;                            		// 0x0200 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31120,7 +31120,7 @@ public:
 	float                                              WholeSceneDynamicShadowRadius;                    		// 0x0218 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31139,7 +31139,7 @@ public:
 	struct FArray_Mirror                               DominantLightShadowMap;                           		// 0x02D0 (0x0010) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31165,7 +31165,7 @@ public:
 	unsigned long                                      bAllowedInBasePass : 1;                           		// 0x0290 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31182,7 +31182,7 @@ class UDominantPointLightComponent : public UPointLightComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31201,7 +31201,7 @@ public:
 	float                                              LightShaftConeAngle;                              		// 0x02AC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31217,7 +31217,7 @@ public:
 	struct FArray_Mirror                               DominantLightShadowMap;                           		// 0x0360 (0x0010) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31233,7 +31233,7 @@ public:
 	struct FColor                                      LowerColor;                                       		// 0x0208 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31250,7 +31250,7 @@ public:
 	unsigned long                                      bRenderBeforeModShadows : 1;                      		// 0x02A0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31269,7 +31269,7 @@ public:
 	unsigned long                                      bForceNonCompositeDynamicLights : 1;              		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31341,7 +31341,7 @@ public:
 	unsigned char                                      eQuality;                                         		// 0x01B0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31357,7 +31357,7 @@ public:
 	unsigned long                                      bAllowDLESharing : 1;                             		// 0x01B8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31371,7 +31371,7 @@ class UDrawLightConeComponent : public UDrawConeComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31385,7 +31385,7 @@ class UDrawLightRadiusComponent : public UDrawSphereComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31401,7 +31401,7 @@ public:
 	class UMaterialInterface*                          SourceMaterial;                                   		// 0x006C (0x0008) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31615,7 +31615,7 @@ public:
 	unsigned long                                      m_bBioFFXShouldRelinkBoneMap : 1;                 		// 0x078C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31865,7 +31865,7 @@ public:
 	FPointer                                           m_VerticesPerBone;                                		// 0x041C (0x0008) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31885,7 +31885,7 @@ public:
 	struct SFXName                                     SupermodelName;                                   		// 0x0094 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31911,7 +31911,7 @@ public:
 	unsigned long                                      bAlreadyVisited : 1;                              		// 0x02E8 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31950,7 +31950,7 @@ public:
 	unsigned long                                      bAcceptsLights : 1;                               		// 0x0334 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31972,7 +31972,7 @@ public:
 	unsigned long                                      bSplineDisabled : 1;                              		// 0x0258 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32017,7 +32017,7 @@ public:
 	unsigned long                                      bDebugDrawScopes : 1;                             		// 0x0344 (0x0004) [0x0000000000000001] [0x00000200] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32036,7 +32036,7 @@ class AProcBuilding_SimpleLODActor : public AStaticMeshActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32051,7 +32051,7 @@ public:
 	TArray<struct FPBRuleLink>                         NextRules;                                        		// 0x0060 (0x0010) [0x0000000000400040]              ( CPF_EditConstArray | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32070,7 +32070,7 @@ public:
 	unsigned char                                      RepeatAxis;                                       		// 0x007C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32090,7 +32090,7 @@ public:
 	unsigned long                                      bFilled : 1;                                      		// 0x0084 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32113,7 +32113,7 @@ public:
 	unsigned char                                      CornerType;                                       		// 0x0098 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32129,7 +32129,7 @@ public:
 	unsigned char                                      Edge;                                             		// 0x0080 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32145,7 +32145,7 @@ public:
 	float                                              MainXPullIn;                                      		// 0x0074 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32163,7 +32163,7 @@ public:
 	float                                              ExtractNotBottomZ;                                		// 0x007C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32178,7 +32178,7 @@ public:
 	float                                              MassiveLODDistanceScale;                          		// 0x0070 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32196,7 +32196,7 @@ public:
 	unsigned long                                      bBlockAll : 1;                                    		// 0x00CC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32211,7 +32211,7 @@ class UPBRuleNodeOcclusion : public UPBRuleNodeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32231,7 +32231,7 @@ public:
 	unsigned long                                      bDisableMaterialRepeat : 1;                       		// 0x0088 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32248,7 +32248,7 @@ public:
 	int                                                MaxNumExecuted;                                   		// 0x0078 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32264,7 +32264,7 @@ public:
 	unsigned char                                      RepeatAxis;                                       		// 0x0074 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32281,7 +32281,7 @@ public:
 	unsigned char                                      SizeAxis;                                         		// 0x0078 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32297,7 +32297,7 @@ public:
 	unsigned char                                      SplitAxis;                                        		// 0x0080 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32312,7 +32312,7 @@ public:
 	class UProcBuildingRuleset*                        SubRuleset;                                       		// 0x0070 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32329,7 +32329,7 @@ public:
 	class UDistributionVector*                         Scale;                                            		// 0x0080 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32344,7 +32344,7 @@ public:
 	unsigned long                                      bVariationOfScopeOnLeft : 1;                      		// 0x0070 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32367,7 +32367,7 @@ public:
 	unsigned long                                      bScaleWindowWithCell : 1;                         		// 0x0094 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32398,7 +32398,7 @@ public:
 	unsigned long                                      bLODOnlyRoof : 1;                                 		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32412,7 +32412,7 @@ class AReplicationInfo : public AInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32442,7 +32442,7 @@ public:
 	unsigned long                                      bMatchIsOver : 1;                                 		// 0x0300 (0x0004) [0x0000000100000020] [0x00000004] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32523,7 +32523,7 @@ public:
 	unsigned char                                      TTSSpeaker;                                       		// 0x035D (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32577,7 +32577,7 @@ public:
 	struct FColor                                      TeamColor;                                        		// 0x02A0 (0x0004) [0x0000000040000000]              ( CPF_EditInlineNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32639,7 +32639,7 @@ public:
 	unsigned long                                      bEnableColorScaleInterp : 1;                      		// 0x0514 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32691,7 +32691,7 @@ public:
 	unsigned long                                      bConstrainAspectRatio : 1;                        		// 0x0380 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32707,7 +32707,7 @@ class ADynamicCameraActor : public ACameraActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32727,7 +32727,7 @@ public:
 	float                                              BaseFOV;                                          		// 0x016C (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32765,7 +32765,7 @@ public:
 	unsigned char                                      PlaySpace;                                        		// 0x01D8 (0x0001) [0x0000008000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32796,7 +32796,7 @@ public:
 	unsigned char                                      Priority;                                         		// 0x007C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32822,7 +32822,7 @@ public:
 	float                                              SplitScreenShakeScale;                            		// 0x0090 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32858,7 +32858,7 @@ public:
 	unsigned long                                      bRandomAnimSegment : 1;                           		// 0x00DC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32875,7 +32875,7 @@ public:
 	TArray<class USoundCue*>                           lstReferencedSoundCues;                           		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32889,7 +32889,7 @@ class UBioSFSharedBase : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32911,7 +32911,7 @@ public:
 	unsigned char                                      ScreenLayout;                                     		// 0x0098 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32977,7 +32977,7 @@ public:
 	unsigned char                                      nLStickY;                                         		// 0x0162 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33061,7 +33061,7 @@ public:
 	unsigned long                                      bUsingGamepad : 1;                                		// 0x016C (0x0004) [0x0000000000000000] [0x00020000] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33147,7 +33147,7 @@ public:
 	unsigned char                                      AddressY;                                         		// 0x0094 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33200,7 +33200,7 @@ public:
 	unsigned long                                      m_bCopySaveGame : 1;                              		// 0x01C8 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33282,7 +33282,7 @@ public:
 	unsigned char                                      RimLightControl;                                  		// 0x0221 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33311,7 +33311,7 @@ public:
 	unsigned long                                      EnableFilmgrain : 1;                              		// 0x0128 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33332,7 +33332,7 @@ public:
 	TArray<class UBio2DA*>                             lstForce2DAInMemory;                              		// 0x0168 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33383,7 +33383,7 @@ public:
 	TArray<int>                                        m_lstRowNumbers;                                  		// 0x01D0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33397,7 +33397,7 @@ class USeqEvent_HitWall : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33421,7 +33421,7 @@ public:
 	unsigned long                                      bCountInstances : 1;                              		// 0x0070 (0x0004) [0x0000000000000000] [0x00000020] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33445,7 +33445,7 @@ class USFXModule_DamageBase : public USFXModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33463,7 +33463,7 @@ public:
 	unsigned long                                      bDestroyBasedActors : 1;                          		// 0x0108 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33479,7 +33479,7 @@ public:
 	unsigned long                                      m_bPreserveVelocity : 1;                          		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33496,7 +33496,7 @@ public:
 	unsigned long                                      bVelocityRelativeToActorRotation : 1;             		// 0x0108 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33513,7 +33513,7 @@ public:
 	unsigned long                                      bToggleBasedActors : 1;                           		// 0x0108 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33535,7 +33535,7 @@ public:
 	unsigned long                                      bUseRelativeRotation : 1;                         		// 0x0118 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33551,7 +33551,7 @@ public:
 	float                                              Loudness;                                         		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33581,7 +33581,7 @@ public:
 	unsigned long                                      bDontAddDefaultAdmin : 1;                         		// 0x039C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33613,7 +33613,7 @@ class AAdmin : public APlayerController
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33642,7 +33642,7 @@ public:
 	float                                              RemainingDelay;                                   		// 0x0080 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33657,7 +33657,7 @@ public:
 	class UParticleSystem*                             ParticleTemplate;                                 		// 0x0298 (0x0008) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33673,7 +33673,7 @@ class AKAssetSpawnable : public AKAsset
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33687,7 +33687,7 @@ class UActorFactorySkeletalMeshCinematic : public UActorFactorySkeletalMesh
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33701,7 +33701,7 @@ class UActorFactorySkeletalMeshMAT : public UActorFactorySkeletalMesh
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33715,7 +33715,7 @@ class USeqEvent_Death : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33730,7 +33730,7 @@ class USeqAct_ToggleGodMode : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33745,7 +33745,7 @@ class USeqAct_ToggleAffectedByHitEffects : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33761,7 +33761,7 @@ public:
 	class UTextureMovie*                               MovieTexture;                                     		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33777,7 +33777,7 @@ public:
 	struct FScriptDelegate                             __OnCreateOnlineAccountCompleted__Delegate;       		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33820,7 +33820,7 @@ public:
 	struct FScriptDelegate                             __OnReadAchievementsComplete__Delegate;           		// 0x01A0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33944,7 +33944,7 @@ public:
 	struct FScriptDelegate                             __OnDeviceSelectionComplete__Delegate;            		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33984,7 +33984,7 @@ public:
 	struct FScriptDelegate                             __OnLinkStatusChange__Delegate;                   		// 0x00B0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34036,7 +34036,7 @@ public:
 	struct FScriptDelegate                             __OnGameInviteAccepted__Delegate;                 		// 0x0110 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34111,7 +34111,7 @@ public:
 	struct FScriptDelegate                             __OnContentChange__Delegate;                      		// 0x0080 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34140,7 +34140,7 @@ public:
 	struct FScriptDelegate                             __OnPlayerTalkingStateChange__Delegate;           		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34182,7 +34182,7 @@ public:
 	struct FScriptDelegate                             __OnReadOnlineStatsComplete__Delegate;            		// 0x0080 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34218,7 +34218,7 @@ public:
 	struct FScriptDelegate                             __OnReadNewsCompleted__Delegate;                  		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34238,7 +34238,7 @@ public:
 	struct FScriptDelegate                             __OnSendPartyGameInvitesComplete__Delegate;       		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34263,7 +34263,7 @@ public:
 	TArray<struct FCoverReplicationInfo>               CoverReplicationData;                             		// 0x0284 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34320,7 +34320,7 @@ public:
 	FString                                            SpecEnteredMessage;                               		// 0x01D4 (0x0010) [0x0000000000408002]              ( CPF_Const | CPF_Localized | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34336,7 +34336,7 @@ public:
 	unsigned long                                      bDisplayMessages : 1;                             		// 0x05BC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34354,7 +34354,7 @@ class UDmgType_Suicided : public UKillZDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34371,7 +34371,7 @@ public:
 	unsigned long                                      bBioToggleButtonInput : 1;                        		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34388,7 +34388,7 @@ public:
 	class UForceFeedbackWaveform*                      FFWaveform;                                       		// 0x0100 (0x0008) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34409,7 +34409,7 @@ public:
 	unsigned long                                      bDroppedPickups : 1;                              		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000040] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34427,7 +34427,7 @@ public:
 	TArray<FString>                                    Commands;                                         		// 0x0108 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34443,7 +34443,7 @@ class USeqAct_FlyThroughHasEnded : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34459,7 +34459,7 @@ public:
 	unsigned long                                      bTopPriority : 1;                                 		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34475,7 +34475,7 @@ class UAnimNotify_DestroyEffect : public UAnimNotify
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34489,7 +34489,7 @@ class UAnimNotify_Effect : public UAnimNotify
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34509,7 +34509,7 @@ public:
 	unsigned long                                      bOverridePlayingAnim : 1;                         		// 0x0094 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34524,7 +34524,7 @@ class UAnimNotify_Trigger : public UAnimNotify_Scripted
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34542,7 +34542,7 @@ public:
 	int                                                BlurWidth;                                        		// 0x00E4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34562,7 +34562,7 @@ public:
 	unsigned char                                      TypeValue;                                        		// 0x010C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34580,7 +34580,7 @@ public:
 	unsigned long                                      bMuteSpectators : 1;                              		// 0x0288 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34604,7 +34604,7 @@ public:
 	float                                              InterpTime;                                       		// 0x02D0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34620,7 +34620,7 @@ class ADebugCameraHUD : public AHUD
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34637,7 +34637,7 @@ class UDebugCameraInput : public UPlayerInput
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34653,7 +34653,7 @@ public:
 	class APhysicsVolume*                              V;                                                		// 0x0284 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34670,7 +34670,7 @@ public:
 	class AActor*                                      DamageInstigator;                                 		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34684,7 +34684,7 @@ class ADialogueManager : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34699,7 +34699,7 @@ class UDialogueTree : public USequence
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34713,7 +34713,7 @@ class UDmgType_Crushed : public UDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34727,7 +34727,7 @@ class UDmgType_Fell : public UDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34741,7 +34741,7 @@ class UDmgType_Telefragged : public UDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34756,7 +34756,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x0314 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34771,7 +34771,7 @@ class ADynamicSMActor_Spawnable : public ADynamicSMActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34786,7 +34786,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x02C4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34804,7 +34804,7 @@ public:
 	unsigned long                                      bOverrideScalar : 1;                              		// 0x010C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34819,7 +34819,7 @@ public:
 	FString                                            FailMessage[ 0x4 ];                               		// 0x0074 (0x0040) [0x0000000000408002]              ( CPF_Const | CPF_Localized | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34836,7 +34836,7 @@ public:
 	class UObject*                                     SpawnPoint;                                       		// 0x0128 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34851,7 +34851,7 @@ public:
 	class AGameRules*                                  NextGameRules;                                    		// 0x0284 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34891,7 +34891,7 @@ public:
 	unsigned long                                      bPerformAutomaticLayout : 1;                      		// 0x06EC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34922,7 +34922,7 @@ class UUIMessageBox : public UUIMessageBoxBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34939,7 +34939,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x028C (0x0004) [0x0000000100000020] [0x00000001] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34956,7 +34956,7 @@ class AInterpActor_ForCinematic : public AInterpActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34970,7 +34970,7 @@ class AKActorHack : public AKActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34984,7 +34984,7 @@ class ALevelInfo : public AZoneInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34999,7 +34999,7 @@ public:
 	class UClass*                                      ControllerClass;                                  		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35016,7 +35016,7 @@ public:
 	unsigned long                                      bForceReplace : 1;                                		// 0x0108 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35030,7 +35030,7 @@ class ANavMeshBoundsVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35049,7 +35049,7 @@ public:
 	struct FScriptDelegate                             __OnReadContentListComplete__Delegate;            		// 0x00A0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35088,7 +35088,7 @@ class UOnlineEventsInterface : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35109,7 +35109,7 @@ public:
 	int                                                GameTypeId;                                       		// 0x00E0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35128,7 +35128,7 @@ public:
 	unsigned long                                      bIsArbitrated : 1;                                		// 0x00E0 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35150,7 +35150,7 @@ public:
 	int                                                RecentPartiesAddIndex;                            		// 0x00B4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35180,7 +35180,7 @@ class APathNode_Dynamic : public APathNode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35195,7 +35195,7 @@ class USeqEvent_PickupStatusChange : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35210,7 +35210,7 @@ public:
 	class URadialBlurComponent*                        RadialBlur;                                       		// 0x0284 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35228,7 +35228,7 @@ public:
 	unsigned long                                      bEnableLinearvelocityDrive : 1;                   		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35242,7 +35242,7 @@ class ARB_BSJointActor : public ARB_ConstraintActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35256,7 +35256,7 @@ class ARB_ConstraintActorSpawnable : public ARB_ConstraintActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35270,7 +35270,7 @@ class ARB_HingeActor : public ARB_ConstraintActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35284,7 +35284,7 @@ class ARB_PrismaticActor : public ARB_ConstraintActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35298,7 +35298,7 @@ class ARB_PulleyJointActor : public ARB_ConstraintActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35312,7 +35312,7 @@ class USeqAct_AddRemoveFaceFXAnimSet : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35326,7 +35326,7 @@ class USeqAct_AIAbortMoveToActor : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35340,7 +35340,7 @@ class USequenceObjectSaveObject : public UBioBaseSaveObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35354,7 +35354,7 @@ class USequenceOpSaveObject : public USequenceObjectSaveObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35368,7 +35368,7 @@ class USequenceActionSaveObject : public USequenceOpSaveObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35382,7 +35382,7 @@ class USeqAct_LatentSaveObject : public USequenceActionSaveObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35398,7 +35398,7 @@ public:
 	class USoundCue*                                   SoundToPlay;                                      		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35416,7 +35416,7 @@ public:
 	struct SFXName                                     Value;                                            		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35433,7 +35433,7 @@ public:
 	struct SFXName                                     SkelControlName;                                  		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35448,7 +35448,7 @@ public:
 	class USkeletalMesh*                               NewSkeletalMesh;                                  		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35463,7 +35463,7 @@ public:
 	class UStaticMesh*                                 NewStaticMesh;                                    		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35478,7 +35478,7 @@ public:
 	struct FVector                                     DefaultValue;                                     		// 0x00F8 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35493,7 +35493,7 @@ class USeqAct_UpdateDynamicCover : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35508,7 +35508,7 @@ class USeqAct_UpdatePhysBonesFromAnim : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35523,7 +35523,7 @@ class USeqEvent_AIReachedRouteActor : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35537,7 +35537,7 @@ class USeqEvent_LevelReset : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35554,7 +35554,7 @@ public:
 	unsigned long                                      bCheckForObstructions : 1;                        		// 0x0130 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35570,7 +35570,7 @@ class USeqEvent_UnTouch : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35584,7 +35584,7 @@ class USequenceEventSaveObject : public USequenceOpSaveObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35603,7 +35603,7 @@ public:
 	TArray<class UActivateOpSaveObject*>               DelayedActivatedOpsSaveObjects;                   		// 0x00B8 (0x0010) [0x0000000000400008]              ( CPF_ExportObject | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35617,7 +35617,7 @@ class USequenceReferenceSaveObject : public USequenceSaveObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35631,7 +35631,7 @@ class USequenceVariableSaveObject : public USequenceObjectSaveObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35645,7 +35645,7 @@ class USeqVar_Byte : public USequenceVariable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35659,7 +35659,7 @@ class USeqVar_UniqueNetId : public USequenceVariable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35673,7 +35673,7 @@ class UUISettingsClient : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35687,7 +35687,7 @@ class USessionSettingsProvider_GameInfo : public USessionSettingsProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35701,7 +35701,7 @@ class ASkeletalMeshActorMATSpawnable : public ASkeletalMeshActorMAT
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35715,7 +35715,7 @@ class USoundLocalization : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35729,7 +35729,7 @@ class UTextureCompressionProfile : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35743,7 +35743,7 @@ class UTextureCompressionDefault : public UTextureCompressionProfile
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35757,7 +35757,7 @@ class UTextureCompressionDisplacement : public UTextureCompressionProfile
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35771,7 +35771,7 @@ class UTextureCompressionNone : public UTextureCompressionProfile
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35785,7 +35785,7 @@ class UTextureCompressionNormalmap : public UTextureCompressionProfile
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35799,7 +35799,7 @@ class ATrigger_Dynamic : public ATrigger
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35814,7 +35814,7 @@ public:
 	TArray<class APlayerController*>                   PCsWithLOS;                                       		// 0x0294 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35831,7 +35831,7 @@ public:
 	unsigned long                                      bOpen : 1;                                        		// 0x038C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35849,7 +35849,7 @@ public:
 	TArray<struct FLevelStreamingData>                 Levels;                                           		// 0x0294 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35865,7 +35865,7 @@ public:
 	unsigned long                                      bVisible : 1;                                     		// 0x00FC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35880,7 +35880,7 @@ public:
 	FString                                            Command;                                          		// 0x00FC (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35894,7 +35894,7 @@ class UUIAction_SetControllerId : public UUIAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35908,7 +35908,7 @@ class UUIAction_SetValue : public UUIAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35923,7 +35923,7 @@ public:
 	FString                                            NewMarkup;                                        		// 0x00FC (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35938,7 +35938,7 @@ public:
 	FString                                            NewText;                                          		// 0x00FC (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35955,7 +35955,7 @@ public:
 	unsigned long                                      bActivateListChangeEvent : 1;                     		// 0x0100 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35969,7 +35969,7 @@ class UUIAction_ShowAchievementsUI : public UUIAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35983,7 +35983,7 @@ class UUIAction_ShowContentMarketplaceUI : public UUIAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35997,7 +35997,7 @@ class UUIAction_ShowFeedbackUI : public UUIAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36011,7 +36011,7 @@ class UUIAction_ShowFriendInviteUI : public UUIAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36025,7 +36025,7 @@ class UUIAction_ShowFriendsUI : public UUIAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36039,7 +36039,7 @@ class UUIAction_ShowGamerCardUI : public UUIAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36053,7 +36053,7 @@ class UUIAction_ShowMembershipMarketplaceUI : public UUIAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36067,7 +36067,7 @@ class UUIAction_ShowMessagesUI : public UUIAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36081,7 +36081,7 @@ class UUIAction_ShowPlayersUI : public UUIAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36095,7 +36095,7 @@ class UUIEvent_Initialized : public UUIEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36113,7 +36113,7 @@ public:
 	unsigned long                                      bIsDisabled : 1;                                  		// 0x00E8 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36128,7 +36128,7 @@ class UUIFocusHint : public UUILabel
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36147,7 +36147,7 @@ public:
 	unsigned long                                      bIsDisabled : 1;                                  		// 0x00E8 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36167,7 +36167,7 @@ public:
 	class USoundCue*                                   ExitSound;                                        		// 0x0334 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36186,7 +36186,7 @@ public:
 	class UWindDirectionalSourceComponent*             Component;                                        		// 0x0284 (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -102,7 +102,7 @@ public:
 	int                                                RefCount;                                         		// 0x0070 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -116,7 +116,7 @@ class UGFxFSCmdHandler : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -133,7 +133,7 @@ public:
 	class UGFxInteraction*                             GFxUIController;                                  		// 0x01CC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -149,7 +149,7 @@ public:
 	FPointer                                           VfTable_FCallbackEventDevice;                     		// 0x00A0 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -194,7 +194,7 @@ public:
 	unsigned char                                      RenderTextureMode;                                		// 0x01A6 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -273,7 +273,7 @@ public:
 	unsigned long                                      bUsesFontlib : 1;                                 		// 0x00A4 (0x0004) [0x0000000000020001] [0x00000001] ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -288,7 +288,7 @@ public:
 	int                                                Value[ 0xC ];                                     		// 0x0060 (0x0030) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -369,7 +369,7 @@ public:
 	unsigned long                                      bUnload : 1;                                      		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -386,7 +386,7 @@ public:
 	class UGFxMovie*                                   Movie;                                            		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -404,7 +404,7 @@ public:
 	class UGFxMovie*                                   Movie;                                            		// 0x0118 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -423,7 +423,7 @@ public:
 	unsigned long                                      bStartPaused : 1;                                 		// 0x0100 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -440,7 +440,7 @@ public:
 	class UGFxMovie*                                   Movie;                                            		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -456,7 +456,7 @@ public:
 	unsigned long                                      bCaptureInput : 1;                                		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -472,7 +472,7 @@ public:
 	class UGFxMovie*                                   Movie;                                            		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -489,7 +489,7 @@ public:
 	class UGFxMovie*                                   Movie;                                            		// 0x0138 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -504,7 +504,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x48 ];                            		// 0x0060 (0x0048) UNKNOWN PROPERTY: MapProperty GFxUI.GFxFSCmdHandler_Kismet.Events
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -521,7 +521,7 @@ public:
 	class UGFxMovie*                                   Movie;                                            		// 0x0068 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
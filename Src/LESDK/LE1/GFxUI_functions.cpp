@@ -28,26 +28,20 @@
 
 
 
-class UClass* UGFxEngine::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxEngine::pClassPointer { L"Class GFxUI.GFxEngine", &UObject::FindClass };
 
 class UClass* UGFxEngine::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxEngine" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UGFxFSCmdHandler::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxFSCmdHandler::pClassPointer { L"Class GFxUI.GFxFSCmdHandler", &UObject::FindClass };
 
 class UClass* UGFxFSCmdHandler::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxFSCmdHandler" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function GFxUI.GFxFSCmdHandler.FSCommand
@@ -60,10 +54,9 @@ class UClass* UGFxFSCmdHandler::StaticClass()
 
 bool UGFxFSCmdHandler::eventFSCommand ( class UGFxMovie* Movie, FString const& Cmd, FString const& arg )
 {
-	static UFunction* pFnFSCommand = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFSCommandRef { L"Function GFxUI.GFxFSCmdHandler.FSCommand", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFSCommand )
-		pFnFSCommand = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxFSCmdHandler.FSCommand" );
+	UFunction* const pFnFSCommand = pFnFSCommandRef.Get ( );
 
 	UGFxFSCmdHandler_eventFSCommand_Parms FSCommand_Parms;
 	FSCommand_Parms.Movie = Movie;
@@ -77,14 +70,11 @@ bool UGFxFSCmdHandler::eventFSCommand ( class UGFxMovie* Movie, FString const& C
 
 
 
-class UClass* UGFxGameViewportClient::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxGameViewportClient::pClassPointer { L"Class GFxUI.GFxGameViewportClient", &UObject::FindClass };
 
 class UClass* UGFxGameViewportClient::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxGameViewportClient" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function GFxUI.GFxGameViewportClient.Init
@@ -95,10 +85,9 @@ class UClass* UGFxGameViewportClient::StaticClass()
 
 bool UGFxGameViewportClient::eventInit ( FString* OutError )
 {
-	static UFunction* pFnInit = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitRef { L"Function GFxUI.GFxGameViewportClient.Init", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInit )
-		pFnInit = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxGameViewportClient.Init" );
+	UFunction* const pFnInit = pFnInitRef.Get ( );
 
 	UGFxGameViewportClient_eventInit_Parms Init_Parms;
 
@@ -115,14 +104,11 @@ bool UGFxGameViewportClient::eventInit ( FString* OutError )
 
 
 
-class UClass* UGFxInteraction::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxInteraction::pClassPointer { L"Class GFxUI.GFxInteraction", &UObject::FindClass };
 
 class UClass* UGFxInteraction::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxInteraction" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function GFxUI.GFxInteraction.NotifyGameSessionEnded
@@ -131,18 +117,14 @@ class UClass* UGFxInteraction::StaticClass()
 
 void UGFxInteraction::NotifyGameSessionEnded ( )
 {
-	static UFunction* pFnNotifyGameSessionEnded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyGameSessionEndedRef { L"Function GFxUI.GFxInteraction.NotifyGameSessionEnded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyGameSessionEnded )
-		pFnNotifyGameSessionEnded = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxInteraction.NotifyGameSessionEnded" );
+	UFunction* const pFnNotifyGameSessionEnded = pFnNotifyGameSessionEndedRef.Get ( );
 
 	UGFxInteraction_execNotifyGameSessionEnded_Parms NotifyGameSessionEnded_Parms;
 
-	pFnNotifyGameSessionEnded->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotifyGameSessionEnded, &NotifyGameSessionEnded_Parms, NULL );
-
-	pFnNotifyGameSessionEnded->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNotifyGameSessionEnded, &NotifyGameSessionEnded_Parms ) )
+		this->ProcessEvent ( pFnNotifyGameSessionEnded, &NotifyGameSessionEnded_Parms, NULL );
 };
 
 // Function GFxUI.GFxInteraction.GetFocusMovie
@@ -152,18 +134,14 @@ void UGFxInteraction::NotifyGameSessionEnded ( )
 
 class UGFxMovie* UGFxInteraction::GetFocusMovie ( )
 {
-	static UFunction* pFnGetFocusMovie = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetFocusMovieRef { L"Function GFxUI.GFxInteraction.GetFocusMovie", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetFocusMovie )
-		pFnGetFocusMovie = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxInteraction.GetFocusMovie" );
+	UFunction* const pFnGetFocusMovie = pFnGetFocusMovieRef.Get ( );
 
 	UGFxInteraction_execGetFocusMovie_Parms GetFocusMovie_Parms;
 
-	pFnGetFocusMovie->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetFocusMovie, &GetFocusMovie_Parms, NULL );
-
-	pFnGetFocusMovie->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetFocusMovie, &GetFocusMovie_Parms ) )
+		this->ProcessEvent ( pFnGetFocusMovie, &GetFocusMovie_Parms, NULL );
 
 	return GetFocusMovie_Parms.ReturnValue;
 };
@@ -177,34 +155,27 @@ class UGFxMovie* UGFxInteraction::GetFocusMovie ( )
 
 bool UGFxInteraction::SetFocusMovie ( FString const& MovieName, unsigned long captureInput )
 {
-	static UFunction* pFnSetFocusMovie = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetFocusMovieRef { L"Function GFxUI.GFxInteraction.SetFocusMovie", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetFocusMovie )
-		pFnSetFocusMovie = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxInteraction.SetFocusMovie" );
+	UFunction* const pFnSetFocusMovie = pFnSetFocusMovieRef.Get ( );
 
 	UGFxInteraction_execSetFocusMovie_Parms SetFocusMovie_Parms;
 	memcpy ( &SetFocusMovie_Parms.MovieName, &MovieName, 0x10 );
 	SetFocusMovie_Parms.captureInput = captureInput;
 
-	pFnSetFocusMovie->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetFocusMovie, &SetFocusMovie_Parms, NULL );
-
-	pFnSetFocusMovie->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetFocusMovie, &SetFocusMovie_Parms ) )
+		this->ProcessEvent ( pFnSetFocusMovie, &SetFocusMovie_Parms, NULL );
 
 	return SetFocusMovie_Parms.ReturnValue;
 };
 
 
 
-class UClass* UGFxMovie::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxMovie::pClassPointer { L"Class GFxUI.GFxMovie", &UObject::FindClass };
 
 class UClass* UGFxMovie::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxMovie" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function GFxUI.GFxMovie.UnregisterGFxValue
@@ -215,19 +186,15 @@ class UClass* UGFxMovie::StaticClass()
 
 bool UGFxMovie::UnregisterGFxValue ( class UGFxValue* i_val )
 {
-	static UFunction* pFnUnregisterGFxValue = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnregisterGFxValueRef { L"Function GFxUI.GFxMovie.UnregisterGFxValue", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnregisterGFxValue )
-		pFnUnregisterGFxValue = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.UnregisterGFxValue" );
+	UFunction* const pFnUnregisterGFxValue = pFnUnregisterGFxValueRef.Get ( );
 
 	UGFxMovie_execUnregisterGFxValue_Parms UnregisterGFxValue_Parms;
 	UnregisterGFxValue_Parms.i_val = i_val;
 
-	pFnUnregisterGFxValue->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnUnregisterGFxValue, &UnregisterGFxValue_Parms, NULL );
-
-	pFnUnregisterGFxValue->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnUnregisterGFxValue, &UnregisterGFxValue_Parms ) )
+		this->ProcessEvent ( pFnUnregisterGFxValue, &UnregisterGFxValue_Parms, NULL );
 
 	return UnregisterGFxValue_Parms.ReturnValue;
 };
@@ -240,19 +207,15 @@ bool UGFxMovie::UnregisterGFxValue ( class UGFxValue* i_val )
 
 bool UGFxMovie::RegisterGFxValue ( class UGFxValue* i_val )
 {
-	static UFunction* pFnRegisterGFxValue = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRegisterGFxValueRef { L"Function GFxUI.GFxMovie.RegisterGFxValue", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRegisterGFxValue )
-		pFnRegisterGFxValue = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.RegisterGFxValue" );
+	UFunction* const pFnRegisterGFxValue = pFnRegisterGFxValueRef.Get ( );
 
 	UGFxMovie_execRegisterGFxValue_Parms RegisterGFxValue_Parms;
 	RegisterGFxValue_Parms.i_val = i_val;
 
-	pFnRegisterGFxValue->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRegisterGFxValue, &RegisterGFxValue_Parms, NULL );
-
-	pFnRegisterGFxValue->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRegisterGFxValue, &RegisterGFxValue_Parms ) )
+		this->ProcessEvent ( pFnRegisterGFxValue, &RegisterGFxValue_Parms, NULL );
 
 	return RegisterGFxValue_Parms.ReturnValue;
 };
@@ -265,20 +228,16 @@ bool UGFxMovie::RegisterGFxValue ( class UGFxValue* i_val )
 
 void UGFxMovie::ActionScriptSetFunction ( class UGFxValue* Obj, FString const& member )
 {
-	static UFunction* pFnActionScriptSetFunction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActionScriptSetFunctionRef { L"Function GFxUI.GFxMovie.ActionScriptSetFunction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActionScriptSetFunction )
-		pFnActionScriptSetFunction = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.ActionScriptSetFunction" );
+	UFunction* const pFnActionScriptSetFunction = pFnActionScriptSetFunctionRef.Get ( );
 
 	UGFxMovie_execActionScriptSetFunction_Parms ActionScriptSetFunction_Parms;
 	ActionScriptSetFunction_Parms.Obj = Obj;
 	memcpy ( &ActionScriptSetFunction_Parms.member, &member, 0x10 );
 
-	pFnActionScriptSetFunction->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnActionScriptSetFunction, &ActionScriptSetFunction_Parms, NULL );
-
-	pFnActionScriptSetFunction->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnActionScriptSetFunction, &ActionScriptSetFunction_Parms ) )
+		this->ProcessEvent ( pFnActionScriptSetFunction, &ActionScriptSetFunction_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.ActionScriptObject
@@ -289,19 +248,15 @@ void UGFxMovie::ActionScriptSetFunction ( class UGFxValue* Obj, FString const& m
 
 class UGFxValue* UGFxMovie::ActionScriptObject ( FString const& Path )
 {
-	static UFunction* pFnActionScriptObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActionScriptObjectRef { L"Function GFxUI.GFxMovie.ActionScriptObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActionScriptObject )
-		pFnActionScriptObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.ActionScriptObject" );
+	UFunction* const pFnActionScriptObject = pFnActionScriptObjectRef.Get ( );
 
 	UGFxMovie_execActionScriptObject_Parms ActionScriptObject_Parms;
 	memcpy ( &ActionScriptObject_Parms.Path, &Path, 0x10 );
 
-	pFnActionScriptObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnActionScriptObject, &ActionScriptObject_Parms, NULL );
-
-	pFnActionScriptObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnActionScriptObject, &ActionScriptObject_Parms ) )
+		this->ProcessEvent ( pFnActionScriptObject, &ActionScriptObject_Parms, NULL );
 
 	return ActionScriptObject_Parms.ReturnValue;
 };
@@ -314,19 +269,15 @@ class UGFxValue* UGFxMovie::ActionScriptObject ( FString const& Path )
 
 FString UGFxMovie::ActionScriptString ( FString const& Path )
 {
-	static UFunction* pFnActionScriptString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActionScriptStringRef { L"Function GFxUI.GFxMovie.ActionScriptString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActionScriptString )
-		pFnActionScriptString = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.ActionScriptString" );
+	UFunction* const pFnActionScriptString = pFnActionScriptStringRef.Get ( );
 
 	UGFxMovie_execActionScriptString_Parms ActionScriptString_Parms;
 	memcpy ( &ActionScriptString_Parms.Path, &Path, 0x10 );
 
-	pFnActionScriptString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnActionScriptString, &ActionScriptString_Parms, NULL );
-
-	pFnActionScriptString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnActionScriptString, &ActionScriptString_Parms ) )
+		this->ProcessEvent ( pFnActionScriptString, &ActionScriptString_Parms, NULL );
 
 	return ActionScriptString_Parms.ReturnValue;
 };
@@ -339,19 +290,15 @@ FString UGFxMovie::ActionScriptString ( FString const& Path )
 
 float UGFxMovie::ActionScriptFloat ( FString const& Path )
 {
-	static UFunction* pFnActionScriptFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActionScriptFloatRef { L"Function GFxUI.GFxMovie.ActionScriptFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActionScriptFloat )
-		pFnActionScriptFloat = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.ActionScriptFloat" );
+	UFunction* const pFnActionScriptFloat = pFnActionScriptFloatRef.Get ( );
 
 	UGFxMovie_execActionScriptFloat_Parms ActionScriptFloat_Parms;
 	memcpy ( &ActionScriptFloat_Parms.Path, &Path, 0x10 );
 
-	pFnActionScriptFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnActionScriptFloat, &ActionScriptFloat_Parms, NULL );
-
-	pFnActionScriptFloat->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnActionScriptFloat, &ActionScriptFloat_Parms ) )
+		this->ProcessEvent ( pFnActionScriptFloat, &ActionScriptFloat_Parms, NULL );
 
 	return ActionScriptFloat_Parms.ReturnValue;
 };
@@ -364,19 +311,15 @@ float UGFxMovie::ActionScriptFloat ( FString const& Path )
 
 int UGFxMovie::ActionScriptInt ( FString const& Path )
 {
-	static UFunction* pFnActionScriptInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActionScriptIntRef { L"Function GFxUI.GFxMovie.ActionScriptInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActionScriptInt )
-		pFnActionScriptInt = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.ActionScriptInt" );
+	UFunction* const pFnActionScriptInt = pFnActionScriptIntRef.Get ( );
 
 	UGFxMovie_execActionScriptInt_Parms ActionScriptInt_Parms;
 	memcpy ( &ActionScriptInt_Parms.Path, &Path, 0x10 );
 
-	pFnActionScriptInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnActionScriptInt, &ActionScriptInt_Parms, NULL );
-
-	pFnActionScriptInt->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnActionScriptInt, &ActionScriptInt_Parms ) )
+		this->ProcessEvent ( pFnActionScriptInt, &ActionScriptInt_Parms, NULL );
 
 	return ActionScriptInt_Parms.ReturnValue;
 };
@@ -388,19 +331,15 @@ int UGFxMovie::ActionScriptInt ( FString const& Path )
 
 void UGFxMovie::ActionScriptVoid ( FString const& Path )
 {
-	static UFunction* pFnActionScriptVoid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActionScriptVoidRef { L"Function GFxUI.GFxMovie.ActionScriptVoid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActionScriptVoid )
-		pFnActionScriptVoid = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.ActionScriptVoid" );
+	UFunction* const pFnActionScriptVoid = pFnActionScriptVoidRef.Get ( );
 
 	UGFxMovie_execActionScriptVoid_Parms ActionScriptVoid_Parms;
 	memcpy ( &ActionScriptVoid_Parms.Path, &Path, 0x10 );
 
-	pFnActionScriptVoid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnActionScriptVoid, &ActionScriptVoid_Parms, NULL );
-
-	pFnActionScriptVoid->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnActionScriptVoid, &ActionScriptVoid_Parms ) )
+		this->ProcessEvent ( pFnActionScriptVoid, &ActionScriptVoid_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.SetExternalInterface
@@ -410,10 +349,9 @@ void UGFxMovie::ActionScriptVoid ( FString const& Path )
 
 void UGFxMovie::SetExternalInterface ( class UObject* H )
 {
-	static UFunction* pFnSetExternalInterface = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetExternalInterfaceRef { L"Function GFxUI.GFxMovie.SetExternalInterface", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetExternalInterface )
-		pFnSetExternalInterface = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetExternalInterface" );
+	UFunction* const pFnSetExternalInterface = pFnSetExternalInterfaceRef.Get ( );
 
 	UGFxMovie_execSetExternalInterface_Parms SetExternalInterface_Parms;
 	SetExternalInterface_Parms.H = H;
@@ -428,10 +366,9 @@ void UGFxMovie::SetExternalInterface ( class UObject* H )
 
 void UGFxMovie::SetFsCmdHandler ( class UGFxFSCmdHandler* H )
 {
-	static UFunction* pFnSetFsCmdHandler = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetFsCmdHandlerRef { L"Function GFxUI.GFxMovie.SetFsCmdHandler", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetFsCmdHandler )
-		pFnSetFsCmdHandler = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetFsCmdHandler" );
+	UFunction* const pFnSetFsCmdHandler = pFnSetFsCmdHandlerRef.Get ( );
 
 	UGFxMovie_execSetFsCmdHandler_Parms SetFsCmdHandler_Parms;
 	SetFsCmdHandler_Parms.H = H;
@@ -447,20 +384,16 @@ void UGFxMovie::SetFsCmdHandler ( class UGFxFSCmdHandler* H )
 
 void UGFxMovie::SetVariableObject ( FString const& Path, class UGFxValue* Value )
 {
-	static UFunction* pFnSetVariableObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetVariableObjectRef { L"Function GFxUI.GFxMovie.SetVariableObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetVariableObject )
-		pFnSetVariableObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetVariableObject" );
+	UFunction* const pFnSetVariableObject = pFnSetVariableObjectRef.Get ( );
 
 	UGFxMovie_execSetVariableObject_Parms SetVariableObject_Parms;
 	memcpy ( &SetVariableObject_Parms.Path, &Path, 0x10 );
 	SetVariableObject_Parms.Value = Value;
 
-	pFnSetVariableObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetVariableObject, &SetVariableObject_Parms, NULL );
-
-	pFnSetVariableObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetVariableObject, &SetVariableObject_Parms ) )
+		this->ProcessEvent ( pFnSetVariableObject, &SetVariableObject_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.GetVariableObject
@@ -472,20 +405,16 @@ void UGFxMovie::SetVariableObject ( FString const& Path, class UGFxValue* Value
 
 class UGFxValue* UGFxMovie::GetVariableObject ( FString const& Path, class UClass* Type )
 {
-	static UFunction* pFnGetVariableObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVariableObjectRef { L"Function GFxUI.GFxMovie.GetVariableObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVariableObject )
-		pFnGetVariableObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.GetVariableObject" );
+	UFunction* const pFnGetVariableObject = pFnGetVariableObjectRef.Get ( );
 
 	UGFxMovie_execGetVariableObject_Parms GetVariableObject_Parms;
 	memcpy ( &GetVariableObject_Parms.Path, &Path, 0x10 );
 	GetVariableObject_Parms.Type = Type;
 
-	pFnGetVariableObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVariableObject, &GetVariableObject_Parms, NULL );
-
-	pFnGetVariableObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVariableObject, &GetVariableObject_Parms ) )
+		this->ProcessEvent ( pFnGetVariableObject, &GetVariableObject_Parms, NULL );
 
 	return GetVariableObject_Parms.ReturnValue;
 };
@@ -497,18 +426,14 @@ class UGFxValue* UGFxMovie::GetVariableObject ( FString const& Path, class UClas
 
 class UGFxValue* UGFxMovie::CreateArray ( )
 {
-	static UFunction* pFnCreateArray = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCreateArrayRef { L"Function GFxUI.GFxMovie.CreateArray", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCreateArray )
-		pFnCreateArray = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.CreateArray" );
+	UFunction* const pFnCreateArray = pFnCreateArrayRef.Get ( );
 
 	UGFxMovie_execCreateArray_Parms CreateArray_Parms;
 
-	pFnCreateArray->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCreateArray, &CreateArray_Parms, NULL );
-
-	pFnCreateArray->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCreateArray, &CreateArray_Parms ) )
+		this->ProcessEvent ( pFnCreateArray, &CreateArray_Parms, NULL );
 
 	return CreateArray_Parms.ReturnValue;
 };
@@ -522,20 +447,16 @@ class UGFxValue* UGFxMovie::CreateArray ( )
 
 class UGFxValue* UGFxMovie::CreateObject ( FString const& ASClass, class UClass* Type )
 {
-	static UFunction* pFnCreateObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCreateObjectRef { L"Function GFxUI.GFxMovie.CreateObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCreateObject )
-		pFnCreateObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.CreateObject" );
+	UFunction* const pFnCreateObject = pFnCreateObjectRef.Get ( );
 
 	UGFxMovie_execCreateObject_Parms CreateObject_Parms;
 	memcpy ( &CreateObject_Parms.ASClass, &ASClass, 0x10 );
 	CreateObject_Parms.Type = Type;
 
-	pFnCreateObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCreateObject, &CreateObject_Parms, NULL );
-
-	pFnCreateObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCreateObject, &CreateObject_Parms ) )
+		this->ProcessEvent ( pFnCreateObject, &CreateObject_Parms, NULL );
 
 	return CreateObject_Parms.ReturnValue;
 };
@@ -550,21 +471,17 @@ class UGFxValue* UGFxMovie::CreateObject ( FString const& ASClass, class UClass*
 
 bool UGFxMovie::SetVariableStringArray ( FString const& Path, int Index, TArray<FString> const& arg )
 {
-	static UFunction* pFnSetVariableStringArray = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetVariableStringArrayRef { L"Function GFxUI.GFxMovie.SetVariableStringArray", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetVariableStringArray )
-		pFnSetVariableStringArray = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetVariableStringArray" );
+	UFunction* const pFnSetVariableStringArray = pFnSetVariableStringArrayRef.Get ( );
 
 	UGFxMovie_execSetVariableStringArray_Parms SetVariableStringArray_Parms;
 	memcpy ( &SetVariableStringArray_Parms.Path, &Path, 0x10 );
 	SetVariableStringArray_Parms.Index = Index;
 	memcpy ( &SetVariableStringArray_Parms.arg, &arg, 0x10 );
 
-	pFnSetVariableStringArray->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetVariableStringArray, &SetVariableStringArray_Parms, NULL );
-
-	pFnSetVariableStringArray->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetVariableStringArray, &SetVariableStringArray_Parms ) )
+		this->ProcessEvent ( pFnSetVariableStringArray, &SetVariableStringArray_Parms, NULL );
 
 	return SetVariableStringArray_Parms.ReturnValue;
 };
@@ -579,21 +496,17 @@ bool UGFxMovie::SetVariableStringArray ( FString const& Path, int Index, TArray<
 
 bool UGFxMovie::SetVariableFloatArray ( FString const& Path, int Index, TArray<float> const& arg )
 {
-	static UFunction* pFnSetVariableFloatArray = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetVariableFloatArrayRef { L"Function GFxUI.GFxMovie.SetVariableFloatArray", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetVariableFloatArray )
-		pFnSetVariableFloatArray = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetVariableFloatArray" );
+	UFunction* const pFnSetVariableFloatArray = pFnSetVariableFloatArrayRef.Get ( );
 
 	UGFxMovie_execSetVariableFloatArray_Parms SetVariableFloatArray_Parms;
 	memcpy ( &SetVariableFloatArray_Parms.Path, &Path, 0x10 );
 	SetVariableFloatArray_Parms.Index = Index;
 	memcpy ( &SetVariableFloatArray_Parms.arg, &arg, 0x10 );
 
-	pFnSetVariableFloatArray->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetVariableFloatArray, &SetVariableFloatArray_Parms, NULL );
-
-	pFnSetVariableFloatArray->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetVariableFloatArray, &SetVariableFloatArray_Parms ) )
+		this->ProcessEvent ( pFnSetVariableFloatArray, &SetVariableFloatArray_Parms, NULL );
 
 	return SetVariableFloatArray_Parms.ReturnValue;
 };
@@ -608,21 +521,17 @@ bool UGFxMovie::SetVariableFloatArray ( FString const& Path, int Index, TArray<f
 
 bool UGFxMovie::SetVariableIntArray ( FString const& Path, int Index, TArray<int> const& arg )
 {
-	static UFunction* pFnSetVariableIntArray = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetVariableIntArrayRef { L"Function GFxUI.GFxMovie.SetVariableIntArray", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetVariableIntArray )
-		pFnSetVariableIntArray = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetVariableIntArray" );
+	UFunction* const pFnSetVariableIntArray = pFnSetVariableIntArrayRef.Get ( );
 
 	UGFxMovie_execSetVariableIntArray_Parms SetVariableIntArray_Parms;
 	memcpy ( &SetVariableIntArray_Parms.Path, &Path, 0x10 );
 	SetVariableIntArray_Parms.Index = Index;
 	memcpy ( &SetVariableIntArray_Parms.arg, &arg, 0x10 );
 
-	pFnSetVariableIntArray->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetVariableIntArray, &SetVariableIntArray_Parms, NULL );
-
-	pFnSetVariableIntArray->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetVariableIntArray, &SetVariableIntArray_Parms ) )
+		this->ProcessEvent ( pFnSetVariableIntArray, &SetVariableIntArray_Parms, NULL );
 
 	return SetVariableIntArray_Parms.ReturnValue;
 };
@@ -637,21 +546,17 @@ bool UGFxMovie::SetVariableIntArray ( FString const& Path, int Index, TArray<int
 
 bool UGFxMovie::SetVariableArray ( FString const& Path, int Index, TArray<struct FASValue> const& arg )
 {
-	static UFunction* pFnSetVariableArray = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetVariableArrayRef { L"Function GFxUI.GFxMovie.SetVariableArray", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetVariableArray )
-		pFnSetVariableArray = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetVariableArray" );
+	UFunction* const pFnSetVariableArray = pFnSetVariableArrayRef.Get ( );
 
 	UGFxMovie_execSetVariableArray_Parms SetVariableArray_Parms;
 	memcpy ( &SetVariableArray_Parms.Path, &Path, 0x10 );
 	SetVariableArray_Parms.Index = Index;
 	memcpy ( &SetVariableArray_Parms.arg, &arg, 0x10 );
 
-	pFnSetVariableArray->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetVariableArray, &SetVariableArray_Parms, NULL );
-
-	pFnSetVariableArray->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetVariableArray, &SetVariableArray_Parms ) )
+		this->ProcessEvent ( pFnSetVariableArray, &SetVariableArray_Parms, NULL );
 
 	return SetVariableArray_Parms.ReturnValue;
 };
@@ -666,10 +571,9 @@ bool UGFxMovie::SetVariableArray ( FString const& Path, int Index, TArray<struct
 
 bool UGFxMovie::GetVariableStringArray ( FString const& Path, int Index, TArray<FString>* arg )
 {
-	static UFunction* pFnGetVariableStringArray = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVariableStringArrayRef { L"Function GFxUI.GFxMovie.GetVariableStringArray", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVariableStringArray )
-		pFnGetVariableStringArray = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.GetVariableStringArray" );
+	UFunction* const pFnGetVariableStringArray = pFnGetVariableStringArrayRef.Get ( );
 
 	UGFxMovie_execGetVariableStringArray_Parms GetVariableStringArray_Parms;
 	memcpy ( &GetVariableStringArray_Parms.Path, &Path, 0x10 );
@@ -678,11 +582,8 @@ bool UGFxMovie::GetVariableStringArray ( FString const& Path, int Index, TArray<
 	if ( arg )
 		memcpy ( &GetVariableStringArray_Parms.arg, arg, 0x10 );
 
-	pFnGetVariableStringArray->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVariableStringArray, &GetVariableStringArray_Parms, NULL );
-
-	pFnGetVariableStringArray->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVariableStringArray, &GetVariableStringArray_Parms ) )
+		this->ProcessEvent ( pFnGetVariableStringArray, &GetVariableStringArray_Parms, NULL );
 
 	if ( arg )
 		memcpy ( arg, &GetVariableStringArray_Parms.arg, 0x10 );
@@ -700,10 +601,9 @@ bool UGFxMovie::GetVariableStringArray ( FString const& Path, int Index, TArray<
 
 bool UGFxMovie::GetVariableFloatArray ( FString const& Path, int Index, TArray<float>* arg )
 {
-	static UFunction* pFnGetVariableFloatArray = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVariableFloatArrayRef { L"Function GFxUI.GFxMovie.GetVariableFloatArray", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVariableFloatArray )
-		pFnGetVariableFloatArray = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.GetVariableFloatArray" );
+	UFunction* const pFnGetVariableFloatArray = pFnGetVariableFloatArrayRef.Get ( );
 
 	UGFxMovie_execGetVariableFloatArray_Parms GetVariableFloatArray_Parms;
 	memcpy ( &GetVariableFloatArray_Parms.Path, &Path, 0x10 );
@@ -712,11 +612,8 @@ bool UGFxMovie::GetVariableFloatArray ( FString const& Path, int Index, TArray<f
 	if ( arg )
 		memcpy ( &GetVariableFloatArray_Parms.arg, arg, 0x10 );
 
-	pFnGetVariableFloatArray->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVariableFloatArray, &GetVariableFloatArray_Parms, NULL );
-
-	pFnGetVariableFloatArray->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVariableFloatArray, &GetVariableFloatArray_Parms ) )
+		this->ProcessEvent ( pFnGetVariableFloatArray, &GetVariableFloatArray_Parms, NULL );
 
 	if ( arg )
 		memcpy ( arg, &GetVariableFloatArray_Parms.arg, 0x10 );
@@ -734,10 +631,9 @@ bool UGFxMovie::GetVariableFloatArray ( FString const& Path, int Index, TArray<f
 
 bool UGFxMovie::GetVariableIntArray ( FString const& Path, int Index, TArray<int>* arg )
 {
-	static UFunction* pFnGetVariableIntArray = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVariableIntArrayRef { L"Function GFxUI.GFxMovie.GetVariableIntArray", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVariableIntArray )
-		pFnGetVariableIntArray = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.GetVariableIntArray" );
+	UFunction* const pFnGetVariableIntArray = pFnGetVariableIntArrayRef.Get ( );
 
 	UGFxMovie_execGetVariableIntArray_Parms GetVariableIntArray_Parms;
 	memcpy ( &GetVariableIntArray_Parms.Path, &Path, 0x10 );
@@ -746,11 +642,8 @@ bool UGFxMovie::GetVariableIntArray ( FString const& Path, int Index, TArray<int
 	if ( arg )
 		memcpy ( &GetVariableIntArray_Parms.arg, arg, 0x10 );
 
-	pFnGetVariableIntArray->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVariableIntArray, &GetVariableIntArray_Parms, NULL );
-
-	pFnGetVariableIntArray->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVariableIntArray, &GetVariableIntArray_Parms ) )
+		this->ProcessEvent ( pFnGetVariableIntArray, &GetVariableIntArray_Parms, NULL );
 
 	if ( arg )
 		memcpy ( arg, &GetVariableIntArray_Parms.arg, 0x10 );
@@ -768,10 +661,9 @@ bool UGFxMovie::GetVariableIntArray ( FString const& Path, int Index, TArray<int
 
 bool UGFxMovie::GetVariableArray ( FString const& Path, int Index, TArray<struct FASValue>* arg )
 {
-	static UFunction* pFnGetVariableArray = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVariableArrayRef { L"Function GFxUI.GFxMovie.GetVariableArray", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVariableArray )
-		pFnGetVariableArray = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.GetVariableArray" );
+	UFunction* const pFnGetVariableArray = pFnGetVariableArrayRef.Get ( );
 
 	UGFxMovie_execGetVariableArray_Parms GetVariableArray_Parms;
 	memcpy ( &GetVariableArray_Parms.Path, &Path, 0x10 );
@@ -780,11 +672,8 @@ bool UGFxMovie::GetVariableArray ( FString const& Path, int Index, TArray<struct
 	if ( arg )
 		memcpy ( &GetVariableArray_Parms.arg, arg, 0x10 );
 
-	pFnGetVariableArray->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVariableArray, &GetVariableArray_Parms, NULL );
-
-	pFnGetVariableArray->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVariableArray, &GetVariableArray_Parms ) )
+		this->ProcessEvent ( pFnGetVariableArray, &GetVariableArray_Parms, NULL );
 
 	if ( arg )
 		memcpy ( arg, &GetVariableArray_Parms.arg, 0x10 );
@@ -800,20 +689,16 @@ bool UGFxMovie::GetVariableArray ( FString const& Path, int Index, TArray<struct
 
 void UGFxMovie::SetVariableString ( FString const& Path, FString const& S )
 {
-	static UFunction* pFnSetVariableString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetVariableStringRef { L"Function GFxUI.GFxMovie.SetVariableString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetVariableString )
-		pFnSetVariableString = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetVariableString" );
+	UFunction* const pFnSetVariableString = pFnSetVariableStringRef.Get ( );
 
 	UGFxMovie_execSetVariableString_Parms SetVariableString_Parms;
 	memcpy ( &SetVariableString_Parms.Path, &Path, 0x10 );
 	memcpy ( &SetVariableString_Parms.S, &S, 0x10 );
 
-	pFnSetVariableString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetVariableString, &SetVariableString_Parms, NULL );
-
-	pFnSetVariableString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetVariableString, &SetVariableString_Parms ) )
+		this->ProcessEvent ( pFnSetVariableString, &SetVariableString_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.SetVariableNumber
@@ -824,20 +709,16 @@ void UGFxMovie::SetVariableString ( FString const& Path, FString const& S )
 
 void UGFxMovie::SetVariableNumber ( FString const& Path, float F )
 {
-	static UFunction* pFnSetVariableNumber = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetVariableNumberRef { L"Function GFxUI.GFxMovie.SetVariableNumber", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetVariableNumber )
-		pFnSetVariableNumber = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetVariableNumber" );
+	UFunction* const pFnSetVariableNumber = pFnSetVariableNumberRef.Get ( );
 
 	UGFxMovie_execSetVariableNumber_Parms SetVariableNumber_Parms;
 	memcpy ( &SetVariableNumber_Parms.Path, &Path, 0x10 );
 	SetVariableNumber_Parms.F = F;
 
-	pFnSetVariableNumber->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetVariableNumber, &SetVariableNumber_Parms, NULL );
-
-	pFnSetVariableNumber->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetVariableNumber, &SetVariableNumber_Parms ) )
+		this->ProcessEvent ( pFnSetVariableNumber, &SetVariableNumber_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.SetVariableBool
@@ -848,20 +729,16 @@ void UGFxMovie::SetVariableNumber ( FString const& Path, float F )
 
 void UGFxMovie::SetVariableBool ( FString const& Path, unsigned long B )
 {
-	static UFunction* pFnSetVariableBool = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetVariableBoolRef { L"Function GFxUI.GFxMovie.SetVariableBool", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetVariableBool )
-		pFnSetVariableBool = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetVariableBool" );
+	UFunction* const pFnSetVariableBool = pFnSetVariableBoolRef.Get ( );
 
 	UGFxMovie_execSetVariableBool_Parms SetVariableBool_Parms;
 	memcpy ( &SetVariableBool_Parms.Path, &Path, 0x10 );
 	SetVariableBool_Parms.B = B;
 
-	pFnSetVariableBool->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetVariableBool, &SetVariableBool_Parms, NULL );
-
-	pFnSetVariableBool->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetVariableBool, &SetVariableBool_Parms ) )
+		this->ProcessEvent ( pFnSetVariableBool, &SetVariableBool_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.SetVariable
@@ -872,20 +749,16 @@ void UGFxMovie::SetVariableBool ( FString const& Path, unsigned long B )
 
 void UGFxMovie::SetVariable ( FString const& Path, struct FASValue const& arg )
 {
-	static UFunction* pFnSetVariable = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetVariableRef { L"Function GFxUI.GFxMovie.SetVariable", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetVariable )
-		pFnSetVariable = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetVariable" );
+	UFunction* const pFnSetVariable = pFnSetVariableRef.Get ( );
 
 	UGFxMovie_execSetVariable_Parms SetVariable_Parms;
 	memcpy ( &SetVariable_Parms.Path, &Path, 0x10 );
 	memcpy ( &SetVariable_Parms.arg, &arg, 0x1C );
 
-	pFnSetVariable->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetVariable, &SetVariable_Parms, NULL );
-
-	pFnSetVariable->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetVariable, &SetVariable_Parms ) )
+		this->ProcessEvent ( pFnSetVariable, &SetVariable_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.GetVariableString
@@ -896,19 +769,15 @@ void UGFxMovie::SetVariable ( FString const& Path, struct FASValue const& arg )
 
 FString UGFxMovie::GetVariableString ( FString const& Path )
 {
-	static UFunction* pFnGetVariableString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVariableStringRef { L"Function GFxUI.GFxMovie.GetVariableString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVariableString )
-		pFnGetVariableString = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.GetVariableString" );
+	UFunction* const pFnGetVariableString = pFnGetVariableStringRef.Get ( );
 
 	UGFxMovie_execGetVariableString_Parms GetVariableString_Parms;
 	memcpy ( &GetVariableString_Parms.Path, &Path, 0x10 );
 
-	pFnGetVariableString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVariableString, &GetVariableString_Parms, NULL );
-
-	pFnGetVariableString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVariableString, &GetVariableString_Parms ) )
+		this->ProcessEvent ( pFnGetVariableString, &GetVariableString_Parms, NULL );
 
 	return GetVariableString_Parms.ReturnValue;
 };
@@ -921,19 +790,15 @@ FString UGFxMovie::GetVariableString ( FString const& Path )
 
 float UGFxMovie::GetVariableNumber ( FString const& Path )
 {
-	static UFunction* pFnGetVariableNumber = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVariableNumberRef { L"Function GFxUI.GFxMovie.GetVariableNumber", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVariableNumber )
-		pFnGetVariableNumber = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.GetVariableNumber" );
+	UFunction* const pFnGetVariableNumber = pFnGetVariableNumberRef.Get ( );
 
 	UGFxMovie_execGetVariableNumber_Parms GetVariableNumber_Parms;
 	memcpy ( &GetVariableNumber_Parms.Path, &Path, 0x10 );
 
-	pFnGetVariableNumber->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVariableNumber, &GetVariableNumber_Parms, NULL );
-
-	pFnGetVariableNumber->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVariableNumber, &GetVariableNumber_Parms ) )
+		this->ProcessEvent ( pFnGetVariableNumber, &GetVariableNumber_Parms, NULL );
 
 	return GetVariableNumber_Parms.ReturnValue;
 };
@@ -946,19 +811,15 @@ float UGFxMovie::GetVariableNumber ( FString const& Path )
 
 bool UGFxMovie::GetVariableBool ( FString const& Path )
 {
-	static UFunction* pFnGetVariableBool = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVariableBoolRef { L"Function GFxUI.GFxMovie.GetVariableBool", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVariableBool )
-		pFnGetVariableBool = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.GetVariableBool" );
+	UFunction* const pFnGetVariableBool = pFnGetVariableBoolRef.Get ( );
 
 	UGFxMovie_execGetVariableBool_Parms GetVariableBool_Parms;
 	memcpy ( &GetVariableBool_Parms.Path, &Path, 0x10 );
 
-	pFnGetVariableBool->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVariableBool, &GetVariableBool_Parms, NULL );
-
-	pFnGetVariableBool->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVariableBool, &GetVariableBool_Parms ) )
+		this->ProcessEvent ( pFnGetVariableBool, &GetVariableBool_Parms, NULL );
 
 	return GetVariableBool_Parms.ReturnValue;
 };
@@ -971,19 +832,15 @@ bool UGFxMovie::GetVariableBool ( FString const& Path )
 
 struct FASValue UGFxMovie::GetVariable ( FString const& Path )
 {
-	static UFunction* pFnGetVariable = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVariableRef { L"Function GFxUI.GFxMovie.GetVariable", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVariable )
-		pFnGetVariable = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.GetVariable" );
+	UFunction* const pFnGetVariable = pFnGetVariableRef.Get ( );
 
 	UGFxMovie_execGetVariable_Parms GetVariable_Parms;
 	memcpy ( &GetVariable_Parms.Path, &Path, 0x10 );
 
-	pFnGetVariable->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVariable, &GetVariable_Parms, NULL );
-
-	pFnGetVariable->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVariable, &GetVariable_Parms ) )
+		this->ProcessEvent ( pFnGetVariable, &GetVariable_Parms, NULL );
 
 	return GetVariable_Parms.ReturnValue;
 };
@@ -994,18 +851,14 @@ struct FASValue UGFxMovie::GetVariable ( FString const& Path )
 
 void UGFxMovie::PublishDataStoreValues ( )
 {
-	static UFunction* pFnPublishDataStoreValues = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPublishDataStoreValuesRef { L"Function GFxUI.GFxMovie.PublishDataStoreValues", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPublishDataStoreValues )
-		pFnPublishDataStoreValues = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.PublishDataStoreValues" );
+	UFunction* const pFnPublishDataStoreValues = pFnPublishDataStoreValuesRef.Get ( );
 
 	UGFxMovie_execPublishDataStoreValues_Parms PublishDataStoreValues_Parms;
 
-	pFnPublishDataStoreValues->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnPublishDataStoreValues, &PublishDataStoreValues_Parms, NULL );
-
-	pFnPublishDataStoreValues->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnPublishDataStoreValues, &PublishDataStoreValues_Parms ) )
+		this->ProcessEvent ( pFnPublishDataStoreValues, &PublishDataStoreValues_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.RefreshDataStoreBindings
@@ -1014,18 +867,14 @@ void UGFxMovie::PublishDataStoreValues ( )
 
 void UGFxMovie::RefreshDataStoreBindings ( )
 {
-	static UFunction* pFnRefreshDataStoreBindings = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRefreshDataStoreBindingsRef { L"Function GFxUI.GFxMovie.RefreshDataStoreBindings", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRefreshDataStoreBindings )
-		pFnRefreshDataStoreBindings = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.RefreshDataStoreBindings" );
+	UFunction* const pFnRefreshDataStoreBindings = pFnRefreshDataStoreBindingsRef.Get ( );
 
 	UGFxMovie_execRefreshDataStoreBindings_Parms RefreshDataStoreBindings_Parms;
 
-	pFnRefreshDataStoreBindings->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRefreshDataStoreBindings, &RefreshDataStoreBindings_Parms, NULL );
-
-	pFnRefreshDataStoreBindings->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRefreshDataStoreBindings, &RefreshDataStoreBindings_Parms ) )
+		this->ProcessEvent ( pFnRefreshDataStoreBindings, &RefreshDataStoreBindings_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.Invoke
@@ -1037,20 +886,16 @@ void UGFxMovie::RefreshDataStoreBindings ( )
 
 struct FASValue UGFxMovie::Invoke ( FString const& method, TArray<struct FASValue> const& Args )
 {
-	static UFunction* pFnInvoke = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInvokeRef { L"Function GFxUI.GFxMovie.Invoke", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInvoke )
-		pFnInvoke = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.Invoke" );
+	UFunction* const pFnInvoke = pFnInvokeRef.Get ( );
 
 	UGFxMovie_execInvoke_Parms Invoke_Parms;
 	memcpy ( &Invoke_Parms.method, &method, 0x10 );
 	memcpy ( &Invoke_Parms.Args, &Args, 0x10 );
 
-	pFnInvoke->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnInvoke, &Invoke_Parms, NULL );
-
-	pFnInvoke->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnInvoke, &Invoke_Parms ) )
+		this->ProcessEvent ( pFnInvoke, &Invoke_Parms, NULL );
 
 	return Invoke_Parms.ReturnValue;
 };
@@ -1062,18 +907,14 @@ struct FASValue UGFxMovie::Invoke ( FString const& method, TArray<struct FASValu
 
 class APlayerController* UGFxMovie::GetPC ( )
 {
-	static UFunction* pFnGetPC = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPCRef { L"Function GFxUI.GFxMovie.GetPC", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPC )
-		pFnGetPC = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.GetPC" );
+	UFunction* const pFnGetPC = pFnGetPCRef.Get ( );
 
 	UGFxMovie_execGetPC_Parms GetPC_Parms;
 
-	pFnGetPC->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetPC, &GetPC_Parms, NULL );
-
-	pFnGetPC->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetPC, &GetPC_Parms ) )
+		this->ProcessEvent ( pFnGetPC, &GetPC_Parms, NULL );
 
 	return GetPC_Parms.ReturnValue;
 };
@@ -1085,18 +926,14 @@ class APlayerController* UGFxMovie::GetPC ( )
 
 class ULocalPlayer* UGFxMovie::GetLP ( )
 {
-	static UFunction* pFnGetLP = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLPRef { L"Function GFxUI.GFxMovie.GetLP", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLP )
-		pFnGetLP = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.GetLP" );
+	UFunction* const pFnGetLP = pFnGetLPRef.Get ( );
 
 	UGFxMovie_execGetLP_Parms GetLP_Parms;
 
-	pFnGetLP->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetLP, &GetLP_Parms, NULL );
-
-	pFnGetLP->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetLP, &GetLP_Parms ) )
+		this->ProcessEvent ( pFnGetLP, &GetLP_Parms, NULL );
 
 	return GetLP_Parms.ReturnValue;
 };
@@ -1108,19 +945,15 @@ class ULocalPlayer* UGFxMovie::GetLP ( )
 
 void UGFxMovie::SetTimingMode ( unsigned char Mode )
 {
-	static UFunction* pFnSetTimingMode = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetTimingModeRef { L"Function GFxUI.GFxMovie.SetTimingMode", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetTimingMode )
-		pFnSetTimingMode = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetTimingMode" );
+	UFunction* const pFnSetTimingMode = pFnSetTimingModeRef.Get ( );
 
 	UGFxMovie_execSetTimingMode_Parms SetTimingMode_Parms;
 	SetTimingMode_Parms.Mode = Mode;
 
-	pFnSetTimingMode->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetTimingMode, &SetTimingMode_Parms, NULL );
-
-	pFnSetTimingMode->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetTimingMode, &SetTimingMode_Parms ) )
+		this->ProcessEvent ( pFnSetTimingMode, &SetTimingMode_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.Pause
@@ -1130,19 +963,15 @@ void UGFxMovie::SetTimingMode ( unsigned char Mode )
 
 void UGFxMovie::Pause ( unsigned long pauseplay )
 {
-	static UFunction* pFnPause = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPauseRef { L"Function GFxUI.GFxMovie.Pause", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPause )
-		pFnPause = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.Pause" );
+	UFunction* const pFnPause = pFnPauseRef.Get ( );
 
 	UGFxMovie_execPause_Parms Pause_Parms;
 	Pause_Parms.pauseplay = pauseplay;
 
-	pFnPause->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnPause, &Pause_Parms, NULL );
-
-	pFnPause->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnPause, &Pause_Parms ) )
+		this->ProcessEvent ( pFnPause, &Pause_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.Update
@@ -1152,19 +981,15 @@ void UGFxMovie::Pause ( unsigned long pauseplay )
 
 void UGFxMovie::Update ( float fDeltaT )
 {
-	static UFunction* pFnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdateRef { L"Function GFxUI.GFxMovie.Update", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdate )
-		pFnUpdate = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.Update" );
+	UFunction* const pFnUpdate = pFnUpdateRef.Get ( );
 
 	UGFxMovie_execUpdate_Parms Update_Parms;
 	Update_Parms.fDeltaT = fDeltaT;
 
-	pFnUpdate->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnUpdate, &Update_Parms, NULL );
-
-	pFnUpdate->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnUpdate, &Update_Parms ) )
+		this->ProcessEvent ( pFnUpdate, &Update_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.Advance
@@ -1174,19 +999,15 @@ void UGFxMovie::Update ( float fDeltaT )
 
 void UGFxMovie::Advance ( float Time )
 {
-	static UFunction* pFnAdvance = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAdvanceRef { L"Function GFxUI.GFxMovie.Advance", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAdvance )
-		pFnAdvance = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.Advance" );
+	UFunction* const pFnAdvance = pFnAdvanceRef.Get ( );
 
 	UGFxMovie_execAdvance_Parms Advance_Parms;
 	Advance_Parms.Time = Time;
 
-	pFnAdvance->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAdvance, &Advance_Parms, NULL );
-
-	pFnAdvance->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAdvance, &Advance_Parms ) )
+		this->ProcessEvent ( pFnAdvance, &Advance_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.SetExternalTexture
@@ -1198,20 +1019,16 @@ void UGFxMovie::Advance ( float Time )
 
 bool UGFxMovie::SetExternalTexture ( FString const& Resource, class UTexture* Texture )
 {
-	static UFunction* pFnSetExternalTexture = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetExternalTextureRef { L"Function GFxUI.GFxMovie.SetExternalTexture", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetExternalTexture )
-		pFnSetExternalTexture = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetExternalTexture" );
+	UFunction* const pFnSetExternalTexture = pFnSetExternalTextureRef.Get ( );
 
 	UGFxMovie_execSetExternalTexture_Parms SetExternalTexture_Parms;
 	memcpy ( &SetExternalTexture_Parms.Resource, &Resource, 0x10 );
 	SetExternalTexture_Parms.Texture = Texture;
 
-	pFnSetExternalTexture->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetExternalTexture, &SetExternalTexture_Parms, NULL );
-
-	pFnSetExternalTexture->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetExternalTexture, &SetExternalTexture_Parms ) )
+		this->ProcessEvent ( pFnSetExternalTexture, &SetExternalTexture_Parms, NULL );
 
 	return SetExternalTexture_Parms.ReturnValue;
 };
@@ -1223,18 +1040,14 @@ bool UGFxMovie::SetExternalTexture ( FString const& Resource, class UTexture* Te
 
 bool UGFxMovie::IsUsingGamepad ( )
 {
-	static UFunction* pFnIsUsingGamepad = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsUsingGamepadRef { L"Function GFxUI.GFxMovie.IsUsingGamepad", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsUsingGamepad )
-		pFnIsUsingGamepad = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.IsUsingGamepad" );
+	UFunction* const pFnIsUsingGamepad = pFnIsUsingGamepadRef.Get ( );
 
 	UGFxMovie_execIsUsingGamepad_Parms IsUsingGamepad_Parms;
 
-	pFnIsUsingGamepad->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsUsingGamepad, &IsUsingGamepad_Parms, NULL );
-
-	pFnIsUsingGamepad->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsUsingGamepad, &IsUsingGamepad_Parms ) )
+		this->ProcessEvent ( pFnIsUsingGamepad, &IsUsingGamepad_Parms, NULL );
 
 	return IsUsingGamepad_Parms.ReturnValue;
 };
@@ -1246,19 +1059,15 @@ bool UGFxMovie::IsUsingGamepad ( )
 
 void UGFxMovie::FlushPlayerInput ( unsigned long capturekeysonly )
 {
-	static UFunction* pFnFlushPlayerInput = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFlushPlayerInputRef { L"Function GFxUI.GFxMovie.FlushPlayerInput", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFlushPlayerInput )
-		pFnFlushPlayerInput = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.FlushPlayerInput" );
+	UFunction* const pFnFlushPlayerInput = pFnFlushPlayerInputRef.Get ( );
 
 	UGFxMovie_execFlushPlayerInput_Parms FlushPlayerInput_Parms;
 	FlushPlayerInput_Parms.capturekeysonly = capturekeysonly;
 
-	pFnFlushPlayerInput->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFlushPlayerInput, &FlushPlayerInput_Parms, NULL );
-
-	pFnFlushPlayerInput->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFlushPlayerInput, &FlushPlayerInput_Parms ) )
+		this->ProcessEvent ( pFnFlushPlayerInput, &FlushPlayerInput_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.ClearFocusIgnoreKeys
@@ -1267,18 +1076,14 @@ void UGFxMovie::FlushPlayerInput ( unsigned long capturekeysonly )
 
 void UGFxMovie::ClearFocusIgnoreKeys ( )
 {
-	static UFunction* pFnClearFocusIgnoreKeys = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearFocusIgnoreKeysRef { L"Function GFxUI.GFxMovie.ClearFocusIgnoreKeys", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearFocusIgnoreKeys )
-		pFnClearFocusIgnoreKeys = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.ClearFocusIgnoreKeys" );
+	UFunction* const pFnClearFocusIgnoreKeys = pFnClearFocusIgnoreKeysRef.Get ( );
 
 	UGFxMovie_execClearFocusIgnoreKeys_Parms ClearFocusIgnoreKeys_Parms;
 
-	pFnClearFocusIgnoreKeys->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnClearFocusIgnoreKeys, &ClearFocusIgnoreKeys_Parms, NULL );
-
-	pFnClearFocusIgnoreKeys->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnClearFocusIgnoreKeys, &ClearFocusIgnoreKeys_Parms ) )
+		this->ProcessEvent ( pFnClearFocusIgnoreKeys, &ClearFocusIgnoreKeys_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.AddFocusIgnoreKey
@@ -1288,19 +1093,15 @@ void UGFxMovie::ClearFocusIgnoreKeys ( )
 
 void UGFxMovie::AddFocusIgnoreKey ( struct SFXName Key )
 {
-	static UFunction* pFnAddFocusIgnoreKey = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddFocusIgnoreKeyRef { L"Function GFxUI.GFxMovie.AddFocusIgnoreKey", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddFocusIgnoreKey )
-		pFnAddFocusIgnoreKey = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.AddFocusIgnoreKey" );
+	UFunction* const pFnAddFocusIgnoreKey = pFnAddFocusIgnoreKeyRef.Get ( );
 
 	UGFxMovie_execAddFocusIgnoreKey_Parms AddFocusIgnoreKey_Parms;
 	memcpy ( &AddFocusIgnoreKey_Parms.Key, &Key, 0x8 );
 
-	pFnAddFocusIgnoreKey->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddFocusIgnoreKey, &AddFocusIgnoreKey_Parms, NULL );
-
-	pFnAddFocusIgnoreKey->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAddFocusIgnoreKey, &AddFocusIgnoreKey_Parms ) )
+		this->ProcessEvent ( pFnAddFocusIgnoreKey, &AddFocusIgnoreKey_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.ClearCaptureKeys
@@ -1309,18 +1110,14 @@ void UGFxMovie::AddFocusIgnoreKey ( struct SFXName Key )
 
 void UGFxMovie::ClearCaptureKeys ( )
 {
-	static UFunction* pFnClearCaptureKeys = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearCaptureKeysRef { L"Function GFxUI.GFxMovie.ClearCaptureKeys", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearCaptureKeys )
-		pFnClearCaptureKeys = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.ClearCaptureKeys" );
+	UFunction* const pFnClearCaptureKeys = pFnClearCaptureKeysRef.Get ( );
 
 	UGFxMovie_execClearCaptureKeys_Parms ClearCaptureKeys_Parms;
 
-	pFnClearCaptureKeys->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnClearCaptureKeys, &ClearCaptureKeys_Parms, NULL );
-
-	pFnClearCaptureKeys->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnClearCaptureKeys, &ClearCaptureKeys_Parms ) )
+		this->ProcessEvent ( pFnClearCaptureKeys, &ClearCaptureKeys_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.AddCaptureKey
@@ -1330,19 +1127,15 @@ void UGFxMovie::ClearCaptureKeys ( )
 
 void UGFxMovie::AddCaptureKey ( struct SFXName Key )
 {
-	static UFunction* pFnAddCaptureKey = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddCaptureKeyRef { L"Function GFxUI.GFxMovie.AddCaptureKey", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddCaptureKey )
-		pFnAddCaptureKey = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.AddCaptureKey" );
+	UFunction* const pFnAddCaptureKey = pFnAddCaptureKeyRef.Get ( );
 
 	UGFxMovie_execAddCaptureKey_Parms AddCaptureKey_Parms;
 	memcpy ( &AddCaptureKey_Parms.Key, &Key, 0x8 );
 
-	pFnAddCaptureKey->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddCaptureKey, &AddCaptureKey_Parms, NULL );
-
-	pFnAddCaptureKey->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAddCaptureKey, &AddCaptureKey_Parms ) )
+		this->ProcessEvent ( pFnAddCaptureKey, &AddCaptureKey_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.SetFocus
@@ -1353,20 +1146,16 @@ void UGFxMovie::AddCaptureKey ( struct SFXName Key )
 
 void UGFxMovie::SetFocus ( unsigned long captureInput, unsigned long Focus )
 {
-	static UFunction* pFnSetFocus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetFocusRef { L"Function GFxUI.GFxMovie.SetFocus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetFocus )
-		pFnSetFocus = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetFocus" );
+	UFunction* const pFnSetFocus = pFnSetFocusRef.Get ( );
 
 	UGFxMovie_execSetFocus_Parms SetFocus_Parms;
 	SetFocus_Parms.captureInput = captureInput;
 	SetFocus_Parms.Focus = Focus;
 
-	pFnSetFocus->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetFocus, &SetFocus_Parms, NULL );
-
-	pFnSetFocus->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetFocus, &SetFocus_Parms ) )
+		this->ProcessEvent ( pFnSetFocus, &SetFocus_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.SetSceneDPG
@@ -1376,19 +1165,15 @@ void UGFxMovie::SetFocus ( unsigned long captureInput, unsigned long Focus )
 
 void UGFxMovie::SetSceneDPG ( unsigned char NewDPG )
 {
-	static UFunction* pFnSetSceneDPG = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetSceneDPGRef { L"Function GFxUI.GFxMovie.SetSceneDPG", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetSceneDPG )
-		pFnSetSceneDPG = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetSceneDPG" );
+	UFunction* const pFnSetSceneDPG = pFnSetSceneDPGRef.Get ( );
 
 	UGFxMovie_execSetSceneDPG_Parms SetSceneDPG_Parms;
 	SetSceneDPG_Parms.NewDPG = NewDPG;
 
-	pFnSetSceneDPG->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetSceneDPG, &SetSceneDPG_Parms, NULL );
-
-	pFnSetSceneDPG->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetSceneDPG, &SetSceneDPG_Parms ) )
+		this->ProcessEvent ( pFnSetSceneDPG, &SetSceneDPG_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.SetPerspective3D
@@ -1398,21 +1183,17 @@ void UGFxMovie::SetSceneDPG ( unsigned char NewDPG )
 
 void UGFxMovie::SetPerspective3D ( struct FMatrix* matPersp )
 {
-	static UFunction* pFnSetPerspective3D = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetPerspective3DRef { L"Function GFxUI.GFxMovie.SetPerspective3D", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetPerspective3D )
-		pFnSetPerspective3D = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetPerspective3D" );
+	UFunction* const pFnSetPerspective3D = pFnSetPerspective3DRef.Get ( );
 
 	UGFxMovie_execSetPerspective3D_Parms SetPerspective3D_Parms;
 
 	if ( matPersp )
 		memcpy ( &SetPerspective3D_Parms.matPersp, matPersp, 0x40 );
 
-	pFnSetPerspective3D->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetPerspective3D, &SetPerspective3D_Parms, NULL );
-
-	pFnSetPerspective3D->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetPerspective3D, &SetPerspective3D_Parms ) )
+		this->ProcessEvent ( pFnSetPerspective3D, &SetPerspective3D_Parms, NULL );
 
 	if ( matPersp )
 		memcpy ( matPersp, &SetPerspective3D_Parms.matPersp, 0x40 );
@@ -1425,21 +1206,17 @@ void UGFxMovie::SetPerspective3D ( struct FMatrix* matPersp )
 
 void UGFxMovie::SetView3D ( struct FMatrix* matView )
 {
-	static UFunction* pFnSetView3D = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetView3DRef { L"Function GFxUI.GFxMovie.SetView3D", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetView3D )
-		pFnSetView3D = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetView3D" );
+	UFunction* const pFnSetView3D = pFnSetView3DRef.Get ( );
 
 	UGFxMovie_execSetView3D_Parms SetView3D_Parms;
 
 	if ( matView )
 		memcpy ( &SetView3D_Parms.matView, matView, 0x40 );
 
-	pFnSetView3D->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetView3D, &SetView3D_Parms, NULL );
-
-	pFnSetView3D->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetView3D, &SetView3D_Parms ) )
+		this->ProcessEvent ( pFnSetView3D, &SetView3D_Parms, NULL );
 
 	if ( matView )
 		memcpy ( matView, &SetView3D_Parms.matView, 0x40 );
@@ -1455,10 +1232,9 @@ void UGFxMovie::SetView3D ( struct FMatrix* matView )
 
 void UGFxMovie::GetVisibleFrameRect ( float* x0, float* y0, float* X1, float* Y1 )
 {
-	static UFunction* pFnGetVisibleFrameRect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVisibleFrameRectRef { L"Function GFxUI.GFxMovie.GetVisibleFrameRect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVisibleFrameRect )
-		pFnGetVisibleFrameRect = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.GetVisibleFrameRect" );
+	UFunction* const pFnGetVisibleFrameRect = pFnGetVisibleFrameRectRef.Get ( );
 
 	UGFxMovie_execGetVisibleFrameRect_Parms GetVisibleFrameRect_Parms;
 
@@ -1474,11 +1250,8 @@ void UGFxMovie::GetVisibleFrameRect ( float* x0, float* y0, float* X1, float* Y1
 	if ( Y1 )
 		GetVisibleFrameRect_Parms.Y1 = *Y1;
 
-	pFnGetVisibleFrameRect->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVisibleFrameRect, &GetVisibleFrameRect_Parms, NULL );
-
-	pFnGetVisibleFrameRect->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVisibleFrameRect, &GetVisibleFrameRect_Parms ) )
+		this->ProcessEvent ( pFnGetVisibleFrameRect, &GetVisibleFrameRect_Parms, NULL );
 
 	if ( x0 )
 		*x0 = GetVisibleFrameRect_Parms.x0;
@@ -1500,19 +1273,15 @@ void UGFxMovie::GetVisibleFrameRect ( float* x0, float* y0, float* X1, float* Y1
 
 void UGFxMovie::SetAlignment ( unsigned char A )
 {
-	static UFunction* pFnSetAlignment = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetAlignmentRef { L"Function GFxUI.GFxMovie.SetAlignment", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetAlignment )
-		pFnSetAlignment = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetAlignment" );
+	UFunction* const pFnSetAlignment = pFnSetAlignmentRef.Get ( );
 
 	UGFxMovie_execSetAlignment_Parms SetAlignment_Parms;
 	SetAlignment_Parms.A = A;
 
-	pFnSetAlignment->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetAlignment, &SetAlignment_Parms, NULL );
-
-	pFnSetAlignment->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetAlignment, &SetAlignment_Parms ) )
+		this->ProcessEvent ( pFnSetAlignment, &SetAlignment_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.SetViewScaleMode
@@ -1522,19 +1291,15 @@ void UGFxMovie::SetAlignment ( unsigned char A )
 
 void UGFxMovie::SetViewScaleMode ( unsigned char sm )
 {
-	static UFunction* pFnSetViewScaleMode = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetViewScaleModeRef { L"Function GFxUI.GFxMovie.SetViewScaleMode", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetViewScaleMode )
-		pFnSetViewScaleMode = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetViewScaleMode" );
+	UFunction* const pFnSetViewScaleMode = pFnSetViewScaleModeRef.Get ( );
 
 	UGFxMovie_execSetViewScaleMode_Parms SetViewScaleMode_Parms;
 	SetViewScaleMode_Parms.sm = sm;
 
-	pFnSetViewScaleMode->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetViewScaleMode, &SetViewScaleMode_Parms, NULL );
-
-	pFnSetViewScaleMode->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetViewScaleMode, &SetViewScaleMode_Parms ) )
+		this->ProcessEvent ( pFnSetViewScaleMode, &SetViewScaleMode_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.SetViewport
@@ -1547,10 +1312,9 @@ void UGFxMovie::SetViewScaleMode ( unsigned char sm )
 
 void UGFxMovie::SetViewport ( int X, int Y, int Width, int Height )
 {
-	static UFunction* pFnSetViewport = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetViewportRef { L"Function GFxUI.GFxMovie.SetViewport", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetViewport )
-		pFnSetViewport = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetViewport" );
+	UFunction* const pFnSetViewport = pFnSetViewportRef.Get ( );
 
 	UGFxMovie_execSetViewport_Parms SetViewport_Parms;
 	SetViewport_Parms.X = X;
@@ -1558,11 +1322,8 @@ void UGFxMovie::SetViewport ( int X, int Y, int Width, int Height )
 	SetViewport_Parms.Width = Width;
 	SetViewport_Parms.Height = Height;
 
-	pFnSetViewport->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetViewport, &SetViewport_Parms, NULL );
-
-	pFnSetViewport->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetViewport, &SetViewport_Parms ) )
+		this->ProcessEvent ( pFnSetViewport, &SetViewport_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.GetGameViewportClient
@@ -1572,18 +1333,14 @@ void UGFxMovie::SetViewport ( int X, int Y, int Width, int Height )
 
 class UGameViewportClient* UGFxMovie::GetGameViewportClient ( )
 {
-	static UFunction* pFnGetGameViewportClient = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetGameViewportClientRef { L"Function GFxUI.GFxMovie.GetGameViewportClient", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetGameViewportClient )
-		pFnGetGameViewportClient = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.GetGameViewportClient" );
+	UFunction* const pFnGetGameViewportClient = pFnGetGameViewportClientRef.Get ( );
 
 	UGFxMovie_execGetGameViewportClient_Parms GetGameViewportClient_Parms;
 
-	pFnGetGameViewportClient->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetGameViewportClient, &GetGameViewportClient_Parms, NULL );
-
-	pFnGetGameViewportClient->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetGameViewportClient, &GetGameViewportClient_Parms ) )
+		this->ProcessEvent ( pFnGetGameViewportClient, &GetGameViewportClient_Parms, NULL );
 
 	return GetGameViewportClient_Parms.ReturnValue;
 };
@@ -1595,10 +1352,9 @@ class UGameViewportClient* UGFxMovie::GetGameViewportClient ( )
 
 void UGFxMovie::SetMovieInfo ( class UGFxMovieInfo* Data )
 {
-	static UFunction* pFnSetMovieInfo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetMovieInfoRef { L"Function GFxUI.GFxMovie.SetMovieInfo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetMovieInfo )
-		pFnSetMovieInfo = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.SetMovieInfo" );
+	UFunction* const pFnSetMovieInfo = pFnSetMovieInfoRef.Get ( );
 
 	UGFxMovie_execSetMovieInfo_Parms SetMovieInfo_Parms;
 	SetMovieInfo_Parms.Data = Data;
@@ -1612,10 +1368,9 @@ void UGFxMovie::SetMovieInfo ( class UGFxMovieInfo* Data )
 
 void UGFxMovie::eventOnClose ( )
 {
-	static UFunction* pFnOnClose = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnCloseRef { L"Function GFxUI.GFxMovie.OnClose", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnClose )
-		pFnOnClose = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.OnClose" );
+	UFunction* const pFnOnClose = pFnOnCloseRef.Get ( );
 
 	UGFxMovie_eventOnClose_Parms OnClose_Parms;
 
@@ -1629,19 +1384,15 @@ void UGFxMovie::eventOnClose ( )
 
 void UGFxMovie::Close ( unsigned long Unload )
 {
-	static UFunction* pFnClose = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCloseRef { L"Function GFxUI.GFxMovie.Close", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClose )
-		pFnClose = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.Close" );
+	UFunction* const pFnClose = pFnCloseRef.Get ( );
 
 	UGFxMovie_execClose_Parms Close_Parms;
 	Close_Parms.Unload = Unload;
 
-	pFnClose->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnClose, &Close_Parms, NULL );
-
-	pFnClose->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnClose, &Close_Parms ) )
+		this->ProcessEvent ( pFnClose, &Close_Parms, NULL );
 };
 
 // Function GFxUI.GFxMovie.Start
@@ -1652,45 +1403,35 @@ void UGFxMovie::Close ( unsigned long Unload )
 
 bool UGFxMovie::eventStart ( unsigned long StartPaused )
 {
-	static UFunction* pFnStart = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartRef { L"Function GFxUI.GFxMovie.Start", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStart )
-		pFnStart = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxMovie.Start" );
+	UFunction* const pFnStart = pFnStartRef.Get ( );
 
 	UGFxMovie_eventStart_Parms Start_Parms;
 	Start_Parms.StartPaused = StartPaused;
 
-	pFnStart->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnStart, &Start_Parms, NULL );
-
-	pFnStart->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnStart, &Start_Parms ) )
+		this->ProcessEvent ( pFnStart, &Start_Parms, NULL );
 
 	return Start_Parms.ReturnValue;
 };
 
 
 
-class UClass* UGFxMovieInfo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxMovieInfo::pClassPointer { L"Class GFxUI.GFxMovieInfo", &UObject::FindClass };
 
 class UClass* UGFxMovieInfo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxMovieInfo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UGFxValue::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxValue::pClassPointer { L"Class GFxUI.GFxValue", &UObject::FindClass };
 
 class UClass* UGFxValue::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxValue" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function GFxUI.GFxValue.ActionScriptSetFunctionOn
@@ -1701,20 +1442,16 @@ class UClass* UGFxValue::StaticClass()
 
 void UGFxValue::ActionScriptSetFunctionOn ( class UGFxValue* Target, FString const& member )
 {
-	static UFunction* pFnActionScriptSetFunctionOn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActionScriptSetFunctionOnRef { L"Function GFxUI.GFxValue.ActionScriptSetFunctionOn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActionScriptSetFunctionOn )
-		pFnActionScriptSetFunctionOn = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.ActionScriptSetFunctionOn" );
+	UFunction* const pFnActionScriptSetFunctionOn = pFnActionScriptSetFunctionOnRef.Get ( );
 
 	UGFxValue_execActionScriptSetFunctionOn_Parms ActionScriptSetFunctionOn_Parms;
 	ActionScriptSetFunctionOn_Parms.Target = Target;
 	memcpy ( &ActionScriptSetFunctionOn_Parms.member, &member, 0x10 );
 
-	pFnActionScriptSetFunctionOn->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnActionScriptSetFunctionOn, &ActionScriptSetFunctionOn_Parms, NULL );
-
-	pFnActionScriptSetFunctionOn->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnActionScriptSetFunctionOn, &ActionScriptSetFunctionOn_Parms ) )
+		this->ProcessEvent ( pFnActionScriptSetFunctionOn, &ActionScriptSetFunctionOn_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.ActionScriptSetFunction
@@ -1724,19 +1461,15 @@ void UGFxValue::ActionScriptSetFunctionOn ( class UGFxValue* Target, FString con
 
 void UGFxValue::ActionScriptSetFunction ( FString const& member )
 {
-	static UFunction* pFnActionScriptSetFunction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActionScriptSetFunctionRef { L"Function GFxUI.GFxValue.ActionScriptSetFunction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActionScriptSetFunction )
-		pFnActionScriptSetFunction = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.ActionScriptSetFunction" );
+	UFunction* const pFnActionScriptSetFunction = pFnActionScriptSetFunctionRef.Get ( );
 
 	UGFxValue_execActionScriptSetFunction_Parms ActionScriptSetFunction_Parms;
 	memcpy ( &ActionScriptSetFunction_Parms.member, &member, 0x10 );
 
-	pFnActionScriptSetFunction->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnActionScriptSetFunction, &ActionScriptSetFunction_Parms, NULL );
-
-	pFnActionScriptSetFunction->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnActionScriptSetFunction, &ActionScriptSetFunction_Parms ) )
+		this->ProcessEvent ( pFnActionScriptSetFunction, &ActionScriptSetFunction_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.ActionScriptArray
@@ -1747,19 +1480,15 @@ void UGFxValue::ActionScriptSetFunction ( FString const& member )
 
 TArray<class UGFxValue*> UGFxValue::ActionScriptArray ( FString const& Path )
 {
-	static UFunction* pFnActionScriptArray = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActionScriptArrayRef { L"Function GFxUI.GFxValue.ActionScriptArray", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActionScriptArray )
-		pFnActionScriptArray = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.ActionScriptArray" );
+	UFunction* const pFnActionScriptArray = pFnActionScriptArrayRef.Get ( );
 
 	UGFxValue_execActionScriptArray_Parms ActionScriptArray_Parms;
 	memcpy ( &ActionScriptArray_Parms.Path, &Path, 0x10 );
 
-	pFnActionScriptArray->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnActionScriptArray, &ActionScriptArray_Parms, NULL );
-
-	pFnActionScriptArray->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnActionScriptArray, &ActionScriptArray_Parms ) )
+		this->ProcessEvent ( pFnActionScriptArray, &ActionScriptArray_Parms, NULL );
 
 	return ActionScriptArray_Parms.ReturnValue;
 };
@@ -1772,19 +1501,15 @@ TArray<class UGFxValue*> UGFxValue::ActionScriptArray ( FString const& Path )
 
 class UGFxValue* UGFxValue::ActionScriptObject ( FString const& Path )
 {
-	static UFunction* pFnActionScriptObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActionScriptObjectRef { L"Function GFxUI.GFxValue.ActionScriptObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActionScriptObject )
-		pFnActionScriptObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.ActionScriptObject" );
+	UFunction* const pFnActionScriptObject = pFnActionScriptObjectRef.Get ( );
 
 	UGFxValue_execActionScriptObject_Parms ActionScriptObject_Parms;
 	memcpy ( &ActionScriptObject_Parms.Path, &Path, 0x10 );
 
-	pFnActionScriptObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnActionScriptObject, &ActionScriptObject_Parms, NULL );
-
-	pFnActionScriptObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnActionScriptObject, &ActionScriptObject_Parms ) )
+		this->ProcessEvent ( pFnActionScriptObject, &ActionScriptObject_Parms, NULL );
 
 	return ActionScriptObject_Parms.ReturnValue;
 };
@@ -1797,19 +1522,15 @@ class UGFxValue* UGFxValue::ActionScriptObject ( FString const& Path )
 
 FString UGFxValue::ActionScriptString ( FString const& method )
 {
-	static UFunction* pFnActionScriptString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActionScriptStringRef { L"Function GFxUI.GFxValue.ActionScriptString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActionScriptString )
-		pFnActionScriptString = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.ActionScriptString" );
+	UFunction* const pFnActionScriptString = pFnActionScriptStringRef.Get ( );
 
 	UGFxValue_execActionScriptString_Parms ActionScriptString_Parms;
 	memcpy ( &ActionScriptString_Parms.method, &method, 0x10 );
 
-	pFnActionScriptString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnActionScriptString, &ActionScriptString_Parms, NULL );
-
-	pFnActionScriptString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnActionScriptString, &ActionScriptString_Parms ) )
+		this->ProcessEvent ( pFnActionScriptString, &ActionScriptString_Parms, NULL );
 
 	return ActionScriptString_Parms.ReturnValue;
 };
@@ -1822,19 +1543,15 @@ FString UGFxValue::ActionScriptString ( FString const& method )
 
 float UGFxValue::ActionScriptFloat ( FString const& method )
 {
-	static UFunction* pFnActionScriptFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActionScriptFloatRef { L"Function GFxUI.GFxValue.ActionScriptFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActionScriptFloat )
-		pFnActionScriptFloat = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.ActionScriptFloat" );
+	UFunction* const pFnActionScriptFloat = pFnActionScriptFloatRef.Get ( );
 
 	UGFxValue_execActionScriptFloat_Parms ActionScriptFloat_Parms;
 	memcpy ( &ActionScriptFloat_Parms.method, &method, 0x10 );
 
-	pFnActionScriptFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnActionScriptFloat, &ActionScriptFloat_Parms, NULL );
-
-	pFnActionScriptFloat->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnActionScriptFloat, &ActionScriptFloat_Parms ) )
+		this->ProcessEvent ( pFnActionScriptFloat, &ActionScriptFloat_Parms, NULL );
 
 	return ActionScriptFloat_Parms.ReturnValue;
 };
@@ -1847,19 +1564,15 @@ float UGFxValue::ActionScriptFloat ( FString const& method )
 
 int UGFxValue::ActionScriptInt ( FString const& method )
 {
-	static UFunction* pFnActionScriptInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActionScriptIntRef { L"Function GFxUI.GFxValue.ActionScriptInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActionScriptInt )
-		pFnActionScriptInt = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.ActionScriptInt" );
+	UFunction* const pFnActionScriptInt = pFnActionScriptIntRef.Get ( );
 
 	UGFxValue_execActionScriptInt_Parms ActionScriptInt_Parms;
 	memcpy ( &ActionScriptInt_Parms.method, &method, 0x10 );
 
-	pFnActionScriptInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnActionScriptInt, &ActionScriptInt_Parms, NULL );
-
-	pFnActionScriptInt->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnActionScriptInt, &ActionScriptInt_Parms ) )
+		this->ProcessEvent ( pFnActionScriptInt, &ActionScriptInt_Parms, NULL );
 
 	return ActionScriptInt_Parms.ReturnValue;
 };
@@ -1871,19 +1584,15 @@ int UGFxValue::ActionScriptInt ( FString const& method )
 
 void UGFxValue::ActionScriptVoid ( FString const& method )
 {
-	static UFunction* pFnActionScriptVoid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActionScriptVoidRef { L"Function GFxUI.GFxValue.ActionScriptVoid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActionScriptVoid )
-		pFnActionScriptVoid = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.ActionScriptVoid" );
+	UFunction* const pFnActionScriptVoid = pFnActionScriptVoidRef.Get ( );
 
 	UGFxValue_execActionScriptVoid_Parms ActionScriptVoid_Parms;
 	memcpy ( &ActionScriptVoid_Parms.method, &method, 0x10 );
 
-	pFnActionScriptVoid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnActionScriptVoid, &ActionScriptVoid_Parms, NULL );
-
-	pFnActionScriptVoid->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnActionScriptVoid, &ActionScriptVoid_Parms ) )
+		this->ProcessEvent ( pFnActionScriptVoid, &ActionScriptVoid_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetElementMemberString
@@ -1895,21 +1604,17 @@ void UGFxValue::ActionScriptVoid ( FString const& method )
 
 void UGFxValue::SetElementMemberString ( int Index, FString const& member, FString const& S )
 {
-	static UFunction* pFnSetElementMemberString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetElementMemberStringRef { L"Function GFxUI.GFxValue.SetElementMemberString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetElementMemberString )
-		pFnSetElementMemberString = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetElementMemberString" );
+	UFunction* const pFnSetElementMemberString = pFnSetElementMemberStringRef.Get ( );
 
 	UGFxValue_execSetElementMemberString_Parms SetElementMemberString_Parms;
 	SetElementMemberString_Parms.Index = Index;
 	memcpy ( &SetElementMemberString_Parms.member, &member, 0x10 );
 	memcpy ( &SetElementMemberString_Parms.S, &S, 0x10 );
 
-	pFnSetElementMemberString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetElementMemberString, &SetElementMemberString_Parms, NULL );
-
-	pFnSetElementMemberString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetElementMemberString, &SetElementMemberString_Parms ) )
+		this->ProcessEvent ( pFnSetElementMemberString, &SetElementMemberString_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetElementMemberNumber
@@ -1921,21 +1626,17 @@ void UGFxValue::SetElementMemberString ( int Index, FString const& member, FStri
 
 void UGFxValue::SetElementMemberNumber ( int Index, FString const& member, float F )
 {
-	static UFunction* pFnSetElementMemberNumber = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetElementMemberNumberRef { L"Function GFxUI.GFxValue.SetElementMemberNumber", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetElementMemberNumber )
-		pFnSetElementMemberNumber = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetElementMemberNumber" );
+	UFunction* const pFnSetElementMemberNumber = pFnSetElementMemberNumberRef.Get ( );
 
 	UGFxValue_execSetElementMemberNumber_Parms SetElementMemberNumber_Parms;
 	SetElementMemberNumber_Parms.Index = Index;
 	memcpy ( &SetElementMemberNumber_Parms.member, &member, 0x10 );
 	SetElementMemberNumber_Parms.F = F;
 
-	pFnSetElementMemberNumber->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetElementMemberNumber, &SetElementMemberNumber_Parms, NULL );
-
-	pFnSetElementMemberNumber->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetElementMemberNumber, &SetElementMemberNumber_Parms ) )
+		this->ProcessEvent ( pFnSetElementMemberNumber, &SetElementMemberNumber_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetElementMemberBool
@@ -1947,21 +1648,17 @@ void UGFxValue::SetElementMemberNumber ( int Index, FString const& member, float
 
 void UGFxValue::SetElementMemberBool ( int Index, FString const& member, unsigned long B )
 {
-	static UFunction* pFnSetElementMemberBool = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetElementMemberBoolRef { L"Function GFxUI.GFxValue.SetElementMemberBool", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetElementMemberBool )
-		pFnSetElementMemberBool = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetElementMemberBool" );
+	UFunction* const pFnSetElementMemberBool = pFnSetElementMemberBoolRef.Get ( );
 
 	UGFxValue_execSetElementMemberBool_Parms SetElementMemberBool_Parms;
 	SetElementMemberBool_Parms.Index = Index;
 	memcpy ( &SetElementMemberBool_Parms.member, &member, 0x10 );
 	SetElementMemberBool_Parms.B = B;
 
-	pFnSetElementMemberBool->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetElementMemberBool, &SetElementMemberBool_Parms, NULL );
-
-	pFnSetElementMemberBool->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetElementMemberBool, &SetElementMemberBool_Parms ) )
+		this->ProcessEvent ( pFnSetElementMemberBool, &SetElementMemberBool_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetElementMemberObject
@@ -1973,21 +1670,17 @@ void UGFxValue::SetElementMemberBool ( int Index, FString const& member, unsigne
 
 void UGFxValue::SetElementMemberObject ( int Index, FString const& member, class UGFxValue* val )
 {
-	static UFunction* pFnSetElementMemberObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetElementMemberObjectRef { L"Function GFxUI.GFxValue.SetElementMemberObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetElementMemberObject )
-		pFnSetElementMemberObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetElementMemberObject" );
+	UFunction* const pFnSetElementMemberObject = pFnSetElementMemberObjectRef.Get ( );
 
 	UGFxValue_execSetElementMemberObject_Parms SetElementMemberObject_Parms;
 	SetElementMemberObject_Parms.Index = Index;
 	memcpy ( &SetElementMemberObject_Parms.member, &member, 0x10 );
 	SetElementMemberObject_Parms.val = val;
 
-	pFnSetElementMemberObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetElementMemberObject, &SetElementMemberObject_Parms, NULL );
-
-	pFnSetElementMemberObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetElementMemberObject, &SetElementMemberObject_Parms ) )
+		this->ProcessEvent ( pFnSetElementMemberObject, &SetElementMemberObject_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetElementMember
@@ -1999,21 +1692,17 @@ void UGFxValue::SetElementMemberObject ( int Index, FString const& member, class
 
 void UGFxValue::SetElementMember ( int Index, FString const& member, struct FASValue const& arg )
 {
-	static UFunction* pFnSetElementMember = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetElementMemberRef { L"Function GFxUI.GFxValue.SetElementMember", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetElementMember )
-		pFnSetElementMember = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetElementMember" );
+	UFunction* const pFnSetElementMember = pFnSetElementMemberRef.Get ( );
 
 	UGFxValue_execSetElementMember_Parms SetElementMember_Parms;
 	SetElementMember_Parms.Index = Index;
 	memcpy ( &SetElementMember_Parms.member, &member, 0x10 );
 	memcpy ( &SetElementMember_Parms.arg, &arg, 0x1C );
 
-	pFnSetElementMember->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetElementMember, &SetElementMember_Parms, NULL );
-
-	pFnSetElementMember->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetElementMember, &SetElementMember_Parms ) )
+		this->ProcessEvent ( pFnSetElementMember, &SetElementMember_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.GetElementMemberString
@@ -2025,20 +1714,16 @@ void UGFxValue::SetElementMember ( int Index, FString const& member, struct FASV
 
 FString UGFxValue::GetElementMemberString ( int Index, FString const& member )
 {
-	static UFunction* pFnGetElementMemberString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetElementMemberStringRef { L"Function GFxUI.GFxValue.GetElementMemberString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetElementMemberString )
-		pFnGetElementMemberString = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetElementMemberString" );
+	UFunction* const pFnGetElementMemberString = pFnGetElementMemberStringRef.Get ( );
 
 	UGFxValue_execGetElementMemberString_Parms GetElementMemberString_Parms;
 	GetElementMemberString_Parms.Index = Index;
 	memcpy ( &GetElementMemberString_Parms.member, &member, 0x10 );
 
-	pFnGetElementMemberString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetElementMemberString, &GetElementMemberString_Parms, NULL );
-
-	pFnGetElementMemberString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetElementMemberString, &GetElementMemberString_Parms ) )
+		this->ProcessEvent ( pFnGetElementMemberString, &GetElementMemberString_Parms, NULL );
 
 	return GetElementMemberString_Parms.ReturnValue;
 };
@@ -2052,20 +1737,16 @@ FString UGFxValue::GetElementMemberString ( int Index, FString const& member )
 
 float UGFxValue::GetElementMemberNumber ( int Index, FString const& member )
 {
-	static UFunction* pFnGetElementMemberNumber = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetElementMemberNumberRef { L"Function GFxUI.GFxValue.GetElementMemberNumber", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetElementMemberNumber )
-		pFnGetElementMemberNumber = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetElementMemberNumber" );
+	UFunction* const pFnGetElementMemberNumber = pFnGetElementMemberNumberRef.Get ( );
 
 	UGFxValue_execGetElementMemberNumber_Parms GetElementMemberNumber_Parms;
 	GetElementMemberNumber_Parms.Index = Index;
 	memcpy ( &GetElementMemberNumber_Parms.member, &member, 0x10 );
 
-	pFnGetElementMemberNumber->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetElementMemberNumber, &GetElementMemberNumber_Parms, NULL );
-
-	pFnGetElementMemberNumber->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetElementMemberNumber, &GetElementMemberNumber_Parms ) )
+		this->ProcessEvent ( pFnGetElementMemberNumber, &GetElementMemberNumber_Parms, NULL );
 
 	return GetElementMemberNumber_Parms.ReturnValue;
 };
@@ -2079,20 +1760,16 @@ float UGFxValue::GetElementMemberNumber ( int Index, FString const& member )
 
 bool UGFxValue::GetElementMemberBool ( int Index, FString const& member )
 {
-	static UFunction* pFnGetElementMemberBool = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetElementMemberBoolRef { L"Function GFxUI.GFxValue.GetElementMemberBool", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetElementMemberBool )
-		pFnGetElementMemberBool = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetElementMemberBool" );
+	UFunction* const pFnGetElementMemberBool = pFnGetElementMemberBoolRef.Get ( );
 
 	UGFxValue_execGetElementMemberBool_Parms GetElementMemberBool_Parms;
 	GetElementMemberBool_Parms.Index = Index;
 	memcpy ( &GetElementMemberBool_Parms.member, &member, 0x10 );
 
-	pFnGetElementMemberBool->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetElementMemberBool, &GetElementMemberBool_Parms, NULL );
-
-	pFnGetElementMemberBool->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetElementMemberBool, &GetElementMemberBool_Parms ) )
+		this->ProcessEvent ( pFnGetElementMemberBool, &GetElementMemberBool_Parms, NULL );
 
 	return GetElementMemberBool_Parms.ReturnValue;
 };
@@ -2107,21 +1784,17 @@ bool UGFxValue::GetElementMemberBool ( int Index, FString const& member )
 
 class UGFxValue* UGFxValue::GetElementMemberObject ( int Index, FString const& member, class UClass* Type )
 {
-	static UFunction* pFnGetElementMemberObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetElementMemberObjectRef { L"Function GFxUI.GFxValue.GetElementMemberObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetElementMemberObject )
-		pFnGetElementMemberObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetElementMemberObject" );
+	UFunction* const pFnGetElementMemberObject = pFnGetElementMemberObjectRef.Get ( );
 
 	UGFxValue_execGetElementMemberObject_Parms GetElementMemberObject_Parms;
 	GetElementMemberObject_Parms.Index = Index;
 	memcpy ( &GetElementMemberObject_Parms.member, &member, 0x10 );
 	GetElementMemberObject_Parms.Type = Type;
 
-	pFnGetElementMemberObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetElementMemberObject, &GetElementMemberObject_Parms, NULL );
-
-	pFnGetElementMemberObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetElementMemberObject, &GetElementMemberObject_Parms ) )
+		this->ProcessEvent ( pFnGetElementMemberObject, &GetElementMemberObject_Parms, NULL );
 
 	return GetElementMemberObject_Parms.ReturnValue;
 };
@@ -2135,20 +1808,16 @@ class UGFxValue* UGFxValue::GetElementMemberObject ( int Index, FString const& m
 
 struct FASValue UGFxValue::GetElementMember ( int Index, FString const& member )
 {
-	static UFunction* pFnGetElementMember = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetElementMemberRef { L"Function GFxUI.GFxValue.GetElementMember", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetElementMember )
-		pFnGetElementMember = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetElementMember" );
+	UFunction* const pFnGetElementMember = pFnGetElementMemberRef.Get ( );
 
 	UGFxValue_execGetElementMember_Parms GetElementMember_Parms;
 	GetElementMember_Parms.Index = Index;
 	memcpy ( &GetElementMember_Parms.member, &member, 0x10 );
 
-	pFnGetElementMember->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetElementMember, &GetElementMember_Parms, NULL );
-
-	pFnGetElementMember->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetElementMember, &GetElementMember_Parms ) )
+		this->ProcessEvent ( pFnGetElementMember, &GetElementMember_Parms, NULL );
 
 	return GetElementMember_Parms.ReturnValue;
 };
@@ -2161,20 +1830,16 @@ struct FASValue UGFxValue::GetElementMember ( int Index, FString const& member )
 
 void UGFxValue::SetElementColorTransform ( int Index, struct FASColorTransform const& cxform )
 {
-	static UFunction* pFnSetElementColorTransform = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetElementColorTransformRef { L"Function GFxUI.GFxValue.SetElementColorTransform", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetElementColorTransform )
-		pFnSetElementColorTransform = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetElementColorTransform" );
+	UFunction* const pFnSetElementColorTransform = pFnSetElementColorTransformRef.Get ( );
 
 	UGFxValue_execSetElementColorTransform_Parms SetElementColorTransform_Parms;
 	SetElementColorTransform_Parms.Index = Index;
 	memcpy ( &SetElementColorTransform_Parms.cxform, &cxform, 0x20 );
 
-	pFnSetElementColorTransform->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetElementColorTransform, &SetElementColorTransform_Parms, NULL );
-
-	pFnSetElementColorTransform->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetElementColorTransform, &SetElementColorTransform_Parms ) )
+		this->ProcessEvent ( pFnSetElementColorTransform, &SetElementColorTransform_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetElementPosition
@@ -2186,21 +1851,17 @@ void UGFxValue::SetElementColorTransform ( int Index, struct FASColorTransform c
 
 void UGFxValue::SetElementPosition ( int Index, float X, float Y )
 {
-	static UFunction* pFnSetElementPosition = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetElementPositionRef { L"Function GFxUI.GFxValue.SetElementPosition", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetElementPosition )
-		pFnSetElementPosition = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetElementPosition" );
+	UFunction* const pFnSetElementPosition = pFnSetElementPositionRef.Get ( );
 
 	UGFxValue_execSetElementPosition_Parms SetElementPosition_Parms;
 	SetElementPosition_Parms.Index = Index;
 	SetElementPosition_Parms.X = X;
 	SetElementPosition_Parms.Y = Y;
 
-	pFnSetElementPosition->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetElementPosition, &SetElementPosition_Parms, NULL );
-
-	pFnSetElementPosition->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetElementPosition, &SetElementPosition_Parms ) )
+		this->ProcessEvent ( pFnSetElementPosition, &SetElementPosition_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetElementVisible
@@ -2211,20 +1872,16 @@ void UGFxValue::SetElementPosition ( int Index, float X, float Y )
 
 void UGFxValue::SetElementVisible ( int Index, unsigned long Visible )
 {
-	static UFunction* pFnSetElementVisible = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetElementVisibleRef { L"Function GFxUI.GFxValue.SetElementVisible", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetElementVisible )
-		pFnSetElementVisible = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetElementVisible" );
+	UFunction* const pFnSetElementVisible = pFnSetElementVisibleRef.Get ( );
 
 	UGFxValue_execSetElementVisible_Parms SetElementVisible_Parms;
 	SetElementVisible_Parms.Index = Index;
 	SetElementVisible_Parms.Visible = Visible;
 
-	pFnSetElementVisible->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetElementVisible, &SetElementVisible_Parms, NULL );
-
-	pFnSetElementVisible->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetElementVisible, &SetElementVisible_Parms ) )
+		this->ProcessEvent ( pFnSetElementVisible, &SetElementVisible_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetElementDisplayMatrix
@@ -2235,20 +1892,16 @@ void UGFxValue::SetElementVisible ( int Index, unsigned long Visible )
 
 void UGFxValue::SetElementDisplayMatrix ( int Index, struct FMatrix const& M )
 {
-	static UFunction* pFnSetElementDisplayMatrix = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetElementDisplayMatrixRef { L"Function GFxUI.GFxValue.SetElementDisplayMatrix", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetElementDisplayMatrix )
-		pFnSetElementDisplayMatrix = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetElementDisplayMatrix" );
+	UFunction* const pFnSetElementDisplayMatrix = pFnSetElementDisplayMatrixRef.Get ( );
 
 	UGFxValue_execSetElementDisplayMatrix_Parms SetElementDisplayMatrix_Parms;
 	SetElementDisplayMatrix_Parms.Index = Index;
 	memcpy ( &SetElementDisplayMatrix_Parms.M, &M, 0x40 );
 
-	pFnSetElementDisplayMatrix->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetElementDisplayMatrix, &SetElementDisplayMatrix_Parms, NULL );
-
-	pFnSetElementDisplayMatrix->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetElementDisplayMatrix, &SetElementDisplayMatrix_Parms ) )
+		this->ProcessEvent ( pFnSetElementDisplayMatrix, &SetElementDisplayMatrix_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetElementDisplayInfo
@@ -2259,20 +1912,16 @@ void UGFxValue::SetElementDisplayMatrix ( int Index, struct FMatrix const& M )
 
 void UGFxValue::SetElementDisplayInfo ( int Index, struct FASDisplayInfo const& D )
 {
-	static UFunction* pFnSetElementDisplayInfo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetElementDisplayInfoRef { L"Function GFxUI.GFxValue.SetElementDisplayInfo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetElementDisplayInfo )
-		pFnSetElementDisplayInfo = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetElementDisplayInfo" );
+	UFunction* const pFnSetElementDisplayInfo = pFnSetElementDisplayInfoRef.Get ( );
 
 	UGFxValue_execSetElementDisplayInfo_Parms SetElementDisplayInfo_Parms;
 	SetElementDisplayInfo_Parms.Index = Index;
 	memcpy ( &SetElementDisplayInfo_Parms.D, &D, 0x2C );
 
-	pFnSetElementDisplayInfo->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetElementDisplayInfo, &SetElementDisplayInfo_Parms, NULL );
-
-	pFnSetElementDisplayInfo->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetElementDisplayInfo, &SetElementDisplayInfo_Parms ) )
+		this->ProcessEvent ( pFnSetElementDisplayInfo, &SetElementDisplayInfo_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetElementString
@@ -2283,20 +1932,16 @@ void UGFxValue::SetElementDisplayInfo ( int Index, struct FASDisplayInfo const&
 
 void UGFxValue::SetElementString ( int Index, FString const& S )
 {
-	static UFunction* pFnSetElementString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetElementStringRef { L"Function GFxUI.GFxValue.SetElementString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetElementString )
-		pFnSetElementString = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetElementString" );
+	UFunction* const pFnSetElementString = pFnSetElementStringRef.Get ( );
 
 	UGFxValue_execSetElementString_Parms SetElementString_Parms;
 	SetElementString_Parms.Index = Index;
 	memcpy ( &SetElementString_Parms.S, &S, 0x10 );
 
-	pFnSetElementString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetElementString, &SetElementString_Parms, NULL );
-
-	pFnSetElementString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetElementString, &SetElementString_Parms ) )
+		this->ProcessEvent ( pFnSetElementString, &SetElementString_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetElementNumber
@@ -2307,20 +1952,16 @@ void UGFxValue::SetElementString ( int Index, FString const& S )
 
 void UGFxValue::SetElementNumber ( int Index, float F )
 {
-	static UFunction* pFnSetElementNumber = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetElementNumberRef { L"Function GFxUI.GFxValue.SetElementNumber", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetElementNumber )
-		pFnSetElementNumber = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetElementNumber" );
+	UFunction* const pFnSetElementNumber = pFnSetElementNumberRef.Get ( );
 
 	UGFxValue_execSetElementNumber_Parms SetElementNumber_Parms;
 	SetElementNumber_Parms.Index = Index;
 	SetElementNumber_Parms.F = F;
 
-	pFnSetElementNumber->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetElementNumber, &SetElementNumber_Parms, NULL );
-
-	pFnSetElementNumber->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetElementNumber, &SetElementNumber_Parms ) )
+		this->ProcessEvent ( pFnSetElementNumber, &SetElementNumber_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetElementBool
@@ -2331,20 +1972,16 @@ void UGFxValue::SetElementNumber ( int Index, float F )
 
 void UGFxValue::SetElementBool ( int Index, unsigned long B )
 {
-	static UFunction* pFnSetElementBool = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetElementBoolRef { L"Function GFxUI.GFxValue.SetElementBool", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetElementBool )
-		pFnSetElementBool = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetElementBool" );
+	UFunction* const pFnSetElementBool = pFnSetElementBoolRef.Get ( );
 
 	UGFxValue_execSetElementBool_Parms SetElementBool_Parms;
 	SetElementBool_Parms.Index = Index;
 	SetElementBool_Parms.B = B;
 
-	pFnSetElementBool->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetElementBool, &SetElementBool_Parms, NULL );
-
-	pFnSetElementBool->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetElementBool, &SetElementBool_Parms ) )
+		this->ProcessEvent ( pFnSetElementBool, &SetElementBool_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetElementObject
@@ -2355,20 +1992,16 @@ void UGFxValue::SetElementBool ( int Index, unsigned long B )
 
 void UGFxValue::SetElementObject ( int Index, class UGFxValue* val )
 {
-	static UFunction* pFnSetElementObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetElementObjectRef { L"Function GFxUI.GFxValue.SetElementObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetElementObject )
-		pFnSetElementObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetElementObject" );
+	UFunction* const pFnSetElementObject = pFnSetElementObjectRef.Get ( );
 
 	UGFxValue_execSetElementObject_Parms SetElementObject_Parms;
 	SetElementObject_Parms.Index = Index;
 	SetElementObject_Parms.val = val;
 
-	pFnSetElementObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetElementObject, &SetElementObject_Parms, NULL );
-
-	pFnSetElementObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetElementObject, &SetElementObject_Parms ) )
+		this->ProcessEvent ( pFnSetElementObject, &SetElementObject_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetElement
@@ -2379,20 +2012,16 @@ void UGFxValue::SetElementObject ( int Index, class UGFxValue* val )
 
 void UGFxValue::SetElement ( int Index, struct FASValue const& arg )
 {
-	static UFunction* pFnSetElement = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetElementRef { L"Function GFxUI.GFxValue.SetElement", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetElement )
-		pFnSetElement = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetElement" );
+	UFunction* const pFnSetElement = pFnSetElementRef.Get ( );
 
 	UGFxValue_execSetElement_Parms SetElement_Parms;
 	SetElement_Parms.Index = Index;
 	memcpy ( &SetElement_Parms.arg, &arg, 0x1C );
 
-	pFnSetElement->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetElement, &SetElement_Parms, NULL );
-
-	pFnSetElement->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetElement, &SetElement_Parms ) )
+		this->ProcessEvent ( pFnSetElement, &SetElement_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.GetElementDisplayMatrix
@@ -2403,19 +2032,15 @@ void UGFxValue::SetElement ( int Index, struct FASValue const& arg )
 
 struct FMatrix UGFxValue::GetElementDisplayMatrix ( int Index )
 {
-	static UFunction* pFnGetElementDisplayMatrix = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetElementDisplayMatrixRef { L"Function GFxUI.GFxValue.GetElementDisplayMatrix", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetElementDisplayMatrix )
-		pFnGetElementDisplayMatrix = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetElementDisplayMatrix" );
+	UFunction* const pFnGetElementDisplayMatrix = pFnGetElementDisplayMatrixRef.Get ( );
 
 	UGFxValue_execGetElementDisplayMatrix_Parms GetElementDisplayMatrix_Parms;
 	GetElementDisplayMatrix_Parms.Index = Index;
 
-	pFnGetElementDisplayMatrix->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetElementDisplayMatrix, &GetElementDisplayMatrix_Parms, NULL );
-
-	pFnGetElementDisplayMatrix->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetElementDisplayMatrix, &GetElementDisplayMatrix_Parms ) )
+		this->ProcessEvent ( pFnGetElementDisplayMatrix, &GetElementDisplayMatrix_Parms, NULL );
 
 	return GetElementDisplayMatrix_Parms.ReturnValue;
 };
@@ -2428,19 +2053,15 @@ struct FMatrix UGFxValue::GetElementDisplayMatrix ( int Index )
 
 struct FASDisplayInfo UGFxValue::GetElementDisplayInfo ( int Index )
 {
-	static UFunction* pFnGetElementDisplayInfo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetElementDisplayInfoRef { L"Function GFxUI.GFxValue.GetElementDisplayInfo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetElementDisplayInfo )
-		pFnGetElementDisplayInfo = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetElementDisplayInfo" );
+	UFunction* const pFnGetElementDisplayInfo = pFnGetElementDisplayInfoRef.Get ( );
 
 	UGFxValue_execGetElementDisplayInfo_Parms GetElementDisplayInfo_Parms;
 	GetElementDisplayInfo_Parms.Index = Index;
 
-	pFnGetElementDisplayInfo->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetElementDisplayInfo, &GetElementDisplayInfo_Parms, NULL );
-
-	pFnGetElementDisplayInfo->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetElementDisplayInfo, &GetElementDisplayInfo_Parms ) )
+		this->ProcessEvent ( pFnGetElementDisplayInfo, &GetElementDisplayInfo_Parms, NULL );
 
 	return GetElementDisplayInfo_Parms.ReturnValue;
 };
@@ -2453,19 +2074,15 @@ struct FASDisplayInfo UGFxValue::GetElementDisplayInfo ( int Index )
 
 FString UGFxValue::GetElementString ( int Index )
 {
-	static UFunction* pFnGetElementString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetElementStringRef { L"Function GFxUI.GFxValue.GetElementString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetElementString )
-		pFnGetElementString = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetElementString" );
+	UFunction* const pFnGetElementString = pFnGetElementStringRef.Get ( );
 
 	UGFxValue_execGetElementString_Parms GetElementString_Parms;
 	GetElementString_Parms.Index = Index;
 
-	pFnGetElementString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetElementString, &GetElementString_Parms, NULL );
-
-	pFnGetElementString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetElementString, &GetElementString_Parms ) )
+		this->ProcessEvent ( pFnGetElementString, &GetElementString_Parms, NULL );
 
 	return GetElementString_Parms.ReturnValue;
 };
@@ -2478,19 +2095,15 @@ FString UGFxValue::GetElementString ( int Index )
 
 float UGFxValue::GetElementNumber ( int Index )
 {
-	static UFunction* pFnGetElementNumber = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetElementNumberRef { L"Function GFxUI.GFxValue.GetElementNumber", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetElementNumber )
-		pFnGetElementNumber = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetElementNumber" );
+	UFunction* const pFnGetElementNumber = pFnGetElementNumberRef.Get ( );
 
 	UGFxValue_execGetElementNumber_Parms GetElementNumber_Parms;
 	GetElementNumber_Parms.Index = Index;
 
-	pFnGetElementNumber->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetElementNumber, &GetElementNumber_Parms, NULL );
-
-	pFnGetElementNumber->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetElementNumber, &GetElementNumber_Parms ) )
+		this->ProcessEvent ( pFnGetElementNumber, &GetElementNumber_Parms, NULL );
 
 	return GetElementNumber_Parms.ReturnValue;
 };
@@ -2503,19 +2116,15 @@ float UGFxValue::GetElementNumber ( int Index )
 
 bool UGFxValue::GetElementBool ( int Index )
 {
-	static UFunction* pFnGetElementBool = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetElementBoolRef { L"Function GFxUI.GFxValue.GetElementBool", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetElementBool )
-		pFnGetElementBool = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetElementBool" );
+	UFunction* const pFnGetElementBool = pFnGetElementBoolRef.Get ( );
 
 	UGFxValue_execGetElementBool_Parms GetElementBool_Parms;
 	GetElementBool_Parms.Index = Index;
 
-	pFnGetElementBool->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetElementBool, &GetElementBool_Parms, NULL );
-
-	pFnGetElementBool->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetElementBool, &GetElementBool_Parms ) )
+		this->ProcessEvent ( pFnGetElementBool, &GetElementBool_Parms, NULL );
 
 	return GetElementBool_Parms.ReturnValue;
 };
@@ -2529,20 +2138,16 @@ bool UGFxValue::GetElementBool ( int Index )
 
 class UGFxValue* UGFxValue::GetElementObject ( int Index, class UClass* Type )
 {
-	static UFunction* pFnGetElementObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetElementObjectRef { L"Function GFxUI.GFxValue.GetElementObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetElementObject )
-		pFnGetElementObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetElementObject" );
+	UFunction* const pFnGetElementObject = pFnGetElementObjectRef.Get ( );
 
 	UGFxValue_execGetElementObject_Parms GetElementObject_Parms;
 	GetElementObject_Parms.Index = Index;
 	GetElementObject_Parms.Type = Type;
 
-	pFnGetElementObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetElementObject, &GetElementObject_Parms, NULL );
-
-	pFnGetElementObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetElementObject, &GetElementObject_Parms ) )
+		this->ProcessEvent ( pFnGetElementObject, &GetElementObject_Parms, NULL );
 
 	return GetElementObject_Parms.ReturnValue;
 };
@@ -2555,19 +2160,15 @@ class UGFxValue* UGFxValue::GetElementObject ( int Index, class UClass* Type )
 
 struct FASValue UGFxValue::GetElement ( int Index )
 {
-	static UFunction* pFnGetElement = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetElementRef { L"Function GFxUI.GFxValue.GetElement", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetElement )
-		pFnGetElement = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetElement" );
+	UFunction* const pFnGetElement = pFnGetElementRef.Get ( );
 
 	UGFxValue_execGetElement_Parms GetElement_Parms;
 	GetElement_Parms.Index = Index;
 
-	pFnGetElement->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetElement, &GetElement_Parms, NULL );
-
-	pFnGetElement->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetElement, &GetElement_Parms ) )
+		this->ProcessEvent ( pFnGetElement, &GetElement_Parms, NULL );
 
 	return GetElement_Parms.ReturnValue;
 };
@@ -2579,19 +2180,15 @@ struct FASValue UGFxValue::GetElement ( int Index )
 
 void UGFxValue::SetText ( FString const& Text )
 {
-	static UFunction* pFnSetText = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetTextRef { L"Function GFxUI.GFxValue.SetText", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetText )
-		pFnSetText = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetText" );
+	UFunction* const pFnSetText = pFnSetTextRef.Get ( );
 
 	UGFxValue_execSetText_Parms SetText_Parms;
 	memcpy ( &SetText_Parms.Text, &Text, 0x10 );
 
-	pFnSetText->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetText, &SetText_Parms, NULL );
-
-	pFnSetText->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetText, &SetText_Parms ) )
+		this->ProcessEvent ( pFnSetText, &SetText_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.GetText
@@ -2601,18 +2198,14 @@ void UGFxValue::SetText ( FString const& Text )
 
 FString UGFxValue::GetText ( )
 {
-	static UFunction* pFnGetText = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTextRef { L"Function GFxUI.GFxValue.GetText", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetText )
-		pFnGetText = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetText" );
+	UFunction* const pFnGetText = pFnGetTextRef.Get ( );
 
 	UGFxValue_execGetText_Parms GetText_Parms;
 
-	pFnGetText->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetText, &GetText_Parms, NULL );
-
-	pFnGetText->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetText, &GetText_Parms ) )
+		this->ProcessEvent ( pFnGetText, &GetText_Parms, NULL );
 
 	return GetText_Parms.ReturnValue;
 };
@@ -2628,10 +2221,9 @@ FString UGFxValue::GetText ( )
 
 class UGFxValue* UGFxValue::AttachMovie ( FString const& symbolname, FString const& instancename, int Depth, class UClass* Type )
 {
-	static UFunction* pFnAttachMovie = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAttachMovieRef { L"Function GFxUI.GFxValue.AttachMovie", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAttachMovie )
-		pFnAttachMovie = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.AttachMovie" );
+	UFunction* const pFnAttachMovie = pFnAttachMovieRef.Get ( );
 
 	UGFxValue_execAttachMovie_Parms AttachMovie_Parms;
 	memcpy ( &AttachMovie_Parms.symbolname, &symbolname, 0x10 );
@@ -2639,11 +2231,8 @@ class UGFxValue* UGFxValue::AttachMovie ( FString const& symbolname, FString con
 	AttachMovie_Parms.Depth = Depth;
 	AttachMovie_Parms.Type = Type;
 
-	pFnAttachMovie->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAttachMovie, &AttachMovie_Parms, NULL );
-
-	pFnAttachMovie->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAttachMovie, &AttachMovie_Parms ) )
+		this->ProcessEvent ( pFnAttachMovie, &AttachMovie_Parms, NULL );
 
 	return AttachMovie_Parms.ReturnValue;
 };
@@ -2658,21 +2247,17 @@ class UGFxValue* UGFxValue::AttachMovie ( FString const& symbolname, FString con
 
 class UGFxValue* UGFxValue::CreateEmptyMovieClip ( FString const& instancename, int Depth, class UClass* Type )
 {
-	static UFunction* pFnCreateEmptyMovieClip = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCreateEmptyMovieClipRef { L"Function GFxUI.GFxValue.CreateEmptyMovieClip", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCreateEmptyMovieClip )
-		pFnCreateEmptyMovieClip = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.CreateEmptyMovieClip" );
+	UFunction* const pFnCreateEmptyMovieClip = pFnCreateEmptyMovieClipRef.Get ( );
 
 	UGFxValue_execCreateEmptyMovieClip_Parms CreateEmptyMovieClip_Parms;
 	memcpy ( &CreateEmptyMovieClip_Parms.instancename, &instancename, 0x10 );
 	CreateEmptyMovieClip_Parms.Depth = Depth;
 	CreateEmptyMovieClip_Parms.Type = Type;
 
-	pFnCreateEmptyMovieClip->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCreateEmptyMovieClip, &CreateEmptyMovieClip_Parms, NULL );
-
-	pFnCreateEmptyMovieClip->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCreateEmptyMovieClip, &CreateEmptyMovieClip_Parms ) )
+		this->ProcessEvent ( pFnCreateEmptyMovieClip, &CreateEmptyMovieClip_Parms, NULL );
 
 	return CreateEmptyMovieClip_Parms.ReturnValue;
 };
@@ -2684,19 +2269,15 @@ class UGFxValue* UGFxValue::CreateEmptyMovieClip ( FString const& instancename,
 
 void UGFxValue::GotoAndStopI ( int frame )
 {
-	static UFunction* pFnGotoAndStopI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGotoAndStopIRef { L"Function GFxUI.GFxValue.GotoAndStopI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGotoAndStopI )
-		pFnGotoAndStopI = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GotoAndStopI" );
+	UFunction* const pFnGotoAndStopI = pFnGotoAndStopIRef.Get ( );
 
 	UGFxValue_execGotoAndStopI_Parms GotoAndStopI_Parms;
 	GotoAndStopI_Parms.frame = frame;
 
-	pFnGotoAndStopI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGotoAndStopI, &GotoAndStopI_Parms, NULL );
-
-	pFnGotoAndStopI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGotoAndStopI, &GotoAndStopI_Parms ) )
+		this->ProcessEvent ( pFnGotoAndStopI, &GotoAndStopI_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.GotoAndStop
@@ -2706,19 +2287,15 @@ void UGFxValue::GotoAndStopI ( int frame )
 
 void UGFxValue::GotoAndStop ( FString const& frame )
 {
-	static UFunction* pFnGotoAndStop = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGotoAndStopRef { L"Function GFxUI.GFxValue.GotoAndStop", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGotoAndStop )
-		pFnGotoAndStop = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GotoAndStop" );
+	UFunction* const pFnGotoAndStop = pFnGotoAndStopRef.Get ( );
 
 	UGFxValue_execGotoAndStop_Parms GotoAndStop_Parms;
 	memcpy ( &GotoAndStop_Parms.frame, &frame, 0x10 );
 
-	pFnGotoAndStop->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGotoAndStop, &GotoAndStop_Parms, NULL );
-
-	pFnGotoAndStop->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGotoAndStop, &GotoAndStop_Parms ) )
+		this->ProcessEvent ( pFnGotoAndStop, &GotoAndStop_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.GotoAndPlayI
@@ -2728,19 +2305,15 @@ void UGFxValue::GotoAndStop ( FString const& frame )
 
 void UGFxValue::GotoAndPlayI ( int frame )
 {
-	static UFunction* pFnGotoAndPlayI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGotoAndPlayIRef { L"Function GFxUI.GFxValue.GotoAndPlayI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGotoAndPlayI )
-		pFnGotoAndPlayI = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GotoAndPlayI" );
+	UFunction* const pFnGotoAndPlayI = pFnGotoAndPlayIRef.Get ( );
 
 	UGFxValue_execGotoAndPlayI_Parms GotoAndPlayI_Parms;
 	GotoAndPlayI_Parms.frame = frame;
 
-	pFnGotoAndPlayI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGotoAndPlayI, &GotoAndPlayI_Parms, NULL );
-
-	pFnGotoAndPlayI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGotoAndPlayI, &GotoAndPlayI_Parms ) )
+		this->ProcessEvent ( pFnGotoAndPlayI, &GotoAndPlayI_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.GotoAndPlay
@@ -2750,19 +2323,15 @@ void UGFxValue::GotoAndPlayI ( int frame )
 
 void UGFxValue::GotoAndPlay ( FString const& frame )
 {
-	static UFunction* pFnGotoAndPlay = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGotoAndPlayRef { L"Function GFxUI.GFxValue.GotoAndPlay", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGotoAndPlay )
-		pFnGotoAndPlay = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GotoAndPlay" );
+	UFunction* const pFnGotoAndPlay = pFnGotoAndPlayRef.Get ( );
 
 	UGFxValue_execGotoAndPlay_Parms GotoAndPlay_Parms;
 	memcpy ( &GotoAndPlay_Parms.frame, &frame, 0x10 );
 
-	pFnGotoAndPlay->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGotoAndPlay, &GotoAndPlay_Parms, NULL );
-
-	pFnGotoAndPlay->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGotoAndPlay, &GotoAndPlay_Parms ) )
+		this->ProcessEvent ( pFnGotoAndPlay, &GotoAndPlay_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetColorTransform
@@ -2772,19 +2341,15 @@ void UGFxValue::GotoAndPlay ( FString const& frame )
 
 void UGFxValue::SetColorTransform ( struct FASColorTransform const& cxform )
 {
-	static UFunction* pFnSetColorTransform = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetColorTransformRef { L"Function GFxUI.GFxValue.SetColorTransform", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetColorTransform )
-		pFnSetColorTransform = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetColorTransform" );
+	UFunction* const pFnSetColorTransform = pFnSetColorTransformRef.Get ( );
 
 	UGFxValue_execSetColorTransform_Parms SetColorTransform_Parms;
 	memcpy ( &SetColorTransform_Parms.cxform, &cxform, 0x20 );
 
-	pFnSetColorTransform->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetColorTransform, &SetColorTransform_Parms, NULL );
-
-	pFnSetColorTransform->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetColorTransform, &SetColorTransform_Parms ) )
+		this->ProcessEvent ( pFnSetColorTransform, &SetColorTransform_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetPosition
@@ -2795,20 +2360,16 @@ void UGFxValue::SetColorTransform ( struct FASColorTransform const& cxform )
 
 void UGFxValue::SetPosition ( float X, float Y )
 {
-	static UFunction* pFnSetPosition = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetPositionRef { L"Function GFxUI.GFxValue.SetPosition", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetPosition )
-		pFnSetPosition = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetPosition" );
+	UFunction* const pFnSetPosition = pFnSetPositionRef.Get ( );
 
 	UGFxValue_execSetPosition_Parms SetPosition_Parms;
 	SetPosition_Parms.X = X;
 	SetPosition_Parms.Y = Y;
 
-	pFnSetPosition->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetPosition, &SetPosition_Parms, NULL );
-
-	pFnSetPosition->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetPosition, &SetPosition_Parms ) )
+		this->ProcessEvent ( pFnSetPosition, &SetPosition_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetVisible
@@ -2818,19 +2379,15 @@ void UGFxValue::SetPosition ( float X, float Y )
 
 void UGFxValue::SetVisible ( unsigned long Visible )
 {
-	static UFunction* pFnSetVisible = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetVisibleRef { L"Function GFxUI.GFxValue.SetVisible", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetVisible )
-		pFnSetVisible = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetVisible" );
+	UFunction* const pFnSetVisible = pFnSetVisibleRef.Get ( );
 
 	UGFxValue_execSetVisible_Parms SetVisible_Parms;
 	SetVisible_Parms.Visible = Visible;
 
-	pFnSetVisible->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetVisible, &SetVisible_Parms, NULL );
-
-	pFnSetVisible->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetVisible, &SetVisible_Parms ) )
+		this->ProcessEvent ( pFnSetVisible, &SetVisible_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetDisplayMatrix3D
@@ -2840,19 +2397,15 @@ void UGFxValue::SetVisible ( unsigned long Visible )
 
 void UGFxValue::SetDisplayMatrix3D ( struct FMatrix const& M )
 {
-	static UFunction* pFnSetDisplayMatrix3D = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetDisplayMatrix3DRef { L"Function GFxUI.GFxValue.SetDisplayMatrix3D", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetDisplayMatrix3D )
-		pFnSetDisplayMatrix3D = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetDisplayMatrix3D" );
+	UFunction* const pFnSetDisplayMatrix3D = pFnSetDisplayMatrix3DRef.Get ( );
 
 	UGFxValue_execSetDisplayMatrix3D_Parms SetDisplayMatrix3D_Parms;
 	memcpy ( &SetDisplayMatrix3D_Parms.M, &M, 0x40 );
 
-	pFnSetDisplayMatrix3D->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetDisplayMatrix3D, &SetDisplayMatrix3D_Parms, NULL );
-
-	pFnSetDisplayMatrix3D->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetDisplayMatrix3D, &SetDisplayMatrix3D_Parms ) )
+		this->ProcessEvent ( pFnSetDisplayMatrix3D, &SetDisplayMatrix3D_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetDisplayMatrix
@@ -2862,19 +2415,15 @@ void UGFxValue::SetDisplayMatrix3D ( struct FMatrix const& M )
 
 void UGFxValue::SetDisplayMatrix ( struct FMatrix const& M )
 {
-	static UFunction* pFnSetDisplayMatrix = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetDisplayMatrixRef { L"Function GFxUI.GFxValue.SetDisplayMatrix", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetDisplayMatrix )
-		pFnSetDisplayMatrix = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetDisplayMatrix" );
+	UFunction* const pFnSetDisplayMatrix = pFnSetDisplayMatrixRef.Get ( );
 
 	UGFxValue_execSetDisplayMatrix_Parms SetDisplayMatrix_Parms;
 	memcpy ( &SetDisplayMatrix_Parms.M, &M, 0x40 );
 
-	pFnSetDisplayMatrix->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetDisplayMatrix, &SetDisplayMatrix_Parms, NULL );
-
-	pFnSetDisplayMatrix->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetDisplayMatrix, &SetDisplayMatrix_Parms ) )
+		this->ProcessEvent ( pFnSetDisplayMatrix, &SetDisplayMatrix_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetDisplayInfo
@@ -2884,19 +2433,15 @@ void UGFxValue::SetDisplayMatrix ( struct FMatrix const& M )
 
 void UGFxValue::SetDisplayInfo ( struct FASDisplayInfo const& D )
 {
-	static UFunction* pFnSetDisplayInfo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetDisplayInfoRef { L"Function GFxUI.GFxValue.SetDisplayInfo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetDisplayInfo )
-		pFnSetDisplayInfo = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetDisplayInfo" );
+	UFunction* const pFnSetDisplayInfo = pFnSetDisplayInfoRef.Get ( );
 
 	UGFxValue_execSetDisplayInfo_Parms SetDisplayInfo_Parms;
 	memcpy ( &SetDisplayInfo_Parms.D, &D, 0x2C );
 
-	pFnSetDisplayInfo->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetDisplayInfo, &SetDisplayInfo_Parms, NULL );
-
-	pFnSetDisplayInfo->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetDisplayInfo, &SetDisplayInfo_Parms ) )
+		this->ProcessEvent ( pFnSetDisplayInfo, &SetDisplayInfo_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.GetPosition
@@ -2908,10 +2453,9 @@ void UGFxValue::SetDisplayInfo ( struct FASDisplayInfo const& D )
 
 bool UGFxValue::GetPosition ( float* X, float* Y )
 {
-	static UFunction* pFnGetPosition = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPositionRef { L"Function GFxUI.GFxValue.GetPosition", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPosition )
-		pFnGetPosition = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetPosition" );
+	UFunction* const pFnGetPosition = pFnGetPositionRef.Get ( );
 
 	UGFxValue_execGetPosition_Parms GetPosition_Parms;
 
@@ -2921,11 +2465,8 @@ bool UGFxValue::GetPosition ( float* X, float* Y )
 	if ( Y )
 		GetPosition_Parms.Y = *Y;
 
-	pFnGetPosition->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetPosition, &GetPosition_Parms, NULL );
-
-	pFnGetPosition->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetPosition, &GetPosition_Parms ) )
+		this->ProcessEvent ( pFnGetPosition, &GetPosition_Parms, NULL );
 
 	if ( X )
 		*X = GetPosition_Parms.X;
@@ -2943,18 +2484,14 @@ bool UGFxValue::GetPosition ( float* X, float* Y )
 
 struct FASColorTransform UGFxValue::GetColorTransform ( )
 {
-	static UFunction* pFnGetColorTransform = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetColorTransformRef { L"Function GFxUI.GFxValue.GetColorTransform", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetColorTransform )
-		pFnGetColorTransform = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetColorTransform" );
+	UFunction* const pFnGetColorTransform = pFnGetColorTransformRef.Get ( );
 
 	UGFxValue_execGetColorTransform_Parms GetColorTransform_Parms;
 
-	pFnGetColorTransform->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetColorTransform, &GetColorTransform_Parms, NULL );
-
-	pFnGetColorTransform->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetColorTransform, &GetColorTransform_Parms ) )
+		this->ProcessEvent ( pFnGetColorTransform, &GetColorTransform_Parms, NULL );
 
 	return GetColorTransform_Parms.ReturnValue;
 };
@@ -2966,18 +2503,14 @@ struct FASColorTransform UGFxValue::GetColorTransform ( )
 
 struct FMatrix UGFxValue::GetDisplayMatrix ( )
 {
-	static UFunction* pFnGetDisplayMatrix = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDisplayMatrixRef { L"Function GFxUI.GFxValue.GetDisplayMatrix", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDisplayMatrix )
-		pFnGetDisplayMatrix = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetDisplayMatrix" );
+	UFunction* const pFnGetDisplayMatrix = pFnGetDisplayMatrixRef.Get ( );
 
 	UGFxValue_execGetDisplayMatrix_Parms GetDisplayMatrix_Parms;
 
-	pFnGetDisplayMatrix->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetDisplayMatrix, &GetDisplayMatrix_Parms, NULL );
-
-	pFnGetDisplayMatrix->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetDisplayMatrix, &GetDisplayMatrix_Parms ) )
+		this->ProcessEvent ( pFnGetDisplayMatrix, &GetDisplayMatrix_Parms, NULL );
 
 	return GetDisplayMatrix_Parms.ReturnValue;
 };
@@ -2989,18 +2522,14 @@ struct FMatrix UGFxValue::GetDisplayMatrix ( )
 
 struct FASDisplayInfo UGFxValue::GetDisplayInfo ( )
 {
-	static UFunction* pFnGetDisplayInfo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDisplayInfoRef { L"Function GFxUI.GFxValue.GetDisplayInfo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDisplayInfo )
-		pFnGetDisplayInfo = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetDisplayInfo" );
+	UFunction* const pFnGetDisplayInfo = pFnGetDisplayInfoRef.Get ( );
 
 	UGFxValue_execGetDisplayInfo_Parms GetDisplayInfo_Parms;
 
-	pFnGetDisplayInfo->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetDisplayInfo, &GetDisplayInfo_Parms, NULL );
-
-	pFnGetDisplayInfo->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetDisplayInfo, &GetDisplayInfo_Parms ) )
+		this->ProcessEvent ( pFnGetDisplayInfo, &GetDisplayInfo_Parms, NULL );
 
 	return GetDisplayInfo_Parms.ReturnValue;
 };
@@ -3013,20 +2542,16 @@ struct FASDisplayInfo UGFxValue::GetDisplayInfo ( )
 
 void UGFxValue::SetString ( FString const& member, FString const& S )
 {
-	static UFunction* pFnSetString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetStringRef { L"Function GFxUI.GFxValue.SetString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetString )
-		pFnSetString = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetString" );
+	UFunction* const pFnSetString = pFnSetStringRef.Get ( );
 
 	UGFxValue_execSetString_Parms SetString_Parms;
 	memcpy ( &SetString_Parms.member, &member, 0x10 );
 	memcpy ( &SetString_Parms.S, &S, 0x10 );
 
-	pFnSetString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetString, &SetString_Parms, NULL );
-
-	pFnSetString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetString, &SetString_Parms ) )
+		this->ProcessEvent ( pFnSetString, &SetString_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetNumber
@@ -3037,20 +2562,16 @@ void UGFxValue::SetString ( FString const& member, FString const& S )
 
 void UGFxValue::SetNumber ( FString const& member, float F )
 {
-	static UFunction* pFnSetNumber = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetNumberRef { L"Function GFxUI.GFxValue.SetNumber", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetNumber )
-		pFnSetNumber = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetNumber" );
+	UFunction* const pFnSetNumber = pFnSetNumberRef.Get ( );
 
 	UGFxValue_execSetNumber_Parms SetNumber_Parms;
 	memcpy ( &SetNumber_Parms.member, &member, 0x10 );
 	SetNumber_Parms.F = F;
 
-	pFnSetNumber->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetNumber, &SetNumber_Parms, NULL );
-
-	pFnSetNumber->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetNumber, &SetNumber_Parms ) )
+		this->ProcessEvent ( pFnSetNumber, &SetNumber_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetBool
@@ -3061,20 +2582,16 @@ void UGFxValue::SetNumber ( FString const& member, float F )
 
 void UGFxValue::SetBool ( FString const& member, unsigned long B )
 {
-	static UFunction* pFnSetBool = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetBoolRef { L"Function GFxUI.GFxValue.SetBool", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetBool )
-		pFnSetBool = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetBool" );
+	UFunction* const pFnSetBool = pFnSetBoolRef.Get ( );
 
 	UGFxValue_execSetBool_Parms SetBool_Parms;
 	memcpy ( &SetBool_Parms.member, &member, 0x10 );
 	SetBool_Parms.B = B;
 
-	pFnSetBool->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetBool, &SetBool_Parms, NULL );
-
-	pFnSetBool->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetBool, &SetBool_Parms ) )
+		this->ProcessEvent ( pFnSetBool, &SetBool_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetFunction
@@ -3086,21 +2603,17 @@ void UGFxValue::SetBool ( FString const& member, unsigned long B )
 
 void UGFxValue::SetFunction ( FString const& member, class UObject* context, struct SFXName fname )
 {
-	static UFunction* pFnSetFunction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetFunctionRef { L"Function GFxUI.GFxValue.SetFunction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetFunction )
-		pFnSetFunction = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetFunction" );
+	UFunction* const pFnSetFunction = pFnSetFunctionRef.Get ( );
 
 	UGFxValue_execSetFunction_Parms SetFunction_Parms;
 	memcpy ( &SetFunction_Parms.member, &member, 0x10 );
 	SetFunction_Parms.context = context;
 	memcpy ( &SetFunction_Parms.fname, &fname, 0x8 );
 
-	pFnSetFunction->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetFunction, &SetFunction_Parms, NULL );
-
-	pFnSetFunction->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetFunction, &SetFunction_Parms ) )
+		this->ProcessEvent ( pFnSetFunction, &SetFunction_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.SetObject
@@ -3111,20 +2624,16 @@ void UGFxValue::SetFunction ( FString const& member, class UObject* context, str
 
 void UGFxValue::SetObject ( FString const& member, class UGFxValue* val )
 {
-	static UFunction* pFnSetObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetObjectRef { L"Function GFxUI.GFxValue.SetObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetObject )
-		pFnSetObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.SetObject" );
+	UFunction* const pFnSetObject = pFnSetObjectRef.Get ( );
 
 	UGFxValue_execSetObject_Parms SetObject_Parms;
 	memcpy ( &SetObject_Parms.member, &member, 0x10 );
 	SetObject_Parms.val = val;
 
-	pFnSetObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetObject, &SetObject_Parms, NULL );
-
-	pFnSetObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetObject, &SetObject_Parms ) )
+		this->ProcessEvent ( pFnSetObject, &SetObject_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.Set
@@ -3135,20 +2644,16 @@ void UGFxValue::SetObject ( FString const& member, class UGFxValue* val )
 
 void UGFxValue::Set ( FString const& member, struct FASValue const& arg )
 {
-	static UFunction* pFnSet = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetRef { L"Function GFxUI.GFxValue.Set", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSet )
-		pFnSet = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.Set" );
+	UFunction* const pFnSet = pFnSetRef.Get ( );
 
 	UGFxValue_execSet_Parms Set_Parms;
 	memcpy ( &Set_Parms.member, &member, 0x10 );
 	memcpy ( &Set_Parms.arg, &arg, 0x1C );
 
-	pFnSet->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSet, &Set_Parms, NULL );
-
-	pFnSet->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSet, &Set_Parms ) )
+		this->ProcessEvent ( pFnSet, &Set_Parms, NULL );
 };
 
 // Function GFxUI.GFxValue.GetString
@@ -3159,19 +2664,15 @@ void UGFxValue::Set ( FString const& member, struct FASValue const& arg )
 
 FString UGFxValue::GetString ( FString const& member )
 {
-	static UFunction* pFnGetString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetStringRef { L"Function GFxUI.GFxValue.GetString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetString )
-		pFnGetString = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetString" );
+	UFunction* const pFnGetString = pFnGetStringRef.Get ( );
 
 	UGFxValue_execGetString_Parms GetString_Parms;
 	memcpy ( &GetString_Parms.member, &member, 0x10 );
 
-	pFnGetString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetString, &GetString_Parms, NULL );
-
-	pFnGetString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetString, &GetString_Parms ) )
+		this->ProcessEvent ( pFnGetString, &GetString_Parms, NULL );
 
 	return GetString_Parms.ReturnValue;
 };
@@ -3184,19 +2685,15 @@ FString UGFxValue::GetString ( FString const& member )
 
 float UGFxValue::GetNumber ( FString const& member )
 {
-	static UFunction* pFnGetNumber = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetNumberRef { L"Function GFxUI.GFxValue.GetNumber", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetNumber )
-		pFnGetNumber = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetNumber" );
+	UFunction* const pFnGetNumber = pFnGetNumberRef.Get ( );
 
 	UGFxValue_execGetNumber_Parms GetNumber_Parms;
 	memcpy ( &GetNumber_Parms.member, &member, 0x10 );
 
-	pFnGetNumber->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetNumber, &GetNumber_Parms, NULL );
-
-	pFnGetNumber->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetNumber, &GetNumber_Parms ) )
+		this->ProcessEvent ( pFnGetNumber, &GetNumber_Parms, NULL );
 
 	return GetNumber_Parms.ReturnValue;
 };
@@ -3209,19 +2706,15 @@ float UGFxValue::GetNumber ( FString const& member )
 
 bool UGFxValue::GetBool ( FString const& member )
 {
-	static UFunction* pFnGetBool = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetBoolRef { L"Function GFxUI.GFxValue.GetBool", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetBool )
-		pFnGetBool = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetBool" );
+	UFunction* const pFnGetBool = pFnGetBoolRef.Get ( );
 
 	UGFxValue_execGetBool_Parms GetBool_Parms;
 	memcpy ( &GetBool_Parms.member, &member, 0x10 );
 
-	pFnGetBool->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetBool, &GetBool_Parms, NULL );
-
-	pFnGetBool->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetBool, &GetBool_Parms ) )
+		this->ProcessEvent ( pFnGetBool, &GetBool_Parms, NULL );
 
 	return GetBool_Parms.ReturnValue;
 };
@@ -3235,20 +2728,16 @@ bool UGFxValue::GetBool ( FString const& member )
 
 class UGFxValue* UGFxValue::GetObject ( FString const& member, class UClass* Type )
 {
-	static UFunction* pFnGetObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjectRef { L"Function GFxUI.GFxValue.GetObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObject )
-		pFnGetObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.GetObject" );
+	UFunction* const pFnGetObject = pFnGetObjectRef.Get ( );
 
 	UGFxValue_execGetObject_Parms GetObject_Parms;
 	memcpy ( &GetObject_Parms.member, &member, 0x10 );
 	GetObject_Parms.Type = Type;
 
-	pFnGetObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetObject, &GetObject_Parms, NULL );
-
-	pFnGetObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetObject, &GetObject_Parms ) )
+		this->ProcessEvent ( pFnGetObject, &GetObject_Parms, NULL );
 
 	return GetObject_Parms.ReturnValue;
 };
@@ -3261,19 +2750,15 @@ class UGFxValue* UGFxValue::GetObject ( FString const& member, class UClass* Typ
 
 struct FASValue UGFxValue::Get ( FString const& member )
 {
-	static UFunction* pFnGet = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetRef { L"Function GFxUI.GFxValue.Get", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGet )
-		pFnGet = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.Get" );
+	UFunction* const pFnGet = pFnGetRef.Get ( );
 
 	UGFxValue_execGet_Parms Get_Parms;
 	memcpy ( &Get_Parms.member, &member, 0x10 );
 
-	pFnGet->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGet, &Get_Parms, NULL );
-
-	pFnGet->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGet, &Get_Parms ) )
+		this->ProcessEvent ( pFnGet, &Get_Parms, NULL );
 
 	return Get_Parms.ReturnValue;
 };
@@ -3287,34 +2772,27 @@ struct FASValue UGFxValue::Get ( FString const& member )
 
 struct FASValue UGFxValue::Invoke ( FString const& member, TArray<struct FASValue> const& Args )
 {
-	static UFunction* pFnInvoke = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInvokeRef { L"Function GFxUI.GFxValue.Invoke", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInvoke )
-		pFnInvoke = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxValue.Invoke" );
+	UFunction* const pFnInvoke = pFnInvokeRef.Get ( );
 
 	UGFxValue_execInvoke_Parms Invoke_Parms;
 	memcpy ( &Invoke_Parms.member, &member, 0x10 );
 	memcpy ( &Invoke_Parms.Args, &Args, 0x10 );
 
-	pFnInvoke->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnInvoke, &Invoke_Parms, NULL );
-
-	pFnInvoke->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnInvoke, &Invoke_Parms ) )
+		this->ProcessEvent ( pFnInvoke, &Invoke_Parms, NULL );
 
 	return Invoke_Parms.ReturnValue;
 };
 
 
 
-class UClass* UGFxAction_CloseMovie::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxAction_CloseMovie::pClassPointer { L"Class GFxUI.GFxAction_CloseMovie", &UObject::FindClass };
 
 class UClass* UGFxAction_CloseMovie::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxAction_CloseMovie" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function GFxUI.GFxAction_CloseMovie.IsValidLevelSequenceObject
@@ -3324,10 +2802,9 @@ class UClass* UGFxAction_CloseMovie::StaticClass()
 
 bool UGFxAction_CloseMovie::eventIsValidLevelSequenceObject ( )
 {
-	static UFunction* pFnIsValidLevelSequenceObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsValidLevelSequenceObjectRef { L"Function GFxUI.GFxAction_CloseMovie.IsValidLevelSequenceObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsValidLevelSequenceObject )
-		pFnIsValidLevelSequenceObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxAction_CloseMovie.IsValidLevelSequenceObject" );
+	UFunction* const pFnIsValidLevelSequenceObject = pFnIsValidLevelSequenceObjectRef.Get ( );
 
 	UGFxAction_CloseMovie_eventIsValidLevelSequenceObject_Parms IsValidLevelSequenceObject_Parms;
 
@@ -3338,14 +2815,11 @@ bool UGFxAction_CloseMovie::eventIsValidLevelSequenceObject ( )
 
 
 
-class UClass* UGFxAction_GetVariable::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxAction_GetVariable::pClassPointer { L"Class GFxUI.GFxAction_GetVariable", &UObject::FindClass };
 
 class UClass* UGFxAction_GetVariable::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxAction_GetVariable" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function GFxUI.GFxAction_GetVariable.IsValidLevelSequenceObject
@@ -3355,10 +2829,9 @@ class UClass* UGFxAction_GetVariable::StaticClass()
 
 bool UGFxAction_GetVariable::eventIsValidLevelSequenceObject ( )
 {
-	static UFunction* pFnIsValidLevelSequenceObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsValidLevelSequenceObjectRef { L"Function GFxUI.GFxAction_GetVariable.IsValidLevelSequenceObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsValidLevelSequenceObject )
-		pFnIsValidLevelSequenceObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxAction_GetVariable.IsValidLevelSequenceObject" );
+	UFunction* const pFnIsValidLevelSequenceObject = pFnIsValidLevelSequenceObjectRef.Get ( );
 
 	UGFxAction_GetVariable_eventIsValidLevelSequenceObject_Parms IsValidLevelSequenceObject_Parms;
 
@@ -3369,14 +2842,11 @@ bool UGFxAction_GetVariable::eventIsValidLevelSequenceObject ( )
 
 
 
-class UClass* UGFxAction_Invoke::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxAction_Invoke::pClassPointer { L"Class GFxUI.GFxAction_Invoke", &UObject::FindClass };
 
 class UClass* UGFxAction_Invoke::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxAction_Invoke" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function GFxUI.GFxAction_Invoke.IsValidLevelSequenceObject
@@ -3386,10 +2856,9 @@ class UClass* UGFxAction_Invoke::StaticClass()
 
 bool UGFxAction_Invoke::eventIsValidLevelSequenceObject ( )
 {
-	static UFunction* pFnIsValidLevelSequenceObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsValidLevelSequenceObjectRef { L"Function GFxUI.GFxAction_Invoke.IsValidLevelSequenceObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsValidLevelSequenceObject )
-		pFnIsValidLevelSequenceObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxAction_Invoke.IsValidLevelSequenceObject" );
+	UFunction* const pFnIsValidLevelSequenceObject = pFnIsValidLevelSequenceObjectRef.Get ( );
 
 	UGFxAction_Invoke_eventIsValidLevelSequenceObject_Parms IsValidLevelSequenceObject_Parms;
 
@@ -3400,14 +2869,11 @@ bool UGFxAction_Invoke::eventIsValidLevelSequenceObject ( )
 
 
 
-class UClass* UGFxAction_OpenMovie::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxAction_OpenMovie::pClassPointer { L"Class GFxUI.GFxAction_OpenMovie", &UObject::FindClass };
 
 class UClass* UGFxAction_OpenMovie::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxAction_OpenMovie" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function GFxUI.GFxAction_OpenMovie.IsValidLevelSequenceObject
@@ -3417,10 +2883,9 @@ class UClass* UGFxAction_OpenMovie::StaticClass()
 
 bool UGFxAction_OpenMovie::eventIsValidLevelSequenceObject ( )
 {
-	static UFunction* pFnIsValidLevelSequenceObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsValidLevelSequenceObjectRef { L"Function GFxUI.GFxAction_OpenMovie.IsValidLevelSequenceObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsValidLevelSequenceObject )
-		pFnIsValidLevelSequenceObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxAction_OpenMovie.IsValidLevelSequenceObject" );
+	UFunction* const pFnIsValidLevelSequenceObject = pFnIsValidLevelSequenceObjectRef.Get ( );
 
 	UGFxAction_OpenMovie_eventIsValidLevelSequenceObject_Parms IsValidLevelSequenceObject_Parms;
 
@@ -3431,38 +2896,29 @@ bool UGFxAction_OpenMovie::eventIsValidLevelSequenceObject ( )
 
 
 
-class UClass* UGFxAction_SetCaptureKeys::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxAction_SetCaptureKeys::pClassPointer { L"Class GFxUI.GFxAction_SetCaptureKeys", &UObject::FindClass };
 
 class UClass* UGFxAction_SetCaptureKeys::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxAction_SetCaptureKeys" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UGFxAction_SetFocus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxAction_SetFocus::pClassPointer { L"Class GFxUI.GFxAction_SetFocus", &UObject::FindClass };
 
 class UClass* UGFxAction_SetFocus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxAction_SetFocus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UGFxAction_SetVariable::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxAction_SetVariable::pClassPointer { L"Class GFxUI.GFxAction_SetVariable", &UObject::FindClass };
 
 class UClass* UGFxAction_SetVariable::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxAction_SetVariable" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function GFxUI.GFxAction_SetVariable.IsValidLevelSequenceObject
@@ -3472,10 +2928,9 @@ class UClass* UGFxAction_SetVariable::StaticClass()
 
 bool UGFxAction_SetVariable::eventIsValidLevelSequenceObject ( )
 {
-	static UFunction* pFnIsValidLevelSequenceObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsValidLevelSequenceObjectRef { L"Function GFxUI.GFxAction_SetVariable.IsValidLevelSequenceObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsValidLevelSequenceObject )
-		pFnIsValidLevelSequenceObject = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxAction_SetVariable.IsValidLevelSequenceObject" );
+	UFunction* const pFnIsValidLevelSequenceObject = pFnIsValidLevelSequenceObjectRef.Get ( );
 
 	UGFxAction_SetVariable_eventIsValidLevelSequenceObject_Parms IsValidLevelSequenceObject_Parms;
 
@@ -3486,26 +2941,20 @@ bool UGFxAction_SetVariable::eventIsValidLevelSequenceObject ( )
 
 
 
-class UClass* UGFxEvent_FsCommand::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxEvent_FsCommand::pClassPointer { L"Class GFxUI.GFxEvent_FsCommand", &UObject::FindClass };
 
 class UClass* UGFxEvent_FsCommand::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxEvent_FsCommand" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UGFxFSCmdHandler_Kismet::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxFSCmdHandler_Kismet::pClassPointer { L"Class GFxUI.GFxFSCmdHandler_Kismet", &UObject::FindClass };
 
 class UClass* UGFxFSCmdHandler_Kismet::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxFSCmdHandler_Kismet" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function GFxUI.GFxFSCmdHandler_Kismet.FSCommand
@@ -3518,35 +2967,28 @@ class UClass* UGFxFSCmdHandler_Kismet::StaticClass()
 
 bool UGFxFSCmdHandler_Kismet::eventFSCommand ( class UGFxMovie* Movie, FString const& Cmd, FString const& arg )
 {
-	static UFunction* pFnFSCommand = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFSCommandRef { L"Function GFxUI.GFxFSCmdHandler_Kismet.FSCommand", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFSCommand )
-		pFnFSCommand = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxFSCmdHandler_Kismet.FSCommand" );
+	UFunction* const pFnFSCommand = pFnFSCommandRef.Get ( );
 
 	UGFxFSCmdHandler_Kismet_eventFSCommand_Parms FSCommand_Parms;
 	FSCommand_Parms.Movie = Movie;
 	memcpy ( &FSCommand_Parms.Cmd, &Cmd, 0x10 );
 	memcpy ( &FSCommand_Parms.arg, &arg, 0x10 );
 
-	pFnFSCommand->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFSCommand, &FSCommand_Parms, NULL );
-
-	pFnFSCommand->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFSCommand, &FSCommand_Parms ) )
+		this->ProcessEvent ( pFnFSCommand, &FSCommand_Parms, NULL );
 
 	return FSCommand_Parms.ReturnValue;
 };
 
 
 
-class UClass* UGFxDataStoreSubscriber::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGFxDataStoreSubscriber::pClassPointer { L"Class GFxUI.GFxDataStoreSubscriber", &UObject::FindClass };
 
 class UClass* UGFxDataStoreSubscriber::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GFxUI.GFxDataStoreSubscriber" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function GFxUI.GFxDataStoreSubscriber.SaveSubscriberValue
@@ -3558,10 +3000,9 @@ class UClass* UGFxDataStoreSubscriber::StaticClass()
 
 bool UGFxDataStoreSubscriber::SaveSubscriberValue ( int BindingIndex, TArray<class UUIDataStore*>* out_BoundDataStores )
 {
-	static UFunction* pFnSaveSubscriberValue = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSaveSubscriberValueRef { L"Function GFxUI.GFxDataStoreSubscriber.SaveSubscriberValue", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSaveSubscriberValue )
-		pFnSaveSubscriberValue = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxDataStoreSubscriber.SaveSubscriberValue" );
+	UFunction* const pFnSaveSubscriberValue = pFnSaveSubscriberValueRef.Get ( );
 
 	UGFxDataStoreSubscriber_execSaveSubscriberValue_Parms SaveSubscriberValue_Parms;
 	SaveSubscriberValue_Parms.BindingIndex = BindingIndex;
@@ -3569,11 +3010,8 @@ bool UGFxDataStoreSubscriber::SaveSubscriberValue ( int BindingIndex, TArray<cla
 	if ( out_BoundDataStores )
 		memcpy ( &SaveSubscriberValue_Parms.out_BoundDataStores, out_BoundDataStores, 0x10 );
 
-	pFnSaveSubscriberValue->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSaveSubscriberValue, &SaveSubscriberValue_Parms, NULL );
-
-	pFnSaveSubscriberValue->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSaveSubscriberValue, &SaveSubscriberValue_Parms ) )
+		this->ProcessEvent ( pFnSaveSubscriberValue, &SaveSubscriberValue_Parms, NULL );
 
 	if ( out_BoundDataStores )
 		memcpy ( out_BoundDataStores, &SaveSubscriberValue_Parms.out_BoundDataStores, 0x10 );
@@ -3587,18 +3025,14 @@ bool UGFxDataStoreSubscriber::SaveSubscriberValue ( int BindingIndex, TArray<cla
 
 void UGFxDataStoreSubscriber::ClearBoundDataStores ( )
 {
-	static UFunction* pFnClearBoundDataStores = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearBoundDataStoresRef { L"Function GFxUI.GFxDataStoreSubscriber.ClearBoundDataStores", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearBoundDataStores )
-		pFnClearBoundDataStores = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxDataStoreSubscriber.ClearBoundDataStores" );
+	UFunction* const pFnClearBoundDataStores = pFnClearBoundDataStoresRef.Get ( );
 
 	UGFxDataStoreSubscriber_execClearBoundDataStores_Parms ClearBoundDataStores_Parms;
 
-	pFnClearBoundDataStores->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnClearBoundDataStores, &ClearBoundDataStores_Parms, NULL );
-
-	pFnClearBoundDataStores->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnClearBoundDataStores, &ClearBoundDataStores_Parms ) )
+		this->ProcessEvent ( pFnClearBoundDataStores, &ClearBoundDataStores_Parms, NULL );
 };
 
 // Function GFxUI.GFxDataStoreSubscriber.GetBoundDataStores
@@ -3608,21 +3042,17 @@ void UGFxDataStoreSubscriber::ClearBoundDataStores ( )
 
 void UGFxDataStoreSubscriber::GetBoundDataStores ( TArray<class UUIDataStore*>* out_BoundDataStores )
 {
-	static UFunction* pFnGetBoundDataStores = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetBoundDataStoresRef { L"Function GFxUI.GFxDataStoreSubscriber.GetBoundDataStores", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetBoundDataStores )
-		pFnGetBoundDataStores = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxDataStoreSubscriber.GetBoundDataStores" );
+	UFunction* const pFnGetBoundDataStores = pFnGetBoundDataStoresRef.Get ( );
 
 	UGFxDataStoreSubscriber_execGetBoundDataStores_Parms GetBoundDataStores_Parms;
 
 	if ( out_BoundDataStores )
 		memcpy ( &GetBoundDataStores_Parms.out_BoundDataStores, out_BoundDataStores, 0x10 );
 
-	pFnGetBoundDataStores->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetBoundDataStores, &GetBoundDataStores_Parms, NULL );
-
-	pFnGetBoundDataStores->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetBoundDataStores, &GetBoundDataStores_Parms ) )
+		this->ProcessEvent ( pFnGetBoundDataStores, &GetBoundDataStores_Parms, NULL );
 
 	if ( out_BoundDataStores )
 		memcpy ( out_BoundDataStores, &GetBoundDataStores_Parms.out_BoundDataStores, 0x10 );
@@ -3639,10 +3069,9 @@ void UGFxDataStoreSubscriber::GetBoundDataStores ( TArray<class UUIDataStore*>*
 
 void UGFxDataStoreSubscriber::NotifyDataStoreValueUpdated ( class UUIDataStore* SourceDataStore, unsigned long bValuesInvalidated, struct SFXName PropertyTag, class UUIDataProvider* SourceProvider, int ArrayIndex )
 {
-	static UFunction* pFnNotifyDataStoreValueUpdated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyDataStoreValueUpdatedRef { L"Function GFxUI.GFxDataStoreSubscriber.NotifyDataStoreValueUpdated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyDataStoreValueUpdated )
-		pFnNotifyDataStoreValueUpdated = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxDataStoreSubscriber.NotifyDataStoreValueUpdated" );
+	UFunction* const pFnNotifyDataStoreValueUpdated = pFnNotifyDataStoreValueUpdatedRef.Get ( );
 
 	UGFxDataStoreSubscriber_execNotifyDataStoreValueUpdated_Parms NotifyDataStoreValueUpdated_Parms;
 	NotifyDataStoreValueUpdated_Parms.SourceDataStore = SourceDataStore;
@@ -3651,11 +3080,8 @@ void UGFxDataStoreSubscriber::NotifyDataStoreValueUpdated ( class UUIDataStore*
 	NotifyDataStoreValueUpdated_Parms.SourceProvider = SourceProvider;
 	NotifyDataStoreValueUpdated_Parms.ArrayIndex = ArrayIndex;
 
-	pFnNotifyDataStoreValueUpdated->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotifyDataStoreValueUpdated, &NotifyDataStoreValueUpdated_Parms, NULL );
-
-	pFnNotifyDataStoreValueUpdated->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNotifyDataStoreValueUpdated, &NotifyDataStoreValueUpdated_Parms ) )
+		this->ProcessEvent ( pFnNotifyDataStoreValueUpdated, &NotifyDataStoreValueUpdated_Parms, NULL );
 };
 
 // Function GFxUI.GFxDataStoreSubscriber.RefreshSubscriberValue
@@ -3666,19 +3092,15 @@ void UGFxDataStoreSubscriber::NotifyDataStoreValueUpdated ( class UUIDataStore*
 
 bool UGFxDataStoreSubscriber::RefreshSubscriberValue ( int BindingIndex )
 {
-	static UFunction* pFnRefreshSubscriberValue = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRefreshSubscriberValueRef { L"Function GFxUI.GFxDataStoreSubscriber.RefreshSubscriberValue", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRefreshSubscriberValue )
-		pFnRefreshSubscriberValue = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxDataStoreSubscriber.RefreshSubscriberValue" );
+	UFunction* const pFnRefreshSubscriberValue = pFnRefreshSubscriberValueRef.Get ( );
 
 	UGFxDataStoreSubscriber_execRefreshSubscriberValue_Parms RefreshSubscriberValue_Parms;
 	RefreshSubscriberValue_Parms.BindingIndex = BindingIndex;
 
-	pFnRefreshSubscriberValue->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRefreshSubscriberValue, &RefreshSubscriberValue_Parms, NULL );
-
-	pFnRefreshSubscriberValue->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRefreshSubscriberValue, &RefreshSubscriberValue_Parms ) )
+		this->ProcessEvent ( pFnRefreshSubscriberValue, &RefreshSubscriberValue_Parms, NULL );
 
 	return RefreshSubscriberValue_Parms.ReturnValue;
 };
@@ -3691,19 +3113,15 @@ bool UGFxDataStoreSubscriber::RefreshSubscriberValue ( int BindingIndex )
 
 FString UGFxDataStoreSubscriber::GetDataStoreBinding ( int BindingIndex )
 {
-	static UFunction* pFnGetDataStoreBinding = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDataStoreBindingRef { L"Function GFxUI.GFxDataStoreSubscriber.GetDataStoreBinding", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDataStoreBinding )
-		pFnGetDataStoreBinding = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxDataStoreSubscriber.GetDataStoreBinding" );
+	UFunction* const pFnGetDataStoreBinding = pFnGetDataStoreBindingRef.Get ( );
 
 	UGFxDataStoreSubscriber_execGetDataStoreBinding_Parms GetDataStoreBinding_Parms;
 	GetDataStoreBinding_Parms.BindingIndex = BindingIndex;
 
-	pFnGetDataStoreBinding->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetDataStoreBinding, &GetDataStoreBinding_Parms, NULL );
-
-	pFnGetDataStoreBinding->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetDataStoreBinding, &GetDataStoreBinding_Parms ) )
+		this->ProcessEvent ( pFnGetDataStoreBinding, &GetDataStoreBinding_Parms, NULL );
 
 	return GetDataStoreBinding_Parms.ReturnValue;
 };
@@ -3716,20 +3134,16 @@ FString UGFxDataStoreSubscriber::GetDataStoreBinding ( int BindingIndex )
 
 void UGFxDataStoreSubscriber::SetDataStoreBinding ( FString const& MarkupText, int BindingIndex )
 {
-	static UFunction* pFnSetDataStoreBinding = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetDataStoreBindingRef { L"Function GFxUI.GFxDataStoreSubscriber.SetDataStoreBinding", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetDataStoreBinding )
-		pFnSetDataStoreBinding = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxDataStoreSubscriber.SetDataStoreBinding" );
+	UFunction* const pFnSetDataStoreBinding = pFnSetDataStoreBindingRef.Get ( );
 
 	UGFxDataStoreSubscriber_execSetDataStoreBinding_Parms SetDataStoreBinding_Parms;
 	memcpy ( &SetDataStoreBinding_Parms.MarkupText, &MarkupText, 0x10 );
 	SetDataStoreBinding_Parms.BindingIndex = BindingIndex;
 
-	pFnSetDataStoreBinding->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetDataStoreBinding, &SetDataStoreBinding_Parms, NULL );
-
-	pFnSetDataStoreBinding->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetDataStoreBinding, &SetDataStoreBinding_Parms ) )
+		this->ProcessEvent ( pFnSetDataStoreBinding, &SetDataStoreBinding_Parms, NULL );
 };
 
 // Function GFxUI.GFxDataStoreSubscriber.PublishValues
@@ -3738,19 +3152,189 @@ void UGFxDataStoreSubscriber::SetDataStoreBinding ( FString const& MarkupText, i
 
 void UGFxDataStoreSubscriber::PublishValues ( )
 {
-	static UFunction* pFnPublishValues = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPublishValuesRef { L"Function GFxUI.GFxDataStoreSubscriber.PublishValues", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPublishValues )
-		pFnPublishValues = UObject::FindObject< UFunction > ( L"Function GFxUI.GFxDataStoreSubscriber.PublishValues" );
+	UFunction* const pFnPublishValues = pFnPublishValuesRef.Get ( );
 
 	UGFxDataStoreSubscriber_execPublishValues_Parms PublishValues_Parms;
 
-	pFnPublishValues->FunctionFlags |= ~0x400;
+	if ( !::LESDK::CallNative ( this, pFnPublishValues, &PublishValues_Parms ) )
+		this->ProcessEvent ( pFnPublishValues, &PublishValues_Parms, NULL );
+};
 
-	this->ProcessEvent ( pFnPublishValues, &PublishValues_Parms, NULL );
 
-	pFnPublishValues->FunctionFlags |= 0x400;
-};
+
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class GFxUI.GFxEngine",
+	L"Class GFxUI.GFxFSCmdHandler",
+	L"Function GFxUI.GFxFSCmdHandler.FSCommand",
+	L"Class GFxUI.GFxGameViewportClient",
+	L"Function GFxUI.GFxGameViewportClient.Init",
+	L"Class GFxUI.GFxInteraction",
+	L"Function GFxUI.GFxInteraction.NotifyGameSessionEnded",
+	L"Function GFxUI.GFxInteraction.GetFocusMovie",
+	L"Function GFxUI.GFxInteraction.SetFocusMovie",
+	L"Class GFxUI.GFxMovie",
+	L"Function GFxUI.GFxMovie.UnregisterGFxValue",
+	L"Function GFxUI.GFxMovie.RegisterGFxValue",
+	L"Function GFxUI.GFxMovie.ActionScriptSetFunction",
+	L"Function GFxUI.GFxMovie.ActionScriptObject",
+	L"Function GFxUI.GFxMovie.ActionScriptString",
+	L"Function GFxUI.GFxMovie.ActionScriptFloat",
+	L"Function GFxUI.GFxMovie.ActionScriptInt",
+	L"Function GFxUI.GFxMovie.ActionScriptVoid",
+	L"Function GFxUI.GFxMovie.SetExternalInterface",
+	L"Function GFxUI.GFxMovie.SetFsCmdHandler",
+	L"Function GFxUI.GFxMovie.SetVariableObject",
+	L"Function GFxUI.GFxMovie.GetVariableObject",
+	L"Function GFxUI.GFxMovie.CreateArray",
+	L"Function GFxUI.GFxMovie.CreateObject",
+	L"Function GFxUI.GFxMovie.SetVariableStringArray",
+	L"Function GFxUI.GFxMovie.SetVariableFloatArray",
+	L"Function GFxUI.GFxMovie.SetVariableIntArray",
+	L"Function GFxUI.GFxMovie.SetVariableArray",
+	L"Function GFxUI.GFxMovie.GetVariableStringArray",
+	L"Function GFxUI.GFxMovie.GetVariableFloatArray",
+	L"Function GFxUI.GFxMovie.GetVariableIntArray",
+	L"Function GFxUI.GFxMovie.GetVariableArray",
+	L"Function GFxUI.GFxMovie.SetVariableString",
+	L"Function GFxUI.GFxMovie.SetVariableNumber",
+	L"Function GFxUI.GFxMovie.SetVariableBool",
+	L"Function GFxUI.GFxMovie.SetVariable",
+	L"Function GFxUI.GFxMovie.GetVariableString",
+	L"Function GFxUI.GFxMovie.GetVariableNumber",
+	L"Function GFxUI.GFxMovie.GetVariableBool",
+	L"Function GFxUI.GFxMovie.GetVariable",
+	L"Function GFxUI.GFxMovie.PublishDataStoreValues",
+	L"Function GFxUI.GFxMovie.RefreshDataStoreBindings",
+	L"Function GFxUI.GFxMovie.Invoke",
+	L"Function GFxUI.GFxMovie.GetPC",
+	L"Function GFxUI.GFxMovie.GetLP",
+	L"Function GFxUI.GFxMovie.SetTimingMode",
+	L"Function GFxUI.GFxMovie.Pause",
+	L"Function GFxUI.GFxMovie.Update",
+	L"Function GFxUI.GFxMovie.Advance",
+	L"Function GFxUI.GFxMovie.SetExternalTexture",
+	L"Function GFxUI.GFxMovie.IsUsingGamepad",
+	L"Function GFxUI.GFxMovie.FlushPlayerInput",
+	L"Function GFxUI.GFxMovie.ClearFocusIgnoreKeys",
+	L"Function GFxUI.GFxMovie.AddFocusIgnoreKey",
+	L"Function GFxUI.GFxMovie.ClearCaptureKeys",
+	L"Function GFxUI.GFxMovie.AddCaptureKey",
+	L"Function GFxUI.GFxMovie.SetFocus",
+	L"Function GFxUI.GFxMovie.SetSceneDPG",
+	L"Function GFxUI.GFxMovie.SetPerspective3D",
+	L"Function GFxUI.GFxMovie.SetView3D",
+	L"Function GFxUI.GFxMovie.GetVisibleFrameRect",
+	L"Function GFxUI.GFxMovie.SetAlignment",
+	L"Function GFxUI.GFxMovie.SetViewScaleMode",
+	L"Function GFxUI.GFxMovie.SetViewport",
+	L"Function GFxUI.GFxMovie.GetGameViewportClient",
+	L"Function GFxUI.GFxMovie.SetMovieInfo",
+	L"Function GFxUI.GFxMovie.OnClose",
+	L"Function GFxUI.GFxMovie.Close",
+	L"Function GFxUI.GFxMovie.Start",
+	L"Class GFxUI.GFxMovieInfo",
+	L"Class GFxUI.GFxValue",
+	L"Function GFxUI.GFxValue.ActionScriptSetFunctionOn",
+	L"Function GFxUI.GFxValue.ActionScriptSetFunction",
+	L"Function GFxUI.GFxValue.ActionScriptArray",
+	L"Function GFxUI.GFxValue.ActionScriptObject",
+	L"Function GFxUI.GFxValue.ActionScriptString",
+	L"Function GFxUI.GFxValue.ActionScriptFloat",
+	L"Function GFxUI.GFxValue.ActionScriptInt",
+	L"Function GFxUI.GFxValue.ActionScriptVoid",
+	L"Function GFxUI.GFxValue.SetElementMemberString",
+	L"Function GFxUI.GFxValue.SetElementMemberNumber",
+	L"Function GFxUI.GFxValue.SetElementMemberBool",
+	L"Function GFxUI.GFxValue.SetElementMemberObject",
+	L"Function GFxUI.GFxValue.SetElementMember",
+	L"Function GFxUI.GFxValue.GetElementMemberString",
+	L"Function GFxUI.GFxValue.GetElementMemberNumber",
+	L"Function GFxUI.GFxValue.GetElementMemberBool",
+	L"Function GFxUI.GFxValue.GetElementMemberObject",
+	L"Function GFxUI.GFxValue.GetElementMember",
+	L"Function GFxUI.GFxValue.SetElementColorTransform",
+	L"Function GFxUI.GFxValue.SetElementPosition",
+	L"Function GFxUI.GFxValue.SetElementVisible",
+	L"Function GFxUI.GFxValue.SetElementDisplayMatrix",
+	L"Function GFxUI.GFxValue.SetElementDisplayInfo",
+	L"Function GFxUI.GFxValue.SetElementString",
+	L"Function GFxUI.GFxValue.SetElementNumber",
+	L"Function GFxUI.GFxValue.SetElementBool",
+	L"Function GFxUI.GFxValue.SetElementObject",
+	L"Function GFxUI.GFxValue.SetElement",
+	L"Function GFxUI.GFxValue.GetElementDisplayMatrix",
+	L"Function GFxUI.GFxValue.GetElementDisplayInfo",
+	L"Function GFxUI.GFxValue.GetElementString",
+	L"Function GFxUI.GFxValue.GetElementNumber",
+	L"Function GFxUI.GFxValue.GetElementBool",
+	L"Function GFxUI.GFxValue.GetElementObject",
+	L"Function GFxUI.GFxValue.GetElement",
+	L"Function GFxUI.GFxValue.SetText",
+	L"Function GFxUI.GFxValue.GetText",
+	L"Function GFxUI.GFxValue.AttachMovie",
+	L"Function GFxUI.GFxValue.CreateEmptyMovieClip",
+	L"Function GFxUI.GFxValue.GotoAndStopI",
+	L"Function GFxUI.GFxValue.GotoAndStop",
+	L"Function GFxUI.GFxValue.GotoAndPlayI",
+	L"Function GFxUI.GFxValue.GotoAndPlay",
+	L"Function GFxUI.GFxValue.SetColorTransform",
+	L"Function GFxUI.GFxValue.SetPosition",
+	L"Function GFxUI.GFxValue.SetVisible",
+	L"Function GFxUI.GFxValue.SetDisplayMatrix3D",
+	L"Function GFxUI.GFxValue.SetDisplayMatrix",
+	L"Function GFxUI.GFxValue.SetDisplayInfo",
+	L"Function GFxUI.GFxValue.GetPosition",
+	L"Function GFxUI.GFxValue.GetColorTransform",
+	L"Function GFxUI.GFxValue.GetDisplayMatrix",
+	L"Function GFxUI.GFxValue.GetDisplayInfo",
+	L"Function GFxUI.GFxValue.SetString",
+	L"Function GFxUI.GFxValue.SetNumber",
+	L"Function GFxUI.GFxValue.SetBool",
+	L"Function GFxUI.GFxValue.SetFunction",
+	L"Function GFxUI.GFxValue.SetObject",
+	L"Function GFxUI.GFxValue.Set",
+	L"Function GFxUI.GFxValue.GetString",
+	L"Function GFxUI.GFxValue.GetNumber",
+	L"Function GFxUI.GFxValue.GetBool",
+	L"Function GFxUI.GFxValue.GetObject",
+	L"Function GFxUI.GFxValue.Get",
+	L"Function GFxUI.GFxValue.Invoke",
+	L"Class GFxUI.GFxAction_CloseMovie",
+	L"Function GFxUI.GFxAction_CloseMovie.IsValidLevelSequenceObject",
+	L"Class GFxUI.GFxAction_GetVariable",
+	L"Function GFxUI.GFxAction_GetVariable.IsValidLevelSequenceObject",
+	L"Class GFxUI.GFxAction_Invoke",
+	L"Function GFxUI.GFxAction_Invoke.IsValidLevelSequenceObject",
+	L"Class GFxUI.GFxAction_OpenMovie",
+	L"Function GFxUI.GFxAction_OpenMovie.IsValidLevelSequenceObject",
+	L"Class GFxUI.GFxAction_SetCaptureKeys",
+	L"Class GFxUI.GFxAction_SetFocus",
+	L"Class GFxUI.GFxAction_SetVariable",
+	L"Function GFxUI.GFxAction_SetVariable.IsValidLevelSequenceObject",
+	L"Class GFxUI.GFxEvent_FsCommand",
+	L"Class GFxUI.GFxFSCmdHandler_Kismet",
+	L"Function GFxUI.GFxFSCmdHandler_Kismet.FSCommand",
+	L"Class GFxUI.GFxDataStoreSubscriber",
+	L"Function GFxUI.GFxDataStoreSubscriber.SaveSubscriberValue",
+	L"Function GFxUI.GFxDataStoreSubscriber.ClearBoundDataStores",
+	L"Function GFxUI.GFxDataStoreSubscriber.GetBoundDataStores",
+	L"Function GFxUI.GFxDataStoreSubscriber.NotifyDataStoreValueUpdated",
+	L"Function GFxUI.GFxDataStoreSubscriber.RefreshSubscriberValue",
+	L"Function GFxUI.GFxDataStoreSubscriber.GetDataStoreBinding",
+	L"Function GFxUI.GFxDataStoreSubscriber.SetDataStoreBinding",
+	L"Function GFxUI.GFxDataStoreSubscriber.PublishValues",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
 
 
 
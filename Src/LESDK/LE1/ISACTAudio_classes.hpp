@@ -50,7 +50,7 @@ public:
 	unsigned char                                      UnknownData01[ 0x2C ];                            		// 0x0434 (0x002C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28,18 +28,30 @@
 
 
 
-class UClass* UISACTAudioDevice::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UISACTAudioDevice::pClassPointer { L"Class ISACTAudio.ISACTAudioDevice", &UObject::FindClass };
 
 class UClass* UISACTAudioDevice::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class ISACTAudio.ISACTAudioDevice" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class ISACTAudio.ISACTAudioDevice",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
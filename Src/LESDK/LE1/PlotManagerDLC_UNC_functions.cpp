@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioAutoConditionals::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioAutoConditionals::pClassPointer { L"Class PlotManagerDLC_UNC.BioAutoConditionals", &UObject::FindClass };
 
 class UClass* UBioAutoConditionals::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class PlotManagerDLC_UNC.BioAutoConditionals" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function PlotManagerDLC_UNC.BioAutoConditionals.F1798
@@ -47,10 +44,9 @@ class UClass* UBioAutoConditionals::StaticClass()
 
 bool UBioAutoConditionals::F1798 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1798 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1798Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1798", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1798 )
-		pFnF1798 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1798" );
+	UFunction* const pFnF1798 = pFnF1798Ref.Get ( );
 
 	UBioAutoConditionals_execF1798_Parms F1798_Parms;
 	F1798_Parms.bioWorld = bioWorld;
@@ -70,10 +66,9 @@ bool UBioAutoConditionals::F1798 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1826 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1826 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1826Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1826", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1826 )
-		pFnF1826 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1826" );
+	UFunction* const pFnF1826 = pFnF1826Ref.Get ( );
 
 	UBioAutoConditionals_execF1826_Parms F1826_Parms;
 	F1826_Parms.bioWorld = bioWorld;
@@ -93,10 +88,9 @@ bool UBioAutoConditionals::F1826 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1824 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1824 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1824Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1824", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1824 )
-		pFnF1824 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1824" );
+	UFunction* const pFnF1824 = pFnF1824Ref.Get ( );
 
 	UBioAutoConditionals_execF1824_Parms F1824_Parms;
 	F1824_Parms.bioWorld = bioWorld;
@@ -116,10 +110,9 @@ bool UBioAutoConditionals::F1824 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1823 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1823 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1823Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1823", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1823 )
-		pFnF1823 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1823" );
+	UFunction* const pFnF1823 = pFnF1823Ref.Get ( );
 
 	UBioAutoConditionals_execF1823_Parms F1823_Parms;
 	F1823_Parms.bioWorld = bioWorld;
@@ -139,10 +132,9 @@ bool UBioAutoConditionals::F1823 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1822 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1822 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1822Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1822", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1822 )
-		pFnF1822 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1822" );
+	UFunction* const pFnF1822 = pFnF1822Ref.Get ( );
 
 	UBioAutoConditionals_execF1822_Parms F1822_Parms;
 	F1822_Parms.bioWorld = bioWorld;
@@ -162,10 +154,9 @@ bool UBioAutoConditionals::F1822 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1816 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1816 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1816Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1816", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1816 )
-		pFnF1816 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1816" );
+	UFunction* const pFnF1816 = pFnF1816Ref.Get ( );
 
 	UBioAutoConditionals_execF1816_Parms F1816_Parms;
 	F1816_Parms.bioWorld = bioWorld;
@@ -185,10 +176,9 @@ bool UBioAutoConditionals::F1816 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1815 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1815 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1815Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1815", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1815 )
-		pFnF1815 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1815" );
+	UFunction* const pFnF1815 = pFnF1815Ref.Get ( );
 
 	UBioAutoConditionals_execF1815_Parms F1815_Parms;
 	F1815_Parms.bioWorld = bioWorld;
@@ -208,10 +198,9 @@ bool UBioAutoConditionals::F1815 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1814 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1814 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1814Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1814", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1814 )
-		pFnF1814 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1814" );
+	UFunction* const pFnF1814 = pFnF1814Ref.Get ( );
 
 	UBioAutoConditionals_execF1814_Parms F1814_Parms;
 	F1814_Parms.bioWorld = bioWorld;
@@ -231,10 +220,9 @@ bool UBioAutoConditionals::F1814 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1813 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1813 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1813Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1813", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1813 )
-		pFnF1813 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1813" );
+	UFunction* const pFnF1813 = pFnF1813Ref.Get ( );
 
 	UBioAutoConditionals_execF1813_Parms F1813_Parms;
 	F1813_Parms.bioWorld = bioWorld;
@@ -254,10 +242,9 @@ bool UBioAutoConditionals::F1813 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1808 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1808 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1808Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1808", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1808 )
-		pFnF1808 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1808" );
+	UFunction* const pFnF1808 = pFnF1808Ref.Get ( );
 
 	UBioAutoConditionals_execF1808_Parms F1808_Parms;
 	F1808_Parms.bioWorld = bioWorld;
@@ -277,10 +264,9 @@ bool UBioAutoConditionals::F1808 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1807 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1807 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1807Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1807", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1807 )
-		pFnF1807 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1807" );
+	UFunction* const pFnF1807 = pFnF1807Ref.Get ( );
 
 	UBioAutoConditionals_execF1807_Parms F1807_Parms;
 	F1807_Parms.bioWorld = bioWorld;
@@ -300,10 +286,9 @@ bool UBioAutoConditionals::F1807 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1806 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1806 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1806Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1806", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1806 )
-		pFnF1806 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1806" );
+	UFunction* const pFnF1806 = pFnF1806Ref.Get ( );
 
 	UBioAutoConditionals_execF1806_Parms F1806_Parms;
 	F1806_Parms.bioWorld = bioWorld;
@@ -323,10 +308,9 @@ bool UBioAutoConditionals::F1806 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1805 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1805 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1805Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1805", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1805 )
-		pFnF1805 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1805" );
+	UFunction* const pFnF1805 = pFnF1805Ref.Get ( );
 
 	UBioAutoConditionals_execF1805_Parms F1805_Parms;
 	F1805_Parms.bioWorld = bioWorld;
@@ -346,10 +330,9 @@ bool UBioAutoConditionals::F1805 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1804 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1804 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1804Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1804", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1804 )
-		pFnF1804 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1804" );
+	UFunction* const pFnF1804 = pFnF1804Ref.Get ( );
 
 	UBioAutoConditionals_execF1804_Parms F1804_Parms;
 	F1804_Parms.bioWorld = bioWorld;
@@ -369,10 +352,9 @@ bool UBioAutoConditionals::F1804 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1803 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1803 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1803Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1803", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1803 )
-		pFnF1803 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1803" );
+	UFunction* const pFnF1803 = pFnF1803Ref.Get ( );
 
 	UBioAutoConditionals_execF1803_Parms F1803_Parms;
 	F1803_Parms.bioWorld = bioWorld;
@@ -392,10 +374,9 @@ bool UBioAutoConditionals::F1803 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1802 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1802 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1802Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1802", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1802 )
-		pFnF1802 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1802" );
+	UFunction* const pFnF1802 = pFnF1802Ref.Get ( );
 
 	UBioAutoConditionals_execF1802_Parms F1802_Parms;
 	F1802_Parms.bioWorld = bioWorld;
@@ -415,10 +396,9 @@ bool UBioAutoConditionals::F1802 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1801 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1801 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1801Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1801", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1801 )
-		pFnF1801 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1801" );
+	UFunction* const pFnF1801 = pFnF1801Ref.Get ( );
 
 	UBioAutoConditionals_execF1801_Parms F1801_Parms;
 	F1801_Parms.bioWorld = bioWorld;
@@ -438,10 +418,9 @@ bool UBioAutoConditionals::F1801 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1799 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1799 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1799Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1799", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1799 )
-		pFnF1799 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1799" );
+	UFunction* const pFnF1799 = pFnF1799Ref.Get ( );
 
 	UBioAutoConditionals_execF1799_Parms F1799_Parms;
 	F1799_Parms.bioWorld = bioWorld;
@@ -461,10 +440,9 @@ bool UBioAutoConditionals::F1799 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2017 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2017 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2017Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F2017", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2017 )
-		pFnF2017 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F2017" );
+	UFunction* const pFnF2017 = pFnF2017Ref.Get ( );
 
 	UBioAutoConditionals_execF2017_Parms F2017_Parms;
 	F2017_Parms.bioWorld = bioWorld;
@@ -484,10 +462,9 @@ bool UBioAutoConditionals::F2017 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2016 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2016 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2016Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F2016", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2016 )
-		pFnF2016 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F2016" );
+	UFunction* const pFnF2016 = pFnF2016Ref.Get ( );
 
 	UBioAutoConditionals_execF2016_Parms F2016_Parms;
 	F2016_Parms.bioWorld = bioWorld;
@@ -507,10 +484,9 @@ bool UBioAutoConditionals::F2016 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2015 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2015 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2015Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F2015", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2015 )
-		pFnF2015 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F2015" );
+	UFunction* const pFnF2015 = pFnF2015Ref.Get ( );
 
 	UBioAutoConditionals_execF2015_Parms F2015_Parms;
 	F2015_Parms.bioWorld = bioWorld;
@@ -530,10 +506,9 @@ bool UBioAutoConditionals::F2015 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1828 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1828 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1828Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1828", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1828 )
-		pFnF1828 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1828" );
+	UFunction* const pFnF1828 = pFnF1828Ref.Get ( );
 
 	UBioAutoConditionals_execF1828_Parms F1828_Parms;
 	F1828_Parms.bioWorld = bioWorld;
@@ -553,10 +528,9 @@ bool UBioAutoConditionals::F1828 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1827 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1827 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1827Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1827", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1827 )
-		pFnF1827 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1827" );
+	UFunction* const pFnF1827 = pFnF1827Ref.Get ( );
 
 	UBioAutoConditionals_execF1827_Parms F1827_Parms;
 	F1827_Parms.bioWorld = bioWorld;
@@ -576,10 +550,9 @@ bool UBioAutoConditionals::F1827 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1789 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1789 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1789Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1789", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1789 )
-		pFnF1789 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1789" );
+	UFunction* const pFnF1789 = pFnF1789Ref.Get ( );
 
 	UBioAutoConditionals_execF1789_Parms F1789_Parms;
 	F1789_Parms.bioWorld = bioWorld;
@@ -599,10 +572,9 @@ bool UBioAutoConditionals::F1789 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1790 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1790 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1790Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1790", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1790 )
-		pFnF1790 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1790" );
+	UFunction* const pFnF1790 = pFnF1790Ref.Get ( );
 
 	UBioAutoConditionals_execF1790_Parms F1790_Parms;
 	F1790_Parms.bioWorld = bioWorld;
@@ -622,10 +594,9 @@ bool UBioAutoConditionals::F1790 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1791 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1791 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1791Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1791", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1791 )
-		pFnF1791 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1791" );
+	UFunction* const pFnF1791 = pFnF1791Ref.Get ( );
 
 	UBioAutoConditionals_execF1791_Parms F1791_Parms;
 	F1791_Parms.bioWorld = bioWorld;
@@ -645,10 +616,9 @@ bool UBioAutoConditionals::F1791 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1797 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1797 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1797Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1797", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1797 )
-		pFnF1797 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1797" );
+	UFunction* const pFnF1797 = pFnF1797Ref.Get ( );
 
 	UBioAutoConditionals_execF1797_Parms F1797_Parms;
 	F1797_Parms.bioWorld = bioWorld;
@@ -668,10 +638,9 @@ bool UBioAutoConditionals::F1797 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1796 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1796 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1796Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1796", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1796 )
-		pFnF1796 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1796" );
+	UFunction* const pFnF1796 = pFnF1796Ref.Get ( );
 
 	UBioAutoConditionals_execF1796_Parms F1796_Parms;
 	F1796_Parms.bioWorld = bioWorld;
@@ -691,10 +660,9 @@ bool UBioAutoConditionals::F1796 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1795 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1795 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1795Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1795", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1795 )
-		pFnF1795 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1795" );
+	UFunction* const pFnF1795 = pFnF1795Ref.Get ( );
 
 	UBioAutoConditionals_execF1795_Parms F1795_Parms;
 	F1795_Parms.bioWorld = bioWorld;
@@ -714,10 +682,9 @@ bool UBioAutoConditionals::F1795 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1794 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1794 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1794Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1794", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1794 )
-		pFnF1794 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1794" );
+	UFunction* const pFnF1794 = pFnF1794Ref.Get ( );
 
 	UBioAutoConditionals_execF1794_Parms F1794_Parms;
 	F1794_Parms.bioWorld = bioWorld;
@@ -737,10 +704,9 @@ bool UBioAutoConditionals::F1794 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1793 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1793 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1793Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1793", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1793 )
-		pFnF1793 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1793" );
+	UFunction* const pFnF1793 = pFnF1793Ref.Get ( );
 
 	UBioAutoConditionals_execF1793_Parms F1793_Parms;
 	F1793_Parms.bioWorld = bioWorld;
@@ -760,10 +726,9 @@ bool UBioAutoConditionals::F1793 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1792 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1792 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1792Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1792", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1792 )
-		pFnF1792 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1792" );
+	UFunction* const pFnF1792 = pFnF1792Ref.Get ( );
 
 	UBioAutoConditionals_execF1792_Parms F1792_Parms;
 	F1792_Parms.bioWorld = bioWorld;
@@ -783,10 +748,9 @@ bool UBioAutoConditionals::F1792 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1809 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1809 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1809Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1809", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1809 )
-		pFnF1809 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1809" );
+	UFunction* const pFnF1809 = pFnF1809Ref.Get ( );
 
 	UBioAutoConditionals_execF1809_Parms F1809_Parms;
 	F1809_Parms.bioWorld = bioWorld;
@@ -806,10 +770,9 @@ bool UBioAutoConditionals::F1809 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1800 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1800 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1800Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1800", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1800 )
-		pFnF1800 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1800" );
+	UFunction* const pFnF1800 = pFnF1800Ref.Get ( );
 
 	UBioAutoConditionals_execF1800_Parms F1800_Parms;
 	F1800_Parms.bioWorld = bioWorld;
@@ -829,10 +792,9 @@ bool UBioAutoConditionals::F1800 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1812 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1812 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1812Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1812", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1812 )
-		pFnF1812 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1812" );
+	UFunction* const pFnF1812 = pFnF1812Ref.Get ( );
 
 	UBioAutoConditionals_execF1812_Parms F1812_Parms;
 	F1812_Parms.bioWorld = bioWorld;
@@ -852,10 +814,9 @@ bool UBioAutoConditionals::F1812 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1811 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1811 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1811Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1811", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1811 )
-		pFnF1811 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1811" );
+	UFunction* const pFnF1811 = pFnF1811Ref.Get ( );
 
 	UBioAutoConditionals_execF1811_Parms F1811_Parms;
 	F1811_Parms.bioWorld = bioWorld;
@@ -875,10 +836,9 @@ bool UBioAutoConditionals::F1811 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1810 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1810 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1810Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1810", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1810 )
-		pFnF1810 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1810" );
+	UFunction* const pFnF1810 = pFnF1810Ref.Get ( );
 
 	UBioAutoConditionals_execF1810_Parms F1810_Parms;
 	F1810_Parms.bioWorld = bioWorld;
@@ -898,10 +858,9 @@ bool UBioAutoConditionals::F1810 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1821 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1821 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1821Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1821", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1821 )
-		pFnF1821 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1821" );
+	UFunction* const pFnF1821 = pFnF1821Ref.Get ( );
 
 	UBioAutoConditionals_execF1821_Parms F1821_Parms;
 	F1821_Parms.bioWorld = bioWorld;
@@ -921,10 +880,9 @@ bool UBioAutoConditionals::F1821 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1820 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1820 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1820Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1820", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1820 )
-		pFnF1820 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1820" );
+	UFunction* const pFnF1820 = pFnF1820Ref.Get ( );
 
 	UBioAutoConditionals_execF1820_Parms F1820_Parms;
 	F1820_Parms.bioWorld = bioWorld;
@@ -944,10 +902,9 @@ bool UBioAutoConditionals::F1820 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1819 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1819 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1819Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1819", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1819 )
-		pFnF1819 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1819" );
+	UFunction* const pFnF1819 = pFnF1819Ref.Get ( );
 
 	UBioAutoConditionals_execF1819_Parms F1819_Parms;
 	F1819_Parms.bioWorld = bioWorld;
@@ -967,10 +924,9 @@ bool UBioAutoConditionals::F1819 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1818 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1818 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1818Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1818", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1818 )
-		pFnF1818 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1818" );
+	UFunction* const pFnF1818 = pFnF1818Ref.Get ( );
 
 	UBioAutoConditionals_execF1818_Parms F1818_Parms;
 	F1818_Parms.bioWorld = bioWorld;
@@ -990,10 +946,9 @@ bool UBioAutoConditionals::F1818 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1817 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1817 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1817Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1817", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1817 )
-		pFnF1817 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1817" );
+	UFunction* const pFnF1817 = pFnF1817Ref.Get ( );
 
 	UBioAutoConditionals_execF1817_Parms F1817_Parms;
 	F1817_Parms.bioWorld = bioWorld;
@@ -1013,10 +968,9 @@ bool UBioAutoConditionals::F1817 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1832 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1832 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1832Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1832", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1832 )
-		pFnF1832 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1832" );
+	UFunction* const pFnF1832 = pFnF1832Ref.Get ( );
 
 	UBioAutoConditionals_execF1832_Parms F1832_Parms;
 	F1832_Parms.bioWorld = bioWorld;
@@ -1036,10 +990,9 @@ bool UBioAutoConditionals::F1832 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1831 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1831 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1831Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1831", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1831 )
-		pFnF1831 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1831" );
+	UFunction* const pFnF1831 = pFnF1831Ref.Get ( );
 
 	UBioAutoConditionals_execF1831_Parms F1831_Parms;
 	F1831_Parms.bioWorld = bioWorld;
@@ -1059,10 +1012,9 @@ bool UBioAutoConditionals::F1831 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1825 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1825 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1825Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1825", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1825 )
-		pFnF1825 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1825" );
+	UFunction* const pFnF1825 = pFnF1825Ref.Get ( );
 
 	UBioAutoConditionals_execF1825_Parms F1825_Parms;
 	F1825_Parms.bioWorld = bioWorld;
@@ -1082,10 +1034,9 @@ bool UBioAutoConditionals::F1825 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1830 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1830 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1830Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1830", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1830 )
-		pFnF1830 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1830" );
+	UFunction* const pFnF1830 = pFnF1830Ref.Get ( );
 
 	UBioAutoConditionals_execF1830_Parms F1830_Parms;
 	F1830_Parms.bioWorld = bioWorld;
@@ -1105,10 +1056,9 @@ bool UBioAutoConditionals::F1830 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1829 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1829 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1829Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1829", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1829 )
-		pFnF1829 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1829" );
+	UFunction* const pFnF1829 = pFnF1829Ref.Get ( );
 
 	UBioAutoConditionals_execF1829_Parms F1829_Parms;
 	F1829_Parms.bioWorld = bioWorld;
@@ -1128,10 +1078,9 @@ bool UBioAutoConditionals::F1829 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1779 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1779 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1779Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1779", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1779 )
-		pFnF1779 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1779" );
+	UFunction* const pFnF1779 = pFnF1779Ref.Get ( );
 
 	UBioAutoConditionals_execF1779_Parms F1779_Parms;
 	F1779_Parms.bioWorld = bioWorld;
@@ -1151,10 +1100,9 @@ bool UBioAutoConditionals::F1779 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1778 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1778 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1778Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1778", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1778 )
-		pFnF1778 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1778" );
+	UFunction* const pFnF1778 = pFnF1778Ref.Get ( );
 
 	UBioAutoConditionals_execF1778_Parms F1778_Parms;
 	F1778_Parms.bioWorld = bioWorld;
@@ -1174,10 +1122,9 @@ bool UBioAutoConditionals::F1778 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1777 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1777 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1777Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1777", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1777 )
-		pFnF1777 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1777" );
+	UFunction* const pFnF1777 = pFnF1777Ref.Get ( );
 
 	UBioAutoConditionals_execF1777_Parms F1777_Parms;
 	F1777_Parms.bioWorld = bioWorld;
@@ -1197,10 +1144,9 @@ bool UBioAutoConditionals::F1777 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1780 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1780 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1780Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1780", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1780 )
-		pFnF1780 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1780" );
+	UFunction* const pFnF1780 = pFnF1780Ref.Get ( );
 
 	UBioAutoConditionals_execF1780_Parms F1780_Parms;
 	F1780_Parms.bioWorld = bioWorld;
@@ -1220,10 +1166,9 @@ bool UBioAutoConditionals::F1780 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1781 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1781 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1781Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1781", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1781 )
-		pFnF1781 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1781" );
+	UFunction* const pFnF1781 = pFnF1781Ref.Get ( );
 
 	UBioAutoConditionals_execF1781_Parms F1781_Parms;
 	F1781_Parms.bioWorld = bioWorld;
@@ -1243,10 +1188,9 @@ bool UBioAutoConditionals::F1781 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1776 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1776 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1776Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1776", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1776 )
-		pFnF1776 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1776" );
+	UFunction* const pFnF1776 = pFnF1776Ref.Get ( );
 
 	UBioAutoConditionals_execF1776_Parms F1776_Parms;
 	F1776_Parms.bioWorld = bioWorld;
@@ -1266,10 +1210,9 @@ bool UBioAutoConditionals::F1776 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1775 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1775 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1775Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1775", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1775 )
-		pFnF1775 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1775" );
+	UFunction* const pFnF1775 = pFnF1775Ref.Get ( );
 
 	UBioAutoConditionals_execF1775_Parms F1775_Parms;
 	F1775_Parms.bioWorld = bioWorld;
@@ -1289,10 +1232,9 @@ bool UBioAutoConditionals::F1775 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1774 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1774 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1774Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1774", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1774 )
-		pFnF1774 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1774" );
+	UFunction* const pFnF1774 = pFnF1774Ref.Get ( );
 
 	UBioAutoConditionals_execF1774_Parms F1774_Parms;
 	F1774_Parms.bioWorld = bioWorld;
@@ -1312,10 +1254,9 @@ bool UBioAutoConditionals::F1774 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1773 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1773 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1773Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1773", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1773 )
-		pFnF1773 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1773" );
+	UFunction* const pFnF1773 = pFnF1773Ref.Get ( );
 
 	UBioAutoConditionals_execF1773_Parms F1773_Parms;
 	F1773_Parms.bioWorld = bioWorld;
@@ -1335,10 +1276,9 @@ bool UBioAutoConditionals::F1773 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1772 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1772 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1772Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1772", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1772 )
-		pFnF1772 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1772" );
+	UFunction* const pFnF1772 = pFnF1772Ref.Get ( );
 
 	UBioAutoConditionals_execF1772_Parms F1772_Parms;
 	F1772_Parms.bioWorld = bioWorld;
@@ -1358,10 +1298,9 @@ bool UBioAutoConditionals::F1772 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1771 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1771 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1771Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1771", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1771 )
-		pFnF1771 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1771" );
+	UFunction* const pFnF1771 = pFnF1771Ref.Get ( );
 
 	UBioAutoConditionals_execF1771_Parms F1771_Parms;
 	F1771_Parms.bioWorld = bioWorld;
@@ -1381,10 +1320,9 @@ bool UBioAutoConditionals::F1771 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1770 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1770 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1770Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1770", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1770 )
-		pFnF1770 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1770" );
+	UFunction* const pFnF1770 = pFnF1770Ref.Get ( );
 
 	UBioAutoConditionals_execF1770_Parms F1770_Parms;
 	F1770_Parms.bioWorld = bioWorld;
@@ -1404,10 +1342,9 @@ bool UBioAutoConditionals::F1770 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1769 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1769 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1769Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1769", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1769 )
-		pFnF1769 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1769" );
+	UFunction* const pFnF1769 = pFnF1769Ref.Get ( );
 
 	UBioAutoConditionals_execF1769_Parms F1769_Parms;
 	F1769_Parms.bioWorld = bioWorld;
@@ -1427,10 +1364,9 @@ bool UBioAutoConditionals::F1769 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1768 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1768 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1768Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1768", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1768 )
-		pFnF1768 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1768" );
+	UFunction* const pFnF1768 = pFnF1768Ref.Get ( );
 
 	UBioAutoConditionals_execF1768_Parms F1768_Parms;
 	F1768_Parms.bioWorld = bioWorld;
@@ -1450,10 +1386,9 @@ bool UBioAutoConditionals::F1768 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1767 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1767 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1767Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1767", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1767 )
-		pFnF1767 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1767" );
+	UFunction* const pFnF1767 = pFnF1767Ref.Get ( );
 
 	UBioAutoConditionals_execF1767_Parms F1767_Parms;
 	F1767_Parms.bioWorld = bioWorld;
@@ -1473,10 +1408,9 @@ bool UBioAutoConditionals::F1767 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1766 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1766 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1766Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1766", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1766 )
-		pFnF1766 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1766" );
+	UFunction* const pFnF1766 = pFnF1766Ref.Get ( );
 
 	UBioAutoConditionals_execF1766_Parms F1766_Parms;
 	F1766_Parms.bioWorld = bioWorld;
@@ -1496,10 +1430,9 @@ bool UBioAutoConditionals::F1766 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1765 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1765 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1765Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1765", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1765 )
-		pFnF1765 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1765" );
+	UFunction* const pFnF1765 = pFnF1765Ref.Get ( );
 
 	UBioAutoConditionals_execF1765_Parms F1765_Parms;
 	F1765_Parms.bioWorld = bioWorld;
@@ -1519,10 +1452,9 @@ bool UBioAutoConditionals::F1765 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1764 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1764 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1764Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1764", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1764 )
-		pFnF1764 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1764" );
+	UFunction* const pFnF1764 = pFnF1764Ref.Get ( );
 
 	UBioAutoConditionals_execF1764_Parms F1764_Parms;
 	F1764_Parms.bioWorld = bioWorld;
@@ -1542,10 +1474,9 @@ bool UBioAutoConditionals::F1764 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1763 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1763 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1763Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1763", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1763 )
-		pFnF1763 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1763" );
+	UFunction* const pFnF1763 = pFnF1763Ref.Get ( );
 
 	UBioAutoConditionals_execF1763_Parms F1763_Parms;
 	F1763_Parms.bioWorld = bioWorld;
@@ -1565,10 +1496,9 @@ bool UBioAutoConditionals::F1763 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1762 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1762 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1762Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1762", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1762 )
-		pFnF1762 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1762" );
+	UFunction* const pFnF1762 = pFnF1762Ref.Get ( );
 
 	UBioAutoConditionals_execF1762_Parms F1762_Parms;
 	F1762_Parms.bioWorld = bioWorld;
@@ -1588,10 +1518,9 @@ bool UBioAutoConditionals::F1762 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1761 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1761 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1761Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1761", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1761 )
-		pFnF1761 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1761" );
+	UFunction* const pFnF1761 = pFnF1761Ref.Get ( );
 
 	UBioAutoConditionals_execF1761_Parms F1761_Parms;
 	F1761_Parms.bioWorld = bioWorld;
@@ -1611,10 +1540,9 @@ bool UBioAutoConditionals::F1761 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1758 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1758 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1758Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1758", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1758 )
-		pFnF1758 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1758" );
+	UFunction* const pFnF1758 = pFnF1758Ref.Get ( );
 
 	UBioAutoConditionals_execF1758_Parms F1758_Parms;
 	F1758_Parms.bioWorld = bioWorld;
@@ -1634,10 +1562,9 @@ bool UBioAutoConditionals::F1758 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1755 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1755 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1755Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1755", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1755 )
-		pFnF1755 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1755" );
+	UFunction* const pFnF1755 = pFnF1755Ref.Get ( );
 
 	UBioAutoConditionals_execF1755_Parms F1755_Parms;
 	F1755_Parms.bioWorld = bioWorld;
@@ -1657,10 +1584,9 @@ bool UBioAutoConditionals::F1755 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1754 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1754 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1754Ref { L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1754", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1754 )
-		pFnF1754 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1754" );
+	UFunction* const pFnF1754 = pFnF1754Ref.Get ( );
 
 	UBioAutoConditionals_execF1754_Parms F1754_Parms;
 	F1754_Parms.bioWorld = bioWorld;
@@ -1673,6 +1599,92 @@ bool UBioAutoConditionals::F1754 ( class ABioWorldInfo* bioWorld, int Argument )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class PlotManagerDLC_UNC.BioAutoConditionals",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1798",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1826",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1824",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1823",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1822",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1816",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1815",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1814",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1813",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1808",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1807",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1806",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1805",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1804",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1803",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1802",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1801",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1799",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F2017",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F2016",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F2015",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1828",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1827",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1789",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1790",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1791",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1797",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1796",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1795",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1794",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1793",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1792",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1809",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1800",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1812",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1811",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1810",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1821",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1820",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1819",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1818",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1817",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1832",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1831",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1825",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1830",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1829",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1779",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1778",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1777",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1780",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1781",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1776",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1775",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1774",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1773",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1772",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1771",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1770",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1769",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1768",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1767",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1766",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1765",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1764",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1763",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1762",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1761",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1758",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1755",
+	L"Function PlotManagerDLC_UNC.BioAutoConditionals.F1754",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -68,7 +68,7 @@ class UBioPlotEnums : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioAutoConditionals::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioAutoConditionals::pClassPointer { L"Class PlotManager.BioAutoConditionals", &UObject::FindClass };
 
 class UClass* UBioAutoConditionals::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class PlotManager.BioAutoConditionals" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function PlotManager.BioAutoConditionals.F1749
@@ -47,10 +44,9 @@ class UClass* UBioAutoConditionals::StaticClass()
 
 bool UBioAutoConditionals::F1749 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1749 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1749Ref { L"Function PlotManager.BioAutoConditionals.F1749", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1749 )
-		pFnF1749 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1749" );
+	UFunction* const pFnF1749 = pFnF1749Ref.Get ( );
 
 	UBioAutoConditionals_execF1749_Parms F1749_Parms;
 	F1749_Parms.bioWorld = bioWorld;
@@ -70,10 +66,9 @@ bool UBioAutoConditionals::F1749 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1748 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1748 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1748Ref { L"Function PlotManager.BioAutoConditionals.F1748", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1748 )
-		pFnF1748 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1748" );
+	UFunction* const pFnF1748 = pFnF1748Ref.Get ( );
 
 	UBioAutoConditionals_execF1748_Parms F1748_Parms;
 	F1748_Parms.bioWorld = bioWorld;
@@ -93,10 +88,9 @@ bool UBioAutoConditionals::F1748 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1747 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1747 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1747Ref { L"Function PlotManager.BioAutoConditionals.F1747", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1747 )
-		pFnF1747 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1747" );
+	UFunction* const pFnF1747 = pFnF1747Ref.Get ( );
 
 	UBioAutoConditionals_execF1747_Parms F1747_Parms;
 	F1747_Parms.bioWorld = bioWorld;
@@ -116,10 +110,9 @@ bool UBioAutoConditionals::F1747 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1746 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1746 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1746Ref { L"Function PlotManager.BioAutoConditionals.F1746", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1746 )
-		pFnF1746 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1746" );
+	UFunction* const pFnF1746 = pFnF1746Ref.Get ( );
 
 	UBioAutoConditionals_execF1746_Parms F1746_Parms;
 	F1746_Parms.bioWorld = bioWorld;
@@ -139,10 +132,9 @@ bool UBioAutoConditionals::F1746 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1272 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1272 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1272Ref { L"Function PlotManager.BioAutoConditionals.F1272", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1272 )
-		pFnF1272 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1272" );
+	UFunction* const pFnF1272 = pFnF1272Ref.Get ( );
 
 	UBioAutoConditionals_execF1272_Parms F1272_Parms;
 	F1272_Parms.bioWorld = bioWorld;
@@ -162,10 +154,9 @@ bool UBioAutoConditionals::F1272 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1271 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1271 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1271Ref { L"Function PlotManager.BioAutoConditionals.F1271", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1271 )
-		pFnF1271 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1271" );
+	UFunction* const pFnF1271 = pFnF1271Ref.Get ( );
 
 	UBioAutoConditionals_execF1271_Parms F1271_Parms;
 	F1271_Parms.bioWorld = bioWorld;
@@ -185,10 +176,9 @@ bool UBioAutoConditionals::F1271 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1270 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1270 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1270Ref { L"Function PlotManager.BioAutoConditionals.F1270", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1270 )
-		pFnF1270 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1270" );
+	UFunction* const pFnF1270 = pFnF1270Ref.Get ( );
 
 	UBioAutoConditionals_execF1270_Parms F1270_Parms;
 	F1270_Parms.bioWorld = bioWorld;
@@ -208,10 +198,9 @@ bool UBioAutoConditionals::F1270 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1225 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1225 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1225Ref { L"Function PlotManager.BioAutoConditionals.F1225", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1225 )
-		pFnF1225 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1225" );
+	UFunction* const pFnF1225 = pFnF1225Ref.Get ( );
 
 	UBioAutoConditionals_execF1225_Parms F1225_Parms;
 	F1225_Parms.bioWorld = bioWorld;
@@ -231,10 +220,9 @@ bool UBioAutoConditionals::F1225 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1204 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1204 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1204Ref { L"Function PlotManager.BioAutoConditionals.F1204", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1204 )
-		pFnF1204 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1204" );
+	UFunction* const pFnF1204 = pFnF1204Ref.Get ( );
 
 	UBioAutoConditionals_execF1204_Parms F1204_Parms;
 	F1204_Parms.bioWorld = bioWorld;
@@ -254,10 +242,9 @@ bool UBioAutoConditionals::F1204 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1203 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1203 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1203Ref { L"Function PlotManager.BioAutoConditionals.F1203", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1203 )
-		pFnF1203 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1203" );
+	UFunction* const pFnF1203 = pFnF1203Ref.Get ( );
 
 	UBioAutoConditionals_execF1203_Parms F1203_Parms;
 	F1203_Parms.bioWorld = bioWorld;
@@ -277,10 +264,9 @@ bool UBioAutoConditionals::F1203 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1217 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1217 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1217Ref { L"Function PlotManager.BioAutoConditionals.F1217", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1217 )
-		pFnF1217 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1217" );
+	UFunction* const pFnF1217 = pFnF1217Ref.Get ( );
 
 	UBioAutoConditionals_execF1217_Parms F1217_Parms;
 	F1217_Parms.bioWorld = bioWorld;
@@ -300,10 +286,9 @@ bool UBioAutoConditionals::F1217 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1216 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1216 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1216Ref { L"Function PlotManager.BioAutoConditionals.F1216", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1216 )
-		pFnF1216 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1216" );
+	UFunction* const pFnF1216 = pFnF1216Ref.Get ( );
 
 	UBioAutoConditionals_execF1216_Parms F1216_Parms;
 	F1216_Parms.bioWorld = bioWorld;
@@ -323,10 +308,9 @@ bool UBioAutoConditionals::F1216 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1215 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1215 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1215Ref { L"Function PlotManager.BioAutoConditionals.F1215", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1215 )
-		pFnF1215 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1215" );
+	UFunction* const pFnF1215 = pFnF1215Ref.Get ( );
 
 	UBioAutoConditionals_execF1215_Parms F1215_Parms;
 	F1215_Parms.bioWorld = bioWorld;
@@ -346,10 +330,9 @@ bool UBioAutoConditionals::F1215 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1214 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1214 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1214Ref { L"Function PlotManager.BioAutoConditionals.F1214", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1214 )
-		pFnF1214 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1214" );
+	UFunction* const pFnF1214 = pFnF1214Ref.Get ( );
 
 	UBioAutoConditionals_execF1214_Parms F1214_Parms;
 	F1214_Parms.bioWorld = bioWorld;
@@ -369,10 +352,9 @@ bool UBioAutoConditionals::F1214 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1198 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1198 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1198Ref { L"Function PlotManager.BioAutoConditionals.F1198", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1198 )
-		pFnF1198 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1198" );
+	UFunction* const pFnF1198 = pFnF1198Ref.Get ( );
 
 	UBioAutoConditionals_execF1198_Parms F1198_Parms;
 	F1198_Parms.bioWorld = bioWorld;
@@ -392,10 +374,9 @@ bool UBioAutoConditionals::F1198 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1197 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1197 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1197Ref { L"Function PlotManager.BioAutoConditionals.F1197", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1197 )
-		pFnF1197 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1197" );
+	UFunction* const pFnF1197 = pFnF1197Ref.Get ( );
 
 	UBioAutoConditionals_execF1197_Parms F1197_Parms;
 	F1197_Parms.bioWorld = bioWorld;
@@ -415,10 +396,9 @@ bool UBioAutoConditionals::F1197 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1223 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1223 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1223Ref { L"Function PlotManager.BioAutoConditionals.F1223", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1223 )
-		pFnF1223 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1223" );
+	UFunction* const pFnF1223 = pFnF1223Ref.Get ( );
 
 	UBioAutoConditionals_execF1223_Parms F1223_Parms;
 	F1223_Parms.bioWorld = bioWorld;
@@ -438,10 +418,9 @@ bool UBioAutoConditionals::F1223 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1222 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1222 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1222Ref { L"Function PlotManager.BioAutoConditionals.F1222", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1222 )
-		pFnF1222 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1222" );
+	UFunction* const pFnF1222 = pFnF1222Ref.Get ( );
 
 	UBioAutoConditionals_execF1222_Parms F1222_Parms;
 	F1222_Parms.bioWorld = bioWorld;
@@ -461,10 +440,9 @@ bool UBioAutoConditionals::F1222 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1221 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1221 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1221Ref { L"Function PlotManager.BioAutoConditionals.F1221", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1221 )
-		pFnF1221 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1221" );
+	UFunction* const pFnF1221 = pFnF1221Ref.Get ( );
 
 	UBioAutoConditionals_execF1221_Parms F1221_Parms;
 	F1221_Parms.bioWorld = bioWorld;
@@ -484,10 +462,9 @@ bool UBioAutoConditionals::F1221 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1220 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1220 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1220Ref { L"Function PlotManager.BioAutoConditionals.F1220", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1220 )
-		pFnF1220 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1220" );
+	UFunction* const pFnF1220 = pFnF1220Ref.Get ( );
 
 	UBioAutoConditionals_execF1220_Parms F1220_Parms;
 	F1220_Parms.bioWorld = bioWorld;
@@ -507,10 +484,9 @@ bool UBioAutoConditionals::F1220 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1196 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1196 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1196Ref { L"Function PlotManager.BioAutoConditionals.F1196", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1196 )
-		pFnF1196 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1196" );
+	UFunction* const pFnF1196 = pFnF1196Ref.Get ( );
 
 	UBioAutoConditionals_execF1196_Parms F1196_Parms;
 	F1196_Parms.bioWorld = bioWorld;
@@ -530,10 +506,9 @@ bool UBioAutoConditionals::F1196 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1194 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1194 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1194Ref { L"Function PlotManager.BioAutoConditionals.F1194", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1194 )
-		pFnF1194 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1194" );
+	UFunction* const pFnF1194 = pFnF1194Ref.Get ( );
 
 	UBioAutoConditionals_execF1194_Parms F1194_Parms;
 	F1194_Parms.bioWorld = bioWorld;
@@ -553,10 +528,9 @@ bool UBioAutoConditionals::F1194 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1193 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1193 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1193Ref { L"Function PlotManager.BioAutoConditionals.F1193", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1193 )
-		pFnF1193 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1193" );
+	UFunction* const pFnF1193 = pFnF1193Ref.Get ( );
 
 	UBioAutoConditionals_execF1193_Parms F1193_Parms;
 	F1193_Parms.bioWorld = bioWorld;
@@ -576,10 +550,9 @@ bool UBioAutoConditionals::F1193 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1192 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1192 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1192Ref { L"Function PlotManager.BioAutoConditionals.F1192", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1192 )
-		pFnF1192 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1192" );
+	UFunction* const pFnF1192 = pFnF1192Ref.Get ( );
 
 	UBioAutoConditionals_execF1192_Parms F1192_Parms;
 	F1192_Parms.bioWorld = bioWorld;
@@ -599,10 +572,9 @@ bool UBioAutoConditionals::F1192 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1191 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1191 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1191Ref { L"Function PlotManager.BioAutoConditionals.F1191", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1191 )
-		pFnF1191 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1191" );
+	UFunction* const pFnF1191 = pFnF1191Ref.Get ( );
 
 	UBioAutoConditionals_execF1191_Parms F1191_Parms;
 	F1191_Parms.bioWorld = bioWorld;
@@ -622,10 +594,9 @@ bool UBioAutoConditionals::F1191 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1190 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1190 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1190Ref { L"Function PlotManager.BioAutoConditionals.F1190", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1190 )
-		pFnF1190 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1190" );
+	UFunction* const pFnF1190 = pFnF1190Ref.Get ( );
 
 	UBioAutoConditionals_execF1190_Parms F1190_Parms;
 	F1190_Parms.bioWorld = bioWorld;
@@ -645,10 +616,9 @@ bool UBioAutoConditionals::F1190 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1219 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1219 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1219Ref { L"Function PlotManager.BioAutoConditionals.F1219", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1219 )
-		pFnF1219 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1219" );
+	UFunction* const pFnF1219 = pFnF1219Ref.Get ( );
 
 	UBioAutoConditionals_execF1219_Parms F1219_Parms;
 	F1219_Parms.bioWorld = bioWorld;
@@ -668,10 +638,9 @@ bool UBioAutoConditionals::F1219 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1202 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1202 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1202Ref { L"Function PlotManager.BioAutoConditionals.F1202", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1202 )
-		pFnF1202 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1202" );
+	UFunction* const pFnF1202 = pFnF1202Ref.Get ( );
 
 	UBioAutoConditionals_execF1202_Parms F1202_Parms;
 	F1202_Parms.bioWorld = bioWorld;
@@ -691,10 +660,9 @@ bool UBioAutoConditionals::F1202 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1201 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1201 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1201Ref { L"Function PlotManager.BioAutoConditionals.F1201", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1201 )
-		pFnF1201 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1201" );
+	UFunction* const pFnF1201 = pFnF1201Ref.Get ( );
 
 	UBioAutoConditionals_execF1201_Parms F1201_Parms;
 	F1201_Parms.bioWorld = bioWorld;
@@ -714,10 +682,9 @@ bool UBioAutoConditionals::F1201 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1218 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1218 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1218Ref { L"Function PlotManager.BioAutoConditionals.F1218", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1218 )
-		pFnF1218 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1218" );
+	UFunction* const pFnF1218 = pFnF1218Ref.Get ( );
 
 	UBioAutoConditionals_execF1218_Parms F1218_Parms;
 	F1218_Parms.bioWorld = bioWorld;
@@ -737,10 +704,9 @@ bool UBioAutoConditionals::F1218 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1200 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1200 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1200Ref { L"Function PlotManager.BioAutoConditionals.F1200", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1200 )
-		pFnF1200 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1200" );
+	UFunction* const pFnF1200 = pFnF1200Ref.Get ( );
 
 	UBioAutoConditionals_execF1200_Parms F1200_Parms;
 	F1200_Parms.bioWorld = bioWorld;
@@ -760,10 +726,9 @@ bool UBioAutoConditionals::F1200 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1199 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1199 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1199Ref { L"Function PlotManager.BioAutoConditionals.F1199", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1199 )
-		pFnF1199 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1199" );
+	UFunction* const pFnF1199 = pFnF1199Ref.Get ( );
 
 	UBioAutoConditionals_execF1199_Parms F1199_Parms;
 	F1199_Parms.bioWorld = bioWorld;
@@ -783,10 +748,9 @@ bool UBioAutoConditionals::F1199 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1111 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1111 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1111Ref { L"Function PlotManager.BioAutoConditionals.F1111", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1111 )
-		pFnF1111 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1111" );
+	UFunction* const pFnF1111 = pFnF1111Ref.Get ( );
 
 	UBioAutoConditionals_execF1111_Parms F1111_Parms;
 	F1111_Parms.bioWorld = bioWorld;
@@ -806,10 +770,9 @@ bool UBioAutoConditionals::F1111 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1669 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1669 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1669Ref { L"Function PlotManager.BioAutoConditionals.F1669", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1669 )
-		pFnF1669 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1669" );
+	UFunction* const pFnF1669 = pFnF1669Ref.Get ( );
 
 	UBioAutoConditionals_execF1669_Parms F1669_Parms;
 	F1669_Parms.bioWorld = bioWorld;
@@ -829,10 +792,9 @@ bool UBioAutoConditionals::F1669 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1110 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1110 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1110Ref { L"Function PlotManager.BioAutoConditionals.F1110", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1110 )
-		pFnF1110 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1110" );
+	UFunction* const pFnF1110 = pFnF1110Ref.Get ( );
 
 	UBioAutoConditionals_execF1110_Parms F1110_Parms;
 	F1110_Parms.bioWorld = bioWorld;
@@ -852,10 +814,9 @@ bool UBioAutoConditionals::F1110 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1109 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1109 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1109Ref { L"Function PlotManager.BioAutoConditionals.F1109", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1109 )
-		pFnF1109 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1109" );
+	UFunction* const pFnF1109 = pFnF1109Ref.Get ( );
 
 	UBioAutoConditionals_execF1109_Parms F1109_Parms;
 	F1109_Parms.bioWorld = bioWorld;
@@ -875,10 +836,9 @@ bool UBioAutoConditionals::F1109 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F873 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF873 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF873Ref { L"Function PlotManager.BioAutoConditionals.F873", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF873 )
-		pFnF873 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F873" );
+	UFunction* const pFnF873 = pFnF873Ref.Get ( );
 
 	UBioAutoConditionals_execF873_Parms F873_Parms;
 	F873_Parms.bioWorld = bioWorld;
@@ -898,10 +858,9 @@ bool UBioAutoConditionals::F873 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F872 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF872 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF872Ref { L"Function PlotManager.BioAutoConditionals.F872", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF872 )
-		pFnF872 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F872" );
+	UFunction* const pFnF872 = pFnF872Ref.Get ( );
 
 	UBioAutoConditionals_execF872_Parms F872_Parms;
 	F872_Parms.bioWorld = bioWorld;
@@ -921,10 +880,9 @@ bool UBioAutoConditionals::F872 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F871 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF871 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF871Ref { L"Function PlotManager.BioAutoConditionals.F871", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF871 )
-		pFnF871 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F871" );
+	UFunction* const pFnF871 = pFnF871Ref.Get ( );
 
 	UBioAutoConditionals_execF871_Parms F871_Parms;
 	F871_Parms.bioWorld = bioWorld;
@@ -944,10 +902,9 @@ bool UBioAutoConditionals::F871 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F870 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF870 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF870Ref { L"Function PlotManager.BioAutoConditionals.F870", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF870 )
-		pFnF870 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F870" );
+	UFunction* const pFnF870 = pFnF870Ref.Get ( );
 
 	UBioAutoConditionals_execF870_Parms F870_Parms;
 	F870_Parms.bioWorld = bioWorld;
@@ -967,10 +924,9 @@ bool UBioAutoConditionals::F870 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F869 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF869 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF869Ref { L"Function PlotManager.BioAutoConditionals.F869", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF869 )
-		pFnF869 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F869" );
+	UFunction* const pFnF869 = pFnF869Ref.Get ( );
 
 	UBioAutoConditionals_execF869_Parms F869_Parms;
 	F869_Parms.bioWorld = bioWorld;
@@ -990,10 +946,9 @@ bool UBioAutoConditionals::F869 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2009 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2009 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2009Ref { L"Function PlotManager.BioAutoConditionals.F2009", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2009 )
-		pFnF2009 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2009" );
+	UFunction* const pFnF2009 = pFnF2009Ref.Get ( );
 
 	UBioAutoConditionals_execF2009_Parms F2009_Parms;
 	F2009_Parms.bioWorld = bioWorld;
@@ -1013,10 +968,9 @@ bool UBioAutoConditionals::F2009 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2008 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2008 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2008Ref { L"Function PlotManager.BioAutoConditionals.F2008", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2008 )
-		pFnF2008 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2008" );
+	UFunction* const pFnF2008 = pFnF2008Ref.Get ( );
 
 	UBioAutoConditionals_execF2008_Parms F2008_Parms;
 	F2008_Parms.bioWorld = bioWorld;
@@ -1036,10 +990,9 @@ bool UBioAutoConditionals::F2008 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2007 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2007 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2007Ref { L"Function PlotManager.BioAutoConditionals.F2007", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2007 )
-		pFnF2007 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2007" );
+	UFunction* const pFnF2007 = pFnF2007Ref.Get ( );
 
 	UBioAutoConditionals_execF2007_Parms F2007_Parms;
 	F2007_Parms.bioWorld = bioWorld;
@@ -1059,10 +1012,9 @@ bool UBioAutoConditionals::F2007 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2006 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2006 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2006Ref { L"Function PlotManager.BioAutoConditionals.F2006", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2006 )
-		pFnF2006 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2006" );
+	UFunction* const pFnF2006 = pFnF2006Ref.Get ( );
 
 	UBioAutoConditionals_execF2006_Parms F2006_Parms;
 	F2006_Parms.bioWorld = bioWorld;
@@ -1082,10 +1034,9 @@ bool UBioAutoConditionals::F2006 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2005 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2005 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2005Ref { L"Function PlotManager.BioAutoConditionals.F2005", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2005 )
-		pFnF2005 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2005" );
+	UFunction* const pFnF2005 = pFnF2005Ref.Get ( );
 
 	UBioAutoConditionals_execF2005_Parms F2005_Parms;
 	F2005_Parms.bioWorld = bioWorld;
@@ -1105,10 +1056,9 @@ bool UBioAutoConditionals::F2005 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1577 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1577 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1577Ref { L"Function PlotManager.BioAutoConditionals.F1577", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1577 )
-		pFnF1577 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1577" );
+	UFunction* const pFnF1577 = pFnF1577Ref.Get ( );
 
 	UBioAutoConditionals_execF1577_Parms F1577_Parms;
 	F1577_Parms.bioWorld = bioWorld;
@@ -1128,10 +1078,9 @@ bool UBioAutoConditionals::F1577 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1256 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1256 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1256Ref { L"Function PlotManager.BioAutoConditionals.F1256", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1256 )
-		pFnF1256 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1256" );
+	UFunction* const pFnF1256 = pFnF1256Ref.Get ( );
 
 	UBioAutoConditionals_execF1256_Parms F1256_Parms;
 	F1256_Parms.bioWorld = bioWorld;
@@ -1151,10 +1100,9 @@ bool UBioAutoConditionals::F1256 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1255 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1255 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1255Ref { L"Function PlotManager.BioAutoConditionals.F1255", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1255 )
-		pFnF1255 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1255" );
+	UFunction* const pFnF1255 = pFnF1255Ref.Get ( );
 
 	UBioAutoConditionals_execF1255_Parms F1255_Parms;
 	F1255_Parms.bioWorld = bioWorld;
@@ -1174,10 +1122,9 @@ bool UBioAutoConditionals::F1255 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1108 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1108 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1108Ref { L"Function PlotManager.BioAutoConditionals.F1108", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1108 )
-		pFnF1108 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1108" );
+	UFunction* const pFnF1108 = pFnF1108Ref.Get ( );
 
 	UBioAutoConditionals_execF1108_Parms F1108_Parms;
 	F1108_Parms.bioWorld = bioWorld;
@@ -1197,10 +1144,9 @@ bool UBioAutoConditionals::F1108 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1251 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1251 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1251Ref { L"Function PlotManager.BioAutoConditionals.F1251", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1251 )
-		pFnF1251 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1251" );
+	UFunction* const pFnF1251 = pFnF1251Ref.Get ( );
 
 	UBioAutoConditionals_execF1251_Parms F1251_Parms;
 	F1251_Parms.bioWorld = bioWorld;
@@ -1220,10 +1166,9 @@ bool UBioAutoConditionals::F1251 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1107 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1107 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1107Ref { L"Function PlotManager.BioAutoConditionals.F1107", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1107 )
-		pFnF1107 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1107" );
+	UFunction* const pFnF1107 = pFnF1107Ref.Get ( );
 
 	UBioAutoConditionals_execF1107_Parms F1107_Parms;
 	F1107_Parms.bioWorld = bioWorld;
@@ -1243,10 +1188,9 @@ bool UBioAutoConditionals::F1107 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1249 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1249 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1249Ref { L"Function PlotManager.BioAutoConditionals.F1249", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1249 )
-		pFnF1249 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1249" );
+	UFunction* const pFnF1249 = pFnF1249Ref.Get ( );
 
 	UBioAutoConditionals_execF1249_Parms F1249_Parms;
 	F1249_Parms.bioWorld = bioWorld;
@@ -1266,10 +1210,9 @@ bool UBioAutoConditionals::F1249 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1248 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1248 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1248Ref { L"Function PlotManager.BioAutoConditionals.F1248", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1248 )
-		pFnF1248 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1248" );
+	UFunction* const pFnF1248 = pFnF1248Ref.Get ( );
 
 	UBioAutoConditionals_execF1248_Parms F1248_Parms;
 	F1248_Parms.bioWorld = bioWorld;
@@ -1289,10 +1232,9 @@ bool UBioAutoConditionals::F1248 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1106 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1106 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1106Ref { L"Function PlotManager.BioAutoConditionals.F1106", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1106 )
-		pFnF1106 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1106" );
+	UFunction* const pFnF1106 = pFnF1106Ref.Get ( );
 
 	UBioAutoConditionals_execF1106_Parms F1106_Parms;
 	F1106_Parms.bioWorld = bioWorld;
@@ -1312,10 +1254,9 @@ bool UBioAutoConditionals::F1106 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1633 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1633 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1633Ref { L"Function PlotManager.BioAutoConditionals.F1633", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1633 )
-		pFnF1633 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1633" );
+	UFunction* const pFnF1633 = pFnF1633Ref.Get ( );
 
 	UBioAutoConditionals_execF1633_Parms F1633_Parms;
 	F1633_Parms.bioWorld = bioWorld;
@@ -1335,10 +1276,9 @@ bool UBioAutoConditionals::F1633 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1105 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1105 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1105Ref { L"Function PlotManager.BioAutoConditionals.F1105", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1105 )
-		pFnF1105 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1105" );
+	UFunction* const pFnF1105 = pFnF1105Ref.Get ( );
 
 	UBioAutoConditionals_execF1105_Parms F1105_Parms;
 	F1105_Parms.bioWorld = bioWorld;
@@ -1358,10 +1298,9 @@ bool UBioAutoConditionals::F1105 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F997 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF997 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF997Ref { L"Function PlotManager.BioAutoConditionals.F997", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF997 )
-		pFnF997 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F997" );
+	UFunction* const pFnF997 = pFnF997Ref.Get ( );
 
 	UBioAutoConditionals_execF997_Parms F997_Parms;
 	F997_Parms.bioWorld = bioWorld;
@@ -1381,10 +1320,9 @@ bool UBioAutoConditionals::F997 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F996 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF996 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF996Ref { L"Function PlotManager.BioAutoConditionals.F996", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF996 )
-		pFnF996 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F996" );
+	UFunction* const pFnF996 = pFnF996Ref.Get ( );
 
 	UBioAutoConditionals_execF996_Parms F996_Parms;
 	F996_Parms.bioWorld = bioWorld;
@@ -1404,10 +1342,9 @@ bool UBioAutoConditionals::F996 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F992 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF992 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF992Ref { L"Function PlotManager.BioAutoConditionals.F992", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF992 )
-		pFnF992 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F992" );
+	UFunction* const pFnF992 = pFnF992Ref.Get ( );
 
 	UBioAutoConditionals_execF992_Parms F992_Parms;
 	F992_Parms.bioWorld = bioWorld;
@@ -1427,10 +1364,9 @@ bool UBioAutoConditionals::F992 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F991 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF991 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF991Ref { L"Function PlotManager.BioAutoConditionals.F991", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF991 )
-		pFnF991 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F991" );
+	UFunction* const pFnF991 = pFnF991Ref.Get ( );
 
 	UBioAutoConditionals_execF991_Parms F991_Parms;
 	F991_Parms.bioWorld = bioWorld;
@@ -1450,10 +1386,9 @@ bool UBioAutoConditionals::F991 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F986 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF986 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF986Ref { L"Function PlotManager.BioAutoConditionals.F986", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF986 )
-		pFnF986 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F986" );
+	UFunction* const pFnF986 = pFnF986Ref.Get ( );
 
 	UBioAutoConditionals_execF986_Parms F986_Parms;
 	F986_Parms.bioWorld = bioWorld;
@@ -1473,10 +1408,9 @@ bool UBioAutoConditionals::F986 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F985 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF985 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF985Ref { L"Function PlotManager.BioAutoConditionals.F985", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF985 )
-		pFnF985 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F985" );
+	UFunction* const pFnF985 = pFnF985Ref.Get ( );
 
 	UBioAutoConditionals_execF985_Parms F985_Parms;
 	F985_Parms.bioWorld = bioWorld;
@@ -1496,10 +1430,9 @@ bool UBioAutoConditionals::F985 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F984 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF984 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF984Ref { L"Function PlotManager.BioAutoConditionals.F984", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF984 )
-		pFnF984 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F984" );
+	UFunction* const pFnF984 = pFnF984Ref.Get ( );
 
 	UBioAutoConditionals_execF984_Parms F984_Parms;
 	F984_Parms.bioWorld = bioWorld;
@@ -1519,10 +1452,9 @@ bool UBioAutoConditionals::F984 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F982 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF982 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF982Ref { L"Function PlotManager.BioAutoConditionals.F982", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF982 )
-		pFnF982 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F982" );
+	UFunction* const pFnF982 = pFnF982Ref.Get ( );
 
 	UBioAutoConditionals_execF982_Parms F982_Parms;
 	F982_Parms.bioWorld = bioWorld;
@@ -1542,10 +1474,9 @@ bool UBioAutoConditionals::F982 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1634 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1634 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1634Ref { L"Function PlotManager.BioAutoConditionals.F1634", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1634 )
-		pFnF1634 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1634" );
+	UFunction* const pFnF1634 = pFnF1634Ref.Get ( );
 
 	UBioAutoConditionals_execF1634_Parms F1634_Parms;
 	F1634_Parms.bioWorld = bioWorld;
@@ -1565,10 +1496,9 @@ bool UBioAutoConditionals::F1634 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1104 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1104 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1104Ref { L"Function PlotManager.BioAutoConditionals.F1104", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1104 )
-		pFnF1104 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1104" );
+	UFunction* const pFnF1104 = pFnF1104Ref.Get ( );
 
 	UBioAutoConditionals_execF1104_Parms F1104_Parms;
 	F1104_Parms.bioWorld = bioWorld;
@@ -1588,10 +1518,9 @@ bool UBioAutoConditionals::F1104 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F864 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF864 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF864Ref { L"Function PlotManager.BioAutoConditionals.F864", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF864 )
-		pFnF864 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F864" );
+	UFunction* const pFnF864 = pFnF864Ref.Get ( );
 
 	UBioAutoConditionals_execF864_Parms F864_Parms;
 	F864_Parms.bioWorld = bioWorld;
@@ -1611,10 +1540,9 @@ bool UBioAutoConditionals::F864 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F863 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF863 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF863Ref { L"Function PlotManager.BioAutoConditionals.F863", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF863 )
-		pFnF863 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F863" );
+	UFunction* const pFnF863 = pFnF863Ref.Get ( );
 
 	UBioAutoConditionals_execF863_Parms F863_Parms;
 	F863_Parms.bioWorld = bioWorld;
@@ -1634,10 +1562,9 @@ bool UBioAutoConditionals::F863 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F862 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF862 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF862Ref { L"Function PlotManager.BioAutoConditionals.F862", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF862 )
-		pFnF862 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F862" );
+	UFunction* const pFnF862 = pFnF862Ref.Get ( );
 
 	UBioAutoConditionals_execF862_Parms F862_Parms;
 	F862_Parms.bioWorld = bioWorld;
@@ -1657,10 +1584,9 @@ bool UBioAutoConditionals::F862 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F977 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF977 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF977Ref { L"Function PlotManager.BioAutoConditionals.F977", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF977 )
-		pFnF977 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F977" );
+	UFunction* const pFnF977 = pFnF977Ref.Get ( );
 
 	UBioAutoConditionals_execF977_Parms F977_Parms;
 	F977_Parms.bioWorld = bioWorld;
@@ -1680,10 +1606,9 @@ bool UBioAutoConditionals::F977 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F976 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF976 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF976Ref { L"Function PlotManager.BioAutoConditionals.F976", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF976 )
-		pFnF976 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F976" );
+	UFunction* const pFnF976 = pFnF976Ref.Get ( );
 
 	UBioAutoConditionals_execF976_Parms F976_Parms;
 	F976_Parms.bioWorld = bioWorld;
@@ -1703,10 +1628,9 @@ bool UBioAutoConditionals::F976 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1557 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1557 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1557Ref { L"Function PlotManager.BioAutoConditionals.F1557", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1557 )
-		pFnF1557 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1557" );
+	UFunction* const pFnF1557 = pFnF1557Ref.Get ( );
 
 	UBioAutoConditionals_execF1557_Parms F1557_Parms;
 	F1557_Parms.bioWorld = bioWorld;
@@ -1726,10 +1650,9 @@ bool UBioAutoConditionals::F1557 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1064 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1064 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1064Ref { L"Function PlotManager.BioAutoConditionals.F1064", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1064 )
-		pFnF1064 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1064" );
+	UFunction* const pFnF1064 = pFnF1064Ref.Get ( );
 
 	UBioAutoConditionals_execF1064_Parms F1064_Parms;
 	F1064_Parms.bioWorld = bioWorld;
@@ -1749,10 +1672,9 @@ bool UBioAutoConditionals::F1064 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1653 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1653 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1653Ref { L"Function PlotManager.BioAutoConditionals.F1653", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1653 )
-		pFnF1653 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1653" );
+	UFunction* const pFnF1653 = pFnF1653Ref.Get ( );
 
 	UBioAutoConditionals_execF1653_Parms F1653_Parms;
 	F1653_Parms.bioWorld = bioWorld;
@@ -1772,10 +1694,9 @@ bool UBioAutoConditionals::F1653 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1413 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1413 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1413Ref { L"Function PlotManager.BioAutoConditionals.F1413", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1413 )
-		pFnF1413 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1413" );
+	UFunction* const pFnF1413 = pFnF1413Ref.Get ( );
 
 	UBioAutoConditionals_execF1413_Parms F1413_Parms;
 	F1413_Parms.bioWorld = bioWorld;
@@ -1795,10 +1716,9 @@ bool UBioAutoConditionals::F1413 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1295 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1295 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1295Ref { L"Function PlotManager.BioAutoConditionals.F1295", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1295 )
-		pFnF1295 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1295" );
+	UFunction* const pFnF1295 = pFnF1295Ref.Get ( );
 
 	UBioAutoConditionals_execF1295_Parms F1295_Parms;
 	F1295_Parms.bioWorld = bioWorld;
@@ -1818,10 +1738,9 @@ bool UBioAutoConditionals::F1295 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1294 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1294 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1294Ref { L"Function PlotManager.BioAutoConditionals.F1294", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1294 )
-		pFnF1294 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1294" );
+	UFunction* const pFnF1294 = pFnF1294Ref.Get ( );
 
 	UBioAutoConditionals_execF1294_Parms F1294_Parms;
 	F1294_Parms.bioWorld = bioWorld;
@@ -1841,10 +1760,9 @@ bool UBioAutoConditionals::F1294 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1293 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1293 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1293Ref { L"Function PlotManager.BioAutoConditionals.F1293", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1293 )
-		pFnF1293 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1293" );
+	UFunction* const pFnF1293 = pFnF1293Ref.Get ( );
 
 	UBioAutoConditionals_execF1293_Parms F1293_Parms;
 	F1293_Parms.bioWorld = bioWorld;
@@ -1864,10 +1782,9 @@ bool UBioAutoConditionals::F1293 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1292 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1292 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1292Ref { L"Function PlotManager.BioAutoConditionals.F1292", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1292 )
-		pFnF1292 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1292" );
+	UFunction* const pFnF1292 = pFnF1292Ref.Get ( );
 
 	UBioAutoConditionals_execF1292_Parms F1292_Parms;
 	F1292_Parms.bioWorld = bioWorld;
@@ -1887,10 +1804,9 @@ bool UBioAutoConditionals::F1292 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1288 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1288 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1288Ref { L"Function PlotManager.BioAutoConditionals.F1288", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1288 )
-		pFnF1288 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1288" );
+	UFunction* const pFnF1288 = pFnF1288Ref.Get ( );
 
 	UBioAutoConditionals_execF1288_Parms F1288_Parms;
 	F1288_Parms.bioWorld = bioWorld;
@@ -1910,10 +1826,9 @@ bool UBioAutoConditionals::F1288 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1287 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1287 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1287Ref { L"Function PlotManager.BioAutoConditionals.F1287", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1287 )
-		pFnF1287 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1287" );
+	UFunction* const pFnF1287 = pFnF1287Ref.Get ( );
 
 	UBioAutoConditionals_execF1287_Parms F1287_Parms;
 	F1287_Parms.bioWorld = bioWorld;
@@ -1933,10 +1848,9 @@ bool UBioAutoConditionals::F1287 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1286 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1286 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1286Ref { L"Function PlotManager.BioAutoConditionals.F1286", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1286 )
-		pFnF1286 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1286" );
+	UFunction* const pFnF1286 = pFnF1286Ref.Get ( );
 
 	UBioAutoConditionals_execF1286_Parms F1286_Parms;
 	F1286_Parms.bioWorld = bioWorld;
@@ -1956,10 +1870,9 @@ bool UBioAutoConditionals::F1286 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1285 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1285 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1285Ref { L"Function PlotManager.BioAutoConditionals.F1285", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1285 )
-		pFnF1285 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1285" );
+	UFunction* const pFnF1285 = pFnF1285Ref.Get ( );
 
 	UBioAutoConditionals_execF1285_Parms F1285_Parms;
 	F1285_Parms.bioWorld = bioWorld;
@@ -1979,10 +1892,9 @@ bool UBioAutoConditionals::F1285 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1284 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1284 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1284Ref { L"Function PlotManager.BioAutoConditionals.F1284", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1284 )
-		pFnF1284 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1284" );
+	UFunction* const pFnF1284 = pFnF1284Ref.Get ( );
 
 	UBioAutoConditionals_execF1284_Parms F1284_Parms;
 	F1284_Parms.bioWorld = bioWorld;
@@ -2002,10 +1914,9 @@ bool UBioAutoConditionals::F1284 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1243 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1243 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1243Ref { L"Function PlotManager.BioAutoConditionals.F1243", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1243 )
-		pFnF1243 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1243" );
+	UFunction* const pFnF1243 = pFnF1243Ref.Get ( );
 
 	UBioAutoConditionals_execF1243_Parms F1243_Parms;
 	F1243_Parms.bioWorld = bioWorld;
@@ -2025,10 +1936,9 @@ bool UBioAutoConditionals::F1243 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1242 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1242 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1242Ref { L"Function PlotManager.BioAutoConditionals.F1242", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1242 )
-		pFnF1242 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1242" );
+	UFunction* const pFnF1242 = pFnF1242Ref.Get ( );
 
 	UBioAutoConditionals_execF1242_Parms F1242_Parms;
 	F1242_Parms.bioWorld = bioWorld;
@@ -2048,10 +1958,9 @@ bool UBioAutoConditionals::F1242 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1137 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1137 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1137Ref { L"Function PlotManager.BioAutoConditionals.F1137", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1137 )
-		pFnF1137 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1137" );
+	UFunction* const pFnF1137 = pFnF1137Ref.Get ( );
 
 	UBioAutoConditionals_execF1137_Parms F1137_Parms;
 	F1137_Parms.bioWorld = bioWorld;
@@ -2071,10 +1980,9 @@ bool UBioAutoConditionals::F1137 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1102 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1102 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1102Ref { L"Function PlotManager.BioAutoConditionals.F1102", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1102 )
-		pFnF1102 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1102" );
+	UFunction* const pFnF1102 = pFnF1102Ref.Get ( );
 
 	UBioAutoConditionals_execF1102_Parms F1102_Parms;
 	F1102_Parms.bioWorld = bioWorld;
@@ -2094,10 +2002,9 @@ bool UBioAutoConditionals::F1102 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1099 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1099 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1099Ref { L"Function PlotManager.BioAutoConditionals.F1099", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1099 )
-		pFnF1099 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1099" );
+	UFunction* const pFnF1099 = pFnF1099Ref.Get ( );
 
 	UBioAutoConditionals_execF1099_Parms F1099_Parms;
 	F1099_Parms.bioWorld = bioWorld;
@@ -2117,10 +2024,9 @@ bool UBioAutoConditionals::F1099 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1098 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1098 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1098Ref { L"Function PlotManager.BioAutoConditionals.F1098", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1098 )
-		pFnF1098 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1098" );
+	UFunction* const pFnF1098 = pFnF1098Ref.Get ( );
 
 	UBioAutoConditionals_execF1098_Parms F1098_Parms;
 	F1098_Parms.bioWorld = bioWorld;
@@ -2140,10 +2046,9 @@ bool UBioAutoConditionals::F1098 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1635 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1635 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1635Ref { L"Function PlotManager.BioAutoConditionals.F1635", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1635 )
-		pFnF1635 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1635" );
+	UFunction* const pFnF1635 = pFnF1635Ref.Get ( );
 
 	UBioAutoConditionals_execF1635_Parms F1635_Parms;
 	F1635_Parms.bioWorld = bioWorld;
@@ -2163,10 +2068,9 @@ bool UBioAutoConditionals::F1635 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1566 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1566 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1566Ref { L"Function PlotManager.BioAutoConditionals.F1566", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1566 )
-		pFnF1566 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1566" );
+	UFunction* const pFnF1566 = pFnF1566Ref.Get ( );
 
 	UBioAutoConditionals_execF1566_Parms F1566_Parms;
 	F1566_Parms.bioWorld = bioWorld;
@@ -2186,10 +2090,9 @@ bool UBioAutoConditionals::F1566 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1650 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1650 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1650Ref { L"Function PlotManager.BioAutoConditionals.F1650", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1650 )
-		pFnF1650 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1650" );
+	UFunction* const pFnF1650 = pFnF1650Ref.Get ( );
 
 	UBioAutoConditionals_execF1650_Parms F1650_Parms;
 	F1650_Parms.bioWorld = bioWorld;
@@ -2209,10 +2112,9 @@ bool UBioAutoConditionals::F1650 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1528 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1528 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1528Ref { L"Function PlotManager.BioAutoConditionals.F1528", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1528 )
-		pFnF1528 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1528" );
+	UFunction* const pFnF1528 = pFnF1528Ref.Get ( );
 
 	UBioAutoConditionals_execF1528_Parms F1528_Parms;
 	F1528_Parms.bioWorld = bioWorld;
@@ -2232,10 +2134,9 @@ bool UBioAutoConditionals::F1528 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1240 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1240 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1240Ref { L"Function PlotManager.BioAutoConditionals.F1240", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1240 )
-		pFnF1240 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1240" );
+	UFunction* const pFnF1240 = pFnF1240Ref.Get ( );
 
 	UBioAutoConditionals_execF1240_Parms F1240_Parms;
 	F1240_Parms.bioWorld = bioWorld;
@@ -2255,10 +2156,9 @@ bool UBioAutoConditionals::F1240 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1044 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1044 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1044Ref { L"Function PlotManager.BioAutoConditionals.F1044", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1044 )
-		pFnF1044 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1044" );
+	UFunction* const pFnF1044 = pFnF1044Ref.Get ( );
 
 	UBioAutoConditionals_execF1044_Parms F1044_Parms;
 	F1044_Parms.bioWorld = bioWorld;
@@ -2278,10 +2178,9 @@ bool UBioAutoConditionals::F1044 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1014 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1014 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1014Ref { L"Function PlotManager.BioAutoConditionals.F1014", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1014 )
-		pFnF1014 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1014" );
+	UFunction* const pFnF1014 = pFnF1014Ref.Get ( );
 
 	UBioAutoConditionals_execF1014_Parms F1014_Parms;
 	F1014_Parms.bioWorld = bioWorld;
@@ -2301,10 +2200,9 @@ bool UBioAutoConditionals::F1014 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1717 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1717 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1717Ref { L"Function PlotManager.BioAutoConditionals.F1717", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1717 )
-		pFnF1717 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1717" );
+	UFunction* const pFnF1717 = pFnF1717Ref.Get ( );
 
 	UBioAutoConditionals_execF1717_Parms F1717_Parms;
 	F1717_Parms.bioWorld = bioWorld;
@@ -2324,10 +2222,9 @@ bool UBioAutoConditionals::F1717 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1553 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1553 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1553Ref { L"Function PlotManager.BioAutoConditionals.F1553", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1553 )
-		pFnF1553 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1553" );
+	UFunction* const pFnF1553 = pFnF1553Ref.Get ( );
 
 	UBioAutoConditionals_execF1553_Parms F1553_Parms;
 	F1553_Parms.bioWorld = bioWorld;
@@ -2347,10 +2244,9 @@ bool UBioAutoConditionals::F1553 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1239 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1239 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1239Ref { L"Function PlotManager.BioAutoConditionals.F1239", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1239 )
-		pFnF1239 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1239" );
+	UFunction* const pFnF1239 = pFnF1239Ref.Get ( );
 
 	UBioAutoConditionals_execF1239_Parms F1239_Parms;
 	F1239_Parms.bioWorld = bioWorld;
@@ -2370,10 +2266,9 @@ bool UBioAutoConditionals::F1239 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1238 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1238 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1238Ref { L"Function PlotManager.BioAutoConditionals.F1238", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1238 )
-		pFnF1238 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1238" );
+	UFunction* const pFnF1238 = pFnF1238Ref.Get ( );
 
 	UBioAutoConditionals_execF1238_Parms F1238_Parms;
 	F1238_Parms.bioWorld = bioWorld;
@@ -2393,10 +2288,9 @@ bool UBioAutoConditionals::F1238 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1237 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1237 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1237Ref { L"Function PlotManager.BioAutoConditionals.F1237", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1237 )
-		pFnF1237 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1237" );
+	UFunction* const pFnF1237 = pFnF1237Ref.Get ( );
 
 	UBioAutoConditionals_execF1237_Parms F1237_Parms;
 	F1237_Parms.bioWorld = bioWorld;
@@ -2416,10 +2310,9 @@ bool UBioAutoConditionals::F1237 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1096 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1096 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1096Ref { L"Function PlotManager.BioAutoConditionals.F1096", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1096 )
-		pFnF1096 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1096" );
+	UFunction* const pFnF1096 = pFnF1096Ref.Get ( );
 
 	UBioAutoConditionals_execF1096_Parms F1096_Parms;
 	F1096_Parms.bioWorld = bioWorld;
@@ -2439,10 +2332,9 @@ bool UBioAutoConditionals::F1096 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1182 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1182 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1182Ref { L"Function PlotManager.BioAutoConditionals.F1182", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1182 )
-		pFnF1182 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1182" );
+	UFunction* const pFnF1182 = pFnF1182Ref.Get ( );
 
 	UBioAutoConditionals_execF1182_Parms F1182_Parms;
 	F1182_Parms.bioWorld = bioWorld;
@@ -2462,10 +2354,9 @@ bool UBioAutoConditionals::F1182 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1181 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1181 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1181Ref { L"Function PlotManager.BioAutoConditionals.F1181", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1181 )
-		pFnF1181 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1181" );
+	UFunction* const pFnF1181 = pFnF1181Ref.Get ( );
 
 	UBioAutoConditionals_execF1181_Parms F1181_Parms;
 	F1181_Parms.bioWorld = bioWorld;
@@ -2485,10 +2376,9 @@ bool UBioAutoConditionals::F1181 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1180 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1180 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1180Ref { L"Function PlotManager.BioAutoConditionals.F1180", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1180 )
-		pFnF1180 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1180" );
+	UFunction* const pFnF1180 = pFnF1180Ref.Get ( );
 
 	UBioAutoConditionals_execF1180_Parms F1180_Parms;
 	F1180_Parms.bioWorld = bioWorld;
@@ -2508,10 +2398,9 @@ bool UBioAutoConditionals::F1180 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1179 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1179 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1179Ref { L"Function PlotManager.BioAutoConditionals.F1179", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1179 )
-		pFnF1179 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1179" );
+	UFunction* const pFnF1179 = pFnF1179Ref.Get ( );
 
 	UBioAutoConditionals_execF1179_Parms F1179_Parms;
 	F1179_Parms.bioWorld = bioWorld;
@@ -2531,10 +2420,9 @@ bool UBioAutoConditionals::F1179 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1178 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1178 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1178Ref { L"Function PlotManager.BioAutoConditionals.F1178", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1178 )
-		pFnF1178 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1178" );
+	UFunction* const pFnF1178 = pFnF1178Ref.Get ( );
 
 	UBioAutoConditionals_execF1178_Parms F1178_Parms;
 	F1178_Parms.bioWorld = bioWorld;
@@ -2554,10 +2442,9 @@ bool UBioAutoConditionals::F1178 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1177 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1177 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1177Ref { L"Function PlotManager.BioAutoConditionals.F1177", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1177 )
-		pFnF1177 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1177" );
+	UFunction* const pFnF1177 = pFnF1177Ref.Get ( );
 
 	UBioAutoConditionals_execF1177_Parms F1177_Parms;
 	F1177_Parms.bioWorld = bioWorld;
@@ -2577,10 +2464,9 @@ bool UBioAutoConditionals::F1177 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1176 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1176 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1176Ref { L"Function PlotManager.BioAutoConditionals.F1176", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1176 )
-		pFnF1176 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1176" );
+	UFunction* const pFnF1176 = pFnF1176Ref.Get ( );
 
 	UBioAutoConditionals_execF1176_Parms F1176_Parms;
 	F1176_Parms.bioWorld = bioWorld;
@@ -2600,10 +2486,9 @@ bool UBioAutoConditionals::F1176 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1175 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1175 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1175Ref { L"Function PlotManager.BioAutoConditionals.F1175", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1175 )
-		pFnF1175 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1175" );
+	UFunction* const pFnF1175 = pFnF1175Ref.Get ( );
 
 	UBioAutoConditionals_execF1175_Parms F1175_Parms;
 	F1175_Parms.bioWorld = bioWorld;
@@ -2623,10 +2508,9 @@ bool UBioAutoConditionals::F1175 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1174 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1174 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1174Ref { L"Function PlotManager.BioAutoConditionals.F1174", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1174 )
-		pFnF1174 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1174" );
+	UFunction* const pFnF1174 = pFnF1174Ref.Get ( );
 
 	UBioAutoConditionals_execF1174_Parms F1174_Parms;
 	F1174_Parms.bioWorld = bioWorld;
@@ -2646,10 +2530,9 @@ bool UBioAutoConditionals::F1174 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1094 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1094 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1094Ref { L"Function PlotManager.BioAutoConditionals.F1094", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1094 )
-		pFnF1094 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1094" );
+	UFunction* const pFnF1094 = pFnF1094Ref.Get ( );
 
 	UBioAutoConditionals_execF1094_Parms F1094_Parms;
 	F1094_Parms.bioWorld = bioWorld;
@@ -2669,10 +2552,9 @@ bool UBioAutoConditionals::F1094 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1093 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1093 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1093Ref { L"Function PlotManager.BioAutoConditionals.F1093", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1093 )
-		pFnF1093 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1093" );
+	UFunction* const pFnF1093 = pFnF1093Ref.Get ( );
 
 	UBioAutoConditionals_execF1093_Parms F1093_Parms;
 	F1093_Parms.bioWorld = bioWorld;
@@ -2692,10 +2574,9 @@ bool UBioAutoConditionals::F1093 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1519 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1519 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1519Ref { L"Function PlotManager.BioAutoConditionals.F1519", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1519 )
-		pFnF1519 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1519" );
+	UFunction* const pFnF1519 = pFnF1519Ref.Get ( );
 
 	UBioAutoConditionals_execF1519_Parms F1519_Parms;
 	F1519_Parms.bioWorld = bioWorld;
@@ -2715,10 +2596,9 @@ bool UBioAutoConditionals::F1519 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1518 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1518 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1518Ref { L"Function PlotManager.BioAutoConditionals.F1518", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1518 )
-		pFnF1518 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1518" );
+	UFunction* const pFnF1518 = pFnF1518Ref.Get ( );
 
 	UBioAutoConditionals_execF1518_Parms F1518_Parms;
 	F1518_Parms.bioWorld = bioWorld;
@@ -2738,10 +2618,9 @@ bool UBioAutoConditionals::F1518 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1231 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1231 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1231Ref { L"Function PlotManager.BioAutoConditionals.F1231", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1231 )
-		pFnF1231 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1231" );
+	UFunction* const pFnF1231 = pFnF1231Ref.Get ( );
 
 	UBioAutoConditionals_execF1231_Parms F1231_Parms;
 	F1231_Parms.bioWorld = bioWorld;
@@ -2761,10 +2640,9 @@ bool UBioAutoConditionals::F1231 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1092 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1092 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1092Ref { L"Function PlotManager.BioAutoConditionals.F1092", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1092 )
-		pFnF1092 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1092" );
+	UFunction* const pFnF1092 = pFnF1092Ref.Get ( );
 
 	UBioAutoConditionals_execF1092_Parms F1092_Parms;
 	F1092_Parms.bioWorld = bioWorld;
@@ -2784,10 +2662,9 @@ bool UBioAutoConditionals::F1092 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1040 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1040 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1040Ref { L"Function PlotManager.BioAutoConditionals.F1040", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1040 )
-		pFnF1040 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1040" );
+	UFunction* const pFnF1040 = pFnF1040Ref.Get ( );
 
 	UBioAutoConditionals_execF1040_Parms F1040_Parms;
 	F1040_Parms.bioWorld = bioWorld;
@@ -2807,10 +2684,9 @@ bool UBioAutoConditionals::F1040 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1039 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1039 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1039Ref { L"Function PlotManager.BioAutoConditionals.F1039", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1039 )
-		pFnF1039 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1039" );
+	UFunction* const pFnF1039 = pFnF1039Ref.Get ( );
 
 	UBioAutoConditionals_execF1039_Parms F1039_Parms;
 	F1039_Parms.bioWorld = bioWorld;
@@ -2830,10 +2706,9 @@ bool UBioAutoConditionals::F1039 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1038 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1038 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1038Ref { L"Function PlotManager.BioAutoConditionals.F1038", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1038 )
-		pFnF1038 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1038" );
+	UFunction* const pFnF1038 = pFnF1038Ref.Get ( );
 
 	UBioAutoConditionals_execF1038_Parms F1038_Parms;
 	F1038_Parms.bioWorld = bioWorld;
@@ -2853,10 +2728,9 @@ bool UBioAutoConditionals::F1038 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1034 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1034 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1034Ref { L"Function PlotManager.BioAutoConditionals.F1034", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1034 )
-		pFnF1034 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1034" );
+	UFunction* const pFnF1034 = pFnF1034Ref.Get ( );
 
 	UBioAutoConditionals_execF1034_Parms F1034_Parms;
 	F1034_Parms.bioWorld = bioWorld;
@@ -2876,10 +2750,9 @@ bool UBioAutoConditionals::F1034 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F968 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF968 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF968Ref { L"Function PlotManager.BioAutoConditionals.F968", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF968 )
-		pFnF968 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F968" );
+	UFunction* const pFnF968 = pFnF968Ref.Get ( );
 
 	UBioAutoConditionals_execF968_Parms F968_Parms;
 	F968_Parms.bioWorld = bioWorld;
@@ -2899,10 +2772,9 @@ bool UBioAutoConditionals::F968 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F967 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF967 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF967Ref { L"Function PlotManager.BioAutoConditionals.F967", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF967 )
-		pFnF967 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F967" );
+	UFunction* const pFnF967 = pFnF967Ref.Get ( );
 
 	UBioAutoConditionals_execF967_Parms F967_Parms;
 	F967_Parms.bioWorld = bioWorld;
@@ -2922,10 +2794,9 @@ bool UBioAutoConditionals::F967 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F966 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF966 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF966Ref { L"Function PlotManager.BioAutoConditionals.F966", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF966 )
-		pFnF966 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F966" );
+	UFunction* const pFnF966 = pFnF966Ref.Get ( );
 
 	UBioAutoConditionals_execF966_Parms F966_Parms;
 	F966_Parms.bioWorld = bioWorld;
@@ -2945,10 +2816,9 @@ bool UBioAutoConditionals::F966 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F893 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF893 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF893Ref { L"Function PlotManager.BioAutoConditionals.F893", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF893 )
-		pFnF893 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F893" );
+	UFunction* const pFnF893 = pFnF893Ref.Get ( );
 
 	UBioAutoConditionals_execF893_Parms F893_Parms;
 	F893_Parms.bioWorld = bioWorld;
@@ -2968,10 +2838,9 @@ bool UBioAutoConditionals::F893 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1504 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1504 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1504Ref { L"Function PlotManager.BioAutoConditionals.F1504", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1504 )
-		pFnF1504 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1504" );
+	UFunction* const pFnF1504 = pFnF1504Ref.Get ( );
 
 	UBioAutoConditionals_execF1504_Parms F1504_Parms;
 	F1504_Parms.bioWorld = bioWorld;
@@ -2991,10 +2860,9 @@ bool UBioAutoConditionals::F1504 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1517 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1517 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1517Ref { L"Function PlotManager.BioAutoConditionals.F1517", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1517 )
-		pFnF1517 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1517" );
+	UFunction* const pFnF1517 = pFnF1517Ref.Get ( );
 
 	UBioAutoConditionals_execF1517_Parms F1517_Parms;
 	F1517_Parms.bioWorld = bioWorld;
@@ -3014,10 +2882,9 @@ bool UBioAutoConditionals::F1517 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1514 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1514 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1514Ref { L"Function PlotManager.BioAutoConditionals.F1514", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1514 )
-		pFnF1514 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1514" );
+	UFunction* const pFnF1514 = pFnF1514Ref.Get ( );
 
 	UBioAutoConditionals_execF1514_Parms F1514_Parms;
 	F1514_Parms.bioWorld = bioWorld;
@@ -3037,10 +2904,9 @@ bool UBioAutoConditionals::F1514 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1513 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1513 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1513Ref { L"Function PlotManager.BioAutoConditionals.F1513", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1513 )
-		pFnF1513 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1513" );
+	UFunction* const pFnF1513 = pFnF1513Ref.Get ( );
 
 	UBioAutoConditionals_execF1513_Parms F1513_Parms;
 	F1513_Parms.bioWorld = bioWorld;
@@ -3060,10 +2926,9 @@ bool UBioAutoConditionals::F1513 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1512 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1512 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1512Ref { L"Function PlotManager.BioAutoConditionals.F1512", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1512 )
-		pFnF1512 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1512" );
+	UFunction* const pFnF1512 = pFnF1512Ref.Get ( );
 
 	UBioAutoConditionals_execF1512_Parms F1512_Parms;
 	F1512_Parms.bioWorld = bioWorld;
@@ -3083,10 +2948,9 @@ bool UBioAutoConditionals::F1512 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1516 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1516 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1516Ref { L"Function PlotManager.BioAutoConditionals.F1516", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1516 )
-		pFnF1516 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1516" );
+	UFunction* const pFnF1516 = pFnF1516Ref.Get ( );
 
 	UBioAutoConditionals_execF1516_Parms F1516_Parms;
 	F1516_Parms.bioWorld = bioWorld;
@@ -3106,10 +2970,9 @@ bool UBioAutoConditionals::F1516 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1515 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1515 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1515Ref { L"Function PlotManager.BioAutoConditionals.F1515", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1515 )
-		pFnF1515 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1515" );
+	UFunction* const pFnF1515 = pFnF1515Ref.Get ( );
 
 	UBioAutoConditionals_execF1515_Parms F1515_Parms;
 	F1515_Parms.bioWorld = bioWorld;
@@ -3129,10 +2992,9 @@ bool UBioAutoConditionals::F1515 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1506 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1506 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1506Ref { L"Function PlotManager.BioAutoConditionals.F1506", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1506 )
-		pFnF1506 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1506" );
+	UFunction* const pFnF1506 = pFnF1506Ref.Get ( );
 
 	UBioAutoConditionals_execF1506_Parms F1506_Parms;
 	F1506_Parms.bioWorld = bioWorld;
@@ -3152,10 +3014,9 @@ bool UBioAutoConditionals::F1506 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1505 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1505 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1505Ref { L"Function PlotManager.BioAutoConditionals.F1505", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1505 )
-		pFnF1505 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1505" );
+	UFunction* const pFnF1505 = pFnF1505Ref.Get ( );
 
 	UBioAutoConditionals_execF1505_Parms F1505_Parms;
 	F1505_Parms.bioWorld = bioWorld;
@@ -3175,10 +3036,9 @@ bool UBioAutoConditionals::F1505 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1507 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1507 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1507Ref { L"Function PlotManager.BioAutoConditionals.F1507", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1507 )
-		pFnF1507 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1507" );
+	UFunction* const pFnF1507 = pFnF1507Ref.Get ( );
 
 	UBioAutoConditionals_execF1507_Parms F1507_Parms;
 	F1507_Parms.bioWorld = bioWorld;
@@ -3198,10 +3058,9 @@ bool UBioAutoConditionals::F1507 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1511 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1511 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1511Ref { L"Function PlotManager.BioAutoConditionals.F1511", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1511 )
-		pFnF1511 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1511" );
+	UFunction* const pFnF1511 = pFnF1511Ref.Get ( );
 
 	UBioAutoConditionals_execF1511_Parms F1511_Parms;
 	F1511_Parms.bioWorld = bioWorld;
@@ -3221,10 +3080,9 @@ bool UBioAutoConditionals::F1511 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1510 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1510 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1510Ref { L"Function PlotManager.BioAutoConditionals.F1510", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1510 )
-		pFnF1510 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1510" );
+	UFunction* const pFnF1510 = pFnF1510Ref.Get ( );
 
 	UBioAutoConditionals_execF1510_Parms F1510_Parms;
 	F1510_Parms.bioWorld = bioWorld;
@@ -3244,10 +3102,9 @@ bool UBioAutoConditionals::F1510 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1509 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1509 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1509Ref { L"Function PlotManager.BioAutoConditionals.F1509", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1509 )
-		pFnF1509 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1509" );
+	UFunction* const pFnF1509 = pFnF1509Ref.Get ( );
 
 	UBioAutoConditionals_execF1509_Parms F1509_Parms;
 	F1509_Parms.bioWorld = bioWorld;
@@ -3267,10 +3124,9 @@ bool UBioAutoConditionals::F1509 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1508 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1508 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1508Ref { L"Function PlotManager.BioAutoConditionals.F1508", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1508 )
-		pFnF1508 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1508" );
+	UFunction* const pFnF1508 = pFnF1508Ref.Get ( );
 
 	UBioAutoConditionals_execF1508_Parms F1508_Parms;
 	F1508_Parms.bioWorld = bioWorld;
@@ -3290,10 +3146,9 @@ bool UBioAutoConditionals::F1508 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1529 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1529 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1529Ref { L"Function PlotManager.BioAutoConditionals.F1529", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1529 )
-		pFnF1529 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1529" );
+	UFunction* const pFnF1529 = pFnF1529Ref.Get ( );
 
 	UBioAutoConditionals_execF1529_Parms F1529_Parms;
 	F1529_Parms.bioWorld = bioWorld;
@@ -3313,10 +3168,9 @@ bool UBioAutoConditionals::F1529 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1558 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1558 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1558Ref { L"Function PlotManager.BioAutoConditionals.F1558", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1558 )
-		pFnF1558 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1558" );
+	UFunction* const pFnF1558 = pFnF1558Ref.Get ( );
 
 	UBioAutoConditionals_execF1558_Parms F1558_Parms;
 	F1558_Parms.bioWorld = bioWorld;
@@ -3336,10 +3190,9 @@ bool UBioAutoConditionals::F1558 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1439 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1439 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1439Ref { L"Function PlotManager.BioAutoConditionals.F1439", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1439 )
-		pFnF1439 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1439" );
+	UFunction* const pFnF1439 = pFnF1439Ref.Get ( );
 
 	UBioAutoConditionals_execF1439_Parms F1439_Parms;
 	F1439_Parms.bioWorld = bioWorld;
@@ -3359,10 +3212,9 @@ bool UBioAutoConditionals::F1439 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1438 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1438 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1438Ref { L"Function PlotManager.BioAutoConditionals.F1438", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1438 )
-		pFnF1438 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1438" );
+	UFunction* const pFnF1438 = pFnF1438Ref.Get ( );
 
 	UBioAutoConditionals_execF1438_Parms F1438_Parms;
 	F1438_Parms.bioWorld = bioWorld;
@@ -3382,10 +3234,9 @@ bool UBioAutoConditionals::F1438 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1440 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1440 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1440Ref { L"Function PlotManager.BioAutoConditionals.F1440", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1440 )
-		pFnF1440 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1440" );
+	UFunction* const pFnF1440 = pFnF1440Ref.Get ( );
 
 	UBioAutoConditionals_execF1440_Parms F1440_Parms;
 	F1440_Parms.bioWorld = bioWorld;
@@ -3405,10 +3256,9 @@ bool UBioAutoConditionals::F1440 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1441 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1441 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1441Ref { L"Function PlotManager.BioAutoConditionals.F1441", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1441 )
-		pFnF1441 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1441" );
+	UFunction* const pFnF1441 = pFnF1441Ref.Get ( );
 
 	UBioAutoConditionals_execF1441_Parms F1441_Parms;
 	F1441_Parms.bioWorld = bioWorld;
@@ -3428,10 +3278,9 @@ bool UBioAutoConditionals::F1441 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1437 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1437 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1437Ref { L"Function PlotManager.BioAutoConditionals.F1437", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1437 )
-		pFnF1437 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1437" );
+	UFunction* const pFnF1437 = pFnF1437Ref.Get ( );
 
 	UBioAutoConditionals_execF1437_Parms F1437_Parms;
 	F1437_Parms.bioWorld = bioWorld;
@@ -3451,10 +3300,9 @@ bool UBioAutoConditionals::F1437 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1436 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1436 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1436Ref { L"Function PlotManager.BioAutoConditionals.F1436", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1436 )
-		pFnF1436 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1436" );
+	UFunction* const pFnF1436 = pFnF1436Ref.Get ( );
 
 	UBioAutoConditionals_execF1436_Parms F1436_Parms;
 	F1436_Parms.bioWorld = bioWorld;
@@ -3474,10 +3322,9 @@ bool UBioAutoConditionals::F1436 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1434 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1434 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1434Ref { L"Function PlotManager.BioAutoConditionals.F1434", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1434 )
-		pFnF1434 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1434" );
+	UFunction* const pFnF1434 = pFnF1434Ref.Get ( );
 
 	UBioAutoConditionals_execF1434_Parms F1434_Parms;
 	F1434_Parms.bioWorld = bioWorld;
@@ -3497,10 +3344,9 @@ bool UBioAutoConditionals::F1434 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1435 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1435 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1435Ref { L"Function PlotManager.BioAutoConditionals.F1435", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1435 )
-		pFnF1435 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1435" );
+	UFunction* const pFnF1435 = pFnF1435Ref.Get ( );
 
 	UBioAutoConditionals_execF1435_Parms F1435_Parms;
 	F1435_Parms.bioWorld = bioWorld;
@@ -3520,10 +3366,9 @@ bool UBioAutoConditionals::F1435 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1443 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1443 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1443Ref { L"Function PlotManager.BioAutoConditionals.F1443", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1443 )
-		pFnF1443 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1443" );
+	UFunction* const pFnF1443 = pFnF1443Ref.Get ( );
 
 	UBioAutoConditionals_execF1443_Parms F1443_Parms;
 	F1443_Parms.bioWorld = bioWorld;
@@ -3543,10 +3388,9 @@ bool UBioAutoConditionals::F1443 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1442 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1442 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1442Ref { L"Function PlotManager.BioAutoConditionals.F1442", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1442 )
-		pFnF1442 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1442" );
+	UFunction* const pFnF1442 = pFnF1442Ref.Get ( );
 
 	UBioAutoConditionals_execF1442_Parms F1442_Parms;
 	F1442_Parms.bioWorld = bioWorld;
@@ -3566,10 +3410,9 @@ bool UBioAutoConditionals::F1442 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1444 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1444 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1444Ref { L"Function PlotManager.BioAutoConditionals.F1444", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1444 )
-		pFnF1444 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1444" );
+	UFunction* const pFnF1444 = pFnF1444Ref.Get ( );
 
 	UBioAutoConditionals_execF1444_Parms F1444_Parms;
 	F1444_Parms.bioWorld = bioWorld;
@@ -3589,10 +3432,9 @@ bool UBioAutoConditionals::F1444 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1445 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1445 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1445Ref { L"Function PlotManager.BioAutoConditionals.F1445", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1445 )
-		pFnF1445 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1445" );
+	UFunction* const pFnF1445 = pFnF1445Ref.Get ( );
 
 	UBioAutoConditionals_execF1445_Parms F1445_Parms;
 	F1445_Parms.bioWorld = bioWorld;
@@ -3612,10 +3454,9 @@ bool UBioAutoConditionals::F1445 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1447 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1447 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1447Ref { L"Function PlotManager.BioAutoConditionals.F1447", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1447 )
-		pFnF1447 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1447" );
+	UFunction* const pFnF1447 = pFnF1447Ref.Get ( );
 
 	UBioAutoConditionals_execF1447_Parms F1447_Parms;
 	F1447_Parms.bioWorld = bioWorld;
@@ -3635,10 +3476,9 @@ bool UBioAutoConditionals::F1447 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1446 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1446 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1446Ref { L"Function PlotManager.BioAutoConditionals.F1446", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1446 )
-		pFnF1446 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1446" );
+	UFunction* const pFnF1446 = pFnF1446Ref.Get ( );
 
 	UBioAutoConditionals_execF1446_Parms F1446_Parms;
 	F1446_Parms.bioWorld = bioWorld;
@@ -3658,10 +3498,9 @@ bool UBioAutoConditionals::F1446 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1449 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1449 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1449Ref { L"Function PlotManager.BioAutoConditionals.F1449", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1449 )
-		pFnF1449 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1449" );
+	UFunction* const pFnF1449 = pFnF1449Ref.Get ( );
 
 	UBioAutoConditionals_execF1449_Parms F1449_Parms;
 	F1449_Parms.bioWorld = bioWorld;
@@ -3681,10 +3520,9 @@ bool UBioAutoConditionals::F1449 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1448 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1448 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1448Ref { L"Function PlotManager.BioAutoConditionals.F1448", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1448 )
-		pFnF1448 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1448" );
+	UFunction* const pFnF1448 = pFnF1448Ref.Get ( );
 
 	UBioAutoConditionals_execF1448_Parms F1448_Parms;
 	F1448_Parms.bioWorld = bioWorld;
@@ -3704,10 +3542,9 @@ bool UBioAutoConditionals::F1448 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1464 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1464 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1464Ref { L"Function PlotManager.BioAutoConditionals.F1464", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1464 )
-		pFnF1464 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1464" );
+	UFunction* const pFnF1464 = pFnF1464Ref.Get ( );
 
 	UBioAutoConditionals_execF1464_Parms F1464_Parms;
 	F1464_Parms.bioWorld = bioWorld;
@@ -3727,10 +3564,9 @@ bool UBioAutoConditionals::F1464 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1463 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1463 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1463Ref { L"Function PlotManager.BioAutoConditionals.F1463", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1463 )
-		pFnF1463 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1463" );
+	UFunction* const pFnF1463 = pFnF1463Ref.Get ( );
 
 	UBioAutoConditionals_execF1463_Parms F1463_Parms;
 	F1463_Parms.bioWorld = bioWorld;
@@ -3750,10 +3586,9 @@ bool UBioAutoConditionals::F1463 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1466 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1466 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1466Ref { L"Function PlotManager.BioAutoConditionals.F1466", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1466 )
-		pFnF1466 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1466" );
+	UFunction* const pFnF1466 = pFnF1466Ref.Get ( );
 
 	UBioAutoConditionals_execF1466_Parms F1466_Parms;
 	F1466_Parms.bioWorld = bioWorld;
@@ -3773,10 +3608,9 @@ bool UBioAutoConditionals::F1466 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1465 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1465 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1465Ref { L"Function PlotManager.BioAutoConditionals.F1465", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1465 )
-		pFnF1465 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1465" );
+	UFunction* const pFnF1465 = pFnF1465Ref.Get ( );
 
 	UBioAutoConditionals_execF1465_Parms F1465_Parms;
 	F1465_Parms.bioWorld = bioWorld;
@@ -3796,10 +3630,9 @@ bool UBioAutoConditionals::F1465 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1460 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1460 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1460Ref { L"Function PlotManager.BioAutoConditionals.F1460", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1460 )
-		pFnF1460 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1460" );
+	UFunction* const pFnF1460 = pFnF1460Ref.Get ( );
 
 	UBioAutoConditionals_execF1460_Parms F1460_Parms;
 	F1460_Parms.bioWorld = bioWorld;
@@ -3819,10 +3652,9 @@ bool UBioAutoConditionals::F1460 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1459 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1459 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1459Ref { L"Function PlotManager.BioAutoConditionals.F1459", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1459 )
-		pFnF1459 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1459" );
+	UFunction* const pFnF1459 = pFnF1459Ref.Get ( );
 
 	UBioAutoConditionals_execF1459_Parms F1459_Parms;
 	F1459_Parms.bioWorld = bioWorld;
@@ -3842,10 +3674,9 @@ bool UBioAutoConditionals::F1459 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1462 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1462 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1462Ref { L"Function PlotManager.BioAutoConditionals.F1462", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1462 )
-		pFnF1462 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1462" );
+	UFunction* const pFnF1462 = pFnF1462Ref.Get ( );
 
 	UBioAutoConditionals_execF1462_Parms F1462_Parms;
 	F1462_Parms.bioWorld = bioWorld;
@@ -3865,10 +3696,9 @@ bool UBioAutoConditionals::F1462 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1461 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1461 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1461Ref { L"Function PlotManager.BioAutoConditionals.F1461", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1461 )
-		pFnF1461 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1461" );
+	UFunction* const pFnF1461 = pFnF1461Ref.Get ( );
 
 	UBioAutoConditionals_execF1461_Parms F1461_Parms;
 	F1461_Parms.bioWorld = bioWorld;
@@ -3888,10 +3718,9 @@ bool UBioAutoConditionals::F1461 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1451 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1451 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1451Ref { L"Function PlotManager.BioAutoConditionals.F1451", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1451 )
-		pFnF1451 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1451" );
+	UFunction* const pFnF1451 = pFnF1451Ref.Get ( );
 
 	UBioAutoConditionals_execF1451_Parms F1451_Parms;
 	F1451_Parms.bioWorld = bioWorld;
@@ -3911,10 +3740,9 @@ bool UBioAutoConditionals::F1451 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1450 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1450 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1450Ref { L"Function PlotManager.BioAutoConditionals.F1450", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1450 )
-		pFnF1450 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1450" );
+	UFunction* const pFnF1450 = pFnF1450Ref.Get ( );
 
 	UBioAutoConditionals_execF1450_Parms F1450_Parms;
 	F1450_Parms.bioWorld = bioWorld;
@@ -3934,10 +3762,9 @@ bool UBioAutoConditionals::F1450 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1454 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1454 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1454Ref { L"Function PlotManager.BioAutoConditionals.F1454", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1454 )
-		pFnF1454 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1454" );
+	UFunction* const pFnF1454 = pFnF1454Ref.Get ( );
 
 	UBioAutoConditionals_execF1454_Parms F1454_Parms;
 	F1454_Parms.bioWorld = bioWorld;
@@ -3957,10 +3784,9 @@ bool UBioAutoConditionals::F1454 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1452 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1452 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1452Ref { L"Function PlotManager.BioAutoConditionals.F1452", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1452 )
-		pFnF1452 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1452" );
+	UFunction* const pFnF1452 = pFnF1452Ref.Get ( );
 
 	UBioAutoConditionals_execF1452_Parms F1452_Parms;
 	F1452_Parms.bioWorld = bioWorld;
@@ -3980,10 +3806,9 @@ bool UBioAutoConditionals::F1452 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1456 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1456 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1456Ref { L"Function PlotManager.BioAutoConditionals.F1456", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1456 )
-		pFnF1456 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1456" );
+	UFunction* const pFnF1456 = pFnF1456Ref.Get ( );
 
 	UBioAutoConditionals_execF1456_Parms F1456_Parms;
 	F1456_Parms.bioWorld = bioWorld;
@@ -4003,10 +3828,9 @@ bool UBioAutoConditionals::F1456 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1455 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1455 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1455Ref { L"Function PlotManager.BioAutoConditionals.F1455", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1455 )
-		pFnF1455 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1455" );
+	UFunction* const pFnF1455 = pFnF1455Ref.Get ( );
 
 	UBioAutoConditionals_execF1455_Parms F1455_Parms;
 	F1455_Parms.bioWorld = bioWorld;
@@ -4026,10 +3850,9 @@ bool UBioAutoConditionals::F1455 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1458 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1458 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1458Ref { L"Function PlotManager.BioAutoConditionals.F1458", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1458 )
-		pFnF1458 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1458" );
+	UFunction* const pFnF1458 = pFnF1458Ref.Get ( );
 
 	UBioAutoConditionals_execF1458_Parms F1458_Parms;
 	F1458_Parms.bioWorld = bioWorld;
@@ -4049,10 +3872,9 @@ bool UBioAutoConditionals::F1458 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1457 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1457 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1457Ref { L"Function PlotManager.BioAutoConditionals.F1457", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1457 )
-		pFnF1457 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1457" );
+	UFunction* const pFnF1457 = pFnF1457Ref.Get ( );
 
 	UBioAutoConditionals_execF1457_Parms F1457_Parms;
 	F1457_Parms.bioWorld = bioWorld;
@@ -4072,10 +3894,9 @@ bool UBioAutoConditionals::F1457 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1468 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1468 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1468Ref { L"Function PlotManager.BioAutoConditionals.F1468", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1468 )
-		pFnF1468 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1468" );
+	UFunction* const pFnF1468 = pFnF1468Ref.Get ( );
 
 	UBioAutoConditionals_execF1468_Parms F1468_Parms;
 	F1468_Parms.bioWorld = bioWorld;
@@ -4095,10 +3916,9 @@ bool UBioAutoConditionals::F1468 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1470 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1470 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1470Ref { L"Function PlotManager.BioAutoConditionals.F1470", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1470 )
-		pFnF1470 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1470" );
+	UFunction* const pFnF1470 = pFnF1470Ref.Get ( );
 
 	UBioAutoConditionals_execF1470_Parms F1470_Parms;
 	F1470_Parms.bioWorld = bioWorld;
@@ -4118,10 +3938,9 @@ bool UBioAutoConditionals::F1470 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1469 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1469 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1469Ref { L"Function PlotManager.BioAutoConditionals.F1469", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1469 )
-		pFnF1469 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1469" );
+	UFunction* const pFnF1469 = pFnF1469Ref.Get ( );
 
 	UBioAutoConditionals_execF1469_Parms F1469_Parms;
 	F1469_Parms.bioWorld = bioWorld;
@@ -4141,10 +3960,9 @@ bool UBioAutoConditionals::F1469 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1472 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1472 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1472Ref { L"Function PlotManager.BioAutoConditionals.F1472", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1472 )
-		pFnF1472 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1472" );
+	UFunction* const pFnF1472 = pFnF1472Ref.Get ( );
 
 	UBioAutoConditionals_execF1472_Parms F1472_Parms;
 	F1472_Parms.bioWorld = bioWorld;
@@ -4164,10 +3982,9 @@ bool UBioAutoConditionals::F1472 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1471 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1471 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1471Ref { L"Function PlotManager.BioAutoConditionals.F1471", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1471 )
-		pFnF1471 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1471" );
+	UFunction* const pFnF1471 = pFnF1471Ref.Get ( );
 
 	UBioAutoConditionals_execF1471_Parms F1471_Parms;
 	F1471_Parms.bioWorld = bioWorld;
@@ -4187,10 +4004,9 @@ bool UBioAutoConditionals::F1471 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1474 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1474 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1474Ref { L"Function PlotManager.BioAutoConditionals.F1474", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1474 )
-		pFnF1474 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1474" );
+	UFunction* const pFnF1474 = pFnF1474Ref.Get ( );
 
 	UBioAutoConditionals_execF1474_Parms F1474_Parms;
 	F1474_Parms.bioWorld = bioWorld;
@@ -4210,10 +4026,9 @@ bool UBioAutoConditionals::F1474 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1473 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1473 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1473Ref { L"Function PlotManager.BioAutoConditionals.F1473", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1473 )
-		pFnF1473 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1473" );
+	UFunction* const pFnF1473 = pFnF1473Ref.Get ( );
 
 	UBioAutoConditionals_execF1473_Parms F1473_Parms;
 	F1473_Parms.bioWorld = bioWorld;
@@ -4233,10 +4048,9 @@ bool UBioAutoConditionals::F1473 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1476 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1476 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1476Ref { L"Function PlotManager.BioAutoConditionals.F1476", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1476 )
-		pFnF1476 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1476" );
+	UFunction* const pFnF1476 = pFnF1476Ref.Get ( );
 
 	UBioAutoConditionals_execF1476_Parms F1476_Parms;
 	F1476_Parms.bioWorld = bioWorld;
@@ -4256,10 +4070,9 @@ bool UBioAutoConditionals::F1476 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1475 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1475 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1475Ref { L"Function PlotManager.BioAutoConditionals.F1475", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1475 )
-		pFnF1475 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1475" );
+	UFunction* const pFnF1475 = pFnF1475Ref.Get ( );
 
 	UBioAutoConditionals_execF1475_Parms F1475_Parms;
 	F1475_Parms.bioWorld = bioWorld;
@@ -4279,10 +4092,9 @@ bool UBioAutoConditionals::F1475 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1478 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1478 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1478Ref { L"Function PlotManager.BioAutoConditionals.F1478", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1478 )
-		pFnF1478 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1478" );
+	UFunction* const pFnF1478 = pFnF1478Ref.Get ( );
 
 	UBioAutoConditionals_execF1478_Parms F1478_Parms;
 	F1478_Parms.bioWorld = bioWorld;
@@ -4302,10 +4114,9 @@ bool UBioAutoConditionals::F1478 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1477 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1477 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1477Ref { L"Function PlotManager.BioAutoConditionals.F1477", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1477 )
-		pFnF1477 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1477" );
+	UFunction* const pFnF1477 = pFnF1477Ref.Get ( );
 
 	UBioAutoConditionals_execF1477_Parms F1477_Parms;
 	F1477_Parms.bioWorld = bioWorld;
@@ -4325,10 +4136,9 @@ bool UBioAutoConditionals::F1477 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1480 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1480 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1480Ref { L"Function PlotManager.BioAutoConditionals.F1480", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1480 )
-		pFnF1480 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1480" );
+	UFunction* const pFnF1480 = pFnF1480Ref.Get ( );
 
 	UBioAutoConditionals_execF1480_Parms F1480_Parms;
 	F1480_Parms.bioWorld = bioWorld;
@@ -4348,10 +4158,9 @@ bool UBioAutoConditionals::F1480 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1479 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1479 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1479Ref { L"Function PlotManager.BioAutoConditionals.F1479", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1479 )
-		pFnF1479 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1479" );
+	UFunction* const pFnF1479 = pFnF1479Ref.Get ( );
 
 	UBioAutoConditionals_execF1479_Parms F1479_Parms;
 	F1479_Parms.bioWorld = bioWorld;
@@ -4371,10 +4180,9 @@ bool UBioAutoConditionals::F1479 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1433 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1433 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1433Ref { L"Function PlotManager.BioAutoConditionals.F1433", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1433 )
-		pFnF1433 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1433" );
+	UFunction* const pFnF1433 = pFnF1433Ref.Get ( );
 
 	UBioAutoConditionals_execF1433_Parms F1433_Parms;
 	F1433_Parms.bioWorld = bioWorld;
@@ -4394,10 +4202,9 @@ bool UBioAutoConditionals::F1433 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1432 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1432 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1432Ref { L"Function PlotManager.BioAutoConditionals.F1432", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1432 )
-		pFnF1432 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1432" );
+	UFunction* const pFnF1432 = pFnF1432Ref.Get ( );
 
 	UBioAutoConditionals_execF1432_Parms F1432_Parms;
 	F1432_Parms.bioWorld = bioWorld;
@@ -4417,10 +4224,9 @@ bool UBioAutoConditionals::F1432 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1431 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1431 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1431Ref { L"Function PlotManager.BioAutoConditionals.F1431", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1431 )
-		pFnF1431 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1431" );
+	UFunction* const pFnF1431 = pFnF1431Ref.Get ( );
 
 	UBioAutoConditionals_execF1431_Parms F1431_Parms;
 	F1431_Parms.bioWorld = bioWorld;
@@ -4440,10 +4246,9 @@ bool UBioAutoConditionals::F1431 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1430 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1430 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1430Ref { L"Function PlotManager.BioAutoConditionals.F1430", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1430 )
-		pFnF1430 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1430" );
+	UFunction* const pFnF1430 = pFnF1430Ref.Get ( );
 
 	UBioAutoConditionals_execF1430_Parms F1430_Parms;
 	F1430_Parms.bioWorld = bioWorld;
@@ -4463,10 +4268,9 @@ bool UBioAutoConditionals::F1430 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1429 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1429 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1429Ref { L"Function PlotManager.BioAutoConditionals.F1429", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1429 )
-		pFnF1429 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1429" );
+	UFunction* const pFnF1429 = pFnF1429Ref.Get ( );
 
 	UBioAutoConditionals_execF1429_Parms F1429_Parms;
 	F1429_Parms.bioWorld = bioWorld;
@@ -4486,10 +4290,9 @@ bool UBioAutoConditionals::F1429 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1428 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1428 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1428Ref { L"Function PlotManager.BioAutoConditionals.F1428", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1428 )
-		pFnF1428 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1428" );
+	UFunction* const pFnF1428 = pFnF1428Ref.Get ( );
 
 	UBioAutoConditionals_execF1428_Parms F1428_Parms;
 	F1428_Parms.bioWorld = bioWorld;
@@ -4509,10 +4312,9 @@ bool UBioAutoConditionals::F1428 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1427 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1427 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1427Ref { L"Function PlotManager.BioAutoConditionals.F1427", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1427 )
-		pFnF1427 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1427" );
+	UFunction* const pFnF1427 = pFnF1427Ref.Get ( );
 
 	UBioAutoConditionals_execF1427_Parms F1427_Parms;
 	F1427_Parms.bioWorld = bioWorld;
@@ -4532,10 +4334,9 @@ bool UBioAutoConditionals::F1427 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1426 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1426 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1426Ref { L"Function PlotManager.BioAutoConditionals.F1426", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1426 )
-		pFnF1426 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1426" );
+	UFunction* const pFnF1426 = pFnF1426Ref.Get ( );
 
 	UBioAutoConditionals_execF1426_Parms F1426_Parms;
 	F1426_Parms.bioWorld = bioWorld;
@@ -4555,10 +4356,9 @@ bool UBioAutoConditionals::F1426 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1425 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1425 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1425Ref { L"Function PlotManager.BioAutoConditionals.F1425", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1425 )
-		pFnF1425 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1425" );
+	UFunction* const pFnF1425 = pFnF1425Ref.Get ( );
 
 	UBioAutoConditionals_execF1425_Parms F1425_Parms;
 	F1425_Parms.bioWorld = bioWorld;
@@ -4578,10 +4378,9 @@ bool UBioAutoConditionals::F1425 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1424 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1424 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1424Ref { L"Function PlotManager.BioAutoConditionals.F1424", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1424 )
-		pFnF1424 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1424" );
+	UFunction* const pFnF1424 = pFnF1424Ref.Get ( );
 
 	UBioAutoConditionals_execF1424_Parms F1424_Parms;
 	F1424_Parms.bioWorld = bioWorld;
@@ -4601,10 +4400,9 @@ bool UBioAutoConditionals::F1424 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1423 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1423 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1423Ref { L"Function PlotManager.BioAutoConditionals.F1423", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1423 )
-		pFnF1423 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1423" );
+	UFunction* const pFnF1423 = pFnF1423Ref.Get ( );
 
 	UBioAutoConditionals_execF1423_Parms F1423_Parms;
 	F1423_Parms.bioWorld = bioWorld;
@@ -4624,10 +4422,9 @@ bool UBioAutoConditionals::F1423 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1422 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1422 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1422Ref { L"Function PlotManager.BioAutoConditionals.F1422", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1422 )
-		pFnF1422 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1422" );
+	UFunction* const pFnF1422 = pFnF1422Ref.Get ( );
 
 	UBioAutoConditionals_execF1422_Parms F1422_Parms;
 	F1422_Parms.bioWorld = bioWorld;
@@ -4647,10 +4444,9 @@ bool UBioAutoConditionals::F1422 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1421 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1421 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1421Ref { L"Function PlotManager.BioAutoConditionals.F1421", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1421 )
-		pFnF1421 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1421" );
+	UFunction* const pFnF1421 = pFnF1421Ref.Get ( );
 
 	UBioAutoConditionals_execF1421_Parms F1421_Parms;
 	F1421_Parms.bioWorld = bioWorld;
@@ -4670,10 +4466,9 @@ bool UBioAutoConditionals::F1421 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1420 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1420 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1420Ref { L"Function PlotManager.BioAutoConditionals.F1420", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1420 )
-		pFnF1420 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1420" );
+	UFunction* const pFnF1420 = pFnF1420Ref.Get ( );
 
 	UBioAutoConditionals_execF1420_Parms F1420_Parms;
 	F1420_Parms.bioWorld = bioWorld;
@@ -4693,10 +4488,9 @@ bool UBioAutoConditionals::F1420 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1419 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1419 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1419Ref { L"Function PlotManager.BioAutoConditionals.F1419", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1419 )
-		pFnF1419 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1419" );
+	UFunction* const pFnF1419 = pFnF1419Ref.Get ( );
 
 	UBioAutoConditionals_execF1419_Parms F1419_Parms;
 	F1419_Parms.bioWorld = bioWorld;
@@ -4716,10 +4510,9 @@ bool UBioAutoConditionals::F1419 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1418 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1418 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1418Ref { L"Function PlotManager.BioAutoConditionals.F1418", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1418 )
-		pFnF1418 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1418" );
+	UFunction* const pFnF1418 = pFnF1418Ref.Get ( );
 
 	UBioAutoConditionals_execF1418_Parms F1418_Parms;
 	F1418_Parms.bioWorld = bioWorld;
@@ -4739,10 +4532,9 @@ bool UBioAutoConditionals::F1418 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1417 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1417 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1417Ref { L"Function PlotManager.BioAutoConditionals.F1417", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1417 )
-		pFnF1417 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1417" );
+	UFunction* const pFnF1417 = pFnF1417Ref.Get ( );
 
 	UBioAutoConditionals_execF1417_Parms F1417_Parms;
 	F1417_Parms.bioWorld = bioWorld;
@@ -4762,10 +4554,9 @@ bool UBioAutoConditionals::F1417 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1416 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1416 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1416Ref { L"Function PlotManager.BioAutoConditionals.F1416", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1416 )
-		pFnF1416 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1416" );
+	UFunction* const pFnF1416 = pFnF1416Ref.Get ( );
 
 	UBioAutoConditionals_execF1416_Parms F1416_Parms;
 	F1416_Parms.bioWorld = bioWorld;
@@ -4785,10 +4576,9 @@ bool UBioAutoConditionals::F1416 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1415 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1415 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1415Ref { L"Function PlotManager.BioAutoConditionals.F1415", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1415 )
-		pFnF1415 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1415" );
+	UFunction* const pFnF1415 = pFnF1415Ref.Get ( );
 
 	UBioAutoConditionals_execF1415_Parms F1415_Parms;
 	F1415_Parms.bioWorld = bioWorld;
@@ -4808,10 +4598,9 @@ bool UBioAutoConditionals::F1415 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1408 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1408 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1408Ref { L"Function PlotManager.BioAutoConditionals.F1408", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1408 )
-		pFnF1408 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1408" );
+	UFunction* const pFnF1408 = pFnF1408Ref.Get ( );
 
 	UBioAutoConditionals_execF1408_Parms F1408_Parms;
 	F1408_Parms.bioWorld = bioWorld;
@@ -4831,10 +4620,9 @@ bool UBioAutoConditionals::F1408 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1406 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1406 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1406Ref { L"Function PlotManager.BioAutoConditionals.F1406", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1406 )
-		pFnF1406 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1406" );
+	UFunction* const pFnF1406 = pFnF1406Ref.Get ( );
 
 	UBioAutoConditionals_execF1406_Parms F1406_Parms;
 	F1406_Parms.bioWorld = bioWorld;
@@ -4854,10 +4642,9 @@ bool UBioAutoConditionals::F1406 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1081 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1081 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1081Ref { L"Function PlotManager.BioAutoConditionals.F1081", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1081 )
-		pFnF1081 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1081" );
+	UFunction* const pFnF1081 = pFnF1081Ref.Get ( );
 
 	UBioAutoConditionals_execF1081_Parms F1081_Parms;
 	F1081_Parms.bioWorld = bioWorld;
@@ -4877,10 +4664,9 @@ bool UBioAutoConditionals::F1081 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1080 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1080 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1080Ref { L"Function PlotManager.BioAutoConditionals.F1080", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1080 )
-		pFnF1080 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1080" );
+	UFunction* const pFnF1080 = pFnF1080Ref.Get ( );
 
 	UBioAutoConditionals_execF1080_Parms F1080_Parms;
 	F1080_Parms.bioWorld = bioWorld;
@@ -4900,10 +4686,9 @@ bool UBioAutoConditionals::F1080 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F477 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF477 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF477Ref { L"Function PlotManager.BioAutoConditionals.F477", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF477 )
-		pFnF477 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F477" );
+	UFunction* const pFnF477 = pFnF477Ref.Get ( );
 
 	UBioAutoConditionals_execF477_Parms F477_Parms;
 	F477_Parms.bioWorld = bioWorld;
@@ -4923,10 +4708,9 @@ bool UBioAutoConditionals::F477 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F476 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF476 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF476Ref { L"Function PlotManager.BioAutoConditionals.F476", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF476 )
-		pFnF476 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F476" );
+	UFunction* const pFnF476 = pFnF476Ref.Get ( );
 
 	UBioAutoConditionals_execF476_Parms F476_Parms;
 	F476_Parms.bioWorld = bioWorld;
@@ -4946,10 +4730,9 @@ bool UBioAutoConditionals::F476 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F475 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF475 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF475Ref { L"Function PlotManager.BioAutoConditionals.F475", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF475 )
-		pFnF475 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F475" );
+	UFunction* const pFnF475 = pFnF475Ref.Get ( );
 
 	UBioAutoConditionals_execF475_Parms F475_Parms;
 	F475_Parms.bioWorld = bioWorld;
@@ -4969,10 +4752,9 @@ bool UBioAutoConditionals::F475 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F474 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF474 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF474Ref { L"Function PlotManager.BioAutoConditionals.F474", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF474 )
-		pFnF474 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F474" );
+	UFunction* const pFnF474 = pFnF474Ref.Get ( );
 
 	UBioAutoConditionals_execF474_Parms F474_Parms;
 	F474_Parms.bioWorld = bioWorld;
@@ -4992,10 +4774,9 @@ bool UBioAutoConditionals::F474 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F473 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF473 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF473Ref { L"Function PlotManager.BioAutoConditionals.F473", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF473 )
-		pFnF473 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F473" );
+	UFunction* const pFnF473 = pFnF473Ref.Get ( );
 
 	UBioAutoConditionals_execF473_Parms F473_Parms;
 	F473_Parms.bioWorld = bioWorld;
@@ -5015,10 +4796,9 @@ bool UBioAutoConditionals::F473 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F472 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF472 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF472Ref { L"Function PlotManager.BioAutoConditionals.F472", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF472 )
-		pFnF472 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F472" );
+	UFunction* const pFnF472 = pFnF472Ref.Get ( );
 
 	UBioAutoConditionals_execF472_Parms F472_Parms;
 	F472_Parms.bioWorld = bioWorld;
@@ -5038,10 +4818,9 @@ bool UBioAutoConditionals::F472 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F465 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF465 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF465Ref { L"Function PlotManager.BioAutoConditionals.F465", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF465 )
-		pFnF465 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F465" );
+	UFunction* const pFnF465 = pFnF465Ref.Get ( );
 
 	UBioAutoConditionals_execF465_Parms F465_Parms;
 	F465_Parms.bioWorld = bioWorld;
@@ -5061,10 +4840,9 @@ bool UBioAutoConditionals::F465 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F459 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF459 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF459Ref { L"Function PlotManager.BioAutoConditionals.F459", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF459 )
-		pFnF459 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F459" );
+	UFunction* const pFnF459 = pFnF459Ref.Get ( );
 
 	UBioAutoConditionals_execF459_Parms F459_Parms;
 	F459_Parms.bioWorld = bioWorld;
@@ -5084,10 +4862,9 @@ bool UBioAutoConditionals::F459 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F458 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF458 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF458Ref { L"Function PlotManager.BioAutoConditionals.F458", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF458 )
-		pFnF458 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F458" );
+	UFunction* const pFnF458 = pFnF458Ref.Get ( );
 
 	UBioAutoConditionals_execF458_Parms F458_Parms;
 	F458_Parms.bioWorld = bioWorld;
@@ -5107,10 +4884,9 @@ bool UBioAutoConditionals::F458 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F457 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF457 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF457Ref { L"Function PlotManager.BioAutoConditionals.F457", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF457 )
-		pFnF457 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F457" );
+	UFunction* const pFnF457 = pFnF457Ref.Get ( );
 
 	UBioAutoConditionals_execF457_Parms F457_Parms;
 	F457_Parms.bioWorld = bioWorld;
@@ -5130,10 +4906,9 @@ bool UBioAutoConditionals::F457 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F456 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF456 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF456Ref { L"Function PlotManager.BioAutoConditionals.F456", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF456 )
-		pFnF456 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F456" );
+	UFunction* const pFnF456 = pFnF456Ref.Get ( );
 
 	UBioAutoConditionals_execF456_Parms F456_Parms;
 	F456_Parms.bioWorld = bioWorld;
@@ -5153,10 +4928,9 @@ bool UBioAutoConditionals::F456 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F455 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF455 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF455Ref { L"Function PlotManager.BioAutoConditionals.F455", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF455 )
-		pFnF455 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F455" );
+	UFunction* const pFnF455 = pFnF455Ref.Get ( );
 
 	UBioAutoConditionals_execF455_Parms F455_Parms;
 	F455_Parms.bioWorld = bioWorld;
@@ -5176,10 +4950,9 @@ bool UBioAutoConditionals::F455 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F449 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF449 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF449Ref { L"Function PlotManager.BioAutoConditionals.F449", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF449 )
-		pFnF449 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F449" );
+	UFunction* const pFnF449 = pFnF449Ref.Get ( );
 
 	UBioAutoConditionals_execF449_Parms F449_Parms;
 	F449_Parms.bioWorld = bioWorld;
@@ -5199,10 +4972,9 @@ bool UBioAutoConditionals::F449 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F448 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF448 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF448Ref { L"Function PlotManager.BioAutoConditionals.F448", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF448 )
-		pFnF448 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F448" );
+	UFunction* const pFnF448 = pFnF448Ref.Get ( );
 
 	UBioAutoConditionals_execF448_Parms F448_Parms;
 	F448_Parms.bioWorld = bioWorld;
@@ -5222,10 +4994,9 @@ bool UBioAutoConditionals::F448 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F447 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF447 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF447Ref { L"Function PlotManager.BioAutoConditionals.F447", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF447 )
-		pFnF447 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F447" );
+	UFunction* const pFnF447 = pFnF447Ref.Get ( );
 
 	UBioAutoConditionals_execF447_Parms F447_Parms;
 	F447_Parms.bioWorld = bioWorld;
@@ -5245,10 +5016,9 @@ bool UBioAutoConditionals::F447 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F446 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF446 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF446Ref { L"Function PlotManager.BioAutoConditionals.F446", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF446 )
-		pFnF446 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F446" );
+	UFunction* const pFnF446 = pFnF446Ref.Get ( );
 
 	UBioAutoConditionals_execF446_Parms F446_Parms;
 	F446_Parms.bioWorld = bioWorld;
@@ -5268,10 +5038,9 @@ bool UBioAutoConditionals::F446 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F445 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF445 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF445Ref { L"Function PlotManager.BioAutoConditionals.F445", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF445 )
-		pFnF445 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F445" );
+	UFunction* const pFnF445 = pFnF445Ref.Get ( );
 
 	UBioAutoConditionals_execF445_Parms F445_Parms;
 	F445_Parms.bioWorld = bioWorld;
@@ -5291,10 +5060,9 @@ bool UBioAutoConditionals::F445 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F470 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF470 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF470Ref { L"Function PlotManager.BioAutoConditionals.F470", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF470 )
-		pFnF470 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F470" );
+	UFunction* const pFnF470 = pFnF470Ref.Get ( );
 
 	UBioAutoConditionals_execF470_Parms F470_Parms;
 	F470_Parms.bioWorld = bioWorld;
@@ -5314,10 +5082,9 @@ bool UBioAutoConditionals::F470 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F568 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF568 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF568Ref { L"Function PlotManager.BioAutoConditionals.F568", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF568 )
-		pFnF568 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F568" );
+	UFunction* const pFnF568 = pFnF568Ref.Get ( );
 
 	UBioAutoConditionals_execF568_Parms F568_Parms;
 	F568_Parms.bioWorld = bioWorld;
@@ -5337,10 +5104,9 @@ bool UBioAutoConditionals::F568 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F562 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF562 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF562Ref { L"Function PlotManager.BioAutoConditionals.F562", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF562 )
-		pFnF562 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F562" );
+	UFunction* const pFnF562 = pFnF562Ref.Get ( );
 
 	UBioAutoConditionals_execF562_Parms F562_Parms;
 	F562_Parms.bioWorld = bioWorld;
@@ -5360,10 +5126,9 @@ bool UBioAutoConditionals::F562 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F558 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF558 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF558Ref { L"Function PlotManager.BioAutoConditionals.F558", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF558 )
-		pFnF558 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F558" );
+	UFunction* const pFnF558 = pFnF558Ref.Get ( );
 
 	UBioAutoConditionals_execF558_Parms F558_Parms;
 	F558_Parms.bioWorld = bioWorld;
@@ -5383,10 +5148,9 @@ bool UBioAutoConditionals::F558 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F223 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF223 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF223Ref { L"Function PlotManager.BioAutoConditionals.F223", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF223 )
-		pFnF223 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F223" );
+	UFunction* const pFnF223 = pFnF223Ref.Get ( );
 
 	UBioAutoConditionals_execF223_Parms F223_Parms;
 	F223_Parms.bioWorld = bioWorld;
@@ -5406,10 +5170,9 @@ bool UBioAutoConditionals::F223 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F218 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF218 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF218Ref { L"Function PlotManager.BioAutoConditionals.F218", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF218 )
-		pFnF218 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F218" );
+	UFunction* const pFnF218 = pFnF218Ref.Get ( );
 
 	UBioAutoConditionals_execF218_Parms F218_Parms;
 	F218_Parms.bioWorld = bioWorld;
@@ -5429,10 +5192,9 @@ bool UBioAutoConditionals::F218 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F214 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF214 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF214Ref { L"Function PlotManager.BioAutoConditionals.F214", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF214 )
-		pFnF214 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F214" );
+	UFunction* const pFnF214 = pFnF214Ref.Get ( );
 
 	UBioAutoConditionals_execF214_Parms F214_Parms;
 	F214_Parms.bioWorld = bioWorld;
@@ -5452,10 +5214,9 @@ bool UBioAutoConditionals::F214 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F213 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF213 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF213Ref { L"Function PlotManager.BioAutoConditionals.F213", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF213 )
-		pFnF213 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F213" );
+	UFunction* const pFnF213 = pFnF213Ref.Get ( );
 
 	UBioAutoConditionals_execF213_Parms F213_Parms;
 	F213_Parms.bioWorld = bioWorld;
@@ -5475,10 +5236,9 @@ bool UBioAutoConditionals::F213 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F225 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF225 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF225Ref { L"Function PlotManager.BioAutoConditionals.F225", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF225 )
-		pFnF225 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F225" );
+	UFunction* const pFnF225 = pFnF225Ref.Get ( );
 
 	UBioAutoConditionals_execF225_Parms F225_Parms;
 	F225_Parms.bioWorld = bioWorld;
@@ -5498,10 +5258,9 @@ bool UBioAutoConditionals::F225 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F181 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF181 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF181Ref { L"Function PlotManager.BioAutoConditionals.F181", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF181 )
-		pFnF181 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F181" );
+	UFunction* const pFnF181 = pFnF181Ref.Get ( );
 
 	UBioAutoConditionals_execF181_Parms F181_Parms;
 	F181_Parms.bioWorld = bioWorld;
@@ -5521,10 +5280,9 @@ bool UBioAutoConditionals::F181 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F180 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF180 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF180Ref { L"Function PlotManager.BioAutoConditionals.F180", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF180 )
-		pFnF180 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F180" );
+	UFunction* const pFnF180 = pFnF180Ref.Get ( );
 
 	UBioAutoConditionals_execF180_Parms F180_Parms;
 	F180_Parms.bioWorld = bioWorld;
@@ -5544,10 +5302,9 @@ bool UBioAutoConditionals::F180 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1637 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1637 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1637Ref { L"Function PlotManager.BioAutoConditionals.F1637", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1637 )
-		pFnF1637 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1637" );
+	UFunction* const pFnF1637 = pFnF1637Ref.Get ( );
 
 	UBioAutoConditionals_execF1637_Parms F1637_Parms;
 	F1637_Parms.bioWorld = bioWorld;
@@ -5567,10 +5324,9 @@ bool UBioAutoConditionals::F1637 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1636 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1636 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1636Ref { L"Function PlotManager.BioAutoConditionals.F1636", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1636 )
-		pFnF1636 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1636" );
+	UFunction* const pFnF1636 = pFnF1636Ref.Get ( );
 
 	UBioAutoConditionals_execF1636_Parms F1636_Parms;
 	F1636_Parms.bioWorld = bioWorld;
@@ -5590,10 +5346,9 @@ bool UBioAutoConditionals::F1636 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1205 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1205 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1205Ref { L"Function PlotManager.BioAutoConditionals.F1205", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1205 )
-		pFnF1205 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1205" );
+	UFunction* const pFnF1205 = pFnF1205Ref.Get ( );
 
 	UBioAutoConditionals_execF1205_Parms F1205_Parms;
 	F1205_Parms.bioWorld = bioWorld;
@@ -5613,10 +5368,9 @@ bool UBioAutoConditionals::F1205 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F451 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF451 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF451Ref { L"Function PlotManager.BioAutoConditionals.F451", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF451 )
-		pFnF451 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F451" );
+	UFunction* const pFnF451 = pFnF451Ref.Get ( );
 
 	UBioAutoConditionals_execF451_Parms F451_Parms;
 	F451_Parms.bioWorld = bioWorld;
@@ -5636,10 +5390,9 @@ bool UBioAutoConditionals::F451 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F450 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF450 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF450Ref { L"Function PlotManager.BioAutoConditionals.F450", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF450 )
-		pFnF450 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F450" );
+	UFunction* const pFnF450 = pFnF450Ref.Get ( );
 
 	UBioAutoConditionals_execF450_Parms F450_Parms;
 	F450_Parms.bioWorld = bioWorld;
@@ -5659,10 +5412,9 @@ bool UBioAutoConditionals::F450 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F471 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF471 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF471Ref { L"Function PlotManager.BioAutoConditionals.F471", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF471 )
-		pFnF471 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F471" );
+	UFunction* const pFnF471 = pFnF471Ref.Get ( );
 
 	UBioAutoConditionals_execF471_Parms F471_Parms;
 	F471_Parms.bioWorld = bioWorld;
@@ -5682,10 +5434,9 @@ bool UBioAutoConditionals::F471 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F454 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF454 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF454Ref { L"Function PlotManager.BioAutoConditionals.F454", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF454 )
-		pFnF454 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F454" );
+	UFunction* const pFnF454 = pFnF454Ref.Get ( );
 
 	UBioAutoConditionals_execF454_Parms F454_Parms;
 	F454_Parms.bioWorld = bioWorld;
@@ -5705,10 +5456,9 @@ bool UBioAutoConditionals::F454 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1296 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1296 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1296Ref { L"Function PlotManager.BioAutoConditionals.F1296", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1296 )
-		pFnF1296 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1296" );
+	UFunction* const pFnF1296 = pFnF1296Ref.Get ( );
 
 	UBioAutoConditionals_execF1296_Parms F1296_Parms;
 	F1296_Parms.bioWorld = bioWorld;
@@ -5728,10 +5478,9 @@ bool UBioAutoConditionals::F1296 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1262 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1262 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1262Ref { L"Function PlotManager.BioAutoConditionals.F1262", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1262 )
-		pFnF1262 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1262" );
+	UFunction* const pFnF1262 = pFnF1262Ref.Get ( );
 
 	UBioAutoConditionals_execF1262_Parms F1262_Parms;
 	F1262_Parms.bioWorld = bioWorld;
@@ -5751,10 +5500,9 @@ bool UBioAutoConditionals::F1262 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1261 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1261 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1261Ref { L"Function PlotManager.BioAutoConditionals.F1261", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1261 )
-		pFnF1261 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1261" );
+	UFunction* const pFnF1261 = pFnF1261Ref.Get ( );
 
 	UBioAutoConditionals_execF1261_Parms F1261_Parms;
 	F1261_Parms.bioWorld = bioWorld;
@@ -5774,10 +5522,9 @@ bool UBioAutoConditionals::F1261 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1260 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1260 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1260Ref { L"Function PlotManager.BioAutoConditionals.F1260", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1260 )
-		pFnF1260 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1260" );
+	UFunction* const pFnF1260 = pFnF1260Ref.Get ( );
 
 	UBioAutoConditionals_execF1260_Parms F1260_Parms;
 	F1260_Parms.bioWorld = bioWorld;
@@ -5797,10 +5544,9 @@ bool UBioAutoConditionals::F1260 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2013 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2013 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2013Ref { L"Function PlotManager.BioAutoConditionals.F2013", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2013 )
-		pFnF2013 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2013" );
+	UFunction* const pFnF2013 = pFnF2013Ref.Get ( );
 
 	UBioAutoConditionals_execF2013_Parms F2013_Parms;
 	F2013_Parms.bioWorld = bioWorld;
@@ -5820,10 +5566,9 @@ bool UBioAutoConditionals::F2013 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1710 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1710 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1710Ref { L"Function PlotManager.BioAutoConditionals.F1710", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1710 )
-		pFnF1710 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1710" );
+	UFunction* const pFnF1710 = pFnF1710Ref.Get ( );
 
 	UBioAutoConditionals_execF1710_Parms F1710_Parms;
 	F1710_Parms.bioWorld = bioWorld;
@@ -5843,10 +5588,9 @@ bool UBioAutoConditionals::F1710 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1709 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1709 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1709Ref { L"Function PlotManager.BioAutoConditionals.F1709", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1709 )
-		pFnF1709 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1709" );
+	UFunction* const pFnF1709 = pFnF1709Ref.Get ( );
 
 	UBioAutoConditionals_execF1709_Parms F1709_Parms;
 	F1709_Parms.bioWorld = bioWorld;
@@ -5866,10 +5610,9 @@ bool UBioAutoConditionals::F1709 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1708 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1708 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1708Ref { L"Function PlotManager.BioAutoConditionals.F1708", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1708 )
-		pFnF1708 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1708" );
+	UFunction* const pFnF1708 = pFnF1708Ref.Get ( );
 
 	UBioAutoConditionals_execF1708_Parms F1708_Parms;
 	F1708_Parms.bioWorld = bioWorld;
@@ -5889,10 +5632,9 @@ bool UBioAutoConditionals::F1708 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1707 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1707 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1707Ref { L"Function PlotManager.BioAutoConditionals.F1707", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1707 )
-		pFnF1707 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1707" );
+	UFunction* const pFnF1707 = pFnF1707Ref.Get ( );
 
 	UBioAutoConditionals_execF1707_Parms F1707_Parms;
 	F1707_Parms.bioWorld = bioWorld;
@@ -5912,10 +5654,9 @@ bool UBioAutoConditionals::F1707 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1706 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1706 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1706Ref { L"Function PlotManager.BioAutoConditionals.F1706", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1706 )
-		pFnF1706 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1706" );
+	UFunction* const pFnF1706 = pFnF1706Ref.Get ( );
 
 	UBioAutoConditionals_execF1706_Parms F1706_Parms;
 	F1706_Parms.bioWorld = bioWorld;
@@ -5935,10 +5676,9 @@ bool UBioAutoConditionals::F1706 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1705 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1705 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1705Ref { L"Function PlotManager.BioAutoConditionals.F1705", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1705 )
-		pFnF1705 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1705" );
+	UFunction* const pFnF1705 = pFnF1705Ref.Get ( );
 
 	UBioAutoConditionals_execF1705_Parms F1705_Parms;
 	F1705_Parms.bioWorld = bioWorld;
@@ -5958,10 +5698,9 @@ bool UBioAutoConditionals::F1705 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1122 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1122 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1122Ref { L"Function PlotManager.BioAutoConditionals.F1122", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1122 )
-		pFnF1122 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1122" );
+	UFunction* const pFnF1122 = pFnF1122Ref.Get ( );
 
 	UBioAutoConditionals_execF1122_Parms F1122_Parms;
 	F1122_Parms.bioWorld = bioWorld;
@@ -5981,10 +5720,9 @@ bool UBioAutoConditionals::F1122 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1121 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1121 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1121Ref { L"Function PlotManager.BioAutoConditionals.F1121", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1121 )
-		pFnF1121 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1121" );
+	UFunction* const pFnF1121 = pFnF1121Ref.Get ( );
 
 	UBioAutoConditionals_execF1121_Parms F1121_Parms;
 	F1121_Parms.bioWorld = bioWorld;
@@ -6004,10 +5742,9 @@ bool UBioAutoConditionals::F1121 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1120 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1120 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1120Ref { L"Function PlotManager.BioAutoConditionals.F1120", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1120 )
-		pFnF1120 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1120" );
+	UFunction* const pFnF1120 = pFnF1120Ref.Get ( );
 
 	UBioAutoConditionals_execF1120_Parms F1120_Parms;
 	F1120_Parms.bioWorld = bioWorld;
@@ -6027,10 +5764,9 @@ bool UBioAutoConditionals::F1120 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1119 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1119 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1119Ref { L"Function PlotManager.BioAutoConditionals.F1119", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1119 )
-		pFnF1119 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1119" );
+	UFunction* const pFnF1119 = pFnF1119Ref.Get ( );
 
 	UBioAutoConditionals_execF1119_Parms F1119_Parms;
 	F1119_Parms.bioWorld = bioWorld;
@@ -6050,10 +5786,9 @@ bool UBioAutoConditionals::F1119 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1118 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1118 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1118Ref { L"Function PlotManager.BioAutoConditionals.F1118", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1118 )
-		pFnF1118 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1118" );
+	UFunction* const pFnF1118 = pFnF1118Ref.Get ( );
 
 	UBioAutoConditionals_execF1118_Parms F1118_Parms;
 	F1118_Parms.bioWorld = bioWorld;
@@ -6073,10 +5808,9 @@ bool UBioAutoConditionals::F1118 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1117 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1117 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1117Ref { L"Function PlotManager.BioAutoConditionals.F1117", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1117 )
-		pFnF1117 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1117" );
+	UFunction* const pFnF1117 = pFnF1117Ref.Get ( );
 
 	UBioAutoConditionals_execF1117_Parms F1117_Parms;
 	F1117_Parms.bioWorld = bioWorld;
@@ -6096,10 +5830,9 @@ bool UBioAutoConditionals::F1117 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1003 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1003 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1003Ref { L"Function PlotManager.BioAutoConditionals.F1003", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1003 )
-		pFnF1003 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1003" );
+	UFunction* const pFnF1003 = pFnF1003Ref.Get ( );
 
 	UBioAutoConditionals_execF1003_Parms F1003_Parms;
 	F1003_Parms.bioWorld = bioWorld;
@@ -6119,10 +5852,9 @@ bool UBioAutoConditionals::F1003 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F668 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF668 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF668Ref { L"Function PlotManager.BioAutoConditionals.F668", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF668 )
-		pFnF668 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F668" );
+	UFunction* const pFnF668 = pFnF668Ref.Get ( );
 
 	UBioAutoConditionals_execF668_Parms F668_Parms;
 	F668_Parms.bioWorld = bioWorld;
@@ -6142,10 +5874,9 @@ bool UBioAutoConditionals::F668 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F667 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF667 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF667Ref { L"Function PlotManager.BioAutoConditionals.F667", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF667 )
-		pFnF667 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F667" );
+	UFunction* const pFnF667 = pFnF667Ref.Get ( );
 
 	UBioAutoConditionals_execF667_Parms F667_Parms;
 	F667_Parms.bioWorld = bioWorld;
@@ -6165,10 +5896,9 @@ bool UBioAutoConditionals::F667 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F666 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF666 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF666Ref { L"Function PlotManager.BioAutoConditionals.F666", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF666 )
-		pFnF666 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F666" );
+	UFunction* const pFnF666 = pFnF666Ref.Get ( );
 
 	UBioAutoConditionals_execF666_Parms F666_Parms;
 	F666_Parms.bioWorld = bioWorld;
@@ -6188,10 +5918,9 @@ bool UBioAutoConditionals::F666 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F656 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF656 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF656Ref { L"Function PlotManager.BioAutoConditionals.F656", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF656 )
-		pFnF656 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F656" );
+	UFunction* const pFnF656 = pFnF656Ref.Get ( );
 
 	UBioAutoConditionals_execF656_Parms F656_Parms;
 	F656_Parms.bioWorld = bioWorld;
@@ -6211,10 +5940,9 @@ bool UBioAutoConditionals::F656 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F655 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF655 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF655Ref { L"Function PlotManager.BioAutoConditionals.F655", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF655 )
-		pFnF655 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F655" );
+	UFunction* const pFnF655 = pFnF655Ref.Get ( );
 
 	UBioAutoConditionals_execF655_Parms F655_Parms;
 	F655_Parms.bioWorld = bioWorld;
@@ -6234,10 +5962,9 @@ bool UBioAutoConditionals::F655 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F653 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF653 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF653Ref { L"Function PlotManager.BioAutoConditionals.F653", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF653 )
-		pFnF653 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F653" );
+	UFunction* const pFnF653 = pFnF653Ref.Get ( );
 
 	UBioAutoConditionals_execF653_Parms F653_Parms;
 	F653_Parms.bioWorld = bioWorld;
@@ -6257,10 +5984,9 @@ bool UBioAutoConditionals::F653 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F777 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF777 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF777Ref { L"Function PlotManager.BioAutoConditionals.F777", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF777 )
-		pFnF777 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F777" );
+	UFunction* const pFnF777 = pFnF777Ref.Get ( );
 
 	UBioAutoConditionals_execF777_Parms F777_Parms;
 	F777_Parms.bioWorld = bioWorld;
@@ -6280,10 +6006,9 @@ bool UBioAutoConditionals::F777 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F776 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF776 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF776Ref { L"Function PlotManager.BioAutoConditionals.F776", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF776 )
-		pFnF776 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F776" );
+	UFunction* const pFnF776 = pFnF776Ref.Get ( );
 
 	UBioAutoConditionals_execF776_Parms F776_Parms;
 	F776_Parms.bioWorld = bioWorld;
@@ -6303,10 +6028,9 @@ bool UBioAutoConditionals::F776 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1351 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1351 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1351Ref { L"Function PlotManager.BioAutoConditionals.F1351", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1351 )
-		pFnF1351 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1351" );
+	UFunction* const pFnF1351 = pFnF1351Ref.Get ( );
 
 	UBioAutoConditionals_execF1351_Parms F1351_Parms;
 	F1351_Parms.bioWorld = bioWorld;
@@ -6326,10 +6050,9 @@ bool UBioAutoConditionals::F1351 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F531 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF531 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF531Ref { L"Function PlotManager.BioAutoConditionals.F531", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF531 )
-		pFnF531 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F531" );
+	UFunction* const pFnF531 = pFnF531Ref.Get ( );
 
 	UBioAutoConditionals_execF531_Parms F531_Parms;
 	F531_Parms.bioWorld = bioWorld;
@@ -6349,10 +6072,9 @@ bool UBioAutoConditionals::F531 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F440 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF440 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF440Ref { L"Function PlotManager.BioAutoConditionals.F440", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF440 )
-		pFnF440 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F440" );
+	UFunction* const pFnF440 = pFnF440Ref.Get ( );
 
 	UBioAutoConditionals_execF440_Parms F440_Parms;
 	F440_Parms.bioWorld = bioWorld;
@@ -6372,10 +6094,9 @@ bool UBioAutoConditionals::F440 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F438 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF438 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF438Ref { L"Function PlotManager.BioAutoConditionals.F438", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF438 )
-		pFnF438 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F438" );
+	UFunction* const pFnF438 = pFnF438Ref.Get ( );
 
 	UBioAutoConditionals_execF438_Parms F438_Parms;
 	F438_Parms.bioWorld = bioWorld;
@@ -6395,10 +6116,9 @@ bool UBioAutoConditionals::F438 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F657 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF657 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF657Ref { L"Function PlotManager.BioAutoConditionals.F657", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF657 )
-		pFnF657 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F657" );
+	UFunction* const pFnF657 = pFnF657Ref.Get ( );
 
 	UBioAutoConditionals_execF657_Parms F657_Parms;
 	F657_Parms.bioWorld = bioWorld;
@@ -6418,10 +6138,9 @@ bool UBioAutoConditionals::F657 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F311 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF311 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF311Ref { L"Function PlotManager.BioAutoConditionals.F311", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF311 )
-		pFnF311 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F311" );
+	UFunction* const pFnF311 = pFnF311Ref.Get ( );
 
 	UBioAutoConditionals_execF311_Parms F311_Parms;
 	F311_Parms.bioWorld = bioWorld;
@@ -6441,10 +6160,9 @@ bool UBioAutoConditionals::F311 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F654 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF654 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF654Ref { L"Function PlotManager.BioAutoConditionals.F654", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF654 )
-		pFnF654 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F654" );
+	UFunction* const pFnF654 = pFnF654Ref.Get ( );
 
 	UBioAutoConditionals_execF654_Parms F654_Parms;
 	F654_Parms.bioWorld = bioWorld;
@@ -6464,10 +6182,9 @@ bool UBioAutoConditionals::F654 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F652 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF652 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF652Ref { L"Function PlotManager.BioAutoConditionals.F652", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF652 )
-		pFnF652 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F652" );
+	UFunction* const pFnF652 = pFnF652Ref.Get ( );
 
 	UBioAutoConditionals_execF652_Parms F652_Parms;
 	F652_Parms.bioWorld = bioWorld;
@@ -6487,10 +6204,9 @@ bool UBioAutoConditionals::F652 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F712 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF712 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF712Ref { L"Function PlotManager.BioAutoConditionals.F712", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF712 )
-		pFnF712 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F712" );
+	UFunction* const pFnF712 = pFnF712Ref.Get ( );
 
 	UBioAutoConditionals_execF712_Parms F712_Parms;
 	F712_Parms.bioWorld = bioWorld;
@@ -6510,10 +6226,9 @@ bool UBioAutoConditionals::F712 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F711 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF711 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF711Ref { L"Function PlotManager.BioAutoConditionals.F711", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF711 )
-		pFnF711 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F711" );
+	UFunction* const pFnF711 = pFnF711Ref.Get ( );
 
 	UBioAutoConditionals_execF711_Parms F711_Parms;
 	F711_Parms.bioWorld = bioWorld;
@@ -6533,10 +6248,9 @@ bool UBioAutoConditionals::F711 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1323 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1323 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1323Ref { L"Function PlotManager.BioAutoConditionals.F1323", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1323 )
-		pFnF1323 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1323" );
+	UFunction* const pFnF1323 = pFnF1323Ref.Get ( );
 
 	UBioAutoConditionals_execF1323_Parms F1323_Parms;
 	F1323_Parms.bioWorld = bioWorld;
@@ -6556,10 +6270,9 @@ bool UBioAutoConditionals::F1323 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1322 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1322 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1322Ref { L"Function PlotManager.BioAutoConditionals.F1322", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1322 )
-		pFnF1322 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1322" );
+	UFunction* const pFnF1322 = pFnF1322Ref.Get ( );
 
 	UBioAutoConditionals_execF1322_Parms F1322_Parms;
 	F1322_Parms.bioWorld = bioWorld;
@@ -6579,10 +6292,9 @@ bool UBioAutoConditionals::F1322 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1493 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1493 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1493Ref { L"Function PlotManager.BioAutoConditionals.F1493", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1493 )
-		pFnF1493 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1493" );
+	UFunction* const pFnF1493 = pFnF1493Ref.Get ( );
 
 	UBioAutoConditionals_execF1493_Parms F1493_Parms;
 	F1493_Parms.bioWorld = bioWorld;
@@ -6602,10 +6314,9 @@ bool UBioAutoConditionals::F1493 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F663 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF663 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF663Ref { L"Function PlotManager.BioAutoConditionals.F663", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF663 )
-		pFnF663 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F663" );
+	UFunction* const pFnF663 = pFnF663Ref.Get ( );
 
 	UBioAutoConditionals_execF663_Parms F663_Parms;
 	F663_Parms.bioWorld = bioWorld;
@@ -6625,10 +6336,9 @@ bool UBioAutoConditionals::F663 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F660 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF660 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF660Ref { L"Function PlotManager.BioAutoConditionals.F660", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF660 )
-		pFnF660 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F660" );
+	UFunction* const pFnF660 = pFnF660Ref.Get ( );
 
 	UBioAutoConditionals_execF660_Parms F660_Parms;
 	F660_Parms.bioWorld = bioWorld;
@@ -6648,10 +6358,9 @@ bool UBioAutoConditionals::F660 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1670 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1670 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1670Ref { L"Function PlotManager.BioAutoConditionals.F1670", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1670 )
-		pFnF1670 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1670" );
+	UFunction* const pFnF1670 = pFnF1670Ref.Get ( );
 
 	UBioAutoConditionals_execF1670_Parms F1670_Parms;
 	F1670_Parms.bioWorld = bioWorld;
@@ -6671,10 +6380,9 @@ bool UBioAutoConditionals::F1670 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1313 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1313 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1313Ref { L"Function PlotManager.BioAutoConditionals.F1313", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1313 )
-		pFnF1313 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1313" );
+	UFunction* const pFnF1313 = pFnF1313Ref.Get ( );
 
 	UBioAutoConditionals_execF1313_Parms F1313_Parms;
 	F1313_Parms.bioWorld = bioWorld;
@@ -6694,10 +6402,9 @@ bool UBioAutoConditionals::F1313 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1375 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1375 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1375Ref { L"Function PlotManager.BioAutoConditionals.F1375", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1375 )
-		pFnF1375 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1375" );
+	UFunction* const pFnF1375 = pFnF1375Ref.Get ( );
 
 	UBioAutoConditionals_execF1375_Parms F1375_Parms;
 	F1375_Parms.bioWorld = bioWorld;
@@ -6717,10 +6424,9 @@ bool UBioAutoConditionals::F1375 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1360 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1360 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1360Ref { L"Function PlotManager.BioAutoConditionals.F1360", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1360 )
-		pFnF1360 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1360" );
+	UFunction* const pFnF1360 = pFnF1360Ref.Get ( );
 
 	UBioAutoConditionals_execF1360_Parms F1360_Parms;
 	F1360_Parms.bioWorld = bioWorld;
@@ -6740,10 +6446,9 @@ bool UBioAutoConditionals::F1360 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1125 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1125 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1125Ref { L"Function PlotManager.BioAutoConditionals.F1125", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1125 )
-		pFnF1125 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1125" );
+	UFunction* const pFnF1125 = pFnF1125Ref.Get ( );
 
 	UBioAutoConditionals_execF1125_Parms F1125_Parms;
 	F1125_Parms.bioWorld = bioWorld;
@@ -6763,10 +6468,9 @@ bool UBioAutoConditionals::F1125 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1124 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1124 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1124Ref { L"Function PlotManager.BioAutoConditionals.F1124", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1124 )
-		pFnF1124 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1124" );
+	UFunction* const pFnF1124 = pFnF1124Ref.Get ( );
 
 	UBioAutoConditionals_execF1124_Parms F1124_Parms;
 	F1124_Parms.bioWorld = bioWorld;
@@ -6786,10 +6490,9 @@ bool UBioAutoConditionals::F1124 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1045 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1045 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1045Ref { L"Function PlotManager.BioAutoConditionals.F1045", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1045 )
-		pFnF1045 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1045" );
+	UFunction* const pFnF1045 = pFnF1045Ref.Get ( );
 
 	UBioAutoConditionals_execF1045_Parms F1045_Parms;
 	F1045_Parms.bioWorld = bioWorld;
@@ -6809,10 +6512,9 @@ bool UBioAutoConditionals::F1045 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1026 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1026 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1026Ref { L"Function PlotManager.BioAutoConditionals.F1026", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1026 )
-		pFnF1026 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1026" );
+	UFunction* const pFnF1026 = pFnF1026Ref.Get ( );
 
 	UBioAutoConditionals_execF1026_Parms F1026_Parms;
 	F1026_Parms.bioWorld = bioWorld;
@@ -6832,10 +6534,9 @@ bool UBioAutoConditionals::F1026 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1022 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1022 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1022Ref { L"Function PlotManager.BioAutoConditionals.F1022", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1022 )
-		pFnF1022 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1022" );
+	UFunction* const pFnF1022 = pFnF1022Ref.Get ( );
 
 	UBioAutoConditionals_execF1022_Parms F1022_Parms;
 	F1022_Parms.bioWorld = bioWorld;
@@ -6855,10 +6556,9 @@ bool UBioAutoConditionals::F1022 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1021 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1021 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1021Ref { L"Function PlotManager.BioAutoConditionals.F1021", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1021 )
-		pFnF1021 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1021" );
+	UFunction* const pFnF1021 = pFnF1021Ref.Get ( );
 
 	UBioAutoConditionals_execF1021_Parms F1021_Parms;
 	F1021_Parms.bioWorld = bioWorld;
@@ -6878,10 +6578,9 @@ bool UBioAutoConditionals::F1021 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F705 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF705 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF705Ref { L"Function PlotManager.BioAutoConditionals.F705", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF705 )
-		pFnF705 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F705" );
+	UFunction* const pFnF705 = pFnF705Ref.Get ( );
 
 	UBioAutoConditionals_execF705_Parms F705_Parms;
 	F705_Parms.bioWorld = bioWorld;
@@ -6901,10 +6600,9 @@ bool UBioAutoConditionals::F705 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F432 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF432 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF432Ref { L"Function PlotManager.BioAutoConditionals.F432", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF432 )
-		pFnF432 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F432" );
+	UFunction* const pFnF432 = pFnF432Ref.Get ( );
 
 	UBioAutoConditionals_execF432_Parms F432_Parms;
 	F432_Parms.bioWorld = bioWorld;
@@ -6924,10 +6622,9 @@ bool UBioAutoConditionals::F432 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F436 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF436 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF436Ref { L"Function PlotManager.BioAutoConditionals.F436", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF436 )
-		pFnF436 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F436" );
+	UFunction* const pFnF436 = pFnF436Ref.Get ( );
 
 	UBioAutoConditionals_execF436_Parms F436_Parms;
 	F436_Parms.bioWorld = bioWorld;
@@ -6947,10 +6644,9 @@ bool UBioAutoConditionals::F436 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F433 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF433 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF433Ref { L"Function PlotManager.BioAutoConditionals.F433", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF433 )
-		pFnF433 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F433" );
+	UFunction* const pFnF433 = pFnF433Ref.Get ( );
 
 	UBioAutoConditionals_execF433_Parms F433_Parms;
 	F433_Parms.bioWorld = bioWorld;
@@ -6970,10 +6666,9 @@ bool UBioAutoConditionals::F433 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F373 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF373 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF373Ref { L"Function PlotManager.BioAutoConditionals.F373", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF373 )
-		pFnF373 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F373" );
+	UFunction* const pFnF373 = pFnF373Ref.Get ( );
 
 	UBioAutoConditionals_execF373_Parms F373_Parms;
 	F373_Parms.bioWorld = bioWorld;
@@ -6993,10 +6688,9 @@ bool UBioAutoConditionals::F373 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F372 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF372 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF372Ref { L"Function PlotManager.BioAutoConditionals.F372", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF372 )
-		pFnF372 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F372" );
+	UFunction* const pFnF372 = pFnF372Ref.Get ( );
 
 	UBioAutoConditionals_execF372_Parms F372_Parms;
 	F372_Parms.bioWorld = bioWorld;
@@ -7016,10 +6710,9 @@ bool UBioAutoConditionals::F372 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F371 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF371 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF371Ref { L"Function PlotManager.BioAutoConditionals.F371", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF371 )
-		pFnF371 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F371" );
+	UFunction* const pFnF371 = pFnF371Ref.Get ( );
 
 	UBioAutoConditionals_execF371_Parms F371_Parms;
 	F371_Parms.bioWorld = bioWorld;
@@ -7039,10 +6732,9 @@ bool UBioAutoConditionals::F371 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F359 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF359 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF359Ref { L"Function PlotManager.BioAutoConditionals.F359", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF359 )
-		pFnF359 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F359" );
+	UFunction* const pFnF359 = pFnF359Ref.Get ( );
 
 	UBioAutoConditionals_execF359_Parms F359_Parms;
 	F359_Parms.bioWorld = bioWorld;
@@ -7062,10 +6754,9 @@ bool UBioAutoConditionals::F359 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F358 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF358 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF358Ref { L"Function PlotManager.BioAutoConditionals.F358", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF358 )
-		pFnF358 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F358" );
+	UFunction* const pFnF358 = pFnF358Ref.Get ( );
 
 	UBioAutoConditionals_execF358_Parms F358_Parms;
 	F358_Parms.bioWorld = bioWorld;
@@ -7085,10 +6776,9 @@ bool UBioAutoConditionals::F358 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1352 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1352 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1352Ref { L"Function PlotManager.BioAutoConditionals.F1352", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1352 )
-		pFnF1352 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1352" );
+	UFunction* const pFnF1352 = pFnF1352Ref.Get ( );
 
 	UBioAutoConditionals_execF1352_Parms F1352_Parms;
 	F1352_Parms.bioWorld = bioWorld;
@@ -7108,10 +6798,9 @@ bool UBioAutoConditionals::F1352 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1740 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1740 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1740Ref { L"Function PlotManager.BioAutoConditionals.F1740", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1740 )
-		pFnF1740 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1740" );
+	UFunction* const pFnF1740 = pFnF1740Ref.Get ( );
 
 	UBioAutoConditionals_execF1740_Parms F1740_Parms;
 	F1740_Parms.bioWorld = bioWorld;
@@ -7131,10 +6820,9 @@ bool UBioAutoConditionals::F1740 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1556 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1556 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1556Ref { L"Function PlotManager.BioAutoConditionals.F1556", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1556 )
-		pFnF1556 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1556" );
+	UFunction* const pFnF1556 = pFnF1556Ref.Get ( );
 
 	UBioAutoConditionals_execF1556_Parms F1556_Parms;
 	F1556_Parms.bioWorld = bioWorld;
@@ -7154,10 +6842,9 @@ bool UBioAutoConditionals::F1556 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1555 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1555 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1555Ref { L"Function PlotManager.BioAutoConditionals.F1555", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1555 )
-		pFnF1555 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1555" );
+	UFunction* const pFnF1555 = pFnF1555Ref.Get ( );
 
 	UBioAutoConditionals_execF1555_Parms F1555_Parms;
 	F1555_Parms.bioWorld = bioWorld;
@@ -7177,10 +6864,9 @@ bool UBioAutoConditionals::F1555 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1550 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1550 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1550Ref { L"Function PlotManager.BioAutoConditionals.F1550", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1550 )
-		pFnF1550 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1550" );
+	UFunction* const pFnF1550 = pFnF1550Ref.Get ( );
 
 	UBioAutoConditionals_execF1550_Parms F1550_Parms;
 	F1550_Parms.bioWorld = bioWorld;
@@ -7200,10 +6886,9 @@ bool UBioAutoConditionals::F1550 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1481 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1481 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1481Ref { L"Function PlotManager.BioAutoConditionals.F1481", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1481 )
-		pFnF1481 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1481" );
+	UFunction* const pFnF1481 = pFnF1481Ref.Get ( );
 
 	UBioAutoConditionals_execF1481_Parms F1481_Parms;
 	F1481_Parms.bioWorld = bioWorld;
@@ -7223,10 +6908,9 @@ bool UBioAutoConditionals::F1481 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1379 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1379 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1379Ref { L"Function PlotManager.BioAutoConditionals.F1379", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1379 )
-		pFnF1379 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1379" );
+	UFunction* const pFnF1379 = pFnF1379Ref.Get ( );
 
 	UBioAutoConditionals_execF1379_Parms F1379_Parms;
 	F1379_Parms.bioWorld = bioWorld;
@@ -7246,10 +6930,9 @@ bool UBioAutoConditionals::F1379 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1338 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1338 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1338Ref { L"Function PlotManager.BioAutoConditionals.F1338", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1338 )
-		pFnF1338 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1338" );
+	UFunction* const pFnF1338 = pFnF1338Ref.Get ( );
 
 	UBioAutoConditionals_execF1338_Parms F1338_Parms;
 	F1338_Parms.bioWorld = bioWorld;
@@ -7269,10 +6952,9 @@ bool UBioAutoConditionals::F1338 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1320 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1320 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1320Ref { L"Function PlotManager.BioAutoConditionals.F1320", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1320 )
-		pFnF1320 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1320" );
+	UFunction* const pFnF1320 = pFnF1320Ref.Get ( );
 
 	UBioAutoConditionals_execF1320_Parms F1320_Parms;
 	F1320_Parms.bioWorld = bioWorld;
@@ -7292,10 +6974,9 @@ bool UBioAutoConditionals::F1320 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1055 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1055 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1055Ref { L"Function PlotManager.BioAutoConditionals.F1055", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1055 )
-		pFnF1055 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1055" );
+	UFunction* const pFnF1055 = pFnF1055Ref.Get ( );
 
 	UBioAutoConditionals_execF1055_Parms F1055_Parms;
 	F1055_Parms.bioWorld = bioWorld;
@@ -7315,10 +6996,9 @@ bool UBioAutoConditionals::F1055 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1054 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1054 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1054Ref { L"Function PlotManager.BioAutoConditionals.F1054", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1054 )
-		pFnF1054 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1054" );
+	UFunction* const pFnF1054 = pFnF1054Ref.Get ( );
 
 	UBioAutoConditionals_execF1054_Parms F1054_Parms;
 	F1054_Parms.bioWorld = bioWorld;
@@ -7338,10 +7018,9 @@ bool UBioAutoConditionals::F1054 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1029 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1029 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1029Ref { L"Function PlotManager.BioAutoConditionals.F1029", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1029 )
-		pFnF1029 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1029" );
+	UFunction* const pFnF1029 = pFnF1029Ref.Get ( );
 
 	UBioAutoConditionals_execF1029_Parms F1029_Parms;
 	F1029_Parms.bioWorld = bioWorld;
@@ -7361,10 +7040,9 @@ bool UBioAutoConditionals::F1029 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F767 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF767 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF767Ref { L"Function PlotManager.BioAutoConditionals.F767", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF767 )
-		pFnF767 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F767" );
+	UFunction* const pFnF767 = pFnF767Ref.Get ( );
 
 	UBioAutoConditionals_execF767_Parms F767_Parms;
 	F767_Parms.bioWorld = bioWorld;
@@ -7384,10 +7062,9 @@ bool UBioAutoConditionals::F767 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F700 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF700 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF700Ref { L"Function PlotManager.BioAutoConditionals.F700", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF700 )
-		pFnF700 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F700" );
+	UFunction* const pFnF700 = pFnF700Ref.Get ( );
 
 	UBioAutoConditionals_execF700_Parms F700_Parms;
 	F700_Parms.bioWorld = bioWorld;
@@ -7407,10 +7084,9 @@ bool UBioAutoConditionals::F700 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F532 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF532 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF532Ref { L"Function PlotManager.BioAutoConditionals.F532", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF532 )
-		pFnF532 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F532" );
+	UFunction* const pFnF532 = pFnF532Ref.Get ( );
 
 	UBioAutoConditionals_execF532_Parms F532_Parms;
 	F532_Parms.bioWorld = bioWorld;
@@ -7430,10 +7106,9 @@ bool UBioAutoConditionals::F532 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F443 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF443 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF443Ref { L"Function PlotManager.BioAutoConditionals.F443", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF443 )
-		pFnF443 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F443" );
+	UFunction* const pFnF443 = pFnF443Ref.Get ( );
 
 	UBioAutoConditionals_execF443_Parms F443_Parms;
 	F443_Parms.bioWorld = bioWorld;
@@ -7453,10 +7128,9 @@ bool UBioAutoConditionals::F443 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F404 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF404 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF404Ref { L"Function PlotManager.BioAutoConditionals.F404", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF404 )
-		pFnF404 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F404" );
+	UFunction* const pFnF404 = pFnF404Ref.Get ( );
 
 	UBioAutoConditionals_execF404_Parms F404_Parms;
 	F404_Parms.bioWorld = bioWorld;
@@ -7476,10 +7150,9 @@ bool UBioAutoConditionals::F404 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F401 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF401 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF401Ref { L"Function PlotManager.BioAutoConditionals.F401", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF401 )
-		pFnF401 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F401" );
+	UFunction* const pFnF401 = pFnF401Ref.Get ( );
 
 	UBioAutoConditionals_execF401_Parms F401_Parms;
 	F401_Parms.bioWorld = bioWorld;
@@ -7499,10 +7172,9 @@ bool UBioAutoConditionals::F401 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F400 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF400 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF400Ref { L"Function PlotManager.BioAutoConditionals.F400", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF400 )
-		pFnF400 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F400" );
+	UFunction* const pFnF400 = pFnF400Ref.Get ( );
 
 	UBioAutoConditionals_execF400_Parms F400_Parms;
 	F400_Parms.bioWorld = bioWorld;
@@ -7522,10 +7194,9 @@ bool UBioAutoConditionals::F400 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F376 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF376 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF376Ref { L"Function PlotManager.BioAutoConditionals.F376", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF376 )
-		pFnF376 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F376" );
+	UFunction* const pFnF376 = pFnF376Ref.Get ( );
 
 	UBioAutoConditionals_execF376_Parms F376_Parms;
 	F376_Parms.bioWorld = bioWorld;
@@ -7545,10 +7216,9 @@ bool UBioAutoConditionals::F376 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F363 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF363 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF363Ref { L"Function PlotManager.BioAutoConditionals.F363", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF363 )
-		pFnF363 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F363" );
+	UFunction* const pFnF363 = pFnF363Ref.Get ( );
 
 	UBioAutoConditionals_execF363_Parms F363_Parms;
 	F363_Parms.bioWorld = bioWorld;
@@ -7568,10 +7238,9 @@ bool UBioAutoConditionals::F363 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F361 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF361 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF361Ref { L"Function PlotManager.BioAutoConditionals.F361", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF361 )
-		pFnF361 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F361" );
+	UFunction* const pFnF361 = pFnF361Ref.Get ( );
 
 	UBioAutoConditionals_execF361_Parms F361_Parms;
 	F361_Parms.bioWorld = bioWorld;
@@ -7591,10 +7260,9 @@ bool UBioAutoConditionals::F361 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F774 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF774 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF774Ref { L"Function PlotManager.BioAutoConditionals.F774", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF774 )
-		pFnF774 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F774" );
+	UFunction* const pFnF774 = pFnF774Ref.Get ( );
 
 	UBioAutoConditionals_execF774_Parms F774_Parms;
 	F774_Parms.bioWorld = bioWorld;
@@ -7614,10 +7282,9 @@ bool UBioAutoConditionals::F774 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F772 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF772 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF772Ref { L"Function PlotManager.BioAutoConditionals.F772", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF772 )
-		pFnF772 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F772" );
+	UFunction* const pFnF772 = pFnF772Ref.Get ( );
 
 	UBioAutoConditionals_execF772_Parms F772_Parms;
 	F772_Parms.bioWorld = bioWorld;
@@ -7637,10 +7304,9 @@ bool UBioAutoConditionals::F772 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F516 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF516 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF516Ref { L"Function PlotManager.BioAutoConditionals.F516", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF516 )
-		pFnF516 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F516" );
+	UFunction* const pFnF516 = pFnF516Ref.Get ( );
 
 	UBioAutoConditionals_execF516_Parms F516_Parms;
 	F516_Parms.bioWorld = bioWorld;
@@ -7660,10 +7326,9 @@ bool UBioAutoConditionals::F516 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F515 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF515 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF515Ref { L"Function PlotManager.BioAutoConditionals.F515", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF515 )
-		pFnF515 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F515" );
+	UFunction* const pFnF515 = pFnF515Ref.Get ( );
 
 	UBioAutoConditionals_execF515_Parms F515_Parms;
 	F515_Parms.bioWorld = bioWorld;
@@ -7683,10 +7348,9 @@ bool UBioAutoConditionals::F515 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F402 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF402 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF402Ref { L"Function PlotManager.BioAutoConditionals.F402", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF402 )
-		pFnF402 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F402" );
+	UFunction* const pFnF402 = pFnF402Ref.Get ( );
 
 	UBioAutoConditionals_execF402_Parms F402_Parms;
 	F402_Parms.bioWorld = bioWorld;
@@ -7706,10 +7370,9 @@ bool UBioAutoConditionals::F402 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F343 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF343 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF343Ref { L"Function PlotManager.BioAutoConditionals.F343", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF343 )
-		pFnF343 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F343" );
+	UFunction* const pFnF343 = pFnF343Ref.Get ( );
 
 	UBioAutoConditionals_execF343_Parms F343_Parms;
 	F343_Parms.bioWorld = bioWorld;
@@ -7729,10 +7392,9 @@ bool UBioAutoConditionals::F343 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F341 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF341 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF341Ref { L"Function PlotManager.BioAutoConditionals.F341", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF341 )
-		pFnF341 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F341" );
+	UFunction* const pFnF341 = pFnF341Ref.Get ( );
 
 	UBioAutoConditionals_execF341_Parms F341_Parms;
 	F341_Parms.bioWorld = bioWorld;
@@ -7752,10 +7414,9 @@ bool UBioAutoConditionals::F341 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F340 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF340 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF340Ref { L"Function PlotManager.BioAutoConditionals.F340", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF340 )
-		pFnF340 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F340" );
+	UFunction* const pFnF340 = pFnF340Ref.Get ( );
 
 	UBioAutoConditionals_execF340_Parms F340_Parms;
 	F340_Parms.bioWorld = bioWorld;
@@ -7775,10 +7436,9 @@ bool UBioAutoConditionals::F340 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F327 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF327 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF327Ref { L"Function PlotManager.BioAutoConditionals.F327", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF327 )
-		pFnF327 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F327" );
+	UFunction* const pFnF327 = pFnF327Ref.Get ( );
 
 	UBioAutoConditionals_execF327_Parms F327_Parms;
 	F327_Parms.bioWorld = bioWorld;
@@ -7798,10 +7458,9 @@ bool UBioAutoConditionals::F327 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1750 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1750 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1750Ref { L"Function PlotManager.BioAutoConditionals.F1750", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1750 )
-		pFnF1750 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1750" );
+	UFunction* const pFnF1750 = pFnF1750Ref.Get ( );
 
 	UBioAutoConditionals_execF1750_Parms F1750_Parms;
 	F1750_Parms.bioWorld = bioWorld;
@@ -7821,10 +7480,9 @@ bool UBioAutoConditionals::F1750 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1554 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1554 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1554Ref { L"Function PlotManager.BioAutoConditionals.F1554", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1554 )
-		pFnF1554 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1554" );
+	UFunction* const pFnF1554 = pFnF1554Ref.Get ( );
 
 	UBioAutoConditionals_execF1554_Parms F1554_Parms;
 	F1554_Parms.bioWorld = bioWorld;
@@ -7844,10 +7502,9 @@ bool UBioAutoConditionals::F1554 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F771 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF771 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF771Ref { L"Function PlotManager.BioAutoConditionals.F771", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF771 )
-		pFnF771 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F771" );
+	UFunction* const pFnF771 = pFnF771Ref.Get ( );
 
 	UBioAutoConditionals_execF771_Parms F771_Parms;
 	F771_Parms.bioWorld = bioWorld;
@@ -7867,10 +7524,9 @@ bool UBioAutoConditionals::F771 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F426 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF426 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF426Ref { L"Function PlotManager.BioAutoConditionals.F426", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF426 )
-		pFnF426 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F426" );
+	UFunction* const pFnF426 = pFnF426Ref.Get ( );
 
 	UBioAutoConditionals_execF426_Parms F426_Parms;
 	F426_Parms.bioWorld = bioWorld;
@@ -7890,10 +7546,9 @@ bool UBioAutoConditionals::F426 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F407 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF407 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF407Ref { L"Function PlotManager.BioAutoConditionals.F407", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF407 )
-		pFnF407 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F407" );
+	UFunction* const pFnF407 = pFnF407Ref.Get ( );
 
 	UBioAutoConditionals_execF407_Parms F407_Parms;
 	F407_Parms.bioWorld = bioWorld;
@@ -7913,10 +7568,9 @@ bool UBioAutoConditionals::F407 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F388 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF388 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF388Ref { L"Function PlotManager.BioAutoConditionals.F388", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF388 )
-		pFnF388 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F388" );
+	UFunction* const pFnF388 = pFnF388Ref.Get ( );
 
 	UBioAutoConditionals_execF388_Parms F388_Parms;
 	F388_Parms.bioWorld = bioWorld;
@@ -7936,10 +7590,9 @@ bool UBioAutoConditionals::F388 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F387 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF387 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF387Ref { L"Function PlotManager.BioAutoConditionals.F387", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF387 )
-		pFnF387 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F387" );
+	UFunction* const pFnF387 = pFnF387Ref.Get ( );
 
 	UBioAutoConditionals_execF387_Parms F387_Parms;
 	F387_Parms.bioWorld = bioWorld;
@@ -7959,10 +7612,9 @@ bool UBioAutoConditionals::F387 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F386 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF386 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF386Ref { L"Function PlotManager.BioAutoConditionals.F386", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF386 )
-		pFnF386 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F386" );
+	UFunction* const pFnF386 = pFnF386Ref.Get ( );
 
 	UBioAutoConditionals_execF386_Parms F386_Parms;
 	F386_Parms.bioWorld = bioWorld;
@@ -7982,10 +7634,9 @@ bool UBioAutoConditionals::F386 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F385 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF385 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF385Ref { L"Function PlotManager.BioAutoConditionals.F385", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF385 )
-		pFnF385 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F385" );
+	UFunction* const pFnF385 = pFnF385Ref.Get ( );
 
 	UBioAutoConditionals_execF385_Parms F385_Parms;
 	F385_Parms.bioWorld = bioWorld;
@@ -8005,10 +7656,9 @@ bool UBioAutoConditionals::F385 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F384 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF384 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF384Ref { L"Function PlotManager.BioAutoConditionals.F384", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF384 )
-		pFnF384 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F384" );
+	UFunction* const pFnF384 = pFnF384Ref.Get ( );
 
 	UBioAutoConditionals_execF384_Parms F384_Parms;
 	F384_Parms.bioWorld = bioWorld;
@@ -8028,10 +7678,9 @@ bool UBioAutoConditionals::F384 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F382 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF382 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF382Ref { L"Function PlotManager.BioAutoConditionals.F382", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF382 )
-		pFnF382 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F382" );
+	UFunction* const pFnF382 = pFnF382Ref.Get ( );
 
 	UBioAutoConditionals_execF382_Parms F382_Parms;
 	F382_Parms.bioWorld = bioWorld;
@@ -8051,10 +7700,9 @@ bool UBioAutoConditionals::F382 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F381 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF381 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF381Ref { L"Function PlotManager.BioAutoConditionals.F381", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF381 )
-		pFnF381 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F381" );
+	UFunction* const pFnF381 = pFnF381Ref.Get ( );
 
 	UBioAutoConditionals_execF381_Parms F381_Parms;
 	F381_Parms.bioWorld = bioWorld;
@@ -8074,10 +7722,9 @@ bool UBioAutoConditionals::F381 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F380 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF380 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF380Ref { L"Function PlotManager.BioAutoConditionals.F380", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF380 )
-		pFnF380 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F380" );
+	UFunction* const pFnF380 = pFnF380Ref.Get ( );
 
 	UBioAutoConditionals_execF380_Parms F380_Parms;
 	F380_Parms.bioWorld = bioWorld;
@@ -8097,10 +7744,9 @@ bool UBioAutoConditionals::F380 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F339 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF339 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF339Ref { L"Function PlotManager.BioAutoConditionals.F339", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF339 )
-		pFnF339 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F339" );
+	UFunction* const pFnF339 = pFnF339Ref.Get ( );
 
 	UBioAutoConditionals_execF339_Parms F339_Parms;
 	F339_Parms.bioWorld = bioWorld;
@@ -8120,10 +7766,9 @@ bool UBioAutoConditionals::F339 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F328 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF328 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF328Ref { L"Function PlotManager.BioAutoConditionals.F328", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF328 )
-		pFnF328 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F328" );
+	UFunction* const pFnF328 = pFnF328Ref.Get ( );
 
 	UBioAutoConditionals_execF328_Parms F328_Parms;
 	F328_Parms.bioWorld = bioWorld;
@@ -8143,10 +7788,9 @@ bool UBioAutoConditionals::F328 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1646 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1646 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1646Ref { L"Function PlotManager.BioAutoConditionals.F1646", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1646 )
-		pFnF1646 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1646" );
+	UFunction* const pFnF1646 = pFnF1646Ref.Get ( );
 
 	UBioAutoConditionals_execF1646_Parms F1646_Parms;
 	F1646_Parms.bioWorld = bioWorld;
@@ -8166,10 +7810,9 @@ bool UBioAutoConditionals::F1646 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1645 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1645 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1645Ref { L"Function PlotManager.BioAutoConditionals.F1645", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1645 )
-		pFnF1645 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1645" );
+	UFunction* const pFnF1645 = pFnF1645Ref.Get ( );
 
 	UBioAutoConditionals_execF1645_Parms F1645_Parms;
 	F1645_Parms.bioWorld = bioWorld;
@@ -8189,10 +7832,9 @@ bool UBioAutoConditionals::F1645 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1737 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1737 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1737Ref { L"Function PlotManager.BioAutoConditionals.F1737", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1737 )
-		pFnF1737 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1737" );
+	UFunction* const pFnF1737 = pFnF1737Ref.Get ( );
 
 	UBioAutoConditionals_execF1737_Parms F1737_Parms;
 	F1737_Parms.bioWorld = bioWorld;
@@ -8212,10 +7854,9 @@ bool UBioAutoConditionals::F1737 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1736 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1736 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1736Ref { L"Function PlotManager.BioAutoConditionals.F1736", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1736 )
-		pFnF1736 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1736" );
+	UFunction* const pFnF1736 = pFnF1736Ref.Get ( );
 
 	UBioAutoConditionals_execF1736_Parms F1736_Parms;
 	F1736_Parms.bioWorld = bioWorld;
@@ -8235,10 +7876,9 @@ bool UBioAutoConditionals::F1736 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1173 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1173 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1173Ref { L"Function PlotManager.BioAutoConditionals.F1173", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1173 )
-		pFnF1173 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1173" );
+	UFunction* const pFnF1173 = pFnF1173Ref.Get ( );
 
 	UBioAutoConditionals_execF1173_Parms F1173_Parms;
 	F1173_Parms.bioWorld = bioWorld;
@@ -8258,10 +7898,9 @@ bool UBioAutoConditionals::F1173 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1172 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1172 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1172Ref { L"Function PlotManager.BioAutoConditionals.F1172", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1172 )
-		pFnF1172 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1172" );
+	UFunction* const pFnF1172 = pFnF1172Ref.Get ( );
 
 	UBioAutoConditionals_execF1172_Parms F1172_Parms;
 	F1172_Parms.bioWorld = bioWorld;
@@ -8281,10 +7920,9 @@ bool UBioAutoConditionals::F1172 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1703 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1703 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1703Ref { L"Function PlotManager.BioAutoConditionals.F1703", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1703 )
-		pFnF1703 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1703" );
+	UFunction* const pFnF1703 = pFnF1703Ref.Get ( );
 
 	UBioAutoConditionals_execF1703_Parms F1703_Parms;
 	F1703_Parms.bioWorld = bioWorld;
@@ -8304,10 +7942,9 @@ bool UBioAutoConditionals::F1703 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1658 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1658 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1658Ref { L"Function PlotManager.BioAutoConditionals.F1658", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1658 )
-		pFnF1658 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1658" );
+	UFunction* const pFnF1658 = pFnF1658Ref.Get ( );
 
 	UBioAutoConditionals_execF1658_Parms F1658_Parms;
 	F1658_Parms.bioWorld = bioWorld;
@@ -8327,10 +7964,9 @@ bool UBioAutoConditionals::F1658 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1247 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1247 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1247Ref { L"Function PlotManager.BioAutoConditionals.F1247", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1247 )
-		pFnF1247 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1247" );
+	UFunction* const pFnF1247 = pFnF1247Ref.Get ( );
 
 	UBioAutoConditionals_execF1247_Parms F1247_Parms;
 	F1247_Parms.bioWorld = bioWorld;
@@ -8350,10 +7986,9 @@ bool UBioAutoConditionals::F1247 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1246 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1246 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1246Ref { L"Function PlotManager.BioAutoConditionals.F1246", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1246 )
-		pFnF1246 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1246" );
+	UFunction* const pFnF1246 = pFnF1246Ref.Get ( );
 
 	UBioAutoConditionals_execF1246_Parms F1246_Parms;
 	F1246_Parms.bioWorld = bioWorld;
@@ -8373,10 +8008,9 @@ bool UBioAutoConditionals::F1246 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1245 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1245 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1245Ref { L"Function PlotManager.BioAutoConditionals.F1245", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1245 )
-		pFnF1245 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1245" );
+	UFunction* const pFnF1245 = pFnF1245Ref.Get ( );
 
 	UBioAutoConditionals_execF1245_Parms F1245_Parms;
 	F1245_Parms.bioWorld = bioWorld;
@@ -8396,10 +8030,9 @@ bool UBioAutoConditionals::F1245 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1745 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1745 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1745Ref { L"Function PlotManager.BioAutoConditionals.F1745", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1745 )
-		pFnF1745 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1745" );
+	UFunction* const pFnF1745 = pFnF1745Ref.Get ( );
 
 	UBioAutoConditionals_execF1745_Parms F1745_Parms;
 	F1745_Parms.bioWorld = bioWorld;
@@ -8419,10 +8052,9 @@ bool UBioAutoConditionals::F1745 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1739 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1739 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1739Ref { L"Function PlotManager.BioAutoConditionals.F1739", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1739 )
-		pFnF1739 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1739" );
+	UFunction* const pFnF1739 = pFnF1739Ref.Get ( );
 
 	UBioAutoConditionals_execF1739_Parms F1739_Parms;
 	F1739_Parms.bioWorld = bioWorld;
@@ -8442,10 +8074,9 @@ bool UBioAutoConditionals::F1739 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1738 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1738 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1738Ref { L"Function PlotManager.BioAutoConditionals.F1738", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1738 )
-		pFnF1738 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1738" );
+	UFunction* const pFnF1738 = pFnF1738Ref.Get ( );
 
 	UBioAutoConditionals_execF1738_Parms F1738_Parms;
 	F1738_Parms.bioWorld = bioWorld;
@@ -8465,10 +8096,9 @@ bool UBioAutoConditionals::F1738 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1386 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1386 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1386Ref { L"Function PlotManager.BioAutoConditionals.F1386", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1386 )
-		pFnF1386 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1386" );
+	UFunction* const pFnF1386 = pFnF1386Ref.Get ( );
 
 	UBioAutoConditionals_execF1386_Parms F1386_Parms;
 	F1386_Parms.bioWorld = bioWorld;
@@ -8488,10 +8118,9 @@ bool UBioAutoConditionals::F1386 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F681 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF681 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF681Ref { L"Function PlotManager.BioAutoConditionals.F681", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF681 )
-		pFnF681 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F681" );
+	UFunction* const pFnF681 = pFnF681Ref.Get ( );
 
 	UBioAutoConditionals_execF681_Parms F681_Parms;
 	F681_Parms.bioWorld = bioWorld;
@@ -8511,10 +8140,9 @@ bool UBioAutoConditionals::F681 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F680 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF680 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF680Ref { L"Function PlotManager.BioAutoConditionals.F680", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF680 )
-		pFnF680 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F680" );
+	UFunction* const pFnF680 = pFnF680Ref.Get ( );
 
 	UBioAutoConditionals_execF680_Parms F680_Parms;
 	F680_Parms.bioWorld = bioWorld;
@@ -8534,10 +8162,9 @@ bool UBioAutoConditionals::F680 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1618 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1618 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1618Ref { L"Function PlotManager.BioAutoConditionals.F1618", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1618 )
-		pFnF1618 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1618" );
+	UFunction* const pFnF1618 = pFnF1618Ref.Get ( );
 
 	UBioAutoConditionals_execF1618_Parms F1618_Parms;
 	F1618_Parms.bioWorld = bioWorld;
@@ -8557,10 +8184,9 @@ bool UBioAutoConditionals::F1618 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1617 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1617 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1617Ref { L"Function PlotManager.BioAutoConditionals.F1617", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1617 )
-		pFnF1617 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1617" );
+	UFunction* const pFnF1617 = pFnF1617Ref.Get ( );
 
 	UBioAutoConditionals_execF1617_Parms F1617_Parms;
 	F1617_Parms.bioWorld = bioWorld;
@@ -8580,10 +8206,9 @@ bool UBioAutoConditionals::F1617 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1576 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1576 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1576Ref { L"Function PlotManager.BioAutoConditionals.F1576", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1576 )
-		pFnF1576 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1576" );
+	UFunction* const pFnF1576 = pFnF1576Ref.Get ( );
 
 	UBioAutoConditionals_execF1576_Parms F1576_Parms;
 	F1576_Parms.bioWorld = bioWorld;
@@ -8603,10 +8228,9 @@ bool UBioAutoConditionals::F1576 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1340 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1340 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1340Ref { L"Function PlotManager.BioAutoConditionals.F1340", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1340 )
-		pFnF1340 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1340" );
+	UFunction* const pFnF1340 = pFnF1340Ref.Get ( );
 
 	UBioAutoConditionals_execF1340_Parms F1340_Parms;
 	F1340_Parms.bioWorld = bioWorld;
@@ -8626,10 +8250,9 @@ bool UBioAutoConditionals::F1340 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F685 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF685 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF685Ref { L"Function PlotManager.BioAutoConditionals.F685", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF685 )
-		pFnF685 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F685" );
+	UFunction* const pFnF685 = pFnF685Ref.Get ( );
 
 	UBioAutoConditionals_execF685_Parms F685_Parms;
 	F685_Parms.bioWorld = bioWorld;
@@ -8649,10 +8272,9 @@ bool UBioAutoConditionals::F685 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F412 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF412 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF412Ref { L"Function PlotManager.BioAutoConditionals.F412", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF412 )
-		pFnF412 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F412" );
+	UFunction* const pFnF412 = pFnF412Ref.Get ( );
 
 	UBioAutoConditionals_execF412_Parms F412_Parms;
 	F412_Parms.bioWorld = bioWorld;
@@ -8672,10 +8294,9 @@ bool UBioAutoConditionals::F412 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F410 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF410 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF410Ref { L"Function PlotManager.BioAutoConditionals.F410", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF410 )
-		pFnF410 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F410" );
+	UFunction* const pFnF410 = pFnF410Ref.Get ( );
 
 	UBioAutoConditionals_execF410_Parms F410_Parms;
 	F410_Parms.bioWorld = bioWorld;
@@ -8695,10 +8316,9 @@ bool UBioAutoConditionals::F410 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F409 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF409 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF409Ref { L"Function PlotManager.BioAutoConditionals.F409", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF409 )
-		pFnF409 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F409" );
+	UFunction* const pFnF409 = pFnF409Ref.Get ( );
 
 	UBioAutoConditionals_execF409_Parms F409_Parms;
 	F409_Parms.bioWorld = bioWorld;
@@ -8718,10 +8338,9 @@ bool UBioAutoConditionals::F409 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F408 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF408 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF408Ref { L"Function PlotManager.BioAutoConditionals.F408", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF408 )
-		pFnF408 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F408" );
+	UFunction* const pFnF408 = pFnF408Ref.Get ( );
 
 	UBioAutoConditionals_execF408_Parms F408_Parms;
 	F408_Parms.bioWorld = bioWorld;
@@ -8741,10 +8360,9 @@ bool UBioAutoConditionals::F408 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F405 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF405 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF405Ref { L"Function PlotManager.BioAutoConditionals.F405", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF405 )
-		pFnF405 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F405" );
+	UFunction* const pFnF405 = pFnF405Ref.Get ( );
 
 	UBioAutoConditionals_execF405_Parms F405_Parms;
 	F405_Parms.bioWorld = bioWorld;
@@ -8764,10 +8382,9 @@ bool UBioAutoConditionals::F405 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1017 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1017 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1017Ref { L"Function PlotManager.BioAutoConditionals.F1017", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1017 )
-		pFnF1017 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1017" );
+	UFunction* const pFnF1017 = pFnF1017Ref.Get ( );
 
 	UBioAutoConditionals_execF1017_Parms F1017_Parms;
 	F1017_Parms.bioWorld = bioWorld;
@@ -8787,10 +8404,9 @@ bool UBioAutoConditionals::F1017 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1016 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1016 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1016Ref { L"Function PlotManager.BioAutoConditionals.F1016", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1016 )
-		pFnF1016 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1016" );
+	UFunction* const pFnF1016 = pFnF1016Ref.Get ( );
 
 	UBioAutoConditionals_execF1016_Parms F1016_Parms;
 	F1016_Parms.bioWorld = bioWorld;
@@ -8810,10 +8426,9 @@ bool UBioAutoConditionals::F1016 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1015 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1015 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1015Ref { L"Function PlotManager.BioAutoConditionals.F1015", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1015 )
-		pFnF1015 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1015" );
+	UFunction* const pFnF1015 = pFnF1015Ref.Get ( );
 
 	UBioAutoConditionals_execF1015_Parms F1015_Parms;
 	F1015_Parms.bioWorld = bioWorld;
@@ -8833,10 +8448,9 @@ bool UBioAutoConditionals::F1015 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1011 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1011 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1011Ref { L"Function PlotManager.BioAutoConditionals.F1011", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1011 )
-		pFnF1011 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1011" );
+	UFunction* const pFnF1011 = pFnF1011Ref.Get ( );
 
 	UBioAutoConditionals_execF1011_Parms F1011_Parms;
 	F1011_Parms.bioWorld = bioWorld;
@@ -8856,10 +8470,9 @@ bool UBioAutoConditionals::F1011 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1010 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1010 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1010Ref { L"Function PlotManager.BioAutoConditionals.F1010", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1010 )
-		pFnF1010 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1010" );
+	UFunction* const pFnF1010 = pFnF1010Ref.Get ( );
 
 	UBioAutoConditionals_execF1010_Parms F1010_Parms;
 	F1010_Parms.bioWorld = bioWorld;
@@ -8879,10 +8492,9 @@ bool UBioAutoConditionals::F1010 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1624 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1624 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1624Ref { L"Function PlotManager.BioAutoConditionals.F1624", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1624 )
-		pFnF1624 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1624" );
+	UFunction* const pFnF1624 = pFnF1624Ref.Get ( );
 
 	UBioAutoConditionals_execF1624_Parms F1624_Parms;
 	F1624_Parms.bioWorld = bioWorld;
@@ -8902,10 +8514,9 @@ bool UBioAutoConditionals::F1624 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1623 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1623 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1623Ref { L"Function PlotManager.BioAutoConditionals.F1623", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1623 )
-		pFnF1623 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1623" );
+	UFunction* const pFnF1623 = pFnF1623Ref.Get ( );
 
 	UBioAutoConditionals_execF1623_Parms F1623_Parms;
 	F1623_Parms.bioWorld = bioWorld;
@@ -8925,10 +8536,9 @@ bool UBioAutoConditionals::F1623 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1622 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1622 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1622Ref { L"Function PlotManager.BioAutoConditionals.F1622", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1622 )
-		pFnF1622 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1622" );
+	UFunction* const pFnF1622 = pFnF1622Ref.Get ( );
 
 	UBioAutoConditionals_execF1622_Parms F1622_Parms;
 	F1622_Parms.bioWorld = bioWorld;
@@ -8948,10 +8558,9 @@ bool UBioAutoConditionals::F1622 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1621 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1621 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1621Ref { L"Function PlotManager.BioAutoConditionals.F1621", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1621 )
-		pFnF1621 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1621" );
+	UFunction* const pFnF1621 = pFnF1621Ref.Get ( );
 
 	UBioAutoConditionals_execF1621_Parms F1621_Parms;
 	F1621_Parms.bioWorld = bioWorld;
@@ -8971,10 +8580,9 @@ bool UBioAutoConditionals::F1621 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1620 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1620 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1620Ref { L"Function PlotManager.BioAutoConditionals.F1620", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1620 )
-		pFnF1620 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1620" );
+	UFunction* const pFnF1620 = pFnF1620Ref.Get ( );
 
 	UBioAutoConditionals_execF1620_Parms F1620_Parms;
 	F1620_Parms.bioWorld = bioWorld;
@@ -8994,10 +8602,9 @@ bool UBioAutoConditionals::F1620 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1619 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1619 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1619Ref { L"Function PlotManager.BioAutoConditionals.F1619", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1619 )
-		pFnF1619 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1619" );
+	UFunction* const pFnF1619 = pFnF1619Ref.Get ( );
 
 	UBioAutoConditionals_execF1619_Parms F1619_Parms;
 	F1619_Parms.bioWorld = bioWorld;
@@ -9017,10 +8624,9 @@ bool UBioAutoConditionals::F1619 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F884 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF884 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF884Ref { L"Function PlotManager.BioAutoConditionals.F884", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF884 )
-		pFnF884 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F884" );
+	UFunction* const pFnF884 = pFnF884Ref.Get ( );
 
 	UBioAutoConditionals_execF884_Parms F884_Parms;
 	F884_Parms.bioWorld = bioWorld;
@@ -9040,10 +8646,9 @@ bool UBioAutoConditionals::F884 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1593 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1593 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1593Ref { L"Function PlotManager.BioAutoConditionals.F1593", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1593 )
-		pFnF1593 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1593" );
+	UFunction* const pFnF1593 = pFnF1593Ref.Get ( );
 
 	UBioAutoConditionals_execF1593_Parms F1593_Parms;
 	F1593_Parms.bioWorld = bioWorld;
@@ -9063,10 +8668,9 @@ bool UBioAutoConditionals::F1593 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1592 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1592 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1592Ref { L"Function PlotManager.BioAutoConditionals.F1592", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1592 )
-		pFnF1592 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1592" );
+	UFunction* const pFnF1592 = pFnF1592Ref.Get ( );
 
 	UBioAutoConditionals_execF1592_Parms F1592_Parms;
 	F1592_Parms.bioWorld = bioWorld;
@@ -9086,10 +8690,9 @@ bool UBioAutoConditionals::F1592 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1591 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1591 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1591Ref { L"Function PlotManager.BioAutoConditionals.F1591", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1591 )
-		pFnF1591 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1591" );
+	UFunction* const pFnF1591 = pFnF1591Ref.Get ( );
 
 	UBioAutoConditionals_execF1591_Parms F1591_Parms;
 	F1591_Parms.bioWorld = bioWorld;
@@ -9109,10 +8712,9 @@ bool UBioAutoConditionals::F1591 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1590 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1590 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1590Ref { L"Function PlotManager.BioAutoConditionals.F1590", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1590 )
-		pFnF1590 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1590" );
+	UFunction* const pFnF1590 = pFnF1590Ref.Get ( );
 
 	UBioAutoConditionals_execF1590_Parms F1590_Parms;
 	F1590_Parms.bioWorld = bioWorld;
@@ -9132,10 +8734,9 @@ bool UBioAutoConditionals::F1590 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1589 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1589 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1589Ref { L"Function PlotManager.BioAutoConditionals.F1589", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1589 )
-		pFnF1589 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1589" );
+	UFunction* const pFnF1589 = pFnF1589Ref.Get ( );
 
 	UBioAutoConditionals_execF1589_Parms F1589_Parms;
 	F1589_Parms.bioWorld = bioWorld;
@@ -9155,10 +8756,9 @@ bool UBioAutoConditionals::F1589 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1588 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1588 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1588Ref { L"Function PlotManager.BioAutoConditionals.F1588", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1588 )
-		pFnF1588 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1588" );
+	UFunction* const pFnF1588 = pFnF1588Ref.Get ( );
 
 	UBioAutoConditionals_execF1588_Parms F1588_Parms;
 	F1588_Parms.bioWorld = bioWorld;
@@ -9178,10 +8778,9 @@ bool UBioAutoConditionals::F1588 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1587 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1587 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1587Ref { L"Function PlotManager.BioAutoConditionals.F1587", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1587 )
-		pFnF1587 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1587" );
+	UFunction* const pFnF1587 = pFnF1587Ref.Get ( );
 
 	UBioAutoConditionals_execF1587_Parms F1587_Parms;
 	F1587_Parms.bioWorld = bioWorld;
@@ -9201,10 +8800,9 @@ bool UBioAutoConditionals::F1587 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1586 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1586 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1586Ref { L"Function PlotManager.BioAutoConditionals.F1586", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1586 )
-		pFnF1586 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1586" );
+	UFunction* const pFnF1586 = pFnF1586Ref.Get ( );
 
 	UBioAutoConditionals_execF1586_Parms F1586_Parms;
 	F1586_Parms.bioWorld = bioWorld;
@@ -9224,10 +8822,9 @@ bool UBioAutoConditionals::F1586 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1585 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1585 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1585Ref { L"Function PlotManager.BioAutoConditionals.F1585", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1585 )
-		pFnF1585 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1585" );
+	UFunction* const pFnF1585 = pFnF1585Ref.Get ( );
 
 	UBioAutoConditionals_execF1585_Parms F1585_Parms;
 	F1585_Parms.bioWorld = bioWorld;
@@ -9247,10 +8844,9 @@ bool UBioAutoConditionals::F1585 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1584 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1584 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1584Ref { L"Function PlotManager.BioAutoConditionals.F1584", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1584 )
-		pFnF1584 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1584" );
+	UFunction* const pFnF1584 = pFnF1584Ref.Get ( );
 
 	UBioAutoConditionals_execF1584_Parms F1584_Parms;
 	F1584_Parms.bioWorld = bioWorld;
@@ -9270,10 +8866,9 @@ bool UBioAutoConditionals::F1584 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1583 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1583 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1583Ref { L"Function PlotManager.BioAutoConditionals.F1583", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1583 )
-		pFnF1583 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1583" );
+	UFunction* const pFnF1583 = pFnF1583Ref.Get ( );
 
 	UBioAutoConditionals_execF1583_Parms F1583_Parms;
 	F1583_Parms.bioWorld = bioWorld;
@@ -9293,10 +8888,9 @@ bool UBioAutoConditionals::F1583 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1582 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1582 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1582Ref { L"Function PlotManager.BioAutoConditionals.F1582", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1582 )
-		pFnF1582 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1582" );
+	UFunction* const pFnF1582 = pFnF1582Ref.Get ( );
 
 	UBioAutoConditionals_execF1582_Parms F1582_Parms;
 	F1582_Parms.bioWorld = bioWorld;
@@ -9316,10 +8910,9 @@ bool UBioAutoConditionals::F1582 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1581 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1581 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1581Ref { L"Function PlotManager.BioAutoConditionals.F1581", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1581 )
-		pFnF1581 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1581" );
+	UFunction* const pFnF1581 = pFnF1581Ref.Get ( );
 
 	UBioAutoConditionals_execF1581_Parms F1581_Parms;
 	F1581_Parms.bioWorld = bioWorld;
@@ -9339,10 +8932,9 @@ bool UBioAutoConditionals::F1581 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1580 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1580 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1580Ref { L"Function PlotManager.BioAutoConditionals.F1580", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1580 )
-		pFnF1580 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1580" );
+	UFunction* const pFnF1580 = pFnF1580Ref.Get ( );
 
 	UBioAutoConditionals_execF1580_Parms F1580_Parms;
 	F1580_Parms.bioWorld = bioWorld;
@@ -9362,10 +8954,9 @@ bool UBioAutoConditionals::F1580 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1579 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1579 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1579Ref { L"Function PlotManager.BioAutoConditionals.F1579", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1579 )
-		pFnF1579 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1579" );
+	UFunction* const pFnF1579 = pFnF1579Ref.Get ( );
 
 	UBioAutoConditionals_execF1579_Parms F1579_Parms;
 	F1579_Parms.bioWorld = bioWorld;
@@ -9385,10 +8976,9 @@ bool UBioAutoConditionals::F1579 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1578 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1578 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1578Ref { L"Function PlotManager.BioAutoConditionals.F1578", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1578 )
-		pFnF1578 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1578" );
+	UFunction* const pFnF1578 = pFnF1578Ref.Get ( );
 
 	UBioAutoConditionals_execF1578_Parms F1578_Parms;
 	F1578_Parms.bioWorld = bioWorld;
@@ -9408,10 +8998,9 @@ bool UBioAutoConditionals::F1578 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1647 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1647 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1647Ref { L"Function PlotManager.BioAutoConditionals.F1647", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1647 )
-		pFnF1647 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1647" );
+	UFunction* const pFnF1647 = pFnF1647Ref.Get ( );
 
 	UBioAutoConditionals_execF1647_Parms F1647_Parms;
 	F1647_Parms.bioWorld = bioWorld;
@@ -9431,10 +9020,9 @@ bool UBioAutoConditionals::F1647 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1050 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1050 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1050Ref { L"Function PlotManager.BioAutoConditionals.F1050", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1050 )
-		pFnF1050 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1050" );
+	UFunction* const pFnF1050 = pFnF1050Ref.Get ( );
 
 	UBioAutoConditionals_execF1050_Parms F1050_Parms;
 	F1050_Parms.bioWorld = bioWorld;
@@ -9454,10 +9042,9 @@ bool UBioAutoConditionals::F1050 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1595 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1595 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1595Ref { L"Function PlotManager.BioAutoConditionals.F1595", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1595 )
-		pFnF1595 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1595" );
+	UFunction* const pFnF1595 = pFnF1595Ref.Get ( );
 
 	UBioAutoConditionals_execF1595_Parms F1595_Parms;
 	F1595_Parms.bioWorld = bioWorld;
@@ -9477,10 +9064,9 @@ bool UBioAutoConditionals::F1595 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1342 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1342 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1342Ref { L"Function PlotManager.BioAutoConditionals.F1342", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1342 )
-		pFnF1342 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1342" );
+	UFunction* const pFnF1342 = pFnF1342Ref.Get ( );
 
 	UBioAutoConditionals_execF1342_Parms F1342_Parms;
 	F1342_Parms.bioWorld = bioWorld;
@@ -9500,10 +9086,9 @@ bool UBioAutoConditionals::F1342 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F635 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF635 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF635Ref { L"Function PlotManager.BioAutoConditionals.F635", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF635 )
-		pFnF635 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F635" );
+	UFunction* const pFnF635 = pFnF635Ref.Get ( );
 
 	UBioAutoConditionals_execF635_Parms F635_Parms;
 	F635_Parms.bioWorld = bioWorld;
@@ -9523,10 +9108,9 @@ bool UBioAutoConditionals::F635 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F535 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF535 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF535Ref { L"Function PlotManager.BioAutoConditionals.F535", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF535 )
-		pFnF535 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F535" );
+	UFunction* const pFnF535 = pFnF535Ref.Get ( );
 
 	UBioAutoConditionals_execF535_Parms F535_Parms;
 	F535_Parms.bioWorld = bioWorld;
@@ -9546,10 +9130,9 @@ bool UBioAutoConditionals::F535 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F534 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF534 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF534Ref { L"Function PlotManager.BioAutoConditionals.F534", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF534 )
-		pFnF534 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F534" );
+	UFunction* const pFnF534 = pFnF534Ref.Get ( );
 
 	UBioAutoConditionals_execF534_Parms F534_Parms;
 	F534_Parms.bioWorld = bioWorld;
@@ -9569,10 +9152,9 @@ bool UBioAutoConditionals::F534 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F533 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF533 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF533Ref { L"Function PlotManager.BioAutoConditionals.F533", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF533 )
-		pFnF533 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F533" );
+	UFunction* const pFnF533 = pFnF533Ref.Get ( );
 
 	UBioAutoConditionals_execF533_Parms F533_Parms;
 	F533_Parms.bioWorld = bioWorld;
@@ -9592,10 +9174,9 @@ bool UBioAutoConditionals::F533 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F439 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF439 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF439Ref { L"Function PlotManager.BioAutoConditionals.F439", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF439 )
-		pFnF439 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F439" );
+	UFunction* const pFnF439 = pFnF439Ref.Get ( );
 
 	UBioAutoConditionals_execF439_Parms F439_Parms;
 	F439_Parms.bioWorld = bioWorld;
@@ -9615,10 +9196,9 @@ bool UBioAutoConditionals::F439 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F390 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF390 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF390Ref { L"Function PlotManager.BioAutoConditionals.F390", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF390 )
-		pFnF390 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F390" );
+	UFunction* const pFnF390 = pFnF390Ref.Get ( );
 
 	UBioAutoConditionals_execF390_Parms F390_Parms;
 	F390_Parms.bioWorld = bioWorld;
@@ -9638,10 +9218,9 @@ bool UBioAutoConditionals::F390 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F355 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF355 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF355Ref { L"Function PlotManager.BioAutoConditionals.F355", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF355 )
-		pFnF355 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F355" );
+	UFunction* const pFnF355 = pFnF355Ref.Get ( );
 
 	UBioAutoConditionals_execF355_Parms F355_Parms;
 	F355_Parms.bioWorld = bioWorld;
@@ -9661,10 +9240,9 @@ bool UBioAutoConditionals::F355 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1735 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1735 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1735Ref { L"Function PlotManager.BioAutoConditionals.F1735", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1735 )
-		pFnF1735 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1735" );
+	UFunction* const pFnF1735 = pFnF1735Ref.Get ( );
 
 	UBioAutoConditionals_execF1735_Parms F1735_Parms;
 	F1735_Parms.bioWorld = bioWorld;
@@ -9684,10 +9262,9 @@ bool UBioAutoConditionals::F1735 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1734 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1734 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1734Ref { L"Function PlotManager.BioAutoConditionals.F1734", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1734 )
-		pFnF1734 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1734" );
+	UFunction* const pFnF1734 = pFnF1734Ref.Get ( );
 
 	UBioAutoConditionals_execF1734_Parms F1734_Parms;
 	F1734_Parms.bioWorld = bioWorld;
@@ -9707,10 +9284,9 @@ bool UBioAutoConditionals::F1734 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1344 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1344 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1344Ref { L"Function PlotManager.BioAutoConditionals.F1344", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1344 )
-		pFnF1344 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1344" );
+	UFunction* const pFnF1344 = pFnF1344Ref.Get ( );
 
 	UBioAutoConditionals_execF1344_Parms F1344_Parms;
 	F1344_Parms.bioWorld = bioWorld;
@@ -9730,10 +9306,9 @@ bool UBioAutoConditionals::F1344 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1185 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1185 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1185Ref { L"Function PlotManager.BioAutoConditionals.F1185", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1185 )
-		pFnF1185 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1185" );
+	UFunction* const pFnF1185 = pFnF1185Ref.Get ( );
 
 	UBioAutoConditionals_execF1185_Parms F1185_Parms;
 	F1185_Parms.bioWorld = bioWorld;
@@ -9753,10 +9328,9 @@ bool UBioAutoConditionals::F1185 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F775 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF775 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF775Ref { L"Function PlotManager.BioAutoConditionals.F775", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF775 )
-		pFnF775 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F775" );
+	UFunction* const pFnF775 = pFnF775Ref.Get ( );
 
 	UBioAutoConditionals_execF775_Parms F775_Parms;
 	F775_Parms.bioWorld = bioWorld;
@@ -9776,10 +9350,9 @@ bool UBioAutoConditionals::F775 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F411 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF411 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF411Ref { L"Function PlotManager.BioAutoConditionals.F411", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF411 )
-		pFnF411 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F411" );
+	UFunction* const pFnF411 = pFnF411Ref.Get ( );
 
 	UBioAutoConditionals_execF411_Parms F411_Parms;
 	F411_Parms.bioWorld = bioWorld;
@@ -9799,10 +9372,9 @@ bool UBioAutoConditionals::F411 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F354 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF354 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF354Ref { L"Function PlotManager.BioAutoConditionals.F354", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF354 )
-		pFnF354 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F354" );
+	UFunction* const pFnF354 = pFnF354Ref.Get ( );
 
 	UBioAutoConditionals_execF354_Parms F354_Parms;
 	F354_Parms.bioWorld = bioWorld;
@@ -9822,10 +9394,9 @@ bool UBioAutoConditionals::F354 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F353 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF353 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF353Ref { L"Function PlotManager.BioAutoConditionals.F353", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF353 )
-		pFnF353 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F353" );
+	UFunction* const pFnF353 = pFnF353Ref.Get ( );
 
 	UBioAutoConditionals_execF353_Parms F353_Parms;
 	F353_Parms.bioWorld = bioWorld;
@@ -9845,10 +9416,9 @@ bool UBioAutoConditionals::F353 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F352 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF352 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF352Ref { L"Function PlotManager.BioAutoConditionals.F352", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF352 )
-		pFnF352 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F352" );
+	UFunction* const pFnF352 = pFnF352Ref.Get ( );
 
 	UBioAutoConditionals_execF352_Parms F352_Parms;
 	F352_Parms.bioWorld = bioWorld;
@@ -9868,10 +9438,9 @@ bool UBioAutoConditionals::F352 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F406 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF406 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF406Ref { L"Function PlotManager.BioAutoConditionals.F406", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF406 )
-		pFnF406 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F406" );
+	UFunction* const pFnF406 = pFnF406Ref.Get ( );
 
 	UBioAutoConditionals_execF406_Parms F406_Parms;
 	F406_Parms.bioWorld = bioWorld;
@@ -9891,10 +9460,9 @@ bool UBioAutoConditionals::F406 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F246 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF246 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF246Ref { L"Function PlotManager.BioAutoConditionals.F246", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF246 )
-		pFnF246 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F246" );
+	UFunction* const pFnF246 = pFnF246Ref.Get ( );
 
 	UBioAutoConditionals_execF246_Parms F246_Parms;
 	F246_Parms.bioWorld = bioWorld;
@@ -9914,10 +9482,9 @@ bool UBioAutoConditionals::F246 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F245 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF245 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF245Ref { L"Function PlotManager.BioAutoConditionals.F245", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF245 )
-		pFnF245 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F245" );
+	UFunction* const pFnF245 = pFnF245Ref.Get ( );
 
 	UBioAutoConditionals_execF245_Parms F245_Parms;
 	F245_Parms.bioWorld = bioWorld;
@@ -9937,10 +9504,9 @@ bool UBioAutoConditionals::F245 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1063 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1063 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1063Ref { L"Function PlotManager.BioAutoConditionals.F1063", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1063 )
-		pFnF1063 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1063" );
+	UFunction* const pFnF1063 = pFnF1063Ref.Get ( );
 
 	UBioAutoConditionals_execF1063_Parms F1063_Parms;
 	F1063_Parms.bioWorld = bioWorld;
@@ -9960,10 +9526,9 @@ bool UBioAutoConditionals::F1063 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1062 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1062 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1062Ref { L"Function PlotManager.BioAutoConditionals.F1062", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1062 )
-		pFnF1062 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1062" );
+	UFunction* const pFnF1062 = pFnF1062Ref.Get ( );
 
 	UBioAutoConditionals_execF1062_Parms F1062_Parms;
 	F1062_Parms.bioWorld = bioWorld;
@@ -9983,10 +9548,9 @@ bool UBioAutoConditionals::F1062 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F524 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF524 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF524Ref { L"Function PlotManager.BioAutoConditionals.F524", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF524 )
-		pFnF524 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F524" );
+	UFunction* const pFnF524 = pFnF524Ref.Get ( );
 
 	UBioAutoConditionals_execF524_Parms F524_Parms;
 	F524_Parms.bioWorld = bioWorld;
@@ -10006,10 +9570,9 @@ bool UBioAutoConditionals::F524 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F523 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF523 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF523Ref { L"Function PlotManager.BioAutoConditionals.F523", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF523 )
-		pFnF523 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F523" );
+	UFunction* const pFnF523 = pFnF523Ref.Get ( );
 
 	UBioAutoConditionals_execF523_Parms F523_Parms;
 	F523_Parms.bioWorld = bioWorld;
@@ -10029,10 +9592,9 @@ bool UBioAutoConditionals::F523 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F522 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF522 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF522Ref { L"Function PlotManager.BioAutoConditionals.F522", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF522 )
-		pFnF522 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F522" );
+	UFunction* const pFnF522 = pFnF522Ref.Get ( );
 
 	UBioAutoConditionals_execF522_Parms F522_Parms;
 	F522_Parms.bioWorld = bioWorld;
@@ -10052,10 +9614,9 @@ bool UBioAutoConditionals::F522 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F521 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF521 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF521Ref { L"Function PlotManager.BioAutoConditionals.F521", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF521 )
-		pFnF521 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F521" );
+	UFunction* const pFnF521 = pFnF521Ref.Get ( );
 
 	UBioAutoConditionals_execF521_Parms F521_Parms;
 	F521_Parms.bioWorld = bioWorld;
@@ -10075,10 +9636,9 @@ bool UBioAutoConditionals::F521 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F520 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF520 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF520Ref { L"Function PlotManager.BioAutoConditionals.F520", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF520 )
-		pFnF520 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F520" );
+	UFunction* const pFnF520 = pFnF520Ref.Get ( );
 
 	UBioAutoConditionals_execF520_Parms F520_Parms;
 	F520_Parms.bioWorld = bioWorld;
@@ -10098,10 +9658,9 @@ bool UBioAutoConditionals::F520 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F519 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF519 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF519Ref { L"Function PlotManager.BioAutoConditionals.F519", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF519 )
-		pFnF519 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F519" );
+	UFunction* const pFnF519 = pFnF519Ref.Get ( );
 
 	UBioAutoConditionals_execF519_Parms F519_Parms;
 	F519_Parms.bioWorld = bioWorld;
@@ -10121,10 +9680,9 @@ bool UBioAutoConditionals::F519 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F518 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF518 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF518Ref { L"Function PlotManager.BioAutoConditionals.F518", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF518 )
-		pFnF518 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F518" );
+	UFunction* const pFnF518 = pFnF518Ref.Get ( );
 
 	UBioAutoConditionals_execF518_Parms F518_Parms;
 	F518_Parms.bioWorld = bioWorld;
@@ -10144,10 +9702,9 @@ bool UBioAutoConditionals::F518 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F517 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF517 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF517Ref { L"Function PlotManager.BioAutoConditionals.F517", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF517 )
-		pFnF517 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F517" );
+	UFunction* const pFnF517 = pFnF517Ref.Get ( );
 
 	UBioAutoConditionals_execF517_Parms F517_Parms;
 	F517_Parms.bioWorld = bioWorld;
@@ -10167,10 +9724,9 @@ bool UBioAutoConditionals::F517 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F600 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF600 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF600Ref { L"Function PlotManager.BioAutoConditionals.F600", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF600 )
-		pFnF600 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F600" );
+	UFunction* const pFnF600 = pFnF600Ref.Get ( );
 
 	UBioAutoConditionals_execF600_Parms F600_Parms;
 	F600_Parms.bioWorld = bioWorld;
@@ -10190,10 +9746,9 @@ bool UBioAutoConditionals::F600 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F391 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF391 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF391Ref { L"Function PlotManager.BioAutoConditionals.F391", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF391 )
-		pFnF391 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F391" );
+	UFunction* const pFnF391 = pFnF391Ref.Get ( );
 
 	UBioAutoConditionals_execF391_Parms F391_Parms;
 	F391_Parms.bioWorld = bioWorld;
@@ -10213,10 +9768,9 @@ bool UBioAutoConditionals::F391 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F708 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF708 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF708Ref { L"Function PlotManager.BioAutoConditionals.F708", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF708 )
-		pFnF708 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F708" );
+	UFunction* const pFnF708 = pFnF708Ref.Get ( );
 
 	UBioAutoConditionals_execF708_Parms F708_Parms;
 	F708_Parms.bioWorld = bioWorld;
@@ -10236,10 +9790,9 @@ bool UBioAutoConditionals::F708 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F707 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF707 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF707Ref { L"Function PlotManager.BioAutoConditionals.F707", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF707 )
-		pFnF707 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F707" );
+	UFunction* const pFnF707 = pFnF707Ref.Get ( );
 
 	UBioAutoConditionals_execF707_Parms F707_Parms;
 	F707_Parms.bioWorld = bioWorld;
@@ -10259,10 +9812,9 @@ bool UBioAutoConditionals::F707 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F686 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF686 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF686Ref { L"Function PlotManager.BioAutoConditionals.F686", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF686 )
-		pFnF686 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F686" );
+	UFunction* const pFnF686 = pFnF686Ref.Get ( );
 
 	UBioAutoConditionals_execF686_Parms F686_Parms;
 	F686_Parms.bioWorld = bioWorld;
@@ -10282,10 +9834,9 @@ bool UBioAutoConditionals::F686 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F606 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF606 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF606Ref { L"Function PlotManager.BioAutoConditionals.F606", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF606 )
-		pFnF606 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F606" );
+	UFunction* const pFnF606 = pFnF606Ref.Get ( );
 
 	UBioAutoConditionals_execF606_Parms F606_Parms;
 	F606_Parms.bioWorld = bioWorld;
@@ -10305,10 +9856,9 @@ bool UBioAutoConditionals::F606 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1049 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1049 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1049Ref { L"Function PlotManager.BioAutoConditionals.F1049", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1049 )
-		pFnF1049 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1049" );
+	UFunction* const pFnF1049 = pFnF1049Ref.Get ( );
 
 	UBioAutoConditionals_execF1049_Parms F1049_Parms;
 	F1049_Parms.bioWorld = bioWorld;
@@ -10328,10 +9878,9 @@ bool UBioAutoConditionals::F1049 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1241 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1241 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1241Ref { L"Function PlotManager.BioAutoConditionals.F1241", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1241 )
-		pFnF1241 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1241" );
+	UFunction* const pFnF1241 = pFnF1241Ref.Get ( );
 
 	UBioAutoConditionals_execF1241_Parms F1241_Parms;
 	F1241_Parms.bioWorld = bioWorld;
@@ -10351,10 +9900,9 @@ bool UBioAutoConditionals::F1241 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1230 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1230 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1230Ref { L"Function PlotManager.BioAutoConditionals.F1230", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1230 )
-		pFnF1230 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1230" );
+	UFunction* const pFnF1230 = pFnF1230Ref.Get ( );
 
 	UBioAutoConditionals_execF1230_Parms F1230_Parms;
 	F1230_Parms.bioWorld = bioWorld;
@@ -10374,10 +9922,9 @@ bool UBioAutoConditionals::F1230 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1171 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1171 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1171Ref { L"Function PlotManager.BioAutoConditionals.F1171", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1171 )
-		pFnF1171 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1171" );
+	UFunction* const pFnF1171 = pFnF1171Ref.Get ( );
 
 	UBioAutoConditionals_execF1171_Parms F1171_Parms;
 	F1171_Parms.bioWorld = bioWorld;
@@ -10397,10 +9944,9 @@ bool UBioAutoConditionals::F1171 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F414 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF414 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF414Ref { L"Function PlotManager.BioAutoConditionals.F414", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF414 )
-		pFnF414 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F414" );
+	UFunction* const pFnF414 = pFnF414Ref.Get ( );
 
 	UBioAutoConditionals_execF414_Parms F414_Parms;
 	F414_Parms.bioWorld = bioWorld;
@@ -10420,10 +9966,9 @@ bool UBioAutoConditionals::F414 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F362 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF362 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF362Ref { L"Function PlotManager.BioAutoConditionals.F362", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF362 )
-		pFnF362 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F362" );
+	UFunction* const pFnF362 = pFnF362Ref.Get ( );
 
 	UBioAutoConditionals_execF362_Parms F362_Parms;
 	F362_Parms.bioWorld = bioWorld;
@@ -10443,10 +9988,9 @@ bool UBioAutoConditionals::F362 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F360 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF360 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF360Ref { L"Function PlotManager.BioAutoConditionals.F360", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF360 )
-		pFnF360 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F360" );
+	UFunction* const pFnF360 = pFnF360Ref.Get ( );
 
 	UBioAutoConditionals_execF360_Parms F360_Parms;
 	F360_Parms.bioWorld = bioWorld;
@@ -10466,10 +10010,9 @@ bool UBioAutoConditionals::F360 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F357 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF357 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF357Ref { L"Function PlotManager.BioAutoConditionals.F357", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF357 )
-		pFnF357 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F357" );
+	UFunction* const pFnF357 = pFnF357Ref.Get ( );
 
 	UBioAutoConditionals_execF357_Parms F357_Parms;
 	F357_Parms.bioWorld = bioWorld;
@@ -10489,10 +10032,9 @@ bool UBioAutoConditionals::F357 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2018 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2018 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2018Ref { L"Function PlotManager.BioAutoConditionals.F2018", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2018 )
-		pFnF2018 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2018" );
+	UFunction* const pFnF2018 = pFnF2018Ref.Get ( );
 
 	UBioAutoConditionals_execF2018_Parms F2018_Parms;
 	F2018_Parms.bioWorld = bioWorld;
@@ -10512,10 +10054,9 @@ bool UBioAutoConditionals::F2018 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F467 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF467 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF467Ref { L"Function PlotManager.BioAutoConditionals.F467", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF467 )
-		pFnF467 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F467" );
+	UFunction* const pFnF467 = pFnF467Ref.Get ( );
 
 	UBioAutoConditionals_execF467_Parms F467_Parms;
 	F467_Parms.bioWorld = bioWorld;
@@ -10535,10 +10076,9 @@ bool UBioAutoConditionals::F467 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F724 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF724 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF724Ref { L"Function PlotManager.BioAutoConditionals.F724", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF724 )
-		pFnF724 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F724" );
+	UFunction* const pFnF724 = pFnF724Ref.Get ( );
 
 	UBioAutoConditionals_execF724_Parms F724_Parms;
 	F724_Parms.bioWorld = bioWorld;
@@ -10558,10 +10098,9 @@ bool UBioAutoConditionals::F724 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F599 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF599 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF599Ref { L"Function PlotManager.BioAutoConditionals.F599", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF599 )
-		pFnF599 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F599" );
+	UFunction* const pFnF599 = pFnF599Ref.Get ( );
 
 	UBioAutoConditionals_execF599_Parms F599_Parms;
 	F599_Parms.bioWorld = bioWorld;
@@ -10581,10 +10120,9 @@ bool UBioAutoConditionals::F599 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F468 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF468 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF468Ref { L"Function PlotManager.BioAutoConditionals.F468", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF468 )
-		pFnF468 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F468" );
+	UFunction* const pFnF468 = pFnF468Ref.Get ( );
 
 	UBioAutoConditionals_execF468_Parms F468_Parms;
 	F468_Parms.bioWorld = bioWorld;
@@ -10604,10 +10142,9 @@ bool UBioAutoConditionals::F468 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F466 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF466 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF466Ref { L"Function PlotManager.BioAutoConditionals.F466", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF466 )
-		pFnF466 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F466" );
+	UFunction* const pFnF466 = pFnF466Ref.Get ( );
 
 	UBioAutoConditionals_execF466_Parms F466_Parms;
 	F466_Parms.bioWorld = bioWorld;
@@ -10627,10 +10164,9 @@ bool UBioAutoConditionals::F466 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1350 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1350 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1350Ref { L"Function PlotManager.BioAutoConditionals.F1350", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1350 )
-		pFnF1350 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1350" );
+	UFunction* const pFnF1350 = pFnF1350Ref.Get ( );
 
 	UBioAutoConditionals_execF1350_Parms F1350_Parms;
 	F1350_Parms.bioWorld = bioWorld;
@@ -10650,10 +10186,9 @@ bool UBioAutoConditionals::F1350 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1349 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1349 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1349Ref { L"Function PlotManager.BioAutoConditionals.F1349", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1349 )
-		pFnF1349 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1349" );
+	UFunction* const pFnF1349 = pFnF1349Ref.Get ( );
 
 	UBioAutoConditionals_execF1349_Parms F1349_Parms;
 	F1349_Parms.bioWorld = bioWorld;
@@ -10673,10 +10208,9 @@ bool UBioAutoConditionals::F1349 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1348 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1348 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1348Ref { L"Function PlotManager.BioAutoConditionals.F1348", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1348 )
-		pFnF1348 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1348" );
+	UFunction* const pFnF1348 = pFnF1348Ref.Get ( );
 
 	UBioAutoConditionals_execF1348_Parms F1348_Parms;
 	F1348_Parms.bioWorld = bioWorld;
@@ -10696,10 +10230,9 @@ bool UBioAutoConditionals::F1348 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1319 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1319 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1319Ref { L"Function PlotManager.BioAutoConditionals.F1319", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1319 )
-		pFnF1319 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1319" );
+	UFunction* const pFnF1319 = pFnF1319Ref.Get ( );
 
 	UBioAutoConditionals_execF1319_Parms F1319_Parms;
 	F1319_Parms.bioWorld = bioWorld;
@@ -10719,10 +10252,9 @@ bool UBioAutoConditionals::F1319 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1318 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1318 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1318Ref { L"Function PlotManager.BioAutoConditionals.F1318", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1318 )
-		pFnF1318 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1318" );
+	UFunction* const pFnF1318 = pFnF1318Ref.Get ( );
 
 	UBioAutoConditionals_execF1318_Parms F1318_Parms;
 	F1318_Parms.bioWorld = bioWorld;
@@ -10742,10 +10274,9 @@ bool UBioAutoConditionals::F1318 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1317 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1317 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1317Ref { L"Function PlotManager.BioAutoConditionals.F1317", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1317 )
-		pFnF1317 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1317" );
+	UFunction* const pFnF1317 = pFnF1317Ref.Get ( );
 
 	UBioAutoConditionals_execF1317_Parms F1317_Parms;
 	F1317_Parms.bioWorld = bioWorld;
@@ -10765,10 +10296,9 @@ bool UBioAutoConditionals::F1317 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1316 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1316 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1316Ref { L"Function PlotManager.BioAutoConditionals.F1316", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1316 )
-		pFnF1316 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1316" );
+	UFunction* const pFnF1316 = pFnF1316Ref.Get ( );
 
 	UBioAutoConditionals_execF1316_Parms F1316_Parms;
 	F1316_Parms.bioWorld = bioWorld;
@@ -10788,10 +10318,9 @@ bool UBioAutoConditionals::F1316 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1315 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1315 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1315Ref { L"Function PlotManager.BioAutoConditionals.F1315", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1315 )
-		pFnF1315 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1315" );
+	UFunction* const pFnF1315 = pFnF1315Ref.Get ( );
 
 	UBioAutoConditionals_execF1315_Parms F1315_Parms;
 	F1315_Parms.bioWorld = bioWorld;
@@ -10811,10 +10340,9 @@ bool UBioAutoConditionals::F1315 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1314 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1314 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1314Ref { L"Function PlotManager.BioAutoConditionals.F1314", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1314 )
-		pFnF1314 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1314" );
+	UFunction* const pFnF1314 = pFnF1314Ref.Get ( );
 
 	UBioAutoConditionals_execF1314_Parms F1314_Parms;
 	F1314_Parms.bioWorld = bioWorld;
@@ -10834,10 +10362,9 @@ bool UBioAutoConditionals::F1314 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1305 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1305 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1305Ref { L"Function PlotManager.BioAutoConditionals.F1305", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1305 )
-		pFnF1305 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1305" );
+	UFunction* const pFnF1305 = pFnF1305Ref.Get ( );
 
 	UBioAutoConditionals_execF1305_Parms F1305_Parms;
 	F1305_Parms.bioWorld = bioWorld;
@@ -10857,10 +10384,9 @@ bool UBioAutoConditionals::F1305 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1304 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1304 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1304Ref { L"Function PlotManager.BioAutoConditionals.F1304", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1304 )
-		pFnF1304 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1304" );
+	UFunction* const pFnF1304 = pFnF1304Ref.Get ( );
 
 	UBioAutoConditionals_execF1304_Parms F1304_Parms;
 	F1304_Parms.bioWorld = bioWorld;
@@ -10880,10 +10406,9 @@ bool UBioAutoConditionals::F1304 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1303 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1303 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1303Ref { L"Function PlotManager.BioAutoConditionals.F1303", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1303 )
-		pFnF1303 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1303" );
+	UFunction* const pFnF1303 = pFnF1303Ref.Get ( );
 
 	UBioAutoConditionals_execF1303_Parms F1303_Parms;
 	F1303_Parms.bioWorld = bioWorld;
@@ -10903,10 +10428,9 @@ bool UBioAutoConditionals::F1303 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1302 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1302 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1302Ref { L"Function PlotManager.BioAutoConditionals.F1302", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1302 )
-		pFnF1302 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1302" );
+	UFunction* const pFnF1302 = pFnF1302Ref.Get ( );
 
 	UBioAutoConditionals_execF1302_Parms F1302_Parms;
 	F1302_Parms.bioWorld = bioWorld;
@@ -10926,10 +10450,9 @@ bool UBioAutoConditionals::F1302 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1301 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1301 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1301Ref { L"Function PlotManager.BioAutoConditionals.F1301", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1301 )
-		pFnF1301 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1301" );
+	UFunction* const pFnF1301 = pFnF1301Ref.Get ( );
 
 	UBioAutoConditionals_execF1301_Parms F1301_Parms;
 	F1301_Parms.bioWorld = bioWorld;
@@ -10949,10 +10472,9 @@ bool UBioAutoConditionals::F1301 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1300 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1300 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1300Ref { L"Function PlotManager.BioAutoConditionals.F1300", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1300 )
-		pFnF1300 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1300" );
+	UFunction* const pFnF1300 = pFnF1300Ref.Get ( );
 
 	UBioAutoConditionals_execF1300_Parms F1300_Parms;
 	F1300_Parms.bioWorld = bioWorld;
@@ -10972,10 +10494,9 @@ bool UBioAutoConditionals::F1300 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1299 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1299 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1299Ref { L"Function PlotManager.BioAutoConditionals.F1299", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1299 )
-		pFnF1299 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1299" );
+	UFunction* const pFnF1299 = pFnF1299Ref.Get ( );
 
 	UBioAutoConditionals_execF1299_Parms F1299_Parms;
 	F1299_Parms.bioWorld = bioWorld;
@@ -10995,10 +10516,9 @@ bool UBioAutoConditionals::F1299 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1298 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1298 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1298Ref { L"Function PlotManager.BioAutoConditionals.F1298", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1298 )
-		pFnF1298 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1298" );
+	UFunction* const pFnF1298 = pFnF1298Ref.Get ( );
 
 	UBioAutoConditionals_execF1298_Parms F1298_Parms;
 	F1298_Parms.bioWorld = bioWorld;
@@ -11018,10 +10538,9 @@ bool UBioAutoConditionals::F1298 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1742 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1742 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1742Ref { L"Function PlotManager.BioAutoConditionals.F1742", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1742 )
-		pFnF1742 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1742" );
+	UFunction* const pFnF1742 = pFnF1742Ref.Get ( );
 
 	UBioAutoConditionals_execF1742_Parms F1742_Parms;
 	F1742_Parms.bioWorld = bioWorld;
@@ -11041,10 +10560,9 @@ bool UBioAutoConditionals::F1742 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1278 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1278 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1278Ref { L"Function PlotManager.BioAutoConditionals.F1278", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1278 )
-		pFnF1278 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1278" );
+	UFunction* const pFnF1278 = pFnF1278Ref.Get ( );
 
 	UBioAutoConditionals_execF1278_Parms F1278_Parms;
 	F1278_Parms.bioWorld = bioWorld;
@@ -11064,10 +10582,9 @@ bool UBioAutoConditionals::F1278 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1277 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1277 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1277Ref { L"Function PlotManager.BioAutoConditionals.F1277", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1277 )
-		pFnF1277 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1277" );
+	UFunction* const pFnF1277 = pFnF1277Ref.Get ( );
 
 	UBioAutoConditionals_execF1277_Parms F1277_Parms;
 	F1277_Parms.bioWorld = bioWorld;
@@ -11087,10 +10604,9 @@ bool UBioAutoConditionals::F1277 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F994 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF994 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF994Ref { L"Function PlotManager.BioAutoConditionals.F994", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF994 )
-		pFnF994 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F994" );
+	UFunction* const pFnF994 = pFnF994Ref.Get ( );
 
 	UBioAutoConditionals_execF994_Parms F994_Parms;
 	F994_Parms.bioWorld = bioWorld;
@@ -11110,10 +10626,9 @@ bool UBioAutoConditionals::F994 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F993 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF993 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF993Ref { L"Function PlotManager.BioAutoConditionals.F993", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF993 )
-		pFnF993 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F993" );
+	UFunction* const pFnF993 = pFnF993Ref.Get ( );
 
 	UBioAutoConditionals_execF993_Parms F993_Parms;
 	F993_Parms.bioWorld = bioWorld;
@@ -11133,10 +10648,9 @@ bool UBioAutoConditionals::F993 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F958 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF958 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF958Ref { L"Function PlotManager.BioAutoConditionals.F958", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF958 )
-		pFnF958 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F958" );
+	UFunction* const pFnF958 = pFnF958Ref.Get ( );
 
 	UBioAutoConditionals_execF958_Parms F958_Parms;
 	F958_Parms.bioWorld = bioWorld;
@@ -11156,10 +10670,9 @@ bool UBioAutoConditionals::F958 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F957 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF957 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF957Ref { L"Function PlotManager.BioAutoConditionals.F957", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF957 )
-		pFnF957 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F957" );
+	UFunction* const pFnF957 = pFnF957Ref.Get ( );
 
 	UBioAutoConditionals_execF957_Parms F957_Parms;
 	F957_Parms.bioWorld = bioWorld;
@@ -11179,10 +10692,9 @@ bool UBioAutoConditionals::F957 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F956 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF956 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF956Ref { L"Function PlotManager.BioAutoConditionals.F956", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF956 )
-		pFnF956 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F956" );
+	UFunction* const pFnF956 = pFnF956Ref.Get ( );
 
 	UBioAutoConditionals_execF956_Parms F956_Parms;
 	F956_Parms.bioWorld = bioWorld;
@@ -11202,10 +10714,9 @@ bool UBioAutoConditionals::F956 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F955 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF955 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF955Ref { L"Function PlotManager.BioAutoConditionals.F955", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF955 )
-		pFnF955 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F955" );
+	UFunction* const pFnF955 = pFnF955Ref.Get ( );
 
 	UBioAutoConditionals_execF955_Parms F955_Parms;
 	F955_Parms.bioWorld = bioWorld;
@@ -11225,10 +10736,9 @@ bool UBioAutoConditionals::F955 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F954 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF954 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF954Ref { L"Function PlotManager.BioAutoConditionals.F954", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF954 )
-		pFnF954 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F954" );
+	UFunction* const pFnF954 = pFnF954Ref.Get ( );
 
 	UBioAutoConditionals_execF954_Parms F954_Parms;
 	F954_Parms.bioWorld = bioWorld;
@@ -11248,10 +10758,9 @@ bool UBioAutoConditionals::F954 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F953 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF953 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF953Ref { L"Function PlotManager.BioAutoConditionals.F953", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF953 )
-		pFnF953 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F953" );
+	UFunction* const pFnF953 = pFnF953Ref.Get ( );
 
 	UBioAutoConditionals_execF953_Parms F953_Parms;
 	F953_Parms.bioWorld = bioWorld;
@@ -11271,10 +10780,9 @@ bool UBioAutoConditionals::F953 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1398 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1398 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1398Ref { L"Function PlotManager.BioAutoConditionals.F1398", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1398 )
-		pFnF1398 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1398" );
+	UFunction* const pFnF1398 = pFnF1398Ref.Get ( );
 
 	UBioAutoConditionals_execF1398_Parms F1398_Parms;
 	F1398_Parms.bioWorld = bioWorld;
@@ -11294,10 +10802,9 @@ bool UBioAutoConditionals::F1398 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F965 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF965 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF965Ref { L"Function PlotManager.BioAutoConditionals.F965", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF965 )
-		pFnF965 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F965" );
+	UFunction* const pFnF965 = pFnF965Ref.Get ( );
 
 	UBioAutoConditionals_execF965_Parms F965_Parms;
 	F965_Parms.bioWorld = bioWorld;
@@ -11317,10 +10824,9 @@ bool UBioAutoConditionals::F965 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F964 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF964 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF964Ref { L"Function PlotManager.BioAutoConditionals.F964", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF964 )
-		pFnF964 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F964" );
+	UFunction* const pFnF964 = pFnF964Ref.Get ( );
 
 	UBioAutoConditionals_execF964_Parms F964_Parms;
 	F964_Parms.bioWorld = bioWorld;
@@ -11340,10 +10846,9 @@ bool UBioAutoConditionals::F964 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F963 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF963 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF963Ref { L"Function PlotManager.BioAutoConditionals.F963", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF963 )
-		pFnF963 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F963" );
+	UFunction* const pFnF963 = pFnF963Ref.Get ( );
 
 	UBioAutoConditionals_execF963_Parms F963_Parms;
 	F963_Parms.bioWorld = bioWorld;
@@ -11363,10 +10868,9 @@ bool UBioAutoConditionals::F963 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1385 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1385 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1385Ref { L"Function PlotManager.BioAutoConditionals.F1385", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1385 )
-		pFnF1385 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1385" );
+	UFunction* const pFnF1385 = pFnF1385Ref.Get ( );
 
 	UBioAutoConditionals_execF1385_Parms F1385_Parms;
 	F1385_Parms.bioWorld = bioWorld;
@@ -11386,10 +10890,9 @@ bool UBioAutoConditionals::F1385 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1503 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1503 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1503Ref { L"Function PlotManager.BioAutoConditionals.F1503", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1503 )
-		pFnF1503 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1503" );
+	UFunction* const pFnF1503 = pFnF1503Ref.Get ( );
 
 	UBioAutoConditionals_execF1503_Parms F1503_Parms;
 	F1503_Parms.bioWorld = bioWorld;
@@ -11409,10 +10912,9 @@ bool UBioAutoConditionals::F1503 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1393 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1393 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1393Ref { L"Function PlotManager.BioAutoConditionals.F1393", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1393 )
-		pFnF1393 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1393" );
+	UFunction* const pFnF1393 = pFnF1393Ref.Get ( );
 
 	UBioAutoConditionals_execF1393_Parms F1393_Parms;
 	F1393_Parms.bioWorld = bioWorld;
@@ -11432,10 +10934,9 @@ bool UBioAutoConditionals::F1393 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1390 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1390 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1390Ref { L"Function PlotManager.BioAutoConditionals.F1390", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1390 )
-		pFnF1390 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1390" );
+	UFunction* const pFnF1390 = pFnF1390Ref.Get ( );
 
 	UBioAutoConditionals_execF1390_Parms F1390_Parms;
 	F1390_Parms.bioWorld = bioWorld;
@@ -11455,10 +10956,9 @@ bool UBioAutoConditionals::F1390 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1388 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1388 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1388Ref { L"Function PlotManager.BioAutoConditionals.F1388", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1388 )
-		pFnF1388 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1388" );
+	UFunction* const pFnF1388 = pFnF1388Ref.Get ( );
 
 	UBioAutoConditionals_execF1388_Parms F1388_Parms;
 	F1388_Parms.bioWorld = bioWorld;
@@ -11478,10 +10978,9 @@ bool UBioAutoConditionals::F1388 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1387 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1387 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1387Ref { L"Function PlotManager.BioAutoConditionals.F1387", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1387 )
-		pFnF1387 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1387" );
+	UFunction* const pFnF1387 = pFnF1387Ref.Get ( );
 
 	UBioAutoConditionals_execF1387_Parms F1387_Parms;
 	F1387_Parms.bioWorld = bioWorld;
@@ -11501,10 +11000,9 @@ bool UBioAutoConditionals::F1387 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1648 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1648 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1648Ref { L"Function PlotManager.BioAutoConditionals.F1648", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1648 )
-		pFnF1648 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1648" );
+	UFunction* const pFnF1648 = pFnF1648Ref.Get ( );
 
 	UBioAutoConditionals_execF1648_Parms F1648_Parms;
 	F1648_Parms.bioWorld = bioWorld;
@@ -11524,10 +11022,9 @@ bool UBioAutoConditionals::F1648 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1502 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1502 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1502Ref { L"Function PlotManager.BioAutoConditionals.F1502", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1502 )
-		pFnF1502 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1502" );
+	UFunction* const pFnF1502 = pFnF1502Ref.Get ( );
 
 	UBioAutoConditionals_execF1502_Parms F1502_Parms;
 	F1502_Parms.bioWorld = bioWorld;
@@ -11547,10 +11044,9 @@ bool UBioAutoConditionals::F1502 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1397 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1397 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1397Ref { L"Function PlotManager.BioAutoConditionals.F1397", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1397 )
-		pFnF1397 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1397" );
+	UFunction* const pFnF1397 = pFnF1397Ref.Get ( );
 
 	UBioAutoConditionals_execF1397_Parms F1397_Parms;
 	F1397_Parms.bioWorld = bioWorld;
@@ -11570,10 +11066,9 @@ bool UBioAutoConditionals::F1397 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1395 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1395 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1395Ref { L"Function PlotManager.BioAutoConditionals.F1395", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1395 )
-		pFnF1395 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1395" );
+	UFunction* const pFnF1395 = pFnF1395Ref.Get ( );
 
 	UBioAutoConditionals_execF1395_Parms F1395_Parms;
 	F1395_Parms.bioWorld = bioWorld;
@@ -11593,10 +11088,9 @@ bool UBioAutoConditionals::F1395 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1394 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1394 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1394Ref { L"Function PlotManager.BioAutoConditionals.F1394", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1394 )
-		pFnF1394 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1394" );
+	UFunction* const pFnF1394 = pFnF1394Ref.Get ( );
 
 	UBioAutoConditionals_execF1394_Parms F1394_Parms;
 	F1394_Parms.bioWorld = bioWorld;
@@ -11616,10 +11110,9 @@ bool UBioAutoConditionals::F1394 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1392 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1392 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1392Ref { L"Function PlotManager.BioAutoConditionals.F1392", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1392 )
-		pFnF1392 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1392" );
+	UFunction* const pFnF1392 = pFnF1392Ref.Get ( );
 
 	UBioAutoConditionals_execF1392_Parms F1392_Parms;
 	F1392_Parms.bioWorld = bioWorld;
@@ -11639,10 +11132,9 @@ bool UBioAutoConditionals::F1392 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F979 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF979 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF979Ref { L"Function PlotManager.BioAutoConditionals.F979", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF979 )
-		pFnF979 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F979" );
+	UFunction* const pFnF979 = pFnF979Ref.Get ( );
 
 	UBioAutoConditionals_execF979_Parms F979_Parms;
 	F979_Parms.bioWorld = bioWorld;
@@ -11662,10 +11154,9 @@ bool UBioAutoConditionals::F979 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F978 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF978 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF978Ref { L"Function PlotManager.BioAutoConditionals.F978", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF978 )
-		pFnF978 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F978" );
+	UFunction* const pFnF978 = pFnF978Ref.Get ( );
 
 	UBioAutoConditionals_execF978_Parms F978_Parms;
 	F978_Parms.bioWorld = bioWorld;
@@ -11685,10 +11176,9 @@ bool UBioAutoConditionals::F978 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F972 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF972 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF972Ref { L"Function PlotManager.BioAutoConditionals.F972", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF972 )
-		pFnF972 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F972" );
+	UFunction* const pFnF972 = pFnF972Ref.Get ( );
 
 	UBioAutoConditionals_execF972_Parms F972_Parms;
 	F972_Parms.bioWorld = bioWorld;
@@ -11708,10 +11198,9 @@ bool UBioAutoConditionals::F972 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F970 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF970 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF970Ref { L"Function PlotManager.BioAutoConditionals.F970", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF970 )
-		pFnF970 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F970" );
+	UFunction* const pFnF970 = pFnF970Ref.Get ( );
 
 	UBioAutoConditionals_execF970_Parms F970_Parms;
 	F970_Parms.bioWorld = bioWorld;
@@ -11731,10 +11220,9 @@ bool UBioAutoConditionals::F970 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F969 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF969 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF969Ref { L"Function PlotManager.BioAutoConditionals.F969", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF969 )
-		pFnF969 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F969" );
+	UFunction* const pFnF969 = pFnF969Ref.Get ( );
 
 	UBioAutoConditionals_execF969_Parms F969_Parms;
 	F969_Parms.bioWorld = bioWorld;
@@ -11754,10 +11242,9 @@ bool UBioAutoConditionals::F969 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1501 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1501 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1501Ref { L"Function PlotManager.BioAutoConditionals.F1501", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1501 )
-		pFnF1501 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1501" );
+	UFunction* const pFnF1501 = pFnF1501Ref.Get ( );
 
 	UBioAutoConditionals_execF1501_Parms F1501_Parms;
 	F1501_Parms.bioWorld = bioWorld;
@@ -11777,10 +11264,9 @@ bool UBioAutoConditionals::F1501 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1347 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1347 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1347Ref { L"Function PlotManager.BioAutoConditionals.F1347", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1347 )
-		pFnF1347 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1347" );
+	UFunction* const pFnF1347 = pFnF1347Ref.Get ( );
 
 	UBioAutoConditionals_execF1347_Parms F1347_Parms;
 	F1347_Parms.bioWorld = bioWorld;
@@ -11800,10 +11286,9 @@ bool UBioAutoConditionals::F1347 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1346 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1346 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1346Ref { L"Function PlotManager.BioAutoConditionals.F1346", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1346 )
-		pFnF1346 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1346" );
+	UFunction* const pFnF1346 = pFnF1346Ref.Get ( );
 
 	UBioAutoConditionals_execF1346_Parms F1346_Parms;
 	F1346_Parms.bioWorld = bioWorld;
@@ -11823,10 +11308,9 @@ bool UBioAutoConditionals::F1346 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F990 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF990 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF990Ref { L"Function PlotManager.BioAutoConditionals.F990", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF990 )
-		pFnF990 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F990" );
+	UFunction* const pFnF990 = pFnF990Ref.Get ( );
 
 	UBioAutoConditionals_execF990_Parms F990_Parms;
 	F990_Parms.bioWorld = bioWorld;
@@ -11846,10 +11330,9 @@ bool UBioAutoConditionals::F990 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F989 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF989 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF989Ref { L"Function PlotManager.BioAutoConditionals.F989", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF989 )
-		pFnF989 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F989" );
+	UFunction* const pFnF989 = pFnF989Ref.Get ( );
 
 	UBioAutoConditionals_execF989_Parms F989_Parms;
 	F989_Parms.bioWorld = bioWorld;
@@ -11869,10 +11352,9 @@ bool UBioAutoConditionals::F989 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1500 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1500 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1500Ref { L"Function PlotManager.BioAutoConditionals.F1500", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1500 )
-		pFnF1500 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1500" );
+	UFunction* const pFnF1500 = pFnF1500Ref.Get ( );
 
 	UBioAutoConditionals_execF1500_Parms F1500_Parms;
 	F1500_Parms.bioWorld = bioWorld;
@@ -11892,10 +11374,9 @@ bool UBioAutoConditionals::F1500 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1373 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1373 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1373Ref { L"Function PlotManager.BioAutoConditionals.F1373", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1373 )
-		pFnF1373 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1373" );
+	UFunction* const pFnF1373 = pFnF1373Ref.Get ( );
 
 	UBioAutoConditionals_execF1373_Parms F1373_Parms;
 	F1373_Parms.bioWorld = bioWorld;
@@ -11915,10 +11396,9 @@ bool UBioAutoConditionals::F1373 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1372 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1372 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1372Ref { L"Function PlotManager.BioAutoConditionals.F1372", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1372 )
-		pFnF1372 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1372" );
+	UFunction* const pFnF1372 = pFnF1372Ref.Get ( );
 
 	UBioAutoConditionals_execF1372_Parms F1372_Parms;
 	F1372_Parms.bioWorld = bioWorld;
@@ -11938,10 +11418,9 @@ bool UBioAutoConditionals::F1372 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1371 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1371 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1371Ref { L"Function PlotManager.BioAutoConditionals.F1371", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1371 )
-		pFnF1371 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1371" );
+	UFunction* const pFnF1371 = pFnF1371Ref.Get ( );
 
 	UBioAutoConditionals_execF1371_Parms F1371_Parms;
 	F1371_Parms.bioWorld = bioWorld;
@@ -11961,10 +11440,9 @@ bool UBioAutoConditionals::F1371 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1499 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1499 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1499Ref { L"Function PlotManager.BioAutoConditionals.F1499", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1499 )
-		pFnF1499 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1499" );
+	UFunction* const pFnF1499 = pFnF1499Ref.Get ( );
 
 	UBioAutoConditionals_execF1499_Parms F1499_Parms;
 	F1499_Parms.bioWorld = bioWorld;
@@ -11984,10 +11462,9 @@ bool UBioAutoConditionals::F1499 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1378 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1378 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1378Ref { L"Function PlotManager.BioAutoConditionals.F1378", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1378 )
-		pFnF1378 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1378" );
+	UFunction* const pFnF1378 = pFnF1378Ref.Get ( );
 
 	UBioAutoConditionals_execF1378_Parms F1378_Parms;
 	F1378_Parms.bioWorld = bioWorld;
@@ -12007,10 +11484,9 @@ bool UBioAutoConditionals::F1378 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1377 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1377 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1377Ref { L"Function PlotManager.BioAutoConditionals.F1377", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1377 )
-		pFnF1377 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1377" );
+	UFunction* const pFnF1377 = pFnF1377Ref.Get ( );
 
 	UBioAutoConditionals_execF1377_Parms F1377_Parms;
 	F1377_Parms.bioWorld = bioWorld;
@@ -12030,10 +11506,9 @@ bool UBioAutoConditionals::F1377 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1376 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1376 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1376Ref { L"Function PlotManager.BioAutoConditionals.F1376", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1376 )
-		pFnF1376 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1376" );
+	UFunction* const pFnF1376 = pFnF1376Ref.Get ( );
 
 	UBioAutoConditionals_execF1376_Parms F1376_Parms;
 	F1376_Parms.bioWorld = bioWorld;
@@ -12053,10 +11528,9 @@ bool UBioAutoConditionals::F1376 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1361 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1361 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1361Ref { L"Function PlotManager.BioAutoConditionals.F1361", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1361 )
-		pFnF1361 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1361" );
+	UFunction* const pFnF1361 = pFnF1361Ref.Get ( );
 
 	UBioAutoConditionals_execF1361_Parms F1361_Parms;
 	F1361_Parms.bioWorld = bioWorld;
@@ -12076,10 +11550,9 @@ bool UBioAutoConditionals::F1361 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1359 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1359 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1359Ref { L"Function PlotManager.BioAutoConditionals.F1359", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1359 )
-		pFnF1359 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1359" );
+	UFunction* const pFnF1359 = pFnF1359Ref.Get ( );
 
 	UBioAutoConditionals_execF1359_Parms F1359_Parms;
 	F1359_Parms.bioWorld = bioWorld;
@@ -12099,10 +11572,9 @@ bool UBioAutoConditionals::F1359 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1358 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1358 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1358Ref { L"Function PlotManager.BioAutoConditionals.F1358", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1358 )
-		pFnF1358 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1358" );
+	UFunction* const pFnF1358 = pFnF1358Ref.Get ( );
 
 	UBioAutoConditionals_execF1358_Parms F1358_Parms;
 	F1358_Parms.bioWorld = bioWorld;
@@ -12122,10 +11594,9 @@ bool UBioAutoConditionals::F1358 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1357 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1357 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1357Ref { L"Function PlotManager.BioAutoConditionals.F1357", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1357 )
-		pFnF1357 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1357" );
+	UFunction* const pFnF1357 = pFnF1357Ref.Get ( );
 
 	UBioAutoConditionals_execF1357_Parms F1357_Parms;
 	F1357_Parms.bioWorld = bioWorld;
@@ -12145,10 +11616,9 @@ bool UBioAutoConditionals::F1357 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1656 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1656 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1656Ref { L"Function PlotManager.BioAutoConditionals.F1656", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1656 )
-		pFnF1656 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1656" );
+	UFunction* const pFnF1656 = pFnF1656Ref.Get ( );
 
 	UBioAutoConditionals_execF1656_Parms F1656_Parms;
 	F1656_Parms.bioWorld = bioWorld;
@@ -12168,10 +11638,9 @@ bool UBioAutoConditionals::F1656 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1498 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1498 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1498Ref { L"Function PlotManager.BioAutoConditionals.F1498", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1498 )
-		pFnF1498 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1498" );
+	UFunction* const pFnF1498 = pFnF1498Ref.Get ( );
 
 	UBioAutoConditionals_execF1498_Parms F1498_Parms;
 	F1498_Parms.bioWorld = bioWorld;
@@ -12191,10 +11660,9 @@ bool UBioAutoConditionals::F1498 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1381 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1381 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1381Ref { L"Function PlotManager.BioAutoConditionals.F1381", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1381 )
-		pFnF1381 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1381" );
+	UFunction* const pFnF1381 = pFnF1381Ref.Get ( );
 
 	UBioAutoConditionals_execF1381_Parms F1381_Parms;
 	F1381_Parms.bioWorld = bioWorld;
@@ -12214,10 +11682,9 @@ bool UBioAutoConditionals::F1381 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1496 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1496 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1496Ref { L"Function PlotManager.BioAutoConditionals.F1496", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1496 )
-		pFnF1496 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1496" );
+	UFunction* const pFnF1496 = pFnF1496Ref.Get ( );
 
 	UBioAutoConditionals_execF1496_Parms F1496_Parms;
 	F1496_Parms.bioWorld = bioWorld;
@@ -12237,10 +11704,9 @@ bool UBioAutoConditionals::F1496 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1334 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1334 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1334Ref { L"Function PlotManager.BioAutoConditionals.F1334", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1334 )
-		pFnF1334 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1334" );
+	UFunction* const pFnF1334 = pFnF1334Ref.Get ( );
 
 	UBioAutoConditionals_execF1334_Parms F1334_Parms;
 	F1334_Parms.bioWorld = bioWorld;
@@ -12260,10 +11726,9 @@ bool UBioAutoConditionals::F1334 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1333 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1333 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1333Ref { L"Function PlotManager.BioAutoConditionals.F1333", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1333 )
-		pFnF1333 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1333" );
+	UFunction* const pFnF1333 = pFnF1333Ref.Get ( );
 
 	UBioAutoConditionals_execF1333_Parms F1333_Parms;
 	F1333_Parms.bioWorld = bioWorld;
@@ -12283,10 +11748,9 @@ bool UBioAutoConditionals::F1333 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1275 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1275 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1275Ref { L"Function PlotManager.BioAutoConditionals.F1275", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1275 )
-		pFnF1275 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1275" );
+	UFunction* const pFnF1275 = pFnF1275Ref.Get ( );
 
 	UBioAutoConditionals_execF1275_Parms F1275_Parms;
 	F1275_Parms.bioWorld = bioWorld;
@@ -12306,10 +11770,9 @@ bool UBioAutoConditionals::F1275 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1274 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1274 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1274Ref { L"Function PlotManager.BioAutoConditionals.F1274", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1274 )
-		pFnF1274 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1274" );
+	UFunction* const pFnF1274 = pFnF1274Ref.Get ( );
 
 	UBioAutoConditionals_execF1274_Parms F1274_Parms;
 	F1274_Parms.bioWorld = bioWorld;
@@ -12329,10 +11792,9 @@ bool UBioAutoConditionals::F1274 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1273 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1273 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1273Ref { L"Function PlotManager.BioAutoConditionals.F1273", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1273 )
-		pFnF1273 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1273" );
+	UFunction* const pFnF1273 = pFnF1273Ref.Get ( );
 
 	UBioAutoConditionals_execF1273_Parms F1273_Parms;
 	F1273_Parms.bioWorld = bioWorld;
@@ -12352,10 +11814,9 @@ bool UBioAutoConditionals::F1273 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1269 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1269 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1269Ref { L"Function PlotManager.BioAutoConditionals.F1269", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1269 )
-		pFnF1269 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1269" );
+	UFunction* const pFnF1269 = pFnF1269Ref.Get ( );
 
 	UBioAutoConditionals_execF1269_Parms F1269_Parms;
 	F1269_Parms.bioWorld = bioWorld;
@@ -12375,10 +11836,9 @@ bool UBioAutoConditionals::F1269 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1492 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1492 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1492Ref { L"Function PlotManager.BioAutoConditionals.F1492", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1492 )
-		pFnF1492 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1492" );
+	UFunction* const pFnF1492 = pFnF1492Ref.Get ( );
 
 	UBioAutoConditionals_execF1492_Parms F1492_Parms;
 	F1492_Parms.bioWorld = bioWorld;
@@ -12398,10 +11858,9 @@ bool UBioAutoConditionals::F1492 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1410 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1410 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1410Ref { L"Function PlotManager.BioAutoConditionals.F1410", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1410 )
-		pFnF1410 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1410" );
+	UFunction* const pFnF1410 = pFnF1410Ref.Get ( );
 
 	UBioAutoConditionals_execF1410_Parms F1410_Parms;
 	F1410_Parms.bioWorld = bioWorld;
@@ -12421,10 +11880,9 @@ bool UBioAutoConditionals::F1410 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1401 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1401 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1401Ref { L"Function PlotManager.BioAutoConditionals.F1401", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1401 )
-		pFnF1401 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1401" );
+	UFunction* const pFnF1401 = pFnF1401Ref.Get ( );
 
 	UBioAutoConditionals_execF1401_Parms F1401_Parms;
 	F1401_Parms.bioWorld = bioWorld;
@@ -12444,10 +11902,9 @@ bool UBioAutoConditionals::F1401 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1400 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1400 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1400Ref { L"Function PlotManager.BioAutoConditionals.F1400", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1400 )
-		pFnF1400 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1400" );
+	UFunction* const pFnF1400 = pFnF1400Ref.Get ( );
 
 	UBioAutoConditionals_execF1400_Parms F1400_Parms;
 	F1400_Parms.bioWorld = bioWorld;
@@ -12467,10 +11924,9 @@ bool UBioAutoConditionals::F1400 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1491 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1491 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1491Ref { L"Function PlotManager.BioAutoConditionals.F1491", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1491 )
-		pFnF1491 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1491" );
+	UFunction* const pFnF1491 = pFnF1491Ref.Get ( );
 
 	UBioAutoConditionals_execF1491_Parms F1491_Parms;
 	F1491_Parms.bioWorld = bioWorld;
@@ -12490,10 +11946,9 @@ bool UBioAutoConditionals::F1491 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1382 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1382 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1382Ref { L"Function PlotManager.BioAutoConditionals.F1382", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1382 )
-		pFnF1382 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1382" );
+	UFunction* const pFnF1382 = pFnF1382Ref.Get ( );
 
 	UBioAutoConditionals_execF1382_Parms F1382_Parms;
 	F1382_Parms.bioWorld = bioWorld;
@@ -12513,10 +11968,9 @@ bool UBioAutoConditionals::F1382 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1356 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1356 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1356Ref { L"Function PlotManager.BioAutoConditionals.F1356", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1356 )
-		pFnF1356 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1356" );
+	UFunction* const pFnF1356 = pFnF1356Ref.Get ( );
 
 	UBioAutoConditionals_execF1356_Parms F1356_Parms;
 	F1356_Parms.bioWorld = bioWorld;
@@ -12536,10 +11990,9 @@ bool UBioAutoConditionals::F1356 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1354 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1354 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1354Ref { L"Function PlotManager.BioAutoConditionals.F1354", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1354 )
-		pFnF1354 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1354" );
+	UFunction* const pFnF1354 = pFnF1354Ref.Get ( );
 
 	UBioAutoConditionals_execF1354_Parms F1354_Parms;
 	F1354_Parms.bioWorld = bioWorld;
@@ -12559,10 +12012,9 @@ bool UBioAutoConditionals::F1354 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1353 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1353 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1353Ref { L"Function PlotManager.BioAutoConditionals.F1353", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1353 )
-		pFnF1353 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1353" );
+	UFunction* const pFnF1353 = pFnF1353Ref.Get ( );
 
 	UBioAutoConditionals_execF1353_Parms F1353_Parms;
 	F1353_Parms.bioWorld = bioWorld;
@@ -12582,10 +12034,9 @@ bool UBioAutoConditionals::F1353 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1404 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1404 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1404Ref { L"Function PlotManager.BioAutoConditionals.F1404", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1404 )
-		pFnF1404 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1404" );
+	UFunction* const pFnF1404 = pFnF1404Ref.Get ( );
 
 	UBioAutoConditionals_execF1404_Parms F1404_Parms;
 	F1404_Parms.bioWorld = bioWorld;
@@ -12605,10 +12056,9 @@ bool UBioAutoConditionals::F1404 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1403 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1403 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1403Ref { L"Function PlotManager.BioAutoConditionals.F1403", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1403 )
-		pFnF1403 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1403" );
+	UFunction* const pFnF1403 = pFnF1403Ref.Get ( );
 
 	UBioAutoConditionals_execF1403_Parms F1403_Parms;
 	F1403_Parms.bioWorld = bioWorld;
@@ -12628,10 +12078,9 @@ bool UBioAutoConditionals::F1403 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1654 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1654 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1654Ref { L"Function PlotManager.BioAutoConditionals.F1654", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1654 )
-		pFnF1654 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1654" );
+	UFunction* const pFnF1654 = pFnF1654Ref.Get ( );
 
 	UBioAutoConditionals_execF1654_Parms F1654_Parms;
 	F1654_Parms.bioWorld = bioWorld;
@@ -12651,10 +12100,9 @@ bool UBioAutoConditionals::F1654 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1389 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1389 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1389Ref { L"Function PlotManager.BioAutoConditionals.F1389", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1389 )
-		pFnF1389 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1389" );
+	UFunction* const pFnF1389 = pFnF1389Ref.Get ( );
 
 	UBioAutoConditionals_execF1389_Parms F1389_Parms;
 	F1389_Parms.bioWorld = bioWorld;
@@ -12674,10 +12122,9 @@ bool UBioAutoConditionals::F1389 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1147 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1147 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1147Ref { L"Function PlotManager.BioAutoConditionals.F1147", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1147 )
-		pFnF1147 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1147" );
+	UFunction* const pFnF1147 = pFnF1147Ref.Get ( );
 
 	UBioAutoConditionals_execF1147_Parms F1147_Parms;
 	F1147_Parms.bioWorld = bioWorld;
@@ -12697,10 +12144,9 @@ bool UBioAutoConditionals::F1147 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1086 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1086 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1086Ref { L"Function PlotManager.BioAutoConditionals.F1086", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1086 )
-		pFnF1086 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1086" );
+	UFunction* const pFnF1086 = pFnF1086Ref.Get ( );
 
 	UBioAutoConditionals_execF1086_Parms F1086_Parms;
 	F1086_Parms.bioWorld = bioWorld;
@@ -12720,10 +12166,9 @@ bool UBioAutoConditionals::F1086 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F952 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF952 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF952Ref { L"Function PlotManager.BioAutoConditionals.F952", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF952 )
-		pFnF952 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F952" );
+	UFunction* const pFnF952 = pFnF952Ref.Get ( );
 
 	UBioAutoConditionals_execF952_Parms F952_Parms;
 	F952_Parms.bioWorld = bioWorld;
@@ -12743,10 +12188,9 @@ bool UBioAutoConditionals::F952 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F951 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF951 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF951Ref { L"Function PlotManager.BioAutoConditionals.F951", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF951 )
-		pFnF951 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F951" );
+	UFunction* const pFnF951 = pFnF951Ref.Get ( );
 
 	UBioAutoConditionals_execF951_Parms F951_Parms;
 	F951_Parms.bioWorld = bioWorld;
@@ -12766,10 +12210,9 @@ bool UBioAutoConditionals::F951 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F950 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF950 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF950Ref { L"Function PlotManager.BioAutoConditionals.F950", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF950 )
-		pFnF950 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F950" );
+	UFunction* const pFnF950 = pFnF950Ref.Get ( );
 
 	UBioAutoConditionals_execF950_Parms F950_Parms;
 	F950_Parms.bioWorld = bioWorld;
@@ -12789,10 +12232,9 @@ bool UBioAutoConditionals::F950 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1490 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1490 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1490Ref { L"Function PlotManager.BioAutoConditionals.F1490", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1490 )
-		pFnF1490 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1490" );
+	UFunction* const pFnF1490 = pFnF1490Ref.Get ( );
 
 	UBioAutoConditionals_execF1490_Parms F1490_Parms;
 	F1490_Parms.bioWorld = bioWorld;
@@ -12812,10 +12254,9 @@ bool UBioAutoConditionals::F1490 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1365 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1365 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1365Ref { L"Function PlotManager.BioAutoConditionals.F1365", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1365 )
-		pFnF1365 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1365" );
+	UFunction* const pFnF1365 = pFnF1365Ref.Get ( );
 
 	UBioAutoConditionals_execF1365_Parms F1365_Parms;
 	F1365_Parms.bioWorld = bioWorld;
@@ -12835,10 +12276,9 @@ bool UBioAutoConditionals::F1365 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1364 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1364 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1364Ref { L"Function PlotManager.BioAutoConditionals.F1364", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1364 )
-		pFnF1364 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1364" );
+	UFunction* const pFnF1364 = pFnF1364Ref.Get ( );
 
 	UBioAutoConditionals_execF1364_Parms F1364_Parms;
 	F1364_Parms.bioWorld = bioWorld;
@@ -12858,10 +12298,9 @@ bool UBioAutoConditionals::F1364 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1363 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1363 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1363Ref { L"Function PlotManager.BioAutoConditionals.F1363", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1363 )
-		pFnF1363 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1363" );
+	UFunction* const pFnF1363 = pFnF1363Ref.Get ( );
 
 	UBioAutoConditionals_execF1363_Parms F1363_Parms;
 	F1363_Parms.bioWorld = bioWorld;
@@ -12881,10 +12320,9 @@ bool UBioAutoConditionals::F1363 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1362 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1362 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1362Ref { L"Function PlotManager.BioAutoConditionals.F1362", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1362 )
-		pFnF1362 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1362" );
+	UFunction* const pFnF1362 = pFnF1362Ref.Get ( );
 
 	UBioAutoConditionals_execF1362_Parms F1362_Parms;
 	F1362_Parms.bioWorld = bioWorld;
@@ -12904,10 +12342,9 @@ bool UBioAutoConditionals::F1362 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F899 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF899 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF899Ref { L"Function PlotManager.BioAutoConditionals.F899", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF899 )
-		pFnF899 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F899" );
+	UFunction* const pFnF899 = pFnF899Ref.Get ( );
 
 	UBioAutoConditionals_execF899_Parms F899_Parms;
 	F899_Parms.bioWorld = bioWorld;
@@ -12927,10 +12364,9 @@ bool UBioAutoConditionals::F899 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F838 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF838 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF838Ref { L"Function PlotManager.BioAutoConditionals.F838", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF838 )
-		pFnF838 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F838" );
+	UFunction* const pFnF838 = pFnF838Ref.Get ( );
 
 	UBioAutoConditionals_execF838_Parms F838_Parms;
 	F838_Parms.bioWorld = bioWorld;
@@ -12950,10 +12386,9 @@ bool UBioAutoConditionals::F838 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F837 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF837 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF837Ref { L"Function PlotManager.BioAutoConditionals.F837", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF837 )
-		pFnF837 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F837" );
+	UFunction* const pFnF837 = pFnF837Ref.Get ( );
 
 	UBioAutoConditionals_execF837_Parms F837_Parms;
 	F837_Parms.bioWorld = bioWorld;
@@ -12973,10 +12408,9 @@ bool UBioAutoConditionals::F837 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F503 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF503 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF503Ref { L"Function PlotManager.BioAutoConditionals.F503", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF503 )
-		pFnF503 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F503" );
+	UFunction* const pFnF503 = pFnF503Ref.Get ( );
 
 	UBioAutoConditionals_execF503_Parms F503_Parms;
 	F503_Parms.bioWorld = bioWorld;
@@ -12996,10 +12430,9 @@ bool UBioAutoConditionals::F503 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F501 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF501 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF501Ref { L"Function PlotManager.BioAutoConditionals.F501", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF501 )
-		pFnF501 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F501" );
+	UFunction* const pFnF501 = pFnF501Ref.Get ( );
 
 	UBioAutoConditionals_execF501_Parms F501_Parms;
 	F501_Parms.bioWorld = bioWorld;
@@ -13019,10 +12452,9 @@ bool UBioAutoConditionals::F501 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F500 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF500 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF500Ref { L"Function PlotManager.BioAutoConditionals.F500", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF500 )
-		pFnF500 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F500" );
+	UFunction* const pFnF500 = pFnF500Ref.Get ( );
 
 	UBioAutoConditionals_execF500_Parms F500_Parms;
 	F500_Parms.bioWorld = bioWorld;
@@ -13042,10 +12474,9 @@ bool UBioAutoConditionals::F500 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F499 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF499 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF499Ref { L"Function PlotManager.BioAutoConditionals.F499", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF499 )
-		pFnF499 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F499" );
+	UFunction* const pFnF499 = pFnF499Ref.Get ( );
 
 	UBioAutoConditionals_execF499_Parms F499_Parms;
 	F499_Parms.bioWorld = bioWorld;
@@ -13065,10 +12496,9 @@ bool UBioAutoConditionals::F499 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F444 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF444 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF444Ref { L"Function PlotManager.BioAutoConditionals.F444", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF444 )
-		pFnF444 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F444" );
+	UFunction* const pFnF444 = pFnF444Ref.Get ( );
 
 	UBioAutoConditionals_execF444_Parms F444_Parms;
 	F444_Parms.bioWorld = bioWorld;
@@ -13088,10 +12518,9 @@ bool UBioAutoConditionals::F444 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F529 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF529 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF529Ref { L"Function PlotManager.BioAutoConditionals.F529", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF529 )
-		pFnF529 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F529" );
+	UFunction* const pFnF529 = pFnF529Ref.Get ( );
 
 	UBioAutoConditionals_execF529_Parms F529_Parms;
 	F529_Parms.bioWorld = bioWorld;
@@ -13111,10 +12540,9 @@ bool UBioAutoConditionals::F529 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F182 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF182 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF182Ref { L"Function PlotManager.BioAutoConditionals.F182", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF182 )
-		pFnF182 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F182" );
+	UFunction* const pFnF182 = pFnF182Ref.Get ( );
 
 	UBioAutoConditionals_execF182_Parms F182_Parms;
 	F182_Parms.bioWorld = bioWorld;
@@ -13134,10 +12562,9 @@ bool UBioAutoConditionals::F182 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F173 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF173 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF173Ref { L"Function PlotManager.BioAutoConditionals.F173", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF173 )
-		pFnF173 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F173" );
+	UFunction* const pFnF173 = pFnF173Ref.Get ( );
 
 	UBioAutoConditionals_execF173_Parms F173_Parms;
 	F173_Parms.bioWorld = bioWorld;
@@ -13157,10 +12584,9 @@ bool UBioAutoConditionals::F173 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F512 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF512 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF512Ref { L"Function PlotManager.BioAutoConditionals.F512", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF512 )
-		pFnF512 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F512" );
+	UFunction* const pFnF512 = pFnF512Ref.Get ( );
 
 	UBioAutoConditionals_execF512_Parms F512_Parms;
 	F512_Parms.bioWorld = bioWorld;
@@ -13180,10 +12606,9 @@ bool UBioAutoConditionals::F512 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F508 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF508 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF508Ref { L"Function PlotManager.BioAutoConditionals.F508", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF508 )
-		pFnF508 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F508" );
+	UFunction* const pFnF508 = pFnF508Ref.Get ( );
 
 	UBioAutoConditionals_execF508_Parms F508_Parms;
 	F508_Parms.bioWorld = bioWorld;
@@ -13203,10 +12628,9 @@ bool UBioAutoConditionals::F508 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F347 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF347 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF347Ref { L"Function PlotManager.BioAutoConditionals.F347", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF347 )
-		pFnF347 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F347" );
+	UFunction* const pFnF347 = pFnF347Ref.Get ( );
 
 	UBioAutoConditionals_execF347_Parms F347_Parms;
 	F347_Parms.bioWorld = bioWorld;
@@ -13226,10 +12650,9 @@ bool UBioAutoConditionals::F347 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F172 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF172 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF172Ref { L"Function PlotManager.BioAutoConditionals.F172", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF172 )
-		pFnF172 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F172" );
+	UFunction* const pFnF172 = pFnF172Ref.Get ( );
 
 	UBioAutoConditionals_execF172_Parms F172_Parms;
 	F172_Parms.bioWorld = bioWorld;
@@ -13249,10 +12672,9 @@ bool UBioAutoConditionals::F172 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F166 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF166 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF166Ref { L"Function PlotManager.BioAutoConditionals.F166", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF166 )
-		pFnF166 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F166" );
+	UFunction* const pFnF166 = pFnF166Ref.Get ( );
 
 	UBioAutoConditionals_execF166_Parms F166_Parms;
 	F166_Parms.bioWorld = bioWorld;
@@ -13272,10 +12694,9 @@ bool UBioAutoConditionals::F166 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F505 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF505 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF505Ref { L"Function PlotManager.BioAutoConditionals.F505", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF505 )
-		pFnF505 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F505" );
+	UFunction* const pFnF505 = pFnF505Ref.Get ( );
 
 	UBioAutoConditionals_execF505_Parms F505_Parms;
 	F505_Parms.bioWorld = bioWorld;
@@ -13295,10 +12716,9 @@ bool UBioAutoConditionals::F505 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F164 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF164 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF164Ref { L"Function PlotManager.BioAutoConditionals.F164", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF164 )
-		pFnF164 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F164" );
+	UFunction* const pFnF164 = pFnF164Ref.Get ( );
 
 	UBioAutoConditionals_execF164_Parms F164_Parms;
 	F164_Parms.bioWorld = bioWorld;
@@ -13318,10 +12738,9 @@ bool UBioAutoConditionals::F164 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F526 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF526 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF526Ref { L"Function PlotManager.BioAutoConditionals.F526", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF526 )
-		pFnF526 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F526" );
+	UFunction* const pFnF526 = pFnF526Ref.Get ( );
 
 	UBioAutoConditionals_execF526_Parms F526_Parms;
 	F526_Parms.bioWorld = bioWorld;
@@ -13341,10 +12760,9 @@ bool UBioAutoConditionals::F526 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F511 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF511 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF511Ref { L"Function PlotManager.BioAutoConditionals.F511", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF511 )
-		pFnF511 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F511" );
+	UFunction* const pFnF511 = pFnF511Ref.Get ( );
 
 	UBioAutoConditionals_execF511_Parms F511_Parms;
 	F511_Parms.bioWorld = bioWorld;
@@ -13364,10 +12782,9 @@ bool UBioAutoConditionals::F511 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F510 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF510 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF510Ref { L"Function PlotManager.BioAutoConditionals.F510", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF510 )
-		pFnF510 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F510" );
+	UFunction* const pFnF510 = pFnF510Ref.Get ( );
 
 	UBioAutoConditionals_execF510_Parms F510_Parms;
 	F510_Parms.bioWorld = bioWorld;
@@ -13387,10 +12804,9 @@ bool UBioAutoConditionals::F510 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F509 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF509 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF509Ref { L"Function PlotManager.BioAutoConditionals.F509", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF509 )
-		pFnF509 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F509" );
+	UFunction* const pFnF509 = pFnF509Ref.Get ( );
 
 	UBioAutoConditionals_execF509_Parms F509_Parms;
 	F509_Parms.bioWorld = bioWorld;
@@ -13410,10 +12826,9 @@ bool UBioAutoConditionals::F509 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F507 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF507 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF507Ref { L"Function PlotManager.BioAutoConditionals.F507", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF507 )
-		pFnF507 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F507" );
+	UFunction* const pFnF507 = pFnF507Ref.Get ( );
 
 	UBioAutoConditionals_execF507_Parms F507_Parms;
 	F507_Parms.bioWorld = bioWorld;
@@ -13433,10 +12848,9 @@ bool UBioAutoConditionals::F507 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F506 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF506 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF506Ref { L"Function PlotManager.BioAutoConditionals.F506", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF506 )
-		pFnF506 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F506" );
+	UFunction* const pFnF506 = pFnF506Ref.Get ( );
 
 	UBioAutoConditionals_execF506_Parms F506_Parms;
 	F506_Parms.bioWorld = bioWorld;
@@ -13456,10 +12870,9 @@ bool UBioAutoConditionals::F506 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F348 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF348 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF348Ref { L"Function PlotManager.BioAutoConditionals.F348", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF348 )
-		pFnF348 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F348" );
+	UFunction* const pFnF348 = pFnF348Ref.Get ( );
 
 	UBioAutoConditionals_execF348_Parms F348_Parms;
 	F348_Parms.bioWorld = bioWorld;
@@ -13479,10 +12892,9 @@ bool UBioAutoConditionals::F348 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F222 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF222 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF222Ref { L"Function PlotManager.BioAutoConditionals.F222", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF222 )
-		pFnF222 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F222" );
+	UFunction* const pFnF222 = pFnF222Ref.Get ( );
 
 	UBioAutoConditionals_execF222_Parms F222_Parms;
 	F222_Parms.bioWorld = bioWorld;
@@ -13502,10 +12914,9 @@ bool UBioAutoConditionals::F222 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1644 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1644 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1644Ref { L"Function PlotManager.BioAutoConditionals.F1644", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1644 )
-		pFnF1644 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1644" );
+	UFunction* const pFnF1644 = pFnF1644Ref.Get ( );
 
 	UBioAutoConditionals_execF1644_Parms F1644_Parms;
 	F1644_Parms.bioWorld = bioWorld;
@@ -13525,10 +12936,9 @@ bool UBioAutoConditionals::F1644 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1643 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1643 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1643Ref { L"Function PlotManager.BioAutoConditionals.F1643", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1643 )
-		pFnF1643 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1643" );
+	UFunction* const pFnF1643 = pFnF1643Ref.Get ( );
 
 	UBioAutoConditionals_execF1643_Parms F1643_Parms;
 	F1643_Parms.bioWorld = bioWorld;
@@ -13548,10 +12958,9 @@ bool UBioAutoConditionals::F1643 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1483 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1483 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1483Ref { L"Function PlotManager.BioAutoConditionals.F1483", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1483 )
-		pFnF1483 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1483" );
+	UFunction* const pFnF1483 = pFnF1483Ref.Get ( );
 
 	UBioAutoConditionals_execF1483_Parms F1483_Parms;
 	F1483_Parms.bioWorld = bioWorld;
@@ -13571,10 +12980,9 @@ bool UBioAutoConditionals::F1483 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1257 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1257 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1257Ref { L"Function PlotManager.BioAutoConditionals.F1257", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1257 )
-		pFnF1257 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1257" );
+	UFunction* const pFnF1257 = pFnF1257Ref.Get ( );
 
 	UBioAutoConditionals_execF1257_Parms F1257_Parms;
 	F1257_Parms.bioWorld = bioWorld;
@@ -13594,10 +13002,9 @@ bool UBioAutoConditionals::F1257 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1234 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1234 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1234Ref { L"Function PlotManager.BioAutoConditionals.F1234", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1234 )
-		pFnF1234 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1234" );
+	UFunction* const pFnF1234 = pFnF1234Ref.Get ( );
 
 	UBioAutoConditionals_execF1234_Parms F1234_Parms;
 	F1234_Parms.bioWorld = bioWorld;
@@ -13617,10 +13024,9 @@ bool UBioAutoConditionals::F1234 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1233 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1233 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1233Ref { L"Function PlotManager.BioAutoConditionals.F1233", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1233 )
-		pFnF1233 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1233" );
+	UFunction* const pFnF1233 = pFnF1233Ref.Get ( );
 
 	UBioAutoConditionals_execF1233_Parms F1233_Parms;
 	F1233_Parms.bioWorld = bioWorld;
@@ -13640,10 +13046,9 @@ bool UBioAutoConditionals::F1233 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1232 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1232 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1232Ref { L"Function PlotManager.BioAutoConditionals.F1232", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1232 )
-		pFnF1232 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1232" );
+	UFunction* const pFnF1232 = pFnF1232Ref.Get ( );
 
 	UBioAutoConditionals_execF1232_Parms F1232_Parms;
 	F1232_Parms.bioWorld = bioWorld;
@@ -13663,10 +13068,9 @@ bool UBioAutoConditionals::F1232 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F804 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF804 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF804Ref { L"Function PlotManager.BioAutoConditionals.F804", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF804 )
-		pFnF804 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F804" );
+	UFunction* const pFnF804 = pFnF804Ref.Get ( );
 
 	UBioAutoConditionals_execF804_Parms F804_Parms;
 	F804_Parms.bioWorld = bioWorld;
@@ -13686,10 +13090,9 @@ bool UBioAutoConditionals::F804 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F803 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF803 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF803Ref { L"Function PlotManager.BioAutoConditionals.F803", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF803 )
-		pFnF803 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F803" );
+	UFunction* const pFnF803 = pFnF803Ref.Get ( );
 
 	UBioAutoConditionals_execF803_Parms F803_Parms;
 	F803_Parms.bioWorld = bioWorld;
@@ -13709,10 +13112,9 @@ bool UBioAutoConditionals::F803 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F802 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF802 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF802Ref { L"Function PlotManager.BioAutoConditionals.F802", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF802 )
-		pFnF802 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F802" );
+	UFunction* const pFnF802 = pFnF802Ref.Get ( );
 
 	UBioAutoConditionals_execF802_Parms F802_Parms;
 	F802_Parms.bioWorld = bioWorld;
@@ -13732,10 +13134,9 @@ bool UBioAutoConditionals::F802 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F677 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF677 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF677Ref { L"Function PlotManager.BioAutoConditionals.F677", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF677 )
-		pFnF677 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F677" );
+	UFunction* const pFnF677 = pFnF677Ref.Get ( );
 
 	UBioAutoConditionals_execF677_Parms F677_Parms;
 	F677_Parms.bioWorld = bioWorld;
@@ -13755,10 +13156,9 @@ bool UBioAutoConditionals::F677 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1733 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1733 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1733Ref { L"Function PlotManager.BioAutoConditionals.F1733", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1733 )
-		pFnF1733 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1733" );
+	UFunction* const pFnF1733 = pFnF1733Ref.Get ( );
 
 	UBioAutoConditionals_execF1733_Parms F1733_Parms;
 	F1733_Parms.bioWorld = bioWorld;
@@ -13778,10 +13178,9 @@ bool UBioAutoConditionals::F1733 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1715 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1715 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1715Ref { L"Function PlotManager.BioAutoConditionals.F1715", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1715 )
-		pFnF1715 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1715" );
+	UFunction* const pFnF1715 = pFnF1715Ref.Get ( );
 
 	UBioAutoConditionals_execF1715_Parms F1715_Parms;
 	F1715_Parms.bioWorld = bioWorld;
@@ -13801,10 +13200,9 @@ bool UBioAutoConditionals::F1715 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1714 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1714 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1714Ref { L"Function PlotManager.BioAutoConditionals.F1714", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1714 )
-		pFnF1714 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1714" );
+	UFunction* const pFnF1714 = pFnF1714Ref.Get ( );
 
 	UBioAutoConditionals_execF1714_Parms F1714_Parms;
 	F1714_Parms.bioWorld = bioWorld;
@@ -13824,10 +13222,9 @@ bool UBioAutoConditionals::F1714 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1484 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1484 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1484Ref { L"Function PlotManager.BioAutoConditionals.F1484", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1484 )
-		pFnF1484 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1484" );
+	UFunction* const pFnF1484 = pFnF1484Ref.Get ( );
 
 	UBioAutoConditionals_execF1484_Parms F1484_Parms;
 	F1484_Parms.bioWorld = bioWorld;
@@ -13847,10 +13244,9 @@ bool UBioAutoConditionals::F1484 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1276 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1276 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1276Ref { L"Function PlotManager.BioAutoConditionals.F1276", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1276 )
-		pFnF1276 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1276" );
+	UFunction* const pFnF1276 = pFnF1276Ref.Get ( );
 
 	UBioAutoConditionals_execF1276_Parms F1276_Parms;
 	F1276_Parms.bioWorld = bioWorld;
@@ -13870,10 +13266,9 @@ bool UBioAutoConditionals::F1276 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F796 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF796 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF796Ref { L"Function PlotManager.BioAutoConditionals.F796", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF796 )
-		pFnF796 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F796" );
+	UFunction* const pFnF796 = pFnF796Ref.Get ( );
 
 	UBioAutoConditionals_execF796_Parms F796_Parms;
 	F796_Parms.bioWorld = bioWorld;
@@ -13893,10 +13288,9 @@ bool UBioAutoConditionals::F796 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1485 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1485 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1485Ref { L"Function PlotManager.BioAutoConditionals.F1485", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1485 )
-		pFnF1485 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1485" );
+	UFunction* const pFnF1485 = pFnF1485Ref.Get ( );
 
 	UBioAutoConditionals_execF1485_Parms F1485_Parms;
 	F1485_Parms.bioWorld = bioWorld;
@@ -13916,10 +13310,9 @@ bool UBioAutoConditionals::F1485 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1227 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1227 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1227Ref { L"Function PlotManager.BioAutoConditionals.F1227", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1227 )
-		pFnF1227 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1227" );
+	UFunction* const pFnF1227 = pFnF1227Ref.Get ( );
 
 	UBioAutoConditionals_execF1227_Parms F1227_Parms;
 	F1227_Parms.bioWorld = bioWorld;
@@ -13939,10 +13332,9 @@ bool UBioAutoConditionals::F1227 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1131 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1131 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1131Ref { L"Function PlotManager.BioAutoConditionals.F1131", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1131 )
-		pFnF1131 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1131" );
+	UFunction* const pFnF1131 = pFnF1131Ref.Get ( );
 
 	UBioAutoConditionals_execF1131_Parms F1131_Parms;
 	F1131_Parms.bioWorld = bioWorld;
@@ -13962,10 +13354,9 @@ bool UBioAutoConditionals::F1131 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1130 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1130 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1130Ref { L"Function PlotManager.BioAutoConditionals.F1130", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1130 )
-		pFnF1130 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1130" );
+	UFunction* const pFnF1130 = pFnF1130Ref.Get ( );
 
 	UBioAutoConditionals_execF1130_Parms F1130_Parms;
 	F1130_Parms.bioWorld = bioWorld;
@@ -13985,10 +13376,9 @@ bool UBioAutoConditionals::F1130 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1129 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1129 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1129Ref { L"Function PlotManager.BioAutoConditionals.F1129", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1129 )
-		pFnF1129 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1129" );
+	UFunction* const pFnF1129 = pFnF1129Ref.Get ( );
 
 	UBioAutoConditionals_execF1129_Parms F1129_Parms;
 	F1129_Parms.bioWorld = bioWorld;
@@ -14008,10 +13398,9 @@ bool UBioAutoConditionals::F1129 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1127 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1127 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1127Ref { L"Function PlotManager.BioAutoConditionals.F1127", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1127 )
-		pFnF1127 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1127" );
+	UFunction* const pFnF1127 = pFnF1127Ref.Get ( );
 
 	UBioAutoConditionals_execF1127_Parms F1127_Parms;
 	F1127_Parms.bioWorld = bioWorld;
@@ -14031,10 +13420,9 @@ bool UBioAutoConditionals::F1127 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1126 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1126 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1126Ref { L"Function PlotManager.BioAutoConditionals.F1126", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1126 )
-		pFnF1126 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1126" );
+	UFunction* const pFnF1126 = pFnF1126Ref.Get ( );
 
 	UBioAutoConditionals_execF1126_Parms F1126_Parms;
 	F1126_Parms.bioWorld = bioWorld;
@@ -14054,10 +13442,9 @@ bool UBioAutoConditionals::F1126 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1565 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1565 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1565Ref { L"Function PlotManager.BioAutoConditionals.F1565", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1565 )
-		pFnF1565 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1565" );
+	UFunction* const pFnF1565 = pFnF1565Ref.Get ( );
 
 	UBioAutoConditionals_execF1565_Parms F1565_Parms;
 	F1565_Parms.bioWorld = bioWorld;
@@ -14077,10 +13464,9 @@ bool UBioAutoConditionals::F1565 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1486 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1486 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1486Ref { L"Function PlotManager.BioAutoConditionals.F1486", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1486 )
-		pFnF1486 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1486" );
+	UFunction* const pFnF1486 = pFnF1486Ref.Get ( );
 
 	UBioAutoConditionals_execF1486_Parms F1486_Parms;
 	F1486_Parms.bioWorld = bioWorld;
@@ -14100,10 +13486,9 @@ bool UBioAutoConditionals::F1486 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1649 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1649 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1649Ref { L"Function PlotManager.BioAutoConditionals.F1649", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1649 )
-		pFnF1649 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1649" );
+	UFunction* const pFnF1649 = pFnF1649Ref.Get ( );
 
 	UBioAutoConditionals_execF1649_Parms F1649_Parms;
 	F1649_Parms.bioWorld = bioWorld;
@@ -14123,10 +13508,9 @@ bool UBioAutoConditionals::F1649 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1488 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1488 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1488Ref { L"Function PlotManager.BioAutoConditionals.F1488", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1488 )
-		pFnF1488 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1488" );
+	UFunction* const pFnF1488 = pFnF1488Ref.Get ( );
 
 	UBioAutoConditionals_execF1488_Parms F1488_Parms;
 	F1488_Parms.bioWorld = bioWorld;
@@ -14146,10 +13530,9 @@ bool UBioAutoConditionals::F1488 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1025 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1025 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1025Ref { L"Function PlotManager.BioAutoConditionals.F1025", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1025 )
-		pFnF1025 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1025" );
+	UFunction* const pFnF1025 = pFnF1025Ref.Get ( );
 
 	UBioAutoConditionals_execF1025_Parms F1025_Parms;
 	F1025_Parms.bioWorld = bioWorld;
@@ -14169,10 +13552,9 @@ bool UBioAutoConditionals::F1025 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1024 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1024 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1024Ref { L"Function PlotManager.BioAutoConditionals.F1024", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1024 )
-		pFnF1024 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1024" );
+	UFunction* const pFnF1024 = pFnF1024Ref.Get ( );
 
 	UBioAutoConditionals_execF1024_Parms F1024_Parms;
 	F1024_Parms.bioWorld = bioWorld;
@@ -14192,10 +13574,9 @@ bool UBioAutoConditionals::F1024 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1023 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1023 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1023Ref { L"Function PlotManager.BioAutoConditionals.F1023", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1023 )
-		pFnF1023 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1023" );
+	UFunction* const pFnF1023 = pFnF1023Ref.Get ( );
 
 	UBioAutoConditionals_execF1023_Parms F1023_Parms;
 	F1023_Parms.bioWorld = bioWorld;
@@ -14215,10 +13596,9 @@ bool UBioAutoConditionals::F1023 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F805 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF805 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF805Ref { L"Function PlotManager.BioAutoConditionals.F805", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF805 )
-		pFnF805 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F805" );
+	UFunction* const pFnF805 = pFnF805Ref.Get ( );
 
 	UBioAutoConditionals_execF805_Parms F805_Parms;
 	F805_Parms.bioWorld = bioWorld;
@@ -14238,10 +13618,9 @@ bool UBioAutoConditionals::F805 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F706 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF706 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF706Ref { L"Function PlotManager.BioAutoConditionals.F706", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF706 )
-		pFnF706 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F706" );
+	UFunction* const pFnF706 = pFnF706Ref.Get ( );
 
 	UBioAutoConditionals_execF706_Parms F706_Parms;
 	F706_Parms.bioWorld = bioWorld;
@@ -14261,10 +13640,9 @@ bool UBioAutoConditionals::F706 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F393 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF393 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF393Ref { L"Function PlotManager.BioAutoConditionals.F393", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF393 )
-		pFnF393 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F393" );
+	UFunction* const pFnF393 = pFnF393Ref.Get ( );
 
 	UBioAutoConditionals_execF393_Parms F393_Parms;
 	F393_Parms.bioWorld = bioWorld;
@@ -14284,10 +13662,9 @@ bool UBioAutoConditionals::F393 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F662 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF662 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF662Ref { L"Function PlotManager.BioAutoConditionals.F662", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF662 )
-		pFnF662 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F662" );
+	UFunction* const pFnF662 = pFnF662Ref.Get ( );
 
 	UBioAutoConditionals_execF662_Parms F662_Parms;
 	F662_Parms.bioWorld = bioWorld;
@@ -14307,10 +13684,9 @@ bool UBioAutoConditionals::F662 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1059 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1059 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1059Ref { L"Function PlotManager.BioAutoConditionals.F1059", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1059 )
-		pFnF1059 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1059" );
+	UFunction* const pFnF1059 = pFnF1059Ref.Get ( );
 
 	UBioAutoConditionals_execF1059_Parms F1059_Parms;
 	F1059_Parms.bioWorld = bioWorld;
@@ -14330,10 +13706,9 @@ bool UBioAutoConditionals::F1059 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1384 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1384 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1384Ref { L"Function PlotManager.BioAutoConditionals.F1384", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1384 )
-		pFnF1384 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1384" );
+	UFunction* const pFnF1384 = pFnF1384Ref.Get ( );
 
 	UBioAutoConditionals_execF1384_Parms F1384_Parms;
 	F1384_Parms.bioWorld = bioWorld;
@@ -14353,10 +13728,9 @@ bool UBioAutoConditionals::F1384 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1383 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1383 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1383Ref { L"Function PlotManager.BioAutoConditionals.F1383", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1383 )
-		pFnF1383 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1383" );
+	UFunction* const pFnF1383 = pFnF1383Ref.Get ( );
 
 	UBioAutoConditionals_execF1383_Parms F1383_Parms;
 	F1383_Parms.bioWorld = bioWorld;
@@ -14376,10 +13750,9 @@ bool UBioAutoConditionals::F1383 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1409 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1409 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1409Ref { L"Function PlotManager.BioAutoConditionals.F1409", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1409 )
-		pFnF1409 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1409" );
+	UFunction* const pFnF1409 = pFnF1409Ref.Get ( );
 
 	UBioAutoConditionals_execF1409_Parms F1409_Parms;
 	F1409_Parms.bioWorld = bioWorld;
@@ -14399,10 +13772,9 @@ bool UBioAutoConditionals::F1409 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1341 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1341 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1341Ref { L"Function PlotManager.BioAutoConditionals.F1341", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1341 )
-		pFnF1341 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1341" );
+	UFunction* const pFnF1341 = pFnF1341Ref.Get ( );
 
 	UBioAutoConditionals_execF1341_Parms F1341_Parms;
 	F1341_Parms.bioWorld = bioWorld;
@@ -14422,10 +13794,9 @@ bool UBioAutoConditionals::F1341 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1594 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1594 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1594Ref { L"Function PlotManager.BioAutoConditionals.F1594", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1594 )
-		pFnF1594 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1594" );
+	UFunction* const pFnF1594 = pFnF1594Ref.Get ( );
 
 	UBioAutoConditionals_execF1594_Parms F1594_Parms;
 	F1594_Parms.bioWorld = bioWorld;
@@ -14445,10 +13816,9 @@ bool UBioAutoConditionals::F1594 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F398 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF398 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF398Ref { L"Function PlotManager.BioAutoConditionals.F398", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF398 )
-		pFnF398 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F398" );
+	UFunction* const pFnF398 = pFnF398Ref.Get ( );
 
 	UBioAutoConditionals_execF398_Parms F398_Parms;
 	F398_Parms.bioWorld = bioWorld;
@@ -14468,10 +13838,9 @@ bool UBioAutoConditionals::F398 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F397 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF397 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF397Ref { L"Function PlotManager.BioAutoConditionals.F397", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF397 )
-		pFnF397 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F397" );
+	UFunction* const pFnF397 = pFnF397Ref.Get ( );
 
 	UBioAutoConditionals_execF397_Parms F397_Parms;
 	F397_Parms.bioWorld = bioWorld;
@@ -14491,10 +13860,9 @@ bool UBioAutoConditionals::F397 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F396 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF396 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF396Ref { L"Function PlotManager.BioAutoConditionals.F396", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF396 )
-		pFnF396 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F396" );
+	UFunction* const pFnF396 = pFnF396Ref.Get ( );
 
 	UBioAutoConditionals_execF396_Parms F396_Parms;
 	F396_Parms.bioWorld = bioWorld;
@@ -14514,10 +13882,9 @@ bool UBioAutoConditionals::F396 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F395 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF395 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF395Ref { L"Function PlotManager.BioAutoConditionals.F395", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF395 )
-		pFnF395 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F395" );
+	UFunction* const pFnF395 = pFnF395Ref.Get ( );
 
 	UBioAutoConditionals_execF395_Parms F395_Parms;
 	F395_Parms.bioWorld = bioWorld;
@@ -14537,10 +13904,9 @@ bool UBioAutoConditionals::F395 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F394 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF394 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF394Ref { L"Function PlotManager.BioAutoConditionals.F394", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF394 )
-		pFnF394 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F394" );
+	UFunction* const pFnF394 = pFnF394Ref.Get ( );
 
 	UBioAutoConditionals_execF394_Parms F394_Parms;
 	F394_Parms.bioWorld = bioWorld;
@@ -14560,10 +13926,9 @@ bool UBioAutoConditionals::F394 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F392 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF392 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF392Ref { L"Function PlotManager.BioAutoConditionals.F392", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF392 )
-		pFnF392 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F392" );
+	UFunction* const pFnF392 = pFnF392Ref.Get ( );
 
 	UBioAutoConditionals_execF392_Parms F392_Parms;
 	F392_Parms.bioWorld = bioWorld;
@@ -14583,10 +13948,9 @@ bool UBioAutoConditionals::F392 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F346 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF346 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF346Ref { L"Function PlotManager.BioAutoConditionals.F346", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF346 )
-		pFnF346 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F346" );
+	UFunction* const pFnF346 = pFnF346Ref.Get ( );
 
 	UBioAutoConditionals_execF346_Parms F346_Parms;
 	F346_Parms.bioWorld = bioWorld;
@@ -14606,10 +13970,9 @@ bool UBioAutoConditionals::F346 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F345 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF345 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF345Ref { L"Function PlotManager.BioAutoConditionals.F345", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF345 )
-		pFnF345 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F345" );
+	UFunction* const pFnF345 = pFnF345Ref.Get ( );
 
 	UBioAutoConditionals_execF345_Parms F345_Parms;
 	F345_Parms.bioWorld = bioWorld;
@@ -14629,10 +13992,9 @@ bool UBioAutoConditionals::F345 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F344 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF344 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF344Ref { L"Function PlotManager.BioAutoConditionals.F344", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF344 )
-		pFnF344 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F344" );
+	UFunction* const pFnF344 = pFnF344Ref.Get ( );
 
 	UBioAutoConditionals_execF344_Parms F344_Parms;
 	F344_Parms.bioWorld = bioWorld;
@@ -14652,10 +14014,9 @@ bool UBioAutoConditionals::F344 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F323 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF323 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF323Ref { L"Function PlotManager.BioAutoConditionals.F323", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF323 )
-		pFnF323 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F323" );
+	UFunction* const pFnF323 = pFnF323Ref.Get ( );
 
 	UBioAutoConditionals_execF323_Parms F323_Parms;
 	F323_Parms.bioWorld = bioWorld;
@@ -14675,10 +14036,9 @@ bool UBioAutoConditionals::F323 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F322 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF322 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF322Ref { L"Function PlotManager.BioAutoConditionals.F322", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF322 )
-		pFnF322 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F322" );
+	UFunction* const pFnF322 = pFnF322Ref.Get ( );
 
 	UBioAutoConditionals_execF322_Parms F322_Parms;
 	F322_Parms.bioWorld = bioWorld;
@@ -14698,10 +14058,9 @@ bool UBioAutoConditionals::F322 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F321 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF321 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF321Ref { L"Function PlotManager.BioAutoConditionals.F321", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF321 )
-		pFnF321 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F321" );
+	UFunction* const pFnF321 = pFnF321Ref.Get ( );
 
 	UBioAutoConditionals_execF321_Parms F321_Parms;
 	F321_Parms.bioWorld = bioWorld;
@@ -14721,10 +14080,9 @@ bool UBioAutoConditionals::F321 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F320 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF320 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF320Ref { L"Function PlotManager.BioAutoConditionals.F320", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF320 )
-		pFnF320 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F320" );
+	UFunction* const pFnF320 = pFnF320Ref.Get ( );
 
 	UBioAutoConditionals_execF320_Parms F320_Parms;
 	F320_Parms.bioWorld = bioWorld;
@@ -14744,10 +14102,9 @@ bool UBioAutoConditionals::F320 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F266 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF266 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF266Ref { L"Function PlotManager.BioAutoConditionals.F266", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF266 )
-		pFnF266 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F266" );
+	UFunction* const pFnF266 = pFnF266Ref.Get ( );
 
 	UBioAutoConditionals_execF266_Parms F266_Parms;
 	F266_Parms.bioWorld = bioWorld;
@@ -14767,10 +14124,9 @@ bool UBioAutoConditionals::F266 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F265 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF265 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF265Ref { L"Function PlotManager.BioAutoConditionals.F265", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF265 )
-		pFnF265 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F265" );
+	UFunction* const pFnF265 = pFnF265Ref.Get ( );
 
 	UBioAutoConditionals_execF265_Parms F265_Parms;
 	F265_Parms.bioWorld = bioWorld;
@@ -14790,10 +14146,9 @@ bool UBioAutoConditionals::F265 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F264 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF264 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF264Ref { L"Function PlotManager.BioAutoConditionals.F264", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF264 )
-		pFnF264 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F264" );
+	UFunction* const pFnF264 = pFnF264Ref.Get ( );
 
 	UBioAutoConditionals_execF264_Parms F264_Parms;
 	F264_Parms.bioWorld = bioWorld;
@@ -14813,10 +14168,9 @@ bool UBioAutoConditionals::F264 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F263 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF263 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF263Ref { L"Function PlotManager.BioAutoConditionals.F263", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF263 )
-		pFnF263 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F263" );
+	UFunction* const pFnF263 = pFnF263Ref.Get ( );
 
 	UBioAutoConditionals_execF263_Parms F263_Parms;
 	F263_Parms.bioWorld = bioWorld;
@@ -14836,10 +14190,9 @@ bool UBioAutoConditionals::F263 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2004 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2004 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2004Ref { L"Function PlotManager.BioAutoConditionals.F2004", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2004 )
-		pFnF2004 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2004" );
+	UFunction* const pFnF2004 = pFnF2004Ref.Get ( );
 
 	UBioAutoConditionals_execF2004_Parms F2004_Parms;
 	F2004_Parms.bioWorld = bioWorld;
@@ -14859,10 +14212,9 @@ bool UBioAutoConditionals::F2004 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1531 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1531 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1531Ref { L"Function PlotManager.BioAutoConditionals.F1531", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1531 )
-		pFnF1531 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1531" );
+	UFunction* const pFnF1531 = pFnF1531Ref.Get ( );
 
 	UBioAutoConditionals_execF1531_Parms F1531_Parms;
 	F1531_Parms.bioWorld = bioWorld;
@@ -14882,10 +14234,9 @@ bool UBioAutoConditionals::F1531 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1482 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1482 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1482Ref { L"Function PlotManager.BioAutoConditionals.F1482", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1482 )
-		pFnF1482 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1482" );
+	UFunction* const pFnF1482 = pFnF1482Ref.Get ( );
 
 	UBioAutoConditionals_execF1482_Parms F1482_Parms;
 	F1482_Parms.bioWorld = bioWorld;
@@ -14905,10 +14256,9 @@ bool UBioAutoConditionals::F1482 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1337 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1337 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1337Ref { L"Function PlotManager.BioAutoConditionals.F1337", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1337 )
-		pFnF1337 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1337" );
+	UFunction* const pFnF1337 = pFnF1337Ref.Get ( );
 
 	UBioAutoConditionals_execF1337_Parms F1337_Parms;
 	F1337_Parms.bioWorld = bioWorld;
@@ -14928,10 +14278,9 @@ bool UBioAutoConditionals::F1337 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1336 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1336 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1336Ref { L"Function PlotManager.BioAutoConditionals.F1336", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1336 )
-		pFnF1336 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1336" );
+	UFunction* const pFnF1336 = pFnF1336Ref.Get ( );
 
 	UBioAutoConditionals_execF1336_Parms F1336_Parms;
 	F1336_Parms.bioWorld = bioWorld;
@@ -14951,10 +14300,9 @@ bool UBioAutoConditionals::F1336 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1335 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1335 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1335Ref { L"Function PlotManager.BioAutoConditionals.F1335", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1335 )
-		pFnF1335 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1335" );
+	UFunction* const pFnF1335 = pFnF1335Ref.Get ( );
 
 	UBioAutoConditionals_execF1335_Parms F1335_Parms;
 	F1335_Parms.bioWorld = bioWorld;
@@ -14974,10 +14322,9 @@ bool UBioAutoConditionals::F1335 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1297 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1297 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1297Ref { L"Function PlotManager.BioAutoConditionals.F1297", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1297 )
-		pFnF1297 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1297" );
+	UFunction* const pFnF1297 = pFnF1297Ref.Get ( );
 
 	UBioAutoConditionals_execF1297_Parms F1297_Parms;
 	F1297_Parms.bioWorld = bioWorld;
@@ -14997,10 +14344,9 @@ bool UBioAutoConditionals::F1297 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F799 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF799 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF799Ref { L"Function PlotManager.BioAutoConditionals.F799", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF799 )
-		pFnF799 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F799" );
+	UFunction* const pFnF799 = pFnF799Ref.Get ( );
 
 	UBioAutoConditionals_execF799_Parms F799_Parms;
 	F799_Parms.bioWorld = bioWorld;
@@ -15020,10 +14366,9 @@ bool UBioAutoConditionals::F799 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F798 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF798 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF798Ref { L"Function PlotManager.BioAutoConditionals.F798", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF798 )
-		pFnF798 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F798" );
+	UFunction* const pFnF798 = pFnF798Ref.Get ( );
 
 	UBioAutoConditionals_execF798_Parms F798_Parms;
 	F798_Parms.bioWorld = bioWorld;
@@ -15043,10 +14388,9 @@ bool UBioAutoConditionals::F798 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F797 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF797 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF797Ref { L"Function PlotManager.BioAutoConditionals.F797", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF797 )
-		pFnF797 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F797" );
+	UFunction* const pFnF797 = pFnF797Ref.Get ( );
 
 	UBioAutoConditionals_execF797_Parms F797_Parms;
 	F797_Parms.bioWorld = bioWorld;
@@ -15066,10 +14410,9 @@ bool UBioAutoConditionals::F797 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1632 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1632 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1632Ref { L"Function PlotManager.BioAutoConditionals.F1632", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1632 )
-		pFnF1632 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1632" );
+	UFunction* const pFnF1632 = pFnF1632Ref.Get ( );
 
 	UBioAutoConditionals_execF1632_Parms F1632_Parms;
 	F1632_Parms.bioWorld = bioWorld;
@@ -15089,10 +14432,9 @@ bool UBioAutoConditionals::F1632 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1716 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1716 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1716Ref { L"Function PlotManager.BioAutoConditionals.F1716", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1716 )
-		pFnF1716 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1716" );
+	UFunction* const pFnF1716 = pFnF1716Ref.Get ( );
 
 	UBioAutoConditionals_execF1716_Parms F1716_Parms;
 	F1716_Parms.bioWorld = bioWorld;
@@ -15112,10 +14454,9 @@ bool UBioAutoConditionals::F1716 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1061 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1061 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1061Ref { L"Function PlotManager.BioAutoConditionals.F1061", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1061 )
-		pFnF1061 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1061" );
+	UFunction* const pFnF1061 = pFnF1061Ref.Get ( );
 
 	UBioAutoConditionals_execF1061_Parms F1061_Parms;
 	F1061_Parms.bioWorld = bioWorld;
@@ -15135,10 +14476,9 @@ bool UBioAutoConditionals::F1061 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1128 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1128 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1128Ref { L"Function PlotManager.BioAutoConditionals.F1128", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1128 )
-		pFnF1128 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1128" );
+	UFunction* const pFnF1128 = pFnF1128Ref.Get ( );
 
 	UBioAutoConditionals_execF1128_Parms F1128_Parms;
 	F1128_Parms.bioWorld = bioWorld;
@@ -15158,10 +14498,9 @@ bool UBioAutoConditionals::F1128 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1229 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1229 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1229Ref { L"Function PlotManager.BioAutoConditionals.F1229", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1229 )
-		pFnF1229 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1229" );
+	UFunction* const pFnF1229 = pFnF1229Ref.Get ( );
 
 	UBioAutoConditionals_execF1229_Parms F1229_Parms;
 	F1229_Parms.bioWorld = bioWorld;
@@ -15181,10 +14520,9 @@ bool UBioAutoConditionals::F1229 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1345 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1345 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1345Ref { L"Function PlotManager.BioAutoConditionals.F1345", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1345 )
-		pFnF1345 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1345" );
+	UFunction* const pFnF1345 = pFnF1345Ref.Get ( );
 
 	UBioAutoConditionals_execF1345_Parms F1345_Parms;
 	F1345_Parms.bioWorld = bioWorld;
@@ -15204,10 +14542,9 @@ bool UBioAutoConditionals::F1345 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1369 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1369 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1369Ref { L"Function PlotManager.BioAutoConditionals.F1369", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1369 )
-		pFnF1369 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1369" );
+	UFunction* const pFnF1369 = pFnF1369Ref.Get ( );
 
 	UBioAutoConditionals_execF1369_Parms F1369_Parms;
 	F1369_Parms.bioWorld = bioWorld;
@@ -15227,10 +14564,9 @@ bool UBioAutoConditionals::F1369 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1368 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1368 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1368Ref { L"Function PlotManager.BioAutoConditionals.F1368", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1368 )
-		pFnF1368 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1368" );
+	UFunction* const pFnF1368 = pFnF1368Ref.Get ( );
 
 	UBioAutoConditionals_execF1368_Parms F1368_Parms;
 	F1368_Parms.bioWorld = bioWorld;
@@ -15250,10 +14586,9 @@ bool UBioAutoConditionals::F1368 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1367 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1367 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1367Ref { L"Function PlotManager.BioAutoConditionals.F1367", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1367 )
-		pFnF1367 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1367" );
+	UFunction* const pFnF1367 = pFnF1367Ref.Get ( );
 
 	UBioAutoConditionals_execF1367_Parms F1367_Parms;
 	F1367_Parms.bioWorld = bioWorld;
@@ -15273,10 +14608,9 @@ bool UBioAutoConditionals::F1367 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1366 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1366 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1366Ref { L"Function PlotManager.BioAutoConditionals.F1366", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1366 )
-		pFnF1366 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1366" );
+	UFunction* const pFnF1366 = pFnF1366Ref.Get ( );
 
 	UBioAutoConditionals_execF1366_Parms F1366_Parms;
 	F1366_Parms.bioWorld = bioWorld;
@@ -15296,10 +14630,9 @@ bool UBioAutoConditionals::F1366 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F784 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF784 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF784Ref { L"Function PlotManager.BioAutoConditionals.F784", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF784 )
-		pFnF784 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F784" );
+	UFunction* const pFnF784 = pFnF784Ref.Get ( );
 
 	UBioAutoConditionals_execF784_Parms F784_Parms;
 	F784_Parms.bioWorld = bioWorld;
@@ -15319,10 +14652,9 @@ bool UBioAutoConditionals::F784 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F795 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF795 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF795Ref { L"Function PlotManager.BioAutoConditionals.F795", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF795 )
-		pFnF795 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F795" );
+	UFunction* const pFnF795 = pFnF795Ref.Get ( );
 
 	UBioAutoConditionals_execF795_Parms F795_Parms;
 	F795_Parms.bioWorld = bioWorld;
@@ -15342,10 +14674,9 @@ bool UBioAutoConditionals::F795 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F792 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF792 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF792Ref { L"Function PlotManager.BioAutoConditionals.F792", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF792 )
-		pFnF792 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F792" );
+	UFunction* const pFnF792 = pFnF792Ref.Get ( );
 
 	UBioAutoConditionals_execF792_Parms F792_Parms;
 	F792_Parms.bioWorld = bioWorld;
@@ -15365,10 +14696,9 @@ bool UBioAutoConditionals::F792 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F793 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF793 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF793Ref { L"Function PlotManager.BioAutoConditionals.F793", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF793 )
-		pFnF793 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F793" );
+	UFunction* const pFnF793 = pFnF793Ref.Get ( );
 
 	UBioAutoConditionals_execF793_Parms F793_Parms;
 	F793_Parms.bioWorld = bioWorld;
@@ -15388,10 +14718,9 @@ bool UBioAutoConditionals::F793 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F790 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF790 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF790Ref { L"Function PlotManager.BioAutoConditionals.F790", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF790 )
-		pFnF790 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F790" );
+	UFunction* const pFnF790 = pFnF790Ref.Get ( );
 
 	UBioAutoConditionals_execF790_Parms F790_Parms;
 	F790_Parms.bioWorld = bioWorld;
@@ -15411,10 +14740,9 @@ bool UBioAutoConditionals::F790 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F672 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF672 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF672Ref { L"Function PlotManager.BioAutoConditionals.F672", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF672 )
-		pFnF672 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F672" );
+	UFunction* const pFnF672 = pFnF672Ref.Get ( );
 
 	UBioAutoConditionals_execF672_Parms F672_Parms;
 	F672_Parms.bioWorld = bioWorld;
@@ -15434,10 +14762,9 @@ bool UBioAutoConditionals::F672 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F671 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF671 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF671Ref { L"Function PlotManager.BioAutoConditionals.F671", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF671 )
-		pFnF671 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F671" );
+	UFunction* const pFnF671 = pFnF671Ref.Get ( );
 
 	UBioAutoConditionals_execF671_Parms F671_Parms;
 	F671_Parms.bioWorld = bioWorld;
@@ -15457,10 +14784,9 @@ bool UBioAutoConditionals::F671 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1002 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1002 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1002Ref { L"Function PlotManager.BioAutoConditionals.F1002", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1002 )
-		pFnF1002 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1002" );
+	UFunction* const pFnF1002 = pFnF1002Ref.Get ( );
 
 	UBioAutoConditionals_execF1002_Parms F1002_Parms;
 	F1002_Parms.bioWorld = bioWorld;
@@ -15480,10 +14806,9 @@ bool UBioAutoConditionals::F1002 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F947 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF947 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF947Ref { L"Function PlotManager.BioAutoConditionals.F947", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF947 )
-		pFnF947 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F947" );
+	UFunction* const pFnF947 = pFnF947Ref.Get ( );
 
 	UBioAutoConditionals_execF947_Parms F947_Parms;
 	F947_Parms.bioWorld = bioWorld;
@@ -15503,10 +14828,9 @@ bool UBioAutoConditionals::F947 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1494 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1494 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1494Ref { L"Function PlotManager.BioAutoConditionals.F1494", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1494 )
-		pFnF1494 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1494" );
+	UFunction* const pFnF1494 = pFnF1494Ref.Get ( );
 
 	UBioAutoConditionals_execF1494_Parms F1494_Parms;
 	F1494_Parms.bioWorld = bioWorld;
@@ -15526,10 +14850,9 @@ bool UBioAutoConditionals::F1494 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F598 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF598 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF598Ref { L"Function PlotManager.BioAutoConditionals.F598", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF598 )
-		pFnF598 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F598" );
+	UFunction* const pFnF598 = pFnF598Ref.Get ( );
 
 	UBioAutoConditionals_execF598_Parms F598_Parms;
 	F598_Parms.bioWorld = bioWorld;
@@ -15549,10 +14872,9 @@ bool UBioAutoConditionals::F598 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1265 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1265 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1265Ref { L"Function PlotManager.BioAutoConditionals.F1265", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1265 )
-		pFnF1265 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1265" );
+	UFunction* const pFnF1265 = pFnF1265Ref.Get ( );
 
 	UBioAutoConditionals_execF1265_Parms F1265_Parms;
 	F1265_Parms.bioWorld = bioWorld;
@@ -15572,10 +14894,9 @@ bool UBioAutoConditionals::F1265 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1264 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1264 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1264Ref { L"Function PlotManager.BioAutoConditionals.F1264", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1264 )
-		pFnF1264 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1264" );
+	UFunction* const pFnF1264 = pFnF1264Ref.Get ( );
 
 	UBioAutoConditionals_execF1264_Parms F1264_Parms;
 	F1264_Parms.bioWorld = bioWorld;
@@ -15595,10 +14916,9 @@ bool UBioAutoConditionals::F1264 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F880 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF880 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF880Ref { L"Function PlotManager.BioAutoConditionals.F880", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF880 )
-		pFnF880 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F880" );
+	UFunction* const pFnF880 = pFnF880Ref.Get ( );
 
 	UBioAutoConditionals_execF880_Parms F880_Parms;
 	F880_Parms.bioWorld = bioWorld;
@@ -15618,10 +14938,9 @@ bool UBioAutoConditionals::F880 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1616 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1616 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1616Ref { L"Function PlotManager.BioAutoConditionals.F1616", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1616 )
-		pFnF1616 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1616" );
+	UFunction* const pFnF1616 = pFnF1616Ref.Get ( );
 
 	UBioAutoConditionals_execF1616_Parms F1616_Parms;
 	F1616_Parms.bioWorld = bioWorld;
@@ -15641,10 +14960,9 @@ bool UBioAutoConditionals::F1616 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1615 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1615 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1615Ref { L"Function PlotManager.BioAutoConditionals.F1615", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1615 )
-		pFnF1615 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1615" );
+	UFunction* const pFnF1615 = pFnF1615Ref.Get ( );
 
 	UBioAutoConditionals_execF1615_Parms F1615_Parms;
 	F1615_Parms.bioWorld = bioWorld;
@@ -15664,10 +14982,9 @@ bool UBioAutoConditionals::F1615 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1614 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1614 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1614Ref { L"Function PlotManager.BioAutoConditionals.F1614", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1614 )
-		pFnF1614 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1614" );
+	UFunction* const pFnF1614 = pFnF1614Ref.Get ( );
 
 	UBioAutoConditionals_execF1614_Parms F1614_Parms;
 	F1614_Parms.bioWorld = bioWorld;
@@ -15687,10 +15004,9 @@ bool UBioAutoConditionals::F1614 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1613 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1613 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1613Ref { L"Function PlotManager.BioAutoConditionals.F1613", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1613 )
-		pFnF1613 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1613" );
+	UFunction* const pFnF1613 = pFnF1613Ref.Get ( );
 
 	UBioAutoConditionals_execF1613_Parms F1613_Parms;
 	F1613_Parms.bioWorld = bioWorld;
@@ -15710,10 +15026,9 @@ bool UBioAutoConditionals::F1613 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1612 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1612 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1612Ref { L"Function PlotManager.BioAutoConditionals.F1612", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1612 )
-		pFnF1612 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1612" );
+	UFunction* const pFnF1612 = pFnF1612Ref.Get ( );
 
 	UBioAutoConditionals_execF1612_Parms F1612_Parms;
 	F1612_Parms.bioWorld = bioWorld;
@@ -15733,10 +15048,9 @@ bool UBioAutoConditionals::F1612 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1611 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1611 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1611Ref { L"Function PlotManager.BioAutoConditionals.F1611", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1611 )
-		pFnF1611 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1611" );
+	UFunction* const pFnF1611 = pFnF1611Ref.Get ( );
 
 	UBioAutoConditionals_execF1611_Parms F1611_Parms;
 	F1611_Parms.bioWorld = bioWorld;
@@ -15756,10 +15070,9 @@ bool UBioAutoConditionals::F1611 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1610 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1610 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1610Ref { L"Function PlotManager.BioAutoConditionals.F1610", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1610 )
-		pFnF1610 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1610" );
+	UFunction* const pFnF1610 = pFnF1610Ref.Get ( );
 
 	UBioAutoConditionals_execF1610_Parms F1610_Parms;
 	F1610_Parms.bioWorld = bioWorld;
@@ -15779,10 +15092,9 @@ bool UBioAutoConditionals::F1610 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1609 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1609 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1609Ref { L"Function PlotManager.BioAutoConditionals.F1609", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1609 )
-		pFnF1609 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1609" );
+	UFunction* const pFnF1609 = pFnF1609Ref.Get ( );
 
 	UBioAutoConditionals_execF1609_Parms F1609_Parms;
 	F1609_Parms.bioWorld = bioWorld;
@@ -15802,10 +15114,9 @@ bool UBioAutoConditionals::F1609 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1608 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1608 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1608Ref { L"Function PlotManager.BioAutoConditionals.F1608", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1608 )
-		pFnF1608 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1608" );
+	UFunction* const pFnF1608 = pFnF1608Ref.Get ( );
 
 	UBioAutoConditionals_execF1608_Parms F1608_Parms;
 	F1608_Parms.bioWorld = bioWorld;
@@ -15825,10 +15136,9 @@ bool UBioAutoConditionals::F1608 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1607 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1607 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1607Ref { L"Function PlotManager.BioAutoConditionals.F1607", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1607 )
-		pFnF1607 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1607" );
+	UFunction* const pFnF1607 = pFnF1607Ref.Get ( );
 
 	UBioAutoConditionals_execF1607_Parms F1607_Parms;
 	F1607_Parms.bioWorld = bioWorld;
@@ -15848,10 +15158,9 @@ bool UBioAutoConditionals::F1607 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1605 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1605 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1605Ref { L"Function PlotManager.BioAutoConditionals.F1605", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1605 )
-		pFnF1605 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1605" );
+	UFunction* const pFnF1605 = pFnF1605Ref.Get ( );
 
 	UBioAutoConditionals_execF1605_Parms F1605_Parms;
 	F1605_Parms.bioWorld = bioWorld;
@@ -15871,10 +15180,9 @@ bool UBioAutoConditionals::F1605 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1604 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1604 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1604Ref { L"Function PlotManager.BioAutoConditionals.F1604", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1604 )
-		pFnF1604 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1604" );
+	UFunction* const pFnF1604 = pFnF1604Ref.Get ( );
 
 	UBioAutoConditionals_execF1604_Parms F1604_Parms;
 	F1604_Parms.bioWorld = bioWorld;
@@ -15894,10 +15202,9 @@ bool UBioAutoConditionals::F1604 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1603 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1603 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1603Ref { L"Function PlotManager.BioAutoConditionals.F1603", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1603 )
-		pFnF1603 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1603" );
+	UFunction* const pFnF1603 = pFnF1603Ref.Get ( );
 
 	UBioAutoConditionals_execF1603_Parms F1603_Parms;
 	F1603_Parms.bioWorld = bioWorld;
@@ -15917,10 +15224,9 @@ bool UBioAutoConditionals::F1603 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1602 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1602 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1602Ref { L"Function PlotManager.BioAutoConditionals.F1602", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1602 )
-		pFnF1602 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1602" );
+	UFunction* const pFnF1602 = pFnF1602Ref.Get ( );
 
 	UBioAutoConditionals_execF1602_Parms F1602_Parms;
 	F1602_Parms.bioWorld = bioWorld;
@@ -15940,10 +15246,9 @@ bool UBioAutoConditionals::F1602 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1701 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1701 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1701Ref { L"Function PlotManager.BioAutoConditionals.F1701", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1701 )
-		pFnF1701 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1701" );
+	UFunction* const pFnF1701 = pFnF1701Ref.Get ( );
 
 	UBioAutoConditionals_execF1701_Parms F1701_Parms;
 	F1701_Parms.bioWorld = bioWorld;
@@ -15963,10 +15268,9 @@ bool UBioAutoConditionals::F1701 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1700 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1700 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1700Ref { L"Function PlotManager.BioAutoConditionals.F1700", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1700 )
-		pFnF1700 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1700" );
+	UFunction* const pFnF1700 = pFnF1700Ref.Get ( );
 
 	UBioAutoConditionals_execF1700_Parms F1700_Parms;
 	F1700_Parms.bioWorld = bioWorld;
@@ -15986,10 +15290,9 @@ bool UBioAutoConditionals::F1700 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1699 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1699 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1699Ref { L"Function PlotManager.BioAutoConditionals.F1699", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1699 )
-		pFnF1699 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1699" );
+	UFunction* const pFnF1699 = pFnF1699Ref.Get ( );
 
 	UBioAutoConditionals_execF1699_Parms F1699_Parms;
 	F1699_Parms.bioWorld = bioWorld;
@@ -16009,10 +15312,9 @@ bool UBioAutoConditionals::F1699 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1698 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1698 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1698Ref { L"Function PlotManager.BioAutoConditionals.F1698", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1698 )
-		pFnF1698 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1698" );
+	UFunction* const pFnF1698 = pFnF1698Ref.Get ( );
 
 	UBioAutoConditionals_execF1698_Parms F1698_Parms;
 	F1698_Parms.bioWorld = bioWorld;
@@ -16032,10 +15334,9 @@ bool UBioAutoConditionals::F1698 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1697 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1697 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1697Ref { L"Function PlotManager.BioAutoConditionals.F1697", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1697 )
-		pFnF1697 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1697" );
+	UFunction* const pFnF1697 = pFnF1697Ref.Get ( );
 
 	UBioAutoConditionals_execF1697_Parms F1697_Parms;
 	F1697_Parms.bioWorld = bioWorld;
@@ -16055,10 +15356,9 @@ bool UBioAutoConditionals::F1697 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1696 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1696 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1696Ref { L"Function PlotManager.BioAutoConditionals.F1696", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1696 )
-		pFnF1696 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1696" );
+	UFunction* const pFnF1696 = pFnF1696Ref.Get ( );
 
 	UBioAutoConditionals_execF1696_Parms F1696_Parms;
 	F1696_Parms.bioWorld = bioWorld;
@@ -16078,10 +15378,9 @@ bool UBioAutoConditionals::F1696 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1695 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1695 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1695Ref { L"Function PlotManager.BioAutoConditionals.F1695", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1695 )
-		pFnF1695 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1695" );
+	UFunction* const pFnF1695 = pFnF1695Ref.Get ( );
 
 	UBioAutoConditionals_execF1695_Parms F1695_Parms;
 	F1695_Parms.bioWorld = bioWorld;
@@ -16101,10 +15400,9 @@ bool UBioAutoConditionals::F1695 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1694 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1694 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1694Ref { L"Function PlotManager.BioAutoConditionals.F1694", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1694 )
-		pFnF1694 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1694" );
+	UFunction* const pFnF1694 = pFnF1694Ref.Get ( );
 
 	UBioAutoConditionals_execF1694_Parms F1694_Parms;
 	F1694_Parms.bioWorld = bioWorld;
@@ -16124,10 +15422,9 @@ bool UBioAutoConditionals::F1694 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1693 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1693 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1693Ref { L"Function PlotManager.BioAutoConditionals.F1693", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1693 )
-		pFnF1693 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1693" );
+	UFunction* const pFnF1693 = pFnF1693Ref.Get ( );
 
 	UBioAutoConditionals_execF1693_Parms F1693_Parms;
 	F1693_Parms.bioWorld = bioWorld;
@@ -16147,10 +15444,9 @@ bool UBioAutoConditionals::F1693 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1692 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1692 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1692Ref { L"Function PlotManager.BioAutoConditionals.F1692", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1692 )
-		pFnF1692 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1692" );
+	UFunction* const pFnF1692 = pFnF1692Ref.Get ( );
 
 	UBioAutoConditionals_execF1692_Parms F1692_Parms;
 	F1692_Parms.bioWorld = bioWorld;
@@ -16170,10 +15466,9 @@ bool UBioAutoConditionals::F1692 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1691 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1691 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1691Ref { L"Function PlotManager.BioAutoConditionals.F1691", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1691 )
-		pFnF1691 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1691" );
+	UFunction* const pFnF1691 = pFnF1691Ref.Get ( );
 
 	UBioAutoConditionals_execF1691_Parms F1691_Parms;
 	F1691_Parms.bioWorld = bioWorld;
@@ -16193,10 +15488,9 @@ bool UBioAutoConditionals::F1691 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1690 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1690 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1690Ref { L"Function PlotManager.BioAutoConditionals.F1690", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1690 )
-		pFnF1690 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1690" );
+	UFunction* const pFnF1690 = pFnF1690Ref.Get ( );
 
 	UBioAutoConditionals_execF1690_Parms F1690_Parms;
 	F1690_Parms.bioWorld = bioWorld;
@@ -16216,10 +15510,9 @@ bool UBioAutoConditionals::F1690 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1689 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1689 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1689Ref { L"Function PlotManager.BioAutoConditionals.F1689", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1689 )
-		pFnF1689 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1689" );
+	UFunction* const pFnF1689 = pFnF1689Ref.Get ( );
 
 	UBioAutoConditionals_execF1689_Parms F1689_Parms;
 	F1689_Parms.bioWorld = bioWorld;
@@ -16239,10 +15532,9 @@ bool UBioAutoConditionals::F1689 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1688 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1688 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1688Ref { L"Function PlotManager.BioAutoConditionals.F1688", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1688 )
-		pFnF1688 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1688" );
+	UFunction* const pFnF1688 = pFnF1688Ref.Get ( );
 
 	UBioAutoConditionals_execF1688_Parms F1688_Parms;
 	F1688_Parms.bioWorld = bioWorld;
@@ -16262,10 +15554,9 @@ bool UBioAutoConditionals::F1688 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1687 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1687 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1687Ref { L"Function PlotManager.BioAutoConditionals.F1687", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1687 )
-		pFnF1687 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1687" );
+	UFunction* const pFnF1687 = pFnF1687Ref.Get ( );
 
 	UBioAutoConditionals_execF1687_Parms F1687_Parms;
 	F1687_Parms.bioWorld = bioWorld;
@@ -16285,10 +15576,9 @@ bool UBioAutoConditionals::F1687 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1686 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1686 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1686Ref { L"Function PlotManager.BioAutoConditionals.F1686", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1686 )
-		pFnF1686 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1686" );
+	UFunction* const pFnF1686 = pFnF1686Ref.Get ( );
 
 	UBioAutoConditionals_execF1686_Parms F1686_Parms;
 	F1686_Parms.bioWorld = bioWorld;
@@ -16308,10 +15598,9 @@ bool UBioAutoConditionals::F1686 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1685 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1685 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1685Ref { L"Function PlotManager.BioAutoConditionals.F1685", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1685 )
-		pFnF1685 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1685" );
+	UFunction* const pFnF1685 = pFnF1685Ref.Get ( );
 
 	UBioAutoConditionals_execF1685_Parms F1685_Parms;
 	F1685_Parms.bioWorld = bioWorld;
@@ -16331,10 +15620,9 @@ bool UBioAutoConditionals::F1685 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1684 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1684 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1684Ref { L"Function PlotManager.BioAutoConditionals.F1684", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1684 )
-		pFnF1684 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1684" );
+	UFunction* const pFnF1684 = pFnF1684Ref.Get ( );
 
 	UBioAutoConditionals_execF1684_Parms F1684_Parms;
 	F1684_Parms.bioWorld = bioWorld;
@@ -16354,10 +15642,9 @@ bool UBioAutoConditionals::F1684 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1683 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1683 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1683Ref { L"Function PlotManager.BioAutoConditionals.F1683", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1683 )
-		pFnF1683 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1683" );
+	UFunction* const pFnF1683 = pFnF1683Ref.Get ( );
 
 	UBioAutoConditionals_execF1683_Parms F1683_Parms;
 	F1683_Parms.bioWorld = bioWorld;
@@ -16377,10 +15664,9 @@ bool UBioAutoConditionals::F1683 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1682 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1682 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1682Ref { L"Function PlotManager.BioAutoConditionals.F1682", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1682 )
-		pFnF1682 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1682" );
+	UFunction* const pFnF1682 = pFnF1682Ref.Get ( );
 
 	UBioAutoConditionals_execF1682_Parms F1682_Parms;
 	F1682_Parms.bioWorld = bioWorld;
@@ -16400,10 +15686,9 @@ bool UBioAutoConditionals::F1682 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1681 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1681 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1681Ref { L"Function PlotManager.BioAutoConditionals.F1681", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1681 )
-		pFnF1681 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1681" );
+	UFunction* const pFnF1681 = pFnF1681Ref.Get ( );
 
 	UBioAutoConditionals_execF1681_Parms F1681_Parms;
 	F1681_Parms.bioWorld = bioWorld;
@@ -16423,10 +15708,9 @@ bool UBioAutoConditionals::F1681 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1680 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1680 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1680Ref { L"Function PlotManager.BioAutoConditionals.F1680", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1680 )
-		pFnF1680 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1680" );
+	UFunction* const pFnF1680 = pFnF1680Ref.Get ( );
 
 	UBioAutoConditionals_execF1680_Parms F1680_Parms;
 	F1680_Parms.bioWorld = bioWorld;
@@ -16446,10 +15730,9 @@ bool UBioAutoConditionals::F1680 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1679 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1679 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1679Ref { L"Function PlotManager.BioAutoConditionals.F1679", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1679 )
-		pFnF1679 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1679" );
+	UFunction* const pFnF1679 = pFnF1679Ref.Get ( );
 
 	UBioAutoConditionals_execF1679_Parms F1679_Parms;
 	F1679_Parms.bioWorld = bioWorld;
@@ -16469,10 +15752,9 @@ bool UBioAutoConditionals::F1679 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1678 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1678 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1678Ref { L"Function PlotManager.BioAutoConditionals.F1678", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1678 )
-		pFnF1678 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1678" );
+	UFunction* const pFnF1678 = pFnF1678Ref.Get ( );
 
 	UBioAutoConditionals_execF1678_Parms F1678_Parms;
 	F1678_Parms.bioWorld = bioWorld;
@@ -16492,10 +15774,9 @@ bool UBioAutoConditionals::F1678 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1677 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1677 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1677Ref { L"Function PlotManager.BioAutoConditionals.F1677", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1677 )
-		pFnF1677 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1677" );
+	UFunction* const pFnF1677 = pFnF1677Ref.Get ( );
 
 	UBioAutoConditionals_execF1677_Parms F1677_Parms;
 	F1677_Parms.bioWorld = bioWorld;
@@ -16515,10 +15796,9 @@ bool UBioAutoConditionals::F1677 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1676 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1676 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1676Ref { L"Function PlotManager.BioAutoConditionals.F1676", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1676 )
-		pFnF1676 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1676" );
+	UFunction* const pFnF1676 = pFnF1676Ref.Get ( );
 
 	UBioAutoConditionals_execF1676_Parms F1676_Parms;
 	F1676_Parms.bioWorld = bioWorld;
@@ -16538,10 +15818,9 @@ bool UBioAutoConditionals::F1676 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1675 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1675 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1675Ref { L"Function PlotManager.BioAutoConditionals.F1675", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1675 )
-		pFnF1675 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1675" );
+	UFunction* const pFnF1675 = pFnF1675Ref.Get ( );
 
 	UBioAutoConditionals_execF1675_Parms F1675_Parms;
 	F1675_Parms.bioWorld = bioWorld;
@@ -16561,10 +15840,9 @@ bool UBioAutoConditionals::F1675 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1674 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1674 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1674Ref { L"Function PlotManager.BioAutoConditionals.F1674", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1674 )
-		pFnF1674 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1674" );
+	UFunction* const pFnF1674 = pFnF1674Ref.Get ( );
 
 	UBioAutoConditionals_execF1674_Parms F1674_Parms;
 	F1674_Parms.bioWorld = bioWorld;
@@ -16584,10 +15862,9 @@ bool UBioAutoConditionals::F1674 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1575 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1575 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1575Ref { L"Function PlotManager.BioAutoConditionals.F1575", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1575 )
-		pFnF1575 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1575" );
+	UFunction* const pFnF1575 = pFnF1575Ref.Get ( );
 
 	UBioAutoConditionals_execF1575_Parms F1575_Parms;
 	F1575_Parms.bioWorld = bioWorld;
@@ -16607,10 +15884,9 @@ bool UBioAutoConditionals::F1575 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1574 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1574 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1574Ref { L"Function PlotManager.BioAutoConditionals.F1574", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1574 )
-		pFnF1574 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1574" );
+	UFunction* const pFnF1574 = pFnF1574Ref.Get ( );
 
 	UBioAutoConditionals_execF1574_Parms F1574_Parms;
 	F1574_Parms.bioWorld = bioWorld;
@@ -16630,10 +15906,9 @@ bool UBioAutoConditionals::F1574 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1573 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1573 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1573Ref { L"Function PlotManager.BioAutoConditionals.F1573", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1573 )
-		pFnF1573 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1573" );
+	UFunction* const pFnF1573 = pFnF1573Ref.Get ( );
 
 	UBioAutoConditionals_execF1573_Parms F1573_Parms;
 	F1573_Parms.bioWorld = bioWorld;
@@ -16653,10 +15928,9 @@ bool UBioAutoConditionals::F1573 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1572 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1572 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1572Ref { L"Function PlotManager.BioAutoConditionals.F1572", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1572 )
-		pFnF1572 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1572" );
+	UFunction* const pFnF1572 = pFnF1572Ref.Get ( );
 
 	UBioAutoConditionals_execF1572_Parms F1572_Parms;
 	F1572_Parms.bioWorld = bioWorld;
@@ -16676,10 +15950,9 @@ bool UBioAutoConditionals::F1572 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1571 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1571 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1571Ref { L"Function PlotManager.BioAutoConditionals.F1571", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1571 )
-		pFnF1571 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1571" );
+	UFunction* const pFnF1571 = pFnF1571Ref.Get ( );
 
 	UBioAutoConditionals_execF1571_Parms F1571_Parms;
 	F1571_Parms.bioWorld = bioWorld;
@@ -16699,10 +15972,9 @@ bool UBioAutoConditionals::F1571 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1570 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1570 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1570Ref { L"Function PlotManager.BioAutoConditionals.F1570", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1570 )
-		pFnF1570 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1570" );
+	UFunction* const pFnF1570 = pFnF1570Ref.Get ( );
 
 	UBioAutoConditionals_execF1570_Parms F1570_Parms;
 	F1570_Parms.bioWorld = bioWorld;
@@ -16722,10 +15994,9 @@ bool UBioAutoConditionals::F1570 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1569 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1569 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1569Ref { L"Function PlotManager.BioAutoConditionals.F1569", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1569 )
-		pFnF1569 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1569" );
+	UFunction* const pFnF1569 = pFnF1569Ref.Get ( );
 
 	UBioAutoConditionals_execF1569_Parms F1569_Parms;
 	F1569_Parms.bioWorld = bioWorld;
@@ -16745,10 +16016,9 @@ bool UBioAutoConditionals::F1569 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1568 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1568 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1568Ref { L"Function PlotManager.BioAutoConditionals.F1568", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1568 )
-		pFnF1568 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1568" );
+	UFunction* const pFnF1568 = pFnF1568Ref.Get ( );
 
 	UBioAutoConditionals_execF1568_Parms F1568_Parms;
 	F1568_Parms.bioWorld = bioWorld;
@@ -16768,10 +16038,9 @@ bool UBioAutoConditionals::F1568 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1567 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1567 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1567Ref { L"Function PlotManager.BioAutoConditionals.F1567", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1567 )
-		pFnF1567 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1567" );
+	UFunction* const pFnF1567 = pFnF1567Ref.Get ( );
 
 	UBioAutoConditionals_execF1567_Parms F1567_Parms;
 	F1567_Parms.bioWorld = bioWorld;
@@ -16791,10 +16060,9 @@ bool UBioAutoConditionals::F1567 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1702 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1702 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1702Ref { L"Function PlotManager.BioAutoConditionals.F1702", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1702 )
-		pFnF1702 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1702" );
+	UFunction* const pFnF1702 = pFnF1702Ref.Get ( );
 
 	UBioAutoConditionals_execF1702_Parms F1702_Parms;
 	F1702_Parms.bioWorld = bioWorld;
@@ -16814,10 +16082,9 @@ bool UBioAutoConditionals::F1702 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1673 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1673 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1673Ref { L"Function PlotManager.BioAutoConditionals.F1673", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1673 )
-		pFnF1673 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1673" );
+	UFunction* const pFnF1673 = pFnF1673Ref.Get ( );
 
 	UBioAutoConditionals_execF1673_Parms F1673_Parms;
 	F1673_Parms.bioWorld = bioWorld;
@@ -16837,10 +16104,9 @@ bool UBioAutoConditionals::F1673 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1672 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1672 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1672Ref { L"Function PlotManager.BioAutoConditionals.F1672", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1672 )
-		pFnF1672 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1672" );
+	UFunction* const pFnF1672 = pFnF1672Ref.Get ( );
 
 	UBioAutoConditionals_execF1672_Parms F1672_Parms;
 	F1672_Parms.bioWorld = bioWorld;
@@ -16860,10 +16126,9 @@ bool UBioAutoConditionals::F1672 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1631 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1631 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1631Ref { L"Function PlotManager.BioAutoConditionals.F1631", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1631 )
-		pFnF1631 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1631" );
+	UFunction* const pFnF1631 = pFnF1631Ref.Get ( );
 
 	UBioAutoConditionals_execF1631_Parms F1631_Parms;
 	F1631_Parms.bioWorld = bioWorld;
@@ -16883,10 +16148,9 @@ bool UBioAutoConditionals::F1631 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1547 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1547 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1547Ref { L"Function PlotManager.BioAutoConditionals.F1547", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1547 )
-		pFnF1547 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1547" );
+	UFunction* const pFnF1547 = pFnF1547Ref.Get ( );
 
 	UBioAutoConditionals_execF1547_Parms F1547_Parms;
 	F1547_Parms.bioWorld = bioWorld;
@@ -16906,10 +16170,9 @@ bool UBioAutoConditionals::F1547 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1546 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1546 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1546Ref { L"Function PlotManager.BioAutoConditionals.F1546", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1546 )
-		pFnF1546 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1546" );
+	UFunction* const pFnF1546 = pFnF1546Ref.Get ( );
 
 	UBioAutoConditionals_execF1546_Parms F1546_Parms;
 	F1546_Parms.bioWorld = bioWorld;
@@ -16929,10 +16192,9 @@ bool UBioAutoConditionals::F1546 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1545 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1545 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1545Ref { L"Function PlotManager.BioAutoConditionals.F1545", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1545 )
-		pFnF1545 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1545" );
+	UFunction* const pFnF1545 = pFnF1545Ref.Get ( );
 
 	UBioAutoConditionals_execF1545_Parms F1545_Parms;
 	F1545_Parms.bioWorld = bioWorld;
@@ -16952,10 +16214,9 @@ bool UBioAutoConditionals::F1545 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1544 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1544 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1544Ref { L"Function PlotManager.BioAutoConditionals.F1544", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1544 )
-		pFnF1544 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1544" );
+	UFunction* const pFnF1544 = pFnF1544Ref.Get ( );
 
 	UBioAutoConditionals_execF1544_Parms F1544_Parms;
 	F1544_Parms.bioWorld = bioWorld;
@@ -16975,10 +16236,9 @@ bool UBioAutoConditionals::F1544 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1543 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1543 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1543Ref { L"Function PlotManager.BioAutoConditionals.F1543", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1543 )
-		pFnF1543 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1543" );
+	UFunction* const pFnF1543 = pFnF1543Ref.Get ( );
 
 	UBioAutoConditionals_execF1543_Parms F1543_Parms;
 	F1543_Parms.bioWorld = bioWorld;
@@ -16998,10 +16258,9 @@ bool UBioAutoConditionals::F1543 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1542 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1542 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1542Ref { L"Function PlotManager.BioAutoConditionals.F1542", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1542 )
-		pFnF1542 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1542" );
+	UFunction* const pFnF1542 = pFnF1542Ref.Get ( );
 
 	UBioAutoConditionals_execF1542_Parms F1542_Parms;
 	F1542_Parms.bioWorld = bioWorld;
@@ -17021,10 +16280,9 @@ bool UBioAutoConditionals::F1542 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1541 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1541 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1541Ref { L"Function PlotManager.BioAutoConditionals.F1541", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1541 )
-		pFnF1541 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1541" );
+	UFunction* const pFnF1541 = pFnF1541Ref.Get ( );
 
 	UBioAutoConditionals_execF1541_Parms F1541_Parms;
 	F1541_Parms.bioWorld = bioWorld;
@@ -17044,10 +16302,9 @@ bool UBioAutoConditionals::F1541 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1532 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1532 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1532Ref { L"Function PlotManager.BioAutoConditionals.F1532", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1532 )
-		pFnF1532 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1532" );
+	UFunction* const pFnF1532 = pFnF1532Ref.Get ( );
 
 	UBioAutoConditionals_execF1532_Parms F1532_Parms;
 	F1532_Parms.bioWorld = bioWorld;
@@ -17067,10 +16324,9 @@ bool UBioAutoConditionals::F1532 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1564 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1564 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1564Ref { L"Function PlotManager.BioAutoConditionals.F1564", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1564 )
-		pFnF1564 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1564" );
+	UFunction* const pFnF1564 = pFnF1564Ref.Get ( );
 
 	UBioAutoConditionals_execF1564_Parms F1564_Parms;
 	F1564_Parms.bioWorld = bioWorld;
@@ -17090,10 +16346,9 @@ bool UBioAutoConditionals::F1564 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1563 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1563 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1563Ref { L"Function PlotManager.BioAutoConditionals.F1563", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1563 )
-		pFnF1563 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1563" );
+	UFunction* const pFnF1563 = pFnF1563Ref.Get ( );
 
 	UBioAutoConditionals_execF1563_Parms F1563_Parms;
 	F1563_Parms.bioWorld = bioWorld;
@@ -17113,10 +16368,9 @@ bool UBioAutoConditionals::F1563 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1562 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1562 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1562Ref { L"Function PlotManager.BioAutoConditionals.F1562", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1562 )
-		pFnF1562 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1562" );
+	UFunction* const pFnF1562 = pFnF1562Ref.Get ( );
 
 	UBioAutoConditionals_execF1562_Parms F1562_Parms;
 	F1562_Parms.bioWorld = bioWorld;
@@ -17136,10 +16390,9 @@ bool UBioAutoConditionals::F1562 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1552 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1552 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1552Ref { L"Function PlotManager.BioAutoConditionals.F1552", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1552 )
-		pFnF1552 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1552" );
+	UFunction* const pFnF1552 = pFnF1552Ref.Get ( );
 
 	UBioAutoConditionals_execF1552_Parms F1552_Parms;
 	F1552_Parms.bioWorld = bioWorld;
@@ -17159,10 +16412,9 @@ bool UBioAutoConditionals::F1552 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1551 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1551 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1551Ref { L"Function PlotManager.BioAutoConditionals.F1551", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1551 )
-		pFnF1551 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1551" );
+	UFunction* const pFnF1551 = pFnF1551Ref.Get ( );
 
 	UBioAutoConditionals_execF1551_Parms F1551_Parms;
 	F1551_Parms.bioWorld = bioWorld;
@@ -17182,10 +16434,9 @@ bool UBioAutoConditionals::F1551 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1540 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1540 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1540Ref { L"Function PlotManager.BioAutoConditionals.F1540", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1540 )
-		pFnF1540 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1540" );
+	UFunction* const pFnF1540 = pFnF1540Ref.Get ( );
 
 	UBioAutoConditionals_execF1540_Parms F1540_Parms;
 	F1540_Parms.bioWorld = bioWorld;
@@ -17205,10 +16456,9 @@ bool UBioAutoConditionals::F1540 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1539 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1539 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1539Ref { L"Function PlotManager.BioAutoConditionals.F1539", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1539 )
-		pFnF1539 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1539" );
+	UFunction* const pFnF1539 = pFnF1539Ref.Get ( );
 
 	UBioAutoConditionals_execF1539_Parms F1539_Parms;
 	F1539_Parms.bioWorld = bioWorld;
@@ -17228,10 +16478,9 @@ bool UBioAutoConditionals::F1539 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1538 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1538 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1538Ref { L"Function PlotManager.BioAutoConditionals.F1538", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1538 )
-		pFnF1538 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1538" );
+	UFunction* const pFnF1538 = pFnF1538Ref.Get ( );
 
 	UBioAutoConditionals_execF1538_Parms F1538_Parms;
 	F1538_Parms.bioWorld = bioWorld;
@@ -17251,10 +16500,9 @@ bool UBioAutoConditionals::F1538 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1537 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1537 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1537Ref { L"Function PlotManager.BioAutoConditionals.F1537", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1537 )
-		pFnF1537 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1537" );
+	UFunction* const pFnF1537 = pFnF1537Ref.Get ( );
 
 	UBioAutoConditionals_execF1537_Parms F1537_Parms;
 	F1537_Parms.bioWorld = bioWorld;
@@ -17274,10 +16522,9 @@ bool UBioAutoConditionals::F1537 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1536 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1536 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1536Ref { L"Function PlotManager.BioAutoConditionals.F1536", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1536 )
-		pFnF1536 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1536" );
+	UFunction* const pFnF1536 = pFnF1536Ref.Get ( );
 
 	UBioAutoConditionals_execF1536_Parms F1536_Parms;
 	F1536_Parms.bioWorld = bioWorld;
@@ -17297,10 +16544,9 @@ bool UBioAutoConditionals::F1536 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1535 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1535 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1535Ref { L"Function PlotManager.BioAutoConditionals.F1535", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1535 )
-		pFnF1535 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1535" );
+	UFunction* const pFnF1535 = pFnF1535Ref.Get ( );
 
 	UBioAutoConditionals_execF1535_Parms F1535_Parms;
 	F1535_Parms.bioWorld = bioWorld;
@@ -17320,10 +16566,9 @@ bool UBioAutoConditionals::F1535 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1526 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1526 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1526Ref { L"Function PlotManager.BioAutoConditionals.F1526", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1526 )
-		pFnF1526 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1526" );
+	UFunction* const pFnF1526 = pFnF1526Ref.Get ( );
 
 	UBioAutoConditionals_execF1526_Parms F1526_Parms;
 	F1526_Parms.bioWorld = bioWorld;
@@ -17343,10 +16588,9 @@ bool UBioAutoConditionals::F1526 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1525 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1525 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1525Ref { L"Function PlotManager.BioAutoConditionals.F1525", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1525 )
-		pFnF1525 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1525" );
+	UFunction* const pFnF1525 = pFnF1525Ref.Get ( );
 
 	UBioAutoConditionals_execF1525_Parms F1525_Parms;
 	F1525_Parms.bioWorld = bioWorld;
@@ -17366,10 +16610,9 @@ bool UBioAutoConditionals::F1525 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1524 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1524 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1524Ref { L"Function PlotManager.BioAutoConditionals.F1524", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1524 )
-		pFnF1524 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1524" );
+	UFunction* const pFnF1524 = pFnF1524Ref.Get ( );
 
 	UBioAutoConditionals_execF1524_Parms F1524_Parms;
 	F1524_Parms.bioWorld = bioWorld;
@@ -17389,10 +16632,9 @@ bool UBioAutoConditionals::F1524 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1523 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1523 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1523Ref { L"Function PlotManager.BioAutoConditionals.F1523", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1523 )
-		pFnF1523 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1523" );
+	UFunction* const pFnF1523 = pFnF1523Ref.Get ( );
 
 	UBioAutoConditionals_execF1523_Parms F1523_Parms;
 	F1523_Parms.bioWorld = bioWorld;
@@ -17412,10 +16654,9 @@ bool UBioAutoConditionals::F1523 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1149 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1149 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1149Ref { L"Function PlotManager.BioAutoConditionals.F1149", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1149 )
-		pFnF1149 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1149" );
+	UFunction* const pFnF1149 = pFnF1149Ref.Get ( );
 
 	UBioAutoConditionals_execF1149_Parms F1149_Parms;
 	F1149_Parms.bioWorld = bioWorld;
@@ -17435,10 +16676,9 @@ bool UBioAutoConditionals::F1149 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1148 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1148 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1148Ref { L"Function PlotManager.BioAutoConditionals.F1148", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1148 )
-		pFnF1148 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1148" );
+	UFunction* const pFnF1148 = pFnF1148Ref.Get ( );
 
 	UBioAutoConditionals_execF1148_Parms F1148_Parms;
 	F1148_Parms.bioWorld = bioWorld;
@@ -17458,10 +16698,9 @@ bool UBioAutoConditionals::F1148 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1150 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1150 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1150Ref { L"Function PlotManager.BioAutoConditionals.F1150", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1150 )
-		pFnF1150 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1150" );
+	UFunction* const pFnF1150 = pFnF1150Ref.Get ( );
 
 	UBioAutoConditionals_execF1150_Parms F1150_Parms;
 	F1150_Parms.bioWorld = bioWorld;
@@ -17481,10 +16720,9 @@ bool UBioAutoConditionals::F1150 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1154 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1154 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1154Ref { L"Function PlotManager.BioAutoConditionals.F1154", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1154 )
-		pFnF1154 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1154" );
+	UFunction* const pFnF1154 = pFnF1154Ref.Get ( );
 
 	UBioAutoConditionals_execF1154_Parms F1154_Parms;
 	F1154_Parms.bioWorld = bioWorld;
@@ -17504,10 +16742,9 @@ bool UBioAutoConditionals::F1154 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1153 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1153 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1153Ref { L"Function PlotManager.BioAutoConditionals.F1153", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1153 )
-		pFnF1153 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1153" );
+	UFunction* const pFnF1153 = pFnF1153Ref.Get ( );
 
 	UBioAutoConditionals_execF1153_Parms F1153_Parms;
 	F1153_Parms.bioWorld = bioWorld;
@@ -17527,10 +16764,9 @@ bool UBioAutoConditionals::F1153 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1152 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1152 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1152Ref { L"Function PlotManager.BioAutoConditionals.F1152", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1152 )
-		pFnF1152 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1152" );
+	UFunction* const pFnF1152 = pFnF1152Ref.Get ( );
 
 	UBioAutoConditionals_execF1152_Parms F1152_Parms;
 	F1152_Parms.bioWorld = bioWorld;
@@ -17550,10 +16786,9 @@ bool UBioAutoConditionals::F1152 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1151 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1151 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1151Ref { L"Function PlotManager.BioAutoConditionals.F1151", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1151 )
-		pFnF1151 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1151" );
+	UFunction* const pFnF1151 = pFnF1151Ref.Get ( );
 
 	UBioAutoConditionals_execF1151_Parms F1151_Parms;
 	F1151_Parms.bioWorld = bioWorld;
@@ -17573,10 +16808,9 @@ bool UBioAutoConditionals::F1151 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1146 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1146 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1146Ref { L"Function PlotManager.BioAutoConditionals.F1146", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1146 )
-		pFnF1146 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1146" );
+	UFunction* const pFnF1146 = pFnF1146Ref.Get ( );
 
 	UBioAutoConditionals_execF1146_Parms F1146_Parms;
 	F1146_Parms.bioWorld = bioWorld;
@@ -17596,10 +16830,9 @@ bool UBioAutoConditionals::F1146 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1145 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1145 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1145Ref { L"Function PlotManager.BioAutoConditionals.F1145", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1145 )
-		pFnF1145 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1145" );
+	UFunction* const pFnF1145 = pFnF1145Ref.Get ( );
 
 	UBioAutoConditionals_execF1145_Parms F1145_Parms;
 	F1145_Parms.bioWorld = bioWorld;
@@ -17619,10 +16852,9 @@ bool UBioAutoConditionals::F1145 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1144 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1144 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1144Ref { L"Function PlotManager.BioAutoConditionals.F1144", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1144 )
-		pFnF1144 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1144" );
+	UFunction* const pFnF1144 = pFnF1144Ref.Get ( );
 
 	UBioAutoConditionals_execF1144_Parms F1144_Parms;
 	F1144_Parms.bioWorld = bioWorld;
@@ -17642,10 +16874,9 @@ bool UBioAutoConditionals::F1144 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1143 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1143 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1143Ref { L"Function PlotManager.BioAutoConditionals.F1143", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1143 )
-		pFnF1143 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1143" );
+	UFunction* const pFnF1143 = pFnF1143Ref.Get ( );
 
 	UBioAutoConditionals_execF1143_Parms F1143_Parms;
 	F1143_Parms.bioWorld = bioWorld;
@@ -17665,10 +16896,9 @@ bool UBioAutoConditionals::F1143 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1142 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1142 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1142Ref { L"Function PlotManager.BioAutoConditionals.F1142", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1142 )
-		pFnF1142 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1142" );
+	UFunction* const pFnF1142 = pFnF1142Ref.Get ( );
 
 	UBioAutoConditionals_execF1142_Parms F1142_Parms;
 	F1142_Parms.bioWorld = bioWorld;
@@ -17688,10 +16918,9 @@ bool UBioAutoConditionals::F1142 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1141 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1141 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1141Ref { L"Function PlotManager.BioAutoConditionals.F1141", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1141 )
-		pFnF1141 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1141" );
+	UFunction* const pFnF1141 = pFnF1141Ref.Get ( );
 
 	UBioAutoConditionals_execF1141_Parms F1141_Parms;
 	F1141_Parms.bioWorld = bioWorld;
@@ -17711,10 +16940,9 @@ bool UBioAutoConditionals::F1141 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1140 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1140 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1140Ref { L"Function PlotManager.BioAutoConditionals.F1140", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1140 )
-		pFnF1140 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1140" );
+	UFunction* const pFnF1140 = pFnF1140Ref.Get ( );
 
 	UBioAutoConditionals_execF1140_Parms F1140_Parms;
 	F1140_Parms.bioWorld = bioWorld;
@@ -17734,10 +16962,9 @@ bool UBioAutoConditionals::F1140 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1139 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1139 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1139Ref { L"Function PlotManager.BioAutoConditionals.F1139", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1139 )
-		pFnF1139 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1139" );
+	UFunction* const pFnF1139 = pFnF1139Ref.Get ( );
 
 	UBioAutoConditionals_execF1139_Parms F1139_Parms;
 	F1139_Parms.bioWorld = bioWorld;
@@ -17757,10 +16984,9 @@ bool UBioAutoConditionals::F1139 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1138 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1138 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1138Ref { L"Function PlotManager.BioAutoConditionals.F1138", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1138 )
-		pFnF1138 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1138" );
+	UFunction* const pFnF1138 = pFnF1138Ref.Get ( );
 
 	UBioAutoConditionals_execF1138_Parms F1138_Parms;
 	F1138_Parms.bioWorld = bioWorld;
@@ -17780,10 +17006,9 @@ bool UBioAutoConditionals::F1138 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1135 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1135 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1135Ref { L"Function PlotManager.BioAutoConditionals.F1135", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1135 )
-		pFnF1135 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1135" );
+	UFunction* const pFnF1135 = pFnF1135Ref.Get ( );
 
 	UBioAutoConditionals_execF1135_Parms F1135_Parms;
 	F1135_Parms.bioWorld = bioWorld;
@@ -17803,10 +17028,9 @@ bool UBioAutoConditionals::F1135 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1134 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1134 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1134Ref { L"Function PlotManager.BioAutoConditionals.F1134", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1134 )
-		pFnF1134 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1134" );
+	UFunction* const pFnF1134 = pFnF1134Ref.Get ( );
 
 	UBioAutoConditionals_execF1134_Parms F1134_Parms;
 	F1134_Parms.bioWorld = bioWorld;
@@ -17826,10 +17050,9 @@ bool UBioAutoConditionals::F1134 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1133 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1133 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1133Ref { L"Function PlotManager.BioAutoConditionals.F1133", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1133 )
-		pFnF1133 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1133" );
+	UFunction* const pFnF1133 = pFnF1133Ref.Get ( );
 
 	UBioAutoConditionals_execF1133_Parms F1133_Parms;
 	F1133_Parms.bioWorld = bioWorld;
@@ -17849,10 +17072,9 @@ bool UBioAutoConditionals::F1133 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1497 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1497 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1497Ref { L"Function PlotManager.BioAutoConditionals.F1497", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1497 )
-		pFnF1497 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1497" );
+	UFunction* const pFnF1497 = pFnF1497Ref.Get ( );
 
 	UBioAutoConditionals_execF1497_Parms F1497_Parms;
 	F1497_Parms.bioWorld = bioWorld;
@@ -17872,10 +17094,9 @@ bool UBioAutoConditionals::F1497 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1101 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1101 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1101Ref { L"Function PlotManager.BioAutoConditionals.F1101", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1101 )
-		pFnF1101 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1101" );
+	UFunction* const pFnF1101 = pFnF1101Ref.Get ( );
 
 	UBioAutoConditionals_execF1101_Parms F1101_Parms;
 	F1101_Parms.bioWorld = bioWorld;
@@ -17895,10 +17116,9 @@ bool UBioAutoConditionals::F1101 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1100 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1100 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1100Ref { L"Function PlotManager.BioAutoConditionals.F1100", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1100 )
-		pFnF1100 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1100" );
+	UFunction* const pFnF1100 = pFnF1100Ref.Get ( );
 
 	UBioAutoConditionals_execF1100_Parms F1100_Parms;
 	F1100_Parms.bioWorld = bioWorld;
@@ -17918,10 +17138,9 @@ bool UBioAutoConditionals::F1100 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1097 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1097 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1097Ref { L"Function PlotManager.BioAutoConditionals.F1097", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1097 )
-		pFnF1097 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1097" );
+	UFunction* const pFnF1097 = pFnF1097Ref.Get ( );
 
 	UBioAutoConditionals_execF1097_Parms F1097_Parms;
 	F1097_Parms.bioWorld = bioWorld;
@@ -17941,10 +17160,9 @@ bool UBioAutoConditionals::F1097 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1088 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1088 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1088Ref { L"Function PlotManager.BioAutoConditionals.F1088", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1088 )
-		pFnF1088 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1088" );
+	UFunction* const pFnF1088 = pFnF1088Ref.Get ( );
 
 	UBioAutoConditionals_execF1088_Parms F1088_Parms;
 	F1088_Parms.bioWorld = bioWorld;
@@ -17964,10 +17182,9 @@ bool UBioAutoConditionals::F1088 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1087 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1087 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1087Ref { L"Function PlotManager.BioAutoConditionals.F1087", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1087 )
-		pFnF1087 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1087" );
+	UFunction* const pFnF1087 = pFnF1087Ref.Get ( );
 
 	UBioAutoConditionals_execF1087_Parms F1087_Parms;
 	F1087_Parms.bioWorld = bioWorld;
@@ -17987,10 +17204,9 @@ bool UBioAutoConditionals::F1087 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1085 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1085 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1085Ref { L"Function PlotManager.BioAutoConditionals.F1085", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1085 )
-		pFnF1085 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1085" );
+	UFunction* const pFnF1085 = pFnF1085Ref.Get ( );
 
 	UBioAutoConditionals_execF1085_Parms F1085_Parms;
 	F1085_Parms.bioWorld = bioWorld;
@@ -18010,10 +17226,9 @@ bool UBioAutoConditionals::F1085 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1084 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1084 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1084Ref { L"Function PlotManager.BioAutoConditionals.F1084", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1084 )
-		pFnF1084 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1084" );
+	UFunction* const pFnF1084 = pFnF1084Ref.Get ( );
 
 	UBioAutoConditionals_execF1084_Parms F1084_Parms;
 	F1084_Parms.bioWorld = bioWorld;
@@ -18033,10 +17248,9 @@ bool UBioAutoConditionals::F1084 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1083 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1083 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1083Ref { L"Function PlotManager.BioAutoConditionals.F1083", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1083 )
-		pFnF1083 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1083" );
+	UFunction* const pFnF1083 = pFnF1083Ref.Get ( );
 
 	UBioAutoConditionals_execF1083_Parms F1083_Parms;
 	F1083_Parms.bioWorld = bioWorld;
@@ -18056,10 +17270,9 @@ bool UBioAutoConditionals::F1083 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1082 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1082 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1082Ref { L"Function PlotManager.BioAutoConditionals.F1082", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1082 )
-		pFnF1082 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1082" );
+	UFunction* const pFnF1082 = pFnF1082Ref.Get ( );
 
 	UBioAutoConditionals_execF1082_Parms F1082_Parms;
 	F1082_Parms.bioWorld = bioWorld;
@@ -18079,10 +17292,9 @@ bool UBioAutoConditionals::F1082 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1076 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1076 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1076Ref { L"Function PlotManager.BioAutoConditionals.F1076", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1076 )
-		pFnF1076 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1076" );
+	UFunction* const pFnF1076 = pFnF1076Ref.Get ( );
 
 	UBioAutoConditionals_execF1076_Parms F1076_Parms;
 	F1076_Parms.bioWorld = bioWorld;
@@ -18102,10 +17314,9 @@ bool UBioAutoConditionals::F1076 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1744 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1744 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1744Ref { L"Function PlotManager.BioAutoConditionals.F1744", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1744 )
-		pFnF1744 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1744" );
+	UFunction* const pFnF1744 = pFnF1744Ref.Get ( );
 
 	UBioAutoConditionals_execF1744_Parms F1744_Parms;
 	F1744_Parms.bioWorld = bioWorld;
@@ -18125,10 +17336,9 @@ bool UBioAutoConditionals::F1744 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1662 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1662 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1662Ref { L"Function PlotManager.BioAutoConditionals.F1662", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1662 )
-		pFnF1662 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1662" );
+	UFunction* const pFnF1662 = pFnF1662Ref.Get ( );
 
 	UBioAutoConditionals_execF1662_Parms F1662_Parms;
 	F1662_Parms.bioWorld = bioWorld;
@@ -18148,10 +17358,9 @@ bool UBioAutoConditionals::F1662 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1661 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1661 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1661Ref { L"Function PlotManager.BioAutoConditionals.F1661", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1661 )
-		pFnF1661 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1661" );
+	UFunction* const pFnF1661 = pFnF1661Ref.Get ( );
 
 	UBioAutoConditionals_execF1661_Parms F1661_Parms;
 	F1661_Parms.bioWorld = bioWorld;
@@ -18171,10 +17380,9 @@ bool UBioAutoConditionals::F1661 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1660 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1660 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1660Ref { L"Function PlotManager.BioAutoConditionals.F1660", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1660 )
-		pFnF1660 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1660" );
+	UFunction* const pFnF1660 = pFnF1660Ref.Get ( );
 
 	UBioAutoConditionals_execF1660_Parms F1660_Parms;
 	F1660_Parms.bioWorld = bioWorld;
@@ -18194,10 +17402,9 @@ bool UBioAutoConditionals::F1660 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1659 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1659 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1659Ref { L"Function PlotManager.BioAutoConditionals.F1659", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1659 )
-		pFnF1659 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1659" );
+	UFunction* const pFnF1659 = pFnF1659Ref.Get ( );
 
 	UBioAutoConditionals_execF1659_Parms F1659_Parms;
 	F1659_Parms.bioWorld = bioWorld;
@@ -18217,10 +17424,9 @@ bool UBioAutoConditionals::F1659 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1211 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1211 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1211Ref { L"Function PlotManager.BioAutoConditionals.F1211", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1211 )
-		pFnF1211 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1211" );
+	UFunction* const pFnF1211 = pFnF1211Ref.Get ( );
 
 	UBioAutoConditionals_execF1211_Parms F1211_Parms;
 	F1211_Parms.bioWorld = bioWorld;
@@ -18240,10 +17446,9 @@ bool UBioAutoConditionals::F1211 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1210 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1210 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1210Ref { L"Function PlotManager.BioAutoConditionals.F1210", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1210 )
-		pFnF1210 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1210" );
+	UFunction* const pFnF1210 = pFnF1210Ref.Get ( );
 
 	UBioAutoConditionals_execF1210_Parms F1210_Parms;
 	F1210_Parms.bioWorld = bioWorld;
@@ -18263,10 +17468,9 @@ bool UBioAutoConditionals::F1210 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1209 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1209 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1209Ref { L"Function PlotManager.BioAutoConditionals.F1209", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1209 )
-		pFnF1209 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1209" );
+	UFunction* const pFnF1209 = pFnF1209Ref.Get ( );
 
 	UBioAutoConditionals_execF1209_Parms F1209_Parms;
 	F1209_Parms.bioWorld = bioWorld;
@@ -18286,10 +17490,9 @@ bool UBioAutoConditionals::F1209 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1208 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1208 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1208Ref { L"Function PlotManager.BioAutoConditionals.F1208", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1208 )
-		pFnF1208 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1208" );
+	UFunction* const pFnF1208 = pFnF1208Ref.Get ( );
 
 	UBioAutoConditionals_execF1208_Parms F1208_Parms;
 	F1208_Parms.bioWorld = bioWorld;
@@ -18309,10 +17512,9 @@ bool UBioAutoConditionals::F1208 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1207 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1207 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1207Ref { L"Function PlotManager.BioAutoConditionals.F1207", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1207 )
-		pFnF1207 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1207" );
+	UFunction* const pFnF1207 = pFnF1207Ref.Get ( );
 
 	UBioAutoConditionals_execF1207_Parms F1207_Parms;
 	F1207_Parms.bioWorld = bioWorld;
@@ -18332,10 +17534,9 @@ bool UBioAutoConditionals::F1207 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1206 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1206 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1206Ref { L"Function PlotManager.BioAutoConditionals.F1206", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1206 )
-		pFnF1206 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1206" );
+	UFunction* const pFnF1206 = pFnF1206Ref.Get ( );
 
 	UBioAutoConditionals_execF1206_Parms F1206_Parms;
 	F1206_Parms.bioWorld = bioWorld;
@@ -18355,10 +17556,9 @@ bool UBioAutoConditionals::F1206 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1713 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1713 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1713Ref { L"Function PlotManager.BioAutoConditionals.F1713", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1713 )
-		pFnF1713 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1713" );
+	UFunction* const pFnF1713 = pFnF1713Ref.Get ( );
 
 	UBioAutoConditionals_execF1713_Parms F1713_Parms;
 	F1713_Parms.bioWorld = bioWorld;
@@ -18378,10 +17578,9 @@ bool UBioAutoConditionals::F1713 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1711 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1711 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1711Ref { L"Function PlotManager.BioAutoConditionals.F1711", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1711 )
-		pFnF1711 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1711" );
+	UFunction* const pFnF1711 = pFnF1711Ref.Get ( );
 
 	UBioAutoConditionals_execF1711_Parms F1711_Parms;
 	F1711_Parms.bioWorld = bioWorld;
@@ -18401,10 +17600,9 @@ bool UBioAutoConditionals::F1711 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1630 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1630 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1630Ref { L"Function PlotManager.BioAutoConditionals.F1630", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1630 )
-		pFnF1630 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1630" );
+	UFunction* const pFnF1630 = pFnF1630Ref.Get ( );
 
 	UBioAutoConditionals_execF1630_Parms F1630_Parms;
 	F1630_Parms.bioWorld = bioWorld;
@@ -18424,10 +17622,9 @@ bool UBioAutoConditionals::F1630 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1629 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1629 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1629Ref { L"Function PlotManager.BioAutoConditionals.F1629", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1629 )
-		pFnF1629 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1629" );
+	UFunction* const pFnF1629 = pFnF1629Ref.Get ( );
 
 	UBioAutoConditionals_execF1629_Parms F1629_Parms;
 	F1629_Parms.bioWorld = bioWorld;
@@ -18447,10 +17644,9 @@ bool UBioAutoConditionals::F1629 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1628 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1628 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1628Ref { L"Function PlotManager.BioAutoConditionals.F1628", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1628 )
-		pFnF1628 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1628" );
+	UFunction* const pFnF1628 = pFnF1628Ref.Get ( );
 
 	UBioAutoConditionals_execF1628_Parms F1628_Parms;
 	F1628_Parms.bioWorld = bioWorld;
@@ -18470,10 +17666,9 @@ bool UBioAutoConditionals::F1628 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1627 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1627 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1627Ref { L"Function PlotManager.BioAutoConditionals.F1627", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1627 )
-		pFnF1627 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1627" );
+	UFunction* const pFnF1627 = pFnF1627Ref.Get ( );
 
 	UBioAutoConditionals_execF1627_Parms F1627_Parms;
 	F1627_Parms.bioWorld = bioWorld;
@@ -18493,10 +17688,9 @@ bool UBioAutoConditionals::F1627 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1626 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1626 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1626Ref { L"Function PlotManager.BioAutoConditionals.F1626", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1626 )
-		pFnF1626 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1626" );
+	UFunction* const pFnF1626 = pFnF1626Ref.Get ( );
 
 	UBioAutoConditionals_execF1626_Parms F1626_Parms;
 	F1626_Parms.bioWorld = bioWorld;
@@ -18516,10 +17710,9 @@ bool UBioAutoConditionals::F1626 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1625 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1625 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1625Ref { L"Function PlotManager.BioAutoConditionals.F1625", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1625 )
-		pFnF1625 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1625" );
+	UFunction* const pFnF1625 = pFnF1625Ref.Get ( );
 
 	UBioAutoConditionals_execF1625_Parms F1625_Parms;
 	F1625_Parms.bioWorld = bioWorld;
@@ -18539,10 +17732,9 @@ bool UBioAutoConditionals::F1625 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1412 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1412 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1412Ref { L"Function PlotManager.BioAutoConditionals.F1412", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1412 )
-		pFnF1412 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1412" );
+	UFunction* const pFnF1412 = pFnF1412Ref.Get ( );
 
 	UBioAutoConditionals_execF1412_Parms F1412_Parms;
 	F1412_Parms.bioWorld = bioWorld;
@@ -18562,10 +17754,9 @@ bool UBioAutoConditionals::F1412 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1411 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1411 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1411Ref { L"Function PlotManager.BioAutoConditionals.F1411", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1411 )
-		pFnF1411 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1411" );
+	UFunction* const pFnF1411 = pFnF1411Ref.Get ( );
 
 	UBioAutoConditionals_execF1411_Parms F1411_Parms;
 	F1411_Parms.bioWorld = bioWorld;
@@ -18585,10 +17776,9 @@ bool UBioAutoConditionals::F1411 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1066 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1066 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1066Ref { L"Function PlotManager.BioAutoConditionals.F1066", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1066 )
-		pFnF1066 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1066" );
+	UFunction* const pFnF1066 = pFnF1066Ref.Get ( );
 
 	UBioAutoConditionals_execF1066_Parms F1066_Parms;
 	F1066_Parms.bioWorld = bioWorld;
@@ -18608,10 +17798,9 @@ bool UBioAutoConditionals::F1066 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1042 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1042 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1042Ref { L"Function PlotManager.BioAutoConditionals.F1042", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1042 )
-		pFnF1042 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1042" );
+	UFunction* const pFnF1042 = pFnF1042Ref.Get ( );
 
 	UBioAutoConditionals_execF1042_Parms F1042_Parms;
 	F1042_Parms.bioWorld = bioWorld;
@@ -18631,10 +17820,9 @@ bool UBioAutoConditionals::F1042 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F833 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF833 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF833Ref { L"Function PlotManager.BioAutoConditionals.F833", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF833 )
-		pFnF833 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F833" );
+	UFunction* const pFnF833 = pFnF833Ref.Get ( );
 
 	UBioAutoConditionals_execF833_Parms F833_Parms;
 	F833_Parms.bioWorld = bioWorld;
@@ -18654,10 +17842,9 @@ bool UBioAutoConditionals::F833 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F791 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF791 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF791Ref { L"Function PlotManager.BioAutoConditionals.F791", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF791 )
-		pFnF791 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F791" );
+	UFunction* const pFnF791 = pFnF791Ref.Get ( );
 
 	UBioAutoConditionals_execF791_Parms F791_Parms;
 	F791_Parms.bioWorld = bioWorld;
@@ -18677,10 +17864,9 @@ bool UBioAutoConditionals::F791 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F901 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF901 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF901Ref { L"Function PlotManager.BioAutoConditionals.F901", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF901 )
-		pFnF901 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F901" );
+	UFunction* const pFnF901 = pFnF901Ref.Get ( );
 
 	UBioAutoConditionals_execF901_Parms F901_Parms;
 	F901_Parms.bioWorld = bioWorld;
@@ -18700,10 +17886,9 @@ bool UBioAutoConditionals::F901 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F916 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF916 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF916Ref { L"Function PlotManager.BioAutoConditionals.F916", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF916 )
-		pFnF916 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F916" );
+	UFunction* const pFnF916 = pFnF916Ref.Get ( );
 
 	UBioAutoConditionals_execF916_Parms F916_Parms;
 	F916_Parms.bioWorld = bioWorld;
@@ -18723,10 +17908,9 @@ bool UBioAutoConditionals::F916 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F908 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF908 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF908Ref { L"Function PlotManager.BioAutoConditionals.F908", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF908 )
-		pFnF908 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F908" );
+	UFunction* const pFnF908 = pFnF908Ref.Get ( );
 
 	UBioAutoConditionals_execF908_Parms F908_Parms;
 	F908_Parms.bioWorld = bioWorld;
@@ -18746,10 +17930,9 @@ bool UBioAutoConditionals::F908 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F907 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF907 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF907Ref { L"Function PlotManager.BioAutoConditionals.F907", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF907 )
-		pFnF907 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F907" );
+	UFunction* const pFnF907 = pFnF907Ref.Get ( );
 
 	UBioAutoConditionals_execF907_Parms F907_Parms;
 	F907_Parms.bioWorld = bioWorld;
@@ -18769,10 +17952,9 @@ bool UBioAutoConditionals::F907 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F906 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF906 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF906Ref { L"Function PlotManager.BioAutoConditionals.F906", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF906 )
-		pFnF906 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F906" );
+	UFunction* const pFnF906 = pFnF906Ref.Get ( );
 
 	UBioAutoConditionals_execF906_Parms F906_Parms;
 	F906_Parms.bioWorld = bioWorld;
@@ -18792,10 +17974,9 @@ bool UBioAutoConditionals::F906 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F931 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF931 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF931Ref { L"Function PlotManager.BioAutoConditionals.F931", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF931 )
-		pFnF931 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F931" );
+	UFunction* const pFnF931 = pFnF931Ref.Get ( );
 
 	UBioAutoConditionals_execF931_Parms F931_Parms;
 	F931_Parms.bioWorld = bioWorld;
@@ -18815,10 +17996,9 @@ bool UBioAutoConditionals::F931 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F922 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF922 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF922Ref { L"Function PlotManager.BioAutoConditionals.F922", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF922 )
-		pFnF922 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F922" );
+	UFunction* const pFnF922 = pFnF922Ref.Get ( );
 
 	UBioAutoConditionals_execF922_Parms F922_Parms;
 	F922_Parms.bioWorld = bioWorld;
@@ -18838,10 +18018,9 @@ bool UBioAutoConditionals::F922 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F921 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF921 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF921Ref { L"Function PlotManager.BioAutoConditionals.F921", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF921 )
-		pFnF921 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F921" );
+	UFunction* const pFnF921 = pFnF921Ref.Get ( );
 
 	UBioAutoConditionals_execF921_Parms F921_Parms;
 	F921_Parms.bioWorld = bioWorld;
@@ -18861,10 +18040,9 @@ bool UBioAutoConditionals::F921 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F920 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF920 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF920Ref { L"Function PlotManager.BioAutoConditionals.F920", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF920 )
-		pFnF920 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F920" );
+	UFunction* const pFnF920 = pFnF920Ref.Get ( );
 
 	UBioAutoConditionals_execF920_Parms F920_Parms;
 	F920_Parms.bioWorld = bioWorld;
@@ -18884,10 +18062,9 @@ bool UBioAutoConditionals::F920 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F855 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF855 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF855Ref { L"Function PlotManager.BioAutoConditionals.F855", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF855 )
-		pFnF855 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F855" );
+	UFunction* const pFnF855 = pFnF855Ref.Get ( );
 
 	UBioAutoConditionals_execF855_Parms F855_Parms;
 	F855_Parms.bioWorld = bioWorld;
@@ -18907,10 +18084,9 @@ bool UBioAutoConditionals::F855 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F852 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF852 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF852Ref { L"Function PlotManager.BioAutoConditionals.F852", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF852 )
-		pFnF852 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F852" );
+	UFunction* const pFnF852 = pFnF852Ref.Get ( );
 
 	UBioAutoConditionals_execF852_Parms F852_Parms;
 	F852_Parms.bioWorld = bioWorld;
@@ -18930,10 +18106,9 @@ bool UBioAutoConditionals::F852 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F851 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF851 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF851Ref { L"Function PlotManager.BioAutoConditionals.F851", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF851 )
-		pFnF851 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F851" );
+	UFunction* const pFnF851 = pFnF851Ref.Get ( );
 
 	UBioAutoConditionals_execF851_Parms F851_Parms;
 	F851_Parms.bioWorld = bioWorld;
@@ -18953,10 +18128,9 @@ bool UBioAutoConditionals::F851 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F848 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF848 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF848Ref { L"Function PlotManager.BioAutoConditionals.F848", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF848 )
-		pFnF848 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F848" );
+	UFunction* const pFnF848 = pFnF848Ref.Get ( );
 
 	UBioAutoConditionals_execF848_Parms F848_Parms;
 	F848_Parms.bioWorld = bioWorld;
@@ -18976,10 +18150,9 @@ bool UBioAutoConditionals::F848 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F839 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF839 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF839Ref { L"Function PlotManager.BioAutoConditionals.F839", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF839 )
-		pFnF839 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F839" );
+	UFunction* const pFnF839 = pFnF839Ref.Get ( );
 
 	UBioAutoConditionals_execF839_Parms F839_Parms;
 	F839_Parms.bioWorld = bioWorld;
@@ -18999,10 +18172,9 @@ bool UBioAutoConditionals::F839 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F831 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF831 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF831Ref { L"Function PlotManager.BioAutoConditionals.F831", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF831 )
-		pFnF831 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F831" );
+	UFunction* const pFnF831 = pFnF831Ref.Get ( );
 
 	UBioAutoConditionals_execF831_Parms F831_Parms;
 	F831_Parms.bioWorld = bioWorld;
@@ -19022,10 +18194,9 @@ bool UBioAutoConditionals::F831 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F810 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF810 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF810Ref { L"Function PlotManager.BioAutoConditionals.F810", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF810 )
-		pFnF810 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F810" );
+	UFunction* const pFnF810 = pFnF810Ref.Get ( );
 
 	UBioAutoConditionals_execF810_Parms F810_Parms;
 	F810_Parms.bioWorld = bioWorld;
@@ -19045,10 +18216,9 @@ bool UBioAutoConditionals::F810 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F914 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF914 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF914Ref { L"Function PlotManager.BioAutoConditionals.F914", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF914 )
-		pFnF914 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F914" );
+	UFunction* const pFnF914 = pFnF914Ref.Get ( );
 
 	UBioAutoConditionals_execF914_Parms F914_Parms;
 	F914_Parms.bioWorld = bioWorld;
@@ -19068,10 +18238,9 @@ bool UBioAutoConditionals::F914 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F913 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF913 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF913Ref { L"Function PlotManager.BioAutoConditionals.F913", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF913 )
-		pFnF913 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F913" );
+	UFunction* const pFnF913 = pFnF913Ref.Get ( );
 
 	UBioAutoConditionals_execF913_Parms F913_Parms;
 	F913_Parms.bioWorld = bioWorld;
@@ -19091,10 +18260,9 @@ bool UBioAutoConditionals::F913 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F912 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF912 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF912Ref { L"Function PlotManager.BioAutoConditionals.F912", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF912 )
-		pFnF912 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F912" );
+	UFunction* const pFnF912 = pFnF912Ref.Get ( );
 
 	UBioAutoConditionals_execF912_Parms F912_Parms;
 	F912_Parms.bioWorld = bioWorld;
@@ -19114,10 +18282,9 @@ bool UBioAutoConditionals::F912 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F911 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF911 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF911Ref { L"Function PlotManager.BioAutoConditionals.F911", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF911 )
-		pFnF911 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F911" );
+	UFunction* const pFnF911 = pFnF911Ref.Get ( );
 
 	UBioAutoConditionals_execF911_Parms F911_Parms;
 	F911_Parms.bioWorld = bioWorld;
@@ -19137,10 +18304,9 @@ bool UBioAutoConditionals::F911 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F918 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF918 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF918Ref { L"Function PlotManager.BioAutoConditionals.F918", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF918 )
-		pFnF918 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F918" );
+	UFunction* const pFnF918 = pFnF918Ref.Get ( );
 
 	UBioAutoConditionals_execF918_Parms F918_Parms;
 	F918_Parms.bioWorld = bioWorld;
@@ -19160,10 +18326,9 @@ bool UBioAutoConditionals::F918 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F917 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF917 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF917Ref { L"Function PlotManager.BioAutoConditionals.F917", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF917 )
-		pFnF917 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F917" );
+	UFunction* const pFnF917 = pFnF917Ref.Get ( );
 
 	UBioAutoConditionals_execF917_Parms F917_Parms;
 	F917_Parms.bioWorld = bioWorld;
@@ -19183,10 +18348,9 @@ bool UBioAutoConditionals::F917 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F928 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF928 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF928Ref { L"Function PlotManager.BioAutoConditionals.F928", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF928 )
-		pFnF928 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F928" );
+	UFunction* const pFnF928 = pFnF928Ref.Get ( );
 
 	UBioAutoConditionals_execF928_Parms F928_Parms;
 	F928_Parms.bioWorld = bioWorld;
@@ -19206,10 +18370,9 @@ bool UBioAutoConditionals::F928 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F927 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF927 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF927Ref { L"Function PlotManager.BioAutoConditionals.F927", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF927 )
-		pFnF927 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F927" );
+	UFunction* const pFnF927 = pFnF927Ref.Get ( );
 
 	UBioAutoConditionals_execF927_Parms F927_Parms;
 	F927_Parms.bioWorld = bioWorld;
@@ -19229,10 +18392,9 @@ bool UBioAutoConditionals::F927 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1213 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1213 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1213Ref { L"Function PlotManager.BioAutoConditionals.F1213", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1213 )
-		pFnF1213 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1213" );
+	UFunction* const pFnF1213 = pFnF1213Ref.Get ( );
 
 	UBioAutoConditionals_execF1213_Parms F1213_Parms;
 	F1213_Parms.bioWorld = bioWorld;
@@ -19252,10 +18414,9 @@ bool UBioAutoConditionals::F1213 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1114 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1114 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1114Ref { L"Function PlotManager.BioAutoConditionals.F1114", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1114 )
-		pFnF1114 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1114" );
+	UFunction* const pFnF1114 = pFnF1114Ref.Get ( );
 
 	UBioAutoConditionals_execF1114_Parms F1114_Parms;
 	F1114_Parms.bioWorld = bioWorld;
@@ -19275,10 +18436,9 @@ bool UBioAutoConditionals::F1114 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F935 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF935 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF935Ref { L"Function PlotManager.BioAutoConditionals.F935", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF935 )
-		pFnF935 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F935" );
+	UFunction* const pFnF935 = pFnF935Ref.Get ( );
 
 	UBioAutoConditionals_execF935_Parms F935_Parms;
 	F935_Parms.bioWorld = bioWorld;
@@ -19298,10 +18458,9 @@ bool UBioAutoConditionals::F935 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F934 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF934 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF934Ref { L"Function PlotManager.BioAutoConditionals.F934", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF934 )
-		pFnF934 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F934" );
+	UFunction* const pFnF934 = pFnF934Ref.Get ( );
 
 	UBioAutoConditionals_execF934_Parms F934_Parms;
 	F934_Parms.bioWorld = bioWorld;
@@ -19321,10 +18480,9 @@ bool UBioAutoConditionals::F934 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F932 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF932 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF932Ref { L"Function PlotManager.BioAutoConditionals.F932", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF932 )
-		pFnF932 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F932" );
+	UFunction* const pFnF932 = pFnF932Ref.Get ( );
 
 	UBioAutoConditionals_execF932_Parms F932_Parms;
 	F932_Parms.bioWorld = bioWorld;
@@ -19344,10 +18502,9 @@ bool UBioAutoConditionals::F932 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F930 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF930 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF930Ref { L"Function PlotManager.BioAutoConditionals.F930", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF930 )
-		pFnF930 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F930" );
+	UFunction* const pFnF930 = pFnF930Ref.Get ( );
 
 	UBioAutoConditionals_execF930_Parms F930_Parms;
 	F930_Parms.bioWorld = bioWorld;
@@ -19367,10 +18524,9 @@ bool UBioAutoConditionals::F930 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F929 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF929 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF929Ref { L"Function PlotManager.BioAutoConditionals.F929", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF929 )
-		pFnF929 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F929" );
+	UFunction* const pFnF929 = pFnF929Ref.Get ( );
 
 	UBioAutoConditionals_execF929_Parms F929_Parms;
 	F929_Parms.bioWorld = bioWorld;
@@ -19390,10 +18546,9 @@ bool UBioAutoConditionals::F929 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1212 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1212 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1212Ref { L"Function PlotManager.BioAutoConditionals.F1212", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1212 )
-		pFnF1212 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1212" );
+	UFunction* const pFnF1212 = pFnF1212Ref.Get ( );
 
 	UBioAutoConditionals_execF1212_Parms F1212_Parms;
 	F1212_Parms.bioWorld = bioWorld;
@@ -19413,10 +18568,9 @@ bool UBioAutoConditionals::F1212 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1374 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1374 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1374Ref { L"Function PlotManager.BioAutoConditionals.F1374", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1374 )
-		pFnF1374 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1374" );
+	UFunction* const pFnF1374 = pFnF1374Ref.Get ( );
 
 	UBioAutoConditionals_execF1374_Parms F1374_Parms;
 	F1374_Parms.bioWorld = bioWorld;
@@ -19436,10 +18590,9 @@ bool UBioAutoConditionals::F1374 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F946 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF946 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF946Ref { L"Function PlotManager.BioAutoConditionals.F946", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF946 )
-		pFnF946 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F946" );
+	UFunction* const pFnF946 = pFnF946Ref.Get ( );
 
 	UBioAutoConditionals_execF946_Parms F946_Parms;
 	F946_Parms.bioWorld = bioWorld;
@@ -19459,10 +18612,9 @@ bool UBioAutoConditionals::F946 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F945 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF945 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF945Ref { L"Function PlotManager.BioAutoConditionals.F945", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF945 )
-		pFnF945 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F945" );
+	UFunction* const pFnF945 = pFnF945Ref.Get ( );
 
 	UBioAutoConditionals_execF945_Parms F945_Parms;
 	F945_Parms.bioWorld = bioWorld;
@@ -19482,10 +18634,9 @@ bool UBioAutoConditionals::F945 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F944 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF944 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF944Ref { L"Function PlotManager.BioAutoConditionals.F944", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF944 )
-		pFnF944 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F944" );
+	UFunction* const pFnF944 = pFnF944Ref.Get ( );
 
 	UBioAutoConditionals_execF944_Parms F944_Parms;
 	F944_Parms.bioWorld = bioWorld;
@@ -19505,10 +18656,9 @@ bool UBioAutoConditionals::F944 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F943 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF943 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF943Ref { L"Function PlotManager.BioAutoConditionals.F943", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF943 )
-		pFnF943 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F943" );
+	UFunction* const pFnF943 = pFnF943Ref.Get ( );
 
 	UBioAutoConditionals_execF943_Parms F943_Parms;
 	F943_Parms.bioWorld = bioWorld;
@@ -19528,10 +18678,9 @@ bool UBioAutoConditionals::F943 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F942 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF942 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF942Ref { L"Function PlotManager.BioAutoConditionals.F942", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF942 )
-		pFnF942 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F942" );
+	UFunction* const pFnF942 = pFnF942Ref.Get ( );
 
 	UBioAutoConditionals_execF942_Parms F942_Parms;
 	F942_Parms.bioWorld = bioWorld;
@@ -19551,10 +18700,9 @@ bool UBioAutoConditionals::F942 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F941 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF941 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF941Ref { L"Function PlotManager.BioAutoConditionals.F941", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF941 )
-		pFnF941 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F941" );
+	UFunction* const pFnF941 = pFnF941Ref.Get ( );
 
 	UBioAutoConditionals_execF941_Parms F941_Parms;
 	F941_Parms.bioWorld = bioWorld;
@@ -19574,10 +18722,9 @@ bool UBioAutoConditionals::F941 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F940 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF940 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF940Ref { L"Function PlotManager.BioAutoConditionals.F940", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF940 )
-		pFnF940 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F940" );
+	UFunction* const pFnF940 = pFnF940Ref.Get ( );
 
 	UBioAutoConditionals_execF940_Parms F940_Parms;
 	F940_Parms.bioWorld = bioWorld;
@@ -19597,10 +18744,9 @@ bool UBioAutoConditionals::F940 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F939 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF939 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF939Ref { L"Function PlotManager.BioAutoConditionals.F939", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF939 )
-		pFnF939 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F939" );
+	UFunction* const pFnF939 = pFnF939Ref.Get ( );
 
 	UBioAutoConditionals_execF939_Parms F939_Parms;
 	F939_Parms.bioWorld = bioWorld;
@@ -19620,10 +18766,9 @@ bool UBioAutoConditionals::F939 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F938 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF938 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF938Ref { L"Function PlotManager.BioAutoConditionals.F938", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF938 )
-		pFnF938 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F938" );
+	UFunction* const pFnF938 = pFnF938Ref.Get ( );
 
 	UBioAutoConditionals_execF938_Parms F938_Parms;
 	F938_Parms.bioWorld = bioWorld;
@@ -19643,10 +18788,9 @@ bool UBioAutoConditionals::F938 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F937 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF937 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF937Ref { L"Function PlotManager.BioAutoConditionals.F937", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF937 )
-		pFnF937 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F937" );
+	UFunction* const pFnF937 = pFnF937Ref.Get ( );
 
 	UBioAutoConditionals_execF937_Parms F937_Parms;
 	F937_Parms.bioWorld = bioWorld;
@@ -19666,10 +18810,9 @@ bool UBioAutoConditionals::F937 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F936 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF936 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF936Ref { L"Function PlotManager.BioAutoConditionals.F936", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF936 )
-		pFnF936 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F936" );
+	UFunction* const pFnF936 = pFnF936Ref.Get ( );
 
 	UBioAutoConditionals_execF936_Parms F936_Parms;
 	F936_Parms.bioWorld = bioWorld;
@@ -19689,10 +18832,9 @@ bool UBioAutoConditionals::F936 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F933 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF933 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF933Ref { L"Function PlotManager.BioAutoConditionals.F933", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF933 )
-		pFnF933 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F933" );
+	UFunction* const pFnF933 = pFnF933Ref.Get ( );
 
 	UBioAutoConditionals_execF933_Parms F933_Parms;
 	F933_Parms.bioWorld = bioWorld;
@@ -19712,10 +18854,9 @@ bool UBioAutoConditionals::F933 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F850 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF850 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF850Ref { L"Function PlotManager.BioAutoConditionals.F850", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF850 )
-		pFnF850 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F850" );
+	UFunction* const pFnF850 = pFnF850Ref.Get ( );
 
 	UBioAutoConditionals_execF850_Parms F850_Parms;
 	F850_Parms.bioWorld = bioWorld;
@@ -19735,10 +18876,9 @@ bool UBioAutoConditionals::F850 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F847 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF847 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF847Ref { L"Function PlotManager.BioAutoConditionals.F847", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF847 )
-		pFnF847 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F847" );
+	UFunction* const pFnF847 = pFnF847Ref.Get ( );
 
 	UBioAutoConditionals_execF847_Parms F847_Parms;
 	F847_Parms.bioWorld = bioWorld;
@@ -19758,10 +18898,9 @@ bool UBioAutoConditionals::F847 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F846 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF846 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF846Ref { L"Function PlotManager.BioAutoConditionals.F846", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF846 )
-		pFnF846 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F846" );
+	UFunction* const pFnF846 = pFnF846Ref.Get ( );
 
 	UBioAutoConditionals_execF846_Parms F846_Parms;
 	F846_Parms.bioWorld = bioWorld;
@@ -19781,10 +18920,9 @@ bool UBioAutoConditionals::F846 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F808 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF808 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF808Ref { L"Function PlotManager.BioAutoConditionals.F808", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF808 )
-		pFnF808 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F808" );
+	UFunction* const pFnF808 = pFnF808Ref.Get ( );
 
 	UBioAutoConditionals_execF808_Parms F808_Parms;
 	F808_Parms.bioWorld = bioWorld;
@@ -19804,10 +18942,9 @@ bool UBioAutoConditionals::F808 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F806 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF806 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF806Ref { L"Function PlotManager.BioAutoConditionals.F806", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF806 )
-		pFnF806 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F806" );
+	UFunction* const pFnF806 = pFnF806Ref.Get ( );
 
 	UBioAutoConditionals_execF806_Parms F806_Parms;
 	F806_Parms.bioWorld = bioWorld;
@@ -19827,10 +18964,9 @@ bool UBioAutoConditionals::F806 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F710 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF710 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF710Ref { L"Function PlotManager.BioAutoConditionals.F710", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF710 )
-		pFnF710 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F710" );
+	UFunction* const pFnF710 = pFnF710Ref.Get ( );
 
 	UBioAutoConditionals_execF710_Parms F710_Parms;
 	F710_Parms.bioWorld = bioWorld;
@@ -19850,10 +18986,9 @@ bool UBioAutoConditionals::F710 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F709 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF709 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF709Ref { L"Function PlotManager.BioAutoConditionals.F709", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF709 )
-		pFnF709 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F709" );
+	UFunction* const pFnF709 = pFnF709Ref.Get ( );
 
 	UBioAutoConditionals_execF709_Parms F709_Parms;
 	F709_Parms.bioWorld = bioWorld;
@@ -19873,10 +19008,9 @@ bool UBioAutoConditionals::F709 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2012 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2012 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2012Ref { L"Function PlotManager.BioAutoConditionals.F2012", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2012 )
-		pFnF2012 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2012" );
+	UFunction* const pFnF2012 = pFnF2012Ref.Get ( );
 
 	UBioAutoConditionals_execF2012_Parms F2012_Parms;
 	F2012_Parms.bioWorld = bioWorld;
@@ -19896,10 +19030,9 @@ bool UBioAutoConditionals::F2012 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1601 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1601 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1601Ref { L"Function PlotManager.BioAutoConditionals.F1601", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1601 )
-		pFnF1601 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1601" );
+	UFunction* const pFnF1601 = pFnF1601Ref.Get ( );
 
 	UBioAutoConditionals_execF1601_Parms F1601_Parms;
 	F1601_Parms.bioWorld = bioWorld;
@@ -19919,10 +19052,9 @@ bool UBioAutoConditionals::F1601 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1600 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1600 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1600Ref { L"Function PlotManager.BioAutoConditionals.F1600", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1600 )
-		pFnF1600 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1600" );
+	UFunction* const pFnF1600 = pFnF1600Ref.Get ( );
 
 	UBioAutoConditionals_execF1600_Parms F1600_Parms;
 	F1600_Parms.bioWorld = bioWorld;
@@ -19942,10 +19074,9 @@ bool UBioAutoConditionals::F1600 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1078 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1078 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1078Ref { L"Function PlotManager.BioAutoConditionals.F1078", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1078 )
-		pFnF1078 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1078" );
+	UFunction* const pFnF1078 = pFnF1078Ref.Get ( );
 
 	UBioAutoConditionals_execF1078_Parms F1078_Parms;
 	F1078_Parms.bioWorld = bioWorld;
@@ -19965,10 +19096,9 @@ bool UBioAutoConditionals::F1078 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1077 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1077 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1077Ref { L"Function PlotManager.BioAutoConditionals.F1077", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1077 )
-		pFnF1077 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1077" );
+	UFunction* const pFnF1077 = pFnF1077Ref.Get ( );
 
 	UBioAutoConditionals_execF1077_Parms F1077_Parms;
 	F1077_Parms.bioWorld = bioWorld;
@@ -19988,10 +19118,9 @@ bool UBioAutoConditionals::F1077 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1074 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1074 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1074Ref { L"Function PlotManager.BioAutoConditionals.F1074", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1074 )
-		pFnF1074 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1074" );
+	UFunction* const pFnF1074 = pFnF1074Ref.Get ( );
 
 	UBioAutoConditionals_execF1074_Parms F1074_Parms;
 	F1074_Parms.bioWorld = bioWorld;
@@ -20011,10 +19140,9 @@ bool UBioAutoConditionals::F1074 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1073 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1073 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1073Ref { L"Function PlotManager.BioAutoConditionals.F1073", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1073 )
-		pFnF1073 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1073" );
+	UFunction* const pFnF1073 = pFnF1073Ref.Get ( );
 
 	UBioAutoConditionals_execF1073_Parms F1073_Parms;
 	F1073_Parms.bioWorld = bioWorld;
@@ -20034,10 +19162,9 @@ bool UBioAutoConditionals::F1073 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1072 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1072 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1072Ref { L"Function PlotManager.BioAutoConditionals.F1072", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1072 )
-		pFnF1072 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1072" );
+	UFunction* const pFnF1072 = pFnF1072Ref.Get ( );
 
 	UBioAutoConditionals_execF1072_Parms F1072_Parms;
 	F1072_Parms.bioWorld = bioWorld;
@@ -20057,10 +19184,9 @@ bool UBioAutoConditionals::F1072 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1071 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1071 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1071Ref { L"Function PlotManager.BioAutoConditionals.F1071", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1071 )
-		pFnF1071 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1071" );
+	UFunction* const pFnF1071 = pFnF1071Ref.Get ( );
 
 	UBioAutoConditionals_execF1071_Parms F1071_Parms;
 	F1071_Parms.bioWorld = bioWorld;
@@ -20080,10 +19206,9 @@ bool UBioAutoConditionals::F1071 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1070 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1070 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1070Ref { L"Function PlotManager.BioAutoConditionals.F1070", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1070 )
-		pFnF1070 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1070" );
+	UFunction* const pFnF1070 = pFnF1070Ref.Get ( );
 
 	UBioAutoConditionals_execF1070_Parms F1070_Parms;
 	F1070_Parms.bioWorld = bioWorld;
@@ -20103,10 +19228,9 @@ bool UBioAutoConditionals::F1070 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1069 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1069 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1069Ref { L"Function PlotManager.BioAutoConditionals.F1069", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1069 )
-		pFnF1069 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1069" );
+	UFunction* const pFnF1069 = pFnF1069Ref.Get ( );
 
 	UBioAutoConditionals_execF1069_Parms F1069_Parms;
 	F1069_Parms.bioWorld = bioWorld;
@@ -20126,10 +19250,9 @@ bool UBioAutoConditionals::F1069 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1068 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1068 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1068Ref { L"Function PlotManager.BioAutoConditionals.F1068", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1068 )
-		pFnF1068 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1068" );
+	UFunction* const pFnF1068 = pFnF1068Ref.Get ( );
 
 	UBioAutoConditionals_execF1068_Parms F1068_Parms;
 	F1068_Parms.bioWorld = bioWorld;
@@ -20149,10 +19272,9 @@ bool UBioAutoConditionals::F1068 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1599 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1599 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1599Ref { L"Function PlotManager.BioAutoConditionals.F1599", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1599 )
-		pFnF1599 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1599" );
+	UFunction* const pFnF1599 = pFnF1599Ref.Get ( );
 
 	UBioAutoConditionals_execF1599_Parms F1599_Parms;
 	F1599_Parms.bioWorld = bioWorld;
@@ -20172,10 +19294,9 @@ bool UBioAutoConditionals::F1599 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1189 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1189 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1189Ref { L"Function PlotManager.BioAutoConditionals.F1189", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1189 )
-		pFnF1189 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1189" );
+	UFunction* const pFnF1189 = pFnF1189Ref.Get ( );
 
 	UBioAutoConditionals_execF1189_Parms F1189_Parms;
 	F1189_Parms.bioWorld = bioWorld;
@@ -20195,10 +19316,9 @@ bool UBioAutoConditionals::F1189 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1188 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1188 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1188Ref { L"Function PlotManager.BioAutoConditionals.F1188", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1188 )
-		pFnF1188 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1188" );
+	UFunction* const pFnF1188 = pFnF1188Ref.Get ( );
 
 	UBioAutoConditionals_execF1188_Parms F1188_Parms;
 	F1188_Parms.bioWorld = bioWorld;
@@ -20218,10 +19338,9 @@ bool UBioAutoConditionals::F1188 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1187 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1187 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1187Ref { L"Function PlotManager.BioAutoConditionals.F1187", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1187 )
-		pFnF1187 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1187" );
+	UFunction* const pFnF1187 = pFnF1187Ref.Get ( );
 
 	UBioAutoConditionals_execF1187_Parms F1187_Parms;
 	F1187_Parms.bioWorld = bioWorld;
@@ -20241,10 +19360,9 @@ bool UBioAutoConditionals::F1187 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F830 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF830 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF830Ref { L"Function PlotManager.BioAutoConditionals.F830", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF830 )
-		pFnF830 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F830" );
+	UFunction* const pFnF830 = pFnF830Ref.Get ( );
 
 	UBioAutoConditionals_execF830_Parms F830_Parms;
 	F830_Parms.bioWorld = bioWorld;
@@ -20264,10 +19382,9 @@ bool UBioAutoConditionals::F830 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F829 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF829 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF829Ref { L"Function PlotManager.BioAutoConditionals.F829", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF829 )
-		pFnF829 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F829" );
+	UFunction* const pFnF829 = pFnF829Ref.Get ( );
 
 	UBioAutoConditionals_execF829_Parms F829_Parms;
 	F829_Parms.bioWorld = bioWorld;
@@ -20287,10 +19404,9 @@ bool UBioAutoConditionals::F829 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F828 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF828 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF828Ref { L"Function PlotManager.BioAutoConditionals.F828", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF828 )
-		pFnF828 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F828" );
+	UFunction* const pFnF828 = pFnF828Ref.Get ( );
 
 	UBioAutoConditionals_execF828_Parms F828_Parms;
 	F828_Parms.bioWorld = bioWorld;
@@ -20310,10 +19426,9 @@ bool UBioAutoConditionals::F828 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F827 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF827 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF827Ref { L"Function PlotManager.BioAutoConditionals.F827", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF827 )
-		pFnF827 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F827" );
+	UFunction* const pFnF827 = pFnF827Ref.Get ( );
 
 	UBioAutoConditionals_execF827_Parms F827_Parms;
 	F827_Parms.bioWorld = bioWorld;
@@ -20333,10 +19448,9 @@ bool UBioAutoConditionals::F827 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F826 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF826 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF826Ref { L"Function PlotManager.BioAutoConditionals.F826", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF826 )
-		pFnF826 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F826" );
+	UFunction* const pFnF826 = pFnF826Ref.Get ( );
 
 	UBioAutoConditionals_execF826_Parms F826_Parms;
 	F826_Parms.bioWorld = bioWorld;
@@ -20356,10 +19470,9 @@ bool UBioAutoConditionals::F826 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F825 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF825 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF825Ref { L"Function PlotManager.BioAutoConditionals.F825", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF825 )
-		pFnF825 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F825" );
+	UFunction* const pFnF825 = pFnF825Ref.Get ( );
 
 	UBioAutoConditionals_execF825_Parms F825_Parms;
 	F825_Parms.bioWorld = bioWorld;
@@ -20379,10 +19492,9 @@ bool UBioAutoConditionals::F825 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F824 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF824 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF824Ref { L"Function PlotManager.BioAutoConditionals.F824", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF824 )
-		pFnF824 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F824" );
+	UFunction* const pFnF824 = pFnF824Ref.Get ( );
 
 	UBioAutoConditionals_execF824_Parms F824_Parms;
 	F824_Parms.bioWorld = bioWorld;
@@ -20402,10 +19514,9 @@ bool UBioAutoConditionals::F824 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F823 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF823 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF823Ref { L"Function PlotManager.BioAutoConditionals.F823", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF823 )
-		pFnF823 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F823" );
+	UFunction* const pFnF823 = pFnF823Ref.Get ( );
 
 	UBioAutoConditionals_execF823_Parms F823_Parms;
 	F823_Parms.bioWorld = bioWorld;
@@ -20425,10 +19536,9 @@ bool UBioAutoConditionals::F823 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F822 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF822 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF822Ref { L"Function PlotManager.BioAutoConditionals.F822", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF822 )
-		pFnF822 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F822" );
+	UFunction* const pFnF822 = pFnF822Ref.Get ( );
 
 	UBioAutoConditionals_execF822_Parms F822_Parms;
 	F822_Parms.bioWorld = bioWorld;
@@ -20448,10 +19558,9 @@ bool UBioAutoConditionals::F822 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F821 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF821 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF821Ref { L"Function PlotManager.BioAutoConditionals.F821", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF821 )
-		pFnF821 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F821" );
+	UFunction* const pFnF821 = pFnF821Ref.Get ( );
 
 	UBioAutoConditionals_execF821_Parms F821_Parms;
 	F821_Parms.bioWorld = bioWorld;
@@ -20471,10 +19580,9 @@ bool UBioAutoConditionals::F821 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F820 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF820 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF820Ref { L"Function PlotManager.BioAutoConditionals.F820", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF820 )
-		pFnF820 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F820" );
+	UFunction* const pFnF820 = pFnF820Ref.Get ( );
 
 	UBioAutoConditionals_execF820_Parms F820_Parms;
 	F820_Parms.bioWorld = bioWorld;
@@ -20494,10 +19602,9 @@ bool UBioAutoConditionals::F820 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F819 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF819 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF819Ref { L"Function PlotManager.BioAutoConditionals.F819", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF819 )
-		pFnF819 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F819" );
+	UFunction* const pFnF819 = pFnF819Ref.Get ( );
 
 	UBioAutoConditionals_execF819_Parms F819_Parms;
 	F819_Parms.bioWorld = bioWorld;
@@ -20517,10 +19624,9 @@ bool UBioAutoConditionals::F819 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F818 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF818 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF818Ref { L"Function PlotManager.BioAutoConditionals.F818", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF818 )
-		pFnF818 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F818" );
+	UFunction* const pFnF818 = pFnF818Ref.Get ( );
 
 	UBioAutoConditionals_execF818_Parms F818_Parms;
 	F818_Parms.bioWorld = bioWorld;
@@ -20540,10 +19646,9 @@ bool UBioAutoConditionals::F818 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F817 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF817 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF817Ref { L"Function PlotManager.BioAutoConditionals.F817", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF817 )
-		pFnF817 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F817" );
+	UFunction* const pFnF817 = pFnF817Ref.Get ( );
 
 	UBioAutoConditionals_execF817_Parms F817_Parms;
 	F817_Parms.bioWorld = bioWorld;
@@ -20563,10 +19668,9 @@ bool UBioAutoConditionals::F817 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F816 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF816 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF816Ref { L"Function PlotManager.BioAutoConditionals.F816", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF816 )
-		pFnF816 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F816" );
+	UFunction* const pFnF816 = pFnF816Ref.Get ( );
 
 	UBioAutoConditionals_execF816_Parms F816_Parms;
 	F816_Parms.bioWorld = bioWorld;
@@ -20586,10 +19690,9 @@ bool UBioAutoConditionals::F816 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F815 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF815 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF815Ref { L"Function PlotManager.BioAutoConditionals.F815", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF815 )
-		pFnF815 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F815" );
+	UFunction* const pFnF815 = pFnF815Ref.Get ( );
 
 	UBioAutoConditionals_execF815_Parms F815_Parms;
 	F815_Parms.bioWorld = bioWorld;
@@ -20609,10 +19712,9 @@ bool UBioAutoConditionals::F815 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F814 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF814 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF814Ref { L"Function PlotManager.BioAutoConditionals.F814", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF814 )
-		pFnF814 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F814" );
+	UFunction* const pFnF814 = pFnF814Ref.Get ( );
 
 	UBioAutoConditionals_execF814_Parms F814_Parms;
 	F814_Parms.bioWorld = bioWorld;
@@ -20632,10 +19734,9 @@ bool UBioAutoConditionals::F814 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F813 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF813 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF813Ref { L"Function PlotManager.BioAutoConditionals.F813", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF813 )
-		pFnF813 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F813" );
+	UFunction* const pFnF813 = pFnF813Ref.Get ( );
 
 	UBioAutoConditionals_execF813_Parms F813_Parms;
 	F813_Parms.bioWorld = bioWorld;
@@ -20655,10 +19756,9 @@ bool UBioAutoConditionals::F813 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F812 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF812 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF812Ref { L"Function PlotManager.BioAutoConditionals.F812", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF812 )
-		pFnF812 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F812" );
+	UFunction* const pFnF812 = pFnF812Ref.Get ( );
 
 	UBioAutoConditionals_execF812_Parms F812_Parms;
 	F812_Parms.bioWorld = bioWorld;
@@ -20678,10 +19778,9 @@ bool UBioAutoConditionals::F812 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F811 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF811 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF811Ref { L"Function PlotManager.BioAutoConditionals.F811", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF811 )
-		pFnF811 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F811" );
+	UFunction* const pFnF811 = pFnF811Ref.Get ( );
 
 	UBioAutoConditionals_execF811_Parms F811_Parms;
 	F811_Parms.bioWorld = bioWorld;
@@ -20701,10 +19800,9 @@ bool UBioAutoConditionals::F811 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F692 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF692 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF692Ref { L"Function PlotManager.BioAutoConditionals.F692", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF692 )
-		pFnF692 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F692" );
+	UFunction* const pFnF692 = pFnF692Ref.Get ( );
 
 	UBioAutoConditionals_execF692_Parms F692_Parms;
 	F692_Parms.bioWorld = bioWorld;
@@ -20724,10 +19822,9 @@ bool UBioAutoConditionals::F692 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F536 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF536 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF536Ref { L"Function PlotManager.BioAutoConditionals.F536", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF536 )
-		pFnF536 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F536" );
+	UFunction* const pFnF536 = pFnF536Ref.Get ( );
 
 	UBioAutoConditionals_execF536_Parms F536_Parms;
 	F536_Parms.bioWorld = bioWorld;
@@ -20747,10 +19844,9 @@ bool UBioAutoConditionals::F536 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F879 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF879 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF879Ref { L"Function PlotManager.BioAutoConditionals.F879", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF879 )
-		pFnF879 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F879" );
+	UFunction* const pFnF879 = pFnF879Ref.Get ( );
 
 	UBioAutoConditionals_execF879_Parms F879_Parms;
 	F879_Parms.bioWorld = bioWorld;
@@ -20770,10 +19866,9 @@ bool UBioAutoConditionals::F879 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1671 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1671 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1671Ref { L"Function PlotManager.BioAutoConditionals.F1671", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1671 )
-		pFnF1671 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1671" );
+	UFunction* const pFnF1671 = pFnF1671Ref.Get ( );
 
 	UBioAutoConditionals_execF1671_Parms F1671_Parms;
 	F1671_Parms.bioWorld = bioWorld;
@@ -20793,10 +19888,9 @@ bool UBioAutoConditionals::F1671 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1226 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1226 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1226Ref { L"Function PlotManager.BioAutoConditionals.F1226", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1226 )
-		pFnF1226 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1226" );
+	UFunction* const pFnF1226 = pFnF1226Ref.Get ( );
 
 	UBioAutoConditionals_execF1226_Parms F1226_Parms;
 	F1226_Parms.bioWorld = bioWorld;
@@ -20816,10 +19910,9 @@ bool UBioAutoConditionals::F1226 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F981 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF981 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF981Ref { L"Function PlotManager.BioAutoConditionals.F981", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF981 )
-		pFnF981 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F981" );
+	UFunction* const pFnF981 = pFnF981Ref.Get ( );
 
 	UBioAutoConditionals_execF981_Parms F981_Parms;
 	F981_Parms.bioWorld = bioWorld;
@@ -20839,10 +19932,9 @@ bool UBioAutoConditionals::F981 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1009 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1009 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1009Ref { L"Function PlotManager.BioAutoConditionals.F1009", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1009 )
-		pFnF1009 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1009" );
+	UFunction* const pFnF1009 = pFnF1009Ref.Get ( );
 
 	UBioAutoConditionals_execF1009_Parms F1009_Parms;
 	F1009_Parms.bioWorld = bioWorld;
@@ -20862,10 +19954,9 @@ bool UBioAutoConditionals::F1009 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1008 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1008 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1008Ref { L"Function PlotManager.BioAutoConditionals.F1008", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1008 )
-		pFnF1008 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1008" );
+	UFunction* const pFnF1008 = pFnF1008Ref.Get ( );
 
 	UBioAutoConditionals_execF1008_Parms F1008_Parms;
 	F1008_Parms.bioWorld = bioWorld;
@@ -20885,10 +19976,9 @@ bool UBioAutoConditionals::F1008 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1007 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1007 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1007Ref { L"Function PlotManager.BioAutoConditionals.F1007", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1007 )
-		pFnF1007 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1007" );
+	UFunction* const pFnF1007 = pFnF1007Ref.Get ( );
 
 	UBioAutoConditionals_execF1007_Parms F1007_Parms;
 	F1007_Parms.bioWorld = bioWorld;
@@ -20908,10 +19998,9 @@ bool UBioAutoConditionals::F1007 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1004 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1004 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1004Ref { L"Function PlotManager.BioAutoConditionals.F1004", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1004 )
-		pFnF1004 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1004" );
+	UFunction* const pFnF1004 = pFnF1004Ref.Get ( );
 
 	UBioAutoConditionals_execF1004_Parms F1004_Parms;
 	F1004_Parms.bioWorld = bioWorld;
@@ -20931,10 +20020,9 @@ bool UBioAutoConditionals::F1004 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1065 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1065 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1065Ref { L"Function PlotManager.BioAutoConditionals.F1065", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1065 )
-		pFnF1065 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1065" );
+	UFunction* const pFnF1065 = pFnF1065Ref.Get ( );
 
 	UBioAutoConditionals_execF1065_Parms F1065_Parms;
 	F1065_Parms.bioWorld = bioWorld;
@@ -20954,10 +20042,9 @@ bool UBioAutoConditionals::F1065 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1037 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1037 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1037Ref { L"Function PlotManager.BioAutoConditionals.F1037", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1037 )
-		pFnF1037 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1037" );
+	UFunction* const pFnF1037 = pFnF1037Ref.Get ( );
 
 	UBioAutoConditionals_execF1037_Parms F1037_Parms;
 	F1037_Parms.bioWorld = bioWorld;
@@ -20977,10 +20064,9 @@ bool UBioAutoConditionals::F1037 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1036 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1036 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1036Ref { L"Function PlotManager.BioAutoConditionals.F1036", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1036 )
-		pFnF1036 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1036" );
+	UFunction* const pFnF1036 = pFnF1036Ref.Get ( );
 
 	UBioAutoConditionals_execF1036_Parms F1036_Parms;
 	F1036_Parms.bioWorld = bioWorld;
@@ -21000,10 +20086,9 @@ bool UBioAutoConditionals::F1036 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1035 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1035 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1035Ref { L"Function PlotManager.BioAutoConditionals.F1035", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1035 )
-		pFnF1035 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1035" );
+	UFunction* const pFnF1035 = pFnF1035Ref.Get ( );
 
 	UBioAutoConditionals_execF1035_Parms F1035_Parms;
 	F1035_Parms.bioWorld = bioWorld;
@@ -21023,10 +20108,9 @@ bool UBioAutoConditionals::F1035 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1402 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1402 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1402Ref { L"Function PlotManager.BioAutoConditionals.F1402", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1402 )
-		pFnF1402 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1402" );
+	UFunction* const pFnF1402 = pFnF1402Ref.Get ( );
 
 	UBioAutoConditionals_execF1402_Parms F1402_Parms;
 	F1402_Parms.bioWorld = bioWorld;
@@ -21046,10 +20130,9 @@ bool UBioAutoConditionals::F1402 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1495 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1495 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1495Ref { L"Function PlotManager.BioAutoConditionals.F1495", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1495 )
-		pFnF1495 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1495" );
+	UFunction* const pFnF1495 = pFnF1495Ref.Get ( );
 
 	UBioAutoConditionals_execF1495_Parms F1495_Parms;
 	F1495_Parms.bioWorld = bioWorld;
@@ -21069,10 +20152,9 @@ bool UBioAutoConditionals::F1495 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F836 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF836 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF836Ref { L"Function PlotManager.BioAutoConditionals.F836", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF836 )
-		pFnF836 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F836" );
+	UFunction* const pFnF836 = pFnF836Ref.Get ( );
 
 	UBioAutoConditionals_execF836_Parms F836_Parms;
 	F836_Parms.bioWorld = bioWorld;
@@ -21092,10 +20174,9 @@ bool UBioAutoConditionals::F836 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F794 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF794 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF794Ref { L"Function PlotManager.BioAutoConditionals.F794", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF794 )
-		pFnF794 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F794" );
+	UFunction* const pFnF794 = pFnF794Ref.Get ( );
 
 	UBioAutoConditionals_execF794_Parms F794_Parms;
 	F794_Parms.bioWorld = bioWorld;
@@ -21115,10 +20196,9 @@ bool UBioAutoConditionals::F794 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F898 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF898 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF898Ref { L"Function PlotManager.BioAutoConditionals.F898", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF898 )
-		pFnF898 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F898" );
+	UFunction* const pFnF898 = pFnF898Ref.Get ( );
 
 	UBioAutoConditionals_execF898_Parms F898_Parms;
 	F898_Parms.bioWorld = bioWorld;
@@ -21138,10 +20218,9 @@ bool UBioAutoConditionals::F898 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F755 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF755 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF755Ref { L"Function PlotManager.BioAutoConditionals.F755", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF755 )
-		pFnF755 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F755" );
+	UFunction* const pFnF755 = pFnF755Ref.Get ( );
 
 	UBioAutoConditionals_execF755_Parms F755_Parms;
 	F755_Parms.bioWorld = bioWorld;
@@ -21161,10 +20240,9 @@ bool UBioAutoConditionals::F755 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F699 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF699 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF699Ref { L"Function PlotManager.BioAutoConditionals.F699", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF699 )
-		pFnF699 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F699" );
+	UFunction* const pFnF699 = pFnF699Ref.Get ( );
 
 	UBioAutoConditionals_execF699_Parms F699_Parms;
 	F699_Parms.bioWorld = bioWorld;
@@ -21184,10 +20262,9 @@ bool UBioAutoConditionals::F699 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F675 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF675 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF675Ref { L"Function PlotManager.BioAutoConditionals.F675", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF675 )
-		pFnF675 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F675" );
+	UFunction* const pFnF675 = pFnF675Ref.Get ( );
 
 	UBioAutoConditionals_execF675_Parms F675_Parms;
 	F675_Parms.bioWorld = bioWorld;
@@ -21207,10 +20284,9 @@ bool UBioAutoConditionals::F675 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F638 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF638 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF638Ref { L"Function PlotManager.BioAutoConditionals.F638", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF638 )
-		pFnF638 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F638" );
+	UFunction* const pFnF638 = pFnF638Ref.Get ( );
 
 	UBioAutoConditionals_execF638_Parms F638_Parms;
 	F638_Parms.bioWorld = bioWorld;
@@ -21230,10 +20306,9 @@ bool UBioAutoConditionals::F638 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F637 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF637 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF637Ref { L"Function PlotManager.BioAutoConditionals.F637", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF637 )
-		pFnF637 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F637" );
+	UFunction* const pFnF637 = pFnF637Ref.Get ( );
 
 	UBioAutoConditionals_execF637_Parms F637_Parms;
 	F637_Parms.bioWorld = bioWorld;
@@ -21253,10 +20328,9 @@ bool UBioAutoConditionals::F637 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F244 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF244 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF244Ref { L"Function PlotManager.BioAutoConditionals.F244", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF244 )
-		pFnF244 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F244" );
+	UFunction* const pFnF244 = pFnF244Ref.Get ( );
 
 	UBioAutoConditionals_execF244_Parms F244_Parms;
 	F244_Parms.bioWorld = bioWorld;
@@ -21276,10 +20350,9 @@ bool UBioAutoConditionals::F244 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1853 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1853 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1853Ref { L"Function PlotManager.BioAutoConditionals.F1853", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1853 )
-		pFnF1853 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1853" );
+	UFunction* const pFnF1853 = pFnF1853Ref.Get ( );
 
 	UBioAutoConditionals_execF1853_Parms F1853_Parms;
 	F1853_Parms.bioWorld = bioWorld;
@@ -21299,10 +20372,9 @@ bool UBioAutoConditionals::F1853 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1530 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1530 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1530Ref { L"Function PlotManager.BioAutoConditionals.F1530", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1530 )
-		pFnF1530 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1530" );
+	UFunction* const pFnF1530 = pFnF1530Ref.Get ( );
 
 	UBioAutoConditionals_execF1530_Parms F1530_Parms;
 	F1530_Parms.bioWorld = bioWorld;
@@ -21322,10 +20394,9 @@ bool UBioAutoConditionals::F1530 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1157 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1157 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1157Ref { L"Function PlotManager.BioAutoConditionals.F1157", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1157 )
-		pFnF1157 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1157" );
+	UFunction* const pFnF1157 = pFnF1157Ref.Get ( );
 
 	UBioAutoConditionals_execF1157_Parms F1157_Parms;
 	F1157_Parms.bioWorld = bioWorld;
@@ -21345,10 +20416,9 @@ bool UBioAutoConditionals::F1157 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F856 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF856 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF856Ref { L"Function PlotManager.BioAutoConditionals.F856", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF856 )
-		pFnF856 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F856" );
+	UFunction* const pFnF856 = pFnF856Ref.Get ( );
 
 	UBioAutoConditionals_execF856_Parms F856_Parms;
 	F856_Parms.bioWorld = bioWorld;
@@ -21368,10 +20438,9 @@ bool UBioAutoConditionals::F856 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F138 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF138 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF138Ref { L"Function PlotManager.BioAutoConditionals.F138", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF138 )
-		pFnF138 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F138" );
+	UFunction* const pFnF138 = pFnF138Ref.Get ( );
 
 	UBioAutoConditionals_execF138_Parms F138_Parms;
 	F138_Parms.bioWorld = bioWorld;
@@ -21391,10 +20460,9 @@ bool UBioAutoConditionals::F138 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F115 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF115 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF115Ref { L"Function PlotManager.BioAutoConditionals.F115", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF115 )
-		pFnF115 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F115" );
+	UFunction* const pFnF115 = pFnF115Ref.Get ( );
 
 	UBioAutoConditionals_execF115_Parms F115_Parms;
 	F115_Parms.bioWorld = bioWorld;
@@ -21414,10 +20482,9 @@ bool UBioAutoConditionals::F115 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F113 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF113 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF113Ref { L"Function PlotManager.BioAutoConditionals.F113", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF113 )
-		pFnF113 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F113" );
+	UFunction* const pFnF113 = pFnF113Ref.Get ( );
 
 	UBioAutoConditionals_execF113_Parms F113_Parms;
 	F113_Parms.bioWorld = bioWorld;
@@ -21437,10 +20504,9 @@ bool UBioAutoConditionals::F113 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F834 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF834 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF834Ref { L"Function PlotManager.BioAutoConditionals.F834", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF834 )
-		pFnF834 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F834" );
+	UFunction* const pFnF834 = pFnF834Ref.Get ( );
 
 	UBioAutoConditionals_execF834_Parms F834_Parms;
 	F834_Parms.bioWorld = bioWorld;
@@ -21460,10 +20526,9 @@ bool UBioAutoConditionals::F834 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F809 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF809 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF809Ref { L"Function PlotManager.BioAutoConditionals.F809", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF809 )
-		pFnF809 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F809" );
+	UFunction* const pFnF809 = pFnF809Ref.Get ( );
 
 	UBioAutoConditionals_execF809_Parms F809_Parms;
 	F809_Parms.bioWorld = bioWorld;
@@ -21483,10 +20548,9 @@ bool UBioAutoConditionals::F809 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F561 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF561 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF561Ref { L"Function PlotManager.BioAutoConditionals.F561", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF561 )
-		pFnF561 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F561" );
+	UFunction* const pFnF561 = pFnF561Ref.Get ( );
 
 	UBioAutoConditionals_execF561_Parms F561_Parms;
 	F561_Parms.bioWorld = bioWorld;
@@ -21506,10 +20570,9 @@ bool UBioAutoConditionals::F561 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1032 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1032 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1032Ref { L"Function PlotManager.BioAutoConditionals.F1032", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1032 )
-		pFnF1032 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1032" );
+	UFunction* const pFnF1032 = pFnF1032Ref.Get ( );
 
 	UBioAutoConditionals_execF1032_Parms F1032_Parms;
 	F1032_Parms.bioWorld = bioWorld;
@@ -21529,10 +20592,9 @@ bool UBioAutoConditionals::F1032 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1019 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1019 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1019Ref { L"Function PlotManager.BioAutoConditionals.F1019", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1019 )
-		pFnF1019 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1019" );
+	UFunction* const pFnF1019 = pFnF1019Ref.Get ( );
 
 	UBioAutoConditionals_execF1019_Parms F1019_Parms;
 	F1019_Parms.bioWorld = bioWorld;
@@ -21552,10 +20614,9 @@ bool UBioAutoConditionals::F1019 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1018 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1018 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1018Ref { L"Function PlotManager.BioAutoConditionals.F1018", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1018 )
-		pFnF1018 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1018" );
+	UFunction* const pFnF1018 = pFnF1018Ref.Get ( );
 
 	UBioAutoConditionals_execF1018_Parms F1018_Parms;
 	F1018_Parms.bioWorld = bioWorld;
@@ -21575,10 +20636,9 @@ bool UBioAutoConditionals::F1018 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F886 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF886 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF886Ref { L"Function PlotManager.BioAutoConditionals.F886", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF886 )
-		pFnF886 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F886" );
+	UFunction* const pFnF886 = pFnF886Ref.Get ( );
 
 	UBioAutoConditionals_execF886_Parms F886_Parms;
 	F886_Parms.bioWorld = bioWorld;
@@ -21598,10 +20658,9 @@ bool UBioAutoConditionals::F886 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F770 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF770 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF770Ref { L"Function PlotManager.BioAutoConditionals.F770", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF770 )
-		pFnF770 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F770" );
+	UFunction* const pFnF770 = pFnF770Ref.Get ( );
 
 	UBioAutoConditionals_execF770_Parms F770_Parms;
 	F770_Parms.bioWorld = bioWorld;
@@ -21621,10 +20680,9 @@ bool UBioAutoConditionals::F770 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F482 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF482 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF482Ref { L"Function PlotManager.BioAutoConditionals.F482", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF482 )
-		pFnF482 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F482" );
+	UFunction* const pFnF482 = pFnF482Ref.Get ( );
 
 	UBioAutoConditionals_execF482_Parms F482_Parms;
 	F482_Parms.bioWorld = bioWorld;
@@ -21644,10 +20702,9 @@ bool UBioAutoConditionals::F482 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F419 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF419 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF419Ref { L"Function PlotManager.BioAutoConditionals.F419", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF419 )
-		pFnF419 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F419" );
+	UFunction* const pFnF419 = pFnF419Ref.Get ( );
 
 	UBioAutoConditionals_execF419_Parms F419_Parms;
 	F419_Parms.bioWorld = bioWorld;
@@ -21667,10 +20724,9 @@ bool UBioAutoConditionals::F419 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1852 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1852 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1852Ref { L"Function PlotManager.BioAutoConditionals.F1852", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1852 )
-		pFnF1852 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1852" );
+	UFunction* const pFnF1852 = pFnF1852Ref.Get ( );
 
 	UBioAutoConditionals_execF1852_Parms F1852_Parms;
 	F1852_Parms.bioWorld = bioWorld;
@@ -21690,10 +20746,9 @@ bool UBioAutoConditionals::F1852 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1851 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1851 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1851Ref { L"Function PlotManager.BioAutoConditionals.F1851", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1851 )
-		pFnF1851 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1851" );
+	UFunction* const pFnF1851 = pFnF1851Ref.Get ( );
 
 	UBioAutoConditionals_execF1851_Parms F1851_Parms;
 	F1851_Parms.bioWorld = bioWorld;
@@ -21713,10 +20768,9 @@ bool UBioAutoConditionals::F1851 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1850 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1850 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1850Ref { L"Function PlotManager.BioAutoConditionals.F1850", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1850 )
-		pFnF1850 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1850" );
+	UFunction* const pFnF1850 = pFnF1850Ref.Get ( );
 
 	UBioAutoConditionals_execF1850_Parms F1850_Parms;
 	F1850_Parms.bioWorld = bioWorld;
@@ -21736,10 +20790,9 @@ bool UBioAutoConditionals::F1850 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1849 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1849 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1849Ref { L"Function PlotManager.BioAutoConditionals.F1849", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1849 )
-		pFnF1849 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1849" );
+	UFunction* const pFnF1849 = pFnF1849Ref.Get ( );
 
 	UBioAutoConditionals_execF1849_Parms F1849_Parms;
 	F1849_Parms.bioWorld = bioWorld;
@@ -21759,10 +20812,9 @@ bool UBioAutoConditionals::F1849 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1844 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1844 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1844Ref { L"Function PlotManager.BioAutoConditionals.F1844", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1844 )
-		pFnF1844 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1844" );
+	UFunction* const pFnF1844 = pFnF1844Ref.Get ( );
 
 	UBioAutoConditionals_execF1844_Parms F1844_Parms;
 	F1844_Parms.bioWorld = bioWorld;
@@ -21782,10 +20834,9 @@ bool UBioAutoConditionals::F1844 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1843 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1843 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1843Ref { L"Function PlotManager.BioAutoConditionals.F1843", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1843 )
-		pFnF1843 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1843" );
+	UFunction* const pFnF1843 = pFnF1843Ref.Get ( );
 
 	UBioAutoConditionals_execF1843_Parms F1843_Parms;
 	F1843_Parms.bioWorld = bioWorld;
@@ -21805,10 +20856,9 @@ bool UBioAutoConditionals::F1843 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1842 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1842 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1842Ref { L"Function PlotManager.BioAutoConditionals.F1842", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1842 )
-		pFnF1842 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1842" );
+	UFunction* const pFnF1842 = pFnF1842Ref.Get ( );
 
 	UBioAutoConditionals_execF1842_Parms F1842_Parms;
 	F1842_Parms.bioWorld = bioWorld;
@@ -21828,10 +20878,9 @@ bool UBioAutoConditionals::F1842 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1841 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1841 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1841Ref { L"Function PlotManager.BioAutoConditionals.F1841", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1841 )
-		pFnF1841 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1841" );
+	UFunction* const pFnF1841 = pFnF1841Ref.Get ( );
 
 	UBioAutoConditionals_execF1841_Parms F1841_Parms;
 	F1841_Parms.bioWorld = bioWorld;
@@ -21851,10 +20900,9 @@ bool UBioAutoConditionals::F1841 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1840 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1840 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1840Ref { L"Function PlotManager.BioAutoConditionals.F1840", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1840 )
-		pFnF1840 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1840" );
+	UFunction* const pFnF1840 = pFnF1840Ref.Get ( );
 
 	UBioAutoConditionals_execF1840_Parms F1840_Parms;
 	F1840_Parms.bioWorld = bioWorld;
@@ -21874,10 +20922,9 @@ bool UBioAutoConditionals::F1840 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1838 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1838 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1838Ref { L"Function PlotManager.BioAutoConditionals.F1838", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1838 )
-		pFnF1838 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1838" );
+	UFunction* const pFnF1838 = pFnF1838Ref.Get ( );
 
 	UBioAutoConditionals_execF1838_Parms F1838_Parms;
 	F1838_Parms.bioWorld = bioWorld;
@@ -21897,10 +20944,9 @@ bool UBioAutoConditionals::F1838 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1837 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1837 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1837Ref { L"Function PlotManager.BioAutoConditionals.F1837", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1837 )
-		pFnF1837 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1837" );
+	UFunction* const pFnF1837 = pFnF1837Ref.Get ( );
 
 	UBioAutoConditionals_execF1837_Parms F1837_Parms;
 	F1837_Parms.bioWorld = bioWorld;
@@ -21920,10 +20966,9 @@ bool UBioAutoConditionals::F1837 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1836 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1836 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1836Ref { L"Function PlotManager.BioAutoConditionals.F1836", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1836 )
-		pFnF1836 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1836" );
+	UFunction* const pFnF1836 = pFnF1836Ref.Get ( );
 
 	UBioAutoConditionals_execF1836_Parms F1836_Parms;
 	F1836_Parms.bioWorld = bioWorld;
@@ -21943,10 +20988,9 @@ bool UBioAutoConditionals::F1836 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1835 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1835 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1835Ref { L"Function PlotManager.BioAutoConditionals.F1835", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1835 )
-		pFnF1835 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1835" );
+	UFunction* const pFnF1835 = pFnF1835Ref.Get ( );
 
 	UBioAutoConditionals_execF1835_Parms F1835_Parms;
 	F1835_Parms.bioWorld = bioWorld;
@@ -21966,10 +21010,9 @@ bool UBioAutoConditionals::F1835 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1642 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1642 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1642Ref { L"Function PlotManager.BioAutoConditionals.F1642", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1642 )
-		pFnF1642 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1642" );
+	UFunction* const pFnF1642 = pFnF1642Ref.Get ( );
 
 	UBioAutoConditionals_execF1642_Parms F1642_Parms;
 	F1642_Parms.bioWorld = bioWorld;
@@ -21989,10 +21032,9 @@ bool UBioAutoConditionals::F1642 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1641 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1641 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1641Ref { L"Function PlotManager.BioAutoConditionals.F1641", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1641 )
-		pFnF1641 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1641" );
+	UFunction* const pFnF1641 = pFnF1641Ref.Get ( );
 
 	UBioAutoConditionals_execF1641_Parms F1641_Parms;
 	F1641_Parms.bioWorld = bioWorld;
@@ -22012,10 +21054,9 @@ bool UBioAutoConditionals::F1641 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1640 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1640 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1640Ref { L"Function PlotManager.BioAutoConditionals.F1640", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1640 )
-		pFnF1640 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1640" );
+	UFunction* const pFnF1640 = pFnF1640Ref.Get ( );
 
 	UBioAutoConditionals_execF1640_Parms F1640_Parms;
 	F1640_Parms.bioWorld = bioWorld;
@@ -22035,10 +21076,9 @@ bool UBioAutoConditionals::F1640 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1760 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1760 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1760Ref { L"Function PlotManager.BioAutoConditionals.F1760", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1760 )
-		pFnF1760 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1760" );
+	UFunction* const pFnF1760 = pFnF1760Ref.Get ( );
 
 	UBioAutoConditionals_execF1760_Parms F1760_Parms;
 	F1760_Parms.bioWorld = bioWorld;
@@ -22058,10 +21098,9 @@ bool UBioAutoConditionals::F1760 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1757 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1757 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1757Ref { L"Function PlotManager.BioAutoConditionals.F1757", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1757 )
-		pFnF1757 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1757" );
+	UFunction* const pFnF1757 = pFnF1757Ref.Get ( );
 
 	UBioAutoConditionals_execF1757_Parms F1757_Parms;
 	F1757_Parms.bioWorld = bioWorld;
@@ -22081,10 +21120,9 @@ bool UBioAutoConditionals::F1757 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1752 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1752 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1752Ref { L"Function PlotManager.BioAutoConditionals.F1752", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1752 )
-		pFnF1752 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1752" );
+	UFunction* const pFnF1752 = pFnF1752Ref.Get ( );
 
 	UBioAutoConditionals_execF1752_Parms F1752_Parms;
 	F1752_Parms.bioWorld = bioWorld;
@@ -22104,10 +21142,9 @@ bool UBioAutoConditionals::F1752 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1113 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1113 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1113Ref { L"Function PlotManager.BioAutoConditionals.F1113", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1113 )
-		pFnF1113 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1113" );
+	UFunction* const pFnF1113 = pFnF1113Ref.Get ( );
 
 	UBioAutoConditionals_execF1113_Parms F1113_Parms;
 	F1113_Parms.bioWorld = bioWorld;
@@ -22127,10 +21164,9 @@ bool UBioAutoConditionals::F1113 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1112 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1112 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1112Ref { L"Function PlotManager.BioAutoConditionals.F1112", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1112 )
-		pFnF1112 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1112" );
+	UFunction* const pFnF1112 = pFnF1112Ref.Get ( );
 
 	UBioAutoConditionals_execF1112_Parms F1112_Parms;
 	F1112_Parms.bioWorld = bioWorld;
@@ -22150,10 +21186,9 @@ bool UBioAutoConditionals::F1112 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F779 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF779 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF779Ref { L"Function PlotManager.BioAutoConditionals.F779", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF779 )
-		pFnF779 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F779" );
+	UFunction* const pFnF779 = pFnF779Ref.Get ( );
 
 	UBioAutoConditionals_execF779_Parms F779_Parms;
 	F779_Parms.bioWorld = bioWorld;
@@ -22173,10 +21208,9 @@ bool UBioAutoConditionals::F779 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F739 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF739 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF739Ref { L"Function PlotManager.BioAutoConditionals.F739", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF739 )
-		pFnF739 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F739" );
+	UFunction* const pFnF739 = pFnF739Ref.Get ( );
 
 	UBioAutoConditionals_execF739_Parms F739_Parms;
 	F739_Parms.bioWorld = bioWorld;
@@ -22196,10 +21230,9 @@ bool UBioAutoConditionals::F739 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F738 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF738 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF738Ref { L"Function PlotManager.BioAutoConditionals.F738", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF738 )
-		pFnF738 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F738" );
+	UFunction* const pFnF738 = pFnF738Ref.Get ( );
 
 	UBioAutoConditionals_execF738_Parms F738_Parms;
 	F738_Parms.bioWorld = bioWorld;
@@ -22219,10 +21252,9 @@ bool UBioAutoConditionals::F738 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F693 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF693 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF693Ref { L"Function PlotManager.BioAutoConditionals.F693", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF693 )
-		pFnF693 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F693" );
+	UFunction* const pFnF693 = pFnF693Ref.Get ( );
 
 	UBioAutoConditionals_execF693_Parms F693_Parms;
 	F693_Parms.bioWorld = bioWorld;
@@ -22242,10 +21274,9 @@ bool UBioAutoConditionals::F693 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F691 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF691 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF691Ref { L"Function PlotManager.BioAutoConditionals.F691", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF691 )
-		pFnF691 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F691" );
+	UFunction* const pFnF691 = pFnF691Ref.Get ( );
 
 	UBioAutoConditionals_execF691_Parms F691_Parms;
 	F691_Parms.bioWorld = bioWorld;
@@ -22265,10 +21296,9 @@ bool UBioAutoConditionals::F691 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F582 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF582 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF582Ref { L"Function PlotManager.BioAutoConditionals.F582", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF582 )
-		pFnF582 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F582" );
+	UFunction* const pFnF582 = pFnF582Ref.Get ( );
 
 	UBioAutoConditionals_execF582_Parms F582_Parms;
 	F582_Parms.bioWorld = bioWorld;
@@ -22288,10 +21318,9 @@ bool UBioAutoConditionals::F582 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F581 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF581 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF581Ref { L"Function PlotManager.BioAutoConditionals.F581", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF581 )
-		pFnF581 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F581" );
+	UFunction* const pFnF581 = pFnF581Ref.Get ( );
 
 	UBioAutoConditionals_execF581_Parms F581_Parms;
 	F581_Parms.bioWorld = bioWorld;
@@ -22311,10 +21340,9 @@ bool UBioAutoConditionals::F581 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F580 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF580 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF580Ref { L"Function PlotManager.BioAutoConditionals.F580", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF580 )
-		pFnF580 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F580" );
+	UFunction* const pFnF580 = pFnF580Ref.Get ( );
 
 	UBioAutoConditionals_execF580_Parms F580_Parms;
 	F580_Parms.bioWorld = bioWorld;
@@ -22334,10 +21362,9 @@ bool UBioAutoConditionals::F580 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F579 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF579 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF579Ref { L"Function PlotManager.BioAutoConditionals.F579", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF579 )
-		pFnF579 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F579" );
+	UFunction* const pFnF579 = pFnF579Ref.Get ( );
 
 	UBioAutoConditionals_execF579_Parms F579_Parms;
 	F579_Parms.bioWorld = bioWorld;
@@ -22357,10 +21384,9 @@ bool UBioAutoConditionals::F579 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F578 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF578 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF578Ref { L"Function PlotManager.BioAutoConditionals.F578", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF578 )
-		pFnF578 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F578" );
+	UFunction* const pFnF578 = pFnF578Ref.Get ( );
 
 	UBioAutoConditionals_execF578_Parms F578_Parms;
 	F578_Parms.bioWorld = bioWorld;
@@ -22380,10 +21406,9 @@ bool UBioAutoConditionals::F578 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F577 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF577 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF577Ref { L"Function PlotManager.BioAutoConditionals.F577", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF577 )
-		pFnF577 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F577" );
+	UFunction* const pFnF577 = pFnF577Ref.Get ( );
 
 	UBioAutoConditionals_execF577_Parms F577_Parms;
 	F577_Parms.bioWorld = bioWorld;
@@ -22403,10 +21428,9 @@ bool UBioAutoConditionals::F577 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F576 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF576 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF576Ref { L"Function PlotManager.BioAutoConditionals.F576", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF576 )
-		pFnF576 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F576" );
+	UFunction* const pFnF576 = pFnF576Ref.Get ( );
 
 	UBioAutoConditionals_execF576_Parms F576_Parms;
 	F576_Parms.bioWorld = bioWorld;
@@ -22426,10 +21450,9 @@ bool UBioAutoConditionals::F576 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F573 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF573 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF573Ref { L"Function PlotManager.BioAutoConditionals.F573", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF573 )
-		pFnF573 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F573" );
+	UFunction* const pFnF573 = pFnF573Ref.Get ( );
 
 	UBioAutoConditionals_execF573_Parms F573_Parms;
 	F573_Parms.bioWorld = bioWorld;
@@ -22449,10 +21472,9 @@ bool UBioAutoConditionals::F573 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F342 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF342 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF342Ref { L"Function PlotManager.BioAutoConditionals.F342", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF342 )
-		pFnF342 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F342" );
+	UFunction* const pFnF342 = pFnF342Ref.Get ( );
 
 	UBioAutoConditionals_execF342_Parms F342_Parms;
 	F342_Parms.bioWorld = bioWorld;
@@ -22472,10 +21494,9 @@ bool UBioAutoConditionals::F342 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F338 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF338 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF338Ref { L"Function PlotManager.BioAutoConditionals.F338", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF338 )
-		pFnF338 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F338" );
+	UFunction* const pFnF338 = pFnF338Ref.Get ( );
 
 	UBioAutoConditionals_execF338_Parms F338_Parms;
 	F338_Parms.bioWorld = bioWorld;
@@ -22495,10 +21516,9 @@ bool UBioAutoConditionals::F338 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F337 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF337 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF337Ref { L"Function PlotManager.BioAutoConditionals.F337", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF337 )
-		pFnF337 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F337" );
+	UFunction* const pFnF337 = pFnF337Ref.Get ( );
 
 	UBioAutoConditionals_execF337_Parms F337_Parms;
 	F337_Parms.bioWorld = bioWorld;
@@ -22518,10 +21538,9 @@ bool UBioAutoConditionals::F337 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F332 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF332 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF332Ref { L"Function PlotManager.BioAutoConditionals.F332", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF332 )
-		pFnF332 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F332" );
+	UFunction* const pFnF332 = pFnF332Ref.Get ( );
 
 	UBioAutoConditionals_execF332_Parms F332_Parms;
 	F332_Parms.bioWorld = bioWorld;
@@ -22541,10 +21560,9 @@ bool UBioAutoConditionals::F332 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F318 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF318 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF318Ref { L"Function PlotManager.BioAutoConditionals.F318", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF318 )
-		pFnF318 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F318" );
+	UFunction* const pFnF318 = pFnF318Ref.Get ( );
 
 	UBioAutoConditionals_execF318_Parms F318_Parms;
 	F318_Parms.bioWorld = bioWorld;
@@ -22564,10 +21582,9 @@ bool UBioAutoConditionals::F318 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F317 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF317 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF317Ref { L"Function PlotManager.BioAutoConditionals.F317", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF317 )
-		pFnF317 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F317" );
+	UFunction* const pFnF317 = pFnF317Ref.Get ( );
 
 	UBioAutoConditionals_execF317_Parms F317_Parms;
 	F317_Parms.bioWorld = bioWorld;
@@ -22587,10 +21604,9 @@ bool UBioAutoConditionals::F317 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F316 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF316 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF316Ref { L"Function PlotManager.BioAutoConditionals.F316", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF316 )
-		pFnF316 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F316" );
+	UFunction* const pFnF316 = pFnF316Ref.Get ( );
 
 	UBioAutoConditionals_execF316_Parms F316_Parms;
 	F316_Parms.bioWorld = bioWorld;
@@ -22610,10 +21626,9 @@ bool UBioAutoConditionals::F316 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F315 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF315 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF315Ref { L"Function PlotManager.BioAutoConditionals.F315", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF315 )
-		pFnF315 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F315" );
+	UFunction* const pFnF315 = pFnF315Ref.Get ( );
 
 	UBioAutoConditionals_execF315_Parms F315_Parms;
 	F315_Parms.bioWorld = bioWorld;
@@ -22633,10 +21648,9 @@ bool UBioAutoConditionals::F315 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F314 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF314 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF314Ref { L"Function PlotManager.BioAutoConditionals.F314", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF314 )
-		pFnF314 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F314" );
+	UFunction* const pFnF314 = pFnF314Ref.Get ( );
 
 	UBioAutoConditionals_execF314_Parms F314_Parms;
 	F314_Parms.bioWorld = bioWorld;
@@ -22656,10 +21670,9 @@ bool UBioAutoConditionals::F314 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F309 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF309 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF309Ref { L"Function PlotManager.BioAutoConditionals.F309", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF309 )
-		pFnF309 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F309" );
+	UFunction* const pFnF309 = pFnF309Ref.Get ( );
 
 	UBioAutoConditionals_execF309_Parms F309_Parms;
 	F309_Parms.bioWorld = bioWorld;
@@ -22679,10 +21692,9 @@ bool UBioAutoConditionals::F309 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F308 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF308 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF308Ref { L"Function PlotManager.BioAutoConditionals.F308", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF308 )
-		pFnF308 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F308" );
+	UFunction* const pFnF308 = pFnF308Ref.Get ( );
 
 	UBioAutoConditionals_execF308_Parms F308_Parms;
 	F308_Parms.bioWorld = bioWorld;
@@ -22702,10 +21714,9 @@ bool UBioAutoConditionals::F308 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F307 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF307 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF307Ref { L"Function PlotManager.BioAutoConditionals.F307", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF307 )
-		pFnF307 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F307" );
+	UFunction* const pFnF307 = pFnF307Ref.Get ( );
 
 	UBioAutoConditionals_execF307_Parms F307_Parms;
 	F307_Parms.bioWorld = bioWorld;
@@ -22725,10 +21736,9 @@ bool UBioAutoConditionals::F307 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F306 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF306 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF306Ref { L"Function PlotManager.BioAutoConditionals.F306", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF306 )
-		pFnF306 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F306" );
+	UFunction* const pFnF306 = pFnF306Ref.Get ( );
 
 	UBioAutoConditionals_execF306_Parms F306_Parms;
 	F306_Parms.bioWorld = bioWorld;
@@ -22748,10 +21758,9 @@ bool UBioAutoConditionals::F306 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F305 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF305 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF305Ref { L"Function PlotManager.BioAutoConditionals.F305", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF305 )
-		pFnF305 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F305" );
+	UFunction* const pFnF305 = pFnF305Ref.Get ( );
 
 	UBioAutoConditionals_execF305_Parms F305_Parms;
 	F305_Parms.bioWorld = bioWorld;
@@ -22771,10 +21780,9 @@ bool UBioAutoConditionals::F305 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F304 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF304 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF304Ref { L"Function PlotManager.BioAutoConditionals.F304", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF304 )
-		pFnF304 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F304" );
+	UFunction* const pFnF304 = pFnF304Ref.Get ( );
 
 	UBioAutoConditionals_execF304_Parms F304_Parms;
 	F304_Parms.bioWorld = bioWorld;
@@ -22794,10 +21802,9 @@ bool UBioAutoConditionals::F304 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F303 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF303 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF303Ref { L"Function PlotManager.BioAutoConditionals.F303", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF303 )
-		pFnF303 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F303" );
+	UFunction* const pFnF303 = pFnF303Ref.Get ( );
 
 	UBioAutoConditionals_execF303_Parms F303_Parms;
 	F303_Parms.bioWorld = bioWorld;
@@ -22817,10 +21824,9 @@ bool UBioAutoConditionals::F303 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F302 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF302 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF302Ref { L"Function PlotManager.BioAutoConditionals.F302", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF302 )
-		pFnF302 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F302" );
+	UFunction* const pFnF302 = pFnF302Ref.Get ( );
 
 	UBioAutoConditionals_execF302_Parms F302_Parms;
 	F302_Parms.bioWorld = bioWorld;
@@ -22840,10 +21846,9 @@ bool UBioAutoConditionals::F302 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F301 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF301 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF301Ref { L"Function PlotManager.BioAutoConditionals.F301", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF301 )
-		pFnF301 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F301" );
+	UFunction* const pFnF301 = pFnF301Ref.Get ( );
 
 	UBioAutoConditionals_execF301_Parms F301_Parms;
 	F301_Parms.bioWorld = bioWorld;
@@ -22863,10 +21868,9 @@ bool UBioAutoConditionals::F301 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F312 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF312 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF312Ref { L"Function PlotManager.BioAutoConditionals.F312", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF312 )
-		pFnF312 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F312" );
+	UFunction* const pFnF312 = pFnF312Ref.Get ( );
 
 	UBioAutoConditionals_execF312_Parms F312_Parms;
 	F312_Parms.bioWorld = bioWorld;
@@ -22886,10 +21890,9 @@ bool UBioAutoConditionals::F312 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F298 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF298 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF298Ref { L"Function PlotManager.BioAutoConditionals.F298", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF298 )
-		pFnF298 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F298" );
+	UFunction* const pFnF298 = pFnF298Ref.Get ( );
 
 	UBioAutoConditionals_execF298_Parms F298_Parms;
 	F298_Parms.bioWorld = bioWorld;
@@ -22909,10 +21912,9 @@ bool UBioAutoConditionals::F298 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F136 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF136 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF136Ref { L"Function PlotManager.BioAutoConditionals.F136", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF136 )
-		pFnF136 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F136" );
+	UFunction* const pFnF136 = pFnF136Ref.Get ( );
 
 	UBioAutoConditionals_execF136_Parms F136_Parms;
 	F136_Parms.bioWorld = bioWorld;
@@ -22932,10 +21934,9 @@ bool UBioAutoConditionals::F136 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F135 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF135 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF135Ref { L"Function PlotManager.BioAutoConditionals.F135", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF135 )
-		pFnF135 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F135" );
+	UFunction* const pFnF135 = pFnF135Ref.Get ( );
 
 	UBioAutoConditionals_execF135_Parms F135_Parms;
 	F135_Parms.bioWorld = bioWorld;
@@ -22955,10 +21956,9 @@ bool UBioAutoConditionals::F135 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F139 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF139 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF139Ref { L"Function PlotManager.BioAutoConditionals.F139", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF139 )
-		pFnF139 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F139" );
+	UFunction* const pFnF139 = pFnF139Ref.Get ( );
 
 	UBioAutoConditionals_execF139_Parms F139_Parms;
 	F139_Parms.bioWorld = bioWorld;
@@ -22978,10 +21978,9 @@ bool UBioAutoConditionals::F139 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1549 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1549 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1549Ref { L"Function PlotManager.BioAutoConditionals.F1549", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1549 )
-		pFnF1549 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1549" );
+	UFunction* const pFnF1549 = pFnF1549Ref.Get ( );
 
 	UBioAutoConditionals_execF1549_Parms F1549_Parms;
 	F1549_Parms.bioWorld = bioWorld;
@@ -23001,10 +22000,9 @@ bool UBioAutoConditionals::F1549 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1548 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1548 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1548Ref { L"Function PlotManager.BioAutoConditionals.F1548", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1548 )
-		pFnF1548 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1548" );
+	UFunction* const pFnF1548 = pFnF1548Ref.Get ( );
 
 	UBioAutoConditionals_execF1548_Parms F1548_Parms;
 	F1548_Parms.bioWorld = bioWorld;
@@ -23024,10 +22022,9 @@ bool UBioAutoConditionals::F1548 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F704 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF704 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF704Ref { L"Function PlotManager.BioAutoConditionals.F704", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF704 )
-		pFnF704 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F704" );
+	UFunction* const pFnF704 = pFnF704Ref.Get ( );
 
 	UBioAutoConditionals_execF704_Parms F704_Parms;
 	F704_Parms.bioWorld = bioWorld;
@@ -23047,10 +22044,9 @@ bool UBioAutoConditionals::F704 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F948 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF948 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF948Ref { L"Function PlotManager.BioAutoConditionals.F948", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF948 )
-		pFnF948 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F948" );
+	UFunction* const pFnF948 = pFnF948Ref.Get ( );
 
 	UBioAutoConditionals_execF948_Parms F948_Parms;
 	F948_Parms.bioWorld = bioWorld;
@@ -23070,10 +22066,9 @@ bool UBioAutoConditionals::F948 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1332 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1332 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1332Ref { L"Function PlotManager.BioAutoConditionals.F1332", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1332 )
-		pFnF1332 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1332" );
+	UFunction* const pFnF1332 = pFnF1332Ref.Get ( );
 
 	UBioAutoConditionals_execF1332_Parms F1332_Parms;
 	F1332_Parms.bioWorld = bioWorld;
@@ -23093,10 +22088,9 @@ bool UBioAutoConditionals::F1332 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1331 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1331 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1331Ref { L"Function PlotManager.BioAutoConditionals.F1331", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1331 )
-		pFnF1331 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1331" );
+	UFunction* const pFnF1331 = pFnF1331Ref.Get ( );
 
 	UBioAutoConditionals_execF1331_Parms F1331_Parms;
 	F1331_Parms.bioWorld = bioWorld;
@@ -23116,10 +22110,9 @@ bool UBioAutoConditionals::F1331 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1330 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1330 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1330Ref { L"Function PlotManager.BioAutoConditionals.F1330", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1330 )
-		pFnF1330 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1330" );
+	UFunction* const pFnF1330 = pFnF1330Ref.Get ( );
 
 	UBioAutoConditionals_execF1330_Parms F1330_Parms;
 	F1330_Parms.bioWorld = bioWorld;
@@ -23139,10 +22132,9 @@ bool UBioAutoConditionals::F1330 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1329 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1329 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1329Ref { L"Function PlotManager.BioAutoConditionals.F1329", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1329 )
-		pFnF1329 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1329" );
+	UFunction* const pFnF1329 = pFnF1329Ref.Get ( );
 
 	UBioAutoConditionals_execF1329_Parms F1329_Parms;
 	F1329_Parms.bioWorld = bioWorld;
@@ -23162,10 +22154,9 @@ bool UBioAutoConditionals::F1329 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1328 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1328 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1328Ref { L"Function PlotManager.BioAutoConditionals.F1328", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1328 )
-		pFnF1328 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1328" );
+	UFunction* const pFnF1328 = pFnF1328Ref.Get ( );
 
 	UBioAutoConditionals_execF1328_Parms F1328_Parms;
 	F1328_Parms.bioWorld = bioWorld;
@@ -23185,10 +22176,9 @@ bool UBioAutoConditionals::F1328 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1327 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1327 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1327Ref { L"Function PlotManager.BioAutoConditionals.F1327", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1327 )
-		pFnF1327 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1327" );
+	UFunction* const pFnF1327 = pFnF1327Ref.Get ( );
 
 	UBioAutoConditionals_execF1327_Parms F1327_Parms;
 	F1327_Parms.bioWorld = bioWorld;
@@ -23208,10 +22198,9 @@ bool UBioAutoConditionals::F1327 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1326 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1326 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1326Ref { L"Function PlotManager.BioAutoConditionals.F1326", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1326 )
-		pFnF1326 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1326" );
+	UFunction* const pFnF1326 = pFnF1326Ref.Get ( );
 
 	UBioAutoConditionals_execF1326_Parms F1326_Parms;
 	F1326_Parms.bioWorld = bioWorld;
@@ -23231,10 +22220,9 @@ bool UBioAutoConditionals::F1326 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1325 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1325 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1325Ref { L"Function PlotManager.BioAutoConditionals.F1325", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1325 )
-		pFnF1325 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1325" );
+	UFunction* const pFnF1325 = pFnF1325Ref.Get ( );
 
 	UBioAutoConditionals_execF1325_Parms F1325_Parms;
 	F1325_Parms.bioWorld = bioWorld;
@@ -23254,10 +22242,9 @@ bool UBioAutoConditionals::F1325 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1324 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1324 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1324Ref { L"Function PlotManager.BioAutoConditionals.F1324", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1324 )
-		pFnF1324 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1324" );
+	UFunction* const pFnF1324 = pFnF1324Ref.Get ( );
 
 	UBioAutoConditionals_execF1324_Parms F1324_Parms;
 	F1324_Parms.bioWorld = bioWorld;
@@ -23277,10 +22264,9 @@ bool UBioAutoConditionals::F1324 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1169 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1169 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1169Ref { L"Function PlotManager.BioAutoConditionals.F1169", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1169 )
-		pFnF1169 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1169" );
+	UFunction* const pFnF1169 = pFnF1169Ref.Get ( );
 
 	UBioAutoConditionals_execF1169_Parms F1169_Parms;
 	F1169_Parms.bioWorld = bioWorld;
@@ -23300,10 +22286,9 @@ bool UBioAutoConditionals::F1169 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1168 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1168 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1168Ref { L"Function PlotManager.BioAutoConditionals.F1168", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1168 )
-		pFnF1168 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1168" );
+	UFunction* const pFnF1168 = pFnF1168Ref.Get ( );
 
 	UBioAutoConditionals_execF1168_Parms F1168_Parms;
 	F1168_Parms.bioWorld = bioWorld;
@@ -23323,10 +22308,9 @@ bool UBioAutoConditionals::F1168 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1167 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1167 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1167Ref { L"Function PlotManager.BioAutoConditionals.F1167", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1167 )
-		pFnF1167 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1167" );
+	UFunction* const pFnF1167 = pFnF1167Ref.Get ( );
 
 	UBioAutoConditionals_execF1167_Parms F1167_Parms;
 	F1167_Parms.bioWorld = bioWorld;
@@ -23346,10 +22330,9 @@ bool UBioAutoConditionals::F1167 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1166 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1166 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1166Ref { L"Function PlotManager.BioAutoConditionals.F1166", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1166 )
-		pFnF1166 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1166" );
+	UFunction* const pFnF1166 = pFnF1166Ref.Get ( );
 
 	UBioAutoConditionals_execF1166_Parms F1166_Parms;
 	F1166_Parms.bioWorld = bioWorld;
@@ -23369,10 +22352,9 @@ bool UBioAutoConditionals::F1166 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1165 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1165 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1165Ref { L"Function PlotManager.BioAutoConditionals.F1165", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1165 )
-		pFnF1165 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1165" );
+	UFunction* const pFnF1165 = pFnF1165Ref.Get ( );
 
 	UBioAutoConditionals_execF1165_Parms F1165_Parms;
 	F1165_Parms.bioWorld = bioWorld;
@@ -23392,10 +22374,9 @@ bool UBioAutoConditionals::F1165 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1164 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1164 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1164Ref { L"Function PlotManager.BioAutoConditionals.F1164", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1164 )
-		pFnF1164 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1164" );
+	UFunction* const pFnF1164 = pFnF1164Ref.Get ( );
 
 	UBioAutoConditionals_execF1164_Parms F1164_Parms;
 	F1164_Parms.bioWorld = bioWorld;
@@ -23415,10 +22396,9 @@ bool UBioAutoConditionals::F1164 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1163 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1163 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1163Ref { L"Function PlotManager.BioAutoConditionals.F1163", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1163 )
-		pFnF1163 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1163" );
+	UFunction* const pFnF1163 = pFnF1163Ref.Get ( );
 
 	UBioAutoConditionals_execF1163_Parms F1163_Parms;
 	F1163_Parms.bioWorld = bioWorld;
@@ -23438,10 +22418,9 @@ bool UBioAutoConditionals::F1163 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1162 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1162 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1162Ref { L"Function PlotManager.BioAutoConditionals.F1162", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1162 )
-		pFnF1162 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1162" );
+	UFunction* const pFnF1162 = pFnF1162Ref.Get ( );
 
 	UBioAutoConditionals_execF1162_Parms F1162_Parms;
 	F1162_Parms.bioWorld = bioWorld;
@@ -23461,10 +22440,9 @@ bool UBioAutoConditionals::F1162 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1161 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1161 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1161Ref { L"Function PlotManager.BioAutoConditionals.F1161", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1161 )
-		pFnF1161 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1161" );
+	UFunction* const pFnF1161 = pFnF1161Ref.Get ( );
 
 	UBioAutoConditionals_execF1161_Parms F1161_Parms;
 	F1161_Parms.bioWorld = bioWorld;
@@ -23484,10 +22462,9 @@ bool UBioAutoConditionals::F1161 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1160 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1160 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1160Ref { L"Function PlotManager.BioAutoConditionals.F1160", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1160 )
-		pFnF1160 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1160" );
+	UFunction* const pFnF1160 = pFnF1160Ref.Get ( );
 
 	UBioAutoConditionals_execF1160_Parms F1160_Parms;
 	F1160_Parms.bioWorld = bioWorld;
@@ -23507,10 +22484,9 @@ bool UBioAutoConditionals::F1160 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1159 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1159 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1159Ref { L"Function PlotManager.BioAutoConditionals.F1159", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1159 )
-		pFnF1159 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1159" );
+	UFunction* const pFnF1159 = pFnF1159Ref.Get ( );
 
 	UBioAutoConditionals_execF1159_Parms F1159_Parms;
 	F1159_Parms.bioWorld = bioWorld;
@@ -23530,10 +22506,9 @@ bool UBioAutoConditionals::F1159 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1158 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1158 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1158Ref { L"Function PlotManager.BioAutoConditionals.F1158", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1158 )
-		pFnF1158 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1158" );
+	UFunction* const pFnF1158 = pFnF1158Ref.Get ( );
 
 	UBioAutoConditionals_execF1158_Parms F1158_Parms;
 	F1158_Parms.bioWorld = bioWorld;
@@ -23553,10 +22528,9 @@ bool UBioAutoConditionals::F1158 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F670 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF670 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF670Ref { L"Function PlotManager.BioAutoConditionals.F670", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF670 )
-		pFnF670 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F670" );
+	UFunction* const pFnF670 = pFnF670Ref.Get ( );
 
 	UBioAutoConditionals_execF670_Parms F670_Parms;
 	F670_Parms.bioWorld = bioWorld;
@@ -23576,10 +22550,9 @@ bool UBioAutoConditionals::F670 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F669 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF669 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF669Ref { L"Function PlotManager.BioAutoConditionals.F669", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF669 )
-		pFnF669 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F669" );
+	UFunction* const pFnF669 = pFnF669Ref.Get ( );
 
 	UBioAutoConditionals_execF669_Parms F669_Parms;
 	F669_Parms.bioWorld = bioWorld;
@@ -23599,10 +22572,9 @@ bool UBioAutoConditionals::F669 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F651 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF651 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF651Ref { L"Function PlotManager.BioAutoConditionals.F651", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF651 )
-		pFnF651 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F651" );
+	UFunction* const pFnF651 = pFnF651Ref.Get ( );
 
 	UBioAutoConditionals_execF651_Parms F651_Parms;
 	F651_Parms.bioWorld = bioWorld;
@@ -23622,10 +22594,9 @@ bool UBioAutoConditionals::F651 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1668 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1668 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1668Ref { L"Function PlotManager.BioAutoConditionals.F1668", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1668 )
-		pFnF1668 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1668" );
+	UFunction* const pFnF1668 = pFnF1668Ref.Get ( );
 
 	UBioAutoConditionals_execF1668_Parms F1668_Parms;
 	F1668_Parms.bioWorld = bioWorld;
@@ -23645,10 +22616,9 @@ bool UBioAutoConditionals::F1668 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1667 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1667 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1667Ref { L"Function PlotManager.BioAutoConditionals.F1667", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1667 )
-		pFnF1667 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1667" );
+	UFunction* const pFnF1667 = pFnF1667Ref.Get ( );
 
 	UBioAutoConditionals_execF1667_Parms F1667_Parms;
 	F1667_Parms.bioWorld = bioWorld;
@@ -23668,10 +22638,9 @@ bool UBioAutoConditionals::F1667 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1666 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1666 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1666Ref { L"Function PlotManager.BioAutoConditionals.F1666", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1666 )
-		pFnF1666 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1666" );
+	UFunction* const pFnF1666 = pFnF1666Ref.Get ( );
 
 	UBioAutoConditionals_execF1666_Parms F1666_Parms;
 	F1666_Parms.bioWorld = bioWorld;
@@ -23691,10 +22660,9 @@ bool UBioAutoConditionals::F1666 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1665 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1665 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1665Ref { L"Function PlotManager.BioAutoConditionals.F1665", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1665 )
-		pFnF1665 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1665" );
+	UFunction* const pFnF1665 = pFnF1665Ref.Get ( );
 
 	UBioAutoConditionals_execF1665_Parms F1665_Parms;
 	F1665_Parms.bioWorld = bioWorld;
@@ -23714,10 +22682,9 @@ bool UBioAutoConditionals::F1665 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1664 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1664 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1664Ref { L"Function PlotManager.BioAutoConditionals.F1664", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1664 )
-		pFnF1664 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1664" );
+	UFunction* const pFnF1664 = pFnF1664Ref.Get ( );
 
 	UBioAutoConditionals_execF1664_Parms F1664_Parms;
 	F1664_Parms.bioWorld = bioWorld;
@@ -23737,10 +22704,9 @@ bool UBioAutoConditionals::F1664 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1060 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1060 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1060Ref { L"Function PlotManager.BioAutoConditionals.F1060", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1060 )
-		pFnF1060 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1060" );
+	UFunction* const pFnF1060 = pFnF1060Ref.Get ( );
 
 	UBioAutoConditionals_execF1060_Parms F1060_Parms;
 	F1060_Parms.bioWorld = bioWorld;
@@ -23760,10 +22726,9 @@ bool UBioAutoConditionals::F1060 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F698 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF698 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF698Ref { L"Function PlotManager.BioAutoConditionals.F698", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF698 )
-		pFnF698 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F698" );
+	UFunction* const pFnF698 = pFnF698Ref.Get ( );
 
 	UBioAutoConditionals_execF698_Parms F698_Parms;
 	F698_Parms.bioWorld = bioWorld;
@@ -23783,10 +22748,9 @@ bool UBioAutoConditionals::F698 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F697 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF697 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF697Ref { L"Function PlotManager.BioAutoConditionals.F697", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF697 )
-		pFnF697 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F697" );
+	UFunction* const pFnF697 = pFnF697Ref.Get ( );
 
 	UBioAutoConditionals_execF697_Parms F697_Parms;
 	F697_Parms.bioWorld = bioWorld;
@@ -23806,10 +22770,9 @@ bool UBioAutoConditionals::F697 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F696 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF696 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF696Ref { L"Function PlotManager.BioAutoConditionals.F696", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF696 )
-		pFnF696 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F696" );
+	UFunction* const pFnF696 = pFnF696Ref.Get ( );
 
 	UBioAutoConditionals_execF696_Parms F696_Parms;
 	F696_Parms.bioWorld = bioWorld;
@@ -23829,10 +22792,9 @@ bool UBioAutoConditionals::F696 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F695 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF695 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF695Ref { L"Function PlotManager.BioAutoConditionals.F695", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF695 )
-		pFnF695 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F695" );
+	UFunction* const pFnF695 = pFnF695Ref.Get ( );
 
 	UBioAutoConditionals_execF695_Parms F695_Parms;
 	F695_Parms.bioWorld = bioWorld;
@@ -23852,10 +22814,9 @@ bool UBioAutoConditionals::F695 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F694 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF694 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF694Ref { L"Function PlotManager.BioAutoConditionals.F694", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF694 )
-		pFnF694 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F694" );
+	UFunction* const pFnF694 = pFnF694Ref.Get ( );
 
 	UBioAutoConditionals_execF694_Parms F694_Parms;
 	F694_Parms.bioWorld = bioWorld;
@@ -23875,10 +22836,9 @@ bool UBioAutoConditionals::F694 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1527 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1527 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1527Ref { L"Function PlotManager.BioAutoConditionals.F1527", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1527 )
-		pFnF1527 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1527" );
+	UFunction* const pFnF1527 = pFnF1527Ref.Get ( );
 
 	UBioAutoConditionals_execF1527_Parms F1527_Parms;
 	F1527_Parms.bioWorld = bioWorld;
@@ -23898,10 +22858,9 @@ bool UBioAutoConditionals::F1527 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1534 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1534 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1534Ref { L"Function PlotManager.BioAutoConditionals.F1534", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1534 )
-		pFnF1534 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1534" );
+	UFunction* const pFnF1534 = pFnF1534Ref.Get ( );
 
 	UBioAutoConditionals_execF1534_Parms F1534_Parms;
 	F1534_Parms.bioWorld = bioWorld;
@@ -23921,10 +22880,9 @@ bool UBioAutoConditionals::F1534 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1291 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1291 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1291Ref { L"Function PlotManager.BioAutoConditionals.F1291", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1291 )
-		pFnF1291 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1291" );
+	UFunction* const pFnF1291 = pFnF1291Ref.Get ( );
 
 	UBioAutoConditionals_execF1291_Parms F1291_Parms;
 	F1291_Parms.bioWorld = bioWorld;
@@ -23944,10 +22902,9 @@ bool UBioAutoConditionals::F1291 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1290 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1290 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1290Ref { L"Function PlotManager.BioAutoConditionals.F1290", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1290 )
-		pFnF1290 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1290" );
+	UFunction* const pFnF1290 = pFnF1290Ref.Get ( );
 
 	UBioAutoConditionals_execF1290_Parms F1290_Parms;
 	F1290_Parms.bioWorld = bioWorld;
@@ -23967,10 +22924,9 @@ bool UBioAutoConditionals::F1290 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1289 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1289 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1289Ref { L"Function PlotManager.BioAutoConditionals.F1289", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1289 )
-		pFnF1289 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1289" );
+	UFunction* const pFnF1289 = pFnF1289Ref.Get ( );
 
 	UBioAutoConditionals_execF1289_Parms F1289_Parms;
 	F1289_Parms.bioWorld = bioWorld;
@@ -23990,10 +22946,9 @@ bool UBioAutoConditionals::F1289 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F975 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF975 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF975Ref { L"Function PlotManager.BioAutoConditionals.F975", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF975 )
-		pFnF975 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F975" );
+	UFunction* const pFnF975 = pFnF975Ref.Get ( );
 
 	UBioAutoConditionals_execF975_Parms F975_Parms;
 	F975_Parms.bioWorld = bioWorld;
@@ -24013,10 +22968,9 @@ bool UBioAutoConditionals::F975 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F974 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF974 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF974Ref { L"Function PlotManager.BioAutoConditionals.F974", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF974 )
-		pFnF974 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F974" );
+	UFunction* const pFnF974 = pFnF974Ref.Get ( );
 
 	UBioAutoConditionals_execF974_Parms F974_Parms;
 	F974_Parms.bioWorld = bioWorld;
@@ -24036,10 +22990,9 @@ bool UBioAutoConditionals::F974 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F881 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF881 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF881Ref { L"Function PlotManager.BioAutoConditionals.F881", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF881 )
-		pFnF881 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F881" );
+	UFunction* const pFnF881 = pFnF881Ref.Get ( );
 
 	UBioAutoConditionals_execF881_Parms F881_Parms;
 	F881_Parms.bioWorld = bioWorld;
@@ -24059,10 +23012,9 @@ bool UBioAutoConditionals::F881 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F550 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF550 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF550Ref { L"Function PlotManager.BioAutoConditionals.F550", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF550 )
-		pFnF550 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F550" );
+	UFunction* const pFnF550 = pFnF550Ref.Get ( );
 
 	UBioAutoConditionals_execF550_Parms F550_Parms;
 	F550_Parms.bioWorld = bioWorld;
@@ -24082,10 +23034,9 @@ bool UBioAutoConditionals::F550 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F481 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF481 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF481Ref { L"Function PlotManager.BioAutoConditionals.F481", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF481 )
-		pFnF481 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F481" );
+	UFunction* const pFnF481 = pFnF481Ref.Get ( );
 
 	UBioAutoConditionals_execF481_Parms F481_Parms;
 	F481_Parms.bioWorld = bioWorld;
@@ -24105,10 +23056,9 @@ bool UBioAutoConditionals::F481 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F480 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF480 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF480Ref { L"Function PlotManager.BioAutoConditionals.F480", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF480 )
-		pFnF480 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F480" );
+	UFunction* const pFnF480 = pFnF480Ref.Get ( );
 
 	UBioAutoConditionals_execF480_Parms F480_Parms;
 	F480_Parms.bioWorld = bioWorld;
@@ -24128,10 +23078,9 @@ bool UBioAutoConditionals::F480 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F418 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF418 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF418Ref { L"Function PlotManager.BioAutoConditionals.F418", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF418 )
-		pFnF418 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F418" );
+	UFunction* const pFnF418 = pFnF418Ref.Get ( );
 
 	UBioAutoConditionals_execF418_Parms F418_Parms;
 	F418_Parms.bioWorld = bioWorld;
@@ -24151,10 +23100,9 @@ bool UBioAutoConditionals::F418 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F416 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF416 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF416Ref { L"Function PlotManager.BioAutoConditionals.F416", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF416 )
-		pFnF416 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F416" );
+	UFunction* const pFnF416 = pFnF416Ref.Get ( );
 
 	UBioAutoConditionals_execF416_Parms F416_Parms;
 	F416_Parms.bioWorld = bioWorld;
@@ -24174,10 +23122,9 @@ bool UBioAutoConditionals::F416 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F415 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF415 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF415Ref { L"Function PlotManager.BioAutoConditionals.F415", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF415 )
-		pFnF415 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F415" );
+	UFunction* const pFnF415 = pFnF415Ref.Get ( );
 
 	UBioAutoConditionals_execF415_Parms F415_Parms;
 	F415_Parms.bioWorld = bioWorld;
@@ -24197,10 +23144,9 @@ bool UBioAutoConditionals::F415 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F170 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF170 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF170Ref { L"Function PlotManager.BioAutoConditionals.F170", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF170 )
-		pFnF170 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F170" );
+	UFunction* const pFnF170 = pFnF170Ref.Get ( );
 
 	UBioAutoConditionals_execF170_Parms F170_Parms;
 	F170_Parms.bioWorld = bioWorld;
@@ -24220,10 +23166,9 @@ bool UBioAutoConditionals::F170 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F169 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF169 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF169Ref { L"Function PlotManager.BioAutoConditionals.F169", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF169 )
-		pFnF169 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F169" );
+	UFunction* const pFnF169 = pFnF169Ref.Get ( );
 
 	UBioAutoConditionals_execF169_Parms F169_Parms;
 	F169_Parms.bioWorld = bioWorld;
@@ -24243,10 +23188,9 @@ bool UBioAutoConditionals::F169 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F160 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF160 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF160Ref { L"Function PlotManager.BioAutoConditionals.F160", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF160 )
-		pFnF160 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F160" );
+	UFunction* const pFnF160 = pFnF160Ref.Get ( );
 
 	UBioAutoConditionals_execF160_Parms F160_Parms;
 	F160_Parms.bioWorld = bioWorld;
@@ -24266,10 +23210,9 @@ bool UBioAutoConditionals::F160 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F159 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF159 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF159Ref { L"Function PlotManager.BioAutoConditionals.F159", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF159 )
-		pFnF159 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F159" );
+	UFunction* const pFnF159 = pFnF159Ref.Get ( );
 
 	UBioAutoConditionals_execF159_Parms F159_Parms;
 	F159_Parms.bioWorld = bioWorld;
@@ -24289,10 +23232,9 @@ bool UBioAutoConditionals::F159 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F158 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF158 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF158Ref { L"Function PlotManager.BioAutoConditionals.F158", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF158 )
-		pFnF158 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F158" );
+	UFunction* const pFnF158 = pFnF158Ref.Get ( );
 
 	UBioAutoConditionals_execF158_Parms F158_Parms;
 	F158_Parms.bioWorld = bioWorld;
@@ -24312,10 +23254,9 @@ bool UBioAutoConditionals::F158 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F157 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF157 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF157Ref { L"Function PlotManager.BioAutoConditionals.F157", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF157 )
-		pFnF157 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F157" );
+	UFunction* const pFnF157 = pFnF157Ref.Get ( );
 
 	UBioAutoConditionals_execF157_Parms F157_Parms;
 	F157_Parms.bioWorld = bioWorld;
@@ -24335,10 +23276,9 @@ bool UBioAutoConditionals::F157 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F156 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF156 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF156Ref { L"Function PlotManager.BioAutoConditionals.F156", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF156 )
-		pFnF156 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F156" );
+	UFunction* const pFnF156 = pFnF156Ref.Get ( );
 
 	UBioAutoConditionals_execF156_Parms F156_Parms;
 	F156_Parms.bioWorld = bioWorld;
@@ -24358,10 +23298,9 @@ bool UBioAutoConditionals::F156 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F155 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF155 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF155Ref { L"Function PlotManager.BioAutoConditionals.F155", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF155 )
-		pFnF155 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F155" );
+	UFunction* const pFnF155 = pFnF155Ref.Get ( );
 
 	UBioAutoConditionals_execF155_Parms F155_Parms;
 	F155_Parms.bioWorld = bioWorld;
@@ -24381,10 +23320,9 @@ bool UBioAutoConditionals::F155 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F154 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF154 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF154Ref { L"Function PlotManager.BioAutoConditionals.F154", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF154 )
-		pFnF154 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F154" );
+	UFunction* const pFnF154 = pFnF154Ref.Get ( );
 
 	UBioAutoConditionals_execF154_Parms F154_Parms;
 	F154_Parms.bioWorld = bioWorld;
@@ -24404,10 +23342,9 @@ bool UBioAutoConditionals::F154 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F152 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF152 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF152Ref { L"Function PlotManager.BioAutoConditionals.F152", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF152 )
-		pFnF152 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F152" );
+	UFunction* const pFnF152 = pFnF152Ref.Get ( );
 
 	UBioAutoConditionals_execF152_Parms F152_Parms;
 	F152_Parms.bioWorld = bioWorld;
@@ -24427,10 +23364,9 @@ bool UBioAutoConditionals::F152 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F149 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF149 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF149Ref { L"Function PlotManager.BioAutoConditionals.F149", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF149 )
-		pFnF149 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F149" );
+	UFunction* const pFnF149 = pFnF149Ref.Get ( );
 
 	UBioAutoConditionals_execF149_Parms F149_Parms;
 	F149_Parms.bioWorld = bioWorld;
@@ -24450,10 +23386,9 @@ bool UBioAutoConditionals::F149 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F148 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF148 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF148Ref { L"Function PlotManager.BioAutoConditionals.F148", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF148 )
-		pFnF148 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F148" );
+	UFunction* const pFnF148 = pFnF148Ref.Get ( );
 
 	UBioAutoConditionals_execF148_Parms F148_Parms;
 	F148_Parms.bioWorld = bioWorld;
@@ -24473,10 +23408,9 @@ bool UBioAutoConditionals::F148 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F146 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF146 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF146Ref { L"Function PlotManager.BioAutoConditionals.F146", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF146 )
-		pFnF146 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F146" );
+	UFunction* const pFnF146 = pFnF146Ref.Get ( );
 
 	UBioAutoConditionals_execF146_Parms F146_Parms;
 	F146_Parms.bioWorld = bioWorld;
@@ -24496,10 +23430,9 @@ bool UBioAutoConditionals::F146 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F145 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF145 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF145Ref { L"Function PlotManager.BioAutoConditionals.F145", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF145 )
-		pFnF145 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F145" );
+	UFunction* const pFnF145 = pFnF145Ref.Get ( );
 
 	UBioAutoConditionals_execF145_Parms F145_Parms;
 	F145_Parms.bioWorld = bioWorld;
@@ -24519,10 +23452,9 @@ bool UBioAutoConditionals::F145 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F144 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF144 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF144Ref { L"Function PlotManager.BioAutoConditionals.F144", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF144 )
-		pFnF144 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F144" );
+	UFunction* const pFnF144 = pFnF144Ref.Get ( );
 
 	UBioAutoConditionals_execF144_Parms F144_Parms;
 	F144_Parms.bioWorld = bioWorld;
@@ -24542,10 +23474,9 @@ bool UBioAutoConditionals::F144 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F143 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF143 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF143Ref { L"Function PlotManager.BioAutoConditionals.F143", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF143 )
-		pFnF143 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F143" );
+	UFunction* const pFnF143 = pFnF143Ref.Get ( );
 
 	UBioAutoConditionals_execF143_Parms F143_Parms;
 	F143_Parms.bioWorld = bioWorld;
@@ -24558,6 +23489,1087 @@ bool UBioAutoConditionals::F143 ( class ABioWorldInfo* bioWorld, int Argument )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class PlotManager.BioAutoConditionals",
+	L"Function PlotManager.BioAutoConditionals.F1749",
+	L"Function PlotManager.BioAutoConditionals.F1748",
+	L"Function PlotManager.BioAutoConditionals.F1747",
+	L"Function PlotManager.BioAutoConditionals.F1746",
+	L"Function PlotManager.BioAutoConditionals.F1272",
+	L"Function PlotManager.BioAutoConditionals.F1271",
+	L"Function PlotManager.BioAutoConditionals.F1270",
+	L"Function PlotManager.BioAutoConditionals.F1225",
+	L"Function PlotManager.BioAutoConditionals.F1204",
+	L"Function PlotManager.BioAutoConditionals.F1203",
+	L"Function PlotManager.BioAutoConditionals.F1217",
+	L"Function PlotManager.BioAutoConditionals.F1216",
+	L"Function PlotManager.BioAutoConditionals.F1215",
+	L"Function PlotManager.BioAutoConditionals.F1214",
+	L"Function PlotManager.BioAutoConditionals.F1198",
+	L"Function PlotManager.BioAutoConditionals.F1197",
+	L"Function PlotManager.BioAutoConditionals.F1223",
+	L"Function PlotManager.BioAutoConditionals.F1222",
+	L"Function PlotManager.BioAutoConditionals.F1221",
+	L"Function PlotManager.BioAutoConditionals.F1220",
+	L"Function PlotManager.BioAutoConditionals.F1196",
+	L"Function PlotManager.BioAutoConditionals.F1194",
+	L"Function PlotManager.BioAutoConditionals.F1193",
+	L"Function PlotManager.BioAutoConditionals.F1192",
+	L"Function PlotManager.BioAutoConditionals.F1191",
+	L"Function PlotManager.BioAutoConditionals.F1190",
+	L"Function PlotManager.BioAutoConditionals.F1219",
+	L"Function PlotManager.BioAutoConditionals.F1202",
+	L"Function PlotManager.BioAutoConditionals.F1201",
+	L"Function PlotManager.BioAutoConditionals.F1218",
+	L"Function PlotManager.BioAutoConditionals.F1200",
+	L"Function PlotManager.BioAutoConditionals.F1199",
+	L"Function PlotManager.BioAutoConditionals.F1111",
+	L"Function PlotManager.BioAutoConditionals.F1669",
+	L"Function PlotManager.BioAutoConditionals.F1110",
+	L"Function PlotManager.BioAutoConditionals.F1109",
+	L"Function PlotManager.BioAutoConditionals.F873",
+	L"Function PlotManager.BioAutoConditionals.F872",
+	L"Function PlotManager.BioAutoConditionals.F871",
+	L"Function PlotManager.BioAutoConditionals.F870",
+	L"Function PlotManager.BioAutoConditionals.F869",
+	L"Function PlotManager.BioAutoConditionals.F2009",
+	L"Function PlotManager.BioAutoConditionals.F2008",
+	L"Function PlotManager.BioAutoConditionals.F2007",
+	L"Function PlotManager.BioAutoConditionals.F2006",
+	L"Function PlotManager.BioAutoConditionals.F2005",
+	L"Function PlotManager.BioAutoConditionals.F1577",
+	L"Function PlotManager.BioAutoConditionals.F1256",
+	L"Function PlotManager.BioAutoConditionals.F1255",
+	L"Function PlotManager.BioAutoConditionals.F1108",
+	L"Function PlotManager.BioAutoConditionals.F1251",
+	L"Function PlotManager.BioAutoConditionals.F1107",
+	L"Function PlotManager.BioAutoConditionals.F1249",
+	L"Function PlotManager.BioAutoConditionals.F1248",
+	L"Function PlotManager.BioAutoConditionals.F1106",
+	L"Function PlotManager.BioAutoConditionals.F1633",
+	L"Function PlotManager.BioAutoConditionals.F1105",
+	L"Function PlotManager.BioAutoConditionals.F997",
+	L"Function PlotManager.BioAutoConditionals.F996",
+	L"Function PlotManager.BioAutoConditionals.F992",
+	L"Function PlotManager.BioAutoConditionals.F991",
+	L"Function PlotManager.BioAutoConditionals.F986",
+	L"Function PlotManager.BioAutoConditionals.F985",
+	L"Function PlotManager.BioAutoConditionals.F984",
+	L"Function PlotManager.BioAutoConditionals.F982",
+	L"Function PlotManager.BioAutoConditionals.F1634",
+	L"Function PlotManager.BioAutoConditionals.F1104",
+	L"Function PlotManager.BioAutoConditionals.F864",
+	L"Function PlotManager.BioAutoConditionals.F863",
+	L"Function PlotManager.BioAutoConditionals.F862",
+	L"Function PlotManager.BioAutoConditionals.F977",
+	L"Function PlotManager.BioAutoConditionals.F976",
+	L"Function PlotManager.BioAutoConditionals.F1557",
+	L"Function PlotManager.BioAutoConditionals.F1064",
+	L"Function PlotManager.BioAutoConditionals.F1653",
+	L"Function PlotManager.BioAutoConditionals.F1413",
+	L"Function PlotManager.BioAutoConditionals.F1295",
+	L"Function PlotManager.BioAutoConditionals.F1294",
+	L"Function PlotManager.BioAutoConditionals.F1293",
+	L"Function PlotManager.BioAutoConditionals.F1292",
+	L"Function PlotManager.BioAutoConditionals.F1288",
+	L"Function PlotManager.BioAutoConditionals.F1287",
+	L"Function PlotManager.BioAutoConditionals.F1286",
+	L"Function PlotManager.BioAutoConditionals.F1285",
+	L"Function PlotManager.BioAutoConditionals.F1284",
+	L"Function PlotManager.BioAutoConditionals.F1243",
+	L"Function PlotManager.BioAutoConditionals.F1242",
+	L"Function PlotManager.BioAutoConditionals.F1137",
+	L"Function PlotManager.BioAutoConditionals.F1102",
+	L"Function PlotManager.BioAutoConditionals.F1099",
+	L"Function PlotManager.BioAutoConditionals.F1098",
+	L"Function PlotManager.BioAutoConditionals.F1635",
+	L"Function PlotManager.BioAutoConditionals.F1566",
+	L"Function PlotManager.BioAutoConditionals.F1650",
+	L"Function PlotManager.BioAutoConditionals.F1528",
+	L"Function PlotManager.BioAutoConditionals.F1240",
+	L"Function PlotManager.BioAutoConditionals.F1044",
+	L"Function PlotManager.BioAutoConditionals.F1014",
+	L"Function PlotManager.BioAutoConditionals.F1717",
+	L"Function PlotManager.BioAutoConditionals.F1553",
+	L"Function PlotManager.BioAutoConditionals.F1239",
+	L"Function PlotManager.BioAutoConditionals.F1238",
+	L"Function PlotManager.BioAutoConditionals.F1237",
+	L"Function PlotManager.BioAutoConditionals.F1096",
+	L"Function PlotManager.BioAutoConditionals.F1182",
+	L"Function PlotManager.BioAutoConditionals.F1181",
+	L"Function PlotManager.BioAutoConditionals.F1180",
+	L"Function PlotManager.BioAutoConditionals.F1179",
+	L"Function PlotManager.BioAutoConditionals.F1178",
+	L"Function PlotManager.BioAutoConditionals.F1177",
+	L"Function PlotManager.BioAutoConditionals.F1176",
+	L"Function PlotManager.BioAutoConditionals.F1175",
+	L"Function PlotManager.BioAutoConditionals.F1174",
+	L"Function PlotManager.BioAutoConditionals.F1094",
+	L"Function PlotManager.BioAutoConditionals.F1093",
+	L"Function PlotManager.BioAutoConditionals.F1519",
+	L"Function PlotManager.BioAutoConditionals.F1518",
+	L"Function PlotManager.BioAutoConditionals.F1231",
+	L"Function PlotManager.BioAutoConditionals.F1092",
+	L"Function PlotManager.BioAutoConditionals.F1040",
+	L"Function PlotManager.BioAutoConditionals.F1039",
+	L"Function PlotManager.BioAutoConditionals.F1038",
+	L"Function PlotManager.BioAutoConditionals.F1034",
+	L"Function PlotManager.BioAutoConditionals.F968",
+	L"Function PlotManager.BioAutoConditionals.F967",
+	L"Function PlotManager.BioAutoConditionals.F966",
+	L"Function PlotManager.BioAutoConditionals.F893",
+	L"Function PlotManager.BioAutoConditionals.F1504",
+	L"Function PlotManager.BioAutoConditionals.F1517",
+	L"Function PlotManager.BioAutoConditionals.F1514",
+	L"Function PlotManager.BioAutoConditionals.F1513",
+	L"Function PlotManager.BioAutoConditionals.F1512",
+	L"Function PlotManager.BioAutoConditionals.F1516",
+	L"Function PlotManager.BioAutoConditionals.F1515",
+	L"Function PlotManager.BioAutoConditionals.F1506",
+	L"Function PlotManager.BioAutoConditionals.F1505",
+	L"Function PlotManager.BioAutoConditionals.F1507",
+	L"Function PlotManager.BioAutoConditionals.F1511",
+	L"Function PlotManager.BioAutoConditionals.F1510",
+	L"Function PlotManager.BioAutoConditionals.F1509",
+	L"Function PlotManager.BioAutoConditionals.F1508",
+	L"Function PlotManager.BioAutoConditionals.F1529",
+	L"Function PlotManager.BioAutoConditionals.F1558",
+	L"Function PlotManager.BioAutoConditionals.F1439",
+	L"Function PlotManager.BioAutoConditionals.F1438",
+	L"Function PlotManager.BioAutoConditionals.F1440",
+	L"Function PlotManager.BioAutoConditionals.F1441",
+	L"Function PlotManager.BioAutoConditionals.F1437",
+	L"Function PlotManager.BioAutoConditionals.F1436",
+	L"Function PlotManager.BioAutoConditionals.F1434",
+	L"Function PlotManager.BioAutoConditionals.F1435",
+	L"Function PlotManager.BioAutoConditionals.F1443",
+	L"Function PlotManager.BioAutoConditionals.F1442",
+	L"Function PlotManager.BioAutoConditionals.F1444",
+	L"Function PlotManager.BioAutoConditionals.F1445",
+	L"Function PlotManager.BioAutoConditionals.F1447",
+	L"Function PlotManager.BioAutoConditionals.F1446",
+	L"Function PlotManager.BioAutoConditionals.F1449",
+	L"Function PlotManager.BioAutoConditionals.F1448",
+	L"Function PlotManager.BioAutoConditionals.F1464",
+	L"Function PlotManager.BioAutoConditionals.F1463",
+	L"Function PlotManager.BioAutoConditionals.F1466",
+	L"Function PlotManager.BioAutoConditionals.F1465",
+	L"Function PlotManager.BioAutoConditionals.F1460",
+	L"Function PlotManager.BioAutoConditionals.F1459",
+	L"Function PlotManager.BioAutoConditionals.F1462",
+	L"Function PlotManager.BioAutoConditionals.F1461",
+	L"Function PlotManager.BioAutoConditionals.F1451",
+	L"Function PlotManager.BioAutoConditionals.F1450",
+	L"Function PlotManager.BioAutoConditionals.F1454",
+	L"Function PlotManager.BioAutoConditionals.F1452",
+	L"Function PlotManager.BioAutoConditionals.F1456",
+	L"Function PlotManager.BioAutoConditionals.F1455",
+	L"Function PlotManager.BioAutoConditionals.F1458",
+	L"Function PlotManager.BioAutoConditionals.F1457",
+	L"Function PlotManager.BioAutoConditionals.F1468",
+	L"Function PlotManager.BioAutoConditionals.F1470",
+	L"Function PlotManager.BioAutoConditionals.F1469",
+	L"Function PlotManager.BioAutoConditionals.F1472",
+	L"Function PlotManager.BioAutoConditionals.F1471",
+	L"Function PlotManager.BioAutoConditionals.F1474",
+	L"Function PlotManager.BioAutoConditionals.F1473",
+	L"Function PlotManager.BioAutoConditionals.F1476",
+	L"Function PlotManager.BioAutoConditionals.F1475",
+	L"Function PlotManager.BioAutoConditionals.F1478",
+	L"Function PlotManager.BioAutoConditionals.F1477",
+	L"Function PlotManager.BioAutoConditionals.F1480",
+	L"Function PlotManager.BioAutoConditionals.F1479",
+	L"Function PlotManager.BioAutoConditionals.F1433",
+	L"Function PlotManager.BioAutoConditionals.F1432",
+	L"Function PlotManager.BioAutoConditionals.F1431",
+	L"Function PlotManager.BioAutoConditionals.F1430",
+	L"Function PlotManager.BioAutoConditionals.F1429",
+	L"Function PlotManager.BioAutoConditionals.F1428",
+	L"Function PlotManager.BioAutoConditionals.F1427",
+	L"Function PlotManager.BioAutoConditionals.F1426",
+	L"Function PlotManager.BioAutoConditionals.F1425",
+	L"Function PlotManager.BioAutoConditionals.F1424",
+	L"Function PlotManager.BioAutoConditionals.F1423",
+	L"Function PlotManager.BioAutoConditionals.F1422",
+	L"Function PlotManager.BioAutoConditionals.F1421",
+	L"Function PlotManager.BioAutoConditionals.F1420",
+	L"Function PlotManager.BioAutoConditionals.F1419",
+	L"Function PlotManager.BioAutoConditionals.F1418",
+	L"Function PlotManager.BioAutoConditionals.F1417",
+	L"Function PlotManager.BioAutoConditionals.F1416",
+	L"Function PlotManager.BioAutoConditionals.F1415",
+	L"Function PlotManager.BioAutoConditionals.F1408",
+	L"Function PlotManager.BioAutoConditionals.F1406",
+	L"Function PlotManager.BioAutoConditionals.F1081",
+	L"Function PlotManager.BioAutoConditionals.F1080",
+	L"Function PlotManager.BioAutoConditionals.F477",
+	L"Function PlotManager.BioAutoConditionals.F476",
+	L"Function PlotManager.BioAutoConditionals.F475",
+	L"Function PlotManager.BioAutoConditionals.F474",
+	L"Function PlotManager.BioAutoConditionals.F473",
+	L"Function PlotManager.BioAutoConditionals.F472",
+	L"Function PlotManager.BioAutoConditionals.F465",
+	L"Function PlotManager.BioAutoConditionals.F459",
+	L"Function PlotManager.BioAutoConditionals.F458",
+	L"Function PlotManager.BioAutoConditionals.F457",
+	L"Function PlotManager.BioAutoConditionals.F456",
+	L"Function PlotManager.BioAutoConditionals.F455",
+	L"Function PlotManager.BioAutoConditionals.F449",
+	L"Function PlotManager.BioAutoConditionals.F448",
+	L"Function PlotManager.BioAutoConditionals.F447",
+	L"Function PlotManager.BioAutoConditionals.F446",
+	L"Function PlotManager.BioAutoConditionals.F445",
+	L"Function PlotManager.BioAutoConditionals.F470",
+	L"Function PlotManager.BioAutoConditionals.F568",
+	L"Function PlotManager.BioAutoConditionals.F562",
+	L"Function PlotManager.BioAutoConditionals.F558",
+	L"Function PlotManager.BioAutoConditionals.F223",
+	L"Function PlotManager.BioAutoConditionals.F218",
+	L"Function PlotManager.BioAutoConditionals.F214",
+	L"Function PlotManager.BioAutoConditionals.F213",
+	L"Function PlotManager.BioAutoConditionals.F225",
+	L"Function PlotManager.BioAutoConditionals.F181",
+	L"Function PlotManager.BioAutoConditionals.F180",
+	L"Function PlotManager.BioAutoConditionals.F1637",
+	L"Function PlotManager.BioAutoConditionals.F1636",
+	L"Function PlotManager.BioAutoConditionals.F1205",
+	L"Function PlotManager.BioAutoConditionals.F451",
+	L"Function PlotManager.BioAutoConditionals.F450",
+	L"Function PlotManager.BioAutoConditionals.F471",
+	L"Function PlotManager.BioAutoConditionals.F454",
+	L"Function PlotManager.BioAutoConditionals.F1296",
+	L"Function PlotManager.BioAutoConditionals.F1262",
+	L"Function PlotManager.BioAutoConditionals.F1261",
+	L"Function PlotManager.BioAutoConditionals.F1260",
+	L"Function PlotManager.BioAutoConditionals.F2013",
+	L"Function PlotManager.BioAutoConditionals.F1710",
+	L"Function PlotManager.BioAutoConditionals.F1709",
+	L"Function PlotManager.BioAutoConditionals.F1708",
+	L"Function PlotManager.BioAutoConditionals.F1707",
+	L"Function PlotManager.BioAutoConditionals.F1706",
+	L"Function PlotManager.BioAutoConditionals.F1705",
+	L"Function PlotManager.BioAutoConditionals.F1122",
+	L"Function PlotManager.BioAutoConditionals.F1121",
+	L"Function PlotManager.BioAutoConditionals.F1120",
+	L"Function PlotManager.BioAutoConditionals.F1119",
+	L"Function PlotManager.BioAutoConditionals.F1118",
+	L"Function PlotManager.BioAutoConditionals.F1117",
+	L"Function PlotManager.BioAutoConditionals.F1003",
+	L"Function PlotManager.BioAutoConditionals.F668",
+	L"Function PlotManager.BioAutoConditionals.F667",
+	L"Function PlotManager.BioAutoConditionals.F666",
+	L"Function PlotManager.BioAutoConditionals.F656",
+	L"Function PlotManager.BioAutoConditionals.F655",
+	L"Function PlotManager.BioAutoConditionals.F653",
+	L"Function PlotManager.BioAutoConditionals.F777",
+	L"Function PlotManager.BioAutoConditionals.F776",
+	L"Function PlotManager.BioAutoConditionals.F1351",
+	L"Function PlotManager.BioAutoConditionals.F531",
+	L"Function PlotManager.BioAutoConditionals.F440",
+	L"Function PlotManager.BioAutoConditionals.F438",
+	L"Function PlotManager.BioAutoConditionals.F657",
+	L"Function PlotManager.BioAutoConditionals.F311",
+	L"Function PlotManager.BioAutoConditionals.F654",
+	L"Function PlotManager.BioAutoConditionals.F652",
+	L"Function PlotManager.BioAutoConditionals.F712",
+	L"Function PlotManager.BioAutoConditionals.F711",
+	L"Function PlotManager.BioAutoConditionals.F1323",
+	L"Function PlotManager.BioAutoConditionals.F1322",
+	L"Function PlotManager.BioAutoConditionals.F1493",
+	L"Function PlotManager.BioAutoConditionals.F663",
+	L"Function PlotManager.BioAutoConditionals.F660",
+	L"Function PlotManager.BioAutoConditionals.F1670",
+	L"Function PlotManager.BioAutoConditionals.F1313",
+	L"Function PlotManager.BioAutoConditionals.F1375",
+	L"Function PlotManager.BioAutoConditionals.F1360",
+	L"Function PlotManager.BioAutoConditionals.F1125",
+	L"Function PlotManager.BioAutoConditionals.F1124",
+	L"Function PlotManager.BioAutoConditionals.F1045",
+	L"Function PlotManager.BioAutoConditionals.F1026",
+	L"Function PlotManager.BioAutoConditionals.F1022",
+	L"Function PlotManager.BioAutoConditionals.F1021",
+	L"Function PlotManager.BioAutoConditionals.F705",
+	L"Function PlotManager.BioAutoConditionals.F432",
+	L"Function PlotManager.BioAutoConditionals.F436",
+	L"Function PlotManager.BioAutoConditionals.F433",
+	L"Function PlotManager.BioAutoConditionals.F373",
+	L"Function PlotManager.BioAutoConditionals.F372",
+	L"Function PlotManager.BioAutoConditionals.F371",
+	L"Function PlotManager.BioAutoConditionals.F359",
+	L"Function PlotManager.BioAutoConditionals.F358",
+	L"Function PlotManager.BioAutoConditionals.F1352",
+	L"Function PlotManager.BioAutoConditionals.F1740",
+	L"Function PlotManager.BioAutoConditionals.F1556",
+	L"Function PlotManager.BioAutoConditionals.F1555",
+	L"Function PlotManager.BioAutoConditionals.F1550",
+	L"Function PlotManager.BioAutoConditionals.F1481",
+	L"Function PlotManager.BioAutoConditionals.F1379",
+	L"Function PlotManager.BioAutoConditionals.F1338",
+	L"Function PlotManager.BioAutoConditionals.F1320",
+	L"Function PlotManager.BioAutoConditionals.F1055",
+	L"Function PlotManager.BioAutoConditionals.F1054",
+	L"Function PlotManager.BioAutoConditionals.F1029",
+	L"Function PlotManager.BioAutoConditionals.F767",
+	L"Function PlotManager.BioAutoConditionals.F700",
+	L"Function PlotManager.BioAutoConditionals.F532",
+	L"Function PlotManager.BioAutoConditionals.F443",
+	L"Function PlotManager.BioAutoConditionals.F404",
+	L"Function PlotManager.BioAutoConditionals.F401",
+	L"Function PlotManager.BioAutoConditionals.F400",
+	L"Function PlotManager.BioAutoConditionals.F376",
+	L"Function PlotManager.BioAutoConditionals.F363",
+	L"Function PlotManager.BioAutoConditionals.F361",
+	L"Function PlotManager.BioAutoConditionals.F774",
+	L"Function PlotManager.BioAutoConditionals.F772",
+	L"Function PlotManager.BioAutoConditionals.F516",
+	L"Function PlotManager.BioAutoConditionals.F515",
+	L"Function PlotManager.BioAutoConditionals.F402",
+	L"Function PlotManager.BioAutoConditionals.F343",
+	L"Function PlotManager.BioAutoConditionals.F341",
+	L"Function PlotManager.BioAutoConditionals.F340",
+	L"Function PlotManager.BioAutoConditionals.F327",
+	L"Function PlotManager.BioAutoConditionals.F1750",
+	L"Function PlotManager.BioAutoConditionals.F1554",
+	L"Function PlotManager.BioAutoConditionals.F771",
+	L"Function PlotManager.BioAutoConditionals.F426",
+	L"Function PlotManager.BioAutoConditionals.F407",
+	L"Function PlotManager.BioAutoConditionals.F388",
+	L"Function PlotManager.BioAutoConditionals.F387",
+	L"Function PlotManager.BioAutoConditionals.F386",
+	L"Function PlotManager.BioAutoConditionals.F385",
+	L"Function PlotManager.BioAutoConditionals.F384",
+	L"Function PlotManager.BioAutoConditionals.F382",
+	L"Function PlotManager.BioAutoConditionals.F381",
+	L"Function PlotManager.BioAutoConditionals.F380",
+	L"Function PlotManager.BioAutoConditionals.F339",
+	L"Function PlotManager.BioAutoConditionals.F328",
+	L"Function PlotManager.BioAutoConditionals.F1646",
+	L"Function PlotManager.BioAutoConditionals.F1645",
+	L"Function PlotManager.BioAutoConditionals.F1737",
+	L"Function PlotManager.BioAutoConditionals.F1736",
+	L"Function PlotManager.BioAutoConditionals.F1173",
+	L"Function PlotManager.BioAutoConditionals.F1172",
+	L"Function PlotManager.BioAutoConditionals.F1703",
+	L"Function PlotManager.BioAutoConditionals.F1658",
+	L"Function PlotManager.BioAutoConditionals.F1247",
+	L"Function PlotManager.BioAutoConditionals.F1246",
+	L"Function PlotManager.BioAutoConditionals.F1245",
+	L"Function PlotManager.BioAutoConditionals.F1745",
+	L"Function PlotManager.BioAutoConditionals.F1739",
+	L"Function PlotManager.BioAutoConditionals.F1738",
+	L"Function PlotManager.BioAutoConditionals.F1386",
+	L"Function PlotManager.BioAutoConditionals.F681",
+	L"Function PlotManager.BioAutoConditionals.F680",
+	L"Function PlotManager.BioAutoConditionals.F1618",
+	L"Function PlotManager.BioAutoConditionals.F1617",
+	L"Function PlotManager.BioAutoConditionals.F1576",
+	L"Function PlotManager.BioAutoConditionals.F1340",
+	L"Function PlotManager.BioAutoConditionals.F685",
+	L"Function PlotManager.BioAutoConditionals.F412",
+	L"Function PlotManager.BioAutoConditionals.F410",
+	L"Function PlotManager.BioAutoConditionals.F409",
+	L"Function PlotManager.BioAutoConditionals.F408",
+	L"Function PlotManager.BioAutoConditionals.F405",
+	L"Function PlotManager.BioAutoConditionals.F1017",
+	L"Function PlotManager.BioAutoConditionals.F1016",
+	L"Function PlotManager.BioAutoConditionals.F1015",
+	L"Function PlotManager.BioAutoConditionals.F1011",
+	L"Function PlotManager.BioAutoConditionals.F1010",
+	L"Function PlotManager.BioAutoConditionals.F1624",
+	L"Function PlotManager.BioAutoConditionals.F1623",
+	L"Function PlotManager.BioAutoConditionals.F1622",
+	L"Function PlotManager.BioAutoConditionals.F1621",
+	L"Function PlotManager.BioAutoConditionals.F1620",
+	L"Function PlotManager.BioAutoConditionals.F1619",
+	L"Function PlotManager.BioAutoConditionals.F884",
+	L"Function PlotManager.BioAutoConditionals.F1593",
+	L"Function PlotManager.BioAutoConditionals.F1592",
+	L"Function PlotManager.BioAutoConditionals.F1591",
+	L"Function PlotManager.BioAutoConditionals.F1590",
+	L"Function PlotManager.BioAutoConditionals.F1589",
+	L"Function PlotManager.BioAutoConditionals.F1588",
+	L"Function PlotManager.BioAutoConditionals.F1587",
+	L"Function PlotManager.BioAutoConditionals.F1586",
+	L"Function PlotManager.BioAutoConditionals.F1585",
+	L"Function PlotManager.BioAutoConditionals.F1584",
+	L"Function PlotManager.BioAutoConditionals.F1583",
+	L"Function PlotManager.BioAutoConditionals.F1582",
+	L"Function PlotManager.BioAutoConditionals.F1581",
+	L"Function PlotManager.BioAutoConditionals.F1580",
+	L"Function PlotManager.BioAutoConditionals.F1579",
+	L"Function PlotManager.BioAutoConditionals.F1578",
+	L"Function PlotManager.BioAutoConditionals.F1647",
+	L"Function PlotManager.BioAutoConditionals.F1050",
+	L"Function PlotManager.BioAutoConditionals.F1595",
+	L"Function PlotManager.BioAutoConditionals.F1342",
+	L"Function PlotManager.BioAutoConditionals.F635",
+	L"Function PlotManager.BioAutoConditionals.F535",
+	L"Function PlotManager.BioAutoConditionals.F534",
+	L"Function PlotManager.BioAutoConditionals.F533",
+	L"Function PlotManager.BioAutoConditionals.F439",
+	L"Function PlotManager.BioAutoConditionals.F390",
+	L"Function PlotManager.BioAutoConditionals.F355",
+	L"Function PlotManager.BioAutoConditionals.F1735",
+	L"Function PlotManager.BioAutoConditionals.F1734",
+	L"Function PlotManager.BioAutoConditionals.F1344",
+	L"Function PlotManager.BioAutoConditionals.F1185",
+	L"Function PlotManager.BioAutoConditionals.F775",
+	L"Function PlotManager.BioAutoConditionals.F411",
+	L"Function PlotManager.BioAutoConditionals.F354",
+	L"Function PlotManager.BioAutoConditionals.F353",
+	L"Function PlotManager.BioAutoConditionals.F352",
+	L"Function PlotManager.BioAutoConditionals.F406",
+	L"Function PlotManager.BioAutoConditionals.F246",
+	L"Function PlotManager.BioAutoConditionals.F245",
+	L"Function PlotManager.BioAutoConditionals.F1063",
+	L"Function PlotManager.BioAutoConditionals.F1062",
+	L"Function PlotManager.BioAutoConditionals.F524",
+	L"Function PlotManager.BioAutoConditionals.F523",
+	L"Function PlotManager.BioAutoConditionals.F522",
+	L"Function PlotManager.BioAutoConditionals.F521",
+	L"Function PlotManager.BioAutoConditionals.F520",
+	L"Function PlotManager.BioAutoConditionals.F519",
+	L"Function PlotManager.BioAutoConditionals.F518",
+	L"Function PlotManager.BioAutoConditionals.F517",
+	L"Function PlotManager.BioAutoConditionals.F600",
+	L"Function PlotManager.BioAutoConditionals.F391",
+	L"Function PlotManager.BioAutoConditionals.F708",
+	L"Function PlotManager.BioAutoConditionals.F707",
+	L"Function PlotManager.BioAutoConditionals.F686",
+	L"Function PlotManager.BioAutoConditionals.F606",
+	L"Function PlotManager.BioAutoConditionals.F1049",
+	L"Function PlotManager.BioAutoConditionals.F1241",
+	L"Function PlotManager.BioAutoConditionals.F1230",
+	L"Function PlotManager.BioAutoConditionals.F1171",
+	L"Function PlotManager.BioAutoConditionals.F414",
+	L"Function PlotManager.BioAutoConditionals.F362",
+	L"Function PlotManager.BioAutoConditionals.F360",
+	L"Function PlotManager.BioAutoConditionals.F357",
+	L"Function PlotManager.BioAutoConditionals.F2018",
+	L"Function PlotManager.BioAutoConditionals.F467",
+	L"Function PlotManager.BioAutoConditionals.F724",
+	L"Function PlotManager.BioAutoConditionals.F599",
+	L"Function PlotManager.BioAutoConditionals.F468",
+	L"Function PlotManager.BioAutoConditionals.F466",
+	L"Function PlotManager.BioAutoConditionals.F1350",
+	L"Function PlotManager.BioAutoConditionals.F1349",
+	L"Function PlotManager.BioAutoConditionals.F1348",
+	L"Function PlotManager.BioAutoConditionals.F1319",
+	L"Function PlotManager.BioAutoConditionals.F1318",
+	L"Function PlotManager.BioAutoConditionals.F1317",
+	L"Function PlotManager.BioAutoConditionals.F1316",
+	L"Function PlotManager.BioAutoConditionals.F1315",
+	L"Function PlotManager.BioAutoConditionals.F1314",
+	L"Function PlotManager.BioAutoConditionals.F1305",
+	L"Function PlotManager.BioAutoConditionals.F1304",
+	L"Function PlotManager.BioAutoConditionals.F1303",
+	L"Function PlotManager.BioAutoConditionals.F1302",
+	L"Function PlotManager.BioAutoConditionals.F1301",
+	L"Function PlotManager.BioAutoConditionals.F1300",
+	L"Function PlotManager.BioAutoConditionals.F1299",
+	L"Function PlotManager.BioAutoConditionals.F1298",
+	L"Function PlotManager.BioAutoConditionals.F1742",
+	L"Function PlotManager.BioAutoConditionals.F1278",
+	L"Function PlotManager.BioAutoConditionals.F1277",
+	L"Function PlotManager.BioAutoConditionals.F994",
+	L"Function PlotManager.BioAutoConditionals.F993",
+	L"Function PlotManager.BioAutoConditionals.F958",
+	L"Function PlotManager.BioAutoConditionals.F957",
+	L"Function PlotManager.BioAutoConditionals.F956",
+	L"Function PlotManager.BioAutoConditionals.F955",
+	L"Function PlotManager.BioAutoConditionals.F954",
+	L"Function PlotManager.BioAutoConditionals.F953",
+	L"Function PlotManager.BioAutoConditionals.F1398",
+	L"Function PlotManager.BioAutoConditionals.F965",
+	L"Function PlotManager.BioAutoConditionals.F964",
+	L"Function PlotManager.BioAutoConditionals.F963",
+	L"Function PlotManager.BioAutoConditionals.F1385",
+	L"Function PlotManager.BioAutoConditionals.F1503",
+	L"Function PlotManager.BioAutoConditionals.F1393",
+	L"Function PlotManager.BioAutoConditionals.F1390",
+	L"Function PlotManager.BioAutoConditionals.F1388",
+	L"Function PlotManager.BioAutoConditionals.F1387",
+	L"Function PlotManager.BioAutoConditionals.F1648",
+	L"Function PlotManager.BioAutoConditionals.F1502",
+	L"Function PlotManager.BioAutoConditionals.F1397",
+	L"Function PlotManager.BioAutoConditionals.F1395",
+	L"Function PlotManager.BioAutoConditionals.F1394",
+	L"Function PlotManager.BioAutoConditionals.F1392",
+	L"Function PlotManager.BioAutoConditionals.F979",
+	L"Function PlotManager.BioAutoConditionals.F978",
+	L"Function PlotManager.BioAutoConditionals.F972",
+	L"Function PlotManager.BioAutoConditionals.F970",
+	L"Function PlotManager.BioAutoConditionals.F969",
+	L"Function PlotManager.BioAutoConditionals.F1501",
+	L"Function PlotManager.BioAutoConditionals.F1347",
+	L"Function PlotManager.BioAutoConditionals.F1346",
+	L"Function PlotManager.BioAutoConditionals.F990",
+	L"Function PlotManager.BioAutoConditionals.F989",
+	L"Function PlotManager.BioAutoConditionals.F1500",
+	L"Function PlotManager.BioAutoConditionals.F1373",
+	L"Function PlotManager.BioAutoConditionals.F1372",
+	L"Function PlotManager.BioAutoConditionals.F1371",
+	L"Function PlotManager.BioAutoConditionals.F1499",
+	L"Function PlotManager.BioAutoConditionals.F1378",
+	L"Function PlotManager.BioAutoConditionals.F1377",
+	L"Function PlotManager.BioAutoConditionals.F1376",
+	L"Function PlotManager.BioAutoConditionals.F1361",
+	L"Function PlotManager.BioAutoConditionals.F1359",
+	L"Function PlotManager.BioAutoConditionals.F1358",
+	L"Function PlotManager.BioAutoConditionals.F1357",
+	L"Function PlotManager.BioAutoConditionals.F1656",
+	L"Function PlotManager.BioAutoConditionals.F1498",
+	L"Function PlotManager.BioAutoConditionals.F1381",
+	L"Function PlotManager.BioAutoConditionals.F1496",
+	L"Function PlotManager.BioAutoConditionals.F1334",
+	L"Function PlotManager.BioAutoConditionals.F1333",
+	L"Function PlotManager.BioAutoConditionals.F1275",
+	L"Function PlotManager.BioAutoConditionals.F1274",
+	L"Function PlotManager.BioAutoConditionals.F1273",
+	L"Function PlotManager.BioAutoConditionals.F1269",
+	L"Function PlotManager.BioAutoConditionals.F1492",
+	L"Function PlotManager.BioAutoConditionals.F1410",
+	L"Function PlotManager.BioAutoConditionals.F1401",
+	L"Function PlotManager.BioAutoConditionals.F1400",
+	L"Function PlotManager.BioAutoConditionals.F1491",
+	L"Function PlotManager.BioAutoConditionals.F1382",
+	L"Function PlotManager.BioAutoConditionals.F1356",
+	L"Function PlotManager.BioAutoConditionals.F1354",
+	L"Function PlotManager.BioAutoConditionals.F1353",
+	L"Function PlotManager.BioAutoConditionals.F1404",
+	L"Function PlotManager.BioAutoConditionals.F1403",
+	L"Function PlotManager.BioAutoConditionals.F1654",
+	L"Function PlotManager.BioAutoConditionals.F1389",
+	L"Function PlotManager.BioAutoConditionals.F1147",
+	L"Function PlotManager.BioAutoConditionals.F1086",
+	L"Function PlotManager.BioAutoConditionals.F952",
+	L"Function PlotManager.BioAutoConditionals.F951",
+	L"Function PlotManager.BioAutoConditionals.F950",
+	L"Function PlotManager.BioAutoConditionals.F1490",
+	L"Function PlotManager.BioAutoConditionals.F1365",
+	L"Function PlotManager.BioAutoConditionals.F1364",
+	L"Function PlotManager.BioAutoConditionals.F1363",
+	L"Function PlotManager.BioAutoConditionals.F1362",
+	L"Function PlotManager.BioAutoConditionals.F899",
+	L"Function PlotManager.BioAutoConditionals.F838",
+	L"Function PlotManager.BioAutoConditionals.F837",
+	L"Function PlotManager.BioAutoConditionals.F503",
+	L"Function PlotManager.BioAutoConditionals.F501",
+	L"Function PlotManager.BioAutoConditionals.F500",
+	L"Function PlotManager.BioAutoConditionals.F499",
+	L"Function PlotManager.BioAutoConditionals.F444",
+	L"Function PlotManager.BioAutoConditionals.F529",
+	L"Function PlotManager.BioAutoConditionals.F182",
+	L"Function PlotManager.BioAutoConditionals.F173",
+	L"Function PlotManager.BioAutoConditionals.F512",
+	L"Function PlotManager.BioAutoConditionals.F508",
+	L"Function PlotManager.BioAutoConditionals.F347",
+	L"Function PlotManager.BioAutoConditionals.F172",
+	L"Function PlotManager.BioAutoConditionals.F166",
+	L"Function PlotManager.BioAutoConditionals.F505",
+	L"Function PlotManager.BioAutoConditionals.F164",
+	L"Function PlotManager.BioAutoConditionals.F526",
+	L"Function PlotManager.BioAutoConditionals.F511",
+	L"Function PlotManager.BioAutoConditionals.F510",
+	L"Function PlotManager.BioAutoConditionals.F509",
+	L"Function PlotManager.BioAutoConditionals.F507",
+	L"Function PlotManager.BioAutoConditionals.F506",
+	L"Function PlotManager.BioAutoConditionals.F348",
+	L"Function PlotManager.BioAutoConditionals.F222",
+	L"Function PlotManager.BioAutoConditionals.F1644",
+	L"Function PlotManager.BioAutoConditionals.F1643",
+	L"Function PlotManager.BioAutoConditionals.F1483",
+	L"Function PlotManager.BioAutoConditionals.F1257",
+	L"Function PlotManager.BioAutoConditionals.F1234",
+	L"Function PlotManager.BioAutoConditionals.F1233",
+	L"Function PlotManager.BioAutoConditionals.F1232",
+	L"Function PlotManager.BioAutoConditionals.F804",
+	L"Function PlotManager.BioAutoConditionals.F803",
+	L"Function PlotManager.BioAutoConditionals.F802",
+	L"Function PlotManager.BioAutoConditionals.F677",
+	L"Function PlotManager.BioAutoConditionals.F1733",
+	L"Function PlotManager.BioAutoConditionals.F1715",
+	L"Function PlotManager.BioAutoConditionals.F1714",
+	L"Function PlotManager.BioAutoConditionals.F1484",
+	L"Function PlotManager.BioAutoConditionals.F1276",
+	L"Function PlotManager.BioAutoConditionals.F796",
+	L"Function PlotManager.BioAutoConditionals.F1485",
+	L"Function PlotManager.BioAutoConditionals.F1227",
+	L"Function PlotManager.BioAutoConditionals.F1131",
+	L"Function PlotManager.BioAutoConditionals.F1130",
+	L"Function PlotManager.BioAutoConditionals.F1129",
+	L"Function PlotManager.BioAutoConditionals.F1127",
+	L"Function PlotManager.BioAutoConditionals.F1126",
+	L"Function PlotManager.BioAutoConditionals.F1565",
+	L"Function PlotManager.BioAutoConditionals.F1486",
+	L"Function PlotManager.BioAutoConditionals.F1649",
+	L"Function PlotManager.BioAutoConditionals.F1488",
+	L"Function PlotManager.BioAutoConditionals.F1025",
+	L"Function PlotManager.BioAutoConditionals.F1024",
+	L"Function PlotManager.BioAutoConditionals.F1023",
+	L"Function PlotManager.BioAutoConditionals.F805",
+	L"Function PlotManager.BioAutoConditionals.F706",
+	L"Function PlotManager.BioAutoConditionals.F393",
+	L"Function PlotManager.BioAutoConditionals.F662",
+	L"Function PlotManager.BioAutoConditionals.F1059",
+	L"Function PlotManager.BioAutoConditionals.F1384",
+	L"Function PlotManager.BioAutoConditionals.F1383",
+	L"Function PlotManager.BioAutoConditionals.F1409",
+	L"Function PlotManager.BioAutoConditionals.F1341",
+	L"Function PlotManager.BioAutoConditionals.F1594",
+	L"Function PlotManager.BioAutoConditionals.F398",
+	L"Function PlotManager.BioAutoConditionals.F397",
+	L"Function PlotManager.BioAutoConditionals.F396",
+	L"Function PlotManager.BioAutoConditionals.F395",
+	L"Function PlotManager.BioAutoConditionals.F394",
+	L"Function PlotManager.BioAutoConditionals.F392",
+	L"Function PlotManager.BioAutoConditionals.F346",
+	L"Function PlotManager.BioAutoConditionals.F345",
+	L"Function PlotManager.BioAutoConditionals.F344",
+	L"Function PlotManager.BioAutoConditionals.F323",
+	L"Function PlotManager.BioAutoConditionals.F322",
+	L"Function PlotManager.BioAutoConditionals.F321",
+	L"Function PlotManager.BioAutoConditionals.F320",
+	L"Function PlotManager.BioAutoConditionals.F266",
+	L"Function PlotManager.BioAutoConditionals.F265",
+	L"Function PlotManager.BioAutoConditionals.F264",
+	L"Function PlotManager.BioAutoConditionals.F263",
+	L"Function PlotManager.BioAutoConditionals.F2004",
+	L"Function PlotManager.BioAutoConditionals.F1531",
+	L"Function PlotManager.BioAutoConditionals.F1482",
+	L"Function PlotManager.BioAutoConditionals.F1337",
+	L"Function PlotManager.BioAutoConditionals.F1336",
+	L"Function PlotManager.BioAutoConditionals.F1335",
+	L"Function PlotManager.BioAutoConditionals.F1297",
+	L"Function PlotManager.BioAutoConditionals.F799",
+	L"Function PlotManager.BioAutoConditionals.F798",
+	L"Function PlotManager.BioAutoConditionals.F797",
+	L"Function PlotManager.BioAutoConditionals.F1632",
+	L"Function PlotManager.BioAutoConditionals.F1716",
+	L"Function PlotManager.BioAutoConditionals.F1061",
+	L"Function PlotManager.BioAutoConditionals.F1128",
+	L"Function PlotManager.BioAutoConditionals.F1229",
+	L"Function PlotManager.BioAutoConditionals.F1345",
+	L"Function PlotManager.BioAutoConditionals.F1369",
+	L"Function PlotManager.BioAutoConditionals.F1368",
+	L"Function PlotManager.BioAutoConditionals.F1367",
+	L"Function PlotManager.BioAutoConditionals.F1366",
+	L"Function PlotManager.BioAutoConditionals.F784",
+	L"Function PlotManager.BioAutoConditionals.F795",
+	L"Function PlotManager.BioAutoConditionals.F792",
+	L"Function PlotManager.BioAutoConditionals.F793",
+	L"Function PlotManager.BioAutoConditionals.F790",
+	L"Function PlotManager.BioAutoConditionals.F672",
+	L"Function PlotManager.BioAutoConditionals.F671",
+	L"Function PlotManager.BioAutoConditionals.F1002",
+	L"Function PlotManager.BioAutoConditionals.F947",
+	L"Function PlotManager.BioAutoConditionals.F1494",
+	L"Function PlotManager.BioAutoConditionals.F598",
+	L"Function PlotManager.BioAutoConditionals.F1265",
+	L"Function PlotManager.BioAutoConditionals.F1264",
+	L"Function PlotManager.BioAutoConditionals.F880",
+	L"Function PlotManager.BioAutoConditionals.F1616",
+	L"Function PlotManager.BioAutoConditionals.F1615",
+	L"Function PlotManager.BioAutoConditionals.F1614",
+	L"Function PlotManager.BioAutoConditionals.F1613",
+	L"Function PlotManager.BioAutoConditionals.F1612",
+	L"Function PlotManager.BioAutoConditionals.F1611",
+	L"Function PlotManager.BioAutoConditionals.F1610",
+	L"Function PlotManager.BioAutoConditionals.F1609",
+	L"Function PlotManager.BioAutoConditionals.F1608",
+	L"Function PlotManager.BioAutoConditionals.F1607",
+	L"Function PlotManager.BioAutoConditionals.F1605",
+	L"Function PlotManager.BioAutoConditionals.F1604",
+	L"Function PlotManager.BioAutoConditionals.F1603",
+	L"Function PlotManager.BioAutoConditionals.F1602",
+	L"Function PlotManager.BioAutoConditionals.F1701",
+	L"Function PlotManager.BioAutoConditionals.F1700",
+	L"Function PlotManager.BioAutoConditionals.F1699",
+	L"Function PlotManager.BioAutoConditionals.F1698",
+	L"Function PlotManager.BioAutoConditionals.F1697",
+	L"Function PlotManager.BioAutoConditionals.F1696",
+	L"Function PlotManager.BioAutoConditionals.F1695",
+	L"Function PlotManager.BioAutoConditionals.F1694",
+	L"Function PlotManager.BioAutoConditionals.F1693",
+	L"Function PlotManager.BioAutoConditionals.F1692",
+	L"Function PlotManager.BioAutoConditionals.F1691",
+	L"Function PlotManager.BioAutoConditionals.F1690",
+	L"Function PlotManager.BioAutoConditionals.F1689",
+	L"Function PlotManager.BioAutoConditionals.F1688",
+	L"Function PlotManager.BioAutoConditionals.F1687",
+	L"Function PlotManager.BioAutoConditionals.F1686",
+	L"Function PlotManager.BioAutoConditionals.F1685",
+	L"Function PlotManager.BioAutoConditionals.F1684",
+	L"Function PlotManager.BioAutoConditionals.F1683",
+	L"Function PlotManager.BioAutoConditionals.F1682",
+	L"Function PlotManager.BioAutoConditionals.F1681",
+	L"Function PlotManager.BioAutoConditionals.F1680",
+	L"Function PlotManager.BioAutoConditionals.F1679",
+	L"Function PlotManager.BioAutoConditionals.F1678",
+	L"Function PlotManager.BioAutoConditionals.F1677",
+	L"Function PlotManager.BioAutoConditionals.F1676",
+	L"Function PlotManager.BioAutoConditionals.F1675",
+	L"Function PlotManager.BioAutoConditionals.F1674",
+	L"Function PlotManager.BioAutoConditionals.F1575",
+	L"Function PlotManager.BioAutoConditionals.F1574",
+	L"Function PlotManager.BioAutoConditionals.F1573",
+	L"Function PlotManager.BioAutoConditionals.F1572",
+	L"Function PlotManager.BioAutoConditionals.F1571",
+	L"Function PlotManager.BioAutoConditionals.F1570",
+	L"Function PlotManager.BioAutoConditionals.F1569",
+	L"Function PlotManager.BioAutoConditionals.F1568",
+	L"Function PlotManager.BioAutoConditionals.F1567",
+	L"Function PlotManager.BioAutoConditionals.F1702",
+	L"Function PlotManager.BioAutoConditionals.F1673",
+	L"Function PlotManager.BioAutoConditionals.F1672",
+	L"Function PlotManager.BioAutoConditionals.F1631",
+	L"Function PlotManager.BioAutoConditionals.F1547",
+	L"Function PlotManager.BioAutoConditionals.F1546",
+	L"Function PlotManager.BioAutoConditionals.F1545",
+	L"Function PlotManager.BioAutoConditionals.F1544",
+	L"Function PlotManager.BioAutoConditionals.F1543",
+	L"Function PlotManager.BioAutoConditionals.F1542",
+	L"Function PlotManager.BioAutoConditionals.F1541",
+	L"Function PlotManager.BioAutoConditionals.F1532",
+	L"Function PlotManager.BioAutoConditionals.F1564",
+	L"Function PlotManager.BioAutoConditionals.F1563",
+	L"Function PlotManager.BioAutoConditionals.F1562",
+	L"Function PlotManager.BioAutoConditionals.F1552",
+	L"Function PlotManager.BioAutoConditionals.F1551",
+	L"Function PlotManager.BioAutoConditionals.F1540",
+	L"Function PlotManager.BioAutoConditionals.F1539",
+	L"Function PlotManager.BioAutoConditionals.F1538",
+	L"Function PlotManager.BioAutoConditionals.F1537",
+	L"Function PlotManager.BioAutoConditionals.F1536",
+	L"Function PlotManager.BioAutoConditionals.F1535",
+	L"Function PlotManager.BioAutoConditionals.F1526",
+	L"Function PlotManager.BioAutoConditionals.F1525",
+	L"Function PlotManager.BioAutoConditionals.F1524",
+	L"Function PlotManager.BioAutoConditionals.F1523",
+	L"Function PlotManager.BioAutoConditionals.F1149",
+	L"Function PlotManager.BioAutoConditionals.F1148",
+	L"Function PlotManager.BioAutoConditionals.F1150",
+	L"Function PlotManager.BioAutoConditionals.F1154",
+	L"Function PlotManager.BioAutoConditionals.F1153",
+	L"Function PlotManager.BioAutoConditionals.F1152",
+	L"Function PlotManager.BioAutoConditionals.F1151",
+	L"Function PlotManager.BioAutoConditionals.F1146",
+	L"Function PlotManager.BioAutoConditionals.F1145",
+	L"Function PlotManager.BioAutoConditionals.F1144",
+	L"Function PlotManager.BioAutoConditionals.F1143",
+	L"Function PlotManager.BioAutoConditionals.F1142",
+	L"Function PlotManager.BioAutoConditionals.F1141",
+	L"Function PlotManager.BioAutoConditionals.F1140",
+	L"Function PlotManager.BioAutoConditionals.F1139",
+	L"Function PlotManager.BioAutoConditionals.F1138",
+	L"Function PlotManager.BioAutoConditionals.F1135",
+	L"Function PlotManager.BioAutoConditionals.F1134",
+	L"Function PlotManager.BioAutoConditionals.F1133",
+	L"Function PlotManager.BioAutoConditionals.F1497",
+	L"Function PlotManager.BioAutoConditionals.F1101",
+	L"Function PlotManager.BioAutoConditionals.F1100",
+	L"Function PlotManager.BioAutoConditionals.F1097",
+	L"Function PlotManager.BioAutoConditionals.F1088",
+	L"Function PlotManager.BioAutoConditionals.F1087",
+	L"Function PlotManager.BioAutoConditionals.F1085",
+	L"Function PlotManager.BioAutoConditionals.F1084",
+	L"Function PlotManager.BioAutoConditionals.F1083",
+	L"Function PlotManager.BioAutoConditionals.F1082",
+	L"Function PlotManager.BioAutoConditionals.F1076",
+	L"Function PlotManager.BioAutoConditionals.F1744",
+	L"Function PlotManager.BioAutoConditionals.F1662",
+	L"Function PlotManager.BioAutoConditionals.F1661",
+	L"Function PlotManager.BioAutoConditionals.F1660",
+	L"Function PlotManager.BioAutoConditionals.F1659",
+	L"Function PlotManager.BioAutoConditionals.F1211",
+	L"Function PlotManager.BioAutoConditionals.F1210",
+	L"Function PlotManager.BioAutoConditionals.F1209",
+	L"Function PlotManager.BioAutoConditionals.F1208",
+	L"Function PlotManager.BioAutoConditionals.F1207",
+	L"Function PlotManager.BioAutoConditionals.F1206",
+	L"Function PlotManager.BioAutoConditionals.F1713",
+	L"Function PlotManager.BioAutoConditionals.F1711",
+	L"Function PlotManager.BioAutoConditionals.F1630",
+	L"Function PlotManager.BioAutoConditionals.F1629",
+	L"Function PlotManager.BioAutoConditionals.F1628",
+	L"Function PlotManager.BioAutoConditionals.F1627",
+	L"Function PlotManager.BioAutoConditionals.F1626",
+	L"Function PlotManager.BioAutoConditionals.F1625",
+	L"Function PlotManager.BioAutoConditionals.F1412",
+	L"Function PlotManager.BioAutoConditionals.F1411",
+	L"Function PlotManager.BioAutoConditionals.F1066",
+	L"Function PlotManager.BioAutoConditionals.F1042",
+	L"Function PlotManager.BioAutoConditionals.F833",
+	L"Function PlotManager.BioAutoConditionals.F791",
+	L"Function PlotManager.BioAutoConditionals.F901",
+	L"Function PlotManager.BioAutoConditionals.F916",
+	L"Function PlotManager.BioAutoConditionals.F908",
+	L"Function PlotManager.BioAutoConditionals.F907",
+	L"Function PlotManager.BioAutoConditionals.F906",
+	L"Function PlotManager.BioAutoConditionals.F931",
+	L"Function PlotManager.BioAutoConditionals.F922",
+	L"Function PlotManager.BioAutoConditionals.F921",
+	L"Function PlotManager.BioAutoConditionals.F920",
+	L"Function PlotManager.BioAutoConditionals.F855",
+	L"Function PlotManager.BioAutoConditionals.F852",
+	L"Function PlotManager.BioAutoConditionals.F851",
+	L"Function PlotManager.BioAutoConditionals.F848",
+	L"Function PlotManager.BioAutoConditionals.F839",
+	L"Function PlotManager.BioAutoConditionals.F831",
+	L"Function PlotManager.BioAutoConditionals.F810",
+	L"Function PlotManager.BioAutoConditionals.F914",
+	L"Function PlotManager.BioAutoConditionals.F913",
+	L"Function PlotManager.BioAutoConditionals.F912",
+	L"Function PlotManager.BioAutoConditionals.F911",
+	L"Function PlotManager.BioAutoConditionals.F918",
+	L"Function PlotManager.BioAutoConditionals.F917",
+	L"Function PlotManager.BioAutoConditionals.F928",
+	L"Function PlotManager.BioAutoConditionals.F927",
+	L"Function PlotManager.BioAutoConditionals.F1213",
+	L"Function PlotManager.BioAutoConditionals.F1114",
+	L"Function PlotManager.BioAutoConditionals.F935",
+	L"Function PlotManager.BioAutoConditionals.F934",
+	L"Function PlotManager.BioAutoConditionals.F932",
+	L"Function PlotManager.BioAutoConditionals.F930",
+	L"Function PlotManager.BioAutoConditionals.F929",
+	L"Function PlotManager.BioAutoConditionals.F1212",
+	L"Function PlotManager.BioAutoConditionals.F1374",
+	L"Function PlotManager.BioAutoConditionals.F946",
+	L"Function PlotManager.BioAutoConditionals.F945",
+	L"Function PlotManager.BioAutoConditionals.F944",
+	L"Function PlotManager.BioAutoConditionals.F943",
+	L"Function PlotManager.BioAutoConditionals.F942",
+	L"Function PlotManager.BioAutoConditionals.F941",
+	L"Function PlotManager.BioAutoConditionals.F940",
+	L"Function PlotManager.BioAutoConditionals.F939",
+	L"Function PlotManager.BioAutoConditionals.F938",
+	L"Function PlotManager.BioAutoConditionals.F937",
+	L"Function PlotManager.BioAutoConditionals.F936",
+	L"Function PlotManager.BioAutoConditionals.F933",
+	L"Function PlotManager.BioAutoConditionals.F850",
+	L"Function PlotManager.BioAutoConditionals.F847",
+	L"Function PlotManager.BioAutoConditionals.F846",
+	L"Function PlotManager.BioAutoConditionals.F808",
+	L"Function PlotManager.BioAutoConditionals.F806",
+	L"Function PlotManager.BioAutoConditionals.F710",
+	L"Function PlotManager.BioAutoConditionals.F709",
+	L"Function PlotManager.BioAutoConditionals.F2012",
+	L"Function PlotManager.BioAutoConditionals.F1601",
+	L"Function PlotManager.BioAutoConditionals.F1600",
+	L"Function PlotManager.BioAutoConditionals.F1078",
+	L"Function PlotManager.BioAutoConditionals.F1077",
+	L"Function PlotManager.BioAutoConditionals.F1074",
+	L"Function PlotManager.BioAutoConditionals.F1073",
+	L"Function PlotManager.BioAutoConditionals.F1072",
+	L"Function PlotManager.BioAutoConditionals.F1071",
+	L"Function PlotManager.BioAutoConditionals.F1070",
+	L"Function PlotManager.BioAutoConditionals.F1069",
+	L"Function PlotManager.BioAutoConditionals.F1068",
+	L"Function PlotManager.BioAutoConditionals.F1599",
+	L"Function PlotManager.BioAutoConditionals.F1189",
+	L"Function PlotManager.BioAutoConditionals.F1188",
+	L"Function PlotManager.BioAutoConditionals.F1187",
+	L"Function PlotManager.BioAutoConditionals.F830",
+	L"Function PlotManager.BioAutoConditionals.F829",
+	L"Function PlotManager.BioAutoConditionals.F828",
+	L"Function PlotManager.BioAutoConditionals.F827",
+	L"Function PlotManager.BioAutoConditionals.F826",
+	L"Function PlotManager.BioAutoConditionals.F825",
+	L"Function PlotManager.BioAutoConditionals.F824",
+	L"Function PlotManager.BioAutoConditionals.F823",
+	L"Function PlotManager.BioAutoConditionals.F822",
+	L"Function PlotManager.BioAutoConditionals.F821",
+	L"Function PlotManager.BioAutoConditionals.F820",
+	L"Function PlotManager.BioAutoConditionals.F819",
+	L"Function PlotManager.BioAutoConditionals.F818",
+	L"Function PlotManager.BioAutoConditionals.F817",
+	L"Function PlotManager.BioAutoConditionals.F816",
+	L"Function PlotManager.BioAutoConditionals.F815",
+	L"Function PlotManager.BioAutoConditionals.F814",
+	L"Function PlotManager.BioAutoConditionals.F813",
+	L"Function PlotManager.BioAutoConditionals.F812",
+	L"Function PlotManager.BioAutoConditionals.F811",
+	L"Function PlotManager.BioAutoConditionals.F692",
+	L"Function PlotManager.BioAutoConditionals.F536",
+	L"Function PlotManager.BioAutoConditionals.F879",
+	L"Function PlotManager.BioAutoConditionals.F1671",
+	L"Function PlotManager.BioAutoConditionals.F1226",
+	L"Function PlotManager.BioAutoConditionals.F981",
+	L"Function PlotManager.BioAutoConditionals.F1009",
+	L"Function PlotManager.BioAutoConditionals.F1008",
+	L"Function PlotManager.BioAutoConditionals.F1007",
+	L"Function PlotManager.BioAutoConditionals.F1004",
+	L"Function PlotManager.BioAutoConditionals.F1065",
+	L"Function PlotManager.BioAutoConditionals.F1037",
+	L"Function PlotManager.BioAutoConditionals.F1036",
+	L"Function PlotManager.BioAutoConditionals.F1035",
+	L"Function PlotManager.BioAutoConditionals.F1402",
+	L"Function PlotManager.BioAutoConditionals.F1495",
+	L"Function PlotManager.BioAutoConditionals.F836",
+	L"Function PlotManager.BioAutoConditionals.F794",
+	L"Function PlotManager.BioAutoConditionals.F898",
+	L"Function PlotManager.BioAutoConditionals.F755",
+	L"Function PlotManager.BioAutoConditionals.F699",
+	L"Function PlotManager.BioAutoConditionals.F675",
+	L"Function PlotManager.BioAutoConditionals.F638",
+	L"Function PlotManager.BioAutoConditionals.F637",
+	L"Function PlotManager.BioAutoConditionals.F244",
+	L"Function PlotManager.BioAutoConditionals.F1853",
+	L"Function PlotManager.BioAutoConditionals.F1530",
+	L"Function PlotManager.BioAutoConditionals.F1157",
+	L"Function PlotManager.BioAutoConditionals.F856",
+	L"Function PlotManager.BioAutoConditionals.F138",
+	L"Function PlotManager.BioAutoConditionals.F115",
+	L"Function PlotManager.BioAutoConditionals.F113",
+	L"Function PlotManager.BioAutoConditionals.F834",
+	L"Function PlotManager.BioAutoConditionals.F809",
+	L"Function PlotManager.BioAutoConditionals.F561",
+	L"Function PlotManager.BioAutoConditionals.F1032",
+	L"Function PlotManager.BioAutoConditionals.F1019",
+	L"Function PlotManager.BioAutoConditionals.F1018",
+	L"Function PlotManager.BioAutoConditionals.F886",
+	L"Function PlotManager.BioAutoConditionals.F770",
+	L"Function PlotManager.BioAutoConditionals.F482",
+	L"Function PlotManager.BioAutoConditionals.F419",
+	L"Function PlotManager.BioAutoConditionals.F1852",
+	L"Function PlotManager.BioAutoConditionals.F1851",
+	L"Function PlotManager.BioAutoConditionals.F1850",
+	L"Function PlotManager.BioAutoConditionals.F1849",
+	L"Function PlotManager.BioAutoConditionals.F1844",
+	L"Function PlotManager.BioAutoConditionals.F1843",
+	L"Function PlotManager.BioAutoConditionals.F1842",
+	L"Function PlotManager.BioAutoConditionals.F1841",
+	L"Function PlotManager.BioAutoConditionals.F1840",
+	L"Function PlotManager.BioAutoConditionals.F1838",
+	L"Function PlotManager.BioAutoConditionals.F1837",
+	L"Function PlotManager.BioAutoConditionals.F1836",
+	L"Function PlotManager.BioAutoConditionals.F1835",
+	L"Function PlotManager.BioAutoConditionals.F1642",
+	L"Function PlotManager.BioAutoConditionals.F1641",
+	L"Function PlotManager.BioAutoConditionals.F1640",
+	L"Function PlotManager.BioAutoConditionals.F1760",
+	L"Function PlotManager.BioAutoConditionals.F1757",
+	L"Function PlotManager.BioAutoConditionals.F1752",
+	L"Function PlotManager.BioAutoConditionals.F1113",
+	L"Function PlotManager.BioAutoConditionals.F1112",
+	L"Function PlotManager.BioAutoConditionals.F779",
+	L"Function PlotManager.BioAutoConditionals.F739",
+	L"Function PlotManager.BioAutoConditionals.F738",
+	L"Function PlotManager.BioAutoConditionals.F693",
+	L"Function PlotManager.BioAutoConditionals.F691",
+	L"Function PlotManager.BioAutoConditionals.F582",
+	L"Function PlotManager.BioAutoConditionals.F581",
+	L"Function PlotManager.BioAutoConditionals.F580",
+	L"Function PlotManager.BioAutoConditionals.F579",
+	L"Function PlotManager.BioAutoConditionals.F578",
+	L"Function PlotManager.BioAutoConditionals.F577",
+	L"Function PlotManager.BioAutoConditionals.F576",
+	L"Function PlotManager.BioAutoConditionals.F573",
+	L"Function PlotManager.BioAutoConditionals.F342",
+	L"Function PlotManager.BioAutoConditionals.F338",
+	L"Function PlotManager.BioAutoConditionals.F337",
+	L"Function PlotManager.BioAutoConditionals.F332",
+	L"Function PlotManager.BioAutoConditionals.F318",
+	L"Function PlotManager.BioAutoConditionals.F317",
+	L"Function PlotManager.BioAutoConditionals.F316",
+	L"Function PlotManager.BioAutoConditionals.F315",
+	L"Function PlotManager.BioAutoConditionals.F314",
+	L"Function PlotManager.BioAutoConditionals.F309",
+	L"Function PlotManager.BioAutoConditionals.F308",
+	L"Function PlotManager.BioAutoConditionals.F307",
+	L"Function PlotManager.BioAutoConditionals.F306",
+	L"Function PlotManager.BioAutoConditionals.F305",
+	L"Function PlotManager.BioAutoConditionals.F304",
+	L"Function PlotManager.BioAutoConditionals.F303",
+	L"Function PlotManager.BioAutoConditionals.F302",
+	L"Function PlotManager.BioAutoConditionals.F301",
+	L"Function PlotManager.BioAutoConditionals.F312",
+	L"Function PlotManager.BioAutoConditionals.F298",
+	L"Function PlotManager.BioAutoConditionals.F136",
+	L"Function PlotManager.BioAutoConditionals.F135",
+	L"Function PlotManager.BioAutoConditionals.F139",
+	L"Function PlotManager.BioAutoConditionals.F1549",
+	L"Function PlotManager.BioAutoConditionals.F1548",
+	L"Function PlotManager.BioAutoConditionals.F704",
+	L"Function PlotManager.BioAutoConditionals.F948",
+	L"Function PlotManager.BioAutoConditionals.F1332",
+	L"Function PlotManager.BioAutoConditionals.F1331",
+	L"Function PlotManager.BioAutoConditionals.F1330",
+	L"Function PlotManager.BioAutoConditionals.F1329",
+	L"Function PlotManager.BioAutoConditionals.F1328",
+	L"Function PlotManager.BioAutoConditionals.F1327",
+	L"Function PlotManager.BioAutoConditionals.F1326",
+	L"Function PlotManager.BioAutoConditionals.F1325",
+	L"Function PlotManager.BioAutoConditionals.F1324",
+	L"Function PlotManager.BioAutoConditionals.F1169",
+	L"Function PlotManager.BioAutoConditionals.F1168",
+	L"Function PlotManager.BioAutoConditionals.F1167",
+	L"Function PlotManager.BioAutoConditionals.F1166",
+	L"Function PlotManager.BioAutoConditionals.F1165",
+	L"Function PlotManager.BioAutoConditionals.F1164",
+	L"Function PlotManager.BioAutoConditionals.F1163",
+	L"Function PlotManager.BioAutoConditionals.F1162",
+	L"Function PlotManager.BioAutoConditionals.F1161",
+	L"Function PlotManager.BioAutoConditionals.F1160",
+	L"Function PlotManager.BioAutoConditionals.F1159",
+	L"Function PlotManager.BioAutoConditionals.F1158",
+	L"Function PlotManager.BioAutoConditionals.F670",
+	L"Function PlotManager.BioAutoConditionals.F669",
+	L"Function PlotManager.BioAutoConditionals.F651",
+	L"Function PlotManager.BioAutoConditionals.F1668",
+	L"Function PlotManager.BioAutoConditionals.F1667",
+	L"Function PlotManager.BioAutoConditionals.F1666",
+	L"Function PlotManager.BioAutoConditionals.F1665",
+	L"Function PlotManager.BioAutoConditionals.F1664",
+	L"Function PlotManager.BioAutoConditionals.F1060",
+	L"Function PlotManager.BioAutoConditionals.F698",
+	L"Function PlotManager.BioAutoConditionals.F697",
+	L"Function PlotManager.BioAutoConditionals.F696",
+	L"Function PlotManager.BioAutoConditionals.F695",
+	L"Function PlotManager.BioAutoConditionals.F694",
+	L"Function PlotManager.BioAutoConditionals.F1527",
+	L"Function PlotManager.BioAutoConditionals.F1534",
+	L"Function PlotManager.BioAutoConditionals.F1291",
+	L"Function PlotManager.BioAutoConditionals.F1290",
+	L"Function PlotManager.BioAutoConditionals.F1289",
+	L"Function PlotManager.BioAutoConditionals.F975",
+	L"Function PlotManager.BioAutoConditionals.F974",
+	L"Function PlotManager.BioAutoConditionals.F881",
+	L"Function PlotManager.BioAutoConditionals.F550",
+	L"Function PlotManager.BioAutoConditionals.F481",
+	L"Function PlotManager.BioAutoConditionals.F480",
+	L"Function PlotManager.BioAutoConditionals.F418",
+	L"Function PlotManager.BioAutoConditionals.F416",
+	L"Function PlotManager.BioAutoConditionals.F415",
+	L"Function PlotManager.BioAutoConditionals.F170",
+	L"Function PlotManager.BioAutoConditionals.F169",
+	L"Function PlotManager.BioAutoConditionals.F160",
+	L"Function PlotManager.BioAutoConditionals.F159",
+	L"Function PlotManager.BioAutoConditionals.F158",
+	L"Function PlotManager.BioAutoConditionals.F157",
+	L"Function PlotManager.BioAutoConditionals.F156",
+	L"Function PlotManager.BioAutoConditionals.F155",
+	L"Function PlotManager.BioAutoConditionals.F154",
+	L"Function PlotManager.BioAutoConditionals.F152",
+	L"Function PlotManager.BioAutoConditionals.F149",
+	L"Function PlotManager.BioAutoConditionals.F148",
+	L"Function PlotManager.BioAutoConditionals.F146",
+	L"Function PlotManager.BioAutoConditionals.F145",
+	L"Function PlotManager.BioAutoConditionals.F144",
+	L"Function PlotManager.BioAutoConditionals.F143",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
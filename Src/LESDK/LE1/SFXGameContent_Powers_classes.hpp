@@ -89,7 +89,7 @@ class UBioPowerScriptDesign : public UBioPowerScript
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -148,7 +148,7 @@ class UBioAdrenalineScript : public UBioPowerScriptDesign
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -164,7 +164,7 @@ class UBioBarrierScript : public UBioPowerScriptDesign
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -183,7 +183,7 @@ public:
 	float                                              m_fForce;                                         		// 0x0098 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -200,7 +200,7 @@ class UBioCarnageSetupScript : public UBioPowerScriptDesign
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -222,7 +222,7 @@ public:
 	unsigned long                                      m_bSnapToGround : 1;                              		// 0x00A4 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -240,7 +240,7 @@ class UBioDampingBeacon : public UBioSpawnBeacon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -263,7 +263,7 @@ public:
 	unsigned long                                      m_bDampenCombat : 1;                              		// 0x0098 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -281,7 +281,7 @@ public:
 	class UBioDamageType*                              m_oSuicideDamageType;                             		// 0x009C (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -297,7 +297,7 @@ class UBioEMPBeacon : public UBioSpawnBeacon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -319,7 +319,7 @@ public:
 	float                                              m_fDuration;                                      		// 0x00A8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -337,7 +337,7 @@ public:
 	class UBioDamageType*                              m_oSuicideDamageType;                             		// 0x00AC (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -360,7 +360,7 @@ public:
 	unsigned long                                      m_bIgnorePlaceables : 1;                          		// 0x0080 (0x0004) [0x0000000000000000] [0x00000040] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -380,7 +380,7 @@ public:
 	float                                              m_fForce;                                         		// 0x0098 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -400,7 +400,7 @@ public:
 	float                                              m_fSubBossMult;                                   		// 0x0088 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -424,7 +424,7 @@ public:
 	unsigned long                                      m_bHealsMachines : 1;                             		// 0x0094 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -440,7 +440,7 @@ class UBioHealSelfScript : public UBioHealScript
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -462,7 +462,7 @@ public:
 	float                                              m_fRezHealthPct;                                  		// 0x0094 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -483,7 +483,7 @@ class UBioHexBarrierScript : public UBioPowerScriptDesign
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -498,7 +498,7 @@ class UBioImmunityScript : public UBioPowerScriptDesign
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -518,7 +518,7 @@ public:
 	float                                              m_fDamage;                                        		// 0x0098 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -539,7 +539,7 @@ public:
 	int                                                m_nPhysicsLevel;                                  		// 0x008C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -556,7 +556,7 @@ public:
 	float                                              m_fPawnDurationMult;                              		// 0x0090 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -571,7 +571,7 @@ class UBioMarksmanScript : public UBioPowerScriptDesign
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -593,7 +593,7 @@ public:
 	float                                              m_fPushDamage;                                    		// 0x009C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -610,7 +610,7 @@ class UBioOverkillScript : public UBioPowerScriptDesign
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -626,7 +626,7 @@ class UBioRegenBurstScript : public UBioPowerScriptDesign
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -644,7 +644,7 @@ public:
 	float                                              m_fRepairInterval;                                		// 0x0088 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -662,7 +662,7 @@ class UBioSabotageBeacon : public UBioSpawnBeacon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -682,7 +682,7 @@ public:
 	float                                              m_fDamagePerSecond;                               		// 0x009C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -700,7 +700,7 @@ public:
 	class UBioDamageType*                              m_oSuicideDamageType;                             		// 0x00A0 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -718,7 +718,7 @@ public:
 	float                                              m_fShieldPercentPerSecond;                        		// 0x0084 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -738,7 +738,7 @@ public:
 	float                                              m_fShieldsPerInterval;                            		// 0x0088 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -758,7 +758,7 @@ public:
 	float                                              m_fForce;                                         		// 0x0098 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -781,7 +781,7 @@ public:
 	unsigned long                                      m_bLocationSet : 1;                               		// 0x009C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -803,7 +803,7 @@ public:
 	float                                              m_fDamage;                                        		// 0x0098 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -820,7 +820,7 @@ class UBioSniperCritScript : public UBioPowerScriptDesign
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -838,7 +838,7 @@ public:
 	unsigned long                                      m_bAllowDamage : 1;                               		// 0x0084 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -854,7 +854,7 @@ class UBioTakeDownScript : public UBioPowerScriptDesign
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -874,7 +874,7 @@ public:
 	float                                              m_fDamage;                                        		// 0x0094 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -896,7 +896,7 @@ public:
 	int                                                m_nPhysicsLevel;                                  		// 0x009C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -922,7 +922,7 @@ public:
 	float                                              m_fDamageMultiplier;                              		// 0x00B0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -941,7 +941,7 @@ public:
 	float                                              m_fDamage;                                        		// 0x0088 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -959,7 +959,7 @@ public:
 	class UBioDamageType*                              m_oSuicideDamageType;                             		// 0x008C (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -975,7 +975,7 @@ class UBioUnityScript : public UBioPowerScriptDesign
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -996,7 +996,7 @@ public:
 	float                                              m_fDamageMultiplier;                              		// 0x0090 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1019,7 +1019,7 @@ public:
 	float                                              m_fType;                                          		// 0x00A4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1036,7 +1036,7 @@ class UBioHealMachineScript : public UBioHealScript
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
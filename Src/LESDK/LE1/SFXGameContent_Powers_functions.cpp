@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioPowerScriptDesign::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioPowerScriptDesign::pClassPointer { L"Class SFXGameContent_Powers.BioPowerScriptDesign", &UObject::FindClass };
 
 class UClass* UBioPowerScriptDesign::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioPowerScriptDesign" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioPowerScriptDesign.AdjustInventoryResource
@@ -48,10 +45,9 @@ class UClass* UBioPowerScriptDesign::StaticClass()
 
 bool UBioPowerScriptDesign::AdjustInventoryResource ( class AActor* oActor, unsigned char eResource, float fAmount )
 {
-	static UFunction* pFnAdjustInventoryResource = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAdjustInventoryResourceRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.AdjustInventoryResource", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAdjustInventoryResource )
-		pFnAdjustInventoryResource = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.AdjustInventoryResource" );
+	UFunction* const pFnAdjustInventoryResource = pFnAdjustInventoryResourceRef.Get ( );
 
 	UBioPowerScriptDesign_execAdjustInventoryResource_Parms AdjustInventoryResource_Parms;
 	AdjustInventoryResource_Parms.oActor = oActor;
@@ -73,10 +69,9 @@ bool UBioPowerScriptDesign::AdjustInventoryResource ( class AActor* oActor, unsi
 
 bool UBioPowerScriptDesign::EffectCarnageSetup ( class AActor* oCaster, int nNumberOfUses, float fDuration )
 {
-	static UFunction* pFnEffectCarnageSetup = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectCarnageSetupRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectCarnageSetup", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectCarnageSetup )
-		pFnEffectCarnageSetup = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectCarnageSetup" );
+	UFunction* const pFnEffectCarnageSetup = pFnEffectCarnageSetupRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectCarnageSetup_Parms EffectCarnageSetup_Parms;
 	EffectCarnageSetup_Parms.oCaster = oCaster;
@@ -97,10 +92,9 @@ bool UBioPowerScriptDesign::EffectCarnageSetup ( class AActor* oCaster, int nNum
 
 bool UBioPowerScriptDesign::InstantRegenerateShield ( class AActor* oActor, float fPercentOfShieldRegained )
 {
-	static UFunction* pFnInstantRegenerateShield = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInstantRegenerateShieldRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.InstantRegenerateShield", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInstantRegenerateShield )
-		pFnInstantRegenerateShield = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.InstantRegenerateShield" );
+	UFunction* const pFnInstantRegenerateShield = pFnInstantRegenerateShieldRef.Get ( );
 
 	UBioPowerScriptDesign_execInstantRegenerateShield_Parms InstantRegenerateShield_Parms;
 	InstantRegenerateShield_Parms.oActor = oActor;
@@ -124,10 +118,9 @@ bool UBioPowerScriptDesign::InstantRegenerateShield ( class AActor* oActor, floa
 
 bool UBioPowerScriptDesign::IncreaseAllPowerCooldowns ( class AActor* oActor, float fPercentOfTotalToIncreaseBy, unsigned long bIncreaseTech, unsigned long bIncreaseBiotic, unsigned long bIncreaseWeapon, unsigned long bIncreaseCombat )
 {
-	static UFunction* pFnIncreaseAllPowerCooldowns = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIncreaseAllPowerCooldownsRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.IncreaseAllPowerCooldowns", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIncreaseAllPowerCooldowns )
-		pFnIncreaseAllPowerCooldowns = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.IncreaseAllPowerCooldowns" );
+	UFunction* const pFnIncreaseAllPowerCooldowns = pFnIncreaseAllPowerCooldownsRef.Get ( );
 
 	UBioPowerScriptDesign_execIncreaseAllPowerCooldowns_Parms IncreaseAllPowerCooldowns_Parms;
 	IncreaseAllPowerCooldowns_Parms.oActor = oActor;
@@ -150,10 +143,9 @@ bool UBioPowerScriptDesign::IncreaseAllPowerCooldowns ( class AActor* oActor, fl
 
 bool UBioPowerScriptDesign::ClearAllPowerCooldowns ( class AActor* oActor )
 {
-	static UFunction* pFnClearAllPowerCooldowns = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearAllPowerCooldownsRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.ClearAllPowerCooldowns", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearAllPowerCooldowns )
-		pFnClearAllPowerCooldowns = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.ClearAllPowerCooldowns" );
+	UFunction* const pFnClearAllPowerCooldowns = pFnClearAllPowerCooldownsRef.Get ( );
 
 	UBioPowerScriptDesign_execClearAllPowerCooldowns_Parms ClearAllPowerCooldowns_Parms;
 	ClearAllPowerCooldowns_Parms.oActor = oActor;
@@ -177,10 +169,9 @@ bool UBioPowerScriptDesign::ClearAllPowerCooldowns ( class AActor* oActor )
 
 bool UBioPowerScriptDesign::EffectSingularity ( class AActor* oCaster, class AActor* oImpacted, struct FVector const& vSingularityLocation, float fForce, float fForceInterval, float fDuration, float fBubbleRadius )
 {
-	static UFunction* pFnEffectSingularity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectSingularityRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectSingularity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectSingularity )
-		pFnEffectSingularity = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectSingularity" );
+	UFunction* const pFnEffectSingularity = pFnEffectSingularityRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectSingularity_Parms EffectSingularity_Parms;
 	EffectSingularity_Parms.oCaster = oCaster;
@@ -207,10 +198,9 @@ bool UBioPowerScriptDesign::EffectSingularity ( class AActor* oCaster, class AAc
 
 bool UBioPowerScriptDesign::EffectRagdoll ( class AActor* oCaster, class AActor* oImpacted, float fDuration, int nGroupID )
 {
-	static UFunction* pFnEffectRagdoll = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectRagdollRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectRagdoll", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectRagdoll )
-		pFnEffectRagdoll = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectRagdoll" );
+	UFunction* const pFnEffectRagdoll = pFnEffectRagdollRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectRagdoll_Parms EffectRagdoll_Parms;
 	EffectRagdoll_Parms.oCaster = oCaster;
@@ -234,10 +224,9 @@ bool UBioPowerScriptDesign::EffectRagdoll ( class AActor* oCaster, class AActor*
 
 bool UBioPowerScriptDesign::EffectEntrenchShield ( class AActor* oCaster, class AActor* oImpacted, float fShieldInc, float fDuration )
 {
-	static UFunction* pFnEffectEntrenchShield = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectEntrenchShieldRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectEntrenchShield", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectEntrenchShield )
-		pFnEffectEntrenchShield = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectEntrenchShield" );
+	UFunction* const pFnEffectEntrenchShield = pFnEffectEntrenchShieldRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectEntrenchShield_Parms EffectEntrenchShield_Parms;
 	EffectEntrenchShield_Parms.oCaster = oCaster;
@@ -262,10 +251,9 @@ bool UBioPowerScriptDesign::EffectEntrenchShield ( class AActor* oCaster, class
 
 bool UBioPowerScriptDesign::EffectRegenerateShield ( class AActor* oCaster, class AActor* oImpacted, float fAmountPerInterval, float fInterval, float fDuration )
 {
-	static UFunction* pFnEffectRegenerateShield = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectRegenerateShieldRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectRegenerateShield", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectRegenerateShield )
-		pFnEffectRegenerateShield = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectRegenerateShield" );
+	UFunction* const pFnEffectRegenerateShield = pFnEffectRegenerateShieldRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectRegenerateShield_Parms EffectRegenerateShield_Parms;
 	EffectRegenerateShield_Parms.oCaster = oCaster;
@@ -290,10 +278,9 @@ bool UBioPowerScriptDesign::EffectRegenerateShield ( class AActor* oCaster, clas
 
 bool UBioPowerScriptDesign::EffectDamageVulnerability ( class AActor* oCaster, class AActor* oImpacted, float fDamageMultiplier, float fDuration )
 {
-	static UFunction* pFnEffectDamageVulnerability = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectDamageVulnerabilityRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectDamageVulnerability", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectDamageVulnerability )
-		pFnEffectDamageVulnerability = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectDamageVulnerability" );
+	UFunction* const pFnEffectDamageVulnerability = pFnEffectDamageVulnerabilityRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectDamageVulnerability_Parms EffectDamageVulnerability_Parms;
 	EffectDamageVulnerability_Parms.oCaster = oCaster;
@@ -316,10 +303,9 @@ bool UBioPowerScriptDesign::EffectDamageVulnerability ( class AActor* oCaster, c
 
 bool UBioPowerScriptDesign::EffectRegen ( class AActor* oCaster, float fHealingFactor, float fDuration )
 {
-	static UFunction* pFnEffectRegen = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectRegenRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectRegen", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectRegen )
-		pFnEffectRegen = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectRegen" );
+	UFunction* const pFnEffectRegen = pFnEffectRegenRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectRegen_Parms EffectRegen_Parms;
 	EffectRegen_Parms.oCaster = oCaster;
@@ -342,10 +328,9 @@ bool UBioPowerScriptDesign::EffectRegen ( class AActor* oCaster, float fHealingF
 
 bool UBioPowerScriptDesign::EffectHealInstant ( class AActor* oCaster, class AActor* oImpacted, float fHealth, float fToxic )
 {
-	static UFunction* pFnEffectHealInstant = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectHealInstantRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectHealInstant", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectHealInstant )
-		pFnEffectHealInstant = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectHealInstant" );
+	UFunction* const pFnEffectHealInstant = pFnEffectHealInstantRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectHealInstant_Parms EffectHealInstant_Parms;
 	EffectHealInstant_Parms.oCaster = oCaster;
@@ -371,10 +356,9 @@ bool UBioPowerScriptDesign::EffectHealInstant ( class AActor* oCaster, class AAc
 
 bool UBioPowerScriptDesign::EffectHeal ( class AActor* oCaster, class AActor* oImpacted, float fHealthPerInterval, float fToxicPerInterval, float fInterval, float fDuration )
 {
-	static UFunction* pFnEffectHeal = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectHealRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectHeal", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectHeal )
-		pFnEffectHeal = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectHeal" );
+	UFunction* const pFnEffectHeal = pFnEffectHealRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectHeal_Parms EffectHeal_Parms;
 	EffectHeal_Parms.oCaster = oCaster;
@@ -403,10 +387,9 @@ bool UBioPowerScriptDesign::EffectHeal ( class AActor* oCaster, class AActor* oI
 
 bool UBioPowerScriptDesign::EffectCombatBoost ( class AActor* oCaster, class AActor* oImpacted, float fDuration, float fDmgDurBonus, float fRegenBonus, float fSuppResistBonus, float fMobilityBonus )
 {
-	static UFunction* pFnEffectCombatBoost = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectCombatBoostRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectCombatBoost", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectCombatBoost )
-		pFnEffectCombatBoost = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectCombatBoost" );
+	UFunction* const pFnEffectCombatBoost = pFnEffectCombatBoostRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectCombatBoost_Parms EffectCombatBoost_Parms;
 	EffectCombatBoost_Parms.oCaster = oCaster;
@@ -432,10 +415,9 @@ bool UBioPowerScriptDesign::EffectCombatBoost ( class AActor* oCaster, class AAc
 
 bool UBioPowerScriptDesign::EffectImmunity ( class AActor* oCaster, float fDuration, float fDamageResistBonus )
 {
-	static UFunction* pFnEffectImmunity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectImmunityRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectImmunity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectImmunity )
-		pFnEffectImmunity = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectImmunity" );
+	UFunction* const pFnEffectImmunity = pFnEffectImmunityRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectImmunity_Parms EffectImmunity_Parms;
 	EffectImmunity_Parms.oCaster = oCaster;
@@ -460,10 +442,9 @@ bool UBioPowerScriptDesign::EffectImmunity ( class AActor* oCaster, float fDurat
 
 bool UBioPowerScriptDesign::EffectSniperCritical ( class AActor* oCaster, float fDuration, float fDamageBonus, float fStunDuration, float fMaxDriftRed, float fMinDriftRed )
 {
-	static UFunction* pFnEffectSniperCritical = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectSniperCriticalRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectSniperCritical", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectSniperCritical )
-		pFnEffectSniperCritical = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectSniperCritical" );
+	UFunction* const pFnEffectSniperCritical = pFnEffectSniperCriticalRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectSniperCritical_Parms EffectSniperCritical_Parms;
 	EffectSniperCritical_Parms.oCaster = oCaster;
@@ -491,10 +472,9 @@ bool UBioPowerScriptDesign::EffectSniperCritical ( class AActor* oCaster, float
 
 bool UBioPowerScriptDesign::EffectOverkill ( class AActor* oCaster, float fDuration, float fSuppDamage, float fKickbackRed, float fHeatRed, float fDamageBonus )
 {
-	static UFunction* pFnEffectOverkill = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectOverkillRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectOverkill", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectOverkill )
-		pFnEffectOverkill = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectOverkill" );
+	UFunction* const pFnEffectOverkill = pFnEffectOverkillRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectOverkill_Parms EffectOverkill_Parms;
 	EffectOverkill_Parms.oCaster = oCaster;
@@ -523,10 +503,9 @@ bool UBioPowerScriptDesign::EffectOverkill ( class AActor* oCaster, float fDurat
 
 bool UBioPowerScriptDesign::EffectMarksman ( class AActor* oCaster, float fDuration, float fMaxDriftRed, float fMinDriftRed, float fDamageBonus, float fRPSBonus, float fHeatRed )
 {
-	static UFunction* pFnEffectMarksman = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectMarksmanRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectMarksman", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectMarksman )
-		pFnEffectMarksman = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectMarksman" );
+	UFunction* const pFnEffectMarksman = pFnEffectMarksmanRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectMarksman_Parms EffectMarksman_Parms;
 	EffectMarksman_Parms.oCaster = oCaster;
@@ -553,10 +532,9 @@ bool UBioPowerScriptDesign::EffectMarksman ( class AActor* oCaster, float fDurat
 
 bool UBioPowerScriptDesign::EffectCorrosion ( class AActor* oImpacted, class AActor* oCaster, float fCorrosion, float fDuration )
 {
-	static UFunction* pFnEffectCorrosion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectCorrosionRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectCorrosion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectCorrosion )
-		pFnEffectCorrosion = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectCorrosion" );
+	UFunction* const pFnEffectCorrosion = pFnEffectCorrosionRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectCorrosion_Parms EffectCorrosion_Parms;
 	EffectCorrosion_Parms.oImpacted = oImpacted;
@@ -579,10 +557,9 @@ bool UBioPowerScriptDesign::EffectCorrosion ( class AActor* oImpacted, class AAc
 
 bool UBioPowerScriptDesign::EffectSuppressingFire ( class AActor* oCaster, float fDuration, float fDriftInc )
 {
-	static UFunction* pFnEffectSuppressingFire = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectSuppressingFireRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectSuppressingFire", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectSuppressingFire )
-		pFnEffectSuppressingFire = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectSuppressingFire" );
+	UFunction* const pFnEffectSuppressingFire = pFnEffectSuppressingFireRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectSuppressingFire_Parms EffectSuppressingFire_Parms;
 	EffectSuppressingFire_Parms.oCaster = oCaster;
@@ -608,10 +585,9 @@ bool UBioPowerScriptDesign::EffectSuppressingFire ( class AActor* oCaster, float
 
 bool UBioPowerScriptDesign::EffectZeroGLift ( class AActor* oImpacted, class AActor* oCaster, float fDuration, float fLiftForce, float fLiftDistance, float fDeceleration, float fMinVelocity )
 {
-	static UFunction* pFnEffectZeroGLift = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectZeroGLiftRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectZeroGLift", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectZeroGLift )
-		pFnEffectZeroGLift = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectZeroGLift" );
+	UFunction* const pFnEffectZeroGLift = pFnEffectZeroGLiftRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectZeroGLift_Parms EffectZeroGLift_Parms;
 	EffectZeroGLift_Parms.oImpacted = oImpacted;
@@ -637,10 +613,9 @@ bool UBioPowerScriptDesign::EffectZeroGLift ( class AActor* oImpacted, class AAc
 
 bool UBioPowerScriptDesign::EffectAIHacking ( class AActor* oCaster, class AActor* oImpacted, float fDuration )
 {
-	static UFunction* pFnEffectAIHacking = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectAIHackingRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectAIHacking", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectAIHacking )
-		pFnEffectAIHacking = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectAIHacking" );
+	UFunction* const pFnEffectAIHacking = pFnEffectAIHackingRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectAIHacking_Parms EffectAIHacking_Parms;
 	EffectAIHacking_Parms.oCaster = oCaster;
@@ -667,10 +642,9 @@ bool UBioPowerScriptDesign::EffectAIHacking ( class AActor* oCaster, class AActo
 
 bool UBioPowerScriptDesign::EffectDisablePowers ( class AActor* oCaster, class AActor* oImpacted, float fDuration, int nGFXGroup, unsigned long bDisableTech, unsigned long bDisableBiotics, unsigned long bDisableWeaponPowers, unsigned long bDisableCombat )
 {
-	static UFunction* pFnEffectDisablePowers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectDisablePowersRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectDisablePowers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectDisablePowers )
-		pFnEffectDisablePowers = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectDisablePowers" );
+	UFunction* const pFnEffectDisablePowers = pFnEffectDisablePowersRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectDisablePowers_Parms EffectDisablePowers_Parms;
 	EffectDisablePowers_Parms.oCaster = oCaster;
@@ -698,10 +672,9 @@ bool UBioPowerScriptDesign::EffectDisablePowers ( class AActor* oCaster, class A
 
 bool UBioPowerScriptDesign::EffectOverheatWeapons ( class AActor* oCaster, class AActor* oImpacted, float fDuration, float fHeat )
 {
-	static UFunction* pFnEffectOverheatWeapons = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectOverheatWeaponsRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectOverheatWeapons", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectOverheatWeapons )
-		pFnEffectOverheatWeapons = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectOverheatWeapons" );
+	UFunction* const pFnEffectOverheatWeapons = pFnEffectOverheatWeaponsRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectOverheatWeapons_Parms EffectOverheatWeapons_Parms;
 	EffectOverheatWeapons_Parms.oCaster = oCaster;
@@ -725,10 +698,9 @@ bool UBioPowerScriptDesign::EffectOverheatWeapons ( class AActor* oCaster, class
 
 bool UBioPowerScriptDesign::EffectDisableWeapons ( class AActor* oCaster, class AActor* oImpacted, float fDuration, int nGFXGroup )
 {
-	static UFunction* pFnEffectDisableWeapons = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectDisableWeaponsRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectDisableWeapons", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectDisableWeapons )
-		pFnEffectDisableWeapons = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectDisableWeapons" );
+	UFunction* const pFnEffectDisableWeapons = pFnEffectDisableWeaponsRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectDisableWeapons_Parms EffectDisableWeapons_Parms;
 	EffectDisableWeapons_Parms.oCaster = oCaster;
@@ -754,10 +726,9 @@ bool UBioPowerScriptDesign::EffectDisableWeapons ( class AActor* oCaster, class
 
 bool UBioPowerScriptDesign::EffectDisableActions ( class AActor* oCaster, class AActor* oImpacted, float fDuration, int nGFXGroup, unsigned long bDisableActionQueue, unsigned long bDisableMovementStack )
 {
-	static UFunction* pFnEffectDisableActions = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectDisableActionsRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectDisableActions", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectDisableActions )
-		pFnEffectDisableActions = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectDisableActions" );
+	UFunction* const pFnEffectDisableActions = pFnEffectDisableActionsRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectDisableActions_Parms EffectDisableActions_Parms;
 	EffectDisableActions_Parms.oCaster = oCaster;
@@ -784,10 +755,9 @@ bool UBioPowerScriptDesign::EffectDisableActions ( class AActor* oCaster, class
 
 bool UBioPowerScriptDesign::EffectAdjustStability ( class ABioPawn* oTarget, class AActor* oCaster, float fAmount, float fApplyInterval, float fTotalTime )
 {
-	static UFunction* pFnEffectAdjustStability = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectAdjustStabilityRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectAdjustStability", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectAdjustStability )
-		pFnEffectAdjustStability = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectAdjustStability" );
+	UFunction* const pFnEffectAdjustStability = pFnEffectAdjustStabilityRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectAdjustStability_Parms EffectAdjustStability_Parms;
 	EffectAdjustStability_Parms.oTarget = oTarget;
@@ -816,10 +786,9 @@ bool UBioPowerScriptDesign::EffectAdjustStability ( class ABioPawn* oTarget, cla
 
 bool UBioPowerScriptDesign::EffectDamageOverTime ( class AActor* oImpacted, class AActor* oCaster, float fDamagePerInterval, struct FVector const& vMomentumPerInterval, class UBioDamageType* pDamage, float fInterval, float fDuration, int nGroup )
 {
-	static UFunction* pFnEffectDamageOverTime = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectDamageOverTimeRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectDamageOverTime", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectDamageOverTime )
-		pFnEffectDamageOverTime = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectDamageOverTime" );
+	UFunction* const pFnEffectDamageOverTime = pFnEffectDamageOverTimeRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectDamageOverTime_Parms EffectDamageOverTime_Parms;
 	EffectDamageOverTime_Parms.oImpacted = oImpacted;
@@ -848,10 +817,9 @@ bool UBioPowerScriptDesign::EffectDamageOverTime ( class AActor* oImpacted, clas
 
 bool UBioPowerScriptDesign::EffectTakeDamage ( class AActor* oImpacted, class AActor* oCaster, float fDamage, struct FVector const& vMomentum, class UBioDamageType* pDamage )
 {
-	static UFunction* pFnEffectTakeDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEffectTakeDamageRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectTakeDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEffectTakeDamage )
-		pFnEffectTakeDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectTakeDamage" );
+	UFunction* const pFnEffectTakeDamage = pFnEffectTakeDamageRef.Get ( );
 
 	UBioPowerScriptDesign_execEffectTakeDamage_Parms EffectTakeDamage_Parms;
 	EffectTakeDamage_Parms.oImpacted = oImpacted;
@@ -884,10 +852,9 @@ bool UBioPowerScriptDesign::EffectTakeDamage ( class AActor* oImpacted, class AA
 
 class AActor* UBioPowerScriptDesign::SpawnBeacon ( class UBioActorBehavior* oCasterBehavior, FString const& sBeaconActorType, struct FVector const& vLocation, struct FRotator const& vFacing, float fDuration, unsigned long bFloatingBeacon, unsigned long bSnapToFloor, unsigned long bSpawnAsProxMine, float fSquadActivateDelay, float fRadiusMulti, float fDamageMulti, class AActor* oOwner )
 {
-	static UFunction* pFnSpawnBeacon = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSpawnBeaconRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.SpawnBeacon", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSpawnBeacon )
-		pFnSpawnBeacon = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.SpawnBeacon" );
+	UFunction* const pFnSpawnBeacon = pFnSpawnBeaconRef.Get ( );
 
 	UBioPowerScriptDesign_execSpawnBeacon_Parms SpawnBeacon_Parms;
 	SpawnBeacon_Parms.oCasterBehavior = oCasterBehavior;
@@ -924,10 +891,9 @@ class AActor* UBioPowerScriptDesign::SpawnBeacon ( class UBioActorBehavior* oCas
 
 class AActor* UBioPowerScriptDesign::SpawnBarrier ( class UBioActorBehavior* oCasterBehavior, FString const& sBarrierActorType, struct FVector const& vLocation, struct FRotator const& vFacing, float fHealth, float fDuration, unsigned long bSnapToFloor, unsigned long bAddToSquadCover, class AActor* oOwner )
 {
-	static UFunction* pFnSpawnBarrier = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSpawnBarrierRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.SpawnBarrier", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSpawnBarrier )
-		pFnSpawnBarrier = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.SpawnBarrier" );
+	UFunction* const pFnSpawnBarrier = pFnSpawnBarrierRef.Get ( );
 
 	UBioPowerScriptDesign_execSpawnBarrier_Parms SpawnBarrier_Parms;
 	SpawnBarrier_Parms.oCasterBehavior = oCasterBehavior;
@@ -953,10 +919,9 @@ class AActor* UBioPowerScriptDesign::SpawnBarrier ( class UBioActorBehavior* oCa
 
 void UBioPowerScriptDesign::WeaponPowerActivated ( class AActor* Caster, unsigned long bNeedsRetrigger )
 {
-	static UFunction* pFnWeaponPowerActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWeaponPowerActivatedRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.WeaponPowerActivated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWeaponPowerActivated )
-		pFnWeaponPowerActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.WeaponPowerActivated" );
+	UFunction* const pFnWeaponPowerActivated = pFnWeaponPowerActivatedRef.Get ( );
 
 	UBioPowerScriptDesign_execWeaponPowerActivated_Parms WeaponPowerActivated_Parms;
 	WeaponPowerActivated_Parms.Caster = Caster;
@@ -973,10 +938,9 @@ void UBioPowerScriptDesign::WeaponPowerActivated ( class AActor* Caster, unsigne
 
 bool UBioPowerScriptDesign::ShouldIncrementPowerUsage ( class AActor* Caster )
 {
-	static UFunction* pFnShouldIncrementPowerUsage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldIncrementPowerUsageRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.ShouldIncrementPowerUsage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldIncrementPowerUsage )
-		pFnShouldIncrementPowerUsage = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.ShouldIncrementPowerUsage" );
+	UFunction* const pFnShouldIncrementPowerUsage = pFnShouldIncrementPowerUsageRef.Get ( );
 
 	UBioPowerScriptDesign_execShouldIncrementPowerUsage_Parms ShouldIncrementPowerUsage_Parms;
 	ShouldIncrementPowerUsage_Parms.Caster = Caster;
@@ -995,10 +959,9 @@ bool UBioPowerScriptDesign::ShouldIncrementPowerUsage ( class AActor* Caster )
 
 unsigned char UBioPowerScriptDesign::GetFactionRelationship ( class AActor* oCaster, class AActor* oTarget )
 {
-	static UFunction* pFnGetFactionRelationship = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetFactionRelationshipRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetFactionRelationship", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetFactionRelationship )
-		pFnGetFactionRelationship = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetFactionRelationship" );
+	UFunction* const pFnGetFactionRelationship = pFnGetFactionRelationshipRef.Get ( );
 
 	UBioPowerScriptDesign_execGetFactionRelationship_Parms GetFactionRelationship_Parms;
 	GetFactionRelationship_Parms.oCaster = oCaster;
@@ -1017,10 +980,9 @@ unsigned char UBioPowerScriptDesign::GetFactionRelationship ( class AActor* oCas
 
 float UBioPowerScriptDesign::GetTechResistance ( class AActor* oTarget )
 {
-	static UFunction* pFnGetTechResistance = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTechResistanceRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetTechResistance", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTechResistance )
-		pFnGetTechResistance = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetTechResistance" );
+	UFunction* const pFnGetTechResistance = pFnGetTechResistanceRef.Get ( );
 
 	UBioPowerScriptDesign_execGetTechResistance_Parms GetTechResistance_Parms;
 	GetTechResistance_Parms.oTarget = oTarget;
@@ -1038,10 +1000,9 @@ float UBioPowerScriptDesign::GetTechResistance ( class AActor* oTarget )
 
 float UBioPowerScriptDesign::GetBioticResistance ( class AActor* oTarget )
 {
-	static UFunction* pFnGetBioticResistance = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetBioticResistanceRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetBioticResistance", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetBioticResistance )
-		pFnGetBioticResistance = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetBioticResistance" );
+	UFunction* const pFnGetBioticResistance = pFnGetBioticResistanceRef.Get ( );
 
 	UBioPowerScriptDesign_execGetBioticResistance_Parms GetBioticResistance_Parms;
 	GetBioticResistance_Parms.oTarget = oTarget;
@@ -1059,10 +1020,9 @@ float UBioPowerScriptDesign::GetBioticResistance ( class AActor* oTarget )
 
 float UBioPowerScriptDesign::GetTargetResistance ( class AActor* oTarget )
 {
-	static UFunction* pFnGetTargetResistance = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTargetResistanceRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetTargetResistance", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTargetResistance )
-		pFnGetTargetResistance = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetTargetResistance" );
+	UFunction* const pFnGetTargetResistance = pFnGetTargetResistanceRef.Get ( );
 
 	UBioPowerScriptDesign_execGetTargetResistance_Parms GetTargetResistance_Parms;
 	GetTargetResistance_Parms.oTarget = oTarget;
@@ -1081,10 +1041,9 @@ float UBioPowerScriptDesign::GetTargetResistance ( class AActor* oTarget )
 
 float UBioPowerScriptDesign::GetDistanceModifier ( class AActor* oTarget, unsigned char eFalloff )
 {
-	static UFunction* pFnGetDistanceModifier = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDistanceModifierRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetDistanceModifier", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDistanceModifier )
-		pFnGetDistanceModifier = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetDistanceModifier" );
+	UFunction* const pFnGetDistanceModifier = pFnGetDistanceModifierRef.Get ( );
 
 	UBioPowerScriptDesign_execGetDistanceModifier_Parms GetDistanceModifier_Parms;
 	GetDistanceModifier_Parms.oTarget = oTarget;
@@ -1103,10 +1062,9 @@ float UBioPowerScriptDesign::GetDistanceModifier ( class AActor* oTarget, unsign
 
 float UBioPowerScriptDesign::GetDmgDurModifier ( class AActor* oCaster )
 {
-	static UFunction* pFnGetDmgDurModifier = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDmgDurModifierRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetDmgDurModifier", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDmgDurModifier )
-		pFnGetDmgDurModifier = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetDmgDurModifier" );
+	UFunction* const pFnGetDmgDurModifier = pFnGetDmgDurModifierRef.Get ( );
 
 	UBioPowerScriptDesign_execGetDmgDurModifier_Parms GetDmgDurModifier_Parms;
 	GetDmgDurModifier_Parms.oCaster = oCaster;
@@ -1124,10 +1082,9 @@ float UBioPowerScriptDesign::GetDmgDurModifier ( class AActor* oCaster )
 
 int UBioPowerScriptDesign::GetPhysicsLevel ( class AActor* oImpacted )
 {
-	static UFunction* pFnGetPhysicsLevel = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPhysicsLevelRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetPhysicsLevel", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPhysicsLevel )
-		pFnGetPhysicsLevel = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetPhysicsLevel" );
+	UFunction* const pFnGetPhysicsLevel = pFnGetPhysicsLevelRef.Get ( );
 
 	UBioPowerScriptDesign_execGetPhysicsLevel_Parms GetPhysicsLevel_Parms;
 	GetPhysicsLevel_Parms.oImpacted = oImpacted;
@@ -1146,10 +1103,9 @@ int UBioPowerScriptDesign::GetPhysicsLevel ( class AActor* oImpacted )
 
 bool UBioPowerScriptDesign::IsOfRace ( class AActor* oImpacted, unsigned char eRace )
 {
-	static UFunction* pFnIsOfRace = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsOfRaceRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.IsOfRace", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsOfRace )
-		pFnIsOfRace = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.IsOfRace" );
+	UFunction* const pFnIsOfRace = pFnIsOfRaceRef.Get ( );
 
 	UBioPowerScriptDesign_execIsOfRace_Parms IsOfRace_Parms;
 	IsOfRace_Parms.oImpacted = oImpacted;
@@ -1169,10 +1125,9 @@ bool UBioPowerScriptDesign::IsOfRace ( class AActor* oImpacted, unsigned char eR
 
 bool UBioPowerScriptDesign::HasShields ( class AActor* oImpacted, unsigned long bCheckMax )
 {
-	static UFunction* pFnHasShields = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHasShieldsRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.HasShields", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHasShields )
-		pFnHasShields = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.HasShields" );
+	UFunction* const pFnHasShields = pFnHasShieldsRef.Get ( );
 
 	UBioPowerScriptDesign_execHasShields_Parms HasShields_Parms;
 	HasShields_Parms.oImpacted = oImpacted;
@@ -1191,10 +1146,9 @@ bool UBioPowerScriptDesign::HasShields ( class AActor* oImpacted, unsigned long
 
 bool UBioPowerScriptDesign::IsDeadBody ( class AActor* oImpacted )
 {
-	static UFunction* pFnIsDeadBody = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsDeadBodyRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.IsDeadBody", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsDeadBody )
-		pFnIsDeadBody = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.IsDeadBody" );
+	UFunction* const pFnIsDeadBody = pFnIsDeadBodyRef.Get ( );
 
 	UBioPowerScriptDesign_execIsDeadBody_Parms IsDeadBody_Parms;
 	IsDeadBody_Parms.oImpacted = oImpacted;
@@ -1212,10 +1166,9 @@ bool UBioPowerScriptDesign::IsDeadBody ( class AActor* oImpacted )
 
 bool UBioPowerScriptDesign::IsPlaceable ( class AActor* oImpacted )
 {
-	static UFunction* pFnIsPlaceable = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsPlaceableRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.IsPlaceable", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsPlaceable )
-		pFnIsPlaceable = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.IsPlaceable" );
+	UFunction* const pFnIsPlaceable = pFnIsPlaceableRef.Get ( );
 
 	UBioPowerScriptDesign_execIsPlaceable_Parms IsPlaceable_Parms;
 	IsPlaceable_Parms.oImpacted = oImpacted;
@@ -1232,10 +1185,9 @@ bool UBioPowerScriptDesign::IsPlaceable ( class AActor* oImpacted )
 
 void UBioPowerScriptDesign::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioPowerScriptDesign.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPowerScriptDesign.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioPowerScriptDesign_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -1245,14 +1197,11 @@ void UBioPowerScriptDesign::eventInitializePowerScript ( class UBioPower* pPower
 
 
 
-class UClass* UBioAdrenalineScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioAdrenalineScript::pClassPointer { L"Class SFXGameContent_Powers.BioAdrenalineScript", &UObject::FindClass };
 
 class UClass* UBioAdrenalineScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioAdrenalineScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioAdrenalineScript.OnImpact
@@ -1266,10 +1215,9 @@ class UClass* UBioAdrenalineScript::StaticClass()
 
 bool UBioAdrenalineScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioAdrenalineScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioAdrenalineScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioAdrenalineScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -1292,10 +1240,9 @@ bool UBioAdrenalineScript::eventOnImpact ( class AActor* oCaster, float fCasterS
 
 bool UBioAdrenalineScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioAdrenalineScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioAdrenalineScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioAdrenalineScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -1309,14 +1256,11 @@ bool UBioAdrenalineScript::eventStartPhase ( unsigned char ePhase, class AActor*
 
 
 
-class UClass* UBioBarrierScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioBarrierScript::pClassPointer { L"Class SFXGameContent_Powers.BioBarrierScript", &UObject::FindClass };
 
 class UClass* UBioBarrierScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioBarrierScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioBarrierScript.OnImpact
@@ -1330,10 +1274,9 @@ class UClass* UBioBarrierScript::StaticClass()
 
 bool UBioBarrierScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioBarrierScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioBarrierScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioBarrierScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -1348,14 +1291,11 @@ bool UBioBarrierScript::eventOnImpact ( class AActor* oCaster, float fCasterStab
 
 
 
-class UClass* UBioCarnageScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioCarnageScript::pClassPointer { L"Class SFXGameContent_Powers.BioCarnageScript", &UObject::FindClass };
 
 class UClass* UBioCarnageScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioCarnageScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioCarnageScript.OnImpact
@@ -1369,10 +1309,9 @@ class UClass* UBioCarnageScript::StaticClass()
 
 bool UBioCarnageScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioCarnageScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCarnageScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioCarnageScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -1395,10 +1334,9 @@ bool UBioCarnageScript::eventOnImpact ( class AActor* oCaster, float fCasterStab
 
 bool UBioCarnageScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioCarnageScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCarnageScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioCarnageScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -1417,10 +1355,9 @@ bool UBioCarnageScript::eventStartPhase ( unsigned char ePhase, class AActor* oC
 
 void UBioCarnageScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioCarnageScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCarnageScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioCarnageScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -1430,14 +1367,11 @@ void UBioCarnageScript::eventInitializePowerScript ( class UBioPower* pPower )
 
 
 
-class UClass* UBioCarnageSetupScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioCarnageSetupScript::pClassPointer { L"Class SFXGameContent_Powers.BioCarnageSetupScript", &UObject::FindClass };
 
 class UClass* UBioCarnageSetupScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioCarnageSetupScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioCarnageSetupScript.OnImpact
@@ -1451,10 +1385,9 @@ class UClass* UBioCarnageSetupScript::StaticClass()
 
 bool UBioCarnageSetupScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioCarnageSetupScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCarnageSetupScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioCarnageSetupScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -1469,14 +1402,11 @@ bool UBioCarnageSetupScript::eventOnImpact ( class AActor* oCaster, float fCaste
 
 
 
-class UClass* UBioSpawnBeacon::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSpawnBeacon::pClassPointer { L"Class SFXGameContent_Powers.BioSpawnBeacon", &UObject::FindClass };
 
 class UClass* UBioSpawnBeacon::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioSpawnBeacon" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioSpawnBeacon.OnImpact
@@ -1490,10 +1420,9 @@ class UClass* UBioSpawnBeacon::StaticClass()
 
 bool UBioSpawnBeacon::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioSpawnBeacon.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSpawnBeacon.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioSpawnBeacon_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -1515,10 +1444,9 @@ bool UBioSpawnBeacon::eventOnImpact ( class AActor* oCaster, float fCasterStabil
 
 bool UBioSpawnBeacon::eventEndPhase ( unsigned char ePhase, class AActor* oCaster )
 {
-	static UFunction* pFnEndPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndPhaseRef { L"Function SFXGameContent_Powers.BioSpawnBeacon.EndPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndPhase )
-		pFnEndPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSpawnBeacon.EndPhase" );
+	UFunction* const pFnEndPhase = pFnEndPhaseRef.Get ( );
 
 	UBioSpawnBeacon_eventEndPhase_Parms EndPhase_Parms;
 	EndPhase_Parms.ePhase = ePhase;
@@ -1539,10 +1467,9 @@ bool UBioSpawnBeacon::eventEndPhase ( unsigned char ePhase, class AActor* oCaste
 
 bool UBioSpawnBeacon::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioSpawnBeacon.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSpawnBeacon.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioSpawnBeacon_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -1561,10 +1488,9 @@ bool UBioSpawnBeacon::eventStartPhase ( unsigned char ePhase, class AActor* oCas
 
 void UBioSpawnBeacon::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioSpawnBeacon.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSpawnBeacon.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioSpawnBeacon_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -1574,26 +1500,20 @@ void UBioSpawnBeacon::eventInitializePowerScript ( class UBioPower* pPower )
 
 
 
-class UClass* UBioDampingBeacon::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioDampingBeacon::pClassPointer { L"Class SFXGameContent_Powers.BioDampingBeacon", &UObject::FindClass };
 
 class UClass* UBioDampingBeacon::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioDampingBeacon" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioDampingScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioDampingScript::pClassPointer { L"Class SFXGameContent_Powers.BioDampingScript", &UObject::FindClass };
 
 class UClass* UBioDampingScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioDampingScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioDampingScript.OnImpact
@@ -1607,10 +1527,9 @@ class UClass* UBioDampingScript::StaticClass()
 
 bool UBioDampingScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioDampingScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioDampingScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioDampingScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -1633,10 +1552,9 @@ bool UBioDampingScript::eventOnImpact ( class AActor* oCaster, float fCasterStab
 
 bool UBioDampingScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioDampingScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioDampingScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioDampingScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -1655,10 +1573,9 @@ bool UBioDampingScript::eventStartPhase ( unsigned char ePhase, class AActor* oC
 
 void UBioDampingScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioDampingScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioDampingScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioDampingScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -1668,14 +1585,11 @@ void UBioDampingScript::eventInitializePowerScript ( class UBioPower* pPower )
 
 
 
-class UClass* UBioDampingSuicideScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioDampingSuicideScript::pClassPointer { L"Class SFXGameContent_Powers.BioDampingSuicideScript", &UObject::FindClass };
 
 class UClass* UBioDampingSuicideScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioDampingSuicideScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioDampingSuicideScript.EndPhase
@@ -1687,10 +1601,9 @@ class UClass* UBioDampingSuicideScript::StaticClass()
 
 bool UBioDampingSuicideScript::eventEndPhase ( unsigned char ePhase, class AActor* oCaster )
 {
-	static UFunction* pFnEndPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndPhaseRef { L"Function SFXGameContent_Powers.BioDampingSuicideScript.EndPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndPhase )
-		pFnEndPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioDampingSuicideScript.EndPhase" );
+	UFunction* const pFnEndPhase = pFnEndPhaseRef.Get ( );
 
 	UBioDampingSuicideScript_eventEndPhase_Parms EndPhase_Parms;
 	EndPhase_Parms.ePhase = ePhase;
@@ -1708,10 +1621,9 @@ bool UBioDampingSuicideScript::eventEndPhase ( unsigned char ePhase, class AActo
 
 void UBioDampingSuicideScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioDampingSuicideScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioDampingSuicideScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioDampingSuicideScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -1721,26 +1633,20 @@ void UBioDampingSuicideScript::eventInitializePowerScript ( class UBioPower* pPo
 
 
 
-class UClass* UBioEMPBeacon::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioEMPBeacon::pClassPointer { L"Class SFXGameContent_Powers.BioEMPBeacon", &UObject::FindClass };
 
 class UClass* UBioEMPBeacon::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioEMPBeacon" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioEMPScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioEMPScript::pClassPointer { L"Class SFXGameContent_Powers.BioEMPScript", &UObject::FindClass };
 
 class UClass* UBioEMPScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioEMPScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioEMPScript.OnImpact
@@ -1754,10 +1660,9 @@ class UClass* UBioEMPScript::StaticClass()
 
 bool UBioEMPScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioEMPScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioEMPScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioEMPScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -1780,10 +1685,9 @@ bool UBioEMPScript::eventOnImpact ( class AActor* oCaster, float fCasterStabilit
 
 bool UBioEMPScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioEMPScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioEMPScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioEMPScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -1802,10 +1706,9 @@ bool UBioEMPScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaste
 
 void UBioEMPScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioEMPScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioEMPScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioEMPScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -1815,14 +1718,11 @@ void UBioEMPScript::eventInitializePowerScript ( class UBioPower* pPower )
 
 
 
-class UClass* UBioEMPSuicideScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioEMPSuicideScript::pClassPointer { L"Class SFXGameContent_Powers.BioEMPSuicideScript", &UObject::FindClass };
 
 class UClass* UBioEMPSuicideScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioEMPSuicideScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioEMPSuicideScript.EndPhase
@@ -1834,10 +1734,9 @@ class UClass* UBioEMPSuicideScript::StaticClass()
 
 bool UBioEMPSuicideScript::eventEndPhase ( unsigned char ePhase, class AActor* oCaster )
 {
-	static UFunction* pFnEndPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndPhaseRef { L"Function SFXGameContent_Powers.BioEMPSuicideScript.EndPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndPhase )
-		pFnEndPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioEMPSuicideScript.EndPhase" );
+	UFunction* const pFnEndPhase = pFnEndPhaseRef.Get ( );
 
 	UBioEMPSuicideScript_eventEndPhase_Parms EndPhase_Parms;
 	EndPhase_Parms.ePhase = ePhase;
@@ -1855,10 +1754,9 @@ bool UBioEMPSuicideScript::eventEndPhase ( unsigned char ePhase, class AActor* o
 
 void UBioEMPSuicideScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioEMPSuicideScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioEMPSuicideScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioEMPSuicideScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -1868,14 +1766,11 @@ void UBioEMPSuicideScript::eventInitializePowerScript ( class UBioPower* pPower
 
 
 
-class UClass* UBioFakePowerScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioFakePowerScript::pClassPointer { L"Class SFXGameContent_Powers.BioFakePowerScript", &UObject::FindClass };
 
 class UClass* UBioFakePowerScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioFakePowerScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioFakePowerScript.OnImpact
@@ -1889,10 +1784,9 @@ class UClass* UBioFakePowerScript::StaticClass()
 
 bool UBioFakePowerScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioFakePowerScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioFakePowerScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioFakePowerScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -1915,10 +1809,9 @@ bool UBioFakePowerScript::eventOnImpact ( class AActor* oCaster, float fCasterSt
 
 bool UBioFakePowerScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioFakePowerScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioFakePowerScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioFakePowerScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -1932,14 +1825,11 @@ bool UBioFakePowerScript::eventStartPhase ( unsigned char ePhase, class AActor*
 
 
 
-class UClass* UBioGethCarnageScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioGethCarnageScript::pClassPointer { L"Class SFXGameContent_Powers.BioGethCarnageScript", &UObject::FindClass };
 
 class UClass* UBioGethCarnageScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioGethCarnageScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioGethCarnageScript.OnImpact
@@ -1953,10 +1843,9 @@ class UClass* UBioGethCarnageScript::StaticClass()
 
 bool UBioGethCarnageScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioGethCarnageScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioGethCarnageScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioGethCarnageScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -1979,10 +1868,9 @@ bool UBioGethCarnageScript::eventOnImpact ( class AActor* oCaster, float fCaster
 
 bool UBioGethCarnageScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioGethCarnageScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioGethCarnageScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioGethCarnageScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -2001,10 +1889,9 @@ bool UBioGethCarnageScript::eventStartPhase ( unsigned char ePhase, class AActor
 
 void UBioGethCarnageScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioGethCarnageScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioGethCarnageScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioGethCarnageScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -2014,14 +1901,11 @@ void UBioGethCarnageScript::eventInitializePowerScript ( class UBioPower* pPower
 
 
 
-class UClass* UBioHackingScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioHackingScript::pClassPointer { L"Class SFXGameContent_Powers.BioHackingScript", &UObject::FindClass };
 
 class UClass* UBioHackingScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioHackingScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioHackingScript.OnImpact
@@ -2035,10 +1919,9 @@ class UClass* UBioHackingScript::StaticClass()
 
 bool UBioHackingScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioHackingScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHackingScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioHackingScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -2061,10 +1944,9 @@ bool UBioHackingScript::eventOnImpact ( class AActor* oCaster, float fCasterStab
 
 bool UBioHackingScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioHackingScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHackingScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioHackingScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -2078,14 +1960,11 @@ bool UBioHackingScript::eventStartPhase ( unsigned char ePhase, class AActor* oC
 
 
 
-class UClass* UBioHealScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioHealScript::pClassPointer { L"Class SFXGameContent_Powers.BioHealScript", &UObject::FindClass };
 
 class UClass* UBioHealScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioHealScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioHealScript.OnImpact
@@ -2099,10 +1978,9 @@ class UClass* UBioHealScript::StaticClass()
 
 bool UBioHealScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioHealScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHealScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioHealScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -2125,10 +2003,9 @@ bool UBioHealScript::eventOnImpact ( class AActor* oCaster, float fCasterStabili
 
 bool UBioHealScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioHealScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHealScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioHealScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -2142,14 +2019,11 @@ bool UBioHealScript::eventStartPhase ( unsigned char ePhase, class AActor* oCast
 
 
 
-class UClass* UBioHealSelfScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioHealSelfScript::pClassPointer { L"Class SFXGameContent_Powers.BioHealSelfScript", &UObject::FindClass };
 
 class UClass* UBioHealSelfScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioHealSelfScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioHealSelfScript.OnImpact
@@ -2163,10 +2037,9 @@ class UClass* UBioHealSelfScript::StaticClass()
 
 bool UBioHealSelfScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioHealSelfScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHealSelfScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioHealSelfScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -2187,10 +2060,9 @@ bool UBioHealSelfScript::eventOnImpact ( class AActor* oCaster, float fCasterSta
 
 bool UBioHealSelfScript::eventCanStartPower ( class AActor* oCaster )
 {
-	static UFunction* pFnCanStartPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanStartPowerRef { L"Function SFXGameContent_Powers.BioHealSelfScript.CanStartPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanStartPower )
-		pFnCanStartPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHealSelfScript.CanStartPower" );
+	UFunction* const pFnCanStartPower = pFnCanStartPowerRef.Get ( );
 
 	UBioHealSelfScript_eventCanStartPower_Parms CanStartPower_Parms;
 	CanStartPower_Parms.oCaster = oCaster;
@@ -2202,14 +2074,11 @@ bool UBioHealSelfScript::eventCanStartPower ( class AActor* oCaster )
 
 
 
-class UClass* UBioHealSquadScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioHealSquadScript::pClassPointer { L"Class SFXGameContent_Powers.BioHealSquadScript", &UObject::FindClass };
 
 class UClass* UBioHealSquadScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioHealSquadScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioHealSquadScript.OnImpact
@@ -2223,10 +2092,9 @@ class UClass* UBioHealSquadScript::StaticClass()
 
 bool UBioHealSquadScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioHealSquadScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHealSquadScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioHealSquadScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -2249,10 +2117,9 @@ bool UBioHealSquadScript::eventOnImpact ( class AActor* oCaster, float fCasterSt
 
 bool UBioHealSquadScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioHealSquadScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHealSquadScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioHealSquadScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -2272,10 +2139,9 @@ bool UBioHealSquadScript::eventStartPhase ( unsigned char ePhase, class AActor*
 
 bool UBioHealSquadScript::eventCanStartPower ( class AActor* oCaster )
 {
-	static UFunction* pFnCanStartPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanStartPowerRef { L"Function SFXGameContent_Powers.BioHealSquadScript.CanStartPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanStartPower )
-		pFnCanStartPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHealSquadScript.CanStartPower" );
+	UFunction* const pFnCanStartPower = pFnCanStartPowerRef.Get ( );
 
 	UBioHealSquadScript_eventCanStartPower_Parms CanStartPower_Parms;
 	CanStartPower_Parms.oCaster = oCaster;
@@ -2293,10 +2159,9 @@ bool UBioHealSquadScript::eventCanStartPower ( class AActor* oCaster )
 
 bool UBioHealSquadScript::eventAdjustCooldown ( float* fCoolDownTime )
 {
-	static UFunction* pFnAdjustCooldown = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAdjustCooldownRef { L"Function SFXGameContent_Powers.BioHealSquadScript.AdjustCooldown", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAdjustCooldown )
-		pFnAdjustCooldown = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHealSquadScript.AdjustCooldown" );
+	UFunction* const pFnAdjustCooldown = pFnAdjustCooldownRef.Get ( );
 
 	UBioHealSquadScript_eventAdjustCooldown_Parms AdjustCooldown_Parms;
 
@@ -2319,10 +2184,9 @@ bool UBioHealSquadScript::eventAdjustCooldown ( float* fCoolDownTime )
 
 bool UBioHealSquadScript::DoesSquadNeedHealing ( class AActor* oActor )
 {
-	static UFunction* pFnDoesSquadNeedHealing = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoesSquadNeedHealingRef { L"Function SFXGameContent_Powers.BioHealSquadScript.DoesSquadNeedHealing", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoesSquadNeedHealing )
-		pFnDoesSquadNeedHealing = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHealSquadScript.DoesSquadNeedHealing" );
+	UFunction* const pFnDoesSquadNeedHealing = pFnDoesSquadNeedHealingRef.Get ( );
 
 	UBioHealSquadScript_execDoesSquadNeedHealing_Parms DoesSquadNeedHealing_Parms;
 	DoesSquadNeedHealing_Parms.oActor = oActor;
@@ -2340,10 +2204,9 @@ bool UBioHealSquadScript::DoesSquadNeedHealing ( class AActor* oActor )
 
 float UBioHealSquadScript::GetCooldownMultiForSquad ( class AActor* oCaster )
 {
-	static UFunction* pFnGetCooldownMultiForSquad = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetCooldownMultiForSquadRef { L"Function SFXGameContent_Powers.BioHealSquadScript.GetCooldownMultiForSquad", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetCooldownMultiForSquad )
-		pFnGetCooldownMultiForSquad = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHealSquadScript.GetCooldownMultiForSquad" );
+	UFunction* const pFnGetCooldownMultiForSquad = pFnGetCooldownMultiForSquadRef.Get ( );
 
 	UBioHealSquadScript_execGetCooldownMultiForSquad_Parms GetCooldownMultiForSquad_Parms;
 	GetCooldownMultiForSquad_Parms.oCaster = oCaster;
@@ -2362,10 +2225,9 @@ float UBioHealSquadScript::GetCooldownMultiForSquad ( class AActor* oCaster )
 
 void UBioHealSquadScript::GetHealAmountForSquad ( class AActor* oCaster, float* fHealAmount, float* fToxicAmount )
 {
-	static UFunction* pFnGetHealAmountForSquad = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetHealAmountForSquadRef { L"Function SFXGameContent_Powers.BioHealSquadScript.GetHealAmountForSquad", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetHealAmountForSquad )
-		pFnGetHealAmountForSquad = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHealSquadScript.GetHealAmountForSquad" );
+	UFunction* const pFnGetHealAmountForSquad = pFnGetHealAmountForSquadRef.Get ( );
 
 	UBioHealSquadScript_execGetHealAmountForSquad_Parms GetHealAmountForSquad_Parms;
 	GetHealAmountForSquad_Parms.oCaster = oCaster;
@@ -2387,14 +2249,11 @@ void UBioHealSquadScript::GetHealAmountForSquad ( class AActor* oCaster, float*
 
 
 
-class UClass* UBioHexBarrierScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioHexBarrierScript::pClassPointer { L"Class SFXGameContent_Powers.BioHexBarrierScript", &UObject::FindClass };
 
 class UClass* UBioHexBarrierScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioHexBarrierScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioHexBarrierScript.OnImpact
@@ -2408,10 +2267,9 @@ class UClass* UBioHexBarrierScript::StaticClass()
 
 bool UBioHexBarrierScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioHexBarrierScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHexBarrierScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioHexBarrierScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -2426,14 +2284,11 @@ bool UBioHexBarrierScript::eventOnImpact ( class AActor* oCaster, float fCasterS
 
 
 
-class UClass* UBioImmunityScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioImmunityScript::pClassPointer { L"Class SFXGameContent_Powers.BioImmunityScript", &UObject::FindClass };
 
 class UClass* UBioImmunityScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioImmunityScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioImmunityScript.OnImpact
@@ -2447,10 +2302,9 @@ class UClass* UBioImmunityScript::StaticClass()
 
 bool UBioImmunityScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioImmunityScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioImmunityScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioImmunityScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -2473,10 +2327,9 @@ bool UBioImmunityScript::eventOnImpact ( class AActor* oCaster, float fCasterSta
 
 bool UBioImmunityScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioImmunityScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioImmunityScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioImmunityScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -2490,14 +2343,11 @@ bool UBioImmunityScript::eventStartPhase ( unsigned char ePhase, class AActor* o
 
 
 
-class UClass* UBioLanceArmScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioLanceArmScript::pClassPointer { L"Class SFXGameContent_Powers.BioLanceArmScript", &UObject::FindClass };
 
 class UClass* UBioLanceArmScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioLanceArmScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioLanceArmScript.OnImpact
@@ -2511,10 +2361,9 @@ class UClass* UBioLanceArmScript::StaticClass()
 
 bool UBioLanceArmScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioLanceArmScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioLanceArmScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioLanceArmScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -2537,10 +2386,9 @@ bool UBioLanceArmScript::eventOnImpact ( class AActor* oCaster, float fCasterSta
 
 bool UBioLanceArmScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioLanceArmScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioLanceArmScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioLanceArmScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -2559,10 +2407,9 @@ bool UBioLanceArmScript::eventStartPhase ( unsigned char ePhase, class AActor* o
 
 void UBioLanceArmScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioLanceArmScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioLanceArmScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioLanceArmScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -2572,14 +2419,11 @@ void UBioLanceArmScript::eventInitializePowerScript ( class UBioPower* pPower )
 
 
 
-class UClass* UBioLiftScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioLiftScript::pClassPointer { L"Class SFXGameContent_Powers.BioLiftScript", &UObject::FindClass };
 
 class UClass* UBioLiftScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioLiftScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioLiftScript.OnImpact
@@ -2593,10 +2437,9 @@ class UClass* UBioLiftScript::StaticClass()
 
 bool UBioLiftScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioLiftScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioLiftScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioLiftScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -2619,10 +2462,9 @@ bool UBioLiftScript::eventOnImpact ( class AActor* oCaster, float fCasterStabili
 
 bool UBioLiftScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioLiftScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioLiftScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioLiftScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -2636,14 +2478,11 @@ bool UBioLiftScript::eventStartPhase ( unsigned char ePhase, class AActor* oCast
 
 
 
-class UClass* UBioLiftPLCScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioLiftPLCScript::pClassPointer { L"Class SFXGameContent_Powers.BioLiftPLCScript", &UObject::FindClass };
 
 class UClass* UBioLiftPLCScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioLiftPLCScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioLiftPLCScript.OnImpact
@@ -2657,10 +2496,9 @@ class UClass* UBioLiftPLCScript::StaticClass()
 
 bool UBioLiftPLCScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioLiftPLCScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioLiftPLCScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioLiftPLCScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -2675,14 +2513,11 @@ bool UBioLiftPLCScript::eventOnImpact ( class AActor* oCaster, float fCasterStab
 
 
 
-class UClass* UBioMarksmanScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioMarksmanScript::pClassPointer { L"Class SFXGameContent_Powers.BioMarksmanScript", &UObject::FindClass };
 
 class UClass* UBioMarksmanScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioMarksmanScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioMarksmanScript.OnImpact
@@ -2696,10 +2531,9 @@ class UClass* UBioMarksmanScript::StaticClass()
 
 bool UBioMarksmanScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioMarksmanScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioMarksmanScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioMarksmanScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -2722,10 +2556,9 @@ bool UBioMarksmanScript::eventOnImpact ( class AActor* oCaster, float fCasterSta
 
 bool UBioMarksmanScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioMarksmanScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioMarksmanScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioMarksmanScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -2739,14 +2572,11 @@ bool UBioMarksmanScript::eventStartPhase ( unsigned char ePhase, class AActor* o
 
 
 
-class UClass* UBioNeuralShockScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioNeuralShockScript::pClassPointer { L"Class SFXGameContent_Powers.BioNeuralShockScript", &UObject::FindClass };
 
 class UClass* UBioNeuralShockScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioNeuralShockScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioNeuralShockScript.OnImpact
@@ -2760,10 +2590,9 @@ class UClass* UBioNeuralShockScript::StaticClass()
 
 bool UBioNeuralShockScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioNeuralShockScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioNeuralShockScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioNeuralShockScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -2786,10 +2615,9 @@ bool UBioNeuralShockScript::eventOnImpact ( class AActor* oCaster, float fCaster
 
 bool UBioNeuralShockScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioNeuralShockScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioNeuralShockScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioNeuralShockScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -2808,10 +2636,9 @@ bool UBioNeuralShockScript::eventStartPhase ( unsigned char ePhase, class AActor
 
 void UBioNeuralShockScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioNeuralShockScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioNeuralShockScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioNeuralShockScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -2821,14 +2648,11 @@ void UBioNeuralShockScript::eventInitializePowerScript ( class UBioPower* pPower
 
 
 
-class UClass* UBioOverkillScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioOverkillScript::pClassPointer { L"Class SFXGameContent_Powers.BioOverkillScript", &UObject::FindClass };
 
 class UClass* UBioOverkillScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioOverkillScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioOverkillScript.OnImpact
@@ -2842,10 +2666,9 @@ class UClass* UBioOverkillScript::StaticClass()
 
 bool UBioOverkillScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioOverkillScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioOverkillScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioOverkillScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -2868,10 +2691,9 @@ bool UBioOverkillScript::eventOnImpact ( class AActor* oCaster, float fCasterSta
 
 bool UBioOverkillScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioOverkillScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioOverkillScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioOverkillScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -2885,14 +2707,11 @@ bool UBioOverkillScript::eventStartPhase ( unsigned char ePhase, class AActor* o
 
 
 
-class UClass* UBioRegenBurstScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioRegenBurstScript::pClassPointer { L"Class SFXGameContent_Powers.BioRegenBurstScript", &UObject::FindClass };
 
 class UClass* UBioRegenBurstScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioRegenBurstScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioRegenBurstScript.OnImpact
@@ -2906,10 +2725,9 @@ class UClass* UBioRegenBurstScript::StaticClass()
 
 bool UBioRegenBurstScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioRegenBurstScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioRegenBurstScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioRegenBurstScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -2924,14 +2742,11 @@ bool UBioRegenBurstScript::eventOnImpact ( class AActor* oCaster, float fCasterS
 
 
 
-class UClass* UBioRepairScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioRepairScript::pClassPointer { L"Class SFXGameContent_Powers.BioRepairScript", &UObject::FindClass };
 
 class UClass* UBioRepairScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioRepairScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioRepairScript.OnImpact
@@ -2945,10 +2760,9 @@ class UClass* UBioRepairScript::StaticClass()
 
 bool UBioRepairScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioRepairScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioRepairScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioRepairScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -2971,10 +2785,9 @@ bool UBioRepairScript::eventOnImpact ( class AActor* oCaster, float fCasterStabi
 
 bool UBioRepairScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioRepairScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioRepairScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioRepairScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -2994,10 +2807,9 @@ bool UBioRepairScript::eventStartPhase ( unsigned char ePhase, class AActor* oCa
 
 bool UBioRepairScript::eventCanStartPower ( class AActor* oCaster )
 {
-	static UFunction* pFnCanStartPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanStartPowerRef { L"Function SFXGameContent_Powers.BioRepairScript.CanStartPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanStartPower )
-		pFnCanStartPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioRepairScript.CanStartPower" );
+	UFunction* const pFnCanStartPower = pFnCanStartPowerRef.Get ( );
 
 	UBioRepairScript_eventCanStartPower_Parms CanStartPower_Parms;
 	CanStartPower_Parms.oCaster = oCaster;
@@ -3015,10 +2827,9 @@ bool UBioRepairScript::eventCanStartPower ( class AActor* oCaster )
 
 int UBioRepairScript::GetSquadElectronicsRank ( class AActor* oCaster )
 {
-	static UFunction* pFnGetSquadElectronicsRank = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetSquadElectronicsRankRef { L"Function SFXGameContent_Powers.BioRepairScript.GetSquadElectronicsRank", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetSquadElectronicsRank )
-		pFnGetSquadElectronicsRank = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioRepairScript.GetSquadElectronicsRank" );
+	UFunction* const pFnGetSquadElectronicsRank = pFnGetSquadElectronicsRankRef.Get ( );
 
 	UBioRepairScript_execGetSquadElectronicsRank_Parms GetSquadElectronicsRank_Parms;
 	GetSquadElectronicsRank_Parms.oCaster = oCaster;
@@ -3030,26 +2841,20 @@ int UBioRepairScript::GetSquadElectronicsRank ( class AActor* oCaster )
 
 
 
-class UClass* UBioSabotageBeacon::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSabotageBeacon::pClassPointer { L"Class SFXGameContent_Powers.BioSabotageBeacon", &UObject::FindClass };
 
 class UClass* UBioSabotageBeacon::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioSabotageBeacon" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioSabotageScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSabotageScript::pClassPointer { L"Class SFXGameContent_Powers.BioSabotageScript", &UObject::FindClass };
 
 class UClass* UBioSabotageScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioSabotageScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioSabotageScript.OnImpact
@@ -3063,10 +2868,9 @@ class UClass* UBioSabotageScript::StaticClass()
 
 bool UBioSabotageScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioSabotageScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSabotageScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioSabotageScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -3089,10 +2893,9 @@ bool UBioSabotageScript::eventOnImpact ( class AActor* oCaster, float fCasterSta
 
 bool UBioSabotageScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioSabotageScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSabotageScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioSabotageScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -3111,10 +2914,9 @@ bool UBioSabotageScript::eventStartPhase ( unsigned char ePhase, class AActor* o
 
 void UBioSabotageScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioSabotageScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSabotageScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioSabotageScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -3124,14 +2926,11 @@ void UBioSabotageScript::eventInitializePowerScript ( class UBioPower* pPower )
 
 
 
-class UClass* UBioSabotageSuicideScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSabotageSuicideScript::pClassPointer { L"Class SFXGameContent_Powers.BioSabotageSuicideScript", &UObject::FindClass };
 
 class UClass* UBioSabotageSuicideScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioSabotageSuicideScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioSabotageSuicideScript.EndPhase
@@ -3143,10 +2942,9 @@ class UClass* UBioSabotageSuicideScript::StaticClass()
 
 bool UBioSabotageSuicideScript::eventEndPhase ( unsigned char ePhase, class AActor* oCaster )
 {
-	static UFunction* pFnEndPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndPhaseRef { L"Function SFXGameContent_Powers.BioSabotageSuicideScript.EndPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndPhase )
-		pFnEndPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSabotageSuicideScript.EndPhase" );
+	UFunction* const pFnEndPhase = pFnEndPhaseRef.Get ( );
 
 	UBioSabotageSuicideScript_eventEndPhase_Parms EndPhase_Parms;
 	EndPhase_Parms.ePhase = ePhase;
@@ -3164,10 +2962,9 @@ bool UBioSabotageSuicideScript::eventEndPhase ( unsigned char ePhase, class AAct
 
 void UBioSabotageSuicideScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioSabotageSuicideScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSabotageSuicideScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioSabotageSuicideScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -3177,14 +2974,11 @@ void UBioSabotageSuicideScript::eventInitializePowerScript ( class UBioPower* pP
 
 
 
-class UClass* UBioShieldBoostScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioShieldBoostScript::pClassPointer { L"Class SFXGameContent_Powers.BioShieldBoostScript", &UObject::FindClass };
 
 class UClass* UBioShieldBoostScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioShieldBoostScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioShieldBoostScript.OnImpact
@@ -3198,10 +2992,9 @@ class UClass* UBioShieldBoostScript::StaticClass()
 
 bool UBioShieldBoostScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioShieldBoostScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioShieldBoostScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioShieldBoostScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -3224,10 +3017,9 @@ bool UBioShieldBoostScript::eventOnImpact ( class AActor* oCaster, float fCaster
 
 bool UBioShieldBoostScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioShieldBoostScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioShieldBoostScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioShieldBoostScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -3247,10 +3039,9 @@ bool UBioShieldBoostScript::eventStartPhase ( unsigned char ePhase, class AActor
 
 bool UBioShieldBoostScript::eventCanStartPower ( class AActor* oCaster )
 {
-	static UFunction* pFnCanStartPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanStartPowerRef { L"Function SFXGameContent_Powers.BioShieldBoostScript.CanStartPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanStartPower )
-		pFnCanStartPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioShieldBoostScript.CanStartPower" );
+	UFunction* const pFnCanStartPower = pFnCanStartPowerRef.Get ( );
 
 	UBioShieldBoostScript_eventCanStartPower_Parms CanStartPower_Parms;
 	CanStartPower_Parms.oCaster = oCaster;
@@ -3262,14 +3053,11 @@ bool UBioShieldBoostScript::eventCanStartPower ( class AActor* oCaster )
 
 
 
-class UClass* UBioShieldEntrenchScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioShieldEntrenchScript::pClassPointer { L"Class SFXGameContent_Powers.BioShieldEntrenchScript", &UObject::FindClass };
 
 class UClass* UBioShieldEntrenchScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioShieldEntrenchScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioShieldEntrenchScript.OnImpact
@@ -3283,10 +3071,9 @@ class UClass* UBioShieldEntrenchScript::StaticClass()
 
 bool UBioShieldEntrenchScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioShieldEntrenchScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioShieldEntrenchScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioShieldEntrenchScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -3309,10 +3096,9 @@ bool UBioShieldEntrenchScript::eventOnImpact ( class AActor* oCaster, float fCas
 
 bool UBioShieldEntrenchScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioShieldEntrenchScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioShieldEntrenchScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioShieldEntrenchScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -3326,14 +3112,11 @@ bool UBioShieldEntrenchScript::eventStartPhase ( unsigned char ePhase, class AAc
 
 
 
-class UClass* UBioSiegePulseScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSiegePulseScript::pClassPointer { L"Class SFXGameContent_Powers.BioSiegePulseScript", &UObject::FindClass };
 
 class UClass* UBioSiegePulseScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioSiegePulseScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioSiegePulseScript.OnImpact
@@ -3347,10 +3130,9 @@ class UClass* UBioSiegePulseScript::StaticClass()
 
 bool UBioSiegePulseScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioSiegePulseScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSiegePulseScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioSiegePulseScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -3373,10 +3155,9 @@ bool UBioSiegePulseScript::eventOnImpact ( class AActor* oCaster, float fCasterS
 
 bool UBioSiegePulseScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioSiegePulseScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSiegePulseScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioSiegePulseScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -3395,10 +3176,9 @@ bool UBioSiegePulseScript::eventStartPhase ( unsigned char ePhase, class AActor*
 
 void UBioSiegePulseScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioSiegePulseScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSiegePulseScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioSiegePulseScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -3408,14 +3188,11 @@ void UBioSiegePulseScript::eventInitializePowerScript ( class UBioPower* pPower
 
 
 
-class UClass* UBioSingularityScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSingularityScript::pClassPointer { L"Class SFXGameContent_Powers.BioSingularityScript", &UObject::FindClass };
 
 class UClass* UBioSingularityScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioSingularityScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioSingularityScript.OnImpact
@@ -3429,10 +3206,9 @@ class UClass* UBioSingularityScript::StaticClass()
 
 bool UBioSingularityScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioSingularityScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioSingularityScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -3455,10 +3231,9 @@ bool UBioSingularityScript::eventOnImpact ( class AActor* oCaster, float fCaster
 
 bool UBioSingularityScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioSingularityScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioSingularityScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -3479,10 +3254,9 @@ bool UBioSingularityScript::eventStartPhase ( unsigned char ePhase, class AActor
 
 struct FVector UBioSingularityScript::BumpUpFromFloor ( struct FVector const& vOriginalLocation, float fBumpDistance )
 {
-	static UFunction* pFnBumpUpFromFloor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBumpUpFromFloorRef { L"Function SFXGameContent_Powers.BioSingularityScript.BumpUpFromFloor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBumpUpFromFloor )
-		pFnBumpUpFromFloor = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.BumpUpFromFloor" );
+	UFunction* const pFnBumpUpFromFloor = pFnBumpUpFromFloorRef.Get ( );
 
 	UBioSingularityScript_execBumpUpFromFloor_Parms BumpUpFromFloor_Parms;
 	memcpy ( &BumpUpFromFloor_Parms.vOriginalLocation, &vOriginalLocation, 0xC );
@@ -3500,10 +3274,9 @@ struct FVector UBioSingularityScript::BumpUpFromFloor ( struct FVector const& vO
 
 void UBioSingularityScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioSingularityScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioSingularityScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -3513,14 +3286,11 @@ void UBioSingularityScript::eventInitializePowerScript ( class UBioPower* pPower
 
 
 
-class UClass* UBioSmashScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSmashScript::pClassPointer { L"Class SFXGameContent_Powers.BioSmashScript", &UObject::FindClass };
 
 class UClass* UBioSmashScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioSmashScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioSmashScript.OnImpact
@@ -3534,10 +3304,9 @@ class UClass* UBioSmashScript::StaticClass()
 
 bool UBioSmashScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioSmashScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSmashScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioSmashScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -3560,10 +3329,9 @@ bool UBioSmashScript::eventOnImpact ( class AActor* oCaster, float fCasterStabil
 
 bool UBioSmashScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioSmashScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSmashScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioSmashScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -3582,10 +3350,9 @@ bool UBioSmashScript::eventStartPhase ( unsigned char ePhase, class AActor* oCas
 
 void UBioSmashScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioSmashScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSmashScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioSmashScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -3595,14 +3362,11 @@ void UBioSmashScript::eventInitializePowerScript ( class UBioPower* pPower )
 
 
 
-class UClass* UBioSniperCritScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSniperCritScript::pClassPointer { L"Class SFXGameContent_Powers.BioSniperCritScript", &UObject::FindClass };
 
 class UClass* UBioSniperCritScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioSniperCritScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioSniperCritScript.OnImpact
@@ -3616,10 +3380,9 @@ class UClass* UBioSniperCritScript::StaticClass()
 
 bool UBioSniperCritScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioSniperCritScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSniperCritScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioSniperCritScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -3642,10 +3405,9 @@ bool UBioSniperCritScript::eventOnImpact ( class AActor* oCaster, float fCasterS
 
 bool UBioSniperCritScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioSniperCritScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSniperCritScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioSniperCritScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -3659,14 +3421,11 @@ bool UBioSniperCritScript::eventStartPhase ( unsigned char ePhase, class AActor*
 
 
 
-class UClass* UBioStasisScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioStasisScript::pClassPointer { L"Class SFXGameContent_Powers.BioStasisScript", &UObject::FindClass };
 
 class UClass* UBioStasisScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioStasisScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioStasisScript.OnImpact
@@ -3680,10 +3439,9 @@ class UClass* UBioStasisScript::StaticClass()
 
 bool UBioStasisScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioStasisScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioStasisScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioStasisScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -3706,10 +3464,9 @@ bool UBioStasisScript::eventOnImpact ( class AActor* oCaster, float fCasterStabi
 
 bool UBioStasisScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioStasisScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioStasisScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioStasisScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -3723,14 +3480,11 @@ bool UBioStasisScript::eventStartPhase ( unsigned char ePhase, class AActor* oCa
 
 
 
-class UClass* UBioTakeDownScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioTakeDownScript::pClassPointer { L"Class SFXGameContent_Powers.BioTakeDownScript", &UObject::FindClass };
 
 class UClass* UBioTakeDownScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioTakeDownScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioTakeDownScript.OnImpact
@@ -3744,10 +3498,9 @@ class UClass* UBioTakeDownScript::StaticClass()
 
 bool UBioTakeDownScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioTakeDownScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioTakeDownScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioTakeDownScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -3770,10 +3523,9 @@ bool UBioTakeDownScript::eventOnImpact ( class AActor* oCaster, float fCasterSta
 
 bool UBioTakeDownScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioTakeDownScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioTakeDownScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioTakeDownScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -3787,14 +3539,11 @@ bool UBioTakeDownScript::eventStartPhase ( unsigned char ePhase, class AActor* o
 
 
 
-class UClass* UBioTeslaBurstScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioTeslaBurstScript::pClassPointer { L"Class SFXGameContent_Powers.BioTeslaBurstScript", &UObject::FindClass };
 
 class UClass* UBioTeslaBurstScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioTeslaBurstScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioTeslaBurstScript.OnImpact
@@ -3808,10 +3557,9 @@ class UClass* UBioTeslaBurstScript::StaticClass()
 
 bool UBioTeslaBurstScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioTeslaBurstScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioTeslaBurstScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioTeslaBurstScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -3834,10 +3582,9 @@ bool UBioTeslaBurstScript::eventOnImpact ( class AActor* oCaster, float fCasterS
 
 bool UBioTeslaBurstScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioTeslaBurstScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioTeslaBurstScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioTeslaBurstScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -3856,10 +3603,9 @@ bool UBioTeslaBurstScript::eventStartPhase ( unsigned char ePhase, class AActor*
 
 void UBioTeslaBurstScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioTeslaBurstScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioTeslaBurstScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioTeslaBurstScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -3869,14 +3615,11 @@ void UBioTeslaBurstScript::eventInitializePowerScript ( class UBioPower* pPower
 
 
 
-class UClass* UBioThrowScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioThrowScript::pClassPointer { L"Class SFXGameContent_Powers.BioThrowScript", &UObject::FindClass };
 
 class UClass* UBioThrowScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioThrowScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioThrowScript.OnImpact
@@ -3890,10 +3633,9 @@ class UClass* UBioThrowScript::StaticClass()
 
 bool UBioThrowScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioThrowScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioThrowScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioThrowScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -3916,10 +3658,9 @@ bool UBioThrowScript::eventOnImpact ( class AActor* oCaster, float fCasterStabil
 
 bool UBioThrowScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioThrowScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioThrowScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioThrowScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -3938,10 +3679,9 @@ bool UBioThrowScript::eventStartPhase ( unsigned char ePhase, class AActor* oCas
 
 void UBioThrowScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioThrowScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioThrowScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioThrowScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -3951,14 +3691,11 @@ void UBioThrowScript::eventInitializePowerScript ( class UBioPower* pPower )
 
 
 
-class UClass* UBioThrowWarpScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioThrowWarpScript::pClassPointer { L"Class SFXGameContent_Powers.BioThrowWarpScript", &UObject::FindClass };
 
 class UClass* UBioThrowWarpScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioThrowWarpScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioThrowWarpScript.OnImpact
@@ -3972,10 +3709,9 @@ class UClass* UBioThrowWarpScript::StaticClass()
 
 bool UBioThrowWarpScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioThrowWarpScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioThrowWarpScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioThrowWarpScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -3998,10 +3734,9 @@ bool UBioThrowWarpScript::eventOnImpact ( class AActor* oCaster, float fCasterSt
 
 bool UBioThrowWarpScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioThrowWarpScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioThrowWarpScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioThrowWarpScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -4020,10 +3755,9 @@ bool UBioThrowWarpScript::eventStartPhase ( unsigned char ePhase, class AActor*
 
 void UBioThrowWarpScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioThrowWarpScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioThrowWarpScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioThrowWarpScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -4033,14 +3767,11 @@ void UBioThrowWarpScript::eventInitializePowerScript ( class UBioPower* pPower )
 
 
 
-class UClass* UBioToxicSpitScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioToxicSpitScript::pClassPointer { L"Class SFXGameContent_Powers.BioToxicSpitScript", &UObject::FindClass };
 
 class UClass* UBioToxicSpitScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioToxicSpitScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioToxicSpitScript.OnImpact
@@ -4054,10 +3785,9 @@ class UClass* UBioToxicSpitScript::StaticClass()
 
 bool UBioToxicSpitScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioToxicSpitScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioToxicSpitScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioToxicSpitScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -4080,10 +3810,9 @@ bool UBioToxicSpitScript::eventOnImpact ( class AActor* oCaster, float fCasterSt
 
 bool UBioToxicSpitScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioToxicSpitScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioToxicSpitScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioToxicSpitScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -4102,10 +3831,9 @@ bool UBioToxicSpitScript::eventStartPhase ( unsigned char ePhase, class AActor*
 
 void UBioToxicSpitScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioToxicSpitScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioToxicSpitScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioToxicSpitScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -4115,14 +3843,11 @@ void UBioToxicSpitScript::eventInitializePowerScript ( class UBioPower* pPower )
 
 
 
-class UClass* UBioToxicSpitSuicideScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioToxicSpitSuicideScript::pClassPointer { L"Class SFXGameContent_Powers.BioToxicSpitSuicideScript", &UObject::FindClass };
 
 class UClass* UBioToxicSpitSuicideScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioToxicSpitSuicideScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioToxicSpitSuicideScript.EndPhase
@@ -4134,10 +3859,9 @@ class UClass* UBioToxicSpitSuicideScript::StaticClass()
 
 bool UBioToxicSpitSuicideScript::eventEndPhase ( unsigned char ePhase, class AActor* oCaster )
 {
-	static UFunction* pFnEndPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndPhaseRef { L"Function SFXGameContent_Powers.BioToxicSpitSuicideScript.EndPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndPhase )
-		pFnEndPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioToxicSpitSuicideScript.EndPhase" );
+	UFunction* const pFnEndPhase = pFnEndPhaseRef.Get ( );
 
 	UBioToxicSpitSuicideScript_eventEndPhase_Parms EndPhase_Parms;
 	EndPhase_Parms.ePhase = ePhase;
@@ -4155,10 +3879,9 @@ bool UBioToxicSpitSuicideScript::eventEndPhase ( unsigned char ePhase, class AAc
 
 void UBioToxicSpitSuicideScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioToxicSpitSuicideScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioToxicSpitSuicideScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioToxicSpitSuicideScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -4168,14 +3891,11 @@ void UBioToxicSpitSuicideScript::eventInitializePowerScript ( class UBioPower* p
 
 
 
-class UClass* UBioUnityScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioUnityScript::pClassPointer { L"Class SFXGameContent_Powers.BioUnityScript", &UObject::FindClass };
 
 class UClass* UBioUnityScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioUnityScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioUnityScript.OnImpact
@@ -4189,10 +3909,9 @@ class UClass* UBioUnityScript::StaticClass()
 
 bool UBioUnityScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioUnityScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioUnityScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioUnityScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -4213,10 +3932,9 @@ bool UBioUnityScript::eventOnImpact ( class AActor* oCaster, float fCasterStabil
 
 bool UBioUnityScript::eventCanStartPower ( class AActor* oCaster )
 {
-	static UFunction* pFnCanStartPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanStartPowerRef { L"Function SFXGameContent_Powers.BioUnityScript.CanStartPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanStartPower )
-		pFnCanStartPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioUnityScript.CanStartPower" );
+	UFunction* const pFnCanStartPower = pFnCanStartPowerRef.Get ( );
 
 	UBioUnityScript_eventCanStartPower_Parms CanStartPower_Parms;
 	CanStartPower_Parms.oCaster = oCaster;
@@ -4234,10 +3952,9 @@ bool UBioUnityScript::eventCanStartPower ( class AActor* oCaster )
 
 bool UBioUnityScript::DoesSquadHaveDeadMember ( class AActor* oActor )
 {
-	static UFunction* pFnDoesSquadHaveDeadMember = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoesSquadHaveDeadMemberRef { L"Function SFXGameContent_Powers.BioUnityScript.DoesSquadHaveDeadMember", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoesSquadHaveDeadMember )
-		pFnDoesSquadHaveDeadMember = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioUnityScript.DoesSquadHaveDeadMember" );
+	UFunction* const pFnDoesSquadHaveDeadMember = pFnDoesSquadHaveDeadMemberRef.Get ( );
 
 	UBioUnityScript_execDoesSquadHaveDeadMember_Parms DoesSquadHaveDeadMember_Parms;
 	DoesSquadHaveDeadMember_Parms.oActor = oActor;
@@ -4249,14 +3966,11 @@ bool UBioUnityScript::DoesSquadHaveDeadMember ( class AActor* oActor )
 
 
 
-class UClass* UBioWarpScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioWarpScript::pClassPointer { L"Class SFXGameContent_Powers.BioWarpScript", &UObject::FindClass };
 
 class UClass* UBioWarpScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioWarpScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioWarpScript.OnImpact
@@ -4270,10 +3984,9 @@ class UClass* UBioWarpScript::StaticClass()
 
 bool UBioWarpScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioWarpScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWarpScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioWarpScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -4296,10 +4009,9 @@ bool UBioWarpScript::eventOnImpact ( class AActor* oCaster, float fCasterStabili
 
 bool UBioWarpScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioWarpScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWarpScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioWarpScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -4318,10 +4030,9 @@ bool UBioWarpScript::eventStartPhase ( unsigned char ePhase, class AActor* oCast
 
 void UBioWarpScript::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioWarpScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWarpScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioWarpScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -4331,14 +4042,11 @@ void UBioWarpScript::eventInitializePowerScript ( class UBioPower* pPower )
 
 
 
-class UClass* UBioArmorEmitter::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioArmorEmitter::pClassPointer { L"Class SFXGameContent_Powers.BioArmorEmitter", &UObject::FindClass };
 
 class UClass* UBioArmorEmitter::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioArmorEmitter" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioArmorEmitter.OnImpact
@@ -4352,10 +4060,9 @@ class UClass* UBioArmorEmitter::StaticClass()
 
 bool UBioArmorEmitter::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioArmorEmitter.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioArmorEmitter.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioArmorEmitter_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -4378,10 +4085,9 @@ bool UBioArmorEmitter::eventOnImpact ( class AActor* oCaster, float fCasterStabi
 
 bool UBioArmorEmitter::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioArmorEmitter.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioArmorEmitter.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioArmorEmitter_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -4400,10 +4106,9 @@ bool UBioArmorEmitter::eventStartPhase ( unsigned char ePhase, class AActor* oCa
 
 void UBioArmorEmitter::eventInitializePowerScript ( class UBioPower* pPower )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioArmorEmitter.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioArmorEmitter.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioArmorEmitter_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 	InitializePowerScript_Parms.pPower = pPower;
@@ -4413,18 +4118,231 @@ void UBioArmorEmitter::eventInitializePowerScript ( class UBioPower* pPower )
 
 
 
-class UClass* UBioHealMachineScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioHealMachineScript::pClassPointer { L"Class SFXGameContent_Powers.BioHealMachineScript", &UObject::FindClass };
 
 class UClass* UBioHealMachineScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioHealMachineScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameContent_Powers.BioPowerScriptDesign",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.AdjustInventoryResource",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectCarnageSetup",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.InstantRegenerateShield",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.IncreaseAllPowerCooldowns",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.ClearAllPowerCooldowns",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectSingularity",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectRagdoll",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectEntrenchShield",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectRegenerateShield",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectDamageVulnerability",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectRegen",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectHealInstant",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectHeal",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectCombatBoost",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectImmunity",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectSniperCritical",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectOverkill",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectMarksman",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectCorrosion",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectSuppressingFire",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectZeroGLift",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectAIHacking",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectDisablePowers",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectOverheatWeapons",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectDisableWeapons",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectDisableActions",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectAdjustStability",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectDamageOverTime",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.EffectTakeDamage",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.SpawnBeacon",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.SpawnBarrier",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.WeaponPowerActivated",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.ShouldIncrementPowerUsage",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetFactionRelationship",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetTechResistance",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetBioticResistance",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetTargetResistance",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetDistanceModifier",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetDmgDurModifier",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.GetPhysicsLevel",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.IsOfRace",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.HasShields",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.IsDeadBody",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.IsPlaceable",
+	L"Function SFXGameContent_Powers.BioPowerScriptDesign.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioAdrenalineScript",
+	L"Function SFXGameContent_Powers.BioAdrenalineScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioAdrenalineScript.StartPhase",
+	L"Class SFXGameContent_Powers.BioBarrierScript",
+	L"Function SFXGameContent_Powers.BioBarrierScript.OnImpact",
+	L"Class SFXGameContent_Powers.BioCarnageScript",
+	L"Function SFXGameContent_Powers.BioCarnageScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioCarnageScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioCarnageScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioCarnageSetupScript",
+	L"Function SFXGameContent_Powers.BioCarnageSetupScript.OnImpact",
+	L"Class SFXGameContent_Powers.BioSpawnBeacon",
+	L"Function SFXGameContent_Powers.BioSpawnBeacon.OnImpact",
+	L"Function SFXGameContent_Powers.BioSpawnBeacon.EndPhase",
+	L"Function SFXGameContent_Powers.BioSpawnBeacon.StartPhase",
+	L"Function SFXGameContent_Powers.BioSpawnBeacon.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioDampingBeacon",
+	L"Class SFXGameContent_Powers.BioDampingScript",
+	L"Function SFXGameContent_Powers.BioDampingScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioDampingScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioDampingScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioDampingSuicideScript",
+	L"Function SFXGameContent_Powers.BioDampingSuicideScript.EndPhase",
+	L"Function SFXGameContent_Powers.BioDampingSuicideScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioEMPBeacon",
+	L"Class SFXGameContent_Powers.BioEMPScript",
+	L"Function SFXGameContent_Powers.BioEMPScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioEMPScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioEMPScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioEMPSuicideScript",
+	L"Function SFXGameContent_Powers.BioEMPSuicideScript.EndPhase",
+	L"Function SFXGameContent_Powers.BioEMPSuicideScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioFakePowerScript",
+	L"Function SFXGameContent_Powers.BioFakePowerScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioFakePowerScript.StartPhase",
+	L"Class SFXGameContent_Powers.BioGethCarnageScript",
+	L"Function SFXGameContent_Powers.BioGethCarnageScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioGethCarnageScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioGethCarnageScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioHackingScript",
+	L"Function SFXGameContent_Powers.BioHackingScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioHackingScript.StartPhase",
+	L"Class SFXGameContent_Powers.BioHealScript",
+	L"Function SFXGameContent_Powers.BioHealScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioHealScript.StartPhase",
+	L"Class SFXGameContent_Powers.BioHealSelfScript",
+	L"Function SFXGameContent_Powers.BioHealSelfScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioHealSelfScript.CanStartPower",
+	L"Class SFXGameContent_Powers.BioHealSquadScript",
+	L"Function SFXGameContent_Powers.BioHealSquadScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioHealSquadScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioHealSquadScript.CanStartPower",
+	L"Function SFXGameContent_Powers.BioHealSquadScript.AdjustCooldown",
+	L"Function SFXGameContent_Powers.BioHealSquadScript.DoesSquadNeedHealing",
+	L"Function SFXGameContent_Powers.BioHealSquadScript.GetCooldownMultiForSquad",
+	L"Function SFXGameContent_Powers.BioHealSquadScript.GetHealAmountForSquad",
+	L"Class SFXGameContent_Powers.BioHexBarrierScript",
+	L"Function SFXGameContent_Powers.BioHexBarrierScript.OnImpact",
+	L"Class SFXGameContent_Powers.BioImmunityScript",
+	L"Function SFXGameContent_Powers.BioImmunityScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioImmunityScript.StartPhase",
+	L"Class SFXGameContent_Powers.BioLanceArmScript",
+	L"Function SFXGameContent_Powers.BioLanceArmScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioLanceArmScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioLanceArmScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioLiftScript",
+	L"Function SFXGameContent_Powers.BioLiftScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioLiftScript.StartPhase",
+	L"Class SFXGameContent_Powers.BioLiftPLCScript",
+	L"Function SFXGameContent_Powers.BioLiftPLCScript.OnImpact",
+	L"Class SFXGameContent_Powers.BioMarksmanScript",
+	L"Function SFXGameContent_Powers.BioMarksmanScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioMarksmanScript.StartPhase",
+	L"Class SFXGameContent_Powers.BioNeuralShockScript",
+	L"Function SFXGameContent_Powers.BioNeuralShockScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioNeuralShockScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioNeuralShockScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioOverkillScript",
+	L"Function SFXGameContent_Powers.BioOverkillScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioOverkillScript.StartPhase",
+	L"Class SFXGameContent_Powers.BioRegenBurstScript",
+	L"Function SFXGameContent_Powers.BioRegenBurstScript.OnImpact",
+	L"Class SFXGameContent_Powers.BioRepairScript",
+	L"Function SFXGameContent_Powers.BioRepairScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioRepairScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioRepairScript.CanStartPower",
+	L"Function SFXGameContent_Powers.BioRepairScript.GetSquadElectronicsRank",
+	L"Class SFXGameContent_Powers.BioSabotageBeacon",
+	L"Class SFXGameContent_Powers.BioSabotageScript",
+	L"Function SFXGameContent_Powers.BioSabotageScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioSabotageScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioSabotageScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioSabotageSuicideScript",
+	L"Function SFXGameContent_Powers.BioSabotageSuicideScript.EndPhase",
+	L"Function SFXGameContent_Powers.BioSabotageSuicideScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioShieldBoostScript",
+	L"Function SFXGameContent_Powers.BioShieldBoostScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioShieldBoostScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioShieldBoostScript.CanStartPower",
+	L"Class SFXGameContent_Powers.BioShieldEntrenchScript",
+	L"Function SFXGameContent_Powers.BioShieldEntrenchScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioShieldEntrenchScript.StartPhase",
+	L"Class SFXGameContent_Powers.BioSiegePulseScript",
+	L"Function SFXGameContent_Powers.BioSiegePulseScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioSiegePulseScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioSiegePulseScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioSingularityScript",
+	L"Function SFXGameContent_Powers.BioSingularityScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioSingularityScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioSingularityScript.BumpUpFromFloor",
+	L"Function SFXGameContent_Powers.BioSingularityScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioSmashScript",
+	L"Function SFXGameContent_Powers.BioSmashScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioSmashScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioSmashScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioSniperCritScript",
+	L"Function SFXGameContent_Powers.BioSniperCritScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioSniperCritScript.StartPhase",
+	L"Class SFXGameContent_Powers.BioStasisScript",
+	L"Function SFXGameContent_Powers.BioStasisScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioStasisScript.StartPhase",
+	L"Class SFXGameContent_Powers.BioTakeDownScript",
+	L"Function SFXGameContent_Powers.BioTakeDownScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioTakeDownScript.StartPhase",
+	L"Class SFXGameContent_Powers.BioTeslaBurstScript",
+	L"Function SFXGameContent_Powers.BioTeslaBurstScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioTeslaBurstScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioTeslaBurstScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioThrowScript",
+	L"Function SFXGameContent_Powers.BioThrowScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioThrowScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioThrowScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioThrowWarpScript",
+	L"Function SFXGameContent_Powers.BioThrowWarpScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioThrowWarpScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioThrowWarpScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioToxicSpitScript",
+	L"Function SFXGameContent_Powers.BioToxicSpitScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioToxicSpitScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioToxicSpitScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioToxicSpitSuicideScript",
+	L"Function SFXGameContent_Powers.BioToxicSpitSuicideScript.EndPhase",
+	L"Function SFXGameContent_Powers.BioToxicSpitSuicideScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioUnityScript",
+	L"Function SFXGameContent_Powers.BioUnityScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioUnityScript.CanStartPower",
+	L"Function SFXGameContent_Powers.BioUnityScript.DoesSquadHaveDeadMember",
+	L"Class SFXGameContent_Powers.BioWarpScript",
+	L"Function SFXGameContent_Powers.BioWarpScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioWarpScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioWarpScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioArmorEmitter",
+	L"Function SFXGameContent_Powers.BioArmorEmitter.OnImpact",
+	L"Function SFXGameContent_Powers.BioArmorEmitter.StartPhase",
+	L"Function SFXGameContent_Powers.BioArmorEmitter.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioHealMachineScript",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
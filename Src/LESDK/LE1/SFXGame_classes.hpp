@@ -4464,7 +4464,7 @@ class UBioActorFactoryPhysicsActor : public UActorFactoryRigidBody
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4479,7 +4479,7 @@ public:
 	int                                                m_nMaterialConfig;                                		// 0x0070 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4493,7 +4493,7 @@ class ABioCoverVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4509,7 +4509,7 @@ public:
 	float                                              TimeTillDestroy;                                  		// 0x028C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4532,7 +4532,7 @@ public:
 	TArray<struct FMarkerData>                         Circles;                                          		// 0x0260 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4560,7 +4560,7 @@ public:
 	unsigned long                                      m_bIsInitialized : 1;                             		// 0x00D0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4580,7 +4580,7 @@ public:
 	class USkeletalMeshComponent*                      Mesh;                                             		// 0x0284 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4596,7 +4596,7 @@ public:
 	struct FMap_Mirror                                 m_mEventSubscriptions;                            		// 0x0060 (0x0048) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4613,7 +4613,7 @@ class ABioFollowMarker : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4630,7 +4630,7 @@ public:
 	unsigned long                                      Temp : 1;                                         		// 0x0314 (0x0004) [0x0000000000000020] [0x00000001] ( CPF_Net )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4726,7 +4726,7 @@ public:
 	unsigned long                                      m_bGamerProfileDeviceHasBeenRemoved : 1;          		// 0x02FC (0x0004) [0x0000000000002000] [0x00000040] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4802,7 +4802,7 @@ public:
 	float                                              m_aEntry[ 0xA ];                                  		// 0x006C (0x0028) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4818,7 +4818,7 @@ public:
 	int                                                LoopBackFrame;                                    		// 0x0070 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4833,7 +4833,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x48 ];                            		// 0x006C (0x0048) UNKNOWN PROPERTY: MapProperty SFXGame.BioObject.m_ClassCache
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4862,7 +4862,7 @@ public:
 	unsigned char                                      ePathNodeGenerator;                               		// 0x02E1 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4883,7 +4883,7 @@ public:
 	unsigned long                                      m_bPhysicsSoundDebug : 1;                         		// 0x0090 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4902,7 +4902,7 @@ public:
 	class UBioPower*                                   m_oPower;                                         		// 0x0078 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4926,7 +4926,7 @@ public:
 	struct FVector                                     m_vBoundarySize;                                  		// 0x0284 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4943,7 +4943,7 @@ public:
 	unsigned long                                      m_bSupressLootGui : 1;                            		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4959,7 +4959,7 @@ public:
 	TArray<class USkeletalMesh*>                       Dependents;                                       		// 0x0424 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4984,7 +4984,7 @@ public:
 	unsigned long                                      bIsOccluder : 1;                                  		// 0x0270 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5004,7 +5004,7 @@ public:
 	unsigned long                                      IsHaloComponent : 1;                              		// 0x0290 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5028,7 +5028,7 @@ public:
 	unsigned long                                      IsHaloComponent : 1;                              		// 0x02A0 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5078,7 +5078,7 @@ public:
 	unsigned long                                      bDying : 1;                                       		// 0x03AC (0x0004) [0x0000000000002000] [0x00000040] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5095,7 +5095,7 @@ public:
 	float                                              m_fTimePassed;                                    		// 0x0290 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5113,7 +5113,7 @@ public:
 	int                                                m_nPriorityLevel;                                 		// 0x02E0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5136,7 +5136,7 @@ public:
 	unsigned long                                      m_bIsShowingMissingResources : 1;                 		// 0x0070 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5157,7 +5157,7 @@ public:
 	unsigned char                                      m_eVisualOverride;                                		// 0x0089 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5172,7 +5172,7 @@ public:
 	int                                                m_nMaterial;                                      		// 0x0074 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5192,7 +5192,7 @@ public:
 	unsigned char                                      m_eVisualOverride;                                		// 0x0098 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5209,7 +5209,7 @@ public:
 	int                                                m_nHairAppearance;                                		// 0x0080 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5228,7 +5228,7 @@ public:
 	unsigned long                                      m_bIsHeadLoaded : 1;                              		// 0x0088 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5255,7 +5255,7 @@ public:
 	unsigned char                                      CurrentDifficulty;                                		// 0x00CC (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5285,7 +5285,7 @@ public:
 	unsigned long                                      bCrouchLeanRight : 1;                             		// 0x02A8 (0x0004) [0x0000000000000001] [0x00000040] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5310,7 +5310,7 @@ public:
 	unsigned long                                      ReplaceRegisteredTMWithFullHeightChar : 1;        		// 0x00E8 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5326,7 +5326,7 @@ public:
 	class UBioGrenadeInterfacePlayer*                  m_grenadeInterface;                               		// 0x07BC (0x0008) [0x0000000004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5462,7 +5462,7 @@ public:
 	unsigned char                                      bWantsToStorm;                                    		// 0x0BB7 (0x0001) [0x0000000000002004]              ( CPF_Input | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5618,7 +5618,7 @@ public:
 	unsigned char                                      Priority;                                         		// 0x00CC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5669,7 +5669,7 @@ public:
 	unsigned char                                      CurrentMode;                                      		// 0x00B8 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5742,7 +5742,7 @@ public:
 	unsigned long                                      bWeaponFired : 1;                                 		// 0x0318 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5770,7 +5770,7 @@ public:
 	unsigned char                                      PlaybackState;                                    		// 0x0080 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5792,7 +5792,7 @@ public:
 	TArray<struct FAimAssistBox>                       AimAssistRegions;                                 		// 0x007C (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5826,7 +5826,7 @@ public:
 	unsigned long                                      bDebugCover : 1;                                  		// 0x00E4 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5846,7 +5846,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x1C ];                            		// 0x0060 (0x001C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5861,7 +5861,7 @@ public:
 	TArray<struct FTrilogyGrinderAchievementData>      StaticTrilogyGrinderAchievementData;              		// 0x00C8 (0x0010) [0x0000000000404001]              ( CPF_Edit | CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5890,7 +5890,7 @@ public:
 	class UBioDamageType*                              m_pDamage;                                        		// 0x0418 (0x0008) [0x0000000004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5970,7 +5970,7 @@ public:
 	unsigned long                                      m_bIsMuzzleFlashVFXEnabled : 1;                   		// 0x0548 (0x0004) [0x0000000000000000] [0x00000040] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6105,7 +6105,7 @@ public:
 	unsigned char                                      FireMode;                                         		// 0x0259 (0x0001) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6127,7 +6127,7 @@ public:
 	class AActor*                                      Instigator;                                       		// 0x0068 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6144,7 +6144,7 @@ public:
 	unsigned char                                      m_InitalizationEventType;                         		// 0x0074 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6162,7 +6162,7 @@ class UBioActiveFall : public UBioActive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6203,7 +6203,7 @@ public:
 	unsigned char                                      m_eInitialCoverAction;                            		// 0x00D3 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6221,7 +6221,7 @@ class UBioActiveMount : public UBioActive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6288,7 +6288,7 @@ public:
 	unsigned char                                      m_eInitialCoverAction;                            		// 0x0121 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6356,7 +6356,7 @@ public:
 	unsigned char                                      m_ePendingActionState;                            		// 0x00AB (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6379,7 +6379,7 @@ public:
 	class ABioWeaponRanged*                            m_weapon;                                         		// 0x0078 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6403,7 +6403,7 @@ public:
 	unsigned long                                      bIgnoreEndingConditions : 1;                      		// 0x0098 (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6421,7 +6421,7 @@ public:
 	int                                                m_nWeaponIndex;                                   		// 0x0080 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6436,7 +6436,7 @@ class UBioActiveShootVehicleCannon : public UBioActiveShootVehicle
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6451,7 +6451,7 @@ class UBioActiveShootVehicleMachineGun : public UBioActiveShootVehicle
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6469,7 +6469,7 @@ public:
 	unsigned long                                      m_bDone : 1;                                      		// 0x0084 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6489,7 +6489,7 @@ public:
 	unsigned long                                      m_bDataInitialized : 1;                           		// 0x0070 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6513,7 +6513,7 @@ public:
 	unsigned long                                      bDone : 1;                                        		// 0x0094 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6543,7 +6543,7 @@ public:
 	unsigned char                                      m_eRangeInfoStatus;                               		// 0x00BE (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6559,7 +6559,7 @@ public:
 	class UBioActorType*                               m_oActorType;                                     		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6576,7 +6576,7 @@ public:
 	class UBioActorFactory*                            m_pFactory;                                       		// 0x0294 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6592,7 +6592,7 @@ public:
 	int                                                m_nSpawnIndex;                                    		// 0x02A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6634,7 +6634,7 @@ public:
 	unsigned long                                      m_bSuppressDisintegration : 1;                    		// 0x00D4 (0x0004) [0x0000000000000001] [0x00000400] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6652,7 +6652,7 @@ class UBioInteractiveActorType : public UBioActorType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6699,7 +6699,7 @@ public:
 	unsigned char                                      m_eRole;                                          		// 0x0142 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6716,7 +6716,7 @@ class UBioArtPlaceableInertType : public UBioArtPlaceableType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6771,7 +6771,7 @@ public:
 	unsigned char                                      m_StartingPhysicsMode;                            		// 0x022F (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6792,7 +6792,7 @@ public:
 	unsigned char                                      m_eRank;                                          		// 0x0274 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6811,7 +6811,7 @@ public:
 	unsigned long                                      m_bMovementEnabled : 1;                           		// 0x00E8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6827,7 +6827,7 @@ public:
 	class USkeletalMesh*                               m_Mesh;                                           		// 0x00E8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6843,7 +6843,7 @@ public:
 	TArray<struct FArtPlaceableRole>                   aRoles;                                           		// 0x0080 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6917,7 +6917,7 @@ public:
 	unsigned char                                      m_eLastSawTarget;                                 		// 0x0618 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7084,7 +7084,7 @@ public:
 	float                                              m_fTickTimer;                                     		// 0x0628 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7104,7 +7104,7 @@ class ABioAI_Sneaky : public ABioAI_Ambient
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7139,7 +7139,7 @@ public:
 	unsigned long                                      m_bShouldEvaluateCombatActions : 1;               		// 0x0648 (0x0004) [0x0000000000002000] [0x00000100] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7203,7 +7203,7 @@ public:
 	float                                              m_fIdealHeight;                                   		// 0x064C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7218,7 +7218,7 @@ class ABioAI_SarenFlyer : public ABioAI_Drone
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7237,7 +7237,7 @@ public:
 	unsigned long                                      m_Bumped : 1;                                     		// 0x0654 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7284,7 +7284,7 @@ public:
 	unsigned long                                      bHopping : 1;                                     		// 0x064C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7313,7 +7313,7 @@ public:
 	float                                              AngleWeight;                                      		// 0x0684 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7356,7 +7356,7 @@ public:
 	unsigned long                                      bCanDoBarrage : 1;                                		// 0x0704 (0x0004) [0x0000000000000002] [0x00000002] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7411,7 +7411,7 @@ public:
 	unsigned long                                      bExcludeFloorNodes : 1;                           		// 0x070C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7444,7 +7444,7 @@ public:
 	class UAnimNode*                                   Parent;                                           		// 0x0078 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7468,7 +7468,7 @@ public:
 	unsigned long                                      m_bShowSlider : 1;                                		// 0x0118 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7483,7 +7483,7 @@ class UBioAnimNodeBlendAdditive : public UBioAnimNodeBlendBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7500,7 +7500,7 @@ public:
 	unsigned long                                      bIsCoverAiming : 1;                               		// 0x0124 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7516,7 +7516,7 @@ public:
 	float                                              BlendOutDuration;                                 		// 0x0120 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7536,7 +7536,7 @@ public:
 	unsigned long                                      bProcessDamage : 1;                               		// 0x0134 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7553,7 +7553,7 @@ public:
 	unsigned char                                      m_eCurrentAnimNode;                               		// 0x0124 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7572,7 +7572,7 @@ public:
 	float                                              BlendOutDuration;                                 		// 0x0140 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7596,7 +7596,7 @@ public:
 	unsigned long                                      m_isFadingOut : 1;                                		// 0x0134 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7626,7 +7626,7 @@ public:
 	unsigned char                                      PreviewSliderAxis;                                		// 0x0160 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7642,7 +7642,7 @@ public:
 	unsigned long                                      bAdditiveMode : 1;                                		// 0x0120 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7670,7 +7670,7 @@ public:
 	unsigned long                                      m_bEventTriggered : 1;                            		// 0x0168 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7689,7 +7689,7 @@ public:
 	unsigned long                                      bForceLevelReferenceAngle : 1;                    		// 0x012C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7709,7 +7709,7 @@ public:
 	unsigned long                                      m_bSwitchingLean : 1;                             		// 0x0130 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7724,7 +7724,7 @@ public:
 	int                                                m_nCurrentCombatState;                            		// 0x011C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7742,7 +7742,7 @@ public:
 	unsigned long                                      m_bIsStarting : 1;                                		// 0x0128 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7758,7 +7758,7 @@ public:
 	float                                              DirAngle;                                         		// 0x0120 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7776,7 +7776,7 @@ public:
 	unsigned long                                      m_bUseFarFallAnims : 1;                           		// 0x0120 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7790,7 +7790,7 @@ class UBioAnimNodeBlendGetUp : public UBioAnimNodeBlendBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7804,7 +7804,7 @@ class UBioAnimNodeBlendMoveStop : public UBioAnimNodeBlendBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7820,7 +7820,7 @@ public:
 	int                                                m_nNumAdditiveChildren;                           		// 0x0164 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7839,7 +7839,7 @@ public:
 	unsigned long                                      m_bTriedOverride : 1;                             		// 0x0190 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7859,7 +7859,7 @@ public:
 	unsigned long                                      m_bTriedOverride : 1;                             		// 0x013C (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7885,7 +7885,7 @@ public:
 	unsigned long                                      m_bUseBlendSpanTime : 1;                          		// 0x0160 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7908,7 +7908,7 @@ public:
 	unsigned long                                      m_bFinishSkidStarted : 1;                         		// 0x0138 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7935,7 +7935,7 @@ public:
 	unsigned char                                      SpeedType;                                        		// 0x0148 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7952,7 +7952,7 @@ public:
 	int                                                m_nActiveChild;                                   		// 0x0134 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7966,7 +7966,7 @@ class UBioAnimNodeBlendTurn : public UBioAnimNodeBlendBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7984,7 +7984,7 @@ public:
 	float                                              m_toNoneBlendDuration;                            		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8004,7 +8004,7 @@ public:
 	unsigned char                                      m_currentState;                                   		// 0x0130 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8032,7 +8032,7 @@ public:
 	unsigned char                                      m_eCurrentAnimNode;                               		// 0x04E8 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8051,7 +8051,7 @@ public:
 	unsigned long                                      m_bAutoTransitionOnEndAnim : 1;                   		// 0x0140 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8065,7 +8065,7 @@ class UBioAnimNodeBlendByCustomAnim : public UAnimNodeBlend
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8087,7 +8087,7 @@ public:
 	unsigned long                                      CacheUpdated : 1;                                 		// 0x0164 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8108,7 +8108,7 @@ public:
 	unsigned long                                      m_bEventTriggered : 1;                            		// 0x0118 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8123,7 +8123,7 @@ public:
 	float                                              BlendDuration;                                    		// 0x0110 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8141,7 +8141,7 @@ public:
 	unsigned char                                      m_eCurrentAnimNode;                               		// 0x012C (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8158,7 +8158,7 @@ public:
 	float                                              m_fRate;                                          		// 0x0110 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8174,7 +8174,7 @@ public:
 	unsigned char                                      m_eCurrentAnimNode;                               		// 0x0120 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8197,7 +8197,7 @@ public:
 	unsigned char                                      BlendType;                                        		// 0x016C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8212,7 +8212,7 @@ public:
 	TArray<struct FBioAnimScalarNodeBehaviorDef>       m_aNodeDefinitions;                               		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8227,7 +8227,7 @@ public:
 	unsigned char                                      HoppingBehavior;                                  		// 0x0070 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8249,7 +8249,7 @@ public:
 	unsigned char                                      AxisDirMode;                                      		// 0x0077 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8270,7 +8270,7 @@ public:
 	float                                              RunRateScaled;                                    		// 0x013C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8286,7 +8286,7 @@ public:
 	float                                              m_fQueryPlayTime;                                 		// 0x0070 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8302,7 +8302,7 @@ public:
 	unsigned char                                      ActionBehavior;                                   		// 0x0078 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8320,7 +8320,7 @@ public:
 	unsigned char                                      CombatBehavior;                                   		// 0x0078 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8336,7 +8336,7 @@ public:
 	unsigned char                                      HoppingBehavior;                                  		// 0x0078 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8369,7 +8369,7 @@ public:
 	unsigned char                                      AxisDirMode;                                      		// 0x0096 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8396,7 +8396,7 @@ public:
 	float                                              Aimback2DefaultBlendDuration;                     		// 0x0150 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8429,7 +8429,7 @@ public:
 	unsigned char                                      RootRotationMode;                                 		// 0x013E (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8445,7 +8445,7 @@ public:
 	unsigned char                                      LastCoverAction;                                  		// 0x011C (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8462,7 +8462,7 @@ public:
 	unsigned long                                      m_bCaptureOnRelevant : 1;                         		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8479,7 +8479,7 @@ public:
 	unsigned long                                      bForceChildOnActive : 1;                          		// 0x013C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8501,7 +8501,7 @@ public:
 	unsigned long                                      bRandomizeStartTime : 1;                          		// 0x0178 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8518,7 +8518,7 @@ public:
 	unsigned char                                      BoneAxis;                                         		// 0x0154 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8534,7 +8534,7 @@ public:
 	unsigned long                                      IsGlobal : 1;                                     		// 0x0068 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8549,7 +8549,7 @@ public:
 	FString                                            SoundName;                                        		// 0x0060 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8564,7 +8564,7 @@ public:
 	struct SFXName                                     m_nmVisualEffectLabel;                            		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8582,7 +8582,7 @@ public:
 	unsigned long                                      bTransitionAllowed : 1;                           		// 0x0120 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8600,7 +8600,7 @@ public:
 	class UBioGestureRuntimeData*                      m_pRuntimeData;                                   		// 0x00A8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8616,7 +8616,7 @@ public:
 	unsigned long                                      bSeparateUpDownLimit : 1;                         		// 0x014C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8649,7 +8649,7 @@ public:
 	unsigned char                                      m_RootAnimBoneUpAxis;                             		// 0x01C1 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8674,7 +8674,7 @@ public:
 	unsigned long                                      bInvertRoll : 1;                                  		// 0x0130 (0x0004) [0x0000000000000001] [0x00000020] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8695,7 +8695,7 @@ public:
 	unsigned long                                      bPoseCached : 1;                                  		// 0x0180 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8723,7 +8723,7 @@ public:
 	unsigned char                                      m_eReportMethod;                                  		// 0x00A8 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8740,7 +8740,7 @@ class UBioAppearanceItem : public UBioBaseAppearance
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8754,7 +8754,7 @@ class UBioAppearanceItemEquippable : public UBioAppearanceItem
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8770,7 +8770,7 @@ public:
 	int                                                m_previewVariantLabel;                            		// 0x00BC (0x0004) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8791,7 +8791,7 @@ public:
 	class UAnimSet*                                    m_oPawnWeaponAnimations;                          		// 0x00D0 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8844,7 +8844,7 @@ public:
 	float                                              m_fUnitWheelRadius;                               		// 0x030C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8882,7 +8882,7 @@ public:
 	float                                              Scale;                                            		// 0x0198 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8896,7 +8896,7 @@ class UBio_Appr_Container : public UBioBaseAppearancePlaceable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8910,7 +8910,7 @@ class UBio_Appr_Door : public UBioBaseAppearancePlaceable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8924,7 +8924,7 @@ class UBio_Appr_Inert : public UBioBaseAppearancePlaceable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8938,7 +8938,7 @@ class UBio_Appr_Useable : public UBioBaseAppearancePlaceable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8983,7 +8983,7 @@ public:
 	unsigned char                                      m_TalentRaceType;                                 		// 0x018A (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9071,7 +9071,7 @@ public:
 	unsigned char                                      RagdollRecoverDirSwapBoneAxis;                    		// 0x0281 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9093,7 +9093,7 @@ public:
 	class USkeletalMesh*                               m_oModelMesh;                                     		// 0x00C4 (0x0008) [0x0000000000000009]              ( CPF_Edit | CPF_ExportObject )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9123,7 +9123,7 @@ public:
 	unsigned long                                      UseWrinkles : 1;                                  		// 0x013C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9146,7 +9146,7 @@ public:
 	unsigned char                                      m_eArmorType;                                     		// 0x0188 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9161,7 +9161,7 @@ public:
 	class UBioActorBehavior*                           m_pBioActorBehavior;                              		// 0x0060 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9179,7 +9179,7 @@ public:
 	unsigned long                                      m_bForceRunTimeUpdates : 1;                       		// 0x0078 (0x0004) [0x0000000000006000] [0x00000002] ( CPF_Transient | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9197,7 +9197,7 @@ public:
 	TArray<struct FBioVehicleTurretRunTimeInfo>        m_aTurretRuntimeInfo;                             		// 0x007C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9213,7 +9213,7 @@ class UBioInterface_Appearance_ArtPlaceable : public UBioInterface_Appearance
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9238,7 +9238,7 @@ public:
 	unsigned long                                      m_bHeadGearVisiblePreference : 1;                 		// 0x0100 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9301,7 +9301,7 @@ public:
 	unsigned long                                      m_bAlwaysTick : 1;                                		// 0x0404 (0x0004) [0x0000000000000001] [0x00000040] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9357,7 +9357,7 @@ class ABioArtPlaceableShield : public ABioArtPlaceable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9372,7 +9372,7 @@ class ABioContainer : public ABioArtPlaceable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9389,7 +9389,7 @@ public:
 	unsigned long                                      m_bSaveStateWhenPlayerEntered : 1;                		// 0x0414 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9406,7 +9406,7 @@ public:
 	class ABioArtPlaceable*                            m_oArtPlaceable;                                  		// 0x0068 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9437,7 +9437,7 @@ class UBioAPCoverMeshComponent : public UCoverMeshComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9452,7 +9452,7 @@ public:
 	unsigned long                                      m_bIsInitialized : 1;                             		// 0x006C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9512,7 +9512,7 @@ public:
 	unsigned char                                      m_nWeaponType;                                    		// 0x0315 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9544,7 +9544,7 @@ public:
 	unsigned long                                      m_MatriarchZen : 1;                               		// 0x0394 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9621,7 +9621,7 @@ public:
 	unsigned char                                      m_Race;                                           		// 0x0EB5 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9653,7 +9653,7 @@ public:
 	unsigned char                                      m_ClassBase;                                      		// 0x10EE (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9683,7 +9683,7 @@ public:
 	unsigned char                                      m_BackgroundNotoriety;                            		// 0x12B6 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9713,7 +9713,7 @@ public:
 	int                                                m_ConfigVehicleName;                              		// 0x03D4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9735,7 +9735,7 @@ public:
 	unsigned char                                      m_RaceType;                                       		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9752,7 +9752,7 @@ public:
 	int                                                m_MaterialParameterBlockIndex;                    		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9767,7 +9767,7 @@ class UBioAttributesItemEquippable : public UBioAttributesItemSophisticated
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9788,7 +9788,7 @@ public:
 	float                                              m_fInitialKinetics;                               		// 0x0244 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9802,7 +9802,7 @@ class UBioAttributesItemXModdable : public UBioAttributesItemEquippable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9832,7 +9832,7 @@ public:
 	float                                              m_fInitialResistanceToxic;                        		// 0x066C (0x0004) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9860,7 +9860,7 @@ public:
 	float                                              m_fInitialRadius;                                 		// 0x035C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9882,7 +9882,7 @@ public:
 	float                                              m_fInitialMedical;                                		// 0x0244 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9906,7 +9906,7 @@ public:
 	unsigned long                                      m_DualWield : 1;                                  		// 0x031C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9921,7 +9921,7 @@ class UBioAttributesItemWeaponMelee : public UBioAttributesItemWeapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10000,7 +10000,7 @@ public:
 	unsigned char                                      m_ePowerMode;                                     		// 0x0DF4 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10015,7 +10015,7 @@ class UBioAttributesItemXMod : public UBioAttributesItemSophisticated
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10038,7 +10038,7 @@ public:
 	unsigned long                                      m_IsRechargeable : 1;                             		// 0x01B8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10101,7 +10101,7 @@ public:
 	unsigned char                                      m_eHUDType;                                       		// 0x071C (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10175,7 +10175,7 @@ public:
 	float                                              m_fPowerHalfAngle;                                		// 0x0088 (0x0004) [0x0000000000006000]              ( CPF_Transient | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10205,7 +10205,7 @@ public:
 	unsigned long                                      bPawnIsInsideVolume : 1;                          		// 0x0304 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10236,7 +10236,7 @@ public:
 	unsigned long                                      m_bEnabled : 1;                                   		// 0x02FC (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10261,7 +10261,7 @@ public:
 	class ABioMusicVolume*                             m_oBioMusicVolume;                                		// 0x0284 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10278,7 +10278,7 @@ public:
 	int                                                ReverbPresetIndex;                                		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10294,7 +10294,7 @@ public:
 	float                                              ReverbVolume;                                     		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10390,7 +10390,7 @@ public:
 	unsigned char                                      m_eActionFrameworkErrorCode;                      		// 0x0278 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10555,7 +10555,7 @@ public:
 	unsigned char                                      Conditional;                                      		// 0x033D (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10628,7 +10628,7 @@ class UBioArtPlaceableShieldBehavior : public UBioArtPlaceableBehavior
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10680,7 +10680,7 @@ public:
 	unsigned char                                      m_eWeaponFireMode;                                		// 0x0348 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10909,7 +10909,7 @@ public:
 	unsigned char                                      m_LootGUIMechanism;                               		// 0x0586 (0x0001) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11074,7 +11074,7 @@ public:
 	unsigned long                                      m_bIsLowShield : 1;                               		// 0x03DC (0x0004) [0x0000000000000000] [0x00000200] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11141,7 +11141,7 @@ public:
 	int                                                m_nVehicleMachineGun;                             		// 0x03E4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11164,7 +11164,7 @@ class UBioPawnSquadInterface : public UBioBaseComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11186,7 +11186,7 @@ class UBioSFHandler_AdditionalContent : public UBioSFHandler
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11211,7 +11211,7 @@ public:
 	unsigned long                                      m_bWaitingForMsgBox : 1;                          		// 0x00F4 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11226,7 +11226,7 @@ class UBioSFHandler_PCAreaMap : public UBioSFHandler_AreaMap
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11253,7 +11253,7 @@ public:
 	unsigned char                                      m_eCachedEquipSlot;                               		// 0x018D (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11290,7 +11290,7 @@ public:
 	unsigned long                                      bFromAdditionalContent : 1;                       		// 0x00CC (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11321,7 +11321,7 @@ public:
 	unsigned long                                      bFromMainMenu : 1;                                		// 0x00D0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11338,7 +11338,7 @@ class UBioSFHandler_InGameManual : public UBioSFHandler_DataCodex
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11359,7 +11359,7 @@ public:
 	unsigned long                                      m_bCanInvoke : 1;                                 		// 0x0134 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11408,7 +11408,7 @@ public:
 	unsigned long                                      m_bIsSaveGame : 1;                                		// 0x00BC (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11438,7 +11438,7 @@ public:
 	unsigned long                                      m_bInPlanetPanel : 1;                             		// 0x00B8 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11455,7 +11455,7 @@ public:
 	int                                                m_srGameOverString;                               		// 0x009C (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11510,7 +11510,7 @@ public:
 	unsigned char                                      m_ePowerWheelMode;                                		// 0x0150 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11567,7 +11567,7 @@ class UBioSFHandler_PCHUD : public UBioSFHandler_HUD
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11588,7 +11588,7 @@ public:
 	float                                              m_fRScrollValue;                                  		// 0x00C4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11610,7 +11610,7 @@ public:
 	unsigned long                                      bKeyboardEntrySucceeded : 1;                      		// 0x00CC (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11642,7 +11642,7 @@ public:
 	unsigned long                                      bVerifyingSalvage : 1;                            		// 0x00E4 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11678,7 +11678,7 @@ public:
 	unsigned char                                      nSelectedEntry;                                   		// 0x00B0 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11706,7 +11706,7 @@ class UBioSFHandler_PCMainMenu : public UBioSFHandler_MainMenu
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11726,7 +11726,7 @@ public:
 	int                                                nInputCallbackContext;                            		// 0x00D4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11793,7 +11793,7 @@ public:
 	unsigned char                                      m_nLastInitializedTemplate;                       		// 0x01EF (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11852,7 +11852,7 @@ public:
 	unsigned long                                      bRightMouseDown : 1;                              		// 0x01FC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11885,7 +11885,7 @@ public:
 	unsigned char                                      m_nGuiMode;                                       		// 0x0220 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11951,7 +11951,7 @@ public:
 	unsigned char                                      m_nGuiMode;                                       		// 0x0310 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12105,7 +12105,7 @@ public:
 	FString                                            m_ActiveCharId;                                   		// 0x00AC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12136,7 +12136,7 @@ public:
 	unsigned char                                      m_eLastReticuleMode;                              		// 0x013C (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12164,7 +12164,7 @@ public:
 	unsigned char                                      m_eGuiMode;                                       		// 0x00DC (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12194,7 +12194,7 @@ public:
 	unsigned long                                      m_bCorruptSaveDirty : 1;                          		// 0x0110 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12227,7 +12227,7 @@ public:
 	int                                                m_nSaveIndex;                                     		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12251,7 +12251,7 @@ public:
 	unsigned long                                      bJournalOpenedFromMap : 1;                        		// 0x009C (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12310,7 +12310,7 @@ public:
 	unsigned char                                      m_currentSlotTypeAtIndex;                         		// 0x0171 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12363,7 +12363,7 @@ public:
 	unsigned long                                      bPressedStart : 1;                                		// 0x00B0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12387,7 +12387,7 @@ class UBioSFHandler_PCSplash : public UBioSFHandler_Splash
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12408,7 +12408,7 @@ public:
 	unsigned long                                      m_bInputModeCached : 1;                           		// 0x00AC (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12428,7 +12428,7 @@ public:
 	unsigned long                                      bMessageBoxVisible : 1;                           		// 0x00A0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12471,7 +12471,7 @@ public:
 	unsigned char                                      m_GameDifficulty;                                 		// 0x011D (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12506,7 +12506,7 @@ public:
 	unsigned long                                      m_bUpdateGameClock : 1;                           		// 0x0120 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12552,7 +12552,7 @@ public:
 	unsigned long                                      bWasBlackScreenShown : 1;                         		// 0x022C (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12636,7 +12636,7 @@ public:
 	unsigned long                                      bInitialized : 1;                                 		// 0x00E4 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12671,7 +12671,7 @@ public:
 	float                                              FocusDistanceTarget;                              		// 0x0084 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12717,7 +12717,7 @@ public:
 	unsigned long                                      bRecenterCancelled : 1;                           		// 0x0124 (0x0004) [0x0000000000000000] [0x00000400] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12759,7 +12759,7 @@ public:
 	unsigned long                                      bClampMouse : 1;                                  		// 0x0078 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12774,7 +12774,7 @@ public:
 	float                                              m_fCameraCollisionTestPointRange;                 		// 0x0128 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12788,7 +12788,7 @@ class UBioCameraBehavior : public UBioCameraUtility
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12821,7 +12821,7 @@ public:
 	unsigned long                                      m_bSavedData : 1;                                 		// 0x01BC (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12898,7 +12898,7 @@ public:
 	unsigned long                                      m_bUseInternalPlanetEvent : 1;                    		// 0x02A0 (0x0004) [0x0000000000002000] [0x00000080] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12915,7 +12915,7 @@ public:
 	struct FScreenShakeStruct                          TestShake;                                        		// 0x0090 (0x0078) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12950,7 +12950,7 @@ public:
 	unsigned long                                      bUseCameraRotation : 1;                           		// 0x058C (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12990,7 +12990,7 @@ public:
 	unsigned char                                      Variant;                                          		// 0x00F9 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13004,7 +13004,7 @@ class UBioCameraShakeInterface : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13021,7 +13021,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x48 ];                            		// 0x0070 (0x0048) UNKNOWN PROPERTY: MapProperty SFXGame.BioPawnCameraShakeInterface.m_NodeToEffectMap
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13047,7 +13047,7 @@ public:
 	unsigned char                                      m_nCapMode;                                       		// 0x008D (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13073,7 +13073,7 @@ public:
 	unsigned long                                      m_isPlayerOverrideInitialized : 1;                		// 0x0164 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13108,7 +13108,7 @@ class UBioCombatLog : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13128,7 +13128,7 @@ public:
 	class UBioDamageType*                              m_pDamage;                                        		// 0x03F0 (0x0008) [0x0000000004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13244,7 +13244,7 @@ public:
 	unsigned char                                      m_CurrentProfiler;                                		// 0x01F0 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13575,7 +13575,7 @@ public:
 	unsigned char                                      bWantsToZoom;                                     		// 0x0368 (0x0001) [0x0000000000000004]              ( CPF_Input )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13625,7 +13625,7 @@ public:
 	unsigned char                                      m_ePreviousSelectionMode;                         		// 0x00A9 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13730,7 +13730,7 @@ public:
 	unsigned long                                      m_bPlayerSexIsValid : 1;                          		// 0x02C0 (0x0004) [0x0000000000002000] [0x02000000] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13798,7 +13798,7 @@ public:
 	unsigned long                                      m_bPositionLocked : 1;                            		// 0x033C (0x0004) [0x0000000000000000] [0x00000040] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13829,7 +13829,7 @@ public:
 	unsigned long                                      m_bEnabled : 1;                                   		// 0x022C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13846,7 +13846,7 @@ public:
 	FString                                            m_sSoundSetName;                                  		// 0x00B8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13866,7 +13866,7 @@ public:
 	unsigned long                                      m_bDisplayStringId : 1;                           		// 0x0098 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13882,7 +13882,7 @@ public:
 	class UBioTlkFile*                                 m_pCurrentTlkFile;                                		// 0x00A8 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13896,7 +13896,7 @@ class UBioDeathVFXCore : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13913,7 +13913,7 @@ public:
 	struct FBioDeathVFXSpec                            m_VFX;                                            		// 0x0070 (0x0030) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13927,7 +13927,7 @@ class UBioDeathVFXControl : public UBioDeathVFXCore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13957,7 +13957,7 @@ public:
 	unsigned char                                      m_eEvent;                                         		// 0x00A4 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13972,7 +13972,7 @@ public:
 	TArray<struct FBioDeathVFXSpec>                    m_a;                                              		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13986,7 +13986,7 @@ class UBioDefine : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14005,7 +14005,7 @@ public:
 	unsigned char                                      m_eQuickSlotCurrent;                              		// 0x00B8 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14047,7 +14047,7 @@ public:
 	unsigned char                                      m_eGamePropertyEvent;                             		// 0x00A8 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14069,7 +14069,7 @@ class UBioEquipmentVehicle : public UBioEquipmentBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14086,7 +14086,7 @@ public:
 	struct FBioForceFeedbackPlayerWeaponSpec           m_aWeaponSpec[ 0x4 ];                             		// 0x00B4 (0x0030) [0x000000000442000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14101,7 +14101,7 @@ public:
 	TArray<class UBioState*>                           PlaceableStates;                                  		// 0x0060 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14125,7 +14125,7 @@ public:
 	unsigned char                                      PendingStateChange;                               		// 0x00A0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14151,7 +14151,7 @@ public:
 	unsigned long                                      bFinishAnimationBeforeTransition : 1;             		// 0x0080 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14170,7 +14170,7 @@ public:
 	struct SFXName                                     AnimationName;                                    		// 0x0070 (0x0008) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14209,7 +14209,7 @@ public:
 	unsigned long                                      m_bHUDAcknowledgedTalentNotify : 1;               		// 0x00D8 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14379,7 +14379,7 @@ public:
 	unsigned char                                      m_LevelType;                                      		// 0x0C95 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14503,7 +14503,7 @@ public:
 	float                                              m_fBlackSand;                                     		// 0x0068 (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14523,7 +14523,7 @@ public:
 	int                                                srGameOverString;                                 		// 0x04D0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14561,7 +14561,7 @@ public:
 	unsigned char                                      m_priority;                                       		// 0x0088 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14594,7 +14594,7 @@ public:
 	unsigned long                                      m_bDestinationReached : 1;                        		// 0x00D4 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14615,7 +14615,7 @@ public:
 	int                                                m_nItemPropertyID;                                		// 0x008C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14632,7 +14632,7 @@ public:
 	float                                              m_fAmount;                                        		// 0x008C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14651,7 +14651,7 @@ public:
 	unsigned char                                      m_type;                                           		// 0x0098 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14671,7 +14671,7 @@ public:
 	unsigned long                                      m_bSetToOppositeOnUnapply : 1;                    		// 0x009C (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14689,7 +14689,7 @@ public:
 	struct SFXName                                     m_powerName;                                      		// 0x00A0 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14708,7 +14708,7 @@ public:
 	unsigned char                                      m_value;                                          		// 0x00A0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14727,7 +14727,7 @@ public:
 	unsigned long                                      m_bSetToNoneOnUnapply : 1;                        		// 0x00A4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14747,7 +14747,7 @@ public:
 	unsigned char                                      m_modifier;                                       		// 0x00A1 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14764,7 +14764,7 @@ public:
 	float                                              m_value;                                          		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14782,7 +14782,7 @@ public:
 	struct SFXName                                     m_powerName;                                      		// 0x00A8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14800,7 +14800,7 @@ public:
 	struct SFXName                                     m_powerName;                                      		// 0x00A8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14819,7 +14819,7 @@ public:
 	unsigned long                                      m_bSetToZeroOnUnapply : 1;                        		// 0x00A8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14839,7 +14839,7 @@ public:
 	FString                                            m_value;                                          		// 0x009C (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14855,7 +14855,7 @@ class UBioGameEffectAttributeEnum : public UBioGameEffectAttributeString
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14873,7 +14873,7 @@ public:
 	unsigned char                                      m_eDisableType;                                   		// 0x0098 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14891,7 +14891,7 @@ public:
 	float                                              m_fDamageVulnerability;                           		// 0x008C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14909,7 +14909,7 @@ public:
 	class UBioGameProperty*                            m_pGP;                                            		// 0x008C (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14928,7 +14928,7 @@ public:
 	class ABioBaseSquad*                               m_pOriginalSquad;                                 		// 0x0094 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14946,7 +14946,7 @@ class UBioGameEffectHeadExplode : public UBioGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14965,7 +14965,7 @@ public:
 	float                                              m_fResourcesRequired;                             		// 0x0094 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14983,7 +14983,7 @@ public:
 	int                                                m_count;                                          		// 0x0090 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15001,7 +15001,7 @@ public:
 	int                                                m_count;                                          		// 0x0090 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15019,7 +15019,7 @@ public:
 	int                                                m_index;                                          		// 0x0090 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15037,7 +15037,7 @@ public:
 	unsigned long                                      m_bApplied : 1;                                   		// 0x0090 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15057,7 +15057,7 @@ public:
 	float                                              m_fBuildUpTimeout;                                		// 0x0098 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15076,7 +15076,7 @@ public:
 	struct SFXName                                     m_powerName;                                      		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15093,7 +15093,7 @@ public:
 	int                                                m_srText;                                         		// 0x008C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15111,7 +15111,7 @@ public:
 	unsigned long                                      m_bApplied : 1;                                   		// 0x008C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15129,7 +15129,7 @@ public:
 	float                                              m_fAmount;                                        		// 0x008C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15146,7 +15146,7 @@ public:
 	struct SFXName                                     m_nmMaterialParameter;                            		// 0x008C (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15164,7 +15164,7 @@ public:
 	float                                              m_fAlpha;                                         		// 0x00A0 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15180,7 +15180,7 @@ public:
 	float                                              m_fValue;                                         		// 0x0094 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15196,7 +15196,7 @@ public:
 	struct SFXName                                     m_nmTexture;                                      		// 0x0094 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15216,7 +15216,7 @@ public:
 	unsigned long                                      m_bZeroOnUnapply : 1;                             		// 0x00A8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15243,7 +15243,7 @@ public:
 	unsigned long                                      m_bApplied : 1;                                   		// 0x00C8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15263,7 +15263,7 @@ public:
 	float                                              m_fDuration;                                      		// 0x008C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15285,7 +15285,7 @@ public:
 	float                                              m_fDamage;                                        		// 0x00B4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15302,7 +15302,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x48 ];                            		// 0x006C (0x0048) UNKNOWN PROPERTY: MapProperty SFXGame.BioGameEffectImporter.m_EffectCache
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15334,7 +15334,7 @@ public:
 	unsigned char                                      m_ePropertyType;                                  		// 0x00FC (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15365,7 +15365,7 @@ public:
 	class UBioGameProperty*                            m_oOwnerGameProperty;                             		// 0x0070 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15382,7 +15382,7 @@ public:
 	unsigned char                                      m_eSlot;                                          		// 0x0078 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15396,7 +15396,7 @@ class UBioGamePropertyConditionalEquipmentChangeVehicle : public UBioGamePropert
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15410,7 +15410,7 @@ class UBioGamePropertyConditionalHasNotFired : public UBioGamePropertyConditiona
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15425,7 +15425,7 @@ public:
 	struct SFXName                                     m_nmActorType;                                    		// 0x0078 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15440,7 +15440,7 @@ class UBioGamePropertyConditionalIsAlive : public UBioGamePropertyConditional
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15455,7 +15455,7 @@ public:
 	unsigned char                                      m_eArmorType;                                     		// 0x0078 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15469,7 +15469,7 @@ class UBioGamePropertyConditionalIsCurrentArmor : public UBioGamePropertyConditi
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15483,7 +15483,7 @@ class UBioGamePropertyConditionalIsCurrentWeapon : public UBioGamePropertyCondit
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15497,7 +15497,7 @@ class UBioGamePropertyConditionalIsItem : public UBioGamePropertyConditional
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15511,7 +15511,7 @@ class UBioGamePropertyConditionalIsItemEquipped : public UBioGamePropertyConditi
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15525,7 +15525,7 @@ class UBioGamePropertyConditionalIsPawn : public UBioGamePropertyConditional
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15542,7 +15542,7 @@ public:
 	unsigned char                                      m_eWeaponRangedType;                              		// 0x007A (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15559,7 +15559,7 @@ class UBioGamePropertyConditionalIsWeapon : public UBioGamePropertyConditionalWe
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15573,7 +15573,7 @@ class UBioGamePropertyConditionalOnWeaponChange : public UBioGamePropertyConditi
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15587,7 +15587,7 @@ class UBioGamePropertyConditionalWeaponPowerUsed : public UBioGamePropertyCondit
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15601,7 +15601,7 @@ class UBioGamePropertyConditionalXModInstalled : public UBioGamePropertyConditio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15615,7 +15615,7 @@ class UBioGamePropertyConditionalXModInstalledInCurrentWeapon : public UBioGameP
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15630,7 +15630,7 @@ public:
 	unsigned char                                      m_eSlot;                                          		// 0x0078 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15644,7 +15644,7 @@ class UBioGamePropertyConditionalImporter : public UBioBaseComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15662,7 +15662,7 @@ public:
 	class UBioGamePropertyEventDispatcher*             m_oEventDispatcher;                               		// 0x0078 (0x0008) [0x0000000004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15684,7 +15684,7 @@ public:
 	TArray<struct FBioEffectLevelIteratorPair>         m_aPairs;                                         		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15701,7 +15701,7 @@ public:
 	struct FMap_Mirror                                 m_mapEventRegistry;                               		// 0x00A8 (0x0048) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15721,7 +15721,7 @@ public:
 	TArray<unsigned char>                              m_aEvents;                                        		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15748,7 +15748,7 @@ class UBioGamePropertyHolderTraits : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15768,7 +15768,7 @@ public:
 	unsigned long                                      m_bDefault2DAsLoaded : 1;                         		// 0x00C4 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15788,7 +15788,7 @@ public:
 	class UBioGamePropertyTimer*                       m_oRegisteredGPs;                                 		// 0x00D0 (0x0008) [0x0000000004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15823,7 +15823,7 @@ public:
 	struct FMap_Mirror                                 m_mapObjectPropertyToValueArray;                  		// 0x0264 (0x0048) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15842,7 +15842,7 @@ public:
 	unsigned long                                      m_bMutex : 1;                                     		// 0x0090 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15870,7 +15870,7 @@ public:
 	int                                                m_nIndex;                                         		// 0x0068 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15885,7 +15885,7 @@ public:
 	TArray<class UBioGestChainNode*>                   m_aChildren;                                      		// 0x006C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15902,7 +15902,7 @@ public:
 	struct SFXName                                     m_nmLanguage;                                     		// 0x00B8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15923,7 +15923,7 @@ public:
 	TArray<struct FBioARPUBodyConfig>                  m_aARPUItems;                                     		// 0x01D8 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15939,7 +15939,7 @@ public:
 	struct FMap_Mirror                                 m_mapCharTypeOverrides;                           		// 0x00A8 (0x0048) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15953,7 +15953,7 @@ class UBioGrenadeInterface : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15968,7 +15968,7 @@ public:
 	struct FVector                                     m_targetPoint;                                    		// 0x0060 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15982,7 +15982,7 @@ class UBioGrenadeInterfacePlayer : public UBioGrenadeInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16007,7 +16007,7 @@ public:
 	unsigned long                                      m_bComputeDrawParameters : 1;                     		// 0x00AC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16033,7 +16033,7 @@ public:
 	int                                                m_nMaxScrollPosition;                             		// 0x00D8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16095,7 +16095,7 @@ public:
 	unsigned long                                      m_bShowAnimNodeDebug : 1;                         		// 0x0664 (0x0004) [0x0000000000002000] [0x00000200] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16197,7 +16197,7 @@ public:
 	class UTextureMovie*                               m_textureMovie;                                   		// 0x0078 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16224,7 +16224,7 @@ public:
 	unsigned char                                      m_CurrentRenderMode;                              		// 0x0081 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16263,7 +16263,7 @@ public:
 	unsigned long                                      m_bLoaded : 1;                                    		// 0x0218 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16315,7 +16315,7 @@ public:
 	unsigned long                                      m_bSortByName : 1;                                		// 0x011C (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16360,7 +16360,7 @@ public:
 	int                                                m_nGeneration;                                    		// 0x00C0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16391,7 +16391,7 @@ public:
 	int                                                m_iBoneIndex;                                     		// 0x00D0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16407,7 +16407,7 @@ public:
 	FString                                            m_sCommand;                                       		// 0x00C4 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16423,7 +16423,7 @@ public:
 	FString                                            Filename;                                         		// 0x00C4 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16443,7 +16443,7 @@ public:
 	FPointer                                           Base;                                             		// 0x00E4 (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16466,7 +16466,7 @@ public:
 	class UProperty*                                   m_Property;                                       		// 0x00EC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16485,7 +16485,7 @@ public:
 	int                                                otherVal;                                         		// 0x00FC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16511,7 +16511,7 @@ public:
 	unsigned char                                      byteVal;                                          		// 0x0114 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16533,7 +16533,7 @@ public:
 	FString                                            sDisplay;                                         		// 0x00EC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16549,7 +16549,7 @@ public:
 	FString                                            Filename;                                         		// 0x00C4 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16566,7 +16566,7 @@ class UBioPropertyEditorVolatileNode : public UBioPropertyEditorBaseNode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16582,7 +16582,7 @@ public:
 	TArray<FString>                                    m_aDbgStrings;                                    		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16601,7 +16601,7 @@ public:
 	class UBioSeqAct_DebugMessage*                     m_pMsgObj;                                        		// 0x0064 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16623,7 +16623,7 @@ public:
 	float                                              m_fBlurBloomKernelSize;                           		// 0x00D0 (0x0004) [0x0000000000006000]              ( CPF_Transient | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16653,7 +16653,7 @@ public:
 	int                                                m_nCurEffect;                                     		// 0x0094 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16669,7 +16669,7 @@ public:
 	struct SFXName                                     m_nmOldShotType;                                  		// 0x00B8 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16688,7 +16688,7 @@ class UBioEvtSysTrackFuncShotInst : public UBioInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16719,7 +16719,7 @@ public:
 	unsigned char                                      eFindActorMode;                                   		// 0x010A (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16741,7 +16741,7 @@ public:
 	unsigned long                                      m_bActiveTrack : 1;                               		// 0x00B4 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16759,7 +16759,7 @@ public:
 	unsigned long                                      m_bActorChanged : 1;                              		// 0x00C8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16779,7 +16779,7 @@ public:
 	class ABioPawn*                                    m_pPawn;                                          		// 0x0064 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16797,7 +16797,7 @@ public:
 	unsigned long                                      m_bActorChanged : 1;                              		// 0x00D8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16817,7 +16817,7 @@ public:
 	class AActor*                                      m_pActor;                                         		// 0x0064 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16833,7 +16833,7 @@ public:
 	class UBioTlkFileSet*                              m_pTlkFileSet;                                    		// 0x00B8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16853,7 +16853,7 @@ public:
 	unsigned long                                      m_bAddRefTlkTable : 1;                            		// 0x0064 (0x0004) [0x0000000000001000] [0x00000001] ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16868,7 +16868,7 @@ public:
 	TArray<struct FBioCameraSwitchData>                m_aCameras;                                       		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16888,7 +16888,7 @@ public:
 	class UBioEvtSysTrackDOF*                          m_pDOFTrack;                                      		// 0x0064 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16911,7 +16911,7 @@ public:
 	unsigned long                                      m_bPlaySound : 1;                                 		// 0x0110 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16947,7 +16947,7 @@ public:
 	unsigned long                                      m_bMale : 1;                                      		// 0x0124 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16962,7 +16962,7 @@ public:
 	float                                              ResetFloat;                                       		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16979,7 +16979,7 @@ public:
 	float                                              InterpValue;                                      		// 0x00B8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16994,7 +16994,7 @@ public:
 	struct FVector                                     ResetVector;                                      		// 0x0060 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17011,7 +17011,7 @@ public:
 	class ABioVisualEffect*                            m_pParentEffect;                                  		// 0x00BC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17027,7 +17027,7 @@ public:
 	class ABioVisualEffect*                            Properties;                                       		// 0x00A0 (0x0008) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17043,7 +17043,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0068 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17058,7 +17058,7 @@ class UBioInterpolator : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17099,7 +17099,7 @@ public:
 	unsigned long                                      m_bUseLast : 1;                                   		// 0x00F0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17148,7 +17148,7 @@ public:
 	class UBioItemSelection*                           m_itemSelection;                                  		// 0x0078 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17210,7 +17210,7 @@ public:
 	unsigned char                                      m_eCurrentSlot;                                   		// 0x0154 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17263,7 +17263,7 @@ class UBioInventoryViewConsole : public UBioInventoryView
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17288,7 +17288,7 @@ public:
 	unsigned long                                      bJunkItem : 1;                                    		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17327,7 +17327,7 @@ public:
 	unsigned char                                      m_eSophistication;                                		// 0x00EA (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17356,7 +17356,7 @@ public:
 	unsigned char                                      m_eEquipmentType;                                 		// 0x00EC (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17377,7 +17377,7 @@ public:
 	TArray<struct FBioItemXModdableSlotSpec>           m_slotSpecs;                                      		// 0x00F0 (0x0010) [0x0000000004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17405,7 +17405,7 @@ public:
 	unsigned char                                      m_eArmorType;                                     		// 0x0100 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17425,7 +17425,7 @@ public:
 	class UBioAttributesShield*                        m_pShieldAttributes;                              		// 0x0104 (0x0008) [0x0000000004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17445,7 +17445,7 @@ class UBioItemBioAmp : public UBioItemXModdable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17469,7 +17469,7 @@ public:
 	class UBioAttributesDamage*                        m_pDamageAttributes;                              		// 0x0138 (0x0008) [0x0000000004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17497,7 +17497,7 @@ class UBioItemVehicleBase : public UBioItemXModdable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17518,7 +17518,7 @@ public:
 	unsigned char                                      m_eWeaponType;                                    		// 0x0128 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17536,7 +17536,7 @@ public:
 	unsigned char                                      m_eWeaponMeleeType;                               		// 0x012C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17556,7 +17556,7 @@ public:
 	unsigned char                                      m_eWeaponRangedType;                              		// 0x0138 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17580,7 +17580,7 @@ public:
 	int                                                m_type;                                           		// 0x00EC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17597,7 +17597,7 @@ class UBioItemEnumerations : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17614,7 +17614,7 @@ public:
 	struct SFXName                                     m_nmDefaultItem2DAPackage;                        		// 0x008C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17631,7 +17631,7 @@ public:
 	TArray<struct FBioSoundSet>                        m_aSoundSets;                                     		// 0x0060 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17647,7 +17647,7 @@ public:
 	unsigned long                                      m_isVolatile : 1;                                 		// 0x0068 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17662,7 +17662,7 @@ public:
 	class UBioPawnItemInterface*                       m_itemInterface;                                  		// 0x006C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17677,7 +17677,7 @@ public:
 	unsigned char                                      m_slot;                                           		// 0x0074 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17691,7 +17691,7 @@ class UBioItemSelectionInventory : public UBioItemSelectionPawn
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17707,7 +17707,7 @@ public:
 	unsigned char                                      m_weaponType;                                     		// 0x0078 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17721,7 +17721,7 @@ class UBioItemSelectionSimple : public UBioItemSelection
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17735,7 +17735,7 @@ class UBioActorFactoryLedgeMesh : public UActorFactoryStaticMesh
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17749,7 +17749,7 @@ class ABioLedgeMeshActor : public AStaticMeshActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17769,7 +17769,7 @@ public:
 	unsigned long                                      m_bDefault2DAsLoaded : 1;                         		// 0x00DC (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17796,7 +17796,7 @@ public:
 	unsigned long                                      m_bDisabling : 1;                                 		// 0x0090 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17818,7 +17818,7 @@ public:
 	unsigned char                                      RootAnimBoneUpAxis;                               		// 0x0081 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17839,7 +17839,7 @@ public:
 	unsigned long                                      m_bBody : 1;                                      		// 0x0114 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17855,7 +17855,7 @@ public:
 	class ABioPawn*                                    m_oPawn;                                          		// 0x0100 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17872,7 +17872,7 @@ public:
 	unsigned long                                      Instant : 1;                                      		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17889,7 +17889,7 @@ public:
 	struct FExpressionInput                            SpecPower;                                        		// 0x00A0 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17906,7 +17906,7 @@ public:
 	struct FExpressionInput                            SpecPower;                                        		// 0x00A0 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17924,7 +17924,7 @@ public:
 	class UTexture2D*                                  GrimeTex;                                         		// 0x0090 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17941,7 +17941,7 @@ public:
 	unsigned long                                      Inverted : 1;                                     		// 0x0084 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17955,7 +17955,7 @@ class UBioMaterialExpressionHalfAngle : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17974,7 +17974,7 @@ public:
 	int                                                FlipTexCols;                                      		// 0x00AC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17991,7 +17991,7 @@ public:
 	struct FExpressionInput                            SpecPower;                                        		// 0x00A0 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18007,7 +18007,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18022,7 +18022,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18039,7 +18039,7 @@ public:
 	TArray<struct FScalarParameter>                    m_aScalarOverrides;                               		// 0x0080 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18064,7 +18064,7 @@ public:
 	class UBioMaterialOverride*                        m_oMaterialOverrides;                             		// 0x00C8 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18088,7 +18088,7 @@ public:
 	unsigned long                                      m_bStepped : 1;                                   		// 0x0078 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18104,7 +18104,7 @@ public:
 	TArray<struct FColor>                              m_acColours;                                      		// 0x008C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18118,7 +18118,7 @@ class UBioMorphFaceFESliderHair : public UBioMorphFaceFESliderBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18137,7 +18137,7 @@ public:
 	unsigned long                                      m_bSingle : 1;                                    		// 0x00A4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18153,7 +18153,7 @@ public:
 	TArray<float>                                      m_afValues;                                       		// 0x008C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18169,7 +18169,7 @@ public:
 	TArray<float>                                      m_afValues;                                       		// 0x008C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18185,7 +18185,7 @@ public:
 	TArray<class UTexture*>                            m_atTexture;                                      		// 0x008C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18199,7 +18199,7 @@ class UBioMorphUtility : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18251,7 +18251,7 @@ public:
 	unsigned long                                      m_bFemale2DAsLoaded : 1;                          		// 0x02A0 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18290,7 +18290,7 @@ class UBioEmissionAreaList : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18305,7 +18305,7 @@ public:
 	TArray<struct FBoneListEmissionArea>               m_EmissionAreas;                                  		// 0x0060 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18324,7 +18324,7 @@ public:
 	unsigned long                                      bEnableMultiHitDecal : 1;                         		// 0x016C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18338,7 +18338,7 @@ class UBioParticleModuleEmitterSpeedBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18357,7 +18357,7 @@ public:
 	unsigned char                                      MultipliedProperty;                               		// 0x0078 (0x0001) [0x000000000200000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18379,7 +18379,7 @@ public:
 	unsigned char                                      m_SpecificationType;                              		// 0x00A4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18401,7 +18401,7 @@ public:
 	unsigned char                                      eOnCollision;                                     		// 0x00E1 (0x0001) [0x0000000002000009]              ( CPF_Edit | CPF_ExportObject | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18415,7 +18415,7 @@ class UBioParticleModuleSoundBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18432,7 +18432,7 @@ public:
 	unsigned long                                      bPerParticle : 1;                                 		// 0x0074 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18446,7 +18446,7 @@ class UBioParticleModuleVelocityWorldSpace : public UParticleModuleVelocity
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18686,7 +18686,7 @@ public:
 	unsigned char                                      CoverAction;                                      		// 0x0A56 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18923,7 +18923,7 @@ public:
 	int                                                m_nShowFlagCache;                                 		// 0x0220 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18940,7 +18940,7 @@ public:
 	class UBioPawnBehavior*                            m_oFriend;                                        		// 0x008C (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18971,7 +18971,7 @@ class ABioScout : public AScout
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18991,7 +18991,7 @@ public:
 	unsigned long                                      m_bCOSeen : 1;                                    		// 0x0298 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19007,7 +19007,7 @@ public:
 	float                                              m_fCurrentHealth;                                 		// 0x03AC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19033,7 +19033,7 @@ public:
 	float                                              MinTrackVelocity;                                 		// 0x01B0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19049,7 +19049,7 @@ public:
 	struct FMap_Mirror                                 PageMap;                                          		// 0x00A8 (0x0048) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19064,7 +19064,7 @@ public:
 	struct FMap_Mirror                                 DiscoveredCodex;                                  		// 0x0060 (0x0048) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19083,7 +19083,7 @@ public:
 	class UBio2DA*                                     oNameLookupTable;                                 		// 0x0090 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19111,7 +19111,7 @@ public:
 	struct FMap_Mirror                                 OutcomeMapping;                                   		// 0x0060 (0x0048) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19129,7 +19129,7 @@ public:
 	struct FMap_Mirror                                 FloatTaskEvalMap;                                 		// 0x0138 (0x0048) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19145,7 +19145,7 @@ public:
 	int                                                nQuestProgressCounter;                            		// 0x00A8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19161,7 +19161,7 @@ public:
 	struct FMap_Mirror                                 StateEventMap;                                    		// 0x0060 (0x0048) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19180,7 +19180,7 @@ public:
 	float                                              m_fStartTime;                                     		// 0x0090 (0x0004) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19204,7 +19204,7 @@ public:
 	unsigned long                                      bLoop : 1;                                        		// 0x009C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19231,7 +19231,7 @@ public:
 	unsigned long                                      bProjectOnShields : 1;                            		// 0x04AC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19245,7 +19245,7 @@ class UBioDecalLifetimeAgeFadeInOut : public UDecalLifetimeAge
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19263,7 +19263,7 @@ public:
 	unsigned long                                      bReused : 1;                                      		// 0x0088 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19279,7 +19279,7 @@ public:
 	class UBioEffectsMaterialsPriorityMap*             m_GlobalEffectsPriorityMap;                       		// 0x0070 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19293,7 +19293,7 @@ class UBioGrenadeVFXAppearance : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19309,7 +19309,7 @@ public:
 	TArray<class UBioVFXTemplate*>                     m_aPlaceableVFXs;                                 		// 0x0070 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19338,7 +19338,7 @@ public:
 	class UBioVFXTemplate*                             vfxReleaseEffect;                                 		// 0x00E4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19353,7 +19353,7 @@ public:
 	class UBioVFXTemplate*                             vfxThrusterBurner;                                		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19412,7 +19412,7 @@ public:
 	unsigned char                                      eCharacterMaterial;                               		// 0x014E (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19464,7 +19464,7 @@ public:
 	struct FMultiMap_Mirror                            m_mTrackMaterialVectorMap;                        		// 0x0564 (0x0048) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19494,7 +19494,7 @@ class UBioVisualEffectObserver : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19510,7 +19510,7 @@ public:
 	unsigned long                                      m_isActorDeletedOnEffectDeath : 1;                		// 0x0068 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19535,7 +19535,7 @@ public:
 	unsigned long                                      m_bInstancePoolEnabled : 1;                       		// 0x0098 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19553,7 +19553,7 @@ class UBioVisualImpactSet : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19572,7 +19572,7 @@ public:
 	class UBioVFXTemplate*                             vfxDefaultMaterialEffect;                         		// 0x00A4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19589,7 +19589,7 @@ public:
 	TArray<struct FBioVISFootstepData>                 DirtGrimeMappings;                                		// 0x00AC (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19609,7 +19609,7 @@ public:
 	float                                              ImpactRadius;                                     		// 0x00B4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19627,7 +19627,7 @@ public:
 	unsigned long                                      m_bApplyVisualEffectToFriendlies : 1;             		// 0x00AC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19642,7 +19642,7 @@ public:
 	TArray<struct FBioVISXData>                        VisualEffectMappings;                             		// 0x0060 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19676,7 +19676,7 @@ public:
 	float                                              fCooldownPerSecond;                               		// 0x00E8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19693,7 +19693,7 @@ public:
 	unsigned long                                      m_bEnablePhysicsTouch : 1;                        		// 0x0310 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19718,7 +19718,7 @@ public:
 	unsigned long                                      m_bShowDebugAiming : 1;                           		// 0x0344 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19745,7 +19745,7 @@ public:
 	float                                              m_fProximityRadius;                               		// 0x0348 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19771,7 +19771,7 @@ public:
 	unsigned long                                      m_bIsStuck : 1;                                   		// 0x0384 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19815,7 +19815,7 @@ public:
 	unsigned long                                      m_bShowPowerImpactText : 1;                       		// 0x039C (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19843,7 +19843,7 @@ public:
 	unsigned long                                      m_bChallengeScaled : 1;                           		// 0x0080 (0x0004) [0x2000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19873,7 +19873,7 @@ public:
 	unsigned char                                      m_SkillDifficulty;                                		// 0x00B1 (0x0001) [0x2000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19896,7 +19896,7 @@ public:
 	float                                              m_fRadarRange;                                    		// 0x00A8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19951,7 +19951,7 @@ public:
 	unsigned char                                      m_BackgroundNotoriety;                            		// 0x0170 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19968,7 +19968,7 @@ public:
 	FString                                            m_ActorType;                                      		// 0x00AC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19984,7 +19984,7 @@ class UBioArtPlaceableSaveObject : public UBioActorSaveObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20001,7 +20001,7 @@ public:
 	class UBioBaseSaveObject*                          m_Inventory;                                      		// 0x0078 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20021,7 +20021,7 @@ public:
 	int                                                m_nSquadLevel;                                    		// 0x008C (0x0004) [0x2000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20037,7 +20037,7 @@ public:
 	class UBioMorphFace*                               m_pFaceAsset;                                     		// 0x0080 (0x0008) [0x2000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20059,7 +20059,7 @@ public:
 	float                                              m_fResourceSalvage;                               		// 0x00A4 (0x0004) [0x2000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20079,7 +20079,7 @@ public:
 	unsigned char                                      m_eSophistication;                                		// 0x0084 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20095,7 +20095,7 @@ public:
 	int                                                m_type;                                           		// 0x0088 (0x0004) [0x2000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20110,7 +20110,7 @@ public:
 	TArray<struct FBioItemXModdableSaveObjectSlotSpec> m_aSlotSpec;                                      		// 0x0088 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20129,7 +20129,7 @@ public:
 	TArray<FString>                                    m_lstDestroyedObjects;                            		// 0x0098 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20152,7 +20152,7 @@ public:
 	TArray<struct FScalarParameter>                    m_aScalarOverrides;                               		// 0x0098 (0x0010) [0x2000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20172,7 +20172,7 @@ public:
 	unsigned long                                      m_bHeadGearVisiblePreference : 1;                 		// 0x00B8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20191,7 +20191,7 @@ public:
 	unsigned long                                      m_bVehicleFunctionEnabled : 1;                    		// 0x0088 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20266,7 +20266,7 @@ public:
 	unsigned long                                      m_bWasExternalUIActivePriorToTransition : 1;      		// 0x0290 (0x0004) [0x0000000000002000] [0x00010000] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20334,7 +20334,7 @@ public:
 	unsigned long                                      m_isInitialized : 1;                              		// 0x008C (0x0004) [0x2000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20350,7 +20350,7 @@ class UBioVehicleSaveObject : public UBioActorSaveObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20386,7 +20386,7 @@ public:
 	unsigned char                                      m_nJournalSortMethod;                             		// 0x0110 (0x0001) [0x2000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20404,7 +20404,7 @@ public:
 	class UBioBaseSaveObject*                          m_WorldInfoSave;                                  		// 0x0088 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20466,7 +20466,7 @@ public:
 	unsigned char                                      PendingModeToRemove;                              		// 0x0234 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20575,7 +20575,7 @@ public:
 	unsigned long                                      bIsGamerProfile : 1;                              		// 0x0528 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20655,7 +20655,7 @@ public:
 	float                                              m_fRadius;                                        		// 0x011C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20674,7 +20674,7 @@ public:
 	unsigned long                                      m_bEnable : 1;                                    		// 0x0110 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20691,7 +20691,7 @@ public:
 	class UGFxMovieInfo*                               m_oGalaxyMapReferenced;                           		// 0x0108 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20708,7 +20708,7 @@ public:
 	float                                              fLifeTime;                                        		// 0x0110 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20724,7 +20724,7 @@ public:
 	TArray<int>                                        m_chunkIDs;                                       		// 0x00F8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20738,7 +20738,7 @@ class UBioSeqAct_AssignFindByTag : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20759,7 +20759,7 @@ public:
 	unsigned long                                      m_bAttachToCamera : 1;                            		// 0x0124 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20775,7 +20775,7 @@ public:
 	class UBioActorType*                               m_oActorType;                                     		// 0x0174 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20800,7 +20800,7 @@ public:
 	unsigned long                                      CInclusive : 1;                                   		// 0x0110 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20818,7 +20818,7 @@ public:
 	unsigned char                                      m_nCompletionReason;                              		// 0x0110 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20836,7 +20836,7 @@ public:
 	unsigned char                                      Strategy;                                         		// 0x010C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20857,7 +20857,7 @@ public:
 	unsigned long                                      bPlayerOnly : 1;                                  		// 0x0118 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20872,7 +20872,7 @@ class UBioSeqAct_CopyPlayerHeadToTarget : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20889,7 +20889,7 @@ public:
 	unsigned char                                      Element;                                          		// 0x0108 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20908,7 +20908,7 @@ public:
 	unsigned long                                      bVisible : 1;                                     		// 0x0118 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20927,7 +20927,7 @@ public:
 	float                                              fFloat;                                           		// 0x011C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20942,7 +20942,7 @@ public:
 	int                                                m_nCompletionReason;                              		// 0x00F8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20959,7 +20959,7 @@ public:
 	int                                                m_nCompletionReason;                              		// 0x00F8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20975,7 +20975,7 @@ class UBioSeqAct_Delay : public USeqAct_Delay
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20992,7 +20992,7 @@ public:
 	unsigned long                                      m_bApplyToAllHenchmen : 1;                        		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21007,7 +21007,7 @@ public:
 	unsigned long                                      m_bEnable : 1;                                    		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21023,7 +21023,7 @@ class UBioSeqAct_EndCurrentConvNode : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21037,7 +21037,7 @@ class UBioSeqAct_EnterVehicle : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21052,7 +21052,7 @@ class UBioSeqAct_ExitVehicle : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21067,7 +21067,7 @@ class UBioSeqAct_FollowSquadLeader : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21084,7 +21084,7 @@ public:
 	unsigned long                                      bBlockOnWait : 1;                                 		// 0x0134 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21098,7 +21098,7 @@ class UBioSeqAct_ForceLightEnvUpdate : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21113,7 +21113,7 @@ public:
 	class ABioPawn*                                    oWho;                                             		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21128,7 +21128,7 @@ public:
 	int                                                m_nAchievementId;                                 		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21143,7 +21143,7 @@ public:
 	int                                                nListIndex;                                       		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21158,7 +21158,7 @@ public:
 	unsigned long                                      bGetFurthest : 1;                                 		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21176,7 +21176,7 @@ public:
 	int                                                nNumElements;                                     		// 0x0110 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21196,7 +21196,7 @@ public:
 	unsigned long                                      m_bIsEmpty : 1;                                   		// 0x0114 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21219,7 +21219,7 @@ public:
 	unsigned long                                      bPlayerOnly : 1;                                  		// 0x0120 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21235,7 +21235,7 @@ public:
 	unsigned long                                      m_ShouldHideWeapons : 1;                          		// 0x00F8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21250,7 +21250,7 @@ public:
 	int                                                m_nHighlightWorld;                                		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21264,7 +21264,7 @@ class UBioSeqAct_InitFSMode : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21279,7 +21279,7 @@ public:
 	FString                                            sMovieName;                                       		// 0x00F8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21294,7 +21294,7 @@ public:
 	class UPostProcessChain*                           PostProcess;                                      		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21317,7 +21317,7 @@ public:
 	class UClass*                                      cBehaviorType;                                    		// 0x0150 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21332,7 +21332,7 @@ class UBioSeqAct_GetProperty : public UBioSeqAct_InteractProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21346,7 +21346,7 @@ class UBioSeqAct_GetPropertyPawn : public UBioSeqAct_GetProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21360,7 +21360,7 @@ class UBioSeqAct_GetPropertyVehicle : public UBioSeqAct_GetProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21374,7 +21374,7 @@ class UBioSeqAct_ModifyProperty : public UBioSeqAct_InteractProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21388,7 +21388,7 @@ class UBioSeqAct_ModifyPropertyArtPlaceable : public UBioSeqAct_ModifyProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21403,7 +21403,7 @@ class UBioSeqAct_ModifyPropertyBaseSquad : public UBioSeqAct_ModifyProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21417,7 +21417,7 @@ class UBioSeqAct_ModifyPropertyNavigation : public UBioSeqAct_ModifyProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21431,7 +21431,7 @@ class UBioSeqAct_ModifyPropertyPawn : public UBioSeqAct_ModifyProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21446,7 +21446,7 @@ class UBioSeqAct_ModifyPropertyVehicle : public UBioSeqAct_ModifyProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21463,7 +21463,7 @@ public:
 	struct SFXName                                     m_nmSubType;                                      		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21480,7 +21480,7 @@ public:
 	unsigned char                                      m_ExitMethod;                                     		// 0x0100 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21497,7 +21497,7 @@ public:
 	class AActor*                                      oTarget;                                          		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21513,7 +21513,7 @@ public:
 	float                                              fDensity;                                         		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21530,7 +21530,7 @@ public:
 	unsigned long                                      m_bIsFinished : 1;                                		// 0x0100 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21546,7 +21546,7 @@ public:
 	class ABioMusicVolume*                             m_MusicVolume;                                    		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21562,7 +21562,7 @@ public:
 	class ABioMusicVolume*                             m_MusicVolume;                                    		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21578,7 +21578,7 @@ public:
 	unsigned long                                      m_bEnable : 1;                                    		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21597,7 +21597,7 @@ public:
 	int                                                m_nOverrideLevel;                                 		// 0x0104 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21620,7 +21620,7 @@ public:
 	class AActor*                                      m_aStage;                                         		// 0x0138 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21643,7 +21643,7 @@ public:
 	unsigned char                                      Plot;                                             		// 0x0125 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21660,7 +21660,7 @@ public:
 	unsigned char                                      Conditional;                                      		// 0x0130 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21676,7 +21676,7 @@ public:
 	unsigned char                                      State;                                            		// 0x012C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21692,7 +21692,7 @@ public:
 	unsigned char                                      Consequence;                                      		// 0x012C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21708,7 +21708,7 @@ public:
 	unsigned char                                      Transition;                                       		// 0x012C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21722,7 +21722,7 @@ class UBioSeqAct_PauseGalaxyMap : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21742,7 +21742,7 @@ public:
 	unsigned char                                      Anim;                                             		// 0x0129 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21757,7 +21757,7 @@ class UBioSeqAct_PlayLoadingMovie : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21773,7 +21773,7 @@ public:
 	unsigned char                                      m_eSoundSetType;                                  		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21788,7 +21788,7 @@ public:
 	unsigned long                                      m_bRestoreActors : 1;                             		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21804,7 +21804,7 @@ public:
 	class ABioWP_Hopper*                               m_oHopperNode;                                    		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21818,7 +21818,7 @@ class UBioSeqAct_PreloadCinematicAudio : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21835,7 +21835,7 @@ public:
 	class UPostProcessChain*                           PostProcess;                                      		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21851,7 +21851,7 @@ class UBioSeqAct_ResetAnimationState : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21876,7 +21876,7 @@ public:
 	unsigned char                                      Operation;                                        		// 0x0114 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21893,7 +21893,7 @@ public:
 	unsigned char                                      eWeapon;                                          		// 0x0100 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21912,7 +21912,7 @@ public:
 	int                                                nTargetChild;                                     		// 0x0110 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21928,7 +21928,7 @@ public:
 	unsigned long                                      m_bRestoreCamera : 1;                             		// 0x00FC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21944,7 +21944,7 @@ public:
 	float                                              m_fBlendTime;                                     		// 0x00FC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21961,7 +21961,7 @@ public:
 	unsigned char                                      GestureMode;                                      		// 0x0108 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21976,7 +21976,7 @@ public:
 	unsigned char                                      eQuality;                                         		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21992,7 +21992,7 @@ public:
 	unsigned long                                      m_bChangePCNodeIfBetweenNodes : 1;                		// 0x00FC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22012,7 +22012,7 @@ public:
 	unsigned long                                      bSetStrengthFromAnimNode : 1;                     		// 0x0114 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22028,7 +22028,7 @@ public:
 	unsigned long                                      NewValue : 1;                                     		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22045,7 +22045,7 @@ public:
 	unsigned char                                      m_eMode;                                          		// 0x0108 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22063,7 +22063,7 @@ public:
 	unsigned char                                      eWeapon;                                          		// 0x0114 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22080,7 +22080,7 @@ public:
 	unsigned char                                      eWeapon;                                          		// 0x0104 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22095,7 +22095,7 @@ class UBioSeqAct_ShouldShowSplashSequence : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22112,7 +22112,7 @@ public:
 	TArray<class UObject*>                             m_aReferencedObjects;                             		// 0x0118 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22133,7 +22133,7 @@ public:
 	unsigned long                                      m_isActivated : 1;                                		// 0x0128 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22150,7 +22150,7 @@ public:
 	class UGFxMovieInfo*                               m_oSpecializationGuiReferenced;                   		// 0x0108 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22166,7 +22166,7 @@ public:
 	unsigned long                                      bShowLegal : 1;                                   		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22197,7 +22197,7 @@ public:
 	unsigned char                                      m_CompletionState;                                		// 0x013C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22218,7 +22218,7 @@ public:
 	unsigned long                                      m_bHasBeenSet : 1;                                		// 0x0104 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22236,7 +22236,7 @@ public:
 	float                                              FadeDuration;                                     		// 0x0104 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22256,7 +22256,7 @@ public:
 	unsigned long                                      bSpawnOnLeft : 1;                                 		// 0x0110 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22274,7 +22274,7 @@ public:
 	class AActor*                                      m_oTacticalMarker;                                		// 0x0108 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22288,7 +22288,7 @@ class UBioSeqAct_StopLoadingMovie : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22308,7 +22308,7 @@ public:
 	unsigned long                                      m_bSnapToFloor : 1;                               		// 0x0108 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22325,7 +22325,7 @@ public:
 	class ABioPawn*                                    oWho;                                             		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22342,7 +22342,7 @@ public:
 	class AActor*                                      oData;                                            		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22360,7 +22360,7 @@ public:
 	class AActor*                                      oData;                                            		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22375,7 +22375,7 @@ class UBioSeqAct_ToggleLightEnv : public USeqAct_Toggle
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22389,7 +22389,7 @@ class UBioSeqAct_ToggleSidebarVisibility : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22404,7 +22404,7 @@ public:
 	class ABioPawn*                                    oPawn;                                            		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22419,7 +22419,7 @@ public:
 	unsigned long                                      m_bLogStats : 1;                                  		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22433,7 +22433,7 @@ class UBioSeqAct_UpgradeVehicle : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22449,7 +22449,7 @@ public:
 	class ABioArtPlaceable*                            oArtPlaceable;                                    		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22464,7 +22464,7 @@ public:
 	unsigned char                                      eCriteria;                                        		// 0x00DC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22479,7 +22479,7 @@ class UBioSeqCond_InCombat : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22493,7 +22493,7 @@ class UBioSeqCond_IsDriving : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22514,7 +22514,7 @@ public:
 	unsigned char                                      m_eCompletionType;                                		// 0x0080 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22538,7 +22538,7 @@ class UBioSeqData_ActionBase : public UBioSeqData
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22554,7 +22554,7 @@ public:
 	float                                              m_fTimeCount;                                     		// 0x0088 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22570,7 +22570,7 @@ public:
 	unsigned char                                      nNewWeapon;                                       		// 0x0088 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22593,7 +22593,7 @@ public:
 	unsigned long                                      m_bIgnorePerceptionCheck : 1;                     		// 0x00A0 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22612,7 +22612,7 @@ public:
 	unsigned long                                      bTerminate_LostLOS : 1;                           		// 0x009C (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22628,7 +22628,7 @@ public:
 	unsigned long                                      m_bStartUse : 1;                                  		// 0x008C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22651,7 +22651,7 @@ public:
 	unsigned long                                      m_bOrderedByPlayer : 1;                           		// 0x00AC (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22665,7 +22665,7 @@ class UBioSeqData_BehaviorBase : public UBioSeqData
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22682,7 +22682,7 @@ public:
 	class AActor*                                      oGoal;                                            		// 0x009C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22698,7 +22698,7 @@ public:
 	unsigned long                                      bWalkToAP : 1;                                    		// 0x008C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22712,7 +22712,7 @@ class UBioSeqData_CombatMode : public UBioSeqData
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22739,7 +22739,7 @@ public:
 	unsigned long                                      m_bAutoTarget : 1;                                		// 0x0124 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22754,7 +22754,7 @@ public:
 	float                                              m_fTimeToWait;                                    		// 0x0084 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22776,7 +22776,7 @@ public:
 	unsigned long                                      bUseMobMovement : 1;                              		// 0x00A8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22790,7 +22790,7 @@ class UBioSeqData_MoveOutOfPawnsWay : public UBioSeqData
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22808,7 +22808,7 @@ public:
 	unsigned long                                      m_bHasFoundCover : 1;                             		// 0x00B8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22822,7 +22822,7 @@ class UBioSeqData_StateBase : public UBioSeqData
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22839,7 +22839,7 @@ public:
 	unsigned char                                      m_Mode;                                           		// 0x009C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22855,7 +22855,7 @@ public:
 	float                                              MoveTolerance;                                    		// 0x008C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22874,7 +22874,7 @@ public:
 	unsigned long                                      bRequiresPrecisionMovement : 1;                   		// 0x0090 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22894,7 +22894,7 @@ public:
 	unsigned long                                      bRequiresPrecisionMovement : 1;                   		// 0x0094 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22913,7 +22913,7 @@ public:
 	unsigned long                                      Terminate : 1;                                    		// 0x0098 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22932,7 +22932,7 @@ public:
 	unsigned long                                      Random : 1;                                       		// 0x00A8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22949,7 +22949,7 @@ public:
 	float                                              m_fDelayAfterWalk;                                		// 0x0094 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22965,7 +22965,7 @@ public:
 	class UBioConversation*                            m_oConversation;                                  		// 0x008C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22983,7 +22983,7 @@ public:
 	unsigned long                                      m_bTerminateCover : 1;                            		// 0x0098 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23012,7 +23012,7 @@ public:
 	unsigned char                                      m_eWalkType;                                      		// 0x00A0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23026,7 +23026,7 @@ class UBioSeqEvt_AbilityDisabled : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23040,7 +23040,7 @@ class UBioSeqEvt_AbilityEnabled : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23054,7 +23054,7 @@ class UBioSeqEvt_AllActionsComplete : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23069,7 +23069,7 @@ public:
 	FString                                            sEvent;                                           		// 0x0128 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23083,7 +23083,7 @@ class UBioSeqEvt_ArtPlaceableSkillGameFailed : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23097,7 +23097,7 @@ class UBioSeqEvt_ArtPlaceableSkillGameSuccess : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23111,7 +23111,7 @@ class UBioSeqEvt_BackgroundStreamingDone : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23127,7 +23127,7 @@ public:
 	FString                                            sEvent;                                           		// 0x0128 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23144,7 +23144,7 @@ public:
 	unsigned long                                      m_bSetWaitFlags : 1;                              		// 0x0130 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23161,7 +23161,7 @@ public:
 	unsigned char                                      eScriptType;                                      		// 0x0138 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23175,7 +23175,7 @@ class UBioSeqEvt_EnterFollowFormation : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23189,7 +23189,7 @@ class UBioSeqEvt_EnterRestFormation : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23203,7 +23203,7 @@ class UBioSeqEvt_ForegroundStreamingDone : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23219,7 +23219,7 @@ public:
 	FString                                            sEvent;                                           		// 0x0128 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23233,7 +23233,7 @@ class UBioSeqEvt_LeaderChanged : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23247,7 +23247,7 @@ class UBioSeqEvt_MemberAdded : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23262,7 +23262,7 @@ class UBioSeqEvt_MemberRemoved : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23277,7 +23277,7 @@ class UBioSeqEvt_NoLongerSeePlayer : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23292,7 +23292,7 @@ class UBioSeqEvt_OnAttacked : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23306,7 +23306,7 @@ class UBioSeqEvt_OnCastAt : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23321,7 +23321,7 @@ public:
 	unsigned char                                      m_eTriggerType;                                   		// 0x0128 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23336,7 +23336,7 @@ public:
 	unsigned char                                      m_eTriggerType;                                   		// 0x0128 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23350,7 +23350,7 @@ class UBioSeqEvt_OnPlaceableStartMoving : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23365,7 +23365,7 @@ class UBioSeqEvt_OnPlaceableStopMoving : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23380,7 +23380,7 @@ class UBioSeqEvt_OnPlayerActivate : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23395,7 +23395,7 @@ class UBioSeqEvt_SeePlayer : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23410,7 +23410,7 @@ class UBioSeqEvt_VehicleEnter : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23425,7 +23425,7 @@ class UBioSeqEvt_VehicleExit : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23440,7 +23440,7 @@ class UBioSeqEvt_VehicleLeaveWorld : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23457,7 +23457,7 @@ public:
 	unsigned long                                      m_bSearchUniqueTag : 1;                           		// 0x00C4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23472,7 +23472,7 @@ public:
 	FString                                            m_sObjectTagToFind;                               		// 0x00C4 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23494,7 +23494,7 @@ public:
 	unsigned char                                      Float;                                            		// 0x00C2 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23516,7 +23516,7 @@ public:
 	unsigned char                                      Int;                                              		// 0x00C2 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23531,7 +23531,7 @@ public:
 	unsigned long                                      bHasTargets : 1;                                  		// 0x010C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23576,7 +23576,7 @@ public:
 	unsigned char                                      m_nExitCondition;                                 		// 0x01FB (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23596,7 +23596,7 @@ public:
 	unsigned long                                      bFail : 1;                                        		// 0x0128 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23618,7 +23618,7 @@ public:
 	unsigned char                                      m_eWeaponToClone;                                 		// 0x013C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23660,7 +23660,7 @@ public:
 	unsigned char                                      m_eConvLine;                                      		// 0x01DD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23686,7 +23686,7 @@ public:
 	unsigned char                                      m_eFireMode;                                      		// 0x013C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23702,7 +23702,7 @@ public:
 	FString                                            m_sMovieName;                                     		// 0x0110 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23718,7 +23718,7 @@ public:
 	float                                              m_fDelayAfterWalk;                                		// 0x0114 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23735,7 +23735,7 @@ public:
 	class UGFxMovieInfo*                               m_oCreditsReferenced;                             		// 0x0120 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23754,7 +23754,7 @@ public:
 	int                                                srText;                                           		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23772,7 +23772,7 @@ public:
 	class UGFxMovieInfo*                               m_oPartySelectGuiReferenced;                      		// 0x0120 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23793,7 +23793,7 @@ public:
 	unsigned long                                      m_bLeaderHoldPosition : 1;                        		// 0x0130 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23816,7 +23816,7 @@ public:
 	unsigned char                                      Camera;                                           		// 0x0129 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23843,7 +23843,7 @@ public:
 	unsigned long                                      m_bPlayRequested : 1;                             		// 0x0124 (0x0004) [0x0000000000002000] [0x00000100] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23864,7 +23864,7 @@ public:
 	unsigned long                                      bFailedToStart : 1;                               		// 0x012C (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23888,7 +23888,7 @@ public:
 	unsigned char                                      ePower;                                           		// 0x0144 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23903,7 +23903,7 @@ class UBioSequenceLatentStateAction : public UBioSequenceLatentAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23927,7 +23927,7 @@ public:
 	unsigned long                                      m_bDone : 1;                                      		// 0x012C (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23949,7 +23949,7 @@ public:
 	unsigned long                                      m_bDone : 1;                                      		// 0x0138 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23972,7 +23972,7 @@ public:
 	unsigned long                                      m_bDone : 1;                                      		// 0x013C (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23996,7 +23996,7 @@ public:
 	unsigned char                                      m_eWalkType;                                      		// 0x0128 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24019,7 +24019,7 @@ public:
 	unsigned char                                      m_ePendingState;                                  		// 0x008D (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24047,7 +24047,7 @@ public:
 	class UStaticMesh*                                 m_pShieldMesh;                                    		// 0x00E4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24075,7 +24075,7 @@ public:
 	unsigned char                                      m_currentFilter;                                  		// 0x037C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24119,7 +24119,7 @@ public:
 	unsigned char                                      m_GameDifficulty;                                 		// 0x00CD (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24140,7 +24140,7 @@ class UBioSoundNode_Base : public USoundNode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24156,7 +24156,7 @@ public:
 	float                                              m_fFadeTime;                                      		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24173,7 +24173,7 @@ public:
 	unsigned long                                      m_bLooping : 1;                                   		// 0x00A8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24188,7 +24188,7 @@ public:
 	TArray<struct FTransitionData>                     m_oSoundInputs;                                   		// 0x0094 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24204,7 +24204,7 @@ public:
 	int                                                m_nFeet;                                          		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24222,7 +24222,7 @@ public:
 	unsigned char                                      SquadFaction;                                     		// 0x007C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24237,7 +24237,7 @@ class UBioFaction_Hacked : public UBioFaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24251,7 +24251,7 @@ class UBioFaction_Player : public UBioFaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24265,7 +24265,7 @@ class UBioFaction_Vehicle : public UBioFaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24279,7 +24279,7 @@ class ABioSquadAPI : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24362,7 +24362,7 @@ public:
 	unsigned char                                      m_HoldMode;                                       		// 0x048F (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24624,7 +24624,7 @@ public:
 	unsigned long                                      m_bUseOffsetPositions : 1;                        		// 0x0074 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24679,7 +24679,7 @@ public:
 	unsigned char                                      m_eGameOverCondition;                             		// 0x05FD (0x0001) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24765,7 +24765,7 @@ public:
 	unsigned long                                      EnableSquadAILogging : 1;                         		// 0x04A4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24789,7 +24789,7 @@ public:
 	class AInterpActor*                                MyLift;                                           		// 0x03A0 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24811,7 +24811,7 @@ public:
 	unsigned long                                      bInited : 1;                                      		// 0x0234 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24825,7 +24825,7 @@ class UBioStickyGrenadeInterface : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24850,7 +24850,7 @@ public:
 	int                                                m_nRank;                                          		// 0x0084 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24882,7 +24882,7 @@ public:
 	unsigned long                                      m_IsLevelUpInProgress : 1;                        		// 0x00B0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24927,7 +24927,7 @@ public:
 	unsigned long                                      m_bDefault2DAsLoaded : 1;                         		// 0x009C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24965,7 +24965,7 @@ public:
 	unsigned long                                      bOptOut : 1;                                      		// 0x0140 (0x0004) [0x0000000000000000] [0x00000020] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25040,7 +25040,7 @@ public:
 	unsigned long                                      bSentBugSentryHook : 1;                           		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25057,7 +25057,7 @@ public:
 	unsigned long                                      AllowFall : 1;                                    		// 0x02C4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25075,7 +25075,7 @@ public:
 	unsigned long                                      OneShot : 1;                                      		// 0x0294 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25102,7 +25102,7 @@ public:
 	unsigned long                                      m_bDebugVehicleEnterExitSequence : 1;             		// 0x0844 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25167,7 +25167,7 @@ public:
 	unsigned long                                      bRanOutOfBoostFuel : 1;                           		// 0x08C8 (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25196,7 +25196,7 @@ public:
 	class UParticleSystem*                             m_DefaultParticleSystem;                          		// 0x0070 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25211,7 +25211,7 @@ class UBioVFXInterface : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25227,7 +25227,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x48 ];                            		// 0x0060 (0x0048) UNKNOWN PROPERTY: MapProperty SFXGame.UnVince.uniqueTagToJoinTime
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25277,7 +25277,7 @@ public:
 	unsigned char                                      Conditional;                                      		// 0x02DA (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25293,7 +25293,7 @@ public:
 	unsigned long                                      bAlwaysReachable : 1;                             		// 0x0384 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25309,7 +25309,7 @@ class ABioWP_AirPoint : public ABioPathPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25326,7 +25326,7 @@ public:
 	unsigned long                                      bHopRequired : 1;                                 		// 0x039C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25340,7 +25340,7 @@ class ABioWP_HopperCeiling : public ABioWP_Hopper
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25354,7 +25354,7 @@ class ABioWP_HopperFloor : public ABioWP_Hopper
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25368,7 +25368,7 @@ class ABioWP_HopperWall : public ABioWP_Hopper
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25385,7 +25385,7 @@ public:
 	class AActor*                                      m_oMoveDestination;                               		// 0x03A8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25404,7 +25404,7 @@ public:
 	unsigned long                                      m_bPositionLocked : 1;                            		// 0x03A4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25427,7 +25427,7 @@ public:
 	unsigned long                                      bTempDisabledCollision : 1;                       		// 0x03B8 (0x0004) [0x0000000000002002] [0x00000008] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25446,7 +25446,7 @@ class UBioWaypointLinesComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25462,7 +25462,7 @@ public:
 	unsigned long                                      AlwaysShow : 1;                                   		// 0x0294 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25480,7 +25480,7 @@ public:
 	float                                              ActivityTime;                                     		// 0x0068 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25504,7 +25504,7 @@ public:
 	int                                                m_nCurrentTwitch;                                 		// 0x00B4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25520,7 +25520,7 @@ public:
 	unsigned char                                      m_ePreferredExclusiveVFXType;                     		// 0x0064 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25537,7 +25537,7 @@ class ABioInert : public ABioArtPlaceable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25551,7 +25551,7 @@ class ABioUseable : public ABioArtPlaceable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25571,7 +25571,7 @@ public:
 	float                                              CurrentMitigatedDamage;                           		// 0x0154 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25588,7 +25588,7 @@ class UBioFaction_BaseSquad : public UBioFaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25602,7 +25602,7 @@ class ABioWp_Kismet : public ABioPathPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25622,7 +25622,7 @@ public:
 	int                                                m_nLastWeapon;                                    		// 0x0158 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25639,7 +25639,7 @@ public:
 	class USkeletalMeshComponent*                      m_skeletalMeshComponent;                          		// 0x0060 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25656,7 +25656,7 @@ class UBioVFXInterfacePawn : public UBioVFXInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25674,7 +25674,7 @@ public:
 	unsigned long                                      bCoverProtectedCone : 1;                          		// 0x0064 (0x0004) [0x0000000000004000] [0x00000004] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25688,7 +25688,7 @@ class UBioSeqEvt_KnockoutThorian : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25705,7 +25705,7 @@ public:
 	TArray<struct FChatterLineData>                    m_LastPlayedTimes;                                		// 0x0080 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25722,7 +25722,7 @@ public:
 	class ABioPathPoint*                               m_oPathPointTrigger;                              		// 0x0128 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25737,7 +25737,7 @@ public:
 	unsigned long                                      m_bWasAllowedToLeavePlaypen : 1;                  		// 0x064C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25755,7 +25755,7 @@ public:
 	struct FVector                                     m_vAvoidLocation;                                 		// 0x064C (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25774,7 +25774,7 @@ class ABioAI_Charge : public ABioAI_Core
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25790,7 +25790,7 @@ public:
 	unsigned long                                      m_bShouldAdvance : 1;                             		// 0x0658 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25808,7 +25808,7 @@ class ABioAI_AssaultDrone : public ABioAI_Drone
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25822,7 +25822,7 @@ class ABioAI_Commander : public ABioAI_Core
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25836,7 +25836,7 @@ class ABioAI_Destroyer : public ABioAI_Charge
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25850,7 +25850,7 @@ class ABioAI_Gunship : public ABioAI_Drone
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25864,7 +25864,7 @@ class ABioAI_Inactive : public ABioAiController
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25889,7 +25889,7 @@ class ABioAI_Juggernaut : public ABioAI_Core
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25903,7 +25903,7 @@ class ABioAI_Krogan : public ABioAI_HumanoidMinion
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25922,7 +25922,7 @@ class ABioAI_Melee : public ABioAI_Core
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25937,7 +25937,7 @@ public:
 	unsigned long                                      m_bAggressive : 1;                                		// 0x065C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25953,7 +25953,7 @@ class ABioAI_Rachnii : public ABioAI_Core
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25971,7 +25971,7 @@ class ABioAI_RepairDrone : public ABioAI_Drone
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25986,7 +25986,7 @@ class ABioAI_SarenFlyerJUG : public ABioAI_SarenFlyerEND
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26001,7 +26001,7 @@ class ABioAI_Sniper : public ABioAI_HumanoidMinion
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26016,7 +26016,7 @@ class ABioAIDesignController : public ABioAiController
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26030,7 +26030,7 @@ class UBioAnimNodeBlendByBiotic : public UAnimNodeBlendList
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26044,7 +26044,7 @@ class UBioAppearanceItemSimple : public UBioAppearanceItem
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26058,7 +26058,7 @@ class UBioAppearanceItemBioAmp : public UBioAppearanceItemSimple
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26072,7 +26072,7 @@ class UBioAppearanceItemOmniTool : public UBioAppearanceItemSophisticated
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26086,7 +26086,7 @@ class UBioAppearanceItemXMod : public UBioAppearanceItemSimple
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26102,7 +26102,7 @@ public:
 	struct SFXName                                     sMoveToStartPoint;                                		// 0x02CC (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26117,7 +26117,7 @@ class UBioSeqEvt_ArtPlaceableUsed : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26131,7 +26131,7 @@ class UBioSeqEvt_ArtPlaceablePlotFail : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26145,7 +26145,7 @@ class UBioSeqEvt_ArtPlaceableTransition : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26159,7 +26159,7 @@ class UBioArtPlaceableContainerType : public UBioArtPlaceableType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26173,7 +26173,7 @@ class UBioArtPlaceableDoorType : public UBioArtPlaceableType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26187,7 +26187,7 @@ class UBioArtPlaceableShieldType : public UBioArtPlaceableType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26201,7 +26201,7 @@ class UBioArtPlaceableUseableType : public UBioArtPlaceableType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26216,7 +26216,7 @@ public:
 	unsigned char                                      m_nEquipmentSlotID;                               		// 0x0104 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26230,7 +26230,7 @@ class UBioAttributesWeapon : public UBioAttributes
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26247,7 +26247,7 @@ public:
 	class APawn*                                       m_oTrackPawn;                                     		// 0x02E4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26265,7 +26265,7 @@ public:
 	class ABioAudioVolume*                             m_oBioAudioVolume;                                		// 0x0284 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26285,7 +26285,7 @@ public:
 	unsigned long                                      m_bUseEnterExitAnims : 1;                         		// 0x0088 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26316,7 +26316,7 @@ public:
 	unsigned long                                      m_bLastConstrainAspect : 1;                       		// 0x0608 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26344,7 +26344,7 @@ class UBioProceduralCameraBasic : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26367,7 +26367,7 @@ public:
 	unsigned long                                      bInterpToStart : 1;                               		// 0x0150 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26385,7 +26385,7 @@ public:
 	unsigned long                                      m_bCameraLocked : 1;                              		// 0x012C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26401,7 +26401,7 @@ class USFXWeaponStats_AssaultRifleBase : public USFXWeaponStatsBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26415,7 +26415,7 @@ class USFXWeaponStats_AvengerAssaultRifle : public USFXWeaponStats_AssaultRifleB
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26429,7 +26429,7 @@ class USFXWeaponStats_SniperRifleBase : public USFXWeaponStatsBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26443,7 +26443,7 @@ class USFXWeaponStats_Reaper : public USFXWeaponStats_SniperRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26457,7 +26457,7 @@ class USFXWeaponStats_ShotgunBase : public USFXWeaponStatsBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26471,7 +26471,7 @@ class USFXWeaponStats_Scimitar : public USFXWeaponStats_ShotgunBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26485,7 +26485,7 @@ class USFXWeaponStats_PistolBase : public USFXWeaponStatsBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26499,7 +26499,7 @@ class USFXWeaponStats_Edge : public USFXWeaponStats_PistolBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26513,7 +26513,7 @@ class USFXWeaponStats_Banshee : public USFXWeaponStats_AssaultRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26527,7 +26527,7 @@ class USFXWeaponStats_Hammer : public USFXWeaponStats_SniperRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26541,7 +26541,7 @@ class USFXWeaponStats_Hurricane : public USFXWeaponStats_ShotgunBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26555,7 +26555,7 @@ class USFXWeaponStats_StrikerPistol : public USFXWeaponStats_PistolBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26569,7 +26569,7 @@ class USFXWeaponStats_Lancer : public USFXWeaponStats_AssaultRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26583,7 +26583,7 @@ class USFXWeaponStats_AvengerSniperRifle : public USFXWeaponStats_SniperRifleBas
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26597,7 +26597,7 @@ class USFXWeaponStats_Storm : public USFXWeaponStats_ShotgunBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26611,7 +26611,7 @@ class USFXWeaponStats_Kessler : public USFXWeaponStats_PistolBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26625,7 +26625,7 @@ class USFXWeaponStats_Terminator : public USFXWeaponStats_AssaultRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26639,7 +26639,7 @@ class USFXWeaponStats_Thunder : public USFXWeaponStats_AssaultRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26653,7 +26653,7 @@ class USFXWeaponStats_Equalizer : public USFXWeaponStats_SniperRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26667,7 +26667,7 @@ class USFXWeaponStats_Tornado : public USFXWeaponStats_ShotgunBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26681,7 +26681,7 @@ class USFXWeaponStats_Stiletto : public USFXWeaponStats_PistolBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26695,7 +26695,7 @@ class USFXWeaponStats_Raptor : public USFXWeaponStats_AssaultRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26709,7 +26709,7 @@ class USFXWeaponStats_StrikerSniperRifle : public USFXWeaponStats_SniperRifleBas
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26723,7 +26723,7 @@ class USFXWeaponStats_Firestorm : public USFXWeaponStats_ShotgunBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26737,7 +26737,7 @@ class USFXWeaponStats_Stinger : public USFXWeaponStats_PistolBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26751,7 +26751,7 @@ class USFXWeaponStats_Tsunami : public USFXWeaponStats_AssaultRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26765,7 +26765,7 @@ class USFXWeaponStats_Naginata : public USFXWeaponStats_SniperRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26779,7 +26779,7 @@ class USFXWeaponStats_Katana : public USFXWeaponStats_ShotgunBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26793,7 +26793,7 @@ class USFXWeaponStats_Raikou : public USFXWeaponStats_PistolBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26807,7 +26807,7 @@ class USFXWeaponStats_Breaker : public USFXWeaponStats_AssaultRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26821,7 +26821,7 @@ class USFXWeaponStats_Harpoon : public USFXWeaponStats_SniperRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26835,7 +26835,7 @@ class USFXWeaponStats_Armageddon : public USFXWeaponStats_ShotgunBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26849,7 +26849,7 @@ class USFXWeaponStats_Razer : public USFXWeaponStats_PistolBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26863,7 +26863,7 @@ class USFXWeaponStats_Crossfire : public USFXWeaponStats_AssaultRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26877,7 +26877,7 @@ class USFXWeaponStats_Punisher : public USFXWeaponStats_SniperRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26891,7 +26891,7 @@ class USFXWeaponStats_Avalanche : public USFXWeaponStats_ShotgunBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26905,7 +26905,7 @@ class USFXWeaponStats_Brawler : public USFXWeaponStats_PistolBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26919,7 +26919,7 @@ class USFXWeaponStats_SpectreAssaultRifle : public USFXWeaponStats_AssaultRifleB
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26933,7 +26933,7 @@ class USFXWeaponStats_SpectreSniperRifle : public USFXWeaponStats_SniperRifleBas
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26947,7 +26947,7 @@ class USFXWeaponStats_SpectreShotgun : public USFXWeaponStats_ShotgunBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26961,7 +26961,7 @@ class USFXWeaponStats_SpectrePistol : public USFXWeaponStats_PistolBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26975,7 +26975,7 @@ class USFXWeaponStats_Kovalyov : public USFXWeaponStats_AssaultRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26989,7 +26989,7 @@ class USFXWeaponStats_Volkov : public USFXWeaponStats_SniperRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27003,7 +27003,7 @@ class USFXWeaponStats_Sokolov : public USFXWeaponStats_ShotgunBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27017,7 +27017,7 @@ class USFXWeaponStats_Karpov : public USFXWeaponStats_PistolBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27031,7 +27031,7 @@ class USFXWeaponStats_Geth : public USFXWeaponStats_AssaultRifleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27050,7 +27050,7 @@ public:
 	unsigned long                                      bActive : 1;                                      		// 0x02A8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27066,7 +27066,7 @@ class UBioOp : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27098,7 +27098,7 @@ public:
 	float                                              CurrentAimAssistSoftMargin;                       		// 0x00E0 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27126,7 +27126,7 @@ class UBioComplexFloatAttribute : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27140,7 +27140,7 @@ class UBioComplexIntAttribute : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27154,7 +27154,7 @@ class UBioConditionals : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27168,7 +27168,7 @@ class UBioConsequenceFunctions : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27188,7 +27188,7 @@ class UBioForm_SingleLine : public UBioFormations
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27202,7 +27202,7 @@ class UBioForm_Square : public UBioFormations
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27216,7 +27216,7 @@ class UBioForm_Triangle : public UBioFormations
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27230,7 +27230,7 @@ class UBioForm_TriangleRest : public UBioFormations
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27246,7 +27246,7 @@ public:
 	class UClass*                                      TeamClass;                                        		// 0x04C0 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27263,7 +27263,7 @@ class UBioInterface_Appearance_Car : public UBioInterface_Appearance
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27277,7 +27277,7 @@ class UBioItemOmniTool : public UBioItemXModdable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27291,7 +27291,7 @@ class ABioWeaponMelee : public ABioWeapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27315,7 +27315,7 @@ public:
 	class UBioBaseSaveObject*                          m_oMaterialOverrides;                             		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27331,7 +27331,7 @@ class UBioSeqEvt_WaypointSet_WaypointReached : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27345,7 +27345,7 @@ class UBioPathPointFactory : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27359,7 +27359,7 @@ class USFXSeqAct_ToggleElevatorMode : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27373,7 +27373,7 @@ class UBioSeqAct_SkipElevatorSequence : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27395,7 +27395,7 @@ public:
 	float                                              TargetFOV;                                        		// 0x015C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27416,7 +27416,7 @@ class USFXCameraMode_PhotoOrbit : public USFXCameraMode_Photo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27434,7 +27434,7 @@ public:
 	float                                              InputDelayTightAimExit;                           		// 0x00DC (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27481,7 +27481,7 @@ class UBioPhysMatGrenade : public UPhysicalMaterial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27495,7 +27495,7 @@ class ABioPlayerReplicationInfo : public APlayerReplicationInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27509,7 +27509,7 @@ class UBioSeqEvt_OnCombatBegin : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27523,7 +27523,7 @@ class UBioSeqEvt_OnCombatEnd : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27540,7 +27540,7 @@ public:
 	float                                              m_fVarianceTime;                                  		// 0x00A0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27556,7 +27556,7 @@ public:
 	struct SFXName                                     SecondaryWeapon;                                  		// 0x0A60 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27583,7 +27583,7 @@ public:
 	int                                                m_nPartyMember2;                                  		// 0x00C4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27607,7 +27607,7 @@ public:
 	unsigned long                                      DisableSave : 1;                                  		// 0x02D0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27625,7 +27625,7 @@ public:
 	class AActor*                                      oPerceivedSquad;                                  		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27642,7 +27642,7 @@ public:
 	unsigned long                                      m_bJoinDefaultCommoner : 1;                       		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27659,7 +27659,7 @@ public:
 	float                                              m_fAmount;                                        		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27676,7 +27676,7 @@ public:
 	struct SFXName                                     StartPoint;                                       		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27694,7 +27694,7 @@ public:
 	float                                              fLifeTime;                                        		// 0x0108 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27715,7 +27715,7 @@ public:
 	unsigned long                                      m_bActivateOnAttach : 1;                          		// 0x0124 (0x0004) [0x0000000000020001] [0x00000001] ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27735,7 +27735,7 @@ public:
 	class UBioVFXTemplate*                             m_oEffect;                                        		// 0x011C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27753,7 +27753,7 @@ public:
 	unsigned long                                      bAbort : 1;                                       		// 0x0110 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27770,7 +27770,7 @@ public:
 	unsigned char                                      AchievementId;                                    		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27789,7 +27789,7 @@ public:
 	unsigned long                                      bDisableCinematicSkip : 1;                        		// 0x010C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27805,7 +27805,7 @@ public:
 	unsigned char                                      m_eBlackScreenAction;                             		// 0x0110 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27823,7 +27823,7 @@ public:
 	unsigned long                                      bFadeOut : 1;                                     		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27843,7 +27843,7 @@ public:
 	unsigned long                                      m_bForceCinematicDamage : 1;                      		// 0x0110 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27861,7 +27861,7 @@ public:
 	unsigned long                                      SaveOldAIController : 1;                          		// 0x0108 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27878,7 +27878,7 @@ public:
 	class AActor*                                      m_oVolume;                                        		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27894,7 +27894,7 @@ class UBioSeqAct_ClearAllActions : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27909,7 +27909,7 @@ class UBioSeqAct_ClearNewCharacterEffects : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27926,7 +27926,7 @@ public:
 	FString                                            m_sChunkToClear;                                  		// 0x0108 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27941,7 +27941,7 @@ class UBioSeqAct_ClearSomeActions_Queue : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27956,7 +27956,7 @@ class UBioSeqAct_ClearSomeActions_State : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27974,7 +27974,7 @@ public:
 	int                                                m_nRank;                                          		// 0x0108 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27992,7 +27992,7 @@ public:
 	int                                                m_nRank;                                          		// 0x0108 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28009,7 +28009,7 @@ public:
 	class AActor*                                      m_oRemove;                                        		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28027,7 +28027,7 @@ public:
 	int                                                m_nRank;                                          		// 0x0108 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28044,7 +28044,7 @@ public:
 	unsigned long                                      m_bCrouch : 1;                                    		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28066,7 +28066,7 @@ public:
 	float                                              m_fCameraFocusDistanceDelta;                      		// 0x0110 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28087,7 +28087,7 @@ public:
 	int                                                m_nIndex;                                         		// 0x0124 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28107,7 +28107,7 @@ public:
 	int                                                m_nIndex;                                         		// 0x0120 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28123,7 +28123,7 @@ public:
 	unsigned long                                      bModal : 1;                                       		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28139,7 +28139,7 @@ public:
 	unsigned long                                      bModal : 1;                                       		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28156,7 +28156,7 @@ public:
 	unsigned long                                      bLeftToRight : 1;                                 		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28173,7 +28173,7 @@ public:
 	unsigned long                                      bModalBar : 1;                                    		// 0x00FC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28191,7 +28191,7 @@ public:
 	unsigned long                                      bModalBar : 1;                                    		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28208,7 +28208,7 @@ public:
 	unsigned long                                      bModalCounter : 1;                                		// 0x00FC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28224,7 +28224,7 @@ public:
 	int                                                m_nFilterID;                                      		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28240,7 +28240,7 @@ public:
 	unsigned char                                      Element;                                          		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28259,7 +28259,7 @@ public:
 	unsigned char                                      Element;                                          		// 0x0104 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28277,7 +28277,7 @@ public:
 	unsigned char                                      Element;                                          		// 0x0100 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28293,7 +28293,7 @@ public:
 	int                                                CircleState;                                      		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28309,7 +28309,7 @@ public:
 	unsigned long                                      bShow : 1;                                        		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28325,7 +28325,7 @@ public:
 	unsigned long                                      bShow : 1;                                        		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28341,7 +28341,7 @@ public:
 	unsigned long                                      bShow : 1;                                        		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28358,7 +28358,7 @@ public:
 	unsigned char                                      Element;                                          		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28374,7 +28374,7 @@ public:
 	unsigned long                                      bShow : 1;                                        		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28390,7 +28390,7 @@ public:
 	int                                                srEndGameMessage;                                 		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28407,7 +28407,7 @@ public:
 	class UObject*                                     m_oSquadB;                                        		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28432,7 +28432,7 @@ public:
 	unsigned long                                      bSquadCoverOnly : 1;                              		// 0x0130 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28448,7 +28448,7 @@ public:
 	TArray<class UObject*>                             ResourceArray;                                    		// 0x00F8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28466,7 +28466,7 @@ public:
 	class ABioArtPlaceable*                            oArtPlaceable;                                    		// 0x0118 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28483,7 +28483,7 @@ public:
 	int                                                nWeapon;                                          		// 0x0100 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28498,7 +28498,7 @@ class UBioSeqAct_GetPropertyArtPlaceable : public UBioSeqAct_GetProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28514,7 +28514,7 @@ public:
 	class AActor*                                      oSquad;                                           		// 0x0100 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28532,7 +28532,7 @@ public:
 	int                                                m_resultRank;                                     		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28548,7 +28548,7 @@ public:
 	struct SFXName                                     Tutorial;                                         		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28564,7 +28564,7 @@ public:
 	int                                                m_bonusID;                                        		// 0x00F8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28580,7 +28580,7 @@ public:
 	int                                                GrantQuantity;                                    		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28596,7 +28596,7 @@ public:
 	unsigned char                                      EXPCurve;                                         		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28611,7 +28611,7 @@ class UBioSeqAct_HUDDisplayState : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28630,7 +28630,7 @@ public:
 	int                                                m_rankIncrement;                                  		// 0x0100 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28647,7 +28647,7 @@ public:
 	class UBioConversation*                            IgnoreConversation;                               		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28663,7 +28663,7 @@ public:
 	class UBioConversation*                            Conversation;                                     		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28679,7 +28679,7 @@ public:
 	class APawn*                                       m_oPawn;                                          		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28695,7 +28695,7 @@ public:
 	struct SFXName                                     m_henchmanTag;                                    		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28711,7 +28711,7 @@ public:
 	int                                                m_nMiniGameID;                                    		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28727,7 +28727,7 @@ public:
 	FString                                            m_sMovieXMV;                                      		// 0x00F8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28743,7 +28743,7 @@ public:
 	float                                              fValue;                                           		// 0x00F8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28759,7 +28759,7 @@ public:
 	class AActor*                                      oPawn;                                            		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28775,7 +28775,7 @@ public:
 	class ABioPawn*                                    m_oPawn;                                          		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28790,7 +28790,7 @@ class UBioSeqAct_ResurrectHenchman : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28809,7 +28809,7 @@ public:
 	struct SFXName                                     nmPower;                                          		// 0x0114 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28824,7 +28824,7 @@ class UBioSeqAct_SaveCharacter : public UBioSeqAct_AutoSave
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28841,7 +28841,7 @@ public:
 	unsigned char                                      m_eActionState;                                   		// 0x0100 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28857,7 +28857,7 @@ public:
 	unsigned long                                      bSetActive : 1;                                   		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28872,7 +28872,7 @@ class UBioSeqAct_SetBase : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28888,7 +28888,7 @@ public:
 	unsigned long                                      bBusy : 1;                                        		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28905,7 +28905,7 @@ public:
 	unsigned long                                      m_bCanWalkOffLedges : 1;                          		// 0x0100 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28921,7 +28921,7 @@ public:
 	unsigned char                                      Classification;                                   		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28938,7 +28938,7 @@ public:
 	unsigned long                                      bForceInstant : 1;                                		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28955,7 +28955,7 @@ class USFXCameraMode_Explore : public USFXCameraMode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28972,7 +28972,7 @@ public:
 	unsigned long                                      m_bSetTrap : 1;                                   		// 0x0108 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28988,7 +28988,7 @@ public:
 	struct SFXName                                     m_nmMaterialParameter;                            		// 0x00F8 (0x0008) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29005,7 +29005,7 @@ public:
 	struct FColor                                      m_clr;                                            		// 0x0100 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29021,7 +29021,7 @@ public:
 	float                                              m_fScalar;                                        		// 0x0100 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29037,7 +29037,7 @@ public:
 	int                                                m_Override;                                       		// 0x00F8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29055,7 +29055,7 @@ public:
 	class APawn*                                       m_oOldPawn;                                       		// 0x0108 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29072,7 +29072,7 @@ public:
 	unsigned long                                      m_bDisabled : 1;                                  		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29089,7 +29089,7 @@ public:
 	class AActor*                                      m_oActor;                                         		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29106,7 +29106,7 @@ public:
 	float                                              m_fStab;                                          		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29122,7 +29122,7 @@ public:
 	struct SFXName                                     Tutorial;                                         		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29137,7 +29137,7 @@ class UBioSeqAct_ShieldGetAttributes : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29153,7 +29153,7 @@ public:
 	int                                                srText;                                           		// 0x009C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29169,7 +29169,7 @@ public:
 	class ABioPawn*                                    oHenchman;                                        		// 0x0110 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29187,7 +29187,7 @@ public:
 	unsigned long                                      bSetViewed : 1;                                   		// 0x0118 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29214,7 +29214,7 @@ public:
 	unsigned char                                      nIconSet;                                         		// 0x012C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29237,7 +29237,7 @@ public:
 	unsigned long                                      m_bInitiated : 1;                                 		// 0x0104 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29253,7 +29253,7 @@ class UBioSeqAct_SquadStopHoldingPosition : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29280,7 +29280,7 @@ public:
 	float                                              fWeight9;                                         		// 0x0144 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29299,7 +29299,7 @@ public:
 	class AActor*                                      oFocus;                                           		// 0x0118 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29315,7 +29315,7 @@ public:
 	unsigned long                                      m_bEnable : 1;                                    		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29332,7 +29332,7 @@ public:
 	unsigned long                                      bEnable : 1;                                      		// 0x00FC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29349,7 +29349,7 @@ public:
 	int                                                m_nAchievementId;                                 		// 0x00FC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29364,7 +29364,7 @@ class UBioSeqEvt_ElevatorSequenceSkipped : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29382,7 +29382,7 @@ public:
 	int                                                srEmpty;                                          		// 0x00B4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29405,7 +29405,7 @@ public:
 	unsigned char                                      m_eFadeMode;                                      		// 0x00A0 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29463,7 +29463,7 @@ public:
 	unsigned char                                      m_eLastDisplaySlot;                               		// 0x0155 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29527,7 +29527,7 @@ public:
 	unsigned char                                      m_eCurrentItemSlot;                               		// 0x019C (0x0001) [0x0000000004000008]              ( CPF_ExportObject | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29575,7 +29575,7 @@ public:
 	unsigned long                                      m_bWasWearingHelmet : 1;                          		// 0x00E8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29639,7 +29639,7 @@ public:
 	unsigned char                                      m_bSlotsUsed[ 0x6 ];                              		// 0x0140 (0x0006) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29671,7 +29671,7 @@ class UBioSFHandler_InventoryIGGOverride : public UBioSFHandler
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29692,7 +29692,7 @@ public:
 	unsigned long                                      m_preInitializationSucceeded : 1;                 		// 0x00C4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29716,7 +29716,7 @@ public:
 	struct FScriptDelegate                             __BioTimerDelegate__Delegate;                     		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29735,7 +29735,7 @@ public:
 	class UBioSFHandler*                               m_IGGHandler;                                     		// 0x00EC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29762,7 +29762,7 @@ public:
 	int                                                maxSquadSize;                                     		// 0x0158 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29800,7 +29800,7 @@ public:
 	unsigned char                                      InterpMethod;                                     		// 0x0188 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29852,7 +29852,7 @@ public:
 	unsigned long                                      bOldConvHandleInputThisFrame : 1;                 		// 0x0280 (0x0004) [0x0000000000002000] [0x00000100] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29907,7 +29907,7 @@ public:
 	float                                              MagnificationTransitionDuration;                  		// 0x00F4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29935,7 +29935,7 @@ public:
 	float                                              DisableMoveTime;                                  		// 0x00D0 (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29955,7 +29955,7 @@ public:
 	float                                              DisableMoveTime;                                  		// 0x00D0 (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29975,7 +29975,7 @@ public:
 	unsigned long                                      bCameraEnabled : 1;                               		// 0x00D0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29997,7 +29997,7 @@ public:
 	class USFXCameraTransition_GalaxyMap*              InstantTransition;                                		// 0x00D8 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30024,7 +30024,7 @@ public:
 	unsigned long                                      bEnableCinematicSkip : 1;                         		// 0x00F4 (0x0004) [0x0000000000004000] [0x00000002] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30044,7 +30044,7 @@ public:
 	class USFXCameraTransition_GalaxyMap*              InstantTransition;                                		// 0x00E8 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30066,7 +30066,7 @@ public:
 	unsigned long                                      bLoadingMovie : 1;                                		// 0x00E0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30086,7 +30086,7 @@ public:
 	class USFXCameraTransition_GalaxyMap*              InstantTransition;                                		// 0x00D8 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30104,7 +30104,7 @@ class USFXGameModeMinigame : public USFXGameModeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30121,7 +30121,7 @@ public:
 	class UBioCameraBehaviorFree*                      FreeCam;                                          		// 0x00D0 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30136,7 +30136,7 @@ class UBioSFHandler_PCPartySelection : public UBioSFHandler_PartySelection
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30153,7 +30153,7 @@ class UBioSFHandler_SelectCharacter : public UBioSFHandler
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30172,7 +30172,7 @@ public:
 	unsigned long                                      m_bClosedIsSkillState : 1;                        		// 0x0070 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30188,7 +30188,7 @@ class UBioSkillMap_Door : public UBioSkillMap
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30202,7 +30202,7 @@ class UBioSkillMap_Test : public UBioSkillMap
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30216,7 +30216,7 @@ class ABioStartLocation : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30230,7 +30230,7 @@ class ABioStartPoint : public ANavigationPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30244,7 +30244,7 @@ class ABioTempNavPoint : public ANavigationPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30259,7 +30259,7 @@ public:
 	TArray<struct FTwitchRec>                          m_aTwitchAnims;                                   		// 0x008C (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30273,7 +30273,7 @@ class UBioTriggerActorFactory : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30289,7 +30289,7 @@ public:
 	unsigned long                                      OneShot : 1;                                      		// 0x02C4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30307,7 +30307,7 @@ public:
 	struct FScreenShakeStruct                          TheShake;                                         		// 0x0060 (0x0078) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30321,7 +30321,7 @@ class USFXCameraShake_MakoJumpJets : public USFXCameraShakeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30335,7 +30335,7 @@ class USFXCameraShake_MakoBoost : public USFXCameraShakeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30349,7 +30349,7 @@ class UBioVehicleWheeledType : public UBioVehicleBaseType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30363,7 +30363,7 @@ class UBioWaypointSetFactory : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30377,7 +30377,7 @@ class ABioWorldInfoTick : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30395,7 +30395,7 @@ public:
 	TArray<class UBioBaseActivity*>                    m_aoActivities;                                   		// 0x02A4 (0x0010) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30409,7 +30409,7 @@ class ABioWP_AirAssault : public ABioWP_AirPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30423,7 +30423,7 @@ class ABioWp_AirDefense : public ABioWP_AirPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30437,7 +30437,7 @@ class ABioWp_AssaultPoint : public ABioPathPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30456,7 +30456,7 @@ public:
 	unsigned char                                      WalkType;                                         		// 0x039C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30472,7 +30472,7 @@ public:
 	class ABioArtPlaceable*                            oCoveringobject;                                  		// 0x0388 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30486,7 +30486,7 @@ class ABioWp_DefensePoint : public ABioPathPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30501,7 +30501,7 @@ public:
 	float                                              DelayInSeconds;                                   		// 0x0388 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30516,7 +30516,7 @@ class ABioWp_GuardPost : public ABioPathPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30534,7 +30534,7 @@ public:
 	unsigned long                                      RandomAnimation : 1;                              		// 0x03A8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30549,7 +30549,7 @@ class ABioWp_SniperPoint : public ABioPathPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30563,7 +30563,7 @@ class USFXAnimNotify_DisableProcEyeBlink : public UAnimNotify_Scripted
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30578,7 +30578,7 @@ class USFXAnimNotify_EnableProcEyeBlink : public UAnimNotify_Scripted
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30593,7 +30593,7 @@ public:
 	struct FScreenShakeStruct                          CameraShake;                                      		// 0x0060 (0x0078) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30608,7 +30608,7 @@ class USFXCameraMode_Cinematic : public USFXCameraMode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30623,7 +30623,7 @@ public:
 	class UMotionBlurEffect*                           Blur;                                             		// 0x0128 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30641,7 +30641,7 @@ public:
 	float                                              FullTurnRecenter;                                 		// 0x0134 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30659,7 +30659,7 @@ class USFXCameraMode_EnterCover : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30675,7 +30675,7 @@ public:
 	float                                              FullTurnRecenter;                                 		// 0x012C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30693,7 +30693,7 @@ class USFXCameraMode_HipAimCover : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30707,7 +30707,7 @@ class USFXCameraMode_PhotoFree : public USFXCameraMode_Photo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30725,7 +30725,7 @@ public:
 	float                                              FOVInterpFactor;                                  		// 0x0134 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30741,7 +30741,7 @@ class USFXCameraMode_SniperAim : public USFXCameraMode_TightAim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30758,7 +30758,7 @@ public:
 	unsigned long                                      bFirstUpdate : 1;                                 		// 0x0134 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30776,7 +30776,7 @@ class USFXCameraMode_VehicleTightAim : public USFXCameraMode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30790,7 +30790,7 @@ class USFXCameraMode_VehicleTightAimEx : public USFXCameraMode_VehicleTightAim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30807,7 +30807,7 @@ public:
 	struct FVector                                     StartLocation;                                    		// 0x01A4 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30874,7 +30874,7 @@ public:
 	unsigned long                                      bPowerTriggeredLean : 1;                          		// 0x01AC (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30896,7 +30896,7 @@ public:
 	struct FVector                                     StartLocation;                                    		// 0x01A4 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30912,7 +30912,7 @@ class USFXCameraTransition_GalaxyMap : public USFXCameraMode_Interpolate
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30928,7 +30928,7 @@ class USFXGameViewportClient : public UGFxGameViewportClient
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30949,7 +30949,7 @@ public:
 	float                                              Distance;                                         		// 0x0134 (0x0004) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30966,7 +30966,7 @@ public:
 	class ABioBaseSquad*                               m_oSquad;                                         		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30982,7 +30982,7 @@ public:
 	int                                                TextureBlockBehavior;                             		// 0x00F8 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -231,7 +231,7 @@ public:
 	unsigned char                                      Outcome;                                          		// 0x0082 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -268,7 +268,7 @@ public:
 	int                                                m_nInteger;                                       		// 0x0084 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -292,7 +292,7 @@ public:
 	unsigned char                                      LocalUserNum;                                     		// 0x00D0 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -307,7 +307,7 @@ public:
 	FString                                            StringData;                                       		// 0x0084 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -325,7 +325,7 @@ public:
 	int                                                m_nPriority;                                      		// 0x00A4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -344,7 +344,7 @@ public:
 	TArray<class USFXOnlineEvent*>                     EventList;                                        		// 0x0060 (0x0010) [0x0000000000500000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -365,7 +365,7 @@ class UISFXOnlineComponent : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -382,7 +382,7 @@ class UISFXOnlineComponentAPI : public UISFXOnlineComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -397,7 +397,7 @@ class UISFXOnlineComponentAchievement : public UISFXOnlineComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -415,7 +415,7 @@ class UISFXOnlineComponentLogin : public UISFXOnlineComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -473,7 +473,7 @@ class UISFXOnlineComponentNotification : public UISFXOnlineComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -499,7 +499,7 @@ class UISFXOnlineComponentPlatform : public UISFXOnlineComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -535,7 +535,7 @@ class UISFXOnlineComponentTelemetry : public UISFXOnlineComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -554,7 +554,7 @@ class UISFXOnlineComponentUserInterface : public UISFXOnlineComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -588,7 +588,7 @@ class USFXOnlineDefine : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -607,7 +607,7 @@ public:
 	unsigned long                                      NeedsStateMachine : 1;                            		// 0x0090 (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -651,7 +651,7 @@ public:
 	unsigned long                                      mIsLoggedIn : 1;                                  		// 0x00C0 (0x0004) [0x0000000000001000] [0x00000002] ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -712,7 +712,7 @@ public:
 	class UOnlinePlayerStorage*                        PlayerStorageCache[ 0x4 ];                        		// 0x04AC (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -845,7 +845,7 @@ public:
 	struct FScriptDelegate                             __OnProfileDataChanged__Delegate;                 		// 0x013C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -898,7 +898,7 @@ public:
 	unsigned char                                      CurrentNotificationPosition;                      		// 0x016C (0x0001) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -946,7 +946,7 @@ public:
 	class USFXOnlineEventList*                         EventList;                                        		// 0x02B8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -996,7 +996,7 @@ public:
 	unsigned long                                      SuggestPersonaNames : 1;                          		// 0x0330 (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1053,7 +1053,7 @@ public:
 	int                                                mGrantAchievementsTimeOut;                        		// 0x00E4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1075,7 +1075,7 @@ public:
 	FPointer                                           VfTable_IISFXOnlineComponentPlatform;             		// 0x0094 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1115,7 +1115,7 @@ public:
 	FPointer                                           VfTable_IISFXOnlineComponentAchievement;          		// 0x0094 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1146,7 +1146,7 @@ public:
 	unsigned long                                      bIsCountingDownSigninNotification : 1;            		// 0x0114 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1188,7 +1188,7 @@ public:
 	FPointer                                           VfTable_IISFXOnlineComponentAchievement;          		// 0x0094 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1214,7 +1214,7 @@ public:
 	unsigned long                                      m_bLaunchedSignInUI : 1;                          		// 0x00C4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1259,7 +1259,7 @@ public:
 	struct FMap_Mirror                                 AchievementMap;                                   		// 0x009C (0x0048) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1281,7 +1281,7 @@ public:
 	FPointer                                           VfTable_IISFXOnlineComponentPlatform;             		// 0x0094 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1325,7 +1325,7 @@ public:
 	struct FMap_Mirror                                 TrophyPackMap;                                    		// 0x00E4 (0x0048) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1347,7 +1347,7 @@ public:
 	FPointer                                           VfTable_IISFXOnlineComponentPlatform;             		// 0x0094 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1404,7 +1404,7 @@ public:
 	unsigned long                                      bInitWithEngineConfig : 1;                        		// 0x0134 (0x0004) [0x0000000000004000] [0x00000004] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
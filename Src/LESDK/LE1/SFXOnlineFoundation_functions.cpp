@@ -28,14 +28,11 @@
 
 
 
-class UClass* USFXOnlineEvent::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineEvent::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineEvent", &UObject::FindClass };
 
 class UClass* USFXOnlineEvent::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineEvent" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineEvent.Update
@@ -45,19 +42,15 @@ class UClass* USFXOnlineEvent::StaticClass()
 
 void USFXOnlineEvent::Update ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdateRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.Update", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdate )
-		pFnUpdate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.Update" );
+	UFunction* const pFnUpdate = pFnUpdateRef.Get ( );
 
 	USFXOnlineEvent_execUpdate_Parms Update_Parms;
 	Update_Parms.oEvent = oEvent;
 
-	pFnUpdate->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnUpdate, &Update_Parms, NULL );
-
-	pFnUpdate->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnUpdate, &Update_Parms ) )
+		this->ProcessEvent ( pFnUpdate, &Update_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineEvent.IsComplete
@@ -67,18 +60,14 @@ void USFXOnlineEvent::Update ( class USFXOnlineEvent* oEvent )
 
 bool USFXOnlineEvent::IsComplete ( )
 {
-	static UFunction* pFnIsComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsCompleteRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.IsComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsComplete )
-		pFnIsComplete = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.IsComplete" );
+	UFunction* const pFnIsComplete = pFnIsCompleteRef.Get ( );
 
 	USFXOnlineEvent_execIsComplete_Parms IsComplete_Parms;
 
-	pFnIsComplete->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsComplete, &IsComplete_Parms, NULL );
-
-	pFnIsComplete->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsComplete, &IsComplete_Parms ) )
+		this->ProcessEvent ( pFnIsComplete, &IsComplete_Parms, NULL );
 
 	return IsComplete_Parms.ReturnValue;
 };
@@ -90,18 +79,14 @@ bool USFXOnlineEvent::IsComplete ( )
 
 bool USFXOnlineEvent::IsPending ( )
 {
-	static UFunction* pFnIsPending = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsPendingRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.IsPending", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsPending )
-		pFnIsPending = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.IsPending" );
+	UFunction* const pFnIsPending = pFnIsPendingRef.Get ( );
 
 	USFXOnlineEvent_execIsPending_Parms IsPending_Parms;
 
-	pFnIsPending->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsPending, &IsPending_Parms, NULL );
-
-	pFnIsPending->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsPending, &IsPending_Parms ) )
+		this->ProcessEvent ( pFnIsPending, &IsPending_Parms, NULL );
 
 	return IsPending_Parms.ReturnValue;
 };
@@ -113,18 +98,14 @@ bool USFXOnlineEvent::IsPending ( )
 
 bool USFXOnlineEvent::CompleteAndSucceeded ( )
 {
-	static UFunction* pFnCompleteAndSucceeded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCompleteAndSucceededRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.CompleteAndSucceeded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCompleteAndSucceeded )
-		pFnCompleteAndSucceeded = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.CompleteAndSucceeded" );
+	UFunction* const pFnCompleteAndSucceeded = pFnCompleteAndSucceededRef.Get ( );
 
 	USFXOnlineEvent_execCompleteAndSucceeded_Parms CompleteAndSucceeded_Parms;
 
-	pFnCompleteAndSucceeded->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCompleteAndSucceeded, &CompleteAndSucceeded_Parms, NULL );
-
-	pFnCompleteAndSucceeded->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCompleteAndSucceeded, &CompleteAndSucceeded_Parms ) )
+		this->ProcessEvent ( pFnCompleteAndSucceeded, &CompleteAndSucceeded_Parms, NULL );
 
 	return CompleteAndSucceeded_Parms.ReturnValue;
 };
@@ -136,18 +117,14 @@ bool USFXOnlineEvent::CompleteAndSucceeded ( )
 
 bool USFXOnlineEvent::HasTimedOut ( )
 {
-	static UFunction* pFnHasTimedOut = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHasTimedOutRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.HasTimedOut", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHasTimedOut )
-		pFnHasTimedOut = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.HasTimedOut" );
+	UFunction* const pFnHasTimedOut = pFnHasTimedOutRef.Get ( );
 
 	USFXOnlineEvent_execHasTimedOut_Parms HasTimedOut_Parms;
 
-	pFnHasTimedOut->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnHasTimedOut, &HasTimedOut_Parms, NULL );
-
-	pFnHasTimedOut->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnHasTimedOut, &HasTimedOut_Parms ) )
+		this->ProcessEvent ( pFnHasTimedOut, &HasTimedOut_Parms, NULL );
 
 	return HasTimedOut_Parms.ReturnValue;
 };
@@ -159,18 +136,14 @@ bool USFXOnlineEvent::HasTimedOut ( )
 
 bool USFXOnlineEvent::IsTimeoutEnabled ( )
 {
-	static UFunction* pFnIsTimeoutEnabled = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsTimeoutEnabledRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.IsTimeoutEnabled", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsTimeoutEnabled )
-		pFnIsTimeoutEnabled = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.IsTimeoutEnabled" );
+	UFunction* const pFnIsTimeoutEnabled = pFnIsTimeoutEnabledRef.Get ( );
 
 	USFXOnlineEvent_execIsTimeoutEnabled_Parms IsTimeoutEnabled_Parms;
 
-	pFnIsTimeoutEnabled->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsTimeoutEnabled, &IsTimeoutEnabled_Parms, NULL );
-
-	pFnIsTimeoutEnabled->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsTimeoutEnabled, &IsTimeoutEnabled_Parms ) )
+		this->ProcessEvent ( pFnIsTimeoutEnabled, &IsTimeoutEnabled_Parms, NULL );
 
 	return IsTimeoutEnabled_Parms.ReturnValue;
 };
@@ -181,18 +154,14 @@ bool USFXOnlineEvent::IsTimeoutEnabled ( )
 
 void USFXOnlineEvent::DisableTimeout ( )
 {
-	static UFunction* pFnDisableTimeout = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDisableTimeoutRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.DisableTimeout", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDisableTimeout )
-		pFnDisableTimeout = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.DisableTimeout" );
+	UFunction* const pFnDisableTimeout = pFnDisableTimeoutRef.Get ( );
 
 	USFXOnlineEvent_execDisableTimeout_Parms DisableTimeout_Parms;
 
-	pFnDisableTimeout->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDisableTimeout, &DisableTimeout_Parms, NULL );
-
-	pFnDisableTimeout->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDisableTimeout, &DisableTimeout_Parms ) )
+		this->ProcessEvent ( pFnDisableTimeout, &DisableTimeout_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineEvent.EnableTimeout
@@ -201,18 +170,14 @@ void USFXOnlineEvent::DisableTimeout ( )
 
 void USFXOnlineEvent::EnableTimeout ( )
 {
-	static UFunction* pFnEnableTimeout = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEnableTimeoutRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.EnableTimeout", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEnableTimeout )
-		pFnEnableTimeout = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.EnableTimeout" );
+	UFunction* const pFnEnableTimeout = pFnEnableTimeoutRef.Get ( );
 
 	USFXOnlineEvent_execEnableTimeout_Parms EnableTimeout_Parms;
 
-	pFnEnableTimeout->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEnableTimeout, &EnableTimeout_Parms, NULL );
-
-	pFnEnableTimeout->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnEnableTimeout, &EnableTimeout_Parms ) )
+		this->ProcessEvent ( pFnEnableTimeout, &EnableTimeout_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineEvent.SetTimeout
@@ -222,19 +187,15 @@ void USFXOnlineEvent::EnableTimeout ( )
 
 void USFXOnlineEvent::SetTimeout ( float fEventTimeout )
 {
-	static UFunction* pFnSetTimeout = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetTimeoutRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.SetTimeout", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetTimeout )
-		pFnSetTimeout = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.SetTimeout" );
+	UFunction* const pFnSetTimeout = pFnSetTimeoutRef.Get ( );
 
 	USFXOnlineEvent_execSetTimeout_Parms SetTimeout_Parms;
 	SetTimeout_Parms.fEventTimeout = fEventTimeout;
 
-	pFnSetTimeout->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetTimeout, &SetTimeout_Parms, NULL );
-
-	pFnSetTimeout->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetTimeout, &SetTimeout_Parms ) )
+		this->ProcessEvent ( pFnSetTimeout, &SetTimeout_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineEvent.GetTimeout
@@ -244,18 +205,14 @@ void USFXOnlineEvent::SetTimeout ( float fEventTimeout )
 
 float USFXOnlineEvent::GetTimeout ( )
 {
-	static UFunction* pFnGetTimeout = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTimeoutRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.GetTimeout", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTimeout )
-		pFnGetTimeout = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.GetTimeout" );
+	UFunction* const pFnGetTimeout = pFnGetTimeoutRef.Get ( );
 
 	USFXOnlineEvent_execGetTimeout_Parms GetTimeout_Parms;
 
-	pFnGetTimeout->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetTimeout, &GetTimeout_Parms, NULL );
-
-	pFnGetTimeout->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetTimeout, &GetTimeout_Parms ) )
+		this->ProcessEvent ( pFnGetTimeout, &GetTimeout_Parms, NULL );
 
 	return GetTimeout_Parms.ReturnValue;
 };
@@ -267,19 +224,15 @@ float USFXOnlineEvent::GetTimeout ( )
 
 void USFXOnlineEvent::SetErrorString ( FString const& sMessage )
 {
-	static UFunction* pFnSetErrorString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetErrorStringRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.SetErrorString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetErrorString )
-		pFnSetErrorString = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.SetErrorString" );
+	UFunction* const pFnSetErrorString = pFnSetErrorStringRef.Get ( );
 
 	USFXOnlineEvent_execSetErrorString_Parms SetErrorString_Parms;
 	memcpy ( &SetErrorString_Parms.sMessage, &sMessage, 0x10 );
 
-	pFnSetErrorString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetErrorString, &SetErrorString_Parms, NULL );
-
-	pFnSetErrorString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetErrorString, &SetErrorString_Parms ) )
+		this->ProcessEvent ( pFnSetErrorString, &SetErrorString_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineEvent.GetErrorString
@@ -289,18 +242,14 @@ void USFXOnlineEvent::SetErrorString ( FString const& sMessage )
 
 FString USFXOnlineEvent::GetErrorString ( )
 {
-	static UFunction* pFnGetErrorString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetErrorStringRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.GetErrorString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetErrorString )
-		pFnGetErrorString = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.GetErrorString" );
+	UFunction* const pFnGetErrorString = pFnGetErrorStringRef.Get ( );
 
 	USFXOnlineEvent_execGetErrorString_Parms GetErrorString_Parms;
 
-	pFnGetErrorString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetErrorString, &GetErrorString_Parms, NULL );
-
-	pFnGetErrorString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetErrorString, &GetErrorString_Parms ) )
+		this->ProcessEvent ( pFnGetErrorString, &GetErrorString_Parms, NULL );
 
 	return GetErrorString_Parms.ReturnValue;
 };
@@ -312,19 +261,15 @@ FString USFXOnlineEvent::GetErrorString ( )
 
 void USFXOnlineEvent::SetErrorCode ( int nCode )
 {
-	static UFunction* pFnSetErrorCode = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetErrorCodeRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.SetErrorCode", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetErrorCode )
-		pFnSetErrorCode = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.SetErrorCode" );
+	UFunction* const pFnSetErrorCode = pFnSetErrorCodeRef.Get ( );
 
 	USFXOnlineEvent_execSetErrorCode_Parms SetErrorCode_Parms;
 	SetErrorCode_Parms.nCode = nCode;
 
-	pFnSetErrorCode->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetErrorCode, &SetErrorCode_Parms, NULL );
-
-	pFnSetErrorCode->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetErrorCode, &SetErrorCode_Parms ) )
+		this->ProcessEvent ( pFnSetErrorCode, &SetErrorCode_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineEvent.GetErrorCode
@@ -334,18 +279,14 @@ void USFXOnlineEvent::SetErrorCode ( int nCode )
 
 int USFXOnlineEvent::GetErrorCode ( )
 {
-	static UFunction* pFnGetErrorCode = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetErrorCodeRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.GetErrorCode", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetErrorCode )
-		pFnGetErrorCode = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.GetErrorCode" );
+	UFunction* const pFnGetErrorCode = pFnGetErrorCodeRef.Get ( );
 
 	USFXOnlineEvent_execGetErrorCode_Parms GetErrorCode_Parms;
 
-	pFnGetErrorCode->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetErrorCode, &GetErrorCode_Parms, NULL );
-
-	pFnGetErrorCode->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetErrorCode, &GetErrorCode_Parms ) )
+		this->ProcessEvent ( pFnGetErrorCode, &GetErrorCode_Parms, NULL );
 
 	return GetErrorCode_Parms.ReturnValue;
 };
@@ -357,19 +298,15 @@ int USFXOnlineEvent::GetErrorCode ( )
 
 void USFXOnlineEvent::SetStatus ( unsigned char eNewStatus )
 {
-	static UFunction* pFnSetStatus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetStatusRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.SetStatus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetStatus )
-		pFnSetStatus = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.SetStatus" );
+	UFunction* const pFnSetStatus = pFnSetStatusRef.Get ( );
 
 	USFXOnlineEvent_execSetStatus_Parms SetStatus_Parms;
 	SetStatus_Parms.eNewStatus = eNewStatus;
 
-	pFnSetStatus->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetStatus, &SetStatus_Parms, NULL );
-
-	pFnSetStatus->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetStatus, &SetStatus_Parms ) )
+		this->ProcessEvent ( pFnSetStatus, &SetStatus_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineEvent.GetStatus
@@ -379,18 +316,14 @@ void USFXOnlineEvent::SetStatus ( unsigned char eNewStatus )
 
 unsigned char USFXOnlineEvent::GetStatus ( )
 {
-	static UFunction* pFnGetStatus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetStatusRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.GetStatus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetStatus )
-		pFnGetStatus = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.GetStatus" );
+	UFunction* const pFnGetStatus = pFnGetStatusRef.Get ( );
 
 	USFXOnlineEvent_execGetStatus_Parms GetStatus_Parms;
 
-	pFnGetStatus->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetStatus, &GetStatus_Parms, NULL );
-
-	pFnGetStatus->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetStatus, &GetStatus_Parms ) )
+		this->ProcessEvent ( pFnGetStatus, &GetStatus_Parms, NULL );
 
 	return GetStatus_Parms.ReturnValue;
 };
@@ -402,19 +335,15 @@ unsigned char USFXOnlineEvent::GetStatus ( )
 
 void USFXOnlineEvent::SetOutcome ( unsigned char eStatusFinished )
 {
-	static UFunction* pFnSetOutcome = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetOutcomeRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.SetOutcome", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetOutcome )
-		pFnSetOutcome = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.SetOutcome" );
+	UFunction* const pFnSetOutcome = pFnSetOutcomeRef.Get ( );
 
 	USFXOnlineEvent_execSetOutcome_Parms SetOutcome_Parms;
 	SetOutcome_Parms.eStatusFinished = eStatusFinished;
 
-	pFnSetOutcome->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetOutcome, &SetOutcome_Parms, NULL );
-
-	pFnSetOutcome->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetOutcome, &SetOutcome_Parms ) )
+		this->ProcessEvent ( pFnSetOutcome, &SetOutcome_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineEvent.GetOutcome
@@ -424,18 +353,14 @@ void USFXOnlineEvent::SetOutcome ( unsigned char eStatusFinished )
 
 unsigned char USFXOnlineEvent::GetOutcome ( )
 {
-	static UFunction* pFnGetOutcome = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOutcomeRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.GetOutcome", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOutcome )
-		pFnGetOutcome = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.GetOutcome" );
+	UFunction* const pFnGetOutcome = pFnGetOutcomeRef.Get ( );
 
 	USFXOnlineEvent_execGetOutcome_Parms GetOutcome_Parms;
 
-	pFnGetOutcome->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetOutcome, &GetOutcome_Parms, NULL );
-
-	pFnGetOutcome->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetOutcome, &GetOutcome_Parms ) )
+		this->ProcessEvent ( pFnGetOutcome, &GetOutcome_Parms, NULL );
 
 	return GetOutcome_Parms.ReturnValue;
 };
@@ -447,19 +372,15 @@ unsigned char USFXOnlineEvent::GetOutcome ( )
 
 void USFXOnlineEvent::SetEventId ( int nNewEventId )
 {
-	static UFunction* pFnSetEventId = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetEventIdRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.SetEventId", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetEventId )
-		pFnSetEventId = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.SetEventId" );
+	UFunction* const pFnSetEventId = pFnSetEventIdRef.Get ( );
 
 	USFXOnlineEvent_execSetEventId_Parms SetEventId_Parms;
 	SetEventId_Parms.nNewEventId = nNewEventId;
 
-	pFnSetEventId->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetEventId, &SetEventId_Parms, NULL );
-
-	pFnSetEventId->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetEventId, &SetEventId_Parms ) )
+		this->ProcessEvent ( pFnSetEventId, &SetEventId_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineEvent.GetEventId
@@ -469,18 +390,14 @@ void USFXOnlineEvent::SetEventId ( int nNewEventId )
 
 int USFXOnlineEvent::GetEventId ( )
 {
-	static UFunction* pFnGetEventId = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEventIdRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.GetEventId", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEventId )
-		pFnGetEventId = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.GetEventId" );
+	UFunction* const pFnGetEventId = pFnGetEventIdRef.Get ( );
 
 	USFXOnlineEvent_execGetEventId_Parms GetEventId_Parms;
 
-	pFnGetEventId->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetEventId, &GetEventId_Parms, NULL );
-
-	pFnGetEventId->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetEventId, &GetEventId_Parms ) )
+		this->ProcessEvent ( pFnGetEventId, &GetEventId_Parms, NULL );
 
 	return GetEventId_Parms.ReturnValue;
 };
@@ -492,19 +409,15 @@ int USFXOnlineEvent::GetEventId ( )
 
 void USFXOnlineEvent::SetEventType ( unsigned char eNewEventType )
 {
-	static UFunction* pFnSetEventType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetEventTypeRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.SetEventType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetEventType )
-		pFnSetEventType = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.SetEventType" );
+	UFunction* const pFnSetEventType = pFnSetEventTypeRef.Get ( );
 
 	USFXOnlineEvent_execSetEventType_Parms SetEventType_Parms;
 	SetEventType_Parms.eNewEventType = eNewEventType;
 
-	pFnSetEventType->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetEventType, &SetEventType_Parms, NULL );
-
-	pFnSetEventType->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetEventType, &SetEventType_Parms ) )
+		this->ProcessEvent ( pFnSetEventType, &SetEventType_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineEvent.GetEventType
@@ -514,32 +427,25 @@ void USFXOnlineEvent::SetEventType ( unsigned char eNewEventType )
 
 unsigned char USFXOnlineEvent::GetEventType ( )
 {
-	static UFunction* pFnGetEventType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEventTypeRef { L"Function SFXOnlineFoundation.SFXOnlineEvent.GetEventType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEventType )
-		pFnGetEventType = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent.GetEventType" );
+	UFunction* const pFnGetEventType = pFnGetEventTypeRef.Get ( );
 
 	USFXOnlineEvent_execGetEventType_Parms GetEventType_Parms;
 
-	pFnGetEventType->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetEventType, &GetEventType_Parms, NULL );
-
-	pFnGetEventType->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetEventType, &GetEventType_Parms ) )
+		this->ProcessEvent ( pFnGetEventType, &GetEventType_Parms, NULL );
 
 	return GetEventType_Parms.ReturnValue;
 };
 
 
 
-class UClass* USFXOnlineEvent_Integer::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineEvent_Integer::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineEvent_Integer", &UObject::FindClass };
 
 class UClass* USFXOnlineEvent_Integer::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineEvent_Integer" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineEvent_Integer.SetInteger
@@ -549,19 +455,15 @@ class UClass* USFXOnlineEvent_Integer::StaticClass()
 
 void USFXOnlineEvent_Integer::SetInteger ( int nInteger )
 {
-	static UFunction* pFnSetInteger = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetIntegerRef { L"Function SFXOnlineFoundation.SFXOnlineEvent_Integer.SetInteger", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetInteger )
-		pFnSetInteger = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent_Integer.SetInteger" );
+	UFunction* const pFnSetInteger = pFnSetIntegerRef.Get ( );
 
 	USFXOnlineEvent_Integer_execSetInteger_Parms SetInteger_Parms;
 	SetInteger_Parms.nInteger = nInteger;
 
-	pFnSetInteger->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetInteger, &SetInteger_Parms, NULL );
-
-	pFnSetInteger->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetInteger, &SetInteger_Parms ) )
+		this->ProcessEvent ( pFnSetInteger, &SetInteger_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineEvent_Integer.GetInteger
@@ -571,44 +473,34 @@ void USFXOnlineEvent_Integer::SetInteger ( int nInteger )
 
 int USFXOnlineEvent_Integer::GetInteger ( )
 {
-	static UFunction* pFnGetInteger = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetIntegerRef { L"Function SFXOnlineFoundation.SFXOnlineEvent_Integer.GetInteger", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetInteger )
-		pFnGetInteger = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent_Integer.GetInteger" );
+	UFunction* const pFnGetInteger = pFnGetIntegerRef.Get ( );
 
 	USFXOnlineEvent_Integer_execGetInteger_Parms GetInteger_Parms;
 
-	pFnGetInteger->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetInteger, &GetInteger_Parms, NULL );
-
-	pFnGetInteger->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetInteger, &GetInteger_Parms ) )
+		this->ProcessEvent ( pFnGetInteger, &GetInteger_Parms, NULL );
 
 	return GetInteger_Parms.ReturnValue;
 };
 
 
 
-class UClass* USFXOnlineEvent_PlatformKeyboardUI::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineEvent_PlatformKeyboardUI::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineEvent_PlatformKeyboardUI", &UObject::FindClass };
 
 class UClass* USFXOnlineEvent_PlatformKeyboardUI::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineEvent_PlatformKeyboardUI" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXOnlineEvent_String::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineEvent_String::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineEvent_String", &UObject::FindClass };
 
 class UClass* USFXOnlineEvent_String::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineEvent_String" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineEvent_String.SetStringData
@@ -618,19 +510,15 @@ class UClass* USFXOnlineEvent_String::StaticClass()
 
 void USFXOnlineEvent_String::SetStringData ( FString const& sStringData )
 {
-	static UFunction* pFnSetStringData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetStringDataRef { L"Function SFXOnlineFoundation.SFXOnlineEvent_String.SetStringData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetStringData )
-		pFnSetStringData = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent_String.SetStringData" );
+	UFunction* const pFnSetStringData = pFnSetStringDataRef.Get ( );
 
 	USFXOnlineEvent_String_execSetStringData_Parms SetStringData_Parms;
 	memcpy ( &SetStringData_Parms.sStringData, &sStringData, 0x10 );
 
-	pFnSetStringData->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetStringData, &SetStringData_Parms, NULL );
-
-	pFnSetStringData->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetStringData, &SetStringData_Parms ) )
+		this->ProcessEvent ( pFnSetStringData, &SetStringData_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineEvent_String.GetStringData
@@ -640,32 +528,25 @@ void USFXOnlineEvent_String::SetStringData ( FString const& sStringData )
 
 FString USFXOnlineEvent_String::GetStringData ( )
 {
-	static UFunction* pFnGetStringData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetStringDataRef { L"Function SFXOnlineFoundation.SFXOnlineEvent_String.GetStringData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetStringData )
-		pFnGetStringData = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent_String.GetStringData" );
+	UFunction* const pFnGetStringData = pFnGetStringDataRef.Get ( );
 
 	USFXOnlineEvent_String_execGetStringData_Parms GetStringData_Parms;
 
-	pFnGetStringData->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetStringData, &GetStringData_Parms, NULL );
-
-	pFnGetStringData->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetStringData, &GetStringData_Parms ) )
+		this->ProcessEvent ( pFnGetStringData, &GetStringData_Parms, NULL );
 
 	return GetStringData_Parms.ReturnValue;
 };
 
 
 
-class UClass* USFXOnlineEvent_Notification::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineEvent_Notification::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineEvent_Notification", &UObject::FindClass };
 
 class UClass* USFXOnlineEvent_Notification::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineEvent_Notification" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineEvent_Notification.SetPriority
@@ -675,19 +556,15 @@ class UClass* USFXOnlineEvent_Notification::StaticClass()
 
 void USFXOnlineEvent_Notification::SetPriority ( int nPriority )
 {
-	static UFunction* pFnSetPriority = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetPriorityRef { L"Function SFXOnlineFoundation.SFXOnlineEvent_Notification.SetPriority", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetPriority )
-		pFnSetPriority = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent_Notification.SetPriority" );
+	UFunction* const pFnSetPriority = pFnSetPriorityRef.Get ( );
 
 	USFXOnlineEvent_Notification_execSetPriority_Parms SetPriority_Parms;
 	SetPriority_Parms.nPriority = nPriority;
 
-	pFnSetPriority->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetPriority, &SetPriority_Parms, NULL );
-
-	pFnSetPriority->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetPriority, &SetPriority_Parms ) )
+		this->ProcessEvent ( pFnSetPriority, &SetPriority_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineEvent_Notification.GetPriority
@@ -697,18 +574,14 @@ void USFXOnlineEvent_Notification::SetPriority ( int nPriority )
 
 int USFXOnlineEvent_Notification::GetPriority ( )
 {
-	static UFunction* pFnGetPriority = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPriorityRef { L"Function SFXOnlineFoundation.SFXOnlineEvent_Notification.GetPriority", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPriority )
-		pFnGetPriority = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent_Notification.GetPriority" );
+	UFunction* const pFnGetPriority = pFnGetPriorityRef.Get ( );
 
 	USFXOnlineEvent_Notification_execGetPriority_Parms GetPriority_Parms;
 
-	pFnGetPriority->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetPriority, &GetPriority_Parms, NULL );
-
-	pFnGetPriority->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetPriority, &GetPriority_Parms ) )
+		this->ProcessEvent ( pFnGetPriority, &GetPriority_Parms, NULL );
 
 	return GetPriority_Parms.ReturnValue;
 };
@@ -720,19 +593,15 @@ int USFXOnlineEvent_Notification::GetPriority ( )
 
 void USFXOnlineEvent_Notification::SetImageName ( FString const& sImageName )
 {
-	static UFunction* pFnSetImageName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetImageNameRef { L"Function SFXOnlineFoundation.SFXOnlineEvent_Notification.SetImageName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetImageName )
-		pFnSetImageName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent_Notification.SetImageName" );
+	UFunction* const pFnSetImageName = pFnSetImageNameRef.Get ( );
 
 	USFXOnlineEvent_Notification_execSetImageName_Parms SetImageName_Parms;
 	memcpy ( &SetImageName_Parms.sImageName, &sImageName, 0x10 );
 
-	pFnSetImageName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetImageName, &SetImageName_Parms, NULL );
-
-	pFnSetImageName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetImageName, &SetImageName_Parms ) )
+		this->ProcessEvent ( pFnSetImageName, &SetImageName_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineEvent_Notification.GetImageName
@@ -742,32 +611,25 @@ void USFXOnlineEvent_Notification::SetImageName ( FString const& sImageName )
 
 FString USFXOnlineEvent_Notification::GetImageName ( )
 {
-	static UFunction* pFnGetImageName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetImageNameRef { L"Function SFXOnlineFoundation.SFXOnlineEvent_Notification.GetImageName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetImageName )
-		pFnGetImageName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEvent_Notification.GetImageName" );
+	UFunction* const pFnGetImageName = pFnGetImageNameRef.Get ( );
 
 	USFXOnlineEvent_Notification_execGetImageName_Parms GetImageName_Parms;
 
-	pFnGetImageName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetImageName, &GetImageName_Parms, NULL );
-
-	pFnGetImageName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetImageName, &GetImageName_Parms ) )
+		this->ProcessEvent ( pFnGetImageName, &GetImageName_Parms, NULL );
 
 	return GetImageName_Parms.ReturnValue;
 };
 
 
 
-class UClass* USFXOnlineEventList::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineEventList::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineEventList", &UObject::FindClass };
 
 class UClass* USFXOnlineEventList::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineEventList" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineEventList.GetNextTimedOutEvent
@@ -777,18 +639,14 @@ class UClass* USFXOnlineEventList::StaticClass()
 
 class USFXOnlineEvent* USFXOnlineEventList::GetNextTimedOutEvent ( )
 {
-	static UFunction* pFnGetNextTimedOutEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetNextTimedOutEventRef { L"Function SFXOnlineFoundation.SFXOnlineEventList.GetNextTimedOutEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetNextTimedOutEvent )
-		pFnGetNextTimedOutEvent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEventList.GetNextTimedOutEvent" );
+	UFunction* const pFnGetNextTimedOutEvent = pFnGetNextTimedOutEventRef.Get ( );
 
 	USFXOnlineEventList_execGetNextTimedOutEvent_Parms GetNextTimedOutEvent_Parms;
 
-	pFnGetNextTimedOutEvent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetNextTimedOutEvent, &GetNextTimedOutEvent_Parms, NULL );
-
-	pFnGetNextTimedOutEvent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetNextTimedOutEvent, &GetNextTimedOutEvent_Parms ) )
+		this->ProcessEvent ( pFnGetNextTimedOutEvent, &GetNextTimedOutEvent_Parms, NULL );
 
 	return GetNextTimedOutEvent_Parms.ReturnValue;
 };
@@ -801,19 +659,15 @@ class USFXOnlineEvent* USFXOnlineEventList::GetNextTimedOutEvent ( )
 
 bool USFXOnlineEventList::RemoveEvent ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnRemoveEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRemoveEventRef { L"Function SFXOnlineFoundation.SFXOnlineEventList.RemoveEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRemoveEvent )
-		pFnRemoveEvent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEventList.RemoveEvent" );
+	UFunction* const pFnRemoveEvent = pFnRemoveEventRef.Get ( );
 
 	USFXOnlineEventList_execRemoveEvent_Parms RemoveEvent_Parms;
 	RemoveEvent_Parms.oEvent = oEvent;
 
-	pFnRemoveEvent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRemoveEvent, &RemoveEvent_Parms, NULL );
-
-	pFnRemoveEvent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRemoveEvent, &RemoveEvent_Parms ) )
+		this->ProcessEvent ( pFnRemoveEvent, &RemoveEvent_Parms, NULL );
 
 	return RemoveEvent_Parms.ReturnValue;
 };
@@ -827,20 +681,16 @@ bool USFXOnlineEventList::RemoveEvent ( class USFXOnlineEvent* oEvent )
 
 int USFXOnlineEventList::FindEventByType ( unsigned char eEventType, int nEventId )
 {
-	static UFunction* pFnFindEventByType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFindEventByTypeRef { L"Function SFXOnlineFoundation.SFXOnlineEventList.FindEventByType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFindEventByType )
-		pFnFindEventByType = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEventList.FindEventByType" );
+	UFunction* const pFnFindEventByType = pFnFindEventByTypeRef.Get ( );
 
 	USFXOnlineEventList_execFindEventByType_Parms FindEventByType_Parms;
 	FindEventByType_Parms.eEventType = eEventType;
 	FindEventByType_Parms.nEventId = nEventId;
 
-	pFnFindEventByType->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFindEventByType, &FindEventByType_Parms, NULL );
-
-	pFnFindEventByType->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFindEventByType, &FindEventByType_Parms ) )
+		this->ProcessEvent ( pFnFindEventByType, &FindEventByType_Parms, NULL );
 
 	return FindEventByType_Parms.ReturnValue;
 };
@@ -853,19 +703,15 @@ int USFXOnlineEventList::FindEventByType ( unsigned char eEventType, int nEventI
 
 int USFXOnlineEventList::FindEvent ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnFindEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFindEventRef { L"Function SFXOnlineFoundation.SFXOnlineEventList.FindEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFindEvent )
-		pFnFindEvent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEventList.FindEvent" );
+	UFunction* const pFnFindEvent = pFnFindEventRef.Get ( );
 
 	USFXOnlineEventList_execFindEvent_Parms FindEvent_Parms;
 	FindEvent_Parms.oEvent = oEvent;
 
-	pFnFindEvent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFindEvent, &FindEvent_Parms, NULL );
-
-	pFnFindEvent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFindEvent, &FindEvent_Parms ) )
+		this->ProcessEvent ( pFnFindEvent, &FindEvent_Parms, NULL );
 
 	return FindEvent_Parms.ReturnValue;
 };
@@ -878,19 +724,15 @@ int USFXOnlineEventList::FindEvent ( class USFXOnlineEvent* oEvent )
 
 class USFXOnlineEvent* USFXOnlineEventList::GetEventAtIndex ( int nEventIndex )
 {
-	static UFunction* pFnGetEventAtIndex = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEventAtIndexRef { L"Function SFXOnlineFoundation.SFXOnlineEventList.GetEventAtIndex", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEventAtIndex )
-		pFnGetEventAtIndex = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEventList.GetEventAtIndex" );
+	UFunction* const pFnGetEventAtIndex = pFnGetEventAtIndexRef.Get ( );
 
 	USFXOnlineEventList_execGetEventAtIndex_Parms GetEventAtIndex_Parms;
 	GetEventAtIndex_Parms.nEventIndex = nEventIndex;
 
-	pFnGetEventAtIndex->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetEventAtIndex, &GetEventAtIndex_Parms, NULL );
-
-	pFnGetEventAtIndex->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetEventAtIndex, &GetEventAtIndex_Parms ) )
+		this->ProcessEvent ( pFnGetEventAtIndex, &GetEventAtIndex_Parms, NULL );
 
 	return GetEventAtIndex_Parms.ReturnValue;
 };
@@ -903,19 +745,15 @@ class USFXOnlineEvent* USFXOnlineEventList::GetEventAtIndex ( int nEventIndex )
 
 class USFXOnlineEvent* USFXOnlineEventList::GetEvent ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnGetEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEventRef { L"Function SFXOnlineFoundation.SFXOnlineEventList.GetEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEvent )
-		pFnGetEvent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEventList.GetEvent" );
+	UFunction* const pFnGetEvent = pFnGetEventRef.Get ( );
 
 	USFXOnlineEventList_execGetEvent_Parms GetEvent_Parms;
 	GetEvent_Parms.oEvent = oEvent;
 
-	pFnGetEvent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetEvent, &GetEvent_Parms, NULL );
-
-	pFnGetEvent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetEvent, &GetEvent_Parms ) )
+		this->ProcessEvent ( pFnGetEvent, &GetEvent_Parms, NULL );
 
 	return GetEvent_Parms.ReturnValue;
 };
@@ -928,33 +766,26 @@ class USFXOnlineEvent* USFXOnlineEventList::GetEvent ( class USFXOnlineEvent* oE
 
 bool USFXOnlineEventList::AddEvent ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnAddEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddEventRef { L"Function SFXOnlineFoundation.SFXOnlineEventList.AddEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddEvent )
-		pFnAddEvent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineEventList.AddEvent" );
+	UFunction* const pFnAddEvent = pFnAddEventRef.Get ( );
 
 	USFXOnlineEventList_execAddEvent_Parms AddEvent_Parms;
 	AddEvent_Parms.oEvent = oEvent;
 
-	pFnAddEvent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddEvent, &AddEvent_Parms, NULL );
-
-	pFnAddEvent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAddEvent, &AddEvent_Parms ) )
+		this->ProcessEvent ( pFnAddEvent, &AddEvent_Parms, NULL );
 
 	return AddEvent_Parms.ReturnValue;
 };
 
 
 
-class UClass* UISFXOnlineComponent::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UISFXOnlineComponent::pClassPointer { L"Class SFXOnlineFoundation.ISFXOnlineComponent", &UObject::FindClass };
 
 class UClass* UISFXOnlineComponent::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.ISFXOnlineComponent" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.ISFXOnlineComponent.GetAPIName
@@ -964,18 +795,14 @@ class UClass* UISFXOnlineComponent::StaticClass()
 
 struct SFXName UISFXOnlineComponent::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.ISFXOnlineComponent.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponent.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	UISFXOnlineComponent_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -986,18 +813,14 @@ struct SFXName UISFXOnlineComponent::GetAPIName ( )
 
 void UISFXOnlineComponent::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.ISFXOnlineComponent.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponent.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	UISFXOnlineComponent_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponent.OnInitialize
@@ -1007,31 +830,24 @@ void UISFXOnlineComponent::OnRelease ( )
 
 void UISFXOnlineComponent::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.ISFXOnlineComponent.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponent.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	UISFXOnlineComponent_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 
 
-class UClass* UISFXOnlineComponentAPI::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UISFXOnlineComponentAPI::pClassPointer { L"Class SFXOnlineFoundation.ISFXOnlineComponentAPI", &UObject::FindClass };
 
 class UClass* UISFXOnlineComponentAPI::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.ISFXOnlineComponentAPI" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentAPI.Idle
@@ -1041,32 +857,25 @@ class UClass* UISFXOnlineComponentAPI::StaticClass()
 
 bool UISFXOnlineComponentAPI::Idle ( )
 {
-	static UFunction* pFnIdle = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIdleRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentAPI.Idle", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIdle )
-		pFnIdle = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentAPI.Idle" );
+	UFunction* const pFnIdle = pFnIdleRef.Get ( );
 
 	UISFXOnlineComponentAPI_execIdle_Parms Idle_Parms;
 
-	pFnIdle->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIdle, &Idle_Parms, NULL );
-
-	pFnIdle->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIdle, &Idle_Parms ) )
+		this->ProcessEvent ( pFnIdle, &Idle_Parms, NULL );
 
 	return Idle_Parms.ReturnValue;
 };
 
 
 
-class UClass* UISFXOnlineComponentAchievement::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UISFXOnlineComponentAchievement::pClassPointer { L"Class SFXOnlineFoundation.ISFXOnlineComponentAchievement", &UObject::FindClass };
 
 class UClass* UISFXOnlineComponentAchievement::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.ISFXOnlineComponentAchievement" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentAchievement.GetTitleAchievementID
@@ -1078,10 +887,9 @@ class UClass* UISFXOnlineComponentAchievement::StaticClass()
 
 int UISFXOnlineComponentAchievement::GetTitleAchievementID ( int Index, int* SetIndex )
 {
-	static UFunction* pFnGetTitleAchievementID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTitleAchievementIDRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentAchievement.GetTitleAchievementID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTitleAchievementID )
-		pFnGetTitleAchievementID = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentAchievement.GetTitleAchievementID" );
+	UFunction* const pFnGetTitleAchievementID = pFnGetTitleAchievementIDRef.Get ( );
 
 	UISFXOnlineComponentAchievement_execGetTitleAchievementID_Parms GetTitleAchievementID_Parms;
 	GetTitleAchievementID_Parms.Index = Index;
@@ -1089,11 +897,8 @@ int UISFXOnlineComponentAchievement::GetTitleAchievementID ( int Index, int* Set
 	if ( SetIndex )
 		GetTitleAchievementID_Parms.SetIndex = *SetIndex;
 
-	pFnGetTitleAchievementID->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetTitleAchievementID, &GetTitleAchievementID_Parms, NULL );
-
-	pFnGetTitleAchievementID->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetTitleAchievementID, &GetTitleAchievementID_Parms ) )
+		this->ProcessEvent ( pFnGetTitleAchievementID, &GetTitleAchievementID_Parms, NULL );
 
 	if ( SetIndex )
 		*SetIndex = GetTitleAchievementID_Parms.SetIndex;
@@ -1110,10 +915,9 @@ int UISFXOnlineComponentAchievement::GetTitleAchievementID ( int Index, int* Set
 
 int UISFXOnlineComponentAchievement::GetPlatformAchievementID ( int Index, int* SetIndex )
 {
-	static UFunction* pFnGetPlatformAchievementID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPlatformAchievementIDRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentAchievement.GetPlatformAchievementID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPlatformAchievementID )
-		pFnGetPlatformAchievementID = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentAchievement.GetPlatformAchievementID" );
+	UFunction* const pFnGetPlatformAchievementID = pFnGetPlatformAchievementIDRef.Get ( );
 
 	UISFXOnlineComponentAchievement_execGetPlatformAchievementID_Parms GetPlatformAchievementID_Parms;
 	GetPlatformAchievementID_Parms.Index = Index;
@@ -1121,11 +925,8 @@ int UISFXOnlineComponentAchievement::GetPlatformAchievementID ( int Index, int*
 	if ( SetIndex )
 		GetPlatformAchievementID_Parms.SetIndex = *SetIndex;
 
-	pFnGetPlatformAchievementID->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms, NULL );
-
-	pFnGetPlatformAchievementID->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms ) )
+		this->ProcessEvent ( pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms, NULL );
 
 	if ( SetIndex )
 		*SetIndex = GetPlatformAchievementID_Parms.SetIndex;
@@ -1142,20 +943,16 @@ int UISFXOnlineComponentAchievement::GetPlatformAchievementID ( int Index, int*
 
 bool UISFXOnlineComponentAchievement::IsGranted ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnIsGranted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsGrantedRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentAchievement.IsGranted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsGranted )
-		pFnIsGranted = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentAchievement.IsGranted" );
+	UFunction* const pFnIsGranted = pFnIsGrantedRef.Get ( );
 
 	UISFXOnlineComponentAchievement_execIsGranted_Parms IsGranted_Parms;
 	IsGranted_Parms.LocalUserNum = LocalUserNum;
 	IsGranted_Parms.AchievementId = AchievementId;
 
-	pFnIsGranted->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsGranted, &IsGranted_Parms, NULL );
-
-	pFnIsGranted->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsGranted, &IsGranted_Parms ) )
+		this->ProcessEvent ( pFnIsGranted, &IsGranted_Parms, NULL );
 
 	return IsGranted_Parms.ReturnValue;
 };
@@ -1168,32 +965,25 @@ bool UISFXOnlineComponentAchievement::IsGranted ( unsigned char LocalUserNum, in
 
 void UISFXOnlineComponentAchievement::Grant ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnGrant = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGrantRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentAchievement.Grant", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGrant )
-		pFnGrant = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentAchievement.Grant" );
+	UFunction* const pFnGrant = pFnGrantRef.Get ( );
 
 	UISFXOnlineComponentAchievement_execGrant_Parms Grant_Parms;
 	Grant_Parms.LocalUserNum = LocalUserNum;
 	Grant_Parms.AchievementId = AchievementId;
 
-	pFnGrant->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGrant, &Grant_Parms, NULL );
-
-	pFnGrant->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGrant, &Grant_Parms ) )
+		this->ProcessEvent ( pFnGrant, &Grant_Parms, NULL );
 };
 
 
 
-class UClass* UISFXOnlineComponentLogin::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UISFXOnlineComponentLogin::pClassPointer { L"Class SFXOnlineFoundation.ISFXOnlineComponentLogin", &UObject::FindClass };
 
 class UClass* UISFXOnlineComponentLogin::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.ISFXOnlineComponentLogin" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetConnectMode
@@ -1203,18 +993,14 @@ class UClass* UISFXOnlineComponentLogin::StaticClass()
 
 unsigned char UISFXOnlineComponentLogin::GetConnectMode ( )
 {
-	static UFunction* pFnGetConnectMode = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetConnectModeRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetConnectMode", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetConnectMode )
-		pFnGetConnectMode = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetConnectMode" );
+	UFunction* const pFnGetConnectMode = pFnGetConnectModeRef.Get ( );
 
 	UISFXOnlineComponentLogin_execGetConnectMode_Parms GetConnectMode_Parms;
 
-	pFnGetConnectMode->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetConnectMode, &GetConnectMode_Parms, NULL );
-
-	pFnGetConnectMode->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetConnectMode, &GetConnectMode_Parms ) )
+		this->ProcessEvent ( pFnGetConnectMode, &GetConnectMode_Parms, NULL );
 
 	return GetConnectMode_Parms.ReturnValue;
 };
@@ -1226,18 +1012,14 @@ unsigned char UISFXOnlineComponentLogin::GetConnectMode ( )
 
 unsigned char UISFXOnlineComponentLogin::GetUIState ( )
 {
-	static UFunction* pFnGetUIState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUIStateRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetUIState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUIState )
-		pFnGetUIState = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetUIState" );
+	UFunction* const pFnGetUIState = pFnGetUIStateRef.Get ( );
 
 	UISFXOnlineComponentLogin_execGetUIState_Parms GetUIState_Parms;
 
-	pFnGetUIState->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetUIState, &GetUIState_Parms, NULL );
-
-	pFnGetUIState->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetUIState, &GetUIState_Parms ) )
+		this->ProcessEvent ( pFnGetUIState, &GetUIState_Parms, NULL );
 
 	return GetUIState_Parms.ReturnValue;
 };
@@ -1250,19 +1032,15 @@ unsigned char UISFXOnlineComponentLogin::GetUIState ( )
 
 unsigned char UISFXOnlineComponentLogin::CanShowPresenceInformation ( int nUserIndex )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanShowPresenceInformationRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanShowPresenceInformation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanShowPresenceInformation" );
+	UFunction* const pFnCanShowPresenceInformation = pFnCanShowPresenceInformationRef.Get ( );
 
 	UISFXOnlineComponentLogin_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.nUserIndex = nUserIndex;
 
-	pFnCanShowPresenceInformation->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
-
-	pFnCanShowPresenceInformation->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms ) )
+		this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
 
 	return CanShowPresenceInformation_Parms.ReturnValue;
 };
@@ -1275,19 +1053,15 @@ unsigned char UISFXOnlineComponentLogin::CanShowPresenceInformation ( int nUserI
 
 unsigned char UISFXOnlineComponentLogin::CanViewPlayerProfiles ( int nUserIndex )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanViewPlayerProfilesRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanViewPlayerProfiles", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanViewPlayerProfiles" );
+	UFunction* const pFnCanViewPlayerProfiles = pFnCanViewPlayerProfilesRef.Get ( );
 
 	UISFXOnlineComponentLogin_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.nUserIndex = nUserIndex;
 
-	pFnCanViewPlayerProfiles->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
-
-	pFnCanViewPlayerProfiles->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms ) )
+		this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
 
 	return CanViewPlayerProfiles_Parms.ReturnValue;
 };
@@ -1300,19 +1074,15 @@ unsigned char UISFXOnlineComponentLogin::CanViewPlayerProfiles ( int nUserIndex
 
 unsigned char UISFXOnlineComponentLogin::CanPurchaseContent ( int nUserIndex )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPurchaseContentRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanPurchaseContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanPurchaseContent" );
+	UFunction* const pFnCanPurchaseContent = pFnCanPurchaseContentRef.Get ( );
 
 	UISFXOnlineComponentLogin_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.nUserIndex = nUserIndex;
 
-	pFnCanPurchaseContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
-
-	pFnCanPurchaseContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPurchaseContent, &CanPurchaseContent_Parms ) )
+		this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
 
 	return CanPurchaseContent_Parms.ReturnValue;
 };
@@ -1325,19 +1095,15 @@ unsigned char UISFXOnlineComponentLogin::CanPurchaseContent ( int nUserIndex )
 
 unsigned char UISFXOnlineComponentLogin::CanDownloadUserContent ( int nUserIndex )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanDownloadUserContentRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanDownloadUserContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanDownloadUserContent" );
+	UFunction* const pFnCanDownloadUserContent = pFnCanDownloadUserContentRef.Get ( );
 
 	UISFXOnlineComponentLogin_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.nUserIndex = nUserIndex;
 
-	pFnCanDownloadUserContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
-
-	pFnCanDownloadUserContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanDownloadUserContent, &CanDownloadUserContent_Parms ) )
+		this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
 
 	return CanDownloadUserContent_Parms.ReturnValue;
 };
@@ -1350,19 +1116,15 @@ unsigned char UISFXOnlineComponentLogin::CanDownloadUserContent ( int nUserIndex
 
 unsigned char UISFXOnlineComponentLogin::CanCommunicate ( int nUserIndex )
 {
-	static UFunction* pFnCanCommunicate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanCommunicateRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanCommunicate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanCommunicate" );
+	UFunction* const pFnCanCommunicate = pFnCanCommunicateRef.Get ( );
 
 	UISFXOnlineComponentLogin_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.nUserIndex = nUserIndex;
 
-	pFnCanCommunicate->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
-
-	pFnCanCommunicate->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanCommunicate, &CanCommunicate_Parms ) )
+		this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
 
 	return CanCommunicate_Parms.ReturnValue;
 };
@@ -1375,19 +1137,15 @@ unsigned char UISFXOnlineComponentLogin::CanCommunicate ( int nUserIndex )
 
 unsigned char UISFXOnlineComponentLogin::CanPlayOnline ( int nUserIndex )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPlayOnlineRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanPlayOnline", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanPlayOnline" );
+	UFunction* const pFnCanPlayOnline = pFnCanPlayOnlineRef.Get ( );
 
 	UISFXOnlineComponentLogin_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.nUserIndex = nUserIndex;
 
-	pFnCanPlayOnline->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
-
-	pFnCanPlayOnline->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPlayOnline, &CanPlayOnline_Parms ) )
+		this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
 
 	return CanPlayOnline_Parms.ReturnValue;
 };
@@ -1399,19 +1157,15 @@ unsigned char UISFXOnlineComponentLogin::CanPlayOnline ( int nUserIndex )
 
 void UISFXOnlineComponentLogin::EnterCDKey ( FString const& sKey )
 {
-	static UFunction* pFnEnterCDKey = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEnterCDKeyRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.EnterCDKey", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEnterCDKey )
-		pFnEnterCDKey = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.EnterCDKey" );
+	UFunction* const pFnEnterCDKey = pFnEnterCDKeyRef.Get ( );
 
 	UISFXOnlineComponentLogin_execEnterCDKey_Parms EnterCDKey_Parms;
 	memcpy ( &EnterCDKey_Parms.sKey, &sKey, 0x10 );
 
-	pFnEnterCDKey->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEnterCDKey, &EnterCDKey_Parms, NULL );
-
-	pFnEnterCDKey->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnEnterCDKey, &EnterCDKey_Parms ) )
+		this->ProcessEvent ( pFnEnterCDKey, &EnterCDKey_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OnDownloadOffersUICompleted
@@ -1420,18 +1174,14 @@ void UISFXOnlineComponentLogin::EnterCDKey ( FString const& sKey )
 
 void UISFXOnlineComponentLogin::OnDownloadOffersUICompleted ( )
 {
-	static UFunction* pFnOnDownloadOffersUICompleted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnDownloadOffersUICompletedRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OnDownloadOffersUICompleted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnDownloadOffersUICompleted )
-		pFnOnDownloadOffersUICompleted = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OnDownloadOffersUICompleted" );
+	UFunction* const pFnOnDownloadOffersUICompleted = pFnOnDownloadOffersUICompletedRef.Get ( );
 
 	UISFXOnlineComponentLogin_execOnDownloadOffersUICompleted_Parms OnDownloadOffersUICompleted_Parms;
 
-	pFnOnDownloadOffersUICompleted->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnDownloadOffersUICompleted, &OnDownloadOffersUICompleted_Parms, NULL );
-
-	pFnOnDownloadOffersUICompleted->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnDownloadOffersUICompleted, &OnDownloadOffersUICompleted_Parms ) )
+		this->ProcessEvent ( pFnOnDownloadOffersUICompleted, &OnDownloadOffersUICompleted_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OnDLCInfoLoaded
@@ -1440,18 +1190,14 @@ void UISFXOnlineComponentLogin::OnDownloadOffersUICompleted ( )
 
 void UISFXOnlineComponentLogin::OnDLCInfoLoaded ( )
 {
-	static UFunction* pFnOnDLCInfoLoaded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnDLCInfoLoadedRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OnDLCInfoLoaded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnDLCInfoLoaded )
-		pFnOnDLCInfoLoaded = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OnDLCInfoLoaded" );
+	UFunction* const pFnOnDLCInfoLoaded = pFnOnDLCInfoLoadedRef.Get ( );
 
 	UISFXOnlineComponentLogin_execOnDLCInfoLoaded_Parms OnDLCInfoLoaded_Parms;
 
-	pFnOnDLCInfoLoaded->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnDLCInfoLoaded, &OnDLCInfoLoaded_Parms, NULL );
-
-	pFnOnDLCInfoLoaded->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnDLCInfoLoaded, &OnDLCInfoLoaded_Parms ) )
+		this->ProcessEvent ( pFnOnDLCInfoLoaded, &OnDLCInfoLoaded_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OpenCerberusUI
@@ -1460,18 +1206,14 @@ void UISFXOnlineComponentLogin::OnDLCInfoLoaded ( )
 
 void UISFXOnlineComponentLogin::OpenCerberusUI ( )
 {
-	static UFunction* pFnOpenCerberusUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOpenCerberusUIRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OpenCerberusUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOpenCerberusUI )
-		pFnOpenCerberusUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OpenCerberusUI" );
+	UFunction* const pFnOpenCerberusUI = pFnOpenCerberusUIRef.Get ( );
 
 	UISFXOnlineComponentLogin_execOpenCerberusUI_Parms OpenCerberusUI_Parms;
 
-	pFnOpenCerberusUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOpenCerberusUI, &OpenCerberusUI_Parms, NULL );
-
-	pFnOpenCerberusUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOpenCerberusUI, &OpenCerberusUI_Parms ) )
+		this->ProcessEvent ( pFnOpenCerberusUI, &OpenCerberusUI_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CheckEntitlement
@@ -1483,20 +1225,16 @@ void UISFXOnlineComponentLogin::OpenCerberusUI ( )
 
 bool UISFXOnlineComponentLogin::CheckEntitlement ( FString const& sGroup, FString const& sTag )
 {
-	static UFunction* pFnCheckEntitlement = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCheckEntitlementRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CheckEntitlement", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCheckEntitlement )
-		pFnCheckEntitlement = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CheckEntitlement" );
+	UFunction* const pFnCheckEntitlement = pFnCheckEntitlementRef.Get ( );
 
 	UISFXOnlineComponentLogin_execCheckEntitlement_Parms CheckEntitlement_Parms;
 	memcpy ( &CheckEntitlement_Parms.sGroup, &sGroup, 0x10 );
 	memcpy ( &CheckEntitlement_Parms.sTag, &sTag, 0x10 );
 
-	pFnCheckEntitlement->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCheckEntitlement, &CheckEntitlement_Parms, NULL );
-
-	pFnCheckEntitlement->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCheckEntitlement, &CheckEntitlement_Parms ) )
+		this->ProcessEvent ( pFnCheckEntitlement, &CheckEntitlement_Parms, NULL );
 
 	return CheckEntitlement_Parms.ReturnValue;
 };
@@ -1508,18 +1246,14 @@ bool UISFXOnlineComponentLogin::CheckEntitlement ( FString const& sGroup, FStrin
 
 bool UISFXOnlineComponentLogin::IsCerberusMember ( )
 {
-	static UFunction* pFnIsCerberusMember = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsCerberusMemberRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsCerberusMember", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsCerberusMember )
-		pFnIsCerberusMember = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsCerberusMember" );
+	UFunction* const pFnIsCerberusMember = pFnIsCerberusMemberRef.Get ( );
 
 	UISFXOnlineComponentLogin_execIsCerberusMember_Parms IsCerberusMember_Parms;
 
-	pFnIsCerberusMember->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsCerberusMember, &IsCerberusMember_Parms, NULL );
-
-	pFnIsCerberusMember->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsCerberusMember, &IsCerberusMember_Parms ) )
+		this->ProcessEvent ( pFnIsCerberusMember, &IsCerberusMember_Parms, NULL );
 
 	return IsCerberusMember_Parms.ReturnValue;
 };
@@ -1531,19 +1265,15 @@ bool UISFXOnlineComponentLogin::IsCerberusMember ( )
 
 void UISFXOnlineComponentLogin::DisablePersona ( FString const& sPersonaNonGrata )
 {
-	static UFunction* pFnDisablePersona = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDisablePersonaRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.DisablePersona", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDisablePersona )
-		pFnDisablePersona = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.DisablePersona" );
+	UFunction* const pFnDisablePersona = pFnDisablePersonaRef.Get ( );
 
 	UISFXOnlineComponentLogin_execDisablePersona_Parms DisablePersona_Parms;
 	memcpy ( &DisablePersona_Parms.sPersonaNonGrata, &sPersonaNonGrata, 0x10 );
 
-	pFnDisablePersona->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDisablePersona, &DisablePersona_Parms, NULL );
-
-	pFnDisablePersona->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDisablePersona, &DisablePersona_Parms ) )
+		this->ProcessEvent ( pFnDisablePersona, &DisablePersona_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CreatePersona
@@ -1553,19 +1283,15 @@ void UISFXOnlineComponentLogin::DisablePersona ( FString const& sPersonaNonGrata
 
 void UISFXOnlineComponentLogin::CreatePersona ( FString const& sPersonaName )
 {
-	static UFunction* pFnCreatePersona = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCreatePersonaRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CreatePersona", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCreatePersona )
-		pFnCreatePersona = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CreatePersona" );
+	UFunction* const pFnCreatePersona = pFnCreatePersonaRef.Get ( );
 
 	UISFXOnlineComponentLogin_execCreatePersona_Parms CreatePersona_Parms;
 	memcpy ( &CreatePersona_Parms.sPersonaName, &sPersonaName, 0x10 );
 
-	pFnCreatePersona->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCreatePersona, &CreatePersona_Parms, NULL );
-
-	pFnCreatePersona->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCreatePersona, &CreatePersona_Parms ) )
+		this->ProcessEvent ( pFnCreatePersona, &CreatePersona_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SelectPersona
@@ -1575,19 +1301,15 @@ void UISFXOnlineComponentLogin::CreatePersona ( FString const& sPersonaName )
 
 void UISFXOnlineComponentLogin::SelectPersona ( FString const& sPersonaName )
 {
-	static UFunction* pFnSelectPersona = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSelectPersonaRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SelectPersona", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSelectPersona )
-		pFnSelectPersona = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SelectPersona" );
+	UFunction* const pFnSelectPersona = pFnSelectPersonaRef.Get ( );
 
 	UISFXOnlineComponentLogin_execSelectPersona_Parms SelectPersona_Parms;
 	memcpy ( &SelectPersona_Parms.sPersonaName, &sPersonaName, 0x10 );
 
-	pFnSelectPersona->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSelectPersona, &SelectPersona_Parms, NULL );
-
-	pFnSelectPersona->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSelectPersona, &SelectPersona_Parms ) )
+		this->ProcessEvent ( pFnSelectPersona, &SelectPersona_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.AcceptTOS
@@ -1597,19 +1319,15 @@ void UISFXOnlineComponentLogin::SelectPersona ( FString const& sPersonaName )
 
 void UISFXOnlineComponentLogin::AcceptTOS ( unsigned long bAccepted )
 {
-	static UFunction* pFnAcceptTOS = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAcceptTOSRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.AcceptTOS", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAcceptTOS )
-		pFnAcceptTOS = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.AcceptTOS" );
+	UFunction* const pFnAcceptTOS = pFnAcceptTOSRef.Get ( );
 
 	UISFXOnlineComponentLogin_execAcceptTOS_Parms AcceptTOS_Parms;
 	AcceptTOS_Parms.bAccepted = bAccepted;
 
-	pFnAcceptTOS->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAcceptTOS, &AcceptTOS_Parms, NULL );
-
-	pFnAcceptTOS->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAcceptTOS, &AcceptTOS_Parms ) )
+		this->ProcessEvent ( pFnAcceptTOS, &AcceptTOS_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.Disconnect
@@ -1618,18 +1336,14 @@ void UISFXOnlineComponentLogin::AcceptTOS ( unsigned long bAccepted )
 
 void UISFXOnlineComponentLogin::Disconnect ( )
 {
-	static UFunction* pFnDisconnect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDisconnectRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.Disconnect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDisconnect )
-		pFnDisconnect = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.Disconnect" );
+	UFunction* const pFnDisconnect = pFnDisconnectRef.Get ( );
 
 	UISFXOnlineComponentLogin_execDisconnect_Parms Disconnect_Parms;
 
-	pFnDisconnect->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDisconnect, &Disconnect_Parms, NULL );
-
-	pFnDisconnect->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDisconnect, &Disconnect_Parms ) )
+		this->ProcessEvent ( pFnDisconnect, &Disconnect_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitStore
@@ -1639,19 +1353,15 @@ void UISFXOnlineComponentLogin::Disconnect ( )
 
 void UISFXOnlineComponentLogin::SubmitStore ( TArray<int> const& aiChosen )
 {
-	static UFunction* pFnSubmitStore = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubmitStoreRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitStore", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubmitStore )
-		pFnSubmitStore = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitStore" );
+	UFunction* const pFnSubmitStore = pFnSubmitStoreRef.Get ( );
 
 	UISFXOnlineComponentLogin_execSubmitStore_Parms SubmitStore_Parms;
 	memcpy ( &SubmitStore_Parms.aiChosen, &aiChosen, 0x10 );
 
-	pFnSubmitStore->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubmitStore, &SubmitStore_Parms, NULL );
-
-	pFnSubmitStore->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubmitStore, &SubmitStore_Parms ) )
+		this->ProcessEvent ( pFnSubmitStore, &SubmitStore_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCreateNucleusAccountEx
@@ -1671,10 +1381,9 @@ void UISFXOnlineComponentLogin::SubmitStore ( TArray<int> const& aiChosen )
 
 void UISFXOnlineComponentLogin::SubmitCreateNucleusAccountEx ( FString const& sEmail, FString const& sPassword, unsigned long bEAProducts, unsigned long bThirdParty, unsigned long bBioWareProducts, FString const& i_sCountryCode, int BirthDay, int BirthMonth, int BirthYear, FString const& i_sLanguageCode, unsigned long bSubmit )
 {
-	static UFunction* pFnSubmitCreateNucleusAccountEx = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubmitCreateNucleusAccountExRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCreateNucleusAccountEx", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubmitCreateNucleusAccountEx )
-		pFnSubmitCreateNucleusAccountEx = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCreateNucleusAccountEx" );
+	UFunction* const pFnSubmitCreateNucleusAccountEx = pFnSubmitCreateNucleusAccountExRef.Get ( );
 
 	UISFXOnlineComponentLogin_execSubmitCreateNucleusAccountEx_Parms SubmitCreateNucleusAccountEx_Parms;
 	memcpy ( &SubmitCreateNucleusAccountEx_Parms.sEmail, &sEmail, 0x10 );
@@ -1689,11 +1398,8 @@ void UISFXOnlineComponentLogin::SubmitCreateNucleusAccountEx ( FString const& sE
 	memcpy ( &SubmitCreateNucleusAccountEx_Parms.i_sLanguageCode, &i_sLanguageCode, 0x10 );
 	SubmitCreateNucleusAccountEx_Parms.bSubmit = bSubmit;
 
-	pFnSubmitCreateNucleusAccountEx->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubmitCreateNucleusAccountEx, &SubmitCreateNucleusAccountEx_Parms, NULL );
-
-	pFnSubmitCreateNucleusAccountEx->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubmitCreateNucleusAccountEx, &SubmitCreateNucleusAccountEx_Parms ) )
+		this->ProcessEvent ( pFnSubmitCreateNucleusAccountEx, &SubmitCreateNucleusAccountEx_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitEmailPasswordMismatch
@@ -1705,21 +1411,17 @@ void UISFXOnlineComponentLogin::SubmitCreateNucleusAccountEx ( FString const& sE
 
 void UISFXOnlineComponentLogin::SubmitEmailPasswordMismatch ( FString const& Email, FString const& Password, int eReturnCode )
 {
-	static UFunction* pFnSubmitEmailPasswordMismatch = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubmitEmailPasswordMismatchRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitEmailPasswordMismatch", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubmitEmailPasswordMismatch )
-		pFnSubmitEmailPasswordMismatch = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitEmailPasswordMismatch" );
+	UFunction* const pFnSubmitEmailPasswordMismatch = pFnSubmitEmailPasswordMismatchRef.Get ( );
 
 	UISFXOnlineComponentLogin_execSubmitEmailPasswordMismatch_Parms SubmitEmailPasswordMismatch_Parms;
 	memcpy ( &SubmitEmailPasswordMismatch_Parms.Email, &Email, 0x10 );
 	memcpy ( &SubmitEmailPasswordMismatch_Parms.Password, &Password, 0x10 );
 	SubmitEmailPasswordMismatch_Parms.eReturnCode = eReturnCode;
 
-	pFnSubmitEmailPasswordMismatch->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubmitEmailPasswordMismatch, &SubmitEmailPasswordMismatch_Parms, NULL );
-
-	pFnSubmitEmailPasswordMismatch->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubmitEmailPasswordMismatch, &SubmitEmailPasswordMismatch_Parms ) )
+		this->ProcessEvent ( pFnSubmitEmailPasswordMismatch, &SubmitEmailPasswordMismatch_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitMessageBox
@@ -1729,19 +1431,15 @@ void UISFXOnlineComponentLogin::SubmitEmailPasswordMismatch ( FString const& Ema
 
 void UISFXOnlineComponentLogin::SubmitMessageBox ( int eReturnCode )
 {
-	static UFunction* pFnSubmitMessageBox = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubmitMessageBoxRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitMessageBox", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubmitMessageBox )
-		pFnSubmitMessageBox = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitMessageBox" );
+	UFunction* const pFnSubmitMessageBox = pFnSubmitMessageBoxRef.Get ( );
 
 	UISFXOnlineComponentLogin_execSubmitMessageBox_Parms SubmitMessageBox_Parms;
 	SubmitMessageBox_Parms.eReturnCode = eReturnCode;
 
-	pFnSubmitMessageBox->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubmitMessageBox, &SubmitMessageBox_Parms, NULL );
-
-	pFnSubmitMessageBox->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubmitMessageBox, &SubmitMessageBox_Parms ) )
+		this->ProcessEvent ( pFnSubmitMessageBox, &SubmitMessageBox_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitRedeemCode
@@ -1752,20 +1450,16 @@ void UISFXOnlineComponentLogin::SubmitMessageBox ( int eReturnCode )
 
 void UISFXOnlineComponentLogin::SubmitRedeemCode ( unsigned long bContinue, FString const& i_sCode )
 {
-	static UFunction* pFnSubmitRedeemCode = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubmitRedeemCodeRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitRedeemCode", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubmitRedeemCode )
-		pFnSubmitRedeemCode = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitRedeemCode" );
+	UFunction* const pFnSubmitRedeemCode = pFnSubmitRedeemCodeRef.Get ( );
 
 	UISFXOnlineComponentLogin_execSubmitRedeemCode_Parms SubmitRedeemCode_Parms;
 	SubmitRedeemCode_Parms.bContinue = bContinue;
 	memcpy ( &SubmitRedeemCode_Parms.i_sCode, &i_sCode, 0x10 );
 
-	pFnSubmitRedeemCode->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubmitRedeemCode, &SubmitRedeemCode_Parms, NULL );
-
-	pFnSubmitRedeemCode->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubmitRedeemCode, &SubmitRedeemCode_Parms ) )
+		this->ProcessEvent ( pFnSubmitRedeemCode, &SubmitRedeemCode_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCerberusWelcomeMessage
@@ -1774,18 +1468,14 @@ void UISFXOnlineComponentLogin::SubmitRedeemCode ( unsigned long bContinue, FStr
 
 void UISFXOnlineComponentLogin::SubmitCerberusWelcomeMessage ( )
 {
-	static UFunction* pFnSubmitCerberusWelcomeMessage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubmitCerberusWelcomeMessageRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCerberusWelcomeMessage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubmitCerberusWelcomeMessage )
-		pFnSubmitCerberusWelcomeMessage = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCerberusWelcomeMessage" );
+	UFunction* const pFnSubmitCerberusWelcomeMessage = pFnSubmitCerberusWelcomeMessageRef.Get ( );
 
 	UISFXOnlineComponentLogin_execSubmitCerberusWelcomeMessage_Parms SubmitCerberusWelcomeMessage_Parms;
 
-	pFnSubmitCerberusWelcomeMessage->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubmitCerberusWelcomeMessage, &SubmitCerberusWelcomeMessage_Parms, NULL );
-
-	pFnSubmitCerberusWelcomeMessage->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubmitCerberusWelcomeMessage, &SubmitCerberusWelcomeMessage_Parms ) )
+		this->ProcessEvent ( pFnSubmitCerberusWelcomeMessage, &SubmitCerberusWelcomeMessage_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCerberusIntro
@@ -1795,19 +1485,15 @@ void UISFXOnlineComponentLogin::SubmitCerberusWelcomeMessage ( )
 
 void UISFXOnlineComponentLogin::SubmitCerberusIntro ( int eReturnCode )
 {
-	static UFunction* pFnSubmitCerberusIntro = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubmitCerberusIntroRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCerberusIntro", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubmitCerberusIntro )
-		pFnSubmitCerberusIntro = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCerberusIntro" );
+	UFunction* const pFnSubmitCerberusIntro = pFnSubmitCerberusIntroRef.Get ( );
 
 	UISFXOnlineComponentLogin_execSubmitCerberusIntro_Parms SubmitCerberusIntro_Parms;
 	SubmitCerberusIntro_Parms.eReturnCode = eReturnCode;
 
-	pFnSubmitCerberusIntro->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubmitCerberusIntro, &SubmitCerberusIntro_Parms, NULL );
-
-	pFnSubmitCerberusIntro->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubmitCerberusIntro, &SubmitCerberusIntro_Parms ) )
+		this->ProcessEvent ( pFnSubmitCerberusIntro, &SubmitCerberusIntro_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitNucleusWelcomeMessage
@@ -1816,18 +1502,14 @@ void UISFXOnlineComponentLogin::SubmitCerberusIntro ( int eReturnCode )
 
 void UISFXOnlineComponentLogin::SubmitNucleusWelcomeMessage ( )
 {
-	static UFunction* pFnSubmitNucleusWelcomeMessage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubmitNucleusWelcomeMessageRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitNucleusWelcomeMessage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubmitNucleusWelcomeMessage )
-		pFnSubmitNucleusWelcomeMessage = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitNucleusWelcomeMessage" );
+	UFunction* const pFnSubmitNucleusWelcomeMessage = pFnSubmitNucleusWelcomeMessageRef.Get ( );
 
 	UISFXOnlineComponentLogin_execSubmitNucleusWelcomeMessage_Parms SubmitNucleusWelcomeMessage_Parms;
 
-	pFnSubmitNucleusWelcomeMessage->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubmitNucleusWelcomeMessage, &SubmitNucleusWelcomeMessage_Parms, NULL );
-
-	pFnSubmitNucleusWelcomeMessage->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubmitNucleusWelcomeMessage, &SubmitNucleusWelcomeMessage_Parms ) )
+		this->ProcessEvent ( pFnSubmitNucleusWelcomeMessage, &SubmitNucleusWelcomeMessage_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCreateNucleusAccount
@@ -1842,10 +1524,9 @@ void UISFXOnlineComponentLogin::SubmitNucleusWelcomeMessage ( )
 
 void UISFXOnlineComponentLogin::SubmitCreateNucleusAccount ( FString const& sEmail, FString const& sPassword, unsigned long bEAProducts, unsigned long bThirdParty, unsigned long bBioWareProducts, unsigned long bSubmit )
 {
-	static UFunction* pFnSubmitCreateNucleusAccount = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubmitCreateNucleusAccountRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCreateNucleusAccount", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubmitCreateNucleusAccount )
-		pFnSubmitCreateNucleusAccount = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCreateNucleusAccount" );
+	UFunction* const pFnSubmitCreateNucleusAccount = pFnSubmitCreateNucleusAccountRef.Get ( );
 
 	UISFXOnlineComponentLogin_execSubmitCreateNucleusAccount_Parms SubmitCreateNucleusAccount_Parms;
 	memcpy ( &SubmitCreateNucleusAccount_Parms.sEmail, &sEmail, 0x10 );
@@ -1855,11 +1536,8 @@ void UISFXOnlineComponentLogin::SubmitCreateNucleusAccount ( FString const& sEma
 	SubmitCreateNucleusAccount_Parms.bBioWareProducts = bBioWareProducts;
 	SubmitCreateNucleusAccount_Parms.bSubmit = bSubmit;
 
-	pFnSubmitCreateNucleusAccount->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubmitCreateNucleusAccount, &SubmitCreateNucleusAccount_Parms, NULL );
-
-	pFnSubmitCreateNucleusAccount->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubmitCreateNucleusAccount, &SubmitCreateNucleusAccount_Parms ) )
+		this->ProcessEvent ( pFnSubmitCreateNucleusAccount, &SubmitCreateNucleusAccount_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitParentEmail
@@ -1870,20 +1548,16 @@ void UISFXOnlineComponentLogin::SubmitCreateNucleusAccount ( FString const& sEma
 
 void UISFXOnlineComponentLogin::SubmitParentEmail ( unsigned long bContinue, FString const& ParentEmail )
 {
-	static UFunction* pFnSubmitParentEmail = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubmitParentEmailRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitParentEmail", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubmitParentEmail )
-		pFnSubmitParentEmail = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitParentEmail" );
+	UFunction* const pFnSubmitParentEmail = pFnSubmitParentEmailRef.Get ( );
 
 	UISFXOnlineComponentLogin_execSubmitParentEmail_Parms SubmitParentEmail_Parms;
 	SubmitParentEmail_Parms.bContinue = bContinue;
 	memcpy ( &SubmitParentEmail_Parms.ParentEmail, &ParentEmail, 0x10 );
 
-	pFnSubmitParentEmail->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubmitParentEmail, &SubmitParentEmail_Parms, NULL );
-
-	pFnSubmitParentEmail->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubmitParentEmail, &SubmitParentEmail_Parms ) )
+		this->ProcessEvent ( pFnSubmitParentEmail, &SubmitParentEmail_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitNucleusLogin
@@ -1895,21 +1569,17 @@ void UISFXOnlineComponentLogin::SubmitParentEmail ( unsigned long bContinue, FSt
 
 void UISFXOnlineComponentLogin::SubmitNucleusLogin ( FString const& Email, FString const& Password, unsigned char eReturnCode )
 {
-	static UFunction* pFnSubmitNucleusLogin = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubmitNucleusLoginRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitNucleusLogin", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubmitNucleusLogin )
-		pFnSubmitNucleusLogin = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitNucleusLogin" );
+	UFunction* const pFnSubmitNucleusLogin = pFnSubmitNucleusLoginRef.Get ( );
 
 	UISFXOnlineComponentLogin_execSubmitNucleusLogin_Parms SubmitNucleusLogin_Parms;
 	memcpy ( &SubmitNucleusLogin_Parms.Email, &Email, 0x10 );
 	memcpy ( &SubmitNucleusLogin_Parms.Password, &Password, 0x10 );
 	SubmitNucleusLogin_Parms.eReturnCode = eReturnCode;
 
-	pFnSubmitNucleusLogin->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubmitNucleusLogin, &SubmitNucleusLogin_Parms, NULL );
-
-	pFnSubmitNucleusLogin->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubmitNucleusLogin, &SubmitNucleusLogin_Parms ) )
+		this->ProcessEvent ( pFnSubmitNucleusLogin, &SubmitNucleusLogin_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitIntroPage
@@ -1920,20 +1590,16 @@ void UISFXOnlineComponentLogin::SubmitNucleusLogin ( FString const& Email, FStri
 
 void UISFXOnlineComponentLogin::SubmitIntroPage ( unsigned long bContinue, unsigned long bSimulated )
 {
-	static UFunction* pFnSubmitIntroPage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubmitIntroPageRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitIntroPage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubmitIntroPage )
-		pFnSubmitIntroPage = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitIntroPage" );
+	UFunction* const pFnSubmitIntroPage = pFnSubmitIntroPageRef.Get ( );
 
 	UISFXOnlineComponentLogin_execSubmitIntroPage_Parms SubmitIntroPage_Parms;
 	SubmitIntroPage_Parms.bContinue = bContinue;
 	SubmitIntroPage_Parms.bSimulated = bSimulated;
 
-	pFnSubmitIntroPage->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubmitIntroPage, &SubmitIntroPage_Parms, NULL );
-
-	pFnSubmitIntroPage->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubmitIntroPage, &SubmitIntroPage_Parms ) )
+		this->ProcessEvent ( pFnSubmitIntroPage, &SubmitIntroPage_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.Connect
@@ -1943,19 +1609,15 @@ void UISFXOnlineComponentLogin::SubmitIntroPage ( unsigned long bContinue, unsig
 
 void UISFXOnlineComponentLogin::Connect ( unsigned char connectMode )
 {
-	static UFunction* pFnConnect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnConnectRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.Connect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnConnect )
-		pFnConnect = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.Connect" );
+	UFunction* const pFnConnect = pFnConnectRef.Get ( );
 
 	UISFXOnlineComponentLogin_execConnect_Parms Connect_Parms;
 	Connect_Parms.connectMode = connectMode;
 
-	pFnConnect->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnConnect, &Connect_Parms, NULL );
-
-	pFnConnect->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnConnect, &Connect_Parms ) )
+		this->ProcessEvent ( pFnConnect, &Connect_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GoBackInUI
@@ -1964,18 +1626,14 @@ void UISFXOnlineComponentLogin::Connect ( unsigned char connectMode )
 
 void UISFXOnlineComponentLogin::GoBackInUI ( )
 {
-	static UFunction* pFnGoBackInUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGoBackInUIRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GoBackInUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGoBackInUI )
-		pFnGoBackInUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GoBackInUI" );
+	UFunction* const pFnGoBackInUI = pFnGoBackInUIRef.Get ( );
 
 	UISFXOnlineComponentLogin_execGoBackInUI_Parms GoBackInUI_Parms;
 
-	pFnGoBackInUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGoBackInUI, &GoBackInUI_Parms, NULL );
-
-	pFnGoBackInUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGoBackInUI, &GoBackInUI_Parms ) )
+		this->ProcessEvent ( pFnGoBackInUI, &GoBackInUI_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.Cancel
@@ -1984,18 +1642,14 @@ void UISFXOnlineComponentLogin::GoBackInUI ( )
 
 void UISFXOnlineComponentLogin::Cancel ( )
 {
-	static UFunction* pFnCancel = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCancelRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.Cancel", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCancel )
-		pFnCancel = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.Cancel" );
+	UFunction* const pFnCancel = pFnCancelRef.Get ( );
 
 	UISFXOnlineComponentLogin_execCancel_Parms Cancel_Parms;
 
-	pFnCancel->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCancel, &Cancel_Parms, NULL );
-
-	pFnCancel->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCancel, &Cancel_Parms ) )
+		this->ProcessEvent ( pFnCancel, &Cancel_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetUserId
@@ -2005,18 +1659,14 @@ void UISFXOnlineComponentLogin::Cancel ( )
 
 struct FUniqueNetId UISFXOnlineComponentLogin::GetUserId ( )
 {
-	static UFunction* pFnGetUserId = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUserIdRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetUserId", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUserId )
-		pFnGetUserId = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetUserId" );
+	UFunction* const pFnGetUserId = pFnGetUserIdRef.Get ( );
 
 	UISFXOnlineComponentLogin_execGetUserId_Parms GetUserId_Parms;
 
-	pFnGetUserId->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetUserId, &GetUserId_Parms, NULL );
-
-	pFnGetUserId->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetUserId, &GetUserId_Parms ) )
+		this->ProcessEvent ( pFnGetUserId, &GetUserId_Parms, NULL );
 
 	return GetUserId_Parms.ReturnValue;
 };
@@ -2028,18 +1678,14 @@ struct FUniqueNetId UISFXOnlineComponentLogin::GetUserId ( )
 
 FString UISFXOnlineComponentLogin::GetPersonaName ( )
 {
-	static UFunction* pFnGetPersonaName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPersonaNameRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetPersonaName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPersonaName )
-		pFnGetPersonaName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetPersonaName" );
+	UFunction* const pFnGetPersonaName = pFnGetPersonaNameRef.Get ( );
 
 	UISFXOnlineComponentLogin_execGetPersonaName_Parms GetPersonaName_Parms;
 
-	pFnGetPersonaName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetPersonaName, &GetPersonaName_Parms, NULL );
-
-	pFnGetPersonaName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetPersonaName, &GetPersonaName_Parms ) )
+		this->ProcessEvent ( pFnGetPersonaName, &GetPersonaName_Parms, NULL );
 
 	return GetPersonaName_Parms.ReturnValue;
 };
@@ -2051,18 +1697,14 @@ FString UISFXOnlineComponentLogin::GetPersonaName ( )
 
 bool UISFXOnlineComponentLogin::HasInternetConnection ( )
 {
-	static UFunction* pFnHasInternetConnection = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHasInternetConnectionRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.HasInternetConnection", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHasInternetConnection )
-		pFnHasInternetConnection = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.HasInternetConnection" );
+	UFunction* const pFnHasInternetConnection = pFnHasInternetConnectionRef.Get ( );
 
 	UISFXOnlineComponentLogin_execHasInternetConnection_Parms HasInternetConnection_Parms;
 
-	pFnHasInternetConnection->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnHasInternetConnection, &HasInternetConnection_Parms, NULL );
-
-	pFnHasInternetConnection->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnHasInternetConnection, &HasInternetConnection_Parms ) )
+		this->ProcessEvent ( pFnHasInternetConnection, &HasInternetConnection_Parms, NULL );
 
 	return HasInternetConnection_Parms.ReturnValue;
 };
@@ -2074,18 +1716,14 @@ bool UISFXOnlineComponentLogin::HasInternetConnection ( )
 
 bool UISFXOnlineComponentLogin::IsConnectedTo3rdPartyOnlineService ( )
 {
-	static UFunction* pFnIsConnectedTo3rdPartyOnlineService = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsConnectedTo3rdPartyOnlineServiceRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsConnectedTo3rdPartyOnlineService", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsConnectedTo3rdPartyOnlineService )
-		pFnIsConnectedTo3rdPartyOnlineService = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsConnectedTo3rdPartyOnlineService" );
+	UFunction* const pFnIsConnectedTo3rdPartyOnlineService = pFnIsConnectedTo3rdPartyOnlineServiceRef.Get ( );
 
 	UISFXOnlineComponentLogin_execIsConnectedTo3rdPartyOnlineService_Parms IsConnectedTo3rdPartyOnlineService_Parms;
 
-	pFnIsConnectedTo3rdPartyOnlineService->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsConnectedTo3rdPartyOnlineService, &IsConnectedTo3rdPartyOnlineService_Parms, NULL );
-
-	pFnIsConnectedTo3rdPartyOnlineService->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsConnectedTo3rdPartyOnlineService, &IsConnectedTo3rdPartyOnlineService_Parms ) )
+		this->ProcessEvent ( pFnIsConnectedTo3rdPartyOnlineService, &IsConnectedTo3rdPartyOnlineService_Parms, NULL );
 
 	return IsConnectedTo3rdPartyOnlineService_Parms.ReturnValue;
 };
@@ -2097,18 +1735,14 @@ bool UISFXOnlineComponentLogin::IsConnectedTo3rdPartyOnlineService ( )
 
 bool UISFXOnlineComponentLogin::HasAccountFor3rdPartyOnlineService ( )
 {
-	static UFunction* pFnHasAccountFor3rdPartyOnlineService = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHasAccountFor3rdPartyOnlineServiceRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.HasAccountFor3rdPartyOnlineService", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHasAccountFor3rdPartyOnlineService )
-		pFnHasAccountFor3rdPartyOnlineService = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.HasAccountFor3rdPartyOnlineService" );
+	UFunction* const pFnHasAccountFor3rdPartyOnlineService = pFnHasAccountFor3rdPartyOnlineServiceRef.Get ( );
 
 	UISFXOnlineComponentLogin_execHasAccountFor3rdPartyOnlineService_Parms HasAccountFor3rdPartyOnlineService_Parms;
 
-	pFnHasAccountFor3rdPartyOnlineService->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnHasAccountFor3rdPartyOnlineService, &HasAccountFor3rdPartyOnlineService_Parms, NULL );
-
-	pFnHasAccountFor3rdPartyOnlineService->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnHasAccountFor3rdPartyOnlineService, &HasAccountFor3rdPartyOnlineService_Parms ) )
+		this->ProcessEvent ( pFnHasAccountFor3rdPartyOnlineService, &HasAccountFor3rdPartyOnlineService_Parms, NULL );
 
 	return HasAccountFor3rdPartyOnlineService_Parms.ReturnValue;
 };
@@ -2120,18 +1754,14 @@ bool UISFXOnlineComponentLogin::HasAccountFor3rdPartyOnlineService ( )
 
 bool UISFXOnlineComponentLogin::IsSignedIn ( )
 {
-	static UFunction* pFnIsSignedIn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsSignedInRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsSignedIn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsSignedIn )
-		pFnIsSignedIn = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsSignedIn" );
+	UFunction* const pFnIsSignedIn = pFnIsSignedInRef.Get ( );
 
 	UISFXOnlineComponentLogin_execIsSignedIn_Parms IsSignedIn_Parms;
 
-	pFnIsSignedIn->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsSignedIn, &IsSignedIn_Parms, NULL );
-
-	pFnIsSignedIn->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsSignedIn, &IsSignedIn_Parms ) )
+		this->ProcessEvent ( pFnIsSignedIn, &IsSignedIn_Parms, NULL );
 
 	return IsSignedIn_Parms.ReturnValue;
 };
@@ -2143,18 +1773,14 @@ bool UISFXOnlineComponentLogin::IsSignedIn ( )
 
 bool UISFXOnlineComponentLogin::IsConnected ( )
 {
-	static UFunction* pFnIsConnected = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsConnectedRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsConnected", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsConnected )
-		pFnIsConnected = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsConnected" );
+	UFunction* const pFnIsConnected = pFnIsConnectedRef.Get ( );
 
 	UISFXOnlineComponentLogin_execIsConnected_Parms IsConnected_Parms;
 
-	pFnIsConnected->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsConnected, &IsConnected_Parms, NULL );
-
-	pFnIsConnected->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsConnected, &IsConnected_Parms ) )
+		this->ProcessEvent ( pFnIsConnected, &IsConnected_Parms, NULL );
 
 	return IsConnected_Parms.ReturnValue;
 };
@@ -2166,19 +1792,15 @@ bool UISFXOnlineComponentLogin::IsConnected ( )
 
 void UISFXOnlineComponentLogin::SwitchActiveUserIndex ( int nNewIndex )
 {
-	static UFunction* pFnSwitchActiveUserIndex = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSwitchActiveUserIndexRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SwitchActiveUserIndex", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSwitchActiveUserIndex )
-		pFnSwitchActiveUserIndex = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SwitchActiveUserIndex" );
+	UFunction* const pFnSwitchActiveUserIndex = pFnSwitchActiveUserIndexRef.Get ( );
 
 	UISFXOnlineComponentLogin_execSwitchActiveUserIndex_Parms SwitchActiveUserIndex_Parms;
 	SwitchActiveUserIndex_Parms.nNewIndex = nNewIndex;
 
-	pFnSwitchActiveUserIndex->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSwitchActiveUserIndex, &SwitchActiveUserIndex_Parms, NULL );
-
-	pFnSwitchActiveUserIndex->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSwitchActiveUserIndex, &SwitchActiveUserIndex_Parms ) )
+		this->ProcessEvent ( pFnSwitchActiveUserIndex, &SwitchActiveUserIndex_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetActiveUserIndex
@@ -2188,18 +1810,14 @@ void UISFXOnlineComponentLogin::SwitchActiveUserIndex ( int nNewIndex )
 
 int UISFXOnlineComponentLogin::GetActiveUserIndex ( )
 {
-	static UFunction* pFnGetActiveUserIndex = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetActiveUserIndexRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetActiveUserIndex", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetActiveUserIndex )
-		pFnGetActiveUserIndex = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetActiveUserIndex" );
+	UFunction* const pFnGetActiveUserIndex = pFnGetActiveUserIndexRef.Get ( );
 
 	UISFXOnlineComponentLogin_execGetActiveUserIndex_Parms GetActiveUserIndex_Parms;
 
-	pFnGetActiveUserIndex->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetActiveUserIndex, &GetActiveUserIndex_Parms, NULL );
-
-	pFnGetActiveUserIndex->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetActiveUserIndex, &GetActiveUserIndex_Parms ) )
+		this->ProcessEvent ( pFnGetActiveUserIndex, &GetActiveUserIndex_Parms, NULL );
 
 	return GetActiveUserIndex_Parms.ReturnValue;
 };
@@ -2211,32 +1829,25 @@ int UISFXOnlineComponentLogin::GetActiveUserIndex ( )
 
 unsigned char UISFXOnlineComponentLogin::GetLoginStatus ( )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLoginStatusRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetLoginStatus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetLoginStatus" );
+	UFunction* const pFnGetLoginStatus = pFnGetLoginStatusRef.Get ( );
 
 	UISFXOnlineComponentLogin_execGetLoginStatus_Parms GetLoginStatus_Parms;
 
-	pFnGetLoginStatus->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetLoginStatus, &GetLoginStatus_Parms, NULL );
-
-	pFnGetLoginStatus->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetLoginStatus, &GetLoginStatus_Parms ) )
+		this->ProcessEvent ( pFnGetLoginStatus, &GetLoginStatus_Parms, NULL );
 
 	return GetLoginStatus_Parms.ReturnValue;
 };
 
 
 
-class UClass* UISFXOnlineComponentNotification::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UISFXOnlineComponentNotification::pClassPointer { L"Class SFXOnlineFoundation.ISFXOnlineComponentNotification", &UObject::FindClass };
 
 class UClass* UISFXOnlineComponentNotification::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.ISFXOnlineComponentNotification" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetTargetOfferInfo
@@ -2247,19 +1858,15 @@ class UClass* UISFXOnlineComponentNotification::StaticClass()
 
 struct FSFXOnlineTargetOfferInfo UISFXOnlineComponentNotification::GetTargetOfferInfo ( unsigned char nSource )
 {
-	static UFunction* pFnGetTargetOfferInfo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTargetOfferInfoRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetTargetOfferInfo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTargetOfferInfo )
-		pFnGetTargetOfferInfo = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetTargetOfferInfo" );
+	UFunction* const pFnGetTargetOfferInfo = pFnGetTargetOfferInfoRef.Get ( );
 
 	UISFXOnlineComponentNotification_execGetTargetOfferInfo_Parms GetTargetOfferInfo_Parms;
 	GetTargetOfferInfo_Parms.nSource = nSource;
 
-	pFnGetTargetOfferInfo->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetTargetOfferInfo, &GetTargetOfferInfo_Parms, NULL );
-
-	pFnGetTargetOfferInfo->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetTargetOfferInfo, &GetTargetOfferInfo_Parms ) )
+		this->ProcessEvent ( pFnGetTargetOfferInfo, &GetTargetOfferInfo_Parms, NULL );
 
 	return GetTargetOfferInfo_Parms.ReturnValue;
 };
@@ -2272,19 +1879,15 @@ struct FSFXOnlineTargetOfferInfo UISFXOnlineComponentNotification::GetTargetOffe
 
 unsigned char UISFXOnlineComponentNotification::HasUserPurchasedAnOffer ( struct FSFXOnline_OfferID const& aOfferId )
 {
-	static UFunction* pFnHasUserPurchasedAnOffer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHasUserPurchasedAnOfferRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.HasUserPurchasedAnOffer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHasUserPurchasedAnOffer )
-		pFnHasUserPurchasedAnOffer = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.HasUserPurchasedAnOffer" );
+	UFunction* const pFnHasUserPurchasedAnOffer = pFnHasUserPurchasedAnOfferRef.Get ( );
 
 	UISFXOnlineComponentNotification_execHasUserPurchasedAnOffer_Parms HasUserPurchasedAnOffer_Parms;
 	memcpy ( &HasUserPurchasedAnOffer_Parms.aOfferId, &aOfferId, 0x8 );
 
-	pFnHasUserPurchasedAnOffer->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnHasUserPurchasedAnOffer, &HasUserPurchasedAnOffer_Parms, NULL );
-
-	pFnHasUserPurchasedAnOffer->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnHasUserPurchasedAnOffer, &HasUserPurchasedAnOffer_Parms ) )
+		this->ProcessEvent ( pFnHasUserPurchasedAnOffer, &HasUserPurchasedAnOffer_Parms, NULL );
 
 	return HasUserPurchasedAnOffer_Parms.ReturnValue;
 };
@@ -2297,19 +1900,15 @@ unsigned char UISFXOnlineComponentNotification::HasUserPurchasedAnOffer ( struct
 
 bool UISFXOnlineComponentNotification::DownloadOffers ( TArray<struct FSFXOnline_OfferID> const& aOfferIds )
 {
-	static UFunction* pFnDownloadOffers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDownloadOffersRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.DownloadOffers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDownloadOffers )
-		pFnDownloadOffers = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.DownloadOffers" );
+	UFunction* const pFnDownloadOffers = pFnDownloadOffersRef.Get ( );
 
 	UISFXOnlineComponentNotification_execDownloadOffers_Parms DownloadOffers_Parms;
 	memcpy ( &DownloadOffers_Parms.aOfferIds, &aOfferIds, 0x10 );
 
-	pFnDownloadOffers->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDownloadOffers, &DownloadOffers_Parms, NULL );
-
-	pFnDownloadOffers->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDownloadOffers, &DownloadOffers_Parms ) )
+		this->ProcessEvent ( pFnDownloadOffers, &DownloadOffers_Parms, NULL );
 
 	return DownloadOffers_Parms.ReturnValue;
 };
@@ -2322,19 +1921,15 @@ bool UISFXOnlineComponentNotification::DownloadOffers ( TArray<struct FSFXOnline
 
 FString UISFXOnlineComponentNotification::GetOfferKeyIfEntitled ( int internalId )
 {
-	static UFunction* pFnGetOfferKeyIfEntitled = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOfferKeyIfEntitledRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetOfferKeyIfEntitled", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOfferKeyIfEntitled )
-		pFnGetOfferKeyIfEntitled = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetOfferKeyIfEntitled" );
+	UFunction* const pFnGetOfferKeyIfEntitled = pFnGetOfferKeyIfEntitledRef.Get ( );
 
 	UISFXOnlineComponentNotification_execGetOfferKeyIfEntitled_Parms GetOfferKeyIfEntitled_Parms;
 	GetOfferKeyIfEntitled_Parms.internalId = internalId;
 
-	pFnGetOfferKeyIfEntitled->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetOfferKeyIfEntitled, &GetOfferKeyIfEntitled_Parms, NULL );
-
-	pFnGetOfferKeyIfEntitled->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetOfferKeyIfEntitled, &GetOfferKeyIfEntitled_Parms ) )
+		this->ProcessEvent ( pFnGetOfferKeyIfEntitled, &GetOfferKeyIfEntitled_Parms, NULL );
 
 	return GetOfferKeyIfEntitled_Parms.ReturnValue;
 };
@@ -2346,18 +1941,14 @@ FString UISFXOnlineComponentNotification::GetOfferKeyIfEntitled ( int internalId
 
 TArray<struct FSFXOfferDescriptor> UISFXOnlineComponentNotification::GetGrantingOffers ( )
 {
-	static UFunction* pFnGetGrantingOffers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetGrantingOffersRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetGrantingOffers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetGrantingOffers )
-		pFnGetGrantingOffers = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetGrantingOffers" );
+	UFunction* const pFnGetGrantingOffers = pFnGetGrantingOffersRef.Get ( );
 
 	UISFXOnlineComponentNotification_execGetGrantingOffers_Parms GetGrantingOffers_Parms;
 
-	pFnGetGrantingOffers->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetGrantingOffers, &GetGrantingOffers_Parms, NULL );
-
-	pFnGetGrantingOffers->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetGrantingOffers, &GetGrantingOffers_Parms ) )
+		this->ProcessEvent ( pFnGetGrantingOffers, &GetGrantingOffers_Parms, NULL );
 
 	return GetGrantingOffers_Parms.ReturnValue;
 };
@@ -2369,18 +1960,14 @@ TArray<struct FSFXOfferDescriptor> UISFXOnlineComponentNotification::GetGranting
 
 TArray<struct FSFXOfferDescriptor> UISFXOnlineComponentNotification::GetEntitledDLCInfo ( )
 {
-	static UFunction* pFnGetEntitledDLCInfo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEntitledDLCInfoRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetEntitledDLCInfo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEntitledDLCInfo )
-		pFnGetEntitledDLCInfo = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetEntitledDLCInfo" );
+	UFunction* const pFnGetEntitledDLCInfo = pFnGetEntitledDLCInfoRef.Get ( );
 
 	UISFXOnlineComponentNotification_execGetEntitledDLCInfo_Parms GetEntitledDLCInfo_Parms;
 
-	pFnGetEntitledDLCInfo->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetEntitledDLCInfo, &GetEntitledDLCInfo_Parms, NULL );
-
-	pFnGetEntitledDLCInfo->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetEntitledDLCInfo, &GetEntitledDLCInfo_Parms ) )
+		this->ProcessEvent ( pFnGetEntitledDLCInfo, &GetEntitledDLCInfo_Parms, NULL );
 
 	return GetEntitledDLCInfo_Parms.ReturnValue;
 };
@@ -2391,18 +1978,14 @@ TArray<struct FSFXOfferDescriptor> UISFXOnlineComponentNotification::GetEntitled
 
 void UISFXOnlineComponentNotification::RefreshEntitlementFlags ( )
 {
-	static UFunction* pFnRefreshEntitlementFlags = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRefreshEntitlementFlagsRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.RefreshEntitlementFlags", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRefreshEntitlementFlags )
-		pFnRefreshEntitlementFlags = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.RefreshEntitlementFlags" );
+	UFunction* const pFnRefreshEntitlementFlags = pFnRefreshEntitlementFlagsRef.Get ( );
 
 	UISFXOnlineComponentNotification_execRefreshEntitlementFlags_Parms RefreshEntitlementFlags_Parms;
 
-	pFnRefreshEntitlementFlags->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRefreshEntitlementFlags, &RefreshEntitlementFlags_Parms, NULL );
-
-	pFnRefreshEntitlementFlags->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRefreshEntitlementFlags, &RefreshEntitlementFlags_Parms ) )
+		this->ProcessEvent ( pFnRefreshEntitlementFlags, &RefreshEntitlementFlags_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetEntitlementGroups
@@ -2412,18 +1995,14 @@ void UISFXOnlineComponentNotification::RefreshEntitlementFlags ( )
 
 TArray<struct FSFXOnlineEntitlementGroupInfo> UISFXOnlineComponentNotification::GetEntitlementGroups ( )
 {
-	static UFunction* pFnGetEntitlementGroups = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEntitlementGroupsRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetEntitlementGroups", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEntitlementGroups )
-		pFnGetEntitlementGroups = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetEntitlementGroups" );
+	UFunction* const pFnGetEntitlementGroups = pFnGetEntitlementGroupsRef.Get ( );
 
 	UISFXOnlineComponentNotification_execGetEntitlementGroups_Parms GetEntitlementGroups_Parms;
 
-	pFnGetEntitlementGroups->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetEntitlementGroups, &GetEntitlementGroups_Parms, NULL );
-
-	pFnGetEntitlementGroups->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetEntitlementGroups, &GetEntitlementGroups_Parms ) )
+		this->ProcessEvent ( pFnGetEntitlementGroups, &GetEntitlementGroups_Parms, NULL );
 
 	return GetEntitlementGroups_Parms.ReturnValue;
 };
@@ -2435,18 +2014,14 @@ TArray<struct FSFXOnlineEntitlementGroupInfo> UISFXOnlineComponentNotification::
 
 int UISFXOnlineComponentNotification::GetDaysSinceCerberusRegistration ( )
 {
-	static UFunction* pFnGetDaysSinceCerberusRegistration = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDaysSinceCerberusRegistrationRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetDaysSinceCerberusRegistration", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDaysSinceCerberusRegistration )
-		pFnGetDaysSinceCerberusRegistration = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetDaysSinceCerberusRegistration" );
+	UFunction* const pFnGetDaysSinceCerberusRegistration = pFnGetDaysSinceCerberusRegistrationRef.Get ( );
 
 	UISFXOnlineComponentNotification_execGetDaysSinceCerberusRegistration_Parms GetDaysSinceCerberusRegistration_Parms;
 
-	pFnGetDaysSinceCerberusRegistration->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetDaysSinceCerberusRegistration, &GetDaysSinceCerberusRegistration_Parms, NULL );
-
-	pFnGetDaysSinceCerberusRegistration->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetDaysSinceCerberusRegistration, &GetDaysSinceCerberusRegistration_Parms ) )
+		this->ProcessEvent ( pFnGetDaysSinceCerberusRegistration, &GetDaysSinceCerberusRegistration_Parms, NULL );
 
 	return GetDaysSinceCerberusRegistration_Parms.ReturnValue;
 };
@@ -2459,19 +2034,15 @@ int UISFXOnlineComponentNotification::GetDaysSinceCerberusRegistration ( )
 
 bool UISFXOnlineComponentNotification::IsCalendarUnlockEarned ( int nDay )
 {
-	static UFunction* pFnIsCalendarUnlockEarned = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsCalendarUnlockEarnedRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.IsCalendarUnlockEarned", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsCalendarUnlockEarned )
-		pFnIsCalendarUnlockEarned = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.IsCalendarUnlockEarned" );
+	UFunction* const pFnIsCalendarUnlockEarned = pFnIsCalendarUnlockEarnedRef.Get ( );
 
 	UISFXOnlineComponentNotification_execIsCalendarUnlockEarned_Parms IsCalendarUnlockEarned_Parms;
 	IsCalendarUnlockEarned_Parms.nDay = nDay;
 
-	pFnIsCalendarUnlockEarned->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsCalendarUnlockEarned, &IsCalendarUnlockEarned_Parms, NULL );
-
-	pFnIsCalendarUnlockEarned->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsCalendarUnlockEarned, &IsCalendarUnlockEarned_Parms ) )
+		this->ProcessEvent ( pFnIsCalendarUnlockEarned, &IsCalendarUnlockEarned_Parms, NULL );
 
 	return IsCalendarUnlockEarned_Parms.ReturnValue;
 };
@@ -2482,18 +2053,14 @@ bool UISFXOnlineComponentNotification::IsCalendarUnlockEarned ( int nDay )
 
 void UISFXOnlineComponentNotification::RequestServerInfo ( )
 {
-	static UFunction* pFnRequestServerInfo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRequestServerInfoRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.RequestServerInfo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRequestServerInfo )
-		pFnRequestServerInfo = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.RequestServerInfo" );
+	UFunction* const pFnRequestServerInfo = pFnRequestServerInfoRef.Get ( );
 
 	UISFXOnlineComponentNotification_execRequestServerInfo_Parms RequestServerInfo_Parms;
 
-	pFnRequestServerInfo->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRequestServerInfo, &RequestServerInfo_Parms, NULL );
-
-	pFnRequestServerInfo->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRequestServerInfo, &RequestServerInfo_Parms ) )
+		this->ProcessEvent ( pFnRequestServerInfo, &RequestServerInfo_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentNotification.RequestData
@@ -2502,30 +2069,23 @@ void UISFXOnlineComponentNotification::RequestServerInfo ( )
 
 void UISFXOnlineComponentNotification::RequestData ( )
 {
-	static UFunction* pFnRequestData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRequestDataRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.RequestData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRequestData )
-		pFnRequestData = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.RequestData" );
+	UFunction* const pFnRequestData = pFnRequestDataRef.Get ( );
 
 	UISFXOnlineComponentNotification_execRequestData_Parms RequestData_Parms;
 
-	pFnRequestData->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRequestData, &RequestData_Parms, NULL );
-
-	pFnRequestData->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRequestData, &RequestData_Parms ) )
+		this->ProcessEvent ( pFnRequestData, &RequestData_Parms, NULL );
 };
 
 
 
-class UClass* UISFXOnlineComponentPlatform::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UISFXOnlineComponentPlatform::pClassPointer { L"Class SFXOnlineFoundation.ISFXOnlineComponentPlatform", &UObject::FindClass };
 
 class UClass* UISFXOnlineComponentPlatform::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.ISFXOnlineComponentPlatform" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.GetRebootUserData
@@ -2535,18 +2095,14 @@ class UClass* UISFXOnlineComponentPlatform::StaticClass()
 
 int UISFXOnlineComponentPlatform::GetRebootUserData ( )
 {
-	static UFunction* pFnGetRebootUserData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetRebootUserDataRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.GetRebootUserData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetRebootUserData )
-		pFnGetRebootUserData = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.GetRebootUserData" );
+	UFunction* const pFnGetRebootUserData = pFnGetRebootUserDataRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execGetRebootUserData_Parms GetRebootUserData_Parms;
 
-	pFnGetRebootUserData->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetRebootUserData, &GetRebootUserData_Parms, NULL );
-
-	pFnGetRebootUserData->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetRebootUserData, &GetRebootUserData_Parms ) )
+		this->ProcessEvent ( pFnGetRebootUserData, &GetRebootUserData_Parms, NULL );
 
 	return GetRebootUserData_Parms.ReturnValue;
 };
@@ -2558,18 +2114,14 @@ int UISFXOnlineComponentPlatform::GetRebootUserData ( )
 
 bool UISFXOnlineComponentPlatform::WasRebootedFromOSCodeRedemptionUI ( )
 {
-	static UFunction* pFnWasRebootedFromOSCodeRedemptionUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWasRebootedFromOSCodeRedemptionUIRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.WasRebootedFromOSCodeRedemptionUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWasRebootedFromOSCodeRedemptionUI )
-		pFnWasRebootedFromOSCodeRedemptionUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.WasRebootedFromOSCodeRedemptionUI" );
+	UFunction* const pFnWasRebootedFromOSCodeRedemptionUI = pFnWasRebootedFromOSCodeRedemptionUIRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execWasRebootedFromOSCodeRedemptionUI_Parms WasRebootedFromOSCodeRedemptionUI_Parms;
 
-	pFnWasRebootedFromOSCodeRedemptionUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms, NULL );
-
-	pFnWasRebootedFromOSCodeRedemptionUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms ) )
+		this->ProcessEvent ( pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms, NULL );
 
 	return WasRebootedFromOSCodeRedemptionUI_Parms.ReturnValue;
 };
@@ -2582,19 +2134,15 @@ bool UISFXOnlineComponentPlatform::WasRebootedFromOSCodeRedemptionUI ( )
 
 bool UISFXOnlineComponentPlatform::ShowCodeRedemptionUI ( int UserData )
 {
-	static UFunction* pFnShowCodeRedemptionUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowCodeRedemptionUIRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowCodeRedemptionUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowCodeRedemptionUI )
-		pFnShowCodeRedemptionUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowCodeRedemptionUI" );
+	UFunction* const pFnShowCodeRedemptionUI = pFnShowCodeRedemptionUIRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execShowCodeRedemptionUI_Parms ShowCodeRedemptionUI_Parms;
 	ShowCodeRedemptionUI_Parms.UserData = UserData;
 
-	pFnShowCodeRedemptionUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms, NULL );
-
-	pFnShowCodeRedemptionUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms ) )
+		this->ProcessEvent ( pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms, NULL );
 
 	return ShowCodeRedemptionUI_Parms.ReturnValue;
 };
@@ -2606,18 +2154,14 @@ bool UISFXOnlineComponentPlatform::ShowCodeRedemptionUI ( int UserData )
 
 bool UISFXOnlineComponentPlatform::ShowStoreUI ( )
 {
-	static UFunction* pFnShowStoreUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowStoreUIRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowStoreUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowStoreUI )
-		pFnShowStoreUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowStoreUI" );
+	UFunction* const pFnShowStoreUI = pFnShowStoreUIRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execShowStoreUI_Parms ShowStoreUI_Parms;
 
-	pFnShowStoreUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowStoreUI, &ShowStoreUI_Parms, NULL );
-
-	pFnShowStoreUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowStoreUI, &ShowStoreUI_Parms ) )
+		this->ProcessEvent ( pFnShowStoreUI, &ShowStoreUI_Parms, NULL );
 
 	return ShowStoreUI_Parms.ReturnValue;
 };
@@ -2631,10 +2175,9 @@ bool UISFXOnlineComponentPlatform::ShowStoreUI ( )
 
 bool UISFXOnlineComponentPlatform::GetOnlineXuid ( int nUserIndex, struct FUniqueNetId* oUserXuid )
 {
-	static UFunction* pFnGetOnlineXuid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOnlineXuidRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.GetOnlineXuid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOnlineXuid )
-		pFnGetOnlineXuid = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.GetOnlineXuid" );
+	UFunction* const pFnGetOnlineXuid = pFnGetOnlineXuidRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execGetOnlineXuid_Parms GetOnlineXuid_Parms;
 	GetOnlineXuid_Parms.nUserIndex = nUserIndex;
@@ -2642,11 +2185,8 @@ bool UISFXOnlineComponentPlatform::GetOnlineXuid ( int nUserIndex, struct FUniqu
 	if ( oUserXuid )
 		memcpy ( &GetOnlineXuid_Parms.oUserXuid, oUserXuid, 0x8 );
 
-	pFnGetOnlineXuid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetOnlineXuid, &GetOnlineXuid_Parms, NULL );
-
-	pFnGetOnlineXuid->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetOnlineXuid, &GetOnlineXuid_Parms ) )
+		this->ProcessEvent ( pFnGetOnlineXuid, &GetOnlineXuid_Parms, NULL );
 
 	if ( oUserXuid )
 		memcpy ( oUserXuid, &GetOnlineXuid_Parms.oUserXuid, 0x8 );
@@ -2663,10 +2203,9 @@ bool UISFXOnlineComponentPlatform::GetOnlineXuid ( int nUserIndex, struct FUniqu
 
 bool UISFXOnlineComponentPlatform::GetOfflineXuid ( int nUserIndex, struct FUniqueNetId* oUserXuid )
 {
-	static UFunction* pFnGetOfflineXuid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOfflineXuidRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.GetOfflineXuid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOfflineXuid )
-		pFnGetOfflineXuid = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.GetOfflineXuid" );
+	UFunction* const pFnGetOfflineXuid = pFnGetOfflineXuidRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execGetOfflineXuid_Parms GetOfflineXuid_Parms;
 	GetOfflineXuid_Parms.nUserIndex = nUserIndex;
@@ -2674,11 +2213,8 @@ bool UISFXOnlineComponentPlatform::GetOfflineXuid ( int nUserIndex, struct FUniq
 	if ( oUserXuid )
 		memcpy ( &GetOfflineXuid_Parms.oUserXuid, oUserXuid, 0x8 );
 
-	pFnGetOfflineXuid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetOfflineXuid, &GetOfflineXuid_Parms, NULL );
-
-	pFnGetOfflineXuid->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetOfflineXuid, &GetOfflineXuid_Parms ) )
+		this->ProcessEvent ( pFnGetOfflineXuid, &GetOfflineXuid_Parms, NULL );
 
 	if ( oUserXuid )
 		memcpy ( oUserXuid, &GetOfflineXuid_Parms.oUserXuid, 0x8 );
@@ -2695,20 +2231,16 @@ bool UISFXOnlineComponentPlatform::GetOfflineXuid ( int nUserIndex, struct FUniq
 
 bool UISFXOnlineComponentPlatform::AddRecentPlayer ( struct FUniqueNetId const& oPlayerId, FString const& sDescription )
 {
-	static UFunction* pFnAddRecentPlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddRecentPlayerRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.AddRecentPlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddRecentPlayer )
-		pFnAddRecentPlayer = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.AddRecentPlayer" );
+	UFunction* const pFnAddRecentPlayer = pFnAddRecentPlayerRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execAddRecentPlayer_Parms AddRecentPlayer_Parms;
 	memcpy ( &AddRecentPlayer_Parms.oPlayerId, &oPlayerId, 0x8 );
 	memcpy ( &AddRecentPlayer_Parms.sDescription, &sDescription, 0x10 );
 
-	pFnAddRecentPlayer->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddRecentPlayer, &AddRecentPlayer_Parms, NULL );
-
-	pFnAddRecentPlayer->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAddRecentPlayer, &AddRecentPlayer_Parms ) )
+		this->ProcessEvent ( pFnAddRecentPlayer, &AddRecentPlayer_Parms, NULL );
 
 	return AddRecentPlayer_Parms.ReturnValue;
 };
@@ -2728,10 +2260,9 @@ bool UISFXOnlineComponentPlatform::AddRecentPlayer ( struct FUniqueNetId const&
 
 bool UISFXOnlineComponentPlatform::ShowKeyboardUI ( unsigned char byLocalUserNum, FString const& sTitleText, FString const& sDescriptionText, unsigned char nKeyboardType, unsigned long bShouldValidate, unsigned long bRouteThroughConsole, FString const& sDefaultText, int nMaxResultLength )
 {
-	static UFunction* pFnShowKeyboardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowKeyboardUIRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowKeyboardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowKeyboardUI )
-		pFnShowKeyboardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowKeyboardUI" );
+	UFunction* const pFnShowKeyboardUI = pFnShowKeyboardUIRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execShowKeyboardUI_Parms ShowKeyboardUI_Parms;
 	ShowKeyboardUI_Parms.byLocalUserNum = byLocalUserNum;
@@ -2743,11 +2274,8 @@ bool UISFXOnlineComponentPlatform::ShowKeyboardUI ( unsigned char byLocalUserNum
 	memcpy ( &ShowKeyboardUI_Parms.sDefaultText, &sDefaultText, 0x10 );
 	ShowKeyboardUI_Parms.nMaxResultLength = nMaxResultLength;
 
-	pFnShowKeyboardUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowKeyboardUI, &ShowKeyboardUI_Parms, NULL );
-
-	pFnShowKeyboardUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowKeyboardUI, &ShowKeyboardUI_Parms ) )
+		this->ProcessEvent ( pFnShowKeyboardUI, &ShowKeyboardUI_Parms, NULL );
 
 	return ShowKeyboardUI_Parms.ReturnValue;
 };
@@ -2760,19 +2288,15 @@ bool UISFXOnlineComponentPlatform::ShowKeyboardUI ( unsigned char byLocalUserNum
 
 bool UISFXOnlineComponentPlatform::ShowAchievementsUI ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnShowAchievementsUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowAchievementsUIRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowAchievementsUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowAchievementsUI )
-		pFnShowAchievementsUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowAchievementsUI" );
+	UFunction* const pFnShowAchievementsUI = pFnShowAchievementsUIRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execShowAchievementsUI_Parms ShowAchievementsUI_Parms;
 	ShowAchievementsUI_Parms.byLocalUserNum = byLocalUserNum;
 
-	pFnShowAchievementsUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowAchievementsUI, &ShowAchievementsUI_Parms, NULL );
-
-	pFnShowAchievementsUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowAchievementsUI, &ShowAchievementsUI_Parms ) )
+		this->ProcessEvent ( pFnShowAchievementsUI, &ShowAchievementsUI_Parms, NULL );
 
 	return ShowAchievementsUI_Parms.ReturnValue;
 };
@@ -2786,20 +2310,16 @@ bool UISFXOnlineComponentPlatform::ShowAchievementsUI ( unsigned char byLocalUse
 
 bool UISFXOnlineComponentPlatform::ShowFeedbackUI ( unsigned char byLocalUserNum, struct FUniqueNetId const& oPlayerId )
 {
-	static UFunction* pFnShowFeedbackUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFeedbackUIRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowFeedbackUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFeedbackUI )
-		pFnShowFeedbackUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowFeedbackUI" );
+	UFunction* const pFnShowFeedbackUI = pFnShowFeedbackUIRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execShowFeedbackUI_Parms ShowFeedbackUI_Parms;
 	ShowFeedbackUI_Parms.byLocalUserNum = byLocalUserNum;
 	memcpy ( &ShowFeedbackUI_Parms.oPlayerId, &oPlayerId, 0x8 );
 
-	pFnShowFeedbackUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFeedbackUI, &ShowFeedbackUI_Parms, NULL );
-
-	pFnShowFeedbackUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFeedbackUI, &ShowFeedbackUI_Parms ) )
+		this->ProcessEvent ( pFnShowFeedbackUI, &ShowFeedbackUI_Parms, NULL );
 
 	return ShowFeedbackUI_Parms.ReturnValue;
 };
@@ -2813,20 +2333,16 @@ bool UISFXOnlineComponentPlatform::ShowFeedbackUI ( unsigned char byLocalUserNum
 
 bool UISFXOnlineComponentPlatform::ShowGamerCardUI ( unsigned char byLocalUserNum, struct FUniqueNetId const& oPlayerId )
 {
-	static UFunction* pFnShowGamerCardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowGamerCardUIRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowGamerCardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowGamerCardUI )
-		pFnShowGamerCardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowGamerCardUI" );
+	UFunction* const pFnShowGamerCardUI = pFnShowGamerCardUIRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execShowGamerCardUI_Parms ShowGamerCardUI_Parms;
 	ShowGamerCardUI_Parms.byLocalUserNum = byLocalUserNum;
 	memcpy ( &ShowGamerCardUI_Parms.oPlayerId, &oPlayerId, 0x8 );
 
-	pFnShowGamerCardUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowGamerCardUI, &ShowGamerCardUI_Parms, NULL );
-
-	pFnShowGamerCardUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowGamerCardUI, &ShowGamerCardUI_Parms ) )
+		this->ProcessEvent ( pFnShowGamerCardUI, &ShowGamerCardUI_Parms, NULL );
 
 	return ShowGamerCardUI_Parms.ReturnValue;
 };
@@ -2840,20 +2356,16 @@ bool UISFXOnlineComponentPlatform::ShowGamerCardUI ( unsigned char byLocalUserNu
 
 bool UISFXOnlineComponentPlatform::ShowFriendsInviteUI ( unsigned char byLocalUserNum, struct FUniqueNetId const& oPlayerId )
 {
-	static UFunction* pFnShowFriendsInviteUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFriendsInviteUIRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowFriendsInviteUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFriendsInviteUI )
-		pFnShowFriendsInviteUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowFriendsInviteUI" );
+	UFunction* const pFnShowFriendsInviteUI = pFnShowFriendsInviteUIRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execShowFriendsInviteUI_Parms ShowFriendsInviteUI_Parms;
 	ShowFriendsInviteUI_Parms.byLocalUserNum = byLocalUserNum;
 	memcpy ( &ShowFriendsInviteUI_Parms.oPlayerId, &oPlayerId, 0x8 );
 
-	pFnShowFriendsInviteUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms, NULL );
-
-	pFnShowFriendsInviteUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms ) )
+		this->ProcessEvent ( pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms, NULL );
 
 	return ShowFriendsInviteUI_Parms.ReturnValue;
 };
@@ -2866,19 +2378,15 @@ bool UISFXOnlineComponentPlatform::ShowFriendsInviteUI ( unsigned char byLocalUs
 
 bool UISFXOnlineComponentPlatform::ShowFriendsUI ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnShowFriendsUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFriendsUIRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowFriendsUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFriendsUI )
-		pFnShowFriendsUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowFriendsUI" );
+	UFunction* const pFnShowFriendsUI = pFnShowFriendsUIRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execShowFriendsUI_Parms ShowFriendsUI_Parms;
 	ShowFriendsUI_Parms.byLocalUserNum = byLocalUserNum;
 
-	pFnShowFriendsUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFriendsUI, &ShowFriendsUI_Parms, NULL );
-
-	pFnShowFriendsUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFriendsUI, &ShowFriendsUI_Parms ) )
+		this->ProcessEvent ( pFnShowFriendsUI, &ShowFriendsUI_Parms, NULL );
 
 	return ShowFriendsUI_Parms.ReturnValue;
 };
@@ -2891,19 +2399,15 @@ bool UISFXOnlineComponentPlatform::ShowFriendsUI ( unsigned char byLocalUserNum
 
 unsigned char UISFXOnlineComponentPlatform::CanShowPresenceInformation ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanShowPresenceInformationRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanShowPresenceInformation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanShowPresenceInformation" );
+	UFunction* const pFnCanShowPresenceInformation = pFnCanShowPresenceInformationRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.byLocalUserNum = byLocalUserNum;
 
-	pFnCanShowPresenceInformation->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
-
-	pFnCanShowPresenceInformation->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms ) )
+		this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
 
 	return CanShowPresenceInformation_Parms.ReturnValue;
 };
@@ -2916,19 +2420,15 @@ unsigned char UISFXOnlineComponentPlatform::CanShowPresenceInformation ( unsigne
 
 unsigned char UISFXOnlineComponentPlatform::CanViewPlayerProfiles ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanViewPlayerProfilesRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanViewPlayerProfiles", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanViewPlayerProfiles" );
+	UFunction* const pFnCanViewPlayerProfiles = pFnCanViewPlayerProfilesRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.byLocalUserNum = byLocalUserNum;
 
-	pFnCanViewPlayerProfiles->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
-
-	pFnCanViewPlayerProfiles->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms ) )
+		this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
 
 	return CanViewPlayerProfiles_Parms.ReturnValue;
 };
@@ -2941,19 +2441,15 @@ unsigned char UISFXOnlineComponentPlatform::CanViewPlayerProfiles ( unsigned cha
 
 unsigned char UISFXOnlineComponentPlatform::CanPurchaseContent ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPurchaseContentRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanPurchaseContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanPurchaseContent" );
+	UFunction* const pFnCanPurchaseContent = pFnCanPurchaseContentRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.byLocalUserNum = byLocalUserNum;
 
-	pFnCanPurchaseContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
-
-	pFnCanPurchaseContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPurchaseContent, &CanPurchaseContent_Parms ) )
+		this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
 
 	return CanPurchaseContent_Parms.ReturnValue;
 };
@@ -2966,19 +2462,15 @@ unsigned char UISFXOnlineComponentPlatform::CanPurchaseContent ( unsigned char b
 
 unsigned char UISFXOnlineComponentPlatform::CanDownloadUserContent ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanDownloadUserContentRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanDownloadUserContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanDownloadUserContent" );
+	UFunction* const pFnCanDownloadUserContent = pFnCanDownloadUserContentRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.byLocalUserNum = byLocalUserNum;
 
-	pFnCanDownloadUserContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
-
-	pFnCanDownloadUserContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanDownloadUserContent, &CanDownloadUserContent_Parms ) )
+		this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
 
 	return CanDownloadUserContent_Parms.ReturnValue;
 };
@@ -2991,19 +2483,15 @@ unsigned char UISFXOnlineComponentPlatform::CanDownloadUserContent ( unsigned ch
 
 unsigned char UISFXOnlineComponentPlatform::CanCommunicate ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnCanCommunicate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanCommunicateRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanCommunicate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanCommunicate" );
+	UFunction* const pFnCanCommunicate = pFnCanCommunicateRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.byLocalUserNum = byLocalUserNum;
 
-	pFnCanCommunicate->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
-
-	pFnCanCommunicate->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanCommunicate, &CanCommunicate_Parms ) )
+		this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
 
 	return CanCommunicate_Parms.ReturnValue;
 };
@@ -3016,19 +2504,15 @@ unsigned char UISFXOnlineComponentPlatform::CanCommunicate ( unsigned char byLoc
 
 unsigned char UISFXOnlineComponentPlatform::CanPlayOnline ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPlayOnlineRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanPlayOnline", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanPlayOnline" );
+	UFunction* const pFnCanPlayOnline = pFnCanPlayOnlineRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.byLocalUserNum = byLocalUserNum;
 
-	pFnCanPlayOnline->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
-
-	pFnCanPlayOnline->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPlayOnline, &CanPlayOnline_Parms ) )
+		this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
 
 	return CanPlayOnline_Parms.ReturnValue;
 };
@@ -3043,10 +2527,9 @@ unsigned char UISFXOnlineComponentPlatform::CanPlayOnline ( unsigned char byLoca
 
 void UISFXOnlineComponentPlatform::SetRichPresence ( unsigned char byLocalUserNum, int nPresenceMode, TArray<struct FLocalizedStringSetting>* aLocalizedStringSettings, TArray<struct FSettingsProperty>* aProperties )
 {
-	static UFunction* pFnSetRichPresence = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetRichPresenceRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.SetRichPresence", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetRichPresence )
-		pFnSetRichPresence = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.SetRichPresence" );
+	UFunction* const pFnSetRichPresence = pFnSetRichPresenceRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execSetRichPresence_Parms SetRichPresence_Parms;
 	SetRichPresence_Parms.byLocalUserNum = byLocalUserNum;
@@ -3058,11 +2541,8 @@ void UISFXOnlineComponentPlatform::SetRichPresence ( unsigned char byLocalUserNu
 	if ( aProperties )
 		memcpy ( &SetRichPresence_Parms.aProperties, aProperties, 0x10 );
 
-	pFnSetRichPresence->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetRichPresence, &SetRichPresence_Parms, NULL );
-
-	pFnSetRichPresence->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetRichPresence, &SetRichPresence_Parms ) )
+		this->ProcessEvent ( pFnSetRichPresence, &SetRichPresence_Parms, NULL );
 
 	if ( aLocalizedStringSettings )
 		memcpy ( aLocalizedStringSettings, &SetRichPresence_Parms.aLocalizedStringSettings, 0x10 );
@@ -3079,19 +2559,15 @@ void UISFXOnlineComponentPlatform::SetRichPresence ( unsigned char byLocalUserNu
 
 bool UISFXOnlineComponentPlatform::ShowLoginUI ( unsigned long bShowOnlineOnly )
 {
-	static UFunction* pFnShowLoginUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowLoginUIRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowLoginUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowLoginUI )
-		pFnShowLoginUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowLoginUI" );
+	UFunction* const pFnShowLoginUI = pFnShowLoginUIRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execShowLoginUI_Parms ShowLoginUI_Parms;
 	ShowLoginUI_Parms.bShowOnlineOnly = bShowOnlineOnly;
 
-	pFnShowLoginUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowLoginUI, &ShowLoginUI_Parms, NULL );
-
-	pFnShowLoginUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowLoginUI, &ShowLoginUI_Parms ) )
+		this->ProcessEvent ( pFnShowLoginUI, &ShowLoginUI_Parms, NULL );
 
 	return ShowLoginUI_Parms.ReturnValue;
 };
@@ -3104,33 +2580,26 @@ bool UISFXOnlineComponentPlatform::ShowLoginUI ( unsigned long bShowOnlineOnly )
 
 unsigned char UISFXOnlineComponentPlatform::GetLoginStatus ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLoginStatusRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.GetLoginStatus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.GetLoginStatus" );
+	UFunction* const pFnGetLoginStatus = pFnGetLoginStatusRef.Get ( );
 
 	UISFXOnlineComponentPlatform_execGetLoginStatus_Parms GetLoginStatus_Parms;
 	GetLoginStatus_Parms.byLocalUserNum = byLocalUserNum;
 
-	pFnGetLoginStatus->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetLoginStatus, &GetLoginStatus_Parms, NULL );
-
-	pFnGetLoginStatus->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetLoginStatus, &GetLoginStatus_Parms ) )
+		this->ProcessEvent ( pFnGetLoginStatus, &GetLoginStatus_Parms, NULL );
 
 	return GetLoginStatus_Parms.ReturnValue;
 };
 
 
 
-class UClass* UISFXOnlineComponentTelemetry::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UISFXOnlineComponentTelemetry::pClassPointer { L"Class SFXOnlineFoundation.ISFXOnlineComponentTelemetry", &UObject::FindClass };
 
 class UClass* UISFXOnlineComponentTelemetry::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.ISFXOnlineComponentTelemetry" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.Flush
@@ -3140,19 +2609,15 @@ class UClass* UISFXOnlineComponentTelemetry::StaticClass()
 
 void UISFXOnlineComponentTelemetry::Flush ( unsigned char Channel )
 {
-	static UFunction* pFnFlush = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFlushRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.Flush", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFlush )
-		pFnFlush = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.Flush" );
+	UFunction* const pFnFlush = pFnFlushRef.Get ( );
 
 	UISFXOnlineComponentTelemetry_execFlush_Parms Flush_Parms;
 	Flush_Parms.Channel = Channel;
 
-	pFnFlush->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFlush, &Flush_Parms, NULL );
-
-	pFnFlush->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFlush, &Flush_Parms ) )
+		this->ProcessEvent ( pFnFlush, &Flush_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.RegisterConnectionDelegates
@@ -3161,10 +2626,9 @@ void UISFXOnlineComponentTelemetry::Flush ( unsigned char Channel )
 
 void UISFXOnlineComponentTelemetry::RegisterConnectionDelegates ( )
 {
-	static UFunction* pFnRegisterConnectionDelegates = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRegisterConnectionDelegatesRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.RegisterConnectionDelegates", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRegisterConnectionDelegates )
-		pFnRegisterConnectionDelegates = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.RegisterConnectionDelegates" );
+	UFunction* const pFnRegisterConnectionDelegates = pFnRegisterConnectionDelegatesRef.Get ( );
 
 	UISFXOnlineComponentTelemetry_execRegisterConnectionDelegates_Parms RegisterConnectionDelegates_Parms;
 
@@ -3179,10 +2643,9 @@ void UISFXOnlineComponentTelemetry::RegisterConnectionDelegates ( )
 
 void UISFXOnlineComponentTelemetry::OnDisconnect ( int Error, FString const& SessionId )
 {
-	static UFunction* pFnOnDisconnect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnDisconnectRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.OnDisconnect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnDisconnect )
-		pFnOnDisconnect = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.OnDisconnect" );
+	UFunction* const pFnOnDisconnect = pFnOnDisconnectRef.Get ( );
 
 	UISFXOnlineComponentTelemetry_execOnDisconnect_Parms OnDisconnect_Parms;
 	OnDisconnect_Parms.Error = Error;
@@ -3197,10 +2660,9 @@ void UISFXOnlineComponentTelemetry::OnDisconnect ( int Error, FString const& Ses
 
 void UISFXOnlineComponentTelemetry::OnAuthenticate ( )
 {
-	static UFunction* pFnOnAuthenticate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAuthenticateRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.OnAuthenticate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnAuthenticate )
-		pFnOnAuthenticate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.OnAuthenticate" );
+	UFunction* const pFnOnAuthenticate = pFnOnAuthenticateRef.Get ( );
 
 	UISFXOnlineComponentTelemetry_execOnAuthenticate_Parms OnAuthenticate_Parms;
 
@@ -3214,10 +2676,9 @@ void UISFXOnlineComponentTelemetry::OnAuthenticate ( )
 
 bool UISFXOnlineComponentTelemetry::CanCollect ( )
 {
-	static UFunction* pFnCanCollect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanCollectRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.CanCollect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanCollect )
-		pFnCanCollect = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.CanCollect" );
+	UFunction* const pFnCanCollect = pFnCanCollectRef.Get ( );
 
 	UISFXOnlineComponentTelemetry_execCanCollect_Parms CanCollect_Parms;
 
@@ -3228,14 +2689,11 @@ bool UISFXOnlineComponentTelemetry::CanCollect ( )
 
 
 
-class UClass* UISFXOnlineComponentUserInterface::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UISFXOnlineComponentUserInterface::pClassPointer { L"Class SFXOnlineFoundation.ISFXOnlineComponentUserInterface", &UObject::FindClass };
 
 class UClass* UISFXOnlineComponentUserInterface::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.ISFXOnlineComponentUserInterface" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowStore
@@ -3245,10 +2703,9 @@ class UClass* UISFXOnlineComponentUserInterface::StaticClass()
 
 void UISFXOnlineComponentUserInterface::eventShowStore ( TArray<struct FSFXOfferDescriptor> const& aOffers )
 {
-	static UFunction* pFnShowStore = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowStoreRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowStore", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowStore )
-		pFnShowStore = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowStore" );
+	UFunction* const pFnShowStore = pFnShowStoreRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_eventShowStore_Parms ShowStore_Parms;
 	memcpy ( &ShowStore_Parms.aOffers, &aOffers, 0x10 );
@@ -3263,10 +2720,9 @@ void UISFXOnlineComponentUserInterface::eventShowStore ( TArray<struct FSFXOffer
 
 void UISFXOnlineComponentUserInterface::eventHasCerberusDLC ( unsigned long bVal )
 {
-	static UFunction* pFnHasCerberusDLC = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHasCerberusDLCRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.HasCerberusDLC", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHasCerberusDLC )
-		pFnHasCerberusDLC = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.HasCerberusDLC" );
+	UFunction* const pFnHasCerberusDLC = pFnHasCerberusDLCRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_eventHasCerberusDLC_Parms HasCerberusDLC_Parms;
 	HasCerberusDLC_Parms.bVal = bVal;
@@ -3284,10 +2740,9 @@ void UISFXOnlineComponentUserInterface::eventHasCerberusDLC ( unsigned long bVal
 
 void UISFXOnlineComponentUserInterface::eventOnDisplayNotification ( unsigned char Type, FString const& MessageData, FString const& Title, FString const& Image )
 {
-	static UFunction* pFnOnDisplayNotification = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnDisplayNotificationRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.OnDisplayNotification", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnDisplayNotification )
-		pFnOnDisplayNotification = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.OnDisplayNotification" );
+	UFunction* const pFnOnDisplayNotification = pFnOnDisplayNotificationRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_eventOnDisplayNotification_Parms OnDisplayNotification_Parms;
 	OnDisplayNotification_Parms.Type = Type;
@@ -3304,10 +2759,9 @@ void UISFXOnlineComponentUserInterface::eventOnDisplayNotification ( unsigned ch
 
 void UISFXOnlineComponentUserInterface::eventClearNotifications ( )
 {
-	static UFunction* pFnClearNotifications = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearNotificationsRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ClearNotifications", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearNotifications )
-		pFnClearNotifications = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ClearNotifications" );
+	UFunction* const pFnClearNotifications = pFnClearNotificationsRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_eventClearNotifications_Parms ClearNotifications_Parms;
 
@@ -3320,10 +2774,9 @@ void UISFXOnlineComponentUserInterface::eventClearNotifications ( )
 
 void UISFXOnlineComponentUserInterface::eventCloseEANetworking ( )
 {
-	static UFunction* pFnCloseEANetworking = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCloseEANetworkingRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.CloseEANetworking", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCloseEANetworking )
-		pFnCloseEANetworking = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.CloseEANetworking" );
+	UFunction* const pFnCloseEANetworking = pFnCloseEANetworkingRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_eventCloseEANetworking_Parms CloseEANetworking_Parms;
 
@@ -3337,10 +2790,9 @@ void UISFXOnlineComponentUserInterface::eventCloseEANetworking ( )
 
 void UISFXOnlineComponentUserInterface::eventSetState ( unsigned char eState )
 {
-	static UFunction* pFnSetState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetStateRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.SetState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetState )
-		pFnSetState = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.SetState" );
+	UFunction* const pFnSetState = pFnSetStateRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_eventSetState_Parms SetState_Parms;
 	SetState_Parms.eState = eState;
@@ -3356,20 +2808,16 @@ void UISFXOnlineComponentUserInterface::eventSetState ( unsigned char eState )
 
 void UISFXOnlineComponentUserInterface::ShowEmailPasswordMismatch ( FString const& Email, FString const& Password )
 {
-	static UFunction* pFnShowEmailPasswordMismatch = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowEmailPasswordMismatchRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowEmailPasswordMismatch", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowEmailPasswordMismatch )
-		pFnShowEmailPasswordMismatch = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowEmailPasswordMismatch" );
+	UFunction* const pFnShowEmailPasswordMismatch = pFnShowEmailPasswordMismatchRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_execShowEmailPasswordMismatch_Parms ShowEmailPasswordMismatch_Parms;
 	memcpy ( &ShowEmailPasswordMismatch_Parms.Email, &Email, 0x10 );
 	memcpy ( &ShowEmailPasswordMismatch_Parms.Password, &Password, 0x10 );
 
-	pFnShowEmailPasswordMismatch->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowEmailPasswordMismatch, &ShowEmailPasswordMismatch_Parms, NULL );
-
-	pFnShowEmailPasswordMismatch->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowEmailPasswordMismatch, &ShowEmailPasswordMismatch_Parms ) )
+		this->ProcessEvent ( pFnShowEmailPasswordMismatch, &ShowEmailPasswordMismatch_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowMessageBoxWait
@@ -3381,21 +2829,17 @@ void UISFXOnlineComponentUserInterface::ShowEmailPasswordMismatch ( FString cons
 
 void UISFXOnlineComponentUserInterface::ShowMessageBoxWait ( int srMessage, int srButton1Text, int srButton2Text )
 {
-	static UFunction* pFnShowMessageBoxWait = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowMessageBoxWaitRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowMessageBoxWait", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowMessageBoxWait )
-		pFnShowMessageBoxWait = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowMessageBoxWait" );
+	UFunction* const pFnShowMessageBoxWait = pFnShowMessageBoxWaitRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_execShowMessageBoxWait_Parms ShowMessageBoxWait_Parms;
 	ShowMessageBoxWait_Parms.srMessage = srMessage;
 	ShowMessageBoxWait_Parms.srButton1Text = srButton1Text;
 	ShowMessageBoxWait_Parms.srButton2Text = srButton2Text;
 
-	pFnShowMessageBoxWait->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowMessageBoxWait, &ShowMessageBoxWait_Parms, NULL );
-
-	pFnShowMessageBoxWait->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowMessageBoxWait, &ShowMessageBoxWait_Parms ) )
+		this->ProcessEvent ( pFnShowMessageBoxWait, &ShowMessageBoxWait_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowMessageBox
@@ -3409,10 +2853,9 @@ void UISFXOnlineComponentUserInterface::ShowMessageBoxWait ( int srMessage, int
 
 void UISFXOnlineComponentUserInterface::ShowMessageBox ( FString const& sTitle, FString const& sMessage, FString const& sButton1Text, FString const& sButton2Text, FString const& sButton3Text )
 {
-	static UFunction* pFnShowMessageBox = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowMessageBoxRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowMessageBox", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowMessageBox )
-		pFnShowMessageBox = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowMessageBox" );
+	UFunction* const pFnShowMessageBox = pFnShowMessageBoxRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_execShowMessageBox_Parms ShowMessageBox_Parms;
 	memcpy ( &ShowMessageBox_Parms.sTitle, &sTitle, 0x10 );
@@ -3421,11 +2864,8 @@ void UISFXOnlineComponentUserInterface::ShowMessageBox ( FString const& sTitle,
 	memcpy ( &ShowMessageBox_Parms.sButton2Text, &sButton2Text, 0x10 );
 	memcpy ( &ShowMessageBox_Parms.sButton3Text, &sButton3Text, 0x10 );
 
-	pFnShowMessageBox->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowMessageBox, &ShowMessageBox_Parms, NULL );
-
-	pFnShowMessageBox->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowMessageBox, &ShowMessageBox_Parms ) )
+		this->ProcessEvent ( pFnShowMessageBox, &ShowMessageBox_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCreateNucleusAccountEx
@@ -3446,10 +2886,9 @@ void UISFXOnlineComponentUserInterface::ShowMessageBox ( FString const& sTitle,
 
 void UISFXOnlineComponentUserInterface::ShowCreateNucleusAccountEx ( FString const& sEmail, FString const& sPassword, unsigned long bEAProducts, unsigned long bThirdParty, unsigned long bBioWareProducts, FString const& i_sCountryCode, int BirthDay, int BirthMonth, int BirthYear, FString const& i_sLanguageCode, TArray<FString> const& m_CountryCodeList, TArray<FString> const& m_CountryDisplayList )
 {
-	static UFunction* pFnShowCreateNucleusAccountEx = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowCreateNucleusAccountExRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCreateNucleusAccountEx", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowCreateNucleusAccountEx )
-		pFnShowCreateNucleusAccountEx = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCreateNucleusAccountEx" );
+	UFunction* const pFnShowCreateNucleusAccountEx = pFnShowCreateNucleusAccountExRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_execShowCreateNucleusAccountEx_Parms ShowCreateNucleusAccountEx_Parms;
 	memcpy ( &ShowCreateNucleusAccountEx_Parms.sEmail, &sEmail, 0x10 );
@@ -3465,11 +2904,8 @@ void UISFXOnlineComponentUserInterface::ShowCreateNucleusAccountEx ( FString con
 	memcpy ( &ShowCreateNucleusAccountEx_Parms.m_CountryCodeList, &m_CountryCodeList, 0x10 );
 	memcpy ( &ShowCreateNucleusAccountEx_Parms.m_CountryDisplayList, &m_CountryDisplayList, 0x10 );
 
-	pFnShowCreateNucleusAccountEx->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowCreateNucleusAccountEx, &ShowCreateNucleusAccountEx_Parms, NULL );
-
-	pFnShowCreateNucleusAccountEx->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowCreateNucleusAccountEx, &ShowCreateNucleusAccountEx_Parms ) )
+		this->ProcessEvent ( pFnShowCreateNucleusAccountEx, &ShowCreateNucleusAccountEx_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCerberusWelcomeMessage
@@ -3478,18 +2914,14 @@ void UISFXOnlineComponentUserInterface::ShowCreateNucleusAccountEx ( FString con
 
 void UISFXOnlineComponentUserInterface::ShowCerberusWelcomeMessage ( )
 {
-	static UFunction* pFnShowCerberusWelcomeMessage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowCerberusWelcomeMessageRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCerberusWelcomeMessage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowCerberusWelcomeMessage )
-		pFnShowCerberusWelcomeMessage = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCerberusWelcomeMessage" );
+	UFunction* const pFnShowCerberusWelcomeMessage = pFnShowCerberusWelcomeMessageRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_execShowCerberusWelcomeMessage_Parms ShowCerberusWelcomeMessage_Parms;
 
-	pFnShowCerberusWelcomeMessage->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowCerberusWelcomeMessage, &ShowCerberusWelcomeMessage_Parms, NULL );
-
-	pFnShowCerberusWelcomeMessage->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowCerberusWelcomeMessage, &ShowCerberusWelcomeMessage_Parms ) )
+		this->ProcessEvent ( pFnShowCerberusWelcomeMessage, &ShowCerberusWelcomeMessage_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowRedeemCode
@@ -3498,18 +2930,14 @@ void UISFXOnlineComponentUserInterface::ShowCerberusWelcomeMessage ( )
 
 void UISFXOnlineComponentUserInterface::ShowRedeemCode ( )
 {
-	static UFunction* pFnShowRedeemCode = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowRedeemCodeRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowRedeemCode", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowRedeemCode )
-		pFnShowRedeemCode = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowRedeemCode" );
+	UFunction* const pFnShowRedeemCode = pFnShowRedeemCodeRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_execShowRedeemCode_Parms ShowRedeemCode_Parms;
 
-	pFnShowRedeemCode->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowRedeemCode, &ShowRedeemCode_Parms, NULL );
-
-	pFnShowRedeemCode->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowRedeemCode, &ShowRedeemCode_Parms ) )
+		this->ProcessEvent ( pFnShowRedeemCode, &ShowRedeemCode_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCerberusIntro
@@ -3518,18 +2946,14 @@ void UISFXOnlineComponentUserInterface::ShowRedeemCode ( )
 
 void UISFXOnlineComponentUserInterface::ShowCerberusIntro ( )
 {
-	static UFunction* pFnShowCerberusIntro = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowCerberusIntroRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCerberusIntro", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowCerberusIntro )
-		pFnShowCerberusIntro = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCerberusIntro" );
+	UFunction* const pFnShowCerberusIntro = pFnShowCerberusIntroRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_execShowCerberusIntro_Parms ShowCerberusIntro_Parms;
 
-	pFnShowCerberusIntro->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowCerberusIntro, &ShowCerberusIntro_Parms, NULL );
-
-	pFnShowCerberusIntro->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowCerberusIntro, &ShowCerberusIntro_Parms ) )
+		this->ProcessEvent ( pFnShowCerberusIntro, &ShowCerberusIntro_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowNucleusWelcomeMessage
@@ -3538,18 +2962,14 @@ void UISFXOnlineComponentUserInterface::ShowCerberusIntro ( )
 
 void UISFXOnlineComponentUserInterface::ShowNucleusWelcomeMessage ( )
 {
-	static UFunction* pFnShowNucleusWelcomeMessage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowNucleusWelcomeMessageRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowNucleusWelcomeMessage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowNucleusWelcomeMessage )
-		pFnShowNucleusWelcomeMessage = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowNucleusWelcomeMessage" );
+	UFunction* const pFnShowNucleusWelcomeMessage = pFnShowNucleusWelcomeMessageRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_execShowNucleusWelcomeMessage_Parms ShowNucleusWelcomeMessage_Parms;
 
-	pFnShowNucleusWelcomeMessage->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowNucleusWelcomeMessage, &ShowNucleusWelcomeMessage_Parms, NULL );
-
-	pFnShowNucleusWelcomeMessage->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowNucleusWelcomeMessage, &ShowNucleusWelcomeMessage_Parms ) )
+		this->ProcessEvent ( pFnShowNucleusWelcomeMessage, &ShowNucleusWelcomeMessage_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCreateNucleusAccount
@@ -3565,10 +2985,9 @@ void UISFXOnlineComponentUserInterface::ShowNucleusWelcomeMessage ( )
 
 void UISFXOnlineComponentUserInterface::ShowCreateNucleusAccount ( FString const& sEmail, FString const& sPassword, unsigned long bEAProducts, unsigned long bThirdParty, unsigned long bRegisterProduct, unsigned long bBioWareProducts, unsigned long bUnderage )
 {
-	static UFunction* pFnShowCreateNucleusAccount = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowCreateNucleusAccountRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCreateNucleusAccount", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowCreateNucleusAccount )
-		pFnShowCreateNucleusAccount = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCreateNucleusAccount" );
+	UFunction* const pFnShowCreateNucleusAccount = pFnShowCreateNucleusAccountRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_execShowCreateNucleusAccount_Parms ShowCreateNucleusAccount_Parms;
 	memcpy ( &ShowCreateNucleusAccount_Parms.sEmail, &sEmail, 0x10 );
@@ -3579,11 +2998,8 @@ void UISFXOnlineComponentUserInterface::ShowCreateNucleusAccount ( FString const
 	ShowCreateNucleusAccount_Parms.bBioWareProducts = bBioWareProducts;
 	ShowCreateNucleusAccount_Parms.bUnderage = bUnderage;
 
-	pFnShowCreateNucleusAccount->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowCreateNucleusAccount, &ShowCreateNucleusAccount_Parms, NULL );
-
-	pFnShowCreateNucleusAccount->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowCreateNucleusAccount, &ShowCreateNucleusAccount_Parms ) )
+		this->ProcessEvent ( pFnShowCreateNucleusAccount, &ShowCreateNucleusAccount_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowParentEmail
@@ -3592,18 +3008,14 @@ void UISFXOnlineComponentUserInterface::ShowCreateNucleusAccount ( FString const
 
 void UISFXOnlineComponentUserInterface::ShowParentEmail ( )
 {
-	static UFunction* pFnShowParentEmail = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowParentEmailRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowParentEmail", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowParentEmail )
-		pFnShowParentEmail = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowParentEmail" );
+	UFunction* const pFnShowParentEmail = pFnShowParentEmailRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_execShowParentEmail_Parms ShowParentEmail_Parms;
 
-	pFnShowParentEmail->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowParentEmail, &ShowParentEmail_Parms, NULL );
-
-	pFnShowParentEmail->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowParentEmail, &ShowParentEmail_Parms ) )
+		this->ProcessEvent ( pFnShowParentEmail, &ShowParentEmail_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowAccountDemographics
@@ -3614,20 +3026,16 @@ void UISFXOnlineComponentUserInterface::ShowParentEmail ( )
 
 void UISFXOnlineComponentUserInterface::ShowAccountDemographics ( TArray<FString> const& m_CountryCodeList, TArray<FString> const& m_CountryDisplayList )
 {
-	static UFunction* pFnShowAccountDemographics = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowAccountDemographicsRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowAccountDemographics", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowAccountDemographics )
-		pFnShowAccountDemographics = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowAccountDemographics" );
+	UFunction* const pFnShowAccountDemographics = pFnShowAccountDemographicsRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_execShowAccountDemographics_Parms ShowAccountDemographics_Parms;
 	memcpy ( &ShowAccountDemographics_Parms.m_CountryCodeList, &m_CountryCodeList, 0x10 );
 	memcpy ( &ShowAccountDemographics_Parms.m_CountryDisplayList, &m_CountryDisplayList, 0x10 );
 
-	pFnShowAccountDemographics->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowAccountDemographics, &ShowAccountDemographics_Parms, NULL );
-
-	pFnShowAccountDemographics->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowAccountDemographics, &ShowAccountDemographics_Parms ) )
+		this->ProcessEvent ( pFnShowAccountDemographics, &ShowAccountDemographics_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowTermsOfService
@@ -3638,20 +3046,16 @@ void UISFXOnlineComponentUserInterface::ShowAccountDemographics ( TArray<FString
 
 void UISFXOnlineComponentUserInterface::ShowTermsOfService ( FString const& i_sTermsOfService, unsigned long bTOSChanged )
 {
-	static UFunction* pFnShowTermsOfService = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowTermsOfServiceRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowTermsOfService", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowTermsOfService )
-		pFnShowTermsOfService = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowTermsOfService" );
+	UFunction* const pFnShowTermsOfService = pFnShowTermsOfServiceRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_execShowTermsOfService_Parms ShowTermsOfService_Parms;
 	memcpy ( &ShowTermsOfService_Parms.i_sTermsOfService, &i_sTermsOfService, 0x10 );
 	ShowTermsOfService_Parms.bTOSChanged = bTOSChanged;
 
-	pFnShowTermsOfService->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowTermsOfService, &ShowTermsOfService_Parms, NULL );
-
-	pFnShowTermsOfService->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowTermsOfService, &ShowTermsOfService_Parms ) )
+		this->ProcessEvent ( pFnShowTermsOfService, &ShowTermsOfService_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowNucleusLogin
@@ -3663,21 +3067,17 @@ void UISFXOnlineComponentUserInterface::ShowTermsOfService ( FString const& i_sT
 
 void UISFXOnlineComponentUserInterface::ShowNucleusLogin ( FString const& Email, FString const& Password, int eScreenState )
 {
-	static UFunction* pFnShowNucleusLogin = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowNucleusLoginRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowNucleusLogin", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowNucleusLogin )
-		pFnShowNucleusLogin = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowNucleusLogin" );
+	UFunction* const pFnShowNucleusLogin = pFnShowNucleusLoginRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_execShowNucleusLogin_Parms ShowNucleusLogin_Parms;
 	memcpy ( &ShowNucleusLogin_Parms.Email, &Email, 0x10 );
 	memcpy ( &ShowNucleusLogin_Parms.Password, &Password, 0x10 );
 	ShowNucleusLogin_Parms.eScreenState = eScreenState;
 
-	pFnShowNucleusLogin->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowNucleusLogin, &ShowNucleusLogin_Parms, NULL );
-
-	pFnShowNucleusLogin->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowNucleusLogin, &ShowNucleusLogin_Parms ) )
+		this->ProcessEvent ( pFnShowNucleusLogin, &ShowNucleusLogin_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowIntroPage
@@ -3686,42 +3086,32 @@ void UISFXOnlineComponentUserInterface::ShowNucleusLogin ( FString const& Email,
 
 void UISFXOnlineComponentUserInterface::ShowIntroPage ( )
 {
-	static UFunction* pFnShowIntroPage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowIntroPageRef { L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowIntroPage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowIntroPage )
-		pFnShowIntroPage = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowIntroPage" );
+	UFunction* const pFnShowIntroPage = pFnShowIntroPageRef.Get ( );
 
 	UISFXOnlineComponentUserInterface_execShowIntroPage_Parms ShowIntroPage_Parms;
 
-	pFnShowIntroPage->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowIntroPage, &ShowIntroPage_Parms, NULL );
-
-	pFnShowIntroPage->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowIntroPage, &ShowIntroPage_Parms ) )
+		this->ProcessEvent ( pFnShowIntroPage, &ShowIntroPage_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineDefine::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineDefine::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineDefine", &UObject::FindClass };
 
 class UClass* USFXOnlineDefine::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineDefine" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXOnlineComponent::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponent::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponent", &UObject::FindClass };
 
 class UClass* USFXOnlineComponent::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponent" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.IsXbox360
@@ -3731,10 +3121,9 @@ class UClass* USFXOnlineComponent::StaticClass()
 
 bool USFXOnlineComponent::eventIsXbox360 ( )
 {
-	static UFunction* pFnIsXbox360 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsXbox360Ref { L"Function SFXOnlineFoundation.SFXOnlineComponent.IsXbox360", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsXbox360 )
-		pFnIsXbox360 = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.IsXbox360" );
+	UFunction* const pFnIsXbox360 = pFnIsXbox360Ref.Get ( );
 
 	USFXOnlineComponent_eventIsXbox360_Parms IsXbox360_Parms;
 
@@ -3750,10 +3139,9 @@ bool USFXOnlineComponent::eventIsXbox360 ( )
 
 bool USFXOnlineComponent::eventIsPS3 ( )
 {
-	static UFunction* pFnIsPS3 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsPS3Ref { L"Function SFXOnlineFoundation.SFXOnlineComponent.IsPS3", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsPS3 )
-		pFnIsPS3 = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.IsPS3" );
+	UFunction* const pFnIsPS3 = pFnIsPS3Ref.Get ( );
 
 	USFXOnlineComponent_eventIsPS3_Parms IsPS3_Parms;
 
@@ -3769,10 +3157,9 @@ bool USFXOnlineComponent::eventIsPS3 ( )
 
 bool USFXOnlineComponent::eventIsConsole ( )
 {
-	static UFunction* pFnIsConsole = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsConsoleRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.IsConsole", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsConsole )
-		pFnIsConsole = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.IsConsole" );
+	UFunction* const pFnIsConsole = pFnIsConsoleRef.Get ( );
 
 	USFXOnlineComponent_eventIsConsole_Parms IsConsole_Parms;
 
@@ -3790,20 +3177,16 @@ bool USFXOnlineComponent::eventIsConsole ( )
 
 bool USFXOnlineComponent::IsEventPending ( unsigned char eEventType, int nEventId )
 {
-	static UFunction* pFnIsEventPending = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsEventPendingRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.IsEventPending", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsEventPending )
-		pFnIsEventPending = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.IsEventPending" );
+	UFunction* const pFnIsEventPending = pFnIsEventPendingRef.Get ( );
 
 	USFXOnlineComponent_execIsEventPending_Parms IsEventPending_Parms;
 	IsEventPending_Parms.eEventType = eEventType;
 	IsEventPending_Parms.nEventId = nEventId;
 
-	pFnIsEventPending->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsEventPending, &IsEventPending_Parms, NULL );
-
-	pFnIsEventPending->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsEventPending, &IsEventPending_Parms ) )
+		this->ProcessEvent ( pFnIsEventPending, &IsEventPending_Parms, NULL );
 
 	return IsEventPending_Parms.ReturnValue;
 };
@@ -3817,20 +3200,16 @@ bool USFXOnlineComponent::IsEventPending ( unsigned char eEventType, int nEventI
 
 class USFXOnlineEvent* USFXOnlineComponent::GetEvent ( unsigned char eEventType, int nEventId )
 {
-	static UFunction* pFnGetEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEventRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.GetEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEvent )
-		pFnGetEvent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.GetEvent" );
+	UFunction* const pFnGetEvent = pFnGetEventRef.Get ( );
 
 	USFXOnlineComponent_execGetEvent_Parms GetEvent_Parms;
 	GetEvent_Parms.eEventType = eEventType;
 	GetEvent_Parms.nEventId = nEventId;
 
-	pFnGetEvent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetEvent, &GetEvent_Parms, NULL );
-
-	pFnGetEvent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetEvent, &GetEvent_Parms ) )
+		this->ProcessEvent ( pFnGetEvent, &GetEvent_Parms, NULL );
 
 	return GetEvent_Parms.ReturnValue;
 };
@@ -3843,20 +3222,16 @@ class USFXOnlineEvent* USFXOnlineComponent::GetEvent ( unsigned char eEventType,
 
 void USFXOnlineComponent::WaitingForWorkSetObject ( TArray<class USFXOnlineEvent*> const& aOnlineEventSet, struct FScriptDelegate fnWorkComplete )
 {
-	static UFunction* pFnWaitingForWorkSetObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWaitingForWorkSetObjectRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkSetObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWaitingForWorkSetObject )
-		pFnWaitingForWorkSetObject = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkSetObject" );
+	UFunction* const pFnWaitingForWorkSetObject = pFnWaitingForWorkSetObjectRef.Get ( );
 
 	USFXOnlineComponent_execWaitingForWorkSetObject_Parms WaitingForWorkSetObject_Parms;
 	memcpy ( &WaitingForWorkSetObject_Parms.aOnlineEventSet, &aOnlineEventSet, 0x10 );
 	memcpy ( &WaitingForWorkSetObject_Parms.fnWorkComplete, &fnWorkComplete, 0x10 );
 
-	pFnWaitingForWorkSetObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWaitingForWorkSetObject, &WaitingForWorkSetObject_Parms, NULL );
-
-	pFnWaitingForWorkSetObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWaitingForWorkSetObject, &WaitingForWorkSetObject_Parms ) )
+		this->ProcessEvent ( pFnWaitingForWorkSetObject, &WaitingForWorkSetObject_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkSetType
@@ -3867,20 +3242,16 @@ void USFXOnlineComponent::WaitingForWorkSetObject ( TArray<class USFXOnlineEvent
 
 void USFXOnlineComponent::WaitingForWorkSetType ( TArray<unsigned char> const& aWorkUnits, struct FScriptDelegate fnWorkComplete )
 {
-	static UFunction* pFnWaitingForWorkSetType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWaitingForWorkSetTypeRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkSetType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWaitingForWorkSetType )
-		pFnWaitingForWorkSetType = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkSetType" );
+	UFunction* const pFnWaitingForWorkSetType = pFnWaitingForWorkSetTypeRef.Get ( );
 
 	USFXOnlineComponent_execWaitingForWorkSetType_Parms WaitingForWorkSetType_Parms;
 	memcpy ( &WaitingForWorkSetType_Parms.aWorkUnits, &aWorkUnits, 0x10 );
 	memcpy ( &WaitingForWorkSetType_Parms.fnWorkComplete, &fnWorkComplete, 0x10 );
 
-	pFnWaitingForWorkSetType->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWaitingForWorkSetType, &WaitingForWorkSetType_Parms, NULL );
-
-	pFnWaitingForWorkSetType->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWaitingForWorkSetType, &WaitingForWorkSetType_Parms ) )
+		this->ProcessEvent ( pFnWaitingForWorkSetType, &WaitingForWorkSetType_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkObject
@@ -3891,20 +3262,16 @@ void USFXOnlineComponent::WaitingForWorkSetType ( TArray<unsigned char> const& a
 
 void USFXOnlineComponent::WaitingForWorkObject ( class USFXOnlineEvent* oEvent, struct FScriptDelegate fnWorkComplete )
 {
-	static UFunction* pFnWaitingForWorkObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWaitingForWorkObjectRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWaitingForWorkObject )
-		pFnWaitingForWorkObject = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkObject" );
+	UFunction* const pFnWaitingForWorkObject = pFnWaitingForWorkObjectRef.Get ( );
 
 	USFXOnlineComponent_execWaitingForWorkObject_Parms WaitingForWorkObject_Parms;
 	WaitingForWorkObject_Parms.oEvent = oEvent;
 	memcpy ( &WaitingForWorkObject_Parms.fnWorkComplete, &fnWorkComplete, 0x10 );
 
-	pFnWaitingForWorkObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWaitingForWorkObject, &WaitingForWorkObject_Parms, NULL );
-
-	pFnWaitingForWorkObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWaitingForWorkObject, &WaitingForWorkObject_Parms ) )
+		this->ProcessEvent ( pFnWaitingForWorkObject, &WaitingForWorkObject_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkType
@@ -3916,21 +3283,17 @@ void USFXOnlineComponent::WaitingForWorkObject ( class USFXOnlineEvent* oEvent,
 
 void USFXOnlineComponent::WaitingForWorkType ( unsigned char eWork, struct FScriptDelegate fnWorkComplete, int nEventId )
 {
-	static UFunction* pFnWaitingForWorkType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWaitingForWorkTypeRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWaitingForWorkType )
-		pFnWaitingForWorkType = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkType" );
+	UFunction* const pFnWaitingForWorkType = pFnWaitingForWorkTypeRef.Get ( );
 
 	USFXOnlineComponent_execWaitingForWorkType_Parms WaitingForWorkType_Parms;
 	WaitingForWorkType_Parms.eWork = eWork;
 	memcpy ( &WaitingForWorkType_Parms.fnWorkComplete, &fnWorkComplete, 0x10 );
 	WaitingForWorkType_Parms.nEventId = nEventId;
 
-	pFnWaitingForWorkType->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWaitingForWorkType, &WaitingForWorkType_Parms, NULL );
-
-	pFnWaitingForWorkType->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWaitingForWorkType, &WaitingForWorkType_Parms ) )
+		this->ProcessEvent ( pFnWaitingForWorkType, &WaitingForWorkType_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkFinishedObject
@@ -3941,20 +3304,16 @@ void USFXOnlineComponent::WaitingForWorkType ( unsigned char eWork, struct FScri
 
 void USFXOnlineComponent::NotifyWorkFinishedObject ( class USFXOnlineEvent* oEvent, unsigned char eStatusFinished )
 {
-	static UFunction* pFnNotifyWorkFinishedObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyWorkFinishedObjectRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkFinishedObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyWorkFinishedObject )
-		pFnNotifyWorkFinishedObject = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkFinishedObject" );
+	UFunction* const pFnNotifyWorkFinishedObject = pFnNotifyWorkFinishedObjectRef.Get ( );
 
 	USFXOnlineComponent_execNotifyWorkFinishedObject_Parms NotifyWorkFinishedObject_Parms;
 	NotifyWorkFinishedObject_Parms.oEvent = oEvent;
 	NotifyWorkFinishedObject_Parms.eStatusFinished = eStatusFinished;
 
-	pFnNotifyWorkFinishedObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotifyWorkFinishedObject, &NotifyWorkFinishedObject_Parms, NULL );
-
-	pFnNotifyWorkFinishedObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNotifyWorkFinishedObject, &NotifyWorkFinishedObject_Parms ) )
+		this->ProcessEvent ( pFnNotifyWorkFinishedObject, &NotifyWorkFinishedObject_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkFinishedType
@@ -3966,21 +3325,17 @@ void USFXOnlineComponent::NotifyWorkFinishedObject ( class USFXOnlineEvent* oEve
 
 void USFXOnlineComponent::NotifyWorkFinishedType ( unsigned char eWork, unsigned char eStatusFinished, int nEventId )
 {
-	static UFunction* pFnNotifyWorkFinishedType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyWorkFinishedTypeRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkFinishedType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyWorkFinishedType )
-		pFnNotifyWorkFinishedType = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkFinishedType" );
+	UFunction* const pFnNotifyWorkFinishedType = pFnNotifyWorkFinishedTypeRef.Get ( );
 
 	USFXOnlineComponent_execNotifyWorkFinishedType_Parms NotifyWorkFinishedType_Parms;
 	NotifyWorkFinishedType_Parms.eWork = eWork;
 	NotifyWorkFinishedType_Parms.eStatusFinished = eStatusFinished;
 	NotifyWorkFinishedType_Parms.nEventId = nEventId;
 
-	pFnNotifyWorkFinishedType->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotifyWorkFinishedType, &NotifyWorkFinishedType_Parms, NULL );
-
-	pFnNotifyWorkFinishedType->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNotifyWorkFinishedType, &NotifyWorkFinishedType_Parms ) )
+		this->ProcessEvent ( pFnNotifyWorkFinishedType, &NotifyWorkFinishedType_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkStartedObject
@@ -3991,20 +3346,16 @@ void USFXOnlineComponent::NotifyWorkFinishedType ( unsigned char eWork, unsigned
 
 void USFXOnlineComponent::NotifyWorkStartedObject ( class USFXOnlineEvent* oEvent, unsigned char eEventType )
 {
-	static UFunction* pFnNotifyWorkStartedObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyWorkStartedObjectRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkStartedObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyWorkStartedObject )
-		pFnNotifyWorkStartedObject = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkStartedObject" );
+	UFunction* const pFnNotifyWorkStartedObject = pFnNotifyWorkStartedObjectRef.Get ( );
 
 	USFXOnlineComponent_execNotifyWorkStartedObject_Parms NotifyWorkStartedObject_Parms;
 	NotifyWorkStartedObject_Parms.oEvent = oEvent;
 	NotifyWorkStartedObject_Parms.eEventType = eEventType;
 
-	pFnNotifyWorkStartedObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotifyWorkStartedObject, &NotifyWorkStartedObject_Parms, NULL );
-
-	pFnNotifyWorkStartedObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNotifyWorkStartedObject, &NotifyWorkStartedObject_Parms ) )
+		this->ProcessEvent ( pFnNotifyWorkStartedObject, &NotifyWorkStartedObject_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkStartedType
@@ -4016,21 +3367,17 @@ void USFXOnlineComponent::NotifyWorkStartedObject ( class USFXOnlineEvent* oEven
 
 void USFXOnlineComponent::NotifyWorkStartedType ( unsigned char eWork, int nEventId, float fTimeOut )
 {
-	static UFunction* pFnNotifyWorkStartedType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyWorkStartedTypeRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkStartedType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyWorkStartedType )
-		pFnNotifyWorkStartedType = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkStartedType" );
+	UFunction* const pFnNotifyWorkStartedType = pFnNotifyWorkStartedTypeRef.Get ( );
 
 	USFXOnlineComponent_execNotifyWorkStartedType_Parms NotifyWorkStartedType_Parms;
 	NotifyWorkStartedType_Parms.eWork = eWork;
 	NotifyWorkStartedType_Parms.nEventId = nEventId;
 	NotifyWorkStartedType_Parms.fTimeOut = fTimeOut;
 
-	pFnNotifyWorkStartedType->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotifyWorkStartedType, &NotifyWorkStartedType_Parms, NULL );
-
-	pFnNotifyWorkStartedType->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNotifyWorkStartedType, &NotifyWorkStartedType_Parms ) )
+		this->ProcessEvent ( pFnNotifyWorkStartedType, &NotifyWorkStartedType_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.NotifyEventObject
@@ -4040,19 +3387,15 @@ void USFXOnlineComponent::NotifyWorkStartedType ( unsigned char eWork, int nEven
 
 void USFXOnlineComponent::NotifyEventObject ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnNotifyEventObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyEventObjectRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyEventObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyEventObject )
-		pFnNotifyEventObject = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyEventObject" );
+	UFunction* const pFnNotifyEventObject = pFnNotifyEventObjectRef.Get ( );
 
 	USFXOnlineComponent_execNotifyEventObject_Parms NotifyEventObject_Parms;
 	NotifyEventObject_Parms.oEvent = oEvent;
 
-	pFnNotifyEventObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotifyEventObject, &NotifyEventObject_Parms, NULL );
-
-	pFnNotifyEventObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNotifyEventObject, &NotifyEventObject_Parms ) )
+		this->ProcessEvent ( pFnNotifyEventObject, &NotifyEventObject_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.NotifyEventType
@@ -4064,21 +3407,17 @@ void USFXOnlineComponent::NotifyEventObject ( class USFXOnlineEvent* oEvent )
 
 void USFXOnlineComponent::NotifyEventType ( unsigned char eEventType, unsigned char eStatus, unsigned char eOutcome )
 {
-	static UFunction* pFnNotifyEventType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyEventTypeRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyEventType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyEventType )
-		pFnNotifyEventType = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyEventType" );
+	UFunction* const pFnNotifyEventType = pFnNotifyEventTypeRef.Get ( );
 
 	USFXOnlineComponent_execNotifyEventType_Parms NotifyEventType_Parms;
 	NotifyEventType_Parms.eEventType = eEventType;
 	NotifyEventType_Parms.eStatus = eStatus;
 	NotifyEventType_Parms.eOutcome = eOutcome;
 
-	pFnNotifyEventType->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotifyEventType, &NotifyEventType_Parms, NULL );
-
-	pFnNotifyEventType->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNotifyEventType, &NotifyEventType_Parms ) )
+		this->ProcessEvent ( pFnNotifyEventType, &NotifyEventType_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.StopWaitingForAllWork
@@ -4088,19 +3427,15 @@ void USFXOnlineComponent::NotifyEventType ( unsigned char eEventType, unsigned c
 
 void USFXOnlineComponent::StopWaitingForAllWork ( class UObject* oCallbackTarget )
 {
-	static UFunction* pFnStopWaitingForAllWork = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopWaitingForAllWorkRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.StopWaitingForAllWork", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopWaitingForAllWork )
-		pFnStopWaitingForAllWork = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.StopWaitingForAllWork" );
+	UFunction* const pFnStopWaitingForAllWork = pFnStopWaitingForAllWorkRef.Get ( );
 
 	USFXOnlineComponent_execStopWaitingForAllWork_Parms StopWaitingForAllWork_Parms;
 	StopWaitingForAllWork_Parms.oCallbackTarget = oCallbackTarget;
 
-	pFnStopWaitingForAllWork->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnStopWaitingForAllWork, &StopWaitingForAllWork_Parms, NULL );
-
-	pFnStopWaitingForAllWork->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnStopWaitingForAllWork, &StopWaitingForAllWork_Parms ) )
+		this->ProcessEvent ( pFnStopWaitingForAllWork, &StopWaitingForAllWork_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.UnsubscribeFromAllEvents
@@ -4110,19 +3445,15 @@ void USFXOnlineComponent::StopWaitingForAllWork ( class UObject* oCallbackTarget
 
 void USFXOnlineComponent::UnsubscribeFromAllEvents ( class UObject* oCallbackTarget )
 {
-	static UFunction* pFnUnsubscribeFromAllEvents = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnsubscribeFromAllEventsRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.UnsubscribeFromAllEvents", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnsubscribeFromAllEvents )
-		pFnUnsubscribeFromAllEvents = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.UnsubscribeFromAllEvents" );
+	UFunction* const pFnUnsubscribeFromAllEvents = pFnUnsubscribeFromAllEventsRef.Get ( );
 
 	USFXOnlineComponent_execUnsubscribeFromAllEvents_Parms UnsubscribeFromAllEvents_Parms;
 	UnsubscribeFromAllEvents_Parms.oCallbackTarget = oCallbackTarget;
 
-	pFnUnsubscribeFromAllEvents->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnUnsubscribeFromAllEvents, &UnsubscribeFromAllEvents_Parms, NULL );
-
-	pFnUnsubscribeFromAllEvents->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnUnsubscribeFromAllEvents, &UnsubscribeFromAllEvents_Parms ) )
+		this->ProcessEvent ( pFnUnsubscribeFromAllEvents, &UnsubscribeFromAllEvents_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.UnsubscribeFromEvent
@@ -4133,20 +3464,16 @@ void USFXOnlineComponent::UnsubscribeFromAllEvents ( class UObject* oCallbackTar
 
 void USFXOnlineComponent::UnsubscribeFromEvent ( unsigned char oEventType, struct FScriptDelegate fnEventCallback )
 {
-	static UFunction* pFnUnsubscribeFromEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnsubscribeFromEventRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.UnsubscribeFromEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnsubscribeFromEvent )
-		pFnUnsubscribeFromEvent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.UnsubscribeFromEvent" );
+	UFunction* const pFnUnsubscribeFromEvent = pFnUnsubscribeFromEventRef.Get ( );
 
 	USFXOnlineComponent_execUnsubscribeFromEvent_Parms UnsubscribeFromEvent_Parms;
 	UnsubscribeFromEvent_Parms.oEventType = oEventType;
 	memcpy ( &UnsubscribeFromEvent_Parms.fnEventCallback, &fnEventCallback, 0x10 );
 
-	pFnUnsubscribeFromEvent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnUnsubscribeFromEvent, &UnsubscribeFromEvent_Parms, NULL );
-
-	pFnUnsubscribeFromEvent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnUnsubscribeFromEvent, &UnsubscribeFromEvent_Parms ) )
+		this->ProcessEvent ( pFnUnsubscribeFromEvent, &UnsubscribeFromEvent_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.SubscribeToEvent
@@ -4157,20 +3484,16 @@ void USFXOnlineComponent::UnsubscribeFromEvent ( unsigned char oEventType, struc
 
 void USFXOnlineComponent::SubscribeToEvent ( unsigned char eEventType, struct FScriptDelegate fnEventCallback )
 {
-	static UFunction* pFnSubscribeToEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubscribeToEventRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.SubscribeToEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubscribeToEvent )
-		pFnSubscribeToEvent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.SubscribeToEvent" );
+	UFunction* const pFnSubscribeToEvent = pFnSubscribeToEventRef.Get ( );
 
 	USFXOnlineComponent_execSubscribeToEvent_Parms SubscribeToEvent_Parms;
 	SubscribeToEvent_Parms.eEventType = eEventType;
 	memcpy ( &SubscribeToEvent_Parms.fnEventCallback, &fnEventCallback, 0x10 );
 
-	pFnSubscribeToEvent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubscribeToEvent, &SubscribeToEvent_Parms, NULL );
-
-	pFnSubscribeToEvent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubscribeToEvent, &SubscribeToEvent_Parms ) )
+		this->ProcessEvent ( pFnSubscribeToEvent, &SubscribeToEvent_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.OnEvent
@@ -4180,10 +3503,9 @@ void USFXOnlineComponent::SubscribeToEvent ( unsigned char eEventType, struct FS
 
 void USFXOnlineComponent::OnEvent ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnEventRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.OnEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnEvent )
-		pFnOnEvent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.OnEvent" );
+	UFunction* const pFnOnEvent = pFnOnEventRef.Get ( );
 
 	USFXOnlineComponent_execOnEvent_Parms OnEvent_Parms;
 	OnEvent_Parms.oEvent = oEvent;
@@ -4198,18 +3520,14 @@ void USFXOnlineComponent::OnEvent ( class USFXOnlineEvent* oEvent )
 
 struct SFXName USFXOnlineComponent::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponent_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -4220,18 +3538,14 @@ struct SFXName USFXOnlineComponent::GetAPIName ( )
 
 void USFXOnlineComponent::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponent_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.OnInitialize
@@ -4241,19 +3555,15 @@ void USFXOnlineComponent::OnRelease ( )
 
 void USFXOnlineComponent::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponent_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponent.SubscribeToEvents
@@ -4262,30 +3572,23 @@ void USFXOnlineComponent::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsy
 
 void USFXOnlineComponent::SubscribeToEvents ( )
 {
-	static UFunction* pFnSubscribeToEvents = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubscribeToEventsRef { L"Function SFXOnlineFoundation.SFXOnlineComponent.SubscribeToEvents", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubscribeToEvents )
-		pFnSubscribeToEvents = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponent.SubscribeToEvents" );
+	UFunction* const pFnSubscribeToEvents = pFnSubscribeToEventsRef.Get ( );
 
 	USFXOnlineComponent_execSubscribeToEvents_Parms SubscribeToEvents_Parms;
 
-	pFnSubscribeToEvents->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubscribeToEvents, &SubscribeToEvents_Parms, NULL );
-
-	pFnSubscribeToEvents->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubscribeToEvents, &SubscribeToEvents_Parms ) )
+		this->ProcessEvent ( pFnSubscribeToEvents, &SubscribeToEvents_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineComponentOrigin::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentOrigin::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentOrigin", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentOrigin::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentOrigin" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnTick
@@ -4294,18 +3597,14 @@ class UClass* USFXOnlineComponentOrigin::StaticClass()
 
 void USFXOnlineComponentOrigin::OnTick ( )
 {
-	static UFunction* pFnOnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnTickRef { L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnTick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnTick )
-		pFnOnTick = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnTick" );
+	UFunction* const pFnOnTick = pFnOnTickRef.Get ( );
 
 	USFXOnlineComponentOrigin_execOnTick_Parms OnTick_Parms;
 
-	pFnOnTick->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
-
-	pFnOnTick->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnTick, &OnTick_Parms ) )
+		this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentOrigin.RefreshServerAchievements_ASync
@@ -4316,21 +3615,17 @@ void USFXOnlineComponentOrigin::OnTick ( )
 
 bool USFXOnlineComponentOrigin::RefreshServerAchievements_ASync ( struct FSFXCachedAchievements* cached )
 {
-	static UFunction* pFnRefreshServerAchievements_ASync = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRefreshServerAchievements_ASyncRef { L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.RefreshServerAchievements_ASync", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRefreshServerAchievements_ASync )
-		pFnRefreshServerAchievements_ASync = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.RefreshServerAchievements_ASync" );
+	UFunction* const pFnRefreshServerAchievements_ASync = pFnRefreshServerAchievements_ASyncRef.Get ( );
 
 	USFXOnlineComponentOrigin_execRefreshServerAchievements_ASync_Parms RefreshServerAchievements_ASync_Parms;
 
 	if ( cached )
 		memcpy ( &RefreshServerAchievements_ASync_Parms.cached, cached, 0x24 );
 
-	pFnRefreshServerAchievements_ASync->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRefreshServerAchievements_ASync, &RefreshServerAchievements_ASync_Parms, NULL );
-
-	pFnRefreshServerAchievements_ASync->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRefreshServerAchievements_ASync, &RefreshServerAchievements_ASync_Parms ) )
+		this->ProcessEvent ( pFnRefreshServerAchievements_ASync, &RefreshServerAchievements_ASync_Parms, NULL );
 
 	if ( cached )
 		memcpy ( cached, &RefreshServerAchievements_ASync_Parms.cached, 0x24 );
@@ -4347,20 +3642,16 @@ bool USFXOnlineComponentOrigin::RefreshServerAchievements_ASync ( struct FSFXCac
 
 bool USFXOnlineComponentOrigin::SetRichPresence ( FString const& presence, FString const& gamePresence )
 {
-	static UFunction* pFnSetRichPresence = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetRichPresenceRef { L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.SetRichPresence", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetRichPresence )
-		pFnSetRichPresence = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.SetRichPresence" );
+	UFunction* const pFnSetRichPresence = pFnSetRichPresenceRef.Get ( );
 
 	USFXOnlineComponentOrigin_execSetRichPresence_Parms SetRichPresence_Parms;
 	memcpy ( &SetRichPresence_Parms.presence, &presence, 0x10 );
 	memcpy ( &SetRichPresence_Parms.gamePresence, &gamePresence, 0x10 );
 
-	pFnSetRichPresence->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetRichPresence, &SetRichPresence_Parms, NULL );
-
-	pFnSetRichPresence->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetRichPresence, &SetRichPresence_Parms ) )
+		this->ProcessEvent ( pFnSetRichPresence, &SetRichPresence_Parms, NULL );
 
 	return SetRichPresence_Parms.ReturnValue;
 };
@@ -4372,18 +3663,14 @@ bool USFXOnlineComponentOrigin::SetRichPresence ( FString const& presence, FStri
 
 bool USFXOnlineComponentOrigin::RequestProfile ( )
 {
-	static UFunction* pFnRequestProfile = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRequestProfileRef { L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.RequestProfile", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRequestProfile )
-		pFnRequestProfile = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.RequestProfile" );
+	UFunction* const pFnRequestProfile = pFnRequestProfileRef.Get ( );
 
 	USFXOnlineComponentOrigin_execRequestProfile_Parms RequestProfile_Parms;
 
-	pFnRequestProfile->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRequestProfile, &RequestProfile_Parms, NULL );
-
-	pFnRequestProfile->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRequestProfile, &RequestProfile_Parms ) )
+		this->ProcessEvent ( pFnRequestProfile, &RequestProfile_Parms, NULL );
 
 	return RequestProfile_Parms.ReturnValue;
 };
@@ -4395,18 +3682,14 @@ bool USFXOnlineComponentOrigin::RequestProfile ( )
 
 bool USFXOnlineComponentOrigin::StartService ( )
 {
-	static UFunction* pFnStartService = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartServiceRef { L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.StartService", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartService )
-		pFnStartService = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.StartService" );
+	UFunction* const pFnStartService = pFnStartServiceRef.Get ( );
 
 	USFXOnlineComponentOrigin_execStartService_Parms StartService_Parms;
 
-	pFnStartService->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnStartService, &StartService_Parms, NULL );
-
-	pFnStartService->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnStartService, &StartService_Parms ) )
+		this->ProcessEvent ( pFnStartService, &StartService_Parms, NULL );
 
 	return StartService_Parms.ReturnValue;
 };
@@ -4418,18 +3701,14 @@ bool USFXOnlineComponentOrigin::StartService ( )
 
 bool USFXOnlineComponentOrigin::EnsureSignedIn ( )
 {
-	static UFunction* pFnEnsureSignedIn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEnsureSignedInRef { L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.EnsureSignedIn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEnsureSignedIn )
-		pFnEnsureSignedIn = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.EnsureSignedIn" );
+	UFunction* const pFnEnsureSignedIn = pFnEnsureSignedInRef.Get ( );
 
 	USFXOnlineComponentOrigin_execEnsureSignedIn_Parms EnsureSignedIn_Parms;
 
-	pFnEnsureSignedIn->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEnsureSignedIn, &EnsureSignedIn_Parms, NULL );
-
-	pFnEnsureSignedIn->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnEnsureSignedIn, &EnsureSignedIn_Parms ) )
+		this->ProcessEvent ( pFnEnsureSignedIn, &EnsureSignedIn_Parms, NULL );
 
 	return EnsureSignedIn_Parms.ReturnValue;
 };
@@ -4441,18 +3720,14 @@ bool USFXOnlineComponentOrigin::EnsureSignedIn ( )
 
 struct SFXName USFXOnlineComponentOrigin::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentOrigin_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -4463,18 +3738,14 @@ struct SFXName USFXOnlineComponentOrigin::GetAPIName ( )
 
 void USFXOnlineComponentOrigin::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentOrigin_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnInitialize
@@ -4484,31 +3755,24 @@ void USFXOnlineComponentOrigin::OnRelease ( )
 
 void USFXOnlineComponentOrigin::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentOrigin_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineComponentUnrealPlayer::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentUnrealPlayer::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentUnrealPlayer::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearUnlockAchievementCompleteDelegate
@@ -4519,10 +3783,9 @@ class UClass* USFXOnlineComponentUnrealPlayer::StaticClass()
 
 void USFXOnlineComponentUnrealPlayer::ClearUnlockAchievementCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate UnlockAchievementCompleteDelegate )
 {
-	static UFunction* pFnClearUnlockAchievementCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearUnlockAchievementCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearUnlockAchievementCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearUnlockAchievementCompleteDelegate )
-		pFnClearUnlockAchievementCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearUnlockAchievementCompleteDelegate" );
+	UFunction* const pFnClearUnlockAchievementCompleteDelegate = pFnClearUnlockAchievementCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearUnlockAchievementCompleteDelegate_Parms ClearUnlockAchievementCompleteDelegate_Parms;
 	ClearUnlockAchievementCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -4539,10 +3802,9 @@ void USFXOnlineComponentUnrealPlayer::ClearUnlockAchievementCompleteDelegate ( u
 
 void USFXOnlineComponentUnrealPlayer::AddUnlockAchievementCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate UnlockAchievementCompleteDelegate )
 {
-	static UFunction* pFnAddUnlockAchievementCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddUnlockAchievementCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddUnlockAchievementCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddUnlockAchievementCompleteDelegate )
-		pFnAddUnlockAchievementCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddUnlockAchievementCompleteDelegate" );
+	UFunction* const pFnAddUnlockAchievementCompleteDelegate = pFnAddUnlockAchievementCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddUnlockAchievementCompleteDelegate_Parms AddUnlockAchievementCompleteDelegate_Parms;
 	AddUnlockAchievementCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -4558,10 +3820,9 @@ void USFXOnlineComponentUnrealPlayer::AddUnlockAchievementCompleteDelegate ( uns
 
 void USFXOnlineComponentUnrealPlayer::OnUnlockAchievementComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnUnlockAchievementComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUnlockAchievementCompleteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnUnlockAchievementComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUnlockAchievementComplete )
-		pFnOnUnlockAchievementComplete = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnUnlockAchievementComplete" );
+	UFunction* const pFnOnUnlockAchievementComplete = pFnOnUnlockAchievementCompleteRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnUnlockAchievementComplete_Parms OnUnlockAchievementComplete_Parms;
 	OnUnlockAchievementComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -4578,20 +3839,16 @@ void USFXOnlineComponentUnrealPlayer::OnUnlockAchievementComplete ( unsigned lon
 
 bool USFXOnlineComponentUnrealPlayer::UnlockAchievement ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnUnlockAchievement = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnlockAchievementRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.UnlockAchievement", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnlockAchievement )
-		pFnUnlockAchievement = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.UnlockAchievement" );
+	UFunction* const pFnUnlockAchievement = pFnUnlockAchievementRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execUnlockAchievement_Parms UnlockAchievement_Parms;
 	UnlockAchievement_Parms.LocalUserNum = LocalUserNum;
 	UnlockAchievement_Parms.AchievementId = AchievementId;
 
-	pFnUnlockAchievement->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnUnlockAchievement, &UnlockAchievement_Parms, NULL );
-
-	pFnUnlockAchievement->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnUnlockAchievement, &UnlockAchievement_Parms ) )
+		this->ProcessEvent ( pFnUnlockAchievement, &UnlockAchievement_Parms, NULL );
 
 	return UnlockAchievement_Parms.ReturnValue;
 };
@@ -4607,10 +3864,9 @@ bool USFXOnlineComponentUnrealPlayer::UnlockAchievement ( unsigned char LocalUse
 
 unsigned char USFXOnlineComponentUnrealPlayer::GetAchievements ( unsigned char LocalUserNum, int TitleId, int SetIndex, TArray<struct FAchievementDetails>* Achievements )
 {
-	static UFunction* pFnGetAchievements = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAchievementsRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetAchievements", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAchievements )
-		pFnGetAchievements = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetAchievements" );
+	UFunction* const pFnGetAchievements = pFnGetAchievementsRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execGetAchievements_Parms GetAchievements_Parms;
 	GetAchievements_Parms.LocalUserNum = LocalUserNum;
@@ -4620,11 +3876,8 @@ unsigned char USFXOnlineComponentUnrealPlayer::GetAchievements ( unsigned char L
 	if ( Achievements )
 		memcpy ( &GetAchievements_Parms.Achievements, Achievements, 0x10 );
 
-	pFnGetAchievements->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAchievements, &GetAchievements_Parms, NULL );
-
-	pFnGetAchievements->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAchievements, &GetAchievements_Parms ) )
+		this->ProcessEvent ( pFnGetAchievements, &GetAchievements_Parms, NULL );
 
 	if ( Achievements )
 		memcpy ( Achievements, &GetAchievements_Parms.Achievements, 0x10 );
@@ -4640,10 +3893,9 @@ unsigned char USFXOnlineComponentUnrealPlayer::GetAchievements ( unsigned char L
 
 void USFXOnlineComponentUnrealPlayer::ClearReadAchievementsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadAchievementsCompleteDelegate )
 {
-	static UFunction* pFnClearReadAchievementsCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearReadAchievementsCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadAchievementsCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearReadAchievementsCompleteDelegate )
-		pFnClearReadAchievementsCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadAchievementsCompleteDelegate" );
+	UFunction* const pFnClearReadAchievementsCompleteDelegate = pFnClearReadAchievementsCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearReadAchievementsCompleteDelegate_Parms ClearReadAchievementsCompleteDelegate_Parms;
 	ClearReadAchievementsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -4660,10 +3912,9 @@ void USFXOnlineComponentUnrealPlayer::ClearReadAchievementsCompleteDelegate ( un
 
 void USFXOnlineComponentUnrealPlayer::AddReadAchievementsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadAchievementsCompleteDelegate )
 {
-	static UFunction* pFnAddReadAchievementsCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddReadAchievementsCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadAchievementsCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddReadAchievementsCompleteDelegate )
-		pFnAddReadAchievementsCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadAchievementsCompleteDelegate" );
+	UFunction* const pFnAddReadAchievementsCompleteDelegate = pFnAddReadAchievementsCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddReadAchievementsCompleteDelegate_Parms AddReadAchievementsCompleteDelegate_Parms;
 	AddReadAchievementsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -4679,10 +3930,9 @@ void USFXOnlineComponentUnrealPlayer::AddReadAchievementsCompleteDelegate ( unsi
 
 void USFXOnlineComponentUnrealPlayer::OnReadAchievementsComplete ( int TitleId )
 {
-	static UFunction* pFnOnReadAchievementsComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReadAchievementsCompleteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadAchievementsComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReadAchievementsComplete )
-		pFnOnReadAchievementsComplete = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadAchievementsComplete" );
+	UFunction* const pFnOnReadAchievementsComplete = pFnOnReadAchievementsCompleteRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnReadAchievementsComplete_Parms OnReadAchievementsComplete_Parms;
 	OnReadAchievementsComplete_Parms.TitleId = TitleId;
@@ -4701,10 +3951,9 @@ void USFXOnlineComponentUnrealPlayer::OnReadAchievementsComplete ( int TitleId )
 
 bool USFXOnlineComponentUnrealPlayer::ReadAchievements ( unsigned char LocalUserNum, int TitleId, unsigned long bShouldReadText, unsigned long bShouldReadImages )
 {
-	static UFunction* pFnReadAchievements = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReadAchievementsRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadAchievements", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReadAchievements )
-		pFnReadAchievements = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadAchievements" );
+	UFunction* const pFnReadAchievements = pFnReadAchievementsRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execReadAchievements_Parms ReadAchievements_Parms;
 	ReadAchievements_Parms.LocalUserNum = LocalUserNum;
@@ -4712,11 +3961,8 @@ bool USFXOnlineComponentUnrealPlayer::ReadAchievements ( unsigned char LocalUser
 	ReadAchievements_Parms.bShouldReadText = bShouldReadText;
 	ReadAchievements_Parms.bShouldReadImages = bShouldReadImages;
 
-	pFnReadAchievements->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnReadAchievements, &ReadAchievements_Parms, NULL );
-
-	pFnReadAchievements->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnReadAchievements, &ReadAchievements_Parms ) )
+		this->ProcessEvent ( pFnReadAchievements, &ReadAchievements_Parms, NULL );
 
 	return ReadAchievements_Parms.ReturnValue;
 };
@@ -4730,10 +3976,9 @@ bool USFXOnlineComponentUnrealPlayer::ReadAchievements ( unsigned char LocalUser
 
 bool USFXOnlineComponentUnrealPlayer::DeleteMessage ( unsigned char LocalUserNum, int MessageIndex )
 {
-	static UFunction* pFnDeleteMessage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDeleteMessageRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.DeleteMessage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDeleteMessage )
-		pFnDeleteMessage = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.DeleteMessage" );
+	UFunction* const pFnDeleteMessage = pFnDeleteMessageRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execDeleteMessage_Parms DeleteMessage_Parms;
 	DeleteMessage_Parms.LocalUserNum = LocalUserNum;
@@ -4752,10 +3997,9 @@ bool USFXOnlineComponentUnrealPlayer::DeleteMessage ( unsigned char LocalUserNum
 
 void USFXOnlineComponentUnrealPlayer::ClearFriendMessageReceivedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate MessageDelegate )
 {
-	static UFunction* pFnClearFriendMessageReceivedDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearFriendMessageReceivedDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearFriendMessageReceivedDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearFriendMessageReceivedDelegate )
-		pFnClearFriendMessageReceivedDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearFriendMessageReceivedDelegate" );
+	UFunction* const pFnClearFriendMessageReceivedDelegate = pFnClearFriendMessageReceivedDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearFriendMessageReceivedDelegate_Parms ClearFriendMessageReceivedDelegate_Parms;
 	ClearFriendMessageReceivedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -4772,10 +4016,9 @@ void USFXOnlineComponentUnrealPlayer::ClearFriendMessageReceivedDelegate ( unsig
 
 void USFXOnlineComponentUnrealPlayer::AddFriendMessageReceivedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate MessageDelegate )
 {
-	static UFunction* pFnAddFriendMessageReceivedDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddFriendMessageReceivedDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendMessageReceivedDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddFriendMessageReceivedDelegate )
-		pFnAddFriendMessageReceivedDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendMessageReceivedDelegate" );
+	UFunction* const pFnAddFriendMessageReceivedDelegate = pFnAddFriendMessageReceivedDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddFriendMessageReceivedDelegate_Parms AddFriendMessageReceivedDelegate_Parms;
 	AddFriendMessageReceivedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -4794,10 +4037,9 @@ void USFXOnlineComponentUnrealPlayer::AddFriendMessageReceivedDelegate ( unsigne
 
 void USFXOnlineComponentUnrealPlayer::OnFriendMessageReceived ( unsigned char LocalUserNum, struct FUniqueNetId const& SendingPlayer, FString const& SendingNick, FString const& Message )
 {
-	static UFunction* pFnOnFriendMessageReceived = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnFriendMessageReceivedRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnFriendMessageReceived", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnFriendMessageReceived )
-		pFnOnFriendMessageReceived = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnFriendMessageReceived" );
+	UFunction* const pFnOnFriendMessageReceived = pFnOnFriendMessageReceivedRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnFriendMessageReceived_Parms OnFriendMessageReceived_Parms;
 	OnFriendMessageReceived_Parms.LocalUserNum = LocalUserNum;
@@ -4816,10 +4058,9 @@ void USFXOnlineComponentUnrealPlayer::OnFriendMessageReceived ( unsigned char Lo
 
 void USFXOnlineComponentUnrealPlayer::GetFriendMessages ( unsigned char LocalUserNum, TArray<struct FOnlineFriendMessage>* FriendMessages )
 {
-	static UFunction* pFnGetFriendMessages = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetFriendMessagesRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetFriendMessages", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetFriendMessages )
-		pFnGetFriendMessages = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetFriendMessages" );
+	UFunction* const pFnGetFriendMessages = pFnGetFriendMessagesRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execGetFriendMessages_Parms GetFriendMessages_Parms;
 	GetFriendMessages_Parms.LocalUserNum = LocalUserNum;
@@ -4840,10 +4081,9 @@ void USFXOnlineComponentUnrealPlayer::GetFriendMessages ( unsigned char LocalUse
 
 void USFXOnlineComponentUnrealPlayer::ClearJoinFriendGameCompleteDelegate ( struct FScriptDelegate JoinFriendGameCompleteDelegate )
 {
-	static UFunction* pFnClearJoinFriendGameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearJoinFriendGameCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearJoinFriendGameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearJoinFriendGameCompleteDelegate )
-		pFnClearJoinFriendGameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearJoinFriendGameCompleteDelegate" );
+	UFunction* const pFnClearJoinFriendGameCompleteDelegate = pFnClearJoinFriendGameCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearJoinFriendGameCompleteDelegate_Parms ClearJoinFriendGameCompleteDelegate_Parms;
 	memcpy ( &ClearJoinFriendGameCompleteDelegate_Parms.JoinFriendGameCompleteDelegate, &JoinFriendGameCompleteDelegate, 0x10 );
@@ -4858,10 +4098,9 @@ void USFXOnlineComponentUnrealPlayer::ClearJoinFriendGameCompleteDelegate ( stru
 
 void USFXOnlineComponentUnrealPlayer::AddJoinFriendGameCompleteDelegate ( struct FScriptDelegate JoinFriendGameCompleteDelegate )
 {
-	static UFunction* pFnAddJoinFriendGameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddJoinFriendGameCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddJoinFriendGameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddJoinFriendGameCompleteDelegate )
-		pFnAddJoinFriendGameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddJoinFriendGameCompleteDelegate" );
+	UFunction* const pFnAddJoinFriendGameCompleteDelegate = pFnAddJoinFriendGameCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddJoinFriendGameCompleteDelegate_Parms AddJoinFriendGameCompleteDelegate_Parms;
 	memcpy ( &AddJoinFriendGameCompleteDelegate_Parms.JoinFriendGameCompleteDelegate, &JoinFriendGameCompleteDelegate, 0x10 );
@@ -4876,10 +4115,9 @@ void USFXOnlineComponentUnrealPlayer::AddJoinFriendGameCompleteDelegate ( struct
 
 void USFXOnlineComponentUnrealPlayer::OnJoinFriendGameComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnJoinFriendGameComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnJoinFriendGameCompleteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnJoinFriendGameComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnJoinFriendGameComplete )
-		pFnOnJoinFriendGameComplete = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnJoinFriendGameComplete" );
+	UFunction* const pFnOnJoinFriendGameComplete = pFnOnJoinFriendGameCompleteRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnJoinFriendGameComplete_Parms OnJoinFriendGameComplete_Parms;
 	OnJoinFriendGameComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -4896,10 +4134,9 @@ void USFXOnlineComponentUnrealPlayer::OnJoinFriendGameComplete ( unsigned long b
 
 bool USFXOnlineComponentUnrealPlayer::JoinFriendGame ( unsigned char LocalUserNum, struct FUniqueNetId const& Friend )
 {
-	static UFunction* pFnJoinFriendGame = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnJoinFriendGameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.JoinFriendGame", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnJoinFriendGame )
-		pFnJoinFriendGame = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.JoinFriendGame" );
+	UFunction* const pFnJoinFriendGame = pFnJoinFriendGameRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execJoinFriendGame_Parms JoinFriendGame_Parms;
 	JoinFriendGame_Parms.LocalUserNum = LocalUserNum;
@@ -4918,10 +4155,9 @@ bool USFXOnlineComponentUnrealPlayer::JoinFriendGame ( unsigned char LocalUserNu
 
 void USFXOnlineComponentUnrealPlayer::ClearReceivedGameInviteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReceivedGameInviteDelegate )
 {
-	static UFunction* pFnClearReceivedGameInviteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearReceivedGameInviteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReceivedGameInviteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearReceivedGameInviteDelegate )
-		pFnClearReceivedGameInviteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReceivedGameInviteDelegate" );
+	UFunction* const pFnClearReceivedGameInviteDelegate = pFnClearReceivedGameInviteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearReceivedGameInviteDelegate_Parms ClearReceivedGameInviteDelegate_Parms;
 	ClearReceivedGameInviteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -4938,10 +4174,9 @@ void USFXOnlineComponentUnrealPlayer::ClearReceivedGameInviteDelegate ( unsigned
 
 void USFXOnlineComponentUnrealPlayer::AddReceivedGameInviteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReceivedGameInviteDelegate )
 {
-	static UFunction* pFnAddReceivedGameInviteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddReceivedGameInviteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReceivedGameInviteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddReceivedGameInviteDelegate )
-		pFnAddReceivedGameInviteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReceivedGameInviteDelegate" );
+	UFunction* const pFnAddReceivedGameInviteDelegate = pFnAddReceivedGameInviteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddReceivedGameInviteDelegate_Parms AddReceivedGameInviteDelegate_Parms;
 	AddReceivedGameInviteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -4958,10 +4193,9 @@ void USFXOnlineComponentUnrealPlayer::AddReceivedGameInviteDelegate ( unsigned c
 
 void USFXOnlineComponentUnrealPlayer::OnReceivedGameInvite ( unsigned char LocalUserNum, FString const& InviterName )
 {
-	static UFunction* pFnOnReceivedGameInvite = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReceivedGameInviteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReceivedGameInvite", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReceivedGameInvite )
-		pFnOnReceivedGameInvite = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReceivedGameInvite" );
+	UFunction* const pFnOnReceivedGameInvite = pFnOnReceivedGameInviteRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnReceivedGameInvite_Parms OnReceivedGameInvite_Parms;
 	OnReceivedGameInvite_Parms.LocalUserNum = LocalUserNum;
@@ -4980,10 +4214,9 @@ void USFXOnlineComponentUnrealPlayer::OnReceivedGameInvite ( unsigned char Local
 
 bool USFXOnlineComponentUnrealPlayer::SendGameInviteToFriends ( unsigned char LocalUserNum, TArray<struct FUniqueNetId> const& Friends, FString const& Text )
 {
-	static UFunction* pFnSendGameInviteToFriends = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSendGameInviteToFriendsRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SendGameInviteToFriends", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSendGameInviteToFriends )
-		pFnSendGameInviteToFriends = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SendGameInviteToFriends" );
+	UFunction* const pFnSendGameInviteToFriends = pFnSendGameInviteToFriendsRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execSendGameInviteToFriends_Parms SendGameInviteToFriends_Parms;
 	SendGameInviteToFriends_Parms.LocalUserNum = LocalUserNum;
@@ -5005,10 +4238,9 @@ bool USFXOnlineComponentUnrealPlayer::SendGameInviteToFriends ( unsigned char Lo
 
 bool USFXOnlineComponentUnrealPlayer::SendGameInviteToFriend ( unsigned char LocalUserNum, struct FUniqueNetId const& Friend, FString const& Text )
 {
-	static UFunction* pFnSendGameInviteToFriend = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSendGameInviteToFriendRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SendGameInviteToFriend", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSendGameInviteToFriend )
-		pFnSendGameInviteToFriend = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SendGameInviteToFriend" );
+	UFunction* const pFnSendGameInviteToFriend = pFnSendGameInviteToFriendRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execSendGameInviteToFriend_Parms SendGameInviteToFriend_Parms;
 	SendGameInviteToFriend_Parms.LocalUserNum = LocalUserNum;
@@ -5030,10 +4262,9 @@ bool USFXOnlineComponentUnrealPlayer::SendGameInviteToFriend ( unsigned char Loc
 
 bool USFXOnlineComponentUnrealPlayer::SendMessageToFriend ( unsigned char LocalUserNum, struct FUniqueNetId const& Friend, FString const& Message )
 {
-	static UFunction* pFnSendMessageToFriend = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSendMessageToFriendRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SendMessageToFriend", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSendMessageToFriend )
-		pFnSendMessageToFriend = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SendMessageToFriend" );
+	UFunction* const pFnSendMessageToFriend = pFnSendMessageToFriendRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execSendMessageToFriend_Parms SendMessageToFriend_Parms;
 	SendMessageToFriend_Parms.LocalUserNum = LocalUserNum;
@@ -5053,10 +4284,9 @@ bool USFXOnlineComponentUnrealPlayer::SendMessageToFriend ( unsigned char LocalU
 
 void USFXOnlineComponentUnrealPlayer::ClearFriendInviteReceivedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate InviteDelegate )
 {
-	static UFunction* pFnClearFriendInviteReceivedDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearFriendInviteReceivedDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearFriendInviteReceivedDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearFriendInviteReceivedDelegate )
-		pFnClearFriendInviteReceivedDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearFriendInviteReceivedDelegate" );
+	UFunction* const pFnClearFriendInviteReceivedDelegate = pFnClearFriendInviteReceivedDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearFriendInviteReceivedDelegate_Parms ClearFriendInviteReceivedDelegate_Parms;
 	ClearFriendInviteReceivedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -5073,10 +4303,9 @@ void USFXOnlineComponentUnrealPlayer::ClearFriendInviteReceivedDelegate ( unsign
 
 void USFXOnlineComponentUnrealPlayer::AddFriendInviteReceivedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate InviteDelegate )
 {
-	static UFunction* pFnAddFriendInviteReceivedDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddFriendInviteReceivedDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendInviteReceivedDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddFriendInviteReceivedDelegate )
-		pFnAddFriendInviteReceivedDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendInviteReceivedDelegate" );
+	UFunction* const pFnAddFriendInviteReceivedDelegate = pFnAddFriendInviteReceivedDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddFriendInviteReceivedDelegate_Parms AddFriendInviteReceivedDelegate_Parms;
 	AddFriendInviteReceivedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -5095,10 +4324,9 @@ void USFXOnlineComponentUnrealPlayer::AddFriendInviteReceivedDelegate ( unsigned
 
 void USFXOnlineComponentUnrealPlayer::OnFriendInviteReceived ( unsigned char LocalUserNum, struct FUniqueNetId const& RequestingPlayer, FString const& RequestingNick, FString const& Message )
 {
-	static UFunction* pFnOnFriendInviteReceived = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnFriendInviteReceivedRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnFriendInviteReceived", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnFriendInviteReceived )
-		pFnOnFriendInviteReceived = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnFriendInviteReceived" );
+	UFunction* const pFnOnFriendInviteReceived = pFnOnFriendInviteReceivedRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnFriendInviteReceived_Parms OnFriendInviteReceived_Parms;
 	OnFriendInviteReceived_Parms.LocalUserNum = LocalUserNum;
@@ -5118,10 +4346,9 @@ void USFXOnlineComponentUnrealPlayer::OnFriendInviteReceived ( unsigned char Loc
 
 bool USFXOnlineComponentUnrealPlayer::RemoveFriend ( unsigned char LocalUserNum, struct FUniqueNetId const& FormerFriend )
 {
-	static UFunction* pFnRemoveFriend = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRemoveFriendRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.RemoveFriend", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRemoveFriend )
-		pFnRemoveFriend = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.RemoveFriend" );
+	UFunction* const pFnRemoveFriend = pFnRemoveFriendRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execRemoveFriend_Parms RemoveFriend_Parms;
 	RemoveFriend_Parms.LocalUserNum = LocalUserNum;
@@ -5141,10 +4368,9 @@ bool USFXOnlineComponentUnrealPlayer::RemoveFriend ( unsigned char LocalUserNum,
 
 bool USFXOnlineComponentUnrealPlayer::DenyFriendInvite ( unsigned char LocalUserNum, struct FUniqueNetId const& RequestingPlayer )
 {
-	static UFunction* pFnDenyFriendInvite = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDenyFriendInviteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.DenyFriendInvite", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDenyFriendInvite )
-		pFnDenyFriendInvite = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.DenyFriendInvite" );
+	UFunction* const pFnDenyFriendInvite = pFnDenyFriendInviteRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execDenyFriendInvite_Parms DenyFriendInvite_Parms;
 	DenyFriendInvite_Parms.LocalUserNum = LocalUserNum;
@@ -5164,10 +4390,9 @@ bool USFXOnlineComponentUnrealPlayer::DenyFriendInvite ( unsigned char LocalUser
 
 bool USFXOnlineComponentUnrealPlayer::AcceptFriendInvite ( unsigned char LocalUserNum, struct FUniqueNetId const& RequestingPlayer )
 {
-	static UFunction* pFnAcceptFriendInvite = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAcceptFriendInviteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AcceptFriendInvite", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAcceptFriendInvite )
-		pFnAcceptFriendInvite = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AcceptFriendInvite" );
+	UFunction* const pFnAcceptFriendInvite = pFnAcceptFriendInviteRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAcceptFriendInvite_Parms AcceptFriendInvite_Parms;
 	AcceptFriendInvite_Parms.LocalUserNum = LocalUserNum;
@@ -5186,10 +4411,9 @@ bool USFXOnlineComponentUnrealPlayer::AcceptFriendInvite ( unsigned char LocalUs
 
 void USFXOnlineComponentUnrealPlayer::ClearAddFriendByNameCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate FriendDelegate )
 {
-	static UFunction* pFnClearAddFriendByNameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearAddFriendByNameCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearAddFriendByNameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearAddFriendByNameCompleteDelegate )
-		pFnClearAddFriendByNameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearAddFriendByNameCompleteDelegate" );
+	UFunction* const pFnClearAddFriendByNameCompleteDelegate = pFnClearAddFriendByNameCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearAddFriendByNameCompleteDelegate_Parms ClearAddFriendByNameCompleteDelegate_Parms;
 	ClearAddFriendByNameCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -5206,10 +4430,9 @@ void USFXOnlineComponentUnrealPlayer::ClearAddFriendByNameCompleteDelegate ( uns
 
 void USFXOnlineComponentUnrealPlayer::AddAddFriendByNameCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate FriendDelegate )
 {
-	static UFunction* pFnAddAddFriendByNameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddAddFriendByNameCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddAddFriendByNameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddAddFriendByNameCompleteDelegate )
-		pFnAddAddFriendByNameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddAddFriendByNameCompleteDelegate" );
+	UFunction* const pFnAddAddFriendByNameCompleteDelegate = pFnAddAddFriendByNameCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddAddFriendByNameCompleteDelegate_Parms AddAddFriendByNameCompleteDelegate_Parms;
 	AddAddFriendByNameCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -5225,10 +4448,9 @@ void USFXOnlineComponentUnrealPlayer::AddAddFriendByNameCompleteDelegate ( unsig
 
 void USFXOnlineComponentUnrealPlayer::OnAddFriendByNameComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnAddFriendByNameComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAddFriendByNameCompleteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnAddFriendByNameComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnAddFriendByNameComplete )
-		pFnOnAddFriendByNameComplete = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnAddFriendByNameComplete" );
+	UFunction* const pFnOnAddFriendByNameComplete = pFnOnAddFriendByNameCompleteRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnAddFriendByNameComplete_Parms OnAddFriendByNameComplete_Parms;
 	OnAddFriendByNameComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -5246,10 +4468,9 @@ void USFXOnlineComponentUnrealPlayer::OnAddFriendByNameComplete ( unsigned long
 
 bool USFXOnlineComponentUnrealPlayer::AddFriendByName ( unsigned char LocalUserNum, FString const& FriendName, FString const& Message )
 {
-	static UFunction* pFnAddFriendByName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddFriendByNameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendByName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddFriendByName )
-		pFnAddFriendByName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendByName" );
+	UFunction* const pFnAddFriendByName = pFnAddFriendByNameRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddFriendByName_Parms AddFriendByName_Parms;
 	AddFriendByName_Parms.LocalUserNum = LocalUserNum;
@@ -5271,10 +4492,9 @@ bool USFXOnlineComponentUnrealPlayer::AddFriendByName ( unsigned char LocalUserN
 
 bool USFXOnlineComponentUnrealPlayer::AddFriend ( unsigned char LocalUserNum, struct FUniqueNetId const& NewFriend, FString const& Message )
 {
-	static UFunction* pFnAddFriend = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddFriendRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriend", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddFriend )
-		pFnAddFriend = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriend" );
+	UFunction* const pFnAddFriend = pFnAddFriendRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddFriend_Parms AddFriend_Parms;
 	AddFriend_Parms.LocalUserNum = LocalUserNum;
@@ -5294,10 +4514,9 @@ bool USFXOnlineComponentUnrealPlayer::AddFriend ( unsigned char LocalUserNum, st
 
 FString USFXOnlineComponentUnrealPlayer::GetKeyboardInputResults ( unsigned char* bWasCanceled )
 {
-	static UFunction* pFnGetKeyboardInputResults = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetKeyboardInputResultsRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetKeyboardInputResults", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetKeyboardInputResults )
-		pFnGetKeyboardInputResults = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetKeyboardInputResults" );
+	UFunction* const pFnGetKeyboardInputResults = pFnGetKeyboardInputResultsRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execGetKeyboardInputResults_Parms GetKeyboardInputResults_Parms;
 
@@ -5319,10 +4538,9 @@ FString USFXOnlineComponentUnrealPlayer::GetKeyboardInputResults ( unsigned char
 
 void USFXOnlineComponentUnrealPlayer::ClearKeyboardInputDoneDelegate ( struct FScriptDelegate InputDelegate )
 {
-	static UFunction* pFnClearKeyboardInputDoneDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearKeyboardInputDoneDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearKeyboardInputDoneDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearKeyboardInputDoneDelegate )
-		pFnClearKeyboardInputDoneDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearKeyboardInputDoneDelegate" );
+	UFunction* const pFnClearKeyboardInputDoneDelegate = pFnClearKeyboardInputDoneDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearKeyboardInputDoneDelegate_Parms ClearKeyboardInputDoneDelegate_Parms;
 	memcpy ( &ClearKeyboardInputDoneDelegate_Parms.InputDelegate, &InputDelegate, 0x10 );
@@ -5337,10 +4555,9 @@ void USFXOnlineComponentUnrealPlayer::ClearKeyboardInputDoneDelegate ( struct FS
 
 void USFXOnlineComponentUnrealPlayer::AddKeyboardInputDoneDelegate ( struct FScriptDelegate InputDelegate )
 {
-	static UFunction* pFnAddKeyboardInputDoneDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddKeyboardInputDoneDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddKeyboardInputDoneDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddKeyboardInputDoneDelegate )
-		pFnAddKeyboardInputDoneDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddKeyboardInputDoneDelegate" );
+	UFunction* const pFnAddKeyboardInputDoneDelegate = pFnAddKeyboardInputDoneDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddKeyboardInputDoneDelegate_Parms AddKeyboardInputDoneDelegate_Parms;
 	memcpy ( &AddKeyboardInputDoneDelegate_Parms.InputDelegate, &InputDelegate, 0x10 );
@@ -5355,10 +4572,9 @@ void USFXOnlineComponentUnrealPlayer::AddKeyboardInputDoneDelegate ( struct FScr
 
 void USFXOnlineComponentUnrealPlayer::OnKeyboardInputComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnKeyboardInputComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnKeyboardInputCompleteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnKeyboardInputComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnKeyboardInputComplete )
-		pFnOnKeyboardInputComplete = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnKeyboardInputComplete" );
+	UFunction* const pFnOnKeyboardInputComplete = pFnOnKeyboardInputCompleteRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnKeyboardInputComplete_Parms OnKeyboardInputComplete_Parms;
 	OnKeyboardInputComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -5380,10 +4596,9 @@ void USFXOnlineComponentUnrealPlayer::OnKeyboardInputComplete ( unsigned long bW
 
 bool USFXOnlineComponentUnrealPlayer::ShowKeyboardUI ( unsigned char LocalUserNum, FString const& TitleText, FString const& DescriptionText, unsigned long bIsPassword, unsigned long bShouldValidate, FString const& DefaultText, int MaxResultLength )
 {
-	static UFunction* pFnShowKeyboardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowKeyboardUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ShowKeyboardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowKeyboardUI )
-		pFnShowKeyboardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ShowKeyboardUI" );
+	UFunction* const pFnShowKeyboardUI = pFnShowKeyboardUIRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execShowKeyboardUI_Parms ShowKeyboardUI_Parms;
 	ShowKeyboardUI_Parms.LocalUserNum = LocalUserNum;
@@ -5409,10 +4624,9 @@ bool USFXOnlineComponentUnrealPlayer::ShowKeyboardUI ( unsigned char LocalUserNu
 
 void USFXOnlineComponentUnrealPlayer::SetOnlineStatus ( unsigned char LocalUserNum, int StatusId, TArray<struct FLocalizedStringSetting>* LocalizedStringSettings, TArray<struct FSettingsProperty>* Properties )
 {
-	static UFunction* pFnSetOnlineStatus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetOnlineStatusRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SetOnlineStatus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetOnlineStatus )
-		pFnSetOnlineStatus = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SetOnlineStatus" );
+	UFunction* const pFnSetOnlineStatus = pFnSetOnlineStatusRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execSetOnlineStatus_Parms SetOnlineStatus_Parms;
 	SetOnlineStatus_Parms.LocalUserNum = LocalUserNum;
@@ -5424,11 +4638,8 @@ void USFXOnlineComponentUnrealPlayer::SetOnlineStatus ( unsigned char LocalUserN
 	if ( Properties )
 		memcpy ( &SetOnlineStatus_Parms.Properties, Properties, 0x10 );
 
-	pFnSetOnlineStatus->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetOnlineStatus, &SetOnlineStatus_Parms, NULL );
-
-	pFnSetOnlineStatus->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetOnlineStatus, &SetOnlineStatus_Parms ) )
+		this->ProcessEvent ( pFnSetOnlineStatus, &SetOnlineStatus_Parms, NULL );
 
 	if ( LocalizedStringSettings )
 		memcpy ( LocalizedStringSettings, &SetOnlineStatus_Parms.LocalizedStringSettings, 0x10 );
@@ -5448,10 +4659,9 @@ void USFXOnlineComponentUnrealPlayer::SetOnlineStatus ( unsigned char LocalUserN
 
 unsigned char USFXOnlineComponentUnrealPlayer::GetFriendsList ( unsigned char LocalUserNum, int Count, int StartingAt, TArray<struct FOnlineFriend>* Friends )
 {
-	static UFunction* pFnGetFriendsList = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetFriendsListRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetFriendsList", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetFriendsList )
-		pFnGetFriendsList = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetFriendsList" );
+	UFunction* const pFnGetFriendsList = pFnGetFriendsListRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execGetFriendsList_Parms GetFriendsList_Parms;
 	GetFriendsList_Parms.LocalUserNum = LocalUserNum;
@@ -5477,10 +4687,9 @@ unsigned char USFXOnlineComponentUnrealPlayer::GetFriendsList ( unsigned char Lo
 
 void USFXOnlineComponentUnrealPlayer::ClearReadFriendsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadFriendsCompleteDelegate )
 {
-	static UFunction* pFnClearReadFriendsCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearReadFriendsCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadFriendsCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearReadFriendsCompleteDelegate )
-		pFnClearReadFriendsCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadFriendsCompleteDelegate" );
+	UFunction* const pFnClearReadFriendsCompleteDelegate = pFnClearReadFriendsCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearReadFriendsCompleteDelegate_Parms ClearReadFriendsCompleteDelegate_Parms;
 	ClearReadFriendsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -5497,10 +4706,9 @@ void USFXOnlineComponentUnrealPlayer::ClearReadFriendsCompleteDelegate ( unsigne
 
 void USFXOnlineComponentUnrealPlayer::AddReadFriendsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadFriendsCompleteDelegate )
 {
-	static UFunction* pFnAddReadFriendsCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddReadFriendsCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadFriendsCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddReadFriendsCompleteDelegate )
-		pFnAddReadFriendsCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadFriendsCompleteDelegate" );
+	UFunction* const pFnAddReadFriendsCompleteDelegate = pFnAddReadFriendsCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddReadFriendsCompleteDelegate_Parms AddReadFriendsCompleteDelegate_Parms;
 	AddReadFriendsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -5516,10 +4724,9 @@ void USFXOnlineComponentUnrealPlayer::AddReadFriendsCompleteDelegate ( unsigned
 
 void USFXOnlineComponentUnrealPlayer::OnReadFriendsComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnReadFriendsComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReadFriendsCompleteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadFriendsComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReadFriendsComplete )
-		pFnOnReadFriendsComplete = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadFriendsComplete" );
+	UFunction* const pFnOnReadFriendsComplete = pFnOnReadFriendsCompleteRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnReadFriendsComplete_Parms OnReadFriendsComplete_Parms;
 	OnReadFriendsComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -5537,10 +4744,9 @@ void USFXOnlineComponentUnrealPlayer::OnReadFriendsComplete ( unsigned long bWas
 
 bool USFXOnlineComponentUnrealPlayer::ReadFriendsList ( unsigned char LocalUserNum, int Count, int StartingAt )
 {
-	static UFunction* pFnReadFriendsList = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReadFriendsListRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadFriendsList", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReadFriendsList )
-		pFnReadFriendsList = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadFriendsList" );
+	UFunction* const pFnReadFriendsList = pFnReadFriendsListRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execReadFriendsList_Parms ReadFriendsList_Parms;
 	ReadFriendsList_Parms.LocalUserNum = LocalUserNum;
@@ -5560,10 +4766,9 @@ bool USFXOnlineComponentUnrealPlayer::ReadFriendsList ( unsigned char LocalUserN
 
 void USFXOnlineComponentUnrealPlayer::ClearWritePlayerStorageCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate WritePlayerStorageCompleteDelegate )
 {
-	static UFunction* pFnClearWritePlayerStorageCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearWritePlayerStorageCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearWritePlayerStorageCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearWritePlayerStorageCompleteDelegate )
-		pFnClearWritePlayerStorageCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearWritePlayerStorageCompleteDelegate" );
+	UFunction* const pFnClearWritePlayerStorageCompleteDelegate = pFnClearWritePlayerStorageCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearWritePlayerStorageCompleteDelegate_Parms ClearWritePlayerStorageCompleteDelegate_Parms;
 	ClearWritePlayerStorageCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -5580,10 +4785,9 @@ void USFXOnlineComponentUnrealPlayer::ClearWritePlayerStorageCompleteDelegate (
 
 void USFXOnlineComponentUnrealPlayer::AddWritePlayerStorageCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate WritePlayerStorageCompleteDelegate )
 {
-	static UFunction* pFnAddWritePlayerStorageCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddWritePlayerStorageCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddWritePlayerStorageCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddWritePlayerStorageCompleteDelegate )
-		pFnAddWritePlayerStorageCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddWritePlayerStorageCompleteDelegate" );
+	UFunction* const pFnAddWritePlayerStorageCompleteDelegate = pFnAddWritePlayerStorageCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddWritePlayerStorageCompleteDelegate_Parms AddWritePlayerStorageCompleteDelegate_Parms;
 	AddWritePlayerStorageCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -5600,10 +4804,9 @@ void USFXOnlineComponentUnrealPlayer::AddWritePlayerStorageCompleteDelegate ( un
 
 void USFXOnlineComponentUnrealPlayer::OnWritePlayerStorageComplete ( unsigned char LocalUserNum, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnWritePlayerStorageComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnWritePlayerStorageCompleteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnWritePlayerStorageComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnWritePlayerStorageComplete )
-		pFnOnWritePlayerStorageComplete = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnWritePlayerStorageComplete" );
+	UFunction* const pFnOnWritePlayerStorageComplete = pFnOnWritePlayerStorageCompleteRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnWritePlayerStorageComplete_Parms OnWritePlayerStorageComplete_Parms;
 	OnWritePlayerStorageComplete_Parms.LocalUserNum = LocalUserNum;
@@ -5621,20 +4824,16 @@ void USFXOnlineComponentUnrealPlayer::OnWritePlayerStorageComplete ( unsigned ch
 
 bool USFXOnlineComponentUnrealPlayer::WritePlayerStorage ( unsigned char LocalUserNum, class UOnlinePlayerStorage* PlayerStorage )
 {
-	static UFunction* pFnWritePlayerStorage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWritePlayerStorageRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.WritePlayerStorage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWritePlayerStorage )
-		pFnWritePlayerStorage = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.WritePlayerStorage" );
+	UFunction* const pFnWritePlayerStorage = pFnWritePlayerStorageRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execWritePlayerStorage_Parms WritePlayerStorage_Parms;
 	WritePlayerStorage_Parms.LocalUserNum = LocalUserNum;
 	WritePlayerStorage_Parms.PlayerStorage = PlayerStorage;
 
-	pFnWritePlayerStorage->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWritePlayerStorage, &WritePlayerStorage_Parms, NULL );
-
-	pFnWritePlayerStorage->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWritePlayerStorage, &WritePlayerStorage_Parms ) )
+		this->ProcessEvent ( pFnWritePlayerStorage, &WritePlayerStorage_Parms, NULL );
 
 	return WritePlayerStorage_Parms.ReturnValue;
 };
@@ -5647,10 +4846,9 @@ bool USFXOnlineComponentUnrealPlayer::WritePlayerStorage ( unsigned char LocalUs
 
 class UOnlinePlayerStorage* USFXOnlineComponentUnrealPlayer::GetPlayerStorage ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnGetPlayerStorage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPlayerStorageRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetPlayerStorage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPlayerStorage )
-		pFnGetPlayerStorage = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetPlayerStorage" );
+	UFunction* const pFnGetPlayerStorage = pFnGetPlayerStorageRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execGetPlayerStorage_Parms GetPlayerStorage_Parms;
 	GetPlayerStorage_Parms.LocalUserNum = LocalUserNum;
@@ -5668,10 +4866,9 @@ class UOnlinePlayerStorage* USFXOnlineComponentUnrealPlayer::GetPlayerStorage (
 
 void USFXOnlineComponentUnrealPlayer::ClearReadPlayerStorageForNetIdCompleteDelegate ( struct FUniqueNetId const& NetId, struct FScriptDelegate ReadPlayerStorageForNetIdCompleteDelegate )
 {
-	static UFunction* pFnClearReadPlayerStorageForNetIdCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearReadPlayerStorageForNetIdCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadPlayerStorageForNetIdCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearReadPlayerStorageForNetIdCompleteDelegate )
-		pFnClearReadPlayerStorageForNetIdCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadPlayerStorageForNetIdCompleteDelegate" );
+	UFunction* const pFnClearReadPlayerStorageForNetIdCompleteDelegate = pFnClearReadPlayerStorageForNetIdCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearReadPlayerStorageForNetIdCompleteDelegate_Parms ClearReadPlayerStorageForNetIdCompleteDelegate_Parms;
 	memcpy ( &ClearReadPlayerStorageForNetIdCompleteDelegate_Parms.NetId, &NetId, 0x8 );
@@ -5688,10 +4885,9 @@ void USFXOnlineComponentUnrealPlayer::ClearReadPlayerStorageForNetIdCompleteDele
 
 void USFXOnlineComponentUnrealPlayer::AddReadPlayerStorageForNetIdCompleteDelegate ( struct FUniqueNetId const& NetId, struct FScriptDelegate ReadPlayerStorageForNetIdCompleteDelegate )
 {
-	static UFunction* pFnAddReadPlayerStorageForNetIdCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddReadPlayerStorageForNetIdCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadPlayerStorageForNetIdCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddReadPlayerStorageForNetIdCompleteDelegate )
-		pFnAddReadPlayerStorageForNetIdCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadPlayerStorageForNetIdCompleteDelegate" );
+	UFunction* const pFnAddReadPlayerStorageForNetIdCompleteDelegate = pFnAddReadPlayerStorageForNetIdCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddReadPlayerStorageForNetIdCompleteDelegate_Parms AddReadPlayerStorageForNetIdCompleteDelegate_Parms;
 	memcpy ( &AddReadPlayerStorageForNetIdCompleteDelegate_Parms.NetId, &NetId, 0x8 );
@@ -5708,10 +4904,9 @@ void USFXOnlineComponentUnrealPlayer::AddReadPlayerStorageForNetIdCompleteDelega
 
 void USFXOnlineComponentUnrealPlayer::OnReadPlayerStorageForNetIdComplete ( struct FUniqueNetId const& NetId, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnReadPlayerStorageForNetIdComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReadPlayerStorageForNetIdCompleteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadPlayerStorageForNetIdComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReadPlayerStorageForNetIdComplete )
-		pFnOnReadPlayerStorageForNetIdComplete = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadPlayerStorageForNetIdComplete" );
+	UFunction* const pFnOnReadPlayerStorageForNetIdComplete = pFnOnReadPlayerStorageForNetIdCompleteRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnReadPlayerStorageForNetIdComplete_Parms OnReadPlayerStorageForNetIdComplete_Parms;
 	memcpy ( &OnReadPlayerStorageForNetIdComplete_Parms.NetId, &NetId, 0x8 );
@@ -5729,20 +4924,16 @@ void USFXOnlineComponentUnrealPlayer::OnReadPlayerStorageForNetIdComplete ( stru
 
 bool USFXOnlineComponentUnrealPlayer::ReadPlayerStorageForNetId ( struct FUniqueNetId const& NetId, class UOnlinePlayerStorage* PlayerStorage )
 {
-	static UFunction* pFnReadPlayerStorageForNetId = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReadPlayerStorageForNetIdRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadPlayerStorageForNetId", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReadPlayerStorageForNetId )
-		pFnReadPlayerStorageForNetId = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadPlayerStorageForNetId" );
+	UFunction* const pFnReadPlayerStorageForNetId = pFnReadPlayerStorageForNetIdRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execReadPlayerStorageForNetId_Parms ReadPlayerStorageForNetId_Parms;
 	memcpy ( &ReadPlayerStorageForNetId_Parms.NetId, &NetId, 0x8 );
 	ReadPlayerStorageForNetId_Parms.PlayerStorage = PlayerStorage;
 
-	pFnReadPlayerStorageForNetId->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnReadPlayerStorageForNetId, &ReadPlayerStorageForNetId_Parms, NULL );
-
-	pFnReadPlayerStorageForNetId->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnReadPlayerStorageForNetId, &ReadPlayerStorageForNetId_Parms ) )
+		this->ProcessEvent ( pFnReadPlayerStorageForNetId, &ReadPlayerStorageForNetId_Parms, NULL );
 
 	return ReadPlayerStorageForNetId_Parms.ReturnValue;
 };
@@ -5755,10 +4946,9 @@ bool USFXOnlineComponentUnrealPlayer::ReadPlayerStorageForNetId ( struct FUnique
 
 void USFXOnlineComponentUnrealPlayer::ClearReadPlayerStorageCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadPlayerStorageCompleteDelegate )
 {
-	static UFunction* pFnClearReadPlayerStorageCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearReadPlayerStorageCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadPlayerStorageCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearReadPlayerStorageCompleteDelegate )
-		pFnClearReadPlayerStorageCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadPlayerStorageCompleteDelegate" );
+	UFunction* const pFnClearReadPlayerStorageCompleteDelegate = pFnClearReadPlayerStorageCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearReadPlayerStorageCompleteDelegate_Parms ClearReadPlayerStorageCompleteDelegate_Parms;
 	ClearReadPlayerStorageCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -5775,10 +4965,9 @@ void USFXOnlineComponentUnrealPlayer::ClearReadPlayerStorageCompleteDelegate ( u
 
 void USFXOnlineComponentUnrealPlayer::AddReadPlayerStorageCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadPlayerStorageCompleteDelegate )
 {
-	static UFunction* pFnAddReadPlayerStorageCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddReadPlayerStorageCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadPlayerStorageCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddReadPlayerStorageCompleteDelegate )
-		pFnAddReadPlayerStorageCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadPlayerStorageCompleteDelegate" );
+	UFunction* const pFnAddReadPlayerStorageCompleteDelegate = pFnAddReadPlayerStorageCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddReadPlayerStorageCompleteDelegate_Parms AddReadPlayerStorageCompleteDelegate_Parms;
 	AddReadPlayerStorageCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -5795,10 +4984,9 @@ void USFXOnlineComponentUnrealPlayer::AddReadPlayerStorageCompleteDelegate ( uns
 
 void USFXOnlineComponentUnrealPlayer::OnReadPlayerStorageComplete ( unsigned char LocalUserNum, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnReadPlayerStorageComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReadPlayerStorageCompleteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadPlayerStorageComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReadPlayerStorageComplete )
-		pFnOnReadPlayerStorageComplete = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadPlayerStorageComplete" );
+	UFunction* const pFnOnReadPlayerStorageComplete = pFnOnReadPlayerStorageCompleteRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnReadPlayerStorageComplete_Parms OnReadPlayerStorageComplete_Parms;
 	OnReadPlayerStorageComplete_Parms.LocalUserNum = LocalUserNum;
@@ -5816,20 +5004,16 @@ void USFXOnlineComponentUnrealPlayer::OnReadPlayerStorageComplete ( unsigned cha
 
 bool USFXOnlineComponentUnrealPlayer::ReadPlayerStorage ( unsigned char LocalUserNum, class UOnlinePlayerStorage* PlayerStorage )
 {
-	static UFunction* pFnReadPlayerStorage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReadPlayerStorageRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadPlayerStorage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReadPlayerStorage )
-		pFnReadPlayerStorage = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadPlayerStorage" );
+	UFunction* const pFnReadPlayerStorage = pFnReadPlayerStorageRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execReadPlayerStorage_Parms ReadPlayerStorage_Parms;
 	ReadPlayerStorage_Parms.LocalUserNum = LocalUserNum;
 	ReadPlayerStorage_Parms.PlayerStorage = PlayerStorage;
 
-	pFnReadPlayerStorage->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnReadPlayerStorage, &ReadPlayerStorage_Parms, NULL );
-
-	pFnReadPlayerStorage->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnReadPlayerStorage, &ReadPlayerStorage_Parms ) )
+		this->ProcessEvent ( pFnReadPlayerStorage, &ReadPlayerStorage_Parms, NULL );
 
 	return ReadPlayerStorage_Parms.ReturnValue;
 };
@@ -5842,10 +5026,9 @@ bool USFXOnlineComponentUnrealPlayer::ReadPlayerStorage ( unsigned char LocalUse
 
 void USFXOnlineComponentUnrealPlayer::ClearWriteProfileSettingsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate WriteProfileSettingsCompleteDelegate )
 {
-	static UFunction* pFnClearWriteProfileSettingsCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearWriteProfileSettingsCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearWriteProfileSettingsCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearWriteProfileSettingsCompleteDelegate )
-		pFnClearWriteProfileSettingsCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearWriteProfileSettingsCompleteDelegate" );
+	UFunction* const pFnClearWriteProfileSettingsCompleteDelegate = pFnClearWriteProfileSettingsCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearWriteProfileSettingsCompleteDelegate_Parms ClearWriteProfileSettingsCompleteDelegate_Parms;
 	ClearWriteProfileSettingsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -5862,10 +5045,9 @@ void USFXOnlineComponentUnrealPlayer::ClearWriteProfileSettingsCompleteDelegate
 
 void USFXOnlineComponentUnrealPlayer::AddWriteProfileSettingsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate WriteProfileSettingsCompleteDelegate )
 {
-	static UFunction* pFnAddWriteProfileSettingsCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddWriteProfileSettingsCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddWriteProfileSettingsCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddWriteProfileSettingsCompleteDelegate )
-		pFnAddWriteProfileSettingsCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddWriteProfileSettingsCompleteDelegate" );
+	UFunction* const pFnAddWriteProfileSettingsCompleteDelegate = pFnAddWriteProfileSettingsCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddWriteProfileSettingsCompleteDelegate_Parms AddWriteProfileSettingsCompleteDelegate_Parms;
 	AddWriteProfileSettingsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -5882,10 +5064,9 @@ void USFXOnlineComponentUnrealPlayer::AddWriteProfileSettingsCompleteDelegate (
 
 void USFXOnlineComponentUnrealPlayer::OnWriteProfileSettingsComplete ( unsigned char LocalUserNum, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnWriteProfileSettingsComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnWriteProfileSettingsCompleteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnWriteProfileSettingsComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnWriteProfileSettingsComplete )
-		pFnOnWriteProfileSettingsComplete = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnWriteProfileSettingsComplete" );
+	UFunction* const pFnOnWriteProfileSettingsComplete = pFnOnWriteProfileSettingsCompleteRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnWriteProfileSettingsComplete_Parms OnWriteProfileSettingsComplete_Parms;
 	OnWriteProfileSettingsComplete_Parms.LocalUserNum = LocalUserNum;
@@ -5904,21 +5085,17 @@ void USFXOnlineComponentUnrealPlayer::OnWriteProfileSettingsComplete ( unsigned
 
 bool USFXOnlineComponentUnrealPlayer::WriteProfileSettings ( unsigned char LocalUserNum, class UOnlineProfileSettings* ProfileSettings, unsigned long bIsTrilogyProfile )
 {
-	static UFunction* pFnWriteProfileSettings = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWriteProfileSettingsRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.WriteProfileSettings", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWriteProfileSettings )
-		pFnWriteProfileSettings = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.WriteProfileSettings" );
+	UFunction* const pFnWriteProfileSettings = pFnWriteProfileSettingsRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execWriteProfileSettings_Parms WriteProfileSettings_Parms;
 	WriteProfileSettings_Parms.LocalUserNum = LocalUserNum;
 	WriteProfileSettings_Parms.ProfileSettings = ProfileSettings;
 	WriteProfileSettings_Parms.bIsTrilogyProfile = bIsTrilogyProfile;
 
-	pFnWriteProfileSettings->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWriteProfileSettings, &WriteProfileSettings_Parms, NULL );
-
-	pFnWriteProfileSettings->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWriteProfileSettings, &WriteProfileSettings_Parms ) )
+		this->ProcessEvent ( pFnWriteProfileSettings, &WriteProfileSettings_Parms, NULL );
 
 	return WriteProfileSettings_Parms.ReturnValue;
 };
@@ -5931,10 +5108,9 @@ bool USFXOnlineComponentUnrealPlayer::WriteProfileSettings ( unsigned char Local
 
 class UOnlineProfileSettings* USFXOnlineComponentUnrealPlayer::GetProfileSettings ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnGetProfileSettings = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetProfileSettingsRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetProfileSettings", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetProfileSettings )
-		pFnGetProfileSettings = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetProfileSettings" );
+	UFunction* const pFnGetProfileSettings = pFnGetProfileSettingsRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execGetProfileSettings_Parms GetProfileSettings_Parms;
 	GetProfileSettings_Parms.LocalUserNum = LocalUserNum;
@@ -5952,10 +5128,9 @@ class UOnlineProfileSettings* USFXOnlineComponentUnrealPlayer::GetProfileSetting
 
 void USFXOnlineComponentUnrealPlayer::ClearReadProfileSettingsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadProfileSettingsCompleteDelegate )
 {
-	static UFunction* pFnClearReadProfileSettingsCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearReadProfileSettingsCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadProfileSettingsCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearReadProfileSettingsCompleteDelegate )
-		pFnClearReadProfileSettingsCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadProfileSettingsCompleteDelegate" );
+	UFunction* const pFnClearReadProfileSettingsCompleteDelegate = pFnClearReadProfileSettingsCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearReadProfileSettingsCompleteDelegate_Parms ClearReadProfileSettingsCompleteDelegate_Parms;
 	ClearReadProfileSettingsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -5972,10 +5147,9 @@ void USFXOnlineComponentUnrealPlayer::ClearReadProfileSettingsCompleteDelegate (
 
 void USFXOnlineComponentUnrealPlayer::AddReadProfileSettingsCompleteDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ReadProfileSettingsCompleteDelegate )
 {
-	static UFunction* pFnAddReadProfileSettingsCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddReadProfileSettingsCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadProfileSettingsCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddReadProfileSettingsCompleteDelegate )
-		pFnAddReadProfileSettingsCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadProfileSettingsCompleteDelegate" );
+	UFunction* const pFnAddReadProfileSettingsCompleteDelegate = pFnAddReadProfileSettingsCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddReadProfileSettingsCompleteDelegate_Parms AddReadProfileSettingsCompleteDelegate_Parms;
 	AddReadProfileSettingsCompleteDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -5992,10 +5166,9 @@ void USFXOnlineComponentUnrealPlayer::AddReadProfileSettingsCompleteDelegate ( u
 
 void USFXOnlineComponentUnrealPlayer::OnReadProfileSettingsComplete ( unsigned char LocalUserNum, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnReadProfileSettingsComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReadProfileSettingsCompleteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadProfileSettingsComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReadProfileSettingsComplete )
-		pFnOnReadProfileSettingsComplete = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadProfileSettingsComplete" );
+	UFunction* const pFnOnReadProfileSettingsComplete = pFnOnReadProfileSettingsCompleteRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnReadProfileSettingsComplete_Parms OnReadProfileSettingsComplete_Parms;
 	OnReadProfileSettingsComplete_Parms.LocalUserNum = LocalUserNum;
@@ -6014,21 +5187,17 @@ void USFXOnlineComponentUnrealPlayer::OnReadProfileSettingsComplete ( unsigned c
 
 bool USFXOnlineComponentUnrealPlayer::ReadProfileSettings ( unsigned char LocalUserNum, class UOnlineProfileSettings* ProfileSettings, unsigned long bIsTrilogyProfile )
 {
-	static UFunction* pFnReadProfileSettings = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReadProfileSettingsRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadProfileSettings", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReadProfileSettings )
-		pFnReadProfileSettings = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadProfileSettings" );
+	UFunction* const pFnReadProfileSettings = pFnReadProfileSettingsRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execReadProfileSettings_Parms ReadProfileSettings_Parms;
 	ReadProfileSettings_Parms.LocalUserNum = LocalUserNum;
 	ReadProfileSettings_Parms.ProfileSettings = ProfileSettings;
 	ReadProfileSettings_Parms.bIsTrilogyProfile = bIsTrilogyProfile;
 
-	pFnReadProfileSettings->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnReadProfileSettings, &ReadProfileSettings_Parms, NULL );
-
-	pFnReadProfileSettings->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnReadProfileSettings, &ReadProfileSettings_Parms ) )
+		this->ProcessEvent ( pFnReadProfileSettings, &ReadProfileSettings_Parms, NULL );
 
 	return ReadProfileSettings_Parms.ReturnValue;
 };
@@ -6041,10 +5210,9 @@ bool USFXOnlineComponentUnrealPlayer::ReadProfileSettings ( unsigned char LocalU
 
 void USFXOnlineComponentUnrealPlayer::ClearFriendsChangeDelegate ( unsigned char LocalUserNum, struct FScriptDelegate FriendsDelegate )
 {
-	static UFunction* pFnClearFriendsChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearFriendsChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearFriendsChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearFriendsChangeDelegate )
-		pFnClearFriendsChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearFriendsChangeDelegate" );
+	UFunction* const pFnClearFriendsChangeDelegate = pFnClearFriendsChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearFriendsChangeDelegate_Parms ClearFriendsChangeDelegate_Parms;
 	ClearFriendsChangeDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -6061,10 +5229,9 @@ void USFXOnlineComponentUnrealPlayer::ClearFriendsChangeDelegate ( unsigned char
 
 void USFXOnlineComponentUnrealPlayer::AddFriendsChangeDelegate ( unsigned char LocalUserNum, struct FScriptDelegate FriendsDelegate )
 {
-	static UFunction* pFnAddFriendsChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddFriendsChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendsChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddFriendsChangeDelegate )
-		pFnAddFriendsChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendsChangeDelegate" );
+	UFunction* const pFnAddFriendsChangeDelegate = pFnAddFriendsChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddFriendsChangeDelegate_Parms AddFriendsChangeDelegate_Parms;
 	AddFriendsChangeDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -6080,10 +5247,9 @@ void USFXOnlineComponentUnrealPlayer::AddFriendsChangeDelegate ( unsigned char L
 
 void USFXOnlineComponentUnrealPlayer::ClearMutingChangeDelegate ( struct FScriptDelegate MutingDelegate )
 {
-	static UFunction* pFnClearMutingChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearMutingChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearMutingChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearMutingChangeDelegate )
-		pFnClearMutingChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearMutingChangeDelegate" );
+	UFunction* const pFnClearMutingChangeDelegate = pFnClearMutingChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearMutingChangeDelegate_Parms ClearMutingChangeDelegate_Parms;
 	memcpy ( &ClearMutingChangeDelegate_Parms.MutingDelegate, &MutingDelegate, 0x10 );
@@ -6098,10 +5264,9 @@ void USFXOnlineComponentUnrealPlayer::ClearMutingChangeDelegate ( struct FScript
 
 void USFXOnlineComponentUnrealPlayer::AddMutingChangeDelegate ( struct FScriptDelegate MutingDelegate )
 {
-	static UFunction* pFnAddMutingChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddMutingChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddMutingChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddMutingChangeDelegate )
-		pFnAddMutingChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddMutingChangeDelegate" );
+	UFunction* const pFnAddMutingChangeDelegate = pFnAddMutingChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddMutingChangeDelegate_Parms AddMutingChangeDelegate_Parms;
 	memcpy ( &AddMutingChangeDelegate_Parms.MutingDelegate, &MutingDelegate, 0x10 );
@@ -6116,10 +5281,9 @@ void USFXOnlineComponentUnrealPlayer::AddMutingChangeDelegate ( struct FScriptDe
 
 void USFXOnlineComponentUnrealPlayer::ClearLoginCancelledDelegate ( struct FScriptDelegate CancelledDelegate )
 {
-	static UFunction* pFnClearLoginCancelledDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearLoginCancelledDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginCancelledDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearLoginCancelledDelegate )
-		pFnClearLoginCancelledDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginCancelledDelegate" );
+	UFunction* const pFnClearLoginCancelledDelegate = pFnClearLoginCancelledDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearLoginCancelledDelegate_Parms ClearLoginCancelledDelegate_Parms;
 	memcpy ( &ClearLoginCancelledDelegate_Parms.CancelledDelegate, &CancelledDelegate, 0x10 );
@@ -6134,10 +5298,9 @@ void USFXOnlineComponentUnrealPlayer::ClearLoginCancelledDelegate ( struct FScri
 
 void USFXOnlineComponentUnrealPlayer::AddLoginCancelledDelegate ( struct FScriptDelegate CancelledDelegate )
 {
-	static UFunction* pFnAddLoginCancelledDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddLoginCancelledDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginCancelledDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddLoginCancelledDelegate )
-		pFnAddLoginCancelledDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginCancelledDelegate" );
+	UFunction* const pFnAddLoginCancelledDelegate = pFnAddLoginCancelledDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddLoginCancelledDelegate_Parms AddLoginCancelledDelegate_Parms;
 	memcpy ( &AddLoginCancelledDelegate_Parms.CancelledDelegate, &CancelledDelegate, 0x10 );
@@ -6153,10 +5316,9 @@ void USFXOnlineComponentUnrealPlayer::AddLoginCancelledDelegate ( struct FScript
 
 void USFXOnlineComponentUnrealPlayer::ClearLoginStatusChangeDelegate ( struct FScriptDelegate LoginStatusDelegate, unsigned char LocalUserNum )
 {
-	static UFunction* pFnClearLoginStatusChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearLoginStatusChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginStatusChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearLoginStatusChangeDelegate )
-		pFnClearLoginStatusChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginStatusChangeDelegate" );
+	UFunction* const pFnClearLoginStatusChangeDelegate = pFnClearLoginStatusChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearLoginStatusChangeDelegate_Parms ClearLoginStatusChangeDelegate_Parms;
 	memcpy ( &ClearLoginStatusChangeDelegate_Parms.LoginStatusDelegate, &LoginStatusDelegate, 0x10 );
@@ -6173,10 +5335,9 @@ void USFXOnlineComponentUnrealPlayer::ClearLoginStatusChangeDelegate ( struct FS
 
 void USFXOnlineComponentUnrealPlayer::AddLoginStatusChangeDelegate ( struct FScriptDelegate LoginStatusDelegate, unsigned char LocalUserNum )
 {
-	static UFunction* pFnAddLoginStatusChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddLoginStatusChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginStatusChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddLoginStatusChangeDelegate )
-		pFnAddLoginStatusChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginStatusChangeDelegate" );
+	UFunction* const pFnAddLoginStatusChangeDelegate = pFnAddLoginStatusChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddLoginStatusChangeDelegate_Parms AddLoginStatusChangeDelegate_Parms;
 	memcpy ( &AddLoginStatusChangeDelegate_Parms.LoginStatusDelegate, &LoginStatusDelegate, 0x10 );
@@ -6193,10 +5354,9 @@ void USFXOnlineComponentUnrealPlayer::AddLoginStatusChangeDelegate ( struct FScr
 
 void USFXOnlineComponentUnrealPlayer::OnLoginStatusChange ( unsigned char NewStatus, struct FUniqueNetId const& NewId )
 {
-	static UFunction* pFnOnLoginStatusChange = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnLoginStatusChangeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginStatusChange", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnLoginStatusChange )
-		pFnOnLoginStatusChange = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginStatusChange" );
+	UFunction* const pFnOnLoginStatusChange = pFnOnLoginStatusChangeRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnLoginStatusChange_Parms OnLoginStatusChange_Parms;
 	OnLoginStatusChange_Parms.NewStatus = NewStatus;
@@ -6212,10 +5372,9 @@ void USFXOnlineComponentUnrealPlayer::OnLoginStatusChange ( unsigned char NewSta
 
 void USFXOnlineComponentUnrealPlayer::ClearLoginChangeDelegate ( struct FScriptDelegate LoginDelegate )
 {
-	static UFunction* pFnClearLoginChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearLoginChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearLoginChangeDelegate )
-		pFnClearLoginChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginChangeDelegate" );
+	UFunction* const pFnClearLoginChangeDelegate = pFnClearLoginChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearLoginChangeDelegate_Parms ClearLoginChangeDelegate_Parms;
 	memcpy ( &ClearLoginChangeDelegate_Parms.LoginDelegate, &LoginDelegate, 0x10 );
@@ -6230,10 +5389,9 @@ void USFXOnlineComponentUnrealPlayer::ClearLoginChangeDelegate ( struct FScriptD
 
 void USFXOnlineComponentUnrealPlayer::AddLoginChangeDelegate ( struct FScriptDelegate LoginDelegate )
 {
-	static UFunction* pFnAddLoginChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddLoginChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddLoginChangeDelegate )
-		pFnAddLoginChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginChangeDelegate" );
+	UFunction* const pFnAddLoginChangeDelegate = pFnAddLoginChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddLoginChangeDelegate_Parms AddLoginChangeDelegate_Parms;
 	memcpy ( &AddLoginChangeDelegate_Parms.LoginDelegate, &LoginDelegate, 0x10 );
@@ -6249,10 +5407,9 @@ void USFXOnlineComponentUnrealPlayer::AddLoginChangeDelegate ( struct FScriptDel
 
 bool USFXOnlineComponentUnrealPlayer::ShowFriendsUI ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnShowFriendsUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFriendsUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ShowFriendsUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFriendsUI )
-		pFnShowFriendsUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ShowFriendsUI" );
+	UFunction* const pFnShowFriendsUI = pFnShowFriendsUIRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execShowFriendsUI_Parms ShowFriendsUI_Parms;
 	ShowFriendsUI_Parms.LocalUserNum = LocalUserNum;
@@ -6271,10 +5428,9 @@ bool USFXOnlineComponentUnrealPlayer::ShowFriendsUI ( unsigned char LocalUserNum
 
 bool USFXOnlineComponentUnrealPlayer::IsMuted ( unsigned char LocalUserNum, struct FUniqueNetId const& PlayerID )
 {
-	static UFunction* pFnIsMuted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsMutedRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsMuted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsMuted )
-		pFnIsMuted = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsMuted" );
+	UFunction* const pFnIsMuted = pFnIsMutedRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execIsMuted_Parms IsMuted_Parms;
 	IsMuted_Parms.LocalUserNum = LocalUserNum;
@@ -6294,10 +5450,9 @@ bool USFXOnlineComponentUnrealPlayer::IsMuted ( unsigned char LocalUserNum, stru
 
 bool USFXOnlineComponentUnrealPlayer::AreAnyFriends ( unsigned char LocalUserNum, TArray<struct FFriendsQuery>* Query )
 {
-	static UFunction* pFnAreAnyFriends = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAreAnyFriendsRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AreAnyFriends", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAreAnyFriends )
-		pFnAreAnyFriends = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AreAnyFriends" );
+	UFunction* const pFnAreAnyFriends = pFnAreAnyFriendsRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAreAnyFriends_Parms AreAnyFriends_Parms;
 	AreAnyFriends_Parms.LocalUserNum = LocalUserNum;
@@ -6322,10 +5477,9 @@ bool USFXOnlineComponentUnrealPlayer::AreAnyFriends ( unsigned char LocalUserNum
 
 bool USFXOnlineComponentUnrealPlayer::IsFriend ( unsigned char LocalUserNum, struct FUniqueNetId const& PlayerID )
 {
-	static UFunction* pFnIsFriend = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsFriendRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsFriend", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsFriend )
-		pFnIsFriend = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsFriend" );
+	UFunction* const pFnIsFriend = pFnIsFriendRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execIsFriend_Parms IsFriend_Parms;
 	IsFriend_Parms.LocalUserNum = LocalUserNum;
@@ -6344,19 +5498,15 @@ bool USFXOnlineComponentUnrealPlayer::IsFriend ( unsigned char LocalUserNum, str
 
 unsigned char USFXOnlineComponentUnrealPlayer::CanShowPresenceInformation ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanShowPresenceInformationRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanShowPresenceInformation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanShowPresenceInformation" );
+	UFunction* const pFnCanShowPresenceInformation = pFnCanShowPresenceInformationRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.LocalUserNum = LocalUserNum;
 
-	pFnCanShowPresenceInformation->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
-
-	pFnCanShowPresenceInformation->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms ) )
+		this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
 
 	return CanShowPresenceInformation_Parms.ReturnValue;
 };
@@ -6369,19 +5519,15 @@ unsigned char USFXOnlineComponentUnrealPlayer::CanShowPresenceInformation ( unsi
 
 unsigned char USFXOnlineComponentUnrealPlayer::CanViewPlayerProfiles ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanViewPlayerProfilesRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanViewPlayerProfiles", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanViewPlayerProfiles" );
+	UFunction* const pFnCanViewPlayerProfiles = pFnCanViewPlayerProfilesRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.LocalUserNum = LocalUserNum;
 
-	pFnCanViewPlayerProfiles->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
-
-	pFnCanViewPlayerProfiles->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms ) )
+		this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
 
 	return CanViewPlayerProfiles_Parms.ReturnValue;
 };
@@ -6394,19 +5540,15 @@ unsigned char USFXOnlineComponentUnrealPlayer::CanViewPlayerProfiles ( unsigned
 
 unsigned char USFXOnlineComponentUnrealPlayer::CanPurchaseContent ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPurchaseContentRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanPurchaseContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanPurchaseContent" );
+	UFunction* const pFnCanPurchaseContent = pFnCanPurchaseContentRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.LocalUserNum = LocalUserNum;
 
-	pFnCanPurchaseContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
-
-	pFnCanPurchaseContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPurchaseContent, &CanPurchaseContent_Parms ) )
+		this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
 
 	return CanPurchaseContent_Parms.ReturnValue;
 };
@@ -6419,19 +5561,15 @@ unsigned char USFXOnlineComponentUnrealPlayer::CanPurchaseContent ( unsigned cha
 
 unsigned char USFXOnlineComponentUnrealPlayer::CanDownloadUserContent ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanDownloadUserContentRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanDownloadUserContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanDownloadUserContent" );
+	UFunction* const pFnCanDownloadUserContent = pFnCanDownloadUserContentRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.LocalUserNum = LocalUserNum;
 
-	pFnCanDownloadUserContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
-
-	pFnCanDownloadUserContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanDownloadUserContent, &CanDownloadUserContent_Parms ) )
+		this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
 
 	return CanDownloadUserContent_Parms.ReturnValue;
 };
@@ -6444,19 +5582,15 @@ unsigned char USFXOnlineComponentUnrealPlayer::CanDownloadUserContent ( unsigned
 
 unsigned char USFXOnlineComponentUnrealPlayer::CanCommunicate ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnCanCommunicate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanCommunicateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanCommunicate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanCommunicate" );
+	UFunction* const pFnCanCommunicate = pFnCanCommunicateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.LocalUserNum = LocalUserNum;
 
-	pFnCanCommunicate->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
-
-	pFnCanCommunicate->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanCommunicate, &CanCommunicate_Parms ) )
+		this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
 
 	return CanCommunicate_Parms.ReturnValue;
 };
@@ -6469,19 +5603,15 @@ unsigned char USFXOnlineComponentUnrealPlayer::CanCommunicate ( unsigned char Lo
 
 unsigned char USFXOnlineComponentUnrealPlayer::CanPlayOnline ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPlayOnlineRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanPlayOnline", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanPlayOnline" );
+	UFunction* const pFnCanPlayOnline = pFnCanPlayOnlineRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.LocalUserNum = LocalUserNum;
 
-	pFnCanPlayOnline->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
-
-	pFnCanPlayOnline->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPlayOnline, &CanPlayOnline_Parms ) )
+		this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
 
 	return CanPlayOnline_Parms.ReturnValue;
 };
@@ -6494,19 +5624,15 @@ unsigned char USFXOnlineComponentUnrealPlayer::CanPlayOnline ( unsigned char Loc
 
 bool USFXOnlineComponentUnrealPlayer::IsLocalLogin ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnIsLocalLogin = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsLocalLoginRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsLocalLogin", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsLocalLogin )
-		pFnIsLocalLogin = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsLocalLogin" );
+	UFunction* const pFnIsLocalLogin = pFnIsLocalLoginRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execIsLocalLogin_Parms IsLocalLogin_Parms;
 	IsLocalLogin_Parms.LocalUserNum = LocalUserNum;
 
-	pFnIsLocalLogin->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsLocalLogin, &IsLocalLogin_Parms, NULL );
-
-	pFnIsLocalLogin->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsLocalLogin, &IsLocalLogin_Parms ) )
+		this->ProcessEvent ( pFnIsLocalLogin, &IsLocalLogin_Parms, NULL );
 
 	return IsLocalLogin_Parms.ReturnValue;
 };
@@ -6519,19 +5645,15 @@ bool USFXOnlineComponentUnrealPlayer::IsLocalLogin ( unsigned char LocalUserNum
 
 bool USFXOnlineComponentUnrealPlayer::IsGuestLogin ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnIsGuestLogin = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsGuestLoginRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsGuestLogin", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsGuestLogin )
-		pFnIsGuestLogin = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsGuestLogin" );
+	UFunction* const pFnIsGuestLogin = pFnIsGuestLoginRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execIsGuestLogin_Parms IsGuestLogin_Parms;
 	IsGuestLogin_Parms.LocalUserNum = LocalUserNum;
 
-	pFnIsGuestLogin->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsGuestLogin, &IsGuestLogin_Parms, NULL );
-
-	pFnIsGuestLogin->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsGuestLogin, &IsGuestLogin_Parms ) )
+		this->ProcessEvent ( pFnIsGuestLogin, &IsGuestLogin_Parms, NULL );
 
 	return IsGuestLogin_Parms.ReturnValue;
 };
@@ -6544,19 +5666,15 @@ bool USFXOnlineComponentUnrealPlayer::IsGuestLogin ( unsigned char LocalUserNum
 
 FString USFXOnlineComponentUnrealPlayer::GetPlayerNickname ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnGetPlayerNickname = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPlayerNicknameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetPlayerNickname", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPlayerNickname )
-		pFnGetPlayerNickname = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetPlayerNickname" );
+	UFunction* const pFnGetPlayerNickname = pFnGetPlayerNicknameRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execGetPlayerNickname_Parms GetPlayerNickname_Parms;
 	GetPlayerNickname_Parms.LocalUserNum = LocalUserNum;
 
-	pFnGetPlayerNickname->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetPlayerNickname, &GetPlayerNickname_Parms, NULL );
-
-	pFnGetPlayerNickname->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetPlayerNickname, &GetPlayerNickname_Parms ) )
+		this->ProcessEvent ( pFnGetPlayerNickname, &GetPlayerNickname_Parms, NULL );
 
 	return GetPlayerNickname_Parms.ReturnValue;
 };
@@ -6570,10 +5688,9 @@ FString USFXOnlineComponentUnrealPlayer::GetPlayerNickname ( unsigned char Local
 
 bool USFXOnlineComponentUnrealPlayer::GetUniquePlayerId ( unsigned char LocalUserNum, struct FUniqueNetId* PlayerID )
 {
-	static UFunction* pFnGetUniquePlayerId = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUniquePlayerIdRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetUniquePlayerId", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUniquePlayerId )
-		pFnGetUniquePlayerId = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetUniquePlayerId" );
+	UFunction* const pFnGetUniquePlayerId = pFnGetUniquePlayerIdRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execGetUniquePlayerId_Parms GetUniquePlayerId_Parms;
 	GetUniquePlayerId_Parms.LocalUserNum = LocalUserNum;
@@ -6581,11 +5698,8 @@ bool USFXOnlineComponentUnrealPlayer::GetUniquePlayerId ( unsigned char LocalUse
 	if ( PlayerID )
 		memcpy ( &GetUniquePlayerId_Parms.PlayerID, PlayerID, 0x8 );
 
-	pFnGetUniquePlayerId->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetUniquePlayerId, &GetUniquePlayerId_Parms, NULL );
-
-	pFnGetUniquePlayerId->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetUniquePlayerId, &GetUniquePlayerId_Parms ) )
+		this->ProcessEvent ( pFnGetUniquePlayerId, &GetUniquePlayerId_Parms, NULL );
 
 	if ( PlayerID )
 		memcpy ( PlayerID, &GetUniquePlayerId_Parms.PlayerID, 0x8 );
@@ -6601,10 +5715,9 @@ bool USFXOnlineComponentUnrealPlayer::GetUniquePlayerId ( unsigned char LocalUse
 
 unsigned char USFXOnlineComponentUnrealPlayer::GetLoginStatus ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLoginStatusRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetLoginStatus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetLoginStatus" );
+	UFunction* const pFnGetLoginStatus = pFnGetLoginStatusRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execGetLoginStatus_Parms GetLoginStatus_Parms;
 	GetLoginStatus_Parms.LocalUserNum = LocalUserNum;
@@ -6622,10 +5735,9 @@ unsigned char USFXOnlineComponentUnrealPlayer::GetLoginStatus ( unsigned char Lo
 
 void USFXOnlineComponentUnrealPlayer::ClearLogoutCompletedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate LogoutDelegate )
 {
-	static UFunction* pFnClearLogoutCompletedDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearLogoutCompletedDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLogoutCompletedDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearLogoutCompletedDelegate )
-		pFnClearLogoutCompletedDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLogoutCompletedDelegate" );
+	UFunction* const pFnClearLogoutCompletedDelegate = pFnClearLogoutCompletedDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearLogoutCompletedDelegate_Parms ClearLogoutCompletedDelegate_Parms;
 	ClearLogoutCompletedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -6642,10 +5754,9 @@ void USFXOnlineComponentUnrealPlayer::ClearLogoutCompletedDelegate ( unsigned ch
 
 void USFXOnlineComponentUnrealPlayer::AddLogoutCompletedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate LogoutDelegate )
 {
-	static UFunction* pFnAddLogoutCompletedDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddLogoutCompletedDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLogoutCompletedDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddLogoutCompletedDelegate )
-		pFnAddLogoutCompletedDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLogoutCompletedDelegate" );
+	UFunction* const pFnAddLogoutCompletedDelegate = pFnAddLogoutCompletedDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddLogoutCompletedDelegate_Parms AddLogoutCompletedDelegate_Parms;
 	AddLogoutCompletedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -6661,10 +5772,9 @@ void USFXOnlineComponentUnrealPlayer::AddLogoutCompletedDelegate ( unsigned char
 
 void USFXOnlineComponentUnrealPlayer::OnLogoutCompleted ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnLogoutCompleted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnLogoutCompletedRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLogoutCompleted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnLogoutCompleted )
-		pFnOnLogoutCompleted = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLogoutCompleted" );
+	UFunction* const pFnOnLogoutCompleted = pFnOnLogoutCompletedRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnLogoutCompleted_Parms OnLogoutCompleted_Parms;
 	OnLogoutCompleted_Parms.bWasSuccessful = bWasSuccessful;
@@ -6680,19 +5790,15 @@ void USFXOnlineComponentUnrealPlayer::OnLogoutCompleted ( unsigned long bWasSucc
 
 bool USFXOnlineComponentUnrealPlayer::Logout ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnLogout = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLogoutRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.Logout", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLogout )
-		pFnLogout = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.Logout" );
+	UFunction* const pFnLogout = pFnLogoutRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execLogout_Parms Logout_Parms;
 	Logout_Parms.LocalUserNum = LocalUserNum;
 
-	pFnLogout->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLogout, &Logout_Parms, NULL );
-
-	pFnLogout->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnLogout, &Logout_Parms ) )
+		this->ProcessEvent ( pFnLogout, &Logout_Parms, NULL );
 
 	return Logout_Parms.ReturnValue;
 };
@@ -6705,10 +5811,9 @@ bool USFXOnlineComponentUnrealPlayer::Logout ( unsigned char LocalUserNum )
 
 void USFXOnlineComponentUnrealPlayer::ClearLoginFailedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate LoginDelegate )
 {
-	static UFunction* pFnClearLoginFailedDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearLoginFailedDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginFailedDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearLoginFailedDelegate )
-		pFnClearLoginFailedDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginFailedDelegate" );
+	UFunction* const pFnClearLoginFailedDelegate = pFnClearLoginFailedDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execClearLoginFailedDelegate_Parms ClearLoginFailedDelegate_Parms;
 	ClearLoginFailedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -6725,10 +5830,9 @@ void USFXOnlineComponentUnrealPlayer::ClearLoginFailedDelegate ( unsigned char L
 
 void USFXOnlineComponentUnrealPlayer::AddLoginFailedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate LoginDelegate )
 {
-	static UFunction* pFnAddLoginFailedDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddLoginFailedDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginFailedDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddLoginFailedDelegate )
-		pFnAddLoginFailedDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginFailedDelegate" );
+	UFunction* const pFnAddLoginFailedDelegate = pFnAddLoginFailedDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAddLoginFailedDelegate_Parms AddLoginFailedDelegate_Parms;
 	AddLoginFailedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -6745,10 +5849,9 @@ void USFXOnlineComponentUnrealPlayer::AddLoginFailedDelegate ( unsigned char Loc
 
 void USFXOnlineComponentUnrealPlayer::OnLoginFailed ( unsigned char LocalUserNum, unsigned char ErrorCode )
 {
-	static UFunction* pFnOnLoginFailed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnLoginFailedRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginFailed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnLoginFailed )
-		pFnOnLoginFailed = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginFailed" );
+	UFunction* const pFnOnLoginFailed = pFnOnLoginFailedRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnLoginFailed_Parms OnLoginFailed_Parms;
 	OnLoginFailed_Parms.LocalUserNum = LocalUserNum;
@@ -6764,18 +5867,14 @@ void USFXOnlineComponentUnrealPlayer::OnLoginFailed ( unsigned char LocalUserNum
 
 bool USFXOnlineComponentUnrealPlayer::AutoLogin ( )
 {
-	static UFunction* pFnAutoLogin = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAutoLoginRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AutoLogin", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAutoLogin )
-		pFnAutoLogin = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AutoLogin" );
+	UFunction* const pFnAutoLogin = pFnAutoLoginRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execAutoLogin_Parms AutoLogin_Parms;
 
-	pFnAutoLogin->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAutoLogin, &AutoLogin_Parms, NULL );
-
-	pFnAutoLogin->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAutoLogin, &AutoLogin_Parms ) )
+		this->ProcessEvent ( pFnAutoLogin, &AutoLogin_Parms, NULL );
 
 	return AutoLogin_Parms.ReturnValue;
 };
@@ -6791,10 +5890,9 @@ bool USFXOnlineComponentUnrealPlayer::AutoLogin ( )
 
 bool USFXOnlineComponentUnrealPlayer::Login ( unsigned char LocalUserNum, FString const& LoginName, FString const& Password, unsigned long bWantsLocalOnly )
 {
-	static UFunction* pFnLogin = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLoginRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.Login", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLogin )
-		pFnLogin = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.Login" );
+	UFunction* const pFnLogin = pFnLoginRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execLogin_Parms Login_Parms;
 	Login_Parms.LocalUserNum = LocalUserNum;
@@ -6802,11 +5900,8 @@ bool USFXOnlineComponentUnrealPlayer::Login ( unsigned char LocalUserNum, FStrin
 	memcpy ( &Login_Parms.Password, &Password, 0x10 );
 	Login_Parms.bWantsLocalOnly = bWantsLocalOnly;
 
-	pFnLogin->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLogin, &Login_Parms, NULL );
-
-	pFnLogin->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnLogin, &Login_Parms ) )
+		this->ProcessEvent ( pFnLogin, &Login_Parms, NULL );
 
 	return Login_Parms.ReturnValue;
 };
@@ -6819,19 +5914,15 @@ bool USFXOnlineComponentUnrealPlayer::Login ( unsigned char LocalUserNum, FStrin
 
 bool USFXOnlineComponentUnrealPlayer::ShowLoginUI ( unsigned long bShowOnlineOnly )
 {
-	static UFunction* pFnShowLoginUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowLoginUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ShowLoginUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowLoginUI )
-		pFnShowLoginUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ShowLoginUI" );
+	UFunction* const pFnShowLoginUI = pFnShowLoginUIRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execShowLoginUI_Parms ShowLoginUI_Parms;
 	ShowLoginUI_Parms.bShowOnlineOnly = bShowOnlineOnly;
 
-	pFnShowLoginUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowLoginUI, &ShowLoginUI_Parms, NULL );
-
-	pFnShowLoginUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowLoginUI, &ShowLoginUI_Parms ) )
+		this->ProcessEvent ( pFnShowLoginUI, &ShowLoginUI_Parms, NULL );
 
 	return ShowLoginUI_Parms.ReturnValue;
 };
@@ -6842,10 +5933,9 @@ bool USFXOnlineComponentUnrealPlayer::ShowLoginUI ( unsigned long bShowOnlineOnl
 
 void USFXOnlineComponentUnrealPlayer::OnFriendsChange ( )
 {
-	static UFunction* pFnOnFriendsChange = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnFriendsChangeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnFriendsChange", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnFriendsChange )
-		pFnOnFriendsChange = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnFriendsChange" );
+	UFunction* const pFnOnFriendsChange = pFnOnFriendsChangeRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnFriendsChange_Parms OnFriendsChange_Parms;
 
@@ -6858,10 +5948,9 @@ void USFXOnlineComponentUnrealPlayer::OnFriendsChange ( )
 
 void USFXOnlineComponentUnrealPlayer::OnMutingChange ( )
 {
-	static UFunction* pFnOnMutingChange = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnMutingChangeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnMutingChange", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnMutingChange )
-		pFnOnMutingChange = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnMutingChange" );
+	UFunction* const pFnOnMutingChange = pFnOnMutingChangeRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnMutingChange_Parms OnMutingChange_Parms;
 
@@ -6874,10 +5963,9 @@ void USFXOnlineComponentUnrealPlayer::OnMutingChange ( )
 
 void USFXOnlineComponentUnrealPlayer::OnLoginCancelled ( )
 {
-	static UFunction* pFnOnLoginCancelled = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnLoginCancelledRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginCancelled", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnLoginCancelled )
-		pFnOnLoginCancelled = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginCancelled" );
+	UFunction* const pFnOnLoginCancelled = pFnOnLoginCancelledRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnLoginCancelled_Parms OnLoginCancelled_Parms;
 
@@ -6891,10 +5979,9 @@ void USFXOnlineComponentUnrealPlayer::OnLoginCancelled ( )
 
 void USFXOnlineComponentUnrealPlayer::OnLoginChange ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnOnLoginChange = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnLoginChangeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginChange", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnLoginChange )
-		pFnOnLoginChange = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginChange" );
+	UFunction* const pFnOnLoginChange = pFnOnLoginChangeRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnLoginChange_Parms OnLoginChange_Parms;
 	OnLoginChange_Parms.LocalUserNum = LocalUserNum;
@@ -6908,10 +5995,9 @@ void USFXOnlineComponentUnrealPlayer::OnLoginChange ( unsigned char LocalUserNum
 
 void USFXOnlineComponentUnrealPlayer::OnProfileDataChanged ( )
 {
-	static UFunction* pFnOnProfileDataChanged = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnProfileDataChangedRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnProfileDataChanged", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnProfileDataChanged )
-		pFnOnProfileDataChanged = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnProfileDataChanged" );
+	UFunction* const pFnOnProfileDataChanged = pFnOnProfileDataChangedRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnProfileDataChanged_Parms OnProfileDataChanged_Parms;
 
@@ -6926,19 +6012,15 @@ void USFXOnlineComponentUnrealPlayer::OnProfileDataChanged ( )
 
 FString USFXOnlineComponentUnrealPlayer::CreateProfileName ( unsigned long bIsTrilogyProfile )
 {
-	static UFunction* pFnCreateProfileName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCreateProfileNameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CreateProfileName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCreateProfileName )
-		pFnCreateProfileName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CreateProfileName" );
+	UFunction* const pFnCreateProfileName = pFnCreateProfileNameRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execCreateProfileName_Parms CreateProfileName_Parms;
 	CreateProfileName_Parms.bIsTrilogyProfile = bIsTrilogyProfile;
 
-	pFnCreateProfileName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCreateProfileName, &CreateProfileName_Parms, NULL );
-
-	pFnCreateProfileName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCreateProfileName, &CreateProfileName_Parms ) )
+		this->ProcessEvent ( pFnCreateProfileName, &CreateProfileName_Parms, NULL );
 
 	return CreateProfileName_Parms.ReturnValue;
 };
@@ -6951,19 +6033,15 @@ FString USFXOnlineComponentUnrealPlayer::CreateProfileName ( unsigned long bIsTr
 
 bool USFXOnlineComponentUnrealPlayer::DoesProfileExist ( unsigned long bIsTrilogyProfile )
 {
-	static UFunction* pFnDoesProfileExist = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoesProfileExistRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.DoesProfileExist", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoesProfileExist )
-		pFnDoesProfileExist = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.DoesProfileExist" );
+	UFunction* const pFnDoesProfileExist = pFnDoesProfileExistRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execDoesProfileExist_Parms DoesProfileExist_Parms;
 	DoesProfileExist_Parms.bIsTrilogyProfile = bIsTrilogyProfile;
 
-	pFnDoesProfileExist->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDoesProfileExist, &DoesProfileExist_Parms, NULL );
-
-	pFnDoesProfileExist->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDoesProfileExist, &DoesProfileExist_Parms ) )
+		this->ProcessEvent ( pFnDoesProfileExist, &DoesProfileExist_Parms, NULL );
 
 	return DoesProfileExist_Parms.ReturnValue;
 };
@@ -6975,19 +6053,15 @@ bool USFXOnlineComponentUnrealPlayer::DoesProfileExist ( unsigned long bIsTrilog
 
 void USFXOnlineComponentUnrealPlayer::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnTickRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnTick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnTick )
-		pFnOnTick = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnTick" );
+	UFunction* const pFnOnTick = pFnOnTickRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
 
-	pFnOnTick->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
-
-	pFnOnTick->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnTick, &OnTick_Parms ) )
+		this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetAPIName
@@ -6997,18 +6071,14 @@ void USFXOnlineComponentUnrealPlayer::OnTick ( class USFXOnlineEvent* oEvent )
 
 struct SFXName USFXOnlineComponentUnrealPlayer::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -7019,18 +6089,14 @@ struct SFXName USFXOnlineComponentUnrealPlayer::GetAPIName ( )
 
 void USFXOnlineComponentUnrealPlayer::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnInitialize
@@ -7040,31 +6106,24 @@ void USFXOnlineComponentUnrealPlayer::OnRelease ( )
 
 void USFXOnlineComponentUnrealPlayer::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayer_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineComponentUnrealPlayerEx::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentUnrealPlayerEx::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentUnrealPlayerEx::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowCustomPlayersUI
@@ -7078,10 +6137,9 @@ class UClass* USFXOnlineComponentUnrealPlayerEx::StaticClass()
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowCustomPlayersUI ( unsigned char LocalUserNum, FString const& Title, FString const& Description, TArray<struct FUniqueNetId>* Players )
 {
-	static UFunction* pFnShowCustomPlayersUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowCustomPlayersUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowCustomPlayersUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowCustomPlayersUI )
-		pFnShowCustomPlayersUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowCustomPlayersUI" );
+	UFunction* const pFnShowCustomPlayersUI = pFnShowCustomPlayersUIRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execShowCustomPlayersUI_Parms ShowCustomPlayersUI_Parms;
 	ShowCustomPlayersUI_Parms.LocalUserNum = LocalUserNum;
@@ -7107,10 +6165,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowCustomPlayersUI ( unsigned char Loca
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowPlayersUI ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnShowPlayersUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowPlayersUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowPlayersUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowPlayersUI )
-		pFnShowPlayersUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowPlayersUI" );
+	UFunction* const pFnShowPlayersUI = pFnShowPlayersUIRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execShowPlayersUI_Parms ShowPlayersUI_Parms;
 	ShowPlayersUI_Parms.LocalUserNum = LocalUserNum;
@@ -7129,10 +6186,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowPlayersUI ( unsigned char LocalUserN
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowFriendsInviteUI ( unsigned char LocalUserNum, struct FUniqueNetId const& PlayerID )
 {
-	static UFunction* pFnShowFriendsInviteUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFriendsInviteUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowFriendsInviteUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFriendsInviteUI )
-		pFnShowFriendsInviteUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowFriendsInviteUI" );
+	UFunction* const pFnShowFriendsInviteUI = pFnShowFriendsInviteUIRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execShowFriendsInviteUI_Parms ShowFriendsInviteUI_Parms;
 	ShowFriendsInviteUI_Parms.LocalUserNum = LocalUserNum;
@@ -7151,10 +6207,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowFriendsInviteUI ( unsigned char Loca
 
 void USFXOnlineComponentUnrealPlayerEx::ClearProfileDataChangedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ProfileDataChangedDelegate )
 {
-	static UFunction* pFnClearProfileDataChangedDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearProfileDataChangedDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ClearProfileDataChangedDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearProfileDataChangedDelegate )
-		pFnClearProfileDataChangedDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ClearProfileDataChangedDelegate" );
+	UFunction* const pFnClearProfileDataChangedDelegate = pFnClearProfileDataChangedDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execClearProfileDataChangedDelegate_Parms ClearProfileDataChangedDelegate_Parms;
 	ClearProfileDataChangedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -7171,10 +6226,9 @@ void USFXOnlineComponentUnrealPlayerEx::ClearProfileDataChangedDelegate ( unsign
 
 void USFXOnlineComponentUnrealPlayerEx::AddProfileDataChangedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate ProfileDataChangedDelegate )
 {
-	static UFunction* pFnAddProfileDataChangedDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddProfileDataChangedDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.AddProfileDataChangedDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddProfileDataChangedDelegate )
-		pFnAddProfileDataChangedDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.AddProfileDataChangedDelegate" );
+	UFunction* const pFnAddProfileDataChangedDelegate = pFnAddProfileDataChangedDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execAddProfileDataChangedDelegate_Parms AddProfileDataChangedDelegate_Parms;
 	AddProfileDataChangedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -7189,10 +6243,9 @@ void USFXOnlineComponentUnrealPlayerEx::AddProfileDataChangedDelegate ( unsigned
 
 void USFXOnlineComponentUnrealPlayerEx::OnProfileDataChanged ( )
 {
-	static UFunction* pFnOnProfileDataChanged = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnProfileDataChangedRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnProfileDataChanged", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnProfileDataChanged )
-		pFnOnProfileDataChanged = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnProfileDataChanged" );
+	UFunction* const pFnOnProfileDataChanged = pFnOnProfileDataChangedRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execOnProfileDataChanged_Parms OnProfileDataChanged_Parms;
 
@@ -7208,10 +6261,9 @@ void USFXOnlineComponentUnrealPlayerEx::OnProfileDataChanged ( )
 
 bool USFXOnlineComponentUnrealPlayerEx::UnlockGamerPicture ( unsigned char LocalUserNum, int PictureId )
 {
-	static UFunction* pFnUnlockGamerPicture = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnlockGamerPictureRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.UnlockGamerPicture", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnlockGamerPicture )
-		pFnUnlockGamerPicture = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.UnlockGamerPicture" );
+	UFunction* const pFnUnlockGamerPicture = pFnUnlockGamerPictureRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execUnlockGamerPicture_Parms UnlockGamerPicture_Parms;
 	UnlockGamerPicture_Parms.LocalUserNum = LocalUserNum;
@@ -7231,20 +6283,16 @@ bool USFXOnlineComponentUnrealPlayerEx::UnlockGamerPicture ( unsigned char Local
 
 bool USFXOnlineComponentUnrealPlayerEx::IsDeviceValid ( int DeviceID, int SizeNeeded )
 {
-	static UFunction* pFnIsDeviceValid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsDeviceValidRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.IsDeviceValid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsDeviceValid )
-		pFnIsDeviceValid = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.IsDeviceValid" );
+	UFunction* const pFnIsDeviceValid = pFnIsDeviceValidRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execIsDeviceValid_Parms IsDeviceValid_Parms;
 	IsDeviceValid_Parms.DeviceID = DeviceID;
 	IsDeviceValid_Parms.SizeNeeded = SizeNeeded;
 
-	pFnIsDeviceValid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsDeviceValid, &IsDeviceValid_Parms, NULL );
-
-	pFnIsDeviceValid->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsDeviceValid, &IsDeviceValid_Parms ) )
+		this->ProcessEvent ( pFnIsDeviceValid, &IsDeviceValid_Parms, NULL );
 
 	return IsDeviceValid_Parms.ReturnValue;
 };
@@ -7258,10 +6306,9 @@ bool USFXOnlineComponentUnrealPlayerEx::IsDeviceValid ( int DeviceID, int SizeNe
 
 int USFXOnlineComponentUnrealPlayerEx::GetDeviceSelectionResults ( unsigned char LocalUserNum, FString* DeviceName )
 {
-	static UFunction* pFnGetDeviceSelectionResults = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDeviceSelectionResultsRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.GetDeviceSelectionResults", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDeviceSelectionResults )
-		pFnGetDeviceSelectionResults = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.GetDeviceSelectionResults" );
+	UFunction* const pFnGetDeviceSelectionResults = pFnGetDeviceSelectionResultsRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execGetDeviceSelectionResults_Parms GetDeviceSelectionResults_Parms;
 	GetDeviceSelectionResults_Parms.LocalUserNum = LocalUserNum;
@@ -7269,11 +6316,8 @@ int USFXOnlineComponentUnrealPlayerEx::GetDeviceSelectionResults ( unsigned char
 	if ( DeviceName )
 		memcpy ( &GetDeviceSelectionResults_Parms.DeviceName, DeviceName, 0x10 );
 
-	pFnGetDeviceSelectionResults->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetDeviceSelectionResults, &GetDeviceSelectionResults_Parms, NULL );
-
-	pFnGetDeviceSelectionResults->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetDeviceSelectionResults, &GetDeviceSelectionResults_Parms ) )
+		this->ProcessEvent ( pFnGetDeviceSelectionResults, &GetDeviceSelectionResults_Parms, NULL );
 
 	if ( DeviceName )
 		memcpy ( DeviceName, &GetDeviceSelectionResults_Parms.DeviceName, 0x10 );
@@ -7289,10 +6333,9 @@ int USFXOnlineComponentUnrealPlayerEx::GetDeviceSelectionResults ( unsigned char
 
 void USFXOnlineComponentUnrealPlayerEx::ClearDeviceSelectionDoneDelegate ( unsigned char LocalUserNum, struct FScriptDelegate DeviceDelegate )
 {
-	static UFunction* pFnClearDeviceSelectionDoneDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearDeviceSelectionDoneDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ClearDeviceSelectionDoneDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearDeviceSelectionDoneDelegate )
-		pFnClearDeviceSelectionDoneDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ClearDeviceSelectionDoneDelegate" );
+	UFunction* const pFnClearDeviceSelectionDoneDelegate = pFnClearDeviceSelectionDoneDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execClearDeviceSelectionDoneDelegate_Parms ClearDeviceSelectionDoneDelegate_Parms;
 	ClearDeviceSelectionDoneDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -7309,10 +6352,9 @@ void USFXOnlineComponentUnrealPlayerEx::ClearDeviceSelectionDoneDelegate ( unsig
 
 void USFXOnlineComponentUnrealPlayerEx::AddDeviceSelectionDoneDelegate ( unsigned char LocalUserNum, struct FScriptDelegate DeviceDelegate )
 {
-	static UFunction* pFnAddDeviceSelectionDoneDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddDeviceSelectionDoneDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.AddDeviceSelectionDoneDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddDeviceSelectionDoneDelegate )
-		pFnAddDeviceSelectionDoneDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.AddDeviceSelectionDoneDelegate" );
+	UFunction* const pFnAddDeviceSelectionDoneDelegate = pFnAddDeviceSelectionDoneDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execAddDeviceSelectionDoneDelegate_Parms AddDeviceSelectionDoneDelegate_Parms;
 	AddDeviceSelectionDoneDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -7328,10 +6370,9 @@ void USFXOnlineComponentUnrealPlayerEx::AddDeviceSelectionDoneDelegate ( unsigne
 
 void USFXOnlineComponentUnrealPlayerEx::OnDeviceSelectionComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnDeviceSelectionComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnDeviceSelectionCompleteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnDeviceSelectionComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnDeviceSelectionComplete )
-		pFnOnDeviceSelectionComplete = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnDeviceSelectionComplete" );
+	UFunction* const pFnOnDeviceSelectionComplete = pFnOnDeviceSelectionCompleteRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execOnDeviceSelectionComplete_Parms OnDeviceSelectionComplete_Parms;
 	OnDeviceSelectionComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -7350,10 +6391,9 @@ void USFXOnlineComponentUnrealPlayerEx::OnDeviceSelectionComplete ( unsigned lon
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowDeviceSelectionUI ( unsigned char LocalUserNum, int SizeNeeded, unsigned long bForceShowUI, unsigned long bManageStorage )
 {
-	static UFunction* pFnShowDeviceSelectionUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowDeviceSelectionUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowDeviceSelectionUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowDeviceSelectionUI )
-		pFnShowDeviceSelectionUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowDeviceSelectionUI" );
+	UFunction* const pFnShowDeviceSelectionUI = pFnShowDeviceSelectionUIRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execShowDeviceSelectionUI_Parms ShowDeviceSelectionUI_Parms;
 	ShowDeviceSelectionUI_Parms.LocalUserNum = LocalUserNum;
@@ -7361,11 +6401,8 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowDeviceSelectionUI ( unsigned char Lo
 	ShowDeviceSelectionUI_Parms.bForceShowUI = bForceShowUI;
 	ShowDeviceSelectionUI_Parms.bManageStorage = bManageStorage;
 
-	pFnShowDeviceSelectionUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowDeviceSelectionUI, &ShowDeviceSelectionUI_Parms, NULL );
-
-	pFnShowDeviceSelectionUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowDeviceSelectionUI, &ShowDeviceSelectionUI_Parms ) )
+		this->ProcessEvent ( pFnShowDeviceSelectionUI, &ShowDeviceSelectionUI_Parms, NULL );
 
 	return ShowDeviceSelectionUI_Parms.ReturnValue;
 };
@@ -7378,10 +6415,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowDeviceSelectionUI ( unsigned char Lo
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowMembershipMarketplaceUI ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnShowMembershipMarketplaceUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowMembershipMarketplaceUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowMembershipMarketplaceUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowMembershipMarketplaceUI )
-		pFnShowMembershipMarketplaceUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowMembershipMarketplaceUI" );
+	UFunction* const pFnShowMembershipMarketplaceUI = pFnShowMembershipMarketplaceUIRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execShowMembershipMarketplaceUI_Parms ShowMembershipMarketplaceUI_Parms;
 	ShowMembershipMarketplaceUI_Parms.LocalUserNum = LocalUserNum;
@@ -7401,10 +6437,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowMembershipMarketplaceUI ( unsigned c
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowContentMarketplaceUI ( unsigned char LocalUserNum, int CategoryMask, int OfferId )
 {
-	static UFunction* pFnShowContentMarketplaceUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowContentMarketplaceUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowContentMarketplaceUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowContentMarketplaceUI )
-		pFnShowContentMarketplaceUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowContentMarketplaceUI" );
+	UFunction* const pFnShowContentMarketplaceUI = pFnShowContentMarketplaceUIRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execShowContentMarketplaceUI_Parms ShowContentMarketplaceUI_Parms;
 	ShowContentMarketplaceUI_Parms.LocalUserNum = LocalUserNum;
@@ -7425,10 +6460,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowContentMarketplaceUI ( unsigned char
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowInviteUI ( unsigned char LocalUserNum, FString const& InviteText )
 {
-	static UFunction* pFnShowInviteUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowInviteUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowInviteUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowInviteUI )
-		pFnShowInviteUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowInviteUI" );
+	UFunction* const pFnShowInviteUI = pFnShowInviteUIRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execShowInviteUI_Parms ShowInviteUI_Parms;
 	ShowInviteUI_Parms.LocalUserNum = LocalUserNum;
@@ -7447,10 +6481,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowInviteUI ( unsigned char LocalUserNu
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowAchievementsUI ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnShowAchievementsUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowAchievementsUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowAchievementsUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowAchievementsUI )
-		pFnShowAchievementsUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowAchievementsUI" );
+	UFunction* const pFnShowAchievementsUI = pFnShowAchievementsUIRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execShowAchievementsUI_Parms ShowAchievementsUI_Parms;
 	ShowAchievementsUI_Parms.LocalUserNum = LocalUserNum;
@@ -7468,10 +6501,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowAchievementsUI ( unsigned char Local
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowMessagesUI ( unsigned char LocalUserNum )
 {
-	static UFunction* pFnShowMessagesUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowMessagesUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowMessagesUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowMessagesUI )
-		pFnShowMessagesUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowMessagesUI" );
+	UFunction* const pFnShowMessagesUI = pFnShowMessagesUIRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execShowMessagesUI_Parms ShowMessagesUI_Parms;
 	ShowMessagesUI_Parms.LocalUserNum = LocalUserNum;
@@ -7490,10 +6522,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowMessagesUI ( unsigned char LocalUser
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowGamerCardUI ( unsigned char LocalUserNum, struct FUniqueNetId const& PlayerID )
 {
-	static UFunction* pFnShowGamerCardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowGamerCardUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowGamerCardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowGamerCardUI )
-		pFnShowGamerCardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowGamerCardUI" );
+	UFunction* const pFnShowGamerCardUI = pFnShowGamerCardUIRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execShowGamerCardUI_Parms ShowGamerCardUI_Parms;
 	ShowGamerCardUI_Parms.LocalUserNum = LocalUserNum;
@@ -7513,10 +6544,9 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowGamerCardUI ( unsigned char LocalUse
 
 bool USFXOnlineComponentUnrealPlayerEx::ShowFeedbackUI ( unsigned char LocalUserNum, struct FUniqueNetId const& PlayerID )
 {
-	static UFunction* pFnShowFeedbackUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFeedbackUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowFeedbackUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFeedbackUI )
-		pFnShowFeedbackUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowFeedbackUI" );
+	UFunction* const pFnShowFeedbackUI = pFnShowFeedbackUIRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execShowFeedbackUI_Parms ShowFeedbackUI_Parms;
 	ShowFeedbackUI_Parms.LocalUserNum = LocalUserNum;
@@ -7534,19 +6564,15 @@ bool USFXOnlineComponentUnrealPlayerEx::ShowFeedbackUI ( unsigned char LocalUser
 
 void USFXOnlineComponentUnrealPlayerEx::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnTickRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnTick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnTick )
-		pFnOnTick = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnTick" );
+	UFunction* const pFnOnTick = pFnOnTickRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
 
-	pFnOnTick->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
-
-	pFnOnTick->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnTick, &OnTick_Parms ) )
+		this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.GetAPIName
@@ -7556,18 +6582,14 @@ void USFXOnlineComponentUnrealPlayerEx::OnTick ( class USFXOnlineEvent* oEvent )
 
 struct SFXName USFXOnlineComponentUnrealPlayerEx::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -7578,18 +6600,14 @@ struct SFXName USFXOnlineComponentUnrealPlayerEx::GetAPIName ( )
 
 void USFXOnlineComponentUnrealPlayerEx::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnInitialize
@@ -7599,31 +6617,24 @@ void USFXOnlineComponentUnrealPlayerEx::OnRelease ( )
 
 void USFXOnlineComponentUnrealPlayerEx::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentUnrealPlayerEx_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineComponentUnrealSystem::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentUnrealSystem::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentUnrealSystem", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentUnrealSystem::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentUnrealSystem" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetTitleFileState
@@ -7634,10 +6645,9 @@ class UClass* USFXOnlineComponentUnrealSystem::StaticClass()
 
 unsigned char USFXOnlineComponentUnrealSystem::GetTitleFileState ( FString const& Filename )
 {
-	static UFunction* pFnGetTitleFileState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTitleFileStateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetTitleFileState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTitleFileState )
-		pFnGetTitleFileState = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetTitleFileState" );
+	UFunction* const pFnGetTitleFileState = pFnGetTitleFileStateRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execGetTitleFileState_Parms GetTitleFileState_Parms;
 	memcpy ( &GetTitleFileState_Parms.Filename, &Filename, 0x10 );
@@ -7656,10 +6666,9 @@ unsigned char USFXOnlineComponentUnrealSystem::GetTitleFileState ( FString const
 
 bool USFXOnlineComponentUnrealSystem::GetTitleFileContents ( FString const& Filename, TArray<unsigned char>* FileContents )
 {
-	static UFunction* pFnGetTitleFileContents = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTitleFileContentsRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetTitleFileContents", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTitleFileContents )
-		pFnGetTitleFileContents = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetTitleFileContents" );
+	UFunction* const pFnGetTitleFileContents = pFnGetTitleFileContentsRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execGetTitleFileContents_Parms GetTitleFileContents_Parms;
 	memcpy ( &GetTitleFileContents_Parms.Filename, &Filename, 0x10 );
@@ -7667,11 +6676,8 @@ bool USFXOnlineComponentUnrealSystem::GetTitleFileContents ( FString const& File
 	if ( FileContents )
 		memcpy ( &GetTitleFileContents_Parms.FileContents, FileContents, 0x10 );
 
-	pFnGetTitleFileContents->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetTitleFileContents, &GetTitleFileContents_Parms, NULL );
-
-	pFnGetTitleFileContents->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetTitleFileContents, &GetTitleFileContents_Parms ) )
+		this->ProcessEvent ( pFnGetTitleFileContents, &GetTitleFileContents_Parms, NULL );
 
 	if ( FileContents )
 		memcpy ( FileContents, &GetTitleFileContents_Parms.FileContents, 0x10 );
@@ -7686,10 +6692,9 @@ bool USFXOnlineComponentUnrealSystem::GetTitleFileContents ( FString const& File
 
 void USFXOnlineComponentUnrealSystem::ClearReadTitleFileCompleteDelegate ( struct FScriptDelegate ReadTitleFileCompleteDelegate )
 {
-	static UFunction* pFnClearReadTitleFileCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearReadTitleFileCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearReadTitleFileCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearReadTitleFileCompleteDelegate )
-		pFnClearReadTitleFileCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearReadTitleFileCompleteDelegate" );
+	UFunction* const pFnClearReadTitleFileCompleteDelegate = pFnClearReadTitleFileCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execClearReadTitleFileCompleteDelegate_Parms ClearReadTitleFileCompleteDelegate_Parms;
 	memcpy ( &ClearReadTitleFileCompleteDelegate_Parms.ReadTitleFileCompleteDelegate, &ReadTitleFileCompleteDelegate, 0x10 );
@@ -7704,10 +6709,9 @@ void USFXOnlineComponentUnrealSystem::ClearReadTitleFileCompleteDelegate ( struc
 
 void USFXOnlineComponentUnrealSystem::AddReadTitleFileCompleteDelegate ( struct FScriptDelegate ReadTitleFileCompleteDelegate )
 {
-	static UFunction* pFnAddReadTitleFileCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddReadTitleFileCompleteDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddReadTitleFileCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddReadTitleFileCompleteDelegate )
-		pFnAddReadTitleFileCompleteDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddReadTitleFileCompleteDelegate" );
+	UFunction* const pFnAddReadTitleFileCompleteDelegate = pFnAddReadTitleFileCompleteDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execAddReadTitleFileCompleteDelegate_Parms AddReadTitleFileCompleteDelegate_Parms;
 	memcpy ( &AddReadTitleFileCompleteDelegate_Parms.ReadTitleFileCompleteDelegate, &ReadTitleFileCompleteDelegate, 0x10 );
@@ -7723,19 +6727,15 @@ void USFXOnlineComponentUnrealSystem::AddReadTitleFileCompleteDelegate ( struct
 
 bool USFXOnlineComponentUnrealSystem::ReadTitleFile ( FString const& FileToRead )
 {
-	static UFunction* pFnReadTitleFile = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReadTitleFileRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ReadTitleFile", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReadTitleFile )
-		pFnReadTitleFile = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ReadTitleFile" );
+	UFunction* const pFnReadTitleFile = pFnReadTitleFileRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execReadTitleFile_Parms ReadTitleFile_Parms;
 	memcpy ( &ReadTitleFile_Parms.FileToRead, &FileToRead, 0x10 );
 
-	pFnReadTitleFile->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnReadTitleFile, &ReadTitleFile_Parms, NULL );
-
-	pFnReadTitleFile->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnReadTitleFile, &ReadTitleFile_Parms ) )
+		this->ProcessEvent ( pFnReadTitleFile, &ReadTitleFile_Parms, NULL );
 
 	return ReadTitleFile_Parms.ReturnValue;
 };
@@ -7748,10 +6748,9 @@ bool USFXOnlineComponentUnrealSystem::ReadTitleFile ( FString const& FileToRead
 
 void USFXOnlineComponentUnrealSystem::OnReadTitleFileComplete ( unsigned long bWasSuccessful, FString const& Filename )
 {
-	static UFunction* pFnOnReadTitleFileComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReadTitleFileCompleteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnReadTitleFileComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReadTitleFileComplete )
-		pFnOnReadTitleFileComplete = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnReadTitleFileComplete" );
+	UFunction* const pFnOnReadTitleFileComplete = pFnOnReadTitleFileCompleteRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execOnReadTitleFileComplete_Parms OnReadTitleFileComplete_Parms;
 	OnReadTitleFileComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -7767,10 +6766,9 @@ void USFXOnlineComponentUnrealSystem::OnReadTitleFileComplete ( unsigned long bW
 
 void USFXOnlineComponentUnrealSystem::ClearStorageDeviceChangeDelegate ( struct FScriptDelegate StorageDeviceChangeDelegate )
 {
-	static UFunction* pFnClearStorageDeviceChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearStorageDeviceChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearStorageDeviceChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearStorageDeviceChangeDelegate )
-		pFnClearStorageDeviceChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearStorageDeviceChangeDelegate" );
+	UFunction* const pFnClearStorageDeviceChangeDelegate = pFnClearStorageDeviceChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execClearStorageDeviceChangeDelegate_Parms ClearStorageDeviceChangeDelegate_Parms;
 	memcpy ( &ClearStorageDeviceChangeDelegate_Parms.StorageDeviceChangeDelegate, &StorageDeviceChangeDelegate, 0x10 );
@@ -7785,10 +6783,9 @@ void USFXOnlineComponentUnrealSystem::ClearStorageDeviceChangeDelegate ( struct
 
 void USFXOnlineComponentUnrealSystem::AddStorageDeviceChangeDelegate ( struct FScriptDelegate StorageDeviceChangeDelegate )
 {
-	static UFunction* pFnAddStorageDeviceChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddStorageDeviceChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddStorageDeviceChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddStorageDeviceChangeDelegate )
-		pFnAddStorageDeviceChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddStorageDeviceChangeDelegate" );
+	UFunction* const pFnAddStorageDeviceChangeDelegate = pFnAddStorageDeviceChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execAddStorageDeviceChangeDelegate_Parms AddStorageDeviceChangeDelegate_Parms;
 	memcpy ( &AddStorageDeviceChangeDelegate_Parms.StorageDeviceChangeDelegate, &StorageDeviceChangeDelegate, 0x10 );
@@ -7802,10 +6799,9 @@ void USFXOnlineComponentUnrealSystem::AddStorageDeviceChangeDelegate ( struct FS
 
 void USFXOnlineComponentUnrealSystem::OnStorageDeviceChange ( )
 {
-	static UFunction* pFnOnStorageDeviceChange = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnStorageDeviceChangeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnStorageDeviceChange", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnStorageDeviceChange )
-		pFnOnStorageDeviceChange = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnStorageDeviceChange" );
+	UFunction* const pFnOnStorageDeviceChange = pFnOnStorageDeviceChangeRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execOnStorageDeviceChange_Parms OnStorageDeviceChange_Parms;
 
@@ -7819,10 +6815,9 @@ void USFXOnlineComponentUnrealSystem::OnStorageDeviceChange ( )
 
 unsigned char USFXOnlineComponentUnrealSystem::GetNATType ( )
 {
-	static UFunction* pFnGetNATType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetNATTypeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetNATType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetNATType )
-		pFnGetNATType = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetNATType" );
+	UFunction* const pFnGetNATType = pFnGetNATTypeRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execGetNATType_Parms GetNATType_Parms;
 
@@ -7838,10 +6833,9 @@ unsigned char USFXOnlineComponentUnrealSystem::GetNATType ( )
 
 void USFXOnlineComponentUnrealSystem::ClearConnectionStatusChangeDelegate ( struct FScriptDelegate ConnectionStatusDelegate )
 {
-	static UFunction* pFnClearConnectionStatusChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearConnectionStatusChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearConnectionStatusChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearConnectionStatusChangeDelegate )
-		pFnClearConnectionStatusChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearConnectionStatusChangeDelegate" );
+	UFunction* const pFnClearConnectionStatusChangeDelegate = pFnClearConnectionStatusChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execClearConnectionStatusChangeDelegate_Parms ClearConnectionStatusChangeDelegate_Parms;
 	memcpy ( &ClearConnectionStatusChangeDelegate_Parms.ConnectionStatusDelegate, &ConnectionStatusDelegate, 0x10 );
@@ -7856,10 +6850,9 @@ void USFXOnlineComponentUnrealSystem::ClearConnectionStatusChangeDelegate ( stru
 
 void USFXOnlineComponentUnrealSystem::AddConnectionStatusChangeDelegate ( struct FScriptDelegate ConnectionStatusDelegate )
 {
-	static UFunction* pFnAddConnectionStatusChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddConnectionStatusChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddConnectionStatusChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddConnectionStatusChangeDelegate )
-		pFnAddConnectionStatusChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddConnectionStatusChangeDelegate" );
+	UFunction* const pFnAddConnectionStatusChangeDelegate = pFnAddConnectionStatusChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execAddConnectionStatusChangeDelegate_Parms AddConnectionStatusChangeDelegate_Parms;
 	memcpy ( &AddConnectionStatusChangeDelegate_Parms.ConnectionStatusDelegate, &ConnectionStatusDelegate, 0x10 );
@@ -7874,10 +6867,9 @@ void USFXOnlineComponentUnrealSystem::AddConnectionStatusChangeDelegate ( struct
 
 void USFXOnlineComponentUnrealSystem::OnConnectionStatusChange ( unsigned char ConnectionStatus )
 {
-	static UFunction* pFnOnConnectionStatusChange = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnConnectionStatusChangeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnConnectionStatusChange", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnConnectionStatusChange )
-		pFnOnConnectionStatusChange = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnConnectionStatusChange" );
+	UFunction* const pFnOnConnectionStatusChange = pFnOnConnectionStatusChangeRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execOnConnectionStatusChange_Parms OnConnectionStatusChange_Parms;
 	OnConnectionStatusChange_Parms.ConnectionStatus = ConnectionStatus;
@@ -7893,19 +6885,15 @@ void USFXOnlineComponentUnrealSystem::OnConnectionStatusChange ( unsigned char C
 
 bool USFXOnlineComponentUnrealSystem::IsControllerConnected ( int ControllerId )
 {
-	static UFunction* pFnIsControllerConnected = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsControllerConnectedRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.IsControllerConnected", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsControllerConnected )
-		pFnIsControllerConnected = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.IsControllerConnected" );
+	UFunction* const pFnIsControllerConnected = pFnIsControllerConnectedRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execIsControllerConnected_Parms IsControllerConnected_Parms;
 	IsControllerConnected_Parms.ControllerId = ControllerId;
 
-	pFnIsControllerConnected->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsControllerConnected, &IsControllerConnected_Parms, NULL );
-
-	pFnIsControllerConnected->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsControllerConnected, &IsControllerConnected_Parms ) )
+		this->ProcessEvent ( pFnIsControllerConnected, &IsControllerConnected_Parms, NULL );
 
 	return IsControllerConnected_Parms.ReturnValue;
 };
@@ -7917,10 +6905,9 @@ bool USFXOnlineComponentUnrealSystem::IsControllerConnected ( int ControllerId )
 
 void USFXOnlineComponentUnrealSystem::ClearControllerChangeDelegate ( struct FScriptDelegate ControllerChangeDelegate )
 {
-	static UFunction* pFnClearControllerChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearControllerChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearControllerChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearControllerChangeDelegate )
-		pFnClearControllerChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearControllerChangeDelegate" );
+	UFunction* const pFnClearControllerChangeDelegate = pFnClearControllerChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execClearControllerChangeDelegate_Parms ClearControllerChangeDelegate_Parms;
 	memcpy ( &ClearControllerChangeDelegate_Parms.ControllerChangeDelegate, &ControllerChangeDelegate, 0x10 );
@@ -7935,10 +6922,9 @@ void USFXOnlineComponentUnrealSystem::ClearControllerChangeDelegate ( struct FSc
 
 void USFXOnlineComponentUnrealSystem::AddControllerChangeDelegate ( struct FScriptDelegate ControllerChangeDelegate )
 {
-	static UFunction* pFnAddControllerChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddControllerChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddControllerChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddControllerChangeDelegate )
-		pFnAddControllerChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddControllerChangeDelegate" );
+	UFunction* const pFnAddControllerChangeDelegate = pFnAddControllerChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execAddControllerChangeDelegate_Parms AddControllerChangeDelegate_Parms;
 	memcpy ( &AddControllerChangeDelegate_Parms.ControllerChangeDelegate, &ControllerChangeDelegate, 0x10 );
@@ -7954,10 +6940,9 @@ void USFXOnlineComponentUnrealSystem::AddControllerChangeDelegate ( struct FScri
 
 void USFXOnlineComponentUnrealSystem::OnControllerChange ( int ControllerId, unsigned long bIsConnected )
 {
-	static UFunction* pFnOnControllerChange = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnControllerChangeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnControllerChange", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnControllerChange )
-		pFnOnControllerChange = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnControllerChange" );
+	UFunction* const pFnOnControllerChange = pFnOnControllerChangeRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execOnControllerChange_Parms OnControllerChange_Parms;
 	OnControllerChange_Parms.ControllerId = ControllerId;
@@ -7973,19 +6958,15 @@ void USFXOnlineComponentUnrealSystem::OnControllerChange ( int ControllerId, uns
 
 void USFXOnlineComponentUnrealSystem::SetNetworkNotificationPosition ( unsigned char NewPos )
 {
-	static UFunction* pFnSetNetworkNotificationPosition = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetNetworkNotificationPositionRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.SetNetworkNotificationPosition", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetNetworkNotificationPosition )
-		pFnSetNetworkNotificationPosition = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.SetNetworkNotificationPosition" );
+	UFunction* const pFnSetNetworkNotificationPosition = pFnSetNetworkNotificationPositionRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execSetNetworkNotificationPosition_Parms SetNetworkNotificationPosition_Parms;
 	SetNetworkNotificationPosition_Parms.NewPos = NewPos;
 
-	pFnSetNetworkNotificationPosition->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetNetworkNotificationPosition, &SetNetworkNotificationPosition_Parms, NULL );
-
-	pFnSetNetworkNotificationPosition->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetNetworkNotificationPosition, &SetNetworkNotificationPosition_Parms ) )
+		this->ProcessEvent ( pFnSetNetworkNotificationPosition, &SetNetworkNotificationPosition_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetNetworkNotificationPosition
@@ -7995,10 +6976,9 @@ void USFXOnlineComponentUnrealSystem::SetNetworkNotificationPosition ( unsigned
 
 unsigned char USFXOnlineComponentUnrealSystem::GetNetworkNotificationPosition ( )
 {
-	static UFunction* pFnGetNetworkNotificationPosition = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetNetworkNotificationPositionRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetNetworkNotificationPosition", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetNetworkNotificationPosition )
-		pFnGetNetworkNotificationPosition = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetNetworkNotificationPosition" );
+	UFunction* const pFnGetNetworkNotificationPosition = pFnGetNetworkNotificationPositionRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execGetNetworkNotificationPosition_Parms GetNetworkNotificationPosition_Parms;
 
@@ -8014,19 +6994,15 @@ unsigned char USFXOnlineComponentUnrealSystem::GetNetworkNotificationPosition (
 
 void USFXOnlineComponentUnrealSystem::ProcessExternalUINotification ( unsigned long bOpening )
 {
-	static UFunction* pFnProcessExternalUINotification = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnProcessExternalUINotificationRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ProcessExternalUINotification", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnProcessExternalUINotification )
-		pFnProcessExternalUINotification = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ProcessExternalUINotification" );
+	UFunction* const pFnProcessExternalUINotification = pFnProcessExternalUINotificationRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execProcessExternalUINotification_Parms ProcessExternalUINotification_Parms;
 	ProcessExternalUINotification_Parms.bOpening = bOpening;
 
-	pFnProcessExternalUINotification->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnProcessExternalUINotification, &ProcessExternalUINotification_Parms, NULL );
-
-	pFnProcessExternalUINotification->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnProcessExternalUINotification, &ProcessExternalUINotification_Parms ) )
+		this->ProcessEvent ( pFnProcessExternalUINotification, &ProcessExternalUINotification_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearExternalUIChangeDelegate
@@ -8036,10 +7012,9 @@ void USFXOnlineComponentUnrealSystem::ProcessExternalUINotification ( unsigned l
 
 void USFXOnlineComponentUnrealSystem::ClearExternalUIChangeDelegate ( struct FScriptDelegate ExternalUIDelegate )
 {
-	static UFunction* pFnClearExternalUIChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearExternalUIChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearExternalUIChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearExternalUIChangeDelegate )
-		pFnClearExternalUIChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearExternalUIChangeDelegate" );
+	UFunction* const pFnClearExternalUIChangeDelegate = pFnClearExternalUIChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execClearExternalUIChangeDelegate_Parms ClearExternalUIChangeDelegate_Parms;
 	memcpy ( &ClearExternalUIChangeDelegate_Parms.ExternalUIDelegate, &ExternalUIDelegate, 0x10 );
@@ -8054,10 +7029,9 @@ void USFXOnlineComponentUnrealSystem::ClearExternalUIChangeDelegate ( struct FSc
 
 void USFXOnlineComponentUnrealSystem::AddExternalUIChangeDelegate ( struct FScriptDelegate ExternalUIDelegate )
 {
-	static UFunction* pFnAddExternalUIChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddExternalUIChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddExternalUIChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddExternalUIChangeDelegate )
-		pFnAddExternalUIChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddExternalUIChangeDelegate" );
+	UFunction* const pFnAddExternalUIChangeDelegate = pFnAddExternalUIChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execAddExternalUIChangeDelegate_Parms AddExternalUIChangeDelegate_Parms;
 	memcpy ( &AddExternalUIChangeDelegate_Parms.ExternalUIDelegate, &ExternalUIDelegate, 0x10 );
@@ -8072,10 +7046,9 @@ void USFXOnlineComponentUnrealSystem::AddExternalUIChangeDelegate ( struct FScri
 
 void USFXOnlineComponentUnrealSystem::OnExternalUIChange ( unsigned long bIsOpening )
 {
-	static UFunction* pFnOnExternalUIChange = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnExternalUIChangeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnExternalUIChange", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnExternalUIChange )
-		pFnOnExternalUIChange = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnExternalUIChange" );
+	UFunction* const pFnOnExternalUIChange = pFnOnExternalUIChangeRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execOnExternalUIChange_Parms OnExternalUIChange_Parms;
 	OnExternalUIChange_Parms.bIsOpening = bIsOpening;
@@ -8090,10 +7063,9 @@ void USFXOnlineComponentUnrealSystem::OnExternalUIChange ( unsigned long bIsOpen
 
 void USFXOnlineComponentUnrealSystem::ClearLinkStatusChangeDelegate ( struct FScriptDelegate LinkStatusDelegate )
 {
-	static UFunction* pFnClearLinkStatusChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearLinkStatusChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearLinkStatusChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearLinkStatusChangeDelegate )
-		pFnClearLinkStatusChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearLinkStatusChangeDelegate" );
+	UFunction* const pFnClearLinkStatusChangeDelegate = pFnClearLinkStatusChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execClearLinkStatusChangeDelegate_Parms ClearLinkStatusChangeDelegate_Parms;
 	memcpy ( &ClearLinkStatusChangeDelegate_Parms.LinkStatusDelegate, &LinkStatusDelegate, 0x10 );
@@ -8108,10 +7080,9 @@ void USFXOnlineComponentUnrealSystem::ClearLinkStatusChangeDelegate ( struct FSc
 
 void USFXOnlineComponentUnrealSystem::AddLinkStatusChangeDelegate ( struct FScriptDelegate LinkStatusDelegate )
 {
-	static UFunction* pFnAddLinkStatusChangeDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddLinkStatusChangeDelegateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddLinkStatusChangeDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddLinkStatusChangeDelegate )
-		pFnAddLinkStatusChangeDelegate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddLinkStatusChangeDelegate" );
+	UFunction* const pFnAddLinkStatusChangeDelegate = pFnAddLinkStatusChangeDelegateRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execAddLinkStatusChangeDelegate_Parms AddLinkStatusChangeDelegate_Parms;
 	memcpy ( &AddLinkStatusChangeDelegate_Parms.LinkStatusDelegate, &LinkStatusDelegate, 0x10 );
@@ -8126,10 +7097,9 @@ void USFXOnlineComponentUnrealSystem::AddLinkStatusChangeDelegate ( struct FScri
 
 void USFXOnlineComponentUnrealSystem::OnLinkStatusChange ( unsigned long bIsConnected )
 {
-	static UFunction* pFnOnLinkStatusChange = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnLinkStatusChangeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnLinkStatusChange", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnLinkStatusChange )
-		pFnOnLinkStatusChange = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnLinkStatusChange" );
+	UFunction* const pFnOnLinkStatusChange = pFnOnLinkStatusChangeRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execOnLinkStatusChange_Parms OnLinkStatusChange_Parms;
 	OnLinkStatusChange_Parms.bIsConnected = bIsConnected;
@@ -8144,18 +7114,14 @@ void USFXOnlineComponentUnrealSystem::OnLinkStatusChange ( unsigned long bIsConn
 
 bool USFXOnlineComponentUnrealSystem::HasLinkConnection ( )
 {
-	static UFunction* pFnHasLinkConnection = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHasLinkConnectionRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.HasLinkConnection", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHasLinkConnection )
-		pFnHasLinkConnection = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.HasLinkConnection" );
+	UFunction* const pFnHasLinkConnection = pFnHasLinkConnectionRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execHasLinkConnection_Parms HasLinkConnection_Parms;
 
-	pFnHasLinkConnection->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnHasLinkConnection, &HasLinkConnection_Parms, NULL );
-
-	pFnHasLinkConnection->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnHasLinkConnection, &HasLinkConnection_Parms ) )
+		this->ProcessEvent ( pFnHasLinkConnection, &HasLinkConnection_Parms, NULL );
 
 	return HasLinkConnection_Parms.ReturnValue;
 };
@@ -8167,18 +7133,14 @@ bool USFXOnlineComponentUnrealSystem::HasLinkConnection ( )
 
 struct SFXName USFXOnlineComponentUnrealSystem::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -8189,18 +7151,14 @@ struct SFXName USFXOnlineComponentUnrealSystem::GetAPIName ( )
 
 void USFXOnlineComponentUnrealSystem::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnInitialize
@@ -8210,31 +7168,24 @@ void USFXOnlineComponentUnrealSystem::OnRelease ( )
 
 void USFXOnlineComponentUnrealSystem::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentUnrealSystem_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineComponentCoordinator::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentCoordinator::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentCoordinator", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentCoordinator::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentCoordinator" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.GetAPIName
@@ -8244,18 +7195,14 @@ class UClass* USFXOnlineComponentCoordinator::StaticClass()
 
 struct SFXName USFXOnlineComponentCoordinator::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -8266,18 +7213,14 @@ struct SFXName USFXOnlineComponentCoordinator::GetAPIName ( )
 
 void USFXOnlineComponentCoordinator::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnInitialize
@@ -8287,19 +7230,15 @@ void USFXOnlineComponentCoordinator::OnRelease ( )
 
 void USFXOnlineComponentCoordinator::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.StopWaitingForAllWork
@@ -8309,19 +7248,15 @@ void USFXOnlineComponentCoordinator::OnInitialize ( class USFXOnlineSubsystem* o
 
 void USFXOnlineComponentCoordinator::StopWaitingForAllWork ( class UObject* oCallbackTarget )
 {
-	static UFunction* pFnStopWaitingForAllWork = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopWaitingForAllWorkRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.StopWaitingForAllWork", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopWaitingForAllWork )
-		pFnStopWaitingForAllWork = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.StopWaitingForAllWork" );
+	UFunction* const pFnStopWaitingForAllWork = pFnStopWaitingForAllWorkRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execStopWaitingForAllWork_Parms StopWaitingForAllWork_Parms;
 	StopWaitingForAllWork_Parms.oCallbackTarget = oCallbackTarget;
 
-	pFnStopWaitingForAllWork->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnStopWaitingForAllWork, &StopWaitingForAllWork_Parms, NULL );
-
-	pFnStopWaitingForAllWork->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnStopWaitingForAllWork, &StopWaitingForAllWork_Parms ) )
+		this->ProcessEvent ( pFnStopWaitingForAllWork, &StopWaitingForAllWork_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkSetObject
@@ -8332,20 +7267,16 @@ void USFXOnlineComponentCoordinator::StopWaitingForAllWork ( class UObject* oCal
 
 void USFXOnlineComponentCoordinator::WaitingForWorkSetObject ( TArray<class USFXOnlineEvent*> const& aEventObjects, struct FScriptDelegate fnWorkComplete )
 {
-	static UFunction* pFnWaitingForWorkSetObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWaitingForWorkSetObjectRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkSetObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWaitingForWorkSetObject )
-		pFnWaitingForWorkSetObject = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkSetObject" );
+	UFunction* const pFnWaitingForWorkSetObject = pFnWaitingForWorkSetObjectRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execWaitingForWorkSetObject_Parms WaitingForWorkSetObject_Parms;
 	memcpy ( &WaitingForWorkSetObject_Parms.aEventObjects, &aEventObjects, 0x10 );
 	memcpy ( &WaitingForWorkSetObject_Parms.fnWorkComplete, &fnWorkComplete, 0x10 );
 
-	pFnWaitingForWorkSetObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWaitingForWorkSetObject, &WaitingForWorkSetObject_Parms, NULL );
-
-	pFnWaitingForWorkSetObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWaitingForWorkSetObject, &WaitingForWorkSetObject_Parms ) )
+		this->ProcessEvent ( pFnWaitingForWorkSetObject, &WaitingForWorkSetObject_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkSetType
@@ -8357,21 +7288,17 @@ void USFXOnlineComponentCoordinator::WaitingForWorkSetObject ( TArray<class USFX
 
 void USFXOnlineComponentCoordinator::WaitingForWorkSetType ( TArray<unsigned char> const& aEventTypes, struct FScriptDelegate fnWorkComplete, TArray<int> const& aWorkEventIds )
 {
-	static UFunction* pFnWaitingForWorkSetType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWaitingForWorkSetTypeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkSetType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWaitingForWorkSetType )
-		pFnWaitingForWorkSetType = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkSetType" );
+	UFunction* const pFnWaitingForWorkSetType = pFnWaitingForWorkSetTypeRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execWaitingForWorkSetType_Parms WaitingForWorkSetType_Parms;
 	memcpy ( &WaitingForWorkSetType_Parms.aEventTypes, &aEventTypes, 0x10 );
 	memcpy ( &WaitingForWorkSetType_Parms.fnWorkComplete, &fnWorkComplete, 0x10 );
 	memcpy ( &WaitingForWorkSetType_Parms.aWorkEventIds, &aWorkEventIds, 0x10 );
 
-	pFnWaitingForWorkSetType->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWaitingForWorkSetType, &WaitingForWorkSetType_Parms, NULL );
-
-	pFnWaitingForWorkSetType->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWaitingForWorkSetType, &WaitingForWorkSetType_Parms ) )
+		this->ProcessEvent ( pFnWaitingForWorkSetType, &WaitingForWorkSetType_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkObject
@@ -8382,20 +7309,16 @@ void USFXOnlineComponentCoordinator::WaitingForWorkSetType ( TArray<unsigned cha
 
 void USFXOnlineComponentCoordinator::WaitingForWorkObject ( class USFXOnlineEvent* oEvent, struct FScriptDelegate fnWorkComplete )
 {
-	static UFunction* pFnWaitingForWorkObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWaitingForWorkObjectRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWaitingForWorkObject )
-		pFnWaitingForWorkObject = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkObject" );
+	UFunction* const pFnWaitingForWorkObject = pFnWaitingForWorkObjectRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execWaitingForWorkObject_Parms WaitingForWorkObject_Parms;
 	WaitingForWorkObject_Parms.oEvent = oEvent;
 	memcpy ( &WaitingForWorkObject_Parms.fnWorkComplete, &fnWorkComplete, 0x10 );
 
-	pFnWaitingForWorkObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWaitingForWorkObject, &WaitingForWorkObject_Parms, NULL );
-
-	pFnWaitingForWorkObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWaitingForWorkObject, &WaitingForWorkObject_Parms ) )
+		this->ProcessEvent ( pFnWaitingForWorkObject, &WaitingForWorkObject_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkType
@@ -8407,21 +7330,17 @@ void USFXOnlineComponentCoordinator::WaitingForWorkObject ( class USFXOnlineEven
 
 void USFXOnlineComponentCoordinator::WaitingForWorkType ( unsigned char eEventType, struct FScriptDelegate fnWorkComplete, int nEventId )
 {
-	static UFunction* pFnWaitingForWorkType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWaitingForWorkTypeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWaitingForWorkType )
-		pFnWaitingForWorkType = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkType" );
+	UFunction* const pFnWaitingForWorkType = pFnWaitingForWorkTypeRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execWaitingForWorkType_Parms WaitingForWorkType_Parms;
 	WaitingForWorkType_Parms.eEventType = eEventType;
 	memcpy ( &WaitingForWorkType_Parms.fnWorkComplete, &fnWorkComplete, 0x10 );
 	WaitingForWorkType_Parms.nEventId = nEventId;
 
-	pFnWaitingForWorkType->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWaitingForWorkType, &WaitingForWorkType_Parms, NULL );
-
-	pFnWaitingForWorkType->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWaitingForWorkType, &WaitingForWorkType_Parms ) )
+		this->ProcessEvent ( pFnWaitingForWorkType, &WaitingForWorkType_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.IsEventPending
@@ -8433,20 +7352,16 @@ void USFXOnlineComponentCoordinator::WaitingForWorkType ( unsigned char eEventTy
 
 bool USFXOnlineComponentCoordinator::IsEventPending ( unsigned char eEventType, int nEventId )
 {
-	static UFunction* pFnIsEventPending = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsEventPendingRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.IsEventPending", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsEventPending )
-		pFnIsEventPending = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.IsEventPending" );
+	UFunction* const pFnIsEventPending = pFnIsEventPendingRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execIsEventPending_Parms IsEventPending_Parms;
 	IsEventPending_Parms.eEventType = eEventType;
 	IsEventPending_Parms.nEventId = nEventId;
 
-	pFnIsEventPending->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsEventPending, &IsEventPending_Parms, NULL );
-
-	pFnIsEventPending->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsEventPending, &IsEventPending_Parms ) )
+		this->ProcessEvent ( pFnIsEventPending, &IsEventPending_Parms, NULL );
 
 	return IsEventPending_Parms.ReturnValue;
 };
@@ -8460,20 +7375,16 @@ bool USFXOnlineComponentCoordinator::IsEventPending ( unsigned char eEventType,
 
 class USFXOnlineEvent* USFXOnlineComponentCoordinator::GetEvent ( unsigned char eEventType, int nEventId )
 {
-	static UFunction* pFnGetEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEventRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.GetEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEvent )
-		pFnGetEvent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.GetEvent" );
+	UFunction* const pFnGetEvent = pFnGetEventRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execGetEvent_Parms GetEvent_Parms;
 	GetEvent_Parms.eEventType = eEventType;
 	GetEvent_Parms.nEventId = nEventId;
 
-	pFnGetEvent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetEvent, &GetEvent_Parms, NULL );
-
-	pFnGetEvent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetEvent, &GetEvent_Parms ) )
+		this->ProcessEvent ( pFnGetEvent, &GetEvent_Parms, NULL );
 
 	return GetEvent_Parms.ReturnValue;
 };
@@ -8485,19 +7396,15 @@ class USFXOnlineEvent* USFXOnlineComponentCoordinator::GetEvent ( unsigned char
 
 void USFXOnlineComponentCoordinator::UnsubscribeFromAllEvents ( class UObject* oCallbackTarget )
 {
-	static UFunction* pFnUnsubscribeFromAllEvents = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnsubscribeFromAllEventsRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.UnsubscribeFromAllEvents", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnsubscribeFromAllEvents )
-		pFnUnsubscribeFromAllEvents = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.UnsubscribeFromAllEvents" );
+	UFunction* const pFnUnsubscribeFromAllEvents = pFnUnsubscribeFromAllEventsRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execUnsubscribeFromAllEvents_Parms UnsubscribeFromAllEvents_Parms;
 	UnsubscribeFromAllEvents_Parms.oCallbackTarget = oCallbackTarget;
 
-	pFnUnsubscribeFromAllEvents->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnUnsubscribeFromAllEvents, &UnsubscribeFromAllEvents_Parms, NULL );
-
-	pFnUnsubscribeFromAllEvents->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnUnsubscribeFromAllEvents, &UnsubscribeFromAllEvents_Parms ) )
+		this->ProcessEvent ( pFnUnsubscribeFromAllEvents, &UnsubscribeFromAllEvents_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.UnsubscribeFromEvent
@@ -8508,20 +7415,16 @@ void USFXOnlineComponentCoordinator::UnsubscribeFromAllEvents ( class UObject* o
 
 void USFXOnlineComponentCoordinator::UnsubscribeFromEvent ( unsigned char eEventType, struct FScriptDelegate fnEventCallback )
 {
-	static UFunction* pFnUnsubscribeFromEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnsubscribeFromEventRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.UnsubscribeFromEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnsubscribeFromEvent )
-		pFnUnsubscribeFromEvent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.UnsubscribeFromEvent" );
+	UFunction* const pFnUnsubscribeFromEvent = pFnUnsubscribeFromEventRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execUnsubscribeFromEvent_Parms UnsubscribeFromEvent_Parms;
 	UnsubscribeFromEvent_Parms.eEventType = eEventType;
 	memcpy ( &UnsubscribeFromEvent_Parms.fnEventCallback, &fnEventCallback, 0x10 );
 
-	pFnUnsubscribeFromEvent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnUnsubscribeFromEvent, &UnsubscribeFromEvent_Parms, NULL );
-
-	pFnUnsubscribeFromEvent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnUnsubscribeFromEvent, &UnsubscribeFromEvent_Parms ) )
+		this->ProcessEvent ( pFnUnsubscribeFromEvent, &UnsubscribeFromEvent_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.SubscribeToEvent
@@ -8532,20 +7435,16 @@ void USFXOnlineComponentCoordinator::UnsubscribeFromEvent ( unsigned char eEvent
 
 void USFXOnlineComponentCoordinator::SubscribeToEvent ( unsigned char eEventType, struct FScriptDelegate fnEventCallback )
 {
-	static UFunction* pFnSubscribeToEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubscribeToEventRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.SubscribeToEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubscribeToEvent )
-		pFnSubscribeToEvent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.SubscribeToEvent" );
+	UFunction* const pFnSubscribeToEvent = pFnSubscribeToEventRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execSubscribeToEvent_Parms SubscribeToEvent_Parms;
 	SubscribeToEvent_Parms.eEventType = eEventType;
 	memcpy ( &SubscribeToEvent_Parms.fnEventCallback, &fnEventCallback, 0x10 );
 
-	pFnSubscribeToEvent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubscribeToEvent, &SubscribeToEvent_Parms, NULL );
-
-	pFnSubscribeToEvent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubscribeToEvent, &SubscribeToEvent_Parms ) )
+		this->ProcessEvent ( pFnSubscribeToEvent, &SubscribeToEvent_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkFinishedObject
@@ -8556,20 +7455,16 @@ void USFXOnlineComponentCoordinator::SubscribeToEvent ( unsigned char eEventType
 
 void USFXOnlineComponentCoordinator::NotifyWorkFinishedObject ( class USFXOnlineEvent* oEvent, unsigned char eStatusFinished )
 {
-	static UFunction* pFnNotifyWorkFinishedObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyWorkFinishedObjectRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkFinishedObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyWorkFinishedObject )
-		pFnNotifyWorkFinishedObject = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkFinishedObject" );
+	UFunction* const pFnNotifyWorkFinishedObject = pFnNotifyWorkFinishedObjectRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execNotifyWorkFinishedObject_Parms NotifyWorkFinishedObject_Parms;
 	NotifyWorkFinishedObject_Parms.oEvent = oEvent;
 	NotifyWorkFinishedObject_Parms.eStatusFinished = eStatusFinished;
 
-	pFnNotifyWorkFinishedObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotifyWorkFinishedObject, &NotifyWorkFinishedObject_Parms, NULL );
-
-	pFnNotifyWorkFinishedObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNotifyWorkFinishedObject, &NotifyWorkFinishedObject_Parms ) )
+		this->ProcessEvent ( pFnNotifyWorkFinishedObject, &NotifyWorkFinishedObject_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkFinishedType
@@ -8581,21 +7476,17 @@ void USFXOnlineComponentCoordinator::NotifyWorkFinishedObject ( class USFXOnline
 
 void USFXOnlineComponentCoordinator::NotifyWorkFinishedType ( unsigned char eEventType, unsigned char eStatusFinished, int nEventId )
 {
-	static UFunction* pFnNotifyWorkFinishedType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyWorkFinishedTypeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkFinishedType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyWorkFinishedType )
-		pFnNotifyWorkFinishedType = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkFinishedType" );
+	UFunction* const pFnNotifyWorkFinishedType = pFnNotifyWorkFinishedTypeRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execNotifyWorkFinishedType_Parms NotifyWorkFinishedType_Parms;
 	NotifyWorkFinishedType_Parms.eEventType = eEventType;
 	NotifyWorkFinishedType_Parms.eStatusFinished = eStatusFinished;
 	NotifyWorkFinishedType_Parms.nEventId = nEventId;
 
-	pFnNotifyWorkFinishedType->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotifyWorkFinishedType, &NotifyWorkFinishedType_Parms, NULL );
-
-	pFnNotifyWorkFinishedType->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNotifyWorkFinishedType, &NotifyWorkFinishedType_Parms ) )
+		this->ProcessEvent ( pFnNotifyWorkFinishedType, &NotifyWorkFinishedType_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkStartedObject
@@ -8606,20 +7497,16 @@ void USFXOnlineComponentCoordinator::NotifyWorkFinishedType ( unsigned char eEve
 
 void USFXOnlineComponentCoordinator::NotifyWorkStartedObject ( class USFXOnlineEvent* oEvent, unsigned char eEventType )
 {
-	static UFunction* pFnNotifyWorkStartedObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyWorkStartedObjectRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkStartedObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyWorkStartedObject )
-		pFnNotifyWorkStartedObject = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkStartedObject" );
+	UFunction* const pFnNotifyWorkStartedObject = pFnNotifyWorkStartedObjectRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execNotifyWorkStartedObject_Parms NotifyWorkStartedObject_Parms;
 	NotifyWorkStartedObject_Parms.oEvent = oEvent;
 	NotifyWorkStartedObject_Parms.eEventType = eEventType;
 
-	pFnNotifyWorkStartedObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotifyWorkStartedObject, &NotifyWorkStartedObject_Parms, NULL );
-
-	pFnNotifyWorkStartedObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNotifyWorkStartedObject, &NotifyWorkStartedObject_Parms ) )
+		this->ProcessEvent ( pFnNotifyWorkStartedObject, &NotifyWorkStartedObject_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkStartedType
@@ -8631,21 +7518,17 @@ void USFXOnlineComponentCoordinator::NotifyWorkStartedObject ( class USFXOnlineE
 
 void USFXOnlineComponentCoordinator::NotifyWorkStartedType ( unsigned char eEventType, int nEventId, float fTimeOut )
 {
-	static UFunction* pFnNotifyWorkStartedType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyWorkStartedTypeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkStartedType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyWorkStartedType )
-		pFnNotifyWorkStartedType = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkStartedType" );
+	UFunction* const pFnNotifyWorkStartedType = pFnNotifyWorkStartedTypeRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execNotifyWorkStartedType_Parms NotifyWorkStartedType_Parms;
 	NotifyWorkStartedType_Parms.eEventType = eEventType;
 	NotifyWorkStartedType_Parms.nEventId = nEventId;
 	NotifyWorkStartedType_Parms.fTimeOut = fTimeOut;
 
-	pFnNotifyWorkStartedType->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotifyWorkStartedType, &NotifyWorkStartedType_Parms, NULL );
-
-	pFnNotifyWorkStartedType->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNotifyWorkStartedType, &NotifyWorkStartedType_Parms ) )
+		this->ProcessEvent ( pFnNotifyWorkStartedType, &NotifyWorkStartedType_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyEventObject
@@ -8655,19 +7538,15 @@ void USFXOnlineComponentCoordinator::NotifyWorkStartedType ( unsigned char eEven
 
 void USFXOnlineComponentCoordinator::NotifyEventObject ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnNotifyEventObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyEventObjectRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyEventObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyEventObject )
-		pFnNotifyEventObject = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyEventObject" );
+	UFunction* const pFnNotifyEventObject = pFnNotifyEventObjectRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execNotifyEventObject_Parms NotifyEventObject_Parms;
 	NotifyEventObject_Parms.oEvent = oEvent;
 
-	pFnNotifyEventObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotifyEventObject, &NotifyEventObject_Parms, NULL );
-
-	pFnNotifyEventObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNotifyEventObject, &NotifyEventObject_Parms ) )
+		this->ProcessEvent ( pFnNotifyEventObject, &NotifyEventObject_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyEventType
@@ -8679,21 +7558,17 @@ void USFXOnlineComponentCoordinator::NotifyEventObject ( class USFXOnlineEvent*
 
 void USFXOnlineComponentCoordinator::NotifyEventType ( unsigned char eEventType, unsigned char eStatus, unsigned char eOutcome )
 {
-	static UFunction* pFnNotifyEventType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyEventTypeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyEventType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyEventType )
-		pFnNotifyEventType = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyEventType" );
+	UFunction* const pFnNotifyEventType = pFnNotifyEventTypeRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execNotifyEventType_Parms NotifyEventType_Parms;
 	NotifyEventType_Parms.eEventType = eEventType;
 	NotifyEventType_Parms.eStatus = eStatus;
 	NotifyEventType_Parms.eOutcome = eOutcome;
 
-	pFnNotifyEventType->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotifyEventType, &NotifyEventType_Parms, NULL );
-
-	pFnNotifyEventType->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNotifyEventType, &NotifyEventType_Parms ) )
+		this->ProcessEvent ( pFnNotifyEventType, &NotifyEventType_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnTick
@@ -8703,19 +7578,15 @@ void USFXOnlineComponentCoordinator::NotifyEventType ( unsigned char eEventType,
 
 void USFXOnlineComponentCoordinator::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnTickRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnTick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnTick )
-		pFnOnTick = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnTick" );
+	UFunction* const pFnOnTick = pFnOnTickRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
 
-	pFnOnTick->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
-
-	pFnOnTick->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnTick, &OnTick_Parms ) )
+		this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnEvent
@@ -8725,10 +7596,9 @@ void USFXOnlineComponentCoordinator::OnTick ( class USFXOnlineEvent* oEvent )
 
 void USFXOnlineComponentCoordinator::OnEvent ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnEventRef { L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnEvent )
-		pFnOnEvent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnEvent" );
+	UFunction* const pFnOnEvent = pFnOnEventRef.Get ( );
 
 	USFXOnlineComponentCoordinator_execOnEvent_Parms OnEvent_Parms;
 	OnEvent_Parms.oEvent = oEvent;
@@ -8738,14 +7608,11 @@ void USFXOnlineComponentCoordinator::OnEvent ( class USFXOnlineEvent* oEvent )
 
 
 
-class UClass* USFXOnlineSubsystem::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineSubsystem::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineSubsystem", &UObject::FindClass };
 
 class UClass* USFXOnlineSubsystem::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineSubsystem" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineSubsystem.Exit
@@ -8754,18 +7621,14 @@ class UClass* USFXOnlineSubsystem::StaticClass()
 
 void USFXOnlineSubsystem::eventExit ( )
 {
-	static UFunction* pFnExit = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnExitRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.Exit", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnExit )
-		pFnExit = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.Exit" );
+	UFunction* const pFnExit = pFnExitRef.Get ( );
 
 	USFXOnlineSubsystem_eventExit_Parms Exit_Parms;
 
-	pFnExit->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnExit, &Exit_Parms, NULL );
-
-	pFnExit->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnExit, &Exit_Parms ) )
+		this->ProcessEvent ( pFnExit, &Exit_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineSubsystem.ShowConsoleRoutedKeyboardUI
@@ -8782,10 +7645,9 @@ void USFXOnlineSubsystem::eventExit ( )
 
 bool USFXOnlineSubsystem::ShowConsoleRoutedKeyboardUI ( unsigned char eLocalUserNum, FString const& sTitleText, FString const& sDescriptionText, unsigned long bIsPassword, unsigned long bShouldValidate, FString const& sDefaultText, int nMaxResultLength )
 {
-	static UFunction* pFnShowConsoleRoutedKeyboardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowConsoleRoutedKeyboardUIRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.ShowConsoleRoutedKeyboardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowConsoleRoutedKeyboardUI )
-		pFnShowConsoleRoutedKeyboardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.ShowConsoleRoutedKeyboardUI" );
+	UFunction* const pFnShowConsoleRoutedKeyboardUI = pFnShowConsoleRoutedKeyboardUIRef.Get ( );
 
 	USFXOnlineSubsystem_execShowConsoleRoutedKeyboardUI_Parms ShowConsoleRoutedKeyboardUI_Parms;
 	ShowConsoleRoutedKeyboardUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -8815,10 +7677,9 @@ bool USFXOnlineSubsystem::ShowConsoleRoutedKeyboardUI ( unsigned char eLocalUser
 
 bool USFXOnlineSubsystem::ShowKeyboardUI ( unsigned char eLocalUserNum, FString const& sTitleText, FString const& sDescriptionText, unsigned long bIsPassword, unsigned long bShouldValidate, FString const& sDefaultText, int nMaxResultLength )
 {
-	static UFunction* pFnShowKeyboardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowKeyboardUIRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.ShowKeyboardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowKeyboardUI )
-		pFnShowKeyboardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.ShowKeyboardUI" );
+	UFunction* const pFnShowKeyboardUI = pFnShowKeyboardUIRef.Get ( );
 
 	USFXOnlineSubsystem_execShowKeyboardUI_Parms ShowKeyboardUI_Parms;
 	ShowKeyboardUI_Parms.eLocalUserNum = eLocalUserNum;
@@ -8844,21 +7705,17 @@ bool USFXOnlineSubsystem::ShowKeyboardUI ( unsigned char eLocalUserNum, FString
 
 FString USFXOnlineSubsystem::FormatTime ( float fInSeconds, unsigned long bShowHours, unsigned long bShowMins )
 {
-	static UFunction* pFnFormatTime = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFormatTimeRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.FormatTime", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFormatTime )
-		pFnFormatTime = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.FormatTime" );
+	UFunction* const pFnFormatTime = pFnFormatTimeRef.Get ( );
 
 	USFXOnlineSubsystem_execFormatTime_Parms FormatTime_Parms;
 	FormatTime_Parms.fInSeconds = fInSeconds;
 	FormatTime_Parms.bShowHours = bShowHours;
 	FormatTime_Parms.bShowMins = bShowMins;
 
-	pFnFormatTime->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFormatTime, &FormatTime_Parms, NULL );
-
-	pFnFormatTime->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFormatTime, &FormatTime_Parms ) )
+		this->ProcessEvent ( pFnFormatTime, &FormatTime_Parms, NULL );
 
 	return FormatTime_Parms.ReturnValue;
 };
@@ -8872,10 +7729,9 @@ FString USFXOnlineSubsystem::FormatTime ( float fInSeconds, unsigned long bShowH
 
 bool USFXOnlineSubsystem::CheckEntitlement ( FString const& sGroup, FString const& sTag )
 {
-	static UFunction* pFnCheckEntitlement = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCheckEntitlementRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.CheckEntitlement", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCheckEntitlement )
-		pFnCheckEntitlement = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.CheckEntitlement" );
+	UFunction* const pFnCheckEntitlement = pFnCheckEntitlementRef.Get ( );
 
 	USFXOnlineSubsystem_execCheckEntitlement_Parms CheckEntitlement_Parms;
 	memcpy ( &CheckEntitlement_Parms.sGroup, &sGroup, 0x10 );
@@ -8893,10 +7749,9 @@ bool USFXOnlineSubsystem::CheckEntitlement ( FString const& sGroup, FString cons
 
 bool USFXOnlineSubsystem::IsCerberusMember ( )
 {
-	static UFunction* pFnIsCerberusMember = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsCerberusMemberRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.IsCerberusMember", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsCerberusMember )
-		pFnIsCerberusMember = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.IsCerberusMember" );
+	UFunction* const pFnIsCerberusMember = pFnIsCerberusMemberRef.Get ( );
 
 	USFXOnlineSubsystem_execIsCerberusMember_Parms IsCerberusMember_Parms;
 
@@ -8913,19 +7768,15 @@ bool USFXOnlineSubsystem::IsCerberusMember ( )
 
 struct FUniqueNetId USFXOnlineSubsystem::GetUniqueIdFromConnection ( class APlayerReplicationInfo* oPRI )
 {
-	static UFunction* pFnGetUniqueIdFromConnection = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUniqueIdFromConnectionRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetUniqueIdFromConnection", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUniqueIdFromConnection )
-		pFnGetUniqueIdFromConnection = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetUniqueIdFromConnection" );
+	UFunction* const pFnGetUniqueIdFromConnection = pFnGetUniqueIdFromConnectionRef.Get ( );
 
 	USFXOnlineSubsystem_execGetUniqueIdFromConnection_Parms GetUniqueIdFromConnection_Parms;
 	GetUniqueIdFromConnection_Parms.oPRI = oPRI;
 
-	pFnGetUniqueIdFromConnection->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetUniqueIdFromConnection, &GetUniqueIdFromConnection_Parms, NULL );
-
-	pFnGetUniqueIdFromConnection->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetUniqueIdFromConnection, &GetUniqueIdFromConnection_Parms ) )
+		this->ProcessEvent ( pFnGetUniqueIdFromConnection, &GetUniqueIdFromConnection_Parms, NULL );
 
 	return GetUniqueIdFromConnection_Parms.ReturnValue;
 };
@@ -8938,19 +7789,15 @@ struct FUniqueNetId USFXOnlineSubsystem::GetUniqueIdFromConnection ( class APlay
 
 FString USFXOnlineSubsystem::MD5HashString ( FString const& InStr )
 {
-	static UFunction* pFnMD5HashString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMD5HashStringRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.MD5HashString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMD5HashString )
-		pFnMD5HashString = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.MD5HashString" );
+	UFunction* const pFnMD5HashString = pFnMD5HashStringRef.Get ( );
 
 	USFXOnlineSubsystem_execMD5HashString_Parms MD5HashString_Parms;
 	memcpy ( &MD5HashString_Parms.InStr, &InStr, 0x10 );
 
-	pFnMD5HashString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMD5HashString, &MD5HashString_Parms, NULL );
-
-	pFnMD5HashString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnMD5HashString, &MD5HashString_Parms ) )
+		this->ProcessEvent ( pFnMD5HashString, &MD5HashString_Parms, NULL );
 
 	return MD5HashString_Parms.ReturnValue;
 };
@@ -8962,18 +7809,14 @@ FString USFXOnlineSubsystem::MD5HashString ( FString const& InStr )
 
 FString USFXOnlineSubsystem::GetProjectID ( )
 {
-	static UFunction* pFnGetProjectID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetProjectIDRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetProjectID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetProjectID )
-		pFnGetProjectID = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetProjectID" );
+	UFunction* const pFnGetProjectID = pFnGetProjectIDRef.Get ( );
 
 	USFXOnlineSubsystem_execGetProjectID_Parms GetProjectID_Parms;
 
-	pFnGetProjectID->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetProjectID, &GetProjectID_Parms, NULL );
-
-	pFnGetProjectID->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetProjectID, &GetProjectID_Parms ) )
+		this->ProcessEvent ( pFnGetProjectID, &GetProjectID_Parms, NULL );
 
 	return GetProjectID_Parms.ReturnValue;
 };
@@ -8985,18 +7828,14 @@ FString USFXOnlineSubsystem::GetProjectID ( )
 
 FString USFXOnlineSubsystem::GetCDKey ( )
 {
-	static UFunction* pFnGetCDKey = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetCDKeyRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetCDKey", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetCDKey )
-		pFnGetCDKey = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetCDKey" );
+	UFunction* const pFnGetCDKey = pFnGetCDKeyRef.Get ( );
 
 	USFXOnlineSubsystem_execGetCDKey_Parms GetCDKey_Parms;
 
-	pFnGetCDKey->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetCDKey, &GetCDKey_Parms, NULL );
-
-	pFnGetCDKey->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetCDKey, &GetCDKey_Parms ) )
+		this->ProcessEvent ( pFnGetCDKey, &GetCDKey_Parms, NULL );
 
 	return GetCDKey_Parms.ReturnValue;
 };
@@ -9008,18 +7847,14 @@ FString USFXOnlineSubsystem::GetCDKey ( )
 
 FString USFXOnlineSubsystem::GetLanguage ( )
 {
-	static UFunction* pFnGetLanguage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLanguageRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetLanguage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLanguage )
-		pFnGetLanguage = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetLanguage" );
+	UFunction* const pFnGetLanguage = pFnGetLanguageRef.Get ( );
 
 	USFXOnlineSubsystem_execGetLanguage_Parms GetLanguage_Parms;
 
-	pFnGetLanguage->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetLanguage, &GetLanguage_Parms, NULL );
-
-	pFnGetLanguage->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetLanguage, &GetLanguage_Parms ) )
+		this->ProcessEvent ( pFnGetLanguage, &GetLanguage_Parms, NULL );
 
 	return GetLanguage_Parms.ReturnValue;
 };
@@ -9031,18 +7866,14 @@ FString USFXOnlineSubsystem::GetLanguage ( )
 
 struct SFXName USFXOnlineSubsystem::GetPlatform ( )
 {
-	static UFunction* pFnGetPlatform = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPlatformRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetPlatform", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPlatform )
-		pFnGetPlatform = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetPlatform" );
+	UFunction* const pFnGetPlatform = pFnGetPlatformRef.Get ( );
 
 	USFXOnlineSubsystem_execGetPlatform_Parms GetPlatform_Parms;
 
-	pFnGetPlatform->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetPlatform, &GetPlatform_Parms, NULL );
-
-	pFnGetPlatform->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetPlatform, &GetPlatform_Parms ) )
+		this->ProcessEvent ( pFnGetPlatform, &GetPlatform_Parms, NULL );
 
 	return GetPlatform_Parms.ReturnValue;
 };
@@ -9053,18 +7884,14 @@ struct SFXName USFXOnlineSubsystem::GetPlatform ( )
 
 void USFXOnlineSubsystem::eventShutDown ( )
 {
-	static UFunction* pFnShutDown = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShutDownRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.ShutDown", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShutDown )
-		pFnShutDown = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.ShutDown" );
+	UFunction* const pFnShutDown = pFnShutDownRef.Get ( );
 
 	USFXOnlineSubsystem_eventShutDown_Parms ShutDown_Parms;
 
-	pFnShutDown->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShutDown, &ShutDown_Parms, NULL );
-
-	pFnShutDown->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShutDown, &ShutDown_Parms ) )
+		this->ProcessEvent ( pFnShutDown, &ShutDown_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineSubsystem.NativeInit
@@ -9074,18 +7901,14 @@ void USFXOnlineSubsystem::eventShutDown ( )
 
 bool USFXOnlineSubsystem::NativeInit ( )
 {
-	static UFunction* pFnNativeInit = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNativeInitRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.NativeInit", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNativeInit )
-		pFnNativeInit = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.NativeInit" );
+	UFunction* const pFnNativeInit = pFnNativeInitRef.Get ( );
 
 	USFXOnlineSubsystem_execNativeInit_Parms NativeInit_Parms;
 
-	pFnNativeInit->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNativeInit, &NativeInit_Parms, NULL );
-
-	pFnNativeInit->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNativeInit, &NativeInit_Parms ) )
+		this->ProcessEvent ( pFnNativeInit, &NativeInit_Parms, NULL );
 
 	return NativeInit_Parms.ReturnValue;
 };
@@ -9097,18 +7920,14 @@ bool USFXOnlineSubsystem::NativeInit ( )
 
 int USFXOnlineSubsystem::GetGameListenPort ( )
 {
-	static UFunction* pFnGetGameListenPort = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetGameListenPortRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetGameListenPort", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetGameListenPort )
-		pFnGetGameListenPort = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetGameListenPort" );
+	UFunction* const pFnGetGameListenPort = pFnGetGameListenPortRef.Get ( );
 
 	USFXOnlineSubsystem_execGetGameListenPort_Parms GetGameListenPort_Parms;
 
-	pFnGetGameListenPort->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetGameListenPort, &GetGameListenPort_Parms, NULL );
-
-	pFnGetGameListenPort->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetGameListenPort, &GetGameListenPort_Parms ) )
+		this->ProcessEvent ( pFnGetGameListenPort, &GetGameListenPort_Parms, NULL );
 
 	return GetGameListenPort_Parms.ReturnValue;
 };
@@ -9120,18 +7939,14 @@ int USFXOnlineSubsystem::GetGameListenPort ( )
 
 int USFXOnlineSubsystem::GetReserveTimeout ( )
 {
-	static UFunction* pFnGetReserveTimeout = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetReserveTimeoutRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetReserveTimeout", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetReserveTimeout )
-		pFnGetReserveTimeout = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetReserveTimeout" );
+	UFunction* const pFnGetReserveTimeout = pFnGetReserveTimeoutRef.Get ( );
 
 	USFXOnlineSubsystem_execGetReserveTimeout_Parms GetReserveTimeout_Parms;
 
-	pFnGetReserveTimeout->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetReserveTimeout, &GetReserveTimeout_Parms, NULL );
-
-	pFnGetReserveTimeout->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetReserveTimeout, &GetReserveTimeout_Parms ) )
+		this->ProcessEvent ( pFnGetReserveTimeout, &GetReserveTimeout_Parms, NULL );
 
 	return GetReserveTimeout_Parms.ReturnValue;
 };
@@ -9143,18 +7958,14 @@ int USFXOnlineSubsystem::GetReserveTimeout ( )
 
 int USFXOnlineSubsystem::GetMaxObserverCount ( )
 {
-	static UFunction* pFnGetMaxObserverCount = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetMaxObserverCountRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetMaxObserverCount", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetMaxObserverCount )
-		pFnGetMaxObserverCount = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetMaxObserverCount" );
+	UFunction* const pFnGetMaxObserverCount = pFnGetMaxObserverCountRef.Get ( );
 
 	USFXOnlineSubsystem_execGetMaxObserverCount_Parms GetMaxObserverCount_Parms;
 
-	pFnGetMaxObserverCount->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetMaxObserverCount, &GetMaxObserverCount_Parms, NULL );
-
-	pFnGetMaxObserverCount->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetMaxObserverCount, &GetMaxObserverCount_Parms ) )
+		this->ProcessEvent ( pFnGetMaxObserverCount, &GetMaxObserverCount_Parms, NULL );
 
 	return GetMaxObserverCount_Parms.ReturnValue;
 };
@@ -9166,18 +7977,14 @@ int USFXOnlineSubsystem::GetMaxObserverCount ( )
 
 int USFXOnlineSubsystem::GetMaxPlayerCount ( )
 {
-	static UFunction* pFnGetMaxPlayerCount = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetMaxPlayerCountRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetMaxPlayerCount", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetMaxPlayerCount )
-		pFnGetMaxPlayerCount = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetMaxPlayerCount" );
+	UFunction* const pFnGetMaxPlayerCount = pFnGetMaxPlayerCountRef.Get ( );
 
 	USFXOnlineSubsystem_execGetMaxPlayerCount_Parms GetMaxPlayerCount_Parms;
 
-	pFnGetMaxPlayerCount->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetMaxPlayerCount, &GetMaxPlayerCount_Parms, NULL );
-
-	pFnGetMaxPlayerCount->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetMaxPlayerCount, &GetMaxPlayerCount_Parms ) )
+		this->ProcessEvent ( pFnGetMaxPlayerCount, &GetMaxPlayerCount_Parms, NULL );
 
 	return GetMaxPlayerCount_Parms.ReturnValue;
 };
@@ -9189,19 +7996,15 @@ int USFXOnlineSubsystem::GetMaxPlayerCount ( )
 
 void USFXOnlineSubsystem::SetMaxPlayerCount ( int nMaxPlayers )
 {
-	static UFunction* pFnSetMaxPlayerCount = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetMaxPlayerCountRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.SetMaxPlayerCount", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetMaxPlayerCount )
-		pFnSetMaxPlayerCount = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.SetMaxPlayerCount" );
+	UFunction* const pFnSetMaxPlayerCount = pFnSetMaxPlayerCountRef.Get ( );
 
 	USFXOnlineSubsystem_execSetMaxPlayerCount_Parms SetMaxPlayerCount_Parms;
 	SetMaxPlayerCount_Parms.nMaxPlayers = nMaxPlayers;
 
-	pFnSetMaxPlayerCount->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetMaxPlayerCount, &SetMaxPlayerCount_Parms, NULL );
-
-	pFnSetMaxPlayerCount->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetMaxPlayerCount, &SetMaxPlayerCount_Parms ) )
+		this->ProcessEvent ( pFnSetMaxPlayerCount, &SetMaxPlayerCount_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineSubsystem.GetGameProtocolVersion
@@ -9211,18 +8014,14 @@ void USFXOnlineSubsystem::SetMaxPlayerCount ( int nMaxPlayers )
 
 FString USFXOnlineSubsystem::GetGameProtocolVersion ( )
 {
-	static UFunction* pFnGetGameProtocolVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetGameProtocolVersionRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetGameProtocolVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetGameProtocolVersion )
-		pFnGetGameProtocolVersion = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetGameProtocolVersion" );
+	UFunction* const pFnGetGameProtocolVersion = pFnGetGameProtocolVersionRef.Get ( );
 
 	USFXOnlineSubsystem_execGetGameProtocolVersion_Parms GetGameProtocolVersion_Parms;
 
-	pFnGetGameProtocolVersion->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetGameProtocolVersion, &GetGameProtocolVersion_Parms, NULL );
-
-	pFnGetGameProtocolVersion->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetGameProtocolVersion, &GetGameProtocolVersion_Parms ) )
+		this->ProcessEvent ( pFnGetGameProtocolVersion, &GetGameProtocolVersion_Parms, NULL );
 
 	return GetGameProtocolVersion_Parms.ReturnValue;
 };
@@ -9234,18 +8033,14 @@ FString USFXOnlineSubsystem::GetGameProtocolVersion ( )
 
 class USFXOnlineComponentOrigin* USFXOnlineSubsystem::GetComponentOrigin ( )
 {
-	static UFunction* pFnGetComponentOrigin = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetComponentOriginRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentOrigin", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetComponentOrigin )
-		pFnGetComponentOrigin = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentOrigin" );
+	UFunction* const pFnGetComponentOrigin = pFnGetComponentOriginRef.Get ( );
 
 	USFXOnlineSubsystem_execGetComponentOrigin_Parms GetComponentOrigin_Parms;
 
-	pFnGetComponentOrigin->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetComponentOrigin, &GetComponentOrigin_Parms, NULL );
-
-	pFnGetComponentOrigin->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetComponentOrigin, &GetComponentOrigin_Parms ) )
+		this->ProcessEvent ( pFnGetComponentOrigin, &GetComponentOrigin_Parms, NULL );
 
 	return GetComponentOrigin_Parms.ReturnValue;
 };
@@ -9257,18 +8052,14 @@ class USFXOnlineComponentOrigin* USFXOnlineSubsystem::GetComponentOrigin ( )
 
 class USFXOnlineComponentUnrealPlayerEx* USFXOnlineSubsystem::GetComponentUnrealPlayerEx ( )
 {
-	static UFunction* pFnGetComponentUnrealPlayerEx = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetComponentUnrealPlayerExRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUnrealPlayerEx", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetComponentUnrealPlayerEx )
-		pFnGetComponentUnrealPlayerEx = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUnrealPlayerEx" );
+	UFunction* const pFnGetComponentUnrealPlayerEx = pFnGetComponentUnrealPlayerExRef.Get ( );
 
 	USFXOnlineSubsystem_execGetComponentUnrealPlayerEx_Parms GetComponentUnrealPlayerEx_Parms;
 
-	pFnGetComponentUnrealPlayerEx->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetComponentUnrealPlayerEx, &GetComponentUnrealPlayerEx_Parms, NULL );
-
-	pFnGetComponentUnrealPlayerEx->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetComponentUnrealPlayerEx, &GetComponentUnrealPlayerEx_Parms ) )
+		this->ProcessEvent ( pFnGetComponentUnrealPlayerEx, &GetComponentUnrealPlayerEx_Parms, NULL );
 
 	return GetComponentUnrealPlayerEx_Parms.ReturnValue;
 };
@@ -9280,18 +8071,14 @@ class USFXOnlineComponentUnrealPlayerEx* USFXOnlineSubsystem::GetComponentUnreal
 
 class USFXOnlineComponentUnrealPlayer* USFXOnlineSubsystem::GetComponentUnrealPlayer ( )
 {
-	static UFunction* pFnGetComponentUnrealPlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetComponentUnrealPlayerRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUnrealPlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetComponentUnrealPlayer )
-		pFnGetComponentUnrealPlayer = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUnrealPlayer" );
+	UFunction* const pFnGetComponentUnrealPlayer = pFnGetComponentUnrealPlayerRef.Get ( );
 
 	USFXOnlineSubsystem_execGetComponentUnrealPlayer_Parms GetComponentUnrealPlayer_Parms;
 
-	pFnGetComponentUnrealPlayer->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetComponentUnrealPlayer, &GetComponentUnrealPlayer_Parms, NULL );
-
-	pFnGetComponentUnrealPlayer->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetComponentUnrealPlayer, &GetComponentUnrealPlayer_Parms ) )
+		this->ProcessEvent ( pFnGetComponentUnrealPlayer, &GetComponentUnrealPlayer_Parms, NULL );
 
 	return GetComponentUnrealPlayer_Parms.ReturnValue;
 };
@@ -9303,18 +8090,14 @@ class USFXOnlineComponentUnrealPlayer* USFXOnlineSubsystem::GetComponentUnrealPl
 
 class USFXOnlineComponentUnrealSystem* USFXOnlineSubsystem::GetComponentUnrealSystem ( )
 {
-	static UFunction* pFnGetComponentUnrealSystem = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetComponentUnrealSystemRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUnrealSystem", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetComponentUnrealSystem )
-		pFnGetComponentUnrealSystem = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUnrealSystem" );
+	UFunction* const pFnGetComponentUnrealSystem = pFnGetComponentUnrealSystemRef.Get ( );
 
 	USFXOnlineSubsystem_execGetComponentUnrealSystem_Parms GetComponentUnrealSystem_Parms;
 
-	pFnGetComponentUnrealSystem->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetComponentUnrealSystem, &GetComponentUnrealSystem_Parms, NULL );
-
-	pFnGetComponentUnrealSystem->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetComponentUnrealSystem, &GetComponentUnrealSystem_Parms ) )
+		this->ProcessEvent ( pFnGetComponentUnrealSystem, &GetComponentUnrealSystem_Parms, NULL );
 
 	return GetComponentUnrealSystem_Parms.ReturnValue;
 };
@@ -9326,18 +8109,14 @@ class USFXOnlineComponentUnrealSystem* USFXOnlineSubsystem::GetComponentUnrealSy
 
 class USFXOnlineComponentCoordinator* USFXOnlineSubsystem::GetCoordinator ( )
 {
-	static UFunction* pFnGetCoordinator = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetCoordinatorRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetCoordinator", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetCoordinator )
-		pFnGetCoordinator = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetCoordinator" );
+	UFunction* const pFnGetCoordinator = pFnGetCoordinatorRef.Get ( );
 
 	USFXOnlineSubsystem_execGetCoordinator_Parms GetCoordinator_Parms;
 
-	pFnGetCoordinator->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetCoordinator, &GetCoordinator_Parms, NULL );
-
-	pFnGetCoordinator->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetCoordinator, &GetCoordinator_Parms ) )
+		this->ProcessEvent ( pFnGetCoordinator, &GetCoordinator_Parms, NULL );
 
 	return GetCoordinator_Parms.ReturnValue;
 };
@@ -9349,18 +8128,14 @@ class USFXOnlineComponentCoordinator* USFXOnlineSubsystem::GetCoordinator ( )
 
 class UISFXOnlineComponentTelemetry* USFXOnlineSubsystem::GetComponentTelemetry ( )
 {
-	static UFunction* pFnGetComponentTelemetry = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetComponentTelemetryRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentTelemetry", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetComponentTelemetry )
-		pFnGetComponentTelemetry = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentTelemetry" );
+	UFunction* const pFnGetComponentTelemetry = pFnGetComponentTelemetryRef.Get ( );
 
 	USFXOnlineSubsystem_execGetComponentTelemetry_Parms GetComponentTelemetry_Parms;
 
-	pFnGetComponentTelemetry->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetComponentTelemetry, &GetComponentTelemetry_Parms, NULL );
-
-	pFnGetComponentTelemetry->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetComponentTelemetry, &GetComponentTelemetry_Parms ) )
+		this->ProcessEvent ( pFnGetComponentTelemetry, &GetComponentTelemetry_Parms, NULL );
 
 	return GetComponentTelemetry_Parms.ReturnValue;
 };
@@ -9372,18 +8147,14 @@ class UISFXOnlineComponentTelemetry* USFXOnlineSubsystem::GetComponentTelemetry
 
 class UISFXOnlineComponentNotification* USFXOnlineSubsystem::GetComponentNotification ( )
 {
-	static UFunction* pFnGetComponentNotification = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetComponentNotificationRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentNotification", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetComponentNotification )
-		pFnGetComponentNotification = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentNotification" );
+	UFunction* const pFnGetComponentNotification = pFnGetComponentNotificationRef.Get ( );
 
 	USFXOnlineSubsystem_execGetComponentNotification_Parms GetComponentNotification_Parms;
 
-	pFnGetComponentNotification->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetComponentNotification, &GetComponentNotification_Parms, NULL );
-
-	pFnGetComponentNotification->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetComponentNotification, &GetComponentNotification_Parms ) )
+		this->ProcessEvent ( pFnGetComponentNotification, &GetComponentNotification_Parms, NULL );
 
 	return GetComponentNotification_Parms.ReturnValue;
 };
@@ -9395,18 +8166,14 @@ class UISFXOnlineComponentNotification* USFXOnlineSubsystem::GetComponentNotific
 
 class UISFXOnlineComponentUserInterface* USFXOnlineSubsystem::GetComponentUserInterface ( )
 {
-	static UFunction* pFnGetComponentUserInterface = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetComponentUserInterfaceRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUserInterface", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetComponentUserInterface )
-		pFnGetComponentUserInterface = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUserInterface" );
+	UFunction* const pFnGetComponentUserInterface = pFnGetComponentUserInterfaceRef.Get ( );
 
 	USFXOnlineSubsystem_execGetComponentUserInterface_Parms GetComponentUserInterface_Parms;
 
-	pFnGetComponentUserInterface->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetComponentUserInterface, &GetComponentUserInterface_Parms, NULL );
-
-	pFnGetComponentUserInterface->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetComponentUserInterface, &GetComponentUserInterface_Parms ) )
+		this->ProcessEvent ( pFnGetComponentUserInterface, &GetComponentUserInterface_Parms, NULL );
 
 	return GetComponentUserInterface_Parms.ReturnValue;
 };
@@ -9418,18 +8185,14 @@ class UISFXOnlineComponentUserInterface* USFXOnlineSubsystem::GetComponentUserIn
 
 class UISFXOnlineComponentLogin* USFXOnlineSubsystem::GetComponentLogin ( )
 {
-	static UFunction* pFnGetComponentLogin = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetComponentLoginRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentLogin", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetComponentLogin )
-		pFnGetComponentLogin = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentLogin" );
+	UFunction* const pFnGetComponentLogin = pFnGetComponentLoginRef.Get ( );
 
 	USFXOnlineSubsystem_execGetComponentLogin_Parms GetComponentLogin_Parms;
 
-	pFnGetComponentLogin->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetComponentLogin, &GetComponentLogin_Parms, NULL );
-
-	pFnGetComponentLogin->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetComponentLogin, &GetComponentLogin_Parms ) )
+		this->ProcessEvent ( pFnGetComponentLogin, &GetComponentLogin_Parms, NULL );
 
 	return GetComponentLogin_Parms.ReturnValue;
 };
@@ -9441,18 +8204,14 @@ class UISFXOnlineComponentLogin* USFXOnlineSubsystem::GetComponentLogin ( )
 
 class UISFXOnlineComponentAPI* USFXOnlineSubsystem::GetComponentAPI ( )
 {
-	static UFunction* pFnGetComponentAPI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetComponentAPIRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentAPI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetComponentAPI )
-		pFnGetComponentAPI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentAPI" );
+	UFunction* const pFnGetComponentAPI = pFnGetComponentAPIRef.Get ( );
 
 	USFXOnlineSubsystem_execGetComponentAPI_Parms GetComponentAPI_Parms;
 
-	pFnGetComponentAPI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetComponentAPI, &GetComponentAPI_Parms, NULL );
-
-	pFnGetComponentAPI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetComponentAPI, &GetComponentAPI_Parms ) )
+		this->ProcessEvent ( pFnGetComponentAPI, &GetComponentAPI_Parms, NULL );
 
 	return GetComponentAPI_Parms.ReturnValue;
 };
@@ -9464,18 +8223,14 @@ class UISFXOnlineComponentAPI* USFXOnlineSubsystem::GetComponentAPI ( )
 
 class UISFXOnlineComponentAchievement* USFXOnlineSubsystem::GetComponentAchievement ( )
 {
-	static UFunction* pFnGetComponentAchievement = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetComponentAchievementRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentAchievement", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetComponentAchievement )
-		pFnGetComponentAchievement = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentAchievement" );
+	UFunction* const pFnGetComponentAchievement = pFnGetComponentAchievementRef.Get ( );
 
 	USFXOnlineSubsystem_execGetComponentAchievement_Parms GetComponentAchievement_Parms;
 
-	pFnGetComponentAchievement->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetComponentAchievement, &GetComponentAchievement_Parms, NULL );
-
-	pFnGetComponentAchievement->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetComponentAchievement, &GetComponentAchievement_Parms ) )
+		this->ProcessEvent ( pFnGetComponentAchievement, &GetComponentAchievement_Parms, NULL );
 
 	return GetComponentAchievement_Parms.ReturnValue;
 };
@@ -9487,18 +8242,14 @@ class UISFXOnlineComponentAchievement* USFXOnlineSubsystem::GetComponentAchievem
 
 class UISFXOnlineComponentPlatform* USFXOnlineSubsystem::GetComponentPlatform ( )
 {
-	static UFunction* pFnGetComponentPlatform = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetComponentPlatformRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentPlatform", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetComponentPlatform )
-		pFnGetComponentPlatform = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentPlatform" );
+	UFunction* const pFnGetComponentPlatform = pFnGetComponentPlatformRef.Get ( );
 
 	USFXOnlineSubsystem_execGetComponentPlatform_Parms GetComponentPlatform_Parms;
 
-	pFnGetComponentPlatform->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetComponentPlatform, &GetComponentPlatform_Parms, NULL );
-
-	pFnGetComponentPlatform->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetComponentPlatform, &GetComponentPlatform_Parms ) )
+		this->ProcessEvent ( pFnGetComponentPlatform, &GetComponentPlatform_Parms, NULL );
 
 	return GetComponentPlatform_Parms.ReturnValue;
 };
@@ -9510,18 +8261,14 @@ class UISFXOnlineComponentPlatform* USFXOnlineSubsystem::GetComponentPlatform (
 
 class USFXOnlineSubsystem* USFXOnlineSubsystem::GetOnlineSubsystem ( )
 {
-	static UFunction* pFnGetOnlineSubsystem = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOnlineSubsystemRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetOnlineSubsystem", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOnlineSubsystem )
-		pFnGetOnlineSubsystem = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetOnlineSubsystem" );
+	UFunction* const pFnGetOnlineSubsystem = pFnGetOnlineSubsystemRef.Get ( );
 
 	USFXOnlineSubsystem_execGetOnlineSubsystem_Parms GetOnlineSubsystem_Parms;
 
-	pFnGetOnlineSubsystem->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetOnlineSubsystem, &GetOnlineSubsystem_Parms, NULL );
-
-	pFnGetOnlineSubsystem->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetOnlineSubsystem, &GetOnlineSubsystem_Parms ) )
+		this->ProcessEvent ( pFnGetOnlineSubsystem, &GetOnlineSubsystem_Parms, NULL );
 
 	return GetOnlineSubsystem_Parms.ReturnValue;
 };
@@ -9534,10 +8281,9 @@ class USFXOnlineSubsystem* USFXOnlineSubsystem::GetOnlineSubsystem ( )
 
 FString USFXOnlineSubsystem::StripBadPWCharacters ( FString const& sPassword )
 {
-	static UFunction* pFnStripBadPWCharacters = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStripBadPWCharactersRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.StripBadPWCharacters", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStripBadPWCharacters )
-		pFnStripBadPWCharacters = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.StripBadPWCharacters" );
+	UFunction* const pFnStripBadPWCharacters = pFnStripBadPWCharactersRef.Get ( );
 
 	USFXOnlineSubsystem_execStripBadPWCharacters_Parms StripBadPWCharacters_Parms;
 	memcpy ( &StripBadPWCharacters_Parms.sPassword, &sPassword, 0x10 );
@@ -9554,10 +8300,9 @@ FString USFXOnlineSubsystem::StripBadPWCharacters ( FString const& sPassword )
 
 FString USFXOnlineSubsystem::eventGetURL ( )
 {
-	static UFunction* pFnGetURL = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetURLRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetURL", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetURL )
-		pFnGetURL = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetURL" );
+	UFunction* const pFnGetURL = pFnGetURLRef.Get ( );
 
 	USFXOnlineSubsystem_eventGetURL_Parms GetURL_Parms;
 
@@ -9572,10 +8317,9 @@ FString USFXOnlineSubsystem::eventGetURL ( )
 
 void USFXOnlineSubsystem::SetUnrealInterfaces ( )
 {
-	static UFunction* pFnSetUnrealInterfaces = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetUnrealInterfacesRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.SetUnrealInterfaces", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetUnrealInterfaces )
-		pFnSetUnrealInterfaces = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.SetUnrealInterfaces" );
+	UFunction* const pFnSetUnrealInterfaces = pFnSetUnrealInterfacesRef.Get ( );
 
 	USFXOnlineSubsystem_execSetUnrealInterfaces_Parms SetUnrealInterfaces_Parms;
 
@@ -9588,10 +8332,9 @@ void USFXOnlineSubsystem::SetUnrealInterfaces ( )
 
 void USFXOnlineSubsystem::CreateComponents ( )
 {
-	static UFunction* pFnCreateComponents = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCreateComponentsRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.CreateComponents", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCreateComponents )
-		pFnCreateComponents = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.CreateComponents" );
+	UFunction* const pFnCreateComponents = pFnCreateComponentsRef.Get ( );
 
 	USFXOnlineSubsystem_execCreateComponents_Parms CreateComponents_Parms;
 
@@ -9604,10 +8347,9 @@ void USFXOnlineSubsystem::CreateComponents ( )
 
 void USFXOnlineSubsystem::InitGameProtocolVersion ( )
 {
-	static UFunction* pFnInitGameProtocolVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitGameProtocolVersionRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.InitGameProtocolVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitGameProtocolVersion )
-		pFnInitGameProtocolVersion = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.InitGameProtocolVersion" );
+	UFunction* const pFnInitGameProtocolVersion = pFnInitGameProtocolVersionRef.Get ( );
 
 	USFXOnlineSubsystem_execInitGameProtocolVersion_Parms InitGameProtocolVersion_Parms;
 
@@ -9621,10 +8363,9 @@ void USFXOnlineSubsystem::InitGameProtocolVersion ( )
 
 bool USFXOnlineSubsystem::eventInit ( )
 {
-	static UFunction* pFnInit = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.Init", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInit )
-		pFnInit = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.Init" );
+	UFunction* const pFnInit = pFnInitRef.Get ( );
 
 	USFXOnlineSubsystem_eventInit_Parms Init_Parms;
 
@@ -9640,10 +8381,9 @@ bool USFXOnlineSubsystem::eventInit ( )
 
 TArray<struct FSFXOnlineAchievement> USFXOnlineSubsystem::GetAchievementList ( )
 {
-	static UFunction* pFnGetAchievementList = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAchievementListRef { L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetAchievementList", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAchievementList )
-		pFnGetAchievementList = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetAchievementList" );
+	UFunction* const pFnGetAchievementList = pFnGetAchievementListRef.Get ( );
 
 	USFXOnlineSubsystem_execGetAchievementList_Parms GetAchievementList_Parms;
 
@@ -9654,14 +8394,11 @@ TArray<struct FSFXOnlineAchievement> USFXOnlineSubsystem::GetAchievementList ( )
 
 
 
-class UClass* USFXOnlineComponentAchievementPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentAchievementPC::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentAchievementPC", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentAchievementPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentAchievementPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.GetTitleAchievementID
@@ -9673,10 +8410,9 @@ class UClass* USFXOnlineComponentAchievementPC::StaticClass()
 
 int USFXOnlineComponentAchievementPC::GetTitleAchievementID ( int Index, int* SetIndex )
 {
-	static UFunction* pFnGetTitleAchievementID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTitleAchievementIDRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.GetTitleAchievementID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTitleAchievementID )
-		pFnGetTitleAchievementID = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.GetTitleAchievementID" );
+	UFunction* const pFnGetTitleAchievementID = pFnGetTitleAchievementIDRef.Get ( );
 
 	USFXOnlineComponentAchievementPC_execGetTitleAchievementID_Parms GetTitleAchievementID_Parms;
 	GetTitleAchievementID_Parms.Index = Index;
@@ -9684,11 +8420,8 @@ int USFXOnlineComponentAchievementPC::GetTitleAchievementID ( int Index, int* Se
 	if ( SetIndex )
 		GetTitleAchievementID_Parms.SetIndex = *SetIndex;
 
-	pFnGetTitleAchievementID->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetTitleAchievementID, &GetTitleAchievementID_Parms, NULL );
-
-	pFnGetTitleAchievementID->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetTitleAchievementID, &GetTitleAchievementID_Parms ) )
+		this->ProcessEvent ( pFnGetTitleAchievementID, &GetTitleAchievementID_Parms, NULL );
 
 	if ( SetIndex )
 		*SetIndex = GetTitleAchievementID_Parms.SetIndex;
@@ -9705,10 +8438,9 @@ int USFXOnlineComponentAchievementPC::GetTitleAchievementID ( int Index, int* Se
 
 int USFXOnlineComponentAchievementPC::GetPlatformAchievementID ( int Index, int* SetIndex )
 {
-	static UFunction* pFnGetPlatformAchievementID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPlatformAchievementIDRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.GetPlatformAchievementID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPlatformAchievementID )
-		pFnGetPlatformAchievementID = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.GetPlatformAchievementID" );
+	UFunction* const pFnGetPlatformAchievementID = pFnGetPlatformAchievementIDRef.Get ( );
 
 	USFXOnlineComponentAchievementPC_execGetPlatformAchievementID_Parms GetPlatformAchievementID_Parms;
 	GetPlatformAchievementID_Parms.Index = Index;
@@ -9716,11 +8448,8 @@ int USFXOnlineComponentAchievementPC::GetPlatformAchievementID ( int Index, int*
 	if ( SetIndex )
 		GetPlatformAchievementID_Parms.SetIndex = *SetIndex;
 
-	pFnGetPlatformAchievementID->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms, NULL );
-
-	pFnGetPlatformAchievementID->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms ) )
+		this->ProcessEvent ( pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms, NULL );
 
 	if ( SetIndex )
 		*SetIndex = GetPlatformAchievementID_Parms.SetIndex;
@@ -9735,18 +8464,14 @@ int USFXOnlineComponentAchievementPC::GetPlatformAchievementID ( int Index, int*
 
 struct SFXName USFXOnlineComponentAchievementPC::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentAchievementPC_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -9757,18 +8482,14 @@ struct SFXName USFXOnlineComponentAchievementPC::GetAPIName ( )
 
 void USFXOnlineComponentAchievementPC::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentAchievementPC_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.OnInitialize
@@ -9778,19 +8499,15 @@ void USFXOnlineComponentAchievementPC::OnRelease ( )
 
 void USFXOnlineComponentAchievementPC::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentAchievementPC_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.IsGranted
@@ -9802,20 +8519,16 @@ void USFXOnlineComponentAchievementPC::OnInitialize ( class USFXOnlineSubsystem*
 
 bool USFXOnlineComponentAchievementPC::IsGranted ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnIsGranted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsGrantedRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.IsGranted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsGranted )
-		pFnIsGranted = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.IsGranted" );
+	UFunction* const pFnIsGranted = pFnIsGrantedRef.Get ( );
 
 	USFXOnlineComponentAchievementPC_execIsGranted_Parms IsGranted_Parms;
 	IsGranted_Parms.LocalUserNum = LocalUserNum;
 	IsGranted_Parms.AchievementId = AchievementId;
 
-	pFnIsGranted->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsGranted, &IsGranted_Parms, NULL );
-
-	pFnIsGranted->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsGranted, &IsGranted_Parms ) )
+		this->ProcessEvent ( pFnIsGranted, &IsGranted_Parms, NULL );
 
 	return IsGranted_Parms.ReturnValue;
 };
@@ -9828,32 +8541,25 @@ bool USFXOnlineComponentAchievementPC::IsGranted ( unsigned char LocalUserNum, i
 
 void USFXOnlineComponentAchievementPC::Grant ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnGrant = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGrantRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.Grant", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGrant )
-		pFnGrant = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.Grant" );
+	UFunction* const pFnGrant = pFnGrantRef.Get ( );
 
 	USFXOnlineComponentAchievementPC_execGrant_Parms Grant_Parms;
 	Grant_Parms.LocalUserNum = LocalUserNum;
 	Grant_Parms.AchievementId = AchievementId;
 
-	pFnGrant->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGrant, &Grant_Parms, NULL );
-
-	pFnGrant->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGrant, &Grant_Parms ) )
+		this->ProcessEvent ( pFnGrant, &Grant_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineComponentPlatformPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentPlatformPC::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentPlatformPC", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentPlatformPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentPlatformPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetRebootUserData
@@ -9863,18 +8569,14 @@ class UClass* USFXOnlineComponentPlatformPC::StaticClass()
 
 int USFXOnlineComponentPlatformPC::GetRebootUserData ( )
 {
-	static UFunction* pFnGetRebootUserData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetRebootUserDataRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetRebootUserData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetRebootUserData )
-		pFnGetRebootUserData = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetRebootUserData" );
+	UFunction* const pFnGetRebootUserData = pFnGetRebootUserDataRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execGetRebootUserData_Parms GetRebootUserData_Parms;
 
-	pFnGetRebootUserData->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetRebootUserData, &GetRebootUserData_Parms, NULL );
-
-	pFnGetRebootUserData->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetRebootUserData, &GetRebootUserData_Parms ) )
+		this->ProcessEvent ( pFnGetRebootUserData, &GetRebootUserData_Parms, NULL );
 
 	return GetRebootUserData_Parms.ReturnValue;
 };
@@ -9886,18 +8588,14 @@ int USFXOnlineComponentPlatformPC::GetRebootUserData ( )
 
 bool USFXOnlineComponentPlatformPC::WasRebootedFromOSCodeRedemptionUI ( )
 {
-	static UFunction* pFnWasRebootedFromOSCodeRedemptionUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWasRebootedFromOSCodeRedemptionUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.WasRebootedFromOSCodeRedemptionUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWasRebootedFromOSCodeRedemptionUI )
-		pFnWasRebootedFromOSCodeRedemptionUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.WasRebootedFromOSCodeRedemptionUI" );
+	UFunction* const pFnWasRebootedFromOSCodeRedemptionUI = pFnWasRebootedFromOSCodeRedemptionUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execWasRebootedFromOSCodeRedemptionUI_Parms WasRebootedFromOSCodeRedemptionUI_Parms;
 
-	pFnWasRebootedFromOSCodeRedemptionUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms, NULL );
-
-	pFnWasRebootedFromOSCodeRedemptionUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms ) )
+		this->ProcessEvent ( pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms, NULL );
 
 	return WasRebootedFromOSCodeRedemptionUI_Parms.ReturnValue;
 };
@@ -9910,19 +8608,15 @@ bool USFXOnlineComponentPlatformPC::WasRebootedFromOSCodeRedemptionUI ( )
 
 bool USFXOnlineComponentPlatformPC::ShowCodeRedemptionUI ( int UserData )
 {
-	static UFunction* pFnShowCodeRedemptionUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowCodeRedemptionUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowCodeRedemptionUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowCodeRedemptionUI )
-		pFnShowCodeRedemptionUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowCodeRedemptionUI" );
+	UFunction* const pFnShowCodeRedemptionUI = pFnShowCodeRedemptionUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execShowCodeRedemptionUI_Parms ShowCodeRedemptionUI_Parms;
 	ShowCodeRedemptionUI_Parms.UserData = UserData;
 
-	pFnShowCodeRedemptionUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms, NULL );
-
-	pFnShowCodeRedemptionUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms ) )
+		this->ProcessEvent ( pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms, NULL );
 
 	return ShowCodeRedemptionUI_Parms.ReturnValue;
 };
@@ -9934,18 +8628,14 @@ bool USFXOnlineComponentPlatformPC::ShowCodeRedemptionUI ( int UserData )
 
 bool USFXOnlineComponentPlatformPC::ShowStoreUI ( )
 {
-	static UFunction* pFnShowStoreUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowStoreUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowStoreUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowStoreUI )
-		pFnShowStoreUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowStoreUI" );
+	UFunction* const pFnShowStoreUI = pFnShowStoreUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execShowStoreUI_Parms ShowStoreUI_Parms;
 
-	pFnShowStoreUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowStoreUI, &ShowStoreUI_Parms, NULL );
-
-	pFnShowStoreUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowStoreUI, &ShowStoreUI_Parms ) )
+		this->ProcessEvent ( pFnShowStoreUI, &ShowStoreUI_Parms, NULL );
 
 	return ShowStoreUI_Parms.ReturnValue;
 };
@@ -9959,10 +8649,9 @@ bool USFXOnlineComponentPlatformPC::ShowStoreUI ( )
 
 bool USFXOnlineComponentPlatformPC::GetOnlineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOnlineXuid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOnlineXuidRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetOnlineXuid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOnlineXuid )
-		pFnGetOnlineXuid = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetOnlineXuid" );
+	UFunction* const pFnGetOnlineXuid = pFnGetOnlineXuidRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execGetOnlineXuid_Parms GetOnlineXuid_Parms;
 	GetOnlineXuid_Parms.nUserIndex = nUserIndex;
@@ -9970,11 +8659,8 @@ bool USFXOnlineComponentPlatformPC::GetOnlineXuid ( int nUserIndex, struct FUniq
 	if ( oPlayerXuid )
 		memcpy ( &GetOnlineXuid_Parms.oPlayerXuid, oPlayerXuid, 0x8 );
 
-	pFnGetOnlineXuid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetOnlineXuid, &GetOnlineXuid_Parms, NULL );
-
-	pFnGetOnlineXuid->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetOnlineXuid, &GetOnlineXuid_Parms ) )
+		this->ProcessEvent ( pFnGetOnlineXuid, &GetOnlineXuid_Parms, NULL );
 
 	if ( oPlayerXuid )
 		memcpy ( oPlayerXuid, &GetOnlineXuid_Parms.oPlayerXuid, 0x8 );
@@ -9991,10 +8677,9 @@ bool USFXOnlineComponentPlatformPC::GetOnlineXuid ( int nUserIndex, struct FUniq
 
 bool USFXOnlineComponentPlatformPC::GetOfflineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOfflineXuid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOfflineXuidRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetOfflineXuid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOfflineXuid )
-		pFnGetOfflineXuid = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetOfflineXuid" );
+	UFunction* const pFnGetOfflineXuid = pFnGetOfflineXuidRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execGetOfflineXuid_Parms GetOfflineXuid_Parms;
 	GetOfflineXuid_Parms.nUserIndex = nUserIndex;
@@ -10002,11 +8687,8 @@ bool USFXOnlineComponentPlatformPC::GetOfflineXuid ( int nUserIndex, struct FUni
 	if ( oPlayerXuid )
 		memcpy ( &GetOfflineXuid_Parms.oPlayerXuid, oPlayerXuid, 0x8 );
 
-	pFnGetOfflineXuid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetOfflineXuid, &GetOfflineXuid_Parms, NULL );
-
-	pFnGetOfflineXuid->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetOfflineXuid, &GetOfflineXuid_Parms ) )
+		this->ProcessEvent ( pFnGetOfflineXuid, &GetOfflineXuid_Parms, NULL );
 
 	if ( oPlayerXuid )
 		memcpy ( oPlayerXuid, &GetOfflineXuid_Parms.oPlayerXuid, 0x8 );
@@ -10029,10 +8711,9 @@ bool USFXOnlineComponentPlatformPC::GetOfflineXuid ( int nUserIndex, struct FUni
 
 bool USFXOnlineComponentPlatformPC::ShowKeyboardUI ( unsigned char LocalUserNum, FString const& sTitleText, FString const& sDescriptionText, unsigned char nKeyboardType, unsigned long bShouldValidate, unsigned long bRouteThroughConsole, FString const& sDefaultText, int nMaxResultLength )
 {
-	static UFunction* pFnShowKeyboardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowKeyboardUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowKeyboardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowKeyboardUI )
-		pFnShowKeyboardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowKeyboardUI" );
+	UFunction* const pFnShowKeyboardUI = pFnShowKeyboardUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execShowKeyboardUI_Parms ShowKeyboardUI_Parms;
 	ShowKeyboardUI_Parms.LocalUserNum = LocalUserNum;
@@ -10044,11 +8725,8 @@ bool USFXOnlineComponentPlatformPC::ShowKeyboardUI ( unsigned char LocalUserNum,
 	memcpy ( &ShowKeyboardUI_Parms.sDefaultText, &sDefaultText, 0x10 );
 	ShowKeyboardUI_Parms.nMaxResultLength = nMaxResultLength;
 
-	pFnShowKeyboardUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowKeyboardUI, &ShowKeyboardUI_Parms, NULL );
-
-	pFnShowKeyboardUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowKeyboardUI, &ShowKeyboardUI_Parms ) )
+		this->ProcessEvent ( pFnShowKeyboardUI, &ShowKeyboardUI_Parms, NULL );
 
 	return ShowKeyboardUI_Parms.ReturnValue;
 };
@@ -10062,20 +8740,16 @@ bool USFXOnlineComponentPlatformPC::ShowKeyboardUI ( unsigned char LocalUserNum,
 
 bool USFXOnlineComponentPlatformPC::ShowFriendsInviteUI ( unsigned char eLocalUserNum, struct FUniqueNetId const& oPlayerXuid )
 {
-	static UFunction* pFnShowFriendsInviteUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFriendsInviteUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowFriendsInviteUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFriendsInviteUI )
-		pFnShowFriendsInviteUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowFriendsInviteUI" );
+	UFunction* const pFnShowFriendsInviteUI = pFnShowFriendsInviteUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execShowFriendsInviteUI_Parms ShowFriendsInviteUI_Parms;
 	ShowFriendsInviteUI_Parms.eLocalUserNum = eLocalUserNum;
 	memcpy ( &ShowFriendsInviteUI_Parms.oPlayerXuid, &oPlayerXuid, 0x8 );
 
-	pFnShowFriendsInviteUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms, NULL );
-
-	pFnShowFriendsInviteUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms ) )
+		this->ProcessEvent ( pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms, NULL );
 
 	return ShowFriendsInviteUI_Parms.ReturnValue;
 };
@@ -10088,19 +8762,15 @@ bool USFXOnlineComponentPlatformPC::ShowFriendsInviteUI ( unsigned char eLocalUs
 
 bool USFXOnlineComponentPlatformPC::ShowFriendsUI ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnShowFriendsUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFriendsUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowFriendsUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFriendsUI )
-		pFnShowFriendsUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowFriendsUI" );
+	UFunction* const pFnShowFriendsUI = pFnShowFriendsUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execShowFriendsUI_Parms ShowFriendsUI_Parms;
 	ShowFriendsUI_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnShowFriendsUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFriendsUI, &ShowFriendsUI_Parms, NULL );
-
-	pFnShowFriendsUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFriendsUI, &ShowFriendsUI_Parms ) )
+		this->ProcessEvent ( pFnShowFriendsUI, &ShowFriendsUI_Parms, NULL );
 
 	return ShowFriendsUI_Parms.ReturnValue;
 };
@@ -10113,19 +8783,15 @@ bool USFXOnlineComponentPlatformPC::ShowFriendsUI ( unsigned char eLocalUserNum
 
 bool USFXOnlineComponentPlatformPC::ShowAchievementsUI ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnShowAchievementsUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowAchievementsUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowAchievementsUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowAchievementsUI )
-		pFnShowAchievementsUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowAchievementsUI" );
+	UFunction* const pFnShowAchievementsUI = pFnShowAchievementsUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execShowAchievementsUI_Parms ShowAchievementsUI_Parms;
 	ShowAchievementsUI_Parms.byLocalUserNum = byLocalUserNum;
 
-	pFnShowAchievementsUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowAchievementsUI, &ShowAchievementsUI_Parms, NULL );
-
-	pFnShowAchievementsUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowAchievementsUI, &ShowAchievementsUI_Parms ) )
+		this->ProcessEvent ( pFnShowAchievementsUI, &ShowAchievementsUI_Parms, NULL );
 
 	return ShowAchievementsUI_Parms.ReturnValue;
 };
@@ -10139,20 +8805,16 @@ bool USFXOnlineComponentPlatformPC::ShowAchievementsUI ( unsigned char byLocalUs
 
 bool USFXOnlineComponentPlatformPC::ShowFeedbackUI ( unsigned char eLocalUserNum, struct FUniqueNetId const& oPlayerId )
 {
-	static UFunction* pFnShowFeedbackUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFeedbackUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowFeedbackUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFeedbackUI )
-		pFnShowFeedbackUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowFeedbackUI" );
+	UFunction* const pFnShowFeedbackUI = pFnShowFeedbackUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execShowFeedbackUI_Parms ShowFeedbackUI_Parms;
 	ShowFeedbackUI_Parms.eLocalUserNum = eLocalUserNum;
 	memcpy ( &ShowFeedbackUI_Parms.oPlayerId, &oPlayerId, 0x8 );
 
-	pFnShowFeedbackUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFeedbackUI, &ShowFeedbackUI_Parms, NULL );
-
-	pFnShowFeedbackUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFeedbackUI, &ShowFeedbackUI_Parms ) )
+		this->ProcessEvent ( pFnShowFeedbackUI, &ShowFeedbackUI_Parms, NULL );
 
 	return ShowFeedbackUI_Parms.ReturnValue;
 };
@@ -10166,20 +8828,16 @@ bool USFXOnlineComponentPlatformPC::ShowFeedbackUI ( unsigned char eLocalUserNum
 
 bool USFXOnlineComponentPlatformPC::ShowGamerCardUI ( unsigned char eLocalUserNum, struct FUniqueNetId const& oPlayerId )
 {
-	static UFunction* pFnShowGamerCardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowGamerCardUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowGamerCardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowGamerCardUI )
-		pFnShowGamerCardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowGamerCardUI" );
+	UFunction* const pFnShowGamerCardUI = pFnShowGamerCardUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execShowGamerCardUI_Parms ShowGamerCardUI_Parms;
 	ShowGamerCardUI_Parms.eLocalUserNum = eLocalUserNum;
 	memcpy ( &ShowGamerCardUI_Parms.oPlayerId, &oPlayerId, 0x8 );
 
-	pFnShowGamerCardUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowGamerCardUI, &ShowGamerCardUI_Parms, NULL );
-
-	pFnShowGamerCardUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowGamerCardUI, &ShowGamerCardUI_Parms ) )
+		this->ProcessEvent ( pFnShowGamerCardUI, &ShowGamerCardUI_Parms, NULL );
 
 	return ShowGamerCardUI_Parms.ReturnValue;
 };
@@ -10192,19 +8850,15 @@ bool USFXOnlineComponentPlatformPC::ShowGamerCardUI ( unsigned char eLocalUserNu
 
 unsigned char USFXOnlineComponentPlatformPC::CanShowPresenceInformation ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanShowPresenceInformationRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanShowPresenceInformation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanShowPresenceInformation" );
+	UFunction* const pFnCanShowPresenceInformation = pFnCanShowPresenceInformationRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanShowPresenceInformation->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
-
-	pFnCanShowPresenceInformation->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms ) )
+		this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
 
 	return CanShowPresenceInformation_Parms.ReturnValue;
 };
@@ -10217,19 +8871,15 @@ unsigned char USFXOnlineComponentPlatformPC::CanShowPresenceInformation ( unsign
 
 unsigned char USFXOnlineComponentPlatformPC::CanViewPlayerProfiles ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanViewPlayerProfilesRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanViewPlayerProfiles", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanViewPlayerProfiles" );
+	UFunction* const pFnCanViewPlayerProfiles = pFnCanViewPlayerProfilesRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanViewPlayerProfiles->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
-
-	pFnCanViewPlayerProfiles->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms ) )
+		this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
 
 	return CanViewPlayerProfiles_Parms.ReturnValue;
 };
@@ -10242,19 +8892,15 @@ unsigned char USFXOnlineComponentPlatformPC::CanViewPlayerProfiles ( unsigned ch
 
 unsigned char USFXOnlineComponentPlatformPC::CanPurchaseContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPurchaseContentRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanPurchaseContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanPurchaseContent" );
+	UFunction* const pFnCanPurchaseContent = pFnCanPurchaseContentRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanPurchaseContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
-
-	pFnCanPurchaseContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPurchaseContent, &CanPurchaseContent_Parms ) )
+		this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
 
 	return CanPurchaseContent_Parms.ReturnValue;
 };
@@ -10267,19 +8913,15 @@ unsigned char USFXOnlineComponentPlatformPC::CanPurchaseContent ( unsigned char
 
 unsigned char USFXOnlineComponentPlatformPC::CanDownloadUserContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanDownloadUserContentRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanDownloadUserContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanDownloadUserContent" );
+	UFunction* const pFnCanDownloadUserContent = pFnCanDownloadUserContentRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanDownloadUserContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
-
-	pFnCanDownloadUserContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanDownloadUserContent, &CanDownloadUserContent_Parms ) )
+		this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
 
 	return CanDownloadUserContent_Parms.ReturnValue;
 };
@@ -10292,19 +8934,15 @@ unsigned char USFXOnlineComponentPlatformPC::CanDownloadUserContent ( unsigned c
 
 unsigned char USFXOnlineComponentPlatformPC::CanCommunicate ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanCommunicate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanCommunicateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanCommunicate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanCommunicate" );
+	UFunction* const pFnCanCommunicate = pFnCanCommunicateRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanCommunicate->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
-
-	pFnCanCommunicate->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanCommunicate, &CanCommunicate_Parms ) )
+		this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
 
 	return CanCommunicate_Parms.ReturnValue;
 };
@@ -10317,19 +8955,15 @@ unsigned char USFXOnlineComponentPlatformPC::CanCommunicate ( unsigned char eLoc
 
 unsigned char USFXOnlineComponentPlatformPC::CanPlayOnline ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPlayOnlineRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanPlayOnline", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanPlayOnline" );
+	UFunction* const pFnCanPlayOnline = pFnCanPlayOnlineRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanPlayOnline->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
-
-	pFnCanPlayOnline->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPlayOnline, &CanPlayOnline_Parms ) )
+		this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
 
 	return CanPlayOnline_Parms.ReturnValue;
 };
@@ -10344,10 +8978,9 @@ unsigned char USFXOnlineComponentPlatformPC::CanPlayOnline ( unsigned char eLoca
 
 void USFXOnlineComponentPlatformPC::SetRichPresence ( unsigned char eLocalUserNum, int nPresenceMode, TArray<struct FLocalizedStringSetting>* aLocalizedStringSettings, TArray<struct FSettingsProperty>* aProperties )
 {
-	static UFunction* pFnSetRichPresence = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetRichPresenceRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.SetRichPresence", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetRichPresence )
-		pFnSetRichPresence = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.SetRichPresence" );
+	UFunction* const pFnSetRichPresence = pFnSetRichPresenceRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execSetRichPresence_Parms SetRichPresence_Parms;
 	SetRichPresence_Parms.eLocalUserNum = eLocalUserNum;
@@ -10359,11 +8992,8 @@ void USFXOnlineComponentPlatformPC::SetRichPresence ( unsigned char eLocalUserNu
 	if ( aProperties )
 		memcpy ( &SetRichPresence_Parms.aProperties, aProperties, 0x10 );
 
-	pFnSetRichPresence->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetRichPresence, &SetRichPresence_Parms, NULL );
-
-	pFnSetRichPresence->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetRichPresence, &SetRichPresence_Parms ) )
+		this->ProcessEvent ( pFnSetRichPresence, &SetRichPresence_Parms, NULL );
 
 	if ( aLocalizedStringSettings )
 		memcpy ( aLocalizedStringSettings, &SetRichPresence_Parms.aLocalizedStringSettings, 0x10 );
@@ -10380,19 +9010,15 @@ void USFXOnlineComponentPlatformPC::SetRichPresence ( unsigned char eLocalUserNu
 
 bool USFXOnlineComponentPlatformPC::ShowLoginUI ( unsigned long bShowOnlineOnly )
 {
-	static UFunction* pFnShowLoginUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowLoginUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowLoginUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowLoginUI )
-		pFnShowLoginUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowLoginUI" );
+	UFunction* const pFnShowLoginUI = pFnShowLoginUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execShowLoginUI_Parms ShowLoginUI_Parms;
 	ShowLoginUI_Parms.bShowOnlineOnly = bShowOnlineOnly;
 
-	pFnShowLoginUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowLoginUI, &ShowLoginUI_Parms, NULL );
-
-	pFnShowLoginUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowLoginUI, &ShowLoginUI_Parms ) )
+		this->ProcessEvent ( pFnShowLoginUI, &ShowLoginUI_Parms, NULL );
 
 	return ShowLoginUI_Parms.ReturnValue;
 };
@@ -10405,19 +9031,15 @@ bool USFXOnlineComponentPlatformPC::ShowLoginUI ( unsigned long bShowOnlineOnly
 
 unsigned char USFXOnlineComponentPlatformPC::GetLoginStatus ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLoginStatusRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetLoginStatus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetLoginStatus" );
+	UFunction* const pFnGetLoginStatus = pFnGetLoginStatusRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execGetLoginStatus_Parms GetLoginStatus_Parms;
 	GetLoginStatus_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnGetLoginStatus->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetLoginStatus, &GetLoginStatus_Parms, NULL );
-
-	pFnGetLoginStatus->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetLoginStatus, &GetLoginStatus_Parms ) )
+		this->ProcessEvent ( pFnGetLoginStatus, &GetLoginStatus_Parms, NULL );
 
 	return GetLoginStatus_Parms.ReturnValue;
 };
@@ -10431,20 +9053,16 @@ unsigned char USFXOnlineComponentPlatformPC::GetLoginStatus ( unsigned char eLoc
 
 bool USFXOnlineComponentPlatformPC::AddRecentPlayer ( struct FUniqueNetId const& oPlayerId, FString const& sDescription )
 {
-	static UFunction* pFnAddRecentPlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddRecentPlayerRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.AddRecentPlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddRecentPlayer )
-		pFnAddRecentPlayer = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.AddRecentPlayer" );
+	UFunction* const pFnAddRecentPlayer = pFnAddRecentPlayerRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execAddRecentPlayer_Parms AddRecentPlayer_Parms;
 	memcpy ( &AddRecentPlayer_Parms.oPlayerId, &oPlayerId, 0x8 );
 	memcpy ( &AddRecentPlayer_Parms.sDescription, &sDescription, 0x10 );
 
-	pFnAddRecentPlayer->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddRecentPlayer, &AddRecentPlayer_Parms, NULL );
-
-	pFnAddRecentPlayer->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAddRecentPlayer, &AddRecentPlayer_Parms ) )
+		this->ProcessEvent ( pFnAddRecentPlayer, &AddRecentPlayer_Parms, NULL );
 
 	return AddRecentPlayer_Parms.ReturnValue;
 };
@@ -10456,18 +9074,14 @@ bool USFXOnlineComponentPlatformPC::AddRecentPlayer ( struct FUniqueNetId const&
 
 struct SFXName USFXOnlineComponentPlatformPC::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -10478,18 +9092,14 @@ struct SFXName USFXOnlineComponentPlatformPC::GetAPIName ( )
 
 void USFXOnlineComponentPlatformPC::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.OnInitialize
@@ -10499,31 +9109,24 @@ void USFXOnlineComponentPlatformPC::OnRelease ( )
 
 void USFXOnlineComponentPlatformPC::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentPlatformPC_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineComponentAchievementXenon::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentAchievementXenon::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentAchievementXenon", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentAchievementXenon::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentAchievementXenon" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.GetTitleAchievementID
@@ -10535,10 +9138,9 @@ class UClass* USFXOnlineComponentAchievementXenon::StaticClass()
 
 int USFXOnlineComponentAchievementXenon::GetTitleAchievementID ( int Index, int* SetIndex )
 {
-	static UFunction* pFnGetTitleAchievementID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTitleAchievementIDRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.GetTitleAchievementID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTitleAchievementID )
-		pFnGetTitleAchievementID = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.GetTitleAchievementID" );
+	UFunction* const pFnGetTitleAchievementID = pFnGetTitleAchievementIDRef.Get ( );
 
 	USFXOnlineComponentAchievementXenon_execGetTitleAchievementID_Parms GetTitleAchievementID_Parms;
 	GetTitleAchievementID_Parms.Index = Index;
@@ -10546,11 +9148,8 @@ int USFXOnlineComponentAchievementXenon::GetTitleAchievementID ( int Index, int*
 	if ( SetIndex )
 		GetTitleAchievementID_Parms.SetIndex = *SetIndex;
 
-	pFnGetTitleAchievementID->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetTitleAchievementID, &GetTitleAchievementID_Parms, NULL );
-
-	pFnGetTitleAchievementID->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetTitleAchievementID, &GetTitleAchievementID_Parms ) )
+		this->ProcessEvent ( pFnGetTitleAchievementID, &GetTitleAchievementID_Parms, NULL );
 
 	if ( SetIndex )
 		*SetIndex = GetTitleAchievementID_Parms.SetIndex;
@@ -10567,10 +9166,9 @@ int USFXOnlineComponentAchievementXenon::GetTitleAchievementID ( int Index, int*
 
 int USFXOnlineComponentAchievementXenon::GetPlatformAchievementID ( int Index, int* SetIndex )
 {
-	static UFunction* pFnGetPlatformAchievementID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPlatformAchievementIDRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.GetPlatformAchievementID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPlatformAchievementID )
-		pFnGetPlatformAchievementID = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.GetPlatformAchievementID" );
+	UFunction* const pFnGetPlatformAchievementID = pFnGetPlatformAchievementIDRef.Get ( );
 
 	USFXOnlineComponentAchievementXenon_execGetPlatformAchievementID_Parms GetPlatformAchievementID_Parms;
 	GetPlatformAchievementID_Parms.Index = Index;
@@ -10578,11 +9176,8 @@ int USFXOnlineComponentAchievementXenon::GetPlatformAchievementID ( int Index, i
 	if ( SetIndex )
 		GetPlatformAchievementID_Parms.SetIndex = *SetIndex;
 
-	pFnGetPlatformAchievementID->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms, NULL );
-
-	pFnGetPlatformAchievementID->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms ) )
+		this->ProcessEvent ( pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms, NULL );
 
 	if ( SetIndex )
 		*SetIndex = GetPlatformAchievementID_Parms.SetIndex;
@@ -10597,18 +9192,14 @@ int USFXOnlineComponentAchievementXenon::GetPlatformAchievementID ( int Index, i
 
 struct SFXName USFXOnlineComponentAchievementXenon::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentAchievementXenon_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -10619,18 +9210,14 @@ struct SFXName USFXOnlineComponentAchievementXenon::GetAPIName ( )
 
 void USFXOnlineComponentAchievementXenon::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentAchievementXenon_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.OnInitialize
@@ -10640,19 +9227,15 @@ void USFXOnlineComponentAchievementXenon::OnRelease ( )
 
 void USFXOnlineComponentAchievementXenon::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentAchievementXenon_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.IsGranted
@@ -10664,20 +9247,16 @@ void USFXOnlineComponentAchievementXenon::OnInitialize ( class USFXOnlineSubsyst
 
 bool USFXOnlineComponentAchievementXenon::IsGranted ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnIsGranted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsGrantedRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.IsGranted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsGranted )
-		pFnIsGranted = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.IsGranted" );
+	UFunction* const pFnIsGranted = pFnIsGrantedRef.Get ( );
 
 	USFXOnlineComponentAchievementXenon_execIsGranted_Parms IsGranted_Parms;
 	IsGranted_Parms.LocalUserNum = LocalUserNum;
 	IsGranted_Parms.AchievementId = AchievementId;
 
-	pFnIsGranted->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsGranted, &IsGranted_Parms, NULL );
-
-	pFnIsGranted->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsGranted, &IsGranted_Parms ) )
+		this->ProcessEvent ( pFnIsGranted, &IsGranted_Parms, NULL );
 
 	return IsGranted_Parms.ReturnValue;
 };
@@ -10690,32 +9269,25 @@ bool USFXOnlineComponentAchievementXenon::IsGranted ( unsigned char LocalUserNum
 
 void USFXOnlineComponentAchievementXenon::Grant ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnGrant = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGrantRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.Grant", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGrant )
-		pFnGrant = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.Grant" );
+	UFunction* const pFnGrant = pFnGrantRef.Get ( );
 
 	USFXOnlineComponentAchievementXenon_execGrant_Parms Grant_Parms;
 	Grant_Parms.LocalUserNum = LocalUserNum;
 	Grant_Parms.AchievementId = AchievementId;
 
-	pFnGrant->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGrant, &Grant_Parms, NULL );
-
-	pFnGrant->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGrant, &Grant_Parms ) )
+		this->ProcessEvent ( pFnGrant, &Grant_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineComponentPlatformXenon::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentPlatformXenon::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentPlatformXenon", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentPlatformXenon::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentPlatformXenon" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetRebootUserData
@@ -10725,18 +9297,14 @@ class UClass* USFXOnlineComponentPlatformXenon::StaticClass()
 
 int USFXOnlineComponentPlatformXenon::GetRebootUserData ( )
 {
-	static UFunction* pFnGetRebootUserData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetRebootUserDataRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetRebootUserData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetRebootUserData )
-		pFnGetRebootUserData = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetRebootUserData" );
+	UFunction* const pFnGetRebootUserData = pFnGetRebootUserDataRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execGetRebootUserData_Parms GetRebootUserData_Parms;
 
-	pFnGetRebootUserData->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetRebootUserData, &GetRebootUserData_Parms, NULL );
-
-	pFnGetRebootUserData->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetRebootUserData, &GetRebootUserData_Parms ) )
+		this->ProcessEvent ( pFnGetRebootUserData, &GetRebootUserData_Parms, NULL );
 
 	return GetRebootUserData_Parms.ReturnValue;
 };
@@ -10748,18 +9316,14 @@ int USFXOnlineComponentPlatformXenon::GetRebootUserData ( )
 
 bool USFXOnlineComponentPlatformXenon::WasRebootedFromOSCodeRedemptionUI ( )
 {
-	static UFunction* pFnWasRebootedFromOSCodeRedemptionUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWasRebootedFromOSCodeRedemptionUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.WasRebootedFromOSCodeRedemptionUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWasRebootedFromOSCodeRedemptionUI )
-		pFnWasRebootedFromOSCodeRedemptionUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.WasRebootedFromOSCodeRedemptionUI" );
+	UFunction* const pFnWasRebootedFromOSCodeRedemptionUI = pFnWasRebootedFromOSCodeRedemptionUIRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execWasRebootedFromOSCodeRedemptionUI_Parms WasRebootedFromOSCodeRedemptionUI_Parms;
 
-	pFnWasRebootedFromOSCodeRedemptionUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms, NULL );
-
-	pFnWasRebootedFromOSCodeRedemptionUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms ) )
+		this->ProcessEvent ( pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms, NULL );
 
 	return WasRebootedFromOSCodeRedemptionUI_Parms.ReturnValue;
 };
@@ -10772,19 +9336,15 @@ bool USFXOnlineComponentPlatformXenon::WasRebootedFromOSCodeRedemptionUI ( )
 
 bool USFXOnlineComponentPlatformXenon::ShowCodeRedemptionUI ( int UserData )
 {
-	static UFunction* pFnShowCodeRedemptionUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowCodeRedemptionUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowCodeRedemptionUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowCodeRedemptionUI )
-		pFnShowCodeRedemptionUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowCodeRedemptionUI" );
+	UFunction* const pFnShowCodeRedemptionUI = pFnShowCodeRedemptionUIRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execShowCodeRedemptionUI_Parms ShowCodeRedemptionUI_Parms;
 	ShowCodeRedemptionUI_Parms.UserData = UserData;
 
-	pFnShowCodeRedemptionUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms, NULL );
-
-	pFnShowCodeRedemptionUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms ) )
+		this->ProcessEvent ( pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms, NULL );
 
 	return ShowCodeRedemptionUI_Parms.ReturnValue;
 };
@@ -10796,18 +9356,14 @@ bool USFXOnlineComponentPlatformXenon::ShowCodeRedemptionUI ( int UserData )
 
 bool USFXOnlineComponentPlatformXenon::ShowStoreUI ( )
 {
-	static UFunction* pFnShowStoreUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowStoreUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowStoreUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowStoreUI )
-		pFnShowStoreUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowStoreUI" );
+	UFunction* const pFnShowStoreUI = pFnShowStoreUIRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execShowStoreUI_Parms ShowStoreUI_Parms;
 
-	pFnShowStoreUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowStoreUI, &ShowStoreUI_Parms, NULL );
-
-	pFnShowStoreUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowStoreUI, &ShowStoreUI_Parms ) )
+		this->ProcessEvent ( pFnShowStoreUI, &ShowStoreUI_Parms, NULL );
 
 	return ShowStoreUI_Parms.ReturnValue;
 };
@@ -10821,10 +9377,9 @@ bool USFXOnlineComponentPlatformXenon::ShowStoreUI ( )
 
 bool USFXOnlineComponentPlatformXenon::GetOnlineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOnlineXuid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOnlineXuidRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetOnlineXuid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOnlineXuid )
-		pFnGetOnlineXuid = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetOnlineXuid" );
+	UFunction* const pFnGetOnlineXuid = pFnGetOnlineXuidRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execGetOnlineXuid_Parms GetOnlineXuid_Parms;
 	GetOnlineXuid_Parms.nUserIndex = nUserIndex;
@@ -10832,11 +9387,8 @@ bool USFXOnlineComponentPlatformXenon::GetOnlineXuid ( int nUserIndex, struct FU
 	if ( oPlayerXuid )
 		memcpy ( &GetOnlineXuid_Parms.oPlayerXuid, oPlayerXuid, 0x8 );
 
-	pFnGetOnlineXuid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetOnlineXuid, &GetOnlineXuid_Parms, NULL );
-
-	pFnGetOnlineXuid->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetOnlineXuid, &GetOnlineXuid_Parms ) )
+		this->ProcessEvent ( pFnGetOnlineXuid, &GetOnlineXuid_Parms, NULL );
 
 	if ( oPlayerXuid )
 		memcpy ( oPlayerXuid, &GetOnlineXuid_Parms.oPlayerXuid, 0x8 );
@@ -10853,10 +9405,9 @@ bool USFXOnlineComponentPlatformXenon::GetOnlineXuid ( int nUserIndex, struct FU
 
 bool USFXOnlineComponentPlatformXenon::GetOfflineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOfflineXuid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOfflineXuidRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetOfflineXuid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOfflineXuid )
-		pFnGetOfflineXuid = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetOfflineXuid" );
+	UFunction* const pFnGetOfflineXuid = pFnGetOfflineXuidRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execGetOfflineXuid_Parms GetOfflineXuid_Parms;
 	GetOfflineXuid_Parms.nUserIndex = nUserIndex;
@@ -10864,11 +9415,8 @@ bool USFXOnlineComponentPlatformXenon::GetOfflineXuid ( int nUserIndex, struct F
 	if ( oPlayerXuid )
 		memcpy ( &GetOfflineXuid_Parms.oPlayerXuid, oPlayerXuid, 0x8 );
 
-	pFnGetOfflineXuid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetOfflineXuid, &GetOfflineXuid_Parms, NULL );
-
-	pFnGetOfflineXuid->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetOfflineXuid, &GetOfflineXuid_Parms ) )
+		this->ProcessEvent ( pFnGetOfflineXuid, &GetOfflineXuid_Parms, NULL );
 
 	if ( oPlayerXuid )
 		memcpy ( oPlayerXuid, &GetOfflineXuid_Parms.oPlayerXuid, 0x8 );
@@ -10891,10 +9439,9 @@ bool USFXOnlineComponentPlatformXenon::GetOfflineXuid ( int nUserIndex, struct F
 
 bool USFXOnlineComponentPlatformXenon::ShowKeyboardUI ( unsigned char LocalUserNum, FString const& sTitleText, FString const& sDescriptionText, unsigned char nKeyboardType, unsigned long bShouldValidate, unsigned long bRouteThroughConsole, FString const& sDefaultText, int nMaxResultLength )
 {
-	static UFunction* pFnShowKeyboardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowKeyboardUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowKeyboardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowKeyboardUI )
-		pFnShowKeyboardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowKeyboardUI" );
+	UFunction* const pFnShowKeyboardUI = pFnShowKeyboardUIRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execShowKeyboardUI_Parms ShowKeyboardUI_Parms;
 	ShowKeyboardUI_Parms.LocalUserNum = LocalUserNum;
@@ -10906,11 +9453,8 @@ bool USFXOnlineComponentPlatformXenon::ShowKeyboardUI ( unsigned char LocalUserN
 	memcpy ( &ShowKeyboardUI_Parms.sDefaultText, &sDefaultText, 0x10 );
 	ShowKeyboardUI_Parms.nMaxResultLength = nMaxResultLength;
 
-	pFnShowKeyboardUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowKeyboardUI, &ShowKeyboardUI_Parms, NULL );
-
-	pFnShowKeyboardUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowKeyboardUI, &ShowKeyboardUI_Parms ) )
+		this->ProcessEvent ( pFnShowKeyboardUI, &ShowKeyboardUI_Parms, NULL );
 
 	return ShowKeyboardUI_Parms.ReturnValue;
 };
@@ -10924,20 +9468,16 @@ bool USFXOnlineComponentPlatformXenon::ShowKeyboardUI ( unsigned char LocalUserN
 
 bool USFXOnlineComponentPlatformXenon::ShowFriendsInviteUI ( unsigned char eLocalUserNum, struct FUniqueNetId const& oPlayerXuid )
 {
-	static UFunction* pFnShowFriendsInviteUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFriendsInviteUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowFriendsInviteUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFriendsInviteUI )
-		pFnShowFriendsInviteUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowFriendsInviteUI" );
+	UFunction* const pFnShowFriendsInviteUI = pFnShowFriendsInviteUIRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execShowFriendsInviteUI_Parms ShowFriendsInviteUI_Parms;
 	ShowFriendsInviteUI_Parms.eLocalUserNum = eLocalUserNum;
 	memcpy ( &ShowFriendsInviteUI_Parms.oPlayerXuid, &oPlayerXuid, 0x8 );
 
-	pFnShowFriendsInviteUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms, NULL );
-
-	pFnShowFriendsInviteUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms ) )
+		this->ProcessEvent ( pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms, NULL );
 
 	return ShowFriendsInviteUI_Parms.ReturnValue;
 };
@@ -10950,19 +9490,15 @@ bool USFXOnlineComponentPlatformXenon::ShowFriendsInviteUI ( unsigned char eLoca
 
 bool USFXOnlineComponentPlatformXenon::ShowFriendsUI ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnShowFriendsUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFriendsUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowFriendsUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFriendsUI )
-		pFnShowFriendsUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowFriendsUI" );
+	UFunction* const pFnShowFriendsUI = pFnShowFriendsUIRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execShowFriendsUI_Parms ShowFriendsUI_Parms;
 	ShowFriendsUI_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnShowFriendsUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFriendsUI, &ShowFriendsUI_Parms, NULL );
-
-	pFnShowFriendsUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFriendsUI, &ShowFriendsUI_Parms ) )
+		this->ProcessEvent ( pFnShowFriendsUI, &ShowFriendsUI_Parms, NULL );
 
 	return ShowFriendsUI_Parms.ReturnValue;
 };
@@ -10975,19 +9511,15 @@ bool USFXOnlineComponentPlatformXenon::ShowFriendsUI ( unsigned char eLocalUserN
 
 bool USFXOnlineComponentPlatformXenon::ShowAchievementsUI ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnShowAchievementsUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowAchievementsUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowAchievementsUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowAchievementsUI )
-		pFnShowAchievementsUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowAchievementsUI" );
+	UFunction* const pFnShowAchievementsUI = pFnShowAchievementsUIRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execShowAchievementsUI_Parms ShowAchievementsUI_Parms;
 	ShowAchievementsUI_Parms.byLocalUserNum = byLocalUserNum;
 
-	pFnShowAchievementsUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowAchievementsUI, &ShowAchievementsUI_Parms, NULL );
-
-	pFnShowAchievementsUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowAchievementsUI, &ShowAchievementsUI_Parms ) )
+		this->ProcessEvent ( pFnShowAchievementsUI, &ShowAchievementsUI_Parms, NULL );
 
 	return ShowAchievementsUI_Parms.ReturnValue;
 };
@@ -11001,20 +9533,16 @@ bool USFXOnlineComponentPlatformXenon::ShowAchievementsUI ( unsigned char byLoca
 
 bool USFXOnlineComponentPlatformXenon::ShowFeedbackUI ( unsigned char eLocalUserNum, struct FUniqueNetId const& oPlayerXuid )
 {
-	static UFunction* pFnShowFeedbackUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFeedbackUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowFeedbackUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFeedbackUI )
-		pFnShowFeedbackUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowFeedbackUI" );
+	UFunction* const pFnShowFeedbackUI = pFnShowFeedbackUIRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execShowFeedbackUI_Parms ShowFeedbackUI_Parms;
 	ShowFeedbackUI_Parms.eLocalUserNum = eLocalUserNum;
 	memcpy ( &ShowFeedbackUI_Parms.oPlayerXuid, &oPlayerXuid, 0x8 );
 
-	pFnShowFeedbackUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFeedbackUI, &ShowFeedbackUI_Parms, NULL );
-
-	pFnShowFeedbackUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFeedbackUI, &ShowFeedbackUI_Parms ) )
+		this->ProcessEvent ( pFnShowFeedbackUI, &ShowFeedbackUI_Parms, NULL );
 
 	return ShowFeedbackUI_Parms.ReturnValue;
 };
@@ -11028,20 +9556,16 @@ bool USFXOnlineComponentPlatformXenon::ShowFeedbackUI ( unsigned char eLocalUser
 
 bool USFXOnlineComponentPlatformXenon::ShowGamerCardUI ( unsigned char eLocalUserNum, struct FUniqueNetId const& oPlayerXuid )
 {
-	static UFunction* pFnShowGamerCardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowGamerCardUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowGamerCardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowGamerCardUI )
-		pFnShowGamerCardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowGamerCardUI" );
+	UFunction* const pFnShowGamerCardUI = pFnShowGamerCardUIRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execShowGamerCardUI_Parms ShowGamerCardUI_Parms;
 	ShowGamerCardUI_Parms.eLocalUserNum = eLocalUserNum;
 	memcpy ( &ShowGamerCardUI_Parms.oPlayerXuid, &oPlayerXuid, 0x8 );
 
-	pFnShowGamerCardUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowGamerCardUI, &ShowGamerCardUI_Parms, NULL );
-
-	pFnShowGamerCardUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowGamerCardUI, &ShowGamerCardUI_Parms ) )
+		this->ProcessEvent ( pFnShowGamerCardUI, &ShowGamerCardUI_Parms, NULL );
 
 	return ShowGamerCardUI_Parms.ReturnValue;
 };
@@ -11054,19 +9578,15 @@ bool USFXOnlineComponentPlatformXenon::ShowGamerCardUI ( unsigned char eLocalUse
 
 unsigned char USFXOnlineComponentPlatformXenon::CanShowPresenceInformation ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanShowPresenceInformationRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanShowPresenceInformation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanShowPresenceInformation" );
+	UFunction* const pFnCanShowPresenceInformation = pFnCanShowPresenceInformationRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanShowPresenceInformation->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
-
-	pFnCanShowPresenceInformation->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms ) )
+		this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
 
 	return CanShowPresenceInformation_Parms.ReturnValue;
 };
@@ -11079,19 +9599,15 @@ unsigned char USFXOnlineComponentPlatformXenon::CanShowPresenceInformation ( uns
 
 unsigned char USFXOnlineComponentPlatformXenon::CanViewPlayerProfiles ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanViewPlayerProfilesRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanViewPlayerProfiles", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanViewPlayerProfiles" );
+	UFunction* const pFnCanViewPlayerProfiles = pFnCanViewPlayerProfilesRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanViewPlayerProfiles->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
-
-	pFnCanViewPlayerProfiles->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms ) )
+		this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
 
 	return CanViewPlayerProfiles_Parms.ReturnValue;
 };
@@ -11104,19 +9620,15 @@ unsigned char USFXOnlineComponentPlatformXenon::CanViewPlayerProfiles ( unsigned
 
 unsigned char USFXOnlineComponentPlatformXenon::CanPurchaseContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPurchaseContentRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanPurchaseContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanPurchaseContent" );
+	UFunction* const pFnCanPurchaseContent = pFnCanPurchaseContentRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanPurchaseContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
-
-	pFnCanPurchaseContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPurchaseContent, &CanPurchaseContent_Parms ) )
+		this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
 
 	return CanPurchaseContent_Parms.ReturnValue;
 };
@@ -11129,19 +9641,15 @@ unsigned char USFXOnlineComponentPlatformXenon::CanPurchaseContent ( unsigned ch
 
 unsigned char USFXOnlineComponentPlatformXenon::CanDownloadUserContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanDownloadUserContentRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanDownloadUserContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanDownloadUserContent" );
+	UFunction* const pFnCanDownloadUserContent = pFnCanDownloadUserContentRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanDownloadUserContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
-
-	pFnCanDownloadUserContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanDownloadUserContent, &CanDownloadUserContent_Parms ) )
+		this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
 
 	return CanDownloadUserContent_Parms.ReturnValue;
 };
@@ -11154,19 +9662,15 @@ unsigned char USFXOnlineComponentPlatformXenon::CanDownloadUserContent ( unsigne
 
 unsigned char USFXOnlineComponentPlatformXenon::CanCommunicate ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanCommunicate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanCommunicateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanCommunicate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanCommunicate" );
+	UFunction* const pFnCanCommunicate = pFnCanCommunicateRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanCommunicate->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
-
-	pFnCanCommunicate->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanCommunicate, &CanCommunicate_Parms ) )
+		this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
 
 	return CanCommunicate_Parms.ReturnValue;
 };
@@ -11179,19 +9683,15 @@ unsigned char USFXOnlineComponentPlatformXenon::CanCommunicate ( unsigned char e
 
 unsigned char USFXOnlineComponentPlatformXenon::CanPlayOnline ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPlayOnlineRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanPlayOnline", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanPlayOnline" );
+	UFunction* const pFnCanPlayOnline = pFnCanPlayOnlineRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanPlayOnline->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
-
-	pFnCanPlayOnline->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPlayOnline, &CanPlayOnline_Parms ) )
+		this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
 
 	return CanPlayOnline_Parms.ReturnValue;
 };
@@ -11206,10 +9706,9 @@ unsigned char USFXOnlineComponentPlatformXenon::CanPlayOnline ( unsigned char eL
 
 void USFXOnlineComponentPlatformXenon::SetRichPresence ( unsigned char eLocalUserNum, int nPresenceMode, TArray<struct FLocalizedStringSetting>* aLocalizedStringSettings, TArray<struct FSettingsProperty>* aProperties )
 {
-	static UFunction* pFnSetRichPresence = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetRichPresenceRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.SetRichPresence", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetRichPresence )
-		pFnSetRichPresence = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.SetRichPresence" );
+	UFunction* const pFnSetRichPresence = pFnSetRichPresenceRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execSetRichPresence_Parms SetRichPresence_Parms;
 	SetRichPresence_Parms.eLocalUserNum = eLocalUserNum;
@@ -11221,11 +9720,8 @@ void USFXOnlineComponentPlatformXenon::SetRichPresence ( unsigned char eLocalUse
 	if ( aProperties )
 		memcpy ( &SetRichPresence_Parms.aProperties, aProperties, 0x10 );
 
-	pFnSetRichPresence->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetRichPresence, &SetRichPresence_Parms, NULL );
-
-	pFnSetRichPresence->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetRichPresence, &SetRichPresence_Parms ) )
+		this->ProcessEvent ( pFnSetRichPresence, &SetRichPresence_Parms, NULL );
 
 	if ( aLocalizedStringSettings )
 		memcpy ( aLocalizedStringSettings, &SetRichPresence_Parms.aLocalizedStringSettings, 0x10 );
@@ -11242,19 +9738,15 @@ void USFXOnlineComponentPlatformXenon::SetRichPresence ( unsigned char eLocalUse
 
 bool USFXOnlineComponentPlatformXenon::ShowLoginUI ( unsigned long bShowOnlineOnly )
 {
-	static UFunction* pFnShowLoginUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowLoginUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowLoginUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowLoginUI )
-		pFnShowLoginUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowLoginUI" );
+	UFunction* const pFnShowLoginUI = pFnShowLoginUIRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execShowLoginUI_Parms ShowLoginUI_Parms;
 	ShowLoginUI_Parms.bShowOnlineOnly = bShowOnlineOnly;
 
-	pFnShowLoginUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowLoginUI, &ShowLoginUI_Parms, NULL );
-
-	pFnShowLoginUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowLoginUI, &ShowLoginUI_Parms ) )
+		this->ProcessEvent ( pFnShowLoginUI, &ShowLoginUI_Parms, NULL );
 
 	return ShowLoginUI_Parms.ReturnValue;
 };
@@ -11267,19 +9759,15 @@ bool USFXOnlineComponentPlatformXenon::ShowLoginUI ( unsigned long bShowOnlineOn
 
 unsigned char USFXOnlineComponentPlatformXenon::GetLoginStatus ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLoginStatusRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetLoginStatus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetLoginStatus" );
+	UFunction* const pFnGetLoginStatus = pFnGetLoginStatusRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execGetLoginStatus_Parms GetLoginStatus_Parms;
 	GetLoginStatus_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnGetLoginStatus->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetLoginStatus, &GetLoginStatus_Parms, NULL );
-
-	pFnGetLoginStatus->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetLoginStatus, &GetLoginStatus_Parms ) )
+		this->ProcessEvent ( pFnGetLoginStatus, &GetLoginStatus_Parms, NULL );
 
 	return GetLoginStatus_Parms.ReturnValue;
 };
@@ -11290,18 +9778,14 @@ unsigned char USFXOnlineComponentPlatformXenon::GetLoginStatus ( unsigned char e
 
 void USFXOnlineComponentPlatformXenon::TickAsyncTasks ( )
 {
-	static UFunction* pFnTickAsyncTasks = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickAsyncTasksRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.TickAsyncTasks", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTickAsyncTasks )
-		pFnTickAsyncTasks = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.TickAsyncTasks" );
+	UFunction* const pFnTickAsyncTasks = pFnTickAsyncTasksRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execTickAsyncTasks_Parms TickAsyncTasks_Parms;
 
-	pFnTickAsyncTasks->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnTickAsyncTasks, &TickAsyncTasks_Parms, NULL );
-
-	pFnTickAsyncTasks->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnTickAsyncTasks, &TickAsyncTasks_Parms ) )
+		this->ProcessEvent ( pFnTickAsyncTasks, &TickAsyncTasks_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.OnTick
@@ -11311,19 +9795,15 @@ void USFXOnlineComponentPlatformXenon::TickAsyncTasks ( )
 
 void USFXOnlineComponentPlatformXenon::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnTickRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.OnTick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnTick )
-		pFnOnTick = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.OnTick" );
+	UFunction* const pFnOnTick = pFnOnTickRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
 
-	pFnOnTick->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
-
-	pFnOnTick->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnTick, &OnTick_Parms ) )
+		this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.AddRecentPlayer
@@ -11335,20 +9815,16 @@ void USFXOnlineComponentPlatformXenon::OnTick ( class USFXOnlineEvent* oEvent )
 
 bool USFXOnlineComponentPlatformXenon::AddRecentPlayer ( struct FUniqueNetId const& oPlayerId, FString const& sDescription )
 {
-	static UFunction* pFnAddRecentPlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddRecentPlayerRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.AddRecentPlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddRecentPlayer )
-		pFnAddRecentPlayer = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.AddRecentPlayer" );
+	UFunction* const pFnAddRecentPlayer = pFnAddRecentPlayerRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execAddRecentPlayer_Parms AddRecentPlayer_Parms;
 	memcpy ( &AddRecentPlayer_Parms.oPlayerId, &oPlayerId, 0x8 );
 	memcpy ( &AddRecentPlayer_Parms.sDescription, &sDescription, 0x10 );
 
-	pFnAddRecentPlayer->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddRecentPlayer, &AddRecentPlayer_Parms, NULL );
-
-	pFnAddRecentPlayer->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAddRecentPlayer, &AddRecentPlayer_Parms ) )
+		this->ProcessEvent ( pFnAddRecentPlayer, &AddRecentPlayer_Parms, NULL );
 
 	return AddRecentPlayer_Parms.ReturnValue;
 };
@@ -11360,18 +9836,14 @@ bool USFXOnlineComponentPlatformXenon::AddRecentPlayer ( struct FUniqueNetId con
 
 struct SFXName USFXOnlineComponentPlatformXenon::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -11382,18 +9854,14 @@ struct SFXName USFXOnlineComponentPlatformXenon::GetAPIName ( )
 
 void USFXOnlineComponentPlatformXenon::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.OnInitialize
@@ -11403,31 +9871,24 @@ void USFXOnlineComponentPlatformXenon::OnRelease ( )
 
 void USFXOnlineComponentPlatformXenon::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentPlatformXenon_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineComponentAchievementPS3::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentAchievementPS3::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentAchievementPS3", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentAchievementPS3::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentAchievementPS3" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.GetTitleAchievementID
@@ -11439,10 +9900,9 @@ class UClass* USFXOnlineComponentAchievementPS3::StaticClass()
 
 int USFXOnlineComponentAchievementPS3::GetTitleAchievementID ( int Index, int* SetIndex )
 {
-	static UFunction* pFnGetTitleAchievementID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTitleAchievementIDRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.GetTitleAchievementID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTitleAchievementID )
-		pFnGetTitleAchievementID = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.GetTitleAchievementID" );
+	UFunction* const pFnGetTitleAchievementID = pFnGetTitleAchievementIDRef.Get ( );
 
 	USFXOnlineComponentAchievementPS3_execGetTitleAchievementID_Parms GetTitleAchievementID_Parms;
 	GetTitleAchievementID_Parms.Index = Index;
@@ -11450,11 +9910,8 @@ int USFXOnlineComponentAchievementPS3::GetTitleAchievementID ( int Index, int* S
 	if ( SetIndex )
 		GetTitleAchievementID_Parms.SetIndex = *SetIndex;
 
-	pFnGetTitleAchievementID->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetTitleAchievementID, &GetTitleAchievementID_Parms, NULL );
-
-	pFnGetTitleAchievementID->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetTitleAchievementID, &GetTitleAchievementID_Parms ) )
+		this->ProcessEvent ( pFnGetTitleAchievementID, &GetTitleAchievementID_Parms, NULL );
 
 	if ( SetIndex )
 		*SetIndex = GetTitleAchievementID_Parms.SetIndex;
@@ -11471,10 +9928,9 @@ int USFXOnlineComponentAchievementPS3::GetTitleAchievementID ( int Index, int* S
 
 int USFXOnlineComponentAchievementPS3::GetPlatformAchievementID ( int Index, int* SetIndex )
 {
-	static UFunction* pFnGetPlatformAchievementID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPlatformAchievementIDRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.GetPlatformAchievementID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPlatformAchievementID )
-		pFnGetPlatformAchievementID = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.GetPlatformAchievementID" );
+	UFunction* const pFnGetPlatformAchievementID = pFnGetPlatformAchievementIDRef.Get ( );
 
 	USFXOnlineComponentAchievementPS3_execGetPlatformAchievementID_Parms GetPlatformAchievementID_Parms;
 	GetPlatformAchievementID_Parms.Index = Index;
@@ -11482,11 +9938,8 @@ int USFXOnlineComponentAchievementPS3::GetPlatformAchievementID ( int Index, int
 	if ( SetIndex )
 		GetPlatformAchievementID_Parms.SetIndex = *SetIndex;
 
-	pFnGetPlatformAchievementID->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms, NULL );
-
-	pFnGetPlatformAchievementID->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms ) )
+		this->ProcessEvent ( pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms, NULL );
 
 	if ( SetIndex )
 		*SetIndex = GetPlatformAchievementID_Parms.SetIndex;
@@ -11501,18 +9954,14 @@ int USFXOnlineComponentAchievementPS3::GetPlatformAchievementID ( int Index, int
 
 struct SFXName USFXOnlineComponentAchievementPS3::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentAchievementPS3_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -11523,18 +9972,14 @@ struct SFXName USFXOnlineComponentAchievementPS3::GetAPIName ( )
 
 void USFXOnlineComponentAchievementPS3::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentAchievementPS3_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.OnInitialize
@@ -11544,19 +9989,15 @@ void USFXOnlineComponentAchievementPS3::OnRelease ( )
 
 void USFXOnlineComponentAchievementPS3::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentAchievementPS3_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.IsGranted
@@ -11568,20 +10009,16 @@ void USFXOnlineComponentAchievementPS3::OnInitialize ( class USFXOnlineSubsystem
 
 bool USFXOnlineComponentAchievementPS3::IsGranted ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnIsGranted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsGrantedRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.IsGranted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsGranted )
-		pFnIsGranted = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.IsGranted" );
+	UFunction* const pFnIsGranted = pFnIsGrantedRef.Get ( );
 
 	USFXOnlineComponentAchievementPS3_execIsGranted_Parms IsGranted_Parms;
 	IsGranted_Parms.LocalUserNum = LocalUserNum;
 	IsGranted_Parms.AchievementId = AchievementId;
 
-	pFnIsGranted->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsGranted, &IsGranted_Parms, NULL );
-
-	pFnIsGranted->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsGranted, &IsGranted_Parms ) )
+		this->ProcessEvent ( pFnIsGranted, &IsGranted_Parms, NULL );
 
 	return IsGranted_Parms.ReturnValue;
 };
@@ -11594,32 +10031,25 @@ bool USFXOnlineComponentAchievementPS3::IsGranted ( unsigned char LocalUserNum,
 
 void USFXOnlineComponentAchievementPS3::Grant ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnGrant = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGrantRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.Grant", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGrant )
-		pFnGrant = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.Grant" );
+	UFunction* const pFnGrant = pFnGrantRef.Get ( );
 
 	USFXOnlineComponentAchievementPS3_execGrant_Parms Grant_Parms;
 	Grant_Parms.LocalUserNum = LocalUserNum;
 	Grant_Parms.AchievementId = AchievementId;
 
-	pFnGrant->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGrant, &Grant_Parms, NULL );
-
-	pFnGrant->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGrant, &Grant_Parms ) )
+		this->ProcessEvent ( pFnGrant, &Grant_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineComponentPlatformPS3::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentPlatformPS3::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentPlatformPS3", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentPlatformPS3::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentPlatformPS3" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowLoginUIEx
@@ -11630,19 +10060,15 @@ class UClass* USFXOnlineComponentPlatformPS3::StaticClass()
 
 bool USFXOnlineComponentPlatformPS3::ShowLoginUIEx ( struct FScriptDelegate funcSignInComplete )
 {
-	static UFunction* pFnShowLoginUIEx = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowLoginUIExRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowLoginUIEx", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowLoginUIEx )
-		pFnShowLoginUIEx = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowLoginUIEx" );
+	UFunction* const pFnShowLoginUIEx = pFnShowLoginUIExRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execShowLoginUIEx_Parms ShowLoginUIEx_Parms;
 	memcpy ( &ShowLoginUIEx_Parms.funcSignInComplete, &funcSignInComplete, 0x10 );
 
-	pFnShowLoginUIEx->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowLoginUIEx, &ShowLoginUIEx_Parms, NULL );
-
-	pFnShowLoginUIEx->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowLoginUIEx, &ShowLoginUIEx_Parms ) )
+		this->ProcessEvent ( pFnShowLoginUIEx, &ShowLoginUIEx_Parms, NULL );
 
 	return ShowLoginUIEx_Parms.ReturnValue;
 };
@@ -11654,10 +10080,9 @@ bool USFXOnlineComponentPlatformPS3::ShowLoginUIEx ( struct FScriptDelegate func
 
 void USFXOnlineComponentPlatformPS3::OnSignInComplete ( unsigned long bSignedIn )
 {
-	static UFunction* pFnOnSignInComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnSignInCompleteRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnSignInComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnSignInComplete )
-		pFnOnSignInComplete = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnSignInComplete" );
+	UFunction* const pFnOnSignInComplete = pFnOnSignInCompleteRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execOnSignInComplete_Parms OnSignInComplete_Parms;
 	OnSignInComplete_Parms.bSignedIn = bSignedIn;
@@ -11672,18 +10097,14 @@ void USFXOnlineComponentPlatformPS3::OnSignInComplete ( unsigned long bSignedIn
 
 int USFXOnlineComponentPlatformPS3::GetRebootUserData ( )
 {
-	static UFunction* pFnGetRebootUserData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetRebootUserDataRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetRebootUserData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetRebootUserData )
-		pFnGetRebootUserData = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetRebootUserData" );
+	UFunction* const pFnGetRebootUserData = pFnGetRebootUserDataRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execGetRebootUserData_Parms GetRebootUserData_Parms;
 
-	pFnGetRebootUserData->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetRebootUserData, &GetRebootUserData_Parms, NULL );
-
-	pFnGetRebootUserData->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetRebootUserData, &GetRebootUserData_Parms ) )
+		this->ProcessEvent ( pFnGetRebootUserData, &GetRebootUserData_Parms, NULL );
 
 	return GetRebootUserData_Parms.ReturnValue;
 };
@@ -11695,18 +10116,14 @@ int USFXOnlineComponentPlatformPS3::GetRebootUserData ( )
 
 bool USFXOnlineComponentPlatformPS3::WasRebootedFromOSCodeRedemptionUI ( )
 {
-	static UFunction* pFnWasRebootedFromOSCodeRedemptionUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWasRebootedFromOSCodeRedemptionUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.WasRebootedFromOSCodeRedemptionUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWasRebootedFromOSCodeRedemptionUI )
-		pFnWasRebootedFromOSCodeRedemptionUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.WasRebootedFromOSCodeRedemptionUI" );
+	UFunction* const pFnWasRebootedFromOSCodeRedemptionUI = pFnWasRebootedFromOSCodeRedemptionUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execWasRebootedFromOSCodeRedemptionUI_Parms WasRebootedFromOSCodeRedemptionUI_Parms;
 
-	pFnWasRebootedFromOSCodeRedemptionUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms, NULL );
-
-	pFnWasRebootedFromOSCodeRedemptionUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms ) )
+		this->ProcessEvent ( pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms, NULL );
 
 	return WasRebootedFromOSCodeRedemptionUI_Parms.ReturnValue;
 };
@@ -11719,19 +10136,15 @@ bool USFXOnlineComponentPlatformPS3::WasRebootedFromOSCodeRedemptionUI ( )
 
 bool USFXOnlineComponentPlatformPS3::ShowCodeRedemptionUI ( int UserData )
 {
-	static UFunction* pFnShowCodeRedemptionUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowCodeRedemptionUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowCodeRedemptionUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowCodeRedemptionUI )
-		pFnShowCodeRedemptionUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowCodeRedemptionUI" );
+	UFunction* const pFnShowCodeRedemptionUI = pFnShowCodeRedemptionUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execShowCodeRedemptionUI_Parms ShowCodeRedemptionUI_Parms;
 	ShowCodeRedemptionUI_Parms.UserData = UserData;
 
-	pFnShowCodeRedemptionUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms, NULL );
-
-	pFnShowCodeRedemptionUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms ) )
+		this->ProcessEvent ( pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms, NULL );
 
 	return ShowCodeRedemptionUI_Parms.ReturnValue;
 };
@@ -11743,18 +10156,14 @@ bool USFXOnlineComponentPlatformPS3::ShowCodeRedemptionUI ( int UserData )
 
 bool USFXOnlineComponentPlatformPS3::ShowStoreUI ( )
 {
-	static UFunction* pFnShowStoreUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowStoreUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowStoreUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowStoreUI )
-		pFnShowStoreUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowStoreUI" );
+	UFunction* const pFnShowStoreUI = pFnShowStoreUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execShowStoreUI_Parms ShowStoreUI_Parms;
 
-	pFnShowStoreUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowStoreUI, &ShowStoreUI_Parms, NULL );
-
-	pFnShowStoreUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowStoreUI, &ShowStoreUI_Parms ) )
+		this->ProcessEvent ( pFnShowStoreUI, &ShowStoreUI_Parms, NULL );
 
 	return ShowStoreUI_Parms.ReturnValue;
 };
@@ -11768,10 +10177,9 @@ bool USFXOnlineComponentPlatformPS3::ShowStoreUI ( )
 
 bool USFXOnlineComponentPlatformPS3::GetOnlineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOnlineXuid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOnlineXuidRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetOnlineXuid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOnlineXuid )
-		pFnGetOnlineXuid = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetOnlineXuid" );
+	UFunction* const pFnGetOnlineXuid = pFnGetOnlineXuidRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execGetOnlineXuid_Parms GetOnlineXuid_Parms;
 	GetOnlineXuid_Parms.nUserIndex = nUserIndex;
@@ -11779,11 +10187,8 @@ bool USFXOnlineComponentPlatformPS3::GetOnlineXuid ( int nUserIndex, struct FUni
 	if ( oPlayerXuid )
 		memcpy ( &GetOnlineXuid_Parms.oPlayerXuid, oPlayerXuid, 0x8 );
 
-	pFnGetOnlineXuid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetOnlineXuid, &GetOnlineXuid_Parms, NULL );
-
-	pFnGetOnlineXuid->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetOnlineXuid, &GetOnlineXuid_Parms ) )
+		this->ProcessEvent ( pFnGetOnlineXuid, &GetOnlineXuid_Parms, NULL );
 
 	if ( oPlayerXuid )
 		memcpy ( oPlayerXuid, &GetOnlineXuid_Parms.oPlayerXuid, 0x8 );
@@ -11800,10 +10205,9 @@ bool USFXOnlineComponentPlatformPS3::GetOnlineXuid ( int nUserIndex, struct FUni
 
 bool USFXOnlineComponentPlatformPS3::GetOfflineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOfflineXuid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOfflineXuidRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetOfflineXuid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOfflineXuid )
-		pFnGetOfflineXuid = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetOfflineXuid" );
+	UFunction* const pFnGetOfflineXuid = pFnGetOfflineXuidRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execGetOfflineXuid_Parms GetOfflineXuid_Parms;
 	GetOfflineXuid_Parms.nUserIndex = nUserIndex;
@@ -11811,11 +10215,8 @@ bool USFXOnlineComponentPlatformPS3::GetOfflineXuid ( int nUserIndex, struct FUn
 	if ( oPlayerXuid )
 		memcpy ( &GetOfflineXuid_Parms.oPlayerXuid, oPlayerXuid, 0x8 );
 
-	pFnGetOfflineXuid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetOfflineXuid, &GetOfflineXuid_Parms, NULL );
-
-	pFnGetOfflineXuid->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetOfflineXuid, &GetOfflineXuid_Parms ) )
+		this->ProcessEvent ( pFnGetOfflineXuid, &GetOfflineXuid_Parms, NULL );
 
 	if ( oPlayerXuid )
 		memcpy ( oPlayerXuid, &GetOfflineXuid_Parms.oPlayerXuid, 0x8 );
@@ -11838,10 +10239,9 @@ bool USFXOnlineComponentPlatformPS3::GetOfflineXuid ( int nUserIndex, struct FUn
 
 bool USFXOnlineComponentPlatformPS3::ShowKeyboardUI ( unsigned char LocalUserNum, FString const& sTitleText, FString const& sDescriptionText, unsigned char nKeyboardType, unsigned long bShouldValidate, unsigned long bRouteThroughConsole, FString const& sDefaultText, int nMaxResultLength )
 {
-	static UFunction* pFnShowKeyboardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowKeyboardUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowKeyboardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowKeyboardUI )
-		pFnShowKeyboardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowKeyboardUI" );
+	UFunction* const pFnShowKeyboardUI = pFnShowKeyboardUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execShowKeyboardUI_Parms ShowKeyboardUI_Parms;
 	ShowKeyboardUI_Parms.LocalUserNum = LocalUserNum;
@@ -11853,11 +10253,8 @@ bool USFXOnlineComponentPlatformPS3::ShowKeyboardUI ( unsigned char LocalUserNum
 	memcpy ( &ShowKeyboardUI_Parms.sDefaultText, &sDefaultText, 0x10 );
 	ShowKeyboardUI_Parms.nMaxResultLength = nMaxResultLength;
 
-	pFnShowKeyboardUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowKeyboardUI, &ShowKeyboardUI_Parms, NULL );
-
-	pFnShowKeyboardUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowKeyboardUI, &ShowKeyboardUI_Parms ) )
+		this->ProcessEvent ( pFnShowKeyboardUI, &ShowKeyboardUI_Parms, NULL );
 
 	return ShowKeyboardUI_Parms.ReturnValue;
 };
@@ -11871,20 +10268,16 @@ bool USFXOnlineComponentPlatformPS3::ShowKeyboardUI ( unsigned char LocalUserNum
 
 bool USFXOnlineComponentPlatformPS3::ShowFriendsInviteUI ( unsigned char eLocalUserNum, struct FUniqueNetId const& oPlayerXuid )
 {
-	static UFunction* pFnShowFriendsInviteUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFriendsInviteUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowFriendsInviteUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFriendsInviteUI )
-		pFnShowFriendsInviteUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowFriendsInviteUI" );
+	UFunction* const pFnShowFriendsInviteUI = pFnShowFriendsInviteUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execShowFriendsInviteUI_Parms ShowFriendsInviteUI_Parms;
 	ShowFriendsInviteUI_Parms.eLocalUserNum = eLocalUserNum;
 	memcpy ( &ShowFriendsInviteUI_Parms.oPlayerXuid, &oPlayerXuid, 0x8 );
 
-	pFnShowFriendsInviteUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms, NULL );
-
-	pFnShowFriendsInviteUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms ) )
+		this->ProcessEvent ( pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms, NULL );
 
 	return ShowFriendsInviteUI_Parms.ReturnValue;
 };
@@ -11897,19 +10290,15 @@ bool USFXOnlineComponentPlatformPS3::ShowFriendsInviteUI ( unsigned char eLocalU
 
 bool USFXOnlineComponentPlatformPS3::ShowFriendsUI ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnShowFriendsUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFriendsUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowFriendsUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFriendsUI )
-		pFnShowFriendsUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowFriendsUI" );
+	UFunction* const pFnShowFriendsUI = pFnShowFriendsUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execShowFriendsUI_Parms ShowFriendsUI_Parms;
 	ShowFriendsUI_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnShowFriendsUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFriendsUI, &ShowFriendsUI_Parms, NULL );
-
-	pFnShowFriendsUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFriendsUI, &ShowFriendsUI_Parms ) )
+		this->ProcessEvent ( pFnShowFriendsUI, &ShowFriendsUI_Parms, NULL );
 
 	return ShowFriendsUI_Parms.ReturnValue;
 };
@@ -11922,19 +10311,15 @@ bool USFXOnlineComponentPlatformPS3::ShowFriendsUI ( unsigned char eLocalUserNum
 
 bool USFXOnlineComponentPlatformPS3::ShowAchievementsUI ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnShowAchievementsUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowAchievementsUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowAchievementsUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowAchievementsUI )
-		pFnShowAchievementsUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowAchievementsUI" );
+	UFunction* const pFnShowAchievementsUI = pFnShowAchievementsUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execShowAchievementsUI_Parms ShowAchievementsUI_Parms;
 	ShowAchievementsUI_Parms.byLocalUserNum = byLocalUserNum;
 
-	pFnShowAchievementsUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowAchievementsUI, &ShowAchievementsUI_Parms, NULL );
-
-	pFnShowAchievementsUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowAchievementsUI, &ShowAchievementsUI_Parms ) )
+		this->ProcessEvent ( pFnShowAchievementsUI, &ShowAchievementsUI_Parms, NULL );
 
 	return ShowAchievementsUI_Parms.ReturnValue;
 };
@@ -11948,20 +10333,16 @@ bool USFXOnlineComponentPlatformPS3::ShowAchievementsUI ( unsigned char byLocalU
 
 bool USFXOnlineComponentPlatformPS3::ShowFeedbackUI ( unsigned char eLocalUserNum, struct FUniqueNetId const& oPlayerId )
 {
-	static UFunction* pFnShowFeedbackUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFeedbackUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowFeedbackUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFeedbackUI )
-		pFnShowFeedbackUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowFeedbackUI" );
+	UFunction* const pFnShowFeedbackUI = pFnShowFeedbackUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execShowFeedbackUI_Parms ShowFeedbackUI_Parms;
 	ShowFeedbackUI_Parms.eLocalUserNum = eLocalUserNum;
 	memcpy ( &ShowFeedbackUI_Parms.oPlayerId, &oPlayerId, 0x8 );
 
-	pFnShowFeedbackUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFeedbackUI, &ShowFeedbackUI_Parms, NULL );
-
-	pFnShowFeedbackUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFeedbackUI, &ShowFeedbackUI_Parms ) )
+		this->ProcessEvent ( pFnShowFeedbackUI, &ShowFeedbackUI_Parms, NULL );
 
 	return ShowFeedbackUI_Parms.ReturnValue;
 };
@@ -11975,20 +10356,16 @@ bool USFXOnlineComponentPlatformPS3::ShowFeedbackUI ( unsigned char eLocalUserNu
 
 bool USFXOnlineComponentPlatformPS3::ShowGamerCardUI ( unsigned char eLocalUserNum, struct FUniqueNetId const& oPlayerId )
 {
-	static UFunction* pFnShowGamerCardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowGamerCardUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowGamerCardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowGamerCardUI )
-		pFnShowGamerCardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowGamerCardUI" );
+	UFunction* const pFnShowGamerCardUI = pFnShowGamerCardUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execShowGamerCardUI_Parms ShowGamerCardUI_Parms;
 	ShowGamerCardUI_Parms.eLocalUserNum = eLocalUserNum;
 	memcpy ( &ShowGamerCardUI_Parms.oPlayerId, &oPlayerId, 0x8 );
 
-	pFnShowGamerCardUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowGamerCardUI, &ShowGamerCardUI_Parms, NULL );
-
-	pFnShowGamerCardUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowGamerCardUI, &ShowGamerCardUI_Parms ) )
+		this->ProcessEvent ( pFnShowGamerCardUI, &ShowGamerCardUI_Parms, NULL );
 
 	return ShowGamerCardUI_Parms.ReturnValue;
 };
@@ -12001,19 +10378,15 @@ bool USFXOnlineComponentPlatformPS3::ShowGamerCardUI ( unsigned char eLocalUserN
 
 unsigned char USFXOnlineComponentPlatformPS3::CanShowPresenceInformation ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanShowPresenceInformationRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanShowPresenceInformation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanShowPresenceInformation" );
+	UFunction* const pFnCanShowPresenceInformation = pFnCanShowPresenceInformationRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanShowPresenceInformation->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
-
-	pFnCanShowPresenceInformation->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms ) )
+		this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
 
 	return CanShowPresenceInformation_Parms.ReturnValue;
 };
@@ -12026,19 +10399,15 @@ unsigned char USFXOnlineComponentPlatformPS3::CanShowPresenceInformation ( unsig
 
 unsigned char USFXOnlineComponentPlatformPS3::CanViewPlayerProfiles ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanViewPlayerProfilesRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanViewPlayerProfiles", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanViewPlayerProfiles" );
+	UFunction* const pFnCanViewPlayerProfiles = pFnCanViewPlayerProfilesRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanViewPlayerProfiles->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
-
-	pFnCanViewPlayerProfiles->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms ) )
+		this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
 
 	return CanViewPlayerProfiles_Parms.ReturnValue;
 };
@@ -12051,19 +10420,15 @@ unsigned char USFXOnlineComponentPlatformPS3::CanViewPlayerProfiles ( unsigned c
 
 unsigned char USFXOnlineComponentPlatformPS3::CanPurchaseContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPurchaseContentRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanPurchaseContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanPurchaseContent" );
+	UFunction* const pFnCanPurchaseContent = pFnCanPurchaseContentRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanPurchaseContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
-
-	pFnCanPurchaseContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPurchaseContent, &CanPurchaseContent_Parms ) )
+		this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
 
 	return CanPurchaseContent_Parms.ReturnValue;
 };
@@ -12076,19 +10441,15 @@ unsigned char USFXOnlineComponentPlatformPS3::CanPurchaseContent ( unsigned char
 
 unsigned char USFXOnlineComponentPlatformPS3::CanDownloadUserContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanDownloadUserContentRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanDownloadUserContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanDownloadUserContent" );
+	UFunction* const pFnCanDownloadUserContent = pFnCanDownloadUserContentRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanDownloadUserContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
-
-	pFnCanDownloadUserContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanDownloadUserContent, &CanDownloadUserContent_Parms ) )
+		this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
 
 	return CanDownloadUserContent_Parms.ReturnValue;
 };
@@ -12101,19 +10462,15 @@ unsigned char USFXOnlineComponentPlatformPS3::CanDownloadUserContent ( unsigned
 
 unsigned char USFXOnlineComponentPlatformPS3::CanCommunicate ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanCommunicate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanCommunicateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanCommunicate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanCommunicate" );
+	UFunction* const pFnCanCommunicate = pFnCanCommunicateRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanCommunicate->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
-
-	pFnCanCommunicate->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanCommunicate, &CanCommunicate_Parms ) )
+		this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
 
 	return CanCommunicate_Parms.ReturnValue;
 };
@@ -12126,19 +10483,15 @@ unsigned char USFXOnlineComponentPlatformPS3::CanCommunicate ( unsigned char eLo
 
 unsigned char USFXOnlineComponentPlatformPS3::CanPlayOnline ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPlayOnlineRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanPlayOnline", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanPlayOnline" );
+	UFunction* const pFnCanPlayOnline = pFnCanPlayOnlineRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanPlayOnline->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
-
-	pFnCanPlayOnline->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPlayOnline, &CanPlayOnline_Parms ) )
+		this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
 
 	return CanPlayOnline_Parms.ReturnValue;
 };
@@ -12153,10 +10506,9 @@ unsigned char USFXOnlineComponentPlatformPS3::CanPlayOnline ( unsigned char eLoc
 
 void USFXOnlineComponentPlatformPS3::SetRichPresence ( unsigned char eLocalUserNum, int nPresenceMode, TArray<struct FLocalizedStringSetting>* aLocalizedStringSettings, TArray<struct FSettingsProperty>* aProperties )
 {
-	static UFunction* pFnSetRichPresence = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetRichPresenceRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.SetRichPresence", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetRichPresence )
-		pFnSetRichPresence = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.SetRichPresence" );
+	UFunction* const pFnSetRichPresence = pFnSetRichPresenceRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execSetRichPresence_Parms SetRichPresence_Parms;
 	SetRichPresence_Parms.eLocalUserNum = eLocalUserNum;
@@ -12168,11 +10520,8 @@ void USFXOnlineComponentPlatformPS3::SetRichPresence ( unsigned char eLocalUserN
 	if ( aProperties )
 		memcpy ( &SetRichPresence_Parms.aProperties, aProperties, 0x10 );
 
-	pFnSetRichPresence->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetRichPresence, &SetRichPresence_Parms, NULL );
-
-	pFnSetRichPresence->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetRichPresence, &SetRichPresence_Parms ) )
+		this->ProcessEvent ( pFnSetRichPresence, &SetRichPresence_Parms, NULL );
 
 	if ( aLocalizedStringSettings )
 		memcpy ( aLocalizedStringSettings, &SetRichPresence_Parms.aLocalizedStringSettings, 0x10 );
@@ -12189,19 +10538,15 @@ void USFXOnlineComponentPlatformPS3::SetRichPresence ( unsigned char eLocalUserN
 
 bool USFXOnlineComponentPlatformPS3::ShowLoginUI ( unsigned long bShowOnlineOnly )
 {
-	static UFunction* pFnShowLoginUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowLoginUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowLoginUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowLoginUI )
-		pFnShowLoginUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowLoginUI" );
+	UFunction* const pFnShowLoginUI = pFnShowLoginUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execShowLoginUI_Parms ShowLoginUI_Parms;
 	ShowLoginUI_Parms.bShowOnlineOnly = bShowOnlineOnly;
 
-	pFnShowLoginUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowLoginUI, &ShowLoginUI_Parms, NULL );
-
-	pFnShowLoginUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowLoginUI, &ShowLoginUI_Parms ) )
+		this->ProcessEvent ( pFnShowLoginUI, &ShowLoginUI_Parms, NULL );
 
 	return ShowLoginUI_Parms.ReturnValue;
 };
@@ -12214,19 +10559,15 @@ bool USFXOnlineComponentPlatformPS3::ShowLoginUI ( unsigned long bShowOnlineOnly
 
 unsigned char USFXOnlineComponentPlatformPS3::GetLoginStatus ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLoginStatusRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetLoginStatus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetLoginStatus" );
+	UFunction* const pFnGetLoginStatus = pFnGetLoginStatusRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execGetLoginStatus_Parms GetLoginStatus_Parms;
 	GetLoginStatus_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnGetLoginStatus->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetLoginStatus, &GetLoginStatus_Parms, NULL );
-
-	pFnGetLoginStatus->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetLoginStatus, &GetLoginStatus_Parms ) )
+		this->ProcessEvent ( pFnGetLoginStatus, &GetLoginStatus_Parms, NULL );
 
 	return GetLoginStatus_Parms.ReturnValue;
 };
@@ -12240,20 +10581,16 @@ unsigned char USFXOnlineComponentPlatformPS3::GetLoginStatus ( unsigned char eLo
 
 bool USFXOnlineComponentPlatformPS3::AddRecentPlayer ( struct FUniqueNetId const& oPlayerId, FString const& sDescription )
 {
-	static UFunction* pFnAddRecentPlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddRecentPlayerRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.AddRecentPlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddRecentPlayer )
-		pFnAddRecentPlayer = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.AddRecentPlayer" );
+	UFunction* const pFnAddRecentPlayer = pFnAddRecentPlayerRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execAddRecentPlayer_Parms AddRecentPlayer_Parms;
 	memcpy ( &AddRecentPlayer_Parms.oPlayerId, &oPlayerId, 0x8 );
 	memcpy ( &AddRecentPlayer_Parms.sDescription, &sDescription, 0x10 );
 
-	pFnAddRecentPlayer->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddRecentPlayer, &AddRecentPlayer_Parms, NULL );
-
-	pFnAddRecentPlayer->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAddRecentPlayer, &AddRecentPlayer_Parms ) )
+		this->ProcessEvent ( pFnAddRecentPlayer, &AddRecentPlayer_Parms, NULL );
 
 	return AddRecentPlayer_Parms.ReturnValue;
 };
@@ -12265,19 +10602,15 @@ bool USFXOnlineComponentPlatformPS3::AddRecentPlayer ( struct FUniqueNetId const
 
 void USFXOnlineComponentPlatformPS3::OnKeyboardUI ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnKeyboardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnKeyboardUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnKeyboardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnKeyboardUI )
-		pFnOnKeyboardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnKeyboardUI" );
+	UFunction* const pFnOnKeyboardUI = pFnOnKeyboardUIRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execOnKeyboardUI_Parms OnKeyboardUI_Parms;
 	OnKeyboardUI_Parms.oEvent = oEvent;
 
-	pFnOnKeyboardUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnKeyboardUI, &OnKeyboardUI_Parms, NULL );
-
-	pFnOnKeyboardUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnKeyboardUI, &OnKeyboardUI_Parms ) )
+		this->ProcessEvent ( pFnOnKeyboardUI, &OnKeyboardUI_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnTick
@@ -12287,19 +10620,15 @@ void USFXOnlineComponentPlatformPS3::OnKeyboardUI ( class USFXOnlineEvent* oEven
 
 void USFXOnlineComponentPlatformPS3::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnTickRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnTick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnTick )
-		pFnOnTick = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnTick" );
+	UFunction* const pFnOnTick = pFnOnTickRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
 
-	pFnOnTick->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
-
-	pFnOnTick->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnTick, &OnTick_Parms ) )
+		this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetAPIName
@@ -12309,18 +10638,14 @@ void USFXOnlineComponentPlatformPS3::OnTick ( class USFXOnlineEvent* oEvent )
 
 struct SFXName USFXOnlineComponentPlatformPS3::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -12331,18 +10656,14 @@ struct SFXName USFXOnlineComponentPlatformPS3::GetAPIName ( )
 
 void USFXOnlineComponentPlatformPS3::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnInitialize
@@ -12352,31 +10673,24 @@ void USFXOnlineComponentPlatformPS3::OnRelease ( )
 
 void USFXOnlineComponentPlatformPS3::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentPlatformPS3_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineComponentAchievementDingo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentAchievementDingo::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentAchievementDingo", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentAchievementDingo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentAchievementDingo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.GetTitleAchievementID
@@ -12388,10 +10702,9 @@ class UClass* USFXOnlineComponentAchievementDingo::StaticClass()
 
 int USFXOnlineComponentAchievementDingo::GetTitleAchievementID ( int Index, int* SetIndex )
 {
-	static UFunction* pFnGetTitleAchievementID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTitleAchievementIDRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.GetTitleAchievementID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTitleAchievementID )
-		pFnGetTitleAchievementID = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.GetTitleAchievementID" );
+	UFunction* const pFnGetTitleAchievementID = pFnGetTitleAchievementIDRef.Get ( );
 
 	USFXOnlineComponentAchievementDingo_execGetTitleAchievementID_Parms GetTitleAchievementID_Parms;
 	GetTitleAchievementID_Parms.Index = Index;
@@ -12399,11 +10712,8 @@ int USFXOnlineComponentAchievementDingo::GetTitleAchievementID ( int Index, int*
 	if ( SetIndex )
 		GetTitleAchievementID_Parms.SetIndex = *SetIndex;
 
-	pFnGetTitleAchievementID->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetTitleAchievementID, &GetTitleAchievementID_Parms, NULL );
-
-	pFnGetTitleAchievementID->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetTitleAchievementID, &GetTitleAchievementID_Parms ) )
+		this->ProcessEvent ( pFnGetTitleAchievementID, &GetTitleAchievementID_Parms, NULL );
 
 	if ( SetIndex )
 		*SetIndex = GetTitleAchievementID_Parms.SetIndex;
@@ -12420,10 +10730,9 @@ int USFXOnlineComponentAchievementDingo::GetTitleAchievementID ( int Index, int*
 
 int USFXOnlineComponentAchievementDingo::GetPlatformAchievementID ( int Index, int* SetIndex )
 {
-	static UFunction* pFnGetPlatformAchievementID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPlatformAchievementIDRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.GetPlatformAchievementID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPlatformAchievementID )
-		pFnGetPlatformAchievementID = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.GetPlatformAchievementID" );
+	UFunction* const pFnGetPlatformAchievementID = pFnGetPlatformAchievementIDRef.Get ( );
 
 	USFXOnlineComponentAchievementDingo_execGetPlatformAchievementID_Parms GetPlatformAchievementID_Parms;
 	GetPlatformAchievementID_Parms.Index = Index;
@@ -12431,11 +10740,8 @@ int USFXOnlineComponentAchievementDingo::GetPlatformAchievementID ( int Index, i
 	if ( SetIndex )
 		GetPlatformAchievementID_Parms.SetIndex = *SetIndex;
 
-	pFnGetPlatformAchievementID->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms, NULL );
-
-	pFnGetPlatformAchievementID->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms ) )
+		this->ProcessEvent ( pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms, NULL );
 
 	if ( SetIndex )
 		*SetIndex = GetPlatformAchievementID_Parms.SetIndex;
@@ -12450,18 +10756,14 @@ int USFXOnlineComponentAchievementDingo::GetPlatformAchievementID ( int Index, i
 
 struct SFXName USFXOnlineComponentAchievementDingo::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentAchievementDingo_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -12472,18 +10774,14 @@ struct SFXName USFXOnlineComponentAchievementDingo::GetAPIName ( )
 
 void USFXOnlineComponentAchievementDingo::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentAchievementDingo_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.OnInitialize
@@ -12493,19 +10791,15 @@ void USFXOnlineComponentAchievementDingo::OnRelease ( )
 
 void USFXOnlineComponentAchievementDingo::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentAchievementDingo_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.IsGranted
@@ -12517,20 +10811,16 @@ void USFXOnlineComponentAchievementDingo::OnInitialize ( class USFXOnlineSubsyst
 
 bool USFXOnlineComponentAchievementDingo::IsGranted ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnIsGranted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsGrantedRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.IsGranted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsGranted )
-		pFnIsGranted = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.IsGranted" );
+	UFunction* const pFnIsGranted = pFnIsGrantedRef.Get ( );
 
 	USFXOnlineComponentAchievementDingo_execIsGranted_Parms IsGranted_Parms;
 	IsGranted_Parms.LocalUserNum = LocalUserNum;
 	IsGranted_Parms.AchievementId = AchievementId;
 
-	pFnIsGranted->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsGranted, &IsGranted_Parms, NULL );
-
-	pFnIsGranted->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsGranted, &IsGranted_Parms ) )
+		this->ProcessEvent ( pFnIsGranted, &IsGranted_Parms, NULL );
 
 	return IsGranted_Parms.ReturnValue;
 };
@@ -12543,32 +10833,25 @@ bool USFXOnlineComponentAchievementDingo::IsGranted ( unsigned char LocalUserNum
 
 void USFXOnlineComponentAchievementDingo::Grant ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnGrant = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGrantRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.Grant", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGrant )
-		pFnGrant = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.Grant" );
+	UFunction* const pFnGrant = pFnGrantRef.Get ( );
 
 	USFXOnlineComponentAchievementDingo_execGrant_Parms Grant_Parms;
 	Grant_Parms.LocalUserNum = LocalUserNum;
 	Grant_Parms.AchievementId = AchievementId;
 
-	pFnGrant->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGrant, &Grant_Parms, NULL );
-
-	pFnGrant->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGrant, &Grant_Parms ) )
+		this->ProcessEvent ( pFnGrant, &Grant_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineComponentPlatformDingo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentPlatformDingo::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentPlatformDingo", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentPlatformDingo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentPlatformDingo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.OnTick
@@ -12578,19 +10861,15 @@ class UClass* USFXOnlineComponentPlatformDingo::StaticClass()
 
 void USFXOnlineComponentPlatformDingo::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnTickRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.OnTick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnTick )
-		pFnOnTick = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.OnTick" );
+	UFunction* const pFnOnTick = pFnOnTickRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
 
-	pFnOnTick->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
-
-	pFnOnTick->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnTick, &OnTick_Parms ) )
+		this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.OnKeyboardUIClosed
@@ -12601,20 +10880,16 @@ void USFXOnlineComponentPlatformDingo::OnTick ( class USFXOnlineEvent* oEvent )
 
 void USFXOnlineComponentPlatformDingo::OnKeyboardUIClosed ( unsigned long Success, FString const& InputBuffer )
 {
-	static UFunction* pFnOnKeyboardUIClosed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnKeyboardUIClosedRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.OnKeyboardUIClosed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnKeyboardUIClosed )
-		pFnOnKeyboardUIClosed = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.OnKeyboardUIClosed" );
+	UFunction* const pFnOnKeyboardUIClosed = pFnOnKeyboardUIClosedRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execOnKeyboardUIClosed_Parms OnKeyboardUIClosed_Parms;
 	OnKeyboardUIClosed_Parms.Success = Success;
 	memcpy ( &OnKeyboardUIClosed_Parms.InputBuffer, &InputBuffer, 0x10 );
 
-	pFnOnKeyboardUIClosed->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnKeyboardUIClosed, &OnKeyboardUIClosed_Parms, NULL );
-
-	pFnOnKeyboardUIClosed->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnKeyboardUIClosed, &OnKeyboardUIClosed_Parms ) )
+		this->ProcessEvent ( pFnOnKeyboardUIClosed, &OnKeyboardUIClosed_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetRebootUserData
@@ -12624,18 +10899,14 @@ void USFXOnlineComponentPlatformDingo::OnKeyboardUIClosed ( unsigned long Succes
 
 int USFXOnlineComponentPlatformDingo::GetRebootUserData ( )
 {
-	static UFunction* pFnGetRebootUserData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetRebootUserDataRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetRebootUserData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetRebootUserData )
-		pFnGetRebootUserData = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetRebootUserData" );
+	UFunction* const pFnGetRebootUserData = pFnGetRebootUserDataRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execGetRebootUserData_Parms GetRebootUserData_Parms;
 
-	pFnGetRebootUserData->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetRebootUserData, &GetRebootUserData_Parms, NULL );
-
-	pFnGetRebootUserData->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetRebootUserData, &GetRebootUserData_Parms ) )
+		this->ProcessEvent ( pFnGetRebootUserData, &GetRebootUserData_Parms, NULL );
 
 	return GetRebootUserData_Parms.ReturnValue;
 };
@@ -12647,18 +10918,14 @@ int USFXOnlineComponentPlatformDingo::GetRebootUserData ( )
 
 bool USFXOnlineComponentPlatformDingo::WasRebootedFromOSCodeRedemptionUI ( )
 {
-	static UFunction* pFnWasRebootedFromOSCodeRedemptionUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWasRebootedFromOSCodeRedemptionUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.WasRebootedFromOSCodeRedemptionUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWasRebootedFromOSCodeRedemptionUI )
-		pFnWasRebootedFromOSCodeRedemptionUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.WasRebootedFromOSCodeRedemptionUI" );
+	UFunction* const pFnWasRebootedFromOSCodeRedemptionUI = pFnWasRebootedFromOSCodeRedemptionUIRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execWasRebootedFromOSCodeRedemptionUI_Parms WasRebootedFromOSCodeRedemptionUI_Parms;
 
-	pFnWasRebootedFromOSCodeRedemptionUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms, NULL );
-
-	pFnWasRebootedFromOSCodeRedemptionUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms ) )
+		this->ProcessEvent ( pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms, NULL );
 
 	return WasRebootedFromOSCodeRedemptionUI_Parms.ReturnValue;
 };
@@ -12671,19 +10938,15 @@ bool USFXOnlineComponentPlatformDingo::WasRebootedFromOSCodeRedemptionUI ( )
 
 bool USFXOnlineComponentPlatformDingo::ShowCodeRedemptionUI ( int UserData )
 {
-	static UFunction* pFnShowCodeRedemptionUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowCodeRedemptionUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowCodeRedemptionUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowCodeRedemptionUI )
-		pFnShowCodeRedemptionUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowCodeRedemptionUI" );
+	UFunction* const pFnShowCodeRedemptionUI = pFnShowCodeRedemptionUIRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execShowCodeRedemptionUI_Parms ShowCodeRedemptionUI_Parms;
 	ShowCodeRedemptionUI_Parms.UserData = UserData;
 
-	pFnShowCodeRedemptionUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms, NULL );
-
-	pFnShowCodeRedemptionUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms ) )
+		this->ProcessEvent ( pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms, NULL );
 
 	return ShowCodeRedemptionUI_Parms.ReturnValue;
 };
@@ -12695,18 +10958,14 @@ bool USFXOnlineComponentPlatformDingo::ShowCodeRedemptionUI ( int UserData )
 
 bool USFXOnlineComponentPlatformDingo::ShowStoreUI ( )
 {
-	static UFunction* pFnShowStoreUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowStoreUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowStoreUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowStoreUI )
-		pFnShowStoreUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowStoreUI" );
+	UFunction* const pFnShowStoreUI = pFnShowStoreUIRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execShowStoreUI_Parms ShowStoreUI_Parms;
 
-	pFnShowStoreUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowStoreUI, &ShowStoreUI_Parms, NULL );
-
-	pFnShowStoreUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowStoreUI, &ShowStoreUI_Parms ) )
+		this->ProcessEvent ( pFnShowStoreUI, &ShowStoreUI_Parms, NULL );
 
 	return ShowStoreUI_Parms.ReturnValue;
 };
@@ -12720,10 +10979,9 @@ bool USFXOnlineComponentPlatformDingo::ShowStoreUI ( )
 
 bool USFXOnlineComponentPlatformDingo::GetOnlineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOnlineXuid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOnlineXuidRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetOnlineXuid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOnlineXuid )
-		pFnGetOnlineXuid = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetOnlineXuid" );
+	UFunction* const pFnGetOnlineXuid = pFnGetOnlineXuidRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execGetOnlineXuid_Parms GetOnlineXuid_Parms;
 	GetOnlineXuid_Parms.nUserIndex = nUserIndex;
@@ -12731,11 +10989,8 @@ bool USFXOnlineComponentPlatformDingo::GetOnlineXuid ( int nUserIndex, struct FU
 	if ( oPlayerXuid )
 		memcpy ( &GetOnlineXuid_Parms.oPlayerXuid, oPlayerXuid, 0x8 );
 
-	pFnGetOnlineXuid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetOnlineXuid, &GetOnlineXuid_Parms, NULL );
-
-	pFnGetOnlineXuid->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetOnlineXuid, &GetOnlineXuid_Parms ) )
+		this->ProcessEvent ( pFnGetOnlineXuid, &GetOnlineXuid_Parms, NULL );
 
 	if ( oPlayerXuid )
 		memcpy ( oPlayerXuid, &GetOnlineXuid_Parms.oPlayerXuid, 0x8 );
@@ -12752,10 +11007,9 @@ bool USFXOnlineComponentPlatformDingo::GetOnlineXuid ( int nUserIndex, struct FU
 
 bool USFXOnlineComponentPlatformDingo::GetOfflineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOfflineXuid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOfflineXuidRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetOfflineXuid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOfflineXuid )
-		pFnGetOfflineXuid = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetOfflineXuid" );
+	UFunction* const pFnGetOfflineXuid = pFnGetOfflineXuidRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execGetOfflineXuid_Parms GetOfflineXuid_Parms;
 	GetOfflineXuid_Parms.nUserIndex = nUserIndex;
@@ -12763,11 +11017,8 @@ bool USFXOnlineComponentPlatformDingo::GetOfflineXuid ( int nUserIndex, struct F
 	if ( oPlayerXuid )
 		memcpy ( &GetOfflineXuid_Parms.oPlayerXuid, oPlayerXuid, 0x8 );
 
-	pFnGetOfflineXuid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetOfflineXuid, &GetOfflineXuid_Parms, NULL );
-
-	pFnGetOfflineXuid->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetOfflineXuid, &GetOfflineXuid_Parms ) )
+		this->ProcessEvent ( pFnGetOfflineXuid, &GetOfflineXuid_Parms, NULL );
 
 	if ( oPlayerXuid )
 		memcpy ( oPlayerXuid, &GetOfflineXuid_Parms.oPlayerXuid, 0x8 );
@@ -12790,10 +11041,9 @@ bool USFXOnlineComponentPlatformDingo::GetOfflineXuid ( int nUserIndex, struct F
 
 bool USFXOnlineComponentPlatformDingo::ShowKeyboardUI ( unsigned char LocalUserNum, FString const& sTitleText, FString const& sDescriptionText, unsigned char nKeyboardType, unsigned long bShouldValidate, unsigned long bRouteThroughConsole, FString const& sDefaultText, int nMaxResultLength )
 {
-	static UFunction* pFnShowKeyboardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowKeyboardUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowKeyboardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowKeyboardUI )
-		pFnShowKeyboardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowKeyboardUI" );
+	UFunction* const pFnShowKeyboardUI = pFnShowKeyboardUIRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execShowKeyboardUI_Parms ShowKeyboardUI_Parms;
 	ShowKeyboardUI_Parms.LocalUserNum = LocalUserNum;
@@ -12805,11 +11055,8 @@ bool USFXOnlineComponentPlatformDingo::ShowKeyboardUI ( unsigned char LocalUserN
 	memcpy ( &ShowKeyboardUI_Parms.sDefaultText, &sDefaultText, 0x10 );
 	ShowKeyboardUI_Parms.nMaxResultLength = nMaxResultLength;
 
-	pFnShowKeyboardUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowKeyboardUI, &ShowKeyboardUI_Parms, NULL );
-
-	pFnShowKeyboardUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowKeyboardUI, &ShowKeyboardUI_Parms ) )
+		this->ProcessEvent ( pFnShowKeyboardUI, &ShowKeyboardUI_Parms, NULL );
 
 	return ShowKeyboardUI_Parms.ReturnValue;
 };
@@ -12823,20 +11070,16 @@ bool USFXOnlineComponentPlatformDingo::ShowKeyboardUI ( unsigned char LocalUserN
 
 bool USFXOnlineComponentPlatformDingo::ShowFriendsInviteUI ( unsigned char eLocalUserNum, struct FUniqueNetId const& oPlayerXuid )
 {
-	static UFunction* pFnShowFriendsInviteUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFriendsInviteUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowFriendsInviteUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFriendsInviteUI )
-		pFnShowFriendsInviteUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowFriendsInviteUI" );
+	UFunction* const pFnShowFriendsInviteUI = pFnShowFriendsInviteUIRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execShowFriendsInviteUI_Parms ShowFriendsInviteUI_Parms;
 	ShowFriendsInviteUI_Parms.eLocalUserNum = eLocalUserNum;
 	memcpy ( &ShowFriendsInviteUI_Parms.oPlayerXuid, &oPlayerXuid, 0x8 );
 
-	pFnShowFriendsInviteUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms, NULL );
-
-	pFnShowFriendsInviteUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms ) )
+		this->ProcessEvent ( pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms, NULL );
 
 	return ShowFriendsInviteUI_Parms.ReturnValue;
 };
@@ -12849,19 +11092,15 @@ bool USFXOnlineComponentPlatformDingo::ShowFriendsInviteUI ( unsigned char eLoca
 
 bool USFXOnlineComponentPlatformDingo::ShowFriendsUI ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnShowFriendsUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFriendsUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowFriendsUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFriendsUI )
-		pFnShowFriendsUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowFriendsUI" );
+	UFunction* const pFnShowFriendsUI = pFnShowFriendsUIRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execShowFriendsUI_Parms ShowFriendsUI_Parms;
 	ShowFriendsUI_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnShowFriendsUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFriendsUI, &ShowFriendsUI_Parms, NULL );
-
-	pFnShowFriendsUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFriendsUI, &ShowFriendsUI_Parms ) )
+		this->ProcessEvent ( pFnShowFriendsUI, &ShowFriendsUI_Parms, NULL );
 
 	return ShowFriendsUI_Parms.ReturnValue;
 };
@@ -12874,19 +11113,15 @@ bool USFXOnlineComponentPlatformDingo::ShowFriendsUI ( unsigned char eLocalUserN
 
 bool USFXOnlineComponentPlatformDingo::ShowAchievementsUI ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnShowAchievementsUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowAchievementsUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowAchievementsUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowAchievementsUI )
-		pFnShowAchievementsUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowAchievementsUI" );
+	UFunction* const pFnShowAchievementsUI = pFnShowAchievementsUIRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execShowAchievementsUI_Parms ShowAchievementsUI_Parms;
 	ShowAchievementsUI_Parms.byLocalUserNum = byLocalUserNum;
 
-	pFnShowAchievementsUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowAchievementsUI, &ShowAchievementsUI_Parms, NULL );
-
-	pFnShowAchievementsUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowAchievementsUI, &ShowAchievementsUI_Parms ) )
+		this->ProcessEvent ( pFnShowAchievementsUI, &ShowAchievementsUI_Parms, NULL );
 
 	return ShowAchievementsUI_Parms.ReturnValue;
 };
@@ -12900,20 +11135,16 @@ bool USFXOnlineComponentPlatformDingo::ShowAchievementsUI ( unsigned char byLoca
 
 bool USFXOnlineComponentPlatformDingo::ShowFeedbackUI ( unsigned char eLocalUserNum, struct FUniqueNetId const& oPlayerId )
 {
-	static UFunction* pFnShowFeedbackUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFeedbackUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowFeedbackUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFeedbackUI )
-		pFnShowFeedbackUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowFeedbackUI" );
+	UFunction* const pFnShowFeedbackUI = pFnShowFeedbackUIRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execShowFeedbackUI_Parms ShowFeedbackUI_Parms;
 	ShowFeedbackUI_Parms.eLocalUserNum = eLocalUserNum;
 	memcpy ( &ShowFeedbackUI_Parms.oPlayerId, &oPlayerId, 0x8 );
 
-	pFnShowFeedbackUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFeedbackUI, &ShowFeedbackUI_Parms, NULL );
-
-	pFnShowFeedbackUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFeedbackUI, &ShowFeedbackUI_Parms ) )
+		this->ProcessEvent ( pFnShowFeedbackUI, &ShowFeedbackUI_Parms, NULL );
 
 	return ShowFeedbackUI_Parms.ReturnValue;
 };
@@ -12927,20 +11158,16 @@ bool USFXOnlineComponentPlatformDingo::ShowFeedbackUI ( unsigned char eLocalUser
 
 bool USFXOnlineComponentPlatformDingo::ShowGamerCardUI ( unsigned char eLocalUserNum, struct FUniqueNetId const& oPlayerId )
 {
-	static UFunction* pFnShowGamerCardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowGamerCardUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowGamerCardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowGamerCardUI )
-		pFnShowGamerCardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowGamerCardUI" );
+	UFunction* const pFnShowGamerCardUI = pFnShowGamerCardUIRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execShowGamerCardUI_Parms ShowGamerCardUI_Parms;
 	ShowGamerCardUI_Parms.eLocalUserNum = eLocalUserNum;
 	memcpy ( &ShowGamerCardUI_Parms.oPlayerId, &oPlayerId, 0x8 );
 
-	pFnShowGamerCardUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowGamerCardUI, &ShowGamerCardUI_Parms, NULL );
-
-	pFnShowGamerCardUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowGamerCardUI, &ShowGamerCardUI_Parms ) )
+		this->ProcessEvent ( pFnShowGamerCardUI, &ShowGamerCardUI_Parms, NULL );
 
 	return ShowGamerCardUI_Parms.ReturnValue;
 };
@@ -12953,19 +11180,15 @@ bool USFXOnlineComponentPlatformDingo::ShowGamerCardUI ( unsigned char eLocalUse
 
 unsigned char USFXOnlineComponentPlatformDingo::CanShowPresenceInformation ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanShowPresenceInformationRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanShowPresenceInformation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanShowPresenceInformation" );
+	UFunction* const pFnCanShowPresenceInformation = pFnCanShowPresenceInformationRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanShowPresenceInformation->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
-
-	pFnCanShowPresenceInformation->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms ) )
+		this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
 
 	return CanShowPresenceInformation_Parms.ReturnValue;
 };
@@ -12978,19 +11201,15 @@ unsigned char USFXOnlineComponentPlatformDingo::CanShowPresenceInformation ( uns
 
 unsigned char USFXOnlineComponentPlatformDingo::CanViewPlayerProfiles ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanViewPlayerProfilesRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanViewPlayerProfiles", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanViewPlayerProfiles" );
+	UFunction* const pFnCanViewPlayerProfiles = pFnCanViewPlayerProfilesRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanViewPlayerProfiles->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
-
-	pFnCanViewPlayerProfiles->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms ) )
+		this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
 
 	return CanViewPlayerProfiles_Parms.ReturnValue;
 };
@@ -13003,19 +11222,15 @@ unsigned char USFXOnlineComponentPlatformDingo::CanViewPlayerProfiles ( unsigned
 
 unsigned char USFXOnlineComponentPlatformDingo::CanPurchaseContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPurchaseContentRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanPurchaseContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanPurchaseContent" );
+	UFunction* const pFnCanPurchaseContent = pFnCanPurchaseContentRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanPurchaseContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
-
-	pFnCanPurchaseContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPurchaseContent, &CanPurchaseContent_Parms ) )
+		this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
 
 	return CanPurchaseContent_Parms.ReturnValue;
 };
@@ -13028,19 +11243,15 @@ unsigned char USFXOnlineComponentPlatformDingo::CanPurchaseContent ( unsigned ch
 
 unsigned char USFXOnlineComponentPlatformDingo::CanDownloadUserContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanDownloadUserContentRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanDownloadUserContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanDownloadUserContent" );
+	UFunction* const pFnCanDownloadUserContent = pFnCanDownloadUserContentRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanDownloadUserContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
-
-	pFnCanDownloadUserContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanDownloadUserContent, &CanDownloadUserContent_Parms ) )
+		this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
 
 	return CanDownloadUserContent_Parms.ReturnValue;
 };
@@ -13053,19 +11264,15 @@ unsigned char USFXOnlineComponentPlatformDingo::CanDownloadUserContent ( unsigne
 
 unsigned char USFXOnlineComponentPlatformDingo::CanCommunicate ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanCommunicate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanCommunicateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanCommunicate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanCommunicate" );
+	UFunction* const pFnCanCommunicate = pFnCanCommunicateRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanCommunicate->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
-
-	pFnCanCommunicate->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanCommunicate, &CanCommunicate_Parms ) )
+		this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
 
 	return CanCommunicate_Parms.ReturnValue;
 };
@@ -13078,19 +11285,15 @@ unsigned char USFXOnlineComponentPlatformDingo::CanCommunicate ( unsigned char e
 
 unsigned char USFXOnlineComponentPlatformDingo::CanPlayOnline ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPlayOnlineRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanPlayOnline", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanPlayOnline" );
+	UFunction* const pFnCanPlayOnline = pFnCanPlayOnlineRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanPlayOnline->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
-
-	pFnCanPlayOnline->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPlayOnline, &CanPlayOnline_Parms ) )
+		this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
 
 	return CanPlayOnline_Parms.ReturnValue;
 };
@@ -13105,10 +11308,9 @@ unsigned char USFXOnlineComponentPlatformDingo::CanPlayOnline ( unsigned char eL
 
 void USFXOnlineComponentPlatformDingo::SetRichPresence ( unsigned char eLocalUserNum, int nPresenceMode, TArray<struct FLocalizedStringSetting>* aLocalizedStringSettings, TArray<struct FSettingsProperty>* aProperties )
 {
-	static UFunction* pFnSetRichPresence = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetRichPresenceRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.SetRichPresence", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetRichPresence )
-		pFnSetRichPresence = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.SetRichPresence" );
+	UFunction* const pFnSetRichPresence = pFnSetRichPresenceRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execSetRichPresence_Parms SetRichPresence_Parms;
 	SetRichPresence_Parms.eLocalUserNum = eLocalUserNum;
@@ -13120,11 +11322,8 @@ void USFXOnlineComponentPlatformDingo::SetRichPresence ( unsigned char eLocalUse
 	if ( aProperties )
 		memcpy ( &SetRichPresence_Parms.aProperties, aProperties, 0x10 );
 
-	pFnSetRichPresence->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetRichPresence, &SetRichPresence_Parms, NULL );
-
-	pFnSetRichPresence->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetRichPresence, &SetRichPresence_Parms ) )
+		this->ProcessEvent ( pFnSetRichPresence, &SetRichPresence_Parms, NULL );
 
 	if ( aLocalizedStringSettings )
 		memcpy ( aLocalizedStringSettings, &SetRichPresence_Parms.aLocalizedStringSettings, 0x10 );
@@ -13141,19 +11340,15 @@ void USFXOnlineComponentPlatformDingo::SetRichPresence ( unsigned char eLocalUse
 
 bool USFXOnlineComponentPlatformDingo::ShowLoginUI ( unsigned long bShowOnlineOnly )
 {
-	static UFunction* pFnShowLoginUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowLoginUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowLoginUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowLoginUI )
-		pFnShowLoginUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowLoginUI" );
+	UFunction* const pFnShowLoginUI = pFnShowLoginUIRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execShowLoginUI_Parms ShowLoginUI_Parms;
 	ShowLoginUI_Parms.bShowOnlineOnly = bShowOnlineOnly;
 
-	pFnShowLoginUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowLoginUI, &ShowLoginUI_Parms, NULL );
-
-	pFnShowLoginUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowLoginUI, &ShowLoginUI_Parms ) )
+		this->ProcessEvent ( pFnShowLoginUI, &ShowLoginUI_Parms, NULL );
 
 	return ShowLoginUI_Parms.ReturnValue;
 };
@@ -13166,19 +11361,15 @@ bool USFXOnlineComponentPlatformDingo::ShowLoginUI ( unsigned long bShowOnlineOn
 
 unsigned char USFXOnlineComponentPlatformDingo::GetLoginStatus ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLoginStatusRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetLoginStatus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetLoginStatus" );
+	UFunction* const pFnGetLoginStatus = pFnGetLoginStatusRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execGetLoginStatus_Parms GetLoginStatus_Parms;
 	GetLoginStatus_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnGetLoginStatus->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetLoginStatus, &GetLoginStatus_Parms, NULL );
-
-	pFnGetLoginStatus->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetLoginStatus, &GetLoginStatus_Parms ) )
+		this->ProcessEvent ( pFnGetLoginStatus, &GetLoginStatus_Parms, NULL );
 
 	return GetLoginStatus_Parms.ReturnValue;
 };
@@ -13192,20 +11383,16 @@ unsigned char USFXOnlineComponentPlatformDingo::GetLoginStatus ( unsigned char e
 
 bool USFXOnlineComponentPlatformDingo::AddRecentPlayer ( struct FUniqueNetId const& oPlayerId, FString const& sDescription )
 {
-	static UFunction* pFnAddRecentPlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddRecentPlayerRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.AddRecentPlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddRecentPlayer )
-		pFnAddRecentPlayer = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.AddRecentPlayer" );
+	UFunction* const pFnAddRecentPlayer = pFnAddRecentPlayerRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execAddRecentPlayer_Parms AddRecentPlayer_Parms;
 	memcpy ( &AddRecentPlayer_Parms.oPlayerId, &oPlayerId, 0x8 );
 	memcpy ( &AddRecentPlayer_Parms.sDescription, &sDescription, 0x10 );
 
-	pFnAddRecentPlayer->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddRecentPlayer, &AddRecentPlayer_Parms, NULL );
-
-	pFnAddRecentPlayer->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAddRecentPlayer, &AddRecentPlayer_Parms ) )
+		this->ProcessEvent ( pFnAddRecentPlayer, &AddRecentPlayer_Parms, NULL );
 
 	return AddRecentPlayer_Parms.ReturnValue;
 };
@@ -13217,18 +11404,14 @@ bool USFXOnlineComponentPlatformDingo::AddRecentPlayer ( struct FUniqueNetId con
 
 struct SFXName USFXOnlineComponentPlatformDingo::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -13239,18 +11422,14 @@ struct SFXName USFXOnlineComponentPlatformDingo::GetAPIName ( )
 
 void USFXOnlineComponentPlatformDingo::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.OnInitialize
@@ -13260,31 +11439,24 @@ void USFXOnlineComponentPlatformDingo::OnRelease ( )
 
 void USFXOnlineComponentPlatformDingo::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentPlatformDingo_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineComponentAchievementOrbis::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentAchievementOrbis::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentAchievementOrbis::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.GetTitleAchievementID
@@ -13296,10 +11468,9 @@ class UClass* USFXOnlineComponentAchievementOrbis::StaticClass()
 
 int USFXOnlineComponentAchievementOrbis::GetTitleAchievementID ( int Index, int* SetIndex )
 {
-	static UFunction* pFnGetTitleAchievementID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTitleAchievementIDRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.GetTitleAchievementID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTitleAchievementID )
-		pFnGetTitleAchievementID = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.GetTitleAchievementID" );
+	UFunction* const pFnGetTitleAchievementID = pFnGetTitleAchievementIDRef.Get ( );
 
 	USFXOnlineComponentAchievementOrbis_execGetTitleAchievementID_Parms GetTitleAchievementID_Parms;
 	GetTitleAchievementID_Parms.Index = Index;
@@ -13307,11 +11478,8 @@ int USFXOnlineComponentAchievementOrbis::GetTitleAchievementID ( int Index, int*
 	if ( SetIndex )
 		GetTitleAchievementID_Parms.SetIndex = *SetIndex;
 
-	pFnGetTitleAchievementID->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetTitleAchievementID, &GetTitleAchievementID_Parms, NULL );
-
-	pFnGetTitleAchievementID->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetTitleAchievementID, &GetTitleAchievementID_Parms ) )
+		this->ProcessEvent ( pFnGetTitleAchievementID, &GetTitleAchievementID_Parms, NULL );
 
 	if ( SetIndex )
 		*SetIndex = GetTitleAchievementID_Parms.SetIndex;
@@ -13328,10 +11496,9 @@ int USFXOnlineComponentAchievementOrbis::GetTitleAchievementID ( int Index, int*
 
 int USFXOnlineComponentAchievementOrbis::GetPlatformAchievementID ( int Index, int* SetIndex )
 {
-	static UFunction* pFnGetPlatformAchievementID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPlatformAchievementIDRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.GetPlatformAchievementID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPlatformAchievementID )
-		pFnGetPlatformAchievementID = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.GetPlatformAchievementID" );
+	UFunction* const pFnGetPlatformAchievementID = pFnGetPlatformAchievementIDRef.Get ( );
 
 	USFXOnlineComponentAchievementOrbis_execGetPlatformAchievementID_Parms GetPlatformAchievementID_Parms;
 	GetPlatformAchievementID_Parms.Index = Index;
@@ -13339,11 +11506,8 @@ int USFXOnlineComponentAchievementOrbis::GetPlatformAchievementID ( int Index, i
 	if ( SetIndex )
 		GetPlatformAchievementID_Parms.SetIndex = *SetIndex;
 
-	pFnGetPlatformAchievementID->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms, NULL );
-
-	pFnGetPlatformAchievementID->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms ) )
+		this->ProcessEvent ( pFnGetPlatformAchievementID, &GetPlatformAchievementID_Parms, NULL );
 
 	if ( SetIndex )
 		*SetIndex = GetPlatformAchievementID_Parms.SetIndex;
@@ -13358,18 +11522,14 @@ int USFXOnlineComponentAchievementOrbis::GetPlatformAchievementID ( int Index, i
 
 struct SFXName USFXOnlineComponentAchievementOrbis::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentAchievementOrbis_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -13380,18 +11540,14 @@ struct SFXName USFXOnlineComponentAchievementOrbis::GetAPIName ( )
 
 void USFXOnlineComponentAchievementOrbis::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentAchievementOrbis_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.OnInitialize
@@ -13401,19 +11557,15 @@ void USFXOnlineComponentAchievementOrbis::OnRelease ( )
 
 void USFXOnlineComponentAchievementOrbis::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentAchievementOrbis_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.IsGranted
@@ -13425,20 +11577,16 @@ void USFXOnlineComponentAchievementOrbis::OnInitialize ( class USFXOnlineSubsyst
 
 bool USFXOnlineComponentAchievementOrbis::IsGranted ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnIsGranted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsGrantedRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.IsGranted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsGranted )
-		pFnIsGranted = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.IsGranted" );
+	UFunction* const pFnIsGranted = pFnIsGrantedRef.Get ( );
 
 	USFXOnlineComponentAchievementOrbis_execIsGranted_Parms IsGranted_Parms;
 	IsGranted_Parms.LocalUserNum = LocalUserNum;
 	IsGranted_Parms.AchievementId = AchievementId;
 
-	pFnIsGranted->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsGranted, &IsGranted_Parms, NULL );
-
-	pFnIsGranted->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsGranted, &IsGranted_Parms ) )
+		this->ProcessEvent ( pFnIsGranted, &IsGranted_Parms, NULL );
 
 	return IsGranted_Parms.ReturnValue;
 };
@@ -13451,32 +11599,25 @@ bool USFXOnlineComponentAchievementOrbis::IsGranted ( unsigned char LocalUserNum
 
 void USFXOnlineComponentAchievementOrbis::Grant ( unsigned char LocalUserNum, int AchievementId )
 {
-	static UFunction* pFnGrant = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGrantRef { L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.Grant", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGrant )
-		pFnGrant = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.Grant" );
+	UFunction* const pFnGrant = pFnGrantRef.Get ( );
 
 	USFXOnlineComponentAchievementOrbis_execGrant_Parms Grant_Parms;
 	Grant_Parms.LocalUserNum = LocalUserNum;
 	Grant_Parms.AchievementId = AchievementId;
 
-	pFnGrant->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGrant, &Grant_Parms, NULL );
-
-	pFnGrant->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGrant, &Grant_Parms ) )
+		this->ProcessEvent ( pFnGrant, &Grant_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineComponentPlatformOrbis::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentPlatformOrbis::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentPlatformOrbis::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.OnKeyboardUIClosed
@@ -13487,20 +11628,16 @@ class UClass* USFXOnlineComponentPlatformOrbis::StaticClass()
 
 void USFXOnlineComponentPlatformOrbis::OnKeyboardUIClosed ( unsigned long Success, FString const& InputBuffer )
 {
-	static UFunction* pFnOnKeyboardUIClosed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnKeyboardUIClosedRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.OnKeyboardUIClosed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnKeyboardUIClosed )
-		pFnOnKeyboardUIClosed = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.OnKeyboardUIClosed" );
+	UFunction* const pFnOnKeyboardUIClosed = pFnOnKeyboardUIClosedRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execOnKeyboardUIClosed_Parms OnKeyboardUIClosed_Parms;
 	OnKeyboardUIClosed_Parms.Success = Success;
 	memcpy ( &OnKeyboardUIClosed_Parms.InputBuffer, &InputBuffer, 0x10 );
 
-	pFnOnKeyboardUIClosed->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnKeyboardUIClosed, &OnKeyboardUIClosed_Parms, NULL );
-
-	pFnOnKeyboardUIClosed->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnKeyboardUIClosed, &OnKeyboardUIClosed_Parms ) )
+		this->ProcessEvent ( pFnOnKeyboardUIClosed, &OnKeyboardUIClosed_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetRebootUserData
@@ -13510,18 +11647,14 @@ void USFXOnlineComponentPlatformOrbis::OnKeyboardUIClosed ( unsigned long Succes
 
 int USFXOnlineComponentPlatformOrbis::GetRebootUserData ( )
 {
-	static UFunction* pFnGetRebootUserData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetRebootUserDataRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetRebootUserData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetRebootUserData )
-		pFnGetRebootUserData = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetRebootUserData" );
+	UFunction* const pFnGetRebootUserData = pFnGetRebootUserDataRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execGetRebootUserData_Parms GetRebootUserData_Parms;
 
-	pFnGetRebootUserData->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetRebootUserData, &GetRebootUserData_Parms, NULL );
-
-	pFnGetRebootUserData->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetRebootUserData, &GetRebootUserData_Parms ) )
+		this->ProcessEvent ( pFnGetRebootUserData, &GetRebootUserData_Parms, NULL );
 
 	return GetRebootUserData_Parms.ReturnValue;
 };
@@ -13533,18 +11666,14 @@ int USFXOnlineComponentPlatformOrbis::GetRebootUserData ( )
 
 bool USFXOnlineComponentPlatformOrbis::WasRebootedFromOSCodeRedemptionUI ( )
 {
-	static UFunction* pFnWasRebootedFromOSCodeRedemptionUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWasRebootedFromOSCodeRedemptionUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.WasRebootedFromOSCodeRedemptionUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWasRebootedFromOSCodeRedemptionUI )
-		pFnWasRebootedFromOSCodeRedemptionUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.WasRebootedFromOSCodeRedemptionUI" );
+	UFunction* const pFnWasRebootedFromOSCodeRedemptionUI = pFnWasRebootedFromOSCodeRedemptionUIRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execWasRebootedFromOSCodeRedemptionUI_Parms WasRebootedFromOSCodeRedemptionUI_Parms;
 
-	pFnWasRebootedFromOSCodeRedemptionUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms, NULL );
-
-	pFnWasRebootedFromOSCodeRedemptionUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms ) )
+		this->ProcessEvent ( pFnWasRebootedFromOSCodeRedemptionUI, &WasRebootedFromOSCodeRedemptionUI_Parms, NULL );
 
 	return WasRebootedFromOSCodeRedemptionUI_Parms.ReturnValue;
 };
@@ -13557,19 +11686,15 @@ bool USFXOnlineComponentPlatformOrbis::WasRebootedFromOSCodeRedemptionUI ( )
 
 bool USFXOnlineComponentPlatformOrbis::ShowCodeRedemptionUI ( int UserData )
 {
-	static UFunction* pFnShowCodeRedemptionUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowCodeRedemptionUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowCodeRedemptionUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowCodeRedemptionUI )
-		pFnShowCodeRedemptionUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowCodeRedemptionUI" );
+	UFunction* const pFnShowCodeRedemptionUI = pFnShowCodeRedemptionUIRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execShowCodeRedemptionUI_Parms ShowCodeRedemptionUI_Parms;
 	ShowCodeRedemptionUI_Parms.UserData = UserData;
 
-	pFnShowCodeRedemptionUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms, NULL );
-
-	pFnShowCodeRedemptionUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms ) )
+		this->ProcessEvent ( pFnShowCodeRedemptionUI, &ShowCodeRedemptionUI_Parms, NULL );
 
 	return ShowCodeRedemptionUI_Parms.ReturnValue;
 };
@@ -13581,18 +11706,14 @@ bool USFXOnlineComponentPlatformOrbis::ShowCodeRedemptionUI ( int UserData )
 
 bool USFXOnlineComponentPlatformOrbis::ShowStoreUI ( )
 {
-	static UFunction* pFnShowStoreUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowStoreUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowStoreUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowStoreUI )
-		pFnShowStoreUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowStoreUI" );
+	UFunction* const pFnShowStoreUI = pFnShowStoreUIRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execShowStoreUI_Parms ShowStoreUI_Parms;
 
-	pFnShowStoreUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowStoreUI, &ShowStoreUI_Parms, NULL );
-
-	pFnShowStoreUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowStoreUI, &ShowStoreUI_Parms ) )
+		this->ProcessEvent ( pFnShowStoreUI, &ShowStoreUI_Parms, NULL );
 
 	return ShowStoreUI_Parms.ReturnValue;
 };
@@ -13606,10 +11727,9 @@ bool USFXOnlineComponentPlatformOrbis::ShowStoreUI ( )
 
 bool USFXOnlineComponentPlatformOrbis::GetOnlineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOnlineXuid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOnlineXuidRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetOnlineXuid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOnlineXuid )
-		pFnGetOnlineXuid = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetOnlineXuid" );
+	UFunction* const pFnGetOnlineXuid = pFnGetOnlineXuidRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execGetOnlineXuid_Parms GetOnlineXuid_Parms;
 	GetOnlineXuid_Parms.nUserIndex = nUserIndex;
@@ -13617,11 +11737,8 @@ bool USFXOnlineComponentPlatformOrbis::GetOnlineXuid ( int nUserIndex, struct FU
 	if ( oPlayerXuid )
 		memcpy ( &GetOnlineXuid_Parms.oPlayerXuid, oPlayerXuid, 0x8 );
 
-	pFnGetOnlineXuid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetOnlineXuid, &GetOnlineXuid_Parms, NULL );
-
-	pFnGetOnlineXuid->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetOnlineXuid, &GetOnlineXuid_Parms ) )
+		this->ProcessEvent ( pFnGetOnlineXuid, &GetOnlineXuid_Parms, NULL );
 
 	if ( oPlayerXuid )
 		memcpy ( oPlayerXuid, &GetOnlineXuid_Parms.oPlayerXuid, 0x8 );
@@ -13638,10 +11755,9 @@ bool USFXOnlineComponentPlatformOrbis::GetOnlineXuid ( int nUserIndex, struct FU
 
 bool USFXOnlineComponentPlatformOrbis::GetOfflineXuid ( int nUserIndex, struct FUniqueNetId* oPlayerXuid )
 {
-	static UFunction* pFnGetOfflineXuid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOfflineXuidRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetOfflineXuid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOfflineXuid )
-		pFnGetOfflineXuid = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetOfflineXuid" );
+	UFunction* const pFnGetOfflineXuid = pFnGetOfflineXuidRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execGetOfflineXuid_Parms GetOfflineXuid_Parms;
 	GetOfflineXuid_Parms.nUserIndex = nUserIndex;
@@ -13649,11 +11765,8 @@ bool USFXOnlineComponentPlatformOrbis::GetOfflineXuid ( int nUserIndex, struct F
 	if ( oPlayerXuid )
 		memcpy ( &GetOfflineXuid_Parms.oPlayerXuid, oPlayerXuid, 0x8 );
 
-	pFnGetOfflineXuid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetOfflineXuid, &GetOfflineXuid_Parms, NULL );
-
-	pFnGetOfflineXuid->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetOfflineXuid, &GetOfflineXuid_Parms ) )
+		this->ProcessEvent ( pFnGetOfflineXuid, &GetOfflineXuid_Parms, NULL );
 
 	if ( oPlayerXuid )
 		memcpy ( oPlayerXuid, &GetOfflineXuid_Parms.oPlayerXuid, 0x8 );
@@ -13676,10 +11789,9 @@ bool USFXOnlineComponentPlatformOrbis::GetOfflineXuid ( int nUserIndex, struct F
 
 bool USFXOnlineComponentPlatformOrbis::ShowKeyboardUI ( unsigned char LocalUserNum, FString const& sTitleText, FString const& sDescriptionText, unsigned char nKeyboardType, unsigned long bShouldValidate, unsigned long bRouteThroughConsole, FString const& sDefaultText, int nMaxResultLength )
 {
-	static UFunction* pFnShowKeyboardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowKeyboardUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowKeyboardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowKeyboardUI )
-		pFnShowKeyboardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowKeyboardUI" );
+	UFunction* const pFnShowKeyboardUI = pFnShowKeyboardUIRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execShowKeyboardUI_Parms ShowKeyboardUI_Parms;
 	ShowKeyboardUI_Parms.LocalUserNum = LocalUserNum;
@@ -13691,11 +11803,8 @@ bool USFXOnlineComponentPlatformOrbis::ShowKeyboardUI ( unsigned char LocalUserN
 	memcpy ( &ShowKeyboardUI_Parms.sDefaultText, &sDefaultText, 0x10 );
 	ShowKeyboardUI_Parms.nMaxResultLength = nMaxResultLength;
 
-	pFnShowKeyboardUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowKeyboardUI, &ShowKeyboardUI_Parms, NULL );
-
-	pFnShowKeyboardUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowKeyboardUI, &ShowKeyboardUI_Parms ) )
+		this->ProcessEvent ( pFnShowKeyboardUI, &ShowKeyboardUI_Parms, NULL );
 
 	return ShowKeyboardUI_Parms.ReturnValue;
 };
@@ -13709,20 +11818,16 @@ bool USFXOnlineComponentPlatformOrbis::ShowKeyboardUI ( unsigned char LocalUserN
 
 bool USFXOnlineComponentPlatformOrbis::ShowFriendsInviteUI ( unsigned char eLocalUserNum, struct FUniqueNetId const& oPlayerXuid )
 {
-	static UFunction* pFnShowFriendsInviteUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFriendsInviteUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowFriendsInviteUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFriendsInviteUI )
-		pFnShowFriendsInviteUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowFriendsInviteUI" );
+	UFunction* const pFnShowFriendsInviteUI = pFnShowFriendsInviteUIRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execShowFriendsInviteUI_Parms ShowFriendsInviteUI_Parms;
 	ShowFriendsInviteUI_Parms.eLocalUserNum = eLocalUserNum;
 	memcpy ( &ShowFriendsInviteUI_Parms.oPlayerXuid, &oPlayerXuid, 0x8 );
 
-	pFnShowFriendsInviteUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms, NULL );
-
-	pFnShowFriendsInviteUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms ) )
+		this->ProcessEvent ( pFnShowFriendsInviteUI, &ShowFriendsInviteUI_Parms, NULL );
 
 	return ShowFriendsInviteUI_Parms.ReturnValue;
 };
@@ -13735,19 +11840,15 @@ bool USFXOnlineComponentPlatformOrbis::ShowFriendsInviteUI ( unsigned char eLoca
 
 bool USFXOnlineComponentPlatformOrbis::ShowFriendsUI ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnShowFriendsUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFriendsUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowFriendsUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFriendsUI )
-		pFnShowFriendsUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowFriendsUI" );
+	UFunction* const pFnShowFriendsUI = pFnShowFriendsUIRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execShowFriendsUI_Parms ShowFriendsUI_Parms;
 	ShowFriendsUI_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnShowFriendsUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFriendsUI, &ShowFriendsUI_Parms, NULL );
-
-	pFnShowFriendsUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFriendsUI, &ShowFriendsUI_Parms ) )
+		this->ProcessEvent ( pFnShowFriendsUI, &ShowFriendsUI_Parms, NULL );
 
 	return ShowFriendsUI_Parms.ReturnValue;
 };
@@ -13760,19 +11861,15 @@ bool USFXOnlineComponentPlatformOrbis::ShowFriendsUI ( unsigned char eLocalUserN
 
 bool USFXOnlineComponentPlatformOrbis::ShowAchievementsUI ( unsigned char byLocalUserNum )
 {
-	static UFunction* pFnShowAchievementsUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowAchievementsUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowAchievementsUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowAchievementsUI )
-		pFnShowAchievementsUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowAchievementsUI" );
+	UFunction* const pFnShowAchievementsUI = pFnShowAchievementsUIRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execShowAchievementsUI_Parms ShowAchievementsUI_Parms;
 	ShowAchievementsUI_Parms.byLocalUserNum = byLocalUserNum;
 
-	pFnShowAchievementsUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowAchievementsUI, &ShowAchievementsUI_Parms, NULL );
-
-	pFnShowAchievementsUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowAchievementsUI, &ShowAchievementsUI_Parms ) )
+		this->ProcessEvent ( pFnShowAchievementsUI, &ShowAchievementsUI_Parms, NULL );
 
 	return ShowAchievementsUI_Parms.ReturnValue;
 };
@@ -13786,20 +11883,16 @@ bool USFXOnlineComponentPlatformOrbis::ShowAchievementsUI ( unsigned char byLoca
 
 bool USFXOnlineComponentPlatformOrbis::ShowFeedbackUI ( unsigned char eLocalUserNum, struct FUniqueNetId const& oPlayerId )
 {
-	static UFunction* pFnShowFeedbackUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowFeedbackUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowFeedbackUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowFeedbackUI )
-		pFnShowFeedbackUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowFeedbackUI" );
+	UFunction* const pFnShowFeedbackUI = pFnShowFeedbackUIRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execShowFeedbackUI_Parms ShowFeedbackUI_Parms;
 	ShowFeedbackUI_Parms.eLocalUserNum = eLocalUserNum;
 	memcpy ( &ShowFeedbackUI_Parms.oPlayerId, &oPlayerId, 0x8 );
 
-	pFnShowFeedbackUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowFeedbackUI, &ShowFeedbackUI_Parms, NULL );
-
-	pFnShowFeedbackUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowFeedbackUI, &ShowFeedbackUI_Parms ) )
+		this->ProcessEvent ( pFnShowFeedbackUI, &ShowFeedbackUI_Parms, NULL );
 
 	return ShowFeedbackUI_Parms.ReturnValue;
 };
@@ -13813,20 +11906,16 @@ bool USFXOnlineComponentPlatformOrbis::ShowFeedbackUI ( unsigned char eLocalUser
 
 bool USFXOnlineComponentPlatformOrbis::ShowGamerCardUI ( unsigned char eLocalUserNum, struct FUniqueNetId const& oPlayerId )
 {
-	static UFunction* pFnShowGamerCardUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowGamerCardUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowGamerCardUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowGamerCardUI )
-		pFnShowGamerCardUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowGamerCardUI" );
+	UFunction* const pFnShowGamerCardUI = pFnShowGamerCardUIRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execShowGamerCardUI_Parms ShowGamerCardUI_Parms;
 	ShowGamerCardUI_Parms.eLocalUserNum = eLocalUserNum;
 	memcpy ( &ShowGamerCardUI_Parms.oPlayerId, &oPlayerId, 0x8 );
 
-	pFnShowGamerCardUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowGamerCardUI, &ShowGamerCardUI_Parms, NULL );
-
-	pFnShowGamerCardUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowGamerCardUI, &ShowGamerCardUI_Parms ) )
+		this->ProcessEvent ( pFnShowGamerCardUI, &ShowGamerCardUI_Parms, NULL );
 
 	return ShowGamerCardUI_Parms.ReturnValue;
 };
@@ -13839,19 +11928,15 @@ bool USFXOnlineComponentPlatformOrbis::ShowGamerCardUI ( unsigned char eLocalUse
 
 unsigned char USFXOnlineComponentPlatformOrbis::CanShowPresenceInformation ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanShowPresenceInformation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanShowPresenceInformationRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanShowPresenceInformation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanShowPresenceInformation )
-		pFnCanShowPresenceInformation = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanShowPresenceInformation" );
+	UFunction* const pFnCanShowPresenceInformation = pFnCanShowPresenceInformationRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execCanShowPresenceInformation_Parms CanShowPresenceInformation_Parms;
 	CanShowPresenceInformation_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanShowPresenceInformation->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
-
-	pFnCanShowPresenceInformation->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms ) )
+		this->ProcessEvent ( pFnCanShowPresenceInformation, &CanShowPresenceInformation_Parms, NULL );
 
 	return CanShowPresenceInformation_Parms.ReturnValue;
 };
@@ -13864,19 +11949,15 @@ unsigned char USFXOnlineComponentPlatformOrbis::CanShowPresenceInformation ( uns
 
 unsigned char USFXOnlineComponentPlatformOrbis::CanViewPlayerProfiles ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanViewPlayerProfiles = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanViewPlayerProfilesRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanViewPlayerProfiles", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanViewPlayerProfiles )
-		pFnCanViewPlayerProfiles = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanViewPlayerProfiles" );
+	UFunction* const pFnCanViewPlayerProfiles = pFnCanViewPlayerProfilesRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execCanViewPlayerProfiles_Parms CanViewPlayerProfiles_Parms;
 	CanViewPlayerProfiles_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanViewPlayerProfiles->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
-
-	pFnCanViewPlayerProfiles->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms ) )
+		this->ProcessEvent ( pFnCanViewPlayerProfiles, &CanViewPlayerProfiles_Parms, NULL );
 
 	return CanViewPlayerProfiles_Parms.ReturnValue;
 };
@@ -13889,19 +11970,15 @@ unsigned char USFXOnlineComponentPlatformOrbis::CanViewPlayerProfiles ( unsigned
 
 unsigned char USFXOnlineComponentPlatformOrbis::CanPurchaseContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPurchaseContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPurchaseContentRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanPurchaseContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPurchaseContent )
-		pFnCanPurchaseContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanPurchaseContent" );
+	UFunction* const pFnCanPurchaseContent = pFnCanPurchaseContentRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execCanPurchaseContent_Parms CanPurchaseContent_Parms;
 	CanPurchaseContent_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanPurchaseContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
-
-	pFnCanPurchaseContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPurchaseContent, &CanPurchaseContent_Parms ) )
+		this->ProcessEvent ( pFnCanPurchaseContent, &CanPurchaseContent_Parms, NULL );
 
 	return CanPurchaseContent_Parms.ReturnValue;
 };
@@ -13914,19 +11991,15 @@ unsigned char USFXOnlineComponentPlatformOrbis::CanPurchaseContent ( unsigned ch
 
 unsigned char USFXOnlineComponentPlatformOrbis::CanDownloadUserContent ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanDownloadUserContent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanDownloadUserContentRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanDownloadUserContent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanDownloadUserContent )
-		pFnCanDownloadUserContent = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanDownloadUserContent" );
+	UFunction* const pFnCanDownloadUserContent = pFnCanDownloadUserContentRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execCanDownloadUserContent_Parms CanDownloadUserContent_Parms;
 	CanDownloadUserContent_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanDownloadUserContent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
-
-	pFnCanDownloadUserContent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanDownloadUserContent, &CanDownloadUserContent_Parms ) )
+		this->ProcessEvent ( pFnCanDownloadUserContent, &CanDownloadUserContent_Parms, NULL );
 
 	return CanDownloadUserContent_Parms.ReturnValue;
 };
@@ -13939,19 +12012,15 @@ unsigned char USFXOnlineComponentPlatformOrbis::CanDownloadUserContent ( unsigne
 
 unsigned char USFXOnlineComponentPlatformOrbis::CanCommunicate ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanCommunicate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanCommunicateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanCommunicate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanCommunicate )
-		pFnCanCommunicate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanCommunicate" );
+	UFunction* const pFnCanCommunicate = pFnCanCommunicateRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execCanCommunicate_Parms CanCommunicate_Parms;
 	CanCommunicate_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanCommunicate->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
-
-	pFnCanCommunicate->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanCommunicate, &CanCommunicate_Parms ) )
+		this->ProcessEvent ( pFnCanCommunicate, &CanCommunicate_Parms, NULL );
 
 	return CanCommunicate_Parms.ReturnValue;
 };
@@ -13964,19 +12033,15 @@ unsigned char USFXOnlineComponentPlatformOrbis::CanCommunicate ( unsigned char e
 
 unsigned char USFXOnlineComponentPlatformOrbis::CanPlayOnline ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnCanPlayOnline = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPlayOnlineRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanPlayOnline", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPlayOnline )
-		pFnCanPlayOnline = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanPlayOnline" );
+	UFunction* const pFnCanPlayOnline = pFnCanPlayOnlineRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execCanPlayOnline_Parms CanPlayOnline_Parms;
 	CanPlayOnline_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnCanPlayOnline->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
-
-	pFnCanPlayOnline->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCanPlayOnline, &CanPlayOnline_Parms ) )
+		this->ProcessEvent ( pFnCanPlayOnline, &CanPlayOnline_Parms, NULL );
 
 	return CanPlayOnline_Parms.ReturnValue;
 };
@@ -13991,10 +12056,9 @@ unsigned char USFXOnlineComponentPlatformOrbis::CanPlayOnline ( unsigned char eL
 
 void USFXOnlineComponentPlatformOrbis::SetRichPresence ( unsigned char eLocalUserNum, int nPresenceMode, TArray<struct FLocalizedStringSetting>* aLocalizedStringSettings, TArray<struct FSettingsProperty>* aProperties )
 {
-	static UFunction* pFnSetRichPresence = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetRichPresenceRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.SetRichPresence", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetRichPresence )
-		pFnSetRichPresence = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.SetRichPresence" );
+	UFunction* const pFnSetRichPresence = pFnSetRichPresenceRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execSetRichPresence_Parms SetRichPresence_Parms;
 	SetRichPresence_Parms.eLocalUserNum = eLocalUserNum;
@@ -14006,11 +12070,8 @@ void USFXOnlineComponentPlatformOrbis::SetRichPresence ( unsigned char eLocalUse
 	if ( aProperties )
 		memcpy ( &SetRichPresence_Parms.aProperties, aProperties, 0x10 );
 
-	pFnSetRichPresence->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetRichPresence, &SetRichPresence_Parms, NULL );
-
-	pFnSetRichPresence->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetRichPresence, &SetRichPresence_Parms ) )
+		this->ProcessEvent ( pFnSetRichPresence, &SetRichPresence_Parms, NULL );
 
 	if ( aLocalizedStringSettings )
 		memcpy ( aLocalizedStringSettings, &SetRichPresence_Parms.aLocalizedStringSettings, 0x10 );
@@ -14027,19 +12088,15 @@ void USFXOnlineComponentPlatformOrbis::SetRichPresence ( unsigned char eLocalUse
 
 bool USFXOnlineComponentPlatformOrbis::ShowLoginUI ( unsigned long bShowOnlineOnly )
 {
-	static UFunction* pFnShowLoginUI = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShowLoginUIRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowLoginUI", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShowLoginUI )
-		pFnShowLoginUI = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowLoginUI" );
+	UFunction* const pFnShowLoginUI = pFnShowLoginUIRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execShowLoginUI_Parms ShowLoginUI_Parms;
 	ShowLoginUI_Parms.bShowOnlineOnly = bShowOnlineOnly;
 
-	pFnShowLoginUI->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShowLoginUI, &ShowLoginUI_Parms, NULL );
-
-	pFnShowLoginUI->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShowLoginUI, &ShowLoginUI_Parms ) )
+		this->ProcessEvent ( pFnShowLoginUI, &ShowLoginUI_Parms, NULL );
 
 	return ShowLoginUI_Parms.ReturnValue;
 };
@@ -14052,19 +12109,15 @@ bool USFXOnlineComponentPlatformOrbis::ShowLoginUI ( unsigned long bShowOnlineOn
 
 unsigned char USFXOnlineComponentPlatformOrbis::GetLoginStatus ( unsigned char eLocalUserNum )
 {
-	static UFunction* pFnGetLoginStatus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLoginStatusRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetLoginStatus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLoginStatus )
-		pFnGetLoginStatus = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetLoginStatus" );
+	UFunction* const pFnGetLoginStatus = pFnGetLoginStatusRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execGetLoginStatus_Parms GetLoginStatus_Parms;
 	GetLoginStatus_Parms.eLocalUserNum = eLocalUserNum;
 
-	pFnGetLoginStatus->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetLoginStatus, &GetLoginStatus_Parms, NULL );
-
-	pFnGetLoginStatus->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetLoginStatus, &GetLoginStatus_Parms ) )
+		this->ProcessEvent ( pFnGetLoginStatus, &GetLoginStatus_Parms, NULL );
 
 	return GetLoginStatus_Parms.ReturnValue;
 };
@@ -14078,20 +12131,16 @@ unsigned char USFXOnlineComponentPlatformOrbis::GetLoginStatus ( unsigned char e
 
 bool USFXOnlineComponentPlatformOrbis::AddRecentPlayer ( struct FUniqueNetId const& oPlayerId, FString const& sDescription )
 {
-	static UFunction* pFnAddRecentPlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddRecentPlayerRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.AddRecentPlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddRecentPlayer )
-		pFnAddRecentPlayer = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.AddRecentPlayer" );
+	UFunction* const pFnAddRecentPlayer = pFnAddRecentPlayerRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execAddRecentPlayer_Parms AddRecentPlayer_Parms;
 	memcpy ( &AddRecentPlayer_Parms.oPlayerId, &oPlayerId, 0x8 );
 	memcpy ( &AddRecentPlayer_Parms.sDescription, &sDescription, 0x10 );
 
-	pFnAddRecentPlayer->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddRecentPlayer, &AddRecentPlayer_Parms, NULL );
-
-	pFnAddRecentPlayer->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAddRecentPlayer, &AddRecentPlayer_Parms ) )
+		this->ProcessEvent ( pFnAddRecentPlayer, &AddRecentPlayer_Parms, NULL );
 
 	return AddRecentPlayer_Parms.ReturnValue;
 };
@@ -14103,18 +12152,14 @@ bool USFXOnlineComponentPlatformOrbis::AddRecentPlayer ( struct FUniqueNetId con
 
 struct SFXName USFXOnlineComponentPlatformOrbis::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -14125,18 +12170,14 @@ struct SFXName USFXOnlineComponentPlatformOrbis::GetAPIName ( )
 
 void USFXOnlineComponentPlatformOrbis::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.OnInitialize
@@ -14146,31 +12187,24 @@ void USFXOnlineComponentPlatformOrbis::OnRelease ( )
 
 void USFXOnlineComponentPlatformOrbis::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentPlatformOrbis_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 
 
-class UClass* USFXOnlineComponentTelemetrySystem::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXOnlineComponentTelemetrySystem::pClassPointer { L"Class SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem", &UObject::FindClass };
 
 class UClass* USFXOnlineComponentTelemetrySystem::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnTick
@@ -14180,19 +12214,15 @@ class UClass* USFXOnlineComponentTelemetrySystem::StaticClass()
 
 void USFXOnlineComponentTelemetrySystem::OnTick ( class USFXOnlineEvent* oEvent )
 {
-	static UFunction* pFnOnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnTickRef { L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnTick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnTick )
-		pFnOnTick = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnTick" );
+	UFunction* const pFnOnTick = pFnOnTickRef.Get ( );
 
 	USFXOnlineComponentTelemetrySystem_execOnTick_Parms OnTick_Parms;
 	OnTick_Parms.oEvent = oEvent;
 
-	pFnOnTick->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
-
-	pFnOnTick->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnTick, &OnTick_Parms ) )
+		this->ProcessEvent ( pFnOnTick, &OnTick_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.Flush
@@ -14202,19 +12232,15 @@ void USFXOnlineComponentTelemetrySystem::OnTick ( class USFXOnlineEvent* oEvent
 
 void USFXOnlineComponentTelemetrySystem::Flush ( unsigned char Channel )
 {
-	static UFunction* pFnFlush = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFlushRef { L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.Flush", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFlush )
-		pFnFlush = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.Flush" );
+	UFunction* const pFnFlush = pFnFlushRef.Get ( );
 
 	USFXOnlineComponentTelemetrySystem_execFlush_Parms Flush_Parms;
 	Flush_Parms.Channel = Channel;
 
-	pFnFlush->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFlush, &Flush_Parms, NULL );
-
-	pFnFlush->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFlush, &Flush_Parms ) )
+		this->ProcessEvent ( pFnFlush, &Flush_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.GetAPIName
@@ -14224,18 +12250,14 @@ void USFXOnlineComponentTelemetrySystem::Flush ( unsigned char Channel )
 
 struct SFXName USFXOnlineComponentTelemetrySystem::GetAPIName ( )
 {
-	static UFunction* pFnGetAPIName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAPINameRef { L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.GetAPIName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAPIName )
-		pFnGetAPIName = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.GetAPIName" );
+	UFunction* const pFnGetAPIName = pFnGetAPINameRef.Get ( );
 
 	USFXOnlineComponentTelemetrySystem_execGetAPIName_Parms GetAPIName_Parms;
 
-	pFnGetAPIName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
-
-	pFnGetAPIName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAPIName, &GetAPIName_Parms ) )
+		this->ProcessEvent ( pFnGetAPIName, &GetAPIName_Parms, NULL );
 
 	return GetAPIName_Parms.ReturnValue;
 };
@@ -14246,18 +12268,14 @@ struct SFXName USFXOnlineComponentTelemetrySystem::GetAPIName ( )
 
 void USFXOnlineComponentTelemetrySystem::OnRelease ( )
 {
-	static UFunction* pFnOnRelease = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReleaseRef { L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnRelease", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRelease )
-		pFnOnRelease = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnRelease" );
+	UFunction* const pFnOnRelease = pFnOnReleaseRef.Get ( );
 
 	USFXOnlineComponentTelemetrySystem_execOnRelease_Parms OnRelease_Parms;
 
-	pFnOnRelease->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
-
-	pFnOnRelease->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnRelease, &OnRelease_Parms ) )
+		this->ProcessEvent ( pFnOnRelease, &OnRelease_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnInitialize
@@ -14267,19 +12285,15 @@ void USFXOnlineComponentTelemetrySystem::OnRelease ( )
 
 void USFXOnlineComponentTelemetrySystem::OnInitialize ( class USFXOnlineSubsystem* oOnlineSubsystem )
 {
-	static UFunction* pFnOnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnInitializeRef { L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnInitialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnInitialize )
-		pFnOnInitialize = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnInitialize" );
+	UFunction* const pFnOnInitialize = pFnOnInitializeRef.Get ( );
 
 	USFXOnlineComponentTelemetrySystem_execOnInitialize_Parms OnInitialize_Parms;
 	OnInitialize_Parms.oOnlineSubsystem = oOnlineSubsystem;
 
-	pFnOnInitialize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
-
-	pFnOnInitialize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOnInitialize, &OnInitialize_Parms ) )
+		this->ProcessEvent ( pFnOnInitialize, &OnInitialize_Parms, NULL );
 };
 
 // Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.RegisterConnectionDelegates
@@ -14291,10 +12305,9 @@ void USFXOnlineComponentTelemetrySystem::OnInitialize ( class USFXOnlineSubsyste
 
 void USFXOnlineComponentTelemetrySystem::RegisterConnectionDelegates ( struct FScriptDelegate CollectDelegate, struct FScriptDelegate AuthenticateDelegate, struct FScriptDelegate DisconnectDelegate )
 {
-	static UFunction* pFnRegisterConnectionDelegates = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRegisterConnectionDelegatesRef { L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.RegisterConnectionDelegates", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRegisterConnectionDelegates )
-		pFnRegisterConnectionDelegates = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.RegisterConnectionDelegates" );
+	UFunction* const pFnRegisterConnectionDelegates = pFnRegisterConnectionDelegatesRef.Get ( );
 
 	USFXOnlineComponentTelemetrySystem_execRegisterConnectionDelegates_Parms RegisterConnectionDelegates_Parms;
 	memcpy ( &RegisterConnectionDelegates_Parms.CollectDelegate, &CollectDelegate, 0x10 );
@@ -14312,10 +12325,9 @@ void USFXOnlineComponentTelemetrySystem::RegisterConnectionDelegates ( struct FS
 
 void USFXOnlineComponentTelemetrySystem::OnDisconnect ( int Error, FString const& SessionId )
 {
-	static UFunction* pFnOnDisconnect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnDisconnectRef { L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnDisconnect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnDisconnect )
-		pFnOnDisconnect = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnDisconnect" );
+	UFunction* const pFnOnDisconnect = pFnOnDisconnectRef.Get ( );
 
 	USFXOnlineComponentTelemetrySystem_execOnDisconnect_Parms OnDisconnect_Parms;
 	OnDisconnect_Parms.Error = Error;
@@ -14330,10 +12342,9 @@ void USFXOnlineComponentTelemetrySystem::OnDisconnect ( int Error, FString const
 
 void USFXOnlineComponentTelemetrySystem::OnAuthenticate ( )
 {
-	static UFunction* pFnOnAuthenticate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAuthenticateRef { L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnAuthenticate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnAuthenticate )
-		pFnOnAuthenticate = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnAuthenticate" );
+	UFunction* const pFnOnAuthenticate = pFnOnAuthenticateRef.Get ( );
 
 	USFXOnlineComponentTelemetrySystem_execOnAuthenticate_Parms OnAuthenticate_Parms;
 
@@ -14347,10 +12358,9 @@ void USFXOnlineComponentTelemetrySystem::OnAuthenticate ( )
 
 bool USFXOnlineComponentTelemetrySystem::CanCollect ( )
 {
-	static UFunction* pFnCanCollect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanCollectRef { L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.CanCollect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanCollect )
-		pFnCanCollect = UObject::FindObject< UFunction > ( L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.CanCollect" );
+	UFunction* const pFnCanCollect = pFnCanCollectRef.Get ( );
 
 	USFXOnlineComponentTelemetrySystem_execCanCollect_Parms CanCollect_Parms;
 
@@ -14361,6 +12371,642 @@ bool USFXOnlineComponentTelemetrySystem::CanCollect ( )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXOnlineFoundation.SFXOnlineEvent",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.Update",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.IsComplete",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.IsPending",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.CompleteAndSucceeded",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.HasTimedOut",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.IsTimeoutEnabled",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.DisableTimeout",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.EnableTimeout",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.SetTimeout",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.GetTimeout",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.SetErrorString",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.GetErrorString",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.SetErrorCode",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.GetErrorCode",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.SetStatus",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.GetStatus",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.SetOutcome",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.GetOutcome",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.SetEventId",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.GetEventId",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.SetEventType",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent.GetEventType",
+	L"Class SFXOnlineFoundation.SFXOnlineEvent_Integer",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent_Integer.SetInteger",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent_Integer.GetInteger",
+	L"Class SFXOnlineFoundation.SFXOnlineEvent_PlatformKeyboardUI",
+	L"Class SFXOnlineFoundation.SFXOnlineEvent_String",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent_String.SetStringData",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent_String.GetStringData",
+	L"Class SFXOnlineFoundation.SFXOnlineEvent_Notification",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent_Notification.SetPriority",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent_Notification.GetPriority",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent_Notification.SetImageName",
+	L"Function SFXOnlineFoundation.SFXOnlineEvent_Notification.GetImageName",
+	L"Class SFXOnlineFoundation.SFXOnlineEventList",
+	L"Function SFXOnlineFoundation.SFXOnlineEventList.GetNextTimedOutEvent",
+	L"Function SFXOnlineFoundation.SFXOnlineEventList.RemoveEvent",
+	L"Function SFXOnlineFoundation.SFXOnlineEventList.FindEventByType",
+	L"Function SFXOnlineFoundation.SFXOnlineEventList.FindEvent",
+	L"Function SFXOnlineFoundation.SFXOnlineEventList.GetEventAtIndex",
+	L"Function SFXOnlineFoundation.SFXOnlineEventList.GetEvent",
+	L"Function SFXOnlineFoundation.SFXOnlineEventList.AddEvent",
+	L"Class SFXOnlineFoundation.ISFXOnlineComponent",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponent.GetAPIName",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponent.OnRelease",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponent.OnInitialize",
+	L"Class SFXOnlineFoundation.ISFXOnlineComponentAPI",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentAPI.Idle",
+	L"Class SFXOnlineFoundation.ISFXOnlineComponentAchievement",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentAchievement.GetTitleAchievementID",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentAchievement.GetPlatformAchievementID",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentAchievement.IsGranted",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentAchievement.Grant",
+	L"Class SFXOnlineFoundation.ISFXOnlineComponentLogin",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetConnectMode",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetUIState",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanShowPresenceInformation",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanViewPlayerProfiles",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanPurchaseContent",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanDownloadUserContent",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanCommunicate",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CanPlayOnline",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.EnterCDKey",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OnDownloadOffersUICompleted",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OnDLCInfoLoaded",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.OpenCerberusUI",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CheckEntitlement",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsCerberusMember",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.DisablePersona",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.CreatePersona",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SelectPersona",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.AcceptTOS",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.Disconnect",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitStore",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCreateNucleusAccountEx",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitEmailPasswordMismatch",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitMessageBox",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitRedeemCode",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCerberusWelcomeMessage",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCerberusIntro",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitNucleusWelcomeMessage",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitCreateNucleusAccount",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitParentEmail",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitNucleusLogin",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SubmitIntroPage",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.Connect",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GoBackInUI",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.Cancel",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetUserId",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetPersonaName",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.HasInternetConnection",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsConnectedTo3rdPartyOnlineService",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.HasAccountFor3rdPartyOnlineService",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsSignedIn",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.IsConnected",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.SwitchActiveUserIndex",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetActiveUserIndex",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentLogin.GetLoginStatus",
+	L"Class SFXOnlineFoundation.ISFXOnlineComponentNotification",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetTargetOfferInfo",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.HasUserPurchasedAnOffer",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.DownloadOffers",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetOfferKeyIfEntitled",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetGrantingOffers",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetEntitledDLCInfo",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.RefreshEntitlementFlags",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetEntitlementGroups",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.GetDaysSinceCerberusRegistration",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.IsCalendarUnlockEarned",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.RequestServerInfo",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentNotification.RequestData",
+	L"Class SFXOnlineFoundation.ISFXOnlineComponentPlatform",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.GetRebootUserData",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.WasRebootedFromOSCodeRedemptionUI",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowCodeRedemptionUI",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowStoreUI",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.GetOnlineXuid",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.GetOfflineXuid",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.AddRecentPlayer",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowKeyboardUI",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowAchievementsUI",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowFeedbackUI",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowGamerCardUI",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowFriendsInviteUI",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowFriendsUI",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanShowPresenceInformation",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanViewPlayerProfiles",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanPurchaseContent",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanDownloadUserContent",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanCommunicate",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.CanPlayOnline",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.SetRichPresence",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.ShowLoginUI",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentPlatform.GetLoginStatus",
+	L"Class SFXOnlineFoundation.ISFXOnlineComponentTelemetry",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.Flush",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.RegisterConnectionDelegates",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.OnDisconnect",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.OnAuthenticate",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentTelemetry.CanCollect",
+	L"Class SFXOnlineFoundation.ISFXOnlineComponentUserInterface",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowStore",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.HasCerberusDLC",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.OnDisplayNotification",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ClearNotifications",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.CloseEANetworking",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.SetState",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowEmailPasswordMismatch",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowMessageBoxWait",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowMessageBox",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCreateNucleusAccountEx",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCerberusWelcomeMessage",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowRedeemCode",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCerberusIntro",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowNucleusWelcomeMessage",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowCreateNucleusAccount",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowParentEmail",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowAccountDemographics",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowTermsOfService",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowNucleusLogin",
+	L"Function SFXOnlineFoundation.ISFXOnlineComponentUserInterface.ShowIntroPage",
+	L"Class SFXOnlineFoundation.SFXOnlineDefine",
+	L"Class SFXOnlineFoundation.SFXOnlineComponent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.IsXbox360",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.IsPS3",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.IsConsole",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.IsEventPending",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.GetEvent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkSetObject",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkSetType",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkObject",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.WaitingForWorkType",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkFinishedObject",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkFinishedType",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkStartedObject",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyWorkStartedType",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyEventObject",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.NotifyEventType",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.StopWaitingForAllWork",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.UnsubscribeFromAllEvents",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.UnsubscribeFromEvent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.SubscribeToEvent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.OnEvent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.OnInitialize",
+	L"Function SFXOnlineFoundation.SFXOnlineComponent.SubscribeToEvents",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentOrigin",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnTick",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.RefreshServerAchievements_ASync",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.SetRichPresence",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.RequestProfile",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.StartService",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.EnsureSignedIn",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentOrigin.OnInitialize",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearUnlockAchievementCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddUnlockAchievementCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnUnlockAchievementComplete",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.UnlockAchievement",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetAchievements",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadAchievementsCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadAchievementsCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadAchievementsComplete",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadAchievements",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.DeleteMessage",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearFriendMessageReceivedDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendMessageReceivedDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnFriendMessageReceived",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetFriendMessages",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearJoinFriendGameCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddJoinFriendGameCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnJoinFriendGameComplete",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.JoinFriendGame",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReceivedGameInviteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReceivedGameInviteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReceivedGameInvite",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SendGameInviteToFriends",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SendGameInviteToFriend",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SendMessageToFriend",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearFriendInviteReceivedDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendInviteReceivedDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnFriendInviteReceived",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.RemoveFriend",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.DenyFriendInvite",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AcceptFriendInvite",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearAddFriendByNameCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddAddFriendByNameCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnAddFriendByNameComplete",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendByName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriend",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetKeyboardInputResults",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearKeyboardInputDoneDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddKeyboardInputDoneDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnKeyboardInputComplete",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ShowKeyboardUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.SetOnlineStatus",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetFriendsList",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadFriendsCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadFriendsCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadFriendsComplete",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadFriendsList",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearWritePlayerStorageCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddWritePlayerStorageCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnWritePlayerStorageComplete",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.WritePlayerStorage",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetPlayerStorage",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadPlayerStorageForNetIdCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadPlayerStorageForNetIdCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadPlayerStorageForNetIdComplete",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadPlayerStorageForNetId",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadPlayerStorageCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadPlayerStorageCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadPlayerStorageComplete",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadPlayerStorage",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearWriteProfileSettingsCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddWriteProfileSettingsCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnWriteProfileSettingsComplete",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.WriteProfileSettings",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetProfileSettings",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearReadProfileSettingsCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddReadProfileSettingsCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnReadProfileSettingsComplete",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ReadProfileSettings",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearFriendsChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddFriendsChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearMutingChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddMutingChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginCancelledDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginCancelledDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginStatusChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginStatusChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginStatusChange",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ShowFriendsUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsMuted",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AreAnyFriends",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsFriend",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanShowPresenceInformation",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanViewPlayerProfiles",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanPurchaseContent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanDownloadUserContent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanCommunicate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CanPlayOnline",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsLocalLogin",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.IsGuestLogin",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetPlayerNickname",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetUniquePlayerId",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetLoginStatus",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLogoutCompletedDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLogoutCompletedDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLogoutCompleted",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.Logout",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ClearLoginFailedDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AddLoginFailedDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginFailed",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.AutoLogin",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.Login",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.ShowLoginUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnFriendsChange",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnMutingChange",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginCancelled",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnLoginChange",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnProfileDataChanged",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.CreateProfileName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.DoesProfileExist",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnTick",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayer.OnInitialize",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowCustomPlayersUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowPlayersUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowFriendsInviteUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ClearProfileDataChangedDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.AddProfileDataChangedDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnProfileDataChanged",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.UnlockGamerPicture",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.IsDeviceValid",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.GetDeviceSelectionResults",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ClearDeviceSelectionDoneDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.AddDeviceSelectionDoneDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnDeviceSelectionComplete",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowDeviceSelectionUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowMembershipMarketplaceUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowContentMarketplaceUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowInviteUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowAchievementsUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowMessagesUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowGamerCardUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.ShowFeedbackUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnTick",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealPlayerEx.OnInitialize",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentUnrealSystem",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetTitleFileState",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetTitleFileContents",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearReadTitleFileCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddReadTitleFileCompleteDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ReadTitleFile",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnReadTitleFileComplete",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearStorageDeviceChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddStorageDeviceChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnStorageDeviceChange",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetNATType",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearConnectionStatusChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddConnectionStatusChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnConnectionStatusChange",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.IsControllerConnected",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearControllerChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddControllerChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnControllerChange",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.SetNetworkNotificationPosition",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetNetworkNotificationPosition",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ProcessExternalUINotification",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearExternalUIChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddExternalUIChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnExternalUIChange",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.ClearLinkStatusChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.AddLinkStatusChangeDelegate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnLinkStatusChange",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.HasLinkConnection",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentUnrealSystem.OnInitialize",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentCoordinator",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnInitialize",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.StopWaitingForAllWork",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkSetObject",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkSetType",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkObject",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.WaitingForWorkType",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.IsEventPending",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.GetEvent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.UnsubscribeFromAllEvents",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.UnsubscribeFromEvent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.SubscribeToEvent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkFinishedObject",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkFinishedType",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkStartedObject",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyWorkStartedType",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyEventObject",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.NotifyEventType",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnTick",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentCoordinator.OnEvent",
+	L"Class SFXOnlineFoundation.SFXOnlineSubsystem",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.Exit",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.ShowConsoleRoutedKeyboardUI",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.ShowKeyboardUI",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.FormatTime",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.CheckEntitlement",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.IsCerberusMember",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetUniqueIdFromConnection",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.MD5HashString",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetProjectID",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetCDKey",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetLanguage",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetPlatform",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.ShutDown",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.NativeInit",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetGameListenPort",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetReserveTimeout",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetMaxObserverCount",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetMaxPlayerCount",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.SetMaxPlayerCount",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetGameProtocolVersion",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentOrigin",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUnrealPlayerEx",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUnrealPlayer",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUnrealSystem",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetCoordinator",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentTelemetry",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentNotification",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentUserInterface",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentLogin",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentAPI",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentAchievement",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetComponentPlatform",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetOnlineSubsystem",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.StripBadPWCharacters",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetURL",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.SetUnrealInterfaces",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.CreateComponents",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.InitGameProtocolVersion",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.Init",
+	L"Function SFXOnlineFoundation.SFXOnlineSubsystem.GetAchievementList",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentAchievementPC",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.GetTitleAchievementID",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.GetPlatformAchievementID",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.OnInitialize",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.IsGranted",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPC.Grant",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentPlatformPC",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetRebootUserData",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.WasRebootedFromOSCodeRedemptionUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowCodeRedemptionUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowStoreUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetOnlineXuid",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetOfflineXuid",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowKeyboardUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowFriendsInviteUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowFriendsUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowAchievementsUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowFeedbackUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowGamerCardUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanShowPresenceInformation",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanViewPlayerProfiles",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanPurchaseContent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanDownloadUserContent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanCommunicate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.CanPlayOnline",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.SetRichPresence",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.ShowLoginUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetLoginStatus",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.AddRecentPlayer",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPC.OnInitialize",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentAchievementXenon",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.GetTitleAchievementID",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.GetPlatformAchievementID",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.OnInitialize",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.IsGranted",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementXenon.Grant",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentPlatformXenon",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetRebootUserData",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.WasRebootedFromOSCodeRedemptionUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowCodeRedemptionUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowStoreUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetOnlineXuid",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetOfflineXuid",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowKeyboardUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowFriendsInviteUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowFriendsUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowAchievementsUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowFeedbackUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowGamerCardUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanShowPresenceInformation",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanViewPlayerProfiles",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanPurchaseContent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanDownloadUserContent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanCommunicate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.CanPlayOnline",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.SetRichPresence",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.ShowLoginUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetLoginStatus",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.TickAsyncTasks",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.OnTick",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.AddRecentPlayer",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformXenon.OnInitialize",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentAchievementPS3",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.GetTitleAchievementID",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.GetPlatformAchievementID",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.OnInitialize",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.IsGranted",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementPS3.Grant",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentPlatformPS3",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowLoginUIEx",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnSignInComplete",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetRebootUserData",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.WasRebootedFromOSCodeRedemptionUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowCodeRedemptionUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowStoreUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetOnlineXuid",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetOfflineXuid",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowKeyboardUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowFriendsInviteUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowFriendsUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowAchievementsUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowFeedbackUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowGamerCardUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanShowPresenceInformation",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanViewPlayerProfiles",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanPurchaseContent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanDownloadUserContent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanCommunicate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.CanPlayOnline",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.SetRichPresence",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.ShowLoginUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetLoginStatus",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.AddRecentPlayer",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnKeyboardUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnTick",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformPS3.OnInitialize",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentAchievementDingo",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.GetTitleAchievementID",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.GetPlatformAchievementID",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.OnInitialize",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.IsGranted",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementDingo.Grant",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentPlatformDingo",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.OnTick",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.OnKeyboardUIClosed",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetRebootUserData",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.WasRebootedFromOSCodeRedemptionUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowCodeRedemptionUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowStoreUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetOnlineXuid",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetOfflineXuid",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowKeyboardUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowFriendsInviteUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowFriendsUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowAchievementsUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowFeedbackUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowGamerCardUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanShowPresenceInformation",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanViewPlayerProfiles",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanPurchaseContent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanDownloadUserContent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanCommunicate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.CanPlayOnline",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.SetRichPresence",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.ShowLoginUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetLoginStatus",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.AddRecentPlayer",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformDingo.OnInitialize",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.GetTitleAchievementID",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.GetPlatformAchievementID",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.OnInitialize",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.IsGranted",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentAchievementOrbis.Grant",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.OnKeyboardUIClosed",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetRebootUserData",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.WasRebootedFromOSCodeRedemptionUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowCodeRedemptionUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowStoreUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetOnlineXuid",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetOfflineXuid",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowKeyboardUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowFriendsInviteUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowFriendsUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowAchievementsUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowFeedbackUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowGamerCardUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanShowPresenceInformation",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanViewPlayerProfiles",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanPurchaseContent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanDownloadUserContent",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanCommunicate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.CanPlayOnline",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.SetRichPresence",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.ShowLoginUI",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetLoginStatus",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.AddRecentPlayer",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentPlatformOrbis.OnInitialize",
+	L"Class SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnTick",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.Flush",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.GetAPIName",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnRelease",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnInitialize",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.RegisterConnectionDelegates",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnDisconnect",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.OnAuthenticate",
+	L"Function SFXOnlineFoundation.SFXOnlineComponentTelemetrySystem.CanCollect",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
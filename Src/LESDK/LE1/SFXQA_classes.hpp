@@ -48,7 +48,7 @@ public:
 	int                                                bSplinePilot;                                     		// 0x00F8 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioSeqAct_IsSplinePilot::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_IsSplinePilot::pClassPointer { L"Class SFXQA.BioSeqAct_IsSplinePilot", &UObject::FindClass };
 
 class UClass* UBioSeqAct_IsSplinePilot::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXQA.BioSeqAct_IsSplinePilot" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXQA.BioSeqAct_IsSplinePilot.Activated
@@ -44,10 +41,9 @@ class UClass* UBioSeqAct_IsSplinePilot::StaticClass()
 
 void UBioSeqAct_IsSplinePilot::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXQA.BioSeqAct_IsSplinePilot.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXQA.BioSeqAct_IsSplinePilot.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	UBioSeqAct_IsSplinePilot_execActivated_Parms Activated_Parms;
 
@@ -56,6 +52,22 @@ void UBioSeqAct_IsSplinePilot::Activated ( )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXQA.BioSeqAct_IsSplinePilot",
+	L"Function SFXQA.BioSeqAct_IsSplinePilot.Activated",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
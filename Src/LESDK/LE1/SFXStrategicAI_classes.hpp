@@ -95,7 +95,7 @@ class ABioAI_SarenHopper : public ABioAI_Hopper
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -125,7 +125,7 @@ public:
 	unsigned char                                      AgitationLevel;                                   		// 0x04FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -193,7 +193,7 @@ class UBioFaction_Commoner : public UBioFaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -207,7 +207,7 @@ class UBioFaction_Ambient : public UBioFaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -221,7 +221,7 @@ class UBioFaction_Defender1 : public UBioFaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -235,7 +235,7 @@ class UBioFaction_Defender2 : public UBioFaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -249,7 +249,7 @@ class UBioFaction_Hostile1 : public UBioFaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -263,7 +263,7 @@ class UBioFaction_Hostile2 : public UBioFaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -281,7 +281,7 @@ public:
 	unsigned char                                      CombatRestOrientation;                            		// 0x0510 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -309,7 +309,7 @@ class UBioFaction_CommonerPhysics : public UBioFaction_Commoner
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -323,7 +323,7 @@ class UBioForm_ScoutSwarm : public UBioFormations
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -337,7 +337,7 @@ class UBioSeqAct_GetPropertyDesignSquad : public UBioSeqAct_GetProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -351,7 +351,7 @@ class UBioSeqAct_ModifyPropertyDesignSquad : public UBioSeqAct_ModifyPropertyBas
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -371,7 +371,7 @@ public:
 	unsigned long                                      m_bShouldFlee : 1;                                		// 0x0518 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -388,7 +388,7 @@ class ABioSquadBeacon : public ABioBaseSquadDesignCombat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -422,7 +422,7 @@ public:
 	unsigned long                                      m_bSearchEnabled : 1;                             		// 0x0560 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -442,7 +442,7 @@ class ABioSquadCommoner : public ABioBaseSquadDesign
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -460,7 +460,7 @@ public:
 	unsigned long                                      m_bPerceivedEnemyRecently : 1;                    		// 0x0604 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -480,7 +480,7 @@ public:
 	float                                              m_fSquadTickTimer;                                		// 0x0608 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -519,7 +519,7 @@ class ABioSquadProxMine : public ABioBaseSquadDesignCombat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -536,7 +536,7 @@ class ABioSquadSitAndShoot : public ABioBaseSquadDesignCombat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28,14 +28,11 @@
 
 
 
-class UClass* ABioAI_SarenHopper::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ABioAI_SarenHopper::pClassPointer { L"Class SFXStrategicAI.BioAI_SarenHopper", &UObject::FindClass };
 
 class UClass* ABioAI_SarenHopper::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioAI_SarenHopper" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXStrategicAI.BioAI_SarenHopper.OnDamaged
@@ -46,10 +43,9 @@ class UClass* ABioAI_SarenHopper::StaticClass()
 
 void ABioAI_SarenHopper::eventOnDamaged ( class AController* oInstigator, float fDamage )
 {
-	static UFunction* pFnOnDamaged = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnDamagedRef { L"Function SFXStrategicAI.BioAI_SarenHopper.OnDamaged", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnDamaged )
-		pFnOnDamaged = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioAI_SarenHopper.OnDamaged" );
+	UFunction* const pFnOnDamaged = pFnOnDamagedRef.Get ( );
 
 	ABioAI_SarenHopper_eventOnDamaged_Parms OnDamaged_Parms;
 	OnDamaged_Parms.oInstigator = oInstigator;
@@ -60,14 +56,11 @@ void ABioAI_SarenHopper::eventOnDamaged ( class AController* oInstigator, float
 
 
 
-class UClass* ABioBaseSquadDesign::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ABioBaseSquadDesign::pClassPointer { L"Class SFXStrategicAI.BioBaseSquadDesign", &UObject::FindClass };
 
 class UClass* ABioBaseSquadDesign::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioBaseSquadDesign" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXStrategicAI.BioBaseSquadDesign.OnProximityAlarm
@@ -79,10 +72,9 @@ class UClass* ABioBaseSquadDesign::StaticClass()
 
 void ABioBaseSquadDesign::eventOnProximityAlarm ( class APawn* oMember, class AActor* oTarget, int nRelationship )
 {
-	static UFunction* pFnOnProximityAlarm = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnProximityAlarmRef { L"Function SFXStrategicAI.BioBaseSquadDesign.OnProximityAlarm", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnProximityAlarm )
-		pFnOnProximityAlarm = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.OnProximityAlarm" );
+	UFunction* const pFnOnProximityAlarm = pFnOnProximityAlarmRef.Get ( );
 
 	ABioBaseSquadDesign_eventOnProximityAlarm_Parms OnProximityAlarm_Parms;
 	OnProximityAlarm_Parms.oMember = oMember;
@@ -99,10 +91,9 @@ void ABioBaseSquadDesign::eventOnProximityAlarm ( class APawn* oMember, class AA
 
 void ABioBaseSquadDesign::eventOnSquadSeen ( class ABioBaseSquad* oSquad )
 {
-	static UFunction* pFnOnSquadSeen = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnSquadSeenRef { L"Function SFXStrategicAI.BioBaseSquadDesign.OnSquadSeen", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnSquadSeen )
-		pFnOnSquadSeen = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.OnSquadSeen" );
+	UFunction* const pFnOnSquadSeen = pFnOnSquadSeenRef.Get ( );
 
 	ABioBaseSquadDesign_eventOnSquadSeen_Parms OnSquadSeen_Parms;
 	OnSquadSeen_Parms.oSquad = oSquad;
@@ -119,10 +110,9 @@ void ABioBaseSquadDesign::eventOnSquadSeen ( class ABioBaseSquad* oSquad )
 
 void ABioBaseSquadDesign::eventOnDamaged ( class APawn* oMember, class AController* oInstigator, float fDamage )
 {
-	static UFunction* pFnOnDamaged = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnDamagedRef { L"Function SFXStrategicAI.BioBaseSquadDesign.OnDamaged", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnDamaged )
-		pFnOnDamaged = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.OnDamaged" );
+	UFunction* const pFnOnDamaged = pFnOnDamagedRef.Get ( );
 
 	ABioBaseSquadDesign_eventOnDamaged_Parms OnDamaged_Parms;
 	OnDamaged_Parms.oMember = oMember;
@@ -141,10 +131,9 @@ void ABioBaseSquadDesign::eventOnDamaged ( class APawn* oMember, class AControll
 
 void ABioBaseSquadDesign::eventOnCastAt ( class APawn* oMember, class APawn* oAttacker, struct SFXName nmPower )
 {
-	static UFunction* pFnOnCastAt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnCastAtRef { L"Function SFXStrategicAI.BioBaseSquadDesign.OnCastAt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnCastAt )
-		pFnOnCastAt = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.OnCastAt" );
+	UFunction* const pFnOnCastAt = pFnOnCastAtRef.Get ( );
 
 	ABioBaseSquadDesign_eventOnCastAt_Parms OnCastAt_Parms;
 	OnCastAt_Parms.oMember = oMember;
@@ -163,10 +152,9 @@ void ABioBaseSquadDesign::eventOnCastAt ( class APawn* oMember, class APawn* oAt
 
 void ABioBaseSquadDesign::eventOnAttacked ( class APawn* oMember, class APawn* oAttacker, struct SFXName nmWeapon )
 {
-	static UFunction* pFnOnAttacked = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAttackedRef { L"Function SFXStrategicAI.BioBaseSquadDesign.OnAttacked", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnAttacked )
-		pFnOnAttacked = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.OnAttacked" );
+	UFunction* const pFnOnAttacked = pFnOnAttackedRef.Get ( );
 
 	ABioBaseSquadDesign_eventOnAttacked_Parms OnAttacked_Parms;
 	OnAttacked_Parms.oMember = oMember;
@@ -184,10 +172,9 @@ void ABioBaseSquadDesign::eventOnAttacked ( class APawn* oMember, class APawn* o
 
 void ABioBaseSquadDesign::eventOnDeath ( class APawn* oMember, class AController* oKiller )
 {
-	static UFunction* pFnOnDeath = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnDeathRef { L"Function SFXStrategicAI.BioBaseSquadDesign.OnDeath", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnDeath )
-		pFnOnDeath = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.OnDeath" );
+	UFunction* const pFnOnDeath = pFnOnDeathRef.Get ( );
 
 	ABioBaseSquadDesign_eventOnDeath_Parms OnDeath_Parms;
 	OnDeath_Parms.oMember = oMember;
@@ -202,10 +189,9 @@ void ABioBaseSquadDesign::eventOnDeath ( class APawn* oMember, class AController
 
 void ABioBaseSquadDesign::SetHackedSquad ( )
 {
-	static UFunction* pFnSetHackedSquad = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetHackedSquadRef { L"Function SFXStrategicAI.BioBaseSquadDesign.SetHackedSquad", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetHackedSquad )
-		pFnSetHackedSquad = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.SetHackedSquad" );
+	UFunction* const pFnSetHackedSquad = pFnSetHackedSquadRef.Get ( );
 
 	ABioBaseSquadDesign_execSetHackedSquad_Parms SetHackedSquad_Parms;
 
@@ -218,10 +204,9 @@ void ABioBaseSquadDesign::SetHackedSquad ( )
 
 void ABioBaseSquadDesign::eventSetInitialState ( )
 {
-	static UFunction* pFnSetInitialState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetInitialStateRef { L"Function SFXStrategicAI.BioBaseSquadDesign.SetInitialState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetInitialState )
-		pFnSetInitialState = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.SetInitialState" );
+	UFunction* const pFnSetInitialState = pFnSetInitialStateRef.Get ( );
 
 	ABioBaseSquadDesign_eventSetInitialState_Parms SetInitialState_Parms;
 
@@ -239,10 +224,9 @@ void ABioBaseSquadDesign::eventSetInitialState ( )
 
 void ABioBaseSquadDesign::eventOnActionComplete_Movement ( class APawn* oMember, struct SFXName nmAction, int nReason, class AActor* oTarget, struct FVector const& vLocation )
 {
-	static UFunction* pFnOnActionComplete_Movement = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnActionComplete_MovementRef { L"Function SFXStrategicAI.BioBaseSquadDesign.OnActionComplete_Movement", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnActionComplete_Movement )
-		pFnOnActionComplete_Movement = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.OnActionComplete_Movement" );
+	UFunction* const pFnOnActionComplete_Movement = pFnOnActionComplete_MovementRef.Get ( );
 
 	ABioBaseSquadDesign_eventOnActionComplete_Movement_Parms OnActionComplete_Movement_Parms;
 	OnActionComplete_Movement_Parms.oMember = oMember;
@@ -261,10 +245,9 @@ void ABioBaseSquadDesign::eventOnActionComplete_Movement ( class APawn* oMember,
 
 void ABioBaseSquadDesign::eventMemberAdded ( int nIndex )
 {
-	static UFunction* pFnMemberAdded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMemberAddedRef { L"Function SFXStrategicAI.BioBaseSquadDesign.MemberAdded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMemberAdded )
-		pFnMemberAdded = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.MemberAdded" );
+	UFunction* const pFnMemberAdded = pFnMemberAddedRef.Get ( );
 
 	ABioBaseSquadDesign_eventMemberAdded_Parms MemberAdded_Parms;
 	MemberAdded_Parms.nIndex = nIndex;
@@ -279,10 +262,9 @@ void ABioBaseSquadDesign::eventMemberAdded ( int nIndex )
 
 void ABioBaseSquadDesign::eventMemberRemoved ( class APawn* oPawn )
 {
-	static UFunction* pFnMemberRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMemberRemovedRef { L"Function SFXStrategicAI.BioBaseSquadDesign.MemberRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMemberRemoved )
-		pFnMemberRemoved = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.MemberRemoved" );
+	UFunction* const pFnMemberRemoved = pFnMemberRemovedRef.Get ( );
 
 	ABioBaseSquadDesign_eventMemberRemoved_Parms MemberRemoved_Parms;
 	MemberRemoved_Parms.oPawn = oPawn;
@@ -299,10 +281,9 @@ void ABioBaseSquadDesign::eventMemberRemoved ( class APawn* oPawn )
 
 void ABioBaseSquadDesign::RemovePerceptionMultipliers ( class ABioAiController* oMember, float fSightMult, float fHearingMult )
 {
-	static UFunction* pFnRemovePerceptionMultipliers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRemovePerceptionMultipliersRef { L"Function SFXStrategicAI.BioBaseSquadDesign.RemovePerceptionMultipliers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRemovePerceptionMultipliers )
-		pFnRemovePerceptionMultipliers = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.RemovePerceptionMultipliers" );
+	UFunction* const pFnRemovePerceptionMultipliers = pFnRemovePerceptionMultipliersRef.Get ( );
 
 	ABioBaseSquadDesign_execRemovePerceptionMultipliers_Parms RemovePerceptionMultipliers_Parms;
 	RemovePerceptionMultipliers_Parms.oMember = oMember;
@@ -321,10 +302,9 @@ void ABioBaseSquadDesign::RemovePerceptionMultipliers ( class ABioAiController*
 
 void ABioBaseSquadDesign::ApplyPerceptionMultipliers ( class ABioAiController* oMember, float fSightMult, float fHearingMult )
 {
-	static UFunction* pFnApplyPerceptionMultipliers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyPerceptionMultipliersRef { L"Function SFXStrategicAI.BioBaseSquadDesign.ApplyPerceptionMultipliers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyPerceptionMultipliers )
-		pFnApplyPerceptionMultipliers = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.ApplyPerceptionMultipliers" );
+	UFunction* const pFnApplyPerceptionMultipliers = pFnApplyPerceptionMultipliersRef.Get ( );
 
 	ABioBaseSquadDesign_execApplyPerceptionMultipliers_Parms ApplyPerceptionMultipliers_Parms;
 	ApplyPerceptionMultipliers_Parms.oMember = oMember;
@@ -340,10 +320,9 @@ void ABioBaseSquadDesign::ApplyPerceptionMultipliers ( class ABioAiController* o
 
 void ABioBaseSquadDesign::ResetAttackedRecently ( )
 {
-	static UFunction* pFnResetAttackedRecently = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResetAttackedRecentlyRef { L"Function SFXStrategicAI.BioBaseSquadDesign.ResetAttackedRecently", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResetAttackedRecently )
-		pFnResetAttackedRecently = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.ResetAttackedRecently" );
+	UFunction* const pFnResetAttackedRecently = pFnResetAttackedRecentlyRef.Get ( );
 
 	ABioBaseSquadDesign_execResetAttackedRecently_Parms ResetAttackedRecently_Parms;
 
@@ -358,10 +337,9 @@ void ABioBaseSquadDesign::ResetAttackedRecently ( )
 
 void ABioBaseSquadDesign::eventNoLongerSeePlayer ( class APawn* Who, class APawn* Seen )
 {
-	static UFunction* pFnNoLongerSeePlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNoLongerSeePlayerRef { L"Function SFXStrategicAI.BioBaseSquadDesign.NoLongerSeePlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNoLongerSeePlayer )
-		pFnNoLongerSeePlayer = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.NoLongerSeePlayer" );
+	UFunction* const pFnNoLongerSeePlayer = pFnNoLongerSeePlayerRef.Get ( );
 
 	ABioBaseSquadDesign_eventNoLongerSeePlayer_Parms NoLongerSeePlayer_Parms;
 	NoLongerSeePlayer_Parms.Who = Who;
@@ -378,10 +356,9 @@ void ABioBaseSquadDesign::eventNoLongerSeePlayer ( class APawn* Who, class APawn
 
 void ABioBaseSquadDesign::eventSeePlayer ( class APawn* Who, class APawn* Seen )
 {
-	static UFunction* pFnSeePlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSeePlayerRef { L"Function SFXStrategicAI.BioBaseSquadDesign.SeePlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSeePlayer )
-		pFnSeePlayer = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.SeePlayer" );
+	UFunction* const pFnSeePlayer = pFnSeePlayerRef.Get ( );
 
 	ABioBaseSquadDesign_eventSeePlayer_Parms SeePlayer_Parms;
 	SeePlayer_Parms.Who = Who;
@@ -398,10 +375,9 @@ void ABioBaseSquadDesign::eventSeePlayer ( class APawn* Who, class APawn* Seen )
 
 void ABioBaseSquadDesign::eventOnFactionChanged ( class UClass* oOldFaction, class UClass* oNewFaction )
 {
-	static UFunction* pFnOnFactionChanged = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnFactionChangedRef { L"Function SFXStrategicAI.BioBaseSquadDesign.OnFactionChanged", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnFactionChanged )
-		pFnOnFactionChanged = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.OnFactionChanged" );
+	UFunction* const pFnOnFactionChanged = pFnOnFactionChangedRef.Get ( );
 
 	ABioBaseSquadDesign_eventOnFactionChanged_Parms OnFactionChanged_Parms;
 	OnFactionChanged_Parms.oOldFaction = oOldFaction;
@@ -417,10 +393,9 @@ void ABioBaseSquadDesign::eventOnFactionChanged ( class UClass* oOldFaction, cla
 
 unsigned char ABioBaseSquadDesign::eventGetOrientationType ( )
 {
-	static UFunction* pFnGetOrientationType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOrientationTypeRef { L"Function SFXStrategicAI.BioBaseSquadDesign.GetOrientationType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOrientationType )
-		pFnGetOrientationType = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.GetOrientationType" );
+	UFunction* const pFnGetOrientationType = pFnGetOrientationTypeRef.Get ( );
 
 	ABioBaseSquadDesign_eventGetOrientationType_Parms GetOrientationType_Parms;
 
@@ -436,10 +411,9 @@ unsigned char ABioBaseSquadDesign::eventGetOrientationType ( )
 
 class UClass* ABioBaseSquadDesign::eventGetRestFormation ( )
 {
-	static UFunction* pFnGetRestFormation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetRestFormationRef { L"Function SFXStrategicAI.BioBaseSquadDesign.GetRestFormation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetRestFormation )
-		pFnGetRestFormation = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.GetRestFormation" );
+	UFunction* const pFnGetRestFormation = pFnGetRestFormationRef.Get ( );
 
 	ABioBaseSquadDesign_eventGetRestFormation_Parms GetRestFormation_Parms;
 
@@ -454,10 +428,9 @@ class UClass* ABioBaseSquadDesign::eventGetRestFormation ( )
 
 void ABioBaseSquadDesign::SquadWalkWaypoints ( )
 {
-	static UFunction* pFnSquadWalkWaypoints = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSquadWalkWaypointsRef { L"Function SFXStrategicAI.BioBaseSquadDesign.SquadWalkWaypoints", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSquadWalkWaypoints )
-		pFnSquadWalkWaypoints = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.SquadWalkWaypoints" );
+	UFunction* const pFnSquadWalkWaypoints = pFnSquadWalkWaypointsRef.Get ( );
 
 	ABioBaseSquadDesign_execSquadWalkWaypoints_Parms SquadWalkWaypoints_Parms;
 
@@ -472,10 +445,9 @@ void ABioBaseSquadDesign::SquadWalkWaypoints ( )
 
 bool ABioBaseSquadDesign::SquadMemberWalkWaypoints ( class ABioAiController* oMember )
 {
-	static UFunction* pFnSquadMemberWalkWaypoints = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSquadMemberWalkWaypointsRef { L"Function SFXStrategicAI.BioBaseSquadDesign.SquadMemberWalkWaypoints", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSquadMemberWalkWaypoints )
-		pFnSquadMemberWalkWaypoints = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.SquadMemberWalkWaypoints" );
+	UFunction* const pFnSquadMemberWalkWaypoints = pFnSquadMemberWalkWaypointsRef.Get ( );
 
 	ABioBaseSquadDesign_execSquadMemberWalkWaypoints_Parms SquadMemberWalkWaypoints_Parms;
 	SquadMemberWalkWaypoints_Parms.oMember = oMember;
@@ -503,10 +475,9 @@ bool ABioBaseSquadDesign::SquadMemberWalkWaypoints ( class ABioAiController* oMe
 
 class ANavigationPoint* ABioBaseSquadDesign::GetNavPointInPlaypen ( struct FVector const& vNear, struct FVector const& vLateralOffset, float fSearchRadius, float fVerticalOffset, unsigned long bCanFly, unsigned long bCanHop, unsigned long bSniper, unsigned long bAggressive, unsigned long bDefensive, class AActor* oLOSTarget, class ABioPawn* oIgnoreIfLockedBy )
 {
-	static UFunction* pFnGetNavPointInPlaypen = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetNavPointInPlaypenRef { L"Function SFXStrategicAI.BioBaseSquadDesign.GetNavPointInPlaypen", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetNavPointInPlaypen )
-		pFnGetNavPointInPlaypen = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.GetNavPointInPlaypen" );
+	UFunction* const pFnGetNavPointInPlaypen = pFnGetNavPointInPlaypenRef.Get ( );
 
 	ABioBaseSquadDesign_execGetNavPointInPlaypen_Parms GetNavPointInPlaypen_Parms;
 	memcpy ( &GetNavPointInPlaypen_Parms.vNear, &vNear, 0xC );
@@ -534,10 +505,9 @@ class ANavigationPoint* ABioBaseSquadDesign::GetNavPointInPlaypen ( struct FVect
 
 struct FVector ABioBaseSquadDesign::GetFlockingOffset ( class ABioAiController* oMember )
 {
-	static UFunction* pFnGetFlockingOffset = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetFlockingOffsetRef { L"Function SFXStrategicAI.BioBaseSquadDesign.GetFlockingOffset", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetFlockingOffset )
-		pFnGetFlockingOffset = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.GetFlockingOffset" );
+	UFunction* const pFnGetFlockingOffset = pFnGetFlockingOffsetRef.Get ( );
 
 	ABioBaseSquadDesign_execGetFlockingOffset_Parms GetFlockingOffset_Parms;
 	GetFlockingOffset_Parms.oMember = oMember;
@@ -556,10 +526,9 @@ struct FVector ABioBaseSquadDesign::GetFlockingOffset ( class ABioAiController*
 
 void ABioBaseSquadDesign::SetFlockingRanges ( float FMin, float FMax, float fSquadMax )
 {
-	static UFunction* pFnSetFlockingRanges = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetFlockingRangesRef { L"Function SFXStrategicAI.BioBaseSquadDesign.SetFlockingRanges", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetFlockingRanges )
-		pFnSetFlockingRanges = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.SetFlockingRanges" );
+	UFunction* const pFnSetFlockingRanges = pFnSetFlockingRangesRef.Get ( );
 
 	ABioBaseSquadDesign_execSetFlockingRanges_Parms SetFlockingRanges_Parms;
 	SetFlockingRanges_Parms.FMin = FMin;
@@ -579,10 +548,9 @@ void ABioBaseSquadDesign::SetFlockingRanges ( float FMin, float FMax, float fSqu
 
 class ABioAiController* ABioBaseSquadDesign::GetFurthestSquadMember ( struct FVector const& vTarget, TArray<class ABioAiController*> const& aoIgnoreMembers, float* fLongestDistToTargetSq )
 {
-	static UFunction* pFnGetFurthestSquadMember = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetFurthestSquadMemberRef { L"Function SFXStrategicAI.BioBaseSquadDesign.GetFurthestSquadMember", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetFurthestSquadMember )
-		pFnGetFurthestSquadMember = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.GetFurthestSquadMember" );
+	UFunction* const pFnGetFurthestSquadMember = pFnGetFurthestSquadMemberRef.Get ( );
 
 	ABioBaseSquadDesign_execGetFurthestSquadMember_Parms GetFurthestSquadMember_Parms;
 	memcpy ( &GetFurthestSquadMember_Parms.vTarget, &vTarget, 0xC );
@@ -605,10 +573,9 @@ class ABioAiController* ABioBaseSquadDesign::GetFurthestSquadMember ( struct FVe
 
 void ABioBaseSquadDesign::ResetSquadProximity ( )
 {
-	static UFunction* pFnResetSquadProximity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResetSquadProximityRef { L"Function SFXStrategicAI.BioBaseSquadDesign.ResetSquadProximity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResetSquadProximity )
-		pFnResetSquadProximity = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.ResetSquadProximity" );
+	UFunction* const pFnResetSquadProximity = pFnResetSquadProximityRef.Get ( );
 
 	ABioBaseSquadDesign_execResetSquadProximity_Parms ResetSquadProximity_Parms;
 
@@ -622,10 +589,9 @@ void ABioBaseSquadDesign::ResetSquadProximity ( )
 
 void ABioBaseSquadDesign::SetSquadProximityByAttackRange ( float fMultiplier )
 {
-	static UFunction* pFnSetSquadProximityByAttackRange = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetSquadProximityByAttackRangeRef { L"Function SFXStrategicAI.BioBaseSquadDesign.SetSquadProximityByAttackRange", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetSquadProximityByAttackRange )
-		pFnSetSquadProximityByAttackRange = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.SetSquadProximityByAttackRange" );
+	UFunction* const pFnSetSquadProximityByAttackRange = pFnSetSquadProximityByAttackRangeRef.Get ( );
 
 	ABioBaseSquadDesign_execSetSquadProximityByAttackRange_Parms SetSquadProximityByAttackRange_Parms;
 	SetSquadProximityByAttackRange_Parms.fMultiplier = fMultiplier;
@@ -643,10 +609,9 @@ void ABioBaseSquadDesign::SetSquadProximityByAttackRange ( float fMultiplier )
 
 void ABioBaseSquadDesign::SetSquadProximity ( float fDefault, float fCloseCombat, float fSniperCombat, float fSupport )
 {
-	static UFunction* pFnSetSquadProximity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetSquadProximityRef { L"Function SFXStrategicAI.BioBaseSquadDesign.SetSquadProximity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetSquadProximity )
-		pFnSetSquadProximity = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.SetSquadProximity" );
+	UFunction* const pFnSetSquadProximity = pFnSetSquadProximityRef.Get ( );
 
 	ABioBaseSquadDesign_execSetSquadProximity_Parms SetSquadProximity_Parms;
 	SetSquadProximity_Parms.fDefault = fDefault;
@@ -669,10 +634,9 @@ void ABioBaseSquadDesign::SetSquadProximity ( float fDefault, float fCloseCombat
 
 void ABioBaseSquadDesign::PushMoveWithLocking ( class ABioAiController* oMember, class AActor* oTarget, float fTolerance, unsigned long bWalking, float fMovementDelay, unsigned long bCrouch )
 {
-	static UFunction* pFnPushMoveWithLocking = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPushMoveWithLockingRef { L"Function SFXStrategicAI.BioBaseSquadDesign.PushMoveWithLocking", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPushMoveWithLocking )
-		pFnPushMoveWithLocking = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.PushMoveWithLocking" );
+	UFunction* const pFnPushMoveWithLocking = pFnPushMoveWithLockingRef.Get ( );
 
 	ABioBaseSquadDesign_execPushMoveWithLocking_Parms PushMoveWithLocking_Parms;
 	PushMoveWithLocking_Parms.oMember = oMember;
@@ -702,10 +666,9 @@ void ABioBaseSquadDesign::PushMoveWithLocking ( class ABioAiController* oMember,
 
 bool ABioBaseSquadDesign::SquadMemberTakeCover ( class ABioAiController* oMember, float fCoverRange, float fNavRange, class APawn* oTarget, class APawn* oAvoid, unsigned long bNewCover, unsigned long bCrouchIfNoCover, float fMovementDelay, struct FVector const& vCoverLocation, unsigned long bUseDefNodeIfNoCover )
 {
-	static UFunction* pFnSquadMemberTakeCover = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSquadMemberTakeCoverRef { L"Function SFXStrategicAI.BioBaseSquadDesign.SquadMemberTakeCover", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSquadMemberTakeCover )
-		pFnSquadMemberTakeCover = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.SquadMemberTakeCover" );
+	UFunction* const pFnSquadMemberTakeCover = pFnSquadMemberTakeCoverRef.Get ( );
 
 	ABioBaseSquadDesign_execSquadMemberTakeCover_Parms SquadMemberTakeCover_Parms;
 	SquadMemberTakeCover_Parms.oMember = oMember;
@@ -732,10 +695,9 @@ bool ABioBaseSquadDesign::SquadMemberTakeCover ( class ABioAiController* oMember
 
 bool ABioBaseSquadDesign::IsAtDefenseNode ( class APawn* oTestPawn )
 {
-	static UFunction* pFnIsAtDefenseNode = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsAtDefenseNodeRef { L"Function SFXStrategicAI.BioBaseSquadDesign.IsAtDefenseNode", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsAtDefenseNode )
-		pFnIsAtDefenseNode = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.IsAtDefenseNode" );
+	UFunction* const pFnIsAtDefenseNode = pFnIsAtDefenseNodeRef.Get ( );
 
 	ABioBaseSquadDesign_execIsAtDefenseNode_Parms IsAtDefenseNode_Parms;
 	IsAtDefenseNode_Parms.oTestPawn = oTestPawn;
@@ -759,10 +721,9 @@ bool ABioBaseSquadDesign::IsAtDefenseNode ( class APawn* oTestPawn )
 
 void ABioBaseSquadDesign::SquadTakeCover ( float fCoverRange, float fNavRange, class APawn* oTarget, class APawn* oAvoid, unsigned long bNewCover, unsigned long bCrouchIfNoCover, float fDelayOrdersLoop, unsigned long bUseDefNodeIfNoCover )
 {
-	static UFunction* pFnSquadTakeCover = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSquadTakeCoverRef { L"Function SFXStrategicAI.BioBaseSquadDesign.SquadTakeCover", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSquadTakeCover )
-		pFnSquadTakeCover = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.SquadTakeCover" );
+	UFunction* const pFnSquadTakeCover = pFnSquadTakeCoverRef.Get ( );
 
 	ABioBaseSquadDesign_execSquadTakeCover_Parms SquadTakeCover_Parms;
 	SquadTakeCover_Parms.fCoverRange = fCoverRange;
@@ -790,10 +751,9 @@ void ABioBaseSquadDesign::SquadTakeCover ( float fCoverRange, float fNavRange, c
 
 bool ABioBaseSquadDesign::PushCoverWithLocking ( class ABioAiController* oMember, struct FVector const& vNear, class APawn* oTarget, class APawn* oAvoid, float fCoverRadius, float fMovementDelay )
 {
-	static UFunction* pFnPushCoverWithLocking = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPushCoverWithLockingRef { L"Function SFXStrategicAI.BioBaseSquadDesign.PushCoverWithLocking", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPushCoverWithLocking )
-		pFnPushCoverWithLocking = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.PushCoverWithLocking" );
+	UFunction* const pFnPushCoverWithLocking = pFnPushCoverWithLockingRef.Get ( );
 
 	ABioBaseSquadDesign_execPushCoverWithLocking_Parms PushCoverWithLocking_Parms;
 	PushCoverWithLocking_Parms.oMember = oMember;
@@ -819,10 +779,9 @@ bool ABioBaseSquadDesign::PushCoverWithLocking ( class ABioAiController* oMember
 
 void ABioBaseSquadDesign::GetCoverList ( class ABioAiController* oMember, class APawn* oTarget, class APawn* oAvoid, TArray<class APawn*>* aoCoverAgainst, TArray<int>* aoCoverValue )
 {
-	static UFunction* pFnGetCoverList = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetCoverListRef { L"Function SFXStrategicAI.BioBaseSquadDesign.GetCoverList", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetCoverList )
-		pFnGetCoverList = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.GetCoverList" );
+	UFunction* const pFnGetCoverList = pFnGetCoverListRef.Get ( );
 
 	ABioBaseSquadDesign_execGetCoverList_Parms GetCoverList_Parms;
 	GetCoverList_Parms.oMember = oMember;
@@ -850,10 +809,9 @@ void ABioBaseSquadDesign::GetCoverList ( class ABioAiController* oMember, class
 
 void ABioBaseSquadDesign::UnlockAllPathnodes ( )
 {
-	static UFunction* pFnUnlockAllPathnodes = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnlockAllPathnodesRef { L"Function SFXStrategicAI.BioBaseSquadDesign.UnlockAllPathnodes", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnlockAllPathnodes )
-		pFnUnlockAllPathnodes = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.UnlockAllPathnodes" );
+	UFunction* const pFnUnlockAllPathnodes = pFnUnlockAllPathnodesRef.Get ( );
 
 	ABioBaseSquadDesign_execUnlockAllPathnodes_Parms UnlockAllPathnodes_Parms;
 
@@ -867,10 +825,9 @@ void ABioBaseSquadDesign::UnlockAllPathnodes ( )
 
 void ABioBaseSquadDesign::UnlockPathnodesByOwner ( class ABioPawn* oUnlockOwner )
 {
-	static UFunction* pFnUnlockPathnodesByOwner = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnlockPathnodesByOwnerRef { L"Function SFXStrategicAI.BioBaseSquadDesign.UnlockPathnodesByOwner", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnlockPathnodesByOwner )
-		pFnUnlockPathnodesByOwner = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.UnlockPathnodesByOwner" );
+	UFunction* const pFnUnlockPathnodesByOwner = pFnUnlockPathnodesByOwnerRef.Get ( );
 
 	ABioBaseSquadDesign_execUnlockPathnodesByOwner_Parms UnlockPathnodesByOwner_Parms;
 	UnlockPathnodesByOwner_Parms.oUnlockOwner = oUnlockOwner;
@@ -885,10 +842,9 @@ void ABioBaseSquadDesign::UnlockPathnodesByOwner ( class ABioPawn* oUnlockOwner
 
 void ABioBaseSquadDesign::UnlockPathnode ( class ANavigationPoint* oUnlockNode )
 {
-	static UFunction* pFnUnlockPathnode = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnlockPathnodeRef { L"Function SFXStrategicAI.BioBaseSquadDesign.UnlockPathnode", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnlockPathnode )
-		pFnUnlockPathnode = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.UnlockPathnode" );
+	UFunction* const pFnUnlockPathnode = pFnUnlockPathnodeRef.Get ( );
 
 	ABioBaseSquadDesign_execUnlockPathnode_Parms UnlockPathnode_Parms;
 	UnlockPathnode_Parms.oUnlockNode = oUnlockNode;
@@ -905,10 +861,9 @@ void ABioBaseSquadDesign::UnlockPathnode ( class ANavigationPoint* oUnlockNode )
 
 void ABioBaseSquadDesign::LockPathnode ( class ANavigationPoint* oLockNode, class ABioPawn* oLockOwner, int* nIndex )
 {
-	static UFunction* pFnLockPathnode = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLockPathnodeRef { L"Function SFXStrategicAI.BioBaseSquadDesign.LockPathnode", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLockPathnode )
-		pFnLockPathnode = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.LockPathnode" );
+	UFunction* const pFnLockPathnode = pFnLockPathnodeRef.Get ( );
 
 	ABioBaseSquadDesign_execLockPathnode_Parms LockPathnode_Parms;
 	LockPathnode_Parms.oLockNode = oLockNode;
@@ -933,10 +888,9 @@ void ABioBaseSquadDesign::LockPathnode ( class ANavigationPoint* oLockNode, clas
 
 bool ABioBaseSquadDesign::IsPathnodeLocked ( class ANavigationPoint* oTestNode, class ABioPawn* oIgnoreMember, int* nIndex )
 {
-	static UFunction* pFnIsPathnodeLocked = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsPathnodeLockedRef { L"Function SFXStrategicAI.BioBaseSquadDesign.IsPathnodeLocked", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsPathnodeLocked )
-		pFnIsPathnodeLocked = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.IsPathnodeLocked" );
+	UFunction* const pFnIsPathnodeLocked = pFnIsPathnodeLockedRef.Get ( );
 
 	ABioBaseSquadDesign_execIsPathnodeLocked_Parms IsPathnodeLocked_Parms;
 	IsPathnodeLocked_Parms.oTestNode = oTestNode;
@@ -961,10 +915,9 @@ bool ABioBaseSquadDesign::IsPathnodeLocked ( class ANavigationPoint* oTestNode,
 
 TArray<class ANavigationPoint*> ABioBaseSquadDesign::GetLockedPathNodes ( class ABioPawn* oIgnoreMember )
 {
-	static UFunction* pFnGetLockedPathNodes = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLockedPathNodesRef { L"Function SFXStrategicAI.BioBaseSquadDesign.GetLockedPathNodes", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLockedPathNodes )
-		pFnGetLockedPathNodes = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.GetLockedPathNodes" );
+	UFunction* const pFnGetLockedPathNodes = pFnGetLockedPathNodesRef.Get ( );
 
 	ABioBaseSquadDesign_execGetLockedPathNodes_Parms GetLockedPathNodes_Parms;
 	GetLockedPathNodes_Parms.oIgnoreMember = oIgnoreMember;
@@ -982,10 +935,9 @@ TArray<class ANavigationPoint*> ABioBaseSquadDesign::GetLockedPathNodes ( class
 
 class ANavigationPoint* ABioBaseSquadDesign::GetCurrentMovePoint ( class ABioPawn* oMemberPawn )
 {
-	static UFunction* pFnGetCurrentMovePoint = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetCurrentMovePointRef { L"Function SFXStrategicAI.BioBaseSquadDesign.GetCurrentMovePoint", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetCurrentMovePoint )
-		pFnGetCurrentMovePoint = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.GetCurrentMovePoint" );
+	UFunction* const pFnGetCurrentMovePoint = pFnGetCurrentMovePointRef.Get ( );
 
 	ABioBaseSquadDesign_execGetCurrentMovePoint_Parms GetCurrentMovePoint_Parms;
 	GetCurrentMovePoint_Parms.oMemberPawn = oMemberPawn;
@@ -1002,10 +954,9 @@ class ANavigationPoint* ABioBaseSquadDesign::GetCurrentMovePoint ( class ABioPaw
 
 void ABioBaseSquadDesign::DropAgitationIfNoHostile ( unsigned char nNewLevel )
 {
-	static UFunction* pFnDropAgitationIfNoHostile = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDropAgitationIfNoHostileRef { L"Function SFXStrategicAI.BioBaseSquadDesign.DropAgitationIfNoHostile", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDropAgitationIfNoHostile )
-		pFnDropAgitationIfNoHostile = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.DropAgitationIfNoHostile" );
+	UFunction* const pFnDropAgitationIfNoHostile = pFnDropAgitationIfNoHostileRef.Get ( );
 
 	ABioBaseSquadDesign_execDropAgitationIfNoHostile_Parms DropAgitationIfNoHostile_Parms;
 	DropAgitationIfNoHostile_Parms.nNewLevel = nNewLevel;
@@ -1022,10 +973,9 @@ void ABioBaseSquadDesign::DropAgitationIfNoHostile ( unsigned char nNewLevel )
 
 void ABioBaseSquadDesign::UpgradeAgitationIfHostile ( class APawn* oWho, class APawn* oPerceived, unsigned char nNewLevel )
 {
-	static UFunction* pFnUpgradeAgitationIfHostile = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpgradeAgitationIfHostileRef { L"Function SFXStrategicAI.BioBaseSquadDesign.UpgradeAgitationIfHostile", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpgradeAgitationIfHostile )
-		pFnUpgradeAgitationIfHostile = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.UpgradeAgitationIfHostile" );
+	UFunction* const pFnUpgradeAgitationIfHostile = pFnUpgradeAgitationIfHostileRef.Get ( );
 
 	ABioBaseSquadDesign_execUpgradeAgitationIfHostile_Parms UpgradeAgitationIfHostile_Parms;
 	UpgradeAgitationIfHostile_Parms.oWho = oWho;
@@ -1042,10 +992,9 @@ void ABioBaseSquadDesign::UpgradeAgitationIfHostile ( class APawn* oWho, class A
 
 void ABioBaseSquadDesign::SetFactionByType ( unsigned char nNewFaction )
 {
-	static UFunction* pFnSetFactionByType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetFactionByTypeRef { L"Function SFXStrategicAI.BioBaseSquadDesign.SetFactionByType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetFactionByType )
-		pFnSetFactionByType = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.SetFactionByType" );
+	UFunction* const pFnSetFactionByType = pFnSetFactionByTypeRef.Get ( );
 
 	ABioBaseSquadDesign_execSetFactionByType_Parms SetFactionByType_Parms;
 	SetFactionByType_Parms.nNewFaction = nNewFaction;
@@ -1063,10 +1012,9 @@ void ABioBaseSquadDesign::SetFactionByType ( unsigned char nNewFaction )
 
 void ABioBaseSquadDesign::ClearAllSquadActions ( unsigned long bClearQueue, unsigned long bClearState, unsigned long bUnlockTarget, unsigned long bLeaveCombat )
 {
-	static UFunction* pFnClearAllSquadActions = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearAllSquadActionsRef { L"Function SFXStrategicAI.BioBaseSquadDesign.ClearAllSquadActions", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearAllSquadActions )
-		pFnClearAllSquadActions = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.ClearAllSquadActions" );
+	UFunction* const pFnClearAllSquadActions = pFnClearAllSquadActionsRef.Get ( );
 
 	ABioBaseSquadDesign_execClearAllSquadActions_Parms ClearAllSquadActions_Parms;
 	ClearAllSquadActions_Parms.bClearQueue = bClearQueue;
@@ -1084,10 +1032,9 @@ void ABioBaseSquadDesign::ClearAllSquadActions ( unsigned long bClearQueue, unsi
 
 float ABioBaseSquadDesign::CalculateAllLikelihoods ( )
 {
-	static UFunction* pFnCalculateAllLikelihoods = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateAllLikelihoodsRef { L"Function SFXStrategicAI.BioBaseSquadDesign.CalculateAllLikelihoods", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateAllLikelihoods )
-		pFnCalculateAllLikelihoods = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.CalculateAllLikelihoods" );
+	UFunction* const pFnCalculateAllLikelihoods = pFnCalculateAllLikelihoodsRef.Get ( );
 
 	ABioBaseSquadDesign_execCalculateAllLikelihoods_Parms CalculateAllLikelihoods_Parms;
 
@@ -1104,10 +1051,9 @@ float ABioBaseSquadDesign::CalculateAllLikelihoods ( )
 
 float ABioBaseSquadDesign::CalculateLikelihood ( struct SFXName sStrategyName )
 {
-	static UFunction* pFnCalculateLikelihood = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodRef { L"Function SFXStrategicAI.BioBaseSquadDesign.CalculateLikelihood", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihood )
-		pFnCalculateLikelihood = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.CalculateLikelihood" );
+	UFunction* const pFnCalculateLikelihood = pFnCalculateLikelihoodRef.Get ( );
 
 	ABioBaseSquadDesign_execCalculateLikelihood_Parms CalculateLikelihood_Parms;
 	memcpy ( &CalculateLikelihood_Parms.sStrategyName, &sStrategyName, 0x8 );
@@ -1125,10 +1071,9 @@ float ABioBaseSquadDesign::CalculateLikelihood ( struct SFXName sStrategyName )
 
 bool ABioBaseSquadDesign::IsValidStrategy ( struct SFXName sStrategyName )
 {
-	static UFunction* pFnIsValidStrategy = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsValidStrategyRef { L"Function SFXStrategicAI.BioBaseSquadDesign.IsValidStrategy", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsValidStrategy )
-		pFnIsValidStrategy = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.IsValidStrategy" );
+	UFunction* const pFnIsValidStrategy = pFnIsValidStrategyRef.Get ( );
 
 	ABioBaseSquadDesign_execIsValidStrategy_Parms IsValidStrategy_Parms;
 	memcpy ( &IsValidStrategy_Parms.sStrategyName, &sStrategyName, 0x8 );
@@ -1145,10 +1090,9 @@ bool ABioBaseSquadDesign::IsValidStrategy ( struct SFXName sStrategyName )
 
 TArray<struct SFXName> ABioBaseSquadDesign::GetStrategyList ( )
 {
-	static UFunction* pFnGetStrategyList = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetStrategyListRef { L"Function SFXStrategicAI.BioBaseSquadDesign.GetStrategyList", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetStrategyList )
-		pFnGetStrategyList = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.GetStrategyList" );
+	UFunction* const pFnGetStrategyList = pFnGetStrategyListRef.Get ( );
 
 	ABioBaseSquadDesign_execGetStrategyList_Parms GetStrategyList_Parms;
 
@@ -1164,10 +1108,9 @@ TArray<struct SFXName> ABioBaseSquadDesign::GetStrategyList ( )
 
 void ABioBaseSquadDesign::ActivateAfterDelay ( float fDelay )
 {
-	static UFunction* pFnActivateAfterDelay = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivateAfterDelayRef { L"Function SFXStrategicAI.BioBaseSquadDesign.ActivateAfterDelay", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivateAfterDelay )
-		pFnActivateAfterDelay = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.ActivateAfterDelay" );
+	UFunction* const pFnActivateAfterDelay = pFnActivateAfterDelayRef.Get ( );
 
 	ABioBaseSquadDesign_execActivateAfterDelay_Parms ActivateAfterDelay_Parms;
 	ActivateAfterDelay_Parms.fDelay = fDelay;
@@ -1181,10 +1124,9 @@ void ABioBaseSquadDesign::ActivateAfterDelay ( float fDelay )
 
 void ABioBaseSquadDesign::Activate ( )
 {
-	static UFunction* pFnActivate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivateRef { L"Function SFXStrategicAI.BioBaseSquadDesign.Activate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivate )
-		pFnActivate = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.Activate" );
+	UFunction* const pFnActivate = pFnActivateRef.Get ( );
 
 	ABioBaseSquadDesign_execActivate_Parms Activate_Parms;
 
@@ -1197,10 +1139,9 @@ void ABioBaseSquadDesign::Activate ( )
 
 void ABioBaseSquadDesign::Deactivate ( )
 {
-	static UFunction* pFnDeactivate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDeactivateRef { L"Function SFXStrategicAI.BioBaseSquadDesign.Deactivate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDeactivate )
-		pFnDeactivate = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.Deactivate" );
+	UFunction* const pFnDeactivate = pFnDeactivateRef.Get ( );
 
 	ABioBaseSquadDesign_execDeactivate_Parms Deactivate_Parms;
 
@@ -1213,10 +1154,9 @@ void ABioBaseSquadDesign::Deactivate ( )
 
 void ABioBaseSquadDesign::DoFallBackStrategy ( )
 {
-	static UFunction* pFnDoFallBackStrategy = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoFallBackStrategyRef { L"Function SFXStrategicAI.BioBaseSquadDesign.DoFallBackStrategy", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoFallBackStrategy )
-		pFnDoFallBackStrategy = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.DoFallBackStrategy" );
+	UFunction* const pFnDoFallBackStrategy = pFnDoFallBackStrategyRef.Get ( );
 
 	ABioBaseSquadDesign_execDoFallBackStrategy_Parms DoFallBackStrategy_Parms;
 
@@ -1230,10 +1170,9 @@ void ABioBaseSquadDesign::DoFallBackStrategy ( )
 
 bool ABioBaseSquadDesign::ReEvaluateStrategy ( )
 {
-	static UFunction* pFnReEvaluateStrategy = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReEvaluateStrategyRef { L"Function SFXStrategicAI.BioBaseSquadDesign.ReEvaluateStrategy", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReEvaluateStrategy )
-		pFnReEvaluateStrategy = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesign.ReEvaluateStrategy" );
+	UFunction* const pFnReEvaluateStrategy = pFnReEvaluateStrategyRef.Get ( );
 
 	ABioBaseSquadDesign_execReEvaluateStrategy_Parms ReEvaluateStrategy_Parms;
 
@@ -1244,86 +1183,65 @@ bool ABioBaseSquadDesign::ReEvaluateStrategy ( )
 
 
 
-class UClass* UBioFaction_Commoner::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioFaction_Commoner::pClassPointer { L"Class SFXStrategicAI.BioFaction_Commoner", &UObject::FindClass };
 
 class UClass* UBioFaction_Commoner::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioFaction_Commoner" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioFaction_Ambient::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioFaction_Ambient::pClassPointer { L"Class SFXStrategicAI.BioFaction_Ambient", &UObject::FindClass };
 
 class UClass* UBioFaction_Ambient::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioFaction_Ambient" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioFaction_Defender1::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioFaction_Defender1::pClassPointer { L"Class SFXStrategicAI.BioFaction_Defender1", &UObject::FindClass };
 
 class UClass* UBioFaction_Defender1::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioFaction_Defender1" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioFaction_Defender2::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioFaction_Defender2::pClassPointer { L"Class SFXStrategicAI.BioFaction_Defender2", &UObject::FindClass };
 
 class UClass* UBioFaction_Defender2::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioFaction_Defender2" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioFaction_Hostile1::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioFaction_Hostile1::pClassPointer { L"Class SFXStrategicAI.BioFaction_Hostile1", &UObject::FindClass };
 
 class UClass* UBioFaction_Hostile1::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioFaction_Hostile1" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioFaction_Hostile2::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioFaction_Hostile2::pClassPointer { L"Class SFXStrategicAI.BioFaction_Hostile2", &UObject::FindClass };
 
 class UClass* UBioFaction_Hostile2::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioFaction_Hostile2" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ABioBaseSquadDesignCombat::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ABioBaseSquadDesignCombat::pClassPointer { L"Class SFXStrategicAI.BioBaseSquadDesignCombat", &UObject::FindClass };
 
 class UClass* ABioBaseSquadDesignCombat::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioBaseSquadDesignCombat" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXStrategicAI.BioBaseSquadDesignCombat.OnActionComplete_Combat
@@ -1337,10 +1255,9 @@ class UClass* ABioBaseSquadDesignCombat::StaticClass()
 
 void ABioBaseSquadDesignCombat::eventOnActionComplete_Combat ( class APawn* oMember, struct SFXName nmAction, struct SFXName nmTechnique, int nReason, class AActor* oLastTarget )
 {
-	static UFunction* pFnOnActionComplete_Combat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnActionComplete_CombatRef { L"Function SFXStrategicAI.BioBaseSquadDesignCombat.OnActionComplete_Combat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnActionComplete_Combat )
-		pFnOnActionComplete_Combat = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesignCombat.OnActionComplete_Combat" );
+	UFunction* const pFnOnActionComplete_Combat = pFnOnActionComplete_CombatRef.Get ( );
 
 	ABioBaseSquadDesignCombat_eventOnActionComplete_Combat_Parms OnActionComplete_Combat_Parms;
 	OnActionComplete_Combat_Parms.oMember = oMember;
@@ -1363,10 +1280,9 @@ void ABioBaseSquadDesignCombat::eventOnActionComplete_Combat ( class APawn* oMem
 
 void ABioBaseSquadDesignCombat::eventOnActionComplete_Movement ( class APawn* oMember, struct SFXName nmAction, int nReason, class AActor* oTarget, struct FVector const& vLocation )
 {
-	static UFunction* pFnOnActionComplete_Movement = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnActionComplete_MovementRef { L"Function SFXStrategicAI.BioBaseSquadDesignCombat.OnActionComplete_Movement", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnActionComplete_Movement )
-		pFnOnActionComplete_Movement = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesignCombat.OnActionComplete_Movement" );
+	UFunction* const pFnOnActionComplete_Movement = pFnOnActionComplete_MovementRef.Get ( );
 
 	ABioBaseSquadDesignCombat_eventOnActionComplete_Movement_Parms OnActionComplete_Movement_Parms;
 	OnActionComplete_Movement_Parms.oMember = oMember;
@@ -1392,10 +1308,9 @@ void ABioBaseSquadDesignCombat::eventOnActionComplete_Movement ( class APawn* oM
 
 bool ABioBaseSquadDesignCombat::UseAttackCapability ( class ABioAiController* oMember, class APawn* oTarget, class UBioCapability* oCap, unsigned char eAttackType, float fStabilityOffset, class AActor* oMoveDest, float fMovementDelay )
 {
-	static UFunction* pFnUseAttackCapability = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUseAttackCapabilityRef { L"Function SFXStrategicAI.BioBaseSquadDesignCombat.UseAttackCapability", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUseAttackCapability )
-		pFnUseAttackCapability = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesignCombat.UseAttackCapability" );
+	UFunction* const pFnUseAttackCapability = pFnUseAttackCapabilityRef.Get ( );
 
 	ABioBaseSquadDesignCombat_execUseAttackCapability_Parms UseAttackCapability_Parms;
 	UseAttackCapability_Parms.oMember = oMember;
@@ -1420,10 +1335,9 @@ bool ABioBaseSquadDesignCombat::UseAttackCapability ( class ABioAiController* oM
 
 class APawn* ABioBaseSquadDesignCombat::FindDangerousEnemy ( class ABioAiController* oMember, class APawn* oIgnore )
 {
-	static UFunction* pFnFindDangerousEnemy = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFindDangerousEnemyRef { L"Function SFXStrategicAI.BioBaseSquadDesignCombat.FindDangerousEnemy", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFindDangerousEnemy )
-		pFnFindDangerousEnemy = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesignCombat.FindDangerousEnemy" );
+	UFunction* const pFnFindDangerousEnemy = pFnFindDangerousEnemyRef.Get ( );
 
 	ABioBaseSquadDesignCombat_execFindDangerousEnemy_Parms FindDangerousEnemy_Parms;
 	FindDangerousEnemy_Parms.oMember = oMember;
@@ -1443,10 +1357,9 @@ class APawn* ABioBaseSquadDesignCombat::FindDangerousEnemy ( class ABioAiControl
 
 class APawn* ABioBaseSquadDesignCombat::GetClosestPerceivedTarget ( class ABioAiController* oMember, class APawn* oIgnoreTarget )
 {
-	static UFunction* pFnGetClosestPerceivedTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetClosestPerceivedTargetRef { L"Function SFXStrategicAI.BioBaseSquadDesignCombat.GetClosestPerceivedTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetClosestPerceivedTarget )
-		pFnGetClosestPerceivedTarget = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesignCombat.GetClosestPerceivedTarget" );
+	UFunction* const pFnGetClosestPerceivedTarget = pFnGetClosestPerceivedTargetRef.Get ( );
 
 	ABioBaseSquadDesignCombat_execGetClosestPerceivedTarget_Parms GetClosestPerceivedTarget_Parms;
 	GetClosestPerceivedTarget_Parms.oMember = oMember;
@@ -1467,10 +1380,9 @@ class APawn* ABioBaseSquadDesignCombat::GetClosestPerceivedTarget ( class ABioAi
 
 float ABioBaseSquadDesignCombat::GetDistanceToNearestHostile ( unsigned long bSquareDist, class ABioAiController** oNearestMember, class APawn** oNearestTarget )
 {
-	static UFunction* pFnGetDistanceToNearestHostile = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDistanceToNearestHostileRef { L"Function SFXStrategicAI.BioBaseSquadDesignCombat.GetDistanceToNearestHostile", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDistanceToNearestHostile )
-		pFnGetDistanceToNearestHostile = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesignCombat.GetDistanceToNearestHostile" );
+	UFunction* const pFnGetDistanceToNearestHostile = pFnGetDistanceToNearestHostileRef.Get ( );
 
 	ABioBaseSquadDesignCombat_execGetDistanceToNearestHostile_Parms GetDistanceToNearestHostile_Parms;
 	GetDistanceToNearestHostile_Parms.bSquareDist = bSquareDist;
@@ -1499,10 +1411,9 @@ float ABioBaseSquadDesignCombat::GetDistanceToNearestHostile ( unsigned long bSq
 
 unsigned char ABioBaseSquadDesignCombat::eventGetOrientationType ( )
 {
-	static UFunction* pFnGetOrientationType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOrientationTypeRef { L"Function SFXStrategicAI.BioBaseSquadDesignCombat.GetOrientationType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOrientationType )
-		pFnGetOrientationType = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesignCombat.GetOrientationType" );
+	UFunction* const pFnGetOrientationType = pFnGetOrientationTypeRef.Get ( );
 
 	ABioBaseSquadDesignCombat_eventGetOrientationType_Parms GetOrientationType_Parms;
 
@@ -1518,10 +1429,9 @@ unsigned char ABioBaseSquadDesignCombat::eventGetOrientationType ( )
 
 class UClass* ABioBaseSquadDesignCombat::eventGetRestFormation ( )
 {
-	static UFunction* pFnGetRestFormation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetRestFormationRef { L"Function SFXStrategicAI.BioBaseSquadDesignCombat.GetRestFormation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetRestFormation )
-		pFnGetRestFormation = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesignCombat.GetRestFormation" );
+	UFunction* const pFnGetRestFormation = pFnGetRestFormationRef.Get ( );
 
 	ABioBaseSquadDesignCombat_eventGetRestFormation_Parms GetRestFormation_Parms;
 
@@ -1539,10 +1449,9 @@ class UClass* ABioBaseSquadDesignCombat::eventGetRestFormation ( )
 
 void ABioBaseSquadDesignCombat::eventOnCastAt ( class APawn* oMember, class APawn* oAttacker, struct SFXName nmPower )
 {
-	static UFunction* pFnOnCastAt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnCastAtRef { L"Function SFXStrategicAI.BioBaseSquadDesignCombat.OnCastAt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnCastAt )
-		pFnOnCastAt = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesignCombat.OnCastAt" );
+	UFunction* const pFnOnCastAt = pFnOnCastAtRef.Get ( );
 
 	ABioBaseSquadDesignCombat_eventOnCastAt_Parms OnCastAt_Parms;
 	OnCastAt_Parms.oMember = oMember;
@@ -1561,10 +1470,9 @@ void ABioBaseSquadDesignCombat::eventOnCastAt ( class APawn* oMember, class APaw
 
 void ABioBaseSquadDesignCombat::eventOnAttacked ( class APawn* oMember, class APawn* oAttacker, struct SFXName nmWeapon )
 {
-	static UFunction* pFnOnAttacked = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAttackedRef { L"Function SFXStrategicAI.BioBaseSquadDesignCombat.OnAttacked", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnAttacked )
-		pFnOnAttacked = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesignCombat.OnAttacked" );
+	UFunction* const pFnOnAttacked = pFnOnAttackedRef.Get ( );
 
 	ABioBaseSquadDesignCombat_eventOnAttacked_Parms OnAttacked_Parms;
 	OnAttacked_Parms.oMember = oMember;
@@ -1585,10 +1493,9 @@ void ABioBaseSquadDesignCombat::eventOnAttacked ( class APawn* oMember, class AP
 
 void ABioBaseSquadDesignCombat::eventHearNoise ( class APawn* Who, float Loudness, class AActor* NoiseMaker, struct FVector const& vNoiseLocation, struct SFXName NoiseType )
 {
-	static UFunction* pFnHearNoise = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHearNoiseRef { L"Function SFXStrategicAI.BioBaseSquadDesignCombat.HearNoise", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHearNoise )
-		pFnHearNoise = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesignCombat.HearNoise" );
+	UFunction* const pFnHearNoise = pFnHearNoiseRef.Get ( );
 
 	ABioBaseSquadDesignCombat_eventHearNoise_Parms HearNoise_Parms;
 	HearNoise_Parms.Who = Who;
@@ -1608,10 +1515,9 @@ void ABioBaseSquadDesignCombat::eventHearNoise ( class APawn* Who, float Loudnes
 
 void ABioBaseSquadDesignCombat::eventNoLongerSeePlayer ( class APawn* Who, class APawn* Seen )
 {
-	static UFunction* pFnNoLongerSeePlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNoLongerSeePlayerRef { L"Function SFXStrategicAI.BioBaseSquadDesignCombat.NoLongerSeePlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNoLongerSeePlayer )
-		pFnNoLongerSeePlayer = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesignCombat.NoLongerSeePlayer" );
+	UFunction* const pFnNoLongerSeePlayer = pFnNoLongerSeePlayerRef.Get ( );
 
 	ABioBaseSquadDesignCombat_eventNoLongerSeePlayer_Parms NoLongerSeePlayer_Parms;
 	NoLongerSeePlayer_Parms.Who = Who;
@@ -1628,10 +1534,9 @@ void ABioBaseSquadDesignCombat::eventNoLongerSeePlayer ( class APawn* Who, class
 
 void ABioBaseSquadDesignCombat::eventSeePlayer ( class APawn* Who, class APawn* Seen )
 {
-	static UFunction* pFnSeePlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSeePlayerRef { L"Function SFXStrategicAI.BioBaseSquadDesignCombat.SeePlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSeePlayer )
-		pFnSeePlayer = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesignCombat.SeePlayer" );
+	UFunction* const pFnSeePlayer = pFnSeePlayerRef.Get ( );
 
 	ABioBaseSquadDesignCombat_eventSeePlayer_Parms SeePlayer_Parms;
 	SeePlayer_Parms.Who = Who;
@@ -1647,10 +1552,9 @@ void ABioBaseSquadDesignCombat::eventSeePlayer ( class APawn* Who, class APawn*
 
 void ABioBaseSquadDesignCombat::eventSeenSquad ( class ABioBaseSquad* oSquad )
 {
-	static UFunction* pFnSeenSquad = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSeenSquadRef { L"Function SFXStrategicAI.BioBaseSquadDesignCombat.SeenSquad", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSeenSquad )
-		pFnSeenSquad = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioBaseSquadDesignCombat.SeenSquad" );
+	UFunction* const pFnSeenSquad = pFnSeenSquadRef.Get ( );
 
 	ABioBaseSquadDesignCombat_eventSeenSquad_Parms SeenSquad_Parms;
 	SeenSquad_Parms.oSquad = oSquad;
@@ -1660,62 +1564,47 @@ void ABioBaseSquadDesignCombat::eventSeenSquad ( class ABioBaseSquad* oSquad )
 
 
 
-class UClass* UBioFaction_CommonerPhysics::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioFaction_CommonerPhysics::pClassPointer { L"Class SFXStrategicAI.BioFaction_CommonerPhysics", &UObject::FindClass };
 
 class UClass* UBioFaction_CommonerPhysics::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioFaction_CommonerPhysics" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioForm_ScoutSwarm::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioForm_ScoutSwarm::pClassPointer { L"Class SFXStrategicAI.BioForm_ScoutSwarm", &UObject::FindClass };
 
 class UClass* UBioForm_ScoutSwarm::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioForm_ScoutSwarm" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioSeqAct_GetPropertyDesignSquad::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_GetPropertyDesignSquad::pClassPointer { L"Class SFXStrategicAI.BioSeqAct_GetPropertyDesignSquad", &UObject::FindClass };
 
 class UClass* UBioSeqAct_GetPropertyDesignSquad::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioSeqAct_GetPropertyDesignSquad" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioSeqAct_ModifyPropertyDesignSquad::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_ModifyPropertyDesignSquad::pClassPointer { L"Class SFXStrategicAI.BioSeqAct_ModifyPropertyDesignSquad", &UObject::FindClass };
 
 class UClass* UBioSeqAct_ModifyPropertyDesignSquad::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioSeqAct_ModifyPropertyDesignSquad" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ABioSquadAmbient::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ABioSquadAmbient::pClassPointer { L"Class SFXStrategicAI.BioSquadAmbient", &UObject::FindClass };
 
 class UClass* ABioSquadAmbient::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioSquadAmbient" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXStrategicAI.BioSquadAmbient.CalculateLikelihoodFlee
@@ -1725,10 +1614,9 @@ class UClass* ABioSquadAmbient::StaticClass()
 
 float ABioSquadAmbient::CalculateLikelihoodFlee ( )
 {
-	static UFunction* pFnCalculateLikelihoodFlee = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodFleeRef { L"Function SFXStrategicAI.BioSquadAmbient.CalculateLikelihoodFlee", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihoodFlee )
-		pFnCalculateLikelihoodFlee = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadAmbient.CalculateLikelihoodFlee" );
+	UFunction* const pFnCalculateLikelihoodFlee = pFnCalculateLikelihoodFleeRef.Get ( );
 
 	ABioSquadAmbient_execCalculateLikelihoodFlee_Parms CalculateLikelihoodFlee_Parms;
 
@@ -1744,10 +1632,9 @@ float ABioSquadAmbient::CalculateLikelihoodFlee ( )
 
 float ABioSquadAmbient::CalculateLikelihoodIdle ( )
 {
-	static UFunction* pFnCalculateLikelihoodIdle = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodIdleRef { L"Function SFXStrategicAI.BioSquadAmbient.CalculateLikelihoodIdle", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihoodIdle )
-		pFnCalculateLikelihoodIdle = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadAmbient.CalculateLikelihoodIdle" );
+	UFunction* const pFnCalculateLikelihoodIdle = pFnCalculateLikelihoodIdleRef.Get ( );
 
 	ABioSquadAmbient_execCalculateLikelihoodIdle_Parms CalculateLikelihoodIdle_Parms;
 
@@ -1764,10 +1651,9 @@ float ABioSquadAmbient::CalculateLikelihoodIdle ( )
 
 float ABioSquadAmbient::CalculateLikelihood ( struct SFXName sStrategyName )
 {
-	static UFunction* pFnCalculateLikelihood = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodRef { L"Function SFXStrategicAI.BioSquadAmbient.CalculateLikelihood", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihood )
-		pFnCalculateLikelihood = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadAmbient.CalculateLikelihood" );
+	UFunction* const pFnCalculateLikelihood = pFnCalculateLikelihoodRef.Get ( );
 
 	ABioSquadAmbient_execCalculateLikelihood_Parms CalculateLikelihood_Parms;
 	memcpy ( &CalculateLikelihood_Parms.sStrategyName, &sStrategyName, 0x8 );
@@ -1779,14 +1665,11 @@ float ABioSquadAmbient::CalculateLikelihood ( struct SFXName sStrategyName )
 
 
 
-class UClass* ABioSquadBeacon::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ABioSquadBeacon::pClassPointer { L"Class SFXStrategicAI.BioSquadBeacon", &UObject::FindClass };
 
 class UClass* ABioSquadBeacon::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioSquadBeacon" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXStrategicAI.BioSquadBeacon.CalculateLikelihoodCasting
@@ -1796,10 +1679,9 @@ class UClass* ABioSquadBeacon::StaticClass()
 
 float ABioSquadBeacon::CalculateLikelihoodCasting ( )
 {
-	static UFunction* pFnCalculateLikelihoodCasting = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodCastingRef { L"Function SFXStrategicAI.BioSquadBeacon.CalculateLikelihoodCasting", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihoodCasting )
-		pFnCalculateLikelihoodCasting = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadBeacon.CalculateLikelihoodCasting" );
+	UFunction* const pFnCalculateLikelihoodCasting = pFnCalculateLikelihoodCastingRef.Get ( );
 
 	ABioSquadBeacon_execCalculateLikelihoodCasting_Parms CalculateLikelihoodCasting_Parms;
 
@@ -1815,10 +1697,9 @@ float ABioSquadBeacon::CalculateLikelihoodCasting ( )
 
 void ABioSquadBeacon::SquadMemberBeginCasting ( class ABioAiController* oMember )
 {
-	static UFunction* pFnSquadMemberBeginCasting = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSquadMemberBeginCastingRef { L"Function SFXStrategicAI.BioSquadBeacon.SquadMemberBeginCasting", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSquadMemberBeginCasting )
-		pFnSquadMemberBeginCasting = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadBeacon.SquadMemberBeginCasting" );
+	UFunction* const pFnSquadMemberBeginCasting = pFnSquadMemberBeginCastingRef.Get ( );
 
 	ABioSquadBeacon_execSquadMemberBeginCasting_Parms SquadMemberBeginCasting_Parms;
 	SquadMemberBeginCasting_Parms.oMember = oMember;
@@ -1834,10 +1715,9 @@ void ABioSquadBeacon::SquadMemberBeginCasting ( class ABioAiController* oMember
 
 float ABioSquadBeacon::CalculateLikelihood ( struct SFXName sStrategyName )
 {
-	static UFunction* pFnCalculateLikelihood = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodRef { L"Function SFXStrategicAI.BioSquadBeacon.CalculateLikelihood", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihood )
-		pFnCalculateLikelihood = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadBeacon.CalculateLikelihood" );
+	UFunction* const pFnCalculateLikelihood = pFnCalculateLikelihoodRef.Get ( );
 
 	ABioSquadBeacon_execCalculateLikelihood_Parms CalculateLikelihood_Parms;
 	memcpy ( &CalculateLikelihood_Parms.sStrategyName, &sStrategyName, 0x8 );
@@ -1849,14 +1729,11 @@ float ABioSquadBeacon::CalculateLikelihood ( struct SFXName sStrategyName )
 
 
 
-class UClass* ABioSquadCombat::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ABioSquadCombat::pClassPointer { L"Class SFXStrategicAI.BioSquadCombat", &UObject::FindClass };
 
 class UClass* ABioSquadCombat::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioSquadCombat" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodDefend
@@ -1866,10 +1743,9 @@ class UClass* ABioSquadCombat::StaticClass()
 
 float ABioSquadCombat::CalculateLikelihoodDefend ( )
 {
-	static UFunction* pFnCalculateLikelihoodDefend = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodDefendRef { L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodDefend", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihoodDefend )
-		pFnCalculateLikelihoodDefend = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodDefend" );
+	UFunction* const pFnCalculateLikelihoodDefend = pFnCalculateLikelihoodDefendRef.Get ( );
 
 	ABioSquadCombat_execCalculateLikelihoodDefend_Parms CalculateLikelihoodDefend_Parms;
 
@@ -1885,10 +1761,9 @@ float ABioSquadCombat::CalculateLikelihoodDefend ( )
 
 float ABioSquadCombat::CalculateLikelihoodSkirmish ( )
 {
-	static UFunction* pFnCalculateLikelihoodSkirmish = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodSkirmishRef { L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodSkirmish", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihoodSkirmish )
-		pFnCalculateLikelihoodSkirmish = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodSkirmish" );
+	UFunction* const pFnCalculateLikelihoodSkirmish = pFnCalculateLikelihoodSkirmishRef.Get ( );
 
 	ABioSquadCombat_execCalculateLikelihoodSkirmish_Parms CalculateLikelihoodSkirmish_Parms;
 
@@ -1904,10 +1779,9 @@ float ABioSquadCombat::CalculateLikelihoodSkirmish ( )
 
 float ABioSquadCombat::CalculateLikelihoodCharge ( )
 {
-	static UFunction* pFnCalculateLikelihoodCharge = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodChargeRef { L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodCharge", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihoodCharge )
-		pFnCalculateLikelihoodCharge = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodCharge" );
+	UFunction* const pFnCalculateLikelihoodCharge = pFnCalculateLikelihoodChargeRef.Get ( );
 
 	ABioSquadCombat_execCalculateLikelihoodCharge_Parms CalculateLikelihoodCharge_Parms;
 
@@ -1923,10 +1797,9 @@ float ABioSquadCombat::CalculateLikelihoodCharge ( )
 
 float ABioSquadCombat::CalculateLikelihoodSearch ( )
 {
-	static UFunction* pFnCalculateLikelihoodSearch = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodSearchRef { L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodSearch", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihoodSearch )
-		pFnCalculateLikelihoodSearch = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodSearch" );
+	UFunction* const pFnCalculateLikelihoodSearch = pFnCalculateLikelihoodSearchRef.Get ( );
 
 	ABioSquadCombat_execCalculateLikelihoodSearch_Parms CalculateLikelihoodSearch_Parms;
 
@@ -1942,10 +1815,9 @@ float ABioSquadCombat::CalculateLikelihoodSearch ( )
 
 float ABioSquadCombat::CalculateLikelihoodIdle ( )
 {
-	static UFunction* pFnCalculateLikelihoodIdle = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodIdleRef { L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodIdle", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihoodIdle )
-		pFnCalculateLikelihoodIdle = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodIdle" );
+	UFunction* const pFnCalculateLikelihoodIdle = pFnCalculateLikelihoodIdleRef.Get ( );
 
 	ABioSquadCombat_execCalculateLikelihoodIdle_Parms CalculateLikelihoodIdle_Parms;
 
@@ -1962,10 +1834,9 @@ float ABioSquadCombat::CalculateLikelihoodIdle ( )
 
 float ABioSquadCombat::CalculateLikelihood ( struct SFXName sStrategyName )
 {
-	static UFunction* pFnCalculateLikelihood = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodRef { L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihood", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihood )
-		pFnCalculateLikelihood = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihood" );
+	UFunction* const pFnCalculateLikelihood = pFnCalculateLikelihoodRef.Get ( );
 
 	ABioSquadCombat_execCalculateLikelihood_Parms CalculateLikelihood_Parms;
 	memcpy ( &CalculateLikelihood_Parms.sStrategyName, &sStrategyName, 0x8 );
@@ -1977,14 +1848,11 @@ float ABioSquadCombat::CalculateLikelihood ( struct SFXName sStrategyName )
 
 
 
-class UClass* ABioSquadCommoner::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ABioSquadCommoner::pClassPointer { L"Class SFXStrategicAI.BioSquadCommoner", &UObject::FindClass };
 
 class UClass* ABioSquadCommoner::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioSquadCommoner" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXStrategicAI.BioSquadCommoner.CalculateLikelihoodIdle
@@ -1994,10 +1862,9 @@ class UClass* ABioSquadCommoner::StaticClass()
 
 float ABioSquadCommoner::CalculateLikelihoodIdle ( )
 {
-	static UFunction* pFnCalculateLikelihoodIdle = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodIdleRef { L"Function SFXStrategicAI.BioSquadCommoner.CalculateLikelihoodIdle", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihoodIdle )
-		pFnCalculateLikelihoodIdle = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadCommoner.CalculateLikelihoodIdle" );
+	UFunction* const pFnCalculateLikelihoodIdle = pFnCalculateLikelihoodIdleRef.Get ( );
 
 	ABioSquadCommoner_execCalculateLikelihoodIdle_Parms CalculateLikelihoodIdle_Parms;
 
@@ -2014,10 +1881,9 @@ float ABioSquadCommoner::CalculateLikelihoodIdle ( )
 
 float ABioSquadCommoner::CalculateLikelihood ( struct SFXName sStrategyName )
 {
-	static UFunction* pFnCalculateLikelihood = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodRef { L"Function SFXStrategicAI.BioSquadCommoner.CalculateLikelihood", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihood )
-		pFnCalculateLikelihood = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadCommoner.CalculateLikelihood" );
+	UFunction* const pFnCalculateLikelihood = pFnCalculateLikelihoodRef.Get ( );
 
 	ABioSquadCommoner_execCalculateLikelihood_Parms CalculateLikelihood_Parms;
 	memcpy ( &CalculateLikelihood_Parms.sStrategyName, &sStrategyName, 0x8 );
@@ -2029,14 +1895,11 @@ float ABioSquadCommoner::CalculateLikelihood ( struct SFXName sStrategyName )
 
 
 
-class UClass* ABioSquadPlayerDesignBase::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ABioSquadPlayerDesignBase::pClassPointer { L"Class SFXStrategicAI.BioSquadPlayerDesignBase", &UObject::FindClass };
 
 class UClass* ABioSquadPlayerDesignBase::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioSquadPlayerDesignBase" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXStrategicAI.BioSquadPlayerDesignBase.OnSquadSeen
@@ -2046,10 +1909,9 @@ class UClass* ABioSquadPlayerDesignBase::StaticClass()
 
 void ABioSquadPlayerDesignBase::eventOnSquadSeen ( class ABioBaseSquad* oSquad )
 {
-	static UFunction* pFnOnSquadSeen = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnSquadSeenRef { L"Function SFXStrategicAI.BioSquadPlayerDesignBase.OnSquadSeen", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnSquadSeen )
-		pFnOnSquadSeen = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayerDesignBase.OnSquadSeen" );
+	UFunction* const pFnOnSquadSeen = pFnOnSquadSeenRef.Get ( );
 
 	ABioSquadPlayerDesignBase_eventOnSquadSeen_Parms OnSquadSeen_Parms;
 	OnSquadSeen_Parms.oSquad = oSquad;
@@ -2064,10 +1926,9 @@ void ABioSquadPlayerDesignBase::eventOnSquadSeen ( class ABioBaseSquad* oSquad )
 
 bool ABioSquadPlayerDesignBase::AreHostilesNearby ( )
 {
-	static UFunction* pFnAreHostilesNearby = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAreHostilesNearbyRef { L"Function SFXStrategicAI.BioSquadPlayerDesignBase.AreHostilesNearby", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAreHostilesNearby )
-		pFnAreHostilesNearby = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayerDesignBase.AreHostilesNearby" );
+	UFunction* const pFnAreHostilesNearby = pFnAreHostilesNearbyRef.Get ( );
 
 	ABioSquadPlayerDesignBase_execAreHostilesNearby_Parms AreHostilesNearby_Parms;
 
@@ -2083,10 +1944,9 @@ bool ABioSquadPlayerDesignBase::AreHostilesNearby ( )
 
 void ABioSquadPlayerDesignBase::ClearMemberAttackCommand ( class ABioPawn* oMemberPawn )
 {
-	static UFunction* pFnClearMemberAttackCommand = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearMemberAttackCommandRef { L"Function SFXStrategicAI.BioSquadPlayerDesignBase.ClearMemberAttackCommand", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearMemberAttackCommand )
-		pFnClearMemberAttackCommand = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayerDesignBase.ClearMemberAttackCommand" );
+	UFunction* const pFnClearMemberAttackCommand = pFnClearMemberAttackCommandRef.Get ( );
 
 	ABioSquadPlayerDesignBase_execClearMemberAttackCommand_Parms ClearMemberAttackCommand_Parms;
 	ClearMemberAttackCommand_Parms.oMemberPawn = oMemberPawn;
@@ -2100,10 +1960,9 @@ void ABioSquadPlayerDesignBase::ClearMemberAttackCommand ( class ABioPawn* oMemb
 
 void ABioSquadPlayerDesignBase::ClearPerceptionFlag ( )
 {
-	static UFunction* pFnClearPerceptionFlag = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearPerceptionFlagRef { L"Function SFXStrategicAI.BioSquadPlayerDesignBase.ClearPerceptionFlag", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearPerceptionFlag )
-		pFnClearPerceptionFlag = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayerDesignBase.ClearPerceptionFlag" );
+	UFunction* const pFnClearPerceptionFlag = pFnClearPerceptionFlagRef.Get ( );
 
 	ABioSquadPlayerDesignBase_execClearPerceptionFlag_Parms ClearPerceptionFlag_Parms;
 
@@ -2116,10 +1975,9 @@ void ABioSquadPlayerDesignBase::ClearPerceptionFlag ( )
 
 void ABioSquadPlayerDesignBase::SetPerceptionFlag ( )
 {
-	static UFunction* pFnSetPerceptionFlag = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetPerceptionFlagRef { L"Function SFXStrategicAI.BioSquadPlayerDesignBase.SetPerceptionFlag", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetPerceptionFlag )
-		pFnSetPerceptionFlag = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayerDesignBase.SetPerceptionFlag" );
+	UFunction* const pFnSetPerceptionFlag = pFnSetPerceptionFlagRef.Get ( );
 
 	ABioSquadPlayerDesignBase_execSetPerceptionFlag_Parms SetPerceptionFlag_Parms;
 
@@ -2128,14 +1986,11 @@ void ABioSquadPlayerDesignBase::SetPerceptionFlag ( )
 
 
 
-class UClass* ABioSquadPlayer::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ABioSquadPlayer::pClassPointer { L"Class SFXStrategicAI.BioSquadPlayer", &UObject::FindClass };
 
 class UClass* ABioSquadPlayer::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioSquadPlayer" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXStrategicAI.BioSquadPlayer.Tick
@@ -2145,10 +2000,9 @@ class UClass* ABioSquadPlayer::StaticClass()
 
 void ABioSquadPlayer::eventTick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickRef { L"Function SFXStrategicAI.BioSquadPlayer.Tick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTick )
-		pFnTick = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.Tick" );
+	UFunction* const pFnTick = pFnTickRef.Get ( );
 
 	ABioSquadPlayer_eventTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -2162,10 +2016,9 @@ void ABioSquadPlayer::eventTick ( float DeltaTime )
 
 void ABioSquadPlayer::eventonPlayerEnterCover ( )
 {
-	static UFunction* pFnonPlayerEnterCover = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnonPlayerEnterCoverRef { L"Function SFXStrategicAI.BioSquadPlayer.onPlayerEnterCover", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnonPlayerEnterCover )
-		pFnonPlayerEnterCover = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.onPlayerEnterCover" );
+	UFunction* const pFnonPlayerEnterCover = pFnonPlayerEnterCoverRef.Get ( );
 
 	ABioSquadPlayer_eventonPlayerEnterCover_Parms onPlayerEnterCover_Parms;
 
@@ -2179,10 +2032,9 @@ void ABioSquadPlayer::eventonPlayerEnterCover ( )
 
 void ABioSquadPlayer::eventonMemberArrivedAtTarget ( class APawn* oMember )
 {
-	static UFunction* pFnonMemberArrivedAtTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnonMemberArrivedAtTargetRef { L"Function SFXStrategicAI.BioSquadPlayer.onMemberArrivedAtTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnonMemberArrivedAtTarget )
-		pFnonMemberArrivedAtTarget = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.onMemberArrivedAtTarget" );
+	UFunction* const pFnonMemberArrivedAtTarget = pFnonMemberArrivedAtTargetRef.Get ( );
 
 	ABioSquadPlayer_eventonMemberArrivedAtTarget_Parms onMemberArrivedAtTarget_Parms;
 	onMemberArrivedAtTarget_Parms.oMember = oMember;
@@ -2198,10 +2050,9 @@ void ABioSquadPlayer::eventonMemberArrivedAtTarget ( class APawn* oMember )
 
 bool ABioSquadPlayer::LookForCover ( class APawn* oMember )
 {
-	static UFunction* pFnLookForCover = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLookForCoverRef { L"Function SFXStrategicAI.BioSquadPlayer.LookForCover", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLookForCover )
-		pFnLookForCover = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.LookForCover" );
+	UFunction* const pFnLookForCover = pFnLookForCoverRef.Get ( );
 
 	ABioSquadPlayer_execLookForCover_Parms LookForCover_Parms;
 	LookForCover_Parms.oMember = oMember;
@@ -2218,10 +2069,9 @@ bool ABioSquadPlayer::LookForCover ( class APawn* oMember )
 
 void ABioSquadPlayer::eventOnSetSquadFollowFormation ( unsigned char eFormation )
 {
-	static UFunction* pFnOnSetSquadFollowFormation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnSetSquadFollowFormationRef { L"Function SFXStrategicAI.BioSquadPlayer.OnSetSquadFollowFormation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnSetSquadFollowFormation )
-		pFnOnSetSquadFollowFormation = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.OnSetSquadFollowFormation" );
+	UFunction* const pFnOnSetSquadFollowFormation = pFnOnSetSquadFollowFormationRef.Get ( );
 
 	ABioSquadPlayer_eventOnSetSquadFollowFormation_Parms OnSetSquadFollowFormation_Parms;
 	OnSetSquadFollowFormation_Parms.eFormation = eFormation;
@@ -2236,10 +2086,9 @@ void ABioSquadPlayer::eventOnSetSquadFollowFormation ( unsigned char eFormation
 
 void ABioSquadPlayer::OnMemberShieldsDown ( class APawn* oWho )
 {
-	static UFunction* pFnOnMemberShieldsDown = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnMemberShieldsDownRef { L"Function SFXStrategicAI.BioSquadPlayer.OnMemberShieldsDown", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnMemberShieldsDown )
-		pFnOnMemberShieldsDown = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.OnMemberShieldsDown" );
+	UFunction* const pFnOnMemberShieldsDown = pFnOnMemberShieldsDownRef.Get ( );
 
 	ABioSquadPlayer_execOnMemberShieldsDown_Parms OnMemberShieldsDown_Parms;
 	OnMemberShieldsDown_Parms.oWho = oWho;
@@ -2254,10 +2103,9 @@ void ABioSquadPlayer::OnMemberShieldsDown ( class APawn* oWho )
 
 void ABioSquadPlayer::eventMemberAdded ( int nIndex )
 {
-	static UFunction* pFnMemberAdded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMemberAddedRef { L"Function SFXStrategicAI.BioSquadPlayer.MemberAdded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMemberAdded )
-		pFnMemberAdded = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.MemberAdded" );
+	UFunction* const pFnMemberAdded = pFnMemberAddedRef.Get ( );
 
 	ABioSquadPlayer_eventMemberAdded_Parms MemberAdded_Parms;
 	MemberAdded_Parms.nIndex = nIndex;
@@ -2274,10 +2122,9 @@ void ABioSquadPlayer::eventMemberAdded ( int nIndex )
 
 bool ABioSquadPlayer::eventOnPlayerSwitchStance ( unsigned char FromState, unsigned char ToState )
 {
-	static UFunction* pFnOnPlayerSwitchStance = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPlayerSwitchStanceRef { L"Function SFXStrategicAI.BioSquadPlayer.OnPlayerSwitchStance", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPlayerSwitchStance )
-		pFnOnPlayerSwitchStance = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.OnPlayerSwitchStance" );
+	UFunction* const pFnOnPlayerSwitchStance = pFnOnPlayerSwitchStanceRef.Get ( );
 
 	ABioSquadPlayer_eventOnPlayerSwitchStance_Parms OnPlayerSwitchStance_Parms;
 	OnPlayerSwitchStance_Parms.FromState = FromState;
@@ -2296,10 +2143,9 @@ bool ABioSquadPlayer::eventOnPlayerSwitchStance ( unsigned char FromState, unsig
 
 void ABioSquadPlayer::eventOnSetAttackTarget ( class APawn* pPawn, class AActor* Target )
 {
-	static UFunction* pFnOnSetAttackTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnSetAttackTargetRef { L"Function SFXStrategicAI.BioSquadPlayer.OnSetAttackTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnSetAttackTarget )
-		pFnOnSetAttackTarget = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.OnSetAttackTarget" );
+	UFunction* const pFnOnSetAttackTarget = pFnOnSetAttackTargetRef.Get ( );
 
 	ABioSquadPlayer_eventOnSetAttackTarget_Parms OnSetAttackTarget_Parms;
 	OnSetAttackTarget_Parms.pPawn = pPawn;
@@ -2314,10 +2160,9 @@ void ABioSquadPlayer::eventOnSetAttackTarget ( class APawn* pPawn, class AActor*
 
 void ABioSquadPlayer::OnCombatEnd ( )
 {
-	static UFunction* pFnOnCombatEnd = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnCombatEndRef { L"Function SFXStrategicAI.BioSquadPlayer.OnCombatEnd", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnCombatEnd )
-		pFnOnCombatEnd = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.OnCombatEnd" );
+	UFunction* const pFnOnCombatEnd = pFnOnCombatEndRef.Get ( );
 
 	ABioSquadPlayer_execOnCombatEnd_Parms OnCombatEnd_Parms;
 
@@ -2330,10 +2175,9 @@ void ABioSquadPlayer::OnCombatEnd ( )
 
 void ABioSquadPlayer::OnCombatBegin ( )
 {
-	static UFunction* pFnOnCombatBegin = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnCombatBeginRef { L"Function SFXStrategicAI.BioSquadPlayer.OnCombatBegin", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnCombatBegin )
-		pFnOnCombatBegin = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.OnCombatBegin" );
+	UFunction* const pFnOnCombatBegin = pFnOnCombatBeginRef.Get ( );
 
 	ABioSquadPlayer_execOnCombatBegin_Parms OnCombatBegin_Parms;
 
@@ -2348,10 +2192,9 @@ void ABioSquadPlayer::OnCombatBegin ( )
 
 void ABioSquadPlayer::OnDeath ( class APawn* pPawn, class AController* pKiller )
 {
-	static UFunction* pFnOnDeath = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnDeathRef { L"Function SFXStrategicAI.BioSquadPlayer.OnDeath", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnDeath )
-		pFnOnDeath = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.OnDeath" );
+	UFunction* const pFnOnDeath = pFnOnDeathRef.Get ( );
 
 	ABioSquadPlayer_execOnDeath_Parms OnDeath_Parms;
 	OnDeath_Parms.pPawn = pPawn;
@@ -2369,10 +2212,9 @@ void ABioSquadPlayer::OnDeath ( class APawn* pPawn, class AController* pKiller )
 
 void ABioSquadPlayer::eventonMemberAbilityEnabledEvent ( class APawn* oPawn, unsigned char eEnableType, struct SFXName nmSubType )
 {
-	static UFunction* pFnonMemberAbilityEnabledEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnonMemberAbilityEnabledEventRef { L"Function SFXStrategicAI.BioSquadPlayer.onMemberAbilityEnabledEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnonMemberAbilityEnabledEvent )
-		pFnonMemberAbilityEnabledEvent = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.onMemberAbilityEnabledEvent" );
+	UFunction* const pFnonMemberAbilityEnabledEvent = pFnonMemberAbilityEnabledEventRef.Get ( );
 
 	ABioSquadPlayer_eventonMemberAbilityEnabledEvent_Parms onMemberAbilityEnabledEvent_Parms;
 	onMemberAbilityEnabledEvent_Parms.oPawn = oPawn;
@@ -2393,10 +2235,9 @@ void ABioSquadPlayer::eventonMemberAbilityEnabledEvent ( class APawn* oPawn, uns
 
 void ABioSquadPlayer::eventHearNoise ( class APawn* Who, float Loudness, class AActor* NoiseMaker, struct FVector const& vNoiseLocation, struct SFXName NoiseType )
 {
-	static UFunction* pFnHearNoise = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHearNoiseRef { L"Function SFXStrategicAI.BioSquadPlayer.HearNoise", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHearNoise )
-		pFnHearNoise = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.HearNoise" );
+	UFunction* const pFnHearNoise = pFnHearNoiseRef.Get ( );
 
 	ABioSquadPlayer_eventHearNoise_Parms HearNoise_Parms;
 	HearNoise_Parms.Who = Who;
@@ -2416,10 +2257,9 @@ void ABioSquadPlayer::eventHearNoise ( class APawn* Who, float Loudness, class A
 
 void ABioSquadPlayer::eventSeePlayer ( class APawn* Who, class APawn* Seen )
 {
-	static UFunction* pFnSeePlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSeePlayerRef { L"Function SFXStrategicAI.BioSquadPlayer.SeePlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSeePlayer )
-		pFnSeePlayer = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.SeePlayer" );
+	UFunction* const pFnSeePlayer = pFnSeePlayerRef.Get ( );
 
 	ABioSquadPlayer_eventSeePlayer_Parms SeePlayer_Parms;
 	SeePlayer_Parms.Who = Who;
@@ -2437,10 +2277,9 @@ void ABioSquadPlayer::eventSeePlayer ( class APawn* Who, class APawn* Seen )
 
 void ABioSquadPlayer::eventOnDamaged ( class APawn* oMember, class AController* oInstigator, float fDamage )
 {
-	static UFunction* pFnOnDamaged = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnDamagedRef { L"Function SFXStrategicAI.BioSquadPlayer.OnDamaged", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnDamaged )
-		pFnOnDamaged = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.OnDamaged" );
+	UFunction* const pFnOnDamaged = pFnOnDamagedRef.Get ( );
 
 	ABioSquadPlayer_eventOnDamaged_Parms OnDamaged_Parms;
 	OnDamaged_Parms.oMember = oMember;
@@ -2459,10 +2298,9 @@ void ABioSquadPlayer::eventOnDamaged ( class APawn* oMember, class AController*
 
 void ABioSquadPlayer::eventOnCastAt ( class APawn* oMember, class APawn* oAttacker, struct SFXName nmPower )
 {
-	static UFunction* pFnOnCastAt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnCastAtRef { L"Function SFXStrategicAI.BioSquadPlayer.OnCastAt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnCastAt )
-		pFnOnCastAt = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.OnCastAt" );
+	UFunction* const pFnOnCastAt = pFnOnCastAtRef.Get ( );
 
 	ABioSquadPlayer_eventOnCastAt_Parms OnCastAt_Parms;
 	OnCastAt_Parms.oMember = oMember;
@@ -2481,10 +2319,9 @@ void ABioSquadPlayer::eventOnCastAt ( class APawn* oMember, class APawn* oAttack
 
 void ABioSquadPlayer::eventOnAttacked ( class APawn* oMember, class APawn* oAttacker, struct SFXName nmWeapon )
 {
-	static UFunction* pFnOnAttacked = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAttackedRef { L"Function SFXStrategicAI.BioSquadPlayer.OnAttacked", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnAttacked )
-		pFnOnAttacked = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.OnAttacked" );
+	UFunction* const pFnOnAttacked = pFnOnAttackedRef.Get ( );
 
 	ABioSquadPlayer_eventOnAttacked_Parms OnAttacked_Parms;
 	OnAttacked_Parms.oMember = oMember;
@@ -2509,10 +2346,9 @@ void ABioSquadPlayer::eventOnAttacked ( class APawn* oMember, class APawn* oAtta
 
 void ABioSquadPlayer::eventMemberActionComplete_Combat ( class ABioPawn* Who, struct SFXName Action, struct SFXName nmTechnique, int nReason, class AActor* oLastTarget, float fReqStability, float fAbortStability, float fReqRadius, float fLastTimeOut )
 {
-	static UFunction* pFnMemberActionComplete_Combat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMemberActionComplete_CombatRef { L"Function SFXStrategicAI.BioSquadPlayer.MemberActionComplete_Combat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMemberActionComplete_Combat )
-		pFnMemberActionComplete_Combat = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.MemberActionComplete_Combat" );
+	UFunction* const pFnMemberActionComplete_Combat = pFnMemberActionComplete_CombatRef.Get ( );
 
 	ABioSquadPlayer_eventMemberActionComplete_Combat_Parms MemberActionComplete_Combat_Parms;
 	MemberActionComplete_Combat_Parms.Who = Who;
@@ -2536,10 +2372,9 @@ void ABioSquadPlayer::eventMemberActionComplete_Combat ( class ABioPawn* Who, st
 
 void ABioSquadPlayer::eventLeader_Changed ( class APawn* OldLeader, class APawn* NewLeader )
 {
-	static UFunction* pFnLeader_Changed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLeader_ChangedRef { L"Function SFXStrategicAI.BioSquadPlayer.Leader_Changed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLeader_Changed )
-		pFnLeader_Changed = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.Leader_Changed" );
+	UFunction* const pFnLeader_Changed = pFnLeader_ChangedRef.Get ( );
 
 	ABioSquadPlayer_eventLeader_Changed_Parms Leader_Changed_Parms;
 	Leader_Changed_Parms.OldLeader = OldLeader;
@@ -2554,10 +2389,9 @@ void ABioSquadPlayer::eventLeader_Changed ( class APawn* OldLeader, class APawn*
 
 void ABioSquadPlayer::eventInitialize ( )
 {
-	static UFunction* pFnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializeRef { L"Function SFXStrategicAI.BioSquadPlayer.Initialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitialize )
-		pFnInitialize = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.Initialize" );
+	UFunction* const pFnInitialize = pFnInitializeRef.Get ( );
 
 	ABioSquadPlayer_eventInitialize_Parms Initialize_Parms;
 
@@ -2572,10 +2406,9 @@ void ABioSquadPlayer::eventInitialize ( )
 
 class ABioPawn* ABioSquadPlayer::EvaluateTargets ( class ABioPawn* oMemberPawn )
 {
-	static UFunction* pFnEvaluateTargets = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvaluateTargetsRef { L"Function SFXStrategicAI.BioSquadPlayer.EvaluateTargets", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvaluateTargets )
-		pFnEvaluateTargets = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.EvaluateTargets" );
+	UFunction* const pFnEvaluateTargets = pFnEvaluateTargetsRef.Get ( );
 
 	ABioSquadPlayer_execEvaluateTargets_Parms EvaluateTargets_Parms;
 	EvaluateTargets_Parms.oMemberPawn = oMemberPawn;
@@ -2593,10 +2426,9 @@ class ABioPawn* ABioSquadPlayer::EvaluateTargets ( class ABioPawn* oMemberPawn )
 
 class ABioPawn* ABioSquadPlayer::PickNewTarget ( class ABioPawn* oMemberPawn )
 {
-	static UFunction* pFnPickNewTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPickNewTargetRef { L"Function SFXStrategicAI.BioSquadPlayer.PickNewTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPickNewTarget )
-		pFnPickNewTarget = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.PickNewTarget" );
+	UFunction* const pFnPickNewTarget = pFnPickNewTargetRef.Get ( );
 
 	ABioSquadPlayer_execPickNewTarget_Parms PickNewTarget_Parms;
 	PickNewTarget_Parms.oMemberPawn = oMemberPawn;
@@ -2616,10 +2448,9 @@ class ABioPawn* ABioSquadPlayer::PickNewTarget ( class ABioPawn* oMemberPawn )
 
 bool ABioSquadPlayer::IsAttackTargetValid ( class ABioPawn* oMemberPawn, class ABioPawn* oAttackTarget, unsigned long bTestShooting )
 {
-	static UFunction* pFnIsAttackTargetValid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsAttackTargetValidRef { L"Function SFXStrategicAI.BioSquadPlayer.IsAttackTargetValid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsAttackTargetValid )
-		pFnIsAttackTargetValid = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.IsAttackTargetValid" );
+	UFunction* const pFnIsAttackTargetValid = pFnIsAttackTargetValidRef.Get ( );
 
 	ABioSquadPlayer_execIsAttackTargetValid_Parms IsAttackTargetValid_Parms;
 	IsAttackTargetValid_Parms.oMemberPawn = oMemberPawn;
@@ -2638,10 +2469,9 @@ bool ABioSquadPlayer::IsAttackTargetValid ( class ABioPawn* oMemberPawn, class A
 
 void ABioSquadPlayer::DoBestAction ( class ABioAiController* oMember )
 {
-	static UFunction* pFnDoBestAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoBestActionRef { L"Function SFXStrategicAI.BioSquadPlayer.DoBestAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoBestAction )
-		pFnDoBestAction = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadPlayer.DoBestAction" );
+	UFunction* const pFnDoBestAction = pFnDoBestActionRef.Get ( );
 
 	ABioSquadPlayer_execDoBestAction_Parms DoBestAction_Parms;
 	DoBestAction_Parms.oMember = oMember;
@@ -2651,14 +2481,11 @@ void ABioSquadPlayer::DoBestAction ( class ABioAiController* oMember )
 
 
 
-class UClass* ABioSquadProxMine::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ABioSquadProxMine::pClassPointer { L"Class SFXStrategicAI.BioSquadProxMine", &UObject::FindClass };
 
 class UClass* ABioSquadProxMine::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioSquadProxMine" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXStrategicAI.BioSquadProxMine.CalculateLikelihoodArmed
@@ -2668,10 +2495,9 @@ class UClass* ABioSquadProxMine::StaticClass()
 
 float ABioSquadProxMine::CalculateLikelihoodArmed ( )
 {
-	static UFunction* pFnCalculateLikelihoodArmed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodArmedRef { L"Function SFXStrategicAI.BioSquadProxMine.CalculateLikelihoodArmed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihoodArmed )
-		pFnCalculateLikelihoodArmed = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadProxMine.CalculateLikelihoodArmed" );
+	UFunction* const pFnCalculateLikelihoodArmed = pFnCalculateLikelihoodArmedRef.Get ( );
 
 	ABioSquadProxMine_execCalculateLikelihoodArmed_Parms CalculateLikelihoodArmed_Parms;
 
@@ -2687,10 +2513,9 @@ float ABioSquadProxMine::CalculateLikelihoodArmed ( )
 
 void ABioSquadProxMine::SquadMemberBeginCasting ( class ABioAiController* oMember )
 {
-	static UFunction* pFnSquadMemberBeginCasting = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSquadMemberBeginCastingRef { L"Function SFXStrategicAI.BioSquadProxMine.SquadMemberBeginCasting", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSquadMemberBeginCasting )
-		pFnSquadMemberBeginCasting = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadProxMine.SquadMemberBeginCasting" );
+	UFunction* const pFnSquadMemberBeginCasting = pFnSquadMemberBeginCastingRef.Get ( );
 
 	ABioSquadProxMine_execSquadMemberBeginCasting_Parms SquadMemberBeginCasting_Parms;
 	SquadMemberBeginCasting_Parms.oMember = oMember;
@@ -2706,10 +2531,9 @@ void ABioSquadProxMine::SquadMemberBeginCasting ( class ABioAiController* oMembe
 
 float ABioSquadProxMine::CalculateLikelihood ( struct SFXName sStrategyName )
 {
-	static UFunction* pFnCalculateLikelihood = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodRef { L"Function SFXStrategicAI.BioSquadProxMine.CalculateLikelihood", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihood )
-		pFnCalculateLikelihood = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadProxMine.CalculateLikelihood" );
+	UFunction* const pFnCalculateLikelihood = pFnCalculateLikelihoodRef.Get ( );
 
 	ABioSquadProxMine_execCalculateLikelihood_Parms CalculateLikelihood_Parms;
 	memcpy ( &CalculateLikelihood_Parms.sStrategyName, &sStrategyName, 0x8 );
@@ -2721,14 +2545,11 @@ float ABioSquadProxMine::CalculateLikelihood ( struct SFXName sStrategyName )
 
 
 
-class UClass* ABioSquadSitAndShoot::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ABioSquadSitAndShoot::pClassPointer { L"Class SFXStrategicAI.BioSquadSitAndShoot", &UObject::FindClass };
 
 class UClass* ABioSquadSitAndShoot::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXStrategicAI.BioSquadSitAndShoot" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXStrategicAI.BioSquadSitAndShoot.CalculateLikelihoodAttacking
@@ -2738,10 +2559,9 @@ class UClass* ABioSquadSitAndShoot::StaticClass()
 
 float ABioSquadSitAndShoot::CalculateLikelihoodAttacking ( )
 {
-	static UFunction* pFnCalculateLikelihoodAttacking = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodAttackingRef { L"Function SFXStrategicAI.BioSquadSitAndShoot.CalculateLikelihoodAttacking", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihoodAttacking )
-		pFnCalculateLikelihoodAttacking = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadSitAndShoot.CalculateLikelihoodAttacking" );
+	UFunction* const pFnCalculateLikelihoodAttacking = pFnCalculateLikelihoodAttackingRef.Get ( );
 
 	ABioSquadSitAndShoot_execCalculateLikelihoodAttacking_Parms CalculateLikelihoodAttacking_Parms;
 
@@ -2758,10 +2578,9 @@ float ABioSquadSitAndShoot::CalculateLikelihoodAttacking ( )
 
 void ABioSquadSitAndShoot::SquadMemberAttackAnyTarget ( class ABioAiController* oMember, class APawn* oIgnore )
 {
-	static UFunction* pFnSquadMemberAttackAnyTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSquadMemberAttackAnyTargetRef { L"Function SFXStrategicAI.BioSquadSitAndShoot.SquadMemberAttackAnyTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSquadMemberAttackAnyTarget )
-		pFnSquadMemberAttackAnyTarget = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadSitAndShoot.SquadMemberAttackAnyTarget" );
+	UFunction* const pFnSquadMemberAttackAnyTarget = pFnSquadMemberAttackAnyTargetRef.Get ( );
 
 	ABioSquadSitAndShoot_execSquadMemberAttackAnyTarget_Parms SquadMemberAttackAnyTarget_Parms;
 	SquadMemberAttackAnyTarget_Parms.oMember = oMember;
@@ -2778,10 +2597,9 @@ void ABioSquadSitAndShoot::SquadMemberAttackAnyTarget ( class ABioAiController*
 
 void ABioSquadSitAndShoot::SquadMemberAttackTarget ( class ABioAiController* oMember, class APawn* oTarget )
 {
-	static UFunction* pFnSquadMemberAttackTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSquadMemberAttackTargetRef { L"Function SFXStrategicAI.BioSquadSitAndShoot.SquadMemberAttackTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSquadMemberAttackTarget )
-		pFnSquadMemberAttackTarget = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadSitAndShoot.SquadMemberAttackTarget" );
+	UFunction* const pFnSquadMemberAttackTarget = pFnSquadMemberAttackTargetRef.Get ( );
 
 	ABioSquadSitAndShoot_execSquadMemberAttackTarget_Parms SquadMemberAttackTarget_Parms;
 	SquadMemberAttackTarget_Parms.oMember = oMember;
@@ -2797,10 +2615,9 @@ void ABioSquadSitAndShoot::SquadMemberAttackTarget ( class ABioAiController* oMe
 
 float ABioSquadSitAndShoot::CalculateLikelihoodIdle ( )
 {
-	static UFunction* pFnCalculateLikelihoodIdle = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodIdleRef { L"Function SFXStrategicAI.BioSquadSitAndShoot.CalculateLikelihoodIdle", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihoodIdle )
-		pFnCalculateLikelihoodIdle = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadSitAndShoot.CalculateLikelihoodIdle" );
+	UFunction* const pFnCalculateLikelihoodIdle = pFnCalculateLikelihoodIdleRef.Get ( );
 
 	ABioSquadSitAndShoot_execCalculateLikelihoodIdle_Parms CalculateLikelihoodIdle_Parms;
 
@@ -2817,10 +2634,9 @@ float ABioSquadSitAndShoot::CalculateLikelihoodIdle ( )
 
 float ABioSquadSitAndShoot::CalculateLikelihood ( struct SFXName sStrategyName )
 {
-	static UFunction* pFnCalculateLikelihood = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalculateLikelihoodRef { L"Function SFXStrategicAI.BioSquadSitAndShoot.CalculateLikelihood", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalculateLikelihood )
-		pFnCalculateLikelihood = UObject::FindObject< UFunction > ( L"Function SFXStrategicAI.BioSquadSitAndShoot.CalculateLikelihood" );
+	UFunction* const pFnCalculateLikelihood = pFnCalculateLikelihoodRef.Get ( );
 
 	ABioSquadSitAndShoot_execCalculateLikelihood_Parms CalculateLikelihood_Parms;
 	memcpy ( &CalculateLikelihood_Parms.sStrategyName, &sStrategyName, 0x8 );
@@ -2832,6 +2648,162 @@ float ABioSquadSitAndShoot::CalculateLikelihood ( struct SFXName sStrategyName )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXStrategicAI.BioAI_SarenHopper",
+	L"Function SFXStrategicAI.BioAI_SarenHopper.OnDamaged",
+	L"Class SFXStrategicAI.BioBaseSquadDesign",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.OnProximityAlarm",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.OnSquadSeen",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.OnDamaged",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.OnCastAt",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.OnAttacked",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.OnDeath",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.SetHackedSquad",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.SetInitialState",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.OnActionComplete_Movement",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.MemberAdded",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.MemberRemoved",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.RemovePerceptionMultipliers",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.ApplyPerceptionMultipliers",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.ResetAttackedRecently",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.NoLongerSeePlayer",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.SeePlayer",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.OnFactionChanged",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.GetOrientationType",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.GetRestFormation",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.SquadWalkWaypoints",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.SquadMemberWalkWaypoints",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.GetNavPointInPlaypen",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.GetFlockingOffset",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.SetFlockingRanges",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.GetFurthestSquadMember",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.ResetSquadProximity",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.SetSquadProximityByAttackRange",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.SetSquadProximity",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.PushMoveWithLocking",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.SquadMemberTakeCover",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.IsAtDefenseNode",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.SquadTakeCover",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.PushCoverWithLocking",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.GetCoverList",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.UnlockAllPathnodes",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.UnlockPathnodesByOwner",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.UnlockPathnode",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.LockPathnode",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.IsPathnodeLocked",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.GetLockedPathNodes",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.GetCurrentMovePoint",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.DropAgitationIfNoHostile",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.UpgradeAgitationIfHostile",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.SetFactionByType",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.ClearAllSquadActions",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.CalculateAllLikelihoods",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.CalculateLikelihood",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.IsValidStrategy",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.GetStrategyList",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.ActivateAfterDelay",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.Activate",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.Deactivate",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.DoFallBackStrategy",
+	L"Function SFXStrategicAI.BioBaseSquadDesign.ReEvaluateStrategy",
+	L"Class SFXStrategicAI.BioFaction_Commoner",
+	L"Class SFXStrategicAI.BioFaction_Ambient",
+	L"Class SFXStrategicAI.BioFaction_Defender1",
+	L"Class SFXStrategicAI.BioFaction_Defender2",
+	L"Class SFXStrategicAI.BioFaction_Hostile1",
+	L"Class SFXStrategicAI.BioFaction_Hostile2",
+	L"Class SFXStrategicAI.BioBaseSquadDesignCombat",
+	L"Function SFXStrategicAI.BioBaseSquadDesignCombat.OnActionComplete_Combat",
+	L"Function SFXStrategicAI.BioBaseSquadDesignCombat.OnActionComplete_Movement",
+	L"Function SFXStrategicAI.BioBaseSquadDesignCombat.UseAttackCapability",
+	L"Function SFXStrategicAI.BioBaseSquadDesignCombat.FindDangerousEnemy",
+	L"Function SFXStrategicAI.BioBaseSquadDesignCombat.GetClosestPerceivedTarget",
+	L"Function SFXStrategicAI.BioBaseSquadDesignCombat.GetDistanceToNearestHostile",
+	L"Function SFXStrategicAI.BioBaseSquadDesignCombat.GetOrientationType",
+	L"Function SFXStrategicAI.BioBaseSquadDesignCombat.GetRestFormation",
+	L"Function SFXStrategicAI.BioBaseSquadDesignCombat.OnCastAt",
+	L"Function SFXStrategicAI.BioBaseSquadDesignCombat.OnAttacked",
+	L"Function SFXStrategicAI.BioBaseSquadDesignCombat.HearNoise",
+	L"Function SFXStrategicAI.BioBaseSquadDesignCombat.NoLongerSeePlayer",
+	L"Function SFXStrategicAI.BioBaseSquadDesignCombat.SeePlayer",
+	L"Function SFXStrategicAI.BioBaseSquadDesignCombat.SeenSquad",
+	L"Class SFXStrategicAI.BioFaction_CommonerPhysics",
+	L"Class SFXStrategicAI.BioForm_ScoutSwarm",
+	L"Class SFXStrategicAI.BioSeqAct_GetPropertyDesignSquad",
+	L"Class SFXStrategicAI.BioSeqAct_ModifyPropertyDesignSquad",
+	L"Class SFXStrategicAI.BioSquadAmbient",
+	L"Function SFXStrategicAI.BioSquadAmbient.CalculateLikelihoodFlee",
+	L"Function SFXStrategicAI.BioSquadAmbient.CalculateLikelihoodIdle",
+	L"Function SFXStrategicAI.BioSquadAmbient.CalculateLikelihood",
+	L"Class SFXStrategicAI.BioSquadBeacon",
+	L"Function SFXStrategicAI.BioSquadBeacon.CalculateLikelihoodCasting",
+	L"Function SFXStrategicAI.BioSquadBeacon.SquadMemberBeginCasting",
+	L"Function SFXStrategicAI.BioSquadBeacon.CalculateLikelihood",
+	L"Class SFXStrategicAI.BioSquadCombat",
+	L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodDefend",
+	L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodSkirmish",
+	L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodCharge",
+	L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodSearch",
+	L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihoodIdle",
+	L"Function SFXStrategicAI.BioSquadCombat.CalculateLikelihood",
+	L"Class SFXStrategicAI.BioSquadCommoner",
+	L"Function SFXStrategicAI.BioSquadCommoner.CalculateLikelihoodIdle",
+	L"Function SFXStrategicAI.BioSquadCommoner.CalculateLikelihood",
+	L"Class SFXStrategicAI.BioSquadPlayerDesignBase",
+	L"Function SFXStrategicAI.BioSquadPlayerDesignBase.OnSquadSeen",
+	L"Function SFXStrategicAI.BioSquadPlayerDesignBase.AreHostilesNearby",
+	L"Function SFXStrategicAI.BioSquadPlayerDesignBase.ClearMemberAttackCommand",
+	L"Function SFXStrategicAI.BioSquadPlayerDesignBase.ClearPerceptionFlag",
+	L"Function SFXStrategicAI.BioSquadPlayerDesignBase.SetPerceptionFlag",
+	L"Class SFXStrategicAI.BioSquadPlayer",
+	L"Function SFXStrategicAI.BioSquadPlayer.Tick",
+	L"Function SFXStrategicAI.BioSquadPlayer.onPlayerEnterCover",
+	L"Function SFXStrategicAI.BioSquadPlayer.onMemberArrivedAtTarget",
+	L"Function SFXStrategicAI.BioSquadPlayer.LookForCover",
+	L"Function SFXStrategicAI.BioSquadPlayer.OnSetSquadFollowFormation",
+	L"Function SFXStrategicAI.BioSquadPlayer.OnMemberShieldsDown",
+	L"Function SFXStrategicAI.BioSquadPlayer.MemberAdded",
+	L"Function SFXStrategicAI.BioSquadPlayer.OnPlayerSwitchStance",
+	L"Function SFXStrategicAI.BioSquadPlayer.OnSetAttackTarget",
+	L"Function SFXStrategicAI.BioSquadPlayer.OnCombatEnd",
+	L"Function SFXStrategicAI.BioSquadPlayer.OnCombatBegin",
+	L"Function SFXStrategicAI.BioSquadPlayer.OnDeath",
+	L"Function SFXStrategicAI.BioSquadPlayer.onMemberAbilityEnabledEvent",
+	L"Function SFXStrategicAI.BioSquadPlayer.HearNoise",
+	L"Function SFXStrategicAI.BioSquadPlayer.SeePlayer",
+	L"Function SFXStrategicAI.BioSquadPlayer.OnDamaged",
+	L"Function SFXStrategicAI.BioSquadPlayer.OnCastAt",
+	L"Function SFXStrategicAI.BioSquadPlayer.OnAttacked",
+	L"Function SFXStrategicAI.BioSquadPlayer.MemberActionComplete_Combat",
+	L"Function SFXStrategicAI.BioSquadPlayer.Leader_Changed",
+	L"Function SFXStrategicAI.BioSquadPlayer.Initialize",
+	L"Function SFXStrategicAI.BioSquadPlayer.EvaluateTargets",
+	L"Function SFXStrategicAI.BioSquadPlayer.PickNewTarget",
+	L"Function SFXStrategicAI.BioSquadPlayer.IsAttackTargetValid",
+	L"Function SFXStrategicAI.BioSquadPlayer.DoBestAction",
+	L"Class SFXStrategicAI.BioSquadProxMine",
+	L"Function SFXStrategicAI.BioSquadProxMine.CalculateLikelihoodArmed",
+	L"Function SFXStrategicAI.BioSquadProxMine.SquadMemberBeginCasting",
+	L"Function SFXStrategicAI.BioSquadProxMine.CalculateLikelihood",
+	L"Class SFXStrategicAI.BioSquadSitAndShoot",
+	L"Function SFXStrategicAI.BioSquadSitAndShoot.CalculateLikelihoodAttacking",
+	L"Function SFXStrategicAI.BioSquadSitAndShoot.SquadMemberAttackAnyTarget",
+	L"Function SFXStrategicAI.BioSquadSitAndShoot.SquadMemberAttackTarget",
+	L"Function SFXStrategicAI.BioSquadSitAndShoot.CalculateLikelihoodIdle",
+	L"Function SFXStrategicAI.BioSquadSitAndShoot.CalculateLikelihood",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
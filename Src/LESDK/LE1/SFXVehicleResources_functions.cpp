@@ -28,18 +28,30 @@
 
 
 
-class UClass* UBioVehicleResources::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioVehicleResources::pClassPointer { L"Class SFXVehicleResources.BioVehicleResources", &UObject::FindClass };
 
 class UClass* UBioVehicleResources::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXVehicleResources.BioVehicleResources" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXVehicleResources.BioVehicleResources",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
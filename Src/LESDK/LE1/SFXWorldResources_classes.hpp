@@ -52,7 +52,7 @@ public:
 	TArray<class UBioVISFootstep*>                     lstVISFootstep;                                   		// 0x00A0 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
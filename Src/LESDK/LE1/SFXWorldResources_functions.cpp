@@ -28,18 +28,30 @@
 
 
 
-class UClass* UBioWorldResources::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioWorldResources::pClassPointer { L"Class SFXWorldResources.BioWorldResources", &UObject::FindClass };
 
 class UClass* UBioWorldResources::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXWorldResources.BioWorldResources" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXWorldResources.BioWorldResources",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
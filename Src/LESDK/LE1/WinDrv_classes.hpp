@@ -52,7 +52,7 @@ public:
 	unsigned char                                      UnknownData02[ 0x10 ];                            		// 0x024C (0x0010) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -66,7 +66,7 @@ class UXnaForceFeedbackManager : public UForceFeedbackManager
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
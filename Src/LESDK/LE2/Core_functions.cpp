@@ -30,6 +30,10 @@
 */
 
 class TArray<class UObject*>* UObject::GObjObjects = nullptr;
+::LESDK::TObjectIndex<UObject, UClass> UObject::GObjIndex{};
+::LESDK::TClassHierarchy<UObject, UClass> UObject::GClassHierarchy{};
+::LESDK::TObjectBuckets<UObject, UClass> UObject::GObjBuckets{};
+::LESDK::FObjectSerials UObject::GObjSerials{};
 
 void UObject::AppendName(FStringView& OutString, SFXName::FormatMode const Mode) const {
     ::LESDK::AppendObjectName(this, OutString, Mode);
@@ -119,29 +123,15 @@ FString const& UObject::StaticFullName() const {
 
 UClass* UObject::FindClass ( wchar_t const* ClassFullName )
 {
-    for ( int i = 0; i < (int)UObject::GObjObjects->Count(); ++i )
-    {
-        UObject* Object = UObject::GObjObjects->GetData()[ i ];
-
-        if ( ! Object )
-            continue;
-
-        if ( Object->StaticFullName().Equals ( ClassFullName, true ) )
-            return (UClass*) Object;
-    }
-
-    return NULL;
+    // The query is parsed and resolved into SFXNames once, candidates are then
+    // matched by walking their outers, see LESDK/Common/ObjectIndex.hpp.
+    return (UClass*) UObject::GObjIndex.Find ( *UObject::GObjObjects, ClassFullName );
 }
 
 bool UObject::IsA ( UClass* pClass ) const
 {
-    for ( UClass* SuperClass = this->Class; SuperClass; SuperClass = ( UClass* ) SuperClass->SuperField )
-    {
-        if ( SuperClass == pClass )
-            return true;
-    }
-
-    return false;
+    // Depth and ancestor lookup instead of a SuperField walk, see LESDK/Common/ClassHierarchy.hpp.
+    return UObject::GClassHierarchy.IsA ( this, pClass );
 }
 
 /*
@@ -152,26 +142,20 @@ bool UObject::IsA ( UClass* pClass ) const
 
 
 
-class UClass* UTextBuffer::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UTextBuffer::pClassPointer { L"Class Core.TextBuffer", &UObject::FindClass };
 
 class UClass* UTextBuffer::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.TextBuffer" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UObject::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UObject::pClassPointer { L"Class Core.Object", &UObject::FindClass };
 
 class UClass* UObject::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Object" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function Core.Object.GetNetIndex
@@ -181,18 +165,14 @@ class UClass* UObject::StaticClass()
 
 int UObject::GetNetIndex ( )
 {
-	static UFunction* pFnGetNetIndex = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetNetIndexRef { L"Function Core.Object.GetNetIndex", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetNetIndex )
-		pFnGetNetIndex = UObject::FindObject< UFunction > ( L"Function Core.Object.GetNetIndex" );
+	UFunction* const pFnGetNetIndex = pFnGetNetIndexRef.Get ( );
 
 	UObject_execGetNetIndex_Parms GetNetIndex_Parms;
 
-	pFnGetNetIndex->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetNetIndex, &GetNetIndex_Parms, NULL );
-
-	pFnGetNetIndex->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetNetIndex, &GetNetIndex_Parms ) )
+		this->ProcessEvent ( pFnGetNetIndex, &GetNetIndex_Parms, NULL );
 
 	return GetNetIndex_Parms.ReturnValue;
 };
@@ -204,19 +184,15 @@ int UObject::GetNetIndex ( )
 
 void UObject::appScreenDebugMessage ( FString const& sMsg )
 {
-	static UFunction* pFnappScreenDebugMessage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnappScreenDebugMessageRef { L"Function Core.Object.appScreenDebugMessage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnappScreenDebugMessage )
-		pFnappScreenDebugMessage = UObject::FindObject< UFunction > ( L"Function Core.Object.appScreenDebugMessage" );
+	UFunction* const pFnappScreenDebugMessage = pFnappScreenDebugMessageRef.Get ( );
 
 	UObject_execappScreenDebugMessage_Parms appScreenDebugMessage_Parms;
 	memcpy ( &appScreenDebugMessage_Parms.sMsg, &sMsg, 0x10 );
 
-	pFnappScreenDebugMessage->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnappScreenDebugMessage, &appScreenDebugMessage_Parms, NULL );
-
-	pFnappScreenDebugMessage->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnappScreenDebugMessage, &appScreenDebugMessage_Parms ) )
+		this->ProcessEvent ( pFnappScreenDebugMessage, &appScreenDebugMessage_Parms, NULL );
 };
 
 // Function Core.Object.GetSystemTime
@@ -233,10 +209,9 @@ void UObject::appScreenDebugMessage ( FString const& sMsg )
 
 void UObject::GetSystemTime ( int* Year, int* Month, int* DayOfWeek, int* Day, int* Hour, int* Min, int* Sec, int* MSec )
 {
-	static UFunction* pFnGetSystemTime = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetSystemTimeRef { L"Function Core.Object.GetSystemTime", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetSystemTime )
-		pFnGetSystemTime = UObject::FindObject< UFunction > ( L"Function Core.Object.GetSystemTime" );
+	UFunction* const pFnGetSystemTime = pFnGetSystemTimeRef.Get ( );
 
 	UObject_execGetSystemTime_Parms GetSystemTime_Parms;
 
@@ -264,11 +239,8 @@ void UObject::GetSystemTime ( int* Year, int* Month, int* DayOfWeek, int* Day, i
 	if ( MSec )
 		GetSystemTime_Parms.MSec = *MSec;
 
-	pFnGetSystemTime->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetSystemTime, &GetSystemTime_Parms, NULL );
-
-	pFnGetSystemTime->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetSystemTime, &GetSystemTime_Parms ) )
+		this->ProcessEvent ( pFnGetSystemTime, &GetSystemTime_Parms, NULL );
 
 	if ( Year )
 		*Year = GetSystemTime_Parms.Year;
@@ -302,18 +274,14 @@ void UObject::GetSystemTime ( int* Year, int* Month, int* DayOfWeek, int* Day, i
 
 FString UObject::TimeStamp ( )
 {
-	static UFunction* pFnTimeStamp = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTimeStampRef { L"Function Core.Object.TimeStamp", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTimeStamp )
-		pFnTimeStamp = UObject::FindObject< UFunction > ( L"Function Core.Object.TimeStamp" );
+	UFunction* const pFnTimeStamp = pFnTimeStampRef.Get ( );
 
 	UObject_execTimeStamp_Parms TimeStamp_Parms;
 
-	pFnTimeStamp->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnTimeStamp, &TimeStamp_Parms, NULL );
-
-	pFnTimeStamp->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnTimeStamp, &TimeStamp_Parms ) )
+		this->ProcessEvent ( pFnTimeStamp, &TimeStamp_Parms, NULL );
 
 	return TimeStamp_Parms.ReturnValue;
 };
@@ -328,21 +296,17 @@ FString UObject::TimeStamp ( )
 
 struct FVector UObject::TransformVectorByRotation ( struct FRotator const& SourceRotation, struct FVector const& SourceVector, unsigned long bInverse )
 {
-	static UFunction* pFnTransformVectorByRotation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTransformVectorByRotationRef { L"Function Core.Object.TransformVectorByRotation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTransformVectorByRotation )
-		pFnTransformVectorByRotation = UObject::FindObject< UFunction > ( L"Function Core.Object.TransformVectorByRotation" );
+	UFunction* const pFnTransformVectorByRotation = pFnTransformVectorByRotationRef.Get ( );
 
 	UObject_execTransformVectorByRotation_Parms TransformVectorByRotation_Parms;
 	memcpy ( &TransformVectorByRotation_Parms.SourceRotation, &SourceRotation, 0xC );
 	memcpy ( &TransformVectorByRotation_Parms.SourceVector, &SourceVector, 0xC );
 	TransformVectorByRotation_Parms.bInverse = bInverse;
 
-	pFnTransformVectorByRotation->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnTransformVectorByRotation, &TransformVectorByRotation_Parms, NULL );
-
-	pFnTransformVectorByRotation->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnTransformVectorByRotation, &TransformVectorByRotation_Parms ) )
+		this->ProcessEvent ( pFnTransformVectorByRotation, &TransformVectorByRotation_Parms, NULL );
 
 	return TransformVectorByRotation_Parms.ReturnValue;
 };
@@ -354,10 +318,9 @@ struct FVector UObject::TransformVectorByRotation ( struct FRotator const& Sourc
 
 struct SFXName UObject::GetPackageName ( )
 {
-	static UFunction* pFnGetPackageName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPackageNameRef { L"Function Core.Object.GetPackageName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPackageName )
-		pFnGetPackageName = UObject::FindObject< UFunction > ( L"Function Core.Object.GetPackageName" );
+	UFunction* const pFnGetPackageName = pFnGetPackageNameRef.Get ( );
 
 	UObject_execGetPackageName_Parms GetPackageName_Parms;
 
@@ -373,18 +336,14 @@ struct SFXName UObject::GetPackageName ( )
 
 bool UObject::IsPendingKill ( )
 {
-	static UFunction* pFnIsPendingKill = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsPendingKillRef { L"Function Core.Object.IsPendingKill", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsPendingKill )
-		pFnIsPendingKill = UObject::FindObject< UFunction > ( L"Function Core.Object.IsPendingKill" );
+	UFunction* const pFnIsPendingKill = pFnIsPendingKillRef.Get ( );
 
 	UObject_execIsPendingKill_Parms IsPendingKill_Parms;
 
-	pFnIsPendingKill->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsPendingKill, &IsPendingKill_Parms, NULL );
-
-	pFnIsPendingKill->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsPendingKill, &IsPendingKill_Parms ) )
+		this->ProcessEvent ( pFnIsPendingKill, &IsPendingKill_Parms, NULL );
 
 	return IsPendingKill_Parms.ReturnValue;
 };
@@ -398,10 +357,9 @@ bool UObject::IsPendingKill ( )
 
 float UObject::ByteToFloat ( unsigned char inputByte, unsigned long bSigned )
 {
-	static UFunction* pFnByteToFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnByteToFloatRef { L"Function Core.Object.ByteToFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnByteToFloat )
-		pFnByteToFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.ByteToFloat" );
+	UFunction* const pFnByteToFloat = pFnByteToFloatRef.Get ( );
 
 	UObject_execByteToFloat_Parms ByteToFloat_Parms;
 	ByteToFloat_Parms.inputByte = inputByte;
@@ -421,10 +379,9 @@ float UObject::ByteToFloat ( unsigned char inputByte, unsigned long bSigned )
 
 unsigned char UObject::FloatToByte ( float inputFloat, unsigned long bSigned )
 {
-	static UFunction* pFnFloatToByte = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFloatToByteRef { L"Function Core.Object.FloatToByte", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFloatToByte )
-		pFnFloatToByte = UObject::FindObject< UFunction > ( L"Function Core.Object.FloatToByte" );
+	UFunction* const pFnFloatToByte = pFnFloatToByteRef.Get ( );
 
 	UObject_execFloatToByte_Parms FloatToByte_Parms;
 	FloatToByte_Parms.inputFloat = inputFloat;
@@ -443,10 +400,9 @@ unsigned char UObject::FloatToByte ( float inputFloat, unsigned long bSigned )
 
 float UObject::UnwindHeading ( float A )
 {
-	static UFunction* pFnUnwindHeading = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnwindHeadingRef { L"Function Core.Object.UnwindHeading", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnwindHeading )
-		pFnUnwindHeading = UObject::FindObject< UFunction > ( L"Function Core.Object.UnwindHeading" );
+	UFunction* const pFnUnwindHeading = pFnUnwindHeadingRef.Get ( );
 
 	UObject_execUnwindHeading_Parms UnwindHeading_Parms;
 	UnwindHeading_Parms.A = A;
@@ -465,10 +421,9 @@ float UObject::UnwindHeading ( float A )
 
 float UObject::FindDeltaAngle ( float A1, float A2 )
 {
-	static UFunction* pFnFindDeltaAngle = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFindDeltaAngleRef { L"Function Core.Object.FindDeltaAngle", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFindDeltaAngle )
-		pFnFindDeltaAngle = UObject::FindObject< UFunction > ( L"Function Core.Object.FindDeltaAngle" );
+	UFunction* const pFnFindDeltaAngle = pFnFindDeltaAngleRef.Get ( );
 
 	UObject_execFindDeltaAngle_Parms FindDeltaAngle_Parms;
 	FindDeltaAngle_Parms.A1 = A1;
@@ -487,10 +442,9 @@ float UObject::FindDeltaAngle ( float A1, float A2 )
 
 float UObject::GetHeadingAngle ( struct FVector const& Dir )
 {
-	static UFunction* pFnGetHeadingAngle = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetHeadingAngleRef { L"Function Core.Object.GetHeadingAngle", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetHeadingAngle )
-		pFnGetHeadingAngle = UObject::FindObject< UFunction > ( L"Function Core.Object.GetHeadingAngle" );
+	UFunction* const pFnGetHeadingAngle = pFnGetHeadingAngleRef.Get ( );
 
 	UObject_execGetHeadingAngle_Parms GetHeadingAngle_Parms;
 	memcpy ( &GetHeadingAngle_Parms.Dir, &Dir, 0xC );
@@ -507,10 +461,9 @@ float UObject::GetHeadingAngle ( struct FVector const& Dir )
 
 void UObject::GetAngularDegreesFromRadians ( struct FVector2D* OutFOV )
 {
-	static UFunction* pFnGetAngularDegreesFromRadians = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAngularDegreesFromRadiansRef { L"Function Core.Object.GetAngularDegreesFromRadians", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAngularDegreesFromRadians )
-		pFnGetAngularDegreesFromRadians = UObject::FindObject< UFunction > ( L"Function Core.Object.GetAngularDegreesFromRadians" );
+	UFunction* const pFnGetAngularDegreesFromRadians = pFnGetAngularDegreesFromRadiansRef.Get ( );
 
 	UObject_execGetAngularDegreesFromRadians_Parms GetAngularDegreesFromRadians_Parms;
 
@@ -531,10 +484,9 @@ void UObject::GetAngularDegreesFromRadians ( struct FVector2D* OutFOV )
 
 void UObject::GetAngularFromDotDist ( struct FVector2D const& DotDist, struct FVector2D* OutAngDist )
 {
-	static UFunction* pFnGetAngularFromDotDist = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAngularFromDotDistRef { L"Function Core.Object.GetAngularFromDotDist", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAngularFromDotDist )
-		pFnGetAngularFromDotDist = UObject::FindObject< UFunction > ( L"Function Core.Object.GetAngularFromDotDist" );
+	UFunction* const pFnGetAngularFromDotDist = pFnGetAngularFromDotDistRef.Get ( );
 
 	UObject_execGetAngularFromDotDist_Parms GetAngularFromDotDist_Parms;
 	memcpy ( &GetAngularFromDotDist_Parms.DotDist, &DotDist, 0x8 );
@@ -542,11 +494,8 @@ void UObject::GetAngularFromDotDist ( struct FVector2D const& DotDist, struct FV
 	if ( OutAngDist )
 		memcpy ( &GetAngularFromDotDist_Parms.OutAngDist, OutAngDist, 0x8 );
 
-	pFnGetAngularFromDotDist->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAngularFromDotDist, &GetAngularFromDotDist_Parms, NULL );
-
-	pFnGetAngularFromDotDist->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAngularFromDotDist, &GetAngularFromDotDist_Parms ) )
+		this->ProcessEvent ( pFnGetAngularFromDotDist, &GetAngularFromDotDist_Parms, NULL );
 
 	if ( OutAngDist )
 		memcpy ( OutAngDist, &GetAngularFromDotDist_Parms.OutAngDist, 0x8 );
@@ -564,10 +513,9 @@ void UObject::GetAngularFromDotDist ( struct FVector2D const& DotDist, struct FV
 
 bool UObject::GetAngularDistance ( struct FVector const& Direction, struct FVector const& AxisX, struct FVector const& AxisY, struct FVector const& AxisZ, struct FVector2D* OutAngularDist )
 {
-	static UFunction* pFnGetAngularDistance = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAngularDistanceRef { L"Function Core.Object.GetAngularDistance", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAngularDistance )
-		pFnGetAngularDistance = UObject::FindObject< UFunction > ( L"Function Core.Object.GetAngularDistance" );
+	UFunction* const pFnGetAngularDistance = pFnGetAngularDistanceRef.Get ( );
 
 	UObject_execGetAngularDistance_Parms GetAngularDistance_Parms;
 	memcpy ( &GetAngularDistance_Parms.Direction, &Direction, 0xC );
@@ -578,11 +526,8 @@ bool UObject::GetAngularDistance ( struct FVector const& Direction, struct FVect
 	if ( OutAngularDist )
 		memcpy ( &GetAngularDistance_Parms.OutAngularDist, OutAngularDist, 0x8 );
 
-	pFnGetAngularDistance->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAngularDistance, &GetAngularDistance_Parms, NULL );
-
-	pFnGetAngularDistance->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAngularDistance, &GetAngularDistance_Parms ) )
+		this->ProcessEvent ( pFnGetAngularDistance, &GetAngularDistance_Parms, NULL );
 
 	if ( OutAngularDist )
 		memcpy ( OutAngularDist, &GetAngularDistance_Parms.OutAngularDist, 0x8 );
@@ -602,10 +547,9 @@ bool UObject::GetAngularDistance ( struct FVector const& Direction, struct FVect
 
 bool UObject::GetDotDistance ( struct FVector const& Direction, struct FVector const& AxisX, struct FVector const& AxisY, struct FVector const& AxisZ, struct FVector2D* OutDotDist )
 {
-	static UFunction* pFnGetDotDistance = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDotDistanceRef { L"Function Core.Object.GetDotDistance", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDotDistance )
-		pFnGetDotDistance = UObject::FindObject< UFunction > ( L"Function Core.Object.GetDotDistance" );
+	UFunction* const pFnGetDotDistance = pFnGetDotDistanceRef.Get ( );
 
 	UObject_execGetDotDistance_Parms GetDotDistance_Parms;
 	memcpy ( &GetDotDistance_Parms.Direction, &Direction, 0xC );
@@ -616,11 +560,8 @@ bool UObject::GetDotDistance ( struct FVector const& Direction, struct FVector c
 	if ( OutDotDist )
 		memcpy ( &GetDotDistance_Parms.OutDotDist, OutDotDist, 0x8 );
 
-	pFnGetDotDistance->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetDotDistance, &GetDotDistance_Parms, NULL );
-
-	pFnGetDotDistance->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetDotDistance, &GetDotDistance_Parms ) )
+		this->ProcessEvent ( pFnGetDotDistance, &GetDotDistance_Parms, NULL );
 
 	if ( OutDotDist )
 		memcpy ( OutDotDist, &GetDotDistance_Parms.OutDotDist, 0x8 );
@@ -639,10 +580,9 @@ bool UObject::GetDotDistance ( struct FVector const& Direction, struct FVector c
 
 struct FVector UObject::PointProjectToPlane ( struct FVector const& Point, struct FVector const& A, struct FVector const& B, struct FVector const& C )
 {
-	static UFunction* pFnPointProjectToPlane = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPointProjectToPlaneRef { L"Function Core.Object.PointProjectToPlane", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPointProjectToPlane )
-		pFnPointProjectToPlane = UObject::FindObject< UFunction > ( L"Function Core.Object.PointProjectToPlane" );
+	UFunction* const pFnPointProjectToPlane = pFnPointProjectToPlaneRef.Get ( );
 
 	UObject_execPointProjectToPlane_Parms PointProjectToPlane_Parms;
 	memcpy ( &PointProjectToPlane_Parms.Point, &Point, 0xC );
@@ -650,11 +590,8 @@ struct FVector UObject::PointProjectToPlane ( struct FVector const& Point, struc
 	memcpy ( &PointProjectToPlane_Parms.B, &B, 0xC );
 	memcpy ( &PointProjectToPlane_Parms.C, &C, 0xC );
 
-	pFnPointProjectToPlane->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnPointProjectToPlane, &PointProjectToPlane_Parms, NULL );
-
-	pFnPointProjectToPlane->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnPointProjectToPlane, &PointProjectToPlane_Parms ) )
+		this->ProcessEvent ( pFnPointProjectToPlane, &PointProjectToPlane_Parms, NULL );
 
 	return PointProjectToPlane_Parms.ReturnValue;
 };
@@ -670,10 +607,9 @@ struct FVector UObject::PointProjectToPlane ( struct FVector const& Point, struc
 
 float UObject::PointDistToPlane ( struct FVector const& Point, struct FRotator const& Orientation, struct FVector const& Origin, struct FVector* out_ClosestPoint )
 {
-	static UFunction* pFnPointDistToPlane = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPointDistToPlaneRef { L"Function Core.Object.PointDistToPlane", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPointDistToPlane )
-		pFnPointDistToPlane = UObject::FindObject< UFunction > ( L"Function Core.Object.PointDistToPlane" );
+	UFunction* const pFnPointDistToPlane = pFnPointDistToPlaneRef.Get ( );
 
 	UObject_execPointDistToPlane_Parms PointDistToPlane_Parms;
 	memcpy ( &PointDistToPlane_Parms.Point, &Point, 0xC );
@@ -702,10 +638,9 @@ float UObject::PointDistToPlane ( struct FVector const& Point, struct FRotator c
 
 float UObject::PointDistToSegment ( struct FVector const& Point, struct FVector const& StartPoint, struct FVector const& EndPoint, struct FVector* OutClosestPoint )
 {
-	static UFunction* pFnPointDistToSegment = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPointDistToSegmentRef { L"Function Core.Object.PointDistToSegment", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPointDistToSegment )
-		pFnPointDistToSegment = UObject::FindObject< UFunction > ( L"Function Core.Object.PointDistToSegment" );
+	UFunction* const pFnPointDistToSegment = pFnPointDistToSegmentRef.Get ( );
 
 	UObject_execPointDistToSegment_Parms PointDistToSegment_Parms;
 	memcpy ( &PointDistToSegment_Parms.Point, &Point, 0xC );
@@ -715,11 +650,8 @@ float UObject::PointDistToSegment ( struct FVector const& Point, struct FVector
 	if ( OutClosestPoint )
 		memcpy ( &PointDistToSegment_Parms.OutClosestPoint, OutClosestPoint, 0xC );
 
-	pFnPointDistToSegment->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnPointDistToSegment, &PointDistToSegment_Parms, NULL );
-
-	pFnPointDistToSegment->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnPointDistToSegment, &PointDistToSegment_Parms ) )
+		this->ProcessEvent ( pFnPointDistToSegment, &PointDistToSegment_Parms, NULL );
 
 	if ( OutClosestPoint )
 		memcpy ( OutClosestPoint, &PointDistToSegment_Parms.OutClosestPoint, 0xC );
@@ -738,10 +670,9 @@ float UObject::PointDistToSegment ( struct FVector const& Point, struct FVector
 
 float UObject::PointDistToLine ( struct FVector const& Point, struct FVector const& Line, struct FVector const& Origin, struct FVector* OutClosestPoint )
 {
-	static UFunction* pFnPointDistToLine = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPointDistToLineRef { L"Function Core.Object.PointDistToLine", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPointDistToLine )
-		pFnPointDistToLine = UObject::FindObject< UFunction > ( L"Function Core.Object.PointDistToLine" );
+	UFunction* const pFnPointDistToLine = pFnPointDistToLineRef.Get ( );
 
 	UObject_execPointDistToLine_Parms PointDistToLine_Parms;
 	memcpy ( &PointDistToLine_Parms.Point, &Point, 0xC );
@@ -751,11 +682,8 @@ float UObject::PointDistToLine ( struct FVector const& Point, struct FVector con
 	if ( OutClosestPoint )
 		memcpy ( &PointDistToLine_Parms.OutClosestPoint, OutClosestPoint, 0xC );
 
-	pFnPointDistToLine->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnPointDistToLine, &PointDistToLine_Parms, NULL );
-
-	pFnPointDistToLine->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnPointDistToLine, &PointDistToLine_Parms ) )
+		this->ProcessEvent ( pFnPointDistToLine, &PointDistToLine_Parms, NULL );
 
 	if ( OutClosestPoint )
 		memcpy ( OutClosestPoint, &PointDistToLine_Parms.OutClosestPoint, 0xC );
@@ -774,10 +702,9 @@ float UObject::PointDistToLine ( struct FVector const& Point, struct FVector con
 
 bool UObject::GetPerObjectConfigSections ( class UClass* SearchClass, class UObject* ObjectOuter, int MaxResults, TArray<FString>* out_SectionNames )
 {
-	static UFunction* pFnGetPerObjectConfigSections = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPerObjectConfigSectionsRef { L"Function Core.Object.GetPerObjectConfigSections", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPerObjectConfigSections )
-		pFnGetPerObjectConfigSections = UObject::FindObject< UFunction > ( L"Function Core.Object.GetPerObjectConfigSections" );
+	UFunction* const pFnGetPerObjectConfigSections = pFnGetPerObjectConfigSectionsRef.Get ( );
 
 	UObject_execGetPerObjectConfigSections_Parms GetPerObjectConfigSections_Parms;
 	GetPerObjectConfigSections_Parms.SearchClass = SearchClass;
@@ -787,11 +714,8 @@ bool UObject::GetPerObjectConfigSections ( class UClass* SearchClass, class UObj
 	if ( out_SectionNames )
 		memcpy ( &GetPerObjectConfigSections_Parms.out_SectionNames, out_SectionNames, 0x10 );
 
-	pFnGetPerObjectConfigSections->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetPerObjectConfigSections, &GetPerObjectConfigSections_Parms, NULL );
-
-	pFnGetPerObjectConfigSections->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetPerObjectConfigSections, &GetPerObjectConfigSections_Parms ) )
+		this->ProcessEvent ( pFnGetPerObjectConfigSections, &GetPerObjectConfigSections_Parms, NULL );
 
 	if ( out_SectionNames )
 		memcpy ( out_SectionNames, &GetPerObjectConfigSections_Parms.out_SectionNames, 0x10 );
@@ -805,18 +729,14 @@ bool UObject::GetPerObjectConfigSections ( class UClass* SearchClass, class UObj
 
 void UObject::StaticSaveConfig ( )
 {
-	static UFunction* pFnStaticSaveConfig = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStaticSaveConfigRef { L"Function Core.Object.StaticSaveConfig", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStaticSaveConfig )
-		pFnStaticSaveConfig = UObject::FindObject< UFunction > ( L"Function Core.Object.StaticSaveConfig" );
+	UFunction* const pFnStaticSaveConfig = pFnStaticSaveConfigRef.Get ( );
 
 	UObject_execStaticSaveConfig_Parms StaticSaveConfig_Parms;
 
-	pFnStaticSaveConfig->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnStaticSaveConfig, &StaticSaveConfig_Parms, NULL );
-
-	pFnStaticSaveConfig->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnStaticSaveConfig, &StaticSaveConfig_Parms ) )
+		this->ProcessEvent ( pFnStaticSaveConfig, &StaticSaveConfig_Parms, NULL );
 };
 
 // Function Core.Object.SaveConfig
@@ -825,23 +745,14 @@ void UObject::StaticSaveConfig ( )
 
 void UObject::SaveConfig ( )
 {
-	static UFunction* pFnSaveConfig = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSaveConfigRef { L"Function Core.Object.SaveConfig", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSaveConfig )
-		pFnSaveConfig = UObject::FindObject< UFunction > ( L"Function Core.Object.SaveConfig" );
+	UFunction* const pFnSaveConfig = pFnSaveConfigRef.Get ( );
 
 	UObject_execSaveConfig_Parms SaveConfig_Parms;
 
-	unsigned short NativeIndex = pFnSaveConfig->iNative;
-	pFnSaveConfig->iNative = 0;
-
-	pFnSaveConfig->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSaveConfig, &SaveConfig_Parms, NULL );
-
-	pFnSaveConfig->FunctionFlags |= 0x400;
-
-	pFnSaveConfig->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSaveConfig, &SaveConfig_Parms ) )
+		this->ProcessEvent ( pFnSaveConfig, &SaveConfig_Parms, NULL );
 };
 
 // Function Core.Object.FindObject
@@ -853,20 +764,16 @@ void UObject::SaveConfig ( )
 
 class UObject* UObject::FindObject ( FString const& ObjectName, class UClass* ObjectClass )
 {
-	static UFunction* pFnFindObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFindObjectRef { L"Function Core.Object.FindObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFindObject )
-		pFnFindObject = UObject::FindObject< UFunction > ( L"Function Core.Object.FindObject" );
+	UFunction* const pFnFindObject = pFnFindObjectRef.Get ( );
 
 	UObject_execFindObject_Parms FindObject_Parms;
 	memcpy ( &FindObject_Parms.ObjectName, &ObjectName, 0x10 );
 	FindObject_Parms.ObjectClass = ObjectClass;
 
-	pFnFindObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFindObject, &FindObject_Parms, NULL );
-
-	pFnFindObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFindObject, &FindObject_Parms ) )
+		this->ProcessEvent ( pFnFindObject, &FindObject_Parms, NULL );
 
 	return FindObject_Parms.ReturnValue;
 };
@@ -881,21 +788,17 @@ class UObject* UObject::FindObject ( FString const& ObjectName, class UClass* Ob
 
 class UObject* UObject::DynamicLoadObject ( FString const& ObjectName, class UClass* ObjectClass, unsigned long MayFail )
 {
-	static UFunction* pFnDynamicLoadObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDynamicLoadObjectRef { L"Function Core.Object.DynamicLoadObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDynamicLoadObject )
-		pFnDynamicLoadObject = UObject::FindObject< UFunction > ( L"Function Core.Object.DynamicLoadObject" );
+	UFunction* const pFnDynamicLoadObject = pFnDynamicLoadObjectRef.Get ( );
 
 	UObject_execDynamicLoadObject_Parms DynamicLoadObject_Parms;
 	memcpy ( &DynamicLoadObject_Parms.ObjectName, &ObjectName, 0x10 );
 	DynamicLoadObject_Parms.ObjectClass = ObjectClass;
 	DynamicLoadObject_Parms.MayFail = MayFail;
 
-	pFnDynamicLoadObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDynamicLoadObject, &DynamicLoadObject_Parms, NULL );
-
-	pFnDynamicLoadObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDynamicLoadObject, &DynamicLoadObject_Parms ) )
+		this->ProcessEvent ( pFnDynamicLoadObject, &DynamicLoadObject_Parms, NULL );
 
 	return DynamicLoadObject_Parms.ReturnValue;
 };
@@ -909,20 +812,16 @@ class UObject* UObject::DynamicLoadObject ( FString const& ObjectName, class UCl
 
 int UObject::GetEnumIndex ( class UObject* E, struct SFXName valuename )
 {
-	static UFunction* pFnGetEnumIndex = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEnumIndexRef { L"Function Core.Object.GetEnumIndex", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEnumIndex )
-		pFnGetEnumIndex = UObject::FindObject< UFunction > ( L"Function Core.Object.GetEnumIndex" );
+	UFunction* const pFnGetEnumIndex = pFnGetEnumIndexRef.Get ( );
 
 	UObject_execGetEnumIndex_Parms GetEnumIndex_Parms;
 	GetEnumIndex_Parms.E = E;
 	memcpy ( &GetEnumIndex_Parms.valuename, &valuename, 0x8 );
 
-	pFnGetEnumIndex->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetEnumIndex, &GetEnumIndex_Parms, NULL );
-
-	pFnGetEnumIndex->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetEnumIndex, &GetEnumIndex_Parms ) )
+		this->ProcessEvent ( pFnGetEnumIndex, &GetEnumIndex_Parms, NULL );
 
 	return GetEnumIndex_Parms.ReturnValue;
 };
@@ -936,20 +835,16 @@ int UObject::GetEnumIndex ( class UObject* E, struct SFXName valuename )
 
 struct SFXName UObject::GetEnum ( class UObject* E, int I )
 {
-	static UFunction* pFnGetEnum = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEnumRef { L"Function Core.Object.GetEnum", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEnum )
-		pFnGetEnum = UObject::FindObject< UFunction > ( L"Function Core.Object.GetEnum" );
+	UFunction* const pFnGetEnum = pFnGetEnumRef.Get ( );
 
 	UObject_execGetEnum_Parms GetEnum_Parms;
 	GetEnum_Parms.E = E;
 	GetEnum_Parms.I = I;
 
-	pFnGetEnum->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetEnum, &GetEnum_Parms, NULL );
-
-	pFnGetEnum->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetEnum, &GetEnum_Parms ) )
+		this->ProcessEvent ( pFnGetEnum, &GetEnum_Parms, NULL );
 
 	return GetEnum_Parms.ReturnValue;
 };
@@ -961,24 +856,15 @@ struct SFXName UObject::GetEnum ( class UObject* E, int I )
 
 void UObject::Disable ( struct SFXName ProbeFunc )
 {
-	static UFunction* pFnDisable = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDisableRef { L"Function Core.Object.Disable", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDisable )
-		pFnDisable = UObject::FindObject< UFunction > ( L"Function Core.Object.Disable" );
+	UFunction* const pFnDisable = pFnDisableRef.Get ( );
 
 	UObject_execDisable_Parms Disable_Parms;
 	memcpy ( &Disable_Parms.ProbeFunc, &ProbeFunc, 0x8 );
 
-	unsigned short NativeIndex = pFnDisable->iNative;
-	pFnDisable->iNative = 0;
-
-	pFnDisable->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDisable, &Disable_Parms, NULL );
-
-	pFnDisable->FunctionFlags |= 0x400;
-
-	pFnDisable->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnDisable, &Disable_Parms ) )
+		this->ProcessEvent ( pFnDisable, &Disable_Parms, NULL );
 };
 
 // Function Core.Object.Enable
@@ -988,24 +874,15 @@ void UObject::Disable ( struct SFXName ProbeFunc )
 
 void UObject::Enable ( struct SFXName ProbeFunc )
 {
-	static UFunction* pFnEnable = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEnableRef { L"Function Core.Object.Enable", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEnable )
-		pFnEnable = UObject::FindObject< UFunction > ( L"Function Core.Object.Enable" );
+	UFunction* const pFnEnable = pFnEnableRef.Get ( );
 
 	UObject_execEnable_Parms Enable_Parms;
 	memcpy ( &Enable_Parms.ProbeFunc, &ProbeFunc, 0x8 );
 
-	unsigned short NativeIndex = pFnEnable->iNative;
-	pFnEnable->iNative = 0;
-
-	pFnEnable->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEnable, &Enable_Parms, NULL );
-
-	pFnEnable->FunctionFlags |= 0x400;
-
-	pFnEnable->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnEnable, &Enable_Parms ) )
+		this->ProcessEvent ( pFnEnable, &Enable_Parms, NULL );
 };
 
 // Function Core.Object.ContinuedState
@@ -1014,10 +891,9 @@ void UObject::Enable ( struct SFXName ProbeFunc )
 
 void UObject::eventContinuedState ( )
 {
-	static UFunction* pFnContinuedState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnContinuedStateRef { L"Function Core.Object.ContinuedState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnContinuedState )
-		pFnContinuedState = UObject::FindObject< UFunction > ( L"Function Core.Object.ContinuedState" );
+	UFunction* const pFnContinuedState = pFnContinuedStateRef.Get ( );
 
 	UObject_eventContinuedState_Parms ContinuedState_Parms;
 
@@ -1030,10 +906,9 @@ void UObject::eventContinuedState ( )
 
 void UObject::eventPausedState ( )
 {
-	static UFunction* pFnPausedState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPausedStateRef { L"Function Core.Object.PausedState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPausedState )
-		pFnPausedState = UObject::FindObject< UFunction > ( L"Function Core.Object.PausedState" );
+	UFunction* const pFnPausedState = pFnPausedStateRef.Get ( );
 
 	UObject_eventPausedState_Parms PausedState_Parms;
 
@@ -1046,10 +921,9 @@ void UObject::eventPausedState ( )
 
 void UObject::eventPoppedState ( )
 {
-	static UFunction* pFnPoppedState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPoppedStateRef { L"Function Core.Object.PoppedState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPoppedState )
-		pFnPoppedState = UObject::FindObject< UFunction > ( L"Function Core.Object.PoppedState" );
+	UFunction* const pFnPoppedState = pFnPoppedStateRef.Get ( );
 
 	UObject_eventPoppedState_Parms PoppedState_Parms;
 
@@ -1062,10 +936,9 @@ void UObject::eventPoppedState ( )
 
 void UObject::eventPushedState ( )
 {
-	static UFunction* pFnPushedState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPushedStateRef { L"Function Core.Object.PushedState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPushedState )
-		pFnPushedState = UObject::FindObject< UFunction > ( L"Function Core.Object.PushedState" );
+	UFunction* const pFnPushedState = pFnPushedStateRef.Get ( );
 
 	UObject_eventPushedState_Parms PushedState_Parms;
 
@@ -1079,10 +952,9 @@ void UObject::eventPushedState ( )
 
 void UObject::eventEndState ( struct SFXName NextStateName )
 {
-	static UFunction* pFnEndState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndStateRef { L"Function Core.Object.EndState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndState )
-		pFnEndState = UObject::FindObject< UFunction > ( L"Function Core.Object.EndState" );
+	UFunction* const pFnEndState = pFnEndStateRef.Get ( );
 
 	UObject_eventEndState_Parms EndState_Parms;
 	memcpy ( &EndState_Parms.NextStateName, &NextStateName, 0x8 );
@@ -1097,10 +969,9 @@ void UObject::eventEndState ( struct SFXName NextStateName )
 
 void UObject::eventBeginState ( struct SFXName PreviousStateName )
 {
-	static UFunction* pFnBeginState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBeginStateRef { L"Function Core.Object.BeginState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBeginState )
-		pFnBeginState = UObject::FindObject< UFunction > ( L"Function Core.Object.BeginState" );
+	UFunction* const pFnBeginState = pFnBeginStateRef.Get ( );
 
 	UObject_eventBeginState_Parms BeginState_Parms;
 	memcpy ( &BeginState_Parms.PreviousStateName, &PreviousStateName, 0x8 );
@@ -1114,18 +985,14 @@ void UObject::eventBeginState ( struct SFXName PreviousStateName )
 
 void UObject::DumpStateStack ( )
 {
-	static UFunction* pFnDumpStateStack = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDumpStateStackRef { L"Function Core.Object.DumpStateStack", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDumpStateStack )
-		pFnDumpStateStack = UObject::FindObject< UFunction > ( L"Function Core.Object.DumpStateStack" );
+	UFunction* const pFnDumpStateStack = pFnDumpStateStackRef.Get ( );
 
 	UObject_execDumpStateStack_Parms DumpStateStack_Parms;
 
-	pFnDumpStateStack->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDumpStateStack, &DumpStateStack_Parms, NULL );
-
-	pFnDumpStateStack->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDumpStateStack, &DumpStateStack_Parms ) )
+		this->ProcessEvent ( pFnDumpStateStack, &DumpStateStack_Parms, NULL );
 };
 
 // Function Core.Object.PopState
@@ -1135,19 +1002,15 @@ void UObject::DumpStateStack ( )
 
 void UObject::PopState ( unsigned long bPopAll )
 {
-	static UFunction* pFnPopState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopStateRef { L"Function Core.Object.PopState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopState )
-		pFnPopState = UObject::FindObject< UFunction > ( L"Function Core.Object.PopState" );
+	UFunction* const pFnPopState = pFnPopStateRef.Get ( );
 
 	UObject_execPopState_Parms PopState_Parms;
 	PopState_Parms.bPopAll = bPopAll;
 
-	pFnPopState->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnPopState, &PopState_Parms, NULL );
-
-	pFnPopState->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnPopState, &PopState_Parms ) )
+		this->ProcessEvent ( pFnPopState, &PopState_Parms, NULL );
 };
 
 // Function Core.Object.PushState
@@ -1158,20 +1021,16 @@ void UObject::PopState ( unsigned long bPopAll )
 
 void UObject::PushState ( struct SFXName NewState, struct SFXName NewLabel )
 {
-	static UFunction* pFnPushState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPushStateRef { L"Function Core.Object.PushState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPushState )
-		pFnPushState = UObject::FindObject< UFunction > ( L"Function Core.Object.PushState" );
+	UFunction* const pFnPushState = pFnPushStateRef.Get ( );
 
 	UObject_execPushState_Parms PushState_Parms;
 	memcpy ( &PushState_Parms.NewState, &NewState, 0x8 );
 	memcpy ( &PushState_Parms.NewLabel, &NewLabel, 0x8 );
 
-	pFnPushState->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnPushState, &PushState_Parms, NULL );
-
-	pFnPushState->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnPushState, &PushState_Parms ) )
+		this->ProcessEvent ( pFnPushState, &PushState_Parms, NULL );
 };
 
 // Function Core.Object.GetStateName
@@ -1181,23 +1040,14 @@ void UObject::PushState ( struct SFXName NewState, struct SFXName NewLabel )
 
 struct SFXName UObject::GetStateName ( )
 {
-	static UFunction* pFnGetStateName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetStateNameRef { L"Function Core.Object.GetStateName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetStateName )
-		pFnGetStateName = UObject::FindObject< UFunction > ( L"Function Core.Object.GetStateName" );
+	UFunction* const pFnGetStateName = pFnGetStateNameRef.Get ( );
 
 	UObject_execGetStateName_Parms GetStateName_Parms;
 
-	unsigned short NativeIndex = pFnGetStateName->iNative;
-	pFnGetStateName->iNative = 0;
-
-	pFnGetStateName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetStateName, &GetStateName_Parms, NULL );
-
-	pFnGetStateName->FunctionFlags |= 0x400;
-
-	pFnGetStateName->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnGetStateName, &GetStateName_Parms ) )
+		this->ProcessEvent ( pFnGetStateName, &GetStateName_Parms, NULL );
 
 	return GetStateName_Parms.ReturnValue;
 };
@@ -1211,20 +1061,16 @@ struct SFXName UObject::GetStateName ( )
 
 bool UObject::IsChildState ( struct SFXName TestState, struct SFXName TestParentState )
 {
-	static UFunction* pFnIsChildState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsChildStateRef { L"Function Core.Object.IsChildState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsChildState )
-		pFnIsChildState = UObject::FindObject< UFunction > ( L"Function Core.Object.IsChildState" );
+	UFunction* const pFnIsChildState = pFnIsChildStateRef.Get ( );
 
 	UObject_execIsChildState_Parms IsChildState_Parms;
 	memcpy ( &IsChildState_Parms.TestState, &TestState, 0x8 );
 	memcpy ( &IsChildState_Parms.TestParentState, &TestParentState, 0x8 );
 
-	pFnIsChildState->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsChildState, &IsChildState_Parms, NULL );
-
-	pFnIsChildState->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsChildState, &IsChildState_Parms ) )
+		this->ProcessEvent ( pFnIsChildState, &IsChildState_Parms, NULL );
 
 	return IsChildState_Parms.ReturnValue;
 };
@@ -1238,25 +1084,16 @@ bool UObject::IsChildState ( struct SFXName TestState, struct SFXName TestParent
 
 bool UObject::IsInState ( struct SFXName TestState, unsigned long bTestStateStack )
 {
-	static UFunction* pFnIsInState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsInStateRef { L"Function Core.Object.IsInState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsInState )
-		pFnIsInState = UObject::FindObject< UFunction > ( L"Function Core.Object.IsInState" );
+	UFunction* const pFnIsInState = pFnIsInStateRef.Get ( );
 
 	UObject_execIsInState_Parms IsInState_Parms;
 	memcpy ( &IsInState_Parms.TestState, &TestState, 0x8 );
 	IsInState_Parms.bTestStateStack = bTestStateStack;
 
-	unsigned short NativeIndex = pFnIsInState->iNative;
-	pFnIsInState->iNative = 0;
-
-	pFnIsInState->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsInState, &IsInState_Parms, NULL );
-
-	pFnIsInState->FunctionFlags |= 0x400;
-
-	pFnIsInState->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnIsInState, &IsInState_Parms ) )
+		this->ProcessEvent ( pFnIsInState, &IsInState_Parms, NULL );
 
 	return IsInState_Parms.ReturnValue;
 };
@@ -1271,10 +1108,9 @@ bool UObject::IsInState ( struct SFXName TestState, unsigned long bTestStateStac
 
 void UObject::GotoState ( struct SFXName NewState, struct SFXName Label, unsigned long bForceEvents, unsigned long bKeepStack )
 {
-	static UFunction* pFnGotoState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGotoStateRef { L"Function Core.Object.GotoState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGotoState )
-		pFnGotoState = UObject::FindObject< UFunction > ( L"Function Core.Object.GotoState" );
+	UFunction* const pFnGotoState = pFnGotoStateRef.Get ( );
 
 	UObject_execGotoState_Parms GotoState_Parms;
 	memcpy ( &GotoState_Parms.NewState, &NewState, 0x8 );
@@ -1282,16 +1118,8 @@ void UObject::GotoState ( struct SFXName NewState, struct SFXName Label, unsigne
 	GotoState_Parms.bForceEvents = bForceEvents;
 	GotoState_Parms.bKeepStack = bKeepStack;
 
-	unsigned short NativeIndex = pFnGotoState->iNative;
-	pFnGotoState->iNative = 0;
-
-	pFnGotoState->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGotoState, &GotoState_Parms, NULL );
-
-	pFnGotoState->FunctionFlags |= 0x400;
-
-	pFnGotoState->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnGotoState, &GotoState_Parms ) )
+		this->ProcessEvent ( pFnGotoState, &GotoState_Parms, NULL );
 };
 
 // Function Core.Object.IsUTracing
@@ -1301,18 +1129,14 @@ void UObject::GotoState ( struct SFXName NewState, struct SFXName Label, unsigne
 
 bool UObject::IsUTracing ( )
 {
-	static UFunction* pFnIsUTracing = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsUTracingRef { L"Function Core.Object.IsUTracing", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsUTracing )
-		pFnIsUTracing = UObject::FindObject< UFunction > ( L"Function Core.Object.IsUTracing" );
+	UFunction* const pFnIsUTracing = pFnIsUTracingRef.Get ( );
 
 	UObject_execIsUTracing_Parms IsUTracing_Parms;
 
-	pFnIsUTracing->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsUTracing, &IsUTracing_Parms, NULL );
-
-	pFnIsUTracing->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsUTracing, &IsUTracing_Parms ) )
+		this->ProcessEvent ( pFnIsUTracing, &IsUTracing_Parms, NULL );
 
 	return IsUTracing_Parms.ReturnValue;
 };
@@ -1324,19 +1148,15 @@ bool UObject::IsUTracing ( )
 
 void UObject::SetUTracing ( unsigned long bShouldUTrace )
 {
-	static UFunction* pFnSetUTracing = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetUTracingRef { L"Function Core.Object.SetUTracing", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetUTracing )
-		pFnSetUTracing = UObject::FindObject< UFunction > ( L"Function Core.Object.SetUTracing" );
+	UFunction* const pFnSetUTracing = pFnSetUTracingRef.Get ( );
 
 	UObject_execSetUTracing_Parms SetUTracing_Parms;
 	SetUTracing_Parms.bShouldUTrace = bShouldUTrace;
 
-	pFnSetUTracing->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetUTracing, &SetUTracing_Parms, NULL );
-
-	pFnSetUTracing->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetUTracing, &SetUTracing_Parms ) )
+		this->ProcessEvent ( pFnSetUTracing, &SetUTracing_Parms, NULL );
 };
 
 // Function Core.Object.GetFuncName
@@ -1346,18 +1166,14 @@ void UObject::SetUTracing ( unsigned long bShouldUTrace )
 
 struct SFXName UObject::GetFuncName ( )
 {
-	static UFunction* pFnGetFuncName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetFuncNameRef { L"Function Core.Object.GetFuncName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetFuncName )
-		pFnGetFuncName = UObject::FindObject< UFunction > ( L"Function Core.Object.GetFuncName" );
+	UFunction* const pFnGetFuncName = pFnGetFuncNameRef.Get ( );
 
 	UObject_execGetFuncName_Parms GetFuncName_Parms;
 
-	pFnGetFuncName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetFuncName, &GetFuncName_Parms, NULL );
-
-	pFnGetFuncName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetFuncName, &GetFuncName_Parms ) )
+		this->ProcessEvent ( pFnGetFuncName, &GetFuncName_Parms, NULL );
 
 	return GetFuncName_Parms.ReturnValue;
 };
@@ -1370,20 +1186,16 @@ struct SFXName UObject::GetFuncName ( )
 
 void UObject::DebugBreak ( int UserFlags, unsigned char DebuggerType )
 {
-	static UFunction* pFnDebugBreak = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDebugBreakRef { L"Function Core.Object.DebugBreak", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDebugBreak )
-		pFnDebugBreak = UObject::FindObject< UFunction > ( L"Function Core.Object.DebugBreak" );
+	UFunction* const pFnDebugBreak = pFnDebugBreakRef.Get ( );
 
 	UObject_execDebugBreak_Parms DebugBreak_Parms;
 	DebugBreak_Parms.UserFlags = UserFlags;
 	DebugBreak_Parms.DebuggerType = DebuggerType;
 
-	pFnDebugBreak->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDebugBreak, &DebugBreak_Parms, NULL );
-
-	pFnDebugBreak->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDebugBreak, &DebugBreak_Parms ) )
+		this->ProcessEvent ( pFnDebugBreak, &DebugBreak_Parms, NULL );
 };
 
 // Function Core.Object.ScriptTrace
@@ -1392,18 +1204,14 @@ void UObject::DebugBreak ( int UserFlags, unsigned char DebuggerType )
 
 void UObject::ScriptTrace ( )
 {
-	static UFunction* pFnScriptTrace = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnScriptTraceRef { L"Function Core.Object.ScriptTrace", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnScriptTrace )
-		pFnScriptTrace = UObject::FindObject< UFunction > ( L"Function Core.Object.ScriptTrace" );
+	UFunction* const pFnScriptTrace = pFnScriptTraceRef.Get ( );
 
 	UObject_execScriptTrace_Parms ScriptTrace_Parms;
 
-	pFnScriptTrace->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnScriptTrace, &ScriptTrace_Parms, NULL );
-
-	pFnScriptTrace->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnScriptTrace, &ScriptTrace_Parms ) )
+		this->ProcessEvent ( pFnScriptTrace, &ScriptTrace_Parms, NULL );
 };
 
 // Function Core.Object.ParseLocalizedPropertyPath
@@ -1414,10 +1222,9 @@ void UObject::ScriptTrace ( )
 
 FString UObject::ParseLocalizedPropertyPath ( FString const& PathName )
 {
-	static UFunction* pFnParseLocalizedPropertyPath = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnParseLocalizedPropertyPathRef { L"Function Core.Object.ParseLocalizedPropertyPath", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnParseLocalizedPropertyPath )
-		pFnParseLocalizedPropertyPath = UObject::FindObject< UFunction > ( L"Function Core.Object.ParseLocalizedPropertyPath" );
+	UFunction* const pFnParseLocalizedPropertyPath = pFnParseLocalizedPropertyPathRef.Get ( );
 
 	UObject_execParseLocalizedPropertyPath_Parms ParseLocalizedPropertyPath_Parms;
 	memcpy ( &ParseLocalizedPropertyPath_Parms.PathName, &PathName, 0x10 );
@@ -1437,21 +1244,17 @@ FString UObject::ParseLocalizedPropertyPath ( FString const& PathName )
 
 FString UObject::Localize ( FString const& SectionName, FString const& KeyName, FString const& PackageName )
 {
-	static UFunction* pFnLocalize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLocalizeRef { L"Function Core.Object.Localize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLocalize )
-		pFnLocalize = UObject::FindObject< UFunction > ( L"Function Core.Object.Localize" );
+	UFunction* const pFnLocalize = pFnLocalizeRef.Get ( );
 
 	UObject_execLocalize_Parms Localize_Parms;
 	memcpy ( &Localize_Parms.SectionName, &SectionName, 0x10 );
 	memcpy ( &Localize_Parms.KeyName, &KeyName, 0x10 );
 	memcpy ( &Localize_Parms.PackageName, &PackageName, 0x10 );
 
-	pFnLocalize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLocalize, &Localize_Parms, NULL );
-
-	pFnLocalize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnLocalize, &Localize_Parms ) )
+		this->ProcessEvent ( pFnLocalize, &Localize_Parms, NULL );
 
 	return Localize_Parms.ReturnValue;
 };
@@ -1463,24 +1266,15 @@ FString UObject::Localize ( FString const& SectionName, FString const& KeyName,
 
 void UObject::WarnInternal ( FString const& S )
 {
-	static UFunction* pFnWarnInternal = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWarnInternalRef { L"Function Core.Object.WarnInternal", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWarnInternal )
-		pFnWarnInternal = UObject::FindObject< UFunction > ( L"Function Core.Object.WarnInternal" );
+	UFunction* const pFnWarnInternal = pFnWarnInternalRef.Get ( );
 
 	UObject_execWarnInternal_Parms WarnInternal_Parms;
 	memcpy ( &WarnInternal_Parms.S, &S, 0x10 );
 
-	unsigned short NativeIndex = pFnWarnInternal->iNative;
-	pFnWarnInternal->iNative = 0;
-
-	pFnWarnInternal->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnWarnInternal, &WarnInternal_Parms, NULL );
-
-	pFnWarnInternal->FunctionFlags |= 0x400;
-
-	pFnWarnInternal->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnWarnInternal, &WarnInternal_Parms ) )
+		this->ProcessEvent ( pFnWarnInternal, &WarnInternal_Parms, NULL );
 };
 
 // Function Core.Object.LogInternal
@@ -1491,25 +1285,16 @@ void UObject::WarnInternal ( FString const& S )
 
 void UObject::LogInternal ( FString const& S, struct SFXName Tag )
 {
-	static UFunction* pFnLogInternal = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLogInternalRef { L"Function Core.Object.LogInternal", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLogInternal )
-		pFnLogInternal = UObject::FindObject< UFunction > ( L"Function Core.Object.LogInternal" );
+	UFunction* const pFnLogInternal = pFnLogInternalRef.Get ( );
 
 	UObject_execLogInternal_Parms LogInternal_Parms;
 	memcpy ( &LogInternal_Parms.S, &S, 0x10 );
 	memcpy ( &LogInternal_Parms.Tag, &Tag, 0x8 );
 
-	unsigned short NativeIndex = pFnLogInternal->iNative;
-	pFnLogInternal->iNative = 0;
-
-	pFnLogInternal->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLogInternal, &LogInternal_Parms, NULL );
-
-	pFnLogInternal->FunctionFlags |= 0x400;
-
-	pFnLogInternal->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnLogInternal, &LogInternal_Parms ) )
+		this->ProcessEvent ( pFnLogInternal, &LogInternal_Parms, NULL );
 };
 
 // Function Core.Object.Subtract_LinearColorLinearColor
@@ -1521,10 +1306,9 @@ void UObject::LogInternal ( FString const& S, struct SFXName Tag )
 
 struct FLinearColor UObject::Subtract_LinearColorLinearColor ( struct FLinearColor const& A, struct FLinearColor const& B )
 {
-	static UFunction* pFnSubtract_LinearColorLinearColor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtract_LinearColorLinearColorRef { L"Function Core.Object.Subtract_LinearColorLinearColor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtract_LinearColorLinearColor )
-		pFnSubtract_LinearColorLinearColor = UObject::FindObject< UFunction > ( L"Function Core.Object.Subtract_LinearColorLinearColor" );
+	UFunction* const pFnSubtract_LinearColorLinearColor = pFnSubtract_LinearColorLinearColorRef.Get ( );
 
 	UObject_execSubtract_LinearColorLinearColor_Parms Subtract_LinearColorLinearColor_Parms;
 	memcpy ( &Subtract_LinearColorLinearColor_Parms.A, &A, 0x10 );
@@ -1544,10 +1328,9 @@ struct FLinearColor UObject::Subtract_LinearColorLinearColor ( struct FLinearCol
 
 struct FLinearColor UObject::Multiply_LinearColorFloat ( struct FLinearColor const& LC, float Mult )
 {
-	static UFunction* pFnMultiply_LinearColorFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiply_LinearColorFloatRef { L"Function Core.Object.Multiply_LinearColorFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiply_LinearColorFloat )
-		pFnMultiply_LinearColorFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.Multiply_LinearColorFloat" );
+	UFunction* const pFnMultiply_LinearColorFloat = pFnMultiply_LinearColorFloatRef.Get ( );
 
 	UObject_execMultiply_LinearColorFloat_Parms Multiply_LinearColorFloat_Parms;
 	memcpy ( &Multiply_LinearColorFloat_Parms.LC, &LC, 0x10 );
@@ -1566,10 +1349,9 @@ struct FLinearColor UObject::Multiply_LinearColorFloat ( struct FLinearColor con
 
 struct FLinearColor UObject::ColorToLinearColor ( struct FColor const& OldColor )
 {
-	static UFunction* pFnColorToLinearColor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnColorToLinearColorRef { L"Function Core.Object.ColorToLinearColor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnColorToLinearColor )
-		pFnColorToLinearColor = UObject::FindObject< UFunction > ( L"Function Core.Object.ColorToLinearColor" );
+	UFunction* const pFnColorToLinearColor = pFnColorToLinearColorRef.Get ( );
 
 	UObject_execColorToLinearColor_Parms ColorToLinearColor_Parms;
 	memcpy ( &ColorToLinearColor_Parms.OldColor, &OldColor, 0x4 );
@@ -1590,10 +1372,9 @@ struct FLinearColor UObject::ColorToLinearColor ( struct FColor const& OldColor
 
 struct FLinearColor UObject::MakeLinearColor ( float R, float G, float B, float A )
 {
-	static UFunction* pFnMakeLinearColor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMakeLinearColorRef { L"Function Core.Object.MakeLinearColor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMakeLinearColor )
-		pFnMakeLinearColor = UObject::FindObject< UFunction > ( L"Function Core.Object.MakeLinearColor" );
+	UFunction* const pFnMakeLinearColor = pFnMakeLinearColorRef.Get ( );
 
 	UObject_execMakeLinearColor_Parms MakeLinearColor_Parms;
 	MakeLinearColor_Parms.R = R;
@@ -1616,10 +1397,9 @@ struct FLinearColor UObject::MakeLinearColor ( float R, float G, float B, float
 
 struct FColor UObject::LerpColor ( struct FColor const& A, struct FColor const& B, float Alpha )
 {
-	static UFunction* pFnLerpColor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLerpColorRef { L"Function Core.Object.LerpColor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLerpColor )
-		pFnLerpColor = UObject::FindObject< UFunction > ( L"Function Core.Object.LerpColor" );
+	UFunction* const pFnLerpColor = pFnLerpColorRef.Get ( );
 
 	UObject_execLerpColor_Parms LerpColor_Parms;
 	memcpy ( &LerpColor_Parms.A, &A, 0x4 );
@@ -1642,10 +1422,9 @@ struct FColor UObject::LerpColor ( struct FColor const& A, struct FColor const&
 
 struct FColor UObject::MakeColor ( unsigned char R, unsigned char G, unsigned char B, unsigned char A )
 {
-	static UFunction* pFnMakeColor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMakeColorRef { L"Function Core.Object.MakeColor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMakeColor )
-		pFnMakeColor = UObject::FindObject< UFunction > ( L"Function Core.Object.MakeColor" );
+	UFunction* const pFnMakeColor = pFnMakeColorRef.Get ( );
 
 	UObject_execMakeColor_Parms MakeColor_Parms;
 	MakeColor_Parms.R = R;
@@ -1667,10 +1446,9 @@ struct FColor UObject::MakeColor ( unsigned char R, unsigned char G, unsigned ch
 
 struct FColor UObject::Add_ColorColor ( struct FColor const& A, struct FColor const& B )
 {
-	static UFunction* pFnAdd_ColorColor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAdd_ColorColorRef { L"Function Core.Object.Add_ColorColor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAdd_ColorColor )
-		pFnAdd_ColorColor = UObject::FindObject< UFunction > ( L"Function Core.Object.Add_ColorColor" );
+	UFunction* const pFnAdd_ColorColor = pFnAdd_ColorColorRef.Get ( );
 
 	UObject_execAdd_ColorColor_Parms Add_ColorColor_Parms;
 	memcpy ( &Add_ColorColor_Parms.A, &A, 0x4 );
@@ -1690,10 +1468,9 @@ struct FColor UObject::Add_ColorColor ( struct FColor const& A, struct FColor co
 
 struct FColor UObject::Multiply_ColorFloat ( struct FColor const& A, float B )
 {
-	static UFunction* pFnMultiply_ColorFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiply_ColorFloatRef { L"Function Core.Object.Multiply_ColorFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiply_ColorFloat )
-		pFnMultiply_ColorFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.Multiply_ColorFloat" );
+	UFunction* const pFnMultiply_ColorFloat = pFnMultiply_ColorFloatRef.Get ( );
 
 	UObject_execMultiply_ColorFloat_Parms Multiply_ColorFloat_Parms;
 	memcpy ( &Multiply_ColorFloat_Parms.A, &A, 0x4 );
@@ -1713,10 +1490,9 @@ struct FColor UObject::Multiply_ColorFloat ( struct FColor const& A, float B )
 
 struct FColor UObject::Multiply_FloatColor ( float A, struct FColor const& B )
 {
-	static UFunction* pFnMultiply_FloatColor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiply_FloatColorRef { L"Function Core.Object.Multiply_FloatColor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiply_FloatColor )
-		pFnMultiply_FloatColor = UObject::FindObject< UFunction > ( L"Function Core.Object.Multiply_FloatColor" );
+	UFunction* const pFnMultiply_FloatColor = pFnMultiply_FloatColorRef.Get ( );
 
 	UObject_execMultiply_FloatColor_Parms Multiply_FloatColor_Parms;
 	Multiply_FloatColor_Parms.A = A;
@@ -1736,10 +1512,9 @@ struct FColor UObject::Multiply_FloatColor ( float A, struct FColor const& B )
 
 struct FColor UObject::Subtract_ColorColor ( struct FColor const& A, struct FColor const& B )
 {
-	static UFunction* pFnSubtract_ColorColor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtract_ColorColorRef { L"Function Core.Object.Subtract_ColorColor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtract_ColorColor )
-		pFnSubtract_ColorColor = UObject::FindObject< UFunction > ( L"Function Core.Object.Subtract_ColorColor" );
+	UFunction* const pFnSubtract_ColorColor = pFnSubtract_ColorColorRef.Get ( );
 
 	UObject_execSubtract_ColorColor_Parms Subtract_ColorColor_Parms;
 	memcpy ( &Subtract_ColorColor_Parms.A, &A, 0x4 );
@@ -1759,20 +1534,16 @@ struct FColor UObject::Subtract_ColorColor ( struct FColor const& A, struct FCol
 
 struct FVector2D UObject::EvalInterpCurveVector2D ( struct FInterpCurveVector2D const& Vector2DCurve, float InVal )
 {
-	static UFunction* pFnEvalInterpCurveVector2D = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvalInterpCurveVector2DRef { L"Function Core.Object.EvalInterpCurveVector2D", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvalInterpCurveVector2D )
-		pFnEvalInterpCurveVector2D = UObject::FindObject< UFunction > ( L"Function Core.Object.EvalInterpCurveVector2D" );
+	UFunction* const pFnEvalInterpCurveVector2D = pFnEvalInterpCurveVector2DRef.Get ( );
 
 	UObject_execEvalInterpCurveVector2D_Parms EvalInterpCurveVector2D_Parms;
 	memcpy ( &EvalInterpCurveVector2D_Parms.Vector2DCurve, &Vector2DCurve, 0x14 );
 	EvalInterpCurveVector2D_Parms.InVal = InVal;
 
-	pFnEvalInterpCurveVector2D->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEvalInterpCurveVector2D, &EvalInterpCurveVector2D_Parms, NULL );
-
-	pFnEvalInterpCurveVector2D->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnEvalInterpCurveVector2D, &EvalInterpCurveVector2D_Parms ) )
+		this->ProcessEvent ( pFnEvalInterpCurveVector2D, &EvalInterpCurveVector2D_Parms, NULL );
 
 	return EvalInterpCurveVector2D_Parms.ReturnValue;
 };
@@ -1786,20 +1557,16 @@ struct FVector2D UObject::EvalInterpCurveVector2D ( struct FInterpCurveVector2D
 
 struct FVector UObject::EvalInterpCurveVector ( struct FInterpCurveVector const& VectorCurve, float InVal )
 {
-	static UFunction* pFnEvalInterpCurveVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvalInterpCurveVectorRef { L"Function Core.Object.EvalInterpCurveVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvalInterpCurveVector )
-		pFnEvalInterpCurveVector = UObject::FindObject< UFunction > ( L"Function Core.Object.EvalInterpCurveVector" );
+	UFunction* const pFnEvalInterpCurveVector = pFnEvalInterpCurveVectorRef.Get ( );
 
 	UObject_execEvalInterpCurveVector_Parms EvalInterpCurveVector_Parms;
 	memcpy ( &EvalInterpCurveVector_Parms.VectorCurve, &VectorCurve, 0x14 );
 	EvalInterpCurveVector_Parms.InVal = InVal;
 
-	pFnEvalInterpCurveVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEvalInterpCurveVector, &EvalInterpCurveVector_Parms, NULL );
-
-	pFnEvalInterpCurveVector->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnEvalInterpCurveVector, &EvalInterpCurveVector_Parms ) )
+		this->ProcessEvent ( pFnEvalInterpCurveVector, &EvalInterpCurveVector_Parms, NULL );
 
 	return EvalInterpCurveVector_Parms.ReturnValue;
 };
@@ -1813,20 +1580,16 @@ struct FVector UObject::EvalInterpCurveVector ( struct FInterpCurveVector const&
 
 float UObject::EvalInterpCurveFloat ( struct FInterpCurveFloat const& FloatCurve, float InVal )
 {
-	static UFunction* pFnEvalInterpCurveFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvalInterpCurveFloatRef { L"Function Core.Object.EvalInterpCurveFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvalInterpCurveFloat )
-		pFnEvalInterpCurveFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.EvalInterpCurveFloat" );
+	UFunction* const pFnEvalInterpCurveFloat = pFnEvalInterpCurveFloatRef.Get ( );
 
 	UObject_execEvalInterpCurveFloat_Parms EvalInterpCurveFloat_Parms;
 	memcpy ( &EvalInterpCurveFloat_Parms.FloatCurve, &FloatCurve, 0x14 );
 	EvalInterpCurveFloat_Parms.InVal = InVal;
 
-	pFnEvalInterpCurveFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEvalInterpCurveFloat, &EvalInterpCurveFloat_Parms, NULL );
-
-	pFnEvalInterpCurveFloat->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnEvalInterpCurveFloat, &EvalInterpCurveFloat_Parms ) )
+		this->ProcessEvent ( pFnEvalInterpCurveFloat, &EvalInterpCurveFloat_Parms, NULL );
 
 	return EvalInterpCurveFloat_Parms.ReturnValue;
 };
@@ -1840,10 +1603,9 @@ float UObject::EvalInterpCurveFloat ( struct FInterpCurveFloat const& FloatCurve
 
 struct FVector2D UObject::vect2d ( float InX, float InY )
 {
-	static UFunction* pFnvect2d = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnvect2dRef { L"Function Core.Object.vect2d", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnvect2d )
-		pFnvect2d = UObject::FindObject< UFunction > ( L"Function Core.Object.vect2d" );
+	UFunction* const pFnvect2d = pFnvect2dRef.Get ( );
 
 	UObject_execvect2d_Parms vect2d_Parms;
 	vect2d_Parms.InX = InX;
@@ -1864,21 +1626,17 @@ struct FVector2D UObject::vect2d ( float InX, float InY )
 
 float UObject::GetMappedRangeValue ( struct FVector2D const& InputRange, struct FVector2D const& OutputRange, float Value )
 {
-	static UFunction* pFnGetMappedRangeValue = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetMappedRangeValueRef { L"Function Core.Object.GetMappedRangeValue", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetMappedRangeValue )
-		pFnGetMappedRangeValue = UObject::FindObject< UFunction > ( L"Function Core.Object.GetMappedRangeValue" );
+	UFunction* const pFnGetMappedRangeValue = pFnGetMappedRangeValueRef.Get ( );
 
 	UObject_execGetMappedRangeValue_Parms GetMappedRangeValue_Parms;
 	memcpy ( &GetMappedRangeValue_Parms.InputRange, &InputRange, 0x8 );
 	memcpy ( &GetMappedRangeValue_Parms.OutputRange, &OutputRange, 0x8 );
 	GetMappedRangeValue_Parms.Value = Value;
 
-	pFnGetMappedRangeValue->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetMappedRangeValue, &GetMappedRangeValue_Parms, NULL );
-
-	pFnGetMappedRangeValue->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetMappedRangeValue, &GetMappedRangeValue_Parms ) )
+		this->ProcessEvent ( pFnGetMappedRangeValue, &GetMappedRangeValue_Parms, NULL );
 
 	return GetMappedRangeValue_Parms.ReturnValue;
 };
@@ -1892,10 +1650,9 @@ float UObject::GetMappedRangeValue ( struct FVector2D const& InputRange, struct
 
 float UObject::GetRangePctByValue ( struct FVector2D const& Range, float Value )
 {
-	static UFunction* pFnGetRangePctByValue = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetRangePctByValueRef { L"Function Core.Object.GetRangePctByValue", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetRangePctByValue )
-		pFnGetRangePctByValue = UObject::FindObject< UFunction > ( L"Function Core.Object.GetRangePctByValue" );
+	UFunction* const pFnGetRangePctByValue = pFnGetRangePctByValueRef.Get ( );
 
 	UObject_execGetRangePctByValue_Parms GetRangePctByValue_Parms;
 	memcpy ( &GetRangePctByValue_Parms.Range, &Range, 0x8 );
@@ -1915,10 +1672,9 @@ float UObject::GetRangePctByValue ( struct FVector2D const& Range, float Value )
 
 float UObject::GetRangeValueByPct ( struct FVector2D const& Range, float Pct )
 {
-	static UFunction* pFnGetRangeValueByPct = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetRangeValueByPctRef { L"Function Core.Object.GetRangeValueByPct", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetRangeValueByPct )
-		pFnGetRangeValueByPct = UObject::FindObject< UFunction > ( L"Function Core.Object.GetRangeValueByPct" );
+	UFunction* const pFnGetRangeValueByPct = pFnGetRangeValueByPctRef.Get ( );
 
 	UObject_execGetRangeValueByPct_Parms GetRangeValueByPct_Parms;
 	memcpy ( &GetRangeValueByPct_Parms.Range, &Range, 0x8 );
@@ -1938,20 +1694,16 @@ float UObject::GetRangeValueByPct ( struct FVector2D const& Range, float Pct )
 
 struct FVector2D UObject::Subtract_Vector2DVector2D ( struct FVector2D const& A, struct FVector2D const& B )
 {
-	static UFunction* pFnSubtract_Vector2DVector2D = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtract_Vector2DVector2DRef { L"Function Core.Object.Subtract_Vector2DVector2D", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtract_Vector2DVector2D )
-		pFnSubtract_Vector2DVector2D = UObject::FindObject< UFunction > ( L"Function Core.Object.Subtract_Vector2DVector2D" );
+	UFunction* const pFnSubtract_Vector2DVector2D = pFnSubtract_Vector2DVector2DRef.Get ( );
 
 	UObject_execSubtract_Vector2DVector2D_Parms Subtract_Vector2DVector2D_Parms;
 	memcpy ( &Subtract_Vector2DVector2D_Parms.A, &A, 0x8 );
 	memcpy ( &Subtract_Vector2DVector2D_Parms.B, &B, 0x8 );
 
-	pFnSubtract_Vector2DVector2D->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtract_Vector2DVector2D, &Subtract_Vector2DVector2D_Parms, NULL );
-
-	pFnSubtract_Vector2DVector2D->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubtract_Vector2DVector2D, &Subtract_Vector2DVector2D_Parms ) )
+		this->ProcessEvent ( pFnSubtract_Vector2DVector2D, &Subtract_Vector2DVector2D_Parms, NULL );
 
 	return Subtract_Vector2DVector2D_Parms.ReturnValue;
 };
@@ -1965,20 +1717,16 @@ struct FVector2D UObject::Subtract_Vector2DVector2D ( struct FVector2D const& A,
 
 struct FVector2D UObject::Add_Vector2DVector2D ( struct FVector2D const& A, struct FVector2D const& B )
 {
-	static UFunction* pFnAdd_Vector2DVector2D = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAdd_Vector2DVector2DRef { L"Function Core.Object.Add_Vector2DVector2D", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAdd_Vector2DVector2D )
-		pFnAdd_Vector2DVector2D = UObject::FindObject< UFunction > ( L"Function Core.Object.Add_Vector2DVector2D" );
+	UFunction* const pFnAdd_Vector2DVector2D = pFnAdd_Vector2DVector2DRef.Get ( );
 
 	UObject_execAdd_Vector2DVector2D_Parms Add_Vector2DVector2D_Parms;
 	memcpy ( &Add_Vector2DVector2D_Parms.A, &A, 0x8 );
 	memcpy ( &Add_Vector2DVector2D_Parms.B, &B, 0x8 );
 
-	pFnAdd_Vector2DVector2D->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAdd_Vector2DVector2D, &Add_Vector2DVector2D_Parms, NULL );
-
-	pFnAdd_Vector2DVector2D->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAdd_Vector2DVector2D, &Add_Vector2DVector2D_Parms ) )
+		this->ProcessEvent ( pFnAdd_Vector2DVector2D, &Add_Vector2DVector2D_Parms, NULL );
 
 	return Add_Vector2DVector2D_Parms.ReturnValue;
 };
@@ -1992,20 +1740,16 @@ struct FVector2D UObject::Add_Vector2DVector2D ( struct FVector2D const& A, stru
 
 int UObject::GetVectorSide ( struct FVector const& A, struct FVector const& B )
 {
-	static UFunction* pFnGetVectorSide = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVectorSideRef { L"Function Core.Object.GetVectorSide", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVectorSide )
-		pFnGetVectorSide = UObject::FindObject< UFunction > ( L"Function Core.Object.GetVectorSide" );
+	UFunction* const pFnGetVectorSide = pFnGetVectorSideRef.Get ( );
 
 	UObject_execGetVectorSide_Parms GetVectorSide_Parms;
 	memcpy ( &GetVectorSide_Parms.A, &A, 0xC );
 	memcpy ( &GetVectorSide_Parms.B, &B, 0xC );
 
-	pFnGetVectorSide->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVectorSide, &GetVectorSide_Parms, NULL );
-
-	pFnGetVectorSide->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVectorSide, &GetVectorSide_Parms ) )
+		this->ProcessEvent ( pFnGetVectorSide, &GetVectorSide_Parms, NULL );
 
 	return GetVectorSide_Parms.ReturnValue;
 };
@@ -2019,20 +1763,16 @@ int UObject::GetVectorSide ( struct FVector const& A, struct FVector const& B )
 
 float UObject::GetAngleBetween ( struct FVector const& A, struct FVector const& B )
 {
-	static UFunction* pFnGetAngleBetween = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAngleBetweenRef { L"Function Core.Object.GetAngleBetween", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAngleBetween )
-		pFnGetAngleBetween = UObject::FindObject< UFunction > ( L"Function Core.Object.GetAngleBetween" );
+	UFunction* const pFnGetAngleBetween = pFnGetAngleBetweenRef.Get ( );
 
 	UObject_execGetAngleBetween_Parms GetAngleBetween_Parms;
 	memcpy ( &GetAngleBetween_Parms.A, &A, 0xC );
 	memcpy ( &GetAngleBetween_Parms.B, &B, 0xC );
 
-	pFnGetAngleBetween->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAngleBetween, &GetAngleBetween_Parms, NULL );
-
-	pFnGetAngleBetween->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAngleBetween, &GetAngleBetween_Parms ) )
+		this->ProcessEvent ( pFnGetAngleBetween, &GetAngleBetween_Parms, NULL );
 
 	return GetAngleBetween_Parms.ReturnValue;
 };
@@ -2046,25 +1786,16 @@ float UObject::GetAngleBetween ( struct FVector const& A, struct FVector const&
 
 bool UObject::NotEqual_IntStringRef ( int A, int B )
 {
-	static UFunction* pFnNotEqual_IntStringRef = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotEqual_IntStringRefRef { L"Function Core.Object.NotEqual_IntStringRef", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotEqual_IntStringRef )
-		pFnNotEqual_IntStringRef = UObject::FindObject< UFunction > ( L"Function Core.Object.NotEqual_IntStringRef" );
+	UFunction* const pFnNotEqual_IntStringRef = pFnNotEqual_IntStringRefRef.Get ( );
 
 	UObject_execNotEqual_IntStringRef_Parms NotEqual_IntStringRef_Parms;
 	NotEqual_IntStringRef_Parms.A = A;
 	NotEqual_IntStringRef_Parms.B = B;
 
-	unsigned short NativeIndex = pFnNotEqual_IntStringRef->iNative;
-	pFnNotEqual_IntStringRef->iNative = 0;
-
-	pFnNotEqual_IntStringRef->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotEqual_IntStringRef, &NotEqual_IntStringRef_Parms, NULL );
-
-	pFnNotEqual_IntStringRef->FunctionFlags |= 0x400;
-
-	pFnNotEqual_IntStringRef->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnNotEqual_IntStringRef, &NotEqual_IntStringRef_Parms ) )
+		this->ProcessEvent ( pFnNotEqual_IntStringRef, &NotEqual_IntStringRef_Parms, NULL );
 
 	return NotEqual_IntStringRef_Parms.ReturnValue;
 };
@@ -2078,25 +1809,16 @@ bool UObject::NotEqual_IntStringRef ( int A, int B )
 
 bool UObject::NotEqual_StringRefInt ( int A, int B )
 {
-	static UFunction* pFnNotEqual_StringRefInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotEqual_StringRefIntRef { L"Function Core.Object.NotEqual_StringRefInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotEqual_StringRefInt )
-		pFnNotEqual_StringRefInt = UObject::FindObject< UFunction > ( L"Function Core.Object.NotEqual_StringRefInt" );
+	UFunction* const pFnNotEqual_StringRefInt = pFnNotEqual_StringRefIntRef.Get ( );
 
 	UObject_execNotEqual_StringRefInt_Parms NotEqual_StringRefInt_Parms;
 	NotEqual_StringRefInt_Parms.A = A;
 	NotEqual_StringRefInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnNotEqual_StringRefInt->iNative;
-	pFnNotEqual_StringRefInt->iNative = 0;
-
-	pFnNotEqual_StringRefInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotEqual_StringRefInt, &NotEqual_StringRefInt_Parms, NULL );
-
-	pFnNotEqual_StringRefInt->FunctionFlags |= 0x400;
-
-	pFnNotEqual_StringRefInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnNotEqual_StringRefInt, &NotEqual_StringRefInt_Parms ) )
+		this->ProcessEvent ( pFnNotEqual_StringRefInt, &NotEqual_StringRefInt_Parms, NULL );
 
 	return NotEqual_StringRefInt_Parms.ReturnValue;
 };
@@ -2110,25 +1832,16 @@ bool UObject::NotEqual_StringRefInt ( int A, int B )
 
 bool UObject::NotEqual_StringRefStringRef ( int A, int B )
 {
-	static UFunction* pFnNotEqual_StringRefStringRef = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotEqual_StringRefStringRefRef { L"Function Core.Object.NotEqual_StringRefStringRef", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotEqual_StringRefStringRef )
-		pFnNotEqual_StringRefStringRef = UObject::FindObject< UFunction > ( L"Function Core.Object.NotEqual_StringRefStringRef" );
+	UFunction* const pFnNotEqual_StringRefStringRef = pFnNotEqual_StringRefStringRefRef.Get ( );
 
 	UObject_execNotEqual_StringRefStringRef_Parms NotEqual_StringRefStringRef_Parms;
 	NotEqual_StringRefStringRef_Parms.A = A;
 	NotEqual_StringRefStringRef_Parms.B = B;
 
-	unsigned short NativeIndex = pFnNotEqual_StringRefStringRef->iNative;
-	pFnNotEqual_StringRefStringRef->iNative = 0;
-
-	pFnNotEqual_StringRefStringRef->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotEqual_StringRefStringRef, &NotEqual_StringRefStringRef_Parms, NULL );
-
-	pFnNotEqual_StringRefStringRef->FunctionFlags |= 0x400;
-
-	pFnNotEqual_StringRefStringRef->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnNotEqual_StringRefStringRef, &NotEqual_StringRefStringRef_Parms ) )
+		this->ProcessEvent ( pFnNotEqual_StringRefStringRef, &NotEqual_StringRefStringRef_Parms, NULL );
 
 	return NotEqual_StringRefStringRef_Parms.ReturnValue;
 };
@@ -2142,25 +1855,16 @@ bool UObject::NotEqual_StringRefStringRef ( int A, int B )
 
 bool UObject::EqualEqual_IntStringRef ( int A, int B )
 {
-	static UFunction* pFnEqualEqual_IntStringRef = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEqualEqual_IntStringRefRef { L"Function Core.Object.EqualEqual_IntStringRef", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEqualEqual_IntStringRef )
-		pFnEqualEqual_IntStringRef = UObject::FindObject< UFunction > ( L"Function Core.Object.EqualEqual_IntStringRef" );
+	UFunction* const pFnEqualEqual_IntStringRef = pFnEqualEqual_IntStringRefRef.Get ( );
 
 	UObject_execEqualEqual_IntStringRef_Parms EqualEqual_IntStringRef_Parms;
 	EqualEqual_IntStringRef_Parms.A = A;
 	EqualEqual_IntStringRef_Parms.B = B;
 
-	unsigned short NativeIndex = pFnEqualEqual_IntStringRef->iNative;
-	pFnEqualEqual_IntStringRef->iNative = 0;
-
-	pFnEqualEqual_IntStringRef->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEqualEqual_IntStringRef, &EqualEqual_IntStringRef_Parms, NULL );
-
-	pFnEqualEqual_IntStringRef->FunctionFlags |= 0x400;
-
-	pFnEqualEqual_IntStringRef->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnEqualEqual_IntStringRef, &EqualEqual_IntStringRef_Parms ) )
+		this->ProcessEvent ( pFnEqualEqual_IntStringRef, &EqualEqual_IntStringRef_Parms, NULL );
 
 	return EqualEqual_IntStringRef_Parms.ReturnValue;
 };
@@ -2174,25 +1878,16 @@ bool UObject::EqualEqual_IntStringRef ( int A, int B )
 
 bool UObject::EqualEqual_StringRefInt ( int A, int B )
 {
-	static UFunction* pFnEqualEqual_StringRefInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEqualEqual_StringRefIntRef { L"Function Core.Object.EqualEqual_StringRefInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEqualEqual_StringRefInt )
-		pFnEqualEqual_StringRefInt = UObject::FindObject< UFunction > ( L"Function Core.Object.EqualEqual_StringRefInt" );
+	UFunction* const pFnEqualEqual_StringRefInt = pFnEqualEqual_StringRefIntRef.Get ( );
 
 	UObject_execEqualEqual_StringRefInt_Parms EqualEqual_StringRefInt_Parms;
 	EqualEqual_StringRefInt_Parms.A = A;
 	EqualEqual_StringRefInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnEqualEqual_StringRefInt->iNative;
-	pFnEqualEqual_StringRefInt->iNative = 0;
-
-	pFnEqualEqual_StringRefInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEqualEqual_StringRefInt, &EqualEqual_StringRefInt_Parms, NULL );
-
-	pFnEqualEqual_StringRefInt->FunctionFlags |= 0x400;
-
-	pFnEqualEqual_StringRefInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnEqualEqual_StringRefInt, &EqualEqual_StringRefInt_Parms ) )
+		this->ProcessEvent ( pFnEqualEqual_StringRefInt, &EqualEqual_StringRefInt_Parms, NULL );
 
 	return EqualEqual_StringRefInt_Parms.ReturnValue;
 };
@@ -2206,25 +1901,16 @@ bool UObject::EqualEqual_StringRefInt ( int A, int B )
 
 bool UObject::EqualEqual_StringRefStringRef ( int A, int B )
 {
-	static UFunction* pFnEqualEqual_StringRefStringRef = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEqualEqual_StringRefStringRefRef { L"Function Core.Object.EqualEqual_StringRefStringRef", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEqualEqual_StringRefStringRef )
-		pFnEqualEqual_StringRefStringRef = UObject::FindObject< UFunction > ( L"Function Core.Object.EqualEqual_StringRefStringRef" );
+	UFunction* const pFnEqualEqual_StringRefStringRef = pFnEqualEqual_StringRefStringRefRef.Get ( );
 
 	UObject_execEqualEqual_StringRefStringRef_Parms EqualEqual_StringRefStringRef_Parms;
 	EqualEqual_StringRefStringRef_Parms.A = A;
 	EqualEqual_StringRefStringRef_Parms.B = B;
 
-	unsigned short NativeIndex = pFnEqualEqual_StringRefStringRef->iNative;
-	pFnEqualEqual_StringRefStringRef->iNative = 0;
-
-	pFnEqualEqual_StringRefStringRef->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEqualEqual_StringRefStringRef, &EqualEqual_StringRefStringRef_Parms, NULL );
-
-	pFnEqualEqual_StringRefStringRef->FunctionFlags |= 0x400;
-
-	pFnEqualEqual_StringRefStringRef->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnEqualEqual_StringRefStringRef, &EqualEqual_StringRefStringRef_Parms ) )
+		this->ProcessEvent ( pFnEqualEqual_StringRefStringRef, &EqualEqual_StringRefStringRef_Parms, NULL );
 
 	return EqualEqual_StringRefStringRef_Parms.ReturnValue;
 };
@@ -2238,25 +1924,16 @@ bool UObject::EqualEqual_StringRefStringRef ( int A, int B )
 
 struct FQuat UObject::Subtract_QuatQuat ( struct FQuat const& A, struct FQuat const& B )
 {
-	static UFunction* pFnSubtract_QuatQuat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtract_QuatQuatRef { L"Function Core.Object.Subtract_QuatQuat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtract_QuatQuat )
-		pFnSubtract_QuatQuat = UObject::FindObject< UFunction > ( L"Function Core.Object.Subtract_QuatQuat" );
+	UFunction* const pFnSubtract_QuatQuat = pFnSubtract_QuatQuatRef.Get ( );
 
 	UObject_execSubtract_QuatQuat_Parms Subtract_QuatQuat_Parms;
 	memcpy ( &Subtract_QuatQuat_Parms.A, &A, 0x10 );
 	memcpy ( &Subtract_QuatQuat_Parms.B, &B, 0x10 );
 
-	unsigned short NativeIndex = pFnSubtract_QuatQuat->iNative;
-	pFnSubtract_QuatQuat->iNative = 0;
-
-	pFnSubtract_QuatQuat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtract_QuatQuat, &Subtract_QuatQuat_Parms, NULL );
-
-	pFnSubtract_QuatQuat->FunctionFlags |= 0x400;
-
-	pFnSubtract_QuatQuat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtract_QuatQuat, &Subtract_QuatQuat_Parms ) )
+		this->ProcessEvent ( pFnSubtract_QuatQuat, &Subtract_QuatQuat_Parms, NULL );
 
 	return Subtract_QuatQuat_Parms.ReturnValue;
 };
@@ -2270,25 +1947,16 @@ struct FQuat UObject::Subtract_QuatQuat ( struct FQuat const& A, struct FQuat co
 
 struct FQuat UObject::Add_QuatQuat ( struct FQuat const& A, struct FQuat const& B )
 {
-	static UFunction* pFnAdd_QuatQuat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAdd_QuatQuatRef { L"Function Core.Object.Add_QuatQuat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAdd_QuatQuat )
-		pFnAdd_QuatQuat = UObject::FindObject< UFunction > ( L"Function Core.Object.Add_QuatQuat" );
+	UFunction* const pFnAdd_QuatQuat = pFnAdd_QuatQuatRef.Get ( );
 
 	UObject_execAdd_QuatQuat_Parms Add_QuatQuat_Parms;
 	memcpy ( &Add_QuatQuat_Parms.A, &A, 0x10 );
 	memcpy ( &Add_QuatQuat_Parms.B, &B, 0x10 );
 
-	unsigned short NativeIndex = pFnAdd_QuatQuat->iNative;
-	pFnAdd_QuatQuat->iNative = 0;
-
-	pFnAdd_QuatQuat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAdd_QuatQuat, &Add_QuatQuat_Parms, NULL );
-
-	pFnAdd_QuatQuat->FunctionFlags |= 0x400;
-
-	pFnAdd_QuatQuat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAdd_QuatQuat, &Add_QuatQuat_Parms ) )
+		this->ProcessEvent ( pFnAdd_QuatQuat, &Add_QuatQuat_Parms, NULL );
 
 	return Add_QuatQuat_Parms.ReturnValue;
 };
@@ -2304,10 +1972,9 @@ struct FQuat UObject::Add_QuatQuat ( struct FQuat const& A, struct FQuat const&
 
 struct FQuat UObject::QuatSlerp ( struct FQuat const& A, struct FQuat const& B, float Alpha, unsigned long bShortestPath )
 {
-	static UFunction* pFnQuatSlerp = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnQuatSlerpRef { L"Function Core.Object.QuatSlerp", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnQuatSlerp )
-		pFnQuatSlerp = UObject::FindObject< UFunction > ( L"Function Core.Object.QuatSlerp" );
+	UFunction* const pFnQuatSlerp = pFnQuatSlerpRef.Get ( );
 
 	UObject_execQuatSlerp_Parms QuatSlerp_Parms;
 	memcpy ( &QuatSlerp_Parms.A, &A, 0x10 );
@@ -2315,11 +1982,8 @@ struct FQuat UObject::QuatSlerp ( struct FQuat const& A, struct FQuat const& B,
 	QuatSlerp_Parms.Alpha = Alpha;
 	QuatSlerp_Parms.bShortestPath = bShortestPath;
 
-	pFnQuatSlerp->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnQuatSlerp, &QuatSlerp_Parms, NULL );
-
-	pFnQuatSlerp->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnQuatSlerp, &QuatSlerp_Parms ) )
+		this->ProcessEvent ( pFnQuatSlerp, &QuatSlerp_Parms, NULL );
 
 	return QuatSlerp_Parms.ReturnValue;
 };
@@ -2332,19 +1996,15 @@ struct FQuat UObject::QuatSlerp ( struct FQuat const& A, struct FQuat const& B,
 
 struct FRotator UObject::QuatToRotator ( struct FQuat const& A )
 {
-	static UFunction* pFnQuatToRotator = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnQuatToRotatorRef { L"Function Core.Object.QuatToRotator", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnQuatToRotator )
-		pFnQuatToRotator = UObject::FindObject< UFunction > ( L"Function Core.Object.QuatToRotator" );
+	UFunction* const pFnQuatToRotator = pFnQuatToRotatorRef.Get ( );
 
 	UObject_execQuatToRotator_Parms QuatToRotator_Parms;
 	memcpy ( &QuatToRotator_Parms.A, &A, 0x10 );
 
-	pFnQuatToRotator->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnQuatToRotator, &QuatToRotator_Parms, NULL );
-
-	pFnQuatToRotator->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnQuatToRotator, &QuatToRotator_Parms ) )
+		this->ProcessEvent ( pFnQuatToRotator, &QuatToRotator_Parms, NULL );
 
 	return QuatToRotator_Parms.ReturnValue;
 };
@@ -2357,19 +2017,15 @@ struct FRotator UObject::QuatToRotator ( struct FQuat const& A )
 
 struct FQuat UObject::QuatFromRotator ( struct FRotator const& A )
 {
-	static UFunction* pFnQuatFromRotator = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnQuatFromRotatorRef { L"Function Core.Object.QuatFromRotator", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnQuatFromRotator )
-		pFnQuatFromRotator = UObject::FindObject< UFunction > ( L"Function Core.Object.QuatFromRotator" );
+	UFunction* const pFnQuatFromRotator = pFnQuatFromRotatorRef.Get ( );
 
 	UObject_execQuatFromRotator_Parms QuatFromRotator_Parms;
 	memcpy ( &QuatFromRotator_Parms.A, &A, 0xC );
 
-	pFnQuatFromRotator->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnQuatFromRotator, &QuatFromRotator_Parms, NULL );
-
-	pFnQuatFromRotator->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnQuatFromRotator, &QuatFromRotator_Parms ) )
+		this->ProcessEvent ( pFnQuatFromRotator, &QuatFromRotator_Parms, NULL );
 
 	return QuatFromRotator_Parms.ReturnValue;
 };
@@ -2383,20 +2039,16 @@ struct FQuat UObject::QuatFromRotator ( struct FRotator const& A )
 
 struct FQuat UObject::QuatFromAxisAndAngle ( struct FVector const& Axis, float Angle )
 {
-	static UFunction* pFnQuatFromAxisAndAngle = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnQuatFromAxisAndAngleRef { L"Function Core.Object.QuatFromAxisAndAngle", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnQuatFromAxisAndAngle )
-		pFnQuatFromAxisAndAngle = UObject::FindObject< UFunction > ( L"Function Core.Object.QuatFromAxisAndAngle" );
+	UFunction* const pFnQuatFromAxisAndAngle = pFnQuatFromAxisAndAngleRef.Get ( );
 
 	UObject_execQuatFromAxisAndAngle_Parms QuatFromAxisAndAngle_Parms;
 	memcpy ( &QuatFromAxisAndAngle_Parms.Axis, &Axis, 0xC );
 	QuatFromAxisAndAngle_Parms.Angle = Angle;
 
-	pFnQuatFromAxisAndAngle->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnQuatFromAxisAndAngle, &QuatFromAxisAndAngle_Parms, NULL );
-
-	pFnQuatFromAxisAndAngle->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnQuatFromAxisAndAngle, &QuatFromAxisAndAngle_Parms ) )
+		this->ProcessEvent ( pFnQuatFromAxisAndAngle, &QuatFromAxisAndAngle_Parms, NULL );
 
 	return QuatFromAxisAndAngle_Parms.ReturnValue;
 };
@@ -2410,20 +2062,16 @@ struct FQuat UObject::QuatFromAxisAndAngle ( struct FVector const& Axis, float A
 
 struct FQuat UObject::QuatFindBetween ( struct FVector const& A, struct FVector const& B )
 {
-	static UFunction* pFnQuatFindBetween = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnQuatFindBetweenRef { L"Function Core.Object.QuatFindBetween", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnQuatFindBetween )
-		pFnQuatFindBetween = UObject::FindObject< UFunction > ( L"Function Core.Object.QuatFindBetween" );
+	UFunction* const pFnQuatFindBetween = pFnQuatFindBetweenRef.Get ( );
 
 	UObject_execQuatFindBetween_Parms QuatFindBetween_Parms;
 	memcpy ( &QuatFindBetween_Parms.A, &A, 0xC );
 	memcpy ( &QuatFindBetween_Parms.B, &B, 0xC );
 
-	pFnQuatFindBetween->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnQuatFindBetween, &QuatFindBetween_Parms, NULL );
-
-	pFnQuatFindBetween->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnQuatFindBetween, &QuatFindBetween_Parms ) )
+		this->ProcessEvent ( pFnQuatFindBetween, &QuatFindBetween_Parms, NULL );
 
 	return QuatFindBetween_Parms.ReturnValue;
 };
@@ -2437,20 +2085,16 @@ struct FQuat UObject::QuatFindBetween ( struct FVector const& A, struct FVector
 
 struct FVector UObject::QuatRotateVector ( struct FQuat const& A, struct FVector const& B )
 {
-	static UFunction* pFnQuatRotateVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnQuatRotateVectorRef { L"Function Core.Object.QuatRotateVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnQuatRotateVector )
-		pFnQuatRotateVector = UObject::FindObject< UFunction > ( L"Function Core.Object.QuatRotateVector" );
+	UFunction* const pFnQuatRotateVector = pFnQuatRotateVectorRef.Get ( );
 
 	UObject_execQuatRotateVector_Parms QuatRotateVector_Parms;
 	memcpy ( &QuatRotateVector_Parms.A, &A, 0x10 );
 	memcpy ( &QuatRotateVector_Parms.B, &B, 0xC );
 
-	pFnQuatRotateVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnQuatRotateVector, &QuatRotateVector_Parms, NULL );
-
-	pFnQuatRotateVector->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnQuatRotateVector, &QuatRotateVector_Parms ) )
+		this->ProcessEvent ( pFnQuatRotateVector, &QuatRotateVector_Parms, NULL );
 
 	return QuatRotateVector_Parms.ReturnValue;
 };
@@ -2463,19 +2107,15 @@ struct FVector UObject::QuatRotateVector ( struct FQuat const& A, struct FVector
 
 struct FQuat UObject::QuatInvert ( struct FQuat const& A )
 {
-	static UFunction* pFnQuatInvert = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnQuatInvertRef { L"Function Core.Object.QuatInvert", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnQuatInvert )
-		pFnQuatInvert = UObject::FindObject< UFunction > ( L"Function Core.Object.QuatInvert" );
+	UFunction* const pFnQuatInvert = pFnQuatInvertRef.Get ( );
 
 	UObject_execQuatInvert_Parms QuatInvert_Parms;
 	memcpy ( &QuatInvert_Parms.A, &A, 0x10 );
 
-	pFnQuatInvert->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnQuatInvert, &QuatInvert_Parms, NULL );
-
-	pFnQuatInvert->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnQuatInvert, &QuatInvert_Parms ) )
+		this->ProcessEvent ( pFnQuatInvert, &QuatInvert_Parms, NULL );
 
 	return QuatInvert_Parms.ReturnValue;
 };
@@ -2489,20 +2129,16 @@ struct FQuat UObject::QuatInvert ( struct FQuat const& A )
 
 float UObject::QuatDot ( struct FQuat const& A, struct FQuat const& B )
 {
-	static UFunction* pFnQuatDot = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnQuatDotRef { L"Function Core.Object.QuatDot", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnQuatDot )
-		pFnQuatDot = UObject::FindObject< UFunction > ( L"Function Core.Object.QuatDot" );
+	UFunction* const pFnQuatDot = pFnQuatDotRef.Get ( );
 
 	UObject_execQuatDot_Parms QuatDot_Parms;
 	memcpy ( &QuatDot_Parms.A, &A, 0x10 );
 	memcpy ( &QuatDot_Parms.B, &B, 0x10 );
 
-	pFnQuatDot->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnQuatDot, &QuatDot_Parms, NULL );
-
-	pFnQuatDot->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnQuatDot, &QuatDot_Parms ) )
+		this->ProcessEvent ( pFnQuatDot, &QuatDot_Parms, NULL );
 
 	return QuatDot_Parms.ReturnValue;
 };
@@ -2516,20 +2152,16 @@ float UObject::QuatDot ( struct FQuat const& A, struct FQuat const& B )
 
 struct FQuat UObject::QuatProduct ( struct FQuat const& A, struct FQuat const& B )
 {
-	static UFunction* pFnQuatProduct = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnQuatProductRef { L"Function Core.Object.QuatProduct", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnQuatProduct )
-		pFnQuatProduct = UObject::FindObject< UFunction > ( L"Function Core.Object.QuatProduct" );
+	UFunction* const pFnQuatProduct = pFnQuatProductRef.Get ( );
 
 	UObject_execQuatProduct_Parms QuatProduct_Parms;
 	memcpy ( &QuatProduct_Parms.A, &A, 0x10 );
 	memcpy ( &QuatProduct_Parms.B, &B, 0x10 );
 
-	pFnQuatProduct->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnQuatProduct, &QuatProduct_Parms, NULL );
-
-	pFnQuatProduct->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnQuatProduct, &QuatProduct_Parms ) )
+		this->ProcessEvent ( pFnQuatProduct, &QuatProduct_Parms, NULL );
 
 	return QuatProduct_Parms.ReturnValue;
 };
@@ -2543,20 +2175,16 @@ struct FQuat UObject::QuatProduct ( struct FQuat const& A, struct FQuat const& B
 
 struct FVector UObject::MatrixGetAxis ( struct FMatrix const& TM, unsigned char Axis )
 {
-	static UFunction* pFnMatrixGetAxis = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMatrixGetAxisRef { L"Function Core.Object.MatrixGetAxis", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMatrixGetAxis )
-		pFnMatrixGetAxis = UObject::FindObject< UFunction > ( L"Function Core.Object.MatrixGetAxis" );
+	UFunction* const pFnMatrixGetAxis = pFnMatrixGetAxisRef.Get ( );
 
 	UObject_execMatrixGetAxis_Parms MatrixGetAxis_Parms;
 	memcpy ( &MatrixGetAxis_Parms.TM, &TM, 0x40 );
 	MatrixGetAxis_Parms.Axis = Axis;
 
-	pFnMatrixGetAxis->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMatrixGetAxis, &MatrixGetAxis_Parms, NULL );
-
-	pFnMatrixGetAxis->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnMatrixGetAxis, &MatrixGetAxis_Parms ) )
+		this->ProcessEvent ( pFnMatrixGetAxis, &MatrixGetAxis_Parms, NULL );
 
 	return MatrixGetAxis_Parms.ReturnValue;
 };
@@ -2569,19 +2197,15 @@ struct FVector UObject::MatrixGetAxis ( struct FMatrix const& TM, unsigned char
 
 struct FVector UObject::MatrixGetOrigin ( struct FMatrix const& TM )
 {
-	static UFunction* pFnMatrixGetOrigin = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMatrixGetOriginRef { L"Function Core.Object.MatrixGetOrigin", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMatrixGetOrigin )
-		pFnMatrixGetOrigin = UObject::FindObject< UFunction > ( L"Function Core.Object.MatrixGetOrigin" );
+	UFunction* const pFnMatrixGetOrigin = pFnMatrixGetOriginRef.Get ( );
 
 	UObject_execMatrixGetOrigin_Parms MatrixGetOrigin_Parms;
 	memcpy ( &MatrixGetOrigin_Parms.TM, &TM, 0x40 );
 
-	pFnMatrixGetOrigin->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMatrixGetOrigin, &MatrixGetOrigin_Parms, NULL );
-
-	pFnMatrixGetOrigin->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnMatrixGetOrigin, &MatrixGetOrigin_Parms ) )
+		this->ProcessEvent ( pFnMatrixGetOrigin, &MatrixGetOrigin_Parms, NULL );
 
 	return MatrixGetOrigin_Parms.ReturnValue;
 };
@@ -2594,19 +2218,15 @@ struct FVector UObject::MatrixGetOrigin ( struct FMatrix const& TM )
 
 struct FRotator UObject::MatrixGetRotator ( struct FMatrix const& TM )
 {
-	static UFunction* pFnMatrixGetRotator = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMatrixGetRotatorRef { L"Function Core.Object.MatrixGetRotator", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMatrixGetRotator )
-		pFnMatrixGetRotator = UObject::FindObject< UFunction > ( L"Function Core.Object.MatrixGetRotator" );
+	UFunction* const pFnMatrixGetRotator = pFnMatrixGetRotatorRef.Get ( );
 
 	UObject_execMatrixGetRotator_Parms MatrixGetRotator_Parms;
 	memcpy ( &MatrixGetRotator_Parms.TM, &TM, 0x40 );
 
-	pFnMatrixGetRotator->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMatrixGetRotator, &MatrixGetRotator_Parms, NULL );
-
-	pFnMatrixGetRotator->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnMatrixGetRotator, &MatrixGetRotator_Parms ) )
+		this->ProcessEvent ( pFnMatrixGetRotator, &MatrixGetRotator_Parms, NULL );
 
 	return MatrixGetRotator_Parms.ReturnValue;
 };
@@ -2619,19 +2239,15 @@ struct FRotator UObject::MatrixGetRotator ( struct FMatrix const& TM )
 
 struct FMatrix UObject::MakeRotationMatrix ( struct FRotator const& Rotation )
 {
-	static UFunction* pFnMakeRotationMatrix = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMakeRotationMatrixRef { L"Function Core.Object.MakeRotationMatrix", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMakeRotationMatrix )
-		pFnMakeRotationMatrix = UObject::FindObject< UFunction > ( L"Function Core.Object.MakeRotationMatrix" );
+	UFunction* const pFnMakeRotationMatrix = pFnMakeRotationMatrixRef.Get ( );
 
 	UObject_execMakeRotationMatrix_Parms MakeRotationMatrix_Parms;
 	memcpy ( &MakeRotationMatrix_Parms.Rotation, &Rotation, 0xC );
 
-	pFnMakeRotationMatrix->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMakeRotationMatrix, &MakeRotationMatrix_Parms, NULL );
-
-	pFnMakeRotationMatrix->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnMakeRotationMatrix, &MakeRotationMatrix_Parms ) )
+		this->ProcessEvent ( pFnMakeRotationMatrix, &MakeRotationMatrix_Parms, NULL );
 
 	return MakeRotationMatrix_Parms.ReturnValue;
 };
@@ -2645,20 +2261,16 @@ struct FMatrix UObject::MakeRotationMatrix ( struct FRotator const& Rotation )
 
 struct FMatrix UObject::MakeRotationTranslationMatrix ( struct FVector const& Translation, struct FRotator const& Rotation )
 {
-	static UFunction* pFnMakeRotationTranslationMatrix = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMakeRotationTranslationMatrixRef { L"Function Core.Object.MakeRotationTranslationMatrix", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMakeRotationTranslationMatrix )
-		pFnMakeRotationTranslationMatrix = UObject::FindObject< UFunction > ( L"Function Core.Object.MakeRotationTranslationMatrix" );
+	UFunction* const pFnMakeRotationTranslationMatrix = pFnMakeRotationTranslationMatrixRef.Get ( );
 
 	UObject_execMakeRotationTranslationMatrix_Parms MakeRotationTranslationMatrix_Parms;
 	memcpy ( &MakeRotationTranslationMatrix_Parms.Translation, &Translation, 0xC );
 	memcpy ( &MakeRotationTranslationMatrix_Parms.Rotation, &Rotation, 0xC );
 
-	pFnMakeRotationTranslationMatrix->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMakeRotationTranslationMatrix, &MakeRotationTranslationMatrix_Parms, NULL );
-
-	pFnMakeRotationTranslationMatrix->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnMakeRotationTranslationMatrix, &MakeRotationTranslationMatrix_Parms ) )
+		this->ProcessEvent ( pFnMakeRotationTranslationMatrix, &MakeRotationTranslationMatrix_Parms, NULL );
 
 	return MakeRotationTranslationMatrix_Parms.ReturnValue;
 };
@@ -2672,20 +2284,16 @@ struct FMatrix UObject::MakeRotationTranslationMatrix ( struct FVector const& Tr
 
 struct FVector UObject::InverseTransformNormal ( struct FMatrix const& TM, struct FVector const& A )
 {
-	static UFunction* pFnInverseTransformNormal = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInverseTransformNormalRef { L"Function Core.Object.InverseTransformNormal", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInverseTransformNormal )
-		pFnInverseTransformNormal = UObject::FindObject< UFunction > ( L"Function Core.Object.InverseTransformNormal" );
+	UFunction* const pFnInverseTransformNormal = pFnInverseTransformNormalRef.Get ( );
 
 	UObject_execInverseTransformNormal_Parms InverseTransformNormal_Parms;
 	memcpy ( &InverseTransformNormal_Parms.TM, &TM, 0x40 );
 	memcpy ( &InverseTransformNormal_Parms.A, &A, 0xC );
 
-	pFnInverseTransformNormal->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnInverseTransformNormal, &InverseTransformNormal_Parms, NULL );
-
-	pFnInverseTransformNormal->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnInverseTransformNormal, &InverseTransformNormal_Parms ) )
+		this->ProcessEvent ( pFnInverseTransformNormal, &InverseTransformNormal_Parms, NULL );
 
 	return InverseTransformNormal_Parms.ReturnValue;
 };
@@ -2699,20 +2307,16 @@ struct FVector UObject::InverseTransformNormal ( struct FMatrix const& TM, struc
 
 struct FVector UObject::TransformNormal ( struct FMatrix const& TM, struct FVector const& A )
 {
-	static UFunction* pFnTransformNormal = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTransformNormalRef { L"Function Core.Object.TransformNormal", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTransformNormal )
-		pFnTransformNormal = UObject::FindObject< UFunction > ( L"Function Core.Object.TransformNormal" );
+	UFunction* const pFnTransformNormal = pFnTransformNormalRef.Get ( );
 
 	UObject_execTransformNormal_Parms TransformNormal_Parms;
 	memcpy ( &TransformNormal_Parms.TM, &TM, 0x40 );
 	memcpy ( &TransformNormal_Parms.A, &A, 0xC );
 
-	pFnTransformNormal->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnTransformNormal, &TransformNormal_Parms, NULL );
-
-	pFnTransformNormal->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnTransformNormal, &TransformNormal_Parms ) )
+		this->ProcessEvent ( pFnTransformNormal, &TransformNormal_Parms, NULL );
 
 	return TransformNormal_Parms.ReturnValue;
 };
@@ -2726,20 +2330,16 @@ struct FVector UObject::TransformNormal ( struct FMatrix const& TM, struct FVect
 
 struct FVector UObject::InverseTransformVector ( struct FMatrix const& TM, struct FVector const& A )
 {
-	static UFunction* pFnInverseTransformVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInverseTransformVectorRef { L"Function Core.Object.InverseTransformVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInverseTransformVector )
-		pFnInverseTransformVector = UObject::FindObject< UFunction > ( L"Function Core.Object.InverseTransformVector" );
+	UFunction* const pFnInverseTransformVector = pFnInverseTransformVectorRef.Get ( );
 
 	UObject_execInverseTransformVector_Parms InverseTransformVector_Parms;
 	memcpy ( &InverseTransformVector_Parms.TM, &TM, 0x40 );
 	memcpy ( &InverseTransformVector_Parms.A, &A, 0xC );
 
-	pFnInverseTransformVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnInverseTransformVector, &InverseTransformVector_Parms, NULL );
-
-	pFnInverseTransformVector->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnInverseTransformVector, &InverseTransformVector_Parms ) )
+		this->ProcessEvent ( pFnInverseTransformVector, &InverseTransformVector_Parms, NULL );
 
 	return InverseTransformVector_Parms.ReturnValue;
 };
@@ -2753,20 +2353,16 @@ struct FVector UObject::InverseTransformVector ( struct FMatrix const& TM, struc
 
 struct FVector UObject::TransformVector ( struct FMatrix const& TM, struct FVector const& A )
 {
-	static UFunction* pFnTransformVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTransformVectorRef { L"Function Core.Object.TransformVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTransformVector )
-		pFnTransformVector = UObject::FindObject< UFunction > ( L"Function Core.Object.TransformVector" );
+	UFunction* const pFnTransformVector = pFnTransformVectorRef.Get ( );
 
 	UObject_execTransformVector_Parms TransformVector_Parms;
 	memcpy ( &TransformVector_Parms.TM, &TM, 0x40 );
 	memcpy ( &TransformVector_Parms.A, &A, 0xC );
 
-	pFnTransformVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnTransformVector, &TransformVector_Parms, NULL );
-
-	pFnTransformVector->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnTransformVector, &TransformVector_Parms ) )
+		this->ProcessEvent ( pFnTransformVector, &TransformVector_Parms, NULL );
 
 	return TransformVector_Parms.ReturnValue;
 };
@@ -2780,20 +2376,16 @@ struct FVector UObject::TransformVector ( struct FMatrix const& TM, struct FVect
 
 struct FMatrix UObject::Multiply_MatrixMatrix ( struct FMatrix const& A, struct FMatrix const& B )
 {
-	static UFunction* pFnMultiply_MatrixMatrix = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiply_MatrixMatrixRef { L"Function Core.Object.Multiply_MatrixMatrix", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiply_MatrixMatrix )
-		pFnMultiply_MatrixMatrix = UObject::FindObject< UFunction > ( L"Function Core.Object.Multiply_MatrixMatrix" );
+	UFunction* const pFnMultiply_MatrixMatrix = pFnMultiply_MatrixMatrixRef.Get ( );
 
 	UObject_execMultiply_MatrixMatrix_Parms Multiply_MatrixMatrix_Parms;
 	memcpy ( &Multiply_MatrixMatrix_Parms.A, &A, 0x40 );
 	memcpy ( &Multiply_MatrixMatrix_Parms.B, &B, 0x40 );
 
-	pFnMultiply_MatrixMatrix->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiply_MatrixMatrix, &Multiply_MatrixMatrix_Parms, NULL );
-
-	pFnMultiply_MatrixMatrix->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnMultiply_MatrixMatrix, &Multiply_MatrixMatrix_Parms ) )
+		this->ProcessEvent ( pFnMultiply_MatrixMatrix, &Multiply_MatrixMatrix_Parms, NULL );
 
 	return Multiply_MatrixMatrix_Parms.ReturnValue;
 };
@@ -2807,25 +2399,16 @@ struct FMatrix UObject::Multiply_MatrixMatrix ( struct FMatrix const& A, struct
 
 bool UObject::NotEqual_NameName ( struct SFXName A, struct SFXName B )
 {
-	static UFunction* pFnNotEqual_NameName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotEqual_NameNameRef { L"Function Core.Object.NotEqual_NameName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotEqual_NameName )
-		pFnNotEqual_NameName = UObject::FindObject< UFunction > ( L"Function Core.Object.NotEqual_NameName" );
+	UFunction* const pFnNotEqual_NameName = pFnNotEqual_NameNameRef.Get ( );
 
 	UObject_execNotEqual_NameName_Parms NotEqual_NameName_Parms;
 	memcpy ( &NotEqual_NameName_Parms.A, &A, 0x8 );
 	memcpy ( &NotEqual_NameName_Parms.B, &B, 0x8 );
 
-	unsigned short NativeIndex = pFnNotEqual_NameName->iNative;
-	pFnNotEqual_NameName->iNative = 0;
-
-	pFnNotEqual_NameName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotEqual_NameName, &NotEqual_NameName_Parms, NULL );
-
-	pFnNotEqual_NameName->FunctionFlags |= 0x400;
-
-	pFnNotEqual_NameName->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnNotEqual_NameName, &NotEqual_NameName_Parms ) )
+		this->ProcessEvent ( pFnNotEqual_NameName, &NotEqual_NameName_Parms, NULL );
 
 	return NotEqual_NameName_Parms.ReturnValue;
 };
@@ -2839,25 +2422,16 @@ bool UObject::NotEqual_NameName ( struct SFXName A, struct SFXName B )
 
 bool UObject::EqualEqual_NameName ( struct SFXName A, struct SFXName B )
 {
-	static UFunction* pFnEqualEqual_NameName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEqualEqual_NameNameRef { L"Function Core.Object.EqualEqual_NameName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEqualEqual_NameName )
-		pFnEqualEqual_NameName = UObject::FindObject< UFunction > ( L"Function Core.Object.EqualEqual_NameName" );
+	UFunction* const pFnEqualEqual_NameName = pFnEqualEqual_NameNameRef.Get ( );
 
 	UObject_execEqualEqual_NameName_Parms EqualEqual_NameName_Parms;
 	memcpy ( &EqualEqual_NameName_Parms.A, &A, 0x8 );
 	memcpy ( &EqualEqual_NameName_Parms.B, &B, 0x8 );
 
-	unsigned short NativeIndex = pFnEqualEqual_NameName->iNative;
-	pFnEqualEqual_NameName->iNative = 0;
-
-	pFnEqualEqual_NameName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEqualEqual_NameName, &EqualEqual_NameName_Parms, NULL );
-
-	pFnEqualEqual_NameName->FunctionFlags |= 0x400;
-
-	pFnEqualEqual_NameName->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnEqualEqual_NameName, &EqualEqual_NameName_Parms ) )
+		this->ProcessEvent ( pFnEqualEqual_NameName, &EqualEqual_NameName_Parms, NULL );
 
 	return EqualEqual_NameName_Parms.ReturnValue;
 };
@@ -2870,24 +2444,15 @@ bool UObject::EqualEqual_NameName ( struct SFXName A, struct SFXName B )
 
 bool UObject::IsA ( struct SFXName ClassName )
 {
-	static UFunction* pFnIsA = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsARef { L"Function Core.Object.IsA", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsA )
-		pFnIsA = UObject::FindObject< UFunction > ( L"Function Core.Object.IsA" );
+	UFunction* const pFnIsA = pFnIsARef.Get ( );
 
 	UObject_execIsA_Parms IsA_Parms;
 	memcpy ( &IsA_Parms.ClassName, &ClassName, 0x8 );
 
-	unsigned short NativeIndex = pFnIsA->iNative;
-	pFnIsA->iNative = 0;
-
-	pFnIsA->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsA, &IsA_Parms, NULL );
-
-	pFnIsA->FunctionFlags |= 0x400;
-
-	pFnIsA->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnIsA, &IsA_Parms ) )
+		this->ProcessEvent ( pFnIsA, &IsA_Parms, NULL );
 
 	return IsA_Parms.ReturnValue;
 };
@@ -2901,25 +2466,16 @@ bool UObject::IsA ( struct SFXName ClassName )
 
 bool UObject::ClassIsChildOf ( class UClass* TestClass, class UClass* ParentClass )
 {
-	static UFunction* pFnClassIsChildOf = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClassIsChildOfRef { L"Function Core.Object.ClassIsChildOf", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClassIsChildOf )
-		pFnClassIsChildOf = UObject::FindObject< UFunction > ( L"Function Core.Object.ClassIsChildOf" );
+	UFunction* const pFnClassIsChildOf = pFnClassIsChildOfRef.Get ( );
 
 	UObject_execClassIsChildOf_Parms ClassIsChildOf_Parms;
 	ClassIsChildOf_Parms.TestClass = TestClass;
 	ClassIsChildOf_Parms.ParentClass = ParentClass;
 
-	unsigned short NativeIndex = pFnClassIsChildOf->iNative;
-	pFnClassIsChildOf->iNative = 0;
-
-	pFnClassIsChildOf->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnClassIsChildOf, &ClassIsChildOf_Parms, NULL );
-
-	pFnClassIsChildOf->FunctionFlags |= 0x400;
-
-	pFnClassIsChildOf->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnClassIsChildOf, &ClassIsChildOf_Parms ) )
+		this->ProcessEvent ( pFnClassIsChildOf, &ClassIsChildOf_Parms, NULL );
 
 	return ClassIsChildOf_Parms.ReturnValue;
 };
@@ -2933,20 +2489,16 @@ bool UObject::ClassIsChildOf ( class UClass* TestClass, class UClass* ParentClas
 
 bool UObject::NotEqual_InterfaceInterface ( class UInterface* A, class UInterface* B )
 {
-	static UFunction* pFnNotEqual_InterfaceInterface = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotEqual_InterfaceInterfaceRef { L"Function Core.Object.NotEqual_InterfaceInterface", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotEqual_InterfaceInterface )
-		pFnNotEqual_InterfaceInterface = UObject::FindObject< UFunction > ( L"Function Core.Object.NotEqual_InterfaceInterface" );
+	UFunction* const pFnNotEqual_InterfaceInterface = pFnNotEqual_InterfaceInterfaceRef.Get ( );
 
 	UObject_execNotEqual_InterfaceInterface_Parms NotEqual_InterfaceInterface_Parms;
 	NotEqual_InterfaceInterface_Parms.A = A;
 	NotEqual_InterfaceInterface_Parms.B = B;
 
-	pFnNotEqual_InterfaceInterface->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotEqual_InterfaceInterface, &NotEqual_InterfaceInterface_Parms, NULL );
-
-	pFnNotEqual_InterfaceInterface->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNotEqual_InterfaceInterface, &NotEqual_InterfaceInterface_Parms ) )
+		this->ProcessEvent ( pFnNotEqual_InterfaceInterface, &NotEqual_InterfaceInterface_Parms, NULL );
 
 	return NotEqual_InterfaceInterface_Parms.ReturnValue;
 };
@@ -2960,20 +2512,16 @@ bool UObject::NotEqual_InterfaceInterface ( class UInterface* A, class UInterfac
 
 bool UObject::EqualEqual_InterfaceInterface ( class UInterface* A, class UInterface* B )
 {
-	static UFunction* pFnEqualEqual_InterfaceInterface = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEqualEqual_InterfaceInterfaceRef { L"Function Core.Object.EqualEqual_InterfaceInterface", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEqualEqual_InterfaceInterface )
-		pFnEqualEqual_InterfaceInterface = UObject::FindObject< UFunction > ( L"Function Core.Object.EqualEqual_InterfaceInterface" );
+	UFunction* const pFnEqualEqual_InterfaceInterface = pFnEqualEqual_InterfaceInterfaceRef.Get ( );
 
 	UObject_execEqualEqual_InterfaceInterface_Parms EqualEqual_InterfaceInterface_Parms;
 	EqualEqual_InterfaceInterface_Parms.A = A;
 	EqualEqual_InterfaceInterface_Parms.B = B;
 
-	pFnEqualEqual_InterfaceInterface->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEqualEqual_InterfaceInterface, &EqualEqual_InterfaceInterface_Parms, NULL );
-
-	pFnEqualEqual_InterfaceInterface->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnEqualEqual_InterfaceInterface, &EqualEqual_InterfaceInterface_Parms ) )
+		this->ProcessEvent ( pFnEqualEqual_InterfaceInterface, &EqualEqual_InterfaceInterface_Parms, NULL );
 
 	return EqualEqual_InterfaceInterface_Parms.ReturnValue;
 };
@@ -2987,25 +2535,16 @@ bool UObject::EqualEqual_InterfaceInterface ( class UInterface* A, class UInterf
 
 bool UObject::NotEqual_ObjectObject ( class UObject* A, class UObject* B )
 {
-	static UFunction* pFnNotEqual_ObjectObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotEqual_ObjectObjectRef { L"Function Core.Object.NotEqual_ObjectObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotEqual_ObjectObject )
-		pFnNotEqual_ObjectObject = UObject::FindObject< UFunction > ( L"Function Core.Object.NotEqual_ObjectObject" );
+	UFunction* const pFnNotEqual_ObjectObject = pFnNotEqual_ObjectObjectRef.Get ( );
 
 	UObject_execNotEqual_ObjectObject_Parms NotEqual_ObjectObject_Parms;
 	NotEqual_ObjectObject_Parms.A = A;
 	NotEqual_ObjectObject_Parms.B = B;
 
-	unsigned short NativeIndex = pFnNotEqual_ObjectObject->iNative;
-	pFnNotEqual_ObjectObject->iNative = 0;
-
-	pFnNotEqual_ObjectObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotEqual_ObjectObject, &NotEqual_ObjectObject_Parms, NULL );
-
-	pFnNotEqual_ObjectObject->FunctionFlags |= 0x400;
-
-	pFnNotEqual_ObjectObject->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnNotEqual_ObjectObject, &NotEqual_ObjectObject_Parms ) )
+		this->ProcessEvent ( pFnNotEqual_ObjectObject, &NotEqual_ObjectObject_Parms, NULL );
 
 	return NotEqual_ObjectObject_Parms.ReturnValue;
 };
@@ -3019,25 +2558,16 @@ bool UObject::NotEqual_ObjectObject ( class UObject* A, class UObject* B )
 
 bool UObject::EqualEqual_ObjectObject ( class UObject* A, class UObject* B )
 {
-	static UFunction* pFnEqualEqual_ObjectObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEqualEqual_ObjectObjectRef { L"Function Core.Object.EqualEqual_ObjectObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEqualEqual_ObjectObject )
-		pFnEqualEqual_ObjectObject = UObject::FindObject< UFunction > ( L"Function Core.Object.EqualEqual_ObjectObject" );
+	UFunction* const pFnEqualEqual_ObjectObject = pFnEqualEqual_ObjectObjectRef.Get ( );
 
 	UObject_execEqualEqual_ObjectObject_Parms EqualEqual_ObjectObject_Parms;
 	EqualEqual_ObjectObject_Parms.A = A;
 	EqualEqual_ObjectObject_Parms.B = B;
 
-	unsigned short NativeIndex = pFnEqualEqual_ObjectObject->iNative;
-	pFnEqualEqual_ObjectObject->iNative = 0;
-
-	pFnEqualEqual_ObjectObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEqualEqual_ObjectObject, &EqualEqual_ObjectObject_Parms, NULL );
-
-	pFnEqualEqual_ObjectObject->FunctionFlags |= 0x400;
-
-	pFnEqualEqual_ObjectObject->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnEqualEqual_ObjectObject, &EqualEqual_ObjectObject_Parms ) )
+		this->ProcessEvent ( pFnEqualEqual_ObjectObject, &EqualEqual_ObjectObject_Parms, NULL );
 
 	return EqualEqual_ObjectObject_Parms.ReturnValue;
 };
@@ -3050,19 +2580,15 @@ bool UObject::EqualEqual_ObjectObject ( class UObject* A, class UObject* B )
 
 FString UObject::PathName ( class UObject* CheckObject )
 {
-	static UFunction* pFnPathName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPathNameRef { L"Function Core.Object.PathName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPathName )
-		pFnPathName = UObject::FindObject< UFunction > ( L"Function Core.Object.PathName" );
+	UFunction* const pFnPathName = pFnPathNameRef.Get ( );
 
 	UObject_execPathName_Parms PathName_Parms;
 	PathName_Parms.CheckObject = CheckObject;
 
-	pFnPathName->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnPathName, &PathName_Parms, NULL );
-
-	pFnPathName->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnPathName, &PathName_Parms ) )
+		this->ProcessEvent ( pFnPathName, &PathName_Parms, NULL );
 
 	return PathName_Parms.ReturnValue;
 };
@@ -3077,10 +2603,9 @@ FString UObject::PathName ( class UObject* CheckObject )
 
 TArray<FString> UObject::SplitString ( FString const& Source, FString const& Delimiter, unsigned long bCullEmpty )
 {
-	static UFunction* pFnSplitString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSplitStringRef { L"Function Core.Object.SplitString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSplitString )
-		pFnSplitString = UObject::FindObject< UFunction > ( L"Function Core.Object.SplitString" );
+	UFunction* const pFnSplitString = pFnSplitStringRef.Get ( );
 
 	UObject_execSplitString_Parms SplitString_Parms;
 	memcpy ( &SplitString_Parms.Source, &Source, 0x10 );
@@ -3102,10 +2627,9 @@ TArray<FString> UObject::SplitString ( FString const& Source, FString const& Del
 
 void UObject::ParseStringIntoArray ( FString const& BaseString, FString const& delim, unsigned long bCullEmpty, TArray<FString>* Pieces )
 {
-	static UFunction* pFnParseStringIntoArray = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnParseStringIntoArrayRef { L"Function Core.Object.ParseStringIntoArray", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnParseStringIntoArray )
-		pFnParseStringIntoArray = UObject::FindObject< UFunction > ( L"Function Core.Object.ParseStringIntoArray" );
+	UFunction* const pFnParseStringIntoArray = pFnParseStringIntoArrayRef.Get ( );
 
 	UObject_execParseStringIntoArray_Parms ParseStringIntoArray_Parms;
 	memcpy ( &ParseStringIntoArray_Parms.BaseString, &BaseString, 0x10 );
@@ -3115,11 +2639,8 @@ void UObject::ParseStringIntoArray ( FString const& BaseString, FString const& d
 	if ( Pieces )
 		memcpy ( &ParseStringIntoArray_Parms.Pieces, Pieces, 0x10 );
 
-	pFnParseStringIntoArray->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnParseStringIntoArray, &ParseStringIntoArray_Parms, NULL );
-
-	pFnParseStringIntoArray->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnParseStringIntoArray, &ParseStringIntoArray_Parms ) )
+		this->ProcessEvent ( pFnParseStringIntoArray, &ParseStringIntoArray_Parms, NULL );
 
 	if ( Pieces )
 		memcpy ( Pieces, &ParseStringIntoArray_Parms.Pieces, 0x10 );
@@ -3135,10 +2656,9 @@ void UObject::ParseStringIntoArray ( FString const& BaseString, FString const& d
 
 void UObject::JoinArray ( TArray<FString> const& StringArray, FString const& delim, unsigned long bIgnoreBlanks, FString* out_Result )
 {
-	static UFunction* pFnJoinArray = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnJoinArrayRef { L"Function Core.Object.JoinArray", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnJoinArray )
-		pFnJoinArray = UObject::FindObject< UFunction > ( L"Function Core.Object.JoinArray" );
+	UFunction* const pFnJoinArray = pFnJoinArrayRef.Get ( );
 
 	UObject_execJoinArray_Parms JoinArray_Parms;
 	memcpy ( &JoinArray_Parms.StringArray, &StringArray, 0x10 );
@@ -3162,10 +2682,9 @@ void UObject::JoinArray ( TArray<FString> const& StringArray, FString const& del
 
 FString UObject::GetRightMost ( FString const& Text )
 {
-	static UFunction* pFnGetRightMost = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetRightMostRef { L"Function Core.Object.GetRightMost", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetRightMost )
-		pFnGetRightMost = UObject::FindObject< UFunction > ( L"Function Core.Object.GetRightMost" );
+	UFunction* const pFnGetRightMost = pFnGetRightMostRef.Get ( );
 
 	UObject_execGetRightMost_Parms GetRightMost_Parms;
 	memcpy ( &GetRightMost_Parms.Text, &Text, 0x10 );
@@ -3185,10 +2704,9 @@ FString UObject::GetRightMost ( FString const& Text )
 
 FString UObject::Split ( FString const& Text, FString const& SplitStr, unsigned long bOmitSplitStr )
 {
-	static UFunction* pFnSplit = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSplitRef { L"Function Core.Object.Split", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSplit )
-		pFnSplit = UObject::FindObject< UFunction > ( L"Function Core.Object.Split" );
+	UFunction* const pFnSplit = pFnSplitRef.Get ( );
 
 	UObject_execSplit_Parms Split_Parms;
 	memcpy ( &Split_Parms.Text, &Text, 0x10 );
@@ -3211,10 +2729,9 @@ FString UObject::Split ( FString const& Text, FString const& SplitStr, unsigned
 
 FString UObject::Repl ( FString const& Src, FString const& Match, FString const& With, unsigned long bCaseSensitive )
 {
-	static UFunction* pFnRepl = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReplRef { L"Function Core.Object.Repl", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRepl )
-		pFnRepl = UObject::FindObject< UFunction > ( L"Function Core.Object.Repl" );
+	UFunction* const pFnRepl = pFnReplRef.Get ( );
 
 	UObject_execRepl_Parms Repl_Parms;
 	memcpy ( &Repl_Parms.Src, &Src, 0x10 );
@@ -3222,16 +2739,8 @@ FString UObject::Repl ( FString const& Src, FString const& Match, FString const&
 	memcpy ( &Repl_Parms.With, &With, 0x10 );
 	Repl_Parms.bCaseSensitive = bCaseSensitive;
 
-	unsigned short NativeIndex = pFnRepl->iNative;
-	pFnRepl->iNative = 0;
-
-	pFnRepl->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRepl, &Repl_Parms, NULL );
-
-	pFnRepl->FunctionFlags |= 0x400;
-
-	pFnRepl->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnRepl, &Repl_Parms ) )
+		this->ProcessEvent ( pFnRepl, &Repl_Parms, NULL );
 
 	return Repl_Parms.ReturnValue;
 };
@@ -3244,24 +2753,15 @@ FString UObject::Repl ( FString const& Src, FString const& Match, FString const&
 
 int UObject::Asc ( FString const& S )
 {
-	static UFunction* pFnAsc = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAscRef { L"Function Core.Object.Asc", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAsc )
-		pFnAsc = UObject::FindObject< UFunction > ( L"Function Core.Object.Asc" );
+	UFunction* const pFnAsc = pFnAscRef.Get ( );
 
 	UObject_execAsc_Parms Asc_Parms;
 	memcpy ( &Asc_Parms.S, &S, 0x10 );
 
-	unsigned short NativeIndex = pFnAsc->iNative;
-	pFnAsc->iNative = 0;
-
-	pFnAsc->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAsc, &Asc_Parms, NULL );
-
-	pFnAsc->FunctionFlags |= 0x400;
-
-	pFnAsc->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAsc, &Asc_Parms ) )
+		this->ProcessEvent ( pFnAsc, &Asc_Parms, NULL );
 
 	return Asc_Parms.ReturnValue;
 };
@@ -3274,24 +2774,15 @@ int UObject::Asc ( FString const& S )
 
 FString UObject::Chr ( int I )
 {
-	static UFunction* pFnChr = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnChrRef { L"Function Core.Object.Chr", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnChr )
-		pFnChr = UObject::FindObject< UFunction > ( L"Function Core.Object.Chr" );
+	UFunction* const pFnChr = pFnChrRef.Get ( );
 
 	UObject_execChr_Parms Chr_Parms;
 	Chr_Parms.I = I;
 
-	unsigned short NativeIndex = pFnChr->iNative;
-	pFnChr->iNative = 0;
-
-	pFnChr->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnChr, &Chr_Parms, NULL );
-
-	pFnChr->FunctionFlags |= 0x400;
-
-	pFnChr->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnChr, &Chr_Parms ) )
+		this->ProcessEvent ( pFnChr, &Chr_Parms, NULL );
 
 	return Chr_Parms.ReturnValue;
 };
@@ -3304,24 +2795,15 @@ FString UObject::Chr ( int I )
 
 FString UObject::Locs ( FString const& S )
 {
-	static UFunction* pFnLocs = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLocsRef { L"Function Core.Object.Locs", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLocs )
-		pFnLocs = UObject::FindObject< UFunction > ( L"Function Core.Object.Locs" );
+	UFunction* const pFnLocs = pFnLocsRef.Get ( );
 
 	UObject_execLocs_Parms Locs_Parms;
 	memcpy ( &Locs_Parms.S, &S, 0x10 );
 
-	unsigned short NativeIndex = pFnLocs->iNative;
-	pFnLocs->iNative = 0;
-
-	pFnLocs->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLocs, &Locs_Parms, NULL );
-
-	pFnLocs->FunctionFlags |= 0x400;
-
-	pFnLocs->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnLocs, &Locs_Parms ) )
+		this->ProcessEvent ( pFnLocs, &Locs_Parms, NULL );
 
 	return Locs_Parms.ReturnValue;
 };
@@ -3334,24 +2816,15 @@ FString UObject::Locs ( FString const& S )
 
 FString UObject::Caps ( FString const& S )
 {
-	static UFunction* pFnCaps = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCapsRef { L"Function Core.Object.Caps", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCaps )
-		pFnCaps = UObject::FindObject< UFunction > ( L"Function Core.Object.Caps" );
+	UFunction* const pFnCaps = pFnCapsRef.Get ( );
 
 	UObject_execCaps_Parms Caps_Parms;
 	memcpy ( &Caps_Parms.S, &S, 0x10 );
 
-	unsigned short NativeIndex = pFnCaps->iNative;
-	pFnCaps->iNative = 0;
-
-	pFnCaps->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCaps, &Caps_Parms, NULL );
-
-	pFnCaps->FunctionFlags |= 0x400;
-
-	pFnCaps->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnCaps, &Caps_Parms ) )
+		this->ProcessEvent ( pFnCaps, &Caps_Parms, NULL );
 
 	return Caps_Parms.ReturnValue;
 };
@@ -3365,25 +2838,16 @@ FString UObject::Caps ( FString const& S )
 
 FString UObject::Right ( FString const& S, int I )
 {
-	static UFunction* pFnRight = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRightRef { L"Function Core.Object.Right", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRight )
-		pFnRight = UObject::FindObject< UFunction > ( L"Function Core.Object.Right" );
+	UFunction* const pFnRight = pFnRightRef.Get ( );
 
 	UObject_execRight_Parms Right_Parms;
 	memcpy ( &Right_Parms.S, &S, 0x10 );
 	Right_Parms.I = I;
 
-	unsigned short NativeIndex = pFnRight->iNative;
-	pFnRight->iNative = 0;
-
-	pFnRight->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRight, &Right_Parms, NULL );
-
-	pFnRight->FunctionFlags |= 0x400;
-
-	pFnRight->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnRight, &Right_Parms ) )
+		this->ProcessEvent ( pFnRight, &Right_Parms, NULL );
 
 	return Right_Parms.ReturnValue;
 };
@@ -3397,25 +2861,16 @@ FString UObject::Right ( FString const& S, int I )
 
 FString UObject::Left ( FString const& S, int I )
 {
-	static UFunction* pFnLeft = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLeftRef { L"Function Core.Object.Left", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLeft )
-		pFnLeft = UObject::FindObject< UFunction > ( L"Function Core.Object.Left" );
+	UFunction* const pFnLeft = pFnLeftRef.Get ( );
 
 	UObject_execLeft_Parms Left_Parms;
 	memcpy ( &Left_Parms.S, &S, 0x10 );
 	Left_Parms.I = I;
 
-	unsigned short NativeIndex = pFnLeft->iNative;
-	pFnLeft->iNative = 0;
-
-	pFnLeft->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLeft, &Left_Parms, NULL );
-
-	pFnLeft->FunctionFlags |= 0x400;
-
-	pFnLeft->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnLeft, &Left_Parms ) )
+		this->ProcessEvent ( pFnLeft, &Left_Parms, NULL );
 
 	return Left_Parms.ReturnValue;
 };
@@ -3430,26 +2885,17 @@ FString UObject::Left ( FString const& S, int I )
 
 FString UObject::Mid ( FString const& S, int I, int J )
 {
-	static UFunction* pFnMid = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMidRef { L"Function Core.Object.Mid", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMid )
-		pFnMid = UObject::FindObject< UFunction > ( L"Function Core.Object.Mid" );
+	UFunction* const pFnMid = pFnMidRef.Get ( );
 
 	UObject_execMid_Parms Mid_Parms;
 	memcpy ( &Mid_Parms.S, &S, 0x10 );
 	Mid_Parms.I = I;
 	Mid_Parms.J = J;
 
-	unsigned short NativeIndex = pFnMid->iNative;
-	pFnMid->iNative = 0;
-
-	pFnMid->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMid, &Mid_Parms, NULL );
-
-	pFnMid->FunctionFlags |= 0x400;
-
-	pFnMid->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMid, &Mid_Parms ) )
+		this->ProcessEvent ( pFnMid, &Mid_Parms, NULL );
 
 	return Mid_Parms.ReturnValue;
 };
@@ -3466,10 +2912,9 @@ FString UObject::Mid ( FString const& S, int I, int J )
 
 int UObject::InStr ( FString const& S, FString const& T, unsigned long bSearchFromRight, unsigned long bIgnoreCase, int StartPos )
 {
-	static UFunction* pFnInStr = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInStrRef { L"Function Core.Object.InStr", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInStr )
-		pFnInStr = UObject::FindObject< UFunction > ( L"Function Core.Object.InStr" );
+	UFunction* const pFnInStr = pFnInStrRef.Get ( );
 
 	UObject_execInStr_Parms InStr_Parms;
 	memcpy ( &InStr_Parms.S, &S, 0x10 );
@@ -3478,16 +2923,8 @@ int UObject::InStr ( FString const& S, FString const& T, unsigned long bSearchFr
 	InStr_Parms.bIgnoreCase = bIgnoreCase;
 	InStr_Parms.StartPos = StartPos;
 
-	unsigned short NativeIndex = pFnInStr->iNative;
-	pFnInStr->iNative = 0;
-
-	pFnInStr->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnInStr, &InStr_Parms, NULL );
-
-	pFnInStr->FunctionFlags |= 0x400;
-
-	pFnInStr->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnInStr, &InStr_Parms ) )
+		this->ProcessEvent ( pFnInStr, &InStr_Parms, NULL );
 
 	return InStr_Parms.ReturnValue;
 };
@@ -3500,24 +2937,15 @@ int UObject::InStr ( FString const& S, FString const& T, unsigned long bSearchFr
 
 int UObject::Len ( FString const& S )
 {
-	static UFunction* pFnLen = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLenRef { L"Function Core.Object.Len", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLen )
-		pFnLen = UObject::FindObject< UFunction > ( L"Function Core.Object.Len" );
+	UFunction* const pFnLen = pFnLenRef.Get ( );
 
 	UObject_execLen_Parms Len_Parms;
 	memcpy ( &Len_Parms.S, &S, 0x10 );
 
-	unsigned short NativeIndex = pFnLen->iNative;
-	pFnLen->iNative = 0;
-
-	pFnLen->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLen, &Len_Parms, NULL );
-
-	pFnLen->FunctionFlags |= 0x400;
-
-	pFnLen->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnLen, &Len_Parms ) )
+		this->ProcessEvent ( pFnLen, &Len_Parms, NULL );
 
 	return Len_Parms.ReturnValue;
 };
@@ -3531,10 +2959,9 @@ int UObject::Len ( FString const& S )
 
 FString UObject::SubtractEqual_StrStr ( FString const& B, FString* A )
 {
-	static UFunction* pFnSubtractEqual_StrStr = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtractEqual_StrStrRef { L"Function Core.Object.SubtractEqual_StrStr", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtractEqual_StrStr )
-		pFnSubtractEqual_StrStr = UObject::FindObject< UFunction > ( L"Function Core.Object.SubtractEqual_StrStr" );
+	UFunction* const pFnSubtractEqual_StrStr = pFnSubtractEqual_StrStrRef.Get ( );
 
 	UObject_execSubtractEqual_StrStr_Parms SubtractEqual_StrStr_Parms;
 	memcpy ( &SubtractEqual_StrStr_Parms.B, &B, 0x10 );
@@ -3542,16 +2969,8 @@ FString UObject::SubtractEqual_StrStr ( FString const& B, FString* A )
 	if ( A )
 		memcpy ( &SubtractEqual_StrStr_Parms.A, A, 0x10 );
 
-	unsigned short NativeIndex = pFnSubtractEqual_StrStr->iNative;
-	pFnSubtractEqual_StrStr->iNative = 0;
-
-	pFnSubtractEqual_StrStr->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtractEqual_StrStr, &SubtractEqual_StrStr_Parms, NULL );
-
-	pFnSubtractEqual_StrStr->FunctionFlags |= 0x400;
-
-	pFnSubtractEqual_StrStr->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtractEqual_StrStr, &SubtractEqual_StrStr_Parms ) )
+		this->ProcessEvent ( pFnSubtractEqual_StrStr, &SubtractEqual_StrStr_Parms, NULL );
 
 	if ( A )
 		memcpy ( A, &SubtractEqual_StrStr_Parms.A, 0x10 );
@@ -3568,10 +2987,9 @@ FString UObject::SubtractEqual_StrStr ( FString const& B, FString* A )
 
 FString UObject::AtEqual_StrStr ( FString const& B, FString* A )
 {
-	static UFunction* pFnAtEqual_StrStr = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAtEqual_StrStrRef { L"Function Core.Object.AtEqual_StrStr", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAtEqual_StrStr )
-		pFnAtEqual_StrStr = UObject::FindObject< UFunction > ( L"Function Core.Object.AtEqual_StrStr" );
+	UFunction* const pFnAtEqual_StrStr = pFnAtEqual_StrStrRef.Get ( );
 
 	UObject_execAtEqual_StrStr_Parms AtEqual_StrStr_Parms;
 	memcpy ( &AtEqual_StrStr_Parms.B, &B, 0x10 );
@@ -3579,16 +2997,8 @@ FString UObject::AtEqual_StrStr ( FString const& B, FString* A )
 	if ( A )
 		memcpy ( &AtEqual_StrStr_Parms.A, A, 0x10 );
 
-	unsigned short NativeIndex = pFnAtEqual_StrStr->iNative;
-	pFnAtEqual_StrStr->iNative = 0;
-
-	pFnAtEqual_StrStr->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAtEqual_StrStr, &AtEqual_StrStr_Parms, NULL );
-
-	pFnAtEqual_StrStr->FunctionFlags |= 0x400;
-
-	pFnAtEqual_StrStr->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAtEqual_StrStr, &AtEqual_StrStr_Parms ) )
+		this->ProcessEvent ( pFnAtEqual_StrStr, &AtEqual_StrStr_Parms, NULL );
 
 	if ( A )
 		memcpy ( A, &AtEqual_StrStr_Parms.A, 0x10 );
@@ -3605,10 +3015,9 @@ FString UObject::AtEqual_StrStr ( FString const& B, FString* A )
 
 FString UObject::ConcatEqual_StrStr ( FString const& B, FString* A )
 {
-	static UFunction* pFnConcatEqual_StrStr = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnConcatEqual_StrStrRef { L"Function Core.Object.ConcatEqual_StrStr", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnConcatEqual_StrStr )
-		pFnConcatEqual_StrStr = UObject::FindObject< UFunction > ( L"Function Core.Object.ConcatEqual_StrStr" );
+	UFunction* const pFnConcatEqual_StrStr = pFnConcatEqual_StrStrRef.Get ( );
 
 	UObject_execConcatEqual_StrStr_Parms ConcatEqual_StrStr_Parms;
 	memcpy ( &ConcatEqual_StrStr_Parms.B, &B, 0x10 );
@@ -3616,16 +3025,8 @@ FString UObject::ConcatEqual_StrStr ( FString const& B, FString* A )
 	if ( A )
 		memcpy ( &ConcatEqual_StrStr_Parms.A, A, 0x10 );
 
-	unsigned short NativeIndex = pFnConcatEqual_StrStr->iNative;
-	pFnConcatEqual_StrStr->iNative = 0;
-
-	pFnConcatEqual_StrStr->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnConcatEqual_StrStr, &ConcatEqual_StrStr_Parms, NULL );
-
-	pFnConcatEqual_StrStr->FunctionFlags |= 0x400;
-
-	pFnConcatEqual_StrStr->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnConcatEqual_StrStr, &ConcatEqual_StrStr_Parms ) )
+		this->ProcessEvent ( pFnConcatEqual_StrStr, &ConcatEqual_StrStr_Parms, NULL );
 
 	if ( A )
 		memcpy ( A, &ConcatEqual_StrStr_Parms.A, 0x10 );
@@ -3642,25 +3043,16 @@ FString UObject::ConcatEqual_StrStr ( FString const& B, FString* A )
 
 bool UObject::ComplementEqual_StrStr ( FString const& A, FString const& B )
 {
-	static UFunction* pFnComplementEqual_StrStr = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnComplementEqual_StrStrRef { L"Function Core.Object.ComplementEqual_StrStr", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnComplementEqual_StrStr )
-		pFnComplementEqual_StrStr = UObject::FindObject< UFunction > ( L"Function Core.Object.ComplementEqual_StrStr" );
+	UFunction* const pFnComplementEqual_StrStr = pFnComplementEqual_StrStrRef.Get ( );
 
 	UObject_execComplementEqual_StrStr_Parms ComplementEqual_StrStr_Parms;
 	memcpy ( &ComplementEqual_StrStr_Parms.A, &A, 0x10 );
 	memcpy ( &ComplementEqual_StrStr_Parms.B, &B, 0x10 );
 
-	unsigned short NativeIndex = pFnComplementEqual_StrStr->iNative;
-	pFnComplementEqual_StrStr->iNative = 0;
-
-	pFnComplementEqual_StrStr->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnComplementEqual_StrStr, &ComplementEqual_StrStr_Parms, NULL );
-
-	pFnComplementEqual_StrStr->FunctionFlags |= 0x400;
-
-	pFnComplementEqual_StrStr->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnComplementEqual_StrStr, &ComplementEqual_StrStr_Parms ) )
+		this->ProcessEvent ( pFnComplementEqual_StrStr, &ComplementEqual_StrStr_Parms, NULL );
 
 	return ComplementEqual_StrStr_Parms.ReturnValue;
 };
@@ -3674,25 +3066,16 @@ bool UObject::ComplementEqual_StrStr ( FString const& A, FString const& B )
 
 bool UObject::NotEqual_StrStr ( FString const& A, FString const& B )
 {
-	static UFunction* pFnNotEqual_StrStr = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotEqual_StrStrRef { L"Function Core.Object.NotEqual_StrStr", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotEqual_StrStr )
-		pFnNotEqual_StrStr = UObject::FindObject< UFunction > ( L"Function Core.Object.NotEqual_StrStr" );
+	UFunction* const pFnNotEqual_StrStr = pFnNotEqual_StrStrRef.Get ( );
 
 	UObject_execNotEqual_StrStr_Parms NotEqual_StrStr_Parms;
 	memcpy ( &NotEqual_StrStr_Parms.A, &A, 0x10 );
 	memcpy ( &NotEqual_StrStr_Parms.B, &B, 0x10 );
 
-	unsigned short NativeIndex = pFnNotEqual_StrStr->iNative;
-	pFnNotEqual_StrStr->iNative = 0;
-
-	pFnNotEqual_StrStr->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotEqual_StrStr, &NotEqual_StrStr_Parms, NULL );
-
-	pFnNotEqual_StrStr->FunctionFlags |= 0x400;
-
-	pFnNotEqual_StrStr->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnNotEqual_StrStr, &NotEqual_StrStr_Parms ) )
+		this->ProcessEvent ( pFnNotEqual_StrStr, &NotEqual_StrStr_Parms, NULL );
 
 	return NotEqual_StrStr_Parms.ReturnValue;
 };
@@ -3706,25 +3089,16 @@ bool UObject::NotEqual_StrStr ( FString const& A, FString const& B )
 
 bool UObject::EqualEqual_StrStr ( FString const& A, FString const& B )
 {
-	static UFunction* pFnEqualEqual_StrStr = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEqualEqual_StrStrRef { L"Function Core.Object.EqualEqual_StrStr", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEqualEqual_StrStr )
-		pFnEqualEqual_StrStr = UObject::FindObject< UFunction > ( L"Function Core.Object.EqualEqual_StrStr" );
+	UFunction* const pFnEqualEqual_StrStr = pFnEqualEqual_StrStrRef.Get ( );
 
 	UObject_execEqualEqual_StrStr_Parms EqualEqual_StrStr_Parms;
 	memcpy ( &EqualEqual_StrStr_Parms.A, &A, 0x10 );
 	memcpy ( &EqualEqual_StrStr_Parms.B, &B, 0x10 );
 
-	unsigned short NativeIndex = pFnEqualEqual_StrStr->iNative;
-	pFnEqualEqual_StrStr->iNative = 0;
-
-	pFnEqualEqual_StrStr->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEqualEqual_StrStr, &EqualEqual_StrStr_Parms, NULL );
-
-	pFnEqualEqual_StrStr->FunctionFlags |= 0x400;
-
-	pFnEqualEqual_StrStr->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnEqualEqual_StrStr, &EqualEqual_StrStr_Parms ) )
+		this->ProcessEvent ( pFnEqualEqual_StrStr, &EqualEqual_StrStr_Parms, NULL );
 
 	return EqualEqual_StrStr_Parms.ReturnValue;
 };
@@ -3738,25 +3112,16 @@ bool UObject::EqualEqual_StrStr ( FString const& A, FString const& B )
 
 bool UObject::GreaterEqual_StrStr ( FString const& A, FString const& B )
 {
-	static UFunction* pFnGreaterEqual_StrStr = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGreaterEqual_StrStrRef { L"Function Core.Object.GreaterEqual_StrStr", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGreaterEqual_StrStr )
-		pFnGreaterEqual_StrStr = UObject::FindObject< UFunction > ( L"Function Core.Object.GreaterEqual_StrStr" );
+	UFunction* const pFnGreaterEqual_StrStr = pFnGreaterEqual_StrStrRef.Get ( );
 
 	UObject_execGreaterEqual_StrStr_Parms GreaterEqual_StrStr_Parms;
 	memcpy ( &GreaterEqual_StrStr_Parms.A, &A, 0x10 );
 	memcpy ( &GreaterEqual_StrStr_Parms.B, &B, 0x10 );
 
-	unsigned short NativeIndex = pFnGreaterEqual_StrStr->iNative;
-	pFnGreaterEqual_StrStr->iNative = 0;
-
-	pFnGreaterEqual_StrStr->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGreaterEqual_StrStr, &GreaterEqual_StrStr_Parms, NULL );
-
-	pFnGreaterEqual_StrStr->FunctionFlags |= 0x400;
-
-	pFnGreaterEqual_StrStr->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnGreaterEqual_StrStr, &GreaterEqual_StrStr_Parms ) )
+		this->ProcessEvent ( pFnGreaterEqual_StrStr, &GreaterEqual_StrStr_Parms, NULL );
 
 	return GreaterEqual_StrStr_Parms.ReturnValue;
 };
@@ -3770,25 +3135,16 @@ bool UObject::GreaterEqual_StrStr ( FString const& A, FString const& B )
 
 bool UObject::LessEqual_StrStr ( FString const& A, FString const& B )
 {
-	static UFunction* pFnLessEqual_StrStr = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLessEqual_StrStrRef { L"Function Core.Object.LessEqual_StrStr", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLessEqual_StrStr )
-		pFnLessEqual_StrStr = UObject::FindObject< UFunction > ( L"Function Core.Object.LessEqual_StrStr" );
+	UFunction* const pFnLessEqual_StrStr = pFnLessEqual_StrStrRef.Get ( );
 
 	UObject_execLessEqual_StrStr_Parms LessEqual_StrStr_Parms;
 	memcpy ( &LessEqual_StrStr_Parms.A, &A, 0x10 );
 	memcpy ( &LessEqual_StrStr_Parms.B, &B, 0x10 );
 
-	unsigned short NativeIndex = pFnLessEqual_StrStr->iNative;
-	pFnLessEqual_StrStr->iNative = 0;
-
-	pFnLessEqual_StrStr->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLessEqual_StrStr, &LessEqual_StrStr_Parms, NULL );
-
-	pFnLessEqual_StrStr->FunctionFlags |= 0x400;
-
-	pFnLessEqual_StrStr->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnLessEqual_StrStr, &LessEqual_StrStr_Parms ) )
+		this->ProcessEvent ( pFnLessEqual_StrStr, &LessEqual_StrStr_Parms, NULL );
 
 	return LessEqual_StrStr_Parms.ReturnValue;
 };
@@ -3802,25 +3158,16 @@ bool UObject::LessEqual_StrStr ( FString const& A, FString const& B )
 
 bool UObject::Greater_StrStr ( FString const& A, FString const& B )
 {
-	static UFunction* pFnGreater_StrStr = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGreater_StrStrRef { L"Function Core.Object.Greater_StrStr", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGreater_StrStr )
-		pFnGreater_StrStr = UObject::FindObject< UFunction > ( L"Function Core.Object.Greater_StrStr" );
+	UFunction* const pFnGreater_StrStr = pFnGreater_StrStrRef.Get ( );
 
 	UObject_execGreater_StrStr_Parms Greater_StrStr_Parms;
 	memcpy ( &Greater_StrStr_Parms.A, &A, 0x10 );
 	memcpy ( &Greater_StrStr_Parms.B, &B, 0x10 );
 
-	unsigned short NativeIndex = pFnGreater_StrStr->iNative;
-	pFnGreater_StrStr->iNative = 0;
-
-	pFnGreater_StrStr->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGreater_StrStr, &Greater_StrStr_Parms, NULL );
-
-	pFnGreater_StrStr->FunctionFlags |= 0x400;
-
-	pFnGreater_StrStr->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnGreater_StrStr, &Greater_StrStr_Parms ) )
+		this->ProcessEvent ( pFnGreater_StrStr, &Greater_StrStr_Parms, NULL );
 
 	return Greater_StrStr_Parms.ReturnValue;
 };
@@ -3834,25 +3181,16 @@ bool UObject::Greater_StrStr ( FString const& A, FString const& B )
 
 bool UObject::Less_StrStr ( FString const& A, FString const& B )
 {
-	static UFunction* pFnLess_StrStr = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLess_StrStrRef { L"Function Core.Object.Less_StrStr", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLess_StrStr )
-		pFnLess_StrStr = UObject::FindObject< UFunction > ( L"Function Core.Object.Less_StrStr" );
+	UFunction* const pFnLess_StrStr = pFnLess_StrStrRef.Get ( );
 
 	UObject_execLess_StrStr_Parms Less_StrStr_Parms;
 	memcpy ( &Less_StrStr_Parms.A, &A, 0x10 );
 	memcpy ( &Less_StrStr_Parms.B, &B, 0x10 );
 
-	unsigned short NativeIndex = pFnLess_StrStr->iNative;
-	pFnLess_StrStr->iNative = 0;
-
-	pFnLess_StrStr->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLess_StrStr, &Less_StrStr_Parms, NULL );
-
-	pFnLess_StrStr->FunctionFlags |= 0x400;
-
-	pFnLess_StrStr->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnLess_StrStr, &Less_StrStr_Parms ) )
+		this->ProcessEvent ( pFnLess_StrStr, &Less_StrStr_Parms, NULL );
 
 	return Less_StrStr_Parms.ReturnValue;
 };
@@ -3866,25 +3204,16 @@ bool UObject::Less_StrStr ( FString const& A, FString const& B )
 
 FString UObject::At_StrStr ( FString const& A, FString const& B )
 {
-	static UFunction* pFnAt_StrStr = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAt_StrStrRef { L"Function Core.Object.At_StrStr", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAt_StrStr )
-		pFnAt_StrStr = UObject::FindObject< UFunction > ( L"Function Core.Object.At_StrStr" );
+	UFunction* const pFnAt_StrStr = pFnAt_StrStrRef.Get ( );
 
 	UObject_execAt_StrStr_Parms At_StrStr_Parms;
 	memcpy ( &At_StrStr_Parms.A, &A, 0x10 );
 	memcpy ( &At_StrStr_Parms.B, &B, 0x10 );
 
-	unsigned short NativeIndex = pFnAt_StrStr->iNative;
-	pFnAt_StrStr->iNative = 0;
-
-	pFnAt_StrStr->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAt_StrStr, &At_StrStr_Parms, NULL );
-
-	pFnAt_StrStr->FunctionFlags |= 0x400;
-
-	pFnAt_StrStr->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAt_StrStr, &At_StrStr_Parms ) )
+		this->ProcessEvent ( pFnAt_StrStr, &At_StrStr_Parms, NULL );
 
 	return At_StrStr_Parms.ReturnValue;
 };
@@ -3898,25 +3227,16 @@ FString UObject::At_StrStr ( FString const& A, FString const& B )
 
 FString UObject::Concat_StrStr ( FString const& A, FString const& B )
 {
-	static UFunction* pFnConcat_StrStr = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnConcat_StrStrRef { L"Function Core.Object.Concat_StrStr", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnConcat_StrStr )
-		pFnConcat_StrStr = UObject::FindObject< UFunction > ( L"Function Core.Object.Concat_StrStr" );
+	UFunction* const pFnConcat_StrStr = pFnConcat_StrStrRef.Get ( );
 
 	UObject_execConcat_StrStr_Parms Concat_StrStr_Parms;
 	memcpy ( &Concat_StrStr_Parms.A, &A, 0x10 );
 	memcpy ( &Concat_StrStr_Parms.B, &B, 0x10 );
 
-	unsigned short NativeIndex = pFnConcat_StrStr->iNative;
-	pFnConcat_StrStr->iNative = 0;
-
-	pFnConcat_StrStr->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnConcat_StrStr, &Concat_StrStr_Parms, NULL );
-
-	pFnConcat_StrStr->FunctionFlags |= 0x400;
-
-	pFnConcat_StrStr->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnConcat_StrStr, &Concat_StrStr_Parms ) )
+		this->ProcessEvent ( pFnConcat_StrStr, &Concat_StrStr_Parms, NULL );
 
 	return Concat_StrStr_Parms.ReturnValue;
 };
@@ -3931,10 +3251,9 @@ FString UObject::Concat_StrStr ( FString const& A, FString const& B )
 
 struct FRotator UObject::MakeRotator ( int Pitch, int Yaw, int Roll )
 {
-	static UFunction* pFnMakeRotator = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMakeRotatorRef { L"Function Core.Object.MakeRotator", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMakeRotator )
-		pFnMakeRotator = UObject::FindObject< UFunction > ( L"Function Core.Object.MakeRotator" );
+	UFunction* const pFnMakeRotator = pFnMakeRotatorRef.Get ( );
 
 	UObject_execMakeRotator_Parms MakeRotator_Parms;
 	MakeRotator_Parms.Pitch = Pitch;
@@ -3959,10 +3278,9 @@ struct FRotator UObject::MakeRotator ( int Pitch, int Yaw, int Roll )
 
 bool UObject::SClampRotAxis ( float DeltaTime, int ViewAxis, int MaxLimit, int MinLimit, float InterpolationSpeed, int* out_DeltaViewAxis )
 {
-	static UFunction* pFnSClampRotAxis = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSClampRotAxisRef { L"Function Core.Object.SClampRotAxis", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSClampRotAxis )
-		pFnSClampRotAxis = UObject::FindObject< UFunction > ( L"Function Core.Object.SClampRotAxis" );
+	UFunction* const pFnSClampRotAxis = pFnSClampRotAxisRef.Get ( );
 
 	UObject_execSClampRotAxis_Parms SClampRotAxis_Parms;
 	SClampRotAxis_Parms.DeltaTime = DeltaTime;
@@ -3992,10 +3310,9 @@ bool UObject::SClampRotAxis ( float DeltaTime, int ViewAxis, int MaxLimit, int M
 
 int UObject::ClampRotAxisFromRange ( int Current, int Min, int Max )
 {
-	static UFunction* pFnClampRotAxisFromRange = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClampRotAxisFromRangeRef { L"Function Core.Object.ClampRotAxisFromRange", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClampRotAxisFromRange )
-		pFnClampRotAxisFromRange = UObject::FindObject< UFunction > ( L"Function Core.Object.ClampRotAxisFromRange" );
+	UFunction* const pFnClampRotAxisFromRange = pFnClampRotAxisFromRangeRef.Get ( );
 
 	UObject_execClampRotAxisFromRange_Parms ClampRotAxisFromRange_Parms;
 	ClampRotAxisFromRange_Parms.Current = Current;
@@ -4017,10 +3334,9 @@ int UObject::ClampRotAxisFromRange ( int Current, int Min, int Max )
 
 int UObject::ClampRotAxisFromBase ( int Current, int Center, int MaxDelta )
 {
-	static UFunction* pFnClampRotAxisFromBase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClampRotAxisFromBaseRef { L"Function Core.Object.ClampRotAxisFromBase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClampRotAxisFromBase )
-		pFnClampRotAxisFromBase = UObject::FindObject< UFunction > ( L"Function Core.Object.ClampRotAxisFromBase" );
+	UFunction* const pFnClampRotAxisFromBase = pFnClampRotAxisFromBaseRef.Get ( );
 
 	UObject_execClampRotAxisFromBase_Parms ClampRotAxisFromBase_Parms;
 	ClampRotAxisFromBase_Parms.Current = Current;
@@ -4042,10 +3358,9 @@ int UObject::ClampRotAxisFromBase ( int Current, int Center, int MaxDelta )
 
 void UObject::ClampRotAxis ( int ViewAxis, int MaxLimit, int MinLimit, int* out_DeltaViewAxis )
 {
-	static UFunction* pFnClampRotAxis = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClampRotAxisRef { L"Function Core.Object.ClampRotAxis", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClampRotAxis )
-		pFnClampRotAxis = UObject::FindObject< UFunction > ( L"Function Core.Object.ClampRotAxis" );
+	UFunction* const pFnClampRotAxis = pFnClampRotAxisRef.Get ( );
 
 	UObject_execClampRotAxis_Parms ClampRotAxis_Parms;
 	ClampRotAxis_Parms.ViewAxis = ViewAxis;
@@ -4069,10 +3384,9 @@ void UObject::ClampRotAxis ( int ViewAxis, int MaxLimit, int MinLimit, int* out_
 
 float UObject::RSize ( struct FRotator const& R )
 {
-	static UFunction* pFnRSize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRSizeRef { L"Function Core.Object.RSize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRSize )
-		pFnRSize = UObject::FindObject< UFunction > ( L"Function Core.Object.RSize" );
+	UFunction* const pFnRSize = pFnRSizeRef.Get ( );
 
 	UObject_execRSize_Parms RSize_Parms;
 	memcpy ( &RSize_Parms.R, &R, 0xC );
@@ -4091,20 +3405,16 @@ float UObject::RSize ( struct FRotator const& R )
 
 float UObject::RDiff ( struct FRotator const& A, struct FRotator const& B )
 {
-	static UFunction* pFnRDiff = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRDiffRef { L"Function Core.Object.RDiff", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRDiff )
-		pFnRDiff = UObject::FindObject< UFunction > ( L"Function Core.Object.RDiff" );
+	UFunction* const pFnRDiff = pFnRDiffRef.Get ( );
 
 	UObject_execRDiff_Parms RDiff_Parms;
 	memcpy ( &RDiff_Parms.A, &A, 0xC );
 	memcpy ( &RDiff_Parms.B, &B, 0xC );
 
-	pFnRDiff->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRDiff, &RDiff_Parms, NULL );
-
-	pFnRDiff->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRDiff, &RDiff_Parms ) )
+		this->ProcessEvent ( pFnRDiff, &RDiff_Parms, NULL );
 
 	return RDiff_Parms.ReturnValue;
 };
@@ -4117,19 +3427,15 @@ float UObject::RDiff ( struct FRotator const& A, struct FRotator const& B )
 
 int UObject::NormalizeRotAxis ( int Angle )
 {
-	static UFunction* pFnNormalizeRotAxis = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNormalizeRotAxisRef { L"Function Core.Object.NormalizeRotAxis", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNormalizeRotAxis )
-		pFnNormalizeRotAxis = UObject::FindObject< UFunction > ( L"Function Core.Object.NormalizeRotAxis" );
+	UFunction* const pFnNormalizeRotAxis = pFnNormalizeRotAxisRef.Get ( );
 
 	UObject_execNormalizeRotAxis_Parms NormalizeRotAxis_Parms;
 	NormalizeRotAxis_Parms.Angle = Angle;
 
-	pFnNormalizeRotAxis->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNormalizeRotAxis, &NormalizeRotAxis_Parms, NULL );
-
-	pFnNormalizeRotAxis->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNormalizeRotAxis, &NormalizeRotAxis_Parms ) )
+		this->ProcessEvent ( pFnNormalizeRotAxis, &NormalizeRotAxis_Parms, NULL );
 
 	return NormalizeRotAxis_Parms.ReturnValue;
 };
@@ -4146,10 +3452,9 @@ int UObject::NormalizeRotAxis ( int Angle )
 
 struct FRotator UObject::RInterpTo ( struct FRotator const& Current, struct FRotator const& Target, float DeltaTime, float InterpSpeed, unsigned long bConstantInterpSpeed )
 {
-	static UFunction* pFnRInterpTo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRInterpToRef { L"Function Core.Object.RInterpTo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRInterpTo )
-		pFnRInterpTo = UObject::FindObject< UFunction > ( L"Function Core.Object.RInterpTo" );
+	UFunction* const pFnRInterpTo = pFnRInterpToRef.Get ( );
 
 	UObject_execRInterpTo_Parms RInterpTo_Parms;
 	memcpy ( &RInterpTo_Parms.Current, &Current, 0xC );
@@ -4158,11 +3463,8 @@ struct FRotator UObject::RInterpTo ( struct FRotator const& Current, struct FRot
 	RInterpTo_Parms.InterpSpeed = InterpSpeed;
 	RInterpTo_Parms.bConstantInterpSpeed = bConstantInterpSpeed;
 
-	pFnRInterpTo->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRInterpTo, &RInterpTo_Parms, NULL );
-
-	pFnRInterpTo->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRInterpTo, &RInterpTo_Parms ) )
+		this->ProcessEvent ( pFnRInterpTo, &RInterpTo_Parms, NULL );
 
 	return RInterpTo_Parms.ReturnValue;
 };
@@ -4176,20 +3478,16 @@ struct FRotator UObject::RInterpTo ( struct FRotator const& Current, struct FRot
 
 struct FRotator UObject::RTransform ( struct FRotator const& R, struct FRotator const& RBasis )
 {
-	static UFunction* pFnRTransform = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRTransformRef { L"Function Core.Object.RTransform", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRTransform )
-		pFnRTransform = UObject::FindObject< UFunction > ( L"Function Core.Object.RTransform" );
+	UFunction* const pFnRTransform = pFnRTransformRef.Get ( );
 
 	UObject_execRTransform_Parms RTransform_Parms;
 	memcpy ( &RTransform_Parms.R, &R, 0xC );
 	memcpy ( &RTransform_Parms.RBasis, &RBasis, 0xC );
 
-	pFnRTransform->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRTransform, &RTransform_Parms, NULL );
-
-	pFnRTransform->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRTransform, &RTransform_Parms ) )
+		this->ProcessEvent ( pFnRTransform, &RTransform_Parms, NULL );
 
 	return RTransform_Parms.ReturnValue;
 };
@@ -4205,10 +3503,9 @@ struct FRotator UObject::RTransform ( struct FRotator const& R, struct FRotator
 
 struct FRotator UObject::RSmerp ( struct FRotator const& A, struct FRotator const& B, float Alpha, unsigned long bShortestPath )
 {
-	static UFunction* pFnRSmerp = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRSmerpRef { L"Function Core.Object.RSmerp", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRSmerp )
-		pFnRSmerp = UObject::FindObject< UFunction > ( L"Function Core.Object.RSmerp" );
+	UFunction* const pFnRSmerp = pFnRSmerpRef.Get ( );
 
 	UObject_execRSmerp_Parms RSmerp_Parms;
 	memcpy ( &RSmerp_Parms.A, &A, 0xC );
@@ -4216,11 +3513,8 @@ struct FRotator UObject::RSmerp ( struct FRotator const& A, struct FRotator cons
 	RSmerp_Parms.Alpha = Alpha;
 	RSmerp_Parms.bShortestPath = bShortestPath;
 
-	pFnRSmerp->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRSmerp, &RSmerp_Parms, NULL );
-
-	pFnRSmerp->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRSmerp, &RSmerp_Parms ) )
+		this->ProcessEvent ( pFnRSmerp, &RSmerp_Parms, NULL );
 
 	return RSmerp_Parms.ReturnValue;
 };
@@ -4236,10 +3530,9 @@ struct FRotator UObject::RSmerp ( struct FRotator const& A, struct FRotator cons
 
 struct FRotator UObject::RLerp ( struct FRotator const& A, struct FRotator const& B, float Alpha, unsigned long bShortestPath )
 {
-	static UFunction* pFnRLerp = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRLerpRef { L"Function Core.Object.RLerp", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRLerp )
-		pFnRLerp = UObject::FindObject< UFunction > ( L"Function Core.Object.RLerp" );
+	UFunction* const pFnRLerp = pFnRLerpRef.Get ( );
 
 	UObject_execRLerp_Parms RLerp_Parms;
 	memcpy ( &RLerp_Parms.A, &A, 0xC );
@@ -4247,11 +3540,8 @@ struct FRotator UObject::RLerp ( struct FRotator const& A, struct FRotator const
 	RLerp_Parms.Alpha = Alpha;
 	RLerp_Parms.bShortestPath = bShortestPath;
 
-	pFnRLerp->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRLerp, &RLerp_Parms, NULL );
-
-	pFnRLerp->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRLerp, &RLerp_Parms ) )
+		this->ProcessEvent ( pFnRLerp, &RLerp_Parms, NULL );
 
 	return RLerp_Parms.ReturnValue;
 };
@@ -4264,19 +3554,15 @@ struct FRotator UObject::RLerp ( struct FRotator const& A, struct FRotator const
 
 struct FRotator UObject::Normalize ( struct FRotator const& Rot )
 {
-	static UFunction* pFnNormalize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNormalizeRef { L"Function Core.Object.Normalize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNormalize )
-		pFnNormalize = UObject::FindObject< UFunction > ( L"Function Core.Object.Normalize" );
+	UFunction* const pFnNormalize = pFnNormalizeRef.Get ( );
 
 	UObject_execNormalize_Parms Normalize_Parms;
 	memcpy ( &Normalize_Parms.Rot, &Rot, 0xC );
 
-	pFnNormalize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNormalize, &Normalize_Parms, NULL );
-
-	pFnNormalize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnNormalize, &Normalize_Parms ) )
+		this->ProcessEvent ( pFnNormalize, &Normalize_Parms, NULL );
 
 	return Normalize_Parms.ReturnValue;
 };
@@ -4291,21 +3577,17 @@ struct FRotator UObject::Normalize ( struct FRotator const& Rot )
 
 struct FRotator UObject::OrthoRotation ( struct FVector const& X, struct FVector const& Y, struct FVector const& Z )
 {
-	static UFunction* pFnOrthoRotation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOrthoRotationRef { L"Function Core.Object.OrthoRotation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOrthoRotation )
-		pFnOrthoRotation = UObject::FindObject< UFunction > ( L"Function Core.Object.OrthoRotation" );
+	UFunction* const pFnOrthoRotation = pFnOrthoRotationRef.Get ( );
 
 	UObject_execOrthoRotation_Parms OrthoRotation_Parms;
 	memcpy ( &OrthoRotation_Parms.X, &X, 0xC );
 	memcpy ( &OrthoRotation_Parms.Y, &Y, 0xC );
 	memcpy ( &OrthoRotation_Parms.Z, &Z, 0xC );
 
-	pFnOrthoRotation->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOrthoRotation, &OrthoRotation_Parms, NULL );
-
-	pFnOrthoRotation->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOrthoRotation, &OrthoRotation_Parms ) )
+		this->ProcessEvent ( pFnOrthoRotation, &OrthoRotation_Parms, NULL );
 
 	return OrthoRotation_Parms.ReturnValue;
 };
@@ -4318,24 +3600,15 @@ struct FRotator UObject::OrthoRotation ( struct FVector const& X, struct FVector
 
 struct FRotator UObject::RotRand ( unsigned long bRoll )
 {
-	static UFunction* pFnRotRand = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRotRandRef { L"Function Core.Object.RotRand", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRotRand )
-		pFnRotRand = UObject::FindObject< UFunction > ( L"Function Core.Object.RotRand" );
+	UFunction* const pFnRotRand = pFnRotRandRef.Get ( );
 
 	UObject_execRotRand_Parms RotRand_Parms;
 	RotRand_Parms.bRoll = bRoll;
 
-	unsigned short NativeIndex = pFnRotRand->iNative;
-	pFnRotRand->iNative = 0;
-
-	pFnRotRand->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRotRand, &RotRand_Parms, NULL );
-
-	pFnRotRand->FunctionFlags |= 0x400;
-
-	pFnRotRand->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnRotRand, &RotRand_Parms ) )
+		this->ProcessEvent ( pFnRotRand, &RotRand_Parms, NULL );
 
 	return RotRand_Parms.ReturnValue;
 };
@@ -4350,10 +3623,9 @@ struct FRotator UObject::RotRand ( unsigned long bRoll )
 
 void UObject::GetUnAxes ( struct FRotator const& A, struct FVector* X, struct FVector* Y, struct FVector* Z )
 {
-	static UFunction* pFnGetUnAxes = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUnAxesRef { L"Function Core.Object.GetUnAxes", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUnAxes )
-		pFnGetUnAxes = UObject::FindObject< UFunction > ( L"Function Core.Object.GetUnAxes" );
+	UFunction* const pFnGetUnAxes = pFnGetUnAxesRef.Get ( );
 
 	UObject_execGetUnAxes_Parms GetUnAxes_Parms;
 	memcpy ( &GetUnAxes_Parms.A, &A, 0xC );
@@ -4367,16 +3639,8 @@ void UObject::GetUnAxes ( struct FRotator const& A, struct FVector* X, struct FV
 	if ( Z )
 		memcpy ( &GetUnAxes_Parms.Z, Z, 0xC );
 
-	unsigned short NativeIndex = pFnGetUnAxes->iNative;
-	pFnGetUnAxes->iNative = 0;
-
-	pFnGetUnAxes->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetUnAxes, &GetUnAxes_Parms, NULL );
-
-	pFnGetUnAxes->FunctionFlags |= 0x400;
-
-	pFnGetUnAxes->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnGetUnAxes, &GetUnAxes_Parms ) )
+		this->ProcessEvent ( pFnGetUnAxes, &GetUnAxes_Parms, NULL );
 
 	if ( X )
 		memcpy ( X, &GetUnAxes_Parms.X, 0xC );
@@ -4398,10 +3662,9 @@ void UObject::GetUnAxes ( struct FRotator const& A, struct FVector* X, struct FV
 
 void UObject::GetAxes ( struct FRotator const& A, struct FVector* X, struct FVector* Y, struct FVector* Z )
 {
-	static UFunction* pFnGetAxes = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAxesRef { L"Function Core.Object.GetAxes", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAxes )
-		pFnGetAxes = UObject::FindObject< UFunction > ( L"Function Core.Object.GetAxes" );
+	UFunction* const pFnGetAxes = pFnGetAxesRef.Get ( );
 
 	UObject_execGetAxes_Parms GetAxes_Parms;
 	memcpy ( &GetAxes_Parms.A, &A, 0xC );
@@ -4415,16 +3678,8 @@ void UObject::GetAxes ( struct FRotator const& A, struct FVector* X, struct FVec
 	if ( Z )
 		memcpy ( &GetAxes_Parms.Z, Z, 0xC );
 
-	unsigned short NativeIndex = pFnGetAxes->iNative;
-	pFnGetAxes->iNative = 0;
-
-	pFnGetAxes->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAxes, &GetAxes_Parms, NULL );
-
-	pFnGetAxes->FunctionFlags |= 0x400;
-
-	pFnGetAxes->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnGetAxes, &GetAxes_Parms ) )
+		this->ProcessEvent ( pFnGetAxes, &GetAxes_Parms, NULL );
 
 	if ( X )
 		memcpy ( X, &GetAxes_Parms.X, 0xC );
@@ -4445,20 +3700,16 @@ void UObject::GetAxes ( struct FRotator const& A, struct FVector* X, struct FVec
 
 bool UObject::ClockwiseFrom_IntInt ( int A, int B )
 {
-	static UFunction* pFnClockwiseFrom_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClockwiseFrom_IntIntRef { L"Function Core.Object.ClockwiseFrom_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClockwiseFrom_IntInt )
-		pFnClockwiseFrom_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.ClockwiseFrom_IntInt" );
+	UFunction* const pFnClockwiseFrom_IntInt = pFnClockwiseFrom_IntIntRef.Get ( );
 
 	UObject_execClockwiseFrom_IntInt_Parms ClockwiseFrom_IntInt_Parms;
 	ClockwiseFrom_IntInt_Parms.A = A;
 	ClockwiseFrom_IntInt_Parms.B = B;
 
-	pFnClockwiseFrom_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnClockwiseFrom_IntInt, &ClockwiseFrom_IntInt_Parms, NULL );
-
-	pFnClockwiseFrom_IntInt->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnClockwiseFrom_IntInt, &ClockwiseFrom_IntInt_Parms ) )
+		this->ProcessEvent ( pFnClockwiseFrom_IntInt, &ClockwiseFrom_IntInt_Parms, NULL );
 
 	return ClockwiseFrom_IntInt_Parms.ReturnValue;
 };
@@ -4472,10 +3723,9 @@ bool UObject::ClockwiseFrom_IntInt ( int A, int B )
 
 struct FRotator UObject::SubtractEqual_RotatorRotator ( struct FRotator const& B, struct FRotator* A )
 {
-	static UFunction* pFnSubtractEqual_RotatorRotator = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtractEqual_RotatorRotatorRef { L"Function Core.Object.SubtractEqual_RotatorRotator", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtractEqual_RotatorRotator )
-		pFnSubtractEqual_RotatorRotator = UObject::FindObject< UFunction > ( L"Function Core.Object.SubtractEqual_RotatorRotator" );
+	UFunction* const pFnSubtractEqual_RotatorRotator = pFnSubtractEqual_RotatorRotatorRef.Get ( );
 
 	UObject_execSubtractEqual_RotatorRotator_Parms SubtractEqual_RotatorRotator_Parms;
 	memcpy ( &SubtractEqual_RotatorRotator_Parms.B, &B, 0xC );
@@ -4483,16 +3733,8 @@ struct FRotator UObject::SubtractEqual_RotatorRotator ( struct FRotator const& B
 	if ( A )
 		memcpy ( &SubtractEqual_RotatorRotator_Parms.A, A, 0xC );
 
-	unsigned short NativeIndex = pFnSubtractEqual_RotatorRotator->iNative;
-	pFnSubtractEqual_RotatorRotator->iNative = 0;
-
-	pFnSubtractEqual_RotatorRotator->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtractEqual_RotatorRotator, &SubtractEqual_RotatorRotator_Parms, NULL );
-
-	pFnSubtractEqual_RotatorRotator->FunctionFlags |= 0x400;
-
-	pFnSubtractEqual_RotatorRotator->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtractEqual_RotatorRotator, &SubtractEqual_RotatorRotator_Parms ) )
+		this->ProcessEvent ( pFnSubtractEqual_RotatorRotator, &SubtractEqual_RotatorRotator_Parms, NULL );
 
 	if ( A )
 		memcpy ( A, &SubtractEqual_RotatorRotator_Parms.A, 0xC );
@@ -4509,10 +3751,9 @@ struct FRotator UObject::SubtractEqual_RotatorRotator ( struct FRotator const& B
 
 struct FRotator UObject::AddEqual_RotatorRotator ( struct FRotator const& B, struct FRotator* A )
 {
-	static UFunction* pFnAddEqual_RotatorRotator = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddEqual_RotatorRotatorRef { L"Function Core.Object.AddEqual_RotatorRotator", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddEqual_RotatorRotator )
-		pFnAddEqual_RotatorRotator = UObject::FindObject< UFunction > ( L"Function Core.Object.AddEqual_RotatorRotator" );
+	UFunction* const pFnAddEqual_RotatorRotator = pFnAddEqual_RotatorRotatorRef.Get ( );
 
 	UObject_execAddEqual_RotatorRotator_Parms AddEqual_RotatorRotator_Parms;
 	memcpy ( &AddEqual_RotatorRotator_Parms.B, &B, 0xC );
@@ -4520,16 +3761,8 @@ struct FRotator UObject::AddEqual_RotatorRotator ( struct FRotator const& B, str
 	if ( A )
 		memcpy ( &AddEqual_RotatorRotator_Parms.A, A, 0xC );
 
-	unsigned short NativeIndex = pFnAddEqual_RotatorRotator->iNative;
-	pFnAddEqual_RotatorRotator->iNative = 0;
-
-	pFnAddEqual_RotatorRotator->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddEqual_RotatorRotator, &AddEqual_RotatorRotator_Parms, NULL );
-
-	pFnAddEqual_RotatorRotator->FunctionFlags |= 0x400;
-
-	pFnAddEqual_RotatorRotator->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAddEqual_RotatorRotator, &AddEqual_RotatorRotator_Parms ) )
+		this->ProcessEvent ( pFnAddEqual_RotatorRotator, &AddEqual_RotatorRotator_Parms, NULL );
 
 	if ( A )
 		memcpy ( A, &AddEqual_RotatorRotator_Parms.A, 0xC );
@@ -4546,25 +3779,16 @@ struct FRotator UObject::AddEqual_RotatorRotator ( struct FRotator const& B, str
 
 struct FRotator UObject::Subtract_RotatorRotator ( struct FRotator const& A, struct FRotator const& B )
 {
-	static UFunction* pFnSubtract_RotatorRotator = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtract_RotatorRotatorRef { L"Function Core.Object.Subtract_RotatorRotator", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtract_RotatorRotator )
-		pFnSubtract_RotatorRotator = UObject::FindObject< UFunction > ( L"Function Core.Object.Subtract_RotatorRotator" );
+	UFunction* const pFnSubtract_RotatorRotator = pFnSubtract_RotatorRotatorRef.Get ( );
 
 	UObject_execSubtract_RotatorRotator_Parms Subtract_RotatorRotator_Parms;
 	memcpy ( &Subtract_RotatorRotator_Parms.A, &A, 0xC );
 	memcpy ( &Subtract_RotatorRotator_Parms.B, &B, 0xC );
 
-	unsigned short NativeIndex = pFnSubtract_RotatorRotator->iNative;
-	pFnSubtract_RotatorRotator->iNative = 0;
-
-	pFnSubtract_RotatorRotator->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtract_RotatorRotator, &Subtract_RotatorRotator_Parms, NULL );
-
-	pFnSubtract_RotatorRotator->FunctionFlags |= 0x400;
-
-	pFnSubtract_RotatorRotator->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtract_RotatorRotator, &Subtract_RotatorRotator_Parms ) )
+		this->ProcessEvent ( pFnSubtract_RotatorRotator, &Subtract_RotatorRotator_Parms, NULL );
 
 	return Subtract_RotatorRotator_Parms.ReturnValue;
 };
@@ -4578,25 +3802,16 @@ struct FRotator UObject::Subtract_RotatorRotator ( struct FRotator const& A, str
 
 struct FRotator UObject::Add_RotatorRotator ( struct FRotator const& A, struct FRotator const& B )
 {
-	static UFunction* pFnAdd_RotatorRotator = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAdd_RotatorRotatorRef { L"Function Core.Object.Add_RotatorRotator", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAdd_RotatorRotator )
-		pFnAdd_RotatorRotator = UObject::FindObject< UFunction > ( L"Function Core.Object.Add_RotatorRotator" );
+	UFunction* const pFnAdd_RotatorRotator = pFnAdd_RotatorRotatorRef.Get ( );
 
 	UObject_execAdd_RotatorRotator_Parms Add_RotatorRotator_Parms;
 	memcpy ( &Add_RotatorRotator_Parms.A, &A, 0xC );
 	memcpy ( &Add_RotatorRotator_Parms.B, &B, 0xC );
 
-	unsigned short NativeIndex = pFnAdd_RotatorRotator->iNative;
-	pFnAdd_RotatorRotator->iNative = 0;
-
-	pFnAdd_RotatorRotator->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAdd_RotatorRotator, &Add_RotatorRotator_Parms, NULL );
-
-	pFnAdd_RotatorRotator->FunctionFlags |= 0x400;
-
-	pFnAdd_RotatorRotator->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAdd_RotatorRotator, &Add_RotatorRotator_Parms ) )
+		this->ProcessEvent ( pFnAdd_RotatorRotator, &Add_RotatorRotator_Parms, NULL );
 
 	return Add_RotatorRotator_Parms.ReturnValue;
 };
@@ -4610,10 +3825,9 @@ struct FRotator UObject::Add_RotatorRotator ( struct FRotator const& A, struct F
 
 struct FRotator UObject::DivideEqual_RotatorFloat ( float B, struct FRotator* A )
 {
-	static UFunction* pFnDivideEqual_RotatorFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDivideEqual_RotatorFloatRef { L"Function Core.Object.DivideEqual_RotatorFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDivideEqual_RotatorFloat )
-		pFnDivideEqual_RotatorFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.DivideEqual_RotatorFloat" );
+	UFunction* const pFnDivideEqual_RotatorFloat = pFnDivideEqual_RotatorFloatRef.Get ( );
 
 	UObject_execDivideEqual_RotatorFloat_Parms DivideEqual_RotatorFloat_Parms;
 	DivideEqual_RotatorFloat_Parms.B = B;
@@ -4621,16 +3835,8 @@ struct FRotator UObject::DivideEqual_RotatorFloat ( float B, struct FRotator* A
 	if ( A )
 		memcpy ( &DivideEqual_RotatorFloat_Parms.A, A, 0xC );
 
-	unsigned short NativeIndex = pFnDivideEqual_RotatorFloat->iNative;
-	pFnDivideEqual_RotatorFloat->iNative = 0;
-
-	pFnDivideEqual_RotatorFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDivideEqual_RotatorFloat, &DivideEqual_RotatorFloat_Parms, NULL );
-
-	pFnDivideEqual_RotatorFloat->FunctionFlags |= 0x400;
-
-	pFnDivideEqual_RotatorFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnDivideEqual_RotatorFloat, &DivideEqual_RotatorFloat_Parms ) )
+		this->ProcessEvent ( pFnDivideEqual_RotatorFloat, &DivideEqual_RotatorFloat_Parms, NULL );
 
 	if ( A )
 		memcpy ( A, &DivideEqual_RotatorFloat_Parms.A, 0xC );
@@ -4647,10 +3853,9 @@ struct FRotator UObject::DivideEqual_RotatorFloat ( float B, struct FRotator* A
 
 struct FRotator UObject::MultiplyEqual_RotatorFloat ( float B, struct FRotator* A )
 {
-	static UFunction* pFnMultiplyEqual_RotatorFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiplyEqual_RotatorFloatRef { L"Function Core.Object.MultiplyEqual_RotatorFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiplyEqual_RotatorFloat )
-		pFnMultiplyEqual_RotatorFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.MultiplyEqual_RotatorFloat" );
+	UFunction* const pFnMultiplyEqual_RotatorFloat = pFnMultiplyEqual_RotatorFloatRef.Get ( );
 
 	UObject_execMultiplyEqual_RotatorFloat_Parms MultiplyEqual_RotatorFloat_Parms;
 	MultiplyEqual_RotatorFloat_Parms.B = B;
@@ -4658,16 +3863,8 @@ struct FRotator UObject::MultiplyEqual_RotatorFloat ( float B, struct FRotator*
 	if ( A )
 		memcpy ( &MultiplyEqual_RotatorFloat_Parms.A, A, 0xC );
 
-	unsigned short NativeIndex = pFnMultiplyEqual_RotatorFloat->iNative;
-	pFnMultiplyEqual_RotatorFloat->iNative = 0;
-
-	pFnMultiplyEqual_RotatorFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiplyEqual_RotatorFloat, &MultiplyEqual_RotatorFloat_Parms, NULL );
-
-	pFnMultiplyEqual_RotatorFloat->FunctionFlags |= 0x400;
-
-	pFnMultiplyEqual_RotatorFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMultiplyEqual_RotatorFloat, &MultiplyEqual_RotatorFloat_Parms ) )
+		this->ProcessEvent ( pFnMultiplyEqual_RotatorFloat, &MultiplyEqual_RotatorFloat_Parms, NULL );
 
 	if ( A )
 		memcpy ( A, &MultiplyEqual_RotatorFloat_Parms.A, 0xC );
@@ -4684,25 +3881,16 @@ struct FRotator UObject::MultiplyEqual_RotatorFloat ( float B, struct FRotator*
 
 struct FRotator UObject::Divide_RotatorFloat ( struct FRotator const& A, float B )
 {
-	static UFunction* pFnDivide_RotatorFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDivide_RotatorFloatRef { L"Function Core.Object.Divide_RotatorFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDivide_RotatorFloat )
-		pFnDivide_RotatorFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.Divide_RotatorFloat" );
+	UFunction* const pFnDivide_RotatorFloat = pFnDivide_RotatorFloatRef.Get ( );
 
 	UObject_execDivide_RotatorFloat_Parms Divide_RotatorFloat_Parms;
 	memcpy ( &Divide_RotatorFloat_Parms.A, &A, 0xC );
 	Divide_RotatorFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnDivide_RotatorFloat->iNative;
-	pFnDivide_RotatorFloat->iNative = 0;
-
-	pFnDivide_RotatorFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDivide_RotatorFloat, &Divide_RotatorFloat_Parms, NULL );
-
-	pFnDivide_RotatorFloat->FunctionFlags |= 0x400;
-
-	pFnDivide_RotatorFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnDivide_RotatorFloat, &Divide_RotatorFloat_Parms ) )
+		this->ProcessEvent ( pFnDivide_RotatorFloat, &Divide_RotatorFloat_Parms, NULL );
 
 	return Divide_RotatorFloat_Parms.ReturnValue;
 };
@@ -4716,25 +3904,16 @@ struct FRotator UObject::Divide_RotatorFloat ( struct FRotator const& A, float B
 
 struct FRotator UObject::Multiply_FloatRotator ( float A, struct FRotator const& B )
 {
-	static UFunction* pFnMultiply_FloatRotator = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiply_FloatRotatorRef { L"Function Core.Object.Multiply_FloatRotator", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiply_FloatRotator )
-		pFnMultiply_FloatRotator = UObject::FindObject< UFunction > ( L"Function Core.Object.Multiply_FloatRotator" );
+	UFunction* const pFnMultiply_FloatRotator = pFnMultiply_FloatRotatorRef.Get ( );
 
 	UObject_execMultiply_FloatRotator_Parms Multiply_FloatRotator_Parms;
 	Multiply_FloatRotator_Parms.A = A;
 	memcpy ( &Multiply_FloatRotator_Parms.B, &B, 0xC );
 
-	unsigned short NativeIndex = pFnMultiply_FloatRotator->iNative;
-	pFnMultiply_FloatRotator->iNative = 0;
-
-	pFnMultiply_FloatRotator->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiply_FloatRotator, &Multiply_FloatRotator_Parms, NULL );
-
-	pFnMultiply_FloatRotator->FunctionFlags |= 0x400;
-
-	pFnMultiply_FloatRotator->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMultiply_FloatRotator, &Multiply_FloatRotator_Parms ) )
+		this->ProcessEvent ( pFnMultiply_FloatRotator, &Multiply_FloatRotator_Parms, NULL );
 
 	return Multiply_FloatRotator_Parms.ReturnValue;
 };
@@ -4748,25 +3927,16 @@ struct FRotator UObject::Multiply_FloatRotator ( float A, struct FRotator const&
 
 struct FRotator UObject::Multiply_RotatorFloat ( struct FRotator const& A, float B )
 {
-	static UFunction* pFnMultiply_RotatorFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiply_RotatorFloatRef { L"Function Core.Object.Multiply_RotatorFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiply_RotatorFloat )
-		pFnMultiply_RotatorFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.Multiply_RotatorFloat" );
+	UFunction* const pFnMultiply_RotatorFloat = pFnMultiply_RotatorFloatRef.Get ( );
 
 	UObject_execMultiply_RotatorFloat_Parms Multiply_RotatorFloat_Parms;
 	memcpy ( &Multiply_RotatorFloat_Parms.A, &A, 0xC );
 	Multiply_RotatorFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnMultiply_RotatorFloat->iNative;
-	pFnMultiply_RotatorFloat->iNative = 0;
-
-	pFnMultiply_RotatorFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiply_RotatorFloat, &Multiply_RotatorFloat_Parms, NULL );
-
-	pFnMultiply_RotatorFloat->FunctionFlags |= 0x400;
-
-	pFnMultiply_RotatorFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMultiply_RotatorFloat, &Multiply_RotatorFloat_Parms ) )
+		this->ProcessEvent ( pFnMultiply_RotatorFloat, &Multiply_RotatorFloat_Parms, NULL );
 
 	return Multiply_RotatorFloat_Parms.ReturnValue;
 };
@@ -4780,25 +3950,16 @@ struct FRotator UObject::Multiply_RotatorFloat ( struct FRotator const& A, float
 
 bool UObject::NotEqual_RotatorRotator ( struct FRotator const& A, struct FRotator const& B )
 {
-	static UFunction* pFnNotEqual_RotatorRotator = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotEqual_RotatorRotatorRef { L"Function Core.Object.NotEqual_RotatorRotator", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotEqual_RotatorRotator )
-		pFnNotEqual_RotatorRotator = UObject::FindObject< UFunction > ( L"Function Core.Object.NotEqual_RotatorRotator" );
+	UFunction* const pFnNotEqual_RotatorRotator = pFnNotEqual_RotatorRotatorRef.Get ( );
 
 	UObject_execNotEqual_RotatorRotator_Parms NotEqual_RotatorRotator_Parms;
 	memcpy ( &NotEqual_RotatorRotator_Parms.A, &A, 0xC );
 	memcpy ( &NotEqual_RotatorRotator_Parms.B, &B, 0xC );
 
-	unsigned short NativeIndex = pFnNotEqual_RotatorRotator->iNative;
-	pFnNotEqual_RotatorRotator->iNative = 0;
-
-	pFnNotEqual_RotatorRotator->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotEqual_RotatorRotator, &NotEqual_RotatorRotator_Parms, NULL );
-
-	pFnNotEqual_RotatorRotator->FunctionFlags |= 0x400;
-
-	pFnNotEqual_RotatorRotator->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnNotEqual_RotatorRotator, &NotEqual_RotatorRotator_Parms ) )
+		this->ProcessEvent ( pFnNotEqual_RotatorRotator, &NotEqual_RotatorRotator_Parms, NULL );
 
 	return NotEqual_RotatorRotator_Parms.ReturnValue;
 };
@@ -4812,25 +3973,16 @@ bool UObject::NotEqual_RotatorRotator ( struct FRotator const& A, struct FRotato
 
 bool UObject::EqualEqual_RotatorRotator ( struct FRotator const& A, struct FRotator const& B )
 {
-	static UFunction* pFnEqualEqual_RotatorRotator = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEqualEqual_RotatorRotatorRef { L"Function Core.Object.EqualEqual_RotatorRotator", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEqualEqual_RotatorRotator )
-		pFnEqualEqual_RotatorRotator = UObject::FindObject< UFunction > ( L"Function Core.Object.EqualEqual_RotatorRotator" );
+	UFunction* const pFnEqualEqual_RotatorRotator = pFnEqualEqual_RotatorRotatorRef.Get ( );
 
 	UObject_execEqualEqual_RotatorRotator_Parms EqualEqual_RotatorRotator_Parms;
 	memcpy ( &EqualEqual_RotatorRotator_Parms.A, &A, 0xC );
 	memcpy ( &EqualEqual_RotatorRotator_Parms.B, &B, 0xC );
 
-	unsigned short NativeIndex = pFnEqualEqual_RotatorRotator->iNative;
-	pFnEqualEqual_RotatorRotator->iNative = 0;
-
-	pFnEqualEqual_RotatorRotator->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEqualEqual_RotatorRotator, &EqualEqual_RotatorRotator_Parms, NULL );
-
-	pFnEqualEqual_RotatorRotator->FunctionFlags |= 0x400;
-
-	pFnEqualEqual_RotatorRotator->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnEqualEqual_RotatorRotator, &EqualEqual_RotatorRotator_Parms ) )
+		this->ProcessEvent ( pFnEqualEqual_RotatorRotator, &EqualEqual_RotatorRotator_Parms, NULL );
 
 	return EqualEqual_RotatorRotator_Parms.ReturnValue;
 };
@@ -4847,10 +3999,9 @@ bool UObject::EqualEqual_RotatorRotator ( struct FRotator const& A, struct FRota
 
 bool UObject::InCylinder ( struct FVector const& Origin, struct FRotator const& Dir, float Width, struct FVector const& A, unsigned long bIgnoreZ )
 {
-	static UFunction* pFnInCylinder = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInCylinderRef { L"Function Core.Object.InCylinder", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInCylinder )
-		pFnInCylinder = UObject::FindObject< UFunction > ( L"Function Core.Object.InCylinder" );
+	UFunction* const pFnInCylinder = pFnInCylinderRef.Get ( );
 
 	UObject_execInCylinder_Parms InCylinder_Parms;
 	memcpy ( &InCylinder_Parms.Origin, &Origin, 0xC );
@@ -4873,10 +4024,9 @@ bool UObject::InCylinder ( struct FVector const& Origin, struct FRotator const&
 
 float UObject::NoZDot ( struct FVector const& A, struct FVector const& B )
 {
-	static UFunction* pFnNoZDot = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNoZDotRef { L"Function Core.Object.NoZDot", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNoZDot )
-		pFnNoZDot = UObject::FindObject< UFunction > ( L"Function Core.Object.NoZDot" );
+	UFunction* const pFnNoZDot = pFnNoZDotRef.Get ( );
 
 	UObject_execNoZDot_Parms NoZDot_Parms;
 	memcpy ( &NoZDot_Parms.A, &A, 0xC );
@@ -4896,20 +4046,16 @@ float UObject::NoZDot ( struct FVector const& A, struct FVector const& B )
 
 struct FVector UObject::ClampLength ( struct FVector const& V, float MaxLength )
 {
-	static UFunction* pFnClampLength = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClampLengthRef { L"Function Core.Object.ClampLength", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClampLength )
-		pFnClampLength = UObject::FindObject< UFunction > ( L"Function Core.Object.ClampLength" );
+	UFunction* const pFnClampLength = pFnClampLengthRef.Get ( );
 
 	UObject_execClampLength_Parms ClampLength_Parms;
 	memcpy ( &ClampLength_Parms.V, &V, 0xC );
 	ClampLength_Parms.MaxLength = MaxLength;
 
-	pFnClampLength->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnClampLength, &ClampLength_Parms, NULL );
-
-	pFnClampLength->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnClampLength, &ClampLength_Parms ) )
+		this->ProcessEvent ( pFnClampLength, &ClampLength_Parms, NULL );
 
 	return ClampLength_Parms.ReturnValue;
 };
@@ -4925,10 +4071,9 @@ struct FVector UObject::ClampLength ( struct FVector const& V, float MaxLength )
 
 struct FVector UObject::VInterpTo ( struct FVector const& Current, struct FVector const& Target, float DeltaTime, float InterpSpeed )
 {
-	static UFunction* pFnVInterpTo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnVInterpToRef { L"Function Core.Object.VInterpTo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnVInterpTo )
-		pFnVInterpTo = UObject::FindObject< UFunction > ( L"Function Core.Object.VInterpTo" );
+	UFunction* const pFnVInterpTo = pFnVInterpToRef.Get ( );
 
 	UObject_execVInterpTo_Parms VInterpTo_Parms;
 	memcpy ( &VInterpTo_Parms.Current, &Current, 0xC );
@@ -4936,11 +4081,8 @@ struct FVector UObject::VInterpTo ( struct FVector const& Current, struct FVecto
 	VInterpTo_Parms.DeltaTime = DeltaTime;
 	VInterpTo_Parms.InterpSpeed = InterpSpeed;
 
-	pFnVInterpTo->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnVInterpTo, &VInterpTo_Parms, NULL );
-
-	pFnVInterpTo->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnVInterpTo, &VInterpTo_Parms ) )
+		this->ProcessEvent ( pFnVInterpTo, &VInterpTo_Parms, NULL );
 
 	return VInterpTo_Parms.ReturnValue;
 };
@@ -4953,24 +4095,15 @@ struct FVector UObject::VInterpTo ( struct FVector const& Current, struct FVecto
 
 bool UObject::IsZero ( struct FVector const& A )
 {
-	static UFunction* pFnIsZero = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsZeroRef { L"Function Core.Object.IsZero", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsZero )
-		pFnIsZero = UObject::FindObject< UFunction > ( L"Function Core.Object.IsZero" );
+	UFunction* const pFnIsZero = pFnIsZeroRef.Get ( );
 
 	UObject_execIsZero_Parms IsZero_Parms;
 	memcpy ( &IsZero_Parms.A, &A, 0xC );
 
-	unsigned short NativeIndex = pFnIsZero->iNative;
-	pFnIsZero->iNative = 0;
-
-	pFnIsZero->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsZero, &IsZero_Parms, NULL );
-
-	pFnIsZero->FunctionFlags |= 0x400;
-
-	pFnIsZero->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnIsZero, &IsZero_Parms ) )
+		this->ProcessEvent ( pFnIsZero, &IsZero_Parms, NULL );
 
 	return IsZero_Parms.ReturnValue;
 };
@@ -4984,25 +4117,16 @@ bool UObject::IsZero ( struct FVector const& A )
 
 struct FVector UObject::ProjectOnTo ( struct FVector const& X, struct FVector const& Y )
 {
-	static UFunction* pFnProjectOnTo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnProjectOnToRef { L"Function Core.Object.ProjectOnTo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnProjectOnTo )
-		pFnProjectOnTo = UObject::FindObject< UFunction > ( L"Function Core.Object.ProjectOnTo" );
+	UFunction* const pFnProjectOnTo = pFnProjectOnToRef.Get ( );
 
 	UObject_execProjectOnTo_Parms ProjectOnTo_Parms;
 	memcpy ( &ProjectOnTo_Parms.X, &X, 0xC );
 	memcpy ( &ProjectOnTo_Parms.Y, &Y, 0xC );
 
-	unsigned short NativeIndex = pFnProjectOnTo->iNative;
-	pFnProjectOnTo->iNative = 0;
-
-	pFnProjectOnTo->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnProjectOnTo, &ProjectOnTo_Parms, NULL );
-
-	pFnProjectOnTo->FunctionFlags |= 0x400;
-
-	pFnProjectOnTo->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnProjectOnTo, &ProjectOnTo_Parms ) )
+		this->ProcessEvent ( pFnProjectOnTo, &ProjectOnTo_Parms, NULL );
 
 	return ProjectOnTo_Parms.ReturnValue;
 };
@@ -5016,25 +4140,16 @@ struct FVector UObject::ProjectOnTo ( struct FVector const& X, struct FVector co
 
 struct FVector UObject::MirrorVectorByNormal ( struct FVector const& InVect, struct FVector const& InNormal )
 {
-	static UFunction* pFnMirrorVectorByNormal = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMirrorVectorByNormalRef { L"Function Core.Object.MirrorVectorByNormal", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMirrorVectorByNormal )
-		pFnMirrorVectorByNormal = UObject::FindObject< UFunction > ( L"Function Core.Object.MirrorVectorByNormal" );
+	UFunction* const pFnMirrorVectorByNormal = pFnMirrorVectorByNormalRef.Get ( );
 
 	UObject_execMirrorVectorByNormal_Parms MirrorVectorByNormal_Parms;
 	memcpy ( &MirrorVectorByNormal_Parms.InVect, &InVect, 0xC );
 	memcpy ( &MirrorVectorByNormal_Parms.InNormal, &InNormal, 0xC );
 
-	unsigned short NativeIndex = pFnMirrorVectorByNormal->iNative;
-	pFnMirrorVectorByNormal->iNative = 0;
-
-	pFnMirrorVectorByNormal->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMirrorVectorByNormal, &MirrorVectorByNormal_Parms, NULL );
-
-	pFnMirrorVectorByNormal->FunctionFlags |= 0x400;
-
-	pFnMirrorVectorByNormal->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMirrorVectorByNormal, &MirrorVectorByNormal_Parms ) )
+		this->ProcessEvent ( pFnMirrorVectorByNormal, &MirrorVectorByNormal_Parms, NULL );
 
 	return MirrorVectorByNormal_Parms.ReturnValue;
 };
@@ -5049,21 +4164,17 @@ struct FVector UObject::MirrorVectorByNormal ( struct FVector const& InVect, str
 
 struct FVector UObject::VRandCone2 ( struct FVector const& Dir, float HorizontalConeHalfAngleRadians, float VerticalConeHalfAngleRadians )
 {
-	static UFunction* pFnVRandCone2 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnVRandCone2Ref { L"Function Core.Object.VRandCone2", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnVRandCone2 )
-		pFnVRandCone2 = UObject::FindObject< UFunction > ( L"Function Core.Object.VRandCone2" );
+	UFunction* const pFnVRandCone2 = pFnVRandCone2Ref.Get ( );
 
 	UObject_execVRandCone2_Parms VRandCone2_Parms;
 	memcpy ( &VRandCone2_Parms.Dir, &Dir, 0xC );
 	VRandCone2_Parms.HorizontalConeHalfAngleRadians = HorizontalConeHalfAngleRadians;
 	VRandCone2_Parms.VerticalConeHalfAngleRadians = VerticalConeHalfAngleRadians;
 
-	pFnVRandCone2->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnVRandCone2, &VRandCone2_Parms, NULL );
-
-	pFnVRandCone2->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnVRandCone2, &VRandCone2_Parms ) )
+		this->ProcessEvent ( pFnVRandCone2, &VRandCone2_Parms, NULL );
 
 	return VRandCone2_Parms.ReturnValue;
 };
@@ -5077,20 +4188,16 @@ struct FVector UObject::VRandCone2 ( struct FVector const& Dir, float Horizontal
 
 struct FVector UObject::VRandCone ( struct FVector const& Dir, float ConeHalfAngleRadians )
 {
-	static UFunction* pFnVRandCone = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnVRandConeRef { L"Function Core.Object.VRandCone", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnVRandCone )
-		pFnVRandCone = UObject::FindObject< UFunction > ( L"Function Core.Object.VRandCone" );
+	UFunction* const pFnVRandCone = pFnVRandConeRef.Get ( );
 
 	UObject_execVRandCone_Parms VRandCone_Parms;
 	memcpy ( &VRandCone_Parms.Dir, &Dir, 0xC );
 	VRandCone_Parms.ConeHalfAngleRadians = ConeHalfAngleRadians;
 
-	pFnVRandCone->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnVRandCone, &VRandCone_Parms, NULL );
-
-	pFnVRandCone->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnVRandCone, &VRandCone_Parms ) )
+		this->ProcessEvent ( pFnVRandCone, &VRandCone_Parms, NULL );
 
 	return VRandCone_Parms.ReturnValue;
 };
@@ -5102,23 +4209,14 @@ struct FVector UObject::VRandCone ( struct FVector const& Dir, float ConeHalfAng
 
 struct FVector UObject::VRand ( )
 {
-	static UFunction* pFnVRand = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnVRandRef { L"Function Core.Object.VRand", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnVRand )
-		pFnVRand = UObject::FindObject< UFunction > ( L"Function Core.Object.VRand" );
+	UFunction* const pFnVRand = pFnVRandRef.Get ( );
 
 	UObject_execVRand_Parms VRand_Parms;
 
-	unsigned short NativeIndex = pFnVRand->iNative;
-	pFnVRand->iNative = 0;
-
-	pFnVRand->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnVRand, &VRand_Parms, NULL );
-
-	pFnVRand->FunctionFlags |= 0x400;
-
-	pFnVRand->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnVRand, &VRand_Parms ) )
+		this->ProcessEvent ( pFnVRand, &VRand_Parms, NULL );
 
 	return VRand_Parms.ReturnValue;
 };
@@ -5133,21 +4231,17 @@ struct FVector UObject::VRand ( )
 
 struct FVector UObject::VSmerp ( struct FVector const& A, struct FVector const& B, float Alpha )
 {
-	static UFunction* pFnVSmerp = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnVSmerpRef { L"Function Core.Object.VSmerp", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnVSmerp )
-		pFnVSmerp = UObject::FindObject< UFunction > ( L"Function Core.Object.VSmerp" );
+	UFunction* const pFnVSmerp = pFnVSmerpRef.Get ( );
 
 	UObject_execVSmerp_Parms VSmerp_Parms;
 	memcpy ( &VSmerp_Parms.A, &A, 0xC );
 	memcpy ( &VSmerp_Parms.B, &B, 0xC );
 	VSmerp_Parms.Alpha = Alpha;
 
-	pFnVSmerp->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnVSmerp, &VSmerp_Parms, NULL );
-
-	pFnVSmerp->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnVSmerp, &VSmerp_Parms ) )
+		this->ProcessEvent ( pFnVSmerp, &VSmerp_Parms, NULL );
 
 	return VSmerp_Parms.ReturnValue;
 };
@@ -5162,21 +4256,17 @@ struct FVector UObject::VSmerp ( struct FVector const& A, struct FVector const&
 
 struct FVector UObject::VLerp ( struct FVector const& A, struct FVector const& B, float Alpha )
 {
-	static UFunction* pFnVLerp = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnVLerpRef { L"Function Core.Object.VLerp", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnVLerp )
-		pFnVLerp = UObject::FindObject< UFunction > ( L"Function Core.Object.VLerp" );
+	UFunction* const pFnVLerp = pFnVLerpRef.Get ( );
 
 	UObject_execVLerp_Parms VLerp_Parms;
 	memcpy ( &VLerp_Parms.A, &A, 0xC );
 	memcpy ( &VLerp_Parms.B, &B, 0xC );
 	VLerp_Parms.Alpha = Alpha;
 
-	pFnVLerp->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnVLerp, &VLerp_Parms, NULL );
-
-	pFnVLerp->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnVLerp, &VLerp_Parms ) )
+		this->ProcessEvent ( pFnVLerp, &VLerp_Parms, NULL );
 
 	return VLerp_Parms.ReturnValue;
 };
@@ -5189,24 +4279,15 @@ struct FVector UObject::VLerp ( struct FVector const& A, struct FVector const& B
 
 struct FVector UObject::Normal ( struct FVector const& A )
 {
-	static UFunction* pFnNormal = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNormalRef { L"Function Core.Object.Normal", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNormal )
-		pFnNormal = UObject::FindObject< UFunction > ( L"Function Core.Object.Normal" );
+	UFunction* const pFnNormal = pFnNormalRef.Get ( );
 
 	UObject_execNormal_Parms Normal_Parms;
 	memcpy ( &Normal_Parms.A, &A, 0xC );
 
-	unsigned short NativeIndex = pFnNormal->iNative;
-	pFnNormal->iNative = 0;
-
-	pFnNormal->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNormal, &Normal_Parms, NULL );
-
-	pFnNormal->FunctionFlags |= 0x400;
-
-	pFnNormal->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnNormal, &Normal_Parms ) )
+		this->ProcessEvent ( pFnNormal, &Normal_Parms, NULL );
 
 	return Normal_Parms.ReturnValue;
 };
@@ -5219,19 +4300,15 @@ struct FVector UObject::Normal ( struct FVector const& A )
 
 float UObject::VSizeSq2D ( struct FVector const& A )
 {
-	static UFunction* pFnVSizeSq2D = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnVSizeSq2DRef { L"Function Core.Object.VSizeSq2D", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnVSizeSq2D )
-		pFnVSizeSq2D = UObject::FindObject< UFunction > ( L"Function Core.Object.VSizeSq2D" );
+	UFunction* const pFnVSizeSq2D = pFnVSizeSq2DRef.Get ( );
 
 	UObject_execVSizeSq2D_Parms VSizeSq2D_Parms;
 	memcpy ( &VSizeSq2D_Parms.A, &A, 0xC );
 
-	pFnVSizeSq2D->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnVSizeSq2D, &VSizeSq2D_Parms, NULL );
-
-	pFnVSizeSq2D->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnVSizeSq2D, &VSizeSq2D_Parms ) )
+		this->ProcessEvent ( pFnVSizeSq2D, &VSizeSq2D_Parms, NULL );
 
 	return VSizeSq2D_Parms.ReturnValue;
 };
@@ -5244,19 +4321,15 @@ float UObject::VSizeSq2D ( struct FVector const& A )
 
 float UObject::VSizeSq ( struct FVector const& A )
 {
-	static UFunction* pFnVSizeSq = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnVSizeSqRef { L"Function Core.Object.VSizeSq", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnVSizeSq )
-		pFnVSizeSq = UObject::FindObject< UFunction > ( L"Function Core.Object.VSizeSq" );
+	UFunction* const pFnVSizeSq = pFnVSizeSqRef.Get ( );
 
 	UObject_execVSizeSq_Parms VSizeSq_Parms;
 	memcpy ( &VSizeSq_Parms.A, &A, 0xC );
 
-	pFnVSizeSq->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnVSizeSq, &VSizeSq_Parms, NULL );
-
-	pFnVSizeSq->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnVSizeSq, &VSizeSq_Parms ) )
+		this->ProcessEvent ( pFnVSizeSq, &VSizeSq_Parms, NULL );
 
 	return VSizeSq_Parms.ReturnValue;
 };
@@ -5269,19 +4342,15 @@ float UObject::VSizeSq ( struct FVector const& A )
 
 float UObject::VSize2D ( struct FVector const& A )
 {
-	static UFunction* pFnVSize2D = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnVSize2DRef { L"Function Core.Object.VSize2D", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnVSize2D )
-		pFnVSize2D = UObject::FindObject< UFunction > ( L"Function Core.Object.VSize2D" );
+	UFunction* const pFnVSize2D = pFnVSize2DRef.Get ( );
 
 	UObject_execVSize2D_Parms VSize2D_Parms;
 	memcpy ( &VSize2D_Parms.A, &A, 0xC );
 
-	pFnVSize2D->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnVSize2D, &VSize2D_Parms, NULL );
-
-	pFnVSize2D->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnVSize2D, &VSize2D_Parms ) )
+		this->ProcessEvent ( pFnVSize2D, &VSize2D_Parms, NULL );
 
 	return VSize2D_Parms.ReturnValue;
 };
@@ -5294,24 +4363,15 @@ float UObject::VSize2D ( struct FVector const& A )
 
 float UObject::VSize ( struct FVector const& A )
 {
-	static UFunction* pFnVSize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnVSizeRef { L"Function Core.Object.VSize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnVSize )
-		pFnVSize = UObject::FindObject< UFunction > ( L"Function Core.Object.VSize" );
+	UFunction* const pFnVSize = pFnVSizeRef.Get ( );
 
 	UObject_execVSize_Parms VSize_Parms;
 	memcpy ( &VSize_Parms.A, &A, 0xC );
 
-	unsigned short NativeIndex = pFnVSize->iNative;
-	pFnVSize->iNative = 0;
-
-	pFnVSize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnVSize, &VSize_Parms, NULL );
-
-	pFnVSize->FunctionFlags |= 0x400;
-
-	pFnVSize->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnVSize, &VSize_Parms ) )
+		this->ProcessEvent ( pFnVSize, &VSize_Parms, NULL );
 
 	return VSize_Parms.ReturnValue;
 };
@@ -5325,10 +4385,9 @@ float UObject::VSize ( struct FVector const& A )
 
 struct FVector UObject::SubtractEqual_VectorVector ( struct FVector const& B, struct FVector* A )
 {
-	static UFunction* pFnSubtractEqual_VectorVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtractEqual_VectorVectorRef { L"Function Core.Object.SubtractEqual_VectorVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtractEqual_VectorVector )
-		pFnSubtractEqual_VectorVector = UObject::FindObject< UFunction > ( L"Function Core.Object.SubtractEqual_VectorVector" );
+	UFunction* const pFnSubtractEqual_VectorVector = pFnSubtractEqual_VectorVectorRef.Get ( );
 
 	UObject_execSubtractEqual_VectorVector_Parms SubtractEqual_VectorVector_Parms;
 	memcpy ( &SubtractEqual_VectorVector_Parms.B, &B, 0xC );
@@ -5336,16 +4395,8 @@ struct FVector UObject::SubtractEqual_VectorVector ( struct FVector const& B, st
 	if ( A )
 		memcpy ( &SubtractEqual_VectorVector_Parms.A, A, 0xC );
 
-	unsigned short NativeIndex = pFnSubtractEqual_VectorVector->iNative;
-	pFnSubtractEqual_VectorVector->iNative = 0;
-
-	pFnSubtractEqual_VectorVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtractEqual_VectorVector, &SubtractEqual_VectorVector_Parms, NULL );
-
-	pFnSubtractEqual_VectorVector->FunctionFlags |= 0x400;
-
-	pFnSubtractEqual_VectorVector->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtractEqual_VectorVector, &SubtractEqual_VectorVector_Parms ) )
+		this->ProcessEvent ( pFnSubtractEqual_VectorVector, &SubtractEqual_VectorVector_Parms, NULL );
 
 	if ( A )
 		memcpy ( A, &SubtractEqual_VectorVector_Parms.A, 0xC );
@@ -5362,10 +4413,9 @@ struct FVector UObject::SubtractEqual_VectorVector ( struct FVector const& B, st
 
 struct FVector UObject::AddEqual_VectorVector ( struct FVector const& B, struct FVector* A )
 {
-	static UFunction* pFnAddEqual_VectorVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddEqual_VectorVectorRef { L"Function Core.Object.AddEqual_VectorVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddEqual_VectorVector )
-		pFnAddEqual_VectorVector = UObject::FindObject< UFunction > ( L"Function Core.Object.AddEqual_VectorVector" );
+	UFunction* const pFnAddEqual_VectorVector = pFnAddEqual_VectorVectorRef.Get ( );
 
 	UObject_execAddEqual_VectorVector_Parms AddEqual_VectorVector_Parms;
 	memcpy ( &AddEqual_VectorVector_Parms.B, &B, 0xC );
@@ -5373,16 +4423,8 @@ struct FVector UObject::AddEqual_VectorVector ( struct FVector const& B, struct
 	if ( A )
 		memcpy ( &AddEqual_VectorVector_Parms.A, A, 0xC );
 
-	unsigned short NativeIndex = pFnAddEqual_VectorVector->iNative;
-	pFnAddEqual_VectorVector->iNative = 0;
-
-	pFnAddEqual_VectorVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddEqual_VectorVector, &AddEqual_VectorVector_Parms, NULL );
-
-	pFnAddEqual_VectorVector->FunctionFlags |= 0x400;
-
-	pFnAddEqual_VectorVector->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAddEqual_VectorVector, &AddEqual_VectorVector_Parms ) )
+		this->ProcessEvent ( pFnAddEqual_VectorVector, &AddEqual_VectorVector_Parms, NULL );
 
 	if ( A )
 		memcpy ( A, &AddEqual_VectorVector_Parms.A, 0xC );
@@ -5399,10 +4441,9 @@ struct FVector UObject::AddEqual_VectorVector ( struct FVector const& B, struct
 
 struct FVector UObject::DivideEqual_VectorFloat ( float B, struct FVector* A )
 {
-	static UFunction* pFnDivideEqual_VectorFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDivideEqual_VectorFloatRef { L"Function Core.Object.DivideEqual_VectorFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDivideEqual_VectorFloat )
-		pFnDivideEqual_VectorFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.DivideEqual_VectorFloat" );
+	UFunction* const pFnDivideEqual_VectorFloat = pFnDivideEqual_VectorFloatRef.Get ( );
 
 	UObject_execDivideEqual_VectorFloat_Parms DivideEqual_VectorFloat_Parms;
 	DivideEqual_VectorFloat_Parms.B = B;
@@ -5410,16 +4451,8 @@ struct FVector UObject::DivideEqual_VectorFloat ( float B, struct FVector* A )
 	if ( A )
 		memcpy ( &DivideEqual_VectorFloat_Parms.A, A, 0xC );
 
-	unsigned short NativeIndex = pFnDivideEqual_VectorFloat->iNative;
-	pFnDivideEqual_VectorFloat->iNative = 0;
-
-	pFnDivideEqual_VectorFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDivideEqual_VectorFloat, &DivideEqual_VectorFloat_Parms, NULL );
-
-	pFnDivideEqual_VectorFloat->FunctionFlags |= 0x400;
-
-	pFnDivideEqual_VectorFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnDivideEqual_VectorFloat, &DivideEqual_VectorFloat_Parms ) )
+		this->ProcessEvent ( pFnDivideEqual_VectorFloat, &DivideEqual_VectorFloat_Parms, NULL );
 
 	if ( A )
 		memcpy ( A, &DivideEqual_VectorFloat_Parms.A, 0xC );
@@ -5436,10 +4469,9 @@ struct FVector UObject::DivideEqual_VectorFloat ( float B, struct FVector* A )
 
 struct FVector UObject::MultiplyEqual_VectorVector ( struct FVector const& B, struct FVector* A )
 {
-	static UFunction* pFnMultiplyEqual_VectorVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiplyEqual_VectorVectorRef { L"Function Core.Object.MultiplyEqual_VectorVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiplyEqual_VectorVector )
-		pFnMultiplyEqual_VectorVector = UObject::FindObject< UFunction > ( L"Function Core.Object.MultiplyEqual_VectorVector" );
+	UFunction* const pFnMultiplyEqual_VectorVector = pFnMultiplyEqual_VectorVectorRef.Get ( );
 
 	UObject_execMultiplyEqual_VectorVector_Parms MultiplyEqual_VectorVector_Parms;
 	memcpy ( &MultiplyEqual_VectorVector_Parms.B, &B, 0xC );
@@ -5447,16 +4479,8 @@ struct FVector UObject::MultiplyEqual_VectorVector ( struct FVector const& B, st
 	if ( A )
 		memcpy ( &MultiplyEqual_VectorVector_Parms.A, A, 0xC );
 
-	unsigned short NativeIndex = pFnMultiplyEqual_VectorVector->iNative;
-	pFnMultiplyEqual_VectorVector->iNative = 0;
-
-	pFnMultiplyEqual_VectorVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiplyEqual_VectorVector, &MultiplyEqual_VectorVector_Parms, NULL );
-
-	pFnMultiplyEqual_VectorVector->FunctionFlags |= 0x400;
-
-	pFnMultiplyEqual_VectorVector->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMultiplyEqual_VectorVector, &MultiplyEqual_VectorVector_Parms ) )
+		this->ProcessEvent ( pFnMultiplyEqual_VectorVector, &MultiplyEqual_VectorVector_Parms, NULL );
 
 	if ( A )
 		memcpy ( A, &MultiplyEqual_VectorVector_Parms.A, 0xC );
@@ -5473,10 +4497,9 @@ struct FVector UObject::MultiplyEqual_VectorVector ( struct FVector const& B, st
 
 struct FVector UObject::MultiplyEqual_VectorFloat ( float B, struct FVector* A )
 {
-	static UFunction* pFnMultiplyEqual_VectorFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiplyEqual_VectorFloatRef { L"Function Core.Object.MultiplyEqual_VectorFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiplyEqual_VectorFloat )
-		pFnMultiplyEqual_VectorFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.MultiplyEqual_VectorFloat" );
+	UFunction* const pFnMultiplyEqual_VectorFloat = pFnMultiplyEqual_VectorFloatRef.Get ( );
 
 	UObject_execMultiplyEqual_VectorFloat_Parms MultiplyEqual_VectorFloat_Parms;
 	MultiplyEqual_VectorFloat_Parms.B = B;
@@ -5484,16 +4507,8 @@ struct FVector UObject::MultiplyEqual_VectorFloat ( float B, struct FVector* A )
 	if ( A )
 		memcpy ( &MultiplyEqual_VectorFloat_Parms.A, A, 0xC );
 
-	unsigned short NativeIndex = pFnMultiplyEqual_VectorFloat->iNative;
-	pFnMultiplyEqual_VectorFloat->iNative = 0;
-
-	pFnMultiplyEqual_VectorFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiplyEqual_VectorFloat, &MultiplyEqual_VectorFloat_Parms, NULL );
-
-	pFnMultiplyEqual_VectorFloat->FunctionFlags |= 0x400;
-
-	pFnMultiplyEqual_VectorFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMultiplyEqual_VectorFloat, &MultiplyEqual_VectorFloat_Parms ) )
+		this->ProcessEvent ( pFnMultiplyEqual_VectorFloat, &MultiplyEqual_VectorFloat_Parms, NULL );
 
 	if ( A )
 		memcpy ( A, &MultiplyEqual_VectorFloat_Parms.A, 0xC );
@@ -5510,25 +4525,16 @@ struct FVector UObject::MultiplyEqual_VectorFloat ( float B, struct FVector* A )
 
 struct FVector UObject::Cross_VectorVector ( struct FVector const& A, struct FVector const& B )
 {
-	static UFunction* pFnCross_VectorVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCross_VectorVectorRef { L"Function Core.Object.Cross_VectorVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCross_VectorVector )
-		pFnCross_VectorVector = UObject::FindObject< UFunction > ( L"Function Core.Object.Cross_VectorVector" );
+	UFunction* const pFnCross_VectorVector = pFnCross_VectorVectorRef.Get ( );
 
 	UObject_execCross_VectorVector_Parms Cross_VectorVector_Parms;
 	memcpy ( &Cross_VectorVector_Parms.A, &A, 0xC );
 	memcpy ( &Cross_VectorVector_Parms.B, &B, 0xC );
 
-	unsigned short NativeIndex = pFnCross_VectorVector->iNative;
-	pFnCross_VectorVector->iNative = 0;
-
-	pFnCross_VectorVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCross_VectorVector, &Cross_VectorVector_Parms, NULL );
-
-	pFnCross_VectorVector->FunctionFlags |= 0x400;
-
-	pFnCross_VectorVector->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnCross_VectorVector, &Cross_VectorVector_Parms ) )
+		this->ProcessEvent ( pFnCross_VectorVector, &Cross_VectorVector_Parms, NULL );
 
 	return Cross_VectorVector_Parms.ReturnValue;
 };
@@ -5542,25 +4548,16 @@ struct FVector UObject::Cross_VectorVector ( struct FVector const& A, struct FVe
 
 float UObject::Dot_VectorVector ( struct FVector const& A, struct FVector const& B )
 {
-	static UFunction* pFnDot_VectorVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDot_VectorVectorRef { L"Function Core.Object.Dot_VectorVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDot_VectorVector )
-		pFnDot_VectorVector = UObject::FindObject< UFunction > ( L"Function Core.Object.Dot_VectorVector" );
+	UFunction* const pFnDot_VectorVector = pFnDot_VectorVectorRef.Get ( );
 
 	UObject_execDot_VectorVector_Parms Dot_VectorVector_Parms;
 	memcpy ( &Dot_VectorVector_Parms.A, &A, 0xC );
 	memcpy ( &Dot_VectorVector_Parms.B, &B, 0xC );
 
-	unsigned short NativeIndex = pFnDot_VectorVector->iNative;
-	pFnDot_VectorVector->iNative = 0;
-
-	pFnDot_VectorVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDot_VectorVector, &Dot_VectorVector_Parms, NULL );
-
-	pFnDot_VectorVector->FunctionFlags |= 0x400;
-
-	pFnDot_VectorVector->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnDot_VectorVector, &Dot_VectorVector_Parms ) )
+		this->ProcessEvent ( pFnDot_VectorVector, &Dot_VectorVector_Parms, NULL );
 
 	return Dot_VectorVector_Parms.ReturnValue;
 };
@@ -5574,25 +4571,16 @@ float UObject::Dot_VectorVector ( struct FVector const& A, struct FVector const&
 
 bool UObject::NotEqual_VectorVector ( struct FVector const& A, struct FVector const& B )
 {
-	static UFunction* pFnNotEqual_VectorVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotEqual_VectorVectorRef { L"Function Core.Object.NotEqual_VectorVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotEqual_VectorVector )
-		pFnNotEqual_VectorVector = UObject::FindObject< UFunction > ( L"Function Core.Object.NotEqual_VectorVector" );
+	UFunction* const pFnNotEqual_VectorVector = pFnNotEqual_VectorVectorRef.Get ( );
 
 	UObject_execNotEqual_VectorVector_Parms NotEqual_VectorVector_Parms;
 	memcpy ( &NotEqual_VectorVector_Parms.A, &A, 0xC );
 	memcpy ( &NotEqual_VectorVector_Parms.B, &B, 0xC );
 
-	unsigned short NativeIndex = pFnNotEqual_VectorVector->iNative;
-	pFnNotEqual_VectorVector->iNative = 0;
-
-	pFnNotEqual_VectorVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotEqual_VectorVector, &NotEqual_VectorVector_Parms, NULL );
-
-	pFnNotEqual_VectorVector->FunctionFlags |= 0x400;
-
-	pFnNotEqual_VectorVector->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnNotEqual_VectorVector, &NotEqual_VectorVector_Parms ) )
+		this->ProcessEvent ( pFnNotEqual_VectorVector, &NotEqual_VectorVector_Parms, NULL );
 
 	return NotEqual_VectorVector_Parms.ReturnValue;
 };
@@ -5606,25 +4594,16 @@ bool UObject::NotEqual_VectorVector ( struct FVector const& A, struct FVector co
 
 bool UObject::EqualEqual_VectorVector ( struct FVector const& A, struct FVector const& B )
 {
-	static UFunction* pFnEqualEqual_VectorVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEqualEqual_VectorVectorRef { L"Function Core.Object.EqualEqual_VectorVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEqualEqual_VectorVector )
-		pFnEqualEqual_VectorVector = UObject::FindObject< UFunction > ( L"Function Core.Object.EqualEqual_VectorVector" );
+	UFunction* const pFnEqualEqual_VectorVector = pFnEqualEqual_VectorVectorRef.Get ( );
 
 	UObject_execEqualEqual_VectorVector_Parms EqualEqual_VectorVector_Parms;
 	memcpy ( &EqualEqual_VectorVector_Parms.A, &A, 0xC );
 	memcpy ( &EqualEqual_VectorVector_Parms.B, &B, 0xC );
 
-	unsigned short NativeIndex = pFnEqualEqual_VectorVector->iNative;
-	pFnEqualEqual_VectorVector->iNative = 0;
-
-	pFnEqualEqual_VectorVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEqualEqual_VectorVector, &EqualEqual_VectorVector_Parms, NULL );
-
-	pFnEqualEqual_VectorVector->FunctionFlags |= 0x400;
-
-	pFnEqualEqual_VectorVector->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnEqualEqual_VectorVector, &EqualEqual_VectorVector_Parms ) )
+		this->ProcessEvent ( pFnEqualEqual_VectorVector, &EqualEqual_VectorVector_Parms, NULL );
 
 	return EqualEqual_VectorVector_Parms.ReturnValue;
 };
@@ -5638,25 +4617,16 @@ bool UObject::EqualEqual_VectorVector ( struct FVector const& A, struct FVector
 
 struct FVector UObject::GreaterGreater_VectorRotator ( struct FVector const& A, struct FRotator const& B )
 {
-	static UFunction* pFnGreaterGreater_VectorRotator = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGreaterGreater_VectorRotatorRef { L"Function Core.Object.GreaterGreater_VectorRotator", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGreaterGreater_VectorRotator )
-		pFnGreaterGreater_VectorRotator = UObject::FindObject< UFunction > ( L"Function Core.Object.GreaterGreater_VectorRotator" );
+	UFunction* const pFnGreaterGreater_VectorRotator = pFnGreaterGreater_VectorRotatorRef.Get ( );
 
 	UObject_execGreaterGreater_VectorRotator_Parms GreaterGreater_VectorRotator_Parms;
 	memcpy ( &GreaterGreater_VectorRotator_Parms.A, &A, 0xC );
 	memcpy ( &GreaterGreater_VectorRotator_Parms.B, &B, 0xC );
 
-	unsigned short NativeIndex = pFnGreaterGreater_VectorRotator->iNative;
-	pFnGreaterGreater_VectorRotator->iNative = 0;
-
-	pFnGreaterGreater_VectorRotator->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGreaterGreater_VectorRotator, &GreaterGreater_VectorRotator_Parms, NULL );
-
-	pFnGreaterGreater_VectorRotator->FunctionFlags |= 0x400;
-
-	pFnGreaterGreater_VectorRotator->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnGreaterGreater_VectorRotator, &GreaterGreater_VectorRotator_Parms ) )
+		this->ProcessEvent ( pFnGreaterGreater_VectorRotator, &GreaterGreater_VectorRotator_Parms, NULL );
 
 	return GreaterGreater_VectorRotator_Parms.ReturnValue;
 };
@@ -5670,25 +4640,16 @@ struct FVector UObject::GreaterGreater_VectorRotator ( struct FVector const& A,
 
 struct FVector UObject::LessLess_VectorRotator ( struct FVector const& A, struct FRotator const& B )
 {
-	static UFunction* pFnLessLess_VectorRotator = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLessLess_VectorRotatorRef { L"Function Core.Object.LessLess_VectorRotator", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLessLess_VectorRotator )
-		pFnLessLess_VectorRotator = UObject::FindObject< UFunction > ( L"Function Core.Object.LessLess_VectorRotator" );
+	UFunction* const pFnLessLess_VectorRotator = pFnLessLess_VectorRotatorRef.Get ( );
 
 	UObject_execLessLess_VectorRotator_Parms LessLess_VectorRotator_Parms;
 	memcpy ( &LessLess_VectorRotator_Parms.A, &A, 0xC );
 	memcpy ( &LessLess_VectorRotator_Parms.B, &B, 0xC );
 
-	unsigned short NativeIndex = pFnLessLess_VectorRotator->iNative;
-	pFnLessLess_VectorRotator->iNative = 0;
-
-	pFnLessLess_VectorRotator->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLessLess_VectorRotator, &LessLess_VectorRotator_Parms, NULL );
-
-	pFnLessLess_VectorRotator->FunctionFlags |= 0x400;
-
-	pFnLessLess_VectorRotator->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnLessLess_VectorRotator, &LessLess_VectorRotator_Parms ) )
+		this->ProcessEvent ( pFnLessLess_VectorRotator, &LessLess_VectorRotator_Parms, NULL );
 
 	return LessLess_VectorRotator_Parms.ReturnValue;
 };
@@ -5702,25 +4663,16 @@ struct FVector UObject::LessLess_VectorRotator ( struct FVector const& A, struct
 
 struct FVector UObject::Subtract_VectorVector ( struct FVector const& A, struct FVector const& B )
 {
-	static UFunction* pFnSubtract_VectorVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtract_VectorVectorRef { L"Function Core.Object.Subtract_VectorVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtract_VectorVector )
-		pFnSubtract_VectorVector = UObject::FindObject< UFunction > ( L"Function Core.Object.Subtract_VectorVector" );
+	UFunction* const pFnSubtract_VectorVector = pFnSubtract_VectorVectorRef.Get ( );
 
 	UObject_execSubtract_VectorVector_Parms Subtract_VectorVector_Parms;
 	memcpy ( &Subtract_VectorVector_Parms.A, &A, 0xC );
 	memcpy ( &Subtract_VectorVector_Parms.B, &B, 0xC );
 
-	unsigned short NativeIndex = pFnSubtract_VectorVector->iNative;
-	pFnSubtract_VectorVector->iNative = 0;
-
-	pFnSubtract_VectorVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtract_VectorVector, &Subtract_VectorVector_Parms, NULL );
-
-	pFnSubtract_VectorVector->FunctionFlags |= 0x400;
-
-	pFnSubtract_VectorVector->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtract_VectorVector, &Subtract_VectorVector_Parms ) )
+		this->ProcessEvent ( pFnSubtract_VectorVector, &Subtract_VectorVector_Parms, NULL );
 
 	return Subtract_VectorVector_Parms.ReturnValue;
 };
@@ -5734,25 +4686,16 @@ struct FVector UObject::Subtract_VectorVector ( struct FVector const& A, struct
 
 struct FVector UObject::Add_VectorVector ( struct FVector const& A, struct FVector const& B )
 {
-	static UFunction* pFnAdd_VectorVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAdd_VectorVectorRef { L"Function Core.Object.Add_VectorVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAdd_VectorVector )
-		pFnAdd_VectorVector = UObject::FindObject< UFunction > ( L"Function Core.Object.Add_VectorVector" );
+	UFunction* const pFnAdd_VectorVector = pFnAdd_VectorVectorRef.Get ( );
 
 	UObject_execAdd_VectorVector_Parms Add_VectorVector_Parms;
 	memcpy ( &Add_VectorVector_Parms.A, &A, 0xC );
 	memcpy ( &Add_VectorVector_Parms.B, &B, 0xC );
 
-	unsigned short NativeIndex = pFnAdd_VectorVector->iNative;
-	pFnAdd_VectorVector->iNative = 0;
-
-	pFnAdd_VectorVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAdd_VectorVector, &Add_VectorVector_Parms, NULL );
-
-	pFnAdd_VectorVector->FunctionFlags |= 0x400;
-
-	pFnAdd_VectorVector->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAdd_VectorVector, &Add_VectorVector_Parms ) )
+		this->ProcessEvent ( pFnAdd_VectorVector, &Add_VectorVector_Parms, NULL );
 
 	return Add_VectorVector_Parms.ReturnValue;
 };
@@ -5766,25 +4709,16 @@ struct FVector UObject::Add_VectorVector ( struct FVector const& A, struct FVect
 
 struct FVector UObject::Divide_VectorFloat ( struct FVector const& A, float B )
 {
-	static UFunction* pFnDivide_VectorFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDivide_VectorFloatRef { L"Function Core.Object.Divide_VectorFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDivide_VectorFloat )
-		pFnDivide_VectorFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.Divide_VectorFloat" );
+	UFunction* const pFnDivide_VectorFloat = pFnDivide_VectorFloatRef.Get ( );
 
 	UObject_execDivide_VectorFloat_Parms Divide_VectorFloat_Parms;
 	memcpy ( &Divide_VectorFloat_Parms.A, &A, 0xC );
 	Divide_VectorFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnDivide_VectorFloat->iNative;
-	pFnDivide_VectorFloat->iNative = 0;
-
-	pFnDivide_VectorFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDivide_VectorFloat, &Divide_VectorFloat_Parms, NULL );
-
-	pFnDivide_VectorFloat->FunctionFlags |= 0x400;
-
-	pFnDivide_VectorFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnDivide_VectorFloat, &Divide_VectorFloat_Parms ) )
+		this->ProcessEvent ( pFnDivide_VectorFloat, &Divide_VectorFloat_Parms, NULL );
 
 	return Divide_VectorFloat_Parms.ReturnValue;
 };
@@ -5798,25 +4732,16 @@ struct FVector UObject::Divide_VectorFloat ( struct FVector const& A, float B )
 
 struct FVector UObject::Multiply_VectorVector ( struct FVector const& A, struct FVector const& B )
 {
-	static UFunction* pFnMultiply_VectorVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiply_VectorVectorRef { L"Function Core.Object.Multiply_VectorVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiply_VectorVector )
-		pFnMultiply_VectorVector = UObject::FindObject< UFunction > ( L"Function Core.Object.Multiply_VectorVector" );
+	UFunction* const pFnMultiply_VectorVector = pFnMultiply_VectorVectorRef.Get ( );
 
 	UObject_execMultiply_VectorVector_Parms Multiply_VectorVector_Parms;
 	memcpy ( &Multiply_VectorVector_Parms.A, &A, 0xC );
 	memcpy ( &Multiply_VectorVector_Parms.B, &B, 0xC );
 
-	unsigned short NativeIndex = pFnMultiply_VectorVector->iNative;
-	pFnMultiply_VectorVector->iNative = 0;
-
-	pFnMultiply_VectorVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiply_VectorVector, &Multiply_VectorVector_Parms, NULL );
-
-	pFnMultiply_VectorVector->FunctionFlags |= 0x400;
-
-	pFnMultiply_VectorVector->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMultiply_VectorVector, &Multiply_VectorVector_Parms ) )
+		this->ProcessEvent ( pFnMultiply_VectorVector, &Multiply_VectorVector_Parms, NULL );
 
 	return Multiply_VectorVector_Parms.ReturnValue;
 };
@@ -5830,25 +4755,16 @@ struct FVector UObject::Multiply_VectorVector ( struct FVector const& A, struct
 
 struct FVector UObject::Multiply_FloatVector ( float A, struct FVector const& B )
 {
-	static UFunction* pFnMultiply_FloatVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiply_FloatVectorRef { L"Function Core.Object.Multiply_FloatVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiply_FloatVector )
-		pFnMultiply_FloatVector = UObject::FindObject< UFunction > ( L"Function Core.Object.Multiply_FloatVector" );
+	UFunction* const pFnMultiply_FloatVector = pFnMultiply_FloatVectorRef.Get ( );
 
 	UObject_execMultiply_FloatVector_Parms Multiply_FloatVector_Parms;
 	Multiply_FloatVector_Parms.A = A;
 	memcpy ( &Multiply_FloatVector_Parms.B, &B, 0xC );
 
-	unsigned short NativeIndex = pFnMultiply_FloatVector->iNative;
-	pFnMultiply_FloatVector->iNative = 0;
-
-	pFnMultiply_FloatVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiply_FloatVector, &Multiply_FloatVector_Parms, NULL );
-
-	pFnMultiply_FloatVector->FunctionFlags |= 0x400;
-
-	pFnMultiply_FloatVector->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMultiply_FloatVector, &Multiply_FloatVector_Parms ) )
+		this->ProcessEvent ( pFnMultiply_FloatVector, &Multiply_FloatVector_Parms, NULL );
 
 	return Multiply_FloatVector_Parms.ReturnValue;
 };
@@ -5862,25 +4778,16 @@ struct FVector UObject::Multiply_FloatVector ( float A, struct FVector const& B
 
 struct FVector UObject::Multiply_VectorFloat ( struct FVector const& A, float B )
 {
-	static UFunction* pFnMultiply_VectorFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiply_VectorFloatRef { L"Function Core.Object.Multiply_VectorFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiply_VectorFloat )
-		pFnMultiply_VectorFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.Multiply_VectorFloat" );
+	UFunction* const pFnMultiply_VectorFloat = pFnMultiply_VectorFloatRef.Get ( );
 
 	UObject_execMultiply_VectorFloat_Parms Multiply_VectorFloat_Parms;
 	memcpy ( &Multiply_VectorFloat_Parms.A, &A, 0xC );
 	Multiply_VectorFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnMultiply_VectorFloat->iNative;
-	pFnMultiply_VectorFloat->iNative = 0;
-
-	pFnMultiply_VectorFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiply_VectorFloat, &Multiply_VectorFloat_Parms, NULL );
-
-	pFnMultiply_VectorFloat->FunctionFlags |= 0x400;
-
-	pFnMultiply_VectorFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMultiply_VectorFloat, &Multiply_VectorFloat_Parms ) )
+		this->ProcessEvent ( pFnMultiply_VectorFloat, &Multiply_VectorFloat_Parms, NULL );
 
 	return Multiply_VectorFloat_Parms.ReturnValue;
 };
@@ -5893,24 +4800,15 @@ struct FVector UObject::Multiply_VectorFloat ( struct FVector const& A, float B
 
 struct FVector UObject::Subtract_PreVector ( struct FVector const& A )
 {
-	static UFunction* pFnSubtract_PreVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtract_PreVectorRef { L"Function Core.Object.Subtract_PreVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtract_PreVector )
-		pFnSubtract_PreVector = UObject::FindObject< UFunction > ( L"Function Core.Object.Subtract_PreVector" );
+	UFunction* const pFnSubtract_PreVector = pFnSubtract_PreVectorRef.Get ( );
 
 	UObject_execSubtract_PreVector_Parms Subtract_PreVector_Parms;
 	memcpy ( &Subtract_PreVector_Parms.A, &A, 0xC );
 
-	unsigned short NativeIndex = pFnSubtract_PreVector->iNative;
-	pFnSubtract_PreVector->iNative = 0;
-
-	pFnSubtract_PreVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtract_PreVector, &Subtract_PreVector_Parms, NULL );
-
-	pFnSubtract_PreVector->FunctionFlags |= 0x400;
-
-	pFnSubtract_PreVector->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtract_PreVector, &Subtract_PreVector_Parms ) )
+		this->ProcessEvent ( pFnSubtract_PreVector, &Subtract_PreVector_Parms, NULL );
 
 	return Subtract_PreVector_Parms.ReturnValue;
 };
@@ -5924,21 +4822,17 @@ struct FVector UObject::Subtract_PreVector ( struct FVector const& A )
 
 void UObject::SetBioRwBox ( struct FBioRwBox const& Target, struct FVector const& Min, struct FVector const& Max )
 {
-	static UFunction* pFnSetBioRwBox = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetBioRwBoxRef { L"Function Core.Object.SetBioRwBox", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetBioRwBox )
-		pFnSetBioRwBox = UObject::FindObject< UFunction > ( L"Function Core.Object.SetBioRwBox" );
+	UFunction* const pFnSetBioRwBox = pFnSetBioRwBoxRef.Get ( );
 
 	UObject_execSetBioRwBox_Parms SetBioRwBox_Parms;
 	memcpy ( &SetBioRwBox_Parms.Target, &Target, 0x30 );
 	memcpy ( &SetBioRwBox_Parms.Min, &Min, 0xC );
 	memcpy ( &SetBioRwBox_Parms.Max, &Max, 0xC );
 
-	pFnSetBioRwBox->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetBioRwBox, &SetBioRwBox_Parms, NULL );
-
-	pFnSetBioRwBox->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetBioRwBox, &SetBioRwBox_Parms ) )
+		this->ProcessEvent ( pFnSetBioRwBox, &SetBioRwBox_Parms, NULL );
 };
 
 // Function Core.Object.GetTokenisedString
@@ -5950,20 +4844,16 @@ void UObject::SetBioRwBox ( struct FBioRwBox const& Target, struct FVector const
 
 FString UObject::GetTokenisedString ( int srStringID, TArray<struct FSFXTokenMapping> const& TokenList )
 {
-	static UFunction* pFnGetTokenisedString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTokenisedStringRef { L"Function Core.Object.GetTokenisedString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTokenisedString )
-		pFnGetTokenisedString = UObject::FindObject< UFunction > ( L"Function Core.Object.GetTokenisedString" );
+	UFunction* const pFnGetTokenisedString = pFnGetTokenisedStringRef.Get ( );
 
 	UObject_execGetTokenisedString_Parms GetTokenisedString_Parms;
 	GetTokenisedString_Parms.srStringID = srStringID;
 	memcpy ( &GetTokenisedString_Parms.TokenList, &TokenList, 0x10 );
 
-	pFnGetTokenisedString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetTokenisedString, &GetTokenisedString_Parms, NULL );
-
-	pFnGetTokenisedString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetTokenisedString, &GetTokenisedString_Parms ) )
+		this->ProcessEvent ( pFnGetTokenisedString, &GetTokenisedString_Parms, NULL );
 
 	return GetTokenisedString_Parms.ReturnValue;
 };
@@ -5976,20 +4866,16 @@ FString UObject::GetTokenisedString ( int srStringID, TArray<struct FSFXTokenMap
 
 void UObject::SetCustomToken ( int nTokenNum, FString const& sToken )
 {
-	static UFunction* pFnSetCustomToken = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetCustomTokenRef { L"Function Core.Object.SetCustomToken", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetCustomToken )
-		pFnSetCustomToken = UObject::FindObject< UFunction > ( L"Function Core.Object.SetCustomToken" );
+	UFunction* const pFnSetCustomToken = pFnSetCustomTokenRef.Get ( );
 
 	UObject_execSetCustomToken_Parms SetCustomToken_Parms;
 	SetCustomToken_Parms.nTokenNum = nTokenNum;
 	memcpy ( &SetCustomToken_Parms.sToken, &sToken, 0x10 );
 
-	pFnSetCustomToken->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetCustomToken, &SetCustomToken_Parms, NULL );
-
-	pFnSetCustomToken->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetCustomToken, &SetCustomToken_Parms ) )
+		this->ProcessEvent ( pFnSetCustomToken, &SetCustomToken_Parms, NULL );
 };
 
 // Function Core.Object.ClearCustomTokens
@@ -5998,18 +4884,14 @@ void UObject::SetCustomToken ( int nTokenNum, FString const& sToken )
 
 void UObject::ClearCustomTokens ( )
 {
-	static UFunction* pFnClearCustomTokens = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearCustomTokensRef { L"Function Core.Object.ClearCustomTokens", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearCustomTokens )
-		pFnClearCustomTokens = UObject::FindObject< UFunction > ( L"Function Core.Object.ClearCustomTokens" );
+	UFunction* const pFnClearCustomTokens = pFnClearCustomTokensRef.Get ( );
 
 	UObject_execClearCustomTokens_Parms ClearCustomTokens_Parms;
 
-	pFnClearCustomTokens->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnClearCustomTokens, &ClearCustomTokens_Parms, NULL );
-
-	pFnClearCustomTokens->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnClearCustomTokens, &ClearCustomTokens_Parms ) )
+		this->ProcessEvent ( pFnClearCustomTokens, &ClearCustomTokens_Parms, NULL );
 };
 
 // Function Core.Object.FInterpConstantTo
@@ -6023,10 +4905,9 @@ void UObject::ClearCustomTokens ( )
 
 float UObject::FInterpConstantTo ( float Current, float Target, float DeltaTime, float InterpSpeed )
 {
-	static UFunction* pFnFInterpConstantTo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFInterpConstantToRef { L"Function Core.Object.FInterpConstantTo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFInterpConstantTo )
-		pFnFInterpConstantTo = UObject::FindObject< UFunction > ( L"Function Core.Object.FInterpConstantTo" );
+	UFunction* const pFnFInterpConstantTo = pFnFInterpConstantToRef.Get ( );
 
 	UObject_execFInterpConstantTo_Parms FInterpConstantTo_Parms;
 	FInterpConstantTo_Parms.Current = Current;
@@ -6034,11 +4915,8 @@ float UObject::FInterpConstantTo ( float Current, float Target, float DeltaTime,
 	FInterpConstantTo_Parms.DeltaTime = DeltaTime;
 	FInterpConstantTo_Parms.InterpSpeed = InterpSpeed;
 
-	pFnFInterpConstantTo->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFInterpConstantTo, &FInterpConstantTo_Parms, NULL );
-
-	pFnFInterpConstantTo->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFInterpConstantTo, &FInterpConstantTo_Parms ) )
+		this->ProcessEvent ( pFnFInterpConstantTo, &FInterpConstantTo_Parms, NULL );
 
 	return FInterpConstantTo_Parms.ReturnValue;
 };
@@ -6054,10 +4932,9 @@ float UObject::FInterpConstantTo ( float Current, float Target, float DeltaTime,
 
 float UObject::FInterpTo ( float Current, float Target, float DeltaTime, float InterpSpeed )
 {
-	static UFunction* pFnFInterpTo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFInterpToRef { L"Function Core.Object.FInterpTo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFInterpTo )
-		pFnFInterpTo = UObject::FindObject< UFunction > ( L"Function Core.Object.FInterpTo" );
+	UFunction* const pFnFInterpTo = pFnFInterpToRef.Get ( );
 
 	UObject_execFInterpTo_Parms FInterpTo_Parms;
 	FInterpTo_Parms.Current = Current;
@@ -6065,11 +4942,8 @@ float UObject::FInterpTo ( float Current, float Target, float DeltaTime, float I
 	FInterpTo_Parms.DeltaTime = DeltaTime;
 	FInterpTo_Parms.InterpSpeed = InterpSpeed;
 
-	pFnFInterpTo->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFInterpTo, &FInterpTo_Parms, NULL );
-
-	pFnFInterpTo->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFInterpTo, &FInterpTo_Parms ) )
+		this->ProcessEvent ( pFnFInterpTo, &FInterpTo_Parms, NULL );
 
 	return FInterpTo_Parms.ReturnValue;
 };
@@ -6084,10 +4958,9 @@ float UObject::FInterpTo ( float Current, float Target, float DeltaTime, float I
 
 float UObject::FPctByRange ( float Value, float InMin, float InMax )
 {
-	static UFunction* pFnFPctByRange = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFPctByRangeRef { L"Function Core.Object.FPctByRange", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFPctByRange )
-		pFnFPctByRange = UObject::FindObject< UFunction > ( L"Function Core.Object.FPctByRange" );
+	UFunction* const pFnFPctByRange = pFnFPctByRangeRef.Get ( );
 
 	UObject_execFPctByRange_Parms FPctByRange_Parms;
 	FPctByRange_Parms.Value = Value;
@@ -6108,10 +4981,9 @@ float UObject::FPctByRange ( float Value, float InMin, float InMax )
 
 float UObject::RandRange ( float InMin, float InMax )
 {
-	static UFunction* pFnRandRange = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRandRangeRef { L"Function Core.Object.RandRange", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRandRange )
-		pFnRandRange = UObject::FindObject< UFunction > ( L"Function Core.Object.RandRange" );
+	UFunction* const pFnRandRange = pFnRandRangeRef.Get ( );
 
 	UObject_execRandRange_Parms RandRange_Parms;
 	RandRange_Parms.InMin = InMin;
@@ -6133,10 +5005,9 @@ float UObject::RandRange ( float InMin, float InMax )
 
 float UObject::FInterpEaseInOut ( float A, float B, float Alpha, float Exp )
 {
-	static UFunction* pFnFInterpEaseInOut = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFInterpEaseInOutRef { L"Function Core.Object.FInterpEaseInOut", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFInterpEaseInOut )
-		pFnFInterpEaseInOut = UObject::FindObject< UFunction > ( L"Function Core.Object.FInterpEaseInOut" );
+	UFunction* const pFnFInterpEaseInOut = pFnFInterpEaseInOutRef.Get ( );
 
 	UObject_execFInterpEaseInOut_Parms FInterpEaseInOut_Parms;
 	FInterpEaseInOut_Parms.A = A;
@@ -6144,11 +5015,8 @@ float UObject::FInterpEaseInOut ( float A, float B, float Alpha, float Exp )
 	FInterpEaseInOut_Parms.Alpha = Alpha;
 	FInterpEaseInOut_Parms.Exp = Exp;
 
-	pFnFInterpEaseInOut->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFInterpEaseInOut, &FInterpEaseInOut_Parms, NULL );
-
-	pFnFInterpEaseInOut->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFInterpEaseInOut, &FInterpEaseInOut_Parms ) )
+		this->ProcessEvent ( pFnFInterpEaseInOut, &FInterpEaseInOut_Parms, NULL );
 
 	return FInterpEaseInOut_Parms.ReturnValue;
 };
@@ -6164,10 +5032,9 @@ float UObject::FInterpEaseInOut ( float A, float B, float Alpha, float Exp )
 
 float UObject::FInterpEaseOut ( float A, float B, float Alpha, float Exp )
 {
-	static UFunction* pFnFInterpEaseOut = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFInterpEaseOutRef { L"Function Core.Object.FInterpEaseOut", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFInterpEaseOut )
-		pFnFInterpEaseOut = UObject::FindObject< UFunction > ( L"Function Core.Object.FInterpEaseOut" );
+	UFunction* const pFnFInterpEaseOut = pFnFInterpEaseOutRef.Get ( );
 
 	UObject_execFInterpEaseOut_Parms FInterpEaseOut_Parms;
 	FInterpEaseOut_Parms.A = A;
@@ -6191,10 +5058,9 @@ float UObject::FInterpEaseOut ( float A, float B, float Alpha, float Exp )
 
 float UObject::FInterpEaseIn ( float A, float B, float Alpha, float Exp )
 {
-	static UFunction* pFnFInterpEaseIn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFInterpEaseInRef { L"Function Core.Object.FInterpEaseIn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFInterpEaseIn )
-		pFnFInterpEaseIn = UObject::FindObject< UFunction > ( L"Function Core.Object.FInterpEaseIn" );
+	UFunction* const pFnFInterpEaseIn = pFnFInterpEaseInRef.Get ( );
 
 	UObject_execFInterpEaseIn_Parms FInterpEaseIn_Parms;
 	FInterpEaseIn_Parms.A = A;
@@ -6219,10 +5085,9 @@ float UObject::FInterpEaseIn ( float A, float B, float Alpha, float Exp )
 
 float UObject::FCubicInterp ( float P0, float T0, float P1, float T1, float A )
 {
-	static UFunction* pFnFCubicInterp = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFCubicInterpRef { L"Function Core.Object.FCubicInterp", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFCubicInterp )
-		pFnFCubicInterp = UObject::FindObject< UFunction > ( L"Function Core.Object.FCubicInterp" );
+	UFunction* const pFnFCubicInterp = pFnFCubicInterpRef.Get ( );
 
 	UObject_execFCubicInterp_Parms FCubicInterp_Parms;
 	FCubicInterp_Parms.P0 = P0;
@@ -6231,11 +5096,8 @@ float UObject::FCubicInterp ( float P0, float T0, float P1, float T1, float A )
 	FCubicInterp_Parms.T1 = T1;
 	FCubicInterp_Parms.A = A;
 
-	pFnFCubicInterp->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFCubicInterp, &FCubicInterp_Parms, NULL );
-
-	pFnFCubicInterp->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFCubicInterp, &FCubicInterp_Parms ) )
+		this->ProcessEvent ( pFnFCubicInterp, &FCubicInterp_Parms, NULL );
 
 	return FCubicInterp_Parms.ReturnValue;
 };
@@ -6248,19 +5110,15 @@ float UObject::FCubicInterp ( float P0, float T0, float P1, float T1, float A )
 
 int UObject::FCeil ( float A )
 {
-	static UFunction* pFnFCeil = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFCeilRef { L"Function Core.Object.FCeil", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFCeil )
-		pFnFCeil = UObject::FindObject< UFunction > ( L"Function Core.Object.FCeil" );
+	UFunction* const pFnFCeil = pFnFCeilRef.Get ( );
 
 	UObject_execFCeil_Parms FCeil_Parms;
 	FCeil_Parms.A = A;
 
-	pFnFCeil->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFCeil, &FCeil_Parms, NULL );
-
-	pFnFCeil->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFCeil, &FCeil_Parms ) )
+		this->ProcessEvent ( pFnFCeil, &FCeil_Parms, NULL );
 
 	return FCeil_Parms.ReturnValue;
 };
@@ -6273,19 +5131,15 @@ int UObject::FCeil ( float A )
 
 int UObject::FFloor ( float A )
 {
-	static UFunction* pFnFFloor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFFloorRef { L"Function Core.Object.FFloor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFFloor )
-		pFnFFloor = UObject::FindObject< UFunction > ( L"Function Core.Object.FFloor" );
+	UFunction* const pFnFFloor = pFnFFloorRef.Get ( );
 
 	UObject_execFFloor_Parms FFloor_Parms;
 	FFloor_Parms.A = A;
 
-	pFnFFloor->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFFloor, &FFloor_Parms, NULL );
-
-	pFnFFloor->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFFloor, &FFloor_Parms ) )
+		this->ProcessEvent ( pFnFFloor, &FFloor_Parms, NULL );
 
 	return FFloor_Parms.ReturnValue;
 };
@@ -6298,24 +5152,15 @@ int UObject::FFloor ( float A )
 
 int UObject::Round ( float A )
 {
-	static UFunction* pFnRound = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRoundRef { L"Function Core.Object.Round", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRound )
-		pFnRound = UObject::FindObject< UFunction > ( L"Function Core.Object.Round" );
+	UFunction* const pFnRound = pFnRoundRef.Get ( );
 
 	UObject_execRound_Parms Round_Parms;
 	Round_Parms.A = A;
 
-	unsigned short NativeIndex = pFnRound->iNative;
-	pFnRound->iNative = 0;
-
-	pFnRound->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRound, &Round_Parms, NULL );
-
-	pFnRound->FunctionFlags |= 0x400;
-
-	pFnRound->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnRound, &Round_Parms ) )
+		this->ProcessEvent ( pFnRound, &Round_Parms, NULL );
 
 	return Round_Parms.ReturnValue;
 };
@@ -6330,26 +5175,17 @@ int UObject::Round ( float A )
 
 float UObject::Lerp ( float A, float B, float Alpha )
 {
-	static UFunction* pFnLerp = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLerpRef { L"Function Core.Object.Lerp", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLerp )
-		pFnLerp = UObject::FindObject< UFunction > ( L"Function Core.Object.Lerp" );
+	UFunction* const pFnLerp = pFnLerpRef.Get ( );
 
 	UObject_execLerp_Parms Lerp_Parms;
 	Lerp_Parms.A = A;
 	Lerp_Parms.B = B;
 	Lerp_Parms.Alpha = Alpha;
 
-	unsigned short NativeIndex = pFnLerp->iNative;
-	pFnLerp->iNative = 0;
-
-	pFnLerp->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLerp, &Lerp_Parms, NULL );
-
-	pFnLerp->FunctionFlags |= 0x400;
-
-	pFnLerp->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnLerp, &Lerp_Parms ) )
+		this->ProcessEvent ( pFnLerp, &Lerp_Parms, NULL );
 
 	return Lerp_Parms.ReturnValue;
 };
@@ -6364,26 +5200,17 @@ float UObject::Lerp ( float A, float B, float Alpha )
 
 float UObject::FClamp ( float V, float A, float B )
 {
-	static UFunction* pFnFClamp = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFClampRef { L"Function Core.Object.FClamp", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFClamp )
-		pFnFClamp = UObject::FindObject< UFunction > ( L"Function Core.Object.FClamp" );
+	UFunction* const pFnFClamp = pFnFClampRef.Get ( );
 
 	UObject_execFClamp_Parms FClamp_Parms;
 	FClamp_Parms.V = V;
 	FClamp_Parms.A = A;
 	FClamp_Parms.B = B;
 
-	unsigned short NativeIndex = pFnFClamp->iNative;
-	pFnFClamp->iNative = 0;
-
-	pFnFClamp->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFClamp, &FClamp_Parms, NULL );
-
-	pFnFClamp->FunctionFlags |= 0x400;
-
-	pFnFClamp->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnFClamp, &FClamp_Parms ) )
+		this->ProcessEvent ( pFnFClamp, &FClamp_Parms, NULL );
 
 	return FClamp_Parms.ReturnValue;
 };
@@ -6397,25 +5224,16 @@ float UObject::FClamp ( float V, float A, float B )
 
 float UObject::FMax ( float A, float B )
 {
-	static UFunction* pFnFMax = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFMaxRef { L"Function Core.Object.FMax", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFMax )
-		pFnFMax = UObject::FindObject< UFunction > ( L"Function Core.Object.FMax" );
+	UFunction* const pFnFMax = pFnFMaxRef.Get ( );
 
 	UObject_execFMax_Parms FMax_Parms;
 	FMax_Parms.A = A;
 	FMax_Parms.B = B;
 
-	unsigned short NativeIndex = pFnFMax->iNative;
-	pFnFMax->iNative = 0;
-
-	pFnFMax->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFMax, &FMax_Parms, NULL );
-
-	pFnFMax->FunctionFlags |= 0x400;
-
-	pFnFMax->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnFMax, &FMax_Parms ) )
+		this->ProcessEvent ( pFnFMax, &FMax_Parms, NULL );
 
 	return FMax_Parms.ReturnValue;
 };
@@ -6429,25 +5247,16 @@ float UObject::FMax ( float A, float B )
 
 float UObject::FMin ( float A, float B )
 {
-	static UFunction* pFnFMin = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFMinRef { L"Function Core.Object.FMin", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFMin )
-		pFnFMin = UObject::FindObject< UFunction > ( L"Function Core.Object.FMin" );
+	UFunction* const pFnFMin = pFnFMinRef.Get ( );
 
 	UObject_execFMin_Parms FMin_Parms;
 	FMin_Parms.A = A;
 	FMin_Parms.B = B;
 
-	unsigned short NativeIndex = pFnFMin->iNative;
-	pFnFMin->iNative = 0;
-
-	pFnFMin->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFMin, &FMin_Parms, NULL );
-
-	pFnFMin->FunctionFlags |= 0x400;
-
-	pFnFMin->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnFMin, &FMin_Parms ) )
+		this->ProcessEvent ( pFnFMin, &FMin_Parms, NULL );
 
 	return FMin_Parms.ReturnValue;
 };
@@ -6459,23 +5268,14 @@ float UObject::FMin ( float A, float B )
 
 float UObject::FRand ( )
 {
-	static UFunction* pFnFRand = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFRandRef { L"Function Core.Object.FRand", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFRand )
-		pFnFRand = UObject::FindObject< UFunction > ( L"Function Core.Object.FRand" );
+	UFunction* const pFnFRand = pFnFRandRef.Get ( );
 
 	UObject_execFRand_Parms FRand_Parms;
 
-	unsigned short NativeIndex = pFnFRand->iNative;
-	pFnFRand->iNative = 0;
-
-	pFnFRand->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFRand, &FRand_Parms, NULL );
-
-	pFnFRand->FunctionFlags |= 0x400;
-
-	pFnFRand->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnFRand, &FRand_Parms ) )
+		this->ProcessEvent ( pFnFRand, &FRand_Parms, NULL );
 
 	return FRand_Parms.ReturnValue;
 };
@@ -6488,24 +5288,15 @@ float UObject::FRand ( )
 
 float UObject::Square ( float A )
 {
-	static UFunction* pFnSquare = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSquareRef { L"Function Core.Object.Square", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSquare )
-		pFnSquare = UObject::FindObject< UFunction > ( L"Function Core.Object.Square" );
+	UFunction* const pFnSquare = pFnSquareRef.Get ( );
 
 	UObject_execSquare_Parms Square_Parms;
 	Square_Parms.A = A;
 
-	unsigned short NativeIndex = pFnSquare->iNative;
-	pFnSquare->iNative = 0;
-
-	pFnSquare->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSquare, &Square_Parms, NULL );
-
-	pFnSquare->FunctionFlags |= 0x400;
-
-	pFnSquare->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSquare, &Square_Parms ) )
+		this->ProcessEvent ( pFnSquare, &Square_Parms, NULL );
 
 	return Square_Parms.ReturnValue;
 };
@@ -6518,24 +5309,15 @@ float UObject::Square ( float A )
 
 float UObject::Sqrt ( float A )
 {
-	static UFunction* pFnSqrt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSqrtRef { L"Function Core.Object.Sqrt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSqrt )
-		pFnSqrt = UObject::FindObject< UFunction > ( L"Function Core.Object.Sqrt" );
+	UFunction* const pFnSqrt = pFnSqrtRef.Get ( );
 
 	UObject_execSqrt_Parms Sqrt_Parms;
 	Sqrt_Parms.A = A;
 
-	unsigned short NativeIndex = pFnSqrt->iNative;
-	pFnSqrt->iNative = 0;
-
-	pFnSqrt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSqrt, &Sqrt_Parms, NULL );
-
-	pFnSqrt->FunctionFlags |= 0x400;
-
-	pFnSqrt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSqrt, &Sqrt_Parms ) )
+		this->ProcessEvent ( pFnSqrt, &Sqrt_Parms, NULL );
 
 	return Sqrt_Parms.ReturnValue;
 };
@@ -6548,24 +5330,15 @@ float UObject::Sqrt ( float A )
 
 float UObject::Loge ( float A )
 {
-	static UFunction* pFnLoge = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLogeRef { L"Function Core.Object.Loge", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLoge )
-		pFnLoge = UObject::FindObject< UFunction > ( L"Function Core.Object.Loge" );
+	UFunction* const pFnLoge = pFnLogeRef.Get ( );
 
 	UObject_execLoge_Parms Loge_Parms;
 	Loge_Parms.A = A;
 
-	unsigned short NativeIndex = pFnLoge->iNative;
-	pFnLoge->iNative = 0;
-
-	pFnLoge->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLoge, &Loge_Parms, NULL );
-
-	pFnLoge->FunctionFlags |= 0x400;
-
-	pFnLoge->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnLoge, &Loge_Parms ) )
+		this->ProcessEvent ( pFnLoge, &Loge_Parms, NULL );
 
 	return Loge_Parms.ReturnValue;
 };
@@ -6578,24 +5351,15 @@ float UObject::Loge ( float A )
 
 float UObject::Exp ( float A )
 {
-	static UFunction* pFnExp = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnExpRef { L"Function Core.Object.Exp", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnExp )
-		pFnExp = UObject::FindObject< UFunction > ( L"Function Core.Object.Exp" );
+	UFunction* const pFnExp = pFnExpRef.Get ( );
 
 	UObject_execExp_Parms Exp_Parms;
 	Exp_Parms.A = A;
 
-	unsigned short NativeIndex = pFnExp->iNative;
-	pFnExp->iNative = 0;
-
-	pFnExp->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnExp, &Exp_Parms, NULL );
-
-	pFnExp->FunctionFlags |= 0x400;
-
-	pFnExp->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnExp, &Exp_Parms ) )
+		this->ProcessEvent ( pFnExp, &Exp_Parms, NULL );
 
 	return Exp_Parms.ReturnValue;
 };
@@ -6609,20 +5373,16 @@ float UObject::Exp ( float A )
 
 float UObject::Atan2 ( float A, float B )
 {
-	static UFunction* pFnAtan2 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAtan2Ref { L"Function Core.Object.Atan2", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAtan2 )
-		pFnAtan2 = UObject::FindObject< UFunction > ( L"Function Core.Object.Atan2" );
+	UFunction* const pFnAtan2 = pFnAtan2Ref.Get ( );
 
 	UObject_execAtan2_Parms Atan2_Parms;
 	Atan2_Parms.A = A;
 	Atan2_Parms.B = B;
 
-	pFnAtan2->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAtan2, &Atan2_Parms, NULL );
-
-	pFnAtan2->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAtan2, &Atan2_Parms ) )
+		this->ProcessEvent ( pFnAtan2, &Atan2_Parms, NULL );
 
 	return Atan2_Parms.ReturnValue;
 };
@@ -6635,24 +5395,15 @@ float UObject::Atan2 ( float A, float B )
 
 float UObject::Atan ( float A )
 {
-	static UFunction* pFnAtan = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAtanRef { L"Function Core.Object.Atan", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAtan )
-		pFnAtan = UObject::FindObject< UFunction > ( L"Function Core.Object.Atan" );
+	UFunction* const pFnAtan = pFnAtanRef.Get ( );
 
 	UObject_execAtan_Parms Atan_Parms;
 	Atan_Parms.A = A;
 
-	unsigned short NativeIndex = pFnAtan->iNative;
-	pFnAtan->iNative = 0;
-
-	pFnAtan->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAtan, &Atan_Parms, NULL );
-
-	pFnAtan->FunctionFlags |= 0x400;
-
-	pFnAtan->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAtan, &Atan_Parms ) )
+		this->ProcessEvent ( pFnAtan, &Atan_Parms, NULL );
 
 	return Atan_Parms.ReturnValue;
 };
@@ -6665,24 +5416,15 @@ float UObject::Atan ( float A )
 
 float UObject::Tan ( float A )
 {
-	static UFunction* pFnTan = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTanRef { L"Function Core.Object.Tan", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTan )
-		pFnTan = UObject::FindObject< UFunction > ( L"Function Core.Object.Tan" );
+	UFunction* const pFnTan = pFnTanRef.Get ( );
 
 	UObject_execTan_Parms Tan_Parms;
 	Tan_Parms.A = A;
 
-	unsigned short NativeIndex = pFnTan->iNative;
-	pFnTan->iNative = 0;
-
-	pFnTan->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnTan, &Tan_Parms, NULL );
-
-	pFnTan->FunctionFlags |= 0x400;
-
-	pFnTan->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnTan, &Tan_Parms ) )
+		this->ProcessEvent ( pFnTan, &Tan_Parms, NULL );
 
 	return Tan_Parms.ReturnValue;
 };
@@ -6695,19 +5437,15 @@ float UObject::Tan ( float A )
 
 float UObject::Acos ( float A )
 {
-	static UFunction* pFnAcos = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAcosRef { L"Function Core.Object.Acos", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAcos )
-		pFnAcos = UObject::FindObject< UFunction > ( L"Function Core.Object.Acos" );
+	UFunction* const pFnAcos = pFnAcosRef.Get ( );
 
 	UObject_execAcos_Parms Acos_Parms;
 	Acos_Parms.A = A;
 
-	pFnAcos->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAcos, &Acos_Parms, NULL );
-
-	pFnAcos->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAcos, &Acos_Parms ) )
+		this->ProcessEvent ( pFnAcos, &Acos_Parms, NULL );
 
 	return Acos_Parms.ReturnValue;
 };
@@ -6720,24 +5458,15 @@ float UObject::Acos ( float A )
 
 float UObject::Cos ( float A )
 {
-	static UFunction* pFnCos = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCosRef { L"Function Core.Object.Cos", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCos )
-		pFnCos = UObject::FindObject< UFunction > ( L"Function Core.Object.Cos" );
+	UFunction* const pFnCos = pFnCosRef.Get ( );
 
 	UObject_execCos_Parms Cos_Parms;
 	Cos_Parms.A = A;
 
-	unsigned short NativeIndex = pFnCos->iNative;
-	pFnCos->iNative = 0;
-
-	pFnCos->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCos, &Cos_Parms, NULL );
-
-	pFnCos->FunctionFlags |= 0x400;
-
-	pFnCos->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnCos, &Cos_Parms ) )
+		this->ProcessEvent ( pFnCos, &Cos_Parms, NULL );
 
 	return Cos_Parms.ReturnValue;
 };
@@ -6750,19 +5479,15 @@ float UObject::Cos ( float A )
 
 float UObject::Asin ( float A )
 {
-	static UFunction* pFnAsin = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAsinRef { L"Function Core.Object.Asin", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAsin )
-		pFnAsin = UObject::FindObject< UFunction > ( L"Function Core.Object.Asin" );
+	UFunction* const pFnAsin = pFnAsinRef.Get ( );
 
 	UObject_execAsin_Parms Asin_Parms;
 	Asin_Parms.A = A;
 
-	pFnAsin->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAsin, &Asin_Parms, NULL );
-
-	pFnAsin->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAsin, &Asin_Parms ) )
+		this->ProcessEvent ( pFnAsin, &Asin_Parms, NULL );
 
 	return Asin_Parms.ReturnValue;
 };
@@ -6775,24 +5500,15 @@ float UObject::Asin ( float A )
 
 float UObject::Sin ( float A )
 {
-	static UFunction* pFnSin = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSinRef { L"Function Core.Object.Sin", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSin )
-		pFnSin = UObject::FindObject< UFunction > ( L"Function Core.Object.Sin" );
+	UFunction* const pFnSin = pFnSinRef.Get ( );
 
 	UObject_execSin_Parms Sin_Parms;
 	Sin_Parms.A = A;
 
-	unsigned short NativeIndex = pFnSin->iNative;
-	pFnSin->iNative = 0;
-
-	pFnSin->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSin, &Sin_Parms, NULL );
-
-	pFnSin->FunctionFlags |= 0x400;
-
-	pFnSin->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSin, &Sin_Parms ) )
+		this->ProcessEvent ( pFnSin, &Sin_Parms, NULL );
 
 	return Sin_Parms.ReturnValue;
 };
@@ -6805,24 +5521,15 @@ float UObject::Sin ( float A )
 
 float UObject::Abs ( float A )
 {
-	static UFunction* pFnAbs = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAbsRef { L"Function Core.Object.Abs", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAbs )
-		pFnAbs = UObject::FindObject< UFunction > ( L"Function Core.Object.Abs" );
+	UFunction* const pFnAbs = pFnAbsRef.Get ( );
 
 	UObject_execAbs_Parms Abs_Parms;
 	Abs_Parms.A = A;
 
-	unsigned short NativeIndex = pFnAbs->iNative;
-	pFnAbs->iNative = 0;
-
-	pFnAbs->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAbs, &Abs_Parms, NULL );
-
-	pFnAbs->FunctionFlags |= 0x400;
-
-	pFnAbs->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAbs, &Abs_Parms ) )
+		this->ProcessEvent ( pFnAbs, &Abs_Parms, NULL );
 
 	return Abs_Parms.ReturnValue;
 };
@@ -6836,10 +5543,9 @@ float UObject::Abs ( float A )
 
 float UObject::SubtractEqual_FloatFloat ( float B, float* A )
 {
-	static UFunction* pFnSubtractEqual_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtractEqual_FloatFloatRef { L"Function Core.Object.SubtractEqual_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtractEqual_FloatFloat )
-		pFnSubtractEqual_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.SubtractEqual_FloatFloat" );
+	UFunction* const pFnSubtractEqual_FloatFloat = pFnSubtractEqual_FloatFloatRef.Get ( );
 
 	UObject_execSubtractEqual_FloatFloat_Parms SubtractEqual_FloatFloat_Parms;
 	SubtractEqual_FloatFloat_Parms.B = B;
@@ -6847,16 +5553,8 @@ float UObject::SubtractEqual_FloatFloat ( float B, float* A )
 	if ( A )
 		SubtractEqual_FloatFloat_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnSubtractEqual_FloatFloat->iNative;
-	pFnSubtractEqual_FloatFloat->iNative = 0;
-
-	pFnSubtractEqual_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtractEqual_FloatFloat, &SubtractEqual_FloatFloat_Parms, NULL );
-
-	pFnSubtractEqual_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnSubtractEqual_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtractEqual_FloatFloat, &SubtractEqual_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnSubtractEqual_FloatFloat, &SubtractEqual_FloatFloat_Parms, NULL );
 
 	if ( A )
 		*A = SubtractEqual_FloatFloat_Parms.A;
@@ -6873,10 +5571,9 @@ float UObject::SubtractEqual_FloatFloat ( float B, float* A )
 
 float UObject::AddEqual_FloatFloat ( float B, float* A )
 {
-	static UFunction* pFnAddEqual_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddEqual_FloatFloatRef { L"Function Core.Object.AddEqual_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddEqual_FloatFloat )
-		pFnAddEqual_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.AddEqual_FloatFloat" );
+	UFunction* const pFnAddEqual_FloatFloat = pFnAddEqual_FloatFloatRef.Get ( );
 
 	UObject_execAddEqual_FloatFloat_Parms AddEqual_FloatFloat_Parms;
 	AddEqual_FloatFloat_Parms.B = B;
@@ -6884,16 +5581,8 @@ float UObject::AddEqual_FloatFloat ( float B, float* A )
 	if ( A )
 		AddEqual_FloatFloat_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnAddEqual_FloatFloat->iNative;
-	pFnAddEqual_FloatFloat->iNative = 0;
-
-	pFnAddEqual_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddEqual_FloatFloat, &AddEqual_FloatFloat_Parms, NULL );
-
-	pFnAddEqual_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnAddEqual_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAddEqual_FloatFloat, &AddEqual_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnAddEqual_FloatFloat, &AddEqual_FloatFloat_Parms, NULL );
 
 	if ( A )
 		*A = AddEqual_FloatFloat_Parms.A;
@@ -6910,10 +5599,9 @@ float UObject::AddEqual_FloatFloat ( float B, float* A )
 
 float UObject::DivideEqual_FloatFloat ( float B, float* A )
 {
-	static UFunction* pFnDivideEqual_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDivideEqual_FloatFloatRef { L"Function Core.Object.DivideEqual_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDivideEqual_FloatFloat )
-		pFnDivideEqual_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.DivideEqual_FloatFloat" );
+	UFunction* const pFnDivideEqual_FloatFloat = pFnDivideEqual_FloatFloatRef.Get ( );
 
 	UObject_execDivideEqual_FloatFloat_Parms DivideEqual_FloatFloat_Parms;
 	DivideEqual_FloatFloat_Parms.B = B;
@@ -6921,16 +5609,8 @@ float UObject::DivideEqual_FloatFloat ( float B, float* A )
 	if ( A )
 		DivideEqual_FloatFloat_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnDivideEqual_FloatFloat->iNative;
-	pFnDivideEqual_FloatFloat->iNative = 0;
-
-	pFnDivideEqual_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDivideEqual_FloatFloat, &DivideEqual_FloatFloat_Parms, NULL );
-
-	pFnDivideEqual_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnDivideEqual_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnDivideEqual_FloatFloat, &DivideEqual_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnDivideEqual_FloatFloat, &DivideEqual_FloatFloat_Parms, NULL );
 
 	if ( A )
 		*A = DivideEqual_FloatFloat_Parms.A;
@@ -6947,10 +5627,9 @@ float UObject::DivideEqual_FloatFloat ( float B, float* A )
 
 float UObject::MultiplyEqual_FloatFloat ( float B, float* A )
 {
-	static UFunction* pFnMultiplyEqual_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiplyEqual_FloatFloatRef { L"Function Core.Object.MultiplyEqual_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiplyEqual_FloatFloat )
-		pFnMultiplyEqual_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.MultiplyEqual_FloatFloat" );
+	UFunction* const pFnMultiplyEqual_FloatFloat = pFnMultiplyEqual_FloatFloatRef.Get ( );
 
 	UObject_execMultiplyEqual_FloatFloat_Parms MultiplyEqual_FloatFloat_Parms;
 	MultiplyEqual_FloatFloat_Parms.B = B;
@@ -6958,16 +5637,8 @@ float UObject::MultiplyEqual_FloatFloat ( float B, float* A )
 	if ( A )
 		MultiplyEqual_FloatFloat_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnMultiplyEqual_FloatFloat->iNative;
-	pFnMultiplyEqual_FloatFloat->iNative = 0;
-
-	pFnMultiplyEqual_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiplyEqual_FloatFloat, &MultiplyEqual_FloatFloat_Parms, NULL );
-
-	pFnMultiplyEqual_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnMultiplyEqual_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMultiplyEqual_FloatFloat, &MultiplyEqual_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnMultiplyEqual_FloatFloat, &MultiplyEqual_FloatFloat_Parms, NULL );
 
 	if ( A )
 		*A = MultiplyEqual_FloatFloat_Parms.A;
@@ -6984,25 +5655,16 @@ float UObject::MultiplyEqual_FloatFloat ( float B, float* A )
 
 bool UObject::NotEqual_FloatFloat ( float A, float B )
 {
-	static UFunction* pFnNotEqual_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotEqual_FloatFloatRef { L"Function Core.Object.NotEqual_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotEqual_FloatFloat )
-		pFnNotEqual_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.NotEqual_FloatFloat" );
+	UFunction* const pFnNotEqual_FloatFloat = pFnNotEqual_FloatFloatRef.Get ( );
 
 	UObject_execNotEqual_FloatFloat_Parms NotEqual_FloatFloat_Parms;
 	NotEqual_FloatFloat_Parms.A = A;
 	NotEqual_FloatFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnNotEqual_FloatFloat->iNative;
-	pFnNotEqual_FloatFloat->iNative = 0;
-
-	pFnNotEqual_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotEqual_FloatFloat, &NotEqual_FloatFloat_Parms, NULL );
-
-	pFnNotEqual_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnNotEqual_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnNotEqual_FloatFloat, &NotEqual_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnNotEqual_FloatFloat, &NotEqual_FloatFloat_Parms, NULL );
 
 	return NotEqual_FloatFloat_Parms.ReturnValue;
 };
@@ -7016,25 +5678,16 @@ bool UObject::NotEqual_FloatFloat ( float A, float B )
 
 bool UObject::ComplementEqual_FloatFloat ( float A, float B )
 {
-	static UFunction* pFnComplementEqual_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnComplementEqual_FloatFloatRef { L"Function Core.Object.ComplementEqual_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnComplementEqual_FloatFloat )
-		pFnComplementEqual_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.ComplementEqual_FloatFloat" );
+	UFunction* const pFnComplementEqual_FloatFloat = pFnComplementEqual_FloatFloatRef.Get ( );
 
 	UObject_execComplementEqual_FloatFloat_Parms ComplementEqual_FloatFloat_Parms;
 	ComplementEqual_FloatFloat_Parms.A = A;
 	ComplementEqual_FloatFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnComplementEqual_FloatFloat->iNative;
-	pFnComplementEqual_FloatFloat->iNative = 0;
-
-	pFnComplementEqual_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnComplementEqual_FloatFloat, &ComplementEqual_FloatFloat_Parms, NULL );
-
-	pFnComplementEqual_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnComplementEqual_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnComplementEqual_FloatFloat, &ComplementEqual_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnComplementEqual_FloatFloat, &ComplementEqual_FloatFloat_Parms, NULL );
 
 	return ComplementEqual_FloatFloat_Parms.ReturnValue;
 };
@@ -7048,25 +5701,16 @@ bool UObject::ComplementEqual_FloatFloat ( float A, float B )
 
 bool UObject::EqualEqual_FloatFloat ( float A, float B )
 {
-	static UFunction* pFnEqualEqual_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEqualEqual_FloatFloatRef { L"Function Core.Object.EqualEqual_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEqualEqual_FloatFloat )
-		pFnEqualEqual_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.EqualEqual_FloatFloat" );
+	UFunction* const pFnEqualEqual_FloatFloat = pFnEqualEqual_FloatFloatRef.Get ( );
 
 	UObject_execEqualEqual_FloatFloat_Parms EqualEqual_FloatFloat_Parms;
 	EqualEqual_FloatFloat_Parms.A = A;
 	EqualEqual_FloatFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnEqualEqual_FloatFloat->iNative;
-	pFnEqualEqual_FloatFloat->iNative = 0;
-
-	pFnEqualEqual_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEqualEqual_FloatFloat, &EqualEqual_FloatFloat_Parms, NULL );
-
-	pFnEqualEqual_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnEqualEqual_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnEqualEqual_FloatFloat, &EqualEqual_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnEqualEqual_FloatFloat, &EqualEqual_FloatFloat_Parms, NULL );
 
 	return EqualEqual_FloatFloat_Parms.ReturnValue;
 };
@@ -7080,25 +5724,16 @@ bool UObject::EqualEqual_FloatFloat ( float A, float B )
 
 bool UObject::GreaterEqual_FloatFloat ( float A, float B )
 {
-	static UFunction* pFnGreaterEqual_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGreaterEqual_FloatFloatRef { L"Function Core.Object.GreaterEqual_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGreaterEqual_FloatFloat )
-		pFnGreaterEqual_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.GreaterEqual_FloatFloat" );
+	UFunction* const pFnGreaterEqual_FloatFloat = pFnGreaterEqual_FloatFloatRef.Get ( );
 
 	UObject_execGreaterEqual_FloatFloat_Parms GreaterEqual_FloatFloat_Parms;
 	GreaterEqual_FloatFloat_Parms.A = A;
 	GreaterEqual_FloatFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnGreaterEqual_FloatFloat->iNative;
-	pFnGreaterEqual_FloatFloat->iNative = 0;
-
-	pFnGreaterEqual_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGreaterEqual_FloatFloat, &GreaterEqual_FloatFloat_Parms, NULL );
-
-	pFnGreaterEqual_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnGreaterEqual_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnGreaterEqual_FloatFloat, &GreaterEqual_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnGreaterEqual_FloatFloat, &GreaterEqual_FloatFloat_Parms, NULL );
 
 	return GreaterEqual_FloatFloat_Parms.ReturnValue;
 };
@@ -7112,25 +5747,16 @@ bool UObject::GreaterEqual_FloatFloat ( float A, float B )
 
 bool UObject::LessEqual_FloatFloat ( float A, float B )
 {
-	static UFunction* pFnLessEqual_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLessEqual_FloatFloatRef { L"Function Core.Object.LessEqual_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLessEqual_FloatFloat )
-		pFnLessEqual_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.LessEqual_FloatFloat" );
+	UFunction* const pFnLessEqual_FloatFloat = pFnLessEqual_FloatFloatRef.Get ( );
 
 	UObject_execLessEqual_FloatFloat_Parms LessEqual_FloatFloat_Parms;
 	LessEqual_FloatFloat_Parms.A = A;
 	LessEqual_FloatFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnLessEqual_FloatFloat->iNative;
-	pFnLessEqual_FloatFloat->iNative = 0;
-
-	pFnLessEqual_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLessEqual_FloatFloat, &LessEqual_FloatFloat_Parms, NULL );
-
-	pFnLessEqual_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnLessEqual_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnLessEqual_FloatFloat, &LessEqual_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnLessEqual_FloatFloat, &LessEqual_FloatFloat_Parms, NULL );
 
 	return LessEqual_FloatFloat_Parms.ReturnValue;
 };
@@ -7144,25 +5770,16 @@ bool UObject::LessEqual_FloatFloat ( float A, float B )
 
 bool UObject::Greater_FloatFloat ( float A, float B )
 {
-	static UFunction* pFnGreater_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGreater_FloatFloatRef { L"Function Core.Object.Greater_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGreater_FloatFloat )
-		pFnGreater_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.Greater_FloatFloat" );
+	UFunction* const pFnGreater_FloatFloat = pFnGreater_FloatFloatRef.Get ( );
 
 	UObject_execGreater_FloatFloat_Parms Greater_FloatFloat_Parms;
 	Greater_FloatFloat_Parms.A = A;
 	Greater_FloatFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnGreater_FloatFloat->iNative;
-	pFnGreater_FloatFloat->iNative = 0;
-
-	pFnGreater_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGreater_FloatFloat, &Greater_FloatFloat_Parms, NULL );
-
-	pFnGreater_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnGreater_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnGreater_FloatFloat, &Greater_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnGreater_FloatFloat, &Greater_FloatFloat_Parms, NULL );
 
 	return Greater_FloatFloat_Parms.ReturnValue;
 };
@@ -7176,25 +5793,16 @@ bool UObject::Greater_FloatFloat ( float A, float B )
 
 bool UObject::Less_FloatFloat ( float A, float B )
 {
-	static UFunction* pFnLess_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLess_FloatFloatRef { L"Function Core.Object.Less_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLess_FloatFloat )
-		pFnLess_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.Less_FloatFloat" );
+	UFunction* const pFnLess_FloatFloat = pFnLess_FloatFloatRef.Get ( );
 
 	UObject_execLess_FloatFloat_Parms Less_FloatFloat_Parms;
 	Less_FloatFloat_Parms.A = A;
 	Less_FloatFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnLess_FloatFloat->iNative;
-	pFnLess_FloatFloat->iNative = 0;
-
-	pFnLess_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLess_FloatFloat, &Less_FloatFloat_Parms, NULL );
-
-	pFnLess_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnLess_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnLess_FloatFloat, &Less_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnLess_FloatFloat, &Less_FloatFloat_Parms, NULL );
 
 	return Less_FloatFloat_Parms.ReturnValue;
 };
@@ -7208,25 +5816,16 @@ bool UObject::Less_FloatFloat ( float A, float B )
 
 float UObject::Subtract_FloatFloat ( float A, float B )
 {
-	static UFunction* pFnSubtract_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtract_FloatFloatRef { L"Function Core.Object.Subtract_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtract_FloatFloat )
-		pFnSubtract_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.Subtract_FloatFloat" );
+	UFunction* const pFnSubtract_FloatFloat = pFnSubtract_FloatFloatRef.Get ( );
 
 	UObject_execSubtract_FloatFloat_Parms Subtract_FloatFloat_Parms;
 	Subtract_FloatFloat_Parms.A = A;
 	Subtract_FloatFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnSubtract_FloatFloat->iNative;
-	pFnSubtract_FloatFloat->iNative = 0;
-
-	pFnSubtract_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtract_FloatFloat, &Subtract_FloatFloat_Parms, NULL );
-
-	pFnSubtract_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnSubtract_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtract_FloatFloat, &Subtract_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnSubtract_FloatFloat, &Subtract_FloatFloat_Parms, NULL );
 
 	return Subtract_FloatFloat_Parms.ReturnValue;
 };
@@ -7240,25 +5839,16 @@ float UObject::Subtract_FloatFloat ( float A, float B )
 
 float UObject::Add_FloatFloat ( float A, float B )
 {
-	static UFunction* pFnAdd_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAdd_FloatFloatRef { L"Function Core.Object.Add_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAdd_FloatFloat )
-		pFnAdd_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.Add_FloatFloat" );
+	UFunction* const pFnAdd_FloatFloat = pFnAdd_FloatFloatRef.Get ( );
 
 	UObject_execAdd_FloatFloat_Parms Add_FloatFloat_Parms;
 	Add_FloatFloat_Parms.A = A;
 	Add_FloatFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnAdd_FloatFloat->iNative;
-	pFnAdd_FloatFloat->iNative = 0;
-
-	pFnAdd_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAdd_FloatFloat, &Add_FloatFloat_Parms, NULL );
-
-	pFnAdd_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnAdd_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAdd_FloatFloat, &Add_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnAdd_FloatFloat, &Add_FloatFloat_Parms, NULL );
 
 	return Add_FloatFloat_Parms.ReturnValue;
 };
@@ -7272,25 +5862,16 @@ float UObject::Add_FloatFloat ( float A, float B )
 
 float UObject::Percent_FloatFloat ( float A, float B )
 {
-	static UFunction* pFnPercent_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPercent_FloatFloatRef { L"Function Core.Object.Percent_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPercent_FloatFloat )
-		pFnPercent_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.Percent_FloatFloat" );
+	UFunction* const pFnPercent_FloatFloat = pFnPercent_FloatFloatRef.Get ( );
 
 	UObject_execPercent_FloatFloat_Parms Percent_FloatFloat_Parms;
 	Percent_FloatFloat_Parms.A = A;
 	Percent_FloatFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnPercent_FloatFloat->iNative;
-	pFnPercent_FloatFloat->iNative = 0;
-
-	pFnPercent_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnPercent_FloatFloat, &Percent_FloatFloat_Parms, NULL );
-
-	pFnPercent_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnPercent_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnPercent_FloatFloat, &Percent_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnPercent_FloatFloat, &Percent_FloatFloat_Parms, NULL );
 
 	return Percent_FloatFloat_Parms.ReturnValue;
 };
@@ -7304,25 +5885,16 @@ float UObject::Percent_FloatFloat ( float A, float B )
 
 float UObject::Divide_FloatFloat ( float A, float B )
 {
-	static UFunction* pFnDivide_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDivide_FloatFloatRef { L"Function Core.Object.Divide_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDivide_FloatFloat )
-		pFnDivide_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.Divide_FloatFloat" );
+	UFunction* const pFnDivide_FloatFloat = pFnDivide_FloatFloatRef.Get ( );
 
 	UObject_execDivide_FloatFloat_Parms Divide_FloatFloat_Parms;
 	Divide_FloatFloat_Parms.A = A;
 	Divide_FloatFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnDivide_FloatFloat->iNative;
-	pFnDivide_FloatFloat->iNative = 0;
-
-	pFnDivide_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDivide_FloatFloat, &Divide_FloatFloat_Parms, NULL );
-
-	pFnDivide_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnDivide_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnDivide_FloatFloat, &Divide_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnDivide_FloatFloat, &Divide_FloatFloat_Parms, NULL );
 
 	return Divide_FloatFloat_Parms.ReturnValue;
 };
@@ -7336,25 +5908,16 @@ float UObject::Divide_FloatFloat ( float A, float B )
 
 float UObject::Multiply_FloatFloat ( float A, float B )
 {
-	static UFunction* pFnMultiply_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiply_FloatFloatRef { L"Function Core.Object.Multiply_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiply_FloatFloat )
-		pFnMultiply_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.Multiply_FloatFloat" );
+	UFunction* const pFnMultiply_FloatFloat = pFnMultiply_FloatFloatRef.Get ( );
 
 	UObject_execMultiply_FloatFloat_Parms Multiply_FloatFloat_Parms;
 	Multiply_FloatFloat_Parms.A = A;
 	Multiply_FloatFloat_Parms.B = B;
 
-	unsigned short NativeIndex = pFnMultiply_FloatFloat->iNative;
-	pFnMultiply_FloatFloat->iNative = 0;
-
-	pFnMultiply_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiply_FloatFloat, &Multiply_FloatFloat_Parms, NULL );
-
-	pFnMultiply_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnMultiply_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMultiply_FloatFloat, &Multiply_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnMultiply_FloatFloat, &Multiply_FloatFloat_Parms, NULL );
 
 	return Multiply_FloatFloat_Parms.ReturnValue;
 };
@@ -7368,25 +5931,16 @@ float UObject::Multiply_FloatFloat ( float A, float B )
 
 float UObject::MultiplyMultiply_FloatFloat ( float Base, float Exp )
 {
-	static UFunction* pFnMultiplyMultiply_FloatFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiplyMultiply_FloatFloatRef { L"Function Core.Object.MultiplyMultiply_FloatFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiplyMultiply_FloatFloat )
-		pFnMultiplyMultiply_FloatFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.MultiplyMultiply_FloatFloat" );
+	UFunction* const pFnMultiplyMultiply_FloatFloat = pFnMultiplyMultiply_FloatFloatRef.Get ( );
 
 	UObject_execMultiplyMultiply_FloatFloat_Parms MultiplyMultiply_FloatFloat_Parms;
 	MultiplyMultiply_FloatFloat_Parms.Base = Base;
 	MultiplyMultiply_FloatFloat_Parms.Exp = Exp;
 
-	unsigned short NativeIndex = pFnMultiplyMultiply_FloatFloat->iNative;
-	pFnMultiplyMultiply_FloatFloat->iNative = 0;
-
-	pFnMultiplyMultiply_FloatFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiplyMultiply_FloatFloat, &MultiplyMultiply_FloatFloat_Parms, NULL );
-
-	pFnMultiplyMultiply_FloatFloat->FunctionFlags |= 0x400;
-
-	pFnMultiplyMultiply_FloatFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMultiplyMultiply_FloatFloat, &MultiplyMultiply_FloatFloat_Parms ) )
+		this->ProcessEvent ( pFnMultiplyMultiply_FloatFloat, &MultiplyMultiply_FloatFloat_Parms, NULL );
 
 	return MultiplyMultiply_FloatFloat_Parms.ReturnValue;
 };
@@ -7399,24 +5953,15 @@ float UObject::MultiplyMultiply_FloatFloat ( float Base, float Exp )
 
 float UObject::Subtract_PreFloat ( float A )
 {
-	static UFunction* pFnSubtract_PreFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtract_PreFloatRef { L"Function Core.Object.Subtract_PreFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtract_PreFloat )
-		pFnSubtract_PreFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.Subtract_PreFloat" );
+	UFunction* const pFnSubtract_PreFloat = pFnSubtract_PreFloatRef.Get ( );
 
 	UObject_execSubtract_PreFloat_Parms Subtract_PreFloat_Parms;
 	Subtract_PreFloat_Parms.A = A;
 
-	unsigned short NativeIndex = pFnSubtract_PreFloat->iNative;
-	pFnSubtract_PreFloat->iNative = 0;
-
-	pFnSubtract_PreFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtract_PreFloat, &Subtract_PreFloat_Parms, NULL );
-
-	pFnSubtract_PreFloat->FunctionFlags |= 0x400;
-
-	pFnSubtract_PreFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtract_PreFloat, &Subtract_PreFloat_Parms ) )
+		this->ProcessEvent ( pFnSubtract_PreFloat, &Subtract_PreFloat_Parms, NULL );
 
 	return Subtract_PreFloat_Parms.ReturnValue;
 };
@@ -7429,19 +5974,15 @@ float UObject::Subtract_PreFloat ( float A )
 
 FString UObject::ToHex ( int A )
 {
-	static UFunction* pFnToHex = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnToHexRef { L"Function Core.Object.ToHex", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnToHex )
-		pFnToHex = UObject::FindObject< UFunction > ( L"Function Core.Object.ToHex" );
+	UFunction* const pFnToHex = pFnToHexRef.Get ( );
 
 	UObject_execToHex_Parms ToHex_Parms;
 	ToHex_Parms.A = A;
 
-	pFnToHex->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnToHex, &ToHex_Parms, NULL );
-
-	pFnToHex->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnToHex, &ToHex_Parms ) )
+		this->ProcessEvent ( pFnToHex, &ToHex_Parms, NULL );
 
 	return ToHex_Parms.ReturnValue;
 };
@@ -7456,26 +5997,17 @@ FString UObject::ToHex ( int A )
 
 int UObject::Clamp ( int V, int A, int B )
 {
-	static UFunction* pFnClamp = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClampRef { L"Function Core.Object.Clamp", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClamp )
-		pFnClamp = UObject::FindObject< UFunction > ( L"Function Core.Object.Clamp" );
+	UFunction* const pFnClamp = pFnClampRef.Get ( );
 
 	UObject_execClamp_Parms Clamp_Parms;
 	Clamp_Parms.V = V;
 	Clamp_Parms.A = A;
 	Clamp_Parms.B = B;
 
-	unsigned short NativeIndex = pFnClamp->iNative;
-	pFnClamp->iNative = 0;
-
-	pFnClamp->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnClamp, &Clamp_Parms, NULL );
-
-	pFnClamp->FunctionFlags |= 0x400;
-
-	pFnClamp->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnClamp, &Clamp_Parms ) )
+		this->ProcessEvent ( pFnClamp, &Clamp_Parms, NULL );
 
 	return Clamp_Parms.ReturnValue;
 };
@@ -7489,25 +6021,16 @@ int UObject::Clamp ( int V, int A, int B )
 
 int UObject::Max ( int A, int B )
 {
-	static UFunction* pFnMax = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMaxRef { L"Function Core.Object.Max", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMax )
-		pFnMax = UObject::FindObject< UFunction > ( L"Function Core.Object.Max" );
+	UFunction* const pFnMax = pFnMaxRef.Get ( );
 
 	UObject_execMax_Parms Max_Parms;
 	Max_Parms.A = A;
 	Max_Parms.B = B;
 
-	unsigned short NativeIndex = pFnMax->iNative;
-	pFnMax->iNative = 0;
-
-	pFnMax->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMax, &Max_Parms, NULL );
-
-	pFnMax->FunctionFlags |= 0x400;
-
-	pFnMax->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMax, &Max_Parms ) )
+		this->ProcessEvent ( pFnMax, &Max_Parms, NULL );
 
 	return Max_Parms.ReturnValue;
 };
@@ -7521,25 +6044,16 @@ int UObject::Max ( int A, int B )
 
 int UObject::Min ( int A, int B )
 {
-	static UFunction* pFnMin = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMinRef { L"Function Core.Object.Min", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMin )
-		pFnMin = UObject::FindObject< UFunction > ( L"Function Core.Object.Min" );
+	UFunction* const pFnMin = pFnMinRef.Get ( );
 
 	UObject_execMin_Parms Min_Parms;
 	Min_Parms.A = A;
 	Min_Parms.B = B;
 
-	unsigned short NativeIndex = pFnMin->iNative;
-	pFnMin->iNative = 0;
-
-	pFnMin->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMin, &Min_Parms, NULL );
-
-	pFnMin->FunctionFlags |= 0x400;
-
-	pFnMin->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMin, &Min_Parms ) )
+		this->ProcessEvent ( pFnMin, &Min_Parms, NULL );
 
 	return Min_Parms.ReturnValue;
 };
@@ -7552,24 +6066,15 @@ int UObject::Min ( int A, int B )
 
 int UObject::Rand ( int Max )
 {
-	static UFunction* pFnRand = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRandRef { L"Function Core.Object.Rand", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRand )
-		pFnRand = UObject::FindObject< UFunction > ( L"Function Core.Object.Rand" );
+	UFunction* const pFnRand = pFnRandRef.Get ( );
 
 	UObject_execRand_Parms Rand_Parms;
 	Rand_Parms.Max = Max;
 
-	unsigned short NativeIndex = pFnRand->iNative;
-	pFnRand->iNative = 0;
-
-	pFnRand->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRand, &Rand_Parms, NULL );
-
-	pFnRand->FunctionFlags |= 0x400;
-
-	pFnRand->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnRand, &Rand_Parms ) )
+		this->ProcessEvent ( pFnRand, &Rand_Parms, NULL );
 
 	return Rand_Parms.ReturnValue;
 };
@@ -7582,26 +6087,17 @@ int UObject::Rand ( int Max )
 
 int UObject::SubtractSubtract_Int ( int* A )
 {
-	static UFunction* pFnSubtractSubtract_Int = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtractSubtract_IntRef { L"Function Core.Object.SubtractSubtract_Int", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtractSubtract_Int )
-		pFnSubtractSubtract_Int = UObject::FindObject< UFunction > ( L"Function Core.Object.SubtractSubtract_Int" );
+	UFunction* const pFnSubtractSubtract_Int = pFnSubtractSubtract_IntRef.Get ( );
 
 	UObject_execSubtractSubtract_Int_Parms SubtractSubtract_Int_Parms;
 
 	if ( A )
 		SubtractSubtract_Int_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnSubtractSubtract_Int->iNative;
-	pFnSubtractSubtract_Int->iNative = 0;
-
-	pFnSubtractSubtract_Int->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtractSubtract_Int, &SubtractSubtract_Int_Parms, NULL );
-
-	pFnSubtractSubtract_Int->FunctionFlags |= 0x400;
-
-	pFnSubtractSubtract_Int->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtractSubtract_Int, &SubtractSubtract_Int_Parms ) )
+		this->ProcessEvent ( pFnSubtractSubtract_Int, &SubtractSubtract_Int_Parms, NULL );
 
 	if ( A )
 		*A = SubtractSubtract_Int_Parms.A;
@@ -7617,26 +6113,17 @@ int UObject::SubtractSubtract_Int ( int* A )
 
 int UObject::AddAdd_Int ( int* A )
 {
-	static UFunction* pFnAddAdd_Int = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddAdd_IntRef { L"Function Core.Object.AddAdd_Int", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddAdd_Int )
-		pFnAddAdd_Int = UObject::FindObject< UFunction > ( L"Function Core.Object.AddAdd_Int" );
+	UFunction* const pFnAddAdd_Int = pFnAddAdd_IntRef.Get ( );
 
 	UObject_execAddAdd_Int_Parms AddAdd_Int_Parms;
 
 	if ( A )
 		AddAdd_Int_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnAddAdd_Int->iNative;
-	pFnAddAdd_Int->iNative = 0;
-
-	pFnAddAdd_Int->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddAdd_Int, &AddAdd_Int_Parms, NULL );
-
-	pFnAddAdd_Int->FunctionFlags |= 0x400;
-
-	pFnAddAdd_Int->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAddAdd_Int, &AddAdd_Int_Parms ) )
+		this->ProcessEvent ( pFnAddAdd_Int, &AddAdd_Int_Parms, NULL );
 
 	if ( A )
 		*A = AddAdd_Int_Parms.A;
@@ -7652,26 +6139,17 @@ int UObject::AddAdd_Int ( int* A )
 
 int UObject::SubtractSubtract_PreInt ( int* A )
 {
-	static UFunction* pFnSubtractSubtract_PreInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtractSubtract_PreIntRef { L"Function Core.Object.SubtractSubtract_PreInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtractSubtract_PreInt )
-		pFnSubtractSubtract_PreInt = UObject::FindObject< UFunction > ( L"Function Core.Object.SubtractSubtract_PreInt" );
+	UFunction* const pFnSubtractSubtract_PreInt = pFnSubtractSubtract_PreIntRef.Get ( );
 
 	UObject_execSubtractSubtract_PreInt_Parms SubtractSubtract_PreInt_Parms;
 
 	if ( A )
 		SubtractSubtract_PreInt_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnSubtractSubtract_PreInt->iNative;
-	pFnSubtractSubtract_PreInt->iNative = 0;
-
-	pFnSubtractSubtract_PreInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtractSubtract_PreInt, &SubtractSubtract_PreInt_Parms, NULL );
-
-	pFnSubtractSubtract_PreInt->FunctionFlags |= 0x400;
-
-	pFnSubtractSubtract_PreInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtractSubtract_PreInt, &SubtractSubtract_PreInt_Parms ) )
+		this->ProcessEvent ( pFnSubtractSubtract_PreInt, &SubtractSubtract_PreInt_Parms, NULL );
 
 	if ( A )
 		*A = SubtractSubtract_PreInt_Parms.A;
@@ -7687,26 +6165,17 @@ int UObject::SubtractSubtract_PreInt ( int* A )
 
 int UObject::AddAdd_PreInt ( int* A )
 {
-	static UFunction* pFnAddAdd_PreInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddAdd_PreIntRef { L"Function Core.Object.AddAdd_PreInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddAdd_PreInt )
-		pFnAddAdd_PreInt = UObject::FindObject< UFunction > ( L"Function Core.Object.AddAdd_PreInt" );
+	UFunction* const pFnAddAdd_PreInt = pFnAddAdd_PreIntRef.Get ( );
 
 	UObject_execAddAdd_PreInt_Parms AddAdd_PreInt_Parms;
 
 	if ( A )
 		AddAdd_PreInt_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnAddAdd_PreInt->iNative;
-	pFnAddAdd_PreInt->iNative = 0;
-
-	pFnAddAdd_PreInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddAdd_PreInt, &AddAdd_PreInt_Parms, NULL );
-
-	pFnAddAdd_PreInt->FunctionFlags |= 0x400;
-
-	pFnAddAdd_PreInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAddAdd_PreInt, &AddAdd_PreInt_Parms ) )
+		this->ProcessEvent ( pFnAddAdd_PreInt, &AddAdd_PreInt_Parms, NULL );
 
 	if ( A )
 		*A = AddAdd_PreInt_Parms.A;
@@ -7723,10 +6192,9 @@ int UObject::AddAdd_PreInt ( int* A )
 
 int UObject::SubtractEqual_IntInt ( int B, int* A )
 {
-	static UFunction* pFnSubtractEqual_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtractEqual_IntIntRef { L"Function Core.Object.SubtractEqual_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtractEqual_IntInt )
-		pFnSubtractEqual_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.SubtractEqual_IntInt" );
+	UFunction* const pFnSubtractEqual_IntInt = pFnSubtractEqual_IntIntRef.Get ( );
 
 	UObject_execSubtractEqual_IntInt_Parms SubtractEqual_IntInt_Parms;
 	SubtractEqual_IntInt_Parms.B = B;
@@ -7734,16 +6202,8 @@ int UObject::SubtractEqual_IntInt ( int B, int* A )
 	if ( A )
 		SubtractEqual_IntInt_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnSubtractEqual_IntInt->iNative;
-	pFnSubtractEqual_IntInt->iNative = 0;
-
-	pFnSubtractEqual_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtractEqual_IntInt, &SubtractEqual_IntInt_Parms, NULL );
-
-	pFnSubtractEqual_IntInt->FunctionFlags |= 0x400;
-
-	pFnSubtractEqual_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtractEqual_IntInt, &SubtractEqual_IntInt_Parms ) )
+		this->ProcessEvent ( pFnSubtractEqual_IntInt, &SubtractEqual_IntInt_Parms, NULL );
 
 	if ( A )
 		*A = SubtractEqual_IntInt_Parms.A;
@@ -7760,10 +6220,9 @@ int UObject::SubtractEqual_IntInt ( int B, int* A )
 
 int UObject::AddEqual_IntInt ( int B, int* A )
 {
-	static UFunction* pFnAddEqual_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddEqual_IntIntRef { L"Function Core.Object.AddEqual_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddEqual_IntInt )
-		pFnAddEqual_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.AddEqual_IntInt" );
+	UFunction* const pFnAddEqual_IntInt = pFnAddEqual_IntIntRef.Get ( );
 
 	UObject_execAddEqual_IntInt_Parms AddEqual_IntInt_Parms;
 	AddEqual_IntInt_Parms.B = B;
@@ -7771,16 +6230,8 @@ int UObject::AddEqual_IntInt ( int B, int* A )
 	if ( A )
 		AddEqual_IntInt_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnAddEqual_IntInt->iNative;
-	pFnAddEqual_IntInt->iNative = 0;
-
-	pFnAddEqual_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddEqual_IntInt, &AddEqual_IntInt_Parms, NULL );
-
-	pFnAddEqual_IntInt->FunctionFlags |= 0x400;
-
-	pFnAddEqual_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAddEqual_IntInt, &AddEqual_IntInt_Parms ) )
+		this->ProcessEvent ( pFnAddEqual_IntInt, &AddEqual_IntInt_Parms, NULL );
 
 	if ( A )
 		*A = AddEqual_IntInt_Parms.A;
@@ -7797,10 +6248,9 @@ int UObject::AddEqual_IntInt ( int B, int* A )
 
 int UObject::DivideEqual_IntFloat ( float B, int* A )
 {
-	static UFunction* pFnDivideEqual_IntFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDivideEqual_IntFloatRef { L"Function Core.Object.DivideEqual_IntFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDivideEqual_IntFloat )
-		pFnDivideEqual_IntFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.DivideEqual_IntFloat" );
+	UFunction* const pFnDivideEqual_IntFloat = pFnDivideEqual_IntFloatRef.Get ( );
 
 	UObject_execDivideEqual_IntFloat_Parms DivideEqual_IntFloat_Parms;
 	DivideEqual_IntFloat_Parms.B = B;
@@ -7808,16 +6258,8 @@ int UObject::DivideEqual_IntFloat ( float B, int* A )
 	if ( A )
 		DivideEqual_IntFloat_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnDivideEqual_IntFloat->iNative;
-	pFnDivideEqual_IntFloat->iNative = 0;
-
-	pFnDivideEqual_IntFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDivideEqual_IntFloat, &DivideEqual_IntFloat_Parms, NULL );
-
-	pFnDivideEqual_IntFloat->FunctionFlags |= 0x400;
-
-	pFnDivideEqual_IntFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnDivideEqual_IntFloat, &DivideEqual_IntFloat_Parms ) )
+		this->ProcessEvent ( pFnDivideEqual_IntFloat, &DivideEqual_IntFloat_Parms, NULL );
 
 	if ( A )
 		*A = DivideEqual_IntFloat_Parms.A;
@@ -7834,10 +6276,9 @@ int UObject::DivideEqual_IntFloat ( float B, int* A )
 
 int UObject::MultiplyEqual_IntFloat ( float B, int* A )
 {
-	static UFunction* pFnMultiplyEqual_IntFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiplyEqual_IntFloatRef { L"Function Core.Object.MultiplyEqual_IntFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiplyEqual_IntFloat )
-		pFnMultiplyEqual_IntFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.MultiplyEqual_IntFloat" );
+	UFunction* const pFnMultiplyEqual_IntFloat = pFnMultiplyEqual_IntFloatRef.Get ( );
 
 	UObject_execMultiplyEqual_IntFloat_Parms MultiplyEqual_IntFloat_Parms;
 	MultiplyEqual_IntFloat_Parms.B = B;
@@ -7845,16 +6286,8 @@ int UObject::MultiplyEqual_IntFloat ( float B, int* A )
 	if ( A )
 		MultiplyEqual_IntFloat_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnMultiplyEqual_IntFloat->iNative;
-	pFnMultiplyEqual_IntFloat->iNative = 0;
-
-	pFnMultiplyEqual_IntFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiplyEqual_IntFloat, &MultiplyEqual_IntFloat_Parms, NULL );
-
-	pFnMultiplyEqual_IntFloat->FunctionFlags |= 0x400;
-
-	pFnMultiplyEqual_IntFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMultiplyEqual_IntFloat, &MultiplyEqual_IntFloat_Parms ) )
+		this->ProcessEvent ( pFnMultiplyEqual_IntFloat, &MultiplyEqual_IntFloat_Parms, NULL );
 
 	if ( A )
 		*A = MultiplyEqual_IntFloat_Parms.A;
@@ -7871,25 +6304,16 @@ int UObject::MultiplyEqual_IntFloat ( float B, int* A )
 
 int UObject::Or_IntInt ( int A, int B )
 {
-	static UFunction* pFnOr_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOr_IntIntRef { L"Function Core.Object.Or_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOr_IntInt )
-		pFnOr_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.Or_IntInt" );
+	UFunction* const pFnOr_IntInt = pFnOr_IntIntRef.Get ( );
 
 	UObject_execOr_IntInt_Parms Or_IntInt_Parms;
 	Or_IntInt_Parms.A = A;
 	Or_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnOr_IntInt->iNative;
-	pFnOr_IntInt->iNative = 0;
-
-	pFnOr_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOr_IntInt, &Or_IntInt_Parms, NULL );
-
-	pFnOr_IntInt->FunctionFlags |= 0x400;
-
-	pFnOr_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnOr_IntInt, &Or_IntInt_Parms ) )
+		this->ProcessEvent ( pFnOr_IntInt, &Or_IntInt_Parms, NULL );
 
 	return Or_IntInt_Parms.ReturnValue;
 };
@@ -7903,25 +6327,16 @@ int UObject::Or_IntInt ( int A, int B )
 
 int UObject::Xor_IntInt ( int A, int B )
 {
-	static UFunction* pFnXor_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnXor_IntIntRef { L"Function Core.Object.Xor_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnXor_IntInt )
-		pFnXor_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.Xor_IntInt" );
+	UFunction* const pFnXor_IntInt = pFnXor_IntIntRef.Get ( );
 
 	UObject_execXor_IntInt_Parms Xor_IntInt_Parms;
 	Xor_IntInt_Parms.A = A;
 	Xor_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnXor_IntInt->iNative;
-	pFnXor_IntInt->iNative = 0;
-
-	pFnXor_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnXor_IntInt, &Xor_IntInt_Parms, NULL );
-
-	pFnXor_IntInt->FunctionFlags |= 0x400;
-
-	pFnXor_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnXor_IntInt, &Xor_IntInt_Parms ) )
+		this->ProcessEvent ( pFnXor_IntInt, &Xor_IntInt_Parms, NULL );
 
 	return Xor_IntInt_Parms.ReturnValue;
 };
@@ -7935,25 +6350,16 @@ int UObject::Xor_IntInt ( int A, int B )
 
 int UObject::And_IntInt ( int A, int B )
 {
-	static UFunction* pFnAnd_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAnd_IntIntRef { L"Function Core.Object.And_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAnd_IntInt )
-		pFnAnd_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.And_IntInt" );
+	UFunction* const pFnAnd_IntInt = pFnAnd_IntIntRef.Get ( );
 
 	UObject_execAnd_IntInt_Parms And_IntInt_Parms;
 	And_IntInt_Parms.A = A;
 	And_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnAnd_IntInt->iNative;
-	pFnAnd_IntInt->iNative = 0;
-
-	pFnAnd_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAnd_IntInt, &And_IntInt_Parms, NULL );
-
-	pFnAnd_IntInt->FunctionFlags |= 0x400;
-
-	pFnAnd_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAnd_IntInt, &And_IntInt_Parms ) )
+		this->ProcessEvent ( pFnAnd_IntInt, &And_IntInt_Parms, NULL );
 
 	return And_IntInt_Parms.ReturnValue;
 };
@@ -7967,25 +6373,16 @@ int UObject::And_IntInt ( int A, int B )
 
 bool UObject::NotEqual_IntInt ( int A, int B )
 {
-	static UFunction* pFnNotEqual_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotEqual_IntIntRef { L"Function Core.Object.NotEqual_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotEqual_IntInt )
-		pFnNotEqual_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.NotEqual_IntInt" );
+	UFunction* const pFnNotEqual_IntInt = pFnNotEqual_IntIntRef.Get ( );
 
 	UObject_execNotEqual_IntInt_Parms NotEqual_IntInt_Parms;
 	NotEqual_IntInt_Parms.A = A;
 	NotEqual_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnNotEqual_IntInt->iNative;
-	pFnNotEqual_IntInt->iNative = 0;
-
-	pFnNotEqual_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotEqual_IntInt, &NotEqual_IntInt_Parms, NULL );
-
-	pFnNotEqual_IntInt->FunctionFlags |= 0x400;
-
-	pFnNotEqual_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnNotEqual_IntInt, &NotEqual_IntInt_Parms ) )
+		this->ProcessEvent ( pFnNotEqual_IntInt, &NotEqual_IntInt_Parms, NULL );
 
 	return NotEqual_IntInt_Parms.ReturnValue;
 };
@@ -7999,25 +6396,16 @@ bool UObject::NotEqual_IntInt ( int A, int B )
 
 bool UObject::EqualEqual_IntInt ( int A, int B )
 {
-	static UFunction* pFnEqualEqual_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEqualEqual_IntIntRef { L"Function Core.Object.EqualEqual_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEqualEqual_IntInt )
-		pFnEqualEqual_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.EqualEqual_IntInt" );
+	UFunction* const pFnEqualEqual_IntInt = pFnEqualEqual_IntIntRef.Get ( );
 
 	UObject_execEqualEqual_IntInt_Parms EqualEqual_IntInt_Parms;
 	EqualEqual_IntInt_Parms.A = A;
 	EqualEqual_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnEqualEqual_IntInt->iNative;
-	pFnEqualEqual_IntInt->iNative = 0;
-
-	pFnEqualEqual_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEqualEqual_IntInt, &EqualEqual_IntInt_Parms, NULL );
-
-	pFnEqualEqual_IntInt->FunctionFlags |= 0x400;
-
-	pFnEqualEqual_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnEqualEqual_IntInt, &EqualEqual_IntInt_Parms ) )
+		this->ProcessEvent ( pFnEqualEqual_IntInt, &EqualEqual_IntInt_Parms, NULL );
 
 	return EqualEqual_IntInt_Parms.ReturnValue;
 };
@@ -8031,25 +6419,16 @@ bool UObject::EqualEqual_IntInt ( int A, int B )
 
 bool UObject::GreaterEqual_IntInt ( int A, int B )
 {
-	static UFunction* pFnGreaterEqual_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGreaterEqual_IntIntRef { L"Function Core.Object.GreaterEqual_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGreaterEqual_IntInt )
-		pFnGreaterEqual_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.GreaterEqual_IntInt" );
+	UFunction* const pFnGreaterEqual_IntInt = pFnGreaterEqual_IntIntRef.Get ( );
 
 	UObject_execGreaterEqual_IntInt_Parms GreaterEqual_IntInt_Parms;
 	GreaterEqual_IntInt_Parms.A = A;
 	GreaterEqual_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnGreaterEqual_IntInt->iNative;
-	pFnGreaterEqual_IntInt->iNative = 0;
-
-	pFnGreaterEqual_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGreaterEqual_IntInt, &GreaterEqual_IntInt_Parms, NULL );
-
-	pFnGreaterEqual_IntInt->FunctionFlags |= 0x400;
-
-	pFnGreaterEqual_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnGreaterEqual_IntInt, &GreaterEqual_IntInt_Parms ) )
+		this->ProcessEvent ( pFnGreaterEqual_IntInt, &GreaterEqual_IntInt_Parms, NULL );
 
 	return GreaterEqual_IntInt_Parms.ReturnValue;
 };
@@ -8063,25 +6442,16 @@ bool UObject::GreaterEqual_IntInt ( int A, int B )
 
 bool UObject::LessEqual_IntInt ( int A, int B )
 {
-	static UFunction* pFnLessEqual_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLessEqual_IntIntRef { L"Function Core.Object.LessEqual_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLessEqual_IntInt )
-		pFnLessEqual_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.LessEqual_IntInt" );
+	UFunction* const pFnLessEqual_IntInt = pFnLessEqual_IntIntRef.Get ( );
 
 	UObject_execLessEqual_IntInt_Parms LessEqual_IntInt_Parms;
 	LessEqual_IntInt_Parms.A = A;
 	LessEqual_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnLessEqual_IntInt->iNative;
-	pFnLessEqual_IntInt->iNative = 0;
-
-	pFnLessEqual_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLessEqual_IntInt, &LessEqual_IntInt_Parms, NULL );
-
-	pFnLessEqual_IntInt->FunctionFlags |= 0x400;
-
-	pFnLessEqual_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnLessEqual_IntInt, &LessEqual_IntInt_Parms ) )
+		this->ProcessEvent ( pFnLessEqual_IntInt, &LessEqual_IntInt_Parms, NULL );
 
 	return LessEqual_IntInt_Parms.ReturnValue;
 };
@@ -8095,25 +6465,16 @@ bool UObject::LessEqual_IntInt ( int A, int B )
 
 bool UObject::Greater_IntInt ( int A, int B )
 {
-	static UFunction* pFnGreater_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGreater_IntIntRef { L"Function Core.Object.Greater_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGreater_IntInt )
-		pFnGreater_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.Greater_IntInt" );
+	UFunction* const pFnGreater_IntInt = pFnGreater_IntIntRef.Get ( );
 
 	UObject_execGreater_IntInt_Parms Greater_IntInt_Parms;
 	Greater_IntInt_Parms.A = A;
 	Greater_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnGreater_IntInt->iNative;
-	pFnGreater_IntInt->iNative = 0;
-
-	pFnGreater_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGreater_IntInt, &Greater_IntInt_Parms, NULL );
-
-	pFnGreater_IntInt->FunctionFlags |= 0x400;
-
-	pFnGreater_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnGreater_IntInt, &Greater_IntInt_Parms ) )
+		this->ProcessEvent ( pFnGreater_IntInt, &Greater_IntInt_Parms, NULL );
 
 	return Greater_IntInt_Parms.ReturnValue;
 };
@@ -8127,25 +6488,16 @@ bool UObject::Greater_IntInt ( int A, int B )
 
 bool UObject::Less_IntInt ( int A, int B )
 {
-	static UFunction* pFnLess_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLess_IntIntRef { L"Function Core.Object.Less_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLess_IntInt )
-		pFnLess_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.Less_IntInt" );
+	UFunction* const pFnLess_IntInt = pFnLess_IntIntRef.Get ( );
 
 	UObject_execLess_IntInt_Parms Less_IntInt_Parms;
 	Less_IntInt_Parms.A = A;
 	Less_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnLess_IntInt->iNative;
-	pFnLess_IntInt->iNative = 0;
-
-	pFnLess_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLess_IntInt, &Less_IntInt_Parms, NULL );
-
-	pFnLess_IntInt->FunctionFlags |= 0x400;
-
-	pFnLess_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnLess_IntInt, &Less_IntInt_Parms ) )
+		this->ProcessEvent ( pFnLess_IntInt, &Less_IntInt_Parms, NULL );
 
 	return Less_IntInt_Parms.ReturnValue;
 };
@@ -8159,25 +6511,16 @@ bool UObject::Less_IntInt ( int A, int B )
 
 int UObject::GreaterGreaterGreater_IntInt ( int A, int B )
 {
-	static UFunction* pFnGreaterGreaterGreater_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGreaterGreaterGreater_IntIntRef { L"Function Core.Object.GreaterGreaterGreater_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGreaterGreaterGreater_IntInt )
-		pFnGreaterGreaterGreater_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.GreaterGreaterGreater_IntInt" );
+	UFunction* const pFnGreaterGreaterGreater_IntInt = pFnGreaterGreaterGreater_IntIntRef.Get ( );
 
 	UObject_execGreaterGreaterGreater_IntInt_Parms GreaterGreaterGreater_IntInt_Parms;
 	GreaterGreaterGreater_IntInt_Parms.A = A;
 	GreaterGreaterGreater_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnGreaterGreaterGreater_IntInt->iNative;
-	pFnGreaterGreaterGreater_IntInt->iNative = 0;
-
-	pFnGreaterGreaterGreater_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGreaterGreaterGreater_IntInt, &GreaterGreaterGreater_IntInt_Parms, NULL );
-
-	pFnGreaterGreaterGreater_IntInt->FunctionFlags |= 0x400;
-
-	pFnGreaterGreaterGreater_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnGreaterGreaterGreater_IntInt, &GreaterGreaterGreater_IntInt_Parms ) )
+		this->ProcessEvent ( pFnGreaterGreaterGreater_IntInt, &GreaterGreaterGreater_IntInt_Parms, NULL );
 
 	return GreaterGreaterGreater_IntInt_Parms.ReturnValue;
 };
@@ -8191,25 +6534,16 @@ int UObject::GreaterGreaterGreater_IntInt ( int A, int B )
 
 int UObject::GreaterGreater_IntInt ( int A, int B )
 {
-	static UFunction* pFnGreaterGreater_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGreaterGreater_IntIntRef { L"Function Core.Object.GreaterGreater_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGreaterGreater_IntInt )
-		pFnGreaterGreater_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.GreaterGreater_IntInt" );
+	UFunction* const pFnGreaterGreater_IntInt = pFnGreaterGreater_IntIntRef.Get ( );
 
 	UObject_execGreaterGreater_IntInt_Parms GreaterGreater_IntInt_Parms;
 	GreaterGreater_IntInt_Parms.A = A;
 	GreaterGreater_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnGreaterGreater_IntInt->iNative;
-	pFnGreaterGreater_IntInt->iNative = 0;
-
-	pFnGreaterGreater_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGreaterGreater_IntInt, &GreaterGreater_IntInt_Parms, NULL );
-
-	pFnGreaterGreater_IntInt->FunctionFlags |= 0x400;
-
-	pFnGreaterGreater_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnGreaterGreater_IntInt, &GreaterGreater_IntInt_Parms ) )
+		this->ProcessEvent ( pFnGreaterGreater_IntInt, &GreaterGreater_IntInt_Parms, NULL );
 
 	return GreaterGreater_IntInt_Parms.ReturnValue;
 };
@@ -8223,25 +6557,16 @@ int UObject::GreaterGreater_IntInt ( int A, int B )
 
 int UObject::LessLess_IntInt ( int A, int B )
 {
-	static UFunction* pFnLessLess_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLessLess_IntIntRef { L"Function Core.Object.LessLess_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLessLess_IntInt )
-		pFnLessLess_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.LessLess_IntInt" );
+	UFunction* const pFnLessLess_IntInt = pFnLessLess_IntIntRef.Get ( );
 
 	UObject_execLessLess_IntInt_Parms LessLess_IntInt_Parms;
 	LessLess_IntInt_Parms.A = A;
 	LessLess_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnLessLess_IntInt->iNative;
-	pFnLessLess_IntInt->iNative = 0;
-
-	pFnLessLess_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLessLess_IntInt, &LessLess_IntInt_Parms, NULL );
-
-	pFnLessLess_IntInt->FunctionFlags |= 0x400;
-
-	pFnLessLess_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnLessLess_IntInt, &LessLess_IntInt_Parms ) )
+		this->ProcessEvent ( pFnLessLess_IntInt, &LessLess_IntInt_Parms, NULL );
 
 	return LessLess_IntInt_Parms.ReturnValue;
 };
@@ -8255,25 +6580,16 @@ int UObject::LessLess_IntInt ( int A, int B )
 
 int UObject::Subtract_IntInt ( int A, int B )
 {
-	static UFunction* pFnSubtract_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtract_IntIntRef { L"Function Core.Object.Subtract_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtract_IntInt )
-		pFnSubtract_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.Subtract_IntInt" );
+	UFunction* const pFnSubtract_IntInt = pFnSubtract_IntIntRef.Get ( );
 
 	UObject_execSubtract_IntInt_Parms Subtract_IntInt_Parms;
 	Subtract_IntInt_Parms.A = A;
 	Subtract_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnSubtract_IntInt->iNative;
-	pFnSubtract_IntInt->iNative = 0;
-
-	pFnSubtract_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtract_IntInt, &Subtract_IntInt_Parms, NULL );
-
-	pFnSubtract_IntInt->FunctionFlags |= 0x400;
-
-	pFnSubtract_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtract_IntInt, &Subtract_IntInt_Parms ) )
+		this->ProcessEvent ( pFnSubtract_IntInt, &Subtract_IntInt_Parms, NULL );
 
 	return Subtract_IntInt_Parms.ReturnValue;
 };
@@ -8287,25 +6603,16 @@ int UObject::Subtract_IntInt ( int A, int B )
 
 int UObject::Add_IntInt ( int A, int B )
 {
-	static UFunction* pFnAdd_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAdd_IntIntRef { L"Function Core.Object.Add_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAdd_IntInt )
-		pFnAdd_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.Add_IntInt" );
+	UFunction* const pFnAdd_IntInt = pFnAdd_IntIntRef.Get ( );
 
 	UObject_execAdd_IntInt_Parms Add_IntInt_Parms;
 	Add_IntInt_Parms.A = A;
 	Add_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnAdd_IntInt->iNative;
-	pFnAdd_IntInt->iNative = 0;
-
-	pFnAdd_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAdd_IntInt, &Add_IntInt_Parms, NULL );
-
-	pFnAdd_IntInt->FunctionFlags |= 0x400;
-
-	pFnAdd_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAdd_IntInt, &Add_IntInt_Parms ) )
+		this->ProcessEvent ( pFnAdd_IntInt, &Add_IntInt_Parms, NULL );
 
 	return Add_IntInt_Parms.ReturnValue;
 };
@@ -8319,25 +6626,16 @@ int UObject::Add_IntInt ( int A, int B )
 
 int UObject::Percent_IntInt ( int A, int B )
 {
-	static UFunction* pFnPercent_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPercent_IntIntRef { L"Function Core.Object.Percent_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPercent_IntInt )
-		pFnPercent_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.Percent_IntInt" );
+	UFunction* const pFnPercent_IntInt = pFnPercent_IntIntRef.Get ( );
 
 	UObject_execPercent_IntInt_Parms Percent_IntInt_Parms;
 	Percent_IntInt_Parms.A = A;
 	Percent_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnPercent_IntInt->iNative;
-	pFnPercent_IntInt->iNative = 0;
-
-	pFnPercent_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnPercent_IntInt, &Percent_IntInt_Parms, NULL );
-
-	pFnPercent_IntInt->FunctionFlags |= 0x400;
-
-	pFnPercent_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnPercent_IntInt, &Percent_IntInt_Parms ) )
+		this->ProcessEvent ( pFnPercent_IntInt, &Percent_IntInt_Parms, NULL );
 
 	return Percent_IntInt_Parms.ReturnValue;
 };
@@ -8351,25 +6649,16 @@ int UObject::Percent_IntInt ( int A, int B )
 
 int UObject::Divide_IntInt ( int A, int B )
 {
-	static UFunction* pFnDivide_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDivide_IntIntRef { L"Function Core.Object.Divide_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDivide_IntInt )
-		pFnDivide_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.Divide_IntInt" );
+	UFunction* const pFnDivide_IntInt = pFnDivide_IntIntRef.Get ( );
 
 	UObject_execDivide_IntInt_Parms Divide_IntInt_Parms;
 	Divide_IntInt_Parms.A = A;
 	Divide_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnDivide_IntInt->iNative;
-	pFnDivide_IntInt->iNative = 0;
-
-	pFnDivide_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDivide_IntInt, &Divide_IntInt_Parms, NULL );
-
-	pFnDivide_IntInt->FunctionFlags |= 0x400;
-
-	pFnDivide_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnDivide_IntInt, &Divide_IntInt_Parms ) )
+		this->ProcessEvent ( pFnDivide_IntInt, &Divide_IntInt_Parms, NULL );
 
 	return Divide_IntInt_Parms.ReturnValue;
 };
@@ -8383,25 +6672,16 @@ int UObject::Divide_IntInt ( int A, int B )
 
 int UObject::Multiply_IntInt ( int A, int B )
 {
-	static UFunction* pFnMultiply_IntInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiply_IntIntRef { L"Function Core.Object.Multiply_IntInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiply_IntInt )
-		pFnMultiply_IntInt = UObject::FindObject< UFunction > ( L"Function Core.Object.Multiply_IntInt" );
+	UFunction* const pFnMultiply_IntInt = pFnMultiply_IntIntRef.Get ( );
 
 	UObject_execMultiply_IntInt_Parms Multiply_IntInt_Parms;
 	Multiply_IntInt_Parms.A = A;
 	Multiply_IntInt_Parms.B = B;
 
-	unsigned short NativeIndex = pFnMultiply_IntInt->iNative;
-	pFnMultiply_IntInt->iNative = 0;
-
-	pFnMultiply_IntInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiply_IntInt, &Multiply_IntInt_Parms, NULL );
-
-	pFnMultiply_IntInt->FunctionFlags |= 0x400;
-
-	pFnMultiply_IntInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMultiply_IntInt, &Multiply_IntInt_Parms ) )
+		this->ProcessEvent ( pFnMultiply_IntInt, &Multiply_IntInt_Parms, NULL );
 
 	return Multiply_IntInt_Parms.ReturnValue;
 };
@@ -8414,24 +6694,15 @@ int UObject::Multiply_IntInt ( int A, int B )
 
 int UObject::Subtract_PreInt ( int A )
 {
-	static UFunction* pFnSubtract_PreInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtract_PreIntRef { L"Function Core.Object.Subtract_PreInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtract_PreInt )
-		pFnSubtract_PreInt = UObject::FindObject< UFunction > ( L"Function Core.Object.Subtract_PreInt" );
+	UFunction* const pFnSubtract_PreInt = pFnSubtract_PreIntRef.Get ( );
 
 	UObject_execSubtract_PreInt_Parms Subtract_PreInt_Parms;
 	Subtract_PreInt_Parms.A = A;
 
-	unsigned short NativeIndex = pFnSubtract_PreInt->iNative;
-	pFnSubtract_PreInt->iNative = 0;
-
-	pFnSubtract_PreInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtract_PreInt, &Subtract_PreInt_Parms, NULL );
-
-	pFnSubtract_PreInt->FunctionFlags |= 0x400;
-
-	pFnSubtract_PreInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtract_PreInt, &Subtract_PreInt_Parms ) )
+		this->ProcessEvent ( pFnSubtract_PreInt, &Subtract_PreInt_Parms, NULL );
 
 	return Subtract_PreInt_Parms.ReturnValue;
 };
@@ -8444,24 +6715,15 @@ int UObject::Subtract_PreInt ( int A )
 
 int UObject::Complement_PreInt ( int A )
 {
-	static UFunction* pFnComplement_PreInt = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnComplement_PreIntRef { L"Function Core.Object.Complement_PreInt", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnComplement_PreInt )
-		pFnComplement_PreInt = UObject::FindObject< UFunction > ( L"Function Core.Object.Complement_PreInt" );
+	UFunction* const pFnComplement_PreInt = pFnComplement_PreIntRef.Get ( );
 
 	UObject_execComplement_PreInt_Parms Complement_PreInt_Parms;
 	Complement_PreInt_Parms.A = A;
 
-	unsigned short NativeIndex = pFnComplement_PreInt->iNative;
-	pFnComplement_PreInt->iNative = 0;
-
-	pFnComplement_PreInt->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnComplement_PreInt, &Complement_PreInt_Parms, NULL );
-
-	pFnComplement_PreInt->FunctionFlags |= 0x400;
-
-	pFnComplement_PreInt->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnComplement_PreInt, &Complement_PreInt_Parms ) )
+		this->ProcessEvent ( pFnComplement_PreInt, &Complement_PreInt_Parms, NULL );
 
 	return Complement_PreInt_Parms.ReturnValue;
 };
@@ -8474,26 +6736,17 @@ int UObject::Complement_PreInt ( int A )
 
 unsigned char UObject::SubtractSubtract_Byte ( unsigned char* A )
 {
-	static UFunction* pFnSubtractSubtract_Byte = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtractSubtract_ByteRef { L"Function Core.Object.SubtractSubtract_Byte", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtractSubtract_Byte )
-		pFnSubtractSubtract_Byte = UObject::FindObject< UFunction > ( L"Function Core.Object.SubtractSubtract_Byte" );
+	UFunction* const pFnSubtractSubtract_Byte = pFnSubtractSubtract_ByteRef.Get ( );
 
 	UObject_execSubtractSubtract_Byte_Parms SubtractSubtract_Byte_Parms;
 
 	if ( A )
 		SubtractSubtract_Byte_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnSubtractSubtract_Byte->iNative;
-	pFnSubtractSubtract_Byte->iNative = 0;
-
-	pFnSubtractSubtract_Byte->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtractSubtract_Byte, &SubtractSubtract_Byte_Parms, NULL );
-
-	pFnSubtractSubtract_Byte->FunctionFlags |= 0x400;
-
-	pFnSubtractSubtract_Byte->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtractSubtract_Byte, &SubtractSubtract_Byte_Parms ) )
+		this->ProcessEvent ( pFnSubtractSubtract_Byte, &SubtractSubtract_Byte_Parms, NULL );
 
 	if ( A )
 		*A = SubtractSubtract_Byte_Parms.A;
@@ -8509,26 +6762,17 @@ unsigned char UObject::SubtractSubtract_Byte ( unsigned char* A )
 
 unsigned char UObject::AddAdd_Byte ( unsigned char* A )
 {
-	static UFunction* pFnAddAdd_Byte = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddAdd_ByteRef { L"Function Core.Object.AddAdd_Byte", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddAdd_Byte )
-		pFnAddAdd_Byte = UObject::FindObject< UFunction > ( L"Function Core.Object.AddAdd_Byte" );
+	UFunction* const pFnAddAdd_Byte = pFnAddAdd_ByteRef.Get ( );
 
 	UObject_execAddAdd_Byte_Parms AddAdd_Byte_Parms;
 
 	if ( A )
 		AddAdd_Byte_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnAddAdd_Byte->iNative;
-	pFnAddAdd_Byte->iNative = 0;
-
-	pFnAddAdd_Byte->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddAdd_Byte, &AddAdd_Byte_Parms, NULL );
-
-	pFnAddAdd_Byte->FunctionFlags |= 0x400;
-
-	pFnAddAdd_Byte->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAddAdd_Byte, &AddAdd_Byte_Parms ) )
+		this->ProcessEvent ( pFnAddAdd_Byte, &AddAdd_Byte_Parms, NULL );
 
 	if ( A )
 		*A = AddAdd_Byte_Parms.A;
@@ -8544,26 +6788,17 @@ unsigned char UObject::AddAdd_Byte ( unsigned char* A )
 
 unsigned char UObject::SubtractSubtract_PreByte ( unsigned char* A )
 {
-	static UFunction* pFnSubtractSubtract_PreByte = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtractSubtract_PreByteRef { L"Function Core.Object.SubtractSubtract_PreByte", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtractSubtract_PreByte )
-		pFnSubtractSubtract_PreByte = UObject::FindObject< UFunction > ( L"Function Core.Object.SubtractSubtract_PreByte" );
+	UFunction* const pFnSubtractSubtract_PreByte = pFnSubtractSubtract_PreByteRef.Get ( );
 
 	UObject_execSubtractSubtract_PreByte_Parms SubtractSubtract_PreByte_Parms;
 
 	if ( A )
 		SubtractSubtract_PreByte_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnSubtractSubtract_PreByte->iNative;
-	pFnSubtractSubtract_PreByte->iNative = 0;
-
-	pFnSubtractSubtract_PreByte->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtractSubtract_PreByte, &SubtractSubtract_PreByte_Parms, NULL );
-
-	pFnSubtractSubtract_PreByte->FunctionFlags |= 0x400;
-
-	pFnSubtractSubtract_PreByte->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtractSubtract_PreByte, &SubtractSubtract_PreByte_Parms ) )
+		this->ProcessEvent ( pFnSubtractSubtract_PreByte, &SubtractSubtract_PreByte_Parms, NULL );
 
 	if ( A )
 		*A = SubtractSubtract_PreByte_Parms.A;
@@ -8579,26 +6814,17 @@ unsigned char UObject::SubtractSubtract_PreByte ( unsigned char* A )
 
 unsigned char UObject::AddAdd_PreByte ( unsigned char* A )
 {
-	static UFunction* pFnAddAdd_PreByte = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddAdd_PreByteRef { L"Function Core.Object.AddAdd_PreByte", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddAdd_PreByte )
-		pFnAddAdd_PreByte = UObject::FindObject< UFunction > ( L"Function Core.Object.AddAdd_PreByte" );
+	UFunction* const pFnAddAdd_PreByte = pFnAddAdd_PreByteRef.Get ( );
 
 	UObject_execAddAdd_PreByte_Parms AddAdd_PreByte_Parms;
 
 	if ( A )
 		AddAdd_PreByte_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnAddAdd_PreByte->iNative;
-	pFnAddAdd_PreByte->iNative = 0;
-
-	pFnAddAdd_PreByte->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddAdd_PreByte, &AddAdd_PreByte_Parms, NULL );
-
-	pFnAddAdd_PreByte->FunctionFlags |= 0x400;
-
-	pFnAddAdd_PreByte->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAddAdd_PreByte, &AddAdd_PreByte_Parms ) )
+		this->ProcessEvent ( pFnAddAdd_PreByte, &AddAdd_PreByte_Parms, NULL );
 
 	if ( A )
 		*A = AddAdd_PreByte_Parms.A;
@@ -8615,10 +6841,9 @@ unsigned char UObject::AddAdd_PreByte ( unsigned char* A )
 
 unsigned char UObject::SubtractEqual_ByteByte ( unsigned char B, unsigned char* A )
 {
-	static UFunction* pFnSubtractEqual_ByteByte = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubtractEqual_ByteByteRef { L"Function Core.Object.SubtractEqual_ByteByte", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubtractEqual_ByteByte )
-		pFnSubtractEqual_ByteByte = UObject::FindObject< UFunction > ( L"Function Core.Object.SubtractEqual_ByteByte" );
+	UFunction* const pFnSubtractEqual_ByteByte = pFnSubtractEqual_ByteByteRef.Get ( );
 
 	UObject_execSubtractEqual_ByteByte_Parms SubtractEqual_ByteByte_Parms;
 	SubtractEqual_ByteByte_Parms.B = B;
@@ -8626,16 +6851,8 @@ unsigned char UObject::SubtractEqual_ByteByte ( unsigned char B, unsigned char*
 	if ( A )
 		SubtractEqual_ByteByte_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnSubtractEqual_ByteByte->iNative;
-	pFnSubtractEqual_ByteByte->iNative = 0;
-
-	pFnSubtractEqual_ByteByte->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubtractEqual_ByteByte, &SubtractEqual_ByteByte_Parms, NULL );
-
-	pFnSubtractEqual_ByteByte->FunctionFlags |= 0x400;
-
-	pFnSubtractEqual_ByteByte->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnSubtractEqual_ByteByte, &SubtractEqual_ByteByte_Parms ) )
+		this->ProcessEvent ( pFnSubtractEqual_ByteByte, &SubtractEqual_ByteByte_Parms, NULL );
 
 	if ( A )
 		*A = SubtractEqual_ByteByte_Parms.A;
@@ -8652,10 +6869,9 @@ unsigned char UObject::SubtractEqual_ByteByte ( unsigned char B, unsigned char*
 
 unsigned char UObject::AddEqual_ByteByte ( unsigned char B, unsigned char* A )
 {
-	static UFunction* pFnAddEqual_ByteByte = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddEqual_ByteByteRef { L"Function Core.Object.AddEqual_ByteByte", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddEqual_ByteByte )
-		pFnAddEqual_ByteByte = UObject::FindObject< UFunction > ( L"Function Core.Object.AddEqual_ByteByte" );
+	UFunction* const pFnAddEqual_ByteByte = pFnAddEqual_ByteByteRef.Get ( );
 
 	UObject_execAddEqual_ByteByte_Parms AddEqual_ByteByte_Parms;
 	AddEqual_ByteByte_Parms.B = B;
@@ -8663,16 +6879,8 @@ unsigned char UObject::AddEqual_ByteByte ( unsigned char B, unsigned char* A )
 	if ( A )
 		AddEqual_ByteByte_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnAddEqual_ByteByte->iNative;
-	pFnAddEqual_ByteByte->iNative = 0;
-
-	pFnAddEqual_ByteByte->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddEqual_ByteByte, &AddEqual_ByteByte_Parms, NULL );
-
-	pFnAddEqual_ByteByte->FunctionFlags |= 0x400;
-
-	pFnAddEqual_ByteByte->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAddEqual_ByteByte, &AddEqual_ByteByte_Parms ) )
+		this->ProcessEvent ( pFnAddEqual_ByteByte, &AddEqual_ByteByte_Parms, NULL );
 
 	if ( A )
 		*A = AddEqual_ByteByte_Parms.A;
@@ -8689,10 +6897,9 @@ unsigned char UObject::AddEqual_ByteByte ( unsigned char B, unsigned char* A )
 
 unsigned char UObject::DivideEqual_ByteByte ( unsigned char B, unsigned char* A )
 {
-	static UFunction* pFnDivideEqual_ByteByte = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDivideEqual_ByteByteRef { L"Function Core.Object.DivideEqual_ByteByte", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDivideEqual_ByteByte )
-		pFnDivideEqual_ByteByte = UObject::FindObject< UFunction > ( L"Function Core.Object.DivideEqual_ByteByte" );
+	UFunction* const pFnDivideEqual_ByteByte = pFnDivideEqual_ByteByteRef.Get ( );
 
 	UObject_execDivideEqual_ByteByte_Parms DivideEqual_ByteByte_Parms;
 	DivideEqual_ByteByte_Parms.B = B;
@@ -8700,16 +6907,8 @@ unsigned char UObject::DivideEqual_ByteByte ( unsigned char B, unsigned char* A
 	if ( A )
 		DivideEqual_ByteByte_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnDivideEqual_ByteByte->iNative;
-	pFnDivideEqual_ByteByte->iNative = 0;
-
-	pFnDivideEqual_ByteByte->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDivideEqual_ByteByte, &DivideEqual_ByteByte_Parms, NULL );
-
-	pFnDivideEqual_ByteByte->FunctionFlags |= 0x400;
-
-	pFnDivideEqual_ByteByte->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnDivideEqual_ByteByte, &DivideEqual_ByteByte_Parms ) )
+		this->ProcessEvent ( pFnDivideEqual_ByteByte, &DivideEqual_ByteByte_Parms, NULL );
 
 	if ( A )
 		*A = DivideEqual_ByteByte_Parms.A;
@@ -8726,10 +6925,9 @@ unsigned char UObject::DivideEqual_ByteByte ( unsigned char B, unsigned char* A
 
 unsigned char UObject::MultiplyEqual_ByteFloat ( float B, unsigned char* A )
 {
-	static UFunction* pFnMultiplyEqual_ByteFloat = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiplyEqual_ByteFloatRef { L"Function Core.Object.MultiplyEqual_ByteFloat", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiplyEqual_ByteFloat )
-		pFnMultiplyEqual_ByteFloat = UObject::FindObject< UFunction > ( L"Function Core.Object.MultiplyEqual_ByteFloat" );
+	UFunction* const pFnMultiplyEqual_ByteFloat = pFnMultiplyEqual_ByteFloatRef.Get ( );
 
 	UObject_execMultiplyEqual_ByteFloat_Parms MultiplyEqual_ByteFloat_Parms;
 	MultiplyEqual_ByteFloat_Parms.B = B;
@@ -8737,16 +6935,8 @@ unsigned char UObject::MultiplyEqual_ByteFloat ( float B, unsigned char* A )
 	if ( A )
 		MultiplyEqual_ByteFloat_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnMultiplyEqual_ByteFloat->iNative;
-	pFnMultiplyEqual_ByteFloat->iNative = 0;
-
-	pFnMultiplyEqual_ByteFloat->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiplyEqual_ByteFloat, &MultiplyEqual_ByteFloat_Parms, NULL );
-
-	pFnMultiplyEqual_ByteFloat->FunctionFlags |= 0x400;
-
-	pFnMultiplyEqual_ByteFloat->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMultiplyEqual_ByteFloat, &MultiplyEqual_ByteFloat_Parms ) )
+		this->ProcessEvent ( pFnMultiplyEqual_ByteFloat, &MultiplyEqual_ByteFloat_Parms, NULL );
 
 	if ( A )
 		*A = MultiplyEqual_ByteFloat_Parms.A;
@@ -8763,10 +6953,9 @@ unsigned char UObject::MultiplyEqual_ByteFloat ( float B, unsigned char* A )
 
 unsigned char UObject::MultiplyEqual_ByteByte ( unsigned char B, unsigned char* A )
 {
-	static UFunction* pFnMultiplyEqual_ByteByte = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMultiplyEqual_ByteByteRef { L"Function Core.Object.MultiplyEqual_ByteByte", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMultiplyEqual_ByteByte )
-		pFnMultiplyEqual_ByteByte = UObject::FindObject< UFunction > ( L"Function Core.Object.MultiplyEqual_ByteByte" );
+	UFunction* const pFnMultiplyEqual_ByteByte = pFnMultiplyEqual_ByteByteRef.Get ( );
 
 	UObject_execMultiplyEqual_ByteByte_Parms MultiplyEqual_ByteByte_Parms;
 	MultiplyEqual_ByteByte_Parms.B = B;
@@ -8774,16 +6963,8 @@ unsigned char UObject::MultiplyEqual_ByteByte ( unsigned char B, unsigned char*
 	if ( A )
 		MultiplyEqual_ByteByte_Parms.A = *A;
 
-	unsigned short NativeIndex = pFnMultiplyEqual_ByteByte->iNative;
-	pFnMultiplyEqual_ByteByte->iNative = 0;
-
-	pFnMultiplyEqual_ByteByte->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMultiplyEqual_ByteByte, &MultiplyEqual_ByteByte_Parms, NULL );
-
-	pFnMultiplyEqual_ByteByte->FunctionFlags |= 0x400;
-
-	pFnMultiplyEqual_ByteByte->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnMultiplyEqual_ByteByte, &MultiplyEqual_ByteByte_Parms ) )
+		this->ProcessEvent ( pFnMultiplyEqual_ByteByte, &MultiplyEqual_ByteByte_Parms, NULL );
 
 	if ( A )
 		*A = MultiplyEqual_ByteByte_Parms.A;
@@ -8800,25 +6981,16 @@ unsigned char UObject::MultiplyEqual_ByteByte ( unsigned char B, unsigned char*
 
 bool UObject::OrOr_BoolBool ( unsigned long A, unsigned long B )
 {
-	static UFunction* pFnOrOr_BoolBool = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOrOr_BoolBoolRef { L"Function Core.Object.OrOr_BoolBool", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOrOr_BoolBool )
-		pFnOrOr_BoolBool = UObject::FindObject< UFunction > ( L"Function Core.Object.OrOr_BoolBool" );
+	UFunction* const pFnOrOr_BoolBool = pFnOrOr_BoolBoolRef.Get ( );
 
 	UObject_execOrOr_BoolBool_Parms OrOr_BoolBool_Parms;
 	OrOr_BoolBool_Parms.A = A;
 	OrOr_BoolBool_Parms.B = B;
 
-	unsigned short NativeIndex = pFnOrOr_BoolBool->iNative;
-	pFnOrOr_BoolBool->iNative = 0;
-
-	pFnOrOr_BoolBool->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOrOr_BoolBool, &OrOr_BoolBool_Parms, NULL );
-
-	pFnOrOr_BoolBool->FunctionFlags |= 0x400;
-
-	pFnOrOr_BoolBool->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnOrOr_BoolBool, &OrOr_BoolBool_Parms ) )
+		this->ProcessEvent ( pFnOrOr_BoolBool, &OrOr_BoolBool_Parms, NULL );
 
 	return OrOr_BoolBool_Parms.ReturnValue;
 };
@@ -8832,25 +7004,16 @@ bool UObject::OrOr_BoolBool ( unsigned long A, unsigned long B )
 
 bool UObject::XorXor_BoolBool ( unsigned long A, unsigned long B )
 {
-	static UFunction* pFnXorXor_BoolBool = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnXorXor_BoolBoolRef { L"Function Core.Object.XorXor_BoolBool", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnXorXor_BoolBool )
-		pFnXorXor_BoolBool = UObject::FindObject< UFunction > ( L"Function Core.Object.XorXor_BoolBool" );
+	UFunction* const pFnXorXor_BoolBool = pFnXorXor_BoolBoolRef.Get ( );
 
 	UObject_execXorXor_BoolBool_Parms XorXor_BoolBool_Parms;
 	XorXor_BoolBool_Parms.A = A;
 	XorXor_BoolBool_Parms.B = B;
 
-	unsigned short NativeIndex = pFnXorXor_BoolBool->iNative;
-	pFnXorXor_BoolBool->iNative = 0;
-
-	pFnXorXor_BoolBool->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnXorXor_BoolBool, &XorXor_BoolBool_Parms, NULL );
-
-	pFnXorXor_BoolBool->FunctionFlags |= 0x400;
-
-	pFnXorXor_BoolBool->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnXorXor_BoolBool, &XorXor_BoolBool_Parms ) )
+		this->ProcessEvent ( pFnXorXor_BoolBool, &XorXor_BoolBool_Parms, NULL );
 
 	return XorXor_BoolBool_Parms.ReturnValue;
 };
@@ -8864,25 +7027,16 @@ bool UObject::XorXor_BoolBool ( unsigned long A, unsigned long B )
 
 bool UObject::AndAnd_BoolBool ( unsigned long A, unsigned long B )
 {
-	static UFunction* pFnAndAnd_BoolBool = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAndAnd_BoolBoolRef { L"Function Core.Object.AndAnd_BoolBool", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAndAnd_BoolBool )
-		pFnAndAnd_BoolBool = UObject::FindObject< UFunction > ( L"Function Core.Object.AndAnd_BoolBool" );
+	UFunction* const pFnAndAnd_BoolBool = pFnAndAnd_BoolBoolRef.Get ( );
 
 	UObject_execAndAnd_BoolBool_Parms AndAnd_BoolBool_Parms;
 	AndAnd_BoolBool_Parms.A = A;
 	AndAnd_BoolBool_Parms.B = B;
 
-	unsigned short NativeIndex = pFnAndAnd_BoolBool->iNative;
-	pFnAndAnd_BoolBool->iNative = 0;
-
-	pFnAndAnd_BoolBool->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAndAnd_BoolBool, &AndAnd_BoolBool_Parms, NULL );
-
-	pFnAndAnd_BoolBool->FunctionFlags |= 0x400;
-
-	pFnAndAnd_BoolBool->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnAndAnd_BoolBool, &AndAnd_BoolBool_Parms ) )
+		this->ProcessEvent ( pFnAndAnd_BoolBool, &AndAnd_BoolBool_Parms, NULL );
 
 	return AndAnd_BoolBool_Parms.ReturnValue;
 };
@@ -8896,25 +7050,16 @@ bool UObject::AndAnd_BoolBool ( unsigned long A, unsigned long B )
 
 bool UObject::NotEqual_BoolBool ( unsigned long A, unsigned long B )
 {
-	static UFunction* pFnNotEqual_BoolBool = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotEqual_BoolBoolRef { L"Function Core.Object.NotEqual_BoolBool", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotEqual_BoolBool )
-		pFnNotEqual_BoolBool = UObject::FindObject< UFunction > ( L"Function Core.Object.NotEqual_BoolBool" );
+	UFunction* const pFnNotEqual_BoolBool = pFnNotEqual_BoolBoolRef.Get ( );
 
 	UObject_execNotEqual_BoolBool_Parms NotEqual_BoolBool_Parms;
 	NotEqual_BoolBool_Parms.A = A;
 	NotEqual_BoolBool_Parms.B = B;
 
-	unsigned short NativeIndex = pFnNotEqual_BoolBool->iNative;
-	pFnNotEqual_BoolBool->iNative = 0;
-
-	pFnNotEqual_BoolBool->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNotEqual_BoolBool, &NotEqual_BoolBool_Parms, NULL );
-
-	pFnNotEqual_BoolBool->FunctionFlags |= 0x400;
-
-	pFnNotEqual_BoolBool->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnNotEqual_BoolBool, &NotEqual_BoolBool_Parms ) )
+		this->ProcessEvent ( pFnNotEqual_BoolBool, &NotEqual_BoolBool_Parms, NULL );
 
 	return NotEqual_BoolBool_Parms.ReturnValue;
 };
@@ -8928,25 +7073,16 @@ bool UObject::NotEqual_BoolBool ( unsigned long A, unsigned long B )
 
 bool UObject::EqualEqual_BoolBool ( unsigned long A, unsigned long B )
 {
-	static UFunction* pFnEqualEqual_BoolBool = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEqualEqual_BoolBoolRef { L"Function Core.Object.EqualEqual_BoolBool", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEqualEqual_BoolBool )
-		pFnEqualEqual_BoolBool = UObject::FindObject< UFunction > ( L"Function Core.Object.EqualEqual_BoolBool" );
+	UFunction* const pFnEqualEqual_BoolBool = pFnEqualEqual_BoolBoolRef.Get ( );
 
 	UObject_execEqualEqual_BoolBool_Parms EqualEqual_BoolBool_Parms;
 	EqualEqual_BoolBool_Parms.A = A;
 	EqualEqual_BoolBool_Parms.B = B;
 
-	unsigned short NativeIndex = pFnEqualEqual_BoolBool->iNative;
-	pFnEqualEqual_BoolBool->iNative = 0;
-
-	pFnEqualEqual_BoolBool->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEqualEqual_BoolBool, &EqualEqual_BoolBool_Parms, NULL );
-
-	pFnEqualEqual_BoolBool->FunctionFlags |= 0x400;
-
-	pFnEqualEqual_BoolBool->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnEqualEqual_BoolBool, &EqualEqual_BoolBool_Parms ) )
+		this->ProcessEvent ( pFnEqualEqual_BoolBool, &EqualEqual_BoolBool_Parms, NULL );
 
 	return EqualEqual_BoolBool_Parms.ReturnValue;
 };
@@ -8959,470 +7095,350 @@ bool UObject::EqualEqual_BoolBool ( unsigned long A, unsigned long B )
 
 bool UObject::Not_PreBool ( unsigned long A )
 {
-	static UFunction* pFnNot_PreBool = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNot_PreBoolRef { L"Function Core.Object.Not_PreBool", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNot_PreBool )
-		pFnNot_PreBool = UObject::FindObject< UFunction > ( L"Function Core.Object.Not_PreBool" );
+	UFunction* const pFnNot_PreBool = pFnNot_PreBoolRef.Get ( );
 
 	UObject_execNot_PreBool_Parms Not_PreBool_Parms;
 	Not_PreBool_Parms.A = A;
 
-	unsigned short NativeIndex = pFnNot_PreBool->iNative;
-	pFnNot_PreBool->iNative = 0;
-
-	pFnNot_PreBool->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnNot_PreBool, &Not_PreBool_Parms, NULL );
-
-	pFnNot_PreBool->FunctionFlags |= 0x400;
-
-	pFnNot_PreBool->iNative = NativeIndex;
+	if ( !::LESDK::CallNative ( this, pFnNot_PreBool, &Not_PreBool_Parms ) )
+		this->ProcessEvent ( pFnNot_PreBool, &Not_PreBool_Parms, NULL );
 
 	return Not_PreBool_Parms.ReturnValue;
 };
 
 
 
-class UClass* USystem::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USystem::pClassPointer { L"Class Core.System", &UObject::FindClass };
 
 class UClass* USystem::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.System" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USubsystem::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USubsystem::pClassPointer { L"Class Core.Subsystem", &UObject::FindClass };
 
 class UClass* USubsystem::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Subsystem" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UPackageMap::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UPackageMap::pClassPointer { L"Class Core.PackageMap", &UObject::FindClass };
 
 class UClass* UPackageMap::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.PackageMap" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UObjectSerializer::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UObjectSerializer::pClassPointer { L"Class Core.ObjectSerializer", &UObject::FindClass };
 
 class UClass* UObjectSerializer::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.ObjectSerializer" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UObjectRedirector::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UObjectRedirector::pClassPointer { L"Class Core.ObjectRedirector", &UObject::FindClass };
 
 class UClass* UObjectRedirector::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.ObjectRedirector" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UMetaData::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UMetaData::pClassPointer { L"Class Core.MetaData", &UObject::FindClass };
 
 class UClass* UMetaData::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.MetaData" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ULinkerSave::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ULinkerSave::pClassPointer { L"Class Core.LinkerSave", &UObject::FindClass };
 
 class UClass* ULinkerSave::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.LinkerSave" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ULinker::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ULinker::pClassPointer { L"Class Core.Linker", &UObject::FindClass };
 
 class UClass* ULinker::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Linker" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ULinkerLoad::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ULinkerLoad::pClassPointer { L"Class Core.LinkerLoad", &UObject::FindClass };
 
 class UClass* ULinkerLoad::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.LinkerLoad" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UInterface::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UInterface::pClassPointer { L"Class Core.Interface", &UObject::FindClass };
 
 class UClass* UInterface::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Interface" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UScriptStruct::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UScriptStruct::pClassPointer { L"Class Core.ScriptStruct", &UObject::FindClass };
 
 class UClass* UScriptStruct::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.ScriptStruct" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UStruct::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UStruct::pClassPointer { L"Class Core.Struct", &UObject::FindClass };
 
 class UClass* UStruct::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Struct" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UField::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UField::pClassPointer { L"Class Core.Field", &UObject::FindClass };
 
 class UClass* UField::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Field" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UFunction::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UFunction::pClassPointer { L"Class Core.Function", &UObject::FindClass };
 
 class UClass* UFunction::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Function" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UStructProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UStructProperty::pClassPointer { L"Class Core.StructProperty", &UObject::FindClass };
 
 class UClass* UStructProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.StructProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UProperty::pClassPointer { L"Class Core.Property", &UObject::FindClass };
 
 class UClass* UProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Property" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UStrProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UStrProperty::pClassPointer { L"Class Core.StrProperty", &UObject::FindClass };
 
 class UClass* UStrProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.StrProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UStringRefProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UStringRefProperty::pClassPointer { L"Class Core.StringRefProperty", &UObject::FindClass };
 
 class UClass* UStringRefProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.StringRefProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UComponentProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UComponentProperty::pClassPointer { L"Class Core.ComponentProperty", &UObject::FindClass };
 
 class UClass* UComponentProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.ComponentProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UObjectProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UObjectProperty::pClassPointer { L"Class Core.ObjectProperty", &UObject::FindClass };
 
 class UClass* UObjectProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.ObjectProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UClassProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UClassProperty::pClassPointer { L"Class Core.ClassProperty", &UObject::FindClass };
 
 class UClass* UClassProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.ClassProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UNameProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UNameProperty::pClassPointer { L"Class Core.NameProperty", &UObject::FindClass };
 
 class UClass* UNameProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.NameProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UMapProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UMapProperty::pClassPointer { L"Class Core.MapProperty", &UObject::FindClass };
 
 class UClass* UMapProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.MapProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UIntProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UIntProperty::pClassPointer { L"Class Core.IntProperty", &UObject::FindClass };
 
 class UClass* UIntProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.IntProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UInterfaceProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UInterfaceProperty::pClassPointer { L"Class Core.InterfaceProperty", &UObject::FindClass };
 
 class UClass* UInterfaceProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.InterfaceProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UFloatProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UFloatProperty::pClassPointer { L"Class Core.FloatProperty", &UObject::FindClass };
 
 class UClass* UFloatProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.FloatProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UDelegateProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UDelegateProperty::pClassPointer { L"Class Core.DelegateProperty", &UObject::FindClass };
 
 class UClass* UDelegateProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.DelegateProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UByteProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UByteProperty::pClassPointer { L"Class Core.ByteProperty", &UObject::FindClass };
 
 class UClass* UByteProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.ByteProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBoolProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBoolProperty::pClassPointer { L"Class Core.BoolProperty", &UObject::FindClass };
 
 class UClass* UBoolProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.BoolProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioMask4Property::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioMask4Property::pClassPointer { L"Class Core.BioMask4Property", &UObject::FindClass };
 
 class UClass* UBioMask4Property::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.BioMask4Property" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UArrayProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UArrayProperty::pClassPointer { L"Class Core.ArrayProperty", &UObject::FindClass };
 
 class UClass* UArrayProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.ArrayProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UEnum::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UEnum::pClassPointer { L"Class Core.Enum", &UObject::FindClass };
 
 class UClass* UEnum::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Enum" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UConst::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UConst::pClassPointer { L"Class Core.Const", &UObject::FindClass };
 
 class UClass* UConst::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Const" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UTextBufferFactory::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UTextBufferFactory::pClassPointer { L"Class Core.TextBufferFactory", &UObject::FindClass };
 
 class UClass* UTextBufferFactory::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.TextBufferFactory" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UFactory::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UFactory::pClassPointer { L"Class Core.Factory", &UObject::FindClass };
 
 class UClass* UFactory::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Factory" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UExporter::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UExporter::pClassPointer { L"Class Core.Exporter", &UObject::FindClass };
 
 class UClass* UExporter::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Exporter" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UDistributionVector::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UDistributionVector::pClassPointer { L"Class Core.DistributionVector", &UObject::FindClass };
 
 class UClass* UDistributionVector::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.DistributionVector" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function Core.DistributionVector.GetVectorValue
@@ -9434,46 +7450,36 @@ class UClass* UDistributionVector::StaticClass()
 
 struct FVector UDistributionVector::GetVectorValue ( float F, int LastExtreme )
 {
-	static UFunction* pFnGetVectorValue = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVectorValueRef { L"Function Core.DistributionVector.GetVectorValue", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVectorValue )
-		pFnGetVectorValue = UObject::FindObject< UFunction > ( L"Function Core.DistributionVector.GetVectorValue" );
+	UFunction* const pFnGetVectorValue = pFnGetVectorValueRef.Get ( );
 
 	UDistributionVector_execGetVectorValue_Parms GetVectorValue_Parms;
 	GetVectorValue_Parms.F = F;
 	GetVectorValue_Parms.LastExtreme = LastExtreme;
 
-	pFnGetVectorValue->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVectorValue, &GetVectorValue_Parms, NULL );
-
-	pFnGetVectorValue->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVectorValue, &GetVectorValue_Parms ) )
+		this->ProcessEvent ( pFnGetVectorValue, &GetVectorValue_Parms, NULL );
 
 	return GetVectorValue_Parms.ReturnValue;
 };
 
 
 
-class UClass* UComponent::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UComponent::pClassPointer { L"Class Core.Component", &UObject::FindClass };
 
 class UClass* UComponent::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Component" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UDistributionFloat::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UDistributionFloat::pClassPointer { L"Class Core.DistributionFloat", &UObject::FindClass };
 
 class UClass* UDistributionFloat::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.DistributionFloat" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function Core.DistributionFloat.GetFloatValue
@@ -9484,33 +7490,26 @@ class UClass* UDistributionFloat::StaticClass()
 
 float UDistributionFloat::GetFloatValue ( float F )
 {
-	static UFunction* pFnGetFloatValue = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetFloatValueRef { L"Function Core.DistributionFloat.GetFloatValue", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetFloatValue )
-		pFnGetFloatValue = UObject::FindObject< UFunction > ( L"Function Core.DistributionFloat.GetFloatValue" );
+	UFunction* const pFnGetFloatValue = pFnGetFloatValueRef.Get ( );
 
 	UDistributionFloat_execGetFloatValue_Parms GetFloatValue_Parms;
 	GetFloatValue_Parms.F = F;
 
-	pFnGetFloatValue->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetFloatValue, &GetFloatValue_Parms, NULL );
-
-	pFnGetFloatValue->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetFloatValue, &GetFloatValue_Parms ) )
+		this->ProcessEvent ( pFnGetFloatValue, &GetFloatValue_Parms, NULL );
 
 	return GetFloatValue_Parms.ReturnValue;
 };
 
 
 
-class UClass* UHelpCommandlet::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UHelpCommandlet::pClassPointer { L"Class Core.HelpCommandlet", &UObject::FindClass };
 
 class UClass* UHelpCommandlet::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.HelpCommandlet" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function Core.HelpCommandlet.Main
@@ -9521,33 +7520,26 @@ class UClass* UHelpCommandlet::StaticClass()
 
 int UHelpCommandlet::eventMain ( FString const& Params )
 {
-	static UFunction* pFnMain = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMainRef { L"Function Core.HelpCommandlet.Main", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMain )
-		pFnMain = UObject::FindObject< UFunction > ( L"Function Core.HelpCommandlet.Main" );
+	UFunction* const pFnMain = pFnMainRef.Get ( );
 
 	UHelpCommandlet_eventMain_Parms Main_Parms;
 	memcpy ( &Main_Parms.Params, &Params, 0x10 );
 
-	pFnMain->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMain, &Main_Parms, NULL );
-
-	pFnMain->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnMain, &Main_Parms ) )
+		this->ProcessEvent ( pFnMain, &Main_Parms, NULL );
 
 	return Main_Parms.ReturnValue;
 };
 
 
 
-class UClass* UCommandlet::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UCommandlet::pClassPointer { L"Class Core.Commandlet", &UObject::FindClass };
 
 class UClass* UCommandlet::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Commandlet" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function Core.Commandlet.Main
@@ -9558,61 +7550,408 @@ class UClass* UCommandlet::StaticClass()
 
 int UCommandlet::eventMain ( FString const& Params )
 {
-	static UFunction* pFnMain = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMainRef { L"Function Core.Commandlet.Main", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMain )
-		pFnMain = UObject::FindObject< UFunction > ( L"Function Core.Commandlet.Main" );
+	UFunction* const pFnMain = pFnMainRef.Get ( );
 
 	UCommandlet_eventMain_Parms Main_Parms;
 	memcpy ( &Main_Parms.Params, &Params, 0x10 );
 
-	pFnMain->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnMain, &Main_Parms, NULL );
-
-	pFnMain->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnMain, &Main_Parms ) )
+		this->ProcessEvent ( pFnMain, &Main_Parms, NULL );
 
 	return Main_Parms.ReturnValue;
 };
 
 
 
-class UClass* UPackage::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UPackage::pClassPointer { L"Class Core.Package", &UObject::FindClass };
 
 class UClass* UPackage::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Package" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UState::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UState::pClassPointer { L"Class Core.State", &UObject::FindClass };
 
 class UClass* UState::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.State" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UClass::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UClass::pClassPointer { L"Class Core.Class", &UObject::FindClass };
 
 class UClass* UClass::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class Core.Class" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class Core.TextBuffer",
+	L"Class Core.Object",
+	L"Function Core.Object.GetNetIndex",
+	L"Function Core.Object.appScreenDebugMessage",
+	L"Function Core.Object.GetSystemTime",
+	L"Function Core.Object.TimeStamp",
+	L"Function Core.Object.TransformVectorByRotation",
+	L"Function Core.Object.GetPackageName",
+	L"Function Core.Object.IsPendingKill",
+	L"Function Core.Object.ByteToFloat",
+	L"Function Core.Object.FloatToByte",
+	L"Function Core.Object.UnwindHeading",
+	L"Function Core.Object.FindDeltaAngle",
+	L"Function Core.Object.GetHeadingAngle",
+	L"Function Core.Object.GetAngularDegreesFromRadians",
+	L"Function Core.Object.GetAngularFromDotDist",
+	L"Function Core.Object.GetAngularDistance",
+	L"Function Core.Object.GetDotDistance",
+	L"Function Core.Object.PointProjectToPlane",
+	L"Function Core.Object.PointDistToPlane",
+	L"Function Core.Object.PointDistToSegment",
+	L"Function Core.Object.PointDistToLine",
+	L"Function Core.Object.GetPerObjectConfigSections",
+	L"Function Core.Object.StaticSaveConfig",
+	L"Function Core.Object.SaveConfig",
+	L"Function Core.Object.FindObject",
+	L"Function Core.Object.DynamicLoadObject",
+	L"Function Core.Object.GetEnumIndex",
+	L"Function Core.Object.GetEnum",
+	L"Function Core.Object.Disable",
+	L"Function Core.Object.Enable",
+	L"Function Core.Object.ContinuedState",
+	L"Function Core.Object.PausedState",
+	L"Function Core.Object.PoppedState",
+	L"Function Core.Object.PushedState",
+	L"Function Core.Object.EndState",
+	L"Function Core.Object.BeginState",
+	L"Function Core.Object.DumpStateStack",
+	L"Function Core.Object.PopState",
+	L"Function Core.Object.PushState",
+	L"Function Core.Object.GetStateName",
+	L"Function Core.Object.IsChildState",
+	L"Function Core.Object.IsInState",
+	L"Function Core.Object.GotoState",
+	L"Function Core.Object.IsUTracing",
+	L"Function Core.Object.SetUTracing",
+	L"Function Core.Object.GetFuncName",
+	L"Function Core.Object.DebugBreak",
+	L"Function Core.Object.ScriptTrace",
+	L"Function Core.Object.ParseLocalizedPropertyPath",
+	L"Function Core.Object.Localize",
+	L"Function Core.Object.WarnInternal",
+	L"Function Core.Object.LogInternal",
+	L"Function Core.Object.Subtract_LinearColorLinearColor",
+	L"Function Core.Object.Multiply_LinearColorFloat",
+	L"Function Core.Object.ColorToLinearColor",
+	L"Function Core.Object.MakeLinearColor",
+	L"Function Core.Object.LerpColor",
+	L"Function Core.Object.MakeColor",
+	L"Function Core.Object.Add_ColorColor",
+	L"Function Core.Object.Multiply_ColorFloat",
+	L"Function Core.Object.Multiply_FloatColor",
+	L"Function Core.Object.Subtract_ColorColor",
+	L"Function Core.Object.EvalInterpCurveVector2D",
+	L"Function Core.Object.EvalInterpCurveVector",
+	L"Function Core.Object.EvalInterpCurveFloat",
+	L"Function Core.Object.vect2d",
+	L"Function Core.Object.GetMappedRangeValue",
+	L"Function Core.Object.GetRangePctByValue",
+	L"Function Core.Object.GetRangeValueByPct",
+	L"Function Core.Object.Subtract_Vector2DVector2D",
+	L"Function Core.Object.Add_Vector2DVector2D",
+	L"Function Core.Object.GetVectorSide",
+	L"Function Core.Object.GetAngleBetween",
+	L"Function Core.Object.NotEqual_IntStringRef",
+	L"Function Core.Object.NotEqual_StringRefInt",
+	L"Function Core.Object.NotEqual_StringRefStringRef",
+	L"Function Core.Object.EqualEqual_IntStringRef",
+	L"Function Core.Object.EqualEqual_StringRefInt",
+	L"Function Core.Object.EqualEqual_StringRefStringRef",
+	L"Function Core.Object.Subtract_QuatQuat",
+	L"Function Core.Object.Add_QuatQuat",
+	L"Function Core.Object.QuatSlerp",
+	L"Function Core.Object.QuatToRotator",
+	L"Function Core.Object.QuatFromRotator",
+	L"Function Core.Object.QuatFromAxisAndAngle",
+	L"Function Core.Object.QuatFindBetween",
+	L"Function Core.Object.QuatRotateVector",
+	L"Function Core.Object.QuatInvert",
+	L"Function Core.Object.QuatDot",
+	L"Function Core.Object.QuatProduct",
+	L"Function Core.Object.MatrixGetAxis",
+	L"Function Core.Object.MatrixGetOrigin",
+	L"Function Core.Object.MatrixGetRotator",
+	L"Function Core.Object.MakeRotationMatrix",
+	L"Function Core.Object.MakeRotationTranslationMatrix",
+	L"Function Core.Object.InverseTransformNormal",
+	L"Function Core.Object.TransformNormal",
+	L"Function Core.Object.InverseTransformVector",
+	L"Function Core.Object.TransformVector",
+	L"Function Core.Object.Multiply_MatrixMatrix",
+	L"Function Core.Object.NotEqual_NameName",
+	L"Function Core.Object.EqualEqual_NameName",
+	L"Function Core.Object.IsA",
+	L"Function Core.Object.ClassIsChildOf",
+	L"Function Core.Object.NotEqual_InterfaceInterface",
+	L"Function Core.Object.EqualEqual_InterfaceInterface",
+	L"Function Core.Object.NotEqual_ObjectObject",
+	L"Function Core.Object.EqualEqual_ObjectObject",
+	L"Function Core.Object.PathName",
+	L"Function Core.Object.SplitString",
+	L"Function Core.Object.ParseStringIntoArray",
+	L"Function Core.Object.JoinArray",
+	L"Function Core.Object.GetRightMost",
+	L"Function Core.Object.Split",
+	L"Function Core.Object.Repl",
+	L"Function Core.Object.Asc",
+	L"Function Core.Object.Chr",
+	L"Function Core.Object.Locs",
+	L"Function Core.Object.Caps",
+	L"Function Core.Object.Right",
+	L"Function Core.Object.Left",
+	L"Function Core.Object.Mid",
+	L"Function Core.Object.InStr",
+	L"Function Core.Object.Len",
+	L"Function Core.Object.SubtractEqual_StrStr",
+	L"Function Core.Object.AtEqual_StrStr",
+	L"Function Core.Object.ConcatEqual_StrStr",
+	L"Function Core.Object.ComplementEqual_StrStr",
+	L"Function Core.Object.NotEqual_StrStr",
+	L"Function Core.Object.EqualEqual_StrStr",
+	L"Function Core.Object.GreaterEqual_StrStr",
+	L"Function Core.Object.LessEqual_StrStr",
+	L"Function Core.Object.Greater_StrStr",
+	L"Function Core.Object.Less_StrStr",
+	L"Function Core.Object.At_StrStr",
+	L"Function Core.Object.Concat_StrStr",
+	L"Function Core.Object.MakeRotator",
+	L"Function Core.Object.SClampRotAxis",
+	L"Function Core.Object.ClampRotAxisFromRange",
+	L"Function Core.Object.ClampRotAxisFromBase",
+	L"Function Core.Object.ClampRotAxis",
+	L"Function Core.Object.RSize",
+	L"Function Core.Object.RDiff",
+	L"Function Core.Object.NormalizeRotAxis",
+	L"Function Core.Object.RInterpTo",
+	L"Function Core.Object.RTransform",
+	L"Function Core.Object.RSmerp",
+	L"Function Core.Object.RLerp",
+	L"Function Core.Object.Normalize",
+	L"Function Core.Object.OrthoRotation",
+	L"Function Core.Object.RotRand",
+	L"Function Core.Object.GetUnAxes",
+	L"Function Core.Object.GetAxes",
+	L"Function Core.Object.ClockwiseFrom_IntInt",
+	L"Function Core.Object.SubtractEqual_RotatorRotator",
+	L"Function Core.Object.AddEqual_RotatorRotator",
+	L"Function Core.Object.Subtract_RotatorRotator",
+	L"Function Core.Object.Add_RotatorRotator",
+	L"Function Core.Object.DivideEqual_RotatorFloat",
+	L"Function Core.Object.MultiplyEqual_RotatorFloat",
+	L"Function Core.Object.Divide_RotatorFloat",
+	L"Function Core.Object.Multiply_FloatRotator",
+	L"Function Core.Object.Multiply_RotatorFloat",
+	L"Function Core.Object.NotEqual_RotatorRotator",
+	L"Function Core.Object.EqualEqual_RotatorRotator",
+	L"Function Core.Object.InCylinder",
+	L"Function Core.Object.NoZDot",
+	L"Function Core.Object.ClampLength",
+	L"Function Core.Object.VInterpTo",
+	L"Function Core.Object.IsZero",
+	L"Function Core.Object.ProjectOnTo",
+	L"Function Core.Object.MirrorVectorByNormal",
+	L"Function Core.Object.VRandCone2",
+	L"Function Core.Object.VRandCone",
+	L"Function Core.Object.VRand",
+	L"Function Core.Object.VSmerp",
+	L"Function Core.Object.VLerp",
+	L"Function Core.Object.Normal",
+	L"Function Core.Object.VSizeSq2D",
+	L"Function Core.Object.VSizeSq",
+	L"Function Core.Object.VSize2D",
+	L"Function Core.Object.VSize",
+	L"Function Core.Object.SubtractEqual_VectorVector",
+	L"Function Core.Object.AddEqual_VectorVector",
+	L"Function Core.Object.DivideEqual_VectorFloat",
+	L"Function Core.Object.MultiplyEqual_VectorVector",
+	L"Function Core.Object.MultiplyEqual_VectorFloat",
+	L"Function Core.Object.Cross_VectorVector",
+	L"Function Core.Object.Dot_VectorVector",
+	L"Function Core.Object.NotEqual_VectorVector",
+	L"Function Core.Object.EqualEqual_VectorVector",
+	L"Function Core.Object.GreaterGreater_VectorRotator",
+	L"Function Core.Object.LessLess_VectorRotator",
+	L"Function Core.Object.Subtract_VectorVector",
+	L"Function Core.Object.Add_VectorVector",
+	L"Function Core.Object.Divide_VectorFloat",
+	L"Function Core.Object.Multiply_VectorVector",
+	L"Function Core.Object.Multiply_FloatVector",
+	L"Function Core.Object.Multiply_VectorFloat",
+	L"Function Core.Object.Subtract_PreVector",
+	L"Function Core.Object.SetBioRwBox",
+	L"Function Core.Object.GetTokenisedString",
+	L"Function Core.Object.SetCustomToken",
+	L"Function Core.Object.ClearCustomTokens",
+	L"Function Core.Object.FInterpConstantTo",
+	L"Function Core.Object.FInterpTo",
+	L"Function Core.Object.FPctByRange",
+	L"Function Core.Object.RandRange",
+	L"Function Core.Object.FInterpEaseInOut",
+	L"Function Core.Object.FInterpEaseOut",
+	L"Function Core.Object.FInterpEaseIn",
+	L"Function Core.Object.FCubicInterp",
+	L"Function Core.Object.FCeil",
+	L"Function Core.Object.FFloor",
+	L"Function Core.Object.Round",
+	L"Function Core.Object.Lerp",
+	L"Function Core.Object.FClamp",
+	L"Function Core.Object.FMax",
+	L"Function Core.Object.FMin",
+	L"Function Core.Object.FRand",
+	L"Function Core.Object.Square",
+	L"Function Core.Object.Sqrt",
+	L"Function Core.Object.Loge",
+	L"Function Core.Object.Exp",
+	L"Function Core.Object.Atan2",
+	L"Function Core.Object.Atan",
+	L"Function Core.Object.Tan",
+	L"Function Core.Object.Acos",
+	L"Function Core.Object.Cos",
+	L"Function Core.Object.Asin",
+	L"Function Core.Object.Sin",
+	L"Function Core.Object.Abs",
+	L"Function Core.Object.SubtractEqual_FloatFloat",
+	L"Function Core.Object.AddEqual_FloatFloat",
+	L"Function Core.Object.DivideEqual_FloatFloat",
+	L"Function Core.Object.MultiplyEqual_FloatFloat",
+	L"Function Core.Object.NotEqual_FloatFloat",
+	L"Function Core.Object.ComplementEqual_FloatFloat",
+	L"Function Core.Object.EqualEqual_FloatFloat",
+	L"Function Core.Object.GreaterEqual_FloatFloat",
+	L"Function Core.Object.LessEqual_FloatFloat",
+	L"Function Core.Object.Greater_FloatFloat",
+	L"Function Core.Object.Less_FloatFloat",
+	L"Function Core.Object.Subtract_FloatFloat",
+	L"Function Core.Object.Add_FloatFloat",
+	L"Function Core.Object.Percent_FloatFloat",
+	L"Function Core.Object.Divide_FloatFloat",
+	L"Function Core.Object.Multiply_FloatFloat",
+	L"Function Core.Object.MultiplyMultiply_FloatFloat",
+	L"Function Core.Object.Subtract_PreFloat",
+	L"Function Core.Object.ToHex",
+	L"Function Core.Object.Clamp",
+	L"Function Core.Object.Max",
+	L"Function Core.Object.Min",
+	L"Function Core.Object.Rand",
+	L"Function Core.Object.SubtractSubtract_Int",
+	L"Function Core.Object.AddAdd_Int",
+	L"Function Core.Object.SubtractSubtract_PreInt",
+	L"Function Core.Object.AddAdd_PreInt",
+	L"Function Core.Object.SubtractEqual_IntInt",
+	L"Function Core.Object.AddEqual_IntInt",
+	L"Function Core.Object.DivideEqual_IntFloat",
+	L"Function Core.Object.MultiplyEqual_IntFloat",
+	L"Function Core.Object.Or_IntInt",
+	L"Function Core.Object.Xor_IntInt",
+	L"Function Core.Object.And_IntInt",
+	L"Function Core.Object.NotEqual_IntInt",
+	L"Function Core.Object.EqualEqual_IntInt",
+	L"Function Core.Object.GreaterEqual_IntInt",
+	L"Function Core.Object.LessEqual_IntInt",
+	L"Function Core.Object.Greater_IntInt",
+	L"Function Core.Object.Less_IntInt",
+	L"Function Core.Object.GreaterGreaterGreater_IntInt",
+	L"Function Core.Object.GreaterGreater_IntInt",
+	L"Function Core.Object.LessLess_IntInt",
+	L"Function Core.Object.Subtract_IntInt",
+	L"Function Core.Object.Add_IntInt",
+	L"Function Core.Object.Percent_IntInt",
+	L"Function Core.Object.Divide_IntInt",
+	L"Function Core.Object.Multiply_IntInt",
+	L"Function Core.Object.Subtract_PreInt",
+	L"Function Core.Object.Complement_PreInt",
+	L"Function Core.Object.SubtractSubtract_Byte",
+	L"Function Core.Object.AddAdd_Byte",
+	L"Function Core.Object.SubtractSubtract_PreByte",
+	L"Function Core.Object.AddAdd_PreByte",
+	L"Function Core.Object.SubtractEqual_ByteByte",
+	L"Function Core.Object.AddEqual_ByteByte",
+	L"Function Core.Object.DivideEqual_ByteByte",
+	L"Function Core.Object.MultiplyEqual_ByteFloat",
+	L"Function Core.Object.MultiplyEqual_ByteByte",
+	L"Function Core.Object.OrOr_BoolBool",
+	L"Function Core.Object.XorXor_BoolBool",
+	L"Function Core.Object.AndAnd_BoolBool",
+	L"Function Core.Object.NotEqual_BoolBool",
+	L"Function Core.Object.EqualEqual_BoolBool",
+	L"Function Core.Object.Not_PreBool",
+	L"Class Core.System",
+	L"Class Core.Subsystem",
+	L"Class Core.PackageMap",
+	L"Class Core.ObjectSerializer",
+	L"Class Core.ObjectRedirector",
+	L"Class Core.MetaData",
+	L"Class Core.LinkerSave",
+	L"Class Core.Linker",
+	L"Class Core.LinkerLoad",
+	L"Class Core.Interface",
+	L"Class Core.ScriptStruct",
+	L"Class Core.Struct",
+	L"Class Core.Field",
+	L"Class Core.Function",
+	L"Class Core.StructProperty",
+	L"Class Core.Property",
+	L"Class Core.StrProperty",
+	L"Class Core.StringRefProperty",
+	L"Class Core.ComponentProperty",
+	L"Class Core.ObjectProperty",
+	L"Class Core.ClassProperty",
+	L"Class Core.NameProperty",
+	L"Class Core.MapProperty",
+	L"Class Core.IntProperty",
+	L"Class Core.InterfaceProperty",
+	L"Class Core.FloatProperty",
+	L"Class Core.DelegateProperty",
+	L"Class Core.ByteProperty",
+	L"Class Core.BoolProperty",
+	L"Class Core.BioMask4Property",
+	L"Class Core.ArrayProperty",
+	L"Class Core.Enum",
+	L"Class Core.Const",
+	L"Class Core.TextBufferFactory",
+	L"Class Core.Factory",
+	L"Class Core.Exporter",
+	L"Class Core.DistributionVector",
+	L"Function Core.DistributionVector.GetVectorValue",
+	L"Class Core.Component",
+	L"Class Core.DistributionFloat",
+	L"Function Core.DistributionFloat.GetFloatValue",
+	L"Class Core.HelpCommandlet",
+	L"Function Core.HelpCommandlet.Main",
+	L"Class Core.Commandlet",
+	L"Function Core.Commandlet.Main",
+	L"Class Core.Package",
+	L"Class Core.State",
+	L"Class Core.Class",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
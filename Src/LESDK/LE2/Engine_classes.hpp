@@ -3385,7 +3385,7 @@ public:
 	unsigned char                                      TransitionType;                                   		// 0x08A5 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3440,7 +3440,7 @@ public:
 	unsigned char                                      TravelType;                                       		// 0x0A18 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3623,7 +3623,7 @@ public:
 	unsigned char                                      TickGroup;                                        		// 0x0289 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3899,7 +3899,7 @@ public:
 	unsigned char                                      CsgOper;                                          		// 0x02A8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3913,7 +3913,7 @@ class ABrushShape : public ABrush
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3932,7 +3932,7 @@ public:
 	unsigned long                                      bProcessAllActors : 1;                            		// 0x02C8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3958,7 +3958,7 @@ public:
 	unsigned long                                      bInclusionaryList : 1;                            		// 0x02DC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3974,7 +3974,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x02E0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3993,7 +3993,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x02DC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4013,7 +4013,7 @@ public:
 	unsigned char                                      StreamingUsage;                                   		// 0x02E4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4030,7 +4030,7 @@ class ALightmassImportanceVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4044,7 +4044,7 @@ class APathBlockingVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4084,7 +4084,7 @@ public:
 	unsigned long                                      bWaterVolume : 1;                                 		// 0x0318 (0x0004) [0x0000000000000000] [0x00001000] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4119,7 +4119,7 @@ class ADefaultPhysicsVolume : public APhysicsVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4136,7 +4136,7 @@ public:
 	float                                              RBPhysicsGravityScaling;                          		// 0x0320 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4159,7 +4159,7 @@ public:
 	unsigned long                                      bAllowLadderStrafing : 1;                         		// 0x0358 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4179,7 +4179,7 @@ public:
 	TArray<class APortalTeleporter*>                   Portals;                                          		// 0x02CC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4197,7 +4197,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x03B8 (0x0004) [0x0000000000000021] [0x00000001] ( CPF_Edit | CPF_Net )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4216,7 +4216,7 @@ public:
 	float                                              Priority;                                         		// 0x0308 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4230,7 +4230,7 @@ class ATriggerVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4250,7 +4250,7 @@ public:
 	unsigned long                                      bFadeOut : 1;                                     		// 0x02A4 (0x0004) [0x0000000100000020] [0x00000001] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4287,7 +4287,7 @@ public:
 	unsigned long                                      bSafeBaseIfAsleep : 1;                            		// 0x02D0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4328,7 +4328,7 @@ public:
 	unsigned long                                      bIsLift : 1;                                      		// 0x031C (0x0004) [0x0000000000000000] [0x00000080] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4364,7 +4364,7 @@ public:
 	unsigned long                                      bCurrentlyActive : 1;                             		// 0x029C (0x0004) [0x0000000100000020] [0x00000008] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4409,7 +4409,7 @@ public:
 	unsigned long                                      bLogPoolOverflowList : 1;                         		// 0x02F8 (0x0004) [0x0000000000044000] [0x00000002] ( CPF_Config | CPF_GlobalConfig )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4472,7 +4472,7 @@ public:
 	unsigned long                                      bShowOverlays : 1;                                		// 0x05C0 (0x0004) [0x0000000000000000] [0x00000100] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4525,7 +4525,7 @@ class AInfo : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4567,7 +4567,7 @@ public:
 	unsigned long                                      bSentinelStreamingLevelStillLoading : 1;          		// 0x034C (0x0004) [0x0000000000002000] [0x00000080] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4606,7 +4606,7 @@ public:
 	float                                              AutoSelectHeight;                                 		// 0x02A0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4629,7 +4629,7 @@ public:
 	unsigned char                                      FileType;                                         		// 0x02A8 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4647,7 +4647,7 @@ class AFileLog : public AFileWriter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4759,7 +4759,7 @@ public:
 	unsigned long                                      bHasStandbyCheatTriggered : 1;                    		// 0x04B4 (0x0004) [0x0000000000000000] [0x01000000] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4929,7 +4929,7 @@ class AMCPTools : public AGameInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4949,7 +4949,7 @@ public:
 	unsigned long                                      bUserAdded : 1;                                   		// 0x02A4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4992,7 +4992,7 @@ class APotentialClimbWatcher : public AInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5011,7 +5011,7 @@ public:
 	float                                              FudgeFactor;                                      		// 0x02A8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5028,7 +5028,7 @@ public:
 	class UWindPointSourceComponent*                   Component;                                        		// 0x028C (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5046,7 +5046,7 @@ public:
 	unsigned long                                      bSoftKillZ : 1;                                   		// 0x029C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5189,7 +5189,7 @@ public:
 	unsigned char                                      m_eBioMaxPath;                                    		// 0x07DF (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5281,7 +5281,7 @@ public:
 	unsigned long                                      bPredictRespawns : 1;                             		// 0x02FC (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5336,7 +5336,7 @@ public:
 	unsigned char                                      CurrentFireMode;                                  		// 0x03CC (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5449,7 +5449,7 @@ public:
 	unsigned long                                      bMustHoldWeapon : 1;                              		// 0x02B4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5500,7 +5500,7 @@ class AKeypoint : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5514,7 +5514,7 @@ class ATargetPoint : public AKeypoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5529,7 +5529,7 @@ public:
 	class UMaterialInstanceConstant*                   MatInst;                                          		// 0x028C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5550,7 +5550,7 @@ public:
 	unsigned long                                      bPaused : 1;                                      		// 0x02A0 (0x0004) [0x0000000000000020] [0x00000004] ( CPF_Net )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5625,7 +5625,7 @@ public:
 	unsigned long                                      bShouldSaveForCheckpoint : 1;                     		// 0x0388 (0x0004) [0x0000000000002000] [0x80000000] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5689,7 +5689,7 @@ public:
 	unsigned char                                      LocationDescription;                              		// 0x0420 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5741,7 +5741,7 @@ public:
 	class AActor*                                      m_aContainingActor;                               		// 0x0424 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5758,7 +5758,7 @@ public:
 	unsigned long                                      bIgnoreSizeLimits : 1;                            		// 0x0398 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5778,7 +5778,7 @@ class ASFXDynamicCoverSlotMarker : public ACoverSlotMarker
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5800,7 +5800,7 @@ public:
 	unsigned char                                      DoorType;                                         		// 0x03A0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5821,7 +5821,7 @@ public:
 	class AController*                                 CurrentUser;                                      		// 0x038C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5837,7 +5837,7 @@ public:
 	class ALadder*                                     LadderList;                                       		// 0x0394 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5852,7 +5852,7 @@ class AAutoLadder : public ALadder
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5872,7 +5872,7 @@ public:
 	unsigned long                                      bJumpLift : 1;                                    		// 0x03B0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5892,7 +5892,7 @@ public:
 	unsigned long                                      bExitOnly : 1;                                    		// 0x0394 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5910,7 +5910,7 @@ public:
 	struct FCoverInfo                                  OwningSlot;                                       		// 0x038C (0x000C) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5924,7 +5924,7 @@ class AObjective : public ANavigationPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5938,7 +5938,7 @@ class APathNode : public ANavigationPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5956,7 +5956,7 @@ public:
 	unsigned long                                      bManualSizing : 1;                                		// 0x0394 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5981,7 +5981,7 @@ public:
 	unsigned long                                      bRespawnPaused : 1;                               		// 0x03B4 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6021,7 +6021,7 @@ public:
 	unsigned long                                      bPrimaryStart : 1;                                		// 0x0390 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6037,7 +6037,7 @@ public:
 	class APortalTeleporter*                           MyPortal;                                         		// 0x038C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6081,7 +6081,7 @@ public:
 	int                                                DebugEdgeCount;                                   		// 0x0428 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6100,7 +6100,7 @@ public:
 	unsigned long                                      bOpen : 1;                                        		// 0x042C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6118,7 +6118,7 @@ public:
 	unsigned long                                      bMoving : 1;                                      		// 0x042C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6138,7 +6138,7 @@ public:
 	class AActor*                                      m_aContainingActor;                               		// 0x038C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6163,7 +6163,7 @@ public:
 	unsigned long                                      bCanTeleportVehicles : 1;                         		// 0x03B4 (0x0004) [0x0000000000000001] [0x00000040] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6184,7 +6184,7 @@ public:
 	FString                                            Text;                                             		// 0x028C (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6218,7 +6218,7 @@ public:
 	unsigned long                                      bNotBlockedByShield : 1;                          		// 0x02EC (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6255,7 +6255,7 @@ class ARigidBodyBase : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6270,7 +6270,7 @@ public:
 	class USceneCaptureComponent*                      SceneCapture;                                     		// 0x028C (0x0008) [0x000000000408000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6286,7 +6286,7 @@ public:
 	class UDrawFrustumComponent*                       DrawFrustum;                                      		// 0x0294 (0x0008) [0x000000000408000A]              ( CPF_Const | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6302,7 +6302,7 @@ public:
 	class UMaterialInstanceConstant*                   CubeMaterialInst;                                 		// 0x029C (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6318,7 +6318,7 @@ public:
 	class UMaterialInstanceConstant*                   ReflectMaterialInst;                              		// 0x029C (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6332,7 +6332,7 @@ class ASceneCapturePortalActor : public ASceneCaptureReflectActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6353,7 +6353,7 @@ public:
 	unsigned long                                      bCanTeleportVehicles : 1;                         		// 0x02BC (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6372,7 +6372,7 @@ class AStaticMeshActorBase : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6388,7 +6388,7 @@ public:
 	class UAudioComponent*                             oAudioComponent;                                  		// 0x0294 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6405,7 +6405,7 @@ public:
 	int                                                MaxStaticMeshComponents;                          		// 0x029C (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6422,7 +6422,7 @@ public:
 	class UStaticMeshComponent*                        StaticMeshComponent;                              		// 0x02AC (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6441,7 +6441,7 @@ public:
 	unsigned long                                      bRecentlyTriggered : 1;                           		// 0x0298 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6470,7 +6470,7 @@ public:
 	unsigned char                                      ComponentType;                                    		// 0x0085 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6556,7 +6556,7 @@ public:
 	struct FScriptDelegate                             __OnQueueSubtitles__Delegate;                     		// 0x0248 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6590,7 +6590,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x00A4 (0x0004) [0x0000000000000003] [0x00000001] ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6706,7 +6706,7 @@ public:
 	float                                              ScriptRigidBodyCollisionThreshold;                		// 0x0224 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6767,7 +6767,7 @@ public:
 	unsigned long                                      bTreatAsASprite : 1;                              		// 0x0230 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6787,7 +6787,7 @@ public:
 	unsigned long                                      bBlockComplexCollisionTrace : 1;                  		// 0x0298 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6801,7 +6801,7 @@ class UCameraConeComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6821,7 +6821,7 @@ public:
 	unsigned long                                      bAlwaysRenderIfSelected : 1;                      		// 0x0234 (0x0004) [0x0000000000000002] [0x00000004] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6841,7 +6841,7 @@ public:
 	unsigned long                                      bDrawLitBox : 1;                                  		// 0x0240 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6861,7 +6861,7 @@ public:
 	unsigned long                                      bDrawLitCapsule : 1;                              		// 0x023C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6879,7 +6879,7 @@ public:
 	int                                                ConeSides;                                        		// 0x0234 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6902,7 +6902,7 @@ public:
 	unsigned long                                      bDrawLitCylinder : 1;                             		// 0x0248 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6922,7 +6922,7 @@ public:
 	class UTexture*                                    Texture;                                          		// 0x023C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6939,7 +6939,7 @@ public:
 	float                                              Height;                                           		// 0x0234 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6959,7 +6959,7 @@ public:
 	unsigned long                                      bDrawLitSphere : 1;                               		// 0x023C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6973,7 +6973,7 @@ class UDrawPylonRadiusComponent : public UDrawSphereComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6987,7 +6987,7 @@ class UDrawSoundRadiusComponent : public UDrawSphereComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7014,7 +7014,7 @@ public:
 	float                                              DefaultLifeTime;                                  		// 0x0258 (0x0004) [0x0000000000003002]              ( CPF_Const | CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7032,7 +7032,7 @@ public:
 	float                                              CachedTexturesTimer;                              		// 0x0258 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7078,7 +7078,7 @@ public:
 	struct FLightmassPrimitiveSettings                 LightmassSettings;                                		// 0x02B0 (0x001C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7102,7 +7102,7 @@ public:
 	TArray<FPointer>                                   Elements;                                         		// 0x0258 (0x0010) [0x0000000000803002]              ( CPF_Const | CPF_Native | CPF_Transient | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7123,7 +7123,7 @@ public:
 	unsigned long                                      bIsScreenSizeScaled : 1;                          		// 0x0244 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7151,7 +7151,7 @@ public:
 	unsigned char                                      DepthPriorityGroup;                               		// 0x00F0 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7193,7 +7193,7 @@ public:
 	unsigned char                                      ViewMode;                                         		// 0x00D4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7218,7 +7218,7 @@ public:
 	unsigned long                                      bUpdateMatrices : 1;                              		// 0x0174 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7242,7 +7242,7 @@ public:
 	float                                              FadingIntervalTime;                               		// 0x00FC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7262,7 +7262,7 @@ public:
 	float                                              FarPlane;                                         		// 0x00F0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7279,7 +7279,7 @@ public:
 	float                                              ScaleFOV;                                         		// 0x00E8 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7296,7 +7296,7 @@ public:
 	float                                              ScaleFOV;                                         		// 0x00E0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7315,7 +7315,7 @@ public:
 	float                                              Speed;                                            		// 0x009C (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7331,7 +7331,7 @@ public:
 	float                                              Radius;                                           		// 0x00A8 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7352,7 +7352,7 @@ public:
 	unsigned long                                      m_bNoCollisionFail : 1;                           		// 0x0088 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7368,7 +7368,7 @@ public:
 	class UClass*                                      ActorClass;                                       		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7388,7 +7388,7 @@ public:
 	unsigned long                                      bGiveDefaultInventory : 1;                        		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7403,7 +7403,7 @@ public:
 	class USoundCue*                                   AmbientSoundCue;                                  		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7417,7 +7417,7 @@ class UActorFactoryAmbientSoundMovable : public UActorFactoryAmbientSound
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7432,7 +7432,7 @@ public:
 	class USoundNodeWave*                              SoundNodeWave;                                    		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7446,7 +7446,7 @@ class UActorFactoryAmbientSoundNonLoop : public UActorFactoryAmbientSoundSimple
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7460,7 +7460,7 @@ class UActorFactoryAmbientSoundSimpleToggleable : public UActorFactoryAmbientSou
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7475,7 +7475,7 @@ public:
 	class UApexDestructibleAsset*                      DestructibleAsset;                                		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7490,7 +7490,7 @@ public:
 	class AActor*                                      ArchetypeActor;                                   		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7504,7 +7504,7 @@ class UActorFactoryCoverLink : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7518,7 +7518,7 @@ class UActorFactoryDominantDirectionalLight : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7540,7 +7540,7 @@ public:
 	unsigned char                                      CollisionType;                                    		// 0x00A4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7554,7 +7554,7 @@ class UActorFactoryMover : public UActorFactoryDynamicSM
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7578,7 +7578,7 @@ public:
 	unsigned char                                      RBChannel;                                        		// 0x00D0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7593,7 +7593,7 @@ public:
 	class UParticleSystem*                             ParticleSystem;                                   		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7609,7 +7609,7 @@ public:
 	class UFracturedStaticMesh*                        FracturedStaticMesh;                              		// 0x0098 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7624,7 +7624,7 @@ public:
 	class ULensFlare*                                  LensFlareObject;                                  		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7638,7 +7638,7 @@ class UActorFactoryLight : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7652,7 +7652,7 @@ class UActorFactoryPathNode : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7675,7 +7675,7 @@ public:
 	unsigned long                                      bCastDynamicShadow : 1;                           		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7691,7 +7691,7 @@ public:
 	class UPhysXDestructible*                          PhysXDestructible;                                		// 0x0098 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7705,7 +7705,7 @@ class UActorFactoryPlayerStart : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7719,7 +7719,7 @@ class UActorFactoryPylon : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7736,7 +7736,7 @@ public:
 	struct SFXName                                     AnimSequenceName;                                 		// 0x009C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7752,7 +7752,7 @@ public:
 	class UStaticMesh*                                 StaticMesh;                                       		// 0x0098 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7766,7 +7766,7 @@ class UActorFactoryTrigger : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7781,7 +7781,7 @@ public:
 	class UClass*                                      VehicleClass;                                     		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7797,7 +7797,7 @@ public:
 	unsigned long                                      m_bIsPhysicsSleeping : 1;                         		// 0x0068 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7814,7 +7814,7 @@ class UBioEngineEnums : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7829,7 +7829,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0060 (0x0008) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7846,7 +7846,7 @@ public:
 	FString                                            SourceFileTimestamp;                              		// 0x0080 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7861,7 +7861,7 @@ public:
 	FPointer                                           VfTable_FTickableObject;                          		// 0x0060 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7877,7 +7877,7 @@ public:
 	struct FRotator                                    Rotation;                                         		// 0x006C (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7908,7 +7908,7 @@ public:
 	unsigned long                                      bNoSmooth : 1;                                    		// 0x00B8 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7958,7 +7958,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x38 ];                            		// 0x0060 (0x0038) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7973,7 +7973,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x7C ];                            		// 0x0098 (0x007C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7988,7 +7988,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x14 ];                            		// 0x0098 (0x0014) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8003,7 +8003,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x218 ];                           		// 0x0098 (0x0218) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8018,7 +8018,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x10 ];                            		// 0x0098 (0x0010) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8098,7 +8098,7 @@ public:
 	struct FVector                                     NavMeshPath_SearchExtent_Modifier;                		// 0x0494 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8357,7 +8357,7 @@ public:
 	unsigned char                                      NetPlayerIndex;                                   		// 0x07A9 (0x0001) [0x0000000000200002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8735,7 +8735,7 @@ public:
 	class ADebugCameraController*                      DebugCameraControllerRef;                         		// 0x0068 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8812,7 +8812,7 @@ public:
 	unsigned char                                      UnknownData01[ 0x4 ];                             		// 0x0078 (0x0004) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8828,7 +8828,7 @@ public:
 	FString                                            Text;                                             		// 0x0070 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8843,7 +8843,7 @@ public:
 	float                                              PlaybackDuration;                                 		// 0x0060 (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8858,7 +8858,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x34 ];                            		// 0x0064 (0x0034) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8873,7 +8873,7 @@ public:
 	float                                              CurrentTime;                                      		// 0x0064 (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8889,7 +8889,7 @@ public:
 	TArray<struct FPresetGeneratedPoint>               Points;                                           		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8904,7 +8904,7 @@ class UCustomPropertyItemHandler : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8940,7 +8940,7 @@ public:
 	unsigned long                                      bRadialDamageVelChange : 1;                       		// 0x00BC (0x0004) [0x0000000000000001] [0x00000200] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8957,7 +8957,7 @@ class UKillZDamageType : public UDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8972,7 +8972,7 @@ public:
 	int                                                FirstColoredMip;                                  		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8987,7 +8987,7 @@ public:
 	float                                              Constant;                                         		// 0x007C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9007,7 +9007,7 @@ public:
 	unsigned char                                      ParamMode;                                        		// 0x0098 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9022,7 +9022,7 @@ public:
 	struct FInterpCurveFloat                           ConstantCurve;                                    		// 0x007C (0x0014) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9040,7 +9040,7 @@ public:
 	unsigned long                                      bConsistentValue : 1;                             		// 0x0088 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9055,7 +9055,7 @@ public:
 	struct FInterpCurveVector2D                        ConstantCurve;                                    		// 0x007C (0x0014) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9072,7 +9072,7 @@ public:
 	unsigned char                                      LockedAxes;                                       		// 0x008C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9092,7 +9092,7 @@ public:
 	unsigned char                                      ParamModes[ 0x3 ];                                		// 0x00C8 (0x0003) [0x0000000000080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9109,7 +9109,7 @@ public:
 	unsigned char                                      LockedAxes;                                       		// 0x0094 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9129,7 +9129,7 @@ public:
 	unsigned char                                      LockedAxes;                                       		// 0x009B (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9149,7 +9149,7 @@ public:
 	unsigned char                                      LockedAxes[ 0x2 ];                                		// 0x0097 (0x0002) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9164,7 +9164,7 @@ public:
 	unsigned char                                      UnknownData00[ 0xA44 ];                           		// 0x0060 (0x0A44) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9179,7 +9179,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0AA4 (0x0008) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9195,7 +9195,7 @@ public:
 	FString                                            Desc;                                             		// 0x00A0 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9209,7 +9209,7 @@ class UEditorLinkSelectionInterface : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9223,7 +9223,7 @@ class UEngineTypes : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9243,7 +9243,7 @@ public:
 	unsigned long                                      m_bBioSoundCuesFixedUp : 1;                       		// 0x009C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9264,7 +9264,7 @@ public:
 	int                                                NumLoadErrors;                                    		// 0x00B8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9288,7 +9288,7 @@ public:
 	int                                                NumCharacters;                                    		// 0x0174 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9307,7 +9307,7 @@ public:
 	TArray<float>                                      ResolutionTestTable;                              		// 0x0178 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9323,7 +9323,7 @@ public:
 	struct FFontImportOptionsData                      Data;                                             		// 0x0060 (0x0094) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9343,7 +9343,7 @@ public:
 	unsigned long                                      bIsPaused : 1;                                    		// 0x0074 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9362,7 +9362,7 @@ public:
 	unsigned long                                      bIsLooping : 1;                                   		// 0x0070 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9389,7 +9389,7 @@ public:
 	struct FGameplayEventsHeader                       Header;                                           		// 0x017C (0x0018) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9407,7 +9407,7 @@ public:
 	TArray<int>                                        EventIDFilter;                                    		// 0x0194 (0x0010) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9436,7 +9436,7 @@ public:
 	class AGameInfo*                                   Game;                                             		// 0x0194 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9514,7 +9514,7 @@ public:
 	struct FScriptDelegate                             __HandleInputChar__Delegate;                      		// 0x01B4 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9584,7 +9584,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x58 ];                            		// 0x0060 (0x0058) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9602,7 +9602,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0088 (0x0008) FIX WRONG TYPE SIZE OF PREVIUS PROPERTY
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9625,7 +9625,7 @@ class UInterface_NavigationHandle : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9642,7 +9642,7 @@ public:
 	int                                                ActiveTab;                                        		// 0x0070 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9666,7 +9666,7 @@ public:
 	unsigned long                                      bImportedTrack : 1;                               		// 0x008C (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9682,7 +9682,7 @@ public:
 	struct FKAggregateGeom                             AggGeom;                                          		// 0x006C (0x004C) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9698,7 +9698,7 @@ public:
     unsigned char                                      UnknownData00[0x60];                            		// 0x0070 (0x0060) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9716,7 +9716,7 @@ public:
 	unsigned char                                      UnknownData01[ 0x1B0 ];                           		// 0x0198 (0x01B0) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9731,7 +9731,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x44 ];                            		// 0x00D0 (0x0044) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9745,7 +9745,7 @@ class UDemoPlayPendingLevel : public UPendingLevel
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9759,7 +9759,7 @@ class UNetPendingLevel : public UPendingLevel
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9803,7 +9803,7 @@ public:
 	unsigned long                                      bShouldTestForPurpleLevels : 1;                   		// 0x00CC (0x0004) [0x0000000000004000] [0x00010000] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9818,7 +9818,7 @@ public:
 	unsigned long                                      bIsProceduralBuildingLODLevel : 1;                		// 0x00D0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9834,7 +9834,7 @@ public:
 	float                                              MaxDistance;                                      		// 0x00DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9849,7 +9849,7 @@ public:
 	unsigned long                                      bNeverAutoStreamOut : 1;                          		// 0x00D0 (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9863,7 +9863,7 @@ class ULevelStreamingPersistent : public ULevelStreaming
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9879,7 +9879,7 @@ public:
 	class UModel*                                      SourceModel;                                      		// 0x0070 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9906,7 +9906,7 @@ public:
 	unsigned long                                      bVisualizeAmbientOcclusion : 1;                   		// 0x008C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9921,7 +9921,7 @@ public:
 	struct FLightmassPrimitiveSettings                 LightmassSettings;                                		// 0x0060 (0x001C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9935,7 +9935,7 @@ class UMapInfo : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9949,7 +9949,7 @@ class USurface : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9970,7 +9970,7 @@ public:
 	struct FRenderCommandFence_Mirror                  ParentRefFence;                                   		// 0x00A0 (0x0004) [0x0000000000003002]              ( CPF_Const | CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10072,7 +10072,7 @@ public:
 	unsigned char                                      LightingModel;                                    		// 0x03C5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10092,7 +10092,7 @@ public:
 	unsigned long                                      bHidePreviewWindow : 1;                           		// 0x0068 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10107,7 +10107,7 @@ public:
 	unsigned char                                      UnknownData00[ 0xEF4 ];                           		// 0x0060 (0x0EF4) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10121,7 +10121,7 @@ class UMusicTrackDataStructures : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10136,7 +10136,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x300 ];                           		// 0x0060 (0x0300) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10168,7 +10168,7 @@ public:
 	unsigned char                                      UnknownData03[ 0x28 ];                            		// 0x01A4 (0x0028) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10190,7 +10190,7 @@ public:
 	unsigned char                                      UnknownData03[ 0x4 ];                             		// 0x02B0 (0x0004) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10205,7 +10205,7 @@ public:
 	TArray<class UObject*>                             ReferencedObjects;                                		// 0x0060 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10227,7 +10227,7 @@ public:
 	unsigned long                                      bGameplaySessionInProgress : 1;                   		// 0x00D0 (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10246,7 +10246,7 @@ public:
 	unsigned char                                      AsyncState;                                       		// 0x0094 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10291,7 +10291,7 @@ public:
 	TArray<struct FIdToStringMapping>                  OwnerMappings;                                    		// 0x00B8 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10321,7 +10321,7 @@ public:
 	int                                                VersionNumber;                                    		// 0x00A8 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10347,7 +10347,7 @@ public:
 	TArray<struct FStringIdToStringMapping>            ViewIdMappings;                                   		// 0x0060 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10371,7 +10371,7 @@ public:
 	int                                                TitleId;                                          		// 0x00BC (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10398,7 +10398,7 @@ public:
 	int                                                RatingId;                                         		// 0x00C0 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10450,7 +10450,7 @@ public:
 	float                                              AsyncMinCompletionTime;                           		// 0x0158 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10490,7 +10490,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0100 (0x0008) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10504,7 +10504,7 @@ class UPackageMapSeekFree : public UPackageMapLevel
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10527,7 +10527,7 @@ public:
 	float                                              PP_ShadowsMultiplier;                             		// 0x0088 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10574,7 +10574,7 @@ public:
 	unsigned long                                      bSentSplitJoin : 1;                               		// 0x05E0 (0x0004) [0x0000000000022002] [0x00000008] ( CPF_Const | CPF_Transient | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10610,7 +10610,7 @@ public:
 	unsigned char                                      UnknownData01[ 0x14 ];                            		// 0x6058 (0x0014) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10625,7 +10625,7 @@ public:
 	class UNetConnection*                              Parent;                                           		// 0x606C (0x0008) [0x0000000000202002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10639,7 +10639,7 @@ class UDemoRecConnection : public UNetConnection
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10654,7 +10654,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x18 ];                            		// 0x0060 (0x0018) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10669,7 +10669,7 @@ public:
 	TArray<class UPostProcessEffect*>                  Effects;                                          		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10697,7 +10697,7 @@ public:
 	unsigned char                                      SceneDPG;                                         		// 0x0084 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10738,7 +10738,7 @@ public:
 	unsigned char                                      OcclusionQuality;                                 		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10753,7 +10753,7 @@ public:
 	class UMaterialInstance*                           Material;                                         		// 0x0088 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10768,7 +10768,7 @@ public:
 	int                                                BlurKernelSize;                                   		// 0x0088 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10792,7 +10792,7 @@ public:
 	unsigned char                                      FocusType;                                        		// 0x00B4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10814,7 +10814,7 @@ public:
 	unsigned long                                      bEnableReferenceDOF : 1;                          		// 0x00D0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10833,7 +10833,7 @@ public:
 	unsigned long                                      FullMotionBlur : 1;                               		// 0x00E4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10861,7 +10861,7 @@ public:
 	unsigned char                                      PostProcessAAType;                                		// 0x011C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10876,7 +10876,7 @@ public:
 	class UMaterialInterface*                          Material;                                         		// 0x0088 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10895,7 +10895,7 @@ public:
 	unsigned long                                      FullMotionBlur : 1;                               		// 0x0098 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10917,7 +10917,7 @@ public:
 	unsigned long                                      CastShadow : 1;                                   		// 0x0060 (0x0004) [0x0000000000000001] [0x00000080] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10932,7 +10932,7 @@ public:
 	TArray<class UMaterialInterface*>                  Materials;                                        		// 0x0064 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10947,7 +10947,7 @@ public:
 	class UStaticMesh*                                 StaticMesh;                                       		// 0x0074 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10980,7 +10980,7 @@ public:
 	unsigned char                                      PathColorIndex;                                   		// 0x00C9 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10999,7 +10999,7 @@ class UAdvancedReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11013,7 +11013,7 @@ class UCeilingReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11027,7 +11027,7 @@ class UForcedReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11042,7 +11042,7 @@ public:
 	unsigned char                                      SpecDirection;                                    		// 0x00CC (0x0001) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11056,7 +11056,7 @@ class UFloorToCeilingReachSpec : public UForcedReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11071,7 +11071,7 @@ public:
 	unsigned long                                      bClimbUp : 1;                                     		// 0x00CC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11086,7 +11086,7 @@ public:
 	unsigned char                                      SpecDirection;                                    		// 0x00CC (0x0001) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11101,7 +11101,7 @@ public:
 	unsigned char                                      SpecDirection;                                    		// 0x00CC (0x0001) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11115,7 +11115,7 @@ class UWallTransReachSpec : public UForcedReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11129,7 +11129,7 @@ class ULadderReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11143,7 +11143,7 @@ class UProscribedReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11157,7 +11157,7 @@ class UTeleportReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11173,7 +11173,7 @@ public:
 	struct FGuid                                       m_Guid;                                           		// 0x0070 (0x0010) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11217,7 +11217,7 @@ public:
 	unsigned char                                      RootMotionMode;                                   		// 0x0116 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11245,7 +11245,7 @@ public:
 	struct SFXName                                     BaseLevel;                                        		// 0x0070 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11260,7 +11260,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x2C ];                            		// 0x0060 (0x002C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11274,7 +11274,7 @@ class UServerCommandlet : public UCommandlet
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11294,7 +11294,7 @@ public:
 	struct FScriptDelegate                             __NotifyPropertyValueUpdated__Delegate;           		// 0x00B0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11377,7 +11377,7 @@ public:
 	unsigned long                                      bIsSearchInProgress : 1;                          		// 0x0160 (0x0004) [0x0000000000000002] [0x00000004] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11417,7 +11417,7 @@ public:
 	unsigned char                                      GameState;                                        		// 0x0100 (0x0001) [0x0000000040000002]              ( CPF_Const | CPF_EditInlineNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11433,7 +11433,7 @@ public:
 	unsigned long                                      bTickWhilePaused : 1;                             		// 0x0068 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11450,7 +11450,7 @@ public:
 	unsigned char                                      UnknownData00[ 0xE8 ];                            		// 0x0060 (0x00E8) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11465,7 +11465,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x5C ];                            		// 0x0060 (0x005C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11486,7 +11486,7 @@ public:
 	int                                                InstanceIndex;                                    		// 0x0094 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11500,7 +11500,7 @@ class USmokeTestCommandlet : public UCommandlet
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11524,7 +11524,7 @@ public:
 	unsigned long                                      bInitialised : 1;                                 		// 0x010C (0x0004) [0x0000000000202000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11570,7 +11570,7 @@ public:
 	unsigned char                                      UnknownData04[ 0x48 ];                            		// 0x0148 (0x0048) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11607,7 +11607,7 @@ public:
 	unsigned char                                      SleepFamily;                                      		// 0x0129 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11650,7 +11650,7 @@ public:
 	unsigned char                                      UnknownData02[ 0x2C ];                            		// 0x0244 (0x002C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11699,7 +11699,7 @@ public:
 	unsigned char                                      OcclusionBoundsMethod;                            		// 0x0146 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11726,7 +11726,7 @@ public:
 	TArray<struct FGuid>                               m_lstParentGuids;                                 		// 0x00D0 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11745,7 +11745,7 @@ public:
 	unsigned long                                      ReentrantFlag : 1;                                		// 0x00D4 (0x0004) [0x0000000000002002] [0x00000001] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11794,7 +11794,7 @@ public:
 	unsigned char                                      MipGenSettings;                                   		// 0x00F7 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11843,7 +11843,7 @@ public:
 	unsigned char                                      AddressY;                                         		// 0x01BA (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11860,7 +11860,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x5 ];                             		// 0x01BB (0x0005) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11875,7 +11875,7 @@ public:
 	int                                                ShadowmapFlags;                                   		// 0x01BC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11890,7 +11890,7 @@ public:
 	class UForceFeedbackWaveform*                      TheWaveForm;                                      		// 0x0060 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11908,7 +11908,7 @@ public:
     unsigned char                                      UnknownData01[0x1C4];                           		// 0x01E8 (0x01C4) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11922,7 +11922,7 @@ class UWwiseBaseSoundObject : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11948,7 +11948,7 @@ public:
 	int                                                CurrentPlayCount;                                 		// 0x00F4 (0x0004) [0x0000000000202002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11966,7 +11966,7 @@ public:
 	unsigned long                                      bSplitNavMesh : 1;                                		// 0x02DC (0x0004) [0x0000000000002002] [0x00000001] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11982,7 +11982,7 @@ public:
 	FPointer                                           VfTable_IInterface_NavMeshPathObject;             		// 0x02CC (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12003,7 +12003,7 @@ public:
 	unsigned long                                      bReverseScriptedRoute : 1;                        		// 0x04C0 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12032,7 +12032,7 @@ public:
 	FPointer                                           VfTable_IInterface_NavigationHandle;              		// 0x028C (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12047,7 +12047,7 @@ class ACrowdPopulationManagerBase : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12061,7 +12061,7 @@ class APathTargetPoint : public AKeypoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12078,7 +12078,7 @@ public:
 	unsigned long                                      bPreserveInternalGeo : 1;                         		// 0x0294 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12098,7 +12098,7 @@ public:
 	FPointer                                           VfTable_IInterface_NavMeshPathObject;             		// 0x028C (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12112,7 +12112,7 @@ class UCoverGroupRenderingComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12131,7 +12131,7 @@ public:
 	class UStaticMesh*                                 Disabled;                                         		// 0x02F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12145,7 +12145,7 @@ class UNavMeshRenderingComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12159,7 +12159,7 @@ class UPathRenderingComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12173,7 +12173,7 @@ class URouteRenderingComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12187,7 +12187,7 @@ class UInterface_NavMeshPathObject : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12201,7 +12201,7 @@ class UInterface_NavMeshPathSwitch : public UInterface_NavMeshPathObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12216,7 +12216,7 @@ class UInterface_NavMeshPathObstacle : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12244,7 +12244,7 @@ public:
 	unsigned long                                      bUltraVerbosePathDebugging : 1;                   		// 0x0110 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12293,7 +12293,7 @@ public:
 	float                                              AddedHeuristicCost;                               		// 0x0074 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12310,7 +12310,7 @@ public:
 	struct FVector                                     Direction;                                        		// 0x0078 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12326,7 +12326,7 @@ class UNavMeshPath_EnforceTwoWayEdges : public UNavMeshPathConstraint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12344,7 +12344,7 @@ public:
 	unsigned char                                      EdgeType;                                         		// 0x0088 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12362,7 +12362,7 @@ public:
 	class AActor*                                      GoalActor;                                        		// 0x0084 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12385,7 +12385,7 @@ public:
 	unsigned long                                      bOnlyThrowOutNodesThatLeaveEnvelope : 1;          		// 0x0090 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12404,7 +12404,7 @@ public:
 	unsigned long                                      bSoft : 1;                                        		// 0x0080 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12425,7 +12425,7 @@ public:
 	unsigned long                                      bAlwaysCallEvaluateGoal : 1;                      		// 0x0074 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12446,7 +12446,7 @@ public:
 	unsigned long                                      bKeepPartial : 1;                                 		// 0x0098 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12467,7 +12467,7 @@ public:
 	FPointer                                           CachedAnchorPoly;                                 		// 0x00D0 (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12485,7 +12485,7 @@ public:
 	FPointer                                           PartialGoal;                                      		// 0x0078 (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12502,7 +12502,7 @@ class UNavMeshGoal_PolyEncompassesAI : public UNavMeshPathGoalEvaluator
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12520,7 +12520,7 @@ public:
 	int                                                CacheIdx;                                         		// 0x0068 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12537,7 +12537,7 @@ public:
 	struct FVector                                     Direction;                                        		// 0x006C (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12557,7 +12557,7 @@ public:
 	int                                                MoveFlags;                                        		// 0x0078 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12577,7 +12577,7 @@ public:
 	float                                              MinDistBetweenSpecTypes;                          		// 0x0080 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12594,7 +12594,7 @@ public:
 	class AActor*                                      GoalActor;                                        		// 0x006C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12611,7 +12611,7 @@ public:
 	struct FVector                                     GoalPoint;                                        		// 0x006C (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12633,7 +12633,7 @@ public:
 	unsigned long                                      bOnlyThrowOutNodesThatLeaveEnvelope : 1;          		// 0x0084 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12652,7 +12652,7 @@ public:
 	unsigned long                                      bSoft : 1;                                        		// 0x0074 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12673,7 +12673,7 @@ public:
 	unsigned long                                      AllowStartNodeToBeGoal : 1;                       		// 0x0078 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12692,7 +12692,7 @@ public:
 	unsigned long                                      bKeepPartial : 1;                                 		// 0x0088 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12708,7 +12708,7 @@ class UGoal_Null : public UPathGoalEvaluator
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12734,7 +12734,7 @@ public:
 	unsigned long                                      bShouldDoAnimNotifies : 1;                        		// 0x02D4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12777,7 +12777,7 @@ public:
 	TArray<struct FSkelMaterialSetterDatum>            NonExtremeContent;                                		// 0x02E8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12793,7 +12793,7 @@ class ASkeletalMeshActorSpawnable : public ASkeletalMeshActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12807,7 +12807,7 @@ class ASkeletalMeshCinematicActor : public ASkeletalMeshActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12822,7 +12822,7 @@ public:
 	TArray<class UAnimNodeSlot*>                       SlotNodes;                                        		// 0x02D8 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12852,7 +12852,7 @@ public:
 	unsigned char                                      RotationCompressionFormat;                        		// 0x0075 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12866,7 +12866,7 @@ class UAnimationCompressionAlgorithm_BitwiseCompressOnly : public UAnimationComp
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12882,7 +12882,7 @@ public:
 	unsigned long                                      bStartAtSecondKey : 1;                            		// 0x007C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12902,7 +12902,7 @@ public:
 	unsigned long                                      bRetarget : 1;                                    		// 0x008C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12918,7 +12918,7 @@ public:
 	float                                              MaxAngleDiff;                                     		// 0x007C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12932,7 +12932,7 @@ class UAnimationCompressionAlgorithm_RevertToRaw : public UAnimationCompressionA
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12946,7 +12946,7 @@ class UAnimMetaData : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12962,7 +12962,7 @@ public:
 	unsigned long                                      bFullControlOverController : 1;                   		// 0x0070 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12977,7 +12977,7 @@ public:
 	TArray<struct FTimeModifier>                       KeyFrames;                                        		// 0x0074 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12991,7 +12991,7 @@ class UAnimNotify : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13007,7 +13007,7 @@ public:
 	class UClass*                                      CameraLensEffect;                                 		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13022,7 +13022,7 @@ public:
 	int                                                FootDown;                                         		// 0x0060 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13037,7 +13037,7 @@ public:
 	struct SFXName                                     NotifyName;                                       		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13057,7 +13057,7 @@ public:
 	unsigned long                                      bSkipIfOwnerIsHidden : 1;                         		// 0x0078 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13075,7 +13075,7 @@ public:
 	unsigned long                                      bCheckForBasedPlayer : 1;                         		// 0x0074 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13092,7 +13092,7 @@ public:
 	struct SFXName                                     NotifyEndName;                                    		// 0x0070 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13106,7 +13106,7 @@ class UAnimNotify_Scripted : public UAnimNotify
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13133,7 +13133,7 @@ public:
 	unsigned long                                      bUseBoneLocation : 1;                             		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13153,7 +13153,7 @@ public:
 	unsigned long                                      bIgnoreIfActorHidden : 1;                         		// 0x0074 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13181,7 +13181,7 @@ public:
 	unsigned long                                      bResampleRequired : 1;                            		// 0x00AC (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13197,7 +13197,7 @@ public:
 	class USkeletalMeshComponent*                      SkelComponent;                                    		// 0x0060 (0x0008) [0x000000000408200A]              ( CPF_Const | CPF_ExportObject | CPF_Transient | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13228,7 +13228,7 @@ public:
 	unsigned char                                      CachedNumDesiredBones;                            		// 0x00E4 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13252,7 +13252,7 @@ public:
 	unsigned char                                      BlendTypeAlpha;                                   		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13272,7 +13272,7 @@ public:
 	unsigned char                                      RotationBlendType;                                		// 0x0118 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13301,7 +13301,7 @@ public:
 	unsigned char                                      ForcedAimDir;                                     		// 0x0164 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13321,7 +13321,7 @@ public:
 	unsigned long                                      bSkipBlendWhenNotRendered : 1;                    		// 0x010C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13337,7 +13337,7 @@ public:
 	unsigned long                                      bPassThroughWhenNotRendered : 1;                  		// 0x0110 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13355,7 +13355,7 @@ public:
 	unsigned long                                      bForceLocalSpaceBlend : 1;                        		// 0x0140 (0x0004) [0x0000000000000003] [0x00000001] ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13372,7 +13372,7 @@ public:
 	unsigned long                                      bDontBlendOutOneShot : 1;                         		// 0x011C (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13392,7 +13392,7 @@ public:
 	unsigned long                                      bIsPlayingCustomAnim : 1;                         		// 0x0114 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13417,7 +13417,7 @@ public:
 	int                                                SingleAnimAtOrAboveLOD;                           		// 0x0114 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13437,7 +13437,7 @@ public:
 	unsigned long                                      bSkipBlendWhenNotRendered : 1;                    		// 0x0118 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13457,7 +13457,7 @@ public:
 	unsigned char                                      Type;                                             		// 0x0138 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13471,7 +13471,7 @@ class UAnimNodeBlendByPhysics : public UAnimNodeBlendList
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13485,7 +13485,7 @@ class UAnimNodeBlendByPosture : public UAnimNodeBlendList
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13511,7 +13511,7 @@ public:
 	unsigned long                                      bSynchronizeNodesInEditor : 1;                    		// 0x0150 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13535,7 +13535,7 @@ public:
 	unsigned long                                      bUseAcceleration : 1;                             		// 0x014C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13552,7 +13552,7 @@ public:
 	int                                                PendingChildIndex;                                		// 0x0134 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13568,7 +13568,7 @@ public:
 	TArray<unsigned char>                              SourceRequiredBones;                              		// 0x0110 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13584,7 +13584,7 @@ public:
 	unsigned long                                      bEnableMirroring : 1;                             		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13599,7 +13599,7 @@ public:
 	float                                              ScaleByValue;                                     		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13614,7 +13614,7 @@ public:
 	float                                              BaseSpeed;                                        		// 0x0104 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13638,7 +13638,7 @@ public:
 	unsigned long                                      bAdditiveAnimationsOverrideSource : 1;            		// 0x0128 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13664,7 +13664,7 @@ public:
 	TArray<struct FSynchGroup>                         Groups;                                           		// 0x0100 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13691,7 +13691,7 @@ public:
 	unsigned long                                      bUseSavedPose : 1;                                		// 0x0160 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13749,7 +13749,7 @@ public:
 	unsigned char                                      RootRotationOption[ 0x3 ];                        		// 0x0137 (0x0003) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13776,7 +13776,7 @@ public:
 	TArray<struct FAnimBlendInfo>                      Anims;                                            		// 0x013C (0x0010) [0x0000000004400049]              ( CPF_Edit | CPF_ExportObject | CPF_EditConstArray | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13804,7 +13804,7 @@ public:
 	struct SFXName                                     AnimName_RD;                                      		// 0x01B4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13821,7 +13821,7 @@ public:
 	unsigned long                                      bDrawSlider : 1;                                  		// 0x0070 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13838,7 +13838,7 @@ public:
 	TArray<float>                                      Weights;                                          		// 0x0094 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13858,7 +13858,7 @@ public:
 	float                                              Weight;                                           		// 0x0084 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13874,7 +13874,7 @@ public:
 	TArray<struct FMorphNodeConn>                      NodeConns;                                        		// 0x0074 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13889,7 +13889,7 @@ public:
 	float                                              NodeWeight;                                       		// 0x0084 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13917,7 +13917,7 @@ public:
 	unsigned char                                      AngleBoneAxis;                                    		// 0x00C5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13941,7 +13941,7 @@ public:
 	unsigned char                                      BoneAxis;                                         		// 0x00BC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13977,7 +13977,7 @@ public:
 	unsigned char                                      BlendType;                                        		// 0x00D0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14006,7 +14006,7 @@ public:
 	unsigned char                                      EffectorLocationSpace;                            		// 0x011C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14022,7 +14022,7 @@ public:
 	float                                              TwistAngleScale;                                  		// 0x00DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14051,7 +14051,7 @@ public:
 	unsigned char                                      JointAxis;                                        		// 0x0113 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14074,7 +14074,7 @@ public:
 	unsigned char                                      FootUpAxis;                                       		// 0x0134 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14118,7 +14118,7 @@ public:
 	unsigned char                                      AllowRotationSpace;                               		// 0x0147 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14147,7 +14147,7 @@ public:
 	unsigned char                                      BoneRotationSpace;                                		// 0x0101 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14166,7 +14166,7 @@ public:
 	unsigned char                                      HandlebarRotateAxis;                              		// 0x0115 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14188,7 +14188,7 @@ public:
 	unsigned char                                      WheelSteeringAxis;                                		// 0x0119 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14208,7 +14208,7 @@ public:
 	unsigned char                                      BoneRotMode;                                      		// 0x00E5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14235,7 +14235,7 @@ public:
 	unsigned char                                      ChainBoneAxis;                                    		// 0x0150 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14278,7 +14278,7 @@ public:
 	unsigned char                                      KeyEncodingFormat;                                		// 0x0172 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14296,7 +14296,7 @@ public:
 	class UBioAnimSetData*                             m_pBioAnimSetData;                                		// 0x0078 (0x0008) [0x0000000004020001]              ( CPF_Edit | CPF_EditConst | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14313,7 +14313,7 @@ public:
 	struct SFXName                                     m_nmOrigSetName;                                  		// 0x00D0 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14332,7 +14332,7 @@ public:
 	unsigned long                                      bAnimRotationOnly : 1;                            		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14352,7 +14352,7 @@ public:
 	TArray<int>                                        OffsetSkeleton_dep;                               		// 0x0094 (0x0010) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14368,7 +14368,7 @@ public:
 	class USkeletalMesh*                               BaseSkelMesh;                                     		// 0x0070 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14383,7 +14383,7 @@ class UMorphWeightSequence : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14398,7 +14398,7 @@ public:
 	class UDecalComponent*                             Decal;                                            		// 0x028C (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14412,7 +14412,7 @@ class ADecalActor : public ADecalActorBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14426,7 +14426,7 @@ class ADecalActorMovable : public ADecalActorBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14447,7 +14447,7 @@ public:
 	float                                              DecalDepthBias;                                   		// 0x02C4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14519,7 +14519,7 @@ public:
 	unsigned char                                      FilterMode;                                       		// 0x0371 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14537,7 +14537,7 @@ public:
 	class UMaterialInterface*                          DecalMaterial;                                    		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14551,7 +14551,7 @@ class UDecalMaterial : public UMaterial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14568,7 +14568,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x029C (0x0004) [0x0000000100000020] [0x00000001] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14588,7 +14588,7 @@ class AFogVolumeConeDensityInfo : public AFogVolumeDensityInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14602,7 +14602,7 @@ class AFogVolumeConstantDensityInfo : public AFogVolumeDensityInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14616,7 +14616,7 @@ class AFogVolumeLinearHalfspaceDensityInfo : public AFogVolumeDensityInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14630,7 +14630,7 @@ class AFogVolumeSphericalDensityInfo : public AFogVolumeDensityInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14652,7 +14652,7 @@ public:
 	unsigned long                                      bAffectsTranslucency : 1;                         		// 0x00CC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14673,7 +14673,7 @@ public:
 	float                                              ConeMaxAngle;                                     		// 0x00F8 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14688,7 +14688,7 @@ public:
 	float                                              Density;                                          		// 0x00D0 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14704,7 +14704,7 @@ public:
 	float                                              PlaneDistanceFactor;                              		// 0x00E0 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14722,7 +14722,7 @@ public:
 	float                                              SphereRadius;                                     		// 0x00E8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14738,7 +14738,7 @@ public:
 	unsigned long                                      bNothingSelected : 1;                             		// 0x0094 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14752,7 +14752,7 @@ class UActorFactoryFogVolumeLinearHalfspaceDensityInfo : public UActorFactoryFog
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14766,7 +14766,7 @@ class UActorFactoryFogVolumeSphericalDensityInfo : public UActorFactoryFogVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14782,7 +14782,7 @@ public:
 	class UApexStaticDestructibleComponent*            StaticDestructibleComponent;                      		// 0x029C (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14814,7 +14814,7 @@ public:
 	unsigned long                                      bBreakChunksOnActorTouch : 1;                     		// 0x031C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14856,7 +14856,7 @@ public:
 	unsigned char                                      AsleepRBChannel;                                  		// 0x0350 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14894,7 +14894,7 @@ public:
 	unsigned char                                      NumPartsRemaining;                                		// 0x03D4 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14927,7 +14927,7 @@ public:
 	unsigned long                                      bEnableSpawnChunkEffectForRadialDamage : 1;       		// 0x02CC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14965,7 +14965,7 @@ public:
 	unsigned char                                      NumMeshesRemaining;                               		// 0x02D4 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14986,7 +14986,7 @@ public:
 	unsigned long                                      bAssetChanged : 1;                                		// 0x0274 (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15001,7 +15001,7 @@ public:
 	FPointer                                           ComponentDynamicResources;                        		// 0x0278 (0x0008) [0x0000000000003002]              ( CPF_Const | CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15015,7 +15015,7 @@ class UApexStaticComponent : public UApexComponentBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15031,7 +15031,7 @@ public:
 	FPointer                                           ApexDestructiblePreview;                          		// 0x0280 (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15056,7 +15056,7 @@ public:
 	unsigned long                                      bUseDynamicIBWithHiddenFragments : 1;             		// 0x02F4 (0x0004) [0x0000000000000002] [0x00000010] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15080,7 +15080,7 @@ public:
 	unsigned long                                      bFragmentTransformsChanged : 1;                   		// 0x0320 (0x0004) [0x0000000000002002] [0x00000002] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15105,7 +15105,7 @@ public:
 	unsigned long                                      bBottomFragmentsRootNonDestroyable : 1;           		// 0x0340 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15135,7 +15135,7 @@ public:
 	int                                                InstancingRandomSeed;                             		// 0x02F4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15152,7 +15152,7 @@ public:
 	unsigned long                                      bSmoothInterpRollScale : 1;                       		// 0x0330 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15170,7 +15170,7 @@ public:
 	class URB_BodySetup*                               DetailedCollision;                                		// 0x0258 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15185,7 +15185,7 @@ public:
 	TArray<class UApexComponentBase*>                  ApexComponents;                                   		// 0x0060 (0x0010) [0x000000000408300A]              ( CPF_Const | CPF_ExportObject | CPF_Native | CPF_Transient | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15211,7 +15211,7 @@ public:
 	unsigned long                                      bSlowStart : 1;                                   		// 0x0098 (0x0004) [0x0000000004000003] [0x00000004] ( CPF_Edit | CPF_Const | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15231,7 +15231,7 @@ public:
 	unsigned long                                      bDynamic : 1;                                     		// 0x0128 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15246,7 +15246,7 @@ public:
 	FPointer                                           MApexAsset;                                       		// 0x0070 (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15264,7 +15264,7 @@ public:
 	class UFracturedStaticMesh*                        FracturedStaticMesh;                              		// 0x00BC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15282,7 +15282,7 @@ public:
 	int                                                MaxDepth;                                         		// 0x0090 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15313,7 +15313,7 @@ public:
 	int                                                SupportDepth;                                     		// 0x0128 (0x0004) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15333,7 +15333,7 @@ public:
 	FString                                            Caption;                                          		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15347,7 +15347,7 @@ class UInterpFilter_Classes : public UInterpFilter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15361,7 +15361,7 @@ class UInterpFilter_Custom : public UInterpFilter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15387,7 +15387,7 @@ public:
 	int                                                BioForcedLodModel;                                		// 0x0098 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15404,7 +15404,7 @@ public:
 	unsigned long                                      AllowDeferredActorAttach : 1;                     		// 0x00AC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15418,7 +15418,7 @@ class UInterpGroupDirector : public UInterpGroup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15435,7 +15435,7 @@ public:
 	class AActor*                                      GroupActor;                                       		// 0x0078 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15451,7 +15451,7 @@ public:
 	unsigned char                                      SavedPhysics;                                     		// 0x0088 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15465,7 +15465,7 @@ class UInterpGroupInstDirector : public UInterpGroupInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15482,7 +15482,7 @@ public:
 	int                                                m_nNextKey;                                       		// 0x00A4 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15503,7 +15503,7 @@ public:
 	unsigned long                                      bSimulateCameraCutsOnClients : 1;                 		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15521,7 +15521,7 @@ public:
 	unsigned long                                      bFireEventsWhenJumpingForwards : 1;               		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15545,7 +15545,7 @@ public:
 	unsigned long                                      bOverrideDirty : 1;                               		// 0x0130 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15561,7 +15561,7 @@ public:
 	float                                              CurveTension;                                     		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15578,7 +15578,7 @@ public:
 	struct SFXName                                     SlotName;                                         		// 0x00C8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15593,7 +15593,7 @@ public:
 	unsigned long                                      bPersistFade : 1;                                 		// 0x00A8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15609,7 +15609,7 @@ public:
 	struct SFXName                                     ParamName;                                        		// 0x00B8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15624,7 +15624,7 @@ public:
 	struct SFXName                                     ParamName;                                        		// 0x00A8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15639,7 +15639,7 @@ public:
 	struct SFXName                                     PropertyName;                                     		// 0x00A8 (0x0008) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15654,7 +15654,7 @@ public:
 	struct SFXName                                     MorphNodeName;                                    		// 0x00A8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15669,7 +15669,7 @@ public:
 	struct SFXName                                     SkelControlName;                                  		// 0x00A8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15683,7 +15683,7 @@ class UInterpTrackSlomo : public UInterpTrackFloatBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15699,7 +15699,7 @@ public:
 	float                                              CurveTension;                                     		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15714,7 +15714,7 @@ public:
 	struct SFXName                                     PropertyName;                                     		// 0x00A8 (0x0008) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15742,7 +15742,7 @@ public:
 	unsigned char                                      RotMode;                                          		// 0x00DD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15757,7 +15757,7 @@ public:
 	TArray<struct FParticleReplayTrackKey>             TrackKeys;                                        		// 0x0090 (0x0010) [0x0000000004400000]              ( CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15776,7 +15776,7 @@ public:
 	unsigned long                                      bFireEventsWhenJumpingForwards : 1;               		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15792,7 +15792,7 @@ public:
 	float                                              CurveTension;                                     		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15806,7 +15806,7 @@ class UInterpTrackAudioMaster : public UInterpTrackVectorBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15821,7 +15821,7 @@ public:
 	struct SFXName                                     PropertyName;                                     		// 0x00A8 (0x0008) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15835,7 +15835,7 @@ class UInterpTrackColorScale : public UInterpTrackVectorBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15852,7 +15852,7 @@ public:
 	unsigned long                                      bSuppressSubtitles : 1;                           		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15868,7 +15868,7 @@ public:
 	struct SFXName                                     ParamName;                                        		// 0x00B8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15883,7 +15883,7 @@ public:
 	struct SFXName                                     PropertyName;                                     		// 0x00A8 (0x0008) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15901,7 +15901,7 @@ public:
 	unsigned long                                      bFireEventsWhenJumpingForwards : 1;               		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15915,7 +15915,7 @@ class UInterpTrackInst : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15930,7 +15930,7 @@ public:
 	float                                              m_fLastUpdatePosition;                            		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15946,7 +15946,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0070 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15960,7 +15960,7 @@ class UInterpTrackInstAudioMaster : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15974,7 +15974,7 @@ class UInterpTrackInstColorScale : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15989,7 +15989,7 @@ public:
 	class AActor*                                      OldViewTarget;                                    		// 0x0060 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16004,7 +16004,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16020,7 +16020,7 @@ public:
 	unsigned long                                      bFirstUpdate : 1;                                 		// 0x0064 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16034,7 +16034,7 @@ class UInterpTrackInstFade : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16049,7 +16049,7 @@ public:
 	TArray<float>                                      ResetFloats;                                      		// 0x0060 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16064,7 +16064,7 @@ public:
 	float                                              ResetFloat;                                       		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16078,7 +16078,7 @@ class UInterpTrackInstMorphWeight : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16097,7 +16097,7 @@ public:
 	unsigned char                                      m_nSavedPhysicsMode;                              		// 0x00C8 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16112,7 +16112,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16128,7 +16128,7 @@ public:
 	class UObject*                                     PropertyOuterObjectInst;                          		// 0x0068 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16144,7 +16144,7 @@ public:
 	struct FColor                                      ResetColor;                                       		// 0x0078 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16160,7 +16160,7 @@ public:
 	float                                              ResetFloat;                                       		// 0x0078 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16176,7 +16176,7 @@ public:
 	struct FLinearColor                                ResetColor;                                       		// 0x0078 (0x0010) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16192,7 +16192,7 @@ public:
 	struct FVector                                     ResetVector;                                      		// 0x0078 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16206,7 +16206,7 @@ class UInterpTrackInstSkelControlScale : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16221,7 +16221,7 @@ public:
 	float                                              OldTimeDilation;                                  		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16237,7 +16237,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0068 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16254,7 +16254,7 @@ public:
 	unsigned char                                      Action;                                           		// 0x0068 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16269,7 +16269,7 @@ public:
 	TArray<struct FVector>                             ResetVectors;                                     		// 0x0060 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16285,7 +16285,7 @@ public:
 	unsigned char                                      Action;                                           		// 0x0064 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16301,7 +16301,7 @@ public:
 	unsigned char                                      BaseProperty;                                     		// 0x0074 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16316,7 +16316,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x006C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16332,7 +16332,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x008C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16348,7 +16348,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x008C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16366,7 +16366,7 @@ public:
 	float                                              ReferencePlane;                                   		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16380,7 +16380,7 @@ class UMaterialExpressionCameraVector : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16394,7 +16394,7 @@ class UMaterialExpressionCameraWorldPosition : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16409,7 +16409,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x006C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16426,7 +16426,7 @@ public:
 	struct FExpressionInput                            Max;                                              		// 0x00AC (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16445,7 +16445,7 @@ public:
 	int                                                SizeY;                                            		// 0x0088 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16464,7 +16464,7 @@ public:
 	unsigned long                                      A : 1;                                            		// 0x008C (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16481,7 +16481,7 @@ public:
 	unsigned long                                      bExpanded : 1;                                    		// 0x008C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16496,7 +16496,7 @@ public:
 	float                                              R;                                                		// 0x006C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16512,7 +16512,7 @@ public:
 	float                                              G;                                                		// 0x0070 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16529,7 +16529,7 @@ public:
 	float                                              B;                                                		// 0x0074 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16547,7 +16547,7 @@ public:
 	float                                              A;                                                		// 0x0078 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16564,7 +16564,7 @@ public:
 	float                                              Scale;                                            		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16581,7 +16581,7 @@ public:
 	float                                              Max;                                              		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16597,7 +16597,7 @@ public:
 	float                                              Period;                                           		// 0x008C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16613,7 +16613,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x008C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16631,7 +16631,7 @@ public:
 	unsigned char                                      OutputType;                                       		// 0x009C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16646,7 +16646,7 @@ public:
 	class UTexture*                                    Texture;                                          		// 0x006C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16664,7 +16664,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16683,7 +16683,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x00D0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16698,7 +16698,7 @@ public:
 	struct FExpressionInput                            InXY;                                             		// 0x006C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16715,7 +16715,7 @@ public:
 	struct FLinearColor                                LuminanceFactors;                                 		// 0x00AC (0x0010) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16729,7 +16729,7 @@ class UMaterialExpressionDestColor : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16744,7 +16744,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x006C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16760,7 +16760,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x008C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16776,7 +16776,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x008C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16792,7 +16792,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x008C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16807,7 +16807,7 @@ public:
 	TArray<FString>                                    ParamNames;                                       		// 0x006C (0x0010) [0x0000000000400041]              ( CPF_Edit | CPF_EditConstArray | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16821,7 +16821,7 @@ class UMaterialExpressionMeshEmitterDynamicParameter : public UMaterialExpressio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16836,7 +16836,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x006C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16850,7 +16850,7 @@ class UMaterialExpressionFluidNormal : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16866,7 +16866,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x008C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16880,7 +16880,7 @@ class UMaterialExpressionFoliageImpulseDirection : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16894,7 +16894,7 @@ class UMaterialExpressionFoliageNormalizedRotationAxisAndAngle : public UMateria
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16910,7 +16910,7 @@ public:
 	int                                                FontTexturePage;                                  		// 0x0074 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16926,7 +16926,7 @@ public:
 	struct SFXName                                     ParameterName;                                    		// 0x0088 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16941,7 +16941,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x006C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16957,7 +16957,7 @@ public:
 	float                                              Exponent;                                         		// 0x008C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16976,7 +16976,7 @@ public:
 	struct FExpressionInput                            ALessThanB;                                       		// 0x00EC (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16990,7 +16990,7 @@ class UMaterialExpressionLensFlareIntensity : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17004,7 +17004,7 @@ class UMaterialExpressionLensFlareOcclusion : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17018,7 +17018,7 @@ class UMaterialExpressionLensFlareRadialDistance : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17032,7 +17032,7 @@ class UMaterialExpressionLensFlareRayDistance : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17046,7 +17046,7 @@ class UMaterialExpressionLensFlareSourceDistance : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17060,7 +17060,7 @@ class UMaterialExpressionLightmapUVs : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17076,7 +17076,7 @@ public:
 	struct FExpressionInput                            Lightmass;                                        		// 0x008C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17090,7 +17090,7 @@ class UMaterialExpressionLightVector : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17107,7 +17107,7 @@ public:
 	struct FExpressionInput                            Alpha;                                            		// 0x00AC (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17121,7 +17121,7 @@ class UMaterialExpressionMeshEmitterVertexColor : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17137,7 +17137,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x008C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17152,7 +17152,7 @@ public:
 	struct FExpressionInput                            VectorInput;                                      		// 0x006C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17166,7 +17166,7 @@ class UMaterialExpressionObjectOrientation : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17180,7 +17180,7 @@ class UMaterialExpressionObjectRadius : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17194,7 +17194,7 @@ class UMaterialExpressionObjectWorldPosition : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17208,7 +17208,7 @@ class UMaterialExpressionOcclusionPercentage : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17223,7 +17223,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x006C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17241,7 +17241,7 @@ public:
 	float                                              SpeedY;                                           		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17257,7 +17257,7 @@ public:
 	struct SFXName                                     ParameterName;                                    		// 0x007C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17272,7 +17272,7 @@ public:
 	float                                              DefaultValue;                                     		// 0x0084 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17286,7 +17286,7 @@ class UBioMaterialExpressionEffectMatFractionEnabled : public UMaterialExpressio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17306,7 +17306,7 @@ public:
 	unsigned long                                      DefaultA : 1;                                     		// 0x00AC (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17325,7 +17325,7 @@ public:
 	unsigned long                                      ExtendedCaptionDisplay : 1;                       		// 0x00CC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17340,7 +17340,7 @@ public:
 	struct FLinearColor                                DefaultValue;                                     		// 0x0084 (0x0010) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17355,7 +17355,7 @@ public:
 	unsigned long                                      bUseViewSpace : 1;                                		// 0x006C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17369,7 +17369,7 @@ class UMaterialExpressionPerInstanceRandom : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17384,7 +17384,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x006C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17400,7 +17400,7 @@ public:
 	struct FExpressionInput                            Exponent;                                         		// 0x008C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17414,7 +17414,7 @@ class UMaterialExpressionReflectionVector : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17431,7 +17431,7 @@ public:
 	struct FExpressionInput                            Position;                                         		// 0x00AC (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17450,7 +17450,7 @@ public:
 	float                                              Speed;                                            		// 0x00B4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17466,7 +17466,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x008C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17483,7 +17483,7 @@ public:
 	unsigned char                                      SceneTextureType;                                 		// 0x0090 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17498,7 +17498,7 @@ public:
 	unsigned long                                      ScreenAlign : 1;                                  		// 0x006C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17514,7 +17514,7 @@ public:
 	float                                              Period;                                           		// 0x008C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17532,7 +17532,7 @@ public:
 	float                                              HardnessPercent;                                  		// 0x00B0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17547,7 +17547,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x006C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17563,7 +17563,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x008C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17582,7 +17582,7 @@ public:
 	unsigned long                                      UnMirrorV : 1;                                    		// 0x0078 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17599,7 +17599,7 @@ public:
 	unsigned long                                      bDecompressNormalMap : 1;                         		// 0x0094 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17616,7 +17616,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x00BC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17630,7 +17630,7 @@ class UMaterialExpressionFlipBookSample : public UMaterialExpressionTextureSampl
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17644,7 +17644,7 @@ class UMaterialExpressionMeshSubUV : public UMaterialExpressionTextureSample
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17658,7 +17658,7 @@ class UMaterialExpressionMeshSubUVBlend : public UMaterialExpressionMeshSubUV
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17672,7 +17672,7 @@ class UMaterialExpressionParticleSubUV : public UMaterialExpressionTextureSample
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17688,7 +17688,7 @@ public:
 	struct SFXName                                     ParameterName;                                    		// 0x00A8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17702,7 +17702,7 @@ class UMaterialExpressionTextureSampleParameter2D : public UMaterialExpressionTe
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17718,7 +17718,7 @@ public:
 	unsigned char                                      Channel;                                          		// 0x00B4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17732,7 +17732,7 @@ class UMaterialExpressionTextureSampleParameterMeshSubUV : public UMaterialExpre
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17746,7 +17746,7 @@ class UMaterialExpressionTextureSampleParameterMeshSubUVBlend : public UMaterial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17760,7 +17760,7 @@ class UMaterialExpressionTextureSampleParameterSubUV : public UMaterialExpressio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17774,7 +17774,7 @@ class UMaterialExpressionTextureSampleParameterCube : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17788,7 +17788,7 @@ class UMaterialExpressionTextureSampleParameterMovie : public UMaterialExpressio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17803,7 +17803,7 @@ public:
 	FPointer                                           InstanceOverride;                                 		// 0x00B0 (0x0008) [0x0000000000003002]              ( CPF_Const | CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17818,7 +17818,7 @@ public:
 	unsigned long                                      bIgnorePause : 1;                                 		// 0x006C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17835,7 +17835,7 @@ public:
 	unsigned char                                      TransformType;                                    		// 0x008D (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17851,7 +17851,7 @@ public:
 	unsigned char                                      TransformType;                                    		// 0x008C (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17865,7 +17865,7 @@ class UMaterialExpressionTwoSidedSign : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17879,7 +17879,7 @@ class UMaterialExpressionVertexColor : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17893,7 +17893,7 @@ class UMaterialExpressionWindDirectionAndSpeed : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17907,7 +17907,7 @@ class UMaterialExpressionWorldNormal : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17921,7 +17921,7 @@ class UMaterialExpressionWorldPosition : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17944,7 +17944,7 @@ public:
 	unsigned long                                      ReentrantFlag : 1;                                		// 0x00F4 (0x0004) [0x0000000000001002] [0x00000004] ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17972,7 +17972,7 @@ public:
 	TArray<struct FTextureParameterValue>              TextureParameterValues;                           		// 0x0128 (0x0010) [0x0000000000400003]              ( CPF_Edit | CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17992,7 +17992,7 @@ class UBioMaterialInstanceConstant : public UMaterialInstanceConstant
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18012,7 +18012,7 @@ public:
 	unsigned long                                      bAutoActivateAll : 1;                             		// 0x013C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18044,7 +18044,7 @@ public:
 	unsigned long                                      bAllowMultipleInstances : 1;                      		// 0x02C0 (0x0004) [0x0000008000000003] [0x00000001] ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18066,7 +18066,7 @@ public:
 	class UParticleSystem*                             ParticleTemplate;                                 		// 0x02A8 (0x0008) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18084,7 +18084,7 @@ class AParticleEventManager : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18150,7 +18150,7 @@ public:
 	unsigned char                                      ReplayState;                                      		// 0x0359 (0x0001) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18206,7 +18206,7 @@ class UDistributionFloatParticleParameter : public UDistributionFloatParameterBa
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18220,7 +18220,7 @@ class UDistributionVectorParticleParameter : public UDistributionVectorParameter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18244,7 +18244,7 @@ public:
 	unsigned char                                      EmitterRenderMode;                                		// 0x0098 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18258,7 +18258,7 @@ class UParticleSpriteEmitter : public UParticleEmitter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18287,7 +18287,7 @@ public:
 	unsigned long                                      ConvertedModules : 1;                             		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18312,7 +18312,7 @@ public:
 	unsigned char                                      LODValidity;                                      		// 0x0064 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18327,7 +18327,7 @@ public:
 	unsigned long                                      bAlwaysInWorldSpace : 1;                          		// 0x0068 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18343,7 +18343,7 @@ public:
 	unsigned long                                      bApplyOwnerScale : 1;                             		// 0x0098 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18358,7 +18358,7 @@ public:
 	struct FBioRawDistributionRwVector3                AccelOverLifeRw;                                  		// 0x006C (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18372,7 +18372,7 @@ class UParticleModuleAttractorBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18390,7 +18390,7 @@ public:
 	struct FVector                                     EndPoint1;                                        		// 0x00BC (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18413,7 +18413,7 @@ public:
 	unsigned char                                      SelectionMethod;                                  		// 0x00C0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18434,7 +18434,7 @@ public:
 	unsigned long                                      bUseWorldSpacePosition : 1;                       		// 0x00DC (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18448,7 +18448,7 @@ class UParticleModuleBeamBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18470,7 +18470,7 @@ public:
 	unsigned char                                      ModifierType;                                     		// 0x00F4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18504,7 +18504,7 @@ public:
 	unsigned long                                      bApplyNoiseScale : 1;                             		// 0x0148 (0x0004) [0x0000000000000001] [0x00000080] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18528,7 +18528,7 @@ public:
 	unsigned char                                      SourceTangentMethod;                              		// 0x00F1 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18553,7 +18553,7 @@ public:
 	unsigned char                                      TargetTangentMethod;                              		// 0x00F5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18567,7 +18567,7 @@ class UParticleModuleCollisionBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18594,7 +18594,7 @@ public:
 	unsigned char                                      CollisionCompletionOption;                        		// 0x0138 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18608,7 +18608,7 @@ class UParticleModuleColorBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18625,7 +18625,7 @@ public:
 	unsigned long                                      bClampAlpha : 1;                                  		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18641,7 +18641,7 @@ public:
 	struct FColor                                      DefaultColor;                                     		// 0x0070 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18658,7 +18658,7 @@ public:
 	unsigned long                                      bClampAlpha : 1;                                  		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18675,7 +18675,7 @@ public:
 	unsigned long                                      bEmitterTime : 1;                                 		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18689,7 +18689,7 @@ class UParticleModuleEventBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18704,7 +18704,7 @@ public:
 	TArray<struct FParticleEvent_GenerateInfo>         Events;                                           		// 0x0068 (0x0010) [0x0000000002400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18720,7 +18720,7 @@ public:
 	unsigned char                                      EventGeneratorType;                               		// 0x0070 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18735,7 +18735,7 @@ public:
 	unsigned long                                      bStopSpawning : 1;                                		// 0x0074 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18754,7 +18754,7 @@ public:
 	unsigned long                                      bInheritVelocity : 1;                             		// 0x00C4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18768,7 +18768,7 @@ class UParticleModuleKillBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18786,7 +18786,7 @@ public:
 	unsigned long                                      bKillInside : 1;                                  		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18803,7 +18803,7 @@ public:
 	unsigned long                                      bFloor : 1;                                       		// 0x008C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18817,7 +18817,7 @@ class UParticleModuleLifetimeBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18832,7 +18832,7 @@ public:
 	struct FRawDistributionFloat                       Lifetime;                                         		// 0x0068 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18849,7 +18849,7 @@ public:
 	unsigned long                                      m_bUpdateSeed : 1;                                		// 0x0070 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18864,7 +18864,7 @@ public:
 	struct FBioRawDistributionRwVector3                StartLocationRw;                                  		// 0x0074 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18882,7 +18882,7 @@ public:
 	struct FBioRawDistributionRwVector3                DirectionRw;                                      		// 0x00F8 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18902,7 +18902,7 @@ public:
 	unsigned char                                      SelectionMethod;                                  		// 0x0088 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18917,7 +18917,7 @@ public:
 	struct SFXName                                     EmitterName;                                      		// 0x0074 (0x0008) [0x0000000002000009]              ( CPF_Edit | CPF_ExportObject | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18941,7 +18941,7 @@ public:
 	unsigned long                                      Velocity : 1;                                     		// 0x00C4 (0x0004) [0x0000000000000001] [0x00000080] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18959,7 +18959,7 @@ public:
 	unsigned char                                      HeightAxis;                                       		// 0x0114 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18974,7 +18974,7 @@ public:
 	struct FRawDistributionFloat                       StartRadius;                                      		// 0x00C8 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18989,7 +18989,7 @@ public:
 	struct FBioRawDistributionRwVector3                SourceMovementScaleRw;                            		// 0x0074 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19003,7 +19003,7 @@ class UParticleModuleMaterialBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19019,7 +19019,7 @@ public:
 	TArray<class UMaterialInterface*>                  DefaultMaterials;                                 		// 0x0078 (0x0010) [0x0000000000400041]              ( CPF_Edit | CPF_EditConstArray | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19034,7 +19034,7 @@ public:
 	TArray<class UMaterialInterface*>                  MeshMaterials;                                    		// 0x0068 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19049,7 +19049,7 @@ public:
 	unsigned long                                      bUseEmitterTime : 1;                              		// 0x0068 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19070,7 +19070,7 @@ public:
 	unsigned char                                      ChainMode;                                        		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19084,7 +19084,7 @@ class UParticleModuleOrientationBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19099,7 +19099,7 @@ public:
 	unsigned char                                      LockAxisFlags;                                    		// 0x0068 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19113,7 +19113,7 @@ class UParticleModuleParameterBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19128,7 +19128,7 @@ public:
 	TArray<struct FEmitterDynamicParameter>            DynamicParams;                                    		// 0x0068 (0x0010) [0x0000000000480041]              ( CPF_Edit | CPF_EditConstArray | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19174,7 +19174,7 @@ public:
 	unsigned char                                      EmitterNormalsMode;                               		// 0x00F0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19188,7 +19188,7 @@ class UParticleModuleRotationBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19204,7 +19204,7 @@ public:
 	unsigned long                                      bInheritParent : 1;                               		// 0x0094 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19219,7 +19219,7 @@ public:
 	struct FRawDistributionFloat                       StartRotation;                                    		// 0x0068 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19235,7 +19235,7 @@ public:
 	unsigned long                                      Scale : 1;                                        		// 0x008C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19249,7 +19249,7 @@ class UParticleModuleRotationRateBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19264,7 +19264,7 @@ public:
 	struct FBioRawDistributionRwVector3                StartRotationRateRw;                              		// 0x0068 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19279,7 +19279,7 @@ public:
 	struct FBioRawDistributionRwVector3                LifeMultiplierRw;                                 		// 0x0068 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19294,7 +19294,7 @@ public:
 	struct FRawDistributionFloat                       StartRotationRate;                                		// 0x0068 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19309,7 +19309,7 @@ public:
 	struct FRawDistributionFloat                       LifeMultiplier;                                   		// 0x0068 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19323,7 +19323,7 @@ class UParticleModuleSizeBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19338,7 +19338,7 @@ public:
 	struct FBioRawDistributionRwVector3                StartSizeRw;                                      		// 0x0068 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19356,7 +19356,7 @@ public:
 	unsigned long                                      MultiplyZ : 1;                                    		// 0x0094 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19374,7 +19374,7 @@ public:
 	unsigned long                                      MultiplyZ : 1;                                    		// 0x0094 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19392,7 +19392,7 @@ public:
 	unsigned long                                      EnableZ : 1;                                      		// 0x0094 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19410,7 +19410,7 @@ public:
 	unsigned long                                      bEnableZ : 1;                                     		// 0x0094 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19426,7 +19426,7 @@ public:
 	unsigned long                                      bProcessBurstList : 1;                            		// 0x0068 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19444,7 +19444,7 @@ public:
 	unsigned char                                      ParticleBurstMethod;                              		// 0x00C4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19462,7 +19462,7 @@ public:
 	unsigned long                                      bIgnoreSpawnRateWhenMoving : 1;                   		// 0x0098 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19476,7 +19476,7 @@ class UParticleModuleStoreSpawnTimeBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19490,7 +19490,7 @@ class UParticleModuleStoreSpawnTime : public UParticleModuleStoreSpawnTimeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19504,7 +19504,7 @@ class UParticleModuleSubUVBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19519,7 +19519,7 @@ public:
 	struct FRawDistributionFloat                       SubImageIndex;                                    		// 0x0068 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19536,7 +19536,7 @@ public:
 	unsigned long                                      bUseEmitterTime : 1;                              		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19552,7 +19552,7 @@ public:
 	struct FBioRawDistributionRwVector3                SubUVSizeRw;                                      		// 0x0094 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19567,7 +19567,7 @@ public:
 	struct FBioRawDistributionRwVector3                SubImageSelectRw;                                 		// 0x0068 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19581,7 +19581,7 @@ class UParticleModuleTrailBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19603,7 +19603,7 @@ public:
 	unsigned char                                      SelectionMethod;                                  		// 0x00AD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19619,7 +19619,7 @@ public:
 	float                                              MinSpawnVelocity;                                 		// 0x0070 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19635,7 +19635,7 @@ public:
 	unsigned char                                      TaperMethod;                                      		// 0x008C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19649,7 +19649,7 @@ class UParticleModuleTypeDataBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19676,7 +19676,7 @@ public:
 	unsigned long                                      bRenderTessellation : 1;                          		// 0x0080 (0x0004) [0x0000000000000001] [0x00000080] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19703,7 +19703,7 @@ public:
 	unsigned char                                      EndPointMethod;                                   		// 0x0139 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19735,7 +19735,7 @@ public:
 	unsigned char                                      TaperMethod;                                      		// 0x00FD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19761,7 +19761,7 @@ public:
 	unsigned char                                      CameraFacingOption;                               		// 0x0082 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19780,7 +19780,7 @@ public:
 	unsigned char                                      PhysXRotationMethod;                              		// 0x00A8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19796,7 +19796,7 @@ public:
 	class UPhysXParticleSystem*                        PhysXParSys;                                      		// 0x0078 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19827,7 +19827,7 @@ public:
 	unsigned char                                      RenderAxis;                                       		// 0x008C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19849,7 +19849,7 @@ public:
 	unsigned long                                      SpawnByDistance : 1;                              		// 0x009C (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19875,7 +19875,7 @@ public:
 	unsigned long                                      RenderTessellation : 1;                           		// 0x0084 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19890,7 +19890,7 @@ public:
 	TArray<struct SFXName>                             RequiredModules;                                  		// 0x0068 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19910,7 +19910,7 @@ public:
 	struct FRawDistributionFloat                       AlphaOverLife;                                    		// 0x012C (0x0024) [0x0000000002480009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_NeedCtorLink | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19931,7 +19931,7 @@ public:
 	struct FRawDistributionVector                      StartLocation;                                    		// 0x0150 (0x0024) [0x0000000002480009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_NeedCtorLink | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19958,7 +19958,7 @@ public:
 	unsigned long                                      SizeMultiplyZ : 1;                                		// 0x01E0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19999,7 +19999,7 @@ public:
 	unsigned char                                      PC_HeightAxis;                                    		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20038,7 +20038,7 @@ public:
 	unsigned char                                      PC_HeightAxis;                                    		// 0x01E4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20062,7 +20062,7 @@ public:
 	unsigned long                                      MultiplyZ : 1;                                    		// 0x0150 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20085,7 +20085,7 @@ public:
 	unsigned long                                      MultiplyZ : 1;                                    		// 0x0150 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20100,7 +20100,7 @@ public:
 	unsigned long                                      bInWorldSpace : 1;                                		// 0x0068 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20116,7 +20116,7 @@ public:
 	struct FRawDistributionFloat                       StartVelocityRadial;                              		// 0x0098 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20131,7 +20131,7 @@ public:
 	struct FBioRawDistributionRwVector3                ScaleRw;                                          		// 0x006C (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20147,7 +20147,7 @@ public:
 	unsigned long                                      Absolute : 1;                                     		// 0x0098 (0x0004) [0x0000000000000009] [0x00000001] ( CPF_Edit | CPF_ExportObject )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20161,7 +20161,7 @@ class UParticleModuleEventSendToGame : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20178,7 +20178,7 @@ public:
 	int                                                ClipIDNumber;                                     		// 0x0070 (0x0004) [0x0000000000001001]              ( CPF_Edit | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20220,7 +20220,7 @@ public:
 	unsigned char                                      PacketSizeMultiplier;                             		// 0x00BE (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20260,7 +20260,7 @@ public:
 	unsigned long                                      bDisableClientSidePawnInteractions : 1;           		// 0x03B4 (0x0004) [0x0000000000000000] [0x00000080] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20290,7 +20290,7 @@ public:
 	float                                              MaxImpulseSpeed;                                  		// 0x03C0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20314,7 +20314,7 @@ public:
 	unsigned long                                      bScalingToZero : 1;                               		// 0x03B8 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20338,7 +20338,7 @@ public:
 	unsigned long                                      bBlockPawns : 1;                                  		// 0x02A4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20555,7 +20555,7 @@ public:
 	unsigned char                                      PreStasisPhysicsState;                            		// 0x05EC (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20859,7 +20859,7 @@ public:
 	unsigned char                                      StuckCount;                                       		// 0x066C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20983,7 +20983,7 @@ public:
 	unsigned long                                      bHoldingDownHandbrake : 1;                        		// 0x07AC (0x0004) [0x0000000000000000] [0x00001000] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21039,7 +21039,7 @@ public:
 	unsigned long                                      bUpdateActor2RefFrame : 1;                        		// 0x02BC (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21066,7 +21066,7 @@ public:
 	unsigned char                                      ImpulseCount;                                     		// 0x02A0 (0x0001) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21086,7 +21086,7 @@ public:
 	unsigned char                                      ImpulseCount;                                     		// 0x029C (0x0001) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21104,7 +21104,7 @@ public:
 	unsigned long                                      bThrustEnabled : 1;                               		// 0x0290 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21120,7 +21120,7 @@ public:
 	class UMaterialInterface*                          LimitMaterial;                                    		// 0x0228 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21140,7 +21140,7 @@ public:
 	unsigned char                                      ImpulseFalloff;                                   		// 0x023C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21172,7 +21172,7 @@ public:
 	unsigned long                                      bInterpolating : 1;                               		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21209,7 +21209,7 @@ public:
 	unsigned long                                      bEnableForceMassRatio : 1;                        		// 0x00E4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21241,7 +21241,7 @@ public:
 	unsigned long                                      bAutoDrive : 1;                                   		// 0x00BC (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21265,7 +21265,7 @@ public:
 	unsigned long                                      bIsDriving : 1;                                   		// 0x00F4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21291,7 +21291,7 @@ public:
 	unsigned long                                      bTurnInPlaceOnSteer : 1;                          		// 0x0124 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21333,7 +21333,7 @@ public:
 	unsigned long                                      m_bIgnoreSelfCollisions : 1;                      		// 0x00F0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21351,7 +21351,7 @@ class UPhysicalMaterialPropertyBase : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21370,7 +21370,7 @@ public:
 	class UPhysicsAssetInstance*                       DefaultInstance;                                  		// 0x00D8 (0x0008) [0x000000000440000A]              ( CPF_Const | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21398,7 +21398,7 @@ public:
 	unsigned long                                      bHasFixedBody : 1;                                		// 0x00EC (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21431,7 +21431,7 @@ public:
 	float                                              DebrisLifetime;                                   		// 0x0064 (0x0004) [0x0000000000005000]              ( CPF_Native | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21446,7 +21446,7 @@ public:
 	int                                                ParticlePercentage;                               		// 0x0060 (0x0004) [0x0000000000005000]              ( CPF_Native | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21491,7 +21491,7 @@ public:
 	float                                              InstanceDampingScale;                             		// 0x00D0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21553,7 +21553,7 @@ public:
 	FPointer                                           DummyKinActor;                                    		// 0x00D8 (0x0008) [0x0800000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21620,7 +21620,7 @@ public:
 	unsigned long                                      bMaintainMinDistance : 1;                         		// 0x0120 (0x0004) [0x0000000000000001] [0x00000200] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21634,7 +21634,7 @@ class URB_BSJointSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21648,7 +21648,7 @@ class URB_DistanceJointSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21662,7 +21662,7 @@ class URB_HingeSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21676,7 +21676,7 @@ class URB_PrismaticSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21690,7 +21690,7 @@ class URB_PulleyJointSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21704,7 +21704,7 @@ class URB_SkelJointSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21718,7 +21718,7 @@ class URB_StayUprightSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21775,7 +21775,7 @@ public:
 	unsigned char                                      Side;                                             		// 0x014C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21811,7 +21811,7 @@ public:
 	unsigned char                                      Coordinates;                                      		// 0x03A9 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21828,7 +21828,7 @@ public:
 	int                                                ForceFieldChannel;                                		// 0x02CC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21852,7 +21852,7 @@ public:
 	unsigned char                                      RBChannel;                                        		// 0x02DC (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21879,7 +21879,7 @@ public:
 	unsigned long                                      UseSpecialRadialForce : 1;                        		// 0x030C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21894,7 +21894,7 @@ public:
 	class UDrawCapsuleComponent*                       RenderComponent;                                  		// 0x0310 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21929,7 +21929,7 @@ public:
 	unsigned char                                      Coordinates;                                      		// 0x0398 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21951,7 +21951,7 @@ public:
 	unsigned char                                      ForceFalloff;                                     		// 0x0304 (0x0001) [0x0000000000080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21980,7 +21980,7 @@ public:
 	unsigned long                                      BSpecialRadialForceMode : 1;                      		// 0x0320 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22010,7 +22010,7 @@ public:
 	unsigned char                                      Coordinates;                                      		// 0x037C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22026,7 +22026,7 @@ public:
 	class UDrawBoxComponent*                           RenderComponent;                                  		// 0x038C (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22044,7 +22044,7 @@ public:
 	float                                              CapsuleRadius;                                    		// 0x038C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22063,7 +22063,7 @@ public:
 	unsigned char                                      ForceFalloff;                                     		// 0x02F8 (0x0001) [0x0000000000080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22079,7 +22079,7 @@ public:
 	float                                              SelfRotationStrength;                             		// 0x0304 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22105,7 +22105,7 @@ public:
 	unsigned long                                      BSpecialRadialForceMode : 1;                      		// 0x0310 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22120,7 +22120,7 @@ public:
 	class UDrawCapsuleComponent*                       RenderComponent;                                  		// 0x0314 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22145,7 +22145,7 @@ public:
 	unsigned long                                      BSpecialRadialForceMode : 1;                      		// 0x030C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22160,7 +22160,7 @@ public:
 	class UDrawCapsuleComponent*                       RenderComponent;                                  		// 0x0310 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22190,7 +22190,7 @@ public:
 	unsigned long                                      bForceApplyToProjectiles : 1;                     		// 0x02BC (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22218,7 +22218,7 @@ public:
 	unsigned char                                      RadialForceMode;                                  		// 0x02AD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22233,7 +22233,7 @@ class UForceFieldShape : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22253,7 +22253,7 @@ public:
 	class UDrawBoxComponent*                           Shape;                                            		// 0x0060 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22274,7 +22274,7 @@ public:
 	class UDrawCapsuleComponent*                       Shape;                                            		// 0x0060 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22296,7 +22296,7 @@ public:
 	class UDrawSphereComponent*                        Shape;                                            		// 0x0060 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22327,7 +22327,7 @@ public:
 	int                                                PI_LicenseePackageVersion;                        		// 0x0374 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22345,7 +22345,7 @@ public:
 	int                                                PrefabVersion;                                    		// 0x0088 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22366,7 +22366,7 @@ public:
 	unsigned long                                      bOutputObjCommentToScreen : 1;                    		// 0x0084 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22387,7 +22387,7 @@ class USequenceFrame : public USequenceObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22402,7 +22402,7 @@ class USequenceFrameWrapped : public USequenceFrame
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22428,7 +22428,7 @@ public:
 	unsigned char                                      GamepadID;                                        		// 0x00D8 (0x0001) [0x0000000001002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22492,7 +22492,7 @@ public:
 	unsigned long                                      m_bBioForceReUpdate : 1;                          		// 0x0190 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22511,7 +22511,7 @@ public:
 	class APrefabInstance*                             OwnerPrefab;                                      		// 0x0194 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22527,7 +22527,7 @@ class UPrefabSequenceContainer : public USequence
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22544,7 +22544,7 @@ public:
 	class UPackage*                                    oDependentPackage;                                		// 0x01A4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22561,7 +22561,7 @@ public:
 	unsigned long                                      bCallHandler : 1;                                 		// 0x00F4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22575,7 +22575,7 @@ class UBioSeqAct_BlockForTextureStreaming : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22595,7 +22595,7 @@ public:
 	unsigned char                                      m_eEventType;                                     		// 0x0124 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22613,7 +22613,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x0118 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22631,7 +22631,7 @@ public:
 	unsigned long                                      bOpen : 1;                                        		// 0x0118 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22647,7 +22647,7 @@ public:
 	class USoundNode*                                  ApplyNode;                                        		// 0x0100 (0x0008) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22662,7 +22662,7 @@ public:
 	unsigned long                                      bPreferController : 1;                            		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22682,7 +22682,7 @@ public:
 	unsigned long                                      bPersistFade : 1;                                 		// 0x0118 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22715,7 +22715,7 @@ public:
 	unsigned long                                      bCheckLineOfSight : 1;                            		// 0x012C (0x0004) [0x0000000000000001] [0x00000400] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22740,7 +22740,7 @@ public:
 	unsigned char                                      PlaySpace;                                        		// 0x011C (0x0001) [0x0000008000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22759,7 +22759,7 @@ public:
 	unsigned char                                      CollisionType;                                    		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22774,7 +22774,7 @@ class USeqAct_CommitMapChange : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22791,7 +22791,7 @@ public:
 	unsigned long                                      bIncludeVarComment : 1;                           		// 0x010C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22809,7 +22809,7 @@ public:
 	unsigned long                                      bDisplayOnObject : 1;                             		// 0x012C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22825,7 +22825,7 @@ public:
 	FString                                            OutputLabel;                                      		// 0x00F8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22842,7 +22842,7 @@ public:
 	unsigned long                                      bOpen : 1;                                        		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22858,7 +22858,7 @@ public:
 	float                                              Distance;                                         		// 0x00F8 (0x0004) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22875,7 +22875,7 @@ public:
 	struct SFXName                                     SocketOrBoneName;                                 		// 0x0110 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22891,7 +22891,7 @@ public:
 	struct SFXName                                     PropertyName;                                     		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22909,7 +22909,7 @@ public:
 	float                                              Z;                                                		// 0x010C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22925,7 +22925,7 @@ public:
 	float                                              VelocityMag;                                      		// 0x0104 (0x0004) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22942,7 +22942,7 @@ public:
 	unsigned long                                      bObjectFound : 1;                                 		// 0x00F8 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22960,7 +22960,7 @@ public:
 	unsigned long                                      bCancelled : 1;                                   		// 0x0108 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22991,7 +22991,7 @@ public:
 	unsigned char                                      PointSelection;                                   		// 0x0170 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23006,7 +23006,7 @@ class USeqAct_ActorFactoryEx : public USeqAct_ActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23026,7 +23026,7 @@ public:
 	unsigned long                                      bPickClosest : 1;                                 		// 0x012C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23048,7 +23048,7 @@ public:
 	unsigned long                                      bStartWillRestart : 1;                            		// 0x011C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23069,7 +23069,7 @@ public:
 	float                                              NextLinkTime;                                     		// 0x0118 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23083,7 +23083,7 @@ class USeqAct_ForceGarbageCollection : public USeqAct_Latent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23134,7 +23134,7 @@ public:
 	unsigned long                                      m_bBioHACK_StopPinFired : 1;                      		// 0x0170 (0x0004) [0x0000000000002000] [0x00800000] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23156,7 +23156,7 @@ public:
 	unsigned long                                      bNeverAutoStreamOut : 1;                          		// 0x010C (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23173,7 +23173,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x0120 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23190,7 +23190,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x0120 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23207,7 +23207,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x011C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23230,7 +23230,7 @@ public:
 	unsigned long                                      bStopped : 1;                                     		// 0x012C (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23249,7 +23249,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x0124 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23283,7 +23283,7 @@ public:
 	float                                              OldFocusDistance;                                 		// 0x0168 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23301,7 +23301,7 @@ public:
 	float                                              OldMotionBlurAmount;                              		// 0x0118 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23322,7 +23322,7 @@ public:
 	unsigned long                                      bStreamingActive : 1;                             		// 0x013C (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23340,7 +23340,7 @@ public:
 	unsigned long                                      bShouldBlockOnLoad : 1;                           		// 0x011C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23358,7 +23358,7 @@ public:
 	unsigned long                                      bIncludeObjComment : 1;                           		// 0x0108 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23377,7 +23377,7 @@ public:
 	unsigned char                                      ManualCoverType;                                  		// 0x010C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23399,7 +23399,7 @@ public:
 	unsigned long                                      bFalloff : 1;                                     		// 0x0114 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23424,7 +23424,7 @@ public:
 	unsigned long                                      bUseEmitterLocation : 1;                          		// 0x015C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23448,7 +23448,7 @@ public:
 	unsigned char                                      PlaySpace;                                        		// 0x011C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23468,7 +23468,7 @@ public:
 	class USoundCue*                                   SoundCueToPlay;                                   		// 0x0120 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23483,7 +23483,7 @@ public:
 	struct FMusicTrackStruct                           MusicTrack;                                       		// 0x00F8 (0x001C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23500,7 +23500,7 @@ public:
 	unsigned long                                      bTryToLeaveVehicle : 1;                           		// 0x0100 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23515,7 +23515,7 @@ public:
 	TArray<struct FSwitchRange>                        Ranges;                                           		// 0x00F8 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23529,7 +23529,7 @@ class USeqAct_SetBlockRigidBody : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23545,7 +23545,7 @@ public:
 	class AActor*                                      CameraTarget;                                     		// 0x0104 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23562,7 +23562,7 @@ public:
 	int                                                MaterialIndex;                                    		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23579,7 +23579,7 @@ public:
 	float                                              ScalarValue;                                      		// 0x0108 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23598,7 +23598,7 @@ public:
 	unsigned char                                      MeshType;                                         		// 0x010C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23613,7 +23613,7 @@ public:
 	unsigned char                                      newPhysics;                                       		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23627,7 +23627,7 @@ class USeqAct_SetRigidBodyIgnoreVehicles : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23641,7 +23641,7 @@ class USeqAct_SetSequenceVariable : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23658,7 +23658,7 @@ public:
 	int                                                ObjectIndex;                                      		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23676,7 +23676,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23694,7 +23694,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23710,7 +23710,7 @@ public:
 	float                                              FloatResult;                                      		// 0x00FC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23727,7 +23727,7 @@ public:
 	unsigned long                                      bTruncate : 1;                                    		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23745,7 +23745,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23763,7 +23763,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23778,7 +23778,7 @@ public:
 	int                                                ListEntriesCount;                                 		// 0x00F8 (0x0004) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23796,7 +23796,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23814,7 +23814,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23830,7 +23830,7 @@ public:
 	unsigned long                                      DefaultValue : 1;                                 		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23846,7 +23846,7 @@ public:
 	float                                              Target;                                           		// 0x0108 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23864,7 +23864,7 @@ public:
 	unsigned long                                      bIsUpdated : 1;                                   		// 0x010C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23884,7 +23884,7 @@ public:
 	unsigned long                                      bSetRotation : 1;                                 		// 0x0118 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23901,7 +23901,7 @@ public:
 	class UObject*                                     Value;                                            		// 0x0100 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23918,7 +23918,7 @@ public:
 	FString                                            Value;                                            		// 0x0108 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23937,7 +23937,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23955,7 +23955,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23973,7 +23973,7 @@ public:
 	float                                              Z;                                                		// 0x010C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23992,7 +23992,7 @@ public:
 	unsigned long                                      bAutoDisableLinks : 1;                            		// 0x0110 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24008,7 +24008,7 @@ public:
 	TArray<int>                                        AutoDisabledIndices;                              		// 0x0114 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24024,7 +24024,7 @@ public:
 	float                                              Time;                                             		// 0x00FC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24039,7 +24039,7 @@ class USeqAct_Toggle : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24055,7 +24055,7 @@ public:
 	unsigned long                                      bLevelStartupEventForceOff : 1;                   		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24080,7 +24080,7 @@ public:
 	unsigned long                                      bTraceWorld : 1;                                  		// 0x0134 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24095,7 +24095,7 @@ class USequenceCondition : public USequenceOp
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24110,7 +24110,7 @@ class USeqCond_CompareBool : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24126,7 +24126,7 @@ public:
 	float                                              ValueB;                                           		// 0x00E0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24142,7 +24142,7 @@ public:
 	int                                                ValueB;                                           		// 0x00E0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24158,7 +24158,7 @@ public:
 	struct SFXName                                     ValueB;                                           		// 0x00E4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24172,7 +24172,7 @@ class USeqCond_CompareObject : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24188,7 +24188,7 @@ public:
 	FString                                            ValueB;                                           		// 0x00EC (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24202,7 +24202,7 @@ class USeqCond_GetServerType : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24220,7 +24220,7 @@ public:
 	int                                                ValueB;                                           		// 0x00E4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24237,7 +24237,7 @@ public:
 	float                                              ValueB;                                           		// 0x00E4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24251,7 +24251,7 @@ class USeqCond_IsAlive : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24265,7 +24265,7 @@ class USeqCond_IsConsole : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24279,7 +24279,7 @@ class USeqCond_IsInCombat : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24294,7 +24294,7 @@ public:
 	int                                                NumNeededLoggedIn;                                		// 0x00DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24309,7 +24309,7 @@ class USeqCond_IsSameTeam : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24323,7 +24323,7 @@ class USeqCond_SwitchBase : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24342,7 +24342,7 @@ public:
 	TArray<struct FSwitchClassInfo>                    ClassArray;                                       		// 0x00DC (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24362,7 +24362,7 @@ public:
 	class UClass*                                      MetaClass;                                        		// 0x00EC (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24380,7 +24380,7 @@ class USeqCond_SwitchPlatform : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24410,7 +24410,7 @@ public:
 	unsigned char                                      WhoTriggers;                                      		// 0x0125 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24429,7 +24429,7 @@ class UBioSeqEvt_LoadingScreenClosed : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24444,7 +24444,7 @@ public:
 	float                                              MaxSightDistance;                                 		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24459,7 +24459,7 @@ public:
 	struct SFXName                                     NotifyName;                                       		// 0x0128 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24475,7 +24475,7 @@ public:
 	struct SFXName                                     ConsoleEventName;                                 		// 0x0138 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24489,7 +24489,7 @@ class USeqEvent_ConstraintBroken : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24503,7 +24503,7 @@ class USeqEvent_Destroyed : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24517,7 +24517,7 @@ class USeqEvent_GetInventory : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24531,7 +24531,7 @@ class USeqEvent_LevelBeginning : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24545,7 +24545,7 @@ class USeqEvent_LevelLoaded : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24560,7 +24560,7 @@ class USeqEvent_LevelStartup : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24575,7 +24575,7 @@ public:
 	float                                              StayOpenTime;                                     		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24601,7 +24601,7 @@ public:
 	unsigned char                                      EventType;                                        		// 0x0158 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24617,7 +24617,7 @@ public:
 	float                                              MaxDistance;                                      		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24634,7 +24634,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x0140 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24651,7 +24651,7 @@ public:
 	float                                              MinCollisionVelocity;                             		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24665,7 +24665,7 @@ class USeqEvent_SeeDeath : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24680,7 +24680,7 @@ public:
 	FString                                            InputLabel;                                       		// 0x0128 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24702,7 +24702,7 @@ public:
 	unsigned long                                      bResetDamageOnToggle : 1;                         		// 0x0168 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24728,7 +24728,7 @@ public:
 	unsigned long                                      bAllowDeadPawns : 1;                              		// 0x0158 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24753,7 +24753,7 @@ public:
 	unsigned long                                      bAimToInteract : 1;                               		// 0x0164 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24770,7 +24770,7 @@ public:
 	struct SFXName                                     VarName;                                          		// 0x0088 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24786,7 +24786,7 @@ public:
 	int                                                m_srValue;                                        		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24801,7 +24801,7 @@ public:
 	int                                                m_srStringID;                                     		// 0x0094 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24824,7 +24824,7 @@ public:
 	unsigned long                                      bShouldBakeAndPrune : 1;                          		// 0x00CC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24839,7 +24839,7 @@ public:
 	int                                                bValue;                                           		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24855,7 +24855,7 @@ public:
 	class UClass*                                      ExpectedType;                                     		// 0x00A0 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24870,7 +24870,7 @@ public:
 	float                                              FloatValue;                                       		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24886,7 +24886,7 @@ public:
 	float                                              Max;                                              		// 0x0098 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24901,7 +24901,7 @@ public:
 	int                                                IntValue;                                         		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24917,7 +24917,7 @@ public:
 	int                                                Max;                                              		// 0x0098 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24932,7 +24932,7 @@ public:
 	struct SFXName                                     NameValue;                                        		// 0x0090 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24949,7 +24949,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x00A0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24963,7 +24963,7 @@ class USeqVar_ScopedNamed : public USeqVar_Named
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24980,7 +24980,7 @@ public:
 	class UObject*                                     ObjValue;                                         		// 0x00AC (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24997,7 +24997,7 @@ public:
 	class UClass*                                      PawnClass;                                        		// 0x00B4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25014,7 +25014,7 @@ public:
 	unsigned long                                      bCachedList : 1;                                  		// 0x00CC (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25029,7 +25029,7 @@ public:
 	TArray<class UObject*>                             ObjList;                                          		// 0x00B4 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25049,7 +25049,7 @@ public:
 	unsigned long                                      bCollidingOnly : 1;                               		// 0x00D8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25068,7 +25068,7 @@ public:
 	unsigned long                                      bReturnPawns : 1;                                 		// 0x00D8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25085,7 +25085,7 @@ public:
 	FString                                            StrValue;                                         		// 0x0090 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25100,7 +25100,7 @@ public:
 	struct FVector                                     VectValue;                                        		// 0x0090 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25117,7 +25117,7 @@ public:
 	unsigned long                                      bIsPlaying : 1;                                   		// 0x0294 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25131,7 +25131,7 @@ class AAmbientSoundMovable : public AAmbientSound
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25148,7 +25148,7 @@ public:
 	class USoundNodeAmbient*                           SoundNodeInstance;                                		// 0x02A8 (0x0008) [0x000000000440000A]              ( CPF_Const | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25162,7 +25162,7 @@ class AAmbientSoundNonLoop : public AAmbientSoundSimple
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25182,7 +25182,7 @@ public:
 	unsigned long                                      bFadeOnToggle : 1;                                		// 0x02C0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25203,7 +25203,7 @@ class UDistributionFloatSoundParameter : public UDistributionFloatParameterBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25219,7 +25219,7 @@ public:
 	int                                                NodeUpdateHint;                                   		// 0x0070 (0x0004) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25247,7 +25247,7 @@ public:
 	unsigned char                                      DistanceModel;                                    		// 0x00AC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25263,7 +25263,7 @@ public:
 	float                                              DelayMax;                                         		// 0x00B4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25287,7 +25287,7 @@ public:
 	unsigned char                                      DistanceType;                                     		// 0x008D (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25302,7 +25302,7 @@ public:
 	TArray<float>                                      InputVolume;                                      		// 0x0074 (0x0010) [0x0000000000400049]              ( CPF_Edit | CPF_ExportObject | CPF_EditConstArray | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25318,7 +25318,7 @@ public:
 	float                                              DelayMax;                                         		// 0x0078 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25333,7 +25333,7 @@ public:
 	TArray<struct FDistanceDatum>                      CrossFadeInput;                                   		// 0x0074 (0x0010) [0x0000000000480049]              ( CPF_Edit | CPF_ExportObject | CPF_EditConstArray | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25350,7 +25350,7 @@ public:
 	unsigned long                                      bLoopIndefinitely : 1;                            		// 0x007C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25364,7 +25364,7 @@ class USoundNodeMature : public USoundNode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25379,7 +25379,7 @@ public:
 	TArray<float>                                      InputVolume;                                      		// 0x0074 (0x0010) [0x0000000000400049]              ( CPF_Edit | CPF_ExportObject | CPF_EditConstArray | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25397,7 +25397,7 @@ public:
 	float                                              VolumeMax;                                        		// 0x0080 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25413,7 +25413,7 @@ public:
 	struct FRawDistributionFloat                       VolumeModulation;                                 		// 0x0098 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25437,7 +25437,7 @@ public:
 	unsigned long                                      bModulatePitch : 1;                               		// 0x0094 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25455,7 +25455,7 @@ public:
 	unsigned long                                      bRandomizeWithoutReplacement : 1;                 		// 0x0098 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25499,7 +25499,7 @@ public:
 	unsigned char                                      DecompressionType;                                		// 0x0205 (0x0001) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25515,7 +25515,7 @@ public:
 	TArray<unsigned char>                              QueuedAudio;                                      		// 0x0208 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25534,7 +25534,7 @@ public:
 	struct SFXName                                     WaveParameterName;                                		// 0x0074 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25598,7 +25598,7 @@ public:
 	unsigned long                                      bShowWireframe : 1;                               		// 0x03D4 (0x0004) [0x0000000000000001] [0x00008000] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25638,7 +25638,7 @@ public:
 	unsigned long                                      bPhysicsMeshDirty : 1;                            		// 0x02F4 (0x0004) [0x0000000000003000] [0x00000002] ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25654,7 +25654,7 @@ public:
 	class ATerrain*                                    ParentTerrain;                                    		// 0x01CC (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25669,7 +25669,7 @@ public:
 	TArray<struct FTerrainFilteredMaterial>            Materials;                                        		// 0x0060 (0x0010) [0x0000000000400003]              ( CPF_Edit | CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25695,7 +25695,7 @@ public:
 	unsigned char                                      MappingType;                                      		// 0x00D4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25709,7 +25709,7 @@ class UUIRoot : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25784,7 +25784,7 @@ public:
 	unsigned long                                      bSupports3DPrimitives : 1;                        		// 0x021C (0x0004) [0x0000000000000002] [0x00000080] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25955,7 +25955,7 @@ class UUIComponent : public UComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25973,7 +25973,7 @@ public:
 	class UUIEvent_ProcessInput*                       InputProcessor;                                   		// 0x0098 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25989,7 +25989,7 @@ class UUIEventContainer : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26012,7 +26012,7 @@ public:
 	TArray<struct FPlayerDataStoreGroup>               PlayerDataStores;                                 		// 0x00A0 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26040,7 +26040,7 @@ public:
 	struct FScriptDelegate                             __OnInitialize__Delegate;                         		// 0x0090 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26092,7 +26092,7 @@ public:
 	unsigned long                                      bIsRuntimeAutoCompleteUpToDate : 1;               		// 0x025C (0x0004) [0x0000000000002000] [0x00000040] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26133,7 +26133,7 @@ public:
 	unsigned char                                      CurrentEvent;                                     		// 0x0168 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26201,7 +26201,7 @@ public:
 	unsigned char                                      bYAxis;                                           		// 0x0206 (0x0001) [0x0000000000000004]              ( CPF_Input )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26230,7 +26230,7 @@ class UPlayerManagerInteraction : public UInteraction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26272,7 +26272,7 @@ public:
 	FPointer                                           CanvasScene;                                      		// 0x021C (0x0008) [0x0000000000003002]              ( CPF_Const | CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26311,7 +26311,7 @@ public:
 	TArray<struct FUIAxisEmulationDefinition>          AxisEmulationDefinitions;                         		// 0x0070 (0x0010) [0x0000000000404002]              ( CPF_Const | CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26327,7 +26327,7 @@ class UUILayerBase : public UUIRoot
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26353,7 +26353,7 @@ public:
 	unsigned long                                      bEnablePostProcess : 1;                           		// 0x0128 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26390,7 +26390,7 @@ public:
 	unsigned char                                      StackPriority;                                    		// 0x0099 (0x0001) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26415,7 +26415,7 @@ class UUIState_Disabled : public UUIState
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26431,7 +26431,7 @@ class UUIState_Enabled : public UUIState
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26448,7 +26448,7 @@ public:
 	struct FVector2D                                   StringExtent;                                     		// 0x010C (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26469,7 +26469,7 @@ public:
 	unsigned char                                      WriteAccessType;                                  		// 0x0080 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26501,7 +26501,7 @@ public:
 	struct SFXName                                     Tag;                                              		// 0x00A4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26532,7 +26532,7 @@ public:
 	unsigned char                                      UnknownData03[ 0x48 ];                            		// 0x01C4 (0x0048) UNKNOWN PROPERTY: MapProperty Engine.UISkin.SoundCueMap
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26566,7 +26566,7 @@ public:
 	struct SFXName                                     StyleTag;                                         		// 0x00E0 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26620,7 +26620,7 @@ public:
 	unsigned char                                      MaskPostProcess;                                  		// 0x0515 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26689,7 +26689,7 @@ public:
 	unsigned char                                      VertAlignment;                                    		// 0x0071 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26710,7 +26710,7 @@ public:
 	unsigned char                                      FadeType;                                         		// 0x0094 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26734,7 +26734,7 @@ public:
 	struct FUIStyleReference                           ImageStyle;                                       		// 0x0114 (0x0028) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26781,7 +26781,7 @@ public:
 	struct FUIStyleReference                           StringStyle;                                      		// 0x0198 (0x0028) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26892,7 +26892,7 @@ public:
 	struct FScriptDelegate                             __OnOverrideListElementState__Delegate;           		// 0x0850 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26962,7 +26962,7 @@ class UUIComp_ListComponentBase : public UUIComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26984,7 +26984,7 @@ public:
 	unsigned long                                      bReverseSecondarySorting : 1;                     		// 0x0090 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27003,7 +27003,7 @@ public:
 	unsigned long                                      bReapplyFormatting : 1;                           		// 0x0070 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27040,7 +27040,7 @@ public:
 	unsigned long                                      bDisplayColumnHeaders : 1;                        		// 0x0150 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27055,7 +27055,7 @@ class UUIDataStoreSubscriber : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27075,7 +27075,7 @@ class UUIDataStorePublisher : public UUIDataStoreSubscriber
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27090,7 +27090,7 @@ class UUIListElementCellProvider : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27104,7 +27104,7 @@ class UUIListElementProvider : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27118,7 +27118,7 @@ class UUIAnimation : public UUIRoot
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27135,7 +27135,7 @@ public:
 	unsigned char                                      LoopMode;                                         		// 0x0078 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27153,7 +27153,7 @@ class UUIConfigProvider : public UUIDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27169,7 +27169,7 @@ public:
 	FString                                            ConfigFileName;                                   		// 0x0094 (0x0010) [0x0000000000C02000]              ( CPF_Transient | CPF_NeedCtorLink | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27184,7 +27184,7 @@ public:
 	FString                                            SectionName;                                      		// 0x0084 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27199,7 +27199,7 @@ public:
 	class ULocalPlayer*                                Player;                                           		// 0x0084 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27216,7 +27216,7 @@ public:
 	FPointer                                           VfTable_IUIListElementCellProvider;               		// 0x008C (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27240,7 +27240,7 @@ public:
 	FString                                            LastInviteFrom;                                   		// 0x00F4 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27277,7 +27277,7 @@ public:
 	FString                                            BusyText;                                         		// 0x0174 (0x0010) [0x0000000000408002]              ( CPF_Const | CPF_Localized | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27306,7 +27306,7 @@ public:
 	FString                                            IsPlayingThisGameCol;                             		// 0x0114 (0x0010) [0x0000000000408002]              ( CPF_Const | CPF_Localized | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27325,7 +27325,7 @@ public:
 	FPointer                                           VfTable_IUIListElementCellProvider;               		// 0x008C (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27345,7 +27345,7 @@ public:
 	unsigned long                                      bWasErrorLastRead : 1;                            		// 0x00AC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27371,7 +27371,7 @@ class UUIDataProvider_OnlineProfileSettings : public UUIDataProvider_OnlinePlaye
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27391,7 +27391,7 @@ public:
 	TArray<struct FAchievementDetails>                 Achievements;                                     		// 0x0094 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27423,7 +27423,7 @@ public:
 	TArray<struct SFXName>                             Values;                                           		// 0x00B8 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27444,7 +27444,7 @@ public:
 	TArray<struct FIdToStringMapping>                  Values;                                           		// 0x00B8 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27462,7 +27462,7 @@ public:
 	class UUIDynamicFieldProvider*                     SceneDataProvider;                                		// 0x00C4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27492,7 +27492,7 @@ class UUIDataStore_Color : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27511,7 +27511,7 @@ public:
 	struct FMultiMap_Mirror                            ResourceProviders;                                		// 0x00D4 (0x0048) [0x0000000000003002]              ( CPF_Const | CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27535,7 +27535,7 @@ class UUIDataStore_Fonts : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27552,7 +27552,7 @@ public:
 	struct FMultiMap_Mirror                            ListElementProviders;                             		// 0x00C4 (0x0048) [0x0000000000003002]              ( CPF_Const | CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27576,7 +27576,7 @@ public:
 	struct SFXName                                     CurrentGameSettingsTag;                           		// 0x0164 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27597,7 +27597,7 @@ public:
 	struct FScriptDelegate                             __OnRefreshDataFieldValue__Delegate;              		// 0x00AC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27621,7 +27621,7 @@ public:
 	struct FScriptDelegate                             __OnAddTeamProvider__Delegate;                    		// 0x0108 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27659,7 +27659,7 @@ public:
 	class UCurrentWeaponDataProvider*                  CurrentWeapon;                                    		// 0x0104 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27676,7 +27676,7 @@ class UUIDataStore_Gamma : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27690,7 +27690,7 @@ class UUIDataStore_Images : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27709,7 +27709,7 @@ public:
 	TArray<class UUIResourceDataProvider*>             UnRankedDataProviders;                            		// 0x00DC (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27731,7 +27731,7 @@ public:
 	class UUIDynamicFieldProvider*                     RegistryDataProvider;                             		// 0x00AC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27746,7 +27746,7 @@ class UUIDataStore_Remote : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27769,7 +27769,7 @@ public:
 	int                                                ActiveSearchIndex;                                		// 0x00F0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27828,7 +27828,7 @@ public:
 	class UUIDataProvider_OnlinePartyChatList*         PartyChatProvider;                                		// 0x01CC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27867,7 +27867,7 @@ public:
 	unsigned char                                      UnknownData01[ 0x8 ];                             		// 0x0140 (0x0008) FIX WRONG TYPE SIZE OF PREVIUS PROPERTY
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27887,7 +27887,7 @@ class UUIDataStore_Settings : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27904,7 +27904,7 @@ public:
 	int                                                SelectedIndex;                                    		// 0x00C4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27931,7 +27931,7 @@ public:
 	TArray<class USessionSettingsProvider*>            SessionSettings;                                  		// 0x00CC (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27947,7 +27947,7 @@ class UUIDataStore_StringBase : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27963,7 +27963,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x48 ];                            		// 0x00BC (0x0048) UNKNOWN PROPERTY: MapProperty Engine.UIDataStore_InputAlias.InputAliasLookupMap
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27988,7 +27988,7 @@ public:
 	int                                                PlayerIndex;                                      		// 0x0104 (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28006,7 +28006,7 @@ public:
 	TArray<class UUIConfigFileProvider*>               LocFileProviders;                                 		// 0x00AC (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28021,7 +28021,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x48 ];                            		// 0x020C (0x0048) UNKNOWN PROPERTY: MapProperty Engine.UICustomSkin.WidgetStyleMap
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28039,7 +28039,7 @@ public:
 	TArray<struct FUIProviderScriptFieldValue>         RuntimeDataFields;                                		// 0x0124 (0x0010) [0x0000000000402001]              ( CPF_Edit | CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28074,7 +28074,7 @@ public:
 	struct FScriptDelegate                             __CanSupportComplexPropertyType__Delegate;        		// 0x0094 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28093,7 +28093,7 @@ public:
 	class UObject*                                     DataSource;                                       		// 0x00B4 (0x0008) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28115,7 +28115,7 @@ public:
 	class AGameReplicationInfo*                        GameDataSource;                                   		// 0x00BC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28130,7 +28130,7 @@ class UInventoryDataProvider : public UUIDynamicDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28144,7 +28144,7 @@ class UPowerupDataProvider : public UInventoryDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28159,7 +28159,7 @@ class UWeaponDataProvider : public UInventoryDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28173,7 +28173,7 @@ class UCurrentWeaponDataProvider : public UWeaponDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28187,7 +28187,7 @@ class UPickupDataProvider : public UUIDynamicDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28201,7 +28201,7 @@ class UPlayerDataProvider : public UUIDynamicDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28216,7 +28216,7 @@ public:
 	class UPlayerDataProvider*                         PlayerData;                                       		// 0x00BC (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28235,7 +28235,7 @@ public:
 	TArray<class UPlayerDataProvider*>                 Players;                                          		// 0x00CC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28253,7 +28253,7 @@ public:
 	unsigned long                                      bIsAListRow : 1;                                  		// 0x00D4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28275,7 +28275,7 @@ public:
 	unsigned long                                      bSkipDuringEnumeration : 1;                       		// 0x00B4 (0x0004) [0x0000000000004000] [0x00000002] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28312,7 +28312,7 @@ public:
 	unsigned char                                      EditboxAllowedChars;                              		// 0x015D (0x0001) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28331,7 +28331,7 @@ public:
 	FString                                            Description;                                      		// 0x00E8 (0x0010) [0x0000000000408002]              ( CPF_Const | CPF_Localized | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28346,7 +28346,7 @@ public:
 	struct SFXName                                     ProviderTag;                                      		// 0x00A4 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28367,7 +28367,7 @@ public:
 	class UClass*                                      ProviderClient;                                   		// 0x00BC (0x0008) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28391,7 +28391,7 @@ public:
 	class UUIDataProvider_OnlineProfileSettings*       ProfileProvider;                                  		// 0x009C (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28455,7 +28455,7 @@ public:
 	unsigned long                                      bBlockUpdatesAfterStackModification : 1;          		// 0x01FC (0x0004) [0x0000000000002001] [0x00800000] ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28525,7 +28525,7 @@ public:
 	struct SFXName                                     ClickedCue;                                       		// 0x0520 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28543,7 +28543,7 @@ public:
 	class UUIComp_DrawString*                          StringRenderComponent;                            		// 0x0570 (0x0008) [0x000000000608000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_Component | CPF_NoClear | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28573,7 +28573,7 @@ public:
 	unsigned char                                      IconAlignment;                                    		// 0x059C (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28623,7 +28623,7 @@ public:
 	unsigned char                                      ScrollbarOrientation;                             		// 0x0610 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28658,7 +28658,7 @@ class UUIScrollbarButton : public UUIButton
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28673,7 +28673,7 @@ public:
 	struct FScriptDelegate                             __OnButtonDragged__Delegate;                      		// 0x0528 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28689,7 +28689,7 @@ public:
 	class UUIComp_AutoAlignment*                       AutoAlignment;                                    		// 0x0518 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28713,7 +28713,7 @@ public:
 	unsigned char                                      ButtonLayout;                                     		// 0x05A5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28759,7 +28759,7 @@ public:
 	unsigned char                                      RegionType;                                       		// 0x052C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28776,7 +28776,7 @@ public:
 	class UUIComp_DrawImage*                           ImageComponent;                                   		// 0x0560 (0x0008) [0x000000000608000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_Component | CPF_NoClear | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28803,7 +28803,7 @@ public:
 	class UUIComp_DrawImage*                           LabelBackground;                                  		// 0x0570 (0x0008) [0x000000000408000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28831,7 +28831,7 @@ public:
 	unsigned long                                      bResolvePosition : 1;                             		// 0x0878 (0x0004) [0x0000000000002002] [0x00000001] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28861,7 +28861,7 @@ public:
 	int                                                ModificationCounter;                              		// 0x0530 (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28879,7 +28879,7 @@ public:
 	int                                                PrefabInstanceVersion;                            		// 0x05B0 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28965,7 +28965,7 @@ public:
 	unsigned char                                      ScenePostProcessGroup;                            		// 0x067B (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29051,7 +29051,7 @@ class UUIState_Active : public UUIState
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29065,7 +29065,7 @@ class UUIState_Focused : public UUIState
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29080,7 +29080,7 @@ class UUIState_Pressed : public UUIState
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29094,7 +29094,7 @@ class UUIListString : public UUIString
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29113,7 +29113,7 @@ public:
 	unsigned long                                      bDirty : 1;                                       		// 0x0088 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29130,7 +29130,7 @@ public:
 	struct FStyleDataReference                         TextStyle;                                        		// 0x00BC (0x0030) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29149,7 +29149,7 @@ public:
 	class USurface*                                    DefaultImage;                                     		// 0x00C4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29171,7 +29171,7 @@ public:
 	unsigned char                                      ClipAlignment;                                    		// 0x00B3 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29187,7 +29187,7 @@ public:
 	class USurface*                                    ImageTexture;                                     		// 0x00FC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29207,7 +29207,7 @@ public:
 	struct FScriptDelegate                             __OnScriptTick__Delegate;                         		// 0x0068 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29223,7 +29223,7 @@ class UUIStringRenderer : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29238,7 +29238,7 @@ class UUIStyleResolver : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29255,7 +29255,7 @@ class UUITickableObject : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29271,7 +29271,7 @@ public:
 	TArray<class UUIEvent*>                            UIEvents;                                         		// 0x019C (0x0010) [0x0000000001502002]              ( CPF_Const | CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29290,7 +29290,7 @@ class UUIStateSequence : public UUISequence
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29306,7 +29306,7 @@ public:
 	unsigned long                                      bAutoTargetOwner : 1;                             		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29332,7 +29332,7 @@ public:
 	unsigned long                                      bPropagateEvent : 1;                              		// 0x015C (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29357,7 +29357,7 @@ public:
 	class UUICalloutButtonPanel*                       ButtonPanel;                                      		// 0x0160 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29379,7 +29379,7 @@ public:
 	FPointer                                           VfTable_FCallbackEventDevice;                     		// 0x0160 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29396,7 +29396,7 @@ public:
 	struct FMultiMap_Mirror                            ActionMap;                                        		// 0x0160 (0x0048) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29411,7 +29411,7 @@ class UScene : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29433,7 +29433,7 @@ public:
 	int                                                MaxInstanceCount;                                 		// 0x02F4 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29461,7 +29461,7 @@ public:
 	float                                              Mass;                                             		// 0x02F4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29491,7 +29491,7 @@ public:
 	float                                              SwayScale;                                        		// 0x02C0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29506,7 +29506,7 @@ public:
 	FPointer                                           FoliageSceneProxy;                                		// 0x02CC (0x0008) [0x0000000000201002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29520,7 +29520,7 @@ class UActorFactoryInteractiveFoliage : public UActorFactoryStaticMesh
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29539,7 +29539,7 @@ public:
 	unsigned long                                      bToggled : 1;                                     		// 0x02A4 (0x0004) [0x0000000100000020] [0x00000002] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29557,7 +29557,7 @@ public:
 	class UParticleSystem*                             ProjectileEntryEffect;                            		// 0x0294 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29573,7 +29573,7 @@ class AFluidSurfaceActorMovable : public AFluidSurfaceActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29613,7 +29613,7 @@ public:
 	unsigned char                                      InfluenceType;                                    		// 0x028C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29679,7 +29679,7 @@ public:
 	unsigned long                                      bTestRippleCenterOnDetail : 1;                    		// 0x0320 (0x0004) [0x0000000000000001] [0x00000400] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29697,7 +29697,7 @@ public:
 	class USpeedTreeComponent*                         SpeedTreeComponent;                               		// 0x028C (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29737,7 +29737,7 @@ public:
 	unsigned long                                      bUseBillboards : 1;                               		// 0x0310 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29754,7 +29754,7 @@ public:
 	class USpeedTree*                                  SpeedTree;                                        		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29769,7 +29769,7 @@ public:
 	class USpeedTreeComponent*                         SpeedTreeComponent;                               		// 0x0064 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29795,7 +29795,7 @@ public:
 	unsigned long                                      bLegacySpeedTree : 1;                             		// 0x00BC (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29811,7 +29811,7 @@ public:
 	unsigned long                                      bCurrentlyActive : 1;                             		// 0x0294 (0x0004) [0x0000000100000020] [0x00000001] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29848,7 +29848,7 @@ public:
 	unsigned long                                      bUsesSceneColor : 1;                              		// 0x0270 (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29884,7 +29884,7 @@ public:
 	unsigned char                                      ReflectionsDPG;                                   		// 0x0285 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29917,7 +29917,7 @@ public:
 	FPointer                                           ReleaseResourcesFence;                            		// 0x01FC (0x0008) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29937,7 +29937,7 @@ public:
 	int                                                MaxTextureSize;                                   		// 0x0108 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29959,7 +29959,7 @@ public:
 	unsigned char                                      Format;                                           		// 0x0108 (0x0001) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29986,7 +29986,7 @@ public:
 	unsigned char                                      Format;                                           		// 0x0138 (0x0001) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30015,7 +30015,7 @@ public:
 	unsigned char                                      MovieStreamSource;                                		// 0x015F (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30035,7 +30035,7 @@ public:
 	unsigned long                                      bRenderOnce : 1;                                  		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30056,7 +30056,7 @@ public:
 	unsigned char                                      AddressY;                                         		// 0x011A (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30074,7 +30074,7 @@ public:
 	unsigned long                                      bSkipNextClear : 1;                               		// 0x012C (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30091,7 +30091,7 @@ public:
 	unsigned char                                      Format;                                           		// 0x0100 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30147,7 +30147,7 @@ public:
 	unsigned char                                      DebugState;                                       		// 0x0334 (0x0001) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30166,7 +30166,7 @@ public:
 	unsigned long                                      bIsChild : 1;                                     		// 0x00D4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30187,7 +30187,7 @@ public:
 	unsigned long                                      bApplyEQ : 1;                                     		// 0x00A4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30211,7 +30211,7 @@ public:
 	unsigned long                                      bIsFrozenRendering : 1;                           		// 0x07EC (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30238,7 +30238,7 @@ class AMatineePawn : public APawn
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30277,7 +30277,7 @@ public:
 	unsigned long                                      bHightlightOneWayReachSpecs : 1;                  		// 0x0660 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30292,7 +30292,7 @@ class ALightVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30308,7 +30308,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x0294 (0x0004) [0x0000000100000020] [0x00000001] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30324,7 +30324,7 @@ class ADirectionalLight : public ALight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30338,7 +30338,7 @@ class ADirectionalLightToggleable : public ADirectionalLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30352,7 +30352,7 @@ class ADominantDirectionalLight : public ADirectionalLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30366,7 +30366,7 @@ class APointLight : public ALight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30380,7 +30380,7 @@ class ADominantPointLight : public APointLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30394,7 +30394,7 @@ class APointLightMovable : public APointLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30408,7 +30408,7 @@ class APointLightToggleable : public APointLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30425,7 +30425,7 @@ class ASkyLight : public ALight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30439,7 +30439,7 @@ class ASkyLightToggleable : public ASkyLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30453,7 +30453,7 @@ class ASpotLight : public ALight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30467,7 +30467,7 @@ class ADominantSpotLight : public ASpotLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30481,7 +30481,7 @@ class ASpotLightMovable : public ASpotLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30495,7 +30495,7 @@ class ASpotLightToggleable : public ASpotLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30514,7 +30514,7 @@ public:
 	int                                                MaxLightComponents;                               		// 0x02A8 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30582,7 +30582,7 @@ public:
 	float                                              OcclusionMaskDarkness;                            		// 0x01D0 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30608,7 +30608,7 @@ public:
 	float                                              WholeSceneDynamicShadowRadius;                    		// 0x01E8 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30627,7 +30627,7 @@ public:
 	struct FArray_Mirror                               DominantLightShadowMap;                           		// 0x02A0 (0x0010) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30653,7 +30653,7 @@ public:
 	unsigned long                                      bAllowedInBasePass : 1;                           		// 0x0260 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30670,7 +30670,7 @@ class UDominantPointLightComponent : public UPointLightComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30689,7 +30689,7 @@ public:
 	float                                              LightShaftConeAngle;                              		// 0x027C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30705,7 +30705,7 @@ public:
 	struct FArray_Mirror                               DominantLightShadowMap;                           		// 0x0330 (0x0010) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30721,7 +30721,7 @@ public:
 	struct FColor                                      LowerColor;                                       		// 0x01D8 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30738,7 +30738,7 @@ public:
 	unsigned long                                      bRenderBeforeModShadows : 1;                      		// 0x0270 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30756,7 +30756,7 @@ public:
 	unsigned long                                      bForceNonCompositeDynamicLights : 1;              		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30813,7 +30813,7 @@ public:
 	unsigned char                                      BoundsMethod;                                     		// 0x0162 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30829,7 +30829,7 @@ public:
 	unsigned long                                      bAllowDLESharing : 1;                             		// 0x0168 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30843,7 +30843,7 @@ class UDrawLightConeComponent : public UDrawConeComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30857,7 +30857,7 @@ class UDrawLightRadiusComponent : public UDrawSphereComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30873,7 +30873,7 @@ public:
 	class UMaterialInterface*                          SourceMaterial;                                   		// 0x006C (0x0008) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31084,7 +31084,7 @@ public:
 	unsigned long                                      m_bBioFFXShouldRelinkBoneMap : 1;                 		// 0x078C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31333,7 +31333,7 @@ public:
 	FPointer                                           m_VerticesPerBone;                                		// 0x041C (0x0008) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31353,7 +31353,7 @@ public:
 	struct SFXName                                     SupermodelName;                                   		// 0x0094 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31379,7 +31379,7 @@ public:
 	unsigned long                                      bAlreadyVisited : 1;                              		// 0x02F0 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31418,7 +31418,7 @@ public:
 	unsigned long                                      bAcceptsLights : 1;                               		// 0x033C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31440,7 +31440,7 @@ public:
 	unsigned long                                      bSplineDisabled : 1;                              		// 0x0260 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31486,7 +31486,7 @@ public:
 	unsigned long                                      bDebugDrawScopes : 1;                             		// 0x035C (0x0004) [0x0000000000000001] [0x00000200] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31506,7 +31506,7 @@ class AProcBuilding_SimpleLODActor : public AStaticMeshActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31521,7 +31521,7 @@ public:
 	TArray<struct FPBRuleLink>                         NextRules;                                        		// 0x0060 (0x0010) [0x0000000000400040]              ( CPF_EditConstArray | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31540,7 +31540,7 @@ public:
 	unsigned char                                      RepeatAxis;                                       		// 0x007C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31560,7 +31560,7 @@ public:
 	unsigned long                                      bFilled : 1;                                      		// 0x0084 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31583,7 +31583,7 @@ public:
 	unsigned char                                      CornerType;                                       		// 0x0098 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31599,7 +31599,7 @@ public:
 	unsigned char                                      Edge;                                             		// 0x0080 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31615,7 +31615,7 @@ public:
 	float                                              MainXPullIn;                                      		// 0x0074 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31633,7 +31633,7 @@ public:
 	float                                              ExtractNotBottomZ;                                		// 0x007C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31648,7 +31648,7 @@ public:
 	float                                              MassiveLODDistanceScale;                          		// 0x0070 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31666,7 +31666,7 @@ public:
 	unsigned long                                      bBlockAll : 1;                                    		// 0x00CC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31681,7 +31681,7 @@ class UPBRuleNodeOcclusion : public UPBRuleNodeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31701,7 +31701,7 @@ public:
 	unsigned long                                      bDisableMaterialRepeat : 1;                       		// 0x0088 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31718,7 +31718,7 @@ public:
 	int                                                MaxNumExecuted;                                   		// 0x0078 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31734,7 +31734,7 @@ public:
 	unsigned char                                      RepeatAxis;                                       		// 0x0074 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31751,7 +31751,7 @@ public:
 	unsigned char                                      SizeAxis;                                         		// 0x0078 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31767,7 +31767,7 @@ public:
 	unsigned char                                      SplitAxis;                                        		// 0x0080 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31782,7 +31782,7 @@ public:
 	class UProcBuildingRuleset*                        SubRuleset;                                       		// 0x0070 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31799,7 +31799,7 @@ public:
 	class UDistributionVector*                         Scale;                                            		// 0x0080 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31814,7 +31814,7 @@ public:
 	unsigned long                                      bVariationOfScopeOnLeft : 1;                      		// 0x0070 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31837,7 +31837,7 @@ public:
 	unsigned long                                      bScaleWindowWithCell : 1;                         		// 0x0094 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31868,7 +31868,7 @@ public:
 	unsigned long                                      bLODOnlyRoof : 1;                                 		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31882,7 +31882,7 @@ class AReplicationInfo : public AInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31912,7 +31912,7 @@ public:
 	unsigned long                                      bMatchIsOver : 1;                                 		// 0x0308 (0x0004) [0x0000000100000020] [0x00000004] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31993,7 +31993,7 @@ public:
 	unsigned char                                      TTSSpeaker;                                       		// 0x0365 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32047,7 +32047,7 @@ public:
 	struct FColor                                      TeamColor;                                        		// 0x02A8 (0x0004) [0x0000000040000000]              ( CPF_EditInlineNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32109,7 +32109,7 @@ public:
 	unsigned long                                      bEnableColorScaleInterp : 1;                      		// 0x051C (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32161,7 +32161,7 @@ public:
 	unsigned long                                      bConstrainAspectRatio : 1;                        		// 0x0388 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32177,7 +32177,7 @@ class ADynamicCameraActor : public ACameraActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32197,7 +32197,7 @@ public:
 	float                                              BaseFOV;                                          		// 0x016C (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32235,7 +32235,7 @@ public:
 	unsigned char                                      PlaySpace;                                        		// 0x01D8 (0x0001) [0x0000008000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32265,7 +32265,7 @@ public:
 	unsigned char                                      Priority;                                         		// 0x007C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32291,7 +32291,7 @@ public:
 	float                                              SplitScreenShakeScale;                            		// 0x0090 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32327,7 +32327,7 @@ public:
 	unsigned long                                      bRandomAnimSegment : 1;                           		// 0x00DC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32343,7 +32343,7 @@ class UBioSFSharedBase : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32365,7 +32365,7 @@ public:
 	unsigned char                                      ScreenLayout;                                     		// 0x0098 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32424,7 +32424,7 @@ public:
 	unsigned char                                      nLStickY;                                         		// 0x0122 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32503,7 +32503,7 @@ public:
 	unsigned long                                      bUsingGamepad : 1;                                		// 0x0170 (0x0004) [0x0000000000000000] [0x00004000] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32586,7 +32586,7 @@ public:
 	unsigned char                                      AddressY;                                         		// 0x0094 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32639,7 +32639,7 @@ public:
 	FString                                            m_sSaveExtension;                                 		// 0x01BC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32693,7 +32693,7 @@ public:
 	unsigned long                                      bUseVSMShadows : 1;                               		// 0x0264 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32738,7 +32738,7 @@ public:
 	unsigned char                                      RimLightControl;                                  		// 0x01D9 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32767,7 +32767,7 @@ public:
 	unsigned long                                      EnableFilmgrain : 1;                              		// 0x0128 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32781,7 +32781,7 @@ class USeqEvent_HitWall : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32805,7 +32805,7 @@ public:
 	unsigned long                                      bCountInstances : 1;                              		// 0x0070 (0x0004) [0x0000000000000000] [0x00000020] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32829,7 +32829,7 @@ class USFXModule_DamageBase : public USFXModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32847,7 +32847,7 @@ public:
 	unsigned long                                      bDestroyBasedActors : 1;                          		// 0x0108 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32863,7 +32863,7 @@ public:
 	unsigned long                                      m_bPreserveVelocity : 1;                          		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32880,7 +32880,7 @@ public:
 	unsigned long                                      bVelocityRelativeToActorRotation : 1;             		// 0x0108 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32897,7 +32897,7 @@ public:
 	unsigned long                                      bToggleBasedActors : 1;                           		// 0x0108 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32919,7 +32919,7 @@ public:
 	unsigned long                                      bUseRelativeRotation : 1;                         		// 0x0118 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32949,7 +32949,7 @@ public:
 	unsigned long                                      bDontAddDefaultAdmin : 1;                         		// 0x03A4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32981,7 +32981,7 @@ class AAdmin : public APlayerController
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33008,7 +33008,7 @@ public:
 	class UParticleSystem*                             ParticleTemplate;                                 		// 0x02A0 (0x0008) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33024,7 +33024,7 @@ class AKAssetSpawnable : public AKAsset
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33038,7 +33038,7 @@ class UActorFactorySkeletalMeshCinematic : public UActorFactorySkeletalMesh
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33052,7 +33052,7 @@ class UActorFactorySkeletalMeshMAT : public UActorFactorySkeletalMesh
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33066,7 +33066,7 @@ class USeqEvent_Death : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33081,7 +33081,7 @@ class USeqAct_ToggleGodMode : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33096,7 +33096,7 @@ class USeqAct_ToggleAffectedByHitEffects : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33112,7 +33112,7 @@ public:
 	class UTextureMovie*                               MovieTexture;                                     		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33128,7 +33128,7 @@ public:
 	struct FScriptDelegate                             __OnCreateOnlineAccountCompleted__Delegate;       		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33171,7 +33171,7 @@ public:
 	struct FScriptDelegate                             __OnReadAchievementsComplete__Delegate;           		// 0x01A0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33295,7 +33295,7 @@ public:
 	struct FScriptDelegate                             __OnDeviceSelectionComplete__Delegate;            		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33335,7 +33335,7 @@ public:
 	struct FScriptDelegate                             __OnLinkStatusChange__Delegate;                   		// 0x00B0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33387,7 +33387,7 @@ public:
 	struct FScriptDelegate                             __OnGameInviteAccepted__Delegate;                 		// 0x0110 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33462,7 +33462,7 @@ public:
 	struct FScriptDelegate                             __OnContentChange__Delegate;                      		// 0x0080 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33491,7 +33491,7 @@ public:
 	struct FScriptDelegate                             __OnPlayerTalkingStateChange__Delegate;           		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33533,7 +33533,7 @@ public:
 	struct FScriptDelegate                             __OnReadOnlineStatsComplete__Delegate;            		// 0x0080 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33569,7 +33569,7 @@ public:
 	struct FScriptDelegate                             __OnReadNewsCompleted__Delegate;                  		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33589,7 +33589,7 @@ public:
 	struct FScriptDelegate                             __OnSendPartyGameInvitesComplete__Delegate;       		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33614,7 +33614,7 @@ public:
 	TArray<struct FCoverReplicationInfo>               CoverReplicationData;                             		// 0x028C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33671,7 +33671,7 @@ public:
 	FString                                            SpecEnteredMessage;                               		// 0x01D4 (0x0010) [0x0000000000408002]              ( CPF_Const | CPF_Localized | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33687,7 +33687,7 @@ public:
 	unsigned long                                      bDisplayMessages : 1;                             		// 0x05C4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33705,7 +33705,7 @@ class UDmgType_Suicided : public UKillZDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33721,7 +33721,7 @@ public:
 	unsigned long                                      bToggleTurning : 1;                               		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33738,7 +33738,7 @@ public:
 	class UForceFeedbackWaveform*                      FFWaveform;                                       		// 0x0100 (0x0008) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33759,7 +33759,7 @@ public:
 	unsigned long                                      bDroppedPickups : 1;                              		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000040] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33777,7 +33777,7 @@ public:
 	TArray<FString>                                    Commands;                                         		// 0x0108 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33793,7 +33793,7 @@ class USeqAct_FlyThroughHasEnded : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33809,7 +33809,7 @@ public:
 	unsigned long                                      bTopPriority : 1;                                 		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33831,7 +33831,7 @@ public:
 	unsigned long                                      bOverridePlayingAnim : 1;                         		// 0x0094 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33850,7 +33850,7 @@ public:
 	int                                                BlurWidth;                                        		// 0x00E4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33866,7 +33866,7 @@ public:
 	unsigned long                                      bMuteSpectators : 1;                              		// 0x0290 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33890,7 +33890,7 @@ public:
 	float                                              InterpTime;                                       		// 0x02D8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33906,7 +33906,7 @@ class ADebugCameraHUD : public AHUD
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33923,7 +33923,7 @@ class UDebugCameraInput : public UPlayerInput
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33939,7 +33939,7 @@ public:
 	class APhysicsVolume*                              V;                                                		// 0x028C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33956,7 +33956,7 @@ public:
 	class AActor*                                      DamageInstigator;                                 		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33970,7 +33970,7 @@ class UDmgType_Crushed : public UDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33984,7 +33984,7 @@ class UDmgType_Fell : public UDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33998,7 +33998,7 @@ class UDmgType_Telefragged : public UDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34013,7 +34013,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x031C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34028,7 +34028,7 @@ class ADynamicSMActor_Spawnable : public ADynamicSMActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34043,7 +34043,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x02CC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34061,7 +34061,7 @@ public:
 	unsigned long                                      bOverrideScalar : 1;                              		// 0x010C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34076,7 +34076,7 @@ public:
 	FString                                            FailMessage[ 0x4 ];                               		// 0x0074 (0x0040) [0x0000000000408002]              ( CPF_Const | CPF_Localized | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34092,7 +34092,7 @@ class AFracturedSMActorSpawnable : public AFracturedStaticMeshActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34107,7 +34107,7 @@ public:
 	class UObject*                                     SpawnPoint;                                       		// 0x0128 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34135,7 +34135,7 @@ public:
 	unsigned long                                      bPerformAutomaticLayout : 1;                      		// 0x06EC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34166,7 +34166,7 @@ class UUIMessageBox : public UUIMessageBoxBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34183,7 +34183,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x0294 (0x0004) [0x0000000100000020] [0x00000001] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34200,7 +34200,7 @@ class AInterpActor_ForCinematic : public AInterpActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34215,7 +34215,7 @@ public:
 	class UClass*                                      ControllerClass;                                  		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34232,7 +34232,7 @@ public:
 	unsigned long                                      bForceReplace : 1;                                		// 0x0108 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34246,7 +34246,7 @@ class ANavMeshBoundsVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34265,7 +34265,7 @@ public:
 	struct FScriptDelegate                             __OnReadContentListComplete__Delegate;            		// 0x00A0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34304,7 +34304,7 @@ class UOnlineEventsInterface : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34325,7 +34325,7 @@ public:
 	int                                                GameTypeId;                                       		// 0x00E0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34344,7 +34344,7 @@ public:
 	unsigned long                                      bIsArbitrated : 1;                                		// 0x00E0 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34366,7 +34366,7 @@ public:
 	int                                                RecentPartiesAddIndex;                            		// 0x00B4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34396,7 +34396,7 @@ class APathNode_Dynamic : public APathNode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34411,7 +34411,7 @@ class USeqEvent_AIReachedRouteActor : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34425,7 +34425,7 @@ class USeqEvent_PickupStatusChange : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34440,7 +34440,7 @@ public:
 	class URadialBlurComponent*                        RadialBlur;                                       		// 0x028C (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34458,7 +34458,7 @@ public:
 	unsigned long                                      bEnableLinearvelocityDrive : 1;                   		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34472,7 +34472,7 @@ class ARB_BSJointActor : public ARB_ConstraintActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34486,7 +34486,7 @@ class ARB_ConstraintActorSpawnable : public ARB_ConstraintActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34500,7 +34500,7 @@ class ARB_HingeActor : public ARB_ConstraintActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34514,7 +34514,7 @@ class ARB_PrismaticActor : public ARB_ConstraintActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34528,7 +34528,7 @@ class ARB_PulleyJointActor : public ARB_ConstraintActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34542,7 +34542,7 @@ class USeqAct_AddRemoveFaceFXAnimSet : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34556,7 +34556,7 @@ class USeqAct_AIAbortMoveToActor : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34573,7 +34573,7 @@ public:
 	struct SFXName                                     ParamName;                                        		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34590,7 +34590,7 @@ public:
 	struct SFXName                                     ParamName;                                        		// 0x0110 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34607,7 +34607,7 @@ public:
 	struct SFXName                                     Value;                                            		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34624,7 +34624,7 @@ public:
 	struct SFXName                                     SkelControlName;                                  		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34639,7 +34639,7 @@ public:
 	struct FVector                                     DefaultValue;                                     		// 0x00F8 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34654,7 +34654,7 @@ class USeqAct_UpdatePhysBonesFromAnim : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34672,7 +34672,7 @@ public:
 	unsigned long                                      bCheckForObstructions : 1;                        		// 0x0130 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34688,7 +34688,7 @@ class USeqVar_Byte : public USequenceVariable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34702,7 +34702,7 @@ class USeqVar_Union : public USequenceVariable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34716,7 +34716,7 @@ class USeqVar_UniqueNetId : public USequenceVariable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34730,7 +34730,7 @@ class UUISettingsClient : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34744,7 +34744,7 @@ class USessionSettingsProvider_GameInfo : public USessionSettingsProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34758,7 +34758,7 @@ class ASkeletalMeshActorMATSpawnable : public ASkeletalMeshActorMAT
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34772,7 +34772,7 @@ class ATrigger_Dynamic : public ATrigger
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34787,7 +34787,7 @@ public:
 	TArray<class APlayerController*>                   PCsWithLOS;                                       		// 0x029C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34804,7 +34804,7 @@ public:
 	unsigned long                                      bOpen : 1;                                        		// 0x0394 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34822,7 +34822,7 @@ public:
 	TArray<struct FLevelStreamingData>                 Levels;                                           		// 0x029C (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34838,7 +34838,7 @@ public:
 	FString                                            Command;                                          		// 0x00FC (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34852,7 +34852,7 @@ class UUIEvent_Initialized : public UUIEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34870,7 +34870,7 @@ public:
 	unsigned long                                      bIsDisabled : 1;                                  		// 0x00E8 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34885,7 +34885,7 @@ class UUIFocusHint : public UUILabel
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34904,7 +34904,7 @@ public:
 	unsigned long                                      bIsDisabled : 1;                                  		// 0x00E8 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34924,7 +34924,7 @@ public:
 	class USoundCue*                                   ExitSound;                                        		// 0x033C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34943,7 +34943,7 @@ public:
 	class UWindDirectionalSourceComponent*             Component;                                        		// 0x028C (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -229,7 +229,7 @@ public:
 	int                                                BeaconPort;                                       		// 0x0068 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -248,7 +248,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x110 ];                           		// 0x0AC0 (0x0110) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -271,7 +271,7 @@ public:
 	unsigned char                                      ReceiveMode;                                      		// 0x02AF (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -299,7 +299,7 @@ public:
 	unsigned char                                      LinkState;                                        		// 0x02EC (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -329,7 +329,7 @@ public:
 	FPointer                                           VfTable_FTickableObject;                          		// 0x0060 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -347,7 +347,7 @@ public:
 	unsigned long                                      bBinaryStats : 1;                                 		// 0x0098 (0x0004) [0x0000000000004002] [0x00000001] ( CPF_Const | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -368,7 +368,7 @@ public:
 	unsigned long                                      bNeedsTicking : 1;                                		// 0x0098 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -394,7 +394,7 @@ public:
 	float                                              TimeOut;                                          		// 0x00B4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -431,7 +431,7 @@ public:
 	int                                                MaxBandwidthHistoryEntries;                       		// 0x00A0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -462,7 +462,7 @@ public:
 	unsigned char                                      ClientBeaconRequestType;                          		// 0x016D (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -497,7 +497,7 @@ public:
 	unsigned long                                      bAllowBandwidthTesting : 1;                       		// 0x0120 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -536,7 +536,7 @@ public:
 	unsigned long                                      bIsUsingSpeechRecognition : 1;                    		// 0x0174 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -587,7 +587,7 @@ public:
 	unsigned char                                      LanBeaconState;                                   		// 0x01E5 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -669,7 +669,7 @@ public:
 	struct FScriptDelegate                             __OnDestroyComplete__Delegate;                    		// 0x0088 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -699,7 +699,7 @@ public:
 	unsigned char                                      ClientBeaconRequestType;                          		// 0x013D (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -735,7 +735,7 @@ public:
 	unsigned long                                      bBestFitTeamAssignment : 1;                       		// 0x0108 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -770,7 +770,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x28 ];                            		// 0x606C (0x0028) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -787,7 +787,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x1C ];                            		// 0x01D4 (0x001C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -810,7 +810,7 @@ public:
 	unsigned char                                      RequestType;                                      		// 0x0144 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -845,7 +845,7 @@ public:
 	unsigned long                                      bSentResponse : 1;                                		// 0x00E0 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -883,7 +883,7 @@ public:
 	class AWebServer*                                  WebServer;                                        		// 0x0078 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -915,7 +915,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x04B8 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -934,7 +934,7 @@ class UHelloWeb : public UWebApplication
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -950,7 +950,7 @@ class UImageServer : public UWebApplication
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -967,7 +967,7 @@ public:
 	class UOnlineTitleFileDownloadMcp*                 Downloader;                                       		// 0x0098 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -997,7 +997,7 @@ public:
 	unsigned long                                      bDelayCleanup : 1;                                		// 0x0330 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
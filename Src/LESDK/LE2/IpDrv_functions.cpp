@@ -28,38 +28,29 @@
 
 
 
-class UClass* UClientBeaconAddressResolver::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UClientBeaconAddressResolver::pClassPointer { L"Class IpDrv.ClientBeaconAddressResolver", &UObject::FindClass };
 
 class UClass* UClientBeaconAddressResolver::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.ClientBeaconAddressResolver" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UHTTPDownload::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UHTTPDownload::pClassPointer { L"Class IpDrv.HTTPDownload", &UObject::FindClass };
 
 class UClass* UHTTPDownload::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.HTTPDownload" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* AInternetLink::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> AInternetLink::pClassPointer { L"Class IpDrv.InternetLink", &UObject::FindClass };
 
 class UClass* AInternetLink::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.InternetLink" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.InternetLink.ResolveFailed
@@ -68,10 +59,9 @@ class UClass* AInternetLink::StaticClass()
 
 void AInternetLink::eventResolveFailed ( )
 {
-	static UFunction* pFnResolveFailed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResolveFailedRef { L"Function IpDrv.InternetLink.ResolveFailed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResolveFailed )
-		pFnResolveFailed = UObject::FindObject< UFunction > ( L"Function IpDrv.InternetLink.ResolveFailed" );
+	UFunction* const pFnResolveFailed = pFnResolveFailedRef.Get ( );
 
 	AInternetLink_eventResolveFailed_Parms ResolveFailed_Parms;
 
@@ -85,10 +75,9 @@ void AInternetLink::eventResolveFailed ( )
 
 void AInternetLink::eventResolved ( struct FIpAddr const& Addr )
 {
-	static UFunction* pFnResolved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResolvedRef { L"Function IpDrv.InternetLink.Resolved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResolved )
-		pFnResolved = UObject::FindObject< UFunction > ( L"Function IpDrv.InternetLink.Resolved" );
+	UFunction* const pFnResolved = pFnResolvedRef.Get ( );
 
 	AInternetLink_eventResolved_Parms Resolved_Parms;
 	memcpy ( &Resolved_Parms.Addr, &Addr, 0x14 );
@@ -103,21 +92,17 @@ void AInternetLink::eventResolved ( struct FIpAddr const& Addr )
 
 void AInternetLink::GetLocalIP ( struct FIpAddr* arg )
 {
-	static UFunction* pFnGetLocalIP = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLocalIPRef { L"Function IpDrv.InternetLink.GetLocalIP", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLocalIP )
-		pFnGetLocalIP = UObject::FindObject< UFunction > ( L"Function IpDrv.InternetLink.GetLocalIP" );
+	UFunction* const pFnGetLocalIP = pFnGetLocalIPRef.Get ( );
 
 	AInternetLink_execGetLocalIP_Parms GetLocalIP_Parms;
 
 	if ( arg )
 		memcpy ( &GetLocalIP_Parms.arg, arg, 0x14 );
 
-	pFnGetLocalIP->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetLocalIP, &GetLocalIP_Parms, NULL );
-
-	pFnGetLocalIP->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetLocalIP, &GetLocalIP_Parms ) )
+		this->ProcessEvent ( pFnGetLocalIP, &GetLocalIP_Parms, NULL );
 
 	if ( arg )
 		memcpy ( arg, &GetLocalIP_Parms.arg, 0x14 );
@@ -132,10 +117,9 @@ void AInternetLink::GetLocalIP ( struct FIpAddr* arg )
 
 bool AInternetLink::StringToIpAddr ( FString const& Str, struct FIpAddr* Addr )
 {
-	static UFunction* pFnStringToIpAddr = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStringToIpAddrRef { L"Function IpDrv.InternetLink.StringToIpAddr", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStringToIpAddr )
-		pFnStringToIpAddr = UObject::FindObject< UFunction > ( L"Function IpDrv.InternetLink.StringToIpAddr" );
+	UFunction* const pFnStringToIpAddr = pFnStringToIpAddrRef.Get ( );
 
 	AInternetLink_execStringToIpAddr_Parms StringToIpAddr_Parms;
 	memcpy ( &StringToIpAddr_Parms.Str, &Str, 0x10 );
@@ -143,11 +127,8 @@ bool AInternetLink::StringToIpAddr ( FString const& Str, struct FIpAddr* Addr )
 	if ( Addr )
 		memcpy ( &StringToIpAddr_Parms.Addr, Addr, 0x14 );
 
-	pFnStringToIpAddr->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnStringToIpAddr, &StringToIpAddr_Parms, NULL );
-
-	pFnStringToIpAddr->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnStringToIpAddr, &StringToIpAddr_Parms ) )
+		this->ProcessEvent ( pFnStringToIpAddr, &StringToIpAddr_Parms, NULL );
 
 	if ( Addr )
 		memcpy ( Addr, &StringToIpAddr_Parms.Addr, 0x14 );
@@ -163,19 +144,15 @@ bool AInternetLink::StringToIpAddr ( FString const& Str, struct FIpAddr* Addr )
 
 FString AInternetLink::IpAddrToString ( struct FIpAddr const& arg )
 {
-	static UFunction* pFnIpAddrToString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIpAddrToStringRef { L"Function IpDrv.InternetLink.IpAddrToString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIpAddrToString )
-		pFnIpAddrToString = UObject::FindObject< UFunction > ( L"Function IpDrv.InternetLink.IpAddrToString" );
+	UFunction* const pFnIpAddrToString = pFnIpAddrToStringRef.Get ( );
 
 	AInternetLink_execIpAddrToString_Parms IpAddrToString_Parms;
 	memcpy ( &IpAddrToString_Parms.arg, &arg, 0x14 );
 
-	pFnIpAddrToString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIpAddrToString, &IpAddrToString_Parms, NULL );
-
-	pFnIpAddrToString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIpAddrToString, &IpAddrToString_Parms ) )
+		this->ProcessEvent ( pFnIpAddrToString, &IpAddrToString_Parms, NULL );
 
 	return IpAddrToString_Parms.ReturnValue;
 };
@@ -187,18 +164,14 @@ FString AInternetLink::IpAddrToString ( struct FIpAddr const& arg )
 
 int AInternetLink::GetLastError ( )
 {
-	static UFunction* pFnGetLastError = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLastErrorRef { L"Function IpDrv.InternetLink.GetLastError", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLastError )
-		pFnGetLastError = UObject::FindObject< UFunction > ( L"Function IpDrv.InternetLink.GetLastError" );
+	UFunction* const pFnGetLastError = pFnGetLastErrorRef.Get ( );
 
 	AInternetLink_execGetLastError_Parms GetLastError_Parms;
 
-	pFnGetLastError->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetLastError, &GetLastError_Parms, NULL );
-
-	pFnGetLastError->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetLastError, &GetLastError_Parms ) )
+		this->ProcessEvent ( pFnGetLastError, &GetLastError_Parms, NULL );
 
 	return GetLastError_Parms.ReturnValue;
 };
@@ -210,19 +183,15 @@ int AInternetLink::GetLastError ( )
 
 void AInternetLink::Resolve ( FString const& Domain )
 {
-	static UFunction* pFnResolve = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResolveRef { L"Function IpDrv.InternetLink.Resolve", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResolve )
-		pFnResolve = UObject::FindObject< UFunction > ( L"Function IpDrv.InternetLink.Resolve" );
+	UFunction* const pFnResolve = pFnResolveRef.Get ( );
 
 	AInternetLink_execResolve_Parms Resolve_Parms;
 	memcpy ( &Resolve_Parms.Domain, &Domain, 0x10 );
 
-	pFnResolve->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnResolve, &Resolve_Parms, NULL );
-
-	pFnResolve->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnResolve, &Resolve_Parms ) )
+		this->ProcessEvent ( pFnResolve, &Resolve_Parms, NULL );
 };
 
 // Function IpDrv.InternetLink.ParseURL
@@ -237,10 +206,9 @@ void AInternetLink::Resolve ( FString const& Domain )
 
 bool AInternetLink::ParseURL ( FString const& URL, FString* Addr, int* PortNum, FString* LevelName, FString* EntryName )
 {
-	static UFunction* pFnParseURL = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnParseURLRef { L"Function IpDrv.InternetLink.ParseURL", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnParseURL )
-		pFnParseURL = UObject::FindObject< UFunction > ( L"Function IpDrv.InternetLink.ParseURL" );
+	UFunction* const pFnParseURL = pFnParseURLRef.Get ( );
 
 	AInternetLink_execParseURL_Parms ParseURL_Parms;
 	memcpy ( &ParseURL_Parms.URL, &URL, 0x10 );
@@ -257,11 +225,8 @@ bool AInternetLink::ParseURL ( FString const& URL, FString* Addr, int* PortNum,
 	if ( EntryName )
 		memcpy ( &ParseURL_Parms.EntryName, EntryName, 0x10 );
 
-	pFnParseURL->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnParseURL, &ParseURL_Parms, NULL );
-
-	pFnParseURL->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnParseURL, &ParseURL_Parms ) )
+		this->ProcessEvent ( pFnParseURL, &ParseURL_Parms, NULL );
 
 	if ( Addr )
 		memcpy ( Addr, &ParseURL_Parms.Addr, 0x10 );
@@ -285,32 +250,25 @@ bool AInternetLink::ParseURL ( FString const& URL, FString* Addr, int* PortNum,
 
 bool AInternetLink::IsDataPending ( )
 {
-	static UFunction* pFnIsDataPending = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsDataPendingRef { L"Function IpDrv.InternetLink.IsDataPending", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsDataPending )
-		pFnIsDataPending = UObject::FindObject< UFunction > ( L"Function IpDrv.InternetLink.IsDataPending" );
+	UFunction* const pFnIsDataPending = pFnIsDataPendingRef.Get ( );
 
 	AInternetLink_execIsDataPending_Parms IsDataPending_Parms;
 
-	pFnIsDataPending->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsDataPending, &IsDataPending_Parms, NULL );
-
-	pFnIsDataPending->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsDataPending, &IsDataPending_Parms ) )
+		this->ProcessEvent ( pFnIsDataPending, &IsDataPending_Parms, NULL );
 
 	return IsDataPending_Parms.ReturnValue;
 };
 
 
 
-class UClass* ATcpLink::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ATcpLink::pClassPointer { L"Class IpDrv.TcpLink", &UObject::FindClass };
 
 class UClass* ATcpLink::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.TcpLink" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.TcpLink.ReceivedBinary
@@ -321,10 +279,9 @@ class UClass* ATcpLink::StaticClass()
 
 void ATcpLink::eventReceivedBinary ( int Count, unsigned char* B )
 {
-	static UFunction* pFnReceivedBinary = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReceivedBinaryRef { L"Function IpDrv.TcpLink.ReceivedBinary", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReceivedBinary )
-		pFnReceivedBinary = UObject::FindObject< UFunction > ( L"Function IpDrv.TcpLink.ReceivedBinary" );
+	UFunction* const pFnReceivedBinary = pFnReceivedBinaryRef.Get ( );
 
 	ATcpLink_eventReceivedBinary_Parms ReceivedBinary_Parms;
 	ReceivedBinary_Parms.Count = Count;
@@ -340,10 +297,9 @@ void ATcpLink::eventReceivedBinary ( int Count, unsigned char* B )
 
 void ATcpLink::eventReceivedLine ( FString const& Line )
 {
-	static UFunction* pFnReceivedLine = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReceivedLineRef { L"Function IpDrv.TcpLink.ReceivedLine", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReceivedLine )
-		pFnReceivedLine = UObject::FindObject< UFunction > ( L"Function IpDrv.TcpLink.ReceivedLine" );
+	UFunction* const pFnReceivedLine = pFnReceivedLineRef.Get ( );
 
 	ATcpLink_eventReceivedLine_Parms ReceivedLine_Parms;
 	memcpy ( &ReceivedLine_Parms.Line, &Line, 0x10 );
@@ -358,10 +314,9 @@ void ATcpLink::eventReceivedLine ( FString const& Line )
 
 void ATcpLink::eventReceivedText ( FString const& Text )
 {
-	static UFunction* pFnReceivedText = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReceivedTextRef { L"Function IpDrv.TcpLink.ReceivedText", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReceivedText )
-		pFnReceivedText = UObject::FindObject< UFunction > ( L"Function IpDrv.TcpLink.ReceivedText" );
+	UFunction* const pFnReceivedText = pFnReceivedTextRef.Get ( );
 
 	ATcpLink_eventReceivedText_Parms ReceivedText_Parms;
 	memcpy ( &ReceivedText_Parms.Text, &Text, 0x10 );
@@ -375,10 +330,9 @@ void ATcpLink::eventReceivedText ( FString const& Text )
 
 void ATcpLink::eventClosed ( )
 {
-	static UFunction* pFnClosed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClosedRef { L"Function IpDrv.TcpLink.Closed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClosed )
-		pFnClosed = UObject::FindObject< UFunction > ( L"Function IpDrv.TcpLink.Closed" );
+	UFunction* const pFnClosed = pFnClosedRef.Get ( );
 
 	ATcpLink_eventClosed_Parms Closed_Parms;
 
@@ -391,10 +345,9 @@ void ATcpLink::eventClosed ( )
 
 void ATcpLink::eventOpened ( )
 {
-	static UFunction* pFnOpened = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOpenedRef { L"Function IpDrv.TcpLink.Opened", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOpened )
-		pFnOpened = UObject::FindObject< UFunction > ( L"Function IpDrv.TcpLink.Opened" );
+	UFunction* const pFnOpened = pFnOpenedRef.Get ( );
 
 	ATcpLink_eventOpened_Parms Opened_Parms;
 
@@ -407,10 +360,9 @@ void ATcpLink::eventOpened ( )
 
 void ATcpLink::eventAccepted ( )
 {
-	static UFunction* pFnAccepted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAcceptedRef { L"Function IpDrv.TcpLink.Accepted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAccepted )
-		pFnAccepted = UObject::FindObject< UFunction > ( L"Function IpDrv.TcpLink.Accepted" );
+	UFunction* const pFnAccepted = pFnAcceptedRef.Get ( );
 
 	ATcpLink_eventAccepted_Parms Accepted_Parms;
 
@@ -426,10 +378,9 @@ void ATcpLink::eventAccepted ( )
 
 int ATcpLink::ReadBinary ( int Count, unsigned char* B )
 {
-	static UFunction* pFnReadBinary = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReadBinaryRef { L"Function IpDrv.TcpLink.ReadBinary", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReadBinary )
-		pFnReadBinary = UObject::FindObject< UFunction > ( L"Function IpDrv.TcpLink.ReadBinary" );
+	UFunction* const pFnReadBinary = pFnReadBinaryRef.Get ( );
 
 	ATcpLink_execReadBinary_Parms ReadBinary_Parms;
 	ReadBinary_Parms.Count = Count;
@@ -437,11 +388,8 @@ int ATcpLink::ReadBinary ( int Count, unsigned char* B )
 	if ( B )
 		memcpy ( &ReadBinary_Parms.B, B, 0xFF );
 
-	pFnReadBinary->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnReadBinary, &ReadBinary_Parms, NULL );
-
-	pFnReadBinary->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnReadBinary, &ReadBinary_Parms ) )
+		this->ProcessEvent ( pFnReadBinary, &ReadBinary_Parms, NULL );
 
 	if ( B )
 		memcpy ( B, &ReadBinary_Parms.B, 0xFF );
@@ -457,21 +405,17 @@ int ATcpLink::ReadBinary ( int Count, unsigned char* B )
 
 int ATcpLink::ReadText ( FString* Str )
 {
-	static UFunction* pFnReadText = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReadTextRef { L"Function IpDrv.TcpLink.ReadText", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReadText )
-		pFnReadText = UObject::FindObject< UFunction > ( L"Function IpDrv.TcpLink.ReadText" );
+	UFunction* const pFnReadText = pFnReadTextRef.Get ( );
 
 	ATcpLink_execReadText_Parms ReadText_Parms;
 
 	if ( Str )
 		memcpy ( &ReadText_Parms.Str, Str, 0x10 );
 
-	pFnReadText->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnReadText, &ReadText_Parms, NULL );
-
-	pFnReadText->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnReadText, &ReadText_Parms ) )
+		this->ProcessEvent ( pFnReadText, &ReadText_Parms, NULL );
 
 	if ( Str )
 		memcpy ( Str, &ReadText_Parms.Str, 0x10 );
@@ -488,20 +432,16 @@ int ATcpLink::ReadText ( FString* Str )
 
 int ATcpLink::SendBinary ( int Count, unsigned char* B )
 {
-	static UFunction* pFnSendBinary = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSendBinaryRef { L"Function IpDrv.TcpLink.SendBinary", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSendBinary )
-		pFnSendBinary = UObject::FindObject< UFunction > ( L"Function IpDrv.TcpLink.SendBinary" );
+	UFunction* const pFnSendBinary = pFnSendBinaryRef.Get ( );
 
 	ATcpLink_execSendBinary_Parms SendBinary_Parms;
 	SendBinary_Parms.Count = Count;
 	memcpy ( &SendBinary_Parms.B, &B, 0xFF );
 
-	pFnSendBinary->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSendBinary, &SendBinary_Parms, NULL );
-
-	pFnSendBinary->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSendBinary, &SendBinary_Parms ) )
+		this->ProcessEvent ( pFnSendBinary, &SendBinary_Parms, NULL );
 
 	return SendBinary_Parms.ReturnValue;
 };
@@ -514,19 +454,15 @@ int ATcpLink::SendBinary ( int Count, unsigned char* B )
 
 int ATcpLink::SendText ( FString const& Str )
 {
-	static UFunction* pFnSendText = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSendTextRef { L"Function IpDrv.TcpLink.SendText", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSendText )
-		pFnSendText = UObject::FindObject< UFunction > ( L"Function IpDrv.TcpLink.SendText" );
+	UFunction* const pFnSendText = pFnSendTextRef.Get ( );
 
 	ATcpLink_execSendText_Parms SendText_Parms;
 	memcpy ( &SendText_Parms.Str, &Str, 0x10 );
 
-	pFnSendText->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSendText, &SendText_Parms, NULL );
-
-	pFnSendText->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSendText, &SendText_Parms ) )
+		this->ProcessEvent ( pFnSendText, &SendText_Parms, NULL );
 
 	return SendText_Parms.ReturnValue;
 };
@@ -538,18 +474,14 @@ int ATcpLink::SendText ( FString const& Str )
 
 bool ATcpLink::IsConnected ( )
 {
-	static UFunction* pFnIsConnected = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsConnectedRef { L"Function IpDrv.TcpLink.IsConnected", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsConnected )
-		pFnIsConnected = UObject::FindObject< UFunction > ( L"Function IpDrv.TcpLink.IsConnected" );
+	UFunction* const pFnIsConnected = pFnIsConnectedRef.Get ( );
 
 	ATcpLink_execIsConnected_Parms IsConnected_Parms;
 
-	pFnIsConnected->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsConnected, &IsConnected_Parms, NULL );
-
-	pFnIsConnected->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsConnected, &IsConnected_Parms ) )
+		this->ProcessEvent ( pFnIsConnected, &IsConnected_Parms, NULL );
 
 	return IsConnected_Parms.ReturnValue;
 };
@@ -561,18 +493,14 @@ bool ATcpLink::IsConnected ( )
 
 bool ATcpLink::Close ( )
 {
-	static UFunction* pFnClose = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCloseRef { L"Function IpDrv.TcpLink.Close", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClose )
-		pFnClose = UObject::FindObject< UFunction > ( L"Function IpDrv.TcpLink.Close" );
+	UFunction* const pFnClose = pFnCloseRef.Get ( );
 
 	ATcpLink_execClose_Parms Close_Parms;
 
-	pFnClose->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnClose, &Close_Parms, NULL );
-
-	pFnClose->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnClose, &Close_Parms ) )
+		this->ProcessEvent ( pFnClose, &Close_Parms, NULL );
 
 	return Close_Parms.ReturnValue;
 };
@@ -585,19 +513,15 @@ bool ATcpLink::Close ( )
 
 bool ATcpLink::Open ( struct FIpAddr const& Addr )
 {
-	static UFunction* pFnOpen = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOpenRef { L"Function IpDrv.TcpLink.Open", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOpen )
-		pFnOpen = UObject::FindObject< UFunction > ( L"Function IpDrv.TcpLink.Open" );
+	UFunction* const pFnOpen = pFnOpenRef.Get ( );
 
 	ATcpLink_execOpen_Parms Open_Parms;
 	memcpy ( &Open_Parms.Addr, &Addr, 0x14 );
 
-	pFnOpen->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnOpen, &Open_Parms, NULL );
-
-	pFnOpen->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnOpen, &Open_Parms ) )
+		this->ProcessEvent ( pFnOpen, &Open_Parms, NULL );
 
 	return Open_Parms.ReturnValue;
 };
@@ -609,18 +533,14 @@ bool ATcpLink::Open ( struct FIpAddr const& Addr )
 
 bool ATcpLink::Listen ( )
 {
-	static UFunction* pFnListen = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnListenRef { L"Function IpDrv.TcpLink.Listen", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnListen )
-		pFnListen = UObject::FindObject< UFunction > ( L"Function IpDrv.TcpLink.Listen" );
+	UFunction* const pFnListen = pFnListenRef.Get ( );
 
 	ATcpLink_execListen_Parms Listen_Parms;
 
-	pFnListen->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnListen, &Listen_Parms, NULL );
-
-	pFnListen->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnListen, &Listen_Parms ) )
+		this->ProcessEvent ( pFnListen, &Listen_Parms, NULL );
 
 	return Listen_Parms.ReturnValue;
 };
@@ -634,46 +554,36 @@ bool ATcpLink::Listen ( )
 
 int ATcpLink::BindPort ( int PortNum, unsigned long bUseNextAvailable )
 {
-	static UFunction* pFnBindPort = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBindPortRef { L"Function IpDrv.TcpLink.BindPort", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBindPort )
-		pFnBindPort = UObject::FindObject< UFunction > ( L"Function IpDrv.TcpLink.BindPort" );
+	UFunction* const pFnBindPort = pFnBindPortRef.Get ( );
 
 	ATcpLink_execBindPort_Parms BindPort_Parms;
 	BindPort_Parms.PortNum = PortNum;
 	BindPort_Parms.bUseNextAvailable = bUseNextAvailable;
 
-	pFnBindPort->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnBindPort, &BindPort_Parms, NULL );
-
-	pFnBindPort->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnBindPort, &BindPort_Parms ) )
+		this->ProcessEvent ( pFnBindPort, &BindPort_Parms, NULL );
 
 	return BindPort_Parms.ReturnValue;
 };
 
 
 
-class UClass* UMCPBase::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UMCPBase::pClassPointer { L"Class IpDrv.MCPBase", &UObject::FindClass };
 
 class UClass* UMCPBase::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.MCPBase" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UOnlineEventsInterfaceMcp::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UOnlineEventsInterfaceMcp::pClassPointer { L"Class IpDrv.OnlineEventsInterfaceMcp", &UObject::FindClass };
 
 class UClass* UOnlineEventsInterfaceMcp::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.OnlineEventsInterfaceMcp" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.OnlineEventsInterfaceMcp.UploadHardwareData
@@ -685,10 +595,9 @@ class UClass* UOnlineEventsInterfaceMcp::StaticClass()
 
 bool UOnlineEventsInterfaceMcp::UploadHardwareData ( struct FUniqueNetId const& UniqueId, FString const& PlayerNick )
 {
-	static UFunction* pFnUploadHardwareData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUploadHardwareDataRef { L"Function IpDrv.OnlineEventsInterfaceMcp.UploadHardwareData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUploadHardwareData )
-		pFnUploadHardwareData = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineEventsInterfaceMcp.UploadHardwareData" );
+	UFunction* const pFnUploadHardwareData = pFnUploadHardwareDataRef.Get ( );
 
 	UOnlineEventsInterfaceMcp_execUploadHardwareData_Parms UploadHardwareData_Parms;
 	memcpy ( &UploadHardwareData_Parms.UniqueId, &UniqueId, 0x8 );
@@ -707,19 +616,15 @@ bool UOnlineEventsInterfaceMcp::UploadHardwareData ( struct FUniqueNetId const&
 
 bool UOnlineEventsInterfaceMcp::UploadGameplayEventsData ( class UOnlineGameplayEvents* Events )
 {
-	static UFunction* pFnUploadGameplayEventsData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUploadGameplayEventsDataRef { L"Function IpDrv.OnlineEventsInterfaceMcp.UploadGameplayEventsData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUploadGameplayEventsData )
-		pFnUploadGameplayEventsData = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineEventsInterfaceMcp.UploadGameplayEventsData" );
+	UFunction* const pFnUploadGameplayEventsData = pFnUploadGameplayEventsDataRef.Get ( );
 
 	UOnlineEventsInterfaceMcp_execUploadGameplayEventsData_Parms UploadGameplayEventsData_Parms;
 	UploadGameplayEventsData_Parms.Events = Events;
 
-	pFnUploadGameplayEventsData->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnUploadGameplayEventsData, &UploadGameplayEventsData_Parms, NULL );
-
-	pFnUploadGameplayEventsData->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnUploadGameplayEventsData, &UploadGameplayEventsData_Parms ) )
+		this->ProcessEvent ( pFnUploadGameplayEventsData, &UploadGameplayEventsData_Parms, NULL );
 
 	return UploadGameplayEventsData_Parms.ReturnValue;
 };
@@ -734,35 +639,28 @@ bool UOnlineEventsInterfaceMcp::UploadGameplayEventsData ( class UOnlineGameplay
 
 bool UOnlineEventsInterfaceMcp::UploadProfileData ( struct FUniqueNetId const& UniqueId, FString const& PlayerNick, class UOnlineProfileSettings* ProfileSettings )
 {
-	static UFunction* pFnUploadProfileData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUploadProfileDataRef { L"Function IpDrv.OnlineEventsInterfaceMcp.UploadProfileData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUploadProfileData )
-		pFnUploadProfileData = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineEventsInterfaceMcp.UploadProfileData" );
+	UFunction* const pFnUploadProfileData = pFnUploadProfileDataRef.Get ( );
 
 	UOnlineEventsInterfaceMcp_execUploadProfileData_Parms UploadProfileData_Parms;
 	memcpy ( &UploadProfileData_Parms.UniqueId, &UniqueId, 0x8 );
 	memcpy ( &UploadProfileData_Parms.PlayerNick, &PlayerNick, 0x10 );
 	UploadProfileData_Parms.ProfileSettings = ProfileSettings;
 
-	pFnUploadProfileData->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnUploadProfileData, &UploadProfileData_Parms, NULL );
-
-	pFnUploadProfileData->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnUploadProfileData, &UploadProfileData_Parms ) )
+		this->ProcessEvent ( pFnUploadProfileData, &UploadProfileData_Parms, NULL );
 
 	return UploadProfileData_Parms.ReturnValue;
 };
 
 
 
-class UClass* UOnlineNewsInterfaceMcp::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UOnlineNewsInterfaceMcp::pClassPointer { L"Class IpDrv.OnlineNewsInterfaceMcp", &UObject::FindClass };
 
 class UClass* UOnlineNewsInterfaceMcp::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.OnlineNewsInterfaceMcp" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.OnlineNewsInterfaceMcp.GetNews
@@ -774,10 +672,9 @@ class UClass* UOnlineNewsInterfaceMcp::StaticClass()
 
 FString UOnlineNewsInterfaceMcp::GetNews ( unsigned char LocalUserNum, unsigned char NewsType )
 {
-	static UFunction* pFnGetNews = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetNewsRef { L"Function IpDrv.OnlineNewsInterfaceMcp.GetNews", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetNews )
-		pFnGetNews = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineNewsInterfaceMcp.GetNews" );
+	UFunction* const pFnGetNews = pFnGetNewsRef.Get ( );
 
 	UOnlineNewsInterfaceMcp_execGetNews_Parms GetNews_Parms;
 	GetNews_Parms.LocalUserNum = LocalUserNum;
@@ -795,10 +692,9 @@ FString UOnlineNewsInterfaceMcp::GetNews ( unsigned char LocalUserNum, unsigned
 
 void UOnlineNewsInterfaceMcp::ClearReadNewsCompletedDelegate ( struct FScriptDelegate ReadGameNewsDelegate )
 {
-	static UFunction* pFnClearReadNewsCompletedDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearReadNewsCompletedDelegateRef { L"Function IpDrv.OnlineNewsInterfaceMcp.ClearReadNewsCompletedDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearReadNewsCompletedDelegate )
-		pFnClearReadNewsCompletedDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineNewsInterfaceMcp.ClearReadNewsCompletedDelegate" );
+	UFunction* const pFnClearReadNewsCompletedDelegate = pFnClearReadNewsCompletedDelegateRef.Get ( );
 
 	UOnlineNewsInterfaceMcp_execClearReadNewsCompletedDelegate_Parms ClearReadNewsCompletedDelegate_Parms;
 	memcpy ( &ClearReadNewsCompletedDelegate_Parms.ReadGameNewsDelegate, &ReadGameNewsDelegate, 0x10 );
@@ -813,10 +709,9 @@ void UOnlineNewsInterfaceMcp::ClearReadNewsCompletedDelegate ( struct FScriptDel
 
 void UOnlineNewsInterfaceMcp::AddReadNewsCompletedDelegate ( struct FScriptDelegate ReadNewsDelegate )
 {
-	static UFunction* pFnAddReadNewsCompletedDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddReadNewsCompletedDelegateRef { L"Function IpDrv.OnlineNewsInterfaceMcp.AddReadNewsCompletedDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddReadNewsCompletedDelegate )
-		pFnAddReadNewsCompletedDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineNewsInterfaceMcp.AddReadNewsCompletedDelegate" );
+	UFunction* const pFnAddReadNewsCompletedDelegate = pFnAddReadNewsCompletedDelegateRef.Get ( );
 
 	UOnlineNewsInterfaceMcp_execAddReadNewsCompletedDelegate_Parms AddReadNewsCompletedDelegate_Parms;
 	memcpy ( &AddReadNewsCompletedDelegate_Parms.ReadNewsDelegate, &ReadNewsDelegate, 0x10 );
@@ -832,10 +727,9 @@ void UOnlineNewsInterfaceMcp::AddReadNewsCompletedDelegate ( struct FScriptDeleg
 
 void UOnlineNewsInterfaceMcp::OnReadNewsCompleted ( unsigned long bWasSuccessful, unsigned char NewsType )
 {
-	static UFunction* pFnOnReadNewsCompleted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReadNewsCompletedRef { L"Function IpDrv.OnlineNewsInterfaceMcp.OnReadNewsCompleted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReadNewsCompleted )
-		pFnOnReadNewsCompleted = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineNewsInterfaceMcp.OnReadNewsCompleted" );
+	UFunction* const pFnOnReadNewsCompleted = pFnOnReadNewsCompletedRef.Get ( );
 
 	UOnlineNewsInterfaceMcp_execOnReadNewsCompleted_Parms OnReadNewsCompleted_Parms;
 	OnReadNewsCompleted_Parms.bWasSuccessful = bWasSuccessful;
@@ -853,34 +747,27 @@ void UOnlineNewsInterfaceMcp::OnReadNewsCompleted ( unsigned long bWasSuccessful
 
 bool UOnlineNewsInterfaceMcp::ReadNews ( unsigned char LocalUserNum, unsigned char NewsType )
 {
-	static UFunction* pFnReadNews = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReadNewsRef { L"Function IpDrv.OnlineNewsInterfaceMcp.ReadNews", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReadNews )
-		pFnReadNews = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineNewsInterfaceMcp.ReadNews" );
+	UFunction* const pFnReadNews = pFnReadNewsRef.Get ( );
 
 	UOnlineNewsInterfaceMcp_execReadNews_Parms ReadNews_Parms;
 	ReadNews_Parms.LocalUserNum = LocalUserNum;
 	ReadNews_Parms.NewsType = NewsType;
 
-	pFnReadNews->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnReadNews, &ReadNews_Parms, NULL );
-
-	pFnReadNews->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnReadNews, &ReadNews_Parms ) )
+		this->ProcessEvent ( pFnReadNews, &ReadNews_Parms, NULL );
 
 	return ReadNews_Parms.ReturnValue;
 };
 
 
 
-class UClass* UOnlineTitleFileDownloadMcp::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UOnlineTitleFileDownloadMcp::pClassPointer { L"Class IpDrv.OnlineTitleFileDownloadMcp", &UObject::FindClass };
 
 class UClass* UOnlineTitleFileDownloadMcp::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.OnlineTitleFileDownloadMcp" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.OnlineTitleFileDownloadMcp.ClearDownloadedFiles
@@ -890,18 +777,14 @@ class UClass* UOnlineTitleFileDownloadMcp::StaticClass()
 
 bool UOnlineTitleFileDownloadMcp::ClearDownloadedFiles ( )
 {
-	static UFunction* pFnClearDownloadedFiles = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearDownloadedFilesRef { L"Function IpDrv.OnlineTitleFileDownloadMcp.ClearDownloadedFiles", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearDownloadedFiles )
-		pFnClearDownloadedFiles = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineTitleFileDownloadMcp.ClearDownloadedFiles" );
+	UFunction* const pFnClearDownloadedFiles = pFnClearDownloadedFilesRef.Get ( );
 
 	UOnlineTitleFileDownloadMcp_execClearDownloadedFiles_Parms ClearDownloadedFiles_Parms;
 
-	pFnClearDownloadedFiles->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnClearDownloadedFiles, &ClearDownloadedFiles_Parms, NULL );
-
-	pFnClearDownloadedFiles->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnClearDownloadedFiles, &ClearDownloadedFiles_Parms ) )
+		this->ProcessEvent ( pFnClearDownloadedFiles, &ClearDownloadedFiles_Parms, NULL );
 
 	return ClearDownloadedFiles_Parms.ReturnValue;
 };
@@ -914,10 +797,9 @@ bool UOnlineTitleFileDownloadMcp::ClearDownloadedFiles ( )
 
 unsigned char UOnlineTitleFileDownloadMcp::GetTitleFileState ( FString const& Filename )
 {
-	static UFunction* pFnGetTitleFileState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTitleFileStateRef { L"Function IpDrv.OnlineTitleFileDownloadMcp.GetTitleFileState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTitleFileState )
-		pFnGetTitleFileState = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineTitleFileDownloadMcp.GetTitleFileState" );
+	UFunction* const pFnGetTitleFileState = pFnGetTitleFileStateRef.Get ( );
 
 	UOnlineTitleFileDownloadMcp_execGetTitleFileState_Parms GetTitleFileState_Parms;
 	memcpy ( &GetTitleFileState_Parms.Filename, &Filename, 0x10 );
@@ -936,10 +818,9 @@ unsigned char UOnlineTitleFileDownloadMcp::GetTitleFileState ( FString const& Fi
 
 bool UOnlineTitleFileDownloadMcp::GetTitleFileContents ( FString const& Filename, TArray<unsigned char>* FileContents )
 {
-	static UFunction* pFnGetTitleFileContents = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTitleFileContentsRef { L"Function IpDrv.OnlineTitleFileDownloadMcp.GetTitleFileContents", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTitleFileContents )
-		pFnGetTitleFileContents = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineTitleFileDownloadMcp.GetTitleFileContents" );
+	UFunction* const pFnGetTitleFileContents = pFnGetTitleFileContentsRef.Get ( );
 
 	UOnlineTitleFileDownloadMcp_execGetTitleFileContents_Parms GetTitleFileContents_Parms;
 	memcpy ( &GetTitleFileContents_Parms.Filename, &Filename, 0x10 );
@@ -947,11 +828,8 @@ bool UOnlineTitleFileDownloadMcp::GetTitleFileContents ( FString const& Filename
 	if ( FileContents )
 		memcpy ( &GetTitleFileContents_Parms.FileContents, FileContents, 0x10 );
 
-	pFnGetTitleFileContents->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetTitleFileContents, &GetTitleFileContents_Parms, NULL );
-
-	pFnGetTitleFileContents->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetTitleFileContents, &GetTitleFileContents_Parms ) )
+		this->ProcessEvent ( pFnGetTitleFileContents, &GetTitleFileContents_Parms, NULL );
 
 	if ( FileContents )
 		memcpy ( FileContents, &GetTitleFileContents_Parms.FileContents, 0x10 );
@@ -966,10 +844,9 @@ bool UOnlineTitleFileDownloadMcp::GetTitleFileContents ( FString const& Filename
 
 void UOnlineTitleFileDownloadMcp::ClearReadTitleFileCompleteDelegate ( struct FScriptDelegate ReadTitleFileCompleteDelegate )
 {
-	static UFunction* pFnClearReadTitleFileCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearReadTitleFileCompleteDelegateRef { L"Function IpDrv.OnlineTitleFileDownloadMcp.ClearReadTitleFileCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearReadTitleFileCompleteDelegate )
-		pFnClearReadTitleFileCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineTitleFileDownloadMcp.ClearReadTitleFileCompleteDelegate" );
+	UFunction* const pFnClearReadTitleFileCompleteDelegate = pFnClearReadTitleFileCompleteDelegateRef.Get ( );
 
 	UOnlineTitleFileDownloadMcp_execClearReadTitleFileCompleteDelegate_Parms ClearReadTitleFileCompleteDelegate_Parms;
 	memcpy ( &ClearReadTitleFileCompleteDelegate_Parms.ReadTitleFileCompleteDelegate, &ReadTitleFileCompleteDelegate, 0x10 );
@@ -984,10 +861,9 @@ void UOnlineTitleFileDownloadMcp::ClearReadTitleFileCompleteDelegate ( struct FS
 
 void UOnlineTitleFileDownloadMcp::AddReadTitleFileCompleteDelegate ( struct FScriptDelegate ReadTitleFileCompleteDelegate )
 {
-	static UFunction* pFnAddReadTitleFileCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddReadTitleFileCompleteDelegateRef { L"Function IpDrv.OnlineTitleFileDownloadMcp.AddReadTitleFileCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddReadTitleFileCompleteDelegate )
-		pFnAddReadTitleFileCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineTitleFileDownloadMcp.AddReadTitleFileCompleteDelegate" );
+	UFunction* const pFnAddReadTitleFileCompleteDelegate = pFnAddReadTitleFileCompleteDelegateRef.Get ( );
 
 	UOnlineTitleFileDownloadMcp_execAddReadTitleFileCompleteDelegate_Parms AddReadTitleFileCompleteDelegate_Parms;
 	memcpy ( &AddReadTitleFileCompleteDelegate_Parms.ReadTitleFileCompleteDelegate, &ReadTitleFileCompleteDelegate, 0x10 );
@@ -1003,19 +879,15 @@ void UOnlineTitleFileDownloadMcp::AddReadTitleFileCompleteDelegate ( struct FScr
 
 bool UOnlineTitleFileDownloadMcp::ReadTitleFile ( FString const& FileToRead )
 {
-	static UFunction* pFnReadTitleFile = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReadTitleFileRef { L"Function IpDrv.OnlineTitleFileDownloadMcp.ReadTitleFile", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReadTitleFile )
-		pFnReadTitleFile = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineTitleFileDownloadMcp.ReadTitleFile" );
+	UFunction* const pFnReadTitleFile = pFnReadTitleFileRef.Get ( );
 
 	UOnlineTitleFileDownloadMcp_execReadTitleFile_Parms ReadTitleFile_Parms;
 	memcpy ( &ReadTitleFile_Parms.FileToRead, &FileToRead, 0x10 );
 
-	pFnReadTitleFile->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnReadTitleFile, &ReadTitleFile_Parms, NULL );
-
-	pFnReadTitleFile->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnReadTitleFile, &ReadTitleFile_Parms ) )
+		this->ProcessEvent ( pFnReadTitleFile, &ReadTitleFile_Parms, NULL );
 
 	return ReadTitleFile_Parms.ReturnValue;
 };
@@ -1028,10 +900,9 @@ bool UOnlineTitleFileDownloadMcp::ReadTitleFile ( FString const& FileToRead )
 
 void UOnlineTitleFileDownloadMcp::OnReadTitleFileComplete ( unsigned long bWasSuccessful, FString const& Filename )
 {
-	static UFunction* pFnOnReadTitleFileComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReadTitleFileCompleteRef { L"Function IpDrv.OnlineTitleFileDownloadMcp.OnReadTitleFileComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReadTitleFileComplete )
-		pFnOnReadTitleFileComplete = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineTitleFileDownloadMcp.OnReadTitleFileComplete" );
+	UFunction* const pFnOnReadTitleFileComplete = pFnOnReadTitleFileCompleteRef.Get ( );
 
 	UOnlineTitleFileDownloadMcp_execOnReadTitleFileComplete_Parms OnReadTitleFileComplete_Parms;
 	OnReadTitleFileComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -1042,14 +913,11 @@ void UOnlineTitleFileDownloadMcp::OnReadTitleFileComplete ( unsigned long bWasSu
 
 
 
-class UClass* UMeshBeacon::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UMeshBeacon::pClassPointer { L"Class IpDrv.MeshBeacon", &UObject::FindClass };
 
 class UClass* UMeshBeacon::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.MeshBeacon" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.MeshBeacon.DestroyBeacon
@@ -1058,30 +926,23 @@ class UClass* UMeshBeacon::StaticClass()
 
 void UMeshBeacon::eventDestroyBeacon ( )
 {
-	static UFunction* pFnDestroyBeacon = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDestroyBeaconRef { L"Function IpDrv.MeshBeacon.DestroyBeacon", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDestroyBeacon )
-		pFnDestroyBeacon = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeacon.DestroyBeacon" );
+	UFunction* const pFnDestroyBeacon = pFnDestroyBeaconRef.Get ( );
 
 	UMeshBeacon_eventDestroyBeacon_Parms DestroyBeacon_Parms;
 
-	pFnDestroyBeacon->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDestroyBeacon, &DestroyBeacon_Parms, NULL );
-
-	pFnDestroyBeacon->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDestroyBeacon, &DestroyBeacon_Parms ) )
+		this->ProcessEvent ( pFnDestroyBeacon, &DestroyBeacon_Parms, NULL );
 };
 
 
 
-class UClass* UMeshBeaconClient::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UMeshBeaconClient::pClassPointer { L"Class IpDrv.MeshBeaconClient", &UObject::FindClass };
 
 class UClass* UMeshBeaconClient::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.MeshBeaconClient" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.MeshBeaconClient.DebugRender
@@ -1091,10 +952,9 @@ class UClass* UMeshBeaconClient::StaticClass()
 
 void UMeshBeaconClient::DebugRender ( class UCanvas* Canvas )
 {
-	static UFunction* pFnDebugRender = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDebugRenderRef { L"Function IpDrv.MeshBeaconClient.DebugRender", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDebugRender )
-		pFnDebugRender = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconClient.DebugRender" );
+	UFunction* const pFnDebugRender = pFnDebugRenderRef.Get ( );
 
 	UMeshBeaconClient_execDebugRender_Parms DebugRender_Parms;
 	DebugRender_Parms.Canvas = Canvas;
@@ -1108,10 +968,9 @@ void UMeshBeaconClient::DebugRender ( class UCanvas* Canvas )
 
 void UMeshBeaconClient::DumpInfo ( )
 {
-	static UFunction* pFnDumpInfo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDumpInfoRef { L"Function IpDrv.MeshBeaconClient.DumpInfo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDumpInfo )
-		pFnDumpInfo = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconClient.DumpInfo" );
+	UFunction* const pFnDumpInfo = pFnDumpInfoRef.Get ( );
 
 	UMeshBeaconClient_execDumpInfo_Parms DumpInfo_Parms;
 
@@ -1129,10 +988,9 @@ void UMeshBeaconClient::DumpInfo ( )
 
 bool UMeshBeaconClient::SendHostNewGameSessionResponse ( unsigned long bSuccess, struct SFXName SessionName, class UClass* SearchClass, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnSendHostNewGameSessionResponse = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSendHostNewGameSessionResponseRef { L"Function IpDrv.MeshBeaconClient.SendHostNewGameSessionResponse", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSendHostNewGameSessionResponse )
-		pFnSendHostNewGameSessionResponse = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconClient.SendHostNewGameSessionResponse" );
+	UFunction* const pFnSendHostNewGameSessionResponse = pFnSendHostNewGameSessionResponseRef.Get ( );
 
 	UMeshBeaconClient_execSendHostNewGameSessionResponse_Parms SendHostNewGameSessionResponse_Parms;
 	SendHostNewGameSessionResponse_Parms.bSuccess = bSuccess;
@@ -1142,11 +1000,8 @@ bool UMeshBeaconClient::SendHostNewGameSessionResponse ( unsigned long bSuccess,
 	if ( PlatformSpecificInfo )
 		memcpy ( &SendHostNewGameSessionResponse_Parms.PlatformSpecificInfo, PlatformSpecificInfo, 0x50 );
 
-	pFnSendHostNewGameSessionResponse->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSendHostNewGameSessionResponse, &SendHostNewGameSessionResponse_Parms, NULL );
-
-	pFnSendHostNewGameSessionResponse->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSendHostNewGameSessionResponse, &SendHostNewGameSessionResponse_Parms ) )
+		this->ProcessEvent ( pFnSendHostNewGameSessionResponse, &SendHostNewGameSessionResponse_Parms, NULL );
 
 	if ( PlatformSpecificInfo )
 		memcpy ( PlatformSpecificInfo, &SendHostNewGameSessionResponse_Parms.PlatformSpecificInfo, 0x50 );
@@ -1163,10 +1018,9 @@ bool UMeshBeaconClient::SendHostNewGameSessionResponse ( unsigned long bSuccess,
 
 void UMeshBeaconClient::OnCreateNewSessionRequestReceived ( struct SFXName SessionName, class UClass* SearchClass, TArray<struct FPlayerMember>* Players )
 {
-	static UFunction* pFnOnCreateNewSessionRequestReceived = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnCreateNewSessionRequestReceivedRef { L"Function IpDrv.MeshBeaconClient.OnCreateNewSessionRequestReceived", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnCreateNewSessionRequestReceived )
-		pFnOnCreateNewSessionRequestReceived = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconClient.OnCreateNewSessionRequestReceived" );
+	UFunction* const pFnOnCreateNewSessionRequestReceived = pFnOnCreateNewSessionRequestReceivedRef.Get ( );
 
 	UMeshBeaconClient_execOnCreateNewSessionRequestReceived_Parms OnCreateNewSessionRequestReceived_Parms;
 	memcpy ( &OnCreateNewSessionRequestReceived_Parms.SessionName, &SessionName, 0x8 );
@@ -1190,10 +1044,9 @@ void UMeshBeaconClient::OnCreateNewSessionRequestReceived ( struct SFXName Sessi
 
 void UMeshBeaconClient::OnTravelRequestReceived ( struct SFXName SessionName, class UClass* SearchClass, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnOnTravelRequestReceived = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnTravelRequestReceivedRef { L"Function IpDrv.MeshBeaconClient.OnTravelRequestReceived", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnTravelRequestReceived )
-		pFnOnTravelRequestReceived = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconClient.OnTravelRequestReceived" );
+	UFunction* const pFnOnTravelRequestReceived = pFnOnTravelRequestReceivedRef.Get ( );
 
 	UMeshBeaconClient_execOnTravelRequestReceived_Parms OnTravelRequestReceived_Parms;
 	memcpy ( &OnTravelRequestReceived_Parms.SessionName, &SessionName, 0x8 );
@@ -1217,10 +1070,9 @@ void UMeshBeaconClient::OnTravelRequestReceived ( struct SFXName SessionName, cl
 
 void UMeshBeaconClient::OnReceivedBandwidthTestResults ( unsigned char TestType, unsigned char TestResult, struct FConnectionBandwidthStats* BandwidthStats )
 {
-	static UFunction* pFnOnReceivedBandwidthTestResults = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReceivedBandwidthTestResultsRef { L"Function IpDrv.MeshBeaconClient.OnReceivedBandwidthTestResults", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReceivedBandwidthTestResults )
-		pFnOnReceivedBandwidthTestResults = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconClient.OnReceivedBandwidthTestResults" );
+	UFunction* const pFnOnReceivedBandwidthTestResults = pFnOnReceivedBandwidthTestResultsRef.Get ( );
 
 	UMeshBeaconClient_execOnReceivedBandwidthTestResults_Parms OnReceivedBandwidthTestResults_Parms;
 	OnReceivedBandwidthTestResults_Parms.TestType = TestType;
@@ -1242,10 +1094,9 @@ void UMeshBeaconClient::OnReceivedBandwidthTestResults ( unsigned char TestType,
 
 void UMeshBeaconClient::OnReceivedBandwidthTestRequest ( unsigned char TestType )
 {
-	static UFunction* pFnOnReceivedBandwidthTestRequest = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReceivedBandwidthTestRequestRef { L"Function IpDrv.MeshBeaconClient.OnReceivedBandwidthTestRequest", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReceivedBandwidthTestRequest )
-		pFnOnReceivedBandwidthTestRequest = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconClient.OnReceivedBandwidthTestRequest" );
+	UFunction* const pFnOnReceivedBandwidthTestRequest = pFnOnReceivedBandwidthTestRequestRef.Get ( );
 
 	UMeshBeaconClient_execOnReceivedBandwidthTestRequest_Parms OnReceivedBandwidthTestRequest_Parms;
 	OnReceivedBandwidthTestRequest_Parms.TestType = TestType;
@@ -1260,10 +1111,9 @@ void UMeshBeaconClient::OnReceivedBandwidthTestRequest ( unsigned char TestType
 
 void UMeshBeaconClient::OnConnectionRequestResult ( unsigned char ConnectionResult )
 {
-	static UFunction* pFnOnConnectionRequestResult = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnConnectionRequestResultRef { L"Function IpDrv.MeshBeaconClient.OnConnectionRequestResult", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnConnectionRequestResult )
-		pFnOnConnectionRequestResult = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconClient.OnConnectionRequestResult" );
+	UFunction* const pFnOnConnectionRequestResult = pFnOnConnectionRequestResultRef.Get ( );
 
 	UMeshBeaconClient_execOnConnectionRequestResult_Parms OnConnectionRequestResult_Parms;
 	OnConnectionRequestResult_Parms.ConnectionResult = ConnectionResult;
@@ -1280,20 +1130,16 @@ void UMeshBeaconClient::OnConnectionRequestResult ( unsigned char ConnectionResu
 
 bool UMeshBeaconClient::BeginBandwidthTest ( unsigned char TestType, int TestBufferSize )
 {
-	static UFunction* pFnBeginBandwidthTest = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBeginBandwidthTestRef { L"Function IpDrv.MeshBeaconClient.BeginBandwidthTest", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBeginBandwidthTest )
-		pFnBeginBandwidthTest = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconClient.BeginBandwidthTest" );
+	UFunction* const pFnBeginBandwidthTest = pFnBeginBandwidthTestRef.Get ( );
 
 	UMeshBeaconClient_execBeginBandwidthTest_Parms BeginBandwidthTest_Parms;
 	BeginBandwidthTest_Parms.TestType = TestType;
 	BeginBandwidthTest_Parms.TestBufferSize = TestBufferSize;
 
-	pFnBeginBandwidthTest->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnBeginBandwidthTest, &BeginBandwidthTest_Parms, NULL );
-
-	pFnBeginBandwidthTest->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnBeginBandwidthTest, &BeginBandwidthTest_Parms ) )
+		this->ProcessEvent ( pFnBeginBandwidthTest, &BeginBandwidthTest_Parms, NULL );
 
 	return BeginBandwidthTest_Parms.ReturnValue;
 };
@@ -1308,10 +1154,9 @@ bool UMeshBeaconClient::BeginBandwidthTest ( unsigned char TestType, int TestBuf
 
 bool UMeshBeaconClient::RequestConnection ( unsigned long bRegisterSecureAddress, struct FOnlineGameSearchResult* DesiredHost, struct FClientConnectionRequest* ClientRequest )
 {
-	static UFunction* pFnRequestConnection = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRequestConnectionRef { L"Function IpDrv.MeshBeaconClient.RequestConnection", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRequestConnection )
-		pFnRequestConnection = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconClient.RequestConnection" );
+	UFunction* const pFnRequestConnection = pFnRequestConnectionRef.Get ( );
 
 	UMeshBeaconClient_execRequestConnection_Parms RequestConnection_Parms;
 	RequestConnection_Parms.bRegisterSecureAddress = bRegisterSecureAddress;
@@ -1322,11 +1167,8 @@ bool UMeshBeaconClient::RequestConnection ( unsigned long bRegisterSecureAddress
 	if ( ClientRequest )
 		memcpy ( &RequestConnection_Parms.ClientRequest, ClientRequest, 0x28 );
 
-	pFnRequestConnection->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRequestConnection, &RequestConnection_Parms, NULL );
-
-	pFnRequestConnection->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRequestConnection, &RequestConnection_Parms ) )
+		this->ProcessEvent ( pFnRequestConnection, &RequestConnection_Parms, NULL );
 
 	if ( DesiredHost )
 		memcpy ( DesiredHost, &RequestConnection_Parms.DesiredHost, 0x10 );
@@ -1343,30 +1185,23 @@ bool UMeshBeaconClient::RequestConnection ( unsigned long bRegisterSecureAddress
 
 void UMeshBeaconClient::eventDestroyBeacon ( )
 {
-	static UFunction* pFnDestroyBeacon = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDestroyBeaconRef { L"Function IpDrv.MeshBeaconClient.DestroyBeacon", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDestroyBeacon )
-		pFnDestroyBeacon = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconClient.DestroyBeacon" );
+	UFunction* const pFnDestroyBeacon = pFnDestroyBeaconRef.Get ( );
 
 	UMeshBeaconClient_eventDestroyBeacon_Parms DestroyBeacon_Parms;
 
-	pFnDestroyBeacon->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDestroyBeacon, &DestroyBeacon_Parms, NULL );
-
-	pFnDestroyBeacon->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDestroyBeacon, &DestroyBeacon_Parms ) )
+		this->ProcessEvent ( pFnDestroyBeacon, &DestroyBeacon_Parms, NULL );
 };
 
 
 
-class UClass* UMeshBeaconHost::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UMeshBeaconHost::pClassPointer { L"Class IpDrv.MeshBeaconHost", &UObject::FindClass };
 
 class UClass* UMeshBeaconHost::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.MeshBeaconHost" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.MeshBeaconHost.DebugRender
@@ -1377,10 +1212,9 @@ class UClass* UMeshBeaconHost::StaticClass()
 
 void UMeshBeaconHost::DebugRender ( class UCanvas* Canvas, struct FUniqueNetId const& CurOptimalHostId )
 {
-	static UFunction* pFnDebugRender = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDebugRenderRef { L"Function IpDrv.MeshBeaconHost.DebugRender", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDebugRender )
-		pFnDebugRender = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.DebugRender" );
+	UFunction* const pFnDebugRender = pFnDebugRenderRef.Get ( );
 
 	UMeshBeaconHost_execDebugRender_Parms DebugRender_Parms;
 	DebugRender_Parms.Canvas = Canvas;
@@ -1395,10 +1229,9 @@ void UMeshBeaconHost::DebugRender ( class UCanvas* Canvas, struct FUniqueNetId c
 
 void UMeshBeaconHost::DumpConnections ( )
 {
-	static UFunction* pFnDumpConnections = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDumpConnectionsRef { L"Function IpDrv.MeshBeaconHost.DumpConnections", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDumpConnections )
-		pFnDumpConnections = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.DumpConnections" );
+	UFunction* const pFnDumpConnections = pFnDumpConnectionsRef.Get ( );
 
 	UMeshBeaconHost_execDumpConnections_Parms DumpConnections_Parms;
 
@@ -1415,10 +1248,9 @@ void UMeshBeaconHost::DumpConnections ( )
 
 void UMeshBeaconHost::OnReceivedClientCreateNewSessionResult ( unsigned long bSucceeded, struct SFXName SessionName, class UClass* SearchClass, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnOnReceivedClientCreateNewSessionResult = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReceivedClientCreateNewSessionResultRef { L"Function IpDrv.MeshBeaconHost.OnReceivedClientCreateNewSessionResult", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReceivedClientCreateNewSessionResult )
-		pFnOnReceivedClientCreateNewSessionResult = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.OnReceivedClientCreateNewSessionResult" );
+	UFunction* const pFnOnReceivedClientCreateNewSessionResult = pFnOnReceivedClientCreateNewSessionResultRef.Get ( );
 
 	UMeshBeaconHost_execOnReceivedClientCreateNewSessionResult_Parms OnReceivedClientCreateNewSessionResult_Parms;
 	OnReceivedClientCreateNewSessionResult_Parms.bSucceeded = bSucceeded;
@@ -1445,10 +1277,9 @@ void UMeshBeaconHost::OnReceivedClientCreateNewSessionResult ( unsigned long bSu
 
 bool UMeshBeaconHost::RequestClientCreateNewSession ( struct FUniqueNetId const& PlayerNetId, struct SFXName SessionName, class UClass* SearchClass, TArray<struct FPlayerMember>* Players )
 {
-	static UFunction* pFnRequestClientCreateNewSession = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRequestClientCreateNewSessionRef { L"Function IpDrv.MeshBeaconHost.RequestClientCreateNewSession", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRequestClientCreateNewSession )
-		pFnRequestClientCreateNewSession = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.RequestClientCreateNewSession" );
+	UFunction* const pFnRequestClientCreateNewSession = pFnRequestClientCreateNewSessionRef.Get ( );
 
 	UMeshBeaconHost_execRequestClientCreateNewSession_Parms RequestClientCreateNewSession_Parms;
 	memcpy ( &RequestClientCreateNewSession_Parms.PlayerNetId, &PlayerNetId, 0x8 );
@@ -1458,11 +1289,8 @@ bool UMeshBeaconHost::RequestClientCreateNewSession ( struct FUniqueNetId const&
 	if ( Players )
 		memcpy ( &RequestClientCreateNewSession_Parms.Players, Players, 0x10 );
 
-	pFnRequestClientCreateNewSession->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRequestClientCreateNewSession, &RequestClientCreateNewSession_Parms, NULL );
-
-	pFnRequestClientCreateNewSession->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRequestClientCreateNewSession, &RequestClientCreateNewSession_Parms ) )
+		this->ProcessEvent ( pFnRequestClientCreateNewSession, &RequestClientCreateNewSession_Parms, NULL );
 
 	if ( Players )
 		memcpy ( Players, &RequestClientCreateNewSession_Parms.Players, 0x10 );
@@ -1479,10 +1307,9 @@ bool UMeshBeaconHost::RequestClientCreateNewSession ( struct FUniqueNetId const&
 
 void UMeshBeaconHost::TellClientsToTravel ( struct SFXName SessionName, class UClass* SearchClass, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnTellClientsToTravel = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTellClientsToTravelRef { L"Function IpDrv.MeshBeaconHost.TellClientsToTravel", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTellClientsToTravel )
-		pFnTellClientsToTravel = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.TellClientsToTravel" );
+	UFunction* const pFnTellClientsToTravel = pFnTellClientsToTravelRef.Get ( );
 
 	UMeshBeaconHost_execTellClientsToTravel_Parms TellClientsToTravel_Parms;
 	memcpy ( &TellClientsToTravel_Parms.SessionName, &SessionName, 0x8 );
@@ -1491,11 +1318,8 @@ void UMeshBeaconHost::TellClientsToTravel ( struct SFXName SessionName, class UC
 	if ( PlatformSpecificInfo )
 		memcpy ( &TellClientsToTravel_Parms.PlatformSpecificInfo, PlatformSpecificInfo, 0x50 );
 
-	pFnTellClientsToTravel->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnTellClientsToTravel, &TellClientsToTravel_Parms, NULL );
-
-	pFnTellClientsToTravel->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnTellClientsToTravel, &TellClientsToTravel_Parms ) )
+		this->ProcessEvent ( pFnTellClientsToTravel, &TellClientsToTravel_Parms, NULL );
 
 	if ( PlatformSpecificInfo )
 		memcpy ( PlatformSpecificInfo, &TellClientsToTravel_Parms.PlatformSpecificInfo, 0x50 );
@@ -1507,10 +1331,9 @@ void UMeshBeaconHost::TellClientsToTravel ( struct SFXName SessionName, class UC
 
 void UMeshBeaconHost::OnAllPendingPlayersConnected ( )
 {
-	static UFunction* pFnOnAllPendingPlayersConnected = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAllPendingPlayersConnectedRef { L"Function IpDrv.MeshBeaconHost.OnAllPendingPlayersConnected", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnAllPendingPlayersConnected )
-		pFnOnAllPendingPlayersConnected = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.OnAllPendingPlayersConnected" );
+	UFunction* const pFnOnAllPendingPlayersConnected = pFnOnAllPendingPlayersConnectedRef.Get ( );
 
 	UMeshBeaconHost_execOnAllPendingPlayersConnected_Parms OnAllPendingPlayersConnected_Parms;
 
@@ -1525,21 +1348,17 @@ void UMeshBeaconHost::OnAllPendingPlayersConnected ( )
 
 bool UMeshBeaconHost::AllPlayersConnected ( TArray<struct FUniqueNetId>* Players )
 {
-	static UFunction* pFnAllPlayersConnected = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAllPlayersConnectedRef { L"Function IpDrv.MeshBeaconHost.AllPlayersConnected", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAllPlayersConnected )
-		pFnAllPlayersConnected = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.AllPlayersConnected" );
+	UFunction* const pFnAllPlayersConnected = pFnAllPlayersConnectedRef.Get ( );
 
 	UMeshBeaconHost_execAllPlayersConnected_Parms AllPlayersConnected_Parms;
 
 	if ( Players )
 		memcpy ( &AllPlayersConnected_Parms.Players, Players, 0x10 );
 
-	pFnAllPlayersConnected->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAllPlayersConnected, &AllPlayersConnected_Parms, NULL );
-
-	pFnAllPlayersConnected->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAllPlayersConnected, &AllPlayersConnected_Parms ) )
+		this->ProcessEvent ( pFnAllPlayersConnected, &AllPlayersConnected_Parms, NULL );
 
 	if ( Players )
 		memcpy ( Players, &AllPlayersConnected_Parms.Players, 0x10 );
@@ -1555,19 +1374,15 @@ bool UMeshBeaconHost::AllPlayersConnected ( TArray<struct FUniqueNetId>* Players
 
 int UMeshBeaconHost::GetConnectionIndexForPlayer ( struct FUniqueNetId const& PlayerNetId )
 {
-	static UFunction* pFnGetConnectionIndexForPlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetConnectionIndexForPlayerRef { L"Function IpDrv.MeshBeaconHost.GetConnectionIndexForPlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetConnectionIndexForPlayer )
-		pFnGetConnectionIndexForPlayer = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.GetConnectionIndexForPlayer" );
+	UFunction* const pFnGetConnectionIndexForPlayer = pFnGetConnectionIndexForPlayerRef.Get ( );
 
 	UMeshBeaconHost_execGetConnectionIndexForPlayer_Parms GetConnectionIndexForPlayer_Parms;
 	memcpy ( &GetConnectionIndexForPlayer_Parms.PlayerNetId, &PlayerNetId, 0x8 );
 
-	pFnGetConnectionIndexForPlayer->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetConnectionIndexForPlayer, &GetConnectionIndexForPlayer_Parms, NULL );
-
-	pFnGetConnectionIndexForPlayer->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetConnectionIndexForPlayer, &GetConnectionIndexForPlayer_Parms ) )
+		this->ProcessEvent ( pFnGetConnectionIndexForPlayer, &GetConnectionIndexForPlayer_Parms, NULL );
 
 	return GetConnectionIndexForPlayer_Parms.ReturnValue;
 };
@@ -1579,10 +1394,9 @@ int UMeshBeaconHost::GetConnectionIndexForPlayer ( struct FUniqueNetId const& Pl
 
 void UMeshBeaconHost::SetPendingPlayerConnections ( TArray<struct FUniqueNetId>* Players )
 {
-	static UFunction* pFnSetPendingPlayerConnections = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetPendingPlayerConnectionsRef { L"Function IpDrv.MeshBeaconHost.SetPendingPlayerConnections", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetPendingPlayerConnections )
-		pFnSetPendingPlayerConnections = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.SetPendingPlayerConnections" );
+	UFunction* const pFnSetPendingPlayerConnections = pFnSetPendingPlayerConnectionsRef.Get ( );
 
 	UMeshBeaconHost_execSetPendingPlayerConnections_Parms SetPendingPlayerConnections_Parms;
 
@@ -1605,10 +1419,9 @@ void UMeshBeaconHost::SetPendingPlayerConnections ( TArray<struct FUniqueNetId>*
 
 void UMeshBeaconHost::OnFinishedBandwidthTest ( struct FUniqueNetId const& PlayerNetId, unsigned char TestType, unsigned char TestResult, struct FConnectionBandwidthStats* BandwidthStats )
 {
-	static UFunction* pFnOnFinishedBandwidthTest = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnFinishedBandwidthTestRef { L"Function IpDrv.MeshBeaconHost.OnFinishedBandwidthTest", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnFinishedBandwidthTest )
-		pFnOnFinishedBandwidthTest = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.OnFinishedBandwidthTest" );
+	UFunction* const pFnOnFinishedBandwidthTest = pFnOnFinishedBandwidthTestRef.Get ( );
 
 	UMeshBeaconHost_execOnFinishedBandwidthTest_Parms OnFinishedBandwidthTest_Parms;
 	memcpy ( &OnFinishedBandwidthTest_Parms.PlayerNetId, &PlayerNetId, 0x8 );
@@ -1632,10 +1445,9 @@ void UMeshBeaconHost::OnFinishedBandwidthTest ( struct FUniqueNetId const& Playe
 
 void UMeshBeaconHost::OnStartedBandwidthTest ( struct FUniqueNetId const& PlayerNetId, unsigned char TestType )
 {
-	static UFunction* pFnOnStartedBandwidthTest = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnStartedBandwidthTestRef { L"Function IpDrv.MeshBeaconHost.OnStartedBandwidthTest", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnStartedBandwidthTest )
-		pFnOnStartedBandwidthTest = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.OnStartedBandwidthTest" );
+	UFunction* const pFnOnStartedBandwidthTest = pFnOnStartedBandwidthTestRef.Get ( );
 
 	UMeshBeaconHost_execOnStartedBandwidthTest_Parms OnStartedBandwidthTest_Parms;
 	memcpy ( &OnStartedBandwidthTest_Parms.PlayerNetId, &PlayerNetId, 0x8 );
@@ -1651,10 +1463,9 @@ void UMeshBeaconHost::OnStartedBandwidthTest ( struct FUniqueNetId const& Player
 
 void UMeshBeaconHost::OnReceivedClientConnectionRequest ( struct FClientMeshBeaconConnection* NewClientConnection )
 {
-	static UFunction* pFnOnReceivedClientConnectionRequest = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReceivedClientConnectionRequestRef { L"Function IpDrv.MeshBeaconHost.OnReceivedClientConnectionRequest", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReceivedClientConnectionRequest )
-		pFnOnReceivedClientConnectionRequest = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.OnReceivedClientConnectionRequest" );
+	UFunction* const pFnOnReceivedClientConnectionRequest = pFnOnReceivedClientConnectionRequestRef.Get ( );
 
 	UMeshBeaconHost_execOnReceivedClientConnectionRequest_Parms OnReceivedClientConnectionRequest_Parms;
 
@@ -1674,10 +1485,9 @@ void UMeshBeaconHost::OnReceivedClientConnectionRequest ( struct FClientMeshBeac
 
 void UMeshBeaconHost::AllowBandwidthTesting ( unsigned long bEnabled )
 {
-	static UFunction* pFnAllowBandwidthTesting = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAllowBandwidthTestingRef { L"Function IpDrv.MeshBeaconHost.AllowBandwidthTesting", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAllowBandwidthTesting )
-		pFnAllowBandwidthTesting = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.AllowBandwidthTesting" );
+	UFunction* const pFnAllowBandwidthTesting = pFnAllowBandwidthTestingRef.Get ( );
 
 	UMeshBeaconHost_execAllowBandwidthTesting_Parms AllowBandwidthTesting_Parms;
 	AllowBandwidthTesting_Parms.bEnabled = bEnabled;
@@ -1691,18 +1501,14 @@ void UMeshBeaconHost::AllowBandwidthTesting ( unsigned long bEnabled )
 
 void UMeshBeaconHost::CancelPendingBandwidthTests ( )
 {
-	static UFunction* pFnCancelPendingBandwidthTests = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCancelPendingBandwidthTestsRef { L"Function IpDrv.MeshBeaconHost.CancelPendingBandwidthTests", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCancelPendingBandwidthTests )
-		pFnCancelPendingBandwidthTests = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.CancelPendingBandwidthTests" );
+	UFunction* const pFnCancelPendingBandwidthTests = pFnCancelPendingBandwidthTestsRef.Get ( );
 
 	UMeshBeaconHost_execCancelPendingBandwidthTests_Parms CancelPendingBandwidthTests_Parms;
 
-	pFnCancelPendingBandwidthTests->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCancelPendingBandwidthTests, &CancelPendingBandwidthTests_Parms, NULL );
-
-	pFnCancelPendingBandwidthTests->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCancelPendingBandwidthTests, &CancelPendingBandwidthTests_Parms ) )
+		this->ProcessEvent ( pFnCancelPendingBandwidthTests, &CancelPendingBandwidthTests_Parms, NULL );
 };
 
 // Function IpDrv.MeshBeaconHost.HasPendingBandwidthTest
@@ -1712,18 +1518,14 @@ void UMeshBeaconHost::CancelPendingBandwidthTests ( )
 
 bool UMeshBeaconHost::HasPendingBandwidthTest ( )
 {
-	static UFunction* pFnHasPendingBandwidthTest = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHasPendingBandwidthTestRef { L"Function IpDrv.MeshBeaconHost.HasPendingBandwidthTest", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHasPendingBandwidthTest )
-		pFnHasPendingBandwidthTest = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.HasPendingBandwidthTest" );
+	UFunction* const pFnHasPendingBandwidthTest = pFnHasPendingBandwidthTestRef.Get ( );
 
 	UMeshBeaconHost_execHasPendingBandwidthTest_Parms HasPendingBandwidthTest_Parms;
 
-	pFnHasPendingBandwidthTest->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnHasPendingBandwidthTest, &HasPendingBandwidthTest_Parms, NULL );
-
-	pFnHasPendingBandwidthTest->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnHasPendingBandwidthTest, &HasPendingBandwidthTest_Parms ) )
+		this->ProcessEvent ( pFnHasPendingBandwidthTest, &HasPendingBandwidthTest_Parms, NULL );
 
 	return HasPendingBandwidthTest_Parms.ReturnValue;
 };
@@ -1734,18 +1536,14 @@ bool UMeshBeaconHost::HasPendingBandwidthTest ( )
 
 void UMeshBeaconHost::CancelInProgressBandwidthTests ( )
 {
-	static UFunction* pFnCancelInProgressBandwidthTests = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCancelInProgressBandwidthTestsRef { L"Function IpDrv.MeshBeaconHost.CancelInProgressBandwidthTests", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCancelInProgressBandwidthTests )
-		pFnCancelInProgressBandwidthTests = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.CancelInProgressBandwidthTests" );
+	UFunction* const pFnCancelInProgressBandwidthTests = pFnCancelInProgressBandwidthTestsRef.Get ( );
 
 	UMeshBeaconHost_execCancelInProgressBandwidthTests_Parms CancelInProgressBandwidthTests_Parms;
 
-	pFnCancelInProgressBandwidthTests->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCancelInProgressBandwidthTests, &CancelInProgressBandwidthTests_Parms, NULL );
-
-	pFnCancelInProgressBandwidthTests->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCancelInProgressBandwidthTests, &CancelInProgressBandwidthTests_Parms ) )
+		this->ProcessEvent ( pFnCancelInProgressBandwidthTests, &CancelInProgressBandwidthTests_Parms, NULL );
 };
 
 // Function IpDrv.MeshBeaconHost.HasInProgressBandwidthTest
@@ -1755,18 +1553,14 @@ void UMeshBeaconHost::CancelInProgressBandwidthTests ( )
 
 bool UMeshBeaconHost::HasInProgressBandwidthTest ( )
 {
-	static UFunction* pFnHasInProgressBandwidthTest = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHasInProgressBandwidthTestRef { L"Function IpDrv.MeshBeaconHost.HasInProgressBandwidthTest", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHasInProgressBandwidthTest )
-		pFnHasInProgressBandwidthTest = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.HasInProgressBandwidthTest" );
+	UFunction* const pFnHasInProgressBandwidthTest = pFnHasInProgressBandwidthTestRef.Get ( );
 
 	UMeshBeaconHost_execHasInProgressBandwidthTest_Parms HasInProgressBandwidthTest_Parms;
 
-	pFnHasInProgressBandwidthTest->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnHasInProgressBandwidthTest, &HasInProgressBandwidthTest_Parms, NULL );
-
-	pFnHasInProgressBandwidthTest->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnHasInProgressBandwidthTest, &HasInProgressBandwidthTest_Parms ) )
+		this->ProcessEvent ( pFnHasInProgressBandwidthTest, &HasInProgressBandwidthTest_Parms, NULL );
 
 	return HasInProgressBandwidthTest_Parms.ReturnValue;
 };
@@ -1781,21 +1575,17 @@ bool UMeshBeaconHost::HasInProgressBandwidthTest ( )
 
 bool UMeshBeaconHost::RequestClientBandwidthTest ( struct FUniqueNetId const& PlayerNetId, unsigned char TestType, int TestBufferSize )
 {
-	static UFunction* pFnRequestClientBandwidthTest = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRequestClientBandwidthTestRef { L"Function IpDrv.MeshBeaconHost.RequestClientBandwidthTest", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRequestClientBandwidthTest )
-		pFnRequestClientBandwidthTest = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.RequestClientBandwidthTest" );
+	UFunction* const pFnRequestClientBandwidthTest = pFnRequestClientBandwidthTestRef.Get ( );
 
 	UMeshBeaconHost_execRequestClientBandwidthTest_Parms RequestClientBandwidthTest_Parms;
 	memcpy ( &RequestClientBandwidthTest_Parms.PlayerNetId, &PlayerNetId, 0x8 );
 	RequestClientBandwidthTest_Parms.TestType = TestType;
 	RequestClientBandwidthTest_Parms.TestBufferSize = TestBufferSize;
 
-	pFnRequestClientBandwidthTest->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRequestClientBandwidthTest, &RequestClientBandwidthTest_Parms, NULL );
-
-	pFnRequestClientBandwidthTest->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRequestClientBandwidthTest, &RequestClientBandwidthTest_Parms ) )
+		this->ProcessEvent ( pFnRequestClientBandwidthTest, &RequestClientBandwidthTest_Parms, NULL );
 
 	return RequestClientBandwidthTest_Parms.ReturnValue;
 };
@@ -1806,18 +1596,14 @@ bool UMeshBeaconHost::RequestClientBandwidthTest ( struct FUniqueNetId const& Pl
 
 void UMeshBeaconHost::eventDestroyBeacon ( )
 {
-	static UFunction* pFnDestroyBeacon = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDestroyBeaconRef { L"Function IpDrv.MeshBeaconHost.DestroyBeacon", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDestroyBeacon )
-		pFnDestroyBeacon = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.DestroyBeacon" );
+	UFunction* const pFnDestroyBeacon = pFnDestroyBeaconRef.Get ( );
 
 	UMeshBeaconHost_eventDestroyBeacon_Parms DestroyBeacon_Parms;
 
-	pFnDestroyBeacon->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDestroyBeacon, &DestroyBeacon_Parms, NULL );
-
-	pFnDestroyBeacon->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDestroyBeacon, &DestroyBeacon_Parms ) )
+		this->ProcessEvent ( pFnDestroyBeacon, &DestroyBeacon_Parms, NULL );
 };
 
 // Function IpDrv.MeshBeaconHost.InitHostBeacon
@@ -1828,33 +1614,26 @@ void UMeshBeaconHost::eventDestroyBeacon ( )
 
 bool UMeshBeaconHost::InitHostBeacon ( struct FUniqueNetId const& InOwningPlayerId )
 {
-	static UFunction* pFnInitHostBeacon = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitHostBeaconRef { L"Function IpDrv.MeshBeaconHost.InitHostBeacon", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitHostBeacon )
-		pFnInitHostBeacon = UObject::FindObject< UFunction > ( L"Function IpDrv.MeshBeaconHost.InitHostBeacon" );
+	UFunction* const pFnInitHostBeacon = pFnInitHostBeaconRef.Get ( );
 
 	UMeshBeaconHost_execInitHostBeacon_Parms InitHostBeacon_Parms;
 	memcpy ( &InitHostBeacon_Parms.InOwningPlayerId, &InOwningPlayerId, 0x8 );
 
-	pFnInitHostBeacon->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnInitHostBeacon, &InitHostBeacon_Parms, NULL );
-
-	pFnInitHostBeacon->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnInitHostBeacon, &InitHostBeacon_Parms ) )
+		this->ProcessEvent ( pFnInitHostBeacon, &InitHostBeacon_Parms, NULL );
 
 	return InitHostBeacon_Parms.ReturnValue;
 };
 
 
 
-class UClass* UOnlineSubsystemCommonImpl::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UOnlineSubsystemCommonImpl::pClassPointer { L"Class IpDrv.OnlineSubsystemCommonImpl", &UObject::FindClass };
 
 class UClass* UOnlineSubsystemCommonImpl::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.OnlineSubsystemCommonImpl" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.OnlineSubsystemCommonImpl.GetRegisteredPlayers
@@ -1865,10 +1644,9 @@ class UClass* UOnlineSubsystemCommonImpl::StaticClass()
 
 void UOnlineSubsystemCommonImpl::GetRegisteredPlayers ( struct SFXName SessionName, TArray<struct FUniqueNetId>* OutRegisteredPlayers )
 {
-	static UFunction* pFnGetRegisteredPlayers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetRegisteredPlayersRef { L"Function IpDrv.OnlineSubsystemCommonImpl.GetRegisteredPlayers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetRegisteredPlayers )
-		pFnGetRegisteredPlayers = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineSubsystemCommonImpl.GetRegisteredPlayers" );
+	UFunction* const pFnGetRegisteredPlayers = pFnGetRegisteredPlayersRef.Get ( );
 
 	UOnlineSubsystemCommonImpl_execGetRegisteredPlayers_Parms GetRegisteredPlayers_Parms;
 	memcpy ( &GetRegisteredPlayers_Parms.SessionName, &SessionName, 0x8 );
@@ -1891,20 +1669,16 @@ void UOnlineSubsystemCommonImpl::GetRegisteredPlayers ( struct SFXName SessionNa
 
 bool UOnlineSubsystemCommonImpl::IsPlayerInSession ( struct SFXName SessionName, struct FUniqueNetId const& PlayerID )
 {
-	static UFunction* pFnIsPlayerInSession = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsPlayerInSessionRef { L"Function IpDrv.OnlineSubsystemCommonImpl.IsPlayerInSession", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsPlayerInSession )
-		pFnIsPlayerInSession = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineSubsystemCommonImpl.IsPlayerInSession" );
+	UFunction* const pFnIsPlayerInSession = pFnIsPlayerInSessionRef.Get ( );
 
 	UOnlineSubsystemCommonImpl_execIsPlayerInSession_Parms IsPlayerInSession_Parms;
 	memcpy ( &IsPlayerInSession_Parms.SessionName, &SessionName, 0x8 );
 	memcpy ( &IsPlayerInSession_Parms.PlayerID, &PlayerID, 0x8 );
 
-	pFnIsPlayerInSession->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsPlayerInSession, &IsPlayerInSession_Parms, NULL );
-
-	pFnIsPlayerInSession->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsPlayerInSession, &IsPlayerInSession_Parms ) )
+		this->ProcessEvent ( pFnIsPlayerInSession, &IsPlayerInSession_Parms, NULL );
 
 	return IsPlayerInSession_Parms.ReturnValue;
 };
@@ -1917,10 +1691,9 @@ bool UOnlineSubsystemCommonImpl::IsPlayerInSession ( struct SFXName SessionName,
 
 struct FUniqueNetId UOnlineSubsystemCommonImpl::eventGetPlayerUniqueNetIdFromIndex ( int UserIndex )
 {
-	static UFunction* pFnGetPlayerUniqueNetIdFromIndex = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPlayerUniqueNetIdFromIndexRef { L"Function IpDrv.OnlineSubsystemCommonImpl.GetPlayerUniqueNetIdFromIndex", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPlayerUniqueNetIdFromIndex )
-		pFnGetPlayerUniqueNetIdFromIndex = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineSubsystemCommonImpl.GetPlayerUniqueNetIdFromIndex" );
+	UFunction* const pFnGetPlayerUniqueNetIdFromIndex = pFnGetPlayerUniqueNetIdFromIndexRef.Get ( );
 
 	UOnlineSubsystemCommonImpl_eventGetPlayerUniqueNetIdFromIndex_Parms GetPlayerUniqueNetIdFromIndex_Parms;
 	GetPlayerUniqueNetIdFromIndex_Parms.UserIndex = UserIndex;
@@ -1938,10 +1711,9 @@ struct FUniqueNetId UOnlineSubsystemCommonImpl::eventGetPlayerUniqueNetIdFromInd
 
 FString UOnlineSubsystemCommonImpl::eventGetPlayerNicknameFromIndex ( int UserIndex )
 {
-	static UFunction* pFnGetPlayerNicknameFromIndex = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPlayerNicknameFromIndexRef { L"Function IpDrv.OnlineSubsystemCommonImpl.GetPlayerNicknameFromIndex", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPlayerNicknameFromIndex )
-		pFnGetPlayerNicknameFromIndex = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineSubsystemCommonImpl.GetPlayerNicknameFromIndex" );
+	UFunction* const pFnGetPlayerNicknameFromIndex = pFnGetPlayerNicknameFromIndexRef.Get ( );
 
 	UOnlineSubsystemCommonImpl_eventGetPlayerNicknameFromIndex_Parms GetPlayerNicknameFromIndex_Parms;
 	GetPlayerNicknameFromIndex_Parms.UserIndex = UserIndex;
@@ -1953,14 +1725,11 @@ FString UOnlineSubsystemCommonImpl::eventGetPlayerNicknameFromIndex ( int UserIn
 
 
 
-class UClass* UOnlineGameInterfaceImpl::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UOnlineGameInterfaceImpl::pClassPointer { L"Class IpDrv.OnlineGameInterfaceImpl", &UObject::FindClass };
 
 class UClass* UOnlineGameInterfaceImpl::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.OnlineGameInterfaceImpl" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.OnlineGameInterfaceImpl.BindPlatformSpecificSessionToSearch
@@ -1973,21 +1742,17 @@ class UClass* UOnlineGameInterfaceImpl::StaticClass()
 
 bool UOnlineGameInterfaceImpl::BindPlatformSpecificSessionToSearch ( unsigned char SearchingPlayerNum, class UOnlineGameSearch* SearchSettings, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnBindPlatformSpecificSessionToSearch = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBindPlatformSpecificSessionToSearchRef { L"Function IpDrv.OnlineGameInterfaceImpl.BindPlatformSpecificSessionToSearch", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBindPlatformSpecificSessionToSearch )
-		pFnBindPlatformSpecificSessionToSearch = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.BindPlatformSpecificSessionToSearch" );
+	UFunction* const pFnBindPlatformSpecificSessionToSearch = pFnBindPlatformSpecificSessionToSearchRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execBindPlatformSpecificSessionToSearch_Parms BindPlatformSpecificSessionToSearch_Parms;
 	BindPlatformSpecificSessionToSearch_Parms.SearchingPlayerNum = SearchingPlayerNum;
 	BindPlatformSpecificSessionToSearch_Parms.SearchSettings = SearchSettings;
 	memcpy ( &BindPlatformSpecificSessionToSearch_Parms.PlatformSpecificInfo, &PlatformSpecificInfo, 0x50 );
 
-	pFnBindPlatformSpecificSessionToSearch->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnBindPlatformSpecificSessionToSearch, &BindPlatformSpecificSessionToSearch_Parms, NULL );
-
-	pFnBindPlatformSpecificSessionToSearch->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnBindPlatformSpecificSessionToSearch, &BindPlatformSpecificSessionToSearch_Parms ) )
+		this->ProcessEvent ( pFnBindPlatformSpecificSessionToSearch, &BindPlatformSpecificSessionToSearch_Parms, NULL );
 
 	return BindPlatformSpecificSessionToSearch_Parms.ReturnValue;
 };
@@ -2001,10 +1766,9 @@ bool UOnlineGameInterfaceImpl::BindPlatformSpecificSessionToSearch ( unsigned ch
 
 bool UOnlineGameInterfaceImpl::ReadPlatformSpecificSessionInfoBySessionName ( struct SFXName SessionName, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnReadPlatformSpecificSessionInfoBySessionName = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReadPlatformSpecificSessionInfoBySessionNameRef { L"Function IpDrv.OnlineGameInterfaceImpl.ReadPlatformSpecificSessionInfoBySessionName", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReadPlatformSpecificSessionInfoBySessionName )
-		pFnReadPlatformSpecificSessionInfoBySessionName = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.ReadPlatformSpecificSessionInfoBySessionName" );
+	UFunction* const pFnReadPlatformSpecificSessionInfoBySessionName = pFnReadPlatformSpecificSessionInfoBySessionNameRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execReadPlatformSpecificSessionInfoBySessionName_Parms ReadPlatformSpecificSessionInfoBySessionName_Parms;
 	memcpy ( &ReadPlatformSpecificSessionInfoBySessionName_Parms.SessionName, &SessionName, 0x8 );
@@ -2029,10 +1793,9 @@ bool UOnlineGameInterfaceImpl::ReadPlatformSpecificSessionInfoBySessionName ( st
 
 bool UOnlineGameInterfaceImpl::ReadPlatformSpecificSessionInfo ( struct FOnlineGameSearchResult* DesiredGame, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnReadPlatformSpecificSessionInfo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReadPlatformSpecificSessionInfoRef { L"Function IpDrv.OnlineGameInterfaceImpl.ReadPlatformSpecificSessionInfo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReadPlatformSpecificSessionInfo )
-		pFnReadPlatformSpecificSessionInfo = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.ReadPlatformSpecificSessionInfo" );
+	UFunction* const pFnReadPlatformSpecificSessionInfo = pFnReadPlatformSpecificSessionInfoRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execReadPlatformSpecificSessionInfo_Parms ReadPlatformSpecificSessionInfo_Parms;
 
@@ -2042,11 +1805,8 @@ bool UOnlineGameInterfaceImpl::ReadPlatformSpecificSessionInfo ( struct FOnlineG
 	if ( PlatformSpecificInfo )
 		memcpy ( &ReadPlatformSpecificSessionInfo_Parms.PlatformSpecificInfo, PlatformSpecificInfo, 0x50 );
 
-	pFnReadPlatformSpecificSessionInfo->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnReadPlatformSpecificSessionInfo, &ReadPlatformSpecificSessionInfo_Parms, NULL );
-
-	pFnReadPlatformSpecificSessionInfo->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnReadPlatformSpecificSessionInfo, &ReadPlatformSpecificSessionInfo_Parms ) )
+		this->ProcessEvent ( pFnReadPlatformSpecificSessionInfo, &ReadPlatformSpecificSessionInfo_Parms, NULL );
 
 	if ( DesiredGame )
 		memcpy ( DesiredGame, &ReadPlatformSpecificSessionInfo_Parms.DesiredGame, 0x10 );
@@ -2066,10 +1826,9 @@ bool UOnlineGameInterfaceImpl::ReadPlatformSpecificSessionInfo ( struct FOnlineG
 
 bool UOnlineGameInterfaceImpl::QueryNonAdvertisedData ( int StartAt, int NumberToQuery )
 {
-	static UFunction* pFnQueryNonAdvertisedData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnQueryNonAdvertisedDataRef { L"Function IpDrv.OnlineGameInterfaceImpl.QueryNonAdvertisedData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnQueryNonAdvertisedData )
-		pFnQueryNonAdvertisedData = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.QueryNonAdvertisedData" );
+	UFunction* const pFnQueryNonAdvertisedData = pFnQueryNonAdvertisedDataRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execQueryNonAdvertisedData_Parms QueryNonAdvertisedData_Parms;
 	QueryNonAdvertisedData_Parms.StartAt = StartAt;
@@ -2089,10 +1848,9 @@ bool UOnlineGameInterfaceImpl::QueryNonAdvertisedData ( int StartAt, int NumberT
 
 bool UOnlineGameInterfaceImpl::RecalculateSkillRating ( struct SFXName SessionName, TArray<struct FUniqueNetId>* Players )
 {
-	static UFunction* pFnRecalculateSkillRating = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateSkillRatingRef { L"Function IpDrv.OnlineGameInterfaceImpl.RecalculateSkillRating", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateSkillRating )
-		pFnRecalculateSkillRating = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.RecalculateSkillRating" );
+	UFunction* const pFnRecalculateSkillRating = pFnRecalculateSkillRatingRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execRecalculateSkillRating_Parms RecalculateSkillRating_Parms;
 	memcpy ( &RecalculateSkillRating_Parms.SessionName, &SessionName, 0x8 );
@@ -2117,10 +1875,9 @@ bool UOnlineGameInterfaceImpl::RecalculateSkillRating ( struct SFXName SessionNa
 
 bool UOnlineGameInterfaceImpl::AcceptGameInvite ( unsigned char LocalUserNum, struct SFXName SessionName )
 {
-	static UFunction* pFnAcceptGameInvite = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAcceptGameInviteRef { L"Function IpDrv.OnlineGameInterfaceImpl.AcceptGameInvite", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAcceptGameInvite )
-		pFnAcceptGameInvite = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.AcceptGameInvite" );
+	UFunction* const pFnAcceptGameInvite = pFnAcceptGameInviteRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execAcceptGameInvite_Parms AcceptGameInvite_Parms;
 	AcceptGameInvite_Parms.LocalUserNum = LocalUserNum;
@@ -2139,10 +1896,9 @@ bool UOnlineGameInterfaceImpl::AcceptGameInvite ( unsigned char LocalUserNum, st
 
 void UOnlineGameInterfaceImpl::ClearGameInviteAcceptedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate GameInviteAcceptedDelegate )
 {
-	static UFunction* pFnClearGameInviteAcceptedDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearGameInviteAcceptedDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.ClearGameInviteAcceptedDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearGameInviteAcceptedDelegate )
-		pFnClearGameInviteAcceptedDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.ClearGameInviteAcceptedDelegate" );
+	UFunction* const pFnClearGameInviteAcceptedDelegate = pFnClearGameInviteAcceptedDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execClearGameInviteAcceptedDelegate_Parms ClearGameInviteAcceptedDelegate_Parms;
 	ClearGameInviteAcceptedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -2159,10 +1915,9 @@ void UOnlineGameInterfaceImpl::ClearGameInviteAcceptedDelegate ( unsigned char L
 
 void UOnlineGameInterfaceImpl::AddGameInviteAcceptedDelegate ( unsigned char LocalUserNum, struct FScriptDelegate GameInviteAcceptedDelegate )
 {
-	static UFunction* pFnAddGameInviteAcceptedDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddGameInviteAcceptedDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.AddGameInviteAcceptedDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddGameInviteAcceptedDelegate )
-		pFnAddGameInviteAcceptedDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.AddGameInviteAcceptedDelegate" );
+	UFunction* const pFnAddGameInviteAcceptedDelegate = pFnAddGameInviteAcceptedDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execAddGameInviteAcceptedDelegate_Parms AddGameInviteAcceptedDelegate_Parms;
 	AddGameInviteAcceptedDelegate_Parms.LocalUserNum = LocalUserNum;
@@ -2178,10 +1933,9 @@ void UOnlineGameInterfaceImpl::AddGameInviteAcceptedDelegate ( unsigned char Loc
 
 void UOnlineGameInterfaceImpl::OnGameInviteAccepted ( struct FOnlineGameSearchResult* InviteResult )
 {
-	static UFunction* pFnOnGameInviteAccepted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnGameInviteAcceptedRef { L"Function IpDrv.OnlineGameInterfaceImpl.OnGameInviteAccepted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnGameInviteAccepted )
-		pFnOnGameInviteAccepted = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.OnGameInviteAccepted" );
+	UFunction* const pFnOnGameInviteAccepted = pFnOnGameInviteAcceptedRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execOnGameInviteAccepted_Parms OnGameInviteAccepted_Parms;
 
@@ -2202,10 +1956,9 @@ void UOnlineGameInterfaceImpl::OnGameInviteAccepted ( struct FOnlineGameSearchRe
 
 TArray<struct FOnlineArbitrationRegistrant> UOnlineGameInterfaceImpl::GetArbitratedPlayers ( struct SFXName SessionName )
 {
-	static UFunction* pFnGetArbitratedPlayers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetArbitratedPlayersRef { L"Function IpDrv.OnlineGameInterfaceImpl.GetArbitratedPlayers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetArbitratedPlayers )
-		pFnGetArbitratedPlayers = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.GetArbitratedPlayers" );
+	UFunction* const pFnGetArbitratedPlayers = pFnGetArbitratedPlayersRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execGetArbitratedPlayers_Parms GetArbitratedPlayers_Parms;
 	memcpy ( &GetArbitratedPlayers_Parms.SessionName, &SessionName, 0x8 );
@@ -2222,10 +1975,9 @@ TArray<struct FOnlineArbitrationRegistrant> UOnlineGameInterfaceImpl::GetArbitra
 
 void UOnlineGameInterfaceImpl::ClearArbitrationRegistrationCompleteDelegate ( struct FScriptDelegate ArbitrationRegistrationCompleteDelegate )
 {
-	static UFunction* pFnClearArbitrationRegistrationCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearArbitrationRegistrationCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.ClearArbitrationRegistrationCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearArbitrationRegistrationCompleteDelegate )
-		pFnClearArbitrationRegistrationCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.ClearArbitrationRegistrationCompleteDelegate" );
+	UFunction* const pFnClearArbitrationRegistrationCompleteDelegate = pFnClearArbitrationRegistrationCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execClearArbitrationRegistrationCompleteDelegate_Parms ClearArbitrationRegistrationCompleteDelegate_Parms;
 	memcpy ( &ClearArbitrationRegistrationCompleteDelegate_Parms.ArbitrationRegistrationCompleteDelegate, &ArbitrationRegistrationCompleteDelegate, 0x10 );
@@ -2240,10 +1992,9 @@ void UOnlineGameInterfaceImpl::ClearArbitrationRegistrationCompleteDelegate ( st
 
 void UOnlineGameInterfaceImpl::AddArbitrationRegistrationCompleteDelegate ( struct FScriptDelegate ArbitrationRegistrationCompleteDelegate )
 {
-	static UFunction* pFnAddArbitrationRegistrationCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddArbitrationRegistrationCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.AddArbitrationRegistrationCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddArbitrationRegistrationCompleteDelegate )
-		pFnAddArbitrationRegistrationCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.AddArbitrationRegistrationCompleteDelegate" );
+	UFunction* const pFnAddArbitrationRegistrationCompleteDelegate = pFnAddArbitrationRegistrationCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execAddArbitrationRegistrationCompleteDelegate_Parms AddArbitrationRegistrationCompleteDelegate_Parms;
 	memcpy ( &AddArbitrationRegistrationCompleteDelegate_Parms.ArbitrationRegistrationCompleteDelegate, &ArbitrationRegistrationCompleteDelegate, 0x10 );
@@ -2259,10 +2010,9 @@ void UOnlineGameInterfaceImpl::AddArbitrationRegistrationCompleteDelegate ( stru
 
 void UOnlineGameInterfaceImpl::OnArbitrationRegistrationComplete ( struct SFXName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnArbitrationRegistrationComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnArbitrationRegistrationCompleteRef { L"Function IpDrv.OnlineGameInterfaceImpl.OnArbitrationRegistrationComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnArbitrationRegistrationComplete )
-		pFnOnArbitrationRegistrationComplete = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.OnArbitrationRegistrationComplete" );
+	UFunction* const pFnOnArbitrationRegistrationComplete = pFnOnArbitrationRegistrationCompleteRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execOnArbitrationRegistrationComplete_Parms OnArbitrationRegistrationComplete_Parms;
 	memcpy ( &OnArbitrationRegistrationComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2279,10 +2029,9 @@ void UOnlineGameInterfaceImpl::OnArbitrationRegistrationComplete ( struct SFXNam
 
 bool UOnlineGameInterfaceImpl::RegisterForArbitration ( struct SFXName SessionName )
 {
-	static UFunction* pFnRegisterForArbitration = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRegisterForArbitrationRef { L"Function IpDrv.OnlineGameInterfaceImpl.RegisterForArbitration", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRegisterForArbitration )
-		pFnRegisterForArbitration = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.RegisterForArbitration" );
+	UFunction* const pFnRegisterForArbitration = pFnRegisterForArbitrationRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execRegisterForArbitration_Parms RegisterForArbitration_Parms;
 	memcpy ( &RegisterForArbitration_Parms.SessionName, &SessionName, 0x8 );
@@ -2299,10 +2048,9 @@ bool UOnlineGameInterfaceImpl::RegisterForArbitration ( struct SFXName SessionNa
 
 void UOnlineGameInterfaceImpl::ClearEndOnlineGameCompleteDelegate ( struct FScriptDelegate EndOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearEndOnlineGameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearEndOnlineGameCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.ClearEndOnlineGameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearEndOnlineGameCompleteDelegate )
-		pFnClearEndOnlineGameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.ClearEndOnlineGameCompleteDelegate" );
+	UFunction* const pFnClearEndOnlineGameCompleteDelegate = pFnClearEndOnlineGameCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execClearEndOnlineGameCompleteDelegate_Parms ClearEndOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearEndOnlineGameCompleteDelegate_Parms.EndOnlineGameCompleteDelegate, &EndOnlineGameCompleteDelegate, 0x10 );
@@ -2317,10 +2065,9 @@ void UOnlineGameInterfaceImpl::ClearEndOnlineGameCompleteDelegate ( struct FScri
 
 void UOnlineGameInterfaceImpl::AddEndOnlineGameCompleteDelegate ( struct FScriptDelegate EndOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddEndOnlineGameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddEndOnlineGameCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.AddEndOnlineGameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddEndOnlineGameCompleteDelegate )
-		pFnAddEndOnlineGameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.AddEndOnlineGameCompleteDelegate" );
+	UFunction* const pFnAddEndOnlineGameCompleteDelegate = pFnAddEndOnlineGameCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execAddEndOnlineGameCompleteDelegate_Parms AddEndOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddEndOnlineGameCompleteDelegate_Parms.EndOnlineGameCompleteDelegate, &EndOnlineGameCompleteDelegate, 0x10 );
@@ -2336,10 +2083,9 @@ void UOnlineGameInterfaceImpl::AddEndOnlineGameCompleteDelegate ( struct FScript
 
 void UOnlineGameInterfaceImpl::OnEndOnlineGameComplete ( struct SFXName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnEndOnlineGameComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnEndOnlineGameCompleteRef { L"Function IpDrv.OnlineGameInterfaceImpl.OnEndOnlineGameComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnEndOnlineGameComplete )
-		pFnOnEndOnlineGameComplete = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.OnEndOnlineGameComplete" );
+	UFunction* const pFnOnEndOnlineGameComplete = pFnOnEndOnlineGameCompleteRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execOnEndOnlineGameComplete_Parms OnEndOnlineGameComplete_Parms;
 	memcpy ( &OnEndOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2356,19 +2102,15 @@ void UOnlineGameInterfaceImpl::OnEndOnlineGameComplete ( struct SFXName SessionN
 
 bool UOnlineGameInterfaceImpl::EndOnlineGame ( struct SFXName SessionName )
 {
-	static UFunction* pFnEndOnlineGame = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndOnlineGameRef { L"Function IpDrv.OnlineGameInterfaceImpl.EndOnlineGame", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndOnlineGame )
-		pFnEndOnlineGame = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.EndOnlineGame" );
+	UFunction* const pFnEndOnlineGame = pFnEndOnlineGameRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execEndOnlineGame_Parms EndOnlineGame_Parms;
 	memcpy ( &EndOnlineGame_Parms.SessionName, &SessionName, 0x8 );
 
-	pFnEndOnlineGame->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEndOnlineGame, &EndOnlineGame_Parms, NULL );
-
-	pFnEndOnlineGame->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnEndOnlineGame, &EndOnlineGame_Parms ) )
+		this->ProcessEvent ( pFnEndOnlineGame, &EndOnlineGame_Parms, NULL );
 
 	return EndOnlineGame_Parms.ReturnValue;
 };
@@ -2380,10 +2122,9 @@ bool UOnlineGameInterfaceImpl::EndOnlineGame ( struct SFXName SessionName )
 
 void UOnlineGameInterfaceImpl::ClearStartOnlineGameCompleteDelegate ( struct FScriptDelegate StartOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearStartOnlineGameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearStartOnlineGameCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.ClearStartOnlineGameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearStartOnlineGameCompleteDelegate )
-		pFnClearStartOnlineGameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.ClearStartOnlineGameCompleteDelegate" );
+	UFunction* const pFnClearStartOnlineGameCompleteDelegate = pFnClearStartOnlineGameCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execClearStartOnlineGameCompleteDelegate_Parms ClearStartOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearStartOnlineGameCompleteDelegate_Parms.StartOnlineGameCompleteDelegate, &StartOnlineGameCompleteDelegate, 0x10 );
@@ -2398,10 +2139,9 @@ void UOnlineGameInterfaceImpl::ClearStartOnlineGameCompleteDelegate ( struct FSc
 
 void UOnlineGameInterfaceImpl::AddStartOnlineGameCompleteDelegate ( struct FScriptDelegate StartOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddStartOnlineGameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddStartOnlineGameCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.AddStartOnlineGameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddStartOnlineGameCompleteDelegate )
-		pFnAddStartOnlineGameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.AddStartOnlineGameCompleteDelegate" );
+	UFunction* const pFnAddStartOnlineGameCompleteDelegate = pFnAddStartOnlineGameCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execAddStartOnlineGameCompleteDelegate_Parms AddStartOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddStartOnlineGameCompleteDelegate_Parms.StartOnlineGameCompleteDelegate, &StartOnlineGameCompleteDelegate, 0x10 );
@@ -2417,10 +2157,9 @@ void UOnlineGameInterfaceImpl::AddStartOnlineGameCompleteDelegate ( struct FScri
 
 void UOnlineGameInterfaceImpl::OnStartOnlineGameComplete ( struct SFXName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnStartOnlineGameComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnStartOnlineGameCompleteRef { L"Function IpDrv.OnlineGameInterfaceImpl.OnStartOnlineGameComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnStartOnlineGameComplete )
-		pFnOnStartOnlineGameComplete = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.OnStartOnlineGameComplete" );
+	UFunction* const pFnOnStartOnlineGameComplete = pFnOnStartOnlineGameCompleteRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execOnStartOnlineGameComplete_Parms OnStartOnlineGameComplete_Parms;
 	memcpy ( &OnStartOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2437,19 +2176,15 @@ void UOnlineGameInterfaceImpl::OnStartOnlineGameComplete ( struct SFXName Sessio
 
 bool UOnlineGameInterfaceImpl::StartOnlineGame ( struct SFXName SessionName )
 {
-	static UFunction* pFnStartOnlineGame = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartOnlineGameRef { L"Function IpDrv.OnlineGameInterfaceImpl.StartOnlineGame", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartOnlineGame )
-		pFnStartOnlineGame = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.StartOnlineGame" );
+	UFunction* const pFnStartOnlineGame = pFnStartOnlineGameRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execStartOnlineGame_Parms StartOnlineGame_Parms;
 	memcpy ( &StartOnlineGame_Parms.SessionName, &SessionName, 0x8 );
 
-	pFnStartOnlineGame->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnStartOnlineGame, &StartOnlineGame_Parms, NULL );
-
-	pFnStartOnlineGame->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnStartOnlineGame, &StartOnlineGame_Parms ) )
+		this->ProcessEvent ( pFnStartOnlineGame, &StartOnlineGame_Parms, NULL );
 
 	return StartOnlineGame_Parms.ReturnValue;
 };
@@ -2461,10 +2196,9 @@ bool UOnlineGameInterfaceImpl::StartOnlineGame ( struct SFXName SessionName )
 
 void UOnlineGameInterfaceImpl::ClearUnregisterPlayerCompleteDelegate ( struct FScriptDelegate UnregisterPlayerCompleteDelegate )
 {
-	static UFunction* pFnClearUnregisterPlayerCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearUnregisterPlayerCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.ClearUnregisterPlayerCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearUnregisterPlayerCompleteDelegate )
-		pFnClearUnregisterPlayerCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.ClearUnregisterPlayerCompleteDelegate" );
+	UFunction* const pFnClearUnregisterPlayerCompleteDelegate = pFnClearUnregisterPlayerCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execClearUnregisterPlayerCompleteDelegate_Parms ClearUnregisterPlayerCompleteDelegate_Parms;
 	memcpy ( &ClearUnregisterPlayerCompleteDelegate_Parms.UnregisterPlayerCompleteDelegate, &UnregisterPlayerCompleteDelegate, 0x10 );
@@ -2479,10 +2213,9 @@ void UOnlineGameInterfaceImpl::ClearUnregisterPlayerCompleteDelegate ( struct FS
 
 void UOnlineGameInterfaceImpl::AddUnregisterPlayerCompleteDelegate ( struct FScriptDelegate UnregisterPlayerCompleteDelegate )
 {
-	static UFunction* pFnAddUnregisterPlayerCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddUnregisterPlayerCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.AddUnregisterPlayerCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddUnregisterPlayerCompleteDelegate )
-		pFnAddUnregisterPlayerCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.AddUnregisterPlayerCompleteDelegate" );
+	UFunction* const pFnAddUnregisterPlayerCompleteDelegate = pFnAddUnregisterPlayerCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execAddUnregisterPlayerCompleteDelegate_Parms AddUnregisterPlayerCompleteDelegate_Parms;
 	memcpy ( &AddUnregisterPlayerCompleteDelegate_Parms.UnregisterPlayerCompleteDelegate, &UnregisterPlayerCompleteDelegate, 0x10 );
@@ -2499,10 +2232,9 @@ void UOnlineGameInterfaceImpl::AddUnregisterPlayerCompleteDelegate ( struct FScr
 
 void UOnlineGameInterfaceImpl::OnUnregisterPlayerComplete ( struct SFXName SessionName, struct FUniqueNetId const& PlayerID, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnUnregisterPlayerComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUnregisterPlayerCompleteRef { L"Function IpDrv.OnlineGameInterfaceImpl.OnUnregisterPlayerComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUnregisterPlayerComplete )
-		pFnOnUnregisterPlayerComplete = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.OnUnregisterPlayerComplete" );
+	UFunction* const pFnOnUnregisterPlayerComplete = pFnOnUnregisterPlayerCompleteRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execOnUnregisterPlayerComplete_Parms OnUnregisterPlayerComplete_Parms;
 	memcpy ( &OnUnregisterPlayerComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2521,10 +2253,9 @@ void UOnlineGameInterfaceImpl::OnUnregisterPlayerComplete ( struct SFXName Sessi
 
 bool UOnlineGameInterfaceImpl::UnregisterPlayer ( struct SFXName SessionName, struct FUniqueNetId const& PlayerID )
 {
-	static UFunction* pFnUnregisterPlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnregisterPlayerRef { L"Function IpDrv.OnlineGameInterfaceImpl.UnregisterPlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnregisterPlayer )
-		pFnUnregisterPlayer = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.UnregisterPlayer" );
+	UFunction* const pFnUnregisterPlayer = pFnUnregisterPlayerRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execUnregisterPlayer_Parms UnregisterPlayer_Parms;
 	memcpy ( &UnregisterPlayer_Parms.SessionName, &SessionName, 0x8 );
@@ -2542,10 +2273,9 @@ bool UOnlineGameInterfaceImpl::UnregisterPlayer ( struct SFXName SessionName, st
 
 void UOnlineGameInterfaceImpl::ClearRegisterPlayerCompleteDelegate ( struct FScriptDelegate RegisterPlayerCompleteDelegate )
 {
-	static UFunction* pFnClearRegisterPlayerCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearRegisterPlayerCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.ClearRegisterPlayerCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearRegisterPlayerCompleteDelegate )
-		pFnClearRegisterPlayerCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.ClearRegisterPlayerCompleteDelegate" );
+	UFunction* const pFnClearRegisterPlayerCompleteDelegate = pFnClearRegisterPlayerCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execClearRegisterPlayerCompleteDelegate_Parms ClearRegisterPlayerCompleteDelegate_Parms;
 	memcpy ( &ClearRegisterPlayerCompleteDelegate_Parms.RegisterPlayerCompleteDelegate, &RegisterPlayerCompleteDelegate, 0x10 );
@@ -2560,10 +2290,9 @@ void UOnlineGameInterfaceImpl::ClearRegisterPlayerCompleteDelegate ( struct FScr
 
 void UOnlineGameInterfaceImpl::AddRegisterPlayerCompleteDelegate ( struct FScriptDelegate RegisterPlayerCompleteDelegate )
 {
-	static UFunction* pFnAddRegisterPlayerCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddRegisterPlayerCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.AddRegisterPlayerCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddRegisterPlayerCompleteDelegate )
-		pFnAddRegisterPlayerCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.AddRegisterPlayerCompleteDelegate" );
+	UFunction* const pFnAddRegisterPlayerCompleteDelegate = pFnAddRegisterPlayerCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execAddRegisterPlayerCompleteDelegate_Parms AddRegisterPlayerCompleteDelegate_Parms;
 	memcpy ( &AddRegisterPlayerCompleteDelegate_Parms.RegisterPlayerCompleteDelegate, &RegisterPlayerCompleteDelegate, 0x10 );
@@ -2580,10 +2309,9 @@ void UOnlineGameInterfaceImpl::AddRegisterPlayerCompleteDelegate ( struct FScrip
 
 void UOnlineGameInterfaceImpl::OnRegisterPlayerComplete ( struct SFXName SessionName, struct FUniqueNetId const& PlayerID, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnRegisterPlayerComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRegisterPlayerCompleteRef { L"Function IpDrv.OnlineGameInterfaceImpl.OnRegisterPlayerComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRegisterPlayerComplete )
-		pFnOnRegisterPlayerComplete = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.OnRegisterPlayerComplete" );
+	UFunction* const pFnOnRegisterPlayerComplete = pFnOnRegisterPlayerCompleteRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execOnRegisterPlayerComplete_Parms OnRegisterPlayerComplete_Parms;
 	memcpy ( &OnRegisterPlayerComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2603,10 +2331,9 @@ void UOnlineGameInterfaceImpl::OnRegisterPlayerComplete ( struct SFXName Session
 
 bool UOnlineGameInterfaceImpl::RegisterPlayer ( struct SFXName SessionName, struct FUniqueNetId const& PlayerID, unsigned long bWasInvited )
 {
-	static UFunction* pFnRegisterPlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRegisterPlayerRef { L"Function IpDrv.OnlineGameInterfaceImpl.RegisterPlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRegisterPlayer )
-		pFnRegisterPlayer = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.RegisterPlayer" );
+	UFunction* const pFnRegisterPlayer = pFnRegisterPlayerRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execRegisterPlayer_Parms RegisterPlayer_Parms;
 	memcpy ( &RegisterPlayer_Parms.SessionName, &SessionName, 0x8 );
@@ -2627,10 +2354,9 @@ bool UOnlineGameInterfaceImpl::RegisterPlayer ( struct SFXName SessionName, stru
 
 bool UOnlineGameInterfaceImpl::GetResolvedConnectString ( struct SFXName SessionName, FString* ConnectInfo )
 {
-	static UFunction* pFnGetResolvedConnectString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetResolvedConnectStringRef { L"Function IpDrv.OnlineGameInterfaceImpl.GetResolvedConnectString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetResolvedConnectString )
-		pFnGetResolvedConnectString = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.GetResolvedConnectString" );
+	UFunction* const pFnGetResolvedConnectString = pFnGetResolvedConnectStringRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execGetResolvedConnectString_Parms GetResolvedConnectString_Parms;
 	memcpy ( &GetResolvedConnectString_Parms.SessionName, &SessionName, 0x8 );
@@ -2638,11 +2364,8 @@ bool UOnlineGameInterfaceImpl::GetResolvedConnectString ( struct SFXName Session
 	if ( ConnectInfo )
 		memcpy ( &GetResolvedConnectString_Parms.ConnectInfo, ConnectInfo, 0x10 );
 
-	pFnGetResolvedConnectString->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetResolvedConnectString, &GetResolvedConnectString_Parms, NULL );
-
-	pFnGetResolvedConnectString->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetResolvedConnectString, &GetResolvedConnectString_Parms ) )
+		this->ProcessEvent ( pFnGetResolvedConnectString, &GetResolvedConnectString_Parms, NULL );
 
 	if ( ConnectInfo )
 		memcpy ( ConnectInfo, &GetResolvedConnectString_Parms.ConnectInfo, 0x10 );
@@ -2657,10 +2380,9 @@ bool UOnlineGameInterfaceImpl::GetResolvedConnectString ( struct SFXName Session
 
 void UOnlineGameInterfaceImpl::ClearJoinOnlineGameCompleteDelegate ( struct FScriptDelegate JoinOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearJoinOnlineGameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearJoinOnlineGameCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.ClearJoinOnlineGameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearJoinOnlineGameCompleteDelegate )
-		pFnClearJoinOnlineGameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.ClearJoinOnlineGameCompleteDelegate" );
+	UFunction* const pFnClearJoinOnlineGameCompleteDelegate = pFnClearJoinOnlineGameCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execClearJoinOnlineGameCompleteDelegate_Parms ClearJoinOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearJoinOnlineGameCompleteDelegate_Parms.JoinOnlineGameCompleteDelegate, &JoinOnlineGameCompleteDelegate, 0x10 );
@@ -2675,10 +2397,9 @@ void UOnlineGameInterfaceImpl::ClearJoinOnlineGameCompleteDelegate ( struct FScr
 
 void UOnlineGameInterfaceImpl::AddJoinOnlineGameCompleteDelegate ( struct FScriptDelegate JoinOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddJoinOnlineGameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddJoinOnlineGameCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.AddJoinOnlineGameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddJoinOnlineGameCompleteDelegate )
-		pFnAddJoinOnlineGameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.AddJoinOnlineGameCompleteDelegate" );
+	UFunction* const pFnAddJoinOnlineGameCompleteDelegate = pFnAddJoinOnlineGameCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execAddJoinOnlineGameCompleteDelegate_Parms AddJoinOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddJoinOnlineGameCompleteDelegate_Parms.JoinOnlineGameCompleteDelegate, &JoinOnlineGameCompleteDelegate, 0x10 );
@@ -2694,10 +2415,9 @@ void UOnlineGameInterfaceImpl::AddJoinOnlineGameCompleteDelegate ( struct FScrip
 
 void UOnlineGameInterfaceImpl::OnJoinOnlineGameComplete ( struct SFXName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnJoinOnlineGameComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnJoinOnlineGameCompleteRef { L"Function IpDrv.OnlineGameInterfaceImpl.OnJoinOnlineGameComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnJoinOnlineGameComplete )
-		pFnOnJoinOnlineGameComplete = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.OnJoinOnlineGameComplete" );
+	UFunction* const pFnOnJoinOnlineGameComplete = pFnOnJoinOnlineGameCompleteRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execOnJoinOnlineGameComplete_Parms OnJoinOnlineGameComplete_Parms;
 	memcpy ( &OnJoinOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2716,10 +2436,9 @@ void UOnlineGameInterfaceImpl::OnJoinOnlineGameComplete ( struct SFXName Session
 
 bool UOnlineGameInterfaceImpl::JoinOnlineGame ( unsigned char PlayerNum, struct SFXName SessionName, struct FOnlineGameSearchResult* DesiredGame )
 {
-	static UFunction* pFnJoinOnlineGame = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnJoinOnlineGameRef { L"Function IpDrv.OnlineGameInterfaceImpl.JoinOnlineGame", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnJoinOnlineGame )
-		pFnJoinOnlineGame = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.JoinOnlineGame" );
+	UFunction* const pFnJoinOnlineGame = pFnJoinOnlineGameRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execJoinOnlineGame_Parms JoinOnlineGame_Parms;
 	JoinOnlineGame_Parms.PlayerNum = PlayerNum;
@@ -2728,11 +2447,8 @@ bool UOnlineGameInterfaceImpl::JoinOnlineGame ( unsigned char PlayerNum, struct
 	if ( DesiredGame )
 		memcpy ( &JoinOnlineGame_Parms.DesiredGame, DesiredGame, 0x10 );
 
-	pFnJoinOnlineGame->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnJoinOnlineGame, &JoinOnlineGame_Parms, NULL );
-
-	pFnJoinOnlineGame->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnJoinOnlineGame, &JoinOnlineGame_Parms ) )
+		this->ProcessEvent ( pFnJoinOnlineGame, &JoinOnlineGame_Parms, NULL );
 
 	if ( DesiredGame )
 		memcpy ( DesiredGame, &JoinOnlineGame_Parms.DesiredGame, 0x10 );
@@ -2748,19 +2464,15 @@ bool UOnlineGameInterfaceImpl::JoinOnlineGame ( unsigned char PlayerNum, struct
 
 bool UOnlineGameInterfaceImpl::FreeSearchResults ( class UOnlineGameSearch* Search )
 {
-	static UFunction* pFnFreeSearchResults = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFreeSearchResultsRef { L"Function IpDrv.OnlineGameInterfaceImpl.FreeSearchResults", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFreeSearchResults )
-		pFnFreeSearchResults = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.FreeSearchResults" );
+	UFunction* const pFnFreeSearchResults = pFnFreeSearchResultsRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execFreeSearchResults_Parms FreeSearchResults_Parms;
 	FreeSearchResults_Parms.Search = Search;
 
-	pFnFreeSearchResults->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFreeSearchResults, &FreeSearchResults_Parms, NULL );
-
-	pFnFreeSearchResults->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFreeSearchResults, &FreeSearchResults_Parms ) )
+		this->ProcessEvent ( pFnFreeSearchResults, &FreeSearchResults_Parms, NULL );
 
 	return FreeSearchResults_Parms.ReturnValue;
 };
@@ -2772,10 +2484,9 @@ bool UOnlineGameInterfaceImpl::FreeSearchResults ( class UOnlineGameSearch* Sear
 
 void UOnlineGameInterfaceImpl::ClearCancelFindOnlineGamesCompleteDelegate ( struct FScriptDelegate CancelFindOnlineGamesCompleteDelegate )
 {
-	static UFunction* pFnClearCancelFindOnlineGamesCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearCancelFindOnlineGamesCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.ClearCancelFindOnlineGamesCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearCancelFindOnlineGamesCompleteDelegate )
-		pFnClearCancelFindOnlineGamesCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.ClearCancelFindOnlineGamesCompleteDelegate" );
+	UFunction* const pFnClearCancelFindOnlineGamesCompleteDelegate = pFnClearCancelFindOnlineGamesCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execClearCancelFindOnlineGamesCompleteDelegate_Parms ClearCancelFindOnlineGamesCompleteDelegate_Parms;
 	memcpy ( &ClearCancelFindOnlineGamesCompleteDelegate_Parms.CancelFindOnlineGamesCompleteDelegate, &CancelFindOnlineGamesCompleteDelegate, 0x10 );
@@ -2790,10 +2501,9 @@ void UOnlineGameInterfaceImpl::ClearCancelFindOnlineGamesCompleteDelegate ( stru
 
 void UOnlineGameInterfaceImpl::AddCancelFindOnlineGamesCompleteDelegate ( struct FScriptDelegate CancelFindOnlineGamesCompleteDelegate )
 {
-	static UFunction* pFnAddCancelFindOnlineGamesCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddCancelFindOnlineGamesCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.AddCancelFindOnlineGamesCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddCancelFindOnlineGamesCompleteDelegate )
-		pFnAddCancelFindOnlineGamesCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.AddCancelFindOnlineGamesCompleteDelegate" );
+	UFunction* const pFnAddCancelFindOnlineGamesCompleteDelegate = pFnAddCancelFindOnlineGamesCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execAddCancelFindOnlineGamesCompleteDelegate_Parms AddCancelFindOnlineGamesCompleteDelegate_Parms;
 	memcpy ( &AddCancelFindOnlineGamesCompleteDelegate_Parms.CancelFindOnlineGamesCompleteDelegate, &CancelFindOnlineGamesCompleteDelegate, 0x10 );
@@ -2808,10 +2518,9 @@ void UOnlineGameInterfaceImpl::AddCancelFindOnlineGamesCompleteDelegate ( struct
 
 void UOnlineGameInterfaceImpl::OnCancelFindOnlineGamesComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnCancelFindOnlineGamesComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnCancelFindOnlineGamesCompleteRef { L"Function IpDrv.OnlineGameInterfaceImpl.OnCancelFindOnlineGamesComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnCancelFindOnlineGamesComplete )
-		pFnOnCancelFindOnlineGamesComplete = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.OnCancelFindOnlineGamesComplete" );
+	UFunction* const pFnOnCancelFindOnlineGamesComplete = pFnOnCancelFindOnlineGamesCompleteRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execOnCancelFindOnlineGamesComplete_Parms OnCancelFindOnlineGamesComplete_Parms;
 	OnCancelFindOnlineGamesComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -2826,18 +2535,14 @@ void UOnlineGameInterfaceImpl::OnCancelFindOnlineGamesComplete ( unsigned long b
 
 bool UOnlineGameInterfaceImpl::CancelFindOnlineGames ( )
 {
-	static UFunction* pFnCancelFindOnlineGames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCancelFindOnlineGamesRef { L"Function IpDrv.OnlineGameInterfaceImpl.CancelFindOnlineGames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCancelFindOnlineGames )
-		pFnCancelFindOnlineGames = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.CancelFindOnlineGames" );
+	UFunction* const pFnCancelFindOnlineGames = pFnCancelFindOnlineGamesRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execCancelFindOnlineGames_Parms CancelFindOnlineGames_Parms;
 
-	pFnCancelFindOnlineGames->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCancelFindOnlineGames, &CancelFindOnlineGames_Parms, NULL );
-
-	pFnCancelFindOnlineGames->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCancelFindOnlineGames, &CancelFindOnlineGames_Parms ) )
+		this->ProcessEvent ( pFnCancelFindOnlineGames, &CancelFindOnlineGames_Parms, NULL );
 
 	return CancelFindOnlineGames_Parms.ReturnValue;
 };
@@ -2849,10 +2554,9 @@ bool UOnlineGameInterfaceImpl::CancelFindOnlineGames ( )
 
 void UOnlineGameInterfaceImpl::ClearFindOnlineGamesCompleteDelegate ( struct FScriptDelegate FindOnlineGamesCompleteDelegate )
 {
-	static UFunction* pFnClearFindOnlineGamesCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearFindOnlineGamesCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.ClearFindOnlineGamesCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearFindOnlineGamesCompleteDelegate )
-		pFnClearFindOnlineGamesCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.ClearFindOnlineGamesCompleteDelegate" );
+	UFunction* const pFnClearFindOnlineGamesCompleteDelegate = pFnClearFindOnlineGamesCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execClearFindOnlineGamesCompleteDelegate_Parms ClearFindOnlineGamesCompleteDelegate_Parms;
 	memcpy ( &ClearFindOnlineGamesCompleteDelegate_Parms.FindOnlineGamesCompleteDelegate, &FindOnlineGamesCompleteDelegate, 0x10 );
@@ -2867,10 +2571,9 @@ void UOnlineGameInterfaceImpl::ClearFindOnlineGamesCompleteDelegate ( struct FSc
 
 void UOnlineGameInterfaceImpl::AddFindOnlineGamesCompleteDelegate ( struct FScriptDelegate FindOnlineGamesCompleteDelegate )
 {
-	static UFunction* pFnAddFindOnlineGamesCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddFindOnlineGamesCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.AddFindOnlineGamesCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddFindOnlineGamesCompleteDelegate )
-		pFnAddFindOnlineGamesCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.AddFindOnlineGamesCompleteDelegate" );
+	UFunction* const pFnAddFindOnlineGamesCompleteDelegate = pFnAddFindOnlineGamesCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execAddFindOnlineGamesCompleteDelegate_Parms AddFindOnlineGamesCompleteDelegate_Parms;
 	memcpy ( &AddFindOnlineGamesCompleteDelegate_Parms.FindOnlineGamesCompleteDelegate, &FindOnlineGamesCompleteDelegate, 0x10 );
@@ -2887,20 +2590,16 @@ void UOnlineGameInterfaceImpl::AddFindOnlineGamesCompleteDelegate ( struct FScri
 
 bool UOnlineGameInterfaceImpl::FindOnlineGames ( unsigned char SearchingPlayerNum, class UOnlineGameSearch* SearchSettings )
 {
-	static UFunction* pFnFindOnlineGames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFindOnlineGamesRef { L"Function IpDrv.OnlineGameInterfaceImpl.FindOnlineGames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFindOnlineGames )
-		pFnFindOnlineGames = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.FindOnlineGames" );
+	UFunction* const pFnFindOnlineGames = pFnFindOnlineGamesRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execFindOnlineGames_Parms FindOnlineGames_Parms;
 	FindOnlineGames_Parms.SearchingPlayerNum = SearchingPlayerNum;
 	FindOnlineGames_Parms.SearchSettings = SearchSettings;
 
-	pFnFindOnlineGames->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFindOnlineGames, &FindOnlineGames_Parms, NULL );
-
-	pFnFindOnlineGames->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFindOnlineGames, &FindOnlineGames_Parms ) )
+		this->ProcessEvent ( pFnFindOnlineGames, &FindOnlineGames_Parms, NULL );
 
 	return FindOnlineGames_Parms.ReturnValue;
 };
@@ -2912,10 +2611,9 @@ bool UOnlineGameInterfaceImpl::FindOnlineGames ( unsigned char SearchingPlayerNu
 
 void UOnlineGameInterfaceImpl::ClearDestroyOnlineGameCompleteDelegate ( struct FScriptDelegate DestroyOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearDestroyOnlineGameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearDestroyOnlineGameCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.ClearDestroyOnlineGameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearDestroyOnlineGameCompleteDelegate )
-		pFnClearDestroyOnlineGameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.ClearDestroyOnlineGameCompleteDelegate" );
+	UFunction* const pFnClearDestroyOnlineGameCompleteDelegate = pFnClearDestroyOnlineGameCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execClearDestroyOnlineGameCompleteDelegate_Parms ClearDestroyOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearDestroyOnlineGameCompleteDelegate_Parms.DestroyOnlineGameCompleteDelegate, &DestroyOnlineGameCompleteDelegate, 0x10 );
@@ -2930,10 +2628,9 @@ void UOnlineGameInterfaceImpl::ClearDestroyOnlineGameCompleteDelegate ( struct F
 
 void UOnlineGameInterfaceImpl::AddDestroyOnlineGameCompleteDelegate ( struct FScriptDelegate DestroyOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddDestroyOnlineGameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddDestroyOnlineGameCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.AddDestroyOnlineGameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddDestroyOnlineGameCompleteDelegate )
-		pFnAddDestroyOnlineGameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.AddDestroyOnlineGameCompleteDelegate" );
+	UFunction* const pFnAddDestroyOnlineGameCompleteDelegate = pFnAddDestroyOnlineGameCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execAddDestroyOnlineGameCompleteDelegate_Parms AddDestroyOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddDestroyOnlineGameCompleteDelegate_Parms.DestroyOnlineGameCompleteDelegate, &DestroyOnlineGameCompleteDelegate, 0x10 );
@@ -2949,10 +2646,9 @@ void UOnlineGameInterfaceImpl::AddDestroyOnlineGameCompleteDelegate ( struct FSc
 
 void UOnlineGameInterfaceImpl::OnDestroyOnlineGameComplete ( struct SFXName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnDestroyOnlineGameComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnDestroyOnlineGameCompleteRef { L"Function IpDrv.OnlineGameInterfaceImpl.OnDestroyOnlineGameComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnDestroyOnlineGameComplete )
-		pFnOnDestroyOnlineGameComplete = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.OnDestroyOnlineGameComplete" );
+	UFunction* const pFnOnDestroyOnlineGameComplete = pFnOnDestroyOnlineGameCompleteRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execOnDestroyOnlineGameComplete_Parms OnDestroyOnlineGameComplete_Parms;
 	memcpy ( &OnDestroyOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -2969,19 +2665,15 @@ void UOnlineGameInterfaceImpl::OnDestroyOnlineGameComplete ( struct SFXName Sess
 
 bool UOnlineGameInterfaceImpl::DestroyOnlineGame ( struct SFXName SessionName )
 {
-	static UFunction* pFnDestroyOnlineGame = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDestroyOnlineGameRef { L"Function IpDrv.OnlineGameInterfaceImpl.DestroyOnlineGame", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDestroyOnlineGame )
-		pFnDestroyOnlineGame = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.DestroyOnlineGame" );
+	UFunction* const pFnDestroyOnlineGame = pFnDestroyOnlineGameRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execDestroyOnlineGame_Parms DestroyOnlineGame_Parms;
 	memcpy ( &DestroyOnlineGame_Parms.SessionName, &SessionName, 0x8 );
 
-	pFnDestroyOnlineGame->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDestroyOnlineGame, &DestroyOnlineGame_Parms, NULL );
-
-	pFnDestroyOnlineGame->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDestroyOnlineGame, &DestroyOnlineGame_Parms ) )
+		this->ProcessEvent ( pFnDestroyOnlineGame, &DestroyOnlineGame_Parms, NULL );
 
 	return DestroyOnlineGame_Parms.ReturnValue;
 };
@@ -2993,10 +2685,9 @@ bool UOnlineGameInterfaceImpl::DestroyOnlineGame ( struct SFXName SessionName )
 
 void UOnlineGameInterfaceImpl::ClearUpdateOnlineGameCompleteDelegate ( struct FScriptDelegate UpdateOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearUpdateOnlineGameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearUpdateOnlineGameCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.ClearUpdateOnlineGameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearUpdateOnlineGameCompleteDelegate )
-		pFnClearUpdateOnlineGameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.ClearUpdateOnlineGameCompleteDelegate" );
+	UFunction* const pFnClearUpdateOnlineGameCompleteDelegate = pFnClearUpdateOnlineGameCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execClearUpdateOnlineGameCompleteDelegate_Parms ClearUpdateOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearUpdateOnlineGameCompleteDelegate_Parms.UpdateOnlineGameCompleteDelegate, &UpdateOnlineGameCompleteDelegate, 0x10 );
@@ -3011,10 +2702,9 @@ void UOnlineGameInterfaceImpl::ClearUpdateOnlineGameCompleteDelegate ( struct FS
 
 void UOnlineGameInterfaceImpl::AddUpdateOnlineGameCompleteDelegate ( struct FScriptDelegate UpdateOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddUpdateOnlineGameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddUpdateOnlineGameCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.AddUpdateOnlineGameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddUpdateOnlineGameCompleteDelegate )
-		pFnAddUpdateOnlineGameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.AddUpdateOnlineGameCompleteDelegate" );
+	UFunction* const pFnAddUpdateOnlineGameCompleteDelegate = pFnAddUpdateOnlineGameCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execAddUpdateOnlineGameCompleteDelegate_Parms AddUpdateOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddUpdateOnlineGameCompleteDelegate_Parms.UpdateOnlineGameCompleteDelegate, &UpdateOnlineGameCompleteDelegate, 0x10 );
@@ -3030,10 +2720,9 @@ void UOnlineGameInterfaceImpl::AddUpdateOnlineGameCompleteDelegate ( struct FScr
 
 void UOnlineGameInterfaceImpl::OnUpdateOnlineGameComplete ( struct SFXName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnUpdateOnlineGameComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUpdateOnlineGameCompleteRef { L"Function IpDrv.OnlineGameInterfaceImpl.OnUpdateOnlineGameComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUpdateOnlineGameComplete )
-		pFnOnUpdateOnlineGameComplete = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.OnUpdateOnlineGameComplete" );
+	UFunction* const pFnOnUpdateOnlineGameComplete = pFnOnUpdateOnlineGameCompleteRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execOnUpdateOnlineGameComplete_Parms OnUpdateOnlineGameComplete_Parms;
 	memcpy ( &OnUpdateOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -3052,10 +2741,9 @@ void UOnlineGameInterfaceImpl::OnUpdateOnlineGameComplete ( struct SFXName Sessi
 
 bool UOnlineGameInterfaceImpl::UpdateOnlineGame ( struct SFXName SessionName, class UOnlineGameSettings* UpdatedGameSettings, unsigned long bShouldRefreshOnlineData )
 {
-	static UFunction* pFnUpdateOnlineGame = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdateOnlineGameRef { L"Function IpDrv.OnlineGameInterfaceImpl.UpdateOnlineGame", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdateOnlineGame )
-		pFnUpdateOnlineGame = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.UpdateOnlineGame" );
+	UFunction* const pFnUpdateOnlineGame = pFnUpdateOnlineGameRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execUpdateOnlineGame_Parms UpdateOnlineGame_Parms;
 	memcpy ( &UpdateOnlineGame_Parms.SessionName, &SessionName, 0x8 );
@@ -3074,10 +2762,9 @@ bool UOnlineGameInterfaceImpl::UpdateOnlineGame ( struct SFXName SessionName, cl
 
 void UOnlineGameInterfaceImpl::ClearCreateOnlineGameCompleteDelegate ( struct FScriptDelegate CreateOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnClearCreateOnlineGameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearCreateOnlineGameCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.ClearCreateOnlineGameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearCreateOnlineGameCompleteDelegate )
-		pFnClearCreateOnlineGameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.ClearCreateOnlineGameCompleteDelegate" );
+	UFunction* const pFnClearCreateOnlineGameCompleteDelegate = pFnClearCreateOnlineGameCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execClearCreateOnlineGameCompleteDelegate_Parms ClearCreateOnlineGameCompleteDelegate_Parms;
 	memcpy ( &ClearCreateOnlineGameCompleteDelegate_Parms.CreateOnlineGameCompleteDelegate, &CreateOnlineGameCompleteDelegate, 0x10 );
@@ -3092,10 +2779,9 @@ void UOnlineGameInterfaceImpl::ClearCreateOnlineGameCompleteDelegate ( struct FS
 
 void UOnlineGameInterfaceImpl::AddCreateOnlineGameCompleteDelegate ( struct FScriptDelegate CreateOnlineGameCompleteDelegate )
 {
-	static UFunction* pFnAddCreateOnlineGameCompleteDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddCreateOnlineGameCompleteDelegateRef { L"Function IpDrv.OnlineGameInterfaceImpl.AddCreateOnlineGameCompleteDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddCreateOnlineGameCompleteDelegate )
-		pFnAddCreateOnlineGameCompleteDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.AddCreateOnlineGameCompleteDelegate" );
+	UFunction* const pFnAddCreateOnlineGameCompleteDelegate = pFnAddCreateOnlineGameCompleteDelegateRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execAddCreateOnlineGameCompleteDelegate_Parms AddCreateOnlineGameCompleteDelegate_Parms;
 	memcpy ( &AddCreateOnlineGameCompleteDelegate_Parms.CreateOnlineGameCompleteDelegate, &CreateOnlineGameCompleteDelegate, 0x10 );
@@ -3111,10 +2797,9 @@ void UOnlineGameInterfaceImpl::AddCreateOnlineGameCompleteDelegate ( struct FScr
 
 void UOnlineGameInterfaceImpl::OnCreateOnlineGameComplete ( struct SFXName SessionName, unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnCreateOnlineGameComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnCreateOnlineGameCompleteRef { L"Function IpDrv.OnlineGameInterfaceImpl.OnCreateOnlineGameComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnCreateOnlineGameComplete )
-		pFnOnCreateOnlineGameComplete = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.OnCreateOnlineGameComplete" );
+	UFunction* const pFnOnCreateOnlineGameComplete = pFnOnCreateOnlineGameCompleteRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execOnCreateOnlineGameComplete_Parms OnCreateOnlineGameComplete_Parms;
 	memcpy ( &OnCreateOnlineGameComplete_Parms.SessionName, &SessionName, 0x8 );
@@ -3133,21 +2818,17 @@ void UOnlineGameInterfaceImpl::OnCreateOnlineGameComplete ( struct SFXName Sessi
 
 bool UOnlineGameInterfaceImpl::CreateOnlineGame ( unsigned char HostingPlayerNum, struct SFXName SessionName, class UOnlineGameSettings* NewGameSettings )
 {
-	static UFunction* pFnCreateOnlineGame = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCreateOnlineGameRef { L"Function IpDrv.OnlineGameInterfaceImpl.CreateOnlineGame", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCreateOnlineGame )
-		pFnCreateOnlineGame = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.CreateOnlineGame" );
+	UFunction* const pFnCreateOnlineGame = pFnCreateOnlineGameRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execCreateOnlineGame_Parms CreateOnlineGame_Parms;
 	CreateOnlineGame_Parms.HostingPlayerNum = HostingPlayerNum;
 	memcpy ( &CreateOnlineGame_Parms.SessionName, &SessionName, 0x8 );
 	CreateOnlineGame_Parms.NewGameSettings = NewGameSettings;
 
-	pFnCreateOnlineGame->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCreateOnlineGame, &CreateOnlineGame_Parms, NULL );
-
-	pFnCreateOnlineGame->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCreateOnlineGame, &CreateOnlineGame_Parms ) )
+		this->ProcessEvent ( pFnCreateOnlineGame, &CreateOnlineGame_Parms, NULL );
 
 	return CreateOnlineGame_Parms.ReturnValue;
 };
@@ -3159,10 +2840,9 @@ bool UOnlineGameInterfaceImpl::CreateOnlineGame ( unsigned char HostingPlayerNum
 
 class UOnlineGameSearch* UOnlineGameInterfaceImpl::GetGameSearch ( )
 {
-	static UFunction* pFnGetGameSearch = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetGameSearchRef { L"Function IpDrv.OnlineGameInterfaceImpl.GetGameSearch", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetGameSearch )
-		pFnGetGameSearch = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.GetGameSearch" );
+	UFunction* const pFnGetGameSearch = pFnGetGameSearchRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execGetGameSearch_Parms GetGameSearch_Parms;
 
@@ -3179,10 +2859,9 @@ class UOnlineGameSearch* UOnlineGameInterfaceImpl::GetGameSearch ( )
 
 class UOnlineGameSettings* UOnlineGameInterfaceImpl::GetGameSettings ( struct SFXName SessionName )
 {
-	static UFunction* pFnGetGameSettings = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetGameSettingsRef { L"Function IpDrv.OnlineGameInterfaceImpl.GetGameSettings", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetGameSettings )
-		pFnGetGameSettings = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.GetGameSettings" );
+	UFunction* const pFnGetGameSettings = pFnGetGameSettingsRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execGetGameSettings_Parms GetGameSettings_Parms;
 	memcpy ( &GetGameSettings_Parms.SessionName, &SessionName, 0x8 );
@@ -3199,10 +2878,9 @@ class UOnlineGameSettings* UOnlineGameInterfaceImpl::GetGameSettings ( struct SF
 
 void UOnlineGameInterfaceImpl::OnFindOnlineGamesComplete ( unsigned long bWasSuccessful )
 {
-	static UFunction* pFnOnFindOnlineGamesComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnFindOnlineGamesCompleteRef { L"Function IpDrv.OnlineGameInterfaceImpl.OnFindOnlineGamesComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnFindOnlineGamesComplete )
-		pFnOnFindOnlineGamesComplete = UObject::FindObject< UFunction > ( L"Function IpDrv.OnlineGameInterfaceImpl.OnFindOnlineGamesComplete" );
+	UFunction* const pFnOnFindOnlineGamesComplete = pFnOnFindOnlineGamesCompleteRef.Get ( );
 
 	UOnlineGameInterfaceImpl_execOnFindOnlineGamesComplete_Parms OnFindOnlineGamesComplete_Parms;
 	OnFindOnlineGamesComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -3212,14 +2890,11 @@ void UOnlineGameInterfaceImpl::OnFindOnlineGamesComplete ( unsigned long bWasSuc
 
 
 
-class UClass* UPartyBeacon::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UPartyBeacon::pClassPointer { L"Class IpDrv.PartyBeacon", &UObject::FindClass };
 
 class UClass* UPartyBeacon::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.PartyBeacon" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.PartyBeacon.OnDestroyComplete
@@ -3228,10 +2903,9 @@ class UClass* UPartyBeacon::StaticClass()
 
 void UPartyBeacon::OnDestroyComplete ( )
 {
-	static UFunction* pFnOnDestroyComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnDestroyCompleteRef { L"Function IpDrv.PartyBeacon.OnDestroyComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnDestroyComplete )
-		pFnOnDestroyComplete = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeacon.OnDestroyComplete" );
+	UFunction* const pFnOnDestroyComplete = pFnOnDestroyCompleteRef.Get ( );
 
 	UPartyBeacon_execOnDestroyComplete_Parms OnDestroyComplete_Parms;
 
@@ -3244,30 +2918,23 @@ void UPartyBeacon::OnDestroyComplete ( )
 
 void UPartyBeacon::eventDestroyBeacon ( )
 {
-	static UFunction* pFnDestroyBeacon = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDestroyBeaconRef { L"Function IpDrv.PartyBeacon.DestroyBeacon", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDestroyBeacon )
-		pFnDestroyBeacon = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeacon.DestroyBeacon" );
+	UFunction* const pFnDestroyBeacon = pFnDestroyBeaconRef.Get ( );
 
 	UPartyBeacon_eventDestroyBeacon_Parms DestroyBeacon_Parms;
 
-	pFnDestroyBeacon->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDestroyBeacon, &DestroyBeacon_Parms, NULL );
-
-	pFnDestroyBeacon->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDestroyBeacon, &DestroyBeacon_Parms ) )
+		this->ProcessEvent ( pFnDestroyBeacon, &DestroyBeacon_Parms, NULL );
 };
 
 
 
-class UClass* UPartyBeaconClient::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UPartyBeaconClient::pClassPointer { L"Class IpDrv.PartyBeaconClient", &UObject::FindClass };
 
 class UClass* UPartyBeaconClient::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.PartyBeaconClient" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.PartyBeaconClient.DestroyBeacon
@@ -3276,18 +2943,14 @@ class UClass* UPartyBeaconClient::StaticClass()
 
 void UPartyBeaconClient::eventDestroyBeacon ( )
 {
-	static UFunction* pFnDestroyBeacon = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDestroyBeaconRef { L"Function IpDrv.PartyBeaconClient.DestroyBeacon", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDestroyBeacon )
-		pFnDestroyBeacon = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconClient.DestroyBeacon" );
+	UFunction* const pFnDestroyBeacon = pFnDestroyBeaconRef.Get ( );
 
 	UPartyBeaconClient_eventDestroyBeacon_Parms DestroyBeacon_Parms;
 
-	pFnDestroyBeacon->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDestroyBeacon, &DestroyBeacon_Parms, NULL );
-
-	pFnDestroyBeacon->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDestroyBeacon, &DestroyBeacon_Parms ) )
+		this->ProcessEvent ( pFnDestroyBeacon, &DestroyBeacon_Parms, NULL );
 };
 
 // Function IpDrv.PartyBeaconClient.CancelReservation
@@ -3298,19 +2961,15 @@ void UPartyBeaconClient::eventDestroyBeacon ( )
 
 bool UPartyBeaconClient::CancelReservation ( struct FUniqueNetId const& CancellingPartyLeader )
 {
-	static UFunction* pFnCancelReservation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCancelReservationRef { L"Function IpDrv.PartyBeaconClient.CancelReservation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCancelReservation )
-		pFnCancelReservation = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconClient.CancelReservation" );
+	UFunction* const pFnCancelReservation = pFnCancelReservationRef.Get ( );
 
 	UPartyBeaconClient_execCancelReservation_Parms CancelReservation_Parms;
 	memcpy ( &CancelReservation_Parms.CancellingPartyLeader, &CancellingPartyLeader, 0x8 );
 
-	pFnCancelReservation->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCancelReservation, &CancelReservation_Parms, NULL );
-
-	pFnCancelReservation->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCancelReservation, &CancelReservation_Parms ) )
+		this->ProcessEvent ( pFnCancelReservation, &CancelReservation_Parms, NULL );
 
 	return CancelReservation_Parms.ReturnValue;
 };
@@ -3325,10 +2984,9 @@ bool UPartyBeaconClient::CancelReservation ( struct FUniqueNetId const& Cancelli
 
 bool UPartyBeaconClient::RequestReservationUpdate ( struct FUniqueNetId const& RequestingPartyLeader, struct FOnlineGameSearchResult* DesiredHost, TArray<struct FPlayerReservation>* PlayersToAdd )
 {
-	static UFunction* pFnRequestReservationUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRequestReservationUpdateRef { L"Function IpDrv.PartyBeaconClient.RequestReservationUpdate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRequestReservationUpdate )
-		pFnRequestReservationUpdate = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconClient.RequestReservationUpdate" );
+	UFunction* const pFnRequestReservationUpdate = pFnRequestReservationUpdateRef.Get ( );
 
 	UPartyBeaconClient_execRequestReservationUpdate_Parms RequestReservationUpdate_Parms;
 	memcpy ( &RequestReservationUpdate_Parms.RequestingPartyLeader, &RequestingPartyLeader, 0x8 );
@@ -3339,11 +2997,8 @@ bool UPartyBeaconClient::RequestReservationUpdate ( struct FUniqueNetId const& R
 	if ( PlayersToAdd )
 		memcpy ( &RequestReservationUpdate_Parms.PlayersToAdd, PlayersToAdd, 0x10 );
 
-	pFnRequestReservationUpdate->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRequestReservationUpdate, &RequestReservationUpdate_Parms, NULL );
-
-	pFnRequestReservationUpdate->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRequestReservationUpdate, &RequestReservationUpdate_Parms ) )
+		this->ProcessEvent ( pFnRequestReservationUpdate, &RequestReservationUpdate_Parms, NULL );
 
 	if ( DesiredHost )
 		memcpy ( DesiredHost, &RequestReservationUpdate_Parms.DesiredHost, 0x10 );
@@ -3364,10 +3019,9 @@ bool UPartyBeaconClient::RequestReservationUpdate ( struct FUniqueNetId const& R
 
 bool UPartyBeaconClient::RequestReservation ( struct FUniqueNetId const& RequestingPartyLeader, struct FOnlineGameSearchResult* DesiredHost, TArray<struct FPlayerReservation>* Players )
 {
-	static UFunction* pFnRequestReservation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRequestReservationRef { L"Function IpDrv.PartyBeaconClient.RequestReservation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRequestReservation )
-		pFnRequestReservation = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconClient.RequestReservation" );
+	UFunction* const pFnRequestReservation = pFnRequestReservationRef.Get ( );
 
 	UPartyBeaconClient_execRequestReservation_Parms RequestReservation_Parms;
 	memcpy ( &RequestReservation_Parms.RequestingPartyLeader, &RequestingPartyLeader, 0x8 );
@@ -3378,11 +3032,8 @@ bool UPartyBeaconClient::RequestReservation ( struct FUniqueNetId const& Request
 	if ( Players )
 		memcpy ( &RequestReservation_Parms.Players, Players, 0x10 );
 
-	pFnRequestReservation->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRequestReservation, &RequestReservation_Parms, NULL );
-
-	pFnRequestReservation->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRequestReservation, &RequestReservation_Parms ) )
+		this->ProcessEvent ( pFnRequestReservation, &RequestReservation_Parms, NULL );
 
 	if ( DesiredHost )
 		memcpy ( DesiredHost, &RequestReservation_Parms.DesiredHost, 0x10 );
@@ -3399,10 +3050,9 @@ bool UPartyBeaconClient::RequestReservation ( struct FUniqueNetId const& Request
 
 void UPartyBeaconClient::OnHostHasCancelled ( )
 {
-	static UFunction* pFnOnHostHasCancelled = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnHostHasCancelledRef { L"Function IpDrv.PartyBeaconClient.OnHostHasCancelled", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnHostHasCancelled )
-		pFnOnHostHasCancelled = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconClient.OnHostHasCancelled" );
+	UFunction* const pFnOnHostHasCancelled = pFnOnHostHasCancelledRef.Get ( );
 
 	UPartyBeaconClient_execOnHostHasCancelled_Parms OnHostHasCancelled_Parms;
 
@@ -3415,10 +3065,9 @@ void UPartyBeaconClient::OnHostHasCancelled ( )
 
 void UPartyBeaconClient::OnHostIsReady ( )
 {
-	static UFunction* pFnOnHostIsReady = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnHostIsReadyRef { L"Function IpDrv.PartyBeaconClient.OnHostIsReady", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnHostIsReady )
-		pFnOnHostIsReady = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconClient.OnHostIsReady" );
+	UFunction* const pFnOnHostIsReady = pFnOnHostIsReadyRef.Get ( );
 
 	UPartyBeaconClient_execOnHostIsReady_Parms OnHostIsReady_Parms;
 
@@ -3434,10 +3083,9 @@ void UPartyBeaconClient::OnHostIsReady ( )
 
 void UPartyBeaconClient::OnTravelRequestReceived ( struct SFXName SessionName, class UClass* SearchClass, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnOnTravelRequestReceived = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnTravelRequestReceivedRef { L"Function IpDrv.PartyBeaconClient.OnTravelRequestReceived", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnTravelRequestReceived )
-		pFnOnTravelRequestReceived = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconClient.OnTravelRequestReceived" );
+	UFunction* const pFnOnTravelRequestReceived = pFnOnTravelRequestReceivedRef.Get ( );
 
 	UPartyBeaconClient_execOnTravelRequestReceived_Parms OnTravelRequestReceived_Parms;
 	memcpy ( &OnTravelRequestReceived_Parms.SessionName, &SessionName, 0x8 );
@@ -3454,10 +3102,9 @@ void UPartyBeaconClient::OnTravelRequestReceived ( struct SFXName SessionName, c
 
 void UPartyBeaconClient::OnReservationCountUpdated ( int ReservationRemaining )
 {
-	static UFunction* pFnOnReservationCountUpdated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReservationCountUpdatedRef { L"Function IpDrv.PartyBeaconClient.OnReservationCountUpdated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReservationCountUpdated )
-		pFnOnReservationCountUpdated = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconClient.OnReservationCountUpdated" );
+	UFunction* const pFnOnReservationCountUpdated = pFnOnReservationCountUpdatedRef.Get ( );
 
 	UPartyBeaconClient_execOnReservationCountUpdated_Parms OnReservationCountUpdated_Parms;
 	OnReservationCountUpdated_Parms.ReservationRemaining = ReservationRemaining;
@@ -3472,10 +3119,9 @@ void UPartyBeaconClient::OnReservationCountUpdated ( int ReservationRemaining )
 
 void UPartyBeaconClient::OnReservationRequestComplete ( unsigned char ReservationResult )
 {
-	static UFunction* pFnOnReservationRequestComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReservationRequestCompleteRef { L"Function IpDrv.PartyBeaconClient.OnReservationRequestComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReservationRequestComplete )
-		pFnOnReservationRequestComplete = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconClient.OnReservationRequestComplete" );
+	UFunction* const pFnOnReservationRequestComplete = pFnOnReservationRequestCompleteRef.Get ( );
 
 	UPartyBeaconClient_execOnReservationRequestComplete_Parms OnReservationRequestComplete_Parms;
 	OnReservationRequestComplete_Parms.ReservationResult = ReservationResult;
@@ -3485,14 +3131,11 @@ void UPartyBeaconClient::OnReservationRequestComplete ( unsigned char Reservatio
 
 
 
-class UClass* UPartyBeaconHost::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UPartyBeaconHost::pClassPointer { L"Class IpDrv.PartyBeaconHost", &UObject::FindClass };
 
 class UClass* UPartyBeaconHost::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.PartyBeaconHost" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.PartyBeaconHost.DumpReservations
@@ -3501,10 +3144,9 @@ class UClass* UPartyBeaconHost::StaticClass()
 
 void UPartyBeaconHost::DumpReservations ( )
 {
-	static UFunction* pFnDumpReservations = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDumpReservationsRef { L"Function IpDrv.PartyBeaconHost.DumpReservations", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDumpReservations )
-		pFnDumpReservations = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.DumpReservations" );
+	UFunction* const pFnDumpReservations = pFnDumpReservationsRef.Get ( );
 
 	UPartyBeaconHost_execDumpReservations_Parms DumpReservations_Parms;
 
@@ -3518,18 +3160,14 @@ void UPartyBeaconHost::DumpReservations ( )
 
 int UPartyBeaconHost::GetMaxAvailableTeamSize ( )
 {
-	static UFunction* pFnGetMaxAvailableTeamSize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetMaxAvailableTeamSizeRef { L"Function IpDrv.PartyBeaconHost.GetMaxAvailableTeamSize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetMaxAvailableTeamSize )
-		pFnGetMaxAvailableTeamSize = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.GetMaxAvailableTeamSize" );
+	UFunction* const pFnGetMaxAvailableTeamSize = pFnGetMaxAvailableTeamSizeRef.Get ( );
 
 	UPartyBeaconHost_execGetMaxAvailableTeamSize_Parms GetMaxAvailableTeamSize_Parms;
 
-	pFnGetMaxAvailableTeamSize->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetMaxAvailableTeamSize, &GetMaxAvailableTeamSize_Parms, NULL );
-
-	pFnGetMaxAvailableTeamSize->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetMaxAvailableTeamSize, &GetMaxAvailableTeamSize_Parms ) )
+		this->ProcessEvent ( pFnGetMaxAvailableTeamSize, &GetMaxAvailableTeamSize_Parms, NULL );
 
 	return GetMaxAvailableTeamSize_Parms.ReturnValue;
 };
@@ -3541,10 +3179,9 @@ int UPartyBeaconHost::GetMaxAvailableTeamSize ( )
 
 void UPartyBeaconHost::GetPartyLeaders ( TArray<struct FUniqueNetId>* PartyLeaders )
 {
-	static UFunction* pFnGetPartyLeaders = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPartyLeadersRef { L"Function IpDrv.PartyBeaconHost.GetPartyLeaders", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPartyLeaders )
-		pFnGetPartyLeaders = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.GetPartyLeaders" );
+	UFunction* const pFnGetPartyLeaders = pFnGetPartyLeadersRef.Get ( );
 
 	UPartyBeaconHost_execGetPartyLeaders_Parms GetPartyLeaders_Parms;
 
@@ -3564,10 +3201,9 @@ void UPartyBeaconHost::GetPartyLeaders ( TArray<struct FUniqueNetId>* PartyLeade
 
 void UPartyBeaconHost::GetPlayers ( TArray<struct FUniqueNetId>* Players )
 {
-	static UFunction* pFnGetPlayers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPlayersRef { L"Function IpDrv.PartyBeaconHost.GetPlayers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPlayers )
-		pFnGetPlayers = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.GetPlayers" );
+	UFunction* const pFnGetPlayers = pFnGetPlayersRef.Get ( );
 
 	UPartyBeaconHost_execGetPlayers_Parms GetPlayers_Parms;
 
@@ -3587,19 +3223,15 @@ void UPartyBeaconHost::GetPlayers ( TArray<struct FUniqueNetId>* Players )
 
 void UPartyBeaconHost::AppendReservationSkillsToSearch ( class UOnlineGameSearch* Search )
 {
-	static UFunction* pFnAppendReservationSkillsToSearch = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAppendReservationSkillsToSearchRef { L"Function IpDrv.PartyBeaconHost.AppendReservationSkillsToSearch", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAppendReservationSkillsToSearch )
-		pFnAppendReservationSkillsToSearch = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.AppendReservationSkillsToSearch" );
+	UFunction* const pFnAppendReservationSkillsToSearch = pFnAppendReservationSkillsToSearchRef.Get ( );
 
 	UPartyBeaconHost_execAppendReservationSkillsToSearch_Parms AppendReservationSkillsToSearch_Parms;
 	AppendReservationSkillsToSearch_Parms.Search = Search;
 
-	pFnAppendReservationSkillsToSearch->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAppendReservationSkillsToSearch, &AppendReservationSkillsToSearch_Parms, NULL );
-
-	pFnAppendReservationSkillsToSearch->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAppendReservationSkillsToSearch, &AppendReservationSkillsToSearch_Parms ) )
+		this->ProcessEvent ( pFnAppendReservationSkillsToSearch, &AppendReservationSkillsToSearch_Parms, NULL );
 };
 
 // Function IpDrv.PartyBeaconHost.UnregisterParty
@@ -3609,10 +3241,9 @@ void UPartyBeaconHost::AppendReservationSkillsToSearch ( class UOnlineGameSearch
 
 void UPartyBeaconHost::eventUnregisterParty ( struct FUniqueNetId const& PartyLeader )
 {
-	static UFunction* pFnUnregisterParty = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnregisterPartyRef { L"Function IpDrv.PartyBeaconHost.UnregisterParty", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnregisterParty )
-		pFnUnregisterParty = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.UnregisterParty" );
+	UFunction* const pFnUnregisterParty = pFnUnregisterPartyRef.Get ( );
 
 	UPartyBeaconHost_eventUnregisterParty_Parms UnregisterParty_Parms;
 	memcpy ( &UnregisterParty_Parms.PartyLeader, &PartyLeader, 0x8 );
@@ -3626,10 +3257,9 @@ void UPartyBeaconHost::eventUnregisterParty ( struct FUniqueNetId const& PartyLe
 
 void UPartyBeaconHost::eventUnregisterPartyMembers ( )
 {
-	static UFunction* pFnUnregisterPartyMembers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnregisterPartyMembersRef { L"Function IpDrv.PartyBeaconHost.UnregisterPartyMembers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnregisterPartyMembers )
-		pFnUnregisterPartyMembers = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.UnregisterPartyMembers" );
+	UFunction* const pFnUnregisterPartyMembers = pFnUnregisterPartyMembersRef.Get ( );
 
 	UPartyBeaconHost_eventUnregisterPartyMembers_Parms UnregisterPartyMembers_Parms;
 
@@ -3642,10 +3272,9 @@ void UPartyBeaconHost::eventUnregisterPartyMembers ( )
 
 void UPartyBeaconHost::eventRegisterPartyMembers ( )
 {
-	static UFunction* pFnRegisterPartyMembers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRegisterPartyMembersRef { L"Function IpDrv.PartyBeaconHost.RegisterPartyMembers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRegisterPartyMembers )
-		pFnRegisterPartyMembers = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.RegisterPartyMembers" );
+	UFunction* const pFnRegisterPartyMembers = pFnRegisterPartyMembersRef.Get ( );
 
 	UPartyBeaconHost_eventRegisterPartyMembers_Parms RegisterPartyMembers_Parms;
 
@@ -3659,10 +3288,9 @@ void UPartyBeaconHost::eventRegisterPartyMembers ( )
 
 bool UPartyBeaconHost::AreReservationsFull ( )
 {
-	static UFunction* pFnAreReservationsFull = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAreReservationsFullRef { L"Function IpDrv.PartyBeaconHost.AreReservationsFull", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAreReservationsFull )
-		pFnAreReservationsFull = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.AreReservationsFull" );
+	UFunction* const pFnAreReservationsFull = pFnAreReservationsFullRef.Get ( );
 
 	UPartyBeaconHost_execAreReservationsFull_Parms AreReservationsFull_Parms;
 
@@ -3677,18 +3305,14 @@ bool UPartyBeaconHost::AreReservationsFull ( )
 
 void UPartyBeaconHost::TellClientsHostHasCancelled ( )
 {
-	static UFunction* pFnTellClientsHostHasCancelled = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTellClientsHostHasCancelledRef { L"Function IpDrv.PartyBeaconHost.TellClientsHostHasCancelled", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTellClientsHostHasCancelled )
-		pFnTellClientsHostHasCancelled = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.TellClientsHostHasCancelled" );
+	UFunction* const pFnTellClientsHostHasCancelled = pFnTellClientsHostHasCancelledRef.Get ( );
 
 	UPartyBeaconHost_execTellClientsHostHasCancelled_Parms TellClientsHostHasCancelled_Parms;
 
-	pFnTellClientsHostHasCancelled->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnTellClientsHostHasCancelled, &TellClientsHostHasCancelled_Parms, NULL );
-
-	pFnTellClientsHostHasCancelled->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnTellClientsHostHasCancelled, &TellClientsHostHasCancelled_Parms ) )
+		this->ProcessEvent ( pFnTellClientsHostHasCancelled, &TellClientsHostHasCancelled_Parms, NULL );
 };
 
 // Function IpDrv.PartyBeaconHost.TellClientsHostIsReady
@@ -3697,18 +3321,14 @@ void UPartyBeaconHost::TellClientsHostHasCancelled ( )
 
 void UPartyBeaconHost::TellClientsHostIsReady ( )
 {
-	static UFunction* pFnTellClientsHostIsReady = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTellClientsHostIsReadyRef { L"Function IpDrv.PartyBeaconHost.TellClientsHostIsReady", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTellClientsHostIsReady )
-		pFnTellClientsHostIsReady = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.TellClientsHostIsReady" );
+	UFunction* const pFnTellClientsHostIsReady = pFnTellClientsHostIsReadyRef.Get ( );
 
 	UPartyBeaconHost_execTellClientsHostIsReady_Parms TellClientsHostIsReady_Parms;
 
-	pFnTellClientsHostIsReady->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnTellClientsHostIsReady, &TellClientsHostIsReady_Parms, NULL );
-
-	pFnTellClientsHostIsReady->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnTellClientsHostIsReady, &TellClientsHostIsReady_Parms ) )
+		this->ProcessEvent ( pFnTellClientsHostIsReady, &TellClientsHostIsReady_Parms, NULL );
 };
 
 // Function IpDrv.PartyBeaconHost.TellClientsToTravel
@@ -3720,21 +3340,17 @@ void UPartyBeaconHost::TellClientsHostIsReady ( )
 
 void UPartyBeaconHost::TellClientsToTravel ( struct SFXName SessionName, class UClass* SearchClass, unsigned char* PlatformSpecificInfo )
 {
-	static UFunction* pFnTellClientsToTravel = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTellClientsToTravelRef { L"Function IpDrv.PartyBeaconHost.TellClientsToTravel", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTellClientsToTravel )
-		pFnTellClientsToTravel = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.TellClientsToTravel" );
+	UFunction* const pFnTellClientsToTravel = pFnTellClientsToTravelRef.Get ( );
 
 	UPartyBeaconHost_execTellClientsToTravel_Parms TellClientsToTravel_Parms;
 	memcpy ( &TellClientsToTravel_Parms.SessionName, &SessionName, 0x8 );
 	TellClientsToTravel_Parms.SearchClass = SearchClass;
 	memcpy ( &TellClientsToTravel_Parms.PlatformSpecificInfo, &PlatformSpecificInfo, 0x50 );
 
-	pFnTellClientsToTravel->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnTellClientsToTravel, &TellClientsToTravel_Parms, NULL );
-
-	pFnTellClientsToTravel->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnTellClientsToTravel, &TellClientsToTravel_Parms ) )
+		this->ProcessEvent ( pFnTellClientsToTravel, &TellClientsToTravel_Parms, NULL );
 };
 
 // Function IpDrv.PartyBeaconHost.DestroyBeacon
@@ -3743,18 +3359,14 @@ void UPartyBeaconHost::TellClientsToTravel ( struct SFXName SessionName, class U
 
 void UPartyBeaconHost::eventDestroyBeacon ( )
 {
-	static UFunction* pFnDestroyBeacon = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDestroyBeaconRef { L"Function IpDrv.PartyBeaconHost.DestroyBeacon", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDestroyBeacon )
-		pFnDestroyBeacon = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.DestroyBeacon" );
+	UFunction* const pFnDestroyBeacon = pFnDestroyBeaconRef.Get ( );
 
 	UPartyBeaconHost_eventDestroyBeacon_Parms DestroyBeacon_Parms;
 
-	pFnDestroyBeacon->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDestroyBeacon, &DestroyBeacon_Parms, NULL );
-
-	pFnDestroyBeacon->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDestroyBeacon, &DestroyBeacon_Parms ) )
+		this->ProcessEvent ( pFnDestroyBeacon, &DestroyBeacon_Parms, NULL );
 };
 
 // Function IpDrv.PartyBeaconHost.OnClientCancellationReceived
@@ -3764,10 +3376,9 @@ void UPartyBeaconHost::eventDestroyBeacon ( )
 
 void UPartyBeaconHost::OnClientCancellationReceived ( struct FUniqueNetId const& PartyLeader )
 {
-	static UFunction* pFnOnClientCancellationReceived = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnClientCancellationReceivedRef { L"Function IpDrv.PartyBeaconHost.OnClientCancellationReceived", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnClientCancellationReceived )
-		pFnOnClientCancellationReceived = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.OnClientCancellationReceived" );
+	UFunction* const pFnOnClientCancellationReceived = pFnOnClientCancellationReceivedRef.Get ( );
 
 	UPartyBeaconHost_execOnClientCancellationReceived_Parms OnClientCancellationReceived_Parms;
 	memcpy ( &OnClientCancellationReceived_Parms.PartyLeader, &PartyLeader, 0x8 );
@@ -3781,10 +3392,9 @@ void UPartyBeaconHost::OnClientCancellationReceived ( struct FUniqueNetId const&
 
 void UPartyBeaconHost::OnReservationsFull ( )
 {
-	static UFunction* pFnOnReservationsFull = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReservationsFullRef { L"Function IpDrv.PartyBeaconHost.OnReservationsFull", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReservationsFull )
-		pFnOnReservationsFull = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.OnReservationsFull" );
+	UFunction* const pFnOnReservationsFull = pFnOnReservationsFullRef.Get ( );
 
 	UPartyBeaconHost_execOnReservationsFull_Parms OnReservationsFull_Parms;
 
@@ -3797,10 +3407,9 @@ void UPartyBeaconHost::OnReservationsFull ( )
 
 void UPartyBeaconHost::OnReservationChange ( )
 {
-	static UFunction* pFnOnReservationChange = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReservationChangeRef { L"Function IpDrv.PartyBeaconHost.OnReservationChange", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReservationChange )
-		pFnOnReservationChange = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.OnReservationChange" );
+	UFunction* const pFnOnReservationChange = pFnOnReservationChangeRef.Get ( );
 
 	UPartyBeaconHost_execOnReservationChange_Parms OnReservationChange_Parms;
 
@@ -3815,20 +3424,16 @@ void UPartyBeaconHost::OnReservationChange ( )
 
 void UPartyBeaconHost::HandlePlayerLogout ( struct FUniqueNetId const& PlayerID, unsigned long bMaintainParty )
 {
-	static UFunction* pFnHandlePlayerLogout = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHandlePlayerLogoutRef { L"Function IpDrv.PartyBeaconHost.HandlePlayerLogout", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHandlePlayerLogout )
-		pFnHandlePlayerLogout = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.HandlePlayerLogout" );
+	UFunction* const pFnHandlePlayerLogout = pFnHandlePlayerLogoutRef.Get ( );
 
 	UPartyBeaconHost_execHandlePlayerLogout_Parms HandlePlayerLogout_Parms;
 	memcpy ( &HandlePlayerLogout_Parms.PlayerID, &PlayerID, 0x8 );
 	HandlePlayerLogout_Parms.bMaintainParty = bMaintainParty;
 
-	pFnHandlePlayerLogout->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnHandlePlayerLogout, &HandlePlayerLogout_Parms, NULL );
-
-	pFnHandlePlayerLogout->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnHandlePlayerLogout, &HandlePlayerLogout_Parms ) )
+		this->ProcessEvent ( pFnHandlePlayerLogout, &HandlePlayerLogout_Parms, NULL );
 };
 
 // Function IpDrv.PartyBeaconHost.UpdatePartyReservationEntry
@@ -3840,10 +3445,9 @@ void UPartyBeaconHost::HandlePlayerLogout ( struct FUniqueNetId const& PlayerID,
 
 unsigned char UPartyBeaconHost::UpdatePartyReservationEntry ( struct FUniqueNetId const& PartyLeader, TArray<struct FPlayerReservation>* PlayerMembers )
 {
-	static UFunction* pFnUpdatePartyReservationEntry = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdatePartyReservationEntryRef { L"Function IpDrv.PartyBeaconHost.UpdatePartyReservationEntry", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdatePartyReservationEntry )
-		pFnUpdatePartyReservationEntry = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.UpdatePartyReservationEntry" );
+	UFunction* const pFnUpdatePartyReservationEntry = pFnUpdatePartyReservationEntryRef.Get ( );
 
 	UPartyBeaconHost_execUpdatePartyReservationEntry_Parms UpdatePartyReservationEntry_Parms;
 	memcpy ( &UpdatePartyReservationEntry_Parms.PartyLeader, &PartyLeader, 0x8 );
@@ -3851,11 +3455,8 @@ unsigned char UPartyBeaconHost::UpdatePartyReservationEntry ( struct FUniqueNetI
 	if ( PlayerMembers )
 		memcpy ( &UpdatePartyReservationEntry_Parms.PlayerMembers, PlayerMembers, 0x10 );
 
-	pFnUpdatePartyReservationEntry->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnUpdatePartyReservationEntry, &UpdatePartyReservationEntry_Parms, NULL );
-
-	pFnUpdatePartyReservationEntry->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnUpdatePartyReservationEntry, &UpdatePartyReservationEntry_Parms ) )
+		this->ProcessEvent ( pFnUpdatePartyReservationEntry, &UpdatePartyReservationEntry_Parms, NULL );
 
 	if ( PlayerMembers )
 		memcpy ( PlayerMembers, &UpdatePartyReservationEntry_Parms.PlayerMembers, 0x10 );
@@ -3874,10 +3475,9 @@ unsigned char UPartyBeaconHost::UpdatePartyReservationEntry ( struct FUniqueNetI
 
 unsigned char UPartyBeaconHost::AddPartyReservationEntry ( struct FUniqueNetId const& PartyLeader, int TeamNum, unsigned long bIsHost, TArray<struct FPlayerReservation>* PlayerMembers )
 {
-	static UFunction* pFnAddPartyReservationEntry = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddPartyReservationEntryRef { L"Function IpDrv.PartyBeaconHost.AddPartyReservationEntry", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddPartyReservationEntry )
-		pFnAddPartyReservationEntry = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.AddPartyReservationEntry" );
+	UFunction* const pFnAddPartyReservationEntry = pFnAddPartyReservationEntryRef.Get ( );
 
 	UPartyBeaconHost_execAddPartyReservationEntry_Parms AddPartyReservationEntry_Parms;
 	memcpy ( &AddPartyReservationEntry_Parms.PartyLeader, &PartyLeader, 0x8 );
@@ -3887,11 +3487,8 @@ unsigned char UPartyBeaconHost::AddPartyReservationEntry ( struct FUniqueNetId c
 	if ( PlayerMembers )
 		memcpy ( &AddPartyReservationEntry_Parms.PlayerMembers, PlayerMembers, 0x10 );
 
-	pFnAddPartyReservationEntry->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddPartyReservationEntry, &AddPartyReservationEntry_Parms, NULL );
-
-	pFnAddPartyReservationEntry->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAddPartyReservationEntry, &AddPartyReservationEntry_Parms ) )
+		this->ProcessEvent ( pFnAddPartyReservationEntry, &AddPartyReservationEntry_Parms, NULL );
 
 	if ( PlayerMembers )
 		memcpy ( PlayerMembers, &AddPartyReservationEntry_Parms.PlayerMembers, 0x10 );
@@ -3910,10 +3507,9 @@ unsigned char UPartyBeaconHost::AddPartyReservationEntry ( struct FUniqueNetId c
 
 bool UPartyBeaconHost::InitHostBeacon ( int InNumTeams, int InNumPlayersPerTeam, int InNumReservations, struct SFXName InSessionName )
 {
-	static UFunction* pFnInitHostBeacon = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitHostBeaconRef { L"Function IpDrv.PartyBeaconHost.InitHostBeacon", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitHostBeacon )
-		pFnInitHostBeacon = UObject::FindObject< UFunction > ( L"Function IpDrv.PartyBeaconHost.InitHostBeacon" );
+	UFunction* const pFnInitHostBeacon = pFnInitHostBeaconRef.Get ( );
 
 	UPartyBeaconHost_execInitHostBeacon_Parms InitHostBeacon_Parms;
 	InitHostBeacon_Parms.InNumTeams = InNumTeams;
@@ -3921,49 +3517,37 @@ bool UPartyBeaconHost::InitHostBeacon ( int InNumTeams, int InNumPlayersPerTeam,
 	InitHostBeacon_Parms.InNumReservations = InNumReservations;
 	memcpy ( &InitHostBeacon_Parms.InSessionName, &InSessionName, 0x8 );
 
-	pFnInitHostBeacon->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnInitHostBeacon, &InitHostBeacon_Parms, NULL );
-
-	pFnInitHostBeacon->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnInitHostBeacon, &InitHostBeacon_Parms ) )
+		this->ProcessEvent ( pFnInitHostBeacon, &InitHostBeacon_Parms, NULL );
 
 	return InitHostBeacon_Parms.ReturnValue;
 };
 
 
 
-class UClass* UTcpipConnection::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UTcpipConnection::pClassPointer { L"Class IpDrv.TcpipConnection", &UObject::FindClass };
 
 class UClass* UTcpipConnection::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.TcpipConnection" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UTcpNetDriver::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UTcpNetDriver::pClassPointer { L"Class IpDrv.TcpNetDriver", &UObject::FindClass };
 
 class UClass* UTcpNetDriver::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.TcpNetDriver" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UWebRequest::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWebRequest::pClassPointer { L"Class IpDrv.WebRequest", &UObject::FindClass };
 
 class UClass* UWebRequest::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.WebRequest" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.WebRequest.GetHexDigit
@@ -3974,10 +3558,9 @@ class UClass* UWebRequest::StaticClass()
 
 int UWebRequest::GetHexDigit ( FString const& D )
 {
-	static UFunction* pFnGetHexDigit = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetHexDigitRef { L"Function IpDrv.WebRequest.GetHexDigit", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetHexDigit )
-		pFnGetHexDigit = UObject::FindObject< UFunction > ( L"Function IpDrv.WebRequest.GetHexDigit" );
+	UFunction* const pFnGetHexDigit = pFnGetHexDigitRef.Get ( );
 
 	UWebRequest_execGetHexDigit_Parms GetHexDigit_Parms;
 	memcpy ( &GetHexDigit_Parms.D, &D, 0x10 );
@@ -3994,10 +3577,9 @@ int UWebRequest::GetHexDigit ( FString const& D )
 
 void UWebRequest::DecodeFormData ( FString const& Data )
 {
-	static UFunction* pFnDecodeFormData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDecodeFormDataRef { L"Function IpDrv.WebRequest.DecodeFormData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDecodeFormData )
-		pFnDecodeFormData = UObject::FindObject< UFunction > ( L"Function IpDrv.WebRequest.DecodeFormData" );
+	UFunction* const pFnDecodeFormData = pFnDecodeFormDataRef.Get ( );
 
 	UWebRequest_execDecodeFormData_Parms DecodeFormData_Parms;
 	memcpy ( &DecodeFormData_Parms.Data, &Data, 0x10 );
@@ -4012,10 +3594,9 @@ void UWebRequest::DecodeFormData ( FString const& Data )
 
 void UWebRequest::ProcessHeaderString ( FString const& S )
 {
-	static UFunction* pFnProcessHeaderString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnProcessHeaderStringRef { L"Function IpDrv.WebRequest.ProcessHeaderString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnProcessHeaderString )
-		pFnProcessHeaderString = UObject::FindObject< UFunction > ( L"Function IpDrv.WebRequest.ProcessHeaderString" );
+	UFunction* const pFnProcessHeaderString = pFnProcessHeaderStringRef.Get ( );
 
 	UWebRequest_execProcessHeaderString_Parms ProcessHeaderString_Parms;
 	memcpy ( &ProcessHeaderString_Parms.S, &S, 0x10 );
@@ -4029,18 +3610,14 @@ void UWebRequest::ProcessHeaderString ( FString const& S )
 
 void UWebRequest::Dump ( )
 {
-	static UFunction* pFnDump = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDumpRef { L"Function IpDrv.WebRequest.Dump", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDump )
-		pFnDump = UObject::FindObject< UFunction > ( L"Function IpDrv.WebRequest.Dump" );
+	UFunction* const pFnDump = pFnDumpRef.Get ( );
 
 	UWebRequest_execDump_Parms Dump_Parms;
 
-	pFnDump->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDump, &Dump_Parms, NULL );
-
-	pFnDump->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDump, &Dump_Parms ) )
+		this->ProcessEvent ( pFnDump, &Dump_Parms, NULL );
 };
 
 // Function IpDrv.WebRequest.GetVariables
@@ -4050,21 +3627,17 @@ void UWebRequest::Dump ( )
 
 void UWebRequest::GetVariables ( TArray<FString>* varNames )
 {
-	static UFunction* pFnGetVariables = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVariablesRef { L"Function IpDrv.WebRequest.GetVariables", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVariables )
-		pFnGetVariables = UObject::FindObject< UFunction > ( L"Function IpDrv.WebRequest.GetVariables" );
+	UFunction* const pFnGetVariables = pFnGetVariablesRef.Get ( );
 
 	UWebRequest_execGetVariables_Parms GetVariables_Parms;
 
 	if ( varNames )
 		memcpy ( &GetVariables_Parms.varNames, varNames, 0x10 );
 
-	pFnGetVariables->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVariables, &GetVariables_Parms, NULL );
-
-	pFnGetVariables->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVariables, &GetVariables_Parms ) )
+		this->ProcessEvent ( pFnGetVariables, &GetVariables_Parms, NULL );
 
 	if ( varNames )
 		memcpy ( varNames, &GetVariables_Parms.varNames, 0x10 );
@@ -4080,21 +3653,17 @@ void UWebRequest::GetVariables ( TArray<FString>* varNames )
 
 FString UWebRequest::GetVariableNumber ( FString const& VariableName, int Number, FString const& DefaultValue )
 {
-	static UFunction* pFnGetVariableNumber = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVariableNumberRef { L"Function IpDrv.WebRequest.GetVariableNumber", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVariableNumber )
-		pFnGetVariableNumber = UObject::FindObject< UFunction > ( L"Function IpDrv.WebRequest.GetVariableNumber" );
+	UFunction* const pFnGetVariableNumber = pFnGetVariableNumberRef.Get ( );
 
 	UWebRequest_execGetVariableNumber_Parms GetVariableNumber_Parms;
 	memcpy ( &GetVariableNumber_Parms.VariableName, &VariableName, 0x10 );
 	GetVariableNumber_Parms.Number = Number;
 	memcpy ( &GetVariableNumber_Parms.DefaultValue, &DefaultValue, 0x10 );
 
-	pFnGetVariableNumber->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVariableNumber, &GetVariableNumber_Parms, NULL );
-
-	pFnGetVariableNumber->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVariableNumber, &GetVariableNumber_Parms ) )
+		this->ProcessEvent ( pFnGetVariableNumber, &GetVariableNumber_Parms, NULL );
 
 	return GetVariableNumber_Parms.ReturnValue;
 };
@@ -4107,19 +3676,15 @@ FString UWebRequest::GetVariableNumber ( FString const& VariableName, int Number
 
 int UWebRequest::GetVariableCount ( FString const& VariableName )
 {
-	static UFunction* pFnGetVariableCount = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVariableCountRef { L"Function IpDrv.WebRequest.GetVariableCount", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVariableCount )
-		pFnGetVariableCount = UObject::FindObject< UFunction > ( L"Function IpDrv.WebRequest.GetVariableCount" );
+	UFunction* const pFnGetVariableCount = pFnGetVariableCountRef.Get ( );
 
 	UWebRequest_execGetVariableCount_Parms GetVariableCount_Parms;
 	memcpy ( &GetVariableCount_Parms.VariableName, &VariableName, 0x10 );
 
-	pFnGetVariableCount->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVariableCount, &GetVariableCount_Parms, NULL );
-
-	pFnGetVariableCount->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVariableCount, &GetVariableCount_Parms ) )
+		this->ProcessEvent ( pFnGetVariableCount, &GetVariableCount_Parms, NULL );
 
 	return GetVariableCount_Parms.ReturnValue;
 };
@@ -4133,20 +3698,16 @@ int UWebRequest::GetVariableCount ( FString const& VariableName )
 
 FString UWebRequest::GetVariable ( FString const& VariableName, FString const& DefaultValue )
 {
-	static UFunction* pFnGetVariable = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVariableRef { L"Function IpDrv.WebRequest.GetVariable", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVariable )
-		pFnGetVariable = UObject::FindObject< UFunction > ( L"Function IpDrv.WebRequest.GetVariable" );
+	UFunction* const pFnGetVariable = pFnGetVariableRef.Get ( );
 
 	UWebRequest_execGetVariable_Parms GetVariable_Parms;
 	memcpy ( &GetVariable_Parms.VariableName, &VariableName, 0x10 );
 	memcpy ( &GetVariable_Parms.DefaultValue, &DefaultValue, 0x10 );
 
-	pFnGetVariable->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetVariable, &GetVariable_Parms, NULL );
-
-	pFnGetVariable->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetVariable, &GetVariable_Parms ) )
+		this->ProcessEvent ( pFnGetVariable, &GetVariable_Parms, NULL );
 
 	return GetVariable_Parms.ReturnValue;
 };
@@ -4159,20 +3720,16 @@ FString UWebRequest::GetVariable ( FString const& VariableName, FString const& D
 
 void UWebRequest::AddVariable ( FString const& VariableName, FString const& Value )
 {
-	static UFunction* pFnAddVariable = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddVariableRef { L"Function IpDrv.WebRequest.AddVariable", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddVariable )
-		pFnAddVariable = UObject::FindObject< UFunction > ( L"Function IpDrv.WebRequest.AddVariable" );
+	UFunction* const pFnAddVariable = pFnAddVariableRef.Get ( );
 
 	UWebRequest_execAddVariable_Parms AddVariable_Parms;
 	memcpy ( &AddVariable_Parms.VariableName, &VariableName, 0x10 );
 	memcpy ( &AddVariable_Parms.Value, &Value, 0x10 );
 
-	pFnAddVariable->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddVariable, &AddVariable_Parms, NULL );
-
-	pFnAddVariable->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAddVariable, &AddVariable_Parms ) )
+		this->ProcessEvent ( pFnAddVariable, &AddVariable_Parms, NULL );
 };
 
 // Function IpDrv.WebRequest.GetHeaders
@@ -4182,21 +3739,17 @@ void UWebRequest::AddVariable ( FString const& VariableName, FString const& Valu
 
 void UWebRequest::GetHeaders ( TArray<FString>* headers )
 {
-	static UFunction* pFnGetHeaders = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetHeadersRef { L"Function IpDrv.WebRequest.GetHeaders", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetHeaders )
-		pFnGetHeaders = UObject::FindObject< UFunction > ( L"Function IpDrv.WebRequest.GetHeaders" );
+	UFunction* const pFnGetHeaders = pFnGetHeadersRef.Get ( );
 
 	UWebRequest_execGetHeaders_Parms GetHeaders_Parms;
 
 	if ( headers )
 		memcpy ( &GetHeaders_Parms.headers, headers, 0x10 );
 
-	pFnGetHeaders->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetHeaders, &GetHeaders_Parms, NULL );
-
-	pFnGetHeaders->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetHeaders, &GetHeaders_Parms ) )
+		this->ProcessEvent ( pFnGetHeaders, &GetHeaders_Parms, NULL );
 
 	if ( headers )
 		memcpy ( headers, &GetHeaders_Parms.headers, 0x10 );
@@ -4211,20 +3764,16 @@ void UWebRequest::GetHeaders ( TArray<FString>* headers )
 
 FString UWebRequest::GetHeader ( FString const& HeaderName, FString const& DefaultValue )
 {
-	static UFunction* pFnGetHeader = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetHeaderRef { L"Function IpDrv.WebRequest.GetHeader", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetHeader )
-		pFnGetHeader = UObject::FindObject< UFunction > ( L"Function IpDrv.WebRequest.GetHeader" );
+	UFunction* const pFnGetHeader = pFnGetHeaderRef.Get ( );
 
 	UWebRequest_execGetHeader_Parms GetHeader_Parms;
 	memcpy ( &GetHeader_Parms.HeaderName, &HeaderName, 0x10 );
 	memcpy ( &GetHeader_Parms.DefaultValue, &DefaultValue, 0x10 );
 
-	pFnGetHeader->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetHeader, &GetHeader_Parms, NULL );
-
-	pFnGetHeader->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetHeader, &GetHeader_Parms ) )
+		this->ProcessEvent ( pFnGetHeader, &GetHeader_Parms, NULL );
 
 	return GetHeader_Parms.ReturnValue;
 };
@@ -4237,20 +3786,16 @@ FString UWebRequest::GetHeader ( FString const& HeaderName, FString const& Defau
 
 void UWebRequest::AddHeader ( FString const& HeaderName, FString const& Value )
 {
-	static UFunction* pFnAddHeader = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddHeaderRef { L"Function IpDrv.WebRequest.AddHeader", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddHeader )
-		pFnAddHeader = UObject::FindObject< UFunction > ( L"Function IpDrv.WebRequest.AddHeader" );
+	UFunction* const pFnAddHeader = pFnAddHeaderRef.Get ( );
 
 	UWebRequest_execAddHeader_Parms AddHeader_Parms;
 	memcpy ( &AddHeader_Parms.HeaderName, &HeaderName, 0x10 );
 	memcpy ( &AddHeader_Parms.Value, &Value, 0x10 );
 
-	pFnAddHeader->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAddHeader, &AddHeader_Parms, NULL );
-
-	pFnAddHeader->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAddHeader, &AddHeader_Parms ) )
+		this->ProcessEvent ( pFnAddHeader, &AddHeader_Parms, NULL );
 };
 
 // Function IpDrv.WebRequest.EncodeBase64
@@ -4261,19 +3806,15 @@ void UWebRequest::AddHeader ( FString const& HeaderName, FString const& Value )
 
 FString UWebRequest::EncodeBase64 ( FString const& Decoded )
 {
-	static UFunction* pFnEncodeBase64 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEncodeBase64Ref { L"Function IpDrv.WebRequest.EncodeBase64", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEncodeBase64 )
-		pFnEncodeBase64 = UObject::FindObject< UFunction > ( L"Function IpDrv.WebRequest.EncodeBase64" );
+	UFunction* const pFnEncodeBase64 = pFnEncodeBase64Ref.Get ( );
 
 	UWebRequest_execEncodeBase64_Parms EncodeBase64_Parms;
 	memcpy ( &EncodeBase64_Parms.Decoded, &Decoded, 0x10 );
 
-	pFnEncodeBase64->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnEncodeBase64, &EncodeBase64_Parms, NULL );
-
-	pFnEncodeBase64->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnEncodeBase64, &EncodeBase64_Parms ) )
+		this->ProcessEvent ( pFnEncodeBase64, &EncodeBase64_Parms, NULL );
 
 	return EncodeBase64_Parms.ReturnValue;
 };
@@ -4286,33 +3827,26 @@ FString UWebRequest::EncodeBase64 ( FString const& Decoded )
 
 FString UWebRequest::DecodeBase64 ( FString const& Encoded )
 {
-	static UFunction* pFnDecodeBase64 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDecodeBase64Ref { L"Function IpDrv.WebRequest.DecodeBase64", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDecodeBase64 )
-		pFnDecodeBase64 = UObject::FindObject< UFunction > ( L"Function IpDrv.WebRequest.DecodeBase64" );
+	UFunction* const pFnDecodeBase64 = pFnDecodeBase64Ref.Get ( );
 
 	UWebRequest_execDecodeBase64_Parms DecodeBase64_Parms;
 	memcpy ( &DecodeBase64_Parms.Encoded, &Encoded, 0x10 );
 
-	pFnDecodeBase64->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDecodeBase64, &DecodeBase64_Parms, NULL );
-
-	pFnDecodeBase64->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDecodeBase64, &DecodeBase64_Parms ) )
+		this->ProcessEvent ( pFnDecodeBase64, &DecodeBase64_Parms, NULL );
 
 	return DecodeBase64_Parms.ReturnValue;
 };
 
 
 
-class UClass* UWebResponse::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWebResponse::pClassPointer { L"Class IpDrv.WebResponse", &UObject::FindClass };
 
 class UClass* UWebResponse::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.WebResponse" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.WebResponse.SentResponse
@@ -4322,10 +3856,9 @@ class UClass* UWebResponse::StaticClass()
 
 bool UWebResponse::SentResponse ( )
 {
-	static UFunction* pFnSentResponse = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSentResponseRef { L"Function IpDrv.WebResponse.SentResponse", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSentResponse )
-		pFnSentResponse = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.SentResponse" );
+	UFunction* const pFnSentResponse = pFnSentResponseRef.Get ( );
 
 	UWebResponse_execSentResponse_Parms SentResponse_Parms;
 
@@ -4341,10 +3874,9 @@ bool UWebResponse::SentResponse ( )
 
 bool UWebResponse::SentText ( )
 {
-	static UFunction* pFnSentText = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSentTextRef { L"Function IpDrv.WebResponse.SentText", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSentText )
-		pFnSentText = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.SentText" );
+	UFunction* const pFnSentText = pFnSentTextRef.Get ( );
 
 	UWebResponse_execSentText_Parms SentText_Parms;
 
@@ -4360,10 +3892,9 @@ bool UWebResponse::SentText ( )
 
 void UWebResponse::Redirect ( FString const& URL )
 {
-	static UFunction* pFnRedirect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRedirectRef { L"Function IpDrv.WebResponse.Redirect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRedirect )
-		pFnRedirect = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.Redirect" );
+	UFunction* const pFnRedirect = pFnRedirectRef.Get ( );
 
 	UWebResponse_execRedirect_Parms Redirect_Parms;
 	memcpy ( &Redirect_Parms.URL, &URL, 0x10 );
@@ -4379,10 +3910,9 @@ void UWebResponse::Redirect ( FString const& URL )
 
 void UWebResponse::SendStandardHeaders ( FString const& ContentType, unsigned long bCache )
 {
-	static UFunction* pFnSendStandardHeaders = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSendStandardHeadersRef { L"Function IpDrv.WebResponse.SendStandardHeaders", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSendStandardHeaders )
-		pFnSendStandardHeaders = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.SendStandardHeaders" );
+	UFunction* const pFnSendStandardHeaders = pFnSendStandardHeadersRef.Get ( );
 
 	UWebResponse_execSendStandardHeaders_Parms SendStandardHeaders_Parms;
 	memcpy ( &SendStandardHeaders_Parms.ContentType, &ContentType, 0x10 );
@@ -4399,10 +3929,9 @@ void UWebResponse::SendStandardHeaders ( FString const& ContentType, unsigned lo
 
 void UWebResponse::HTTPError ( int ErrorNum, FString const& Data )
 {
-	static UFunction* pFnHTTPError = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHTTPErrorRef { L"Function IpDrv.WebResponse.HTTPError", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHTTPError )
-		pFnHTTPError = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.HTTPError" );
+	UFunction* const pFnHTTPError = pFnHTTPErrorRef.Get ( );
 
 	UWebResponse_execHTTPError_Parms HTTPError_Parms;
 	HTTPError_Parms.ErrorNum = ErrorNum;
@@ -4417,10 +3946,9 @@ void UWebResponse::HTTPError ( int ErrorNum, FString const& Data )
 
 void UWebResponse::SendHeaders ( )
 {
-	static UFunction* pFnSendHeaders = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSendHeadersRef { L"Function IpDrv.WebResponse.SendHeaders", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSendHeaders )
-		pFnSendHeaders = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.SendHeaders" );
+	UFunction* const pFnSendHeaders = pFnSendHeadersRef.Get ( );
 
 	UWebResponse_execSendHeaders_Parms SendHeaders_Parms;
 
@@ -4435,10 +3963,9 @@ void UWebResponse::SendHeaders ( )
 
 void UWebResponse::AddHeader ( FString const& Header, unsigned long bReplace )
 {
-	static UFunction* pFnAddHeader = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddHeaderRef { L"Function IpDrv.WebResponse.AddHeader", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddHeader )
-		pFnAddHeader = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.AddHeader" );
+	UFunction* const pFnAddHeader = pFnAddHeaderRef.Get ( );
 
 	UWebResponse_execAddHeader_Parms AddHeader_Parms;
 	memcpy ( &AddHeader_Parms.Header, &Header, 0x10 );
@@ -4454,10 +3981,9 @@ void UWebResponse::AddHeader ( FString const& Header, unsigned long bReplace )
 
 void UWebResponse::HTTPHeader ( FString const& Header )
 {
-	static UFunction* pFnHTTPHeader = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHTTPHeaderRef { L"Function IpDrv.WebResponse.HTTPHeader", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHTTPHeader )
-		pFnHTTPHeader = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.HTTPHeader" );
+	UFunction* const pFnHTTPHeader = pFnHTTPHeaderRef.Get ( );
 
 	UWebResponse_execHTTPHeader_Parms HTTPHeader_Parms;
 	memcpy ( &HTTPHeader_Parms.Header, &Header, 0x10 );
@@ -4472,10 +3998,9 @@ void UWebResponse::HTTPHeader ( FString const& Header )
 
 void UWebResponse::HTTPResponse ( FString const& Header )
 {
-	static UFunction* pFnHTTPResponse = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHTTPResponseRef { L"Function IpDrv.WebResponse.HTTPResponse", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHTTPResponse )
-		pFnHTTPResponse = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.HTTPResponse" );
+	UFunction* const pFnHTTPResponse = pFnHTTPResponseRef.Get ( );
 
 	UWebResponse_execHTTPResponse_Parms HTTPResponse_Parms;
 	memcpy ( &HTTPResponse_Parms.Header, &Header, 0x10 );
@@ -4490,10 +4015,9 @@ void UWebResponse::HTTPResponse ( FString const& Header )
 
 void UWebResponse::FailAuthentication ( FString const& Realm )
 {
-	static UFunction* pFnFailAuthentication = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFailAuthenticationRef { L"Function IpDrv.WebResponse.FailAuthentication", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFailAuthentication )
-		pFnFailAuthentication = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.FailAuthentication" );
+	UFunction* const pFnFailAuthentication = pFnFailAuthenticationRef.Get ( );
 
 	UWebResponse_execFailAuthentication_Parms FailAuthentication_Parms;
 	memcpy ( &FailAuthentication_Parms.Realm, &Realm, 0x10 );
@@ -4510,10 +4034,9 @@ void UWebResponse::FailAuthentication ( FString const& Realm )
 
 bool UWebResponse::SendCachedFile ( FString const& Filename, FString const& ContentType )
 {
-	static UFunction* pFnSendCachedFile = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSendCachedFileRef { L"Function IpDrv.WebResponse.SendCachedFile", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSendCachedFile )
-		pFnSendCachedFile = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.SendCachedFile" );
+	UFunction* const pFnSendCachedFile = pFnSendCachedFileRef.Get ( );
 
 	UWebResponse_execSendCachedFile_Parms SendCachedFile_Parms;
 	memcpy ( &SendCachedFile_Parms.Filename, &Filename, 0x10 );
@@ -4532,10 +4055,9 @@ bool UWebResponse::SendCachedFile ( FString const& Filename, FString const& Cont
 
 void UWebResponse::eventSendBinary ( int Count, unsigned char* B )
 {
-	static UFunction* pFnSendBinary = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSendBinaryRef { L"Function IpDrv.WebResponse.SendBinary", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSendBinary )
-		pFnSendBinary = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.SendBinary" );
+	UFunction* const pFnSendBinary = pFnSendBinaryRef.Get ( );
 
 	UWebResponse_eventSendBinary_Parms SendBinary_Parms;
 	SendBinary_Parms.Count = Count;
@@ -4552,10 +4074,9 @@ void UWebResponse::eventSendBinary ( int Count, unsigned char* B )
 
 void UWebResponse::eventSendText ( FString const& Text, unsigned long bNoCRLF )
 {
-	static UFunction* pFnSendText = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSendTextRef { L"Function IpDrv.WebResponse.SendText", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSendText )
-		pFnSendText = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.SendText" );
+	UFunction* const pFnSendText = pFnSendTextRef.Get ( );
 
 	UWebResponse_eventSendText_Parms SendText_Parms;
 	memcpy ( &SendText_Parms.Text, &Text, 0x10 );
@@ -4570,18 +4091,14 @@ void UWebResponse::eventSendText ( FString const& Text, unsigned long bNoCRLF )
 
 void UWebResponse::Dump ( )
 {
-	static UFunction* pFnDump = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDumpRef { L"Function IpDrv.WebResponse.Dump", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDump )
-		pFnDump = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.Dump" );
+	UFunction* const pFnDump = pFnDumpRef.Get ( );
 
 	UWebResponse_execDump_Parms Dump_Parms;
 
-	pFnDump->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDump, &Dump_Parms, NULL );
-
-	pFnDump->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDump, &Dump_Parms ) )
+		this->ProcessEvent ( pFnDump, &Dump_Parms, NULL );
 };
 
 // Function IpDrv.WebResponse.GetHTTPExpiration
@@ -4592,19 +4109,15 @@ void UWebResponse::Dump ( )
 
 FString UWebResponse::GetHTTPExpiration ( int OffsetSeconds )
 {
-	static UFunction* pFnGetHTTPExpiration = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetHTTPExpirationRef { L"Function IpDrv.WebResponse.GetHTTPExpiration", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetHTTPExpiration )
-		pFnGetHTTPExpiration = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.GetHTTPExpiration" );
+	UFunction* const pFnGetHTTPExpiration = pFnGetHTTPExpirationRef.Get ( );
 
 	UWebResponse_execGetHTTPExpiration_Parms GetHTTPExpiration_Parms;
 	GetHTTPExpiration_Parms.OffsetSeconds = OffsetSeconds;
 
-	pFnGetHTTPExpiration->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetHTTPExpiration, &GetHTTPExpiration_Parms, NULL );
-
-	pFnGetHTTPExpiration->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetHTTPExpiration, &GetHTTPExpiration_Parms ) )
+		this->ProcessEvent ( pFnGetHTTPExpiration, &GetHTTPExpiration_Parms, NULL );
 
 	return GetHTTPExpiration_Parms.ReturnValue;
 };
@@ -4617,19 +4130,15 @@ FString UWebResponse::GetHTTPExpiration ( int OffsetSeconds )
 
 FString UWebResponse::LoadParsedUHTM ( FString const& Filename )
 {
-	static UFunction* pFnLoadParsedUHTM = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLoadParsedUHTMRef { L"Function IpDrv.WebResponse.LoadParsedUHTM", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLoadParsedUHTM )
-		pFnLoadParsedUHTM = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.LoadParsedUHTM" );
+	UFunction* const pFnLoadParsedUHTM = pFnLoadParsedUHTMRef.Get ( );
 
 	UWebResponse_execLoadParsedUHTM_Parms LoadParsedUHTM_Parms;
 	memcpy ( &LoadParsedUHTM_Parms.Filename, &Filename, 0x10 );
 
-	pFnLoadParsedUHTM->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnLoadParsedUHTM, &LoadParsedUHTM_Parms, NULL );
-
-	pFnLoadParsedUHTM->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnLoadParsedUHTM, &LoadParsedUHTM_Parms ) )
+		this->ProcessEvent ( pFnLoadParsedUHTM, &LoadParsedUHTM_Parms, NULL );
 
 	return LoadParsedUHTM_Parms.ReturnValue;
 };
@@ -4642,19 +4151,15 @@ FString UWebResponse::LoadParsedUHTM ( FString const& Filename )
 
 bool UWebResponse::IncludeBinaryFile ( FString const& Filename )
 {
-	static UFunction* pFnIncludeBinaryFile = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIncludeBinaryFileRef { L"Function IpDrv.WebResponse.IncludeBinaryFile", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIncludeBinaryFile )
-		pFnIncludeBinaryFile = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.IncludeBinaryFile" );
+	UFunction* const pFnIncludeBinaryFile = pFnIncludeBinaryFileRef.Get ( );
 
 	UWebResponse_execIncludeBinaryFile_Parms IncludeBinaryFile_Parms;
 	memcpy ( &IncludeBinaryFile_Parms.Filename, &Filename, 0x10 );
 
-	pFnIncludeBinaryFile->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIncludeBinaryFile, &IncludeBinaryFile_Parms, NULL );
-
-	pFnIncludeBinaryFile->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIncludeBinaryFile, &IncludeBinaryFile_Parms ) )
+		this->ProcessEvent ( pFnIncludeBinaryFile, &IncludeBinaryFile_Parms, NULL );
 
 	return IncludeBinaryFile_Parms.ReturnValue;
 };
@@ -4667,19 +4172,15 @@ bool UWebResponse::IncludeBinaryFile ( FString const& Filename )
 
 bool UWebResponse::IncludeUHTM ( FString const& Filename )
 {
-	static UFunction* pFnIncludeUHTM = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIncludeUHTMRef { L"Function IpDrv.WebResponse.IncludeUHTM", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIncludeUHTM )
-		pFnIncludeUHTM = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.IncludeUHTM" );
+	UFunction* const pFnIncludeUHTM = pFnIncludeUHTMRef.Get ( );
 
 	UWebResponse_execIncludeUHTM_Parms IncludeUHTM_Parms;
 	memcpy ( &IncludeUHTM_Parms.Filename, &Filename, 0x10 );
 
-	pFnIncludeUHTM->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIncludeUHTM, &IncludeUHTM_Parms, NULL );
-
-	pFnIncludeUHTM->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIncludeUHTM, &IncludeUHTM_Parms ) )
+		this->ProcessEvent ( pFnIncludeUHTM, &IncludeUHTM_Parms, NULL );
 
 	return IncludeUHTM_Parms.ReturnValue;
 };
@@ -4690,18 +4191,14 @@ bool UWebResponse::IncludeUHTM ( FString const& Filename )
 
 void UWebResponse::ClearSubst ( )
 {
-	static UFunction* pFnClearSubst = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearSubstRef { L"Function IpDrv.WebResponse.ClearSubst", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearSubst )
-		pFnClearSubst = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.ClearSubst" );
+	UFunction* const pFnClearSubst = pFnClearSubstRef.Get ( );
 
 	UWebResponse_execClearSubst_Parms ClearSubst_Parms;
 
-	pFnClearSubst->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnClearSubst, &ClearSubst_Parms, NULL );
-
-	pFnClearSubst->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnClearSubst, &ClearSubst_Parms ) )
+		this->ProcessEvent ( pFnClearSubst, &ClearSubst_Parms, NULL );
 };
 
 // Function IpDrv.WebResponse.Subst
@@ -4713,21 +4210,17 @@ void UWebResponse::ClearSubst ( )
 
 void UWebResponse::Subst ( FString const& Variable, FString const& Value, unsigned long bClear )
 {
-	static UFunction* pFnSubst = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSubstRef { L"Function IpDrv.WebResponse.Subst", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSubst )
-		pFnSubst = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.Subst" );
+	UFunction* const pFnSubst = pFnSubstRef.Get ( );
 
 	UWebResponse_execSubst_Parms Subst_Parms;
 	memcpy ( &Subst_Parms.Variable, &Variable, 0x10 );
 	memcpy ( &Subst_Parms.Value, &Value, 0x10 );
 	Subst_Parms.bClear = bClear;
 
-	pFnSubst->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSubst, &Subst_Parms, NULL );
-
-	pFnSubst->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSubst, &Subst_Parms ) )
+		this->ProcessEvent ( pFnSubst, &Subst_Parms, NULL );
 };
 
 // Function IpDrv.WebResponse.FileExists
@@ -4738,33 +4231,26 @@ void UWebResponse::Subst ( FString const& Variable, FString const& Value, unsign
 
 bool UWebResponse::FileExists ( FString const& Filename )
 {
-	static UFunction* pFnFileExists = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFileExistsRef { L"Function IpDrv.WebResponse.FileExists", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFileExists )
-		pFnFileExists = UObject::FindObject< UFunction > ( L"Function IpDrv.WebResponse.FileExists" );
+	UFunction* const pFnFileExists = pFnFileExistsRef.Get ( );
 
 	UWebResponse_execFileExists_Parms FileExists_Parms;
 	memcpy ( &FileExists_Parms.Filename, &Filename, 0x10 );
 
-	pFnFileExists->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFileExists, &FileExists_Parms, NULL );
-
-	pFnFileExists->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFileExists, &FileExists_Parms ) )
+		this->ProcessEvent ( pFnFileExists, &FileExists_Parms, NULL );
 
 	return FileExists_Parms.ReturnValue;
 };
 
 
 
-class UClass* UWebApplication::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWebApplication::pClassPointer { L"Class IpDrv.WebApplication", &UObject::FindClass };
 
 class UClass* UWebApplication::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.WebApplication" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.WebApplication.PostQuery
@@ -4775,10 +4261,9 @@ class UClass* UWebApplication::StaticClass()
 
 void UWebApplication::PostQuery ( class UWebRequest* Request, class UWebResponse* Response )
 {
-	static UFunction* pFnPostQuery = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPostQueryRef { L"Function IpDrv.WebApplication.PostQuery", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPostQuery )
-		pFnPostQuery = UObject::FindObject< UFunction > ( L"Function IpDrv.WebApplication.PostQuery" );
+	UFunction* const pFnPostQuery = pFnPostQueryRef.Get ( );
 
 	UWebApplication_execPostQuery_Parms PostQuery_Parms;
 	PostQuery_Parms.Request = Request;
@@ -4795,10 +4280,9 @@ void UWebApplication::PostQuery ( class UWebRequest* Request, class UWebResponse
 
 void UWebApplication::Query ( class UWebRequest* Request, class UWebResponse* Response )
 {
-	static UFunction* pFnQuery = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnQueryRef { L"Function IpDrv.WebApplication.Query", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnQuery )
-		pFnQuery = UObject::FindObject< UFunction > ( L"Function IpDrv.WebApplication.Query" );
+	UFunction* const pFnQuery = pFnQueryRef.Get ( );
 
 	UWebApplication_execQuery_Parms Query_Parms;
 	Query_Parms.Request = Request;
@@ -4816,10 +4300,9 @@ void UWebApplication::Query ( class UWebRequest* Request, class UWebResponse* Re
 
 bool UWebApplication::PreQuery ( class UWebRequest* Request, class UWebResponse* Response )
 {
-	static UFunction* pFnPreQuery = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPreQueryRef { L"Function IpDrv.WebApplication.PreQuery", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPreQuery )
-		pFnPreQuery = UObject::FindObject< UFunction > ( L"Function IpDrv.WebApplication.PreQuery" );
+	UFunction* const pFnPreQuery = pFnPreQueryRef.Get ( );
 
 	UWebApplication_execPreQuery_Parms PreQuery_Parms;
 	PreQuery_Parms.Request = Request;
@@ -4836,10 +4319,9 @@ bool UWebApplication::PreQuery ( class UWebRequest* Request, class UWebResponse*
 
 void UWebApplication::CleanupApp ( )
 {
-	static UFunction* pFnCleanupApp = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCleanupAppRef { L"Function IpDrv.WebApplication.CleanupApp", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCleanupApp )
-		pFnCleanupApp = UObject::FindObject< UFunction > ( L"Function IpDrv.WebApplication.CleanupApp" );
+	UFunction* const pFnCleanupApp = pFnCleanupAppRef.Get ( );
 
 	UWebApplication_execCleanupApp_Parms CleanupApp_Parms;
 
@@ -4852,10 +4334,9 @@ void UWebApplication::CleanupApp ( )
 
 void UWebApplication::Cleanup ( )
 {
-	static UFunction* pFnCleanup = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCleanupRef { L"Function IpDrv.WebApplication.Cleanup", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCleanup )
-		pFnCleanup = UObject::FindObject< UFunction > ( L"Function IpDrv.WebApplication.Cleanup" );
+	UFunction* const pFnCleanup = pFnCleanupRef.Get ( );
 
 	UWebApplication_execCleanup_Parms Cleanup_Parms;
 
@@ -4868,10 +4349,9 @@ void UWebApplication::Cleanup ( )
 
 void UWebApplication::Init ( )
 {
-	static UFunction* pFnInit = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitRef { L"Function IpDrv.WebApplication.Init", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInit )
-		pFnInit = UObject::FindObject< UFunction > ( L"Function IpDrv.WebApplication.Init" );
+	UFunction* const pFnInit = pFnInitRef.Get ( );
 
 	UWebApplication_execInit_Parms Init_Parms;
 
@@ -4880,14 +4360,11 @@ void UWebApplication::Init ( )
 
 
 
-class UClass* AWebServer::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> AWebServer::pClassPointer { L"Class IpDrv.WebServer", &UObject::FindClass };
 
 class UClass* AWebServer::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.WebServer" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.WebServer.GetApplication
@@ -4899,10 +4376,9 @@ class UClass* AWebServer::StaticClass()
 
 class UWebApplication* AWebServer::GetApplication ( FString const& URI, FString* SubURI )
 {
-	static UFunction* pFnGetApplication = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetApplicationRef { L"Function IpDrv.WebServer.GetApplication", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetApplication )
-		pFnGetApplication = UObject::FindObject< UFunction > ( L"Function IpDrv.WebServer.GetApplication" );
+	UFunction* const pFnGetApplication = pFnGetApplicationRef.Get ( );
 
 	AWebServer_execGetApplication_Parms GetApplication_Parms;
 	memcpy ( &GetApplication_Parms.URI, &URI, 0x10 );
@@ -4925,10 +4401,9 @@ class UWebApplication* AWebServer::GetApplication ( FString const& URI, FString*
 
 void AWebServer::eventLostChild ( class AActor* C )
 {
-	static UFunction* pFnLostChild = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLostChildRef { L"Function IpDrv.WebServer.LostChild", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLostChild )
-		pFnLostChild = UObject::FindObject< UFunction > ( L"Function IpDrv.WebServer.LostChild" );
+	UFunction* const pFnLostChild = pFnLostChildRef.Get ( );
 
 	AWebServer_eventLostChild_Parms LostChild_Parms;
 	LostChild_Parms.C = C;
@@ -4943,10 +4418,9 @@ void AWebServer::eventLostChild ( class AActor* C )
 
 void AWebServer::eventGainedChild ( class AActor* C )
 {
-	static UFunction* pFnGainedChild = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGainedChildRef { L"Function IpDrv.WebServer.GainedChild", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGainedChild )
-		pFnGainedChild = UObject::FindObject< UFunction > ( L"Function IpDrv.WebServer.GainedChild" );
+	UFunction* const pFnGainedChild = pFnGainedChildRef.Get ( );
 
 	AWebServer_eventGainedChild_Parms GainedChild_Parms;
 	GainedChild_Parms.C = C;
@@ -4960,10 +4434,9 @@ void AWebServer::eventGainedChild ( class AActor* C )
 
 void AWebServer::eventDestroyed ( )
 {
-	static UFunction* pFnDestroyed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDestroyedRef { L"Function IpDrv.WebServer.Destroyed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDestroyed )
-		pFnDestroyed = UObject::FindObject< UFunction > ( L"Function IpDrv.WebServer.Destroyed" );
+	UFunction* const pFnDestroyed = pFnDestroyedRef.Get ( );
 
 	AWebServer_eventDestroyed_Parms Destroyed_Parms;
 
@@ -4976,10 +4449,9 @@ void AWebServer::eventDestroyed ( )
 
 void AWebServer::PostBeginPlay ( )
 {
-	static UFunction* pFnPostBeginPlay = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPostBeginPlayRef { L"Function IpDrv.WebServer.PostBeginPlay", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPostBeginPlay )
-		pFnPostBeginPlay = UObject::FindObject< UFunction > ( L"Function IpDrv.WebServer.PostBeginPlay" );
+	UFunction* const pFnPostBeginPlay = pFnPostBeginPlayRef.Get ( );
 
 	AWebServer_execPostBeginPlay_Parms PostBeginPlay_Parms;
 
@@ -4988,14 +4460,11 @@ void AWebServer::PostBeginPlay ( )
 
 
 
-class UClass* UHelloWeb::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UHelloWeb::pClassPointer { L"Class IpDrv.HelloWeb", &UObject::FindClass };
 
 class UClass* UHelloWeb::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.HelloWeb" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.HelloWeb.Query
@@ -5006,10 +4475,9 @@ class UClass* UHelloWeb::StaticClass()
 
 void UHelloWeb::eventQuery ( class UWebRequest* Request, class UWebResponse* Response )
 {
-	static UFunction* pFnQuery = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnQueryRef { L"Function IpDrv.HelloWeb.Query", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnQuery )
-		pFnQuery = UObject::FindObject< UFunction > ( L"Function IpDrv.HelloWeb.Query" );
+	UFunction* const pFnQuery = pFnQueryRef.Get ( );
 
 	UHelloWeb_eventQuery_Parms Query_Parms;
 	Query_Parms.Request = Request;
@@ -5024,10 +4492,9 @@ void UHelloWeb::eventQuery ( class UWebRequest* Request, class UWebResponse* Res
 
 void UHelloWeb::Init ( )
 {
-	static UFunction* pFnInit = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitRef { L"Function IpDrv.HelloWeb.Init", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInit )
-		pFnInit = UObject::FindObject< UFunction > ( L"Function IpDrv.HelloWeb.Init" );
+	UFunction* const pFnInit = pFnInitRef.Get ( );
 
 	UHelloWeb_execInit_Parms Init_Parms;
 
@@ -5036,14 +4503,11 @@ void UHelloWeb::Init ( )
 
 
 
-class UClass* UImageServer::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UImageServer::pClassPointer { L"Class IpDrv.ImageServer", &UObject::FindClass };
 
 class UClass* UImageServer::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.ImageServer" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.ImageServer.Query
@@ -5054,10 +4518,9 @@ class UClass* UImageServer::StaticClass()
 
 void UImageServer::eventQuery ( class UWebRequest* Request, class UWebResponse* Response )
 {
-	static UFunction* pFnQuery = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnQueryRef { L"Function IpDrv.ImageServer.Query", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnQuery )
-		pFnQuery = UObject::FindObject< UFunction > ( L"Function IpDrv.ImageServer.Query" );
+	UFunction* const pFnQuery = pFnQueryRef.Get ( );
 
 	UImageServer_eventQuery_Parms Query_Parms;
 	Query_Parms.Request = Request;
@@ -5068,14 +4531,11 @@ void UImageServer::eventQuery ( class UWebRequest* Request, class UWebResponse*
 
 
 
-class UClass* UIniLocPatcherMcp::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UIniLocPatcherMcp::pClassPointer { L"Class IpDrv.IniLocPatcherMcp", &UObject::FindClass };
 
 class UClass* UIniLocPatcherMcp::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.IniLocPatcherMcp" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.IniLocPatcherMcp.ClearCachedFiles
@@ -5084,10 +4544,9 @@ class UClass* UIniLocPatcherMcp::StaticClass()
 
 void UIniLocPatcherMcp::ClearCachedFiles ( )
 {
-	static UFunction* pFnClearCachedFiles = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearCachedFilesRef { L"Function IpDrv.IniLocPatcherMcp.ClearCachedFiles", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearCachedFiles )
-		pFnClearCachedFiles = UObject::FindObject< UFunction > ( L"Function IpDrv.IniLocPatcherMcp.ClearCachedFiles" );
+	UFunction* const pFnClearCachedFiles = pFnClearCachedFilesRef.Get ( );
 
 	UIniLocPatcherMcp_execClearCachedFiles_Parms ClearCachedFiles_Parms;
 
@@ -5101,10 +4560,9 @@ void UIniLocPatcherMcp::ClearCachedFiles ( )
 
 void UIniLocPatcherMcp::ClearReadFileDelegate ( struct FScriptDelegate ReadTitleFileCompleteDelegate )
 {
-	static UFunction* pFnClearReadFileDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearReadFileDelegateRef { L"Function IpDrv.IniLocPatcherMcp.ClearReadFileDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearReadFileDelegate )
-		pFnClearReadFileDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.IniLocPatcherMcp.ClearReadFileDelegate" );
+	UFunction* const pFnClearReadFileDelegate = pFnClearReadFileDelegateRef.Get ( );
 
 	UIniLocPatcherMcp_execClearReadFileDelegate_Parms ClearReadFileDelegate_Parms;
 	memcpy ( &ClearReadFileDelegate_Parms.ReadTitleFileCompleteDelegate, &ReadTitleFileCompleteDelegate, 0x10 );
@@ -5119,10 +4577,9 @@ void UIniLocPatcherMcp::ClearReadFileDelegate ( struct FScriptDelegate ReadTitle
 
 void UIniLocPatcherMcp::AddReadFileDelegate ( struct FScriptDelegate ReadTitleFileCompleteDelegate )
 {
-	static UFunction* pFnAddReadFileDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddReadFileDelegateRef { L"Function IpDrv.IniLocPatcherMcp.AddReadFileDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddReadFileDelegate )
-		pFnAddReadFileDelegate = UObject::FindObject< UFunction > ( L"Function IpDrv.IniLocPatcherMcp.AddReadFileDelegate" );
+	UFunction* const pFnAddReadFileDelegate = pFnAddReadFileDelegateRef.Get ( );
 
 	UIniLocPatcherMcp_execAddReadFileDelegate_Parms AddReadFileDelegate_Parms;
 	memcpy ( &AddReadFileDelegate_Parms.ReadTitleFileCompleteDelegate, &ReadTitleFileCompleteDelegate, 0x10 );
@@ -5138,10 +4595,9 @@ void UIniLocPatcherMcp::AddReadFileDelegate ( struct FScriptDelegate ReadTitleFi
 
 void UIniLocPatcherMcp::OnReadFileComplete ( unsigned long bWasSuccessful, FString const& Filename )
 {
-	static UFunction* pFnOnReadFileComplete = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReadFileCompleteRef { L"Function IpDrv.IniLocPatcherMcp.OnReadFileComplete", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReadFileComplete )
-		pFnOnReadFileComplete = UObject::FindObject< UFunction > ( L"Function IpDrv.IniLocPatcherMcp.OnReadFileComplete" );
+	UFunction* const pFnOnReadFileComplete = pFnOnReadFileCompleteRef.Get ( );
 
 	UIniLocPatcherMcp_execOnReadFileComplete_Parms OnReadFileComplete_Parms;
 	OnReadFileComplete_Parms.bWasSuccessful = bWasSuccessful;
@@ -5156,10 +4612,9 @@ void UIniLocPatcherMcp::OnReadFileComplete ( unsigned long bWasSuccessful, FStri
 
 void UIniLocPatcherMcp::DownloadFiles ( )
 {
-	static UFunction* pFnDownloadFiles = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDownloadFilesRef { L"Function IpDrv.IniLocPatcherMcp.DownloadFiles", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDownloadFiles )
-		pFnDownloadFiles = UObject::FindObject< UFunction > ( L"Function IpDrv.IniLocPatcherMcp.DownloadFiles" );
+	UFunction* const pFnDownloadFiles = pFnDownloadFilesRef.Get ( );
 
 	UIniLocPatcherMcp_execDownloadFiles_Parms DownloadFiles_Parms;
 
@@ -5172,10 +4627,9 @@ void UIniLocPatcherMcp::DownloadFiles ( )
 
 void UIniLocPatcherMcp::Init ( )
 {
-	static UFunction* pFnInit = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitRef { L"Function IpDrv.IniLocPatcherMcp.Init", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInit )
-		pFnInit = UObject::FindObject< UFunction > ( L"Function IpDrv.IniLocPatcherMcp.Init" );
+	UFunction* const pFnInit = pFnInitRef.Get ( );
 
 	UIniLocPatcherMcp_execInit_Parms Init_Parms;
 
@@ -5184,14 +4638,11 @@ void UIniLocPatcherMcp::Init ( )
 
 
 
-class UClass* AWebConnection::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> AWebConnection::pClassPointer { L"Class IpDrv.WebConnection", &UObject::FindClass };
 
 class UClass* AWebConnection::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class IpDrv.WebConnection" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function IpDrv.WebConnection.IsHanging
@@ -5201,10 +4652,9 @@ class UClass* AWebConnection::StaticClass()
 
 bool AWebConnection::IsHanging ( )
 {
-	static UFunction* pFnIsHanging = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsHangingRef { L"Function IpDrv.WebConnection.IsHanging", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsHanging )
-		pFnIsHanging = UObject::FindObject< UFunction > ( L"Function IpDrv.WebConnection.IsHanging" );
+	UFunction* const pFnIsHanging = pFnIsHangingRef.Get ( );
 
 	AWebConnection_execIsHanging_Parms IsHanging_Parms;
 
@@ -5219,10 +4669,9 @@ bool AWebConnection::IsHanging ( )
 
 void AWebConnection::Cleanup ( )
 {
-	static UFunction* pFnCleanup = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCleanupRef { L"Function IpDrv.WebConnection.Cleanup", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCleanup )
-		pFnCleanup = UObject::FindObject< UFunction > ( L"Function IpDrv.WebConnection.Cleanup" );
+	UFunction* const pFnCleanup = pFnCleanupRef.Get ( );
 
 	AWebConnection_execCleanup_Parms Cleanup_Parms;
 
@@ -5235,10 +4684,9 @@ void AWebConnection::Cleanup ( )
 
 void AWebConnection::CheckRawBytes ( )
 {
-	static UFunction* pFnCheckRawBytes = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCheckRawBytesRef { L"Function IpDrv.WebConnection.CheckRawBytes", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCheckRawBytes )
-		pFnCheckRawBytes = UObject::FindObject< UFunction > ( L"Function IpDrv.WebConnection.CheckRawBytes" );
+	UFunction* const pFnCheckRawBytes = pFnCheckRawBytesRef.Get ( );
 
 	AWebConnection_execCheckRawBytes_Parms CheckRawBytes_Parms;
 
@@ -5251,10 +4699,9 @@ void AWebConnection::CheckRawBytes ( )
 
 void AWebConnection::EndOfHeaders ( )
 {
-	static UFunction* pFnEndOfHeaders = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndOfHeadersRef { L"Function IpDrv.WebConnection.EndOfHeaders", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndOfHeaders )
-		pFnEndOfHeaders = UObject::FindObject< UFunction > ( L"Function IpDrv.WebConnection.EndOfHeaders" );
+	UFunction* const pFnEndOfHeaders = pFnEndOfHeadersRef.Get ( );
 
 	AWebConnection_execEndOfHeaders_Parms EndOfHeaders_Parms;
 
@@ -5267,10 +4714,9 @@ void AWebConnection::EndOfHeaders ( )
 
 void AWebConnection::CreateResponseObject ( )
 {
-	static UFunction* pFnCreateResponseObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCreateResponseObjectRef { L"Function IpDrv.WebConnection.CreateResponseObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCreateResponseObject )
-		pFnCreateResponseObject = UObject::FindObject< UFunction > ( L"Function IpDrv.WebConnection.CreateResponseObject" );
+	UFunction* const pFnCreateResponseObject = pFnCreateResponseObjectRef.Get ( );
 
 	AWebConnection_execCreateResponseObject_Parms CreateResponseObject_Parms;
 
@@ -5284,10 +4730,9 @@ void AWebConnection::CreateResponseObject ( )
 
 void AWebConnection::ProcessPost ( FString const& S )
 {
-	static UFunction* pFnProcessPost = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnProcessPostRef { L"Function IpDrv.WebConnection.ProcessPost", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnProcessPost )
-		pFnProcessPost = UObject::FindObject< UFunction > ( L"Function IpDrv.WebConnection.ProcessPost" );
+	UFunction* const pFnProcessPost = pFnProcessPostRef.Get ( );
 
 	AWebConnection_execProcessPost_Parms ProcessPost_Parms;
 	memcpy ( &ProcessPost_Parms.S, &S, 0x10 );
@@ -5302,10 +4747,9 @@ void AWebConnection::ProcessPost ( FString const& S )
 
 void AWebConnection::ProcessGet ( FString const& S )
 {
-	static UFunction* pFnProcessGet = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnProcessGetRef { L"Function IpDrv.WebConnection.ProcessGet", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnProcessGet )
-		pFnProcessGet = UObject::FindObject< UFunction > ( L"Function IpDrv.WebConnection.ProcessGet" );
+	UFunction* const pFnProcessGet = pFnProcessGetRef.Get ( );
 
 	AWebConnection_execProcessGet_Parms ProcessGet_Parms;
 	memcpy ( &ProcessGet_Parms.S, &S, 0x10 );
@@ -5320,10 +4764,9 @@ void AWebConnection::ProcessGet ( FString const& S )
 
 void AWebConnection::ProcessHead ( FString const& S )
 {
-	static UFunction* pFnProcessHead = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnProcessHeadRef { L"Function IpDrv.WebConnection.ProcessHead", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnProcessHead )
-		pFnProcessHead = UObject::FindObject< UFunction > ( L"Function IpDrv.WebConnection.ProcessHead" );
+	UFunction* const pFnProcessHead = pFnProcessHeadRef.Get ( );
 
 	AWebConnection_execProcessHead_Parms ProcessHead_Parms;
 	memcpy ( &ProcessHead_Parms.S, &S, 0x10 );
@@ -5338,10 +4781,9 @@ void AWebConnection::ProcessHead ( FString const& S )
 
 void AWebConnection::ReceivedLine ( FString const& S )
 {
-	static UFunction* pFnReceivedLine = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReceivedLineRef { L"Function IpDrv.WebConnection.ReceivedLine", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReceivedLine )
-		pFnReceivedLine = UObject::FindObject< UFunction > ( L"Function IpDrv.WebConnection.ReceivedLine" );
+	UFunction* const pFnReceivedLine = pFnReceivedLineRef.Get ( );
 
 	AWebConnection_execReceivedLine_Parms ReceivedLine_Parms;
 	memcpy ( &ReceivedLine_Parms.S, &S, 0x10 );
@@ -5356,10 +4798,9 @@ void AWebConnection::ReceivedLine ( FString const& S )
 
 void AWebConnection::eventReceivedText ( FString const& Text )
 {
-	static UFunction* pFnReceivedText = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReceivedTextRef { L"Function IpDrv.WebConnection.ReceivedText", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReceivedText )
-		pFnReceivedText = UObject::FindObject< UFunction > ( L"Function IpDrv.WebConnection.ReceivedText" );
+	UFunction* const pFnReceivedText = pFnReceivedTextRef.Get ( );
 
 	AWebConnection_eventReceivedText_Parms ReceivedText_Parms;
 	memcpy ( &ReceivedText_Parms.Text, &Text, 0x10 );
@@ -5373,10 +4814,9 @@ void AWebConnection::eventReceivedText ( FString const& Text )
 
 void AWebConnection::eventTimer ( )
 {
-	static UFunction* pFnTimer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTimerRef { L"Function IpDrv.WebConnection.Timer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTimer )
-		pFnTimer = UObject::FindObject< UFunction > ( L"Function IpDrv.WebConnection.Timer" );
+	UFunction* const pFnTimer = pFnTimerRef.Get ( );
 
 	AWebConnection_eventTimer_Parms Timer_Parms;
 
@@ -5389,10 +4829,9 @@ void AWebConnection::eventTimer ( )
 
 void AWebConnection::eventClosed ( )
 {
-	static UFunction* pFnClosed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClosedRef { L"Function IpDrv.WebConnection.Closed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClosed )
-		pFnClosed = UObject::FindObject< UFunction > ( L"Function IpDrv.WebConnection.Closed" );
+	UFunction* const pFnClosed = pFnClosedRef.Get ( );
 
 	AWebConnection_eventClosed_Parms Closed_Parms;
 
@@ -5405,10 +4844,9 @@ void AWebConnection::eventClosed ( )
 
 void AWebConnection::eventAccepted ( )
 {
-	static UFunction* pFnAccepted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAcceptedRef { L"Function IpDrv.WebConnection.Accepted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAccepted )
-		pFnAccepted = UObject::FindObject< UFunction > ( L"Function IpDrv.WebConnection.Accepted" );
+	UFunction* const pFnAccepted = pFnAcceptedRef.Get ( );
 
 	AWebConnection_eventAccepted_Parms Accepted_Parms;
 
@@ -5417,6 +4855,278 @@ void AWebConnection::eventAccepted ( )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class IpDrv.ClientBeaconAddressResolver",
+	L"Class IpDrv.HTTPDownload",
+	L"Class IpDrv.InternetLink",
+	L"Function IpDrv.InternetLink.ResolveFailed",
+	L"Function IpDrv.InternetLink.Resolved",
+	L"Function IpDrv.InternetLink.GetLocalIP",
+	L"Function IpDrv.InternetLink.StringToIpAddr",
+	L"Function IpDrv.InternetLink.IpAddrToString",
+	L"Function IpDrv.InternetLink.GetLastError",
+	L"Function IpDrv.InternetLink.Resolve",
+	L"Function IpDrv.InternetLink.ParseURL",
+	L"Function IpDrv.InternetLink.IsDataPending",
+	L"Class IpDrv.TcpLink",
+	L"Function IpDrv.TcpLink.ReceivedBinary",
+	L"Function IpDrv.TcpLink.ReceivedLine",
+	L"Function IpDrv.TcpLink.ReceivedText",
+	L"Function IpDrv.TcpLink.Closed",
+	L"Function IpDrv.TcpLink.Opened",
+	L"Function IpDrv.TcpLink.Accepted",
+	L"Function IpDrv.TcpLink.ReadBinary",
+	L"Function IpDrv.TcpLink.ReadText",
+	L"Function IpDrv.TcpLink.SendBinary",
+	L"Function IpDrv.TcpLink.SendText",
+	L"Function IpDrv.TcpLink.IsConnected",
+	L"Function IpDrv.TcpLink.Close",
+	L"Function IpDrv.TcpLink.Open",
+	L"Function IpDrv.TcpLink.Listen",
+	L"Function IpDrv.TcpLink.BindPort",
+	L"Class IpDrv.MCPBase",
+	L"Class IpDrv.OnlineEventsInterfaceMcp",
+	L"Function IpDrv.OnlineEventsInterfaceMcp.UploadHardwareData",
+	L"Function IpDrv.OnlineEventsInterfaceMcp.UploadGameplayEventsData",
+	L"Function IpDrv.OnlineEventsInterfaceMcp.UploadProfileData",
+	L"Class IpDrv.OnlineNewsInterfaceMcp",
+	L"Function IpDrv.OnlineNewsInterfaceMcp.GetNews",
+	L"Function IpDrv.OnlineNewsInterfaceMcp.ClearReadNewsCompletedDelegate",
+	L"Function IpDrv.OnlineNewsInterfaceMcp.AddReadNewsCompletedDelegate",
+	L"Function IpDrv.OnlineNewsInterfaceMcp.OnReadNewsCompleted",
+	L"Function IpDrv.OnlineNewsInterfaceMcp.ReadNews",
+	L"Class IpDrv.OnlineTitleFileDownloadMcp",
+	L"Function IpDrv.OnlineTitleFileDownloadMcp.ClearDownloadedFiles",
+	L"Function IpDrv.OnlineTitleFileDownloadMcp.GetTitleFileState",
+	L"Function IpDrv.OnlineTitleFileDownloadMcp.GetTitleFileContents",
+	L"Function IpDrv.OnlineTitleFileDownloadMcp.ClearReadTitleFileCompleteDelegate",
+	L"Function IpDrv.OnlineTitleFileDownloadMcp.AddReadTitleFileCompleteDelegate",
+	L"Function IpDrv.OnlineTitleFileDownloadMcp.ReadTitleFile",
+	L"Function IpDrv.OnlineTitleFileDownloadMcp.OnReadTitleFileComplete",
+	L"Class IpDrv.MeshBeacon",
+	L"Function IpDrv.MeshBeacon.DestroyBeacon",
+	L"Class IpDrv.MeshBeaconClient",
+	L"Function IpDrv.MeshBeaconClient.DebugRender",
+	L"Function IpDrv.MeshBeaconClient.DumpInfo",
+	L"Function IpDrv.MeshBeaconClient.SendHostNewGameSessionResponse",
+	L"Function IpDrv.MeshBeaconClient.OnCreateNewSessionRequestReceived",
+	L"Function IpDrv.MeshBeaconClient.OnTravelRequestReceived",
+	L"Function IpDrv.MeshBeaconClient.OnReceivedBandwidthTestResults",
+	L"Function IpDrv.MeshBeaconClient.OnReceivedBandwidthTestRequest",
+	L"Function IpDrv.MeshBeaconClient.OnConnectionRequestResult",
+	L"Function IpDrv.MeshBeaconClient.BeginBandwidthTest",
+	L"Function IpDrv.MeshBeaconClient.RequestConnection",
+	L"Function IpDrv.MeshBeaconClient.DestroyBeacon",
+	L"Class IpDrv.MeshBeaconHost",
+	L"Function IpDrv.MeshBeaconHost.DebugRender",
+	L"Function IpDrv.MeshBeaconHost.DumpConnections",
+	L"Function IpDrv.MeshBeaconHost.OnReceivedClientCreateNewSessionResult",
+	L"Function IpDrv.MeshBeaconHost.RequestClientCreateNewSession",
+	L"Function IpDrv.MeshBeaconHost.TellClientsToTravel",
+	L"Function IpDrv.MeshBeaconHost.OnAllPendingPlayersConnected",
+	L"Function IpDrv.MeshBeaconHost.AllPlayersConnected",
+	L"Function IpDrv.MeshBeaconHost.GetConnectionIndexForPlayer",
+	L"Function IpDrv.MeshBeaconHost.SetPendingPlayerConnections",
+	L"Function IpDrv.MeshBeaconHost.OnFinishedBandwidthTest",
+	L"Function IpDrv.MeshBeaconHost.OnStartedBandwidthTest",
+	L"Function IpDrv.MeshBeaconHost.OnReceivedClientConnectionRequest",
+	L"Function IpDrv.MeshBeaconHost.AllowBandwidthTesting",
+	L"Function IpDrv.MeshBeaconHost.CancelPendingBandwidthTests",
+	L"Function IpDrv.MeshBeaconHost.HasPendingBandwidthTest",
+	L"Function IpDrv.MeshBeaconHost.CancelInProgressBandwidthTests",
+	L"Function IpDrv.MeshBeaconHost.HasInProgressBandwidthTest",
+	L"Function IpDrv.MeshBeaconHost.RequestClientBandwidthTest",
+	L"Function IpDrv.MeshBeaconHost.DestroyBeacon",
+	L"Function IpDrv.MeshBeaconHost.InitHostBeacon",
+	L"Class IpDrv.OnlineSubsystemCommonImpl",
+	L"Function IpDrv.OnlineSubsystemCommonImpl.GetRegisteredPlayers",
+	L"Function IpDrv.OnlineSubsystemCommonImpl.IsPlayerInSession",
+	L"Function IpDrv.OnlineSubsystemCommonImpl.GetPlayerUniqueNetIdFromIndex",
+	L"Function IpDrv.OnlineSubsystemCommonImpl.GetPlayerNicknameFromIndex",
+	L"Class IpDrv.OnlineGameInterfaceImpl",
+	L"Function IpDrv.OnlineGameInterfaceImpl.BindPlatformSpecificSessionToSearch",
+	L"Function IpDrv.OnlineGameInterfaceImpl.ReadPlatformSpecificSessionInfoBySessionName",
+	L"Function IpDrv.OnlineGameInterfaceImpl.ReadPlatformSpecificSessionInfo",
+	L"Function IpDrv.OnlineGameInterfaceImpl.QueryNonAdvertisedData",
+	L"Function IpDrv.OnlineGameInterfaceImpl.RecalculateSkillRating",
+	L"Function IpDrv.OnlineGameInterfaceImpl.AcceptGameInvite",
+	L"Function IpDrv.OnlineGameInterfaceImpl.ClearGameInviteAcceptedDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.AddGameInviteAcceptedDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.OnGameInviteAccepted",
+	L"Function IpDrv.OnlineGameInterfaceImpl.GetArbitratedPlayers",
+	L"Function IpDrv.OnlineGameInterfaceImpl.ClearArbitrationRegistrationCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.AddArbitrationRegistrationCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.OnArbitrationRegistrationComplete",
+	L"Function IpDrv.OnlineGameInterfaceImpl.RegisterForArbitration",
+	L"Function IpDrv.OnlineGameInterfaceImpl.ClearEndOnlineGameCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.AddEndOnlineGameCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.OnEndOnlineGameComplete",
+	L"Function IpDrv.OnlineGameInterfaceImpl.EndOnlineGame",
+	L"Function IpDrv.OnlineGameInterfaceImpl.ClearStartOnlineGameCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.AddStartOnlineGameCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.OnStartOnlineGameComplete",
+	L"Function IpDrv.OnlineGameInterfaceImpl.StartOnlineGame",
+	L"Function IpDrv.OnlineGameInterfaceImpl.ClearUnregisterPlayerCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.AddUnregisterPlayerCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.OnUnregisterPlayerComplete",
+	L"Function IpDrv.OnlineGameInterfaceImpl.UnregisterPlayer",
+	L"Function IpDrv.OnlineGameInterfaceImpl.ClearRegisterPlayerCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.AddRegisterPlayerCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.OnRegisterPlayerComplete",
+	L"Function IpDrv.OnlineGameInterfaceImpl.RegisterPlayer",
+	L"Function IpDrv.OnlineGameInterfaceImpl.GetResolvedConnectString",
+	L"Function IpDrv.OnlineGameInterfaceImpl.ClearJoinOnlineGameCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.AddJoinOnlineGameCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.OnJoinOnlineGameComplete",
+	L"Function IpDrv.OnlineGameInterfaceImpl.JoinOnlineGame",
+	L"Function IpDrv.OnlineGameInterfaceImpl.FreeSearchResults",
+	L"Function IpDrv.OnlineGameInterfaceImpl.ClearCancelFindOnlineGamesCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.AddCancelFindOnlineGamesCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.OnCancelFindOnlineGamesComplete",
+	L"Function IpDrv.OnlineGameInterfaceImpl.CancelFindOnlineGames",
+	L"Function IpDrv.OnlineGameInterfaceImpl.ClearFindOnlineGamesCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.AddFindOnlineGamesCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.FindOnlineGames",
+	L"Function IpDrv.OnlineGameInterfaceImpl.ClearDestroyOnlineGameCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.AddDestroyOnlineGameCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.OnDestroyOnlineGameComplete",
+	L"Function IpDrv.OnlineGameInterfaceImpl.DestroyOnlineGame",
+	L"Function IpDrv.OnlineGameInterfaceImpl.ClearUpdateOnlineGameCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.AddUpdateOnlineGameCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.OnUpdateOnlineGameComplete",
+	L"Function IpDrv.OnlineGameInterfaceImpl.UpdateOnlineGame",
+	L"Function IpDrv.OnlineGameInterfaceImpl.ClearCreateOnlineGameCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.AddCreateOnlineGameCompleteDelegate",
+	L"Function IpDrv.OnlineGameInterfaceImpl.OnCreateOnlineGameComplete",
+	L"Function IpDrv.OnlineGameInterfaceImpl.CreateOnlineGame",
+	L"Function IpDrv.OnlineGameInterfaceImpl.GetGameSearch",
+	L"Function IpDrv.OnlineGameInterfaceImpl.GetGameSettings",
+	L"Function IpDrv.OnlineGameInterfaceImpl.OnFindOnlineGamesComplete",
+	L"Class IpDrv.PartyBeacon",
+	L"Function IpDrv.PartyBeacon.OnDestroyComplete",
+	L"Function IpDrv.PartyBeacon.DestroyBeacon",
+	L"Class IpDrv.PartyBeaconClient",
+	L"Function IpDrv.PartyBeaconClient.DestroyBeacon",
+	L"Function IpDrv.PartyBeaconClient.CancelReservation",
+	L"Function IpDrv.PartyBeaconClient.RequestReservationUpdate",
+	L"Function IpDrv.PartyBeaconClient.RequestReservation",
+	L"Function IpDrv.PartyBeaconClient.OnHostHasCancelled",
+	L"Function IpDrv.PartyBeaconClient.OnHostIsReady",
+	L"Function IpDrv.PartyBeaconClient.OnTravelRequestReceived",
+	L"Function IpDrv.PartyBeaconClient.OnReservationCountUpdated",
+	L"Function IpDrv.PartyBeaconClient.OnReservationRequestComplete",
+	L"Class IpDrv.PartyBeaconHost",
+	L"Function IpDrv.PartyBeaconHost.DumpReservations",
+	L"Function IpDrv.PartyBeaconHost.GetMaxAvailableTeamSize",
+	L"Function IpDrv.PartyBeaconHost.GetPartyLeaders",
+	L"Function IpDrv.PartyBeaconHost.GetPlayers",
+	L"Function IpDrv.PartyBeaconHost.AppendReservationSkillsToSearch",
+	L"Function IpDrv.PartyBeaconHost.UnregisterParty",
+	L"Function IpDrv.PartyBeaconHost.UnregisterPartyMembers",
+	L"Function IpDrv.PartyBeaconHost.RegisterPartyMembers",
+	L"Function IpDrv.PartyBeaconHost.AreReservationsFull",
+	L"Function IpDrv.PartyBeaconHost.TellClientsHostHasCancelled",
+	L"Function IpDrv.PartyBeaconHost.TellClientsHostIsReady",
+	L"Function IpDrv.PartyBeaconHost.TellClientsToTravel",
+	L"Function IpDrv.PartyBeaconHost.DestroyBeacon",
+	L"Function IpDrv.PartyBeaconHost.OnClientCancellationReceived",
+	L"Function IpDrv.PartyBeaconHost.OnReservationsFull",
+	L"Function IpDrv.PartyBeaconHost.OnReservationChange",
+	L"Function IpDrv.PartyBeaconHost.HandlePlayerLogout",
+	L"Function IpDrv.PartyBeaconHost.UpdatePartyReservationEntry",
+	L"Function IpDrv.PartyBeaconHost.AddPartyReservationEntry",
+	L"Function IpDrv.PartyBeaconHost.InitHostBeacon",
+	L"Class IpDrv.TcpipConnection",
+	L"Class IpDrv.TcpNetDriver",
+	L"Class IpDrv.WebRequest",
+	L"Function IpDrv.WebRequest.GetHexDigit",
+	L"Function IpDrv.WebRequest.DecodeFormData",
+	L"Function IpDrv.WebRequest.ProcessHeaderString",
+	L"Function IpDrv.WebRequest.Dump",
+	L"Function IpDrv.WebRequest.GetVariables",
+	L"Function IpDrv.WebRequest.GetVariableNumber",
+	L"Function IpDrv.WebRequest.GetVariableCount",
+	L"Function IpDrv.WebRequest.GetVariable",
+	L"Function IpDrv.WebRequest.AddVariable",
+	L"Function IpDrv.WebRequest.GetHeaders",
+	L"Function IpDrv.WebRequest.GetHeader",
+	L"Function IpDrv.WebRequest.AddHeader",
+	L"Function IpDrv.WebRequest.EncodeBase64",
+	L"Function IpDrv.WebRequest.DecodeBase64",
+	L"Class IpDrv.WebResponse",
+	L"Function IpDrv.WebResponse.SentResponse",
+	L"Function IpDrv.WebResponse.SentText",
+	L"Function IpDrv.WebResponse.Redirect",
+	L"Function IpDrv.WebResponse.SendStandardHeaders",
+	L"Function IpDrv.WebResponse.HTTPError",
+	L"Function IpDrv.WebResponse.SendHeaders",
+	L"Function IpDrv.WebResponse.AddHeader",
+	L"Function IpDrv.WebResponse.HTTPHeader",
+	L"Function IpDrv.WebResponse.HTTPResponse",
+	L"Function IpDrv.WebResponse.FailAuthentication",
+	L"Function IpDrv.WebResponse.SendCachedFile",
+	L"Function IpDrv.WebResponse.SendBinary",
+	L"Function IpDrv.WebResponse.SendText",
+	L"Function IpDrv.WebResponse.Dump",
+	L"Function IpDrv.WebResponse.GetHTTPExpiration",
+	L"Function IpDrv.WebResponse.LoadParsedUHTM",
+	L"Function IpDrv.WebResponse.IncludeBinaryFile",
+	L"Function IpDrv.WebResponse.IncludeUHTM",
+	L"Function IpDrv.WebResponse.ClearSubst",
+	L"Function IpDrv.WebResponse.Subst",
+	L"Function IpDrv.WebResponse.FileExists",
+	L"Class IpDrv.WebApplication",
+	L"Function IpDrv.WebApplication.PostQuery",
+	L"Function IpDrv.WebApplication.Query",
+	L"Function IpDrv.WebApplication.PreQuery",
+	L"Function IpDrv.WebApplication.CleanupApp",
+	L"Function IpDrv.WebApplication.Cleanup",
+	L"Function IpDrv.WebApplication.Init",
+	L"Class IpDrv.WebServer",
+	L"Function IpDrv.WebServer.GetApplication",
+	L"Function IpDrv.WebServer.LostChild",
+	L"Function IpDrv.WebServer.GainedChild",
+	L"Function IpDrv.WebServer.Destroyed",
+	L"Function IpDrv.WebServer.PostBeginPlay",
+	L"Class IpDrv.HelloWeb",
+	L"Function IpDrv.HelloWeb.Query",
+	L"Function IpDrv.HelloWeb.Init",
+	L"Class IpDrv.ImageServer",
+	L"Function IpDrv.ImageServer.Query",
+	L"Class IpDrv.IniLocPatcherMcp",
+	L"Function IpDrv.IniLocPatcherMcp.ClearCachedFiles",
+	L"Function IpDrv.IniLocPatcherMcp.ClearReadFileDelegate",
+	L"Function IpDrv.IniLocPatcherMcp.AddReadFileDelegate",
+	L"Function IpDrv.IniLocPatcherMcp.OnReadFileComplete",
+	L"Function IpDrv.IniLocPatcherMcp.DownloadFiles",
+	L"Function IpDrv.IniLocPatcherMcp.Init",
+	L"Class IpDrv.WebConnection",
+	L"Function IpDrv.WebConnection.IsHanging",
+	L"Function IpDrv.WebConnection.Cleanup",
+	L"Function IpDrv.WebConnection.CheckRawBytes",
+	L"Function IpDrv.WebConnection.EndOfHeaders",
+	L"Function IpDrv.WebConnection.CreateResponseObject",
+	L"Function IpDrv.WebConnection.ProcessPost",
+	L"Function IpDrv.WebConnection.ProcessGet",
+	L"Function IpDrv.WebConnection.ProcessHead",
+	L"Function IpDrv.WebConnection.ReceivedLine",
+	L"Function IpDrv.WebConnection.ReceivedText",
+	L"Function IpDrv.WebConnection.Timer",
+	L"Function IpDrv.WebConnection.Closed",
+	L"Function IpDrv.WebConnection.Accepted",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
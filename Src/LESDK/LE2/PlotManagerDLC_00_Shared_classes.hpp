@@ -47,7 +47,7 @@ class UBioAutoConditionals : public UBioConditionals
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioAutoConditionals::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioAutoConditionals::pClassPointer { L"Class PlotManagerDLC_00_Shared.BioAutoConditionals", &UObject::FindClass };
 
 class UClass* UBioAutoConditionals::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class PlotManagerDLC_00_Shared.BioAutoConditionals" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1863
@@ -47,10 +44,9 @@ class UClass* UBioAutoConditionals::StaticClass()
 
 bool UBioAutoConditionals::F1863 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1863 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1863Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1863", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1863 )
-		pFnF1863 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1863" );
+	UFunction* const pFnF1863 = pFnF1863Ref.Get ( );
 
 	UBioAutoConditionals_execF1863_Parms F1863_Parms;
 	F1863_Parms.bioWorld = bioWorld;
@@ -70,10 +66,9 @@ bool UBioAutoConditionals::F1863 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1862 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1862 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1862Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1862", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1862 )
-		pFnF1862 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1862" );
+	UFunction* const pFnF1862 = pFnF1862Ref.Get ( );
 
 	UBioAutoConditionals_execF1862_Parms F1862_Parms;
 	F1862_Parms.bioWorld = bioWorld;
@@ -93,10 +88,9 @@ bool UBioAutoConditionals::F1862 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1861 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1861 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1861Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1861", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1861 )
-		pFnF1861 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1861" );
+	UFunction* const pFnF1861 = pFnF1861Ref.Get ( );
 
 	UBioAutoConditionals_execF1861_Parms F1861_Parms;
 	F1861_Parms.bioWorld = bioWorld;
@@ -116,10 +110,9 @@ bool UBioAutoConditionals::F1861 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1860 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1860 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1860Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1860", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1860 )
-		pFnF1860 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1860" );
+	UFunction* const pFnF1860 = pFnF1860Ref.Get ( );
 
 	UBioAutoConditionals_execF1860_Parms F1860_Parms;
 	F1860_Parms.bioWorld = bioWorld;
@@ -139,10 +132,9 @@ bool UBioAutoConditionals::F1860 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1859 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1859 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1859Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1859", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1859 )
-		pFnF1859 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1859" );
+	UFunction* const pFnF1859 = pFnF1859Ref.Get ( );
 
 	UBioAutoConditionals_execF1859_Parms F1859_Parms;
 	F1859_Parms.bioWorld = bioWorld;
@@ -162,10 +154,9 @@ bool UBioAutoConditionals::F1859 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1858 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1858 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1858Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1858", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1858 )
-		pFnF1858 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1858" );
+	UFunction* const pFnF1858 = pFnF1858Ref.Get ( );
 
 	UBioAutoConditionals_execF1858_Parms F1858_Parms;
 	F1858_Parms.bioWorld = bioWorld;
@@ -185,10 +176,9 @@ bool UBioAutoConditionals::F1858 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1881 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1881 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1881Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1881", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1881 )
-		pFnF1881 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1881" );
+	UFunction* const pFnF1881 = pFnF1881Ref.Get ( );
 
 	UBioAutoConditionals_execF1881_Parms F1881_Parms;
 	F1881_Parms.bioWorld = bioWorld;
@@ -208,10 +198,9 @@ bool UBioAutoConditionals::F1881 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1880 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1880 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1880Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1880", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1880 )
-		pFnF1880 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1880" );
+	UFunction* const pFnF1880 = pFnF1880Ref.Get ( );
 
 	UBioAutoConditionals_execF1880_Parms F1880_Parms;
 	F1880_Parms.bioWorld = bioWorld;
@@ -231,10 +220,9 @@ bool UBioAutoConditionals::F1880 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1972 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1972 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1972Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1972", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1972 )
-		pFnF1972 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1972" );
+	UFunction* const pFnF1972 = pFnF1972Ref.Get ( );
 
 	UBioAutoConditionals_execF1972_Parms F1972_Parms;
 	F1972_Parms.bioWorld = bioWorld;
@@ -254,10 +242,9 @@ bool UBioAutoConditionals::F1972 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1971 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1971 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1971Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1971", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1971 )
-		pFnF1971 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1971" );
+	UFunction* const pFnF1971 = pFnF1971Ref.Get ( );
 
 	UBioAutoConditionals_execF1971_Parms F1971_Parms;
 	F1971_Parms.bioWorld = bioWorld;
@@ -277,10 +264,9 @@ bool UBioAutoConditionals::F1971 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1970 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1970 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1970Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1970", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1970 )
-		pFnF1970 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1970" );
+	UFunction* const pFnF1970 = pFnF1970Ref.Get ( );
 
 	UBioAutoConditionals_execF1970_Parms F1970_Parms;
 	F1970_Parms.bioWorld = bioWorld;
@@ -300,10 +286,9 @@ bool UBioAutoConditionals::F1970 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1840 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1840 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1840Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1840", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1840 )
-		pFnF1840 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1840" );
+	UFunction* const pFnF1840 = pFnF1840Ref.Get ( );
 
 	UBioAutoConditionals_execF1840_Parms F1840_Parms;
 	F1840_Parms.bioWorld = bioWorld;
@@ -323,10 +308,9 @@ bool UBioAutoConditionals::F1840 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1839 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1839 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1839Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1839", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1839 )
-		pFnF1839 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1839" );
+	UFunction* const pFnF1839 = pFnF1839Ref.Get ( );
 
 	UBioAutoConditionals_execF1839_Parms F1839_Parms;
 	F1839_Parms.bioWorld = bioWorld;
@@ -346,10 +330,9 @@ bool UBioAutoConditionals::F1839 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1762 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1762 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1762Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1762", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1762 )
-		pFnF1762 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1762" );
+	UFunction* const pFnF1762 = pFnF1762Ref.Get ( );
 
 	UBioAutoConditionals_execF1762_Parms F1762_Parms;
 	F1762_Parms.bioWorld = bioWorld;
@@ -369,10 +352,9 @@ bool UBioAutoConditionals::F1762 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1760 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1760 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1760Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1760", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1760 )
-		pFnF1760 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1760" );
+	UFunction* const pFnF1760 = pFnF1760Ref.Get ( );
 
 	UBioAutoConditionals_execF1760_Parms F1760_Parms;
 	F1760_Parms.bioWorld = bioWorld;
@@ -392,10 +374,9 @@ bool UBioAutoConditionals::F1760 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1759 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1759 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1759Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1759", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1759 )
-		pFnF1759 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1759" );
+	UFunction* const pFnF1759 = pFnF1759Ref.Get ( );
 
 	UBioAutoConditionals_execF1759_Parms F1759_Parms;
 	F1759_Parms.bioWorld = bioWorld;
@@ -415,10 +396,9 @@ bool UBioAutoConditionals::F1759 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1758 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1758 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1758Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1758", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1758 )
-		pFnF1758 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1758" );
+	UFunction* const pFnF1758 = pFnF1758Ref.Get ( );
 
 	UBioAutoConditionals_execF1758_Parms F1758_Parms;
 	F1758_Parms.bioWorld = bioWorld;
@@ -438,10 +418,9 @@ bool UBioAutoConditionals::F1758 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1757 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1757 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1757Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1757", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1757 )
-		pFnF1757 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1757" );
+	UFunction* const pFnF1757 = pFnF1757Ref.Get ( );
 
 	UBioAutoConditionals_execF1757_Parms F1757_Parms;
 	F1757_Parms.bioWorld = bioWorld;
@@ -461,10 +440,9 @@ bool UBioAutoConditionals::F1757 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1722 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1722 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1722Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1722", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1722 )
-		pFnF1722 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1722" );
+	UFunction* const pFnF1722 = pFnF1722Ref.Get ( );
 
 	UBioAutoConditionals_execF1722_Parms F1722_Parms;
 	F1722_Parms.bioWorld = bioWorld;
@@ -484,10 +462,9 @@ bool UBioAutoConditionals::F1722 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1721 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1721 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1721Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1721", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1721 )
-		pFnF1721 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1721" );
+	UFunction* const pFnF1721 = pFnF1721Ref.Get ( );
 
 	UBioAutoConditionals_execF1721_Parms F1721_Parms;
 	F1721_Parms.bioWorld = bioWorld;
@@ -507,10 +484,9 @@ bool UBioAutoConditionals::F1721 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1720 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1720 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1720Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1720", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1720 )
-		pFnF1720 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1720" );
+	UFunction* const pFnF1720 = pFnF1720Ref.Get ( );
 
 	UBioAutoConditionals_execF1720_Parms F1720_Parms;
 	F1720_Parms.bioWorld = bioWorld;
@@ -530,10 +506,9 @@ bool UBioAutoConditionals::F1720 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1719 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1719 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1719Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1719", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1719 )
-		pFnF1719 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1719" );
+	UFunction* const pFnF1719 = pFnF1719Ref.Get ( );
 
 	UBioAutoConditionals_execF1719_Parms F1719_Parms;
 	F1719_Parms.bioWorld = bioWorld;
@@ -553,10 +528,9 @@ bool UBioAutoConditionals::F1719 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1718 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1718 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1718Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1718", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1718 )
-		pFnF1718 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1718" );
+	UFunction* const pFnF1718 = pFnF1718Ref.Get ( );
 
 	UBioAutoConditionals_execF1718_Parms F1718_Parms;
 	F1718_Parms.bioWorld = bioWorld;
@@ -576,10 +550,9 @@ bool UBioAutoConditionals::F1718 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1717 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1717 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1717Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1717", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1717 )
-		pFnF1717 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1717" );
+	UFunction* const pFnF1717 = pFnF1717Ref.Get ( );
 
 	UBioAutoConditionals_execF1717_Parms F1717_Parms;
 	F1717_Parms.bioWorld = bioWorld;
@@ -599,10 +572,9 @@ bool UBioAutoConditionals::F1717 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1716 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1716 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1716Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1716", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1716 )
-		pFnF1716 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1716" );
+	UFunction* const pFnF1716 = pFnF1716Ref.Get ( );
 
 	UBioAutoConditionals_execF1716_Parms F1716_Parms;
 	F1716_Parms.bioWorld = bioWorld;
@@ -622,10 +594,9 @@ bool UBioAutoConditionals::F1716 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1715 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1715 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1715Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1715", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1715 )
-		pFnF1715 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1715" );
+	UFunction* const pFnF1715 = pFnF1715Ref.Get ( );
 
 	UBioAutoConditionals_execF1715_Parms F1715_Parms;
 	F1715_Parms.bioWorld = bioWorld;
@@ -645,10 +616,9 @@ bool UBioAutoConditionals::F1715 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1714 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1714 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1714Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1714", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1714 )
-		pFnF1714 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1714" );
+	UFunction* const pFnF1714 = pFnF1714Ref.Get ( );
 
 	UBioAutoConditionals_execF1714_Parms F1714_Parms;
 	F1714_Parms.bioWorld = bioWorld;
@@ -668,10 +638,9 @@ bool UBioAutoConditionals::F1714 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1713 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1713 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1713Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1713", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1713 )
-		pFnF1713 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1713" );
+	UFunction* const pFnF1713 = pFnF1713Ref.Get ( );
 
 	UBioAutoConditionals_execF1713_Parms F1713_Parms;
 	F1713_Parms.bioWorld = bioWorld;
@@ -691,10 +660,9 @@ bool UBioAutoConditionals::F1713 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2029 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2029 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2029Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F2029", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2029 )
-		pFnF2029 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F2029" );
+	UFunction* const pFnF2029 = pFnF2029Ref.Get ( );
 
 	UBioAutoConditionals_execF2029_Parms F2029_Parms;
 	F2029_Parms.bioWorld = bioWorld;
@@ -714,10 +682,9 @@ bool UBioAutoConditionals::F2029 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1973 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1973 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1973Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1973", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1973 )
-		pFnF1973 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1973" );
+	UFunction* const pFnF1973 = pFnF1973Ref.Get ( );
 
 	UBioAutoConditionals_execF1973_Parms F1973_Parms;
 	F1973_Parms.bioWorld = bioWorld;
@@ -737,10 +704,9 @@ bool UBioAutoConditionals::F1973 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1761 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1761 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1761Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1761", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1761 )
-		pFnF1761 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1761" );
+	UFunction* const pFnF1761 = pFnF1761Ref.Get ( );
 
 	UBioAutoConditionals_execF1761_Parms F1761_Parms;
 	F1761_Parms.bioWorld = bioWorld;
@@ -760,10 +726,9 @@ bool UBioAutoConditionals::F1761 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1736 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1736 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1736Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1736", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1736 )
-		pFnF1736 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1736" );
+	UFunction* const pFnF1736 = pFnF1736Ref.Get ( );
 
 	UBioAutoConditionals_execF1736_Parms F1736_Parms;
 	F1736_Parms.bioWorld = bioWorld;
@@ -783,10 +748,9 @@ bool UBioAutoConditionals::F1736 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1710 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1710 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1710Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1710", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1710 )
-		pFnF1710 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1710" );
+	UFunction* const pFnF1710 = pFnF1710Ref.Get ( );
 
 	UBioAutoConditionals_execF1710_Parms F1710_Parms;
 	F1710_Parms.bioWorld = bioWorld;
@@ -806,10 +770,9 @@ bool UBioAutoConditionals::F1710 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1709 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1709 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1709Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1709", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1709 )
-		pFnF1709 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1709" );
+	UFunction* const pFnF1709 = pFnF1709Ref.Get ( );
 
 	UBioAutoConditionals_execF1709_Parms F1709_Parms;
 	F1709_Parms.bioWorld = bioWorld;
@@ -829,10 +792,9 @@ bool UBioAutoConditionals::F1709 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1708 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1708 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1708Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1708", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1708 )
-		pFnF1708 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1708" );
+	UFunction* const pFnF1708 = pFnF1708Ref.Get ( );
 
 	UBioAutoConditionals_execF1708_Parms F1708_Parms;
 	F1708_Parms.bioWorld = bioWorld;
@@ -852,10 +814,9 @@ bool UBioAutoConditionals::F1708 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1707 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1707 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1707Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1707", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1707 )
-		pFnF1707 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1707" );
+	UFunction* const pFnF1707 = pFnF1707Ref.Get ( );
 
 	UBioAutoConditionals_execF1707_Parms F1707_Parms;
 	F1707_Parms.bioWorld = bioWorld;
@@ -875,10 +836,9 @@ bool UBioAutoConditionals::F1707 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1706 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1706 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1706Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1706", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1706 )
-		pFnF1706 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1706" );
+	UFunction* const pFnF1706 = pFnF1706Ref.Get ( );
 
 	UBioAutoConditionals_execF1706_Parms F1706_Parms;
 	F1706_Parms.bioWorld = bioWorld;
@@ -898,10 +858,9 @@ bool UBioAutoConditionals::F1706 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1705 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1705 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1705Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1705", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1705 )
-		pFnF1705 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1705" );
+	UFunction* const pFnF1705 = pFnF1705Ref.Get ( );
 
 	UBioAutoConditionals_execF1705_Parms F1705_Parms;
 	F1705_Parms.bioWorld = bioWorld;
@@ -921,10 +880,9 @@ bool UBioAutoConditionals::F1705 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1704 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1704 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1704Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1704", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1704 )
-		pFnF1704 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1704" );
+	UFunction* const pFnF1704 = pFnF1704Ref.Get ( );
 
 	UBioAutoConditionals_execF1704_Parms F1704_Parms;
 	F1704_Parms.bioWorld = bioWorld;
@@ -944,10 +902,9 @@ bool UBioAutoConditionals::F1704 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1703 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1703 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1703Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1703", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1703 )
-		pFnF1703 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1703" );
+	UFunction* const pFnF1703 = pFnF1703Ref.Get ( );
 
 	UBioAutoConditionals_execF1703_Parms F1703_Parms;
 	F1703_Parms.bioWorld = bioWorld;
@@ -967,10 +924,9 @@ bool UBioAutoConditionals::F1703 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1702 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1702 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1702Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1702", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1702 )
-		pFnF1702 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1702" );
+	UFunction* const pFnF1702 = pFnF1702Ref.Get ( );
 
 	UBioAutoConditionals_execF1702_Parms F1702_Parms;
 	F1702_Parms.bioWorld = bioWorld;
@@ -990,10 +946,9 @@ bool UBioAutoConditionals::F1702 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1701 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1701 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1701Ref { L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1701", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1701 )
-		pFnF1701 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1701" );
+	UFunction* const pFnF1701 = pFnF1701Ref.Get ( );
 
 	UBioAutoConditionals_execF1701_Parms F1701_Parms;
 	F1701_Parms.bioWorld = bioWorld;
@@ -1006,6 +961,63 @@ bool UBioAutoConditionals::F1701 ( class ABioWorldInfo* bioWorld, int Argument )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class PlotManagerDLC_00_Shared.BioAutoConditionals",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1863",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1862",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1861",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1860",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1859",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1858",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1881",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1880",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1972",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1971",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1970",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1840",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1839",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1762",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1760",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1759",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1758",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1757",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1722",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1721",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1720",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1719",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1718",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1717",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1716",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1715",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1714",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1713",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F2029",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1973",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1761",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1736",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1710",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1709",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1708",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1707",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1706",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1705",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1704",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1703",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1702",
+	L"Function PlotManagerDLC_00_Shared.BioAutoConditionals.F1701",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioAutoConditionals::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioAutoConditionals::pClassPointer { L"Class PlotManagerDLC_CON_Pack01.BioAutoConditionals", &UObject::FindClass };
 
 class UClass* UBioAutoConditionals::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class PlotManagerDLC_CON_Pack01.BioAutoConditionals" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function PlotManagerDLC_CON_Pack01.BioAutoConditionals.F1532
@@ -47,10 +44,9 @@ class UClass* UBioAutoConditionals::StaticClass()
 
 bool UBioAutoConditionals::F1532 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1532 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1532Ref { L"Function PlotManagerDLC_CON_Pack01.BioAutoConditionals.F1532", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1532 )
-		pFnF1532 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_CON_Pack01.BioAutoConditionals.F1532" );
+	UFunction* const pFnF1532 = pFnF1532Ref.Get ( );
 
 	UBioAutoConditionals_execF1532_Parms F1532_Parms;
 	F1532_Parms.bioWorld = bioWorld;
@@ -70,10 +66,9 @@ bool UBioAutoConditionals::F1532 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1531 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1531 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1531Ref { L"Function PlotManagerDLC_CON_Pack01.BioAutoConditionals.F1531", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1531 )
-		pFnF1531 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_CON_Pack01.BioAutoConditionals.F1531" );
+	UFunction* const pFnF1531 = pFnF1531Ref.Get ( );
 
 	UBioAutoConditionals_execF1531_Parms F1531_Parms;
 	F1531_Parms.bioWorld = bioWorld;
@@ -93,10 +88,9 @@ bool UBioAutoConditionals::F1531 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1526 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1526 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1526Ref { L"Function PlotManagerDLC_CON_Pack01.BioAutoConditionals.F1526", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1526 )
-		pFnF1526 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_CON_Pack01.BioAutoConditionals.F1526" );
+	UFunction* const pFnF1526 = pFnF1526Ref.Get ( );
 
 	UBioAutoConditionals_execF1526_Parms F1526_Parms;
 	F1526_Parms.bioWorld = bioWorld;
@@ -109,6 +103,24 @@ bool UBioAutoConditionals::F1526 ( class ABioWorldInfo* bioWorld, int Argument )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class PlotManagerDLC_CON_Pack01.BioAutoConditionals",
+	L"Function PlotManagerDLC_CON_Pack01.BioAutoConditionals.F1532",
+	L"Function PlotManagerDLC_CON_Pack01.BioAutoConditionals.F1531",
+	L"Function PlotManagerDLC_CON_Pack01.BioAutoConditionals.F1526",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioAutoConditionals::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioAutoConditionals::pClassPointer { L"Class PlotManagerDLC_CON_Pack02.BioAutoConditionals", &UObject::FindClass };
 
 class UClass* UBioAutoConditionals::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class PlotManagerDLC_CON_Pack02.BioAutoConditionals" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function PlotManagerDLC_CON_Pack02.BioAutoConditionals.F2035
@@ -47,10 +44,9 @@ class UClass* UBioAutoConditionals::StaticClass()
 
 bool UBioAutoConditionals::F2035 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2035 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2035Ref { L"Function PlotManagerDLC_CON_Pack02.BioAutoConditionals.F2035", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2035 )
-		pFnF2035 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_CON_Pack02.BioAutoConditionals.F2035" );
+	UFunction* const pFnF2035 = pFnF2035Ref.Get ( );
 
 	UBioAutoConditionals_execF2035_Parms F2035_Parms;
 	F2035_Parms.bioWorld = bioWorld;
@@ -70,10 +66,9 @@ bool UBioAutoConditionals::F2035 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2034 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2034 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2034Ref { L"Function PlotManagerDLC_CON_Pack02.BioAutoConditionals.F2034", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2034 )
-		pFnF2034 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_CON_Pack02.BioAutoConditionals.F2034" );
+	UFunction* const pFnF2034 = pFnF2034Ref.Get ( );
 
 	UBioAutoConditionals_execF2034_Parms F2034_Parms;
 	F2034_Parms.bioWorld = bioWorld;
@@ -93,10 +88,9 @@ bool UBioAutoConditionals::F2034 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2033 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2033 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2033Ref { L"Function PlotManagerDLC_CON_Pack02.BioAutoConditionals.F2033", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2033 )
-		pFnF2033 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_CON_Pack02.BioAutoConditionals.F2033" );
+	UFunction* const pFnF2033 = pFnF2033Ref.Get ( );
 
 	UBioAutoConditionals_execF2033_Parms F2033_Parms;
 	F2033_Parms.bioWorld = bioWorld;
@@ -109,6 +103,24 @@ bool UBioAutoConditionals::F2033 ( class ABioWorldInfo* bioWorld, int Argument )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class PlotManagerDLC_CON_Pack02.BioAutoConditionals",
+	L"Function PlotManagerDLC_CON_Pack02.BioAutoConditionals.F2035",
+	L"Function PlotManagerDLC_CON_Pack02.BioAutoConditionals.F2034",
+	L"Function PlotManagerDLC_CON_Pack02.BioAutoConditionals.F2033",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
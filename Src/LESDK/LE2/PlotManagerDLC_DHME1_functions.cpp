@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioAutoConditionals::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioAutoConditionals::pClassPointer { L"Class PlotManagerDLC_DHME1.BioAutoConditionals", &UObject::FindClass };
 
 class UClass* UBioAutoConditionals::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class PlotManagerDLC_DHME1.BioAutoConditionals" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function PlotManagerDLC_DHME1.BioAutoConditionals.F2039
@@ -47,10 +44,9 @@ class UClass* UBioAutoConditionals::StaticClass()
 
 bool UBioAutoConditionals::F2039 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2039 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2039Ref { L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2039", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2039 )
-		pFnF2039 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2039" );
+	UFunction* const pFnF2039 = pFnF2039Ref.Get ( );
 
 	UBioAutoConditionals_execF2039_Parms F2039_Parms;
 	F2039_Parms.bioWorld = bioWorld;
@@ -70,10 +66,9 @@ bool UBioAutoConditionals::F2039 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2038 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2038 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2038Ref { L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2038", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2038 )
-		pFnF2038 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2038" );
+	UFunction* const pFnF2038 = pFnF2038Ref.Get ( );
 
 	UBioAutoConditionals_execF2038_Parms F2038_Parms;
 	F2038_Parms.bioWorld = bioWorld;
@@ -93,10 +88,9 @@ bool UBioAutoConditionals::F2038 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2025 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2025 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2025Ref { L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2025", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2025 )
-		pFnF2025 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2025" );
+	UFunction* const pFnF2025 = pFnF2025Ref.Get ( );
 
 	UBioAutoConditionals_execF2025_Parms F2025_Parms;
 	F2025_Parms.bioWorld = bioWorld;
@@ -116,10 +110,9 @@ bool UBioAutoConditionals::F2025 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2024 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2024 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2024Ref { L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2024", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2024 )
-		pFnF2024 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2024" );
+	UFunction* const pFnF2024 = pFnF2024Ref.Get ( );
 
 	UBioAutoConditionals_execF2024_Parms F2024_Parms;
 	F2024_Parms.bioWorld = bioWorld;
@@ -139,10 +132,9 @@ bool UBioAutoConditionals::F2024 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2023 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2023 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2023Ref { L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2023", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2023 )
-		pFnF2023 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2023" );
+	UFunction* const pFnF2023 = pFnF2023Ref.Get ( );
 
 	UBioAutoConditionals_execF2023_Parms F2023_Parms;
 	F2023_Parms.bioWorld = bioWorld;
@@ -162,10 +154,9 @@ bool UBioAutoConditionals::F2023 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2022 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2022 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2022Ref { L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2022", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2022 )
-		pFnF2022 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2022" );
+	UFunction* const pFnF2022 = pFnF2022Ref.Get ( );
 
 	UBioAutoConditionals_execF2022_Parms F2022_Parms;
 	F2022_Parms.bioWorld = bioWorld;
@@ -185,10 +176,9 @@ bool UBioAutoConditionals::F2022 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2021 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2021 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2021Ref { L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2021", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2021 )
-		pFnF2021 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2021" );
+	UFunction* const pFnF2021 = pFnF2021Ref.Get ( );
 
 	UBioAutoConditionals_execF2021_Parms F2021_Parms;
 	F2021_Parms.bioWorld = bioWorld;
@@ -208,10 +198,9 @@ bool UBioAutoConditionals::F2021 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2020 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2020 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2020Ref { L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2020", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2020 )
-		pFnF2020 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2020" );
+	UFunction* const pFnF2020 = pFnF2020Ref.Get ( );
 
 	UBioAutoConditionals_execF2020_Parms F2020_Parms;
 	F2020_Parms.bioWorld = bioWorld;
@@ -231,10 +220,9 @@ bool UBioAutoConditionals::F2020 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2019 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2019 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2019Ref { L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2019", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2019 )
-		pFnF2019 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2019" );
+	UFunction* const pFnF2019 = pFnF2019Ref.Get ( );
 
 	UBioAutoConditionals_execF2019_Parms F2019_Parms;
 	F2019_Parms.bioWorld = bioWorld;
@@ -254,10 +242,9 @@ bool UBioAutoConditionals::F2019 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2018 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2018 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2018Ref { L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2018", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2018 )
-		pFnF2018 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2018" );
+	UFunction* const pFnF2018 = pFnF2018Ref.Get ( );
 
 	UBioAutoConditionals_execF2018_Parms F2018_Parms;
 	F2018_Parms.bioWorld = bioWorld;
@@ -270,6 +257,31 @@ bool UBioAutoConditionals::F2018 ( class ABioWorldInfo* bioWorld, int Argument )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class PlotManagerDLC_DHME1.BioAutoConditionals",
+	L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2039",
+	L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2038",
+	L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2025",
+	L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2024",
+	L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2023",
+	L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2022",
+	L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2021",
+	L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2020",
+	L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2019",
+	L"Function PlotManagerDLC_DHME1.BioAutoConditionals.F2018",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioAutoConditionals::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioAutoConditionals::pClassPointer { L"Class PlotManagerDLC_EXP_Part01.BioAutoConditionals", &UObject::FindClass };
 
 class UClass* UBioAutoConditionals::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class PlotManagerDLC_EXP_Part01.BioAutoConditionals" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1876
@@ -47,10 +44,9 @@ class UClass* UBioAutoConditionals::StaticClass()
 
 bool UBioAutoConditionals::F1876 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1876 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1876Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1876", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1876 )
-		pFnF1876 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1876" );
+	UFunction* const pFnF1876 = pFnF1876Ref.Get ( );
 
 	UBioAutoConditionals_execF1876_Parms F1876_Parms;
 	F1876_Parms.bioWorld = bioWorld;
@@ -70,10 +66,9 @@ bool UBioAutoConditionals::F1876 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1875 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1875 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1875Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1875", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1875 )
-		pFnF1875 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1875" );
+	UFunction* const pFnF1875 = pFnF1875Ref.Get ( );
 
 	UBioAutoConditionals_execF1875_Parms F1875_Parms;
 	F1875_Parms.bioWorld = bioWorld;
@@ -93,10 +88,9 @@ bool UBioAutoConditionals::F1875 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1874 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1874 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1874Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1874", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1874 )
-		pFnF1874 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1874" );
+	UFunction* const pFnF1874 = pFnF1874Ref.Get ( );
 
 	UBioAutoConditionals_execF1874_Parms F1874_Parms;
 	F1874_Parms.bioWorld = bioWorld;
@@ -116,10 +110,9 @@ bool UBioAutoConditionals::F1874 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1987 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1987 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1987Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1987", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1987 )
-		pFnF1987 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1987" );
+	UFunction* const pFnF1987 = pFnF1987Ref.Get ( );
 
 	UBioAutoConditionals_execF1987_Parms F1987_Parms;
 	F1987_Parms.bioWorld = bioWorld;
@@ -139,10 +132,9 @@ bool UBioAutoConditionals::F1987 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1902 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1902 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1902Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1902", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1902 )
-		pFnF1902 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1902" );
+	UFunction* const pFnF1902 = pFnF1902Ref.Get ( );
 
 	UBioAutoConditionals_execF1902_Parms F1902_Parms;
 	F1902_Parms.bioWorld = bioWorld;
@@ -162,10 +154,9 @@ bool UBioAutoConditionals::F1902 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1901 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1901 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1901Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1901", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1901 )
-		pFnF1901 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1901" );
+	UFunction* const pFnF1901 = pFnF1901Ref.Get ( );
 
 	UBioAutoConditionals_execF1901_Parms F1901_Parms;
 	F1901_Parms.bioWorld = bioWorld;
@@ -185,10 +176,9 @@ bool UBioAutoConditionals::F1901 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1900 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1900 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1900Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1900", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1900 )
-		pFnF1900 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1900" );
+	UFunction* const pFnF1900 = pFnF1900Ref.Get ( );
 
 	UBioAutoConditionals_execF1900_Parms F1900_Parms;
 	F1900_Parms.bioWorld = bioWorld;
@@ -208,10 +198,9 @@ bool UBioAutoConditionals::F1900 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1899 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1899 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1899Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1899", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1899 )
-		pFnF1899 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1899" );
+	UFunction* const pFnF1899 = pFnF1899Ref.Get ( );
 
 	UBioAutoConditionals_execF1899_Parms F1899_Parms;
 	F1899_Parms.bioWorld = bioWorld;
@@ -231,10 +220,9 @@ bool UBioAutoConditionals::F1899 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1898 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1898 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1898Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1898", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1898 )
-		pFnF1898 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1898" );
+	UFunction* const pFnF1898 = pFnF1898Ref.Get ( );
 
 	UBioAutoConditionals_execF1898_Parms F1898_Parms;
 	F1898_Parms.bioWorld = bioWorld;
@@ -254,10 +242,9 @@ bool UBioAutoConditionals::F1898 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1897 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1897 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1897Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1897", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1897 )
-		pFnF1897 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1897" );
+	UFunction* const pFnF1897 = pFnF1897Ref.Get ( );
 
 	UBioAutoConditionals_execF1897_Parms F1897_Parms;
 	F1897_Parms.bioWorld = bioWorld;
@@ -277,10 +264,9 @@ bool UBioAutoConditionals::F1897 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1896 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1896 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1896Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1896", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1896 )
-		pFnF1896 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1896" );
+	UFunction* const pFnF1896 = pFnF1896Ref.Get ( );
 
 	UBioAutoConditionals_execF1896_Parms F1896_Parms;
 	F1896_Parms.bioWorld = bioWorld;
@@ -300,10 +286,9 @@ bool UBioAutoConditionals::F1896 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1895 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1895 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1895Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1895", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1895 )
-		pFnF1895 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1895" );
+	UFunction* const pFnF1895 = pFnF1895Ref.Get ( );
 
 	UBioAutoConditionals_execF1895_Parms F1895_Parms;
 	F1895_Parms.bioWorld = bioWorld;
@@ -323,10 +308,9 @@ bool UBioAutoConditionals::F1895 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1894 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1894 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1894Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1894", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1894 )
-		pFnF1894 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1894" );
+	UFunction* const pFnF1894 = pFnF1894Ref.Get ( );
 
 	UBioAutoConditionals_execF1894_Parms F1894_Parms;
 	F1894_Parms.bioWorld = bioWorld;
@@ -346,10 +330,9 @@ bool UBioAutoConditionals::F1894 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1893 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1893 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1893Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1893", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1893 )
-		pFnF1893 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1893" );
+	UFunction* const pFnF1893 = pFnF1893Ref.Get ( );
 
 	UBioAutoConditionals_execF1893_Parms F1893_Parms;
 	F1893_Parms.bioWorld = bioWorld;
@@ -369,10 +352,9 @@ bool UBioAutoConditionals::F1893 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1912 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1912 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1912Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1912", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1912 )
-		pFnF1912 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1912" );
+	UFunction* const pFnF1912 = pFnF1912Ref.Get ( );
 
 	UBioAutoConditionals_execF1912_Parms F1912_Parms;
 	F1912_Parms.bioWorld = bioWorld;
@@ -392,10 +374,9 @@ bool UBioAutoConditionals::F1912 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1911 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1911 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1911Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1911", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1911 )
-		pFnF1911 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1911" );
+	UFunction* const pFnF1911 = pFnF1911Ref.Get ( );
 
 	UBioAutoConditionals_execF1911_Parms F1911_Parms;
 	F1911_Parms.bioWorld = bioWorld;
@@ -415,10 +396,9 @@ bool UBioAutoConditionals::F1911 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1910 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1910 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1910Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1910", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1910 )
-		pFnF1910 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1910" );
+	UFunction* const pFnF1910 = pFnF1910Ref.Get ( );
 
 	UBioAutoConditionals_execF1910_Parms F1910_Parms;
 	F1910_Parms.bioWorld = bioWorld;
@@ -438,10 +418,9 @@ bool UBioAutoConditionals::F1910 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1909 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1909 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1909Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1909", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1909 )
-		pFnF1909 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1909" );
+	UFunction* const pFnF1909 = pFnF1909Ref.Get ( );
 
 	UBioAutoConditionals_execF1909_Parms F1909_Parms;
 	F1909_Parms.bioWorld = bioWorld;
@@ -461,10 +440,9 @@ bool UBioAutoConditionals::F1909 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1908 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1908 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1908Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1908", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1908 )
-		pFnF1908 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1908" );
+	UFunction* const pFnF1908 = pFnF1908Ref.Get ( );
 
 	UBioAutoConditionals_execF1908_Parms F1908_Parms;
 	F1908_Parms.bioWorld = bioWorld;
@@ -484,10 +462,9 @@ bool UBioAutoConditionals::F1908 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1907 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1907 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1907Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1907", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1907 )
-		pFnF1907 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1907" );
+	UFunction* const pFnF1907 = pFnF1907Ref.Get ( );
 
 	UBioAutoConditionals_execF1907_Parms F1907_Parms;
 	F1907_Parms.bioWorld = bioWorld;
@@ -507,10 +484,9 @@ bool UBioAutoConditionals::F1907 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1906 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1906 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1906Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1906", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1906 )
-		pFnF1906 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1906" );
+	UFunction* const pFnF1906 = pFnF1906Ref.Get ( );
 
 	UBioAutoConditionals_execF1906_Parms F1906_Parms;
 	F1906_Parms.bioWorld = bioWorld;
@@ -530,10 +506,9 @@ bool UBioAutoConditionals::F1906 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1905 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1905 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1905Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1905", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1905 )
-		pFnF1905 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1905" );
+	UFunction* const pFnF1905 = pFnF1905Ref.Get ( );
 
 	UBioAutoConditionals_execF1905_Parms F1905_Parms;
 	F1905_Parms.bioWorld = bioWorld;
@@ -553,10 +528,9 @@ bool UBioAutoConditionals::F1905 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1904 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1904 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1904Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1904", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1904 )
-		pFnF1904 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1904" );
+	UFunction* const pFnF1904 = pFnF1904Ref.Get ( );
 
 	UBioAutoConditionals_execF1904_Parms F1904_Parms;
 	F1904_Parms.bioWorld = bioWorld;
@@ -576,10 +550,9 @@ bool UBioAutoConditionals::F1904 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1903 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1903 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1903Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1903", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1903 )
-		pFnF1903 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1903" );
+	UFunction* const pFnF1903 = pFnF1903Ref.Get ( );
 
 	UBioAutoConditionals_execF1903_Parms F1903_Parms;
 	F1903_Parms.bioWorld = bioWorld;
@@ -599,10 +572,9 @@ bool UBioAutoConditionals::F1903 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1922 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1922 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1922Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1922", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1922 )
-		pFnF1922 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1922" );
+	UFunction* const pFnF1922 = pFnF1922Ref.Get ( );
 
 	UBioAutoConditionals_execF1922_Parms F1922_Parms;
 	F1922_Parms.bioWorld = bioWorld;
@@ -622,10 +594,9 @@ bool UBioAutoConditionals::F1922 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1921 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1921 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1921Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1921", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1921 )
-		pFnF1921 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1921" );
+	UFunction* const pFnF1921 = pFnF1921Ref.Get ( );
 
 	UBioAutoConditionals_execF1921_Parms F1921_Parms;
 	F1921_Parms.bioWorld = bioWorld;
@@ -645,10 +616,9 @@ bool UBioAutoConditionals::F1921 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1920 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1920 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1920Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1920", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1920 )
-		pFnF1920 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1920" );
+	UFunction* const pFnF1920 = pFnF1920Ref.Get ( );
 
 	UBioAutoConditionals_execF1920_Parms F1920_Parms;
 	F1920_Parms.bioWorld = bioWorld;
@@ -668,10 +638,9 @@ bool UBioAutoConditionals::F1920 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1919 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1919 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1919Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1919", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1919 )
-		pFnF1919 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1919" );
+	UFunction* const pFnF1919 = pFnF1919Ref.Get ( );
 
 	UBioAutoConditionals_execF1919_Parms F1919_Parms;
 	F1919_Parms.bioWorld = bioWorld;
@@ -691,10 +660,9 @@ bool UBioAutoConditionals::F1919 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1918 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1918 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1918Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1918", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1918 )
-		pFnF1918 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1918" );
+	UFunction* const pFnF1918 = pFnF1918Ref.Get ( );
 
 	UBioAutoConditionals_execF1918_Parms F1918_Parms;
 	F1918_Parms.bioWorld = bioWorld;
@@ -714,10 +682,9 @@ bool UBioAutoConditionals::F1918 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1917 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1917 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1917Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1917", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1917 )
-		pFnF1917 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1917" );
+	UFunction* const pFnF1917 = pFnF1917Ref.Get ( );
 
 	UBioAutoConditionals_execF1917_Parms F1917_Parms;
 	F1917_Parms.bioWorld = bioWorld;
@@ -737,10 +704,9 @@ bool UBioAutoConditionals::F1917 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1916 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1916 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1916Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1916", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1916 )
-		pFnF1916 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1916" );
+	UFunction* const pFnF1916 = pFnF1916Ref.Get ( );
 
 	UBioAutoConditionals_execF1916_Parms F1916_Parms;
 	F1916_Parms.bioWorld = bioWorld;
@@ -760,10 +726,9 @@ bool UBioAutoConditionals::F1916 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1915 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1915 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1915Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1915", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1915 )
-		pFnF1915 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1915" );
+	UFunction* const pFnF1915 = pFnF1915Ref.Get ( );
 
 	UBioAutoConditionals_execF1915_Parms F1915_Parms;
 	F1915_Parms.bioWorld = bioWorld;
@@ -783,10 +748,9 @@ bool UBioAutoConditionals::F1915 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1914 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1914 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1914Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1914", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1914 )
-		pFnF1914 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1914" );
+	UFunction* const pFnF1914 = pFnF1914Ref.Get ( );
 
 	UBioAutoConditionals_execF1914_Parms F1914_Parms;
 	F1914_Parms.bioWorld = bioWorld;
@@ -806,10 +770,9 @@ bool UBioAutoConditionals::F1914 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1913 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1913 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1913Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1913", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1913 )
-		pFnF1913 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1913" );
+	UFunction* const pFnF1913 = pFnF1913Ref.Get ( );
 
 	UBioAutoConditionals_execF1913_Parms F1913_Parms;
 	F1913_Parms.bioWorld = bioWorld;
@@ -829,10 +792,9 @@ bool UBioAutoConditionals::F1913 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1892 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1892 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1892Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1892", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1892 )
-		pFnF1892 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1892" );
+	UFunction* const pFnF1892 = pFnF1892Ref.Get ( );
 
 	UBioAutoConditionals_execF1892_Parms F1892_Parms;
 	F1892_Parms.bioWorld = bioWorld;
@@ -852,10 +814,9 @@ bool UBioAutoConditionals::F1892 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1891 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1891 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1891Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1891", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1891 )
-		pFnF1891 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1891" );
+	UFunction* const pFnF1891 = pFnF1891Ref.Get ( );
 
 	UBioAutoConditionals_execF1891_Parms F1891_Parms;
 	F1891_Parms.bioWorld = bioWorld;
@@ -875,10 +836,9 @@ bool UBioAutoConditionals::F1891 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1890 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1890 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1890Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1890", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1890 )
-		pFnF1890 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1890" );
+	UFunction* const pFnF1890 = pFnF1890Ref.Get ( );
 
 	UBioAutoConditionals_execF1890_Parms F1890_Parms;
 	F1890_Parms.bioWorld = bioWorld;
@@ -898,10 +858,9 @@ bool UBioAutoConditionals::F1890 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1889 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1889 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1889Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1889", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1889 )
-		pFnF1889 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1889" );
+	UFunction* const pFnF1889 = pFnF1889Ref.Get ( );
 
 	UBioAutoConditionals_execF1889_Parms F1889_Parms;
 	F1889_Parms.bioWorld = bioWorld;
@@ -921,10 +880,9 @@ bool UBioAutoConditionals::F1889 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1888 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1888 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1888Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1888", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1888 )
-		pFnF1888 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1888" );
+	UFunction* const pFnF1888 = pFnF1888Ref.Get ( );
 
 	UBioAutoConditionals_execF1888_Parms F1888_Parms;
 	F1888_Parms.bioWorld = bioWorld;
@@ -944,10 +902,9 @@ bool UBioAutoConditionals::F1888 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1887 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1887 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1887Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1887", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1887 )
-		pFnF1887 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1887" );
+	UFunction* const pFnF1887 = pFnF1887Ref.Get ( );
 
 	UBioAutoConditionals_execF1887_Parms F1887_Parms;
 	F1887_Parms.bioWorld = bioWorld;
@@ -967,10 +924,9 @@ bool UBioAutoConditionals::F1887 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1886 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1886 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1886Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1886", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1886 )
-		pFnF1886 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1886" );
+	UFunction* const pFnF1886 = pFnF1886Ref.Get ( );
 
 	UBioAutoConditionals_execF1886_Parms F1886_Parms;
 	F1886_Parms.bioWorld = bioWorld;
@@ -990,10 +946,9 @@ bool UBioAutoConditionals::F1886 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1885 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1885 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1885Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1885", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1885 )
-		pFnF1885 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1885" );
+	UFunction* const pFnF1885 = pFnF1885Ref.Get ( );
 
 	UBioAutoConditionals_execF1885_Parms F1885_Parms;
 	F1885_Parms.bioWorld = bioWorld;
@@ -1013,10 +968,9 @@ bool UBioAutoConditionals::F1885 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1884 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1884 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1884Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1884", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1884 )
-		pFnF1884 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1884" );
+	UFunction* const pFnF1884 = pFnF1884Ref.Get ( );
 
 	UBioAutoConditionals_execF1884_Parms F1884_Parms;
 	F1884_Parms.bioWorld = bioWorld;
@@ -1036,10 +990,9 @@ bool UBioAutoConditionals::F1884 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1882 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1882 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1882Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1882", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1882 )
-		pFnF1882 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1882" );
+	UFunction* const pFnF1882 = pFnF1882Ref.Get ( );
 
 	UBioAutoConditionals_execF1882_Parms F1882_Parms;
 	F1882_Parms.bioWorld = bioWorld;
@@ -1059,10 +1012,9 @@ bool UBioAutoConditionals::F1882 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1997 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1997 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1997Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1997", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1997 )
-		pFnF1997 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1997" );
+	UFunction* const pFnF1997 = pFnF1997Ref.Get ( );
 
 	UBioAutoConditionals_execF1997_Parms F1997_Parms;
 	F1997_Parms.bioWorld = bioWorld;
@@ -1082,10 +1034,9 @@ bool UBioAutoConditionals::F1997 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1950 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1950 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1950Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1950", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1950 )
-		pFnF1950 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1950" );
+	UFunction* const pFnF1950 = pFnF1950Ref.Get ( );
 
 	UBioAutoConditionals_execF1950_Parms F1950_Parms;
 	F1950_Parms.bioWorld = bioWorld;
@@ -1105,10 +1056,9 @@ bool UBioAutoConditionals::F1950 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1924 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1924 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1924Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1924", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1924 )
-		pFnF1924 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1924" );
+	UFunction* const pFnF1924 = pFnF1924Ref.Get ( );
 
 	UBioAutoConditionals_execF1924_Parms F1924_Parms;
 	F1924_Parms.bioWorld = bioWorld;
@@ -1128,10 +1078,9 @@ bool UBioAutoConditionals::F1924 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1923 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1923 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1923Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1923", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1923 )
-		pFnF1923 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1923" );
+	UFunction* const pFnF1923 = pFnF1923Ref.Get ( );
 
 	UBioAutoConditionals_execF1923_Parms F1923_Parms;
 	F1923_Parms.bioWorld = bioWorld;
@@ -1151,10 +1100,9 @@ bool UBioAutoConditionals::F1923 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1975 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1975 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1975Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1975", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1975 )
-		pFnF1975 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1975" );
+	UFunction* const pFnF1975 = pFnF1975Ref.Get ( );
 
 	UBioAutoConditionals_execF1975_Parms F1975_Parms;
 	F1975_Parms.bioWorld = bioWorld;
@@ -1174,10 +1122,9 @@ bool UBioAutoConditionals::F1975 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1998 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1998 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1998Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1998", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1998 )
-		pFnF1998 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1998" );
+	UFunction* const pFnF1998 = pFnF1998Ref.Get ( );
 
 	UBioAutoConditionals_execF1998_Parms F1998_Parms;
 	F1998_Parms.bioWorld = bioWorld;
@@ -1197,10 +1144,9 @@ bool UBioAutoConditionals::F1998 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1870 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1870 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1870Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1870", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1870 )
-		pFnF1870 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1870" );
+	UFunction* const pFnF1870 = pFnF1870Ref.Get ( );
 
 	UBioAutoConditionals_execF1870_Parms F1870_Parms;
 	F1870_Parms.bioWorld = bioWorld;
@@ -1220,10 +1166,9 @@ bool UBioAutoConditionals::F1870 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1869 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1869 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1869Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1869", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1869 )
-		pFnF1869 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1869" );
+	UFunction* const pFnF1869 = pFnF1869Ref.Get ( );
 
 	UBioAutoConditionals_execF1869_Parms F1869_Parms;
 	F1869_Parms.bioWorld = bioWorld;
@@ -1243,10 +1188,9 @@ bool UBioAutoConditionals::F1869 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1868 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1868 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1868Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1868", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1868 )
-		pFnF1868 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1868" );
+	UFunction* const pFnF1868 = pFnF1868Ref.Get ( );
 
 	UBioAutoConditionals_execF1868_Parms F1868_Parms;
 	F1868_Parms.bioWorld = bioWorld;
@@ -1266,10 +1210,9 @@ bool UBioAutoConditionals::F1868 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1867 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1867 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1867Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1867", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1867 )
-		pFnF1867 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1867" );
+	UFunction* const pFnF1867 = pFnF1867Ref.Get ( );
 
 	UBioAutoConditionals_execF1867_Parms F1867_Parms;
 	F1867_Parms.bioWorld = bioWorld;
@@ -1289,10 +1232,9 @@ bool UBioAutoConditionals::F1867 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1866 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1866 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1866Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1866", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1866 )
-		pFnF1866 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1866" );
+	UFunction* const pFnF1866 = pFnF1866Ref.Get ( );
 
 	UBioAutoConditionals_execF1866_Parms F1866_Parms;
 	F1866_Parms.bioWorld = bioWorld;
@@ -1312,10 +1254,9 @@ bool UBioAutoConditionals::F1866 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1865 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1865 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1865Ref { L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1865", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1865 )
-		pFnF1865 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1865" );
+	UFunction* const pFnF1865 = pFnF1865Ref.Get ( );
 
 	UBioAutoConditionals_execF1865_Parms F1865_Parms;
 	F1865_Parms.bioWorld = bioWorld;
@@ -1328,6 +1269,77 @@ bool UBioAutoConditionals::F1865 ( class ABioWorldInfo* bioWorld, int Argument )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class PlotManagerDLC_EXP_Part01.BioAutoConditionals",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1876",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1875",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1874",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1987",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1902",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1901",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1900",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1899",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1898",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1897",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1896",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1895",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1894",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1893",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1912",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1911",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1910",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1909",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1908",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1907",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1906",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1905",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1904",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1903",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1922",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1921",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1920",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1919",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1918",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1917",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1916",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1915",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1914",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1913",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1892",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1891",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1890",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1889",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1888",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1887",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1886",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1885",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1884",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1882",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1997",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1950",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1924",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1923",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1975",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1998",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1870",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1869",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1868",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1867",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1866",
+	L"Function PlotManagerDLC_EXP_Part01.BioAutoConditionals.F1865",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
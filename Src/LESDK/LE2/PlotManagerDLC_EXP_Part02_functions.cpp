@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioAutoConditionals::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioAutoConditionals::pClassPointer { L"Class PlotManagerDLC_EXP_Part02.BioAutoConditionals", &UObject::FindClass };
 
 class UClass* UBioAutoConditionals::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class PlotManagerDLC_EXP_Part02.BioAutoConditionals" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2032
@@ -47,10 +44,9 @@ class UClass* UBioAutoConditionals::StaticClass()
 
 bool UBioAutoConditionals::F2032 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2032 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2032Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2032", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2032 )
-		pFnF2032 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2032" );
+	UFunction* const pFnF2032 = pFnF2032Ref.Get ( );
 
 	UBioAutoConditionals_execF2032_Parms F2032_Parms;
 	F2032_Parms.bioWorld = bioWorld;
@@ -70,10 +66,9 @@ bool UBioAutoConditionals::F2032 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2031 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2031 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2031Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2031", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2031 )
-		pFnF2031 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2031" );
+	UFunction* const pFnF2031 = pFnF2031Ref.Get ( );
 
 	UBioAutoConditionals_execF2031_Parms F2031_Parms;
 	F2031_Parms.bioWorld = bioWorld;
@@ -93,10 +88,9 @@ bool UBioAutoConditionals::F2031 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2037 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2037 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2037Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2037", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2037 )
-		pFnF2037 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2037" );
+	UFunction* const pFnF2037 = pFnF2037Ref.Get ( );
 
 	UBioAutoConditionals_execF2037_Parms F2037_Parms;
 	F2037_Parms.bioWorld = bioWorld;
@@ -116,10 +110,9 @@ bool UBioAutoConditionals::F2037 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2036 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2036 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2036Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2036", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2036 )
-		pFnF2036 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2036" );
+	UFunction* const pFnF2036 = pFnF2036Ref.Get ( );
 
 	UBioAutoConditionals_execF2036_Parms F2036_Parms;
 	F2036_Parms.bioWorld = bioWorld;
@@ -139,10 +132,9 @@ bool UBioAutoConditionals::F2036 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2027 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2027 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2027Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2027", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2027 )
-		pFnF2027 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2027" );
+	UFunction* const pFnF2027 = pFnF2027Ref.Get ( );
 
 	UBioAutoConditionals_execF2027_Parms F2027_Parms;
 	F2027_Parms.bioWorld = bioWorld;
@@ -162,10 +154,9 @@ bool UBioAutoConditionals::F2027 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2026 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2026 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2026Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2026", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2026 )
-		pFnF2026 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2026" );
+	UFunction* const pFnF2026 = pFnF2026Ref.Get ( );
 
 	UBioAutoConditionals_execF2026_Parms F2026_Parms;
 	F2026_Parms.bioWorld = bioWorld;
@@ -185,10 +176,9 @@ bool UBioAutoConditionals::F2026 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2002 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2002 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2002Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2002", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2002 )
-		pFnF2002 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2002" );
+	UFunction* const pFnF2002 = pFnF2002Ref.Get ( );
 
 	UBioAutoConditionals_execF2002_Parms F2002_Parms;
 	F2002_Parms.bioWorld = bioWorld;
@@ -208,10 +198,9 @@ bool UBioAutoConditionals::F2002 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1999 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1999 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1999Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1999", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1999 )
-		pFnF1999 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1999" );
+	UFunction* const pFnF1999 = pFnF1999Ref.Get ( );
 
 	UBioAutoConditionals_execF1999_Parms F1999_Parms;
 	F1999_Parms.bioWorld = bioWorld;
@@ -231,10 +220,9 @@ bool UBioAutoConditionals::F1999 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2001 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2001 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2001Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2001", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2001 )
-		pFnF2001 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2001" );
+	UFunction* const pFnF2001 = pFnF2001Ref.Get ( );
 
 	UBioAutoConditionals_execF2001_Parms F2001_Parms;
 	F2001_Parms.bioWorld = bioWorld;
@@ -254,10 +242,9 @@ bool UBioAutoConditionals::F2001 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2000 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2000 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2000Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2000", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2000 )
-		pFnF2000 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2000" );
+	UFunction* const pFnF2000 = pFnF2000Ref.Get ( );
 
 	UBioAutoConditionals_execF2000_Parms F2000_Parms;
 	F2000_Parms.bioWorld = bioWorld;
@@ -277,10 +264,9 @@ bool UBioAutoConditionals::F2000 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2003 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2003 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2003Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2003", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2003 )
-		pFnF2003 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2003" );
+	UFunction* const pFnF2003 = pFnF2003Ref.Get ( );
 
 	UBioAutoConditionals_execF2003_Parms F2003_Parms;
 	F2003_Parms.bioWorld = bioWorld;
@@ -300,10 +286,9 @@ bool UBioAutoConditionals::F2003 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2005 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2005 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2005Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2005", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2005 )
-		pFnF2005 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2005" );
+	UFunction* const pFnF2005 = pFnF2005Ref.Get ( );
 
 	UBioAutoConditionals_execF2005_Parms F2005_Parms;
 	F2005_Parms.bioWorld = bioWorld;
@@ -323,10 +308,9 @@ bool UBioAutoConditionals::F2005 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2004 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2004 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2004Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2004", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2004 )
-		pFnF2004 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2004" );
+	UFunction* const pFnF2004 = pFnF2004Ref.Get ( );
 
 	UBioAutoConditionals_execF2004_Parms F2004_Parms;
 	F2004_Parms.bioWorld = bioWorld;
@@ -346,10 +330,9 @@ bool UBioAutoConditionals::F2004 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1991 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1991 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1991Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1991", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1991 )
-		pFnF1991 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1991" );
+	UFunction* const pFnF1991 = pFnF1991Ref.Get ( );
 
 	UBioAutoConditionals_execF1991_Parms F1991_Parms;
 	F1991_Parms.bioWorld = bioWorld;
@@ -369,10 +352,9 @@ bool UBioAutoConditionals::F1991 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1990 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1990 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1990Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1990", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1990 )
-		pFnF1990 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1990" );
+	UFunction* const pFnF1990 = pFnF1990Ref.Get ( );
 
 	UBioAutoConditionals_execF1990_Parms F1990_Parms;
 	F1990_Parms.bioWorld = bioWorld;
@@ -392,10 +374,9 @@ bool UBioAutoConditionals::F1990 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1989 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1989 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1989Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1989", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1989 )
-		pFnF1989 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1989" );
+	UFunction* const pFnF1989 = pFnF1989Ref.Get ( );
 
 	UBioAutoConditionals_execF1989_Parms F1989_Parms;
 	F1989_Parms.bioWorld = bioWorld;
@@ -415,10 +396,9 @@ bool UBioAutoConditionals::F1989 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1996 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1996 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1996Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1996", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1996 )
-		pFnF1996 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1996" );
+	UFunction* const pFnF1996 = pFnF1996Ref.Get ( );
 
 	UBioAutoConditionals_execF1996_Parms F1996_Parms;
 	F1996_Parms.bioWorld = bioWorld;
@@ -438,10 +418,9 @@ bool UBioAutoConditionals::F1996 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1986 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1986 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1986Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1986", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1986 )
-		pFnF1986 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1986" );
+	UFunction* const pFnF1986 = pFnF1986Ref.Get ( );
 
 	UBioAutoConditionals_execF1986_Parms F1986_Parms;
 	F1986_Parms.bioWorld = bioWorld;
@@ -461,10 +440,9 @@ bool UBioAutoConditionals::F1986 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1985 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1985 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1985Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1985", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1985 )
-		pFnF1985 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1985" );
+	UFunction* const pFnF1985 = pFnF1985Ref.Get ( );
 
 	UBioAutoConditionals_execF1985_Parms F1985_Parms;
 	F1985_Parms.bioWorld = bioWorld;
@@ -484,10 +462,9 @@ bool UBioAutoConditionals::F1985 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1983 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1983 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1983Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1983", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1983 )
-		pFnF1983 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1983" );
+	UFunction* const pFnF1983 = pFnF1983Ref.Get ( );
 
 	UBioAutoConditionals_execF1983_Parms F1983_Parms;
 	F1983_Parms.bioWorld = bioWorld;
@@ -507,10 +484,9 @@ bool UBioAutoConditionals::F1983 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1982 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1982 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1982Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1982", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1982 )
-		pFnF1982 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1982" );
+	UFunction* const pFnF1982 = pFnF1982Ref.Get ( );
 
 	UBioAutoConditionals_execF1982_Parms F1982_Parms;
 	F1982_Parms.bioWorld = bioWorld;
@@ -530,10 +506,9 @@ bool UBioAutoConditionals::F1982 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1981 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1981 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1981Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1981", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1981 )
-		pFnF1981 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1981" );
+	UFunction* const pFnF1981 = pFnF1981Ref.Get ( );
 
 	UBioAutoConditionals_execF1981_Parms F1981_Parms;
 	F1981_Parms.bioWorld = bioWorld;
@@ -553,10 +528,9 @@ bool UBioAutoConditionals::F1981 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1980 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1980 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1980Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1980", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1980 )
-		pFnF1980 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1980" );
+	UFunction* const pFnF1980 = pFnF1980Ref.Get ( );
 
 	UBioAutoConditionals_execF1980_Parms F1980_Parms;
 	F1980_Parms.bioWorld = bioWorld;
@@ -576,10 +550,9 @@ bool UBioAutoConditionals::F1980 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1979 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1979 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1979Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1979", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1979 )
-		pFnF1979 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1979" );
+	UFunction* const pFnF1979 = pFnF1979Ref.Get ( );
 
 	UBioAutoConditionals_execF1979_Parms F1979_Parms;
 	F1979_Parms.bioWorld = bioWorld;
@@ -599,10 +572,9 @@ bool UBioAutoConditionals::F1979 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1978 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1978 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1978Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1978", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1978 )
-		pFnF1978 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1978" );
+	UFunction* const pFnF1978 = pFnF1978Ref.Get ( );
 
 	UBioAutoConditionals_execF1978_Parms F1978_Parms;
 	F1978_Parms.bioWorld = bioWorld;
@@ -622,10 +594,9 @@ bool UBioAutoConditionals::F1978 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1977 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1977 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1977Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1977", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1977 )
-		pFnF1977 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1977" );
+	UFunction* const pFnF1977 = pFnF1977Ref.Get ( );
 
 	UBioAutoConditionals_execF1977_Parms F1977_Parms;
 	F1977_Parms.bioWorld = bioWorld;
@@ -645,10 +616,9 @@ bool UBioAutoConditionals::F1977 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1969 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1969 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1969Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1969", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1969 )
-		pFnF1969 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1969" );
+	UFunction* const pFnF1969 = pFnF1969Ref.Get ( );
 
 	UBioAutoConditionals_execF1969_Parms F1969_Parms;
 	F1969_Parms.bioWorld = bioWorld;
@@ -668,10 +638,9 @@ bool UBioAutoConditionals::F1969 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1968 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1968 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1968Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1968", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1968 )
-		pFnF1968 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1968" );
+	UFunction* const pFnF1968 = pFnF1968Ref.Get ( );
 
 	UBioAutoConditionals_execF1968_Parms F1968_Parms;
 	F1968_Parms.bioWorld = bioWorld;
@@ -691,10 +660,9 @@ bool UBioAutoConditionals::F1968 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1967 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1967 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1967Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1967", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1967 )
-		pFnF1967 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1967" );
+	UFunction* const pFnF1967 = pFnF1967Ref.Get ( );
 
 	UBioAutoConditionals_execF1967_Parms F1967_Parms;
 	F1967_Parms.bioWorld = bioWorld;
@@ -714,10 +682,9 @@ bool UBioAutoConditionals::F1967 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1966 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1966 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1966Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1966", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1966 )
-		pFnF1966 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1966" );
+	UFunction* const pFnF1966 = pFnF1966Ref.Get ( );
 
 	UBioAutoConditionals_execF1966_Parms F1966_Parms;
 	F1966_Parms.bioWorld = bioWorld;
@@ -737,10 +704,9 @@ bool UBioAutoConditionals::F1966 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1964 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1964 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1964Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1964", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1964 )
-		pFnF1964 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1964" );
+	UFunction* const pFnF1964 = pFnF1964Ref.Get ( );
 
 	UBioAutoConditionals_execF1964_Parms F1964_Parms;
 	F1964_Parms.bioWorld = bioWorld;
@@ -760,10 +726,9 @@ bool UBioAutoConditionals::F1964 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1963 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1963 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1963Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1963", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1963 )
-		pFnF1963 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1963" );
+	UFunction* const pFnF1963 = pFnF1963Ref.Get ( );
 
 	UBioAutoConditionals_execF1963_Parms F1963_Parms;
 	F1963_Parms.bioWorld = bioWorld;
@@ -783,10 +748,9 @@ bool UBioAutoConditionals::F1963 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1962 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1962 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1962Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1962", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1962 )
-		pFnF1962 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1962" );
+	UFunction* const pFnF1962 = pFnF1962Ref.Get ( );
 
 	UBioAutoConditionals_execF1962_Parms F1962_Parms;
 	F1962_Parms.bioWorld = bioWorld;
@@ -806,10 +770,9 @@ bool UBioAutoConditionals::F1962 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1961 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1961 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1961Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1961", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1961 )
-		pFnF1961 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1961" );
+	UFunction* const pFnF1961 = pFnF1961Ref.Get ( );
 
 	UBioAutoConditionals_execF1961_Parms F1961_Parms;
 	F1961_Parms.bioWorld = bioWorld;
@@ -829,10 +792,9 @@ bool UBioAutoConditionals::F1961 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1960 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1960 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1960Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1960", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1960 )
-		pFnF1960 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1960" );
+	UFunction* const pFnF1960 = pFnF1960Ref.Get ( );
 
 	UBioAutoConditionals_execF1960_Parms F1960_Parms;
 	F1960_Parms.bioWorld = bioWorld;
@@ -852,10 +814,9 @@ bool UBioAutoConditionals::F1960 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2030 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2030 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2030Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2030", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2030 )
-		pFnF2030 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2030" );
+	UFunction* const pFnF2030 = pFnF2030Ref.Get ( );
 
 	UBioAutoConditionals_execF2030_Parms F2030_Parms;
 	F2030_Parms.bioWorld = bioWorld;
@@ -875,10 +836,9 @@ bool UBioAutoConditionals::F2030 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2008 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2008 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2008Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2008", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2008 )
-		pFnF2008 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2008" );
+	UFunction* const pFnF2008 = pFnF2008Ref.Get ( );
 
 	UBioAutoConditionals_execF2008_Parms F2008_Parms;
 	F2008_Parms.bioWorld = bioWorld;
@@ -898,10 +858,9 @@ bool UBioAutoConditionals::F2008 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2007 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2007 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2007Ref { L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2007", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2007 )
-		pFnF2007 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2007" );
+	UFunction* const pFnF2007 = pFnF2007Ref.Get ( );
 
 	UBioAutoConditionals_execF2007_Parms F2007_Parms;
 	F2007_Parms.bioWorld = bioWorld;
@@ -914,6 +873,59 @@ bool UBioAutoConditionals::F2007 ( class ABioWorldInfo* bioWorld, int Argument )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class PlotManagerDLC_EXP_Part02.BioAutoConditionals",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2032",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2031",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2037",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2036",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2027",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2026",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2002",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1999",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2001",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2000",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2003",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2005",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2004",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1991",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1990",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1989",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1996",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1986",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1985",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1983",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1982",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1981",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1980",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1979",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1978",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1977",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1969",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1968",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1967",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1966",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1964",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1963",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1962",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1961",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F1960",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2030",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2008",
+	L"Function PlotManagerDLC_EXP_Part02.BioAutoConditionals.F2007",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
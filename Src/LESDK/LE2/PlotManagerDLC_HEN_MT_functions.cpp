@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioAutoConditionals::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioAutoConditionals::pClassPointer { L"Class PlotManagerDLC_HEN_MT.BioAutoConditionals", &UObject::FindClass };
 
 class UClass* UBioAutoConditionals::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class PlotManagerDLC_HEN_MT.BioAutoConditionals" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1833
@@ -47,10 +44,9 @@ class UClass* UBioAutoConditionals::StaticClass()
 
 bool UBioAutoConditionals::F1833 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1833 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1833Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1833", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1833 )
-		pFnF1833 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1833" );
+	UFunction* const pFnF1833 = pFnF1833Ref.Get ( );
 
 	UBioAutoConditionals_execF1833_Parms F1833_Parms;
 	F1833_Parms.bioWorld = bioWorld;
@@ -70,10 +66,9 @@ bool UBioAutoConditionals::F1833 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1832 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1832 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1832Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1832", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1832 )
-		pFnF1832 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1832" );
+	UFunction* const pFnF1832 = pFnF1832Ref.Get ( );
 
 	UBioAutoConditionals_execF1832_Parms F1832_Parms;
 	F1832_Parms.bioWorld = bioWorld;
@@ -93,10 +88,9 @@ bool UBioAutoConditionals::F1832 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1831 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1831 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1831Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1831", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1831 )
-		pFnF1831 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1831" );
+	UFunction* const pFnF1831 = pFnF1831Ref.Get ( );
 
 	UBioAutoConditionals_execF1831_Parms F1831_Parms;
 	F1831_Parms.bioWorld = bioWorld;
@@ -116,10 +110,9 @@ bool UBioAutoConditionals::F1831 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1830 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1830 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1830Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1830", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1830 )
-		pFnF1830 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1830" );
+	UFunction* const pFnF1830 = pFnF1830Ref.Get ( );
 
 	UBioAutoConditionals_execF1830_Parms F1830_Parms;
 	F1830_Parms.bioWorld = bioWorld;
@@ -139,10 +132,9 @@ bool UBioAutoConditionals::F1830 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1829 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1829 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1829Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1829", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1829 )
-		pFnF1829 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1829" );
+	UFunction* const pFnF1829 = pFnF1829Ref.Get ( );
 
 	UBioAutoConditionals_execF1829_Parms F1829_Parms;
 	F1829_Parms.bioWorld = bioWorld;
@@ -162,10 +154,9 @@ bool UBioAutoConditionals::F1829 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1828 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1828 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1828Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1828", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1828 )
-		pFnF1828 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1828" );
+	UFunction* const pFnF1828 = pFnF1828Ref.Get ( );
 
 	UBioAutoConditionals_execF1828_Parms F1828_Parms;
 	F1828_Parms.bioWorld = bioWorld;
@@ -185,10 +176,9 @@ bool UBioAutoConditionals::F1828 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1827 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1827 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1827Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1827", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1827 )
-		pFnF1827 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1827" );
+	UFunction* const pFnF1827 = pFnF1827Ref.Get ( );
 
 	UBioAutoConditionals_execF1827_Parms F1827_Parms;
 	F1827_Parms.bioWorld = bioWorld;
@@ -208,10 +198,9 @@ bool UBioAutoConditionals::F1827 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1826 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1826 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1826Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1826", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1826 )
-		pFnF1826 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1826" );
+	UFunction* const pFnF1826 = pFnF1826Ref.Get ( );
 
 	UBioAutoConditionals_execF1826_Parms F1826_Parms;
 	F1826_Parms.bioWorld = bioWorld;
@@ -231,10 +220,9 @@ bool UBioAutoConditionals::F1826 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1825 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1825 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1825Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1825", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1825 )
-		pFnF1825 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1825" );
+	UFunction* const pFnF1825 = pFnF1825Ref.Get ( );
 
 	UBioAutoConditionals_execF1825_Parms F1825_Parms;
 	F1825_Parms.bioWorld = bioWorld;
@@ -254,10 +242,9 @@ bool UBioAutoConditionals::F1825 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1824 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1824 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1824Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1824", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1824 )
-		pFnF1824 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1824" );
+	UFunction* const pFnF1824 = pFnF1824Ref.Get ( );
 
 	UBioAutoConditionals_execF1824_Parms F1824_Parms;
 	F1824_Parms.bioWorld = bioWorld;
@@ -277,10 +264,9 @@ bool UBioAutoConditionals::F1824 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1823 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1823 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1823Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1823", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1823 )
-		pFnF1823 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1823" );
+	UFunction* const pFnF1823 = pFnF1823Ref.Get ( );
 
 	UBioAutoConditionals_execF1823_Parms F1823_Parms;
 	F1823_Parms.bioWorld = bioWorld;
@@ -300,10 +286,9 @@ bool UBioAutoConditionals::F1823 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1822 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1822 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1822Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1822", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1822 )
-		pFnF1822 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1822" );
+	UFunction* const pFnF1822 = pFnF1822Ref.Get ( );
 
 	UBioAutoConditionals_execF1822_Parms F1822_Parms;
 	F1822_Parms.bioWorld = bioWorld;
@@ -323,10 +308,9 @@ bool UBioAutoConditionals::F1822 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1821 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1821 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1821Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1821", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1821 )
-		pFnF1821 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1821" );
+	UFunction* const pFnF1821 = pFnF1821Ref.Get ( );
 
 	UBioAutoConditionals_execF1821_Parms F1821_Parms;
 	F1821_Parms.bioWorld = bioWorld;
@@ -346,10 +330,9 @@ bool UBioAutoConditionals::F1821 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1820 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1820 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1820Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1820", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1820 )
-		pFnF1820 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1820" );
+	UFunction* const pFnF1820 = pFnF1820Ref.Get ( );
 
 	UBioAutoConditionals_execF1820_Parms F1820_Parms;
 	F1820_Parms.bioWorld = bioWorld;
@@ -369,10 +352,9 @@ bool UBioAutoConditionals::F1820 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1819 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1819 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1819Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1819", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1819 )
-		pFnF1819 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1819" );
+	UFunction* const pFnF1819 = pFnF1819Ref.Get ( );
 
 	UBioAutoConditionals_execF1819_Parms F1819_Parms;
 	F1819_Parms.bioWorld = bioWorld;
@@ -392,10 +374,9 @@ bool UBioAutoConditionals::F1819 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1818 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1818 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1818Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1818", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1818 )
-		pFnF1818 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1818" );
+	UFunction* const pFnF1818 = pFnF1818Ref.Get ( );
 
 	UBioAutoConditionals_execF1818_Parms F1818_Parms;
 	F1818_Parms.bioWorld = bioWorld;
@@ -415,10 +396,9 @@ bool UBioAutoConditionals::F1818 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1817 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1817 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1817Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1817", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1817 )
-		pFnF1817 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1817" );
+	UFunction* const pFnF1817 = pFnF1817Ref.Get ( );
 
 	UBioAutoConditionals_execF1817_Parms F1817_Parms;
 	F1817_Parms.bioWorld = bioWorld;
@@ -438,10 +418,9 @@ bool UBioAutoConditionals::F1817 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1816 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1816 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1816Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1816", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1816 )
-		pFnF1816 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1816" );
+	UFunction* const pFnF1816 = pFnF1816Ref.Get ( );
 
 	UBioAutoConditionals_execF1816_Parms F1816_Parms;
 	F1816_Parms.bioWorld = bioWorld;
@@ -461,10 +440,9 @@ bool UBioAutoConditionals::F1816 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1815 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1815 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1815Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1815", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1815 )
-		pFnF1815 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1815" );
+	UFunction* const pFnF1815 = pFnF1815Ref.Get ( );
 
 	UBioAutoConditionals_execF1815_Parms F1815_Parms;
 	F1815_Parms.bioWorld = bioWorld;
@@ -484,10 +462,9 @@ bool UBioAutoConditionals::F1815 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1814 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1814 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1814Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1814", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1814 )
-		pFnF1814 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1814" );
+	UFunction* const pFnF1814 = pFnF1814Ref.Get ( );
 
 	UBioAutoConditionals_execF1814_Parms F1814_Parms;
 	F1814_Parms.bioWorld = bioWorld;
@@ -507,10 +484,9 @@ bool UBioAutoConditionals::F1814 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1813 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1813 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1813Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1813", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1813 )
-		pFnF1813 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1813" );
+	UFunction* const pFnF1813 = pFnF1813Ref.Get ( );
 
 	UBioAutoConditionals_execF1813_Parms F1813_Parms;
 	F1813_Parms.bioWorld = bioWorld;
@@ -530,10 +506,9 @@ bool UBioAutoConditionals::F1813 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1812 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1812 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1812Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1812", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1812 )
-		pFnF1812 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1812" );
+	UFunction* const pFnF1812 = pFnF1812Ref.Get ( );
 
 	UBioAutoConditionals_execF1812_Parms F1812_Parms;
 	F1812_Parms.bioWorld = bioWorld;
@@ -553,10 +528,9 @@ bool UBioAutoConditionals::F1812 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1811 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1811 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1811Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1811", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1811 )
-		pFnF1811 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1811" );
+	UFunction* const pFnF1811 = pFnF1811Ref.Get ( );
 
 	UBioAutoConditionals_execF1811_Parms F1811_Parms;
 	F1811_Parms.bioWorld = bioWorld;
@@ -576,10 +550,9 @@ bool UBioAutoConditionals::F1811 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1810 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1810 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1810Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1810", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1810 )
-		pFnF1810 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1810" );
+	UFunction* const pFnF1810 = pFnF1810Ref.Get ( );
 
 	UBioAutoConditionals_execF1810_Parms F1810_Parms;
 	F1810_Parms.bioWorld = bioWorld;
@@ -599,10 +572,9 @@ bool UBioAutoConditionals::F1810 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1809 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1809 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1809Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1809", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1809 )
-		pFnF1809 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1809" );
+	UFunction* const pFnF1809 = pFnF1809Ref.Get ( );
 
 	UBioAutoConditionals_execF1809_Parms F1809_Parms;
 	F1809_Parms.bioWorld = bioWorld;
@@ -622,10 +594,9 @@ bool UBioAutoConditionals::F1809 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1808 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1808 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1808Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1808", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1808 )
-		pFnF1808 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1808" );
+	UFunction* const pFnF1808 = pFnF1808Ref.Get ( );
 
 	UBioAutoConditionals_execF1808_Parms F1808_Parms;
 	F1808_Parms.bioWorld = bioWorld;
@@ -645,10 +616,9 @@ bool UBioAutoConditionals::F1808 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1807 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1807 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1807Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1807", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1807 )
-		pFnF1807 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1807" );
+	UFunction* const pFnF1807 = pFnF1807Ref.Get ( );
 
 	UBioAutoConditionals_execF1807_Parms F1807_Parms;
 	F1807_Parms.bioWorld = bioWorld;
@@ -668,10 +638,9 @@ bool UBioAutoConditionals::F1807 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1806 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1806 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1806Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1806", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1806 )
-		pFnF1806 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1806" );
+	UFunction* const pFnF1806 = pFnF1806Ref.Get ( );
 
 	UBioAutoConditionals_execF1806_Parms F1806_Parms;
 	F1806_Parms.bioWorld = bioWorld;
@@ -691,10 +660,9 @@ bool UBioAutoConditionals::F1806 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1805 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1805 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1805Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1805", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1805 )
-		pFnF1805 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1805" );
+	UFunction* const pFnF1805 = pFnF1805Ref.Get ( );
 
 	UBioAutoConditionals_execF1805_Parms F1805_Parms;
 	F1805_Parms.bioWorld = bioWorld;
@@ -714,10 +682,9 @@ bool UBioAutoConditionals::F1805 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1804 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1804 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1804Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1804", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1804 )
-		pFnF1804 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1804" );
+	UFunction* const pFnF1804 = pFnF1804Ref.Get ( );
 
 	UBioAutoConditionals_execF1804_Parms F1804_Parms;
 	F1804_Parms.bioWorld = bioWorld;
@@ -737,10 +704,9 @@ bool UBioAutoConditionals::F1804 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1803 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1803 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1803Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1803", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1803 )
-		pFnF1803 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1803" );
+	UFunction* const pFnF1803 = pFnF1803Ref.Get ( );
 
 	UBioAutoConditionals_execF1803_Parms F1803_Parms;
 	F1803_Parms.bioWorld = bioWorld;
@@ -760,10 +726,9 @@ bool UBioAutoConditionals::F1803 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1802 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1802 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1802Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1802", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1802 )
-		pFnF1802 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1802" );
+	UFunction* const pFnF1802 = pFnF1802Ref.Get ( );
 
 	UBioAutoConditionals_execF1802_Parms F1802_Parms;
 	F1802_Parms.bioWorld = bioWorld;
@@ -783,10 +748,9 @@ bool UBioAutoConditionals::F1802 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1801 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1801 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1801Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1801", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1801 )
-		pFnF1801 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1801" );
+	UFunction* const pFnF1801 = pFnF1801Ref.Get ( );
 
 	UBioAutoConditionals_execF1801_Parms F1801_Parms;
 	F1801_Parms.bioWorld = bioWorld;
@@ -806,10 +770,9 @@ bool UBioAutoConditionals::F1801 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1800 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1800 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1800Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1800", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1800 )
-		pFnF1800 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1800" );
+	UFunction* const pFnF1800 = pFnF1800Ref.Get ( );
 
 	UBioAutoConditionals_execF1800_Parms F1800_Parms;
 	F1800_Parms.bioWorld = bioWorld;
@@ -829,10 +792,9 @@ bool UBioAutoConditionals::F1800 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1789 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1789 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1789Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1789", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1789 )
-		pFnF1789 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1789" );
+	UFunction* const pFnF1789 = pFnF1789Ref.Get ( );
 
 	UBioAutoConditionals_execF1789_Parms F1789_Parms;
 	F1789_Parms.bioWorld = bioWorld;
@@ -852,10 +814,9 @@ bool UBioAutoConditionals::F1789 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1788 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1788 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1788Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1788", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1788 )
-		pFnF1788 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1788" );
+	UFunction* const pFnF1788 = pFnF1788Ref.Get ( );
 
 	UBioAutoConditionals_execF1788_Parms F1788_Parms;
 	F1788_Parms.bioWorld = bioWorld;
@@ -875,10 +836,9 @@ bool UBioAutoConditionals::F1788 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1838 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1838 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1838Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1838", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1838 )
-		pFnF1838 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1838" );
+	UFunction* const pFnF1838 = pFnF1838Ref.Get ( );
 
 	UBioAutoConditionals_execF1838_Parms F1838_Parms;
 	F1838_Parms.bioWorld = bioWorld;
@@ -898,10 +858,9 @@ bool UBioAutoConditionals::F1838 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1799 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1799 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1799Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1799", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1799 )
-		pFnF1799 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1799" );
+	UFunction* const pFnF1799 = pFnF1799Ref.Get ( );
 
 	UBioAutoConditionals_execF1799_Parms F1799_Parms;
 	F1799_Parms.bioWorld = bioWorld;
@@ -921,10 +880,9 @@ bool UBioAutoConditionals::F1799 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1798 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1798 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1798Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1798", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1798 )
-		pFnF1798 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1798" );
+	UFunction* const pFnF1798 = pFnF1798Ref.Get ( );
 
 	UBioAutoConditionals_execF1798_Parms F1798_Parms;
 	F1798_Parms.bioWorld = bioWorld;
@@ -944,10 +902,9 @@ bool UBioAutoConditionals::F1798 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1797 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1797 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1797Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1797", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1797 )
-		pFnF1797 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1797" );
+	UFunction* const pFnF1797 = pFnF1797Ref.Get ( );
 
 	UBioAutoConditionals_execF1797_Parms F1797_Parms;
 	F1797_Parms.bioWorld = bioWorld;
@@ -967,10 +924,9 @@ bool UBioAutoConditionals::F1797 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1796 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1796 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1796Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1796", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1796 )
-		pFnF1796 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1796" );
+	UFunction* const pFnF1796 = pFnF1796Ref.Get ( );
 
 	UBioAutoConditionals_execF1796_Parms F1796_Parms;
 	F1796_Parms.bioWorld = bioWorld;
@@ -990,10 +946,9 @@ bool UBioAutoConditionals::F1796 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1795 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1795 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1795Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1795", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1795 )
-		pFnF1795 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1795" );
+	UFunction* const pFnF1795 = pFnF1795Ref.Get ( );
 
 	UBioAutoConditionals_execF1795_Parms F1795_Parms;
 	F1795_Parms.bioWorld = bioWorld;
@@ -1013,10 +968,9 @@ bool UBioAutoConditionals::F1795 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1794 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1794 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1794Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1794", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1794 )
-		pFnF1794 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1794" );
+	UFunction* const pFnF1794 = pFnF1794Ref.Get ( );
 
 	UBioAutoConditionals_execF1794_Parms F1794_Parms;
 	F1794_Parms.bioWorld = bioWorld;
@@ -1036,10 +990,9 @@ bool UBioAutoConditionals::F1794 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1793 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1793 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1793Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1793", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1793 )
-		pFnF1793 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1793" );
+	UFunction* const pFnF1793 = pFnF1793Ref.Get ( );
 
 	UBioAutoConditionals_execF1793_Parms F1793_Parms;
 	F1793_Parms.bioWorld = bioWorld;
@@ -1059,10 +1012,9 @@ bool UBioAutoConditionals::F1793 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1787 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1787 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1787Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1787", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1787 )
-		pFnF1787 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1787" );
+	UFunction* const pFnF1787 = pFnF1787Ref.Get ( );
 
 	UBioAutoConditionals_execF1787_Parms F1787_Parms;
 	F1787_Parms.bioWorld = bioWorld;
@@ -1082,10 +1034,9 @@ bool UBioAutoConditionals::F1787 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1755 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1755 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1755Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1755", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1755 )
-		pFnF1755 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1755" );
+	UFunction* const pFnF1755 = pFnF1755Ref.Get ( );
 
 	UBioAutoConditionals_execF1755_Parms F1755_Parms;
 	F1755_Parms.bioWorld = bioWorld;
@@ -1105,10 +1056,9 @@ bool UBioAutoConditionals::F1755 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1763 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1763 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1763Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1763", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1763 )
-		pFnF1763 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1763" );
+	UFunction* const pFnF1763 = pFnF1763Ref.Get ( );
 
 	UBioAutoConditionals_execF1763_Parms F1763_Parms;
 	F1763_Parms.bioWorld = bioWorld;
@@ -1128,10 +1078,9 @@ bool UBioAutoConditionals::F1763 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1837 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1837 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1837Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1837", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1837 )
-		pFnF1837 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1837" );
+	UFunction* const pFnF1837 = pFnF1837Ref.Get ( );
 
 	UBioAutoConditionals_execF1837_Parms F1837_Parms;
 	F1837_Parms.bioWorld = bioWorld;
@@ -1151,10 +1100,9 @@ bool UBioAutoConditionals::F1837 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1836 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1836 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1836Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1836", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1836 )
-		pFnF1836 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1836" );
+	UFunction* const pFnF1836 = pFnF1836Ref.Get ( );
 
 	UBioAutoConditionals_execF1836_Parms F1836_Parms;
 	F1836_Parms.bioWorld = bioWorld;
@@ -1174,10 +1122,9 @@ bool UBioAutoConditionals::F1836 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1835 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1835 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1835Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1835", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1835 )
-		pFnF1835 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1835" );
+	UFunction* const pFnF1835 = pFnF1835Ref.Get ( );
 
 	UBioAutoConditionals_execF1835_Parms F1835_Parms;
 	F1835_Parms.bioWorld = bioWorld;
@@ -1197,10 +1144,9 @@ bool UBioAutoConditionals::F1835 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1834 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1834 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1834Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1834", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1834 )
-		pFnF1834 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1834" );
+	UFunction* const pFnF1834 = pFnF1834Ref.Get ( );
 
 	UBioAutoConditionals_execF1834_Parms F1834_Parms;
 	F1834_Parms.bioWorld = bioWorld;
@@ -1220,10 +1166,9 @@ bool UBioAutoConditionals::F1834 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1735 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1735 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1735Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1735", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1735 )
-		pFnF1735 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1735" );
+	UFunction* const pFnF1735 = pFnF1735Ref.Get ( );
 
 	UBioAutoConditionals_execF1735_Parms F1735_Parms;
 	F1735_Parms.bioWorld = bioWorld;
@@ -1243,10 +1188,9 @@ bool UBioAutoConditionals::F1735 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1734 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1734 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1734Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1734", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1734 )
-		pFnF1734 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1734" );
+	UFunction* const pFnF1734 = pFnF1734Ref.Get ( );
 
 	UBioAutoConditionals_execF1734_Parms F1734_Parms;
 	F1734_Parms.bioWorld = bioWorld;
@@ -1266,10 +1210,9 @@ bool UBioAutoConditionals::F1734 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1733 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1733 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1733Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1733", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1733 )
-		pFnF1733 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1733" );
+	UFunction* const pFnF1733 = pFnF1733Ref.Get ( );
 
 	UBioAutoConditionals_execF1733_Parms F1733_Parms;
 	F1733_Parms.bioWorld = bioWorld;
@@ -1289,10 +1232,9 @@ bool UBioAutoConditionals::F1733 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1731 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1731 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1731Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1731", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1731 )
-		pFnF1731 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1731" );
+	UFunction* const pFnF1731 = pFnF1731Ref.Get ( );
 
 	UBioAutoConditionals_execF1731_Parms F1731_Parms;
 	F1731_Parms.bioWorld = bioWorld;
@@ -1312,10 +1254,9 @@ bool UBioAutoConditionals::F1731 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1730 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1730 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1730Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1730", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1730 )
-		pFnF1730 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1730" );
+	UFunction* const pFnF1730 = pFnF1730Ref.Get ( );
 
 	UBioAutoConditionals_execF1730_Parms F1730_Parms;
 	F1730_Parms.bioWorld = bioWorld;
@@ -1335,10 +1276,9 @@ bool UBioAutoConditionals::F1730 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1855 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1855 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1855Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1855", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1855 )
-		pFnF1855 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1855" );
+	UFunction* const pFnF1855 = pFnF1855Ref.Get ( );
 
 	UBioAutoConditionals_execF1855_Parms F1855_Parms;
 	F1855_Parms.bioWorld = bioWorld;
@@ -1358,10 +1298,9 @@ bool UBioAutoConditionals::F1855 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1852 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1852 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1852Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1852", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1852 )
-		pFnF1852 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1852" );
+	UFunction* const pFnF1852 = pFnF1852Ref.Get ( );
 
 	UBioAutoConditionals_execF1852_Parms F1852_Parms;
 	F1852_Parms.bioWorld = bioWorld;
@@ -1381,10 +1320,9 @@ bool UBioAutoConditionals::F1852 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1792 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1792 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1792Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1792", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1792 )
-		pFnF1792 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1792" );
+	UFunction* const pFnF1792 = pFnF1792Ref.Get ( );
 
 	UBioAutoConditionals_execF1792_Parms F1792_Parms;
 	F1792_Parms.bioWorld = bioWorld;
@@ -1404,10 +1342,9 @@ bool UBioAutoConditionals::F1792 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1724 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1724 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1724Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1724", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1724 )
-		pFnF1724 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1724" );
+	UFunction* const pFnF1724 = pFnF1724Ref.Get ( );
 
 	UBioAutoConditionals_execF1724_Parms F1724_Parms;
 	F1724_Parms.bioWorld = bioWorld;
@@ -1427,10 +1364,9 @@ bool UBioAutoConditionals::F1724 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1723 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1723 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1723Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1723", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1723 )
-		pFnF1723 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1723" );
+	UFunction* const pFnF1723 = pFnF1723Ref.Get ( );
 
 	UBioAutoConditionals_execF1723_Parms F1723_Parms;
 	F1723_Parms.bioWorld = bioWorld;
@@ -1450,10 +1386,9 @@ bool UBioAutoConditionals::F1723 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1712 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1712 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1712Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1712", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1712 )
-		pFnF1712 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1712" );
+	UFunction* const pFnF1712 = pFnF1712Ref.Get ( );
 
 	UBioAutoConditionals_execF1712_Parms F1712_Parms;
 	F1712_Parms.bioWorld = bioWorld;
@@ -1473,10 +1408,9 @@ bool UBioAutoConditionals::F1712 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1756 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1756 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1756Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1756", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1756 )
-		pFnF1756 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1756" );
+	UFunction* const pFnF1756 = pFnF1756Ref.Get ( );
 
 	UBioAutoConditionals_execF1756_Parms F1756_Parms;
 	F1756_Parms.bioWorld = bioWorld;
@@ -1496,10 +1430,9 @@ bool UBioAutoConditionals::F1756 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1732 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1732 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1732Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1732", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1732 )
-		pFnF1732 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1732" );
+	UFunction* const pFnF1732 = pFnF1732Ref.Get ( );
 
 	UBioAutoConditionals_execF1732_Parms F1732_Parms;
 	F1732_Parms.bioWorld = bioWorld;
@@ -1519,10 +1452,9 @@ bool UBioAutoConditionals::F1732 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1729 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1729 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1729Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1729", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1729 )
-		pFnF1729 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1729" );
+	UFunction* const pFnF1729 = pFnF1729Ref.Get ( );
 
 	UBioAutoConditionals_execF1729_Parms F1729_Parms;
 	F1729_Parms.bioWorld = bioWorld;
@@ -1542,10 +1474,9 @@ bool UBioAutoConditionals::F1729 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1728 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1728 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1728Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1728", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1728 )
-		pFnF1728 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1728" );
+	UFunction* const pFnF1728 = pFnF1728Ref.Get ( );
 
 	UBioAutoConditionals_execF1728_Parms F1728_Parms;
 	F1728_Parms.bioWorld = bioWorld;
@@ -1565,10 +1496,9 @@ bool UBioAutoConditionals::F1728 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1727 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1727 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1727Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1727", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1727 )
-		pFnF1727 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1727" );
+	UFunction* const pFnF1727 = pFnF1727Ref.Get ( );
 
 	UBioAutoConditionals_execF1727_Parms F1727_Parms;
 	F1727_Parms.bioWorld = bioWorld;
@@ -1588,10 +1518,9 @@ bool UBioAutoConditionals::F1727 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1678 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1678 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1678Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1678", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1678 )
-		pFnF1678 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1678" );
+	UFunction* const pFnF1678 = pFnF1678Ref.Get ( );
 
 	UBioAutoConditionals_execF1678_Parms F1678_Parms;
 	F1678_Parms.bioWorld = bioWorld;
@@ -1611,10 +1540,9 @@ bool UBioAutoConditionals::F1678 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1664 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1664 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1664Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1664", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1664 )
-		pFnF1664 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1664" );
+	UFunction* const pFnF1664 = pFnF1664Ref.Get ( );
 
 	UBioAutoConditionals_execF1664_Parms F1664_Parms;
 	F1664_Parms.bioWorld = bioWorld;
@@ -1634,10 +1562,9 @@ bool UBioAutoConditionals::F1664 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1637 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1637 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1637Ref { L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1637", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1637 )
-		pFnF1637 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1637" );
+	UFunction* const pFnF1637 = pFnF1637Ref.Get ( );
 
 	UBioAutoConditionals_execF1637_Parms F1637_Parms;
 	F1637_Parms.bioWorld = bioWorld;
@@ -1650,6 +1577,91 @@ bool UBioAutoConditionals::F1637 ( class ABioWorldInfo* bioWorld, int Argument )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class PlotManagerDLC_HEN_MT.BioAutoConditionals",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1833",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1832",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1831",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1830",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1829",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1828",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1827",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1826",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1825",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1824",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1823",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1822",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1821",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1820",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1819",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1818",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1817",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1816",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1815",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1814",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1813",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1812",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1811",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1810",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1809",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1808",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1807",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1806",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1805",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1804",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1803",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1802",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1801",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1800",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1789",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1788",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1838",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1799",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1798",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1797",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1796",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1795",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1794",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1793",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1787",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1755",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1763",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1837",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1836",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1835",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1834",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1735",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1734",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1733",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1731",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1730",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1855",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1852",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1792",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1724",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1723",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1712",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1756",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1732",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1729",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1728",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1727",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1678",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1664",
+	L"Function PlotManagerDLC_HEN_MT.BioAutoConditionals.F1637",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioAutoConditionals::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioAutoConditionals::pClassPointer { L"Class PlotManagerDLC_HEN_VT.BioAutoConditionals", &UObject::FindClass };
 
 class UClass* UBioAutoConditionals::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class PlotManagerDLC_HEN_VT.BioAutoConditionals" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1666
@@ -47,10 +44,9 @@ class UClass* UBioAutoConditionals::StaticClass()
 
 bool UBioAutoConditionals::F1666 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1666 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1666Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1666", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1666 )
-		pFnF1666 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1666" );
+	UFunction* const pFnF1666 = pFnF1666Ref.Get ( );
 
 	UBioAutoConditionals_execF1666_Parms F1666_Parms;
 	F1666_Parms.bioWorld = bioWorld;
@@ -70,10 +66,9 @@ bool UBioAutoConditionals::F1666 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1665 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1665 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1665Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1665", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1665 )
-		pFnF1665 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1665" );
+	UFunction* const pFnF1665 = pFnF1665Ref.Get ( );
 
 	UBioAutoConditionals_execF1665_Parms F1665_Parms;
 	F1665_Parms.bioWorld = bioWorld;
@@ -93,10 +88,9 @@ bool UBioAutoConditionals::F1665 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1656 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1656 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1656Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1656", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1656 )
-		pFnF1656 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1656" );
+	UFunction* const pFnF1656 = pFnF1656Ref.Get ( );
 
 	UBioAutoConditionals_execF1656_Parms F1656_Parms;
 	F1656_Parms.bioWorld = bioWorld;
@@ -116,10 +110,9 @@ bool UBioAutoConditionals::F1656 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1655 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1655 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1655Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1655", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1655 )
-		pFnF1655 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1655" );
+	UFunction* const pFnF1655 = pFnF1655Ref.Get ( );
 
 	UBioAutoConditionals_execF1655_Parms F1655_Parms;
 	F1655_Parms.bioWorld = bioWorld;
@@ -139,10 +132,9 @@ bool UBioAutoConditionals::F1655 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1650 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1650 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1650Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1650", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1650 )
-		pFnF1650 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1650" );
+	UFunction* const pFnF1650 = pFnF1650Ref.Get ( );
 
 	UBioAutoConditionals_execF1650_Parms F1650_Parms;
 	F1650_Parms.bioWorld = bioWorld;
@@ -162,10 +154,9 @@ bool UBioAutoConditionals::F1650 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1649 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1649 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1649Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1649", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1649 )
-		pFnF1649 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1649" );
+	UFunction* const pFnF1649 = pFnF1649Ref.Get ( );
 
 	UBioAutoConditionals_execF1649_Parms F1649_Parms;
 	F1649_Parms.bioWorld = bioWorld;
@@ -185,10 +176,9 @@ bool UBioAutoConditionals::F1649 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1648 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1648 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1648Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1648", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1648 )
-		pFnF1648 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1648" );
+	UFunction* const pFnF1648 = pFnF1648Ref.Get ( );
 
 	UBioAutoConditionals_execF1648_Parms F1648_Parms;
 	F1648_Parms.bioWorld = bioWorld;
@@ -208,10 +198,9 @@ bool UBioAutoConditionals::F1648 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1647 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1647 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1647Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1647", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1647 )
-		pFnF1647 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1647" );
+	UFunction* const pFnF1647 = pFnF1647Ref.Get ( );
 
 	UBioAutoConditionals_execF1647_Parms F1647_Parms;
 	F1647_Parms.bioWorld = bioWorld;
@@ -231,10 +220,9 @@ bool UBioAutoConditionals::F1647 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1646 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1646 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1646Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1646", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1646 )
-		pFnF1646 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1646" );
+	UFunction* const pFnF1646 = pFnF1646Ref.Get ( );
 
 	UBioAutoConditionals_execF1646_Parms F1646_Parms;
 	F1646_Parms.bioWorld = bioWorld;
@@ -254,10 +242,9 @@ bool UBioAutoConditionals::F1646 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1645 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1645 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1645Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1645", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1645 )
-		pFnF1645 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1645" );
+	UFunction* const pFnF1645 = pFnF1645Ref.Get ( );
 
 	UBioAutoConditionals_execF1645_Parms F1645_Parms;
 	F1645_Parms.bioWorld = bioWorld;
@@ -277,10 +264,9 @@ bool UBioAutoConditionals::F1645 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1644 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1644 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1644Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1644", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1644 )
-		pFnF1644 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1644" );
+	UFunction* const pFnF1644 = pFnF1644Ref.Get ( );
 
 	UBioAutoConditionals_execF1644_Parms F1644_Parms;
 	F1644_Parms.bioWorld = bioWorld;
@@ -300,10 +286,9 @@ bool UBioAutoConditionals::F1644 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1643 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1643 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1643Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1643", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1643 )
-		pFnF1643 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1643" );
+	UFunction* const pFnF1643 = pFnF1643Ref.Get ( );
 
 	UBioAutoConditionals_execF1643_Parms F1643_Parms;
 	F1643_Parms.bioWorld = bioWorld;
@@ -323,10 +308,9 @@ bool UBioAutoConditionals::F1643 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1654 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1654 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1654Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1654", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1654 )
-		pFnF1654 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1654" );
+	UFunction* const pFnF1654 = pFnF1654Ref.Get ( );
 
 	UBioAutoConditionals_execF1654_Parms F1654_Parms;
 	F1654_Parms.bioWorld = bioWorld;
@@ -346,10 +330,9 @@ bool UBioAutoConditionals::F1654 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1653 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1653 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1653Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1653", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1653 )
-		pFnF1653 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1653" );
+	UFunction* const pFnF1653 = pFnF1653Ref.Get ( );
 
 	UBioAutoConditionals_execF1653_Parms F1653_Parms;
 	F1653_Parms.bioWorld = bioWorld;
@@ -369,10 +352,9 @@ bool UBioAutoConditionals::F1653 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1652 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1652 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1652Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1652", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1652 )
-		pFnF1652 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1652" );
+	UFunction* const pFnF1652 = pFnF1652Ref.Get ( );
 
 	UBioAutoConditionals_execF1652_Parms F1652_Parms;
 	F1652_Parms.bioWorld = bioWorld;
@@ -392,10 +374,9 @@ bool UBioAutoConditionals::F1652 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1651 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1651 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1651Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1651", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1651 )
-		pFnF1651 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1651" );
+	UFunction* const pFnF1651 = pFnF1651Ref.Get ( );
 
 	UBioAutoConditionals_execF1651_Parms F1651_Parms;
 	F1651_Parms.bioWorld = bioWorld;
@@ -415,10 +396,9 @@ bool UBioAutoConditionals::F1651 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1639 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1639 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1639Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1639", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1639 )
-		pFnF1639 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1639" );
+	UFunction* const pFnF1639 = pFnF1639Ref.Get ( );
 
 	UBioAutoConditionals_execF1639_Parms F1639_Parms;
 	F1639_Parms.bioWorld = bioWorld;
@@ -438,10 +418,9 @@ bool UBioAutoConditionals::F1639 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1492 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1492 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1492Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1492", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1492 )
-		pFnF1492 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1492" );
+	UFunction* const pFnF1492 = pFnF1492Ref.Get ( );
 
 	UBioAutoConditionals_execF1492_Parms F1492_Parms;
 	F1492_Parms.bioWorld = bioWorld;
@@ -461,10 +440,9 @@ bool UBioAutoConditionals::F1492 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1690 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1690 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1690Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1690", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1690 )
-		pFnF1690 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1690" );
+	UFunction* const pFnF1690 = pFnF1690Ref.Get ( );
 
 	UBioAutoConditionals_execF1690_Parms F1690_Parms;
 	F1690_Parms.bioWorld = bioWorld;
@@ -484,10 +462,9 @@ bool UBioAutoConditionals::F1690 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1616 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1616 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1616Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1616", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1616 )
-		pFnF1616 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1616" );
+	UFunction* const pFnF1616 = pFnF1616Ref.Get ( );
 
 	UBioAutoConditionals_execF1616_Parms F1616_Parms;
 	F1616_Parms.bioWorld = bioWorld;
@@ -507,10 +484,9 @@ bool UBioAutoConditionals::F1616 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1578 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1578 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1578Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1578", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1578 )
-		pFnF1578 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1578" );
+	UFunction* const pFnF1578 = pFnF1578Ref.Get ( );
 
 	UBioAutoConditionals_execF1578_Parms F1578_Parms;
 	F1578_Parms.bioWorld = bioWorld;
@@ -530,10 +506,9 @@ bool UBioAutoConditionals::F1578 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1575 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1575 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1575Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1575", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1575 )
-		pFnF1575 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1575" );
+	UFunction* const pFnF1575 = pFnF1575Ref.Get ( );
 
 	UBioAutoConditionals_execF1575_Parms F1575_Parms;
 	F1575_Parms.bioWorld = bioWorld;
@@ -553,10 +528,9 @@ bool UBioAutoConditionals::F1575 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1554 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1554 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1554Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1554", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1554 )
-		pFnF1554 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1554" );
+	UFunction* const pFnF1554 = pFnF1554Ref.Get ( );
 
 	UBioAutoConditionals_execF1554_Parms F1554_Parms;
 	F1554_Parms.bioWorld = bioWorld;
@@ -576,10 +550,9 @@ bool UBioAutoConditionals::F1554 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1676 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1676 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1676Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1676", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1676 )
-		pFnF1676 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1676" );
+	UFunction* const pFnF1676 = pFnF1676Ref.Get ( );
 
 	UBioAutoConditionals_execF1676_Parms F1676_Parms;
 	F1676_Parms.bioWorld = bioWorld;
@@ -599,10 +572,9 @@ bool UBioAutoConditionals::F1676 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1640 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1640 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1640Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1640", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1640 )
-		pFnF1640 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1640" );
+	UFunction* const pFnF1640 = pFnF1640Ref.Get ( );
 
 	UBioAutoConditionals_execF1640_Parms F1640_Parms;
 	F1640_Parms.bioWorld = bioWorld;
@@ -622,10 +594,9 @@ bool UBioAutoConditionals::F1640 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1552 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1552 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1552Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1552", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1552 )
-		pFnF1552 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1552" );
+	UFunction* const pFnF1552 = pFnF1552Ref.Get ( );
 
 	UBioAutoConditionals_execF1552_Parms F1552_Parms;
 	F1552_Parms.bioWorld = bioWorld;
@@ -645,10 +616,9 @@ bool UBioAutoConditionals::F1552 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1494 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1494 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1494Ref { L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1494", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1494 )
-		pFnF1494 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1494" );
+	UFunction* const pFnF1494 = pFnF1494Ref.Get ( );
 
 	UBioAutoConditionals_execF1494_Parms F1494_Parms;
 	F1494_Parms.bioWorld = bioWorld;
@@ -661,6 +631,48 @@ bool UBioAutoConditionals::F1494 ( class ABioWorldInfo* bioWorld, int Argument )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class PlotManagerDLC_HEN_VT.BioAutoConditionals",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1666",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1665",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1656",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1655",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1650",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1649",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1648",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1647",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1646",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1645",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1644",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1643",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1654",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1653",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1652",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1651",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1639",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1492",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1690",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1616",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1578",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1575",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1554",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1676",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1640",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1552",
+	L"Function PlotManagerDLC_HEN_VT.BioAutoConditionals.F1494",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioAutoConditionals::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioAutoConditionals::pClassPointer { L"Class PlotManagerDLC_UNC_Hammer01.BioAutoConditionals", &UObject::FindClass };
 
 class UClass* UBioAutoConditionals::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class PlotManagerDLC_UNC_Hammer01.BioAutoConditionals" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1677
@@ -47,10 +44,9 @@ class UClass* UBioAutoConditionals::StaticClass()
 
 bool UBioAutoConditionals::F1677 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1677 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1677Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1677", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1677 )
-		pFnF1677 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1677" );
+	UFunction* const pFnF1677 = pFnF1677Ref.Get ( );
 
 	UBioAutoConditionals_execF1677_Parms F1677_Parms;
 	F1677_Parms.bioWorld = bioWorld;
@@ -70,10 +66,9 @@ bool UBioAutoConditionals::F1677 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1675 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1675 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1675Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1675", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1675 )
-		pFnF1675 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1675" );
+	UFunction* const pFnF1675 = pFnF1675Ref.Get ( );
 
 	UBioAutoConditionals_execF1675_Parms F1675_Parms;
 	F1675_Parms.bioWorld = bioWorld;
@@ -93,10 +88,9 @@ bool UBioAutoConditionals::F1675 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1674 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1674 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1674Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1674", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1674 )
-		pFnF1674 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1674" );
+	UFunction* const pFnF1674 = pFnF1674Ref.Get ( );
 
 	UBioAutoConditionals_execF1674_Parms F1674_Parms;
 	F1674_Parms.bioWorld = bioWorld;
@@ -116,10 +110,9 @@ bool UBioAutoConditionals::F1674 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1673 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1673 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1673Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1673", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1673 )
-		pFnF1673 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1673" );
+	UFunction* const pFnF1673 = pFnF1673Ref.Get ( );
 
 	UBioAutoConditionals_execF1673_Parms F1673_Parms;
 	F1673_Parms.bioWorld = bioWorld;
@@ -139,10 +132,9 @@ bool UBioAutoConditionals::F1673 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1672 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1672 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1672Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1672", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1672 )
-		pFnF1672 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1672" );
+	UFunction* const pFnF1672 = pFnF1672Ref.Get ( );
 
 	UBioAutoConditionals_execF1672_Parms F1672_Parms;
 	F1672_Parms.bioWorld = bioWorld;
@@ -162,10 +154,9 @@ bool UBioAutoConditionals::F1672 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1671 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1671 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1671Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1671", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1671 )
-		pFnF1671 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1671" );
+	UFunction* const pFnF1671 = pFnF1671Ref.Get ( );
 
 	UBioAutoConditionals_execF1671_Parms F1671_Parms;
 	F1671_Parms.bioWorld = bioWorld;
@@ -185,10 +176,9 @@ bool UBioAutoConditionals::F1671 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1670 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1670 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1670Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1670", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1670 )
-		pFnF1670 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1670" );
+	UFunction* const pFnF1670 = pFnF1670Ref.Get ( );
 
 	UBioAutoConditionals_execF1670_Parms F1670_Parms;
 	F1670_Parms.bioWorld = bioWorld;
@@ -208,10 +198,9 @@ bool UBioAutoConditionals::F1670 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1636 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1636 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1636Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1636", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1636 )
-		pFnF1636 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1636" );
+	UFunction* const pFnF1636 = pFnF1636Ref.Get ( );
 
 	UBioAutoConditionals_execF1636_Parms F1636_Parms;
 	F1636_Parms.bioWorld = bioWorld;
@@ -231,10 +220,9 @@ bool UBioAutoConditionals::F1636 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1700 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1700 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1700Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1700", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1700 )
-		pFnF1700 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1700" );
+	UFunction* const pFnF1700 = pFnF1700Ref.Get ( );
 
 	UBioAutoConditionals_execF1700_Parms F1700_Parms;
 	F1700_Parms.bioWorld = bioWorld;
@@ -254,10 +242,9 @@ bool UBioAutoConditionals::F1700 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1699 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1699 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1699Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1699", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1699 )
-		pFnF1699 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1699" );
+	UFunction* const pFnF1699 = pFnF1699Ref.Get ( );
 
 	UBioAutoConditionals_execF1699_Parms F1699_Parms;
 	F1699_Parms.bioWorld = bioWorld;
@@ -277,10 +264,9 @@ bool UBioAutoConditionals::F1699 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1698 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1698 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1698Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1698", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1698 )
-		pFnF1698 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1698" );
+	UFunction* const pFnF1698 = pFnF1698Ref.Get ( );
 
 	UBioAutoConditionals_execF1698_Parms F1698_Parms;
 	F1698_Parms.bioWorld = bioWorld;
@@ -300,10 +286,9 @@ bool UBioAutoConditionals::F1698 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1697 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1697 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1697Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1697", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1697 )
-		pFnF1697 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1697" );
+	UFunction* const pFnF1697 = pFnF1697Ref.Get ( );
 
 	UBioAutoConditionals_execF1697_Parms F1697_Parms;
 	F1697_Parms.bioWorld = bioWorld;
@@ -323,10 +308,9 @@ bool UBioAutoConditionals::F1697 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1696 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1696 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1696Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1696", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1696 )
-		pFnF1696 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1696" );
+	UFunction* const pFnF1696 = pFnF1696Ref.Get ( );
 
 	UBioAutoConditionals_execF1696_Parms F1696_Parms;
 	F1696_Parms.bioWorld = bioWorld;
@@ -346,10 +330,9 @@ bool UBioAutoConditionals::F1696 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1695 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1695 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1695Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1695", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1695 )
-		pFnF1695 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1695" );
+	UFunction* const pFnF1695 = pFnF1695Ref.Get ( );
 
 	UBioAutoConditionals_execF1695_Parms F1695_Parms;
 	F1695_Parms.bioWorld = bioWorld;
@@ -369,10 +352,9 @@ bool UBioAutoConditionals::F1695 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1694 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1694 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1694Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1694", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1694 )
-		pFnF1694 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1694" );
+	UFunction* const pFnF1694 = pFnF1694Ref.Get ( );
 
 	UBioAutoConditionals_execF1694_Parms F1694_Parms;
 	F1694_Parms.bioWorld = bioWorld;
@@ -392,10 +374,9 @@ bool UBioAutoConditionals::F1694 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1693 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1693 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1693Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1693", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1693 )
-		pFnF1693 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1693" );
+	UFunction* const pFnF1693 = pFnF1693Ref.Get ( );
 
 	UBioAutoConditionals_execF1693_Parms F1693_Parms;
 	F1693_Parms.bioWorld = bioWorld;
@@ -415,10 +396,9 @@ bool UBioAutoConditionals::F1693 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1692 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1692 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1692Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1692", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1692 )
-		pFnF1692 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1692" );
+	UFunction* const pFnF1692 = pFnF1692Ref.Get ( );
 
 	UBioAutoConditionals_execF1692_Parms F1692_Parms;
 	F1692_Parms.bioWorld = bioWorld;
@@ -438,10 +418,9 @@ bool UBioAutoConditionals::F1692 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1691 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1691 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1691Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1691", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1691 )
-		pFnF1691 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1691" );
+	UFunction* const pFnF1691 = pFnF1691Ref.Get ( );
 
 	UBioAutoConditionals_execF1691_Parms F1691_Parms;
 	F1691_Parms.bioWorld = bioWorld;
@@ -461,10 +440,9 @@ bool UBioAutoConditionals::F1691 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1568 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1568 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1568Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1568", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1568 )
-		pFnF1568 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1568" );
+	UFunction* const pFnF1568 = pFnF1568Ref.Get ( );
 
 	UBioAutoConditionals_execF1568_Parms F1568_Parms;
 	F1568_Parms.bioWorld = bioWorld;
@@ -484,10 +462,9 @@ bool UBioAutoConditionals::F1568 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1567 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1567 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1567Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1567", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1567 )
-		pFnF1567 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1567" );
+	UFunction* const pFnF1567 = pFnF1567Ref.Get ( );
 
 	UBioAutoConditionals_execF1567_Parms F1567_Parms;
 	F1567_Parms.bioWorld = bioWorld;
@@ -507,10 +484,9 @@ bool UBioAutoConditionals::F1567 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1566 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1566 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1566Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1566", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1566 )
-		pFnF1566 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1566" );
+	UFunction* const pFnF1566 = pFnF1566Ref.Get ( );
 
 	UBioAutoConditionals_execF1566_Parms F1566_Parms;
 	F1566_Parms.bioWorld = bioWorld;
@@ -530,10 +506,9 @@ bool UBioAutoConditionals::F1566 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1565 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1565 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1565Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1565", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1565 )
-		pFnF1565 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1565" );
+	UFunction* const pFnF1565 = pFnF1565Ref.Get ( );
 
 	UBioAutoConditionals_execF1565_Parms F1565_Parms;
 	F1565_Parms.bioWorld = bioWorld;
@@ -553,10 +528,9 @@ bool UBioAutoConditionals::F1565 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1564 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1564 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1564Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1564", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1564 )
-		pFnF1564 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1564" );
+	UFunction* const pFnF1564 = pFnF1564Ref.Get ( );
 
 	UBioAutoConditionals_execF1564_Parms F1564_Parms;
 	F1564_Parms.bioWorld = bioWorld;
@@ -576,10 +550,9 @@ bool UBioAutoConditionals::F1564 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1563 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1563 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1563Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1563", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1563 )
-		pFnF1563 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1563" );
+	UFunction* const pFnF1563 = pFnF1563Ref.Get ( );
 
 	UBioAutoConditionals_execF1563_Parms F1563_Parms;
 	F1563_Parms.bioWorld = bioWorld;
@@ -599,10 +572,9 @@ bool UBioAutoConditionals::F1563 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1562 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1562 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1562Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1562", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1562 )
-		pFnF1562 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1562" );
+	UFunction* const pFnF1562 = pFnF1562Ref.Get ( );
 
 	UBioAutoConditionals_execF1562_Parms F1562_Parms;
 	F1562_Parms.bioWorld = bioWorld;
@@ -622,10 +594,9 @@ bool UBioAutoConditionals::F1562 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1561 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1561 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1561Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1561", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1561 )
-		pFnF1561 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1561" );
+	UFunction* const pFnF1561 = pFnF1561Ref.Get ( );
 
 	UBioAutoConditionals_execF1561_Parms F1561_Parms;
 	F1561_Parms.bioWorld = bioWorld;
@@ -645,10 +616,9 @@ bool UBioAutoConditionals::F1561 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1560 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1560 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1560Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1560", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1560 )
-		pFnF1560 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1560" );
+	UFunction* const pFnF1560 = pFnF1560Ref.Get ( );
 
 	UBioAutoConditionals_execF1560_Parms F1560_Parms;
 	F1560_Parms.bioWorld = bioWorld;
@@ -668,10 +638,9 @@ bool UBioAutoConditionals::F1560 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1559 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1559 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1559Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1559", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1559 )
-		pFnF1559 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1559" );
+	UFunction* const pFnF1559 = pFnF1559Ref.Get ( );
 
 	UBioAutoConditionals_execF1559_Parms F1559_Parms;
 	F1559_Parms.bioWorld = bioWorld;
@@ -691,10 +660,9 @@ bool UBioAutoConditionals::F1559 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1391 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1391 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1391Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1391", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1391 )
-		pFnF1391 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1391" );
+	UFunction* const pFnF1391 = pFnF1391Ref.Get ( );
 
 	UBioAutoConditionals_execF1391_Parms F1391_Parms;
 	F1391_Parms.bioWorld = bioWorld;
@@ -714,10 +682,9 @@ bool UBioAutoConditionals::F1391 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1382 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1382 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1382Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1382", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1382 )
-		pFnF1382 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1382" );
+	UFunction* const pFnF1382 = pFnF1382Ref.Get ( );
 
 	UBioAutoConditionals_execF1382_Parms F1382_Parms;
 	F1382_Parms.bioWorld = bioWorld;
@@ -737,10 +704,9 @@ bool UBioAutoConditionals::F1382 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1198 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1198 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1198Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1198", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1198 )
-		pFnF1198 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1198" );
+	UFunction* const pFnF1198 = pFnF1198Ref.Get ( );
 
 	UBioAutoConditionals_execF1198_Parms F1198_Parms;
 	F1198_Parms.bioWorld = bioWorld;
@@ -760,10 +726,9 @@ bool UBioAutoConditionals::F1198 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1233 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1233 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1233Ref { L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1233", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1233 )
-		pFnF1233 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1233" );
+	UFunction* const pFnF1233 = pFnF1233Ref.Get ( );
 
 	UBioAutoConditionals_execF1233_Parms F1233_Parms;
 	F1233_Parms.bioWorld = bioWorld;
@@ -776,6 +741,53 @@ bool UBioAutoConditionals::F1233 ( class ABioWorldInfo* bioWorld, int Argument )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class PlotManagerDLC_UNC_Hammer01.BioAutoConditionals",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1677",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1675",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1674",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1673",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1672",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1671",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1670",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1636",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1700",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1699",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1698",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1697",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1696",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1695",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1694",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1693",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1692",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1691",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1568",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1567",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1566",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1565",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1564",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1563",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1562",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1561",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1560",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1559",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1391",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1382",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1198",
+	L"Function PlotManagerDLC_UNC_Hammer01.BioAutoConditionals.F1233",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioAutoConditionals::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioAutoConditionals::pClassPointer { L"Class PlotManagerDLC_UNC_Moment01.BioAutoConditionals", &UObject::FindClass };
 
 class UClass* UBioAutoConditionals::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class PlotManagerDLC_UNC_Moment01.BioAutoConditionals" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1711
@@ -47,10 +44,9 @@ class UClass* UBioAutoConditionals::StaticClass()
 
 bool UBioAutoConditionals::F1711 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1711 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1711Ref { L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1711", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1711 )
-		pFnF1711 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1711" );
+	UFunction* const pFnF1711 = pFnF1711Ref.Get ( );
 
 	UBioAutoConditionals_execF1711_Parms F1711_Parms;
 	F1711_Parms.bioWorld = bioWorld;
@@ -70,10 +66,9 @@ bool UBioAutoConditionals::F1711 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1689 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1689 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1689Ref { L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1689", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1689 )
-		pFnF1689 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1689" );
+	UFunction* const pFnF1689 = pFnF1689Ref.Get ( );
 
 	UBioAutoConditionals_execF1689_Parms F1689_Parms;
 	F1689_Parms.bioWorld = bioWorld;
@@ -93,10 +88,9 @@ bool UBioAutoConditionals::F1689 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1688 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1688 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1688Ref { L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1688", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1688 )
-		pFnF1688 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1688" );
+	UFunction* const pFnF1688 = pFnF1688Ref.Get ( );
 
 	UBioAutoConditionals_execF1688_Parms F1688_Parms;
 	F1688_Parms.bioWorld = bioWorld;
@@ -116,10 +110,9 @@ bool UBioAutoConditionals::F1688 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1669 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1669 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1669Ref { L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1669", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1669 )
-		pFnF1669 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1669" );
+	UFunction* const pFnF1669 = pFnF1669Ref.Get ( );
 
 	UBioAutoConditionals_execF1669_Parms F1669_Parms;
 	F1669_Parms.bioWorld = bioWorld;
@@ -139,10 +132,9 @@ bool UBioAutoConditionals::F1669 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1668 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1668 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1668Ref { L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1668", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1668 )
-		pFnF1668 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1668" );
+	UFunction* const pFnF1668 = pFnF1668Ref.Get ( );
 
 	UBioAutoConditionals_execF1668_Parms F1668_Parms;
 	F1668_Parms.bioWorld = bioWorld;
@@ -162,10 +154,9 @@ bool UBioAutoConditionals::F1668 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1667 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1667 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1667Ref { L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1667", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1667 )
-		pFnF1667 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1667" );
+	UFunction* const pFnF1667 = pFnF1667Ref.Get ( );
 
 	UBioAutoConditionals_execF1667_Parms F1667_Parms;
 	F1667_Parms.bioWorld = bioWorld;
@@ -185,10 +176,9 @@ bool UBioAutoConditionals::F1667 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1622 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1622 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1622Ref { L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1622", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1622 )
-		pFnF1622 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1622" );
+	UFunction* const pFnF1622 = pFnF1622Ref.Get ( );
 
 	UBioAutoConditionals_execF1622_Parms F1622_Parms;
 	F1622_Parms.bioWorld = bioWorld;
@@ -208,10 +198,9 @@ bool UBioAutoConditionals::F1622 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1621 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1621 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1621Ref { L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1621", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1621 )
-		pFnF1621 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1621" );
+	UFunction* const pFnF1621 = pFnF1621Ref.Get ( );
 
 	UBioAutoConditionals_execF1621_Parms F1621_Parms;
 	F1621_Parms.bioWorld = bioWorld;
@@ -224,6 +213,29 @@ bool UBioAutoConditionals::F1621 ( class ABioWorldInfo* bioWorld, int Argument )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class PlotManagerDLC_UNC_Moment01.BioAutoConditionals",
+	L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1711",
+	L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1689",
+	L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1688",
+	L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1669",
+	L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1668",
+	L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1667",
+	L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1622",
+	L"Function PlotManagerDLC_UNC_Moment01.BioAutoConditionals.F1621",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
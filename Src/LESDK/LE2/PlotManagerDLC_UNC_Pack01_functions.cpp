@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioAutoConditionals::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioAutoConditionals::pClassPointer { L"Class PlotManagerDLC_UNC_Pack01.BioAutoConditionals", &UObject::FindClass };
 
 class UClass* UBioAutoConditionals::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class PlotManagerDLC_UNC_Pack01.BioAutoConditionals" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1790
@@ -47,10 +44,9 @@ class UClass* UBioAutoConditionals::StaticClass()
 
 bool UBioAutoConditionals::F1790 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1790 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1790Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1790", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1790 )
-		pFnF1790 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1790" );
+	UFunction* const pFnF1790 = pFnF1790Ref.Get ( );
 
 	UBioAutoConditionals_execF1790_Parms F1790_Parms;
 	F1790_Parms.bioWorld = bioWorld;
@@ -70,10 +66,9 @@ bool UBioAutoConditionals::F1790 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1864 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1864 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1864Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1864", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1864 )
-		pFnF1864 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1864" );
+	UFunction* const pFnF1864 = pFnF1864Ref.Get ( );
 
 	UBioAutoConditionals_execF1864_Parms F1864_Parms;
 	F1864_Parms.bioWorld = bioWorld;
@@ -93,10 +88,9 @@ bool UBioAutoConditionals::F1864 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1743 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1743 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1743Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1743", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1743 )
-		pFnF1743 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1743" );
+	UFunction* const pFnF1743 = pFnF1743Ref.Get ( );
 
 	UBioAutoConditionals_execF1743_Parms F1743_Parms;
 	F1743_Parms.bioWorld = bioWorld;
@@ -116,10 +110,9 @@ bool UBioAutoConditionals::F1743 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1849 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1849 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1849Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1849", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1849 )
-		pFnF1849 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1849" );
+	UFunction* const pFnF1849 = pFnF1849Ref.Get ( );
 
 	UBioAutoConditionals_execF1849_Parms F1849_Parms;
 	F1849_Parms.bioWorld = bioWorld;
@@ -139,10 +132,9 @@ bool UBioAutoConditionals::F1849 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1848 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1848 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1848Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1848", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1848 )
-		pFnF1848 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1848" );
+	UFunction* const pFnF1848 = pFnF1848Ref.Get ( );
 
 	UBioAutoConditionals_execF1848_Parms F1848_Parms;
 	F1848_Parms.bioWorld = bioWorld;
@@ -162,10 +154,9 @@ bool UBioAutoConditionals::F1848 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1786 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1786 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1786Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1786", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1786 )
-		pFnF1786 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1786" );
+	UFunction* const pFnF1786 = pFnF1786Ref.Get ( );
 
 	UBioAutoConditionals_execF1786_Parms F1786_Parms;
 	F1786_Parms.bioWorld = bioWorld;
@@ -185,10 +176,9 @@ bool UBioAutoConditionals::F1786 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1766 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1766 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1766Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1766", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1766 )
-		pFnF1766 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1766" );
+	UFunction* const pFnF1766 = pFnF1766Ref.Get ( );
 
 	UBioAutoConditionals_execF1766_Parms F1766_Parms;
 	F1766_Parms.bioWorld = bioWorld;
@@ -208,10 +198,9 @@ bool UBioAutoConditionals::F1766 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1853 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1853 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1853Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1853", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1853 )
-		pFnF1853 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1853" );
+	UFunction* const pFnF1853 = pFnF1853Ref.Get ( );
 
 	UBioAutoConditionals_execF1853_Parms F1853_Parms;
 	F1853_Parms.bioWorld = bioWorld;
@@ -231,10 +220,9 @@ bool UBioAutoConditionals::F1853 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1851 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1851 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1851Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1851", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1851 )
-		pFnF1851 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1851" );
+	UFunction* const pFnF1851 = pFnF1851Ref.Get ( );
 
 	UBioAutoConditionals_execF1851_Parms F1851_Parms;
 	F1851_Parms.bioWorld = bioWorld;
@@ -254,10 +242,9 @@ bool UBioAutoConditionals::F1851 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1850 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1850 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1850Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1850", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1850 )
-		pFnF1850 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1850" );
+	UFunction* const pFnF1850 = pFnF1850Ref.Get ( );
 
 	UBioAutoConditionals_execF1850_Parms F1850_Parms;
 	F1850_Parms.bioWorld = bioWorld;
@@ -277,10 +264,9 @@ bool UBioAutoConditionals::F1850 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1847 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1847 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1847Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1847", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1847 )
-		pFnF1847 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1847" );
+	UFunction* const pFnF1847 = pFnF1847Ref.Get ( );
 
 	UBioAutoConditionals_execF1847_Parms F1847_Parms;
 	F1847_Parms.bioWorld = bioWorld;
@@ -300,10 +286,9 @@ bool UBioAutoConditionals::F1847 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1846 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1846 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1846Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1846", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1846 )
-		pFnF1846 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1846" );
+	UFunction* const pFnF1846 = pFnF1846Ref.Get ( );
 
 	UBioAutoConditionals_execF1846_Parms F1846_Parms;
 	F1846_Parms.bioWorld = bioWorld;
@@ -323,10 +308,9 @@ bool UBioAutoConditionals::F1846 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1845 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1845 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1845Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1845", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1845 )
-		pFnF1845 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1845" );
+	UFunction* const pFnF1845 = pFnF1845Ref.Get ( );
 
 	UBioAutoConditionals_execF1845_Parms F1845_Parms;
 	F1845_Parms.bioWorld = bioWorld;
@@ -346,10 +330,9 @@ bool UBioAutoConditionals::F1845 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1844 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1844 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1844Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1844", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1844 )
-		pFnF1844 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1844" );
+	UFunction* const pFnF1844 = pFnF1844Ref.Get ( );
 
 	UBioAutoConditionals_execF1844_Parms F1844_Parms;
 	F1844_Parms.bioWorld = bioWorld;
@@ -369,10 +352,9 @@ bool UBioAutoConditionals::F1844 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1843 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1843 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1843Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1843", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1843 )
-		pFnF1843 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1843" );
+	UFunction* const pFnF1843 = pFnF1843Ref.Get ( );
 
 	UBioAutoConditionals_execF1843_Parms F1843_Parms;
 	F1843_Parms.bioWorld = bioWorld;
@@ -392,10 +374,9 @@ bool UBioAutoConditionals::F1843 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1842 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1842 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1842Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1842", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1842 )
-		pFnF1842 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1842" );
+	UFunction* const pFnF1842 = pFnF1842Ref.Get ( );
 
 	UBioAutoConditionals_execF1842_Parms F1842_Parms;
 	F1842_Parms.bioWorld = bioWorld;
@@ -415,10 +396,9 @@ bool UBioAutoConditionals::F1842 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1841 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1841 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1841Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1841", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1841 )
-		pFnF1841 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1841" );
+	UFunction* const pFnF1841 = pFnF1841Ref.Get ( );
 
 	UBioAutoConditionals_execF1841_Parms F1841_Parms;
 	F1841_Parms.bioWorld = bioWorld;
@@ -438,10 +418,9 @@ bool UBioAutoConditionals::F1841 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1785 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1785 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1785Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1785", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1785 )
-		pFnF1785 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1785" );
+	UFunction* const pFnF1785 = pFnF1785Ref.Get ( );
 
 	UBioAutoConditionals_execF1785_Parms F1785_Parms;
 	F1785_Parms.bioWorld = bioWorld;
@@ -461,10 +440,9 @@ bool UBioAutoConditionals::F1785 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1784 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1784 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1784Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1784", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1784 )
-		pFnF1784 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1784" );
+	UFunction* const pFnF1784 = pFnF1784Ref.Get ( );
 
 	UBioAutoConditionals_execF1784_Parms F1784_Parms;
 	F1784_Parms.bioWorld = bioWorld;
@@ -484,10 +462,9 @@ bool UBioAutoConditionals::F1784 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1783 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1783 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1783Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1783", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1783 )
-		pFnF1783 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1783" );
+	UFunction* const pFnF1783 = pFnF1783Ref.Get ( );
 
 	UBioAutoConditionals_execF1783_Parms F1783_Parms;
 	F1783_Parms.bioWorld = bioWorld;
@@ -507,10 +484,9 @@ bool UBioAutoConditionals::F1783 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1782 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1782 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1782Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1782", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1782 )
-		pFnF1782 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1782" );
+	UFunction* const pFnF1782 = pFnF1782Ref.Get ( );
 
 	UBioAutoConditionals_execF1782_Parms F1782_Parms;
 	F1782_Parms.bioWorld = bioWorld;
@@ -530,10 +506,9 @@ bool UBioAutoConditionals::F1782 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1781 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1781 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1781Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1781", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1781 )
-		pFnF1781 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1781" );
+	UFunction* const pFnF1781 = pFnF1781Ref.Get ( );
 
 	UBioAutoConditionals_execF1781_Parms F1781_Parms;
 	F1781_Parms.bioWorld = bioWorld;
@@ -553,10 +528,9 @@ bool UBioAutoConditionals::F1781 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1780 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1780 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1780Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1780", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1780 )
-		pFnF1780 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1780" );
+	UFunction* const pFnF1780 = pFnF1780Ref.Get ( );
 
 	UBioAutoConditionals_execF1780_Parms F1780_Parms;
 	F1780_Parms.bioWorld = bioWorld;
@@ -576,10 +550,9 @@ bool UBioAutoConditionals::F1780 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1779 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1779 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1779Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1779", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1779 )
-		pFnF1779 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1779" );
+	UFunction* const pFnF1779 = pFnF1779Ref.Get ( );
 
 	UBioAutoConditionals_execF1779_Parms F1779_Parms;
 	F1779_Parms.bioWorld = bioWorld;
@@ -599,10 +572,9 @@ bool UBioAutoConditionals::F1779 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1778 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1778 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1778Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1778", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1778 )
-		pFnF1778 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1778" );
+	UFunction* const pFnF1778 = pFnF1778Ref.Get ( );
 
 	UBioAutoConditionals_execF1778_Parms F1778_Parms;
 	F1778_Parms.bioWorld = bioWorld;
@@ -622,10 +594,9 @@ bool UBioAutoConditionals::F1778 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1777 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1777 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1777Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1777", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1777 )
-		pFnF1777 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1777" );
+	UFunction* const pFnF1777 = pFnF1777Ref.Get ( );
 
 	UBioAutoConditionals_execF1777_Parms F1777_Parms;
 	F1777_Parms.bioWorld = bioWorld;
@@ -645,10 +616,9 @@ bool UBioAutoConditionals::F1777 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1765 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1765 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1765Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1765", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1765 )
-		pFnF1765 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1765" );
+	UFunction* const pFnF1765 = pFnF1765Ref.Get ( );
 
 	UBioAutoConditionals_execF1765_Parms F1765_Parms;
 	F1765_Parms.bioWorld = bioWorld;
@@ -668,10 +638,9 @@ bool UBioAutoConditionals::F1765 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1857 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1857 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1857Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1857", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1857 )
-		pFnF1857 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1857" );
+	UFunction* const pFnF1857 = pFnF1857Ref.Get ( );
 
 	UBioAutoConditionals_execF1857_Parms F1857_Parms;
 	F1857_Parms.bioWorld = bioWorld;
@@ -691,10 +660,9 @@ bool UBioAutoConditionals::F1857 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1856 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1856 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1856Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1856", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1856 )
-		pFnF1856 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1856" );
+	UFunction* const pFnF1856 = pFnF1856Ref.Get ( );
 
 	UBioAutoConditionals_execF1856_Parms F1856_Parms;
 	F1856_Parms.bioWorld = bioWorld;
@@ -714,10 +682,9 @@ bool UBioAutoConditionals::F1856 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1776 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1776 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1776Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1776", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1776 )
-		pFnF1776 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1776" );
+	UFunction* const pFnF1776 = pFnF1776Ref.Get ( );
 
 	UBioAutoConditionals_execF1776_Parms F1776_Parms;
 	F1776_Parms.bioWorld = bioWorld;
@@ -737,10 +704,9 @@ bool UBioAutoConditionals::F1776 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1775 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1775 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1775Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1775", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1775 )
-		pFnF1775 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1775" );
+	UFunction* const pFnF1775 = pFnF1775Ref.Get ( );
 
 	UBioAutoConditionals_execF1775_Parms F1775_Parms;
 	F1775_Parms.bioWorld = bioWorld;
@@ -760,10 +726,9 @@ bool UBioAutoConditionals::F1775 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1774 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1774 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1774Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1774", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1774 )
-		pFnF1774 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1774" );
+	UFunction* const pFnF1774 = pFnF1774Ref.Get ( );
 
 	UBioAutoConditionals_execF1774_Parms F1774_Parms;
 	F1774_Parms.bioWorld = bioWorld;
@@ -783,10 +748,9 @@ bool UBioAutoConditionals::F1774 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1773 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1773 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1773Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1773", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1773 )
-		pFnF1773 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1773" );
+	UFunction* const pFnF1773 = pFnF1773Ref.Get ( );
 
 	UBioAutoConditionals_execF1773_Parms F1773_Parms;
 	F1773_Parms.bioWorld = bioWorld;
@@ -806,10 +770,9 @@ bool UBioAutoConditionals::F1773 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1772 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1772 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1772Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1772", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1772 )
-		pFnF1772 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1772" );
+	UFunction* const pFnF1772 = pFnF1772Ref.Get ( );
 
 	UBioAutoConditionals_execF1772_Parms F1772_Parms;
 	F1772_Parms.bioWorld = bioWorld;
@@ -829,10 +792,9 @@ bool UBioAutoConditionals::F1772 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1771 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1771 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1771Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1771", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1771 )
-		pFnF1771 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1771" );
+	UFunction* const pFnF1771 = pFnF1771Ref.Get ( );
 
 	UBioAutoConditionals_execF1771_Parms F1771_Parms;
 	F1771_Parms.bioWorld = bioWorld;
@@ -852,10 +814,9 @@ bool UBioAutoConditionals::F1771 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1770 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1770 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1770Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1770", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1770 )
-		pFnF1770 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1770" );
+	UFunction* const pFnF1770 = pFnF1770Ref.Get ( );
 
 	UBioAutoConditionals_execF1770_Parms F1770_Parms;
 	F1770_Parms.bioWorld = bioWorld;
@@ -875,10 +836,9 @@ bool UBioAutoConditionals::F1770 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1764 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1764 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1764Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1764", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1764 )
-		pFnF1764 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1764" );
+	UFunction* const pFnF1764 = pFnF1764Ref.Get ( );
 
 	UBioAutoConditionals_execF1764_Parms F1764_Parms;
 	F1764_Parms.bioWorld = bioWorld;
@@ -898,10 +858,9 @@ bool UBioAutoConditionals::F1764 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1769 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1769 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1769Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1769", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1769 )
-		pFnF1769 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1769" );
+	UFunction* const pFnF1769 = pFnF1769Ref.Get ( );
 
 	UBioAutoConditionals_execF1769_Parms F1769_Parms;
 	F1769_Parms.bioWorld = bioWorld;
@@ -921,10 +880,9 @@ bool UBioAutoConditionals::F1769 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1768 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1768 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1768Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1768", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1768 )
-		pFnF1768 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1768" );
+	UFunction* const pFnF1768 = pFnF1768Ref.Get ( );
 
 	UBioAutoConditionals_execF1768_Parms F1768_Parms;
 	F1768_Parms.bioWorld = bioWorld;
@@ -944,10 +902,9 @@ bool UBioAutoConditionals::F1768 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1767 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1767 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1767Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1767", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1767 )
-		pFnF1767 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1767" );
+	UFunction* const pFnF1767 = pFnF1767Ref.Get ( );
 
 	UBioAutoConditionals_execF1767_Parms F1767_Parms;
 	F1767_Parms.bioWorld = bioWorld;
@@ -967,10 +924,9 @@ bool UBioAutoConditionals::F1767 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1738 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1738 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1738Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1738", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1738 )
-		pFnF1738 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1738" );
+	UFunction* const pFnF1738 = pFnF1738Ref.Get ( );
 
 	UBioAutoConditionals_execF1738_Parms F1738_Parms;
 	F1738_Parms.bioWorld = bioWorld;
@@ -990,10 +946,9 @@ bool UBioAutoConditionals::F1738 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1737 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1737 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1737Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1737", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1737 )
-		pFnF1737 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1737" );
+	UFunction* const pFnF1737 = pFnF1737Ref.Get ( );
 
 	UBioAutoConditionals_execF1737_Parms F1737_Parms;
 	F1737_Parms.bioWorld = bioWorld;
@@ -1013,10 +968,9 @@ bool UBioAutoConditionals::F1737 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1754 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1754 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1754Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1754", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1754 )
-		pFnF1754 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1754" );
+	UFunction* const pFnF1754 = pFnF1754Ref.Get ( );
 
 	UBioAutoConditionals_execF1754_Parms F1754_Parms;
 	F1754_Parms.bioWorld = bioWorld;
@@ -1036,10 +990,9 @@ bool UBioAutoConditionals::F1754 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1753 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1753 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1753Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1753", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1753 )
-		pFnF1753 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1753" );
+	UFunction* const pFnF1753 = pFnF1753Ref.Get ( );
 
 	UBioAutoConditionals_execF1753_Parms F1753_Parms;
 	F1753_Parms.bioWorld = bioWorld;
@@ -1059,10 +1012,9 @@ bool UBioAutoConditionals::F1753 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1752 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1752 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1752Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1752", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1752 )
-		pFnF1752 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1752" );
+	UFunction* const pFnF1752 = pFnF1752Ref.Get ( );
 
 	UBioAutoConditionals_execF1752_Parms F1752_Parms;
 	F1752_Parms.bioWorld = bioWorld;
@@ -1082,10 +1034,9 @@ bool UBioAutoConditionals::F1752 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1751 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1751 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1751Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1751", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1751 )
-		pFnF1751 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1751" );
+	UFunction* const pFnF1751 = pFnF1751Ref.Get ( );
 
 	UBioAutoConditionals_execF1751_Parms F1751_Parms;
 	F1751_Parms.bioWorld = bioWorld;
@@ -1105,10 +1056,9 @@ bool UBioAutoConditionals::F1751 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1750 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1750 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1750Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1750", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1750 )
-		pFnF1750 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1750" );
+	UFunction* const pFnF1750 = pFnF1750Ref.Get ( );
 
 	UBioAutoConditionals_execF1750_Parms F1750_Parms;
 	F1750_Parms.bioWorld = bioWorld;
@@ -1128,10 +1078,9 @@ bool UBioAutoConditionals::F1750 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1749 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1749 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1749Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1749", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1749 )
-		pFnF1749 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1749" );
+	UFunction* const pFnF1749 = pFnF1749Ref.Get ( );
 
 	UBioAutoConditionals_execF1749_Parms F1749_Parms;
 	F1749_Parms.bioWorld = bioWorld;
@@ -1151,10 +1100,9 @@ bool UBioAutoConditionals::F1749 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1748 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1748 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1748Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1748", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1748 )
-		pFnF1748 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1748" );
+	UFunction* const pFnF1748 = pFnF1748Ref.Get ( );
 
 	UBioAutoConditionals_execF1748_Parms F1748_Parms;
 	F1748_Parms.bioWorld = bioWorld;
@@ -1174,10 +1122,9 @@ bool UBioAutoConditionals::F1748 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1747 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1747 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1747Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1747", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1747 )
-		pFnF1747 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1747" );
+	UFunction* const pFnF1747 = pFnF1747Ref.Get ( );
 
 	UBioAutoConditionals_execF1747_Parms F1747_Parms;
 	F1747_Parms.bioWorld = bioWorld;
@@ -1197,10 +1144,9 @@ bool UBioAutoConditionals::F1747 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1746 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1746 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1746Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1746", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1746 )
-		pFnF1746 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1746" );
+	UFunction* const pFnF1746 = pFnF1746Ref.Get ( );
 
 	UBioAutoConditionals_execF1746_Parms F1746_Parms;
 	F1746_Parms.bioWorld = bioWorld;
@@ -1220,10 +1166,9 @@ bool UBioAutoConditionals::F1746 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1745 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1745 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1745Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1745", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1745 )
-		pFnF1745 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1745" );
+	UFunction* const pFnF1745 = pFnF1745Ref.Get ( );
 
 	UBioAutoConditionals_execF1745_Parms F1745_Parms;
 	F1745_Parms.bioWorld = bioWorld;
@@ -1243,10 +1188,9 @@ bool UBioAutoConditionals::F1745 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1744 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1744 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1744Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1744", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1744 )
-		pFnF1744 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1744" );
+	UFunction* const pFnF1744 = pFnF1744Ref.Get ( );
 
 	UBioAutoConditionals_execF1744_Parms F1744_Parms;
 	F1744_Parms.bioWorld = bioWorld;
@@ -1266,10 +1210,9 @@ bool UBioAutoConditionals::F1744 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1740 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1740 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1740Ref { L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1740", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1740 )
-		pFnF1740 = UObject::FindObject< UFunction > ( L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1740" );
+	UFunction* const pFnF1740 = pFnF1740Ref.Get ( );
 
 	UBioAutoConditionals_execF1740_Parms F1740_Parms;
 	F1740_Parms.bioWorld = bioWorld;
@@ -1282,6 +1225,75 @@ bool UBioAutoConditionals::F1740 ( class ABioWorldInfo* bioWorld, int Argument )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class PlotManagerDLC_UNC_Pack01.BioAutoConditionals",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1790",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1864",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1743",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1849",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1848",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1786",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1766",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1853",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1851",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1850",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1847",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1846",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1845",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1844",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1843",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1842",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1841",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1785",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1784",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1783",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1782",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1781",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1780",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1779",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1778",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1777",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1765",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1857",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1856",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1776",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1775",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1774",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1773",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1772",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1771",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1770",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1764",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1769",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1768",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1767",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1738",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1737",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1754",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1753",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1752",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1751",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1750",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1749",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1748",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1747",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1746",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1745",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1744",
+	L"Function PlotManagerDLC_UNC_Pack01.BioAutoConditionals.F1740",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -28,18 +28,30 @@
 
 
 
-class UClass* UBioPlotEnums::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioPlotEnums::pClassPointer { L"Class PlotManagerMap.BioPlotEnums", &UObject::FindClass };
 
 class UClass* UBioPlotEnums::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class PlotManagerMap.BioPlotEnums" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class PlotManagerMap.BioPlotEnums",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
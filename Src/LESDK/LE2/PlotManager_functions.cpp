@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioAutoConditionals::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioAutoConditionals::pClassPointer { L"Class PlotManager.BioAutoConditionals", &UObject::FindClass };
 
 class UClass* UBioAutoConditionals::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class PlotManager.BioAutoConditionals" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function PlotManager.BioAutoConditionals.F1194
@@ -47,10 +44,9 @@ class UClass* UBioAutoConditionals::StaticClass()
 
 bool UBioAutoConditionals::F1194 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1194 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1194Ref { L"Function PlotManager.BioAutoConditionals.F1194", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1194 )
-		pFnF1194 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1194" );
+	UFunction* const pFnF1194 = pFnF1194Ref.Get ( );
 
 	UBioAutoConditionals_execF1194_Parms F1194_Parms;
 	F1194_Parms.bioWorld = bioWorld;
@@ -70,10 +66,9 @@ bool UBioAutoConditionals::F1194 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1193 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1193 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1193Ref { L"Function PlotManager.BioAutoConditionals.F1193", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1193 )
-		pFnF1193 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1193" );
+	UFunction* const pFnF1193 = pFnF1193Ref.Get ( );
 
 	UBioAutoConditionals_execF1193_Parms F1193_Parms;
 	F1193_Parms.bioWorld = bioWorld;
@@ -93,10 +88,9 @@ bool UBioAutoConditionals::F1193 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1192 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1192 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1192Ref { L"Function PlotManager.BioAutoConditionals.F1192", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1192 )
-		pFnF1192 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1192" );
+	UFunction* const pFnF1192 = pFnF1192Ref.Get ( );
 
 	UBioAutoConditionals_execF1192_Parms F1192_Parms;
 	F1192_Parms.bioWorld = bioWorld;
@@ -116,10 +110,9 @@ bool UBioAutoConditionals::F1192 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1191 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1191 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1191Ref { L"Function PlotManager.BioAutoConditionals.F1191", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1191 )
-		pFnF1191 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1191" );
+	UFunction* const pFnF1191 = pFnF1191Ref.Get ( );
 
 	UBioAutoConditionals_execF1191_Parms F1191_Parms;
 	F1191_Parms.bioWorld = bioWorld;
@@ -139,10 +132,9 @@ bool UBioAutoConditionals::F1191 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1190 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1190 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1190Ref { L"Function PlotManager.BioAutoConditionals.F1190", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1190 )
-		pFnF1190 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1190" );
+	UFunction* const pFnF1190 = pFnF1190Ref.Get ( );
 
 	UBioAutoConditionals_execF1190_Parms F1190_Parms;
 	F1190_Parms.bioWorld = bioWorld;
@@ -162,10 +154,9 @@ bool UBioAutoConditionals::F1190 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1189 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1189 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1189Ref { L"Function PlotManager.BioAutoConditionals.F1189", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1189 )
-		pFnF1189 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1189" );
+	UFunction* const pFnF1189 = pFnF1189Ref.Get ( );
 
 	UBioAutoConditionals_execF1189_Parms F1189_Parms;
 	F1189_Parms.bioWorld = bioWorld;
@@ -185,10 +176,9 @@ bool UBioAutoConditionals::F1189 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1188 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1188 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1188Ref { L"Function PlotManager.BioAutoConditionals.F1188", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1188 )
-		pFnF1188 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1188" );
+	UFunction* const pFnF1188 = pFnF1188Ref.Get ( );
 
 	UBioAutoConditionals_execF1188_Parms F1188_Parms;
 	F1188_Parms.bioWorld = bioWorld;
@@ -208,10 +198,9 @@ bool UBioAutoConditionals::F1188 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1187 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1187 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1187Ref { L"Function PlotManager.BioAutoConditionals.F1187", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1187 )
-		pFnF1187 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1187" );
+	UFunction* const pFnF1187 = pFnF1187Ref.Get ( );
 
 	UBioAutoConditionals_execF1187_Parms F1187_Parms;
 	F1187_Parms.bioWorld = bioWorld;
@@ -231,10 +220,9 @@ bool UBioAutoConditionals::F1187 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1255 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1255 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1255Ref { L"Function PlotManager.BioAutoConditionals.F1255", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1255 )
-		pFnF1255 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1255" );
+	UFunction* const pFnF1255 = pFnF1255Ref.Get ( );
 
 	UBioAutoConditionals_execF1255_Parms F1255_Parms;
 	F1255_Parms.bioWorld = bioWorld;
@@ -254,10 +242,9 @@ bool UBioAutoConditionals::F1255 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1254 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1254 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1254Ref { L"Function PlotManager.BioAutoConditionals.F1254", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1254 )
-		pFnF1254 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1254" );
+	UFunction* const pFnF1254 = pFnF1254Ref.Get ( );
 
 	UBioAutoConditionals_execF1254_Parms F1254_Parms;
 	F1254_Parms.bioWorld = bioWorld;
@@ -277,10 +264,9 @@ bool UBioAutoConditionals::F1254 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1854 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1854 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1854Ref { L"Function PlotManager.BioAutoConditionals.F1854", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1854 )
-		pFnF1854 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1854" );
+	UFunction* const pFnF1854 = pFnF1854Ref.Get ( );
 
 	UBioAutoConditionals_execF1854_Parms F1854_Parms;
 	F1854_Parms.bioWorld = bioWorld;
@@ -300,10 +286,9 @@ bool UBioAutoConditionals::F1854 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1663 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1663 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1663Ref { L"Function PlotManager.BioAutoConditionals.F1663", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1663 )
-		pFnF1663 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1663" );
+	UFunction* const pFnF1663 = pFnF1663Ref.Get ( );
 
 	UBioAutoConditionals_execF1663_Parms F1663_Parms;
 	F1663_Parms.bioWorld = bioWorld;
@@ -323,10 +308,9 @@ bool UBioAutoConditionals::F1663 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1662 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1662 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1662Ref { L"Function PlotManager.BioAutoConditionals.F1662", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1662 )
-		pFnF1662 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1662" );
+	UFunction* const pFnF1662 = pFnF1662Ref.Get ( );
 
 	UBioAutoConditionals_execF1662_Parms F1662_Parms;
 	F1662_Parms.bioWorld = bioWorld;
@@ -346,10 +330,9 @@ bool UBioAutoConditionals::F1662 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1661 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1661 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1661Ref { L"Function PlotManager.BioAutoConditionals.F1661", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1661 )
-		pFnF1661 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1661" );
+	UFunction* const pFnF1661 = pFnF1661Ref.Get ( );
 
 	UBioAutoConditionals_execF1661_Parms F1661_Parms;
 	F1661_Parms.bioWorld = bioWorld;
@@ -369,10 +352,9 @@ bool UBioAutoConditionals::F1661 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1660 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1660 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1660Ref { L"Function PlotManager.BioAutoConditionals.F1660", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1660 )
-		pFnF1660 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1660" );
+	UFunction* const pFnF1660 = pFnF1660Ref.Get ( );
 
 	UBioAutoConditionals_execF1660_Parms F1660_Parms;
 	F1660_Parms.bioWorld = bioWorld;
@@ -392,10 +374,9 @@ bool UBioAutoConditionals::F1660 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1659 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1659 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1659Ref { L"Function PlotManager.BioAutoConditionals.F1659", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1659 )
-		pFnF1659 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1659" );
+	UFunction* const pFnF1659 = pFnF1659Ref.Get ( );
 
 	UBioAutoConditionals_execF1659_Parms F1659_Parms;
 	F1659_Parms.bioWorld = bioWorld;
@@ -415,10 +396,9 @@ bool UBioAutoConditionals::F1659 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1658 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1658 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1658Ref { L"Function PlotManager.BioAutoConditionals.F1658", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1658 )
-		pFnF1658 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1658" );
+	UFunction* const pFnF1658 = pFnF1658Ref.Get ( );
 
 	UBioAutoConditionals_execF1658_Parms F1658_Parms;
 	F1658_Parms.bioWorld = bioWorld;
@@ -438,10 +418,9 @@ bool UBioAutoConditionals::F1658 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1657 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1657 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1657Ref { L"Function PlotManager.BioAutoConditionals.F1657", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1657 )
-		pFnF1657 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1657" );
+	UFunction* const pFnF1657 = pFnF1657Ref.Get ( );
 
 	UBioAutoConditionals_execF1657_Parms F1657_Parms;
 	F1657_Parms.bioWorld = bioWorld;
@@ -461,10 +440,9 @@ bool UBioAutoConditionals::F1657 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2017 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2017 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2017Ref { L"Function PlotManager.BioAutoConditionals.F2017", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2017 )
-		pFnF2017 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2017" );
+	UFunction* const pFnF2017 = pFnF2017Ref.Get ( );
 
 	UBioAutoConditionals_execF2017_Parms F2017_Parms;
 	F2017_Parms.bioWorld = bioWorld;
@@ -484,10 +462,9 @@ bool UBioAutoConditionals::F2017 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2016 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2016 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2016Ref { L"Function PlotManager.BioAutoConditionals.F2016", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2016 )
-		pFnF2016 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2016" );
+	UFunction* const pFnF2016 = pFnF2016Ref.Get ( );
 
 	UBioAutoConditionals_execF2016_Parms F2016_Parms;
 	F2016_Parms.bioWorld = bioWorld;
@@ -507,10 +484,9 @@ bool UBioAutoConditionals::F2016 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2015 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2015 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2015Ref { L"Function PlotManager.BioAutoConditionals.F2015", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2015 )
-		pFnF2015 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2015" );
+	UFunction* const pFnF2015 = pFnF2015Ref.Get ( );
 
 	UBioAutoConditionals_execF2015_Parms F2015_Parms;
 	F2015_Parms.bioWorld = bioWorld;
@@ -530,10 +506,9 @@ bool UBioAutoConditionals::F2015 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2014 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2014 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2014Ref { L"Function PlotManager.BioAutoConditionals.F2014", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2014 )
-		pFnF2014 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2014" );
+	UFunction* const pFnF2014 = pFnF2014Ref.Get ( );
 
 	UBioAutoConditionals_execF2014_Parms F2014_Parms;
 	F2014_Parms.bioWorld = bioWorld;
@@ -553,10 +528,9 @@ bool UBioAutoConditionals::F2014 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2013 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2013 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2013Ref { L"Function PlotManager.BioAutoConditionals.F2013", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2013 )
-		pFnF2013 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2013" );
+	UFunction* const pFnF2013 = pFnF2013Ref.Get ( );
 
 	UBioAutoConditionals_execF2013_Parms F2013_Parms;
 	F2013_Parms.bioWorld = bioWorld;
@@ -576,10 +550,9 @@ bool UBioAutoConditionals::F2013 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2012 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2012 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2012Ref { L"Function PlotManager.BioAutoConditionals.F2012", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2012 )
-		pFnF2012 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2012" );
+	UFunction* const pFnF2012 = pFnF2012Ref.Get ( );
 
 	UBioAutoConditionals_execF2012_Parms F2012_Parms;
 	F2012_Parms.bioWorld = bioWorld;
@@ -599,10 +572,9 @@ bool UBioAutoConditionals::F2012 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2011 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2011 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2011Ref { L"Function PlotManager.BioAutoConditionals.F2011", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2011 )
-		pFnF2011 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2011" );
+	UFunction* const pFnF2011 = pFnF2011Ref.Get ( );
 
 	UBioAutoConditionals_execF2011_Parms F2011_Parms;
 	F2011_Parms.bioWorld = bioWorld;
@@ -622,10 +594,9 @@ bool UBioAutoConditionals::F2011 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2010 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2010 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2010Ref { L"Function PlotManager.BioAutoConditionals.F2010", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2010 )
-		pFnF2010 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2010" );
+	UFunction* const pFnF2010 = pFnF2010Ref.Get ( );
 
 	UBioAutoConditionals_execF2010_Parms F2010_Parms;
 	F2010_Parms.bioWorld = bioWorld;
@@ -645,10 +616,9 @@ bool UBioAutoConditionals::F2010 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F492 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF492 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF492Ref { L"Function PlotManager.BioAutoConditionals.F492", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF492 )
-		pFnF492 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F492" );
+	UFunction* const pFnF492 = pFnF492Ref.Get ( );
 
 	UBioAutoConditionals_execF492_Parms F492_Parms;
 	F492_Parms.bioWorld = bioWorld;
@@ -668,10 +638,9 @@ bool UBioAutoConditionals::F492 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F469 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF469 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF469Ref { L"Function PlotManager.BioAutoConditionals.F469", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF469 )
-		pFnF469 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F469" );
+	UFunction* const pFnF469 = pFnF469Ref.Get ( );
 
 	UBioAutoConditionals_execF469_Parms F469_Parms;
 	F469_Parms.bioWorld = bioWorld;
@@ -691,10 +660,9 @@ bool UBioAutoConditionals::F469 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F452 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF452 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF452Ref { L"Function PlotManager.BioAutoConditionals.F452", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF452 )
-		pFnF452 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F452" );
+	UFunction* const pFnF452 = pFnF452Ref.Get ( );
 
 	UBioAutoConditionals_execF452_Parms F452_Parms;
 	F452_Parms.bioWorld = bioWorld;
@@ -714,10 +682,9 @@ bool UBioAutoConditionals::F452 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F168 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF168 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF168Ref { L"Function PlotManager.BioAutoConditionals.F168", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF168 )
-		pFnF168 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F168" );
+	UFunction* const pFnF168 = pFnF168Ref.Get ( );
 
 	UBioAutoConditionals_execF168_Parms F168_Parms;
 	F168_Parms.bioWorld = bioWorld;
@@ -737,10 +704,9 @@ bool UBioAutoConditionals::F168 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F167 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF167 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF167Ref { L"Function PlotManager.BioAutoConditionals.F167", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF167 )
-		pFnF167 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F167" );
+	UFunction* const pFnF167 = pFnF167Ref.Get ( );
 
 	UBioAutoConditionals_execF167_Parms F167_Parms;
 	F167_Parms.bioWorld = bioWorld;
@@ -760,10 +726,9 @@ bool UBioAutoConditionals::F167 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F166 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF166 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF166Ref { L"Function PlotManager.BioAutoConditionals.F166", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF166 )
-		pFnF166 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F166" );
+	UFunction* const pFnF166 = pFnF166Ref.Get ( );
 
 	UBioAutoConditionals_execF166_Parms F166_Parms;
 	F166_Parms.bioWorld = bioWorld;
@@ -783,10 +748,9 @@ bool UBioAutoConditionals::F166 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F617 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF617 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF617Ref { L"Function PlotManager.BioAutoConditionals.F617", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF617 )
-		pFnF617 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F617" );
+	UFunction* const pFnF617 = pFnF617Ref.Get ( );
 
 	UBioAutoConditionals_execF617_Parms F617_Parms;
 	F617_Parms.bioWorld = bioWorld;
@@ -806,10 +770,9 @@ bool UBioAutoConditionals::F617 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F616 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF616 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF616Ref { L"Function PlotManager.BioAutoConditionals.F616", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF616 )
-		pFnF616 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F616" );
+	UFunction* const pFnF616 = pFnF616Ref.Get ( );
 
 	UBioAutoConditionals_execF616_Parms F616_Parms;
 	F616_Parms.bioWorld = bioWorld;
@@ -829,10 +792,9 @@ bool UBioAutoConditionals::F616 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F615 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF615 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF615Ref { L"Function PlotManager.BioAutoConditionals.F615", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF615 )
-		pFnF615 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F615" );
+	UFunction* const pFnF615 = pFnF615Ref.Get ( );
 
 	UBioAutoConditionals_execF615_Parms F615_Parms;
 	F615_Parms.bioWorld = bioWorld;
@@ -852,10 +814,9 @@ bool UBioAutoConditionals::F615 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F614 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF614 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF614Ref { L"Function PlotManager.BioAutoConditionals.F614", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF614 )
-		pFnF614 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F614" );
+	UFunction* const pFnF614 = pFnF614Ref.Get ( );
 
 	UBioAutoConditionals_execF614_Parms F614_Parms;
 	F614_Parms.bioWorld = bioWorld;
@@ -875,10 +836,9 @@ bool UBioAutoConditionals::F614 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F613 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF613 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF613Ref { L"Function PlotManager.BioAutoConditionals.F613", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF613 )
-		pFnF613 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F613" );
+	UFunction* const pFnF613 = pFnF613Ref.Get ( );
 
 	UBioAutoConditionals_execF613_Parms F613_Parms;
 	F613_Parms.bioWorld = bioWorld;
@@ -898,10 +858,9 @@ bool UBioAutoConditionals::F613 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F612 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF612 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF612Ref { L"Function PlotManager.BioAutoConditionals.F612", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF612 )
-		pFnF612 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F612" );
+	UFunction* const pFnF612 = pFnF612Ref.Get ( );
 
 	UBioAutoConditionals_execF612_Parms F612_Parms;
 	F612_Parms.bioWorld = bioWorld;
@@ -921,10 +880,9 @@ bool UBioAutoConditionals::F612 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F611 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF611 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF611Ref { L"Function PlotManager.BioAutoConditionals.F611", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF611 )
-		pFnF611 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F611" );
+	UFunction* const pFnF611 = pFnF611Ref.Get ( );
 
 	UBioAutoConditionals_execF611_Parms F611_Parms;
 	F611_Parms.bioWorld = bioWorld;
@@ -944,10 +902,9 @@ bool UBioAutoConditionals::F611 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F610 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF610 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF610Ref { L"Function PlotManager.BioAutoConditionals.F610", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF610 )
-		pFnF610 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F610" );
+	UFunction* const pFnF610 = pFnF610Ref.Get ( );
 
 	UBioAutoConditionals_execF610_Parms F610_Parms;
 	F610_Parms.bioWorld = bioWorld;
@@ -967,10 +924,9 @@ bool UBioAutoConditionals::F610 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F872 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF872 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF872Ref { L"Function PlotManager.BioAutoConditionals.F872", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF872 )
-		pFnF872 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F872" );
+	UFunction* const pFnF872 = pFnF872Ref.Get ( );
 
 	UBioAutoConditionals_execF872_Parms F872_Parms;
 	F872_Parms.bioWorld = bioWorld;
@@ -990,10 +946,9 @@ bool UBioAutoConditionals::F872 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F871 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF871 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF871Ref { L"Function PlotManager.BioAutoConditionals.F871", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF871 )
-		pFnF871 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F871" );
+	UFunction* const pFnF871 = pFnF871Ref.Get ( );
 
 	UBioAutoConditionals_execF871_Parms F871_Parms;
 	F871_Parms.bioWorld = bioWorld;
@@ -1013,10 +968,9 @@ bool UBioAutoConditionals::F871 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F870 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF870 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF870Ref { L"Function PlotManager.BioAutoConditionals.F870", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF870 )
-		pFnF870 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F870" );
+	UFunction* const pFnF870 = pFnF870Ref.Get ( );
 
 	UBioAutoConditionals_execF870_Parms F870_Parms;
 	F870_Parms.bioWorld = bioWorld;
@@ -1036,10 +990,9 @@ bool UBioAutoConditionals::F870 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F94 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF94 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF94Ref { L"Function PlotManager.BioAutoConditionals.F94", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF94 )
-		pFnF94 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F94" );
+	UFunction* const pFnF94 = pFnF94Ref.Get ( );
 
 	UBioAutoConditionals_execF94_Parms F94_Parms;
 	F94_Parms.bioWorld = bioWorld;
@@ -1059,10 +1012,9 @@ bool UBioAutoConditionals::F94 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F368 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF368 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF368Ref { L"Function PlotManager.BioAutoConditionals.F368", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF368 )
-		pFnF368 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F368" );
+	UFunction* const pFnF368 = pFnF368Ref.Get ( );
 
 	UBioAutoConditionals_execF368_Parms F368_Parms;
 	F368_Parms.bioWorld = bioWorld;
@@ -1082,10 +1034,9 @@ bool UBioAutoConditionals::F368 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F367 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF367 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF367Ref { L"Function PlotManager.BioAutoConditionals.F367", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF367 )
-		pFnF367 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F367" );
+	UFunction* const pFnF367 = pFnF367Ref.Get ( );
 
 	UBioAutoConditionals_execF367_Parms F367_Parms;
 	F367_Parms.bioWorld = bioWorld;
@@ -1105,10 +1056,9 @@ bool UBioAutoConditionals::F367 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F366 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF366 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF366Ref { L"Function PlotManager.BioAutoConditionals.F366", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF366 )
-		pFnF366 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F366" );
+	UFunction* const pFnF366 = pFnF366Ref.Get ( );
 
 	UBioAutoConditionals_execF366_Parms F366_Parms;
 	F366_Parms.bioWorld = bioWorld;
@@ -1128,10 +1078,9 @@ bool UBioAutoConditionals::F366 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1043 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1043 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1043Ref { L"Function PlotManager.BioAutoConditionals.F1043", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1043 )
-		pFnF1043 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1043" );
+	UFunction* const pFnF1043 = pFnF1043Ref.Get ( );
 
 	UBioAutoConditionals_execF1043_Parms F1043_Parms;
 	F1043_Parms.bioWorld = bioWorld;
@@ -1151,10 +1100,9 @@ bool UBioAutoConditionals::F1043 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1042 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1042 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1042Ref { L"Function PlotManager.BioAutoConditionals.F1042", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1042 )
-		pFnF1042 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1042" );
+	UFunction* const pFnF1042 = pFnF1042Ref.Get ( );
 
 	UBioAutoConditionals_execF1042_Parms F1042_Parms;
 	F1042_Parms.bioWorld = bioWorld;
@@ -1174,10 +1122,9 @@ bool UBioAutoConditionals::F1042 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1041 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1041 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1041Ref { L"Function PlotManager.BioAutoConditionals.F1041", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1041 )
-		pFnF1041 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1041" );
+	UFunction* const pFnF1041 = pFnF1041Ref.Get ( );
 
 	UBioAutoConditionals_execF1041_Parms F1041_Parms;
 	F1041_Parms.bioWorld = bioWorld;
@@ -1197,10 +1144,9 @@ bool UBioAutoConditionals::F1041 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1040 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1040 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1040Ref { L"Function PlotManager.BioAutoConditionals.F1040", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1040 )
-		pFnF1040 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1040" );
+	UFunction* const pFnF1040 = pFnF1040Ref.Get ( );
 
 	UBioAutoConditionals_execF1040_Parms F1040_Parms;
 	F1040_Parms.bioWorld = bioWorld;
@@ -1220,10 +1166,9 @@ bool UBioAutoConditionals::F1040 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1489 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1489 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1489Ref { L"Function PlotManager.BioAutoConditionals.F1489", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1489 )
-		pFnF1489 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1489" );
+	UFunction* const pFnF1489 = pFnF1489Ref.Get ( );
 
 	UBioAutoConditionals_execF1489_Parms F1489_Parms;
 	F1489_Parms.bioWorld = bioWorld;
@@ -1243,10 +1188,9 @@ bool UBioAutoConditionals::F1489 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1488 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1488 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1488Ref { L"Function PlotManager.BioAutoConditionals.F1488", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1488 )
-		pFnF1488 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1488" );
+	UFunction* const pFnF1488 = pFnF1488Ref.Get ( );
 
 	UBioAutoConditionals_execF1488_Parms F1488_Parms;
 	F1488_Parms.bioWorld = bioWorld;
@@ -1266,10 +1210,9 @@ bool UBioAutoConditionals::F1488 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F317 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF317 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF317Ref { L"Function PlotManager.BioAutoConditionals.F317", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF317 )
-		pFnF317 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F317" );
+	UFunction* const pFnF317 = pFnF317Ref.Get ( );
 
 	UBioAutoConditionals_execF317_Parms F317_Parms;
 	F317_Parms.bioWorld = bioWorld;
@@ -1289,10 +1232,9 @@ bool UBioAutoConditionals::F317 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F316 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF316 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF316Ref { L"Function PlotManager.BioAutoConditionals.F316", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF316 )
-		pFnF316 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F316" );
+	UFunction* const pFnF316 = pFnF316Ref.Get ( );
 
 	UBioAutoConditionals_execF316_Parms F316_Parms;
 	F316_Parms.bioWorld = bioWorld;
@@ -1312,10 +1254,9 @@ bool UBioAutoConditionals::F316 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1395 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1395 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1395Ref { L"Function PlotManager.BioAutoConditionals.F1395", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1395 )
-		pFnF1395 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1395" );
+	UFunction* const pFnF1395 = pFnF1395Ref.Get ( );
 
 	UBioAutoConditionals_execF1395_Parms F1395_Parms;
 	F1395_Parms.bioWorld = bioWorld;
@@ -1335,10 +1276,9 @@ bool UBioAutoConditionals::F1395 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1403 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1403 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1403Ref { L"Function PlotManager.BioAutoConditionals.F1403", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1403 )
-		pFnF1403 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1403" );
+	UFunction* const pFnF1403 = pFnF1403Ref.Get ( );
 
 	UBioAutoConditionals_execF1403_Parms F1403_Parms;
 	F1403_Parms.bioWorld = bioWorld;
@@ -1358,10 +1298,9 @@ bool UBioAutoConditionals::F1403 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1405 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1405 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1405Ref { L"Function PlotManager.BioAutoConditionals.F1405", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1405 )
-		pFnF1405 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1405" );
+	UFunction* const pFnF1405 = pFnF1405Ref.Get ( );
 
 	UBioAutoConditionals_execF1405_Parms F1405_Parms;
 	F1405_Parms.bioWorld = bioWorld;
@@ -1381,10 +1320,9 @@ bool UBioAutoConditionals::F1405 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1623 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1623 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1623Ref { L"Function PlotManager.BioAutoConditionals.F1623", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1623 )
-		pFnF1623 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1623" );
+	UFunction* const pFnF1623 = pFnF1623Ref.Get ( );
 
 	UBioAutoConditionals_execF1623_Parms F1623_Parms;
 	F1623_Parms.bioWorld = bioWorld;
@@ -1404,10 +1342,9 @@ bool UBioAutoConditionals::F1623 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1514 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1514 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1514Ref { L"Function PlotManager.BioAutoConditionals.F1514", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1514 )
-		pFnF1514 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1514" );
+	UFunction* const pFnF1514 = pFnF1514Ref.Get ( );
 
 	UBioAutoConditionals_execF1514_Parms F1514_Parms;
 	F1514_Parms.bioWorld = bioWorld;
@@ -1427,10 +1364,9 @@ bool UBioAutoConditionals::F1514 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1407 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1407 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1407Ref { L"Function PlotManager.BioAutoConditionals.F1407", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1407 )
-		pFnF1407 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1407" );
+	UFunction* const pFnF1407 = pFnF1407Ref.Get ( );
 
 	UBioAutoConditionals_execF1407_Parms F1407_Parms;
 	F1407_Parms.bioWorld = bioWorld;
@@ -1450,10 +1386,9 @@ bool UBioAutoConditionals::F1407 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1401 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1401 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1401Ref { L"Function PlotManager.BioAutoConditionals.F1401", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1401 )
-		pFnF1401 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1401" );
+	UFunction* const pFnF1401 = pFnF1401Ref.Get ( );
 
 	UBioAutoConditionals_execF1401_Parms F1401_Parms;
 	F1401_Parms.bioWorld = bioWorld;
@@ -1473,10 +1408,9 @@ bool UBioAutoConditionals::F1401 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1404 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1404 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1404Ref { L"Function PlotManager.BioAutoConditionals.F1404", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1404 )
-		pFnF1404 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1404" );
+	UFunction* const pFnF1404 = pFnF1404Ref.Get ( );
 
 	UBioAutoConditionals_execF1404_Parms F1404_Parms;
 	F1404_Parms.bioWorld = bioWorld;
@@ -1496,10 +1430,9 @@ bool UBioAutoConditionals::F1404 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1387 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1387 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1387Ref { L"Function PlotManager.BioAutoConditionals.F1387", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1387 )
-		pFnF1387 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1387" );
+	UFunction* const pFnF1387 = pFnF1387Ref.Get ( );
 
 	UBioAutoConditionals_execF1387_Parms F1387_Parms;
 	F1387_Parms.bioWorld = bioWorld;
@@ -1519,10 +1452,9 @@ bool UBioAutoConditionals::F1387 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1380 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1380 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1380Ref { L"Function PlotManager.BioAutoConditionals.F1380", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1380 )
-		pFnF1380 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1380" );
+	UFunction* const pFnF1380 = pFnF1380Ref.Get ( );
 
 	UBioAutoConditionals_execF1380_Parms F1380_Parms;
 	F1380_Parms.bioWorld = bioWorld;
@@ -1542,10 +1474,9 @@ bool UBioAutoConditionals::F1380 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1388 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1388 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1388Ref { L"Function PlotManager.BioAutoConditionals.F1388", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1388 )
-		pFnF1388 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1388" );
+	UFunction* const pFnF1388 = pFnF1388Ref.Get ( );
 
 	UBioAutoConditionals_execF1388_Parms F1388_Parms;
 	F1388_Parms.bioWorld = bioWorld;
@@ -1565,10 +1496,9 @@ bool UBioAutoConditionals::F1388 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1381 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1381 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1381Ref { L"Function PlotManager.BioAutoConditionals.F1381", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1381 )
-		pFnF1381 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1381" );
+	UFunction* const pFnF1381 = pFnF1381Ref.Get ( );
 
 	UBioAutoConditionals_execF1381_Parms F1381_Parms;
 	F1381_Parms.bioWorld = bioWorld;
@@ -1588,10 +1518,9 @@ bool UBioAutoConditionals::F1381 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1406 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1406 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1406Ref { L"Function PlotManager.BioAutoConditionals.F1406", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1406 )
-		pFnF1406 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1406" );
+	UFunction* const pFnF1406 = pFnF1406Ref.Get ( );
 
 	UBioAutoConditionals_execF1406_Parms F1406_Parms;
 	F1406_Parms.bioWorld = bioWorld;
@@ -1611,10 +1540,9 @@ bool UBioAutoConditionals::F1406 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1402 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1402 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1402Ref { L"Function PlotManager.BioAutoConditionals.F1402", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1402 )
-		pFnF1402 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1402" );
+	UFunction* const pFnF1402 = pFnF1402Ref.Get ( );
 
 	UBioAutoConditionals_execF1402_Parms F1402_Parms;
 	F1402_Parms.bioWorld = bioWorld;
@@ -1634,10 +1562,9 @@ bool UBioAutoConditionals::F1402 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1393 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1393 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1393Ref { L"Function PlotManager.BioAutoConditionals.F1393", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1393 )
-		pFnF1393 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1393" );
+	UFunction* const pFnF1393 = pFnF1393Ref.Get ( );
 
 	UBioAutoConditionals_execF1393_Parms F1393_Parms;
 	F1393_Parms.bioWorld = bioWorld;
@@ -1657,10 +1584,9 @@ bool UBioAutoConditionals::F1393 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1359 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1359 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1359Ref { L"Function PlotManager.BioAutoConditionals.F1359", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1359 )
-		pFnF1359 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1359" );
+	UFunction* const pFnF1359 = pFnF1359Ref.Get ( );
 
 	UBioAutoConditionals_execF1359_Parms F1359_Parms;
 	F1359_Parms.bioWorld = bioWorld;
@@ -1680,10 +1606,9 @@ bool UBioAutoConditionals::F1359 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1373 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1373 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1373Ref { L"Function PlotManager.BioAutoConditionals.F1373", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1373 )
-		pFnF1373 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1373" );
+	UFunction* const pFnF1373 = pFnF1373Ref.Get ( );
 
 	UBioAutoConditionals_execF1373_Parms F1373_Parms;
 	F1373_Parms.bioWorld = bioWorld;
@@ -1703,10 +1628,9 @@ bool UBioAutoConditionals::F1373 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1236 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1236 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1236Ref { L"Function PlotManager.BioAutoConditionals.F1236", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1236 )
-		pFnF1236 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1236" );
+	UFunction* const pFnF1236 = pFnF1236Ref.Get ( );
 
 	UBioAutoConditionals_execF1236_Parms F1236_Parms;
 	F1236_Parms.bioWorld = bioWorld;
@@ -1726,10 +1650,9 @@ bool UBioAutoConditionals::F1236 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1385 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1385 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1385Ref { L"Function PlotManager.BioAutoConditionals.F1385", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1385 )
-		pFnF1385 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1385" );
+	UFunction* const pFnF1385 = pFnF1385Ref.Get ( );
 
 	UBioAutoConditionals_execF1385_Parms F1385_Parms;
 	F1385_Parms.bioWorld = bioWorld;
@@ -1749,10 +1672,9 @@ bool UBioAutoConditionals::F1385 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1379 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1379 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1379Ref { L"Function PlotManager.BioAutoConditionals.F1379", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1379 )
-		pFnF1379 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1379" );
+	UFunction* const pFnF1379 = pFnF1379Ref.Get ( );
 
 	UBioAutoConditionals_execF1379_Parms F1379_Parms;
 	F1379_Parms.bioWorld = bioWorld;
@@ -1772,10 +1694,9 @@ bool UBioAutoConditionals::F1379 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1378 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1378 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1378Ref { L"Function PlotManager.BioAutoConditionals.F1378", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1378 )
-		pFnF1378 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1378" );
+	UFunction* const pFnF1378 = pFnF1378Ref.Get ( );
 
 	UBioAutoConditionals_execF1378_Parms F1378_Parms;
 	F1378_Parms.bioWorld = bioWorld;
@@ -1795,10 +1716,9 @@ bool UBioAutoConditionals::F1378 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1384 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1384 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1384Ref { L"Function PlotManager.BioAutoConditionals.F1384", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1384 )
-		pFnF1384 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1384" );
+	UFunction* const pFnF1384 = pFnF1384Ref.Get ( );
 
 	UBioAutoConditionals_execF1384_Parms F1384_Parms;
 	F1384_Parms.bioWorld = bioWorld;
@@ -1818,10 +1738,9 @@ bool UBioAutoConditionals::F1384 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1386 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1386 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1386Ref { L"Function PlotManager.BioAutoConditionals.F1386", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1386 )
-		pFnF1386 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1386" );
+	UFunction* const pFnF1386 = pFnF1386Ref.Get ( );
 
 	UBioAutoConditionals_execF1386_Parms F1386_Parms;
 	F1386_Parms.bioWorld = bioWorld;
@@ -1841,10 +1760,9 @@ bool UBioAutoConditionals::F1386 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1377 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1377 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1377Ref { L"Function PlotManager.BioAutoConditionals.F1377", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1377 )
-		pFnF1377 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1377" );
+	UFunction* const pFnF1377 = pFnF1377Ref.Get ( );
 
 	UBioAutoConditionals_execF1377_Parms F1377_Parms;
 	F1377_Parms.bioWorld = bioWorld;
@@ -1864,10 +1782,9 @@ bool UBioAutoConditionals::F1377 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1376 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1376 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1376Ref { L"Function PlotManager.BioAutoConditionals.F1376", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1376 )
-		pFnF1376 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1376" );
+	UFunction* const pFnF1376 = pFnF1376Ref.Get ( );
 
 	UBioAutoConditionals_execF1376_Parms F1376_Parms;
 	F1376_Parms.bioWorld = bioWorld;
@@ -1887,10 +1804,9 @@ bool UBioAutoConditionals::F1376 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1235 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1235 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1235Ref { L"Function PlotManager.BioAutoConditionals.F1235", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1235 )
-		pFnF1235 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1235" );
+	UFunction* const pFnF1235 = pFnF1235Ref.Get ( );
 
 	UBioAutoConditionals_execF1235_Parms F1235_Parms;
 	F1235_Parms.bioWorld = bioWorld;
@@ -1910,10 +1826,9 @@ bool UBioAutoConditionals::F1235 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1390 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1390 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1390Ref { L"Function PlotManager.BioAutoConditionals.F1390", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1390 )
-		pFnF1390 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1390" );
+	UFunction* const pFnF1390 = pFnF1390Ref.Get ( );
 
 	UBioAutoConditionals_execF1390_Parms F1390_Parms;
 	F1390_Parms.bioWorld = bioWorld;
@@ -1933,10 +1848,9 @@ bool UBioAutoConditionals::F1390 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1485 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1485 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1485Ref { L"Function PlotManager.BioAutoConditionals.F1485", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1485 )
-		pFnF1485 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1485" );
+	UFunction* const pFnF1485 = pFnF1485Ref.Get ( );
 
 	UBioAutoConditionals_execF1485_Parms F1485_Parms;
 	F1485_Parms.bioWorld = bioWorld;
@@ -1956,10 +1870,9 @@ bool UBioAutoConditionals::F1485 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1374 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1374 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1374Ref { L"Function PlotManager.BioAutoConditionals.F1374", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1374 )
-		pFnF1374 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1374" );
+	UFunction* const pFnF1374 = pFnF1374Ref.Get ( );
 
 	UBioAutoConditionals_execF1374_Parms F1374_Parms;
 	F1374_Parms.bioWorld = bioWorld;
@@ -1979,10 +1892,9 @@ bool UBioAutoConditionals::F1374 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1366 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1366 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1366Ref { L"Function PlotManager.BioAutoConditionals.F1366", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1366 )
-		pFnF1366 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1366" );
+	UFunction* const pFnF1366 = pFnF1366Ref.Get ( );
 
 	UBioAutoConditionals_execF1366_Parms F1366_Parms;
 	F1366_Parms.bioWorld = bioWorld;
@@ -2002,10 +1914,9 @@ bool UBioAutoConditionals::F1366 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1199 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1199 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1199Ref { L"Function PlotManager.BioAutoConditionals.F1199", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1199 )
-		pFnF1199 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1199" );
+	UFunction* const pFnF1199 = pFnF1199Ref.Get ( );
 
 	UBioAutoConditionals_execF1199_Parms F1199_Parms;
 	F1199_Parms.bioWorld = bioWorld;
@@ -2025,10 +1936,9 @@ bool UBioAutoConditionals::F1199 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1383 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1383 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1383Ref { L"Function PlotManager.BioAutoConditionals.F1383", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1383 )
-		pFnF1383 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1383" );
+	UFunction* const pFnF1383 = pFnF1383Ref.Get ( );
 
 	UBioAutoConditionals_execF1383_Parms F1383_Parms;
 	F1383_Parms.bioWorld = bioWorld;
@@ -2048,10 +1958,9 @@ bool UBioAutoConditionals::F1383 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1375 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1375 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1375Ref { L"Function PlotManager.BioAutoConditionals.F1375", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1375 )
-		pFnF1375 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1375" );
+	UFunction* const pFnF1375 = pFnF1375Ref.Get ( );
 
 	UBioAutoConditionals_execF1375_Parms F1375_Parms;
 	F1375_Parms.bioWorld = bioWorld;
@@ -2071,10 +1980,9 @@ bool UBioAutoConditionals::F1375 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1234 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1234 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1234Ref { L"Function PlotManager.BioAutoConditionals.F1234", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1234 )
-		pFnF1234 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1234" );
+	UFunction* const pFnF1234 = pFnF1234Ref.Get ( );
 
 	UBioAutoConditionals_execF1234_Parms F1234_Parms;
 	F1234_Parms.bioWorld = bioWorld;
@@ -2094,10 +2002,9 @@ bool UBioAutoConditionals::F1234 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1512 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1512 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1512Ref { L"Function PlotManager.BioAutoConditionals.F1512", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1512 )
-		pFnF1512 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1512" );
+	UFunction* const pFnF1512 = pFnF1512Ref.Get ( );
 
 	UBioAutoConditionals_execF1512_Parms F1512_Parms;
 	F1512_Parms.bioWorld = bioWorld;
@@ -2117,10 +2024,9 @@ bool UBioAutoConditionals::F1512 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1392 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1392 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1392Ref { L"Function PlotManager.BioAutoConditionals.F1392", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1392 )
-		pFnF1392 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1392" );
+	UFunction* const pFnF1392 = pFnF1392Ref.Get ( );
 
 	UBioAutoConditionals_execF1392_Parms F1392_Parms;
 	F1392_Parms.bioWorld = bioWorld;
@@ -2140,10 +2046,9 @@ bool UBioAutoConditionals::F1392 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F269 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF269 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF269Ref { L"Function PlotManager.BioAutoConditionals.F269", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF269 )
-		pFnF269 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F269" );
+	UFunction* const pFnF269 = pFnF269Ref.Get ( );
 
 	UBioAutoConditionals_execF269_Parms F269_Parms;
 	F269_Parms.bioWorld = bioWorld;
@@ -2163,10 +2068,9 @@ bool UBioAutoConditionals::F269 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F268 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF268 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF268Ref { L"Function PlotManager.BioAutoConditionals.F268", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF268 )
-		pFnF268 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F268" );
+	UFunction* const pFnF268 = pFnF268Ref.Get ( );
 
 	UBioAutoConditionals_execF268_Parms F268_Parms;
 	F268_Parms.bioWorld = bioWorld;
@@ -2186,10 +2090,9 @@ bool UBioAutoConditionals::F268 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F267 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF267 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF267Ref { L"Function PlotManager.BioAutoConditionals.F267", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF267 )
-		pFnF267 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F267" );
+	UFunction* const pFnF267 = pFnF267Ref.Get ( );
 
 	UBioAutoConditionals_execF267_Parms F267_Parms;
 	F267_Parms.bioWorld = bioWorld;
@@ -2209,10 +2112,9 @@ bool UBioAutoConditionals::F267 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F326 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF326 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF326Ref { L"Function PlotManager.BioAutoConditionals.F326", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF326 )
-		pFnF326 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F326" );
+	UFunction* const pFnF326 = pFnF326Ref.Get ( );
 
 	UBioAutoConditionals_execF326_Parms F326_Parms;
 	F326_Parms.bioWorld = bioWorld;
@@ -2232,10 +2134,9 @@ bool UBioAutoConditionals::F326 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F325 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF325 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF325Ref { L"Function PlotManager.BioAutoConditionals.F325", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF325 )
-		pFnF325 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F325" );
+	UFunction* const pFnF325 = pFnF325Ref.Get ( );
 
 	UBioAutoConditionals_execF325_Parms F325_Parms;
 	F325_Parms.bioWorld = bioWorld;
@@ -2255,10 +2156,9 @@ bool UBioAutoConditionals::F325 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F289 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF289 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF289Ref { L"Function PlotManager.BioAutoConditionals.F289", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF289 )
-		pFnF289 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F289" );
+	UFunction* const pFnF289 = pFnF289Ref.Get ( );
 
 	UBioAutoConditionals_execF289_Parms F289_Parms;
 	F289_Parms.bioWorld = bioWorld;
@@ -2278,10 +2178,9 @@ bool UBioAutoConditionals::F289 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F288 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF288 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF288Ref { L"Function PlotManager.BioAutoConditionals.F288", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF288 )
-		pFnF288 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F288" );
+	UFunction* const pFnF288 = pFnF288Ref.Get ( );
 
 	UBioAutoConditionals_execF288_Parms F288_Parms;
 	F288_Parms.bioWorld = bioWorld;
@@ -2301,10 +2200,9 @@ bool UBioAutoConditionals::F288 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F286 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF286 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF286Ref { L"Function PlotManager.BioAutoConditionals.F286", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF286 )
-		pFnF286 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F286" );
+	UFunction* const pFnF286 = pFnF286Ref.Get ( );
 
 	UBioAutoConditionals_execF286_Parms F286_Parms;
 	F286_Parms.bioWorld = bioWorld;
@@ -2324,10 +2222,9 @@ bool UBioAutoConditionals::F286 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F285 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF285 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF285Ref { L"Function PlotManager.BioAutoConditionals.F285", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF285 )
-		pFnF285 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F285" );
+	UFunction* const pFnF285 = pFnF285Ref.Get ( );
 
 	UBioAutoConditionals_execF285_Parms F285_Parms;
 	F285_Parms.bioWorld = bioWorld;
@@ -2347,10 +2244,9 @@ bool UBioAutoConditionals::F285 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F284 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF284 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF284Ref { L"Function PlotManager.BioAutoConditionals.F284", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF284 )
-		pFnF284 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F284" );
+	UFunction* const pFnF284 = pFnF284Ref.Get ( );
 
 	UBioAutoConditionals_execF284_Parms F284_Parms;
 	F284_Parms.bioWorld = bioWorld;
@@ -2370,10 +2266,9 @@ bool UBioAutoConditionals::F284 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F281 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF281 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF281Ref { L"Function PlotManager.BioAutoConditionals.F281", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF281 )
-		pFnF281 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F281" );
+	UFunction* const pFnF281 = pFnF281Ref.Get ( );
 
 	UBioAutoConditionals_execF281_Parms F281_Parms;
 	F281_Parms.bioWorld = bioWorld;
@@ -2393,10 +2288,9 @@ bool UBioAutoConditionals::F281 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F272 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF272 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF272Ref { L"Function PlotManager.BioAutoConditionals.F272", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF272 )
-		pFnF272 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F272" );
+	UFunction* const pFnF272 = pFnF272Ref.Get ( );
 
 	UBioAutoConditionals_execF272_Parms F272_Parms;
 	F272_Parms.bioWorld = bioWorld;
@@ -2416,10 +2310,9 @@ bool UBioAutoConditionals::F272 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F271 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF271 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF271Ref { L"Function PlotManager.BioAutoConditionals.F271", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF271 )
-		pFnF271 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F271" );
+	UFunction* const pFnF271 = pFnF271Ref.Get ( );
 
 	UBioAutoConditionals_execF271_Parms F271_Parms;
 	F271_Parms.bioWorld = bioWorld;
@@ -2439,10 +2332,9 @@ bool UBioAutoConditionals::F271 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F270 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF270 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF270Ref { L"Function PlotManager.BioAutoConditionals.F270", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF270 )
-		pFnF270 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F270" );
+	UFunction* const pFnF270 = pFnF270Ref.Get ( );
 
 	UBioAutoConditionals_execF270_Parms F270_Parms;
 	F270_Parms.bioWorld = bioWorld;
@@ -2462,10 +2354,9 @@ bool UBioAutoConditionals::F270 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F266 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF266 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF266Ref { L"Function PlotManager.BioAutoConditionals.F266", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF266 )
-		pFnF266 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F266" );
+	UFunction* const pFnF266 = pFnF266Ref.Get ( );
 
 	UBioAutoConditionals_execF266_Parms F266_Parms;
 	F266_Parms.bioWorld = bioWorld;
@@ -2485,10 +2376,9 @@ bool UBioAutoConditionals::F266 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F265 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF265 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF265Ref { L"Function PlotManager.BioAutoConditionals.F265", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF265 )
-		pFnF265 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F265" );
+	UFunction* const pFnF265 = pFnF265Ref.Get ( );
 
 	UBioAutoConditionals_execF265_Parms F265_Parms;
 	F265_Parms.bioWorld = bioWorld;
@@ -2508,10 +2398,9 @@ bool UBioAutoConditionals::F265 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F264 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF264 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF264Ref { L"Function PlotManager.BioAutoConditionals.F264", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF264 )
-		pFnF264 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F264" );
+	UFunction* const pFnF264 = pFnF264Ref.Get ( );
 
 	UBioAutoConditionals_execF264_Parms F264_Parms;
 	F264_Parms.bioWorld = bioWorld;
@@ -2531,10 +2420,9 @@ bool UBioAutoConditionals::F264 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F261 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF261 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF261Ref { L"Function PlotManager.BioAutoConditionals.F261", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF261 )
-		pFnF261 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F261" );
+	UFunction* const pFnF261 = pFnF261Ref.Get ( );
 
 	UBioAutoConditionals_execF261_Parms F261_Parms;
 	F261_Parms.bioWorld = bioWorld;
@@ -2554,10 +2442,9 @@ bool UBioAutoConditionals::F261 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F260 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF260 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF260Ref { L"Function PlotManager.BioAutoConditionals.F260", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF260 )
-		pFnF260 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F260" );
+	UFunction* const pFnF260 = pFnF260Ref.Get ( );
 
 	UBioAutoConditionals_execF260_Parms F260_Parms;
 	F260_Parms.bioWorld = bioWorld;
@@ -2577,10 +2464,9 @@ bool UBioAutoConditionals::F260 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F259 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF259 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF259Ref { L"Function PlotManager.BioAutoConditionals.F259", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF259 )
-		pFnF259 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F259" );
+	UFunction* const pFnF259 = pFnF259Ref.Get ( );
 
 	UBioAutoConditionals_execF259_Parms F259_Parms;
 	F259_Parms.bioWorld = bioWorld;
@@ -2600,10 +2486,9 @@ bool UBioAutoConditionals::F259 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F483 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF483 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF483Ref { L"Function PlotManager.BioAutoConditionals.F483", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF483 )
-		pFnF483 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F483" );
+	UFunction* const pFnF483 = pFnF483Ref.Get ( );
 
 	UBioAutoConditionals_execF483_Parms F483_Parms;
 	F483_Parms.bioWorld = bioWorld;
@@ -2623,10 +2508,9 @@ bool UBioAutoConditionals::F483 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F482 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF482 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF482Ref { L"Function PlotManager.BioAutoConditionals.F482", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF482 )
-		pFnF482 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F482" );
+	UFunction* const pFnF482 = pFnF482Ref.Get ( );
 
 	UBioAutoConditionals_execF482_Parms F482_Parms;
 	F482_Parms.bioWorld = bioWorld;
@@ -2646,10 +2530,9 @@ bool UBioAutoConditionals::F482 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F481 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF481 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF481Ref { L"Function PlotManager.BioAutoConditionals.F481", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF481 )
-		pFnF481 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F481" );
+	UFunction* const pFnF481 = pFnF481Ref.Get ( );
 
 	UBioAutoConditionals_execF481_Parms F481_Parms;
 	F481_Parms.bioWorld = bioWorld;
@@ -2669,10 +2552,9 @@ bool UBioAutoConditionals::F481 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F480 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF480 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF480Ref { L"Function PlotManager.BioAutoConditionals.F480", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF480 )
-		pFnF480 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F480" );
+	UFunction* const pFnF480 = pFnF480Ref.Get ( );
 
 	UBioAutoConditionals_execF480_Parms F480_Parms;
 	F480_Parms.bioWorld = bioWorld;
@@ -2692,10 +2574,9 @@ bool UBioAutoConditionals::F480 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F479 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF479 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF479Ref { L"Function PlotManager.BioAutoConditionals.F479", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF479 )
-		pFnF479 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F479" );
+	UFunction* const pFnF479 = pFnF479Ref.Get ( );
 
 	UBioAutoConditionals_execF479_Parms F479_Parms;
 	F479_Parms.bioWorld = bioWorld;
@@ -2715,10 +2596,9 @@ bool UBioAutoConditionals::F479 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F478 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF478 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF478Ref { L"Function PlotManager.BioAutoConditionals.F478", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF478 )
-		pFnF478 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F478" );
+	UFunction* const pFnF478 = pFnF478Ref.Get ( );
 
 	UBioAutoConditionals_execF478_Parms F478_Parms;
 	F478_Parms.bioWorld = bioWorld;
@@ -2738,10 +2618,9 @@ bool UBioAutoConditionals::F478 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F562 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF562 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF562Ref { L"Function PlotManager.BioAutoConditionals.F562", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF562 )
-		pFnF562 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F562" );
+	UFunction* const pFnF562 = pFnF562Ref.Get ( );
 
 	UBioAutoConditionals_execF562_Parms F562_Parms;
 	F562_Parms.bioWorld = bioWorld;
@@ -2761,10 +2640,9 @@ bool UBioAutoConditionals::F562 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F473 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF473 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF473Ref { L"Function PlotManager.BioAutoConditionals.F473", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF473 )
-		pFnF473 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F473" );
+	UFunction* const pFnF473 = pFnF473Ref.Get ( );
 
 	UBioAutoConditionals_execF473_Parms F473_Parms;
 	F473_Parms.bioWorld = bioWorld;
@@ -2784,10 +2662,9 @@ bool UBioAutoConditionals::F473 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F472 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF472 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF472Ref { L"Function PlotManager.BioAutoConditionals.F472", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF472 )
-		pFnF472 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F472" );
+	UFunction* const pFnF472 = pFnF472Ref.Get ( );
 
 	UBioAutoConditionals_execF472_Parms F472_Parms;
 	F472_Parms.bioWorld = bioWorld;
@@ -2807,10 +2684,9 @@ bool UBioAutoConditionals::F472 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F470 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF470 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF470Ref { L"Function PlotManager.BioAutoConditionals.F470", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF470 )
-		pFnF470 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F470" );
+	UFunction* const pFnF470 = pFnF470Ref.Get ( );
 
 	UBioAutoConditionals_execF470_Parms F470_Parms;
 	F470_Parms.bioWorld = bioWorld;
@@ -2830,10 +2706,9 @@ bool UBioAutoConditionals::F470 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2045 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2045 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2045Ref { L"Function PlotManager.BioAutoConditionals.F2045", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2045 )
-		pFnF2045 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2045" );
+	UFunction* const pFnF2045 = pFnF2045Ref.Get ( );
 
 	UBioAutoConditionals_execF2045_Parms F2045_Parms;
 	F2045_Parms.bioWorld = bioWorld;
@@ -2853,10 +2728,9 @@ bool UBioAutoConditionals::F2045 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F468 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF468 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF468Ref { L"Function PlotManager.BioAutoConditionals.F468", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF468 )
-		pFnF468 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F468" );
+	UFunction* const pFnF468 = pFnF468Ref.Get ( );
 
 	UBioAutoConditionals_execF468_Parms F468_Parms;
 	F468_Parms.bioWorld = bioWorld;
@@ -2876,10 +2750,9 @@ bool UBioAutoConditionals::F468 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F582 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF582 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF582Ref { L"Function PlotManager.BioAutoConditionals.F582", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF582 )
-		pFnF582 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F582" );
+	UFunction* const pFnF582 = pFnF582Ref.Get ( );
 
 	UBioAutoConditionals_execF582_Parms F582_Parms;
 	F582_Parms.bioWorld = bioWorld;
@@ -2899,10 +2772,9 @@ bool UBioAutoConditionals::F582 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F581 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF581 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF581Ref { L"Function PlotManager.BioAutoConditionals.F581", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF581 )
-		pFnF581 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F581" );
+	UFunction* const pFnF581 = pFnF581Ref.Get ( );
 
 	UBioAutoConditionals_execF581_Parms F581_Parms;
 	F581_Parms.bioWorld = bioWorld;
@@ -2922,10 +2794,9 @@ bool UBioAutoConditionals::F581 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2040 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2040 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2040Ref { L"Function PlotManager.BioAutoConditionals.F2040", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2040 )
-		pFnF2040 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2040" );
+	UFunction* const pFnF2040 = pFnF2040Ref.Get ( );
 
 	UBioAutoConditionals_execF2040_Parms F2040_Parms;
 	F2040_Parms.bioWorld = bioWorld;
@@ -2945,10 +2816,9 @@ bool UBioAutoConditionals::F2040 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F580 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF580 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF580Ref { L"Function PlotManager.BioAutoConditionals.F580", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF580 )
-		pFnF580 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F580" );
+	UFunction* const pFnF580 = pFnF580Ref.Get ( );
 
 	UBioAutoConditionals_execF580_Parms F580_Parms;
 	F580_Parms.bioWorld = bioWorld;
@@ -2968,10 +2838,9 @@ bool UBioAutoConditionals::F580 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F579 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF579 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF579Ref { L"Function PlotManager.BioAutoConditionals.F579", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF579 )
-		pFnF579 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F579" );
+	UFunction* const pFnF579 = pFnF579Ref.Get ( );
 
 	UBioAutoConditionals_execF579_Parms F579_Parms;
 	F579_Parms.bioWorld = bioWorld;
@@ -2991,10 +2860,9 @@ bool UBioAutoConditionals::F579 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F578 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF578 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF578Ref { L"Function PlotManager.BioAutoConditionals.F578", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF578 )
-		pFnF578 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F578" );
+	UFunction* const pFnF578 = pFnF578Ref.Get ( );
 
 	UBioAutoConditionals_execF578_Parms F578_Parms;
 	F578_Parms.bioWorld = bioWorld;
@@ -3014,10 +2882,9 @@ bool UBioAutoConditionals::F578 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F577 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF577 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF577Ref { L"Function PlotManager.BioAutoConditionals.F577", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF577 )
-		pFnF577 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F577" );
+	UFunction* const pFnF577 = pFnF577Ref.Get ( );
 
 	UBioAutoConditionals_execF577_Parms F577_Parms;
 	F577_Parms.bioWorld = bioWorld;
@@ -3037,10 +2904,9 @@ bool UBioAutoConditionals::F577 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F516 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF516 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF516Ref { L"Function PlotManager.BioAutoConditionals.F516", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF516 )
-		pFnF516 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F516" );
+	UFunction* const pFnF516 = pFnF516Ref.Get ( );
 
 	UBioAutoConditionals_execF516_Parms F516_Parms;
 	F516_Parms.bioWorld = bioWorld;
@@ -3060,10 +2926,9 @@ bool UBioAutoConditionals::F516 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F451 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF451 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF451Ref { L"Function PlotManager.BioAutoConditionals.F451", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF451 )
-		pFnF451 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F451" );
+	UFunction* const pFnF451 = pFnF451Ref.Get ( );
 
 	UBioAutoConditionals_execF451_Parms F451_Parms;
 	F451_Parms.bioWorld = bioWorld;
@@ -3083,10 +2948,9 @@ bool UBioAutoConditionals::F451 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F458 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF458 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF458Ref { L"Function PlotManager.BioAutoConditionals.F458", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF458 )
-		pFnF458 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F458" );
+	UFunction* const pFnF458 = pFnF458Ref.Get ( );
 
 	UBioAutoConditionals_execF458_Parms F458_Parms;
 	F458_Parms.bioWorld = bioWorld;
@@ -3106,10 +2970,9 @@ bool UBioAutoConditionals::F458 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1572 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1572 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1572Ref { L"Function PlotManager.BioAutoConditionals.F1572", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1572 )
-		pFnF1572 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1572" );
+	UFunction* const pFnF1572 = pFnF1572Ref.Get ( );
 
 	UBioAutoConditionals_execF1572_Parms F1572_Parms;
 	F1572_Parms.bioWorld = bioWorld;
@@ -3129,10 +2992,9 @@ bool UBioAutoConditionals::F1572 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1513 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1513 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1513Ref { L"Function PlotManager.BioAutoConditionals.F1513", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1513 )
-		pFnF1513 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1513" );
+	UFunction* const pFnF1513 = pFnF1513Ref.Get ( );
 
 	UBioAutoConditionals_execF1513_Parms F1513_Parms;
 	F1513_Parms.bioWorld = bioWorld;
@@ -3152,10 +3014,9 @@ bool UBioAutoConditionals::F1513 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1350 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1350 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1350Ref { L"Function PlotManager.BioAutoConditionals.F1350", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1350 )
-		pFnF1350 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1350" );
+	UFunction* const pFnF1350 = pFnF1350Ref.Get ( );
 
 	UBioAutoConditionals_execF1350_Parms F1350_Parms;
 	F1350_Parms.bioWorld = bioWorld;
@@ -3175,10 +3036,9 @@ bool UBioAutoConditionals::F1350 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1352 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1352 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1352Ref { L"Function PlotManager.BioAutoConditionals.F1352", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1352 )
-		pFnF1352 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1352" );
+	UFunction* const pFnF1352 = pFnF1352Ref.Get ( );
 
 	UBioAutoConditionals_execF1352_Parms F1352_Parms;
 	F1352_Parms.bioWorld = bioWorld;
@@ -3198,10 +3058,9 @@ bool UBioAutoConditionals::F1352 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F484 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF484 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF484Ref { L"Function PlotManager.BioAutoConditionals.F484", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF484 )
-		pFnF484 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F484" );
+	UFunction* const pFnF484 = pFnF484Ref.Get ( );
 
 	UBioAutoConditionals_execF484_Parms F484_Parms;
 	F484_Parms.bioWorld = bioWorld;
@@ -3221,10 +3080,9 @@ bool UBioAutoConditionals::F484 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F513 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF513 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF513Ref { L"Function PlotManager.BioAutoConditionals.F513", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF513 )
-		pFnF513 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F513" );
+	UFunction* const pFnF513 = pFnF513Ref.Get ( );
 
 	UBioAutoConditionals_execF513_Parms F513_Parms;
 	F513_Parms.bioWorld = bioWorld;
@@ -3244,10 +3102,9 @@ bool UBioAutoConditionals::F513 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F414 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF414 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF414Ref { L"Function PlotManager.BioAutoConditionals.F414", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF414 )
-		pFnF414 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F414" );
+	UFunction* const pFnF414 = pFnF414Ref.Get ( );
 
 	UBioAutoConditionals_execF414_Parms F414_Parms;
 	F414_Parms.bioWorld = bioWorld;
@@ -3267,10 +3124,9 @@ bool UBioAutoConditionals::F414 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F409 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF409 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF409Ref { L"Function PlotManager.BioAutoConditionals.F409", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF409 )
-		pFnF409 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F409" );
+	UFunction* const pFnF409 = pFnF409Ref.Get ( );
 
 	UBioAutoConditionals_execF409_Parms F409_Parms;
 	F409_Parms.bioWorld = bioWorld;
@@ -3290,10 +3146,9 @@ bool UBioAutoConditionals::F409 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1242 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1242 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1242Ref { L"Function PlotManager.BioAutoConditionals.F1242", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1242 )
-		pFnF1242 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1242" );
+	UFunction* const pFnF1242 = pFnF1242Ref.Get ( );
 
 	UBioAutoConditionals_execF1242_Parms F1242_Parms;
 	F1242_Parms.bioWorld = bioWorld;
@@ -3313,10 +3168,9 @@ bool UBioAutoConditionals::F1242 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F262 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF262 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF262Ref { L"Function PlotManager.BioAutoConditionals.F262", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF262 )
-		pFnF262 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F262" );
+	UFunction* const pFnF262 = pFnF262Ref.Get ( );
 
 	UBioAutoConditionals_execF262_Parms F262_Parms;
 	F262_Parms.bioWorld = bioWorld;
@@ -3336,10 +3190,9 @@ bool UBioAutoConditionals::F262 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F853 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF853 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF853Ref { L"Function PlotManager.BioAutoConditionals.F853", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF853 )
-		pFnF853 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F853" );
+	UFunction* const pFnF853 = pFnF853Ref.Get ( );
 
 	UBioAutoConditionals_execF853_Parms F853_Parms;
 	F853_Parms.bioWorld = bioWorld;
@@ -3359,10 +3212,9 @@ bool UBioAutoConditionals::F853 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1306 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1306 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1306Ref { L"Function PlotManager.BioAutoConditionals.F1306", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1306 )
-		pFnF1306 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1306" );
+	UFunction* const pFnF1306 = pFnF1306Ref.Get ( );
 
 	UBioAutoConditionals_execF1306_Parms F1306_Parms;
 	F1306_Parms.bioWorld = bioWorld;
@@ -3382,10 +3234,9 @@ bool UBioAutoConditionals::F1306 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F520 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF520 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF520Ref { L"Function PlotManager.BioAutoConditionals.F520", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF520 )
-		pFnF520 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F520" );
+	UFunction* const pFnF520 = pFnF520Ref.Get ( );
 
 	UBioAutoConditionals_execF520_Parms F520_Parms;
 	F520_Parms.bioWorld = bioWorld;
@@ -3405,10 +3256,9 @@ bool UBioAutoConditionals::F520 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F519 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF519 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF519Ref { L"Function PlotManager.BioAutoConditionals.F519", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF519 )
-		pFnF519 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F519" );
+	UFunction* const pFnF519 = pFnF519Ref.Get ( );
 
 	UBioAutoConditionals_execF519_Parms F519_Parms;
 	F519_Parms.bioWorld = bioWorld;
@@ -3428,10 +3278,9 @@ bool UBioAutoConditionals::F519 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F518 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF518 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF518Ref { L"Function PlotManager.BioAutoConditionals.F518", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF518 )
-		pFnF518 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F518" );
+	UFunction* const pFnF518 = pFnF518Ref.Get ( );
 
 	UBioAutoConditionals_execF518_Parms F518_Parms;
 	F518_Parms.bioWorld = bioWorld;
@@ -3451,10 +3300,9 @@ bool UBioAutoConditionals::F518 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F517 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF517 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF517Ref { L"Function PlotManager.BioAutoConditionals.F517", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF517 )
-		pFnF517 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F517" );
+	UFunction* const pFnF517 = pFnF517Ref.Get ( );
 
 	UBioAutoConditionals_execF517_Parms F517_Parms;
 	F517_Parms.bioWorld = bioWorld;
@@ -3474,10 +3322,9 @@ bool UBioAutoConditionals::F517 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F515 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF515 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF515Ref { L"Function PlotManager.BioAutoConditionals.F515", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF515 )
-		pFnF515 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F515" );
+	UFunction* const pFnF515 = pFnF515Ref.Get ( );
 
 	UBioAutoConditionals_execF515_Parms F515_Parms;
 	F515_Parms.bioWorld = bioWorld;
@@ -3497,10 +3344,9 @@ bool UBioAutoConditionals::F515 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F514 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF514 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF514Ref { L"Function PlotManager.BioAutoConditionals.F514", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF514 )
-		pFnF514 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F514" );
+	UFunction* const pFnF514 = pFnF514Ref.Get ( );
 
 	UBioAutoConditionals_execF514_Parms F514_Parms;
 	F514_Parms.bioWorld = bioWorld;
@@ -3520,10 +3366,9 @@ bool UBioAutoConditionals::F514 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F292 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF292 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF292Ref { L"Function PlotManager.BioAutoConditionals.F292", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF292 )
-		pFnF292 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F292" );
+	UFunction* const pFnF292 = pFnF292Ref.Get ( );
 
 	UBioAutoConditionals_execF292_Parms F292_Parms;
 	F292_Parms.bioWorld = bioWorld;
@@ -3543,10 +3388,9 @@ bool UBioAutoConditionals::F292 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F290 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF290 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF290Ref { L"Function PlotManager.BioAutoConditionals.F290", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF290 )
-		pFnF290 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F290" );
+	UFunction* const pFnF290 = pFnF290Ref.Get ( );
 
 	UBioAutoConditionals_execF290_Parms F290_Parms;
 	F290_Parms.bioWorld = bioWorld;
@@ -3566,10 +3410,9 @@ bool UBioAutoConditionals::F290 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F278 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF278 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF278Ref { L"Function PlotManager.BioAutoConditionals.F278", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF278 )
-		pFnF278 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F278" );
+	UFunction* const pFnF278 = pFnF278Ref.Get ( );
 
 	UBioAutoConditionals_execF278_Parms F278_Parms;
 	F278_Parms.bioWorld = bioWorld;
@@ -3589,10 +3432,9 @@ bool UBioAutoConditionals::F278 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F277 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF277 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF277Ref { L"Function PlotManager.BioAutoConditionals.F277", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF277 )
-		pFnF277 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F277" );
+	UFunction* const pFnF277 = pFnF277Ref.Get ( );
 
 	UBioAutoConditionals_execF277_Parms F277_Parms;
 	F277_Parms.bioWorld = bioWorld;
@@ -3612,10 +3454,9 @@ bool UBioAutoConditionals::F277 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F273 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF273 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF273Ref { L"Function PlotManager.BioAutoConditionals.F273", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF273 )
-		pFnF273 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F273" );
+	UFunction* const pFnF273 = pFnF273Ref.Get ( );
 
 	UBioAutoConditionals_execF273_Parms F273_Parms;
 	F273_Parms.bioWorld = bioWorld;
@@ -3635,10 +3476,9 @@ bool UBioAutoConditionals::F273 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F263 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF263 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF263Ref { L"Function PlotManager.BioAutoConditionals.F263", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF263 )
-		pFnF263 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F263" );
+	UFunction* const pFnF263 = pFnF263Ref.Get ( );
 
 	UBioAutoConditionals_execF263_Parms F263_Parms;
 	F263_Parms.bioWorld = bioWorld;
@@ -3658,10 +3498,9 @@ bool UBioAutoConditionals::F263 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F257 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF257 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF257Ref { L"Function PlotManager.BioAutoConditionals.F257", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF257 )
-		pFnF257 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F257" );
+	UFunction* const pFnF257 = pFnF257Ref.Get ( );
 
 	UBioAutoConditionals_execF257_Parms F257_Parms;
 	F257_Parms.bioWorld = bioWorld;
@@ -3681,10 +3520,9 @@ bool UBioAutoConditionals::F257 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F642 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF642 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF642Ref { L"Function PlotManager.BioAutoConditionals.F642", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF642 )
-		pFnF642 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F642" );
+	UFunction* const pFnF642 = pFnF642Ref.Get ( );
 
 	UBioAutoConditionals_execF642_Parms F642_Parms;
 	F642_Parms.bioWorld = bioWorld;
@@ -3704,10 +3542,9 @@ bool UBioAutoConditionals::F642 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F649 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF649 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF649Ref { L"Function PlotManager.BioAutoConditionals.F649", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF649 )
-		pFnF649 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F649" );
+	UFunction* const pFnF649 = pFnF649Ref.Get ( );
 
 	UBioAutoConditionals_execF649_Parms F649_Parms;
 	F649_Parms.bioWorld = bioWorld;
@@ -3727,10 +3564,9 @@ bool UBioAutoConditionals::F649 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F648 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF648 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF648Ref { L"Function PlotManager.BioAutoConditionals.F648", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF648 )
-		pFnF648 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F648" );
+	UFunction* const pFnF648 = pFnF648Ref.Get ( );
 
 	UBioAutoConditionals_execF648_Parms F648_Parms;
 	F648_Parms.bioWorld = bioWorld;
@@ -3750,10 +3586,9 @@ bool UBioAutoConditionals::F648 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1253 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1253 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1253Ref { L"Function PlotManager.BioAutoConditionals.F1253", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1253 )
-		pFnF1253 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1253" );
+	UFunction* const pFnF1253 = pFnF1253Ref.Get ( );
 
 	UBioAutoConditionals_execF1253_Parms F1253_Parms;
 	F1253_Parms.bioWorld = bioWorld;
@@ -3773,10 +3608,9 @@ bool UBioAutoConditionals::F1253 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1252 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1252 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1252Ref { L"Function PlotManager.BioAutoConditionals.F1252", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1252 )
-		pFnF1252 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1252" );
+	UFunction* const pFnF1252 = pFnF1252Ref.Get ( );
 
 	UBioAutoConditionals_execF1252_Parms F1252_Parms;
 	F1252_Parms.bioWorld = bioWorld;
@@ -3796,10 +3630,9 @@ bool UBioAutoConditionals::F1252 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1251 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1251 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1251Ref { L"Function PlotManager.BioAutoConditionals.F1251", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1251 )
-		pFnF1251 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1251" );
+	UFunction* const pFnF1251 = pFnF1251Ref.Get ( );
 
 	UBioAutoConditionals_execF1251_Parms F1251_Parms;
 	F1251_Parms.bioWorld = bioWorld;
@@ -3819,10 +3652,9 @@ bool UBioAutoConditionals::F1251 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1250 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1250 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1250Ref { L"Function PlotManager.BioAutoConditionals.F1250", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1250 )
-		pFnF1250 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1250" );
+	UFunction* const pFnF1250 = pFnF1250Ref.Get ( );
 
 	UBioAutoConditionals_execF1250_Parms F1250_Parms;
 	F1250_Parms.bioWorld = bioWorld;
@@ -3842,10 +3674,9 @@ bool UBioAutoConditionals::F1250 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1249 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1249 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1249Ref { L"Function PlotManager.BioAutoConditionals.F1249", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1249 )
-		pFnF1249 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1249" );
+	UFunction* const pFnF1249 = pFnF1249Ref.Get ( );
 
 	UBioAutoConditionals_execF1249_Parms F1249_Parms;
 	F1249_Parms.bioWorld = bioWorld;
@@ -3865,10 +3696,9 @@ bool UBioAutoConditionals::F1249 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1126 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1126 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1126Ref { L"Function PlotManager.BioAutoConditionals.F1126", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1126 )
-		pFnF1126 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1126" );
+	UFunction* const pFnF1126 = pFnF1126Ref.Get ( );
 
 	UBioAutoConditionals_execF1126_Parms F1126_Parms;
 	F1126_Parms.bioWorld = bioWorld;
@@ -3888,10 +3718,9 @@ bool UBioAutoConditionals::F1126 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F909 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF909 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF909Ref { L"Function PlotManager.BioAutoConditionals.F909", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF909 )
-		pFnF909 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F909" );
+	UFunction* const pFnF909 = pFnF909Ref.Get ( );
 
 	UBioAutoConditionals_execF909_Parms F909_Parms;
 	F909_Parms.bioWorld = bioWorld;
@@ -3911,10 +3740,9 @@ bool UBioAutoConditionals::F909 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F592 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF592 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF592Ref { L"Function PlotManager.BioAutoConditionals.F592", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF592 )
-		pFnF592 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F592" );
+	UFunction* const pFnF592 = pFnF592Ref.Get ( );
 
 	UBioAutoConditionals_execF592_Parms F592_Parms;
 	F592_Parms.bioWorld = bioWorld;
@@ -3934,10 +3762,9 @@ bool UBioAutoConditionals::F592 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F591 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF591 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF591Ref { L"Function PlotManager.BioAutoConditionals.F591", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF591 )
-		pFnF591 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F591" );
+	UFunction* const pFnF591 = pFnF591Ref.Get ( );
 
 	UBioAutoConditionals_execF591_Parms F591_Parms;
 	F591_Parms.bioWorld = bioWorld;
@@ -3957,10 +3784,9 @@ bool UBioAutoConditionals::F591 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F590 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF590 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF590Ref { L"Function PlotManager.BioAutoConditionals.F590", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF590 )
-		pFnF590 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F590" );
+	UFunction* const pFnF590 = pFnF590Ref.Get ( );
 
 	UBioAutoConditionals_execF590_Parms F590_Parms;
 	F590_Parms.bioWorld = bioWorld;
@@ -3980,10 +3806,9 @@ bool UBioAutoConditionals::F590 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F589 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF589 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF589Ref { L"Function PlotManager.BioAutoConditionals.F589", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF589 )
-		pFnF589 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F589" );
+	UFunction* const pFnF589 = pFnF589Ref.Get ( );
 
 	UBioAutoConditionals_execF589_Parms F589_Parms;
 	F589_Parms.bioWorld = bioWorld;
@@ -4003,10 +3828,9 @@ bool UBioAutoConditionals::F589 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F588 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF588 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF588Ref { L"Function PlotManager.BioAutoConditionals.F588", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF588 )
-		pFnF588 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F588" );
+	UFunction* const pFnF588 = pFnF588Ref.Get ( );
 
 	UBioAutoConditionals_execF588_Parms F588_Parms;
 	F588_Parms.bioWorld = bioWorld;
@@ -4026,10 +3850,9 @@ bool UBioAutoConditionals::F588 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F586 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF586 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF586Ref { L"Function PlotManager.BioAutoConditionals.F586", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF586 )
-		pFnF586 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F586" );
+	UFunction* const pFnF586 = pFnF586Ref.Get ( );
 
 	UBioAutoConditionals_execF586_Parms F586_Parms;
 	F586_Parms.bioWorld = bioWorld;
@@ -4049,10 +3872,9 @@ bool UBioAutoConditionals::F586 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F585 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF585 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF585Ref { L"Function PlotManager.BioAutoConditionals.F585", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF585 )
-		pFnF585 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F585" );
+	UFunction* const pFnF585 = pFnF585Ref.Get ( );
 
 	UBioAutoConditionals_execF585_Parms F585_Parms;
 	F585_Parms.bioWorld = bioWorld;
@@ -4072,10 +3894,9 @@ bool UBioAutoConditionals::F585 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F446 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF446 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF446Ref { L"Function PlotManager.BioAutoConditionals.F446", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF446 )
-		pFnF446 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F446" );
+	UFunction* const pFnF446 = pFnF446Ref.Get ( );
 
 	UBioAutoConditionals_execF446_Parms F446_Parms;
 	F446_Parms.bioWorld = bioWorld;
@@ -4095,10 +3916,9 @@ bool UBioAutoConditionals::F446 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F734 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF734 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF734Ref { L"Function PlotManager.BioAutoConditionals.F734", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF734 )
-		pFnF734 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F734" );
+	UFunction* const pFnF734 = pFnF734Ref.Get ( );
 
 	UBioAutoConditionals_execF734_Parms F734_Parms;
 	F734_Parms.bioWorld = bioWorld;
@@ -4118,10 +3938,9 @@ bool UBioAutoConditionals::F734 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F856 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF856 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF856Ref { L"Function PlotManager.BioAutoConditionals.F856", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF856 )
-		pFnF856 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F856" );
+	UFunction* const pFnF856 = pFnF856Ref.Get ( );
 
 	UBioAutoConditionals_execF856_Parms F856_Parms;
 	F856_Parms.bioWorld = bioWorld;
@@ -4141,10 +3960,9 @@ bool UBioAutoConditionals::F856 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F620 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF620 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF620Ref { L"Function PlotManager.BioAutoConditionals.F620", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF620 )
-		pFnF620 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F620" );
+	UFunction* const pFnF620 = pFnF620Ref.Get ( );
 
 	UBioAutoConditionals_execF620_Parms F620_Parms;
 	F620_Parms.bioWorld = bioWorld;
@@ -4164,10 +3982,9 @@ bool UBioAutoConditionals::F620 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F477 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF477 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF477Ref { L"Function PlotManager.BioAutoConditionals.F477", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF477 )
-		pFnF477 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F477" );
+	UFunction* const pFnF477 = pFnF477Ref.Get ( );
 
 	UBioAutoConditionals_execF477_Parms F477_Parms;
 	F477_Parms.bioWorld = bioWorld;
@@ -4187,10 +4004,9 @@ bool UBioAutoConditionals::F477 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F443 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF443 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF443Ref { L"Function PlotManager.BioAutoConditionals.F443", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF443 )
-		pFnF443 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F443" );
+	UFunction* const pFnF443 = pFnF443Ref.Get ( );
 
 	UBioAutoConditionals_execF443_Parms F443_Parms;
 	F443_Parms.bioWorld = bioWorld;
@@ -4210,10 +4026,9 @@ bool UBioAutoConditionals::F443 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F442 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF442 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF442Ref { L"Function PlotManager.BioAutoConditionals.F442", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF442 )
-		pFnF442 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F442" );
+	UFunction* const pFnF442 = pFnF442Ref.Get ( );
 
 	UBioAutoConditionals_execF442_Parms F442_Parms;
 	F442_Parms.bioWorld = bioWorld;
@@ -4233,10 +4048,9 @@ bool UBioAutoConditionals::F442 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F441 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF441 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF441Ref { L"Function PlotManager.BioAutoConditionals.F441", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF441 )
-		pFnF441 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F441" );
+	UFunction* const pFnF441 = pFnF441Ref.Get ( );
 
 	UBioAutoConditionals_execF441_Parms F441_Parms;
 	F441_Parms.bioWorld = bioWorld;
@@ -4256,10 +4070,9 @@ bool UBioAutoConditionals::F441 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F440 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF440 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF440Ref { L"Function PlotManager.BioAutoConditionals.F440", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF440 )
-		pFnF440 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F440" );
+	UFunction* const pFnF440 = pFnF440Ref.Get ( );
 
 	UBioAutoConditionals_execF440_Parms F440_Parms;
 	F440_Parms.bioWorld = bioWorld;
@@ -4279,10 +4092,9 @@ bool UBioAutoConditionals::F440 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F439 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF439 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF439Ref { L"Function PlotManager.BioAutoConditionals.F439", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF439 )
-		pFnF439 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F439" );
+	UFunction* const pFnF439 = pFnF439Ref.Get ( );
 
 	UBioAutoConditionals_execF439_Parms F439_Parms;
 	F439_Parms.bioWorld = bioWorld;
@@ -4302,10 +4114,9 @@ bool UBioAutoConditionals::F439 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F438 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF438 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF438Ref { L"Function PlotManager.BioAutoConditionals.F438", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF438 )
-		pFnF438 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F438" );
+	UFunction* const pFnF438 = pFnF438Ref.Get ( );
 
 	UBioAutoConditionals_execF438_Parms F438_Parms;
 	F438_Parms.bioWorld = bioWorld;
@@ -4325,10 +4136,9 @@ bool UBioAutoConditionals::F438 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F391 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF391 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF391Ref { L"Function PlotManager.BioAutoConditionals.F391", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF391 )
-		pFnF391 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F391" );
+	UFunction* const pFnF391 = pFnF391Ref.Get ( );
 
 	UBioAutoConditionals_execF391_Parms F391_Parms;
 	F391_Parms.bioWorld = bioWorld;
@@ -4348,10 +4158,9 @@ bool UBioAutoConditionals::F391 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F355 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF355 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF355Ref { L"Function PlotManager.BioAutoConditionals.F355", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF355 )
-		pFnF355 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F355" );
+	UFunction* const pFnF355 = pFnF355Ref.Get ( );
 
 	UBioAutoConditionals_execF355_Parms F355_Parms;
 	F355_Parms.bioWorld = bioWorld;
@@ -4371,10 +4180,9 @@ bool UBioAutoConditionals::F355 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1019 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1019 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1019Ref { L"Function PlotManager.BioAutoConditionals.F1019", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1019 )
-		pFnF1019 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1019" );
+	UFunction* const pFnF1019 = pFnF1019Ref.Get ( );
 
 	UBioAutoConditionals_execF1019_Parms F1019_Parms;
 	F1019_Parms.bioWorld = bioWorld;
@@ -4394,10 +4202,9 @@ bool UBioAutoConditionals::F1019 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F393 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF393 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF393Ref { L"Function PlotManager.BioAutoConditionals.F393", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF393 )
-		pFnF393 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F393" );
+	UFunction* const pFnF393 = pFnF393Ref.Get ( );
 
 	UBioAutoConditionals_execF393_Parms F393_Parms;
 	F393_Parms.bioWorld = bioWorld;
@@ -4417,10 +4224,9 @@ bool UBioAutoConditionals::F393 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F333 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF333 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF333Ref { L"Function PlotManager.BioAutoConditionals.F333", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF333 )
-		pFnF333 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F333" );
+	UFunction* const pFnF333 = pFnF333Ref.Get ( );
 
 	UBioAutoConditionals_execF333_Parms F333_Parms;
 	F333_Parms.bioWorld = bioWorld;
@@ -4440,10 +4246,9 @@ bool UBioAutoConditionals::F333 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F339 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF339 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF339Ref { L"Function PlotManager.BioAutoConditionals.F339", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF339 )
-		pFnF339 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F339" );
+	UFunction* const pFnF339 = pFnF339Ref.Get ( );
 
 	UBioAutoConditionals_execF339_Parms F339_Parms;
 	F339_Parms.bioWorld = bioWorld;
@@ -4463,10 +4268,9 @@ bool UBioAutoConditionals::F339 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F336 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF336 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF336Ref { L"Function PlotManager.BioAutoConditionals.F336", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF336 )
-		pFnF336 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F336" );
+	UFunction* const pFnF336 = pFnF336Ref.Get ( );
 
 	UBioAutoConditionals_execF336_Parms F336_Parms;
 	F336_Parms.bioWorld = bioWorld;
@@ -4486,10 +4290,9 @@ bool UBioAutoConditionals::F336 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1557 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1557 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1557Ref { L"Function PlotManager.BioAutoConditionals.F1557", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1557 )
-		pFnF1557 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1557" );
+	UFunction* const pFnF1557 = pFnF1557Ref.Get ( );
 
 	UBioAutoConditionals_execF1557_Parms F1557_Parms;
 	F1557_Parms.bioWorld = bioWorld;
@@ -4509,10 +4312,9 @@ bool UBioAutoConditionals::F1557 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1045 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1045 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1045Ref { L"Function PlotManager.BioAutoConditionals.F1045", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1045 )
-		pFnF1045 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1045" );
+	UFunction* const pFnF1045 = pFnF1045Ref.Get ( );
 
 	UBioAutoConditionals_execF1045_Parms F1045_Parms;
 	F1045_Parms.bioWorld = bioWorld;
@@ -4532,10 +4334,9 @@ bool UBioAutoConditionals::F1045 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F163 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF163 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF163Ref { L"Function PlotManager.BioAutoConditionals.F163", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF163 )
-		pFnF163 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F163" );
+	UFunction* const pFnF163 = pFnF163Ref.Get ( );
 
 	UBioAutoConditionals_execF163_Parms F163_Parms;
 	F163_Parms.bioWorld = bioWorld;
@@ -4555,10 +4356,9 @@ bool UBioAutoConditionals::F163 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F162 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF162 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF162Ref { L"Function PlotManager.BioAutoConditionals.F162", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF162 )
-		pFnF162 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F162" );
+	UFunction* const pFnF162 = pFnF162Ref.Get ( );
 
 	UBioAutoConditionals_execF162_Parms F162_Parms;
 	F162_Parms.bioWorld = bioWorld;
@@ -4578,10 +4378,9 @@ bool UBioAutoConditionals::F162 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F154 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF154 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF154Ref { L"Function PlotManager.BioAutoConditionals.F154", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF154 )
-		pFnF154 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F154" );
+	UFunction* const pFnF154 = pFnF154Ref.Get ( );
 
 	UBioAutoConditionals_execF154_Parms F154_Parms;
 	F154_Parms.bioWorld = bioWorld;
@@ -4601,10 +4400,9 @@ bool UBioAutoConditionals::F154 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F153 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF153 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF153Ref { L"Function PlotManager.BioAutoConditionals.F153", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF153 )
-		pFnF153 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F153" );
+	UFunction* const pFnF153 = pFnF153Ref.Get ( );
 
 	UBioAutoConditionals_execF153_Parms F153_Parms;
 	F153_Parms.bioWorld = bioWorld;
@@ -4624,10 +4422,9 @@ bool UBioAutoConditionals::F153 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F152 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF152 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF152Ref { L"Function PlotManager.BioAutoConditionals.F152", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF152 )
-		pFnF152 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F152" );
+	UFunction* const pFnF152 = pFnF152Ref.Get ( );
 
 	UBioAutoConditionals_execF152_Parms F152_Parms;
 	F152_Parms.bioWorld = bioWorld;
@@ -4647,10 +4444,9 @@ bool UBioAutoConditionals::F152 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F151 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF151 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF151Ref { L"Function PlotManager.BioAutoConditionals.F151", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF151 )
-		pFnF151 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F151" );
+	UFunction* const pFnF151 = pFnF151Ref.Get ( );
 
 	UBioAutoConditionals_execF151_Parms F151_Parms;
 	F151_Parms.bioWorld = bioWorld;
@@ -4670,10 +4466,9 @@ bool UBioAutoConditionals::F151 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F150 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF150 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF150Ref { L"Function PlotManager.BioAutoConditionals.F150", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF150 )
-		pFnF150 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F150" );
+	UFunction* const pFnF150 = pFnF150Ref.Get ( );
 
 	UBioAutoConditionals_execF150_Parms F150_Parms;
 	F150_Parms.bioWorld = bioWorld;
@@ -4693,10 +4488,9 @@ bool UBioAutoConditionals::F150 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F149 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF149 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF149Ref { L"Function PlotManager.BioAutoConditionals.F149", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF149 )
-		pFnF149 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F149" );
+	UFunction* const pFnF149 = pFnF149Ref.Get ( );
 
 	UBioAutoConditionals_execF149_Parms F149_Parms;
 	F149_Parms.bioWorld = bioWorld;
@@ -4716,10 +4510,9 @@ bool UBioAutoConditionals::F149 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F148 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF148 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF148Ref { L"Function PlotManager.BioAutoConditionals.F148", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF148 )
-		pFnF148 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F148" );
+	UFunction* const pFnF148 = pFnF148Ref.Get ( );
 
 	UBioAutoConditionals_execF148_Parms F148_Parms;
 	F148_Parms.bioWorld = bioWorld;
@@ -4739,10 +4532,9 @@ bool UBioAutoConditionals::F148 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F147 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF147 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF147Ref { L"Function PlotManager.BioAutoConditionals.F147", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF147 )
-		pFnF147 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F147" );
+	UFunction* const pFnF147 = pFnF147Ref.Get ( );
 
 	UBioAutoConditionals_execF147_Parms F147_Parms;
 	F147_Parms.bioWorld = bioWorld;
@@ -4762,10 +4554,9 @@ bool UBioAutoConditionals::F147 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F146 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF146 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF146Ref { L"Function PlotManager.BioAutoConditionals.F146", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF146 )
-		pFnF146 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F146" );
+	UFunction* const pFnF146 = pFnF146Ref.Get ( );
 
 	UBioAutoConditionals_execF146_Parms F146_Parms;
 	F146_Parms.bioWorld = bioWorld;
@@ -4785,10 +4576,9 @@ bool UBioAutoConditionals::F146 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F145 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF145 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF145Ref { L"Function PlotManager.BioAutoConditionals.F145", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF145 )
-		pFnF145 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F145" );
+	UFunction* const pFnF145 = pFnF145Ref.Get ( );
 
 	UBioAutoConditionals_execF145_Parms F145_Parms;
 	F145_Parms.bioWorld = bioWorld;
@@ -4808,10 +4598,9 @@ bool UBioAutoConditionals::F145 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F144 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF144 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF144Ref { L"Function PlotManager.BioAutoConditionals.F144", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF144 )
-		pFnF144 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F144" );
+	UFunction* const pFnF144 = pFnF144Ref.Get ( );
 
 	UBioAutoConditionals_execF144_Parms F144_Parms;
 	F144_Parms.bioWorld = bioWorld;
@@ -4831,10 +4620,9 @@ bool UBioAutoConditionals::F144 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F143 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF143 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF143Ref { L"Function PlotManager.BioAutoConditionals.F143", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF143 )
-		pFnF143 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F143" );
+	UFunction* const pFnF143 = pFnF143Ref.Get ( );
 
 	UBioAutoConditionals_execF143_Parms F143_Parms;
 	F143_Parms.bioWorld = bioWorld;
@@ -4854,10 +4642,9 @@ bool UBioAutoConditionals::F143 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F142 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF142 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF142Ref { L"Function PlotManager.BioAutoConditionals.F142", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF142 )
-		pFnF142 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F142" );
+	UFunction* const pFnF142 = pFnF142Ref.Get ( );
 
 	UBioAutoConditionals_execF142_Parms F142_Parms;
 	F142_Parms.bioWorld = bioWorld;
@@ -4877,10 +4664,9 @@ bool UBioAutoConditionals::F142 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F141 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF141 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF141Ref { L"Function PlotManager.BioAutoConditionals.F141", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF141 )
-		pFnF141 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F141" );
+	UFunction* const pFnF141 = pFnF141Ref.Get ( );
 
 	UBioAutoConditionals_execF141_Parms F141_Parms;
 	F141_Parms.bioWorld = bioWorld;
@@ -4900,10 +4686,9 @@ bool UBioAutoConditionals::F141 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F335 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF335 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF335Ref { L"Function PlotManager.BioAutoConditionals.F335", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF335 )
-		pFnF335 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F335" );
+	UFunction* const pFnF335 = pFnF335Ref.Get ( );
 
 	UBioAutoConditionals_execF335_Parms F335_Parms;
 	F335_Parms.bioWorld = bioWorld;
@@ -4923,10 +4708,9 @@ bool UBioAutoConditionals::F335 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F489 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF489 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF489Ref { L"Function PlotManager.BioAutoConditionals.F489", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF489 )
-		pFnF489 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F489" );
+	UFunction* const pFnF489 = pFnF489Ref.Get ( );
 
 	UBioAutoConditionals_execF489_Parms F489_Parms;
 	F489_Parms.bioWorld = bioWorld;
@@ -4946,10 +4730,9 @@ bool UBioAutoConditionals::F489 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F488 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF488 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF488Ref { L"Function PlotManager.BioAutoConditionals.F488", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF488 )
-		pFnF488 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F488" );
+	UFunction* const pFnF488 = pFnF488Ref.Get ( );
 
 	UBioAutoConditionals_execF488_Parms F488_Parms;
 	F488_Parms.bioWorld = bioWorld;
@@ -4969,10 +4752,9 @@ bool UBioAutoConditionals::F488 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F923 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF923 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF923Ref { L"Function PlotManager.BioAutoConditionals.F923", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF923 )
-		pFnF923 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F923" );
+	UFunction* const pFnF923 = pFnF923Ref.Get ( );
 
 	UBioAutoConditionals_execF923_Parms F923_Parms;
 	F923_Parms.bioWorld = bioWorld;
@@ -4992,10 +4774,9 @@ bool UBioAutoConditionals::F923 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F241 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF241 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF241Ref { L"Function PlotManager.BioAutoConditionals.F241", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF241 )
-		pFnF241 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F241" );
+	UFunction* const pFnF241 = pFnF241Ref.Get ( );
 
 	UBioAutoConditionals_execF241_Parms F241_Parms;
 	F241_Parms.bioWorld = bioWorld;
@@ -5015,10 +4796,9 @@ bool UBioAutoConditionals::F241 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F435 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF435 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF435Ref { L"Function PlotManager.BioAutoConditionals.F435", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF435 )
-		pFnF435 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F435" );
+	UFunction* const pFnF435 = pFnF435Ref.Get ( );
 
 	UBioAutoConditionals_execF435_Parms F435_Parms;
 	F435_Parms.bioWorld = bioWorld;
@@ -5038,10 +4818,9 @@ bool UBioAutoConditionals::F435 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F434 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF434 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF434Ref { L"Function PlotManager.BioAutoConditionals.F434", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF434 )
-		pFnF434 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F434" );
+	UFunction* const pFnF434 = pFnF434Ref.Get ( );
 
 	UBioAutoConditionals_execF434_Parms F434_Parms;
 	F434_Parms.bioWorld = bioWorld;
@@ -5061,10 +4840,9 @@ bool UBioAutoConditionals::F434 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F321 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF321 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF321Ref { L"Function PlotManager.BioAutoConditionals.F321", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF321 )
-		pFnF321 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F321" );
+	UFunction* const pFnF321 = pFnF321Ref.Get ( );
 
 	UBioAutoConditionals_execF321_Parms F321_Parms;
 	F321_Parms.bioWorld = bioWorld;
@@ -5084,10 +4862,9 @@ bool UBioAutoConditionals::F321 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F320 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF320 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF320Ref { L"Function PlotManager.BioAutoConditionals.F320", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF320 )
-		pFnF320 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F320" );
+	UFunction* const pFnF320 = pFnF320Ref.Get ( );
 
 	UBioAutoConditionals_execF320_Parms F320_Parms;
 	F320_Parms.bioWorld = bioWorld;
@@ -5107,10 +4884,9 @@ bool UBioAutoConditionals::F320 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F319 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF319 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF319Ref { L"Function PlotManager.BioAutoConditionals.F319", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF319 )
-		pFnF319 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F319" );
+	UFunction* const pFnF319 = pFnF319Ref.Get ( );
 
 	UBioAutoConditionals_execF319_Parms F319_Parms;
 	F319_Parms.bioWorld = bioWorld;
@@ -5130,10 +4906,9 @@ bool UBioAutoConditionals::F319 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F318 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF318 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF318Ref { L"Function PlotManager.BioAutoConditionals.F318", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF318 )
-		pFnF318 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F318" );
+	UFunction* const pFnF318 = pFnF318Ref.Get ( );
 
 	UBioAutoConditionals_execF318_Parms F318_Parms;
 	F318_Parms.bioWorld = bioWorld;
@@ -5153,10 +4928,9 @@ bool UBioAutoConditionals::F318 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1257 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1257 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1257Ref { L"Function PlotManager.BioAutoConditionals.F1257", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1257 )
-		pFnF1257 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1257" );
+	UFunction* const pFnF1257 = pFnF1257Ref.Get ( );
 
 	UBioAutoConditionals_execF1257_Parms F1257_Parms;
 	F1257_Parms.bioWorld = bioWorld;
@@ -5176,10 +4950,9 @@ bool UBioAutoConditionals::F1257 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1256 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1256 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1256Ref { L"Function PlotManager.BioAutoConditionals.F1256", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1256 )
-		pFnF1256 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1256" );
+	UFunction* const pFnF1256 = pFnF1256Ref.Get ( );
 
 	UBioAutoConditionals_execF1256_Parms F1256_Parms;
 	F1256_Parms.bioWorld = bioWorld;
@@ -5199,10 +4972,9 @@ bool UBioAutoConditionals::F1256 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1000 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1000 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1000Ref { L"Function PlotManager.BioAutoConditionals.F1000", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1000 )
-		pFnF1000 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1000" );
+	UFunction* const pFnF1000 = pFnF1000Ref.Get ( );
 
 	UBioAutoConditionals_execF1000_Parms F1000_Parms;
 	F1000_Parms.bioWorld = bioWorld;
@@ -5222,10 +4994,9 @@ bool UBioAutoConditionals::F1000 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F851 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF851 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF851Ref { L"Function PlotManager.BioAutoConditionals.F851", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF851 )
-		pFnF851 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F851" );
+	UFunction* const pFnF851 = pFnF851Ref.Get ( );
 
 	UBioAutoConditionals_execF851_Parms F851_Parms;
 	F851_Parms.bioWorld = bioWorld;
@@ -5245,10 +5016,9 @@ bool UBioAutoConditionals::F851 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F323 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF323 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF323Ref { L"Function PlotManager.BioAutoConditionals.F323", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF323 )
-		pFnF323 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F323" );
+	UFunction* const pFnF323 = pFnF323Ref.Get ( );
 
 	UBioAutoConditionals_execF323_Parms F323_Parms;
 	F323_Parms.bioWorld = bioWorld;
@@ -5268,10 +5038,9 @@ bool UBioAutoConditionals::F323 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F293 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF293 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF293Ref { L"Function PlotManager.BioAutoConditionals.F293", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF293 )
-		pFnF293 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F293" );
+	UFunction* const pFnF293 = pFnF293Ref.Get ( );
 
 	UBioAutoConditionals_execF293_Parms F293_Parms;
 	F293_Parms.bioWorld = bioWorld;
@@ -5291,10 +5060,9 @@ bool UBioAutoConditionals::F293 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F287 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF287 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF287Ref { L"Function PlotManager.BioAutoConditionals.F287", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF287 )
-		pFnF287 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F287" );
+	UFunction* const pFnF287 = pFnF287Ref.Get ( );
 
 	UBioAutoConditionals_execF287_Parms F287_Parms;
 	F287_Parms.bioWorld = bioWorld;
@@ -5314,10 +5082,9 @@ bool UBioAutoConditionals::F287 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F902 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF902 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF902Ref { L"Function PlotManager.BioAutoConditionals.F902", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF902 )
-		pFnF902 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F902" );
+	UFunction* const pFnF902 = pFnF902Ref.Get ( );
 
 	UBioAutoConditionals_execF902_Parms F902_Parms;
 	F902_Parms.bioWorld = bioWorld;
@@ -5337,10 +5104,9 @@ bool UBioAutoConditionals::F902 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F901 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF901 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF901Ref { L"Function PlotManager.BioAutoConditionals.F901", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF901 )
-		pFnF901 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F901" );
+	UFunction* const pFnF901 = pFnF901Ref.Get ( );
 
 	UBioAutoConditionals_execF901_Parms F901_Parms;
 	F901_Parms.bioWorld = bioWorld;
@@ -5360,10 +5126,9 @@ bool UBioAutoConditionals::F901 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1184 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1184 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1184Ref { L"Function PlotManager.BioAutoConditionals.F1184", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1184 )
-		pFnF1184 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1184" );
+	UFunction* const pFnF1184 = pFnF1184Ref.Get ( );
 
 	UBioAutoConditionals_execF1184_Parms F1184_Parms;
 	F1184_Parms.bioWorld = bioWorld;
@@ -5383,10 +5148,9 @@ bool UBioAutoConditionals::F1184 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1183 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1183 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1183Ref { L"Function PlotManager.BioAutoConditionals.F1183", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1183 )
-		pFnF1183 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1183" );
+	UFunction* const pFnF1183 = pFnF1183Ref.Get ( );
 
 	UBioAutoConditionals_execF1183_Parms F1183_Parms;
 	F1183_Parms.bioWorld = bioWorld;
@@ -5406,10 +5170,9 @@ bool UBioAutoConditionals::F1183 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1182 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1182 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1182Ref { L"Function PlotManager.BioAutoConditionals.F1182", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1182 )
-		pFnF1182 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1182" );
+	UFunction* const pFnF1182 = pFnF1182Ref.Get ( );
 
 	UBioAutoConditionals_execF1182_Parms F1182_Parms;
 	F1182_Parms.bioWorld = bioWorld;
@@ -5429,10 +5192,9 @@ bool UBioAutoConditionals::F1182 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1181 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1181 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1181Ref { L"Function PlotManager.BioAutoConditionals.F1181", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1181 )
-		pFnF1181 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1181" );
+	UFunction* const pFnF1181 = pFnF1181Ref.Get ( );
 
 	UBioAutoConditionals_execF1181_Parms F1181_Parms;
 	F1181_Parms.bioWorld = bioWorld;
@@ -5452,10 +5214,9 @@ bool UBioAutoConditionals::F1181 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1180 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1180 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1180Ref { L"Function PlotManager.BioAutoConditionals.F1180", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1180 )
-		pFnF1180 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1180" );
+	UFunction* const pFnF1180 = pFnF1180Ref.Get ( );
 
 	UBioAutoConditionals_execF1180_Parms F1180_Parms;
 	F1180_Parms.bioWorld = bioWorld;
@@ -5475,10 +5236,9 @@ bool UBioAutoConditionals::F1180 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1177 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1177 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1177Ref { L"Function PlotManager.BioAutoConditionals.F1177", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1177 )
-		pFnF1177 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1177" );
+	UFunction* const pFnF1177 = pFnF1177Ref.Get ( );
 
 	UBioAutoConditionals_execF1177_Parms F1177_Parms;
 	F1177_Parms.bioWorld = bioWorld;
@@ -5498,10 +5258,9 @@ bool UBioAutoConditionals::F1177 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1176 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1176 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1176Ref { L"Function PlotManager.BioAutoConditionals.F1176", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1176 )
-		pFnF1176 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1176" );
+	UFunction* const pFnF1176 = pFnF1176Ref.Get ( );
 
 	UBioAutoConditionals_execF1176_Parms F1176_Parms;
 	F1176_Parms.bioWorld = bioWorld;
@@ -5521,10 +5280,9 @@ bool UBioAutoConditionals::F1176 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1175 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1175 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1175Ref { L"Function PlotManager.BioAutoConditionals.F1175", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1175 )
-		pFnF1175 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1175" );
+	UFunction* const pFnF1175 = pFnF1175Ref.Get ( );
 
 	UBioAutoConditionals_execF1175_Parms F1175_Parms;
 	F1175_Parms.bioWorld = bioWorld;
@@ -5544,10 +5302,9 @@ bool UBioAutoConditionals::F1175 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1174 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1174 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1174Ref { L"Function PlotManager.BioAutoConditionals.F1174", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1174 )
-		pFnF1174 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1174" );
+	UFunction* const pFnF1174 = pFnF1174Ref.Get ( );
 
 	UBioAutoConditionals_execF1174_Parms F1174_Parms;
 	F1174_Parms.bioWorld = bioWorld;
@@ -5567,10 +5324,9 @@ bool UBioAutoConditionals::F1174 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1173 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1173 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1173Ref { L"Function PlotManager.BioAutoConditionals.F1173", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1173 )
-		pFnF1173 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1173" );
+	UFunction* const pFnF1173 = pFnF1173Ref.Get ( );
 
 	UBioAutoConditionals_execF1173_Parms F1173_Parms;
 	F1173_Parms.bioWorld = bioWorld;
@@ -5590,10 +5346,9 @@ bool UBioAutoConditionals::F1173 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1172 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1172 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1172Ref { L"Function PlotManager.BioAutoConditionals.F1172", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1172 )
-		pFnF1172 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1172" );
+	UFunction* const pFnF1172 = pFnF1172Ref.Get ( );
 
 	UBioAutoConditionals_execF1172_Parms F1172_Parms;
 	F1172_Parms.bioWorld = bioWorld;
@@ -5613,10 +5368,9 @@ bool UBioAutoConditionals::F1172 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1171 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1171 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1171Ref { L"Function PlotManager.BioAutoConditionals.F1171", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1171 )
-		pFnF1171 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1171" );
+	UFunction* const pFnF1171 = pFnF1171Ref.Get ( );
 
 	UBioAutoConditionals_execF1171_Parms F1171_Parms;
 	F1171_Parms.bioWorld = bioWorld;
@@ -5636,10 +5390,9 @@ bool UBioAutoConditionals::F1171 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1170 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1170 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1170Ref { L"Function PlotManager.BioAutoConditionals.F1170", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1170 )
-		pFnF1170 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1170" );
+	UFunction* const pFnF1170 = pFnF1170Ref.Get ( );
 
 	UBioAutoConditionals_execF1170_Parms F1170_Parms;
 	F1170_Parms.bioWorld = bioWorld;
@@ -5659,10 +5412,9 @@ bool UBioAutoConditionals::F1170 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1169 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1169 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1169Ref { L"Function PlotManager.BioAutoConditionals.F1169", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1169 )
-		pFnF1169 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1169" );
+	UFunction* const pFnF1169 = pFnF1169Ref.Get ( );
 
 	UBioAutoConditionals_execF1169_Parms F1169_Parms;
 	F1169_Parms.bioWorld = bioWorld;
@@ -5682,10 +5434,9 @@ bool UBioAutoConditionals::F1169 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1168 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1168 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1168Ref { L"Function PlotManager.BioAutoConditionals.F1168", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1168 )
-		pFnF1168 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1168" );
+	UFunction* const pFnF1168 = pFnF1168Ref.Get ( );
 
 	UBioAutoConditionals_execF1168_Parms F1168_Parms;
 	F1168_Parms.bioWorld = bioWorld;
@@ -5705,10 +5456,9 @@ bool UBioAutoConditionals::F1168 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1167 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1167 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1167Ref { L"Function PlotManager.BioAutoConditionals.F1167", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1167 )
-		pFnF1167 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1167" );
+	UFunction* const pFnF1167 = pFnF1167Ref.Get ( );
 
 	UBioAutoConditionals_execF1167_Parms F1167_Parms;
 	F1167_Parms.bioWorld = bioWorld;
@@ -5728,10 +5478,9 @@ bool UBioAutoConditionals::F1167 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1166 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1166 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1166Ref { L"Function PlotManager.BioAutoConditionals.F1166", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1166 )
-		pFnF1166 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1166" );
+	UFunction* const pFnF1166 = pFnF1166Ref.Get ( );
 
 	UBioAutoConditionals_execF1166_Parms F1166_Parms;
 	F1166_Parms.bioWorld = bioWorld;
@@ -5751,10 +5500,9 @@ bool UBioAutoConditionals::F1166 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F832 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF832 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF832Ref { L"Function PlotManager.BioAutoConditionals.F832", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF832 )
-		pFnF832 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F832" );
+	UFunction* const pFnF832 = pFnF832Ref.Get ( );
 
 	UBioAutoConditionals_execF832_Parms F832_Parms;
 	F832_Parms.bioWorld = bioWorld;
@@ -5774,10 +5522,9 @@ bool UBioAutoConditionals::F832 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F831 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF831 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF831Ref { L"Function PlotManager.BioAutoConditionals.F831", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF831 )
-		pFnF831 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F831" );
+	UFunction* const pFnF831 = pFnF831Ref.Get ( );
 
 	UBioAutoConditionals_execF831_Parms F831_Parms;
 	F831_Parms.bioWorld = bioWorld;
@@ -5797,10 +5544,9 @@ bool UBioAutoConditionals::F831 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F830 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF830 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF830Ref { L"Function PlotManager.BioAutoConditionals.F830", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF830 )
-		pFnF830 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F830" );
+	UFunction* const pFnF830 = pFnF830Ref.Get ( );
 
 	UBioAutoConditionals_execF830_Parms F830_Parms;
 	F830_Parms.bioWorld = bioWorld;
@@ -5820,10 +5566,9 @@ bool UBioAutoConditionals::F830 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F829 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF829 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF829Ref { L"Function PlotManager.BioAutoConditionals.F829", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF829 )
-		pFnF829 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F829" );
+	UFunction* const pFnF829 = pFnF829Ref.Get ( );
 
 	UBioAutoConditionals_execF829_Parms F829_Parms;
 	F829_Parms.bioWorld = bioWorld;
@@ -5843,10 +5588,9 @@ bool UBioAutoConditionals::F829 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F828 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF828 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF828Ref { L"Function PlotManager.BioAutoConditionals.F828", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF828 )
-		pFnF828 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F828" );
+	UFunction* const pFnF828 = pFnF828Ref.Get ( );
 
 	UBioAutoConditionals_execF828_Parms F828_Parms;
 	F828_Parms.bioWorld = bioWorld;
@@ -5866,10 +5610,9 @@ bool UBioAutoConditionals::F828 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F827 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF827 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF827Ref { L"Function PlotManager.BioAutoConditionals.F827", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF827 )
-		pFnF827 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F827" );
+	UFunction* const pFnF827 = pFnF827Ref.Get ( );
 
 	UBioAutoConditionals_execF827_Parms F827_Parms;
 	F827_Parms.bioWorld = bioWorld;
@@ -5889,10 +5632,9 @@ bool UBioAutoConditionals::F827 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F826 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF826 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF826Ref { L"Function PlotManager.BioAutoConditionals.F826", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF826 )
-		pFnF826 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F826" );
+	UFunction* const pFnF826 = pFnF826Ref.Get ( );
 
 	UBioAutoConditionals_execF826_Parms F826_Parms;
 	F826_Parms.bioWorld = bioWorld;
@@ -5912,10 +5654,9 @@ bool UBioAutoConditionals::F826 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F825 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF825 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF825Ref { L"Function PlotManager.BioAutoConditionals.F825", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF825 )
-		pFnF825 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F825" );
+	UFunction* const pFnF825 = pFnF825Ref.Get ( );
 
 	UBioAutoConditionals_execF825_Parms F825_Parms;
 	F825_Parms.bioWorld = bioWorld;
@@ -5935,10 +5676,9 @@ bool UBioAutoConditionals::F825 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F824 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF824 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF824Ref { L"Function PlotManager.BioAutoConditionals.F824", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF824 )
-		pFnF824 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F824" );
+	UFunction* const pFnF824 = pFnF824Ref.Get ( );
 
 	UBioAutoConditionals_execF824_Parms F824_Parms;
 	F824_Parms.bioWorld = bioWorld;
@@ -5958,10 +5698,9 @@ bool UBioAutoConditionals::F824 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F823 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF823 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF823Ref { L"Function PlotManager.BioAutoConditionals.F823", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF823 )
-		pFnF823 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F823" );
+	UFunction* const pFnF823 = pFnF823Ref.Get ( );
 
 	UBioAutoConditionals_execF823_Parms F823_Parms;
 	F823_Parms.bioWorld = bioWorld;
@@ -5981,10 +5720,9 @@ bool UBioAutoConditionals::F823 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F822 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF822 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF822Ref { L"Function PlotManager.BioAutoConditionals.F822", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF822 )
-		pFnF822 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F822" );
+	UFunction* const pFnF822 = pFnF822Ref.Get ( );
 
 	UBioAutoConditionals_execF822_Parms F822_Parms;
 	F822_Parms.bioWorld = bioWorld;
@@ -6004,10 +5742,9 @@ bool UBioAutoConditionals::F822 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F844 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF844 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF844Ref { L"Function PlotManager.BioAutoConditionals.F844", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF844 )
-		pFnF844 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F844" );
+	UFunction* const pFnF844 = pFnF844Ref.Get ( );
 
 	UBioAutoConditionals_execF844_Parms F844_Parms;
 	F844_Parms.bioWorld = bioWorld;
@@ -6027,10 +5764,9 @@ bool UBioAutoConditionals::F844 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F843 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF843 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF843Ref { L"Function PlotManager.BioAutoConditionals.F843", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF843 )
-		pFnF843 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F843" );
+	UFunction* const pFnF843 = pFnF843Ref.Get ( );
 
 	UBioAutoConditionals_execF843_Parms F843_Parms;
 	F843_Parms.bioWorld = bioWorld;
@@ -6050,10 +5786,9 @@ bool UBioAutoConditionals::F843 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F842 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF842 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF842Ref { L"Function PlotManager.BioAutoConditionals.F842", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF842 )
-		pFnF842 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F842" );
+	UFunction* const pFnF842 = pFnF842Ref.Get ( );
 
 	UBioAutoConditionals_execF842_Parms F842_Parms;
 	F842_Parms.bioWorld = bioWorld;
@@ -6073,10 +5808,9 @@ bool UBioAutoConditionals::F842 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F841 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF841 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF841Ref { L"Function PlotManager.BioAutoConditionals.F841", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF841 )
-		pFnF841 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F841" );
+	UFunction* const pFnF841 = pFnF841Ref.Get ( );
 
 	UBioAutoConditionals_execF841_Parms F841_Parms;
 	F841_Parms.bioWorld = bioWorld;
@@ -6096,10 +5830,9 @@ bool UBioAutoConditionals::F841 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F840 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF840 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF840Ref { L"Function PlotManager.BioAutoConditionals.F840", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF840 )
-		pFnF840 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F840" );
+	UFunction* const pFnF840 = pFnF840Ref.Get ( );
 
 	UBioAutoConditionals_execF840_Parms F840_Parms;
 	F840_Parms.bioWorld = bioWorld;
@@ -6119,10 +5852,9 @@ bool UBioAutoConditionals::F840 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F839 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF839 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF839Ref { L"Function PlotManager.BioAutoConditionals.F839", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF839 )
-		pFnF839 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F839" );
+	UFunction* const pFnF839 = pFnF839Ref.Get ( );
 
 	UBioAutoConditionals_execF839_Parms F839_Parms;
 	F839_Parms.bioWorld = bioWorld;
@@ -6142,10 +5874,9 @@ bool UBioAutoConditionals::F839 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F838 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF838 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF838Ref { L"Function PlotManager.BioAutoConditionals.F838", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF838 )
-		pFnF838 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F838" );
+	UFunction* const pFnF838 = pFnF838Ref.Get ( );
 
 	UBioAutoConditionals_execF838_Parms F838_Parms;
 	F838_Parms.bioWorld = bioWorld;
@@ -6165,10 +5896,9 @@ bool UBioAutoConditionals::F838 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F837 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF837 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF837Ref { L"Function PlotManager.BioAutoConditionals.F837", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF837 )
-		pFnF837 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F837" );
+	UFunction* const pFnF837 = pFnF837Ref.Get ( );
 
 	UBioAutoConditionals_execF837_Parms F837_Parms;
 	F837_Parms.bioWorld = bioWorld;
@@ -6188,10 +5918,9 @@ bool UBioAutoConditionals::F837 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F836 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF836 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF836Ref { L"Function PlotManager.BioAutoConditionals.F836", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF836 )
-		pFnF836 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F836" );
+	UFunction* const pFnF836 = pFnF836Ref.Get ( );
 
 	UBioAutoConditionals_execF836_Parms F836_Parms;
 	F836_Parms.bioWorld = bioWorld;
@@ -6211,10 +5940,9 @@ bool UBioAutoConditionals::F836 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F835 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF835 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF835Ref { L"Function PlotManager.BioAutoConditionals.F835", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF835 )
-		pFnF835 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F835" );
+	UFunction* const pFnF835 = pFnF835Ref.Get ( );
 
 	UBioAutoConditionals_execF835_Parms F835_Parms;
 	F835_Parms.bioWorld = bioWorld;
@@ -6234,10 +5962,9 @@ bool UBioAutoConditionals::F835 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F834 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF834 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF834Ref { L"Function PlotManager.BioAutoConditionals.F834", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF834 )
-		pFnF834 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F834" );
+	UFunction* const pFnF834 = pFnF834Ref.Get ( );
 
 	UBioAutoConditionals_execF834_Parms F834_Parms;
 	F834_Parms.bioWorld = bioWorld;
@@ -6257,10 +5984,9 @@ bool UBioAutoConditionals::F834 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1158 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1158 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1158Ref { L"Function PlotManager.BioAutoConditionals.F1158", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1158 )
-		pFnF1158 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1158" );
+	UFunction* const pFnF1158 = pFnF1158Ref.Get ( );
 
 	UBioAutoConditionals_execF1158_Parms F1158_Parms;
 	F1158_Parms.bioWorld = bioWorld;
@@ -6280,10 +6006,9 @@ bool UBioAutoConditionals::F1158 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F300 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF300 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF300Ref { L"Function PlotManager.BioAutoConditionals.F300", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF300 )
-		pFnF300 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F300" );
+	UFunction* const pFnF300 = pFnF300Ref.Get ( );
 
 	UBioAutoConditionals_execF300_Parms F300_Parms;
 	F300_Parms.bioWorld = bioWorld;
@@ -6303,10 +6028,9 @@ bool UBioAutoConditionals::F300 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F436 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF436 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF436Ref { L"Function PlotManager.BioAutoConditionals.F436", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF436 )
-		pFnF436 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F436" );
+	UFunction* const pFnF436 = pFnF436Ref.Get ( );
 
 	UBioAutoConditionals_execF436_Parms F436_Parms;
 	F436_Parms.bioWorld = bioWorld;
@@ -6326,10 +6050,9 @@ bool UBioAutoConditionals::F436 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F345 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF345 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF345Ref { L"Function PlotManager.BioAutoConditionals.F345", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF345 )
-		pFnF345 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F345" );
+	UFunction* const pFnF345 = pFnF345Ref.Get ( );
 
 	UBioAutoConditionals_execF345_Parms F345_Parms;
 	F345_Parms.bioWorld = bioWorld;
@@ -6349,10 +6072,9 @@ bool UBioAutoConditionals::F345 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F344 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF344 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF344Ref { L"Function PlotManager.BioAutoConditionals.F344", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF344 )
-		pFnF344 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F344" );
+	UFunction* const pFnF344 = pFnF344Ref.Get ( );
 
 	UBioAutoConditionals_execF344_Parms F344_Parms;
 	F344_Parms.bioWorld = bioWorld;
@@ -6372,10 +6094,9 @@ bool UBioAutoConditionals::F344 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F298 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF298 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF298Ref { L"Function PlotManager.BioAutoConditionals.F298", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF298 )
-		pFnF298 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F298" );
+	UFunction* const pFnF298 = pFnF298Ref.Get ( );
 
 	UBioAutoConditionals_execF298_Parms F298_Parms;
 	F298_Parms.bioWorld = bioWorld;
@@ -6395,10 +6116,9 @@ bool UBioAutoConditionals::F298 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F297 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF297 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF297Ref { L"Function PlotManager.BioAutoConditionals.F297", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF297 )
-		pFnF297 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F297" );
+	UFunction* const pFnF297 = pFnF297Ref.Get ( );
 
 	UBioAutoConditionals_execF297_Parms F297_Parms;
 	F297_Parms.bioWorld = bioWorld;
@@ -6418,10 +6138,9 @@ bool UBioAutoConditionals::F297 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F433 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF433 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF433Ref { L"Function PlotManager.BioAutoConditionals.F433", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF433 )
-		pFnF433 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F433" );
+	UFunction* const pFnF433 = pFnF433Ref.Get ( );
 
 	UBioAutoConditionals_execF433_Parms F433_Parms;
 	F433_Parms.bioWorld = bioWorld;
@@ -6441,10 +6160,9 @@ bool UBioAutoConditionals::F433 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F428 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF428 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF428Ref { L"Function PlotManager.BioAutoConditionals.F428", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF428 )
-		pFnF428 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F428" );
+	UFunction* const pFnF428 = pFnF428Ref.Get ( );
 
 	UBioAutoConditionals_execF428_Parms F428_Parms;
 	F428_Parms.bioWorld = bioWorld;
@@ -6464,10 +6182,9 @@ bool UBioAutoConditionals::F428 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F427 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF427 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF427Ref { L"Function PlotManager.BioAutoConditionals.F427", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF427 )
-		pFnF427 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F427" );
+	UFunction* const pFnF427 = pFnF427Ref.Get ( );
 
 	UBioAutoConditionals_execF427_Parms F427_Parms;
 	F427_Parms.bioWorld = bioWorld;
@@ -6487,10 +6204,9 @@ bool UBioAutoConditionals::F427 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F885 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF885 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF885Ref { L"Function PlotManager.BioAutoConditionals.F885", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF885 )
-		pFnF885 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F885" );
+	UFunction* const pFnF885 = pFnF885Ref.Get ( );
 
 	UBioAutoConditionals_execF885_Parms F885_Parms;
 	F885_Parms.bioWorld = bioWorld;
@@ -6510,10 +6226,9 @@ bool UBioAutoConditionals::F885 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F884 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF884 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF884Ref { L"Function PlotManager.BioAutoConditionals.F884", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF884 )
-		pFnF884 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F884" );
+	UFunction* const pFnF884 = pFnF884Ref.Get ( );
 
 	UBioAutoConditionals_execF884_Parms F884_Parms;
 	F884_Parms.bioWorld = bioWorld;
@@ -6533,10 +6248,9 @@ bool UBioAutoConditionals::F884 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F883 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF883 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF883Ref { L"Function PlotManager.BioAutoConditionals.F883", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF883 )
-		pFnF883 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F883" );
+	UFunction* const pFnF883 = pFnF883Ref.Get ( );
 
 	UBioAutoConditionals_execF883_Parms F883_Parms;
 	F883_Parms.bioWorld = bioWorld;
@@ -6556,10 +6270,9 @@ bool UBioAutoConditionals::F883 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F854 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF854 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF854Ref { L"Function PlotManager.BioAutoConditionals.F854", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF854 )
-		pFnF854 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F854" );
+	UFunction* const pFnF854 = pFnF854Ref.Get ( );
 
 	UBioAutoConditionals_execF854_Parms F854_Parms;
 	F854_Parms.bioWorld = bioWorld;
@@ -6579,10 +6292,9 @@ bool UBioAutoConditionals::F854 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F855 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF855 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF855Ref { L"Function PlotManager.BioAutoConditionals.F855", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF855 )
-		pFnF855 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F855" );
+	UFunction* const pFnF855 = pFnF855Ref.Get ( );
 
 	UBioAutoConditionals_execF855_Parms F855_Parms;
 	F855_Parms.bioWorld = bioWorld;
@@ -6602,10 +6314,9 @@ bool UBioAutoConditionals::F855 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F419 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF419 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF419Ref { L"Function PlotManager.BioAutoConditionals.F419", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF419 )
-		pFnF419 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F419" );
+	UFunction* const pFnF419 = pFnF419Ref.Get ( );
 
 	UBioAutoConditionals_execF419_Parms F419_Parms;
 	F419_Parms.bioWorld = bioWorld;
@@ -6625,10 +6336,9 @@ bool UBioAutoConditionals::F419 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1511 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1511 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1511Ref { L"Function PlotManager.BioAutoConditionals.F1511", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1511 )
-		pFnF1511 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1511" );
+	UFunction* const pFnF1511 = pFnF1511Ref.Get ( );
 
 	UBioAutoConditionals_execF1511_Parms F1511_Parms;
 	F1511_Parms.bioWorld = bioWorld;
@@ -6648,10 +6358,9 @@ bool UBioAutoConditionals::F1511 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F474 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF474 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF474Ref { L"Function PlotManager.BioAutoConditionals.F474", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF474 )
-		pFnF474 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F474" );
+	UFunction* const pFnF474 = pFnF474Ref.Get ( );
 
 	UBioAutoConditionals_execF474_Parms F474_Parms;
 	F474_Parms.bioWorld = bioWorld;
@@ -6671,10 +6380,9 @@ bool UBioAutoConditionals::F474 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F476 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF476 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF476Ref { L"Function PlotManager.BioAutoConditionals.F476", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF476 )
-		pFnF476 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F476" );
+	UFunction* const pFnF476 = pFnF476Ref.Get ( );
 
 	UBioAutoConditionals_execF476_Parms F476_Parms;
 	F476_Parms.bioWorld = bioWorld;
@@ -6694,10 +6402,9 @@ bool UBioAutoConditionals::F476 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F455 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF455 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF455Ref { L"Function PlotManager.BioAutoConditionals.F455", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF455 )
-		pFnF455 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F455" );
+	UFunction* const pFnF455 = pFnF455Ref.Get ( );
 
 	UBioAutoConditionals_execF455_Parms F455_Parms;
 	F455_Parms.bioWorld = bioWorld;
@@ -6717,10 +6424,9 @@ bool UBioAutoConditionals::F455 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F454 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF454 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF454Ref { L"Function PlotManager.BioAutoConditionals.F454", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF454 )
-		pFnF454 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F454" );
+	UFunction* const pFnF454 = pFnF454Ref.Get ( );
 
 	UBioAutoConditionals_execF454_Parms F454_Parms;
 	F454_Parms.bioWorld = bioWorld;
@@ -6740,10 +6446,9 @@ bool UBioAutoConditionals::F454 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F453 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF453 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF453Ref { L"Function PlotManager.BioAutoConditionals.F453", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF453 )
-		pFnF453 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F453" );
+	UFunction* const pFnF453 = pFnF453Ref.Get ( );
 
 	UBioAutoConditionals_execF453_Parms F453_Parms;
 	F453_Parms.bioWorld = bioWorld;
@@ -6763,10 +6468,9 @@ bool UBioAutoConditionals::F453 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F47 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF47 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF47Ref { L"Function PlotManager.BioAutoConditionals.F47", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF47 )
-		pFnF47 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F47" );
+	UFunction* const pFnF47 = pFnF47Ref.Get ( );
 
 	UBioAutoConditionals_execF47_Parms F47_Parms;
 	F47_Parms.bioWorld = bioWorld;
@@ -6786,10 +6490,9 @@ bool UBioAutoConditionals::F47 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F46 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF46 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF46Ref { L"Function PlotManager.BioAutoConditionals.F46", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF46 )
-		pFnF46 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F46" );
+	UFunction* const pFnF46 = pFnF46Ref.Get ( );
 
 	UBioAutoConditionals_execF46_Parms F46_Parms;
 	F46_Parms.bioWorld = bioWorld;
@@ -6809,10 +6512,9 @@ bool UBioAutoConditionals::F46 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F57 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF57 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF57Ref { L"Function PlotManager.BioAutoConditionals.F57", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF57 )
-		pFnF57 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F57" );
+	UFunction* const pFnF57 = pFnF57Ref.Get ( );
 
 	UBioAutoConditionals_execF57_Parms F57_Parms;
 	F57_Parms.bioWorld = bioWorld;
@@ -6832,10 +6534,9 @@ bool UBioAutoConditionals::F57 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F68 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF68 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF68Ref { L"Function PlotManager.BioAutoConditionals.F68", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF68 )
-		pFnF68 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F68" );
+	UFunction* const pFnF68 = pFnF68Ref.Get ( );
 
 	UBioAutoConditionals_execF68_Parms F68_Parms;
 	F68_Parms.bioWorld = bioWorld;
@@ -6855,10 +6556,9 @@ bool UBioAutoConditionals::F68 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F67 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF67 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF67Ref { L"Function PlotManager.BioAutoConditionals.F67", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF67 )
-		pFnF67 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F67" );
+	UFunction* const pFnF67 = pFnF67Ref.Get ( );
 
 	UBioAutoConditionals_execF67_Parms F67_Parms;
 	F67_Parms.bioWorld = bioWorld;
@@ -6878,10 +6578,9 @@ bool UBioAutoConditionals::F67 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F45 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF45 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF45Ref { L"Function PlotManager.BioAutoConditionals.F45", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF45 )
-		pFnF45 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F45" );
+	UFunction* const pFnF45 = pFnF45Ref.Get ( );
 
 	UBioAutoConditionals_execF45_Parms F45_Parms;
 	F45_Parms.bioWorld = bioWorld;
@@ -6901,10 +6600,9 @@ bool UBioAutoConditionals::F45 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F43 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF43 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF43Ref { L"Function PlotManager.BioAutoConditionals.F43", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF43 )
-		pFnF43 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F43" );
+	UFunction* const pFnF43 = pFnF43Ref.Get ( );
 
 	UBioAutoConditionals_execF43_Parms F43_Parms;
 	F43_Parms.bioWorld = bioWorld;
@@ -6924,10 +6622,9 @@ bool UBioAutoConditionals::F43 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F42 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF42 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF42Ref { L"Function PlotManager.BioAutoConditionals.F42", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF42 )
-		pFnF42 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F42" );
+	UFunction* const pFnF42 = pFnF42Ref.Get ( );
 
 	UBioAutoConditionals_execF42_Parms F42_Parms;
 	F42_Parms.bioWorld = bioWorld;
@@ -6947,10 +6644,9 @@ bool UBioAutoConditionals::F42 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F41 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF41 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF41Ref { L"Function PlotManager.BioAutoConditionals.F41", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF41 )
-		pFnF41 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F41" );
+	UFunction* const pFnF41 = pFnF41Ref.Get ( );
 
 	UBioAutoConditionals_execF41_Parms F41_Parms;
 	F41_Parms.bioWorld = bioWorld;
@@ -6970,10 +6666,9 @@ bool UBioAutoConditionals::F41 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F40 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF40 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF40Ref { L"Function PlotManager.BioAutoConditionals.F40", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF40 )
-		pFnF40 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F40" );
+	UFunction* const pFnF40 = pFnF40Ref.Get ( );
 
 	UBioAutoConditionals_execF40_Parms F40_Parms;
 	F40_Parms.bioWorld = bioWorld;
@@ -6993,10 +6688,9 @@ bool UBioAutoConditionals::F40 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F39 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF39 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF39Ref { L"Function PlotManager.BioAutoConditionals.F39", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF39 )
-		pFnF39 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F39" );
+	UFunction* const pFnF39 = pFnF39Ref.Get ( );
 
 	UBioAutoConditionals_execF39_Parms F39_Parms;
 	F39_Parms.bioWorld = bioWorld;
@@ -7016,10 +6710,9 @@ bool UBioAutoConditionals::F39 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F38 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF38 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF38Ref { L"Function PlotManager.BioAutoConditionals.F38", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF38 )
-		pFnF38 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F38" );
+	UFunction* const pFnF38 = pFnF38Ref.Get ( );
 
 	UBioAutoConditionals_execF38_Parms F38_Parms;
 	F38_Parms.bioWorld = bioWorld;
@@ -7039,10 +6732,9 @@ bool UBioAutoConditionals::F38 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F37 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF37 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF37Ref { L"Function PlotManager.BioAutoConditionals.F37", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF37 )
-		pFnF37 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F37" );
+	UFunction* const pFnF37 = pFnF37Ref.Get ( );
 
 	UBioAutoConditionals_execF37_Parms F37_Parms;
 	F37_Parms.bioWorld = bioWorld;
@@ -7062,10 +6754,9 @@ bool UBioAutoConditionals::F37 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F36 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF36 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF36Ref { L"Function PlotManager.BioAutoConditionals.F36", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF36 )
-		pFnF36 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F36" );
+	UFunction* const pFnF36 = pFnF36Ref.Get ( );
 
 	UBioAutoConditionals_execF36_Parms F36_Parms;
 	F36_Parms.bioWorld = bioWorld;
@@ -7085,10 +6776,9 @@ bool UBioAutoConditionals::F36 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F35 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF35 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF35Ref { L"Function PlotManager.BioAutoConditionals.F35", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF35 )
-		pFnF35 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F35" );
+	UFunction* const pFnF35 = pFnF35Ref.Get ( );
 
 	UBioAutoConditionals_execF35_Parms F35_Parms;
 	F35_Parms.bioWorld = bioWorld;
@@ -7108,10 +6798,9 @@ bool UBioAutoConditionals::F35 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F34 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF34 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF34Ref { L"Function PlotManager.BioAutoConditionals.F34", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF34 )
-		pFnF34 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F34" );
+	UFunction* const pFnF34 = pFnF34Ref.Get ( );
 
 	UBioAutoConditionals_execF34_Parms F34_Parms;
 	F34_Parms.bioWorld = bioWorld;
@@ -7131,10 +6820,9 @@ bool UBioAutoConditionals::F34 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F33 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF33 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF33Ref { L"Function PlotManager.BioAutoConditionals.F33", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF33 )
-		pFnF33 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F33" );
+	UFunction* const pFnF33 = pFnF33Ref.Get ( );
 
 	UBioAutoConditionals_execF33_Parms F33_Parms;
 	F33_Parms.bioWorld = bioWorld;
@@ -7154,10 +6842,9 @@ bool UBioAutoConditionals::F33 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F32 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF32 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF32Ref { L"Function PlotManager.BioAutoConditionals.F32", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF32 )
-		pFnF32 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F32" );
+	UFunction* const pFnF32 = pFnF32Ref.Get ( );
 
 	UBioAutoConditionals_execF32_Parms F32_Parms;
 	F32_Parms.bioWorld = bioWorld;
@@ -7177,10 +6864,9 @@ bool UBioAutoConditionals::F32 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F31 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF31 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF31Ref { L"Function PlotManager.BioAutoConditionals.F31", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF31 )
-		pFnF31 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F31" );
+	UFunction* const pFnF31 = pFnF31Ref.Get ( );
 
 	UBioAutoConditionals_execF31_Parms F31_Parms;
 	F31_Parms.bioWorld = bioWorld;
@@ -7200,10 +6886,9 @@ bool UBioAutoConditionals::F31 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F30 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF30 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF30Ref { L"Function PlotManager.BioAutoConditionals.F30", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF30 )
-		pFnF30 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F30" );
+	UFunction* const pFnF30 = pFnF30Ref.Get ( );
 
 	UBioAutoConditionals_execF30_Parms F30_Parms;
 	F30_Parms.bioWorld = bioWorld;
@@ -7223,10 +6908,9 @@ bool UBioAutoConditionals::F30 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F29 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF29 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF29Ref { L"Function PlotManager.BioAutoConditionals.F29", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF29 )
-		pFnF29 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F29" );
+	UFunction* const pFnF29 = pFnF29Ref.Get ( );
 
 	UBioAutoConditionals_execF29_Parms F29_Parms;
 	F29_Parms.bioWorld = bioWorld;
@@ -7246,10 +6930,9 @@ bool UBioAutoConditionals::F29 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F28 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF28 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF28Ref { L"Function PlotManager.BioAutoConditionals.F28", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF28 )
-		pFnF28 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F28" );
+	UFunction* const pFnF28 = pFnF28Ref.Get ( );
 
 	UBioAutoConditionals_execF28_Parms F28_Parms;
 	F28_Parms.bioWorld = bioWorld;
@@ -7269,10 +6952,9 @@ bool UBioAutoConditionals::F28 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F27 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF27 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF27Ref { L"Function PlotManager.BioAutoConditionals.F27", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF27 )
-		pFnF27 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F27" );
+	UFunction* const pFnF27 = pFnF27Ref.Get ( );
 
 	UBioAutoConditionals_execF27_Parms F27_Parms;
 	F27_Parms.bioWorld = bioWorld;
@@ -7292,10 +6974,9 @@ bool UBioAutoConditionals::F27 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F508 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF508 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF508Ref { L"Function PlotManager.BioAutoConditionals.F508", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF508 )
-		pFnF508 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F508" );
+	UFunction* const pFnF508 = pFnF508Ref.Get ( );
 
 	UBioAutoConditionals_execF508_Parms F508_Parms;
 	F508_Parms.bioWorld = bioWorld;
@@ -7315,10 +6996,9 @@ bool UBioAutoConditionals::F508 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F510 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF510 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF510Ref { L"Function PlotManager.BioAutoConditionals.F510", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF510 )
-		pFnF510 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F510" );
+	UFunction* const pFnF510 = pFnF510Ref.Get ( );
 
 	UBioAutoConditionals_execF510_Parms F510_Parms;
 	F510_Parms.bioWorld = bioWorld;
@@ -7338,10 +7018,9 @@ bool UBioAutoConditionals::F510 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F583 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF583 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF583Ref { L"Function PlotManager.BioAutoConditionals.F583", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF583 )
-		pFnF583 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F583" );
+	UFunction* const pFnF583 = pFnF583Ref.Get ( );
 
 	UBioAutoConditionals_execF583_Parms F583_Parms;
 	F583_Parms.bioWorld = bioWorld;
@@ -7361,10 +7040,9 @@ bool UBioAutoConditionals::F583 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F524 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF524 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF524Ref { L"Function PlotManager.BioAutoConditionals.F524", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF524 )
-		pFnF524 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F524" );
+	UFunction* const pFnF524 = pFnF524Ref.Get ( );
 
 	UBioAutoConditionals_execF524_Parms F524_Parms;
 	F524_Parms.bioWorld = bioWorld;
@@ -7384,10 +7062,9 @@ bool UBioAutoConditionals::F524 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F509 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF509 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF509Ref { L"Function PlotManager.BioAutoConditionals.F509", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF509 )
-		pFnF509 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F509" );
+	UFunction* const pFnF509 = pFnF509Ref.Get ( );
 
 	UBioAutoConditionals_execF509_Parms F509_Parms;
 	F509_Parms.bioWorld = bioWorld;
@@ -7407,10 +7084,9 @@ bool UBioAutoConditionals::F509 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1628 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1628 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1628Ref { L"Function PlotManager.BioAutoConditionals.F1628", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1628 )
-		pFnF1628 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1628" );
+	UFunction* const pFnF1628 = pFnF1628Ref.Get ( );
 
 	UBioAutoConditionals_execF1628_Parms F1628_Parms;
 	F1628_Parms.bioWorld = bioWorld;
@@ -7430,10 +7106,9 @@ bool UBioAutoConditionals::F1628 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F523 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF523 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF523Ref { L"Function PlotManager.BioAutoConditionals.F523", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF523 )
-		pFnF523 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F523" );
+	UFunction* const pFnF523 = pFnF523Ref.Get ( );
 
 	UBioAutoConditionals_execF523_Parms F523_Parms;
 	F523_Parms.bioWorld = bioWorld;
@@ -7453,10 +7128,9 @@ bool UBioAutoConditionals::F523 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F522 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF522 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF522Ref { L"Function PlotManager.BioAutoConditionals.F522", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF522 )
-		pFnF522 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F522" );
+	UFunction* const pFnF522 = pFnF522Ref.Get ( );
 
 	UBioAutoConditionals_execF522_Parms F522_Parms;
 	F522_Parms.bioWorld = bioWorld;
@@ -7476,10 +7150,9 @@ bool UBioAutoConditionals::F522 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F329 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF329 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF329Ref { L"Function PlotManager.BioAutoConditionals.F329", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF329 )
-		pFnF329 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F329" );
+	UFunction* const pFnF329 = pFnF329Ref.Get ( );
 
 	UBioAutoConditionals_execF329_Parms F329_Parms;
 	F329_Parms.bioWorld = bioWorld;
@@ -7499,10 +7172,9 @@ bool UBioAutoConditionals::F329 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F328 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF328 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF328Ref { L"Function PlotManager.BioAutoConditionals.F328", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF328 )
-		pFnF328 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F328" );
+	UFunction* const pFnF328 = pFnF328Ref.Get ( );
 
 	UBioAutoConditionals_execF328_Parms F328_Parms;
 	F328_Parms.bioWorld = bioWorld;
@@ -7522,10 +7194,9 @@ bool UBioAutoConditionals::F328 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F327 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF327 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF327Ref { L"Function PlotManager.BioAutoConditionals.F327", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF327 )
-		pFnF327 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F327" );
+	UFunction* const pFnF327 = pFnF327Ref.Get ( );
 
 	UBioAutoConditionals_execF327_Parms F327_Parms;
 	F327_Parms.bioWorld = bioWorld;
@@ -7545,10 +7216,9 @@ bool UBioAutoConditionals::F327 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F331 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF331 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF331Ref { L"Function PlotManager.BioAutoConditionals.F331", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF331 )
-		pFnF331 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F331" );
+	UFunction* const pFnF331 = pFnF331Ref.Get ( );
 
 	UBioAutoConditionals_execF331_Parms F331_Parms;
 	F331_Parms.bioWorld = bioWorld;
@@ -7568,10 +7238,9 @@ bool UBioAutoConditionals::F331 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F461 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF461 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF461Ref { L"Function PlotManager.BioAutoConditionals.F461", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF461 )
-		pFnF461 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F461" );
+	UFunction* const pFnF461 = pFnF461Ref.Get ( );
 
 	UBioAutoConditionals_execF461_Parms F461_Parms;
 	F461_Parms.bioWorld = bioWorld;
@@ -7591,10 +7260,9 @@ bool UBioAutoConditionals::F461 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F460 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF460 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF460Ref { L"Function PlotManager.BioAutoConditionals.F460", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF460 )
-		pFnF460 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F460" );
+	UFunction* const pFnF460 = pFnF460Ref.Get ( );
 
 	UBioAutoConditionals_execF460_Parms F460_Parms;
 	F460_Parms.bioWorld = bioWorld;
@@ -7614,10 +7282,9 @@ bool UBioAutoConditionals::F460 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F256 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF256 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF256Ref { L"Function PlotManager.BioAutoConditionals.F256", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF256 )
-		pFnF256 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F256" );
+	UFunction* const pFnF256 = pFnF256Ref.Get ( );
 
 	UBioAutoConditionals_execF256_Parms F256_Parms;
 	F256_Parms.bioWorld = bioWorld;
@@ -7637,10 +7304,9 @@ bool UBioAutoConditionals::F256 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F954 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF954 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF954Ref { L"Function PlotManager.BioAutoConditionals.F954", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF954 )
-		pFnF954 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F954" );
+	UFunction* const pFnF954 = pFnF954Ref.Get ( );
 
 	UBioAutoConditionals_execF954_Parms F954_Parms;
 	F954_Parms.bioWorld = bioWorld;
@@ -7660,10 +7326,9 @@ bool UBioAutoConditionals::F954 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F643 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF643 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF643Ref { L"Function PlotManager.BioAutoConditionals.F643", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF643 )
-		pFnF643 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F643" );
+	UFunction* const pFnF643 = pFnF643Ref.Get ( );
 
 	UBioAutoConditionals_execF643_Parms F643_Parms;
 	F643_Parms.bioWorld = bioWorld;
@@ -7683,10 +7348,9 @@ bool UBioAutoConditionals::F643 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F429 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF429 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF429Ref { L"Function PlotManager.BioAutoConditionals.F429", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF429 )
-		pFnF429 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F429" );
+	UFunction* const pFnF429 = pFnF429Ref.Get ( );
 
 	UBioAutoConditionals_execF429_Parms F429_Parms;
 	F429_Parms.bioWorld = bioWorld;
@@ -7706,10 +7370,9 @@ bool UBioAutoConditionals::F429 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1444 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1444 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1444Ref { L"Function PlotManager.BioAutoConditionals.F1444", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1444 )
-		pFnF1444 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1444" );
+	UFunction* const pFnF1444 = pFnF1444Ref.Get ( );
 
 	UBioAutoConditionals_execF1444_Parms F1444_Parms;
 	F1444_Parms.bioWorld = bioWorld;
@@ -7729,10 +7392,9 @@ bool UBioAutoConditionals::F1444 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1443 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1443 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1443Ref { L"Function PlotManager.BioAutoConditionals.F1443", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1443 )
-		pFnF1443 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1443" );
+	UFunction* const pFnF1443 = pFnF1443Ref.Get ( );
 
 	UBioAutoConditionals_execF1443_Parms F1443_Parms;
 	F1443_Parms.bioWorld = bioWorld;
@@ -7752,10 +7414,9 @@ bool UBioAutoConditionals::F1443 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1442 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1442 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1442Ref { L"Function PlotManager.BioAutoConditionals.F1442", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1442 )
-		pFnF1442 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1442" );
+	UFunction* const pFnF1442 = pFnF1442Ref.Get ( );
 
 	UBioAutoConditionals_execF1442_Parms F1442_Parms;
 	F1442_Parms.bioWorld = bioWorld;
@@ -7775,10 +7436,9 @@ bool UBioAutoConditionals::F1442 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1441 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1441 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1441Ref { L"Function PlotManager.BioAutoConditionals.F1441", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1441 )
-		pFnF1441 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1441" );
+	UFunction* const pFnF1441 = pFnF1441Ref.Get ( );
 
 	UBioAutoConditionals_execF1441_Parms F1441_Parms;
 	F1441_Parms.bioWorld = bioWorld;
@@ -7798,10 +7458,9 @@ bool UBioAutoConditionals::F1441 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1440 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1440 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1440Ref { L"Function PlotManager.BioAutoConditionals.F1440", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1440 )
-		pFnF1440 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1440" );
+	UFunction* const pFnF1440 = pFnF1440Ref.Get ( );
 
 	UBioAutoConditionals_execF1440_Parms F1440_Parms;
 	F1440_Parms.bioWorld = bioWorld;
@@ -7821,10 +7480,9 @@ bool UBioAutoConditionals::F1440 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1439 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1439 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1439Ref { L"Function PlotManager.BioAutoConditionals.F1439", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1439 )
-		pFnF1439 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1439" );
+	UFunction* const pFnF1439 = pFnF1439Ref.Get ( );
 
 	UBioAutoConditionals_execF1439_Parms F1439_Parms;
 	F1439_Parms.bioWorld = bioWorld;
@@ -7844,10 +7502,9 @@ bool UBioAutoConditionals::F1439 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1438 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1438 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1438Ref { L"Function PlotManager.BioAutoConditionals.F1438", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1438 )
-		pFnF1438 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1438" );
+	UFunction* const pFnF1438 = pFnF1438Ref.Get ( );
 
 	UBioAutoConditionals_execF1438_Parms F1438_Parms;
 	F1438_Parms.bioWorld = bioWorld;
@@ -7867,10 +7524,9 @@ bool UBioAutoConditionals::F1438 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1437 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1437 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1437Ref { L"Function PlotManager.BioAutoConditionals.F1437", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1437 )
-		pFnF1437 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1437" );
+	UFunction* const pFnF1437 = pFnF1437Ref.Get ( );
 
 	UBioAutoConditionals_execF1437_Parms F1437_Parms;
 	F1437_Parms.bioWorld = bioWorld;
@@ -7890,10 +7546,9 @@ bool UBioAutoConditionals::F1437 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1436 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1436 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1436Ref { L"Function PlotManager.BioAutoConditionals.F1436", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1436 )
-		pFnF1436 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1436" );
+	UFunction* const pFnF1436 = pFnF1436Ref.Get ( );
 
 	UBioAutoConditionals_execF1436_Parms F1436_Parms;
 	F1436_Parms.bioWorld = bioWorld;
@@ -7913,10 +7568,9 @@ bool UBioAutoConditionals::F1436 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1435 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1435 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1435Ref { L"Function PlotManager.BioAutoConditionals.F1435", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1435 )
-		pFnF1435 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1435" );
+	UFunction* const pFnF1435 = pFnF1435Ref.Get ( );
 
 	UBioAutoConditionals_execF1435_Parms F1435_Parms;
 	F1435_Parms.bioWorld = bioWorld;
@@ -7936,10 +7590,9 @@ bool UBioAutoConditionals::F1435 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1434 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1434 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1434Ref { L"Function PlotManager.BioAutoConditionals.F1434", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1434 )
-		pFnF1434 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1434" );
+	UFunction* const pFnF1434 = pFnF1434Ref.Get ( );
 
 	UBioAutoConditionals_execF1434_Parms F1434_Parms;
 	F1434_Parms.bioWorld = bioWorld;
@@ -7959,10 +7612,9 @@ bool UBioAutoConditionals::F1434 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1433 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1433 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1433Ref { L"Function PlotManager.BioAutoConditionals.F1433", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1433 )
-		pFnF1433 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1433" );
+	UFunction* const pFnF1433 = pFnF1433Ref.Get ( );
 
 	UBioAutoConditionals_execF1433_Parms F1433_Parms;
 	F1433_Parms.bioWorld = bioWorld;
@@ -7982,10 +7634,9 @@ bool UBioAutoConditionals::F1433 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1432 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1432 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1432Ref { L"Function PlotManager.BioAutoConditionals.F1432", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1432 )
-		pFnF1432 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1432" );
+	UFunction* const pFnF1432 = pFnF1432Ref.Get ( );
 
 	UBioAutoConditionals_execF1432_Parms F1432_Parms;
 	F1432_Parms.bioWorld = bioWorld;
@@ -8005,10 +7656,9 @@ bool UBioAutoConditionals::F1432 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1431 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1431 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1431Ref { L"Function PlotManager.BioAutoConditionals.F1431", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1431 )
-		pFnF1431 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1431" );
+	UFunction* const pFnF1431 = pFnF1431Ref.Get ( );
 
 	UBioAutoConditionals_execF1431_Parms F1431_Parms;
 	F1431_Parms.bioWorld = bioWorld;
@@ -8028,10 +7678,9 @@ bool UBioAutoConditionals::F1431 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1508 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1508 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1508Ref { L"Function PlotManager.BioAutoConditionals.F1508", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1508 )
-		pFnF1508 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1508" );
+	UFunction* const pFnF1508 = pFnF1508Ref.Get ( );
 
 	UBioAutoConditionals_execF1508_Parms F1508_Parms;
 	F1508_Parms.bioWorld = bioWorld;
@@ -8051,10 +7700,9 @@ bool UBioAutoConditionals::F1508 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1078 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1078 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1078Ref { L"Function PlotManager.BioAutoConditionals.F1078", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1078 )
-		pFnF1078 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1078" );
+	UFunction* const pFnF1078 = pFnF1078Ref.Get ( );
 
 	UBioAutoConditionals_execF1078_Parms F1078_Parms;
 	F1078_Parms.bioWorld = bioWorld;
@@ -8074,10 +7722,9 @@ bool UBioAutoConditionals::F1078 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F953 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF953 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF953Ref { L"Function PlotManager.BioAutoConditionals.F953", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF953 )
-		pFnF953 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F953" );
+	UFunction* const pFnF953 = pFnF953Ref.Get ( );
 
 	UBioAutoConditionals_execF953_Parms F953_Parms;
 	F953_Parms.bioWorld = bioWorld;
@@ -8097,10 +7744,9 @@ bool UBioAutoConditionals::F953 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F952 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF952 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF952Ref { L"Function PlotManager.BioAutoConditionals.F952", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF952 )
-		pFnF952 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F952" );
+	UFunction* const pFnF952 = pFnF952Ref.Get ( );
 
 	UBioAutoConditionals_execF952_Parms F952_Parms;
 	F952_Parms.bioWorld = bioWorld;
@@ -8120,10 +7766,9 @@ bool UBioAutoConditionals::F952 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F950 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF950 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF950Ref { L"Function PlotManager.BioAutoConditionals.F950", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF950 )
-		pFnF950 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F950" );
+	UFunction* const pFnF950 = pFnF950Ref.Get ( );
 
 	UBioAutoConditionals_execF950_Parms F950_Parms;
 	F950_Parms.bioWorld = bioWorld;
@@ -8143,10 +7788,9 @@ bool UBioAutoConditionals::F950 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F949 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF949 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF949Ref { L"Function PlotManager.BioAutoConditionals.F949", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF949 )
-		pFnF949 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F949" );
+	UFunction* const pFnF949 = pFnF949Ref.Get ( );
 
 	UBioAutoConditionals_execF949_Parms F949_Parms;
 	F949_Parms.bioWorld = bioWorld;
@@ -8166,10 +7810,9 @@ bool UBioAutoConditionals::F949 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F941 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF941 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF941Ref { L"Function PlotManager.BioAutoConditionals.F941", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF941 )
-		pFnF941 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F941" );
+	UFunction* const pFnF941 = pFnF941Ref.Get ( );
 
 	UBioAutoConditionals_execF941_Parms F941_Parms;
 	F941_Parms.bioWorld = bioWorld;
@@ -8189,10 +7832,9 @@ bool UBioAutoConditionals::F941 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F930 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF930 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF930Ref { L"Function PlotManager.BioAutoConditionals.F930", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF930 )
-		pFnF930 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F930" );
+	UFunction* const pFnF930 = pFnF930Ref.Get ( );
 
 	UBioAutoConditionals_execF930_Parms F930_Parms;
 	F930_Parms.bioWorld = bioWorld;
@@ -8212,10 +7854,9 @@ bool UBioAutoConditionals::F930 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F873 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF873 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF873Ref { L"Function PlotManager.BioAutoConditionals.F873", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF873 )
-		pFnF873 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F873" );
+	UFunction* const pFnF873 = pFnF873Ref.Get ( );
 
 	UBioAutoConditionals_execF873_Parms F873_Parms;
 	F873_Parms.bioWorld = bioWorld;
@@ -8235,10 +7876,9 @@ bool UBioAutoConditionals::F873 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1555 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1555 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1555Ref { L"Function PlotManager.BioAutoConditionals.F1555", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1555 )
-		pFnF1555 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1555" );
+	UFunction* const pFnF1555 = pFnF1555Ref.Get ( );
 
 	UBioAutoConditionals_execF1555_Parms F1555_Parms;
 	F1555_Parms.bioWorld = bioWorld;
@@ -8258,10 +7898,9 @@ bool UBioAutoConditionals::F1555 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1186 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1186 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1186Ref { L"Function PlotManager.BioAutoConditionals.F1186", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1186 )
-		pFnF1186 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1186" );
+	UFunction* const pFnF1186 = pFnF1186Ref.Get ( );
 
 	UBioAutoConditionals_execF1186_Parms F1186_Parms;
 	F1186_Parms.bioWorld = bioWorld;
@@ -8281,10 +7920,9 @@ bool UBioAutoConditionals::F1186 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F951 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF951 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF951Ref { L"Function PlotManager.BioAutoConditionals.F951", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF951 )
-		pFnF951 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F951" );
+	UFunction* const pFnF951 = pFnF951Ref.Get ( );
 
 	UBioAutoConditionals_execF951_Parms F951_Parms;
 	F951_Parms.bioWorld = bioWorld;
@@ -8304,10 +7942,9 @@ bool UBioAutoConditionals::F951 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F876 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF876 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF876Ref { L"Function PlotManager.BioAutoConditionals.F876", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF876 )
-		pFnF876 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F876" );
+	UFunction* const pFnF876 = pFnF876Ref.Get ( );
 
 	UBioAutoConditionals_execF876_Parms F876_Parms;
 	F876_Parms.bioWorld = bioWorld;
@@ -8327,10 +7964,9 @@ bool UBioAutoConditionals::F876 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F845 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF845 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF845Ref { L"Function PlotManager.BioAutoConditionals.F845", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF845 )
-		pFnF845 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F845" );
+	UFunction* const pFnF845 = pFnF845Ref.Get ( );
 
 	UBioAutoConditionals_execF845_Parms F845_Parms;
 	F845_Parms.bioWorld = bioWorld;
@@ -8350,10 +7986,9 @@ bool UBioAutoConditionals::F845 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F833 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF833 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF833Ref { L"Function PlotManager.BioAutoConditionals.F833", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF833 )
-		pFnF833 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F833" );
+	UFunction* const pFnF833 = pFnF833Ref.Get ( );
 
 	UBioAutoConditionals_execF833_Parms F833_Parms;
 	F833_Parms.bioWorld = bioWorld;
@@ -8373,10 +8008,9 @@ bool UBioAutoConditionals::F833 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1523 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1523 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1523Ref { L"Function PlotManager.BioAutoConditionals.F1523", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1523 )
-		pFnF1523 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1523" );
+	UFunction* const pFnF1523 = pFnF1523Ref.Get ( );
 
 	UBioAutoConditionals_execF1523_Parms F1523_Parms;
 	F1523_Parms.bioWorld = bioWorld;
@@ -8396,10 +8030,9 @@ bool UBioAutoConditionals::F1523 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1519 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1519 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1519Ref { L"Function PlotManager.BioAutoConditionals.F1519", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1519 )
-		pFnF1519 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1519" );
+	UFunction* const pFnF1519 = pFnF1519Ref.Get ( );
 
 	UBioAutoConditionals_execF1519_Parms F1519_Parms;
 	F1519_Parms.bioWorld = bioWorld;
@@ -8419,10 +8052,9 @@ bool UBioAutoConditionals::F1519 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F848 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF848 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF848Ref { L"Function PlotManager.BioAutoConditionals.F848", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF848 )
-		pFnF848 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F848" );
+	UFunction* const pFnF848 = pFnF848Ref.Get ( );
 
 	UBioAutoConditionals_execF848_Parms F848_Parms;
 	F848_Parms.bioWorld = bioWorld;
@@ -8442,10 +8074,9 @@ bool UBioAutoConditionals::F848 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F847 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF847 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF847Ref { L"Function PlotManager.BioAutoConditionals.F847", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF847 )
-		pFnF847 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F847" );
+	UFunction* const pFnF847 = pFnF847Ref.Get ( );
 
 	UBioAutoConditionals_execF847_Parms F847_Parms;
 	F847_Parms.bioWorld = bioWorld;
@@ -8465,10 +8096,9 @@ bool UBioAutoConditionals::F847 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F846 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF846 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF846Ref { L"Function PlotManager.BioAutoConditionals.F846", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF846 )
-		pFnF846 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F846" );
+	UFunction* const pFnF846 = pFnF846Ref.Get ( );
 
 	UBioAutoConditionals_execF846_Parms F846_Parms;
 	F846_Parms.bioWorld = bioWorld;
@@ -8488,10 +8118,9 @@ bool UBioAutoConditionals::F846 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F820 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF820 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF820Ref { L"Function PlotManager.BioAutoConditionals.F820", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF820 )
-		pFnF820 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F820" );
+	UFunction* const pFnF820 = pFnF820Ref.Get ( );
 
 	UBioAutoConditionals_execF820_Parms F820_Parms;
 	F820_Parms.bioWorld = bioWorld;
@@ -8511,10 +8140,9 @@ bool UBioAutoConditionals::F820 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F815 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF815 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF815Ref { L"Function PlotManager.BioAutoConditionals.F815", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF815 )
-		pFnF815 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F815" );
+	UFunction* const pFnF815 = pFnF815Ref.Get ( );
 
 	UBioAutoConditionals_execF815_Parms F815_Parms;
 	F815_Parms.bioWorld = bioWorld;
@@ -8534,10 +8162,9 @@ bool UBioAutoConditionals::F815 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F814 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF814 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF814Ref { L"Function PlotManager.BioAutoConditionals.F814", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF814 )
-		pFnF814 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F814" );
+	UFunction* const pFnF814 = pFnF814Ref.Get ( );
 
 	UBioAutoConditionals_execF814_Parms F814_Parms;
 	F814_Parms.bioWorld = bioWorld;
@@ -8557,10 +8184,9 @@ bool UBioAutoConditionals::F814 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F813 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF813 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF813Ref { L"Function PlotManager.BioAutoConditionals.F813", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF813 )
-		pFnF813 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F813" );
+	UFunction* const pFnF813 = pFnF813Ref.Get ( );
 
 	UBioAutoConditionals_execF813_Parms F813_Parms;
 	F813_Parms.bioWorld = bioWorld;
@@ -8580,10 +8206,9 @@ bool UBioAutoConditionals::F813 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F787 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF787 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF787Ref { L"Function PlotManager.BioAutoConditionals.F787", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF787 )
-		pFnF787 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F787" );
+	UFunction* const pFnF787 = pFnF787Ref.Get ( );
 
 	UBioAutoConditionals_execF787_Parms F787_Parms;
 	F787_Parms.bioWorld = bioWorld;
@@ -8603,10 +8228,9 @@ bool UBioAutoConditionals::F787 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F786 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF786 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF786Ref { L"Function PlotManager.BioAutoConditionals.F786", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF786 )
-		pFnF786 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F786" );
+	UFunction* const pFnF786 = pFnF786Ref.Get ( );
 
 	UBioAutoConditionals_execF786_Parms F786_Parms;
 	F786_Parms.bioWorld = bioWorld;
@@ -8626,10 +8250,9 @@ bool UBioAutoConditionals::F786 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F785 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF785 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF785Ref { L"Function PlotManager.BioAutoConditionals.F785", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF785 )
-		pFnF785 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F785" );
+	UFunction* const pFnF785 = pFnF785Ref.Get ( );
 
 	UBioAutoConditionals_execF785_Parms F785_Parms;
 	F785_Parms.bioWorld = bioWorld;
@@ -8649,10 +8272,9 @@ bool UBioAutoConditionals::F785 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F784 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF784 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF784Ref { L"Function PlotManager.BioAutoConditionals.F784", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF784 )
-		pFnF784 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F784" );
+	UFunction* const pFnF784 = pFnF784Ref.Get ( );
 
 	UBioAutoConditionals_execF784_Parms F784_Parms;
 	F784_Parms.bioWorld = bioWorld;
@@ -8672,10 +8294,9 @@ bool UBioAutoConditionals::F784 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F783 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF783 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF783Ref { L"Function PlotManager.BioAutoConditionals.F783", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF783 )
-		pFnF783 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F783" );
+	UFunction* const pFnF783 = pFnF783Ref.Get ( );
 
 	UBioAutoConditionals_execF783_Parms F783_Parms;
 	F783_Parms.bioWorld = bioWorld;
@@ -8695,10 +8316,9 @@ bool UBioAutoConditionals::F783 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F781 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF781 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF781Ref { L"Function PlotManager.BioAutoConditionals.F781", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF781 )
-		pFnF781 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F781" );
+	UFunction* const pFnF781 = pFnF781Ref.Get ( );
 
 	UBioAutoConditionals_execF781_Parms F781_Parms;
 	F781_Parms.bioWorld = bioWorld;
@@ -8718,10 +8338,9 @@ bool UBioAutoConditionals::F781 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F780 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF780 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF780Ref { L"Function PlotManager.BioAutoConditionals.F780", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF780 )
-		pFnF780 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F780" );
+	UFunction* const pFnF780 = pFnF780Ref.Get ( );
 
 	UBioAutoConditionals_execF780_Parms F780_Parms;
 	F780_Parms.bioWorld = bioWorld;
@@ -8741,10 +8360,9 @@ bool UBioAutoConditionals::F780 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1624 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1624 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1624Ref { L"Function PlotManager.BioAutoConditionals.F1624", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1624 )
-		pFnF1624 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1624" );
+	UFunction* const pFnF1624 = pFnF1624Ref.Get ( );
 
 	UBioAutoConditionals_execF1624_Parms F1624_Parms;
 	F1624_Parms.bioWorld = bioWorld;
@@ -8764,10 +8382,9 @@ bool UBioAutoConditionals::F1624 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1577 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1577 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1577Ref { L"Function PlotManager.BioAutoConditionals.F1577", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1577 )
-		pFnF1577 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1577" );
+	UFunction* const pFnF1577 = pFnF1577Ref.Get ( );
 
 	UBioAutoConditionals_execF1577_Parms F1577_Parms;
 	F1577_Parms.bioWorld = bioWorld;
@@ -8787,10 +8404,9 @@ bool UBioAutoConditionals::F1577 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1538 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1538 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1538Ref { L"Function PlotManager.BioAutoConditionals.F1538", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1538 )
-		pFnF1538 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1538" );
+	UFunction* const pFnF1538 = pFnF1538Ref.Get ( );
 
 	UBioAutoConditionals_execF1538_Parms F1538_Parms;
 	F1538_Parms.bioWorld = bioWorld;
@@ -8810,10 +8426,9 @@ bool UBioAutoConditionals::F1538 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F897 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF897 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF897Ref { L"Function PlotManager.BioAutoConditionals.F897", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF897 )
-		pFnF897 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F897" );
+	UFunction* const pFnF897 = pFnF897Ref.Get ( );
 
 	UBioAutoConditionals_execF897_Parms F897_Parms;
 	F897_Parms.bioWorld = bioWorld;
@@ -8833,10 +8448,9 @@ bool UBioAutoConditionals::F897 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F779 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF779 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF779Ref { L"Function PlotManager.BioAutoConditionals.F779", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF779 )
-		pFnF779 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F779" );
+	UFunction* const pFnF779 = pFnF779Ref.Get ( );
 
 	UBioAutoConditionals_execF779_Parms F779_Parms;
 	F779_Parms.bioWorld = bioWorld;
@@ -8856,10 +8470,9 @@ bool UBioAutoConditionals::F779 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F896 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF896 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF896Ref { L"Function PlotManager.BioAutoConditionals.F896", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF896 )
-		pFnF896 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F896" );
+	UFunction* const pFnF896 = pFnF896Ref.Get ( );
 
 	UBioAutoConditionals_execF896_Parms F896_Parms;
 	F896_Parms.bioWorld = bioWorld;
@@ -8879,10 +8492,9 @@ bool UBioAutoConditionals::F896 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F895 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF895 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF895Ref { L"Function PlotManager.BioAutoConditionals.F895", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF895 )
-		pFnF895 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F895" );
+	UFunction* const pFnF895 = pFnF895Ref.Get ( );
 
 	UBioAutoConditionals_execF895_Parms F895_Parms;
 	F895_Parms.bioWorld = bioWorld;
@@ -8902,10 +8514,9 @@ bool UBioAutoConditionals::F895 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F880 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF880 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF880Ref { L"Function PlotManager.BioAutoConditionals.F880", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF880 )
-		pFnF880 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F880" );
+	UFunction* const pFnF880 = pFnF880Ref.Get ( );
 
 	UBioAutoConditionals_execF880_Parms F880_Parms;
 	F880_Parms.bioWorld = bioWorld;
@@ -8925,10 +8536,9 @@ bool UBioAutoConditionals::F880 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F879 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF879 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF879Ref { L"Function PlotManager.BioAutoConditionals.F879", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF879 )
-		pFnF879 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F879" );
+	UFunction* const pFnF879 = pFnF879Ref.Get ( );
 
 	UBioAutoConditionals_execF879_Parms F879_Parms;
 	F879_Parms.bioWorld = bioWorld;
@@ -8948,10 +8558,9 @@ bool UBioAutoConditionals::F879 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F878 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF878 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF878Ref { L"Function PlotManager.BioAutoConditionals.F878", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF878 )
-		pFnF878 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F878" );
+	UFunction* const pFnF878 = pFnF878Ref.Get ( );
 
 	UBioAutoConditionals_execF878_Parms F878_Parms;
 	F878_Parms.bioWorld = bioWorld;
@@ -8971,10 +8580,9 @@ bool UBioAutoConditionals::F878 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F877 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF877 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF877Ref { L"Function PlotManager.BioAutoConditionals.F877", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF877 )
-		pFnF877 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F877" );
+	UFunction* const pFnF877 = pFnF877Ref.Get ( );
 
 	UBioAutoConditionals_execF877_Parms F877_Parms;
 	F877_Parms.bioWorld = bioWorld;
@@ -8994,10 +8602,9 @@ bool UBioAutoConditionals::F877 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1268 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1268 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1268Ref { L"Function PlotManager.BioAutoConditionals.F1268", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1268 )
-		pFnF1268 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1268" );
+	UFunction* const pFnF1268 = pFnF1268Ref.Get ( );
 
 	UBioAutoConditionals_execF1268_Parms F1268_Parms;
 	F1268_Parms.bioWorld = bioWorld;
@@ -9017,10 +8624,9 @@ bool UBioAutoConditionals::F1268 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1267 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1267 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1267Ref { L"Function PlotManager.BioAutoConditionals.F1267", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1267 )
-		pFnF1267 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1267" );
+	UFunction* const pFnF1267 = pFnF1267Ref.Get ( );
 
 	UBioAutoConditionals_execF1267_Parms F1267_Parms;
 	F1267_Parms.bioWorld = bioWorld;
@@ -9040,10 +8646,9 @@ bool UBioAutoConditionals::F1267 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1266 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1266 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1266Ref { L"Function PlotManager.BioAutoConditionals.F1266", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1266 )
-		pFnF1266 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1266" );
+	UFunction* const pFnF1266 = pFnF1266Ref.Get ( );
 
 	UBioAutoConditionals_execF1266_Parms F1266_Parms;
 	F1266_Parms.bioWorld = bioWorld;
@@ -9063,10 +8668,9 @@ bool UBioAutoConditionals::F1266 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1265 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1265 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1265Ref { L"Function PlotManager.BioAutoConditionals.F1265", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1265 )
-		pFnF1265 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1265" );
+	UFunction* const pFnF1265 = pFnF1265Ref.Get ( );
 
 	UBioAutoConditionals_execF1265_Parms F1265_Parms;
 	F1265_Parms.bioWorld = bioWorld;
@@ -9086,10 +8690,9 @@ bool UBioAutoConditionals::F1265 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1579 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1579 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1579Ref { L"Function PlotManager.BioAutoConditionals.F1579", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1579 )
-		pFnF1579 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1579" );
+	UFunction* const pFnF1579 = pFnF1579Ref.Get ( );
 
 	UBioAutoConditionals_execF1579_Parms F1579_Parms;
 	F1579_Parms.bioWorld = bioWorld;
@@ -9109,10 +8712,9 @@ bool UBioAutoConditionals::F1579 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1551 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1551 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1551Ref { L"Function PlotManager.BioAutoConditionals.F1551", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1551 )
-		pFnF1551 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1551" );
+	UFunction* const pFnF1551 = pFnF1551Ref.Get ( );
 
 	UBioAutoConditionals_execF1551_Parms F1551_Parms;
 	F1551_Parms.bioWorld = bioWorld;
@@ -9132,10 +8734,9 @@ bool UBioAutoConditionals::F1551 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1550 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1550 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1550Ref { L"Function PlotManager.BioAutoConditionals.F1550", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1550 )
-		pFnF1550 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1550" );
+	UFunction* const pFnF1550 = pFnF1550Ref.Get ( );
 
 	UBioAutoConditionals_execF1550_Parms F1550_Parms;
 	F1550_Parms.bioWorld = bioWorld;
@@ -9155,10 +8756,9 @@ bool UBioAutoConditionals::F1550 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1549 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1549 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1549Ref { L"Function PlotManager.BioAutoConditionals.F1549", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1549 )
-		pFnF1549 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1549" );
+	UFunction* const pFnF1549 = pFnF1549Ref.Get ( );
 
 	UBioAutoConditionals_execF1549_Parms F1549_Parms;
 	F1549_Parms.bioWorld = bioWorld;
@@ -9178,10 +8778,9 @@ bool UBioAutoConditionals::F1549 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1548 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1548 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1548Ref { L"Function PlotManager.BioAutoConditionals.F1548", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1548 )
-		pFnF1548 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1548" );
+	UFunction* const pFnF1548 = pFnF1548Ref.Get ( );
 
 	UBioAutoConditionals_execF1548_Parms F1548_Parms;
 	F1548_Parms.bioWorld = bioWorld;
@@ -9201,10 +8800,9 @@ bool UBioAutoConditionals::F1548 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1547 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1547 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1547Ref { L"Function PlotManager.BioAutoConditionals.F1547", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1547 )
-		pFnF1547 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1547" );
+	UFunction* const pFnF1547 = pFnF1547Ref.Get ( );
 
 	UBioAutoConditionals_execF1547_Parms F1547_Parms;
 	F1547_Parms.bioWorld = bioWorld;
@@ -9224,10 +8822,9 @@ bool UBioAutoConditionals::F1547 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1546 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1546 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1546Ref { L"Function PlotManager.BioAutoConditionals.F1546", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1546 )
-		pFnF1546 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1546" );
+	UFunction* const pFnF1546 = pFnF1546Ref.Get ( );
 
 	UBioAutoConditionals_execF1546_Parms F1546_Parms;
 	F1546_Parms.bioWorld = bioWorld;
@@ -9247,10 +8844,9 @@ bool UBioAutoConditionals::F1546 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F650 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF650 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF650Ref { L"Function PlotManager.BioAutoConditionals.F650", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF650 )
-		pFnF650 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F650" );
+	UFunction* const pFnF650 = pFnF650Ref.Get ( );
 
 	UBioAutoConditionals_execF650_Parms F650_Parms;
 	F650_Parms.bioWorld = bioWorld;
@@ -9270,10 +8866,9 @@ bool UBioAutoConditionals::F650 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F632 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF632 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF632Ref { L"Function PlotManager.BioAutoConditionals.F632", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF632 )
-		pFnF632 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F632" );
+	UFunction* const pFnF632 = pFnF632Ref.Get ( );
 
 	UBioAutoConditionals_execF632_Parms F632_Parms;
 	F632_Parms.bioWorld = bioWorld;
@@ -9293,10 +8888,9 @@ bool UBioAutoConditionals::F632 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F630 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF630 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF630Ref { L"Function PlotManager.BioAutoConditionals.F630", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF630 )
-		pFnF630 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F630" );
+	UFunction* const pFnF630 = pFnF630Ref.Get ( );
 
 	UBioAutoConditionals_execF630_Parms F630_Parms;
 	F630_Parms.bioWorld = bioWorld;
@@ -9316,10 +8910,9 @@ bool UBioAutoConditionals::F630 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F629 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF629 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF629Ref { L"Function PlotManager.BioAutoConditionals.F629", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF629 )
-		pFnF629 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F629" );
+	UFunction* const pFnF629 = pFnF629Ref.Get ( );
 
 	UBioAutoConditionals_execF629_Parms F629_Parms;
 	F629_Parms.bioWorld = bioWorld;
@@ -9339,10 +8932,9 @@ bool UBioAutoConditionals::F629 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1430 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1430 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1430Ref { L"Function PlotManager.BioAutoConditionals.F1430", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1430 )
-		pFnF1430 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1430" );
+	UFunction* const pFnF1430 = pFnF1430Ref.Get ( );
 
 	UBioAutoConditionals_execF1430_Parms F1430_Parms;
 	F1430_Parms.bioWorld = bioWorld;
@@ -9362,10 +8954,9 @@ bool UBioAutoConditionals::F1430 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1429 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1429 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1429Ref { L"Function PlotManager.BioAutoConditionals.F1429", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1429 )
-		pFnF1429 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1429" );
+	UFunction* const pFnF1429 = pFnF1429Ref.Get ( );
 
 	UBioAutoConditionals_execF1429_Parms F1429_Parms;
 	F1429_Parms.bioWorld = bioWorld;
@@ -9385,10 +8976,9 @@ bool UBioAutoConditionals::F1429 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1428 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1428 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1428Ref { L"Function PlotManager.BioAutoConditionals.F1428", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1428 )
-		pFnF1428 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1428" );
+	UFunction* const pFnF1428 = pFnF1428Ref.Get ( );
 
 	UBioAutoConditionals_execF1428_Parms F1428_Parms;
 	F1428_Parms.bioWorld = bioWorld;
@@ -9408,10 +8998,9 @@ bool UBioAutoConditionals::F1428 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1427 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1427 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1427Ref { L"Function PlotManager.BioAutoConditionals.F1427", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1427 )
-		pFnF1427 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1427" );
+	UFunction* const pFnF1427 = pFnF1427Ref.Get ( );
 
 	UBioAutoConditionals_execF1427_Parms F1427_Parms;
 	F1427_Parms.bioWorld = bioWorld;
@@ -9431,10 +9020,9 @@ bool UBioAutoConditionals::F1427 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1426 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1426 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1426Ref { L"Function PlotManager.BioAutoConditionals.F1426", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1426 )
-		pFnF1426 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1426" );
+	UFunction* const pFnF1426 = pFnF1426Ref.Get ( );
 
 	UBioAutoConditionals_execF1426_Parms F1426_Parms;
 	F1426_Parms.bioWorld = bioWorld;
@@ -9454,10 +9042,9 @@ bool UBioAutoConditionals::F1426 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1425 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1425 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1425Ref { L"Function PlotManager.BioAutoConditionals.F1425", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1425 )
-		pFnF1425 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1425" );
+	UFunction* const pFnF1425 = pFnF1425Ref.Get ( );
 
 	UBioAutoConditionals_execF1425_Parms F1425_Parms;
 	F1425_Parms.bioWorld = bioWorld;
@@ -9477,10 +9064,9 @@ bool UBioAutoConditionals::F1425 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1424 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1424 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1424Ref { L"Function PlotManager.BioAutoConditionals.F1424", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1424 )
-		pFnF1424 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1424" );
+	UFunction* const pFnF1424 = pFnF1424Ref.Get ( );
 
 	UBioAutoConditionals_execF1424_Parms F1424_Parms;
 	F1424_Parms.bioWorld = bioWorld;
@@ -9500,10 +9086,9 @@ bool UBioAutoConditionals::F1424 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1423 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1423 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1423Ref { L"Function PlotManager.BioAutoConditionals.F1423", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1423 )
-		pFnF1423 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1423" );
+	UFunction* const pFnF1423 = pFnF1423Ref.Get ( );
 
 	UBioAutoConditionals_execF1423_Parms F1423_Parms;
 	F1423_Parms.bioWorld = bioWorld;
@@ -9523,10 +9108,9 @@ bool UBioAutoConditionals::F1423 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1422 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1422 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1422Ref { L"Function PlotManager.BioAutoConditionals.F1422", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1422 )
-		pFnF1422 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1422" );
+	UFunction* const pFnF1422 = pFnF1422Ref.Get ( );
 
 	UBioAutoConditionals_execF1422_Parms F1422_Parms;
 	F1422_Parms.bioWorld = bioWorld;
@@ -9546,10 +9130,9 @@ bool UBioAutoConditionals::F1422 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1421 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1421 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1421Ref { L"Function PlotManager.BioAutoConditionals.F1421", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1421 )
-		pFnF1421 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1421" );
+	UFunction* const pFnF1421 = pFnF1421Ref.Get ( );
 
 	UBioAutoConditionals_execF1421_Parms F1421_Parms;
 	F1421_Parms.bioWorld = bioWorld;
@@ -9569,10 +9152,9 @@ bool UBioAutoConditionals::F1421 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1420 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1420 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1420Ref { L"Function PlotManager.BioAutoConditionals.F1420", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1420 )
-		pFnF1420 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1420" );
+	UFunction* const pFnF1420 = pFnF1420Ref.Get ( );
 
 	UBioAutoConditionals_execF1420_Parms F1420_Parms;
 	F1420_Parms.bioWorld = bioWorld;
@@ -9592,10 +9174,9 @@ bool UBioAutoConditionals::F1420 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1419 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1419 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1419Ref { L"Function PlotManager.BioAutoConditionals.F1419", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1419 )
-		pFnF1419 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1419" );
+	UFunction* const pFnF1419 = pFnF1419Ref.Get ( );
 
 	UBioAutoConditionals_execF1419_Parms F1419_Parms;
 	F1419_Parms.bioWorld = bioWorld;
@@ -9615,10 +9196,9 @@ bool UBioAutoConditionals::F1419 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F955 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF955 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF955Ref { L"Function PlotManager.BioAutoConditionals.F955", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF955 )
-		pFnF955 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F955" );
+	UFunction* const pFnF955 = pFnF955Ref.Get ( );
 
 	UBioAutoConditionals_execF955_Parms F955_Parms;
 	F955_Parms.bioWorld = bioWorld;
@@ -9638,10 +9218,9 @@ bool UBioAutoConditionals::F955 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1232 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1232 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1232Ref { L"Function PlotManager.BioAutoConditionals.F1232", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1232 )
-		pFnF1232 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1232" );
+	UFunction* const pFnF1232 = pFnF1232Ref.Get ( );
 
 	UBioAutoConditionals_execF1232_Parms F1232_Parms;
 	F1232_Parms.bioWorld = bioWorld;
@@ -9661,10 +9240,9 @@ bool UBioAutoConditionals::F1232 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1001 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1001 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1001Ref { L"Function PlotManager.BioAutoConditionals.F1001", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1001 )
-		pFnF1001 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1001" );
+	UFunction* const pFnF1001 = pFnF1001Ref.Get ( );
 
 	UBioAutoConditionals_execF1001_Parms F1001_Parms;
 	F1001_Parms.bioWorld = bioWorld;
@@ -9684,10 +9262,9 @@ bool UBioAutoConditionals::F1001 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F905 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF905 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF905Ref { L"Function PlotManager.BioAutoConditionals.F905", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF905 )
-		pFnF905 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F905" );
+	UFunction* const pFnF905 = pFnF905Ref.Get ( );
 
 	UBioAutoConditionals_execF905_Parms F905_Parms;
 	F905_Parms.bioWorld = bioWorld;
@@ -9707,10 +9284,9 @@ bool UBioAutoConditionals::F905 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F731 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF731 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF731Ref { L"Function PlotManager.BioAutoConditionals.F731", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF731 )
-		pFnF731 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F731" );
+	UFunction* const pFnF731 = pFnF731Ref.Get ( );
 
 	UBioAutoConditionals_execF731_Parms F731_Parms;
 	F731_Parms.bioWorld = bioWorld;
@@ -9730,10 +9306,9 @@ bool UBioAutoConditionals::F731 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F640 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF640 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF640Ref { L"Function PlotManager.BioAutoConditionals.F640", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF640 )
-		pFnF640 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F640" );
+	UFunction* const pFnF640 = pFnF640Ref.Get ( );
 
 	UBioAutoConditionals_execF640_Parms F640_Parms;
 	F640_Parms.bioWorld = bioWorld;
@@ -9753,10 +9328,9 @@ bool UBioAutoConditionals::F640 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F639 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF639 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF639Ref { L"Function PlotManager.BioAutoConditionals.F639", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF639 )
-		pFnF639 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F639" );
+	UFunction* const pFnF639 = pFnF639Ref.Get ( );
 
 	UBioAutoConditionals_execF639_Parms F639_Parms;
 	F639_Parms.bioWorld = bioWorld;
@@ -9776,10 +9350,9 @@ bool UBioAutoConditionals::F639 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F638 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF638 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF638Ref { L"Function PlotManager.BioAutoConditionals.F638", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF638 )
-		pFnF638 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F638" );
+	UFunction* const pFnF638 = pFnF638Ref.Get ( );
 
 	UBioAutoConditionals_execF638_Parms F638_Parms;
 	F638_Parms.bioWorld = bioWorld;
@@ -9799,10 +9372,9 @@ bool UBioAutoConditionals::F638 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F637 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF637 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF637Ref { L"Function PlotManager.BioAutoConditionals.F637", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF637 )
-		pFnF637 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F637" );
+	UFunction* const pFnF637 = pFnF637Ref.Get ( );
 
 	UBioAutoConditionals_execF637_Parms F637_Parms;
 	F637_Parms.bioWorld = bioWorld;
@@ -9822,10 +9394,9 @@ bool UBioAutoConditionals::F637 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F636 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF636 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF636Ref { L"Function PlotManager.BioAutoConditionals.F636", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF636 )
-		pFnF636 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F636" );
+	UFunction* const pFnF636 = pFnF636Ref.Get ( );
 
 	UBioAutoConditionals_execF636_Parms F636_Parms;
 	F636_Parms.bioWorld = bioWorld;
@@ -9845,10 +9416,9 @@ bool UBioAutoConditionals::F636 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F635 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF635 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF635Ref { L"Function PlotManager.BioAutoConditionals.F635", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF635 )
-		pFnF635 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F635" );
+	UFunction* const pFnF635 = pFnF635Ref.Get ( );
 
 	UBioAutoConditionals_execF635_Parms F635_Parms;
 	F635_Parms.bioWorld = bioWorld;
@@ -9868,10 +9438,9 @@ bool UBioAutoConditionals::F635 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F634 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF634 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF634Ref { L"Function PlotManager.BioAutoConditionals.F634", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF634 )
-		pFnF634 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F634" );
+	UFunction* const pFnF634 = pFnF634Ref.Get ( );
 
 	UBioAutoConditionals_execF634_Parms F634_Parms;
 	F634_Parms.bioWorld = bioWorld;
@@ -9891,10 +9460,9 @@ bool UBioAutoConditionals::F634 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F633 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF633 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF633Ref { L"Function PlotManager.BioAutoConditionals.F633", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF633 )
-		pFnF633 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F633" );
+	UFunction* const pFnF633 = pFnF633Ref.Get ( );
 
 	UBioAutoConditionals_execF633_Parms F633_Parms;
 	F633_Parms.bioWorld = bioWorld;
@@ -9914,10 +9482,9 @@ bool UBioAutoConditionals::F633 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F625 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF625 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF625Ref { L"Function PlotManager.BioAutoConditionals.F625", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF625 )
-		pFnF625 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F625" );
+	UFunction* const pFnF625 = pFnF625Ref.Get ( );
 
 	UBioAutoConditionals_execF625_Parms F625_Parms;
 	F625_Parms.bioWorld = bioWorld;
@@ -9937,10 +9504,9 @@ bool UBioAutoConditionals::F625 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F624 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF624 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF624Ref { L"Function PlotManager.BioAutoConditionals.F624", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF624 )
-		pFnF624 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F624" );
+	UFunction* const pFnF624 = pFnF624Ref.Get ( );
 
 	UBioAutoConditionals_execF624_Parms F624_Parms;
 	F624_Parms.bioWorld = bioWorld;
@@ -9960,10 +9526,9 @@ bool UBioAutoConditionals::F624 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1239 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1239 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1239Ref { L"Function PlotManager.BioAutoConditionals.F1239", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1239 )
-		pFnF1239 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1239" );
+	UFunction* const pFnF1239 = pFnF1239Ref.Get ( );
 
 	UBioAutoConditionals_execF1239_Parms F1239_Parms;
 	F1239_Parms.bioWorld = bioWorld;
@@ -9983,10 +9548,9 @@ bool UBioAutoConditionals::F1239 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1238 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1238 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1238Ref { L"Function PlotManager.BioAutoConditionals.F1238", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1238 )
-		pFnF1238 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1238" );
+	UFunction* const pFnF1238 = pFnF1238Ref.Get ( );
 
 	UBioAutoConditionals_execF1238_Parms F1238_Parms;
 	F1238_Parms.bioWorld = bioWorld;
@@ -10006,10 +9570,9 @@ bool UBioAutoConditionals::F1238 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F925 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF925 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF925Ref { L"Function PlotManager.BioAutoConditionals.F925", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF925 )
-		pFnF925 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F925" );
+	UFunction* const pFnF925 = pFnF925Ref.Get ( );
 
 	UBioAutoConditionals_execF925_Parms F925_Parms;
 	F925_Parms.bioWorld = bioWorld;
@@ -10029,10 +9592,9 @@ bool UBioAutoConditionals::F925 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1358 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1358 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1358Ref { L"Function PlotManager.BioAutoConditionals.F1358", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1358 )
-		pFnF1358 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1358" );
+	UFunction* const pFnF1358 = pFnF1358Ref.Get ( );
 
 	UBioAutoConditionals_execF1358_Parms F1358_Parms;
 	F1358_Parms.bioWorld = bioWorld;
@@ -10052,10 +9614,9 @@ bool UBioAutoConditionals::F1358 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1244 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1244 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1244Ref { L"Function PlotManager.BioAutoConditionals.F1244", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1244 )
-		pFnF1244 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1244" );
+	UFunction* const pFnF1244 = pFnF1244Ref.Get ( );
 
 	UBioAutoConditionals_execF1244_Parms F1244_Parms;
 	F1244_Parms.bioWorld = bioWorld;
@@ -10075,10 +9636,9 @@ bool UBioAutoConditionals::F1244 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F733 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF733 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF733Ref { L"Function PlotManager.BioAutoConditionals.F733", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF733 )
-		pFnF733 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F733" );
+	UFunction* const pFnF733 = pFnF733Ref.Get ( );
 
 	UBioAutoConditionals_execF733_Parms F733_Parms;
 	F733_Parms.bioWorld = bioWorld;
@@ -10098,10 +9658,9 @@ bool UBioAutoConditionals::F733 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F652 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF652 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF652Ref { L"Function PlotManager.BioAutoConditionals.F652", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF652 )
-		pFnF652 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F652" );
+	UFunction* const pFnF652 = pFnF652Ref.Get ( );
 
 	UBioAutoConditionals_execF652_Parms F652_Parms;
 	F652_Parms.bioWorld = bioWorld;
@@ -10121,10 +9680,9 @@ bool UBioAutoConditionals::F652 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F651 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF651 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF651Ref { L"Function PlotManager.BioAutoConditionals.F651", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF651 )
-		pFnF651 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F651" );
+	UFunction* const pFnF651 = pFnF651Ref.Get ( );
 
 	UBioAutoConditionals_execF651_Parms F651_Parms;
 	F651_Parms.bioWorld = bioWorld;
@@ -10144,10 +9702,9 @@ bool UBioAutoConditionals::F651 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F631 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF631 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF631Ref { L"Function PlotManager.BioAutoConditionals.F631", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF631 )
-		pFnF631 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F631" );
+	UFunction* const pFnF631 = pFnF631Ref.Get ( );
 
 	UBioAutoConditionals_execF631_Parms F631_Parms;
 	F631_Parms.bioWorld = bioWorld;
@@ -10167,10 +9724,9 @@ bool UBioAutoConditionals::F631 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1357 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1357 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1357Ref { L"Function PlotManager.BioAutoConditionals.F1357", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1357 )
-		pFnF1357 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1357" );
+	UFunction* const pFnF1357 = pFnF1357Ref.Get ( );
 
 	UBioAutoConditionals_execF1357_Parms F1357_Parms;
 	F1357_Parms.bioWorld = bioWorld;
@@ -10190,10 +9746,9 @@ bool UBioAutoConditionals::F1357 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F730 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF730 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF730Ref { L"Function PlotManager.BioAutoConditionals.F730", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF730 )
-		pFnF730 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F730" );
+	UFunction* const pFnF730 = pFnF730Ref.Get ( );
 
 	UBioAutoConditionals_execF730_Parms F730_Parms;
 	F730_Parms.bioWorld = bioWorld;
@@ -10213,10 +9768,9 @@ bool UBioAutoConditionals::F730 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F628 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF628 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF628Ref { L"Function PlotManager.BioAutoConditionals.F628", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF628 )
-		pFnF628 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F628" );
+	UFunction* const pFnF628 = pFnF628Ref.Get ( );
 
 	UBioAutoConditionals_execF628_Parms F628_Parms;
 	F628_Parms.bioWorld = bioWorld;
@@ -10236,10 +9790,9 @@ bool UBioAutoConditionals::F628 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F627 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF627 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF627Ref { L"Function PlotManager.BioAutoConditionals.F627", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF627 )
-		pFnF627 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F627" );
+	UFunction* const pFnF627 = pFnF627Ref.Get ( );
 
 	UBioAutoConditionals_execF627_Parms F627_Parms;
 	F627_Parms.bioWorld = bioWorld;
@@ -10259,10 +9812,9 @@ bool UBioAutoConditionals::F627 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1356 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1356 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1356Ref { L"Function PlotManager.BioAutoConditionals.F1356", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1356 )
-		pFnF1356 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1356" );
+	UFunction* const pFnF1356 = pFnF1356Ref.Get ( );
 
 	UBioAutoConditionals_execF1356_Parms F1356_Parms;
 	F1356_Parms.bioWorld = bioWorld;
@@ -10282,10 +9834,9 @@ bool UBioAutoConditionals::F1356 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1201 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1201 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1201Ref { L"Function PlotManager.BioAutoConditionals.F1201", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1201 )
-		pFnF1201 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1201" );
+	UFunction* const pFnF1201 = pFnF1201Ref.Get ( );
 
 	UBioAutoConditionals_execF1201_Parms F1201_Parms;
 	F1201_Parms.bioWorld = bioWorld;
@@ -10305,10 +9856,9 @@ bool UBioAutoConditionals::F1201 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F626 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF626 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF626Ref { L"Function PlotManager.BioAutoConditionals.F626", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF626 )
-		pFnF626 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F626" );
+	UFunction* const pFnF626 = pFnF626Ref.Get ( );
 
 	UBioAutoConditionals_execF626_Parms F626_Parms;
 	F626_Parms.bioWorld = bioWorld;
@@ -10328,10 +9878,9 @@ bool UBioAutoConditionals::F626 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1210 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1210 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1210Ref { L"Function PlotManager.BioAutoConditionals.F1210", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1210 )
-		pFnF1210 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1210" );
+	UFunction* const pFnF1210 = pFnF1210Ref.Get ( );
 
 	UBioAutoConditionals_execF1210_Parms F1210_Parms;
 	F1210_Parms.bioWorld = bioWorld;
@@ -10351,10 +9900,9 @@ bool UBioAutoConditionals::F1210 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F618 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF618 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF618Ref { L"Function PlotManager.BioAutoConditionals.F618", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF618 )
-		pFnF618 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F618" );
+	UFunction* const pFnF618 = pFnF618Ref.Get ( );
 
 	UBioAutoConditionals_execF618_Parms F618_Parms;
 	F618_Parms.bioWorld = bioWorld;
@@ -10374,10 +9922,9 @@ bool UBioAutoConditionals::F618 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1553 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1553 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1553Ref { L"Function PlotManager.BioAutoConditionals.F1553", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1553 )
-		pFnF1553 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1553" );
+	UFunction* const pFnF1553 = pFnF1553Ref.Get ( );
 
 	UBioAutoConditionals_execF1553_Parms F1553_Parms;
 	F1553_Parms.bioWorld = bioWorld;
@@ -10397,10 +9944,9 @@ bool UBioAutoConditionals::F1553 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1058 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1058 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1058Ref { L"Function PlotManager.BioAutoConditionals.F1058", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1058 )
-		pFnF1058 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1058" );
+	UFunction* const pFnF1058 = pFnF1058Ref.Get ( );
 
 	UBioAutoConditionals_execF1058_Parms F1058_Parms;
 	F1058_Parms.bioWorld = bioWorld;
@@ -10420,10 +9966,9 @@ bool UBioAutoConditionals::F1058 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1057 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1057 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1057Ref { L"Function PlotManager.BioAutoConditionals.F1057", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1057 )
-		pFnF1057 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1057" );
+	UFunction* const pFnF1057 = pFnF1057Ref.Get ( );
 
 	UBioAutoConditionals_execF1057_Parms F1057_Parms;
 	F1057_Parms.bioWorld = bioWorld;
@@ -10443,10 +9988,9 @@ bool UBioAutoConditionals::F1057 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1056 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1056 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1056Ref { L"Function PlotManager.BioAutoConditionals.F1056", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1056 )
-		pFnF1056 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1056" );
+	UFunction* const pFnF1056 = pFnF1056Ref.Get ( );
 
 	UBioAutoConditionals_execF1056_Parms F1056_Parms;
 	F1056_Parms.bioWorld = bioWorld;
@@ -10466,10 +10010,9 @@ bool UBioAutoConditionals::F1056 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1055 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1055 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1055Ref { L"Function PlotManager.BioAutoConditionals.F1055", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1055 )
-		pFnF1055 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1055" );
+	UFunction* const pFnF1055 = pFnF1055Ref.Get ( );
 
 	UBioAutoConditionals_execF1055_Parms F1055_Parms;
 	F1055_Parms.bioWorld = bioWorld;
@@ -10489,10 +10032,9 @@ bool UBioAutoConditionals::F1055 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1054 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1054 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1054Ref { L"Function PlotManager.BioAutoConditionals.F1054", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1054 )
-		pFnF1054 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1054" );
+	UFunction* const pFnF1054 = pFnF1054Ref.Get ( );
 
 	UBioAutoConditionals_execF1054_Parms F1054_Parms;
 	F1054_Parms.bioWorld = bioWorld;
@@ -10512,10 +10054,9 @@ bool UBioAutoConditionals::F1054 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1053 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1053 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1053Ref { L"Function PlotManager.BioAutoConditionals.F1053", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1053 )
-		pFnF1053 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1053" );
+	UFunction* const pFnF1053 = pFnF1053Ref.Get ( );
 
 	UBioAutoConditionals_execF1053_Parms F1053_Parms;
 	F1053_Parms.bioWorld = bioWorld;
@@ -10535,10 +10076,9 @@ bool UBioAutoConditionals::F1053 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1052 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1052 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1052Ref { L"Function PlotManager.BioAutoConditionals.F1052", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1052 )
-		pFnF1052 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1052" );
+	UFunction* const pFnF1052 = pFnF1052Ref.Get ( );
 
 	UBioAutoConditionals_execF1052_Parms F1052_Parms;
 	F1052_Parms.bioWorld = bioWorld;
@@ -10558,10 +10098,9 @@ bool UBioAutoConditionals::F1052 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1051 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1051 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1051Ref { L"Function PlotManager.BioAutoConditionals.F1051", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1051 )
-		pFnF1051 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1051" );
+	UFunction* const pFnF1051 = pFnF1051Ref.Get ( );
 
 	UBioAutoConditionals_execF1051_Parms F1051_Parms;
 	F1051_Parms.bioWorld = bioWorld;
@@ -10581,10 +10120,9 @@ bool UBioAutoConditionals::F1051 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1050 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1050 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1050Ref { L"Function PlotManager.BioAutoConditionals.F1050", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1050 )
-		pFnF1050 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1050" );
+	UFunction* const pFnF1050 = pFnF1050Ref.Get ( );
 
 	UBioAutoConditionals_execF1050_Parms F1050_Parms;
 	F1050_Parms.bioWorld = bioWorld;
@@ -10604,10 +10142,9 @@ bool UBioAutoConditionals::F1050 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1049 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1049 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1049Ref { L"Function PlotManager.BioAutoConditionals.F1049", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1049 )
-		pFnF1049 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1049" );
+	UFunction* const pFnF1049 = pFnF1049Ref.Get ( );
 
 	UBioAutoConditionals_execF1049_Parms F1049_Parms;
 	F1049_Parms.bioWorld = bioWorld;
@@ -10627,10 +10164,9 @@ bool UBioAutoConditionals::F1049 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1048 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1048 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1048Ref { L"Function PlotManager.BioAutoConditionals.F1048", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1048 )
-		pFnF1048 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1048" );
+	UFunction* const pFnF1048 = pFnF1048Ref.Get ( );
 
 	UBioAutoConditionals_execF1048_Parms F1048_Parms;
 	F1048_Parms.bioWorld = bioWorld;
@@ -10650,10 +10186,9 @@ bool UBioAutoConditionals::F1048 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1047 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1047 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1047Ref { L"Function PlotManager.BioAutoConditionals.F1047", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1047 )
-		pFnF1047 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1047" );
+	UFunction* const pFnF1047 = pFnF1047Ref.Get ( );
 
 	UBioAutoConditionals_execF1047_Parms F1047_Parms;
 	F1047_Parms.bioWorld = bioWorld;
@@ -10673,10 +10208,9 @@ bool UBioAutoConditionals::F1047 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1046 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1046 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1046Ref { L"Function PlotManager.BioAutoConditionals.F1046", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1046 )
-		pFnF1046 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1046" );
+	UFunction* const pFnF1046 = pFnF1046Ref.Get ( );
 
 	UBioAutoConditionals_execF1046_Parms F1046_Parms;
 	F1046_Parms.bioWorld = bioWorld;
@@ -10696,10 +10230,9 @@ bool UBioAutoConditionals::F1046 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1039 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1039 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1039Ref { L"Function PlotManager.BioAutoConditionals.F1039", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1039 )
-		pFnF1039 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1039" );
+	UFunction* const pFnF1039 = pFnF1039Ref.Get ( );
 
 	UBioAutoConditionals_execF1039_Parms F1039_Parms;
 	F1039_Parms.bioWorld = bioWorld;
@@ -10719,10 +10252,9 @@ bool UBioAutoConditionals::F1039 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1037 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1037 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1037Ref { L"Function PlotManager.BioAutoConditionals.F1037", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1037 )
-		pFnF1037 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1037" );
+	UFunction* const pFnF1037 = pFnF1037Ref.Get ( );
 
 	UBioAutoConditionals_execF1037_Parms F1037_Parms;
 	F1037_Parms.bioWorld = bioWorld;
@@ -10742,10 +10274,9 @@ bool UBioAutoConditionals::F1037 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1036 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1036 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1036Ref { L"Function PlotManager.BioAutoConditionals.F1036", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1036 )
-		pFnF1036 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1036" );
+	UFunction* const pFnF1036 = pFnF1036Ref.Get ( );
 
 	UBioAutoConditionals_execF1036_Parms F1036_Parms;
 	F1036_Parms.bioWorld = bioWorld;
@@ -10765,10 +10296,9 @@ bool UBioAutoConditionals::F1036 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1034 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1034 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1034Ref { L"Function PlotManager.BioAutoConditionals.F1034", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1034 )
-		pFnF1034 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1034" );
+	UFunction* const pFnF1034 = pFnF1034Ref.Get ( );
 
 	UBioAutoConditionals_execF1034_Parms F1034_Parms;
 	F1034_Parms.bioWorld = bioWorld;
@@ -10788,10 +10318,9 @@ bool UBioAutoConditionals::F1034 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1033 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1033 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1033Ref { L"Function PlotManager.BioAutoConditionals.F1033", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1033 )
-		pFnF1033 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1033" );
+	UFunction* const pFnF1033 = pFnF1033Ref.Get ( );
 
 	UBioAutoConditionals_execF1033_Parms F1033_Parms;
 	F1033_Parms.bioWorld = bioWorld;
@@ -10811,10 +10340,9 @@ bool UBioAutoConditionals::F1033 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F939 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF939 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF939Ref { L"Function PlotManager.BioAutoConditionals.F939", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF939 )
-		pFnF939 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F939" );
+	UFunction* const pFnF939 = pFnF939Ref.Get ( );
 
 	UBioAutoConditionals_execF939_Parms F939_Parms;
 	F939_Parms.bioWorld = bioWorld;
@@ -10834,10 +10362,9 @@ bool UBioAutoConditionals::F939 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F921 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF921 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF921Ref { L"Function PlotManager.BioAutoConditionals.F921", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF921 )
-		pFnF921 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F921" );
+	UFunction* const pFnF921 = pFnF921Ref.Get ( );
 
 	UBioAutoConditionals_execF921_Parms F921_Parms;
 	F921_Parms.bioWorld = bioWorld;
@@ -10857,10 +10384,9 @@ bool UBioAutoConditionals::F921 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F940 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF940 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF940Ref { L"Function PlotManager.BioAutoConditionals.F940", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF940 )
-		pFnF940 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F940" );
+	UFunction* const pFnF940 = pFnF940Ref.Get ( );
 
 	UBioAutoConditionals_execF940_Parms F940_Parms;
 	F940_Parms.bioWorld = bioWorld;
@@ -10880,10 +10406,9 @@ bool UBioAutoConditionals::F940 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F922 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF922 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF922Ref { L"Function PlotManager.BioAutoConditionals.F922", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF922 )
-		pFnF922 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F922" );
+	UFunction* const pFnF922 = pFnF922Ref.Get ( );
 
 	UBioAutoConditionals_execF922_Parms F922_Parms;
 	F922_Parms.bioWorld = bioWorld;
@@ -10903,10 +10428,9 @@ bool UBioAutoConditionals::F922 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F911 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF911 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF911Ref { L"Function PlotManager.BioAutoConditionals.F911", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF911 )
-		pFnF911 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F911" );
+	UFunction* const pFnF911 = pFnF911Ref.Get ( );
 
 	UBioAutoConditionals_execF911_Parms F911_Parms;
 	F911_Parms.bioWorld = bioWorld;
@@ -10926,10 +10450,9 @@ bool UBioAutoConditionals::F911 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F910 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF910 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF910Ref { L"Function PlotManager.BioAutoConditionals.F910", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF910 )
-		pFnF910 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F910" );
+	UFunction* const pFnF910 = pFnF910Ref.Get ( );
 
 	UBioAutoConditionals_execF910_Parms F910_Parms;
 	F910_Parms.bioWorld = bioWorld;
@@ -10949,10 +10472,9 @@ bool UBioAutoConditionals::F910 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1007 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1007 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1007Ref { L"Function PlotManager.BioAutoConditionals.F1007", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1007 )
-		pFnF1007 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1007" );
+	UFunction* const pFnF1007 = pFnF1007Ref.Get ( );
 
 	UBioAutoConditionals_execF1007_Parms F1007_Parms;
 	F1007_Parms.bioWorld = bioWorld;
@@ -10972,10 +10494,9 @@ bool UBioAutoConditionals::F1007 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F915 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF915 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF915Ref { L"Function PlotManager.BioAutoConditionals.F915", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF915 )
-		pFnF915 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F915" );
+	UFunction* const pFnF915 = pFnF915Ref.Get ( );
 
 	UBioAutoConditionals_execF915_Parms F915_Parms;
 	F915_Parms.bioWorld = bioWorld;
@@ -10995,10 +10516,9 @@ bool UBioAutoConditionals::F915 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F908 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF908 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF908Ref { L"Function PlotManager.BioAutoConditionals.F908", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF908 )
-		pFnF908 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F908" );
+	UFunction* const pFnF908 = pFnF908Ref.Get ( );
 
 	UBioAutoConditionals_execF908_Parms F908_Parms;
 	F908_Parms.bioWorld = bioWorld;
@@ -11018,10 +10538,9 @@ bool UBioAutoConditionals::F908 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F907 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF907 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF907Ref { L"Function PlotManager.BioAutoConditionals.F907", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF907 )
-		pFnF907 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F907" );
+	UFunction* const pFnF907 = pFnF907Ref.Get ( );
 
 	UBioAutoConditionals_execF907_Parms F907_Parms;
 	F907_Parms.bioWorld = bioWorld;
@@ -11041,10 +10560,9 @@ bool UBioAutoConditionals::F907 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F906 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF906 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF906Ref { L"Function PlotManager.BioAutoConditionals.F906", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF906 )
-		pFnF906 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F906" );
+	UFunction* const pFnF906 = pFnF906Ref.Get ( );
 
 	UBioAutoConditionals_execF906_Parms F906_Parms;
 	F906_Parms.bioWorld = bioWorld;
@@ -11064,10 +10582,9 @@ bool UBioAutoConditionals::F906 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F904 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF904 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF904Ref { L"Function PlotManager.BioAutoConditionals.F904", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF904 )
-		pFnF904 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F904" );
+	UFunction* const pFnF904 = pFnF904Ref.Get ( );
 
 	UBioAutoConditionals_execF904_Parms F904_Parms;
 	F904_Parms.bioWorld = bioWorld;
@@ -11087,10 +10604,9 @@ bool UBioAutoConditionals::F904 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F984 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF984 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF984Ref { L"Function PlotManager.BioAutoConditionals.F984", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF984 )
-		pFnF984 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F984" );
+	UFunction* const pFnF984 = pFnF984Ref.Get ( );
 
 	UBioAutoConditionals_execF984_Parms F984_Parms;
 	F984_Parms.bioWorld = bioWorld;
@@ -11110,10 +10626,9 @@ bool UBioAutoConditionals::F984 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F937 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF937 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF937Ref { L"Function PlotManager.BioAutoConditionals.F937", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF937 )
-		pFnF937 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F937" );
+	UFunction* const pFnF937 = pFnF937Ref.Get ( );
 
 	UBioAutoConditionals_execF937_Parms F937_Parms;
 	F937_Parms.bioWorld = bioWorld;
@@ -11133,10 +10648,9 @@ bool UBioAutoConditionals::F937 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F903 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF903 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF903Ref { L"Function PlotManager.BioAutoConditionals.F903", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF903 )
-		pFnF903 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F903" );
+	UFunction* const pFnF903 = pFnF903Ref.Get ( );
 
 	UBioAutoConditionals_execF903_Parms F903_Parms;
 	F903_Parms.bioWorld = bioWorld;
@@ -11156,10 +10670,9 @@ bool UBioAutoConditionals::F903 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1576 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1576 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1576Ref { L"Function PlotManager.BioAutoConditionals.F1576", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1576 )
-		pFnF1576 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1576" );
+	UFunction* const pFnF1576 = pFnF1576Ref.Get ( );
 
 	UBioAutoConditionals_execF1576_Parms F1576_Parms;
 	F1576_Parms.bioWorld = bioWorld;
@@ -11179,10 +10692,9 @@ bool UBioAutoConditionals::F1576 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1545 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1545 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1545Ref { L"Function PlotManager.BioAutoConditionals.F1545", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1545 )
-		pFnF1545 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1545" );
+	UFunction* const pFnF1545 = pFnF1545Ref.Get ( );
 
 	UBioAutoConditionals_execF1545_Parms F1545_Parms;
 	F1545_Parms.bioWorld = bioWorld;
@@ -11202,10 +10714,9 @@ bool UBioAutoConditionals::F1545 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1544 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1544 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1544Ref { L"Function PlotManager.BioAutoConditionals.F1544", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1544 )
-		pFnF1544 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1544" );
+	UFunction* const pFnF1544 = pFnF1544Ref.Get ( );
 
 	UBioAutoConditionals_execF1544_Parms F1544_Parms;
 	F1544_Parms.bioWorld = bioWorld;
@@ -11225,10 +10736,9 @@ bool UBioAutoConditionals::F1544 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1543 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1543 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1543Ref { L"Function PlotManager.BioAutoConditionals.F1543", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1543 )
-		pFnF1543 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1543" );
+	UFunction* const pFnF1543 = pFnF1543Ref.Get ( );
 
 	UBioAutoConditionals_execF1543_Parms F1543_Parms;
 	F1543_Parms.bioWorld = bioWorld;
@@ -11248,10 +10758,9 @@ bool UBioAutoConditionals::F1543 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F934 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF934 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF934Ref { L"Function PlotManager.BioAutoConditionals.F934", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF934 )
-		pFnF934 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F934" );
+	UFunction* const pFnF934 = pFnF934Ref.Get ( );
 
 	UBioAutoConditionals_execF934_Parms F934_Parms;
 	F934_Parms.bioWorld = bioWorld;
@@ -11271,10 +10780,9 @@ bool UBioAutoConditionals::F934 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F791 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF791 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF791Ref { L"Function PlotManager.BioAutoConditionals.F791", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF791 )
-		pFnF791 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F791" );
+	UFunction* const pFnF791 = pFnF791Ref.Get ( );
 
 	UBioAutoConditionals_execF791_Parms F791_Parms;
 	F791_Parms.bioWorld = bioWorld;
@@ -11294,10 +10802,9 @@ bool UBioAutoConditionals::F791 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F790 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF790 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF790Ref { L"Function PlotManager.BioAutoConditionals.F790", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF790 )
-		pFnF790 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F790" );
+	UFunction* const pFnF790 = pFnF790Ref.Get ( );
 
 	UBioAutoConditionals_execF790_Parms F790_Parms;
 	F790_Parms.bioWorld = bioWorld;
@@ -11317,10 +10824,9 @@ bool UBioAutoConditionals::F790 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F789 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF789 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF789Ref { L"Function PlotManager.BioAutoConditionals.F789", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF789 )
-		pFnF789 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F789" );
+	UFunction* const pFnF789 = pFnF789Ref.Get ( );
 
 	UBioAutoConditionals_execF789_Parms F789_Parms;
 	F789_Parms.bioWorld = bioWorld;
@@ -11340,10 +10846,9 @@ bool UBioAutoConditionals::F789 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1006 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1006 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1006Ref { L"Function PlotManager.BioAutoConditionals.F1006", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1006 )
-		pFnF1006 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1006" );
+	UFunction* const pFnF1006 = pFnF1006Ref.Get ( );
 
 	UBioAutoConditionals_execF1006_Parms F1006_Parms;
 	F1006_Parms.bioWorld = bioWorld;
@@ -11363,10 +10868,9 @@ bool UBioAutoConditionals::F1006 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1011 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1011 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1011Ref { L"Function PlotManager.BioAutoConditionals.F1011", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1011 )
-		pFnF1011 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1011" );
+	UFunction* const pFnF1011 = pFnF1011Ref.Get ( );
 
 	UBioAutoConditionals_execF1011_Parms F1011_Parms;
 	F1011_Parms.bioWorld = bioWorld;
@@ -11386,10 +10890,9 @@ bool UBioAutoConditionals::F1011 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1010 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1010 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1010Ref { L"Function PlotManager.BioAutoConditionals.F1010", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1010 )
-		pFnF1010 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1010" );
+	UFunction* const pFnF1010 = pFnF1010Ref.Get ( );
 
 	UBioAutoConditionals_execF1010_Parms F1010_Parms;
 	F1010_Parms.bioWorld = bioWorld;
@@ -11409,10 +10912,9 @@ bool UBioAutoConditionals::F1010 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1009 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1009 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1009Ref { L"Function PlotManager.BioAutoConditionals.F1009", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1009 )
-		pFnF1009 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1009" );
+	UFunction* const pFnF1009 = pFnF1009Ref.Get ( );
 
 	UBioAutoConditionals_execF1009_Parms F1009_Parms;
 	F1009_Parms.bioWorld = bioWorld;
@@ -11432,10 +10934,9 @@ bool UBioAutoConditionals::F1009 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1008 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1008 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1008Ref { L"Function PlotManager.BioAutoConditionals.F1008", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1008 )
-		pFnF1008 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1008" );
+	UFunction* const pFnF1008 = pFnF1008Ref.Get ( );
 
 	UBioAutoConditionals_execF1008_Parms F1008_Parms;
 	F1008_Parms.bioWorld = bioWorld;
@@ -11455,10 +10956,9 @@ bool UBioAutoConditionals::F1008 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F933 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF933 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF933Ref { L"Function PlotManager.BioAutoConditionals.F933", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF933 )
-		pFnF933 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F933" );
+	UFunction* const pFnF933 = pFnF933Ref.Get ( );
 
 	UBioAutoConditionals_execF933_Parms F933_Parms;
 	F933_Parms.bioWorld = bioWorld;
@@ -11478,10 +10978,9 @@ bool UBioAutoConditionals::F933 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F928 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF928 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF928Ref { L"Function PlotManager.BioAutoConditionals.F928", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF928 )
-		pFnF928 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F928" );
+	UFunction* const pFnF928 = pFnF928Ref.Get ( );
 
 	UBioAutoConditionals_execF928_Parms F928_Parms;
 	F928_Parms.bioWorld = bioWorld;
@@ -11501,10 +11000,9 @@ bool UBioAutoConditionals::F928 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1077 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1077 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1077Ref { L"Function PlotManager.BioAutoConditionals.F1077", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1077 )
-		pFnF1077 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1077" );
+	UFunction* const pFnF1077 = pFnF1077Ref.Get ( );
 
 	UBioAutoConditionals_execF1077_Parms F1077_Parms;
 	F1077_Parms.bioWorld = bioWorld;
@@ -11524,10 +11022,9 @@ bool UBioAutoConditionals::F1077 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1076 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1076 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1076Ref { L"Function PlotManager.BioAutoConditionals.F1076", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1076 )
-		pFnF1076 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1076" );
+	UFunction* const pFnF1076 = pFnF1076Ref.Get ( );
 
 	UBioAutoConditionals_execF1076_Parms F1076_Parms;
 	F1076_Parms.bioWorld = bioWorld;
@@ -11547,10 +11044,9 @@ bool UBioAutoConditionals::F1076 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F936 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF936 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF936Ref { L"Function PlotManager.BioAutoConditionals.F936", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF936 )
-		pFnF936 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F936" );
+	UFunction* const pFnF936 = pFnF936Ref.Get ( );
 
 	UBioAutoConditionals_execF936_Parms F936_Parms;
 	F936_Parms.bioWorld = bioWorld;
@@ -11570,10 +11066,9 @@ bool UBioAutoConditionals::F936 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F935 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF935 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF935Ref { L"Function PlotManager.BioAutoConditionals.F935", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF935 )
-		pFnF935 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F935" );
+	UFunction* const pFnF935 = pFnF935Ref.Get ( );
 
 	UBioAutoConditionals_execF935_Parms F935_Parms;
 	F935_Parms.bioWorld = bioWorld;
@@ -11593,10 +11088,9 @@ bool UBioAutoConditionals::F935 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F849 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF849 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF849Ref { L"Function PlotManager.BioAutoConditionals.F849", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF849 )
-		pFnF849 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F849" );
+	UFunction* const pFnF849 = pFnF849Ref.Get ( );
 
 	UBioAutoConditionals_execF849_Parms F849_Parms;
 	F849_Parms.bioWorld = bioWorld;
@@ -11616,10 +11110,9 @@ bool UBioAutoConditionals::F849 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F371 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF371 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF371Ref { L"Function PlotManager.BioAutoConditionals.F371", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF371 )
-		pFnF371 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F371" );
+	UFunction* const pFnF371 = pFnF371Ref.Get ( );
 
 	UBioAutoConditionals_execF371_Parms F371_Parms;
 	F371_Parms.bioWorld = bioWorld;
@@ -11639,10 +11132,9 @@ bool UBioAutoConditionals::F371 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F346 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF346 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF346Ref { L"Function PlotManager.BioAutoConditionals.F346", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF346 )
-		pFnF346 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F346" );
+	UFunction* const pFnF346 = pFnF346Ref.Get ( );
 
 	UBioAutoConditionals_execF346_Parms F346_Parms;
 	F346_Parms.bioWorld = bioWorld;
@@ -11662,10 +11154,9 @@ bool UBioAutoConditionals::F346 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1542 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1542 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1542Ref { L"Function PlotManager.BioAutoConditionals.F1542", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1542 )
-		pFnF1542 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1542" );
+	UFunction* const pFnF1542 = pFnF1542Ref.Get ( );
 
 	UBioAutoConditionals_execF1542_Parms F1542_Parms;
 	F1542_Parms.bioWorld = bioWorld;
@@ -11685,10 +11176,9 @@ bool UBioAutoConditionals::F1542 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1541 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1541 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1541Ref { L"Function PlotManager.BioAutoConditionals.F1541", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1541 )
-		pFnF1541 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1541" );
+	UFunction* const pFnF1541 = pFnF1541Ref.Get ( );
 
 	UBioAutoConditionals_execF1541_Parms F1541_Parms;
 	F1541_Parms.bioWorld = bioWorld;
@@ -11708,10 +11198,9 @@ bool UBioAutoConditionals::F1541 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1540 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1540 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1540Ref { L"Function PlotManager.BioAutoConditionals.F1540", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1540 )
-		pFnF1540 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1540" );
+	UFunction* const pFnF1540 = pFnF1540Ref.Get ( );
 
 	UBioAutoConditionals_execF1540_Parms F1540_Parms;
 	F1540_Parms.bioWorld = bioWorld;
@@ -11731,10 +11220,9 @@ bool UBioAutoConditionals::F1540 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1539 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1539 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1539Ref { L"Function PlotManager.BioAutoConditionals.F1539", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1539 )
-		pFnF1539 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1539" );
+	UFunction* const pFnF1539 = pFnF1539Ref.Get ( );
 
 	UBioAutoConditionals_execF1539_Parms F1539_Parms;
 	F1539_Parms.bioWorld = bioWorld;
@@ -11754,10 +11242,9 @@ bool UBioAutoConditionals::F1539 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F916 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF916 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF916Ref { L"Function PlotManager.BioAutoConditionals.F916", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF916 )
-		pFnF916 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F916" );
+	UFunction* const pFnF916 = pFnF916Ref.Get ( );
 
 	UBioAutoConditionals_execF916_Parms F916_Parms;
 	F916_Parms.bioWorld = bioWorld;
@@ -11777,10 +11264,9 @@ bool UBioAutoConditionals::F916 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F882 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF882 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF882Ref { L"Function PlotManager.BioAutoConditionals.F882", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF882 )
-		pFnF882 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F882" );
+	UFunction* const pFnF882 = pFnF882Ref.Get ( );
 
 	UBioAutoConditionals_execF882_Parms F882_Parms;
 	F882_Parms.bioWorld = bioWorld;
@@ -11800,10 +11286,9 @@ bool UBioAutoConditionals::F882 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F729 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF729 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF729Ref { L"Function PlotManager.BioAutoConditionals.F729", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF729 )
-		pFnF729 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F729" );
+	UFunction* const pFnF729 = pFnF729Ref.Get ( );
 
 	UBioAutoConditionals_execF729_Parms F729_Parms;
 	F729_Parms.bioWorld = bioWorld;
@@ -11823,10 +11308,9 @@ bool UBioAutoConditionals::F729 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F728 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF728 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF728Ref { L"Function PlotManager.BioAutoConditionals.F728", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF728 )
-		pFnF728 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F728" );
+	UFunction* const pFnF728 = pFnF728Ref.Get ( );
 
 	UBioAutoConditionals_execF728_Parms F728_Parms;
 	F728_Parms.bioWorld = bioWorld;
@@ -11846,10 +11330,9 @@ bool UBioAutoConditionals::F728 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F727 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF727 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF727Ref { L"Function PlotManager.BioAutoConditionals.F727", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF727 )
-		pFnF727 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F727" );
+	UFunction* const pFnF727 = pFnF727Ref.Get ( );
 
 	UBioAutoConditionals_execF727_Parms F727_Parms;
 	F727_Parms.bioWorld = bioWorld;
@@ -11869,10 +11352,9 @@ bool UBioAutoConditionals::F727 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F726 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF726 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF726Ref { L"Function PlotManager.BioAutoConditionals.F726", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF726 )
-		pFnF726 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F726" );
+	UFunction* const pFnF726 = pFnF726Ref.Get ( );
 
 	UBioAutoConditionals_execF726_Parms F726_Parms;
 	F726_Parms.bioWorld = bioWorld;
@@ -11892,10 +11374,9 @@ bool UBioAutoConditionals::F726 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F725 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF725 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF725Ref { L"Function PlotManager.BioAutoConditionals.F725", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF725 )
-		pFnF725 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F725" );
+	UFunction* const pFnF725 = pFnF725Ref.Get ( );
 
 	UBioAutoConditionals_execF725_Parms F725_Parms;
 	F725_Parms.bioWorld = bioWorld;
@@ -11915,10 +11396,9 @@ bool UBioAutoConditionals::F725 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F724 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF724 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF724Ref { L"Function PlotManager.BioAutoConditionals.F724", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF724 )
-		pFnF724 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F724" );
+	UFunction* const pFnF724 = pFnF724Ref.Get ( );
 
 	UBioAutoConditionals_execF724_Parms F724_Parms;
 	F724_Parms.bioWorld = bioWorld;
@@ -11938,10 +11418,9 @@ bool UBioAutoConditionals::F724 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F722 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF722 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF722Ref { L"Function PlotManager.BioAutoConditionals.F722", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF722 )
-		pFnF722 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F722" );
+	UFunction* const pFnF722 = pFnF722Ref.Get ( );
 
 	UBioAutoConditionals_execF722_Parms F722_Parms;
 	F722_Parms.bioWorld = bioWorld;
@@ -11961,10 +11440,9 @@ bool UBioAutoConditionals::F722 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F647 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF647 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF647Ref { L"Function PlotManager.BioAutoConditionals.F647", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF647 )
-		pFnF647 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F647" );
+	UFunction* const pFnF647 = pFnF647Ref.Get ( );
 
 	UBioAutoConditionals_execF647_Parms F647_Parms;
 	F647_Parms.bioWorld = bioWorld;
@@ -11984,10 +11462,9 @@ bool UBioAutoConditionals::F647 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1185 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1185 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1185Ref { L"Function PlotManager.BioAutoConditionals.F1185", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1185 )
-		pFnF1185 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1185" );
+	UFunction* const pFnF1185 = pFnF1185Ref.Get ( );
 
 	UBioAutoConditionals_execF1185_Parms F1185_Parms;
 	F1185_Parms.bioWorld = bioWorld;
@@ -12007,10 +11484,9 @@ bool UBioAutoConditionals::F1185 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F665 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF665 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF665Ref { L"Function PlotManager.BioAutoConditionals.F665", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF665 )
-		pFnF665 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F665" );
+	UFunction* const pFnF665 = pFnF665Ref.Get ( );
 
 	UBioAutoConditionals_execF665_Parms F665_Parms;
 	F665_Parms.bioWorld = bioWorld;
@@ -12030,10 +11506,9 @@ bool UBioAutoConditionals::F665 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F376 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF376 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF376Ref { L"Function PlotManager.BioAutoConditionals.F376", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF376 )
-		pFnF376 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F376" );
+	UFunction* const pFnF376 = pFnF376Ref.Get ( );
 
 	UBioAutoConditionals_execF376_Parms F376_Parms;
 	F376_Parms.bioWorld = bioWorld;
@@ -12053,10 +11528,9 @@ bool UBioAutoConditionals::F376 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1491 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1491 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1491Ref { L"Function PlotManager.BioAutoConditionals.F1491", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1491 )
-		pFnF1491 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1491" );
+	UFunction* const pFnF1491 = pFnF1491Ref.Get ( );
 
 	UBioAutoConditionals_execF1491_Parms F1491_Parms;
 	F1491_Parms.bioWorld = bioWorld;
@@ -12076,10 +11550,9 @@ bool UBioAutoConditionals::F1491 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1490 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1490 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1490Ref { L"Function PlotManager.BioAutoConditionals.F1490", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1490 )
-		pFnF1490 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1490" );
+	UFunction* const pFnF1490 = pFnF1490Ref.Get ( );
 
 	UBioAutoConditionals_execF1490_Parms F1490_Parms;
 	F1490_Parms.bioWorld = bioWorld;
@@ -12099,10 +11572,9 @@ bool UBioAutoConditionals::F1490 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F918 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF918 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF918Ref { L"Function PlotManager.BioAutoConditionals.F918", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF918 )
-		pFnF918 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F918" );
+	UFunction* const pFnF918 = pFnF918Ref.Get ( );
 
 	UBioAutoConditionals_execF918_Parms F918_Parms;
 	F918_Parms.bioWorld = bioWorld;
@@ -12122,10 +11594,9 @@ bool UBioAutoConditionals::F918 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F914 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF914 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF914Ref { L"Function PlotManager.BioAutoConditionals.F914", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF914 )
-		pFnF914 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F914" );
+	UFunction* const pFnF914 = pFnF914Ref.Get ( );
 
 	UBioAutoConditionals_execF914_Parms F914_Parms;
 	F914_Parms.bioWorld = bioWorld;
@@ -12145,10 +11616,9 @@ bool UBioAutoConditionals::F914 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F992 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF992 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF992Ref { L"Function PlotManager.BioAutoConditionals.F992", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF992 )
-		pFnF992 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F992" );
+	UFunction* const pFnF992 = pFnF992Ref.Get ( );
 
 	UBioAutoConditionals_execF992_Parms F992_Parms;
 	F992_Parms.bioWorld = bioWorld;
@@ -12168,10 +11638,9 @@ bool UBioAutoConditionals::F992 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F991 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF991 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF991Ref { L"Function PlotManager.BioAutoConditionals.F991", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF991 )
-		pFnF991 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F991" );
+	UFunction* const pFnF991 = pFnF991Ref.Get ( );
 
 	UBioAutoConditionals_execF991_Parms F991_Parms;
 	F991_Parms.bioWorld = bioWorld;
@@ -12191,10 +11660,9 @@ bool UBioAutoConditionals::F991 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F490 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF490 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF490Ref { L"Function PlotManager.BioAutoConditionals.F490", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF490 )
-		pFnF490 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F490" );
+	UFunction* const pFnF490 = pFnF490Ref.Get ( );
 
 	UBioAutoConditionals_execF490_Parms F490_Parms;
 	F490_Parms.bioWorld = bioWorld;
@@ -12214,10 +11682,9 @@ bool UBioAutoConditionals::F490 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F457 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF457 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF457Ref { L"Function PlotManager.BioAutoConditionals.F457", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF457 )
-		pFnF457 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F457" );
+	UFunction* const pFnF457 = pFnF457Ref.Get ( );
 
 	UBioAutoConditionals_execF457_Parms F457_Parms;
 	F457_Parms.bioWorld = bioWorld;
@@ -12237,10 +11704,9 @@ bool UBioAutoConditionals::F457 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F456 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF456 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF456Ref { L"Function PlotManager.BioAutoConditionals.F456", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF456 )
-		pFnF456 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F456" );
+	UFunction* const pFnF456 = pFnF456Ref.Get ( );
 
 	UBioAutoConditionals_execF456_Parms F456_Parms;
 	F456_Parms.bioWorld = bioWorld;
@@ -12260,10 +11726,9 @@ bool UBioAutoConditionals::F456 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1141 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1141 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1141Ref { L"Function PlotManager.BioAutoConditionals.F1141", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1141 )
-		pFnF1141 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1141" );
+	UFunction* const pFnF1141 = pFnF1141Ref.Get ( );
 
 	UBioAutoConditionals_execF1141_Parms F1141_Parms;
 	F1141_Parms.bioWorld = bioWorld;
@@ -12283,10 +11748,9 @@ bool UBioAutoConditionals::F1141 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F993 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF993 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF993Ref { L"Function PlotManager.BioAutoConditionals.F993", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF993 )
-		pFnF993 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F993" );
+	UFunction* const pFnF993 = pFnF993Ref.Get ( );
 
 	UBioAutoConditionals_execF993_Parms F993_Parms;
 	F993_Parms.bioWorld = bioWorld;
@@ -12306,10 +11770,9 @@ bool UBioAutoConditionals::F993 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1160 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1160 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1160Ref { L"Function PlotManager.BioAutoConditionals.F1160", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1160 )
-		pFnF1160 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1160" );
+	UFunction* const pFnF1160 = pFnF1160Ref.Get ( );
 
 	UBioAutoConditionals_execF1160_Parms F1160_Parms;
 	F1160_Parms.bioWorld = bioWorld;
@@ -12329,10 +11792,9 @@ bool UBioAutoConditionals::F1160 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1159 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1159 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1159Ref { L"Function PlotManager.BioAutoConditionals.F1159", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1159 )
-		pFnF1159 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1159" );
+	UFunction* const pFnF1159 = pFnF1159Ref.Get ( );
 
 	UBioAutoConditionals_execF1159_Parms F1159_Parms;
 	F1159_Parms.bioWorld = bioWorld;
@@ -12352,10 +11814,9 @@ bool UBioAutoConditionals::F1159 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1157 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1157 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1157Ref { L"Function PlotManager.BioAutoConditionals.F1157", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1157 )
-		pFnF1157 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1157" );
+	UFunction* const pFnF1157 = pFnF1157Ref.Get ( );
 
 	UBioAutoConditionals_execF1157_Parms F1157_Parms;
 	F1157_Parms.bioWorld = bioWorld;
@@ -12375,10 +11836,9 @@ bool UBioAutoConditionals::F1157 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F958 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF958 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF958Ref { L"Function PlotManager.BioAutoConditionals.F958", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF958 )
-		pFnF958 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F958" );
+	UFunction* const pFnF958 = pFnF958Ref.Get ( );
 
 	UBioAutoConditionals_execF958_Parms F958_Parms;
 	F958_Parms.bioWorld = bioWorld;
@@ -12398,10 +11858,9 @@ bool UBioAutoConditionals::F958 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1515 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1515 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1515Ref { L"Function PlotManager.BioAutoConditionals.F1515", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1515 )
-		pFnF1515 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1515" );
+	UFunction* const pFnF1515 = pFnF1515Ref.Get ( );
 
 	UBioAutoConditionals_execF1515_Parms F1515_Parms;
 	F1515_Parms.bioWorld = bioWorld;
@@ -12421,10 +11880,9 @@ bool UBioAutoConditionals::F1515 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1243 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1243 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1243Ref { L"Function PlotManager.BioAutoConditionals.F1243", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1243 )
-		pFnF1243 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1243" );
+	UFunction* const pFnF1243 = pFnF1243Ref.Get ( );
 
 	UBioAutoConditionals_execF1243_Parms F1243_Parms;
 	F1243_Parms.bioWorld = bioWorld;
@@ -12444,10 +11902,9 @@ bool UBioAutoConditionals::F1243 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1155 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1155 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1155Ref { L"Function PlotManager.BioAutoConditionals.F1155", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1155 )
-		pFnF1155 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1155" );
+	UFunction* const pFnF1155 = pFnF1155Ref.Get ( );
 
 	UBioAutoConditionals_execF1155_Parms F1155_Parms;
 	F1155_Parms.bioWorld = bioWorld;
@@ -12467,10 +11924,9 @@ bool UBioAutoConditionals::F1155 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1003 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1003 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1003Ref { L"Function PlotManager.BioAutoConditionals.F1003", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1003 )
-		pFnF1003 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1003" );
+	UFunction* const pFnF1003 = pFnF1003Ref.Get ( );
 
 	UBioAutoConditionals_execF1003_Parms F1003_Parms;
 	F1003_Parms.bioWorld = bioWorld;
@@ -12490,10 +11946,9 @@ bool UBioAutoConditionals::F1003 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F868 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF868 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF868Ref { L"Function PlotManager.BioAutoConditionals.F868", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF868 )
-		pFnF868 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F868" );
+	UFunction* const pFnF868 = pFnF868Ref.Get ( );
 
 	UBioAutoConditionals_execF868_Parms F868_Parms;
 	F868_Parms.bioWorld = bioWorld;
@@ -12513,10 +11968,9 @@ bool UBioAutoConditionals::F868 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F801 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF801 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF801Ref { L"Function PlotManager.BioAutoConditionals.F801", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF801 )
-		pFnF801 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F801" );
+	UFunction* const pFnF801 = pFnF801Ref.Get ( );
 
 	UBioAutoConditionals_execF801_Parms F801_Parms;
 	F801_Parms.bioWorld = bioWorld;
@@ -12536,10 +11990,9 @@ bool UBioAutoConditionals::F801 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F800 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF800 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF800Ref { L"Function PlotManager.BioAutoConditionals.F800", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF800 )
-		pFnF800 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F800" );
+	UFunction* const pFnF800 = pFnF800Ref.Get ( );
 
 	UBioAutoConditionals_execF800_Parms F800_Parms;
 	F800_Parms.bioWorld = bioWorld;
@@ -12559,10 +12012,9 @@ bool UBioAutoConditionals::F800 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F799 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF799 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF799Ref { L"Function PlotManager.BioAutoConditionals.F799", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF799 )
-		pFnF799 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F799" );
+	UFunction* const pFnF799 = pFnF799Ref.Get ( );
 
 	UBioAutoConditionals_execF799_Parms F799_Parms;
 	F799_Parms.bioWorld = bioWorld;
@@ -12582,10 +12034,9 @@ bool UBioAutoConditionals::F799 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F798 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF798 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF798Ref { L"Function PlotManager.BioAutoConditionals.F798", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF798 )
-		pFnF798 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F798" );
+	UFunction* const pFnF798 = pFnF798Ref.Get ( );
 
 	UBioAutoConditionals_execF798_Parms F798_Parms;
 	F798_Parms.bioWorld = bioWorld;
@@ -12605,10 +12056,9 @@ bool UBioAutoConditionals::F798 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F797 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF797 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF797Ref { L"Function PlotManager.BioAutoConditionals.F797", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF797 )
-		pFnF797 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F797" );
+	UFunction* const pFnF797 = pFnF797Ref.Get ( );
 
 	UBioAutoConditionals_execF797_Parms F797_Parms;
 	F797_Parms.bioWorld = bioWorld;
@@ -12628,10 +12078,9 @@ bool UBioAutoConditionals::F797 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F796 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF796 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF796Ref { L"Function PlotManager.BioAutoConditionals.F796", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF796 )
-		pFnF796 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F796" );
+	UFunction* const pFnF796 = pFnF796Ref.Get ( );
 
 	UBioAutoConditionals_execF796_Parms F796_Parms;
 	F796_Parms.bioWorld = bioWorld;
@@ -12651,10 +12100,9 @@ bool UBioAutoConditionals::F796 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F795 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF795 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF795Ref { L"Function PlotManager.BioAutoConditionals.F795", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF795 )
-		pFnF795 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F795" );
+	UFunction* const pFnF795 = pFnF795Ref.Get ( );
 
 	UBioAutoConditionals_execF795_Parms F795_Parms;
 	F795_Parms.bioWorld = bioWorld;
@@ -12674,10 +12122,9 @@ bool UBioAutoConditionals::F795 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F794 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF794 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF794Ref { L"Function PlotManager.BioAutoConditionals.F794", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF794 )
-		pFnF794 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F794" );
+	UFunction* const pFnF794 = pFnF794Ref.Get ( );
 
 	UBioAutoConditionals_execF794_Parms F794_Parms;
 	F794_Parms.bioWorld = bioWorld;
@@ -12697,10 +12144,9 @@ bool UBioAutoConditionals::F794 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F793 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF793 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF793Ref { L"Function PlotManager.BioAutoConditionals.F793", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF793 )
-		pFnF793 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F793" );
+	UFunction* const pFnF793 = pFnF793Ref.Get ( );
 
 	UBioAutoConditionals_execF793_Parms F793_Parms;
 	F793_Parms.bioWorld = bioWorld;
@@ -12720,10 +12166,9 @@ bool UBioAutoConditionals::F793 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F792 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF792 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF792Ref { L"Function PlotManager.BioAutoConditionals.F792", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF792 )
-		pFnF792 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F792" );
+	UFunction* const pFnF792 = pFnF792Ref.Get ( );
 
 	UBioAutoConditionals_execF792_Parms F792_Parms;
 	F792_Parms.bioWorld = bioWorld;
@@ -12743,10 +12188,9 @@ bool UBioAutoConditionals::F792 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1154 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1154 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1154Ref { L"Function PlotManager.BioAutoConditionals.F1154", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1154 )
-		pFnF1154 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1154" );
+	UFunction* const pFnF1154 = pFnF1154Ref.Get ( );
 
 	UBioAutoConditionals_execF1154_Parms F1154_Parms;
 	F1154_Parms.bioWorld = bioWorld;
@@ -12766,10 +12210,9 @@ bool UBioAutoConditionals::F1154 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F867 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF867 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF867Ref { L"Function PlotManager.BioAutoConditionals.F867", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF867 )
-		pFnF867 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F867" );
+	UFunction* const pFnF867 = pFnF867Ref.Get ( );
 
 	UBioAutoConditionals_execF867_Parms F867_Parms;
 	F867_Parms.bioWorld = bioWorld;
@@ -12789,10 +12232,9 @@ bool UBioAutoConditionals::F867 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F719 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF719 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF719Ref { L"Function PlotManager.BioAutoConditionals.F719", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF719 )
-		pFnF719 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F719" );
+	UFunction* const pFnF719 = pFnF719Ref.Get ( );
 
 	UBioAutoConditionals_execF719_Parms F719_Parms;
 	F719_Parms.bioWorld = bioWorld;
@@ -12812,10 +12254,9 @@ bool UBioAutoConditionals::F719 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F718 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF718 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF718Ref { L"Function PlotManager.BioAutoConditionals.F718", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF718 )
-		pFnF718 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F718" );
+	UFunction* const pFnF718 = pFnF718Ref.Get ( );
 
 	UBioAutoConditionals_execF718_Parms F718_Parms;
 	F718_Parms.bioWorld = bioWorld;
@@ -12835,10 +12276,9 @@ bool UBioAutoConditionals::F718 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F717 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF717 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF717Ref { L"Function PlotManager.BioAutoConditionals.F717", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF717 )
-		pFnF717 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F717" );
+	UFunction* const pFnF717 = pFnF717Ref.Get ( );
 
 	UBioAutoConditionals_execF717_Parms F717_Parms;
 	F717_Parms.bioWorld = bioWorld;
@@ -12858,10 +12298,9 @@ bool UBioAutoConditionals::F717 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F716 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF716 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF716Ref { L"Function PlotManager.BioAutoConditionals.F716", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF716 )
-		pFnF716 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F716" );
+	UFunction* const pFnF716 = pFnF716Ref.Get ( );
 
 	UBioAutoConditionals_execF716_Parms F716_Parms;
 	F716_Parms.bioWorld = bioWorld;
@@ -12881,10 +12320,9 @@ bool UBioAutoConditionals::F716 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F715 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF715 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF715Ref { L"Function PlotManager.BioAutoConditionals.F715", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF715 )
-		pFnF715 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F715" );
+	UFunction* const pFnF715 = pFnF715Ref.Get ( );
 
 	UBioAutoConditionals_execF715_Parms F715_Parms;
 	F715_Parms.bioWorld = bioWorld;
@@ -12904,10 +12342,9 @@ bool UBioAutoConditionals::F715 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F714 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF714 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF714Ref { L"Function PlotManager.BioAutoConditionals.F714", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF714 )
-		pFnF714 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F714" );
+	UFunction* const pFnF714 = pFnF714Ref.Get ( );
 
 	UBioAutoConditionals_execF714_Parms F714_Parms;
 	F714_Parms.bioWorld = bioWorld;
@@ -12927,10 +12364,9 @@ bool UBioAutoConditionals::F714 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F713 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF713 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF713Ref { L"Function PlotManager.BioAutoConditionals.F713", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF713 )
-		pFnF713 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F713" );
+	UFunction* const pFnF713 = pFnF713Ref.Get ( );
 
 	UBioAutoConditionals_execF713_Parms F713_Parms;
 	F713_Parms.bioWorld = bioWorld;
@@ -12950,10 +12386,9 @@ bool UBioAutoConditionals::F713 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F712 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF712 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF712Ref { L"Function PlotManager.BioAutoConditionals.F712", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF712 )
-		pFnF712 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F712" );
+	UFunction* const pFnF712 = pFnF712Ref.Get ( );
 
 	UBioAutoConditionals_execF712_Parms F712_Parms;
 	F712_Parms.bioWorld = bioWorld;
@@ -12973,10 +12408,9 @@ bool UBioAutoConditionals::F712 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F711 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF711 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF711Ref { L"Function PlotManager.BioAutoConditionals.F711", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF711 )
-		pFnF711 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F711" );
+	UFunction* const pFnF711 = pFnF711Ref.Get ( );
 
 	UBioAutoConditionals_execF711_Parms F711_Parms;
 	F711_Parms.bioWorld = bioWorld;
@@ -12996,10 +12430,9 @@ bool UBioAutoConditionals::F711 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1153 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1153 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1153Ref { L"Function PlotManager.BioAutoConditionals.F1153", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1153 )
-		pFnF1153 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1153" );
+	UFunction* const pFnF1153 = pFnF1153Ref.Get ( );
 
 	UBioAutoConditionals_execF1153_Parms F1153_Parms;
 	F1153_Parms.bioWorld = bioWorld;
@@ -13019,10 +12452,9 @@ bool UBioAutoConditionals::F1153 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F865 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF865 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF865Ref { L"Function PlotManager.BioAutoConditionals.F865", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF865 )
-		pFnF865 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F865" );
+	UFunction* const pFnF865 = pFnF865Ref.Get ( );
 
 	UBioAutoConditionals_execF865_Parms F865_Parms;
 	F865_Parms.bioWorld = bioWorld;
@@ -13042,10 +12474,9 @@ bool UBioAutoConditionals::F865 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F778 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF778 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF778Ref { L"Function PlotManager.BioAutoConditionals.F778", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF778 )
-		pFnF778 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F778" );
+	UFunction* const pFnF778 = pFnF778Ref.Get ( );
 
 	UBioAutoConditionals_execF778_Parms F778_Parms;
 	F778_Parms.bioWorld = bioWorld;
@@ -13065,10 +12496,9 @@ bool UBioAutoConditionals::F778 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F777 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF777 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF777Ref { L"Function PlotManager.BioAutoConditionals.F777", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF777 )
-		pFnF777 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F777" );
+	UFunction* const pFnF777 = pFnF777Ref.Get ( );
 
 	UBioAutoConditionals_execF777_Parms F777_Parms;
 	F777_Parms.bioWorld = bioWorld;
@@ -13088,10 +12518,9 @@ bool UBioAutoConditionals::F777 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F776 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF776 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF776Ref { L"Function PlotManager.BioAutoConditionals.F776", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF776 )
-		pFnF776 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F776" );
+	UFunction* const pFnF776 = pFnF776Ref.Get ( );
 
 	UBioAutoConditionals_execF776_Parms F776_Parms;
 	F776_Parms.bioWorld = bioWorld;
@@ -13111,10 +12540,9 @@ bool UBioAutoConditionals::F776 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F775 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF775 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF775Ref { L"Function PlotManager.BioAutoConditionals.F775", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF775 )
-		pFnF775 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F775" );
+	UFunction* const pFnF775 = pFnF775Ref.Get ( );
 
 	UBioAutoConditionals_execF775_Parms F775_Parms;
 	F775_Parms.bioWorld = bioWorld;
@@ -13134,10 +12562,9 @@ bool UBioAutoConditionals::F775 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F774 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF774 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF774Ref { L"Function PlotManager.BioAutoConditionals.F774", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF774 )
-		pFnF774 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F774" );
+	UFunction* const pFnF774 = pFnF774Ref.Get ( );
 
 	UBioAutoConditionals_execF774_Parms F774_Parms;
 	F774_Parms.bioWorld = bioWorld;
@@ -13157,10 +12584,9 @@ bool UBioAutoConditionals::F774 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F773 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF773 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF773Ref { L"Function PlotManager.BioAutoConditionals.F773", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF773 )
-		pFnF773 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F773" );
+	UFunction* const pFnF773 = pFnF773Ref.Get ( );
 
 	UBioAutoConditionals_execF773_Parms F773_Parms;
 	F773_Parms.bioWorld = bioWorld;
@@ -13180,10 +12606,9 @@ bool UBioAutoConditionals::F773 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F772 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF772 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF772Ref { L"Function PlotManager.BioAutoConditionals.F772", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF772 )
-		pFnF772 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F772" );
+	UFunction* const pFnF772 = pFnF772Ref.Get ( );
 
 	UBioAutoConditionals_execF772_Parms F772_Parms;
 	F772_Parms.bioWorld = bioWorld;
@@ -13203,10 +12628,9 @@ bool UBioAutoConditionals::F772 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F771 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF771 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF771Ref { L"Function PlotManager.BioAutoConditionals.F771", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF771 )
-		pFnF771 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F771" );
+	UFunction* const pFnF771 = pFnF771Ref.Get ( );
 
 	UBioAutoConditionals_execF771_Parms F771_Parms;
 	F771_Parms.bioWorld = bioWorld;
@@ -13226,10 +12650,9 @@ bool UBioAutoConditionals::F771 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F770 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF770 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF770Ref { L"Function PlotManager.BioAutoConditionals.F770", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF770 )
-		pFnF770 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F770" );
+	UFunction* const pFnF770 = pFnF770Ref.Get ( );
 
 	UBioAutoConditionals_execF770_Parms F770_Parms;
 	F770_Parms.bioWorld = bioWorld;
@@ -13249,10 +12672,9 @@ bool UBioAutoConditionals::F770 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F723 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF723 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF723Ref { L"Function PlotManager.BioAutoConditionals.F723", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF723 )
-		pFnF723 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F723" );
+	UFunction* const pFnF723 = pFnF723Ref.Get ( );
 
 	UBioAutoConditionals_execF723_Parms F723_Parms;
 	F723_Parms.bioWorld = bioWorld;
@@ -13272,10 +12694,9 @@ bool UBioAutoConditionals::F723 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1638 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1638 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1638Ref { L"Function PlotManager.BioAutoConditionals.F1638", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1638 )
-		pFnF1638 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1638" );
+	UFunction* const pFnF1638 = pFnF1638Ref.Get ( );
 
 	UBioAutoConditionals_execF1638_Parms F1638_Parms;
 	F1638_Parms.bioWorld = bioWorld;
@@ -13295,10 +12716,9 @@ bool UBioAutoConditionals::F1638 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1599 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1599 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1599Ref { L"Function PlotManager.BioAutoConditionals.F1599", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1599 )
-		pFnF1599 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1599" );
+	UFunction* const pFnF1599 = pFnF1599Ref.Get ( );
 
 	UBioAutoConditionals_execF1599_Parms F1599_Parms;
 	F1599_Parms.bioWorld = bioWorld;
@@ -13318,10 +12738,9 @@ bool UBioAutoConditionals::F1599 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1593 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1593 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1593Ref { L"Function PlotManager.BioAutoConditionals.F1593", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1593 )
-		pFnF1593 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1593" );
+	UFunction* const pFnF1593 = pFnF1593Ref.Get ( );
 
 	UBioAutoConditionals_execF1593_Parms F1593_Parms;
 	F1593_Parms.bioWorld = bioWorld;
@@ -13341,10 +12760,9 @@ bool UBioAutoConditionals::F1593 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1582 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1582 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1582Ref { L"Function PlotManager.BioAutoConditionals.F1582", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1582 )
-		pFnF1582 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1582" );
+	UFunction* const pFnF1582 = pFnF1582Ref.Get ( );
 
 	UBioAutoConditionals_execF1582_Parms F1582_Parms;
 	F1582_Parms.bioWorld = bioWorld;
@@ -13364,10 +12782,9 @@ bool UBioAutoConditionals::F1582 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1411 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1411 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1411Ref { L"Function PlotManager.BioAutoConditionals.F1411", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1411 )
-		pFnF1411 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1411" );
+	UFunction* const pFnF1411 = pFnF1411Ref.Get ( );
 
 	UBioAutoConditionals_execF1411_Parms F1411_Parms;
 	F1411_Parms.bioWorld = bioWorld;
@@ -13387,10 +12804,9 @@ bool UBioAutoConditionals::F1411 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1152 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1152 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1152Ref { L"Function PlotManager.BioAutoConditionals.F1152", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1152 )
-		pFnF1152 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1152" );
+	UFunction* const pFnF1152 = pFnF1152Ref.Get ( );
 
 	UBioAutoConditionals_execF1152_Parms F1152_Parms;
 	F1152_Parms.bioWorld = bioWorld;
@@ -13410,10 +12826,9 @@ bool UBioAutoConditionals::F1152 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1018 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1018 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1018Ref { L"Function PlotManager.BioAutoConditionals.F1018", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1018 )
-		pFnF1018 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1018" );
+	UFunction* const pFnF1018 = pFnF1018Ref.Get ( );
 
 	UBioAutoConditionals_execF1018_Parms F1018_Parms;
 	F1018_Parms.bioWorld = bioWorld;
@@ -13433,10 +12848,9 @@ bool UBioAutoConditionals::F1018 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F888 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF888 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF888Ref { L"Function PlotManager.BioAutoConditionals.F888", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF888 )
-		pFnF888 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F888" );
+	UFunction* const pFnF888 = pFnF888Ref.Get ( );
 
 	UBioAutoConditionals_execF888_Parms F888_Parms;
 	F888_Parms.bioWorld = bioWorld;
@@ -13456,10 +12870,9 @@ bool UBioAutoConditionals::F888 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F862 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF862 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF862Ref { L"Function PlotManager.BioAutoConditionals.F862", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF862 )
-		pFnF862 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F862" );
+	UFunction* const pFnF862 = pFnF862Ref.Get ( );
 
 	UBioAutoConditionals_execF862_Parms F862_Parms;
 	F862_Parms.bioWorld = bioWorld;
@@ -13479,10 +12892,9 @@ bool UBioAutoConditionals::F862 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F850 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF850 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF850Ref { L"Function PlotManager.BioAutoConditionals.F850", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF850 )
-		pFnF850 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F850" );
+	UFunction* const pFnF850 = pFnF850Ref.Get ( );
 
 	UBioAutoConditionals_execF850_Parms F850_Parms;
 	F850_Parms.bioWorld = bioWorld;
@@ -13502,10 +12914,9 @@ bool UBioAutoConditionals::F850 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F812 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF812 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF812Ref { L"Function PlotManager.BioAutoConditionals.F812", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF812 )
-		pFnF812 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F812" );
+	UFunction* const pFnF812 = pFnF812Ref.Get ( );
 
 	UBioAutoConditionals_execF812_Parms F812_Parms;
 	F812_Parms.bioWorld = bioWorld;
@@ -13525,10 +12936,9 @@ bool UBioAutoConditionals::F812 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F805 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF805 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF805Ref { L"Function PlotManager.BioAutoConditionals.F805", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF805 )
-		pFnF805 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F805" );
+	UFunction* const pFnF805 = pFnF805Ref.Get ( );
 
 	UBioAutoConditionals_execF805_Parms F805_Parms;
 	F805_Parms.bioWorld = bioWorld;
@@ -13548,10 +12958,9 @@ bool UBioAutoConditionals::F805 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F698 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF698 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF698Ref { L"Function PlotManager.BioAutoConditionals.F698", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF698 )
-		pFnF698 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F698" );
+	UFunction* const pFnF698 = pFnF698Ref.Get ( );
 
 	UBioAutoConditionals_execF698_Parms F698_Parms;
 	F698_Parms.bioWorld = bioWorld;
@@ -13571,10 +12980,9 @@ bool UBioAutoConditionals::F698 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F697 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF697 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF697Ref { L"Function PlotManager.BioAutoConditionals.F697", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF697 )
-		pFnF697 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F697" );
+	UFunction* const pFnF697 = pFnF697Ref.Get ( );
 
 	UBioAutoConditionals_execF697_Parms F697_Parms;
 	F697_Parms.bioWorld = bioWorld;
@@ -13594,10 +13002,9 @@ bool UBioAutoConditionals::F697 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F696 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF696 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF696Ref { L"Function PlotManager.BioAutoConditionals.F696", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF696 )
-		pFnF696 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F696" );
+	UFunction* const pFnF696 = pFnF696Ref.Get ( );
 
 	UBioAutoConditionals_execF696_Parms F696_Parms;
 	F696_Parms.bioWorld = bioWorld;
@@ -13617,10 +13024,9 @@ bool UBioAutoConditionals::F696 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F695 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF695 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF695Ref { L"Function PlotManager.BioAutoConditionals.F695", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF695 )
-		pFnF695 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F695" );
+	UFunction* const pFnF695 = pFnF695Ref.Get ( );
 
 	UBioAutoConditionals_execF695_Parms F695_Parms;
 	F695_Parms.bioWorld = bioWorld;
@@ -13640,10 +13046,9 @@ bool UBioAutoConditionals::F695 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F694 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF694 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF694Ref { L"Function PlotManager.BioAutoConditionals.F694", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF694 )
-		pFnF694 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F694" );
+	UFunction* const pFnF694 = pFnF694Ref.Get ( );
 
 	UBioAutoConditionals_execF694_Parms F694_Parms;
 	F694_Parms.bioWorld = bioWorld;
@@ -13663,10 +13068,9 @@ bool UBioAutoConditionals::F694 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F693 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF693 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF693Ref { L"Function PlotManager.BioAutoConditionals.F693", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF693 )
-		pFnF693 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F693" );
+	UFunction* const pFnF693 = pFnF693Ref.Get ( );
 
 	UBioAutoConditionals_execF693_Parms F693_Parms;
 	F693_Parms.bioWorld = bioWorld;
@@ -13686,10 +13090,9 @@ bool UBioAutoConditionals::F693 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F692 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF692 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF692Ref { L"Function PlotManager.BioAutoConditionals.F692", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF692 )
-		pFnF692 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F692" );
+	UFunction* const pFnF692 = pFnF692Ref.Get ( );
 
 	UBioAutoConditionals_execF692_Parms F692_Parms;
 	F692_Parms.bioWorld = bioWorld;
@@ -13709,10 +13112,9 @@ bool UBioAutoConditionals::F692 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F691 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF691 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF691Ref { L"Function PlotManager.BioAutoConditionals.F691", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF691 )
-		pFnF691 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F691" );
+	UFunction* const pFnF691 = pFnF691Ref.Get ( );
 
 	UBioAutoConditionals_execF691_Parms F691_Parms;
 	F691_Parms.bioWorld = bioWorld;
@@ -13732,10 +13134,9 @@ bool UBioAutoConditionals::F691 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F690 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF690 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF690Ref { L"Function PlotManager.BioAutoConditionals.F690", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF690 )
-		pFnF690 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F690" );
+	UFunction* const pFnF690 = pFnF690Ref.Get ( );
 
 	UBioAutoConditionals_execF690_Parms F690_Parms;
 	F690_Parms.bioWorld = bioWorld;
@@ -13755,10 +13156,9 @@ bool UBioAutoConditionals::F690 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F689 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF689 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF689Ref { L"Function PlotManager.BioAutoConditionals.F689", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF689 )
-		pFnF689 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F689" );
+	UFunction* const pFnF689 = pFnF689Ref.Get ( );
 
 	UBioAutoConditionals_execF689_Parms F689_Parms;
 	F689_Parms.bioWorld = bioWorld;
@@ -13778,10 +13178,9 @@ bool UBioAutoConditionals::F689 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F688 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF688 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF688Ref { L"Function PlotManager.BioAutoConditionals.F688", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF688 )
-		pFnF688 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F688" );
+	UFunction* const pFnF688 = pFnF688Ref.Get ( );
 
 	UBioAutoConditionals_execF688_Parms F688_Parms;
 	F688_Parms.bioWorld = bioWorld;
@@ -13801,10 +13200,9 @@ bool UBioAutoConditionals::F688 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F687 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF687 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF687Ref { L"Function PlotManager.BioAutoConditionals.F687", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF687 )
-		pFnF687 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F687" );
+	UFunction* const pFnF687 = pFnF687Ref.Get ( );
 
 	UBioAutoConditionals_execF687_Parms F687_Parms;
 	F687_Parms.bioWorld = bioWorld;
@@ -13824,10 +13222,9 @@ bool UBioAutoConditionals::F687 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1598 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1598 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1598Ref { L"Function PlotManager.BioAutoConditionals.F1598", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1598 )
-		pFnF1598 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1598" );
+	UFunction* const pFnF1598 = pFnF1598Ref.Get ( );
 
 	UBioAutoConditionals_execF1598_Parms F1598_Parms;
 	F1598_Parms.bioWorld = bioWorld;
@@ -13847,10 +13244,9 @@ bool UBioAutoConditionals::F1598 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1592 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1592 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1592Ref { L"Function PlotManager.BioAutoConditionals.F1592", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1592 )
-		pFnF1592 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1592" );
+	UFunction* const pFnF1592 = pFnF1592Ref.Get ( );
 
 	UBioAutoConditionals_execF1592_Parms F1592_Parms;
 	F1592_Parms.bioWorld = bioWorld;
@@ -13870,10 +13266,9 @@ bool UBioAutoConditionals::F1592 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1587 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1587 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1587Ref { L"Function PlotManager.BioAutoConditionals.F1587", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1587 )
-		pFnF1587 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1587" );
+	UFunction* const pFnF1587 = pFnF1587Ref.Get ( );
 
 	UBioAutoConditionals_execF1587_Parms F1587_Parms;
 	F1587_Parms.bioWorld = bioWorld;
@@ -13893,10 +13288,9 @@ bool UBioAutoConditionals::F1587 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1521 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1521 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1521Ref { L"Function PlotManager.BioAutoConditionals.F1521", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1521 )
-		pFnF1521 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1521" );
+	UFunction* const pFnF1521 = pFnF1521Ref.Get ( );
 
 	UBioAutoConditionals_execF1521_Parms F1521_Parms;
 	F1521_Parms.bioWorld = bioWorld;
@@ -13916,10 +13310,9 @@ bool UBioAutoConditionals::F1521 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1408 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1408 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1408Ref { L"Function PlotManager.BioAutoConditionals.F1408", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1408 )
-		pFnF1408 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1408" );
+	UFunction* const pFnF1408 = pFnF1408Ref.Get ( );
 
 	UBioAutoConditionals_execF1408_Parms F1408_Parms;
 	F1408_Parms.bioWorld = bioWorld;
@@ -13939,10 +13332,9 @@ bool UBioAutoConditionals::F1408 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1149 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1149 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1149Ref { L"Function PlotManager.BioAutoConditionals.F1149", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1149 )
-		pFnF1149 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1149" );
+	UFunction* const pFnF1149 = pFnF1149Ref.Get ( );
 
 	UBioAutoConditionals_execF1149_Parms F1149_Parms;
 	F1149_Parms.bioWorld = bioWorld;
@@ -13962,10 +13354,9 @@ bool UBioAutoConditionals::F1149 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F887 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF887 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF887Ref { L"Function PlotManager.BioAutoConditionals.F887", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF887 )
-		pFnF887 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F887" );
+	UFunction* const pFnF887 = pFnF887Ref.Get ( );
 
 	UBioAutoConditionals_execF887_Parms F887_Parms;
 	F887_Parms.bioWorld = bioWorld;
@@ -13985,10 +13376,9 @@ bool UBioAutoConditionals::F887 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F861 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF861 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF861Ref { L"Function PlotManager.BioAutoConditionals.F861", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF861 )
-		pFnF861 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F861" );
+	UFunction* const pFnF861 = pFnF861Ref.Get ( );
 
 	UBioAutoConditionals_execF861_Parms F861_Parms;
 	F861_Parms.bioWorld = bioWorld;
@@ -14008,10 +13398,9 @@ bool UBioAutoConditionals::F861 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F811 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF811 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF811Ref { L"Function PlotManager.BioAutoConditionals.F811", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF811 )
-		pFnF811 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F811" );
+	UFunction* const pFnF811 = pFnF811Ref.Get ( );
 
 	UBioAutoConditionals_execF811_Parms F811_Parms;
 	F811_Parms.bioWorld = bioWorld;
@@ -14031,10 +13420,9 @@ bool UBioAutoConditionals::F811 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F807 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF807 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF807Ref { L"Function PlotManager.BioAutoConditionals.F807", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF807 )
-		pFnF807 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F807" );
+	UFunction* const pFnF807 = pFnF807Ref.Get ( );
 
 	UBioAutoConditionals_execF807_Parms F807_Parms;
 	F807_Parms.bioWorld = bioWorld;
@@ -14054,10 +13442,9 @@ bool UBioAutoConditionals::F807 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F720 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF720 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF720Ref { L"Function PlotManager.BioAutoConditionals.F720", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF720 )
-		pFnF720 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F720" );
+	UFunction* const pFnF720 = pFnF720Ref.Get ( );
 
 	UBioAutoConditionals_execF720_Parms F720_Parms;
 	F720_Parms.bioWorld = bioWorld;
@@ -14077,10 +13464,9 @@ bool UBioAutoConditionals::F720 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F710 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF710 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF710Ref { L"Function PlotManager.BioAutoConditionals.F710", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF710 )
-		pFnF710 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F710" );
+	UFunction* const pFnF710 = pFnF710Ref.Get ( );
 
 	UBioAutoConditionals_execF710_Parms F710_Parms;
 	F710_Parms.bioWorld = bioWorld;
@@ -14100,10 +13486,9 @@ bool UBioAutoConditionals::F710 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F709 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF709 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF709Ref { L"Function PlotManager.BioAutoConditionals.F709", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF709 )
-		pFnF709 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F709" );
+	UFunction* const pFnF709 = pFnF709Ref.Get ( );
 
 	UBioAutoConditionals_execF709_Parms F709_Parms;
 	F709_Parms.bioWorld = bioWorld;
@@ -14123,10 +13508,9 @@ bool UBioAutoConditionals::F709 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F708 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF708 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF708Ref { L"Function PlotManager.BioAutoConditionals.F708", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF708 )
-		pFnF708 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F708" );
+	UFunction* const pFnF708 = pFnF708Ref.Get ( );
 
 	UBioAutoConditionals_execF708_Parms F708_Parms;
 	F708_Parms.bioWorld = bioWorld;
@@ -14146,10 +13530,9 @@ bool UBioAutoConditionals::F708 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F707 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF707 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF707Ref { L"Function PlotManager.BioAutoConditionals.F707", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF707 )
-		pFnF707 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F707" );
+	UFunction* const pFnF707 = pFnF707Ref.Get ( );
 
 	UBioAutoConditionals_execF707_Parms F707_Parms;
 	F707_Parms.bioWorld = bioWorld;
@@ -14169,10 +13552,9 @@ bool UBioAutoConditionals::F707 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F706 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF706 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF706Ref { L"Function PlotManager.BioAutoConditionals.F706", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF706 )
-		pFnF706 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F706" );
+	UFunction* const pFnF706 = pFnF706Ref.Get ( );
 
 	UBioAutoConditionals_execF706_Parms F706_Parms;
 	F706_Parms.bioWorld = bioWorld;
@@ -14192,10 +13574,9 @@ bool UBioAutoConditionals::F706 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F705 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF705 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF705Ref { L"Function PlotManager.BioAutoConditionals.F705", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF705 )
-		pFnF705 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F705" );
+	UFunction* const pFnF705 = pFnF705Ref.Get ( );
 
 	UBioAutoConditionals_execF705_Parms F705_Parms;
 	F705_Parms.bioWorld = bioWorld;
@@ -14215,10 +13596,9 @@ bool UBioAutoConditionals::F705 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F704 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF704 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF704Ref { L"Function PlotManager.BioAutoConditionals.F704", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF704 )
-		pFnF704 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F704" );
+	UFunction* const pFnF704 = pFnF704Ref.Get ( );
 
 	UBioAutoConditionals_execF704_Parms F704_Parms;
 	F704_Parms.bioWorld = bioWorld;
@@ -14238,10 +13618,9 @@ bool UBioAutoConditionals::F704 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F703 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF703 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF703Ref { L"Function PlotManager.BioAutoConditionals.F703", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF703 )
-		pFnF703 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F703" );
+	UFunction* const pFnF703 = pFnF703Ref.Get ( );
 
 	UBioAutoConditionals_execF703_Parms F703_Parms;
 	F703_Parms.bioWorld = bioWorld;
@@ -14261,10 +13640,9 @@ bool UBioAutoConditionals::F703 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F702 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF702 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF702Ref { L"Function PlotManager.BioAutoConditionals.F702", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF702 )
-		pFnF702 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F702" );
+	UFunction* const pFnF702 = pFnF702Ref.Get ( );
 
 	UBioAutoConditionals_execF702_Parms F702_Parms;
 	F702_Parms.bioWorld = bioWorld;
@@ -14284,10 +13662,9 @@ bool UBioAutoConditionals::F702 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F701 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF701 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF701Ref { L"Function PlotManager.BioAutoConditionals.F701", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF701 )
-		pFnF701 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F701" );
+	UFunction* const pFnF701 = pFnF701Ref.Get ( );
 
 	UBioAutoConditionals_execF701_Parms F701_Parms;
 	F701_Parms.bioWorld = bioWorld;
@@ -14307,10 +13684,9 @@ bool UBioAutoConditionals::F701 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F700 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF700 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF700Ref { L"Function PlotManager.BioAutoConditionals.F700", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF700 )
-		pFnF700 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F700" );
+	UFunction* const pFnF700 = pFnF700Ref.Get ( );
 
 	UBioAutoConditionals_execF700_Parms F700_Parms;
 	F700_Parms.bioWorld = bioWorld;
@@ -14330,10 +13706,9 @@ bool UBioAutoConditionals::F700 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F699 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF699 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF699Ref { L"Function PlotManager.BioAutoConditionals.F699", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF699 )
-		pFnF699 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F699" );
+	UFunction* const pFnF699 = pFnF699Ref.Get ( );
 
 	UBioAutoConditionals_execF699_Parms F699_Parms;
 	F699_Parms.bioWorld = bioWorld;
@@ -14353,10 +13728,9 @@ bool UBioAutoConditionals::F699 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1597 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1597 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1597Ref { L"Function PlotManager.BioAutoConditionals.F1597", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1597 )
-		pFnF1597 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1597" );
+	UFunction* const pFnF1597 = pFnF1597Ref.Get ( );
 
 	UBioAutoConditionals_execF1597_Parms F1597_Parms;
 	F1597_Parms.bioWorld = bioWorld;
@@ -14376,10 +13750,9 @@ bool UBioAutoConditionals::F1597 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1591 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1591 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1591Ref { L"Function PlotManager.BioAutoConditionals.F1591", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1591 )
-		pFnF1591 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1591" );
+	UFunction* const pFnF1591 = pFnF1591Ref.Get ( );
 
 	UBioAutoConditionals_execF1591_Parms F1591_Parms;
 	F1591_Parms.bioWorld = bioWorld;
@@ -14399,10 +13772,9 @@ bool UBioAutoConditionals::F1591 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1586 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1586 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1586Ref { L"Function PlotManager.BioAutoConditionals.F1586", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1586 )
-		pFnF1586 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1586" );
+	UFunction* const pFnF1586 = pFnF1586Ref.Get ( );
 
 	UBioAutoConditionals_execF1586_Parms F1586_Parms;
 	F1586_Parms.bioWorld = bioWorld;
@@ -14422,10 +13794,9 @@ bool UBioAutoConditionals::F1586 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1520 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1520 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1520Ref { L"Function PlotManager.BioAutoConditionals.F1520", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1520 )
-		pFnF1520 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1520" );
+	UFunction* const pFnF1520 = pFnF1520Ref.Get ( );
 
 	UBioAutoConditionals_execF1520_Parms F1520_Parms;
 	F1520_Parms.bioWorld = bioWorld;
@@ -14445,10 +13816,9 @@ bool UBioAutoConditionals::F1520 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1410 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1410 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1410Ref { L"Function PlotManager.BioAutoConditionals.F1410", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1410 )
-		pFnF1410 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1410" );
+	UFunction* const pFnF1410 = pFnF1410Ref.Get ( );
 
 	UBioAutoConditionals_execF1410_Parms F1410_Parms;
 	F1410_Parms.bioWorld = bioWorld;
@@ -14468,10 +13838,9 @@ bool UBioAutoConditionals::F1410 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1148 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1148 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1148Ref { L"Function PlotManager.BioAutoConditionals.F1148", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1148 )
-		pFnF1148 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1148" );
+	UFunction* const pFnF1148 = pFnF1148Ref.Get ( );
 
 	UBioAutoConditionals_execF1148_Parms F1148_Parms;
 	F1148_Parms.bioWorld = bioWorld;
@@ -14491,10 +13860,9 @@ bool UBioAutoConditionals::F1148 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F900 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF900 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF900Ref { L"Function PlotManager.BioAutoConditionals.F900", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF900 )
-		pFnF900 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F900" );
+	UFunction* const pFnF900 = pFnF900Ref.Get ( );
 
 	UBioAutoConditionals_execF900_Parms F900_Parms;
 	F900_Parms.bioWorld = bioWorld;
@@ -14514,10 +13882,9 @@ bool UBioAutoConditionals::F900 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F899 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF899 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF899Ref { L"Function PlotManager.BioAutoConditionals.F899", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF899 )
-		pFnF899 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F899" );
+	UFunction* const pFnF899 = pFnF899Ref.Get ( );
 
 	UBioAutoConditionals_execF899_Parms F899_Parms;
 	F899_Parms.bioWorld = bioWorld;
@@ -14537,10 +13904,9 @@ bool UBioAutoConditionals::F899 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F894 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF894 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF894Ref { L"Function PlotManager.BioAutoConditionals.F894", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF894 )
-		pFnF894 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F894" );
+	UFunction* const pFnF894 = pFnF894Ref.Get ( );
 
 	UBioAutoConditionals_execF894_Parms F894_Parms;
 	F894_Parms.bioWorld = bioWorld;
@@ -14560,10 +13926,9 @@ bool UBioAutoConditionals::F894 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F893 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF893 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF893Ref { L"Function PlotManager.BioAutoConditionals.F893", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF893 )
-		pFnF893 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F893" );
+	UFunction* const pFnF893 = pFnF893Ref.Get ( );
 
 	UBioAutoConditionals_execF893_Parms F893_Parms;
 	F893_Parms.bioWorld = bioWorld;
@@ -14583,10 +13948,9 @@ bool UBioAutoConditionals::F893 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F886 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF886 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF886Ref { L"Function PlotManager.BioAutoConditionals.F886", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF886 )
-		pFnF886 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F886" );
+	UFunction* const pFnF886 = pFnF886Ref.Get ( );
 
 	UBioAutoConditionals_execF886_Parms F886_Parms;
 	F886_Parms.bioWorld = bioWorld;
@@ -14606,10 +13970,9 @@ bool UBioAutoConditionals::F886 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F860 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF860 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF860Ref { L"Function PlotManager.BioAutoConditionals.F860", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF860 )
-		pFnF860 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F860" );
+	UFunction* const pFnF860 = pFnF860Ref.Get ( );
 
 	UBioAutoConditionals_execF860_Parms F860_Parms;
 	F860_Parms.bioWorld = bioWorld;
@@ -14629,10 +13992,9 @@ bool UBioAutoConditionals::F860 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F769 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF769 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF769Ref { L"Function PlotManager.BioAutoConditionals.F769", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF769 )
-		pFnF769 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F769" );
+	UFunction* const pFnF769 = pFnF769Ref.Get ( );
 
 	UBioAutoConditionals_execF769_Parms F769_Parms;
 	F769_Parms.bioWorld = bioWorld;
@@ -14652,10 +14014,9 @@ bool UBioAutoConditionals::F769 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F768 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF768 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF768Ref { L"Function PlotManager.BioAutoConditionals.F768", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF768 )
-		pFnF768 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F768" );
+	UFunction* const pFnF768 = pFnF768Ref.Get ( );
 
 	UBioAutoConditionals_execF768_Parms F768_Parms;
 	F768_Parms.bioWorld = bioWorld;
@@ -14675,10 +14036,9 @@ bool UBioAutoConditionals::F768 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F767 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF767 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF767Ref { L"Function PlotManager.BioAutoConditionals.F767", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF767 )
-		pFnF767 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F767" );
+	UFunction* const pFnF767 = pFnF767Ref.Get ( );
 
 	UBioAutoConditionals_execF767_Parms F767_Parms;
 	F767_Parms.bioWorld = bioWorld;
@@ -14698,10 +14058,9 @@ bool UBioAutoConditionals::F767 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F766 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF766 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF766Ref { L"Function PlotManager.BioAutoConditionals.F766", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF766 )
-		pFnF766 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F766" );
+	UFunction* const pFnF766 = pFnF766Ref.Get ( );
 
 	UBioAutoConditionals_execF766_Parms F766_Parms;
 	F766_Parms.bioWorld = bioWorld;
@@ -14721,10 +14080,9 @@ bool UBioAutoConditionals::F766 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F765 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF765 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF765Ref { L"Function PlotManager.BioAutoConditionals.F765", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF765 )
-		pFnF765 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F765" );
+	UFunction* const pFnF765 = pFnF765Ref.Get ( );
 
 	UBioAutoConditionals_execF765_Parms F765_Parms;
 	F765_Parms.bioWorld = bioWorld;
@@ -14744,10 +14102,9 @@ bool UBioAutoConditionals::F765 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F764 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF764 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF764Ref { L"Function PlotManager.BioAutoConditionals.F764", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF764 )
-		pFnF764 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F764" );
+	UFunction* const pFnF764 = pFnF764Ref.Get ( );
 
 	UBioAutoConditionals_execF764_Parms F764_Parms;
 	F764_Parms.bioWorld = bioWorld;
@@ -14767,10 +14124,9 @@ bool UBioAutoConditionals::F764 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F763 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF763 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF763Ref { L"Function PlotManager.BioAutoConditionals.F763", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF763 )
-		pFnF763 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F763" );
+	UFunction* const pFnF763 = pFnF763Ref.Get ( );
 
 	UBioAutoConditionals_execF763_Parms F763_Parms;
 	F763_Parms.bioWorld = bioWorld;
@@ -14790,10 +14146,9 @@ bool UBioAutoConditionals::F763 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F762 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF762 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF762Ref { L"Function PlotManager.BioAutoConditionals.F762", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF762 )
-		pFnF762 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F762" );
+	UFunction* const pFnF762 = pFnF762Ref.Get ( );
 
 	UBioAutoConditionals_execF762_Parms F762_Parms;
 	F762_Parms.bioWorld = bioWorld;
@@ -14813,10 +14168,9 @@ bool UBioAutoConditionals::F762 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F761 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF761 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF761Ref { L"Function PlotManager.BioAutoConditionals.F761", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF761 )
-		pFnF761 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F761" );
+	UFunction* const pFnF761 = pFnF761Ref.Get ( );
 
 	UBioAutoConditionals_execF761_Parms F761_Parms;
 	F761_Parms.bioWorld = bioWorld;
@@ -14836,10 +14190,9 @@ bool UBioAutoConditionals::F761 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F760 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF760 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF760Ref { L"Function PlotManager.BioAutoConditionals.F760", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF760 )
-		pFnF760 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F760" );
+	UFunction* const pFnF760 = pFnF760Ref.Get ( );
 
 	UBioAutoConditionals_execF760_Parms F760_Parms;
 	F760_Parms.bioWorld = bioWorld;
@@ -14859,10 +14212,9 @@ bool UBioAutoConditionals::F760 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F732 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF732 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF732Ref { L"Function PlotManager.BioAutoConditionals.F732", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF732 )
-		pFnF732 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F732" );
+	UFunction* const pFnF732 = pFnF732Ref.Get ( );
 
 	UBioAutoConditionals_execF732_Parms F732_Parms;
 	F732_Parms.bioWorld = bioWorld;
@@ -14882,10 +14234,9 @@ bool UBioAutoConditionals::F732 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1146 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1146 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1146Ref { L"Function PlotManager.BioAutoConditionals.F1146", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1146 )
-		pFnF1146 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1146" );
+	UFunction* const pFnF1146 = pFnF1146Ref.Get ( );
 
 	UBioAutoConditionals_execF1146_Parms F1146_Parms;
 	F1146_Parms.bioWorld = bioWorld;
@@ -14905,10 +14256,9 @@ bool UBioAutoConditionals::F1146 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F919 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF919 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF919Ref { L"Function PlotManager.BioAutoConditionals.F919", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF919 )
-		pFnF919 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F919" );
+	UFunction* const pFnF919 = pFnF919Ref.Get ( );
 
 	UBioAutoConditionals_execF919_Parms F919_Parms;
 	F919_Parms.bioWorld = bioWorld;
@@ -14928,10 +14278,9 @@ bool UBioAutoConditionals::F919 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F863 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF863 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF863Ref { L"Function PlotManager.BioAutoConditionals.F863", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF863 )
-		pFnF863 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F863" );
+	UFunction* const pFnF863 = pFnF863Ref.Get ( );
 
 	UBioAutoConditionals_execF863_Parms F863_Parms;
 	F863_Parms.bioWorld = bioWorld;
@@ -14951,10 +14300,9 @@ bool UBioAutoConditionals::F863 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F759 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF759 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF759Ref { L"Function PlotManager.BioAutoConditionals.F759", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF759 )
-		pFnF759 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F759" );
+	UFunction* const pFnF759 = pFnF759Ref.Get ( );
 
 	UBioAutoConditionals_execF759_Parms F759_Parms;
 	F759_Parms.bioWorld = bioWorld;
@@ -14974,10 +14322,9 @@ bool UBioAutoConditionals::F759 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F758 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF758 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF758Ref { L"Function PlotManager.BioAutoConditionals.F758", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF758 )
-		pFnF758 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F758" );
+	UFunction* const pFnF758 = pFnF758Ref.Get ( );
 
 	UBioAutoConditionals_execF758_Parms F758_Parms;
 	F758_Parms.bioWorld = bioWorld;
@@ -14997,10 +14344,9 @@ bool UBioAutoConditionals::F758 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F755 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF755 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF755Ref { L"Function PlotManager.BioAutoConditionals.F755", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF755 )
-		pFnF755 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F755" );
+	UFunction* const pFnF755 = pFnF755Ref.Get ( );
 
 	UBioAutoConditionals_execF755_Parms F755_Parms;
 	F755_Parms.bioWorld = bioWorld;
@@ -15020,10 +14366,9 @@ bool UBioAutoConditionals::F755 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F754 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF754 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF754Ref { L"Function PlotManager.BioAutoConditionals.F754", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF754 )
-		pFnF754 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F754" );
+	UFunction* const pFnF754 = pFnF754Ref.Get ( );
 
 	UBioAutoConditionals_execF754_Parms F754_Parms;
 	F754_Parms.bioWorld = bioWorld;
@@ -15043,10 +14388,9 @@ bool UBioAutoConditionals::F754 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F753 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF753 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF753Ref { L"Function PlotManager.BioAutoConditionals.F753", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF753 )
-		pFnF753 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F753" );
+	UFunction* const pFnF753 = pFnF753Ref.Get ( );
 
 	UBioAutoConditionals_execF753_Parms F753_Parms;
 	F753_Parms.bioWorld = bioWorld;
@@ -15066,10 +14410,9 @@ bool UBioAutoConditionals::F753 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F752 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF752 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF752Ref { L"Function PlotManager.BioAutoConditionals.F752", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF752 )
-		pFnF752 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F752" );
+	UFunction* const pFnF752 = pFnF752Ref.Get ( );
 
 	UBioAutoConditionals_execF752_Parms F752_Parms;
 	F752_Parms.bioWorld = bioWorld;
@@ -15089,10 +14432,9 @@ bool UBioAutoConditionals::F752 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F751 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF751 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF751Ref { L"Function PlotManager.BioAutoConditionals.F751", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF751 )
-		pFnF751 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F751" );
+	UFunction* const pFnF751 = pFnF751Ref.Get ( );
 
 	UBioAutoConditionals_execF751_Parms F751_Parms;
 	F751_Parms.bioWorld = bioWorld;
@@ -15112,10 +14454,9 @@ bool UBioAutoConditionals::F751 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F750 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF750 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF750Ref { L"Function PlotManager.BioAutoConditionals.F750", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF750 )
-		pFnF750 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F750" );
+	UFunction* const pFnF750 = pFnF750Ref.Get ( );
 
 	UBioAutoConditionals_execF750_Parms F750_Parms;
 	F750_Parms.bioWorld = bioWorld;
@@ -15135,10 +14476,9 @@ bool UBioAutoConditionals::F750 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1095 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1095 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1095Ref { L"Function PlotManager.BioAutoConditionals.F1095", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1095 )
-		pFnF1095 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1095" );
+	UFunction* const pFnF1095 = pFnF1095Ref.Get ( );
 
 	UBioAutoConditionals_execF1095_Parms F1095_Parms;
 	F1095_Parms.bioWorld = bioWorld;
@@ -15158,10 +14498,9 @@ bool UBioAutoConditionals::F1095 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1596 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1596 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1596Ref { L"Function PlotManager.BioAutoConditionals.F1596", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1596 )
-		pFnF1596 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1596" );
+	UFunction* const pFnF1596 = pFnF1596Ref.Get ( );
 
 	UBioAutoConditionals_execF1596_Parms F1596_Parms;
 	F1596_Parms.bioWorld = bioWorld;
@@ -15181,10 +14520,9 @@ bool UBioAutoConditionals::F1596 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1590 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1590 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1590Ref { L"Function PlotManager.BioAutoConditionals.F1590", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1590 )
-		pFnF1590 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1590" );
+	UFunction* const pFnF1590 = pFnF1590Ref.Get ( );
 
 	UBioAutoConditionals_execF1590_Parms F1590_Parms;
 	F1590_Parms.bioWorld = bioWorld;
@@ -15204,10 +14542,9 @@ bool UBioAutoConditionals::F1590 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1585 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1585 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1585Ref { L"Function PlotManager.BioAutoConditionals.F1585", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1585 )
-		pFnF1585 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1585" );
+	UFunction* const pFnF1585 = pFnF1585Ref.Get ( );
 
 	UBioAutoConditionals_execF1585_Parms F1585_Parms;
 	F1585_Parms.bioWorld = bioWorld;
@@ -15227,10 +14564,9 @@ bool UBioAutoConditionals::F1585 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1412 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1412 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1412Ref { L"Function PlotManager.BioAutoConditionals.F1412", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1412 )
-		pFnF1412 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1412" );
+	UFunction* const pFnF1412 = pFnF1412Ref.Get ( );
 
 	UBioAutoConditionals_execF1412_Parms F1412_Parms;
 	F1412_Parms.bioWorld = bioWorld;
@@ -15250,10 +14586,9 @@ bool UBioAutoConditionals::F1412 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1145 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1145 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1145Ref { L"Function PlotManager.BioAutoConditionals.F1145", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1145 )
-		pFnF1145 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1145" );
+	UFunction* const pFnF1145 = pFnF1145Ref.Get ( );
 
 	UBioAutoConditionals_execF1145_Parms F1145_Parms;
 	F1145_Parms.bioWorld = bioWorld;
@@ -15273,10 +14608,9 @@ bool UBioAutoConditionals::F1145 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F859 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF859 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF859Ref { L"Function PlotManager.BioAutoConditionals.F859", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF859 )
-		pFnF859 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F859" );
+	UFunction* const pFnF859 = pFnF859Ref.Get ( );
 
 	UBioAutoConditionals_execF859_Parms F859_Parms;
 	F859_Parms.bioWorld = bioWorld;
@@ -15296,10 +14630,9 @@ bool UBioAutoConditionals::F859 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F810 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF810 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF810Ref { L"Function PlotManager.BioAutoConditionals.F810", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF810 )
-		pFnF810 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F810" );
+	UFunction* const pFnF810 = pFnF810Ref.Get ( );
 
 	UBioAutoConditionals_execF810_Parms F810_Parms;
 	F810_Parms.bioWorld = bioWorld;
@@ -15319,10 +14652,9 @@ bool UBioAutoConditionals::F810 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F804 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF804 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF804Ref { L"Function PlotManager.BioAutoConditionals.F804", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF804 )
-		pFnF804 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F804" );
+	UFunction* const pFnF804 = pFnF804Ref.Get ( );
 
 	UBioAutoConditionals_execF804_Parms F804_Parms;
 	F804_Parms.bioWorld = bioWorld;
@@ -15342,10 +14674,9 @@ bool UBioAutoConditionals::F804 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F686 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF686 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF686Ref { L"Function PlotManager.BioAutoConditionals.F686", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF686 )
-		pFnF686 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F686" );
+	UFunction* const pFnF686 = pFnF686Ref.Get ( );
 
 	UBioAutoConditionals_execF686_Parms F686_Parms;
 	F686_Parms.bioWorld = bioWorld;
@@ -15365,10 +14696,9 @@ bool UBioAutoConditionals::F686 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F672 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF672 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF672Ref { L"Function PlotManager.BioAutoConditionals.F672", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF672 )
-		pFnF672 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F672" );
+	UFunction* const pFnF672 = pFnF672Ref.Get ( );
 
 	UBioAutoConditionals_execF672_Parms F672_Parms;
 	F672_Parms.bioWorld = bioWorld;
@@ -15388,10 +14718,9 @@ bool UBioAutoConditionals::F672 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F671 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF671 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF671Ref { L"Function PlotManager.BioAutoConditionals.F671", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF671 )
-		pFnF671 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F671" );
+	UFunction* const pFnF671 = pFnF671Ref.Get ( );
 
 	UBioAutoConditionals_execF671_Parms F671_Parms;
 	F671_Parms.bioWorld = bioWorld;
@@ -15411,10 +14740,9 @@ bool UBioAutoConditionals::F671 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F670 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF670 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF670Ref { L"Function PlotManager.BioAutoConditionals.F670", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF670 )
-		pFnF670 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F670" );
+	UFunction* const pFnF670 = pFnF670Ref.Get ( );
 
 	UBioAutoConditionals_execF670_Parms F670_Parms;
 	F670_Parms.bioWorld = bioWorld;
@@ -15434,10 +14762,9 @@ bool UBioAutoConditionals::F670 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F668 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF668 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF668Ref { L"Function PlotManager.BioAutoConditionals.F668", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF668 )
-		pFnF668 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F668" );
+	UFunction* const pFnF668 = pFnF668Ref.Get ( );
 
 	UBioAutoConditionals_execF668_Parms F668_Parms;
 	F668_Parms.bioWorld = bioWorld;
@@ -15457,10 +14784,9 @@ bool UBioAutoConditionals::F668 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F568 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF568 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF568Ref { L"Function PlotManager.BioAutoConditionals.F568", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF568 )
-		pFnF568 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F568" );
+	UFunction* const pFnF568 = pFnF568Ref.Get ( );
 
 	UBioAutoConditionals_execF568_Parms F568_Parms;
 	F568_Parms.bioWorld = bioWorld;
@@ -15480,10 +14806,9 @@ bool UBioAutoConditionals::F568 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F567 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF567 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF567Ref { L"Function PlotManager.BioAutoConditionals.F567", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF567 )
-		pFnF567 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F567" );
+	UFunction* const pFnF567 = pFnF567Ref.Get ( );
 
 	UBioAutoConditionals_execF567_Parms F567_Parms;
 	F567_Parms.bioWorld = bioWorld;
@@ -15503,10 +14828,9 @@ bool UBioAutoConditionals::F567 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F566 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF566 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF566Ref { L"Function PlotManager.BioAutoConditionals.F566", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF566 )
-		pFnF566 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F566" );
+	UFunction* const pFnF566 = pFnF566Ref.Get ( );
 
 	UBioAutoConditionals_execF566_Parms F566_Parms;
 	F566_Parms.bioWorld = bioWorld;
@@ -15526,10 +14850,9 @@ bool UBioAutoConditionals::F566 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F565 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF565 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF565Ref { L"Function PlotManager.BioAutoConditionals.F565", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF565 )
-		pFnF565 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F565" );
+	UFunction* const pFnF565 = pFnF565Ref.Get ( );
 
 	UBioAutoConditionals_execF565_Parms F565_Parms;
 	F565_Parms.bioWorld = bioWorld;
@@ -15549,10 +14872,9 @@ bool UBioAutoConditionals::F565 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F564 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF564 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF564Ref { L"Function PlotManager.BioAutoConditionals.F564", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF564 )
-		pFnF564 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F564" );
+	UFunction* const pFnF564 = pFnF564Ref.Get ( );
 
 	UBioAutoConditionals_execF564_Parms F564_Parms;
 	F564_Parms.bioWorld = bioWorld;
@@ -15572,10 +14894,9 @@ bool UBioAutoConditionals::F564 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F563 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF563 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF563Ref { L"Function PlotManager.BioAutoConditionals.F563", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF563 )
-		pFnF563 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F563" );
+	UFunction* const pFnF563 = pFnF563Ref.Get ( );
 
 	UBioAutoConditionals_execF563_Parms F563_Parms;
 	F563_Parms.bioWorld = bioWorld;
@@ -15595,10 +14916,9 @@ bool UBioAutoConditionals::F563 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F561 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF561 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF561Ref { L"Function PlotManager.BioAutoConditionals.F561", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF561 )
-		pFnF561 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F561" );
+	UFunction* const pFnF561 = pFnF561Ref.Get ( );
 
 	UBioAutoConditionals_execF561_Parms F561_Parms;
 	F561_Parms.bioWorld = bioWorld;
@@ -15618,10 +14938,9 @@ bool UBioAutoConditionals::F561 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1642 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1642 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1642Ref { L"Function PlotManager.BioAutoConditionals.F1642", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1642 )
-		pFnF1642 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1642" );
+	UFunction* const pFnF1642 = pFnF1642Ref.Get ( );
 
 	UBioAutoConditionals_execF1642_Parms F1642_Parms;
 	F1642_Parms.bioWorld = bioWorld;
@@ -15641,10 +14960,9 @@ bool UBioAutoConditionals::F1642 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1641 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1641 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1641Ref { L"Function PlotManager.BioAutoConditionals.F1641", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1641 )
-		pFnF1641 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1641" );
+	UFunction* const pFnF1641 = pFnF1641Ref.Get ( );
 
 	UBioAutoConditionals_execF1641_Parms F1641_Parms;
 	F1641_Parms.bioWorld = bioWorld;
@@ -15664,10 +14982,9 @@ bool UBioAutoConditionals::F1641 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1584 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1584 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1584Ref { L"Function PlotManager.BioAutoConditionals.F1584", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1584 )
-		pFnF1584 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1584" );
+	UFunction* const pFnF1584 = pFnF1584Ref.Get ( );
 
 	UBioAutoConditionals_execF1584_Parms F1584_Parms;
 	F1584_Parms.bioWorld = bioWorld;
@@ -15687,10 +15004,9 @@ bool UBioAutoConditionals::F1584 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1589 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1589 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1589Ref { L"Function PlotManager.BioAutoConditionals.F1589", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1589 )
-		pFnF1589 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1589" );
+	UFunction* const pFnF1589 = pFnF1589Ref.Get ( );
 
 	UBioAutoConditionals_execF1589_Parms F1589_Parms;
 	F1589_Parms.bioWorld = bioWorld;
@@ -15710,10 +15026,9 @@ bool UBioAutoConditionals::F1589 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1595 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1595 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1595Ref { L"Function PlotManager.BioAutoConditionals.F1595", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1595 )
-		pFnF1595 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1595" );
+	UFunction* const pFnF1595 = pFnF1595Ref.Get ( );
 
 	UBioAutoConditionals_execF1595_Parms F1595_Parms;
 	F1595_Parms.bioWorld = bioWorld;
@@ -15733,10 +15048,9 @@ bool UBioAutoConditionals::F1595 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1144 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1144 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1144Ref { L"Function PlotManager.BioAutoConditionals.F1144", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1144 )
-		pFnF1144 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1144" );
+	UFunction* const pFnF1144 = pFnF1144Ref.Get ( );
 
 	UBioAutoConditionals_execF1144_Parms F1144_Parms;
 	F1144_Parms.bioWorld = bioWorld;
@@ -15756,10 +15070,9 @@ bool UBioAutoConditionals::F1144 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1272 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1272 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1272Ref { L"Function PlotManager.BioAutoConditionals.F1272", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1272 )
-		pFnF1272 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1272" );
+	UFunction* const pFnF1272 = pFnF1272Ref.Get ( );
 
 	UBioAutoConditionals_execF1272_Parms F1272_Parms;
 	F1272_Parms.bioWorld = bioWorld;
@@ -15779,10 +15092,9 @@ bool UBioAutoConditionals::F1272 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1271 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1271 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1271Ref { L"Function PlotManager.BioAutoConditionals.F1271", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1271 )
-		pFnF1271 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1271" );
+	UFunction* const pFnF1271 = pFnF1271Ref.Get ( );
 
 	UBioAutoConditionals_execF1271_Parms F1271_Parms;
 	F1271_Parms.bioWorld = bioWorld;
@@ -15802,10 +15114,9 @@ bool UBioAutoConditionals::F1271 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1270 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1270 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1270Ref { L"Function PlotManager.BioAutoConditionals.F1270", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1270 )
-		pFnF1270 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1270" );
+	UFunction* const pFnF1270 = pFnF1270Ref.Get ( );
 
 	UBioAutoConditionals_execF1270_Parms F1270_Parms;
 	F1270_Parms.bioWorld = bioWorld;
@@ -15825,10 +15136,9 @@ bool UBioAutoConditionals::F1270 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1269 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1269 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1269Ref { L"Function PlotManager.BioAutoConditionals.F1269", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1269 )
-		pFnF1269 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1269" );
+	UFunction* const pFnF1269 = pFnF1269Ref.Get ( );
 
 	UBioAutoConditionals_execF1269_Parms F1269_Parms;
 	F1269_Parms.bioWorld = bioWorld;
@@ -15848,10 +15158,9 @@ bool UBioAutoConditionals::F1269 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1409 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1409 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1409Ref { L"Function PlotManager.BioAutoConditionals.F1409", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1409 )
-		pFnF1409 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1409" );
+	UFunction* const pFnF1409 = pFnF1409Ref.Get ( );
 
 	UBioAutoConditionals_execF1409_Parms F1409_Parms;
 	F1409_Parms.bioWorld = bioWorld;
@@ -15871,10 +15180,9 @@ bool UBioAutoConditionals::F1409 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1028 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1028 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1028Ref { L"Function PlotManager.BioAutoConditionals.F1028", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1028 )
-		pFnF1028 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1028" );
+	UFunction* const pFnF1028 = pFnF1028Ref.Get ( );
 
 	UBioAutoConditionals_execF1028_Parms F1028_Parms;
 	F1028_Parms.bioWorld = bioWorld;
@@ -15894,10 +15202,9 @@ bool UBioAutoConditionals::F1028 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F962 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF962 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF962Ref { L"Function PlotManager.BioAutoConditionals.F962", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF962 )
-		pFnF962 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F962" );
+	UFunction* const pFnF962 = pFnF962Ref.Get ( );
 
 	UBioAutoConditionals_execF962_Parms F962_Parms;
 	F962_Parms.bioWorld = bioWorld;
@@ -15917,10 +15224,9 @@ bool UBioAutoConditionals::F962 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F959 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF959 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF959Ref { L"Function PlotManager.BioAutoConditionals.F959", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF959 )
-		pFnF959 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F959" );
+	UFunction* const pFnF959 = pFnF959Ref.Get ( );
 
 	UBioAutoConditionals_execF959_Parms F959_Parms;
 	F959_Parms.bioWorld = bioWorld;
@@ -15940,10 +15246,9 @@ bool UBioAutoConditionals::F959 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F957 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF957 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF957Ref { L"Function PlotManager.BioAutoConditionals.F957", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF957 )
-		pFnF957 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F957" );
+	UFunction* const pFnF957 = pFnF957Ref.Get ( );
 
 	UBioAutoConditionals_execF957_Parms F957_Parms;
 	F957_Parms.bioWorld = bioWorld;
@@ -15963,10 +15268,9 @@ bool UBioAutoConditionals::F957 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F898 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF898 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF898Ref { L"Function PlotManager.BioAutoConditionals.F898", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF898 )
-		pFnF898 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F898" );
+	UFunction* const pFnF898 = pFnF898Ref.Get ( );
 
 	UBioAutoConditionals_execF898_Parms F898_Parms;
 	F898_Parms.bioWorld = bioWorld;
@@ -15986,10 +15290,9 @@ bool UBioAutoConditionals::F898 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F809 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF809 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF809Ref { L"Function PlotManager.BioAutoConditionals.F809", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF809 )
-		pFnF809 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F809" );
+	UFunction* const pFnF809 = pFnF809Ref.Get ( );
 
 	UBioAutoConditionals_execF809_Parms F809_Parms;
 	F809_Parms.bioWorld = bioWorld;
@@ -16009,10 +15312,9 @@ bool UBioAutoConditionals::F809 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F806 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF806 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF806Ref { L"Function PlotManager.BioAutoConditionals.F806", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF806 )
-		pFnF806 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F806" );
+	UFunction* const pFnF806 = pFnF806Ref.Get ( );
 
 	UBioAutoConditionals_execF806_Parms F806_Parms;
 	F806_Parms.bioWorld = bioWorld;
@@ -16032,10 +15334,9 @@ bool UBioAutoConditionals::F806 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F749 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF749 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF749Ref { L"Function PlotManager.BioAutoConditionals.F749", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF749 )
-		pFnF749 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F749" );
+	UFunction* const pFnF749 = pFnF749Ref.Get ( );
 
 	UBioAutoConditionals_execF749_Parms F749_Parms;
 	F749_Parms.bioWorld = bioWorld;
@@ -16055,10 +15356,9 @@ bool UBioAutoConditionals::F749 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F748 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF748 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF748Ref { L"Function PlotManager.BioAutoConditionals.F748", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF748 )
-		pFnF748 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F748" );
+	UFunction* const pFnF748 = pFnF748Ref.Get ( );
 
 	UBioAutoConditionals_execF748_Parms F748_Parms;
 	F748_Parms.bioWorld = bioWorld;
@@ -16078,10 +15378,9 @@ bool UBioAutoConditionals::F748 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F747 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF747 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF747Ref { L"Function PlotManager.BioAutoConditionals.F747", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF747 )
-		pFnF747 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F747" );
+	UFunction* const pFnF747 = pFnF747Ref.Get ( );
 
 	UBioAutoConditionals_execF747_Parms F747_Parms;
 	F747_Parms.bioWorld = bioWorld;
@@ -16101,10 +15400,9 @@ bool UBioAutoConditionals::F747 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F746 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF746 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF746Ref { L"Function PlotManager.BioAutoConditionals.F746", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF746 )
-		pFnF746 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F746" );
+	UFunction* const pFnF746 = pFnF746Ref.Get ( );
 
 	UBioAutoConditionals_execF746_Parms F746_Parms;
 	F746_Parms.bioWorld = bioWorld;
@@ -16124,10 +15422,9 @@ bool UBioAutoConditionals::F746 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F745 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF745 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF745Ref { L"Function PlotManager.BioAutoConditionals.F745", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF745 )
-		pFnF745 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F745" );
+	UFunction* const pFnF745 = pFnF745Ref.Get ( );
 
 	UBioAutoConditionals_execF745_Parms F745_Parms;
 	F745_Parms.bioWorld = bioWorld;
@@ -16147,10 +15444,9 @@ bool UBioAutoConditionals::F745 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F744 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF744 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF744Ref { L"Function PlotManager.BioAutoConditionals.F744", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF744 )
-		pFnF744 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F744" );
+	UFunction* const pFnF744 = pFnF744Ref.Get ( );
 
 	UBioAutoConditionals_execF744_Parms F744_Parms;
 	F744_Parms.bioWorld = bioWorld;
@@ -16170,10 +15466,9 @@ bool UBioAutoConditionals::F744 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F743 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF743 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF743Ref { L"Function PlotManager.BioAutoConditionals.F743", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF743 )
-		pFnF743 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F743" );
+	UFunction* const pFnF743 = pFnF743Ref.Get ( );
 
 	UBioAutoConditionals_execF743_Parms F743_Parms;
 	F743_Parms.bioWorld = bioWorld;
@@ -16193,10 +15488,9 @@ bool UBioAutoConditionals::F743 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F742 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF742 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF742Ref { L"Function PlotManager.BioAutoConditionals.F742", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF742 )
-		pFnF742 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F742" );
+	UFunction* const pFnF742 = pFnF742Ref.Get ( );
 
 	UBioAutoConditionals_execF742_Parms F742_Parms;
 	F742_Parms.bioWorld = bioWorld;
@@ -16216,10 +15510,9 @@ bool UBioAutoConditionals::F742 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F741 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF741 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF741Ref { L"Function PlotManager.BioAutoConditionals.F741", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF741 )
-		pFnF741 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F741" );
+	UFunction* const pFnF741 = pFnF741Ref.Get ( );
 
 	UBioAutoConditionals_execF741_Parms F741_Parms;
 	F741_Parms.bioWorld = bioWorld;
@@ -16239,10 +15532,9 @@ bool UBioAutoConditionals::F741 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F740 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF740 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF740Ref { L"Function PlotManager.BioAutoConditionals.F740", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF740 )
-		pFnF740 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F740" );
+	UFunction* const pFnF740 = pFnF740Ref.Get ( );
 
 	UBioAutoConditionals_execF740_Parms F740_Parms;
 	F740_Parms.bioWorld = bioWorld;
@@ -16262,10 +15554,9 @@ bool UBioAutoConditionals::F740 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1594 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1594 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1594Ref { L"Function PlotManager.BioAutoConditionals.F1594", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1594 )
-		pFnF1594 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1594" );
+	UFunction* const pFnF1594 = pFnF1594Ref.Get ( );
 
 	UBioAutoConditionals_execF1594_Parms F1594_Parms;
 	F1594_Parms.bioWorld = bioWorld;
@@ -16285,10 +15576,9 @@ bool UBioAutoConditionals::F1594 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1588 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1588 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1588Ref { L"Function PlotManager.BioAutoConditionals.F1588", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1588 )
-		pFnF1588 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1588" );
+	UFunction* const pFnF1588 = pFnF1588Ref.Get ( );
 
 	UBioAutoConditionals_execF1588_Parms F1588_Parms;
 	F1588_Parms.bioWorld = bioWorld;
@@ -16308,10 +15598,9 @@ bool UBioAutoConditionals::F1588 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1583 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1583 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1583Ref { L"Function PlotManager.BioAutoConditionals.F1583", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1583 )
-		pFnF1583 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1583" );
+	UFunction* const pFnF1583 = pFnF1583Ref.Get ( );
 
 	UBioAutoConditionals_execF1583_Parms F1583_Parms;
 	F1583_Parms.bioWorld = bioWorld;
@@ -16331,10 +15620,9 @@ bool UBioAutoConditionals::F1583 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1413 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1413 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1413Ref { L"Function PlotManager.BioAutoConditionals.F1413", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1413 )
-		pFnF1413 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1413" );
+	UFunction* const pFnF1413 = pFnF1413Ref.Get ( );
 
 	UBioAutoConditionals_execF1413_Parms F1413_Parms;
 	F1413_Parms.bioWorld = bioWorld;
@@ -16354,10 +15642,9 @@ bool UBioAutoConditionals::F1413 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1143 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1143 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1143Ref { L"Function PlotManager.BioAutoConditionals.F1143", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1143 )
-		pFnF1143 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1143" );
+	UFunction* const pFnF1143 = pFnF1143Ref.Get ( );
 
 	UBioAutoConditionals_execF1143_Parms F1143_Parms;
 	F1143_Parms.bioWorld = bioWorld;
@@ -16377,10 +15664,9 @@ bool UBioAutoConditionals::F1143 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1142 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1142 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1142Ref { L"Function PlotManager.BioAutoConditionals.F1142", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1142 )
-		pFnF1142 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1142" );
+	UFunction* const pFnF1142 = pFnF1142Ref.Get ( );
 
 	UBioAutoConditionals_execF1142_Parms F1142_Parms;
 	F1142_Parms.bioWorld = bioWorld;
@@ -16400,10 +15686,9 @@ bool UBioAutoConditionals::F1142 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F857 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF857 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF857Ref { L"Function PlotManager.BioAutoConditionals.F857", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF857 )
-		pFnF857 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F857" );
+	UFunction* const pFnF857 = pFnF857Ref.Get ( );
 
 	UBioAutoConditionals_execF857_Parms F857_Parms;
 	F857_Parms.bioWorld = bioWorld;
@@ -16423,10 +15708,9 @@ bool UBioAutoConditionals::F857 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F808 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF808 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF808Ref { L"Function PlotManager.BioAutoConditionals.F808", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF808 )
-		pFnF808 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F808" );
+	UFunction* const pFnF808 = pFnF808Ref.Get ( );
 
 	UBioAutoConditionals_execF808_Parms F808_Parms;
 	F808_Parms.bioWorld = bioWorld;
@@ -16446,10 +15730,9 @@ bool UBioAutoConditionals::F808 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F803 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF803 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF803Ref { L"Function PlotManager.BioAutoConditionals.F803", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF803 )
-		pFnF803 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F803" );
+	UFunction* const pFnF803 = pFnF803Ref.Get ( );
 
 	UBioAutoConditionals_execF803_Parms F803_Parms;
 	F803_Parms.bioWorld = bioWorld;
@@ -16469,10 +15752,9 @@ bool UBioAutoConditionals::F803 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F802 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF802 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF802Ref { L"Function PlotManager.BioAutoConditionals.F802", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF802 )
-		pFnF802 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F802" );
+	UFunction* const pFnF802 = pFnF802Ref.Get ( );
 
 	UBioAutoConditionals_execF802_Parms F802_Parms;
 	F802_Parms.bioWorld = bioWorld;
@@ -16492,10 +15774,9 @@ bool UBioAutoConditionals::F802 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F685 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF685 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF685Ref { L"Function PlotManager.BioAutoConditionals.F685", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF685 )
-		pFnF685 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F685" );
+	UFunction* const pFnF685 = pFnF685Ref.Get ( );
 
 	UBioAutoConditionals_execF685_Parms F685_Parms;
 	F685_Parms.bioWorld = bioWorld;
@@ -16515,10 +15796,9 @@ bool UBioAutoConditionals::F685 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F684 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF684 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF684Ref { L"Function PlotManager.BioAutoConditionals.F684", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF684 )
-		pFnF684 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F684" );
+	UFunction* const pFnF684 = pFnF684Ref.Get ( );
 
 	UBioAutoConditionals_execF684_Parms F684_Parms;
 	F684_Parms.bioWorld = bioWorld;
@@ -16538,10 +15818,9 @@ bool UBioAutoConditionals::F684 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F683 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF683 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF683Ref { L"Function PlotManager.BioAutoConditionals.F683", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF683 )
-		pFnF683 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F683" );
+	UFunction* const pFnF683 = pFnF683Ref.Get ( );
 
 	UBioAutoConditionals_execF683_Parms F683_Parms;
 	F683_Parms.bioWorld = bioWorld;
@@ -16561,10 +15840,9 @@ bool UBioAutoConditionals::F683 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F682 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF682 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF682Ref { L"Function PlotManager.BioAutoConditionals.F682", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF682 )
-		pFnF682 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F682" );
+	UFunction* const pFnF682 = pFnF682Ref.Get ( );
 
 	UBioAutoConditionals_execF682_Parms F682_Parms;
 	F682_Parms.bioWorld = bioWorld;
@@ -16584,10 +15862,9 @@ bool UBioAutoConditionals::F682 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F680 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF680 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF680Ref { L"Function PlotManager.BioAutoConditionals.F680", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF680 )
-		pFnF680 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F680" );
+	UFunction* const pFnF680 = pFnF680Ref.Get ( );
 
 	UBioAutoConditionals_execF680_Parms F680_Parms;
 	F680_Parms.bioWorld = bioWorld;
@@ -16607,10 +15884,9 @@ bool UBioAutoConditionals::F680 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F679 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF679 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF679Ref { L"Function PlotManager.BioAutoConditionals.F679", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF679 )
-		pFnF679 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F679" );
+	UFunction* const pFnF679 = pFnF679Ref.Get ( );
 
 	UBioAutoConditionals_execF679_Parms F679_Parms;
 	F679_Parms.bioWorld = bioWorld;
@@ -16630,10 +15906,9 @@ bool UBioAutoConditionals::F679 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F678 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF678 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF678Ref { L"Function PlotManager.BioAutoConditionals.F678", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF678 )
-		pFnF678 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F678" );
+	UFunction* const pFnF678 = pFnF678Ref.Get ( );
 
 	UBioAutoConditionals_execF678_Parms F678_Parms;
 	F678_Parms.bioWorld = bioWorld;
@@ -16653,10 +15928,9 @@ bool UBioAutoConditionals::F678 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F677 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF677 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF677Ref { L"Function PlotManager.BioAutoConditionals.F677", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF677 )
-		pFnF677 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F677" );
+	UFunction* const pFnF677 = pFnF677Ref.Get ( );
 
 	UBioAutoConditionals_execF677_Parms F677_Parms;
 	F677_Parms.bioWorld = bioWorld;
@@ -16676,10 +15950,9 @@ bool UBioAutoConditionals::F677 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F676 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF676 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF676Ref { L"Function PlotManager.BioAutoConditionals.F676", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF676 )
-		pFnF676 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F676" );
+	UFunction* const pFnF676 = pFnF676Ref.Get ( );
 
 	UBioAutoConditionals_execF676_Parms F676_Parms;
 	F676_Parms.bioWorld = bioWorld;
@@ -16699,10 +15972,9 @@ bool UBioAutoConditionals::F676 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F675 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF675 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF675Ref { L"Function PlotManager.BioAutoConditionals.F675", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF675 )
-		pFnF675 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F675" );
+	UFunction* const pFnF675 = pFnF675Ref.Get ( );
 
 	UBioAutoConditionals_execF675_Parms F675_Parms;
 	F675_Parms.bioWorld = bioWorld;
@@ -16722,10 +15994,9 @@ bool UBioAutoConditionals::F675 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F674 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF674 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF674Ref { L"Function PlotManager.BioAutoConditionals.F674", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF674 )
-		pFnF674 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F674" );
+	UFunction* const pFnF674 = pFnF674Ref.Get ( );
 
 	UBioAutoConditionals_execF674_Parms F674_Parms;
 	F674_Parms.bioWorld = bioWorld;
@@ -16745,10 +16016,9 @@ bool UBioAutoConditionals::F674 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F673 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF673 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF673Ref { L"Function PlotManager.BioAutoConditionals.F673", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF673 )
-		pFnF673 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F673" );
+	UFunction* const pFnF673 = pFnF673Ref.Get ( );
 
 	UBioAutoConditionals_execF673_Parms F673_Parms;
 	F673_Parms.bioWorld = bioWorld;
@@ -16768,10 +16038,9 @@ bool UBioAutoConditionals::F673 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1619 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1619 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1619Ref { L"Function PlotManager.BioAutoConditionals.F1619", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1619 )
-		pFnF1619 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1619" );
+	UFunction* const pFnF1619 = pFnF1619Ref.Get ( );
 
 	UBioAutoConditionals_execF1619_Parms F1619_Parms;
 	F1619_Parms.bioWorld = bioWorld;
@@ -16791,10 +16060,9 @@ bool UBioAutoConditionals::F1619 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1618 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1618 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1618Ref { L"Function PlotManager.BioAutoConditionals.F1618", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1618 )
-		pFnF1618 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1618" );
+	UFunction* const pFnF1618 = pFnF1618Ref.Get ( );
 
 	UBioAutoConditionals_execF1618_Parms F1618_Parms;
 	F1618_Parms.bioWorld = bioWorld;
@@ -16814,10 +16082,9 @@ bool UBioAutoConditionals::F1618 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1506 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1506 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1506Ref { L"Function PlotManager.BioAutoConditionals.F1506", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1506 )
-		pFnF1506 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1506" );
+	UFunction* const pFnF1506 = pFnF1506Ref.Get ( );
 
 	UBioAutoConditionals_execF1506_Parms F1506_Parms;
 	F1506_Parms.bioWorld = bioWorld;
@@ -16837,10 +16104,9 @@ bool UBioAutoConditionals::F1506 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1495 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1495 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1495Ref { L"Function PlotManager.BioAutoConditionals.F1495", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1495 )
-		pFnF1495 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1495" );
+	UFunction* const pFnF1495 = pFnF1495Ref.Get ( );
 
 	UBioAutoConditionals_execF1495_Parms F1495_Parms;
 	F1495_Parms.bioWorld = bioWorld;
@@ -16860,10 +16126,9 @@ bool UBioAutoConditionals::F1495 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1163 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1163 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1163Ref { L"Function PlotManager.BioAutoConditionals.F1163", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1163 )
-		pFnF1163 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1163" );
+	UFunction* const pFnF1163 = pFnF1163Ref.Get ( );
 
 	UBioAutoConditionals_execF1163_Parms F1163_Parms;
 	F1163_Parms.bioWorld = bioWorld;
@@ -16883,10 +16148,9 @@ bool UBioAutoConditionals::F1163 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1162 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1162 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1162Ref { L"Function PlotManager.BioAutoConditionals.F1162", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1162 )
-		pFnF1162 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1162" );
+	UFunction* const pFnF1162 = pFnF1162Ref.Get ( );
 
 	UBioAutoConditionals_execF1162_Parms F1162_Parms;
 	F1162_Parms.bioWorld = bioWorld;
@@ -16906,10 +16170,9 @@ bool UBioAutoConditionals::F1162 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1025 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1025 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1025Ref { L"Function PlotManager.BioAutoConditionals.F1025", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1025 )
-		pFnF1025 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1025" );
+	UFunction* const pFnF1025 = pFnF1025Ref.Get ( );
 
 	UBioAutoConditionals_execF1025_Parms F1025_Parms;
 	F1025_Parms.bioWorld = bioWorld;
@@ -16929,10 +16192,9 @@ bool UBioAutoConditionals::F1025 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F574 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF574 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF574Ref { L"Function PlotManager.BioAutoConditionals.F574", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF574 )
-		pFnF574 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F574" );
+	UFunction* const pFnF574 = pFnF574Ref.Get ( );
 
 	UBioAutoConditionals_execF574_Parms F574_Parms;
 	F574_Parms.bioWorld = bioWorld;
@@ -16952,10 +16214,9 @@ bool UBioAutoConditionals::F574 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F573 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF573 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF573Ref { L"Function PlotManager.BioAutoConditionals.F573", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF573 )
-		pFnF573 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F573" );
+	UFunction* const pFnF573 = pFnF573Ref.Get ( );
 
 	UBioAutoConditionals_execF573_Parms F573_Parms;
 	F573_Parms.bioWorld = bioWorld;
@@ -16975,10 +16236,9 @@ bool UBioAutoConditionals::F573 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F417 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF417 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF417Ref { L"Function PlotManager.BioAutoConditionals.F417", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF417 )
-		pFnF417 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F417" );
+	UFunction* const pFnF417 = pFnF417Ref.Get ( );
 
 	UBioAutoConditionals_execF417_Parms F417_Parms;
 	F417_Parms.bioWorld = bioWorld;
@@ -16998,10 +16258,9 @@ bool UBioAutoConditionals::F417 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F413 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF413 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF413Ref { L"Function PlotManager.BioAutoConditionals.F413", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF413 )
-		pFnF413 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F413" );
+	UFunction* const pFnF413 = pFnF413Ref.Get ( );
 
 	UBioAutoConditionals_execF413_Parms F413_Parms;
 	F413_Parms.bioWorld = bioWorld;
@@ -17021,10 +16280,9 @@ bool UBioAutoConditionals::F413 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F572 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF572 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF572Ref { L"Function PlotManager.BioAutoConditionals.F572", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF572 )
-		pFnF572 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F572" );
+	UFunction* const pFnF572 = pFnF572Ref.Get ( );
 
 	UBioAutoConditionals_execF572_Parms F572_Parms;
 	F572_Parms.bioWorld = bioWorld;
@@ -17044,10 +16302,9 @@ bool UBioAutoConditionals::F572 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F571 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF571 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF571Ref { L"Function PlotManager.BioAutoConditionals.F571", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF571 )
-		pFnF571 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F571" );
+	UFunction* const pFnF571 = pFnF571Ref.Get ( );
 
 	UBioAutoConditionals_execF571_Parms F571_Parms;
 	F571_Parms.bioWorld = bioWorld;
@@ -17067,10 +16324,9 @@ bool UBioAutoConditionals::F571 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F416 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF416 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF416Ref { L"Function PlotManager.BioAutoConditionals.F416", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF416 )
-		pFnF416 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F416" );
+	UFunction* const pFnF416 = pFnF416Ref.Get ( );
 
 	UBioAutoConditionals_execF416_Parms F416_Parms;
 	F416_Parms.bioWorld = bioWorld;
@@ -17090,10 +16346,9 @@ bool UBioAutoConditionals::F416 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F412 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF412 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF412Ref { L"Function PlotManager.BioAutoConditionals.F412", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF412 )
-		pFnF412 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F412" );
+	UFunction* const pFnF412 = pFnF412Ref.Get ( );
 
 	UBioAutoConditionals_execF412_Parms F412_Parms;
 	F412_Parms.bioWorld = bioWorld;
@@ -17113,10 +16368,9 @@ bool UBioAutoConditionals::F412 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F570 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF570 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF570Ref { L"Function PlotManager.BioAutoConditionals.F570", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF570 )
-		pFnF570 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F570" );
+	UFunction* const pFnF570 = pFnF570Ref.Get ( );
 
 	UBioAutoConditionals_execF570_Parms F570_Parms;
 	F570_Parms.bioWorld = bioWorld;
@@ -17136,10 +16390,9 @@ bool UBioAutoConditionals::F570 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F569 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF569 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF569Ref { L"Function PlotManager.BioAutoConditionals.F569", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF569 )
-		pFnF569 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F569" );
+	UFunction* const pFnF569 = pFnF569Ref.Get ( );
 
 	UBioAutoConditionals_execF569_Parms F569_Parms;
 	F569_Parms.bioWorld = bioWorld;
@@ -17159,10 +16412,9 @@ bool UBioAutoConditionals::F569 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F415 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF415 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF415Ref { L"Function PlotManager.BioAutoConditionals.F415", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF415 )
-		pFnF415 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F415" );
+	UFunction* const pFnF415 = pFnF415Ref.Get ( );
 
 	UBioAutoConditionals_execF415_Parms F415_Parms;
 	F415_Parms.bioWorld = bioWorld;
@@ -17182,10 +16434,9 @@ bool UBioAutoConditionals::F415 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F411 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF411 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF411Ref { L"Function PlotManager.BioAutoConditionals.F411", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF411 )
-		pFnF411 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F411" );
+	UFunction* const pFnF411 = pFnF411Ref.Get ( );
 
 	UBioAutoConditionals_execF411_Parms F411_Parms;
 	F411_Parms.bioWorld = bioWorld;
@@ -17205,10 +16456,9 @@ bool UBioAutoConditionals::F411 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F396 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF396 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF396Ref { L"Function PlotManager.BioAutoConditionals.F396", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF396 )
-		pFnF396 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F396" );
+	UFunction* const pFnF396 = pFnF396Ref.Get ( );
 
 	UBioAutoConditionals_execF396_Parms F396_Parms;
 	F396_Parms.bioWorld = bioWorld;
@@ -17228,10 +16478,9 @@ bool UBioAutoConditionals::F396 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F395 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF395 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF395Ref { L"Function PlotManager.BioAutoConditionals.F395", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF395 )
-		pFnF395 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F395" );
+	UFunction* const pFnF395 = pFnF395Ref.Get ( );
 
 	UBioAutoConditionals_execF395_Parms F395_Parms;
 	F395_Parms.bioWorld = bioWorld;
@@ -17251,10 +16500,9 @@ bool UBioAutoConditionals::F395 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F394 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF394 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF394Ref { L"Function PlotManager.BioAutoConditionals.F394", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF394 )
-		pFnF394 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F394" );
+	UFunction* const pFnF394 = pFnF394Ref.Get ( );
 
 	UBioAutoConditionals_execF394_Parms F394_Parms;
 	F394_Parms.bioWorld = bioWorld;
@@ -17274,10 +16522,9 @@ bool UBioAutoConditionals::F394 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F392 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF392 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF392Ref { L"Function PlotManager.BioAutoConditionals.F392", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF392 )
-		pFnF392 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F392" );
+	UFunction* const pFnF392 = pFnF392Ref.Get ( );
 
 	UBioAutoConditionals_execF392_Parms F392_Parms;
 	F392_Parms.bioWorld = bioWorld;
@@ -17297,10 +16544,9 @@ bool UBioAutoConditionals::F392 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2050 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2050 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2050Ref { L"Function PlotManager.BioAutoConditionals.F2050", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2050 )
-		pFnF2050 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2050" );
+	UFunction* const pFnF2050 = pFnF2050Ref.Get ( );
 
 	UBioAutoConditionals_execF2050_Parms F2050_Parms;
 	F2050_Parms.bioWorld = bioWorld;
@@ -17320,10 +16566,9 @@ bool UBioAutoConditionals::F2050 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2049 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2049 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2049Ref { L"Function PlotManager.BioAutoConditionals.F2049", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2049 )
-		pFnF2049 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2049" );
+	UFunction* const pFnF2049 = pFnF2049Ref.Get ( );
 
 	UBioAutoConditionals_execF2049_Parms F2049_Parms;
 	F2049_Parms.bioWorld = bioWorld;
@@ -17343,10 +16588,9 @@ bool UBioAutoConditionals::F2049 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2048 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2048 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2048Ref { L"Function PlotManager.BioAutoConditionals.F2048", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2048 )
-		pFnF2048 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2048" );
+	UFunction* const pFnF2048 = pFnF2048Ref.Get ( );
 
 	UBioAutoConditionals_execF2048_Parms F2048_Parms;
 	F2048_Parms.bioWorld = bioWorld;
@@ -17366,10 +16610,9 @@ bool UBioAutoConditionals::F2048 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2047 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2047 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2047Ref { L"Function PlotManager.BioAutoConditionals.F2047", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2047 )
-		pFnF2047 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2047" );
+	UFunction* const pFnF2047 = pFnF2047Ref.Get ( );
 
 	UBioAutoConditionals_execF2047_Parms F2047_Parms;
 	F2047_Parms.bioWorld = bioWorld;
@@ -17389,10 +16632,9 @@ bool UBioAutoConditionals::F2047 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2046 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2046 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2046Ref { L"Function PlotManager.BioAutoConditionals.F2046", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2046 )
-		pFnF2046 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2046" );
+	UFunction* const pFnF2046 = pFnF2046Ref.Get ( );
 
 	UBioAutoConditionals_execF2046_Parms F2046_Parms;
 	F2046_Parms.bioWorld = bioWorld;
@@ -17412,10 +16654,9 @@ bool UBioAutoConditionals::F2046 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F250 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF250 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF250Ref { L"Function PlotManager.BioAutoConditionals.F250", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF250 )
-		pFnF250 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F250" );
+	UFunction* const pFnF250 = pFnF250Ref.Get ( );
 
 	UBioAutoConditionals_execF250_Parms F250_Parms;
 	F250_Parms.bioWorld = bioWorld;
@@ -17435,10 +16676,9 @@ bool UBioAutoConditionals::F250 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F249 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF249 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF249Ref { L"Function PlotManager.BioAutoConditionals.F249", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF249 )
-		pFnF249 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F249" );
+	UFunction* const pFnF249 = pFnF249Ref.Get ( );
 
 	UBioAutoConditionals_execF249_Parms F249_Parms;
 	F249_Parms.bioWorld = bioWorld;
@@ -17458,10 +16698,9 @@ bool UBioAutoConditionals::F249 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1418 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1418 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1418Ref { L"Function PlotManager.BioAutoConditionals.F1418", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1418 )
-		pFnF1418 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1418" );
+	UFunction* const pFnF1418 = pFnF1418Ref.Get ( );
 
 	UBioAutoConditionals_execF1418_Parms F1418_Parms;
 	F1418_Parms.bioWorld = bioWorld;
@@ -17481,10 +16720,9 @@ bool UBioAutoConditionals::F1418 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1299 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1299 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1299Ref { L"Function PlotManager.BioAutoConditionals.F1299", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1299 )
-		pFnF1299 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1299" );
+	UFunction* const pFnF1299 = pFnF1299Ref.Get ( );
 
 	UBioAutoConditionals_execF1299_Parms F1299_Parms;
 	F1299_Parms.bioWorld = bioWorld;
@@ -17504,10 +16742,9 @@ bool UBioAutoConditionals::F1299 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1298 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1298 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1298Ref { L"Function PlotManager.BioAutoConditionals.F1298", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1298 )
-		pFnF1298 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1298" );
+	UFunction* const pFnF1298 = pFnF1298Ref.Get ( );
 
 	UBioAutoConditionals_execF1298_Parms F1298_Parms;
 	F1298_Parms.bioWorld = bioWorld;
@@ -17527,10 +16764,9 @@ bool UBioAutoConditionals::F1298 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1297 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1297 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1297Ref { L"Function PlotManager.BioAutoConditionals.F1297", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1297 )
-		pFnF1297 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1297" );
+	UFunction* const pFnF1297 = pFnF1297Ref.Get ( );
 
 	UBioAutoConditionals_execF1297_Parms F1297_Parms;
 	F1297_Parms.bioWorld = bioWorld;
@@ -17550,10 +16786,9 @@ bool UBioAutoConditionals::F1297 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1296 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1296 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1296Ref { L"Function PlotManager.BioAutoConditionals.F1296", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1296 )
-		pFnF1296 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1296" );
+	UFunction* const pFnF1296 = pFnF1296Ref.Get ( );
 
 	UBioAutoConditionals_execF1296_Parms F1296_Parms;
 	F1296_Parms.bioWorld = bioWorld;
@@ -17573,10 +16808,9 @@ bool UBioAutoConditionals::F1296 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1295 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1295 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1295Ref { L"Function PlotManager.BioAutoConditionals.F1295", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1295 )
-		pFnF1295 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1295" );
+	UFunction* const pFnF1295 = pFnF1295Ref.Get ( );
 
 	UBioAutoConditionals_execF1295_Parms F1295_Parms;
 	F1295_Parms.bioWorld = bioWorld;
@@ -17596,10 +16830,9 @@ bool UBioAutoConditionals::F1295 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1294 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1294 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1294Ref { L"Function PlotManager.BioAutoConditionals.F1294", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1294 )
-		pFnF1294 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1294" );
+	UFunction* const pFnF1294 = pFnF1294Ref.Get ( );
 
 	UBioAutoConditionals_execF1294_Parms F1294_Parms;
 	F1294_Parms.bioWorld = bioWorld;
@@ -17619,10 +16852,9 @@ bool UBioAutoConditionals::F1294 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1293 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1293 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1293Ref { L"Function PlotManager.BioAutoConditionals.F1293", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1293 )
-		pFnF1293 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1293" );
+	UFunction* const pFnF1293 = pFnF1293Ref.Get ( );
 
 	UBioAutoConditionals_execF1293_Parms F1293_Parms;
 	F1293_Parms.bioWorld = bioWorld;
@@ -17642,10 +16874,9 @@ bool UBioAutoConditionals::F1293 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1292 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1292 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1292Ref { L"Function PlotManager.BioAutoConditionals.F1292", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1292 )
-		pFnF1292 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1292" );
+	UFunction* const pFnF1292 = pFnF1292Ref.Get ( );
 
 	UBioAutoConditionals_execF1292_Parms F1292_Parms;
 	F1292_Parms.bioWorld = bioWorld;
@@ -17665,10 +16896,9 @@ bool UBioAutoConditionals::F1292 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1291 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1291 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1291Ref { L"Function PlotManager.BioAutoConditionals.F1291", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1291 )
-		pFnF1291 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1291" );
+	UFunction* const pFnF1291 = pFnF1291Ref.Get ( );
 
 	UBioAutoConditionals_execF1291_Parms F1291_Parms;
 	F1291_Parms.bioWorld = bioWorld;
@@ -17688,10 +16918,9 @@ bool UBioAutoConditionals::F1291 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1290 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1290 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1290Ref { L"Function PlotManager.BioAutoConditionals.F1290", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1290 )
-		pFnF1290 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1290" );
+	UFunction* const pFnF1290 = pFnF1290Ref.Get ( );
 
 	UBioAutoConditionals_execF1290_Parms F1290_Parms;
 	F1290_Parms.bioWorld = bioWorld;
@@ -17711,10 +16940,9 @@ bool UBioAutoConditionals::F1290 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1287 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1287 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1287Ref { L"Function PlotManager.BioAutoConditionals.F1287", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1287 )
-		pFnF1287 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1287" );
+	UFunction* const pFnF1287 = pFnF1287Ref.Get ( );
 
 	UBioAutoConditionals_execF1287_Parms F1287_Parms;
 	F1287_Parms.bioWorld = bioWorld;
@@ -17734,10 +16962,9 @@ bool UBioAutoConditionals::F1287 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1286 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1286 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1286Ref { L"Function PlotManager.BioAutoConditionals.F1286", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1286 )
-		pFnF1286 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1286" );
+	UFunction* const pFnF1286 = pFnF1286Ref.Get ( );
 
 	UBioAutoConditionals_execF1286_Parms F1286_Parms;
 	F1286_Parms.bioWorld = bioWorld;
@@ -17757,10 +16984,9 @@ bool UBioAutoConditionals::F1286 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1285 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1285 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1285Ref { L"Function PlotManager.BioAutoConditionals.F1285", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1285 )
-		pFnF1285 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1285" );
+	UFunction* const pFnF1285 = pFnF1285Ref.Get ( );
 
 	UBioAutoConditionals_execF1285_Parms F1285_Parms;
 	F1285_Parms.bioWorld = bioWorld;
@@ -17780,10 +17006,9 @@ bool UBioAutoConditionals::F1285 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1284 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1284 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1284Ref { L"Function PlotManager.BioAutoConditionals.F1284", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1284 )
-		pFnF1284 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1284" );
+	UFunction* const pFnF1284 = pFnF1284Ref.Get ( );
 
 	UBioAutoConditionals_execF1284_Parms F1284_Parms;
 	F1284_Parms.bioWorld = bioWorld;
@@ -17803,10 +17028,9 @@ bool UBioAutoConditionals::F1284 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1283 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1283 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1283Ref { L"Function PlotManager.BioAutoConditionals.F1283", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1283 )
-		pFnF1283 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1283" );
+	UFunction* const pFnF1283 = pFnF1283Ref.Get ( );
 
 	UBioAutoConditionals_execF1283_Parms F1283_Parms;
 	F1283_Parms.bioWorld = bioWorld;
@@ -17826,10 +17050,9 @@ bool UBioAutoConditionals::F1283 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1282 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1282 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1282Ref { L"Function PlotManager.BioAutoConditionals.F1282", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1282 )
-		pFnF1282 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1282" );
+	UFunction* const pFnF1282 = pFnF1282Ref.Get ( );
 
 	UBioAutoConditionals_execF1282_Parms F1282_Parms;
 	F1282_Parms.bioWorld = bioWorld;
@@ -17849,10 +17072,9 @@ bool UBioAutoConditionals::F1282 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1281 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1281 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1281Ref { L"Function PlotManager.BioAutoConditionals.F1281", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1281 )
-		pFnF1281 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1281" );
+	UFunction* const pFnF1281 = pFnF1281Ref.Get ( );
 
 	UBioAutoConditionals_execF1281_Parms F1281_Parms;
 	F1281_Parms.bioWorld = bioWorld;
@@ -17872,10 +17094,9 @@ bool UBioAutoConditionals::F1281 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1280 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1280 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1280Ref { L"Function PlotManager.BioAutoConditionals.F1280", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1280 )
-		pFnF1280 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1280" );
+	UFunction* const pFnF1280 = pFnF1280Ref.Get ( );
 
 	UBioAutoConditionals_execF1280_Parms F1280_Parms;
 	F1280_Parms.bioWorld = bioWorld;
@@ -17895,10 +17116,9 @@ bool UBioAutoConditionals::F1280 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1279 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1279 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1279Ref { L"Function PlotManager.BioAutoConditionals.F1279", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1279 )
-		pFnF1279 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1279" );
+	UFunction* const pFnF1279 = pFnF1279Ref.Get ( );
 
 	UBioAutoConditionals_execF1279_Parms F1279_Parms;
 	F1279_Parms.bioWorld = bioWorld;
@@ -17918,10 +17138,9 @@ bool UBioAutoConditionals::F1279 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1278 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1278 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1278Ref { L"Function PlotManager.BioAutoConditionals.F1278", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1278 )
-		pFnF1278 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1278" );
+	UFunction* const pFnF1278 = pFnF1278Ref.Get ( );
 
 	UBioAutoConditionals_execF1278_Parms F1278_Parms;
 	F1278_Parms.bioWorld = bioWorld;
@@ -17941,10 +17160,9 @@ bool UBioAutoConditionals::F1278 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1237 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1237 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1237Ref { L"Function PlotManager.BioAutoConditionals.F1237", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1237 )
-		pFnF1237 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1237" );
+	UFunction* const pFnF1237 = pFnF1237Ref.Get ( );
 
 	UBioAutoConditionals_execF1237_Parms F1237_Parms;
 	F1237_Parms.bioWorld = bioWorld;
@@ -17964,10 +17182,9 @@ bool UBioAutoConditionals::F1237 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1119 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1119 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1119Ref { L"Function PlotManager.BioAutoConditionals.F1119", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1119 )
-		pFnF1119 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1119" );
+	UFunction* const pFnF1119 = pFnF1119Ref.Get ( );
 
 	UBioAutoConditionals_execF1119_Parms F1119_Parms;
 	F1119_Parms.bioWorld = bioWorld;
@@ -17987,10 +17204,9 @@ bool UBioAutoConditionals::F1119 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1118 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1118 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1118Ref { L"Function PlotManager.BioAutoConditionals.F1118", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1118 )
-		pFnF1118 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1118" );
+	UFunction* const pFnF1118 = pFnF1118Ref.Get ( );
 
 	UBioAutoConditionals_execF1118_Parms F1118_Parms;
 	F1118_Parms.bioWorld = bioWorld;
@@ -18010,10 +17226,9 @@ bool UBioAutoConditionals::F1118 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1571 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1571 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1571Ref { L"Function PlotManager.BioAutoConditionals.F1571", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1571 )
-		pFnF1571 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1571" );
+	UFunction* const pFnF1571 = pFnF1571Ref.Get ( );
 
 	UBioAutoConditionals_execF1571_Parms F1571_Parms;
 	F1571_Parms.bioWorld = bioWorld;
@@ -18033,10 +17248,9 @@ bool UBioAutoConditionals::F1571 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1570 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1570 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1570Ref { L"Function PlotManager.BioAutoConditionals.F1570", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1570 )
-		pFnF1570 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1570" );
+	UFunction* const pFnF1570 = pFnF1570Ref.Get ( );
 
 	UBioAutoConditionals_execF1570_Parms F1570_Parms;
 	F1570_Parms.bioWorld = bioWorld;
@@ -18056,10 +17270,9 @@ bool UBioAutoConditionals::F1570 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1569 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1569 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1569Ref { L"Function PlotManager.BioAutoConditionals.F1569", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1569 )
-		pFnF1569 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1569" );
+	UFunction* const pFnF1569 = pFnF1569Ref.Get ( );
 
 	UBioAutoConditionals_execF1569_Parms F1569_Parms;
 	F1569_Parms.bioWorld = bioWorld;
@@ -18079,10 +17292,9 @@ bool UBioAutoConditionals::F1569 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1117 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1117 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1117Ref { L"Function PlotManager.BioAutoConditionals.F1117", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1117 )
-		pFnF1117 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1117" );
+	UFunction* const pFnF1117 = pFnF1117Ref.Get ( );
 
 	UBioAutoConditionals_execF1117_Parms F1117_Parms;
 	F1117_Parms.bioWorld = bioWorld;
@@ -18102,10 +17314,9 @@ bool UBioAutoConditionals::F1117 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1116 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1116 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1116Ref { L"Function PlotManager.BioAutoConditionals.F1116", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1116 )
-		pFnF1116 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1116" );
+	UFunction* const pFnF1116 = pFnF1116Ref.Get ( );
 
 	UBioAutoConditionals_execF1116_Parms F1116_Parms;
 	F1116_Parms.bioWorld = bioWorld;
@@ -18125,10 +17336,9 @@ bool UBioAutoConditionals::F1116 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1115 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1115 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1115Ref { L"Function PlotManager.BioAutoConditionals.F1115", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1115 )
-		pFnF1115 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1115" );
+	UFunction* const pFnF1115 = pFnF1115Ref.Get ( );
 
 	UBioAutoConditionals_execF1115_Parms F1115_Parms;
 	F1115_Parms.bioWorld = bioWorld;
@@ -18148,10 +17358,9 @@ bool UBioAutoConditionals::F1115 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1114 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1114 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1114Ref { L"Function PlotManager.BioAutoConditionals.F1114", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1114 )
-		pFnF1114 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1114" );
+	UFunction* const pFnF1114 = pFnF1114Ref.Get ( );
 
 	UBioAutoConditionals_execF1114_Parms F1114_Parms;
 	F1114_Parms.bioWorld = bioWorld;
@@ -18171,10 +17380,9 @@ bool UBioAutoConditionals::F1114 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1111 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1111 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1111Ref { L"Function PlotManager.BioAutoConditionals.F1111", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1111 )
-		pFnF1111 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1111" );
+	UFunction* const pFnF1111 = pFnF1111Ref.Get ( );
 
 	UBioAutoConditionals_execF1111_Parms F1111_Parms;
 	F1111_Parms.bioWorld = bioWorld;
@@ -18194,10 +17402,9 @@ bool UBioAutoConditionals::F1111 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1110 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1110 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1110Ref { L"Function PlotManager.BioAutoConditionals.F1110", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1110 )
-		pFnF1110 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1110" );
+	UFunction* const pFnF1110 = pFnF1110Ref.Get ( );
 
 	UBioAutoConditionals_execF1110_Parms F1110_Parms;
 	F1110_Parms.bioWorld = bioWorld;
@@ -18217,10 +17424,9 @@ bool UBioAutoConditionals::F1110 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1109 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1109 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1109Ref { L"Function PlotManager.BioAutoConditionals.F1109", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1109 )
-		pFnF1109 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1109" );
+	UFunction* const pFnF1109 = pFnF1109Ref.Get ( );
 
 	UBioAutoConditionals_execF1109_Parms F1109_Parms;
 	F1109_Parms.bioWorld = bioWorld;
@@ -18240,10 +17446,9 @@ bool UBioAutoConditionals::F1109 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1108 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1108 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1108Ref { L"Function PlotManager.BioAutoConditionals.F1108", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1108 )
-		pFnF1108 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1108" );
+	UFunction* const pFnF1108 = pFnF1108Ref.Get ( );
 
 	UBioAutoConditionals_execF1108_Parms F1108_Parms;
 	F1108_Parms.bioWorld = bioWorld;
@@ -18263,10 +17468,9 @@ bool UBioAutoConditionals::F1108 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1107 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1107 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1107Ref { L"Function PlotManager.BioAutoConditionals.F1107", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1107 )
-		pFnF1107 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1107" );
+	UFunction* const pFnF1107 = pFnF1107Ref.Get ( );
 
 	UBioAutoConditionals_execF1107_Parms F1107_Parms;
 	F1107_Parms.bioWorld = bioWorld;
@@ -18286,10 +17490,9 @@ bool UBioAutoConditionals::F1107 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1106 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1106 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1106Ref { L"Function PlotManager.BioAutoConditionals.F1106", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1106 )
-		pFnF1106 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1106" );
+	UFunction* const pFnF1106 = pFnF1106Ref.Get ( );
 
 	UBioAutoConditionals_execF1106_Parms F1106_Parms;
 	F1106_Parms.bioWorld = bioWorld;
@@ -18309,10 +17512,9 @@ bool UBioAutoConditionals::F1106 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1105 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1105 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1105Ref { L"Function PlotManager.BioAutoConditionals.F1105", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1105 )
-		pFnF1105 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1105" );
+	UFunction* const pFnF1105 = pFnF1105Ref.Get ( );
 
 	UBioAutoConditionals_execF1105_Parms F1105_Parms;
 	F1105_Parms.bioWorld = bioWorld;
@@ -18332,10 +17534,9 @@ bool UBioAutoConditionals::F1105 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1104 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1104 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1104Ref { L"Function PlotManager.BioAutoConditionals.F1104", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1104 )
-		pFnF1104 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1104" );
+	UFunction* const pFnF1104 = pFnF1104Ref.Get ( );
 
 	UBioAutoConditionals_execF1104_Parms F1104_Parms;
 	F1104_Parms.bioWorld = bioWorld;
@@ -18355,10 +17556,9 @@ bool UBioAutoConditionals::F1104 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1103 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1103 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1103Ref { L"Function PlotManager.BioAutoConditionals.F1103", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1103 )
-		pFnF1103 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1103" );
+	UFunction* const pFnF1103 = pFnF1103Ref.Get ( );
 
 	UBioAutoConditionals_execF1103_Parms F1103_Parms;
 	F1103_Parms.bioWorld = bioWorld;
@@ -18378,10 +17578,9 @@ bool UBioAutoConditionals::F1103 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1102 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1102 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1102Ref { L"Function PlotManager.BioAutoConditionals.F1102", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1102 )
-		pFnF1102 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1102" );
+	UFunction* const pFnF1102 = pFnF1102Ref.Get ( );
 
 	UBioAutoConditionals_execF1102_Parms F1102_Parms;
 	F1102_Parms.bioWorld = bioWorld;
@@ -18401,10 +17600,9 @@ bool UBioAutoConditionals::F1102 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1044 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1044 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1044Ref { L"Function PlotManager.BioAutoConditionals.F1044", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1044 )
-		pFnF1044 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1044" );
+	UFunction* const pFnF1044 = pFnF1044Ref.Get ( );
 
 	UBioAutoConditionals_execF1044_Parms F1044_Parms;
 	F1044_Parms.bioWorld = bioWorld;
@@ -18424,10 +17622,9 @@ bool UBioAutoConditionals::F1044 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1060 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1060 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1060Ref { L"Function PlotManager.BioAutoConditionals.F1060", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1060 )
-		pFnF1060 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1060" );
+	UFunction* const pFnF1060 = pFnF1060Ref.Get ( );
 
 	UBioAutoConditionals_execF1060_Parms F1060_Parms;
 	F1060_Parms.bioWorld = bioWorld;
@@ -18447,10 +17644,9 @@ bool UBioAutoConditionals::F1060 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F739 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF739 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF739Ref { L"Function PlotManager.BioAutoConditionals.F739", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF739 )
-		pFnF739 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F739" );
+	UFunction* const pFnF739 = pFnF739Ref.Get ( );
 
 	UBioAutoConditionals_execF739_Parms F739_Parms;
 	F739_Parms.bioWorld = bioWorld;
@@ -18470,10 +17666,9 @@ bool UBioAutoConditionals::F739 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F738 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF738 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF738Ref { L"Function PlotManager.BioAutoConditionals.F738", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF738 )
-		pFnF738 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F738" );
+	UFunction* const pFnF738 = pFnF738Ref.Get ( );
 
 	UBioAutoConditionals_execF738_Parms F738_Parms;
 	F738_Parms.bioWorld = bioWorld;
@@ -18493,10 +17688,9 @@ bool UBioAutoConditionals::F738 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F737 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF737 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF737Ref { L"Function PlotManager.BioAutoConditionals.F737", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF737 )
-		pFnF737 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F737" );
+	UFunction* const pFnF737 = pFnF737Ref.Get ( );
 
 	UBioAutoConditionals_execF737_Parms F737_Parms;
 	F737_Parms.bioWorld = bioWorld;
@@ -18516,10 +17710,9 @@ bool UBioAutoConditionals::F737 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F736 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF736 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF736Ref { L"Function PlotManager.BioAutoConditionals.F736", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF736 )
-		pFnF736 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F736" );
+	UFunction* const pFnF736 = pFnF736Ref.Get ( );
 
 	UBioAutoConditionals_execF736_Parms F736_Parms;
 	F736_Parms.bioWorld = bioWorld;
@@ -18539,10 +17732,9 @@ bool UBioAutoConditionals::F736 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F388 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF388 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF388Ref { L"Function PlotManager.BioAutoConditionals.F388", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF388 )
-		pFnF388 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F388" );
+	UFunction* const pFnF388 = pFnF388Ref.Get ( );
 
 	UBioAutoConditionals_execF388_Parms F388_Parms;
 	F388_Parms.bioWorld = bioWorld;
@@ -18562,10 +17754,9 @@ bool UBioAutoConditionals::F388 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F387 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF387 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF387Ref { L"Function PlotManager.BioAutoConditionals.F387", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF387 )
-		pFnF387 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F387" );
+	UFunction* const pFnF387 = pFnF387Ref.Get ( );
 
 	UBioAutoConditionals_execF387_Parms F387_Parms;
 	F387_Parms.bioWorld = bioWorld;
@@ -18585,10 +17776,9 @@ bool UBioAutoConditionals::F387 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F386 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF386 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF386Ref { L"Function PlotManager.BioAutoConditionals.F386", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF386 )
-		pFnF386 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F386" );
+	UFunction* const pFnF386 = pFnF386Ref.Get ( );
 
 	UBioAutoConditionals_execF386_Parms F386_Parms;
 	F386_Parms.bioWorld = bioWorld;
@@ -18608,10 +17798,9 @@ bool UBioAutoConditionals::F386 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F385 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF385 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF385Ref { L"Function PlotManager.BioAutoConditionals.F385", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF385 )
-		pFnF385 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F385" );
+	UFunction* const pFnF385 = pFnF385Ref.Get ( );
 
 	UBioAutoConditionals_execF385_Parms F385_Parms;
 	F385_Parms.bioWorld = bioWorld;
@@ -18631,10 +17820,9 @@ bool UBioAutoConditionals::F385 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F384 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF384 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF384Ref { L"Function PlotManager.BioAutoConditionals.F384", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF384 )
-		pFnF384 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F384" );
+	UFunction* const pFnF384 = pFnF384Ref.Get ( );
 
 	UBioAutoConditionals_execF384_Parms F384_Parms;
 	F384_Parms.bioWorld = bioWorld;
@@ -18654,10 +17842,9 @@ bool UBioAutoConditionals::F384 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F383 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF383 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF383Ref { L"Function PlotManager.BioAutoConditionals.F383", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF383 )
-		pFnF383 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F383" );
+	UFunction* const pFnF383 = pFnF383Ref.Get ( );
 
 	UBioAutoConditionals_execF383_Parms F383_Parms;
 	F383_Parms.bioWorld = bioWorld;
@@ -18677,10 +17864,9 @@ bool UBioAutoConditionals::F383 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F382 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF382 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF382Ref { L"Function PlotManager.BioAutoConditionals.F382", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF382 )
-		pFnF382 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F382" );
+	UFunction* const pFnF382 = pFnF382Ref.Get ( );
 
 	UBioAutoConditionals_execF382_Parms F382_Parms;
 	F382_Parms.bioWorld = bioWorld;
@@ -18700,10 +17886,9 @@ bool UBioAutoConditionals::F382 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F381 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF381 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF381Ref { L"Function PlotManager.BioAutoConditionals.F381", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF381 )
-		pFnF381 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F381" );
+	UFunction* const pFnF381 = pFnF381Ref.Get ( );
 
 	UBioAutoConditionals_execF381_Parms F381_Parms;
 	F381_Parms.bioWorld = bioWorld;
@@ -18723,10 +17908,9 @@ bool UBioAutoConditionals::F381 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F380 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF380 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF380Ref { L"Function PlotManager.BioAutoConditionals.F380", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF380 )
-		pFnF380 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F380" );
+	UFunction* const pFnF380 = pFnF380Ref.Get ( );
 
 	UBioAutoConditionals_execF380_Parms F380_Parms;
 	F380_Parms.bioWorld = bioWorld;
@@ -18746,10 +17930,9 @@ bool UBioAutoConditionals::F380 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F379 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF379 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF379Ref { L"Function PlotManager.BioAutoConditionals.F379", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF379 )
-		pFnF379 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F379" );
+	UFunction* const pFnF379 = pFnF379Ref.Get ( );
 
 	UBioAutoConditionals_execF379_Parms F379_Parms;
 	F379_Parms.bioWorld = bioWorld;
@@ -18769,10 +17952,9 @@ bool UBioAutoConditionals::F379 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F378 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF378 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF378Ref { L"Function PlotManager.BioAutoConditionals.F378", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF378 )
-		pFnF378 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F378" );
+	UFunction* const pFnF378 = pFnF378Ref.Get ( );
 
 	UBioAutoConditionals_execF378_Parms F378_Parms;
 	F378_Parms.bioWorld = bioWorld;
@@ -18792,10 +17974,9 @@ bool UBioAutoConditionals::F378 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F377 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF377 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF377Ref { L"Function PlotManager.BioAutoConditionals.F377", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF377 )
-		pFnF377 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F377" );
+	UFunction* const pFnF377 = pFnF377Ref.Get ( );
 
 	UBioAutoConditionals_execF377_Parms F377_Parms;
 	F377_Parms.bioWorld = bioWorld;
@@ -18815,10 +17996,9 @@ bool UBioAutoConditionals::F377 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F240 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF240 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF240Ref { L"Function PlotManager.BioAutoConditionals.F240", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF240 )
-		pFnF240 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F240" );
+	UFunction* const pFnF240 = pFnF240Ref.Get ( );
 
 	UBioAutoConditionals_execF240_Parms F240_Parms;
 	F240_Parms.bioWorld = bioWorld;
@@ -18838,10 +18018,9 @@ bool UBioAutoConditionals::F240 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F239 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF239 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF239Ref { L"Function PlotManager.BioAutoConditionals.F239", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF239 )
-		pFnF239 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F239" );
+	UFunction* const pFnF239 = pFnF239Ref.Get ( );
 
 	UBioAutoConditionals_execF239_Parms F239_Parms;
 	F239_Parms.bioWorld = bioWorld;
@@ -18861,10 +18040,9 @@ bool UBioAutoConditionals::F239 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F222 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF222 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF222Ref { L"Function PlotManager.BioAutoConditionals.F222", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF222 )
-		pFnF222 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F222" );
+	UFunction* const pFnF222 = pFnF222Ref.Get ( );
 
 	UBioAutoConditionals_execF222_Parms F222_Parms;
 	F222_Parms.bioWorld = bioWorld;
@@ -18884,10 +18062,9 @@ bool UBioAutoConditionals::F222 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F221 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF221 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF221Ref { L"Function PlotManager.BioAutoConditionals.F221", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF221 )
-		pFnF221 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F221" );
+	UFunction* const pFnF221 = pFnF221Ref.Get ( );
 
 	UBioAutoConditionals_execF221_Parms F221_Parms;
 	F221_Parms.bioWorld = bioWorld;
@@ -18907,10 +18084,9 @@ bool UBioAutoConditionals::F221 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F220 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF220 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF220Ref { L"Function PlotManager.BioAutoConditionals.F220", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF220 )
-		pFnF220 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F220" );
+	UFunction* const pFnF220 = pFnF220Ref.Get ( );
 
 	UBioAutoConditionals_execF220_Parms F220_Parms;
 	F220_Parms.bioWorld = bioWorld;
@@ -18930,10 +18106,9 @@ bool UBioAutoConditionals::F220 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F219 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF219 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF219Ref { L"Function PlotManager.BioAutoConditionals.F219", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF219 )
-		pFnF219 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F219" );
+	UFunction* const pFnF219 = pFnF219Ref.Get ( );
 
 	UBioAutoConditionals_execF219_Parms F219_Parms;
 	F219_Parms.bioWorld = bioWorld;
@@ -18953,10 +18128,9 @@ bool UBioAutoConditionals::F219 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F218 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF218 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF218Ref { L"Function PlotManager.BioAutoConditionals.F218", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF218 )
-		pFnF218 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F218" );
+	UFunction* const pFnF218 = pFnF218Ref.Get ( );
 
 	UBioAutoConditionals_execF218_Parms F218_Parms;
 	F218_Parms.bioWorld = bioWorld;
@@ -18976,10 +18150,9 @@ bool UBioAutoConditionals::F218 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F217 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF217 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF217Ref { L"Function PlotManager.BioAutoConditionals.F217", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF217 )
-		pFnF217 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F217" );
+	UFunction* const pFnF217 = pFnF217Ref.Get ( );
 
 	UBioAutoConditionals_execF217_Parms F217_Parms;
 	F217_Parms.bioWorld = bioWorld;
@@ -18999,10 +18172,9 @@ bool UBioAutoConditionals::F217 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F216 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF216 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF216Ref { L"Function PlotManager.BioAutoConditionals.F216", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF216 )
-		pFnF216 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F216" );
+	UFunction* const pFnF216 = pFnF216Ref.Get ( );
 
 	UBioAutoConditionals_execF216_Parms F216_Parms;
 	F216_Parms.bioWorld = bioWorld;
@@ -19022,10 +18194,9 @@ bool UBioAutoConditionals::F216 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F215 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF215 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF215Ref { L"Function PlotManager.BioAutoConditionals.F215", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF215 )
-		pFnF215 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F215" );
+	UFunction* const pFnF215 = pFnF215Ref.Get ( );
 
 	UBioAutoConditionals_execF215_Parms F215_Parms;
 	F215_Parms.bioWorld = bioWorld;
@@ -19045,10 +18216,9 @@ bool UBioAutoConditionals::F215 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F214 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF214 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF214Ref { L"Function PlotManager.BioAutoConditionals.F214", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF214 )
-		pFnF214 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F214" );
+	UFunction* const pFnF214 = pFnF214Ref.Get ( );
 
 	UBioAutoConditionals_execF214_Parms F214_Parms;
 	F214_Parms.bioWorld = bioWorld;
@@ -19068,10 +18238,9 @@ bool UBioAutoConditionals::F214 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F213 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF213 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF213Ref { L"Function PlotManager.BioAutoConditionals.F213", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF213 )
-		pFnF213 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F213" );
+	UFunction* const pFnF213 = pFnF213Ref.Get ( );
 
 	UBioAutoConditionals_execF213_Parms F213_Parms;
 	F213_Parms.bioWorld = bioWorld;
@@ -19091,10 +18260,9 @@ bool UBioAutoConditionals::F213 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F212 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF212 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF212Ref { L"Function PlotManager.BioAutoConditionals.F212", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF212 )
-		pFnF212 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F212" );
+	UFunction* const pFnF212 = pFnF212Ref.Get ( );
 
 	UBioAutoConditionals_execF212_Parms F212_Parms;
 	F212_Parms.bioWorld = bioWorld;
@@ -19114,10 +18282,9 @@ bool UBioAutoConditionals::F212 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F211 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF211 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF211Ref { L"Function PlotManager.BioAutoConditionals.F211", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF211 )
-		pFnF211 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F211" );
+	UFunction* const pFnF211 = pFnF211Ref.Get ( );
 
 	UBioAutoConditionals_execF211_Parms F211_Parms;
 	F211_Parms.bioWorld = bioWorld;
@@ -19137,10 +18304,9 @@ bool UBioAutoConditionals::F211 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F209 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF209 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF209Ref { L"Function PlotManager.BioAutoConditionals.F209", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF209 )
-		pFnF209 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F209" );
+	UFunction* const pFnF209 = pFnF209Ref.Get ( );
 
 	UBioAutoConditionals_execF209_Parms F209_Parms;
 	F209_Parms.bioWorld = bioWorld;
@@ -19160,10 +18326,9 @@ bool UBioAutoConditionals::F209 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F208 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF208 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF208Ref { L"Function PlotManager.BioAutoConditionals.F208", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF208 )
-		pFnF208 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F208" );
+	UFunction* const pFnF208 = pFnF208Ref.Get ( );
 
 	UBioAutoConditionals_execF208_Parms F208_Parms;
 	F208_Parms.bioWorld = bioWorld;
@@ -19183,10 +18348,9 @@ bool UBioAutoConditionals::F208 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F207 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF207 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF207Ref { L"Function PlotManager.BioAutoConditionals.F207", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF207 )
-		pFnF207 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F207" );
+	UFunction* const pFnF207 = pFnF207Ref.Get ( );
 
 	UBioAutoConditionals_execF207_Parms F207_Parms;
 	F207_Parms.bioWorld = bioWorld;
@@ -19206,10 +18370,9 @@ bool UBioAutoConditionals::F207 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F206 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF206 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF206Ref { L"Function PlotManager.BioAutoConditionals.F206", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF206 )
-		pFnF206 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F206" );
+	UFunction* const pFnF206 = pFnF206Ref.Get ( );
 
 	UBioAutoConditionals_execF206_Parms F206_Parms;
 	F206_Parms.bioWorld = bioWorld;
@@ -19229,10 +18392,9 @@ bool UBioAutoConditionals::F206 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F205 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF205 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF205Ref { L"Function PlotManager.BioAutoConditionals.F205", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF205 )
-		pFnF205 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F205" );
+	UFunction* const pFnF205 = pFnF205Ref.Get ( );
 
 	UBioAutoConditionals_execF205_Parms F205_Parms;
 	F205_Parms.bioWorld = bioWorld;
@@ -19252,10 +18414,9 @@ bool UBioAutoConditionals::F205 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F204 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF204 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF204Ref { L"Function PlotManager.BioAutoConditionals.F204", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF204 )
-		pFnF204 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F204" );
+	UFunction* const pFnF204 = pFnF204Ref.Get ( );
 
 	UBioAutoConditionals_execF204_Parms F204_Parms;
 	F204_Parms.bioWorld = bioWorld;
@@ -19275,10 +18436,9 @@ bool UBioAutoConditionals::F204 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F203 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF203 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF203Ref { L"Function PlotManager.BioAutoConditionals.F203", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF203 )
-		pFnF203 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F203" );
+	UFunction* const pFnF203 = pFnF203Ref.Get ( );
 
 	UBioAutoConditionals_execF203_Parms F203_Parms;
 	F203_Parms.bioWorld = bioWorld;
@@ -19298,10 +18458,9 @@ bool UBioAutoConditionals::F203 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F202 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF202 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF202Ref { L"Function PlotManager.BioAutoConditionals.F202", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF202 )
-		pFnF202 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F202" );
+	UFunction* const pFnF202 = pFnF202Ref.Get ( );
 
 	UBioAutoConditionals_execF202_Parms F202_Parms;
 	F202_Parms.bioWorld = bioWorld;
@@ -19321,10 +18480,9 @@ bool UBioAutoConditionals::F202 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F201 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF201 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF201Ref { L"Function PlotManager.BioAutoConditionals.F201", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF201 )
-		pFnF201 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F201" );
+	UFunction* const pFnF201 = pFnF201Ref.Get ( );
 
 	UBioAutoConditionals_execF201_Parms F201_Parms;
 	F201_Parms.bioWorld = bioWorld;
@@ -19344,10 +18502,9 @@ bool UBioAutoConditionals::F201 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F200 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF200 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF200Ref { L"Function PlotManager.BioAutoConditionals.F200", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF200 )
-		pFnF200 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F200" );
+	UFunction* const pFnF200 = pFnF200Ref.Get ( );
 
 	UBioAutoConditionals_execF200_Parms F200_Parms;
 	F200_Parms.bioWorld = bioWorld;
@@ -19367,10 +18524,9 @@ bool UBioAutoConditionals::F200 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F199 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF199 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF199Ref { L"Function PlotManager.BioAutoConditionals.F199", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF199 )
-		pFnF199 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F199" );
+	UFunction* const pFnF199 = pFnF199Ref.Get ( );
 
 	UBioAutoConditionals_execF199_Parms F199_Parms;
 	F199_Parms.bioWorld = bioWorld;
@@ -19390,10 +18546,9 @@ bool UBioAutoConditionals::F199 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F198 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF198 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF198Ref { L"Function PlotManager.BioAutoConditionals.F198", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF198 )
-		pFnF198 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F198" );
+	UFunction* const pFnF198 = pFnF198Ref.Get ( );
 
 	UBioAutoConditionals_execF198_Parms F198_Parms;
 	F198_Parms.bioWorld = bioWorld;
@@ -19413,10 +18568,9 @@ bool UBioAutoConditionals::F198 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F234 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF234 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF234Ref { L"Function PlotManager.BioAutoConditionals.F234", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF234 )
-		pFnF234 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F234" );
+	UFunction* const pFnF234 = pFnF234Ref.Get ( );
 
 	UBioAutoConditionals_execF234_Parms F234_Parms;
 	F234_Parms.bioWorld = bioWorld;
@@ -19436,10 +18590,9 @@ bool UBioAutoConditionals::F234 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F233 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF233 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF233Ref { L"Function PlotManager.BioAutoConditionals.F233", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF233 )
-		pFnF233 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F233" );
+	UFunction* const pFnF233 = pFnF233Ref.Get ( );
 
 	UBioAutoConditionals_execF233_Parms F233_Parms;
 	F233_Parms.bioWorld = bioWorld;
@@ -19459,10 +18612,9 @@ bool UBioAutoConditionals::F233 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F232 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF232 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF232Ref { L"Function PlotManager.BioAutoConditionals.F232", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF232 )
-		pFnF232 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F232" );
+	UFunction* const pFnF232 = pFnF232Ref.Get ( );
 
 	UBioAutoConditionals_execF232_Parms F232_Parms;
 	F232_Parms.bioWorld = bioWorld;
@@ -19482,10 +18634,9 @@ bool UBioAutoConditionals::F232 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F231 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF231 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF231Ref { L"Function PlotManager.BioAutoConditionals.F231", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF231 )
-		pFnF231 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F231" );
+	UFunction* const pFnF231 = pFnF231Ref.Get ( );
 
 	UBioAutoConditionals_execF231_Parms F231_Parms;
 	F231_Parms.bioWorld = bioWorld;
@@ -19505,10 +18656,9 @@ bool UBioAutoConditionals::F231 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F230 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF230 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF230Ref { L"Function PlotManager.BioAutoConditionals.F230", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF230 )
-		pFnF230 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F230" );
+	UFunction* const pFnF230 = pFnF230Ref.Get ( );
 
 	UBioAutoConditionals_execF230_Parms F230_Parms;
 	F230_Parms.bioWorld = bioWorld;
@@ -19528,10 +18678,9 @@ bool UBioAutoConditionals::F230 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F229 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF229 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF229Ref { L"Function PlotManager.BioAutoConditionals.F229", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF229 )
-		pFnF229 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F229" );
+	UFunction* const pFnF229 = pFnF229Ref.Get ( );
 
 	UBioAutoConditionals_execF229_Parms F229_Parms;
 	F229_Parms.bioWorld = bioWorld;
@@ -19551,10 +18700,9 @@ bool UBioAutoConditionals::F229 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F228 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF228 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF228Ref { L"Function PlotManager.BioAutoConditionals.F228", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF228 )
-		pFnF228 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F228" );
+	UFunction* const pFnF228 = pFnF228Ref.Get ( );
 
 	UBioAutoConditionals_execF228_Parms F228_Parms;
 	F228_Parms.bioWorld = bioWorld;
@@ -19574,10 +18722,9 @@ bool UBioAutoConditionals::F228 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F227 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF227 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF227Ref { L"Function PlotManager.BioAutoConditionals.F227", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF227 )
-		pFnF227 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F227" );
+	UFunction* const pFnF227 = pFnF227Ref.Get ( );
 
 	UBioAutoConditionals_execF227_Parms F227_Parms;
 	F227_Parms.bioWorld = bioWorld;
@@ -19597,10 +18744,9 @@ bool UBioAutoConditionals::F227 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F226 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF226 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF226Ref { L"Function PlotManager.BioAutoConditionals.F226", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF226 )
-		pFnF226 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F226" );
+	UFunction* const pFnF226 = pFnF226Ref.Get ( );
 
 	UBioAutoConditionals_execF226_Parms F226_Parms;
 	F226_Parms.bioWorld = bioWorld;
@@ -19620,10 +18766,9 @@ bool UBioAutoConditionals::F226 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F225 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF225 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF225Ref { L"Function PlotManager.BioAutoConditionals.F225", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF225 )
-		pFnF225 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F225" );
+	UFunction* const pFnF225 = pFnF225Ref.Get ( );
 
 	UBioAutoConditionals_execF225_Parms F225_Parms;
 	F225_Parms.bioWorld = bioWorld;
@@ -19643,10 +18788,9 @@ bool UBioAutoConditionals::F225 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F224 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF224 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF224Ref { L"Function PlotManager.BioAutoConditionals.F224", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF224 )
-		pFnF224 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F224" );
+	UFunction* const pFnF224 = pFnF224Ref.Get ( );
 
 	UBioAutoConditionals_execF224_Parms F224_Parms;
 	F224_Parms.bioWorld = bioWorld;
@@ -19666,10 +18810,9 @@ bool UBioAutoConditionals::F224 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F223 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF223 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF223Ref { L"Function PlotManager.BioAutoConditionals.F223", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF223 )
-		pFnF223 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F223" );
+	UFunction* const pFnF223 = pFnF223Ref.Get ( );
 
 	UBioAutoConditionals_execF223_Parms F223_Parms;
 	F223_Parms.bioWorld = bioWorld;
@@ -19689,10 +18832,9 @@ bool UBioAutoConditionals::F223 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1303 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1303 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1303Ref { L"Function PlotManager.BioAutoConditionals.F1303", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1303 )
-		pFnF1303 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1303" );
+	UFunction* const pFnF1303 = pFnF1303Ref.Get ( );
 
 	UBioAutoConditionals_execF1303_Parms F1303_Parms;
 	F1303_Parms.bioWorld = bioWorld;
@@ -19712,10 +18854,9 @@ bool UBioAutoConditionals::F1303 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1302 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1302 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1302Ref { L"Function PlotManager.BioAutoConditionals.F1302", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1302 )
-		pFnF1302 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1302" );
+	UFunction* const pFnF1302 = pFnF1302Ref.Get ( );
 
 	UBioAutoConditionals_execF1302_Parms F1302_Parms;
 	F1302_Parms.bioWorld = bioWorld;
@@ -19735,10 +18876,9 @@ bool UBioAutoConditionals::F1302 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F365 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF365 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF365Ref { L"Function PlotManager.BioAutoConditionals.F365", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF365 )
-		pFnF365 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F365" );
+	UFunction* const pFnF365 = pFnF365Ref.Get ( );
 
 	UBioAutoConditionals_execF365_Parms F365_Parms;
 	F365_Parms.bioWorld = bioWorld;
@@ -19758,10 +18898,9 @@ bool UBioAutoConditionals::F365 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F364 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF364 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF364Ref { L"Function PlotManager.BioAutoConditionals.F364", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF364 )
-		pFnF364 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F364" );
+	UFunction* const pFnF364 = pFnF364Ref.Get ( );
 
 	UBioAutoConditionals_execF364_Parms F364_Parms;
 	F364_Parms.bioWorld = bioWorld;
@@ -19781,10 +18920,9 @@ bool UBioAutoConditionals::F364 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F363 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF363 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF363Ref { L"Function PlotManager.BioAutoConditionals.F363", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF363 )
-		pFnF363 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F363" );
+	UFunction* const pFnF363 = pFnF363Ref.Get ( );
 
 	UBioAutoConditionals_execF363_Parms F363_Parms;
 	F363_Parms.bioWorld = bioWorld;
@@ -19804,10 +18942,9 @@ bool UBioAutoConditionals::F363 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F362 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF362 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF362Ref { L"Function PlotManager.BioAutoConditionals.F362", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF362 )
-		pFnF362 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F362" );
+	UFunction* const pFnF362 = pFnF362Ref.Get ( );
 
 	UBioAutoConditionals_execF362_Parms F362_Parms;
 	F362_Parms.bioWorld = bioWorld;
@@ -19827,10 +18964,9 @@ bool UBioAutoConditionals::F362 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F361 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF361 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF361Ref { L"Function PlotManager.BioAutoConditionals.F361", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF361 )
-		pFnF361 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F361" );
+	UFunction* const pFnF361 = pFnF361Ref.Get ( );
 
 	UBioAutoConditionals_execF361_Parms F361_Parms;
 	F361_Parms.bioWorld = bioWorld;
@@ -19850,10 +18986,9 @@ bool UBioAutoConditionals::F361 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F360 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF360 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF360Ref { L"Function PlotManager.BioAutoConditionals.F360", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF360 )
-		pFnF360 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F360" );
+	UFunction* const pFnF360 = pFnF360Ref.Get ( );
 
 	UBioAutoConditionals_execF360_Parms F360_Parms;
 	F360_Parms.bioWorld = bioWorld;
@@ -19873,10 +19008,9 @@ bool UBioAutoConditionals::F360 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F359 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF359 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF359Ref { L"Function PlotManager.BioAutoConditionals.F359", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF359 )
-		pFnF359 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F359" );
+	UFunction* const pFnF359 = pFnF359Ref.Get ( );
 
 	UBioAutoConditionals_execF359_Parms F359_Parms;
 	F359_Parms.bioWorld = bioWorld;
@@ -19896,10 +19030,9 @@ bool UBioAutoConditionals::F359 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F358 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF358 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF358Ref { L"Function PlotManager.BioAutoConditionals.F358", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF358 )
-		pFnF358 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F358" );
+	UFunction* const pFnF358 = pFnF358Ref.Get ( );
 
 	UBioAutoConditionals_execF358_Parms F358_Parms;
 	F358_Parms.bioWorld = bioWorld;
@@ -19919,10 +19052,9 @@ bool UBioAutoConditionals::F358 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F357 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF357 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF357Ref { L"Function PlotManager.BioAutoConditionals.F357", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF357 )
-		pFnF357 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F357" );
+	UFunction* const pFnF357 = pFnF357Ref.Get ( );
 
 	UBioAutoConditionals_execF357_Parms F357_Parms;
 	F357_Parms.bioWorld = bioWorld;
@@ -19942,10 +19074,9 @@ bool UBioAutoConditionals::F357 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F354 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF354 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF354Ref { L"Function PlotManager.BioAutoConditionals.F354", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF354 )
-		pFnF354 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F354" );
+	UFunction* const pFnF354 = pFnF354Ref.Get ( );
 
 	UBioAutoConditionals_execF354_Parms F354_Parms;
 	F354_Parms.bioWorld = bioWorld;
@@ -19965,10 +19096,9 @@ bool UBioAutoConditionals::F354 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F353 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF353 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF353Ref { L"Function PlotManager.BioAutoConditionals.F353", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF353 )
-		pFnF353 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F353" );
+	UFunction* const pFnF353 = pFnF353Ref.Get ( );
 
 	UBioAutoConditionals_execF353_Parms F353_Parms;
 	F353_Parms.bioWorld = bioWorld;
@@ -19988,10 +19118,9 @@ bool UBioAutoConditionals::F353 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F352 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF352 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF352Ref { L"Function PlotManager.BioAutoConditionals.F352", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF352 )
-		pFnF352 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F352" );
+	UFunction* const pFnF352 = pFnF352Ref.Get ( );
 
 	UBioAutoConditionals_execF352_Parms F352_Parms;
 	F352_Parms.bioWorld = bioWorld;
@@ -20011,10 +19140,9 @@ bool UBioAutoConditionals::F352 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1533 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1533 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1533Ref { L"Function PlotManager.BioAutoConditionals.F1533", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1533 )
-		pFnF1533 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1533" );
+	UFunction* const pFnF1533 = pFnF1533Ref.Get ( );
 
 	UBioAutoConditionals_execF1533_Parms F1533_Parms;
 	F1533_Parms.bioWorld = bioWorld;
@@ -20034,10 +19162,9 @@ bool UBioAutoConditionals::F1533 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1602 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1602 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1602Ref { L"Function PlotManager.BioAutoConditionals.F1602", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1602 )
-		pFnF1602 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1602" );
+	UFunction* const pFnF1602 = pFnF1602Ref.Get ( );
 
 	UBioAutoConditionals_execF1602_Parms F1602_Parms;
 	F1602_Parms.bioWorld = bioWorld;
@@ -20057,10 +19184,9 @@ bool UBioAutoConditionals::F1602 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1581 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1581 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1581Ref { L"Function PlotManager.BioAutoConditionals.F1581", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1581 )
-		pFnF1581 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1581" );
+	UFunction* const pFnF1581 = pFnF1581Ref.Get ( );
 
 	UBioAutoConditionals_execF1581_Parms F1581_Parms;
 	F1581_Parms.bioWorld = bioWorld;
@@ -20080,10 +19206,9 @@ bool UBioAutoConditionals::F1581 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F735 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF735 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF735Ref { L"Function PlotManager.BioAutoConditionals.F735", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF735 )
-		pFnF735 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F735" );
+	UFunction* const pFnF735 = pFnF735Ref.Get ( );
 
 	UBioAutoConditionals_execF735_Parms F735_Parms;
 	F735_Parms.bioWorld = bioWorld;
@@ -20103,10 +19228,9 @@ bool UBioAutoConditionals::F735 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F881 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF881 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF881Ref { L"Function PlotManager.BioAutoConditionals.F881", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF881 )
-		pFnF881 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F881" );
+	UFunction* const pFnF881 = pFnF881Ref.Get ( );
 
 	UBioAutoConditionals_execF881_Parms F881_Parms;
 	F881_Parms.bioWorld = bioWorld;
@@ -20126,10 +19250,9 @@ bool UBioAutoConditionals::F881 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1276 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1276 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1276Ref { L"Function PlotManager.BioAutoConditionals.F1276", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1276 )
-		pFnF1276 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1276" );
+	UFunction* const pFnF1276 = pFnF1276Ref.Get ( );
 
 	UBioAutoConditionals_execF1276_Parms F1276_Parms;
 	F1276_Parms.bioWorld = bioWorld;
@@ -20149,10 +19272,9 @@ bool UBioAutoConditionals::F1276 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1275 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1275 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1275Ref { L"Function PlotManager.BioAutoConditionals.F1275", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1275 )
-		pFnF1275 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1275" );
+	UFunction* const pFnF1275 = pFnF1275Ref.Get ( );
 
 	UBioAutoConditionals_execF1275_Parms F1275_Parms;
 	F1275_Parms.bioWorld = bioWorld;
@@ -20172,10 +19294,9 @@ bool UBioAutoConditionals::F1275 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F512 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF512 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF512Ref { L"Function PlotManager.BioAutoConditionals.F512", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF512 )
-		pFnF512 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F512" );
+	UFunction* const pFnF512 = pFnF512Ref.Get ( );
 
 	UBioAutoConditionals_execF512_Parms F512_Parms;
 	F512_Parms.bioWorld = bioWorld;
@@ -20195,10 +19316,9 @@ bool UBioAutoConditionals::F512 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F491 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF491 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF491Ref { L"Function PlotManager.BioAutoConditionals.F491", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF491 )
-		pFnF491 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F491" );
+	UFunction* const pFnF491 = pFnF491Ref.Get ( );
 
 	UBioAutoConditionals_execF491_Parms F491_Parms;
 	F491_Parms.bioWorld = bioWorld;
@@ -20218,10 +19338,9 @@ bool UBioAutoConditionals::F491 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F238 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF238 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF238Ref { L"Function PlotManager.BioAutoConditionals.F238", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF238 )
-		pFnF238 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F238" );
+	UFunction* const pFnF238 = pFnF238Ref.Get ( );
 
 	UBioAutoConditionals_execF238_Parms F238_Parms;
 	F238_Parms.bioWorld = bioWorld;
@@ -20241,10 +19360,9 @@ bool UBioAutoConditionals::F238 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F197 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF197 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF197Ref { L"Function PlotManager.BioAutoConditionals.F197", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF197 )
-		pFnF197 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F197" );
+	UFunction* const pFnF197 = pFnF197Ref.Get ( );
 
 	UBioAutoConditionals_execF197_Parms F197_Parms;
 	F197_Parms.bioWorld = bioWorld;
@@ -20264,10 +19382,9 @@ bool UBioAutoConditionals::F197 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F196 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF196 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF196Ref { L"Function PlotManager.BioAutoConditionals.F196", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF196 )
-		pFnF196 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F196" );
+	UFunction* const pFnF196 = pFnF196Ref.Get ( );
 
 	UBioAutoConditionals_execF196_Parms F196_Parms;
 	F196_Parms.bioWorld = bioWorld;
@@ -20287,10 +19404,9 @@ bool UBioAutoConditionals::F196 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F195 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF195 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF195Ref { L"Function PlotManager.BioAutoConditionals.F195", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF195 )
-		pFnF195 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F195" );
+	UFunction* const pFnF195 = pFnF195Ref.Get ( );
 
 	UBioAutoConditionals_execF195_Parms F195_Parms;
 	F195_Parms.bioWorld = bioWorld;
@@ -20310,10 +19426,9 @@ bool UBioAutoConditionals::F195 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F194 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF194 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF194Ref { L"Function PlotManager.BioAutoConditionals.F194", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF194 )
-		pFnF194 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F194" );
+	UFunction* const pFnF194 = pFnF194Ref.Get ( );
 
 	UBioAutoConditionals_execF194_Parms F194_Parms;
 	F194_Parms.bioWorld = bioWorld;
@@ -20333,10 +19448,9 @@ bool UBioAutoConditionals::F194 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F193 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF193 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF193Ref { L"Function PlotManager.BioAutoConditionals.F193", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF193 )
-		pFnF193 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F193" );
+	UFunction* const pFnF193 = pFnF193Ref.Get ( );
 
 	UBioAutoConditionals_execF193_Parms F193_Parms;
 	F193_Parms.bioWorld = bioWorld;
@@ -20356,10 +19470,9 @@ bool UBioAutoConditionals::F193 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F192 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF192 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF192Ref { L"Function PlotManager.BioAutoConditionals.F192", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF192 )
-		pFnF192 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F192" );
+	UFunction* const pFnF192 = pFnF192Ref.Get ( );
 
 	UBioAutoConditionals_execF192_Parms F192_Parms;
 	F192_Parms.bioWorld = bioWorld;
@@ -20379,10 +19492,9 @@ bool UBioAutoConditionals::F192 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F191 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF191 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF191Ref { L"Function PlotManager.BioAutoConditionals.F191", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF191 )
-		pFnF191 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F191" );
+	UFunction* const pFnF191 = pFnF191Ref.Get ( );
 
 	UBioAutoConditionals_execF191_Parms F191_Parms;
 	F191_Parms.bioWorld = bioWorld;
@@ -20402,10 +19514,9 @@ bool UBioAutoConditionals::F191 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F190 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF190 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF190Ref { L"Function PlotManager.BioAutoConditionals.F190", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF190 )
-		pFnF190 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F190" );
+	UFunction* const pFnF190 = pFnF190Ref.Get ( );
 
 	UBioAutoConditionals_execF190_Parms F190_Parms;
 	F190_Parms.bioWorld = bioWorld;
@@ -20425,10 +19536,9 @@ bool UBioAutoConditionals::F190 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F189 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF189 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF189Ref { L"Function PlotManager.BioAutoConditionals.F189", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF189 )
-		pFnF189 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F189" );
+	UFunction* const pFnF189 = pFnF189Ref.Get ( );
 
 	UBioAutoConditionals_execF189_Parms F189_Parms;
 	F189_Parms.bioWorld = bioWorld;
@@ -20448,10 +19558,9 @@ bool UBioAutoConditionals::F189 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F188 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF188 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF188Ref { L"Function PlotManager.BioAutoConditionals.F188", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF188 )
-		pFnF188 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F188" );
+	UFunction* const pFnF188 = pFnF188Ref.Get ( );
 
 	UBioAutoConditionals_execF188_Parms F188_Parms;
 	F188_Parms.bioWorld = bioWorld;
@@ -20471,10 +19580,9 @@ bool UBioAutoConditionals::F188 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F187 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF187 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF187Ref { L"Function PlotManager.BioAutoConditionals.F187", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF187 )
-		pFnF187 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F187" );
+	UFunction* const pFnF187 = pFnF187Ref.Get ( );
 
 	UBioAutoConditionals_execF187_Parms F187_Parms;
 	F187_Parms.bioWorld = bioWorld;
@@ -20494,10 +19602,9 @@ bool UBioAutoConditionals::F187 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F186 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF186 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF186Ref { L"Function PlotManager.BioAutoConditionals.F186", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF186 )
-		pFnF186 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F186" );
+	UFunction* const pFnF186 = pFnF186Ref.Get ( );
 
 	UBioAutoConditionals_execF186_Parms F186_Parms;
 	F186_Parms.bioWorld = bioWorld;
@@ -20517,10 +19624,9 @@ bool UBioAutoConditionals::F186 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F185 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF185 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF185Ref { L"Function PlotManager.BioAutoConditionals.F185", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF185 )
-		pFnF185 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F185" );
+	UFunction* const pFnF185 = pFnF185Ref.Get ( );
 
 	UBioAutoConditionals_execF185_Parms F185_Parms;
 	F185_Parms.bioWorld = bioWorld;
@@ -20540,10 +19646,9 @@ bool UBioAutoConditionals::F185 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F184 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF184 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF184Ref { L"Function PlotManager.BioAutoConditionals.F184", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF184 )
-		pFnF184 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F184" );
+	UFunction* const pFnF184 = pFnF184Ref.Get ( );
 
 	UBioAutoConditionals_execF184_Parms F184_Parms;
 	F184_Parms.bioWorld = bioWorld;
@@ -20563,10 +19668,9 @@ bool UBioAutoConditionals::F184 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F183 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF183 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF183Ref { L"Function PlotManager.BioAutoConditionals.F183", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF183 )
-		pFnF183 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F183" );
+	UFunction* const pFnF183 = pFnF183Ref.Get ( );
 
 	UBioAutoConditionals_execF183_Parms F183_Parms;
 	F183_Parms.bioWorld = bioWorld;
@@ -20586,10 +19690,9 @@ bool UBioAutoConditionals::F183 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F182 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF182 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF182Ref { L"Function PlotManager.BioAutoConditionals.F182", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF182 )
-		pFnF182 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F182" );
+	UFunction* const pFnF182 = pFnF182Ref.Get ( );
 
 	UBioAutoConditionals_execF182_Parms F182_Parms;
 	F182_Parms.bioWorld = bioWorld;
@@ -20609,10 +19712,9 @@ bool UBioAutoConditionals::F182 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F181 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF181 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF181Ref { L"Function PlotManager.BioAutoConditionals.F181", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF181 )
-		pFnF181 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F181" );
+	UFunction* const pFnF181 = pFnF181Ref.Get ( );
 
 	UBioAutoConditionals_execF181_Parms F181_Parms;
 	F181_Parms.bioWorld = bioWorld;
@@ -20632,10 +19734,9 @@ bool UBioAutoConditionals::F181 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F180 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF180 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF180Ref { L"Function PlotManager.BioAutoConditionals.F180", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF180 )
-		pFnF180 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F180" );
+	UFunction* const pFnF180 = pFnF180Ref.Get ( );
 
 	UBioAutoConditionals_execF180_Parms F180_Parms;
 	F180_Parms.bioWorld = bioWorld;
@@ -20655,10 +19756,9 @@ bool UBioAutoConditionals::F180 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F179 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF179 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF179Ref { L"Function PlotManager.BioAutoConditionals.F179", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF179 )
-		pFnF179 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F179" );
+	UFunction* const pFnF179 = pFnF179Ref.Get ( );
 
 	UBioAutoConditionals_execF179_Parms F179_Parms;
 	F179_Parms.bioWorld = bioWorld;
@@ -20678,10 +19778,9 @@ bool UBioAutoConditionals::F179 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F178 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF178 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF178Ref { L"Function PlotManager.BioAutoConditionals.F178", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF178 )
-		pFnF178 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F178" );
+	UFunction* const pFnF178 = pFnF178Ref.Get ( );
 
 	UBioAutoConditionals_execF178_Parms F178_Parms;
 	F178_Parms.bioWorld = bioWorld;
@@ -20701,10 +19800,9 @@ bool UBioAutoConditionals::F178 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F177 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF177 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF177Ref { L"Function PlotManager.BioAutoConditionals.F177", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF177 )
-		pFnF177 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F177" );
+	UFunction* const pFnF177 = pFnF177Ref.Get ( );
 
 	UBioAutoConditionals_execF177_Parms F177_Parms;
 	F177_Parms.bioWorld = bioWorld;
@@ -20724,10 +19822,9 @@ bool UBioAutoConditionals::F177 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F176 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF176 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF176Ref { L"Function PlotManager.BioAutoConditionals.F176", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF176 )
-		pFnF176 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F176" );
+	UFunction* const pFnF176 = pFnF176Ref.Get ( );
 
 	UBioAutoConditionals_execF176_Parms F176_Parms;
 	F176_Parms.bioWorld = bioWorld;
@@ -20747,10 +19844,9 @@ bool UBioAutoConditionals::F176 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F175 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF175 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF175Ref { L"Function PlotManager.BioAutoConditionals.F175", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF175 )
-		pFnF175 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F175" );
+	UFunction* const pFnF175 = pFnF175Ref.Get ( );
 
 	UBioAutoConditionals_execF175_Parms F175_Parms;
 	F175_Parms.bioWorld = bioWorld;
@@ -20770,10 +19866,9 @@ bool UBioAutoConditionals::F175 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F174 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF174 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF174Ref { L"Function PlotManager.BioAutoConditionals.F174", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF174 )
-		pFnF174 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F174" );
+	UFunction* const pFnF174 = pFnF174Ref.Get ( );
 
 	UBioAutoConditionals_execF174_Parms F174_Parms;
 	F174_Parms.bioWorld = bioWorld;
@@ -20793,10 +19888,9 @@ bool UBioAutoConditionals::F174 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F173 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF173 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF173Ref { L"Function PlotManager.BioAutoConditionals.F173", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF173 )
-		pFnF173 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F173" );
+	UFunction* const pFnF173 = pFnF173Ref.Get ( );
 
 	UBioAutoConditionals_execF173_Parms F173_Parms;
 	F173_Parms.bioWorld = bioWorld;
@@ -20816,10 +19910,9 @@ bool UBioAutoConditionals::F173 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F172 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF172 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF172Ref { L"Function PlotManager.BioAutoConditionals.F172", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF172 )
-		pFnF172 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F172" );
+	UFunction* const pFnF172 = pFnF172Ref.Get ( );
 
 	UBioAutoConditionals_execF172_Parms F172_Parms;
 	F172_Parms.bioWorld = bioWorld;
@@ -20839,10 +19932,9 @@ bool UBioAutoConditionals::F172 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F161 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF161 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF161Ref { L"Function PlotManager.BioAutoConditionals.F161", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF161 )
-		pFnF161 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F161" );
+	UFunction* const pFnF161 = pFnF161Ref.Get ( );
 
 	UBioAutoConditionals_execF161_Parms F161_Parms;
 	F161_Parms.bioWorld = bioWorld;
@@ -20862,10 +19954,9 @@ bool UBioAutoConditionals::F161 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F160 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF160 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF160Ref { L"Function PlotManager.BioAutoConditionals.F160", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF160 )
-		pFnF160 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F160" );
+	UFunction* const pFnF160 = pFnF160Ref.Get ( );
 
 	UBioAutoConditionals_execF160_Parms F160_Parms;
 	F160_Parms.bioWorld = bioWorld;
@@ -20885,10 +19976,9 @@ bool UBioAutoConditionals::F160 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F159 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF159 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF159Ref { L"Function PlotManager.BioAutoConditionals.F159", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF159 )
-		pFnF159 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F159" );
+	UFunction* const pFnF159 = pFnF159Ref.Get ( );
 
 	UBioAutoConditionals_execF159_Parms F159_Parms;
 	F159_Parms.bioWorld = bioWorld;
@@ -20908,10 +19998,9 @@ bool UBioAutoConditionals::F159 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1535 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1535 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1535Ref { L"Function PlotManager.BioAutoConditionals.F1535", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1535 )
-		pFnF1535 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1535" );
+	UFunction* const pFnF1535 = pFnF1535Ref.Get ( );
 
 	UBioAutoConditionals_execF1535_Parms F1535_Parms;
 	F1535_Parms.bioWorld = bioWorld;
@@ -20931,10 +20020,9 @@ bool UBioAutoConditionals::F1535 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1534 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1534 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1534Ref { L"Function PlotManager.BioAutoConditionals.F1534", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1534 )
-		pFnF1534 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1534" );
+	UFunction* const pFnF1534 = pFnF1534Ref.Get ( );
 
 	UBioAutoConditionals_execF1534_Parms F1534_Parms;
 	F1534_Parms.bioWorld = bioWorld;
@@ -20954,10 +20042,9 @@ bool UBioAutoConditionals::F1534 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1505 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1505 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1505Ref { L"Function PlotManager.BioAutoConditionals.F1505", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1505 )
-		pFnF1505 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1505" );
+	UFunction* const pFnF1505 = pFnF1505Ref.Get ( );
 
 	UBioAutoConditionals_execF1505_Parms F1505_Parms;
 	F1505_Parms.bioWorld = bioWorld;
@@ -20977,10 +20064,9 @@ bool UBioAutoConditionals::F1505 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1504 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1504 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1504Ref { L"Function PlotManager.BioAutoConditionals.F1504", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1504 )
-		pFnF1504 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1504" );
+	UFunction* const pFnF1504 = pFnF1504Ref.Get ( );
 
 	UBioAutoConditionals_execF1504_Parms F1504_Parms;
 	F1504_Parms.bioWorld = bioWorld;
@@ -21000,10 +20086,9 @@ bool UBioAutoConditionals::F1504 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1503 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1503 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1503Ref { L"Function PlotManager.BioAutoConditionals.F1503", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1503 )
-		pFnF1503 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1503" );
+	UFunction* const pFnF1503 = pFnF1503Ref.Get ( );
 
 	UBioAutoConditionals_execF1503_Parms F1503_Parms;
 	F1503_Parms.bioWorld = bioWorld;
@@ -21023,10 +20108,9 @@ bool UBioAutoConditionals::F1503 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1502 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1502 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1502Ref { L"Function PlotManager.BioAutoConditionals.F1502", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1502 )
-		pFnF1502 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1502" );
+	UFunction* const pFnF1502 = pFnF1502Ref.Get ( );
 
 	UBioAutoConditionals_execF1502_Parms F1502_Parms;
 	F1502_Parms.bioWorld = bioWorld;
@@ -21046,10 +20130,9 @@ bool UBioAutoConditionals::F1502 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1501 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1501 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1501Ref { L"Function PlotManager.BioAutoConditionals.F1501", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1501 )
-		pFnF1501 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1501" );
+	UFunction* const pFnF1501 = pFnF1501Ref.Get ( );
 
 	UBioAutoConditionals_execF1501_Parms F1501_Parms;
 	F1501_Parms.bioWorld = bioWorld;
@@ -21069,10 +20152,9 @@ bool UBioAutoConditionals::F1501 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1500 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1500 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1500Ref { L"Function PlotManager.BioAutoConditionals.F1500", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1500 )
-		pFnF1500 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1500" );
+	UFunction* const pFnF1500 = pFnF1500Ref.Get ( );
 
 	UBioAutoConditionals_execF1500_Parms F1500_Parms;
 	F1500_Parms.bioWorld = bioWorld;
@@ -21092,10 +20174,9 @@ bool UBioAutoConditionals::F1500 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1499 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1499 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1499Ref { L"Function PlotManager.BioAutoConditionals.F1499", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1499 )
-		pFnF1499 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1499" );
+	UFunction* const pFnF1499 = pFnF1499Ref.Get ( );
 
 	UBioAutoConditionals_execF1499_Parms F1499_Parms;
 	F1499_Parms.bioWorld = bioWorld;
@@ -21115,10 +20196,9 @@ bool UBioAutoConditionals::F1499 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1498 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1498 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1498Ref { L"Function PlotManager.BioAutoConditionals.F1498", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1498 )
-		pFnF1498 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1498" );
+	UFunction* const pFnF1498 = pFnF1498Ref.Get ( );
 
 	UBioAutoConditionals_execF1498_Parms F1498_Parms;
 	F1498_Parms.bioWorld = bioWorld;
@@ -21138,10 +20218,9 @@ bool UBioAutoConditionals::F1498 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1497 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1497 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1497Ref { L"Function PlotManager.BioAutoConditionals.F1497", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1497 )
-		pFnF1497 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1497" );
+	UFunction* const pFnF1497 = pFnF1497Ref.Get ( );
 
 	UBioAutoConditionals_execF1497_Parms F1497_Parms;
 	F1497_Parms.bioWorld = bioWorld;
@@ -21161,10 +20240,9 @@ bool UBioAutoConditionals::F1497 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1484 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1484 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1484Ref { L"Function PlotManager.BioAutoConditionals.F1484", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1484 )
-		pFnF1484 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1484" );
+	UFunction* const pFnF1484 = pFnF1484Ref.Get ( );
 
 	UBioAutoConditionals_execF1484_Parms F1484_Parms;
 	F1484_Parms.bioWorld = bioWorld;
@@ -21184,10 +20262,9 @@ bool UBioAutoConditionals::F1484 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1483 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1483 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1483Ref { L"Function PlotManager.BioAutoConditionals.F1483", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1483 )
-		pFnF1483 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1483" );
+	UFunction* const pFnF1483 = pFnF1483Ref.Get ( );
 
 	UBioAutoConditionals_execF1483_Parms F1483_Parms;
 	F1483_Parms.bioWorld = bioWorld;
@@ -21207,10 +20284,9 @@ bool UBioAutoConditionals::F1483 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1482 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1482 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1482Ref { L"Function PlotManager.BioAutoConditionals.F1482", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1482 )
-		pFnF1482 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1482" );
+	UFunction* const pFnF1482 = pFnF1482Ref.Get ( );
 
 	UBioAutoConditionals_execF1482_Parms F1482_Parms;
 	F1482_Parms.bioWorld = bioWorld;
@@ -21230,10 +20306,9 @@ bool UBioAutoConditionals::F1482 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1481 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1481 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1481Ref { L"Function PlotManager.BioAutoConditionals.F1481", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1481 )
-		pFnF1481 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1481" );
+	UFunction* const pFnF1481 = pFnF1481Ref.Get ( );
 
 	UBioAutoConditionals_execF1481_Parms F1481_Parms;
 	F1481_Parms.bioWorld = bioWorld;
@@ -21253,10 +20328,9 @@ bool UBioAutoConditionals::F1481 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1480 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1480 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1480Ref { L"Function PlotManager.BioAutoConditionals.F1480", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1480 )
-		pFnF1480 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1480" );
+	UFunction* const pFnF1480 = pFnF1480Ref.Get ( );
 
 	UBioAutoConditionals_execF1480_Parms F1480_Parms;
 	F1480_Parms.bioWorld = bioWorld;
@@ -21276,10 +20350,9 @@ bool UBioAutoConditionals::F1480 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1479 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1479 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1479Ref { L"Function PlotManager.BioAutoConditionals.F1479", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1479 )
-		pFnF1479 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1479" );
+	UFunction* const pFnF1479 = pFnF1479Ref.Get ( );
 
 	UBioAutoConditionals_execF1479_Parms F1479_Parms;
 	F1479_Parms.bioWorld = bioWorld;
@@ -21299,10 +20372,9 @@ bool UBioAutoConditionals::F1479 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1478 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1478 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1478Ref { L"Function PlotManager.BioAutoConditionals.F1478", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1478 )
-		pFnF1478 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1478" );
+	UFunction* const pFnF1478 = pFnF1478Ref.Get ( );
 
 	UBioAutoConditionals_execF1478_Parms F1478_Parms;
 	F1478_Parms.bioWorld = bioWorld;
@@ -21322,10 +20394,9 @@ bool UBioAutoConditionals::F1478 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1477 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1477 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1477Ref { L"Function PlotManager.BioAutoConditionals.F1477", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1477 )
-		pFnF1477 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1477" );
+	UFunction* const pFnF1477 = pFnF1477Ref.Get ( );
 
 	UBioAutoConditionals_execF1477_Parms F1477_Parms;
 	F1477_Parms.bioWorld = bioWorld;
@@ -21345,10 +20416,9 @@ bool UBioAutoConditionals::F1477 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1476 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1476 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1476Ref { L"Function PlotManager.BioAutoConditionals.F1476", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1476 )
-		pFnF1476 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1476" );
+	UFunction* const pFnF1476 = pFnF1476Ref.Get ( );
 
 	UBioAutoConditionals_execF1476_Parms F1476_Parms;
 	F1476_Parms.bioWorld = bioWorld;
@@ -21368,10 +20438,9 @@ bool UBioAutoConditionals::F1476 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1475 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1475 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1475Ref { L"Function PlotManager.BioAutoConditionals.F1475", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1475 )
-		pFnF1475 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1475" );
+	UFunction* const pFnF1475 = pFnF1475Ref.Get ( );
 
 	UBioAutoConditionals_execF1475_Parms F1475_Parms;
 	F1475_Parms.bioWorld = bioWorld;
@@ -21391,10 +20460,9 @@ bool UBioAutoConditionals::F1475 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1474 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1474 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1474Ref { L"Function PlotManager.BioAutoConditionals.F1474", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1474 )
-		pFnF1474 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1474" );
+	UFunction* const pFnF1474 = pFnF1474Ref.Get ( );
 
 	UBioAutoConditionals_execF1474_Parms F1474_Parms;
 	F1474_Parms.bioWorld = bioWorld;
@@ -21414,10 +20482,9 @@ bool UBioAutoConditionals::F1474 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1473 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1473 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1473Ref { L"Function PlotManager.BioAutoConditionals.F1473", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1473 )
-		pFnF1473 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1473" );
+	UFunction* const pFnF1473 = pFnF1473Ref.Get ( );
 
 	UBioAutoConditionals_execF1473_Parms F1473_Parms;
 	F1473_Parms.bioWorld = bioWorld;
@@ -21437,10 +20504,9 @@ bool UBioAutoConditionals::F1473 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1472 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1472 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1472Ref { L"Function PlotManager.BioAutoConditionals.F1472", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1472 )
-		pFnF1472 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1472" );
+	UFunction* const pFnF1472 = pFnF1472Ref.Get ( );
 
 	UBioAutoConditionals_execF1472_Parms F1472_Parms;
 	F1472_Parms.bioWorld = bioWorld;
@@ -21460,10 +20526,9 @@ bool UBioAutoConditionals::F1472 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1471 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1471 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1471Ref { L"Function PlotManager.BioAutoConditionals.F1471", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1471 )
-		pFnF1471 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1471" );
+	UFunction* const pFnF1471 = pFnF1471Ref.Get ( );
 
 	UBioAutoConditionals_execF1471_Parms F1471_Parms;
 	F1471_Parms.bioWorld = bioWorld;
@@ -21483,10 +20548,9 @@ bool UBioAutoConditionals::F1471 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1470 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1470 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1470Ref { L"Function PlotManager.BioAutoConditionals.F1470", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1470 )
-		pFnF1470 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1470" );
+	UFunction* const pFnF1470 = pFnF1470Ref.Get ( );
 
 	UBioAutoConditionals_execF1470_Parms F1470_Parms;
 	F1470_Parms.bioWorld = bioWorld;
@@ -21506,10 +20570,9 @@ bool UBioAutoConditionals::F1470 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1469 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1469 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1469Ref { L"Function PlotManager.BioAutoConditionals.F1469", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1469 )
-		pFnF1469 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1469" );
+	UFunction* const pFnF1469 = pFnF1469Ref.Get ( );
 
 	UBioAutoConditionals_execF1469_Parms F1469_Parms;
 	F1469_Parms.bioWorld = bioWorld;
@@ -21529,10 +20592,9 @@ bool UBioAutoConditionals::F1469 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1468 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1468 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1468Ref { L"Function PlotManager.BioAutoConditionals.F1468", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1468 )
-		pFnF1468 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1468" );
+	UFunction* const pFnF1468 = pFnF1468Ref.Get ( );
 
 	UBioAutoConditionals_execF1468_Parms F1468_Parms;
 	F1468_Parms.bioWorld = bioWorld;
@@ -21552,10 +20614,9 @@ bool UBioAutoConditionals::F1468 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1467 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1467 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1467Ref { L"Function PlotManager.BioAutoConditionals.F1467", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1467 )
-		pFnF1467 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1467" );
+	UFunction* const pFnF1467 = pFnF1467Ref.Get ( );
 
 	UBioAutoConditionals_execF1467_Parms F1467_Parms;
 	F1467_Parms.bioWorld = bioWorld;
@@ -21575,10 +20636,9 @@ bool UBioAutoConditionals::F1467 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1466 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1466 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1466Ref { L"Function PlotManager.BioAutoConditionals.F1466", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1466 )
-		pFnF1466 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1466" );
+	UFunction* const pFnF1466 = pFnF1466Ref.Get ( );
 
 	UBioAutoConditionals_execF1466_Parms F1466_Parms;
 	F1466_Parms.bioWorld = bioWorld;
@@ -21598,10 +20658,9 @@ bool UBioAutoConditionals::F1466 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1465 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1465 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1465Ref { L"Function PlotManager.BioAutoConditionals.F1465", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1465 )
-		pFnF1465 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1465" );
+	UFunction* const pFnF1465 = pFnF1465Ref.Get ( );
 
 	UBioAutoConditionals_execF1465_Parms F1465_Parms;
 	F1465_Parms.bioWorld = bioWorld;
@@ -21621,10 +20680,9 @@ bool UBioAutoConditionals::F1465 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1464 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1464 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1464Ref { L"Function PlotManager.BioAutoConditionals.F1464", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1464 )
-		pFnF1464 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1464" );
+	UFunction* const pFnF1464 = pFnF1464Ref.Get ( );
 
 	UBioAutoConditionals_execF1464_Parms F1464_Parms;
 	F1464_Parms.bioWorld = bioWorld;
@@ -21644,10 +20702,9 @@ bool UBioAutoConditionals::F1464 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1463 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1463 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1463Ref { L"Function PlotManager.BioAutoConditionals.F1463", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1463 )
-		pFnF1463 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1463" );
+	UFunction* const pFnF1463 = pFnF1463Ref.Get ( );
 
 	UBioAutoConditionals_execF1463_Parms F1463_Parms;
 	F1463_Parms.bioWorld = bioWorld;
@@ -21667,10 +20724,9 @@ bool UBioAutoConditionals::F1463 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1462 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1462 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1462Ref { L"Function PlotManager.BioAutoConditionals.F1462", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1462 )
-		pFnF1462 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1462" );
+	UFunction* const pFnF1462 = pFnF1462Ref.Get ( );
 
 	UBioAutoConditionals_execF1462_Parms F1462_Parms;
 	F1462_Parms.bioWorld = bioWorld;
@@ -21690,10 +20746,9 @@ bool UBioAutoConditionals::F1462 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1461 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1461 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1461Ref { L"Function PlotManager.BioAutoConditionals.F1461", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1461 )
-		pFnF1461 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1461" );
+	UFunction* const pFnF1461 = pFnF1461Ref.Get ( );
 
 	UBioAutoConditionals_execF1461_Parms F1461_Parms;
 	F1461_Parms.bioWorld = bioWorld;
@@ -21713,10 +20768,9 @@ bool UBioAutoConditionals::F1461 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1460 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1460 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1460Ref { L"Function PlotManager.BioAutoConditionals.F1460", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1460 )
-		pFnF1460 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1460" );
+	UFunction* const pFnF1460 = pFnF1460Ref.Get ( );
 
 	UBioAutoConditionals_execF1460_Parms F1460_Parms;
 	F1460_Parms.bioWorld = bioWorld;
@@ -21736,10 +20790,9 @@ bool UBioAutoConditionals::F1460 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1459 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1459 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1459Ref { L"Function PlotManager.BioAutoConditionals.F1459", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1459 )
-		pFnF1459 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1459" );
+	UFunction* const pFnF1459 = pFnF1459Ref.Get ( );
 
 	UBioAutoConditionals_execF1459_Parms F1459_Parms;
 	F1459_Parms.bioWorld = bioWorld;
@@ -21759,10 +20812,9 @@ bool UBioAutoConditionals::F1459 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1458 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1458 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1458Ref { L"Function PlotManager.BioAutoConditionals.F1458", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1458 )
-		pFnF1458 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1458" );
+	UFunction* const pFnF1458 = pFnF1458Ref.Get ( );
 
 	UBioAutoConditionals_execF1458_Parms F1458_Parms;
 	F1458_Parms.bioWorld = bioWorld;
@@ -21782,10 +20834,9 @@ bool UBioAutoConditionals::F1458 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1457 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1457 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1457Ref { L"Function PlotManager.BioAutoConditionals.F1457", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1457 )
-		pFnF1457 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1457" );
+	UFunction* const pFnF1457 = pFnF1457Ref.Get ( );
 
 	UBioAutoConditionals_execF1457_Parms F1457_Parms;
 	F1457_Parms.bioWorld = bioWorld;
@@ -21805,10 +20856,9 @@ bool UBioAutoConditionals::F1457 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1456 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1456 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1456Ref { L"Function PlotManager.BioAutoConditionals.F1456", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1456 )
-		pFnF1456 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1456" );
+	UFunction* const pFnF1456 = pFnF1456Ref.Get ( );
 
 	UBioAutoConditionals_execF1456_Parms F1456_Parms;
 	F1456_Parms.bioWorld = bioWorld;
@@ -21828,10 +20878,9 @@ bool UBioAutoConditionals::F1456 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1455 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1455 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1455Ref { L"Function PlotManager.BioAutoConditionals.F1455", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1455 )
-		pFnF1455 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1455" );
+	UFunction* const pFnF1455 = pFnF1455Ref.Get ( );
 
 	UBioAutoConditionals_execF1455_Parms F1455_Parms;
 	F1455_Parms.bioWorld = bioWorld;
@@ -21851,10 +20900,9 @@ bool UBioAutoConditionals::F1455 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1454 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1454 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1454Ref { L"Function PlotManager.BioAutoConditionals.F1454", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1454 )
-		pFnF1454 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1454" );
+	UFunction* const pFnF1454 = pFnF1454Ref.Get ( );
 
 	UBioAutoConditionals_execF1454_Parms F1454_Parms;
 	F1454_Parms.bioWorld = bioWorld;
@@ -21874,10 +20922,9 @@ bool UBioAutoConditionals::F1454 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1453 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1453 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1453Ref { L"Function PlotManager.BioAutoConditionals.F1453", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1453 )
-		pFnF1453 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1453" );
+	UFunction* const pFnF1453 = pFnF1453Ref.Get ( );
 
 	UBioAutoConditionals_execF1453_Parms F1453_Parms;
 	F1453_Parms.bioWorld = bioWorld;
@@ -21897,10 +20944,9 @@ bool UBioAutoConditionals::F1453 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1452 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1452 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1452Ref { L"Function PlotManager.BioAutoConditionals.F1452", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1452 )
-		pFnF1452 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1452" );
+	UFunction* const pFnF1452 = pFnF1452Ref.Get ( );
 
 	UBioAutoConditionals_execF1452_Parms F1452_Parms;
 	F1452_Parms.bioWorld = bioWorld;
@@ -21920,10 +20966,9 @@ bool UBioAutoConditionals::F1452 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1451 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1451 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1451Ref { L"Function PlotManager.BioAutoConditionals.F1451", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1451 )
-		pFnF1451 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1451" );
+	UFunction* const pFnF1451 = pFnF1451Ref.Get ( );
 
 	UBioAutoConditionals_execF1451_Parms F1451_Parms;
 	F1451_Parms.bioWorld = bioWorld;
@@ -21943,10 +20988,9 @@ bool UBioAutoConditionals::F1451 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1450 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1450 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1450Ref { L"Function PlotManager.BioAutoConditionals.F1450", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1450 )
-		pFnF1450 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1450" );
+	UFunction* const pFnF1450 = pFnF1450Ref.Get ( );
 
 	UBioAutoConditionals_execF1450_Parms F1450_Parms;
 	F1450_Parms.bioWorld = bioWorld;
@@ -21966,10 +21010,9 @@ bool UBioAutoConditionals::F1450 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1449 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1449 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1449Ref { L"Function PlotManager.BioAutoConditionals.F1449", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1449 )
-		pFnF1449 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1449" );
+	UFunction* const pFnF1449 = pFnF1449Ref.Get ( );
 
 	UBioAutoConditionals_execF1449_Parms F1449_Parms;
 	F1449_Parms.bioWorld = bioWorld;
@@ -21989,10 +21032,9 @@ bool UBioAutoConditionals::F1449 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1448 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1448 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1448Ref { L"Function PlotManager.BioAutoConditionals.F1448", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1448 )
-		pFnF1448 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1448" );
+	UFunction* const pFnF1448 = pFnF1448Ref.Get ( );
 
 	UBioAutoConditionals_execF1448_Parms F1448_Parms;
 	F1448_Parms.bioWorld = bioWorld;
@@ -22012,10 +21054,9 @@ bool UBioAutoConditionals::F1448 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1447 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1447 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1447Ref { L"Function PlotManager.BioAutoConditionals.F1447", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1447 )
-		pFnF1447 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1447" );
+	UFunction* const pFnF1447 = pFnF1447Ref.Get ( );
 
 	UBioAutoConditionals_execF1447_Parms F1447_Parms;
 	F1447_Parms.bioWorld = bioWorld;
@@ -22035,10 +21076,9 @@ bool UBioAutoConditionals::F1447 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1446 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1446 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1446Ref { L"Function PlotManager.BioAutoConditionals.F1446", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1446 )
-		pFnF1446 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1446" );
+	UFunction* const pFnF1446 = pFnF1446Ref.Get ( );
 
 	UBioAutoConditionals_execF1446_Parms F1446_Parms;
 	F1446_Parms.bioWorld = bioWorld;
@@ -22058,10 +21098,9 @@ bool UBioAutoConditionals::F1446 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1445 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1445 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1445Ref { L"Function PlotManager.BioAutoConditionals.F1445", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1445 )
-		pFnF1445 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1445" );
+	UFunction* const pFnF1445 = pFnF1445Ref.Get ( );
 
 	UBioAutoConditionals_execF1445_Parms F1445_Parms;
 	F1445_Parms.bioWorld = bioWorld;
@@ -22081,10 +21120,9 @@ bool UBioAutoConditionals::F1445 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2044 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2044 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2044Ref { L"Function PlotManager.BioAutoConditionals.F2044", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2044 )
-		pFnF2044 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2044" );
+	UFunction* const pFnF2044 = pFnF2044Ref.Get ( );
 
 	UBioAutoConditionals_execF2044_Parms F2044_Parms;
 	F2044_Parms.bioWorld = bioWorld;
@@ -22104,10 +21142,9 @@ bool UBioAutoConditionals::F2044 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1230 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1230 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1230Ref { L"Function PlotManager.BioAutoConditionals.F1230", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1230 )
-		pFnF1230 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1230" );
+	UFunction* const pFnF1230 = pFnF1230Ref.Get ( );
 
 	UBioAutoConditionals_execF1230_Parms F1230_Parms;
 	F1230_Parms.bioWorld = bioWorld;
@@ -22127,10 +21164,9 @@ bool UBioAutoConditionals::F1230 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1229 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1229 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1229Ref { L"Function PlotManager.BioAutoConditionals.F1229", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1229 )
-		pFnF1229 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1229" );
+	UFunction* const pFnF1229 = pFnF1229Ref.Get ( );
 
 	UBioAutoConditionals_execF1229_Parms F1229_Parms;
 	F1229_Parms.bioWorld = bioWorld;
@@ -22150,10 +21186,9 @@ bool UBioAutoConditionals::F1229 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1228 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1228 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1228Ref { L"Function PlotManager.BioAutoConditionals.F1228", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1228 )
-		pFnF1228 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1228" );
+	UFunction* const pFnF1228 = pFnF1228Ref.Get ( );
 
 	UBioAutoConditionals_execF1228_Parms F1228_Parms;
 	F1228_Parms.bioWorld = bioWorld;
@@ -22173,10 +21208,9 @@ bool UBioAutoConditionals::F1228 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1227 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1227 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1227Ref { L"Function PlotManager.BioAutoConditionals.F1227", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1227 )
-		pFnF1227 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1227" );
+	UFunction* const pFnF1227 = pFnF1227Ref.Get ( );
 
 	UBioAutoConditionals_execF1227_Parms F1227_Parms;
 	F1227_Parms.bioWorld = bioWorld;
@@ -22196,10 +21230,9 @@ bool UBioAutoConditionals::F1227 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1226 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1226 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1226Ref { L"Function PlotManager.BioAutoConditionals.F1226", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1226 )
-		pFnF1226 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1226" );
+	UFunction* const pFnF1226 = pFnF1226Ref.Get ( );
 
 	UBioAutoConditionals_execF1226_Parms F1226_Parms;
 	F1226_Parms.bioWorld = bioWorld;
@@ -22219,10 +21252,9 @@ bool UBioAutoConditionals::F1226 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1225 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1225 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1225Ref { L"Function PlotManager.BioAutoConditionals.F1225", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1225 )
-		pFnF1225 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1225" );
+	UFunction* const pFnF1225 = pFnF1225Ref.Get ( );
 
 	UBioAutoConditionals_execF1225_Parms F1225_Parms;
 	F1225_Parms.bioWorld = bioWorld;
@@ -22242,10 +21274,9 @@ bool UBioAutoConditionals::F1225 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1224 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1224 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1224Ref { L"Function PlotManager.BioAutoConditionals.F1224", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1224 )
-		pFnF1224 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1224" );
+	UFunction* const pFnF1224 = pFnF1224Ref.Get ( );
 
 	UBioAutoConditionals_execF1224_Parms F1224_Parms;
 	F1224_Parms.bioWorld = bioWorld;
@@ -22265,10 +21296,9 @@ bool UBioAutoConditionals::F1224 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1223 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1223 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1223Ref { L"Function PlotManager.BioAutoConditionals.F1223", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1223 )
-		pFnF1223 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1223" );
+	UFunction* const pFnF1223 = pFnF1223Ref.Get ( );
 
 	UBioAutoConditionals_execF1223_Parms F1223_Parms;
 	F1223_Parms.bioWorld = bioWorld;
@@ -22288,10 +21318,9 @@ bool UBioAutoConditionals::F1223 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1222 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1222 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1222Ref { L"Function PlotManager.BioAutoConditionals.F1222", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1222 )
-		pFnF1222 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1222" );
+	UFunction* const pFnF1222 = pFnF1222Ref.Get ( );
 
 	UBioAutoConditionals_execF1222_Parms F1222_Parms;
 	F1222_Parms.bioWorld = bioWorld;
@@ -22311,10 +21340,9 @@ bool UBioAutoConditionals::F1222 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1221 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1221 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1221Ref { L"Function PlotManager.BioAutoConditionals.F1221", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1221 )
-		pFnF1221 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1221" );
+	UFunction* const pFnF1221 = pFnF1221Ref.Get ( );
 
 	UBioAutoConditionals_execF1221_Parms F1221_Parms;
 	F1221_Parms.bioWorld = bioWorld;
@@ -22334,10 +21362,9 @@ bool UBioAutoConditionals::F1221 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1220 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1220 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1220Ref { L"Function PlotManager.BioAutoConditionals.F1220", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1220 )
-		pFnF1220 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1220" );
+	UFunction* const pFnF1220 = pFnF1220Ref.Get ( );
 
 	UBioAutoConditionals_execF1220_Parms F1220_Parms;
 	F1220_Parms.bioWorld = bioWorld;
@@ -22357,10 +21384,9 @@ bool UBioAutoConditionals::F1220 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1219 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1219 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1219Ref { L"Function PlotManager.BioAutoConditionals.F1219", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1219 )
-		pFnF1219 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1219" );
+	UFunction* const pFnF1219 = pFnF1219Ref.Get ( );
 
 	UBioAutoConditionals_execF1219_Parms F1219_Parms;
 	F1219_Parms.bioWorld = bioWorld;
@@ -22380,10 +21406,9 @@ bool UBioAutoConditionals::F1219 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1218 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1218 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1218Ref { L"Function PlotManager.BioAutoConditionals.F1218", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1218 )
-		pFnF1218 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1218" );
+	UFunction* const pFnF1218 = pFnF1218Ref.Get ( );
 
 	UBioAutoConditionals_execF1218_Parms F1218_Parms;
 	F1218_Parms.bioWorld = bioWorld;
@@ -22403,10 +21428,9 @@ bool UBioAutoConditionals::F1218 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1217 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1217 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1217Ref { L"Function PlotManager.BioAutoConditionals.F1217", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1217 )
-		pFnF1217 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1217" );
+	UFunction* const pFnF1217 = pFnF1217Ref.Get ( );
 
 	UBioAutoConditionals_execF1217_Parms F1217_Parms;
 	F1217_Parms.bioWorld = bioWorld;
@@ -22426,10 +21450,9 @@ bool UBioAutoConditionals::F1217 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1216 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1216 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1216Ref { L"Function PlotManager.BioAutoConditionals.F1216", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1216 )
-		pFnF1216 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1216" );
+	UFunction* const pFnF1216 = pFnF1216Ref.Get ( );
 
 	UBioAutoConditionals_execF1216_Parms F1216_Parms;
 	F1216_Parms.bioWorld = bioWorld;
@@ -22449,10 +21472,9 @@ bool UBioAutoConditionals::F1216 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1215 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1215 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1215Ref { L"Function PlotManager.BioAutoConditionals.F1215", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1215 )
-		pFnF1215 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1215" );
+	UFunction* const pFnF1215 = pFnF1215Ref.Get ( );
 
 	UBioAutoConditionals_execF1215_Parms F1215_Parms;
 	F1215_Parms.bioWorld = bioWorld;
@@ -22472,10 +21494,9 @@ bool UBioAutoConditionals::F1215 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1214 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1214 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1214Ref { L"Function PlotManager.BioAutoConditionals.F1214", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1214 )
-		pFnF1214 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1214" );
+	UFunction* const pFnF1214 = pFnF1214Ref.Get ( );
 
 	UBioAutoConditionals_execF1214_Parms F1214_Parms;
 	F1214_Parms.bioWorld = bioWorld;
@@ -22495,10 +21516,9 @@ bool UBioAutoConditionals::F1214 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1213 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1213 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1213Ref { L"Function PlotManager.BioAutoConditionals.F1213", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1213 )
-		pFnF1213 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1213" );
+	UFunction* const pFnF1213 = pFnF1213Ref.Get ( );
 
 	UBioAutoConditionals_execF1213_Parms F1213_Parms;
 	F1213_Parms.bioWorld = bioWorld;
@@ -22518,10 +21538,9 @@ bool UBioAutoConditionals::F1213 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1212 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1212 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1212Ref { L"Function PlotManager.BioAutoConditionals.F1212", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1212 )
-		pFnF1212 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1212" );
+	UFunction* const pFnF1212 = pFnF1212Ref.Get ( );
 
 	UBioAutoConditionals_execF1212_Parms F1212_Parms;
 	F1212_Parms.bioWorld = bioWorld;
@@ -22541,10 +21560,9 @@ bool UBioAutoConditionals::F1212 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1211 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1211 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1211Ref { L"Function PlotManager.BioAutoConditionals.F1211", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1211 )
-		pFnF1211 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1211" );
+	UFunction* const pFnF1211 = pFnF1211Ref.Get ( );
 
 	UBioAutoConditionals_execF1211_Parms F1211_Parms;
 	F1211_Parms.bioWorld = bioWorld;
@@ -22564,10 +21582,9 @@ bool UBioAutoConditionals::F1211 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1209 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1209 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1209Ref { L"Function PlotManager.BioAutoConditionals.F1209", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1209 )
-		pFnF1209 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1209" );
+	UFunction* const pFnF1209 = pFnF1209Ref.Get ( );
 
 	UBioAutoConditionals_execF1209_Parms F1209_Parms;
 	F1209_Parms.bioWorld = bioWorld;
@@ -22587,10 +21604,9 @@ bool UBioAutoConditionals::F1209 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1208 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1208 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1208Ref { L"Function PlotManager.BioAutoConditionals.F1208", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1208 )
-		pFnF1208 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1208" );
+	UFunction* const pFnF1208 = pFnF1208Ref.Get ( );
 
 	UBioAutoConditionals_execF1208_Parms F1208_Parms;
 	F1208_Parms.bioWorld = bioWorld;
@@ -22610,10 +21626,9 @@ bool UBioAutoConditionals::F1208 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1207 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1207 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1207Ref { L"Function PlotManager.BioAutoConditionals.F1207", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1207 )
-		pFnF1207 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1207" );
+	UFunction* const pFnF1207 = pFnF1207Ref.Get ( );
 
 	UBioAutoConditionals_execF1207_Parms F1207_Parms;
 	F1207_Parms.bioWorld = bioWorld;
@@ -22633,10 +21648,9 @@ bool UBioAutoConditionals::F1207 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1206 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1206 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1206Ref { L"Function PlotManager.BioAutoConditionals.F1206", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1206 )
-		pFnF1206 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1206" );
+	UFunction* const pFnF1206 = pFnF1206Ref.Get ( );
 
 	UBioAutoConditionals_execF1206_Parms F1206_Parms;
 	F1206_Parms.bioWorld = bioWorld;
@@ -22656,10 +21670,9 @@ bool UBioAutoConditionals::F1206 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1205 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1205 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1205Ref { L"Function PlotManager.BioAutoConditionals.F1205", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1205 )
-		pFnF1205 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1205" );
+	UFunction* const pFnF1205 = pFnF1205Ref.Get ( );
 
 	UBioAutoConditionals_execF1205_Parms F1205_Parms;
 	F1205_Parms.bioWorld = bioWorld;
@@ -22679,10 +21692,9 @@ bool UBioAutoConditionals::F1205 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1204 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1204 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1204Ref { L"Function PlotManager.BioAutoConditionals.F1204", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1204 )
-		pFnF1204 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1204" );
+	UFunction* const pFnF1204 = pFnF1204Ref.Get ( );
 
 	UBioAutoConditionals_execF1204_Parms F1204_Parms;
 	F1204_Parms.bioWorld = bioWorld;
@@ -22702,10 +21714,9 @@ bool UBioAutoConditionals::F1204 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1140 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1140 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1140Ref { L"Function PlotManager.BioAutoConditionals.F1140", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1140 )
-		pFnF1140 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1140" );
+	UFunction* const pFnF1140 = pFnF1140Ref.Get ( );
 
 	UBioAutoConditionals_execF1140_Parms F1140_Parms;
 	F1140_Parms.bioWorld = bioWorld;
@@ -22725,10 +21736,9 @@ bool UBioAutoConditionals::F1140 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1139 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1139 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1139Ref { L"Function PlotManager.BioAutoConditionals.F1139", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1139 )
-		pFnF1139 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1139" );
+	UFunction* const pFnF1139 = pFnF1139Ref.Get ( );
 
 	UBioAutoConditionals_execF1139_Parms F1139_Parms;
 	F1139_Parms.bioWorld = bioWorld;
@@ -22748,10 +21758,9 @@ bool UBioAutoConditionals::F1139 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1138 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1138 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1138Ref { L"Function PlotManager.BioAutoConditionals.F1138", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1138 )
-		pFnF1138 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1138" );
+	UFunction* const pFnF1138 = pFnF1138Ref.Get ( );
 
 	UBioAutoConditionals_execF1138_Parms F1138_Parms;
 	F1138_Parms.bioWorld = bioWorld;
@@ -22771,10 +21780,9 @@ bool UBioAutoConditionals::F1138 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1137 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1137 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1137Ref { L"Function PlotManager.BioAutoConditionals.F1137", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1137 )
-		pFnF1137 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1137" );
+	UFunction* const pFnF1137 = pFnF1137Ref.Get ( );
 
 	UBioAutoConditionals_execF1137_Parms F1137_Parms;
 	F1137_Parms.bioWorld = bioWorld;
@@ -22794,10 +21802,9 @@ bool UBioAutoConditionals::F1137 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1136 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1136 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1136Ref { L"Function PlotManager.BioAutoConditionals.F1136", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1136 )
-		pFnF1136 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1136" );
+	UFunction* const pFnF1136 = pFnF1136Ref.Get ( );
 
 	UBioAutoConditionals_execF1136_Parms F1136_Parms;
 	F1136_Parms.bioWorld = bioWorld;
@@ -22817,10 +21824,9 @@ bool UBioAutoConditionals::F1136 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1135 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1135 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1135Ref { L"Function PlotManager.BioAutoConditionals.F1135", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1135 )
-		pFnF1135 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1135" );
+	UFunction* const pFnF1135 = pFnF1135Ref.Get ( );
 
 	UBioAutoConditionals_execF1135_Parms F1135_Parms;
 	F1135_Parms.bioWorld = bioWorld;
@@ -22840,10 +21846,9 @@ bool UBioAutoConditionals::F1135 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1134 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1134 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1134Ref { L"Function PlotManager.BioAutoConditionals.F1134", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1134 )
-		pFnF1134 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1134" );
+	UFunction* const pFnF1134 = pFnF1134Ref.Get ( );
 
 	UBioAutoConditionals_execF1134_Parms F1134_Parms;
 	F1134_Parms.bioWorld = bioWorld;
@@ -22863,10 +21868,9 @@ bool UBioAutoConditionals::F1134 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1133 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1133 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1133Ref { L"Function PlotManager.BioAutoConditionals.F1133", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1133 )
-		pFnF1133 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1133" );
+	UFunction* const pFnF1133 = pFnF1133Ref.Get ( );
 
 	UBioAutoConditionals_execF1133_Parms F1133_Parms;
 	F1133_Parms.bioWorld = bioWorld;
@@ -22886,10 +21890,9 @@ bool UBioAutoConditionals::F1133 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1132 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1132 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1132Ref { L"Function PlotManager.BioAutoConditionals.F1132", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1132 )
-		pFnF1132 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1132" );
+	UFunction* const pFnF1132 = pFnF1132Ref.Get ( );
 
 	UBioAutoConditionals_execF1132_Parms F1132_Parms;
 	F1132_Parms.bioWorld = bioWorld;
@@ -22909,10 +21912,9 @@ bool UBioAutoConditionals::F1132 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1131 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1131 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1131Ref { L"Function PlotManager.BioAutoConditionals.F1131", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1131 )
-		pFnF1131 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1131" );
+	UFunction* const pFnF1131 = pFnF1131Ref.Get ( );
 
 	UBioAutoConditionals_execF1131_Parms F1131_Parms;
 	F1131_Parms.bioWorld = bioWorld;
@@ -22932,10 +21934,9 @@ bool UBioAutoConditionals::F1131 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1130 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1130 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1130Ref { L"Function PlotManager.BioAutoConditionals.F1130", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1130 )
-		pFnF1130 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1130" );
+	UFunction* const pFnF1130 = pFnF1130Ref.Get ( );
 
 	UBioAutoConditionals_execF1130_Parms F1130_Parms;
 	F1130_Parms.bioWorld = bioWorld;
@@ -22955,10 +21956,9 @@ bool UBioAutoConditionals::F1130 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1129 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1129 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1129Ref { L"Function PlotManager.BioAutoConditionals.F1129", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1129 )
-		pFnF1129 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1129" );
+	UFunction* const pFnF1129 = pFnF1129Ref.Get ( );
 
 	UBioAutoConditionals_execF1129_Parms F1129_Parms;
 	F1129_Parms.bioWorld = bioWorld;
@@ -22978,10 +21978,9 @@ bool UBioAutoConditionals::F1129 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1128 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1128 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1128Ref { L"Function PlotManager.BioAutoConditionals.F1128", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1128 )
-		pFnF1128 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1128" );
+	UFunction* const pFnF1128 = pFnF1128Ref.Get ( );
 
 	UBioAutoConditionals_execF1128_Parms F1128_Parms;
 	F1128_Parms.bioWorld = bioWorld;
@@ -23001,10 +22000,9 @@ bool UBioAutoConditionals::F1128 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1127 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1127 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1127Ref { L"Function PlotManager.BioAutoConditionals.F1127", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1127 )
-		pFnF1127 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1127" );
+	UFunction* const pFnF1127 = pFnF1127Ref.Get ( );
 
 	UBioAutoConditionals_execF1127_Parms F1127_Parms;
 	F1127_Parms.bioWorld = bioWorld;
@@ -23024,10 +22022,9 @@ bool UBioAutoConditionals::F1127 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1032 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1032 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1032Ref { L"Function PlotManager.BioAutoConditionals.F1032", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1032 )
-		pFnF1032 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1032" );
+	UFunction* const pFnF1032 = pFnF1032Ref.Get ( );
 
 	UBioAutoConditionals_execF1032_Parms F1032_Parms;
 	F1032_Parms.bioWorld = bioWorld;
@@ -23047,10 +22044,9 @@ bool UBioAutoConditionals::F1032 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1635 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1635 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1635Ref { L"Function PlotManager.BioAutoConditionals.F1635", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1635 )
-		pFnF1635 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1635" );
+	UFunction* const pFnF1635 = pFnF1635Ref.Get ( );
 
 	UBioAutoConditionals_execF1635_Parms F1635_Parms;
 	F1635_Parms.bioWorld = bioWorld;
@@ -23070,10 +22066,9 @@ bool UBioAutoConditionals::F1635 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1634 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1634 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1634Ref { L"Function PlotManager.BioAutoConditionals.F1634", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1634 )
-		pFnF1634 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1634" );
+	UFunction* const pFnF1634 = pFnF1634Ref.Get ( );
 
 	UBioAutoConditionals_execF1634_Parms F1634_Parms;
 	F1634_Parms.bioWorld = bioWorld;
@@ -23093,10 +22088,9 @@ bool UBioAutoConditionals::F1634 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1633 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1633 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1633Ref { L"Function PlotManager.BioAutoConditionals.F1633", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1633 )
-		pFnF1633 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1633" );
+	UFunction* const pFnF1633 = pFnF1633Ref.Get ( );
 
 	UBioAutoConditionals_execF1633_Parms F1633_Parms;
 	F1633_Parms.bioWorld = bioWorld;
@@ -23116,10 +22110,9 @@ bool UBioAutoConditionals::F1633 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1632 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1632 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1632Ref { L"Function PlotManager.BioAutoConditionals.F1632", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1632 )
-		pFnF1632 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1632" );
+	UFunction* const pFnF1632 = pFnF1632Ref.Get ( );
 
 	UBioAutoConditionals_execF1632_Parms F1632_Parms;
 	F1632_Parms.bioWorld = bioWorld;
@@ -23139,10 +22132,9 @@ bool UBioAutoConditionals::F1632 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1631 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1631 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1631Ref { L"Function PlotManager.BioAutoConditionals.F1631", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1631 )
-		pFnF1631 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1631" );
+	UFunction* const pFnF1631 = pFnF1631Ref.Get ( );
 
 	UBioAutoConditionals_execF1631_Parms F1631_Parms;
 	F1631_Parms.bioWorld = bioWorld;
@@ -23162,10 +22154,9 @@ bool UBioAutoConditionals::F1631 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1630 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1630 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1630Ref { L"Function PlotManager.BioAutoConditionals.F1630", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1630 )
-		pFnF1630 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1630" );
+	UFunction* const pFnF1630 = pFnF1630Ref.Get ( );
 
 	UBioAutoConditionals_execF1630_Parms F1630_Parms;
 	F1630_Parms.bioWorld = bioWorld;
@@ -23185,10 +22176,9 @@ bool UBioAutoConditionals::F1630 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1629 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1629 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1629Ref { L"Function PlotManager.BioAutoConditionals.F1629", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1629 )
-		pFnF1629 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1629" );
+	UFunction* const pFnF1629 = pFnF1629Ref.Get ( );
 
 	UBioAutoConditionals_execF1629_Parms F1629_Parms;
 	F1629_Parms.bioWorld = bioWorld;
@@ -23208,10 +22198,9 @@ bool UBioAutoConditionals::F1629 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1320 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1320 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1320Ref { L"Function PlotManager.BioAutoConditionals.F1320", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1320 )
-		pFnF1320 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1320" );
+	UFunction* const pFnF1320 = pFnF1320Ref.Get ( );
 
 	UBioAutoConditionals_execF1320_Parms F1320_Parms;
 	F1320_Parms.bioWorld = bioWorld;
@@ -23231,10 +22220,9 @@ bool UBioAutoConditionals::F1320 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1319 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1319 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1319Ref { L"Function PlotManager.BioAutoConditionals.F1319", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1319 )
-		pFnF1319 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1319" );
+	UFunction* const pFnF1319 = pFnF1319Ref.Get ( );
 
 	UBioAutoConditionals_execF1319_Parms F1319_Parms;
 	F1319_Parms.bioWorld = bioWorld;
@@ -23254,10 +22242,9 @@ bool UBioAutoConditionals::F1319 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1318 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1318 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1318Ref { L"Function PlotManager.BioAutoConditionals.F1318", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1318 )
-		pFnF1318 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1318" );
+	UFunction* const pFnF1318 = pFnF1318Ref.Get ( );
 
 	UBioAutoConditionals_execF1318_Parms F1318_Parms;
 	F1318_Parms.bioWorld = bioWorld;
@@ -23277,10 +22264,9 @@ bool UBioAutoConditionals::F1318 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1317 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1317 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1317Ref { L"Function PlotManager.BioAutoConditionals.F1317", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1317 )
-		pFnF1317 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1317" );
+	UFunction* const pFnF1317 = pFnF1317Ref.Get ( );
 
 	UBioAutoConditionals_execF1317_Parms F1317_Parms;
 	F1317_Parms.bioWorld = bioWorld;
@@ -23300,10 +22286,9 @@ bool UBioAutoConditionals::F1317 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1518 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1518 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1518Ref { L"Function PlotManager.BioAutoConditionals.F1518", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1518 )
-		pFnF1518 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1518" );
+	UFunction* const pFnF1518 = pFnF1518Ref.Get ( );
 
 	UBioAutoConditionals_execF1518_Parms F1518_Parms;
 	F1518_Parms.bioWorld = bioWorld;
@@ -23323,10 +22308,9 @@ bool UBioAutoConditionals::F1518 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1517 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1517 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1517Ref { L"Function PlotManager.BioAutoConditionals.F1517", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1517 )
-		pFnF1517 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1517" );
+	UFunction* const pFnF1517 = pFnF1517Ref.Get ( );
 
 	UBioAutoConditionals_execF1517_Parms F1517_Parms;
 	F1517_Parms.bioWorld = bioWorld;
@@ -23346,10 +22330,9 @@ bool UBioAutoConditionals::F1517 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1328 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1328 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1328Ref { L"Function PlotManager.BioAutoConditionals.F1328", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1328 )
-		pFnF1328 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1328" );
+	UFunction* const pFnF1328 = pFnF1328Ref.Get ( );
 
 	UBioAutoConditionals_execF1328_Parms F1328_Parms;
 	F1328_Parms.bioWorld = bioWorld;
@@ -23369,10 +22352,9 @@ bool UBioAutoConditionals::F1328 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1325 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1325 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1325Ref { L"Function PlotManager.BioAutoConditionals.F1325", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1325 )
-		pFnF1325 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1325" );
+	UFunction* const pFnF1325 = pFnF1325Ref.Get ( );
 
 	UBioAutoConditionals_execF1325_Parms F1325_Parms;
 	F1325_Parms.bioWorld = bioWorld;
@@ -23392,10 +22374,9 @@ bool UBioAutoConditionals::F1325 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1324 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1324 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1324Ref { L"Function PlotManager.BioAutoConditionals.F1324", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1324 )
-		pFnF1324 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1324" );
+	UFunction* const pFnF1324 = pFnF1324Ref.Get ( );
 
 	UBioAutoConditionals_execF1324_Parms F1324_Parms;
 	F1324_Parms.bioWorld = bioWorld;
@@ -23415,10 +22396,9 @@ bool UBioAutoConditionals::F1324 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F980 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF980 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF980Ref { L"Function PlotManager.BioAutoConditionals.F980", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF980 )
-		pFnF980 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F980" );
+	UFunction* const pFnF980 = pFnF980Ref.Get ( );
 
 	UBioAutoConditionals_execF980_Parms F980_Parms;
 	F980_Parms.bioWorld = bioWorld;
@@ -23438,10 +22418,9 @@ bool UBioAutoConditionals::F980 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F979 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF979 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF979Ref { L"Function PlotManager.BioAutoConditionals.F979", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF979 )
-		pFnF979 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F979" );
+	UFunction* const pFnF979 = pFnF979Ref.Get ( );
 
 	UBioAutoConditionals_execF979_Parms F979_Parms;
 	F979_Parms.bioWorld = bioWorld;
@@ -23461,10 +22440,9 @@ bool UBioAutoConditionals::F979 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F978 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF978 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF978Ref { L"Function PlotManager.BioAutoConditionals.F978", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF978 )
-		pFnF978 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F978" );
+	UFunction* const pFnF978 = pFnF978Ref.Get ( );
 
 	UBioAutoConditionals_execF978_Parms F978_Parms;
 	F978_Parms.bioWorld = bioWorld;
@@ -23484,10 +22462,9 @@ bool UBioAutoConditionals::F978 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F977 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF977 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF977Ref { L"Function PlotManager.BioAutoConditionals.F977", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF977 )
-		pFnF977 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F977" );
+	UFunction* const pFnF977 = pFnF977Ref.Get ( );
 
 	UBioAutoConditionals_execF977_Parms F977_Parms;
 	F977_Parms.bioWorld = bioWorld;
@@ -23507,10 +22484,9 @@ bool UBioAutoConditionals::F977 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F976 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF976 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF976Ref { L"Function PlotManager.BioAutoConditionals.F976", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF976 )
-		pFnF976 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F976" );
+	UFunction* const pFnF976 = pFnF976Ref.Get ( );
 
 	UBioAutoConditionals_execF976_Parms F976_Parms;
 	F976_Parms.bioWorld = bioWorld;
@@ -23530,10 +22506,9 @@ bool UBioAutoConditionals::F976 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F975 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF975 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF975Ref { L"Function PlotManager.BioAutoConditionals.F975", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF975 )
-		pFnF975 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F975" );
+	UFunction* const pFnF975 = pFnF975Ref.Get ( );
 
 	UBioAutoConditionals_execF975_Parms F975_Parms;
 	F975_Parms.bioWorld = bioWorld;
@@ -23553,10 +22528,9 @@ bool UBioAutoConditionals::F975 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F974 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF974 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF974Ref { L"Function PlotManager.BioAutoConditionals.F974", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF974 )
-		pFnF974 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F974" );
+	UFunction* const pFnF974 = pFnF974Ref.Get ( );
 
 	UBioAutoConditionals_execF974_Parms F974_Parms;
 	F974_Parms.bioWorld = bioWorld;
@@ -23576,10 +22550,9 @@ bool UBioAutoConditionals::F974 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F973 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF973 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF973Ref { L"Function PlotManager.BioAutoConditionals.F973", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF973 )
-		pFnF973 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F973" );
+	UFunction* const pFnF973 = pFnF973Ref.Get ( );
 
 	UBioAutoConditionals_execF973_Parms F973_Parms;
 	F973_Parms.bioWorld = bioWorld;
@@ -23599,10 +22572,9 @@ bool UBioAutoConditionals::F973 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F972 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF972 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF972Ref { L"Function PlotManager.BioAutoConditionals.F972", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF972 )
-		pFnF972 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F972" );
+	UFunction* const pFnF972 = pFnF972Ref.Get ( );
 
 	UBioAutoConditionals_execF972_Parms F972_Parms;
 	F972_Parms.bioWorld = bioWorld;
@@ -23622,10 +22594,9 @@ bool UBioAutoConditionals::F972 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F971 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF971 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF971Ref { L"Function PlotManager.BioAutoConditionals.F971", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF971 )
-		pFnF971 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F971" );
+	UFunction* const pFnF971 = pFnF971Ref.Get ( );
 
 	UBioAutoConditionals_execF971_Parms F971_Parms;
 	F971_Parms.bioWorld = bioWorld;
@@ -23645,10 +22616,9 @@ bool UBioAutoConditionals::F971 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F970 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF970 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF970Ref { L"Function PlotManager.BioAutoConditionals.F970", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF970 )
-		pFnF970 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F970" );
+	UFunction* const pFnF970 = pFnF970Ref.Get ( );
 
 	UBioAutoConditionals_execF970_Parms F970_Parms;
 	F970_Parms.bioWorld = bioWorld;
@@ -23668,10 +22638,9 @@ bool UBioAutoConditionals::F970 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F969 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF969 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF969Ref { L"Function PlotManager.BioAutoConditionals.F969", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF969 )
-		pFnF969 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F969" );
+	UFunction* const pFnF969 = pFnF969Ref.Get ( );
 
 	UBioAutoConditionals_execF969_Parms F969_Parms;
 	F969_Parms.bioWorld = bioWorld;
@@ -23691,10 +22660,9 @@ bool UBioAutoConditionals::F969 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F968 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF968 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF968Ref { L"Function PlotManager.BioAutoConditionals.F968", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF968 )
-		pFnF968 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F968" );
+	UFunction* const pFnF968 = pFnF968Ref.Get ( );
 
 	UBioAutoConditionals_execF968_Parms F968_Parms;
 	F968_Parms.bioWorld = bioWorld;
@@ -23714,10 +22682,9 @@ bool UBioAutoConditionals::F968 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F967 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF967 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF967Ref { L"Function PlotManager.BioAutoConditionals.F967", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF967 )
-		pFnF967 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F967" );
+	UFunction* const pFnF967 = pFnF967Ref.Get ( );
 
 	UBioAutoConditionals_execF967_Parms F967_Parms;
 	F967_Parms.bioWorld = bioWorld;
@@ -23737,10 +22704,9 @@ bool UBioAutoConditionals::F967 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F966 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF966 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF966Ref { L"Function PlotManager.BioAutoConditionals.F966", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF966 )
-		pFnF966 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F966" );
+	UFunction* const pFnF966 = pFnF966Ref.Get ( );
 
 	UBioAutoConditionals_execF966_Parms F966_Parms;
 	F966_Parms.bioWorld = bioWorld;
@@ -23760,10 +22726,9 @@ bool UBioAutoConditionals::F966 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1346 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1346 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1346Ref { L"Function PlotManager.BioAutoConditionals.F1346", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1346 )
-		pFnF1346 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1346" );
+	UFunction* const pFnF1346 = pFnF1346Ref.Get ( );
 
 	UBioAutoConditionals_execF1346_Parms F1346_Parms;
 	F1346_Parms.bioWorld = bioWorld;
@@ -23783,10 +22748,9 @@ bool UBioAutoConditionals::F1346 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1345 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1345 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1345Ref { L"Function PlotManager.BioAutoConditionals.F1345", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1345 )
-		pFnF1345 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1345" );
+	UFunction* const pFnF1345 = pFnF1345Ref.Get ( );
 
 	UBioAutoConditionals_execF1345_Parms F1345_Parms;
 	F1345_Parms.bioWorld = bioWorld;
@@ -23806,10 +22770,9 @@ bool UBioAutoConditionals::F1345 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1274 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1274 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1274Ref { L"Function PlotManager.BioAutoConditionals.F1274", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1274 )
-		pFnF1274 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1274" );
+	UFunction* const pFnF1274 = pFnF1274Ref.Get ( );
 
 	UBioAutoConditionals_execF1274_Parms F1274_Parms;
 	F1274_Parms.bioWorld = bioWorld;
@@ -23829,10 +22792,9 @@ bool UBioAutoConditionals::F1274 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1273 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1273 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1273Ref { L"Function PlotManager.BioAutoConditionals.F1273", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1273 )
-		pFnF1273 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1273" );
+	UFunction* const pFnF1273 = pFnF1273Ref.Get ( );
 
 	UBioAutoConditionals_execF1273_Parms F1273_Parms;
 	F1273_Parms.bioWorld = bioWorld;
@@ -23852,10 +22814,9 @@ bool UBioAutoConditionals::F1273 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F983 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF983 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF983Ref { L"Function PlotManager.BioAutoConditionals.F983", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF983 )
-		pFnF983 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F983" );
+	UFunction* const pFnF983 = pFnF983Ref.Get ( );
 
 	UBioAutoConditionals_execF983_Parms F983_Parms;
 	F983_Parms.bioWorld = bioWorld;
@@ -23875,10 +22836,9 @@ bool UBioAutoConditionals::F983 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F965 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF965 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF965Ref { L"Function PlotManager.BioAutoConditionals.F965", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF965 )
-		pFnF965 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F965" );
+	UFunction* const pFnF965 = pFnF965Ref.Get ( );
 
 	UBioAutoConditionals_execF965_Parms F965_Parms;
 	F965_Parms.bioWorld = bioWorld;
@@ -23898,10 +22858,9 @@ bool UBioAutoConditionals::F965 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F964 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF964 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF964Ref { L"Function PlotManager.BioAutoConditionals.F964", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF964 )
-		pFnF964 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F964" );
+	UFunction* const pFnF964 = pFnF964Ref.Get ( );
 
 	UBioAutoConditionals_execF964_Parms F964_Parms;
 	F964_Parms.bioWorld = bioWorld;
@@ -23921,10 +22880,9 @@ bool UBioAutoConditionals::F964 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F963 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF963 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF963Ref { L"Function PlotManager.BioAutoConditionals.F963", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF963 )
-		pFnF963 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F963" );
+	UFunction* const pFnF963 = pFnF963Ref.Get ( );
 
 	UBioAutoConditionals_execF963_Parms F963_Parms;
 	F963_Parms.bioWorld = bioWorld;
@@ -23944,10 +22902,9 @@ bool UBioAutoConditionals::F963 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F891 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF891 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF891Ref { L"Function PlotManager.BioAutoConditionals.F891", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF891 )
-		pFnF891 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F891" );
+	UFunction* const pFnF891 = pFnF891Ref.Get ( );
 
 	UBioAutoConditionals_execF891_Parms F891_Parms;
 	F891_Parms.bioWorld = bioWorld;
@@ -23967,10 +22924,9 @@ bool UBioAutoConditionals::F891 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1074 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1074 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1074Ref { L"Function PlotManager.BioAutoConditionals.F1074", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1074 )
-		pFnF1074 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1074" );
+	UFunction* const pFnF1074 = pFnF1074Ref.Get ( );
 
 	UBioAutoConditionals_execF1074_Parms F1074_Parms;
 	F1074_Parms.bioWorld = bioWorld;
@@ -23990,10 +22946,9 @@ bool UBioAutoConditionals::F1074 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1073 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1073 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1073Ref { L"Function PlotManager.BioAutoConditionals.F1073", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1073 )
-		pFnF1073 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1073" );
+	UFunction* const pFnF1073 = pFnF1073Ref.Get ( );
 
 	UBioAutoConditionals_execF1073_Parms F1073_Parms;
 	F1073_Parms.bioWorld = bioWorld;
@@ -24013,10 +22968,9 @@ bool UBioAutoConditionals::F1073 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1072 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1072 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1072Ref { L"Function PlotManager.BioAutoConditionals.F1072", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1072 )
-		pFnF1072 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1072" );
+	UFunction* const pFnF1072 = pFnF1072Ref.Get ( );
 
 	UBioAutoConditionals_execF1072_Parms F1072_Parms;
 	F1072_Parms.bioWorld = bioWorld;
@@ -24036,10 +22990,9 @@ bool UBioAutoConditionals::F1072 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1071 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1071 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1071Ref { L"Function PlotManager.BioAutoConditionals.F1071", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1071 )
-		pFnF1071 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1071" );
+	UFunction* const pFnF1071 = pFnF1071Ref.Get ( );
 
 	UBioAutoConditionals_execF1071_Parms F1071_Parms;
 	F1071_Parms.bioWorld = bioWorld;
@@ -24059,10 +23012,9 @@ bool UBioAutoConditionals::F1071 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1070 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1070 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1070Ref { L"Function PlotManager.BioAutoConditionals.F1070", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1070 )
-		pFnF1070 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1070" );
+	UFunction* const pFnF1070 = pFnF1070Ref.Get ( );
 
 	UBioAutoConditionals_execF1070_Parms F1070_Parms;
 	F1070_Parms.bioWorld = bioWorld;
@@ -24082,10 +23034,9 @@ bool UBioAutoConditionals::F1070 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1069 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1069 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1069Ref { L"Function PlotManager.BioAutoConditionals.F1069", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1069 )
-		pFnF1069 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1069" );
+	UFunction* const pFnF1069 = pFnF1069Ref.Get ( );
 
 	UBioAutoConditionals_execF1069_Parms F1069_Parms;
 	F1069_Parms.bioWorld = bioWorld;
@@ -24105,10 +23056,9 @@ bool UBioAutoConditionals::F1069 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1068 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1068 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1068Ref { L"Function PlotManager.BioAutoConditionals.F1068", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1068 )
-		pFnF1068 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1068" );
+	UFunction* const pFnF1068 = pFnF1068Ref.Get ( );
 
 	UBioAutoConditionals_execF1068_Parms F1068_Parms;
 	F1068_Parms.bioWorld = bioWorld;
@@ -24128,10 +23078,9 @@ bool UBioAutoConditionals::F1068 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1067 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1067 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1067Ref { L"Function PlotManager.BioAutoConditionals.F1067", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1067 )
-		pFnF1067 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1067" );
+	UFunction* const pFnF1067 = pFnF1067Ref.Get ( );
 
 	UBioAutoConditionals_execF1067_Parms F1067_Parms;
 	F1067_Parms.bioWorld = bioWorld;
@@ -24151,10 +23100,9 @@ bool UBioAutoConditionals::F1067 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1066 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1066 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1066Ref { L"Function PlotManager.BioAutoConditionals.F1066", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1066 )
-		pFnF1066 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1066" );
+	UFunction* const pFnF1066 = pFnF1066Ref.Get ( );
 
 	UBioAutoConditionals_execF1066_Parms F1066_Parms;
 	F1066_Parms.bioWorld = bioWorld;
@@ -24174,10 +23122,9 @@ bool UBioAutoConditionals::F1066 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1065 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1065 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1065Ref { L"Function PlotManager.BioAutoConditionals.F1065", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1065 )
-		pFnF1065 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1065" );
+	UFunction* const pFnF1065 = pFnF1065Ref.Get ( );
 
 	UBioAutoConditionals_execF1065_Parms F1065_Parms;
 	F1065_Parms.bioWorld = bioWorld;
@@ -24197,10 +23144,9 @@ bool UBioAutoConditionals::F1065 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1064 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1064 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1064Ref { L"Function PlotManager.BioAutoConditionals.F1064", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1064 )
-		pFnF1064 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1064" );
+	UFunction* const pFnF1064 = pFnF1064Ref.Get ( );
 
 	UBioAutoConditionals_execF1064_Parms F1064_Parms;
 	F1064_Parms.bioWorld = bioWorld;
@@ -24220,10 +23166,9 @@ bool UBioAutoConditionals::F1064 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1063 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1063 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1063Ref { L"Function PlotManager.BioAutoConditionals.F1063", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1063 )
-		pFnF1063 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1063" );
+	UFunction* const pFnF1063 = pFnF1063Ref.Get ( );
 
 	UBioAutoConditionals_execF1063_Parms F1063_Parms;
 	F1063_Parms.bioWorld = bioWorld;
@@ -24243,10 +23188,9 @@ bool UBioAutoConditionals::F1063 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1062 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1062 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1062Ref { L"Function PlotManager.BioAutoConditionals.F1062", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1062 )
-		pFnF1062 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1062" );
+	UFunction* const pFnF1062 = pFnF1062Ref.Get ( );
 
 	UBioAutoConditionals_execF1062_Parms F1062_Parms;
 	F1062_Parms.bioWorld = bioWorld;
@@ -24266,10 +23210,9 @@ bool UBioAutoConditionals::F1062 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1030 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1030 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1030Ref { L"Function PlotManager.BioAutoConditionals.F1030", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1030 )
-		pFnF1030 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1030" );
+	UFunction* const pFnF1030 = pFnF1030Ref.Get ( );
 
 	UBioAutoConditionals_execF1030_Parms F1030_Parms;
 	F1030_Parms.bioWorld = bioWorld;
@@ -24289,10 +23232,9 @@ bool UBioAutoConditionals::F1030 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1029 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1029 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1029Ref { L"Function PlotManager.BioAutoConditionals.F1029", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1029 )
-		pFnF1029 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1029" );
+	UFunction* const pFnF1029 = pFnF1029Ref.Get ( );
 
 	UBioAutoConditionals_execF1029_Parms F1029_Parms;
 	F1029_Parms.bioWorld = bioWorld;
@@ -24312,10 +23254,9 @@ bool UBioAutoConditionals::F1029 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1024 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1024 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1024Ref { L"Function PlotManager.BioAutoConditionals.F1024", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1024 )
-		pFnF1024 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1024" );
+	UFunction* const pFnF1024 = pFnF1024Ref.Get ( );
 
 	UBioAutoConditionals_execF1024_Parms F1024_Parms;
 	F1024_Parms.bioWorld = bioWorld;
@@ -24335,10 +23276,9 @@ bool UBioAutoConditionals::F1024 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1023 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1023 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1023Ref { L"Function PlotManager.BioAutoConditionals.F1023", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1023 )
-		pFnF1023 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1023" );
+	UFunction* const pFnF1023 = pFnF1023Ref.Get ( );
 
 	UBioAutoConditionals_execF1023_Parms F1023_Parms;
 	F1023_Parms.bioWorld = bioWorld;
@@ -24358,10 +23298,9 @@ bool UBioAutoConditionals::F1023 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1022 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1022 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1022Ref { L"Function PlotManager.BioAutoConditionals.F1022", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1022 )
-		pFnF1022 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1022" );
+	UFunction* const pFnF1022 = pFnF1022Ref.Get ( );
 
 	UBioAutoConditionals_execF1022_Parms F1022_Parms;
 	F1022_Parms.bioWorld = bioWorld;
@@ -24381,10 +23320,9 @@ bool UBioAutoConditionals::F1022 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1021 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1021 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1021Ref { L"Function PlotManager.BioAutoConditionals.F1021", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1021 )
-		pFnF1021 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1021" );
+	UFunction* const pFnF1021 = pFnF1021Ref.Get ( );
 
 	UBioAutoConditionals_execF1021_Parms F1021_Parms;
 	F1021_Parms.bioWorld = bioWorld;
@@ -24404,10 +23342,9 @@ bool UBioAutoConditionals::F1021 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1020 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1020 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1020Ref { L"Function PlotManager.BioAutoConditionals.F1020", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1020 )
-		pFnF1020 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1020" );
+	UFunction* const pFnF1020 = pFnF1020Ref.Get ( );
 
 	UBioAutoConditionals_execF1020_Parms F1020_Parms;
 	F1020_Parms.bioWorld = bioWorld;
@@ -24427,10 +23364,9 @@ bool UBioAutoConditionals::F1020 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F890 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF890 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF890Ref { L"Function PlotManager.BioAutoConditionals.F890", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF890 )
-		pFnF890 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F890" );
+	UFunction* const pFnF890 = pFnF890Ref.Get ( );
 
 	UBioAutoConditionals_execF890_Parms F890_Parms;
 	F890_Parms.bioWorld = bioWorld;
@@ -24450,10 +23386,9 @@ bool UBioAutoConditionals::F890 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1088 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1088 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1088Ref { L"Function PlotManager.BioAutoConditionals.F1088", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1088 )
-		pFnF1088 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1088" );
+	UFunction* const pFnF1088 = pFnF1088Ref.Get ( );
 
 	UBioAutoConditionals_execF1088_Parms F1088_Parms;
 	F1088_Parms.bioWorld = bioWorld;
@@ -24473,10 +23408,9 @@ bool UBioAutoConditionals::F1088 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1087 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1087 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1087Ref { L"Function PlotManager.BioAutoConditionals.F1087", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1087 )
-		pFnF1087 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1087" );
+	UFunction* const pFnF1087 = pFnF1087Ref.Get ( );
 
 	UBioAutoConditionals_execF1087_Parms F1087_Parms;
 	F1087_Parms.bioWorld = bioWorld;
@@ -24496,10 +23430,9 @@ bool UBioAutoConditionals::F1087 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1086 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1086 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1086Ref { L"Function PlotManager.BioAutoConditionals.F1086", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1086 )
-		pFnF1086 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1086" );
+	UFunction* const pFnF1086 = pFnF1086Ref.Get ( );
 
 	UBioAutoConditionals_execF1086_Parms F1086_Parms;
 	F1086_Parms.bioWorld = bioWorld;
@@ -24519,10 +23452,9 @@ bool UBioAutoConditionals::F1086 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1085 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1085 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1085Ref { L"Function PlotManager.BioAutoConditionals.F1085", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1085 )
-		pFnF1085 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1085" );
+	UFunction* const pFnF1085 = pFnF1085Ref.Get ( );
 
 	UBioAutoConditionals_execF1085_Parms F1085_Parms;
 	F1085_Parms.bioWorld = bioWorld;
@@ -24542,10 +23474,9 @@ bool UBioAutoConditionals::F1085 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1084 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1084 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1084Ref { L"Function PlotManager.BioAutoConditionals.F1084", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1084 )
-		pFnF1084 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1084" );
+	UFunction* const pFnF1084 = pFnF1084Ref.Get ( );
 
 	UBioAutoConditionals_execF1084_Parms F1084_Parms;
 	F1084_Parms.bioWorld = bioWorld;
@@ -24565,10 +23496,9 @@ bool UBioAutoConditionals::F1084 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1083 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1083 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1083Ref { L"Function PlotManager.BioAutoConditionals.F1083", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1083 )
-		pFnF1083 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1083" );
+	UFunction* const pFnF1083 = pFnF1083Ref.Get ( );
 
 	UBioAutoConditionals_execF1083_Parms F1083_Parms;
 	F1083_Parms.bioWorld = bioWorld;
@@ -24588,10 +23518,9 @@ bool UBioAutoConditionals::F1083 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1082 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1082 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1082Ref { L"Function PlotManager.BioAutoConditionals.F1082", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1082 )
-		pFnF1082 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1082" );
+	UFunction* const pFnF1082 = pFnF1082Ref.Get ( );
 
 	UBioAutoConditionals_execF1082_Parms F1082_Parms;
 	F1082_Parms.bioWorld = bioWorld;
@@ -24611,10 +23540,9 @@ bool UBioAutoConditionals::F1082 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1081 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1081 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1081Ref { L"Function PlotManager.BioAutoConditionals.F1081", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1081 )
-		pFnF1081 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1081" );
+	UFunction* const pFnF1081 = pFnF1081Ref.Get ( );
 
 	UBioAutoConditionals_execF1081_Parms F1081_Parms;
 	F1081_Parms.bioWorld = bioWorld;
@@ -24634,10 +23562,9 @@ bool UBioAutoConditionals::F1081 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1080 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1080 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1080Ref { L"Function PlotManager.BioAutoConditionals.F1080", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1080 )
-		pFnF1080 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1080" );
+	UFunction* const pFnF1080 = pFnF1080Ref.Get ( );
 
 	UBioAutoConditionals_execF1080_Parms F1080_Parms;
 	F1080_Parms.bioWorld = bioWorld;
@@ -24657,10 +23584,9 @@ bool UBioAutoConditionals::F1080 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1079 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1079 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1079Ref { L"Function PlotManager.BioAutoConditionals.F1079", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1079 )
-		pFnF1079 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1079" );
+	UFunction* const pFnF1079 = pFnF1079Ref.Get ( );
 
 	UBioAutoConditionals_execF1079_Parms F1079_Parms;
 	F1079_Parms.bioWorld = bioWorld;
@@ -24680,10 +23606,9 @@ bool UBioAutoConditionals::F1079 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1627 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1627 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1627Ref { L"Function PlotManager.BioAutoConditionals.F1627", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1627 )
-		pFnF1627 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1627" );
+	UFunction* const pFnF1627 = pFnF1627Ref.Get ( );
 
 	UBioAutoConditionals_execF1627_Parms F1627_Parms;
 	F1627_Parms.bioWorld = bioWorld;
@@ -24703,10 +23628,9 @@ bool UBioAutoConditionals::F1627 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1626 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1626 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1626Ref { L"Function PlotManager.BioAutoConditionals.F1626", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1626 )
-		pFnF1626 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1626" );
+	UFunction* const pFnF1626 = pFnF1626Ref.Get ( );
 
 	UBioAutoConditionals_execF1626_Parms F1626_Parms;
 	F1626_Parms.bioWorld = bioWorld;
@@ -24726,10 +23650,9 @@ bool UBioAutoConditionals::F1626 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1015 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1015 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1015Ref { L"Function PlotManager.BioAutoConditionals.F1015", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1015 )
-		pFnF1015 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1015" );
+	UFunction* const pFnF1015 = pFnF1015Ref.Get ( );
 
 	UBioAutoConditionals_execF1015_Parms F1015_Parms;
 	F1015_Parms.bioWorld = bioWorld;
@@ -24749,10 +23672,9 @@ bool UBioAutoConditionals::F1015 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1005 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1005 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1005Ref { L"Function PlotManager.BioAutoConditionals.F1005", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1005 )
-		pFnF1005 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1005" );
+	UFunction* const pFnF1005 = pFnF1005Ref.Get ( );
 
 	UBioAutoConditionals_execF1005_Parms F1005_Parms;
 	F1005_Parms.bioWorld = bioWorld;
@@ -24772,10 +23694,9 @@ bool UBioAutoConditionals::F1005 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F889 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF889 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF889Ref { L"Function PlotManager.BioAutoConditionals.F889", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF889 )
-		pFnF889 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F889" );
+	UFunction* const pFnF889 = pFnF889Ref.Get ( );
 
 	UBioAutoConditionals_execF889_Parms F889_Parms;
 	F889_Parms.bioWorld = bioWorld;
@@ -24795,10 +23716,9 @@ bool UBioAutoConditionals::F889 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F819 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF819 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF819Ref { L"Function PlotManager.BioAutoConditionals.F819", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF819 )
-		pFnF819 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F819" );
+	UFunction* const pFnF819 = pFnF819Ref.Get ( );
 
 	UBioAutoConditionals_execF819_Parms F819_Parms;
 	F819_Parms.bioWorld = bioWorld;
@@ -24818,10 +23738,9 @@ bool UBioAutoConditionals::F819 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F818 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF818 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF818Ref { L"Function PlotManager.BioAutoConditionals.F818", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF818 )
-		pFnF818 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F818" );
+	UFunction* const pFnF818 = pFnF818Ref.Get ( );
 
 	UBioAutoConditionals_execF818_Parms F818_Parms;
 	F818_Parms.bioWorld = bioWorld;
@@ -24841,10 +23760,9 @@ bool UBioAutoConditionals::F818 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F817 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF817 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF817Ref { L"Function PlotManager.BioAutoConditionals.F817", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF817 )
-		pFnF817 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F817" );
+	UFunction* const pFnF817 = pFnF817Ref.Get ( );
 
 	UBioAutoConditionals_execF817_Parms F817_Parms;
 	F817_Parms.bioWorld = bioWorld;
@@ -24864,10 +23782,9 @@ bool UBioAutoConditionals::F817 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F816 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF816 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF816Ref { L"Function PlotManager.BioAutoConditionals.F816", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF816 )
-		pFnF816 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F816" );
+	UFunction* const pFnF816 = pFnF816Ref.Get ( );
 
 	UBioAutoConditionals_execF816_Parms F816_Parms;
 	F816_Parms.bioWorld = bioWorld;
@@ -24887,10 +23804,9 @@ bool UBioAutoConditionals::F816 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1522 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1522 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1522Ref { L"Function PlotManager.BioAutoConditionals.F1522", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1522 )
-		pFnF1522 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1522" );
+	UFunction* const pFnF1522 = pFnF1522Ref.Get ( );
 
 	UBioAutoConditionals_execF1522_Parms F1522_Parms;
 	F1522_Parms.bioWorld = bioWorld;
@@ -24910,10 +23826,9 @@ bool UBioAutoConditionals::F1522 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1014 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1014 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1014Ref { L"Function PlotManager.BioAutoConditionals.F1014", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1014 )
-		pFnF1014 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1014" );
+	UFunction* const pFnF1014 = pFnF1014Ref.Get ( );
 
 	UBioAutoConditionals_execF1014_Parms F1014_Parms;
 	F1014_Parms.bioWorld = bioWorld;
@@ -24933,10 +23848,9 @@ bool UBioAutoConditionals::F1014 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1013 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1013 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1013Ref { L"Function PlotManager.BioAutoConditionals.F1013", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1013 )
-		pFnF1013 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1013" );
+	UFunction* const pFnF1013 = pFnF1013Ref.Get ( );
 
 	UBioAutoConditionals_execF1013_Parms F1013_Parms;
 	F1013_Parms.bioWorld = bioWorld;
@@ -24956,10 +23870,9 @@ bool UBioAutoConditionals::F1013 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1012 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1012 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1012Ref { L"Function PlotManager.BioAutoConditionals.F1012", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1012 )
-		pFnF1012 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1012" );
+	UFunction* const pFnF1012 = pFnF1012Ref.Get ( );
 
 	UBioAutoConditionals_execF1012_Parms F1012_Parms;
 	F1012_Parms.bioWorld = bioWorld;
@@ -24979,10 +23892,9 @@ bool UBioAutoConditionals::F1012 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1004 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1004 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1004Ref { L"Function PlotManager.BioAutoConditionals.F1004", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1004 )
-		pFnF1004 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1004" );
+	UFunction* const pFnF1004 = pFnF1004Ref.Get ( );
 
 	UBioAutoConditionals_execF1004_Parms F1004_Parms;
 	F1004_Parms.bioWorld = bioWorld;
@@ -25002,10 +23914,9 @@ bool UBioAutoConditionals::F1004 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1002 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1002 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1002Ref { L"Function PlotManager.BioAutoConditionals.F1002", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1002 )
-		pFnF1002 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1002" );
+	UFunction* const pFnF1002 = pFnF1002Ref.Get ( );
 
 	UBioAutoConditionals_execF1002_Parms F1002_Parms;
 	F1002_Parms.bioWorld = bioWorld;
@@ -25025,10 +23936,9 @@ bool UBioAutoConditionals::F1002 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F998 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF998 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF998Ref { L"Function PlotManager.BioAutoConditionals.F998", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF998 )
-		pFnF998 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F998" );
+	UFunction* const pFnF998 = pFnF998Ref.Get ( );
 
 	UBioAutoConditionals_execF998_Parms F998_Parms;
 	F998_Parms.bioWorld = bioWorld;
@@ -25048,10 +23958,9 @@ bool UBioAutoConditionals::F998 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F932 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF932 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF932Ref { L"Function PlotManager.BioAutoConditionals.F932", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF932 )
-		pFnF932 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F932" );
+	UFunction* const pFnF932 = pFnF932Ref.Get ( );
 
 	UBioAutoConditionals_execF932_Parms F932_Parms;
 	F932_Parms.bioWorld = bioWorld;
@@ -25071,10 +23980,9 @@ bool UBioAutoConditionals::F932 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F931 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF931 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF931Ref { L"Function PlotManager.BioAutoConditionals.F931", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF931 )
-		pFnF931 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F931" );
+	UFunction* const pFnF931 = pFnF931Ref.Get ( );
 
 	UBioAutoConditionals_execF931_Parms F931_Parms;
 	F931_Parms.bioWorld = bioWorld;
@@ -25094,10 +24002,9 @@ bool UBioAutoConditionals::F931 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F667 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF667 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF667Ref { L"Function PlotManager.BioAutoConditionals.F667", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF667 )
-		pFnF667 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F667" );
+	UFunction* const pFnF667 = pFnF667Ref.Get ( );
 
 	UBioAutoConditionals_execF667_Parms F667_Parms;
 	F667_Parms.bioWorld = bioWorld;
@@ -25117,10 +24024,9 @@ bool UBioAutoConditionals::F667 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F987 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF987 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF987Ref { L"Function PlotManager.BioAutoConditionals.F987", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF987 )
-		pFnF987 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F987" );
+	UFunction* const pFnF987 = pFnF987Ref.Get ( );
 
 	UBioAutoConditionals_execF987_Parms F987_Parms;
 	F987_Parms.bioWorld = bioWorld;
@@ -25140,10 +24046,9 @@ bool UBioAutoConditionals::F987 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F988 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF988 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF988Ref { L"Function PlotManager.BioAutoConditionals.F988", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF988 )
-		pFnF988 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F988" );
+	UFunction* const pFnF988 = pFnF988Ref.Get ( );
 
 	UBioAutoConditionals_execF988_Parms F988_Parms;
 	F988_Parms.bioWorld = bioWorld;
@@ -25163,10 +24068,9 @@ bool UBioAutoConditionals::F988 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F540 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF540 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF540Ref { L"Function PlotManager.BioAutoConditionals.F540", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF540 )
-		pFnF540 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F540" );
+	UFunction* const pFnF540 = pFnF540Ref.Get ( );
 
 	UBioAutoConditionals_execF540_Parms F540_Parms;
 	F540_Parms.bioWorld = bioWorld;
@@ -25186,10 +24090,9 @@ bool UBioAutoConditionals::F540 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F539 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF539 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF539Ref { L"Function PlotManager.BioAutoConditionals.F539", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF539 )
-		pFnF539 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F539" );
+	UFunction* const pFnF539 = pFnF539Ref.Get ( );
 
 	UBioAutoConditionals_execF539_Parms F539_Parms;
 	F539_Parms.bioWorld = bioWorld;
@@ -25209,10 +24112,9 @@ bool UBioAutoConditionals::F539 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F538 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF538 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF538Ref { L"Function PlotManager.BioAutoConditionals.F538", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF538 )
-		pFnF538 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F538" );
+	UFunction* const pFnF538 = pFnF538Ref.Get ( );
 
 	UBioAutoConditionals_execF538_Parms F538_Parms;
 	F538_Parms.bioWorld = bioWorld;
@@ -25232,10 +24134,9 @@ bool UBioAutoConditionals::F538 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F537 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF537 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF537Ref { L"Function PlotManager.BioAutoConditionals.F537", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF537 )
-		pFnF537 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F537" );
+	UFunction* const pFnF537 = pFnF537Ref.Get ( );
 
 	UBioAutoConditionals_execF537_Parms F537_Parms;
 	F537_Parms.bioWorld = bioWorld;
@@ -25255,10 +24156,9 @@ bool UBioAutoConditionals::F537 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F536 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF536 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF536Ref { L"Function PlotManager.BioAutoConditionals.F536", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF536 )
-		pFnF536 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F536" );
+	UFunction* const pFnF536 = pFnF536Ref.Get ( );
 
 	UBioAutoConditionals_execF536_Parms F536_Parms;
 	F536_Parms.bioWorld = bioWorld;
@@ -25278,10 +24178,9 @@ bool UBioAutoConditionals::F536 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F535 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF535 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF535Ref { L"Function PlotManager.BioAutoConditionals.F535", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF535 )
-		pFnF535 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F535" );
+	UFunction* const pFnF535 = pFnF535Ref.Get ( );
 
 	UBioAutoConditionals_execF535_Parms F535_Parms;
 	F535_Parms.bioWorld = bioWorld;
@@ -25301,10 +24200,9 @@ bool UBioAutoConditionals::F535 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F534 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF534 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF534Ref { L"Function PlotManager.BioAutoConditionals.F534", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF534 )
-		pFnF534 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F534" );
+	UFunction* const pFnF534 = pFnF534Ref.Get ( );
 
 	UBioAutoConditionals_execF534_Parms F534_Parms;
 	F534_Parms.bioWorld = bioWorld;
@@ -25324,10 +24222,9 @@ bool UBioAutoConditionals::F534 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F533 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF533 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF533Ref { L"Function PlotManager.BioAutoConditionals.F533", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF533 )
-		pFnF533 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F533" );
+	UFunction* const pFnF533 = pFnF533Ref.Get ( );
 
 	UBioAutoConditionals_execF533_Parms F533_Parms;
 	F533_Parms.bioWorld = bioWorld;
@@ -25347,10 +24244,9 @@ bool UBioAutoConditionals::F533 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F532 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF532 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF532Ref { L"Function PlotManager.BioAutoConditionals.F532", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF532 )
-		pFnF532 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F532" );
+	UFunction* const pFnF532 = pFnF532Ref.Get ( );
 
 	UBioAutoConditionals_execF532_Parms F532_Parms;
 	F532_Parms.bioWorld = bioWorld;
@@ -25370,10 +24266,9 @@ bool UBioAutoConditionals::F532 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F531 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF531 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF531Ref { L"Function PlotManager.BioAutoConditionals.F531", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF531 )
-		pFnF531 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F531" );
+	UFunction* const pFnF531 = pFnF531Ref.Get ( );
 
 	UBioAutoConditionals_execF531_Parms F531_Parms;
 	F531_Parms.bioWorld = bioWorld;
@@ -25393,10 +24288,9 @@ bool UBioAutoConditionals::F531 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F530 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF530 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF530Ref { L"Function PlotManager.BioAutoConditionals.F530", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF530 )
-		pFnF530 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F530" );
+	UFunction* const pFnF530 = pFnF530Ref.Get ( );
 
 	UBioAutoConditionals_execF530_Parms F530_Parms;
 	F530_Parms.bioWorld = bioWorld;
@@ -25416,10 +24310,9 @@ bool UBioAutoConditionals::F530 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F529 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF529 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF529Ref { L"Function PlotManager.BioAutoConditionals.F529", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF529 )
-		pFnF529 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F529" );
+	UFunction* const pFnF529 = pFnF529Ref.Get ( );
 
 	UBioAutoConditionals_execF529_Parms F529_Parms;
 	F529_Parms.bioWorld = bioWorld;
@@ -25439,10 +24332,9 @@ bool UBioAutoConditionals::F529 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F528 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF528 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF528Ref { L"Function PlotManager.BioAutoConditionals.F528", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF528 )
-		pFnF528 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F528" );
+	UFunction* const pFnF528 = pFnF528Ref.Get ( );
 
 	UBioAutoConditionals_execF528_Parms F528_Parms;
 	F528_Parms.bioWorld = bioWorld;
@@ -25462,10 +24354,9 @@ bool UBioAutoConditionals::F528 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F527 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF527 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF527Ref { L"Function PlotManager.BioAutoConditionals.F527", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF527 )
-		pFnF527 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F527" );
+	UFunction* const pFnF527 = pFnF527Ref.Get ( );
 
 	UBioAutoConditionals_execF527_Parms F527_Parms;
 	F527_Parms.bioWorld = bioWorld;
@@ -25485,10 +24376,9 @@ bool UBioAutoConditionals::F527 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F526 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF526 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF526Ref { L"Function PlotManager.BioAutoConditionals.F526", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF526 )
-		pFnF526 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F526" );
+	UFunction* const pFnF526 = pFnF526Ref.Get ( );
 
 	UBioAutoConditionals_execF526_Parms F526_Parms;
 	F526_Parms.bioWorld = bioWorld;
@@ -25508,10 +24398,9 @@ bool UBioAutoConditionals::F526 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F525 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF525 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF525Ref { L"Function PlotManager.BioAutoConditionals.F525", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF525 )
-		pFnF525 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F525" );
+	UFunction* const pFnF525 = pFnF525Ref.Get ( );
 
 	UBioAutoConditionals_execF525_Parms F525_Parms;
 	F525_Parms.bioWorld = bioWorld;
@@ -25531,10 +24420,9 @@ bool UBioAutoConditionals::F525 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1536 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1536 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1536Ref { L"Function PlotManager.BioAutoConditionals.F1536", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1536 )
-		pFnF1536 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1536" );
+	UFunction* const pFnF1536 = pFnF1536Ref.Get ( );
 
 	UBioAutoConditionals_execF1536_Parms F1536_Parms;
 	F1536_Parms.bioWorld = bioWorld;
@@ -25554,10 +24442,9 @@ bool UBioAutoConditionals::F1536 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1354 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1354 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1354Ref { L"Function PlotManager.BioAutoConditionals.F1354", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1354 )
-		pFnF1354 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1354" );
+	UFunction* const pFnF1354 = pFnF1354Ref.Get ( );
 
 	UBioAutoConditionals_execF1354_Parms F1354_Parms;
 	F1354_Parms.bioWorld = bioWorld;
@@ -25577,10 +24464,9 @@ bool UBioAutoConditionals::F1354 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1353 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1353 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1353Ref { L"Function PlotManager.BioAutoConditionals.F1353", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1353 )
-		pFnF1353 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1353" );
+	UFunction* const pFnF1353 = pFnF1353Ref.Get ( );
 
 	UBioAutoConditionals_execF1353_Parms F1353_Parms;
 	F1353_Parms.bioWorld = bioWorld;
@@ -25600,10 +24486,9 @@ bool UBioAutoConditionals::F1353 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1322 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1322 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1322Ref { L"Function PlotManager.BioAutoConditionals.F1322", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1322 )
-		pFnF1322 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1322" );
+	UFunction* const pFnF1322 = pFnF1322Ref.Get ( );
 
 	UBioAutoConditionals_execF1322_Parms F1322_Parms;
 	F1322_Parms.bioWorld = bioWorld;
@@ -25623,10 +24508,9 @@ bool UBioAutoConditionals::F1322 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1321 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1321 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1321Ref { L"Function PlotManager.BioAutoConditionals.F1321", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1321 )
-		pFnF1321 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1321" );
+	UFunction* const pFnF1321 = pFnF1321Ref.Get ( );
 
 	UBioAutoConditionals_execF1321_Parms F1321_Parms;
 	F1321_Parms.bioWorld = bioWorld;
@@ -25646,10 +24530,9 @@ bool UBioAutoConditionals::F1321 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1264 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1264 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1264Ref { L"Function PlotManager.BioAutoConditionals.F1264", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1264 )
-		pFnF1264 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1264" );
+	UFunction* const pFnF1264 = pFnF1264Ref.Get ( );
 
 	UBioAutoConditionals_execF1264_Parms F1264_Parms;
 	F1264_Parms.bioWorld = bioWorld;
@@ -25669,10 +24552,9 @@ bool UBioAutoConditionals::F1264 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1263 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1263 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1263Ref { L"Function PlotManager.BioAutoConditionals.F1263", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1263 )
-		pFnF1263 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1263" );
+	UFunction* const pFnF1263 = pFnF1263Ref.Get ( );
 
 	UBioAutoConditionals_execF1263_Parms F1263_Parms;
 	F1263_Parms.bioWorld = bioWorld;
@@ -25692,10 +24574,9 @@ bool UBioAutoConditionals::F1263 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1262 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1262 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1262Ref { L"Function PlotManager.BioAutoConditionals.F1262", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1262 )
-		pFnF1262 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1262" );
+	UFunction* const pFnF1262 = pFnF1262Ref.Get ( );
 
 	UBioAutoConditionals_execF1262_Parms F1262_Parms;
 	F1262_Parms.bioWorld = bioWorld;
@@ -25715,10 +24596,9 @@ bool UBioAutoConditionals::F1262 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1017 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1017 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1017Ref { L"Function PlotManager.BioAutoConditionals.F1017", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1017 )
-		pFnF1017 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1017" );
+	UFunction* const pFnF1017 = pFnF1017Ref.Get ( );
 
 	UBioAutoConditionals_execF1017_Parms F1017_Parms;
 	F1017_Parms.bioWorld = bioWorld;
@@ -25738,10 +24618,9 @@ bool UBioAutoConditionals::F1017 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F990 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF990 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF990Ref { L"Function PlotManager.BioAutoConditionals.F990", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF990 )
-		pFnF990 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F990" );
+	UFunction* const pFnF990 = pFnF990Ref.Get ( );
 
 	UBioAutoConditionals_execF990_Parms F990_Parms;
 	F990_Parms.bioWorld = bioWorld;
@@ -25761,10 +24640,9 @@ bool UBioAutoConditionals::F990 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F986 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF986 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF986Ref { L"Function PlotManager.BioAutoConditionals.F986", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF986 )
-		pFnF986 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F986" );
+	UFunction* const pFnF986 = pFnF986Ref.Get ( );
 
 	UBioAutoConditionals_execF986_Parms F986_Parms;
 	F986_Parms.bioWorld = bioWorld;
@@ -25784,10 +24662,9 @@ bool UBioAutoConditionals::F986 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F985 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF985 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF985Ref { L"Function PlotManager.BioAutoConditionals.F985", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF985 )
-		pFnF985 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F985" );
+	UFunction* const pFnF985 = pFnF985Ref.Get ( );
 
 	UBioAutoConditionals_execF985_Parms F985_Parms;
 	F985_Parms.bioWorld = bioWorld;
@@ -25807,10 +24684,9 @@ bool UBioAutoConditionals::F985 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F961 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF961 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF961Ref { L"Function PlotManager.BioAutoConditionals.F961", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF961 )
-		pFnF961 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F961" );
+	UFunction* const pFnF961 = pFnF961Ref.Get ( );
 
 	UBioAutoConditionals_execF961_Parms F961_Parms;
 	F961_Parms.bioWorld = bioWorld;
@@ -25830,10 +24706,9 @@ bool UBioAutoConditionals::F961 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F960 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF960 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF960Ref { L"Function PlotManager.BioAutoConditionals.F960", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF960 )
-		pFnF960 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F960" );
+	UFunction* const pFnF960 = pFnF960Ref.Get ( );
 
 	UBioAutoConditionals_execF960_Parms F960_Parms;
 	F960_Parms.bioWorld = bioWorld;
@@ -25853,10 +24728,9 @@ bool UBioAutoConditionals::F960 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F559 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF559 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF559Ref { L"Function PlotManager.BioAutoConditionals.F559", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF559 )
-		pFnF559 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F559" );
+	UFunction* const pFnF559 = pFnF559Ref.Get ( );
 
 	UBioAutoConditionals_execF559_Parms F559_Parms;
 	F559_Parms.bioWorld = bioWorld;
@@ -25876,10 +24750,9 @@ bool UBioAutoConditionals::F559 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F558 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF558 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF558Ref { L"Function PlotManager.BioAutoConditionals.F558", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF558 )
-		pFnF558 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F558" );
+	UFunction* const pFnF558 = pFnF558Ref.Get ( );
 
 	UBioAutoConditionals_execF558_Parms F558_Parms;
 	F558_Parms.bioWorld = bioWorld;
@@ -25899,10 +24772,9 @@ bool UBioAutoConditionals::F558 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F553 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF553 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF553Ref { L"Function PlotManager.BioAutoConditionals.F553", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF553 )
-		pFnF553 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F553" );
+	UFunction* const pFnF553 = pFnF553Ref.Get ( );
 
 	UBioAutoConditionals_execF553_Parms F553_Parms;
 	F553_Parms.bioWorld = bioWorld;
@@ -25922,10 +24794,9 @@ bool UBioAutoConditionals::F553 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F551 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF551 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF551Ref { L"Function PlotManager.BioAutoConditionals.F551", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF551 )
-		pFnF551 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F551" );
+	UFunction* const pFnF551 = pFnF551Ref.Get ( );
 
 	UBioAutoConditionals_execF551_Parms F551_Parms;
 	F551_Parms.bioWorld = bioWorld;
@@ -25945,10 +24816,9 @@ bool UBioAutoConditionals::F551 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F547 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF547 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF547Ref { L"Function PlotManager.BioAutoConditionals.F547", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF547 )
-		pFnF547 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F547" );
+	UFunction* const pFnF547 = pFnF547Ref.Get ( );
 
 	UBioAutoConditionals_execF547_Parms F547_Parms;
 	F547_Parms.bioWorld = bioWorld;
@@ -25968,10 +24838,9 @@ bool UBioAutoConditionals::F547 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F546 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF546 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF546Ref { L"Function PlotManager.BioAutoConditionals.F546", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF546 )
-		pFnF546 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F546" );
+	UFunction* const pFnF546 = pFnF546Ref.Get ( );
 
 	UBioAutoConditionals_execF546_Parms F546_Parms;
 	F546_Parms.bioWorld = bioWorld;
@@ -25991,10 +24860,9 @@ bool UBioAutoConditionals::F546 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F545 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF545 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF545Ref { L"Function PlotManager.BioAutoConditionals.F545", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF545 )
-		pFnF545 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F545" );
+	UFunction* const pFnF545 = pFnF545Ref.Get ( );
 
 	UBioAutoConditionals_execF545_Parms F545_Parms;
 	F545_Parms.bioWorld = bioWorld;
@@ -26014,10 +24882,9 @@ bool UBioAutoConditionals::F545 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F544 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF544 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF544Ref { L"Function PlotManager.BioAutoConditionals.F544", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF544 )
-		pFnF544 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F544" );
+	UFunction* const pFnF544 = pFnF544Ref.Get ( );
 
 	UBioAutoConditionals_execF544_Parms F544_Parms;
 	F544_Parms.bioWorld = bioWorld;
@@ -26037,10 +24904,9 @@ bool UBioAutoConditionals::F544 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F543 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF543 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF543Ref { L"Function PlotManager.BioAutoConditionals.F543", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF543 )
-		pFnF543 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F543" );
+	UFunction* const pFnF543 = pFnF543Ref.Get ( );
 
 	UBioAutoConditionals_execF543_Parms F543_Parms;
 	F543_Parms.bioWorld = bioWorld;
@@ -26060,10 +24926,9 @@ bool UBioAutoConditionals::F543 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F542 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF542 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF542Ref { L"Function PlotManager.BioAutoConditionals.F542", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF542 )
-		pFnF542 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F542" );
+	UFunction* const pFnF542 = pFnF542Ref.Get ( );
 
 	UBioAutoConditionals_execF542_Parms F542_Parms;
 	F542_Parms.bioWorld = bioWorld;
@@ -26083,10 +24948,9 @@ bool UBioAutoConditionals::F542 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F505 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF505 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF505Ref { L"Function PlotManager.BioAutoConditionals.F505", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF505 )
-		pFnF505 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F505" );
+	UFunction* const pFnF505 = pFnF505Ref.Get ( );
 
 	UBioAutoConditionals_execF505_Parms F505_Parms;
 	F505_Parms.bioWorld = bioWorld;
@@ -26106,10 +24970,9 @@ bool UBioAutoConditionals::F505 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1165 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1165 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1165Ref { L"Function PlotManager.BioAutoConditionals.F1165", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1165 )
-		pFnF1165 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1165" );
+	UFunction* const pFnF1165 = pFnF1165Ref.Get ( );
 
 	UBioAutoConditionals_execF1165_Parms F1165_Parms;
 	F1165_Parms.bioWorld = bioWorld;
@@ -26129,10 +24992,9 @@ bool UBioAutoConditionals::F1165 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1164 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1164 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1164Ref { L"Function PlotManager.BioAutoConditionals.F1164", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1164 )
-		pFnF1164 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1164" );
+	UFunction* const pFnF1164 = pFnF1164Ref.Get ( );
 
 	UBioAutoConditionals_execF1164_Parms F1164_Parms;
 	F1164_Parms.bioWorld = bioWorld;
@@ -26152,10 +25014,9 @@ bool UBioAutoConditionals::F1164 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1161 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1161 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1161Ref { L"Function PlotManager.BioAutoConditionals.F1161", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1161 )
-		pFnF1161 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1161" );
+	UFunction* const pFnF1161 = pFnF1161Ref.Get ( );
 
 	UBioAutoConditionals_execF1161_Parms F1161_Parms;
 	F1161_Parms.bioWorld = bioWorld;
@@ -26175,10 +25036,9 @@ bool UBioAutoConditionals::F1161 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F309 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF309 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF309Ref { L"Function PlotManager.BioAutoConditionals.F309", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF309 )
-		pFnF309 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F309" );
+	UFunction* const pFnF309 = pFnF309Ref.Get ( );
 
 	UBioAutoConditionals_execF309_Parms F309_Parms;
 	F309_Parms.bioWorld = bioWorld;
@@ -26198,10 +25058,9 @@ bool UBioAutoConditionals::F309 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F308 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF308 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF308Ref { L"Function PlotManager.BioAutoConditionals.F308", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF308 )
-		pFnF308 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F308" );
+	UFunction* const pFnF308 = pFnF308Ref.Get ( );
 
 	UBioAutoConditionals_execF308_Parms F308_Parms;
 	F308_Parms.bioWorld = bioWorld;
@@ -26221,10 +25080,9 @@ bool UBioAutoConditionals::F308 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F307 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF307 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF307Ref { L"Function PlotManager.BioAutoConditionals.F307", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF307 )
-		pFnF307 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F307" );
+	UFunction* const pFnF307 = pFnF307Ref.Get ( );
 
 	UBioAutoConditionals_execF307_Parms F307_Parms;
 	F307_Parms.bioWorld = bioWorld;
@@ -26244,10 +25102,9 @@ bool UBioAutoConditionals::F307 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F306 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF306 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF306Ref { L"Function PlotManager.BioAutoConditionals.F306", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF306 )
-		pFnF306 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F306" );
+	UFunction* const pFnF306 = pFnF306Ref.Get ( );
 
 	UBioAutoConditionals_execF306_Parms F306_Parms;
 	F306_Parms.bioWorld = bioWorld;
@@ -26267,10 +25124,9 @@ bool UBioAutoConditionals::F306 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F304 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF304 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF304Ref { L"Function PlotManager.BioAutoConditionals.F304", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF304 )
-		pFnF304 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F304" );
+	UFunction* const pFnF304 = pFnF304Ref.Get ( );
 
 	UBioAutoConditionals_execF304_Parms F304_Parms;
 	F304_Parms.bioWorld = bioWorld;
@@ -26290,10 +25146,9 @@ bool UBioAutoConditionals::F304 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F302 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF302 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF302Ref { L"Function PlotManager.BioAutoConditionals.F302", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF302 )
-		pFnF302 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F302" );
+	UFunction* const pFnF302 = pFnF302Ref.Get ( );
 
 	UBioAutoConditionals_execF302_Parms F302_Parms;
 	F302_Parms.bioWorld = bioWorld;
@@ -26313,10 +25168,9 @@ bool UBioAutoConditionals::F302 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1574 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1574 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1574Ref { L"Function PlotManager.BioAutoConditionals.F1574", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1574 )
-		pFnF1574 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1574" );
+	UFunction* const pFnF1574 = pFnF1574Ref.Get ( );
 
 	UBioAutoConditionals_execF1574_Parms F1574_Parms;
 	F1574_Parms.bioWorld = bioWorld;
@@ -26336,10 +25190,9 @@ bool UBioAutoConditionals::F1574 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1573 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1573 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1573Ref { L"Function PlotManager.BioAutoConditionals.F1573", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1573 )
-		pFnF1573 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1573" );
+	UFunction* const pFnF1573 = pFnF1573Ref.Get ( );
 
 	UBioAutoConditionals_execF1573_Parms F1573_Parms;
 	F1573_Parms.bioWorld = bioWorld;
@@ -26359,10 +25212,9 @@ bool UBioAutoConditionals::F1573 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1261 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1261 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1261Ref { L"Function PlotManager.BioAutoConditionals.F1261", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1261 )
-		pFnF1261 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1261" );
+	UFunction* const pFnF1261 = pFnF1261Ref.Get ( );
 
 	UBioAutoConditionals_execF1261_Parms F1261_Parms;
 	F1261_Parms.bioWorld = bioWorld;
@@ -26382,10 +25234,9 @@ bool UBioAutoConditionals::F1261 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1260 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1260 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1260Ref { L"Function PlotManager.BioAutoConditionals.F1260", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1260 )
-		pFnF1260 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1260" );
+	UFunction* const pFnF1260 = pFnF1260Ref.Get ( );
 
 	UBioAutoConditionals_execF1260_Parms F1260_Parms;
 	F1260_Parms.bioWorld = bioWorld;
@@ -26405,10 +25256,9 @@ bool UBioAutoConditionals::F1260 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F127 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF127 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF127Ref { L"Function PlotManager.BioAutoConditionals.F127", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF127 )
-		pFnF127 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F127" );
+	UFunction* const pFnF127 = pFnF127Ref.Get ( );
 
 	UBioAutoConditionals_execF127_Parms F127_Parms;
 	F127_Parms.bioWorld = bioWorld;
@@ -26428,10 +25278,9 @@ bool UBioAutoConditionals::F127 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F126 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF126 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF126Ref { L"Function PlotManager.BioAutoConditionals.F126", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF126 )
-		pFnF126 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F126" );
+	UFunction* const pFnF126 = pFnF126Ref.Get ( );
 
 	UBioAutoConditionals_execF126_Parms F126_Parms;
 	F126_Parms.bioWorld = bioWorld;
@@ -26451,10 +25300,9 @@ bool UBioAutoConditionals::F126 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F125 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF125 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF125Ref { L"Function PlotManager.BioAutoConditionals.F125", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF125 )
-		pFnF125 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F125" );
+	UFunction* const pFnF125 = pFnF125Ref.Get ( );
 
 	UBioAutoConditionals_execF125_Parms F125_Parms;
 	F125_Parms.bioWorld = bioWorld;
@@ -26474,10 +25322,9 @@ bool UBioAutoConditionals::F125 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1179 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1179 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1179Ref { L"Function PlotManager.BioAutoConditionals.F1179", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1179 )
-		pFnF1179 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1179" );
+	UFunction* const pFnF1179 = pFnF1179Ref.Get ( );
 
 	UBioAutoConditionals_execF1179_Parms F1179_Parms;
 	F1179_Parms.bioWorld = bioWorld;
@@ -26497,10 +25344,9 @@ bool UBioAutoConditionals::F1179 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1091 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1091 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1091Ref { L"Function PlotManager.BioAutoConditionals.F1091", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1091 )
-		pFnF1091 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1091" );
+	UFunction* const pFnF1091 = pFnF1091Ref.Get ( );
 
 	UBioAutoConditionals_execF1091_Parms F1091_Parms;
 	F1091_Parms.bioWorld = bioWorld;
@@ -26520,10 +25366,9 @@ bool UBioAutoConditionals::F1091 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F927 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF927 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF927Ref { L"Function PlotManager.BioAutoConditionals.F927", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF927 )
-		pFnF927 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F927" );
+	UFunction* const pFnF927 = pFnF927Ref.Get ( );
 
 	UBioAutoConditionals_execF927_Parms F927_Parms;
 	F927_Parms.bioWorld = bioWorld;
@@ -26543,10 +25388,9 @@ bool UBioAutoConditionals::F927 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F926 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF926 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF926Ref { L"Function PlotManager.BioAutoConditionals.F926", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF926 )
-		pFnF926 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F926" );
+	UFunction* const pFnF926 = pFnF926Ref.Get ( );
 
 	UBioAutoConditionals_execF926_Parms F926_Parms;
 	F926_Parms.bioWorld = bioWorld;
@@ -26566,10 +25410,9 @@ bool UBioAutoConditionals::F926 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F236 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF236 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF236Ref { L"Function PlotManager.BioAutoConditionals.F236", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF236 )
-		pFnF236 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F236" );
+	UFunction* const pFnF236 = pFnF236Ref.Get ( );
 
 	UBioAutoConditionals_execF236_Parms F236_Parms;
 	F236_Parms.bioWorld = bioWorld;
@@ -26589,10 +25432,9 @@ bool UBioAutoConditionals::F236 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1258 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1258 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1258Ref { L"Function PlotManager.BioAutoConditionals.F1258", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1258 )
-		pFnF1258 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1258" );
+	UFunction* const pFnF1258 = pFnF1258Ref.Get ( );
 
 	UBioAutoConditionals_execF1258_Parms F1258_Parms;
 	F1258_Parms.bioWorld = bioWorld;
@@ -26612,10 +25454,9 @@ bool UBioAutoConditionals::F1258 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1248 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1248 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1248Ref { L"Function PlotManager.BioAutoConditionals.F1248", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1248 )
-		pFnF1248 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1248" );
+	UFunction* const pFnF1248 = pFnF1248Ref.Get ( );
 
 	UBioAutoConditionals_execF1248_Parms F1248_Parms;
 	F1248_Parms.bioWorld = bioWorld;
@@ -26635,10 +25476,9 @@ bool UBioAutoConditionals::F1248 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F247 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF247 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF247Ref { L"Function PlotManager.BioAutoConditionals.F247", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF247 )
-		pFnF247 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F247" );
+	UFunction* const pFnF247 = pFnF247Ref.Get ( );
 
 	UBioAutoConditionals_execF247_Parms F247_Parms;
 	F247_Parms.bioWorld = bioWorld;
@@ -26658,10 +25498,9 @@ bool UBioAutoConditionals::F247 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F246 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF246 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF246Ref { L"Function PlotManager.BioAutoConditionals.F246", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF246 )
-		pFnF246 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F246" );
+	UFunction* const pFnF246 = pFnF246Ref.Get ( );
 
 	UBioAutoConditionals_execF246_Parms F246_Parms;
 	F246_Parms.bioWorld = bioWorld;
@@ -26681,10 +25520,9 @@ bool UBioAutoConditionals::F246 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1620 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1620 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1620Ref { L"Function PlotManager.BioAutoConditionals.F1620", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1620 )
-		pFnF1620 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1620" );
+	UFunction* const pFnF1620 = pFnF1620Ref.Get ( );
 
 	UBioAutoConditionals_execF1620_Parms F1620_Parms;
 	F1620_Parms.bioWorld = bioWorld;
@@ -26704,10 +25542,9 @@ bool UBioAutoConditionals::F1620 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1580 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1580 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1580Ref { L"Function PlotManager.BioAutoConditionals.F1580", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1580 )
-		pFnF1580 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1580" );
+	UFunction* const pFnF1580 = pFnF1580Ref.Get ( );
 
 	UBioAutoConditionals_execF1580_Parms F1580_Parms;
 	F1580_Parms.bioWorld = bioWorld;
@@ -26727,10 +25564,9 @@ bool UBioAutoConditionals::F1580 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1556 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1556 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1556Ref { L"Function PlotManager.BioAutoConditionals.F1556", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1556 )
-		pFnF1556 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1556" );
+	UFunction* const pFnF1556 = pFnF1556Ref.Get ( );
 
 	UBioAutoConditionals_execF1556_Parms F1556_Parms;
 	F1556_Parms.bioWorld = bioWorld;
@@ -26750,10 +25586,9 @@ bool UBioAutoConditionals::F1556 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1537 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1537 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1537Ref { L"Function PlotManager.BioAutoConditionals.F1537", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1537 )
-		pFnF1537 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1537" );
+	UFunction* const pFnF1537 = pFnF1537Ref.Get ( );
 
 	UBioAutoConditionals_execF1537_Parms F1537_Parms;
 	F1537_Parms.bioWorld = bioWorld;
@@ -26773,10 +25608,9 @@ bool UBioAutoConditionals::F1537 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1493 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1493 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1493Ref { L"Function PlotManager.BioAutoConditionals.F1493", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1493 )
-		pFnF1493 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1493" );
+	UFunction* const pFnF1493 = pFnF1493Ref.Get ( );
 
 	UBioAutoConditionals_execF1493_Parms F1493_Parms;
 	F1493_Parms.bioWorld = bioWorld;
@@ -26796,10 +25630,9 @@ bool UBioAutoConditionals::F1493 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1365 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1365 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1365Ref { L"Function PlotManager.BioAutoConditionals.F1365", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1365 )
-		pFnF1365 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1365" );
+	UFunction* const pFnF1365 = pFnF1365Ref.Get ( );
 
 	UBioAutoConditionals_execF1365_Parms F1365_Parms;
 	F1365_Parms.bioWorld = bioWorld;
@@ -26819,10 +25652,9 @@ bool UBioAutoConditionals::F1365 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1364 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1364 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1364Ref { L"Function PlotManager.BioAutoConditionals.F1364", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1364 )
-		pFnF1364 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1364" );
+	UFunction* const pFnF1364 = pFnF1364Ref.Get ( );
 
 	UBioAutoConditionals_execF1364_Parms F1364_Parms;
 	F1364_Parms.bioWorld = bioWorld;
@@ -26842,10 +25674,9 @@ bool UBioAutoConditionals::F1364 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1363 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1363 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1363Ref { L"Function PlotManager.BioAutoConditionals.F1363", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1363 )
-		pFnF1363 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1363" );
+	UFunction* const pFnF1363 = pFnF1363Ref.Get ( );
 
 	UBioAutoConditionals_execF1363_Parms F1363_Parms;
 	F1363_Parms.bioWorld = bioWorld;
@@ -26865,10 +25696,9 @@ bool UBioAutoConditionals::F1363 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1362 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1362 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1362Ref { L"Function PlotManager.BioAutoConditionals.F1362", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1362 )
-		pFnF1362 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1362" );
+	UFunction* const pFnF1362 = pFnF1362Ref.Get ( );
 
 	UBioAutoConditionals_execF1362_Parms F1362_Parms;
 	F1362_Parms.bioWorld = bioWorld;
@@ -26888,10 +25718,9 @@ bool UBioAutoConditionals::F1362 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1361 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1361 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1361Ref { L"Function PlotManager.BioAutoConditionals.F1361", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1361 )
-		pFnF1361 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1361" );
+	UFunction* const pFnF1361 = pFnF1361Ref.Get ( );
 
 	UBioAutoConditionals_execF1361_Parms F1361_Parms;
 	F1361_Parms.bioWorld = bioWorld;
@@ -26911,10 +25740,9 @@ bool UBioAutoConditionals::F1361 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1360 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1360 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1360Ref { L"Function PlotManager.BioAutoConditionals.F1360", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1360 )
-		pFnF1360 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1360" );
+	UFunction* const pFnF1360 = pFnF1360Ref.Get ( );
 
 	UBioAutoConditionals_execF1360_Parms F1360_Parms;
 	F1360_Parms.bioWorld = bioWorld;
@@ -26934,10 +25762,9 @@ bool UBioAutoConditionals::F1360 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1305 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1305 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1305Ref { L"Function PlotManager.BioAutoConditionals.F1305", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1305 )
-		pFnF1305 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1305" );
+	UFunction* const pFnF1305 = pFnF1305Ref.Get ( );
 
 	UBioAutoConditionals_execF1305_Parms F1305_Parms;
 	F1305_Parms.bioWorld = bioWorld;
@@ -26957,10 +25784,9 @@ bool UBioAutoConditionals::F1305 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1304 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1304 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1304Ref { L"Function PlotManager.BioAutoConditionals.F1304", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1304 )
-		pFnF1304 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1304" );
+	UFunction* const pFnF1304 = pFnF1304Ref.Get ( );
 
 	UBioAutoConditionals_execF1304_Parms F1304_Parms;
 	F1304_Parms.bioWorld = bioWorld;
@@ -26980,10 +25806,9 @@ bool UBioAutoConditionals::F1304 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F948 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF948 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF948Ref { L"Function PlotManager.BioAutoConditionals.F948", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF948 )
-		pFnF948 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F948" );
+	UFunction* const pFnF948 = pFnF948Ref.Get ( );
 
 	UBioAutoConditionals_execF948_Parms F948_Parms;
 	F948_Parms.bioWorld = bioWorld;
@@ -27003,10 +25828,9 @@ bool UBioAutoConditionals::F948 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F947 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF947 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF947Ref { L"Function PlotManager.BioAutoConditionals.F947", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF947 )
-		pFnF947 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F947" );
+	UFunction* const pFnF947 = pFnF947Ref.Get ( );
 
 	UBioAutoConditionals_execF947_Parms F947_Parms;
 	F947_Parms.bioWorld = bioWorld;
@@ -27026,10 +25850,9 @@ bool UBioAutoConditionals::F947 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F946 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF946 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF946Ref { L"Function PlotManager.BioAutoConditionals.F946", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF946 )
-		pFnF946 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F946" );
+	UFunction* const pFnF946 = pFnF946Ref.Get ( );
 
 	UBioAutoConditionals_execF946_Parms F946_Parms;
 	F946_Parms.bioWorld = bioWorld;
@@ -27049,10 +25872,9 @@ bool UBioAutoConditionals::F946 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F945 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF945 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF945Ref { L"Function PlotManager.BioAutoConditionals.F945", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF945 )
-		pFnF945 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F945" );
+	UFunction* const pFnF945 = pFnF945Ref.Get ( );
 
 	UBioAutoConditionals_execF945_Parms F945_Parms;
 	F945_Parms.bioWorld = bioWorld;
@@ -27072,10 +25894,9 @@ bool UBioAutoConditionals::F945 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F944 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF944 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF944Ref { L"Function PlotManager.BioAutoConditionals.F944", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF944 )
-		pFnF944 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F944" );
+	UFunction* const pFnF944 = pFnF944Ref.Get ( );
 
 	UBioAutoConditionals_execF944_Parms F944_Parms;
 	F944_Parms.bioWorld = bioWorld;
@@ -27095,10 +25916,9 @@ bool UBioAutoConditionals::F944 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F943 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF943 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF943Ref { L"Function PlotManager.BioAutoConditionals.F943", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF943 )
-		pFnF943 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F943" );
+	UFunction* const pFnF943 = pFnF943Ref.Get ( );
 
 	UBioAutoConditionals_execF943_Parms F943_Parms;
 	F943_Parms.bioWorld = bioWorld;
@@ -27118,10 +25938,9 @@ bool UBioAutoConditionals::F943 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1617 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1617 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1617Ref { L"Function PlotManager.BioAutoConditionals.F1617", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1617 )
-		pFnF1617 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1617" );
+	UFunction* const pFnF1617 = pFnF1617Ref.Get ( );
 
 	UBioAutoConditionals_execF1617_Parms F1617_Parms;
 	F1617_Parms.bioWorld = bioWorld;
@@ -27141,10 +25960,9 @@ bool UBioAutoConditionals::F1617 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1203 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1203 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1203Ref { L"Function PlotManager.BioAutoConditionals.F1203", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1203 )
-		pFnF1203 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1203" );
+	UFunction* const pFnF1203 = pFnF1203Ref.Get ( );
 
 	UBioAutoConditionals_execF1203_Parms F1203_Parms;
 	F1203_Parms.bioWorld = bioWorld;
@@ -27164,10 +25982,9 @@ bool UBioAutoConditionals::F1203 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1202 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1202 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1202Ref { L"Function PlotManager.BioAutoConditionals.F1202", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1202 )
-		pFnF1202 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1202" );
+	UFunction* const pFnF1202 = pFnF1202Ref.Get ( );
 
 	UBioAutoConditionals_execF1202_Parms F1202_Parms;
 	F1202_Parms.bioWorld = bioWorld;
@@ -27187,10 +26004,9 @@ bool UBioAutoConditionals::F1202 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F275 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF275 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF275Ref { L"Function PlotManager.BioAutoConditionals.F275", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF275 )
-		pFnF275 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F275" );
+	UFunction* const pFnF275 = pFnF275Ref.Get ( );
 
 	UBioAutoConditionals_execF275_Parms F275_Parms;
 	F275_Parms.bioWorld = bioWorld;
@@ -27210,10 +26026,9 @@ bool UBioAutoConditionals::F275 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F274 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF274 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF274Ref { L"Function PlotManager.BioAutoConditionals.F274", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF274 )
-		pFnF274 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F274" );
+	UFunction* const pFnF274 = pFnF274Ref.Get ( );
 
 	UBioAutoConditionals_execF274_Parms F274_Parms;
 	F274_Parms.bioWorld = bioWorld;
@@ -27233,10 +26048,9 @@ bool UBioAutoConditionals::F274 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F56 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF56 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF56Ref { L"Function PlotManager.BioAutoConditionals.F56", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF56 )
-		pFnF56 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F56" );
+	UFunction* const pFnF56 = pFnF56Ref.Get ( );
 
 	UBioAutoConditionals_execF56_Parms F56_Parms;
 	F56_Parms.bioWorld = bioWorld;
@@ -27256,10 +26070,9 @@ bool UBioAutoConditionals::F56 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F55 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF55 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF55Ref { L"Function PlotManager.BioAutoConditionals.F55", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF55 )
-		pFnF55 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F55" );
+	UFunction* const pFnF55 = pFnF55Ref.Get ( );
 
 	UBioAutoConditionals_execF55_Parms F55_Parms;
 	F55_Parms.bioWorld = bioWorld;
@@ -27279,10 +26092,9 @@ bool UBioAutoConditionals::F55 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F54 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF54 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF54Ref { L"Function PlotManager.BioAutoConditionals.F54", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF54 )
-		pFnF54 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F54" );
+	UFunction* const pFnF54 = pFnF54Ref.Get ( );
 
 	UBioAutoConditionals_execF54_Parms F54_Parms;
 	F54_Parms.bioWorld = bioWorld;
@@ -27302,10 +26114,9 @@ bool UBioAutoConditionals::F54 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F53 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF53 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF53Ref { L"Function PlotManager.BioAutoConditionals.F53", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF53 )
-		pFnF53 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F53" );
+	UFunction* const pFnF53 = pFnF53Ref.Get ( );
 
 	UBioAutoConditionals_execF53_Parms F53_Parms;
 	F53_Parms.bioWorld = bioWorld;
@@ -27325,10 +26136,9 @@ bool UBioAutoConditionals::F53 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F52 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF52 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF52Ref { L"Function PlotManager.BioAutoConditionals.F52", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF52 )
-		pFnF52 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F52" );
+	UFunction* const pFnF52 = pFnF52Ref.Get ( );
 
 	UBioAutoConditionals_execF52_Parms F52_Parms;
 	F52_Parms.bioWorld = bioWorld;
@@ -27348,10 +26158,9 @@ bool UBioAutoConditionals::F52 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F51 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF51 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF51Ref { L"Function PlotManager.BioAutoConditionals.F51", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF51 )
-		pFnF51 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F51" );
+	UFunction* const pFnF51 = pFnF51Ref.Get ( );
 
 	UBioAutoConditionals_execF51_Parms F51_Parms;
 	F51_Parms.bioWorld = bioWorld;
@@ -27371,10 +26180,9 @@ bool UBioAutoConditionals::F51 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F50 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF50 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF50Ref { L"Function PlotManager.BioAutoConditionals.F50", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF50 )
-		pFnF50 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F50" );
+	UFunction* const pFnF50 = pFnF50Ref.Get ( );
 
 	UBioAutoConditionals_execF50_Parms F50_Parms;
 	F50_Parms.bioWorld = bioWorld;
@@ -27394,10 +26202,9 @@ bool UBioAutoConditionals::F50 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F49 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF49 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF49Ref { L"Function PlotManager.BioAutoConditionals.F49", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF49 )
-		pFnF49 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F49" );
+	UFunction* const pFnF49 = pFnF49Ref.Get ( );
 
 	UBioAutoConditionals_execF49_Parms F49_Parms;
 	F49_Parms.bioWorld = bioWorld;
@@ -27417,10 +26224,9 @@ bool UBioAutoConditionals::F49 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F426 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF426 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF426Ref { L"Function PlotManager.BioAutoConditionals.F426", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF426 )
-		pFnF426 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F426" );
+	UFunction* const pFnF426 = pFnF426Ref.Get ( );
 
 	UBioAutoConditionals_execF426_Parms F426_Parms;
 	F426_Parms.bioWorld = bioWorld;
@@ -27440,10 +26246,9 @@ bool UBioAutoConditionals::F426 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F425 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF425 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF425Ref { L"Function PlotManager.BioAutoConditionals.F425", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF425 )
-		pFnF425 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F425" );
+	UFunction* const pFnF425 = pFnF425Ref.Get ( );
 
 	UBioAutoConditionals_execF425_Parms F425_Parms;
 	F425_Parms.bioWorld = bioWorld;
@@ -27463,10 +26268,9 @@ bool UBioAutoConditionals::F425 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F422 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF422 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF422Ref { L"Function PlotManager.BioAutoConditionals.F422", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF422 )
-		pFnF422 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F422" );
+	UFunction* const pFnF422 = pFnF422Ref.Get ( );
 
 	UBioAutoConditionals_execF422_Parms F422_Parms;
 	F422_Parms.bioWorld = bioWorld;
@@ -27486,10 +26290,9 @@ bool UBioAutoConditionals::F422 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F420 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF420 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF420Ref { L"Function PlotManager.BioAutoConditionals.F420", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF420 )
-		pFnF420 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F420" );
+	UFunction* const pFnF420 = pFnF420Ref.Get ( );
 
 	UBioAutoConditionals_execF420_Parms F420_Parms;
 	F420_Parms.bioWorld = bioWorld;
@@ -27509,10 +26312,9 @@ bool UBioAutoConditionals::F420 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F408 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF408 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF408Ref { L"Function PlotManager.BioAutoConditionals.F408", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF408 )
-		pFnF408 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F408" );
+	UFunction* const pFnF408 = pFnF408Ref.Get ( );
 
 	UBioAutoConditionals_execF408_Parms F408_Parms;
 	F408_Parms.bioWorld = bioWorld;
@@ -27532,10 +26334,9 @@ bool UBioAutoConditionals::F408 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F407 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF407 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF407Ref { L"Function PlotManager.BioAutoConditionals.F407", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF407 )
-		pFnF407 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F407" );
+	UFunction* const pFnF407 = pFnF407Ref.Get ( );
 
 	UBioAutoConditionals_execF407_Parms F407_Parms;
 	F407_Parms.bioWorld = bioWorld;
@@ -27555,10 +26356,9 @@ bool UBioAutoConditionals::F407 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F406 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF406 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF406Ref { L"Function PlotManager.BioAutoConditionals.F406", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF406 )
-		pFnF406 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F406" );
+	UFunction* const pFnF406 = pFnF406Ref.Get ( );
 
 	UBioAutoConditionals_execF406_Parms F406_Parms;
 	F406_Parms.bioWorld = bioWorld;
@@ -27578,10 +26378,9 @@ bool UBioAutoConditionals::F406 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F405 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF405 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF405Ref { L"Function PlotManager.BioAutoConditionals.F405", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF405 )
-		pFnF405 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F405" );
+	UFunction* const pFnF405 = pFnF405Ref.Get ( );
 
 	UBioAutoConditionals_execF405_Parms F405_Parms;
 	F405_Parms.bioWorld = bioWorld;
@@ -27601,10 +26400,9 @@ bool UBioAutoConditionals::F405 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F404 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF404 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF404Ref { L"Function PlotManager.BioAutoConditionals.F404", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF404 )
-		pFnF404 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F404" );
+	UFunction* const pFnF404 = pFnF404Ref.Get ( );
 
 	UBioAutoConditionals_execF404_Parms F404_Parms;
 	F404_Parms.bioWorld = bioWorld;
@@ -27624,10 +26422,9 @@ bool UBioAutoConditionals::F404 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F403 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF403 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF403Ref { L"Function PlotManager.BioAutoConditionals.F403", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF403 )
-		pFnF403 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F403" );
+	UFunction* const pFnF403 = pFnF403Ref.Get ( );
 
 	UBioAutoConditionals_execF403_Parms F403_Parms;
 	F403_Parms.bioWorld = bioWorld;
@@ -27647,10 +26444,9 @@ bool UBioAutoConditionals::F403 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F402 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF402 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF402Ref { L"Function PlotManager.BioAutoConditionals.F402", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF402 )
-		pFnF402 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F402" );
+	UFunction* const pFnF402 = pFnF402Ref.Get ( );
 
 	UBioAutoConditionals_execF402_Parms F402_Parms;
 	F402_Parms.bioWorld = bioWorld;
@@ -27670,10 +26466,9 @@ bool UBioAutoConditionals::F402 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F401 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF401 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF401Ref { L"Function PlotManager.BioAutoConditionals.F401", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF401 )
-		pFnF401 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F401" );
+	UFunction* const pFnF401 = pFnF401Ref.Get ( );
 
 	UBioAutoConditionals_execF401_Parms F401_Parms;
 	F401_Parms.bioWorld = bioWorld;
@@ -27693,10 +26488,9 @@ bool UBioAutoConditionals::F401 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F400 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF400 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF400Ref { L"Function PlotManager.BioAutoConditionals.F400", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF400 )
-		pFnF400 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F400" );
+	UFunction* const pFnF400 = pFnF400Ref.Get ( );
 
 	UBioAutoConditionals_execF400_Parms F400_Parms;
 	F400_Parms.bioWorld = bioWorld;
@@ -27716,10 +26510,9 @@ bool UBioAutoConditionals::F400 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F399 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF399 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF399Ref { L"Function PlotManager.BioAutoConditionals.F399", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF399 )
-		pFnF399 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F399" );
+	UFunction* const pFnF399 = pFnF399Ref.Get ( );
 
 	UBioAutoConditionals_execF399_Parms F399_Parms;
 	F399_Parms.bioWorld = bioWorld;
@@ -27739,10 +26532,9 @@ bool UBioAutoConditionals::F399 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F398 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF398 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF398Ref { L"Function PlotManager.BioAutoConditionals.F398", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF398 )
-		pFnF398 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F398" );
+	UFunction* const pFnF398 = pFnF398Ref.Get ( );
 
 	UBioAutoConditionals_execF398_Parms F398_Parms;
 	F398_Parms.bioWorld = bioWorld;
@@ -27762,10 +26554,9 @@ bool UBioAutoConditionals::F398 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F397 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF397 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF397Ref { L"Function PlotManager.BioAutoConditionals.F397", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF397 )
-		pFnF397 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F397" );
+	UFunction* const pFnF397 = pFnF397Ref.Get ( );
 
 	UBioAutoConditionals_execF397_Parms F397_Parms;
 	F397_Parms.bioWorld = bioWorld;
@@ -27785,10 +26576,9 @@ bool UBioAutoConditionals::F397 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F235 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF235 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF235Ref { L"Function PlotManager.BioAutoConditionals.F235", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF235 )
-		pFnF235 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F235" );
+	UFunction* const pFnF235 = pFnF235Ref.Get ( );
 
 	UBioAutoConditionals_execF235_Parms F235_Parms;
 	F235_Parms.bioWorld = bioWorld;
@@ -27808,10 +26598,9 @@ bool UBioAutoConditionals::F235 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F66 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF66 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF66Ref { L"Function PlotManager.BioAutoConditionals.F66", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF66 )
-		pFnF66 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F66" );
+	UFunction* const pFnF66 = pFnF66Ref.Get ( );
 
 	UBioAutoConditionals_execF66_Parms F66_Parms;
 	F66_Parms.bioWorld = bioWorld;
@@ -27831,10 +26620,9 @@ bool UBioAutoConditionals::F66 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F65 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF65 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF65Ref { L"Function PlotManager.BioAutoConditionals.F65", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF65 )
-		pFnF65 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F65" );
+	UFunction* const pFnF65 = pFnF65Ref.Get ( );
 
 	UBioAutoConditionals_execF65_Parms F65_Parms;
 	F65_Parms.bioWorld = bioWorld;
@@ -27854,10 +26642,9 @@ bool UBioAutoConditionals::F65 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F64 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF64 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF64Ref { L"Function PlotManager.BioAutoConditionals.F64", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF64 )
-		pFnF64 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F64" );
+	UFunction* const pFnF64 = pFnF64Ref.Get ( );
 
 	UBioAutoConditionals_execF64_Parms F64_Parms;
 	F64_Parms.bioWorld = bioWorld;
@@ -27877,10 +26664,9 @@ bool UBioAutoConditionals::F64 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F63 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF63 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF63Ref { L"Function PlotManager.BioAutoConditionals.F63", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF63 )
-		pFnF63 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F63" );
+	UFunction* const pFnF63 = pFnF63Ref.Get ( );
 
 	UBioAutoConditionals_execF63_Parms F63_Parms;
 	F63_Parms.bioWorld = bioWorld;
@@ -27900,10 +26686,9 @@ bool UBioAutoConditionals::F63 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F62 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF62 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF62Ref { L"Function PlotManager.BioAutoConditionals.F62", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF62 )
-		pFnF62 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F62" );
+	UFunction* const pFnF62 = pFnF62Ref.Get ( );
 
 	UBioAutoConditionals_execF62_Parms F62_Parms;
 	F62_Parms.bioWorld = bioWorld;
@@ -27923,10 +26708,9 @@ bool UBioAutoConditionals::F62 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F60 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF60 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF60Ref { L"Function PlotManager.BioAutoConditionals.F60", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF60 )
-		pFnF60 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F60" );
+	UFunction* const pFnF60 = pFnF60Ref.Get ( );
 
 	UBioAutoConditionals_execF60_Parms F60_Parms;
 	F60_Parms.bioWorld = bioWorld;
@@ -27946,10 +26730,9 @@ bool UBioAutoConditionals::F60 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F48 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF48 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF48Ref { L"Function PlotManager.BioAutoConditionals.F48", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF48 )
-		pFnF48 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F48" );
+	UFunction* const pFnF48 = pFnF48Ref.Get ( );
 
 	UBioAutoConditionals_execF48_Parms F48_Parms;
 	F48_Parms.bioWorld = bioWorld;
@@ -27969,10 +26752,9 @@ bool UBioAutoConditionals::F48 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1316 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1316 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1316Ref { L"Function PlotManager.BioAutoConditionals.F1316", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1316 )
-		pFnF1316 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1316" );
+	UFunction* const pFnF1316 = pFnF1316Ref.Get ( );
 
 	UBioAutoConditionals_execF1316_Parms F1316_Parms;
 	F1316_Parms.bioWorld = bioWorld;
@@ -27992,10 +26774,9 @@ bool UBioAutoConditionals::F1316 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1315 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1315 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1315Ref { L"Function PlotManager.BioAutoConditionals.F1315", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1315 )
-		pFnF1315 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1315" );
+	UFunction* const pFnF1315 = pFnF1315Ref.Get ( );
 
 	UBioAutoConditionals_execF1315_Parms F1315_Parms;
 	F1315_Parms.bioWorld = bioWorld;
@@ -28015,10 +26796,9 @@ bool UBioAutoConditionals::F1315 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1314 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1314 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1314Ref { L"Function PlotManager.BioAutoConditionals.F1314", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1314 )
-		pFnF1314 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1314" );
+	UFunction* const pFnF1314 = pFnF1314Ref.Get ( );
 
 	UBioAutoConditionals_execF1314_Parms F1314_Parms;
 	F1314_Parms.bioWorld = bioWorld;
@@ -28038,10 +26818,9 @@ bool UBioAutoConditionals::F1314 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1313 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1313 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1313Ref { L"Function PlotManager.BioAutoConditionals.F1313", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1313 )
-		pFnF1313 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1313" );
+	UFunction* const pFnF1313 = pFnF1313Ref.Get ( );
 
 	UBioAutoConditionals_execF1313_Parms F1313_Parms;
 	F1313_Parms.bioWorld = bioWorld;
@@ -28061,10 +26840,9 @@ bool UBioAutoConditionals::F1313 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1312 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1312 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1312Ref { L"Function PlotManager.BioAutoConditionals.F1312", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1312 )
-		pFnF1312 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1312" );
+	UFunction* const pFnF1312 = pFnF1312Ref.Get ( );
 
 	UBioAutoConditionals_execF1312_Parms F1312_Parms;
 	F1312_Parms.bioWorld = bioWorld;
@@ -28084,10 +26862,9 @@ bool UBioAutoConditionals::F1312 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1311 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1311 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1311Ref { L"Function PlotManager.BioAutoConditionals.F1311", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1311 )
-		pFnF1311 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1311" );
+	UFunction* const pFnF1311 = pFnF1311Ref.Get ( );
 
 	UBioAutoConditionals_execF1311_Parms F1311_Parms;
 	F1311_Parms.bioWorld = bioWorld;
@@ -28107,10 +26884,9 @@ bool UBioAutoConditionals::F1311 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1310 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1310 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1310Ref { L"Function PlotManager.BioAutoConditionals.F1310", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1310 )
-		pFnF1310 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1310" );
+	UFunction* const pFnF1310 = pFnF1310Ref.Get ( );
 
 	UBioAutoConditionals_execF1310_Parms F1310_Parms;
 	F1310_Parms.bioWorld = bioWorld;
@@ -28130,10 +26906,9 @@ bool UBioAutoConditionals::F1310 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1309 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1309 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1309Ref { L"Function PlotManager.BioAutoConditionals.F1309", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1309 )
-		pFnF1309 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1309" );
+	UFunction* const pFnF1309 = pFnF1309Ref.Get ( );
 
 	UBioAutoConditionals_execF1309_Parms F1309_Parms;
 	F1309_Parms.bioWorld = bioWorld;
@@ -28153,10 +26928,9 @@ bool UBioAutoConditionals::F1309 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1308 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1308 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1308Ref { L"Function PlotManager.BioAutoConditionals.F1308", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1308 )
-		pFnF1308 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1308" );
+	UFunction* const pFnF1308 = pFnF1308Ref.Get ( );
 
 	UBioAutoConditionals_execF1308_Parms F1308_Parms;
 	F1308_Parms.bioWorld = bioWorld;
@@ -28176,10 +26950,9 @@ bool UBioAutoConditionals::F1308 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1307 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1307 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1307Ref { L"Function PlotManager.BioAutoConditionals.F1307", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1307 )
-		pFnF1307 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1307" );
+	UFunction* const pFnF1307 = pFnF1307Ref.Get ( );
 
 	UBioAutoConditionals_execF1307_Parms F1307_Parms;
 	F1307_Parms.bioWorld = bioWorld;
@@ -28199,10 +26972,9 @@ bool UBioAutoConditionals::F1307 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1615 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1615 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1615Ref { L"Function PlotManager.BioAutoConditionals.F1615", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1615 )
-		pFnF1615 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1615" );
+	UFunction* const pFnF1615 = pFnF1615Ref.Get ( );
 
 	UBioAutoConditionals_execF1615_Parms F1615_Parms;
 	F1615_Parms.bioWorld = bioWorld;
@@ -28222,10 +26994,9 @@ bool UBioAutoConditionals::F1615 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1614 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1614 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1614Ref { L"Function PlotManager.BioAutoConditionals.F1614", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1614 )
-		pFnF1614 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1614" );
+	UFunction* const pFnF1614 = pFnF1614Ref.Get ( );
 
 	UBioAutoConditionals_execF1614_Parms F1614_Parms;
 	F1614_Parms.bioWorld = bioWorld;
@@ -28245,10 +27016,9 @@ bool UBioAutoConditionals::F1614 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1613 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1613 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1613Ref { L"Function PlotManager.BioAutoConditionals.F1613", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1613 )
-		pFnF1613 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1613" );
+	UFunction* const pFnF1613 = pFnF1613Ref.Get ( );
 
 	UBioAutoConditionals_execF1613_Parms F1613_Parms;
 	F1613_Parms.bioWorld = bioWorld;
@@ -28268,10 +27038,9 @@ bool UBioAutoConditionals::F1613 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1612 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1612 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1612Ref { L"Function PlotManager.BioAutoConditionals.F1612", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1612 )
-		pFnF1612 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1612" );
+	UFunction* const pFnF1612 = pFnF1612Ref.Get ( );
 
 	UBioAutoConditionals_execF1612_Parms F1612_Parms;
 	F1612_Parms.bioWorld = bioWorld;
@@ -28291,10 +27060,9 @@ bool UBioAutoConditionals::F1612 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1611 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1611 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1611Ref { L"Function PlotManager.BioAutoConditionals.F1611", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1611 )
-		pFnF1611 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1611" );
+	UFunction* const pFnF1611 = pFnF1611Ref.Get ( );
 
 	UBioAutoConditionals_execF1611_Parms F1611_Parms;
 	F1611_Parms.bioWorld = bioWorld;
@@ -28314,10 +27082,9 @@ bool UBioAutoConditionals::F1611 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1610 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1610 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1610Ref { L"Function PlotManager.BioAutoConditionals.F1610", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1610 )
-		pFnF1610 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1610" );
+	UFunction* const pFnF1610 = pFnF1610Ref.Get ( );
 
 	UBioAutoConditionals_execF1610_Parms F1610_Parms;
 	F1610_Parms.bioWorld = bioWorld;
@@ -28337,10 +27104,9 @@ bool UBioAutoConditionals::F1610 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1609 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1609 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1609Ref { L"Function PlotManager.BioAutoConditionals.F1609", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1609 )
-		pFnF1609 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1609" );
+	UFunction* const pFnF1609 = pFnF1609Ref.Get ( );
 
 	UBioAutoConditionals_execF1609_Parms F1609_Parms;
 	F1609_Parms.bioWorld = bioWorld;
@@ -28360,10 +27126,9 @@ bool UBioAutoConditionals::F1609 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1608 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1608 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1608Ref { L"Function PlotManager.BioAutoConditionals.F1608", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1608 )
-		pFnF1608 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1608" );
+	UFunction* const pFnF1608 = pFnF1608Ref.Get ( );
 
 	UBioAutoConditionals_execF1608_Parms F1608_Parms;
 	F1608_Parms.bioWorld = bioWorld;
@@ -28383,10 +27148,9 @@ bool UBioAutoConditionals::F1608 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1607 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1607 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1607Ref { L"Function PlotManager.BioAutoConditionals.F1607", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1607 )
-		pFnF1607 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1607" );
+	UFunction* const pFnF1607 = pFnF1607Ref.Get ( );
 
 	UBioAutoConditionals_execF1607_Parms F1607_Parms;
 	F1607_Parms.bioWorld = bioWorld;
@@ -28406,10 +27170,9 @@ bool UBioAutoConditionals::F1607 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1606 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1606 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1606Ref { L"Function PlotManager.BioAutoConditionals.F1606", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1606 )
-		pFnF1606 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1606" );
+	UFunction* const pFnF1606 = pFnF1606Ref.Get ( );
 
 	UBioAutoConditionals_execF1606_Parms F1606_Parms;
 	F1606_Parms.bioWorld = bioWorld;
@@ -28429,10 +27192,9 @@ bool UBioAutoConditionals::F1606 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1605 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1605 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1605Ref { L"Function PlotManager.BioAutoConditionals.F1605", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1605 )
-		pFnF1605 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1605" );
+	UFunction* const pFnF1605 = pFnF1605Ref.Get ( );
 
 	UBioAutoConditionals_execF1605_Parms F1605_Parms;
 	F1605_Parms.bioWorld = bioWorld;
@@ -28452,10 +27214,9 @@ bool UBioAutoConditionals::F1605 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1604 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1604 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1604Ref { L"Function PlotManager.BioAutoConditionals.F1604", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1604 )
-		pFnF1604 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1604" );
+	UFunction* const pFnF1604 = pFnF1604Ref.Get ( );
 
 	UBioAutoConditionals_execF1604_Parms F1604_Parms;
 	F1604_Parms.bioWorld = bioWorld;
@@ -28475,10 +27236,9 @@ bool UBioAutoConditionals::F1604 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1344 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1344 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1344Ref { L"Function PlotManager.BioAutoConditionals.F1344", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1344 )
-		pFnF1344 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1344" );
+	UFunction* const pFnF1344 = pFnF1344Ref.Get ( );
 
 	UBioAutoConditionals_execF1344_Parms F1344_Parms;
 	F1344_Parms.bioWorld = bioWorld;
@@ -28498,10 +27258,9 @@ bool UBioAutoConditionals::F1344 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1343 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1343 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1343Ref { L"Function PlotManager.BioAutoConditionals.F1343", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1343 )
-		pFnF1343 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1343" );
+	UFunction* const pFnF1343 = pFnF1343Ref.Get ( );
 
 	UBioAutoConditionals_execF1343_Parms F1343_Parms;
 	F1343_Parms.bioWorld = bioWorld;
@@ -28521,10 +27280,9 @@ bool UBioAutoConditionals::F1343 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1342 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1342 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1342Ref { L"Function PlotManager.BioAutoConditionals.F1342", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1342 )
-		pFnF1342 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1342" );
+	UFunction* const pFnF1342 = pFnF1342Ref.Get ( );
 
 	UBioAutoConditionals_execF1342_Parms F1342_Parms;
 	F1342_Parms.bioWorld = bioWorld;
@@ -28544,10 +27302,9 @@ bool UBioAutoConditionals::F1342 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1341 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1341 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1341Ref { L"Function PlotManager.BioAutoConditionals.F1341", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1341 )
-		pFnF1341 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1341" );
+	UFunction* const pFnF1341 = pFnF1341Ref.Get ( );
 
 	UBioAutoConditionals_execF1341_Parms F1341_Parms;
 	F1341_Parms.bioWorld = bioWorld;
@@ -28567,10 +27324,9 @@ bool UBioAutoConditionals::F1341 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1340 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1340 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1340Ref { L"Function PlotManager.BioAutoConditionals.F1340", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1340 )
-		pFnF1340 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1340" );
+	UFunction* const pFnF1340 = pFnF1340Ref.Get ( );
 
 	UBioAutoConditionals_execF1340_Parms F1340_Parms;
 	F1340_Parms.bioWorld = bioWorld;
@@ -28590,10 +27346,9 @@ bool UBioAutoConditionals::F1340 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1339 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1339 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1339Ref { L"Function PlotManager.BioAutoConditionals.F1339", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1339 )
-		pFnF1339 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1339" );
+	UFunction* const pFnF1339 = pFnF1339Ref.Get ( );
 
 	UBioAutoConditionals_execF1339_Parms F1339_Parms;
 	F1339_Parms.bioWorld = bioWorld;
@@ -28613,10 +27368,9 @@ bool UBioAutoConditionals::F1339 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1338 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1338 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1338Ref { L"Function PlotManager.BioAutoConditionals.F1338", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1338 )
-		pFnF1338 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1338" );
+	UFunction* const pFnF1338 = pFnF1338Ref.Get ( );
 
 	UBioAutoConditionals_execF1338_Parms F1338_Parms;
 	F1338_Parms.bioWorld = bioWorld;
@@ -28636,10 +27390,9 @@ bool UBioAutoConditionals::F1338 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1337 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1337 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1337Ref { L"Function PlotManager.BioAutoConditionals.F1337", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1337 )
-		pFnF1337 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1337" );
+	UFunction* const pFnF1337 = pFnF1337Ref.Get ( );
 
 	UBioAutoConditionals_execF1337_Parms F1337_Parms;
 	F1337_Parms.bioWorld = bioWorld;
@@ -28659,10 +27412,9 @@ bool UBioAutoConditionals::F1337 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1336 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1336 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1336Ref { L"Function PlotManager.BioAutoConditionals.F1336", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1336 )
-		pFnF1336 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1336" );
+	UFunction* const pFnF1336 = pFnF1336Ref.Get ( );
 
 	UBioAutoConditionals_execF1336_Parms F1336_Parms;
 	F1336_Parms.bioWorld = bioWorld;
@@ -28682,10 +27434,9 @@ bool UBioAutoConditionals::F1336 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1335 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1335 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1335Ref { L"Function PlotManager.BioAutoConditionals.F1335", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1335 )
-		pFnF1335 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1335" );
+	UFunction* const pFnF1335 = pFnF1335Ref.Get ( );
 
 	UBioAutoConditionals_execF1335_Parms F1335_Parms;
 	F1335_Parms.bioWorld = bioWorld;
@@ -28705,10 +27456,9 @@ bool UBioAutoConditionals::F1335 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1334 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1334 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1334Ref { L"Function PlotManager.BioAutoConditionals.F1334", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1334 )
-		pFnF1334 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1334" );
+	UFunction* const pFnF1334 = pFnF1334Ref.Get ( );
 
 	UBioAutoConditionals_execF1334_Parms F1334_Parms;
 	F1334_Parms.bioWorld = bioWorld;
@@ -28728,10 +27478,9 @@ bool UBioAutoConditionals::F1334 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1333 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1333 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1333Ref { L"Function PlotManager.BioAutoConditionals.F1333", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1333 )
-		pFnF1333 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1333" );
+	UFunction* const pFnF1333 = pFnF1333Ref.Get ( );
 
 	UBioAutoConditionals_execF1333_Parms F1333_Parms;
 	F1333_Parms.bioWorld = bioWorld;
@@ -28751,10 +27500,9 @@ bool UBioAutoConditionals::F1333 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F504 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF504 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF504Ref { L"Function PlotManager.BioAutoConditionals.F504", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF504 )
-		pFnF504 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F504" );
+	UFunction* const pFnF504 = pFnF504Ref.Get ( );
 
 	UBioAutoConditionals_execF504_Parms F504_Parms;
 	F504_Parms.bioWorld = bioWorld;
@@ -28774,10 +27522,9 @@ bool UBioAutoConditionals::F504 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F503 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF503 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF503Ref { L"Function PlotManager.BioAutoConditionals.F503", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF503 )
-		pFnF503 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F503" );
+	UFunction* const pFnF503 = pFnF503Ref.Get ( );
 
 	UBioAutoConditionals_execF503_Parms F503_Parms;
 	F503_Parms.bioWorld = bioWorld;
@@ -28797,10 +27544,9 @@ bool UBioAutoConditionals::F503 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F502 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF502 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF502Ref { L"Function PlotManager.BioAutoConditionals.F502", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF502 )
-		pFnF502 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F502" );
+	UFunction* const pFnF502 = pFnF502Ref.Get ( );
 
 	UBioAutoConditionals_execF502_Parms F502_Parms;
 	F502_Parms.bioWorld = bioWorld;
@@ -28820,10 +27566,9 @@ bool UBioAutoConditionals::F502 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F501 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF501 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF501Ref { L"Function PlotManager.BioAutoConditionals.F501", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF501 )
-		pFnF501 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F501" );
+	UFunction* const pFnF501 = pFnF501Ref.Get ( );
 
 	UBioAutoConditionals_execF501_Parms F501_Parms;
 	F501_Parms.bioWorld = bioWorld;
@@ -28843,10 +27588,9 @@ bool UBioAutoConditionals::F501 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F500 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF500 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF500Ref { L"Function PlotManager.BioAutoConditionals.F500", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF500 )
-		pFnF500 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F500" );
+	UFunction* const pFnF500 = pFnF500Ref.Get ( );
 
 	UBioAutoConditionals_execF500_Parms F500_Parms;
 	F500_Parms.bioWorld = bioWorld;
@@ -28866,10 +27610,9 @@ bool UBioAutoConditionals::F500 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F499 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF499 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF499Ref { L"Function PlotManager.BioAutoConditionals.F499", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF499 )
-		pFnF499 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F499" );
+	UFunction* const pFnF499 = pFnF499Ref.Get ( );
 
 	UBioAutoConditionals_execF499_Parms F499_Parms;
 	F499_Parms.bioWorld = bioWorld;
@@ -28889,10 +27632,9 @@ bool UBioAutoConditionals::F499 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F498 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF498 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF498Ref { L"Function PlotManager.BioAutoConditionals.F498", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF498 )
-		pFnF498 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F498" );
+	UFunction* const pFnF498 = pFnF498Ref.Get ( );
 
 	UBioAutoConditionals_execF498_Parms F498_Parms;
 	F498_Parms.bioWorld = bioWorld;
@@ -28912,10 +27654,9 @@ bool UBioAutoConditionals::F498 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F497 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF497 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF497Ref { L"Function PlotManager.BioAutoConditionals.F497", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF497 )
-		pFnF497 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F497" );
+	UFunction* const pFnF497 = pFnF497Ref.Get ( );
 
 	UBioAutoConditionals_execF497_Parms F497_Parms;
 	F497_Parms.bioWorld = bioWorld;
@@ -28935,10 +27676,9 @@ bool UBioAutoConditionals::F497 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F496 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF496 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF496Ref { L"Function PlotManager.BioAutoConditionals.F496", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF496 )
-		pFnF496 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F496" );
+	UFunction* const pFnF496 = pFnF496Ref.Get ( );
 
 	UBioAutoConditionals_execF496_Parms F496_Parms;
 	F496_Parms.bioWorld = bioWorld;
@@ -28958,10 +27698,9 @@ bool UBioAutoConditionals::F496 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F495 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF495 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF495Ref { L"Function PlotManager.BioAutoConditionals.F495", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF495 )
-		pFnF495 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F495" );
+	UFunction* const pFnF495 = pFnF495Ref.Get ( );
 
 	UBioAutoConditionals_execF495_Parms F495_Parms;
 	F495_Parms.bioWorld = bioWorld;
@@ -28981,10 +27720,9 @@ bool UBioAutoConditionals::F495 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F494 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF494 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF494Ref { L"Function PlotManager.BioAutoConditionals.F494", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF494 )
-		pFnF494 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F494" );
+	UFunction* const pFnF494 = pFnF494Ref.Get ( );
 
 	UBioAutoConditionals_execF494_Parms F494_Parms;
 	F494_Parms.bioWorld = bioWorld;
@@ -29004,10 +27742,9 @@ bool UBioAutoConditionals::F494 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F493 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF493 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF493Ref { L"Function PlotManager.BioAutoConditionals.F493", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF493 )
-		pFnF493 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F493" );
+	UFunction* const pFnF493 = pFnF493Ref.Get ( );
 
 	UBioAutoConditionals_execF493_Parms F493_Parms;
 	F493_Parms.bioWorld = bioWorld;
@@ -29027,10 +27764,9 @@ bool UBioAutoConditionals::F493 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F982 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF982 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF982Ref { L"Function PlotManager.BioAutoConditionals.F982", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF982 )
-		pFnF982 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F982" );
+	UFunction* const pFnF982 = pFnF982Ref.Get ( );
 
 	UBioAutoConditionals_execF982_Parms F982_Parms;
 	F982_Parms.bioWorld = bioWorld;
@@ -29050,10 +27786,9 @@ bool UBioAutoConditionals::F982 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F981 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF981 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF981Ref { L"Function PlotManager.BioAutoConditionals.F981", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF981 )
-		pFnF981 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F981" );
+	UFunction* const pFnF981 = pFnF981Ref.Get ( );
 
 	UBioAutoConditionals_execF981_Parms F981_Parms;
 	F981_Parms.bioWorld = bioWorld;
@@ -29073,10 +27808,9 @@ bool UBioAutoConditionals::F981 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1200 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1200 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1200Ref { L"Function PlotManager.BioAutoConditionals.F1200", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1200 )
-		pFnF1200 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1200" );
+	UFunction* const pFnF1200 = pFnF1200Ref.Get ( );
 
 	UBioAutoConditionals_execF1200_Parms F1200_Parms;
 	F1200_Parms.bioWorld = bioWorld;
@@ -29096,10 +27830,9 @@ bool UBioAutoConditionals::F1200 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F956 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF956 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF956Ref { L"Function PlotManager.BioAutoConditionals.F956", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF956 )
-		pFnF956 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F956" );
+	UFunction* const pFnF956 = pFnF956Ref.Get ( );
 
 	UBioAutoConditionals_execF956_Parms F956_Parms;
 	F956_Parms.bioWorld = bioWorld;
@@ -29119,10 +27852,9 @@ bool UBioAutoConditionals::F956 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F666 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF666 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF666Ref { L"Function PlotManager.BioAutoConditionals.F666", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF666 )
-		pFnF666 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F666" );
+	UFunction* const pFnF666 = pFnF666Ref.Get ( );
 
 	UBioAutoConditionals_execF666_Parms F666_Parms;
 	F666_Parms.bioWorld = bioWorld;
@@ -29142,10 +27874,9 @@ bool UBioAutoConditionals::F666 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F663 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF663 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF663Ref { L"Function PlotManager.BioAutoConditionals.F663", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF663 )
-		pFnF663 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F663" );
+	UFunction* const pFnF663 = pFnF663Ref.Get ( );
 
 	UBioAutoConditionals_execF663_Parms F663_Parms;
 	F663_Parms.bioWorld = bioWorld;
@@ -29165,10 +27896,9 @@ bool UBioAutoConditionals::F663 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F662 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF662 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF662Ref { L"Function PlotManager.BioAutoConditionals.F662", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF662 )
-		pFnF662 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F662" );
+	UFunction* const pFnF662 = pFnF662Ref.Get ( );
 
 	UBioAutoConditionals_execF662_Parms F662_Parms;
 	F662_Parms.bioWorld = bioWorld;
@@ -29188,10 +27918,9 @@ bool UBioAutoConditionals::F662 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F661 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF661 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF661Ref { L"Function PlotManager.BioAutoConditionals.F661", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF661 )
-		pFnF661 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F661" );
+	UFunction* const pFnF661 = pFnF661Ref.Get ( );
 
 	UBioAutoConditionals_execF661_Parms F661_Parms;
 	F661_Parms.bioWorld = bioWorld;
@@ -29211,10 +27940,9 @@ bool UBioAutoConditionals::F661 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F660 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF660 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF660Ref { L"Function PlotManager.BioAutoConditionals.F660", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF660 )
-		pFnF660 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F660" );
+	UFunction* const pFnF660 = pFnF660Ref.Get ( );
 
 	UBioAutoConditionals_execF660_Parms F660_Parms;
 	F660_Parms.bioWorld = bioWorld;
@@ -29234,10 +27962,9 @@ bool UBioAutoConditionals::F660 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F659 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF659 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF659Ref { L"Function PlotManager.BioAutoConditionals.F659", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF659 )
-		pFnF659 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F659" );
+	UFunction* const pFnF659 = pFnF659Ref.Get ( );
 
 	UBioAutoConditionals_execF659_Parms F659_Parms;
 	F659_Parms.bioWorld = bioWorld;
@@ -29257,10 +27984,9 @@ bool UBioAutoConditionals::F659 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F658 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF658 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF658Ref { L"Function PlotManager.BioAutoConditionals.F658", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF658 )
-		pFnF658 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F658" );
+	UFunction* const pFnF658 = pFnF658Ref.Get ( );
 
 	UBioAutoConditionals_execF658_Parms F658_Parms;
 	F658_Parms.bioWorld = bioWorld;
@@ -29280,10 +28006,9 @@ bool UBioAutoConditionals::F658 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F657 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF657 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF657Ref { L"Function PlotManager.BioAutoConditionals.F657", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF657 )
-		pFnF657 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F657" );
+	UFunction* const pFnF657 = pFnF657Ref.Get ( );
 
 	UBioAutoConditionals_execF657_Parms F657_Parms;
 	F657_Parms.bioWorld = bioWorld;
@@ -29303,10 +28028,9 @@ bool UBioAutoConditionals::F657 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F656 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF656 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF656Ref { L"Function PlotManager.BioAutoConditionals.F656", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF656 )
-		pFnF656 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F656" );
+	UFunction* const pFnF656 = pFnF656Ref.Get ( );
 
 	UBioAutoConditionals_execF656_Parms F656_Parms;
 	F656_Parms.bioWorld = bioWorld;
@@ -29326,10 +28050,9 @@ bool UBioAutoConditionals::F656 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F655 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF655 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF655Ref { L"Function PlotManager.BioAutoConditionals.F655", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF655 )
-		pFnF655 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F655" );
+	UFunction* const pFnF655 = pFnF655Ref.Get ( );
 
 	UBioAutoConditionals_execF655_Parms F655_Parms;
 	F655_Parms.bioWorld = bioWorld;
@@ -29349,10 +28072,9 @@ bool UBioAutoConditionals::F655 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F654 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF654 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF654Ref { L"Function PlotManager.BioAutoConditionals.F654", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF654 )
-		pFnF654 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F654" );
+	UFunction* const pFnF654 = pFnF654Ref.Get ( );
 
 	UBioAutoConditionals_execF654_Parms F654_Parms;
 	F654_Parms.bioWorld = bioWorld;
@@ -29372,10 +28094,9 @@ bool UBioAutoConditionals::F654 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F653 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF653 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF653Ref { L"Function PlotManager.BioAutoConditionals.F653", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF653 )
-		pFnF653 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F653" );
+	UFunction* const pFnF653 = pFnF653Ref.Get ( );
 
 	UBioAutoConditionals_execF653_Parms F653_Parms;
 	F653_Parms.bioWorld = bioWorld;
@@ -29395,10 +28116,9 @@ bool UBioAutoConditionals::F653 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F123 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF123 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF123Ref { L"Function PlotManager.BioAutoConditionals.F123", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF123 )
-		pFnF123 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F123" );
+	UFunction* const pFnF123 = pFnF123Ref.Get ( );
 
 	UBioAutoConditionals_execF123_Parms F123_Parms;
 	F123_Parms.bioWorld = bioWorld;
@@ -29418,10 +28138,9 @@ bool UBioAutoConditionals::F123 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F122 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF122 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF122Ref { L"Function PlotManager.BioAutoConditionals.F122", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF122 )
-		pFnF122 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F122" );
+	UFunction* const pFnF122 = pFnF122Ref.Get ( );
 
 	UBioAutoConditionals_execF122_Parms F122_Parms;
 	F122_Parms.bioWorld = bioWorld;
@@ -29441,10 +28160,9 @@ bool UBioAutoConditionals::F122 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F121 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF121 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF121Ref { L"Function PlotManager.BioAutoConditionals.F121", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF121 )
-		pFnF121 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F121" );
+	UFunction* const pFnF121 = pFnF121Ref.Get ( );
 
 	UBioAutoConditionals_execF121_Parms F121_Parms;
 	F121_Parms.bioWorld = bioWorld;
@@ -29464,10 +28182,9 @@ bool UBioAutoConditionals::F121 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F120 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF120 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF120Ref { L"Function PlotManager.BioAutoConditionals.F120", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF120 )
-		pFnF120 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F120" );
+	UFunction* const pFnF120 = pFnF120Ref.Get ( );
 
 	UBioAutoConditionals_execF120_Parms F120_Parms;
 	F120_Parms.bioWorld = bioWorld;
@@ -29487,10 +28204,9 @@ bool UBioAutoConditionals::F120 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F119 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF119 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF119Ref { L"Function PlotManager.BioAutoConditionals.F119", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF119 )
-		pFnF119 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F119" );
+	UFunction* const pFnF119 = pFnF119Ref.Get ( );
 
 	UBioAutoConditionals_execF119_Parms F119_Parms;
 	F119_Parms.bioWorld = bioWorld;
@@ -29510,10 +28226,9 @@ bool UBioAutoConditionals::F119 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F118 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF118 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF118Ref { L"Function PlotManager.BioAutoConditionals.F118", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF118 )
-		pFnF118 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F118" );
+	UFunction* const pFnF118 = pFnF118Ref.Get ( );
 
 	UBioAutoConditionals_execF118_Parms F118_Parms;
 	F118_Parms.bioWorld = bioWorld;
@@ -29533,10 +28248,9 @@ bool UBioAutoConditionals::F118 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F117 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF117 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF117Ref { L"Function PlotManager.BioAutoConditionals.F117", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF117 )
-		pFnF117 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F117" );
+	UFunction* const pFnF117 = pFnF117Ref.Get ( );
 
 	UBioAutoConditionals_execF117_Parms F117_Parms;
 	F117_Parms.bioWorld = bioWorld;
@@ -29556,10 +28270,9 @@ bool UBioAutoConditionals::F117 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F116 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF116 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF116Ref { L"Function PlotManager.BioAutoConditionals.F116", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF116 )
-		pFnF116 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F116" );
+	UFunction* const pFnF116 = pFnF116Ref.Get ( );
 
 	UBioAutoConditionals_execF116_Parms F116_Parms;
 	F116_Parms.bioWorld = bioWorld;
@@ -29579,10 +28292,9 @@ bool UBioAutoConditionals::F116 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F115 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF115 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF115Ref { L"Function PlotManager.BioAutoConditionals.F115", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF115 )
-		pFnF115 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F115" );
+	UFunction* const pFnF115 = pFnF115Ref.Get ( );
 
 	UBioAutoConditionals_execF115_Parms F115_Parms;
 	F115_Parms.bioWorld = bioWorld;
@@ -29602,10 +28314,9 @@ bool UBioAutoConditionals::F115 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F114 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF114 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF114Ref { L"Function PlotManager.BioAutoConditionals.F114", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF114 )
-		pFnF114 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F114" );
+	UFunction* const pFnF114 = pFnF114Ref.Get ( );
 
 	UBioAutoConditionals_execF114_Parms F114_Parms;
 	F114_Parms.bioWorld = bioWorld;
@@ -29625,10 +28336,9 @@ bool UBioAutoConditionals::F114 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F113 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF113 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF113Ref { L"Function PlotManager.BioAutoConditionals.F113", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF113 )
-		pFnF113 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F113" );
+	UFunction* const pFnF113 = pFnF113Ref.Get ( );
 
 	UBioAutoConditionals_execF113_Parms F113_Parms;
 	F113_Parms.bioWorld = bioWorld;
@@ -29648,10 +28358,9 @@ bool UBioAutoConditionals::F113 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F112 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF112 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF112Ref { L"Function PlotManager.BioAutoConditionals.F112", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF112 )
-		pFnF112 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F112" );
+	UFunction* const pFnF112 = pFnF112Ref.Get ( );
 
 	UBioAutoConditionals_execF112_Parms F112_Parms;
 	F112_Parms.bioWorld = bioWorld;
@@ -29671,10 +28380,9 @@ bool UBioAutoConditionals::F112 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F80 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF80 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF80Ref { L"Function PlotManager.BioAutoConditionals.F80", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF80 )
-		pFnF80 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F80" );
+	UFunction* const pFnF80 = pFnF80Ref.Get ( );
 
 	UBioAutoConditionals_execF80_Parms F80_Parms;
 	F80_Parms.bioWorld = bioWorld;
@@ -29694,10 +28402,9 @@ bool UBioAutoConditionals::F80 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F79 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF79 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF79Ref { L"Function PlotManager.BioAutoConditionals.F79", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF79 )
-		pFnF79 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F79" );
+	UFunction* const pFnF79 = pFnF79Ref.Get ( );
 
 	UBioAutoConditionals_execF79_Parms F79_Parms;
 	F79_Parms.bioWorld = bioWorld;
@@ -29717,10 +28424,9 @@ bool UBioAutoConditionals::F79 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F78 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF78 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF78Ref { L"Function PlotManager.BioAutoConditionals.F78", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF78 )
-		pFnF78 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F78" );
+	UFunction* const pFnF78 = pFnF78Ref.Get ( );
 
 	UBioAutoConditionals_execF78_Parms F78_Parms;
 	F78_Parms.bioWorld = bioWorld;
@@ -29740,10 +28446,9 @@ bool UBioAutoConditionals::F78 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F77 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF77 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF77Ref { L"Function PlotManager.BioAutoConditionals.F77", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF77 )
-		pFnF77 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F77" );
+	UFunction* const pFnF77 = pFnF77Ref.Get ( );
 
 	UBioAutoConditionals_execF77_Parms F77_Parms;
 	F77_Parms.bioWorld = bioWorld;
@@ -29763,10 +28468,9 @@ bool UBioAutoConditionals::F77 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F76 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF76 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF76Ref { L"Function PlotManager.BioAutoConditionals.F76", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF76 )
-		pFnF76 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F76" );
+	UFunction* const pFnF76 = pFnF76Ref.Get ( );
 
 	UBioAutoConditionals_execF76_Parms F76_Parms;
 	F76_Parms.bioWorld = bioWorld;
@@ -29786,10 +28490,9 @@ bool UBioAutoConditionals::F76 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F75 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF75 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF75Ref { L"Function PlotManager.BioAutoConditionals.F75", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF75 )
-		pFnF75 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F75" );
+	UFunction* const pFnF75 = pFnF75Ref.Get ( );
 
 	UBioAutoConditionals_execF75_Parms F75_Parms;
 	F75_Parms.bioWorld = bioWorld;
@@ -29809,10 +28512,9 @@ bool UBioAutoConditionals::F75 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F74 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF74 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF74Ref { L"Function PlotManager.BioAutoConditionals.F74", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF74 )
-		pFnF74 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F74" );
+	UFunction* const pFnF74 = pFnF74Ref.Get ( );
 
 	UBioAutoConditionals_execF74_Parms F74_Parms;
 	F74_Parms.bioWorld = bioWorld;
@@ -29832,10 +28534,9 @@ bool UBioAutoConditionals::F74 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F73 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF73 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF73Ref { L"Function PlotManager.BioAutoConditionals.F73", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF73 )
-		pFnF73 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F73" );
+	UFunction* const pFnF73 = pFnF73Ref.Get ( );
 
 	UBioAutoConditionals_execF73_Parms F73_Parms;
 	F73_Parms.bioWorld = bioWorld;
@@ -29855,10 +28556,9 @@ bool UBioAutoConditionals::F73 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F72 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF72 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF72Ref { L"Function PlotManager.BioAutoConditionals.F72", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF72 )
-		pFnF72 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F72" );
+	UFunction* const pFnF72 = pFnF72Ref.Get ( );
 
 	UBioAutoConditionals_execF72_Parms F72_Parms;
 	F72_Parms.bioWorld = bioWorld;
@@ -29878,10 +28578,9 @@ bool UBioAutoConditionals::F72 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F71 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF71 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF71Ref { L"Function PlotManager.BioAutoConditionals.F71", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF71 )
-		pFnF71 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F71" );
+	UFunction* const pFnF71 = pFnF71Ref.Get ( );
 
 	UBioAutoConditionals_execF71_Parms F71_Parms;
 	F71_Parms.bioWorld = bioWorld;
@@ -29901,10 +28600,9 @@ bool UBioAutoConditionals::F71 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F70 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF70 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF70Ref { L"Function PlotManager.BioAutoConditionals.F70", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF70 )
-		pFnF70 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F70" );
+	UFunction* const pFnF70 = pFnF70Ref.Get ( );
 
 	UBioAutoConditionals_execF70_Parms F70_Parms;
 	F70_Parms.bioWorld = bioWorld;
@@ -29924,10 +28622,9 @@ bool UBioAutoConditionals::F70 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F69 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF69 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF69Ref { L"Function PlotManager.BioAutoConditionals.F69", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF69 )
-		pFnF69 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F69" );
+	UFunction* const pFnF69 = pFnF69Ref.Get ( );
 
 	UBioAutoConditionals_execF69_Parms F69_Parms;
 	F69_Parms.bioWorld = bioWorld;
@@ -29947,10 +28644,9 @@ bool UBioAutoConditionals::F69 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F892 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF892 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF892Ref { L"Function PlotManager.BioAutoConditionals.F892", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF892 )
-		pFnF892 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F892" );
+	UFunction* const pFnF892 = pFnF892Ref.Get ( );
 
 	UBioAutoConditionals_execF892_Parms F892_Parms;
 	F892_Parms.bioWorld = bioWorld;
@@ -29970,10 +28666,9 @@ bool UBioAutoConditionals::F892 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F351 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF351 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF351Ref { L"Function PlotManager.BioAutoConditionals.F351", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF351 )
-		pFnF351 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F351" );
+	UFunction* const pFnF351 = pFnF351Ref.Get ( );
 
 	UBioAutoConditionals_execF351_Parms F351_Parms;
 	F351_Parms.bioWorld = bioWorld;
@@ -29993,10 +28688,9 @@ bool UBioAutoConditionals::F351 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F93 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF93 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF93Ref { L"Function PlotManager.BioAutoConditionals.F93", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF93 )
-		pFnF93 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F93" );
+	UFunction* const pFnF93 = pFnF93Ref.Get ( );
 
 	UBioAutoConditionals_execF93_Parms F93_Parms;
 	F93_Parms.bioWorld = bioWorld;
@@ -30016,10 +28710,9 @@ bool UBioAutoConditionals::F93 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F92 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF92 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF92Ref { L"Function PlotManager.BioAutoConditionals.F92", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF92 )
-		pFnF92 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F92" );
+	UFunction* const pFnF92 = pFnF92Ref.Get ( );
 
 	UBioAutoConditionals_execF92_Parms F92_Parms;
 	F92_Parms.bioWorld = bioWorld;
@@ -30039,10 +28732,9 @@ bool UBioAutoConditionals::F92 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F91 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF91 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF91Ref { L"Function PlotManager.BioAutoConditionals.F91", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF91 )
-		pFnF91 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F91" );
+	UFunction* const pFnF91 = pFnF91Ref.Get ( );
 
 	UBioAutoConditionals_execF91_Parms F91_Parms;
 	F91_Parms.bioWorld = bioWorld;
@@ -30062,10 +28754,9 @@ bool UBioAutoConditionals::F91 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F90 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF90 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF90Ref { L"Function PlotManager.BioAutoConditionals.F90", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF90 )
-		pFnF90 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F90" );
+	UFunction* const pFnF90 = pFnF90Ref.Get ( );
 
 	UBioAutoConditionals_execF90_Parms F90_Parms;
 	F90_Parms.bioWorld = bioWorld;
@@ -30085,10 +28776,9 @@ bool UBioAutoConditionals::F90 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F89 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF89 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF89Ref { L"Function PlotManager.BioAutoConditionals.F89", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF89 )
-		pFnF89 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F89" );
+	UFunction* const pFnF89 = pFnF89Ref.Get ( );
 
 	UBioAutoConditionals_execF89_Parms F89_Parms;
 	F89_Parms.bioWorld = bioWorld;
@@ -30108,10 +28798,9 @@ bool UBioAutoConditionals::F89 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F88 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF88 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF88Ref { L"Function PlotManager.BioAutoConditionals.F88", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF88 )
-		pFnF88 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F88" );
+	UFunction* const pFnF88 = pFnF88Ref.Get ( );
 
 	UBioAutoConditionals_execF88_Parms F88_Parms;
 	F88_Parms.bioWorld = bioWorld;
@@ -30131,10 +28820,9 @@ bool UBioAutoConditionals::F88 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F87 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF87 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF87Ref { L"Function PlotManager.BioAutoConditionals.F87", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF87 )
-		pFnF87 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F87" );
+	UFunction* const pFnF87 = pFnF87Ref.Get ( );
 
 	UBioAutoConditionals_execF87_Parms F87_Parms;
 	F87_Parms.bioWorld = bioWorld;
@@ -30154,10 +28842,9 @@ bool UBioAutoConditionals::F87 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F86 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF86 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF86Ref { L"Function PlotManager.BioAutoConditionals.F86", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF86 )
-		pFnF86 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F86" );
+	UFunction* const pFnF86 = pFnF86Ref.Get ( );
 
 	UBioAutoConditionals_execF86_Parms F86_Parms;
 	F86_Parms.bioWorld = bioWorld;
@@ -30177,10 +28864,9 @@ bool UBioAutoConditionals::F86 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F85 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF85 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF85Ref { L"Function PlotManager.BioAutoConditionals.F85", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF85 )
-		pFnF85 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F85" );
+	UFunction* const pFnF85 = pFnF85Ref.Get ( );
 
 	UBioAutoConditionals_execF85_Parms F85_Parms;
 	F85_Parms.bioWorld = bioWorld;
@@ -30200,10 +28886,9 @@ bool UBioAutoConditionals::F85 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F83 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF83 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF83Ref { L"Function PlotManager.BioAutoConditionals.F83", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF83 )
-		pFnF83 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F83" );
+	UFunction* const pFnF83 = pFnF83Ref.Get ( );
 
 	UBioAutoConditionals_execF83_Parms F83_Parms;
 	F83_Parms.bioWorld = bioWorld;
@@ -30223,10 +28908,9 @@ bool UBioAutoConditionals::F83 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F82 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF82 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF82Ref { L"Function PlotManager.BioAutoConditionals.F82", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF82 )
-		pFnF82 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F82" );
+	UFunction* const pFnF82 = pFnF82Ref.Get ( );
 
 	UBioAutoConditionals_execF82_Parms F82_Parms;
 	F82_Parms.bioWorld = bioWorld;
@@ -30246,10 +28930,9 @@ bool UBioAutoConditionals::F82 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F81 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF81 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF81Ref { L"Function PlotManager.BioAutoConditionals.F81", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF81 )
-		pFnF81 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F81" );
+	UFunction* const pFnF81 = pFnF81Ref.Get ( );
 
 	UBioAutoConditionals_execF81_Parms F81_Parms;
 	F81_Parms.bioWorld = bioWorld;
@@ -30269,10 +28952,9 @@ bool UBioAutoConditionals::F81 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F106 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF106 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF106Ref { L"Function PlotManager.BioAutoConditionals.F106", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF106 )
-		pFnF106 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F106" );
+	UFunction* const pFnF106 = pFnF106Ref.Get ( );
 
 	UBioAutoConditionals_execF106_Parms F106_Parms;
 	F106_Parms.bioWorld = bioWorld;
@@ -30292,10 +28974,9 @@ bool UBioAutoConditionals::F106 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F105 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF105 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF105Ref { L"Function PlotManager.BioAutoConditionals.F105", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF105 )
-		pFnF105 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F105" );
+	UFunction* const pFnF105 = pFnF105Ref.Get ( );
 
 	UBioAutoConditionals_execF105_Parms F105_Parms;
 	F105_Parms.bioWorld = bioWorld;
@@ -30315,10 +28996,9 @@ bool UBioAutoConditionals::F105 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F104 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF104 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF104Ref { L"Function PlotManager.BioAutoConditionals.F104", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF104 )
-		pFnF104 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F104" );
+	UFunction* const pFnF104 = pFnF104Ref.Get ( );
 
 	UBioAutoConditionals_execF104_Parms F104_Parms;
 	F104_Parms.bioWorld = bioWorld;
@@ -30338,10 +29018,9 @@ bool UBioAutoConditionals::F104 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F103 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF103 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF103Ref { L"Function PlotManager.BioAutoConditionals.F103", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF103 )
-		pFnF103 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F103" );
+	UFunction* const pFnF103 = pFnF103Ref.Get ( );
 
 	UBioAutoConditionals_execF103_Parms F103_Parms;
 	F103_Parms.bioWorld = bioWorld;
@@ -30361,10 +29040,9 @@ bool UBioAutoConditionals::F103 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F102 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF102 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF102Ref { L"Function PlotManager.BioAutoConditionals.F102", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF102 )
-		pFnF102 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F102" );
+	UFunction* const pFnF102 = pFnF102Ref.Get ( );
 
 	UBioAutoConditionals_execF102_Parms F102_Parms;
 	F102_Parms.bioWorld = bioWorld;
@@ -30384,10 +29062,9 @@ bool UBioAutoConditionals::F102 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F101 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF101 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF101Ref { L"Function PlotManager.BioAutoConditionals.F101", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF101 )
-		pFnF101 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F101" );
+	UFunction* const pFnF101 = pFnF101Ref.Get ( );
 
 	UBioAutoConditionals_execF101_Parms F101_Parms;
 	F101_Parms.bioWorld = bioWorld;
@@ -30407,10 +29084,9 @@ bool UBioAutoConditionals::F101 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F100 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF100 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF100Ref { L"Function PlotManager.BioAutoConditionals.F100", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF100 )
-		pFnF100 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F100" );
+	UFunction* const pFnF100 = pFnF100Ref.Get ( );
 
 	UBioAutoConditionals_execF100_Parms F100_Parms;
 	F100_Parms.bioWorld = bioWorld;
@@ -30430,10 +29106,9 @@ bool UBioAutoConditionals::F100 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F99 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF99 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF99Ref { L"Function PlotManager.BioAutoConditionals.F99", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF99 )
-		pFnF99 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F99" );
+	UFunction* const pFnF99 = pFnF99Ref.Get ( );
 
 	UBioAutoConditionals_execF99_Parms F99_Parms;
 	F99_Parms.bioWorld = bioWorld;
@@ -30453,10 +29128,9 @@ bool UBioAutoConditionals::F99 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F98 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF98 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF98Ref { L"Function PlotManager.BioAutoConditionals.F98", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF98 )
-		pFnF98 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F98" );
+	UFunction* const pFnF98 = pFnF98Ref.Get ( );
 
 	UBioAutoConditionals_execF98_Parms F98_Parms;
 	F98_Parms.bioWorld = bioWorld;
@@ -30476,10 +29150,9 @@ bool UBioAutoConditionals::F98 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F97 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF97 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF97Ref { L"Function PlotManager.BioAutoConditionals.F97", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF97 )
-		pFnF97 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F97" );
+	UFunction* const pFnF97 = pFnF97Ref.Get ( );
 
 	UBioAutoConditionals_execF97_Parms F97_Parms;
 	F97_Parms.bioWorld = bioWorld;
@@ -30499,10 +29172,9 @@ bool UBioAutoConditionals::F97 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F96 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF96 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF96Ref { L"Function PlotManager.BioAutoConditionals.F96", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF96 )
-		pFnF96 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F96" );
+	UFunction* const pFnF96 = pFnF96Ref.Get ( );
 
 	UBioAutoConditionals_execF96_Parms F96_Parms;
 	F96_Parms.bioWorld = bioWorld;
@@ -30522,10 +29194,9 @@ bool UBioAutoConditionals::F96 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F95 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF95 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF95Ref { L"Function PlotManager.BioAutoConditionals.F95", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF95 )
-		pFnF95 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F95" );
+	UFunction* const pFnF95 = pFnF95Ref.Get ( );
 
 	UBioAutoConditionals_execF95_Parms F95_Parms;
 	F95_Parms.bioWorld = bioWorld;
@@ -30545,10 +29216,9 @@ bool UBioAutoConditionals::F95 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F475 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF475 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF475Ref { L"Function PlotManager.BioAutoConditionals.F475", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF475 )
-		pFnF475 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F475" );
+	UFunction* const pFnF475 = pFnF475Ref.Get ( );
 
 	UBioAutoConditionals_execF475_Parms F475_Parms;
 	F475_Parms.bioWorld = bioWorld;
@@ -30568,10 +29238,9 @@ bool UBioAutoConditionals::F475 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F24 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF24 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF24Ref { L"Function PlotManager.BioAutoConditionals.F24", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF24 )
-		pFnF24 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F24" );
+	UFunction* const pFnF24 = pFnF24Ref.Get ( );
 
 	UBioAutoConditionals_execF24_Parms F24_Parms;
 	F24_Parms.bioWorld = bioWorld;
@@ -30591,10 +29260,9 @@ bool UBioAutoConditionals::F24 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F23 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF23 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF23Ref { L"Function PlotManager.BioAutoConditionals.F23", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF23 )
-		pFnF23 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F23" );
+	UFunction* const pFnF23 = pFnF23Ref.Get ( );
 
 	UBioAutoConditionals_execF23_Parms F23_Parms;
 	F23_Parms.bioWorld = bioWorld;
@@ -30614,10 +29282,9 @@ bool UBioAutoConditionals::F23 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F22 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF22 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF22Ref { L"Function PlotManager.BioAutoConditionals.F22", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF22 )
-		pFnF22 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F22" );
+	UFunction* const pFnF22 = pFnF22Ref.Get ( );
 
 	UBioAutoConditionals_execF22_Parms F22_Parms;
 	F22_Parms.bioWorld = bioWorld;
@@ -30637,10 +29304,9 @@ bool UBioAutoConditionals::F22 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F21 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF21 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF21Ref { L"Function PlotManager.BioAutoConditionals.F21", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF21 )
-		pFnF21 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F21" );
+	UFunction* const pFnF21 = pFnF21Ref.Get ( );
 
 	UBioAutoConditionals_execF21_Parms F21_Parms;
 	F21_Parms.bioWorld = bioWorld;
@@ -30660,10 +29326,9 @@ bool UBioAutoConditionals::F21 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F20 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF20 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF20Ref { L"Function PlotManager.BioAutoConditionals.F20", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF20 )
-		pFnF20 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F20" );
+	UFunction* const pFnF20 = pFnF20Ref.Get ( );
 
 	UBioAutoConditionals_execF20_Parms F20_Parms;
 	F20_Parms.bioWorld = bioWorld;
@@ -30683,10 +29348,9 @@ bool UBioAutoConditionals::F20 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F19 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF19 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF19Ref { L"Function PlotManager.BioAutoConditionals.F19", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF19 )
-		pFnF19 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F19" );
+	UFunction* const pFnF19 = pFnF19Ref.Get ( );
 
 	UBioAutoConditionals_execF19_Parms F19_Parms;
 	F19_Parms.bioWorld = bioWorld;
@@ -30706,10 +29370,9 @@ bool UBioAutoConditionals::F19 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F18 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF18 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF18Ref { L"Function PlotManager.BioAutoConditionals.F18", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF18 )
-		pFnF18 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F18" );
+	UFunction* const pFnF18 = pFnF18Ref.Get ( );
 
 	UBioAutoConditionals_execF18_Parms F18_Parms;
 	F18_Parms.bioWorld = bioWorld;
@@ -30729,10 +29392,9 @@ bool UBioAutoConditionals::F18 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F17 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF17 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF17Ref { L"Function PlotManager.BioAutoConditionals.F17", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF17 )
-		pFnF17 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F17" );
+	UFunction* const pFnF17 = pFnF17Ref.Get ( );
 
 	UBioAutoConditionals_execF17_Parms F17_Parms;
 	F17_Parms.bioWorld = bioWorld;
@@ -30752,10 +29414,9 @@ bool UBioAutoConditionals::F17 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F16 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF16 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF16Ref { L"Function PlotManager.BioAutoConditionals.F16", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF16 )
-		pFnF16 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F16" );
+	UFunction* const pFnF16 = pFnF16Ref.Get ( );
 
 	UBioAutoConditionals_execF16_Parms F16_Parms;
 	F16_Parms.bioWorld = bioWorld;
@@ -30775,10 +29436,9 @@ bool UBioAutoConditionals::F16 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F15 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF15 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF15Ref { L"Function PlotManager.BioAutoConditionals.F15", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF15 )
-		pFnF15 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F15" );
+	UFunction* const pFnF15 = pFnF15Ref.Get ( );
 
 	UBioAutoConditionals_execF15_Parms F15_Parms;
 	F15_Parms.bioWorld = bioWorld;
@@ -30798,10 +29458,9 @@ bool UBioAutoConditionals::F15 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F14 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF14 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF14Ref { L"Function PlotManager.BioAutoConditionals.F14", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF14 )
-		pFnF14 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F14" );
+	UFunction* const pFnF14 = pFnF14Ref.Get ( );
 
 	UBioAutoConditionals_execF14_Parms F14_Parms;
 	F14_Parms.bioWorld = bioWorld;
@@ -30821,10 +29480,9 @@ bool UBioAutoConditionals::F14 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F13 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF13 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF13Ref { L"Function PlotManager.BioAutoConditionals.F13", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF13 )
-		pFnF13 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F13" );
+	UFunction* const pFnF13 = pFnF13Ref.Get ( );
 
 	UBioAutoConditionals_execF13_Parms F13_Parms;
 	F13_Parms.bioWorld = bioWorld;
@@ -30844,10 +29502,9 @@ bool UBioAutoConditionals::F13 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1277 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1277 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1277Ref { L"Function PlotManager.BioAutoConditionals.F1277", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1277 )
-		pFnF1277 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1277" );
+	UFunction* const pFnF1277 = pFnF1277Ref.Get ( );
 
 	UBioAutoConditionals_execF1277_Parms F1277_Parms;
 	F1277_Parms.bioWorld = bioWorld;
@@ -30867,10 +29524,9 @@ bool UBioAutoConditionals::F1277 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1178 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1178 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1178Ref { L"Function PlotManager.BioAutoConditionals.F1178", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1178 )
-		pFnF1178 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1178" );
+	UFunction* const pFnF1178 = pFnF1178Ref.Get ( );
 
 	UBioAutoConditionals_execF1178_Parms F1178_Parms;
 	F1178_Parms.bioWorld = bioWorld;
@@ -30890,10 +29546,9 @@ bool UBioAutoConditionals::F1178 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F12 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF12 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF12Ref { L"Function PlotManager.BioAutoConditionals.F12", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF12 )
-		pFnF12 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F12" );
+	UFunction* const pFnF12 = pFnF12Ref.Get ( );
 
 	UBioAutoConditionals_execF12_Parms F12_Parms;
 	F12_Parms.bioWorld = bioWorld;
@@ -30913,10 +29568,9 @@ bool UBioAutoConditionals::F12 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F11 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF11 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF11Ref { L"Function PlotManager.BioAutoConditionals.F11", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF11 )
-		pFnF11 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F11" );
+	UFunction* const pFnF11 = pFnF11Ref.Get ( );
 
 	UBioAutoConditionals_execF11_Parms F11_Parms;
 	F11_Parms.bioWorld = bioWorld;
@@ -30936,10 +29590,9 @@ bool UBioAutoConditionals::F11 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F10 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF10 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF10Ref { L"Function PlotManager.BioAutoConditionals.F10", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF10 )
-		pFnF10 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F10" );
+	UFunction* const pFnF10 = pFnF10Ref.Get ( );
 
 	UBioAutoConditionals_execF10_Parms F10_Parms;
 	F10_Parms.bioWorld = bioWorld;
@@ -30959,10 +29612,9 @@ bool UBioAutoConditionals::F10 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F9 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF9 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF9Ref { L"Function PlotManager.BioAutoConditionals.F9", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF9 )
-		pFnF9 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F9" );
+	UFunction* const pFnF9 = pFnF9Ref.Get ( );
 
 	UBioAutoConditionals_execF9_Parms F9_Parms;
 	F9_Parms.bioWorld = bioWorld;
@@ -30982,10 +29634,9 @@ bool UBioAutoConditionals::F9 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F8 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF8 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF8Ref { L"Function PlotManager.BioAutoConditionals.F8", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF8 )
-		pFnF8 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F8" );
+	UFunction* const pFnF8 = pFnF8Ref.Get ( );
 
 	UBioAutoConditionals_execF8_Parms F8_Parms;
 	F8_Parms.bioWorld = bioWorld;
@@ -31005,10 +29656,9 @@ bool UBioAutoConditionals::F8 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F7 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF7 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF7Ref { L"Function PlotManager.BioAutoConditionals.F7", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF7 )
-		pFnF7 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F7" );
+	UFunction* const pFnF7 = pFnF7Ref.Get ( );
 
 	UBioAutoConditionals_execF7_Parms F7_Parms;
 	F7_Parms.bioWorld = bioWorld;
@@ -31028,10 +29678,9 @@ bool UBioAutoConditionals::F7 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F6 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF6 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF6Ref { L"Function PlotManager.BioAutoConditionals.F6", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF6 )
-		pFnF6 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F6" );
+	UFunction* const pFnF6 = pFnF6Ref.Get ( );
 
 	UBioAutoConditionals_execF6_Parms F6_Parms;
 	F6_Parms.bioWorld = bioWorld;
@@ -31051,10 +29700,9 @@ bool UBioAutoConditionals::F6 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F5 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF5 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF5Ref { L"Function PlotManager.BioAutoConditionals.F5", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF5 )
-		pFnF5 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F5" );
+	UFunction* const pFnF5 = pFnF5Ref.Get ( );
 
 	UBioAutoConditionals_execF5_Parms F5_Parms;
 	F5_Parms.bioWorld = bioWorld;
@@ -31074,10 +29722,9 @@ bool UBioAutoConditionals::F5 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F4 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF4 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF4Ref { L"Function PlotManager.BioAutoConditionals.F4", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF4 )
-		pFnF4 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F4" );
+	UFunction* const pFnF4 = pFnF4Ref.Get ( );
 
 	UBioAutoConditionals_execF4_Parms F4_Parms;
 	F4_Parms.bioWorld = bioWorld;
@@ -31097,10 +29744,9 @@ bool UBioAutoConditionals::F4 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F3 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF3 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF3Ref { L"Function PlotManager.BioAutoConditionals.F3", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF3 )
-		pFnF3 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F3" );
+	UFunction* const pFnF3 = pFnF3Ref.Get ( );
 
 	UBioAutoConditionals_execF3_Parms F3_Parms;
 	F3_Parms.bioWorld = bioWorld;
@@ -31120,10 +29766,9 @@ bool UBioAutoConditionals::F3 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F2 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF2 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF2Ref { L"Function PlotManager.BioAutoConditionals.F2", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF2 )
-		pFnF2 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F2" );
+	UFunction* const pFnF2 = pFnF2Ref.Get ( );
 
 	UBioAutoConditionals_execF2_Parms F2_Parms;
 	F2_Parms.bioWorld = bioWorld;
@@ -31143,10 +29788,9 @@ bool UBioAutoConditionals::F2 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1Ref { L"Function PlotManager.BioAutoConditionals.F1", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1 )
-		pFnF1 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1" );
+	UFunction* const pFnF1 = pFnF1Ref.Get ( );
 
 	UBioAutoConditionals_execF1_Parms F1_Parms;
 	F1_Parms.bioWorld = bioWorld;
@@ -31166,10 +29810,9 @@ bool UBioAutoConditionals::F1 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F1507 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF1507 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF1507Ref { L"Function PlotManager.BioAutoConditionals.F1507", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF1507 )
-		pFnF1507 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F1507" );
+	UFunction* const pFnF1507 = pFnF1507Ref.Get ( );
 
 	UBioAutoConditionals_execF1507_Parms F1507_Parms;
 	F1507_Parms.bioWorld = bioWorld;
@@ -31189,10 +29832,9 @@ bool UBioAutoConditionals::F1507 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F169 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF169 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF169Ref { L"Function PlotManager.BioAutoConditionals.F169", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF169 )
-		pFnF169 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F169" );
+	UFunction* const pFnF169 = pFnF169Ref.Get ( );
 
 	UBioAutoConditionals_execF169_Parms F169_Parms;
 	F169_Parms.bioWorld = bioWorld;
@@ -31212,10 +29854,9 @@ bool UBioAutoConditionals::F169 ( class ABioWorldInfo* bioWorld, int Argument )
 
 bool UBioAutoConditionals::F924 ( class ABioWorldInfo* bioWorld, int Argument )
 {
-	static UFunction* pFnF924 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnF924Ref { L"Function PlotManager.BioAutoConditionals.F924", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnF924 )
-		pFnF924 = UObject::FindObject< UFunction > ( L"Function PlotManager.BioAutoConditionals.F924" );
+	UFunction* const pFnF924 = pFnF924Ref.Get ( );
 
 	UBioAutoConditionals_execF924_Parms F924_Parms;
 	F924_Parms.bioWorld = bioWorld;
@@ -31228,6 +29869,1377 @@ bool UBioAutoConditionals::F924 ( class ABioWorldInfo* bioWorld, int Argument )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class PlotManager.BioAutoConditionals",
+	L"Function PlotManager.BioAutoConditionals.F1194",
+	L"Function PlotManager.BioAutoConditionals.F1193",
+	L"Function PlotManager.BioAutoConditionals.F1192",
+	L"Function PlotManager.BioAutoConditionals.F1191",
+	L"Function PlotManager.BioAutoConditionals.F1190",
+	L"Function PlotManager.BioAutoConditionals.F1189",
+	L"Function PlotManager.BioAutoConditionals.F1188",
+	L"Function PlotManager.BioAutoConditionals.F1187",
+	L"Function PlotManager.BioAutoConditionals.F1255",
+	L"Function PlotManager.BioAutoConditionals.F1254",
+	L"Function PlotManager.BioAutoConditionals.F1854",
+	L"Function PlotManager.BioAutoConditionals.F1663",
+	L"Function PlotManager.BioAutoConditionals.F1662",
+	L"Function PlotManager.BioAutoConditionals.F1661",
+	L"Function PlotManager.BioAutoConditionals.F1660",
+	L"Function PlotManager.BioAutoConditionals.F1659",
+	L"Function PlotManager.BioAutoConditionals.F1658",
+	L"Function PlotManager.BioAutoConditionals.F1657",
+	L"Function PlotManager.BioAutoConditionals.F2017",
+	L"Function PlotManager.BioAutoConditionals.F2016",
+	L"Function PlotManager.BioAutoConditionals.F2015",
+	L"Function PlotManager.BioAutoConditionals.F2014",
+	L"Function PlotManager.BioAutoConditionals.F2013",
+	L"Function PlotManager.BioAutoConditionals.F2012",
+	L"Function PlotManager.BioAutoConditionals.F2011",
+	L"Function PlotManager.BioAutoConditionals.F2010",
+	L"Function PlotManager.BioAutoConditionals.F492",
+	L"Function PlotManager.BioAutoConditionals.F469",
+	L"Function PlotManager.BioAutoConditionals.F452",
+	L"Function PlotManager.BioAutoConditionals.F168",
+	L"Function PlotManager.BioAutoConditionals.F167",
+	L"Function PlotManager.BioAutoConditionals.F166",
+	L"Function PlotManager.BioAutoConditionals.F617",
+	L"Function PlotManager.BioAutoConditionals.F616",
+	L"Function PlotManager.BioAutoConditionals.F615",
+	L"Function PlotManager.BioAutoConditionals.F614",
+	L"Function PlotManager.BioAutoConditionals.F613",
+	L"Function PlotManager.BioAutoConditionals.F612",
+	L"Function PlotManager.BioAutoConditionals.F611",
+	L"Function PlotManager.BioAutoConditionals.F610",
+	L"Function PlotManager.BioAutoConditionals.F872",
+	L"Function PlotManager.BioAutoConditionals.F871",
+	L"Function PlotManager.BioAutoConditionals.F870",
+	L"Function PlotManager.BioAutoConditionals.F94",
+	L"Function PlotManager.BioAutoConditionals.F368",
+	L"Function PlotManager.BioAutoConditionals.F367",
+	L"Function PlotManager.BioAutoConditionals.F366",
+	L"Function PlotManager.BioAutoConditionals.F1043",
+	L"Function PlotManager.BioAutoConditionals.F1042",
+	L"Function PlotManager.BioAutoConditionals.F1041",
+	L"Function PlotManager.BioAutoConditionals.F1040",
+	L"Function PlotManager.BioAutoConditionals.F1489",
+	L"Function PlotManager.BioAutoConditionals.F1488",
+	L"Function PlotManager.BioAutoConditionals.F317",
+	L"Function PlotManager.BioAutoConditionals.F316",
+	L"Function PlotManager.BioAutoConditionals.F1395",
+	L"Function PlotManager.BioAutoConditionals.F1403",
+	L"Function PlotManager.BioAutoConditionals.F1405",
+	L"Function PlotManager.BioAutoConditionals.F1623",
+	L"Function PlotManager.BioAutoConditionals.F1514",
+	L"Function PlotManager.BioAutoConditionals.F1407",
+	L"Function PlotManager.BioAutoConditionals.F1401",
+	L"Function PlotManager.BioAutoConditionals.F1404",
+	L"Function PlotManager.BioAutoConditionals.F1387",
+	L"Function PlotManager.BioAutoConditionals.F1380",
+	L"Function PlotManager.BioAutoConditionals.F1388",
+	L"Function PlotManager.BioAutoConditionals.F1381",
+	L"Function PlotManager.BioAutoConditionals.F1406",
+	L"Function PlotManager.BioAutoConditionals.F1402",
+	L"Function PlotManager.BioAutoConditionals.F1393",
+	L"Function PlotManager.BioAutoConditionals.F1359",
+	L"Function PlotManager.BioAutoConditionals.F1373",
+	L"Function PlotManager.BioAutoConditionals.F1236",
+	L"Function PlotManager.BioAutoConditionals.F1385",
+	L"Function PlotManager.BioAutoConditionals.F1379",
+	L"Function PlotManager.BioAutoConditionals.F1378",
+	L"Function PlotManager.BioAutoConditionals.F1384",
+	L"Function PlotManager.BioAutoConditionals.F1386",
+	L"Function PlotManager.BioAutoConditionals.F1377",
+	L"Function PlotManager.BioAutoConditionals.F1376",
+	L"Function PlotManager.BioAutoConditionals.F1235",
+	L"Function PlotManager.BioAutoConditionals.F1390",
+	L"Function PlotManager.BioAutoConditionals.F1485",
+	L"Function PlotManager.BioAutoConditionals.F1374",
+	L"Function PlotManager.BioAutoConditionals.F1366",
+	L"Function PlotManager.BioAutoConditionals.F1199",
+	L"Function PlotManager.BioAutoConditionals.F1383",
+	L"Function PlotManager.BioAutoConditionals.F1375",
+	L"Function PlotManager.BioAutoConditionals.F1234",
+	L"Function PlotManager.BioAutoConditionals.F1512",
+	L"Function PlotManager.BioAutoConditionals.F1392",
+	L"Function PlotManager.BioAutoConditionals.F269",
+	L"Function PlotManager.BioAutoConditionals.F268",
+	L"Function PlotManager.BioAutoConditionals.F267",
+	L"Function PlotManager.BioAutoConditionals.F326",
+	L"Function PlotManager.BioAutoConditionals.F325",
+	L"Function PlotManager.BioAutoConditionals.F289",
+	L"Function PlotManager.BioAutoConditionals.F288",
+	L"Function PlotManager.BioAutoConditionals.F286",
+	L"Function PlotManager.BioAutoConditionals.F285",
+	L"Function PlotManager.BioAutoConditionals.F284",
+	L"Function PlotManager.BioAutoConditionals.F281",
+	L"Function PlotManager.BioAutoConditionals.F272",
+	L"Function PlotManager.BioAutoConditionals.F271",
+	L"Function PlotManager.BioAutoConditionals.F270",
+	L"Function PlotManager.BioAutoConditionals.F266",
+	L"Function PlotManager.BioAutoConditionals.F265",
+	L"Function PlotManager.BioAutoConditionals.F264",
+	L"Function PlotManager.BioAutoConditionals.F261",
+	L"Function PlotManager.BioAutoConditionals.F260",
+	L"Function PlotManager.BioAutoConditionals.F259",
+	L"Function PlotManager.BioAutoConditionals.F483",
+	L"Function PlotManager.BioAutoConditionals.F482",
+	L"Function PlotManager.BioAutoConditionals.F481",
+	L"Function PlotManager.BioAutoConditionals.F480",
+	L"Function PlotManager.BioAutoConditionals.F479",
+	L"Function PlotManager.BioAutoConditionals.F478",
+	L"Function PlotManager.BioAutoConditionals.F562",
+	L"Function PlotManager.BioAutoConditionals.F473",
+	L"Function PlotManager.BioAutoConditionals.F472",
+	L"Function PlotManager.BioAutoConditionals.F470",
+	L"Function PlotManager.BioAutoConditionals.F2045",
+	L"Function PlotManager.BioAutoConditionals.F468",
+	L"Function PlotManager.BioAutoConditionals.F582",
+	L"Function PlotManager.BioAutoConditionals.F581",
+	L"Function PlotManager.BioAutoConditionals.F2040",
+	L"Function PlotManager.BioAutoConditionals.F580",
+	L"Function PlotManager.BioAutoConditionals.F579",
+	L"Function PlotManager.BioAutoConditionals.F578",
+	L"Function PlotManager.BioAutoConditionals.F577",
+	L"Function PlotManager.BioAutoConditionals.F516",
+	L"Function PlotManager.BioAutoConditionals.F451",
+	L"Function PlotManager.BioAutoConditionals.F458",
+	L"Function PlotManager.BioAutoConditionals.F1572",
+	L"Function PlotManager.BioAutoConditionals.F1513",
+	L"Function PlotManager.BioAutoConditionals.F1350",
+	L"Function PlotManager.BioAutoConditionals.F1352",
+	L"Function PlotManager.BioAutoConditionals.F484",
+	L"Function PlotManager.BioAutoConditionals.F513",
+	L"Function PlotManager.BioAutoConditionals.F414",
+	L"Function PlotManager.BioAutoConditionals.F409",
+	L"Function PlotManager.BioAutoConditionals.F1242",
+	L"Function PlotManager.BioAutoConditionals.F262",
+	L"Function PlotManager.BioAutoConditionals.F853",
+	L"Function PlotManager.BioAutoConditionals.F1306",
+	L"Function PlotManager.BioAutoConditionals.F520",
+	L"Function PlotManager.BioAutoConditionals.F519",
+	L"Function PlotManager.BioAutoConditionals.F518",
+	L"Function PlotManager.BioAutoConditionals.F517",
+	L"Function PlotManager.BioAutoConditionals.F515",
+	L"Function PlotManager.BioAutoConditionals.F514",
+	L"Function PlotManager.BioAutoConditionals.F292",
+	L"Function PlotManager.BioAutoConditionals.F290",
+	L"Function PlotManager.BioAutoConditionals.F278",
+	L"Function PlotManager.BioAutoConditionals.F277",
+	L"Function PlotManager.BioAutoConditionals.F273",
+	L"Function PlotManager.BioAutoConditionals.F263",
+	L"Function PlotManager.BioAutoConditionals.F257",
+	L"Function PlotManager.BioAutoConditionals.F642",
+	L"Function PlotManager.BioAutoConditionals.F649",
+	L"Function PlotManager.BioAutoConditionals.F648",
+	L"Function PlotManager.BioAutoConditionals.F1253",
+	L"Function PlotManager.BioAutoConditionals.F1252",
+	L"Function PlotManager.BioAutoConditionals.F1251",
+	L"Function PlotManager.BioAutoConditionals.F1250",
+	L"Function PlotManager.BioAutoConditionals.F1249",
+	L"Function PlotManager.BioAutoConditionals.F1126",
+	L"Function PlotManager.BioAutoConditionals.F909",
+	L"Function PlotManager.BioAutoConditionals.F592",
+	L"Function PlotManager.BioAutoConditionals.F591",
+	L"Function PlotManager.BioAutoConditionals.F590",
+	L"Function PlotManager.BioAutoConditionals.F589",
+	L"Function PlotManager.BioAutoConditionals.F588",
+	L"Function PlotManager.BioAutoConditionals.F586",
+	L"Function PlotManager.BioAutoConditionals.F585",
+	L"Function PlotManager.BioAutoConditionals.F446",
+	L"Function PlotManager.BioAutoConditionals.F734",
+	L"Function PlotManager.BioAutoConditionals.F856",
+	L"Function PlotManager.BioAutoConditionals.F620",
+	L"Function PlotManager.BioAutoConditionals.F477",
+	L"Function PlotManager.BioAutoConditionals.F443",
+	L"Function PlotManager.BioAutoConditionals.F442",
+	L"Function PlotManager.BioAutoConditionals.F441",
+	L"Function PlotManager.BioAutoConditionals.F440",
+	L"Function PlotManager.BioAutoConditionals.F439",
+	L"Function PlotManager.BioAutoConditionals.F438",
+	L"Function PlotManager.BioAutoConditionals.F391",
+	L"Function PlotManager.BioAutoConditionals.F355",
+	L"Function PlotManager.BioAutoConditionals.F1019",
+	L"Function PlotManager.BioAutoConditionals.F393",
+	L"Function PlotManager.BioAutoConditionals.F333",
+	L"Function PlotManager.BioAutoConditionals.F339",
+	L"Function PlotManager.BioAutoConditionals.F336",
+	L"Function PlotManager.BioAutoConditionals.F1557",
+	L"Function PlotManager.BioAutoConditionals.F1045",
+	L"Function PlotManager.BioAutoConditionals.F163",
+	L"Function PlotManager.BioAutoConditionals.F162",
+	L"Function PlotManager.BioAutoConditionals.F154",
+	L"Function PlotManager.BioAutoConditionals.F153",
+	L"Function PlotManager.BioAutoConditionals.F152",
+	L"Function PlotManager.BioAutoConditionals.F151",
+	L"Function PlotManager.BioAutoConditionals.F150",
+	L"Function PlotManager.BioAutoConditionals.F149",
+	L"Function PlotManager.BioAutoConditionals.F148",
+	L"Function PlotManager.BioAutoConditionals.F147",
+	L"Function PlotManager.BioAutoConditionals.F146",
+	L"Function PlotManager.BioAutoConditionals.F145",
+	L"Function PlotManager.BioAutoConditionals.F144",
+	L"Function PlotManager.BioAutoConditionals.F143",
+	L"Function PlotManager.BioAutoConditionals.F142",
+	L"Function PlotManager.BioAutoConditionals.F141",
+	L"Function PlotManager.BioAutoConditionals.F335",
+	L"Function PlotManager.BioAutoConditionals.F489",
+	L"Function PlotManager.BioAutoConditionals.F488",
+	L"Function PlotManager.BioAutoConditionals.F923",
+	L"Function PlotManager.BioAutoConditionals.F241",
+	L"Function PlotManager.BioAutoConditionals.F435",
+	L"Function PlotManager.BioAutoConditionals.F434",
+	L"Function PlotManager.BioAutoConditionals.F321",
+	L"Function PlotManager.BioAutoConditionals.F320",
+	L"Function PlotManager.BioAutoConditionals.F319",
+	L"Function PlotManager.BioAutoConditionals.F318",
+	L"Function PlotManager.BioAutoConditionals.F1257",
+	L"Function PlotManager.BioAutoConditionals.F1256",
+	L"Function PlotManager.BioAutoConditionals.F1000",
+	L"Function PlotManager.BioAutoConditionals.F851",
+	L"Function PlotManager.BioAutoConditionals.F323",
+	L"Function PlotManager.BioAutoConditionals.F293",
+	L"Function PlotManager.BioAutoConditionals.F287",
+	L"Function PlotManager.BioAutoConditionals.F902",
+	L"Function PlotManager.BioAutoConditionals.F901",
+	L"Function PlotManager.BioAutoConditionals.F1184",
+	L"Function PlotManager.BioAutoConditionals.F1183",
+	L"Function PlotManager.BioAutoConditionals.F1182",
+	L"Function PlotManager.BioAutoConditionals.F1181",
+	L"Function PlotManager.BioAutoConditionals.F1180",
+	L"Function PlotManager.BioAutoConditionals.F1177",
+	L"Function PlotManager.BioAutoConditionals.F1176",
+	L"Function PlotManager.BioAutoConditionals.F1175",
+	L"Function PlotManager.BioAutoConditionals.F1174",
+	L"Function PlotManager.BioAutoConditionals.F1173",
+	L"Function PlotManager.BioAutoConditionals.F1172",
+	L"Function PlotManager.BioAutoConditionals.F1171",
+	L"Function PlotManager.BioAutoConditionals.F1170",
+	L"Function PlotManager.BioAutoConditionals.F1169",
+	L"Function PlotManager.BioAutoConditionals.F1168",
+	L"Function PlotManager.BioAutoConditionals.F1167",
+	L"Function PlotManager.BioAutoConditionals.F1166",
+	L"Function PlotManager.BioAutoConditionals.F832",
+	L"Function PlotManager.BioAutoConditionals.F831",
+	L"Function PlotManager.BioAutoConditionals.F830",
+	L"Function PlotManager.BioAutoConditionals.F829",
+	L"Function PlotManager.BioAutoConditionals.F828",
+	L"Function PlotManager.BioAutoConditionals.F827",
+	L"Function PlotManager.BioAutoConditionals.F826",
+	L"Function PlotManager.BioAutoConditionals.F825",
+	L"Function PlotManager.BioAutoConditionals.F824",
+	L"Function PlotManager.BioAutoConditionals.F823",
+	L"Function PlotManager.BioAutoConditionals.F822",
+	L"Function PlotManager.BioAutoConditionals.F844",
+	L"Function PlotManager.BioAutoConditionals.F843",
+	L"Function PlotManager.BioAutoConditionals.F842",
+	L"Function PlotManager.BioAutoConditionals.F841",
+	L"Function PlotManager.BioAutoConditionals.F840",
+	L"Function PlotManager.BioAutoConditionals.F839",
+	L"Function PlotManager.BioAutoConditionals.F838",
+	L"Function PlotManager.BioAutoConditionals.F837",
+	L"Function PlotManager.BioAutoConditionals.F836",
+	L"Function PlotManager.BioAutoConditionals.F835",
+	L"Function PlotManager.BioAutoConditionals.F834",
+	L"Function PlotManager.BioAutoConditionals.F1158",
+	L"Function PlotManager.BioAutoConditionals.F300",
+	L"Function PlotManager.BioAutoConditionals.F436",
+	L"Function PlotManager.BioAutoConditionals.F345",
+	L"Function PlotManager.BioAutoConditionals.F344",
+	L"Function PlotManager.BioAutoConditionals.F298",
+	L"Function PlotManager.BioAutoConditionals.F297",
+	L"Function PlotManager.BioAutoConditionals.F433",
+	L"Function PlotManager.BioAutoConditionals.F428",
+	L"Function PlotManager.BioAutoConditionals.F427",
+	L"Function PlotManager.BioAutoConditionals.F885",
+	L"Function PlotManager.BioAutoConditionals.F884",
+	L"Function PlotManager.BioAutoConditionals.F883",
+	L"Function PlotManager.BioAutoConditionals.F854",
+	L"Function PlotManager.BioAutoConditionals.F855",
+	L"Function PlotManager.BioAutoConditionals.F419",
+	L"Function PlotManager.BioAutoConditionals.F1511",
+	L"Function PlotManager.BioAutoConditionals.F474",
+	L"Function PlotManager.BioAutoConditionals.F476",
+	L"Function PlotManager.BioAutoConditionals.F455",
+	L"Function PlotManager.BioAutoConditionals.F454",
+	L"Function PlotManager.BioAutoConditionals.F453",
+	L"Function PlotManager.BioAutoConditionals.F47",
+	L"Function PlotManager.BioAutoConditionals.F46",
+	L"Function PlotManager.BioAutoConditionals.F57",
+	L"Function PlotManager.BioAutoConditionals.F68",
+	L"Function PlotManager.BioAutoConditionals.F67",
+	L"Function PlotManager.BioAutoConditionals.F45",
+	L"Function PlotManager.BioAutoConditionals.F43",
+	L"Function PlotManager.BioAutoConditionals.F42",
+	L"Function PlotManager.BioAutoConditionals.F41",
+	L"Function PlotManager.BioAutoConditionals.F40",
+	L"Function PlotManager.BioAutoConditionals.F39",
+	L"Function PlotManager.BioAutoConditionals.F38",
+	L"Function PlotManager.BioAutoConditionals.F37",
+	L"Function PlotManager.BioAutoConditionals.F36",
+	L"Function PlotManager.BioAutoConditionals.F35",
+	L"Function PlotManager.BioAutoConditionals.F34",
+	L"Function PlotManager.BioAutoConditionals.F33",
+	L"Function PlotManager.BioAutoConditionals.F32",
+	L"Function PlotManager.BioAutoConditionals.F31",
+	L"Function PlotManager.BioAutoConditionals.F30",
+	L"Function PlotManager.BioAutoConditionals.F29",
+	L"Function PlotManager.BioAutoConditionals.F28",
+	L"Function PlotManager.BioAutoConditionals.F27",
+	L"Function PlotManager.BioAutoConditionals.F508",
+	L"Function PlotManager.BioAutoConditionals.F510",
+	L"Function PlotManager.BioAutoConditionals.F583",
+	L"Function PlotManager.BioAutoConditionals.F524",
+	L"Function PlotManager.BioAutoConditionals.F509",
+	L"Function PlotManager.BioAutoConditionals.F1628",
+	L"Function PlotManager.BioAutoConditionals.F523",
+	L"Function PlotManager.BioAutoConditionals.F522",
+	L"Function PlotManager.BioAutoConditionals.F329",
+	L"Function PlotManager.BioAutoConditionals.F328",
+	L"Function PlotManager.BioAutoConditionals.F327",
+	L"Function PlotManager.BioAutoConditionals.F331",
+	L"Function PlotManager.BioAutoConditionals.F461",
+	L"Function PlotManager.BioAutoConditionals.F460",
+	L"Function PlotManager.BioAutoConditionals.F256",
+	L"Function PlotManager.BioAutoConditionals.F954",
+	L"Function PlotManager.BioAutoConditionals.F643",
+	L"Function PlotManager.BioAutoConditionals.F429",
+	L"Function PlotManager.BioAutoConditionals.F1444",
+	L"Function PlotManager.BioAutoConditionals.F1443",
+	L"Function PlotManager.BioAutoConditionals.F1442",
+	L"Function PlotManager.BioAutoConditionals.F1441",
+	L"Function PlotManager.BioAutoConditionals.F1440",
+	L"Function PlotManager.BioAutoConditionals.F1439",
+	L"Function PlotManager.BioAutoConditionals.F1438",
+	L"Function PlotManager.BioAutoConditionals.F1437",
+	L"Function PlotManager.BioAutoConditionals.F1436",
+	L"Function PlotManager.BioAutoConditionals.F1435",
+	L"Function PlotManager.BioAutoConditionals.F1434",
+	L"Function PlotManager.BioAutoConditionals.F1433",
+	L"Function PlotManager.BioAutoConditionals.F1432",
+	L"Function PlotManager.BioAutoConditionals.F1431",
+	L"Function PlotManager.BioAutoConditionals.F1508",
+	L"Function PlotManager.BioAutoConditionals.F1078",
+	L"Function PlotManager.BioAutoConditionals.F953",
+	L"Function PlotManager.BioAutoConditionals.F952",
+	L"Function PlotManager.BioAutoConditionals.F950",
+	L"Function PlotManager.BioAutoConditionals.F949",
+	L"Function PlotManager.BioAutoConditionals.F941",
+	L"Function PlotManager.BioAutoConditionals.F930",
+	L"Function PlotManager.BioAutoConditionals.F873",
+	L"Function PlotManager.BioAutoConditionals.F1555",
+	L"Function PlotManager.BioAutoConditionals.F1186",
+	L"Function PlotManager.BioAutoConditionals.F951",
+	L"Function PlotManager.BioAutoConditionals.F876",
+	L"Function PlotManager.BioAutoConditionals.F845",
+	L"Function PlotManager.BioAutoConditionals.F833",
+	L"Function PlotManager.BioAutoConditionals.F1523",
+	L"Function PlotManager.BioAutoConditionals.F1519",
+	L"Function PlotManager.BioAutoConditionals.F848",
+	L"Function PlotManager.BioAutoConditionals.F847",
+	L"Function PlotManager.BioAutoConditionals.F846",
+	L"Function PlotManager.BioAutoConditionals.F820",
+	L"Function PlotManager.BioAutoConditionals.F815",
+	L"Function PlotManager.BioAutoConditionals.F814",
+	L"Function PlotManager.BioAutoConditionals.F813",
+	L"Function PlotManager.BioAutoConditionals.F787",
+	L"Function PlotManager.BioAutoConditionals.F786",
+	L"Function PlotManager.BioAutoConditionals.F785",
+	L"Function PlotManager.BioAutoConditionals.F784",
+	L"Function PlotManager.BioAutoConditionals.F783",
+	L"Function PlotManager.BioAutoConditionals.F781",
+	L"Function PlotManager.BioAutoConditionals.F780",
+	L"Function PlotManager.BioAutoConditionals.F1624",
+	L"Function PlotManager.BioAutoConditionals.F1577",
+	L"Function PlotManager.BioAutoConditionals.F1538",
+	L"Function PlotManager.BioAutoConditionals.F897",
+	L"Function PlotManager.BioAutoConditionals.F779",
+	L"Function PlotManager.BioAutoConditionals.F896",
+	L"Function PlotManager.BioAutoConditionals.F895",
+	L"Function PlotManager.BioAutoConditionals.F880",
+	L"Function PlotManager.BioAutoConditionals.F879",
+	L"Function PlotManager.BioAutoConditionals.F878",
+	L"Function PlotManager.BioAutoConditionals.F877",
+	L"Function PlotManager.BioAutoConditionals.F1268",
+	L"Function PlotManager.BioAutoConditionals.F1267",
+	L"Function PlotManager.BioAutoConditionals.F1266",
+	L"Function PlotManager.BioAutoConditionals.F1265",
+	L"Function PlotManager.BioAutoConditionals.F1579",
+	L"Function PlotManager.BioAutoConditionals.F1551",
+	L"Function PlotManager.BioAutoConditionals.F1550",
+	L"Function PlotManager.BioAutoConditionals.F1549",
+	L"Function PlotManager.BioAutoConditionals.F1548",
+	L"Function PlotManager.BioAutoConditionals.F1547",
+	L"Function PlotManager.BioAutoConditionals.F1546",
+	L"Function PlotManager.BioAutoConditionals.F650",
+	L"Function PlotManager.BioAutoConditionals.F632",
+	L"Function PlotManager.BioAutoConditionals.F630",
+	L"Function PlotManager.BioAutoConditionals.F629",
+	L"Function PlotManager.BioAutoConditionals.F1430",
+	L"Function PlotManager.BioAutoConditionals.F1429",
+	L"Function PlotManager.BioAutoConditionals.F1428",
+	L"Function PlotManager.BioAutoConditionals.F1427",
+	L"Function PlotManager.BioAutoConditionals.F1426",
+	L"Function PlotManager.BioAutoConditionals.F1425",
+	L"Function PlotManager.BioAutoConditionals.F1424",
+	L"Function PlotManager.BioAutoConditionals.F1423",
+	L"Function PlotManager.BioAutoConditionals.F1422",
+	L"Function PlotManager.BioAutoConditionals.F1421",
+	L"Function PlotManager.BioAutoConditionals.F1420",
+	L"Function PlotManager.BioAutoConditionals.F1419",
+	L"Function PlotManager.BioAutoConditionals.F955",
+	L"Function PlotManager.BioAutoConditionals.F1232",
+	L"Function PlotManager.BioAutoConditionals.F1001",
+	L"Function PlotManager.BioAutoConditionals.F905",
+	L"Function PlotManager.BioAutoConditionals.F731",
+	L"Function PlotManager.BioAutoConditionals.F640",
+	L"Function PlotManager.BioAutoConditionals.F639",
+	L"Function PlotManager.BioAutoConditionals.F638",
+	L"Function PlotManager.BioAutoConditionals.F637",
+	L"Function PlotManager.BioAutoConditionals.F636",
+	L"Function PlotManager.BioAutoConditionals.F635",
+	L"Function PlotManager.BioAutoConditionals.F634",
+	L"Function PlotManager.BioAutoConditionals.F633",
+	L"Function PlotManager.BioAutoConditionals.F625",
+	L"Function PlotManager.BioAutoConditionals.F624",
+	L"Function PlotManager.BioAutoConditionals.F1239",
+	L"Function PlotManager.BioAutoConditionals.F1238",
+	L"Function PlotManager.BioAutoConditionals.F925",
+	L"Function PlotManager.BioAutoConditionals.F1358",
+	L"Function PlotManager.BioAutoConditionals.F1244",
+	L"Function PlotManager.BioAutoConditionals.F733",
+	L"Function PlotManager.BioAutoConditionals.F652",
+	L"Function PlotManager.BioAutoConditionals.F651",
+	L"Function PlotManager.BioAutoConditionals.F631",
+	L"Function PlotManager.BioAutoConditionals.F1357",
+	L"Function PlotManager.BioAutoConditionals.F730",
+	L"Function PlotManager.BioAutoConditionals.F628",
+	L"Function PlotManager.BioAutoConditionals.F627",
+	L"Function PlotManager.BioAutoConditionals.F1356",
+	L"Function PlotManager.BioAutoConditionals.F1201",
+	L"Function PlotManager.BioAutoConditionals.F626",
+	L"Function PlotManager.BioAutoConditionals.F1210",
+	L"Function PlotManager.BioAutoConditionals.F618",
+	L"Function PlotManager.BioAutoConditionals.F1553",
+	L"Function PlotManager.BioAutoConditionals.F1058",
+	L"Function PlotManager.BioAutoConditionals.F1057",
+	L"Function PlotManager.BioAutoConditionals.F1056",
+	L"Function PlotManager.BioAutoConditionals.F1055",
+	L"Function PlotManager.BioAutoConditionals.F1054",
+	L"Function PlotManager.BioAutoConditionals.F1053",
+	L"Function PlotManager.BioAutoConditionals.F1052",
+	L"Function PlotManager.BioAutoConditionals.F1051",
+	L"Function PlotManager.BioAutoConditionals.F1050",
+	L"Function PlotManager.BioAutoConditionals.F1049",
+	L"Function PlotManager.BioAutoConditionals.F1048",
+	L"Function PlotManager.BioAutoConditionals.F1047",
+	L"Function PlotManager.BioAutoConditionals.F1046",
+	L"Function PlotManager.BioAutoConditionals.F1039",
+	L"Function PlotManager.BioAutoConditionals.F1037",
+	L"Function PlotManager.BioAutoConditionals.F1036",
+	L"Function PlotManager.BioAutoConditionals.F1034",
+	L"Function PlotManager.BioAutoConditionals.F1033",
+	L"Function PlotManager.BioAutoConditionals.F939",
+	L"Function PlotManager.BioAutoConditionals.F921",
+	L"Function PlotManager.BioAutoConditionals.F940",
+	L"Function PlotManager.BioAutoConditionals.F922",
+	L"Function PlotManager.BioAutoConditionals.F911",
+	L"Function PlotManager.BioAutoConditionals.F910",
+	L"Function PlotManager.BioAutoConditionals.F1007",
+	L"Function PlotManager.BioAutoConditionals.F915",
+	L"Function PlotManager.BioAutoConditionals.F908",
+	L"Function PlotManager.BioAutoConditionals.F907",
+	L"Function PlotManager.BioAutoConditionals.F906",
+	L"Function PlotManager.BioAutoConditionals.F904",
+	L"Function PlotManager.BioAutoConditionals.F984",
+	L"Function PlotManager.BioAutoConditionals.F937",
+	L"Function PlotManager.BioAutoConditionals.F903",
+	L"Function PlotManager.BioAutoConditionals.F1576",
+	L"Function PlotManager.BioAutoConditionals.F1545",
+	L"Function PlotManager.BioAutoConditionals.F1544",
+	L"Function PlotManager.BioAutoConditionals.F1543",
+	L"Function PlotManager.BioAutoConditionals.F934",
+	L"Function PlotManager.BioAutoConditionals.F791",
+	L"Function PlotManager.BioAutoConditionals.F790",
+	L"Function PlotManager.BioAutoConditionals.F789",
+	L"Function PlotManager.BioAutoConditionals.F1006",
+	L"Function PlotManager.BioAutoConditionals.F1011",
+	L"Function PlotManager.BioAutoConditionals.F1010",
+	L"Function PlotManager.BioAutoConditionals.F1009",
+	L"Function PlotManager.BioAutoConditionals.F1008",
+	L"Function PlotManager.BioAutoConditionals.F933",
+	L"Function PlotManager.BioAutoConditionals.F928",
+	L"Function PlotManager.BioAutoConditionals.F1077",
+	L"Function PlotManager.BioAutoConditionals.F1076",
+	L"Function PlotManager.BioAutoConditionals.F936",
+	L"Function PlotManager.BioAutoConditionals.F935",
+	L"Function PlotManager.BioAutoConditionals.F849",
+	L"Function PlotManager.BioAutoConditionals.F371",
+	L"Function PlotManager.BioAutoConditionals.F346",
+	L"Function PlotManager.BioAutoConditionals.F1542",
+	L"Function PlotManager.BioAutoConditionals.F1541",
+	L"Function PlotManager.BioAutoConditionals.F1540",
+	L"Function PlotManager.BioAutoConditionals.F1539",
+	L"Function PlotManager.BioAutoConditionals.F916",
+	L"Function PlotManager.BioAutoConditionals.F882",
+	L"Function PlotManager.BioAutoConditionals.F729",
+	L"Function PlotManager.BioAutoConditionals.F728",
+	L"Function PlotManager.BioAutoConditionals.F727",
+	L"Function PlotManager.BioAutoConditionals.F726",
+	L"Function PlotManager.BioAutoConditionals.F725",
+	L"Function PlotManager.BioAutoConditionals.F724",
+	L"Function PlotManager.BioAutoConditionals.F722",
+	L"Function PlotManager.BioAutoConditionals.F647",
+	L"Function PlotManager.BioAutoConditionals.F1185",
+	L"Function PlotManager.BioAutoConditionals.F665",
+	L"Function PlotManager.BioAutoConditionals.F376",
+	L"Function PlotManager.BioAutoConditionals.F1491",
+	L"Function PlotManager.BioAutoConditionals.F1490",
+	L"Function PlotManager.BioAutoConditionals.F918",
+	L"Function PlotManager.BioAutoConditionals.F914",
+	L"Function PlotManager.BioAutoConditionals.F992",
+	L"Function PlotManager.BioAutoConditionals.F991",
+	L"Function PlotManager.BioAutoConditionals.F490",
+	L"Function PlotManager.BioAutoConditionals.F457",
+	L"Function PlotManager.BioAutoConditionals.F456",
+	L"Function PlotManager.BioAutoConditionals.F1141",
+	L"Function PlotManager.BioAutoConditionals.F993",
+	L"Function PlotManager.BioAutoConditionals.F1160",
+	L"Function PlotManager.BioAutoConditionals.F1159",
+	L"Function PlotManager.BioAutoConditionals.F1157",
+	L"Function PlotManager.BioAutoConditionals.F958",
+	L"Function PlotManager.BioAutoConditionals.F1515",
+	L"Function PlotManager.BioAutoConditionals.F1243",
+	L"Function PlotManager.BioAutoConditionals.F1155",
+	L"Function PlotManager.BioAutoConditionals.F1003",
+	L"Function PlotManager.BioAutoConditionals.F868",
+	L"Function PlotManager.BioAutoConditionals.F801",
+	L"Function PlotManager.BioAutoConditionals.F800",
+	L"Function PlotManager.BioAutoConditionals.F799",
+	L"Function PlotManager.BioAutoConditionals.F798",
+	L"Function PlotManager.BioAutoConditionals.F797",
+	L"Function PlotManager.BioAutoConditionals.F796",
+	L"Function PlotManager.BioAutoConditionals.F795",
+	L"Function PlotManager.BioAutoConditionals.F794",
+	L"Function PlotManager.BioAutoConditionals.F793",
+	L"Function PlotManager.BioAutoConditionals.F792",
+	L"Function PlotManager.BioAutoConditionals.F1154",
+	L"Function PlotManager.BioAutoConditionals.F867",
+	L"Function PlotManager.BioAutoConditionals.F719",
+	L"Function PlotManager.BioAutoConditionals.F718",
+	L"Function PlotManager.BioAutoConditionals.F717",
+	L"Function PlotManager.BioAutoConditionals.F716",
+	L"Function PlotManager.BioAutoConditionals.F715",
+	L"Function PlotManager.BioAutoConditionals.F714",
+	L"Function PlotManager.BioAutoConditionals.F713",
+	L"Function PlotManager.BioAutoConditionals.F712",
+	L"Function PlotManager.BioAutoConditionals.F711",
+	L"Function PlotManager.BioAutoConditionals.F1153",
+	L"Function PlotManager.BioAutoConditionals.F865",
+	L"Function PlotManager.BioAutoConditionals.F778",
+	L"Function PlotManager.BioAutoConditionals.F777",
+	L"Function PlotManager.BioAutoConditionals.F776",
+	L"Function PlotManager.BioAutoConditionals.F775",
+	L"Function PlotManager.BioAutoConditionals.F774",
+	L"Function PlotManager.BioAutoConditionals.F773",
+	L"Function PlotManager.BioAutoConditionals.F772",
+	L"Function PlotManager.BioAutoConditionals.F771",
+	L"Function PlotManager.BioAutoConditionals.F770",
+	L"Function PlotManager.BioAutoConditionals.F723",
+	L"Function PlotManager.BioAutoConditionals.F1638",
+	L"Function PlotManager.BioAutoConditionals.F1599",
+	L"Function PlotManager.BioAutoConditionals.F1593",
+	L"Function PlotManager.BioAutoConditionals.F1582",
+	L"Function PlotManager.BioAutoConditionals.F1411",
+	L"Function PlotManager.BioAutoConditionals.F1152",
+	L"Function PlotManager.BioAutoConditionals.F1018",
+	L"Function PlotManager.BioAutoConditionals.F888",
+	L"Function PlotManager.BioAutoConditionals.F862",
+	L"Function PlotManager.BioAutoConditionals.F850",
+	L"Function PlotManager.BioAutoConditionals.F812",
+	L"Function PlotManager.BioAutoConditionals.F805",
+	L"Function PlotManager.BioAutoConditionals.F698",
+	L"Function PlotManager.BioAutoConditionals.F697",
+	L"Function PlotManager.BioAutoConditionals.F696",
+	L"Function PlotManager.BioAutoConditionals.F695",
+	L"Function PlotManager.BioAutoConditionals.F694",
+	L"Function PlotManager.BioAutoConditionals.F693",
+	L"Function PlotManager.BioAutoConditionals.F692",
+	L"Function PlotManager.BioAutoConditionals.F691",
+	L"Function PlotManager.BioAutoConditionals.F690",
+	L"Function PlotManager.BioAutoConditionals.F689",
+	L"Function PlotManager.BioAutoConditionals.F688",
+	L"Function PlotManager.BioAutoConditionals.F687",
+	L"Function PlotManager.BioAutoConditionals.F1598",
+	L"Function PlotManager.BioAutoConditionals.F1592",
+	L"Function PlotManager.BioAutoConditionals.F1587",
+	L"Function PlotManager.BioAutoConditionals.F1521",
+	L"Function PlotManager.BioAutoConditionals.F1408",
+	L"Function PlotManager.BioAutoConditionals.F1149",
+	L"Function PlotManager.BioAutoConditionals.F887",
+	L"Function PlotManager.BioAutoConditionals.F861",
+	L"Function PlotManager.BioAutoConditionals.F811",
+	L"Function PlotManager.BioAutoConditionals.F807",
+	L"Function PlotManager.BioAutoConditionals.F720",
+	L"Function PlotManager.BioAutoConditionals.F710",
+	L"Function PlotManager.BioAutoConditionals.F709",
+	L"Function PlotManager.BioAutoConditionals.F708",
+	L"Function PlotManager.BioAutoConditionals.F707",
+	L"Function PlotManager.BioAutoConditionals.F706",
+	L"Function PlotManager.BioAutoConditionals.F705",
+	L"Function PlotManager.BioAutoConditionals.F704",
+	L"Function PlotManager.BioAutoConditionals.F703",
+	L"Function PlotManager.BioAutoConditionals.F702",
+	L"Function PlotManager.BioAutoConditionals.F701",
+	L"Function PlotManager.BioAutoConditionals.F700",
+	L"Function PlotManager.BioAutoConditionals.F699",
+	L"Function PlotManager.BioAutoConditionals.F1597",
+	L"Function PlotManager.BioAutoConditionals.F1591",
+	L"Function PlotManager.BioAutoConditionals.F1586",
+	L"Function PlotManager.BioAutoConditionals.F1520",
+	L"Function PlotManager.BioAutoConditionals.F1410",
+	L"Function PlotManager.BioAutoConditionals.F1148",
+	L"Function PlotManager.BioAutoConditionals.F900",
+	L"Function PlotManager.BioAutoConditionals.F899",
+	L"Function PlotManager.BioAutoConditionals.F894",
+	L"Function PlotManager.BioAutoConditionals.F893",
+	L"Function PlotManager.BioAutoConditionals.F886",
+	L"Function PlotManager.BioAutoConditionals.F860",
+	L"Function PlotManager.BioAutoConditionals.F769",
+	L"Function PlotManager.BioAutoConditionals.F768",
+	L"Function PlotManager.BioAutoConditionals.F767",
+	L"Function PlotManager.BioAutoConditionals.F766",
+	L"Function PlotManager.BioAutoConditionals.F765",
+	L"Function PlotManager.BioAutoConditionals.F764",
+	L"Function PlotManager.BioAutoConditionals.F763",
+	L"Function PlotManager.BioAutoConditionals.F762",
+	L"Function PlotManager.BioAutoConditionals.F761",
+	L"Function PlotManager.BioAutoConditionals.F760",
+	L"Function PlotManager.BioAutoConditionals.F732",
+	L"Function PlotManager.BioAutoConditionals.F1146",
+	L"Function PlotManager.BioAutoConditionals.F919",
+	L"Function PlotManager.BioAutoConditionals.F863",
+	L"Function PlotManager.BioAutoConditionals.F759",
+	L"Function PlotManager.BioAutoConditionals.F758",
+	L"Function PlotManager.BioAutoConditionals.F755",
+	L"Function PlotManager.BioAutoConditionals.F754",
+	L"Function PlotManager.BioAutoConditionals.F753",
+	L"Function PlotManager.BioAutoConditionals.F752",
+	L"Function PlotManager.BioAutoConditionals.F751",
+	L"Function PlotManager.BioAutoConditionals.F750",
+	L"Function PlotManager.BioAutoConditionals.F1095",
+	L"Function PlotManager.BioAutoConditionals.F1596",
+	L"Function PlotManager.BioAutoConditionals.F1590",
+	L"Function PlotManager.BioAutoConditionals.F1585",
+	L"Function PlotManager.BioAutoConditionals.F1412",
+	L"Function PlotManager.BioAutoConditionals.F1145",
+	L"Function PlotManager.BioAutoConditionals.F859",
+	L"Function PlotManager.BioAutoConditionals.F810",
+	L"Function PlotManager.BioAutoConditionals.F804",
+	L"Function PlotManager.BioAutoConditionals.F686",
+	L"Function PlotManager.BioAutoConditionals.F672",
+	L"Function PlotManager.BioAutoConditionals.F671",
+	L"Function PlotManager.BioAutoConditionals.F670",
+	L"Function PlotManager.BioAutoConditionals.F668",
+	L"Function PlotManager.BioAutoConditionals.F568",
+	L"Function PlotManager.BioAutoConditionals.F567",
+	L"Function PlotManager.BioAutoConditionals.F566",
+	L"Function PlotManager.BioAutoConditionals.F565",
+	L"Function PlotManager.BioAutoConditionals.F564",
+	L"Function PlotManager.BioAutoConditionals.F563",
+	L"Function PlotManager.BioAutoConditionals.F561",
+	L"Function PlotManager.BioAutoConditionals.F1642",
+	L"Function PlotManager.BioAutoConditionals.F1641",
+	L"Function PlotManager.BioAutoConditionals.F1584",
+	L"Function PlotManager.BioAutoConditionals.F1589",
+	L"Function PlotManager.BioAutoConditionals.F1595",
+	L"Function PlotManager.BioAutoConditionals.F1144",
+	L"Function PlotManager.BioAutoConditionals.F1272",
+	L"Function PlotManager.BioAutoConditionals.F1271",
+	L"Function PlotManager.BioAutoConditionals.F1270",
+	L"Function PlotManager.BioAutoConditionals.F1269",
+	L"Function PlotManager.BioAutoConditionals.F1409",
+	L"Function PlotManager.BioAutoConditionals.F1028",
+	L"Function PlotManager.BioAutoConditionals.F962",
+	L"Function PlotManager.BioAutoConditionals.F959",
+	L"Function PlotManager.BioAutoConditionals.F957",
+	L"Function PlotManager.BioAutoConditionals.F898",
+	L"Function PlotManager.BioAutoConditionals.F809",
+	L"Function PlotManager.BioAutoConditionals.F806",
+	L"Function PlotManager.BioAutoConditionals.F749",
+	L"Function PlotManager.BioAutoConditionals.F748",
+	L"Function PlotManager.BioAutoConditionals.F747",
+	L"Function PlotManager.BioAutoConditionals.F746",
+	L"Function PlotManager.BioAutoConditionals.F745",
+	L"Function PlotManager.BioAutoConditionals.F744",
+	L"Function PlotManager.BioAutoConditionals.F743",
+	L"Function PlotManager.BioAutoConditionals.F742",
+	L"Function PlotManager.BioAutoConditionals.F741",
+	L"Function PlotManager.BioAutoConditionals.F740",
+	L"Function PlotManager.BioAutoConditionals.F1594",
+	L"Function PlotManager.BioAutoConditionals.F1588",
+	L"Function PlotManager.BioAutoConditionals.F1583",
+	L"Function PlotManager.BioAutoConditionals.F1413",
+	L"Function PlotManager.BioAutoConditionals.F1143",
+	L"Function PlotManager.BioAutoConditionals.F1142",
+	L"Function PlotManager.BioAutoConditionals.F857",
+	L"Function PlotManager.BioAutoConditionals.F808",
+	L"Function PlotManager.BioAutoConditionals.F803",
+	L"Function PlotManager.BioAutoConditionals.F802",
+	L"Function PlotManager.BioAutoConditionals.F685",
+	L"Function PlotManager.BioAutoConditionals.F684",
+	L"Function PlotManager.BioAutoConditionals.F683",
+	L"Function PlotManager.BioAutoConditionals.F682",
+	L"Function PlotManager.BioAutoConditionals.F680",
+	L"Function PlotManager.BioAutoConditionals.F679",
+	L"Function PlotManager.BioAutoConditionals.F678",
+	L"Function PlotManager.BioAutoConditionals.F677",
+	L"Function PlotManager.BioAutoConditionals.F676",
+	L"Function PlotManager.BioAutoConditionals.F675",
+	L"Function PlotManager.BioAutoConditionals.F674",
+	L"Function PlotManager.BioAutoConditionals.F673",
+	L"Function PlotManager.BioAutoConditionals.F1619",
+	L"Function PlotManager.BioAutoConditionals.F1618",
+	L"Function PlotManager.BioAutoConditionals.F1506",
+	L"Function PlotManager.BioAutoConditionals.F1495",
+	L"Function PlotManager.BioAutoConditionals.F1163",
+	L"Function PlotManager.BioAutoConditionals.F1162",
+	L"Function PlotManager.BioAutoConditionals.F1025",
+	L"Function PlotManager.BioAutoConditionals.F574",
+	L"Function PlotManager.BioAutoConditionals.F573",
+	L"Function PlotManager.BioAutoConditionals.F417",
+	L"Function PlotManager.BioAutoConditionals.F413",
+	L"Function PlotManager.BioAutoConditionals.F572",
+	L"Function PlotManager.BioAutoConditionals.F571",
+	L"Function PlotManager.BioAutoConditionals.F416",
+	L"Function PlotManager.BioAutoConditionals.F412",
+	L"Function PlotManager.BioAutoConditionals.F570",
+	L"Function PlotManager.BioAutoConditionals.F569",
+	L"Function PlotManager.BioAutoConditionals.F415",
+	L"Function PlotManager.BioAutoConditionals.F411",
+	L"Function PlotManager.BioAutoConditionals.F396",
+	L"Function PlotManager.BioAutoConditionals.F395",
+	L"Function PlotManager.BioAutoConditionals.F394",
+	L"Function PlotManager.BioAutoConditionals.F392",
+	L"Function PlotManager.BioAutoConditionals.F2050",
+	L"Function PlotManager.BioAutoConditionals.F2049",
+	L"Function PlotManager.BioAutoConditionals.F2048",
+	L"Function PlotManager.BioAutoConditionals.F2047",
+	L"Function PlotManager.BioAutoConditionals.F2046",
+	L"Function PlotManager.BioAutoConditionals.F250",
+	L"Function PlotManager.BioAutoConditionals.F249",
+	L"Function PlotManager.BioAutoConditionals.F1418",
+	L"Function PlotManager.BioAutoConditionals.F1299",
+	L"Function PlotManager.BioAutoConditionals.F1298",
+	L"Function PlotManager.BioAutoConditionals.F1297",
+	L"Function PlotManager.BioAutoConditionals.F1296",
+	L"Function PlotManager.BioAutoConditionals.F1295",
+	L"Function PlotManager.BioAutoConditionals.F1294",
+	L"Function PlotManager.BioAutoConditionals.F1293",
+	L"Function PlotManager.BioAutoConditionals.F1292",
+	L"Function PlotManager.BioAutoConditionals.F1291",
+	L"Function PlotManager.BioAutoConditionals.F1290",
+	L"Function PlotManager.BioAutoConditionals.F1287",
+	L"Function PlotManager.BioAutoConditionals.F1286",
+	L"Function PlotManager.BioAutoConditionals.F1285",
+	L"Function PlotManager.BioAutoConditionals.F1284",
+	L"Function PlotManager.BioAutoConditionals.F1283",
+	L"Function PlotManager.BioAutoConditionals.F1282",
+	L"Function PlotManager.BioAutoConditionals.F1281",
+	L"Function PlotManager.BioAutoConditionals.F1280",
+	L"Function PlotManager.BioAutoConditionals.F1279",
+	L"Function PlotManager.BioAutoConditionals.F1278",
+	L"Function PlotManager.BioAutoConditionals.F1237",
+	L"Function PlotManager.BioAutoConditionals.F1119",
+	L"Function PlotManager.BioAutoConditionals.F1118",
+	L"Function PlotManager.BioAutoConditionals.F1571",
+	L"Function PlotManager.BioAutoConditionals.F1570",
+	L"Function PlotManager.BioAutoConditionals.F1569",
+	L"Function PlotManager.BioAutoConditionals.F1117",
+	L"Function PlotManager.BioAutoConditionals.F1116",
+	L"Function PlotManager.BioAutoConditionals.F1115",
+	L"Function PlotManager.BioAutoConditionals.F1114",
+	L"Function PlotManager.BioAutoConditionals.F1111",
+	L"Function PlotManager.BioAutoConditionals.F1110",
+	L"Function PlotManager.BioAutoConditionals.F1109",
+	L"Function PlotManager.BioAutoConditionals.F1108",
+	L"Function PlotManager.BioAutoConditionals.F1107",
+	L"Function PlotManager.BioAutoConditionals.F1106",
+	L"Function PlotManager.BioAutoConditionals.F1105",
+	L"Function PlotManager.BioAutoConditionals.F1104",
+	L"Function PlotManager.BioAutoConditionals.F1103",
+	L"Function PlotManager.BioAutoConditionals.F1102",
+	L"Function PlotManager.BioAutoConditionals.F1044",
+	L"Function PlotManager.BioAutoConditionals.F1060",
+	L"Function PlotManager.BioAutoConditionals.F739",
+	L"Function PlotManager.BioAutoConditionals.F738",
+	L"Function PlotManager.BioAutoConditionals.F737",
+	L"Function PlotManager.BioAutoConditionals.F736",
+	L"Function PlotManager.BioAutoConditionals.F388",
+	L"Function PlotManager.BioAutoConditionals.F387",
+	L"Function PlotManager.BioAutoConditionals.F386",
+	L"Function PlotManager.BioAutoConditionals.F385",
+	L"Function PlotManager.BioAutoConditionals.F384",
+	L"Function PlotManager.BioAutoConditionals.F383",
+	L"Function PlotManager.BioAutoConditionals.F382",
+	L"Function PlotManager.BioAutoConditionals.F381",
+	L"Function PlotManager.BioAutoConditionals.F380",
+	L"Function PlotManager.BioAutoConditionals.F379",
+	L"Function PlotManager.BioAutoConditionals.F378",
+	L"Function PlotManager.BioAutoConditionals.F377",
+	L"Function PlotManager.BioAutoConditionals.F240",
+	L"Function PlotManager.BioAutoConditionals.F239",
+	L"Function PlotManager.BioAutoConditionals.F222",
+	L"Function PlotManager.BioAutoConditionals.F221",
+	L"Function PlotManager.BioAutoConditionals.F220",
+	L"Function PlotManager.BioAutoConditionals.F219",
+	L"Function PlotManager.BioAutoConditionals.F218",
+	L"Function PlotManager.BioAutoConditionals.F217",
+	L"Function PlotManager.BioAutoConditionals.F216",
+	L"Function PlotManager.BioAutoConditionals.F215",
+	L"Function PlotManager.BioAutoConditionals.F214",
+	L"Function PlotManager.BioAutoConditionals.F213",
+	L"Function PlotManager.BioAutoConditionals.F212",
+	L"Function PlotManager.BioAutoConditionals.F211",
+	L"Function PlotManager.BioAutoConditionals.F209",
+	L"Function PlotManager.BioAutoConditionals.F208",
+	L"Function PlotManager.BioAutoConditionals.F207",
+	L"Function PlotManager.BioAutoConditionals.F206",
+	L"Function PlotManager.BioAutoConditionals.F205",
+	L"Function PlotManager.BioAutoConditionals.F204",
+	L"Function PlotManager.BioAutoConditionals.F203",
+	L"Function PlotManager.BioAutoConditionals.F202",
+	L"Function PlotManager.BioAutoConditionals.F201",
+	L"Function PlotManager.BioAutoConditionals.F200",
+	L"Function PlotManager.BioAutoConditionals.F199",
+	L"Function PlotManager.BioAutoConditionals.F198",
+	L"Function PlotManager.BioAutoConditionals.F234",
+	L"Function PlotManager.BioAutoConditionals.F233",
+	L"Function PlotManager.BioAutoConditionals.F232",
+	L"Function PlotManager.BioAutoConditionals.F231",
+	L"Function PlotManager.BioAutoConditionals.F230",
+	L"Function PlotManager.BioAutoConditionals.F229",
+	L"Function PlotManager.BioAutoConditionals.F228",
+	L"Function PlotManager.BioAutoConditionals.F227",
+	L"Function PlotManager.BioAutoConditionals.F226",
+	L"Function PlotManager.BioAutoConditionals.F225",
+	L"Function PlotManager.BioAutoConditionals.F224",
+	L"Function PlotManager.BioAutoConditionals.F223",
+	L"Function PlotManager.BioAutoConditionals.F1303",
+	L"Function PlotManager.BioAutoConditionals.F1302",
+	L"Function PlotManager.BioAutoConditionals.F365",
+	L"Function PlotManager.BioAutoConditionals.F364",
+	L"Function PlotManager.BioAutoConditionals.F363",
+	L"Function PlotManager.BioAutoConditionals.F362",
+	L"Function PlotManager.BioAutoConditionals.F361",
+	L"Function PlotManager.BioAutoConditionals.F360",
+	L"Function PlotManager.BioAutoConditionals.F359",
+	L"Function PlotManager.BioAutoConditionals.F358",
+	L"Function PlotManager.BioAutoConditionals.F357",
+	L"Function PlotManager.BioAutoConditionals.F354",
+	L"Function PlotManager.BioAutoConditionals.F353",
+	L"Function PlotManager.BioAutoConditionals.F352",
+	L"Function PlotManager.BioAutoConditionals.F1533",
+	L"Function PlotManager.BioAutoConditionals.F1602",
+	L"Function PlotManager.BioAutoConditionals.F1581",
+	L"Function PlotManager.BioAutoConditionals.F735",
+	L"Function PlotManager.BioAutoConditionals.F881",
+	L"Function PlotManager.BioAutoConditionals.F1276",
+	L"Function PlotManager.BioAutoConditionals.F1275",
+	L"Function PlotManager.BioAutoConditionals.F512",
+	L"Function PlotManager.BioAutoConditionals.F491",
+	L"Function PlotManager.BioAutoConditionals.F238",
+	L"Function PlotManager.BioAutoConditionals.F197",
+	L"Function PlotManager.BioAutoConditionals.F196",
+	L"Function PlotManager.BioAutoConditionals.F195",
+	L"Function PlotManager.BioAutoConditionals.F194",
+	L"Function PlotManager.BioAutoConditionals.F193",
+	L"Function PlotManager.BioAutoConditionals.F192",
+	L"Function PlotManager.BioAutoConditionals.F191",
+	L"Function PlotManager.BioAutoConditionals.F190",
+	L"Function PlotManager.BioAutoConditionals.F189",
+	L"Function PlotManager.BioAutoConditionals.F188",
+	L"Function PlotManager.BioAutoConditionals.F187",
+	L"Function PlotManager.BioAutoConditionals.F186",
+	L"Function PlotManager.BioAutoConditionals.F185",
+	L"Function PlotManager.BioAutoConditionals.F184",
+	L"Function PlotManager.BioAutoConditionals.F183",
+	L"Function PlotManager.BioAutoConditionals.F182",
+	L"Function PlotManager.BioAutoConditionals.F181",
+	L"Function PlotManager.BioAutoConditionals.F180",
+	L"Function PlotManager.BioAutoConditionals.F179",
+	L"Function PlotManager.BioAutoConditionals.F178",
+	L"Function PlotManager.BioAutoConditionals.F177",
+	L"Function PlotManager.BioAutoConditionals.F176",
+	L"Function PlotManager.BioAutoConditionals.F175",
+	L"Function PlotManager.BioAutoConditionals.F174",
+	L"Function PlotManager.BioAutoConditionals.F173",
+	L"Function PlotManager.BioAutoConditionals.F172",
+	L"Function PlotManager.BioAutoConditionals.F161",
+	L"Function PlotManager.BioAutoConditionals.F160",
+	L"Function PlotManager.BioAutoConditionals.F159",
+	L"Function PlotManager.BioAutoConditionals.F1535",
+	L"Function PlotManager.BioAutoConditionals.F1534",
+	L"Function PlotManager.BioAutoConditionals.F1505",
+	L"Function PlotManager.BioAutoConditionals.F1504",
+	L"Function PlotManager.BioAutoConditionals.F1503",
+	L"Function PlotManager.BioAutoConditionals.F1502",
+	L"Function PlotManager.BioAutoConditionals.F1501",
+	L"Function PlotManager.BioAutoConditionals.F1500",
+	L"Function PlotManager.BioAutoConditionals.F1499",
+	L"Function PlotManager.BioAutoConditionals.F1498",
+	L"Function PlotManager.BioAutoConditionals.F1497",
+	L"Function PlotManager.BioAutoConditionals.F1484",
+	L"Function PlotManager.BioAutoConditionals.F1483",
+	L"Function PlotManager.BioAutoConditionals.F1482",
+	L"Function PlotManager.BioAutoConditionals.F1481",
+	L"Function PlotManager.BioAutoConditionals.F1480",
+	L"Function PlotManager.BioAutoConditionals.F1479",
+	L"Function PlotManager.BioAutoConditionals.F1478",
+	L"Function PlotManager.BioAutoConditionals.F1477",
+	L"Function PlotManager.BioAutoConditionals.F1476",
+	L"Function PlotManager.BioAutoConditionals.F1475",
+	L"Function PlotManager.BioAutoConditionals.F1474",
+	L"Function PlotManager.BioAutoConditionals.F1473",
+	L"Function PlotManager.BioAutoConditionals.F1472",
+	L"Function PlotManager.BioAutoConditionals.F1471",
+	L"Function PlotManager.BioAutoConditionals.F1470",
+	L"Function PlotManager.BioAutoConditionals.F1469",
+	L"Function PlotManager.BioAutoConditionals.F1468",
+	L"Function PlotManager.BioAutoConditionals.F1467",
+	L"Function PlotManager.BioAutoConditionals.F1466",
+	L"Function PlotManager.BioAutoConditionals.F1465",
+	L"Function PlotManager.BioAutoConditionals.F1464",
+	L"Function PlotManager.BioAutoConditionals.F1463",
+	L"Function PlotManager.BioAutoConditionals.F1462",
+	L"Function PlotManager.BioAutoConditionals.F1461",
+	L"Function PlotManager.BioAutoConditionals.F1460",
+	L"Function PlotManager.BioAutoConditionals.F1459",
+	L"Function PlotManager.BioAutoConditionals.F1458",
+	L"Function PlotManager.BioAutoConditionals.F1457",
+	L"Function PlotManager.BioAutoConditionals.F1456",
+	L"Function PlotManager.BioAutoConditionals.F1455",
+	L"Function PlotManager.BioAutoConditionals.F1454",
+	L"Function PlotManager.BioAutoConditionals.F1453",
+	L"Function PlotManager.BioAutoConditionals.F1452",
+	L"Function PlotManager.BioAutoConditionals.F1451",
+	L"Function PlotManager.BioAutoConditionals.F1450",
+	L"Function PlotManager.BioAutoConditionals.F1449",
+	L"Function PlotManager.BioAutoConditionals.F1448",
+	L"Function PlotManager.BioAutoConditionals.F1447",
+	L"Function PlotManager.BioAutoConditionals.F1446",
+	L"Function PlotManager.BioAutoConditionals.F1445",
+	L"Function PlotManager.BioAutoConditionals.F2044",
+	L"Function PlotManager.BioAutoConditionals.F1230",
+	L"Function PlotManager.BioAutoConditionals.F1229",
+	L"Function PlotManager.BioAutoConditionals.F1228",
+	L"Function PlotManager.BioAutoConditionals.F1227",
+	L"Function PlotManager.BioAutoConditionals.F1226",
+	L"Function PlotManager.BioAutoConditionals.F1225",
+	L"Function PlotManager.BioAutoConditionals.F1224",
+	L"Function PlotManager.BioAutoConditionals.F1223",
+	L"Function PlotManager.BioAutoConditionals.F1222",
+	L"Function PlotManager.BioAutoConditionals.F1221",
+	L"Function PlotManager.BioAutoConditionals.F1220",
+	L"Function PlotManager.BioAutoConditionals.F1219",
+	L"Function PlotManager.BioAutoConditionals.F1218",
+	L"Function PlotManager.BioAutoConditionals.F1217",
+	L"Function PlotManager.BioAutoConditionals.F1216",
+	L"Function PlotManager.BioAutoConditionals.F1215",
+	L"Function PlotManager.BioAutoConditionals.F1214",
+	L"Function PlotManager.BioAutoConditionals.F1213",
+	L"Function PlotManager.BioAutoConditionals.F1212",
+	L"Function PlotManager.BioAutoConditionals.F1211",
+	L"Function PlotManager.BioAutoConditionals.F1209",
+	L"Function PlotManager.BioAutoConditionals.F1208",
+	L"Function PlotManager.BioAutoConditionals.F1207",
+	L"Function PlotManager.BioAutoConditionals.F1206",
+	L"Function PlotManager.BioAutoConditionals.F1205",
+	L"Function PlotManager.BioAutoConditionals.F1204",
+	L"Function PlotManager.BioAutoConditionals.F1140",
+	L"Function PlotManager.BioAutoConditionals.F1139",
+	L"Function PlotManager.BioAutoConditionals.F1138",
+	L"Function PlotManager.BioAutoConditionals.F1137",
+	L"Function PlotManager.BioAutoConditionals.F1136",
+	L"Function PlotManager.BioAutoConditionals.F1135",
+	L"Function PlotManager.BioAutoConditionals.F1134",
+	L"Function PlotManager.BioAutoConditionals.F1133",
+	L"Function PlotManager.BioAutoConditionals.F1132",
+	L"Function PlotManager.BioAutoConditionals.F1131",
+	L"Function PlotManager.BioAutoConditionals.F1130",
+	L"Function PlotManager.BioAutoConditionals.F1129",
+	L"Function PlotManager.BioAutoConditionals.F1128",
+	L"Function PlotManager.BioAutoConditionals.F1127",
+	L"Function PlotManager.BioAutoConditionals.F1032",
+	L"Function PlotManager.BioAutoConditionals.F1635",
+	L"Function PlotManager.BioAutoConditionals.F1634",
+	L"Function PlotManager.BioAutoConditionals.F1633",
+	L"Function PlotManager.BioAutoConditionals.F1632",
+	L"Function PlotManager.BioAutoConditionals.F1631",
+	L"Function PlotManager.BioAutoConditionals.F1630",
+	L"Function PlotManager.BioAutoConditionals.F1629",
+	L"Function PlotManager.BioAutoConditionals.F1320",
+	L"Function PlotManager.BioAutoConditionals.F1319",
+	L"Function PlotManager.BioAutoConditionals.F1318",
+	L"Function PlotManager.BioAutoConditionals.F1317",
+	L"Function PlotManager.BioAutoConditionals.F1518",
+	L"Function PlotManager.BioAutoConditionals.F1517",
+	L"Function PlotManager.BioAutoConditionals.F1328",
+	L"Function PlotManager.BioAutoConditionals.F1325",
+	L"Function PlotManager.BioAutoConditionals.F1324",
+	L"Function PlotManager.BioAutoConditionals.F980",
+	L"Function PlotManager.BioAutoConditionals.F979",
+	L"Function PlotManager.BioAutoConditionals.F978",
+	L"Function PlotManager.BioAutoConditionals.F977",
+	L"Function PlotManager.BioAutoConditionals.F976",
+	L"Function PlotManager.BioAutoConditionals.F975",
+	L"Function PlotManager.BioAutoConditionals.F974",
+	L"Function PlotManager.BioAutoConditionals.F973",
+	L"Function PlotManager.BioAutoConditionals.F972",
+	L"Function PlotManager.BioAutoConditionals.F971",
+	L"Function PlotManager.BioAutoConditionals.F970",
+	L"Function PlotManager.BioAutoConditionals.F969",
+	L"Function PlotManager.BioAutoConditionals.F968",
+	L"Function PlotManager.BioAutoConditionals.F967",
+	L"Function PlotManager.BioAutoConditionals.F966",
+	L"Function PlotManager.BioAutoConditionals.F1346",
+	L"Function PlotManager.BioAutoConditionals.F1345",
+	L"Function PlotManager.BioAutoConditionals.F1274",
+	L"Function PlotManager.BioAutoConditionals.F1273",
+	L"Function PlotManager.BioAutoConditionals.F983",
+	L"Function PlotManager.BioAutoConditionals.F965",
+	L"Function PlotManager.BioAutoConditionals.F964",
+	L"Function PlotManager.BioAutoConditionals.F963",
+	L"Function PlotManager.BioAutoConditionals.F891",
+	L"Function PlotManager.BioAutoConditionals.F1074",
+	L"Function PlotManager.BioAutoConditionals.F1073",
+	L"Function PlotManager.BioAutoConditionals.F1072",
+	L"Function PlotManager.BioAutoConditionals.F1071",
+	L"Function PlotManager.BioAutoConditionals.F1070",
+	L"Function PlotManager.BioAutoConditionals.F1069",
+	L"Function PlotManager.BioAutoConditionals.F1068",
+	L"Function PlotManager.BioAutoConditionals.F1067",
+	L"Function PlotManager.BioAutoConditionals.F1066",
+	L"Function PlotManager.BioAutoConditionals.F1065",
+	L"Function PlotManager.BioAutoConditionals.F1064",
+	L"Function PlotManager.BioAutoConditionals.F1063",
+	L"Function PlotManager.BioAutoConditionals.F1062",
+	L"Function PlotManager.BioAutoConditionals.F1030",
+	L"Function PlotManager.BioAutoConditionals.F1029",
+	L"Function PlotManager.BioAutoConditionals.F1024",
+	L"Function PlotManager.BioAutoConditionals.F1023",
+	L"Function PlotManager.BioAutoConditionals.F1022",
+	L"Function PlotManager.BioAutoConditionals.F1021",
+	L"Function PlotManager.BioAutoConditionals.F1020",
+	L"Function PlotManager.BioAutoConditionals.F890",
+	L"Function PlotManager.BioAutoConditionals.F1088",
+	L"Function PlotManager.BioAutoConditionals.F1087",
+	L"Function PlotManager.BioAutoConditionals.F1086",
+	L"Function PlotManager.BioAutoConditionals.F1085",
+	L"Function PlotManager.BioAutoConditionals.F1084",
+	L"Function PlotManager.BioAutoConditionals.F1083",
+	L"Function PlotManager.BioAutoConditionals.F1082",
+	L"Function PlotManager.BioAutoConditionals.F1081",
+	L"Function PlotManager.BioAutoConditionals.F1080",
+	L"Function PlotManager.BioAutoConditionals.F1079",
+	L"Function PlotManager.BioAutoConditionals.F1627",
+	L"Function PlotManager.BioAutoConditionals.F1626",
+	L"Function PlotManager.BioAutoConditionals.F1015",
+	L"Function PlotManager.BioAutoConditionals.F1005",
+	L"Function PlotManager.BioAutoConditionals.F889",
+	L"Function PlotManager.BioAutoConditionals.F819",
+	L"Function PlotManager.BioAutoConditionals.F818",
+	L"Function PlotManager.BioAutoConditionals.F817",
+	L"Function PlotManager.BioAutoConditionals.F816",
+	L"Function PlotManager.BioAutoConditionals.F1522",
+	L"Function PlotManager.BioAutoConditionals.F1014",
+	L"Function PlotManager.BioAutoConditionals.F1013",
+	L"Function PlotManager.BioAutoConditionals.F1012",
+	L"Function PlotManager.BioAutoConditionals.F1004",
+	L"Function PlotManager.BioAutoConditionals.F1002",
+	L"Function PlotManager.BioAutoConditionals.F998",
+	L"Function PlotManager.BioAutoConditionals.F932",
+	L"Function PlotManager.BioAutoConditionals.F931",
+	L"Function PlotManager.BioAutoConditionals.F667",
+	L"Function PlotManager.BioAutoConditionals.F987",
+	L"Function PlotManager.BioAutoConditionals.F988",
+	L"Function PlotManager.BioAutoConditionals.F540",
+	L"Function PlotManager.BioAutoConditionals.F539",
+	L"Function PlotManager.BioAutoConditionals.F538",
+	L"Function PlotManager.BioAutoConditionals.F537",
+	L"Function PlotManager.BioAutoConditionals.F536",
+	L"Function PlotManager.BioAutoConditionals.F535",
+	L"Function PlotManager.BioAutoConditionals.F534",
+	L"Function PlotManager.BioAutoConditionals.F533",
+	L"Function PlotManager.BioAutoConditionals.F532",
+	L"Function PlotManager.BioAutoConditionals.F531",
+	L"Function PlotManager.BioAutoConditionals.F530",
+	L"Function PlotManager.BioAutoConditionals.F529",
+	L"Function PlotManager.BioAutoConditionals.F528",
+	L"Function PlotManager.BioAutoConditionals.F527",
+	L"Function PlotManager.BioAutoConditionals.F526",
+	L"Function PlotManager.BioAutoConditionals.F525",
+	L"Function PlotManager.BioAutoConditionals.F1536",
+	L"Function PlotManager.BioAutoConditionals.F1354",
+	L"Function PlotManager.BioAutoConditionals.F1353",
+	L"Function PlotManager.BioAutoConditionals.F1322",
+	L"Function PlotManager.BioAutoConditionals.F1321",
+	L"Function PlotManager.BioAutoConditionals.F1264",
+	L"Function PlotManager.BioAutoConditionals.F1263",
+	L"Function PlotManager.BioAutoConditionals.F1262",
+	L"Function PlotManager.BioAutoConditionals.F1017",
+	L"Function PlotManager.BioAutoConditionals.F990",
+	L"Function PlotManager.BioAutoConditionals.F986",
+	L"Function PlotManager.BioAutoConditionals.F985",
+	L"Function PlotManager.BioAutoConditionals.F961",
+	L"Function PlotManager.BioAutoConditionals.F960",
+	L"Function PlotManager.BioAutoConditionals.F559",
+	L"Function PlotManager.BioAutoConditionals.F558",
+	L"Function PlotManager.BioAutoConditionals.F553",
+	L"Function PlotManager.BioAutoConditionals.F551",
+	L"Function PlotManager.BioAutoConditionals.F547",
+	L"Function PlotManager.BioAutoConditionals.F546",
+	L"Function PlotManager.BioAutoConditionals.F545",
+	L"Function PlotManager.BioAutoConditionals.F544",
+	L"Function PlotManager.BioAutoConditionals.F543",
+	L"Function PlotManager.BioAutoConditionals.F542",
+	L"Function PlotManager.BioAutoConditionals.F505",
+	L"Function PlotManager.BioAutoConditionals.F1165",
+	L"Function PlotManager.BioAutoConditionals.F1164",
+	L"Function PlotManager.BioAutoConditionals.F1161",
+	L"Function PlotManager.BioAutoConditionals.F309",
+	L"Function PlotManager.BioAutoConditionals.F308",
+	L"Function PlotManager.BioAutoConditionals.F307",
+	L"Function PlotManager.BioAutoConditionals.F306",
+	L"Function PlotManager.BioAutoConditionals.F304",
+	L"Function PlotManager.BioAutoConditionals.F302",
+	L"Function PlotManager.BioAutoConditionals.F1574",
+	L"Function PlotManager.BioAutoConditionals.F1573",
+	L"Function PlotManager.BioAutoConditionals.F1261",
+	L"Function PlotManager.BioAutoConditionals.F1260",
+	L"Function PlotManager.BioAutoConditionals.F127",
+	L"Function PlotManager.BioAutoConditionals.F126",
+	L"Function PlotManager.BioAutoConditionals.F125",
+	L"Function PlotManager.BioAutoConditionals.F1179",
+	L"Function PlotManager.BioAutoConditionals.F1091",
+	L"Function PlotManager.BioAutoConditionals.F927",
+	L"Function PlotManager.BioAutoConditionals.F926",
+	L"Function PlotManager.BioAutoConditionals.F236",
+	L"Function PlotManager.BioAutoConditionals.F1258",
+	L"Function PlotManager.BioAutoConditionals.F1248",
+	L"Function PlotManager.BioAutoConditionals.F247",
+	L"Function PlotManager.BioAutoConditionals.F246",
+	L"Function PlotManager.BioAutoConditionals.F1620",
+	L"Function PlotManager.BioAutoConditionals.F1580",
+	L"Function PlotManager.BioAutoConditionals.F1556",
+	L"Function PlotManager.BioAutoConditionals.F1537",
+	L"Function PlotManager.BioAutoConditionals.F1493",
+	L"Function PlotManager.BioAutoConditionals.F1365",
+	L"Function PlotManager.BioAutoConditionals.F1364",
+	L"Function PlotManager.BioAutoConditionals.F1363",
+	L"Function PlotManager.BioAutoConditionals.F1362",
+	L"Function PlotManager.BioAutoConditionals.F1361",
+	L"Function PlotManager.BioAutoConditionals.F1360",
+	L"Function PlotManager.BioAutoConditionals.F1305",
+	L"Function PlotManager.BioAutoConditionals.F1304",
+	L"Function PlotManager.BioAutoConditionals.F948",
+	L"Function PlotManager.BioAutoConditionals.F947",
+	L"Function PlotManager.BioAutoConditionals.F946",
+	L"Function PlotManager.BioAutoConditionals.F945",
+	L"Function PlotManager.BioAutoConditionals.F944",
+	L"Function PlotManager.BioAutoConditionals.F943",
+	L"Function PlotManager.BioAutoConditionals.F1617",
+	L"Function PlotManager.BioAutoConditionals.F1203",
+	L"Function PlotManager.BioAutoConditionals.F1202",
+	L"Function PlotManager.BioAutoConditionals.F275",
+	L"Function PlotManager.BioAutoConditionals.F274",
+	L"Function PlotManager.BioAutoConditionals.F56",
+	L"Function PlotManager.BioAutoConditionals.F55",
+	L"Function PlotManager.BioAutoConditionals.F54",
+	L"Function PlotManager.BioAutoConditionals.F53",
+	L"Function PlotManager.BioAutoConditionals.F52",
+	L"Function PlotManager.BioAutoConditionals.F51",
+	L"Function PlotManager.BioAutoConditionals.F50",
+	L"Function PlotManager.BioAutoConditionals.F49",
+	L"Function PlotManager.BioAutoConditionals.F426",
+	L"Function PlotManager.BioAutoConditionals.F425",
+	L"Function PlotManager.BioAutoConditionals.F422",
+	L"Function PlotManager.BioAutoConditionals.F420",
+	L"Function PlotManager.BioAutoConditionals.F408",
+	L"Function PlotManager.BioAutoConditionals.F407",
+	L"Function PlotManager.BioAutoConditionals.F406",
+	L"Function PlotManager.BioAutoConditionals.F405",
+	L"Function PlotManager.BioAutoConditionals.F404",
+	L"Function PlotManager.BioAutoConditionals.F403",
+	L"Function PlotManager.BioAutoConditionals.F402",
+	L"Function PlotManager.BioAutoConditionals.F401",
+	L"Function PlotManager.BioAutoConditionals.F400",
+	L"Function PlotManager.BioAutoConditionals.F399",
+	L"Function PlotManager.BioAutoConditionals.F398",
+	L"Function PlotManager.BioAutoConditionals.F397",
+	L"Function PlotManager.BioAutoConditionals.F235",
+	L"Function PlotManager.BioAutoConditionals.F66",
+	L"Function PlotManager.BioAutoConditionals.F65",
+	L"Function PlotManager.BioAutoConditionals.F64",
+	L"Function PlotManager.BioAutoConditionals.F63",
+	L"Function PlotManager.BioAutoConditionals.F62",
+	L"Function PlotManager.BioAutoConditionals.F60",
+	L"Function PlotManager.BioAutoConditionals.F48",
+	L"Function PlotManager.BioAutoConditionals.F1316",
+	L"Function PlotManager.BioAutoConditionals.F1315",
+	L"Function PlotManager.BioAutoConditionals.F1314",
+	L"Function PlotManager.BioAutoConditionals.F1313",
+	L"Function PlotManager.BioAutoConditionals.F1312",
+	L"Function PlotManager.BioAutoConditionals.F1311",
+	L"Function PlotManager.BioAutoConditionals.F1310",
+	L"Function PlotManager.BioAutoConditionals.F1309",
+	L"Function PlotManager.BioAutoConditionals.F1308",
+	L"Function PlotManager.BioAutoConditionals.F1307",
+	L"Function PlotManager.BioAutoConditionals.F1615",
+	L"Function PlotManager.BioAutoConditionals.F1614",
+	L"Function PlotManager.BioAutoConditionals.F1613",
+	L"Function PlotManager.BioAutoConditionals.F1612",
+	L"Function PlotManager.BioAutoConditionals.F1611",
+	L"Function PlotManager.BioAutoConditionals.F1610",
+	L"Function PlotManager.BioAutoConditionals.F1609",
+	L"Function PlotManager.BioAutoConditionals.F1608",
+	L"Function PlotManager.BioAutoConditionals.F1607",
+	L"Function PlotManager.BioAutoConditionals.F1606",
+	L"Function PlotManager.BioAutoConditionals.F1605",
+	L"Function PlotManager.BioAutoConditionals.F1604",
+	L"Function PlotManager.BioAutoConditionals.F1344",
+	L"Function PlotManager.BioAutoConditionals.F1343",
+	L"Function PlotManager.BioAutoConditionals.F1342",
+	L"Function PlotManager.BioAutoConditionals.F1341",
+	L"Function PlotManager.BioAutoConditionals.F1340",
+	L"Function PlotManager.BioAutoConditionals.F1339",
+	L"Function PlotManager.BioAutoConditionals.F1338",
+	L"Function PlotManager.BioAutoConditionals.F1337",
+	L"Function PlotManager.BioAutoConditionals.F1336",
+	L"Function PlotManager.BioAutoConditionals.F1335",
+	L"Function PlotManager.BioAutoConditionals.F1334",
+	L"Function PlotManager.BioAutoConditionals.F1333",
+	L"Function PlotManager.BioAutoConditionals.F504",
+	L"Function PlotManager.BioAutoConditionals.F503",
+	L"Function PlotManager.BioAutoConditionals.F502",
+	L"Function PlotManager.BioAutoConditionals.F501",
+	L"Function PlotManager.BioAutoConditionals.F500",
+	L"Function PlotManager.BioAutoConditionals.F499",
+	L"Function PlotManager.BioAutoConditionals.F498",
+	L"Function PlotManager.BioAutoConditionals.F497",
+	L"Function PlotManager.BioAutoConditionals.F496",
+	L"Function PlotManager.BioAutoConditionals.F495",
+	L"Function PlotManager.BioAutoConditionals.F494",
+	L"Function PlotManager.BioAutoConditionals.F493",
+	L"Function PlotManager.BioAutoConditionals.F982",
+	L"Function PlotManager.BioAutoConditionals.F981",
+	L"Function PlotManager.BioAutoConditionals.F1200",
+	L"Function PlotManager.BioAutoConditionals.F956",
+	L"Function PlotManager.BioAutoConditionals.F666",
+	L"Function PlotManager.BioAutoConditionals.F663",
+	L"Function PlotManager.BioAutoConditionals.F662",
+	L"Function PlotManager.BioAutoConditionals.F661",
+	L"Function PlotManager.BioAutoConditionals.F660",
+	L"Function PlotManager.BioAutoConditionals.F659",
+	L"Function PlotManager.BioAutoConditionals.F658",
+	L"Function PlotManager.BioAutoConditionals.F657",
+	L"Function PlotManager.BioAutoConditionals.F656",
+	L"Function PlotManager.BioAutoConditionals.F655",
+	L"Function PlotManager.BioAutoConditionals.F654",
+	L"Function PlotManager.BioAutoConditionals.F653",
+	L"Function PlotManager.BioAutoConditionals.F123",
+	L"Function PlotManager.BioAutoConditionals.F122",
+	L"Function PlotManager.BioAutoConditionals.F121",
+	L"Function PlotManager.BioAutoConditionals.F120",
+	L"Function PlotManager.BioAutoConditionals.F119",
+	L"Function PlotManager.BioAutoConditionals.F118",
+	L"Function PlotManager.BioAutoConditionals.F117",
+	L"Function PlotManager.BioAutoConditionals.F116",
+	L"Function PlotManager.BioAutoConditionals.F115",
+	L"Function PlotManager.BioAutoConditionals.F114",
+	L"Function PlotManager.BioAutoConditionals.F113",
+	L"Function PlotManager.BioAutoConditionals.F112",
+	L"Function PlotManager.BioAutoConditionals.F80",
+	L"Function PlotManager.BioAutoConditionals.F79",
+	L"Function PlotManager.BioAutoConditionals.F78",
+	L"Function PlotManager.BioAutoConditionals.F77",
+	L"Function PlotManager.BioAutoConditionals.F76",
+	L"Function PlotManager.BioAutoConditionals.F75",
+	L"Function PlotManager.BioAutoConditionals.F74",
+	L"Function PlotManager.BioAutoConditionals.F73",
+	L"Function PlotManager.BioAutoConditionals.F72",
+	L"Function PlotManager.BioAutoConditionals.F71",
+	L"Function PlotManager.BioAutoConditionals.F70",
+	L"Function PlotManager.BioAutoConditionals.F69",
+	L"Function PlotManager.BioAutoConditionals.F892",
+	L"Function PlotManager.BioAutoConditionals.F351",
+	L"Function PlotManager.BioAutoConditionals.F93",
+	L"Function PlotManager.BioAutoConditionals.F92",
+	L"Function PlotManager.BioAutoConditionals.F91",
+	L"Function PlotManager.BioAutoConditionals.F90",
+	L"Function PlotManager.BioAutoConditionals.F89",
+	L"Function PlotManager.BioAutoConditionals.F88",
+	L"Function PlotManager.BioAutoConditionals.F87",
+	L"Function PlotManager.BioAutoConditionals.F86",
+	L"Function PlotManager.BioAutoConditionals.F85",
+	L"Function PlotManager.BioAutoConditionals.F83",
+	L"Function PlotManager.BioAutoConditionals.F82",
+	L"Function PlotManager.BioAutoConditionals.F81",
+	L"Function PlotManager.BioAutoConditionals.F106",
+	L"Function PlotManager.BioAutoConditionals.F105",
+	L"Function PlotManager.BioAutoConditionals.F104",
+	L"Function PlotManager.BioAutoConditionals.F103",
+	L"Function PlotManager.BioAutoConditionals.F102",
+	L"Function PlotManager.BioAutoConditionals.F101",
+	L"Function PlotManager.BioAutoConditionals.F100",
+	L"Function PlotManager.BioAutoConditionals.F99",
+	L"Function PlotManager.BioAutoConditionals.F98",
+	L"Function PlotManager.BioAutoConditionals.F97",
+	L"Function PlotManager.BioAutoConditionals.F96",
+	L"Function PlotManager.BioAutoConditionals.F95",
+	L"Function PlotManager.BioAutoConditionals.F475",
+	L"Function PlotManager.BioAutoConditionals.F24",
+	L"Function PlotManager.BioAutoConditionals.F23",
+	L"Function PlotManager.BioAutoConditionals.F22",
+	L"Function PlotManager.BioAutoConditionals.F21",
+	L"Function PlotManager.BioAutoConditionals.F20",
+	L"Function PlotManager.BioAutoConditionals.F19",
+	L"Function PlotManager.BioAutoConditionals.F18",
+	L"Function PlotManager.BioAutoConditionals.F17",
+	L"Function PlotManager.BioAutoConditionals.F16",
+	L"Function PlotManager.BioAutoConditionals.F15",
+	L"Function PlotManager.BioAutoConditionals.F14",
+	L"Function PlotManager.BioAutoConditionals.F13",
+	L"Function PlotManager.BioAutoConditionals.F1277",
+	L"Function PlotManager.BioAutoConditionals.F1178",
+	L"Function PlotManager.BioAutoConditionals.F12",
+	L"Function PlotManager.BioAutoConditionals.F11",
+	L"Function PlotManager.BioAutoConditionals.F10",
+	L"Function PlotManager.BioAutoConditionals.F9",
+	L"Function PlotManager.BioAutoConditionals.F8",
+	L"Function PlotManager.BioAutoConditionals.F7",
+	L"Function PlotManager.BioAutoConditionals.F6",
+	L"Function PlotManager.BioAutoConditionals.F5",
+	L"Function PlotManager.BioAutoConditionals.F4",
+	L"Function PlotManager.BioAutoConditionals.F3",
+	L"Function PlotManager.BioAutoConditionals.F2",
+	L"Function PlotManager.BioAutoConditionals.F1",
+	L"Function PlotManager.BioAutoConditionals.F1507",
+	L"Function PlotManager.BioAutoConditionals.F169",
+	L"Function PlotManager.BioAutoConditionals.F924",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -47,7 +47,7 @@ class USFXDamageType_IncisorSniperRifle_CER_02 : public USFXDamageType_SniperRif
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -61,7 +61,7 @@ class USFXGameEffect_Gear_CER02_ArmMeleeBonus : public USFXGameEffect_MeleeDamag
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -75,7 +75,7 @@ class USFXGameEffect_Gear_CER02_ArmShieldBonus : public USFXGameEffect_PassiveSh
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -89,7 +89,7 @@ class USFXGameEffect_Gear_CER02_ArmWeaponDmgBonus : public USFXGameEffect_Passiv
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -103,7 +103,7 @@ class USFXGameEffect_Gear_CER02_HealthBonus : public USFXGameEffect_PassiveHealt
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -117,7 +117,7 @@ class USFXGameEffect_Gear_CER02_HelmetHeadShotBonus : public USFXGameEffect_Pass
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -131,7 +131,7 @@ class USFXGameEffect_Gear_CER02_HelmetShieldBonus : public USFXGameEffect_Passiv
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -145,7 +145,7 @@ class USFXGameEffect_Gear_CER02_HelmetWeaponDmgBonus : public USFXGameEffect_Pas
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -159,7 +159,7 @@ class USFXGameEffect_Gear_CER02_LegHvyAmmoBonus : public USFXGameEffect_PassiveH
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -173,7 +173,7 @@ class USFXGameEffect_Gear_CER02_LegShieldBonus : public USFXGameEffect_PassiveSh
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -187,7 +187,7 @@ class USFXGameEffect_Gear_CER02_ShoulderMeleeBonus : public USFXGameEffect_Melee
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -201,7 +201,7 @@ class USFXGameEffect_Gear_CER02_ShoulderShieldBonus : public USFXGameEffect_Pass
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -215,7 +215,7 @@ class USFXGameEffect_Gear_CER02_TorsoMeleeBonus : public USFXGameEffect_MeleeDam
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -229,7 +229,7 @@ class USFXGameEffect_Gear_CER02_TorsoShieldBonus : public USFXGameEffect_Passive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -243,7 +243,7 @@ class USFXGameEffect_Gear_CER02_TorsoWeaponDmgBonus : public USFXGameEffect_Pass
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -257,7 +257,7 @@ class ASFXWeapon_IncisorSniperRifle_CER_02 : public ASFXWeapon_SniperRifle
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28,198 +28,180 @@
 
 
 
-class UClass* USFXDamageType_IncisorSniperRifle_CER_02::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_IncisorSniperRifle_CER_02::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXDamageType_IncisorSniperRifle_CER_02", &UObject::FindClass };
 
 class UClass* USFXDamageType_IncisorSniperRifle_CER_02::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXDamageType_IncisorSniperRifle_CER_02" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CER02_ArmMeleeBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CER02_ArmMeleeBonus::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_ArmMeleeBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CER02_ArmMeleeBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_ArmMeleeBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CER02_ArmShieldBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CER02_ArmShieldBonus::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_ArmShieldBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CER02_ArmShieldBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_ArmShieldBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CER02_ArmWeaponDmgBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CER02_ArmWeaponDmgBonus::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_ArmWeaponDmgBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CER02_ArmWeaponDmgBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_ArmWeaponDmgBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CER02_HealthBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CER02_HealthBonus::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_HealthBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CER02_HealthBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_HealthBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CER02_HelmetHeadShotBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CER02_HelmetHeadShotBonus::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_HelmetHeadShotBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CER02_HelmetHeadShotBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_HelmetHeadShotBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CER02_HelmetShieldBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CER02_HelmetShieldBonus::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_HelmetShieldBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CER02_HelmetShieldBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_HelmetShieldBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CER02_HelmetWeaponDmgBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CER02_HelmetWeaponDmgBonus::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_HelmetWeaponDmgBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CER02_HelmetWeaponDmgBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_HelmetWeaponDmgBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CER02_LegHvyAmmoBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CER02_LegHvyAmmoBonus::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_LegHvyAmmoBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CER02_LegHvyAmmoBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_LegHvyAmmoBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CER02_LegShieldBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CER02_LegShieldBonus::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_LegShieldBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CER02_LegShieldBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_LegShieldBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CER02_ShoulderMeleeBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CER02_ShoulderMeleeBonus::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_ShoulderMeleeBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CER02_ShoulderMeleeBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_ShoulderMeleeBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CER02_ShoulderShieldBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CER02_ShoulderShieldBonus::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_ShoulderShieldBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CER02_ShoulderShieldBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_ShoulderShieldBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CER02_TorsoMeleeBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CER02_TorsoMeleeBonus::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_TorsoMeleeBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CER02_TorsoMeleeBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_TorsoMeleeBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CER02_TorsoShieldBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CER02_TorsoShieldBonus::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_TorsoShieldBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CER02_TorsoShieldBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_TorsoShieldBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CER02_TorsoWeaponDmgBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CER02_TorsoWeaponDmgBonus::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_TorsoWeaponDmgBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CER02_TorsoWeaponDmgBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_TorsoWeaponDmgBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXWeapon_IncisorSniperRifle_CER_02::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_IncisorSniperRifle_CER_02::pClassPointer { L"Class SFXGameContentDLC_CER_02.SFXWeapon_IncisorSniperRifle_CER_02", &UObject::FindClass };
 
 class UClass* ASFXWeapon_IncisorSniperRifle_CER_02::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_CER_02.SFXWeapon_IncisorSniperRifle_CER_02" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameContentDLC_CER_02.SFXDamageType_IncisorSniperRifle_CER_02",
+	L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_ArmMeleeBonus",
+	L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_ArmShieldBonus",
+	L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_ArmWeaponDmgBonus",
+	L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_HealthBonus",
+	L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_HelmetHeadShotBonus",
+	L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_HelmetShieldBonus",
+	L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_HelmetWeaponDmgBonus",
+	L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_LegHvyAmmoBonus",
+	L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_LegShieldBonus",
+	L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_ShoulderMeleeBonus",
+	L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_ShoulderShieldBonus",
+	L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_TorsoMeleeBonus",
+	L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_TorsoShieldBonus",
+	L"Class SFXGameContentDLC_CER_02.SFXGameEffect_Gear_CER02_TorsoWeaponDmgBonus",
+	L"Class SFXGameContentDLC_CER_02.SFXWeapon_IncisorSniperRifle_CER_02",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
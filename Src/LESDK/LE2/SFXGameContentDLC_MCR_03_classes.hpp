@@ -47,7 +47,7 @@ class USFXGameEffect_Gear_InfernoNegotiationBonus_MCR_03 : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -61,7 +61,7 @@ class USFXGameEffect_Gear_InfernoPowerDamage_MCR_03 : public USFXGameEffect_Powe
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -75,7 +75,7 @@ class USFXGameEffect_Gear_InfernoStormSpeed_MCR_03 : public USFXGameEffect_Passi
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -89,7 +89,7 @@ class USFXGameEffect_Gear_MCR_03 : public USFXGameEffect_PassiveShieldRegenBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -103,7 +103,7 @@ class USFXGameEffect_Gear_MCR_05 : public USFXGameEffect_PowerCooldownModifier
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
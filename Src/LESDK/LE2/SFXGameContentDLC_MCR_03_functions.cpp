@@ -28,66 +28,70 @@
 
 
 
-class UClass* USFXGameEffect_Gear_InfernoNegotiationBonus_MCR_03::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_InfernoNegotiationBonus_MCR_03::pClassPointer { L"Class SFXGameContentDLC_MCR_03.SFXGameEffect_Gear_InfernoNegotiationBonus_MCR_03", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_InfernoNegotiationBonus_MCR_03::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_MCR_03.SFXGameEffect_Gear_InfernoNegotiationBonus_MCR_03" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_InfernoPowerDamage_MCR_03::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_InfernoPowerDamage_MCR_03::pClassPointer { L"Class SFXGameContentDLC_MCR_03.SFXGameEffect_Gear_InfernoPowerDamage_MCR_03", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_InfernoPowerDamage_MCR_03::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_MCR_03.SFXGameEffect_Gear_InfernoPowerDamage_MCR_03" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_InfernoStormSpeed_MCR_03::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_InfernoStormSpeed_MCR_03::pClassPointer { L"Class SFXGameContentDLC_MCR_03.SFXGameEffect_Gear_InfernoStormSpeed_MCR_03", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_InfernoStormSpeed_MCR_03::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_MCR_03.SFXGameEffect_Gear_InfernoStormSpeed_MCR_03" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_MCR_03::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_MCR_03::pClassPointer { L"Class SFXGameContentDLC_MCR_03.SFXGameEffect_Gear_MCR_03", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_MCR_03::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_MCR_03.SFXGameEffect_Gear_MCR_03" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_MCR_05::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_MCR_05::pClassPointer { L"Class SFXGameContentDLC_MCR_03.SFXGameEffect_Gear_MCR_05", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_MCR_05::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_MCR_03.SFXGameEffect_Gear_MCR_05" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameContentDLC_MCR_03.SFXGameEffect_Gear_InfernoNegotiationBonus_MCR_03",
+	L"Class SFXGameContentDLC_MCR_03.SFXGameEffect_Gear_InfernoPowerDamage_MCR_03",
+	L"Class SFXGameContentDLC_MCR_03.SFXGameEffect_Gear_InfernoStormSpeed_MCR_03",
+	L"Class SFXGameContentDLC_MCR_03.SFXGameEffect_Gear_MCR_03",
+	L"Class SFXGameContentDLC_MCR_03.SFXGameEffect_Gear_MCR_05",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -47,7 +47,7 @@ class USFXGameEffect_Gear_DA_PowerBonus : public USFXGameEffect_PowerDamageBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -61,7 +61,7 @@ class USFXGameEffect_Gear_DA_ShieldBonus : public USFXGameEffect_PassiveShieldBo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28,30 +28,40 @@
 
 
 
-class UClass* USFXGameEffect_Gear_DA_PowerBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_DA_PowerBonus::pClassPointer { L"Class SFXGameContentDLC_PRE_DA.SFXGameEffect_Gear_DA_PowerBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_DA_PowerBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_PRE_DA.SFXGameEffect_Gear_DA_PowerBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_DA_ShieldBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_DA_ShieldBonus::pClassPointer { L"Class SFXGameContentDLC_PRE_DA.SFXGameEffect_Gear_DA_ShieldBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_DA_ShieldBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_PRE_DA.SFXGameEffect_Gear_DA_ShieldBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameContentDLC_PRE_DA.SFXGameEffect_Gear_DA_PowerBonus",
+	L"Class SFXGameContentDLC_PRE_DA.SFXGameEffect_Gear_DA_ShieldBonus",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
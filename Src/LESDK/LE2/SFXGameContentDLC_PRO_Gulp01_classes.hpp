@@ -47,7 +47,7 @@ class USFXGameEffect_Gear_GulpHelmet : public USFXGameEffect_PassiveShieldBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
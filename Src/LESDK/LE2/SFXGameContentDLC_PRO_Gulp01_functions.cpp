@@ -28,18 +28,30 @@
 
 
 
-class UClass* USFXGameEffect_Gear_GulpHelmet::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_GulpHelmet::pClassPointer { L"Class SFXGameContentDLC_PRO_Gulp01.SFXGameEffect_Gear_GulpHelmet", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_GulpHelmet::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_PRO_Gulp01.SFXGameEffect_Gear_GulpHelmet" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameContentDLC_PRO_Gulp01.SFXGameEffect_Gear_GulpHelmet",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
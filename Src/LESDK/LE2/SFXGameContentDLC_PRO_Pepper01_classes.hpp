@@ -47,7 +47,7 @@ class USFXGameEffect_Gear_Pepper01Helmet : public USFXGameEffect_PowerDamageBonu
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -47,7 +47,7 @@ class USFXGameEffect_Gear_Pepper02Helmet : public USFXGameEffect_PassiveWeaponDa
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
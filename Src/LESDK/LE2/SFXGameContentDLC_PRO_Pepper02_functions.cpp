@@ -28,18 +28,30 @@
 
 
 
-class UClass* USFXGameEffect_Gear_Pepper02Helmet::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_Pepper02Helmet::pClassPointer { L"Class SFXGameContentDLC_PRO_Pepper02.SFXGameEffect_Gear_Pepper02Helmet", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_Pepper02Helmet::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_PRO_Pepper02.SFXGameEffect_Gear_Pepper02Helmet" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameContentDLC_PRO_Pepper02.SFXGameEffect_Gear_Pepper02Helmet",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -48,7 +48,7 @@ public:
 	int                                                MapLayoutOverride;                                		// 0x00AC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -64,7 +64,7 @@ public:
 	unsigned long                                      bIgnoreMapLayoutEnum : 1;                         		// 0x0148 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -79,7 +79,7 @@ class USFXSFHandler_AreaMapEx : public USFXSFHandler_AreaMap
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -95,7 +95,7 @@ class USFXSFHandler_PCAreaMapEx : public USFXSFHandler_AreaMapEx
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28,26 +28,20 @@
 
 
 
-class UClass* USFXAreaMapDataEx::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXAreaMapDataEx::pClassPointer { L"Class SFXGameContentDLC_UNC_01_AreaMap.SFXAreaMapDataEx", &UObject::FindClass };
 
 class UClass* USFXAreaMapDataEx::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_UNC_01_AreaMap.SFXAreaMapDataEx" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXSeqAct_SetAreaMapEx::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_SetAreaMapEx::pClassPointer { L"Class SFXGameContentDLC_UNC_01_AreaMap.SFXSeqAct_SetAreaMapEx", &UObject::FindClass };
 
 class UClass* USFXSeqAct_SetAreaMapEx::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_UNC_01_AreaMap.SFXSeqAct_SetAreaMapEx" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentDLC_UNC_01_AreaMap.SFXSeqAct_SetAreaMapEx.Activated
@@ -56,10 +50,9 @@ class UClass* USFXSeqAct_SetAreaMapEx::StaticClass()
 
 void USFXSeqAct_SetAreaMapEx::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentDLC_UNC_01_AreaMap.SFXSeqAct_SetAreaMapEx.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentDLC_UNC_01_AreaMap.SFXSeqAct_SetAreaMapEx.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_SetAreaMapEx_execActivated_Parms Activated_Parms;
 
@@ -68,14 +61,11 @@ void USFXSeqAct_SetAreaMapEx::Activated ( )
 
 
 
-class UClass* USFXSFHandler_AreaMapEx::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSFHandler_AreaMapEx::pClassPointer { L"Class SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_AreaMapEx", &UObject::FindClass };
 
 class UClass* USFXSFHandler_AreaMapEx::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_AreaMapEx" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_AreaMapEx.SetMap
@@ -85,10 +75,9 @@ class UClass* USFXSFHandler_AreaMapEx::StaticClass()
 
 void USFXSFHandler_AreaMapEx::SetMap ( class USFXAreaMapData* oMapData )
 {
-	static UFunction* pFnSetMap = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetMapRef { L"Function SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_AreaMapEx.SetMap", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetMap )
-		pFnSetMap = UObject::FindObject< UFunction > ( L"Function SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_AreaMapEx.SetMap" );
+	UFunction* const pFnSetMap = pFnSetMapRef.Get ( );
 
 	USFXSFHandler_AreaMapEx_execSetMap_Parms SetMap_Parms;
 	SetMap_Parms.oMapData = oMapData;
@@ -103,10 +92,9 @@ void USFXSFHandler_AreaMapEx::SetMap ( class USFXAreaMapData* oMapData )
 
 void USFXSFHandler_AreaMapEx::ProcessPlayer ( class USFXAreaMapData* oMapData )
 {
-	static UFunction* pFnProcessPlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnProcessPlayerRef { L"Function SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_AreaMapEx.ProcessPlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnProcessPlayer )
-		pFnProcessPlayer = UObject::FindObject< UFunction > ( L"Function SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_AreaMapEx.ProcessPlayer" );
+	UFunction* const pFnProcessPlayer = pFnProcessPlayerRef.Get ( );
 
 	USFXSFHandler_AreaMapEx_execProcessPlayer_Parms ProcessPlayer_Parms;
 	ProcessPlayer_Parms.oMapData = oMapData;
@@ -116,14 +104,11 @@ void USFXSFHandler_AreaMapEx::ProcessPlayer ( class USFXAreaMapData* oMapData )
 
 
 
-class UClass* USFXSFHandler_PCAreaMapEx::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSFHandler_PCAreaMapEx::pClassPointer { L"Class SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_PCAreaMapEx", &UObject::FindClass };
 
 class UClass* USFXSFHandler_PCAreaMapEx::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_PCAreaMapEx" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_PCAreaMapEx.OnPanelAdded
@@ -132,10 +117,9 @@ class UClass* USFXSFHandler_PCAreaMapEx::StaticClass()
 
 void USFXSFHandler_PCAreaMapEx::OnPanelAdded ( )
 {
-	static UFunction* pFnOnPanelAdded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPanelAddedRef { L"Function SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_PCAreaMapEx.OnPanelAdded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPanelAdded )
-		pFnOnPanelAdded = UObject::FindObject< UFunction > ( L"Function SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_PCAreaMapEx.OnPanelAdded" );
+	UFunction* const pFnOnPanelAdded = pFnOnPanelAddedRef.Get ( );
 
 	USFXSFHandler_PCAreaMapEx_execOnPanelAdded_Parms OnPanelAdded_Parms;
 
@@ -144,6 +128,28 @@ void USFXSFHandler_PCAreaMapEx::OnPanelAdded ( )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameContentDLC_UNC_01_AreaMap.SFXAreaMapDataEx",
+	L"Class SFXGameContentDLC_UNC_01_AreaMap.SFXSeqAct_SetAreaMapEx",
+	L"Function SFXGameContentDLC_UNC_01_AreaMap.SFXSeqAct_SetAreaMapEx.Activated",
+	L"Class SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_AreaMapEx",
+	L"Function SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_AreaMapEx.SetMap",
+	L"Function SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_AreaMapEx.ProcessPlayer",
+	L"Class SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_PCAreaMapEx",
+	L"Function SFXGameContentDLC_UNC_01_AreaMap.SFXSFHandler_PCAreaMapEx.OnPanelAdded",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -48,7 +48,7 @@ public:
 	class ABioWorldInfo*                               BWI;                                              		// 0x0110 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28,14 +28,11 @@
 
 
 
-class UClass* USFXSeqAct_LegacyDataCallbackPatch03::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_LegacyDataCallbackPatch03::pClassPointer { L"Class SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03", &UObject::FindClass };
 
 class UClass* USFXSeqAct_LegacyDataCallbackPatch03::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.GetObjClassVersion
@@ -45,10 +42,9 @@ class UClass* USFXSeqAct_LegacyDataCallbackPatch03::StaticClass()
 
 int USFXSeqAct_LegacyDataCallbackPatch03::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USFXSeqAct_LegacyDataCallbackPatch03_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -63,10 +59,9 @@ int USFXSeqAct_LegacyDataCallbackPatch03::eventGetObjClassVersion ( )
 
 void USFXSeqAct_LegacyDataCallbackPatch03::ApplyCanonPlotStates ( )
 {
-	static UFunction* pFnApplyCanonPlotStates = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyCanonPlotStatesRef { L"Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.ApplyCanonPlotStates", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyCanonPlotStates )
-		pFnApplyCanonPlotStates = UObject::FindObject< UFunction > ( L"Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.ApplyCanonPlotStates" );
+	UFunction* const pFnApplyCanonPlotStates = pFnApplyCanonPlotStatesRef.Get ( );
 
 	USFXSeqAct_LegacyDataCallbackPatch03_execApplyCanonPlotStates_Parms ApplyCanonPlotStates_Parms;
 
@@ -79,10 +74,9 @@ void USFXSeqAct_LegacyDataCallbackPatch03::ApplyCanonPlotStates ( )
 
 void USFXSeqAct_LegacyDataCallbackPatch03::ME2ImportPlotState ( )
 {
-	static UFunction* pFnME2ImportPlotState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnME2ImportPlotStateRef { L"Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.ME2ImportPlotState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnME2ImportPlotState )
-		pFnME2ImportPlotState = UObject::FindObject< UFunction > ( L"Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.ME2ImportPlotState" );
+	UFunction* const pFnME2ImportPlotState = pFnME2ImportPlotStateRef.Get ( );
 
 	USFXSeqAct_LegacyDataCallbackPatch03_execME2ImportPlotState_Parms ME2ImportPlotState_Parms;
 
@@ -97,10 +91,9 @@ void USFXSeqAct_LegacyDataCallbackPatch03::ME2ImportPlotState ( )
 
 bool USFXSeqAct_LegacyDataCallbackPatch03::eventUpdateOp ( float DeltaTime )
 {
-	static UFunction* pFnUpdateOp = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdateOpRef { L"Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.UpdateOp", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdateOp )
-		pFnUpdateOp = UObject::FindObject< UFunction > ( L"Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.UpdateOp" );
+	UFunction* const pFnUpdateOp = pFnUpdateOpRef.Get ( );
 
 	USFXSeqAct_LegacyDataCallbackPatch03_eventUpdateOp_Parms UpdateOp_Parms;
 	UpdateOp_Parms.DeltaTime = DeltaTime;
@@ -116,10 +109,9 @@ bool USFXSeqAct_LegacyDataCallbackPatch03::eventUpdateOp ( float DeltaTime )
 
 void USFXSeqAct_LegacyDataCallbackPatch03::eventActivated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_LegacyDataCallbackPatch03_eventActivated_Parms Activated_Parms;
 
@@ -128,6 +120,26 @@ void USFXSeqAct_LegacyDataCallbackPatch03::eventActivated ( )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03",
+	L"Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.GetObjClassVersion",
+	L"Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.ApplyCanonPlotStates",
+	L"Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.ME2ImportPlotState",
+	L"Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.UpdateOp",
+	L"Function SFXGameContentDLC_UPD_Patch03.SFXSeqAct_LegacyDataCallbackPatch03.Activated",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -48,7 +48,7 @@ public:
 	class USFXGameEffect*                              PassiveWeaponDmg;                                 		// 0x0094 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -64,7 +64,7 @@ class USFXGameEffect_AchievementPartyHealthBonus : public USFXGameEffect_Passive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -78,7 +78,7 @@ class USFXGameEffect_UnlockPower : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -92,7 +92,7 @@ class USFXGameEffect_UnlockPower_Garrus : public USFXGameEffect_UnlockPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -106,7 +106,7 @@ class USFXGameEffect_UnlockPower_Grunt : public USFXGameEffect_UnlockPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -120,7 +120,7 @@ class USFXGameEffect_UnlockPower_Jack : public USFXGameEffect_UnlockPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -134,7 +134,7 @@ class USFXGameEffect_UnlockPower_Jacob : public USFXGameEffect_UnlockPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -148,7 +148,7 @@ class USFXGameEffect_UnlockPower_Legion : public USFXGameEffect_UnlockPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -162,7 +162,7 @@ class USFXGameEffect_UnlockPower_Miranda : public USFXGameEffect_UnlockPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -176,7 +176,7 @@ class USFXGameEffect_UnlockPower_Mordin : public USFXGameEffect_UnlockPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -190,7 +190,7 @@ class USFXGameEffect_UnlockPower_Samara : public USFXGameEffect_UnlockPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -204,7 +204,7 @@ class USFXGameEffect_UnlockPower_Tali : public USFXGameEffect_UnlockPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -218,7 +218,7 @@ class USFXGameEffect_UnlockPower_Thane : public USFXGameEffect_UnlockPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
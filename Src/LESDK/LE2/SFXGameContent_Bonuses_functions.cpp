@@ -28,14 +28,11 @@
 
 
 
-class UClass* USFXGameEffect_AchievementPartyDamageBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_AchievementPartyDamageBonus::pClassPointer { L"Class SFXGameContent_Bonuses.SFXGameEffect_AchievementPartyDamageBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_AchievementPartyDamageBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Bonuses.SFXGameEffect_AchievementPartyDamageBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Bonuses.SFXGameEffect_AchievementPartyDamageBonus.OnRemoved
@@ -44,10 +41,9 @@ class UClass* USFXGameEffect_AchievementPartyDamageBonus::StaticClass()
 
 void USFXGameEffect_AchievementPartyDamageBonus::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent_Bonuses.SFXGameEffect_AchievementPartyDamageBonus.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Bonuses.SFXGameEffect_AchievementPartyDamageBonus.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_AchievementPartyDamageBonus_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -60,10 +56,9 @@ void USFXGameEffect_AchievementPartyDamageBonus::OnRemoved ( )
 
 void USFXGameEffect_AchievementPartyDamageBonus::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent_Bonuses.SFXGameEffect_AchievementPartyDamageBonus.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Bonuses.SFXGameEffect_AchievementPartyDamageBonus.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_AchievementPartyDamageBonus_execOnApplied_Parms OnApplied_Parms;
 
@@ -72,150 +67,143 @@ void USFXGameEffect_AchievementPartyDamageBonus::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_AchievementPartyHealthBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_AchievementPartyHealthBonus::pClassPointer { L"Class SFXGameContent_Bonuses.SFXGameEffect_AchievementPartyHealthBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_AchievementPartyHealthBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Bonuses.SFXGameEffect_AchievementPartyHealthBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_UnlockPower::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_UnlockPower::pClassPointer { L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower", &UObject::FindClass };
 
 class UClass* USFXGameEffect_UnlockPower::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_UnlockPower_Garrus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_UnlockPower_Garrus::pClassPointer { L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Garrus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_UnlockPower_Garrus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Garrus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_UnlockPower_Grunt::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_UnlockPower_Grunt::pClassPointer { L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Grunt", &UObject::FindClass };
 
 class UClass* USFXGameEffect_UnlockPower_Grunt::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Grunt" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_UnlockPower_Jack::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_UnlockPower_Jack::pClassPointer { L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Jack", &UObject::FindClass };
 
 class UClass* USFXGameEffect_UnlockPower_Jack::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Jack" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_UnlockPower_Jacob::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_UnlockPower_Jacob::pClassPointer { L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Jacob", &UObject::FindClass };
 
 class UClass* USFXGameEffect_UnlockPower_Jacob::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Jacob" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_UnlockPower_Legion::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_UnlockPower_Legion::pClassPointer { L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Legion", &UObject::FindClass };
 
 class UClass* USFXGameEffect_UnlockPower_Legion::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Legion" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_UnlockPower_Miranda::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_UnlockPower_Miranda::pClassPointer { L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Miranda", &UObject::FindClass };
 
 class UClass* USFXGameEffect_UnlockPower_Miranda::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Miranda" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_UnlockPower_Mordin::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_UnlockPower_Mordin::pClassPointer { L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Mordin", &UObject::FindClass };
 
 class UClass* USFXGameEffect_UnlockPower_Mordin::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Mordin" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_UnlockPower_Samara::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_UnlockPower_Samara::pClassPointer { L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Samara", &UObject::FindClass };
 
 class UClass* USFXGameEffect_UnlockPower_Samara::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Samara" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_UnlockPower_Tali::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_UnlockPower_Tali::pClassPointer { L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Tali", &UObject::FindClass };
 
 class UClass* USFXGameEffect_UnlockPower_Tali::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Tali" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_UnlockPower_Thane::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_UnlockPower_Thane::pClassPointer { L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Thane", &UObject::FindClass };
 
 class UClass* USFXGameEffect_UnlockPower_Thane::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Thane" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameContent_Bonuses.SFXGameEffect_AchievementPartyDamageBonus",
+	L"Function SFXGameContent_Bonuses.SFXGameEffect_AchievementPartyDamageBonus.OnRemoved",
+	L"Function SFXGameContent_Bonuses.SFXGameEffect_AchievementPartyDamageBonus.OnApplied",
+	L"Class SFXGameContent_Bonuses.SFXGameEffect_AchievementPartyHealthBonus",
+	L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower",
+	L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Garrus",
+	L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Grunt",
+	L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Jack",
+	L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Jacob",
+	L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Legion",
+	L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Miranda",
+	L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Mordin",
+	L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Samara",
+	L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Tali",
+	L"Class SFXGameContent_Bonuses.SFXGameEffect_UnlockPower_Thane",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -47,7 +47,7 @@ class ASFXWeapon_AutoPistol : public ASFXWeapon_AutoPistol_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -64,7 +64,7 @@ class ASFXWeapon_SMG : public ASFXWeapon_AutoPistol
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -83,7 +83,7 @@ public:
 	unsigned long                                      bPlayingMuzzleFlashEffect : 1;                    		// 0x0978 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -105,7 +105,7 @@ class ASFXWeapon_Needler : public ASFXWeapon_AssaultRifle
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -125,7 +125,7 @@ public:
 	float                                              StartTraceAdjustDist;                             		// 0x0988 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -146,7 +146,7 @@ class ASFXWeapon_HeavyShotgun : public ASFXWeapon_Shotgun
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -163,7 +163,7 @@ class USFXDamageType_AutoPistol : public USFXDamageType_Weapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -177,7 +177,7 @@ class USFXDamageType_SMG : public USFXDamageType_AutoPistol
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -191,7 +191,7 @@ class USFXDamageType_AssaultRifle : public USFXDamageType_Weapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -205,7 +205,7 @@ class USFXDamageType_Needler : public USFXDamageType_AssaultRifle
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -219,7 +219,7 @@ class USFXDamageType_Shotgun : public USFXDamageType_Weapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -233,7 +233,7 @@ class USFXDamageType_HeavyShotgun : public USFXDamageType_Shotgun
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -247,7 +247,7 @@ class USFXDamageType_SniperRifle : public USFXDamageType_Weapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -263,7 +263,7 @@ public:
 	class UWwiseEvent*                                 DeActivateSniperZoomWwiseEvent;                   		// 0x097C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -281,7 +281,7 @@ class USFXDamageType_HeavyPistol : public USFXDamageType_Weapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -295,7 +295,7 @@ class ASFXWeapon_HeavyPistol : public ASFXWeapon_HeavyPistol_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -312,7 +312,7 @@ class USFXDamageType_HeavyWeapon : public USFXDamageType_Weapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -326,7 +326,7 @@ class USFXDamageType_Grenade : public USFXDamageType_HeavyWeapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -340,7 +340,7 @@ class ASFXHeavyWeapon_GrenadeLauncher : public ASFXHeavyWeapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -358,7 +358,7 @@ public:
 	float                                              MaxAngleChange;                                   		// 0x0428 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -377,7 +377,7 @@ class USFXDamageType_MissileLauncher : public USFXDamageType_HeavyWeapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -391,7 +391,7 @@ class USFXDamageType_Rocket : public USFXDamageType_Grenade
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -406,7 +406,7 @@ public:
 	class AActor*                                      CurrentTarget;                                    		// 0x0974 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -433,7 +433,7 @@ public:
 	unsigned long                                      bExplodeNextFrame : 1;                            		// 0x04D0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -457,7 +457,7 @@ class ASFXHeavyWeapon_RocketLauncher : public ASFXHeavyWeapon_MissileLauncher
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -473,7 +473,7 @@ public:
 	class UWwiseEvent*                                 ImpactSound0;                                     		// 0x049C (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28,14 +28,11 @@
 
 
 
-class UClass* ASFXWeapon_SMG::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_SMG::pClassPointer { L"Class SFXGameContent_Inventory.SFXWeapon_SMG", &UObject::FindClass };
 
 class UClass* ASFXWeapon_SMG::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXWeapon_SMG" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Inventory.SFXWeapon_SMG.GetWeaponSpecificImpactSound
@@ -46,10 +43,9 @@ class UClass* ASFXWeapon_SMG::StaticClass()
 
 class UWwiseEvent* ASFXWeapon_SMG::GetWeaponSpecificImpactSound ( class USFXPhysicalMaterialImpactSounds* ImpactSounds )
 {
-	static UFunction* pFnGetWeaponSpecificImpactSound = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactSoundRef { L"Function SFXGameContent_Inventory.SFXWeapon_SMG.GetWeaponSpecificImpactSound", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactSound )
-		pFnGetWeaponSpecificImpactSound = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_SMG.GetWeaponSpecificImpactSound" );
+	UFunction* const pFnGetWeaponSpecificImpactSound = pFnGetWeaponSpecificImpactSoundRef.Get ( );
 
 	ASFXWeapon_SMG_execGetWeaponSpecificImpactSound_Parms GetWeaponSpecificImpactSound_Parms;
 	GetWeaponSpecificImpactSound_Parms.ImpactSounds = ImpactSounds;
@@ -67,10 +63,9 @@ class UWwiseEvent* ASFXWeapon_SMG::GetWeaponSpecificImpactSound ( class USFXPhys
 
 class UParticleSystem* ASFXWeapon_SMG::GetWeaponSpecificImpactEffect ( class USFXPhysicalMaterialImpactEffects* ImpactEffects )
 {
-	static UFunction* pFnGetWeaponSpecificImpactEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactEffectRef { L"Function SFXGameContent_Inventory.SFXWeapon_SMG.GetWeaponSpecificImpactEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactEffect )
-		pFnGetWeaponSpecificImpactEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_SMG.GetWeaponSpecificImpactEffect" );
+	UFunction* const pFnGetWeaponSpecificImpactEffect = pFnGetWeaponSpecificImpactEffectRef.Get ( );
 
 	ASFXWeapon_SMG_execGetWeaponSpecificImpactEffect_Parms GetWeaponSpecificImpactEffect_Parms;
 	GetWeaponSpecificImpactEffect_Parms.ImpactEffects = ImpactEffects;
@@ -89,10 +84,9 @@ class UParticleSystem* ASFXWeapon_SMG::GetWeaponSpecificImpactEffect ( class USF
 
 class UDecalComponent* ASFXWeapon_SMG::GetWeaponSpecificDecalData ( class USFXPhysicalMaterialDecals* DecalEffects, float* FadeTime )
 {
-	static UFunction* pFnGetWeaponSpecificDecalData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificDecalDataRef { L"Function SFXGameContent_Inventory.SFXWeapon_SMG.GetWeaponSpecificDecalData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificDecalData )
-		pFnGetWeaponSpecificDecalData = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_SMG.GetWeaponSpecificDecalData" );
+	UFunction* const pFnGetWeaponSpecificDecalData = pFnGetWeaponSpecificDecalDataRef.Get ( );
 
 	ASFXWeapon_SMG_execGetWeaponSpecificDecalData_Parms GetWeaponSpecificDecalData_Parms;
 	GetWeaponSpecificDecalData_Parms.DecalEffects = DecalEffects;
@@ -110,14 +104,11 @@ class UDecalComponent* ASFXWeapon_SMG::GetWeaponSpecificDecalData ( class USFXPh
 
 
 
-class UClass* ASFXWeapon_Needler::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_Needler::pClassPointer { L"Class SFXGameContent_Inventory.SFXWeapon_Needler", &UObject::FindClass };
 
 class UClass* ASFXWeapon_Needler::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXWeapon_Needler" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Inventory.SFXWeapon_Needler.GetWeaponSpecificImpactSound
@@ -128,10 +119,9 @@ class UClass* ASFXWeapon_Needler::StaticClass()
 
 class UWwiseEvent* ASFXWeapon_Needler::GetWeaponSpecificImpactSound ( class USFXPhysicalMaterialImpactSounds* ImpactSounds )
 {
-	static UFunction* pFnGetWeaponSpecificImpactSound = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactSoundRef { L"Function SFXGameContent_Inventory.SFXWeapon_Needler.GetWeaponSpecificImpactSound", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactSound )
-		pFnGetWeaponSpecificImpactSound = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_Needler.GetWeaponSpecificImpactSound" );
+	UFunction* const pFnGetWeaponSpecificImpactSound = pFnGetWeaponSpecificImpactSoundRef.Get ( );
 
 	ASFXWeapon_Needler_execGetWeaponSpecificImpactSound_Parms GetWeaponSpecificImpactSound_Parms;
 	GetWeaponSpecificImpactSound_Parms.ImpactSounds = ImpactSounds;
@@ -149,10 +139,9 @@ class UWwiseEvent* ASFXWeapon_Needler::GetWeaponSpecificImpactSound ( class USFX
 
 class UParticleSystem* ASFXWeapon_Needler::GetWeaponSpecificImpactEffect ( class USFXPhysicalMaterialImpactEffects* ImpactEffects )
 {
-	static UFunction* pFnGetWeaponSpecificImpactEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactEffectRef { L"Function SFXGameContent_Inventory.SFXWeapon_Needler.GetWeaponSpecificImpactEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactEffect )
-		pFnGetWeaponSpecificImpactEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_Needler.GetWeaponSpecificImpactEffect" );
+	UFunction* const pFnGetWeaponSpecificImpactEffect = pFnGetWeaponSpecificImpactEffectRef.Get ( );
 
 	ASFXWeapon_Needler_execGetWeaponSpecificImpactEffect_Parms GetWeaponSpecificImpactEffect_Parms;
 	GetWeaponSpecificImpactEffect_Parms.ImpactEffects = ImpactEffects;
@@ -171,10 +160,9 @@ class UParticleSystem* ASFXWeapon_Needler::GetWeaponSpecificImpactEffect ( class
 
 class UDecalComponent* ASFXWeapon_Needler::GetWeaponSpecificDecalData ( class USFXPhysicalMaterialDecals* DecalEffects, float* FadeTime )
 {
-	static UFunction* pFnGetWeaponSpecificDecalData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificDecalDataRef { L"Function SFXGameContent_Inventory.SFXWeapon_Needler.GetWeaponSpecificDecalData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificDecalData )
-		pFnGetWeaponSpecificDecalData = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_Needler.GetWeaponSpecificDecalData" );
+	UFunction* const pFnGetWeaponSpecificDecalData = pFnGetWeaponSpecificDecalDataRef.Get ( );
 
 	ASFXWeapon_Needler_execGetWeaponSpecificDecalData_Parms GetWeaponSpecificDecalData_Parms;
 	GetWeaponSpecificDecalData_Parms.DecalEffects = DecalEffects;
@@ -192,14 +180,11 @@ class UDecalComponent* ASFXWeapon_Needler::GetWeaponSpecificDecalData ( class US
 
 
 
-class UClass* ASFXWeapon_HeavyShotgun::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_HeavyShotgun::pClassPointer { L"Class SFXGameContent_Inventory.SFXWeapon_HeavyShotgun", &UObject::FindClass };
 
 class UClass* ASFXWeapon_HeavyShotgun::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXWeapon_HeavyShotgun" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Inventory.SFXWeapon_HeavyShotgun.GetWeaponSpecificImpactSound
@@ -210,10 +195,9 @@ class UClass* ASFXWeapon_HeavyShotgun::StaticClass()
 
 class UWwiseEvent* ASFXWeapon_HeavyShotgun::GetWeaponSpecificImpactSound ( class USFXPhysicalMaterialImpactSounds* ImpactSounds )
 {
-	static UFunction* pFnGetWeaponSpecificImpactSound = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactSoundRef { L"Function SFXGameContent_Inventory.SFXWeapon_HeavyShotgun.GetWeaponSpecificImpactSound", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactSound )
-		pFnGetWeaponSpecificImpactSound = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_HeavyShotgun.GetWeaponSpecificImpactSound" );
+	UFunction* const pFnGetWeaponSpecificImpactSound = pFnGetWeaponSpecificImpactSoundRef.Get ( );
 
 	ASFXWeapon_HeavyShotgun_execGetWeaponSpecificImpactSound_Parms GetWeaponSpecificImpactSound_Parms;
 	GetWeaponSpecificImpactSound_Parms.ImpactSounds = ImpactSounds;
@@ -231,10 +215,9 @@ class UWwiseEvent* ASFXWeapon_HeavyShotgun::GetWeaponSpecificImpactSound ( class
 
 class UParticleSystem* ASFXWeapon_HeavyShotgun::GetWeaponSpecificImpactEffect ( class USFXPhysicalMaterialImpactEffects* ImpactEffects )
 {
-	static UFunction* pFnGetWeaponSpecificImpactEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactEffectRef { L"Function SFXGameContent_Inventory.SFXWeapon_HeavyShotgun.GetWeaponSpecificImpactEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactEffect )
-		pFnGetWeaponSpecificImpactEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_HeavyShotgun.GetWeaponSpecificImpactEffect" );
+	UFunction* const pFnGetWeaponSpecificImpactEffect = pFnGetWeaponSpecificImpactEffectRef.Get ( );
 
 	ASFXWeapon_HeavyShotgun_execGetWeaponSpecificImpactEffect_Parms GetWeaponSpecificImpactEffect_Parms;
 	GetWeaponSpecificImpactEffect_Parms.ImpactEffects = ImpactEffects;
@@ -253,10 +236,9 @@ class UParticleSystem* ASFXWeapon_HeavyShotgun::GetWeaponSpecificImpactEffect (
 
 class UDecalComponent* ASFXWeapon_HeavyShotgun::GetWeaponSpecificDecalData ( class USFXPhysicalMaterialDecals* DecalEffects, float* FadeTime )
 {
-	static UFunction* pFnGetWeaponSpecificDecalData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificDecalDataRef { L"Function SFXGameContent_Inventory.SFXWeapon_HeavyShotgun.GetWeaponSpecificDecalData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificDecalData )
-		pFnGetWeaponSpecificDecalData = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_HeavyShotgun.GetWeaponSpecificDecalData" );
+	UFunction* const pFnGetWeaponSpecificDecalData = pFnGetWeaponSpecificDecalDataRef.Get ( );
 
 	ASFXWeapon_HeavyShotgun_execGetWeaponSpecificDecalData_Parms GetWeaponSpecificDecalData_Parms;
 	GetWeaponSpecificDecalData_Parms.DecalEffects = DecalEffects;
@@ -274,14 +256,11 @@ class UDecalComponent* ASFXWeapon_HeavyShotgun::GetWeaponSpecificDecalData ( cla
 
 
 
-class UClass* ASFXWeapon_Shotgun::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_Shotgun::pClassPointer { L"Class SFXGameContent_Inventory.SFXWeapon_Shotgun", &UObject::FindClass };
 
 class UClass* ASFXWeapon_Shotgun::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXWeapon_Shotgun" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Inventory.SFXWeapon_Shotgun.GetWeaponSpecificImpactSound
@@ -292,10 +271,9 @@ class UClass* ASFXWeapon_Shotgun::StaticClass()
 
 class UWwiseEvent* ASFXWeapon_Shotgun::GetWeaponSpecificImpactSound ( class USFXPhysicalMaterialImpactSounds* ImpactSounds )
 {
-	static UFunction* pFnGetWeaponSpecificImpactSound = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactSoundRef { L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.GetWeaponSpecificImpactSound", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactSound )
-		pFnGetWeaponSpecificImpactSound = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.GetWeaponSpecificImpactSound" );
+	UFunction* const pFnGetWeaponSpecificImpactSound = pFnGetWeaponSpecificImpactSoundRef.Get ( );
 
 	ASFXWeapon_Shotgun_execGetWeaponSpecificImpactSound_Parms GetWeaponSpecificImpactSound_Parms;
 	GetWeaponSpecificImpactSound_Parms.ImpactSounds = ImpactSounds;
@@ -313,10 +291,9 @@ class UWwiseEvent* ASFXWeapon_Shotgun::GetWeaponSpecificImpactSound ( class USFX
 
 class UParticleSystem* ASFXWeapon_Shotgun::GetWeaponSpecificImpactEffect ( class USFXPhysicalMaterialImpactEffects* ImpactEffects )
 {
-	static UFunction* pFnGetWeaponSpecificImpactEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactEffectRef { L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.GetWeaponSpecificImpactEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactEffect )
-		pFnGetWeaponSpecificImpactEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.GetWeaponSpecificImpactEffect" );
+	UFunction* const pFnGetWeaponSpecificImpactEffect = pFnGetWeaponSpecificImpactEffectRef.Get ( );
 
 	ASFXWeapon_Shotgun_execGetWeaponSpecificImpactEffect_Parms GetWeaponSpecificImpactEffect_Parms;
 	GetWeaponSpecificImpactEffect_Parms.ImpactEffects = ImpactEffects;
@@ -335,10 +312,9 @@ class UParticleSystem* ASFXWeapon_Shotgun::GetWeaponSpecificImpactEffect ( class
 
 class UDecalComponent* ASFXWeapon_Shotgun::GetWeaponSpecificDecalData ( class USFXPhysicalMaterialDecals* DecalEffects, float* FadeTime )
 {
-	static UFunction* pFnGetWeaponSpecificDecalData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificDecalDataRef { L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.GetWeaponSpecificDecalData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificDecalData )
-		pFnGetWeaponSpecificDecalData = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.GetWeaponSpecificDecalData" );
+	UFunction* const pFnGetWeaponSpecificDecalData = pFnGetWeaponSpecificDecalDataRef.Get ( );
 
 	ASFXWeapon_Shotgun_execGetWeaponSpecificDecalData_Parms GetWeaponSpecificDecalData_Parms;
 	GetWeaponSpecificDecalData_Parms.DecalEffects = DecalEffects;
@@ -363,10 +339,9 @@ class UDecalComponent* ASFXWeapon_Shotgun::GetWeaponSpecificDecalData ( class US
 
 void ASFXWeapon_Shotgun::FirePellets ( struct FVector const& StartLocation, struct FRotator const& AimRotation, unsigned char FireMode )
 {
-	static UFunction* pFnFirePellets = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFirePelletsRef { L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.FirePellets", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFirePellets )
-		pFnFirePellets = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.FirePellets" );
+	UFunction* const pFnFirePellets = pFnFirePelletsRef.Get ( );
 
 	ASFXWeapon_Shotgun_execFirePellets_Parms FirePellets_Parms;
 	memcpy ( &FirePellets_Parms.StartLocation, &StartLocation, 0xC );
@@ -384,10 +359,9 @@ void ASFXWeapon_Shotgun::FirePellets ( struct FVector const& StartLocation, stru
 
 void ASFXWeapon_Shotgun::DrawDebugShotgunCone ( struct FVector const& StartLocation, struct FRotator const& AimRot )
 {
-	static UFunction* pFnDrawDebugShotgunCone = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDrawDebugShotgunConeRef { L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.DrawDebugShotgunCone", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDrawDebugShotgunCone )
-		pFnDrawDebugShotgunCone = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.DrawDebugShotgunCone" );
+	UFunction* const pFnDrawDebugShotgunCone = pFnDrawDebugShotgunConeRef.Get ( );
 
 	ASFXWeapon_Shotgun_execDrawDebugShotgunCone_Parms DrawDebugShotgunCone_Parms;
 	memcpy ( &DrawDebugShotgunCone_Parms.StartLocation, &StartLocation, 0xC );
@@ -402,10 +376,9 @@ void ASFXWeapon_Shotgun::DrawDebugShotgunCone ( struct FVector const& StartLocat
 
 void ASFXWeapon_Shotgun::CustomFire ( )
 {
-	static UFunction* pFnCustomFire = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCustomFireRef { L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.CustomFire", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCustomFire )
-		pFnCustomFire = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.CustomFire" );
+	UFunction* const pFnCustomFire = pFnCustomFireRef.Get ( );
 
 	ASFXWeapon_Shotgun_execCustomFire_Parms CustomFire_Parms;
 
@@ -419,10 +392,9 @@ void ASFXWeapon_Shotgun::CustomFire ( )
 
 bool ASFXWeapon_Shotgun::ShouldSpawnTracerFX ( )
 {
-	static UFunction* pFnShouldSpawnTracerFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldSpawnTracerFXRef { L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.ShouldSpawnTracerFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldSpawnTracerFX )
-		pFnShouldSpawnTracerFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.ShouldSpawnTracerFX" );
+	UFunction* const pFnShouldSpawnTracerFX = pFnShouldSpawnTracerFXRef.Get ( );
 
 	ASFXWeapon_Shotgun_execShouldSpawnTracerFX_Parms ShouldSpawnTracerFX_Parms;
 
@@ -433,14 +405,11 @@ bool ASFXWeapon_Shotgun::ShouldSpawnTracerFX ( )
 
 
 
-class UClass* ASFXWeapon_AutoPistol::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_AutoPistol::pClassPointer { L"Class SFXGameContent_Inventory.SFXWeapon_AutoPistol", &UObject::FindClass };
 
 class UClass* ASFXWeapon_AutoPistol::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXWeapon_AutoPistol" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Inventory.SFXWeapon_AutoPistol.GetWeaponSpecificImpactSound
@@ -451,10 +420,9 @@ class UClass* ASFXWeapon_AutoPistol::StaticClass()
 
 class UWwiseEvent* ASFXWeapon_AutoPistol::GetWeaponSpecificImpactSound ( class USFXPhysicalMaterialImpactSounds* ImpactSounds )
 {
-	static UFunction* pFnGetWeaponSpecificImpactSound = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactSoundRef { L"Function SFXGameContent_Inventory.SFXWeapon_AutoPistol.GetWeaponSpecificImpactSound", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactSound )
-		pFnGetWeaponSpecificImpactSound = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_AutoPistol.GetWeaponSpecificImpactSound" );
+	UFunction* const pFnGetWeaponSpecificImpactSound = pFnGetWeaponSpecificImpactSoundRef.Get ( );
 
 	ASFXWeapon_AutoPistol_execGetWeaponSpecificImpactSound_Parms GetWeaponSpecificImpactSound_Parms;
 	GetWeaponSpecificImpactSound_Parms.ImpactSounds = ImpactSounds;
@@ -472,10 +440,9 @@ class UWwiseEvent* ASFXWeapon_AutoPistol::GetWeaponSpecificImpactSound ( class U
 
 class UParticleSystem* ASFXWeapon_AutoPistol::GetWeaponSpecificImpactEffect ( class USFXPhysicalMaterialImpactEffects* ImpactEffects )
 {
-	static UFunction* pFnGetWeaponSpecificImpactEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactEffectRef { L"Function SFXGameContent_Inventory.SFXWeapon_AutoPistol.GetWeaponSpecificImpactEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactEffect )
-		pFnGetWeaponSpecificImpactEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_AutoPistol.GetWeaponSpecificImpactEffect" );
+	UFunction* const pFnGetWeaponSpecificImpactEffect = pFnGetWeaponSpecificImpactEffectRef.Get ( );
 
 	ASFXWeapon_AutoPistol_execGetWeaponSpecificImpactEffect_Parms GetWeaponSpecificImpactEffect_Parms;
 	GetWeaponSpecificImpactEffect_Parms.ImpactEffects = ImpactEffects;
@@ -494,10 +461,9 @@ class UParticleSystem* ASFXWeapon_AutoPistol::GetWeaponSpecificImpactEffect ( cl
 
 class UDecalComponent* ASFXWeapon_AutoPistol::GetWeaponSpecificDecalData ( class USFXPhysicalMaterialDecals* DecalEffects, float* FadeTime )
 {
-	static UFunction* pFnGetWeaponSpecificDecalData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificDecalDataRef { L"Function SFXGameContent_Inventory.SFXWeapon_AutoPistol.GetWeaponSpecificDecalData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificDecalData )
-		pFnGetWeaponSpecificDecalData = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_AutoPistol.GetWeaponSpecificDecalData" );
+	UFunction* const pFnGetWeaponSpecificDecalData = pFnGetWeaponSpecificDecalDataRef.Get ( );
 
 	ASFXWeapon_AutoPistol_execGetWeaponSpecificDecalData_Parms GetWeaponSpecificDecalData_Parms;
 	GetWeaponSpecificDecalData_Parms.DecalEffects = DecalEffects;
@@ -515,14 +481,11 @@ class UDecalComponent* ASFXWeapon_AutoPistol::GetWeaponSpecificDecalData ( class
 
 
 
-class UClass* ASFXWeapon_AssaultRifle::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_AssaultRifle::pClassPointer { L"Class SFXGameContent_Inventory.SFXWeapon_AssaultRifle", &UObject::FindClass };
 
 class UClass* ASFXWeapon_AssaultRifle::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXWeapon_AssaultRifle" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.GetWeaponAnimNodeSeq
@@ -532,10 +495,9 @@ class UClass* ASFXWeapon_AssaultRifle::StaticClass()
 
 class UAnimNodeSequence* ASFXWeapon_AssaultRifle::GetWeaponAnimNodeSeq ( )
 {
-	static UFunction* pFnGetWeaponAnimNodeSeq = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponAnimNodeSeqRef { L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.GetWeaponAnimNodeSeq", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponAnimNodeSeq )
-		pFnGetWeaponAnimNodeSeq = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.GetWeaponAnimNodeSeq" );
+	UFunction* const pFnGetWeaponAnimNodeSeq = pFnGetWeaponAnimNodeSeqRef.Get ( );
 
 	ASFXWeapon_AssaultRifle_execGetWeaponAnimNodeSeq_Parms GetWeaponAnimNodeSeq_Parms;
 
@@ -552,10 +514,9 @@ class UAnimNodeSequence* ASFXWeapon_AssaultRifle::GetWeaponAnimNodeSeq ( )
 
 class UWwiseEvent* ASFXWeapon_AssaultRifle::GetWeaponSpecificImpactSound ( class USFXPhysicalMaterialImpactSounds* ImpactSounds )
 {
-	static UFunction* pFnGetWeaponSpecificImpactSound = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactSoundRef { L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.GetWeaponSpecificImpactSound", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactSound )
-		pFnGetWeaponSpecificImpactSound = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.GetWeaponSpecificImpactSound" );
+	UFunction* const pFnGetWeaponSpecificImpactSound = pFnGetWeaponSpecificImpactSoundRef.Get ( );
 
 	ASFXWeapon_AssaultRifle_execGetWeaponSpecificImpactSound_Parms GetWeaponSpecificImpactSound_Parms;
 	GetWeaponSpecificImpactSound_Parms.ImpactSounds = ImpactSounds;
@@ -573,10 +534,9 @@ class UWwiseEvent* ASFXWeapon_AssaultRifle::GetWeaponSpecificImpactSound ( class
 
 class UParticleSystem* ASFXWeapon_AssaultRifle::GetWeaponSpecificImpactEffect ( class USFXPhysicalMaterialImpactEffects* ImpactEffects )
 {
-	static UFunction* pFnGetWeaponSpecificImpactEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactEffectRef { L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.GetWeaponSpecificImpactEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactEffect )
-		pFnGetWeaponSpecificImpactEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.GetWeaponSpecificImpactEffect" );
+	UFunction* const pFnGetWeaponSpecificImpactEffect = pFnGetWeaponSpecificImpactEffectRef.Get ( );
 
 	ASFXWeapon_AssaultRifle_execGetWeaponSpecificImpactEffect_Parms GetWeaponSpecificImpactEffect_Parms;
 	GetWeaponSpecificImpactEffect_Parms.ImpactEffects = ImpactEffects;
@@ -595,10 +555,9 @@ class UParticleSystem* ASFXWeapon_AssaultRifle::GetWeaponSpecificImpactEffect (
 
 class UDecalComponent* ASFXWeapon_AssaultRifle::GetWeaponSpecificDecalData ( class USFXPhysicalMaterialDecals* DecalEffects, float* FadeTime )
 {
-	static UFunction* pFnGetWeaponSpecificDecalData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificDecalDataRef { L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.GetWeaponSpecificDecalData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificDecalData )
-		pFnGetWeaponSpecificDecalData = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.GetWeaponSpecificDecalData" );
+	UFunction* const pFnGetWeaponSpecificDecalData = pFnGetWeaponSpecificDecalDataRef.Get ( );
 
 	ASFXWeapon_AssaultRifle_execGetWeaponSpecificDecalData_Parms GetWeaponSpecificDecalData_Parms;
 	GetWeaponSpecificDecalData_Parms.DecalEffects = DecalEffects;
@@ -620,10 +579,9 @@ class UDecalComponent* ASFXWeapon_AssaultRifle::GetWeaponSpecificDecalData ( cla
 
 void ASFXWeapon_AssaultRifle::StopMuzzleFlashEffect ( )
 {
-	static UFunction* pFnStopMuzzleFlashEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopMuzzleFlashEffectRef { L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.StopMuzzleFlashEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopMuzzleFlashEffect )
-		pFnStopMuzzleFlashEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.StopMuzzleFlashEffect" );
+	UFunction* const pFnStopMuzzleFlashEffect = pFnStopMuzzleFlashEffectRef.Get ( );
 
 	ASFXWeapon_AssaultRifle_execStopMuzzleFlashEffect_Parms StopMuzzleFlashEffect_Parms;
 
@@ -638,10 +596,9 @@ void ASFXWeapon_AssaultRifle::StopMuzzleFlashEffect ( )
 
 void ASFXWeapon_AssaultRifle::PlayFireEffects ( unsigned char FiringMode, struct FVector const& HitLocation )
 {
-	static UFunction* pFnPlayFireEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayFireEffectsRef { L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.PlayFireEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayFireEffects )
-		pFnPlayFireEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.PlayFireEffects" );
+	UFunction* const pFnPlayFireEffects = pFnPlayFireEffectsRef.Get ( );
 
 	ASFXWeapon_AssaultRifle_execPlayFireEffects_Parms PlayFireEffects_Parms;
 	PlayFireEffects_Parms.FiringMode = FiringMode;
@@ -656,10 +613,9 @@ void ASFXWeapon_AssaultRifle::PlayFireEffects ( unsigned char FiringMode, struct
 
 void ASFXWeapon_AssaultRifle::PlayMuzzleFlashEffect ( )
 {
-	static UFunction* pFnPlayMuzzleFlashEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayMuzzleFlashEffectRef { L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.PlayMuzzleFlashEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayMuzzleFlashEffect )
-		pFnPlayMuzzleFlashEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.PlayMuzzleFlashEffect" );
+	UFunction* const pFnPlayMuzzleFlashEffect = pFnPlayMuzzleFlashEffectRef.Get ( );
 
 	ASFXWeapon_AssaultRifle_execPlayMuzzleFlashEffect_Parms PlayMuzzleFlashEffect_Parms;
 
@@ -673,10 +629,9 @@ void ASFXWeapon_AssaultRifle::PlayMuzzleFlashEffect ( )
 
 bool ASFXWeapon_AssaultRifle::ShouldSpawnTracerFX ( )
 {
-	static UFunction* pFnShouldSpawnTracerFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldSpawnTracerFXRef { L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.ShouldSpawnTracerFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldSpawnTracerFX )
-		pFnShouldSpawnTracerFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.ShouldSpawnTracerFX" );
+	UFunction* const pFnShouldSpawnTracerFX = pFnShouldSpawnTracerFXRef.Get ( );
 
 	ASFXWeapon_AssaultRifle_execShouldSpawnTracerFX_Parms ShouldSpawnTracerFX_Parms;
 
@@ -687,98 +642,74 @@ bool ASFXWeapon_AssaultRifle::ShouldSpawnTracerFX ( )
 
 
 
-class UClass* USFXDamageType_SMG::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_SMG::pClassPointer { L"Class SFXGameContent_Inventory.SFXDamageType_SMG", &UObject::FindClass };
 
 class UClass* USFXDamageType_SMG::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXDamageType_SMG" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Needler::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Needler::pClassPointer { L"Class SFXGameContent_Inventory.SFXDamageType_Needler", &UObject::FindClass };
 
 class UClass* USFXDamageType_Needler::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXDamageType_Needler" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_HeavyShotgun::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_HeavyShotgun::pClassPointer { L"Class SFXGameContent_Inventory.SFXDamageType_HeavyShotgun", &UObject::FindClass };
 
 class UClass* USFXDamageType_HeavyShotgun::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXDamageType_HeavyShotgun" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Shotgun::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Shotgun::pClassPointer { L"Class SFXGameContent_Inventory.SFXDamageType_Shotgun", &UObject::FindClass };
 
 class UClass* USFXDamageType_Shotgun::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXDamageType_Shotgun" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_AutoPistol::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_AutoPistol::pClassPointer { L"Class SFXGameContent_Inventory.SFXDamageType_AutoPistol", &UObject::FindClass };
 
 class UClass* USFXDamageType_AutoPistol::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXDamageType_AutoPistol" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_AssaultRifle::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_AssaultRifle::pClassPointer { L"Class SFXGameContent_Inventory.SFXDamageType_AssaultRifle", &UObject::FindClass };
 
 class UClass* USFXDamageType_AssaultRifle::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXDamageType_AssaultRifle" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_SniperRifle::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_SniperRifle::pClassPointer { L"Class SFXGameContent_Inventory.SFXDamageType_SniperRifle", &UObject::FindClass };
 
 class UClass* USFXDamageType_SniperRifle::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXDamageType_SniperRifle" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXWeapon_SniperRifle::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_SniperRifle::pClassPointer { L"Class SFXGameContent_Inventory.SFXWeapon_SniperRifle", &UObject::FindClass };
 
 class UClass* ASFXWeapon_SniperRifle::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXWeapon_SniperRifle" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Inventory.SFXWeapon_SniperRifle.SetZoomed
@@ -788,10 +719,9 @@ class UClass* ASFXWeapon_SniperRifle::StaticClass()
 
 void ASFXWeapon_SniperRifle::SetZoomed ( unsigned long bState )
 {
-	static UFunction* pFnSetZoomed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetZoomedRef { L"Function SFXGameContent_Inventory.SFXWeapon_SniperRifle.SetZoomed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetZoomed )
-		pFnSetZoomed = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_SniperRifle.SetZoomed" );
+	UFunction* const pFnSetZoomed = pFnSetZoomedRef.Get ( );
 
 	ASFXWeapon_SniperRifle_execSetZoomed_Parms SetZoomed_Parms;
 	SetZoomed_Parms.bState = bState;
@@ -807,10 +737,9 @@ void ASFXWeapon_SniperRifle::SetZoomed ( unsigned long bState )
 
 class UWwiseEvent* ASFXWeapon_SniperRifle::GetWeaponSpecificImpactSound ( class USFXPhysicalMaterialImpactSounds* ImpactSounds )
 {
-	static UFunction* pFnGetWeaponSpecificImpactSound = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactSoundRef { L"Function SFXGameContent_Inventory.SFXWeapon_SniperRifle.GetWeaponSpecificImpactSound", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactSound )
-		pFnGetWeaponSpecificImpactSound = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_SniperRifle.GetWeaponSpecificImpactSound" );
+	UFunction* const pFnGetWeaponSpecificImpactSound = pFnGetWeaponSpecificImpactSoundRef.Get ( );
 
 	ASFXWeapon_SniperRifle_execGetWeaponSpecificImpactSound_Parms GetWeaponSpecificImpactSound_Parms;
 	GetWeaponSpecificImpactSound_Parms.ImpactSounds = ImpactSounds;
@@ -828,10 +757,9 @@ class UWwiseEvent* ASFXWeapon_SniperRifle::GetWeaponSpecificImpactSound ( class
 
 class UParticleSystem* ASFXWeapon_SniperRifle::GetWeaponSpecificImpactEffect ( class USFXPhysicalMaterialImpactEffects* ImpactEffects )
 {
-	static UFunction* pFnGetWeaponSpecificImpactEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactEffectRef { L"Function SFXGameContent_Inventory.SFXWeapon_SniperRifle.GetWeaponSpecificImpactEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactEffect )
-		pFnGetWeaponSpecificImpactEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_SniperRifle.GetWeaponSpecificImpactEffect" );
+	UFunction* const pFnGetWeaponSpecificImpactEffect = pFnGetWeaponSpecificImpactEffectRef.Get ( );
 
 	ASFXWeapon_SniperRifle_execGetWeaponSpecificImpactEffect_Parms GetWeaponSpecificImpactEffect_Parms;
 	GetWeaponSpecificImpactEffect_Parms.ImpactEffects = ImpactEffects;
@@ -850,10 +778,9 @@ class UParticleSystem* ASFXWeapon_SniperRifle::GetWeaponSpecificImpactEffect ( c
 
 class UDecalComponent* ASFXWeapon_SniperRifle::GetWeaponSpecificDecalData ( class USFXPhysicalMaterialDecals* DecalEffects, float* FadeTime )
 {
-	static UFunction* pFnGetWeaponSpecificDecalData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificDecalDataRef { L"Function SFXGameContent_Inventory.SFXWeapon_SniperRifle.GetWeaponSpecificDecalData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificDecalData )
-		pFnGetWeaponSpecificDecalData = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_SniperRifle.GetWeaponSpecificDecalData" );
+	UFunction* const pFnGetWeaponSpecificDecalData = pFnGetWeaponSpecificDecalDataRef.Get ( );
 
 	ASFXWeapon_SniperRifle_execGetWeaponSpecificDecalData_Parms GetWeaponSpecificDecalData_Parms;
 	GetWeaponSpecificDecalData_Parms.DecalEffects = DecalEffects;
@@ -871,26 +798,20 @@ class UDecalComponent* ASFXWeapon_SniperRifle::GetWeaponSpecificDecalData ( clas
 
 
 
-class UClass* USFXDamageType_HeavyPistol::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_HeavyPistol::pClassPointer { L"Class SFXGameContent_Inventory.SFXDamageType_HeavyPistol", &UObject::FindClass };
 
 class UClass* USFXDamageType_HeavyPistol::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXDamageType_HeavyPistol" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXWeapon_HeavyPistol::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_HeavyPistol::pClassPointer { L"Class SFXGameContent_Inventory.SFXWeapon_HeavyPistol", &UObject::FindClass };
 
 class UClass* ASFXWeapon_HeavyPistol::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXWeapon_HeavyPistol" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Inventory.SFXWeapon_HeavyPistol.GetWeaponSpecificImpactSound
@@ -901,10 +822,9 @@ class UClass* ASFXWeapon_HeavyPistol::StaticClass()
 
 class UWwiseEvent* ASFXWeapon_HeavyPistol::GetWeaponSpecificImpactSound ( class USFXPhysicalMaterialImpactSounds* ImpactSounds )
 {
-	static UFunction* pFnGetWeaponSpecificImpactSound = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactSoundRef { L"Function SFXGameContent_Inventory.SFXWeapon_HeavyPistol.GetWeaponSpecificImpactSound", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactSound )
-		pFnGetWeaponSpecificImpactSound = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_HeavyPistol.GetWeaponSpecificImpactSound" );
+	UFunction* const pFnGetWeaponSpecificImpactSound = pFnGetWeaponSpecificImpactSoundRef.Get ( );
 
 	ASFXWeapon_HeavyPistol_execGetWeaponSpecificImpactSound_Parms GetWeaponSpecificImpactSound_Parms;
 	GetWeaponSpecificImpactSound_Parms.ImpactSounds = ImpactSounds;
@@ -922,10 +842,9 @@ class UWwiseEvent* ASFXWeapon_HeavyPistol::GetWeaponSpecificImpactSound ( class
 
 class UParticleSystem* ASFXWeapon_HeavyPistol::GetWeaponSpecificImpactEffect ( class USFXPhysicalMaterialImpactEffects* ImpactEffects )
 {
-	static UFunction* pFnGetWeaponSpecificImpactEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactEffectRef { L"Function SFXGameContent_Inventory.SFXWeapon_HeavyPistol.GetWeaponSpecificImpactEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactEffect )
-		pFnGetWeaponSpecificImpactEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_HeavyPistol.GetWeaponSpecificImpactEffect" );
+	UFunction* const pFnGetWeaponSpecificImpactEffect = pFnGetWeaponSpecificImpactEffectRef.Get ( );
 
 	ASFXWeapon_HeavyPistol_execGetWeaponSpecificImpactEffect_Parms GetWeaponSpecificImpactEffect_Parms;
 	GetWeaponSpecificImpactEffect_Parms.ImpactEffects = ImpactEffects;
@@ -944,10 +863,9 @@ class UParticleSystem* ASFXWeapon_HeavyPistol::GetWeaponSpecificImpactEffect ( c
 
 class UDecalComponent* ASFXWeapon_HeavyPistol::GetWeaponSpecificDecalData ( class USFXPhysicalMaterialDecals* DecalEffects, float* FadeTime )
 {
-	static UFunction* pFnGetWeaponSpecificDecalData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificDecalDataRef { L"Function SFXGameContent_Inventory.SFXWeapon_HeavyPistol.GetWeaponSpecificDecalData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificDecalData )
-		pFnGetWeaponSpecificDecalData = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXWeapon_HeavyPistol.GetWeaponSpecificDecalData" );
+	UFunction* const pFnGetWeaponSpecificDecalData = pFnGetWeaponSpecificDecalDataRef.Get ( );
 
 	ASFXWeapon_HeavyPistol_execGetWeaponSpecificDecalData_Parms GetWeaponSpecificDecalData_Parms;
 	GetWeaponSpecificDecalData_Parms.DecalEffects = DecalEffects;
@@ -965,50 +883,38 @@ class UDecalComponent* ASFXWeapon_HeavyPistol::GetWeaponSpecificDecalData ( clas
 
 
 
-class UClass* USFXDamageType_HeavyWeapon::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_HeavyWeapon::pClassPointer { L"Class SFXGameContent_Inventory.SFXDamageType_HeavyWeapon", &UObject::FindClass };
 
 class UClass* USFXDamageType_HeavyWeapon::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXDamageType_HeavyWeapon" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Grenade::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Grenade::pClassPointer { L"Class SFXGameContent_Inventory.SFXDamageType_Grenade", &UObject::FindClass };
 
 class UClass* USFXDamageType_Grenade::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXDamageType_Grenade" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXHeavyWeapon_GrenadeLauncher::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXHeavyWeapon_GrenadeLauncher::pClassPointer { L"Class SFXGameContent_Inventory.SFXHeavyWeapon_GrenadeLauncher", &UObject::FindClass };
 
 class UClass* ASFXHeavyWeapon_GrenadeLauncher::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXHeavyWeapon_GrenadeLauncher" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXProjectile_Grenade::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_Grenade::pClassPointer { L"Class SFXGameContent_Inventory.SFXProjectile_Grenade", &UObject::FindClass };
 
 class UClass* ASFXProjectile_Grenade::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXProjectile_Grenade" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Inventory.SFXProjectile_Grenade.Recycle
@@ -1017,10 +923,9 @@ class UClass* ASFXProjectile_Grenade::StaticClass()
 
 void ASFXProjectile_Grenade::Recycle ( )
 {
-	static UFunction* pFnRecycle = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecycleRef { L"Function SFXGameContent_Inventory.SFXProjectile_Grenade.Recycle", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecycle )
-		pFnRecycle = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_Grenade.Recycle" );
+	UFunction* const pFnRecycle = pFnRecycleRef.Get ( );
 
 	ASFXProjectile_Grenade_execRecycle_Parms Recycle_Parms;
 
@@ -1040,10 +945,9 @@ void ASFXProjectile_Grenade::Recycle ( )
 
 void ASFXProjectile_Grenade::DoImpact ( class AActor* InImpactedActor, class AController* InInstigatorController, float BaseDamage, float InDamageRadius, float Momentum, struct FVector const& HurtOrigin, unsigned long bFullDamage )
 {
-	static UFunction* pFnDoImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoImpactRef { L"Function SFXGameContent_Inventory.SFXProjectile_Grenade.DoImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoImpact )
-		pFnDoImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_Grenade.DoImpact" );
+	UFunction* const pFnDoImpact = pFnDoImpactRef.Get ( );
 
 	ASFXProjectile_Grenade_execDoImpact_Parms DoImpact_Parms;
 	DoImpact_Parms.InImpactedActor = InImpactedActor;
@@ -1064,10 +968,9 @@ void ASFXProjectile_Grenade::DoImpact ( class AActor* InImpactedActor, class ACo
 
 void ASFXProjectile_Grenade::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickRef { L"Function SFXGameContent_Inventory.SFXProjectile_Grenade.Tick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTick )
-		pFnTick = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_Grenade.Tick" );
+	UFunction* const pFnTick = pFnTickRef.Get ( );
 
 	ASFXProjectile_Grenade_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -1082,10 +985,9 @@ void ASFXProjectile_Grenade::Tick ( float DeltaTime )
 
 struct FVector ASFXProjectile_Grenade::GetAimLocation ( )
 {
-	static UFunction* pFnGetAimLocation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAimLocationRef { L"Function SFXGameContent_Inventory.SFXProjectile_Grenade.GetAimLocation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAimLocation )
-		pFnGetAimLocation = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_Grenade.GetAimLocation" );
+	UFunction* const pFnGetAimLocation = pFnGetAimLocationRef.Get ( );
 
 	ASFXProjectile_Grenade_execGetAimLocation_Parms GetAimLocation_Parms;
 
@@ -1101,10 +1003,9 @@ struct FVector ASFXProjectile_Grenade::GetAimLocation ( )
 
 void ASFXProjectile_Grenade::Init ( struct FVector const& Direction )
 {
-	static UFunction* pFnInit = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitRef { L"Function SFXGameContent_Inventory.SFXProjectile_Grenade.Init", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInit )
-		pFnInit = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_Grenade.Init" );
+	UFunction* const pFnInit = pFnInitRef.Get ( );
 
 	ASFXProjectile_Grenade_execInit_Parms Init_Parms;
 	memcpy ( &Init_Parms.Direction, &Direction, 0xC );
@@ -1114,38 +1015,29 @@ void ASFXProjectile_Grenade::Init ( struct FVector const& Direction )
 
 
 
-class UClass* USFXDamageType_MissileLauncher::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_MissileLauncher::pClassPointer { L"Class SFXGameContent_Inventory.SFXDamageType_MissileLauncher", &UObject::FindClass };
 
 class UClass* USFXDamageType_MissileLauncher::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXDamageType_MissileLauncher" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Rocket::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Rocket::pClassPointer { L"Class SFXGameContent_Inventory.SFXDamageType_Rocket", &UObject::FindClass };
 
 class UClass* USFXDamageType_Rocket::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXDamageType_Rocket" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXHeavyWeapon_MissileLauncher::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXHeavyWeapon_MissileLauncher::pClassPointer { L"Class SFXGameContent_Inventory.SFXHeavyWeapon_MissileLauncher", &UObject::FindClass };
 
 class UClass* ASFXHeavyWeapon_MissileLauncher::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXHeavyWeapon_MissileLauncher" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Inventory.SFXHeavyWeapon_MissileLauncher.Tick
@@ -1155,10 +1047,9 @@ class UClass* ASFXHeavyWeapon_MissileLauncher::StaticClass()
 
 void ASFXHeavyWeapon_MissileLauncher::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickRef { L"Function SFXGameContent_Inventory.SFXHeavyWeapon_MissileLauncher.Tick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTick )
-		pFnTick = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXHeavyWeapon_MissileLauncher.Tick" );
+	UFunction* const pFnTick = pFnTickRef.Get ( );
 
 	ASFXHeavyWeapon_MissileLauncher_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -1168,14 +1059,11 @@ void ASFXHeavyWeapon_MissileLauncher::Tick ( float DeltaTime )
 
 
 
-class UClass* ASFXProjectile_SeekingMissile::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_SeekingMissile::pClassPointer { L"Class SFXGameContent_Inventory.SFXProjectile_SeekingMissile", &UObject::FindClass };
 
 class UClass* ASFXProjectile_SeekingMissile::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXProjectile_SeekingMissile" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.Recycle
@@ -1184,10 +1072,9 @@ class UClass* ASFXProjectile_SeekingMissile::StaticClass()
 
 void ASFXProjectile_SeekingMissile::Recycle ( )
 {
-	static UFunction* pFnRecycle = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecycleRef { L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.Recycle", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecycle )
-		pFnRecycle = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.Recycle" );
+	UFunction* const pFnRecycle = pFnRecycleRef.Get ( );
 
 	ASFXProjectile_SeekingMissile_execRecycle_Parms Recycle_Parms;
 
@@ -1207,10 +1094,9 @@ void ASFXProjectile_SeekingMissile::Recycle ( )
 
 void ASFXProjectile_SeekingMissile::DoImpact ( class AActor* InImpactedActor, class AController* InInstigatorController, float BaseDamage, float InDamageRadius, float Momentum, struct FVector const& HurtOrigin, unsigned long bFullDamage )
 {
-	static UFunction* pFnDoImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoImpactRef { L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.DoImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoImpact )
-		pFnDoImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.DoImpact" );
+	UFunction* const pFnDoImpact = pFnDoImpactRef.Get ( );
 
 	ASFXProjectile_SeekingMissile_execDoImpact_Parms DoImpact_Parms;
 	DoImpact_Parms.InImpactedActor = InImpactedActor;
@@ -1230,10 +1116,9 @@ void ASFXProjectile_SeekingMissile::DoImpact ( class AActor* InImpactedActor, cl
 
 void ASFXProjectile_SeekingMissile::Destroyed ( )
 {
-	static UFunction* pFnDestroyed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDestroyedRef { L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.Destroyed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDestroyed )
-		pFnDestroyed = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.Destroyed" );
+	UFunction* const pFnDestroyed = pFnDestroyedRef.Get ( );
 
 	ASFXProjectile_SeekingMissile_execDestroyed_Parms Destroyed_Parms;
 
@@ -1246,10 +1131,9 @@ void ASFXProjectile_SeekingMissile::Destroyed ( )
 
 void ASFXProjectile_SeekingMissile::ShutDown ( )
 {
-	static UFunction* pFnShutDown = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShutDownRef { L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.ShutDown", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShutDown )
-		pFnShutDown = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.ShutDown" );
+	UFunction* const pFnShutDown = pFnShutDownRef.Get ( );
 
 	ASFXProjectile_SeekingMissile_execShutDown_Parms ShutDown_Parms;
 
@@ -1263,10 +1147,9 @@ void ASFXProjectile_SeekingMissile::ShutDown ( )
 
 void ASFXProjectile_SeekingMissile::Init ( struct FVector const& Direction )
 {
-	static UFunction* pFnInit = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitRef { L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.Init", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInit )
-		pFnInit = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.Init" );
+	UFunction* const pFnInit = pFnInitRef.Get ( );
 
 	ASFXProjectile_SeekingMissile_execInit_Parms Init_Parms;
 	memcpy ( &Init_Parms.Direction, &Direction, 0xC );
@@ -1281,10 +1164,9 @@ void ASFXProjectile_SeekingMissile::Init ( struct FVector const& Direction )
 
 void ASFXProjectile_SeekingMissile::TickPlayer ( float DeltaTime )
 {
-	static UFunction* pFnTickPlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickPlayerRef { L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.TickPlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTickPlayer )
-		pFnTickPlayer = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.TickPlayer" );
+	UFunction* const pFnTickPlayer = pFnTickPlayerRef.Get ( );
 
 	ASFXProjectile_SeekingMissile_execTickPlayer_Parms TickPlayer_Parms;
 	TickPlayer_Parms.DeltaTime = DeltaTime;
@@ -1299,10 +1181,9 @@ void ASFXProjectile_SeekingMissile::TickPlayer ( float DeltaTime )
 
 void ASFXProjectile_SeekingMissile::TickNPC ( float DeltaTime )
 {
-	static UFunction* pFnTickNPC = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickNPCRef { L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.TickNPC", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTickNPC )
-		pFnTickNPC = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.TickNPC" );
+	UFunction* const pFnTickNPC = pFnTickNPCRef.Get ( );
 
 	ASFXProjectile_SeekingMissile_execTickNPC_Parms TickNPC_Parms;
 	TickNPC_Parms.DeltaTime = DeltaTime;
@@ -1317,10 +1198,9 @@ void ASFXProjectile_SeekingMissile::TickNPC ( float DeltaTime )
 
 void ASFXProjectile_SeekingMissile::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickRef { L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.Tick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTick )
-		pFnTick = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.Tick" );
+	UFunction* const pFnTick = pFnTickRef.Get ( );
 
 	ASFXProjectile_SeekingMissile_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -1335,10 +1215,9 @@ void ASFXProjectile_SeekingMissile::Tick ( float DeltaTime )
 
 struct FVector ASFXProjectile_SeekingMissile::GetAimLocation ( )
 {
-	static UFunction* pFnGetAimLocation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAimLocationRef { L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.GetAimLocation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAimLocation )
-		pFnGetAimLocation = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.GetAimLocation" );
+	UFunction* const pFnGetAimLocation = pFnGetAimLocationRef.Get ( );
 
 	ASFXProjectile_SeekingMissile_execGetAimLocation_Parms GetAimLocation_Parms;
 
@@ -1353,10 +1232,9 @@ struct FVector ASFXProjectile_SeekingMissile::GetAimLocation ( )
 
 void ASFXProjectile_SeekingMissile::AcquireTarget ( )
 {
-	static UFunction* pFnAcquireTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAcquireTargetRef { L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.AcquireTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAcquireTarget )
-		pFnAcquireTarget = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.AcquireTarget" );
+	UFunction* const pFnAcquireTarget = pFnAcquireTargetRef.Get ( );
 
 	ASFXProjectile_SeekingMissile_execAcquireTarget_Parms AcquireTarget_Parms;
 
@@ -1365,26 +1243,20 @@ void ASFXProjectile_SeekingMissile::AcquireTarget ( )
 
 
 
-class UClass* ASFXHeavyWeapon_RocketLauncher::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXHeavyWeapon_RocketLauncher::pClassPointer { L"Class SFXGameContent_Inventory.SFXHeavyWeapon_RocketLauncher", &UObject::FindClass };
 
 class UClass* ASFXHeavyWeapon_RocketLauncher::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXHeavyWeapon_RocketLauncher" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXProjectile_Rocket::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_Rocket::pClassPointer { L"Class SFXGameContent_Inventory.SFXProjectile_Rocket", &UObject::FindClass };
 
 class UClass* ASFXProjectile_Rocket::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Inventory.SFXProjectile_Rocket" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Inventory.SFXProjectile_Rocket.DoImpact
@@ -1400,10 +1272,9 @@ class UClass* ASFXProjectile_Rocket::StaticClass()
 
 void ASFXProjectile_Rocket::DoImpact ( class AActor* InImpactedActor, class AController* InInstigatorController, float BaseDamage, float InDamageRadius, float Momentum, struct FVector const& HurtOrigin, unsigned long bFullDamage )
 {
-	static UFunction* pFnDoImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoImpactRef { L"Function SFXGameContent_Inventory.SFXProjectile_Rocket.DoImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoImpact )
-		pFnDoImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Inventory.SFXProjectile_Rocket.DoImpact" );
+	UFunction* const pFnDoImpact = pFnDoImpactRef.Get ( );
 
 	ASFXProjectile_Rocket_execDoImpact_Parms DoImpact_Parms;
 	DoImpact_Parms.InImpactedActor = InImpactedActor;
@@ -1419,6 +1290,97 @@ void ASFXProjectile_Rocket::DoImpact ( class AActor* InImpactedActor, class ACon
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameContent_Inventory.SFXWeapon_SMG",
+	L"Function SFXGameContent_Inventory.SFXWeapon_SMG.GetWeaponSpecificImpactSound",
+	L"Function SFXGameContent_Inventory.SFXWeapon_SMG.GetWeaponSpecificImpactEffect",
+	L"Function SFXGameContent_Inventory.SFXWeapon_SMG.GetWeaponSpecificDecalData",
+	L"Class SFXGameContent_Inventory.SFXWeapon_Needler",
+	L"Function SFXGameContent_Inventory.SFXWeapon_Needler.GetWeaponSpecificImpactSound",
+	L"Function SFXGameContent_Inventory.SFXWeapon_Needler.GetWeaponSpecificImpactEffect",
+	L"Function SFXGameContent_Inventory.SFXWeapon_Needler.GetWeaponSpecificDecalData",
+	L"Class SFXGameContent_Inventory.SFXWeapon_HeavyShotgun",
+	L"Function SFXGameContent_Inventory.SFXWeapon_HeavyShotgun.GetWeaponSpecificImpactSound",
+	L"Function SFXGameContent_Inventory.SFXWeapon_HeavyShotgun.GetWeaponSpecificImpactEffect",
+	L"Function SFXGameContent_Inventory.SFXWeapon_HeavyShotgun.GetWeaponSpecificDecalData",
+	L"Class SFXGameContent_Inventory.SFXWeapon_Shotgun",
+	L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.GetWeaponSpecificImpactSound",
+	L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.GetWeaponSpecificImpactEffect",
+	L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.GetWeaponSpecificDecalData",
+	L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.FirePellets",
+	L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.DrawDebugShotgunCone",
+	L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.CustomFire",
+	L"Function SFXGameContent_Inventory.SFXWeapon_Shotgun.ShouldSpawnTracerFX",
+	L"Class SFXGameContent_Inventory.SFXWeapon_AutoPistol",
+	L"Function SFXGameContent_Inventory.SFXWeapon_AutoPistol.GetWeaponSpecificImpactSound",
+	L"Function SFXGameContent_Inventory.SFXWeapon_AutoPistol.GetWeaponSpecificImpactEffect",
+	L"Function SFXGameContent_Inventory.SFXWeapon_AutoPistol.GetWeaponSpecificDecalData",
+	L"Class SFXGameContent_Inventory.SFXWeapon_AssaultRifle",
+	L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.GetWeaponAnimNodeSeq",
+	L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.GetWeaponSpecificImpactSound",
+	L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.GetWeaponSpecificImpactEffect",
+	L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.GetWeaponSpecificDecalData",
+	L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.StopMuzzleFlashEffect",
+	L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.PlayFireEffects",
+	L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.PlayMuzzleFlashEffect",
+	L"Function SFXGameContent_Inventory.SFXWeapon_AssaultRifle.ShouldSpawnTracerFX",
+	L"Class SFXGameContent_Inventory.SFXDamageType_SMG",
+	L"Class SFXGameContent_Inventory.SFXDamageType_Needler",
+	L"Class SFXGameContent_Inventory.SFXDamageType_HeavyShotgun",
+	L"Class SFXGameContent_Inventory.SFXDamageType_Shotgun",
+	L"Class SFXGameContent_Inventory.SFXDamageType_AutoPistol",
+	L"Class SFXGameContent_Inventory.SFXDamageType_AssaultRifle",
+	L"Class SFXGameContent_Inventory.SFXDamageType_SniperRifle",
+	L"Class SFXGameContent_Inventory.SFXWeapon_SniperRifle",
+	L"Function SFXGameContent_Inventory.SFXWeapon_SniperRifle.SetZoomed",
+	L"Function SFXGameContent_Inventory.SFXWeapon_SniperRifle.GetWeaponSpecificImpactSound",
+	L"Function SFXGameContent_Inventory.SFXWeapon_SniperRifle.GetWeaponSpecificImpactEffect",
+	L"Function SFXGameContent_Inventory.SFXWeapon_SniperRifle.GetWeaponSpecificDecalData",
+	L"Class SFXGameContent_Inventory.SFXDamageType_HeavyPistol",
+	L"Class SFXGameContent_Inventory.SFXWeapon_HeavyPistol",
+	L"Function SFXGameContent_Inventory.SFXWeapon_HeavyPistol.GetWeaponSpecificImpactSound",
+	L"Function SFXGameContent_Inventory.SFXWeapon_HeavyPistol.GetWeaponSpecificImpactEffect",
+	L"Function SFXGameContent_Inventory.SFXWeapon_HeavyPistol.GetWeaponSpecificDecalData",
+	L"Class SFXGameContent_Inventory.SFXDamageType_HeavyWeapon",
+	L"Class SFXGameContent_Inventory.SFXDamageType_Grenade",
+	L"Class SFXGameContent_Inventory.SFXHeavyWeapon_GrenadeLauncher",
+	L"Class SFXGameContent_Inventory.SFXProjectile_Grenade",
+	L"Function SFXGameContent_Inventory.SFXProjectile_Grenade.Recycle",
+	L"Function SFXGameContent_Inventory.SFXProjectile_Grenade.DoImpact",
+	L"Function SFXGameContent_Inventory.SFXProjectile_Grenade.Tick",
+	L"Function SFXGameContent_Inventory.SFXProjectile_Grenade.GetAimLocation",
+	L"Function SFXGameContent_Inventory.SFXProjectile_Grenade.Init",
+	L"Class SFXGameContent_Inventory.SFXDamageType_MissileLauncher",
+	L"Class SFXGameContent_Inventory.SFXDamageType_Rocket",
+	L"Class SFXGameContent_Inventory.SFXHeavyWeapon_MissileLauncher",
+	L"Function SFXGameContent_Inventory.SFXHeavyWeapon_MissileLauncher.Tick",
+	L"Class SFXGameContent_Inventory.SFXProjectile_SeekingMissile",
+	L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.Recycle",
+	L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.DoImpact",
+	L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.Destroyed",
+	L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.ShutDown",
+	L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.Init",
+	L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.TickPlayer",
+	L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.TickNPC",
+	L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.Tick",
+	L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.GetAimLocation",
+	L"Function SFXGameContent_Inventory.SFXProjectile_SeekingMissile.AcquireTarget",
+	L"Class SFXGameContent_Inventory.SFXHeavyWeapon_RocketLauncher",
+	L"Class SFXGameContent_Inventory.SFXProjectile_Rocket",
+	L"Function SFXGameContent_Inventory.SFXProjectile_Rocket.DoImpact",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -52,7 +52,7 @@ public:
 	unsigned long                                      bSingleTarget : 1;                                		// 0x01EC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -66,7 +66,7 @@ class USFXPower_Warp_Radius : public USFXPower_Warp
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -80,7 +80,7 @@ class USFXPower_WarpProjectile_Radius : public USFXPower_Warp_Radius
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -94,7 +94,7 @@ class USFXPower_Warp_Heavy : public USFXPower_Warp
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -108,7 +108,7 @@ class USFXPower_WarpProjectile_Heavy : public USFXPower_Warp_Heavy
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -142,7 +142,7 @@ public:
 	unsigned long                                      m_bSingularityActive : 1;                         		// 0x016C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -169,7 +169,7 @@ public:
 	unsigned long                                      bOwnerDied : 1;                                   		// 0x0170 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -194,7 +194,7 @@ public:
 	float                                              PhysicsImpactDamageMult;                          		// 0x0204 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -208,7 +208,7 @@ class USFXPower_Singularity_Radius : public USFXPower_Singularity
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -222,7 +222,7 @@ class USFXPower_Singularity_Heavy : public USFXPower_Singularity
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -244,7 +244,7 @@ public:
 	unsigned long                                      bExplodeNextFrame : 1;                            		// 0x04C8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -267,7 +267,7 @@ class ASFXProjectile_Power_SuperSeeking : public ASFXProjectile_Power_Seeking
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -282,7 +282,7 @@ class ASFXProjectile_Power_Singularity : public ASFXProjectile_Power_SuperSeekin
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -298,7 +298,7 @@ public:
 	class ABioVisualEffect*                            ShieldVFX;                                        		// 0x00F4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -316,7 +316,7 @@ class USFXPowerScript_ShieldBoost : public USFXPowerScript_DefensiveShieldBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -335,7 +335,7 @@ public:
 	float                                              AIShotAtDelay;                                    		// 0x01D0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -350,7 +350,7 @@ class USFXPower_ShieldBoost : public USFXPower_DefensiveShieldBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -367,7 +367,7 @@ public:
 	unsigned long                                      bExplodesRobots : 1;                              		// 0x01CC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -383,7 +383,7 @@ class USFXPower_Overload_Radius : public USFXPower_Overload
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -397,7 +397,7 @@ class USFXPower_Overload_Heavy : public USFXPower_Overload
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -417,7 +417,7 @@ public:
 	class UWwiseEvent*                                 HeavyImpactSound;                                 		// 0x017C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -441,7 +441,7 @@ public:
 	unsigned long                                      bHoming : 1;                                      		// 0x04D0 (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -464,7 +464,7 @@ public:
 	unsigned long                                      CanPlayAnimatedReaction : 1;                      		// 0x01E0 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -480,7 +480,7 @@ public:
 	struct FVector2D                                   DamageNPC;                                        		// 0x01E4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -495,7 +495,7 @@ class USFXPower_Incinerate_Radius : public USFXPower_Incinerate
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -509,7 +509,7 @@ class USFXPower_Incinerate_Heavy : public USFXPower_Incinerate
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -523,7 +523,7 @@ class ASFXProjectile_Incinerate : public ASFXProjectile_Power_SuperSeeking
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -548,7 +548,7 @@ public:
 	float                                              DoTDamagePerSecond;                               		// 0x01A0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -571,7 +571,7 @@ public:
 	unsigned long                                      bPlayAnimatedReaction : 1;                        		// 0x01C4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -585,7 +585,7 @@ class USFXPower_CombatDroneShock : public USFXPower_CombatDroneAttack
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -601,7 +601,7 @@ public:
 	class UParticleSystem*                             PS_DeathVFX;                                      		// 0x00F4 (0x0008) [0x0000000004000000]              ( CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -617,7 +617,7 @@ class USFXPower_CombatDroneDeath : public USFXPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -634,7 +634,7 @@ public:
 	class UWwiseEvent*                                 NormalImpactSound;                                		// 0x00FC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -652,7 +652,7 @@ public:
 	TArray<unsigned char>                              AnimatedReactions;                                		// 0x01AC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -669,7 +669,7 @@ public:
 	class UWwiseEvent*                                 NormalImpactSound;                                		// 0x00FC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -693,7 +693,7 @@ public:
 	unsigned long                                      bCustomDroneColor2 : 1;                           		// 0x01EC (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -708,7 +708,7 @@ class USFXPower_CombatDrone_Rocket : public USFXPower_CombatDrone
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -724,7 +724,7 @@ public:
 	unsigned long                                      bBreakCloakOnAttack : 1;                          		// 0x01BC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -738,7 +738,7 @@ class USFXPower_Cloak_NPC : public USFXPower_Cloak
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -753,7 +753,7 @@ class USFXPower_Cloak_Enhanced : public USFXPower_Cloak
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -767,7 +767,7 @@ class USFXPower_Cloak_Damage : public USFXPower_Cloak
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -784,7 +784,7 @@ public:
 	unsigned long                                      bCloakEnded : 1;                                  		// 0x00FC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -803,7 +803,7 @@ class USFXPower_Barrier : public USFXPower_DefensiveShieldBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -817,7 +817,7 @@ class USFXPower_Barrier_NPC : public USFXPower_Barrier
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -831,7 +831,7 @@ class USFXPower_Barrier_Damage : public USFXPower_Barrier
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -845,7 +845,7 @@ class USFXPower_Barrier_Heavy : public USFXPower_Barrier
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -859,7 +859,7 @@ class USFXPowerScript_Barrier : public USFXPowerScript_DefensiveShieldBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -873,7 +873,7 @@ class USFXPower_LoyaltyRequirement : public USFXPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -889,7 +889,7 @@ public:
 	float                                              ExplosionDamage;                                  		// 0x01F4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -912,7 +912,7 @@ public:
 	unsigned long                                      bCustomColor2 : 1;                                		// 0x0BAC (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -936,7 +936,7 @@ public:
 	class UWwiseEvent*                                 ExplosionSound;                                   		// 0x0BC8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -952,7 +952,7 @@ class ASFXPawn_EngineerRocketDrone : public ASFXPawn_EngineerCombatDrone
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -966,7 +966,7 @@ class ASFXPawn_EngineerCombatDrone_NPC : public ASFXPawn_EngineerCombatDrone
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -985,7 +985,7 @@ public:
 	float                                              OverheatTimer;                                    		// 0x00B0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1019,7 +1019,7 @@ public:
 	unsigned long                                      bScaleDownParameter : 1;                          		// 0x00F4 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1045,7 +1045,7 @@ class USFXDamageType_CombatDroneShock : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1059,7 +1059,7 @@ class USFXDamageType_CombatDroneAttack_NPC : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1073,7 +1073,7 @@ class USFXPower_WarpProjectile : public USFXPower_Warp
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1088,7 +1088,7 @@ public:
 	struct FVector2D                                   DamageNPC;                                        		// 0x01F0 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1107,7 +1107,7 @@ public:
 	unsigned char                                      Rank4Reactions[ 0x6 ];                            		// 0x00FE (0x0006) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1130,7 +1130,7 @@ public:
 	class UParticleSystem*                             DetonationTargetEffect;                           		// 0x019C (0x0008) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1152,7 +1152,7 @@ public:
 	struct FVector2D                                   DamageNPC;                                        		// 0x0208 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1167,7 +1167,7 @@ class USFXGameEffect_IgnorePawn : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1189,7 +1189,7 @@ public:
 	float                                              PlayerLeftYawOffset;                              		// 0x0108 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1218,7 +1218,7 @@ public:
 	TArray<float>                                      WeaponDamageBonus;                                		// 0x01CC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1233,7 +1233,7 @@ public:
 	TArray<float>                                      DurationBonus;                                    		// 0x01DC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1247,7 +1247,7 @@ class USFXPower_TaliPassive_Evolved2 : public USFXPower_TaliPassive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1261,7 +1261,7 @@ class USFXPower_TaliPassive_Evolved1 : public USFXPower_TaliPassive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1275,7 +1275,7 @@ class USFXPowerScript_PassivePower : public UBioPowerScriptDesign
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1300,7 +1300,7 @@ class USFXPowerScript_HenchmanPassive : public USFXPowerScript_PassivePower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1315,7 +1315,7 @@ class USFXPowerScript_TaliPassive : public USFXPowerScript_HenchmanPassive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1331,7 +1331,7 @@ public:
 	TArray<float>                                      ShieldBonusDuration;                              		// 0x01AC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1345,7 +1345,7 @@ class USFXPower_ShieldJack_Evolved2 : public USFXPower_ShieldJack
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1359,7 +1359,7 @@ class USFXPower_ShieldJack_Evolved1 : public USFXPower_ShieldJack
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1373,7 +1373,7 @@ class USFXPower_CombatDrone_Tech_Hench : public USFXPower_CombatDrone_Tech
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1387,7 +1387,7 @@ class USFXPower_CombatDrone_Tech_Tali : public USFXPower_CombatDrone_Tech_Hench
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1401,7 +1401,7 @@ class USFXPower_CombatDrone_Rocket_Hench : public USFXPower_CombatDrone_Rocket
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1415,7 +1415,7 @@ class USFXPower_CombatDrone_Rocket_Tali : public USFXPower_CombatDrone_Rocket_He
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1429,7 +1429,7 @@ class USFXPower_CombatDrone_Tali : public USFXPower_CombatDrone
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1444,7 +1444,7 @@ public:
 	TArray<float>                                      ShieldStrength;                                   		// 0x01AC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1458,7 +1458,7 @@ class USFXPower_AIHacking_Tali : public USFXPower_AIHacking
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1472,7 +1472,7 @@ class USFXPower_AIHacking_Radius : public USFXPower_AIHacking
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1486,7 +1486,7 @@ class USFXPower_AIHacking_Radius_Hench : public USFXPower_AIHacking_Radius
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1500,7 +1500,7 @@ class USFXPower_AIHacking_Heavy : public USFXPower_AIHacking
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1514,7 +1514,7 @@ class USFXPower_AIHacking_Heavy_Hench : public USFXPower_AIHacking_Heavy
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1528,7 +1528,7 @@ class ASFXPawn_EngineerTechDrone_Tali : public ASFXPawn_EngineerTechDrone
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1542,7 +1542,7 @@ class ASFXPawn_EngineerRocketDrone_Tali : public ASFXPawn_EngineerRocketDrone
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1556,7 +1556,7 @@ class ASFXPawn_EngineerCombatDrone_Tali : public ASFXPawn_EngineerCombatDrone
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1570,7 +1570,7 @@ class USFXDamageType_ImprovedShieldJack : public USFXDamageType_ShieldJack
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1588,7 +1588,7 @@ public:
 	class UWwiseEvent*                                 Hit;                                              		// 0x0104 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1607,7 +1607,7 @@ class USFXGameEffect_HenchmenIgnorePawn : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1627,7 +1627,7 @@ public:
 	class UWwiseEvent*                                 ImpactSound;                                      		// 0x010C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1657,7 +1657,7 @@ public:
 	unsigned long                                      bModifyMuzzle : 1;                                		// 0x0120 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1688,7 +1688,7 @@ public:
 	unsigned long                                      bWeaponUnequipped : 1;                            		// 0x00C8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1712,7 +1712,7 @@ public:
 	class USFXPower_IncendiaryAmmo*                    m_oPower;                                         		// 0x0124 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1739,7 +1739,7 @@ public:
 	unsigned long                                      bSpawnImpactFlames : 1;                           		// 0x01D0 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1764,7 +1764,7 @@ public:
 	unsigned long                                      bSpawnImpactFlames : 1;                           		// 0x0100 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1787,7 +1787,7 @@ public:
 	struct SFXName                                     BoneName;                                         		// 0x010C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1807,7 +1807,7 @@ public:
 	unsigned long                                      bSingleTarget : 1;                                		// 0x01B0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1822,7 +1822,7 @@ public:
 	class USFXPower_DisruptorAmmo*                     m_oPower;                                         		// 0x0124 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1847,7 +1847,7 @@ public:
 	unsigned long                                      bExplodesRobots : 1;                              		// 0x01EC (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1868,7 +1868,7 @@ public:
 	unsigned long                                      bExplodesRobots : 1;                              		// 0x00E8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1895,7 +1895,7 @@ public:
 	float                                              MeleeCooldown;                                    		// 0x01BC (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1916,7 +1916,7 @@ public:
 	int                                                MaxPhysicsLevel;                                  		// 0x01B4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1930,7 +1930,7 @@ class USFXDamageType_CryoAmmo : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1948,7 +1948,7 @@ public:
 	float                                              FreezeDuration;                                   		// 0x00DC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1965,7 +1965,7 @@ public:
 	class UClass*                                      PowerClass;                                       		// 0x0094 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1984,7 +1984,7 @@ public:
 	float                                              ArmorBonus;                                       		// 0x01DC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2000,7 +2000,7 @@ public:
 	unsigned long                                      bEffectEnded : 1;                                 		// 0x00F4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2019,7 +2019,7 @@ class USFXPower_AdrenalineRush_Evolved1 : public USFXPower_AdrenalineRush
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2033,7 +2033,7 @@ class USFXPower_AdrenalineRush_Evolved2 : public USFXPower_AdrenalineRush
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2047,7 +2047,7 @@ class USFXPower_AdrenalineRush_Soldier : public USFXPower_AdrenalineRush
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2061,7 +2061,7 @@ class ASFXProjectile_Power_ConcussiveShot : public ASFXProjectile_Power_Seeking
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2075,7 +2075,7 @@ class USFXPower_ConcussiveShot_Heavy : public USFXPower_ConcussiveShot
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2089,7 +2089,7 @@ class USFXPower_ConcussiveShot_Radius : public USFXPower_ConcussiveShot
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2103,7 +2103,7 @@ class USFXPower_ConcussiveShot_Soldier : public USFXPower_ConcussiveShot
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2119,7 +2119,7 @@ public:
 	unsigned long                                      bSquadPower : 1;                                  		// 0x01BC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2134,7 +2134,7 @@ public:
 	class USFXPower_CryoAmmo*                          m_oPower;                                         		// 0x0124 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2152,7 +2152,7 @@ class USFXPower_CryoAmmo_Evolved1 : public USFXPower_CryoAmmo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2166,7 +2166,7 @@ class USFXPower_CryoAmmo_Evolved2 : public USFXPower_CryoAmmo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2180,7 +2180,7 @@ class USFXPower_CryoAmmo_Soldier : public USFXPower_CryoAmmo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2194,7 +2194,7 @@ class USFXPower_IncendiaryAmmo_Soldier : public USFXPower_IncendiaryAmmo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2208,7 +2208,7 @@ class USFXPower_IncendiaryAmmo_Squad : public USFXPower_IncendiaryAmmo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2222,7 +2222,7 @@ class USFXPower_IncendiaryAmmo_Radius : public USFXPower_IncendiaryAmmo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2236,7 +2236,7 @@ class USFXPower_DisruptorAmmo_Heavy : public USFXPower_DisruptorAmmo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2250,7 +2250,7 @@ class USFXPower_DisruptorAmmo_Squad : public USFXPower_DisruptorAmmo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2264,7 +2264,7 @@ class USFXPower_DisruptorAmmo_Soldier : public USFXPower_DisruptorAmmo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2278,7 +2278,7 @@ class USFXPower_FirstAid : public USFXPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2294,7 +2294,7 @@ public:
 	class UBioVFXTemplate*                             m_oCrustEffect;                                   		// 0x00F4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2314,7 +2314,7 @@ class USFXPower_PlayerMeleePistol : public USFXPower_PlayerMelee
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2333,7 +2333,7 @@ public:
 	TArray<float>                                      PowerDamageIncrease;                              		// 0x01FC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2347,7 +2347,7 @@ class USFXPowerScript_SoldierPassive : public USFXPowerScript_PassivePower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2362,7 +2362,7 @@ class USFXPower_SoldierPassive_Evolved1 : public USFXPower_SoldierPassive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2376,7 +2376,7 @@ class USFXPower_SoldierPassive_Evolved2 : public USFXPower_SoldierPassive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2390,7 +2390,7 @@ class USFXPower_CombatDrone_NPC : public USFXPower_CombatDrone
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2404,7 +2404,7 @@ class USFXPower_ShieldBoost_NPC : public USFXPower_ShieldBoost
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2421,7 +2421,7 @@ public:
 	class UWwiseEvent*                                 NormalImpactSound;                                		// 0x0104 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2440,7 +2440,7 @@ class USFXPower_NeuralShock : public USFXPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2458,7 +2458,7 @@ public:
 	float                                              RagdollDuration;                                  		// 0x00A8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2473,7 +2473,7 @@ class USFXDamageType_CryoFreeze : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2488,7 +2488,7 @@ public:
 	TArray<unsigned char>                              AnimatedReactions;                                		// 0x01AC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2504,7 +2504,7 @@ public:
 	class UWwiseEvent*                                 NormalImpactSound;                                		// 0x00F4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2521,7 +2521,7 @@ class USFXPower_CryoFreeze_Evolved1 : public USFXPower_CryoFreeze
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2535,7 +2535,7 @@ class USFXPower_CryoFreeze_Evolved2 : public USFXPower_CryoFreeze
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2549,7 +2549,7 @@ class USFXPower_CryoFreezeInstant : public USFXPower_CryoFreeze
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2563,7 +2563,7 @@ class USFXPower_CryoFreezeInstant_Evolved1 : public USFXPower_CryoFreeze_Evolved
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2577,7 +2577,7 @@ class USFXPower_CryoFreezeInstant_Evolved2 : public USFXPower_CryoFreeze_Evolved
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2591,7 +2591,7 @@ class USFXPower_CryoFreeze_Mordin : public USFXPower_CryoFreezeInstant
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2605,7 +2605,7 @@ class USFXPower_IncinerateInstant : public USFXPower_Incinerate
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2619,7 +2619,7 @@ class USFXPower_Incinerate_Mordin : public USFXPower_IncinerateInstant
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2633,7 +2633,7 @@ class USFXPower_IncinerateInstant_Heavy : public USFXPower_Incinerate_Heavy
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2647,7 +2647,7 @@ class USFXPower_Incinerate_Heavy_Hench : public USFXPower_IncinerateInstant_Heav
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2661,7 +2661,7 @@ class USFXPower_IncinerateInstant_Radius : public USFXPower_Incinerate_Radius
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2675,7 +2675,7 @@ class USFXPower_Incinerate_Radius_Hench : public USFXPower_IncinerateInstant_Rad
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2690,7 +2690,7 @@ public:
 	TArray<float>                                      ShieldBonus;                                      		// 0x01DC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2704,7 +2704,7 @@ class USFXPowerScript_MordinPassive : public USFXPowerScript_HenchmanPassive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2719,7 +2719,7 @@ class USFXPower_MordinPassive_Evolved1 : public USFXPower_MordinPassive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2733,7 +2733,7 @@ class USFXPower_MordinPassive_Evolved2 : public USFXPower_MordinPassive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2747,7 +2747,7 @@ class USFXPower_NeuralShock_Heavy : public USFXPower_NeuralShock
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2761,7 +2761,7 @@ class USFXPower_NeuralShock_Radius : public USFXPower_NeuralShock
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28,62 +28,47 @@
 
 
 
-class UClass* USFXPower_WarpProjectile_Radius::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_WarpProjectile_Radius::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_WarpProjectile_Radius", &UObject::FindClass };
 
 class UClass* USFXPower_WarpProjectile_Radius::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_WarpProjectile_Radius" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_WarpProjectile_Heavy::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_WarpProjectile_Heavy::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_WarpProjectile_Heavy", &UObject::FindClass };
 
 class UClass* USFXPower_WarpProjectile_Heavy::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_WarpProjectile_Heavy" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Warp_Radius::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Warp_Radius::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Warp_Radius", &UObject::FindClass };
 
 class UClass* USFXPower_Warp_Radius::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Warp_Radius" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Warp_Heavy::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Warp_Heavy::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Warp_Heavy", &UObject::FindClass };
 
 class UClass* USFXPower_Warp_Heavy::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Warp_Heavy" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_Singularity_NPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_Singularity_NPC::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_Singularity_NPC", &UObject::FindClass };
 
 class UClass* USFXPowerScript_Singularity_NPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_Singularity_NPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_Singularity_NPC.OnOwnerDied
@@ -92,10 +77,9 @@ class UClass* USFXPowerScript_Singularity_NPC::StaticClass()
 
 void USFXPowerScript_Singularity_NPC::OnOwnerDied ( )
 {
-	static UFunction* pFnOnOwnerDied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnOwnerDiedRef { L"Function SFXGameContent_Powers.SFXPowerScript_Singularity_NPC.OnOwnerDied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnOwnerDied )
-		pFnOnOwnerDied = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Singularity_NPC.OnOwnerDied" );
+	UFunction* const pFnOnOwnerDied = pFnOnOwnerDiedRef.Get ( );
 
 	USFXPowerScript_Singularity_NPC_execOnOwnerDied_Parms OnOwnerDied_Parms;
 
@@ -111,10 +95,9 @@ void USFXPowerScript_Singularity_NPC::OnOwnerDied ( )
 
 bool USFXPowerScript_Singularity_NPC::ImpactNewTarget ( class AActor* oImpacted, float* fEffectDuration )
 {
-	static UFunction* pFnImpactNewTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnImpactNewTargetRef { L"Function SFXGameContent_Powers.SFXPowerScript_Singularity_NPC.ImpactNewTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnImpactNewTarget )
-		pFnImpactNewTarget = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Singularity_NPC.ImpactNewTarget" );
+	UFunction* const pFnImpactNewTarget = pFnImpactNewTargetRef.Get ( );
 
 	USFXPowerScript_Singularity_NPC_execImpactNewTarget_Parms ImpactNewTarget_Parms;
 	ImpactNewTarget_Parms.oImpacted = oImpacted;
@@ -140,10 +123,9 @@ bool USFXPowerScript_Singularity_NPC::ImpactNewTarget ( class AActor* oImpacted,
 
 void USFXPowerScript_Singularity_NPC::OnProjectileExploded ( class AActor* oCaster, struct FVector const& HitLocation, struct FVector const& HitNormal, struct FVector const& Velocity )
 {
-	static UFunction* pFnOnProjectileExploded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnProjectileExplodedRef { L"Function SFXGameContent_Powers.SFXPowerScript_Singularity_NPC.OnProjectileExploded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnProjectileExploded )
-		pFnOnProjectileExploded = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Singularity_NPC.OnProjectileExploded" );
+	UFunction* const pFnOnProjectileExploded = pFnOnProjectileExplodedRef.Get ( );
 
 	USFXPowerScript_Singularity_NPC_execOnProjectileExploded_Parms OnProjectileExploded_Parms;
 	OnProjectileExploded_Parms.oCaster = oCaster;
@@ -164,10 +146,9 @@ void USFXPowerScript_Singularity_NPC::OnProjectileExploded ( class AActor* oCast
 
 bool USFXPowerScript_Singularity_NPC::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.SFXPowerScript_Singularity_NPC.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Singularity_NPC.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	USFXPowerScript_Singularity_NPC_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -181,98 +162,74 @@ bool USFXPowerScript_Singularity_NPC::eventStartPhase ( unsigned char ePhase, cl
 
 
 
-class UClass* USFXPower_Singularity_Radius::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Singularity_Radius::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Singularity_Radius", &UObject::FindClass };
 
 class UClass* USFXPower_Singularity_Radius::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Singularity_Radius" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Singularity_Heavy::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Singularity_Heavy::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Singularity_Heavy", &UObject::FindClass };
 
 class UClass* USFXPower_Singularity_Heavy::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Singularity_Heavy" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXProjectile_Power_Singularity::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_Power_Singularity::pClassPointer { L"Class SFXGameContent_Powers.SFXProjectile_Power_Singularity", &UObject::FindClass };
 
 class UClass* ASFXProjectile_Power_Singularity::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXProjectile_Power_Singularity" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_ShieldBoost::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_ShieldBoost::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_ShieldBoost", &UObject::FindClass };
 
 class UClass* USFXPowerScript_ShieldBoost::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_ShieldBoost" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_ShieldBoost::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_ShieldBoost::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_ShieldBoost", &UObject::FindClass };
 
 class UClass* USFXPower_ShieldBoost::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_ShieldBoost" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Overload_Radius::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Overload_Radius::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Overload_Radius", &UObject::FindClass };
 
 class UClass* USFXPower_Overload_Radius::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Overload_Radius" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Overload_Heavy::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Overload_Heavy::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Overload_Heavy", &UObject::FindClass };
 
 class UClass* USFXPower_Overload_Heavy::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Overload_Heavy" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_Overload::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_Overload::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_Overload", &UObject::FindClass };
 
 class UClass* USFXPowerScript_Overload::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_Overload" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_Overload.ShouldUsePower
@@ -285,10 +242,9 @@ class UClass* USFXPowerScript_Overload::StaticClass()
 
 bool USFXPowerScript_Overload::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.SFXPowerScript_Overload.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Overload.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerScript_Overload_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -312,10 +268,9 @@ bool USFXPowerScript_Overload::ShouldUsePower ( class AActor* Caster, class AAct
 
 void USFXPowerScript_Overload::SpawnBigImpactVFX ( class AActor* oImpacted )
 {
-	static UFunction* pFnSpawnBigImpactVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSpawnBigImpactVFXRef { L"Function SFXGameContent_Powers.SFXPowerScript_Overload.SpawnBigImpactVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSpawnBigImpactVFX )
-		pFnSpawnBigImpactVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Overload.SpawnBigImpactVFX" );
+	UFunction* const pFnSpawnBigImpactVFX = pFnSpawnBigImpactVFXRef.Get ( );
 
 	USFXPowerScript_Overload_execSpawnBigImpactVFX_Parms SpawnBigImpactVFX_Parms;
 	SpawnBigImpactVFX_Parms.oImpacted = oImpacted;
@@ -331,10 +286,9 @@ void USFXPowerScript_Overload::SpawnBigImpactVFX ( class AActor* oImpacted )
 
 void USFXPowerScript_Overload::ExplodeEnemy ( class ABioPawn* oPawn, class ABioPawn* oCaster )
 {
-	static UFunction* pFnExplodeEnemy = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnExplodeEnemyRef { L"Function SFXGameContent_Powers.SFXPowerScript_Overload.ExplodeEnemy", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnExplodeEnemy )
-		pFnExplodeEnemy = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Overload.ExplodeEnemy" );
+	UFunction* const pFnExplodeEnemy = pFnExplodeEnemyRef.Get ( );
 
 	USFXPowerScript_Overload_execExplodeEnemy_Parms ExplodeEnemy_Parms;
 	ExplodeEnemy_Parms.oPawn = oPawn;
@@ -351,10 +305,9 @@ void USFXPowerScript_Overload::ExplodeEnemy ( class ABioPawn* oPawn, class ABioP
 
 bool USFXPowerScript_Overload::CanEnemyBeExploded ( class ABioPawn* oPawn )
 {
-	static UFunction* pFnCanEnemyBeExploded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanEnemyBeExplodedRef { L"Function SFXGameContent_Powers.SFXPowerScript_Overload.CanEnemyBeExploded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanEnemyBeExploded )
-		pFnCanEnemyBeExploded = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Overload.CanEnemyBeExploded" );
+	UFunction* const pFnCanEnemyBeExploded = pFnCanEnemyBeExplodedRef.Get ( );
 
 	USFXPowerScript_Overload_execCanEnemyBeExploded_Parms CanEnemyBeExploded_Parms;
 	CanEnemyBeExploded_Parms.oPawn = oPawn;
@@ -371,10 +324,9 @@ bool USFXPowerScript_Overload::CanEnemyBeExploded ( class ABioPawn* oPawn )
 
 void USFXPowerScript_Overload::TurnOnDeathPower ( class AActor* oImpacted )
 {
-	static UFunction* pFnTurnOnDeathPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTurnOnDeathPowerRef { L"Function SFXGameContent_Powers.SFXPowerScript_Overload.TurnOnDeathPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTurnOnDeathPower )
-		pFnTurnOnDeathPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Overload.TurnOnDeathPower" );
+	UFunction* const pFnTurnOnDeathPower = pFnTurnOnDeathPowerRef.Get ( );
 
 	USFXPowerScript_Overload_execTurnOnDeathPower_Parms TurnOnDeathPower_Parms;
 	TurnOnDeathPower_Parms.oImpacted = oImpacted;
@@ -390,10 +342,9 @@ void USFXPowerScript_Overload::TurnOnDeathPower ( class AActor* oImpacted )
 
 void USFXPowerScript_Overload::StunRobot ( class ABioPawn* oPawn, float fDuration )
 {
-	static UFunction* pFnStunRobot = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStunRobotRef { L"Function SFXGameContent_Powers.SFXPowerScript_Overload.StunRobot", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStunRobot )
-		pFnStunRobot = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Overload.StunRobot" );
+	UFunction* const pFnStunRobot = pFnStunRobotRef.Get ( );
 
 	USFXPowerScript_Overload_execStunRobot_Parms StunRobot_Parms;
 	StunRobot_Parms.oPawn = oPawn;
@@ -413,10 +364,9 @@ void USFXPowerScript_Overload::StunRobot ( class ABioPawn* oPawn, float fDuratio
 
 bool USFXPowerScript_Overload::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.SFXPowerScript_Overload.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Overload.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerScript_Overload_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -439,10 +389,9 @@ bool USFXPowerScript_Overload::eventOnImpact ( class AActor* oCaster, float fCas
 
 bool USFXPowerScript_Overload::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.SFXPowerScript_Overload.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Overload.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	USFXPowerScript_Overload_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -456,14 +405,11 @@ bool USFXPowerScript_Overload::eventStartPhase ( unsigned char ePhase, class AAc
 
 
 
-class UClass* USFXPower_Overload::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Overload::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Overload", &UObject::FindClass };
 
 class UClass* USFXPower_Overload::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Overload" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPower_Overload.GetOverheatLength
@@ -473,10 +419,9 @@ class UClass* USFXPower_Overload::StaticClass()
 
 float USFXPower_Overload::GetOverheatLength ( )
 {
-	static UFunction* pFnGetOverheatLength = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetOverheatLengthRef { L"Function SFXGameContent_Powers.SFXPower_Overload.GetOverheatLength", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetOverheatLength )
-		pFnGetOverheatLength = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPower_Overload.GetOverheatLength" );
+	UFunction* const pFnGetOverheatLength = pFnGetOverheatLengthRef.Get ( );
 
 	USFXPower_Overload_execGetOverheatLength_Parms GetOverheatLength_Parms;
 
@@ -492,10 +437,9 @@ float USFXPower_Overload::GetOverheatLength ( )
 
 float USFXPower_Overload::GetRobotStunLength ( )
 {
-	static UFunction* pFnGetRobotStunLength = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetRobotStunLengthRef { L"Function SFXGameContent_Powers.SFXPower_Overload.GetRobotStunLength", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetRobotStunLength )
-		pFnGetRobotStunLength = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPower_Overload.GetRobotStunLength" );
+	UFunction* const pFnGetRobotStunLength = pFnGetRobotStunLengthRef.Get ( );
 
 	USFXPower_Overload_execGetRobotStunLength_Parms GetRobotStunLength_Parms;
 
@@ -506,14 +450,11 @@ float USFXPower_Overload::GetRobotStunLength ( )
 
 
 
-class UClass* ASFXProjectile_Power_Seeking_NPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_Power_Seeking_NPC::pClassPointer { L"Class SFXGameContent_Powers.SFXProjectile_Power_Seeking_NPC", &UObject::FindClass };
 
 class UClass* ASFXProjectile_Power_Seeking_NPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXProjectile_Power_Seeking_NPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXProjectile_Power_Seeking_NPC.Tick
@@ -523,10 +464,9 @@ class UClass* ASFXProjectile_Power_Seeking_NPC::StaticClass()
 
 void ASFXProjectile_Power_Seeking_NPC::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickRef { L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking_NPC.Tick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTick )
-		pFnTick = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking_NPC.Tick" );
+	UFunction* const pFnTick = pFnTickRef.Get ( );
 
 	ASFXProjectile_Power_Seeking_NPC_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -542,10 +482,9 @@ void ASFXProjectile_Power_Seeking_NPC::Tick ( float DeltaTime )
 
 struct FVector ASFXProjectile_Power_Seeking_NPC::GetAimLocation ( class AActor* Target )
 {
-	static UFunction* pFnGetAimLocation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAimLocationRef { L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking_NPC.GetAimLocation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAimLocation )
-		pFnGetAimLocation = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking_NPC.GetAimLocation" );
+	UFunction* const pFnGetAimLocation = pFnGetAimLocationRef.Get ( );
 
 	ASFXProjectile_Power_Seeking_NPC_execGetAimLocation_Parms GetAimLocation_Parms;
 	GetAimLocation_Parms.Target = Target;
@@ -566,10 +505,9 @@ struct FVector ASFXProjectile_Power_Seeking_NPC::GetAimLocation ( class AActor*
 
 bool ASFXProjectile_Power_Seeking_NPC::InitializePowerProjectile ( class AActor* oCaster, float fTravelSpeed, float fRadius, class UBioPower* oPower )
 {
-	static UFunction* pFnInitializePowerProjectile = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerProjectileRef { L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking_NPC.InitializePowerProjectile", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerProjectile )
-		pFnInitializePowerProjectile = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking_NPC.InitializePowerProjectile" );
+	UFunction* const pFnInitializePowerProjectile = pFnInitializePowerProjectileRef.Get ( );
 
 	ASFXProjectile_Power_Seeking_NPC_execInitializePowerProjectile_Parms InitializePowerProjectile_Parms;
 	InitializePowerProjectile_Parms.oCaster = oCaster;
@@ -584,14 +522,11 @@ bool ASFXProjectile_Power_Seeking_NPC::InitializePowerProjectile ( class AActor*
 
 
 
-class UClass* USFXPower_Incinerate_NPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Incinerate_NPC::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Incinerate_NPC", &UObject::FindClass };
 
 class UClass* USFXPower_Incinerate_NPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Incinerate_NPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPower_Incinerate_NPC.GetDamage
@@ -601,10 +536,9 @@ class UClass* USFXPower_Incinerate_NPC::StaticClass()
 
 float USFXPower_Incinerate_NPC::GetDamage ( )
 {
-	static UFunction* pFnGetDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDamageRef { L"Function SFXGameContent_Powers.SFXPower_Incinerate_NPC.GetDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDamage )
-		pFnGetDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPower_Incinerate_NPC.GetDamage" );
+	UFunction* const pFnGetDamage = pFnGetDamageRef.Get ( );
 
 	USFXPower_Incinerate_NPC_execGetDamage_Parms GetDamage_Parms;
 
@@ -615,38 +549,29 @@ float USFXPower_Incinerate_NPC::GetDamage ( )
 
 
 
-class UClass* USFXPower_Incinerate_Radius::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Incinerate_Radius::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Incinerate_Radius", &UObject::FindClass };
 
 class UClass* USFXPower_Incinerate_Radius::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Incinerate_Radius" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Incinerate_Heavy::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Incinerate_Heavy::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Incinerate_Heavy", &UObject::FindClass };
 
 class UClass* USFXPower_Incinerate_Heavy::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Incinerate_Heavy" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXProjectile_Power_Seeking::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_Power_Seeking::pClassPointer { L"Class SFXGameContent_Powers.SFXProjectile_Power_Seeking", &UObject::FindClass };
 
 class UClass* ASFXProjectile_Power_Seeking::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXProjectile_Power_Seeking" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.Recycle
@@ -655,10 +580,9 @@ class UClass* ASFXProjectile_Power_Seeking::StaticClass()
 
 void ASFXProjectile_Power_Seeking::Recycle ( )
 {
-	static UFunction* pFnRecycle = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecycleRef { L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.Recycle", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecycle )
-		pFnRecycle = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.Recycle" );
+	UFunction* const pFnRecycle = pFnRecycleRef.Get ( );
 
 	ASFXProjectile_Power_Seeking_execRecycle_Parms Recycle_Parms;
 
@@ -672,10 +596,9 @@ void ASFXProjectile_Power_Seeking::Recycle ( )
 
 void ASFXProjectile_Power_Seeking::InitializeRotation ( class APawn* oCasterPawn )
 {
-	static UFunction* pFnInitializeRotation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializeRotationRef { L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.InitializeRotation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializeRotation )
-		pFnInitializeRotation = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.InitializeRotation" );
+	UFunction* const pFnInitializeRotation = pFnInitializeRotationRef.Get ( );
 
 	ASFXProjectile_Power_Seeking_execInitializeRotation_Parms InitializeRotation_Parms;
 	InitializeRotation_Parms.oCasterPawn = oCasterPawn;
@@ -694,10 +617,9 @@ void ASFXProjectile_Power_Seeking::InitializeRotation ( class APawn* oCasterPawn
 
 bool ASFXProjectile_Power_Seeking::InitializePowerProjectile ( class AActor* oCaster, float fTravelSpeed, float fRadius, class UBioPower* oPower )
 {
-	static UFunction* pFnInitializePowerProjectile = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerProjectileRef { L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.InitializePowerProjectile", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerProjectile )
-		pFnInitializePowerProjectile = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.InitializePowerProjectile" );
+	UFunction* const pFnInitializePowerProjectile = pFnInitializePowerProjectileRef.Get ( );
 
 	ASFXProjectile_Power_Seeking_execInitializePowerProjectile_Parms InitializePowerProjectile_Parms;
 	InitializePowerProjectile_Parms.oCaster = oCaster;
@@ -719,10 +641,9 @@ bool ASFXProjectile_Power_Seeking::InitializePowerProjectile ( class AActor* oCa
 
 bool ASFXProjectile_Power_Seeking::CanLockOn ( class AActor* Target, class APawn* CasterPawn )
 {
-	static UFunction* pFnCanLockOn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanLockOnRef { L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.CanLockOn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanLockOn )
-		pFnCanLockOn = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.CanLockOn" );
+	UFunction* const pFnCanLockOn = pFnCanLockOnRef.Get ( );
 
 	ASFXProjectile_Power_Seeking_execCanLockOn_Parms CanLockOn_Parms;
 	CanLockOn_Parms.Target = Target;
@@ -740,10 +661,9 @@ bool ASFXProjectile_Power_Seeking::CanLockOn ( class AActor* Target, class APawn
 
 void ASFXProjectile_Power_Seeking::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickRef { L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.Tick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTick )
-		pFnTick = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.Tick" );
+	UFunction* const pFnTick = pFnTickRef.Get ( );
 
 	ASFXProjectile_Power_Seeking_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -758,10 +678,9 @@ void ASFXProjectile_Power_Seeking::Tick ( float DeltaTime )
 
 bool ASFXProjectile_Power_Seeking::ShouldModifyVelocity ( )
 {
-	static UFunction* pFnShouldModifyVelocity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldModifyVelocityRef { L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.ShouldModifyVelocity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldModifyVelocity )
-		pFnShouldModifyVelocity = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.ShouldModifyVelocity" );
+	UFunction* const pFnShouldModifyVelocity = pFnShouldModifyVelocityRef.Get ( );
 
 	ASFXProjectile_Power_Seeking_execShouldModifyVelocity_Parms ShouldModifyVelocity_Parms;
 
@@ -779,10 +698,9 @@ bool ASFXProjectile_Power_Seeking::ShouldModifyVelocity ( )
 
 float ASFXProjectile_Power_Seeking::ChordLength ( float ChordLen, float Theta )
 {
-	static UFunction* pFnChordLength = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnChordLengthRef { L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.ChordLength", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnChordLength )
-		pFnChordLength = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.ChordLength" );
+	UFunction* const pFnChordLength = pFnChordLengthRef.Get ( );
 
 	ASFXProjectile_Power_Seeking_execChordLength_Parms ChordLength_Parms;
 	ChordLength_Parms.ChordLen = ChordLen;
@@ -801,10 +719,9 @@ float ASFXProjectile_Power_Seeking::ChordLength ( float ChordLen, float Theta )
 
 struct FVector ASFXProjectile_Power_Seeking::GetAimLocation ( class AActor* Target )
 {
-	static UFunction* pFnGetAimLocation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAimLocationRef { L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.GetAimLocation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAimLocation )
-		pFnGetAimLocation = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.GetAimLocation" );
+	UFunction* const pFnGetAimLocation = pFnGetAimLocationRef.Get ( );
 
 	ASFXProjectile_Power_Seeking_execGetAimLocation_Parms GetAimLocation_Parms;
 	GetAimLocation_Parms.Target = Target;
@@ -821,10 +738,9 @@ struct FVector ASFXProjectile_Power_Seeking::GetAimLocation ( class AActor* Targ
 
 void ASFXProjectile_Power_Seeking::AcquireTarget ( class AActor* Target )
 {
-	static UFunction* pFnAcquireTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAcquireTargetRef { L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.AcquireTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAcquireTarget )
-		pFnAcquireTarget = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.AcquireTarget" );
+	UFunction* const pFnAcquireTarget = pFnAcquireTargetRef.Get ( );
 
 	ASFXProjectile_Power_Seeking_execAcquireTarget_Parms AcquireTarget_Parms;
 	AcquireTarget_Parms.Target = Target;
@@ -834,14 +750,11 @@ void ASFXProjectile_Power_Seeking::AcquireTarget ( class AActor* Target )
 
 
 
-class UClass* ASFXProjectile_Power_SuperSeeking::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_Power_SuperSeeking::pClassPointer { L"Class SFXGameContent_Powers.SFXProjectile_Power_SuperSeeking", &UObject::FindClass };
 
 class UClass* ASFXProjectile_Power_SuperSeeking::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXProjectile_Power_SuperSeeking" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXProjectile_Power_SuperSeeking.InitializeRotation
@@ -851,10 +764,9 @@ class UClass* ASFXProjectile_Power_SuperSeeking::StaticClass()
 
 void ASFXProjectile_Power_SuperSeeking::InitializeRotation ( class APawn* oCasterPawn )
 {
-	static UFunction* pFnInitializeRotation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializeRotationRef { L"Function SFXGameContent_Powers.SFXProjectile_Power_SuperSeeking.InitializeRotation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializeRotation )
-		pFnInitializeRotation = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXProjectile_Power_SuperSeeking.InitializeRotation" );
+	UFunction* const pFnInitializeRotation = pFnInitializeRotationRef.Get ( );
 
 	ASFXProjectile_Power_SuperSeeking_execInitializeRotation_Parms InitializeRotation_Parms;
 	InitializeRotation_Parms.oCasterPawn = oCasterPawn;
@@ -864,26 +776,20 @@ void ASFXProjectile_Power_SuperSeeking::InitializeRotation ( class APawn* oCaste
 
 
 
-class UClass* ASFXProjectile_Incinerate::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_Incinerate::pClassPointer { L"Class SFXGameContent_Powers.SFXProjectile_Incinerate", &UObject::FindClass };
 
 class UClass* ASFXProjectile_Incinerate::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXProjectile_Incinerate" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_Incinerate::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_Incinerate::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_Incinerate", &UObject::FindClass };
 
 class UClass* USFXPowerScript_Incinerate::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_Incinerate" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_Incinerate.ShouldUsePower
@@ -896,10 +802,9 @@ class UClass* USFXPowerScript_Incinerate::StaticClass()
 
 bool USFXPowerScript_Incinerate::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerScript_Incinerate_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -924,10 +829,9 @@ bool USFXPowerScript_Incinerate::ShouldUsePower ( class AActor* Caster, class AA
 
 void USFXPowerScript_Incinerate::ExplodeEnemy ( class ABioPawn* oPawn, class ABioPawn* oCaster )
 {
-	static UFunction* pFnExplodeEnemy = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnExplodeEnemyRef { L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.ExplodeEnemy", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnExplodeEnemy )
-		pFnExplodeEnemy = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.ExplodeEnemy" );
+	UFunction* const pFnExplodeEnemy = pFnExplodeEnemyRef.Get ( );
 
 	USFXPowerScript_Incinerate_execExplodeEnemy_Parms ExplodeEnemy_Parms;
 	ExplodeEnemy_Parms.oPawn = oPawn;
@@ -944,10 +848,9 @@ void USFXPowerScript_Incinerate::ExplodeEnemy ( class ABioPawn* oPawn, class ABi
 
 bool USFXPowerScript_Incinerate::CanEnemyBeExploded ( class ABioPawn* oPawn )
 {
-	static UFunction* pFnCanEnemyBeExploded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanEnemyBeExplodedRef { L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.CanEnemyBeExploded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanEnemyBeExploded )
-		pFnCanEnemyBeExploded = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.CanEnemyBeExploded" );
+	UFunction* const pFnCanEnemyBeExploded = pFnCanEnemyBeExplodedRef.Get ( );
 
 	USFXPowerScript_Incinerate_execCanEnemyBeExploded_Parms CanEnemyBeExploded_Parms;
 	CanEnemyBeExploded_Parms.oPawn = oPawn;
@@ -965,10 +868,9 @@ bool USFXPowerScript_Incinerate::CanEnemyBeExploded ( class ABioPawn* oPawn )
 
 void USFXPowerScript_Incinerate::CauseAnimatedReaction ( class AActor* oHitActor, float fDelay )
 {
-	static UFunction* pFnCauseAnimatedReaction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCauseAnimatedReactionRef { L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.CauseAnimatedReaction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCauseAnimatedReaction )
-		pFnCauseAnimatedReaction = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.CauseAnimatedReaction" );
+	UFunction* const pFnCauseAnimatedReaction = pFnCauseAnimatedReactionRef.Get ( );
 
 	USFXPowerScript_Incinerate_execCauseAnimatedReaction_Parms CauseAnimatedReaction_Parms;
 	CauseAnimatedReaction_Parms.oHitActor = oHitActor;
@@ -988,10 +890,9 @@ void USFXPowerScript_Incinerate::CauseAnimatedReaction ( class AActor* oHitActor
 
 bool USFXPowerScript_Incinerate::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerScript_Incinerate_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -1014,10 +915,9 @@ bool USFXPowerScript_Incinerate::eventOnImpact ( class AActor* oCaster, float fC
 
 bool USFXPowerScript_Incinerate::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	USFXPowerScript_Incinerate_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -1031,14 +931,11 @@ bool USFXPowerScript_Incinerate::eventStartPhase ( unsigned char ePhase, class A
 
 
 
-class UClass* USFXPower_Incinerate::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Incinerate::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Incinerate", &UObject::FindClass };
 
 class UClass* USFXPower_Incinerate::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Incinerate" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPower_Incinerate.GetDuration
@@ -1048,10 +945,9 @@ class UClass* USFXPower_Incinerate::StaticClass()
 
 float USFXPower_Incinerate::GetDuration ( )
 {
-	static UFunction* pFnGetDuration = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDurationRef { L"Function SFXGameContent_Powers.SFXPower_Incinerate.GetDuration", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDuration )
-		pFnGetDuration = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPower_Incinerate.GetDuration" );
+	UFunction* const pFnGetDuration = pFnGetDurationRef.Get ( );
 
 	USFXPower_Incinerate_execGetDuration_Parms GetDuration_Parms;
 
@@ -1062,26 +958,20 @@ float USFXPower_Incinerate::GetDuration ( )
 
 
 
-class UClass* USFXPower_CombatDroneShock::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CombatDroneShock::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CombatDroneShock", &UObject::FindClass };
 
 class UClass* USFXPower_CombatDroneShock::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CombatDroneShock" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_CombatDroneDeath::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_CombatDroneDeath::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_CombatDroneDeath", &UObject::FindClass };
 
 class UClass* USFXPowerScript_CombatDroneDeath::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_CombatDroneDeath" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_CombatDroneDeath.OnImpact
@@ -1095,10 +985,9 @@ class UClass* USFXPowerScript_CombatDroneDeath::StaticClass()
 
 bool USFXPowerScript_CombatDroneDeath::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneDeath.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneDeath.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerScript_CombatDroneDeath_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -1121,10 +1010,9 @@ bool USFXPowerScript_CombatDroneDeath::eventOnImpact ( class AActor* oCaster, fl
 
 bool USFXPowerScript_CombatDroneDeath::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneDeath.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneDeath.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	USFXPowerScript_CombatDroneDeath_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -1138,26 +1026,20 @@ bool USFXPowerScript_CombatDroneDeath::eventStartPhase ( unsigned char ePhase, c
 
 
 
-class UClass* USFXPower_CombatDroneDeath::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CombatDroneDeath::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CombatDroneDeath", &UObject::FindClass };
 
 class UClass* USFXPower_CombatDroneDeath::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CombatDroneDeath" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_CombatDroneAttack_NPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_CombatDroneAttack_NPC::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack_NPC", &UObject::FindClass };
 
 class UClass* USFXPowerScript_CombatDroneAttack_NPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack_NPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack_NPC.ShouldUsePower
@@ -1170,10 +1052,9 @@ class UClass* USFXPowerScript_CombatDroneAttack_NPC::StaticClass()
 
 bool USFXPowerScript_CombatDroneAttack_NPC::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack_NPC.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack_NPC.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerScript_CombatDroneAttack_NPC_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -1201,10 +1082,9 @@ bool USFXPowerScript_CombatDroneAttack_NPC::ShouldUsePower ( class AActor* Caste
 
 bool USFXPowerScript_CombatDroneAttack_NPC::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack_NPC.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack_NPC.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerScript_CombatDroneAttack_NPC_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -1227,10 +1107,9 @@ bool USFXPowerScript_CombatDroneAttack_NPC::eventOnImpact ( class AActor* oCaste
 
 bool USFXPowerScript_CombatDroneAttack_NPC::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack_NPC.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack_NPC.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	USFXPowerScript_CombatDroneAttack_NPC_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -1244,26 +1123,20 @@ bool USFXPowerScript_CombatDroneAttack_NPC::eventStartPhase ( unsigned char ePha
 
 
 
-class UClass* USFXPower_CombatDroneAttack_NPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CombatDroneAttack_NPC::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CombatDroneAttack_NPC", &UObject::FindClass };
 
 class UClass* USFXPower_CombatDroneAttack_NPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CombatDroneAttack_NPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_CombatDroneAttack::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_CombatDroneAttack::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack", &UObject::FindClass };
 
 class UClass* USFXPowerScript_CombatDroneAttack::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack.ShouldUsePower
@@ -1276,10 +1149,9 @@ class UClass* USFXPowerScript_CombatDroneAttack::StaticClass()
 
 bool USFXPowerScript_CombatDroneAttack::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerScript_CombatDroneAttack_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -1307,10 +1179,9 @@ bool USFXPowerScript_CombatDroneAttack::ShouldUsePower ( class AActor* Caster, c
 
 bool USFXPowerScript_CombatDroneAttack::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerScript_CombatDroneAttack_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -1333,10 +1204,9 @@ bool USFXPowerScript_CombatDroneAttack::eventOnImpact ( class AActor* oCaster, f
 
 bool USFXPowerScript_CombatDroneAttack::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	USFXPowerScript_CombatDroneAttack_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -1350,38 +1220,29 @@ bool USFXPowerScript_CombatDroneAttack::eventStartPhase ( unsigned char ePhase,
 
 
 
-class UClass* USFXPower_CombatDroneAttack::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CombatDroneAttack::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CombatDroneAttack", &UObject::FindClass };
 
 class UClass* USFXPower_CombatDroneAttack::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CombatDroneAttack" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CombatDrone_Rocket::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CombatDrone_Rocket::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Rocket", &UObject::FindClass };
 
 class UClass* USFXPower_CombatDrone_Rocket::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Rocket" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Cloak_NPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Cloak_NPC::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Cloak_NPC", &UObject::FindClass };
 
 class UClass* USFXPower_Cloak_NPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Cloak_NPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPower_Cloak_NPC.GetDamageMultiplier
@@ -1391,10 +1252,9 @@ class UClass* USFXPower_Cloak_NPC::StaticClass()
 
 float USFXPower_Cloak_NPC::GetDamageMultiplier ( )
 {
-	static UFunction* pFnGetDamageMultiplier = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDamageMultiplierRef { L"Function SFXGameContent_Powers.SFXPower_Cloak_NPC.GetDamageMultiplier", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDamageMultiplier )
-		pFnGetDamageMultiplier = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPower_Cloak_NPC.GetDamageMultiplier" );
+	UFunction* const pFnGetDamageMultiplier = pFnGetDamageMultiplierRef.Get ( );
 
 	USFXPower_Cloak_NPC_execGetDamageMultiplier_Parms GetDamageMultiplier_Parms;
 
@@ -1405,38 +1265,29 @@ float USFXPower_Cloak_NPC::GetDamageMultiplier ( )
 
 
 
-class UClass* USFXPower_Cloak_Enhanced::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Cloak_Enhanced::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Cloak_Enhanced", &UObject::FindClass };
 
 class UClass* USFXPower_Cloak_Enhanced::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Cloak_Enhanced" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Cloak_Damage::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Cloak_Damage::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Cloak_Damage", &UObject::FindClass };
 
 class UClass* USFXPower_Cloak_Damage::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Cloak_Damage" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_Cloak::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_Cloak::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_Cloak", &UObject::FindClass };
 
 class UClass* USFXPowerScript_Cloak::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_Cloak" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_Cloak.ShouldUsePower
@@ -1449,10 +1300,9 @@ class UClass* USFXPowerScript_Cloak::StaticClass()
 
 bool USFXPowerScript_Cloak::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.SFXPowerScript_Cloak.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Cloak.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerScript_Cloak_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -1475,10 +1325,9 @@ bool USFXPowerScript_Cloak::ShouldUsePower ( class AActor* Caster, class AActor*
 
 void USFXPowerScript_Cloak::OnCloakEnded ( )
 {
-	static UFunction* pFnOnCloakEnded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnCloakEndedRef { L"Function SFXGameContent_Powers.SFXPowerScript_Cloak.OnCloakEnded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnCloakEnded )
-		pFnOnCloakEnded = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Cloak.OnCloakEnded" );
+	UFunction* const pFnOnCloakEnded = pFnOnCloakEndedRef.Get ( );
 
 	USFXPowerScript_Cloak_execOnCloakEnded_Parms OnCloakEnded_Parms;
 
@@ -1496,10 +1345,9 @@ void USFXPowerScript_Cloak::OnCloakEnded ( )
 
 bool USFXPowerScript_Cloak::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.SFXPowerScript_Cloak.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Cloak.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerScript_Cloak_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -1520,10 +1368,9 @@ bool USFXPowerScript_Cloak::eventOnImpact ( class AActor* oCaster, float fCaster
 
 bool USFXPowerScript_Cloak::eventAdjustCooldown ( float* fCoolDownTime )
 {
-	static UFunction* pFnAdjustCooldown = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAdjustCooldownRef { L"Function SFXGameContent_Powers.SFXPowerScript_Cloak.AdjustCooldown", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAdjustCooldown )
-		pFnAdjustCooldown = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Cloak.AdjustCooldown" );
+	UFunction* const pFnAdjustCooldown = pFnAdjustCooldownRef.Get ( );
 
 	USFXPowerScript_Cloak_eventAdjustCooldown_Parms AdjustCooldown_Parms;
 
@@ -1548,10 +1395,9 @@ bool USFXPowerScript_Cloak::eventAdjustCooldown ( float* fCoolDownTime )
 
 bool USFXPowerScript_Cloak::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.SFXPowerScript_Cloak.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_Cloak.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	USFXPowerScript_Cloak_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -1565,98 +1411,74 @@ bool USFXPowerScript_Cloak::eventStartPhase ( unsigned char ePhase, class AActor
 
 
 
-class UClass* USFXPower_Cloak::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Cloak::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Cloak", &UObject::FindClass };
 
 class UClass* USFXPower_Cloak::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Cloak" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Barrier_NPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Barrier_NPC::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Barrier_NPC", &UObject::FindClass };
 
 class UClass* USFXPower_Barrier_NPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Barrier_NPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Barrier_Damage::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Barrier_Damage::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Barrier_Damage", &UObject::FindClass };
 
 class UClass* USFXPower_Barrier_Damage::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Barrier_Damage" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Barrier_Heavy::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Barrier_Heavy::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Barrier_Heavy", &UObject::FindClass };
 
 class UClass* USFXPower_Barrier_Heavy::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Barrier_Heavy" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_Barrier::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_Barrier::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_Barrier", &UObject::FindClass };
 
 class UClass* USFXPowerScript_Barrier::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_Barrier" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_LoyaltyRequirement::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_LoyaltyRequirement::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_LoyaltyRequirement", &UObject::FindClass };
 
 class UClass* USFXPower_LoyaltyRequirement::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_LoyaltyRequirement" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Barrier::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Barrier::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Barrier", &UObject::FindClass };
 
 class UClass* USFXPower_Barrier::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Barrier" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_DefensiveShieldBase::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_DefensiveShieldBase::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase", &UObject::FindClass };
 
 class UClass* USFXPowerScript_DefensiveShieldBase::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase.ShouldUsePower
@@ -1669,10 +1491,9 @@ class UClass* USFXPowerScript_DefensiveShieldBase::StaticClass()
 
 bool USFXPowerScript_DefensiveShieldBase::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerScript_DefensiveShieldBase_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -1700,10 +1521,9 @@ bool USFXPowerScript_DefensiveShieldBase::ShouldUsePower ( class AActor* Caster,
 
 bool USFXPowerScript_DefensiveShieldBase::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerScript_DefensiveShieldBase_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -1724,10 +1544,9 @@ bool USFXPowerScript_DefensiveShieldBase::eventOnImpact ( class AActor* oCaster,
 
 void USFXPowerScript_DefensiveShieldBase::OnShieldDestroyed ( class AActor* ShieldActor, class ASFXShield_Base* Shield )
 {
-	static UFunction* pFnOnShieldDestroyed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnShieldDestroyedRef { L"Function SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase.OnShieldDestroyed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnShieldDestroyed )
-		pFnOnShieldDestroyed = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase.OnShieldDestroyed" );
+	UFunction* const pFnOnShieldDestroyed = pFnOnShieldDestroyedRef.Get ( );
 
 	USFXPowerScript_DefensiveShieldBase_execOnShieldDestroyed_Parms OnShieldDestroyed_Parms;
 	OnShieldDestroyed_Parms.ShieldActor = ShieldActor;
@@ -1742,10 +1561,9 @@ void USFXPowerScript_DefensiveShieldBase::OnShieldDestroyed ( class AActor* Shie
 
 void USFXPowerScript_DefensiveShieldBase::eventInitializePowerScript ( )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	USFXPowerScript_DefensiveShieldBase_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 
@@ -1754,14 +1572,11 @@ void USFXPowerScript_DefensiveShieldBase::eventInitializePowerScript ( )
 
 
 
-class UClass* USFXPower_DefensiveShieldBase::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_DefensiveShieldBase::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_DefensiveShieldBase", &UObject::FindClass };
 
 class UClass* USFXPower_DefensiveShieldBase::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_DefensiveShieldBase" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPower_DefensiveShieldBase.GetShieldValue
@@ -1771,10 +1586,9 @@ class UClass* USFXPower_DefensiveShieldBase::StaticClass()
 
 float USFXPower_DefensiveShieldBase::GetShieldValue ( )
 {
-	static UFunction* pFnGetShieldValue = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetShieldValueRef { L"Function SFXGameContent_Powers.SFXPower_DefensiveShieldBase.GetShieldValue", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetShieldValue )
-		pFnGetShieldValue = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPower_DefensiveShieldBase.GetShieldValue" );
+	UFunction* const pFnGetShieldValue = pFnGetShieldValueRef.Get ( );
 
 	USFXPower_DefensiveShieldBase_execGetShieldValue_Parms GetShieldValue_Parms;
 
@@ -1785,26 +1599,20 @@ float USFXPower_DefensiveShieldBase::GetShieldValue ( )
 
 
 
-class UClass* USFXPower_CombatDrone_Tech::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CombatDrone_Tech::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Tech", &UObject::FindClass };
 
 class UClass* USFXPower_CombatDrone_Tech::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Tech" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXPawn_EngineerTechDrone::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXPawn_EngineerTechDrone::pClassPointer { L"Class SFXGameContent_Powers.SFXPawn_EngineerTechDrone", &UObject::FindClass };
 
 class UClass* ASFXPawn_EngineerTechDrone::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPawn_EngineerTechDrone" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPawn_EngineerTechDrone.SpawnDeathVFX
@@ -1813,10 +1621,9 @@ class UClass* ASFXPawn_EngineerTechDrone::StaticClass()
 
 void ASFXPawn_EngineerTechDrone::SpawnDeathVFX ( )
 {
-	static UFunction* pFnSpawnDeathVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSpawnDeathVFXRef { L"Function SFXGameContent_Powers.SFXPawn_EngineerTechDrone.SpawnDeathVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSpawnDeathVFX )
-		pFnSpawnDeathVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPawn_EngineerTechDrone.SpawnDeathVFX" );
+	UFunction* const pFnSpawnDeathVFX = pFnSpawnDeathVFXRef.Get ( );
 
 	ASFXPawn_EngineerTechDrone_execSpawnDeathVFX_Parms SpawnDeathVFX_Parms;
 
@@ -1833,10 +1640,9 @@ void ASFXPawn_EngineerTechDrone::SpawnDeathVFX ( )
 
 bool ASFXPawn_EngineerTechDrone::eventDied ( class AController* Killer, class UClass* DamageType, struct FVector const& HitLocation )
 {
-	static UFunction* pFnDied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDiedRef { L"Function SFXGameContent_Powers.SFXPawn_EngineerTechDrone.Died", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDied )
-		pFnDied = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPawn_EngineerTechDrone.Died" );
+	UFunction* const pFnDied = pFnDiedRef.Get ( );
 
 	ASFXPawn_EngineerTechDrone_eventDied_Parms Died_Parms;
 	Died_Parms.Killer = Killer;
@@ -1850,38 +1656,29 @@ bool ASFXPawn_EngineerTechDrone::eventDied ( class AController* Killer, class UC
 
 
 
-class UClass* ASFXPawn_EngineerRocketDrone::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXPawn_EngineerRocketDrone::pClassPointer { L"Class SFXGameContent_Powers.SFXPawn_EngineerRocketDrone", &UObject::FindClass };
 
 class UClass* ASFXPawn_EngineerRocketDrone::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPawn_EngineerRocketDrone" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXPawn_EngineerCombatDrone_NPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXPawn_EngineerCombatDrone_NPC::pClassPointer { L"Class SFXGameContent_Powers.SFXPawn_EngineerCombatDrone_NPC", &UObject::FindClass };
 
 class UClass* ASFXPawn_EngineerCombatDrone_NPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPawn_EngineerCombatDrone_NPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_OverheatWeapons::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_OverheatWeapons::pClassPointer { L"Class SFXGameContent_Powers.SFXGameEffect_OverheatWeapons", &UObject::FindClass };
 
 class UClass* USFXGameEffect_OverheatWeapons::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXGameEffect_OverheatWeapons" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXGameEffect_OverheatWeapons.OnRemoved
@@ -1890,10 +1687,9 @@ class UClass* USFXGameEffect_OverheatWeapons::StaticClass()
 
 void USFXGameEffect_OverheatWeapons::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent_Powers.SFXGameEffect_OverheatWeapons.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_OverheatWeapons.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_OverheatWeapons_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -1906,10 +1702,9 @@ void USFXGameEffect_OverheatWeapons::OnRemoved ( )
 
 void USFXGameEffect_OverheatWeapons::OverheatWeapon ( )
 {
-	static UFunction* pFnOverheatWeapon = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOverheatWeaponRef { L"Function SFXGameContent_Powers.SFXGameEffect_OverheatWeapons.OverheatWeapon", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOverheatWeapon )
-		pFnOverheatWeapon = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_OverheatWeapons.OverheatWeapon" );
+	UFunction* const pFnOverheatWeapon = pFnOverheatWeaponRef.Get ( );
 
 	USFXGameEffect_OverheatWeapons_execOverheatWeapon_Parms OverheatWeapon_Parms;
 
@@ -1923,10 +1718,9 @@ void USFXGameEffect_OverheatWeapons::OverheatWeapon ( )
 
 void USFXGameEffect_OverheatWeapons::OnUpdate ( float DeltaSeconds )
 {
-	static UFunction* pFnOnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUpdateRef { L"Function SFXGameContent_Powers.SFXGameEffect_OverheatWeapons.OnUpdate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUpdate )
-		pFnOnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_OverheatWeapons.OnUpdate" );
+	UFunction* const pFnOnUpdate = pFnOnUpdateRef.Get ( );
 
 	USFXGameEffect_OverheatWeapons_execOnUpdate_Parms OnUpdate_Parms;
 	OnUpdate_Parms.DeltaSeconds = DeltaSeconds;
@@ -1940,10 +1734,9 @@ void USFXGameEffect_OverheatWeapons::OnUpdate ( float DeltaSeconds )
 
 void USFXGameEffect_OverheatWeapons::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent_Powers.SFXGameEffect_OverheatWeapons.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_OverheatWeapons.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_OverheatWeapons_execOnApplied_Parms OnApplied_Parms;
 
@@ -1952,14 +1745,11 @@ void USFXGameEffect_OverheatWeapons::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_CloakVFX::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_CloakVFX::pClassPointer { L"Class SFXGameContent_Powers.SFXGameEffect_CloakVFX", &UObject::FindClass };
 
 class UClass* USFXGameEffect_CloakVFX::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXGameEffect_CloakVFX" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.EndStealthVFX
@@ -1968,10 +1758,9 @@ class UClass* USFXGameEffect_CloakVFX::StaticClass()
 
 void USFXGameEffect_CloakVFX::EndStealthVFX ( )
 {
-	static UFunction* pFnEndStealthVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndStealthVFXRef { L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.EndStealthVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndStealthVFX )
-		pFnEndStealthVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.EndStealthVFX" );
+	UFunction* const pFnEndStealthVFX = pFnEndStealthVFXRef.Get ( );
 
 	USFXGameEffect_CloakVFX_execEndStealthVFX_Parms EndStealthVFX_Parms;
 
@@ -1985,10 +1774,9 @@ void USFXGameEffect_CloakVFX::EndStealthVFX ( )
 
 void USFXGameEffect_CloakVFX::RestoreMeshMaterials ( class USkeletalMeshComponent* Mesh )
 {
-	static UFunction* pFnRestoreMeshMaterials = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRestoreMeshMaterialsRef { L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.RestoreMeshMaterials", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRestoreMeshMaterials )
-		pFnRestoreMeshMaterials = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.RestoreMeshMaterials" );
+	UFunction* const pFnRestoreMeshMaterials = pFnRestoreMeshMaterialsRef.Get ( );
 
 	USFXGameEffect_CloakVFX_execRestoreMeshMaterials_Parms RestoreMeshMaterials_Parms;
 	RestoreMeshMaterials_Parms.Mesh = Mesh;
@@ -2002,10 +1790,9 @@ void USFXGameEffect_CloakVFX::RestoreMeshMaterials ( class USkeletalMeshComponen
 
 void USFXGameEffect_CloakVFX::TransitionOff ( )
 {
-	static UFunction* pFnTransitionOff = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTransitionOffRef { L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.TransitionOff", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTransitionOff )
-		pFnTransitionOff = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.TransitionOff" );
+	UFunction* const pFnTransitionOff = pFnTransitionOffRef.Get ( );
 
 	USFXGameEffect_CloakVFX_execTransitionOff_Parms TransitionOff_Parms;
 
@@ -2018,10 +1805,9 @@ void USFXGameEffect_CloakVFX::TransitionOff ( )
 
 void USFXGameEffect_CloakVFX::DelayedTransitionOff ( )
 {
-	static UFunction* pFnDelayedTransitionOff = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDelayedTransitionOffRef { L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.DelayedTransitionOff", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDelayedTransitionOff )
-		pFnDelayedTransitionOff = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.DelayedTransitionOff" );
+	UFunction* const pFnDelayedTransitionOff = pFnDelayedTransitionOffRef.Get ( );
 
 	USFXGameEffect_CloakVFX_execDelayedTransitionOff_Parms DelayedTransitionOff_Parms;
 
@@ -2034,10 +1820,9 @@ void USFXGameEffect_CloakVFX::DelayedTransitionOff ( )
 
 void USFXGameEffect_CloakVFX::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_CloakVFX_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -2051,10 +1836,9 @@ void USFXGameEffect_CloakVFX::OnRemoved ( )
 
 void USFXGameEffect_CloakVFX::OnUpdate ( float DeltaSeconds )
 {
-	static UFunction* pFnOnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUpdateRef { L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.OnUpdate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUpdate )
-		pFnOnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.OnUpdate" );
+	UFunction* const pFnOnUpdate = pFnOnUpdateRef.Get ( );
 
 	USFXGameEffect_CloakVFX_execOnUpdate_Parms OnUpdate_Parms;
 	OnUpdate_Parms.DeltaSeconds = DeltaSeconds;
@@ -2068,10 +1852,9 @@ void USFXGameEffect_CloakVFX::OnUpdate ( float DeltaSeconds )
 
 void USFXGameEffect_CloakVFX::StartTransition ( )
 {
-	static UFunction* pFnStartTransition = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartTransitionRef { L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.StartTransition", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartTransition )
-		pFnStartTransition = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.StartTransition" );
+	UFunction* const pFnStartTransition = pFnStartTransitionRef.Get ( );
 
 	USFXGameEffect_CloakVFX_execStartTransition_Parms StartTransition_Parms;
 
@@ -2085,10 +1868,9 @@ void USFXGameEffect_CloakVFX::StartTransition ( )
 
 void USFXGameEffect_CloakVFX::SwapMeshMaterials ( class USkeletalMeshComponent* oSkeletalMesh )
 {
-	static UFunction* pFnSwapMeshMaterials = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSwapMeshMaterialsRef { L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.SwapMeshMaterials", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSwapMeshMaterials )
-		pFnSwapMeshMaterials = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.SwapMeshMaterials" );
+	UFunction* const pFnSwapMeshMaterials = pFnSwapMeshMaterialsRef.Get ( );
 
 	USFXGameEffect_CloakVFX_execSwapMeshMaterials_Parms SwapMeshMaterials_Parms;
 	SwapMeshMaterials_Parms.oSkeletalMesh = oSkeletalMesh;
@@ -2102,10 +1884,9 @@ void USFXGameEffect_CloakVFX::SwapMeshMaterials ( class USkeletalMeshComponent*
 
 void USFXGameEffect_CloakVFX::SwapInvisibleMaterials ( )
 {
-	static UFunction* pFnSwapInvisibleMaterials = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSwapInvisibleMaterialsRef { L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.SwapInvisibleMaterials", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSwapInvisibleMaterials )
-		pFnSwapInvisibleMaterials = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.SwapInvisibleMaterials" );
+	UFunction* const pFnSwapInvisibleMaterials = pFnSwapInvisibleMaterialsRef.Get ( );
 
 	USFXGameEffect_CloakVFX_execSwapInvisibleMaterials_Parms SwapInvisibleMaterials_Parms;
 
@@ -2119,10 +1900,9 @@ void USFXGameEffect_CloakVFX::SwapInvisibleMaterials ( )
 
 void USFXGameEffect_CloakVFX::StoreMeshMaterials ( class USkeletalMeshComponent* oSkeletalMesh )
 {
-	static UFunction* pFnStoreMeshMaterials = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStoreMeshMaterialsRef { L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.StoreMeshMaterials", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStoreMeshMaterials )
-		pFnStoreMeshMaterials = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.StoreMeshMaterials" );
+	UFunction* const pFnStoreMeshMaterials = pFnStoreMeshMaterialsRef.Get ( );
 
 	USFXGameEffect_CloakVFX_execStoreMeshMaterials_Parms StoreMeshMaterials_Parms;
 	StoreMeshMaterials_Parms.oSkeletalMesh = oSkeletalMesh;
@@ -2136,10 +1916,9 @@ void USFXGameEffect_CloakVFX::StoreMeshMaterials ( class USkeletalMeshComponent*
 
 void USFXGameEffect_CloakVFX::StoreStartingMaterials ( )
 {
-	static UFunction* pFnStoreStartingMaterials = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStoreStartingMaterialsRef { L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.StoreStartingMaterials", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStoreStartingMaterials )
-		pFnStoreStartingMaterials = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.StoreStartingMaterials" );
+	UFunction* const pFnStoreStartingMaterials = pFnStoreStartingMaterialsRef.Get ( );
 
 	USFXGameEffect_CloakVFX_execStoreStartingMaterials_Parms StoreStartingMaterials_Parms;
 
@@ -2152,10 +1931,9 @@ void USFXGameEffect_CloakVFX::StoreStartingMaterials ( )
 
 void USFXGameEffect_CloakVFX::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_CloakVFX_execOnApplied_Parms OnApplied_Parms;
 
@@ -2164,50 +1942,38 @@ void USFXGameEffect_CloakVFX::OnApplied ( )
 
 
 
-class UClass* USFXDamageType_CombatDroneShock::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_CombatDroneShock::pClassPointer { L"Class SFXGameContent_Powers.SFXDamageType_CombatDroneShock", &UObject::FindClass };
 
 class UClass* USFXDamageType_CombatDroneShock::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXDamageType_CombatDroneShock" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_CombatDroneAttack_NPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_CombatDroneAttack_NPC::pClassPointer { L"Class SFXGameContent_Powers.SFXDamageType_CombatDroneAttack_NPC", &UObject::FindClass };
 
 class UClass* USFXDamageType_CombatDroneAttack_NPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXDamageType_CombatDroneAttack_NPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_WarpProjectile::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_WarpProjectile::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_WarpProjectile", &UObject::FindClass };
 
 class UClass* USFXPower_WarpProjectile::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_WarpProjectile" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Warp_NPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Warp_NPC::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Warp_NPC", &UObject::FindClass };
 
 class UClass* USFXPower_Warp_NPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Warp_NPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPower_Warp_NPC.GetDamage
@@ -2217,10 +1983,9 @@ class UClass* USFXPower_Warp_NPC::StaticClass()
 
 float USFXPower_Warp_NPC::GetDamage ( )
 {
-	static UFunction* pFnGetDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDamageRef { L"Function SFXGameContent_Powers.SFXPower_Warp_NPC.GetDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDamage )
-		pFnGetDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPower_Warp_NPC.GetDamage" );
+	UFunction* const pFnGetDamage = pFnGetDamageRef.Get ( );
 
 	USFXPower_Warp_NPC_execGetDamage_Parms GetDamage_Parms;
 
@@ -2231,26 +1996,20 @@ float USFXPower_Warp_NPC::GetDamage ( )
 
 
 
-class UClass* USFXPower_Warp::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Warp::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Warp", &UObject::FindClass };
 
 class UClass* USFXPower_Warp::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Warp" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioWarpScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioWarpScript::pClassPointer { L"Class SFXGameContent_Powers.BioWarpScript", &UObject::FindClass };
 
 class UClass* UBioWarpScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioWarpScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioWarpScript.ShouldUsePower
@@ -2263,10 +2022,9 @@ class UClass* UBioWarpScript::StaticClass()
 
 bool UBioWarpScript::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.BioWarpScript.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWarpScript.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	UBioWarpScript_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -2291,10 +2049,9 @@ bool UBioWarpScript::ShouldUsePower ( class AActor* Caster, class AActor* Target
 
 void UBioWarpScript::TurnOffScriptSingularity ( class ABioPawn* PowerCaster, struct SFXName PowerName )
 {
-	static UFunction* pFnTurnOffScriptSingularity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTurnOffScriptSingularityRef { L"Function SFXGameContent_Powers.BioWarpScript.TurnOffScriptSingularity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTurnOffScriptSingularity )
-		pFnTurnOffScriptSingularity = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWarpScript.TurnOffScriptSingularity" );
+	UFunction* const pFnTurnOffScriptSingularity = pFnTurnOffScriptSingularityRef.Get ( );
 
 	UBioWarpScript_execTurnOffScriptSingularity_Parms TurnOffScriptSingularity_Parms;
 	TurnOffScriptSingularity_Parms.PowerCaster = PowerCaster;
@@ -2310,10 +2067,9 @@ void UBioWarpScript::TurnOffScriptSingularity ( class ABioPawn* PowerCaster, str
 
 void UBioWarpScript::StopSingularity ( class ABioPawn* oImpacted )
 {
-	static UFunction* pFnStopSingularity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopSingularityRef { L"Function SFXGameContent_Powers.BioWarpScript.StopSingularity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopSingularity )
-		pFnStopSingularity = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWarpScript.StopSingularity" );
+	UFunction* const pFnStopSingularity = pFnStopSingularityRef.Get ( );
 
 	UBioWarpScript_execStopSingularity_Parms StopSingularity_Parms;
 	StopSingularity_Parms.oImpacted = oImpacted;
@@ -2328,10 +2084,9 @@ void UBioWarpScript::StopSingularity ( class ABioPawn* oImpacted )
 
 void UBioWarpScript::SpawnBigImpactVFX ( class AActor* oImpacted )
 {
-	static UFunction* pFnSpawnBigImpactVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSpawnBigImpactVFXRef { L"Function SFXGameContent_Powers.BioWarpScript.SpawnBigImpactVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSpawnBigImpactVFX )
-		pFnSpawnBigImpactVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWarpScript.SpawnBigImpactVFX" );
+	UFunction* const pFnSpawnBigImpactVFX = pFnSpawnBigImpactVFXRef.Get ( );
 
 	UBioWarpScript_execSpawnBigImpactVFX_Parms SpawnBigImpactVFX_Parms;
 	SpawnBigImpactVFX_Parms.oImpacted = oImpacted;
@@ -2347,10 +2102,9 @@ void UBioWarpScript::SpawnBigImpactVFX ( class AActor* oImpacted )
 
 void UBioWarpScript::DetonateBiotics ( class AActor* oCaster, class AActor* oImpacted )
 {
-	static UFunction* pFnDetonateBiotics = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDetonateBioticsRef { L"Function SFXGameContent_Powers.BioWarpScript.DetonateBiotics", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDetonateBiotics )
-		pFnDetonateBiotics = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWarpScript.DetonateBiotics" );
+	UFunction* const pFnDetonateBiotics = pFnDetonateBioticsRef.Get ( );
 
 	UBioWarpScript_execDetonateBiotics_Parms DetonateBiotics_Parms;
 	DetonateBiotics_Parms.oCaster = oCaster;
@@ -2370,10 +2124,9 @@ void UBioWarpScript::DetonateBiotics ( class AActor* oCaster, class AActor* oImp
 
 bool UBioWarpScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioWarpScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWarpScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioWarpScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -2396,10 +2149,9 @@ bool UBioWarpScript::eventOnImpact ( class AActor* oCaster, float fCasterStabili
 
 bool UBioWarpScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioWarpScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWarpScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioWarpScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -2413,14 +2165,11 @@ bool UBioWarpScript::eventStartPhase ( unsigned char ePhase, class AActor* oCast
 
 
 
-class UClass* USFXPower_Singularity_NPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Singularity_NPC::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Singularity_NPC", &UObject::FindClass };
 
 class UClass* USFXPower_Singularity_NPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Singularity_NPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPower_Singularity_NPC.GetDamage
@@ -2430,10 +2179,9 @@ class UClass* USFXPower_Singularity_NPC::StaticClass()
 
 float USFXPower_Singularity_NPC::GetDamage ( )
 {
-	static UFunction* pFnGetDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDamageRef { L"Function SFXGameContent_Powers.SFXPower_Singularity_NPC.GetDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDamage )
-		pFnGetDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPower_Singularity_NPC.GetDamage" );
+	UFunction* const pFnGetDamage = pFnGetDamageRef.Get ( );
 
 	USFXPower_Singularity_NPC_execGetDamage_Parms GetDamage_Parms;
 
@@ -2444,26 +2192,20 @@ float USFXPower_Singularity_NPC::GetDamage ( )
 
 
 
-class UClass* USFXPower_Singularity::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Singularity::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Singularity", &UObject::FindClass };
 
 class UClass* USFXPower_Singularity::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Singularity" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioSingularityScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSingularityScript::pClassPointer { L"Class SFXGameContent_Powers.BioSingularityScript", &UObject::FindClass };
 
 class UClass* UBioSingularityScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioSingularityScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioSingularityScript.ShouldUsePower
@@ -2476,10 +2218,9 @@ class UClass* UBioSingularityScript::StaticClass()
 
 bool UBioSingularityScript::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.BioSingularityScript.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	UBioSingularityScript_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -2502,10 +2243,9 @@ bool UBioSingularityScript::ShouldUsePower ( class AActor* Caster, class AActor*
 
 void UBioSingularityScript::OnPowerRankIncreased ( )
 {
-	static UFunction* pFnOnPowerRankIncreased = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowerRankIncreasedRef { L"Function SFXGameContent_Powers.BioSingularityScript.OnPowerRankIncreased", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowerRankIncreased )
-		pFnOnPowerRankIncreased = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.OnPowerRankIncreased" );
+	UFunction* const pFnOnPowerRankIncreased = pFnOnPowerRankIncreasedRef.Get ( );
 
 	UBioSingularityScript_execOnPowerRankIncreased_Parms OnPowerRankIncreased_Parms;
 
@@ -2521,10 +2261,9 @@ void UBioSingularityScript::OnPowerRankIncreased ( )
 
 void UBioSingularityScript::OnRagdollPhysicsImpact ( class APawn* oPawn, class AActor* oImpactActor, struct FVector const& vImpactDir )
 {
-	static UFunction* pFnOnRagdollPhysicsImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRagdollPhysicsImpactRef { L"Function SFXGameContent_Powers.BioSingularityScript.OnRagdollPhysicsImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRagdollPhysicsImpact )
-		pFnOnRagdollPhysicsImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.OnRagdollPhysicsImpact" );
+	UFunction* const pFnOnRagdollPhysicsImpact = pFnOnRagdollPhysicsImpactRef.Get ( );
 
 	UBioSingularityScript_execOnRagdollPhysicsImpact_Parms OnRagdollPhysicsImpact_Parms;
 	OnRagdollPhysicsImpact_Parms.oPawn = oPawn;
@@ -2542,10 +2281,9 @@ void UBioSingularityScript::OnRagdollPhysicsImpact ( class APawn* oPawn, class A
 
 void UBioSingularityScript::ApplyVFX ( class AActor* oImpacted, float fDuration )
 {
-	static UFunction* pFnApplyVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyVFXRef { L"Function SFXGameContent_Powers.BioSingularityScript.ApplyVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyVFX )
-		pFnApplyVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.ApplyVFX" );
+	UFunction* const pFnApplyVFX = pFnApplyVFXRef.Get ( );
 
 	UBioSingularityScript_execApplyVFX_Parms ApplyVFX_Parms;
 	ApplyVFX_Parms.oImpacted = oImpacted;
@@ -2562,10 +2300,9 @@ void UBioSingularityScript::ApplyVFX ( class AActor* oImpacted, float fDuration
 
 void UBioSingularityScript::SpawnSingularity ( class AActor* oCaster, struct FVector const& Location )
 {
-	static UFunction* pFnSpawnSingularity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSpawnSingularityRef { L"Function SFXGameContent_Powers.BioSingularityScript.SpawnSingularity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSpawnSingularity )
-		pFnSpawnSingularity = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.SpawnSingularity" );
+	UFunction* const pFnSpawnSingularity = pFnSpawnSingularityRef.Get ( );
 
 	UBioSingularityScript_execSpawnSingularity_Parms SpawnSingularity_Parms;
 	SpawnSingularity_Parms.oCaster = oCaster;
@@ -2580,10 +2317,9 @@ void UBioSingularityScript::SpawnSingularity ( class AActor* oCaster, struct FVe
 
 void UBioSingularityScript::TurnOffSingularity ( )
 {
-	static UFunction* pFnTurnOffSingularity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTurnOffSingularityRef { L"Function SFXGameContent_Powers.BioSingularityScript.TurnOffSingularity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTurnOffSingularity )
-		pFnTurnOffSingularity = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.TurnOffSingularity" );
+	UFunction* const pFnTurnOffSingularity = pFnTurnOffSingularityRef.Get ( );
 
 	UBioSingularityScript_execTurnOffSingularity_Parms TurnOffSingularity_Parms;
 
@@ -2598,10 +2334,9 @@ void UBioSingularityScript::TurnOffSingularity ( )
 
 bool UBioSingularityScript::CanPutInSingularity ( class AActor* oActor )
 {
-	static UFunction* pFnCanPutInSingularity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPutInSingularityRef { L"Function SFXGameContent_Powers.BioSingularityScript.CanPutInSingularity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPutInSingularity )
-		pFnCanPutInSingularity = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.CanPutInSingularity" );
+	UFunction* const pFnCanPutInSingularity = pFnCanPutInSingularityRef.Get ( );
 
 	UBioSingularityScript_execCanPutInSingularity_Parms CanPutInSingularity_Parms;
 	CanPutInSingularity_Parms.oActor = oActor;
@@ -2620,10 +2355,9 @@ bool UBioSingularityScript::CanPutInSingularity ( class AActor* oActor )
 
 bool UBioSingularityScript::ImpactNewTarget ( class AActor* oImpacted, float* fEffectDuration )
 {
-	static UFunction* pFnImpactNewTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnImpactNewTargetRef { L"Function SFXGameContent_Powers.BioSingularityScript.ImpactNewTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnImpactNewTarget )
-		pFnImpactNewTarget = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.ImpactNewTarget" );
+	UFunction* const pFnImpactNewTarget = pFnImpactNewTargetRef.Get ( );
 
 	UBioSingularityScript_execImpactNewTarget_Parms ImpactNewTarget_Parms;
 	ImpactNewTarget_Parms.oImpacted = oImpacted;
@@ -2646,10 +2380,9 @@ bool UBioSingularityScript::ImpactNewTarget ( class AActor* oImpacted, float* fE
 
 void UBioSingularityScript::eventTick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickRef { L"Function SFXGameContent_Powers.BioSingularityScript.Tick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTick )
-		pFnTick = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.Tick" );
+	UFunction* const pFnTick = pFnTickRef.Get ( );
 
 	UBioSingularityScript_eventTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -2667,10 +2400,9 @@ void UBioSingularityScript::eventTick ( float DeltaTime )
 
 void UBioSingularityScript::OnProjectileExploded ( class AActor* oCaster, struct FVector const& HitLocation, struct FVector const& HitNormal, struct FVector const& Velocity )
 {
-	static UFunction* pFnOnProjectileExploded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnProjectileExplodedRef { L"Function SFXGameContent_Powers.BioSingularityScript.OnProjectileExploded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnProjectileExploded )
-		pFnOnProjectileExploded = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.OnProjectileExploded" );
+	UFunction* const pFnOnProjectileExploded = pFnOnProjectileExplodedRef.Get ( );
 
 	UBioSingularityScript_execOnProjectileExploded_Parms OnProjectileExploded_Parms;
 	OnProjectileExploded_Parms.oCaster = oCaster;
@@ -2691,10 +2423,9 @@ void UBioSingularityScript::OnProjectileExploded ( class AActor* oCaster, struct
 
 bool UBioSingularityScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioSingularityScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioSingularityScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -2712,10 +2443,9 @@ bool UBioSingularityScript::eventStartPhase ( unsigned char ePhase, class AActor
 
 void UBioSingularityScript::eventInitializePowerScript ( )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioSingularityScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioSingularityScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioSingularityScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 
@@ -2724,14 +2454,11 @@ void UBioSingularityScript::eventInitializePowerScript ( )
 
 
 
-class UClass* UBioReactionPowerScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioReactionPowerScript::pClassPointer { L"Class SFXGameContent_Powers.BioReactionPowerScript", &UObject::FindClass };
 
 class UClass* UBioReactionPowerScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioReactionPowerScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioReactionPowerScript.GetIncreasedReaction
@@ -2743,10 +2470,9 @@ class UClass* UBioReactionPowerScript::StaticClass()
 
 unsigned char UBioReactionPowerScript::GetIncreasedReaction ( class AActor* oTarget, unsigned char Reaction )
 {
-	static UFunction* pFnGetIncreasedReaction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetIncreasedReactionRef { L"Function SFXGameContent_Powers.BioReactionPowerScript.GetIncreasedReaction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetIncreasedReaction )
-		pFnGetIncreasedReaction = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioReactionPowerScript.GetIncreasedReaction" );
+	UFunction* const pFnGetIncreasedReaction = pFnGetIncreasedReactionRef.Get ( );
 
 	UBioReactionPowerScript_execGetIncreasedReaction_Parms GetIncreasedReaction_Parms;
 	GetIncreasedReaction_Parms.oTarget = oTarget;
@@ -2767,10 +2493,9 @@ unsigned char UBioReactionPowerScript::GetIncreasedReaction ( class AActor* oTar
 
 unsigned char UBioReactionPowerScript::GetCombatReaction ( int PowerRank, class AActor* oTarget, unsigned long ReactionStacks )
 {
-	static UFunction* pFnGetCombatReaction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetCombatReactionRef { L"Function SFXGameContent_Powers.BioReactionPowerScript.GetCombatReaction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetCombatReaction )
-		pFnGetCombatReaction = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioReactionPowerScript.GetCombatReaction" );
+	UFunction* const pFnGetCombatReaction = pFnGetCombatReactionRef.Get ( );
 
 	UBioReactionPowerScript_execGetCombatReaction_Parms GetCombatReaction_Parms;
 	GetCombatReaction_Parms.PowerRank = PowerRank;
@@ -2784,14 +2509,11 @@ unsigned char UBioReactionPowerScript::GetCombatReaction ( int PowerRank, class
 
 
 
-class UClass* USFXGameEffect_IgnorePawn::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_IgnorePawn::pClassPointer { L"Class SFXGameContent_Powers.SFXGameEffect_IgnorePawn", &UObject::FindClass };
 
 class UClass* USFXGameEffect_IgnorePawn::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXGameEffect_IgnorePawn" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXGameEffect_IgnorePawn.OnRemoved
@@ -2800,10 +2522,9 @@ class UClass* USFXGameEffect_IgnorePawn::StaticClass()
 
 void USFXGameEffect_IgnorePawn::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent_Powers.SFXGameEffect_IgnorePawn.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_IgnorePawn.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_IgnorePawn_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -2816,10 +2537,9 @@ void USFXGameEffect_IgnorePawn::OnRemoved ( )
 
 void USFXGameEffect_IgnorePawn::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent_Powers.SFXGameEffect_IgnorePawn.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_IgnorePawn.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_IgnorePawn_execOnApplied_Parms OnApplied_Parms;
 
@@ -2828,14 +2548,11 @@ void USFXGameEffect_IgnorePawn::OnApplied ( )
 
 
 
-class UClass* ASFXPawn_EngineerCombatDrone::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXPawn_EngineerCombatDrone::pClassPointer { L"Class SFXGameContent_Powers.SFXPawn_EngineerCombatDrone", &UObject::FindClass };
 
 class UClass* ASFXPawn_EngineerCombatDrone::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPawn_EngineerCombatDrone" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.PlayDeathVocalization
@@ -2845,10 +2562,9 @@ class UClass* ASFXPawn_EngineerCombatDrone::StaticClass()
 
 void ASFXPawn_EngineerCombatDrone::PlayDeathVocalization ( class ABioPawn* Killer )
 {
-	static UFunction* pFnPlayDeathVocalization = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayDeathVocalizationRef { L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.PlayDeathVocalization", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayDeathVocalization )
-		pFnPlayDeathVocalization = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.PlayDeathVocalization" );
+	UFunction* const pFnPlayDeathVocalization = pFnPlayDeathVocalizationRef.Get ( );
 
 	ASFXPawn_EngineerCombatDrone_execPlayDeathVocalization_Parms PlayDeathVocalization_Parms;
 	PlayDeathVocalization_Parms.Killer = Killer;
@@ -2862,10 +2578,9 @@ void ASFXPawn_EngineerCombatDrone::PlayDeathVocalization ( class ABioPawn* Kille
 
 void ASFXPawn_EngineerCombatDrone::eventDestroyed ( )
 {
-	static UFunction* pFnDestroyed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDestroyedRef { L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.Destroyed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDestroyed )
-		pFnDestroyed = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.Destroyed" );
+	UFunction* const pFnDestroyed = pFnDestroyedRef.Get ( );
 
 	ASFXPawn_EngineerCombatDrone_eventDestroyed_Parms Destroyed_Parms;
 
@@ -2882,10 +2597,9 @@ void ASFXPawn_EngineerCombatDrone::eventDestroyed ( )
 
 bool ASFXPawn_EngineerCombatDrone::eventDied ( class AController* Killer, class UClass* DamageType, struct FVector const& HitLocation )
 {
-	static UFunction* pFnDied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDiedRef { L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.Died", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDied )
-		pFnDied = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.Died" );
+	UFunction* const pFnDied = pFnDiedRef.Get ( );
 
 	ASFXPawn_EngineerCombatDrone_eventDied_Parms Died_Parms;
 	Died_Parms.Killer = Killer;
@@ -2904,10 +2618,9 @@ bool ASFXPawn_EngineerCombatDrone::eventDied ( class AController* Killer, class
 
 void ASFXPawn_EngineerCombatDrone::SetDroneColor2 ( struct FVector const& NewColor )
 {
-	static UFunction* pFnSetDroneColor2 = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetDroneColor2Ref { L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.SetDroneColor2", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetDroneColor2 )
-		pFnSetDroneColor2 = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.SetDroneColor2" );
+	UFunction* const pFnSetDroneColor2 = pFnSetDroneColor2Ref.Get ( );
 
 	ASFXPawn_EngineerCombatDrone_execSetDroneColor2_Parms SetDroneColor2_Parms;
 	memcpy ( &SetDroneColor2_Parms.NewColor, &NewColor, 0xC );
@@ -2922,10 +2635,9 @@ void ASFXPawn_EngineerCombatDrone::SetDroneColor2 ( struct FVector const& NewCol
 
 void ASFXPawn_EngineerCombatDrone::SetDroneColor ( struct FVector const& NewColor )
 {
-	static UFunction* pFnSetDroneColor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetDroneColorRef { L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.SetDroneColor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetDroneColor )
-		pFnSetDroneColor = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.SetDroneColor" );
+	UFunction* const pFnSetDroneColor = pFnSetDroneColorRef.Get ( );
 
 	ASFXPawn_EngineerCombatDrone_execSetDroneColor_Parms SetDroneColor_Parms;
 	memcpy ( &SetDroneColor_Parms.NewColor, &NewColor, 0xC );
@@ -2939,10 +2651,9 @@ void ASFXPawn_EngineerCombatDrone::SetDroneColor ( struct FVector const& NewColo
 
 void ASFXPawn_EngineerCombatDrone::PostBeginPlay ( )
 {
-	static UFunction* pFnPostBeginPlay = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPostBeginPlayRef { L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.PostBeginPlay", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPostBeginPlay )
-		pFnPostBeginPlay = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.PostBeginPlay" );
+	UFunction* const pFnPostBeginPlay = pFnPostBeginPlayRef.Get ( );
 
 	ASFXPawn_EngineerCombatDrone_execPostBeginPlay_Parms PostBeginPlay_Parms;
 
@@ -2955,10 +2666,9 @@ void ASFXPawn_EngineerCombatDrone::PostBeginPlay ( )
 
 void ASFXPawn_EngineerCombatDrone::OnDroneKilled ( )
 {
-	static UFunction* pFnOnDroneKilled = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnDroneKilledRef { L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.OnDroneKilled", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnDroneKilled )
-		pFnOnDroneKilled = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.OnDroneKilled" );
+	UFunction* const pFnOnDroneKilled = pFnOnDroneKilledRef.Get ( );
 
 	ASFXPawn_EngineerCombatDrone_execOnDroneKilled_Parms OnDroneKilled_Parms;
 
@@ -2967,14 +2677,11 @@ void ASFXPawn_EngineerCombatDrone::OnDroneKilled ( )
 
 
 
-class UClass* USFXPower_CombatDrone::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CombatDrone::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CombatDrone", &UObject::FindClass };
 
 class UClass* USFXPower_CombatDrone::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CombatDrone" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPower_CombatDrone.GetHealthMultiplier
@@ -2984,10 +2691,9 @@ class UClass* USFXPower_CombatDrone::StaticClass()
 
 float USFXPower_CombatDrone::GetHealthMultiplier ( )
 {
-	static UFunction* pFnGetHealthMultiplier = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetHealthMultiplierRef { L"Function SFXGameContent_Powers.SFXPower_CombatDrone.GetHealthMultiplier", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetHealthMultiplier )
-		pFnGetHealthMultiplier = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPower_CombatDrone.GetHealthMultiplier" );
+	UFunction* const pFnGetHealthMultiplier = pFnGetHealthMultiplierRef.Get ( );
 
 	USFXPower_CombatDrone_execGetHealthMultiplier_Parms GetHealthMultiplier_Parms;
 
@@ -2998,14 +2704,11 @@ float USFXPower_CombatDrone::GetHealthMultiplier ( )
 
 
 
-class UClass* UBioCombatDroneScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioCombatDroneScript::pClassPointer { L"Class SFXGameContent_Powers.BioCombatDroneScript", &UObject::FindClass };
 
 class UClass* UBioCombatDroneScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioCombatDroneScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioCombatDroneScript.ShouldUsePower
@@ -3018,10 +2721,9 @@ class UClass* UBioCombatDroneScript::StaticClass()
 
 bool UBioCombatDroneScript::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.BioCombatDroneScript.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCombatDroneScript.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	UBioCombatDroneScript_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -3044,10 +2746,9 @@ bool UBioCombatDroneScript::ShouldUsePower ( class AActor* Caster, class AActor*
 
 void UBioCombatDroneScript::OnDroneKilled ( )
 {
-	static UFunction* pFnOnDroneKilled = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnDroneKilledRef { L"Function SFXGameContent_Powers.BioCombatDroneScript.OnDroneKilled", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnDroneKilled )
-		pFnOnDroneKilled = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCombatDroneScript.OnDroneKilled" );
+	UFunction* const pFnOnDroneKilled = pFnOnDroneKilledRef.Get ( );
 
 	UBioCombatDroneScript_execOnDroneKilled_Parms OnDroneKilled_Parms;
 
@@ -3060,10 +2761,9 @@ void UBioCombatDroneScript::OnDroneKilled ( )
 
 void UBioCombatDroneScript::DespawnDrone ( )
 {
-	static UFunction* pFnDespawnDrone = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDespawnDroneRef { L"Function SFXGameContent_Powers.BioCombatDroneScript.DespawnDrone", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDespawnDrone )
-		pFnDespawnDrone = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCombatDroneScript.DespawnDrone" );
+	UFunction* const pFnDespawnDrone = pFnDespawnDroneRef.Get ( );
 
 	UBioCombatDroneScript_execDespawnDrone_Parms DespawnDrone_Parms;
 
@@ -3076,10 +2776,9 @@ void UBioCombatDroneScript::DespawnDrone ( )
 
 void UBioCombatDroneScript::OnOwnerDied ( )
 {
-	static UFunction* pFnOnOwnerDied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnOwnerDiedRef { L"Function SFXGameContent_Powers.BioCombatDroneScript.OnOwnerDied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnOwnerDied )
-		pFnOnOwnerDied = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCombatDroneScript.OnOwnerDied" );
+	UFunction* const pFnOnOwnerDied = pFnOnOwnerDiedRef.Get ( );
 
 	UBioCombatDroneScript_execOnOwnerDied_Parms OnOwnerDied_Parms;
 
@@ -3092,10 +2791,9 @@ void UBioCombatDroneScript::OnOwnerDied ( )
 
 void UBioCombatDroneScript::OnPowerRankIncreased ( )
 {
-	static UFunction* pFnOnPowerRankIncreased = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowerRankIncreasedRef { L"Function SFXGameContent_Powers.BioCombatDroneScript.OnPowerRankIncreased", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowerRankIncreased )
-		pFnOnPowerRankIncreased = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCombatDroneScript.OnPowerRankIncreased" );
+	UFunction* const pFnOnPowerRankIncreased = pFnOnPowerRankIncreasedRef.Get ( );
 
 	UBioCombatDroneScript_execOnPowerRankIncreased_Parms OnPowerRankIncreased_Parms;
 
@@ -3120,10 +2818,9 @@ void UBioCombatDroneScript::OnPowerRankIncreased ( )
 
 class ABioPawn* UBioCombatDroneScript::SpawnDrone ( class ABioPawn* oCaster, class UClass* DroneClass, struct FVector const& Location, struct FRotator const& Rotation, float HealthMultiplier, float Lifetime, unsigned long bCustomColor, struct FVector const& CustomColor, unsigned long bCustomColor2, struct FVector const& CustomColor2, class AActor* DroneTarget )
 {
-	static UFunction* pFnSpawnDrone = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSpawnDroneRef { L"Function SFXGameContent_Powers.BioCombatDroneScript.SpawnDrone", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSpawnDrone )
-		pFnSpawnDrone = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCombatDroneScript.SpawnDrone" );
+	UFunction* const pFnSpawnDrone = pFnSpawnDroneRef.Get ( );
 
 	UBioCombatDroneScript_execSpawnDrone_Parms SpawnDrone_Parms;
 	SpawnDrone_Parms.oCaster = oCaster;
@@ -3150,10 +2847,9 @@ class ABioPawn* UBioCombatDroneScript::SpawnDrone ( class ABioPawn* oCaster, cla
 
 struct FVector UBioCombatDroneScript::GetSpawnLocation ( )
 {
-	static UFunction* pFnGetSpawnLocation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetSpawnLocationRef { L"Function SFXGameContent_Powers.BioCombatDroneScript.GetSpawnLocation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetSpawnLocation )
-		pFnGetSpawnLocation = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCombatDroneScript.GetSpawnLocation" );
+	UFunction* const pFnGetSpawnLocation = pFnGetSpawnLocationRef.Get ( );
 
 	UBioCombatDroneScript_execGetSpawnLocation_Parms GetSpawnLocation_Parms;
 
@@ -3170,10 +2866,9 @@ struct FVector UBioCombatDroneScript::GetSpawnLocation ( )
 
 struct FVector UBioCombatDroneScript::GetBackLocation ( class AActor* Target )
 {
-	static UFunction* pFnGetBackLocation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetBackLocationRef { L"Function SFXGameContent_Powers.BioCombatDroneScript.GetBackLocation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetBackLocation )
-		pFnGetBackLocation = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCombatDroneScript.GetBackLocation" );
+	UFunction* const pFnGetBackLocation = pFnGetBackLocationRef.Get ( );
 
 	UBioCombatDroneScript_execGetBackLocation_Parms GetBackLocation_Parms;
 	GetBackLocation_Parms.Target = Target;
@@ -3192,10 +2887,9 @@ struct FVector UBioCombatDroneScript::GetBackLocation ( class AActor* Target )
 
 struct FVector UBioCombatDroneScript::GetFrontLocation ( class AActor* Target, float YawOffset )
 {
-	static UFunction* pFnGetFrontLocation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetFrontLocationRef { L"Function SFXGameContent_Powers.BioCombatDroneScript.GetFrontLocation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetFrontLocation )
-		pFnGetFrontLocation = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCombatDroneScript.GetFrontLocation" );
+	UFunction* const pFnGetFrontLocation = pFnGetFrontLocationRef.Get ( );
 
 	UBioCombatDroneScript_execGetFrontLocation_Parms GetFrontLocation_Parms;
 	GetFrontLocation_Parms.Target = Target;
@@ -3214,10 +2908,9 @@ struct FVector UBioCombatDroneScript::GetFrontLocation ( class AActor* Target, f
 
 bool UBioCombatDroneScript::IsSafeSpawnLocation ( struct FVector* SpawnLocation )
 {
-	static UFunction* pFnIsSafeSpawnLocation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsSafeSpawnLocationRef { L"Function SFXGameContent_Powers.BioCombatDroneScript.IsSafeSpawnLocation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsSafeSpawnLocation )
-		pFnIsSafeSpawnLocation = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCombatDroneScript.IsSafeSpawnLocation" );
+	UFunction* const pFnIsSafeSpawnLocation = pFnIsSafeSpawnLocationRef.Get ( );
 
 	UBioCombatDroneScript_execIsSafeSpawnLocation_Parms IsSafeSpawnLocation_Parms;
 
@@ -3239,10 +2932,9 @@ bool UBioCombatDroneScript::IsSafeSpawnLocation ( struct FVector* SpawnLocation
 
 bool UBioCombatDroneScript::IsDroneAlive ( )
 {
-	static UFunction* pFnIsDroneAlive = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsDroneAliveRef { L"Function SFXGameContent_Powers.BioCombatDroneScript.IsDroneAlive", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsDroneAlive )
-		pFnIsDroneAlive = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCombatDroneScript.IsDroneAlive" );
+	UFunction* const pFnIsDroneAlive = pFnIsDroneAliveRef.Get ( );
 
 	UBioCombatDroneScript_execIsDroneAlive_Parms IsDroneAlive_Parms;
 
@@ -3261,10 +2953,9 @@ bool UBioCombatDroneScript::IsDroneAlive ( )
 
 bool UBioCombatDroneScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioCombatDroneScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCombatDroneScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioCombatDroneScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -3284,10 +2975,9 @@ bool UBioCombatDroneScript::eventStartPhase ( unsigned char ePhase, class AActor
 
 bool UBioCombatDroneScript::eventCanStartPower ( class AActor* oCaster )
 {
-	static UFunction* pFnCanStartPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanStartPowerRef { L"Function SFXGameContent_Powers.BioCombatDroneScript.CanStartPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanStartPower )
-		pFnCanStartPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCombatDroneScript.CanStartPower" );
+	UFunction* const pFnCanStartPower = pFnCanStartPowerRef.Get ( );
 
 	UBioCombatDroneScript_eventCanStartPower_Parms CanStartPower_Parms;
 	CanStartPower_Parms.oCaster = oCaster;
@@ -3299,38 +2989,29 @@ bool UBioCombatDroneScript::eventCanStartPower ( class AActor* oCaster )
 
 
 
-class UClass* USFXPower_TaliPassive_Evolved2::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_TaliPassive_Evolved2::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_TaliPassive_Evolved2", &UObject::FindClass };
 
 class UClass* USFXPower_TaliPassive_Evolved2::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_TaliPassive_Evolved2" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_TaliPassive_Evolved1::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_TaliPassive_Evolved1::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_TaliPassive_Evolved1", &UObject::FindClass };
 
 class UClass* USFXPower_TaliPassive_Evolved1::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_TaliPassive_Evolved1" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_HenchmanPassive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_HenchmanPassive::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_HenchmanPassive", &UObject::FindClass };
 
 class UClass* USFXPowerScript_HenchmanPassive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_HenchmanPassive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_HenchmanPassive.ApplyGlobalBonus
@@ -3339,10 +3020,9 @@ class UClass* USFXPowerScript_HenchmanPassive::StaticClass()
 
 void USFXPowerScript_HenchmanPassive::ApplyGlobalBonus ( )
 {
-	static UFunction* pFnApplyGlobalBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyGlobalBonusRef { L"Function SFXGameContent_Powers.SFXPowerScript_HenchmanPassive.ApplyGlobalBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyGlobalBonus )
-		pFnApplyGlobalBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_HenchmanPassive.ApplyGlobalBonus" );
+	UFunction* const pFnApplyGlobalBonus = pFnApplyGlobalBonusRef.Get ( );
 
 	USFXPowerScript_HenchmanPassive_execApplyGlobalBonus_Parms ApplyGlobalBonus_Parms;
 
@@ -3351,14 +3031,11 @@ void USFXPowerScript_HenchmanPassive::ApplyGlobalBonus ( )
 
 
 
-class UClass* USFXPowerScript_TaliPassive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_TaliPassive::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_TaliPassive", &UObject::FindClass };
 
 class UClass* USFXPowerScript_TaliPassive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_TaliPassive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_TaliPassive.ApplyGlobalBonus
@@ -3367,10 +3044,9 @@ class UClass* USFXPowerScript_TaliPassive::StaticClass()
 
 void USFXPowerScript_TaliPassive::ApplyGlobalBonus ( )
 {
-	static UFunction* pFnApplyGlobalBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyGlobalBonusRef { L"Function SFXGameContent_Powers.SFXPowerScript_TaliPassive.ApplyGlobalBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyGlobalBonus )
-		pFnApplyGlobalBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_TaliPassive.ApplyGlobalBonus" );
+	UFunction* const pFnApplyGlobalBonus = pFnApplyGlobalBonusRef.Get ( );
 
 	USFXPowerScript_TaliPassive_execApplyGlobalBonus_Parms ApplyGlobalBonus_Parms;
 
@@ -3379,242 +3055,182 @@ void USFXPowerScript_TaliPassive::ApplyGlobalBonus ( )
 
 
 
-class UClass* USFXPower_TaliPassive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_TaliPassive::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_TaliPassive", &UObject::FindClass };
 
 class UClass* USFXPower_TaliPassive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_TaliPassive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_ShieldJack_Evolved2::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_ShieldJack_Evolved2::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_ShieldJack_Evolved2", &UObject::FindClass };
 
 class UClass* USFXPower_ShieldJack_Evolved2::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_ShieldJack_Evolved2" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_ShieldJack_Evolved1::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_ShieldJack_Evolved1::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_ShieldJack_Evolved1", &UObject::FindClass };
 
 class UClass* USFXPower_ShieldJack_Evolved1::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_ShieldJack_Evolved1" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_HenchmanPassive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_HenchmanPassive::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_HenchmanPassive", &UObject::FindClass };
 
 class UClass* USFXPower_HenchmanPassive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_HenchmanPassive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CombatDrone_Tech_Hench::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CombatDrone_Tech_Hench::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Tech_Hench", &UObject::FindClass };
 
 class UClass* USFXPower_CombatDrone_Tech_Hench::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Tech_Hench" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CombatDrone_Tech_Tali::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CombatDrone_Tech_Tali::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Tech_Tali", &UObject::FindClass };
 
 class UClass* USFXPower_CombatDrone_Tech_Tali::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Tech_Tali" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CombatDrone_Rocket_Hench::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CombatDrone_Rocket_Hench::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Rocket_Hench", &UObject::FindClass };
 
 class UClass* USFXPower_CombatDrone_Rocket_Hench::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Rocket_Hench" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CombatDrone_Rocket_Tali::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CombatDrone_Rocket_Tali::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Rocket_Tali", &UObject::FindClass };
 
 class UClass* USFXPower_CombatDrone_Rocket_Tali::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Rocket_Tali" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CombatDrone_Tali::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CombatDrone_Tali::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Tali", &UObject::FindClass };
 
 class UClass* USFXPower_CombatDrone_Tali::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Tali" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_AIHacking_Tali::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_AIHacking_Tali::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_AIHacking_Tali", &UObject::FindClass };
 
 class UClass* USFXPower_AIHacking_Tali::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_AIHacking_Tali" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_AIHacking_Radius_Hench::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_AIHacking_Radius_Hench::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_AIHacking_Radius_Hench", &UObject::FindClass };
 
 class UClass* USFXPower_AIHacking_Radius_Hench::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_AIHacking_Radius_Hench" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_AIHacking_Heavy_Hench::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_AIHacking_Heavy_Hench::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_AIHacking_Heavy_Hench", &UObject::FindClass };
 
 class UClass* USFXPower_AIHacking_Heavy_Hench::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_AIHacking_Heavy_Hench" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_AIHacking_Radius::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_AIHacking_Radius::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_AIHacking_Radius", &UObject::FindClass };
 
 class UClass* USFXPower_AIHacking_Radius::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_AIHacking_Radius" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_AIHacking_Heavy::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_AIHacking_Heavy::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_AIHacking_Heavy", &UObject::FindClass };
 
 class UClass* USFXPower_AIHacking_Heavy::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_AIHacking_Heavy" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXPawn_EngineerTechDrone_Tali::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXPawn_EngineerTechDrone_Tali::pClassPointer { L"Class SFXGameContent_Powers.SFXPawn_EngineerTechDrone_Tali", &UObject::FindClass };
 
 class UClass* ASFXPawn_EngineerTechDrone_Tali::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPawn_EngineerTechDrone_Tali" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXPawn_EngineerRocketDrone_Tali::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXPawn_EngineerRocketDrone_Tali::pClassPointer { L"Class SFXGameContent_Powers.SFXPawn_EngineerRocketDrone_Tali", &UObject::FindClass };
 
 class UClass* ASFXPawn_EngineerRocketDrone_Tali::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPawn_EngineerRocketDrone_Tali" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXPawn_EngineerCombatDrone_Tali::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXPawn_EngineerCombatDrone_Tali::pClassPointer { L"Class SFXGameContent_Powers.SFXPawn_EngineerCombatDrone_Tali", &UObject::FindClass };
 
 class UClass* ASFXPawn_EngineerCombatDrone_Tali::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPawn_EngineerCombatDrone_Tali" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_ImprovedShieldJack::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_ImprovedShieldJack::pClassPointer { L"Class SFXGameContent_Powers.SFXDamageType_ImprovedShieldJack", &UObject::FindClass };
 
 class UClass* USFXDamageType_ImprovedShieldJack::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXDamageType_ImprovedShieldJack" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_ShieldJack::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_ShieldJack::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_ShieldJack", &UObject::FindClass };
 
 class UClass* USFXPower_ShieldJack::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_ShieldJack" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioShieldJackScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioShieldJackScript::pClassPointer { L"Class SFXGameContent_Powers.BioShieldJackScript", &UObject::FindClass };
 
 class UClass* UBioShieldJackScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioShieldJackScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioShieldJackScript.ShouldUsePower
@@ -3627,10 +3243,9 @@ class UClass* UBioShieldJackScript::StaticClass()
 
 bool UBioShieldJackScript::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.BioShieldJackScript.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioShieldJackScript.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	UBioShieldJackScript_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -3655,10 +3270,9 @@ bool UBioShieldJackScript::ShouldUsePower ( class AActor* Caster, class AActor*
 
 float UBioShieldJackScript::GetCurrentEnergyShields ( class ABioPawn* oPawn )
 {
-	static UFunction* pFnGetCurrentEnergyShields = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetCurrentEnergyShieldsRef { L"Function SFXGameContent_Powers.BioShieldJackScript.GetCurrentEnergyShields", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetCurrentEnergyShields )
-		pFnGetCurrentEnergyShields = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioShieldJackScript.GetCurrentEnergyShields" );
+	UFunction* const pFnGetCurrentEnergyShields = pFnGetCurrentEnergyShieldsRef.Get ( );
 
 	UBioShieldJackScript_execGetCurrentEnergyShields_Parms GetCurrentEnergyShields_Parms;
 	GetCurrentEnergyShields_Parms.oPawn = oPawn;
@@ -3676,10 +3290,9 @@ float UBioShieldJackScript::GetCurrentEnergyShields ( class ABioPawn* oPawn )
 
 void UBioShieldJackScript::SpawnImpactVFX ( struct FVector const& Location, class UParticleSystem* PS )
 {
-	static UFunction* pFnSpawnImpactVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSpawnImpactVFXRef { L"Function SFXGameContent_Powers.BioShieldJackScript.SpawnImpactVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSpawnImpactVFX )
-		pFnSpawnImpactVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioShieldJackScript.SpawnImpactVFX" );
+	UFunction* const pFnSpawnImpactVFX = pFnSpawnImpactVFXRef.Get ( );
 
 	UBioShieldJackScript_execSpawnImpactVFX_Parms SpawnImpactVFX_Parms;
 	memcpy ( &SpawnImpactVFX_Parms.Location, &Location, 0xC );
@@ -3699,10 +3312,9 @@ void UBioShieldJackScript::SpawnImpactVFX ( struct FVector const& Location, clas
 
 bool UBioShieldJackScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioShieldJackScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioShieldJackScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioShieldJackScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -3725,10 +3337,9 @@ bool UBioShieldJackScript::eventOnImpact ( class AActor* oCaster, float fCasterS
 
 bool UBioShieldJackScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioShieldJackScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioShieldJackScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioShieldJackScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -3742,14 +3353,11 @@ bool UBioShieldJackScript::eventStartPhase ( unsigned char ePhase, class AActor*
 
 
 
-class UClass* USFXGameEffect_HenchmenIgnorePawn::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_HenchmenIgnorePawn::pClassPointer { L"Class SFXGameContent_Powers.SFXGameEffect_HenchmenIgnorePawn", &UObject::FindClass };
 
 class UClass* USFXGameEffect_HenchmenIgnorePawn::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXGameEffect_HenchmenIgnorePawn" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXGameEffect_HenchmenIgnorePawn.OnRemoved
@@ -3758,10 +3366,9 @@ class UClass* USFXGameEffect_HenchmenIgnorePawn::StaticClass()
 
 void USFXGameEffect_HenchmenIgnorePawn::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent_Powers.SFXGameEffect_HenchmenIgnorePawn.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_HenchmenIgnorePawn.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_HenchmenIgnorePawn_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -3774,10 +3381,9 @@ void USFXGameEffect_HenchmenIgnorePawn::OnRemoved ( )
 
 void USFXGameEffect_HenchmenIgnorePawn::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent_Powers.SFXGameEffect_HenchmenIgnorePawn.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_HenchmenIgnorePawn.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_HenchmenIgnorePawn_execOnApplied_Parms OnApplied_Parms;
 
@@ -3786,26 +3392,20 @@ void USFXGameEffect_HenchmenIgnorePawn::OnApplied ( )
 
 
 
-class UClass* USFXPower_AIHacking::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_AIHacking::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_AIHacking", &UObject::FindClass };
 
 class UClass* USFXPower_AIHacking::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_AIHacking" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioHackingScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioHackingScript::pClassPointer { L"Class SFXGameContent_Powers.BioHackingScript", &UObject::FindClass };
 
 class UClass* UBioHackingScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioHackingScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioHackingScript.ShouldUsePower
@@ -3818,10 +3418,9 @@ class UClass* UBioHackingScript::StaticClass()
 
 bool UBioHackingScript::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.BioHackingScript.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHackingScript.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	UBioHackingScript_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -3846,10 +3445,9 @@ bool UBioHackingScript::ShouldUsePower ( class AActor* Caster, class AActor* Tar
 
 bool UBioHackingScript::IsHacked ( class ABioPawn* oPawn )
 {
-	static UFunction* pFnIsHacked = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsHackedRef { L"Function SFXGameContent_Powers.BioHackingScript.IsHacked", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsHacked )
-		pFnIsHacked = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHackingScript.IsHacked" );
+	UFunction* const pFnIsHacked = pFnIsHackedRef.Get ( );
 
 	UBioHackingScript_execIsHacked_Parms IsHacked_Parms;
 	IsHacked_Parms.oPawn = oPawn;
@@ -3868,10 +3466,9 @@ bool UBioHackingScript::IsHacked ( class ABioPawn* oPawn )
 
 bool UBioHackingScript::RemoveWeakerHack ( class ABioPawn* oPawn, float fNewDuration )
 {
-	static UFunction* pFnRemoveWeakerHack = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRemoveWeakerHackRef { L"Function SFXGameContent_Powers.BioHackingScript.RemoveWeakerHack", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRemoveWeakerHack )
-		pFnRemoveWeakerHack = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHackingScript.RemoveWeakerHack" );
+	UFunction* const pFnRemoveWeakerHack = pFnRemoveWeakerHackRef.Get ( );
 
 	UBioHackingScript_execRemoveWeakerHack_Parms RemoveWeakerHack_Parms;
 	RemoveWeakerHack_Parms.oPawn = oPawn;
@@ -3889,10 +3486,9 @@ bool UBioHackingScript::RemoveWeakerHack ( class ABioPawn* oPawn, float fNewDura
 
 void UBioHackingScript::UnHackPreviousTargets ( class AActor* oCaster )
 {
-	static UFunction* pFnUnHackPreviousTargets = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnHackPreviousTargetsRef { L"Function SFXGameContent_Powers.BioHackingScript.UnHackPreviousTargets", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnHackPreviousTargets )
-		pFnUnHackPreviousTargets = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHackingScript.UnHackPreviousTargets" );
+	UFunction* const pFnUnHackPreviousTargets = pFnUnHackPreviousTargetsRef.Get ( );
 
 	UBioHackingScript_execUnHackPreviousTargets_Parms UnHackPreviousTargets_Parms;
 	UnHackPreviousTargets_Parms.oCaster = oCaster;
@@ -3911,10 +3507,9 @@ void UBioHackingScript::UnHackPreviousTargets ( class AActor* oCaster )
 
 bool UBioHackingScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioHackingScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHackingScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioHackingScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -3937,10 +3532,9 @@ bool UBioHackingScript::eventOnImpact ( class AActor* oCaster, float fCasterStab
 
 bool UBioHackingScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioHackingScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioHackingScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioHackingScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -3954,14 +3548,11 @@ bool UBioHackingScript::eventStartPhase ( unsigned char ePhase, class AActor* oC
 
 
 
-class UClass* UBioWeaponPowerScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioWeaponPowerScript::pClassPointer { L"Class SFXGameContent_Powers.BioWeaponPowerScript", &UObject::FindClass };
 
 class UClass* UBioWeaponPowerScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioWeaponPowerScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioWeaponPowerScript.ShouldUsePower
@@ -3974,10 +3565,9 @@ class UClass* UBioWeaponPowerScript::StaticClass()
 
 bool UBioWeaponPowerScript::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.BioWeaponPowerScript.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWeaponPowerScript.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	UBioWeaponPowerScript_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -4002,10 +3592,9 @@ bool UBioWeaponPowerScript::ShouldUsePower ( class AActor* Caster, class AActor*
 
 void UBioWeaponPowerScript::ApplyPowerEffects ( class ABioPawn* oPawn, class ASFXWeapon* oWeapon )
 {
-	static UFunction* pFnApplyPowerEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyPowerEffectsRef { L"Function SFXGameContent_Powers.BioWeaponPowerScript.ApplyPowerEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyPowerEffects )
-		pFnApplyPowerEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWeaponPowerScript.ApplyPowerEffects" );
+	UFunction* const pFnApplyPowerEffects = pFnApplyPowerEffectsRef.Get ( );
 
 	UBioWeaponPowerScript_execApplyPowerEffects_Parms ApplyPowerEffects_Parms;
 	ApplyPowerEffects_Parms.oPawn = oPawn;
@@ -4024,10 +3613,9 @@ void UBioWeaponPowerScript::ApplyPowerEffects ( class ABioPawn* oPawn, class ASF
 
 bool UBioWeaponPowerScript::SetWeaponPower ( class ABioPawn* oPawn, class ASFXWeapon* oWeapon, unsigned long bOverrideCurrentPower )
 {
-	static UFunction* pFnSetWeaponPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetWeaponPowerRef { L"Function SFXGameContent_Powers.BioWeaponPowerScript.SetWeaponPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetWeaponPower )
-		pFnSetWeaponPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWeaponPowerScript.SetWeaponPower" );
+	UFunction* const pFnSetWeaponPower = pFnSetWeaponPowerRef.Get ( );
 
 	UBioWeaponPowerScript_execSetWeaponPower_Parms SetWeaponPower_Parms;
 	SetWeaponPower_Parms.oPawn = oPawn;
@@ -4047,10 +3635,9 @@ bool UBioWeaponPowerScript::SetWeaponPower ( class ABioPawn* oPawn, class ASFXWe
 
 void UBioWeaponPowerScript::ReloadAmmoPower ( class ABioPawn* Target, class ASFXWeapon* Weapon )
 {
-	static UFunction* pFnReloadAmmoPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReloadAmmoPowerRef { L"Function SFXGameContent_Powers.BioWeaponPowerScript.ReloadAmmoPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReloadAmmoPower )
-		pFnReloadAmmoPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWeaponPowerScript.ReloadAmmoPower" );
+	UFunction* const pFnReloadAmmoPower = pFnReloadAmmoPowerRef.Get ( );
 
 	UBioWeaponPowerScript_execReloadAmmoPower_Parms ReloadAmmoPower_Parms;
 	ReloadAmmoPower_Parms.Target = Target;
@@ -4069,10 +3656,9 @@ void UBioWeaponPowerScript::ReloadAmmoPower ( class ABioPawn* Target, class ASFX
 
 bool UBioWeaponPowerScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioWeaponPowerScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWeaponPowerScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioWeaponPowerScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -4091,10 +3677,9 @@ bool UBioWeaponPowerScript::eventStartPhase ( unsigned char ePhase, class AActor
 
 bool UBioWeaponPowerScript::ApplyToSquadMembers ( )
 {
-	static UFunction* pFnApplyToSquadMembers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyToSquadMembersRef { L"Function SFXGameContent_Powers.BioWeaponPowerScript.ApplyToSquadMembers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyToSquadMembers )
-		pFnApplyToSquadMembers = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWeaponPowerScript.ApplyToSquadMembers" );
+	UFunction* const pFnApplyToSquadMembers = pFnApplyToSquadMembersRef.Get ( );
 
 	UBioWeaponPowerScript_execApplyToSquadMembers_Parms ApplyToSquadMembers_Parms;
 
@@ -4110,10 +3695,9 @@ bool UBioWeaponPowerScript::ApplyToSquadMembers ( )
 
 float UBioWeaponPowerScript::GetDuration ( )
 {
-	static UFunction* pFnGetDuration = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDurationRef { L"Function SFXGameContent_Powers.BioWeaponPowerScript.GetDuration", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDuration )
-		pFnGetDuration = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWeaponPowerScript.GetDuration" );
+	UFunction* const pFnGetDuration = pFnGetDurationRef.Get ( );
 
 	UBioWeaponPowerScript_execGetDuration_Parms GetDuration_Parms;
 
@@ -4129,10 +3713,9 @@ float UBioWeaponPowerScript::GetDuration ( )
 
 float UBioWeaponPowerScript::GetElapsedTime ( )
 {
-	static UFunction* pFnGetElapsedTime = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetElapsedTimeRef { L"Function SFXGameContent_Powers.BioWeaponPowerScript.GetElapsedTime", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetElapsedTime )
-		pFnGetElapsedTime = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWeaponPowerScript.GetElapsedTime" );
+	UFunction* const pFnGetElapsedTime = pFnGetElapsedTimeRef.Get ( );
 
 	UBioWeaponPowerScript_execGetElapsedTime_Parms GetElapsedTime_Parms;
 
@@ -4149,10 +3732,9 @@ float UBioWeaponPowerScript::GetElapsedTime ( )
 
 bool UBioWeaponPowerScript::eventCanStartPower ( class AActor* oCaster )
 {
-	static UFunction* pFnCanStartPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanStartPowerRef { L"Function SFXGameContent_Powers.BioWeaponPowerScript.CanStartPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanStartPower )
-		pFnCanStartPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioWeaponPowerScript.CanStartPower" );
+	UFunction* const pFnCanStartPower = pFnCanStartPowerRef.Get ( );
 
 	UBioWeaponPowerScript_eventCanStartPower_Parms CanStartPower_Parms;
 	CanStartPower_Parms.oCaster = oCaster;
@@ -4164,14 +3746,11 @@ bool UBioWeaponPowerScript::eventCanStartPower ( class AActor* oCaster )
 
 
 
-class UClass* USFXGameEffect_AmmoPower::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_AmmoPower::pClassPointer { L"Class SFXGameContent_Powers.SFXGameEffect_AmmoPower", &UObject::FindClass };
 
 class UClass* USFXGameEffect_AmmoPower::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXGameEffect_AmmoPower" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.RemoveWeaponHologram
@@ -4180,10 +3759,9 @@ class UClass* USFXGameEffect_AmmoPower::StaticClass()
 
 void USFXGameEffect_AmmoPower::RemoveWeaponHologram ( )
 {
-	static UFunction* pFnRemoveWeaponHologram = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRemoveWeaponHologramRef { L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.RemoveWeaponHologram", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRemoveWeaponHologram )
-		pFnRemoveWeaponHologram = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.RemoveWeaponHologram" );
+	UFunction* const pFnRemoveWeaponHologram = pFnRemoveWeaponHologramRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execRemoveWeaponHologram_Parms RemoveWeaponHologram_Parms;
 
@@ -4196,10 +3774,9 @@ void USFXGameEffect_AmmoPower::RemoveWeaponHologram ( )
 
 void USFXGameEffect_AmmoPower::EnableWeaponHologram ( )
 {
-	static UFunction* pFnEnableWeaponHologram = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEnableWeaponHologramRef { L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.EnableWeaponHologram", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEnableWeaponHologram )
-		pFnEnableWeaponHologram = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.EnableWeaponHologram" );
+	UFunction* const pFnEnableWeaponHologram = pFnEnableWeaponHologramRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execEnableWeaponHologram_Parms EnableWeaponHologram_Parms;
 
@@ -4213,10 +3790,9 @@ void USFXGameEffect_AmmoPower::EnableWeaponHologram ( )
 
 void USFXGameEffect_AmmoPower::OnWeaponUnequip ( class ASFXWeapon* Weapon )
 {
-	static UFunction* pFnOnWeaponUnequip = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnWeaponUnequipRef { L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnWeaponUnequip", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnWeaponUnequip )
-		pFnOnWeaponUnequip = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnWeaponUnequip" );
+	UFunction* const pFnOnWeaponUnequip = pFnOnWeaponUnequipRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execOnWeaponUnequip_Parms OnWeaponUnequip_Parms;
 	OnWeaponUnequip_Parms.Weapon = Weapon;
@@ -4231,10 +3807,9 @@ void USFXGameEffect_AmmoPower::OnWeaponUnequip ( class ASFXWeapon* Weapon )
 
 void USFXGameEffect_AmmoPower::OnWeaponEquip ( class ASFXWeapon* Weapon )
 {
-	static UFunction* pFnOnWeaponEquip = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnWeaponEquipRef { L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnWeaponEquip", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnWeaponEquip )
-		pFnOnWeaponEquip = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnWeaponEquip" );
+	UFunction* const pFnOnWeaponEquip = pFnOnWeaponEquipRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execOnWeaponEquip_Parms OnWeaponEquip_Parms;
 	OnWeaponEquip_Parms.Weapon = Weapon;
@@ -4249,10 +3824,9 @@ void USFXGameEffect_AmmoPower::OnWeaponEquip ( class ASFXWeapon* Weapon )
 
 void USFXGameEffect_AmmoPower::OnWeaponReload ( class ASFXWeapon* Weapon )
 {
-	static UFunction* pFnOnWeaponReload = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnWeaponReloadRef { L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnWeaponReload", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnWeaponReload )
-		pFnOnWeaponReload = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnWeaponReload" );
+	UFunction* const pFnOnWeaponReload = pFnOnWeaponReloadRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execOnWeaponReload_Parms OnWeaponReload_Parms;
 	OnWeaponReload_Parms.Weapon = Weapon;
@@ -4267,10 +3841,9 @@ void USFXGameEffect_AmmoPower::OnWeaponReload ( class ASFXWeapon* Weapon )
 
 float USFXGameEffect_AmmoPower::GetDamageVocProbabilityMod ( )
 {
-	static UFunction* pFnGetDamageVocProbabilityMod = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDamageVocProbabilityModRef { L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.GetDamageVocProbabilityMod", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDamageVocProbabilityMod )
-		pFnGetDamageVocProbabilityMod = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.GetDamageVocProbabilityMod" );
+	UFunction* const pFnGetDamageVocProbabilityMod = pFnGetDamageVocProbabilityModRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execGetDamageVocProbabilityMod_Parms GetDamageVocProbabilityMod_Parms;
 
@@ -4287,10 +3860,9 @@ float USFXGameEffect_AmmoPower::GetDamageVocProbabilityMod ( )
 
 void USFXGameEffect_AmmoPower::OnWeaponImpact ( class ASFXWeapon* Weapon, struct FImpactInfo const& Impact )
 {
-	static UFunction* pFnOnWeaponImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnWeaponImpactRef { L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnWeaponImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnWeaponImpact )
-		pFnOnWeaponImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnWeaponImpact" );
+	UFunction* const pFnOnWeaponImpact = pFnOnWeaponImpactRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execOnWeaponImpact_Parms OnWeaponImpact_Parms;
 	OnWeaponImpact_Parms.Weapon = Weapon;
@@ -4305,10 +3877,9 @@ void USFXGameEffect_AmmoPower::OnWeaponImpact ( class ASFXWeapon* Weapon, struct
 
 void USFXGameEffect_AmmoPower::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -4321,10 +3892,9 @@ void USFXGameEffect_AmmoPower::OnRemoved ( )
 
 void USFXGameEffect_AmmoPower::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execOnApplied_Parms OnApplied_Parms;
 
@@ -4333,14 +3903,11 @@ void USFXGameEffect_AmmoPower::OnApplied ( )
 
 
 
-class UClass* UBioCarnageScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioCarnageScript::pClassPointer { L"Class SFXGameContent_Powers.BioCarnageScript", &UObject::FindClass };
 
 class UClass* UBioCarnageScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioCarnageScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioCarnageScript.ApplyPowerEffects
@@ -4351,10 +3918,9 @@ class UClass* UBioCarnageScript::StaticClass()
 
 void UBioCarnageScript::ApplyPowerEffects ( class ABioPawn* oPawn, class ASFXWeapon* oWeapon )
 {
-	static UFunction* pFnApplyPowerEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyPowerEffectsRef { L"Function SFXGameContent_Powers.BioCarnageScript.ApplyPowerEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyPowerEffects )
-		pFnApplyPowerEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCarnageScript.ApplyPowerEffects" );
+	UFunction* const pFnApplyPowerEffects = pFnApplyPowerEffectsRef.Get ( );
 
 	UBioCarnageScript_execApplyPowerEffects_Parms ApplyPowerEffects_Parms;
 	ApplyPowerEffects_Parms.oPawn = oPawn;
@@ -4374,10 +3940,9 @@ void UBioCarnageScript::ApplyPowerEffects ( class ABioPawn* oPawn, class ASFXWea
 
 bool UBioCarnageScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioCarnageScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCarnageScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioCarnageScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -4400,10 +3965,9 @@ bool UBioCarnageScript::eventOnImpact ( class AActor* oCaster, float fCasterStab
 
 bool UBioCarnageScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioCarnageScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCarnageScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioCarnageScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -4422,10 +3986,9 @@ bool UBioCarnageScript::eventStartPhase ( unsigned char ePhase, class AActor* oC
 
 bool UBioCarnageScript::ApplyToSquadMembers ( )
 {
-	static UFunction* pFnApplyToSquadMembers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyToSquadMembersRef { L"Function SFXGameContent_Powers.BioCarnageScript.ApplyToSquadMembers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyToSquadMembers )
-		pFnApplyToSquadMembers = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCarnageScript.ApplyToSquadMembers" );
+	UFunction* const pFnApplyToSquadMembers = pFnApplyToSquadMembersRef.Get ( );
 
 	UBioCarnageScript_execApplyToSquadMembers_Parms ApplyToSquadMembers_Parms;
 
@@ -4440,10 +4003,9 @@ bool UBioCarnageScript::ApplyToSquadMembers ( )
 
 void UBioCarnageScript::eventInitializePowerScript ( )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioCarnageScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioCarnageScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioCarnageScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 
@@ -4452,26 +4014,20 @@ void UBioCarnageScript::eventInitializePowerScript ( )
 
 
 
-class UClass* USFXPower_IncendiaryAmmo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_IncendiaryAmmo::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_IncendiaryAmmo", &UObject::FindClass };
 
 class UClass* USFXPower_IncendiaryAmmo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_IncendiaryAmmo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_IncendiaryAmmo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_IncendiaryAmmo::pClassPointer { L"Class SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo", &UObject::FindClass };
 
 class UClass* USFXGameEffect_IncendiaryAmmo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.CauseAnimatedReaction
@@ -4482,10 +4038,9 @@ class UClass* USFXGameEffect_IncendiaryAmmo::StaticClass()
 
 void USFXGameEffect_IncendiaryAmmo::CauseAnimatedReaction ( class AActor* oHitActor, float fDelay )
 {
-	static UFunction* pFnCauseAnimatedReaction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCauseAnimatedReactionRef { L"Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.CauseAnimatedReaction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCauseAnimatedReaction )
-		pFnCauseAnimatedReaction = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.CauseAnimatedReaction" );
+	UFunction* const pFnCauseAnimatedReaction = pFnCauseAnimatedReactionRef.Get ( );
 
 	USFXGameEffect_IncendiaryAmmo_execCauseAnimatedReaction_Parms CauseAnimatedReaction_Parms;
 	CauseAnimatedReaction_Parms.oHitActor = oHitActor;
@@ -4504,10 +4059,9 @@ void USFXGameEffect_IncendiaryAmmo::CauseAnimatedReaction ( class AActor* oHitAc
 
 void USFXGameEffect_IncendiaryAmmo::AddGameEffects ( class AActor* oTarget, float fDuration, float fDamagePerSecond, class ABioPawn* BPInstigator )
 {
-	static UFunction* pFnAddGameEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddGameEffectsRef { L"Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.AddGameEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddGameEffects )
-		pFnAddGameEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.AddGameEffects" );
+	UFunction* const pFnAddGameEffects = pFnAddGameEffectsRef.Get ( );
 
 	USFXGameEffect_IncendiaryAmmo_execAddGameEffects_Parms AddGameEffects_Parms;
 	AddGameEffects_Parms.oTarget = oTarget;
@@ -4527,10 +4081,9 @@ void USFXGameEffect_IncendiaryAmmo::AddGameEffects ( class AActor* oTarget, floa
 
 void USFXGameEffect_IncendiaryAmmo::DoEvolvedAoEImpact ( struct FImpactInfo const& Impact, class ABioPawn* WeaponOwner, class ASFXWeapon* Weapon )
 {
-	static UFunction* pFnDoEvolvedAoEImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoEvolvedAoEImpactRef { L"Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.DoEvolvedAoEImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoEvolvedAoEImpact )
-		pFnDoEvolvedAoEImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.DoEvolvedAoEImpact" );
+	UFunction* const pFnDoEvolvedAoEImpact = pFnDoEvolvedAoEImpactRef.Get ( );
 
 	USFXGameEffect_IncendiaryAmmo_execDoEvolvedAoEImpact_Parms DoEvolvedAoEImpact_Parms;
 	memcpy ( &DoEvolvedAoEImpact_Parms.Impact, &Impact, 0x60 );
@@ -4547,10 +4100,9 @@ void USFXGameEffect_IncendiaryAmmo::DoEvolvedAoEImpact ( struct FImpactInfo cons
 
 float USFXGameEffect_IncendiaryAmmo::GetDamageVocProbabilityMod ( )
 {
-	static UFunction* pFnGetDamageVocProbabilityMod = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDamageVocProbabilityModRef { L"Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.GetDamageVocProbabilityMod", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDamageVocProbabilityMod )
-		pFnGetDamageVocProbabilityMod = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.GetDamageVocProbabilityMod" );
+	UFunction* const pFnGetDamageVocProbabilityMod = pFnGetDamageVocProbabilityModRef.Get ( );
 
 	USFXGameEffect_IncendiaryAmmo_execGetDamageVocProbabilityMod_Parms GetDamageVocProbabilityMod_Parms;
 
@@ -4567,10 +4119,9 @@ float USFXGameEffect_IncendiaryAmmo::GetDamageVocProbabilityMod ( )
 
 void USFXGameEffect_IncendiaryAmmo::OnWeaponImpact ( class ASFXWeapon* Weapon, struct FImpactInfo const& Impact )
 {
-	static UFunction* pFnOnWeaponImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnWeaponImpactRef { L"Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.OnWeaponImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnWeaponImpact )
-		pFnOnWeaponImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.OnWeaponImpact" );
+	UFunction* const pFnOnWeaponImpact = pFnOnWeaponImpactRef.Get ( );
 
 	USFXGameEffect_IncendiaryAmmo_execOnWeaponImpact_Parms OnWeaponImpact_Parms;
 	OnWeaponImpact_Parms.Weapon = Weapon;
@@ -4581,14 +4132,11 @@ void USFXGameEffect_IncendiaryAmmo::OnWeaponImpact ( class ASFXWeapon* Weapon, s
 
 
 
-class UClass* UBioConcussiveShotScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioConcussiveShotScript::pClassPointer { L"Class SFXGameContent_Powers.BioConcussiveShotScript", &UObject::FindClass };
 
 class UClass* UBioConcussiveShotScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioConcussiveShotScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioConcussiveShotScript.ShouldUsePower
@@ -4601,10 +4149,9 @@ class UClass* UBioConcussiveShotScript::StaticClass()
 
 bool UBioConcussiveShotScript::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.BioConcussiveShotScript.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioConcussiveShotScript.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	UBioConcussiveShotScript_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -4630,10 +4177,9 @@ bool UBioConcussiveShotScript::ShouldUsePower ( class AActor* Caster, class AAct
 
 void UBioConcussiveShotScript::OnRagdollPhysicsImpact ( class APawn* oPawn, class AActor* oImpactActor, struct FVector const& vImpactDir )
 {
-	static UFunction* pFnOnRagdollPhysicsImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRagdollPhysicsImpactRef { L"Function SFXGameContent_Powers.BioConcussiveShotScript.OnRagdollPhysicsImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRagdollPhysicsImpact )
-		pFnOnRagdollPhysicsImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioConcussiveShotScript.OnRagdollPhysicsImpact" );
+	UFunction* const pFnOnRagdollPhysicsImpact = pFnOnRagdollPhysicsImpactRef.Get ( );
 
 	UBioConcussiveShotScript_execOnRagdollPhysicsImpact_Parms OnRagdollPhysicsImpact_Parms;
 	OnRagdollPhysicsImpact_Parms.oPawn = oPawn;
@@ -4654,10 +4200,9 @@ void UBioConcussiveShotScript::OnRagdollPhysicsImpact ( class APawn* oPawn, clas
 
 bool UBioConcussiveShotScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioConcussiveShotScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioConcussiveShotScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioConcussiveShotScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -4680,10 +4225,9 @@ bool UBioConcussiveShotScript::eventOnImpact ( class AActor* oCaster, float fCas
 
 bool UBioConcussiveShotScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioConcussiveShotScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioConcussiveShotScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioConcussiveShotScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -4697,26 +4241,20 @@ bool UBioConcussiveShotScript::eventStartPhase ( unsigned char ePhase, class AAc
 
 
 
-class UClass* USFXPower_ConcussiveShot::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_ConcussiveShot::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_ConcussiveShot", &UObject::FindClass };
 
 class UClass* USFXPower_ConcussiveShot::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_ConcussiveShot" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioOverloadScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioOverloadScript::pClassPointer { L"Class SFXGameContent_Powers.BioOverloadScript", &UObject::FindClass };
 
 class UClass* UBioOverloadScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioOverloadScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioOverloadScript.ApplyPowerEffects
@@ -4727,10 +4265,9 @@ class UClass* UBioOverloadScript::StaticClass()
 
 void UBioOverloadScript::ApplyPowerEffects ( class ABioPawn* oPawn, class ASFXWeapon* oWeapon )
 {
-	static UFunction* pFnApplyPowerEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyPowerEffectsRef { L"Function SFXGameContent_Powers.BioOverloadScript.ApplyPowerEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyPowerEffects )
-		pFnApplyPowerEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioOverloadScript.ApplyPowerEffects" );
+	UFunction* const pFnApplyPowerEffects = pFnApplyPowerEffectsRef.Get ( );
 
 	UBioOverloadScript_execApplyPowerEffects_Parms ApplyPowerEffects_Parms;
 	ApplyPowerEffects_Parms.oPawn = oPawn;
@@ -4750,10 +4287,9 @@ void UBioOverloadScript::ApplyPowerEffects ( class ABioPawn* oPawn, class ASFXWe
 
 bool UBioOverloadScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioOverloadScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioOverloadScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioOverloadScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -4776,10 +4312,9 @@ bool UBioOverloadScript::eventOnImpact ( class AActor* oCaster, float fCasterSta
 
 bool UBioOverloadScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioOverloadScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioOverloadScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioOverloadScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -4798,10 +4333,9 @@ bool UBioOverloadScript::eventStartPhase ( unsigned char ePhase, class AActor* o
 
 bool UBioOverloadScript::ApplyToSquadMembers ( )
 {
-	static UFunction* pFnApplyToSquadMembers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyToSquadMembersRef { L"Function SFXGameContent_Powers.BioOverloadScript.ApplyToSquadMembers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyToSquadMembers )
-		pFnApplyToSquadMembers = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioOverloadScript.ApplyToSquadMembers" );
+	UFunction* const pFnApplyToSquadMembers = pFnApplyToSquadMembersRef.Get ( );
 
 	UBioOverloadScript_execApplyToSquadMembers_Parms ApplyToSquadMembers_Parms;
 
@@ -4816,10 +4350,9 @@ bool UBioOverloadScript::ApplyToSquadMembers ( )
 
 void UBioOverloadScript::eventInitializePowerScript ( )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.BioOverloadScript.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioOverloadScript.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	UBioOverloadScript_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 
@@ -4828,26 +4361,20 @@ void UBioOverloadScript::eventInitializePowerScript ( )
 
 
 
-class UClass* USFXPower_DisruptorAmmo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_DisruptorAmmo::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_DisruptorAmmo", &UObject::FindClass };
 
 class UClass* USFXPower_DisruptorAmmo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_DisruptorAmmo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_DisruptorAmmo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_DisruptorAmmo::pClassPointer { L"Class SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo", &UObject::FindClass };
 
 class UClass* USFXGameEffect_DisruptorAmmo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo.StunRobot
@@ -4857,10 +4384,9 @@ class UClass* USFXGameEffect_DisruptorAmmo::StaticClass()
 
 void USFXGameEffect_DisruptorAmmo::StunRobot ( class ABioPawn* oPawn )
 {
-	static UFunction* pFnStunRobot = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStunRobotRef { L"Function SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo.StunRobot", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStunRobot )
-		pFnStunRobot = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo.StunRobot" );
+	UFunction* const pFnStunRobot = pFnStunRobotRef.Get ( );
 
 	USFXGameEffect_DisruptorAmmo_execStunRobot_Parms StunRobot_Parms;
 	StunRobot_Parms.oPawn = oPawn;
@@ -4875,10 +4401,9 @@ void USFXGameEffect_DisruptorAmmo::StunRobot ( class ABioPawn* oPawn )
 
 void USFXGameEffect_DisruptorAmmo::TurnOnDeathPower ( class ABioPawn* oPawn )
 {
-	static UFunction* pFnTurnOnDeathPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTurnOnDeathPowerRef { L"Function SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo.TurnOnDeathPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTurnOnDeathPower )
-		pFnTurnOnDeathPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo.TurnOnDeathPower" );
+	UFunction* const pFnTurnOnDeathPower = pFnTurnOnDeathPowerRef.Get ( );
 
 	USFXGameEffect_DisruptorAmmo_execTurnOnDeathPower_Parms TurnOnDeathPower_Parms;
 	TurnOnDeathPower_Parms.oPawn = oPawn;
@@ -4893,10 +4418,9 @@ void USFXGameEffect_DisruptorAmmo::TurnOnDeathPower ( class ABioPawn* oPawn )
 
 float USFXGameEffect_DisruptorAmmo::GetDamageVocProbabilityMod ( )
 {
-	static UFunction* pFnGetDamageVocProbabilityMod = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDamageVocProbabilityModRef { L"Function SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo.GetDamageVocProbabilityMod", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDamageVocProbabilityMod )
-		pFnGetDamageVocProbabilityMod = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo.GetDamageVocProbabilityMod" );
+	UFunction* const pFnGetDamageVocProbabilityMod = pFnGetDamageVocProbabilityModRef.Get ( );
 
 	USFXGameEffect_DisruptorAmmo_execGetDamageVocProbabilityMod_Parms GetDamageVocProbabilityMod_Parms;
 
@@ -4913,10 +4437,9 @@ float USFXGameEffect_DisruptorAmmo::GetDamageVocProbabilityMod ( )
 
 void USFXGameEffect_DisruptorAmmo::OnWeaponImpact ( class ASFXWeapon* Weapon, struct FImpactInfo const& Impact )
 {
-	static UFunction* pFnOnWeaponImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnWeaponImpactRef { L"Function SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo.OnWeaponImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnWeaponImpact )
-		pFnOnWeaponImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo.OnWeaponImpact" );
+	UFunction* const pFnOnWeaponImpact = pFnOnWeaponImpactRef.Get ( );
 
 	USFXGameEffect_DisruptorAmmo_execOnWeaponImpact_Parms OnWeaponImpact_Parms;
 	OnWeaponImpact_Parms.Weapon = Weapon;
@@ -4927,14 +4450,11 @@ void USFXGameEffect_DisruptorAmmo::OnWeaponImpact ( class ASFXWeapon* Weapon, st
 
 
 
-class UClass* UBioPlayerMeleeScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioPlayerMeleeScript::pClassPointer { L"Class SFXGameContent_Powers.BioPlayerMeleeScript", &UObject::FindClass };
 
 class UClass* UBioPlayerMeleeScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioPlayerMeleeScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioPlayerMeleeScript.EndPhase
@@ -4946,10 +4466,9 @@ class UClass* UBioPlayerMeleeScript::StaticClass()
 
 bool UBioPlayerMeleeScript::eventEndPhase ( unsigned char ePhase, class AActor* oCaster )
 {
-	static UFunction* pFnEndPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndPhaseRef { L"Function SFXGameContent_Powers.BioPlayerMeleeScript.EndPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndPhase )
-		pFnEndPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPlayerMeleeScript.EndPhase" );
+	UFunction* const pFnEndPhase = pFnEndPhaseRef.Get ( );
 
 	UBioPlayerMeleeScript_eventEndPhase_Parms EndPhase_Parms;
 	EndPhase_Parms.ePhase = ePhase;
@@ -4967,10 +4486,9 @@ bool UBioPlayerMeleeScript::eventEndPhase ( unsigned char ePhase, class AActor*
 
 void UBioPlayerMeleeScript::RemoveMeleeEffects ( class ABioPawn* oPawn )
 {
-	static UFunction* pFnRemoveMeleeEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRemoveMeleeEffectsRef { L"Function SFXGameContent_Powers.BioPlayerMeleeScript.RemoveMeleeEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRemoveMeleeEffects )
-		pFnRemoveMeleeEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPlayerMeleeScript.RemoveMeleeEffects" );
+	UFunction* const pFnRemoveMeleeEffects = pFnRemoveMeleeEffectsRef.Get ( );
 
 	UBioPlayerMeleeScript_execRemoveMeleeEffects_Parms RemoveMeleeEffects_Parms;
 	RemoveMeleeEffects_Parms.oPawn = oPawn;
@@ -4989,10 +4507,9 @@ void UBioPlayerMeleeScript::RemoveMeleeEffects ( class ABioPawn* oPawn )
 
 bool UBioPlayerMeleeScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioPlayerMeleeScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPlayerMeleeScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioPlayerMeleeScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -5012,10 +4529,9 @@ bool UBioPlayerMeleeScript::eventOnImpact ( class AActor* oCaster, float fCaster
 
 void UBioPlayerMeleeScript::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickRef { L"Function SFXGameContent_Powers.BioPlayerMeleeScript.Tick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTick )
-		pFnTick = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPlayerMeleeScript.Tick" );
+	UFunction* const pFnTick = pFnTickRef.Get ( );
 
 	UBioPlayerMeleeScript_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -5033,10 +4549,9 @@ void UBioPlayerMeleeScript::Tick ( float DeltaTime )
 
 bool UBioPlayerMeleeScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioPlayerMeleeScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioPlayerMeleeScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioPlayerMeleeScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -5050,38 +4565,29 @@ bool UBioPlayerMeleeScript::eventStartPhase ( unsigned char ePhase, class AActor
 
 
 
-class UClass* USFXPower_PlayerMelee::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_PlayerMelee::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_PlayerMelee", &UObject::FindClass };
 
 class UClass* USFXPower_PlayerMelee::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_PlayerMelee" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_CryoAmmo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_CryoAmmo::pClassPointer { L"Class SFXGameContent_Powers.SFXDamageType_CryoAmmo", &UObject::FindClass };
 
 class UClass* USFXDamageType_CryoAmmo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXDamageType_CryoAmmo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_CryoAmmo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_CryoAmmo::pClassPointer { L"Class SFXGameContent_Powers.SFXGameEffect_CryoAmmo", &UObject::FindClass };
 
 class UClass* USFXGameEffect_CryoAmmo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXGameEffect_CryoAmmo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXGameEffect_CryoAmmo.GetDamageVocProbabilityMod
@@ -5091,10 +4597,9 @@ class UClass* USFXGameEffect_CryoAmmo::StaticClass()
 
 float USFXGameEffect_CryoAmmo::GetDamageVocProbabilityMod ( )
 {
-	static UFunction* pFnGetDamageVocProbabilityMod = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDamageVocProbabilityModRef { L"Function SFXGameContent_Powers.SFXGameEffect_CryoAmmo.GetDamageVocProbabilityMod", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDamageVocProbabilityMod )
-		pFnGetDamageVocProbabilityMod = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_CryoAmmo.GetDamageVocProbabilityMod" );
+	UFunction* const pFnGetDamageVocProbabilityMod = pFnGetDamageVocProbabilityModRef.Get ( );
 
 	USFXGameEffect_CryoAmmo_execGetDamageVocProbabilityMod_Parms GetDamageVocProbabilityMod_Parms;
 
@@ -5111,10 +4616,9 @@ float USFXGameEffect_CryoAmmo::GetDamageVocProbabilityMod ( )
 
 void USFXGameEffect_CryoAmmo::OnWeaponImpact ( class ASFXWeapon* Weapon, struct FImpactInfo const& Impact )
 {
-	static UFunction* pFnOnWeaponImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnWeaponImpactRef { L"Function SFXGameContent_Powers.SFXGameEffect_CryoAmmo.OnWeaponImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnWeaponImpact )
-		pFnOnWeaponImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_CryoAmmo.OnWeaponImpact" );
+	UFunction* const pFnOnWeaponImpact = pFnOnWeaponImpactRef.Get ( );
 
 	USFXGameEffect_CryoAmmo_execOnWeaponImpact_Parms OnWeaponImpact_Parms;
 	OnWeaponImpact_Parms.Weapon = Weapon;
@@ -5125,38 +4629,29 @@ void USFXGameEffect_CryoAmmo::OnWeaponImpact ( class ASFXWeapon* Weapon, struct
 
 
 
-class UClass* USFXGameEffect_PowerBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_PowerBonus::pClassPointer { L"Class SFXGameContent_Powers.SFXGameEffect_PowerBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_PowerBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXGameEffect_PowerBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_AdrenalineRush::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_AdrenalineRush::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_AdrenalineRush", &UObject::FindClass };
 
 class UClass* USFXPower_AdrenalineRush::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_AdrenalineRush" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_AdrenalineRush::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_AdrenalineRush::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_AdrenalineRush", &UObject::FindClass };
 
 class UClass* USFXPowerScript_AdrenalineRush::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_AdrenalineRush" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.ApplyVFX
@@ -5167,10 +4662,9 @@ class UClass* USFXPowerScript_AdrenalineRush::StaticClass()
 
 void USFXPowerScript_AdrenalineRush::ApplyVFX ( class AActor* oImpacted, float fDuration )
 {
-	static UFunction* pFnApplyVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyVFXRef { L"Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.ApplyVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyVFX )
-		pFnApplyVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.ApplyVFX" );
+	UFunction* const pFnApplyVFX = pFnApplyVFXRef.Get ( );
 
 	USFXPowerScript_AdrenalineRush_execApplyVFX_Parms ApplyVFX_Parms;
 	ApplyVFX_Parms.oImpacted = oImpacted;
@@ -5185,10 +4679,9 @@ void USFXPowerScript_AdrenalineRush::ApplyVFX ( class AActor* oImpacted, float f
 
 void USFXPowerScript_AdrenalineRush::OnEffectEnded ( )
 {
-	static UFunction* pFnOnEffectEnded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnEffectEndedRef { L"Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.OnEffectEnded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnEffectEnded )
-		pFnOnEffectEnded = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.OnEffectEnded" );
+	UFunction* const pFnOnEffectEnded = pFnOnEffectEndedRef.Get ( );
 
 	USFXPowerScript_AdrenalineRush_execOnEffectEnded_Parms OnEffectEnded_Parms;
 
@@ -5206,10 +4699,9 @@ void USFXPowerScript_AdrenalineRush::OnEffectEnded ( )
 
 bool USFXPowerScript_AdrenalineRush::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerScript_AdrenalineRush_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -5230,10 +4722,9 @@ bool USFXPowerScript_AdrenalineRush::eventOnImpact ( class AActor* oCaster, floa
 
 bool USFXPowerScript_AdrenalineRush::eventAdjustCooldown ( float* fCoolDownTime )
 {
-	static UFunction* pFnAdjustCooldown = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAdjustCooldownRef { L"Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.AdjustCooldown", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAdjustCooldown )
-		pFnAdjustCooldown = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.AdjustCooldown" );
+	UFunction* const pFnAdjustCooldown = pFnAdjustCooldownRef.Get ( );
 
 	USFXPowerScript_AdrenalineRush_eventAdjustCooldown_Parms AdjustCooldown_Parms;
 
@@ -5258,10 +4749,9 @@ bool USFXPowerScript_AdrenalineRush::eventAdjustCooldown ( float* fCoolDownTime
 
 bool USFXPowerScript_AdrenalineRush::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	USFXPowerScript_AdrenalineRush_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -5275,110 +4765,83 @@ bool USFXPowerScript_AdrenalineRush::eventStartPhase ( unsigned char ePhase, cla
 
 
 
-class UClass* USFXPower_AdrenalineRush_Evolved1::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_AdrenalineRush_Evolved1::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_AdrenalineRush_Evolved1", &UObject::FindClass };
 
 class UClass* USFXPower_AdrenalineRush_Evolved1::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_AdrenalineRush_Evolved1" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_AdrenalineRush_Evolved2::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_AdrenalineRush_Evolved2::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_AdrenalineRush_Evolved2", &UObject::FindClass };
 
 class UClass* USFXPower_AdrenalineRush_Evolved2::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_AdrenalineRush_Evolved2" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_AdrenalineRush_Soldier::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_AdrenalineRush_Soldier::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_AdrenalineRush_Soldier", &UObject::FindClass };
 
 class UClass* USFXPower_AdrenalineRush_Soldier::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_AdrenalineRush_Soldier" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXProjectile_Power_ConcussiveShot::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_Power_ConcussiveShot::pClassPointer { L"Class SFXGameContent_Powers.SFXProjectile_Power_ConcussiveShot", &UObject::FindClass };
 
 class UClass* ASFXProjectile_Power_ConcussiveShot::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXProjectile_Power_ConcussiveShot" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_ConcussiveShot_Heavy::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_ConcussiveShot_Heavy::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_ConcussiveShot_Heavy", &UObject::FindClass };
 
 class UClass* USFXPower_ConcussiveShot_Heavy::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_ConcussiveShot_Heavy" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_ConcussiveShot_Radius::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_ConcussiveShot_Radius::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_ConcussiveShot_Radius", &UObject::FindClass };
 
 class UClass* USFXPower_ConcussiveShot_Radius::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_ConcussiveShot_Radius" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_ConcussiveShot_Soldier::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_ConcussiveShot_Soldier::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_ConcussiveShot_Soldier", &UObject::FindClass };
 
 class UClass* USFXPower_ConcussiveShot_Soldier::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_ConcussiveShot_Soldier" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CryoAmmo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CryoAmmo::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CryoAmmo", &UObject::FindClass };
 
 class UClass* USFXPower_CryoAmmo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CryoAmmo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_CryoAmmo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_CryoAmmo::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_CryoAmmo", &UObject::FindClass };
 
 class UClass* USFXPowerScript_CryoAmmo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_CryoAmmo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_CryoAmmo.ApplyPowerEffects
@@ -5389,10 +4852,9 @@ class UClass* USFXPowerScript_CryoAmmo::StaticClass()
 
 void USFXPowerScript_CryoAmmo::ApplyPowerEffects ( class ABioPawn* oPawn, class ASFXWeapon* oWeapon )
 {
-	static UFunction* pFnApplyPowerEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyPowerEffectsRef { L"Function SFXGameContent_Powers.SFXPowerScript_CryoAmmo.ApplyPowerEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyPowerEffects )
-		pFnApplyPowerEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_CryoAmmo.ApplyPowerEffects" );
+	UFunction* const pFnApplyPowerEffects = pFnApplyPowerEffectsRef.Get ( );
 
 	USFXPowerScript_CryoAmmo_execApplyPowerEffects_Parms ApplyPowerEffects_Parms;
 	ApplyPowerEffects_Parms.oPawn = oPawn;
@@ -5411,10 +4873,9 @@ void USFXPowerScript_CryoAmmo::ApplyPowerEffects ( class ABioPawn* oPawn, class
 
 bool USFXPowerScript_CryoAmmo::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.SFXPowerScript_CryoAmmo.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_CryoAmmo.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	USFXPowerScript_CryoAmmo_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -5433,10 +4894,9 @@ bool USFXPowerScript_CryoAmmo::eventStartPhase ( unsigned char ePhase, class AAc
 
 bool USFXPowerScript_CryoAmmo::ApplyToSquadMembers ( )
 {
-	static UFunction* pFnApplyToSquadMembers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyToSquadMembersRef { L"Function SFXGameContent_Powers.SFXPowerScript_CryoAmmo.ApplyToSquadMembers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyToSquadMembers )
-		pFnApplyToSquadMembers = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_CryoAmmo.ApplyToSquadMembers" );
+	UFunction* const pFnApplyToSquadMembers = pFnApplyToSquadMembersRef.Get ( );
 
 	USFXPowerScript_CryoAmmo_execApplyToSquadMembers_Parms ApplyToSquadMembers_Parms;
 
@@ -5451,10 +4911,9 @@ bool USFXPowerScript_CryoAmmo::ApplyToSquadMembers ( )
 
 void USFXPowerScript_CryoAmmo::eventInitializePowerScript ( )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.SFXPowerScript_CryoAmmo.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_CryoAmmo.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	USFXPowerScript_CryoAmmo_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 
@@ -5463,134 +4922,101 @@ void USFXPowerScript_CryoAmmo::eventInitializePowerScript ( )
 
 
 
-class UClass* USFXPower_CryoAmmo_Evolved1::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CryoAmmo_Evolved1::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CryoAmmo_Evolved1", &UObject::FindClass };
 
 class UClass* USFXPower_CryoAmmo_Evolved1::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CryoAmmo_Evolved1" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CryoAmmo_Evolved2::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CryoAmmo_Evolved2::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CryoAmmo_Evolved2", &UObject::FindClass };
 
 class UClass* USFXPower_CryoAmmo_Evolved2::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CryoAmmo_Evolved2" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CryoAmmo_Soldier::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CryoAmmo_Soldier::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CryoAmmo_Soldier", &UObject::FindClass };
 
 class UClass* USFXPower_CryoAmmo_Soldier::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CryoAmmo_Soldier" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_IncendiaryAmmo_Soldier::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_IncendiaryAmmo_Soldier::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_IncendiaryAmmo_Soldier", &UObject::FindClass };
 
 class UClass* USFXPower_IncendiaryAmmo_Soldier::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_IncendiaryAmmo_Soldier" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_IncendiaryAmmo_Squad::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_IncendiaryAmmo_Squad::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_IncendiaryAmmo_Squad", &UObject::FindClass };
 
 class UClass* USFXPower_IncendiaryAmmo_Squad::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_IncendiaryAmmo_Squad" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_IncendiaryAmmo_Radius::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_IncendiaryAmmo_Radius::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_IncendiaryAmmo_Radius", &UObject::FindClass };
 
 class UClass* USFXPower_IncendiaryAmmo_Radius::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_IncendiaryAmmo_Radius" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_DisruptorAmmo_Heavy::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_DisruptorAmmo_Heavy::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_DisruptorAmmo_Heavy", &UObject::FindClass };
 
 class UClass* USFXPower_DisruptorAmmo_Heavy::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_DisruptorAmmo_Heavy" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_DisruptorAmmo_Squad::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_DisruptorAmmo_Squad::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_DisruptorAmmo_Squad", &UObject::FindClass };
 
 class UClass* USFXPower_DisruptorAmmo_Squad::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_DisruptorAmmo_Squad" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_DisruptorAmmo_Soldier::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_DisruptorAmmo_Soldier::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_DisruptorAmmo_Soldier", &UObject::FindClass };
 
 class UClass* USFXPower_DisruptorAmmo_Soldier::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_DisruptorAmmo_Soldier" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_FirstAid::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_FirstAid::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_FirstAid", &UObject::FindClass };
 
 class UClass* USFXPower_FirstAid::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_FirstAid" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_FirstAid::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_FirstAid::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_FirstAid", &UObject::FindClass };
 
 class UClass* USFXPowerScript_FirstAid::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_FirstAid" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_FirstAid.GetHUDWheelIconInfo
@@ -5601,10 +5027,9 @@ class UClass* USFXPowerScript_FirstAid::StaticClass()
 
 FString USFXPowerScript_FirstAid::GetHUDWheelIconInfo ( class ABioPawn* OwnerPawn )
 {
-	static UFunction* pFnGetHUDWheelIconInfo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetHUDWheelIconInfoRef { L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.GetHUDWheelIconInfo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetHUDWheelIconInfo )
-		pFnGetHUDWheelIconInfo = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.GetHUDWheelIconInfo" );
+	UFunction* const pFnGetHUDWheelIconInfo = pFnGetHUDWheelIconInfoRef.Get ( );
 
 	USFXPowerScript_FirstAid_execGetHUDWheelIconInfo_Parms GetHUDWheelIconInfo_Parms;
 	GetHUDWheelIconInfo_Parms.OwnerPawn = OwnerPawn;
@@ -5624,10 +5049,9 @@ FString USFXPowerScript_FirstAid::GetHUDWheelIconInfo ( class ABioPawn* OwnerPaw
 
 bool USFXPowerScript_FirstAid::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerScript_FirstAid_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -5652,10 +5076,9 @@ bool USFXPowerScript_FirstAid::ShouldUsePower ( class AActor* Caster, class AAct
 
 int USFXPowerScript_FirstAid::CountMediGel ( class ABioPlayerSquad* oPlayerSquad )
 {
-	static UFunction* pFnCountMediGel = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCountMediGelRef { L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.CountMediGel", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCountMediGel )
-		pFnCountMediGel = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.CountMediGel" );
+	UFunction* const pFnCountMediGel = pFnCountMediGelRef.Get ( );
 
 	USFXPowerScript_FirstAid_execCountMediGel_Parms CountMediGel_Parms;
 	CountMediGel_Parms.oPlayerSquad = oPlayerSquad;
@@ -5676,10 +5099,9 @@ int USFXPowerScript_FirstAid::CountMediGel ( class ABioPlayerSquad* oPlayerSquad
 
 bool USFXPowerScript_FirstAid::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerScript_FirstAid_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -5702,10 +5124,9 @@ bool USFXPowerScript_FirstAid::eventOnImpact ( class AActor* oCaster, float fCas
 
 bool USFXPowerScript_FirstAid::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	USFXPowerScript_FirstAid_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -5725,10 +5146,9 @@ bool USFXPowerScript_FirstAid::eventStartPhase ( unsigned char ePhase, class AAc
 
 bool USFXPowerScript_FirstAid::eventCanStartPower ( class AActor* oCaster )
 {
-	static UFunction* pFnCanStartPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanStartPowerRef { L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.CanStartPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanStartPower )
-		pFnCanStartPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.CanStartPower" );
+	UFunction* const pFnCanStartPower = pFnCanStartPowerRef.Get ( );
 
 	USFXPowerScript_FirstAid_eventCanStartPower_Parms CanStartPower_Parms;
 	CanStartPower_Parms.oCaster = oCaster;
@@ -5740,38 +5160,29 @@ bool USFXPowerScript_FirstAid::eventCanStartPower ( class AActor* oCaster )
 
 
 
-class UClass* USFXPower_PlayerMeleePistol::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_PlayerMeleePistol::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_PlayerMeleePistol", &UObject::FindClass };
 
 class UClass* USFXPower_PlayerMeleePistol::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_PlayerMeleePistol" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_SoldierPassive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_SoldierPassive::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_SoldierPassive", &UObject::FindClass };
 
 class UClass* USFXPower_SoldierPassive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_SoldierPassive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_SoldierPassive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_SoldierPassive::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_SoldierPassive", &UObject::FindClass };
 
 class UClass* USFXPowerScript_SoldierPassive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_SoldierPassive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_SoldierPassive.ApplyGlobalBonus
@@ -5780,10 +5191,9 @@ class UClass* USFXPowerScript_SoldierPassive::StaticClass()
 
 void USFXPowerScript_SoldierPassive::ApplyGlobalBonus ( )
 {
-	static UFunction* pFnApplyGlobalBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyGlobalBonusRef { L"Function SFXGameContent_Powers.SFXPowerScript_SoldierPassive.ApplyGlobalBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyGlobalBonus )
-		pFnApplyGlobalBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_SoldierPassive.ApplyGlobalBonus" );
+	UFunction* const pFnApplyGlobalBonus = pFnApplyGlobalBonusRef.Get ( );
 
 	USFXPowerScript_SoldierPassive_execApplyGlobalBonus_Parms ApplyGlobalBonus_Parms;
 
@@ -5792,14 +5202,11 @@ void USFXPowerScript_SoldierPassive::ApplyGlobalBonus ( )
 
 
 
-class UClass* USFXPowerScript_PassivePower::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_PassivePower::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_PassivePower", &UObject::FindClass };
 
 class UClass* USFXPowerScript_PassivePower::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_PassivePower" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_PassivePower.RemovePowerBonusEffect
@@ -5812,10 +5219,9 @@ class UClass* USFXPowerScript_PassivePower::StaticClass()
 
 void USFXPowerScript_PassivePower::RemovePowerBonusEffect ( class AActor* oTarget, class UClass* ClassName, struct SFXName nmCategory, class UClass* PowerClass )
 {
-	static UFunction* pFnRemovePowerBonusEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRemovePowerBonusEffectRef { L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.RemovePowerBonusEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRemovePowerBonusEffect )
-		pFnRemovePowerBonusEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.RemovePowerBonusEffect" );
+	UFunction* const pFnRemovePowerBonusEffect = pFnRemovePowerBonusEffectRef.Get ( );
 
 	USFXPowerScript_PassivePower_execRemovePowerBonusEffect_Parms RemovePowerBonusEffect_Parms;
 	RemovePowerBonusEffect_Parms.oTarget = oTarget;
@@ -5837,10 +5243,9 @@ void USFXPowerScript_PassivePower::RemovePowerBonusEffect ( class AActor* oTarge
 
 void USFXPowerScript_PassivePower::ApplyPowerBonusEffect ( class AActor* oTarget, class UClass* ClassName, float fEffectValue, struct SFXName nmCategory, class UClass* PowerClass )
 {
-	static UFunction* pFnApplyPowerBonusEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyPowerBonusEffectRef { L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyPowerBonusEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyPowerBonusEffect )
-		pFnApplyPowerBonusEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyPowerBonusEffect" );
+	UFunction* const pFnApplyPowerBonusEffect = pFnApplyPowerBonusEffectRef.Get ( );
 
 	USFXPowerScript_PassivePower_execApplyPowerBonusEffect_Parms ApplyPowerBonusEffect_Parms;
 	ApplyPowerBonusEffect_Parms.oTarget = oTarget;
@@ -5860,10 +5265,9 @@ void USFXPowerScript_PassivePower::ApplyPowerBonusEffect ( class AActor* oTarget
 
 void USFXPowerScript_PassivePower::ApplyHealthModifier ( float fHealthModifier, class AActor* Target )
 {
-	static UFunction* pFnApplyHealthModifier = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyHealthModifierRef { L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyHealthModifier", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyHealthModifier )
-		pFnApplyHealthModifier = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyHealthModifier" );
+	UFunction* const pFnApplyHealthModifier = pFnApplyHealthModifierRef.Get ( );
 
 	USFXPowerScript_PassivePower_execApplyHealthModifier_Parms ApplyHealthModifier_Parms;
 	ApplyHealthModifier_Parms.fHealthModifier = fHealthModifier;
@@ -5880,10 +5284,9 @@ void USFXPowerScript_PassivePower::ApplyHealthModifier ( float fHealthModifier,
 
 void USFXPowerScript_PassivePower::ApplyWeaponDamageModifier ( float fDamageModifier, class AActor* Target )
 {
-	static UFunction* pFnApplyWeaponDamageModifier = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyWeaponDamageModifierRef { L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyWeaponDamageModifier", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyWeaponDamageModifier )
-		pFnApplyWeaponDamageModifier = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyWeaponDamageModifier" );
+	UFunction* const pFnApplyWeaponDamageModifier = pFnApplyWeaponDamageModifierRef.Get ( );
 
 	USFXPowerScript_PassivePower_execApplyWeaponDamageModifier_Parms ApplyWeaponDamageModifier_Parms;
 	ApplyWeaponDamageModifier_Parms.fDamageModifier = fDamageModifier;
@@ -5900,10 +5303,9 @@ void USFXPowerScript_PassivePower::ApplyWeaponDamageModifier ( float fDamageModi
 
 void USFXPowerScript_PassivePower::ApplyPowerCooldownModifier ( float fCooldownModifier, class AActor* Target )
 {
-	static UFunction* pFnApplyPowerCooldownModifier = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyPowerCooldownModifierRef { L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyPowerCooldownModifier", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyPowerCooldownModifier )
-		pFnApplyPowerCooldownModifier = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyPowerCooldownModifier" );
+	UFunction* const pFnApplyPowerCooldownModifier = pFnApplyPowerCooldownModifierRef.Get ( );
 
 	USFXPowerScript_PassivePower_execApplyPowerCooldownModifier_Parms ApplyPowerCooldownModifier_Parms;
 	ApplyPowerCooldownModifier_Parms.fCooldownModifier = fCooldownModifier;
@@ -5921,10 +5323,9 @@ void USFXPowerScript_PassivePower::ApplyPowerCooldownModifier ( float fCooldownM
 
 void USFXPowerScript_PassivePower::ApplyPassiveBonus ( class UClass* EffectClass, float fModifier, class AActor* Target )
 {
-	static UFunction* pFnApplyPassiveBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyPassiveBonusRef { L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyPassiveBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyPassiveBonus )
-		pFnApplyPassiveBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyPassiveBonus" );
+	UFunction* const pFnApplyPassiveBonus = pFnApplyPassiveBonusRef.Get ( );
 
 	USFXPowerScript_PassivePower_execApplyPassiveBonus_Parms ApplyPassiveBonus_Parms;
 	ApplyPassiveBonus_Parms.EffectClass = EffectClass;
@@ -5940,10 +5341,9 @@ void USFXPowerScript_PassivePower::ApplyPassiveBonus ( class UClass* EffectClass
 
 void USFXPowerScript_PassivePower::ApplyGlobalBonus ( )
 {
-	static UFunction* pFnApplyGlobalBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyGlobalBonusRef { L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyGlobalBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyGlobalBonus )
-		pFnApplyGlobalBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyGlobalBonus" );
+	UFunction* const pFnApplyGlobalBonus = pFnApplyGlobalBonusRef.Get ( );
 
 	USFXPowerScript_PassivePower_execApplyGlobalBonus_Parms ApplyGlobalBonus_Parms;
 
@@ -5957,10 +5357,9 @@ void USFXPowerScript_PassivePower::ApplyGlobalBonus ( )
 
 void USFXPowerScript_PassivePower::OnSquadMemberAdded ( class APawn* Pawn )
 {
-	static UFunction* pFnOnSquadMemberAdded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnSquadMemberAddedRef { L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.OnSquadMemberAdded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnSquadMemberAdded )
-		pFnOnSquadMemberAdded = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.OnSquadMemberAdded" );
+	UFunction* const pFnOnSquadMemberAdded = pFnOnSquadMemberAddedRef.Get ( );
 
 	USFXPowerScript_PassivePower_execOnSquadMemberAdded_Parms OnSquadMemberAdded_Parms;
 	OnSquadMemberAdded_Parms.Pawn = Pawn;
@@ -5974,10 +5373,9 @@ void USFXPowerScript_PassivePower::OnSquadMemberAdded ( class APawn* Pawn )
 
 void USFXPowerScript_PassivePower::OnPowersLoaded ( )
 {
-	static UFunction* pFnOnPowersLoaded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowersLoadedRef { L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.OnPowersLoaded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowersLoaded )
-		pFnOnPowersLoaded = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.OnPowersLoaded" );
+	UFunction* const pFnOnPowersLoaded = pFnOnPowersLoadedRef.Get ( );
 
 	USFXPowerScript_PassivePower_execOnPowersLoaded_Parms OnPowersLoaded_Parms;
 
@@ -5990,10 +5388,9 @@ void USFXPowerScript_PassivePower::OnPowersLoaded ( )
 
 void USFXPowerScript_PassivePower::OnPowerRankIncreased ( )
 {
-	static UFunction* pFnOnPowerRankIncreased = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowerRankIncreasedRef { L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.OnPowerRankIncreased", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowerRankIncreased )
-		pFnOnPowerRankIncreased = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.OnPowerRankIncreased" );
+	UFunction* const pFnOnPowerRankIncreased = pFnOnPowerRankIncreasedRef.Get ( );
 
 	USFXPowerScript_PassivePower_execOnPowerRankIncreased_Parms OnPowerRankIncreased_Parms;
 
@@ -6006,10 +5403,9 @@ void USFXPowerScript_PassivePower::OnPowerRankIncreased ( )
 
 void USFXPowerScript_PassivePower::eventInitializePowerScript ( )
 {
-	static UFunction* pFnInitializePowerScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerScriptRef { L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.InitializePowerScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerScript )
-		pFnInitializePowerScript = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.InitializePowerScript" );
+	UFunction* const pFnInitializePowerScript = pFnInitializePowerScriptRef.Get ( );
 
 	USFXPowerScript_PassivePower_eventInitializePowerScript_Parms InitializePowerScript_Parms;
 
@@ -6018,62 +5414,47 @@ void USFXPowerScript_PassivePower::eventInitializePowerScript ( )
 
 
 
-class UClass* USFXPower_SoldierPassive_Evolved1::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_SoldierPassive_Evolved1::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_SoldierPassive_Evolved1", &UObject::FindClass };
 
 class UClass* USFXPower_SoldierPassive_Evolved1::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_SoldierPassive_Evolved1" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_SoldierPassive_Evolved2::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_SoldierPassive_Evolved2::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_SoldierPassive_Evolved2", &UObject::FindClass };
 
 class UClass* USFXPower_SoldierPassive_Evolved2::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_SoldierPassive_Evolved2" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CombatDrone_NPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CombatDrone_NPC::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CombatDrone_NPC", &UObject::FindClass };
 
 class UClass* USFXPower_CombatDrone_NPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CombatDrone_NPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_ShieldBoost_NPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_ShieldBoost_NPC::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_ShieldBoost_NPC", &UObject::FindClass };
 
 class UClass* USFXPower_ShieldBoost_NPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_ShieldBoost_NPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioNeuralShockScript::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioNeuralShockScript::pClassPointer { L"Class SFXGameContent_Powers.BioNeuralShockScript", &UObject::FindClass };
 
 class UClass* UBioNeuralShockScript::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.BioNeuralShockScript" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.BioNeuralShockScript.ShouldUsePower
@@ -6086,10 +5467,9 @@ class UClass* UBioNeuralShockScript::StaticClass()
 
 bool UBioNeuralShockScript::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.BioNeuralShockScript.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioNeuralShockScript.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	UBioNeuralShockScript_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -6113,10 +5493,9 @@ bool UBioNeuralShockScript::ShouldUsePower ( class AActor* Caster, class AActor*
 
 void UBioNeuralShockScript::UnaffectPreviousTargets ( class AActor* oCaster )
 {
-	static UFunction* pFnUnaffectPreviousTargets = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnaffectPreviousTargetsRef { L"Function SFXGameContent_Powers.BioNeuralShockScript.UnaffectPreviousTargets", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnaffectPreviousTargets )
-		pFnUnaffectPreviousTargets = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioNeuralShockScript.UnaffectPreviousTargets" );
+	UFunction* const pFnUnaffectPreviousTargets = pFnUnaffectPreviousTargetsRef.Get ( );
 
 	UBioNeuralShockScript_execUnaffectPreviousTargets_Parms UnaffectPreviousTargets_Parms;
 	UnaffectPreviousTargets_Parms.oCaster = oCaster;
@@ -6131,10 +5510,9 @@ void UBioNeuralShockScript::UnaffectPreviousTargets ( class AActor* oCaster )
 
 void UBioNeuralShockScript::DisablePowers ( class AActor* oImpacted )
 {
-	static UFunction* pFnDisablePowers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDisablePowersRef { L"Function SFXGameContent_Powers.BioNeuralShockScript.DisablePowers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDisablePowers )
-		pFnDisablePowers = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioNeuralShockScript.DisablePowers" );
+	UFunction* const pFnDisablePowers = pFnDisablePowersRef.Get ( );
 
 	UBioNeuralShockScript_execDisablePowers_Parms DisablePowers_Parms;
 	DisablePowers_Parms.oImpacted = oImpacted;
@@ -6153,10 +5531,9 @@ void UBioNeuralShockScript::DisablePowers ( class AActor* oImpacted )
 
 bool UBioNeuralShockScript::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.BioNeuralShockScript.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioNeuralShockScript.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	UBioNeuralShockScript_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -6179,10 +5556,9 @@ bool UBioNeuralShockScript::eventOnImpact ( class AActor* oCaster, float fCaster
 
 bool UBioNeuralShockScript::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.BioNeuralShockScript.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.BioNeuralShockScript.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	UBioNeuralShockScript_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -6196,14 +5572,11 @@ bool UBioNeuralShockScript::eventStartPhase ( unsigned char ePhase, class AActor
 
 
 
-class UClass* USFXPower_NeuralShock::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_NeuralShock::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_NeuralShock", &UObject::FindClass };
 
 class UClass* USFXPower_NeuralShock::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_NeuralShock" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPower_NeuralShock.DisablePowers
@@ -6213,10 +5586,9 @@ class UClass* USFXPower_NeuralShock::StaticClass()
 
 bool USFXPower_NeuralShock::DisablePowers ( )
 {
-	static UFunction* pFnDisablePowers = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDisablePowersRef { L"Function SFXGameContent_Powers.SFXPower_NeuralShock.DisablePowers", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDisablePowers )
-		pFnDisablePowers = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPower_NeuralShock.DisablePowers" );
+	UFunction* const pFnDisablePowers = pFnDisablePowersRef.Get ( );
 
 	USFXPower_NeuralShock_execDisablePowers_Parms DisablePowers_Parms;
 
@@ -6232,10 +5604,9 @@ bool USFXPower_NeuralShock::DisablePowers ( )
 
 float USFXPower_NeuralShock::GetAccuracyPenalty ( )
 {
-	static UFunction* pFnGetAccuracyPenalty = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAccuracyPenaltyRef { L"Function SFXGameContent_Powers.SFXPower_NeuralShock.GetAccuracyPenalty", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAccuracyPenalty )
-		pFnGetAccuracyPenalty = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPower_NeuralShock.GetAccuracyPenalty" );
+	UFunction* const pFnGetAccuracyPenalty = pFnGetAccuracyPenaltyRef.Get ( );
 
 	USFXPower_NeuralShock_execGetAccuracyPenalty_Parms GetAccuracyPenalty_Parms;
 
@@ -6246,14 +5617,11 @@ float USFXPower_NeuralShock::GetAccuracyPenalty ( )
 
 
 
-class UClass* USFXGameEffect_DelayedNeuralShock::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_DelayedNeuralShock::pClassPointer { L"Class SFXGameContent_Powers.SFXGameEffect_DelayedNeuralShock", &UObject::FindClass };
 
 class UClass* USFXGameEffect_DelayedNeuralShock::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXGameEffect_DelayedNeuralShock" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXGameEffect_DelayedNeuralShock.OnRemoved
@@ -6262,10 +5630,9 @@ class UClass* USFXGameEffect_DelayedNeuralShock::StaticClass()
 
 void USFXGameEffect_DelayedNeuralShock::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent_Powers.SFXGameEffect_DelayedNeuralShock.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXGameEffect_DelayedNeuralShock.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_DelayedNeuralShock_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -6274,38 +5641,29 @@ void USFXGameEffect_DelayedNeuralShock::OnRemoved ( )
 
 
 
-class UClass* USFXDamageType_CryoFreeze::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_CryoFreeze::pClassPointer { L"Class SFXGameContent_Powers.SFXDamageType_CryoFreeze", &UObject::FindClass };
 
 class UClass* USFXDamageType_CryoFreeze::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXDamageType_CryoFreeze" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CryoFreeze::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CryoFreeze::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CryoFreeze", &UObject::FindClass };
 
 class UClass* USFXPower_CryoFreeze::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CryoFreeze" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_CryoFreeze::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_CryoFreeze::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_CryoFreeze", &UObject::FindClass };
 
 class UClass* USFXPowerScript_CryoFreeze::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_CryoFreeze" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_CryoFreeze.ShouldUsePower
@@ -6318,10 +5676,9 @@ class UClass* USFXPowerScript_CryoFreeze::StaticClass()
 
 bool USFXPowerScript_CryoFreeze::ShouldUsePower ( class AActor* Caster, class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent_Powers.SFXPowerScript_CryoFreeze.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_CryoFreeze.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerScript_CryoFreeze_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Caster = Caster;
@@ -6349,10 +5706,9 @@ bool USFXPowerScript_CryoFreeze::ShouldUsePower ( class AActor* Caster, class AA
 
 bool USFXPowerScript_CryoFreeze::eventOnImpact ( class AActor* oCaster, float fCasterStability, class AActor* oImpacted, int nPreviouslyImpacted )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent_Powers.SFXPowerScript_CryoFreeze.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_CryoFreeze.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerScript_CryoFreeze_eventOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.oCaster = oCaster;
@@ -6375,10 +5731,9 @@ bool USFXPowerScript_CryoFreeze::eventOnImpact ( class AActor* oCaster, float fC
 
 bool USFXPowerScript_CryoFreeze::eventStartPhase ( unsigned char ePhase, class AActor* oCaster, float fDuration )
 {
-	static UFunction* pFnStartPhase = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPhaseRef { L"Function SFXGameContent_Powers.SFXPowerScript_CryoFreeze.StartPhase", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPhase )
-		pFnStartPhase = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_CryoFreeze.StartPhase" );
+	UFunction* const pFnStartPhase = pFnStartPhaseRef.Get ( );
 
 	USFXPowerScript_CryoFreeze_eventStartPhase_Parms StartPhase_Parms;
 	StartPhase_Parms.ePhase = ePhase;
@@ -6392,170 +5747,128 @@ bool USFXPowerScript_CryoFreeze::eventStartPhase ( unsigned char ePhase, class A
 
 
 
-class UClass* USFXPower_CryoFreeze_Evolved1::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CryoFreeze_Evolved1::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CryoFreeze_Evolved1", &UObject::FindClass };
 
 class UClass* USFXPower_CryoFreeze_Evolved1::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CryoFreeze_Evolved1" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CryoFreeze_Evolved2::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CryoFreeze_Evolved2::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CryoFreeze_Evolved2", &UObject::FindClass };
 
 class UClass* USFXPower_CryoFreeze_Evolved2::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CryoFreeze_Evolved2" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CryoFreezeInstant::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CryoFreezeInstant::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CryoFreezeInstant", &UObject::FindClass };
 
 class UClass* USFXPower_CryoFreezeInstant::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CryoFreezeInstant" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CryoFreezeInstant_Evolved1::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CryoFreezeInstant_Evolved1::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CryoFreezeInstant_Evolved1", &UObject::FindClass };
 
 class UClass* USFXPower_CryoFreezeInstant_Evolved1::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CryoFreezeInstant_Evolved1" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CryoFreezeInstant_Evolved2::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CryoFreezeInstant_Evolved2::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CryoFreezeInstant_Evolved2", &UObject::FindClass };
 
 class UClass* USFXPower_CryoFreezeInstant_Evolved2::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CryoFreezeInstant_Evolved2" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_CryoFreeze_Mordin::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_CryoFreeze_Mordin::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_CryoFreeze_Mordin", &UObject::FindClass };
 
 class UClass* USFXPower_CryoFreeze_Mordin::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_CryoFreeze_Mordin" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Incinerate_Mordin::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Incinerate_Mordin::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Incinerate_Mordin", &UObject::FindClass };
 
 class UClass* USFXPower_Incinerate_Mordin::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Incinerate_Mordin" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_IncinerateInstant::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_IncinerateInstant::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_IncinerateInstant", &UObject::FindClass };
 
 class UClass* USFXPower_IncinerateInstant::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_IncinerateInstant" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Incinerate_Heavy_Hench::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Incinerate_Heavy_Hench::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Incinerate_Heavy_Hench", &UObject::FindClass };
 
 class UClass* USFXPower_Incinerate_Heavy_Hench::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Incinerate_Heavy_Hench" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_IncinerateInstant_Heavy::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_IncinerateInstant_Heavy::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_IncinerateInstant_Heavy", &UObject::FindClass };
 
 class UClass* USFXPower_IncinerateInstant_Heavy::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_IncinerateInstant_Heavy" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_Incinerate_Radius_Hench::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_Incinerate_Radius_Hench::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_Incinerate_Radius_Hench", &UObject::FindClass };
 
 class UClass* USFXPower_Incinerate_Radius_Hench::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_Incinerate_Radius_Hench" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_IncinerateInstant_Radius::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_IncinerateInstant_Radius::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_IncinerateInstant_Radius", &UObject::FindClass };
 
 class UClass* USFXPower_IncinerateInstant_Radius::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_IncinerateInstant_Radius" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_MordinPassive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_MordinPassive::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_MordinPassive", &UObject::FindClass };
 
 class UClass* USFXPower_MordinPassive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_MordinPassive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerScript_MordinPassive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerScript_MordinPassive::pClassPointer { L"Class SFXGameContent_Powers.SFXPowerScript_MordinPassive", &UObject::FindClass };
 
 class UClass* USFXPowerScript_MordinPassive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPowerScript_MordinPassive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent_Powers.SFXPowerScript_MordinPassive.ApplyGlobalBonus
@@ -6564,10 +5877,9 @@ class UClass* USFXPowerScript_MordinPassive::StaticClass()
 
 void USFXPowerScript_MordinPassive::ApplyGlobalBonus ( )
 {
-	static UFunction* pFnApplyGlobalBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyGlobalBonusRef { L"Function SFXGameContent_Powers.SFXPowerScript_MordinPassive.ApplyGlobalBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyGlobalBonus )
-		pFnApplyGlobalBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent_Powers.SFXPowerScript_MordinPassive.ApplyGlobalBonus" );
+	UFunction* const pFnApplyGlobalBonus = pFnApplyGlobalBonusRef.Get ( );
 
 	USFXPowerScript_MordinPassive_execApplyGlobalBonus_Parms ApplyGlobalBonus_Parms;
 
@@ -6576,54 +5888,436 @@ void USFXPowerScript_MordinPassive::ApplyGlobalBonus ( )
 
 
 
-class UClass* USFXPower_MordinPassive_Evolved1::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_MordinPassive_Evolved1::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_MordinPassive_Evolved1", &UObject::FindClass };
 
 class UClass* USFXPower_MordinPassive_Evolved1::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_MordinPassive_Evolved1" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_MordinPassive_Evolved2::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_MordinPassive_Evolved2::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_MordinPassive_Evolved2", &UObject::FindClass };
 
 class UClass* USFXPower_MordinPassive_Evolved2::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_MordinPassive_Evolved2" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_NeuralShock_Heavy::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_NeuralShock_Heavy::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_NeuralShock_Heavy", &UObject::FindClass };
 
 class UClass* USFXPower_NeuralShock_Heavy::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_NeuralShock_Heavy" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPower_NeuralShock_Radius::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPower_NeuralShock_Radius::pClassPointer { L"Class SFXGameContent_Powers.SFXPower_NeuralShock_Radius", &UObject::FindClass };
 
 class UClass* USFXPower_NeuralShock_Radius::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent_Powers.SFXPower_NeuralShock_Radius" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameContent_Powers.SFXPower_WarpProjectile_Radius",
+	L"Class SFXGameContent_Powers.SFXPower_WarpProjectile_Heavy",
+	L"Class SFXGameContent_Powers.SFXPower_Warp_Radius",
+	L"Class SFXGameContent_Powers.SFXPower_Warp_Heavy",
+	L"Class SFXGameContent_Powers.SFXPowerScript_Singularity_NPC",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Singularity_NPC.OnOwnerDied",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Singularity_NPC.ImpactNewTarget",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Singularity_NPC.OnProjectileExploded",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Singularity_NPC.StartPhase",
+	L"Class SFXGameContent_Powers.SFXPower_Singularity_Radius",
+	L"Class SFXGameContent_Powers.SFXPower_Singularity_Heavy",
+	L"Class SFXGameContent_Powers.SFXProjectile_Power_Singularity",
+	L"Class SFXGameContent_Powers.SFXPowerScript_ShieldBoost",
+	L"Class SFXGameContent_Powers.SFXPower_ShieldBoost",
+	L"Class SFXGameContent_Powers.SFXPower_Overload_Radius",
+	L"Class SFXGameContent_Powers.SFXPower_Overload_Heavy",
+	L"Class SFXGameContent_Powers.SFXPowerScript_Overload",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Overload.ShouldUsePower",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Overload.SpawnBigImpactVFX",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Overload.ExplodeEnemy",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Overload.CanEnemyBeExploded",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Overload.TurnOnDeathPower",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Overload.StunRobot",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Overload.OnImpact",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Overload.StartPhase",
+	L"Class SFXGameContent_Powers.SFXPower_Overload",
+	L"Function SFXGameContent_Powers.SFXPower_Overload.GetOverheatLength",
+	L"Function SFXGameContent_Powers.SFXPower_Overload.GetRobotStunLength",
+	L"Class SFXGameContent_Powers.SFXProjectile_Power_Seeking_NPC",
+	L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking_NPC.Tick",
+	L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking_NPC.GetAimLocation",
+	L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking_NPC.InitializePowerProjectile",
+	L"Class SFXGameContent_Powers.SFXPower_Incinerate_NPC",
+	L"Function SFXGameContent_Powers.SFXPower_Incinerate_NPC.GetDamage",
+	L"Class SFXGameContent_Powers.SFXPower_Incinerate_Radius",
+	L"Class SFXGameContent_Powers.SFXPower_Incinerate_Heavy",
+	L"Class SFXGameContent_Powers.SFXProjectile_Power_Seeking",
+	L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.Recycle",
+	L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.InitializeRotation",
+	L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.InitializePowerProjectile",
+	L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.CanLockOn",
+	L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.Tick",
+	L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.ShouldModifyVelocity",
+	L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.ChordLength",
+	L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.GetAimLocation",
+	L"Function SFXGameContent_Powers.SFXProjectile_Power_Seeking.AcquireTarget",
+	L"Class SFXGameContent_Powers.SFXProjectile_Power_SuperSeeking",
+	L"Function SFXGameContent_Powers.SFXProjectile_Power_SuperSeeking.InitializeRotation",
+	L"Class SFXGameContent_Powers.SFXProjectile_Incinerate",
+	L"Class SFXGameContent_Powers.SFXPowerScript_Incinerate",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.ShouldUsePower",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.ExplodeEnemy",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.CanEnemyBeExploded",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.CauseAnimatedReaction",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.OnImpact",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Incinerate.StartPhase",
+	L"Class SFXGameContent_Powers.SFXPower_Incinerate",
+	L"Function SFXGameContent_Powers.SFXPower_Incinerate.GetDuration",
+	L"Class SFXGameContent_Powers.SFXPower_CombatDroneShock",
+	L"Class SFXGameContent_Powers.SFXPowerScript_CombatDroneDeath",
+	L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneDeath.OnImpact",
+	L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneDeath.StartPhase",
+	L"Class SFXGameContent_Powers.SFXPower_CombatDroneDeath",
+	L"Class SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack_NPC",
+	L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack_NPC.ShouldUsePower",
+	L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack_NPC.OnImpact",
+	L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack_NPC.StartPhase",
+	L"Class SFXGameContent_Powers.SFXPower_CombatDroneAttack_NPC",
+	L"Class SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack",
+	L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack.ShouldUsePower",
+	L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack.OnImpact",
+	L"Function SFXGameContent_Powers.SFXPowerScript_CombatDroneAttack.StartPhase",
+	L"Class SFXGameContent_Powers.SFXPower_CombatDroneAttack",
+	L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Rocket",
+	L"Class SFXGameContent_Powers.SFXPower_Cloak_NPC",
+	L"Function SFXGameContent_Powers.SFXPower_Cloak_NPC.GetDamageMultiplier",
+	L"Class SFXGameContent_Powers.SFXPower_Cloak_Enhanced",
+	L"Class SFXGameContent_Powers.SFXPower_Cloak_Damage",
+	L"Class SFXGameContent_Powers.SFXPowerScript_Cloak",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Cloak.ShouldUsePower",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Cloak.OnCloakEnded",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Cloak.OnImpact",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Cloak.AdjustCooldown",
+	L"Function SFXGameContent_Powers.SFXPowerScript_Cloak.StartPhase",
+	L"Class SFXGameContent_Powers.SFXPower_Cloak",
+	L"Class SFXGameContent_Powers.SFXPower_Barrier_NPC",
+	L"Class SFXGameContent_Powers.SFXPower_Barrier_Damage",
+	L"Class SFXGameContent_Powers.SFXPower_Barrier_Heavy",
+	L"Class SFXGameContent_Powers.SFXPowerScript_Barrier",
+	L"Class SFXGameContent_Powers.SFXPower_LoyaltyRequirement",
+	L"Class SFXGameContent_Powers.SFXPower_Barrier",
+	L"Class SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase",
+	L"Function SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase.ShouldUsePower",
+	L"Function SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase.OnImpact",
+	L"Function SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase.OnShieldDestroyed",
+	L"Function SFXGameContent_Powers.SFXPowerScript_DefensiveShieldBase.InitializePowerScript",
+	L"Class SFXGameContent_Powers.SFXPower_DefensiveShieldBase",
+	L"Function SFXGameContent_Powers.SFXPower_DefensiveShieldBase.GetShieldValue",
+	L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Tech",
+	L"Class SFXGameContent_Powers.SFXPawn_EngineerTechDrone",
+	L"Function SFXGameContent_Powers.SFXPawn_EngineerTechDrone.SpawnDeathVFX",
+	L"Function SFXGameContent_Powers.SFXPawn_EngineerTechDrone.Died",
+	L"Class SFXGameContent_Powers.SFXPawn_EngineerRocketDrone",
+	L"Class SFXGameContent_Powers.SFXPawn_EngineerCombatDrone_NPC",
+	L"Class SFXGameContent_Powers.SFXGameEffect_OverheatWeapons",
+	L"Function SFXGameContent_Powers.SFXGameEffect_OverheatWeapons.OnRemoved",
+	L"Function SFXGameContent_Powers.SFXGameEffect_OverheatWeapons.OverheatWeapon",
+	L"Function SFXGameContent_Powers.SFXGameEffect_OverheatWeapons.OnUpdate",
+	L"Function SFXGameContent_Powers.SFXGameEffect_OverheatWeapons.OnApplied",
+	L"Class SFXGameContent_Powers.SFXGameEffect_CloakVFX",
+	L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.EndStealthVFX",
+	L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.RestoreMeshMaterials",
+	L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.TransitionOff",
+	L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.DelayedTransitionOff",
+	L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.OnRemoved",
+	L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.OnUpdate",
+	L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.StartTransition",
+	L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.SwapMeshMaterials",
+	L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.SwapInvisibleMaterials",
+	L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.StoreMeshMaterials",
+	L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.StoreStartingMaterials",
+	L"Function SFXGameContent_Powers.SFXGameEffect_CloakVFX.OnApplied",
+	L"Class SFXGameContent_Powers.SFXDamageType_CombatDroneShock",
+	L"Class SFXGameContent_Powers.SFXDamageType_CombatDroneAttack_NPC",
+	L"Class SFXGameContent_Powers.SFXPower_WarpProjectile",
+	L"Class SFXGameContent_Powers.SFXPower_Warp_NPC",
+	L"Function SFXGameContent_Powers.SFXPower_Warp_NPC.GetDamage",
+	L"Class SFXGameContent_Powers.SFXPower_Warp",
+	L"Class SFXGameContent_Powers.BioWarpScript",
+	L"Function SFXGameContent_Powers.BioWarpScript.ShouldUsePower",
+	L"Function SFXGameContent_Powers.BioWarpScript.TurnOffScriptSingularity",
+	L"Function SFXGameContent_Powers.BioWarpScript.StopSingularity",
+	L"Function SFXGameContent_Powers.BioWarpScript.SpawnBigImpactVFX",
+	L"Function SFXGameContent_Powers.BioWarpScript.DetonateBiotics",
+	L"Function SFXGameContent_Powers.BioWarpScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioWarpScript.StartPhase",
+	L"Class SFXGameContent_Powers.SFXPower_Singularity_NPC",
+	L"Function SFXGameContent_Powers.SFXPower_Singularity_NPC.GetDamage",
+	L"Class SFXGameContent_Powers.SFXPower_Singularity",
+	L"Class SFXGameContent_Powers.BioSingularityScript",
+	L"Function SFXGameContent_Powers.BioSingularityScript.ShouldUsePower",
+	L"Function SFXGameContent_Powers.BioSingularityScript.OnPowerRankIncreased",
+	L"Function SFXGameContent_Powers.BioSingularityScript.OnRagdollPhysicsImpact",
+	L"Function SFXGameContent_Powers.BioSingularityScript.ApplyVFX",
+	L"Function SFXGameContent_Powers.BioSingularityScript.SpawnSingularity",
+	L"Function SFXGameContent_Powers.BioSingularityScript.TurnOffSingularity",
+	L"Function SFXGameContent_Powers.BioSingularityScript.CanPutInSingularity",
+	L"Function SFXGameContent_Powers.BioSingularityScript.ImpactNewTarget",
+	L"Function SFXGameContent_Powers.BioSingularityScript.Tick",
+	L"Function SFXGameContent_Powers.BioSingularityScript.OnProjectileExploded",
+	L"Function SFXGameContent_Powers.BioSingularityScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioSingularityScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.BioReactionPowerScript",
+	L"Function SFXGameContent_Powers.BioReactionPowerScript.GetIncreasedReaction",
+	L"Function SFXGameContent_Powers.BioReactionPowerScript.GetCombatReaction",
+	L"Class SFXGameContent_Powers.SFXGameEffect_IgnorePawn",
+	L"Function SFXGameContent_Powers.SFXGameEffect_IgnorePawn.OnRemoved",
+	L"Function SFXGameContent_Powers.SFXGameEffect_IgnorePawn.OnApplied",
+	L"Class SFXGameContent_Powers.SFXPawn_EngineerCombatDrone",
+	L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.PlayDeathVocalization",
+	L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.Destroyed",
+	L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.Died",
+	L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.SetDroneColor2",
+	L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.SetDroneColor",
+	L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.PostBeginPlay",
+	L"Function SFXGameContent_Powers.SFXPawn_EngineerCombatDrone.OnDroneKilled",
+	L"Class SFXGameContent_Powers.SFXPower_CombatDrone",
+	L"Function SFXGameContent_Powers.SFXPower_CombatDrone.GetHealthMultiplier",
+	L"Class SFXGameContent_Powers.BioCombatDroneScript",
+	L"Function SFXGameContent_Powers.BioCombatDroneScript.ShouldUsePower",
+	L"Function SFXGameContent_Powers.BioCombatDroneScript.OnDroneKilled",
+	L"Function SFXGameContent_Powers.BioCombatDroneScript.DespawnDrone",
+	L"Function SFXGameContent_Powers.BioCombatDroneScript.OnOwnerDied",
+	L"Function SFXGameContent_Powers.BioCombatDroneScript.OnPowerRankIncreased",
+	L"Function SFXGameContent_Powers.BioCombatDroneScript.SpawnDrone",
+	L"Function SFXGameContent_Powers.BioCombatDroneScript.GetSpawnLocation",
+	L"Function SFXGameContent_Powers.BioCombatDroneScript.GetBackLocation",
+	L"Function SFXGameContent_Powers.BioCombatDroneScript.GetFrontLocation",
+	L"Function SFXGameContent_Powers.BioCombatDroneScript.IsSafeSpawnLocation",
+	L"Function SFXGameContent_Powers.BioCombatDroneScript.IsDroneAlive",
+	L"Function SFXGameContent_Powers.BioCombatDroneScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioCombatDroneScript.CanStartPower",
+	L"Class SFXGameContent_Powers.SFXPower_TaliPassive_Evolved2",
+	L"Class SFXGameContent_Powers.SFXPower_TaliPassive_Evolved1",
+	L"Class SFXGameContent_Powers.SFXPowerScript_HenchmanPassive",
+	L"Function SFXGameContent_Powers.SFXPowerScript_HenchmanPassive.ApplyGlobalBonus",
+	L"Class SFXGameContent_Powers.SFXPowerScript_TaliPassive",
+	L"Function SFXGameContent_Powers.SFXPowerScript_TaliPassive.ApplyGlobalBonus",
+	L"Class SFXGameContent_Powers.SFXPower_TaliPassive",
+	L"Class SFXGameContent_Powers.SFXPower_ShieldJack_Evolved2",
+	L"Class SFXGameContent_Powers.SFXPower_ShieldJack_Evolved1",
+	L"Class SFXGameContent_Powers.SFXPower_HenchmanPassive",
+	L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Tech_Hench",
+	L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Tech_Tali",
+	L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Rocket_Hench",
+	L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Rocket_Tali",
+	L"Class SFXGameContent_Powers.SFXPower_CombatDrone_Tali",
+	L"Class SFXGameContent_Powers.SFXPower_AIHacking_Tali",
+	L"Class SFXGameContent_Powers.SFXPower_AIHacking_Radius_Hench",
+	L"Class SFXGameContent_Powers.SFXPower_AIHacking_Heavy_Hench",
+	L"Class SFXGameContent_Powers.SFXPower_AIHacking_Radius",
+	L"Class SFXGameContent_Powers.SFXPower_AIHacking_Heavy",
+	L"Class SFXGameContent_Powers.SFXPawn_EngineerTechDrone_Tali",
+	L"Class SFXGameContent_Powers.SFXPawn_EngineerRocketDrone_Tali",
+	L"Class SFXGameContent_Powers.SFXPawn_EngineerCombatDrone_Tali",
+	L"Class SFXGameContent_Powers.SFXDamageType_ImprovedShieldJack",
+	L"Class SFXGameContent_Powers.SFXPower_ShieldJack",
+	L"Class SFXGameContent_Powers.BioShieldJackScript",
+	L"Function SFXGameContent_Powers.BioShieldJackScript.ShouldUsePower",
+	L"Function SFXGameContent_Powers.BioShieldJackScript.GetCurrentEnergyShields",
+	L"Function SFXGameContent_Powers.BioShieldJackScript.SpawnImpactVFX",
+	L"Function SFXGameContent_Powers.BioShieldJackScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioShieldJackScript.StartPhase",
+	L"Class SFXGameContent_Powers.SFXGameEffect_HenchmenIgnorePawn",
+	L"Function SFXGameContent_Powers.SFXGameEffect_HenchmenIgnorePawn.OnRemoved",
+	L"Function SFXGameContent_Powers.SFXGameEffect_HenchmenIgnorePawn.OnApplied",
+	L"Class SFXGameContent_Powers.SFXPower_AIHacking",
+	L"Class SFXGameContent_Powers.BioHackingScript",
+	L"Function SFXGameContent_Powers.BioHackingScript.ShouldUsePower",
+	L"Function SFXGameContent_Powers.BioHackingScript.IsHacked",
+	L"Function SFXGameContent_Powers.BioHackingScript.RemoveWeakerHack",
+	L"Function SFXGameContent_Powers.BioHackingScript.UnHackPreviousTargets",
+	L"Function SFXGameContent_Powers.BioHackingScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioHackingScript.StartPhase",
+	L"Class SFXGameContent_Powers.BioWeaponPowerScript",
+	L"Function SFXGameContent_Powers.BioWeaponPowerScript.ShouldUsePower",
+	L"Function SFXGameContent_Powers.BioWeaponPowerScript.ApplyPowerEffects",
+	L"Function SFXGameContent_Powers.BioWeaponPowerScript.SetWeaponPower",
+	L"Function SFXGameContent_Powers.BioWeaponPowerScript.ReloadAmmoPower",
+	L"Function SFXGameContent_Powers.BioWeaponPowerScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioWeaponPowerScript.ApplyToSquadMembers",
+	L"Function SFXGameContent_Powers.BioWeaponPowerScript.GetDuration",
+	L"Function SFXGameContent_Powers.BioWeaponPowerScript.GetElapsedTime",
+	L"Function SFXGameContent_Powers.BioWeaponPowerScript.CanStartPower",
+	L"Class SFXGameContent_Powers.SFXGameEffect_AmmoPower",
+	L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.RemoveWeaponHologram",
+	L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.EnableWeaponHologram",
+	L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnWeaponUnequip",
+	L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnWeaponEquip",
+	L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnWeaponReload",
+	L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.GetDamageVocProbabilityMod",
+	L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnWeaponImpact",
+	L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnRemoved",
+	L"Function SFXGameContent_Powers.SFXGameEffect_AmmoPower.OnApplied",
+	L"Class SFXGameContent_Powers.BioCarnageScript",
+	L"Function SFXGameContent_Powers.BioCarnageScript.ApplyPowerEffects",
+	L"Function SFXGameContent_Powers.BioCarnageScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioCarnageScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioCarnageScript.ApplyToSquadMembers",
+	L"Function SFXGameContent_Powers.BioCarnageScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.SFXPower_IncendiaryAmmo",
+	L"Class SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo",
+	L"Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.CauseAnimatedReaction",
+	L"Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.AddGameEffects",
+	L"Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.DoEvolvedAoEImpact",
+	L"Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.GetDamageVocProbabilityMod",
+	L"Function SFXGameContent_Powers.SFXGameEffect_IncendiaryAmmo.OnWeaponImpact",
+	L"Class SFXGameContent_Powers.BioConcussiveShotScript",
+	L"Function SFXGameContent_Powers.BioConcussiveShotScript.ShouldUsePower",
+	L"Function SFXGameContent_Powers.BioConcussiveShotScript.OnRagdollPhysicsImpact",
+	L"Function SFXGameContent_Powers.BioConcussiveShotScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioConcussiveShotScript.StartPhase",
+	L"Class SFXGameContent_Powers.SFXPower_ConcussiveShot",
+	L"Class SFXGameContent_Powers.BioOverloadScript",
+	L"Function SFXGameContent_Powers.BioOverloadScript.ApplyPowerEffects",
+	L"Function SFXGameContent_Powers.BioOverloadScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioOverloadScript.StartPhase",
+	L"Function SFXGameContent_Powers.BioOverloadScript.ApplyToSquadMembers",
+	L"Function SFXGameContent_Powers.BioOverloadScript.InitializePowerScript",
+	L"Class SFXGameContent_Powers.SFXPower_DisruptorAmmo",
+	L"Class SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo",
+	L"Function SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo.StunRobot",
+	L"Function SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo.TurnOnDeathPower",
+	L"Function SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo.GetDamageVocProbabilityMod",
+	L"Function SFXGameContent_Powers.SFXGameEffect_DisruptorAmmo.OnWeaponImpact",
+	L"Class SFXGameContent_Powers.BioPlayerMeleeScript",
+	L"Function SFXGameContent_Powers.BioPlayerMeleeScript.EndPhase",
+	L"Function SFXGameContent_Powers.BioPlayerMeleeScript.RemoveMeleeEffects",
+	L"Function SFXGameContent_Powers.BioPlayerMeleeScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioPlayerMeleeScript.Tick",
+	L"Function SFXGameContent_Powers.BioPlayerMeleeScript.StartPhase",
+	L"Class SFXGameContent_Powers.SFXPower_PlayerMelee",
+	L"Class SFXGameContent_Powers.SFXDamageType_CryoAmmo",
+	L"Class SFXGameContent_Powers.SFXGameEffect_CryoAmmo",
+	L"Function SFXGameContent_Powers.SFXGameEffect_CryoAmmo.GetDamageVocProbabilityMod",
+	L"Function SFXGameContent_Powers.SFXGameEffect_CryoAmmo.OnWeaponImpact",
+	L"Class SFXGameContent_Powers.SFXGameEffect_PowerBonus",
+	L"Class SFXGameContent_Powers.SFXPower_AdrenalineRush",
+	L"Class SFXGameContent_Powers.SFXPowerScript_AdrenalineRush",
+	L"Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.ApplyVFX",
+	L"Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.OnEffectEnded",
+	L"Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.OnImpact",
+	L"Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.AdjustCooldown",
+	L"Function SFXGameContent_Powers.SFXPowerScript_AdrenalineRush.StartPhase",
+	L"Class SFXGameContent_Powers.SFXPower_AdrenalineRush_Evolved1",
+	L"Class SFXGameContent_Powers.SFXPower_AdrenalineRush_Evolved2",
+	L"Class SFXGameContent_Powers.SFXPower_AdrenalineRush_Soldier",
+	L"Class SFXGameContent_Powers.SFXProjectile_Power_ConcussiveShot",
+	L"Class SFXGameContent_Powers.SFXPower_ConcussiveShot_Heavy",
+	L"Class SFXGameContent_Powers.SFXPower_ConcussiveShot_Radius",
+	L"Class SFXGameContent_Powers.SFXPower_ConcussiveShot_Soldier",
+	L"Class SFXGameContent_Powers.SFXPower_CryoAmmo",
+	L"Class SFXGameContent_Powers.SFXPowerScript_CryoAmmo",
+	L"Function SFXGameContent_Powers.SFXPowerScript_CryoAmmo.ApplyPowerEffects",
+	L"Function SFXGameContent_Powers.SFXPowerScript_CryoAmmo.StartPhase",
+	L"Function SFXGameContent_Powers.SFXPowerScript_CryoAmmo.ApplyToSquadMembers",
+	L"Function SFXGameContent_Powers.SFXPowerScript_CryoAmmo.InitializePowerScript",
+	L"Class SFXGameContent_Powers.SFXPower_CryoAmmo_Evolved1",
+	L"Class SFXGameContent_Powers.SFXPower_CryoAmmo_Evolved2",
+	L"Class SFXGameContent_Powers.SFXPower_CryoAmmo_Soldier",
+	L"Class SFXGameContent_Powers.SFXPower_IncendiaryAmmo_Soldier",
+	L"Class SFXGameContent_Powers.SFXPower_IncendiaryAmmo_Squad",
+	L"Class SFXGameContent_Powers.SFXPower_IncendiaryAmmo_Radius",
+	L"Class SFXGameContent_Powers.SFXPower_DisruptorAmmo_Heavy",
+	L"Class SFXGameContent_Powers.SFXPower_DisruptorAmmo_Squad",
+	L"Class SFXGameContent_Powers.SFXPower_DisruptorAmmo_Soldier",
+	L"Class SFXGameContent_Powers.SFXPower_FirstAid",
+	L"Class SFXGameContent_Powers.SFXPowerScript_FirstAid",
+	L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.GetHUDWheelIconInfo",
+	L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.ShouldUsePower",
+	L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.CountMediGel",
+	L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.OnImpact",
+	L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.StartPhase",
+	L"Function SFXGameContent_Powers.SFXPowerScript_FirstAid.CanStartPower",
+	L"Class SFXGameContent_Powers.SFXPower_PlayerMeleePistol",
+	L"Class SFXGameContent_Powers.SFXPower_SoldierPassive",
+	L"Class SFXGameContent_Powers.SFXPowerScript_SoldierPassive",
+	L"Function SFXGameContent_Powers.SFXPowerScript_SoldierPassive.ApplyGlobalBonus",
+	L"Class SFXGameContent_Powers.SFXPowerScript_PassivePower",
+	L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.RemovePowerBonusEffect",
+	L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyPowerBonusEffect",
+	L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyHealthModifier",
+	L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyWeaponDamageModifier",
+	L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyPowerCooldownModifier",
+	L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyPassiveBonus",
+	L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.ApplyGlobalBonus",
+	L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.OnSquadMemberAdded",
+	L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.OnPowersLoaded",
+	L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.OnPowerRankIncreased",
+	L"Function SFXGameContent_Powers.SFXPowerScript_PassivePower.InitializePowerScript",
+	L"Class SFXGameContent_Powers.SFXPower_SoldierPassive_Evolved1",
+	L"Class SFXGameContent_Powers.SFXPower_SoldierPassive_Evolved2",
+	L"Class SFXGameContent_Powers.SFXPower_CombatDrone_NPC",
+	L"Class SFXGameContent_Powers.SFXPower_ShieldBoost_NPC",
+	L"Class SFXGameContent_Powers.BioNeuralShockScript",
+	L"Function SFXGameContent_Powers.BioNeuralShockScript.ShouldUsePower",
+	L"Function SFXGameContent_Powers.BioNeuralShockScript.UnaffectPreviousTargets",
+	L"Function SFXGameContent_Powers.BioNeuralShockScript.DisablePowers",
+	L"Function SFXGameContent_Powers.BioNeuralShockScript.OnImpact",
+	L"Function SFXGameContent_Powers.BioNeuralShockScript.StartPhase",
+	L"Class SFXGameContent_Powers.SFXPower_NeuralShock",
+	L"Function SFXGameContent_Powers.SFXPower_NeuralShock.DisablePowers",
+	L"Function SFXGameContent_Powers.SFXPower_NeuralShock.GetAccuracyPenalty",
+	L"Class SFXGameContent_Powers.SFXGameEffect_DelayedNeuralShock",
+	L"Function SFXGameContent_Powers.SFXGameEffect_DelayedNeuralShock.OnRemoved",
+	L"Class SFXGameContent_Powers.SFXDamageType_CryoFreeze",
+	L"Class SFXGameContent_Powers.SFXPower_CryoFreeze",
+	L"Class SFXGameContent_Powers.SFXPowerScript_CryoFreeze",
+	L"Function SFXGameContent_Powers.SFXPowerScript_CryoFreeze.ShouldUsePower",
+	L"Function SFXGameContent_Powers.SFXPowerScript_CryoFreeze.OnImpact",
+	L"Function SFXGameContent_Powers.SFXPowerScript_CryoFreeze.StartPhase",
+	L"Class SFXGameContent_Powers.SFXPower_CryoFreeze_Evolved1",
+	L"Class SFXGameContent_Powers.SFXPower_CryoFreeze_Evolved2",
+	L"Class SFXGameContent_Powers.SFXPower_CryoFreezeInstant",
+	L"Class SFXGameContent_Powers.SFXPower_CryoFreezeInstant_Evolved1",
+	L"Class SFXGameContent_Powers.SFXPower_CryoFreezeInstant_Evolved2",
+	L"Class SFXGameContent_Powers.SFXPower_CryoFreeze_Mordin",
+	L"Class SFXGameContent_Powers.SFXPower_Incinerate_Mordin",
+	L"Class SFXGameContent_Powers.SFXPower_IncinerateInstant",
+	L"Class SFXGameContent_Powers.SFXPower_Incinerate_Heavy_Hench",
+	L"Class SFXGameContent_Powers.SFXPower_IncinerateInstant_Heavy",
+	L"Class SFXGameContent_Powers.SFXPower_Incinerate_Radius_Hench",
+	L"Class SFXGameContent_Powers.SFXPower_IncinerateInstant_Radius",
+	L"Class SFXGameContent_Powers.SFXPower_MordinPassive",
+	L"Class SFXGameContent_Powers.SFXPowerScript_MordinPassive",
+	L"Function SFXGameContent_Powers.SFXPowerScript_MordinPassive.ApplyGlobalBonus",
+	L"Class SFXGameContent_Powers.SFXPower_MordinPassive_Evolved1",
+	L"Class SFXGameContent_Powers.SFXPower_MordinPassive_Evolved2",
+	L"Class SFXGameContent_Powers.SFXPower_NeuralShock_Heavy",
+	L"Class SFXGameContent_Powers.SFXPower_NeuralShock_Radius",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -84,7 +84,7 @@ public:
 	int                                                TextureBlockBehavior;                             		// 0x00F8 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -103,7 +103,7 @@ public:
 	unsigned long                                      bForceAutoSave : 1;                               		// 0x0118 (0x0004) [0x0000000000002002] [0x00000002] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -129,7 +129,7 @@ public:
 	int                                                MissionComplete_Platinum;                         		// 0x0108 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -152,7 +152,7 @@ public:
 	float                                              VerticalOffset;                                   		// 0x0124 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -168,7 +168,7 @@ class USFXSeqAct_CloseMissionCompletion : public USFXSeqAct_CloseChoiceGui
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -182,7 +182,7 @@ class USFXSeqAct_SystemsHandleArriveOnNormandy : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -200,7 +200,7 @@ class USFXSeqAct_ChooseLoadout : public USFXSeqAct_ChooseLoadoutBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -215,7 +215,7 @@ class ABioBaseSquadDesign : public ABioBaseSquad
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -229,7 +229,7 @@ class ABioBaseSquadDesignCombat : public ABioBaseSquadDesign
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -243,7 +243,7 @@ class ABioSquadCombat : public ABioBaseSquadDesignCombat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -258,7 +258,7 @@ public:
 	class UGFxMovieInfo*                               m_oMissionCompletionReferenced;                   		// 0x0154 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -279,7 +279,7 @@ public:
 	unsigned char                                      Position;                                         		// 0x010C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -296,7 +296,7 @@ public:
 	TArray<struct FLevelCompletionData>                CharmPersuadeDefs;                                		// 0x00F8 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -322,7 +322,7 @@ public:
 	unsigned long                                      bSkipNotifications : 1;                           		// 0x0130 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -339,7 +339,7 @@ class UBioFaction_Hostile1 : public UBioFaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -361,7 +361,7 @@ public:
 	unsigned char                                      MapLayout;                                        		// 0x0140 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -383,7 +383,7 @@ public:
 	unsigned long                                      m_bAlsoReturnDeadMembers : 1;                     		// 0x012C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -407,7 +407,7 @@ public:
 	unsigned long                                      m_bNotifiedCombatDone : 1;                        		// 0x012C (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -427,7 +427,7 @@ public:
 	class USFXCombatStateData*                         m_oCombatStateData;                               		// 0x00B4 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -451,7 +451,7 @@ public:
 	unsigned long                                      m_bInfiniteGlobalBudget : 1;                      		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -471,7 +471,7 @@ public:
 	class USFXCombatStateData*                         m_oCombatStateData;                               		// 0x0190 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -501,7 +501,7 @@ public:
 	unsigned long                                      bDebugMode : 1;                                   		// 0x0148 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -526,7 +526,7 @@ public:
 	class AActor*                                      m_oVolume;                                        		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -547,7 +547,7 @@ public:
 	unsigned long                                      bVelChange : 1;                                   		// 0x0118 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -565,7 +565,7 @@ public:
 	int                                                Threshold;                                        		// 0x010C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -591,7 +591,7 @@ public:
 	unsigned char                                      eClosedState;                                     		// 0x015C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
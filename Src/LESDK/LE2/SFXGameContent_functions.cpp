@@ -28,14 +28,11 @@
 
 
 
-class UClass* USFXSeqAct_TextureBlockConfig::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_TextureBlockConfig::pClassPointer { L"Class SFXGameContent.SFXSeqAct_TextureBlockConfig", &UObject::FindClass };
 
 class UClass* USFXSeqAct_TextureBlockConfig::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_TextureBlockConfig" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXSeqAct_TextureBlockConfig.Activated
@@ -44,10 +41,9 @@ class UClass* USFXSeqAct_TextureBlockConfig::StaticClass()
 
 void USFXSeqAct_TextureBlockConfig::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.SFXSeqAct_TextureBlockConfig.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_TextureBlockConfig.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_TextureBlockConfig_execActivated_Parms Activated_Parms;
 
@@ -56,14 +52,11 @@ void USFXSeqAct_TextureBlockConfig::Activated ( )
 
 
 
-class UClass* USFXSeqAct_SaveGame::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_SaveGame::pClassPointer { L"Class SFXGameContent.SFXSeqAct_SaveGame", &UObject::FindClass };
 
 class UClass* USFXSeqAct_SaveGame::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_SaveGame" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXSeqAct_SaveGame.GetObjClassVersion
@@ -73,10 +66,9 @@ class UClass* USFXSeqAct_SaveGame::StaticClass()
 
 int USFXSeqAct_SaveGame::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContent.SFXSeqAct_SaveGame.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_SaveGame.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USFXSeqAct_SaveGame_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -92,10 +84,9 @@ int USFXSeqAct_SaveGame::eventGetObjClassVersion ( )
 
 void USFXSeqAct_SaveGame::BeginSave ( struct FSFXSaveDescriptor const& Descriptor )
 {
-	static UFunction* pFnBeginSave = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBeginSaveRef { L"Function SFXGameContent.SFXSeqAct_SaveGame.BeginSave", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBeginSave )
-		pFnBeginSave = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_SaveGame.BeginSave" );
+	UFunction* const pFnBeginSave = pFnBeginSaveRef.Get ( );
 
 	USFXSeqAct_SaveGame_execBeginSave_Parms BeginSave_Parms;
 	memcpy ( &BeginSave_Parms.Descriptor, &Descriptor, 0x28 );
@@ -109,10 +100,9 @@ void USFXSeqAct_SaveGame::BeginSave ( struct FSFXSaveDescriptor const& Descripto
 
 void USFXSeqAct_SaveGame::Deactivated ( )
 {
-	static UFunction* pFnDeactivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDeactivatedRef { L"Function SFXGameContent.SFXSeqAct_SaveGame.Deactivated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDeactivated )
-		pFnDeactivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_SaveGame.Deactivated" );
+	UFunction* const pFnDeactivated = pFnDeactivatedRef.Get ( );
 
 	USFXSeqAct_SaveGame_execDeactivated_Parms Deactivated_Parms;
 
@@ -127,10 +117,9 @@ void USFXSeqAct_SaveGame::Deactivated ( )
 
 bool USFXSeqAct_SaveGame::Update ( float DeltaTime )
 {
-	static UFunction* pFnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdateRef { L"Function SFXGameContent.SFXSeqAct_SaveGame.Update", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdate )
-		pFnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_SaveGame.Update" );
+	UFunction* const pFnUpdate = pFnUpdateRef.Get ( );
 
 	USFXSeqAct_SaveGame_execUpdate_Parms Update_Parms;
 	Update_Parms.DeltaTime = DeltaTime;
@@ -146,10 +135,9 @@ bool USFXSeqAct_SaveGame::Update ( float DeltaTime )
 
 void USFXSeqAct_SaveGame::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.SFXSeqAct_SaveGame.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_SaveGame.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_SaveGame_execActivated_Parms Activated_Parms;
 
@@ -163,10 +151,9 @@ void USFXSeqAct_SaveGame::Activated ( )
 
 class ABioPlayerController* USFXSeqAct_SaveGame::GetBioPlayerController ( )
 {
-	static UFunction* pFnGetBioPlayerController = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetBioPlayerControllerRef { L"Function SFXGameContent.SFXSeqAct_SaveGame.GetBioPlayerController", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetBioPlayerController )
-		pFnGetBioPlayerController = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_SaveGame.GetBioPlayerController" );
+	UFunction* const pFnGetBioPlayerController = pFnGetBioPlayerControllerRef.Get ( );
 
 	USFXSeqAct_SaveGame_execGetBioPlayerController_Parms GetBioPlayerController_Parms;
 
@@ -183,10 +170,9 @@ class ABioPlayerController* USFXSeqAct_SaveGame::GetBioPlayerController ( )
 
 bool USFXSeqAct_SaveGame::CanSave ( class ABioPlayerController* PC )
 {
-	static UFunction* pFnCanSave = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanSaveRef { L"Function SFXGameContent.SFXSeqAct_SaveGame.CanSave", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanSave )
-		pFnCanSave = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_SaveGame.CanSave" );
+	UFunction* const pFnCanSave = pFnCanSaveRef.Get ( );
 
 	USFXSeqAct_SaveGame_execCanSave_Parms CanSave_Parms;
 	CanSave_Parms.PC = PC;
@@ -198,14 +184,11 @@ bool USFXSeqAct_SaveGame::CanSave ( class ABioPlayerController* PC )
 
 
 
-class UClass* USFXSeqAct_ResourceSnapshot::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_ResourceSnapshot::pClassPointer { L"Class SFXGameContent.SFXSeqAct_ResourceSnapshot", &UObject::FindClass };
 
 class UClass* USFXSeqAct_ResourceSnapshot::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_ResourceSnapshot" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXSeqAct_ResourceSnapshot.GetObjClassVersion
@@ -215,10 +198,9 @@ class UClass* USFXSeqAct_ResourceSnapshot::StaticClass()
 
 int USFXSeqAct_ResourceSnapshot::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContent.SFXSeqAct_ResourceSnapshot.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_ResourceSnapshot.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USFXSeqAct_ResourceSnapshot_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -233,10 +215,9 @@ int USFXSeqAct_ResourceSnapshot::eventGetObjClassVersion ( )
 
 void USFXSeqAct_ResourceSnapshot::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.SFXSeqAct_ResourceSnapshot.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_ResourceSnapshot.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_ResourceSnapshot_execActivated_Parms Activated_Parms;
 
@@ -245,14 +226,11 @@ void USFXSeqAct_ResourceSnapshot::Activated ( )
 
 
 
-class UClass* USFXSeqAct_ExplodingPlaceable::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_ExplodingPlaceable::pClassPointer { L"Class SFXGameContent.SFXSeqAct_ExplodingPlaceable", &UObject::FindClass };
 
 class UClass* USFXSeqAct_ExplodingPlaceable::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_ExplodingPlaceable" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXSeqAct_ExplodingPlaceable.GetObjClassVersion
@@ -262,10 +240,9 @@ class UClass* USFXSeqAct_ExplodingPlaceable::StaticClass()
 
 int USFXSeqAct_ExplodingPlaceable::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContent.SFXSeqAct_ExplodingPlaceable.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_ExplodingPlaceable.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USFXSeqAct_ExplodingPlaceable_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -280,10 +257,9 @@ int USFXSeqAct_ExplodingPlaceable::eventGetObjClassVersion ( )
 
 void USFXSeqAct_ExplodingPlaceable::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.SFXSeqAct_ExplodingPlaceable.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_ExplodingPlaceable.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_ExplodingPlaceable_execActivated_Parms Activated_Parms;
 
@@ -292,26 +268,20 @@ void USFXSeqAct_ExplodingPlaceable::Activated ( )
 
 
 
-class UClass* USFXSeqAct_CloseMissionCompletion::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_CloseMissionCompletion::pClassPointer { L"Class SFXGameContent.SFXSeqAct_CloseMissionCompletion", &UObject::FindClass };
 
 class UClass* USFXSeqAct_CloseMissionCompletion::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_CloseMissionCompletion" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXSeqAct_SystemsHandleArriveOnNormandy::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_SystemsHandleArriveOnNormandy::pClassPointer { L"Class SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy", &UObject::FindClass };
 
 class UClass* USFXSeqAct_SystemsHandleArriveOnNormandy::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy.GetObjClassVersion
@@ -321,10 +291,9 @@ class UClass* USFXSeqAct_SystemsHandleArriveOnNormandy::StaticClass()
 
 int USFXSeqAct_SystemsHandleArriveOnNormandy::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USFXSeqAct_SystemsHandleArriveOnNormandy_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -340,10 +309,9 @@ int USFXSeqAct_SystemsHandleArriveOnNormandy::eventGetObjClassVersion ( )
 
 void USFXSeqAct_SystemsHandleArriveOnNormandy::HandleRestockAmmo ( class ASFXInventoryManager* oInventory )
 {
-	static UFunction* pFnHandleRestockAmmo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHandleRestockAmmoRef { L"Function SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy.HandleRestockAmmo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHandleRestockAmmo )
-		pFnHandleRestockAmmo = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy.HandleRestockAmmo" );
+	UFunction* const pFnHandleRestockAmmo = pFnHandleRestockAmmoRef.Get ( );
 
 	USFXSeqAct_SystemsHandleArriveOnNormandy_execHandleRestockAmmo_Parms HandleRestockAmmo_Parms;
 	HandleRestockAmmo_Parms.oInventory = oInventory;
@@ -358,10 +326,9 @@ void USFXSeqAct_SystemsHandleArriveOnNormandy::HandleRestockAmmo ( class ASFXInv
 
 void USFXSeqAct_SystemsHandleArriveOnNormandy::HandleRestockMediGel ( class ASFXInventoryManager* oInventory )
 {
-	static UFunction* pFnHandleRestockMediGel = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHandleRestockMediGelRef { L"Function SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy.HandleRestockMediGel", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHandleRestockMediGel )
-		pFnHandleRestockMediGel = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy.HandleRestockMediGel" );
+	UFunction* const pFnHandleRestockMediGel = pFnHandleRestockMediGelRef.Get ( );
 
 	USFXSeqAct_SystemsHandleArriveOnNormandy_execHandleRestockMediGel_Parms HandleRestockMediGel_Parms;
 	HandleRestockMediGel_Parms.oInventory = oInventory;
@@ -375,10 +342,9 @@ void USFXSeqAct_SystemsHandleArriveOnNormandy::HandleRestockMediGel ( class ASFX
 
 void USFXSeqAct_SystemsHandleArriveOnNormandy::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_SystemsHandleArriveOnNormandy_execActivated_Parms Activated_Parms;
 
@@ -387,14 +353,11 @@ void USFXSeqAct_SystemsHandleArriveOnNormandy::Activated ( )
 
 
 
-class UClass* USFXSeqAct_ChooseLoadout::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_ChooseLoadout::pClassPointer { L"Class SFXGameContent.SFXSeqAct_ChooseLoadout", &UObject::FindClass };
 
 class UClass* USFXSeqAct_ChooseLoadout::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_ChooseLoadout" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXSeqAct_ChooseLoadout.Activated
@@ -403,10 +366,9 @@ class UClass* USFXSeqAct_ChooseLoadout::StaticClass()
 
 void USFXSeqAct_ChooseLoadout::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.SFXSeqAct_ChooseLoadout.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_ChooseLoadout.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_ChooseLoadout_execActivated_Parms Activated_Parms;
 
@@ -415,38 +377,29 @@ void USFXSeqAct_ChooseLoadout::Activated ( )
 
 
 
-class UClass* ABioSquadCombat::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ABioSquadCombat::pClassPointer { L"Class SFXGameContent.BioSquadCombat", &UObject::FindClass };
 
 class UClass* ABioSquadCombat::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.BioSquadCombat" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioSeqAct_ShowMissionCompletion::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_ShowMissionCompletion::pClassPointer { L"Class SFXGameContent.BioSeqAct_ShowMissionCompletion", &UObject::FindClass };
 
 class UClass* UBioSeqAct_ShowMissionCompletion::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.BioSeqAct_ShowMissionCompletion" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UBioSeqAct_ShowHint::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_ShowHint::pClassPointer { L"Class SFXGameContent.BioSeqAct_ShowHint", &UObject::FindClass };
 
 class UClass* UBioSeqAct_ShowHint::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.BioSeqAct_ShowHint" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.BioSeqAct_ShowHint.GetObjClassVersion
@@ -456,10 +409,9 @@ class UClass* UBioSeqAct_ShowHint::StaticClass()
 
 int UBioSeqAct_ShowHint::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContent.BioSeqAct_ShowHint.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_ShowHint.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	UBioSeqAct_ShowHint_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -474,10 +426,9 @@ int UBioSeqAct_ShowHint::eventGetObjClassVersion ( )
 
 void UBioSeqAct_ShowHint::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.BioSeqAct_ShowHint.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_ShowHint.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	UBioSeqAct_ShowHint_execActivated_Parms Activated_Parms;
 
@@ -486,14 +437,11 @@ void UBioSeqAct_ShowHint::Activated ( )
 
 
 
-class UClass* UBioSeqAct_SetPlotPersuadeCheck::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_SetPlotPersuadeCheck::pClassPointer { L"Class SFXGameContent.BioSeqAct_SetPlotPersuadeCheck", &UObject::FindClass };
 
 class UClass* UBioSeqAct_SetPlotPersuadeCheck::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.BioSeqAct_SetPlotPersuadeCheck" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.BioSeqAct_SetPlotPersuadeCheck.Activated
@@ -502,10 +450,9 @@ class UClass* UBioSeqAct_SetPlotPersuadeCheck::StaticClass()
 
 void UBioSeqAct_SetPlotPersuadeCheck::eventActivated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.BioSeqAct_SetPlotPersuadeCheck.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_SetPlotPersuadeCheck.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	UBioSeqAct_SetPlotPersuadeCheck_eventActivated_Parms Activated_Parms;
 
@@ -519,10 +466,9 @@ void UBioSeqAct_SetPlotPersuadeCheck::eventActivated ( )
 
 class ABioWorldInfo* UBioSeqAct_SetPlotPersuadeCheck::getWorld ( )
 {
-	static UFunction* pFngetWorld = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFngetWorldRef { L"Function SFXGameContent.BioSeqAct_SetPlotPersuadeCheck.getWorld", &UObject::FindObject< UFunction > };
 
-	if ( ! pFngetWorld )
-		pFngetWorld = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_SetPlotPersuadeCheck.getWorld" );
+	UFunction* const pFngetWorld = pFngetWorldRef.Get ( );
 
 	UBioSeqAct_SetPlotPersuadeCheck_execgetWorld_Parms getWorld_Parms;
 
@@ -533,14 +479,11 @@ class ABioWorldInfo* UBioSeqAct_SetPlotPersuadeCheck::getWorld ( )
 
 
 
-class UClass* UBioSeqAct_GiveMissionXP::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_GiveMissionXP::pClassPointer { L"Class SFXGameContent.BioSeqAct_GiveMissionXP", &UObject::FindClass };
 
 class UClass* UBioSeqAct_GiveMissionXP::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.BioSeqAct_GiveMissionXP" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.BioSeqAct_GiveMissionXP.GetObjClassVersion
@@ -550,10 +493,9 @@ class UClass* UBioSeqAct_GiveMissionXP::StaticClass()
 
 int UBioSeqAct_GiveMissionXP::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContent.BioSeqAct_GiveMissionXP.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_GiveMissionXP.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	UBioSeqAct_GiveMissionXP_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -569,10 +511,9 @@ int UBioSeqAct_GiveMissionXP::eventGetObjClassVersion ( )
 
 int UBioSeqAct_GiveMissionXP::GetMissionXP ( )
 {
-	static UFunction* pFnGetMissionXP = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetMissionXPRef { L"Function SFXGameContent.BioSeqAct_GiveMissionXP.GetMissionXP", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetMissionXP )
-		pFnGetMissionXP = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_GiveMissionXP.GetMissionXP" );
+	UFunction* const pFnGetMissionXP = pFnGetMissionXPRef.Get ( );
 
 	UBioSeqAct_GiveMissionXP_execGetMissionXP_Parms GetMissionXP_Parms;
 
@@ -587,10 +528,9 @@ int UBioSeqAct_GiveMissionXP::GetMissionXP ( )
 
 void UBioSeqAct_GiveMissionXP::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.BioSeqAct_GiveMissionXP.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_GiveMissionXP.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	UBioSeqAct_GiveMissionXP_execActivated_Parms Activated_Parms;
 
@@ -599,50 +539,38 @@ void UBioSeqAct_GiveMissionXP::Activated ( )
 
 
 
-class UClass* UBioFaction_Hostile1::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioFaction_Hostile1::pClassPointer { L"Class SFXGameContent.BioFaction_Hostile1", &UObject::FindClass };
 
 class UClass* UBioFaction_Hostile1::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.BioFaction_Hostile1" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ABioBaseSquadDesignCombat::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ABioBaseSquadDesignCombat::pClassPointer { L"Class SFXGameContent.BioBaseSquadDesignCombat", &UObject::FindClass };
 
 class UClass* ABioBaseSquadDesignCombat::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.BioBaseSquadDesignCombat" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ABioBaseSquadDesign::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ABioBaseSquadDesign::pClassPointer { L"Class SFXGameContent.BioBaseSquadDesign", &UObject::FindClass };
 
 class UClass* ABioBaseSquadDesign::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.BioBaseSquadDesign" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXSeqAct_SetAreaMap::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_SetAreaMap::pClassPointer { L"Class SFXGameContent.SFXSeqAct_SetAreaMap", &UObject::FindClass };
 
 class UClass* USFXSeqAct_SetAreaMap::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_SetAreaMap" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXSeqAct_SetAreaMap.GetObjClassVersion
@@ -652,10 +580,9 @@ class UClass* USFXSeqAct_SetAreaMap::StaticClass()
 
 int USFXSeqAct_SetAreaMap::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContent.SFXSeqAct_SetAreaMap.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_SetAreaMap.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USFXSeqAct_SetAreaMap_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -670,10 +597,9 @@ int USFXSeqAct_SetAreaMap::eventGetObjClassVersion ( )
 
 void USFXSeqAct_SetAreaMap::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.SFXSeqAct_SetAreaMap.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_SetAreaMap.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_SetAreaMap_execActivated_Parms Activated_Parms;
 
@@ -682,14 +608,11 @@ void USFXSeqAct_SetAreaMap::Activated ( )
 
 
 
-class UClass* UBioSeqAct_GetMembersOfSquad::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_GetMembersOfSquad::pClassPointer { L"Class SFXGameContent.BioSeqAct_GetMembersOfSquad", &UObject::FindClass };
 
 class UClass* UBioSeqAct_GetMembersOfSquad::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.BioSeqAct_GetMembersOfSquad" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.BioSeqAct_GetMembersOfSquad.GetObjClassVersion
@@ -699,10 +622,9 @@ class UClass* UBioSeqAct_GetMembersOfSquad::StaticClass()
 
 int UBioSeqAct_GetMembersOfSquad::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContent.BioSeqAct_GetMembersOfSquad.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_GetMembersOfSquad.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	UBioSeqAct_GetMembersOfSquad_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -717,10 +639,9 @@ int UBioSeqAct_GetMembersOfSquad::eventGetObjClassVersion ( )
 
 void UBioSeqAct_GetMembersOfSquad::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.BioSeqAct_GetMembersOfSquad.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_GetMembersOfSquad.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	UBioSeqAct_GetMembersOfSquad_execActivated_Parms Activated_Parms;
 
@@ -734,10 +655,9 @@ void UBioSeqAct_GetMembersOfSquad::Activated ( )
 
 class APawn* UBioSeqAct_GetMembersOfSquad::FindAPawn ( )
 {
-	static UFunction* pFnFindAPawn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFindAPawnRef { L"Function SFXGameContent.BioSeqAct_GetMembersOfSquad.FindAPawn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFindAPawn )
-		pFnFindAPawn = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_GetMembersOfSquad.FindAPawn" );
+	UFunction* const pFnFindAPawn = pFnFindAPawnRef.Get ( );
 
 	UBioSeqAct_GetMembersOfSquad_execFindAPawn_Parms FindAPawn_Parms;
 
@@ -748,14 +668,11 @@ class APawn* UBioSeqAct_GetMembersOfSquad::FindAPawn ( )
 
 
 
-class UClass* UBioSeqAct_CombatController::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_CombatController::pClassPointer { L"Class SFXGameContent.BioSeqAct_CombatController", &UObject::FindClass };
 
 class UClass* UBioSeqAct_CombatController::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.BioSeqAct_CombatController" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.BioSeqAct_CombatController.GetObjClassVersion
@@ -765,10 +682,9 @@ class UClass* UBioSeqAct_CombatController::StaticClass()
 
 int UBioSeqAct_CombatController::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContent.BioSeqAct_CombatController.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_CombatController.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	UBioSeqAct_CombatController_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -785,10 +701,9 @@ int UBioSeqAct_CombatController::eventGetObjClassVersion ( )
 
 bool UBioSeqAct_CombatController::eventUpdate ( float DeltaTime )
 {
-	static UFunction* pFnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdateRef { L"Function SFXGameContent.BioSeqAct_CombatController.Update", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdate )
-		pFnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_CombatController.Update" );
+	UFunction* const pFnUpdate = pFnUpdateRef.Get ( );
 
 	UBioSeqAct_CombatController_eventUpdate_Parms Update_Parms;
 	Update_Parms.DeltaTime = DeltaTime;
@@ -804,10 +719,9 @@ bool UBioSeqAct_CombatController::eventUpdate ( float DeltaTime )
 
 void UBioSeqAct_CombatController::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.BioSeqAct_CombatController.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_CombatController.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	UBioSeqAct_CombatController_execActivated_Parms Activated_Parms;
 
@@ -821,10 +735,9 @@ void UBioSeqAct_CombatController::Activated ( )
 
 class USFXCombatStateData* UBioSeqAct_CombatController::GetCombatData ( )
 {
-	static UFunction* pFnGetCombatData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetCombatDataRef { L"Function SFXGameContent.BioSeqAct_CombatController.GetCombatData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetCombatData )
-		pFnGetCombatData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_CombatController.GetCombatData" );
+	UFunction* const pFnGetCombatData = pFnGetCombatDataRef.Get ( );
 
 	UBioSeqAct_CombatController_execGetCombatData_Parms GetCombatData_Parms;
 
@@ -840,10 +753,9 @@ class USFXCombatStateData* UBioSeqAct_CombatController::GetCombatData ( )
 
 void UBioSeqAct_CombatController::DebugLog ( FString const& sMessage )
 {
-	static UFunction* pFnDebugLog = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDebugLogRef { L"Function SFXGameContent.BioSeqAct_CombatController.DebugLog", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDebugLog )
-		pFnDebugLog = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_CombatController.DebugLog" );
+	UFunction* const pFnDebugLog = pFnDebugLogRef.Get ( );
 
 	UBioSeqAct_CombatController_execDebugLog_Parms DebugLog_Parms;
 	memcpy ( &DebugLog_Parms.sMessage, &sMessage, 0x10 );
@@ -853,26 +765,20 @@ void UBioSeqAct_CombatController::DebugLog ( FString const& sMessage )
 
 
 
-class UClass* UBioSeqVar_CombatState::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqVar_CombatState::pClassPointer { L"Class SFXGameContent.BioSeqVar_CombatState", &UObject::FindClass };
 
 class UClass* UBioSeqVar_CombatState::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.BioSeqVar_CombatState" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCombatStateData::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCombatStateData::pClassPointer { L"Class SFXGameContent.SFXCombatStateData", &UObject::FindClass };
 
 class UClass* USFXCombatStateData::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCombatStateData" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCombatStateData.GetEnemyCount
@@ -882,10 +788,9 @@ class UClass* USFXCombatStateData::StaticClass()
 
 int USFXCombatStateData::GetEnemyCount ( )
 {
-	static UFunction* pFnGetEnemyCount = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEnemyCountRef { L"Function SFXGameContent.SFXCombatStateData.GetEnemyCount", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEnemyCount )
-		pFnGetEnemyCount = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCombatStateData.GetEnemyCount" );
+	UFunction* const pFnGetEnemyCount = pFnGetEnemyCountRef.Get ( );
 
 	USFXCombatStateData_execGetEnemyCount_Parms GetEnemyCount_Parms;
 
@@ -900,10 +805,9 @@ int USFXCombatStateData::GetEnemyCount ( )
 
 void USFXCombatStateData::UpdateEnemyCount ( )
 {
-	static UFunction* pFnUpdateEnemyCount = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdateEnemyCountRef { L"Function SFXGameContent.SFXCombatStateData.UpdateEnemyCount", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdateEnemyCount )
-		pFnUpdateEnemyCount = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCombatStateData.UpdateEnemyCount" );
+	UFunction* const pFnUpdateEnemyCount = pFnUpdateEnemyCountRef.Get ( );
 
 	USFXCombatStateData_execUpdateEnemyCount_Parms UpdateEnemyCount_Parms;
 
@@ -917,10 +821,9 @@ void USFXCombatStateData::UpdateEnemyCount ( )
 
 void USFXCombatStateData::ReportSpawnResult ( unsigned long bSuccessfullySpawned )
 {
-	static UFunction* pFnReportSpawnResult = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReportSpawnResultRef { L"Function SFXGameContent.SFXCombatStateData.ReportSpawnResult", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReportSpawnResult )
-		pFnReportSpawnResult = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCombatStateData.ReportSpawnResult" );
+	UFunction* const pFnReportSpawnResult = pFnReportSpawnResultRef.Get ( );
 
 	USFXCombatStateData_execReportSpawnResult_Parms ReportSpawnResult_Parms;
 	ReportSpawnResult_Parms.bSuccessfullySpawned = bSuccessfullySpawned;
@@ -934,10 +837,9 @@ void USFXCombatStateData::ReportSpawnResult ( unsigned long bSuccessfullySpawned
 
 void USFXCombatStateData::ClearSpawnRequest ( )
 {
-	static UFunction* pFnClearSpawnRequest = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClearSpawnRequestRef { L"Function SFXGameContent.SFXCombatStateData.ClearSpawnRequest", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClearSpawnRequest )
-		pFnClearSpawnRequest = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCombatStateData.ClearSpawnRequest" );
+	UFunction* const pFnClearSpawnRequest = pFnClearSpawnRequestRef.Get ( );
 
 	USFXCombatStateData_execClearSpawnRequest_Parms ClearSpawnRequest_Parms;
 
@@ -952,10 +854,9 @@ void USFXCombatStateData::ClearSpawnRequest ( )
 
 void USFXCombatStateData::RequestSpawn ( struct SFXName nmRequesterName, TArray<class AActor*> const& aoSpawnPoints )
 {
-	static UFunction* pFnRequestSpawn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRequestSpawnRef { L"Function SFXGameContent.SFXCombatStateData.RequestSpawn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRequestSpawn )
-		pFnRequestSpawn = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCombatStateData.RequestSpawn" );
+	UFunction* const pFnRequestSpawn = pFnRequestSpawnRef.Get ( );
 
 	USFXCombatStateData_execRequestSpawn_Parms RequestSpawn_Parms;
 	memcpy ( &RequestSpawn_Parms.nmRequesterName, &nmRequesterName, 0x8 );
@@ -966,14 +867,11 @@ void USFXCombatStateData::RequestSpawn ( struct SFXName nmRequesterName, TArray<
 
 
 
-class UClass* UBioSeqAct_RespawnFactory::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_RespawnFactory::pClassPointer { L"Class SFXGameContent.BioSeqAct_RespawnFactory", &UObject::FindClass };
 
 class UClass* UBioSeqAct_RespawnFactory::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.BioSeqAct_RespawnFactory" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.BioSeqAct_RespawnFactory.GetObjClassVersion
@@ -983,10 +881,9 @@ class UClass* UBioSeqAct_RespawnFactory::StaticClass()
 
 int UBioSeqAct_RespawnFactory::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContent.BioSeqAct_RespawnFactory.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_RespawnFactory.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	UBioSeqAct_RespawnFactory_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -1001,10 +898,9 @@ int UBioSeqAct_RespawnFactory::eventGetObjClassVersion ( )
 
 void UBioSeqAct_RespawnFactory::Deactivated ( )
 {
-	static UFunction* pFnDeactivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDeactivatedRef { L"Function SFXGameContent.BioSeqAct_RespawnFactory.Deactivated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDeactivated )
-		pFnDeactivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_RespawnFactory.Deactivated" );
+	UFunction* const pFnDeactivated = pFnDeactivatedRef.Get ( );
 
 	UBioSeqAct_RespawnFactory_execDeactivated_Parms Deactivated_Parms;
 
@@ -1017,10 +913,9 @@ void UBioSeqAct_RespawnFactory::Deactivated ( )
 
 void UBioSeqAct_RespawnFactory::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.BioSeqAct_RespawnFactory.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_RespawnFactory.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	UBioSeqAct_RespawnFactory_execActivated_Parms Activated_Parms;
 
@@ -1034,10 +929,9 @@ void UBioSeqAct_RespawnFactory::Activated ( )
 
 class USFXCombatStateData* UBioSeqAct_RespawnFactory::GetCombatData ( )
 {
-	static UFunction* pFnGetCombatData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetCombatDataRef { L"Function SFXGameContent.BioSeqAct_RespawnFactory.GetCombatData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetCombatData )
-		pFnGetCombatData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_RespawnFactory.GetCombatData" );
+	UFunction* const pFnGetCombatData = pFnGetCombatDataRef.Get ( );
 
 	UBioSeqAct_RespawnFactory_execGetCombatData_Parms GetCombatData_Parms;
 
@@ -1048,14 +942,11 @@ class USFXCombatStateData* UBioSeqAct_RespawnFactory::GetCombatData ( )
 
 
 
-class UClass* UBioSeqAct_SpawnLocation::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_SpawnLocation::pClassPointer { L"Class SFXGameContent.BioSeqAct_SpawnLocation", &UObject::FindClass };
 
 class UClass* UBioSeqAct_SpawnLocation::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.BioSeqAct_SpawnLocation" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.BioSeqAct_SpawnLocation.GetObjClassVersion
@@ -1065,10 +956,9 @@ class UClass* UBioSeqAct_SpawnLocation::StaticClass()
 
 int UBioSeqAct_SpawnLocation::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContent.BioSeqAct_SpawnLocation.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_SpawnLocation.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	UBioSeqAct_SpawnLocation_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -1084,10 +974,9 @@ int UBioSeqAct_SpawnLocation::eventGetObjClassVersion ( )
 
 bool UBioSeqAct_SpawnLocation::CheckForFactoryFeedback ( )
 {
-	static UFunction* pFnCheckForFactoryFeedback = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCheckForFactoryFeedbackRef { L"Function SFXGameContent.BioSeqAct_SpawnLocation.CheckForFactoryFeedback", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCheckForFactoryFeedback )
-		pFnCheckForFactoryFeedback = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_SpawnLocation.CheckForFactoryFeedback" );
+	UFunction* const pFnCheckForFactoryFeedback = pFnCheckForFactoryFeedbackRef.Get ( );
 
 	UBioSeqAct_SpawnLocation_execCheckForFactoryFeedback_Parms CheckForFactoryFeedback_Parms;
 
@@ -1102,10 +991,9 @@ bool UBioSeqAct_SpawnLocation::CheckForFactoryFeedback ( )
 
 void UBioSeqAct_SpawnLocation::AttemptSpawn ( )
 {
-	static UFunction* pFnAttemptSpawn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAttemptSpawnRef { L"Function SFXGameContent.BioSeqAct_SpawnLocation.AttemptSpawn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAttemptSpawn )
-		pFnAttemptSpawn = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_SpawnLocation.AttemptSpawn" );
+	UFunction* const pFnAttemptSpawn = pFnAttemptSpawnRef.Get ( );
 
 	UBioSeqAct_SpawnLocation_execAttemptSpawn_Parms AttemptSpawn_Parms;
 
@@ -1120,10 +1008,9 @@ void UBioSeqAct_SpawnLocation::AttemptSpawn ( )
 
 bool UBioSeqAct_SpawnLocation::WaitToSpawn ( float DeltaTime )
 {
-	static UFunction* pFnWaitToSpawn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWaitToSpawnRef { L"Function SFXGameContent.BioSeqAct_SpawnLocation.WaitToSpawn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWaitToSpawn )
-		pFnWaitToSpawn = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_SpawnLocation.WaitToSpawn" );
+	UFunction* const pFnWaitToSpawn = pFnWaitToSpawnRef.Get ( );
 
 	UBioSeqAct_SpawnLocation_execWaitToSpawn_Parms WaitToSpawn_Parms;
 	WaitToSpawn_Parms.DeltaTime = DeltaTime;
@@ -1141,10 +1028,9 @@ bool UBioSeqAct_SpawnLocation::WaitToSpawn ( float DeltaTime )
 
 bool UBioSeqAct_SpawnLocation::eventUpdate ( float DeltaTime )
 {
-	static UFunction* pFnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdateRef { L"Function SFXGameContent.BioSeqAct_SpawnLocation.Update", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdate )
-		pFnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_SpawnLocation.Update" );
+	UFunction* const pFnUpdate = pFnUpdateRef.Get ( );
 
 	UBioSeqAct_SpawnLocation_eventUpdate_Parms Update_Parms;
 	Update_Parms.DeltaTime = DeltaTime;
@@ -1160,10 +1046,9 @@ bool UBioSeqAct_SpawnLocation::eventUpdate ( float DeltaTime )
 
 void UBioSeqAct_SpawnLocation::QueueSpawn ( )
 {
-	static UFunction* pFnQueueSpawn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnQueueSpawnRef { L"Function SFXGameContent.BioSeqAct_SpawnLocation.QueueSpawn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnQueueSpawn )
-		pFnQueueSpawn = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_SpawnLocation.QueueSpawn" );
+	UFunction* const pFnQueueSpawn = pFnQueueSpawnRef.Get ( );
 
 	UBioSeqAct_SpawnLocation_execQueueSpawn_Parms QueueSpawn_Parms;
 
@@ -1176,10 +1061,9 @@ void UBioSeqAct_SpawnLocation::QueueSpawn ( )
 
 void UBioSeqAct_SpawnLocation::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.BioSeqAct_SpawnLocation.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_SpawnLocation.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	UBioSeqAct_SpawnLocation_execActivated_Parms Activated_Parms;
 
@@ -1193,10 +1077,9 @@ void UBioSeqAct_SpawnLocation::Activated ( )
 
 void UBioSeqAct_SpawnLocation::DebugLog ( FString const& sMessage )
 {
-	static UFunction* pFnDebugLog = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDebugLogRef { L"Function SFXGameContent.BioSeqAct_SpawnLocation.DebugLog", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDebugLog )
-		pFnDebugLog = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_SpawnLocation.DebugLog" );
+	UFunction* const pFnDebugLog = pFnDebugLogRef.Get ( );
 
 	UBioSeqAct_SpawnLocation_execDebugLog_Parms DebugLog_Parms;
 	memcpy ( &DebugLog_Parms.sMessage, &sMessage, 0x10 );
@@ -1211,10 +1094,9 @@ void UBioSeqAct_SpawnLocation::DebugLog ( FString const& sMessage )
 
 class USFXCombatStateData* UBioSeqAct_SpawnLocation::GetCombatData ( )
 {
-	static UFunction* pFnGetCombatData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetCombatDataRef { L"Function SFXGameContent.BioSeqAct_SpawnLocation.GetCombatData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetCombatData )
-		pFnGetCombatData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_SpawnLocation.GetCombatData" );
+	UFunction* const pFnGetCombatData = pFnGetCombatDataRef.Get ( );
 
 	UBioSeqAct_SpawnLocation_execGetCombatData_Parms GetCombatData_Parms;
 
@@ -1225,14 +1107,11 @@ class USFXCombatStateData* UBioSeqAct_SpawnLocation::GetCombatData ( )
 
 
 
-class UClass* UBioSeqAct_CheckIfInVolume::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_CheckIfInVolume::pClassPointer { L"Class SFXGameContent.BioSeqAct_CheckIfInVolume", &UObject::FindClass };
 
 class UClass* UBioSeqAct_CheckIfInVolume::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.BioSeqAct_CheckIfInVolume" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.BioSeqAct_CheckIfInVolume.GetObjClassVersion
@@ -1242,10 +1121,9 @@ class UClass* UBioSeqAct_CheckIfInVolume::StaticClass()
 
 int UBioSeqAct_CheckIfInVolume::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContent.BioSeqAct_CheckIfInVolume.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_CheckIfInVolume.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	UBioSeqAct_CheckIfInVolume_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -1260,10 +1138,9 @@ int UBioSeqAct_CheckIfInVolume::eventGetObjClassVersion ( )
 
 void UBioSeqAct_CheckIfInVolume::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.BioSeqAct_CheckIfInVolume.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioSeqAct_CheckIfInVolume.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	UBioSeqAct_CheckIfInVolume_execActivated_Parms Activated_Parms;
 
@@ -1272,14 +1149,11 @@ void UBioSeqAct_CheckIfInVolume::Activated ( )
 
 
 
-class UClass* USFXSeqAct_ApplyImpulse::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_ApplyImpulse::pClassPointer { L"Class SFXGameContent.SFXSeqAct_ApplyImpulse", &UObject::FindClass };
 
 class UClass* USFXSeqAct_ApplyImpulse::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_ApplyImpulse" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXSeqAct_ApplyImpulse.Activated
@@ -1288,10 +1162,9 @@ class UClass* USFXSeqAct_ApplyImpulse::StaticClass()
 
 void USFXSeqAct_ApplyImpulse::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.SFXSeqAct_ApplyImpulse.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_ApplyImpulse.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_ApplyImpulse_execActivated_Parms Activated_Parms;
 
@@ -1300,14 +1173,11 @@ void USFXSeqAct_ApplyImpulse::Activated ( )
 
 
 
-class UClass* USFXSeqAct_CompareAliveSquadMembers::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_CompareAliveSquadMembers::pClassPointer { L"Class SFXGameContent.SFXSeqAct_CompareAliveSquadMembers", &UObject::FindClass };
 
 class UClass* USFXSeqAct_CompareAliveSquadMembers::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_CompareAliveSquadMembers" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXSeqAct_CompareAliveSquadMembers.Activated
@@ -1316,10 +1186,9 @@ class UClass* USFXSeqAct_CompareAliveSquadMembers::StaticClass()
 
 void USFXSeqAct_CompareAliveSquadMembers::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.SFXSeqAct_CompareAliveSquadMembers.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_CompareAliveSquadMembers.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_CompareAliveSquadMembers_execActivated_Parms Activated_Parms;
 
@@ -1328,14 +1197,11 @@ void USFXSeqAct_CompareAliveSquadMembers::Activated ( )
 
 
 
-class UClass* USFXSeqAct_LocationControlSpawnDoor::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_LocationControlSpawnDoor::pClassPointer { L"Class SFXGameContent.SFXSeqAct_LocationControlSpawnDoor", &UObject::FindClass };
 
 class UClass* USFXSeqAct_LocationControlSpawnDoor::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_LocationControlSpawnDoor" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.GetObjClassVersion
@@ -1345,10 +1211,9 @@ class UClass* USFXSeqAct_LocationControlSpawnDoor::StaticClass()
 
 int USFXSeqAct_LocationControlSpawnDoor::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USFXSeqAct_LocationControlSpawnDoor_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -1365,10 +1230,9 @@ int USFXSeqAct_LocationControlSpawnDoor::eventGetObjClassVersion ( )
 
 bool USFXSeqAct_LocationControlSpawnDoor::eventUpdate ( float DeltaTime )
 {
-	static UFunction* pFnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdateRef { L"Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.Update", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdate )
-		pFnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.Update" );
+	UFunction* const pFnUpdate = pFnUpdateRef.Get ( );
 
 	USFXSeqAct_LocationControlSpawnDoor_eventUpdate_Parms Update_Parms;
 	Update_Parms.DeltaTime = DeltaTime;
@@ -1385,10 +1249,9 @@ bool USFXSeqAct_LocationControlSpawnDoor::eventUpdate ( float DeltaTime )
 
 bool USFXSeqAct_LocationControlSpawnDoor::PawnIsInVolumes ( )
 {
-	static UFunction* pFnPawnIsInVolumes = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPawnIsInVolumesRef { L"Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.PawnIsInVolumes", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPawnIsInVolumes )
-		pFnPawnIsInVolumes = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.PawnIsInVolumes" );
+	UFunction* const pFnPawnIsInVolumes = pFnPawnIsInVolumesRef.Get ( );
 
 	USFXSeqAct_LocationControlSpawnDoor_execPawnIsInVolumes_Parms PawnIsInVolumes_Parms;
 
@@ -1403,10 +1266,9 @@ bool USFXSeqAct_LocationControlSpawnDoor::PawnIsInVolumes ( )
 
 void USFXSeqAct_LocationControlSpawnDoor::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_LocationControlSpawnDoor_execActivated_Parms Activated_Parms;
 
@@ -1420,10 +1282,9 @@ void USFXSeqAct_LocationControlSpawnDoor::Activated ( )
 
 bool USFXSeqAct_LocationControlSpawnDoor::AllDoorsClosed ( )
 {
-	static UFunction* pFnAllDoorsClosed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAllDoorsClosedRef { L"Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.AllDoorsClosed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAllDoorsClosed )
-		pFnAllDoorsClosed = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.AllDoorsClosed" );
+	UFunction* const pFnAllDoorsClosed = pFnAllDoorsClosedRef.Get ( );
 
 	USFXSeqAct_LocationControlSpawnDoor_execAllDoorsClosed_Parms AllDoorsClosed_Parms;
 
@@ -1434,6 +1295,107 @@ bool USFXSeqAct_LocationControlSpawnDoor::AllDoorsClosed ( )
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameContent.SFXSeqAct_TextureBlockConfig",
+	L"Function SFXGameContent.SFXSeqAct_TextureBlockConfig.Activated",
+	L"Class SFXGameContent.SFXSeqAct_SaveGame",
+	L"Function SFXGameContent.SFXSeqAct_SaveGame.GetObjClassVersion",
+	L"Function SFXGameContent.SFXSeqAct_SaveGame.BeginSave",
+	L"Function SFXGameContent.SFXSeqAct_SaveGame.Deactivated",
+	L"Function SFXGameContent.SFXSeqAct_SaveGame.Update",
+	L"Function SFXGameContent.SFXSeqAct_SaveGame.Activated",
+	L"Function SFXGameContent.SFXSeqAct_SaveGame.GetBioPlayerController",
+	L"Function SFXGameContent.SFXSeqAct_SaveGame.CanSave",
+	L"Class SFXGameContent.SFXSeqAct_ResourceSnapshot",
+	L"Function SFXGameContent.SFXSeqAct_ResourceSnapshot.GetObjClassVersion",
+	L"Function SFXGameContent.SFXSeqAct_ResourceSnapshot.Activated",
+	L"Class SFXGameContent.SFXSeqAct_ExplodingPlaceable",
+	L"Function SFXGameContent.SFXSeqAct_ExplodingPlaceable.GetObjClassVersion",
+	L"Function SFXGameContent.SFXSeqAct_ExplodingPlaceable.Activated",
+	L"Class SFXGameContent.SFXSeqAct_CloseMissionCompletion",
+	L"Class SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy",
+	L"Function SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy.GetObjClassVersion",
+	L"Function SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy.HandleRestockAmmo",
+	L"Function SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy.HandleRestockMediGel",
+	L"Function SFXGameContent.SFXSeqAct_SystemsHandleArriveOnNormandy.Activated",
+	L"Class SFXGameContent.SFXSeqAct_ChooseLoadout",
+	L"Function SFXGameContent.SFXSeqAct_ChooseLoadout.Activated",
+	L"Class SFXGameContent.BioSquadCombat",
+	L"Class SFXGameContent.BioSeqAct_ShowMissionCompletion",
+	L"Class SFXGameContent.BioSeqAct_ShowHint",
+	L"Function SFXGameContent.BioSeqAct_ShowHint.GetObjClassVersion",
+	L"Function SFXGameContent.BioSeqAct_ShowHint.Activated",
+	L"Class SFXGameContent.BioSeqAct_SetPlotPersuadeCheck",
+	L"Function SFXGameContent.BioSeqAct_SetPlotPersuadeCheck.Activated",
+	L"Function SFXGameContent.BioSeqAct_SetPlotPersuadeCheck.getWorld",
+	L"Class SFXGameContent.BioSeqAct_GiveMissionXP",
+	L"Function SFXGameContent.BioSeqAct_GiveMissionXP.GetObjClassVersion",
+	L"Function SFXGameContent.BioSeqAct_GiveMissionXP.GetMissionXP",
+	L"Function SFXGameContent.BioSeqAct_GiveMissionXP.Activated",
+	L"Class SFXGameContent.BioFaction_Hostile1",
+	L"Class SFXGameContent.BioBaseSquadDesignCombat",
+	L"Class SFXGameContent.BioBaseSquadDesign",
+	L"Class SFXGameContent.SFXSeqAct_SetAreaMap",
+	L"Function SFXGameContent.SFXSeqAct_SetAreaMap.GetObjClassVersion",
+	L"Function SFXGameContent.SFXSeqAct_SetAreaMap.Activated",
+	L"Class SFXGameContent.BioSeqAct_GetMembersOfSquad",
+	L"Function SFXGameContent.BioSeqAct_GetMembersOfSquad.GetObjClassVersion",
+	L"Function SFXGameContent.BioSeqAct_GetMembersOfSquad.Activated",
+	L"Function SFXGameContent.BioSeqAct_GetMembersOfSquad.FindAPawn",
+	L"Class SFXGameContent.BioSeqAct_CombatController",
+	L"Function SFXGameContent.BioSeqAct_CombatController.GetObjClassVersion",
+	L"Function SFXGameContent.BioSeqAct_CombatController.Update",
+	L"Function SFXGameContent.BioSeqAct_CombatController.Activated",
+	L"Function SFXGameContent.BioSeqAct_CombatController.GetCombatData",
+	L"Function SFXGameContent.BioSeqAct_CombatController.DebugLog",
+	L"Class SFXGameContent.BioSeqVar_CombatState",
+	L"Class SFXGameContent.SFXCombatStateData",
+	L"Function SFXGameContent.SFXCombatStateData.GetEnemyCount",
+	L"Function SFXGameContent.SFXCombatStateData.UpdateEnemyCount",
+	L"Function SFXGameContent.SFXCombatStateData.ReportSpawnResult",
+	L"Function SFXGameContent.SFXCombatStateData.ClearSpawnRequest",
+	L"Function SFXGameContent.SFXCombatStateData.RequestSpawn",
+	L"Class SFXGameContent.BioSeqAct_RespawnFactory",
+	L"Function SFXGameContent.BioSeqAct_RespawnFactory.GetObjClassVersion",
+	L"Function SFXGameContent.BioSeqAct_RespawnFactory.Deactivated",
+	L"Function SFXGameContent.BioSeqAct_RespawnFactory.Activated",
+	L"Function SFXGameContent.BioSeqAct_RespawnFactory.GetCombatData",
+	L"Class SFXGameContent.BioSeqAct_SpawnLocation",
+	L"Function SFXGameContent.BioSeqAct_SpawnLocation.GetObjClassVersion",
+	L"Function SFXGameContent.BioSeqAct_SpawnLocation.CheckForFactoryFeedback",
+	L"Function SFXGameContent.BioSeqAct_SpawnLocation.AttemptSpawn",
+	L"Function SFXGameContent.BioSeqAct_SpawnLocation.WaitToSpawn",
+	L"Function SFXGameContent.BioSeqAct_SpawnLocation.Update",
+	L"Function SFXGameContent.BioSeqAct_SpawnLocation.QueueSpawn",
+	L"Function SFXGameContent.BioSeqAct_SpawnLocation.Activated",
+	L"Function SFXGameContent.BioSeqAct_SpawnLocation.DebugLog",
+	L"Function SFXGameContent.BioSeqAct_SpawnLocation.GetCombatData",
+	L"Class SFXGameContent.BioSeqAct_CheckIfInVolume",
+	L"Function SFXGameContent.BioSeqAct_CheckIfInVolume.GetObjClassVersion",
+	L"Function SFXGameContent.BioSeqAct_CheckIfInVolume.Activated",
+	L"Class SFXGameContent.SFXSeqAct_ApplyImpulse",
+	L"Function SFXGameContent.SFXSeqAct_ApplyImpulse.Activated",
+	L"Class SFXGameContent.SFXSeqAct_CompareAliveSquadMembers",
+	L"Function SFXGameContent.SFXSeqAct_CompareAliveSquadMembers.Activated",
+	L"Class SFXGameContent.SFXSeqAct_LocationControlSpawnDoor",
+	L"Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.GetObjClassVersion",
+	L"Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.Update",
+	L"Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.PawnIsInVolumes",
+	L"Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.Activated",
+	L"Function SFXGameContent.SFXSeqAct_LocationControlSpawnDoor.AllDoorsClosed",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -47,7 +47,7 @@ class USFXGameEffect_Gear_CerberusHealthBonus : public USFXGameEffect_PassiveHea
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -61,7 +61,7 @@ class USFXGameEffect_Gear_CerberusHvyWpnMagazines : public USFXGameEffect_Passiv
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -75,7 +75,7 @@ class USFXGameEffect_Gear_CerberusShieldBonus : public USFXGameEffect_PassiveShi
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
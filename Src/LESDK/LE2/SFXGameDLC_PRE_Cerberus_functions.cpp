@@ -28,42 +28,50 @@
 
 
 
-class UClass* USFXGameEffect_Gear_CerberusHealthBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CerberusHealthBonus::pClassPointer { L"Class SFXGameDLC_PRE_Cerberus.SFXGameEffect_Gear_CerberusHealthBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CerberusHealthBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameDLC_PRE_Cerberus.SFXGameEffect_Gear_CerberusHealthBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CerberusHvyWpnMagazines::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CerberusHvyWpnMagazines::pClassPointer { L"Class SFXGameDLC_PRE_Cerberus.SFXGameEffect_Gear_CerberusHvyWpnMagazines", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CerberusHvyWpnMagazines::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameDLC_PRE_Cerberus.SFXGameEffect_Gear_CerberusHvyWpnMagazines" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CerberusShieldBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CerberusShieldBonus::pClassPointer { L"Class SFXGameDLC_PRE_Cerberus.SFXGameEffect_Gear_CerberusShieldBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CerberusShieldBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameDLC_PRE_Cerberus.SFXGameEffect_Gear_CerberusShieldBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameDLC_PRE_Cerberus.SFXGameEffect_Gear_CerberusHealthBonus",
+	L"Class SFXGameDLC_PRE_Cerberus.SFXGameEffect_Gear_CerberusHvyWpnMagazines",
+	L"Class SFXGameDLC_PRE_Cerberus.SFXGameEffect_Gear_CerberusShieldBonus",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -47,7 +47,7 @@ class USFXGameEffect_Gear_CollectorsHealthBonus : public USFXGameEffect_PassiveH
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -61,7 +61,7 @@ class USFXGameEffect_Gear_CollectorsRegenBonus : public USFXGameEffect_PassiveSh
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -75,7 +75,7 @@ class USFXGameEffect_Gear_CollectorsStormSpeed : public USFXGameEffect_PassiveSt
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
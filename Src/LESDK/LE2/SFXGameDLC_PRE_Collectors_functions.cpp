@@ -28,42 +28,50 @@
 
 
 
-class UClass* USFXGameEffect_Gear_CollectorsHealthBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CollectorsHealthBonus::pClassPointer { L"Class SFXGameDLC_PRE_Collectors.SFXGameEffect_Gear_CollectorsHealthBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CollectorsHealthBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameDLC_PRE_Collectors.SFXGameEffect_Gear_CollectorsHealthBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CollectorsRegenBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CollectorsRegenBonus::pClassPointer { L"Class SFXGameDLC_PRE_Collectors.SFXGameEffect_Gear_CollectorsRegenBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CollectorsRegenBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameDLC_PRE_Collectors.SFXGameEffect_Gear_CollectorsRegenBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_CollectorsStormSpeed::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_CollectorsStormSpeed::pClassPointer { L"Class SFXGameDLC_PRE_Collectors.SFXGameEffect_Gear_CollectorsStormSpeed", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_CollectorsStormSpeed::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameDLC_PRE_Collectors.SFXGameEffect_Gear_CollectorsStormSpeed" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameDLC_PRE_Collectors.SFXGameEffect_Gear_CollectorsHealthBonus",
+	L"Class SFXGameDLC_PRE_Collectors.SFXGameEffect_Gear_CollectorsRegenBonus",
+	L"Class SFXGameDLC_PRE_Collectors.SFXGameEffect_Gear_CollectorsStormSpeed",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
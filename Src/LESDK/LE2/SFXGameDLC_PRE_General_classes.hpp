@@ -47,7 +47,7 @@ class USFXGameEffect_Gear_InfernoNegotiationBonus : public USFXGameEffect_Passiv
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -61,7 +61,7 @@ class USFXGameEffect_Gear_InfernoPowerDamage : public USFXGameEffect_PowerDamage
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -75,7 +75,7 @@ class USFXGameEffect_Gear_InfernoStormSpeed : public USFXGameEffect_PassiveStorm
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
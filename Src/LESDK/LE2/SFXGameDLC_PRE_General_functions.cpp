@@ -28,42 +28,50 @@
 
 
 
-class UClass* USFXGameEffect_Gear_InfernoNegotiationBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_InfernoNegotiationBonus::pClassPointer { L"Class SFXGameDLC_PRE_General.SFXGameEffect_Gear_InfernoNegotiationBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_InfernoNegotiationBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameDLC_PRE_General.SFXGameEffect_Gear_InfernoNegotiationBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_InfernoPowerDamage::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_InfernoPowerDamage::pClassPointer { L"Class SFXGameDLC_PRE_General.SFXGameEffect_Gear_InfernoPowerDamage", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_InfernoPowerDamage::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameDLC_PRE_General.SFXGameEffect_Gear_InfernoPowerDamage" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_InfernoStormSpeed::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_InfernoStormSpeed::pClassPointer { L"Class SFXGameDLC_PRE_General.SFXGameEffect_Gear_InfernoStormSpeed", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_InfernoStormSpeed::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameDLC_PRE_General.SFXGameEffect_Gear_InfernoStormSpeed" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameDLC_PRE_General.SFXGameEffect_Gear_InfernoNegotiationBonus",
+	L"Class SFXGameDLC_PRE_General.SFXGameEffect_Gear_InfernoPowerDamage",
+	L"Class SFXGameDLC_PRE_General.SFXGameEffect_Gear_InfernoStormSpeed",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -28,42 +28,50 @@
 
 
 
-class UClass* USFXGameEffect_Gear_TerminusShieldBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_TerminusShieldBonus::pClassPointer { L"Class SFXGameDLC_PRE_Terminus.SFXGameEffect_Gear_TerminusShieldBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_TerminusShieldBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameDLC_PRE_Terminus.SFXGameEffect_Gear_TerminusShieldBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_TerminusStormSpeed::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_TerminusStormSpeed::pClassPointer { L"Class SFXGameDLC_PRE_Terminus.SFXGameEffect_Gear_TerminusStormSpeed", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_TerminusStormSpeed::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameDLC_PRE_Terminus.SFXGameEffect_Gear_TerminusStormSpeed" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Gear_TerminusWpnMagazines::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Gear_TerminusWpnMagazines::pClassPointer { L"Class SFXGameDLC_PRE_Terminus.SFXGameEffect_Gear_TerminusWpnMagazines", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Gear_TerminusWpnMagazines::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameDLC_PRE_Terminus.SFXGameEffect_Gear_TerminusWpnMagazines" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameDLC_PRE_Terminus.SFXGameEffect_Gear_TerminusShieldBonus",
+	L"Class SFXGameDLC_PRE_Terminus.SFXGameEffect_Gear_TerminusStormSpeed",
+	L"Class SFXGameDLC_PRE_Terminus.SFXGameEffect_Gear_TerminusWpnMagazines",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
@@ -28,42 +28,50 @@
 
 
 
-class UClass* ASFXPawn_Tali::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXPawn_Tali::pClassPointer { L"Class SFXGamePawns.SFXPawn_Tali", &UObject::FindClass };
 
 class UClass* ASFXPawn_Tali::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGamePawns.SFXPawn_Tali" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCharacterClass_Soldier::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCharacterClass_Soldier::pClassPointer { L"Class SFXGamePawns.SFXCharacterClass_Soldier", &UObject::FindClass };
 
 class UClass* USFXCharacterClass_Soldier::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGamePawns.SFXCharacterClass_Soldier" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXPawn_Mordin::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXPawn_Mordin::pClassPointer { L"Class SFXGamePawns.SFXPawn_Mordin", &UObject::FindClass };
 
 class UClass* ASFXPawn_Mordin::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGamePawns.SFXPawn_Mordin" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGamePawns.SFXPawn_Tali",
+	L"Class SFXGamePawns.SFXCharacterClass_Soldier",
+	L"Class SFXGamePawns.SFXPawn_Mordin",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
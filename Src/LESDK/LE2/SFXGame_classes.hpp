@@ -4493,7 +4493,7 @@ public:
 	unsigned long                                      m_bIsShowingMissingResources : 1;                 		// 0x0070 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4514,7 +4514,7 @@ public:
 	unsigned char                                      m_eVisualOverride;                                		// 0x0089 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4529,7 +4529,7 @@ public:
 	int                                                m_nMaterial;                                      		// 0x0074 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4546,7 +4546,7 @@ public:
 	int                                                m_nHairAppearance;                                		// 0x0080 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4566,7 +4566,7 @@ public:
 	unsigned char                                      m_eVisualOverride;                                		// 0x0098 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4585,7 +4585,7 @@ public:
 	unsigned long                                      m_bIsHeadLoaded : 1;                              		// 0x0088 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4600,7 +4600,7 @@ public:
 	class USkeletalMeshComponent*                      Mesh;                                             		// 0x028C (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4616,7 +4616,7 @@ public:
 	TArray<struct FBioHardLinkReference>               References;                                       		// 0x0060 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4644,7 +4644,7 @@ public:
 	unsigned long                                      m_bNotificationIsVisible : 1;                     		// 0x015C (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4692,7 +4692,7 @@ public:
 	float                                              m_aEntry[ 0xA ];                                  		// 0x006C (0x0028) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4707,7 +4707,7 @@ public:
 	class UBio2DA*                                     m_aLevelUp2DA[ 0x2 ];                             		// 0x0060 (0x0010) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4728,7 +4728,7 @@ public:
 	int                                                LoopBackFrame;                                    		// 0x0078 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4747,7 +4747,7 @@ public:
 	unsigned long                                      m_bEnableLogging : 1;                             		// 0x0070 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4774,7 +4774,7 @@ public:
 	unsigned long                                      bSubtractive : 1;                                 		// 0x02DC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4791,7 +4791,7 @@ public:
 	class UBio2DA*                                     oPlotTreasureTech2DA;                             		// 0x0070 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4811,7 +4811,7 @@ class UBioProceduralCameraBasic : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4827,7 +4827,7 @@ public:
 	struct FVector                                     m_vBoundarySize;                                  		// 0x028C (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4846,7 +4846,7 @@ public:
 	unsigned long                                      bUsingGamepad : 1;                                		// 0x00A0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4863,7 +4863,7 @@ public:
 	TArray<class USkeletalMesh*>                       Dependents;                                       		// 0x0424 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4880,7 +4880,7 @@ public:
 	float                                              m_fTimePassed;                                    		// 0x0298 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4894,7 +4894,7 @@ class USFXActorFactoryRigidBody : public UActorFactoryRigidBody
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4908,7 +4908,7 @@ class UBioActorFactoryPhysicsActor : public USFXActorFactoryRigidBody
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4954,7 +4954,7 @@ public:
 	unsigned char                                      FalloffType;                                      		// 0x0110 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4969,7 +4969,7 @@ class USFXDamageType_Suicide : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4991,7 +4991,7 @@ public:
 	unsigned long                                      bPrevBlockedState : 1;                            		// 0x0398 (0x0004) [0x0000000000002002] [0x00000020] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5066,7 +5066,7 @@ public:
 	unsigned char                                      PendingModeToRemove;                              		// 0x0C44 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5160,7 +5160,7 @@ public:
 	unsigned char                                      UsableConditionalName;                            		// 0x009D (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5233,7 +5233,7 @@ public:
 	unsigned char                                      PlanetPlotLabelConditionName;                     		// 0x01BB (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5271,7 +5271,7 @@ public:
 	unsigned long                                      ExploredCluster : 1;                              		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5289,7 +5289,7 @@ public:
 	TArray<class USFXCluster*>                         Clusters;                                         		// 0x00A0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5320,7 +5320,7 @@ public:
 	unsigned char                                      FeatureTransitionName;                            		// 0x00E8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5340,7 +5340,7 @@ public:
 	unsigned long                                      m_bShowNebula : 1;                                		// 0x00E0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5388,7 +5388,7 @@ public:
 	unsigned long                                      bShowSquadScreenMessageBoxes : 1;                 		// 0x0590 (0x0004) [0x0000000000002000] [0x00000040] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5467,7 +5467,7 @@ public:
 	int                                                srGameOverString;                                 		// 0x0594 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5485,7 +5485,7 @@ class ABioBasePlayerController : public APlayerController
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5627,7 +5627,7 @@ public:
 	unsigned char                                      bMine;                                            		// 0x0B85 (0x0001) [0x0000000000000004]              ( CPF_Input )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5833,7 +5833,7 @@ public:
 	unsigned char                                      Priority;                                         		// 0x00CC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5886,7 +5886,7 @@ public:
 	unsigned char                                      CurrentMode;                                      		// 0x00B8 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5946,7 +5946,7 @@ class USFXGameViewportClient : public UGFxGameViewportClient
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5966,7 +5966,7 @@ public:
 	unsigned long                                      ReplaceRegisteredTMWithFullHeightChar : 1;        		// 0x00D8 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5996,7 +5996,7 @@ public:
 	unsigned char                                      PlaybackState;                                    		// 0x00A8 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6029,7 +6029,7 @@ public:
 	float                                              BioticResistance;                                 		// 0x00DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6058,7 +6058,7 @@ public:
 	int                                                MaxWeapons;                                       		// 0x01C0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6085,7 +6085,7 @@ public:
 	unsigned char                                      RadarType;                                        		// 0x0070 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6113,7 +6113,7 @@ public:
 	float                                              AccelRate;                                        		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6129,7 +6129,7 @@ public:
 	float                                              m_fForcedHeight;                                  		// 0x0390 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6146,7 +6146,7 @@ public:
 	unsigned long                                      m_bIsFinalGoal : 1;                               		// 0x0394 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6173,7 +6173,7 @@ public:
 	int                                                WwiseNextIdx;                                     		// 0x03AC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6215,7 +6215,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x1C ];                            		// 0x0060 (0x001C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6229,7 +6229,7 @@ class ASFXPointOfInterest : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6257,7 +6257,7 @@ public:
 	unsigned char                                      AutoLevelUp;                                      		// 0x0371 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6274,7 +6274,7 @@ public:
 	TArray<struct FGrinderAchievement>                 GrinderAchievementSettings;                       		// 0x00E8 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6374,7 +6374,7 @@ public:
 	unsigned char                                      Difficulty;                                       		// 0x04FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6406,7 +6406,7 @@ class USFXSelectionLensFlareComponent : public ULensFlareComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6430,7 +6430,7 @@ public:
 	unsigned long                                      m_bCombatTargetable : 1;                          		// 0x00A4 (0x0004) [0x0000000004000009] [0x00000002] ( CPF_Edit | CPF_ExportObject | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6450,7 +6450,7 @@ public:
 	float                                              fUseRange;                                        		// 0x00B8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6467,7 +6467,7 @@ public:
 	unsigned long                                      selectable : 1;                                   		// 0x00A8 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6484,7 +6484,7 @@ public:
 	TArray<struct FTrilogyGrinderAchievementData>      StaticTrilogyGrinderAchievementData;              		// 0x00C8 (0x0010) [0x0000000000404001]              ( CPF_Edit | CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6506,7 +6506,7 @@ public:
 	TArray<struct FSFXVocalizationEventV2>             VocalizationsV2;                                  		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6530,7 +6530,7 @@ public:
 	unsigned long                                      bAlwaysPlay : 1;                                  		// 0x02C8 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6559,7 +6559,7 @@ public:
 	TArray<class UObject*>                             EnumForType;                                      		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6579,7 +6579,7 @@ public:
 	TArray<struct SFXName>                             m_sRowLabel;                                      		// 0x0158 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6630,7 +6630,7 @@ public:
 	TArray<int>                                        m_lstRowNumbers;                                  		// 0x01C0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6646,7 +6646,7 @@ public:
 	class AActor*                                      Instigator;                                       		// 0x0068 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6663,7 +6663,7 @@ public:
 	unsigned char                                      m_InitalizationEventType;                         		// 0x0074 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6715,7 +6715,7 @@ public:
 	unsigned char                                      m_ePreviousCoverAction;                           		// 0x00F1 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6747,7 +6747,7 @@ public:
 	unsigned long                                      m_bDone : 1;                                      		// 0x0084 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6765,7 +6765,7 @@ public:
 	unsigned long                                      m_bDataInitialized : 1;                           		// 0x0070 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6785,7 +6785,7 @@ public:
 	unsigned long                                      bDone : 1;                                        		// 0x0084 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6808,7 +6808,7 @@ public:
 	unsigned char                                      RBChannel;                                        		// 0x00C4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6841,7 +6841,7 @@ public:
 	unsigned long                                      m_bSuppressDisintegration : 1;                    		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000020] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6857,7 +6857,7 @@ class UBioInteractiveActorType : public UBioActorType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6895,7 +6895,7 @@ public:
 	unsigned char                                      m_eRole;                                          		// 0x0102 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6946,7 +6946,7 @@ public:
 	unsigned char                                      ChallengeType;                                    		// 0x01A3 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6962,7 +6962,7 @@ public:
 	class USkeletalMesh*                               m_Mesh;                                           		// 0x00C8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6978,7 +6978,7 @@ public:
 	TArray<struct FArtPlaceableRole>                   aRoles;                                           		// 0x0080 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6994,7 +6994,7 @@ public:
 	class UBioAnimNodeBlend_TurnInPlace*               TurnInPlaceNode;                                  		// 0x0108 (0x0008) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7010,7 +7010,7 @@ public:
 	class UAnimNode*                                   Parent;                                           		// 0x0078 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7026,7 +7026,7 @@ public:
 	unsigned long                                      bInitialized : 1;                                 		// 0x0070 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7058,7 +7058,7 @@ public:
 	unsigned long                                      bTransitioningToIdle : 1;                         		// 0x0160 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7082,7 +7082,7 @@ public:
 	unsigned long                                      m_bShowSlider : 1;                                		// 0x0118 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7097,7 +7097,7 @@ class UBioAnimNodeBlendAdditive : public UBioAnimNodeBlendBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7113,7 +7113,7 @@ public:
 	float                                              BlendOutDuration;                                 		// 0x0120 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7133,7 +7133,7 @@ public:
 	unsigned long                                      bProcessDamage : 1;                               		// 0x0134 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7157,7 +7157,7 @@ public:
 	unsigned long                                      m_isFadingOut : 1;                                		// 0x0134 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7185,7 +7185,7 @@ public:
 	unsigned long                                      m_bEventTriggered : 1;                            		// 0x0168 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7204,7 +7204,7 @@ public:
 	unsigned long                                      bForceLevelReferenceAngle : 1;                    		// 0x012C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7224,7 +7224,7 @@ public:
 	unsigned long                                      m_bSwitchingLean : 1;                             		// 0x0130 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7244,7 +7244,7 @@ public:
 	unsigned long                                      m_bWasMoving : 1;                                 		// 0x012C (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7262,7 +7262,7 @@ public:
 	unsigned long                                      m_bIsStarting : 1;                                		// 0x0128 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7276,7 +7276,7 @@ class UBioAnimNodeBlendGetUp : public UBioAnimNodeBlendBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7290,7 +7290,7 @@ class UBioAnimNodeBlendMoveStop : public UBioAnimNodeBlendBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7306,7 +7306,7 @@ public:
 	int                                                m_nNumAdditiveChildren;                           		// 0x0164 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7323,7 +7323,7 @@ public:
 	unsigned long                                      m_bGesturePlaying : 1;                            		// 0x0188 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7341,7 +7341,7 @@ public:
 	unsigned long                                      m_bTransitioning : 1;                             		// 0x0134 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7368,7 +7368,7 @@ public:
 	unsigned long                                      m_bUseBlendSpanTime : 1;                          		// 0x0170 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7391,7 +7391,7 @@ public:
 	unsigned long                                      m_bFinishSkidStarted : 1;                         		// 0x0138 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7418,7 +7418,7 @@ public:
 	unsigned char                                      SpeedType;                                        		// 0x0148 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7436,7 +7436,7 @@ public:
 	int                                                m_nActiveChild;                                   		// 0x013C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7456,7 +7456,7 @@ public:
 	unsigned char                                      m_currentState;                                   		// 0x0130 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7484,7 +7484,7 @@ public:
 	unsigned char                                      m_eCurrentAnimNode;                               		// 0x04E8 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7507,7 +7507,7 @@ public:
 	unsigned long                                      bUseMirrored : 1;                                 		// 0x013C (0x0004) [0x0000000000002001] [0x00000001] ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7521,7 +7521,7 @@ class UBioAnimNodeBlendByCustomAnim : public UAnimNodeBlend
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7537,7 +7537,7 @@ public:
 	unsigned long                                      bAdditiveMode : 1;                                		// 0x0120 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7558,7 +7558,7 @@ public:
 	unsigned long                                      CacheUpdated : 1;                                 		// 0x0154 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7575,7 +7575,7 @@ public:
 	float                                              BlendDuration;                                    		// 0x0110 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7591,7 +7591,7 @@ public:
 	unsigned char                                      NotifyActive;                                     		// 0x0120 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7606,7 +7606,7 @@ class UBioAnimNodeBlendByReload : public UAnimNodeBlendList
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7624,7 +7624,7 @@ public:
 	float                                              Storm2IdleBlendDuration;                          		// 0x0128 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7638,7 +7638,7 @@ class UBioAnimNodeBlendByWeaponAction : public UAnimNodeBlendList
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7659,7 +7659,7 @@ public:
 	unsigned long                                      bDisabledIK : 1;                                  		// 0x012C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7678,7 +7678,7 @@ public:
 	unsigned long                                      bRootMotionOverridden : 1;                        		// 0x0124 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7713,7 +7713,7 @@ public:
 	float                                              CurrentRunRate;                                   		// 0x0174 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7735,7 +7735,7 @@ public:
 	unsigned char                                      BoneBlendType;                                    		// 0x016C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7750,7 +7750,7 @@ public:
 	TArray<struct FBioAnimScalarNodeBehaviorDef>       m_aNodeDefinitions;                               		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7772,7 +7772,7 @@ public:
 	unsigned char                                      AxisDirMode;                                      		// 0x0077 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7788,7 +7788,7 @@ public:
 	float                                              m_fQueryPlayTime;                                 		// 0x0070 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7804,7 +7804,7 @@ public:
 	unsigned char                                      ActionBehavior;                                   		// 0x0078 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7822,7 +7822,7 @@ public:
 	unsigned char                                      CombatBehavior;                                   		// 0x0078 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7855,7 +7855,7 @@ public:
 	unsigned char                                      AxisDirMode;                                      		// 0x0096 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7875,7 +7875,7 @@ public:
 	float                                              DirAngle;                                         		// 0x011C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7892,7 +7892,7 @@ public:
 	float                                              YawTurnTriggerDegrees;                            		// 0x0128 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7913,7 +7913,7 @@ public:
 	float                                              Peek2DefaultBlendDuration;                        		// 0x0138 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7932,7 +7932,7 @@ public:
 	unsigned char                                      PendingCoverDirection;                            		// 0x0129 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7949,7 +7949,7 @@ public:
 	float                                              Move2IdleBlendDuration;                           		// 0x0128 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7964,7 +7964,7 @@ public:
 	float                                              BlendTime;                                        		// 0x011C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7997,7 +7997,7 @@ public:
 	unsigned char                                      RootRotationMode;                                 		// 0x013E (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8013,7 +8013,7 @@ public:
 	unsigned char                                      LastCoverAction;                                  		// 0x011C (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8030,7 +8030,7 @@ public:
 	unsigned long                                      m_bCaptureOnRelevant : 1;                         		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8051,7 +8051,7 @@ public:
 	float                                              StopToStartBlendDuration;                         		// 0x0134 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8079,7 +8079,7 @@ public:
 	float                                              Incline;                                          		// 0x013C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8097,7 +8097,7 @@ public:
 	float                                              WalkSpeed;                                        		// 0x012C (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8122,7 +8122,7 @@ public:
 	unsigned long                                      bOverrideRMR : 1;                                 		// 0x0158 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8141,7 +8141,7 @@ public:
 	unsigned long                                      bOverrideRootMotion : 1;                          		// 0x0138 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8157,7 +8157,7 @@ public:
 	unsigned long                                      bForceChildOnActive : 1;                          		// 0x013C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8179,7 +8179,7 @@ public:
 	unsigned long                                      bRandomizeStartTime : 1;                          		// 0x0178 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8196,7 +8196,7 @@ public:
 	unsigned char                                      BoneAxis;                                         		// 0x0154 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8216,7 +8216,7 @@ public:
 	unsigned long                                      bUseMirrored : 1;                                 		// 0x015C (0x0004) [0x0000000000002001] [0x00000001] ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8232,7 +8232,7 @@ public:
 	unsigned long                                      IsGlobal : 1;                                     		// 0x0068 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8247,7 +8247,7 @@ public:
 	struct SFXName                                     m_nmVisualEffectLabel;                            		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8265,7 +8265,7 @@ public:
 	unsigned long                                      bTransitionAllowed : 1;                           		// 0x0120 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8292,7 +8292,7 @@ public:
 	unsigned long                                      bInvertRoll : 1;                                  		// 0x0130 (0x0004) [0x0000000000000001] [0x00000020] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8308,7 +8308,7 @@ public:
 	unsigned long                                      bSeparateUpDownLimit : 1;                         		// 0x014C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8341,7 +8341,7 @@ public:
 	unsigned char                                      m_RootAnimBoneUpAxis;                             		// 0x01C1 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8362,7 +8362,7 @@ public:
 	unsigned long                                      bPoseCached : 1;                                  		// 0x0180 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8418,7 +8418,7 @@ public:
 	unsigned char                                      m_PendingDoorState;                               		// 0x03D2 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8446,7 +8446,7 @@ class ASFXGoreActor : public ASkeletalMeshActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8471,7 +8471,7 @@ public:
 	unsigned long                                      bHasWrinkles : 1;                                 		// 0x0320 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8493,7 +8493,7 @@ public:
 	unsigned long                                      bHasWrinkles : 1;                                 		// 0x0330 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8510,7 +8510,7 @@ public:
 	unsigned char                                      m_eReportMethod;                                  		// 0x0078 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8549,7 +8549,7 @@ public:
 	unsigned char                                      ModelType;                                        		// 0x0130 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8614,7 +8614,7 @@ public:
 	unsigned char                                      RagdollRecoverDirSwapBoneAxis;                    		// 0x017D (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8636,7 +8636,7 @@ public:
 	class USkeletalMesh*                               m_oModelMesh;                                     		// 0x0094 (0x0008) [0x0000000000000009]              ( CPF_Edit | CPF_ExportObject )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8666,7 +8666,7 @@ public:
 	unsigned long                                      UseWrinkles : 1;                                  		// 0x010C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8689,7 +8689,7 @@ public:
 	unsigned char                                      m_eArmorType;                                     		// 0x0158 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8707,7 +8707,7 @@ public:
 	int                                                m_previewVariantLabel;                            		// 0x00A4 (0x0004) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8748,7 +8748,7 @@ public:
 	unsigned long                                      bOneAnimFrameStates : 1;                          		// 0x014C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8762,7 +8762,7 @@ class UBio_Appr_Container : public UBioBaseAppearancePlaceable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8776,7 +8776,7 @@ class UBio_Appr_Door : public UBioBaseAppearancePlaceable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8790,7 +8790,7 @@ class UBio_Appr_Inert : public UBioBaseAppearancePlaceable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8804,7 +8804,7 @@ class UBio_Appr_Useable : public UBioBaseAppearancePlaceable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8819,7 +8819,7 @@ public:
 	class UBioActorBehavior*                           m_pBioActorBehavior;                              		// 0x0060 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8834,7 +8834,7 @@ public:
 	class AActor*                                      pActor;                                           		// 0x0068 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8850,7 +8850,7 @@ class UBioInterface_Appearance_ArtPlaceable : public UBioInterface_Appearance
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8875,7 +8875,7 @@ public:
 	unsigned long                                      m_bHeadGearVisiblePreference : 1;                 		// 0x00F4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8917,7 +8917,7 @@ public:
 	unsigned long                                      bIsFrozen : 1;                                    		// 0x0388 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8963,7 +8963,7 @@ public:
 	unsigned long                                      m_bSaveStateWhenPlayerEntered : 1;                		// 0x0398 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8980,7 +8980,7 @@ public:
 	unsigned long                                      m_bIsInitialized : 1;                             		// 0x006C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9002,7 +9002,7 @@ public:
 	float                                              m_initialRadarRange;                              		// 0x00C0 (0x0004) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9020,7 +9020,7 @@ public:
 	unsigned char                                      m_Race;                                           		// 0x00D8 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9046,7 +9046,7 @@ public:
 	unsigned long                                      m_bDisableAnimation : 1;                          		// 0x00AC (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9108,7 +9108,7 @@ public:
 	int                                                m_nCurrentReservationID;                          		// 0x00B8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9158,7 +9158,7 @@ public:
 	unsigned long                                      m_bPlayerOrderedPowerUse : 1;                     		// 0x00E8 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9215,7 +9215,7 @@ public:
 	unsigned char                                      ePathNodeGenerator;                               		// 0x02E9 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9236,7 +9236,7 @@ public:
 	unsigned long                                      ValidCurrentTrigger : 1;                          		// 0x007C (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9262,7 +9262,7 @@ public:
 	unsigned char                                      DefaultTierIndex;                                 		// 0x0094 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9303,7 +9303,7 @@ public:
 	unsigned char                                      Tier;                                             		// 0x0304 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9405,7 +9405,7 @@ public:
 	unsigned char                                      m_nJournalSortMethod;                             		// 0x0B19 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9524,7 +9524,7 @@ public:
 	unsigned long                                      m_bSuppressDisintegrationOverride : 1;            		// 0x014C (0x0004) [0x0000000000000001] [0x08000000] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9610,7 +9610,7 @@ public:
 	unsigned char                                      Conditional;                                      		// 0x01F5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9670,7 +9670,7 @@ public:
 	unsigned char                                      m_eWeaponFireMode;                                		// 0x01B3 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9800,7 +9800,7 @@ public:
 	unsigned char                                      m_eGetUpState;                                    		// 0x0345 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9849,7 +9849,7 @@ public:
 	TArray<struct FDLCInfo_t>                          DLCInfo;                                          		// 0x009C (0x0010) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9868,7 +9868,7 @@ public:
 	unsigned char                                      m_eDisplayMode;                                   		// 0x00B8 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9890,7 +9890,7 @@ public:
 	float                                              fLastRadius;                                      		// 0x00C0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9917,7 +9917,7 @@ public:
 	unsigned long                                      bWaitForNextFrame : 1;                            		// 0x00C4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9957,7 +9957,7 @@ public:
 	unsigned long                                      m_bStopScroll : 1;                                		// 0x011C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9990,7 +9990,7 @@ public:
 	class USFXGameChoiceGUIData_PRCShop*               m_ChoiceDataNoStrRef;                             		// 0x0130 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10030,7 +10030,7 @@ public:
 	unsigned long                                      m_bWasTriggered : 1;                              		// 0x012C (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10080,7 +10080,7 @@ public:
 	unsigned long                                      bFromKismet : 1;                                  		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10126,7 +10126,7 @@ public:
 	unsigned long                                      m_bAnalogScroll : 1;                              		// 0x0108 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10156,7 +10156,7 @@ public:
 	unsigned long                                      m_bCanInvoke : 1;                                 		// 0x0134 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10195,7 +10195,7 @@ public:
 	unsigned long                                      m_bWaitingForMsgBox : 1;                          		// 0x00A8 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10220,7 +10220,7 @@ public:
 	unsigned long                                      bMouseMovementEnabled : 1;                        		// 0x00AC (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10243,7 +10243,7 @@ public:
 	unsigned long                                      bWaitingOnLoad : 1;                               		// 0x00AC (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10272,7 +10272,7 @@ public:
 	unsigned long                                      m_bAnalogScroll : 1;                              		// 0x00D8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10294,7 +10294,7 @@ public:
 	unsigned long                                      bKeyboardEntrySucceeded : 1;                      		// 0x00CC (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10363,7 +10363,7 @@ public:
 	unsigned char                                      PendingCommand;                                   		// 0x014F (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10428,7 +10428,7 @@ class UBioSFHandler_PCMainMenu : public UBioSFHandler_MainMenu
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10458,7 +10458,7 @@ public:
 	unsigned long                                      m_bDisplayingHint : 1;                            		// 0x00E0 (0x0004) [0x0000000000002000] [0x00000080] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10486,7 +10486,7 @@ class UBioSFHandler_PCMessageBox : public UBioSFHandler_MessageBox
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10561,7 +10561,7 @@ public:
 	unsigned char                                      NextLookAtTarget;                                 		// 0x0250 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10632,7 +10632,7 @@ public:
 	unsigned long                                      bHeadLookEnabled : 1;                             		// 0x0264 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10677,7 +10677,7 @@ public:
 	unsigned char                                      GuiMode;                                          		// 0x011C (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10724,7 +10724,7 @@ public:
 	int                                                CaptureBindNumber;                                		// 0x0198 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10768,7 +10768,7 @@ public:
 	FString                                            m_ActiveCharId;                                   		// 0x009C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10788,7 +10788,7 @@ public:
 	unsigned long                                      bPressedStart : 1;                                		// 0x00B0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10813,7 +10813,7 @@ class UBioSFHandler_PCSplash : public UBioSFHandler_Splash
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10834,7 +10834,7 @@ public:
 	unsigned long                                      m_bInputModeCached : 1;                           		// 0x00AC (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10852,7 +10852,7 @@ public:
 	unsigned long                                      bMessageBoxVisible : 1;                           		// 0x00A0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10881,7 +10881,7 @@ public:
 	unsigned long                                      m_bCanceled : 1;                                  		// 0x0104 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10911,7 +10911,7 @@ public:
 	int                                                m_nConsoleBurnDown;                               		// 0x0128 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10931,7 +10931,7 @@ public:
 	float                                              m_fSpeed;                                         		// 0x0110 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10980,7 +10980,7 @@ public:
 	unsigned char                                      m_eLastBrowserWheelSubPage;                       		// 0x01D4 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11099,7 +11099,7 @@ public:
 	unsigned char                                      m_eOptionalPaneResourceType;                      		// 0x008C (0x0001) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11120,7 +11120,7 @@ public:
 	TArray<struct FSFXChoiceEntryNoStrRef>             lstChoicesNoStrRef;                               		// 0x0090 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11139,7 +11139,7 @@ public:
 	unsigned long                                      m_bShowMessage : 1;                               		// 0x006C (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11169,7 +11169,7 @@ public:
 	unsigned long                                      m_bInTransitionOut : 1;                           		// 0x009C (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11188,7 +11188,7 @@ class USFXSF_ReticleCombatObject : public USFXSF_ReticleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11211,7 +11211,7 @@ public:
 	unsigned long                                      m_bDoingActionFlourish : 1;                       		// 0x00C4 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11228,7 +11228,7 @@ public:
 	unsigned long                                      m_bFromBrowserWheel : 1;                          		// 0x00A4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11272,7 +11272,7 @@ public:
 	int                                                m_nMaxCerberusCodeLength;                         		// 0x0188 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11420,7 +11420,7 @@ public:
 	unsigned long                                      m_bNotificationVisible : 1;                       		// 0x057C (0x0004) [0x0000000000000000] [0x00000080] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11492,7 +11492,7 @@ public:
 	unsigned long                                      m_bStopScroll : 1;                                		// 0x0128 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11533,7 +11533,7 @@ public:
 	unsigned long                                      bInitialized : 1;                                 		// 0x00E4 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11661,7 +11661,7 @@ public:
 	unsigned char                                      m_ePowerWheelMode;                                		// 0x051C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11753,7 +11753,7 @@ public:
 	unsigned long                                      m_bEvalQuickSlotPowers : 1;                       		// 0x0C58 (0x0004) [0x0000000000000000] [0x00000040] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11831,7 +11831,7 @@ public:
 	unsigned char                                      m_eCurrentCrosshair;                              		// 0x0178 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11895,7 +11895,7 @@ public:
 	unsigned char                                      GuiMode;                                          		// 0x015C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11944,7 +11944,7 @@ public:
 	unsigned char                                      LoadMode;                                         		// 0x01B0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11994,7 +11994,7 @@ public:
 	unsigned long                                      m_bCanExit : 1;                                   		// 0x0108 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12023,7 +12023,7 @@ public:
 	int                                                m_anFlag[ 0x3 ];                                  		// 0x0060 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12051,7 +12051,7 @@ public:
 	float                                              m_fFocusDistanceTarget;                           		// 0x00C0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12092,7 +12092,7 @@ public:
 	unsigned long                                      m_bUseCollisionSource : 1;                        		// 0x0214 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12130,7 +12130,7 @@ public:
 	unsigned long                                      m_bUseExplorationSensitivity : 1;                 		// 0x0074 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12145,7 +12145,7 @@ public:
 	float                                              m_fCameraCollisionTestPointRange;                 		// 0x0218 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12159,7 +12159,7 @@ class UBioCameraBehavior : public UBioCameraUtility
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12198,7 +12198,7 @@ public:
 	unsigned long                                      m_bIdleCamEnabled : 1;                            		// 0x02CC (0x0004) [0x0000000000004000] [0x00000004] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12328,7 +12328,7 @@ public:
 	unsigned long                                      m_bSystemSunVisible : 1;                          		// 0x0590 (0x0004) [0x0000000000002000] [0x00000400] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12366,7 +12366,7 @@ public:
 	unsigned long                                      m_bSuppliedLocalizedParams : 1;                   		// 0x0250 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12388,7 +12388,7 @@ public:
 	struct FScreenShakeStruct                          TestShake;                                        		// 0x0090 (0x0070) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12426,7 +12426,7 @@ public:
 	unsigned long                                      m_bCameraSwitchEnabled : 1;                       		// 0x05A4 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12465,7 +12465,7 @@ public:
 	unsigned char                                      Variant;                                          		// 0x00F9 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12479,7 +12479,7 @@ class UBioCameraShakeInterface : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12496,7 +12496,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x48 ];                            		// 0x0070 (0x0048) UNKNOWN PROPERTY: MapProperty SFXGame.BioPawnCameraShakeInterface.m_NodeToEffectMap
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12522,7 +12522,7 @@ public:
 	unsigned char                                      m_nCapMode;                                       		// 0x008D (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12601,7 +12601,7 @@ public:
 	unsigned char                                      PendingCoverAction;                               		// 0x0610 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12756,7 +12756,7 @@ public:
 	unsigned char                                      CurrentCustomAction;                              		// 0x0650 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12810,7 +12810,7 @@ public:
 	unsigned char                                      CurrentProfile;                                   		// 0x00FC (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13198,7 +13198,7 @@ public:
 	unsigned char                                      bWantsToZoom;                                     		// 0x0364 (0x0001) [0x0000000000000004]              ( CPF_Input )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13246,7 +13246,7 @@ public:
 	unsigned char                                      m_ePreviousSelectionMode;                         		// 0x00A9 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13265,7 +13265,7 @@ public:
 	int                                                ConstraintEvaluationPriority;                     		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13282,7 +13282,7 @@ public:
 	TArray<struct FEnemyData>                          Enemies;                                          		// 0x0064 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13298,7 +13298,7 @@ public:
 	TArray<struct FValidEnemyCacheDatum>               ValidEnemyCache;                                  		// 0x0064 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13317,7 +13317,7 @@ public:
 	unsigned long                                      bHardLimits : 1;                                  		// 0x0070 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13338,7 +13338,7 @@ public:
 	unsigned long                                      bIgnoreCoverOutOfRange : 1;                       		// 0x0074 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13358,7 +13358,7 @@ public:
 	unsigned long                                      bRestrictMaxDistance : 1;                         		// 0x0078 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13378,7 +13378,7 @@ public:
 	unsigned long                                      bHardConstraint : 1;                              		// 0x0078 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13401,7 +13401,7 @@ public:
 	unsigned long                                      MoveTowardsGoalActor : 1;                         		// 0x00B0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13420,7 +13420,7 @@ class UGoal_AtGoHereCover : public UGoal_AtCover
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13439,7 +13439,7 @@ public:
 	int                                                BestRating;                                       		// 0x00A0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13455,7 +13455,7 @@ class USFXPath_AvoidClaimedCover : public UPathConstraint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13472,7 +13472,7 @@ public:
 	class ASFXAI_Core*                                 AI;                                               		// 0x007C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13488,7 +13488,7 @@ class USFXPath_AvoidPlayer : public UPathConstraint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13504,7 +13504,7 @@ public:
 	unsigned long                                      m_bOnlyAvoidSubtractive : 1;                      		// 0x006C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13611,7 +13611,7 @@ public:
 	unsigned long                                      m_bAutoAdvanceSkippableLinesWithNoVO : 1;         		// 0x038C (0x0004) [0x0000000000006000] [0x10000000] ( CPF_Transient | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13683,7 +13683,7 @@ public:
 	unsigned long                                      m_bPositionLocked : 1;                            		// 0x0344 (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13723,7 +13723,7 @@ public:
 	unsigned char                                      VocalizationEvent;                                		// 0x0090 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13765,7 +13765,7 @@ public:
 	unsigned char                                      m_NextAction;                                     		// 0x00D5 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13784,7 +13784,7 @@ class UBioDefine : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13799,7 +13799,7 @@ public:
 	TArray<class UBioState*>                           PlaceableStates;                                  		// 0x0060 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13823,7 +13823,7 @@ public:
 	unsigned char                                      PendingStateChange;                               		// 0x00A0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13849,7 +13849,7 @@ public:
 	unsigned long                                      bFinishAnimationBeforeTransition : 1;             		// 0x0080 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13868,7 +13868,7 @@ public:
 	struct SFXName                                     AnimationName;                                    		// 0x0070 (0x0008) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13910,7 +13910,7 @@ public:
 	unsigned long                                      bDissableTallentNotifications : 1;                		// 0x00F4 (0x0004) [0x0000000000004000] [0x00000010] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13937,7 +13937,7 @@ public:
 	int                                                PS3_Body;                                         		// 0x0068 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13978,7 +13978,7 @@ public:
 	unsigned char                                      CurrentState;                                     		// 0x00F8 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13994,7 +13994,7 @@ class ASFXProjectile_Trajectory : public AProjectile
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14021,7 +14021,7 @@ public:
 	unsigned char                                      VocalizationType;                                 		// 0x03D4 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14041,7 +14041,7 @@ public:
 	int                                                m_nIndex;                                         		// 0x0068 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14056,7 +14056,7 @@ public:
 	TArray<class UBioGestChainNode*>                   m_aChildren;                                      		// 0x006C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14074,7 +14074,7 @@ public:
 	int                                                m_nGestureState;                                  		// 0x00BC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14101,7 +14101,7 @@ public:
 	struct SFXName                                     m_nmDefaultPoseGroup;                             		// 0x01E8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14119,7 +14119,7 @@ public:
 	FString                                            m_sGlobalDefaultPose;                             		// 0x0118 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14135,7 +14135,7 @@ public:
 	class UBioGestureRuntimeData*                      m_pRuntimeData;                                   		// 0x0070 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14153,7 +14153,7 @@ public:
 	int                                                FilterFactor;                                     		// 0x0104 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14178,7 +14178,7 @@ public:
 	unsigned long                                      m_bComputeDrawParameters : 1;                     		// 0x00AC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14205,7 +14205,7 @@ public:
 	int                                                m_nLineCount;                                     		// 0x00D0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14232,7 +14232,7 @@ public:
 	float                                              StartDrawTime;                                    		// 0x00DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14294,7 +14294,7 @@ public:
 	unsigned long                                      m_bUseGeneratedItemNames : 1;                     		// 0x0660 (0x0004) [0x0000000000006000] [0x00000200] ( CPF_Transient | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14377,7 +14377,7 @@ public:
 	unsigned char                                      m_CurrentRenderMode;                              		// 0x0081 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14428,7 +14428,7 @@ public:
 	unsigned long                                      m_bLoaded : 1;                                    		// 0x0274 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14465,7 +14465,7 @@ public:
 	unsigned long                                      bShift : 1;                                       		// 0x0260 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14520,7 +14520,7 @@ public:
 	unsigned long                                      m_bSortByName : 1;                                		// 0x010C (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14568,7 +14568,7 @@ public:
 	int                                                m_nGeneration;                                    		// 0x00C0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14599,7 +14599,7 @@ public:
 	int                                                m_iBoneIndex;                                     		// 0x00D0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14615,7 +14615,7 @@ public:
 	FString                                            m_sCommand;                                       		// 0x00C4 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14631,7 +14631,7 @@ public:
 	FString                                            Filename;                                         		// 0x00C4 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14651,7 +14651,7 @@ public:
 	FPointer                                           Base;                                             		// 0x00E4 (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14674,7 +14674,7 @@ public:
 	class UProperty*                                   m_Property;                                       		// 0x00EC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14697,7 +14697,7 @@ public:
 	unsigned char                                      byteVal;                                          		// 0x010C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14722,7 +14722,7 @@ public:
 	int                                                otherVal;                                         		// 0x00FC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14739,7 +14739,7 @@ public:
 	FString                                            sDisplay;                                         		// 0x00EC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14755,7 +14755,7 @@ public:
 	FString                                            Filename;                                         		// 0x00C4 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14772,7 +14772,7 @@ class UBioPropertyEditorVolatileNode : public UBioPropertyEditorBaseNode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14800,7 +14800,7 @@ public:
 	unsigned long                                      m_bAllPoseGroupsLoaded : 1;                       		// 0x00A8 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14814,7 +14814,7 @@ class UBioInterpTrackInstMove : public UInterpTrackInstMove
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14829,7 +14829,7 @@ public:
 	struct SFXName                                     FacingController;                                 		// 0x00E0 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14844,7 +14844,7 @@ public:
 	float                                              ResetFloat;                                       		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14861,7 +14861,7 @@ public:
 	float                                              InterpValue;                                      		// 0x00B8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14876,7 +14876,7 @@ public:
 	struct FVector                                     ResetVector;                                      		// 0x0060 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14893,7 +14893,7 @@ public:
 	class ABioVisualEffect*                            m_pParentEffect;                                  		// 0x00BC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14909,7 +14909,7 @@ public:
 	class ABioVisualEffect*                            Properties;                                       		// 0x00A0 (0x0008) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14925,7 +14925,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0068 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14940,7 +14940,7 @@ class USFXConvAuditionHelperInterface : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14954,7 +14954,7 @@ class USFXGameInterpTrack : public UBioInterpTrack
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14974,7 +14974,7 @@ public:
 	TArray<FString>                                    m_aDbgStrings;                                    		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14999,7 +14999,7 @@ public:
 	float                                              m_fDOFDefaultMaxFarBlur;                          		// 0x00C8 (0x0004) [0x0000000000006000]              ( CPF_Transient | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15020,7 +15020,7 @@ public:
 	struct SFXName                                     m_nmOldShotType;                                  		// 0x00B8 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15040,7 +15040,7 @@ public:
 	TArray<struct FBioInterruptTrackData>              m_aInterruptData;                                 		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15060,7 +15060,7 @@ public:
 	TArray<struct FBioSubtitleTrackData>               m_aSubtitleData;                                  		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15080,7 +15080,7 @@ public:
 	TArray<struct FBioCameraSwitchData>                m_aCameras;                                       		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15103,7 +15103,7 @@ public:
 	unsigned long                                      m_bIgnoreExportGrowing : 1;                       		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15123,7 +15123,7 @@ public:
 	TArray<struct FRotationModeTrackKey>               EventTrack;                                       		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15144,7 +15144,7 @@ public:
 	unsigned char                                      m_eFindActorMode;                                 		// 0x00B4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15168,7 +15168,7 @@ public:
 	unsigned char                                      eOverrideType;                                    		// 0x00E2 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15188,7 +15188,7 @@ public:
 	TArray<struct FBioConvLightingData>                m_aLightingKeys;                                  		// 0x00B8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15208,7 +15208,7 @@ public:
 	TArray<struct FBioLookAtTrackData>                 m_aLookAtKeys;                                    		// 0x00B8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15228,7 +15228,7 @@ public:
 	TArray<struct FBioPropTrackData>                   m_aPropKeys;                                      		// 0x00B8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15268,7 +15268,7 @@ public:
 	TArray<struct FBioSetFacingData>                   m_aFacingKeys;                                    		// 0x00B8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15288,7 +15288,7 @@ public:
 	TArray<struct FBioFOVOTrackData>                   m_aFOVOKeys;                                      		// 0x00B8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15307,7 +15307,7 @@ class USFXGameInterpTrackCustom : public USFXGameInterpTrack
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15327,7 +15327,7 @@ public:
 	class UBioVFXTemplate*                             oEffect;                                          		// 0x00C8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15354,7 +15354,7 @@ public:
 	unsigned long                                      bUseRelativeRotation : 1;                         		// 0x00D8 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15377,7 +15377,7 @@ public:
 	class UBioVFXTemplate*                             m_oEffect;                                        		// 0x00CC (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15398,7 +15398,7 @@ public:
 	class UBioSeqAct_BlackScreen*                      m_BlackScreenSeq;                                 		// 0x00B8 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15417,7 +15417,7 @@ public:
 	TArray<class UBioSeqVar_ObjectFindByTag*>          m_aTarget;                                        		// 0x00A8 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15437,7 +15437,7 @@ public:
 	class UBioSeqAct_ForceLightEnvUpdate*              m_SeqForceUpdateLight;                            		// 0x00A8 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15457,7 +15457,7 @@ public:
 	class UBioSeqAct_SetLightEnvQuality*               m_LightEnvSeq;                                    		// 0x00B8 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15476,7 +15476,7 @@ public:
 	TArray<struct FSFXMoviePlayStateData>              m_aMovieKeyData;                                  		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15492,7 +15492,7 @@ public:
 	FString                                            m_sMovieName;                                     		// 0x00B8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15510,7 +15510,7 @@ public:
 	class UTextureMovie*                               m_oTextureMovie;                                  		// 0x00B8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15530,7 +15530,7 @@ public:
 	class UBioSeqAct_SetEnvironmentEffectIntensity*    m_EnvEffIntensitySeq;                             		// 0x00B8 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15549,7 +15549,7 @@ public:
 	TArray<struct FSFXNearClipTrackData>               m_aNearClipKeyData;                               		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15570,7 +15570,7 @@ public:
 	class ABioPawn*                                    m_Pawn;                                           		// 0x00C0 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15591,7 +15591,7 @@ public:
 	class AActor*                                      m_TargetActor;                                    		// 0x00C8 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15610,7 +15610,7 @@ class USFXInterpTrackToggleAffectedByHitEffects : public USFXInterpTrackToggleBa
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15628,7 +15628,7 @@ class USFXInterpTrackToggleHidden : public USFXInterpTrackToggleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15647,7 +15647,7 @@ public:
 	class UBioSeqAct_ToggleLightEnv*                   m_LightEnvSeq;                                    		// 0x00D0 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15666,7 +15666,7 @@ public:
 	unsigned long                                      m_bUnlockAtEnd : 1;                               		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15684,7 +15684,7 @@ class USFXGameInterpTrackInst : public UBioInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15700,7 +15700,7 @@ public:
 	int                                                m_nCurEffect;                                     		// 0x0068 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15714,7 +15714,7 @@ class UBioEvtSysTrackFuncShotInst : public USFXGameInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15729,7 +15729,7 @@ public:
 	class UBioConversation*                            m_pConv;                                          		// 0x0064 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15743,7 +15743,7 @@ class UBioEvtSysTrackSubtitlesInst : public USFXGameInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15758,7 +15758,7 @@ public:
 	class UBioEvtSysTrackDOF*                          m_pDOFTrack;                                      		// 0x0064 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15772,7 +15772,7 @@ class UBioEvtSysTrackVOElementsInst : public USFXGameInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15787,7 +15787,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0064 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15802,7 +15802,7 @@ public:
 	class AActor*                                      m_pActor;                                         		// 0x0064 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15819,7 +15819,7 @@ public:
 	unsigned long                                      m_bBelongsToConversation : 1;                     		// 0x00B4 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15835,7 +15835,7 @@ public:
 	unsigned long                                      ResetLightingData : 1;                            		// 0x00B8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15849,7 +15849,7 @@ class UBioEvtSysTrackLookAtInst : public USFXGameActorInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15866,7 +15866,7 @@ public:
 	unsigned long                                      m_bBelongsToConversation : 1;                     		// 0x00FC (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15884,7 +15884,7 @@ class UBioEvtSysTrackSetFacingInst : public USFXGameActorInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15899,7 +15899,7 @@ public:
 	TArray<class UBioSeqAct_FaceOnlyVO*>               m_aFOVOObjects;                                   		// 0x006C (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15913,7 +15913,7 @@ class USFXGameInterpTrackInstCustom : public USFXGameInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15928,7 +15928,7 @@ public:
 	struct FMap_Mirror                                 m_mapCachedActors;                                		// 0x0064 (0x0048) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15942,7 +15942,7 @@ class USFXInterpTrack_MoveTo : public UInterpTrackMove
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15958,7 +15958,7 @@ public:
 	struct FRotator                                    StartRotation;                                    		// 0x00D8 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15972,7 +15972,7 @@ class UBioInterpolator : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15997,7 +15997,7 @@ public:
 	unsigned long                                      m_bDisabling : 1;                                 		// 0x0090 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16019,7 +16019,7 @@ public:
 	unsigned char                                      RootAnimBoneUpAxis;                               		// 0x0081 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16036,7 +16036,7 @@ public:
 	unsigned long                                      Instant : 1;                                      		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16053,7 +16053,7 @@ public:
 	struct FExpressionInput                            SpecPower;                                        		// 0x00AC (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16070,7 +16070,7 @@ public:
 	struct FExpressionInput                            SpecPower;                                        		// 0x00AC (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16088,7 +16088,7 @@ public:
 	class UTexture2D*                                  GrimeTex;                                         		// 0x009C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16105,7 +16105,7 @@ public:
 	unsigned long                                      Inverted : 1;                                     		// 0x0090 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16119,7 +16119,7 @@ class UBioMaterialExpressionHalfAngle : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16138,7 +16138,7 @@ public:
 	int                                                FlipTexCols;                                      		// 0x00B8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16155,7 +16155,7 @@ public:
 	struct FExpressionInput                            SpecPower;                                        		// 0x00AC (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16171,7 +16171,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x008C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16186,7 +16186,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x006C (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16203,7 +16203,7 @@ public:
 	TArray<struct FScalarParameter>                    m_aScalarOverrides;                               		// 0x0080 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16227,7 +16227,7 @@ public:
 	class UBioMaterialOverride*                        m_oMaterialOverrides;                             		// 0x00C8 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16251,7 +16251,7 @@ public:
 	unsigned long                                      m_bStepped : 1;                                   		// 0x0078 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16267,7 +16267,7 @@ public:
 	TArray<struct FColor>                              m_acColours;                                      		// 0x008C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16281,7 +16281,7 @@ class UBioMorphFaceFESliderHair : public UBioMorphFaceFESliderBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16300,7 +16300,7 @@ public:
 	unsigned long                                      m_bSingle : 1;                                    		// 0x00A4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16316,7 +16316,7 @@ public:
 	TArray<float>                                      m_afValues;                                       		// 0x008C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16332,7 +16332,7 @@ public:
 	TArray<float>                                      m_afValues;                                       		// 0x008C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16348,7 +16348,7 @@ public:
 	TArray<class UTexture*>                            m_atTexture;                                      		// 0x008C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16362,7 +16362,7 @@ class UBioMorphUtility : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16391,7 +16391,7 @@ public:
 	unsigned long                                      m_bDebugStrings : 1;                              		// 0x0178 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16447,7 +16447,7 @@ public:
 	unsigned long                                      PlayerIsMale : 1;                                 		// 0x0204 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16461,7 +16461,7 @@ class UBioEmissionAreaList : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16476,7 +16476,7 @@ public:
 	TArray<struct FBoneListEmissionArea>               m_EmissionAreas;                                  		// 0x0060 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16495,7 +16495,7 @@ public:
 	unsigned long                                      bEnableMultiHitDecal : 1;                         		// 0x016C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16516,7 +16516,7 @@ public:
 	unsigned char                                      m_SpecificationType;                              		// 0x00A0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16538,7 +16538,7 @@ public:
 	unsigned char                                      eOnCollision;                                     		// 0x00E1 (0x0001) [0x0000000002000009]              ( CPF_Edit | CPF_ExportObject | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16557,7 +16557,7 @@ public:
 	unsigned char                                      MultipliedProperty;                               		// 0x0078 (0x0001) [0x000000000200000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16577,7 +16577,7 @@ public:
 	unsigned long                                      m_bDuck : 1;                                      		// 0x0080 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16591,7 +16591,7 @@ class UBioParticleModuleVelocityWorldSpace : public UParticleModuleVelocity
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16614,7 +16614,7 @@ public:
 	unsigned long                                      bPlayProgrammaticShake : 1;                       		// 0x0114 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16873,7 +16873,7 @@ public:
 	unsigned char                                      LastCoverType;                                    		// 0x0AA7 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17213,7 +17213,7 @@ public:
 	unsigned long                                      m_bAggressivePathPruning : 1;                     		// 0x0664 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17229,7 +17229,7 @@ public:
 	TArray<struct FBoneOverrideInfo>                   OverrideInfo;                                     		// 0x0434 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17248,7 +17248,7 @@ public:
 	unsigned long                                      bKinematicUntilMoved : 1;                         		// 0x03C4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17269,7 +17269,7 @@ public:
 	unsigned long                                      m_bToughPlaceable : 1;                            		// 0x03D0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17288,7 +17288,7 @@ public:
 	float                                              m_fPhysicsSoundLastTimePlayed;                    		// 0x03C4 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17304,7 +17304,7 @@ public:
 	float                                              m_fPhysicsSoundLastTimePlayed;                    		// 0x02B0 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17320,7 +17320,7 @@ public:
 	struct FMap_Mirror                                 PageMap;                                          		// 0x00A8 (0x0048) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17335,7 +17335,7 @@ public:
 	struct FMap_Mirror                                 DiscoveredCodex;                                  		// 0x0060 (0x0048) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17355,7 +17355,7 @@ public:
 	class UBio2DA*                                     oNameLookupTable;                                 		// 0x00A0 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17384,7 +17384,7 @@ public:
 	struct FMap_Mirror                                 OutcomeMapping;                                   		// 0x0060 (0x0048) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17402,7 +17402,7 @@ public:
 	struct FMap_Mirror                                 FloatTaskEvalMap;                                 		// 0x0138 (0x0048) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17418,7 +17418,7 @@ public:
 	int                                                nQuestProgressCounter;                            		// 0x00A8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17434,7 +17434,7 @@ public:
 	struct FMap_Mirror                                 StateEventMap;                                    		// 0x0060 (0x0048) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17448,7 +17448,7 @@ class UBioConsequenceMap : public UBioStateEventMap
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17516,7 +17516,7 @@ public:
 	unsigned char                                      VocalizationEvent;                                		// 0x01AB (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17565,7 +17565,7 @@ public:
 	float                                              m_fSharedCooldownTotal;                           		// 0x0094 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17606,7 +17606,7 @@ public:
 	unsigned long                                      bLoop : 1;                                        		// 0x009C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17635,7 +17635,7 @@ public:
 	unsigned long                                      bProjectOnShields : 1;                            		// 0x04BC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17651,7 +17651,7 @@ public:
 	TArray<class UBioVFXTemplate*>                     m_aPlaceableVFXs;                                 		// 0x0070 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17679,7 +17679,7 @@ public:
 	class UBioVFXTemplate*                             vfxReleaseEffect;                                 		// 0x00DC (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17736,7 +17736,7 @@ public:
 	unsigned char                                      eCost;                                            		// 0x014D (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17787,7 +17787,7 @@ public:
 	struct FMultiMap_Mirror                            m_mTrackMaterialVectorMap;                        		// 0x0560 (0x0048) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17829,7 +17829,7 @@ public:
 	unsigned long                                      m_bInstancePoolEnabled : 1;                       		// 0x0098 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17850,7 +17850,7 @@ public:
 	unsigned long                                      m_bEnable : 1;                                    		// 0x0110 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17886,7 +17886,7 @@ public:
 	class UWwiseBaseSoundObject*                       ShipOutOfFuel_Stop;                               		// 0x01E8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17915,7 +17915,7 @@ public:
 	unsigned char                                      m_eResource;                                      		// 0x012C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17937,7 +17937,7 @@ public:
 	unsigned long                                      m_bAttachToCamera : 1;                            		// 0x0124 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17953,7 +17953,7 @@ public:
 	float                                              Radius;                                           		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17971,7 +17971,7 @@ public:
 	unsigned long                                      bDiscount : 1;                                    		// 0x0104 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17989,7 +17989,7 @@ public:
 	class UBioActorType*                               m_oActorType;                                     		// 0x0174 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18009,7 +18009,7 @@ public:
 	unsigned long                                      bPlayerOnly : 1;                                  		// 0x0118 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18024,7 +18024,7 @@ class UBioSeqAct_CopyPlayerHeadToTarget : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18040,7 +18040,7 @@ class UBioSeqAct_Delay : public USeqAct_Delay
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18057,7 +18057,7 @@ public:
 	unsigned char                                      Element;                                          		// 0x0108 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18076,7 +18076,7 @@ public:
 	unsigned long                                      bVisible : 1;                                     		// 0x0118 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18091,7 +18091,7 @@ public:
 	unsigned long                                      m_bEnable : 1;                                    		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18107,7 +18107,7 @@ class UBioSeqAct_EndCurrentConvNode : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18128,7 +18128,7 @@ public:
 	unsigned long                                      bDelayedLoad : 1;                                 		// 0x0110 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18148,7 +18148,7 @@ public:
 	unsigned long                                      bDisableDamageAndEffects : 1;                     		// 0x0110 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18162,7 +18162,7 @@ class UBioSeqAct_ForceLightEnvUpdate : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18177,7 +18177,7 @@ public:
 	unsigned long                                      bBlockOnWait : 1;                                 		// 0x0140 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18192,7 +18192,7 @@ public:
 	int                                                nListIndex;                                       		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18207,7 +18207,7 @@ public:
 	unsigned long                                      bGetFurthest : 1;                                 		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18228,7 +18228,7 @@ public:
 	unsigned long                                      bPlayerOnly : 1;                                  		// 0x0120 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18243,7 +18243,7 @@ class UBioSeqAct_InitFSMode : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18258,7 +18258,7 @@ public:
 	FString                                            sMovieName;                                       		// 0x00F8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18277,7 +18277,7 @@ public:
 	unsigned long                                      OverrideScreenTip : 1;                            		// 0x0118 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18292,7 +18292,7 @@ public:
 	class UPostProcessChain*                           PostProcess;                                      		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18317,7 +18317,7 @@ public:
 	class UClass*                                      cSelectionType;                                   		// 0x0168 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18332,7 +18332,7 @@ class UBioSeqAct_GetProperty : public UBioSeqAct_InteractProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18346,7 +18346,7 @@ class UBioSeqAct_GetPropertyArtPlaceable : public UBioSeqAct_GetProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18361,7 +18361,7 @@ class UBioSeqAct_GetPropertyPawn : public UBioSeqAct_GetProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18376,7 +18376,7 @@ class UBioSeqAct_ModifyProperty : public UBioSeqAct_InteractProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18390,7 +18390,7 @@ class UBioSeqAct_ModifyPropertyArtPlaceable : public UBioSeqAct_ModifyProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18405,7 +18405,7 @@ class UBioSeqAct_ModifyPropertyNavigation : public UBioSeqAct_ModifyProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18419,7 +18419,7 @@ class UBioSeqAct_ModifyPropertyPawn : public UBioSeqAct_ModifyProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18436,7 +18436,7 @@ public:
 	unsigned long                                      m_bIsFinished : 1;                                		// 0x0100 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18452,7 +18452,7 @@ public:
 	unsigned long                                      m_bEnable : 1;                                    		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18477,7 +18477,7 @@ public:
 	class AActor*                                      m_aStage;                                         		// 0x0138 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18493,7 +18493,7 @@ class UBioSeqAct_PauseGalaxyMap : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18507,7 +18507,7 @@ class UBioSeqAct_PlayLoadingMovie : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18528,7 +18528,7 @@ public:
 	unsigned char                                      Plot;                                             		// 0x0125 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18545,7 +18545,7 @@ public:
 	unsigned char                                      Conditional;                                      		// 0x0130 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18561,7 +18561,7 @@ public:
 	unsigned char                                      State;                                            		// 0x012C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18577,7 +18577,7 @@ public:
 	unsigned char                                      Consequence;                                      		// 0x012C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18593,7 +18593,7 @@ public:
 	unsigned char                                      Transition;                                       		// 0x012C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18608,7 +18608,7 @@ public:
 	unsigned long                                      m_bRestoreActors : 1;                             		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18625,7 +18625,7 @@ public:
 	unsigned long                                      bIncludeObjComment : 1;                           		// 0x0108 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18649,7 +18649,7 @@ public:
 	unsigned char                                      Operation;                                        		// 0x0114 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18669,7 +18669,7 @@ public:
 	int                                                nTargetChild;                                     		// 0x0110 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18685,7 +18685,7 @@ public:
 	unsigned long                                      m_bRestoreCamera : 1;                             		// 0x00FC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18701,7 +18701,7 @@ public:
 	float                                              m_fBlendTime;                                     		// 0x00FC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18720,7 +18720,7 @@ public:
 	unsigned char                                      GestureMode;                                      		// 0x011C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18735,7 +18735,7 @@ public:
 	unsigned char                                      Quality;                                          		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18756,7 +18756,7 @@ public:
 	unsigned long                                      bSetStrengthFromAnimNode : 1;                     		// 0x0114 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18772,7 +18772,7 @@ public:
 	unsigned long                                      NewValue : 1;                                     		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18790,7 +18790,7 @@ public:
 	unsigned char                                      m_eMode;                                          		// 0x0108 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18808,7 +18808,7 @@ public:
 	unsigned char                                      eWeapon;                                          		// 0x0114 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18825,7 +18825,7 @@ public:
 	int                                                nWeapon;                                          		// 0x0108 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18841,7 +18841,7 @@ class UBioSeqAct_ShouldShowSplashSequence : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18861,7 +18861,7 @@ public:
 	unsigned long                                      m_isActivated : 1;                                		// 0x0128 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18882,7 +18882,7 @@ public:
 	unsigned char                                      m_CompletionState;                                		// 0x011C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18902,7 +18902,7 @@ public:
 	int                                                m_nConsoleBurnDown;                               		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18922,7 +18922,7 @@ public:
 	float                                              m_fSpeed;                                         		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18939,7 +18939,7 @@ class UBioSeqAct_StopLoadingMovie : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18959,7 +18959,7 @@ public:
 	unsigned long                                      m_bSnapToFloor : 1;                               		// 0x0108 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18974,7 +18974,7 @@ class UBioSeqAct_ToggleLightEnv : public USeqAct_Toggle
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18988,7 +18988,7 @@ class UBioSeqCond_CheckActorLOS : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19003,7 +19003,7 @@ class UBioSeqEvt_AbilityDisabled : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19017,7 +19017,7 @@ class UBioSeqEvt_AbilityEnabled : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19032,7 +19032,7 @@ public:
 	FString                                            sEvent;                                           		// 0x0128 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19046,7 +19046,7 @@ class UBioSeqEvt_BackgroundStreamingDone : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19062,7 +19062,7 @@ public:
 	FString                                            sEvent;                                           		// 0x0128 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19079,7 +19079,7 @@ public:
 	unsigned char                                      eScriptType;                                      		// 0x0138 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19096,7 +19096,7 @@ public:
 	unsigned long                                      m_bSetWaitFlags : 1;                              		// 0x0130 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19110,7 +19110,7 @@ class UBioSeqEvt_ForegroundStreamingDone : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19127,7 +19127,7 @@ public:
 	struct SFXName                                     EventParameter;                                   		// 0x0138 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19141,7 +19141,7 @@ class UBioSeqEvt_MemberRemoved : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19156,7 +19156,7 @@ class UBioSeqEvt_OnPlayerActivate : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19172,7 +19172,7 @@ public:
 	unsigned long                                      bHasTargets : 1;                                  		// 0x010C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19190,7 +19190,7 @@ public:
 	unsigned char                                      m_eBlackScreenAction;                             		// 0x0118 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19211,7 +19211,7 @@ public:
 	unsigned long                                      bFail : 1;                                        		// 0x0128 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19251,7 +19251,7 @@ public:
 	unsigned char                                      m_eConvLine;                                      		// 0x01CD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19277,7 +19277,7 @@ public:
 	unsigned char                                      m_eFireMode;                                      		// 0x013C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19302,7 +19302,7 @@ public:
 	unsigned long                                      m_bDone : 1;                                      		// 0x012C (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19321,7 +19321,7 @@ public:
 	unsigned long                                      m_bKeepTryingToPlay : 1;                          		// 0x0128 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19357,7 +19357,7 @@ public:
 	unsigned char                                      m_eResource;                                      		// 0x0150 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19382,7 +19382,7 @@ public:
 	unsigned char                                      Camera;                                           		// 0x0129 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19409,7 +19409,7 @@ public:
 	unsigned long                                      m_bEnterCombatModeOnEnd : 1;                      		// 0x0124 (0x0004) [0x0000000000000001] [0x00000100] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19427,7 +19427,7 @@ public:
 	int                                                m_nbNodes;                                        		// 0x0130 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19449,7 +19449,7 @@ public:
 	unsigned long                                      bFailedToStart : 1;                               		// 0x0138 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19472,7 +19472,7 @@ public:
 	unsigned char                                      m_eWalkType;                                      		// 0x0124 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19499,7 +19499,7 @@ public:
 	unsigned long                                      m_bTargetInvalidated : 1;                         		// 0x0138 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19523,7 +19523,7 @@ public:
 	class USFXGameChoiceGUIData*                       m_ChoiceData;                                     		// 0x00B4 (0x0008) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19539,7 +19539,7 @@ public:
 	unsigned long                                      m_bSearchUniqueTag : 1;                           		// 0x00C4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19554,7 +19554,7 @@ public:
 	FString                                            m_sObjectTagToFind;                               		// 0x00C4 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19576,7 +19576,7 @@ public:
 	unsigned char                                      State;                                            		// 0x00C2 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19598,7 +19598,7 @@ public:
 	unsigned char                                      Float;                                            		// 0x00C2 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19620,7 +19620,7 @@ public:
 	unsigned char                                      Int;                                              		// 0x00C2 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19642,7 +19642,7 @@ public:
 	unsigned char                                      State;                                            		// 0x00C2 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19665,7 +19665,7 @@ public:
 	unsigned long                                      bAbortSpawns : 1;                                 		// 0x018C (0x0004) [0x0000000000000000] [0x00000020] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19686,7 +19686,7 @@ public:
 	unsigned char                                      eBehaviour;                                       		// 0x0110 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19701,7 +19701,7 @@ class USFXSeqAct_CharCreateClass : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19719,7 +19719,7 @@ public:
 	class UBioVFXTemplate*                             CrustToApply;                                     		// 0x0124 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19734,7 +19734,7 @@ public:
 	struct SFXName                                     m_nmTag;                                          		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19749,7 +19749,7 @@ public:
 	class ABioPawn*                                    oPossessedPawn;                                   		// 0x010C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19771,7 +19771,7 @@ public:
 	float                                              fDisplayTime;                                     		// 0x0118 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19788,7 +19788,7 @@ public:
 	unsigned long                                      m_bFirstPass : 1;                                 		// 0x010C (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19811,7 +19811,7 @@ public:
 	unsigned long                                      m_bDone : 1;                                      		// 0x012C (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19835,7 +19835,7 @@ public:
 	unsigned long                                      StreamFromDisc : 1;                               		// 0x0108 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19850,7 +19850,7 @@ public:
 	class AActor*                                      oTargetActor;                                     		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19875,7 +19875,7 @@ public:
 	unsigned long                                      m_bWasWalkingBefore : 1;                          		// 0x0130 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19895,7 +19895,7 @@ public:
 	int                                                Value;                                            		// 0x00FC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19919,7 +19919,7 @@ public:
 	unsigned char                                      ePower;                                           		// 0x0138 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19938,7 +19938,7 @@ public:
 	unsigned long                                      bWaitForVisibleOnly : 1;                          		// 0x010C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19952,7 +19952,7 @@ class USFXSeqCond_Platform : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19966,7 +19966,7 @@ class USFXSeqEvt_StorageDeviceReconnected : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19980,7 +19980,7 @@ class USFXSeqEvt_Touch : public USeqEvent_Touch
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19995,7 +19995,7 @@ public:
 	struct FGuid                                       MyGuid;                                           		// 0x0094 (0x0010) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20018,7 +20018,7 @@ public:
 	struct FScriptDelegate                             __ExternalCallback_ShowStore__Delegate;           		// 0x00FC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20096,7 +20096,7 @@ public:
 	unsigned long                                      m_bEngagedHostileAction : 1;                      		// 0x02E0 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20170,7 +20170,7 @@ public:
 	unsigned char                                      m_eGameOverCondition;                             		// 0x03F8 (0x0001) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20206,7 +20206,7 @@ public:
 	unsigned char                                      SquadFaction;                                     		// 0x007C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20222,7 +20222,7 @@ class UBioFaction_Hacked : public UBioFaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20236,7 +20236,7 @@ class UBioFaction_Player : public UBioFaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20253,7 +20253,7 @@ public:
 	class AInterpActor*                                MyLift;                                           		// 0x03A8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20275,7 +20275,7 @@ public:
 	unsigned long                                      bInited : 1;                                      		// 0x023C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20307,7 +20307,7 @@ public:
 	class USFXTelemetryGameSession*                    GameSession;                                      		// 0x013C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20385,7 +20385,7 @@ public:
 	TArray<FString>                                    SessionStartMapExclusion;                         		// 0x00EC (0x0010) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20466,7 +20466,7 @@ public:
 	unsigned long                                      m_bIsPaused : 1;                                  		// 0x093C (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20537,7 +20537,7 @@ public:
 	unsigned long                                      bUnPoweredDriving : 1;                            		// 0x0160 (0x0004) [0x0000000000000000] [0x00000400] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20574,7 +20574,7 @@ public:
 	unsigned char                                      Conditional;                                      		// 0x02E2 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20591,7 +20591,7 @@ public:
 	unsigned long                                      bAlwaysReachable : 1;                             		// 0x038C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20611,7 +20611,7 @@ public:
 	unsigned long                                      m_bPositionLocked : 1;                            		// 0x03AC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20626,7 +20626,7 @@ class ABioWP_AirPoint : public ABioPathPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20647,7 +20647,7 @@ public:
 	unsigned long                                      bTempDisabledCollision : 1;                       		// 0x03C0 (0x0004) [0x0000000000002002] [0x00000004] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20667,7 +20667,7 @@ public:
 	FPointer                                           VfTable_FTickableObject;                          		// 0x0228 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20683,7 +20683,7 @@ public:
 	unsigned long                                      AlwaysShow : 1;                                   		// 0x029C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20700,7 +20700,7 @@ public:
 	FString                                            RaceTypeRTPCName;                                 		// 0x007C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20714,7 +20714,7 @@ class ABioContainer : public ABioArtPlaceable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20728,7 +20728,7 @@ class ABioInert : public ABioArtPlaceable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20742,7 +20742,7 @@ class ABioUseable : public ABioArtPlaceable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20828,7 +20828,7 @@ public:
 	unsigned char                                      m_eBestTargetCoverAction;                         		// 0x078E (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20964,7 +20964,7 @@ public:
 	unsigned long                                      bPooled : 1;                                      		// 0x032C (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21042,7 +21042,7 @@ public:
 	unsigned long                                      bSuppressExplosionFX : 1;                         		// 0x040C (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21090,7 +21090,7 @@ public:
 	unsigned long                                      ShowPowerAiming : 1;                              		// 0x0490 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21118,7 +21118,7 @@ public:
 	TArray<class UClass*>                              Powers;                                           		// 0x0128 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21134,7 +21134,7 @@ class USFXSeqEvt_OnStoppedSleeping : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21345,7 +21345,7 @@ public:
 	unsigned char                                      FireModeToBegin;                                  		// 0x0970 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21484,7 +21484,7 @@ class ASFXHeavyWeapon : public ASFXWeapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21505,7 +21505,7 @@ public:
 	TArray<class USFXGameEffect*>                      GameEffects;                                      		// 0x006C (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21547,7 +21547,7 @@ public:
 	unsigned char                                      DurationType;                                     		// 0x0090 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21570,7 +21570,7 @@ class USFXGameEffect_AIAccuracyPenalty : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21586,7 +21586,7 @@ class USFXSeqEvt_EnteringStasis : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21601,7 +21601,7 @@ class USFXSeqEvt_LeavingStasis : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21616,7 +21616,7 @@ class UBioAnimNodeBlendAdditivePower : public UBioAnimNodeBlendAdditive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21630,7 +21630,7 @@ class UBioAnimNodeBlendWeaponEquip : public UAnimNodeBlendBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21645,7 +21645,7 @@ public:
 	struct SFXName                                     Info;                                             		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21662,7 +21662,7 @@ public:
 	struct SFXName                                     sMoveToStartPoint;                                		// 0x02D4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21689,7 +21689,7 @@ public:
 	unsigned long                                      bSupportsVisibleWeapons : 1;                      		// 0x0B60 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21768,7 +21768,7 @@ public:
 	unsigned char                                      Notoriety;                                        		// 0x0DB6 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21830,7 +21830,7 @@ class UBioSeqEvt_ArtPlaceableUsed : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21844,7 +21844,7 @@ class UBioSeqEvt_ArtPlaceablePlotFail : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21858,7 +21858,7 @@ class UBioSeqEvt_ArtPlaceableTransition : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21872,7 +21872,7 @@ class UBioSeqEvt_OnAttacked : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21886,7 +21886,7 @@ class UBioSeqEvt_OnCastAt : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21901,7 +21901,7 @@ class UBioSeqEvt_ArtPlaceableSkillGameFailed : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21915,7 +21915,7 @@ class UBioSeqEvt_ArtPlaceableSkillGameSuccess : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21929,7 +21929,7 @@ class UBioArtPlaceableContainerType : public UBioArtPlaceableType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21943,7 +21943,7 @@ class UBioArtPlaceableDoorType : public UBioArtPlaceableType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21957,7 +21957,7 @@ class UBioArtPlaceableInertType : public UBioArtPlaceableType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21971,7 +21971,7 @@ class UBioArtPlaceableUseableType : public UBioArtPlaceableType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21989,7 +21989,7 @@ public:
 	unsigned long                                      m_bUseEnterExitAnims : 1;                         		// 0x0088 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22003,7 +22003,7 @@ class UBioSeqEvt_MemberAdded : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22018,7 +22018,7 @@ class UBioFaction_BaseSquad : public UBioFaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22038,7 +22038,7 @@ public:
 	float                                              SpeedDistance;                                    		// 0x0230 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22056,7 +22056,7 @@ public:
 	unsigned long                                      m_bCameraLocked : 1;                              		// 0x0224 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22119,7 +22119,7 @@ public:
 	unsigned long                                      bWeaponFired : 1;                                 		// 0x03A0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22161,7 +22161,7 @@ class UBioCameraBehaviorLocked : public UBioCameraBehavior
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22187,7 +22187,7 @@ public:
 	unsigned char                                      ClassType;                                        		// 0x00A4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22208,7 +22208,7 @@ public:
 	unsigned long                                      bHelmetHidesHead : 1;                             		// 0x0B98 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22247,7 +22247,7 @@ public:
 	int                                                RenegadePoints;                                   		// 0x034C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22272,7 +22272,7 @@ class ASFXPawn_PlayerSoldier : public ASFXPawn_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22287,7 +22287,7 @@ public:
 	TArray<struct FVocEventLog>                        PastEvents;                                       		// 0x02CC (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22307,7 +22307,7 @@ class USFXDamageType_CheatKill : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22321,7 +22321,7 @@ class USFXDamageType_Default : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22347,7 +22347,7 @@ public:
 	unsigned long                                      bIsDead : 1;                                      		// 0x0128 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22378,7 +22378,7 @@ public:
 	unsigned long                                      bHealthRegenerates : 1;                           		// 0x0138 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22421,7 +22421,7 @@ public:
 	unsigned long                                      bDebugHealthBarEnabled : 1;                       		// 0x01D0 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22455,7 +22455,7 @@ public:
 	int                                                srCanAffordResearch;                              		// 0x009C (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22537,7 +22537,7 @@ public:
 	unsigned long                                      bLastDamageUpdate : 1;                            		// 0x00E4 (0x0004) [0x0000000000004000] [0x00000800] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22597,7 +22597,7 @@ public:
 	unsigned long                                      bCalculatedChallenge : 1;                         		// 0x0484 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22650,7 +22650,7 @@ public:
 	float                                              SquadPowerCooldownMultiplier;                     		// 0x00E0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22699,7 +22699,7 @@ public:
 	unsigned char                                      Resistance;                                       		// 0x03F8 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22739,7 +22739,7 @@ public:
 	unsigned long                                      bShowFortifyOnGUI : 1;                            		// 0x0340 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22757,7 +22757,7 @@ public:
 	unsigned char                                      CurrentCustomAction;                              		// 0x0B88 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22960,7 +22960,7 @@ public:
 	unsigned long                                      ExportIDsCached : 1;                              		// 0x03C4 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23039,7 +23039,7 @@ public:
 	unsigned long                                      m_bLastConstrainAspect : 1;                       		// 0x062C (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23094,7 +23094,7 @@ public:
 	unsigned long                                      m_bBackingAwayFromTarget : 1;                     		// 0x07F4 (0x0004) [0x0000000000002000] [0x00000800] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23192,7 +23192,7 @@ public:
 	unsigned char                                      m_ePowerTutorialType;                             		// 0x01C4 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23244,7 +23244,7 @@ class UBioConditionals : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23258,7 +23258,7 @@ class UBioConvNodeTrackDebugInst : public USFXGameInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23272,7 +23272,7 @@ class USFXCustomActionTypes : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23286,7 +23286,7 @@ class ASFXArmor_Light : public ASFXArmor_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23301,7 +23301,7 @@ public:
 	TArray<float>                                      CharmIntimidateModifier;                          		// 0x01AC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23323,7 +23323,7 @@ public:
 	int                                                m_nPointsSpent;                                   		// 0x0090 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23354,7 +23354,7 @@ class ASFXWeapon_SniperRifle_Base : public ASFXWeapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23369,7 +23369,7 @@ class UBioSeqEvt_PawnPhysicsChange : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23384,7 +23384,7 @@ public:
 	class ABioPathPoint*                               m_oPathPointTrigger;                              		// 0x0128 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23403,7 +23403,7 @@ public:
 	class USFXPhysicalMaterialPhysics*                 PhysicalMaterialPhysics;                          		// 0x0080 (0x0008) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23417,7 +23417,7 @@ class USFXPhysicalMaterialBase : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23454,7 +23454,7 @@ public:
 	class UWwiseEvent*                                 TireSound;                                        		// 0x0110 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23471,7 +23471,7 @@ public:
 	int                                                Priority;                                         		// 0x00A4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23485,7 +23485,7 @@ class ASFXPawn_PlayerEngineer : public ASFXPawn_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23499,7 +23499,7 @@ class ASFXPawn_PlayerAdept : public ASFXPawn_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23513,7 +23513,7 @@ class ASFXPawn_PlayerInfiltrator : public ASFXPawn_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23527,7 +23527,7 @@ class ASFXPawn_PlayerSentinel : public ASFXPawn_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23541,7 +23541,7 @@ class ASFXPawn_PlayerVanguard : public ASFXPawn_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23555,7 +23555,7 @@ class ASFXArmor_Heavy : public ASFXArmor_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23569,7 +23569,7 @@ class USFXGameEffect_Regeneration : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23585,7 +23585,7 @@ class ASFXAI_None : public ASFXAI_Core
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23604,7 +23604,7 @@ class UBioSeqEvt_PowerCooldownFinished : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23618,7 +23618,7 @@ class UBioSeqEvt_PowerEffectDurationComplete : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23632,7 +23632,7 @@ class USFXSeqEvt_CastPower : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23646,7 +23646,7 @@ class USFXSeqEvt_OrderedPower : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23660,7 +23660,7 @@ class UBioSeqEvt_NotifyLimbDetached : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23708,7 +23708,7 @@ public:
 	class UBioPlanet*                                  CurrentPlanet;                                    		// 0x0250 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23736,7 +23736,7 @@ public:
 	unsigned char                                      m_CurrentBodyStance;                              		// 0x00FC (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23761,7 +23761,7 @@ public:
 	struct FVector                                     vStartLocation;                                   		// 0x0110 (0x000C) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23779,7 +23779,7 @@ class UBioCustomAction_CoverClimb : public UBioCustomAction_CoverClimbMantleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23812,7 +23812,7 @@ public:
 	unsigned char                                      ERootMotionMode;                                  		// 0x00DC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23834,7 +23834,7 @@ class USFXSeqAct_ResetCanonPlots : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23849,7 +23849,7 @@ class USFXSeqAct_LegacyDataCallback : public UBioSequenceLatentAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23872,7 +23872,7 @@ public:
 	struct FBodyStance                                 BS_CombatActivate;                                		// 0x0094 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23892,7 +23892,7 @@ public:
 	struct FBodyStance                                 BS_DeathCrawl;                                    		// 0x0094 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23910,7 +23910,7 @@ public:
 	struct FBodyStance                                 BS_TeleportAction;                                		// 0x0094 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23927,7 +23927,7 @@ class UBioCustomAction_PraetorianTeleportEnd : public UBioCustomAction_Praetoria
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23941,7 +23941,7 @@ class UBioCustomAction_PraetorianTeleportStart : public UBioCustomAction_Praetor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23956,7 +23956,7 @@ public:
 	struct FBodyStance                                 BS_WaypointAnim;                                  		// 0x0094 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23974,7 +23974,7 @@ class UBioDamageTypeCanister : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23988,7 +23988,7 @@ class UBioDamageTypePhysics : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24002,7 +24002,7 @@ class UBioDeprecated : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24017,7 +24017,7 @@ public:
 	unsigned long                                      Temp : 1;                                         		// 0x030C (0x0004) [0x0000000000000020] [0x00000001] ( CPF_Net )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24031,7 +24031,7 @@ class ASFXWeapon_Shotgun_Base : public ASFXWeapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24055,7 +24055,7 @@ public:
 	unsigned long                                      m_bNCOSeen : 1;                                   		// 0x02A4 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24069,7 +24069,7 @@ class UBioSeqEvt_WaypointSet_WaypointReached : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24083,7 +24083,7 @@ class UBioPathPointFactory : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24097,7 +24097,7 @@ class USFXSeqEvt_ExceededPhysicsThreshold : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24113,7 +24113,7 @@ public:
 	int                                                WwiseType;                                        		// 0x0068 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24130,7 +24130,7 @@ public:
 	float                                              DeadZone;                                         		// 0x00E0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24211,7 +24211,7 @@ public:
 	unsigned long                                      bMouseLock : 1;                                   		// 0x02E0 (0x0004) [0x0000000000002000] [0x00000040] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24281,7 +24281,7 @@ public:
 	unsigned long                                      bWelded : 1;                                      		// 0x00E0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24303,7 +24303,7 @@ public:
 	unsigned long                                      bHeldInRagdoll : 1;                               		// 0x00E0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24327,7 +24327,7 @@ public:
 	unsigned long                                      bRemoved : 1;                                     		// 0x0094 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24345,7 +24345,7 @@ class USFXGameEffect_DamageMultiplier : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24363,7 +24363,7 @@ class USFXCustomAction_Knockback : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24378,7 +24378,7 @@ public:
 	float                                              RagdollDuration;                                  		// 0x00E0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24393,7 +24393,7 @@ class USFXCustomAction_PlayerStagger : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24407,7 +24407,7 @@ class USFXCustomAction_PlayerMeleed : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24421,7 +24421,7 @@ class USFXCustomAction_PlayerStandardImpact : public USFXCustomAction_DamageReac
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24435,7 +24435,7 @@ class USFXCustomAction_PlayerKnockback : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24449,7 +24449,7 @@ class USFXCustomAction_Meleed : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24463,7 +24463,7 @@ class USFXCustomAction_BloodyPlayerStandardImpact : public USFXCustomAction_Dama
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24477,7 +24477,7 @@ class USFXCustomAction_PlayerOnFire : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24491,7 +24491,7 @@ class USFXCustomAction_ElectricStandardImpact : public USFXCustomAction_DamageRe
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24505,7 +24505,7 @@ class USFXCustomAction_MeleedII : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24548,7 +24548,7 @@ public:
 	float                                              CurrentAimAssistSoftMargin;                       		// 0x0140 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24581,7 +24581,7 @@ public:
 	float                                              TargetFOV;                                        		// 0x024C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24602,7 +24602,7 @@ class USFXCameraMode_PhotoOrbit : public USFXCameraMode_Photo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24617,7 +24617,7 @@ class USFXSeqEvt_Tutorial : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24631,7 +24631,7 @@ class USFXSeqEvt_TutorialReload : public USFXSeqEvt_Tutorial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24646,7 +24646,7 @@ class USFXSeqEvt_TutorialMelee : public USFXSeqEvt_Tutorial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24661,7 +24661,7 @@ class USFXSeqEvt_TutorialZoom : public USFXSeqEvt_Tutorial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24676,7 +24676,7 @@ class USFXSeqEvt_TutorialQuickCast : public USFXSeqEvt_Tutorial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24691,7 +24691,7 @@ class USFXSeqEvt_TutorialWeaponSwitch : public USFXSeqEvt_Tutorial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24706,7 +24706,7 @@ class USFXSeqEvt_TutorialStorm : public USFXSeqEvt_Tutorial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24721,7 +24721,7 @@ class USFXSeqEvt_TutorialOrderHenchman : public USFXSeqEvt_Tutorial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24736,7 +24736,7 @@ class USFXSeqEvt_TutorialWheelHidden : public USFXSeqEvt_Tutorial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24751,7 +24751,7 @@ class USFXSeqEvt_TutorialAreaMapHidden : public USFXSeqEvt_Tutorial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24766,7 +24766,7 @@ class USFXDifficulty_Level1 : public USFXDifficulty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24780,7 +24780,7 @@ class USFXDifficulty_Level3 : public USFXDifficulty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24794,7 +24794,7 @@ class USFXDifficulty_Level4 : public USFXDifficulty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24808,7 +24808,7 @@ class USFXDifficulty_Level5 : public USFXDifficulty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24822,7 +24822,7 @@ class USFXDifficulty_Level6 : public USFXDifficulty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24836,7 +24836,7 @@ class USFXDifficulty_Level2 : public USFXDifficulty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24850,7 +24850,7 @@ class ABioPlayerReplicationInfo : public APlayerReplicationInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24864,7 +24864,7 @@ class ABioPlaypenVolumeAdditive : public ABioPlaypenVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24880,7 +24880,7 @@ class ABioPlaypenVolumeSubtractive : public ABioPlaypenVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24896,7 +24896,7 @@ class ASFXShield_Energy : public ASFXShield_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24910,7 +24910,7 @@ class ASFXShield_Biotic : public ASFXShield_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24924,7 +24924,7 @@ class ASFXShield_Armour : public ASFXShield_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24939,7 +24939,7 @@ class UBioPowerScriptDesign : public UBioPowerScript
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24997,7 +24997,7 @@ class USFXGameEffect_BioticWeakness : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25023,7 +25023,7 @@ public:
 	unsigned long                                      bApplied : 1;                                     		// 0x00C8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25050,7 +25050,7 @@ public:
 	float                                              minHeightForBodyFallSound;                        		// 0x00B4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25077,7 +25077,7 @@ public:
 	unsigned long                                      bGravityRampUp : 1;                               		// 0x00D0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25096,7 +25096,7 @@ class USFXGameEffect_AntiGravity : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25112,7 +25112,7 @@ class USFXGameEffect_Ragdoll : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25133,7 +25133,7 @@ public:
 	unsigned char                                      CustomActionType;                                 		// 0x00C4 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25150,7 +25150,7 @@ class USFXGameEffect_Stasis : public USFXGameEffect_WeldPhysics
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25166,7 +25166,7 @@ class USFXGameEffect_PhysicsDamageMultiplier : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25182,7 +25182,7 @@ class USFXDamageType_PowerPhysics : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25202,7 +25202,7 @@ public:
 	unsigned long                                      bThawStarted : 1;                                 		// 0x00E8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25225,7 +25225,7 @@ public:
 	unsigned long                                      bReactionPlayed : 1;                              		// 0x00C4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25243,7 +25243,7 @@ public:
 	unsigned long                                      bPooled : 1;                                      		// 0x02A0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25265,7 +25265,7 @@ public:
 	float                                              m_fVarianceTime;                                  		// 0x00A0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25280,7 +25280,7 @@ public:
 	FString                                            m_sCharacterCreationMap;                          		// 0x00F8 (0x0010) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25297,7 +25297,7 @@ public:
 	class AActor*                                      Squad;                                            		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25315,7 +25315,7 @@ public:
 	class AActor*                                      oPerceivedSquad;                                  		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25333,7 +25333,7 @@ public:
 	unsigned long                                      TeleportToLeader : 1;                             		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25351,7 +25351,7 @@ public:
 	unsigned char                                      TreasureType;                                     		// 0x00C0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25384,7 +25384,7 @@ public:
 	unsigned long                                      bPooled : 1;                                      		// 0x02D8 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25419,7 +25419,7 @@ public:
 	unsigned char                                      TreasureType;                                     		// 0x0110 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25442,7 +25442,7 @@ public:
 	unsigned long                                      bForceCinematicDamage : 1;                        		// 0x0114 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25460,7 +25460,7 @@ public:
 	struct SFXName                                     StartPoint;                                       		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25478,7 +25478,7 @@ public:
 	float                                              fLifeTime;                                        		// 0x0108 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25498,7 +25498,7 @@ public:
 	class UBioVFXTemplate*                             m_oEffect;                                        		// 0x011C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25518,7 +25518,7 @@ public:
 	unsigned long                                      m_bEnterCombatModeOnEnd : 1;                      		// 0x010C (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25538,7 +25538,7 @@ public:
 	unsigned long                                      bForceCinematicDamage : 1;                        		// 0x0110 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25557,7 +25557,7 @@ public:
 	unsigned long                                      SaveOldAIController : 1;                          		// 0x0108 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25572,7 +25572,7 @@ class UBioSeqAct_ClearBrowserWheelStateOverrides : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25589,7 +25589,7 @@ public:
 	unsigned long                                      m_bCrouch : 1;                                    		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25611,7 +25611,7 @@ public:
 	float                                              m_fCameraFocusDistanceDelta;                      		// 0x0110 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25626,7 +25626,7 @@ class UBioSeqAct_Deprecated : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25642,7 +25642,7 @@ public:
 	class ABioBaseSquad*                               Squad;                                            		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25663,7 +25663,7 @@ public:
 	int                                                m_nIndex;                                         		// 0x0124 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25683,7 +25683,7 @@ public:
 	int                                                m_nIndex;                                         		// 0x0120 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25699,7 +25699,7 @@ public:
 	unsigned long                                      bModal : 1;                                       		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25716,7 +25716,7 @@ public:
 	unsigned long                                      bLeftToRight : 1;                                 		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25733,7 +25733,7 @@ public:
 	unsigned long                                      bModalBar : 1;                                    		// 0x00FC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25751,7 +25751,7 @@ public:
 	unsigned long                                      bModalBar : 1;                                    		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25768,7 +25768,7 @@ public:
 	unsigned long                                      bModalCounter : 1;                                		// 0x00FC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25785,7 +25785,7 @@ public:
 	unsigned char                                      Element;                                          		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25804,7 +25804,7 @@ public:
 	unsigned char                                      Element;                                          		// 0x0104 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25822,7 +25822,7 @@ public:
 	unsigned char                                      Element;                                          		// 0x0100 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25839,7 +25839,7 @@ public:
 	unsigned char                                      Element;                                          		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25855,7 +25855,7 @@ public:
 	int                                                srEndGameMessage;                                 		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25872,7 +25872,7 @@ public:
 	class UObject*                                     Input2;                                           		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25890,7 +25890,7 @@ class UBioSeqAct_ForceActorMipsResident : public USequenceOp
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25905,7 +25905,7 @@ public:
 	TArray<class UObject*>                             ResourceArray;                                    		// 0x00F8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25922,7 +25922,7 @@ public:
 	unsigned long                                      bZoomed : 1;                                      		// 0x0100 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25937,7 +25937,7 @@ class ASFXWeapon_AssaultRifle_Base : public ASFXWeapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25953,7 +25953,7 @@ class ASFXWeapon_HeavyPistol_Base : public ASFXWeapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25968,7 +25968,7 @@ class ASFXWeapon_AutoPistol_Base : public ASFXWeapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25989,7 +25989,7 @@ public:
 	unsigned char                                      eType;                                            		// 0x010C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26007,7 +26007,7 @@ public:
 	class AActor*                                      oSquad;                                           		// 0x0100 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26029,7 +26029,7 @@ public:
 	unsigned long                                      m_bIsEmpty : 1;                                   		// 0x0114 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26045,7 +26045,7 @@ class UBioSeqAct_HideSniperHudOverlay : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26060,7 +26060,7 @@ class UBioSeqAct_HUDDisplayState : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26077,7 +26077,7 @@ public:
 	class UBioConversation*                            IgnoreConversation;                               		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26093,7 +26093,7 @@ public:
 	class UBioConversation*                            Conversation;                                     		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26108,7 +26108,7 @@ class UBioSeqAct_KillPawn : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26123,7 +26123,7 @@ class UBioSeqAct_ModifyPropertyBaseSquad : public UBioSeqAct_ModifyProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26138,7 +26138,7 @@ public:
 	float                                              fValue;                                           		// 0x00F8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26154,7 +26154,7 @@ public:
 	class AActor*                                      mActor;                                           		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26169,7 +26169,7 @@ class UBioSeqAct_RemoveFromParty : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26186,7 +26186,7 @@ public:
 	class AActor*                                      Squad;                                            		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26203,7 +26203,7 @@ public:
 	class ABioPawn*                                    m_oPawn;                                          		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26225,7 +26225,7 @@ public:
 	unsigned char                                      m_eWalkOrder;                                     		// 0x07AC (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26245,7 +26245,7 @@ public:
 	float                                              PctHealthRegained;                                		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26262,7 +26262,7 @@ public:
 	class ABioPawn*                                    oPawn;                                            		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26279,7 +26279,7 @@ public:
 	unsigned char                                      m_eActionState;                                   		// 0x0100 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26295,7 +26295,7 @@ public:
 	unsigned long                                      bSetActive : 1;                                   		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26310,7 +26310,7 @@ class UBioSeqAct_SetBase : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26328,7 +26328,7 @@ public:
 	unsigned long                                      bSetNotClear : 1;                                 		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26344,7 +26344,7 @@ public:
 	unsigned long                                      m_bMakeAvailable : 1;                             		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26359,7 +26359,7 @@ class USFXGameEffect_ResearchCostMultiplier : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26377,7 +26377,7 @@ public:
 	struct FScriptDelegate                             __BioTimerDelegate__Delegate;                     		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26396,7 +26396,7 @@ public:
 	TArray<struct FSubPageState>                       PageStates;                                       		// 0x00F8 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26413,7 +26413,7 @@ public:
 	unsigned long                                      m_bCanWalkOffLedges : 1;                          		// 0x0100 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26430,7 +26430,7 @@ public:
 	unsigned long                                      bForceInstant : 1;                                		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26446,7 +26446,7 @@ class USFXCameraMode_Explore : public USFXCameraMode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26462,7 +26462,7 @@ public:
 	unsigned long                                      bInCombat : 1;                                    		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26480,7 +26480,7 @@ public:
 	class AActor*                                      LookAtTarget;                                     		// 0x0108 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26496,7 +26496,7 @@ class UBioSeqAct_SetPlotPartySize : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26515,7 +26515,7 @@ public:
 	float                                              m_fCooldownTimeRemaining;                         		// 0x0108 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26533,7 +26533,7 @@ public:
 	unsigned long                                      m_bDisabled : 1;                                  		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26550,7 +26550,7 @@ public:
 	class AActor*                                      m_oActor;                                         		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26578,7 +26578,7 @@ public:
 	unsigned char                                      m_TextAlign;                                      		// 0x012E (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26607,7 +26607,7 @@ public:
 	float                                              fWeight9;                                         		// 0x0144 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26637,7 +26637,7 @@ public:
 	int                                                nHench2;                                          		// 0x0134 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26654,7 +26654,7 @@ public:
 	unsigned long                                      m_bEnable : 1;                                    		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26671,7 +26671,7 @@ public:
 	unsigned long                                      bEnable : 1;                                      		// 0x00FC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26686,7 +26686,7 @@ class UBioSeqCond_Deprecated : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26703,7 +26703,7 @@ public:
 	int                                                nBoolID;                                          		// 0x00E0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26720,7 +26720,7 @@ public:
 	class AActor*                                      Squad;                                            		// 0x00E4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26735,7 +26735,7 @@ class UBioSeqCond_InCombat : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26750,7 +26750,7 @@ class UBioSeqEvt_AllActionsComplete : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26764,7 +26764,7 @@ class UBioSeqEvt_Deprecated : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26779,7 +26779,7 @@ class UBioSeqEvt_EnterFollowFormation : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26793,7 +26793,7 @@ class UBioSeqEvt_EnterRestFormation : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26807,7 +26807,7 @@ class UBioSeqEvt_NoLongerSeePlayer : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26826,7 +26826,7 @@ public:
 	unsigned long                                      m_bFromMainMenu : 1;                              		// 0x00A8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26847,7 +26847,7 @@ class UBioSFHandler_SharedIGG : public UBioSFHandler
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26889,7 +26889,7 @@ public:
 	unsigned long                                      m_bCloseGUIButtonPressed : 1;                     		// 0x0150 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26940,7 +26940,7 @@ public:
 	float                                              m_fRScrollValue;                                  		// 0x00D8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26966,7 +26966,7 @@ public:
 	int                                                srText;                                           		// 0x009C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26981,7 +26981,7 @@ class UBioSFHandler_LoadScreen : public UBioSFHandler
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27014,7 +27014,7 @@ public:
 	unsigned long                                      m_bSFScreenInitialized : 1;                       		// 0x0114 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27042,7 +27042,7 @@ class UBioSFHandler_SniperOverlay : public UBioSFHandler
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27065,7 +27065,7 @@ public:
 	unsigned char                                      MapLayout;                                        		// 0x00A8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27083,7 +27083,7 @@ class UBioSFHandler_PCAchievement : public UBioSFHandler_Achievement
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27098,7 +27098,7 @@ class UBioSFHandler_PCCharacterRecord2 : public UBioSFHandler_CharacterRecord2
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27114,7 +27114,7 @@ class UBioSFHandler_PCChoiceGUI : public UBioSFHandler_ChoiceGUI
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27132,7 +27132,7 @@ public:
 	unsigned long                                      m_bEnforce16x9 : 1;                               		// 0x0130 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27153,7 +27153,7 @@ public:
 	float                                              AccumulationDivisor;                              		// 0x0140 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27172,7 +27172,7 @@ class UBioSFHandler_PCCredits : public UBioSFHandler_Credits
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27187,7 +27187,7 @@ class UBioSFHandler_PCDataCodex : public UBioSFHandler_DataCodex
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27203,7 +27203,7 @@ class UBioSFHandler_PCDesignerUI : public UBioSFHandler_DesignerUI
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27217,7 +27217,7 @@ class UBioSFHandler_PCGameOver : public UBioSFHandler_GameOver
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27233,7 +27233,7 @@ class UBioSFHandler_PCJournal : public UBioSFHandler_Journal
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27262,7 +27262,7 @@ public:
 	unsigned char                                      InterpMethod;                                     		// 0x0274 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27314,7 +27314,7 @@ public:
 	unsigned char                                      bOldIgnoreLookInput;                              		// 0x0295 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27398,7 +27398,7 @@ public:
 	float                                              SniperZoomTransitionTime;                         		// 0x01B8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27440,7 +27440,7 @@ public:
 	float                                              DisableMoveTime;                                  		// 0x00D0 (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27460,7 +27460,7 @@ public:
 	float                                              DisableMoveTime;                                  		// 0x00D0 (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27480,7 +27480,7 @@ public:
 	unsigned long                                      bCameraEnabled : 1;                               		// 0x00D0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27501,7 +27501,7 @@ public:
 	class USFXCameraMode_Vehicle*                      VehicleCam;                                       		// 0x00D0 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27520,7 +27520,7 @@ public:
 	class USFXCameraTransition_GalaxyMap*              InstantTransition;                                		// 0x00D8 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27543,7 +27543,7 @@ class USFXGameModeCinematic : public USFXGameModeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27563,7 +27563,7 @@ public:
 	class USFXCameraTransition_GalaxyMap*              InstantTransition;                                		// 0x00E8 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27595,7 +27595,7 @@ public:
 	unsigned long                                      bLoadingMovie : 1;                                		// 0x00D0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27612,7 +27612,7 @@ class USFXGameModeCheatMenu : public USFXGameModeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27635,7 +27635,7 @@ class UBioSFHandler_PCPartySelection : public UBioSFHandler_PartySelection
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27652,7 +27652,7 @@ class UBioSFHandler_PCSpecialization : public UBioSFHandler_Specialization
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27668,7 +27668,7 @@ class UBioSFHandler_SelectCharacter : public UBioSFHandler
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27685,7 +27685,7 @@ class UBioSkillGame_Bypass_PCHandler : public UBioSkillGame_Bypass_Handler
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27701,7 +27701,7 @@ class UBioSkillGame_Decryption_PCHandler : public UBioSkillGame_Decryption_Handl
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27719,7 +27719,7 @@ public:
 	unsigned long                                      m_bClosedIsSkillState : 1;                        		// 0x0070 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27735,7 +27735,7 @@ class UBioSkillMap_Door : public UBioSkillMap
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27749,7 +27749,7 @@ class UBioSkillMap_Test : public UBioSkillMap
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27766,7 +27766,7 @@ public:
 	int                                                m_nSelectedMode;                                  		// 0x0084 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27789,7 +27789,7 @@ public:
 	int                                                m_nSelectedSubOption;                             		// 0x00A4 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27811,7 +27811,7 @@ class UBioSpectatorModeState : public UBioSpectatorMode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27827,7 +27827,7 @@ class UBioSpectatorModeAnim : public UBioSpectatorMode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27843,7 +27843,7 @@ class UBioSpectatorModeAnimSpeed : public UBioSpectatorMode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27859,7 +27859,7 @@ class UBioSpectatorModeLOD : public UBioSpectatorMode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27875,7 +27875,7 @@ class ABioStartPoint : public ANavigationPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27889,7 +27889,7 @@ class ABioStartLocation : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27903,7 +27903,7 @@ class USFXGameEffect_PassiveHeadShotBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27919,7 +27919,7 @@ class USFXGameEffect_NonCoverDamageResistBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27935,7 +27935,7 @@ class USFXGameEffect_DamageImmunity : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27951,7 +27951,7 @@ class USFXSeqEvt_CombatStarted : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27966,7 +27966,7 @@ class USFXSeqEvt_CombatEnded : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27981,7 +27981,7 @@ class ABioTempNavPoint : public ANavigationPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27996,7 +27996,7 @@ public:
 	TArray<struct FTwitchRec>                          m_aTwitchAnims;                                   		// 0x008C (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28012,7 +28012,7 @@ public:
 	unsigned long                                      OneShot : 1;                                      		// 0x029C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28028,7 +28028,7 @@ class UBioTriggerActorFactory : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28044,7 +28044,7 @@ public:
 	unsigned long                                      OneShot : 1;                                      		// 0x02CC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28060,7 +28060,7 @@ class UBioWaypointSetFactory : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28074,7 +28074,7 @@ class ABioWorldInfoTick : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28089,7 +28089,7 @@ class ABioWp_Kismet : public ABioPathPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28104,7 +28104,7 @@ class ADynamicCylindricalForceActor : public ARB_CylindricalForceActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28118,7 +28118,7 @@ class USFXActorFactoryPhysicsAsset : public UActorFactoryPhysicsAsset
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28132,7 +28132,7 @@ class ASFXKAssetSpawnable : public ASFXKAsset
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28150,7 +28150,7 @@ public:
 	unsigned long                                      m_bMaintainVelocity : 1;                          		// 0x0394 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28165,7 +28165,7 @@ class ASFXAI_CombatScripted : public ASFXAI_Core
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28186,7 +28186,7 @@ public:
 	unsigned long                                      m_bUnderAttack : 1;                               		// 0x07A8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28204,7 +28204,7 @@ public:
 	unsigned char                                      m_eCurrentBehaviour;                              		// 0x0798 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28221,7 +28221,7 @@ public:
 	TArray<struct FBodyStance>                         BodyStances;                                      		// 0x00E0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28236,7 +28236,7 @@ class USFXCustomAction_Headshot : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28251,7 +28251,7 @@ class USFXCustomAction_GreatPain : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28265,7 +28265,7 @@ class USFXCustomAction_Staggering : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28279,7 +28279,7 @@ class USFXCustomAction_Reave : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28293,7 +28293,7 @@ class USFXCustomAction_HitLeftLeg : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28307,7 +28307,7 @@ class USFXCustomAction_HitRightLeg : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28321,7 +28321,7 @@ class USFXCustomAction_CorkscrewDeath : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28335,7 +28335,7 @@ class USFXCustomAction_ExplosionDeath : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28349,7 +28349,7 @@ class USFXCustomAction_LeftArmDeath : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28363,7 +28363,7 @@ class USFXCustomAction_RightArmDeath : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28377,7 +28377,7 @@ class USFXCustomAction_StomachDeath : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28391,7 +28391,7 @@ class USFXCustomAction_OnFire : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28405,7 +28405,7 @@ class USFXCustomAction_TakeAKnee : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28419,7 +28419,7 @@ class USFXCustomAction_StaggerImpact : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28433,7 +28433,7 @@ class USFXCustomAction_StandardImpact : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28447,7 +28447,7 @@ class USFXCustomAction_ShieldKnockback : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28461,7 +28461,7 @@ class USFXCustomAction_ShieldStaggerImpact : public USFXCustomAction_DamageReact
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28475,7 +28475,7 @@ class USFXCustomAction_ShieldStandardImpact : public USFXCustomAction_DamageReac
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28492,7 +28492,7 @@ public:
 	float                                              RagdollDuration;                                  		// 0x00F0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28507,7 +28507,7 @@ class USFXCustomAction_PlayerShortStagger : public USFXCustomAction_DamageReacti
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28521,7 +28521,7 @@ class USFXCustomAction_StumbleForward : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28535,7 +28535,7 @@ class USFXCustomAction_GreatPainII : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28549,7 +28549,7 @@ class USFXCustomAction_KnockbackII : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28564,7 +28564,7 @@ public:
 	float                                              RagdollDuration;                                  		// 0x00E0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28580,7 +28580,7 @@ public:
 	float                                              RagdollDuration;                                  		// 0x00E0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28595,7 +28595,7 @@ class USFXCustomAction_OnFireShort : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28609,7 +28609,7 @@ class ASFXAI_TechDrone : public ASFXAI_Core
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28629,7 +28629,7 @@ public:
 	unsigned long                                      bHasWarned : 1;                                   		// 0x0790 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28652,7 +28652,7 @@ public:
 	unsigned long                                      m_bApproachEnemy : 1;                             		// 0x079C (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28673,7 +28673,7 @@ public:
 	unsigned long                                      bRespawns : 1;                                    		// 0x02E4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28691,7 +28691,7 @@ class USFXAnimNotify_DisableProcEyeBlink : public UAnimNotify_Scripted
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28706,7 +28706,7 @@ class USFXAnimNotify_EnableProcEyeBlink : public UAnimNotify_Scripted
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28720,7 +28720,7 @@ class USFXGameEffect_ArmorBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28738,7 +28738,7 @@ class ASFXArmor_Medium : public ASFXArmor_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28752,7 +28752,7 @@ class ASFXArmor_Player : public ASFXArmor_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28767,7 +28767,7 @@ public:
 	int                                                CurrentOffsetApplied;                             		// 0x0278 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28783,7 +28783,7 @@ class USFXCameraMode_Combat : public USFXCameraMode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28798,7 +28798,7 @@ public:
 	class UMotionBlurEffect*                           Blur;                                             		// 0x0218 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28814,7 +28814,7 @@ class USFXCameraMode_Cover : public USFXCameraMode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28829,7 +28829,7 @@ class USFXCameraMode_CoverFixed : public USFXCameraMode_Cover
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28846,7 +28846,7 @@ class USFXCameraMode_ExploreStorm : public USFXCameraMode_Explore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28860,7 +28860,7 @@ class USFXCameraMode_PhotoFree : public USFXCameraMode_Photo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28877,7 +28877,7 @@ public:
 	class UBioCameraZoom*                              ZoomData;                                         		// 0x0218 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28894,7 +28894,7 @@ class USFXSeqEvt_LeaveWorld : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28910,7 +28910,7 @@ public:
 	float                                              TimeRemainingBeforePause;                         		// 0x00A8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28929,7 +28929,7 @@ class USFXCameraMode_TightAim : public USFXCameraMode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28948,7 +28948,7 @@ public:
 	struct FVector                                     LastPosition;                                     		// 0x02D8 (0x000C) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28968,7 +28968,7 @@ public:
 	struct FVector                                     StartLocation;                                    		// 0x0290 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28989,7 +28989,7 @@ public:
 	struct FVector                                     LastPosition;                                     		// 0x02E0 (0x000C) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29017,7 +29017,7 @@ public:
 	unsigned long                                      bUpdatedThisFrame : 1;                            		// 0x0268 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29042,7 +29042,7 @@ public:
 	unsigned long                                      bScalePlayRate : 1;                               		// 0x0288 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29061,7 +29061,7 @@ public:
 	struct FVector                                     StartLocation;                                    		// 0x0290 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29077,7 +29077,7 @@ class USFXCameraTransition_GalaxyMap : public USFXCameraMode_Interpolate
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29101,7 +29101,7 @@ public:
 	float                                              FirstPhaseLength;                                 		// 0x02DC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29117,7 +29117,7 @@ class USFXCustomAction_BloodLust : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29133,7 +29133,7 @@ public:
 	float                                              HealDuration;                                     		// 0x00E8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29149,7 +29149,7 @@ class USFXGameEffect_HealOverTime : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29164,7 +29164,7 @@ class USFXCustomAction_Exploration_Comm : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29180,7 +29180,7 @@ class USFXCustomAction_GlobalDeath : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29194,7 +29194,7 @@ class USFXCustomAction_GreatPainII_Death : public USFXCustomAction_DamageReactio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29208,7 +29208,7 @@ class USFXCustomAction_HeavyMeleed : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29237,7 +29237,7 @@ public:
 	unsigned long                                      bRequireTarget : 1;                               		// 0x015C (0x0004) [0x0000000000002001] [0x00000001] ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29257,7 +29257,7 @@ class USFXGameEffect_MeleeDamageBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29273,7 +29273,7 @@ class USFXDamageType_HeavyMelee : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29287,7 +29287,7 @@ class USFXCustomAction_HuskImpact : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29304,7 +29304,7 @@ public:
 	unsigned char                                      m_eCurrentBurrowAction;                           		// 0x00AC (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29322,7 +29322,7 @@ class USFXCustomAction_MawDeath : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29337,7 +29337,7 @@ class USFXCustomAction_MechDogIdle : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29357,7 +29357,7 @@ public:
 	float                                              Force;                                            		// 0x0124 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29375,7 +29375,7 @@ class USFXCustomAction_OculusDeath : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29389,7 +29389,7 @@ class USFXCustomAction_PlayerMeleedII : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29403,7 +29403,7 @@ class USFXCustomAction_PlayerMeleedNoRotate : public USFXCustomAction_PlayerMele
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29417,7 +29417,7 @@ class USFXCustomAction_PlayerStumbleForward : public USFXCustomAction_DamageReac
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29432,7 +29432,7 @@ public:
 	struct FBodyStance                                 BS_Possession;                                    		// 0x0094 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29449,7 +29449,7 @@ class USFXCustomAction_PraetorianDeath : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29465,7 +29465,7 @@ class USFXCustomAction_RoboticImpact : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29479,7 +29479,7 @@ class USFXCustomAction_ScionHeadless : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29493,7 +29493,7 @@ class USFXCustomAction_ScionImpact : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29507,7 +29507,7 @@ class USFXCustomAction_Spider : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29522,7 +29522,7 @@ class USFXCustomAction_SpiderImpact : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29536,7 +29536,7 @@ class USFXCustomAction_TentacleDeath : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29554,7 +29554,7 @@ public:
 	struct FBodyStance                                 BS_ReactionExploreAlternative;                    		// 0x0108 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29571,7 +29571,7 @@ class USFXCustomAction_VarrenImpact : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29585,7 +29585,7 @@ class USFXCustomAction_ZombieTakeAKnee : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29599,7 +29599,7 @@ class USFXDamageType_Abomination : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29613,7 +29613,7 @@ class USFXDamageType_AIHacking : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29627,7 +29627,7 @@ class USFXDamageType_ArmorPiercingAmmo : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29641,7 +29641,7 @@ class USFXDamageType_Carnage : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29655,7 +29655,7 @@ class USFXDamageType_ColossusPulse : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29669,7 +29669,7 @@ class USFXDamageType_CombatDroneAttack : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29683,7 +29683,7 @@ class USFXDamageType_ConcussiveAmmo : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29697,7 +29697,7 @@ class USFXDamageType_ConcussiveShot : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29711,7 +29711,7 @@ class USFXDamageType_Crush : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29725,7 +29725,7 @@ class USFXDamageType_DisruptorAmmo : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29739,7 +29739,7 @@ class USFXDamageType_Environmental : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29753,7 +29753,7 @@ class USFXDamageType_Explosion : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29767,7 +29767,7 @@ class USFXDamageType_FireDamageOverTime : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29781,7 +29781,7 @@ class USFXDamageType_Fissure : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29795,7 +29795,7 @@ class USFXDamageType_Flashbang : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29809,7 +29809,7 @@ class USFXDamageType_GunshipRocket : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29823,7 +29823,7 @@ class USFXDamageType_HeavyFireDamage : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29837,7 +29837,7 @@ class USFXDamageType_HeavyMechRocket : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29851,7 +29851,7 @@ class USFXDamageType_HuskMelee : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29865,7 +29865,7 @@ class USFXDamageType_HuskTesla : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29879,7 +29879,7 @@ class USFXDamageType_IgnoreShields : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29893,7 +29893,7 @@ class USFXDamageType_ImprovedDisruptorAmmo : public USFXDamageType_DisruptorAmmo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29907,7 +29907,7 @@ class USFXDamageType_Overload : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29921,7 +29921,7 @@ class USFXDamageType_ImprovedOverload : public USFXDamageType_Overload
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29935,7 +29935,7 @@ class USFXDamageType_IncendiaryAmmo : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29949,7 +29949,7 @@ class USFXDamageType_Incinerate : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29963,7 +29963,7 @@ class USFXDamageType_KillTrigger : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29977,7 +29977,7 @@ class USFXDamageType_KroganCharge : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29991,7 +29991,7 @@ class USFXDamageType_LightMechShock : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30005,7 +30005,7 @@ class USFXDamageType_MechDogBite : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30019,7 +30019,7 @@ class USFXDamageType_MechDogTaser : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30033,7 +30033,7 @@ class USFXDamageType_Melee : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30047,7 +30047,7 @@ class USFXDamageType_NeuralShock : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30061,7 +30061,7 @@ class USFXDamageType_PowerArmor : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30075,7 +30075,7 @@ class USFXDamageType_PraetorianAreaDamage : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30089,7 +30089,7 @@ class USFXDamageType_PraetorianDeathChoir : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30103,7 +30103,7 @@ class USFXDamageType_Pull : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30117,7 +30117,7 @@ class USFXDamageType_RocketDroneAttack : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30131,7 +30131,7 @@ class USFXDamageType_Shatter : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30145,7 +30145,7 @@ class USFXDamageType_ShieldJack : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30159,7 +30159,7 @@ class USFXDamageType_Singularity : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30173,7 +30173,7 @@ class USFXDamageType_Stasis : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30187,7 +30187,7 @@ class USFXDamageType_SunTlaColossusRocket : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30201,7 +30201,7 @@ class USFXDamageType_SunTlaExposure : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30215,7 +30215,7 @@ class USFXDamageType_ThresherMawSpit : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30229,7 +30229,7 @@ class USFXDamageType_Throw : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30243,7 +30243,7 @@ class USFXDamageType_VarrenBite : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30257,7 +30257,7 @@ class USFXDamageType_Warp : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30271,7 +30271,7 @@ class USFXDamageType_Weapon : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30285,7 +30285,7 @@ class USFXSeqEvt_SFXDoorInteraction : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30303,7 +30303,7 @@ public:
 	class ULightEnvironmentComponent*                  LightEnvironment;                                 		// 0x02B0 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30322,7 +30322,7 @@ class USFXGameChoiceGUIData_HeavyWeapons : public USFXGameChoiceGUIData
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30348,7 +30348,7 @@ public:
 	int                                                m_srResearchErrorCanNotLearn;                     		// 0x00D4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30362,7 +30362,7 @@ class USFXGameChoiceGUIData_Weapons : public USFXGameChoiceGUIData
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30377,7 +30377,7 @@ public:
 	class UClass*                                      OriginalFaction;                                  		// 0x0094 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30393,7 +30393,7 @@ class USFXGameEffect_AIConfuse : public USFXGameEffect_AIHacking
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30408,7 +30408,7 @@ class USFXGameEffect_ArmorPenalty : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30424,7 +30424,7 @@ public:
 	struct FScriptDelegate                             __OnCloakEnded__Delegate;                         		// 0x0094 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30443,7 +30443,7 @@ class USFXGameEffect_CloakDamageBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30462,7 +30462,7 @@ class USFXGameEffect_CloakTargetable : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30480,7 +30480,7 @@ class USFXGameEffect_CustomFlag : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30496,7 +30496,7 @@ class USFXGameEffect_DamageBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30511,7 +30511,7 @@ class USFXGameEffect_DamageOverTime : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30527,7 +30527,7 @@ class USFXGameEffect_HealthRegenPenalty : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30545,7 +30545,7 @@ public:
 	unsigned char                                      CustomAction;                                     		// 0x009C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30560,7 +30560,7 @@ class USFXGameEffect_DisableAI : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30576,7 +30576,7 @@ class USFXGameEffect_FireDamageOverTime : public USFXGameEffect_DamageOverTime
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30591,7 +30591,7 @@ class USFXGameEffect_FireDeath : public USFXGameEffect_DeathEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30605,7 +30605,7 @@ class USFXGameEffect_FissureDamageOverTime : public USFXGameEffect_DamageOverTim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30621,7 +30621,7 @@ public:
 	unsigned long                                      bRemoved : 1;                                     		// 0x0094 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30639,7 +30639,7 @@ class USFXGameEffect_Gear_AmplifierPads : public USFXGameEffect_PowerDamageBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30654,7 +30654,7 @@ public:
 	float                                              AppliedBonus;                                     		// 0x0094 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30672,7 +30672,7 @@ class USFXGameEffect_Gear_BodyArmor : public USFXGameEffect_PassiveHealthBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30686,7 +30686,7 @@ class USFXGameEffect_PassiveShieldRegenBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30704,7 +30704,7 @@ class USFXGameEffect_Gear_CapacitorChestplate : public USFXGameEffect_PassiveShi
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30718,7 +30718,7 @@ class USFXGameEffect_PassiveNegotiationBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30734,7 +30734,7 @@ class USFXGameEffect_Gear_DeathMask : public USFXGameEffect_PassiveNegotiationBo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30748,7 +30748,7 @@ class USFXGameEffect_PassiveHeavyAmmoBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30766,7 +30766,7 @@ class USFXGameEffect_Gear_EquipmentPacks : public USFXGameEffect_PassiveHeavyAmm
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30780,7 +30780,7 @@ class USFXGameEffect_PassiveShieldBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30798,7 +30798,7 @@ class USFXGameEffect_Gear_HeavyDampingGauntlets : public USFXGameEffect_PassiveS
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30812,7 +30812,7 @@ class USFXGameEffect_Gear_HeavyLeftSideArmor : public USFXGameEffect_PassiveHeal
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30826,7 +30826,7 @@ class USFXGameEffect_PassiveMaxAmmoBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30844,7 +30844,7 @@ class USFXGameEffect_Gear_LeftArmAmmoPack : public USFXGameEffect_PassiveMaxAmmo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30858,7 +30858,7 @@ class USFXGameEffect_Gear_LifeSupportWebbing : public USFXGameEffect_PassiveHeal
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30872,7 +30872,7 @@ class USFXGameEffect_Gear_N7Arms : public USFXGameEffect_PassiveHealthBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30886,7 +30886,7 @@ class USFXGameEffect_Gear_N7Helmet : public USFXGameEffect_PassiveHealthBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30900,7 +30900,7 @@ class USFXGameEffect_Gear_N7Legs : public USFXGameEffect_PassiveShieldBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30914,7 +30914,7 @@ class USFXGameEffect_Gear_N7Shoulders : public USFXGameEffect_PassiveWeaponDamag
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30928,7 +30928,7 @@ class USFXGameEffect_Gear_N7Torso : public USFXGameEffect_PowerDamageBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30942,7 +30942,7 @@ class USFXGameEffect_Gear_PowerBelt : public USFXGameEffect_PassiveShieldBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30956,7 +30956,7 @@ class USFXGameEffect_Gear_StabilizationGauntlets : public USFXGameEffect_Passive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30971,7 +30971,7 @@ public:
 	unsigned long                                      bRemoved : 1;                                     		// 0x0094 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30989,7 +30989,7 @@ class USFXGameEffect_Gear_StimulatorConduits : public USFXGameEffect_PassiveStor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31003,7 +31003,7 @@ class USFXGameEffect_Gear_StrengthBoostPads : public USFXGameEffect_MeleeDamageB
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31017,7 +31017,7 @@ class USFXGameEffect_Gear_Visor : public USFXGameEffect_PassiveHeadShotBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31034,7 +31034,7 @@ public:
 	unsigned long                                      bForceNewShield : 1;                              		// 0x00A4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31052,7 +31052,7 @@ class USFXGameEffect_HealShieldOverTime : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31068,7 +31068,7 @@ public:
 	float                                              PercentHealthBonus;                               		// 0x0094 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31086,7 +31086,7 @@ class USFXGameEffect_HeavyFireDamage : public USFXGameEffect_DamageOverTime
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31101,7 +31101,7 @@ class USFXGameEffect_IgnorePlayerSquad : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31118,7 +31118,7 @@ class USFXGameEffect_MeleeCooldown : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31133,7 +31133,7 @@ public:
 	unsigned long                                      bRemoved : 1;                                     		// 0x0094 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31165,7 +31165,7 @@ public:
 	unsigned long                                      bShieldDestroyed : 1;                             		// 0x0104 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31187,7 +31187,7 @@ public:
 	unsigned long                                      bRemoved : 1;                                     		// 0x0094 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31206,7 +31206,7 @@ public:
 	unsigned long                                      bRemoved : 1;                                     		// 0x0094 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31224,7 +31224,7 @@ class USFXGameEffect_RecentlyMeleed : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31238,7 +31238,7 @@ class USFXGameEffect_RecentlyMeleed_Second : public USFXGameEffect_RecentlyMelee
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31253,7 +31253,7 @@ public:
 	float                                              PercentShieldBonus;                               		// 0x0094 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31271,7 +31271,7 @@ class USFXGameEffect_ShieldBoost : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31288,7 +31288,7 @@ class USFXGameEffect_ShieldDamageReduction : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31304,7 +31304,7 @@ class USFXGameEffect_SingularityImmune : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31325,7 +31325,7 @@ public:
 	unsigned long                                      bTimeSlowed : 1;                                  		// 0x00C8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31343,7 +31343,7 @@ public:
 	class USFXModule_DamageParty*                      DamageModule;                                     		// 0x0094 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31361,7 +31361,7 @@ public:
 	class ASFXShield_Base*                             Shield;                                           		// 0x009C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31383,7 +31383,7 @@ public:
 	float                                              TimeSinceStorm;                                   		// 0x00C0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31401,7 +31401,7 @@ class USFXGameEffect_WarpDamageOverTime : public USFXGameEffect_DamageOverTime
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31416,7 +31416,7 @@ class USFXGameEffect_WeaponDamageBonus : public USFXGameEffect_PassiveWeaponDama
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31430,7 +31430,7 @@ class USFXGameEffect_WeaponRateOfFireBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31446,7 +31446,7 @@ class USFXGameEffect_WeaponRecoilBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31471,7 +31471,7 @@ public:
 	unsigned long                                      bModifyImpactVFX : 1;                             		// 0x00BC (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31502,7 +31502,7 @@ public:
 	class UParticleSystem*                             ParticleBeam;                                     		// 0x00C8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31544,7 +31544,7 @@ public:
 	class UWwiseEvent*                                 ParticleBeam_Player;                              		// 0x0138 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31586,7 +31586,7 @@ public:
 	float                                              ParticleBeamFadeTime;                             		// 0x0174 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31604,7 +31604,7 @@ public:
 	unsigned char                                      ScaleMode;                                        		// 0x0344 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31625,7 +31625,7 @@ class ASFXTracer_Bullet : public ASFXTracer
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31648,7 +31648,7 @@ public:
 	unsigned long                                      bAlreadyMined : 1;                                		// 0x02AC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31663,7 +31663,7 @@ class USFXSeqEvt_VehicleMiningSuccess : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31677,7 +31677,7 @@ class USFXSeqEvt_VehicleMiningFailure : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31691,7 +31691,7 @@ class USFXSeqEvt_ReachedWaypoint : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31705,7 +31705,7 @@ class ASFXNav_ActionStationWP : public ASFXNav_WayPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31722,7 +31722,7 @@ public:
 	unsigned char                                      eStance;                                          		// 0x03A0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31737,7 +31737,7 @@ class ASFXProjectile_Repulsor : public ASFXProjectile_Explosive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31754,7 +31754,7 @@ public:
 	unsigned char                                      m_eCerberus3DStateChange;                         		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31769,7 +31769,7 @@ class USFXSeqAct_AttemptDeviceDetection : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31784,7 +31784,7 @@ class USFXSeqAct_AwardEndGameAchievements : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31803,7 +31803,7 @@ public:
 	unsigned char                                      TreasureType;                                     		// 0x0100 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31820,7 +31820,7 @@ public:
 	int                                                nState;                                           		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31837,7 +31837,7 @@ public:
 	class USFXPowerLevelUpHelper*                      m_Helper;                                         		// 0x00F8 (0x0008) [0x0000000004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31858,7 +31858,7 @@ public:
 	unsigned char                                      TreasureType;                                     		// 0x0108 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31903,7 +31903,7 @@ public:
 	unsigned long                                      m_bAllHenchmen : 1;                               		// 0x01C4 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31941,7 +31941,7 @@ class USFXSeqAct_CloseGalaxyMap : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31960,7 +31960,7 @@ public:
 	float                                              MaxDistanceFromActor;                             		// 0x0110 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31977,7 +31977,7 @@ public:
 	class AActor*                                      ActorToFollow;                                    		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31992,7 +31992,7 @@ class USFXSeqAct_ForceCombatOn : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32009,7 +32009,7 @@ public:
 	int                                                m_nEndID;                                         		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32030,7 +32030,7 @@ public:
 	unsigned char                                      oEventID;                                         		// 0x0110 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32049,7 +32049,7 @@ public:
 	int                                                nPriority;                                        		// 0x0100 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32064,7 +32064,7 @@ class USFXSeqAct_GetPropertyGeneric : public UBioSeqAct_GetProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32080,7 +32080,7 @@ public:
 	int                                                nTreasureId;                                      		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32108,7 +32108,7 @@ public:
 	unsigned char                                      m_TextAlign;                                      		// 0x012D (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32129,7 +32129,7 @@ class USFXSeqAct_InitMainMenu : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32148,7 +32148,7 @@ public:
 	int                                                srShepard;                                        		// 0x0128 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32166,7 +32166,7 @@ public:
 	unsigned long                                      bLinkEnvironment : 1;                             		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32184,7 +32184,7 @@ public:
 	class USeqVar_Bool*                                oCombatTargetBool;                                		// 0x0108 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32200,7 +32200,7 @@ class USFXSeqAct_MainMenu : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32215,7 +32215,7 @@ class USFXSeqAct_ModifyPropertyGeneric : public UBioSeqAct_ModifyProperty
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32230,7 +32230,7 @@ public:
 	FString                                            AreaName;                                         		// 0x00F8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32247,7 +32247,7 @@ public:
 	unsigned long                                      PreventDamage : 1;                                		// 0x0108 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32305,7 +32305,7 @@ public:
 	unsigned char                                      InitialResearchMode;                              		// 0x032B (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32355,7 +32355,7 @@ public:
 	unsigned long                                      m_bInstantTransition : 1;                         		// 0x0118 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32375,7 +32375,7 @@ public:
 	unsigned char                                      m_DoorType;                                       		// 0x0100 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32395,7 +32395,7 @@ public:
 	unsigned long                                      m_bResetPriorityToDefault : 1;                    		// 0x010C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32411,7 +32411,7 @@ public:
 	unsigned long                                      bVocState : 1;                                    		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32431,7 +32431,7 @@ public:
 	unsigned long                                      bCombatTargetableOverride : 1;                    		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32448,7 +32448,7 @@ public:
 	int                                                srValue;                                          		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32468,7 +32468,7 @@ public:
 	unsigned char                                      TreasureType;                                     		// 0x0100 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32484,7 +32484,7 @@ class USFXSeqAct_SetWeaponVisibility : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32500,7 +32500,7 @@ public:
 	unsigned long                                      m_bIsFinished : 1;                                		// 0x0110 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32520,7 +32520,7 @@ public:
 	unsigned char                                      OptionsGUIMode;                                   		// 0x0114 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32538,7 +32538,7 @@ class USFXSeqAct_ToggleAutoHints : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32554,7 +32554,7 @@ public:
 	unsigned char                                      ePowerTutorialType;                               		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32570,7 +32570,7 @@ class USFXSeqAct_ToggleSquadScreenMessages : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32585,7 +32585,7 @@ class USFXSeqAct_ToggleTutorialEvents : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32600,7 +32600,7 @@ class USFXSeqAct_ToggleWeaponWheelTutorial : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32615,7 +32615,7 @@ class USFXSeqAct_UnloadCharacterCreationMovies : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32630,7 +32630,7 @@ class USFXSeqAct_UpdateN7Achievements : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32646,7 +32646,7 @@ public:
 	int                                                VideoWatched;                                     		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32663,7 +32663,7 @@ public:
 	FString                                            sEntitlementGroup;                                		// 0x00EC (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32679,7 +32679,7 @@ public:
 	class AActor*                                      Player;                                           		// 0x00DC (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32694,7 +32694,7 @@ class USFXSFHandler_PCAreaMap : public USFXSFHandler_AreaMap
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32710,7 +32710,7 @@ class USFXSFHandler_PCEANetworking : public USFXSFHandler_EANetworking
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32725,7 +32725,7 @@ class USFXSFHandler_PCHUD : public USFXSFHandler_HUD
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32740,7 +32740,7 @@ class USFXSFHandler_PCLoad : public USFXSFHandler_Load
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32756,7 +32756,7 @@ public:
 	unsigned long                                      bRotationEnabled : 1;                             		// 0x012C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32773,7 +32773,7 @@ class USFXSFHandler_PCSave : public USFXSFHandler_Save
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32788,7 +32788,7 @@ class USFXSFHandler_PCSlideshow : public USFXSFHandler_Slideshow
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32802,7 +32802,7 @@ class USFXSFHandler_PS3Achievement : public UBioSFHandler_Achievement
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32816,7 +32816,7 @@ class USFXSFHandler_PS3EANetworking : public USFXSFHandler_EANetworking
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32830,7 +32830,7 @@ class USFXSFHandler_PS3MainMenu : public UBioSFHandler_MainMenu
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32858,7 +32858,7 @@ class USFXSFHandler_PS3NewCharacter : public UBioSFHandler_NewCharacter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32872,7 +32872,7 @@ class USFXSFHandler_PS3Options : public UBioSFHandler_Options
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32886,7 +32886,7 @@ class USFXSFHandler_PS3Personalization : public USFXSFHandler_Personalization
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32900,7 +32900,7 @@ class ASFXShield_ArmoredDoor : public ASFXShield_Armour
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32916,7 +32916,7 @@ public:
 	float                                              DamageGateInterval;                               		// 0x0400 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32933,7 +32933,7 @@ public:
 	float                                              DamageGateInterval;                               		// 0x0400 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32950,7 +32950,7 @@ public:
 	float                                              DamageGateInterval;                               		// 0x0400 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32965,7 +32965,7 @@ class ASFXShield_GethEnergy : public ASFXShield_Energy
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32979,7 +32979,7 @@ class ASFXShield_GethEnergy_Player : public ASFXShield_Energy_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32994,7 +32994,7 @@ class ASFXShield_Heavy : public ASFXShield_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33008,7 +33008,7 @@ class ASFXShield_Light : public ASFXShield_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33022,7 +33022,7 @@ class ASFXShield_Medium : public ASFXShield_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33036,7 +33036,7 @@ class ASFXShield_OrganicArmour : public ASFXShield_Armour
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33050,7 +33050,7 @@ class ASFXShield_ReaperArmour : public ASFXShield_Armour
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33064,7 +33064,7 @@ class ASFXShield_ScionArmour : public ASFXShield_Armour
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33078,7 +33078,7 @@ class ASFXSignText : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
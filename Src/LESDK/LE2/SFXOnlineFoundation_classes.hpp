@@ -238,7 +238,7 @@ public:
 	unsigned long                                      NeedsStateMachine : 1;                            		// 0x0090 (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -285,7 +285,7 @@ public:
 	unsigned char                                      Outcome;                                          		// 0x0082 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -322,7 +322,7 @@ public:
 	int                                                m_nInteger;                                       		// 0x0084 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -346,7 +346,7 @@ public:
 	unsigned char                                      LocalUserNum;                                     		// 0x00D0 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -361,7 +361,7 @@ public:
 	FString                                            StringData;                                       		// 0x0084 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -379,7 +379,7 @@ public:
 	int                                                m_nPriority;                                      		// 0x00A4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -398,7 +398,7 @@ public:
 	TArray<class USFXOnlineEvent*>                     EventList;                                        		// 0x0060 (0x0010) [0x0000000000500000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -419,7 +419,7 @@ class UISFXOnlineComponent : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -436,7 +436,7 @@ class UISFXOnlineComponentAchievement : public UISFXOnlineComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -454,7 +454,7 @@ class UISFXOnlineComponentAPI : public UISFXOnlineComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -468,7 +468,7 @@ class UISFXOnlineComponentLogin : public UISFXOnlineComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -526,7 +526,7 @@ class UISFXOnlineComponentNotification : public UISFXOnlineComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -552,7 +552,7 @@ class UISFXOnlineComponentPlatform : public UISFXOnlineComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -588,7 +588,7 @@ class UISFXOnlineComponentTelemetry : public UISFXOnlineComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -607,7 +607,7 @@ class UISFXOnlineComponentUserInterface : public UISFXOnlineComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -641,7 +641,7 @@ class USFXOnlineDefine : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -661,7 +661,7 @@ public:
 	unsigned long                                      mIsLoggedIn : 1;                                  		// 0x00C0 (0x0004) [0x0000000000001000] [0x00000002] ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -722,7 +722,7 @@ public:
 	struct FScriptDelegate                             __OnUnlockAchievementComplete__Delegate;          		// 0x04BC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -855,7 +855,7 @@ public:
 	struct FScriptDelegate                             __OnProfileDataChanged__Delegate;                 		// 0x013C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -908,7 +908,7 @@ public:
 	struct FScriptDelegate                             __OnReadTitleFileComplete__Delegate;              		// 0x0160 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -956,7 +956,7 @@ public:
 	struct FScriptDelegate                             __OnEvent__Delegate;                              		// 0x02B0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1006,7 +1006,7 @@ public:
 	unsigned long                                      SuggestPersonaNames : 1;                          		// 0x0330 (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1063,7 +1063,7 @@ public:
 	int                                                mGrantAchievementsTimeOut;                        		// 0x00E4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1085,7 +1085,7 @@ public:
 	FPointer                                           VfTable_IISFXOnlineComponentPlatform;             		// 0x0094 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1125,7 +1125,7 @@ public:
 	FPointer                                           VfTable_IISFXOnlineComponentAchievement;          		// 0x0094 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1156,7 +1156,7 @@ public:
 	TArray<FPointer>                                   OverlappedTasks;                                  		// 0x0108 (0x0010) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1198,7 +1198,7 @@ public:
 	FPointer                                           VfTable_IISFXOnlineComponentAchievement;          		// 0x0094 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1224,7 +1224,7 @@ public:
 	struct FScriptDelegate                             __OnSignInComplete__Delegate;                     		// 0x00B8 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1269,7 +1269,7 @@ public:
 	struct FMap_Mirror                                 AchievementMap;                                   		// 0x009C (0x0048) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1291,7 +1291,7 @@ public:
 	FPointer                                           VfTable_IISFXOnlineComponentPlatform;             		// 0x0094 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1335,7 +1335,7 @@ public:
 	struct FMap_Mirror                                 TrophyPackMap;                                    		// 0x00E4 (0x0048) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1357,7 +1357,7 @@ public:
 	FPointer                                           VfTable_IISFXOnlineComponentPlatform;             		// 0x0094 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1397,7 +1397,7 @@ class USFXOnlineComponentBlaze : public USFXOnlineComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1418,7 +1418,7 @@ public:
 	FPointer                                           BlazeNetworkAdapter;                              		// 0x00C8 (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1468,7 +1468,7 @@ public:
 	TArray<struct FSFXOfferDescriptor>                 PendingBuyOffers;                                 		// 0x0164 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1538,7 +1538,7 @@ class USFXOnlineComponentBlazeLoginPC : public USFXOnlineComponentBlazeLogin
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1561,7 +1561,7 @@ public:
 	unsigned long                                      RedeemedProductCode : 1;                          		// 0x0174 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1584,7 +1584,7 @@ class USFXOnlineComponentBlazeLoginXenon : public USFXOnlineComponentBlazeLogin
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1612,7 +1612,7 @@ public:
 	struct FSFXOnlineTargetOfferInfo                   CerberusOfferInfo;                                		// 0x00D4 (0x0020) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1662,7 +1662,7 @@ public:
 	struct FScriptDelegate                             __OnDisconnect__Delegate;                         		// 0x0128 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
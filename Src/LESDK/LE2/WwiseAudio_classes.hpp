@@ -59,7 +59,7 @@ class UActorFactoryWwiseAmbientSound : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -76,7 +76,7 @@ public:
 	unsigned long                                      bFollowActor : 1;                                 		// 0x0078 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -91,7 +91,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -106,7 +106,7 @@ public:
 	struct FWwiseRTPCForActorHandler                   m_RTPCHandler;                                    		// 0x0060 (0x001C) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -122,7 +122,7 @@ public:
 	unsigned long                                      m_bRequiresPreload : 1;                           		// 0x00A0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -137,7 +137,7 @@ public:
 	class UWwiseAudioComponent*                        m_pComponent;                                     		// 0x00A4 (0x0008) [0x0000000004082008]              ( CPF_ExportObject | CPF_Transient | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -152,7 +152,7 @@ public:
 	FString                                            Param;                                            		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -166,7 +166,7 @@ class USeqAct_WwiseLockMic : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -181,7 +181,7 @@ public:
 	class AWwiseMusicVolume*                           m_MusicVolume;                                    		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -197,7 +197,7 @@ public:
 	class AWwiseMusicVolume*                           m_MusicVolume;                                    		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -216,7 +216,7 @@ public:
 	TArray<class UWwiseAudioComponent*>                ActiveComponents;                                 		// 0x0124 (0x0010) [0x00000000044A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -232,7 +232,7 @@ public:
 	FString                                            Trigger;                                          		// 0x00F8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -250,7 +250,7 @@ public:
 	unsigned long                                      Running : 1;                                      		// 0x0130 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -266,7 +266,7 @@ public:
 	FString                                            State;                                            		// 0x0108 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -282,7 +282,7 @@ public:
 	FString                                            Switch;                                           		// 0x0108 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -296,7 +296,7 @@ class USeqAct_WwiseStartAudioObjects : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -310,7 +310,7 @@ class USeqAct_WwiseStopAll : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -329,7 +329,7 @@ public:
 	unsigned long                                      bIsPlaying : 1;                                   		// 0x02A4 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -372,7 +372,7 @@ public:
 	unsigned long                                      m_b3D : 1;                                        		// 0x0174 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -418,7 +418,7 @@ public:
 	unsigned long                                      IsDirty : 1;                                      		// 0x01CC (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -434,7 +434,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x19B ];                           		// 0x0335 (0x019B) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -452,7 +452,7 @@ public:
 	class UWwiseBank*                                  Bank;                                             		// 0x0090 (0x0008) [0x0000000000020003]              ( CPF_Edit | CPF_Const | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -466,7 +466,7 @@ class UWwiseComponentCallback : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -486,7 +486,7 @@ public:
 	unsigned long                                      bOverrideLowerPriorityEnvironments : 1;           		// 0x007C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -502,7 +502,7 @@ public:
 	float                                              Priority;                                         		// 0x02D4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -526,7 +526,7 @@ public:
 	unsigned long                                      m_bHasEnvironmentalSettings : 1;                  		// 0x008C (0x0004) [0x0000000000201000] [0x00000002] ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -541,7 +541,7 @@ public:
 	TArray<struct FWwiseDialogueArgument>              Arguments;                                        		// 0x0090 (0x0010) [0x0000000000420003]              ( CPF_Edit | CPF_Const | CPF_EditConst | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -557,7 +557,7 @@ public:
 	class UWwiseEvent*                                 Stop;                                             		// 0x0068 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -575,7 +575,7 @@ public:
 	class UWwiseEvent*                                 m_WwiseAudioEvent;                                		// 0x0078 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -592,7 +592,7 @@ public:
 	unsigned long                                      IsRegistered : 1;                                 		// 0x0074 (0x0004) [0x0000000000022003] [0x00000001] ( CPF_Edit | CPF_Const | CPF_Transient | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -610,7 +610,7 @@ public:
 	unsigned long                                      IsLocalised : 1;                                  		// 0x0090 (0x0004) [0x0000000000020003] [0x00000002] ( CPF_Edit | CPF_Const | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -626,7 +626,7 @@ public:
 	struct SFXName                                     BankName;                                         		// 0x0080 (0x0008) [0x0000000000020003]              ( CPF_Edit | CPF_Const | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -640,7 +640,7 @@ class AWwiseMicPosOrient : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -657,7 +657,7 @@ public:
 	class AWwiseVolumeTimer*                           m_oTrackTimer;                                    		// 0x02CC (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -678,7 +678,7 @@ public:
 	unsigned long                                      DrawSoundLocations : 1;                           		// 0x02EC (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -710,7 +710,7 @@ public:
 	unsigned long                                      m_bEnabled : 1;                                   		// 0x02FC (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -733,7 +733,7 @@ public:
 	class AWwiseVolume*                                m_oVolume;                                        		// 0x028C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -748,7 +748,7 @@ class UActorFactoryWwiseDistanceRTPC : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -765,7 +765,7 @@ public:
 	float                                              m_fTimeSinceLastUpdate;                           		// 0x02A0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -780,7 +780,7 @@ class UActorFactoryWwiseMicPosOrient : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -794,7 +794,7 @@ class AWwiseOcclusionVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
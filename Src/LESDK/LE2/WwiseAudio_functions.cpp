@@ -28,110 +28,83 @@
 
 
 
-class UClass* UActorFactoryWwiseAmbientSound::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UActorFactoryWwiseAmbientSound::pClassPointer { L"Class WwiseAudio.ActorFactoryWwiseAmbientSound", &UObject::FindClass };
 
 class UClass* UActorFactoryWwiseAmbientSound::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.ActorFactoryWwiseAmbientSound" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UAnimNotify_WwiseEvent::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UAnimNotify_WwiseEvent::pClassPointer { L"Class WwiseAudio.AnimNotify_WwiseEvent", &UObject::FindClass };
 
 class UClass* UAnimNotify_WwiseEvent::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.AnimNotify_WwiseEvent" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UInterpTrackInstWwiseEvent::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UInterpTrackInstWwiseEvent::pClassPointer { L"Class WwiseAudio.InterpTrackInstWwiseEvent", &UObject::FindClass };
 
 class UClass* UInterpTrackInstWwiseEvent::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.InterpTrackInstWwiseEvent" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UInterpTrackInstWwiseRTPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UInterpTrackInstWwiseRTPC::pClassPointer { L"Class WwiseAudio.InterpTrackInstWwiseRTPC", &UObject::FindClass };
 
 class UClass* UInterpTrackInstWwiseRTPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.InterpTrackInstWwiseRTPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UInterpTrackWwiseEvent::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UInterpTrackWwiseEvent::pClassPointer { L"Class WwiseAudio.InterpTrackWwiseEvent", &UObject::FindClass };
 
 class UClass* UInterpTrackWwiseEvent::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.InterpTrackWwiseEvent" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UInterpTrackWwiseSoundEffect::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UInterpTrackWwiseSoundEffect::pClassPointer { L"Class WwiseAudio.InterpTrackWwiseSoundEffect", &UObject::FindClass };
 
 class UClass* UInterpTrackWwiseSoundEffect::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.InterpTrackWwiseSoundEffect" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UInterpTrackWwiseRTPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UInterpTrackWwiseRTPC::pClassPointer { L"Class WwiseAudio.InterpTrackWwiseRTPC", &UObject::FindClass };
 
 class UClass* UInterpTrackWwiseRTPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.InterpTrackWwiseRTPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USeqAct_WwiseLockMic::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USeqAct_WwiseLockMic::pClassPointer { L"Class WwiseAudio.SeqAct_WwiseLockMic", &UObject::FindClass };
 
 class UClass* USeqAct_WwiseLockMic::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.SeqAct_WwiseLockMic" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USeqAct_WwiseMusicVolumeDisable::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USeqAct_WwiseMusicVolumeDisable::pClassPointer { L"Class WwiseAudio.SeqAct_WwiseMusicVolumeDisable", &UObject::FindClass };
 
 class UClass* USeqAct_WwiseMusicVolumeDisable::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.SeqAct_WwiseMusicVolumeDisable" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function WwiseAudio.SeqAct_WwiseMusicVolumeDisable.GetObjClassVersion
@@ -141,10 +114,9 @@ class UClass* USeqAct_WwiseMusicVolumeDisable::StaticClass()
 
 int USeqAct_WwiseMusicVolumeDisable::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function WwiseAudio.SeqAct_WwiseMusicVolumeDisable.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function WwiseAudio.SeqAct_WwiseMusicVolumeDisable.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USeqAct_WwiseMusicVolumeDisable_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -155,14 +127,11 @@ int USeqAct_WwiseMusicVolumeDisable::eventGetObjClassVersion ( )
 
 
 
-class UClass* USeqAct_WwiseMusicVolumeEnable::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USeqAct_WwiseMusicVolumeEnable::pClassPointer { L"Class WwiseAudio.SeqAct_WwiseMusicVolumeEnable", &UObject::FindClass };
 
 class UClass* USeqAct_WwiseMusicVolumeEnable::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.SeqAct_WwiseMusicVolumeEnable" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function WwiseAudio.SeqAct_WwiseMusicVolumeEnable.GetObjClassVersion
@@ -172,10 +141,9 @@ class UClass* USeqAct_WwiseMusicVolumeEnable::StaticClass()
 
 int USeqAct_WwiseMusicVolumeEnable::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function WwiseAudio.SeqAct_WwiseMusicVolumeEnable.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function WwiseAudio.SeqAct_WwiseMusicVolumeEnable.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USeqAct_WwiseMusicVolumeEnable_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -186,14 +154,11 @@ int USeqAct_WwiseMusicVolumeEnable::eventGetObjClassVersion ( )
 
 
 
-class UClass* USeqAct_WwisePostEvent::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USeqAct_WwisePostEvent::pClassPointer { L"Class WwiseAudio.SeqAct_WwisePostEvent", &UObject::FindClass };
 
 class UClass* USeqAct_WwisePostEvent::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.SeqAct_WwisePostEvent" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function WwiseAudio.SeqAct_WwisePostEvent.GetObjClassVersion
@@ -203,10 +168,9 @@ class UClass* USeqAct_WwisePostEvent::StaticClass()
 
 int USeqAct_WwisePostEvent::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function WwiseAudio.SeqAct_WwisePostEvent.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function WwiseAudio.SeqAct_WwisePostEvent.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USeqAct_WwisePostEvent_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -217,98 +181,74 @@ int USeqAct_WwisePostEvent::eventGetObjClassVersion ( )
 
 
 
-class UClass* USeqAct_WwisePostTrigger::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USeqAct_WwisePostTrigger::pClassPointer { L"Class WwiseAudio.SeqAct_WwisePostTrigger", &UObject::FindClass };
 
 class UClass* USeqAct_WwisePostTrigger::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.SeqAct_WwisePostTrigger" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USeqAct_WwiseSetRTPCValue::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USeqAct_WwiseSetRTPCValue::pClassPointer { L"Class WwiseAudio.SeqAct_WwiseSetRTPCValue", &UObject::FindClass };
 
 class UClass* USeqAct_WwiseSetRTPCValue::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.SeqAct_WwiseSetRTPCValue" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USeqAct_WwiseSetState::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USeqAct_WwiseSetState::pClassPointer { L"Class WwiseAudio.SeqAct_WwiseSetState", &UObject::FindClass };
 
 class UClass* USeqAct_WwiseSetState::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.SeqAct_WwiseSetState" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USeqAct_WwiseSetSwitch::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USeqAct_WwiseSetSwitch::pClassPointer { L"Class WwiseAudio.SeqAct_WwiseSetSwitch", &UObject::FindClass };
 
 class UClass* USeqAct_WwiseSetSwitch::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.SeqAct_WwiseSetSwitch" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USeqAct_WwiseStartAudioObjects::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USeqAct_WwiseStartAudioObjects::pClassPointer { L"Class WwiseAudio.SeqAct_WwiseStartAudioObjects", &UObject::FindClass };
 
 class UClass* USeqAct_WwiseStartAudioObjects::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.SeqAct_WwiseStartAudioObjects" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USeqAct_WwiseStopAll::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USeqAct_WwiseStopAll::pClassPointer { L"Class WwiseAudio.SeqAct_WwiseStopAll", &UObject::FindClass };
 
 class UClass* USeqAct_WwiseStopAll::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.SeqAct_WwiseStopAll" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* AWwiseAmbientSound::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> AWwiseAmbientSound::pClassPointer { L"Class WwiseAudio.WwiseAmbientSound", &UObject::FindClass };
 
 class UClass* AWwiseAmbientSound::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseAmbientSound" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UWwiseAudioComponent::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWwiseAudioComponent::pClassPointer { L"Class WwiseAudio.WwiseAudioComponent", &UObject::FindClass };
 
 class UClass* UWwiseAudioComponent::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseAudioComponent" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function WwiseAudio.WwiseAudioComponent.SetLocation
@@ -318,10 +258,9 @@ class UClass* UWwiseAudioComponent::StaticClass()
 
 void UWwiseAudioComponent::SetLocation ( struct FVector const& NewLocation )
 {
-	static UFunction* pFnSetLocation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetLocationRef { L"Function WwiseAudio.WwiseAudioComponent.SetLocation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetLocation )
-		pFnSetLocation = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.SetLocation" );
+	UFunction* const pFnSetLocation = pFnSetLocationRef.Get ( );
 
 	UWwiseAudioComponent_execSetLocation_Parms SetLocation_Parms;
 	memcpy ( &SetLocation_Parms.NewLocation, &NewLocation, 0xC );
@@ -335,18 +274,14 @@ void UWwiseAudioComponent::SetLocation ( struct FVector const& NewLocation )
 
 void UWwiseAudioComponent::Set3D ( )
 {
-	static UFunction* pFnSet3D = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSet3DRef { L"Function WwiseAudio.WwiseAudioComponent.Set3D", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSet3D )
-		pFnSet3D = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.Set3D" );
+	UFunction* const pFnSet3D = pFnSet3DRef.Get ( );
 
 	UWwiseAudioComponent_execSet3D_Parms Set3D_Parms;
 
-	pFnSet3D->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSet3D, &Set3D_Parms, NULL );
-
-	pFnSet3D->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSet3D, &Set3D_Parms ) )
+		this->ProcessEvent ( pFnSet3D, &Set3D_Parms, NULL );
 };
 
 // Function WwiseAudio.WwiseAudioComponent.Set2D
@@ -355,18 +290,14 @@ void UWwiseAudioComponent::Set3D ( )
 
 void UWwiseAudioComponent::Set2D ( )
 {
-	static UFunction* pFnSet2D = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSet2DRef { L"Function WwiseAudio.WwiseAudioComponent.Set2D", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSet2D )
-		pFnSet2D = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.Set2D" );
+	UFunction* const pFnSet2D = pFnSet2DRef.Get ( );
 
 	UWwiseAudioComponent_execSet2D_Parms Set2D_Parms;
 
-	pFnSet2D->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSet2D, &Set2D_Parms, NULL );
-
-	pFnSet2D->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSet2D, &Set2D_Parms ) )
+		this->ProcessEvent ( pFnSet2D, &Set2D_Parms, NULL );
 };
 
 // Function WwiseAudio.WwiseAudioComponent.RegisterGameObject
@@ -377,19 +308,15 @@ void UWwiseAudioComponent::Set2D ( )
 
 bool UWwiseAudioComponent::RegisterGameObject ( FString const& GameObjectName )
 {
-	static UFunction* pFnRegisterGameObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRegisterGameObjectRef { L"Function WwiseAudio.WwiseAudioComponent.RegisterGameObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRegisterGameObject )
-		pFnRegisterGameObject = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.RegisterGameObject" );
+	UFunction* const pFnRegisterGameObject = pFnRegisterGameObjectRef.Get ( );
 
 	UWwiseAudioComponent_execRegisterGameObject_Parms RegisterGameObject_Parms;
 	memcpy ( &RegisterGameObject_Parms.GameObjectName, &GameObjectName, 0x10 );
 
-	pFnRegisterGameObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnRegisterGameObject, &RegisterGameObject_Parms, NULL );
-
-	pFnRegisterGameObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnRegisterGameObject, &RegisterGameObject_Parms ) )
+		this->ProcessEvent ( pFnRegisterGameObject, &RegisterGameObject_Parms, NULL );
 
 	return RegisterGameObject_Parms.ReturnValue;
 };
@@ -401,18 +328,14 @@ bool UWwiseAudioComponent::RegisterGameObject ( FString const& GameObjectName )
 
 bool UWwiseAudioComponent::UnregisterGameObject ( )
 {
-	static UFunction* pFnUnregisterGameObject = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnregisterGameObjectRef { L"Function WwiseAudio.WwiseAudioComponent.UnregisterGameObject", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnregisterGameObject )
-		pFnUnregisterGameObject = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.UnregisterGameObject" );
+	UFunction* const pFnUnregisterGameObject = pFnUnregisterGameObjectRef.Get ( );
 
 	UWwiseAudioComponent_execUnregisterGameObject_Parms UnregisterGameObject_Parms;
 
-	pFnUnregisterGameObject->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnUnregisterGameObject, &UnregisterGameObject_Parms, NULL );
-
-	pFnUnregisterGameObject->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnUnregisterGameObject, &UnregisterGameObject_Parms ) )
+		this->ProcessEvent ( pFnUnregisterGameObject, &UnregisterGameObject_Parms, NULL );
 
 	return UnregisterGameObject_Parms.ReturnValue;
 };
@@ -424,18 +347,14 @@ bool UWwiseAudioComponent::UnregisterGameObject ( )
 
 float UWwiseAudioComponent::GetDistanceToListener ( )
 {
-	static UFunction* pFnGetDistanceToListener = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDistanceToListenerRef { L"Function WwiseAudio.WwiseAudioComponent.GetDistanceToListener", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDistanceToListener )
-		pFnGetDistanceToListener = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.GetDistanceToListener" );
+	UFunction* const pFnGetDistanceToListener = pFnGetDistanceToListenerRef.Get ( );
 
 	UWwiseAudioComponent_execGetDistanceToListener_Parms GetDistanceToListener_Parms;
 
-	pFnGetDistanceToListener->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetDistanceToListener, &GetDistanceToListener_Parms, NULL );
-
-	pFnGetDistanceToListener->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetDistanceToListener, &GetDistanceToListener_Parms ) )
+		this->ProcessEvent ( pFnGetDistanceToListener, &GetDistanceToListener_Parms, NULL );
 
 	return GetDistanceToListener_Parms.ReturnValue;
 };
@@ -447,19 +366,15 @@ float UWwiseAudioComponent::GetDistanceToListener ( )
 
 void UWwiseAudioComponent::SetObstructionOcclusionEnabled ( unsigned long i_bValue )
 {
-	static UFunction* pFnSetObstructionOcclusionEnabled = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetObstructionOcclusionEnabledRef { L"Function WwiseAudio.WwiseAudioComponent.SetObstructionOcclusionEnabled", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetObstructionOcclusionEnabled )
-		pFnSetObstructionOcclusionEnabled = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.SetObstructionOcclusionEnabled" );
+	UFunction* const pFnSetObstructionOcclusionEnabled = pFnSetObstructionOcclusionEnabledRef.Get ( );
 
 	UWwiseAudioComponent_execSetObstructionOcclusionEnabled_Parms SetObstructionOcclusionEnabled_Parms;
 	SetObstructionOcclusionEnabled_Parms.i_bValue = i_bValue;
 
-	pFnSetObstructionOcclusionEnabled->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetObstructionOcclusionEnabled, &SetObstructionOcclusionEnabled_Parms, NULL );
-
-	pFnSetObstructionOcclusionEnabled->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetObstructionOcclusionEnabled, &SetObstructionOcclusionEnabled_Parms ) )
+		this->ProcessEvent ( pFnSetObstructionOcclusionEnabled, &SetObstructionOcclusionEnabled_Parms, NULL );
 };
 
 // Function WwiseAudio.WwiseAudioComponent.SetEnvironmentalAudioEnabled
@@ -469,19 +384,15 @@ void UWwiseAudioComponent::SetObstructionOcclusionEnabled ( unsigned long i_bVal
 
 void UWwiseAudioComponent::SetEnvironmentalAudioEnabled ( unsigned long i_bValue )
 {
-	static UFunction* pFnSetEnvironmentalAudioEnabled = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetEnvironmentalAudioEnabledRef { L"Function WwiseAudio.WwiseAudioComponent.SetEnvironmentalAudioEnabled", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetEnvironmentalAudioEnabled )
-		pFnSetEnvironmentalAudioEnabled = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.SetEnvironmentalAudioEnabled" );
+	UFunction* const pFnSetEnvironmentalAudioEnabled = pFnSetEnvironmentalAudioEnabledRef.Get ( );
 
 	UWwiseAudioComponent_execSetEnvironmentalAudioEnabled_Parms SetEnvironmentalAudioEnabled_Parms;
 	SetEnvironmentalAudioEnabled_Parms.i_bValue = i_bValue;
 
-	pFnSetEnvironmentalAudioEnabled->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetEnvironmentalAudioEnabled, &SetEnvironmentalAudioEnabled_Parms, NULL );
-
-	pFnSetEnvironmentalAudioEnabled->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetEnvironmentalAudioEnabled, &SetEnvironmentalAudioEnabled_Parms ) )
+		this->ProcessEvent ( pFnSetEnvironmentalAudioEnabled, &SetEnvironmentalAudioEnabled_Parms, NULL );
 };
 
 // Function WwiseAudio.WwiseAudioComponent.GetObstructionOcclusionEnabled
@@ -491,18 +402,14 @@ void UWwiseAudioComponent::SetEnvironmentalAudioEnabled ( unsigned long i_bValue
 
 bool UWwiseAudioComponent::GetObstructionOcclusionEnabled ( )
 {
-	static UFunction* pFnGetObstructionOcclusionEnabled = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObstructionOcclusionEnabledRef { L"Function WwiseAudio.WwiseAudioComponent.GetObstructionOcclusionEnabled", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObstructionOcclusionEnabled )
-		pFnGetObstructionOcclusionEnabled = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.GetObstructionOcclusionEnabled" );
+	UFunction* const pFnGetObstructionOcclusionEnabled = pFnGetObstructionOcclusionEnabledRef.Get ( );
 
 	UWwiseAudioComponent_execGetObstructionOcclusionEnabled_Parms GetObstructionOcclusionEnabled_Parms;
 
-	pFnGetObstructionOcclusionEnabled->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetObstructionOcclusionEnabled, &GetObstructionOcclusionEnabled_Parms, NULL );
-
-	pFnGetObstructionOcclusionEnabled->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetObstructionOcclusionEnabled, &GetObstructionOcclusionEnabled_Parms ) )
+		this->ProcessEvent ( pFnGetObstructionOcclusionEnabled, &GetObstructionOcclusionEnabled_Parms, NULL );
 
 	return GetObstructionOcclusionEnabled_Parms.ReturnValue;
 };
@@ -514,18 +421,14 @@ bool UWwiseAudioComponent::GetObstructionOcclusionEnabled ( )
 
 bool UWwiseAudioComponent::GetEnvironmentalAudioEnabled ( )
 {
-	static UFunction* pFnGetEnvironmentalAudioEnabled = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEnvironmentalAudioEnabledRef { L"Function WwiseAudio.WwiseAudioComponent.GetEnvironmentalAudioEnabled", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEnvironmentalAudioEnabled )
-		pFnGetEnvironmentalAudioEnabled = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.GetEnvironmentalAudioEnabled" );
+	UFunction* const pFnGetEnvironmentalAudioEnabled = pFnGetEnvironmentalAudioEnabledRef.Get ( );
 
 	UWwiseAudioComponent_execGetEnvironmentalAudioEnabled_Parms GetEnvironmentalAudioEnabled_Parms;
 
-	pFnGetEnvironmentalAudioEnabled->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetEnvironmentalAudioEnabled, &GetEnvironmentalAudioEnabled_Parms, NULL );
-
-	pFnGetEnvironmentalAudioEnabled->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetEnvironmentalAudioEnabled, &GetEnvironmentalAudioEnabled_Parms ) )
+		this->ProcessEvent ( pFnGetEnvironmentalAudioEnabled, &GetEnvironmentalAudioEnabled_Parms, NULL );
 
 	return GetEnvironmentalAudioEnabled_Parms.ReturnValue;
 };
@@ -537,18 +440,14 @@ bool UWwiseAudioComponent::GetEnvironmentalAudioEnabled ( )
 
 struct FVector UWwiseAudioComponent::GetMicPosition ( )
 {
-	static UFunction* pFnGetMicPosition = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetMicPositionRef { L"Function WwiseAudio.WwiseAudioComponent.GetMicPosition", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetMicPosition )
-		pFnGetMicPosition = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.GetMicPosition" );
+	UFunction* const pFnGetMicPosition = pFnGetMicPositionRef.Get ( );
 
 	UWwiseAudioComponent_execGetMicPosition_Parms GetMicPosition_Parms;
 
-	pFnGetMicPosition->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetMicPosition, &GetMicPosition_Parms, NULL );
-
-	pFnGetMicPosition->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetMicPosition, &GetMicPosition_Parms ) )
+		this->ProcessEvent ( pFnGetMicPosition, &GetMicPosition_Parms, NULL );
 
 	return GetMicPosition_Parms.ReturnValue;
 };
@@ -562,20 +461,16 @@ struct FVector UWwiseAudioComponent::GetMicPosition ( )
 
 bool UWwiseAudioComponent::SetGlobalRTPCFromScript ( FString const& in_pszRtpcName, float in_value )
 {
-	static UFunction* pFnSetGlobalRTPCFromScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetGlobalRTPCFromScriptRef { L"Function WwiseAudio.WwiseAudioComponent.SetGlobalRTPCFromScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetGlobalRTPCFromScript )
-		pFnSetGlobalRTPCFromScript = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.SetGlobalRTPCFromScript" );
+	UFunction* const pFnSetGlobalRTPCFromScript = pFnSetGlobalRTPCFromScriptRef.Get ( );
 
 	UWwiseAudioComponent_execSetGlobalRTPCFromScript_Parms SetGlobalRTPCFromScript_Parms;
 	memcpy ( &SetGlobalRTPCFromScript_Parms.in_pszRtpcName, &in_pszRtpcName, 0x10 );
 	SetGlobalRTPCFromScript_Parms.in_value = in_value;
 
-	pFnSetGlobalRTPCFromScript->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetGlobalRTPCFromScript, &SetGlobalRTPCFromScript_Parms, NULL );
-
-	pFnSetGlobalRTPCFromScript->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetGlobalRTPCFromScript, &SetGlobalRTPCFromScript_Parms ) )
+		this->ProcessEvent ( pFnSetGlobalRTPCFromScript, &SetGlobalRTPCFromScript_Parms, NULL );
 
 	return SetGlobalRTPCFromScript_Parms.ReturnValue;
 };
@@ -592,10 +487,9 @@ bool UWwiseAudioComponent::SetGlobalRTPCFromScript ( FString const& in_pszRtpcNa
 
 class UWwiseAudioComponent* UWwiseAudioComponent::CreateComponentFromScript ( class AActor* pActor, FString const& Label, struct SFXName ComponentGroup, struct SFXName AttachBone, unsigned long bRegister )
 {
-	static UFunction* pFnCreateComponentFromScript = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCreateComponentFromScriptRef { L"Function WwiseAudio.WwiseAudioComponent.CreateComponentFromScript", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCreateComponentFromScript )
-		pFnCreateComponentFromScript = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.CreateComponentFromScript" );
+	UFunction* const pFnCreateComponentFromScript = pFnCreateComponentFromScriptRef.Get ( );
 
 	UWwiseAudioComponent_execCreateComponentFromScript_Parms CreateComponentFromScript_Parms;
 	CreateComponentFromScript_Parms.pActor = pActor;
@@ -604,11 +498,8 @@ class UWwiseAudioComponent* UWwiseAudioComponent::CreateComponentFromScript ( cl
 	memcpy ( &CreateComponentFromScript_Parms.AttachBone, &AttachBone, 0x8 );
 	CreateComponentFromScript_Parms.bRegister = bRegister;
 
-	pFnCreateComponentFromScript->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCreateComponentFromScript, &CreateComponentFromScript_Parms, NULL );
-
-	pFnCreateComponentFromScript->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCreateComponentFromScript, &CreateComponentFromScript_Parms ) )
+		this->ProcessEvent ( pFnCreateComponentFromScript, &CreateComponentFromScript_Parms, NULL );
 
 	return CreateComponentFromScript_Parms.ReturnValue;
 };
@@ -621,19 +512,15 @@ class UWwiseAudioComponent* UWwiseAudioComponent::CreateComponentFromScript ( cl
 
 bool UWwiseAudioComponent::IsEventPlaying ( int WwisePlayingID )
 {
-	static UFunction* pFnIsEventPlaying = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsEventPlayingRef { L"Function WwiseAudio.WwiseAudioComponent.IsEventPlaying", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsEventPlaying )
-		pFnIsEventPlaying = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.IsEventPlaying" );
+	UFunction* const pFnIsEventPlaying = pFnIsEventPlayingRef.Get ( );
 
 	UWwiseAudioComponent_execIsEventPlaying_Parms IsEventPlaying_Parms;
 	IsEventPlaying_Parms.WwisePlayingID = WwisePlayingID;
 
-	pFnIsEventPlaying->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsEventPlaying, &IsEventPlaying_Parms, NULL );
-
-	pFnIsEventPlaying->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsEventPlaying, &IsEventPlaying_Parms ) )
+		this->ProcessEvent ( pFnIsEventPlaying, &IsEventPlaying_Parms, NULL );
 
 	return IsEventPlaying_Parms.ReturnValue;
 };
@@ -646,19 +533,15 @@ bool UWwiseAudioComponent::IsEventPlaying ( int WwisePlayingID )
 
 bool UWwiseAudioComponent::IsPlaying ( class UWwiseBaseSoundObject* Event )
 {
-	static UFunction* pFnIsPlaying = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsPlayingRef { L"Function WwiseAudio.WwiseAudioComponent.IsPlaying", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsPlaying )
-		pFnIsPlaying = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.IsPlaying" );
+	UFunction* const pFnIsPlaying = pFnIsPlayingRef.Get ( );
 
 	UWwiseAudioComponent_execIsPlaying_Parms IsPlaying_Parms;
 	IsPlaying_Parms.Event = Event;
 
-	pFnIsPlaying->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnIsPlaying, &IsPlaying_Parms, NULL );
-
-	pFnIsPlaying->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnIsPlaying, &IsPlaying_Parms ) )
+		this->ProcessEvent ( pFnIsPlaying, &IsPlaying_Parms, NULL );
 
 	return IsPlaying_Parms.ReturnValue;
 };
@@ -671,19 +554,15 @@ bool UWwiseAudioComponent::IsPlaying ( class UWwiseBaseSoundObject* Event )
 
 bool UWwiseAudioComponent::PostGlobalEvent ( struct SFXName GlobalEventName )
 {
-	static UFunction* pFnPostGlobalEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPostGlobalEventRef { L"Function WwiseAudio.WwiseAudioComponent.PostGlobalEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPostGlobalEvent )
-		pFnPostGlobalEvent = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.PostGlobalEvent" );
+	UFunction* const pFnPostGlobalEvent = pFnPostGlobalEventRef.Get ( );
 
 	UWwiseAudioComponent_execPostGlobalEvent_Parms PostGlobalEvent_Parms;
 	memcpy ( &PostGlobalEvent_Parms.GlobalEventName, &GlobalEventName, 0x8 );
 
-	pFnPostGlobalEvent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnPostGlobalEvent, &PostGlobalEvent_Parms, NULL );
-
-	pFnPostGlobalEvent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnPostGlobalEvent, &PostGlobalEvent_Parms ) )
+		this->ProcessEvent ( pFnPostGlobalEvent, &PostGlobalEvent_Parms, NULL );
 
 	return PostGlobalEvent_Parms.ReturnValue;
 };
@@ -696,19 +575,15 @@ bool UWwiseAudioComponent::PostGlobalEvent ( struct SFXName GlobalEventName )
 
 bool UWwiseAudioComponent::SetWwiseTrigger ( FString const& sTrigger )
 {
-	static UFunction* pFnSetWwiseTrigger = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetWwiseTriggerRef { L"Function WwiseAudio.WwiseAudioComponent.SetWwiseTrigger", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetWwiseTrigger )
-		pFnSetWwiseTrigger = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.SetWwiseTrigger" );
+	UFunction* const pFnSetWwiseTrigger = pFnSetWwiseTriggerRef.Get ( );
 
 	UWwiseAudioComponent_execSetWwiseTrigger_Parms SetWwiseTrigger_Parms;
 	memcpy ( &SetWwiseTrigger_Parms.sTrigger, &sTrigger, 0x10 );
 
-	pFnSetWwiseTrigger->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetWwiseTrigger, &SetWwiseTrigger_Parms, NULL );
-
-	pFnSetWwiseTrigger->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetWwiseTrigger, &SetWwiseTrigger_Parms ) )
+		this->ProcessEvent ( pFnSetWwiseTrigger, &SetWwiseTrigger_Parms, NULL );
 
 	return SetWwiseTrigger_Parms.ReturnValue;
 };
@@ -722,20 +597,16 @@ bool UWwiseAudioComponent::SetWwiseTrigger ( FString const& sTrigger )
 
 bool UWwiseAudioComponent::SetWwiseSwitch ( FString const& sGroup, FString const& sState )
 {
-	static UFunction* pFnSetWwiseSwitch = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetWwiseSwitchRef { L"Function WwiseAudio.WwiseAudioComponent.SetWwiseSwitch", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetWwiseSwitch )
-		pFnSetWwiseSwitch = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.SetWwiseSwitch" );
+	UFunction* const pFnSetWwiseSwitch = pFnSetWwiseSwitchRef.Get ( );
 
 	UWwiseAudioComponent_execSetWwiseSwitch_Parms SetWwiseSwitch_Parms;
 	memcpy ( &SetWwiseSwitch_Parms.sGroup, &sGroup, 0x10 );
 	memcpy ( &SetWwiseSwitch_Parms.sState, &sState, 0x10 );
 
-	pFnSetWwiseSwitch->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetWwiseSwitch, &SetWwiseSwitch_Parms, NULL );
-
-	pFnSetWwiseSwitch->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetWwiseSwitch, &SetWwiseSwitch_Parms ) )
+		this->ProcessEvent ( pFnSetWwiseSwitch, &SetWwiseSwitch_Parms, NULL );
 
 	return SetWwiseSwitch_Parms.ReturnValue;
 };
@@ -749,20 +620,16 @@ bool UWwiseAudioComponent::SetWwiseSwitch ( FString const& sGroup, FString const
 
 bool UWwiseAudioComponent::SetWwiseRTPCs ( TArray<FString> const& sName, TArray<float> const& fValue )
 {
-	static UFunction* pFnSetWwiseRTPCs = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetWwiseRTPCsRef { L"Function WwiseAudio.WwiseAudioComponent.SetWwiseRTPCs", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetWwiseRTPCs )
-		pFnSetWwiseRTPCs = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.SetWwiseRTPCs" );
+	UFunction* const pFnSetWwiseRTPCs = pFnSetWwiseRTPCsRef.Get ( );
 
 	UWwiseAudioComponent_execSetWwiseRTPCs_Parms SetWwiseRTPCs_Parms;
 	memcpy ( &SetWwiseRTPCs_Parms.sName, &sName, 0x10 );
 	memcpy ( &SetWwiseRTPCs_Parms.fValue, &fValue, 0x10 );
 
-	pFnSetWwiseRTPCs->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetWwiseRTPCs, &SetWwiseRTPCs_Parms, NULL );
-
-	pFnSetWwiseRTPCs->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetWwiseRTPCs, &SetWwiseRTPCs_Parms ) )
+		this->ProcessEvent ( pFnSetWwiseRTPCs, &SetWwiseRTPCs_Parms, NULL );
 
 	return SetWwiseRTPCs_Parms.ReturnValue;
 };
@@ -776,20 +643,16 @@ bool UWwiseAudioComponent::SetWwiseRTPCs ( TArray<FString> const& sName, TArray<
 
 bool UWwiseAudioComponent::SetWwiseRTPC ( FString const& sName, float fValue )
 {
-	static UFunction* pFnSetWwiseRTPC = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetWwiseRTPCRef { L"Function WwiseAudio.WwiseAudioComponent.SetWwiseRTPC", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetWwiseRTPC )
-		pFnSetWwiseRTPC = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.SetWwiseRTPC" );
+	UFunction* const pFnSetWwiseRTPC = pFnSetWwiseRTPCRef.Get ( );
 
 	UWwiseAudioComponent_execSetWwiseRTPC_Parms SetWwiseRTPC_Parms;
 	memcpy ( &SetWwiseRTPC_Parms.sName, &sName, 0x10 );
 	SetWwiseRTPC_Parms.fValue = fValue;
 
-	pFnSetWwiseRTPC->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetWwiseRTPC, &SetWwiseRTPC_Parms, NULL );
-
-	pFnSetWwiseRTPC->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetWwiseRTPC, &SetWwiseRTPC_Parms ) )
+		this->ProcessEvent ( pFnSetWwiseRTPC, &SetWwiseRTPC_Parms, NULL );
 
 	return SetWwiseRTPC_Parms.ReturnValue;
 };
@@ -802,19 +665,15 @@ bool UWwiseAudioComponent::SetWwiseRTPC ( FString const& sName, float fValue )
 
 bool UWwiseAudioComponent::Stop ( class UWwiseBaseSoundObject* Base )
 {
-	static UFunction* pFnStop = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopRef { L"Function WwiseAudio.WwiseAudioComponent.Stop", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStop )
-		pFnStop = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.Stop" );
+	UFunction* const pFnStop = pFnStopRef.Get ( );
 
 	UWwiseAudioComponent_execStop_Parms Stop_Parms;
 	Stop_Parms.Base = Base;
 
-	pFnStop->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnStop, &Stop_Parms, NULL );
-
-	pFnStop->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnStop, &Stop_Parms ) )
+		this->ProcessEvent ( pFnStop, &Stop_Parms, NULL );
 
 	return Stop_Parms.ReturnValue;
 };
@@ -827,19 +686,15 @@ bool UWwiseAudioComponent::Stop ( class UWwiseBaseSoundObject* Base )
 
 bool UWwiseAudioComponent::StopWwiseEvent ( struct FWwiseEventPair const& AudioEvent )
 {
-	static UFunction* pFnStopWwiseEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopWwiseEventRef { L"Function WwiseAudio.WwiseAudioComponent.StopWwiseEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopWwiseEvent )
-		pFnStopWwiseEvent = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.StopWwiseEvent" );
+	UFunction* const pFnStopWwiseEvent = pFnStopWwiseEventRef.Get ( );
 
 	UWwiseAudioComponent_execStopWwiseEvent_Parms StopWwiseEvent_Parms;
 	memcpy ( &StopWwiseEvent_Parms.AudioEvent, &AudioEvent, 0x10 );
 
-	pFnStopWwiseEvent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnStopWwiseEvent, &StopWwiseEvent_Parms, NULL );
-
-	pFnStopWwiseEvent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnStopWwiseEvent, &StopWwiseEvent_Parms ) )
+		this->ProcessEvent ( pFnStopWwiseEvent, &StopWwiseEvent_Parms, NULL );
 
 	return StopWwiseEvent_Parms.ReturnValue;
 };
@@ -853,20 +708,16 @@ bool UWwiseAudioComponent::StopWwiseEvent ( struct FWwiseEventPair const& AudioE
 
 bool UWwiseAudioComponent::Play ( class UWwiseBaseSoundObject* Base, unsigned long bTrackPosition )
 {
-	static UFunction* pFnPlay = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayRef { L"Function WwiseAudio.WwiseAudioComponent.Play", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlay )
-		pFnPlay = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.Play" );
+	UFunction* const pFnPlay = pFnPlayRef.Get ( );
 
 	UWwiseAudioComponent_execPlay_Parms Play_Parms;
 	Play_Parms.Base = Base;
 	Play_Parms.bTrackPosition = bTrackPosition;
 
-	pFnPlay->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnPlay, &Play_Parms, NULL );
-
-	pFnPlay->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnPlay, &Play_Parms ) )
+		this->ProcessEvent ( pFnPlay, &Play_Parms, NULL );
 
 	return Play_Parms.ReturnValue;
 };
@@ -880,20 +731,16 @@ bool UWwiseAudioComponent::Play ( class UWwiseBaseSoundObject* Base, unsigned lo
 
 bool UWwiseAudioComponent::PlayWwiseEvent ( struct FWwiseEventPair const& AudioEvent, unsigned long bTrackPosition )
 {
-	static UFunction* pFnPlayWwiseEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayWwiseEventRef { L"Function WwiseAudio.WwiseAudioComponent.PlayWwiseEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayWwiseEvent )
-		pFnPlayWwiseEvent = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.PlayWwiseEvent" );
+	UFunction* const pFnPlayWwiseEvent = pFnPlayWwiseEventRef.Get ( );
 
 	UWwiseAudioComponent_execPlayWwiseEvent_Parms PlayWwiseEvent_Parms;
 	memcpy ( &PlayWwiseEvent_Parms.AudioEvent, &AudioEvent, 0x10 );
 	PlayWwiseEvent_Parms.bTrackPosition = bTrackPosition;
 
-	pFnPlayWwiseEvent->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnPlayWwiseEvent, &PlayWwiseEvent_Parms, NULL );
-
-	pFnPlayWwiseEvent->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnPlayWwiseEvent, &PlayWwiseEvent_Parms ) )
+		this->ProcessEvent ( pFnPlayWwiseEvent, &PlayWwiseEvent_Parms, NULL );
 
 	return PlayWwiseEvent_Parms.ReturnValue;
 };
@@ -906,19 +753,15 @@ bool UWwiseAudioComponent::PlayWwiseEvent ( struct FWwiseEventPair const& AudioE
 
 float UWwiseAudioComponent::SoundPositionByID ( int WwisePlayingID )
 {
-	static UFunction* pFnSoundPositionByID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSoundPositionByIDRef { L"Function WwiseAudio.WwiseAudioComponent.SoundPositionByID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSoundPositionByID )
-		pFnSoundPositionByID = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.SoundPositionByID" );
+	UFunction* const pFnSoundPositionByID = pFnSoundPositionByIDRef.Get ( );
 
 	UWwiseAudioComponent_execSoundPositionByID_Parms SoundPositionByID_Parms;
 	SoundPositionByID_Parms.WwisePlayingID = WwisePlayingID;
 
-	pFnSoundPositionByID->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSoundPositionByID, &SoundPositionByID_Parms, NULL );
-
-	pFnSoundPositionByID->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSoundPositionByID, &SoundPositionByID_Parms ) )
+		this->ProcessEvent ( pFnSoundPositionByID, &SoundPositionByID_Parms, NULL );
 
 	return SoundPositionByID_Parms.ReturnValue;
 };
@@ -931,19 +774,15 @@ float UWwiseAudioComponent::SoundPositionByID ( int WwisePlayingID )
 
 float UWwiseAudioComponent::SoundPosition ( class UWwiseBaseSoundObject* Base )
 {
-	static UFunction* pFnSoundPosition = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSoundPositionRef { L"Function WwiseAudio.WwiseAudioComponent.SoundPosition", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSoundPosition )
-		pFnSoundPosition = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.SoundPosition" );
+	UFunction* const pFnSoundPosition = pFnSoundPositionRef.Get ( );
 
 	UWwiseAudioComponent_execSoundPosition_Parms SoundPosition_Parms;
 	SoundPosition_Parms.Base = Base;
 
-	pFnSoundPosition->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSoundPosition, &SoundPosition_Parms, NULL );
-
-	pFnSoundPosition->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSoundPosition, &SoundPosition_Parms ) )
+		this->ProcessEvent ( pFnSoundPosition, &SoundPosition_Parms, NULL );
 
 	return SoundPosition_Parms.ReturnValue;
 };
@@ -955,18 +794,14 @@ float UWwiseAudioComponent::SoundPosition ( class UWwiseBaseSoundObject* Base )
 
 bool UWwiseAudioComponent::StopAll ( )
 {
-	static UFunction* pFnStopAll = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopAllRef { L"Function WwiseAudio.WwiseAudioComponent.StopAll", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopAll )
-		pFnStopAll = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.StopAll" );
+	UFunction* const pFnStopAll = pFnStopAllRef.Get ( );
 
 	UWwiseAudioComponent_execStopAll_Parms StopAll_Parms;
 
-	pFnStopAll->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnStopAll, &StopAll_Parms, NULL );
-
-	pFnStopAll->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnStopAll, &StopAll_Parms ) )
+		this->ProcessEvent ( pFnStopAll, &StopAll_Parms, NULL );
 
 	return StopAll_Parms.ReturnValue;
 };
@@ -980,20 +815,16 @@ bool UWwiseAudioComponent::StopAll ( )
 
 int UWwiseAudioComponent::FindPlayingID ( class UWwiseBaseSoundObject* BaseSound, class UWwiseEvent* StopEvent )
 {
-	static UFunction* pFnFindPlayingID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFindPlayingIDRef { L"Function WwiseAudio.WwiseAudioComponent.FindPlayingID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFindPlayingID )
-		pFnFindPlayingID = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.FindPlayingID" );
+	UFunction* const pFnFindPlayingID = pFnFindPlayingIDRef.Get ( );
 
 	UWwiseAudioComponent_execFindPlayingID_Parms FindPlayingID_Parms;
 	FindPlayingID_Parms.BaseSound = BaseSound;
 	FindPlayingID_Parms.StopEvent = StopEvent;
 
-	pFnFindPlayingID->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFindPlayingID, &FindPlayingID_Parms, NULL );
-
-	pFnFindPlayingID->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFindPlayingID, &FindPlayingID_Parms ) )
+		this->ProcessEvent ( pFnFindPlayingID, &FindPlayingID_Parms, NULL );
 
 	return FindPlayingID_Parms.ReturnValue;
 };
@@ -1006,10 +837,9 @@ int UWwiseAudioComponent::FindPlayingID ( class UWwiseBaseSoundObject* BaseSound
 
 void UWwiseAudioComponent::SetRTPCWithHandler ( float fValue, struct FWwiseRTPCForActorHandler* RTPCHandler )
 {
-	static UFunction* pFnSetRTPCWithHandler = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetRTPCWithHandlerRef { L"Function WwiseAudio.WwiseAudioComponent.SetRTPCWithHandler", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetRTPCWithHandler )
-		pFnSetRTPCWithHandler = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponent.SetRTPCWithHandler" );
+	UFunction* const pFnSetRTPCWithHandler = pFnSetRTPCWithHandlerRef.Get ( );
 
 	UWwiseAudioComponent_execSetRTPCWithHandler_Parms SetRTPCWithHandler_Parms;
 	SetRTPCWithHandler_Parms.fValue = fValue;
@@ -1017,11 +847,8 @@ void UWwiseAudioComponent::SetRTPCWithHandler ( float fValue, struct FWwiseRTPCF
 	if ( RTPCHandler )
 		memcpy ( &SetRTPCWithHandler_Parms.RTPCHandler, RTPCHandler, 0x1C );
 
-	pFnSetRTPCWithHandler->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetRTPCWithHandler, &SetRTPCWithHandler_Parms, NULL );
-
-	pFnSetRTPCWithHandler->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetRTPCWithHandler, &SetRTPCWithHandler_Parms ) )
+		this->ProcessEvent ( pFnSetRTPCWithHandler, &SetRTPCWithHandler_Parms, NULL );
 
 	if ( RTPCHandler )
 		memcpy ( RTPCHandler, &SetRTPCWithHandler_Parms.RTPCHandler, 0x1C );
@@ -1029,14 +856,11 @@ void UWwiseAudioComponent::SetRTPCWithHandler ( float fValue, struct FWwiseRTPCF
 
 
 
-class UClass* UWwiseAudioComponentMultiLoc::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWwiseAudioComponentMultiLoc::pClassPointer { L"Class WwiseAudio.WwiseAudioComponentMultiLoc", &UObject::FindClass };
 
 class UClass* UWwiseAudioComponentMultiLoc::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseAudioComponentMultiLoc" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function WwiseAudio.WwiseAudioComponentMultiLoc.Set3D
@@ -1045,174 +869,131 @@ class UClass* UWwiseAudioComponentMultiLoc::StaticClass()
 
 void UWwiseAudioComponentMultiLoc::Set3D ( )
 {
-	static UFunction* pFnSet3D = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSet3DRef { L"Function WwiseAudio.WwiseAudioComponentMultiLoc.Set3D", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSet3D )
-		pFnSet3D = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioComponentMultiLoc.Set3D" );
+	UFunction* const pFnSet3D = pFnSet3DRef.Get ( );
 
 	UWwiseAudioComponentMultiLoc_execSet3D_Parms Set3D_Parms;
 
-	pFnSet3D->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSet3D, &Set3D_Parms, NULL );
-
-	pFnSet3D->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSet3D, &Set3D_Parms ) )
+		this->ProcessEvent ( pFnSet3D, &Set3D_Parms, NULL );
 };
 
 
 
-class UClass* UWwiseAudioDevice::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWwiseAudioDevice::pClassPointer { L"Class WwiseAudio.WwiseAudioDevice", &UObject::FindClass };
 
 class UClass* UWwiseAudioDevice::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseAudioDevice" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UWwiseCollection::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWwiseCollection::pClassPointer { L"Class WwiseAudio.WwiseCollection", &UObject::FindClass };
 
 class UClass* UWwiseCollection::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseCollection" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UWwiseComponentCallback::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWwiseComponentCallback::pClassPointer { L"Class WwiseAudio.WwiseComponentCallback", &UObject::FindClass };
 
 class UClass* UWwiseComponentCallback::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseComponentCallback" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UWwiseEnvironmentSettings::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWwiseEnvironmentSettings::pClassPointer { L"Class WwiseAudio.WwiseEnvironmentSettings", &UObject::FindClass };
 
 class UClass* UWwiseEnvironmentSettings::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseEnvironmentSettings" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* AWwiseEnvironmentVolume::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> AWwiseEnvironmentVolume::pClassPointer { L"Class WwiseAudio.WwiseEnvironmentVolume", &UObject::FindClass };
 
 class UClass* AWwiseEnvironmentVolume::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseEnvironmentVolume" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UWwiseEvent::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWwiseEvent::pClassPointer { L"Class WwiseAudio.WwiseEvent", &UObject::FindClass };
 
 class UClass* UWwiseEvent::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseEvent" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UWwiseDialogueEvent::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWwiseDialogueEvent::pClassPointer { L"Class WwiseAudio.WwiseDialogueEvent", &UObject::FindClass };
 
 class UClass* UWwiseDialogueEvent::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseDialogueEvent" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UWwiseEventPairObject::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWwiseEventPairObject::pClassPointer { L"Class WwiseAudio.WwiseEventPairObject", &UObject::FindClass };
 
 class UClass* UWwiseEventPairObject::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseEventPairObject" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UWwiseFaceFXStopper::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWwiseFaceFXStopper::pClassPointer { L"Class WwiseAudio.WwiseFaceFXStopper", &UObject::FindClass };
 
 class UClass* UWwiseFaceFXStopper::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseFaceFXStopper" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UWwiseFile::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWwiseFile::pClassPointer { L"Class WwiseAudio.WwiseFile", &UObject::FindClass };
 
 class UClass* UWwiseFile::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseFile" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UWwiseBank::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWwiseBank::pClassPointer { L"Class WwiseAudio.WwiseBank", &UObject::FindClass };
 
 class UClass* UWwiseBank::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseBank" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UWwiseStream::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWwiseStream::pClassPointer { L"Class WwiseAudio.WwiseStream", &UObject::FindClass };
 
 class UClass* UWwiseStream::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseStream" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* AWwiseMicPosOrient::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> AWwiseMicPosOrient::pClassPointer { L"Class WwiseAudio.WwiseMicPosOrient", &UObject::FindClass };
 
 class UClass* AWwiseMicPosOrient::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseMicPosOrient" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function WwiseAudio.WwiseMicPosOrient.GetUpVector
@@ -1222,18 +1003,14 @@ class UClass* AWwiseMicPosOrient::StaticClass()
 
 struct FVector AWwiseMicPosOrient::GetUpVector ( )
 {
-	static UFunction* pFnGetUpVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUpVectorRef { L"Function WwiseAudio.WwiseMicPosOrient.GetUpVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUpVector )
-		pFnGetUpVector = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseMicPosOrient.GetUpVector" );
+	UFunction* const pFnGetUpVector = pFnGetUpVectorRef.Get ( );
 
 	AWwiseMicPosOrient_execGetUpVector_Parms GetUpVector_Parms;
 
-	pFnGetUpVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetUpVector, &GetUpVector_Parms, NULL );
-
-	pFnGetUpVector->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetUpVector, &GetUpVector_Parms ) )
+		this->ProcessEvent ( pFnGetUpVector, &GetUpVector_Parms, NULL );
 
 	return GetUpVector_Parms.ReturnValue;
 };
@@ -1245,32 +1022,25 @@ struct FVector AWwiseMicPosOrient::GetUpVector ( )
 
 struct FVector AWwiseMicPosOrient::GetFrontVector ( )
 {
-	static UFunction* pFnGetFrontVector = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetFrontVectorRef { L"Function WwiseAudio.WwiseMicPosOrient.GetFrontVector", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetFrontVector )
-		pFnGetFrontVector = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseMicPosOrient.GetFrontVector" );
+	UFunction* const pFnGetFrontVector = pFnGetFrontVectorRef.Get ( );
 
 	AWwiseMicPosOrient_execGetFrontVector_Parms GetFrontVector_Parms;
 
-	pFnGetFrontVector->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetFrontVector, &GetFrontVector_Parms, NULL );
-
-	pFnGetFrontVector->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetFrontVector, &GetFrontVector_Parms ) )
+		this->ProcessEvent ( pFnGetFrontVector, &GetFrontVector_Parms, NULL );
 
 	return GetFrontVector_Parms.ReturnValue;
 };
 
 
 
-class UClass* AWwiseVolume::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> AWwiseVolume::pClassPointer { L"Class WwiseAudio.WwiseVolume", &UObject::FindClass };
 
 class UClass* AWwiseVolume::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseVolume" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function WwiseAudio.WwiseVolume.TimerPop
@@ -1280,10 +1050,9 @@ class UClass* AWwiseVolume::StaticClass()
 
 void AWwiseVolume::TimerPop ( class AWwiseVolumeTimer* T )
 {
-	static UFunction* pFnTimerPop = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTimerPopRef { L"Function WwiseAudio.WwiseVolume.TimerPop", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTimerPop )
-		pFnTimerPop = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseVolume.TimerPop" );
+	UFunction* const pFnTimerPop = pFnTimerPopRef.Get ( );
 
 	AWwiseVolume_execTimerPop_Parms TimerPop_Parms;
 	TimerPop_Parms.T = T;
@@ -1297,10 +1066,9 @@ void AWwiseVolume::TimerPop ( class AWwiseVolumeTimer* T )
 
 void AWwiseVolume::PostBeginPlay ( )
 {
-	static UFunction* pFnPostBeginPlay = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPostBeginPlayRef { L"Function WwiseAudio.WwiseVolume.PostBeginPlay", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPostBeginPlay )
-		pFnPostBeginPlay = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseVolume.PostBeginPlay" );
+	UFunction* const pFnPostBeginPlay = pFnPostBeginPlayRef.Get ( );
 
 	AWwiseVolume_execPostBeginPlay_Parms PostBeginPlay_Parms;
 
@@ -1309,14 +1077,11 @@ void AWwiseVolume::PostBeginPlay ( )
 
 
 
-class UClass* AWwiseAudioVolume::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> AWwiseAudioVolume::pClassPointer { L"Class WwiseAudio.WwiseAudioVolume", &UObject::FindClass };
 
 class UClass* AWwiseAudioVolume::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseAudioVolume" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function WwiseAudio.WwiseAudioVolume.Stop
@@ -1325,18 +1090,14 @@ class UClass* AWwiseAudioVolume::StaticClass()
 
 void AWwiseAudioVolume::Stop ( )
 {
-	static UFunction* pFnStop = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopRef { L"Function WwiseAudio.WwiseAudioVolume.Stop", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStop )
-		pFnStop = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioVolume.Stop" );
+	UFunction* const pFnStop = pFnStopRef.Get ( );
 
 	AWwiseAudioVolume_execStop_Parms Stop_Parms;
 
-	pFnStop->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnStop, &Stop_Parms, NULL );
-
-	pFnStop->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnStop, &Stop_Parms ) )
+		this->ProcessEvent ( pFnStop, &Stop_Parms, NULL );
 };
 
 // Function WwiseAudio.WwiseAudioVolume.Start
@@ -1345,18 +1106,14 @@ void AWwiseAudioVolume::Stop ( )
 
 void AWwiseAudioVolume::Start ( )
 {
-	static UFunction* pFnStart = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartRef { L"Function WwiseAudio.WwiseAudioVolume.Start", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStart )
-		pFnStart = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioVolume.Start" );
+	UFunction* const pFnStart = pFnStartRef.Get ( );
 
 	AWwiseAudioVolume_execStart_Parms Start_Parms;
 
-	pFnStart->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnStart, &Start_Parms, NULL );
-
-	pFnStart->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnStart, &Start_Parms ) )
+		this->ProcessEvent ( pFnStart, &Start_Parms, NULL );
 };
 
 // Function WwiseAudio.WwiseAudioVolume.myTimerPop
@@ -1365,18 +1122,14 @@ void AWwiseAudioVolume::Start ( )
 
 void AWwiseAudioVolume::myTimerPop ( )
 {
-	static UFunction* pFnmyTimerPop = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnmyTimerPopRef { L"Function WwiseAudio.WwiseAudioVolume.myTimerPop", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnmyTimerPop )
-		pFnmyTimerPop = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioVolume.myTimerPop" );
+	UFunction* const pFnmyTimerPop = pFnmyTimerPopRef.Get ( );
 
 	AWwiseAudioVolume_execmyTimerPop_Parms myTimerPop_Parms;
 
-	pFnmyTimerPop->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnmyTimerPop, &myTimerPop_Parms, NULL );
-
-	pFnmyTimerPop->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnmyTimerPop, &myTimerPop_Parms ) )
+		this->ProcessEvent ( pFnmyTimerPop, &myTimerPop_Parms, NULL );
 };
 
 // Function WwiseAudio.WwiseAudioVolume.TimerPop
@@ -1386,10 +1139,9 @@ void AWwiseAudioVolume::myTimerPop ( )
 
 void AWwiseAudioVolume::TimerPop ( class AWwiseVolumeTimer* T )
 {
-	static UFunction* pFnTimerPop = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTimerPopRef { L"Function WwiseAudio.WwiseAudioVolume.TimerPop", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTimerPop )
-		pFnTimerPop = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioVolume.TimerPop" );
+	UFunction* const pFnTimerPop = pFnTimerPopRef.Get ( );
 
 	AWwiseAudioVolume_execTimerPop_Parms TimerPop_Parms;
 	TimerPop_Parms.T = T;
@@ -1404,10 +1156,9 @@ void AWwiseAudioVolume::TimerPop ( class AWwiseVolumeTimer* T )
 
 void AWwiseAudioVolume::eventUnTouch ( class AActor* Other )
 {
-	static UFunction* pFnUnTouch = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnTouchRef { L"Function WwiseAudio.WwiseAudioVolume.UnTouch", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnTouch )
-		pFnUnTouch = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioVolume.UnTouch" );
+	UFunction* const pFnUnTouch = pFnUnTouchRef.Get ( );
 
 	AWwiseAudioVolume_eventUnTouch_Parms UnTouch_Parms;
 	UnTouch_Parms.Other = Other;
@@ -1425,10 +1176,9 @@ void AWwiseAudioVolume::eventUnTouch ( class AActor* Other )
 
 void AWwiseAudioVolume::eventTouch ( class AActor* Other, class UPrimitiveComponent* OtherComp, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnTouch = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTouchRef { L"Function WwiseAudio.WwiseAudioVolume.Touch", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTouch )
-		pFnTouch = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioVolume.Touch" );
+	UFunction* const pFnTouch = pFnTouchRef.Get ( );
 
 	AWwiseAudioVolume_eventTouch_Parms Touch_Parms;
 	Touch_Parms.Other = Other;
@@ -1445,10 +1195,9 @@ void AWwiseAudioVolume::eventTouch ( class AActor* Other, class UPrimitiveCompon
 
 void AWwiseAudioVolume::PostBeginPlay ( )
 {
-	static UFunction* pFnPostBeginPlay = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPostBeginPlayRef { L"Function WwiseAudio.WwiseAudioVolume.PostBeginPlay", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPostBeginPlay )
-		pFnPostBeginPlay = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseAudioVolume.PostBeginPlay" );
+	UFunction* const pFnPostBeginPlay = pFnPostBeginPlayRef.Get ( );
 
 	AWwiseAudioVolume_execPostBeginPlay_Parms PostBeginPlay_Parms;
 
@@ -1457,14 +1206,11 @@ void AWwiseAudioVolume::PostBeginPlay ( )
 
 
 
-class UClass* AWwiseMusicVolume::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> AWwiseMusicVolume::pClassPointer { L"Class WwiseAudio.WwiseMusicVolume", &UObject::FindClass };
 
 class UClass* AWwiseMusicVolume::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseMusicVolume" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function WwiseAudio.WwiseMusicVolume.myTimerPop
@@ -1473,18 +1219,14 @@ class UClass* AWwiseMusicVolume::StaticClass()
 
 void AWwiseMusicVolume::myTimerPop ( )
 {
-	static UFunction* pFnmyTimerPop = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnmyTimerPopRef { L"Function WwiseAudio.WwiseMusicVolume.myTimerPop", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnmyTimerPop )
-		pFnmyTimerPop = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseMusicVolume.myTimerPop" );
+	UFunction* const pFnmyTimerPop = pFnmyTimerPopRef.Get ( );
 
 	AWwiseMusicVolume_execmyTimerPop_Parms myTimerPop_Parms;
 
-	pFnmyTimerPop->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnmyTimerPop, &myTimerPop_Parms, NULL );
-
-	pFnmyTimerPop->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnmyTimerPop, &myTimerPop_Parms ) )
+		this->ProcessEvent ( pFnmyTimerPop, &myTimerPop_Parms, NULL );
 };
 
 // Function WwiseAudio.WwiseMusicVolume.SetContainsPlayer
@@ -1494,19 +1236,15 @@ void AWwiseMusicVolume::myTimerPop ( )
 
 void AWwiseMusicVolume::SetContainsPlayer ( unsigned long bContainsPlayer )
 {
-	static UFunction* pFnSetContainsPlayer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetContainsPlayerRef { L"Function WwiseAudio.WwiseMusicVolume.SetContainsPlayer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetContainsPlayer )
-		pFnSetContainsPlayer = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseMusicVolume.SetContainsPlayer" );
+	UFunction* const pFnSetContainsPlayer = pFnSetContainsPlayerRef.Get ( );
 
 	AWwiseMusicVolume_execSetContainsPlayer_Parms SetContainsPlayer_Parms;
 	SetContainsPlayer_Parms.bContainsPlayer = bContainsPlayer;
 
-	pFnSetContainsPlayer->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetContainsPlayer, &SetContainsPlayer_Parms, NULL );
-
-	pFnSetContainsPlayer->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetContainsPlayer, &SetContainsPlayer_Parms ) )
+		this->ProcessEvent ( pFnSetContainsPlayer, &SetContainsPlayer_Parms, NULL );
 };
 
 // Function WwiseAudio.WwiseMusicVolume.SetEnabled
@@ -1516,19 +1254,15 @@ void AWwiseMusicVolume::SetContainsPlayer ( unsigned long bContainsPlayer )
 
 void AWwiseMusicVolume::SetEnabled ( unsigned long bEnabled )
 {
-	static UFunction* pFnSetEnabled = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetEnabledRef { L"Function WwiseAudio.WwiseMusicVolume.SetEnabled", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetEnabled )
-		pFnSetEnabled = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseMusicVolume.SetEnabled" );
+	UFunction* const pFnSetEnabled = pFnSetEnabledRef.Get ( );
 
 	AWwiseMusicVolume_execSetEnabled_Parms SetEnabled_Parms;
 	SetEnabled_Parms.bEnabled = bEnabled;
 
-	pFnSetEnabled->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnSetEnabled, &SetEnabled_Parms, NULL );
-
-	pFnSetEnabled->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnSetEnabled, &SetEnabled_Parms ) )
+		this->ProcessEvent ( pFnSetEnabled, &SetEnabled_Parms, NULL );
 };
 
 // Function WwiseAudio.WwiseMusicVolume.StopMusic
@@ -1537,18 +1271,14 @@ void AWwiseMusicVolume::SetEnabled ( unsigned long bEnabled )
 
 void AWwiseMusicVolume::StopMusic ( )
 {
-	static UFunction* pFnStopMusic = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopMusicRef { L"Function WwiseAudio.WwiseMusicVolume.StopMusic", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopMusic )
-		pFnStopMusic = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseMusicVolume.StopMusic" );
+	UFunction* const pFnStopMusic = pFnStopMusicRef.Get ( );
 
 	AWwiseMusicVolume_execStopMusic_Parms StopMusic_Parms;
 
-	pFnStopMusic->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnStopMusic, &StopMusic_Parms, NULL );
-
-	pFnStopMusic->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnStopMusic, &StopMusic_Parms ) )
+		this->ProcessEvent ( pFnStopMusic, &StopMusic_Parms, NULL );
 };
 
 // Function WwiseAudio.WwiseMusicVolume.StartMusic
@@ -1557,18 +1287,14 @@ void AWwiseMusicVolume::StopMusic ( )
 
 void AWwiseMusicVolume::StartMusic ( )
 {
-	static UFunction* pFnStartMusic = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartMusicRef { L"Function WwiseAudio.WwiseMusicVolume.StartMusic", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartMusic )
-		pFnStartMusic = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseMusicVolume.StartMusic" );
+	UFunction* const pFnStartMusic = pFnStartMusicRef.Get ( );
 
 	AWwiseMusicVolume_execStartMusic_Parms StartMusic_Parms;
 
-	pFnStartMusic->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnStartMusic, &StartMusic_Parms, NULL );
-
-	pFnStartMusic->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnStartMusic, &StartMusic_Parms ) )
+		this->ProcessEvent ( pFnStartMusic, &StartMusic_Parms, NULL );
 };
 
 // Function WwiseAudio.WwiseMusicVolume.CheckPriority
@@ -1578,18 +1304,14 @@ void AWwiseMusicVolume::StartMusic ( )
 
 bool AWwiseMusicVolume::CheckPriority ( )
 {
-	static UFunction* pFnCheckPriority = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCheckPriorityRef { L"Function WwiseAudio.WwiseMusicVolume.CheckPriority", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCheckPriority )
-		pFnCheckPriority = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseMusicVolume.CheckPriority" );
+	UFunction* const pFnCheckPriority = pFnCheckPriorityRef.Get ( );
 
 	AWwiseMusicVolume_execCheckPriority_Parms CheckPriority_Parms;
 
-	pFnCheckPriority->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCheckPriority, &CheckPriority_Parms, NULL );
-
-	pFnCheckPriority->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCheckPriority, &CheckPriority_Parms ) )
+		this->ProcessEvent ( pFnCheckPriority, &CheckPriority_Parms, NULL );
 
 	return CheckPriority_Parms.ReturnValue;
 };
@@ -1601,10 +1323,9 @@ bool AWwiseMusicVolume::CheckPriority ( )
 
 void AWwiseMusicVolume::TimerPop ( class AWwiseVolumeTimer* T )
 {
-	static UFunction* pFnTimerPop = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTimerPopRef { L"Function WwiseAudio.WwiseMusicVolume.TimerPop", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTimerPop )
-		pFnTimerPop = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseMusicVolume.TimerPop" );
+	UFunction* const pFnTimerPop = pFnTimerPopRef.Get ( );
 
 	AWwiseMusicVolume_execTimerPop_Parms TimerPop_Parms;
 	TimerPop_Parms.T = T;
@@ -1618,10 +1339,9 @@ void AWwiseMusicVolume::TimerPop ( class AWwiseVolumeTimer* T )
 
 void AWwiseMusicVolume::PostBeginPlay ( )
 {
-	static UFunction* pFnPostBeginPlay = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPostBeginPlayRef { L"Function WwiseAudio.WwiseMusicVolume.PostBeginPlay", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPostBeginPlay )
-		pFnPostBeginPlay = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseMusicVolume.PostBeginPlay" );
+	UFunction* const pFnPostBeginPlay = pFnPostBeginPlayRef.Get ( );
 
 	AWwiseMusicVolume_execPostBeginPlay_Parms PostBeginPlay_Parms;
 
@@ -1630,14 +1350,11 @@ void AWwiseMusicVolume::PostBeginPlay ( )
 
 
 
-class UClass* AWwiseVolumeTimer::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> AWwiseVolumeTimer::pClassPointer { L"Class WwiseAudio.WwiseVolumeTimer", &UObject::FindClass };
 
 class UClass* AWwiseVolumeTimer::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseVolumeTimer" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function WwiseAudio.WwiseVolumeTimer.Timer
@@ -1646,10 +1363,9 @@ class UClass* AWwiseVolumeTimer::StaticClass()
 
 void AWwiseVolumeTimer::Timer ( )
 {
-	static UFunction* pFnTimer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTimerRef { L"Function WwiseAudio.WwiseVolumeTimer.Timer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTimer )
-		pFnTimer = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseVolumeTimer.Timer" );
+	UFunction* const pFnTimer = pFnTimerRef.Get ( );
 
 	AWwiseVolumeTimer_execTimer_Parms Timer_Parms;
 
@@ -1658,26 +1374,20 @@ void AWwiseVolumeTimer::Timer ( )
 
 
 
-class UClass* UActorFactoryWwiseDistanceRTPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UActorFactoryWwiseDistanceRTPC::pClassPointer { L"Class WwiseAudio.ActorFactoryWwiseDistanceRTPC", &UObject::FindClass };
 
 class UClass* UActorFactoryWwiseDistanceRTPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.ActorFactoryWwiseDistanceRTPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* AWwiseDistanceRTPC::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> AWwiseDistanceRTPC::pClassPointer { L"Class WwiseAudio.WwiseDistanceRTPC", &UObject::FindClass };
 
 class UClass* AWwiseDistanceRTPC::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseDistanceRTPC" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function WwiseAudio.WwiseDistanceRTPC.Tick
@@ -1687,10 +1397,9 @@ class UClass* AWwiseDistanceRTPC::StaticClass()
 
 void AWwiseDistanceRTPC::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickRef { L"Function WwiseAudio.WwiseDistanceRTPC.Tick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTick )
-		pFnTick = UObject::FindObject< UFunction > ( L"Function WwiseAudio.WwiseDistanceRTPC.Tick" );
+	UFunction* const pFnTick = pFnTickRef.Get ( );
 
 	AWwiseDistanceRTPC_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -1700,30 +1409,133 @@ void AWwiseDistanceRTPC::Tick ( float DeltaTime )
 
 
 
-class UClass* UActorFactoryWwiseMicPosOrient::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UActorFactoryWwiseMicPosOrient::pClassPointer { L"Class WwiseAudio.ActorFactoryWwiseMicPosOrient", &UObject::FindClass };
 
 class UClass* UActorFactoryWwiseMicPosOrient::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.ActorFactoryWwiseMicPosOrient" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* AWwiseOcclusionVolume::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> AWwiseOcclusionVolume::pClassPointer { L"Class WwiseAudio.WwiseOcclusionVolume", &UObject::FindClass };
 
 class UClass* AWwiseOcclusionVolume::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WwiseAudio.WwiseOcclusionVolume" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class WwiseAudio.ActorFactoryWwiseAmbientSound",
+	L"Class WwiseAudio.AnimNotify_WwiseEvent",
+	L"Class WwiseAudio.InterpTrackInstWwiseEvent",
+	L"Class WwiseAudio.InterpTrackInstWwiseRTPC",
+	L"Class WwiseAudio.InterpTrackWwiseEvent",
+	L"Class WwiseAudio.InterpTrackWwiseSoundEffect",
+	L"Class WwiseAudio.InterpTrackWwiseRTPC",
+	L"Class WwiseAudio.SeqAct_WwiseLockMic",
+	L"Class WwiseAudio.SeqAct_WwiseMusicVolumeDisable",
+	L"Function WwiseAudio.SeqAct_WwiseMusicVolumeDisable.GetObjClassVersion",
+	L"Class WwiseAudio.SeqAct_WwiseMusicVolumeEnable",
+	L"Function WwiseAudio.SeqAct_WwiseMusicVolumeEnable.GetObjClassVersion",
+	L"Class WwiseAudio.SeqAct_WwisePostEvent",
+	L"Function WwiseAudio.SeqAct_WwisePostEvent.GetObjClassVersion",
+	L"Class WwiseAudio.SeqAct_WwisePostTrigger",
+	L"Class WwiseAudio.SeqAct_WwiseSetRTPCValue",
+	L"Class WwiseAudio.SeqAct_WwiseSetState",
+	L"Class WwiseAudio.SeqAct_WwiseSetSwitch",
+	L"Class WwiseAudio.SeqAct_WwiseStartAudioObjects",
+	L"Class WwiseAudio.SeqAct_WwiseStopAll",
+	L"Class WwiseAudio.WwiseAmbientSound",
+	L"Class WwiseAudio.WwiseAudioComponent",
+	L"Function WwiseAudio.WwiseAudioComponent.SetLocation",
+	L"Function WwiseAudio.WwiseAudioComponent.Set3D",
+	L"Function WwiseAudio.WwiseAudioComponent.Set2D",
+	L"Function WwiseAudio.WwiseAudioComponent.RegisterGameObject",
+	L"Function WwiseAudio.WwiseAudioComponent.UnregisterGameObject",
+	L"Function WwiseAudio.WwiseAudioComponent.GetDistanceToListener",
+	L"Function WwiseAudio.WwiseAudioComponent.SetObstructionOcclusionEnabled",
+	L"Function WwiseAudio.WwiseAudioComponent.SetEnvironmentalAudioEnabled",
+	L"Function WwiseAudio.WwiseAudioComponent.GetObstructionOcclusionEnabled",
+	L"Function WwiseAudio.WwiseAudioComponent.GetEnvironmentalAudioEnabled",
+	L"Function WwiseAudio.WwiseAudioComponent.GetMicPosition",
+	L"Function WwiseAudio.WwiseAudioComponent.SetGlobalRTPCFromScript",
+	L"Function WwiseAudio.WwiseAudioComponent.CreateComponentFromScript",
+	L"Function WwiseAudio.WwiseAudioComponent.IsEventPlaying",
+	L"Function WwiseAudio.WwiseAudioComponent.IsPlaying",
+	L"Function WwiseAudio.WwiseAudioComponent.PostGlobalEvent",
+	L"Function WwiseAudio.WwiseAudioComponent.SetWwiseTrigger",
+	L"Function WwiseAudio.WwiseAudioComponent.SetWwiseSwitch",
+	L"Function WwiseAudio.WwiseAudioComponent.SetWwiseRTPCs",
+	L"Function WwiseAudio.WwiseAudioComponent.SetWwiseRTPC",
+	L"Function WwiseAudio.WwiseAudioComponent.Stop",
+	L"Function WwiseAudio.WwiseAudioComponent.StopWwiseEvent",
+	L"Function WwiseAudio.WwiseAudioComponent.Play",
+	L"Function WwiseAudio.WwiseAudioComponent.PlayWwiseEvent",
+	L"Function WwiseAudio.WwiseAudioComponent.SoundPositionByID",
+	L"Function WwiseAudio.WwiseAudioComponent.SoundPosition",
+	L"Function WwiseAudio.WwiseAudioComponent.StopAll",
+	L"Function WwiseAudio.WwiseAudioComponent.FindPlayingID",
+	L"Function WwiseAudio.WwiseAudioComponent.SetRTPCWithHandler",
+	L"Class WwiseAudio.WwiseAudioComponentMultiLoc",
+	L"Function WwiseAudio.WwiseAudioComponentMultiLoc.Set3D",
+	L"Class WwiseAudio.WwiseAudioDevice",
+	L"Class WwiseAudio.WwiseCollection",
+	L"Class WwiseAudio.WwiseComponentCallback",
+	L"Class WwiseAudio.WwiseEnvironmentSettings",
+	L"Class WwiseAudio.WwiseEnvironmentVolume",
+	L"Class WwiseAudio.WwiseEvent",
+	L"Class WwiseAudio.WwiseDialogueEvent",
+	L"Class WwiseAudio.WwiseEventPairObject",
+	L"Class WwiseAudio.WwiseFaceFXStopper",
+	L"Class WwiseAudio.WwiseFile",
+	L"Class WwiseAudio.WwiseBank",
+	L"Class WwiseAudio.WwiseStream",
+	L"Class WwiseAudio.WwiseMicPosOrient",
+	L"Function WwiseAudio.WwiseMicPosOrient.GetUpVector",
+	L"Function WwiseAudio.WwiseMicPosOrient.GetFrontVector",
+	L"Class WwiseAudio.WwiseVolume",
+	L"Function WwiseAudio.WwiseVolume.TimerPop",
+	L"Function WwiseAudio.WwiseVolume.PostBeginPlay",
+	L"Class WwiseAudio.WwiseAudioVolume",
+	L"Function WwiseAudio.WwiseAudioVolume.Stop",
+	L"Function WwiseAudio.WwiseAudioVolume.Start",
+	L"Function WwiseAudio.WwiseAudioVolume.myTimerPop",
+	L"Function WwiseAudio.WwiseAudioVolume.TimerPop",
+	L"Function WwiseAudio.WwiseAudioVolume.UnTouch",
+	L"Function WwiseAudio.WwiseAudioVolume.Touch",
+	L"Function WwiseAudio.WwiseAudioVolume.PostBeginPlay",
+	L"Class WwiseAudio.WwiseMusicVolume",
+	L"Function WwiseAudio.WwiseMusicVolume.myTimerPop",
+	L"Function WwiseAudio.WwiseMusicVolume.SetContainsPlayer",
+	L"Function WwiseAudio.WwiseMusicVolume.SetEnabled",
+	L"Function WwiseAudio.WwiseMusicVolume.StopMusic",
+	L"Function WwiseAudio.WwiseMusicVolume.StartMusic",
+	L"Function WwiseAudio.WwiseMusicVolume.CheckPriority",
+	L"Function WwiseAudio.WwiseMusicVolume.TimerPop",
+	L"Function WwiseAudio.WwiseMusicVolume.PostBeginPlay",
+	L"Class WwiseAudio.WwiseVolumeTimer",
+	L"Function WwiseAudio.WwiseVolumeTimer.Timer",
+	L"Class WwiseAudio.ActorFactoryWwiseDistanceRTPC",
+	L"Class WwiseAudio.WwiseDistanceRTPC",
+	L"Function WwiseAudio.WwiseDistanceRTPC.Tick",
+	L"Class WwiseAudio.ActorFactoryWwiseMicPosOrient",
+	L"Class WwiseAudio.WwiseOcclusionVolume",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
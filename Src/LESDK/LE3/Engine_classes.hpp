@@ -3366,7 +3366,7 @@ public:
 	unsigned char                                      TransitionType;                                   		// 0x08A9 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3424,7 +3424,7 @@ public:
 	unsigned char                                      TravelType;                                       		// 0x0A1C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3608,7 +3608,7 @@ public:
 	unsigned char                                      TickGroup;                                        		// 0x026D (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3899,7 +3899,7 @@ public:
 	unsigned char                                      CsgOper;                                          		// 0x028C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3913,7 +3913,7 @@ class ABrushShape : public ABrush
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3934,7 +3934,7 @@ public:
 	unsigned long                                      bConsiderWhilePathBuilding : 1;                   		// 0x02B0 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3961,7 +3961,7 @@ public:
 	unsigned long                                      bSafeFall : 1;                                    		// 0x02C4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3977,7 +3977,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x02C8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3996,7 +3996,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x02C4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4016,7 +4016,7 @@ public:
 	unsigned char                                      StreamingUsage;                                   		// 0x02CC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4033,7 +4033,7 @@ class ALightmassImportanceVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4047,7 +4047,7 @@ class APathBlockingVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4087,7 +4087,7 @@ public:
 	unsigned long                                      bWaterVolume : 1;                                 		// 0x0300 (0x0004) [0x0000000000000000] [0x00001000] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4123,7 +4123,7 @@ class ADefaultPhysicsVolume : public APhysicsVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4140,7 +4140,7 @@ public:
 	float                                              RBPhysicsGravityScaling;                          		// 0x0308 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4163,7 +4163,7 @@ public:
 	unsigned long                                      bAllowLadderStrafing : 1;                         		// 0x0340 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4183,7 +4183,7 @@ public:
 	TArray<class APortalTeleporter*>                   Portals;                                          		// 0x02B4 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4201,7 +4201,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x03A0 (0x0004) [0x0000000000000021] [0x00000001] ( CPF_Edit | CPF_Net )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4220,7 +4220,7 @@ public:
 	float                                              Priority;                                         		// 0x02F0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4234,7 +4234,7 @@ class ATriggerVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4254,7 +4254,7 @@ public:
 	unsigned long                                      bFadeOut : 1;                                     		// 0x0288 (0x0004) [0x0000000100000020] [0x00000001] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4291,7 +4291,7 @@ public:
 	unsigned long                                      bSafeBaseIfAsleep : 1;                            		// 0x02B4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4332,7 +4332,7 @@ public:
 	unsigned long                                      bIsLift : 1;                                      		// 0x0300 (0x0004) [0x0000000000000000] [0x00000080] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4368,7 +4368,7 @@ public:
 	unsigned long                                      bCurrentlyActive : 1;                             		// 0x0280 (0x0004) [0x0000000100000020] [0x00000008] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4413,7 +4413,7 @@ public:
 	unsigned long                                      bLogPoolOverflowList : 1;                         		// 0x02DC (0x0004) [0x0000000000044000] [0x00000002] ( CPF_Config | CPF_GlobalConfig )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4476,7 +4476,7 @@ public:
 	unsigned long                                      bShowOverlays : 1;                                		// 0x05A4 (0x0004) [0x0000000000000000] [0x00000100] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4529,7 +4529,7 @@ class AInfo : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4571,7 +4571,7 @@ public:
 	unsigned long                                      bSentinelStreamingLevelStillLoading : 1;          		// 0x0330 (0x0004) [0x0000000000002000] [0x00000080] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4610,7 +4610,7 @@ public:
 	float                                              AutoSelectHeight;                                 		// 0x0284 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4633,7 +4633,7 @@ public:
 	unsigned char                                      FileType;                                         		// 0x028C (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4651,7 +4651,7 @@ class AFileLog : public AFileWriter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4764,7 +4764,7 @@ public:
 	unsigned long                                      bHasStandbyCheatTriggered : 1;                    		// 0x0498 (0x0004) [0x0000000000000000] [0x02000000] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4934,7 +4934,7 @@ class AMCPTools : public AGameInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4954,7 +4954,7 @@ public:
 	unsigned long                                      bUserAdded : 1;                                   		// 0x0288 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4997,7 +4997,7 @@ class APotentialClimbWatcher : public AInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5016,7 +5016,7 @@ public:
 	unsigned char                                      RouteType;                                        		// 0x028C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5033,7 +5033,7 @@ public:
 	class UWindPointSourceComponent*                   Component;                                        		// 0x0270 (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5051,7 +5051,7 @@ public:
 	unsigned long                                      bSoftKillZ : 1;                                   		// 0x0280 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5195,7 +5195,7 @@ public:
 	unsigned char                                      NextTravelType;                                   		// 0x07C9 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5283,7 +5283,7 @@ public:
 	unsigned long                                      bPredictRespawns : 1;                             		// 0x02E0 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5338,7 +5338,7 @@ public:
 	unsigned char                                      CurrentFireMode;                                  		// 0x03B0 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5451,7 +5451,7 @@ public:
 	unsigned long                                      bMustHoldWeapon : 1;                              		// 0x0298 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5502,7 +5502,7 @@ class AKeypoint : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5516,7 +5516,7 @@ class ATargetPoint : public AKeypoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5531,7 +5531,7 @@ public:
 	class UMaterialInstanceConstant*                   MatInst;                                          		// 0x0270 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5553,7 +5553,7 @@ public:
 	unsigned char                                      SFXReplicationTriggerDummy;                       		// 0x0288 (0x0001) [0x0000000000000020]              ( CPF_Net )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5629,7 +5629,7 @@ public:
 	unsigned long                                      bShouldSaveForCheckpoint : 1;                     		// 0x0370 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5693,7 +5693,7 @@ public:
 	unsigned char                                      LocationDescription;                              		// 0x0408 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5750,7 +5750,7 @@ public:
 	class AActor*                                      m_aContainingActor;                               		// 0x040C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5767,7 +5767,7 @@ public:
 	unsigned long                                      bIgnoreSizeLimits : 1;                            		// 0x0380 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5787,7 +5787,7 @@ class ASFXDynamicCoverSlotMarker : public ACoverSlotMarker
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5809,7 +5809,7 @@ public:
 	unsigned char                                      DoorType;                                         		// 0x0388 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5830,7 +5830,7 @@ public:
 	class AController*                                 CurrentUser;                                      		// 0x0374 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5846,7 +5846,7 @@ public:
 	class ALadder*                                     LadderList;                                       		// 0x037C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5861,7 +5861,7 @@ class AAutoLadder : public ALadder
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5881,7 +5881,7 @@ public:
 	unsigned long                                      bJumpLift : 1;                                    		// 0x0398 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5901,7 +5901,7 @@ public:
 	unsigned long                                      bExitOnly : 1;                                    		// 0x037C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5919,7 +5919,7 @@ public:
 	struct FCoverInfo                                  OwningSlot;                                       		// 0x0374 (0x000C) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5933,7 +5933,7 @@ class AObjective : public ANavigationPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5947,7 +5947,7 @@ class APathNode : public ANavigationPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5965,7 +5965,7 @@ public:
 	unsigned long                                      bManualSizing : 1;                                		// 0x037C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5990,7 +5990,7 @@ public:
 	unsigned long                                      bRespawnPaused : 1;                               		// 0x039C (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6030,7 +6030,7 @@ public:
 	unsigned long                                      bPrimaryStart : 1;                                		// 0x0378 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6046,7 +6046,7 @@ public:
 	class APortalTeleporter*                           MyPortal;                                         		// 0x0374 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6090,7 +6090,7 @@ public:
 	unsigned long                                      bForceObstacleMeshCollision : 1;                  		// 0x0410 (0x0004) [0x0000000000000000] [0x00000400] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6109,7 +6109,7 @@ public:
 	unsigned long                                      bOpen : 1;                                        		// 0x0414 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6127,7 +6127,7 @@ public:
 	unsigned long                                      bMoving : 1;                                      		// 0x0414 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6147,7 +6147,7 @@ public:
 	class AActor*                                      m_aContainingActor;                               		// 0x0374 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6172,7 +6172,7 @@ public:
 	unsigned long                                      bCanTeleportVehicles : 1;                         		// 0x039C (0x0004) [0x0000000000000001] [0x00000040] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6193,7 +6193,7 @@ public:
 	FString                                            Text;                                             		// 0x0270 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6228,7 +6228,7 @@ public:
 	unsigned long                                      bNotBlockedByShield : 1;                          		// 0x02E0 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6265,7 +6265,7 @@ class ARigidBodyBase : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6280,7 +6280,7 @@ public:
 	class USceneCaptureComponent*                      SceneCapture;                                     		// 0x0270 (0x0008) [0x000000000408000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6296,7 +6296,7 @@ public:
 	class UDrawFrustumComponent*                       DrawFrustum;                                      		// 0x0278 (0x0008) [0x000000000408000A]              ( CPF_Const | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6312,7 +6312,7 @@ public:
 	class UMaterialInstanceConstant*                   CubeMaterialInst;                                 		// 0x0280 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6328,7 +6328,7 @@ public:
 	class UMaterialInstanceConstant*                   ReflectMaterialInst;                              		// 0x0280 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6342,7 +6342,7 @@ class ASceneCapturePortalActor : public ASceneCaptureReflectActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6363,7 +6363,7 @@ public:
 	unsigned long                                      bCanTeleportVehicles : 1;                         		// 0x02A0 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6382,7 +6382,7 @@ class AStaticMeshActorBase : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6398,7 +6398,7 @@ public:
 	class UAudioComponent*                             oAudioComponent;                                  		// 0x0278 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6415,7 +6415,7 @@ public:
 	int                                                MaxStaticMeshComponents;                          		// 0x0280 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6432,7 +6432,7 @@ public:
 	class UStaticMeshComponent*                        StaticMeshComponent;                              		// 0x0290 (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6451,7 +6451,7 @@ public:
 	unsigned long                                      bRecentlyTriggered : 1;                           		// 0x027C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6480,7 +6480,7 @@ public:
 	unsigned char                                      ComponentType;                                    		// 0x0085 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6566,7 +6566,7 @@ public:
 	struct FScriptDelegate                             __OnQueueSubtitles__Delegate;                     		// 0x0248 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6600,7 +6600,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x00A4 (0x0004) [0x0000000000000003] [0x00000001] ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6716,7 +6716,7 @@ public:
 	float                                              ScriptRigidBodyCollisionThreshold;                		// 0x0220 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6778,7 +6778,7 @@ public:
 	unsigned long                                      bTreatAsASprite : 1;                              		// 0x022C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6798,7 +6798,7 @@ public:
 	unsigned long                                      bBlockComplexCollisionTrace : 1;                  		// 0x0294 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6812,7 +6812,7 @@ class UCameraConeComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6832,7 +6832,7 @@ public:
 	unsigned long                                      bAlwaysRenderIfSelected : 1;                      		// 0x0230 (0x0004) [0x0000000000000002] [0x00000004] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6852,7 +6852,7 @@ public:
 	unsigned long                                      bDrawLitBox : 1;                                  		// 0x023C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6872,7 +6872,7 @@ public:
 	unsigned long                                      bDrawLitCapsule : 1;                              		// 0x0238 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6890,7 +6890,7 @@ public:
 	int                                                ConeSides;                                        		// 0x0230 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6913,7 +6913,7 @@ public:
 	unsigned long                                      bDrawLitCylinder : 1;                             		// 0x0244 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6933,7 +6933,7 @@ public:
 	class UTexture*                                    Texture;                                          		// 0x0238 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6950,7 +6950,7 @@ public:
 	float                                              Height;                                           		// 0x0230 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6970,7 +6970,7 @@ public:
 	unsigned long                                      bDrawLitSphere : 1;                               		// 0x0238 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6984,7 +6984,7 @@ class UDrawPylonRadiusComponent : public UDrawSphereComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6998,7 +6998,7 @@ class UDrawSoundRadiusComponent : public UDrawSphereComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7025,7 +7025,7 @@ public:
 	float                                              DefaultLifeTime;                                  		// 0x0254 (0x0004) [0x0000000000003002]              ( CPF_Const | CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7043,7 +7043,7 @@ public:
 	float                                              CachedTexturesTimer;                              		// 0x0254 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7086,7 +7086,7 @@ public:
 	TArray<struct FStaticMeshComponentLODInfo>         LODData;                                          		// 0x0290 (0x0010) [0x0000000080001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7110,7 +7110,7 @@ public:
 	TArray<FPointer>                                   Elements;                                         		// 0x0254 (0x0010) [0x0000000000803002]              ( CPF_Const | CPF_Native | CPF_Transient | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7131,7 +7131,7 @@ public:
 	unsigned long                                      bIsScreenSizeScaled : 1;                          		// 0x0240 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7159,7 +7159,7 @@ public:
 	unsigned char                                      DepthPriorityGroup;                               		// 0x00F0 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7200,7 +7200,7 @@ public:
 	unsigned char                                      ViewMode;                                         		// 0x00D4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7224,7 +7224,7 @@ public:
 	unsigned long                                      bUpdateMatrices : 1;                              		// 0x0174 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7248,7 +7248,7 @@ public:
 	float                                              FadingIntervalTime;                               		// 0x00FC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7268,7 +7268,7 @@ public:
 	float                                              FarPlane;                                         		// 0x00F0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7285,7 +7285,7 @@ public:
 	float                                              ScaleFOV;                                         		// 0x00E8 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7302,7 +7302,7 @@ public:
 	float                                              ScaleFOV;                                         		// 0x00E0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7321,7 +7321,7 @@ public:
 	float                                              Speed;                                            		// 0x009C (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7337,7 +7337,7 @@ public:
 	float                                              Radius;                                           		// 0x00A8 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7358,7 +7358,7 @@ public:
 	unsigned long                                      m_bNoCollisionFail : 1;                           		// 0x0088 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7374,7 +7374,7 @@ public:
 	class UClass*                                      ActorClass;                                       		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7394,7 +7394,7 @@ public:
 	unsigned long                                      bGiveDefaultInventory : 1;                        		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7409,7 +7409,7 @@ public:
 	class USoundCue*                                   AmbientSoundCue;                                  		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7423,7 +7423,7 @@ class UActorFactoryAmbientSoundMovable : public UActorFactoryAmbientSound
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7438,7 +7438,7 @@ public:
 	class USoundNodeWave*                              SoundNodeWave;                                    		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7452,7 +7452,7 @@ class UActorFactoryAmbientSoundNonLoop : public UActorFactoryAmbientSoundSimple
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7466,7 +7466,7 @@ class UActorFactoryAmbientSoundSimpleToggleable : public UActorFactoryAmbientSou
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7481,7 +7481,7 @@ public:
 	class UApexDestructibleAsset*                      DestructibleAsset;                                		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7496,7 +7496,7 @@ public:
 	class AActor*                                      ArchetypeActor;                                   		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7510,7 +7510,7 @@ class UActorFactoryCoverLink : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7524,7 +7524,7 @@ class UActorFactoryDominantDirectionalLight : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7546,7 +7546,7 @@ public:
 	unsigned char                                      CollisionType;                                    		// 0x00A4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7560,7 +7560,7 @@ class UActorFactoryMover : public UActorFactoryDynamicSM
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7584,7 +7584,7 @@ public:
 	unsigned char                                      RBChannel;                                        		// 0x00D0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7599,7 +7599,7 @@ public:
 	class UParticleSystem*                             ParticleSystem;                                   		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7615,7 +7615,7 @@ public:
 	class UFracturedStaticMesh*                        FracturedStaticMesh;                              		// 0x0098 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7630,7 +7630,7 @@ public:
 	class ULensFlare*                                  LensFlareObject;                                  		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7644,7 +7644,7 @@ class UActorFactoryLight : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7658,7 +7658,7 @@ class UActorFactoryPathNode : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7681,7 +7681,7 @@ public:
 	unsigned long                                      bCastDynamicShadow : 1;                           		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7697,7 +7697,7 @@ public:
 	class UPhysXDestructible*                          PhysXDestructible;                                		// 0x0098 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7711,7 +7711,7 @@ class UActorFactoryPlayerStart : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7725,7 +7725,7 @@ class UActorFactoryPylon : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7742,7 +7742,7 @@ public:
 	struct SFXName                                     AnimSequenceName;                                 		// 0x009C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7758,7 +7758,7 @@ public:
 	class UStaticMesh*                                 StaticMesh;                                       		// 0x0098 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7772,7 +7772,7 @@ class UActorFactoryTrigger : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7787,7 +7787,7 @@ public:
 	class UClass*                                      VehicleClass;                                     		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7801,7 +7801,7 @@ class UBioEngineEnums : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7816,7 +7816,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0060 (0x0008) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7831,7 +7831,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x7C ];                            		// 0x0060 (0x007C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7846,7 +7846,7 @@ public:
 	FPointer                                           VfTable_FTickableObject;                          		// 0x0060 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7862,7 +7862,7 @@ public:
 	struct FRotator                                    Rotation;                                         		// 0x006C (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7893,7 +7893,7 @@ public:
 	unsigned long                                      bNoSmooth : 1;                                    		// 0x00B8 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7943,7 +7943,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x38 ];                            		// 0x0060 (0x0038) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7958,7 +7958,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x8C ];                            		// 0x0098 (0x008C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7973,7 +7973,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x14 ];                            		// 0x0098 (0x0014) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7988,7 +7988,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x218 ];                           		// 0x0098 (0x0218) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8003,7 +8003,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x10 ];                            		// 0x0098 (0x0010) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8083,7 +8083,7 @@ public:
 	unsigned char                                      bAltFire;                                         		// 0x0481 (0x0001) [0x0000000000000004]              ( CPF_Input )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8335,7 +8335,7 @@ public:
 	unsigned char                                      NetPlayerIndex;                                   		// 0x0785 (0x0001) [0x0000000000200002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8712,7 +8712,7 @@ public:
 	class ADebugCameraController*                      DebugCameraControllerRef;                         		// 0x0068 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8789,7 +8789,7 @@ public:
 	unsigned char                                      UnknownData01[ 0x4 ];                             		// 0x0078 (0x0004) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8805,7 +8805,7 @@ public:
 	FString                                            Text;                                             		// 0x0070 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8820,7 +8820,7 @@ public:
 	float                                              PlaybackDuration;                                 		// 0x0060 (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8835,7 +8835,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x38 ];                            		// 0x0064 (0x0038) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8850,7 +8850,7 @@ public:
 	float                                              CurrentTime;                                      		// 0x0064 (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8866,7 +8866,7 @@ public:
 	TArray<struct FPresetGeneratedPoint>               Points;                                           		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8881,7 +8881,7 @@ class UCustomPropertyItemHandler : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8917,7 +8917,7 @@ public:
 	unsigned long                                      bRadialDamageVelChange : 1;                       		// 0x00BC (0x0004) [0x0000000000000001] [0x00000200] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8934,7 +8934,7 @@ class UKillZDamageType : public UDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8949,7 +8949,7 @@ public:
 	int                                                FirstColoredMip;                                  		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8964,7 +8964,7 @@ public:
 	float                                              Constant;                                         		// 0x007C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8984,7 +8984,7 @@ public:
 	unsigned char                                      ParamMode;                                        		// 0x0098 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8999,7 +8999,7 @@ public:
 	struct FInterpCurveFloat                           ConstantCurve;                                    		// 0x007C (0x0014) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9017,7 +9017,7 @@ public:
 	unsigned long                                      bConsistentValue : 1;                             		// 0x0088 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9032,7 +9032,7 @@ public:
 	struct FInterpCurveVector2D                        ConstantCurve;                                    		// 0x007C (0x0014) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9049,7 +9049,7 @@ public:
 	unsigned char                                      LockedAxes;                                       		// 0x008C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9069,7 +9069,7 @@ public:
 	unsigned char                                      ParamModes[ 0x3 ];                                		// 0x00C8 (0x0003) [0x0000000000080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9086,7 +9086,7 @@ public:
 	unsigned char                                      LockedAxes;                                       		// 0x0094 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9106,7 +9106,7 @@ public:
 	unsigned char                                      LockedAxes;                                       		// 0x009B (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9126,7 +9126,7 @@ public:
 	unsigned char                                      LockedAxes[ 0x2 ];                                		// 0x0097 (0x0002) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9141,7 +9141,7 @@ public:
 	unsigned char                                      UnknownData00[ 0xA44 ];                           		// 0x0060 (0x0A44) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9156,7 +9156,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0AA4 (0x0008) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9172,7 +9172,7 @@ public:
 	FString                                            Desc;                                             		// 0x00A0 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9186,7 +9186,7 @@ class UEditorLinkSelectionInterface : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9200,7 +9200,7 @@ class UEngineTypes : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9221,7 +9221,7 @@ public:
 	unsigned long                                      bLocalizationDisabled : 1;                        		// 0x009C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9241,7 +9241,7 @@ public:
 	int                                                NumLoadErrors;                                    		// 0x00A8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9265,7 +9265,7 @@ public:
 	int                                                NumCharacters;                                    		// 0x0174 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9284,7 +9284,7 @@ public:
 	TArray<float>                                      ResolutionTestTable;                              		// 0x0178 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9300,7 +9300,7 @@ public:
 	struct FFontImportOptionsData                      Data;                                             		// 0x0060 (0x0094) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9320,7 +9320,7 @@ public:
 	unsigned long                                      bIsPaused : 1;                                    		// 0x0074 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9339,7 +9339,7 @@ public:
 	unsigned long                                      bIsLooping : 1;                                   		// 0x0070 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9366,7 +9366,7 @@ public:
 	struct FGameplayEventsHeader                       Header;                                           		// 0x017C (0x0018) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9384,7 +9384,7 @@ public:
 	TArray<int>                                        EventIDFilter;                                    		// 0x0194 (0x0010) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9413,7 +9413,7 @@ public:
 	class AGameInfo*                                   Game;                                             		// 0x0194 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9489,7 +9489,7 @@ public:
 	unsigned char                                      CurrentMouseCursor;                               		// 0x019C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9556,7 +9556,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x58 ];                            		// 0x0060 (0x0058) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9570,7 +9570,7 @@ class UInterface_NavigationHandle : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9587,7 +9587,7 @@ public:
 	int                                                ActiveTab;                                        		// 0x0070 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9611,7 +9611,7 @@ public:
 	unsigned long                                      bImportedTrack : 1;                               		// 0x008C (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9629,7 +9629,7 @@ public:
 	struct FVector                                     UmbraBoundsExtension;                             		// 0x00B8 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9645,7 +9645,7 @@ public:
     unsigned char                                      UnknownData00[0x60];                            		// 0x0070 (0x0060) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9663,7 +9663,7 @@ public:
 	unsigned char                                      UnknownData01[ 0x20C ];                           		// 0x0198 (0x020C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9678,7 +9678,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x44 ];                            		// 0x00D0 (0x0044) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9692,7 +9692,7 @@ class UDemoPlayPendingLevel : public UPendingLevel
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9706,7 +9706,7 @@ class UNetPendingLevel : public UPendingLevel
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9747,7 +9747,7 @@ public:
 	unsigned long                                      bIsRequestingUnloadAndRemoval : 1;                		// 0x00CC (0x0004) [0x0000000000002002] [0x00002000] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9762,7 +9762,7 @@ public:
 	unsigned long                                      bIsProceduralBuildingLODLevel : 1;                		// 0x00D0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9778,7 +9778,7 @@ public:
 	float                                              MaxDistance;                                      		// 0x00DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9792,7 +9792,7 @@ class ULevelStreamingKismet : public ULevelStreaming
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9806,7 +9806,7 @@ class ULevelStreamingPersistent : public ULevelStreaming
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9822,7 +9822,7 @@ public:
 	class UModel*                                      SourceModel;                                      		// 0x0070 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9849,7 +9849,7 @@ public:
 	unsigned long                                      bVisualizeAmbientOcclusion : 1;                   		// 0x008C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9864,7 +9864,7 @@ public:
 	struct FLightmassPrimitiveSettings                 LightmassSettings;                                		// 0x0060 (0x001C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9878,7 +9878,7 @@ class UMapInfo : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9892,7 +9892,7 @@ class USurface : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9913,7 +9913,7 @@ public:
 	struct FRenderCommandFence_Mirror                  ParentRefFence;                                   		// 0x00A0 (0x0004) [0x0000000000003002]              ( CPF_Const | CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10019,7 +10019,7 @@ public:
 	unsigned char                                      Xbox360GammaQuality;                              		// 0x03CA (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10033,7 +10033,7 @@ class UMaterialExpression : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10048,7 +10048,7 @@ public:
 	unsigned char                                      UnknownData00[ 0xF04 ];                           		// 0x0060 (0x0F04) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10062,7 +10062,7 @@ class UMusicTrackDataStructures : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10077,7 +10077,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x300 ];                           		// 0x0060 (0x0300) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10109,7 +10109,7 @@ public:
 	unsigned char                                      UnknownData03[ 0x30 ];                            		// 0x01AC (0x0030) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10131,7 +10131,7 @@ public:
 	unsigned char                                      UnknownData03[ 0x4 ];                             		// 0x02C0 (0x0004) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10146,7 +10146,7 @@ public:
 	TArray<class UObject*>                             ReferencedObjects;                                		// 0x0060 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10168,7 +10168,7 @@ public:
 	unsigned long                                      bGameplaySessionInProgress : 1;                   		// 0x00D0 (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10187,7 +10187,7 @@ public:
 	unsigned char                                      AsyncState;                                       		// 0x0094 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10232,7 +10232,7 @@ public:
 	TArray<struct FIdToStringMapping>                  OwnerMappings;                                    		// 0x00B8 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10262,7 +10262,7 @@ public:
 	int                                                VersionNumber;                                    		// 0x00A8 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10288,7 +10288,7 @@ public:
 	TArray<struct FStringIdToStringMapping>            ViewIdMappings;                                   		// 0x0060 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10312,7 +10312,7 @@ public:
 	int                                                TitleId;                                          		// 0x00BC (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10339,7 +10339,7 @@ public:
 	int                                                RatingId;                                         		// 0x00C0 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10389,7 +10389,7 @@ public:
 	unsigned long                                      bUseBuildIdOverride : 1;                          		// 0x0140 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10431,7 +10431,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x8 ];                             		// 0x0108 (0x0008) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10445,7 +10445,7 @@ class UPackageMapSeekFree : public UPackageMapLevel
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10468,7 +10468,7 @@ public:
 	float                                              PP_ShadowsMultiplier;                             		// 0x0088 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10515,7 +10515,7 @@ public:
 	unsigned long                                      bSentSplitJoin : 1;                               		// 0x05E0 (0x0004) [0x0000000000022002] [0x00000008] ( CPF_Const | CPF_Transient | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10551,7 +10551,7 @@ public:
 	unsigned char                                      UnknownData01[ 0x14 ];                            		// 0x6058 (0x0014) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10566,7 +10566,7 @@ public:
 	class UNetConnection*                              Parent;                                           		// 0x606C (0x0008) [0x0000000000202002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10580,7 +10580,7 @@ class UDemoRecConnection : public UNetConnection
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10595,7 +10595,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x18 ];                            		// 0x0060 (0x0018) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10610,7 +10610,7 @@ public:
 	TArray<class UPostProcessEffect*>                  Effects;                                          		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10638,7 +10638,7 @@ public:
 	unsigned char                                      SceneDPG;                                         		// 0x0084 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10679,7 +10679,7 @@ public:
 	unsigned char                                      OcclusionQuality;                                 		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10694,7 +10694,7 @@ public:
 	class UMaterialInstance*                           Material;                                         		// 0x0088 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10709,7 +10709,7 @@ public:
 	int                                                BlurKernelSize;                                   		// 0x0088 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10733,7 +10733,7 @@ public:
 	unsigned char                                      FocusType;                                        		// 0x00B4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10755,7 +10755,7 @@ public:
 	unsigned long                                      bEnableDepthOfFieldHQ : 1;                        		// 0x00D0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10774,7 +10774,7 @@ public:
 	unsigned long                                      FullMotionBlur : 1;                               		// 0x00E4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10802,7 +10802,7 @@ public:
 	unsigned char                                      PostProcessAAType;                                		// 0x0120 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10817,7 +10817,7 @@ public:
 	class UMaterialInterface*                          Material;                                         		// 0x0088 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10836,7 +10836,7 @@ public:
 	unsigned long                                      FullMotionBlur : 1;                               		// 0x0098 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10858,7 +10858,7 @@ public:
 	unsigned long                                      CastShadow : 1;                                   		// 0x0060 (0x0004) [0x0000000000000001] [0x00000080] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10873,7 +10873,7 @@ public:
 	TArray<class UMaterialInterface*>                  Materials;                                        		// 0x0064 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10888,7 +10888,7 @@ public:
 	class UStaticMesh*                                 StaticMesh;                                       		// 0x0074 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10921,7 +10921,7 @@ public:
 	unsigned char                                      PathColorIndex;                                   		// 0x00B9 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10940,7 +10940,7 @@ class UAdvancedReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10954,7 +10954,7 @@ class UCeilingReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10968,7 +10968,7 @@ class UForcedReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10983,7 +10983,7 @@ public:
 	unsigned char                                      SpecDirection;                                    		// 0x00BC (0x0001) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10998,7 +10998,7 @@ public:
 	unsigned char                                      SpecDirection;                                    		// 0x00BC (0x0001) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11012,7 +11012,7 @@ class UFloorToCeilingReachSpec : public UForcedReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11027,7 +11027,7 @@ public:
 	unsigned long                                      bClimbUp : 1;                                     		// 0x00BC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11042,7 +11042,7 @@ public:
 	unsigned char                                      SpecDirection;                                    		// 0x00BC (0x0001) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11057,7 +11057,7 @@ public:
 	unsigned char                                      SpecDirection;                                    		// 0x00BC (0x0001) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11071,7 +11071,7 @@ class UWallTransReachSpec : public UForcedReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11085,7 +11085,7 @@ class ULadderReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11099,7 +11099,7 @@ class UProscribedReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11113,7 +11113,7 @@ class UTeleportReachSpec : public UReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11129,7 +11129,7 @@ public:
 	struct FGuid                                       m_Guid;                                           		// 0x0070 (0x0010) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11173,7 +11173,7 @@ public:
 	unsigned char                                      RootMotionMode;                                   		// 0x0116 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11201,7 +11201,7 @@ public:
 	struct SFXName                                     BaseLevel;                                        		// 0x0070 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11216,7 +11216,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x2C ];                            		// 0x0060 (0x002C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11230,7 +11230,7 @@ class UServerCommandlet : public UCommandlet
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11250,7 +11250,7 @@ public:
 	struct FScriptDelegate                             __NotifyPropertyValueUpdated__Delegate;           		// 0x00B0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11333,7 +11333,7 @@ public:
 	unsigned long                                      bIsSearchInProgress : 1;                          		// 0x0160 (0x0004) [0x0000000000000002] [0x00000004] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11373,7 +11373,7 @@ public:
 	unsigned char                                      GameState;                                        		// 0x0100 (0x0001) [0x0000000040000002]              ( CPF_Const | CPF_EditInlineNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11395,7 +11395,7 @@ public:
 	unsigned long                                      bUserCreated : 1;                                 		// 0x006C (0x0004) [0x0000000000000000] [0x00000020] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11428,7 +11428,7 @@ class USFXModule_DamageBase : public USFXModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11445,7 +11445,7 @@ public:
 	unsigned char                                      UnknownData00[ 0xF8 ];                            		// 0x0060 (0x00F8) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11460,7 +11460,7 @@ public:
 	unsigned char                                      UnknownData00[ 0xA0 ];                            		// 0x0060 (0x00A0) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11475,7 +11475,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x5C ];                            		// 0x0060 (0x005C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11496,7 +11496,7 @@ public:
 	int                                                InstanceIndex;                                    		// 0x0094 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11510,7 +11510,7 @@ class USmokeTestCommandlet : public UCommandlet
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11534,7 +11534,7 @@ public:
 	unsigned long                                      bInitialised : 1;                                 		// 0x010C (0x0004) [0x0000000000202000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11580,7 +11580,7 @@ public:
 	unsigned char                                      UnknownData04[ 0x48 ];                            		// 0x0148 (0x0048) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11611,7 +11611,7 @@ public:
 	unsigned char                                      SleepFamily;                                      		// 0x0121 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11654,7 +11654,7 @@ public:
 	unsigned char                                      UnknownData02[ 0x2C ];                            		// 0x0244 (0x002C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11704,7 +11704,7 @@ public:
 	unsigned char                                      OcclusionBoundsMethod;                            		// 0x014A (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11732,7 +11732,7 @@ public:
 	unsigned long                                      m_bSupportsStaticMeshes : 1;                      		// 0x00DC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11751,7 +11751,7 @@ public:
 	unsigned long                                      ReentrantFlag : 1;                                		// 0x00D4 (0x0004) [0x0000000000002002] [0x00000001] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11802,7 +11802,7 @@ public:
 	unsigned char                                      MipGenSettings;                                   		// 0x00BF (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11850,7 +11850,7 @@ public:
 	unsigned char                                      AddressY;                                         		// 0x0172 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11867,7 +11867,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x5 ];                             		// 0x0173 (0x0005) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11882,7 +11882,7 @@ public:
 	int                                                ShadowmapFlags;                                   		// 0x0174 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11897,7 +11897,7 @@ public:
 	class UForceFeedbackWaveform*                      TheWaveForm;                                      		// 0x0060 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11955,7 +11955,7 @@ public:
     // 0x2D8 = DominantDirectionalLight (UDominantDirectionalLightComponent*)
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11969,7 +11969,7 @@ class UWwiseBaseSoundObject : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11995,7 +11995,7 @@ public:
 	int                                                CurrentPlayCount;                                 		// 0x00F4 (0x0004) [0x0000000000202002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12013,7 +12013,7 @@ public:
 	unsigned long                                      bSplitNavMesh : 1;                                		// 0x02C4 (0x0004) [0x0000000000002002] [0x00000001] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12029,7 +12029,7 @@ public:
 	FPointer                                           VfTable_IInterface_NavMeshPathObject;             		// 0x02B4 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12050,7 +12050,7 @@ public:
 	unsigned long                                      bReverseScriptedRoute : 1;                        		// 0x04A4 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12079,7 +12079,7 @@ public:
 	FPointer                                           VfTable_IInterface_NavigationHandle;              		// 0x0270 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12094,7 +12094,7 @@ class ACrowdPopulationManagerBase : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12108,7 +12108,7 @@ class APathTargetPoint : public AKeypoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12125,7 +12125,7 @@ public:
 	unsigned long                                      bPreserveInternalGeo : 1;                         		// 0x0278 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12145,7 +12145,7 @@ public:
 	FPointer                                           VfTable_IInterface_NavMeshPathObject;             		// 0x0270 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12159,7 +12159,7 @@ class UCoverGroupRenderingComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12178,7 +12178,7 @@ public:
 	class UStaticMesh*                                 Disabled;                                         		// 0x02CC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12192,7 +12192,7 @@ class UNavMeshRenderingComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12206,7 +12206,7 @@ class UPathRenderingComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12220,7 +12220,7 @@ class URouteRenderingComponent : public UPrimitiveComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12234,7 +12234,7 @@ class UInterface_NavMeshPathObject : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12248,7 +12248,7 @@ class UInterface_NavMeshPathSwitch : public UInterface_NavMeshPathObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12263,7 +12263,7 @@ class UInterface_NavMeshPathObstacle : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12291,7 +12291,7 @@ public:
 	unsigned long                                      bUltraVerbosePathDebugging : 1;                   		// 0x0110 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12340,7 +12340,7 @@ public:
 	float                                              AddedHeuristicCost;                               		// 0x0074 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12357,7 +12357,7 @@ public:
 	struct FVector                                     Direction;                                        		// 0x0078 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12373,7 +12373,7 @@ class UNavMeshPath_EnforceTwoWayEdges : public UNavMeshPathConstraint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12391,7 +12391,7 @@ public:
 	unsigned char                                      EdgeType;                                         		// 0x0088 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12409,7 +12409,7 @@ public:
 	class AActor*                                      GoalActor;                                        		// 0x0084 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12432,7 +12432,7 @@ public:
 	unsigned long                                      bOnlyThrowOutNodesThatLeaveEnvelope : 1;          		// 0x0090 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12451,7 +12451,7 @@ public:
 	unsigned long                                      bSoft : 1;                                        		// 0x0080 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12472,7 +12472,7 @@ public:
 	unsigned long                                      bAlwaysCallEvaluateGoal : 1;                      		// 0x0074 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12493,7 +12493,7 @@ public:
 	unsigned long                                      bKeepPartial : 1;                                 		// 0x0098 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12514,7 +12514,7 @@ public:
 	FPointer                                           CachedAnchorPoly;                                 		// 0x00D0 (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12532,7 +12532,7 @@ public:
 	FPointer                                           PartialGoal;                                      		// 0x0078 (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12549,7 +12549,7 @@ class UNavMeshGoal_PolyEncompassesAI : public UNavMeshPathGoalEvaluator
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12567,7 +12567,7 @@ public:
 	int                                                CacheIdx;                                         		// 0x0068 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12584,7 +12584,7 @@ public:
 	struct FVector                                     Direction;                                        		// 0x006C (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12604,7 +12604,7 @@ public:
 	int                                                MoveFlags;                                        		// 0x0078 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12624,7 +12624,7 @@ public:
 	float                                              MinDistBetweenSpecTypes;                          		// 0x0080 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12641,7 +12641,7 @@ public:
 	class AActor*                                      GoalActor;                                        		// 0x006C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12658,7 +12658,7 @@ public:
 	struct FVector                                     GoalPoint;                                        		// 0x006C (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12680,7 +12680,7 @@ public:
 	unsigned long                                      bOnlyThrowOutNodesThatLeaveEnvelope : 1;          		// 0x0084 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12699,7 +12699,7 @@ public:
 	unsigned long                                      bSoft : 1;                                        		// 0x0074 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12720,7 +12720,7 @@ public:
 	unsigned long                                      AllowStartNodeToBeGoal : 1;                       		// 0x0078 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12739,7 +12739,7 @@ public:
 	unsigned long                                      bKeepPartial : 1;                                 		// 0x0088 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12755,7 +12755,7 @@ class UGoal_Null : public UPathGoalEvaluator
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12782,7 +12782,7 @@ public:
 	unsigned long                                      bShouldDoAnimNotifies : 1;                        		// 0x02C0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12828,7 +12828,7 @@ public:
 	TArray<struct FSkelMaterialSetterDatum>            NonExtremeContent;                                		// 0x02D4 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12844,7 +12844,7 @@ class ASkeletalMeshActorSpawnable : public ASkeletalMeshActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12858,7 +12858,7 @@ class ASkeletalMeshCinematicActor : public ASkeletalMeshActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12873,7 +12873,7 @@ public:
 	TArray<class UAnimNodeSlot*>                       SlotNodes;                                        		// 0x02C4 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12903,7 +12903,7 @@ public:
 	unsigned char                                      RotationCompressionFormat;                        		// 0x0075 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12917,7 +12917,7 @@ class UAnimationCompressionAlgorithm_BitwiseCompressOnly : public UAnimationComp
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12933,7 +12933,7 @@ public:
 	unsigned long                                      bStartAtSecondKey : 1;                            		// 0x007C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12953,7 +12953,7 @@ public:
 	unsigned long                                      bRetarget : 1;                                    		// 0x008C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12969,7 +12969,7 @@ public:
 	float                                              MaxAngleDiff;                                     		// 0x007C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12983,7 +12983,7 @@ class UAnimationCompressionAlgorithm_RevertToRaw : public UAnimationCompressionA
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12997,7 +12997,7 @@ class UAnimMetaData : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13013,7 +13013,7 @@ public:
 	unsigned long                                      bFullControlOverController : 1;                   		// 0x0070 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13028,7 +13028,7 @@ public:
 	TArray<struct FTimeModifier>                       KeyFrames;                                        		// 0x0074 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13042,7 +13042,7 @@ class UAnimNotify : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13058,7 +13058,7 @@ public:
 	class UClass*                                      CameraLensEffect;                                 		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13073,7 +13073,7 @@ public:
 	int                                                FootDown;                                         		// 0x0060 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13088,7 +13088,7 @@ public:
 	struct SFXName                                     NotifyName;                                       		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13108,7 +13108,7 @@ public:
 	unsigned long                                      bSkipIfOwnerIsHidden : 1;                         		// 0x0078 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13126,7 +13126,7 @@ public:
 	unsigned long                                      bCheckForBasedPlayer : 1;                         		// 0x0074 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13143,7 +13143,7 @@ public:
 	struct SFXName                                     NotifyEndName;                                    		// 0x0070 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13157,7 +13157,7 @@ class UAnimNotify_Scripted : public UAnimNotify
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13184,7 +13184,7 @@ public:
 	unsigned long                                      bUseBoneLocation : 1;                             		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13204,7 +13204,7 @@ public:
 	unsigned long                                      bIgnoreIfActorHidden : 1;                         		// 0x0074 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13232,7 +13232,7 @@ public:
 	unsigned long                                      bResampleRequired : 1;                            		// 0x00AC (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13248,7 +13248,7 @@ public:
 	class USkeletalMeshComponent*                      SkelComponent;                                    		// 0x0060 (0x0008) [0x000000000408200A]              ( CPF_Const | CPF_ExportObject | CPF_Transient | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13279,7 +13279,7 @@ public:
 	unsigned char                                      CachedNumDesiredBones;                            		// 0x00E4 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13303,7 +13303,7 @@ public:
 	unsigned char                                      BlendTypeAlpha;                                   		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13323,7 +13323,7 @@ public:
 	unsigned char                                      RotationBlendType;                                		// 0x0118 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13352,7 +13352,7 @@ public:
 	unsigned char                                      ForcedAimDir;                                     		// 0x0164 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13372,7 +13372,7 @@ public:
 	unsigned long                                      bSkipBlendWhenNotRendered : 1;                    		// 0x010C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13388,7 +13388,7 @@ public:
 	unsigned long                                      bPassThroughWhenNotRendered : 1;                  		// 0x0110 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13406,7 +13406,7 @@ public:
 	unsigned long                                      bForceLocalSpaceBlend : 1;                        		// 0x0140 (0x0004) [0x0000000000000003] [0x00000001] ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13423,7 +13423,7 @@ public:
 	unsigned long                                      bDontBlendOutOneShot : 1;                         		// 0x011C (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13443,7 +13443,7 @@ public:
 	unsigned long                                      bIsPlayingCustomAnim : 1;                         		// 0x0114 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13468,7 +13468,7 @@ public:
 	int                                                SingleAnimAtOrAboveLOD;                           		// 0x0114 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13488,7 +13488,7 @@ public:
 	unsigned long                                      bSkipBlendWhenNotRendered : 1;                    		// 0x0118 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13508,7 +13508,7 @@ public:
 	unsigned char                                      Type;                                             		// 0x0138 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13522,7 +13522,7 @@ class UAnimNodeBlendByPhysics : public UAnimNodeBlendList
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13536,7 +13536,7 @@ class UAnimNodeBlendByPosture : public UAnimNodeBlendList
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13562,7 +13562,7 @@ public:
 	unsigned long                                      bSynchronizeNodesInEditor : 1;                    		// 0x0150 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13586,7 +13586,7 @@ public:
 	unsigned long                                      bUseAcceleration : 1;                             		// 0x014C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13603,7 +13603,7 @@ public:
 	int                                                PendingChildIndex;                                		// 0x0134 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13619,7 +13619,7 @@ public:
 	TArray<unsigned char>                              SourceRequiredBones;                              		// 0x0110 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13635,7 +13635,7 @@ public:
 	unsigned long                                      bEnableMirroring : 1;                             		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13650,7 +13650,7 @@ public:
 	float                                              ScaleByValue;                                     		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13665,7 +13665,7 @@ public:
 	float                                              BaseSpeed;                                        		// 0x0104 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13689,7 +13689,7 @@ public:
 	unsigned long                                      bAdditiveAnimationsOverrideSource : 1;            		// 0x0128 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13715,7 +13715,7 @@ public:
 	TArray<struct FSynchGroup>                         Groups;                                           		// 0x0100 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13742,7 +13742,7 @@ public:
 	unsigned long                                      bUseSavedPose : 1;                                		// 0x0160 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13800,7 +13800,7 @@ public:
 	unsigned char                                      RootRotationOption[ 0x3 ];                        		// 0x0137 (0x0003) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13827,7 +13827,7 @@ public:
 	TArray<struct FAnimBlendInfo>                      Anims;                                            		// 0x013C (0x0010) [0x0000000004400049]              ( CPF_Edit | CPF_ExportObject | CPF_EditConstArray | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13855,7 +13855,7 @@ public:
 	struct SFXName                                     AnimName_RD;                                      		// 0x01B4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13872,7 +13872,7 @@ public:
 	unsigned long                                      bDrawSlider : 1;                                  		// 0x0070 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13889,7 +13889,7 @@ public:
 	TArray<float>                                      Weights;                                          		// 0x0094 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13909,7 +13909,7 @@ public:
 	float                                              Weight;                                           		// 0x0084 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13925,7 +13925,7 @@ public:
 	TArray<struct FMorphNodeConn>                      NodeConns;                                        		// 0x0074 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13940,7 +13940,7 @@ public:
 	float                                              NodeWeight;                                       		// 0x0084 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13968,7 +13968,7 @@ public:
 	unsigned char                                      AngleBoneAxis;                                    		// 0x00C5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13992,7 +13992,7 @@ public:
 	unsigned char                                      BoneAxis;                                         		// 0x00BC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14028,7 +14028,7 @@ public:
 	unsigned char                                      BlendType;                                        		// 0x00D0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14057,7 +14057,7 @@ public:
 	unsigned char                                      EffectorLocationSpace;                            		// 0x011C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14073,7 +14073,7 @@ public:
 	float                                              TwistAngleScale;                                  		// 0x00DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14102,7 +14102,7 @@ public:
 	unsigned char                                      JointAxis;                                        		// 0x0113 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14125,7 +14125,7 @@ public:
 	unsigned char                                      FootUpAxis;                                       		// 0x0134 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14169,7 +14169,7 @@ public:
 	unsigned char                                      AllowRotationSpace;                               		// 0x0147 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14198,7 +14198,7 @@ public:
 	unsigned char                                      BoneRotationSpace;                                		// 0x0101 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14217,7 +14217,7 @@ public:
 	unsigned char                                      HandlebarRotateAxis;                              		// 0x0115 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14239,7 +14239,7 @@ public:
 	unsigned char                                      WheelSteeringAxis;                                		// 0x0119 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14259,7 +14259,7 @@ public:
 	unsigned char                                      BoneRotMode;                                      		// 0x00E5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14286,7 +14286,7 @@ public:
 	unsigned char                                      ChainBoneAxis;                                    		// 0x0150 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14328,7 +14328,7 @@ public:
 	unsigned char                                      KeyEncodingFormat;                                		// 0x0122 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14346,7 +14346,7 @@ public:
 	class UBioAnimSetData*                             m_pBioAnimSetData;                                		// 0x0078 (0x0008) [0x0000000004020001]              ( CPF_Edit | CPF_EditConst | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14363,7 +14363,7 @@ public:
 	struct SFXName                                     m_nmOrigSetName;                                  		// 0x00D0 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14382,7 +14382,7 @@ public:
 	unsigned long                                      bAnimRotationOnly : 1;                            		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14402,7 +14402,7 @@ public:
 	TArray<int>                                        OffsetSkeleton_dep;                               		// 0x0094 (0x0010) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14418,7 +14418,7 @@ public:
 	class USkeletalMesh*                               BaseSkelMesh;                                     		// 0x0070 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14433,7 +14433,7 @@ class UMorphWeightSequence : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14448,7 +14448,7 @@ public:
 	class UDecalComponent*                             Decal;                                            		// 0x0270 (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14462,7 +14462,7 @@ class ADecalActor : public ADecalActorBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14476,7 +14476,7 @@ class ADecalActorMovable : public ADecalActorBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14497,7 +14497,7 @@ public:
 	float                                              DecalDepthBias;                                   		// 0x02A8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14570,7 +14570,7 @@ public:
 	unsigned char                                      FilterMode;                                       		// 0x036D (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14588,7 +14588,7 @@ public:
 	class UMaterialInterface*                          DecalMaterial;                                    		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14602,7 +14602,7 @@ class UDecalMaterial : public UMaterial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14619,7 +14619,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x0280 (0x0004) [0x0000000100000020] [0x00000001] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14639,7 +14639,7 @@ class AFogVolumeConeDensityInfo : public AFogVolumeDensityInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14653,7 +14653,7 @@ class AFogVolumeConstantDensityInfo : public AFogVolumeDensityInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14667,7 +14667,7 @@ class AFogVolumeLinearHalfspaceDensityInfo : public AFogVolumeDensityInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14681,7 +14681,7 @@ class AFogVolumeSphericalDensityInfo : public AFogVolumeDensityInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14703,7 +14703,7 @@ public:
 	unsigned long                                      bAffectsTranslucency : 1;                         		// 0x00CC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14724,7 +14724,7 @@ public:
 	float                                              ConeMaxAngle;                                     		// 0x00F8 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14739,7 +14739,7 @@ public:
 	float                                              Density;                                          		// 0x00D0 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14755,7 +14755,7 @@ public:
 	float                                              PlaneDistanceFactor;                              		// 0x00E0 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14773,7 +14773,7 @@ public:
 	float                                              SphereRadius;                                     		// 0x00E8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14789,7 +14789,7 @@ public:
 	unsigned long                                      bNothingSelected : 1;                             		// 0x0094 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14803,7 +14803,7 @@ class UActorFactoryFogVolumeLinearHalfspaceDensityInfo : public UActorFactoryFog
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14817,7 +14817,7 @@ class UActorFactoryFogVolumeSphericalDensityInfo : public UActorFactoryFogVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14833,7 +14833,7 @@ public:
 	class UApexStaticDestructibleComponent*            StaticDestructibleComponent;                      		// 0x0280 (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14865,7 +14865,7 @@ public:
 	unsigned long                                      bBreakChunksOnActorTouch : 1;                     		// 0x0300 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14907,7 +14907,7 @@ public:
 	unsigned char                                      AsleepRBChannel;                                  		// 0x0334 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14945,7 +14945,7 @@ public:
 	unsigned char                                      NumPartsRemaining;                                		// 0x03B8 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14978,7 +14978,7 @@ public:
 	unsigned long                                      bEnableSpawnChunkEffectForRadialDamage : 1;       		// 0x02B0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15016,7 +15016,7 @@ public:
 	unsigned char                                      NumMeshesRemaining;                               		// 0x02B8 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15037,7 +15037,7 @@ public:
 	unsigned long                                      bAssetChanged : 1;                                		// 0x0270 (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15052,7 +15052,7 @@ public:
 	FPointer                                           ComponentDynamicResources;                        		// 0x0274 (0x0008) [0x0000000000003002]              ( CPF_Const | CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15066,7 +15066,7 @@ class UApexStaticComponent : public UApexComponentBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15082,7 +15082,7 @@ public:
 	FPointer                                           ApexDestructiblePreview;                          		// 0x027C (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15107,7 +15107,7 @@ public:
 	unsigned long                                      bUseDynamicIBWithHiddenFragments : 1;             		// 0x02C8 (0x0004) [0x0000000000000002] [0x00000010] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15131,7 +15131,7 @@ public:
 	unsigned long                                      bFragmentTransformsChanged : 1;                   		// 0x02F4 (0x0004) [0x0000000000002002] [0x00000002] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15156,7 +15156,7 @@ public:
 	unsigned long                                      bBottomFragmentsRootNonDestroyable : 1;           		// 0x0314 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15186,7 +15186,7 @@ public:
 	int                                                InstancingRandomSeed;                             		// 0x02C8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15203,7 +15203,7 @@ public:
 	unsigned long                                      bSmoothInterpRollScale : 1;                       		// 0x0304 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15221,7 +15221,7 @@ public:
 	class URB_BodySetup*                               DetailedCollision;                                		// 0x0254 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15236,7 +15236,7 @@ public:
 	TArray<class UApexComponentBase*>                  ApexComponents;                                   		// 0x0060 (0x0010) [0x000000000408300A]              ( CPF_Const | CPF_ExportObject | CPF_Native | CPF_Transient | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15262,7 +15262,7 @@ public:
 	unsigned long                                      bSlowStart : 1;                                   		// 0x0098 (0x0004) [0x0000000004000003] [0x00000004] ( CPF_Edit | CPF_Const | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15282,7 +15282,7 @@ public:
 	unsigned long                                      bDynamic : 1;                                     		// 0x0128 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15297,7 +15297,7 @@ public:
 	FPointer                                           MApexAsset;                                       		// 0x0070 (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15315,7 +15315,7 @@ public:
 	class UFracturedStaticMesh*                        FracturedStaticMesh;                              		// 0x00BC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15333,7 +15333,7 @@ public:
 	int                                                MaxDepth;                                         		// 0x0090 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15364,7 +15364,7 @@ public:
 	int                                                SupportDepth;                                     		// 0x0128 (0x0004) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15384,7 +15384,7 @@ public:
 	FString                                            Caption;                                          		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15398,7 +15398,7 @@ class UInterpFilter_Classes : public UInterpFilter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15412,7 +15412,7 @@ class UInterpFilter_Custom : public UInterpFilter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15440,7 +15440,7 @@ public:
 	unsigned char                                      m_eSFXFindActorMode;                              		// 0x00A4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15458,7 +15458,7 @@ public:
 	unsigned long                                      AllowDeferredActorAttach : 1;                     		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15472,7 +15472,7 @@ class UInterpGroupDirector : public UInterpGroup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15489,7 +15489,7 @@ public:
 	float                                              m_fPlayRate;                                      		// 0x00BC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15509,7 +15509,7 @@ public:
 	unsigned long                                      SFXGroupActorIsSet : 1;                           		// 0x0080 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15525,7 +15525,7 @@ public:
 	unsigned char                                      SavedPhysics;                                     		// 0x008C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15539,7 +15539,7 @@ class UInterpGroupInstDirector : public UInterpGroupInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15556,7 +15556,7 @@ public:
 	int                                                m_nNextKey;                                       		// 0x00A4 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15576,7 +15576,7 @@ public:
 	unsigned long                                      bSimulateCameraCutsOnClients : 1;                 		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15594,7 +15594,7 @@ public:
 	unsigned long                                      bFireEventsWhenJumpingForwards : 1;               		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15619,7 +15619,7 @@ public:
 	unsigned char                                      m_eSFXFindActorMode;                              		// 0x012C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15635,7 +15635,7 @@ public:
 	float                                              CurveTension;                                     		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15651,7 +15651,7 @@ public:
 	struct SFXName                                     SlotName;                                         		// 0x00B8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15666,7 +15666,7 @@ public:
 	unsigned long                                      bPersistFade : 1;                                 		// 0x00A8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15682,7 +15682,7 @@ public:
 	struct SFXName                                     ParamName;                                        		// 0x00B8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15697,7 +15697,7 @@ public:
 	struct SFXName                                     ParamName;                                        		// 0x00A8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15712,7 +15712,7 @@ public:
 	struct SFXName                                     PropertyName;                                     		// 0x00A8 (0x0008) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15727,7 +15727,7 @@ public:
 	struct SFXName                                     MorphNodeName;                                    		// 0x00A8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15742,7 +15742,7 @@ public:
 	struct SFXName                                     SkelControlName;                                  		// 0x00A8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15756,7 +15756,7 @@ class UInterpTrackSlomo : public UInterpTrackFloatBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15772,7 +15772,7 @@ public:
 	float                                              CurveTension;                                     		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15787,7 +15787,7 @@ public:
 	struct SFXName                                     PropertyName;                                     		// 0x00A8 (0x0008) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15816,7 +15816,7 @@ public:
 	unsigned char                                      RotMode;                                          		// 0x00DD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15831,7 +15831,7 @@ public:
 	TArray<struct FParticleReplayTrackKey>             TrackKeys;                                        		// 0x0090 (0x0010) [0x0000000004400000]              ( CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15850,7 +15850,7 @@ public:
 	unsigned long                                      bFireEventsWhenJumpingForwards : 1;               		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15866,7 +15866,7 @@ public:
 	float                                              CurveTension;                                     		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15880,7 +15880,7 @@ class UInterpTrackAudioMaster : public UInterpTrackVectorBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15895,7 +15895,7 @@ public:
 	struct SFXName                                     PropertyName;                                     		// 0x00A8 (0x0008) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15909,7 +15909,7 @@ class UInterpTrackColorScale : public UInterpTrackVectorBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15926,7 +15926,7 @@ public:
 	unsigned long                                      bSuppressSubtitles : 1;                           		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15942,7 +15942,7 @@ public:
 	struct SFXName                                     ParamName;                                        		// 0x00B8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15957,7 +15957,7 @@ public:
 	struct SFXName                                     PropertyName;                                     		// 0x00A8 (0x0008) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15975,7 +15975,7 @@ public:
 	unsigned long                                      bFireEventsWhenJumpingForwards : 1;               		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15989,7 +15989,7 @@ class UInterpTrackInst : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16004,7 +16004,7 @@ public:
 	float                                              m_fLastUpdatePosition;                            		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16020,7 +16020,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0070 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16034,7 +16034,7 @@ class UInterpTrackInstAudioMaster : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16048,7 +16048,7 @@ class UInterpTrackInstColorScale : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16063,7 +16063,7 @@ public:
 	class AActor*                                      OldViewTarget;                                    		// 0x0060 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16078,7 +16078,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16095,7 +16095,7 @@ public:
 	unsigned long                                      bFirstUpdate : 1;                                 		// 0x006C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16109,7 +16109,7 @@ class UInterpTrackInstFade : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16124,7 +16124,7 @@ public:
 	TArray<float>                                      ResetFloats;                                      		// 0x0060 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16139,7 +16139,7 @@ public:
 	float                                              ResetFloat;                                       		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16153,7 +16153,7 @@ class UInterpTrackInstMorphWeight : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16172,7 +16172,7 @@ public:
 	unsigned char                                      m_nSavedPhysicsMode;                              		// 0x00C8 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16187,7 +16187,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16203,7 +16203,7 @@ public:
 	class UObject*                                     PropertyOuterObjectInst;                          		// 0x0068 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16219,7 +16219,7 @@ public:
 	struct FColor                                      ResetColor;                                       		// 0x0078 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16235,7 +16235,7 @@ public:
 	float                                              ResetFloat;                                       		// 0x0078 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16251,7 +16251,7 @@ public:
 	struct FLinearColor                                ResetColor;                                       		// 0x0078 (0x0010) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16267,7 +16267,7 @@ public:
 	struct FVector                                     ResetVector;                                      		// 0x0078 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16281,7 +16281,7 @@ class UInterpTrackInstSkelControlScale : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16296,7 +16296,7 @@ public:
 	float                                              OldTimeDilation;                                  		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16312,7 +16312,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0068 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16329,7 +16329,7 @@ public:
 	unsigned char                                      Action;                                           		// 0x0068 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16344,7 +16344,7 @@ public:
 	TArray<struct FVector>                             ResetVectors;                                     		// 0x0060 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16360,7 +16360,7 @@ public:
 	unsigned char                                      Action;                                           		// 0x0064 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16374,7 +16374,7 @@ class USFXInterpAuditionHelperInterface : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16389,7 +16389,7 @@ public:
 	class USFXSceneShopGameData*                       m_pSceneGameData;                                 		// 0x0060 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16407,7 +16407,7 @@ public:
 	float                                              m_fPreviewPosition;                               		// 0x00D0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16425,7 +16425,7 @@ public:
 	unsigned long                                      m_bProcessingScenes : 1;                          		// 0x0140 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16440,7 +16440,7 @@ public:
 	TArray<class USFXSceneShopNode*>                   m_aNodes;                                         		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16456,7 +16456,7 @@ public:
 	TArray<struct FSFXSSNodePin>                       m_aInputPins;                                     		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16472,7 +16472,7 @@ public:
 	unsigned char                                      BaseProperty;                                     		// 0x0068 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16487,7 +16487,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16503,7 +16503,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16519,7 +16519,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16537,7 +16537,7 @@ public:
 	float                                              ReferencePlane;                                   		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16551,7 +16551,7 @@ class UMaterialExpressionCameraVector : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16565,7 +16565,7 @@ class UMaterialExpressionCameraWorldPosition : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16580,7 +16580,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16597,7 +16597,7 @@ public:
 	struct FExpressionInput                            Max;                                              		// 0x00A0 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16616,7 +16616,7 @@ public:
 	int                                                SizeY;                                            		// 0x007C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16635,7 +16635,7 @@ public:
 	unsigned long                                      A : 1;                                            		// 0x0080 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16652,7 +16652,7 @@ public:
 	unsigned long                                      bExpanded : 1;                                    		// 0x0080 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16667,7 +16667,7 @@ public:
 	float                                              R;                                                		// 0x0060 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16683,7 +16683,7 @@ public:
 	float                                              G;                                                		// 0x0064 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16700,7 +16700,7 @@ public:
 	float                                              B;                                                		// 0x0068 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16718,7 +16718,7 @@ public:
 	float                                              A;                                                		// 0x006C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16735,7 +16735,7 @@ public:
 	float                                              Scale;                                            		// 0x0084 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16752,7 +16752,7 @@ public:
 	float                                              Max;                                              		// 0x0084 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16768,7 +16768,7 @@ public:
 	float                                              Period;                                           		// 0x0080 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16784,7 +16784,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16802,7 +16802,7 @@ public:
 	unsigned char                                      OutputType;                                       		// 0x0090 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16817,7 +16817,7 @@ public:
 	class UTexture*                                    Texture;                                          		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16835,7 +16835,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x00A4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16854,7 +16854,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x00C4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16869,7 +16869,7 @@ public:
 	struct FExpressionInput                            InXY;                                             		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16886,7 +16886,7 @@ public:
 	struct FLinearColor                                LuminanceFactors;                                 		// 0x00A0 (0x0010) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16900,7 +16900,7 @@ class UMaterialExpressionDestColor : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16915,7 +16915,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x0060 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16931,7 +16931,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16947,7 +16947,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16963,7 +16963,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16978,7 +16978,7 @@ public:
 	TArray<FString>                                    ParamNames;                                       		// 0x0060 (0x0010) [0x0000000000400041]              ( CPF_Edit | CPF_EditConstArray | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16992,7 +16992,7 @@ class UMaterialExpressionMeshEmitterDynamicParameter : public UMaterialExpressio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17007,7 +17007,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17021,7 +17021,7 @@ class UMaterialExpressionFluidNormal : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17037,7 +17037,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17051,7 +17051,7 @@ class UMaterialExpressionFoliageImpulseDirection : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17065,7 +17065,7 @@ class UMaterialExpressionFoliageNormalizedRotationAxisAndAngle : public UMateria
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17081,7 +17081,7 @@ public:
 	int                                                FontTexturePage;                                  		// 0x0068 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17097,7 +17097,7 @@ public:
 	struct SFXName                                     ParameterName;                                    		// 0x007C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17112,7 +17112,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17128,7 +17128,7 @@ public:
 	float                                              Exponent;                                         		// 0x0080 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17147,7 +17147,7 @@ public:
 	struct FExpressionInput                            ALessThanB;                                       		// 0x00E0 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17161,7 +17161,7 @@ class UMaterialExpressionLensFlareIntensity : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17175,7 +17175,7 @@ class UMaterialExpressionLensFlareOcclusion : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17189,7 +17189,7 @@ class UMaterialExpressionLensFlareRadialDistance : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17203,7 +17203,7 @@ class UMaterialExpressionLensFlareRayDistance : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17217,7 +17217,7 @@ class UMaterialExpressionLensFlareSourceDistance : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17231,7 +17231,7 @@ class UMaterialExpressionLightmapUVs : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17247,7 +17247,7 @@ public:
 	struct FExpressionInput                            Lightmass;                                        		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17261,7 +17261,7 @@ class UMaterialExpressionLightVector : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17278,7 +17278,7 @@ public:
 	struct FExpressionInput                            Alpha;                                            		// 0x00A0 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17292,7 +17292,7 @@ class UMaterialExpressionMeshEmitterVertexColor : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17308,7 +17308,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17323,7 +17323,7 @@ public:
 	struct FExpressionInput                            VectorInput;                                      		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17337,7 +17337,7 @@ class UMaterialExpressionObjectOrientation : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17351,7 +17351,7 @@ class UMaterialExpressionObjectRadius : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17365,7 +17365,7 @@ class UMaterialExpressionObjectWorldPosition : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17379,7 +17379,7 @@ class UMaterialExpressionOcclusionPercentage : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17394,7 +17394,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17412,7 +17412,7 @@ public:
 	float                                              SpeedY;                                           		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17428,7 +17428,7 @@ public:
 	struct SFXName                                     ParameterName;                                    		// 0x0070 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17443,7 +17443,7 @@ public:
 	float                                              DefaultValue;                                     		// 0x0078 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17457,7 +17457,7 @@ class UBioMaterialExpressionEffectMatFractionEnabled : public UMaterialExpressio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17477,7 +17477,7 @@ public:
 	unsigned long                                      DefaultA : 1;                                     		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17496,7 +17496,7 @@ public:
 	unsigned long                                      ExtendedCaptionDisplay : 1;                       		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17511,7 +17511,7 @@ public:
 	struct FLinearColor                                DefaultValue;                                     		// 0x0078 (0x0010) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17526,7 +17526,7 @@ public:
 	unsigned long                                      bUseViewSpace : 1;                                		// 0x0060 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17540,7 +17540,7 @@ class UMaterialExpressionPerInstanceRandom : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17555,7 +17555,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x0060 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17571,7 +17571,7 @@ public:
 	struct FExpressionInput                            Exponent;                                         		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17585,7 +17585,7 @@ class UMaterialExpressionReflectionVector : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17602,7 +17602,7 @@ public:
 	struct FExpressionInput                            Position;                                         		// 0x00A0 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17621,7 +17621,7 @@ public:
 	float                                              Speed;                                            		// 0x00A8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17637,7 +17637,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x0080 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17654,7 +17654,7 @@ public:
 	unsigned char                                      SceneTextureType;                                 		// 0x0084 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17669,7 +17669,7 @@ public:
 	unsigned long                                      ScreenAlign : 1;                                  		// 0x0060 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17685,7 +17685,7 @@ public:
 	float                                              Period;                                           		// 0x0080 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17703,7 +17703,7 @@ public:
 	float                                              HardnessPercent;                                  		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17718,7 +17718,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17734,7 +17734,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17753,7 +17753,7 @@ public:
 	unsigned long                                      UnMirrorV : 1;                                    		// 0x006C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17770,7 +17770,7 @@ public:
 	unsigned long                                      bDecompressNormalMap : 1;                         		// 0x0088 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17787,7 +17787,7 @@ public:
 	unsigned long                                      bNormalize : 1;                                   		// 0x00B0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17801,7 +17801,7 @@ class UMaterialExpressionFlipBookSample : public UMaterialExpressionTextureSampl
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17815,7 +17815,7 @@ class UMaterialExpressionMeshSubUV : public UMaterialExpressionTextureSample
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17829,7 +17829,7 @@ class UMaterialExpressionMeshSubUVBlend : public UMaterialExpressionMeshSubUV
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17843,7 +17843,7 @@ class UMaterialExpressionParticleSubUV : public UMaterialExpressionTextureSample
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17859,7 +17859,7 @@ public:
 	struct SFXName                                     ParameterName;                                    		// 0x009C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17873,7 +17873,7 @@ class UMaterialExpressionTextureSampleParameter2D : public UMaterialExpressionTe
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17889,7 +17889,7 @@ public:
 	unsigned char                                      Channel;                                          		// 0x00A8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17903,7 +17903,7 @@ class UMaterialExpressionTextureSampleParameterMeshSubUV : public UMaterialExpre
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17917,7 +17917,7 @@ class UMaterialExpressionTextureSampleParameterMeshSubUVBlend : public UMaterial
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17931,7 +17931,7 @@ class UMaterialExpressionTextureSampleParameterSubUV : public UMaterialExpressio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17945,7 +17945,7 @@ class UMaterialExpressionTextureSampleParameterCube : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17959,7 +17959,7 @@ class UMaterialExpressionTextureSampleParameterMovie : public UMaterialExpressio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17974,7 +17974,7 @@ public:
 	FPointer                                           InstanceOverride;                                 		// 0x00A4 (0x0008) [0x0000000000003002]              ( CPF_Const | CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17989,7 +17989,7 @@ public:
 	unsigned long                                      bIgnorePause : 1;                                 		// 0x0060 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18006,7 +18006,7 @@ public:
 	unsigned char                                      TransformType;                                    		// 0x0081 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18022,7 +18022,7 @@ public:
 	unsigned char                                      TransformType;                                    		// 0x0080 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18036,7 +18036,7 @@ class UMaterialExpressionTwoSidedSign : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18050,7 +18050,7 @@ class UMaterialExpressionVertexColor : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18064,7 +18064,7 @@ class UMaterialExpressionWindDirectionAndSpeed : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18078,7 +18078,7 @@ class UMaterialExpressionWorldNormal : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18092,7 +18092,7 @@ class UMaterialExpressionWorldPosition : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18115,7 +18115,7 @@ public:
 	unsigned long                                      ReentrantFlag : 1;                                		// 0x00F4 (0x0004) [0x0000000000001002] [0x00000004] ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18143,7 +18143,7 @@ public:
 	TArray<struct FTextureParameterValue>              TextureParameterValues;                           		// 0x0128 (0x0010) [0x0000000000400003]              ( CPF_Edit | CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18163,7 +18163,7 @@ class UBioMaterialInstanceConstant : public UMaterialInstanceConstant
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18183,7 +18183,7 @@ public:
 	unsigned long                                      bAutoActivateAll : 1;                             		// 0x013C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18215,7 +18215,7 @@ public:
 	unsigned long                                      bAllowMultipleInstances : 1;                      		// 0x02A4 (0x0004) [0x0000008000000003] [0x00000001] ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18237,7 +18237,7 @@ public:
 	class UParticleSystem*                             ParticleTemplate;                                 		// 0x028C (0x0008) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18255,7 +18255,7 @@ class AParticleEventManager : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18323,7 +18323,7 @@ public:
 	unsigned char                                      ReplayState;                                      		// 0x0369 (0x0001) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18380,7 +18380,7 @@ class UDistributionFloatParticleParameter : public UDistributionFloatParameterBa
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18394,7 +18394,7 @@ class UDistributionVectorParticleParameter : public UDistributionVectorParameter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18418,7 +18418,7 @@ public:
 	unsigned char                                      EmitterRenderMode;                                		// 0x0098 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18433,7 +18433,7 @@ class UParticleSpriteEmitter : public UParticleEmitter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18469,7 +18469,7 @@ public:
 	unsigned long                                      ModuleMapsCreated : 1;                            		// 0x0198 (0x0004) [0x0000000000003000] [0x00000004] ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18494,7 +18494,7 @@ public:
 	unsigned char                                      LODValidity;                                      		// 0x0064 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18509,7 +18509,7 @@ public:
 	unsigned long                                      bAlwaysInWorldSpace : 1;                          		// 0x0068 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18525,7 +18525,7 @@ public:
 	unsigned long                                      bApplyOwnerScale : 1;                             		// 0x0098 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18540,7 +18540,7 @@ public:
 	struct FBioRawDistributionRwVector3                AccelOverLifeRw;                                  		// 0x006C (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18554,7 +18554,7 @@ class UParticleModuleAttractorBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18572,7 +18572,7 @@ public:
 	struct FVector                                     EndPoint1;                                        		// 0x00BC (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18595,7 +18595,7 @@ public:
 	unsigned char                                      SelectionMethod;                                  		// 0x00C0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18616,7 +18616,7 @@ public:
 	unsigned long                                      bUseWorldSpacePosition : 1;                       		// 0x00DC (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18630,7 +18630,7 @@ class UParticleModuleBeamBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18652,7 +18652,7 @@ public:
 	unsigned char                                      ModifierType;                                     		// 0x00F4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18686,7 +18686,7 @@ public:
 	unsigned long                                      bApplyNoiseScale : 1;                             		// 0x0148 (0x0004) [0x0000000000000001] [0x00000080] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18710,7 +18710,7 @@ public:
 	unsigned char                                      SourceTangentMethod;                              		// 0x00F1 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18735,7 +18735,7 @@ public:
 	unsigned char                                      TargetTangentMethod;                              		// 0x00F5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18749,7 +18749,7 @@ class UParticleModuleCollisionBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18776,7 +18776,7 @@ public:
 	unsigned char                                      CollisionCompletionOption;                        		// 0x0138 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18790,7 +18790,7 @@ class UParticleModuleColorBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18807,7 +18807,7 @@ public:
 	unsigned long                                      bClampAlpha : 1;                                  		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18823,7 +18823,7 @@ public:
 	struct FColor                                      DefaultColor;                                     		// 0x0070 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18840,7 +18840,7 @@ public:
 	unsigned long                                      bClampAlpha : 1;                                  		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18857,7 +18857,7 @@ public:
 	unsigned long                                      bEmitterTime : 1;                                 		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18871,7 +18871,7 @@ class UParticleModuleEventBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18886,7 +18886,7 @@ public:
 	TArray<struct FParticleEvent_GenerateInfo>         Events;                                           		// 0x0068 (0x0010) [0x0000000002400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18902,7 +18902,7 @@ public:
 	unsigned char                                      EventGeneratorType;                               		// 0x0070 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18917,7 +18917,7 @@ public:
 	unsigned long                                      bStopSpawning : 1;                                		// 0x0074 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18936,7 +18936,7 @@ public:
 	unsigned long                                      bInheritVelocity : 1;                             		// 0x00C4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18950,7 +18950,7 @@ class UParticleModuleKillBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18968,7 +18968,7 @@ public:
 	unsigned long                                      bKillInside : 1;                                  		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18985,7 +18985,7 @@ public:
 	unsigned long                                      bFloor : 1;                                       		// 0x008C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18999,7 +18999,7 @@ class UParticleModuleLifetimeBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19014,7 +19014,7 @@ public:
 	struct FRawDistributionFloat                       Lifetime;                                         		// 0x0068 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19031,7 +19031,7 @@ public:
 	unsigned long                                      m_bUpdateSeed : 1;                                		// 0x0070 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19046,7 +19046,7 @@ public:
 	struct FBioRawDistributionRwVector3                StartLocationRw;                                  		// 0x0074 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19064,7 +19064,7 @@ public:
 	struct FBioRawDistributionRwVector3                DirectionRw;                                      		// 0x00F8 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19084,7 +19084,7 @@ public:
 	unsigned char                                      SelectionMethod;                                  		// 0x0088 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19099,7 +19099,7 @@ public:
 	struct SFXName                                     EmitterName;                                      		// 0x0074 (0x0008) [0x0000000002000009]              ( CPF_Edit | CPF_ExportObject | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19123,7 +19123,7 @@ public:
 	unsigned long                                      Velocity : 1;                                     		// 0x00C4 (0x0004) [0x0000000000000001] [0x00000080] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19141,7 +19141,7 @@ public:
 	unsigned char                                      HeightAxis;                                       		// 0x0114 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19156,7 +19156,7 @@ public:
 	struct FRawDistributionFloat                       StartRadius;                                      		// 0x00C8 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19171,7 +19171,7 @@ public:
 	struct FBioRawDistributionRwVector3                SourceMovementScaleRw;                            		// 0x0074 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19185,7 +19185,7 @@ class UParticleModuleMaterialBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19201,7 +19201,7 @@ public:
 	TArray<class UMaterialInterface*>                  DefaultMaterials;                                 		// 0x0078 (0x0010) [0x0000000000400041]              ( CPF_Edit | CPF_EditConstArray | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19216,7 +19216,7 @@ public:
 	TArray<class UMaterialInterface*>                  MeshMaterials;                                    		// 0x0068 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19231,7 +19231,7 @@ public:
 	unsigned long                                      bUseEmitterTime : 1;                              		// 0x0068 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19252,7 +19252,7 @@ public:
 	unsigned char                                      ChainMode;                                        		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19266,7 +19266,7 @@ class UParticleModuleOrientationBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19281,7 +19281,7 @@ public:
 	unsigned char                                      LockAxisFlags;                                    		// 0x0068 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19295,7 +19295,7 @@ class UParticleModuleParameterBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19310,7 +19310,7 @@ public:
 	TArray<struct FEmitterDynamicParameter>            DynamicParams;                                    		// 0x0068 (0x0010) [0x0000000000480041]              ( CPF_Edit | CPF_EditConstArray | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19356,7 +19356,7 @@ public:
 	unsigned char                                      EmitterNormalsMode;                               		// 0x00F0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19370,7 +19370,7 @@ class UParticleModuleRotationBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19386,7 +19386,7 @@ public:
 	unsigned long                                      bInheritParent : 1;                               		// 0x0094 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19401,7 +19401,7 @@ public:
 	struct FRawDistributionFloat                       StartRotation;                                    		// 0x0068 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19417,7 +19417,7 @@ public:
 	unsigned long                                      Scale : 1;                                        		// 0x008C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19431,7 +19431,7 @@ class UParticleModuleRotationRateBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19446,7 +19446,7 @@ public:
 	struct FBioRawDistributionRwVector3                StartRotationRateRw;                              		// 0x0068 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19461,7 +19461,7 @@ public:
 	struct FBioRawDistributionRwVector3                LifeMultiplierRw;                                 		// 0x0068 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19476,7 +19476,7 @@ public:
 	struct FRawDistributionFloat                       StartRotationRate;                                		// 0x0068 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19491,7 +19491,7 @@ public:
 	struct FRawDistributionFloat                       LifeMultiplier;                                   		// 0x0068 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19505,7 +19505,7 @@ class UParticleModuleSizeBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19520,7 +19520,7 @@ public:
 	struct FBioRawDistributionRwVector3                StartSizeRw;                                      		// 0x0068 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19538,7 +19538,7 @@ public:
 	unsigned long                                      MultiplyZ : 1;                                    		// 0x0094 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19556,7 +19556,7 @@ public:
 	unsigned long                                      MultiplyZ : 1;                                    		// 0x0094 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19574,7 +19574,7 @@ public:
 	unsigned long                                      EnableZ : 1;                                      		// 0x0094 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19592,7 +19592,7 @@ public:
 	unsigned long                                      bEnableZ : 1;                                     		// 0x0094 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19608,7 +19608,7 @@ public:
 	unsigned long                                      bProcessBurstList : 1;                            		// 0x0068 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19626,7 +19626,7 @@ public:
 	unsigned char                                      ParticleBurstMethod;                              		// 0x00C4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19644,7 +19644,7 @@ public:
 	unsigned long                                      bIgnoreSpawnRateWhenMoving : 1;                   		// 0x0098 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19658,7 +19658,7 @@ class UParticleModuleStoreSpawnTimeBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19672,7 +19672,7 @@ class UParticleModuleStoreSpawnTime : public UParticleModuleStoreSpawnTimeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19686,7 +19686,7 @@ class UParticleModuleSubUVBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19701,7 +19701,7 @@ public:
 	struct FRawDistributionFloat                       SubImageIndex;                                    		// 0x0068 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19718,7 +19718,7 @@ public:
 	unsigned long                                      bUseEmitterTime : 1;                              		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19734,7 +19734,7 @@ public:
 	struct FBioRawDistributionRwVector3                SubUVSizeRw;                                      		// 0x0094 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19749,7 +19749,7 @@ public:
 	struct FBioRawDistributionRwVector3                SubImageSelectRw;                                 		// 0x0068 (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19763,7 +19763,7 @@ class UParticleModuleTrailBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19785,7 +19785,7 @@ public:
 	unsigned char                                      SelectionMethod;                                  		// 0x00AD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19801,7 +19801,7 @@ public:
 	float                                              MinSpawnVelocity;                                 		// 0x0070 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19817,7 +19817,7 @@ public:
 	unsigned char                                      TaperMethod;                                      		// 0x008C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19831,7 +19831,7 @@ class UParticleModuleTypeDataBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19858,7 +19858,7 @@ public:
 	unsigned long                                      bRenderTessellation : 1;                          		// 0x0080 (0x0004) [0x0000000000000001] [0x00000080] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19885,7 +19885,7 @@ public:
 	unsigned char                                      EndPointMethod;                                   		// 0x0139 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19917,7 +19917,7 @@ public:
 	unsigned char                                      TaperMethod;                                      		// 0x00FD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19943,7 +19943,7 @@ public:
 	unsigned char                                      CameraFacingOption;                               		// 0x0082 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19962,7 +19962,7 @@ public:
 	unsigned char                                      PhysXRotationMethod;                              		// 0x00A8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19978,7 +19978,7 @@ public:
 	class UPhysXParticleSystem*                        PhysXParSys;                                      		// 0x0078 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20009,7 +20009,7 @@ public:
 	unsigned char                                      RenderAxis;                                       		// 0x008C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20031,7 +20031,7 @@ public:
 	unsigned long                                      SpawnByDistance : 1;                              		// 0x009C (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20057,7 +20057,7 @@ public:
 	unsigned long                                      RenderTessellation : 1;                           		// 0x0084 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20072,7 +20072,7 @@ public:
 	TArray<struct SFXName>                             RequiredModules;                                  		// 0x0068 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20092,7 +20092,7 @@ public:
 	struct FRawDistributionFloat                       AlphaOverLife;                                    		// 0x012C (0x0024) [0x0000000002480009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_NeedCtorLink | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20113,7 +20113,7 @@ public:
 	struct FRawDistributionVector                      StartLocation;                                    		// 0x0150 (0x0024) [0x0000000002480009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_NeedCtorLink | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20140,7 +20140,7 @@ public:
 	unsigned long                                      SizeMultiplyZ : 1;                                		// 0x01E0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20181,7 +20181,7 @@ public:
 	unsigned char                                      PC_HeightAxis;                                    		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20220,7 +20220,7 @@ public:
 	unsigned char                                      PC_HeightAxis;                                    		// 0x01E4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20244,7 +20244,7 @@ public:
 	unsigned long                                      MultiplyZ : 1;                                    		// 0x0150 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20267,7 +20267,7 @@ public:
 	unsigned long                                      MultiplyZ : 1;                                    		// 0x0150 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20282,7 +20282,7 @@ public:
 	unsigned long                                      bInWorldSpace : 1;                                		// 0x0068 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20298,7 +20298,7 @@ public:
 	struct FRawDistributionFloat                       StartVelocityRadial;                              		// 0x0098 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20313,7 +20313,7 @@ public:
 	struct FBioRawDistributionRwVector3                ScaleRw;                                          		// 0x006C (0x002C) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20329,7 +20329,7 @@ public:
 	unsigned long                                      Absolute : 1;                                     		// 0x0098 (0x0004) [0x0000000000000009] [0x00000001] ( CPF_Edit | CPF_ExportObject )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20343,7 +20343,7 @@ class UParticleModuleEventSendToGame : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20360,7 +20360,7 @@ public:
 	int                                                ClipIDNumber;                                     		// 0x0070 (0x0004) [0x0000000000001001]              ( CPF_Edit | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20402,7 +20402,7 @@ public:
 	unsigned char                                      PacketSizeMultiplier;                             		// 0x00BE (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20442,7 +20442,7 @@ public:
 	unsigned long                                      bDisableClientSidePawnInteractions : 1;           		// 0x0394 (0x0004) [0x0000000000000000] [0x00000080] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20472,7 +20472,7 @@ public:
 	float                                              MaxImpulseSpeed;                                  		// 0x03A0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20496,7 +20496,7 @@ public:
 	unsigned long                                      bScalingToZero : 1;                               		// 0x0398 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20520,7 +20520,7 @@ public:
 	unsigned long                                      bBlockPawns : 1;                                  		// 0x0288 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20734,7 +20734,7 @@ public:
 	unsigned char                                      FiringMode;                                       		// 0x0583 (0x0001) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21034,7 +21034,7 @@ public:
 	unsigned char                                      StuckCount;                                       		// 0x0600 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21158,7 +21158,7 @@ public:
 	unsigned long                                      bHoldingDownHandbrake : 1;                        		// 0x074C (0x0004) [0x0000000000000000] [0x00001000] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21214,7 +21214,7 @@ public:
 	unsigned long                                      bUpdateActor2RefFrame : 1;                        		// 0x02A0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21241,7 +21241,7 @@ public:
 	unsigned char                                      ImpulseCount;                                     		// 0x0284 (0x0001) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21261,7 +21261,7 @@ public:
 	unsigned char                                      ImpulseCount;                                     		// 0x0280 (0x0001) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21279,7 +21279,7 @@ public:
 	unsigned long                                      bThrustEnabled : 1;                               		// 0x0274 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21295,7 +21295,7 @@ public:
 	class UMaterialInterface*                          LimitMaterial;                                    		// 0x0224 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21315,7 +21315,7 @@ public:
 	unsigned char                                      ImpulseFalloff;                                   		// 0x0238 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21347,7 +21347,7 @@ public:
 	unsigned long                                      bInterpolating : 1;                               		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21384,7 +21384,7 @@ public:
 	unsigned long                                      bEnableForceMassRatio : 1;                        		// 0x00E4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21416,7 +21416,7 @@ public:
 	unsigned long                                      bAutoDrive : 1;                                   		// 0x00BC (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21440,7 +21440,7 @@ public:
 	unsigned long                                      bIsDriving : 1;                                   		// 0x00F4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21466,7 +21466,7 @@ public:
 	unsigned long                                      bTurnInPlaceOnSteer : 1;                          		// 0x0124 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21508,7 +21508,7 @@ public:
 	unsigned long                                      m_bIgnoreSelfCollisions : 1;                      		// 0x00F0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21526,7 +21526,7 @@ class UPhysicalMaterialPropertyBase : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21545,7 +21545,7 @@ public:
 	class UPhysicsAssetInstance*                       DefaultInstance;                                  		// 0x00D8 (0x0008) [0x000000000440000A]              ( CPF_Const | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21573,7 +21573,7 @@ public:
 	unsigned long                                      bHasFixedBody : 1;                                		// 0x00EC (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21606,7 +21606,7 @@ public:
 	float                                              DebrisLifetime;                                   		// 0x0064 (0x0004) [0x0000000000005000]              ( CPF_Native | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21621,7 +21621,7 @@ public:
 	int                                                ParticlePercentage;                               		// 0x0060 (0x0004) [0x0000000000005000]              ( CPF_Native | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21666,7 +21666,7 @@ public:
 	unsigned long                                      bInstanceAlwaysFullAnimWeight : 1;                		// 0x00D4 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21728,7 +21728,7 @@ public:
 	FPointer                                           DummyKinActor;                                    		// 0x00D8 (0x0008) [0x0800000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21795,7 +21795,7 @@ public:
 	unsigned long                                      bMaintainMinDistance : 1;                         		// 0x0120 (0x0004) [0x0000000000000001] [0x00000200] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21809,7 +21809,7 @@ class URB_BSJointSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21823,7 +21823,7 @@ class URB_DistanceJointSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21837,7 +21837,7 @@ class URB_HingeSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21851,7 +21851,7 @@ class URB_PrismaticSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21865,7 +21865,7 @@ class URB_PulleyJointSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21879,7 +21879,7 @@ class URB_SkelJointSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21893,7 +21893,7 @@ class URB_StayUprightSetup : public URB_ConstraintSetup
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21950,7 +21950,7 @@ public:
 	unsigned char                                      Side;                                             		// 0x014C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21986,7 +21986,7 @@ public:
 	unsigned char                                      Coordinates;                                      		// 0x0391 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22003,7 +22003,7 @@ public:
 	int                                                ForceFieldChannel;                                		// 0x02B4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22027,7 +22027,7 @@ public:
 	unsigned char                                      RBChannel;                                        		// 0x02C0 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22054,7 +22054,7 @@ public:
 	unsigned long                                      UseSpecialRadialForce : 1;                        		// 0x02F0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22069,7 +22069,7 @@ public:
 	class UDrawCapsuleComponent*                       RenderComponent;                                  		// 0x02F4 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22104,7 +22104,7 @@ public:
 	unsigned char                                      Coordinates;                                      		// 0x037C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22126,7 +22126,7 @@ public:
 	unsigned char                                      ForceFalloff;                                     		// 0x02E8 (0x0001) [0x0000000000080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22155,7 +22155,7 @@ public:
 	unsigned long                                      BSpecialRadialForceMode : 1;                      		// 0x0304 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22185,7 +22185,7 @@ public:
 	unsigned char                                      Coordinates;                                      		// 0x0360 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22201,7 +22201,7 @@ public:
 	class UDrawBoxComponent*                           RenderComponent;                                  		// 0x0370 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22219,7 +22219,7 @@ public:
 	float                                              CapsuleRadius;                                    		// 0x0370 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22238,7 +22238,7 @@ public:
 	unsigned char                                      ForceFalloff;                                     		// 0x02DC (0x0001) [0x0000000000080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22254,7 +22254,7 @@ public:
 	float                                              SelfRotationStrength;                             		// 0x02E8 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22280,7 +22280,7 @@ public:
 	unsigned long                                      BSpecialRadialForceMode : 1;                      		// 0x02F4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22295,7 +22295,7 @@ public:
 	class UDrawCapsuleComponent*                       RenderComponent;                                  		// 0x02F8 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22320,7 +22320,7 @@ public:
 	unsigned long                                      BSpecialRadialForceMode : 1;                      		// 0x02F0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22335,7 +22335,7 @@ public:
 	class UDrawCapsuleComponent*                       RenderComponent;                                  		// 0x02F4 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22365,7 +22365,7 @@ public:
 	unsigned long                                      bForceApplyToProjectiles : 1;                     		// 0x02A0 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22393,7 +22393,7 @@ public:
 	unsigned char                                      RadialForceMode;                                  		// 0x0291 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22408,7 +22408,7 @@ class UForceFieldShape : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22428,7 +22428,7 @@ public:
 	class UDrawBoxComponent*                           Shape;                                            		// 0x0060 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22449,7 +22449,7 @@ public:
 	class UDrawCapsuleComponent*                       Shape;                                            		// 0x0060 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22471,7 +22471,7 @@ public:
 	class UDrawSphereComponent*                        Shape;                                            		// 0x0060 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22502,7 +22502,7 @@ public:
 	int                                                PI_LicenseePackageVersion;                        		// 0x0358 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22521,7 +22521,7 @@ public:
 	int                                                PrefabVersion;                                    		// 0x0078 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22542,7 +22542,7 @@ public:
 	unsigned long                                      bOutputObjCommentToScreen : 1;                    		// 0x0084 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22564,7 +22564,7 @@ class USequenceFrame : public USequenceObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22579,7 +22579,7 @@ class USequenceFrameWrapped : public USequenceFrame
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22606,7 +22606,7 @@ public:
 	unsigned char                                      GamepadID;                                        		// 0x00D8 (0x0001) [0x0000000001002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22673,7 +22673,7 @@ public:
 	unsigned long                                      m_bSFXInUpdateOp : 1;                             		// 0x01B0 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22692,7 +22692,7 @@ public:
 	class APrefabInstance*                             OwnerPrefab;                                      		// 0x01B4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22708,7 +22708,7 @@ class UPrefabSequenceContainer : public USequence
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22725,7 +22725,7 @@ public:
 	class UPackage*                                    oDependentPackage;                                		// 0x01C4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22742,7 +22742,7 @@ public:
 	unsigned long                                      bCallHandler : 1;                                 		// 0x00F4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22760,7 +22760,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x0118 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22778,7 +22778,7 @@ public:
 	unsigned long                                      bOpen : 1;                                        		// 0x0118 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22794,7 +22794,7 @@ public:
 	class USoundNode*                                  ApplyNode;                                        		// 0x0100 (0x0008) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22809,7 +22809,7 @@ public:
 	unsigned long                                      bPreferController : 1;                            		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22829,7 +22829,7 @@ public:
 	unsigned long                                      bPersistFade : 1;                                 		// 0x0118 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22862,7 +22862,7 @@ public:
 	unsigned long                                      bCheckLineOfSight : 1;                            		// 0x012C (0x0004) [0x0000000000000001] [0x00000400] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22887,7 +22887,7 @@ public:
 	unsigned char                                      PlaySpace;                                        		// 0x011C (0x0001) [0x0000008000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22906,7 +22906,7 @@ public:
 	unsigned char                                      CollisionType;                                    		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22921,7 +22921,7 @@ class USeqAct_CommitMapChange : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22938,7 +22938,7 @@ public:
 	unsigned long                                      bIncludeVarComment : 1;                           		// 0x010C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22956,7 +22956,7 @@ public:
 	unsigned long                                      bDisplayOnObject : 1;                             		// 0x012C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22972,7 +22972,7 @@ public:
 	FString                                            OutputLabel;                                      		// 0x00F8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22989,7 +22989,7 @@ public:
 	unsigned long                                      bOpen : 1;                                        		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23005,7 +23005,7 @@ public:
 	float                                              Distance;                                         		// 0x00F8 (0x0004) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23022,7 +23022,7 @@ public:
 	struct SFXName                                     SocketOrBoneName;                                 		// 0x0110 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23038,7 +23038,7 @@ public:
 	struct SFXName                                     PropertyName;                                     		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23056,7 +23056,7 @@ public:
 	float                                              Z;                                                		// 0x010C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23072,7 +23072,7 @@ public:
 	float                                              VelocityMag;                                      		// 0x0104 (0x0004) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23089,7 +23089,7 @@ public:
 	unsigned long                                      bObjectFound : 1;                                 		// 0x00F8 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23107,7 +23107,7 @@ public:
 	unsigned long                                      bCancelled : 1;                                   		// 0x0108 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23138,7 +23138,7 @@ public:
 	unsigned char                                      PointSelection;                                   		// 0x0170 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23153,7 +23153,7 @@ class USeqAct_ActorFactoryEx : public USeqAct_ActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23173,7 +23173,7 @@ public:
 	unsigned long                                      bPickClosest : 1;                                 		// 0x012C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23195,7 +23195,7 @@ public:
 	unsigned long                                      bStartWillRestart : 1;                            		// 0x011C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23216,7 +23216,7 @@ public:
 	float                                              NextLinkTime;                                     		// 0x0118 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23230,7 +23230,7 @@ class USeqAct_ForceGarbageCollection : public USeqAct_Latent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23280,7 +23280,7 @@ public:
 	unsigned long                                      m_bSFXIsCurrentlyActivating : 1;                  		// 0x0180 (0x0004) [0x0000000000002000] [0x00400000] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23303,7 +23303,7 @@ public:
 	unsigned long                                      bNeverAutoStreamOut : 1;                          		// 0x010C (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23320,7 +23320,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x0120 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23337,7 +23337,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x0120 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23354,7 +23354,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x011C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23377,7 +23377,7 @@ public:
 	unsigned long                                      bStopped : 1;                                     		// 0x012C (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23396,7 +23396,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x0124 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23430,7 +23430,7 @@ public:
 	float                                              OldFocusDistance;                                 		// 0x0168 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23448,7 +23448,7 @@ public:
 	float                                              OldMotionBlurAmount;                              		// 0x0118 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23469,7 +23469,7 @@ public:
 	unsigned long                                      bStreamingActive : 1;                             		// 0x013C (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23487,7 +23487,7 @@ public:
 	unsigned long                                      bShouldBlockOnLoad : 1;                           		// 0x011C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23505,7 +23505,7 @@ public:
 	unsigned long                                      bIncludeObjComment : 1;                           		// 0x0108 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23524,7 +23524,7 @@ public:
 	unsigned char                                      ManualCoverType;                                  		// 0x010C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23546,7 +23546,7 @@ public:
 	unsigned long                                      bFalloff : 1;                                     		// 0x0114 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23571,7 +23571,7 @@ public:
 	unsigned long                                      bUseEmitterLocation : 1;                          		// 0x015C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23595,7 +23595,7 @@ public:
 	unsigned char                                      PlaySpace;                                        		// 0x011C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23615,7 +23615,7 @@ public:
 	class USoundCue*                                   SoundCueToPlay;                                   		// 0x0120 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23630,7 +23630,7 @@ public:
 	struct FMusicTrackStruct                           MusicTrack;                                       		// 0x00F8 (0x001C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23647,7 +23647,7 @@ public:
 	unsigned long                                      bTryToLeaveVehicle : 1;                           		// 0x0100 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23662,7 +23662,7 @@ public:
 	TArray<struct FSwitchRange>                        Ranges;                                           		// 0x00F8 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23676,7 +23676,7 @@ class USeqAct_SetBlockRigidBody : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23692,7 +23692,7 @@ public:
 	class AActor*                                      CameraTarget;                                     		// 0x0108 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23709,7 +23709,7 @@ public:
 	int                                                MaterialIndex;                                    		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23726,7 +23726,7 @@ public:
 	float                                              ScalarValue;                                      		// 0x0108 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23745,7 +23745,7 @@ public:
 	unsigned char                                      MeshType;                                         		// 0x010C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23760,7 +23760,7 @@ public:
 	unsigned char                                      newPhysics;                                       		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23774,7 +23774,7 @@ class USeqAct_SetRigidBodyIgnoreVehicles : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23788,7 +23788,7 @@ class USeqAct_SetSequenceVariable : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23805,7 +23805,7 @@ public:
 	int                                                ObjectIndex;                                      		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23823,7 +23823,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23841,7 +23841,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23857,7 +23857,7 @@ public:
 	float                                              FloatResult;                                      		// 0x00FC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23874,7 +23874,7 @@ public:
 	unsigned long                                      bTruncate : 1;                                    		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23892,7 +23892,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23910,7 +23910,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23925,7 +23925,7 @@ public:
 	int                                                ListEntriesCount;                                 		// 0x00F8 (0x0004) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23943,7 +23943,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23961,7 +23961,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23977,7 +23977,7 @@ public:
 	unsigned long                                      DefaultValue : 1;                                 		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23993,7 +23993,7 @@ public:
 	float                                              Target;                                           		// 0x0108 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24010,7 +24010,7 @@ public:
 	int                                                Target;                                           		// 0x0108 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24030,7 +24030,7 @@ public:
 	unsigned long                                      bSetRotation : 1;                                 		// 0x0118 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24047,7 +24047,7 @@ public:
 	class UObject*                                     Value;                                            		// 0x0100 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24064,7 +24064,7 @@ public:
 	FString                                            Value;                                            		// 0x0108 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24083,7 +24083,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24101,7 +24101,7 @@ public:
 	int                                                IntResult;                                        		// 0x0104 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24119,7 +24119,7 @@ public:
 	float                                              Z;                                                		// 0x010C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24138,7 +24138,7 @@ public:
 	unsigned long                                      bAutoDisableLinks : 1;                            		// 0x0110 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24154,7 +24154,7 @@ public:
 	TArray<int>                                        AutoDisabledIndices;                              		// 0x0114 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24175,7 +24175,7 @@ public:
 	unsigned long                                      m_bSFXCreatedBeforeStuntActorLocationChange : 1;  		// 0x0110 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24192,7 +24192,7 @@ public:
 	float                                              Time;                                             		// 0x00FC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24207,7 +24207,7 @@ class USeqAct_Toggle : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24223,7 +24223,7 @@ public:
 	unsigned long                                      bLevelStartupEventForceOff : 1;                   		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24248,7 +24248,7 @@ public:
 	unsigned long                                      bTraceWorld : 1;                                  		// 0x0134 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24263,7 +24263,7 @@ class USequenceCondition : public USequenceOp
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24278,7 +24278,7 @@ class USeqCond_CompareBool : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24294,7 +24294,7 @@ public:
 	float                                              ValueB;                                           		// 0x00E0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24310,7 +24310,7 @@ public:
 	int                                                ValueB;                                           		// 0x00E0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24326,7 +24326,7 @@ public:
 	struct SFXName                                     ValueB;                                           		// 0x00E4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24340,7 +24340,7 @@ class USeqCond_CompareObject : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24356,7 +24356,7 @@ public:
 	FString                                            ValueB;                                           		// 0x00EC (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24370,7 +24370,7 @@ class USeqCond_GetServerType : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24388,7 +24388,7 @@ public:
 	int                                                ValueB;                                           		// 0x00E4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24405,7 +24405,7 @@ public:
 	float                                              ValueB;                                           		// 0x00E4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24419,7 +24419,7 @@ class USeqCond_IsAlive : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24433,7 +24433,7 @@ class USeqCond_IsConsole : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24447,7 +24447,7 @@ class USeqCond_IsInCombat : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24462,7 +24462,7 @@ public:
 	int                                                NumNeededLoggedIn;                                		// 0x00DC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24477,7 +24477,7 @@ class USeqCond_IsSameTeam : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24491,7 +24491,7 @@ class USeqCond_SwitchBase : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24510,7 +24510,7 @@ public:
 	TArray<struct FSwitchClassInfo>                    ClassArray;                                       		// 0x00DC (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24530,7 +24530,7 @@ public:
 	class UClass*                                      MetaClass;                                        		// 0x00EC (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24548,7 +24548,7 @@ class USeqCond_SwitchPlatform : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24578,7 +24578,7 @@ public:
 	unsigned char                                      WhoTriggers;                                      		// 0x0125 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24598,7 +24598,7 @@ public:
 	float                                              MaxSightDistance;                                 		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24613,7 +24613,7 @@ public:
 	struct SFXName                                     NotifyName;                                       		// 0x0128 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24629,7 +24629,7 @@ public:
 	struct SFXName                                     ConsoleEventName;                                 		// 0x0138 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24643,7 +24643,7 @@ class USeqEvent_ConstraintBroken : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24657,7 +24657,7 @@ class USeqEvent_Destroyed : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24671,7 +24671,7 @@ class USeqEvent_GetInventory : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24685,7 +24685,7 @@ class USeqEvent_LevelBeginning : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24699,7 +24699,7 @@ class USeqEvent_LevelLoaded : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24714,7 +24714,7 @@ class USeqEvent_LevelStartup : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24729,7 +24729,7 @@ public:
 	float                                              StayOpenTime;                                     		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24755,7 +24755,7 @@ public:
 	unsigned char                                      EventType;                                        		// 0x0158 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24771,7 +24771,7 @@ public:
 	float                                              MaxDistance;                                      		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24788,7 +24788,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x0140 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24805,7 +24805,7 @@ public:
 	float                                              MinCollisionVelocity;                             		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24819,7 +24819,7 @@ class USeqEvent_SeeDeath : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24834,7 +24834,7 @@ public:
 	FString                                            InputLabel;                                       		// 0x0128 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24856,7 +24856,7 @@ public:
 	unsigned long                                      bResetDamageOnToggle : 1;                         		// 0x0168 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24882,7 +24882,7 @@ public:
 	unsigned long                                      bAllowDeadPawns : 1;                              		// 0x0158 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24907,7 +24907,7 @@ public:
 	unsigned long                                      bAimToInteract : 1;                               		// 0x0164 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24924,7 +24924,7 @@ public:
 	struct SFXName                                     VarName;                                          		// 0x0088 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24941,7 +24941,7 @@ public:
 	int                                                m_srValue;                                        		// 0x00A0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24956,7 +24956,7 @@ public:
 	int                                                m_srStringID;                                     		// 0x00A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24980,7 +24980,7 @@ public:
 	unsigned long                                      bShouldBakeAndPrune : 1;                          		// 0x00D4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24995,7 +24995,7 @@ public:
 	int                                                bValue;                                           		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25011,7 +25011,7 @@ public:
 	class UClass*                                      ExpectedType;                                     		// 0x00A0 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25026,7 +25026,7 @@ public:
 	float                                              FloatValue;                                       		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25042,7 +25042,7 @@ public:
 	float                                              Max;                                              		// 0x0098 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25057,7 +25057,7 @@ public:
 	int                                                IntValue;                                         		// 0x0090 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25073,7 +25073,7 @@ public:
 	int                                                Max;                                              		// 0x0098 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25088,7 +25088,7 @@ public:
 	struct SFXName                                     NameValue;                                        		// 0x0090 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25105,7 +25105,7 @@ public:
 	unsigned long                                      bStatusIsOk : 1;                                  		// 0x00A0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25119,7 +25119,7 @@ class USeqVar_ScopedNamed : public USeqVar_Named
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25142,7 +25142,7 @@ public:
 	unsigned long                                      m_bBioDisableLookAt : 1;                          		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000020] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25159,7 +25159,7 @@ public:
 	class UClass*                                      PawnClass;                                        		// 0x00B8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25176,7 +25176,7 @@ public:
 	unsigned long                                      bCachedList : 1;                                  		// 0x00D0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25191,7 +25191,7 @@ public:
 	TArray<class UObject*>                             ObjList;                                          		// 0x00B8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25211,7 +25211,7 @@ public:
 	unsigned long                                      bCollidingOnly : 1;                               		// 0x00DC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25230,7 +25230,7 @@ public:
 	unsigned long                                      bReturnPawns : 1;                                 		// 0x00DC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25247,7 +25247,7 @@ public:
 	FString                                            StrValue;                                         		// 0x0090 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25262,7 +25262,7 @@ public:
 	struct FVector                                     VectValue;                                        		// 0x0090 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25279,7 +25279,7 @@ public:
 	unsigned long                                      bIsPlaying : 1;                                   		// 0x0278 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25293,7 +25293,7 @@ class AAmbientSoundMovable : public AAmbientSound
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25310,7 +25310,7 @@ public:
 	class USoundNodeAmbient*                           SoundNodeInstance;                                		// 0x028C (0x0008) [0x000000000440000A]              ( CPF_Const | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25324,7 +25324,7 @@ class AAmbientSoundNonLoop : public AAmbientSoundSimple
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25344,7 +25344,7 @@ public:
 	unsigned long                                      bFadeOnToggle : 1;                                		// 0x02A4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25365,7 +25365,7 @@ class UDistributionFloatSoundParameter : public UDistributionFloatParameterBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25381,7 +25381,7 @@ public:
 	int                                                NodeUpdateHint;                                   		// 0x0070 (0x0004) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25409,7 +25409,7 @@ public:
 	unsigned char                                      DistanceModel;                                    		// 0x00AC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25425,7 +25425,7 @@ public:
 	float                                              DelayMax;                                         		// 0x00B4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25449,7 +25449,7 @@ public:
 	unsigned char                                      DistanceType;                                     		// 0x008D (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25464,7 +25464,7 @@ public:
 	TArray<float>                                      InputVolume;                                      		// 0x0074 (0x0010) [0x0000000000400049]              ( CPF_Edit | CPF_ExportObject | CPF_EditConstArray | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25480,7 +25480,7 @@ public:
 	float                                              DelayMax;                                         		// 0x0078 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25495,7 +25495,7 @@ public:
 	TArray<struct FDistanceDatum>                      CrossFadeInput;                                   		// 0x0074 (0x0010) [0x0000000000480049]              ( CPF_Edit | CPF_ExportObject | CPF_EditConstArray | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25512,7 +25512,7 @@ public:
 	unsigned long                                      bLoopIndefinitely : 1;                            		// 0x007C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25526,7 +25526,7 @@ class USoundNodeMature : public USoundNode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25541,7 +25541,7 @@ public:
 	TArray<float>                                      InputVolume;                                      		// 0x0074 (0x0010) [0x0000000000400049]              ( CPF_Edit | CPF_ExportObject | CPF_EditConstArray | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25559,7 +25559,7 @@ public:
 	float                                              VolumeMax;                                        		// 0x0080 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25575,7 +25575,7 @@ public:
 	struct FRawDistributionFloat                       VolumeModulation;                                 		// 0x0098 (0x0024) [0x0000000000480001]              ( CPF_Edit | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25599,7 +25599,7 @@ public:
 	unsigned long                                      bModulatePitch : 1;                               		// 0x0094 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25617,7 +25617,7 @@ public:
 	unsigned long                                      bRandomizeWithoutReplacement : 1;                 		// 0x0098 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25661,7 +25661,7 @@ public:
 	unsigned char                                      DecompressionType;                                		// 0x0205 (0x0001) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25677,7 +25677,7 @@ public:
 	TArray<unsigned char>                              QueuedAudio;                                      		// 0x0208 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25696,7 +25696,7 @@ public:
 	struct SFXName                                     WaveParameterName;                                		// 0x0074 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25760,7 +25760,7 @@ public:
 	unsigned long                                      bShowWireframe : 1;                               		// 0x03B8 (0x0004) [0x0000000000000001] [0x00008000] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25800,7 +25800,7 @@ public:
 	unsigned long                                      bPhysicsMeshDirty : 1;                            		// 0x02F0 (0x0004) [0x0000000000003000] [0x00000002] ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25816,7 +25816,7 @@ public:
 	class ATerrain*                                    ParentTerrain;                                    		// 0x0184 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25831,7 +25831,7 @@ public:
 	TArray<struct FTerrainFilteredMaterial>            Materials;                                        		// 0x0060 (0x0010) [0x0000000000400003]              ( CPF_Edit | CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25857,7 +25857,7 @@ public:
 	unsigned char                                      MappingType;                                      		// 0x00D4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25871,7 +25871,7 @@ class UUIRoot : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25946,7 +25946,7 @@ public:
 	unsigned long                                      bSupports3DPrimitives : 1;                        		// 0x021C (0x0004) [0x0000000000000002] [0x00000080] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26117,7 +26117,7 @@ class UUIComponent : public UComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26135,7 +26135,7 @@ public:
 	class UUIEvent_ProcessInput*                       InputProcessor;                                   		// 0x0098 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26151,7 +26151,7 @@ class UUIEventContainer : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26174,7 +26174,7 @@ public:
 	TArray<struct FPlayerDataStoreGroup>               PlayerDataStores;                                 		// 0x00A0 (0x0010) [0x0000000000400002]              ( CPF_Const | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26202,7 +26202,7 @@ public:
 	struct FScriptDelegate                             __OnInitialize__Delegate;                         		// 0x0090 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26255,7 +26255,7 @@ public:
 	unsigned long                                      bIsRuntimeAutoCompleteUpToDate : 1;               		// 0x026C (0x0004) [0x0000000000002000] [0x00000040] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26297,7 +26297,7 @@ public:
 	unsigned char                                      CurrentEvent;                                     		// 0x0168 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26364,7 +26364,7 @@ public:
 	unsigned char                                      bYAxis;                                           		// 0x0202 (0x0001) [0x0000000000000004]              ( CPF_Input )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26393,7 +26393,7 @@ class UPlayerManagerInteraction : public UInteraction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26435,7 +26435,7 @@ public:
 	unsigned long                                      bIsUIPrimitiveSceneInitialized : 1;               		// 0x0220 (0x0004) [0x0000000000002002] [0x00000010] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26474,7 +26474,7 @@ public:
 	TArray<struct FUIAxisEmulationDefinition>          AxisEmulationDefinitions;                         		// 0x0070 (0x0010) [0x0000000000404002]              ( CPF_Const | CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26490,7 +26490,7 @@ class UUILayerBase : public UUIRoot
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26517,7 +26517,7 @@ public:
 	unsigned long                                      bEnablePostProcess : 1;                           		// 0x0130 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26554,7 +26554,7 @@ public:
 	unsigned char                                      StackPriority;                                    		// 0x0099 (0x0001) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26579,7 +26579,7 @@ class UUIState_Disabled : public UUIState
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26595,7 +26595,7 @@ class UUIState_Enabled : public UUIState
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26612,7 +26612,7 @@ public:
 	struct FVector2D                                   StringExtent;                                     		// 0x010C (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26633,7 +26633,7 @@ public:
 	unsigned char                                      WriteAccessType;                                  		// 0x0080 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26665,7 +26665,7 @@ public:
 	struct SFXName                                     Tag;                                              		// 0x00A4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26696,7 +26696,7 @@ public:
 	unsigned char                                      UnknownData03[ 0x48 ];                            		// 0x01C4 (0x0048) UNKNOWN PROPERTY: MapProperty Engine.UISkin.SoundCueMap
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26730,7 +26730,7 @@ public:
 	struct SFXName                                     StyleTag;                                         		// 0x00E0 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26784,7 +26784,7 @@ public:
 	unsigned char                                      MaskPostProcess;                                  		// 0x0515 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26853,7 +26853,7 @@ public:
 	unsigned char                                      VertAlignment;                                    		// 0x0071 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26874,7 +26874,7 @@ public:
 	unsigned char                                      FadeType;                                         		// 0x0094 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26898,7 +26898,7 @@ public:
 	class UUITexture*                                  ImageRef;                                         		// 0x0134 (0x0008) [0x0000000014400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline | CPF_EditInlineUse )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26945,7 +26945,7 @@ public:
 	unsigned long                                      bReapplyFormatting : 1;                           		// 0x01BC (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27056,7 +27056,7 @@ public:
 	unsigned char                                      WrapType;                                         		// 0x085F (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27126,7 +27126,7 @@ class UUIComp_ListComponentBase : public UUIComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27148,7 +27148,7 @@ public:
 	unsigned long                                      bReverseSecondarySorting : 1;                     		// 0x0090 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27167,7 +27167,7 @@ public:
 	unsigned long                                      bReapplyFormatting : 1;                           		// 0x0070 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27204,7 +27204,7 @@ public:
 	unsigned long                                      bDisplayColumnHeaders : 1;                        		// 0x0150 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27219,7 +27219,7 @@ class UUIDataStoreSubscriber : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27239,7 +27239,7 @@ class UUIDataStorePublisher : public UUIDataStoreSubscriber
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27254,7 +27254,7 @@ class UUIListElementCellProvider : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27268,7 +27268,7 @@ class UUIListElementProvider : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27282,7 +27282,7 @@ class UUIAnimation : public UUIRoot
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27299,7 +27299,7 @@ public:
 	unsigned char                                      LoopMode;                                         		// 0x0078 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27317,7 +27317,7 @@ class UUIConfigProvider : public UUIDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27332,7 +27332,7 @@ public:
 	class ULocalPlayer*                                Player;                                           		// 0x0084 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27349,7 +27349,7 @@ public:
 	FPointer                                           VfTable_IUIListElementCellProvider;               		// 0x008C (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27373,7 +27373,7 @@ public:
 	FString                                            LastInviteFrom;                                   		// 0x00F4 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27410,7 +27410,7 @@ public:
 	FString                                            BusyText;                                         		// 0x0174 (0x0010) [0x0000000000408002]              ( CPF_Const | CPF_Localized | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27439,7 +27439,7 @@ public:
 	FString                                            IsPlayingThisGameCol;                             		// 0x0114 (0x0010) [0x0000000000408002]              ( CPF_Const | CPF_Localized | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27458,7 +27458,7 @@ public:
 	FPointer                                           VfTable_IUIListElementCellProvider;               		// 0x008C (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27478,7 +27478,7 @@ public:
 	unsigned long                                      bWasErrorLastRead : 1;                            		// 0x00AC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27504,7 +27504,7 @@ class UUIDataProvider_OnlineProfileSettings : public UUIDataProvider_OnlinePlaye
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27524,7 +27524,7 @@ public:
 	TArray<struct FAchievementDetails>                 Achievements;                                     		// 0x0094 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27556,7 +27556,7 @@ public:
 	int                                                PlayerStorageId;                                  		// 0x00C4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27577,7 +27577,7 @@ public:
 	int                                                SettingsId;                                       		// 0x00C4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27595,7 +27595,7 @@ public:
 	class UUIDynamicFieldProvider*                     SceneDataProvider;                                		// 0x00C4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27625,7 +27625,7 @@ class UUIDataStore_Color : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27644,7 +27644,7 @@ public:
 	class UUIDataStore_GameResource*                   GameResourceDataStore;                            		// 0x0114 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27668,7 +27668,7 @@ class UUIDataStore_Fonts : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27685,7 +27685,7 @@ public:
 	TArray<struct FGameResourceDataProvider>           ElementProviderTypes;                             		// 0x00FC (0x0010) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27709,7 +27709,7 @@ public:
 	struct SFXName                                     CurrentGameSettingsTag;                           		// 0x0164 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27730,7 +27730,7 @@ public:
 	struct FScriptDelegate                             __OnRefreshDataFieldValue__Delegate;              		// 0x00AC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27754,7 +27754,7 @@ public:
 	unsigned long                                      bRefreshTeamDataProviders : 1;                    		// 0x0114 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27792,7 +27792,7 @@ public:
 	class UCurrentWeaponDataProvider*                  CurrentWeapon;                                    		// 0x0104 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27809,7 +27809,7 @@ class UUIDataStore_Gamma : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27823,7 +27823,7 @@ class UUIDataStore_Images : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27842,7 +27842,7 @@ public:
 	class UClass*                                      ProviderClass;                                    		// 0x00E4 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27864,7 +27864,7 @@ public:
 	class UUIDynamicFieldProvider*                     RegistryDataProvider;                             		// 0x00AC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27879,7 +27879,7 @@ class UUIDataStore_Remote : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27902,7 +27902,7 @@ public:
 	int                                                ActiveSearchIndex;                                		// 0x00F0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27961,7 +27961,7 @@ public:
 	int                                                NumTotalDownloads;                                		// 0x01D0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28000,7 +28000,7 @@ public:
 	unsigned char                                      CurrentReadType;                                  		// 0x0144 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28020,7 +28020,7 @@ class UUIDataStore_Settings : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28037,7 +28037,7 @@ public:
 	int                                                SelectedIndex;                                    		// 0x00C4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28064,7 +28064,7 @@ public:
 	TArray<class USessionSettingsProvider*>            SessionSettings;                                  		// 0x00CC (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28080,7 +28080,7 @@ class UUIDataStore_StringBase : public UUIDataStore
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28096,7 +28096,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x48 ];                            		// 0x00BC (0x0048) UNKNOWN PROPERTY: MapProperty Engine.UIDataStore_InputAlias.InputAliasLookupMap
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28121,7 +28121,7 @@ public:
 	int                                                PlayerIndex;                                      		// 0x0104 (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28139,7 +28139,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x48 ];                            		// 0x020C (0x0048) UNKNOWN PROPERTY: MapProperty Engine.UICustomSkin.WidgetStyleMap
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28157,7 +28157,7 @@ public:
 	TArray<struct FUIProviderScriptFieldValue>         RuntimeDataFields;                                		// 0x0124 (0x0010) [0x0000000000402001]              ( CPF_Edit | CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28192,7 +28192,7 @@ public:
 	struct FScriptDelegate                             __CanSupportComplexPropertyType__Delegate;        		// 0x0094 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28211,7 +28211,7 @@ public:
 	class UObject*                                     DataSource;                                       		// 0x00B4 (0x0008) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28233,7 +28233,7 @@ public:
 	class AGameReplicationInfo*                        GameDataSource;                                   		// 0x00BC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28248,7 +28248,7 @@ class UInventoryDataProvider : public UUIDynamicDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28262,7 +28262,7 @@ class UPowerupDataProvider : public UInventoryDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28277,7 +28277,7 @@ class UWeaponDataProvider : public UInventoryDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28291,7 +28291,7 @@ class UCurrentWeaponDataProvider : public UWeaponDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28305,7 +28305,7 @@ class UPickupDataProvider : public UUIDynamicDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28319,7 +28319,7 @@ class UPlayerDataProvider : public UUIDynamicDataProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28334,7 +28334,7 @@ public:
 	class UPlayerDataProvider*                         PlayerData;                                       		// 0x00BC (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28353,7 +28353,7 @@ public:
 	struct SFXName                                     PlayerListFieldName;                              		// 0x00D4 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28371,7 +28371,7 @@ public:
 	unsigned long                                      bIsAListRow : 1;                                  		// 0x00D4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28393,7 +28393,7 @@ public:
 	unsigned long                                      bSkipDuringEnumeration : 1;                       		// 0x00B4 (0x0004) [0x0000000000004000] [0x00000002] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28430,7 +28430,7 @@ public:
 	unsigned char                                      EditboxAllowedChars;                              		// 0x015D (0x0001) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28449,7 +28449,7 @@ public:
 	FString                                            Description;                                      		// 0x00E8 (0x0010) [0x0000000000408002]              ( CPF_Const | CPF_Localized | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28464,7 +28464,7 @@ public:
 	struct SFXName                                     ProviderTag;                                      		// 0x00A4 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28485,7 +28485,7 @@ public:
 	class UClass*                                      ProviderClient;                                   		// 0x00BC (0x0008) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28509,7 +28509,7 @@ public:
 	class UUIDataProvider_OnlineProfileSettings*       ProfileProvider;                                  		// 0x009C (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28573,7 +28573,7 @@ public:
 	unsigned long                                      bBlockUpdatesAfterStackModification : 1;          		// 0x0204 (0x0004) [0x0000000000002001] [0x00800000] ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28643,7 +28643,7 @@ public:
 	struct SFXName                                     ClickedCue;                                       		// 0x0520 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28661,7 +28661,7 @@ public:
 	class UUIComp_DrawString*                          StringRenderComponent;                            		// 0x0570 (0x0008) [0x000000000608000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_Component | CPF_NoClear | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28691,7 +28691,7 @@ public:
 	unsigned char                                      IconAlignment;                                    		// 0x059C (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28741,7 +28741,7 @@ public:
 	unsigned char                                      ScrollbarOrientation;                             		// 0x0610 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28776,7 +28776,7 @@ class UUIScrollbarButton : public UUIButton
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28791,7 +28791,7 @@ public:
 	struct FScriptDelegate                             __OnButtonDragged__Delegate;                      		// 0x0528 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28807,7 +28807,7 @@ public:
 	class UUIComp_AutoAlignment*                       AutoAlignment;                                    		// 0x0518 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28831,7 +28831,7 @@ public:
 	unsigned char                                      ButtonLayout;                                     		// 0x05A5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28877,7 +28877,7 @@ public:
 	unsigned char                                      RegionType;                                       		// 0x052C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28894,7 +28894,7 @@ public:
 	class UUIComp_DrawImage*                           ImageComponent;                                   		// 0x0560 (0x0008) [0x000000000608000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_Component | CPF_NoClear | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28921,7 +28921,7 @@ public:
 	class UUIComp_DrawImage*                           LabelBackground;                                  		// 0x0570 (0x0008) [0x000000000408000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28949,7 +28949,7 @@ public:
 	unsigned long                                      bResolvePosition : 1;                             		// 0x0878 (0x0004) [0x0000000000002002] [0x00000001] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28979,7 +28979,7 @@ public:
 	int                                                ModificationCounter;                              		// 0x0530 (0x0004) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28997,7 +28997,7 @@ public:
 	int                                                PrefabInstanceVersion;                            		// 0x05B0 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29083,7 +29083,7 @@ public:
 	unsigned char                                      ScenePostProcessGroup;                            		// 0x067B (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29169,7 +29169,7 @@ class UUIState_Active : public UUIState
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29183,7 +29183,7 @@ class UUIState_Focused : public UUIState
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29198,7 +29198,7 @@ class UUIState_Pressed : public UUIState
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29212,7 +29212,7 @@ class UUIListString : public UUIString
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29231,7 +29231,7 @@ public:
 	unsigned long                                      bDirty : 1;                                       		// 0x0088 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29248,7 +29248,7 @@ public:
 	struct FStyleDataReference                         TextStyle;                                        		// 0x00BC (0x0030) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29267,7 +29267,7 @@ public:
 	class USurface*                                    DefaultImage;                                     		// 0x00C4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29289,7 +29289,7 @@ public:
 	unsigned char                                      ClipAlignment;                                    		// 0x00B3 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29305,7 +29305,7 @@ public:
 	class USurface*                                    ImageTexture;                                     		// 0x00FC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29325,7 +29325,7 @@ public:
 	struct FScriptDelegate                             __OnScriptTick__Delegate;                         		// 0x0068 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29341,7 +29341,7 @@ class UUIStringRenderer : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29356,7 +29356,7 @@ class UUIStyleResolver : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29373,7 +29373,7 @@ class UUITickableObject : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29389,7 +29389,7 @@ public:
 	TArray<class UUIEvent*>                            UIEvents;                                         		// 0x01BC (0x0010) [0x0000000001502002]              ( CPF_Const | CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29408,7 +29408,7 @@ class UUIStateSequence : public UUISequence
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29424,7 +29424,7 @@ public:
 	unsigned long                                      bAutoTargetOwner : 1;                             		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29450,7 +29450,7 @@ public:
 	unsigned long                                      bPropagateEvent : 1;                              		// 0x015C (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29475,7 +29475,7 @@ public:
 	class UUICalloutButtonPanel*                       ButtonPanel;                                      		// 0x0160 (0x0008) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29497,7 +29497,7 @@ public:
 	FPointer                                           VfTable_FCallbackEventDevice;                     		// 0x0160 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29514,7 +29514,7 @@ public:
 	struct FMultiMap_Mirror                            ActionMap;                                        		// 0x0160 (0x0048) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29529,7 +29529,7 @@ class UScene : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29551,7 +29551,7 @@ public:
 	int                                                MaxInstanceCount;                                 		// 0x02DC (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29579,7 +29579,7 @@ public:
 	float                                              Mass;                                             		// 0x02D8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29609,7 +29609,7 @@ public:
 	float                                              SwayScale;                                        		// 0x02BC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29624,7 +29624,7 @@ public:
 	FPointer                                           FoliageSceneProxy;                                		// 0x02A0 (0x0008) [0x0000000000201002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29638,7 +29638,7 @@ class UActorFactoryInteractiveFoliage : public UActorFactoryStaticMesh
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29657,7 +29657,7 @@ public:
 	unsigned long                                      bToggled : 1;                                     		// 0x0288 (0x0004) [0x0000000100000020] [0x00000002] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29675,7 +29675,7 @@ public:
 	class UParticleSystem*                             ProjectileEntryEffect;                            		// 0x0278 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29691,7 +29691,7 @@ class AFluidSurfaceActorMovable : public AFluidSurfaceActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29731,7 +29731,7 @@ public:
 	unsigned char                                      InfluenceType;                                    		// 0x0288 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29797,7 +29797,7 @@ public:
 	unsigned long                                      bTestRippleCenterOnDetail : 1;                    		// 0x031C (0x0004) [0x0000000000000001] [0x00000400] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29815,7 +29815,7 @@ public:
 	class USpeedTreeComponent*                         SpeedTreeComponent;                               		// 0x0270 (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29855,7 +29855,7 @@ public:
 	unsigned long                                      bUseBillboards : 1;                               		// 0x0310 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29872,7 +29872,7 @@ public:
 	class USpeedTree*                                  SpeedTree;                                        		// 0x008C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29887,7 +29887,7 @@ public:
 	class USpeedTreeComponent*                         SpeedTreeComponent;                               		// 0x0064 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29913,7 +29913,7 @@ public:
 	unsigned long                                      bLegacySpeedTree : 1;                             		// 0x00BC (0x0004) [0x0000000000000002] [0x00000001] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29929,7 +29929,7 @@ public:
 	unsigned long                                      bCurrentlyActive : 1;                             		// 0x0278 (0x0004) [0x0000000100000020] [0x00000001] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29966,7 +29966,7 @@ public:
 	unsigned long                                      bUsesSceneColor : 1;                              		// 0x026C (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30002,7 +30002,7 @@ public:
 	unsigned char                                      ReflectionsDPG;                                   		// 0x0285 (0x0001) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30035,7 +30035,7 @@ public:
 	unsigned char                                      FBMethod;                                         		// 0x01B8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30055,7 +30055,7 @@ public:
 	int                                                MaxTextureSize;                                   		// 0x00D0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30077,7 +30077,7 @@ public:
 	unsigned char                                      Format;                                           		// 0x00D0 (0x0001) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30104,7 +30104,7 @@ public:
 	unsigned char                                      Format;                                           		// 0x0100 (0x0001) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30136,7 +30136,7 @@ public:
 	unsigned char                                      MovieStreamSource;                                		// 0x014F (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30156,7 +30156,7 @@ public:
 	unsigned long                                      bRenderOnce : 1;                                  		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30177,7 +30177,7 @@ public:
 	unsigned char                                      AddressY;                                         		// 0x00E2 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30195,7 +30195,7 @@ public:
 	unsigned long                                      bSkipNextClear : 1;                               		// 0x00F4 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30212,7 +30212,7 @@ public:
 	unsigned char                                      Format;                                           		// 0x00C8 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30268,7 +30268,7 @@ public:
 	unsigned char                                      DebugState;                                       		// 0x0334 (0x0001) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30287,7 +30287,7 @@ public:
 	unsigned long                                      bIsChild : 1;                                     		// 0x00D4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30308,7 +30308,7 @@ public:
 	unsigned long                                      bApplyEQ : 1;                                     		// 0x00A4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30332,7 +30332,7 @@ public:
 	unsigned long                                      bIsFrozenRendering : 1;                           		// 0x07C8 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30359,7 +30359,7 @@ class AMatineePawn : public APawn
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30398,7 +30398,7 @@ public:
 	unsigned long                                      bHightlightOneWayReachSpecs : 1;                  		// 0x05F4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30413,7 +30413,7 @@ class ALightVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30429,7 +30429,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x0278 (0x0004) [0x0000000100000020] [0x00000001] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30445,7 +30445,7 @@ class ADirectionalLight : public ALight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30459,7 +30459,7 @@ class ADirectionalLightToggleable : public ADirectionalLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30473,7 +30473,7 @@ class ADominantDirectionalLight : public ADirectionalLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30487,7 +30487,7 @@ class APointLight : public ALight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30501,7 +30501,7 @@ class ADominantPointLight : public APointLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30515,7 +30515,7 @@ class APointLightMovable : public APointLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30529,7 +30529,7 @@ class APointLightToggleable : public APointLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30546,7 +30546,7 @@ class ASkyLight : public ALight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30560,7 +30560,7 @@ class ASkyLightToggleable : public ASkyLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30574,7 +30574,7 @@ class ASpotLight : public ALight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30588,7 +30588,7 @@ class ADominantSpotLight : public ASpotLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30602,7 +30602,7 @@ class ASpotLightMovable : public ASpotLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30616,7 +30616,7 @@ class ASpotLightToggleable : public ASpotLight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30635,7 +30635,7 @@ public:
 	int                                                MaxLightComponents;                               		// 0x028C (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30703,7 +30703,7 @@ public:
 	float                                              OcclusionMaskDarkness;                            		// 0x01D0 (0x0004) [0x0000000200000001]              ( CPF_Edit | CPF_Interp )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30729,7 +30729,7 @@ public:
 	float                                              WholeSceneDynamicShadowRadius;                    		// 0x01E8 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30748,7 +30748,7 @@ public:
 	struct FArray_Mirror                               DominantLightShadowMap;                           		// 0x02A0 (0x0010) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30774,7 +30774,7 @@ public:
 	unsigned long                                      bAllowedInBasePass : 1;                           		// 0x0260 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30791,7 +30791,7 @@ class UDominantPointLightComponent : public UPointLightComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30810,7 +30810,7 @@ public:
 	float                                              LightShaftConeAngle;                              		// 0x027C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30826,7 +30826,7 @@ public:
 	struct FArray_Mirror                               DominantLightShadowMap;                           		// 0x0330 (0x0010) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30842,7 +30842,7 @@ public:
 	struct FColor                                      LowerColor;                                       		// 0x01D8 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30859,7 +30859,7 @@ public:
 	unsigned long                                      bRenderBeforeModShadows : 1;                      		// 0x0270 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30877,7 +30877,7 @@ public:
 	unsigned long                                      bForceNonCompositeDynamicLights : 1;              		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30933,7 +30933,7 @@ public:
 	unsigned char                                      BoundsMethod;                                     		// 0x0162 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30949,7 +30949,7 @@ public:
 	unsigned long                                      bAllowDLESharing : 1;                             		// 0x0168 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30963,7 +30963,7 @@ class UDrawLightConeComponent : public UDrawConeComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30977,7 +30977,7 @@ class UDrawLightRadiusComponent : public UDrawSphereComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30993,7 +30993,7 @@ public:
 	class UMaterialInterface*                          SourceMaterial;                                   		// 0x006C (0x0008) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31210,7 +31210,7 @@ public:
 	int                                                LowDetailLODIndex;                                		// 0x081C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31462,7 +31462,7 @@ public:
 	FPointer                                           m_VerticesPerBone;                                		// 0x041C (0x0008) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31482,7 +31482,7 @@ public:
 	struct SFXName                                     SupermodelName;                                   		// 0x0094 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31508,7 +31508,7 @@ public:
 	unsigned long                                      bAlreadyVisited : 1;                              		// 0x02D4 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31548,7 +31548,7 @@ public:
 	unsigned long                                      bCastShadow : 1;                                  		// 0x0320 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31570,7 +31570,7 @@ public:
 	unsigned long                                      bSplineDisabled : 1;                              		// 0x025C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31616,7 +31616,7 @@ public:
 	unsigned long                                      bDebugDrawScopes : 1;                             		// 0x0344 (0x0004) [0x0000000000000001] [0x00000200] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31636,7 +31636,7 @@ class AProcBuilding_SimpleLODActor : public AStaticMeshActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31651,7 +31651,7 @@ public:
 	TArray<struct FPBRuleLink>                         NextRules;                                        		// 0x0060 (0x0010) [0x0000000000400040]              ( CPF_EditConstArray | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31670,7 +31670,7 @@ public:
 	unsigned char                                      RepeatAxis;                                       		// 0x007C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31690,7 +31690,7 @@ public:
 	unsigned long                                      bFilled : 1;                                      		// 0x0084 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31713,7 +31713,7 @@ public:
 	unsigned char                                      CornerType;                                       		// 0x0098 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31729,7 +31729,7 @@ public:
 	unsigned char                                      Edge;                                             		// 0x0080 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31745,7 +31745,7 @@ public:
 	float                                              MainXPullIn;                                      		// 0x0074 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31763,7 +31763,7 @@ public:
 	float                                              ExtractNotBottomZ;                                		// 0x007C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31778,7 +31778,7 @@ public:
 	float                                              MassiveLODDistanceScale;                          		// 0x0070 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31796,7 +31796,7 @@ public:
 	unsigned long                                      bBlockAll : 1;                                    		// 0x00CC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31811,7 +31811,7 @@ class UPBRuleNodeOcclusion : public UPBRuleNodeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31831,7 +31831,7 @@ public:
 	unsigned long                                      bDisableMaterialRepeat : 1;                       		// 0x0088 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31848,7 +31848,7 @@ public:
 	int                                                MaxNumExecuted;                                   		// 0x0078 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31864,7 +31864,7 @@ public:
 	unsigned char                                      RepeatAxis;                                       		// 0x0074 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31881,7 +31881,7 @@ public:
 	unsigned char                                      SizeAxis;                                         		// 0x0078 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31897,7 +31897,7 @@ public:
 	unsigned char                                      SplitAxis;                                        		// 0x0080 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31912,7 +31912,7 @@ public:
 	class UProcBuildingRuleset*                        SubRuleset;                                       		// 0x0070 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31929,7 +31929,7 @@ public:
 	class UDistributionVector*                         Scale;                                            		// 0x0080 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31944,7 +31944,7 @@ public:
 	unsigned long                                      bVariationOfScopeOnLeft : 1;                      		// 0x0070 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31967,7 +31967,7 @@ public:
 	unsigned long                                      bScaleWindowWithCell : 1;                         		// 0x0094 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31998,7 +31998,7 @@ public:
 	unsigned long                                      bLODOnlyRoof : 1;                                 		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32012,7 +32012,7 @@ class AReplicationInfo : public AInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32042,7 +32042,7 @@ public:
 	unsigned long                                      bMatchIsOver : 1;                                 		// 0x02EC (0x0004) [0x0000000100000020] [0x00000004] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32123,7 +32123,7 @@ public:
 	unsigned char                                      TTSSpeaker;                                       		// 0x0349 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32177,7 +32177,7 @@ public:
 	struct FColor                                      TeamColor;                                        		// 0x028C (0x0004) [0x0000000040000000]              ( CPF_EditInlineNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32239,7 +32239,7 @@ public:
 	unsigned long                                      bEnableColorScaleInterp : 1;                      		// 0x0504 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32291,7 +32291,7 @@ public:
 	unsigned long                                      bConstrainAspectRatio : 1;                        		// 0x036C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32307,7 +32307,7 @@ class ADynamicCameraActor : public ACameraActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32327,7 +32327,7 @@ public:
 	float                                              BaseFOV;                                          		// 0x016C (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32365,7 +32365,7 @@ public:
 	unsigned char                                      PlaySpace;                                        		// 0x01D8 (0x0001) [0x0000008000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32396,7 +32396,7 @@ public:
 	unsigned char                                      Priority;                                         		// 0x007C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32422,7 +32422,7 @@ public:
 	float                                              SplitScreenShakeScale;                            		// 0x0090 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32458,7 +32458,7 @@ public:
 	unsigned long                                      bRandomAnimSegment : 1;                           		// 0x00DC (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32526,7 +32526,7 @@ public:
 	unsigned long                                      m_PlayerIsGhosting : 1;                           		// 0x0228 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32592,7 +32592,7 @@ public:
 	TArray<class ASFXLightProbe*>                      LightProbes;                                      		// 0x02B4 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32609,7 +32609,7 @@ public:
 	class USFXLightRig*                                LightRig;                                         		// 0x0270 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32624,7 +32624,7 @@ public:
 	unsigned long                                      bUseVSMShadows : 1;                               		// 0x0264 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32671,7 +32671,7 @@ public:
 	unsigned char                                      RimLightControl;                                  		// 0x01ED (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32706,7 +32706,7 @@ public:
 	unsigned long                                      EnableMergedMaterialEffects : 1;                  		// 0x0144 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32727,7 +32727,7 @@ public:
 	struct FVector                                     ShadowDirection;                                  		// 0x01C0 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32742,7 +32742,7 @@ class USeqEvent_HitWall : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32766,7 +32766,7 @@ public:
 	unsigned long                                      bCountInstances : 1;                              		// 0x0070 (0x0004) [0x0000000000000000] [0x00000020] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32792,7 +32792,7 @@ public:
 	unsigned long                                      bDestroyBasedActors : 1;                          		// 0x0108 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32809,7 +32809,7 @@ public:
 	unsigned long                                      bVelocityRelativeToActorRotation : 1;             		// 0x0108 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32826,7 +32826,7 @@ public:
 	unsigned long                                      bToggleBasedActors : 1;                           		// 0x0108 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32848,7 +32848,7 @@ public:
 	unsigned long                                      bUseRelativeRotation : 1;                         		// 0x0118 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32878,7 +32878,7 @@ public:
 	unsigned long                                      bDontAddDefaultAdmin : 1;                         		// 0x0388 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32910,7 +32910,7 @@ class AAdmin : public APlayerController
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32937,7 +32937,7 @@ public:
 	class UParticleSystem*                             ParticleTemplate;                                 		// 0x0284 (0x0008) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32953,7 +32953,7 @@ class AKAssetSpawnable : public AKAsset
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32967,7 +32967,7 @@ class UActorFactorySkeletalMeshCinematic : public UActorFactorySkeletalMesh
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32981,7 +32981,7 @@ class UActorFactorySkeletalMeshMAT : public UActorFactorySkeletalMesh
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32995,7 +32995,7 @@ class USeqEvent_Death : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33010,7 +33010,7 @@ class USeqAct_ToggleGodMode : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33025,7 +33025,7 @@ class USeqAct_ToggleAffectedByHitEffects : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33041,7 +33041,7 @@ public:
 	class UTextureMovie*                               MovieTexture;                                     		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33057,7 +33057,7 @@ public:
 	struct FScriptDelegate                             __OnCreateOnlineAccountCompleted__Delegate;       		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33100,7 +33100,7 @@ public:
 	struct FScriptDelegate                             __OnReadAchievementsComplete__Delegate;           		// 0x01A0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33224,7 +33224,7 @@ public:
 	struct FScriptDelegate                             __OnDeviceSelectionComplete__Delegate;            		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33265,7 +33265,7 @@ public:
 	struct FScriptDelegate                             __OnLinkStatusChange__Delegate;                   		// 0x00B0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33318,7 +33318,7 @@ public:
 	struct FScriptDelegate                             __OnQuickMatchComplete__Delegate;                 		// 0x0120 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33398,7 +33398,7 @@ public:
 	struct FScriptDelegate                             __OnContentChange__Delegate;                      		// 0x0080 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33427,7 +33427,7 @@ public:
 	struct FScriptDelegate                             __OnPlayerTalkingStateChange__Delegate;           		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33469,7 +33469,7 @@ public:
 	struct FScriptDelegate                             __OnReadOnlineStatsComplete__Delegate;            		// 0x0080 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33505,7 +33505,7 @@ public:
 	struct FScriptDelegate                             __OnReadNewsCompleted__Delegate;                  		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33525,7 +33525,7 @@ public:
 	struct FScriptDelegate                             __OnSendPartyGameInvitesComplete__Delegate;       		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33550,7 +33550,7 @@ public:
 	TArray<struct FCoverReplicationInfo>               CoverReplicationData;                             		// 0x0270 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33607,7 +33607,7 @@ public:
 	FString                                            SpecEnteredMessage;                               		// 0x01D4 (0x0010) [0x0000000000408002]              ( CPF_Const | CPF_Localized | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33623,7 +33623,7 @@ public:
 	unsigned long                                      bDisplayMessages : 1;                             		// 0x05A8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33641,7 +33641,7 @@ class UDmgType_Suicided : public UKillZDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33657,7 +33657,7 @@ public:
 	unsigned long                                      bToggleTurning : 1;                               		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33674,7 +33674,7 @@ public:
 	class UForceFeedbackWaveform*                      FFWaveform;                                       		// 0x0100 (0x0008) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33695,7 +33695,7 @@ public:
 	unsigned long                                      bDroppedPickups : 1;                              		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000040] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33713,7 +33713,7 @@ public:
 	TArray<FString>                                    Commands;                                         		// 0x0108 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33729,7 +33729,7 @@ class USeqAct_FlyThroughHasEnded : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33745,7 +33745,7 @@ public:
 	unsigned long                                      bTopPriority : 1;                                 		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33767,7 +33767,7 @@ public:
 	unsigned long                                      bOverridePlayingAnim : 1;                         		// 0x0094 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33786,7 +33786,7 @@ public:
 	int                                                BlurWidth;                                        		// 0x00E4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33802,7 +33802,7 @@ public:
 	unsigned long                                      bMuteSpectators : 1;                              		// 0x0274 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33826,7 +33826,7 @@ public:
 	float                                              InterpTime;                                       		// 0x02C0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33842,7 +33842,7 @@ class ADebugCameraHUD : public AHUD
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33859,7 +33859,7 @@ class UDebugCameraInput : public UPlayerInput
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33875,7 +33875,7 @@ public:
 	class APhysicsVolume*                              V;                                                		// 0x0270 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33892,7 +33892,7 @@ public:
 	class AActor*                                      DamageInstigator;                                 		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33906,7 +33906,7 @@ class UDmgType_Crushed : public UDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33920,7 +33920,7 @@ class UDmgType_Fell : public UDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33934,7 +33934,7 @@ class UDmgType_Telefragged : public UDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33949,7 +33949,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x0304 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33964,7 +33964,7 @@ class ADynamicSMActor_Spawnable : public ADynamicSMActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33979,7 +33979,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x02B4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33997,7 +33997,7 @@ public:
 	unsigned long                                      bOverrideScalar : 1;                              		// 0x010C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34012,7 +34012,7 @@ public:
 	FString                                            FailMessage[ 0x4 ];                               		// 0x0074 (0x0040) [0x0000000000408002]              ( CPF_Const | CPF_Localized | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34028,7 +34028,7 @@ class AFracturedSMActorSpawnable : public AFracturedStaticMeshActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34043,7 +34043,7 @@ public:
 	class UObject*                                     SpawnPoint;                                       		// 0x0128 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34071,7 +34071,7 @@ public:
 	unsigned long                                      bPerformAutomaticLayout : 1;                      		// 0x06EC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34102,7 +34102,7 @@ class UUIMessageBox : public UUIMessageBoxBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34119,7 +34119,7 @@ public:
 	unsigned long                                      bEnabled : 1;                                     		// 0x0278 (0x0004) [0x0000000100000020] [0x00000001] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34136,7 +34136,7 @@ class AInterpActor_ForCinematic : public AInterpActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34151,7 +34151,7 @@ public:
 	class UClass*                                      ControllerClass;                                  		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34168,7 +34168,7 @@ public:
 	unsigned long                                      bForceReplace : 1;                                		// 0x0108 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34182,7 +34182,7 @@ class ANavMeshBoundsVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34201,7 +34201,7 @@ public:
 	struct FScriptDelegate                             __OnReadContentListComplete__Delegate;            		// 0x00A0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34240,7 +34240,7 @@ class UOnlineEventsInterface : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34261,7 +34261,7 @@ public:
 	int                                                GameTypeId;                                       		// 0x00E0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34280,7 +34280,7 @@ public:
 	unsigned long                                      bIsArbitrated : 1;                                		// 0x00E0 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34302,7 +34302,7 @@ public:
 	int                                                RecentPartiesAddIndex;                            		// 0x00B4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34332,7 +34332,7 @@ class APathNode_Dynamic : public APathNode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34347,7 +34347,7 @@ class USeqEvent_PickupStatusChange : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34362,7 +34362,7 @@ public:
 	class URadialBlurComponent*                        RadialBlur;                                       		// 0x0270 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34380,7 +34380,7 @@ public:
 	unsigned long                                      bEnableLinearvelocityDrive : 1;                   		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34394,7 +34394,7 @@ class ARB_BSJointActor : public ARB_ConstraintActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34408,7 +34408,7 @@ class ARB_ConstraintActorSpawnable : public ARB_ConstraintActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34422,7 +34422,7 @@ class ARB_HingeActor : public ARB_ConstraintActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34436,7 +34436,7 @@ class ARB_PrismaticActor : public ARB_ConstraintActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34450,7 +34450,7 @@ class ARB_PulleyJointActor : public ARB_ConstraintActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34464,7 +34464,7 @@ class USeqAct_AddRemoveFaceFXAnimSet : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34478,7 +34478,7 @@ class USeqAct_AIAbortMoveToActor : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34495,7 +34495,7 @@ public:
 	struct SFXName                                     ParamName;                                        		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34512,7 +34512,7 @@ public:
 	struct SFXName                                     ParamName;                                        		// 0x0110 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34529,7 +34529,7 @@ public:
 	struct SFXName                                     Value;                                            		// 0x0100 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34546,7 +34546,7 @@ public:
 	struct SFXName                                     SkelControlName;                                  		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34561,7 +34561,7 @@ public:
 	struct FVector                                     DefaultValue;                                     		// 0x00F8 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34576,7 +34576,7 @@ class USeqAct_UpdatePhysBonesFromAnim : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34591,7 +34591,7 @@ class USeqEvent_AIReachedRouteActor : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34608,7 +34608,7 @@ public:
 	unsigned long                                      bCheckForObstructions : 1;                        		// 0x0130 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34624,7 +34624,7 @@ class USeqVar_Byte : public USequenceVariable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34638,7 +34638,7 @@ class USeqVar_Union : public USequenceVariable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34652,7 +34652,7 @@ class USeqVar_UniqueNetId : public USequenceVariable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34666,7 +34666,7 @@ class UUISettingsClient : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34680,7 +34680,7 @@ class USessionSettingsProvider_GameInfo : public USessionSettingsProvider
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34695,7 +34695,7 @@ public:
 	class AActor*                                      AimTarget;                                        		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34710,7 +34710,7 @@ class ASkeletalMeshActorMATSpawnable : public ASkeletalMeshActorMAT
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34724,7 +34724,7 @@ class ATrigger_Dynamic : public ATrigger
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34739,7 +34739,7 @@ public:
 	TArray<class APlayerController*>                   PCsWithLOS;                                       		// 0x0280 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34756,7 +34756,7 @@ public:
 	unsigned long                                      bOpen : 1;                                        		// 0x037C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34774,7 +34774,7 @@ public:
 	TArray<struct FLevelStreamingData>                 Levels;                                           		// 0x0280 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34790,7 +34790,7 @@ public:
 	FString                                            Command;                                          		// 0x00FC (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34804,7 +34804,7 @@ class UUIEvent_Initialized : public UUIEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34822,7 +34822,7 @@ public:
 	unsigned long                                      bIsDisabled : 1;                                  		// 0x00E8 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34837,7 +34837,7 @@ class UUIFocusHint : public UUILabel
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34856,7 +34856,7 @@ public:
 	unsigned long                                      bIsDisabled : 1;                                  		// 0x00E8 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34876,7 +34876,7 @@ public:
 	class USoundCue*                                   ExitSound;                                        		// 0x0324 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34895,7 +34895,7 @@ public:
 	class UWindDirectionalSourceComponent*             Component;                                        		// 0x0270 (0x0008) [0x00000000040A000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_EditConst | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -68,7 +68,7 @@ public:
 	unsigned long                                      bUseIterativePathFinding : 1;                     		// 0x04D8 (0x0004) [0x0000000000004000] [0x00000080] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -106,7 +106,7 @@ public:
 	unsigned long                                      bPendingPop : 1;                                  		// 0x0080 (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -141,7 +141,7 @@ class UGameTypes : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -156,7 +156,7 @@ public:
 	TArray<struct FPropertyInfo>                       Properties;                                       		// 0x00F8 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
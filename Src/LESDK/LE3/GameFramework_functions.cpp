@@ -28,14 +28,11 @@
 
 
 
-class UClass* AGameAIController::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> AGameAIController::pClassPointer { L"Class GameFramework.GameAIController", &UObject::FindClass };
 
 class UClass* AGameAIController::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GameFramework.GameAIController" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function GameFramework.GameAIController.GetActionString
@@ -45,10 +42,9 @@ class UClass* AGameAIController::StaticClass()
 
 FString AGameAIController::eventGetActionString ( )
 {
-	static UFunction* pFnGetActionString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetActionStringRef { L"Function GameFramework.GameAIController.GetActionString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetActionString )
-		pFnGetActionString = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAIController.GetActionString" );
+	UFunction* const pFnGetActionString = pFnGetActionStringRef.Get ( );
 
 	AGameAIController_eventGetActionString_Parms GetActionString_Parms;
 
@@ -67,10 +63,9 @@ FString AGameAIController::eventGetActionString ( )
 
 bool AGameAIController::eventGeneratePathToLocation ( struct FVector const& Goal, float WithinDistance, unsigned long bAllowPartialPath )
 {
-	static UFunction* pFnGeneratePathToLocation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGeneratePathToLocationRef { L"Function GameFramework.GameAIController.GeneratePathToLocation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGeneratePathToLocation )
-		pFnGeneratePathToLocation = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAIController.GeneratePathToLocation" );
+	UFunction* const pFnGeneratePathToLocation = pFnGeneratePathToLocationRef.Get ( );
 
 	AGameAIController_eventGeneratePathToLocation_Parms GeneratePathToLocation_Parms;
 	memcpy ( &GeneratePathToLocation_Parms.Goal, &Goal, 0xC );
@@ -92,10 +87,9 @@ bool AGameAIController::eventGeneratePathToLocation ( struct FVector const& Goal
 
 bool AGameAIController::eventGeneratePathToActor ( class AActor* Goal, float WithinDistance, unsigned long bAllowPartialPath )
 {
-	static UFunction* pFnGeneratePathToActor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGeneratePathToActorRef { L"Function GameFramework.GameAIController.GeneratePathToActor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGeneratePathToActor )
-		pFnGeneratePathToActor = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAIController.GeneratePathToActor" );
+	UFunction* const pFnGeneratePathToActor = pFnGeneratePathToActorRef.Get ( );
 
 	AGameAIController_eventGeneratePathToActor_Parms GeneratePathToActor_Parms;
 	GeneratePathToActor_Parms.Goal = Goal;
@@ -117,10 +111,9 @@ bool AGameAIController::eventGeneratePathToActor ( class AActor* Goal, float Wit
 
 void AGameAIController::SetDesiredRotation ( struct FRotator const& TargetDesiredRotation, unsigned long InLockDesiredRotation, unsigned long InUnlockWhenReached, float InterpolationTime )
 {
-	static UFunction* pFnSetDesiredRotation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetDesiredRotationRef { L"Function GameFramework.GameAIController.SetDesiredRotation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetDesiredRotation )
-		pFnSetDesiredRotation = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAIController.SetDesiredRotation" );
+	UFunction* const pFnSetDesiredRotation = pFnSetDesiredRotationRef.Get ( );
 
 	AGameAIController_execSetDesiredRotation_Parms SetDesiredRotation_Parms;
 	memcpy ( &SetDesiredRotation_Parms.TargetDesiredRotation, &TargetDesiredRotation, 0xC );
@@ -140,10 +133,9 @@ void AGameAIController::SetDesiredRotation ( struct FRotator const& TargetDesire
 
 void AGameAIController::eventAILog_Internal ( FString const& LogText, struct SFXName LogCategory, unsigned long bForce )
 {
-	static UFunction* pFnAILog_Internal = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAILog_InternalRef { L"Function GameFramework.GameAIController.AILog_Internal", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAILog_Internal )
-		pFnAILog_Internal = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAIController.AILog_Internal" );
+	UFunction* const pFnAILog_Internal = pFnAILog_InternalRef.Get ( );
 
 	AGameAIController_eventAILog_Internal_Parms AILog_Internal_Parms;
 	memcpy ( &AILog_Internal_Parms.LogText, &LogText, 0x10 );
@@ -160,10 +152,9 @@ void AGameAIController::eventAILog_Internal ( FString const& LogText, struct SFX
 
 void AGameAIController::RecordDemoAILog ( FString const& LogText )
 {
-	static UFunction* pFnRecordDemoAILog = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecordDemoAILogRef { L"Function GameFramework.GameAIController.RecordDemoAILog", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecordDemoAILog )
-		pFnRecordDemoAILog = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAIController.RecordDemoAILog" );
+	UFunction* const pFnRecordDemoAILog = pFnRecordDemoAILogRef.Get ( );
 
 	AGameAIController_execRecordDemoAILog_Parms RecordDemoAILog_Parms;
 	memcpy ( &RecordDemoAILog_Parms.LogText, &LogText, 0x10 );
@@ -177,10 +168,9 @@ void AGameAIController::RecordDemoAILog ( FString const& LogText )
 
 void AGameAIController::eventDestroyed ( )
 {
-	static UFunction* pFnDestroyed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDestroyedRef { L"Function GameFramework.GameAIController.Destroyed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDestroyed )
-		pFnDestroyed = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAIController.Destroyed" );
+	UFunction* const pFnDestroyed = pFnDestroyedRef.Get ( );
 
 	AGameAIController_eventDestroyed_Parms Destroyed_Parms;
 
@@ -195,19 +185,15 @@ void AGameAIController::eventDestroyed ( )
 
 class UGameAICommand* AGameAIController::GetAICommandInStack ( class UClass* InClass )
 {
-	static UFunction* pFnGetAICommandInStack = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAICommandInStackRef { L"Function GameFramework.GameAIController.GetAICommandInStack", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAICommandInStack )
-		pFnGetAICommandInStack = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAIController.GetAICommandInStack" );
+	UFunction* const pFnGetAICommandInStack = pFnGetAICommandInStackRef.Get ( );
 
 	AGameAIController_execGetAICommandInStack_Parms GetAICommandInStack_Parms;
 	GetAICommandInStack_Parms.InClass = InClass;
 
-	pFnGetAICommandInStack->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetAICommandInStack, &GetAICommandInStack_Parms, NULL );
-
-	pFnGetAICommandInStack->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetAICommandInStack, &GetAICommandInStack_Parms ) )
+		this->ProcessEvent ( pFnGetAICommandInStack, &GetAICommandInStack_Parms, NULL );
 
 	return GetAICommandInStack_Parms.ReturnValue;
 };
@@ -220,19 +206,15 @@ class UGameAICommand* AGameAIController::GetAICommandInStack ( class UClass* InC
 
 class UGameAICommand* AGameAIController::FindCommandOfClass ( class UClass* SearchClass )
 {
-	static UFunction* pFnFindCommandOfClass = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFindCommandOfClassRef { L"Function GameFramework.GameAIController.FindCommandOfClass", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFindCommandOfClass )
-		pFnFindCommandOfClass = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAIController.FindCommandOfClass" );
+	UFunction* const pFnFindCommandOfClass = pFnFindCommandOfClassRef.Get ( );
 
 	AGameAIController_execFindCommandOfClass_Parms FindCommandOfClass_Parms;
 	FindCommandOfClass_Parms.SearchClass = SearchClass;
 
-	pFnFindCommandOfClass->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnFindCommandOfClass, &FindCommandOfClass_Parms, NULL );
-
-	pFnFindCommandOfClass->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnFindCommandOfClass, &FindCommandOfClass_Parms ) )
+		this->ProcessEvent ( pFnFindCommandOfClass, &FindCommandOfClass_Parms, NULL );
 
 	return FindCommandOfClass_Parms.ReturnValue;
 };
@@ -243,18 +225,14 @@ class UGameAICommand* AGameAIController::FindCommandOfClass ( class UClass* Sear
 
 void AGameAIController::DumpCommandStack ( )
 {
-	static UFunction* pFnDumpCommandStack = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDumpCommandStackRef { L"Function GameFramework.GameAIController.DumpCommandStack", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDumpCommandStack )
-		pFnDumpCommandStack = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAIController.DumpCommandStack" );
+	UFunction* const pFnDumpCommandStack = pFnDumpCommandStackRef.Get ( );
 
 	AGameAIController_execDumpCommandStack_Parms DumpCommandStack_Parms;
 
-	pFnDumpCommandStack->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnDumpCommandStack, &DumpCommandStack_Parms, NULL );
-
-	pFnDumpCommandStack->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnDumpCommandStack, &DumpCommandStack_Parms ) )
+		this->ProcessEvent ( pFnDumpCommandStack, &DumpCommandStack_Parms, NULL );
 };
 
 // Function GameFramework.GameAIController.CheckCommandCount
@@ -263,18 +241,14 @@ void AGameAIController::DumpCommandStack ( )
 
 void AGameAIController::CheckCommandCount ( )
 {
-	static UFunction* pFnCheckCommandCount = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCheckCommandCountRef { L"Function GameFramework.GameAIController.CheckCommandCount", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCheckCommandCount )
-		pFnCheckCommandCount = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAIController.CheckCommandCount" );
+	UFunction* const pFnCheckCommandCount = pFnCheckCommandCountRef.Get ( );
 
 	AGameAIController_execCheckCommandCount_Parms CheckCommandCount_Parms;
 
-	pFnCheckCommandCount->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnCheckCommandCount, &CheckCommandCount_Parms, NULL );
-
-	pFnCheckCommandCount->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnCheckCommandCount, &CheckCommandCount_Parms ) )
+		this->ProcessEvent ( pFnCheckCommandCount, &CheckCommandCount_Parms, NULL );
 };
 
 // Function GameFramework.GameAIController.GetActiveCommand
@@ -284,18 +258,14 @@ void AGameAIController::CheckCommandCount ( )
 
 class UGameAICommand* AGameAIController::GetActiveCommand ( )
 {
-	static UFunction* pFnGetActiveCommand = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetActiveCommandRef { L"Function GameFramework.GameAIController.GetActiveCommand", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetActiveCommand )
-		pFnGetActiveCommand = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAIController.GetActiveCommand" );
+	UFunction* const pFnGetActiveCommand = pFnGetActiveCommandRef.Get ( );
 
 	AGameAIController_execGetActiveCommand_Parms GetActiveCommand_Parms;
 
-	pFnGetActiveCommand->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnGetActiveCommand, &GetActiveCommand_Parms, NULL );
-
-	pFnGetActiveCommand->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnGetActiveCommand, &GetActiveCommand_Parms ) )
+		this->ProcessEvent ( pFnGetActiveCommand, &GetActiveCommand_Parms, NULL );
 
 	return GetActiveCommand_Parms.ReturnValue;
 };
@@ -309,20 +279,16 @@ class UGameAICommand* AGameAIController::GetActiveCommand ( )
 
 bool AGameAIController::AbortCommand ( class UGameAICommand* AbortCmd, class UClass* AbortClass )
 {
-	static UFunction* pFnAbortCommand = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAbortCommandRef { L"Function GameFramework.GameAIController.AbortCommand", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAbortCommand )
-		pFnAbortCommand = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAIController.AbortCommand" );
+	UFunction* const pFnAbortCommand = pFnAbortCommandRef.Get ( );
 
 	AGameAIController_execAbortCommand_Parms AbortCommand_Parms;
 	AbortCommand_Parms.AbortCmd = AbortCmd;
 	AbortCommand_Parms.AbortClass = AbortClass;
 
-	pFnAbortCommand->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnAbortCommand, &AbortCommand_Parms, NULL );
-
-	pFnAbortCommand->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnAbortCommand, &AbortCommand_Parms ) )
+		this->ProcessEvent ( pFnAbortCommand, &AbortCommand_Parms, NULL );
 
 	return AbortCommand_Parms.ReturnValue;
 };
@@ -334,19 +300,15 @@ bool AGameAIController::AbortCommand ( class UGameAICommand* AbortCmd, class UCl
 
 void AGameAIController::PopCommand ( class UGameAICommand* ToBePoppedCommand )
 {
-	static UFunction* pFnPopCommand = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopCommandRef { L"Function GameFramework.GameAIController.PopCommand", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopCommand )
-		pFnPopCommand = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAIController.PopCommand" );
+	UFunction* const pFnPopCommand = pFnPopCommandRef.Get ( );
 
 	AGameAIController_execPopCommand_Parms PopCommand_Parms;
 	PopCommand_Parms.ToBePoppedCommand = ToBePoppedCommand;
 
-	pFnPopCommand->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnPopCommand, &PopCommand_Parms, NULL );
-
-	pFnPopCommand->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnPopCommand, &PopCommand_Parms ) )
+		this->ProcessEvent ( pFnPopCommand, &PopCommand_Parms, NULL );
 };
 
 // Function GameFramework.GameAIController.PushCommand
@@ -356,31 +318,24 @@ void AGameAIController::PopCommand ( class UGameAICommand* ToBePoppedCommand )
 
 void AGameAIController::PushCommand ( class UGameAICommand* NewCommand )
 {
-	static UFunction* pFnPushCommand = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPushCommandRef { L"Function GameFramework.GameAIController.PushCommand", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPushCommand )
-		pFnPushCommand = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAIController.PushCommand" );
+	UFunction* const pFnPushCommand = pFnPushCommandRef.Get ( );
 
 	AGameAIController_execPushCommand_Parms PushCommand_Parms;
 	PushCommand_Parms.NewCommand = NewCommand;
 
-	pFnPushCommand->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnPushCommand, &PushCommand_Parms, NULL );
-
-	pFnPushCommand->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnPushCommand, &PushCommand_Parms ) )
+		this->ProcessEvent ( pFnPushCommand, &PushCommand_Parms, NULL );
 };
 
 
 
-class UClass* UGameAICommand::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGameAICommand::pClassPointer { L"Class GameFramework.GameAICommand", &UObject::FindClass };
 
 class UClass* UGameAICommand::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GameFramework.GameAICommand" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function GameFramework.GameAICommand.GetDebugOverheadText
@@ -391,10 +346,9 @@ class UClass* UGameAICommand::StaticClass()
 
 void UGameAICommand::GetDebugOverheadText ( class APlayerController* PC, TArray<FString>* OutText )
 {
-	static UFunction* pFnGetDebugOverheadText = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDebugOverheadTextRef { L"Function GameFramework.GameAICommand.GetDebugOverheadText", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDebugOverheadText )
-		pFnGetDebugOverheadText = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.GetDebugOverheadText" );
+	UFunction* const pFnGetDebugOverheadText = pFnGetDebugOverheadTextRef.Get ( );
 
 	UGameAICommand_execGetDebugOverheadText_Parms GetDebugOverheadText_Parms;
 	GetDebugOverheadText_Parms.PC = PC;
@@ -416,10 +370,9 @@ void UGameAICommand::GetDebugOverheadText ( class APlayerController* PC, TArray<
 
 void UGameAICommand::eventDrawDebug ( class AHUD* H, struct SFXName Category )
 {
-	static UFunction* pFnDrawDebug = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDrawDebugRef { L"Function GameFramework.GameAICommand.DrawDebug", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDrawDebug )
-		pFnDrawDebug = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.DrawDebug" );
+	UFunction* const pFnDrawDebug = pFnDrawDebugRef.Get ( );
 
 	UGameAICommand_eventDrawDebug_Parms DrawDebug_Parms;
 	DrawDebug_Parms.H = H;
@@ -435,10 +388,9 @@ void UGameAICommand::eventDrawDebug ( class AHUD* H, struct SFXName Category )
 
 FString UGameAICommand::eventGetDumpString ( )
 {
-	static UFunction* pFnGetDumpString = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDumpStringRef { L"Function GameFramework.GameAICommand.GetDumpString", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDumpString )
-		pFnGetDumpString = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.GetDumpString" );
+	UFunction* const pFnGetDumpString = pFnGetDumpStringRef.Get ( );
 
 	UGameAICommand_eventGetDumpString_Parms GetDumpString_Parms;
 
@@ -454,10 +406,9 @@ FString UGameAICommand::eventGetDumpString ( )
 
 void UGameAICommand::Resumed ( struct SFXName OldCommandName )
 {
-	static UFunction* pFnResumed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResumedRef { L"Function GameFramework.GameAICommand.Resumed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResumed )
-		pFnResumed = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.Resumed" );
+	UFunction* const pFnResumed = pFnResumedRef.Get ( );
 
 	UGameAICommand_execResumed_Parms Resumed_Parms;
 	memcpy ( &Resumed_Parms.OldCommandName, &OldCommandName, 0x8 );
@@ -472,10 +423,9 @@ void UGameAICommand::Resumed ( struct SFXName OldCommandName )
 
 void UGameAICommand::Paused ( class UGameAICommand* NewCommand )
 {
-	static UFunction* pFnPaused = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPausedRef { L"Function GameFramework.GameAICommand.Paused", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPaused )
-		pFnPaused = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.Paused" );
+	UFunction* const pFnPaused = pFnPausedRef.Get ( );
 
 	UGameAICommand_execPaused_Parms Paused_Parms;
 	Paused_Parms.NewCommand = NewCommand;
@@ -489,10 +439,9 @@ void UGameAICommand::Paused ( class UGameAICommand* NewCommand )
 
 void UGameAICommand::Popped ( )
 {
-	static UFunction* pFnPopped = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPoppedRef { L"Function GameFramework.GameAICommand.Popped", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopped )
-		pFnPopped = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.Popped" );
+	UFunction* const pFnPopped = pFnPoppedRef.Get ( );
 
 	UGameAICommand_execPopped_Parms Popped_Parms;
 
@@ -505,10 +454,9 @@ void UGameAICommand::Popped ( )
 
 void UGameAICommand::Pushed ( )
 {
-	static UFunction* pFnPushed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPushedRef { L"Function GameFramework.GameAICommand.Pushed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPushed )
-		pFnPushed = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.Pushed" );
+	UFunction* const pFnPushed = pFnPushedRef.Get ( );
 
 	UGameAICommand_execPushed_Parms Pushed_Parms;
 
@@ -521,10 +469,9 @@ void UGameAICommand::Pushed ( )
 
 void UGameAICommand::PostPopped ( )
 {
-	static UFunction* pFnPostPopped = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPostPoppedRef { L"Function GameFramework.GameAICommand.PostPopped", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPostPopped )
-		pFnPostPopped = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.PostPopped" );
+	UFunction* const pFnPostPopped = pFnPostPoppedRef.Get ( );
 
 	UGameAICommand_execPostPopped_Parms PostPopped_Parms;
 
@@ -538,10 +485,9 @@ void UGameAICommand::PostPopped ( )
 
 void UGameAICommand::PrePushed ( class AGameAIController* AI )
 {
-	static UFunction* pFnPrePushed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPrePushedRef { L"Function GameFramework.GameAICommand.PrePushed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPrePushed )
-		pFnPrePushed = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.PrePushed" );
+	UFunction* const pFnPrePushed = pFnPrePushedRef.Get ( );
 
 	UGameAICommand_execPrePushed_Parms PrePushed_Parms;
 	PrePushed_Parms.AI = AI;
@@ -557,10 +503,9 @@ void UGameAICommand::PrePushed ( class AGameAIController* AI )
 
 bool UGameAICommand::AllowStateTransitionTo ( struct SFXName StateName )
 {
-	static UFunction* pFnAllowStateTransitionTo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAllowStateTransitionToRef { L"Function GameFramework.GameAICommand.AllowStateTransitionTo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAllowStateTransitionTo )
-		pFnAllowStateTransitionTo = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.AllowStateTransitionTo" );
+	UFunction* const pFnAllowStateTransitionTo = pFnAllowStateTransitionToRef.Get ( );
 
 	UGameAICommand_execAllowStateTransitionTo_Parms AllowStateTransitionTo_Parms;
 	memcpy ( &AllowStateTransitionTo_Parms.StateName, &StateName, 0x8 );
@@ -578,10 +523,9 @@ bool UGameAICommand::AllowStateTransitionTo ( struct SFXName StateName )
 
 bool UGameAICommand::AllowTransitionTo ( class UClass* AttemptCommand )
 {
-	static UFunction* pFnAllowTransitionTo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAllowTransitionToRef { L"Function GameFramework.GameAICommand.AllowTransitionTo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAllowTransitionTo )
-		pFnAllowTransitionTo = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.AllowTransitionTo" );
+	UFunction* const pFnAllowTransitionTo = pFnAllowTransitionToRef.Get ( );
 
 	UGameAICommand_execAllowTransitionTo_Parms AllowTransitionTo_Parms;
 	AllowTransitionTo_Parms.AttemptCommand = AttemptCommand;
@@ -598,10 +542,9 @@ bool UGameAICommand::AllowTransitionTo ( class UClass* AttemptCommand )
 
 void UGameAICommand::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickRef { L"Function GameFramework.GameAICommand.Tick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTick )
-		pFnTick = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.Tick" );
+	UFunction* const pFnTick = pFnTickRef.Get ( );
 
 	UGameAICommand_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -616,18 +559,14 @@ void UGameAICommand::Tick ( float DeltaTime )
 
 bool UGameAICommand::ShouldIgnoreNotifies ( )
 {
-	static UFunction* pFnShouldIgnoreNotifies = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldIgnoreNotifiesRef { L"Function GameFramework.GameAICommand.ShouldIgnoreNotifies", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldIgnoreNotifies )
-		pFnShouldIgnoreNotifies = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.ShouldIgnoreNotifies" );
+	UFunction* const pFnShouldIgnoreNotifies = pFnShouldIgnoreNotifiesRef.Get ( );
 
 	UGameAICommand_execShouldIgnoreNotifies_Parms ShouldIgnoreNotifies_Parms;
 
-	pFnShouldIgnoreNotifies->FunctionFlags |= ~0x400;
-
-	this->ProcessEvent ( pFnShouldIgnoreNotifies, &ShouldIgnoreNotifies_Parms, NULL );
-
-	pFnShouldIgnoreNotifies->FunctionFlags |= 0x400;
+	if ( !::LESDK::CallNative ( this, pFnShouldIgnoreNotifies, &ShouldIgnoreNotifies_Parms ) )
+		this->ProcessEvent ( pFnShouldIgnoreNotifies, &ShouldIgnoreNotifies_Parms, NULL );
 
 	return ShouldIgnoreNotifies_Parms.ReturnValue;
 };
@@ -639,10 +578,9 @@ bool UGameAICommand::ShouldIgnoreNotifies ( )
 
 void UGameAICommand::eventInternalTick ( float DeltaTime )
 {
-	static UFunction* pFnInternalTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalTickRef { L"Function GameFramework.GameAICommand.InternalTick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalTick )
-		pFnInternalTick = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.InternalTick" );
+	UFunction* const pFnInternalTick = pFnInternalTickRef.Get ( );
 
 	UGameAICommand_eventInternalTick_Parms InternalTick_Parms;
 	InternalTick_Parms.DeltaTime = DeltaTime;
@@ -657,10 +595,9 @@ void UGameAICommand::eventInternalTick ( float DeltaTime )
 
 void UGameAICommand::eventInternalResumed ( struct SFXName OldCommandName )
 {
-	static UFunction* pFnInternalResumed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalResumedRef { L"Function GameFramework.GameAICommand.InternalResumed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalResumed )
-		pFnInternalResumed = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.InternalResumed" );
+	UFunction* const pFnInternalResumed = pFnInternalResumedRef.Get ( );
 
 	UGameAICommand_eventInternalResumed_Parms InternalResumed_Parms;
 	memcpy ( &InternalResumed_Parms.OldCommandName, &OldCommandName, 0x8 );
@@ -675,10 +612,9 @@ void UGameAICommand::eventInternalResumed ( struct SFXName OldCommandName )
 
 void UGameAICommand::eventInternalPaused ( class UGameAICommand* NewCommand )
 {
-	static UFunction* pFnInternalPaused = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalPausedRef { L"Function GameFramework.GameAICommand.InternalPaused", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalPaused )
-		pFnInternalPaused = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.InternalPaused" );
+	UFunction* const pFnInternalPaused = pFnInternalPausedRef.Get ( );
 
 	UGameAICommand_eventInternalPaused_Parms InternalPaused_Parms;
 	InternalPaused_Parms.NewCommand = NewCommand;
@@ -692,10 +628,9 @@ void UGameAICommand::eventInternalPaused ( class UGameAICommand* NewCommand )
 
 void UGameAICommand::eventInternalPopped ( )
 {
-	static UFunction* pFnInternalPopped = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalPoppedRef { L"Function GameFramework.GameAICommand.InternalPopped", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalPopped )
-		pFnInternalPopped = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.InternalPopped" );
+	UFunction* const pFnInternalPopped = pFnInternalPoppedRef.Get ( );
 
 	UGameAICommand_eventInternalPopped_Parms InternalPopped_Parms;
 
@@ -708,10 +643,9 @@ void UGameAICommand::eventInternalPopped ( )
 
 void UGameAICommand::eventInternalPushed ( )
 {
-	static UFunction* pFnInternalPushed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalPushedRef { L"Function GameFramework.GameAICommand.InternalPushed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalPushed )
-		pFnInternalPushed = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.InternalPushed" );
+	UFunction* const pFnInternalPushed = pFnInternalPushedRef.Get ( );
 
 	UGameAICommand_eventInternalPushed_Parms InternalPushed_Parms;
 
@@ -725,10 +659,9 @@ void UGameAICommand::eventInternalPushed ( )
 
 void UGameAICommand::eventInternalPrePushed ( class AGameAIController* AI )
 {
-	static UFunction* pFnInternalPrePushed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalPrePushedRef { L"Function GameFramework.GameAICommand.InternalPrePushed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalPrePushed )
-		pFnInternalPrePushed = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.InternalPrePushed" );
+	UFunction* const pFnInternalPrePushed = pFnInternalPrePushedRef.Get ( );
 
 	UGameAICommand_eventInternalPrePushed_Parms InternalPrePushed_Parms;
 	InternalPrePushed_Parms.AI = AI;
@@ -744,10 +677,9 @@ void UGameAICommand::eventInternalPrePushed ( class AGameAIController* AI )
 
 bool UGameAICommand::InitCommand ( class AGameAIController* AI )
 {
-	static UFunction* pFnInitCommand = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitCommandRef { L"Function GameFramework.GameAICommand.InitCommand", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitCommand )
-		pFnInitCommand = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.InitCommand" );
+	UFunction* const pFnInitCommand = pFnInitCommandRef.Get ( );
 
 	UGameAICommand_execInitCommand_Parms InitCommand_Parms;
 	InitCommand_Parms.AI = AI;
@@ -766,10 +698,9 @@ bool UGameAICommand::InitCommand ( class AGameAIController* AI )
 
 bool UGameAICommand::InitCommandUserActor ( class AGameAIController* AI, class AActor* UserActor )
 {
-	static UFunction* pFnInitCommandUserActor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitCommandUserActorRef { L"Function GameFramework.GameAICommand.InitCommandUserActor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitCommandUserActor )
-		pFnInitCommandUserActor = UObject::FindObject< UFunction > ( L"Function GameFramework.GameAICommand.InitCommandUserActor" );
+	UFunction* const pFnInitCommandUserActor = pFnInitCommandUserActorRef.Get ( );
 
 	UGameAICommand_execInitCommandUserActor_Parms InitCommandUserActor_Parms;
 	InitCommandUserActor_Parms.AI = AI;
@@ -782,30 +713,78 @@ bool UGameAICommand::InitCommandUserActor ( class AGameAIController* AI, class A
 
 
 
-class UClass* UGameTypes::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UGameTypes::pClassPointer { L"Class GameFramework.GameTypes", &UObject::FindClass };
 
 class UClass* UGameTypes::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GameFramework.GameTypes" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USeqAct_ModifyProperty::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USeqAct_ModifyProperty::pClassPointer { L"Class GameFramework.SeqAct_ModifyProperty", &UObject::FindClass };
 
 class UClass* USeqAct_ModifyProperty::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class GameFramework.SeqAct_ModifyProperty" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class GameFramework.GameAIController",
+	L"Function GameFramework.GameAIController.GetActionString",
+	L"Function GameFramework.GameAIController.GeneratePathToLocation",
+	L"Function GameFramework.GameAIController.GeneratePathToActor",
+	L"Function GameFramework.GameAIController.SetDesiredRotation",
+	L"Function GameFramework.GameAIController.AILog_Internal",
+	L"Function GameFramework.GameAIController.RecordDemoAILog",
+	L"Function GameFramework.GameAIController.Destroyed",
+	L"Function GameFramework.GameAIController.GetAICommandInStack",
+	L"Function GameFramework.GameAIController.FindCommandOfClass",
+	L"Function GameFramework.GameAIController.DumpCommandStack",
+	L"Function GameFramework.GameAIController.CheckCommandCount",
+	L"Function GameFramework.GameAIController.GetActiveCommand",
+	L"Function GameFramework.GameAIController.AbortCommand",
+	L"Function GameFramework.GameAIController.PopCommand",
+	L"Function GameFramework.GameAIController.PushCommand",
+	L"Class GameFramework.GameAICommand",
+	L"Function GameFramework.GameAICommand.GetDebugOverheadText",
+	L"Function GameFramework.GameAICommand.DrawDebug",
+	L"Function GameFramework.GameAICommand.GetDumpString",
+	L"Function GameFramework.GameAICommand.Resumed",
+	L"Function GameFramework.GameAICommand.Paused",
+	L"Function GameFramework.GameAICommand.Popped",
+	L"Function GameFramework.GameAICommand.Pushed",
+	L"Function GameFramework.GameAICommand.PostPopped",
+	L"Function GameFramework.GameAICommand.PrePushed",
+	L"Function GameFramework.GameAICommand.AllowStateTransitionTo",
+	L"Function GameFramework.GameAICommand.AllowTransitionTo",
+	L"Function GameFramework.GameAICommand.Tick",
+	L"Function GameFramework.GameAICommand.ShouldIgnoreNotifies",
+	L"Function GameFramework.GameAICommand.InternalTick",
+	L"Function GameFramework.GameAICommand.InternalResumed",
+	L"Function GameFramework.GameAICommand.InternalPaused",
+	L"Function GameFramework.GameAICommand.InternalPopped",
+	L"Function GameFramework.GameAICommand.InternalPushed",
+	L"Function GameFramework.GameAICommand.InternalPrePushed",
+	L"Function GameFramework.GameAICommand.InitCommand",
+	L"Function GameFramework.GameAICommand.InitCommandUserActor",
+	L"Class GameFramework.GameTypes",
+	L"Class GameFramework.SeqAct_ModifyProperty",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
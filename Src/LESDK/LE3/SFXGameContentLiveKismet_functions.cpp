@@ -28,14 +28,11 @@
 
 
 
-class UClass* UBioSeqAct_GiveMissionXP::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_GiveMissionXP::pClassPointer { L"Class SFXGameContentLiveKismet.BioSeqAct_GiveMissionXP", &UObject::FindClass };
 
 class UClass* UBioSeqAct_GiveMissionXP::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.BioSeqAct_GiveMissionXP" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.BioSeqAct_GiveMissionXP.GetObjClassVersion
@@ -45,10 +42,9 @@ class UClass* UBioSeqAct_GiveMissionXP::StaticClass()
 
 int UBioSeqAct_GiveMissionXP::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContentLiveKismet.BioSeqAct_GiveMissionXP.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.BioSeqAct_GiveMissionXP.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	UBioSeqAct_GiveMissionXP_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -59,14 +55,11 @@ int UBioSeqAct_GiveMissionXP::eventGetObjClassVersion ( )
 
 
 
-class UClass* USFXSeqAct_ClearAreaMap::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_ClearAreaMap::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqAct_ClearAreaMap", &UObject::FindClass };
 
 class UClass* USFXSeqAct_ClearAreaMap::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqAct_ClearAreaMap" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqAct_ClearAreaMap.GetObjClassVersion
@@ -76,10 +69,9 @@ class UClass* USFXSeqAct_ClearAreaMap::StaticClass()
 
 int USFXSeqAct_ClearAreaMap::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_ClearAreaMap.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_ClearAreaMap.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USFXSeqAct_ClearAreaMap_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -94,10 +86,9 @@ int USFXSeqAct_ClearAreaMap::eventGetObjClassVersion ( )
 
 void USFXSeqAct_ClearAreaMap::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_ClearAreaMap.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_ClearAreaMap.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_ClearAreaMap_execActivated_Parms Activated_Parms;
 
@@ -106,14 +97,11 @@ void USFXSeqAct_ClearAreaMap::Activated ( )
 
 
 
-class UClass* USFXSeqAct_GetHenchmenInSquad::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_GetHenchmenInSquad::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqAct_GetHenchmenInSquad", &UObject::FindClass };
 
 class UClass* USFXSeqAct_GetHenchmenInSquad::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqAct_GetHenchmenInSquad" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqAct_GetHenchmenInSquad.Activated
@@ -122,10 +110,9 @@ class UClass* USFXSeqAct_GetHenchmenInSquad::StaticClass()
 
 void USFXSeqAct_GetHenchmenInSquad::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_GetHenchmenInSquad.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_GetHenchmenInSquad.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_GetHenchmenInSquad_execActivated_Parms Activated_Parms;
 
@@ -140,10 +127,9 @@ void USFXSeqAct_GetHenchmenInSquad::Activated ( )
 
 float USFXSeqAct_GetHenchmenInSquad::GetPriority ( class APawn* Henchman )
 {
-	static UFunction* pFnGetPriority = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPriorityRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_GetHenchmenInSquad.GetPriority", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPriority )
-		pFnGetPriority = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_GetHenchmenInSquad.GetPriority" );
+	UFunction* const pFnGetPriority = pFnGetPriorityRef.Get ( );
 
 	USFXSeqAct_GetHenchmenInSquad_execGetPriority_Parms GetPriority_Parms;
 	GetPriority_Parms.Henchman = Henchman;
@@ -155,14 +141,11 @@ float USFXSeqAct_GetHenchmenInSquad::GetPriority ( class APawn* Henchman )
 
 
 
-class UClass* USFXSeqAct_GetTag::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_GetTag::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqAct_GetTag", &UObject::FindClass };
 
 class UClass* USFXSeqAct_GetTag::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqAct_GetTag" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqAct_GetTag.Activated
@@ -171,10 +154,9 @@ class UClass* USFXSeqAct_GetTag::StaticClass()
 
 void USFXSeqAct_GetTag::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_GetTag.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_GetTag.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_GetTag_execActivated_Parms Activated_Parms;
 
@@ -183,14 +165,11 @@ void USFXSeqAct_GetTag::Activated ( )
 
 
 
-class UClass* Usfxseqact_leavemission::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> Usfxseqact_leavemission::pClassPointer { L"Class SFXGameContentLiveKismet.sfxseqact_leavemission", &UObject::FindClass };
 
 class UClass* Usfxseqact_leavemission::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.sfxseqact_leavemission" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.sfxseqact_leavemission.GrantAutomaticGawAssets
@@ -199,10 +178,9 @@ class UClass* Usfxseqact_leavemission::StaticClass()
 
 void Usfxseqact_leavemission::GrantAutomaticGawAssets ( )
 {
-	static UFunction* pFnGrantAutomaticGawAssets = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGrantAutomaticGawAssetsRef { L"Function SFXGameContentLiveKismet.sfxseqact_leavemission.GrantAutomaticGawAssets", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGrantAutomaticGawAssets )
-		pFnGrantAutomaticGawAssets = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.sfxseqact_leavemission.GrantAutomaticGawAssets" );
+	UFunction* const pFnGrantAutomaticGawAssets = pFnGrantAutomaticGawAssetsRef.Get ( );
 
 	Usfxseqact_leavemission_execGrantAutomaticGawAssets_Parms GrantAutomaticGawAssets_Parms;
 
@@ -215,10 +193,9 @@ void Usfxseqact_leavemission::GrantAutomaticGawAssets ( )
 
 void Usfxseqact_leavemission::eventActivated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.sfxseqact_leavemission.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.sfxseqact_leavemission.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	Usfxseqact_leavemission_eventActivated_Parms Activated_Parms;
 
@@ -232,10 +209,9 @@ void Usfxseqact_leavemission::eventActivated ( )
 
 class ABioWorldInfo* Usfxseqact_leavemission::getWorld ( )
 {
-	static UFunction* pFngetWorld = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFngetWorldRef { L"Function SFXGameContentLiveKismet.sfxseqact_leavemission.getWorld", &UObject::FindObject< UFunction > };
 
-	if ( ! pFngetWorld )
-		pFngetWorld = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.sfxseqact_leavemission.getWorld" );
+	UFunction* const pFngetWorld = pFngetWorldRef.Get ( );
 
 	Usfxseqact_leavemission_execgetWorld_Parms getWorld_Parms;
 
@@ -246,14 +222,11 @@ class ABioWorldInfo* Usfxseqact_leavemission::getWorld ( )
 
 
 
-class UClass* USFXSeqAct_SaveGame::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_SaveGame::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqAct_SaveGame", &UObject::FindClass };
 
 class UClass* USFXSeqAct_SaveGame::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqAct_SaveGame" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.GetObjClassVersion
@@ -263,10 +236,9 @@ class UClass* USFXSeqAct_SaveGame::StaticClass()
 
 int USFXSeqAct_SaveGame::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USFXSeqAct_SaveGame_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -282,10 +254,9 @@ int USFXSeqAct_SaveGame::eventGetObjClassVersion ( )
 
 void USFXSeqAct_SaveGame::BeginSave ( struct FSFXSaveDescriptor const& Descriptor )
 {
-	static UFunction* pFnBeginSave = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBeginSaveRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.BeginSave", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBeginSave )
-		pFnBeginSave = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.BeginSave" );
+	UFunction* const pFnBeginSave = pFnBeginSaveRef.Get ( );
 
 	USFXSeqAct_SaveGame_execBeginSave_Parms BeginSave_Parms;
 	memcpy ( &BeginSave_Parms.Descriptor, &Descriptor, 0x28 );
@@ -299,10 +270,9 @@ void USFXSeqAct_SaveGame::BeginSave ( struct FSFXSaveDescriptor const& Descripto
 
 void USFXSeqAct_SaveGame::Deactivated ( )
 {
-	static UFunction* pFnDeactivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDeactivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.Deactivated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDeactivated )
-		pFnDeactivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.Deactivated" );
+	UFunction* const pFnDeactivated = pFnDeactivatedRef.Get ( );
 
 	USFXSeqAct_SaveGame_execDeactivated_Parms Deactivated_Parms;
 
@@ -317,10 +287,9 @@ void USFXSeqAct_SaveGame::Deactivated ( )
 
 bool USFXSeqAct_SaveGame::Update ( float DeltaTime )
 {
-	static UFunction* pFnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdateRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.Update", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdate )
-		pFnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.Update" );
+	UFunction* const pFnUpdate = pFnUpdateRef.Get ( );
 
 	USFXSeqAct_SaveGame_execUpdate_Parms Update_Parms;
 	Update_Parms.DeltaTime = DeltaTime;
@@ -336,10 +305,9 @@ bool USFXSeqAct_SaveGame::Update ( float DeltaTime )
 
 void USFXSeqAct_SaveGame::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_SaveGame_execActivated_Parms Activated_Parms;
 
@@ -353,10 +321,9 @@ void USFXSeqAct_SaveGame::Activated ( )
 
 class ABioPlayerController* USFXSeqAct_SaveGame::GetBioPlayerController ( )
 {
-	static UFunction* pFnGetBioPlayerController = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetBioPlayerControllerRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.GetBioPlayerController", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetBioPlayerController )
-		pFnGetBioPlayerController = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.GetBioPlayerController" );
+	UFunction* const pFnGetBioPlayerController = pFnGetBioPlayerControllerRef.Get ( );
 
 	USFXSeqAct_SaveGame_execGetBioPlayerController_Parms GetBioPlayerController_Parms;
 
@@ -373,10 +340,9 @@ class ABioPlayerController* USFXSeqAct_SaveGame::GetBioPlayerController ( )
 
 bool USFXSeqAct_SaveGame::CanSave ( class ABioPlayerController* PC )
 {
-	static UFunction* pFnCanSave = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanSaveRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.CanSave", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanSave )
-		pFnCanSave = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.CanSave" );
+	UFunction* const pFnCanSave = pFnCanSaveRef.Get ( );
 
 	USFXSeqAct_SaveGame_execCanSave_Parms CanSave_Parms;
 	CanSave_Parms.PC = PC;
@@ -388,14 +354,11 @@ bool USFXSeqAct_SaveGame::CanSave ( class ABioPlayerController* PC )
 
 
 
-class UClass* USFXSeqAct_SetTag::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_SetTag::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqAct_SetTag", &UObject::FindClass };
 
 class UClass* USFXSeqAct_SetTag::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqAct_SetTag" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqAct_SetTag.Activated
@@ -404,10 +367,9 @@ class UClass* USFXSeqAct_SetTag::StaticClass()
 
 void USFXSeqAct_SetTag::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_SetTag.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_SetTag.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_SetTag_execActivated_Parms Activated_Parms;
 
@@ -416,14 +378,11 @@ void USFXSeqAct_SetTag::Activated ( )
 
 
 
-class UClass* USFXSeqAct_SetWasInSquad::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_SetWasInSquad::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqAct_SetWasInSquad", &UObject::FindClass };
 
 class UClass* USFXSeqAct_SetWasInSquad::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqAct_SetWasInSquad" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqAct_SetWasInSquad.Activated
@@ -432,10 +391,9 @@ class UClass* USFXSeqAct_SetWasInSquad::StaticClass()
 
 void USFXSeqAct_SetWasInSquad::eventActivated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_SetWasInSquad.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_SetWasInSquad.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_SetWasInSquad_eventActivated_Parms Activated_Parms;
 
@@ -449,10 +407,9 @@ void USFXSeqAct_SetWasInSquad::eventActivated ( )
 
 class ABioWorldInfo* USFXSeqAct_SetWasInSquad::getWorld ( )
 {
-	static UFunction* pFngetWorld = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFngetWorldRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_SetWasInSquad.getWorld", &UObject::FindObject< UFunction > };
 
-	if ( ! pFngetWorld )
-		pFngetWorld = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_SetWasInSquad.getWorld" );
+	UFunction* const pFngetWorld = pFngetWorldRef.Get ( );
 
 	USFXSeqAct_SetWasInSquad_execgetWorld_Parms getWorld_Parms;
 
@@ -463,14 +420,11 @@ class ABioWorldInfo* USFXSeqAct_SetWasInSquad::getWorld ( )
 
 
 
-class UClass* USFXSeqAct_TogglePlayerSaves::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_TogglePlayerSaves::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves", &UObject::FindClass };
 
 class UClass* USFXSeqAct_TogglePlayerSaves::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.GetObjClassVersion
@@ -480,10 +434,9 @@ class UClass* USFXSeqAct_TogglePlayerSaves::StaticClass()
 
 int USFXSeqAct_TogglePlayerSaves::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USFXSeqAct_TogglePlayerSaves_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -498,10 +451,9 @@ int USFXSeqAct_TogglePlayerSaves::eventGetObjClassVersion ( )
 
 void USFXSeqAct_TogglePlayerSaves::SetSavingPossible ( )
 {
-	static UFunction* pFnSetSavingPossible = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetSavingPossibleRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.SetSavingPossible", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetSavingPossible )
-		pFnSetSavingPossible = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.SetSavingPossible" );
+	UFunction* const pFnSetSavingPossible = pFnSetSavingPossibleRef.Get ( );
 
 	USFXSeqAct_TogglePlayerSaves_execSetSavingPossible_Parms SetSavingPossible_Parms;
 
@@ -514,10 +466,9 @@ void USFXSeqAct_TogglePlayerSaves::SetSavingPossible ( )
 
 void USFXSeqAct_TogglePlayerSaves::LogFlags ( )
 {
-	static UFunction* pFnLogFlags = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnLogFlagsRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.LogFlags", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnLogFlags )
-		pFnLogFlags = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.LogFlags" );
+	UFunction* const pFnLogFlags = pFnLogFlagsRef.Get ( );
 
 	USFXSeqAct_TogglePlayerSaves_execLogFlags_Parms LogFlags_Parms;
 
@@ -530,10 +481,9 @@ void USFXSeqAct_TogglePlayerSaves::LogFlags ( )
 
 void USFXSeqAct_TogglePlayerSaves::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_TogglePlayerSaves_execActivated_Parms Activated_Parms;
 
@@ -548,10 +498,9 @@ void USFXSeqAct_TogglePlayerSaves::Activated ( )
 
 bool USFXSeqAct_TogglePlayerSaves::GetReason ( unsigned char SetReason )
 {
-	static UFunction* pFnGetReason = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetReasonRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.GetReason", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetReason )
-		pFnGetReason = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.GetReason" );
+	UFunction* const pFnGetReason = pFnGetReasonRef.Get ( );
 
 	USFXSeqAct_TogglePlayerSaves_execGetReason_Parms GetReason_Parms;
 	GetReason_Parms.SetReason = SetReason;
@@ -569,10 +518,9 @@ bool USFXSeqAct_TogglePlayerSaves::GetReason ( unsigned char SetReason )
 
 void USFXSeqAct_TogglePlayerSaves::SetReason ( unsigned char SetReason, unsigned long bDisableSaves )
 {
-	static UFunction* pFnSetReason = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetReasonRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.SetReason", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetReason )
-		pFnSetReason = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.SetReason" );
+	UFunction* const pFnSetReason = pFnSetReasonRef.Get ( );
 
 	USFXSeqAct_TogglePlayerSaves_execSetReason_Parms SetReason_Parms;
 	SetReason_Parms.SetReason = SetReason;
@@ -589,10 +537,9 @@ void USFXSeqAct_TogglePlayerSaves::SetReason ( unsigned char SetReason, unsigned
 
 int USFXSeqAct_TogglePlayerSaves::GetPlotID ( int ReasonID )
 {
-	static UFunction* pFnGetPlotID = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetPlotIDRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.GetPlotID", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetPlotID )
-		pFnGetPlotID = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.GetPlotID" );
+	UFunction* const pFnGetPlotID = pFnGetPlotIDRef.Get ( );
 
 	USFXSeqAct_TogglePlayerSaves_execGetPlotID_Parms GetPlotID_Parms;
 	GetPlotID_Parms.ReasonID = ReasonID;
@@ -604,14 +551,11 @@ int USFXSeqAct_TogglePlayerSaves::GetPlotID ( int ReasonID )
 
 
 
-class UClass* USFXSeqCond_CanSpendTallentPoints::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqCond_CanSpendTallentPoints::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqCond_CanSpendTallentPoints", &UObject::FindClass };
 
 class UClass* USFXSeqCond_CanSpendTallentPoints::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqCond_CanSpendTallentPoints" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqCond_CanSpendTallentPoints.CanSpendTallentPoints
@@ -621,10 +565,9 @@ class UClass* USFXSeqCond_CanSpendTallentPoints::StaticClass()
 
 bool USFXSeqCond_CanSpendTallentPoints::CanSpendTallentPoints ( )
 {
-	static UFunction* pFnCanSpendTallentPoints = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanSpendTallentPointsRef { L"Function SFXGameContentLiveKismet.SFXSeqCond_CanSpendTallentPoints.CanSpendTallentPoints", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanSpendTallentPoints )
-		pFnCanSpendTallentPoints = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqCond_CanSpendTallentPoints.CanSpendTallentPoints" );
+	UFunction* const pFnCanSpendTallentPoints = pFnCanSpendTallentPointsRef.Get ( );
 
 	USFXSeqCond_CanSpendTallentPoints_execCanSpendTallentPoints_Parms CanSpendTallentPoints_Parms;
 
@@ -639,10 +582,9 @@ bool USFXSeqCond_CanSpendTallentPoints::CanSpendTallentPoints ( )
 
 void USFXSeqCond_CanSpendTallentPoints::eventDeactivated ( )
 {
-	static UFunction* pFnDeactivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDeactivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqCond_CanSpendTallentPoints.Deactivated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDeactivated )
-		pFnDeactivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqCond_CanSpendTallentPoints.Deactivated" );
+	UFunction* const pFnDeactivated = pFnDeactivatedRef.Get ( );
 
 	USFXSeqCond_CanSpendTallentPoints_eventDeactivated_Parms Deactivated_Parms;
 
@@ -655,10 +597,9 @@ void USFXSeqCond_CanSpendTallentPoints::eventDeactivated ( )
 
 void USFXSeqCond_CanSpendTallentPoints::eventActivated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqCond_CanSpendTallentPoints.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqCond_CanSpendTallentPoints.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqCond_CanSpendTallentPoints_eventActivated_Parms Activated_Parms;
 
@@ -667,14 +608,11 @@ void USFXSeqCond_CanSpendTallentPoints::eventActivated ( )
 
 
 
-class UClass* USFXSeqAct_ToggleHelmet::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_ToggleHelmet::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqAct_ToggleHelmet", &UObject::FindClass };
 
 class UClass* USFXSeqAct_ToggleHelmet::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqAct_ToggleHelmet" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqAct_ToggleHelmet.PreVersionUpdated
@@ -685,10 +623,9 @@ class UClass* USFXSeqAct_ToggleHelmet::StaticClass()
 
 void USFXSeqAct_ToggleHelmet::eventPreVersionUpdated ( int OldVersion, int NewVersion )
 {
-	static UFunction* pFnPreVersionUpdated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPreVersionUpdatedRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_ToggleHelmet.PreVersionUpdated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPreVersionUpdated )
-		pFnPreVersionUpdated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_ToggleHelmet.PreVersionUpdated" );
+	UFunction* const pFnPreVersionUpdated = pFnPreVersionUpdatedRef.Get ( );
 
 	USFXSeqAct_ToggleHelmet_eventPreVersionUpdated_Parms PreVersionUpdated_Parms;
 	PreVersionUpdated_Parms.OldVersion = OldVersion;
@@ -704,10 +641,9 @@ void USFXSeqAct_ToggleHelmet::eventPreVersionUpdated ( int OldVersion, int NewVe
 
 int USFXSeqAct_ToggleHelmet::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_ToggleHelmet.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_ToggleHelmet.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USFXSeqAct_ToggleHelmet_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -722,10 +658,9 @@ int USFXSeqAct_ToggleHelmet::eventGetObjClassVersion ( )
 
 void USFXSeqAct_ToggleHelmet::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_ToggleHelmet.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_ToggleHelmet.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_ToggleHelmet_execActivated_Parms Activated_Parms;
 
@@ -734,14 +669,11 @@ void USFXSeqAct_ToggleHelmet::Activated ( )
 
 
 
-class UClass* UBioSeqAct_GetMembersOfSquad::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_GetMembersOfSquad::pClassPointer { L"Class SFXGameContentLiveKismet.BioSeqAct_GetMembersOfSquad", &UObject::FindClass };
 
 class UClass* UBioSeqAct_GetMembersOfSquad::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.BioSeqAct_GetMembersOfSquad" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.BioSeqAct_GetMembersOfSquad.GetObjClassVersion
@@ -751,10 +683,9 @@ class UClass* UBioSeqAct_GetMembersOfSquad::StaticClass()
 
 int UBioSeqAct_GetMembersOfSquad::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContentLiveKismet.BioSeqAct_GetMembersOfSquad.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.BioSeqAct_GetMembersOfSquad.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	UBioSeqAct_GetMembersOfSquad_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -769,10 +700,9 @@ int UBioSeqAct_GetMembersOfSquad::eventGetObjClassVersion ( )
 
 void UBioSeqAct_GetMembersOfSquad::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.BioSeqAct_GetMembersOfSquad.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.BioSeqAct_GetMembersOfSquad.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	UBioSeqAct_GetMembersOfSquad_execActivated_Parms Activated_Parms;
 
@@ -786,10 +716,9 @@ void UBioSeqAct_GetMembersOfSquad::Activated ( )
 
 class APawn* UBioSeqAct_GetMembersOfSquad::FindAPawn ( )
 {
-	static UFunction* pFnFindAPawn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFindAPawnRef { L"Function SFXGameContentLiveKismet.BioSeqAct_GetMembersOfSquad.FindAPawn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFindAPawn )
-		pFnFindAPawn = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.BioSeqAct_GetMembersOfSquad.FindAPawn" );
+	UFunction* const pFnFindAPawn = pFnFindAPawnRef.Get ( );
 
 	UBioSeqAct_GetMembersOfSquad_execFindAPawn_Parms FindAPawn_Parms;
 
@@ -800,14 +729,11 @@ class APawn* UBioSeqAct_GetMembersOfSquad::FindAPawn ( )
 
 
 
-class UClass* USFXSeqAct_GetMapName::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_GetMapName::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqAct_GetMapName", &UObject::FindClass };
 
 class UClass* USFXSeqAct_GetMapName::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqAct_GetMapName" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqAct_GetMapName.Activated
@@ -816,10 +742,9 @@ class UClass* USFXSeqAct_GetMapName::StaticClass()
 
 void USFXSeqAct_GetMapName::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_GetMapName.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_GetMapName.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_GetMapName_execActivated_Parms Activated_Parms;
 
@@ -828,14 +753,11 @@ void USFXSeqAct_GetMapName::Activated ( )
 
 
 
-class UClass* USFXSeqCond_CombatArea::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqCond_CombatArea::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqCond_CombatArea", &UObject::FindClass };
 
 class UClass* USFXSeqCond_CombatArea::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqCond_CombatArea" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqCond_CombatArea.Activated
@@ -844,10 +766,9 @@ class UClass* USFXSeqCond_CombatArea::StaticClass()
 
 void USFXSeqCond_CombatArea::eventActivated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqCond_CombatArea.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqCond_CombatArea.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqCond_CombatArea_eventActivated_Parms Activated_Parms;
 
@@ -856,14 +777,11 @@ void USFXSeqCond_CombatArea::eventActivated ( )
 
 
 
-class UClass* UBioSeqAct_CancelHint::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_CancelHint::pClassPointer { L"Class SFXGameContentLiveKismet.BioSeqAct_CancelHint", &UObject::FindClass };
 
 class UClass* UBioSeqAct_CancelHint::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.BioSeqAct_CancelHint" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.BioSeqAct_CancelHint.Activated
@@ -872,10 +790,9 @@ class UClass* UBioSeqAct_CancelHint::StaticClass()
 
 void UBioSeqAct_CancelHint::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.BioSeqAct_CancelHint.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.BioSeqAct_CancelHint.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	UBioSeqAct_CancelHint_execActivated_Parms Activated_Parms;
 
@@ -884,14 +801,11 @@ void UBioSeqAct_CancelHint::Activated ( )
 
 
 
-class UClass* UBioSeqAct_CheckIfInVolume::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_CheckIfInVolume::pClassPointer { L"Class SFXGameContentLiveKismet.BioSeqAct_CheckIfInVolume", &UObject::FindClass };
 
 class UClass* UBioSeqAct_CheckIfInVolume::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.BioSeqAct_CheckIfInVolume" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.BioSeqAct_CheckIfInVolume.GetObjClassVersion
@@ -901,10 +815,9 @@ class UClass* UBioSeqAct_CheckIfInVolume::StaticClass()
 
 int UBioSeqAct_CheckIfInVolume::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContentLiveKismet.BioSeqAct_CheckIfInVolume.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.BioSeqAct_CheckIfInVolume.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	UBioSeqAct_CheckIfInVolume_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -919,10 +832,9 @@ int UBioSeqAct_CheckIfInVolume::eventGetObjClassVersion ( )
 
 void UBioSeqAct_CheckIfInVolume::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.BioSeqAct_CheckIfInVolume.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.BioSeqAct_CheckIfInVolume.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	UBioSeqAct_CheckIfInVolume_execActivated_Parms Activated_Parms;
 
@@ -931,14 +843,11 @@ void UBioSeqAct_CheckIfInVolume::Activated ( )
 
 
 
-class UClass* UBioSeqAct_ShowHint::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UBioSeqAct_ShowHint::pClassPointer { L"Class SFXGameContentLiveKismet.BioSeqAct_ShowHint", &UObject::FindClass };
 
 class UClass* UBioSeqAct_ShowHint::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.BioSeqAct_ShowHint" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.BioSeqAct_ShowHint.GetObjClassVersion
@@ -948,10 +857,9 @@ class UClass* UBioSeqAct_ShowHint::StaticClass()
 
 int UBioSeqAct_ShowHint::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContentLiveKismet.BioSeqAct_ShowHint.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.BioSeqAct_ShowHint.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	UBioSeqAct_ShowHint_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -966,10 +874,9 @@ int UBioSeqAct_ShowHint::eventGetObjClassVersion ( )
 
 void UBioSeqAct_ShowHint::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.BioSeqAct_ShowHint.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.BioSeqAct_ShowHint.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	UBioSeqAct_ShowHint_execActivated_Parms Activated_Parms;
 
@@ -978,14 +885,11 @@ void UBioSeqAct_ShowHint::Activated ( )
 
 
 
-class UClass* USFXSeqAct_AddPawnToPerception::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_AddPawnToPerception::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqAct_AddPawnToPerception", &UObject::FindClass };
 
 class UClass* USFXSeqAct_AddPawnToPerception::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqAct_AddPawnToPerception" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqAct_AddPawnToPerception.GetObjClassVersion
@@ -995,10 +899,9 @@ class UClass* USFXSeqAct_AddPawnToPerception::StaticClass()
 
 int USFXSeqAct_AddPawnToPerception::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_AddPawnToPerception.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_AddPawnToPerception.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USFXSeqAct_AddPawnToPerception_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -1013,10 +916,9 @@ int USFXSeqAct_AddPawnToPerception::eventGetObjClassVersion ( )
 
 void USFXSeqAct_AddPawnToPerception::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_AddPawnToPerception.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_AddPawnToPerception.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_AddPawnToPerception_execActivated_Parms Activated_Parms;
 
@@ -1025,14 +927,11 @@ void USFXSeqAct_AddPawnToPerception::Activated ( )
 
 
 
-class UClass* USFXSeqAct_CompareAliveSquadMembers::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_CompareAliveSquadMembers::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqAct_CompareAliveSquadMembers", &UObject::FindClass };
 
 class UClass* USFXSeqAct_CompareAliveSquadMembers::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqAct_CompareAliveSquadMembers" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqAct_CompareAliveSquadMembers.Activated
@@ -1041,10 +940,9 @@ class UClass* USFXSeqAct_CompareAliveSquadMembers::StaticClass()
 
 void USFXSeqAct_CompareAliveSquadMembers::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_CompareAliveSquadMembers.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_CompareAliveSquadMembers.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_CompareAliveSquadMembers_execActivated_Parms Activated_Parms;
 
@@ -1053,14 +951,11 @@ void USFXSeqAct_CompareAliveSquadMembers::Activated ( )
 
 
 
-class UClass* USFXSeqAct_ForcePlayerIntoCover::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_ForcePlayerIntoCover::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqAct_ForcePlayerIntoCover", &UObject::FindClass };
 
 class UClass* USFXSeqAct_ForcePlayerIntoCover::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqAct_ForcePlayerIntoCover" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqAct_ForcePlayerIntoCover.Activated
@@ -1069,10 +964,9 @@ class UClass* USFXSeqAct_ForcePlayerIntoCover::StaticClass()
 
 void USFXSeqAct_ForcePlayerIntoCover::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_ForcePlayerIntoCover.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_ForcePlayerIntoCover.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_ForcePlayerIntoCover_execActivated_Parms Activated_Parms;
 
@@ -1081,14 +975,11 @@ void USFXSeqAct_ForcePlayerIntoCover::Activated ( )
 
 
 
-class UClass* USFXSeqAct_SetMusicID::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_SetMusicID::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqAct_SetMusicID", &UObject::FindClass };
 
 class UClass* USFXSeqAct_SetMusicID::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqAct_SetMusicID" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqAct_SetMusicID.Activated
@@ -1097,10 +988,9 @@ class UClass* USFXSeqAct_SetMusicID::StaticClass()
 
 void USFXSeqAct_SetMusicID::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqAct_SetMusicID.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqAct_SetMusicID.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_SetMusicID_execActivated_Parms Activated_Parms;
 
@@ -1109,14 +999,11 @@ void USFXSeqAct_SetMusicID::Activated ( )
 
 
 
-class UClass* USFXSeqCond_HasWeaponClass::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqCond_HasWeaponClass::pClassPointer { L"Class SFXGameContentLiveKismet.SFXSeqCond_HasWeaponClass", &UObject::FindClass };
 
 class UClass* USFXSeqCond_HasWeaponClass::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContentLiveKismet.SFXSeqCond_HasWeaponClass" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContentLiveKismet.SFXSeqCond_HasWeaponClass.Activated
@@ -1125,10 +1012,9 @@ class UClass* USFXSeqCond_HasWeaponClass::StaticClass()
 
 void USFXSeqCond_HasWeaponClass::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContentLiveKismet.SFXSeqCond_HasWeaponClass.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqCond_HasWeaponClass.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqCond_HasWeaponClass_execActivated_Parms Activated_Parms;
 
@@ -1143,10 +1029,9 @@ void USFXSeqCond_HasWeaponClass::Activated ( )
 
 bool USFXSeqCond_HasWeaponClass::GetIsWeaponOfRequestedClass ( class ASFXWeapon* WeaponToCheck )
 {
-	static UFunction* pFnGetIsWeaponOfRequestedClass = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetIsWeaponOfRequestedClassRef { L"Function SFXGameContentLiveKismet.SFXSeqCond_HasWeaponClass.GetIsWeaponOfRequestedClass", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetIsWeaponOfRequestedClass )
-		pFnGetIsWeaponOfRequestedClass = UObject::FindObject< UFunction > ( L"Function SFXGameContentLiveKismet.SFXSeqCond_HasWeaponClass.GetIsWeaponOfRequestedClass" );
+	UFunction* const pFnGetIsWeaponOfRequestedClass = pFnGetIsWeaponOfRequestedClassRef.Get ( );
 
 	USFXSeqCond_HasWeaponClass_execGetIsWeaponOfRequestedClass_Parms GetIsWeaponOfRequestedClass_Parms;
 	GetIsWeaponOfRequestedClass_Parms.WeaponToCheck = WeaponToCheck;
@@ -1158,6 +1043,91 @@ bool USFXSeqCond_HasWeaponClass::GetIsWeaponOfRequestedClass ( class ASFXWeapon*
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameContentLiveKismet.BioSeqAct_GiveMissionXP",
+	L"Function SFXGameContentLiveKismet.BioSeqAct_GiveMissionXP.GetObjClassVersion",
+	L"Class SFXGameContentLiveKismet.SFXSeqAct_ClearAreaMap",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_ClearAreaMap.GetObjClassVersion",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_ClearAreaMap.Activated",
+	L"Class SFXGameContentLiveKismet.SFXSeqAct_GetHenchmenInSquad",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_GetHenchmenInSquad.Activated",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_GetHenchmenInSquad.GetPriority",
+	L"Class SFXGameContentLiveKismet.SFXSeqAct_GetTag",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_GetTag.Activated",
+	L"Class SFXGameContentLiveKismet.sfxseqact_leavemission",
+	L"Function SFXGameContentLiveKismet.sfxseqact_leavemission.GrantAutomaticGawAssets",
+	L"Function SFXGameContentLiveKismet.sfxseqact_leavemission.Activated",
+	L"Function SFXGameContentLiveKismet.sfxseqact_leavemission.getWorld",
+	L"Class SFXGameContentLiveKismet.SFXSeqAct_SaveGame",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.GetObjClassVersion",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.BeginSave",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.Deactivated",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.Update",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.Activated",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.GetBioPlayerController",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_SaveGame.CanSave",
+	L"Class SFXGameContentLiveKismet.SFXSeqAct_SetTag",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_SetTag.Activated",
+	L"Class SFXGameContentLiveKismet.SFXSeqAct_SetWasInSquad",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_SetWasInSquad.Activated",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_SetWasInSquad.getWorld",
+	L"Class SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.GetObjClassVersion",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.SetSavingPossible",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.LogFlags",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.Activated",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.GetReason",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.SetReason",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_TogglePlayerSaves.GetPlotID",
+	L"Class SFXGameContentLiveKismet.SFXSeqCond_CanSpendTallentPoints",
+	L"Function SFXGameContentLiveKismet.SFXSeqCond_CanSpendTallentPoints.CanSpendTallentPoints",
+	L"Function SFXGameContentLiveKismet.SFXSeqCond_CanSpendTallentPoints.Deactivated",
+	L"Function SFXGameContentLiveKismet.SFXSeqCond_CanSpendTallentPoints.Activated",
+	L"Class SFXGameContentLiveKismet.SFXSeqAct_ToggleHelmet",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_ToggleHelmet.PreVersionUpdated",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_ToggleHelmet.GetObjClassVersion",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_ToggleHelmet.Activated",
+	L"Class SFXGameContentLiveKismet.BioSeqAct_GetMembersOfSquad",
+	L"Function SFXGameContentLiveKismet.BioSeqAct_GetMembersOfSquad.GetObjClassVersion",
+	L"Function SFXGameContentLiveKismet.BioSeqAct_GetMembersOfSquad.Activated",
+	L"Function SFXGameContentLiveKismet.BioSeqAct_GetMembersOfSquad.FindAPawn",
+	L"Class SFXGameContentLiveKismet.SFXSeqAct_GetMapName",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_GetMapName.Activated",
+	L"Class SFXGameContentLiveKismet.SFXSeqCond_CombatArea",
+	L"Function SFXGameContentLiveKismet.SFXSeqCond_CombatArea.Activated",
+	L"Class SFXGameContentLiveKismet.BioSeqAct_CancelHint",
+	L"Function SFXGameContentLiveKismet.BioSeqAct_CancelHint.Activated",
+	L"Class SFXGameContentLiveKismet.BioSeqAct_CheckIfInVolume",
+	L"Function SFXGameContentLiveKismet.BioSeqAct_CheckIfInVolume.GetObjClassVersion",
+	L"Function SFXGameContentLiveKismet.BioSeqAct_CheckIfInVolume.Activated",
+	L"Class SFXGameContentLiveKismet.BioSeqAct_ShowHint",
+	L"Function SFXGameContentLiveKismet.BioSeqAct_ShowHint.GetObjClassVersion",
+	L"Function SFXGameContentLiveKismet.BioSeqAct_ShowHint.Activated",
+	L"Class SFXGameContentLiveKismet.SFXSeqAct_AddPawnToPerception",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_AddPawnToPerception.GetObjClassVersion",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_AddPawnToPerception.Activated",
+	L"Class SFXGameContentLiveKismet.SFXSeqAct_CompareAliveSquadMembers",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_CompareAliveSquadMembers.Activated",
+	L"Class SFXGameContentLiveKismet.SFXSeqAct_ForcePlayerIntoCover",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_ForcePlayerIntoCover.Activated",
+	L"Class SFXGameContentLiveKismet.SFXSeqAct_SetMusicID",
+	L"Function SFXGameContentLiveKismet.SFXSeqAct_SetMusicID.Activated",
+	L"Class SFXGameContentLiveKismet.SFXSeqCond_HasWeaponClass",
+	L"Function SFXGameContentLiveKismet.SFXSeqCond_HasWeaponClass.Activated",
+	L"Function SFXGameContentLiveKismet.SFXSeqCond_HasWeaponClass.GetIsWeaponOfRequestedClass",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
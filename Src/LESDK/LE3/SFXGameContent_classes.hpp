@@ -57,7 +57,7 @@ class ASFXVocalizationManagerSP : public ASFXVocalizationManager
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -71,7 +71,7 @@ class ASFXGRISP : public ASFXGRI
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -85,7 +85,7 @@ class ASFXGameInfoSP : public ASFXGame
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -105,7 +105,7 @@ class USFXDamageType_AssaultRifle : public USFXDamageType_Weapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -119,7 +119,7 @@ class USFXDamageType_HeavyPistol : public USFXDamageType_Weapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -133,7 +133,7 @@ class USFXDamageType_MattockAssaultRifle : public USFXDamageType_Weapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -150,7 +150,7 @@ public:
 	class UGFxValue*                                   m_oReticleBG;                                     		// 0x00C8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -169,7 +169,7 @@ class USFXSeqAct_GiveStartingConsumables : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -188,7 +188,7 @@ public:
 	unsigned long                                      bIsFinished : 1;                                  		// 0x011C (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -205,7 +205,7 @@ class ASFXShield_Energy_Player : public ASFXShield_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -219,7 +219,7 @@ class ASFXWeapon_AssaultRifle_Avenger : public ASFXWeapon_AssaultRifle_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -233,7 +233,7 @@ class ASFXWeapon_AssaultRifle_Mattock : public ASFXWeapon_AssaultRifle_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -258,7 +258,7 @@ public:
 	unsigned long                                      bIsFiring : 1;                                    		// 0x1104 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -298,7 +298,7 @@ public:
 	unsigned long                                      bFireSoundPlaying : 1;                            		// 0x1140 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -319,7 +319,7 @@ class ASFXWeapon_Pistol_Predator : public ASFXWeapon_Pistol_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -334,7 +334,7 @@ class USFXTreasureDataLive : public USFXTreasureData
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -348,7 +348,7 @@ class USFXCharacterClass_Content : public USFXCharacterClass
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -364,7 +364,7 @@ public:
 	unsigned long                                      bSuccessRevive : 1;                               		// 0x0148 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -390,7 +390,7 @@ public:
 	float                                              fAnimBlendOutTime;                                		// 0x0124 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -408,7 +408,7 @@ public:
 	class USFXAnimSetCookSpec*                         AnimInfo;                                         		// 0x0140 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -430,7 +430,7 @@ public:
 	struct FBodyStance                                 BS_Mid_Cov_Left_End;                              		// 0x01D8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -455,7 +455,7 @@ public:
 	struct FBodyStance                                 BS_Mid_Cov_Left_End;                              		// 0x01D8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -480,7 +480,7 @@ public:
 	struct FBodyStance                                 BS_Std_Cov_Left_End;                              		// 0x01D8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -505,7 +505,7 @@ public:
 	struct FBodyStance                                 BS_Mid_Cov_Left_End;                              		// 0x01D8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -530,7 +530,7 @@ public:
 	struct FBodyStance                                 BS_Std_Cov_Left_End;                              		// 0x01D8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -563,7 +563,7 @@ public:
 	unsigned char                                      RootBoneZ;                                        		// 0x0157 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -588,7 +588,7 @@ class USFXCustomAction_StandingGapJump : public USFXCustomAction_GapJump
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -602,7 +602,7 @@ class USFXCustomAction_JumpDown : public USFXCustomAction_BoostDownBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -629,7 +629,7 @@ public:
 	unsigned long                                      bStartFromStorm : 1;                              		// 0x05C4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -669,7 +669,7 @@ public:
 	unsigned char                                      MovePhysics;                                      		// 0x0151 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -701,7 +701,7 @@ public:
 	unsigned long                                      bStartInCover : 1;                                		// 0x017C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -723,7 +723,7 @@ class USFXCustomAction_PlayerCoverSlipLeft : public USFXCustomAction_CoverSlipBa
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -739,7 +739,7 @@ class USFXCustomAction_PlayerCoverSlipLeftStanding : public USFXCustomAction_Cov
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -755,7 +755,7 @@ class USFXCustomAction_PlayerCoverSlipRight : public USFXCustomAction_CoverSlipB
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -771,7 +771,7 @@ class USFXCustomAction_PlayerCoverSlipRightStanding : public USFXCustomAction_Co
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -793,7 +793,7 @@ public:
 	float                                              JumpStartDistance;                                		// 0x01E8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -817,7 +817,7 @@ class USFXCustomAction_PlayerLadderClimbDown : public USFXCustomAction_LadderCli
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -833,7 +833,7 @@ public:
 	float                                              MoveDist;                                         		// 0x0140 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -851,7 +851,7 @@ public:
 	float                                              MoveDist;                                         		// 0x0140 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -871,7 +871,7 @@ public:
 	unsigned long                                      bHitWallEnabled : 1;                              		// 0x0150 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -895,7 +895,7 @@ public:
 	float                                              MoveDist;                                         		// 0x0140 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -915,7 +915,7 @@ public:
 	TArray<class AActor*>                              HitActors;                                        		// 0x0250 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -940,7 +940,7 @@ public:
 	unsigned long                                      bMirroredAttack : 1;                              		// 0x0208 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -966,7 +966,7 @@ public:
 	struct FBodyStance                                 BS_AnimPistol;                                    		// 0x0250 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -985,7 +985,7 @@ class USFXCustomAction_CoverMeleeRight : public USFXCustomAction_PlayerMeleeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1002,7 +1002,7 @@ class USFXCustomAction_CoverMeleeLeft : public USFXCustomAction_CoverMeleeRight
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1017,7 +1017,7 @@ class USFXCustomAction_StdCoverMeleeLeft : public USFXCustomAction_CoverMeleeLef
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1031,7 +1031,7 @@ class USFXCustomAction_StdCoverMeleeRight : public USFXCustomAction_CoverMeleeRi
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1045,7 +1045,7 @@ class USFXCustomAction_HvyCoverMeleeRight : public USFXCustomAction_PlayerMeleeB
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1062,7 +1062,7 @@ class USFXCustomAction_HvyCoverMeleeLeft : public USFXCustomAction_HvyCoverMelee
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1077,7 +1077,7 @@ class USFXCustomAction_HvyStdCoverMeleeLeft : public USFXCustomAction_HvyCoverMe
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1091,7 +1091,7 @@ class USFXCustomAction_HvyStdCoverMeleeRight : public USFXCustomAction_HvyCoverM
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1106,7 +1106,7 @@ public:
 	float                                              BladeImpactScale;                                 		// 0x0250 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1130,7 +1130,7 @@ class USFXCustomAction_RifleMeleeTwo : public USFXCustomAction_RifleMeleeOne
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1149,7 +1149,7 @@ class USFXCustomAction_RifleMeleeThree : public USFXCustomAction_RifleMeleeTwo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1168,7 +1168,7 @@ class USFXCustomAction_PistolMeleeOne : public USFXCustomAction_PlayerMeleeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1192,7 +1192,7 @@ class USFXCustomAction_PistolMeleeTwo : public USFXCustomAction_PistolMeleeOne
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1211,7 +1211,7 @@ class USFXCustomAction_PistolMeleeThree : public USFXCustomAction_PistolMeleeTwo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1230,7 +1230,7 @@ class USFXCustomAction_PlayerStandardImpact : public USFXCustomAction_DamageReac
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1244,7 +1244,7 @@ class USFXCustomAction_PlayerStandardImpactForward : public USFXCustomAction_Dam
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1258,7 +1258,7 @@ class USFXCustomAction_PlayerStandardImpactLeft : public USFXCustomAction_Damage
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1272,7 +1272,7 @@ class USFXCustomAction_PlayerStandardImpactRight : public USFXCustomAction_Damag
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1286,7 +1286,7 @@ class USFXCustomAction_PlayerMeleed : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1300,7 +1300,7 @@ class USFXCustomAction_KnockbackImpactForward : public USFXCustomAction_DamageRe
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1314,7 +1314,7 @@ class USFXCustomAction_MeleedLeft : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1328,7 +1328,7 @@ class USFXCustomAction_MeleedRight : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1342,7 +1342,7 @@ class USFXCustomAction_KnockbackImpact : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1356,7 +1356,7 @@ class USFXCustomAction_KnockbackImpactLeft : public USFXCustomAction_DamageReact
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1370,7 +1370,7 @@ class USFXCustomAction_KnockbackImpactRight : public USFXCustomAction_DamageReac
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1384,7 +1384,7 @@ class USFXCustomAction_MeleedForward : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1415,7 +1415,7 @@ public:
 	unsigned char                                      CoverAction;                                      		// 0x0209 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1437,7 +1437,7 @@ class USFXCustomAction_FlinchLight : public USFXCustomAction_FlinchBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1451,7 +1451,7 @@ class USFXCustomAction_FlinchHeavy : public USFXCustomAction_FlinchBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1465,7 +1465,7 @@ class USFXCustomAction_PlayerOnFire : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1479,7 +1479,7 @@ class USFXCharacterClass_Adept : public USFXCharacterClass_Content
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1511,7 +1511,7 @@ public:
 	int                                                NumTargetsHit;                                    		// 0x0948 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1537,7 +1537,7 @@ public:
 	int                                                srNoGrenades;                                     		// 0x07C4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1579,7 +1579,7 @@ public:
 	int                                                Rank2GrenadeUpgrade;                              		// 0x0838 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1613,7 +1613,7 @@ public:
 	unsigned long                                      bSecondProjectile : 1;                            		// 0x0808 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1635,7 +1635,7 @@ public:
 	float                                              Evolve_BioticComboMult;                           		// 0x081C (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1665,7 +1665,7 @@ public:
 	float                                              MinimumVelocityForceMult;                         		// 0x0874 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1701,7 +1701,7 @@ public:
 	float                                              Evolve_PowerSpreeDuration;                        		// 0x0A28 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1737,7 +1737,7 @@ public:
 	float                                              InstantDamagePercent;                             		// 0x0880 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1798,7 +1798,7 @@ public:
 	unsigned long                                      Patch4IterationApplied : 1;                       		// 0x0A04 (0x0004) [0x0000000000004000] [0x00000002] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1852,7 +1852,7 @@ public:
 	float                                              Evolve_WeightCapacityBonus;                       		// 0x0888 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1876,7 +1876,7 @@ public:
 	float                                              SuperMedigelChance;                               		// 0x0800 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1897,7 +1897,7 @@ class USFXCustomAction_AdeptPunch : public USFXCustomAction_PlayerHeavyMeleeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1913,7 +1913,7 @@ class USFXCustomAction_AdeptSyncCoverGrab : public USFXCustomAction_SyncCoverGra
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1927,7 +1927,7 @@ class USFXDamageType_AdeptHeavyMelee : public USFXDamageType_HeavyMelee
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1941,7 +1941,7 @@ class USFXSeqEvt_PerformedMeleeOverCover : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1955,7 +1955,7 @@ class USFXCustomAction_Meleed : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1969,7 +1969,7 @@ class USFXGameEffect_DisableAI : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1985,7 +1985,7 @@ class USFXCustomAction_PlayerKnockbackImpact : public USFXCustomAction_DamageRea
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -1999,7 +1999,7 @@ class USFXCustomAction_PlayerStaggerImpact : public USFXCustomAction_DamageReact
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2013,7 +2013,7 @@ class USFXDamageType_AdeptHeavyMelee_NoRagdoll : public USFXDamageType_AdeptHeav
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2027,7 +2027,7 @@ class USFXDamageType_BioticExplosion : public USFXDamageType_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2041,7 +2041,7 @@ class USFXDamageType_BioticExplosion_NoRagdoll : public USFXDamageType_BioticExp
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2055,7 +2055,7 @@ class USFXDamageType_BioticGrenade : public USFXDamageType_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2069,7 +2069,7 @@ class USFXDamageType_BioticGrenade_NoRagdoll : public USFXDamageType_BioticGrena
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2083,7 +2083,7 @@ class USFXDamageType_CryoExplosion : public USFXDamageType_Power_Freeze
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2097,7 +2097,7 @@ class USFXDamageType_ElectricCombo : public USFXDamageType_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2111,7 +2111,7 @@ class USFXDamageType_FireExplosion : public USFXDamageType_Power_Fire
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2125,7 +2125,7 @@ class USFXDamageType_Warp : public USFXDamageType_Power_Fire
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2139,7 +2139,7 @@ class USFXDamageType_ImprovedWarp : public USFXDamageType_Warp
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2153,7 +2153,7 @@ class USFXDamageType_WarpDoT : public USFXDamageType_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2167,7 +2167,7 @@ class USFXDamageType_ImprovedWarpDoT : public USFXDamageType_WarpDoT
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2181,7 +2181,7 @@ class USFXDamageType_Pull : public USFXDamageType_Power_Ragdoll
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2195,7 +2195,7 @@ class USFXDamageType_Pull_DoT : public USFXDamageType_Pull
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2209,7 +2209,7 @@ class USFXDamageType_Shockwave : public USFXDamageType_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2223,7 +2223,7 @@ class USFXDamageType_Shockwave_NoRagdoll : public USFXDamageType_Shockwave
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2237,7 +2237,7 @@ class USFXDamageType_Singularity : public USFXDamageType_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2251,7 +2251,7 @@ class USFXDamageType_Singularity_DoT : public USFXDamageType_Singularity
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2265,7 +2265,7 @@ class USFXDamageType_Singularity_Explosion : public USFXDamageType_Singularity
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2279,7 +2279,7 @@ class USFXDamageType_Singularity_NoRagdoll : public USFXDamageType_Singularity
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2293,7 +2293,7 @@ class USFXDamageType_Throw : public USFXDamageType_Power_Ragdoll
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2307,7 +2307,7 @@ class USFXGameEffect_AntiGravity : public USFXGameEffect_PhysicsPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2323,7 +2323,7 @@ class USFXGameEffect_ArmorWeakness : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2339,7 +2339,7 @@ class USFXGameEffect_BioticPowerDamageTakenBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2367,7 +2367,7 @@ public:
 	unsigned long                                      bPlayFrozenDeathSound : 1;                        		// 0x0114 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2385,7 +2385,7 @@ class USFXGameEffect_DamageImmunity : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2411,7 +2411,7 @@ public:
 	unsigned long                                      bOwnerDied : 1;                                   		// 0x00E4 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2433,7 +2433,7 @@ public:
 	float                                              SpeedReduction;                                   		// 0x015C (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2456,7 +2456,7 @@ public:
 	unsigned long                                      bBeamActive : 1;                                  		// 0x00C8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2480,7 +2480,7 @@ public:
 	unsigned long                                      bCanTriggerAchievement : 1;                       		// 0x00B0 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2503,7 +2503,7 @@ public:
 	unsigned long                                      bHideBodyOnDetonation : 1;                        		// 0x0168 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2519,7 +2519,7 @@ class USFXGameEffect_HealShieldOverTime : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2534,7 +2534,7 @@ class USFXGameEffect_MaxGrenadeBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2550,7 +2550,7 @@ class USFXGameEffect_PowerCombo_Biotic : public USFXGameEffect_PowerCombo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2565,7 +2565,7 @@ class USFXShake_Power_BioticCombo : public USFXShake_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2579,7 +2579,7 @@ class USFXRumble_Power_BioticCombo : public USFXRumble_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2593,7 +2593,7 @@ class USFXShake_Power_CryoCombo : public USFXShake_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2607,7 +2607,7 @@ class USFXRumble_Power_CryoCombo : public USFXRumble_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2622,7 +2622,7 @@ public:
 	float                                              BeamDuration;                                     		// 0x0148 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2637,7 +2637,7 @@ class USFXShake_Power_ElectricCombo : public USFXShake_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2651,7 +2651,7 @@ class USFXRumble_Power_ElectricCombo : public USFXRumble_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2665,7 +2665,7 @@ class USFXShake_Power_FireCombo : public USFXShake_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2679,7 +2679,7 @@ class USFXRumble_Power_FireCombo : public USFXRumble_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2704,7 +2704,7 @@ public:
 	float                                              TargetExtraDamage;                                		// 0x00D8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2722,7 +2722,7 @@ class USFXGameEffect_Ragdoll : public USFXGameEffect_PhysicsPower
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2740,7 +2740,7 @@ public:
 	float                                              ForceDrag;                                        		// 0x0098 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2770,7 +2770,7 @@ public:
 	unsigned long                                      bApplied : 1;                                     		// 0x00D8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2801,7 +2801,7 @@ public:
 	unsigned long                                      bWasDisabled : 1;                                 		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2846,7 +2846,7 @@ public:
 	unsigned char                                      ClientNoCooldown;                                 		// 0x0914 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2881,7 +2881,7 @@ class USFXGameEffect_WeaponDamageTakenBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2897,7 +2897,7 @@ class USFXGameEffect_WeightCapacity : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2915,7 +2915,7 @@ public:
 	unsigned long                                      bReplicatedIsDeactivated : 1;                     		// 0x0318 (0x0004) [0x0000000100000020] [0x00000002] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2938,7 +2938,7 @@ class USFXSeqEvt_PlaceableReset : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2952,7 +2952,7 @@ class USFXSeqEvt_PlaceableDestroyed : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2966,7 +2966,7 @@ class USFXSeqEvt_PlaceableDeactivated : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2980,7 +2980,7 @@ class USFXSeqEvt_PlaceableActivated : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -2994,7 +2994,7 @@ class ASFXProjectile_PowerCustomAction_BioticGrenade : public ASFXProjectile_Pow
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3008,7 +3008,7 @@ class USFXRumble_Power_FragGrenade : public USFXRumble_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3022,7 +3022,7 @@ class USFXShake_Power_FragGrenade : public USFXShake_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3048,7 +3048,7 @@ public:
 	unsigned char                                      SeekAimNode;                                      		// 0x0604 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3081,7 +3081,7 @@ public:
 	float                                              OffsetAimMinDistance;                             		// 0x0628 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3104,7 +3104,7 @@ public:
 	int                                                NumShockwaves;                                    		// 0x05EC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3123,7 +3123,7 @@ class USFXRumble_Power_HeavyImpact : public USFXRumble_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3137,7 +3137,7 @@ class USFXShake_Power_Shockwave : public USFXShake_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3151,7 +3151,7 @@ class USFXShake_Power_HeavyImpact : public USFXShake_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3165,7 +3165,7 @@ class ASFXShield_Biotic_Player : public ASFXShield_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3179,7 +3179,7 @@ class USFXGameEffect_ConstraintDmgBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3195,7 +3195,7 @@ class USFXGameEffect_HealthPercentBonus : public USFXGameEffect_HealthBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3209,7 +3209,7 @@ class USFXGameEffect_MeleeDamageBonus : public USFXGameEffect_PowerBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3223,7 +3223,7 @@ class USFXGameEffect_PartBasedArmor_HealthBonus : public USFXGameEffect_HealthPe
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3237,7 +3237,7 @@ class USFXGameEffect_PowerBonus_Cooldown : public USFXGameEffect_PowerBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3251,7 +3251,7 @@ class USFXGameEffect_PowerBonus_Damage : public USFXGameEffect_PowerBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3265,7 +3265,7 @@ class USFXGameEffect_ShieldPercentBonus : public USFXGameEffect_ShieldBonus
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3280,7 +3280,7 @@ public:
 	int                                                AmmoIncrease;                                     		// 0x0094 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3296,7 +3296,7 @@ class USFXDamageType_SniperRifle : public USFXDamageType_Weapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3315,7 +3315,7 @@ public:
 	class UGFxValue*                                   m_oAmmoText;                                      		// 0x00E0 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3335,7 +3335,7 @@ class ASFXWeapon_SniperRifle_Mantis : public ASFXWeapon_SniperRifle_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3349,7 +3349,7 @@ class USFXDamageType_AutoPistol : public USFXDamageType_Weapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3363,7 +3363,7 @@ class ASFXWeapon_SMG_Shuriken : public ASFXWeapon_SMG_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3379,7 +3379,7 @@ public:
 	class AActor*                                      oTarget;                                          		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3403,7 +3403,7 @@ public:
 	unsigned char                                      MarkerType;                                       		// 0x012C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3419,7 +3419,7 @@ class USFXSeqAct_ToggleTutorialTracking : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3434,7 +3434,7 @@ class ABioPlaypenVolumeAdditive : public ABioPlaypenVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3455,7 +3455,7 @@ public:
 	unsigned long                                      bThrowGrenade : 1;                                		// 0x08B0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3473,7 +3473,7 @@ class USFXAICmd_Base_Cover : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3493,7 +3493,7 @@ class USFXAICmd_Base_Trooper : public USFXAICmd_Base_Cover
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3507,7 +3507,7 @@ class USFXAICmd_Reaction_ShotInCover : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3524,7 +3524,7 @@ public:
 	unsigned long                                      bAmmoMeshVisible : 1;                             		// 0x02B0 (0x0004) [0x0000000100000020] [0x00000002] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3543,7 +3543,7 @@ class USFXCustomAction_AILadderClimbDown : public USFXCustomAction_LadderClimbDo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3558,7 +3558,7 @@ public:
 	class UAnimSet*                                    LadderAnimSet;                                    		// 0x01B8 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3574,7 +3574,7 @@ class USFXCustomAction_AIMantleOverCover : public USFXCustomAction_MantleOverCov
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3591,7 +3591,7 @@ public:
 	unsigned long                                      bStartInCover : 1;                                		// 0x0174 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3608,7 +3608,7 @@ class USFXCustomAction_AISwatTurnLeft : public USFXCustomAction_SwatTurn
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3622,7 +3622,7 @@ class USFXCustomAction_AISwatTurnRight : public USFXCustomAction_SwatTurn
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3636,7 +3636,7 @@ class USFXCustomAction_AnimRagdollSingularity : public USFXCustomAction_Animated
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3654,7 +3654,7 @@ public:
 	class UWwiseEvent*                                 StopRocketEffect;                                 		// 0x01C4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3675,7 +3675,7 @@ public:
 	class UWwiseEvent*                                 StopRocketEffect;                                 		// 0x01E0 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3696,7 +3696,7 @@ public:
 	float                                              RightForce;                                       		// 0x00A4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3713,7 +3713,7 @@ class USFXCustomAction_CoverSlipLeft : public USFXCustomAction_CoverSlipBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3727,7 +3727,7 @@ class USFXCustomAction_CoverSlipLeftStanding : public USFXCustomAction_CoverSlip
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3741,7 +3741,7 @@ class USFXCustomAction_CoverSlipRight : public USFXCustomAction_CoverSlipBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3755,7 +3755,7 @@ class USFXCustomAction_CoverSlipRightStanding : public USFXCustomAction_CoverSli
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3774,7 +3774,7 @@ public:
 	unsigned long                                      bPlayDeathImpact : 1;                             		// 0x017C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3791,7 +3791,7 @@ class USFXCustomAction_DeathReaction_Corkscrew : public USFXCustomAction_DeathRe
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3805,7 +3805,7 @@ class USFXCustomAction_DeathReaction_GibHeadshot : public USFXCustomAction_Death
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3821,7 +3821,7 @@ class USFXCustomAction_DeathReaction_GibKnockback : public USFXCustomAction_Deat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3838,7 +3838,7 @@ class USFXCustomAction_DeathReaction_Headshot_Cover : public USFXCustomAction_Da
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3853,7 +3853,7 @@ class USFXCustomAction_DeathReaction_HeavyLeftArm : public USFXCustomAction_Deat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3867,7 +3867,7 @@ class USFXCustomAction_DeathReaction_HeavyRightArm : public USFXCustomAction_Dea
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3881,7 +3881,7 @@ class USFXCustomAction_DeathReaction_LeftArm : public USFXCustomAction_DeathReac
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3895,7 +3895,7 @@ class USFXCustomAction_DeathReaction_LeftLeg : public USFXCustomAction_DeathReac
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3909,7 +3909,7 @@ class USFXCustomAction_DeathReaction_RightArm : public USFXCustomAction_DeathRea
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3923,7 +3923,7 @@ class USFXCustomAction_DeathReaction_RightLeg : public USFXCustomAction_DeathRea
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3937,7 +3937,7 @@ class USFXCustomAction_DeathReaction_Stomach : public USFXCustomAction_DeathReac
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3951,7 +3951,7 @@ class USFXCustomAction_Freezing : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3965,7 +3965,7 @@ class USFXCustomAction_FreezingII : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3979,7 +3979,7 @@ class USFXCustomAction_FreezingIII : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -3993,7 +3993,7 @@ class USFXCustomAction_GreatPain : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4007,7 +4007,7 @@ class USFXCustomAction_GreatPainII : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4021,7 +4021,7 @@ class USFXCustomAction_IdleInspectWeapon : public USFXCustomAction_LoopingIntera
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4035,7 +4035,7 @@ class USFXCustomAction_IdleListening : public USFXCustomAction_LoopingInteractio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4049,7 +4049,7 @@ class USFXCustomAction_IdleListening2 : public USFXCustomAction_LoopingInteracti
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4063,7 +4063,7 @@ class USFXCustomAction_IdleListening3 : public USFXCustomAction_LoopingInteracti
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4077,7 +4077,7 @@ class USFXCustomAction_IdleStandGuard : public USFXCustomAction_LoopingInteracti
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4091,7 +4091,7 @@ class USFXCustomAction_IdleTalking : public USFXCustomAction_LoopingInteraction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4105,7 +4105,7 @@ class USFXCustomAction_IdleTalking2 : public USFXCustomAction_LoopingInteraction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4119,7 +4119,7 @@ class USFXCustomAction_IdleTalking3 : public USFXCustomAction_LoopingInteraction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4133,7 +4133,7 @@ class USFXCustomAction_IdleUseConsole : public USFXCustomAction_LoopingInteracti
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4147,7 +4147,7 @@ class USFXCustomAction_OnFire : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4161,7 +4161,7 @@ class USFXCustomAction_OnFireII : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4175,7 +4175,7 @@ class USFXCustomAction_RollBackward : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4189,7 +4189,7 @@ class USFXCustomAction_RollForward : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4203,7 +4203,7 @@ class USFXCustomAction_RollLeft : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4217,7 +4217,7 @@ class USFXCustomAction_RollRight : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4234,7 +4234,7 @@ public:
 	unsigned char                                      VocEvents[ 0x3 ];                                 		// 0x0190 (0x0003) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4251,7 +4251,7 @@ class USFXCustomAction_StaggerImpact : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4265,7 +4265,7 @@ class USFXCustomAction_StaggerImpactForward : public USFXCustomAction_DamageReac
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4279,7 +4279,7 @@ class USFXCustomAction_StaggerImpactII : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4293,7 +4293,7 @@ class USFXCustomAction_StaggerImpactLeft : public USFXCustomAction_DamageReactio
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4307,7 +4307,7 @@ class USFXCustomAction_StaggerImpactRight : public USFXCustomAction_DamageReacti
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4321,7 +4321,7 @@ class USFXCustomAction_StandardImpact : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4335,7 +4335,7 @@ class USFXCustomAction_StandardImpactForward : public USFXCustomAction_DamageRea
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4349,7 +4349,7 @@ class USFXCustomAction_StandardImpactII : public USFXCustomAction_DamageReaction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4363,7 +4363,7 @@ class USFXCustomAction_StandardImpactKnee : public USFXCustomAction_DamageReacti
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4377,7 +4377,7 @@ class USFXCustomAction_StandardImpactLeft : public USFXCustomAction_DamageReacti
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4391,7 +4391,7 @@ class USFXCustomAction_StandardImpactRight : public USFXCustomAction_DamageReact
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4405,7 +4405,7 @@ class USFXCustomAction_TrooperMelee : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4420,7 +4420,7 @@ class USFXCustomAction_TrooperStomp : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4436,7 +4436,7 @@ class USFXDamageType_EnemyGrenade : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4450,7 +4450,7 @@ class USFXDamageType_SMG_Tempest : public USFXDamageType_AutoPistol
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4464,7 +4464,7 @@ class USFXDamageType_TacticalMachinePistol : public USFXDamageType_SMG_Tempest
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4478,7 +4478,7 @@ class ASFXNav_InteractionHenchOmniToolCrouch : public ASFXNav_InteractionPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4492,7 +4492,7 @@ class ASFXNav_InteractionInspectWeapon : public ASFXNav_InteractionPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4506,7 +4506,7 @@ class ASFXNav_InteractionStandGuard : public ASFXNav_InteractionPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4520,7 +4520,7 @@ class ASFXPawn_Trooper : public ASFXPawn
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4534,7 +4534,7 @@ class USFXPowerCustomAction_EnemyGrenade : public USFXPowerCustomAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4549,7 +4549,7 @@ class USFXPowerCustomAction_CerberusGrenade : public USFXPowerCustomAction_Enemy
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4563,7 +4563,7 @@ class ASFXProjectile_PowerCustomAction_CerberusFragGrenade : public ASFXProjecti
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4577,7 +4577,7 @@ class USFXRumble_MeleeHit : public UWaveFormBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4591,7 +4591,7 @@ class USFXShake_MeleeHit : public USFXCameraShakeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4605,7 +4605,7 @@ class ASFXWeapon_SMG_Hornet : public ASFXWeapon_SMG_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4620,7 +4620,7 @@ class ASFXWeapon_AI_Hornet : public ASFXWeapon_SMG_Hornet
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4634,7 +4634,7 @@ class USFXCustomAction_CustomLoopingInteraction : public USFXCustomAction_Loopin
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4652,7 +4652,7 @@ public:
 	struct SFXName                                     EndAnim;                                          		// 0x039C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4666,7 +4666,7 @@ class USFXCustomAction_HenchBeckonFront : public USFXCustomAction_LoopingInterac
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4681,7 +4681,7 @@ class USFXCustomAction_HenchBeckonRear : public USFXCustomAction_LoopingInteract
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4696,7 +4696,7 @@ class USFXCustomAction_HenchCrouch : public USFXCustomAction_InteractionPointAni
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4715,7 +4715,7 @@ public:
 	class URvrClientEffectInterface*                   OmniToolVFX;                                      		// 0x018C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4746,7 +4746,7 @@ public:
 	unsigned char                                      MeleeStage;                                       		// 0x01A4 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4770,7 +4770,7 @@ public:
 	class URvrClientEffectInterface*                   OmniToolVFX;                                      		// 0x018C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4789,7 +4789,7 @@ public:
 	class URvrClientEffectInterface*                   OmniToolVFX;                                      		// 0x018C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4806,7 +4806,7 @@ class USFXCustomAction_HenchRollBackward : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4821,7 +4821,7 @@ class USFXCustomAction_HenchRollForward : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4836,7 +4836,7 @@ class USFXCustomAction_HenchRollLeft : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4851,7 +4851,7 @@ class USFXCustomAction_HenchRollRight : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4866,7 +4866,7 @@ class USFXCustomAction_HenchStandIdle : public USFXCustomAction_InteractionPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4882,7 +4882,7 @@ class USFXCustomAction_HenchStandTyping : public USFXCustomAction_LoopingInterac
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4897,7 +4897,7 @@ class USFXDamageType_BarrierBlast : public USFXDamageType_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4911,7 +4911,7 @@ class USFXDamageType_BarrierBlast_NoRagdoll : public USFXDamageType_BarrierBlast
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4925,7 +4925,7 @@ class USFXDamageType_CryoFreeze : public USFXDamageType_Power_Freeze
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4939,7 +4939,7 @@ class USFXDamageType_OverloadRobot : public USFXDamageType_Power_Electrocute
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4953,7 +4953,7 @@ class USFXDamageType_Overload : public USFXDamageType_OverloadRobot
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4967,7 +4967,7 @@ class USFXDamageType_ImprovedOverload : public USFXDamageType_Overload
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4981,7 +4981,7 @@ class USFXDamageType_ImprovedOverloadRobot : public USFXDamageType_OverloadRobot
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -4995,7 +4995,7 @@ class USFXDamageType_Overload_Ragdoll : public USFXDamageType_Overload
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5009,7 +5009,7 @@ class USFXDamageType_Reave : public USFXDamageType_Power_Fire
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5023,7 +5023,7 @@ class USFXDamageType_Reave_Improved : public USFXDamageType_Reave
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5041,7 +5041,7 @@ public:
 	float                                              MinimumVelocity;                                  		// 0x00AC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5062,7 +5062,7 @@ public:
 	unsigned long                                      bArmorVFXOn : 1;                                  		// 0x00B4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5085,7 +5085,7 @@ public:
 	unsigned long                                      bRemoveArmorApplyCooldown : 1;                    		// 0x0834 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5111,7 +5111,7 @@ class USFXGameEffect_HenchmanArmorBonus_PowerCooldownBonus : public USFXGameEffe
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5125,7 +5125,7 @@ class USFXGameEffect_HenchmanArmorBonus_PowerDamageBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5169,7 +5169,7 @@ public:
 	unsigned long                                      bBeamActive : 1;                                  		// 0x014C (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5204,7 +5204,7 @@ public:
 	float                                              DamageLossPerHit;                                 		// 0x0864 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5230,7 +5230,7 @@ class USFXGameEffect_Reave : public USFXGameEffect_DamageOverTime
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5244,7 +5244,7 @@ class ASFXPawn_Kaidan : public ASFXPawn_Henchman
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5277,7 +5277,7 @@ public:
 	float                                              Evolve_ArmorBarrierBonus;                         		// 0x0864 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5316,7 +5316,7 @@ public:
 	float                                              TimeDilationMax;                                  		// 0x08CC (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5360,7 +5360,7 @@ public:
 	float                                              PostBlastEndAnimDelay;                            		// 0x0970 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5389,7 +5389,7 @@ public:
 	struct FPowerData                                  PowerCooldownBonus;                               		// 0x0860 (0x0034) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5411,7 +5411,7 @@ public:
 	float                                              Evolve_SquadShieldRechargeBonus;                  		// 0x08A8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5429,7 +5429,7 @@ class ASFXShield_Energy : public ASFXShield_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5443,7 +5443,7 @@ class USFXCustomAction_HenchmanHeavyMelee : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5457,7 +5457,7 @@ class USFXDamageType_Carnage : public USFXDamageType_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5471,7 +5471,7 @@ class USFXDamageType_Carnage_DoT : public USFXDamageType_Carnage
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5485,7 +5485,7 @@ class USFXDamageType_Carnage_Improved : public USFXDamageType_Carnage
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5499,7 +5499,7 @@ class USFXDamageType_Carnage_Improved_DoT : public USFXDamageType_Carnage_Improv
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5513,7 +5513,7 @@ class USFXDamageType_Carnage_Ragdoll : public USFXDamageType_Power_Ragdoll
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5527,7 +5527,7 @@ class USFXDamageType_Carnage_Ragdoll_DoT : public USFXDamageType_Carnage_Ragdoll
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5541,7 +5541,7 @@ class USFXDamageType_Carnage_Ragdoll_Improved : public USFXDamageType_Carnage_Ra
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5555,7 +5555,7 @@ class USFXDamageType_Carnage_Ragdoll_Improved_DoT : public USFXDamageType_Carnag
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5569,7 +5569,7 @@ class USFXDamageType_ConcussiveShot : public USFXDamageType_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5583,7 +5583,7 @@ class USFXDamageType_ConcussiveShot_Incendiary : public USFXDamageType_Concussiv
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5597,7 +5597,7 @@ class USFXDamageType_FragGrenade : public USFXDamageType_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5611,7 +5611,7 @@ class USFXDamageType_FragGrenade_Armor : public USFXDamageType_FragGrenade
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5625,7 +5625,7 @@ class USFXDamageType_FragGrenade_Shields : public USFXDamageType_FragGrenade
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5639,7 +5639,7 @@ class USFXDamageType_IncendiaryAmmo : public USFXDamageType_Power_Fire
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5653,7 +5653,7 @@ class USFXDamageType_IncendiaryAmmoImproved : public USFXDamageType_IncendiaryAm
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5677,7 +5677,7 @@ public:
 	unsigned long                                      bInCinematic : 1;                                 		// 0x00D0 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5723,7 +5723,7 @@ public:
 	unsigned long                                      bModifyMuzzle : 1;                                		// 0x0848 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5756,7 +5756,7 @@ class USFXGameEffect_FireDeath : public USFXGameEffect_DeathEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5770,7 +5770,7 @@ class USFXGameEffect_HenchmanArmorBonus_HealthBonus : public USFXGameEffect_Heal
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5784,7 +5784,7 @@ class USFXGameEffect_HenchmanArmorBonus_ShieldBonus : public USFXGameEffect_Shie
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5809,7 +5809,7 @@ public:
 	unsigned long                                      bAreaExplosion : 1;                               		// 0x0108 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5842,7 +5842,7 @@ public:
 	float                                              DoTDamage;                                        		// 0x0928 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5881,7 +5881,7 @@ public:
 	unsigned long                                      bModifyImpactVFX : 1;                             		// 0x00BC (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5897,7 +5897,7 @@ class ASFXPawn_Marine : public ASFXPawn_Henchman
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5921,7 +5921,7 @@ public:
 	int                                                Rank2GrenadeUpgrade;                              		// 0x0820 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5957,7 +5957,7 @@ public:
 	float                                              DoTDuration;                                      		// 0x0804 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5990,7 +5990,7 @@ public:
 	float                                              Evolve_EncumbranceBonus;                          		// 0x08B4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6017,7 +6017,7 @@ public:
 	float                                              Evolve_MeleeDamageBonus;                          		// 0x08AC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6035,7 +6035,7 @@ class ASFXProjectile_PowerCustomAction_Carnage : public ASFXProjectile_PowerCust
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6049,7 +6049,7 @@ class ASFXProjectile_PowerCustomAction_FragGrenade : public ASFXProjectile_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6063,7 +6063,7 @@ class USFXDamageType_Shotgun : public USFXDamageType_Weapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6082,7 +6082,7 @@ public:
 	float                                              RadiusModifier;                                   		// 0x00D4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6102,7 +6102,7 @@ class ASFXWeapon_Shotgun_Katana : public ASFXWeapon_Shotgun_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28,38 +28,29 @@
 
 
 
-class UClass* ASFXVocalizationManagerSP::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXVocalizationManagerSP::pClassPointer { L"Class SFXGameContent.SFXVocalizationManagerSP", &UObject::FindClass };
 
 class UClass* ASFXVocalizationManagerSP::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXVocalizationManagerSP" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXGRISP::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXGRISP::pClassPointer { L"Class SFXGameContent.SFXGRISP", &UObject::FindClass };
 
 class UClass* ASFXGRISP::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGRISP" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXGameInfoSP::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXGameInfoSP::pClassPointer { L"Class SFXGameContent.SFXGameInfoSP", &UObject::FindClass };
 
 class UClass* ASFXGameInfoSP::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameInfoSP" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameInfoSP.AwardItem
@@ -71,10 +62,9 @@ class UClass* ASFXGameInfoSP::StaticClass()
 
 bool ASFXGameInfoSP::AwardItem ( struct SFXName ItemName, FString const& Level )
 {
-	static UFunction* pFnAwardItem = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAwardItemRef { L"Function SFXGameContent.SFXGameInfoSP.AwardItem", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAwardItem )
-		pFnAwardItem = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameInfoSP.AwardItem" );
+	UFunction* const pFnAwardItem = pFnAwardItemRef.Get ( );
 
 	ASFXGameInfoSP_execAwardItem_Parms AwardItem_Parms;
 	memcpy ( &AwardItem_Parms.ItemName, &ItemName, 0x8 );
@@ -95,10 +85,9 @@ bool ASFXGameInfoSP::AwardItem ( struct SFXName ItemName, FString const& Level )
 
 bool ASFXGameInfoSP::AwardCredits ( int Amount, FString const& Level, unsigned long bShowNotification )
 {
-	static UFunction* pFnAwardCredits = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAwardCreditsRef { L"Function SFXGameContent.SFXGameInfoSP.AwardCredits", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAwardCredits )
-		pFnAwardCredits = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameInfoSP.AwardCredits" );
+	UFunction* const pFnAwardCredits = pFnAwardCreditsRef.Get ( );
 
 	ASFXGameInfoSP_execAwardCredits_Parms AwardCredits_Parms;
 	AwardCredits_Parms.Amount = Amount;
@@ -120,10 +109,9 @@ bool ASFXGameInfoSP::AwardCredits ( int Amount, FString const& Level, unsigned l
 
 bool ASFXGameInfoSP::AwardCreditPercent ( float fAmount, FString const& Level, unsigned long bShowNotifications )
 {
-	static UFunction* pFnAwardCreditPercent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAwardCreditPercentRef { L"Function SFXGameContent.SFXGameInfoSP.AwardCreditPercent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAwardCreditPercent )
-		pFnAwardCreditPercent = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameInfoSP.AwardCreditPercent" );
+	UFunction* const pFnAwardCreditPercent = pFnAwardCreditPercentRef.Get ( );
 
 	ASFXGameInfoSP_execAwardCreditPercent_Parms AwardCreditPercent_Parms;
 	AwardCreditPercent_Parms.fAmount = fAmount;
@@ -145,10 +133,9 @@ bool ASFXGameInfoSP::AwardCreditPercent ( float fAmount, FString const& Level, u
 
 bool ASFXGameInfoSP::AwardXP ( int Amount, FString const& Level, unsigned long bShowNotifications )
 {
-	static UFunction* pFnAwardXP = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAwardXPRef { L"Function SFXGameContent.SFXGameInfoSP.AwardXP", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAwardXP )
-		pFnAwardXP = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameInfoSP.AwardXP" );
+	UFunction* const pFnAwardXP = pFnAwardXPRef.Get ( );
 
 	ASFXGameInfoSP_execAwardXP_Parms AwardXP_Parms;
 	AwardXP_Parms.Amount = Amount;
@@ -170,10 +157,9 @@ bool ASFXGameInfoSP::AwardXP ( int Amount, FString const& Level, unsigned long b
 
 class ANavigationPoint* ASFXGameInfoSP::FindPlayerStart ( class AController* Player, unsigned char InTeam, FString const& IncomingName )
 {
-	static UFunction* pFnFindPlayerStart = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFindPlayerStartRef { L"Function SFXGameContent.SFXGameInfoSP.FindPlayerStart", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFindPlayerStart )
-		pFnFindPlayerStart = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameInfoSP.FindPlayerStart" );
+	UFunction* const pFnFindPlayerStart = pFnFindPlayerStartRef.Get ( );
 
 	ASFXGameInfoSP_execFindPlayerStart_Parms FindPlayerStart_Parms;
 	FindPlayerStart_Parms.Player = Player;
@@ -191,10 +177,9 @@ class ANavigationPoint* ASFXGameInfoSP::FindPlayerStart ( class AController* Pla
 
 void ASFXGameInfoSP::eventPostBeginPlay ( )
 {
-	static UFunction* pFnPostBeginPlay = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPostBeginPlayRef { L"Function SFXGameContent.SFXGameInfoSP.PostBeginPlay", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPostBeginPlay )
-		pFnPostBeginPlay = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameInfoSP.PostBeginPlay" );
+	UFunction* const pFnPostBeginPlay = pFnPostBeginPlayRef.Get ( );
 
 	ASFXGameInfoSP_eventPostBeginPlay_Parms PostBeginPlay_Parms;
 
@@ -203,50 +188,38 @@ void ASFXGameInfoSP::eventPostBeginPlay ( )
 
 
 
-class UClass* USFXDamageType_AssaultRifle::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_AssaultRifle::pClassPointer { L"Class SFXGameContent.SFXDamageType_AssaultRifle", &UObject::FindClass };
 
 class UClass* USFXDamageType_AssaultRifle::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_AssaultRifle" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_HeavyPistol::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_HeavyPistol::pClassPointer { L"Class SFXGameContent.SFXDamageType_HeavyPistol", &UObject::FindClass };
 
 class UClass* USFXDamageType_HeavyPistol::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_HeavyPistol" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_MattockAssaultRifle::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_MattockAssaultRifle::pClassPointer { L"Class SFXGameContent.SFXDamageType_MattockAssaultRifle", &UObject::FindClass };
 
 class UClass* USFXDamageType_MattockAssaultRifle::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_MattockAssaultRifle" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGUI_HeavyWeaponReticle::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGUI_HeavyWeaponReticle::pClassPointer { L"Class SFXGameContent.SFXGUI_HeavyWeaponReticle", &UObject::FindClass };
 
 class UClass* USFXGUI_HeavyWeaponReticle::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGUI_HeavyWeaponReticle" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGUI_HeavyWeaponReticle.TargetCanHitChanged
@@ -256,10 +229,9 @@ class UClass* USFXGUI_HeavyWeaponReticle::StaticClass()
 
 void USFXGUI_HeavyWeaponReticle::eventTargetCanHitChanged ( unsigned long bCanHit )
 {
-	static UFunction* pFnTargetCanHitChanged = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTargetCanHitChangedRef { L"Function SFXGameContent.SFXGUI_HeavyWeaponReticle.TargetCanHitChanged", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTargetCanHitChanged )
-		pFnTargetCanHitChanged = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_HeavyWeaponReticle.TargetCanHitChanged" );
+	UFunction* const pFnTargetCanHitChanged = pFnTargetCanHitChangedRef.Get ( );
 
 	USFXGUI_HeavyWeaponReticle_eventTargetCanHitChanged_Parms TargetCanHitChanged_Parms;
 	TargetCanHitChanged_Parms.bCanHit = bCanHit;
@@ -274,10 +246,9 @@ void USFXGUI_HeavyWeaponReticle::eventTargetCanHitChanged ( unsigned long bCanHi
 
 void USFXGUI_HeavyWeaponReticle::eventWeaponAmmoChanged ( int nAmmo )
 {
-	static UFunction* pFnWeaponAmmoChanged = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWeaponAmmoChangedRef { L"Function SFXGameContent.SFXGUI_HeavyWeaponReticle.WeaponAmmoChanged", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWeaponAmmoChanged )
-		pFnWeaponAmmoChanged = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_HeavyWeaponReticle.WeaponAmmoChanged" );
+	UFunction* const pFnWeaponAmmoChanged = pFnWeaponAmmoChangedRef.Get ( );
 
 	USFXGUI_HeavyWeaponReticle_eventWeaponAmmoChanged_Parms WeaponAmmoChanged_Parms;
 	WeaponAmmoChanged_Parms.nAmmo = nAmmo;
@@ -291,10 +262,9 @@ void USFXGUI_HeavyWeaponReticle::eventWeaponAmmoChanged ( int nAmmo )
 
 void USFXGUI_HeavyWeaponReticle::OnReticleLoaded ( )
 {
-	static UFunction* pFnOnReticleLoaded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReticleLoadedRef { L"Function SFXGameContent.SFXGUI_HeavyWeaponReticle.OnReticleLoaded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReticleLoaded )
-		pFnOnReticleLoaded = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_HeavyWeaponReticle.OnReticleLoaded" );
+	UFunction* const pFnOnReticleLoaded = pFnOnReticleLoadedRef.Get ( );
 
 	USFXGUI_HeavyWeaponReticle_execOnReticleLoaded_Parms OnReticleLoaded_Parms;
 
@@ -308,10 +278,9 @@ void USFXGUI_HeavyWeaponReticle::OnReticleLoaded ( )
 
 void USFXGUI_HeavyWeaponReticle::eventPerformReticleHide ( unsigned long bInstant )
 {
-	static UFunction* pFnPerformReticleHide = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPerformReticleHideRef { L"Function SFXGameContent.SFXGUI_HeavyWeaponReticle.PerformReticleHide", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPerformReticleHide )
-		pFnPerformReticleHide = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_HeavyWeaponReticle.PerformReticleHide" );
+	UFunction* const pFnPerformReticleHide = pFnPerformReticleHideRef.Get ( );
 
 	USFXGUI_HeavyWeaponReticle_eventPerformReticleHide_Parms PerformReticleHide_Parms;
 	PerformReticleHide_Parms.bInstant = bInstant;
@@ -326,10 +295,9 @@ void USFXGUI_HeavyWeaponReticle::eventPerformReticleHide ( unsigned long bInstan
 
 void USFXGUI_HeavyWeaponReticle::eventPerformReticleShow ( unsigned long bInstant )
 {
-	static UFunction* pFnPerformReticleShow = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPerformReticleShowRef { L"Function SFXGameContent.SFXGUI_HeavyWeaponReticle.PerformReticleShow", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPerformReticleShow )
-		pFnPerformReticleShow = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_HeavyWeaponReticle.PerformReticleShow" );
+	UFunction* const pFnPerformReticleShow = pFnPerformReticleShowRef.Get ( );
 
 	USFXGUI_HeavyWeaponReticle_eventPerformReticleShow_Parms PerformReticleShow_Parms;
 	PerformReticleShow_Parms.bInstant = bInstant;
@@ -339,14 +307,11 @@ void USFXGUI_HeavyWeaponReticle::eventPerformReticleShow ( unsigned long bInstan
 
 
 
-class UClass* USFXSeqAct_GiveStartingConsumables::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_GiveStartingConsumables::pClassPointer { L"Class SFXGameContent.SFXSeqAct_GiveStartingConsumables", &UObject::FindClass };
 
 class UClass* USFXSeqAct_GiveStartingConsumables::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_GiveStartingConsumables" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXSeqAct_GiveStartingConsumables.Activated
@@ -355,10 +320,9 @@ class UClass* USFXSeqAct_GiveStartingConsumables::StaticClass()
 
 void USFXSeqAct_GiveStartingConsumables::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.SFXSeqAct_GiveStartingConsumables.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_GiveStartingConsumables.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_GiveStartingConsumables_execActivated_Parms Activated_Parms;
 
@@ -367,14 +331,11 @@ void USFXSeqAct_GiveStartingConsumables::Activated ( )
 
 
 
-class UClass* USFXSeqAct_OpenWeaponSelection::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_OpenWeaponSelection::pClassPointer { L"Class SFXGameContent.SFXSeqAct_OpenWeaponSelection", &UObject::FindClass };
 
 class UClass* USFXSeqAct_OpenWeaponSelection::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_OpenWeaponSelection" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXSeqAct_OpenWeaponSelection.OnMovieClosedDelegate
@@ -385,10 +346,9 @@ class UClass* USFXSeqAct_OpenWeaponSelection::StaticClass()
 
 bool USFXSeqAct_OpenWeaponSelection::OnMovieClosedDelegate ( class USFXGUIMovie* i_ScreenToClose )
 {
-	static UFunction* pFnOnMovieClosedDelegate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnMovieClosedDelegateRef { L"Function SFXGameContent.SFXSeqAct_OpenWeaponSelection.OnMovieClosedDelegate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnMovieClosedDelegate )
-		pFnOnMovieClosedDelegate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_OpenWeaponSelection.OnMovieClosedDelegate" );
+	UFunction* const pFnOnMovieClosedDelegate = pFnOnMovieClosedDelegateRef.Get ( );
 
 	USFXSeqAct_OpenWeaponSelection_execOnMovieClosedDelegate_Parms OnMovieClosedDelegate_Parms;
 	OnMovieClosedDelegate_Parms.i_ScreenToClose = i_ScreenToClose;
@@ -406,10 +366,9 @@ bool USFXSeqAct_OpenWeaponSelection::OnMovieClosedDelegate ( class USFXGUIMovie*
 
 bool USFXSeqAct_OpenWeaponSelection::UpdateOp ( float fDeltaT )
 {
-	static UFunction* pFnUpdateOp = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdateOpRef { L"Function SFXGameContent.SFXSeqAct_OpenWeaponSelection.UpdateOp", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdateOp )
-		pFnUpdateOp = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_OpenWeaponSelection.UpdateOp" );
+	UFunction* const pFnUpdateOp = pFnUpdateOpRef.Get ( );
 
 	USFXSeqAct_OpenWeaponSelection_execUpdateOp_Parms UpdateOp_Parms;
 	UpdateOp_Parms.fDeltaT = fDeltaT;
@@ -425,10 +384,9 @@ bool USFXSeqAct_OpenWeaponSelection::UpdateOp ( float fDeltaT )
 
 void USFXSeqAct_OpenWeaponSelection::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.SFXSeqAct_OpenWeaponSelection.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_OpenWeaponSelection.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_OpenWeaponSelection_execActivated_Parms Activated_Parms;
 
@@ -437,50 +395,38 @@ void USFXSeqAct_OpenWeaponSelection::Activated ( )
 
 
 
-class UClass* ASFXShield_Energy_Player::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXShield_Energy_Player::pClassPointer { L"Class SFXGameContent.SFXShield_Energy_Player", &UObject::FindClass };
 
 class UClass* ASFXShield_Energy_Player::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXShield_Energy_Player" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXWeapon_AssaultRifle_Avenger::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_AssaultRifle_Avenger::pClassPointer { L"Class SFXGameContent.SFXWeapon_AssaultRifle_Avenger", &UObject::FindClass };
 
 class UClass* ASFXWeapon_AssaultRifle_Avenger::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXWeapon_AssaultRifle_Avenger" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXWeapon_AssaultRifle_Mattock::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_AssaultRifle_Mattock::pClassPointer { L"Class SFXGameContent.SFXWeapon_AssaultRifle_Mattock", &UObject::FindClass };
 
 class UClass* ASFXWeapon_AssaultRifle_Mattock::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXWeapon_AssaultRifle_Mattock" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXWeapon_Heavy_Beam_Base::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_Heavy_Beam_Base::pClassPointer { L"Class SFXGameContent.SFXWeapon_Heavy_Beam_Base", &UObject::FindClass };
 
 class UClass* ASFXWeapon_Heavy_Beam_Base::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXWeapon_Heavy_Beam_Base" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.GetAdjustedAim
@@ -491,10 +437,9 @@ class UClass* ASFXWeapon_Heavy_Beam_Base::StaticClass()
 
 struct FRotator ASFXWeapon_Heavy_Beam_Base::GetAdjustedAim ( struct FVector const& StartFireLoc )
 {
-	static UFunction* pFnGetAdjustedAim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAdjustedAimRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.GetAdjustedAim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAdjustedAim )
-		pFnGetAdjustedAim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.GetAdjustedAim" );
+	UFunction* const pFnGetAdjustedAim = pFnGetAdjustedAimRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execGetAdjustedAim_Parms GetAdjustedAim_Parms;
 	memcpy ( &GetAdjustedAim_Parms.StartFireLoc, &StartFireLoc, 0xC );
@@ -511,10 +456,9 @@ struct FRotator ASFXWeapon_Heavy_Beam_Base::GetAdjustedAim ( struct FVector cons
 
 void ASFXWeapon_Heavy_Beam_Base::PreCalculateAdjustedAim ( float fDeltaTime )
 {
-	static UFunction* pFnPreCalculateAdjustedAim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPreCalculateAdjustedAimRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.PreCalculateAdjustedAim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPreCalculateAdjustedAim )
-		pFnPreCalculateAdjustedAim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.PreCalculateAdjustedAim" );
+	UFunction* const pFnPreCalculateAdjustedAim = pFnPreCalculateAdjustedAimRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execPreCalculateAdjustedAim_Parms PreCalculateAdjustedAim_Parms;
 	PreCalculateAdjustedAim_Parms.fDeltaTime = fDeltaTime;
@@ -529,10 +473,9 @@ void ASFXWeapon_Heavy_Beam_Base::PreCalculateAdjustedAim ( float fDeltaTime )
 
 void ASFXWeapon_Heavy_Beam_Base::UpdateBeam ( float DeltaTime )
 {
-	static UFunction* pFnUpdateBeam = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdateBeamRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.UpdateBeam", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdateBeam )
-		pFnUpdateBeam = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.UpdateBeam" );
+	UFunction* const pFnUpdateBeam = pFnUpdateBeamRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execUpdateBeam_Parms UpdateBeam_Parms;
 	UpdateBeam_Parms.DeltaTime = DeltaTime;
@@ -549,10 +492,9 @@ void ASFXWeapon_Heavy_Beam_Base::UpdateBeam ( float DeltaTime )
 
 void ASFXWeapon_Heavy_Beam_Base::ProcessInstantHit ( unsigned char FiringMode, struct FImpactInfo const& Impact, int NumHits )
 {
-	static UFunction* pFnProcessInstantHit = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnProcessInstantHitRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.ProcessInstantHit", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnProcessInstantHit )
-		pFnProcessInstantHit = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.ProcessInstantHit" );
+	UFunction* const pFnProcessInstantHit = pFnProcessInstantHitRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execProcessInstantHit_Parms ProcessInstantHit_Parms;
 	ProcessInstantHit_Parms.FiringMode = FiringMode;
@@ -568,10 +510,9 @@ void ASFXWeapon_Heavy_Beam_Base::ProcessInstantHit ( unsigned char FiringMode, s
 
 void ASFXWeapon_Heavy_Beam_Base::CalcFireStart ( )
 {
-	static UFunction* pFnCalcFireStart = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCalcFireStartRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.CalcFireStart", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCalcFireStart )
-		pFnCalcFireStart = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.CalcFireStart" );
+	UFunction* const pFnCalcFireStart = pFnCalcFireStartRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execCalcFireStart_Parms CalcFireStart_Parms;
 
@@ -585,10 +526,9 @@ void ASFXWeapon_Heavy_Beam_Base::CalcFireStart ( )
 
 void ASFXWeapon_Heavy_Beam_Base::StopFire ( unsigned char FireModeNum )
 {
-	static UFunction* pFnStopFire = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopFireRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.StopFire", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopFire )
-		pFnStopFire = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.StopFire" );
+	UFunction* const pFnStopFire = pFnStopFireRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execStopFire_Parms StopFire_Parms;
 	StopFire_Parms.FireModeNum = FireModeNum;
@@ -603,10 +543,9 @@ void ASFXWeapon_Heavy_Beam_Base::StopFire ( unsigned char FireModeNum )
 
 void ASFXWeapon_Heavy_Beam_Base::StartFire ( unsigned char FireModeNum )
 {
-	static UFunction* pFnStartFire = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartFireRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.StartFire", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartFire )
-		pFnStartFire = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.StartFire" );
+	UFunction* const pFnStartFire = pFnStartFireRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execStartFire_Parms StartFire_Parms;
 	StartFire_Parms.FireModeNum = FireModeNum;
@@ -621,10 +560,9 @@ void ASFXWeapon_Heavy_Beam_Base::StartFire ( unsigned char FireModeNum )
 
 void ASFXWeapon_Heavy_Beam_Base::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.Tick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTick )
-		pFnTick = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.Tick" );
+	UFunction* const pFnTick = pFnTickRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -639,10 +577,9 @@ void ASFXWeapon_Heavy_Beam_Base::Tick ( float DeltaTime )
 
 void ASFXWeapon_Heavy_Beam_Base::SpawnImpactEffects ( struct FImpactInfo const& Impact )
 {
-	static UFunction* pFnSpawnImpactEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSpawnImpactEffectsRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.SpawnImpactEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSpawnImpactEffects )
-		pFnSpawnImpactEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.SpawnImpactEffects" );
+	UFunction* const pFnSpawnImpactEffects = pFnSpawnImpactEffectsRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execSpawnImpactEffects_Parms SpawnImpactEffects_Parms;
 	memcpy ( &SpawnImpactEffects_Parms.Impact, &Impact, 0x64 );
@@ -658,10 +595,9 @@ void ASFXWeapon_Heavy_Beam_Base::SpawnImpactEffects ( struct FImpactInfo const&
 
 class UWwiseEvent* ASFXWeapon_Heavy_Beam_Base::GetWeaponSpecificImpactSound ( class USFXPhysicalMaterialImpactSounds* ImpactSounds )
 {
-	static UFunction* pFnGetWeaponSpecificImpactSound = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactSoundRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.GetWeaponSpecificImpactSound", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactSound )
-		pFnGetWeaponSpecificImpactSound = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.GetWeaponSpecificImpactSound" );
+	UFunction* const pFnGetWeaponSpecificImpactSound = pFnGetWeaponSpecificImpactSoundRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execGetWeaponSpecificImpactSound_Parms GetWeaponSpecificImpactSound_Parms;
 	GetWeaponSpecificImpactSound_Parms.ImpactSounds = ImpactSounds;
@@ -679,10 +615,9 @@ class UWwiseEvent* ASFXWeapon_Heavy_Beam_Base::GetWeaponSpecificImpactSound ( cl
 
 class UParticleSystem* ASFXWeapon_Heavy_Beam_Base::GetWeaponSpecificImpactEffect ( class USFXPhysicalMaterialImpactEffects* ImpactEffects )
 {
-	static UFunction* pFnGetWeaponSpecificImpactEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactEffectRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.GetWeaponSpecificImpactEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactEffect )
-		pFnGetWeaponSpecificImpactEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.GetWeaponSpecificImpactEffect" );
+	UFunction* const pFnGetWeaponSpecificImpactEffect = pFnGetWeaponSpecificImpactEffectRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execGetWeaponSpecificImpactEffect_Parms GetWeaponSpecificImpactEffect_Parms;
 	GetWeaponSpecificImpactEffect_Parms.ImpactEffects = ImpactEffects;
@@ -701,10 +636,9 @@ class UParticleSystem* ASFXWeapon_Heavy_Beam_Base::GetWeaponSpecificImpactEffect
 
 class UDecalComponent* ASFXWeapon_Heavy_Beam_Base::GetWeaponSpecificDecalData ( class USFXPhysicalMaterialDecals* DecalEffects, float* FadeTime )
 {
-	static UFunction* pFnGetWeaponSpecificDecalData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificDecalDataRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.GetWeaponSpecificDecalData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificDecalData )
-		pFnGetWeaponSpecificDecalData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.GetWeaponSpecificDecalData" );
+	UFunction* const pFnGetWeaponSpecificDecalData = pFnGetWeaponSpecificDecalDataRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execGetWeaponSpecificDecalData_Parms GetWeaponSpecificDecalData_Parms;
 	GetWeaponSpecificDecalData_Parms.DecalEffects = DecalEffects;
@@ -726,10 +660,9 @@ class UDecalComponent* ASFXWeapon_Heavy_Beam_Base::GetWeaponSpecificDecalData (
 
 void ASFXWeapon_Heavy_Beam_Base::StopMuzzleFlashEffect ( )
 {
-	static UFunction* pFnStopMuzzleFlashEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopMuzzleFlashEffectRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.StopMuzzleFlashEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopMuzzleFlashEffect )
-		pFnStopMuzzleFlashEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.StopMuzzleFlashEffect" );
+	UFunction* const pFnStopMuzzleFlashEffect = pFnStopMuzzleFlashEffectRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execStopMuzzleFlashEffect_Parms StopMuzzleFlashEffect_Parms;
 
@@ -742,10 +675,9 @@ void ASFXWeapon_Heavy_Beam_Base::StopMuzzleFlashEffect ( )
 
 void ASFXWeapon_Heavy_Beam_Base::PlayMuzzleFlashEffect ( )
 {
-	static UFunction* pFnPlayMuzzleFlashEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayMuzzleFlashEffectRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.PlayMuzzleFlashEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayMuzzleFlashEffect )
-		pFnPlayMuzzleFlashEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.PlayMuzzleFlashEffect" );
+	UFunction* const pFnPlayMuzzleFlashEffect = pFnPlayMuzzleFlashEffectRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execPlayMuzzleFlashEffect_Parms PlayMuzzleFlashEffect_Parms;
 
@@ -759,10 +691,9 @@ void ASFXWeapon_Heavy_Beam_Base::PlayMuzzleFlashEffect ( )
 
 void ASFXWeapon_Heavy_Beam_Base::StretchDecal ( struct FImpactInfo const& Impact )
 {
-	static UFunction* pFnStretchDecal = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStretchDecalRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.StretchDecal", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStretchDecal )
-		pFnStretchDecal = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.StretchDecal" );
+	UFunction* const pFnStretchDecal = pFnStretchDecalRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execStretchDecal_Parms StretchDecal_Parms;
 	memcpy ( &StretchDecal_Parms.Impact, &Impact, 0x64 );
@@ -777,10 +708,9 @@ void ASFXWeapon_Heavy_Beam_Base::StretchDecal ( struct FImpactInfo const& Impact
 
 void ASFXWeapon_Heavy_Beam_Base::SpawnADecal ( struct FImpactInfo const& Impact )
 {
-	static UFunction* pFnSpawnADecal = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSpawnADecalRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.SpawnADecal", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSpawnADecal )
-		pFnSpawnADecal = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.SpawnADecal" );
+	UFunction* const pFnSpawnADecal = pFnSpawnADecalRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execSpawnADecal_Parms SpawnADecal_Parms;
 	memcpy ( &SpawnADecal_Parms.Impact, &Impact, 0x64 );
@@ -794,10 +724,9 @@ void ASFXWeapon_Heavy_Beam_Base::SpawnADecal ( struct FImpactInfo const& Impact
 
 void ASFXWeapon_Heavy_Beam_Base::InitDefaultDecalProperties ( )
 {
-	static UFunction* pFnInitDefaultDecalProperties = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitDefaultDecalPropertiesRef { L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.InitDefaultDecalProperties", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitDefaultDecalProperties )
-		pFnInitDefaultDecalProperties = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.InitDefaultDecalProperties" );
+	UFunction* const pFnInitDefaultDecalProperties = pFnInitDefaultDecalPropertiesRef.Get ( );
 
 	ASFXWeapon_Heavy_Beam_Base_execInitDefaultDecalProperties_Parms InitDefaultDecalProperties_Parms;
 
@@ -806,14 +735,11 @@ void ASFXWeapon_Heavy_Beam_Base::InitDefaultDecalProperties ( )
 
 
 
-class UClass* ASFXWeapon_Heavy_LegionDisinfectionWeapon::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_Heavy_LegionDisinfectionWeapon::pClassPointer { L"Class SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon", &UObject::FindClass };
 
 class UClass* ASFXWeapon_Heavy_LegionDisinfectionWeapon::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.OutOfAmmo
@@ -823,10 +749,9 @@ class UClass* ASFXWeapon_Heavy_LegionDisinfectionWeapon::StaticClass()
 
 bool ASFXWeapon_Heavy_LegionDisinfectionWeapon::OutOfAmmo ( )
 {
-	static UFunction* pFnOutOfAmmo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOutOfAmmoRef { L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.OutOfAmmo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOutOfAmmo )
-		pFnOutOfAmmo = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.OutOfAmmo" );
+	UFunction* const pFnOutOfAmmo = pFnOutOfAmmoRef.Get ( );
 
 	ASFXWeapon_Heavy_LegionDisinfectionWeapon_execOutOfAmmo_Parms OutOfAmmo_Parms;
 
@@ -841,10 +766,9 @@ bool ASFXWeapon_Heavy_LegionDisinfectionWeapon::OutOfAmmo ( )
 
 void ASFXWeapon_Heavy_LegionDisinfectionWeapon::InitDefaultDecalProperties ( )
 {
-	static UFunction* pFnInitDefaultDecalProperties = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitDefaultDecalPropertiesRef { L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.InitDefaultDecalProperties", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitDefaultDecalProperties )
-		pFnInitDefaultDecalProperties = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.InitDefaultDecalProperties" );
+	UFunction* const pFnInitDefaultDecalProperties = pFnInitDefaultDecalPropertiesRef.Get ( );
 
 	ASFXWeapon_Heavy_LegionDisinfectionWeapon_execInitDefaultDecalProperties_Parms InitDefaultDecalProperties_Parms;
 
@@ -858,10 +782,9 @@ void ASFXWeapon_Heavy_LegionDisinfectionWeapon::InitDefaultDecalProperties ( )
 
 void ASFXWeapon_Heavy_LegionDisinfectionWeapon::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickRef { L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.Tick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTick )
-		pFnTick = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.Tick" );
+	UFunction* const pFnTick = pFnTickRef.Get ( );
 
 	ASFXWeapon_Heavy_LegionDisinfectionWeapon_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -877,10 +800,9 @@ void ASFXWeapon_Heavy_LegionDisinfectionWeapon::Tick ( float DeltaTime )
 
 class UWwiseEvent* ASFXWeapon_Heavy_LegionDisinfectionWeapon::GetWeaponSpecificImpactSound ( class USFXPhysicalMaterialImpactSounds* ImpactSounds )
 {
-	static UFunction* pFnGetWeaponSpecificImpactSound = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactSoundRef { L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.GetWeaponSpecificImpactSound", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactSound )
-		pFnGetWeaponSpecificImpactSound = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.GetWeaponSpecificImpactSound" );
+	UFunction* const pFnGetWeaponSpecificImpactSound = pFnGetWeaponSpecificImpactSoundRef.Get ( );
 
 	ASFXWeapon_Heavy_LegionDisinfectionWeapon_execGetWeaponSpecificImpactSound_Parms GetWeaponSpecificImpactSound_Parms;
 	GetWeaponSpecificImpactSound_Parms.ImpactSounds = ImpactSounds;
@@ -898,10 +820,9 @@ class UWwiseEvent* ASFXWeapon_Heavy_LegionDisinfectionWeapon::GetWeaponSpecificI
 
 class UParticleSystem* ASFXWeapon_Heavy_LegionDisinfectionWeapon::GetWeaponSpecificImpactEffect ( class USFXPhysicalMaterialImpactEffects* ImpactEffects )
 {
-	static UFunction* pFnGetWeaponSpecificImpactEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactEffectRef { L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.GetWeaponSpecificImpactEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactEffect )
-		pFnGetWeaponSpecificImpactEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.GetWeaponSpecificImpactEffect" );
+	UFunction* const pFnGetWeaponSpecificImpactEffect = pFnGetWeaponSpecificImpactEffectRef.Get ( );
 
 	ASFXWeapon_Heavy_LegionDisinfectionWeapon_execGetWeaponSpecificImpactEffect_Parms GetWeaponSpecificImpactEffect_Parms;
 	GetWeaponSpecificImpactEffect_Parms.ImpactEffects = ImpactEffects;
@@ -917,10 +838,9 @@ class UParticleSystem* ASFXWeapon_Heavy_LegionDisinfectionWeapon::GetWeaponSpeci
 
 void ASFXWeapon_Heavy_LegionDisinfectionWeapon::StopMuzzleFlashEffect ( )
 {
-	static UFunction* pFnStopMuzzleFlashEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopMuzzleFlashEffectRef { L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.StopMuzzleFlashEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopMuzzleFlashEffect )
-		pFnStopMuzzleFlashEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.StopMuzzleFlashEffect" );
+	UFunction* const pFnStopMuzzleFlashEffect = pFnStopMuzzleFlashEffectRef.Get ( );
 
 	ASFXWeapon_Heavy_LegionDisinfectionWeapon_execStopMuzzleFlashEffect_Parms StopMuzzleFlashEffect_Parms;
 
@@ -933,10 +853,9 @@ void ASFXWeapon_Heavy_LegionDisinfectionWeapon::StopMuzzleFlashEffect ( )
 
 void ASFXWeapon_Heavy_LegionDisinfectionWeapon::StopFireSounds ( )
 {
-	static UFunction* pFnStopFireSounds = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopFireSoundsRef { L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.StopFireSounds", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopFireSounds )
-		pFnStopFireSounds = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.StopFireSounds" );
+	UFunction* const pFnStopFireSounds = pFnStopFireSoundsRef.Get ( );
 
 	ASFXWeapon_Heavy_LegionDisinfectionWeapon_execStopFireSounds_Parms StopFireSounds_Parms;
 
@@ -945,14 +864,11 @@ void ASFXWeapon_Heavy_LegionDisinfectionWeapon::StopFireSounds ( )
 
 
 
-class UClass* ASFXWeapon_Pistol_Predator::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_Pistol_Predator::pClassPointer { L"Class SFXGameContent.SFXWeapon_Pistol_Predator", &UObject::FindClass };
 
 class UClass* ASFXWeapon_Pistol_Predator::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXWeapon_Pistol_Predator" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXWeapon_Pistol_Predator.GetWeaponSpecificDecalData
@@ -964,10 +880,9 @@ class UClass* ASFXWeapon_Pistol_Predator::StaticClass()
 
 class UDecalComponent* ASFXWeapon_Pistol_Predator::GetWeaponSpecificDecalData ( class USFXPhysicalMaterialDecals* DecalEffects, float* FadeTime )
 {
-	static UFunction* pFnGetWeaponSpecificDecalData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificDecalDataRef { L"Function SFXGameContent.SFXWeapon_Pistol_Predator.GetWeaponSpecificDecalData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificDecalData )
-		pFnGetWeaponSpecificDecalData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_Pistol_Predator.GetWeaponSpecificDecalData" );
+	UFunction* const pFnGetWeaponSpecificDecalData = pFnGetWeaponSpecificDecalDataRef.Get ( );
 
 	ASFXWeapon_Pistol_Predator_execGetWeaponSpecificDecalData_Parms GetWeaponSpecificDecalData_Parms;
 	GetWeaponSpecificDecalData_Parms.DecalEffects = DecalEffects;
@@ -985,38 +900,29 @@ class UDecalComponent* ASFXWeapon_Pistol_Predator::GetWeaponSpecificDecalData (
 
 
 
-class UClass* USFXTreasureDataLive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXTreasureDataLive::pClassPointer { L"Class SFXGameContent.SFXTreasureDataLive", &UObject::FindClass };
 
 class UClass* USFXTreasureDataLive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXTreasureDataLive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCharacterClass_Content::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCharacterClass_Content::pClassPointer { L"Class SFXGameContent.SFXCharacterClass_Content", &UObject::FindClass };
 
 class UClass* USFXCharacterClass_Content::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCharacterClass_Content" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_Revive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_Revive::pClassPointer { L"Class SFXGameContent.SFXCustomAction_Revive", &UObject::FindClass };
 
 class UClass* USFXCustomAction_Revive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_Revive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_Revive.BodyStanceAnimEndNotification
@@ -1028,10 +934,9 @@ class UClass* USFXCustomAction_Revive::StaticClass()
 
 void USFXCustomAction_Revive::BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime )
 {
-	static UFunction* pFnBodyStanceAnimEndNotification = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBodyStanceAnimEndNotificationRef { L"Function SFXGameContent.SFXCustomAction_Revive.BodyStanceAnimEndNotification", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBodyStanceAnimEndNotification )
-		pFnBodyStanceAnimEndNotification = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_Revive.BodyStanceAnimEndNotification" );
+	UFunction* const pFnBodyStanceAnimEndNotification = pFnBodyStanceAnimEndNotificationRef.Get ( );
 
 	USFXCustomAction_Revive_execBodyStanceAnimEndNotification_Parms BodyStanceAnimEndNotification_Parms;
 	BodyStanceAnimEndNotification_Parms.SeqNode = SeqNode;
@@ -1047,10 +952,9 @@ void USFXCustomAction_Revive::BodyStanceAnimEndNotification ( class UAnimNodeSeq
 
 void USFXCustomAction_Revive::Replicate ( )
 {
-	static UFunction* pFnReplicate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReplicateRef { L"Function SFXGameContent.SFXCustomAction_Revive.Replicate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReplicate )
-		pFnReplicate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_Revive.Replicate" );
+	UFunction* const pFnReplicate = pFnReplicateRef.Get ( );
 
 	USFXCustomAction_Revive_execReplicate_Parms Replicate_Parms;
 
@@ -1064,10 +968,9 @@ void USFXCustomAction_Revive::Replicate ( )
 
 void USFXCustomAction_Revive::ClientDoCustomAction ( unsigned long bForced )
 {
-	static UFunction* pFnClientDoCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoCustomActionRef { L"Function SFXGameContent.SFXCustomAction_Revive.ClientDoCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoCustomAction )
-		pFnClientDoCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_Revive.ClientDoCustomAction" );
+	UFunction* const pFnClientDoCustomAction = pFnClientDoCustomActionRef.Get ( );
 
 	USFXCustomAction_Revive_execClientDoCustomAction_Parms ClientDoCustomAction_Parms;
 	ClientDoCustomAction_Parms.bForced = bForced;
@@ -1081,10 +984,9 @@ void USFXCustomAction_Revive::ClientDoCustomAction ( unsigned long bForced )
 
 void USFXCustomAction_Revive::CheckFiring ( )
 {
-	static UFunction* pFnCheckFiring = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCheckFiringRef { L"Function SFXGameContent.SFXCustomAction_Revive.CheckFiring", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCheckFiring )
-		pFnCheckFiring = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_Revive.CheckFiring" );
+	UFunction* const pFnCheckFiring = pFnCheckFiringRef.Get ( );
 
 	USFXCustomAction_Revive_execCheckFiring_Parms CheckFiring_Parms;
 
@@ -1098,10 +1000,9 @@ void USFXCustomAction_Revive::CheckFiring ( )
 
 void USFXCustomAction_Revive::TickCustomAction ( float DeltaTime )
 {
-	static UFunction* pFnTickCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickCustomActionRef { L"Function SFXGameContent.SFXCustomAction_Revive.TickCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTickCustomAction )
-		pFnTickCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_Revive.TickCustomAction" );
+	UFunction* const pFnTickCustomAction = pFnTickCustomActionRef.Get ( );
 
 	USFXCustomAction_Revive_execTickCustomAction_Parms TickCustomAction_Parms;
 	TickCustomAction_Parms.DeltaTime = DeltaTime;
@@ -1115,10 +1016,9 @@ void USFXCustomAction_Revive::TickCustomAction ( float DeltaTime )
 
 void USFXCustomAction_Revive::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_Revive.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_Revive.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_Revive_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -1131,10 +1031,9 @@ void USFXCustomAction_Revive::StopCustomAction ( )
 
 void USFXCustomAction_Revive::Resurrect ( )
 {
-	static UFunction* pFnResurrect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResurrectRef { L"Function SFXGameContent.SFXCustomAction_Revive.Resurrect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResurrect )
-		pFnResurrect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_Revive.Resurrect" );
+	UFunction* const pFnResurrect = pFnResurrectRef.Get ( );
 
 	USFXCustomAction_Revive_execResurrect_Parms Resurrect_Parms;
 
@@ -1147,10 +1046,9 @@ void USFXCustomAction_Revive::Resurrect ( )
 
 void USFXCustomAction_Revive::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_Revive.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_Revive.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_Revive_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -1166,10 +1064,9 @@ void USFXCustomAction_Revive::StartCustomAction ( )
 
 bool USFXCustomAction_Revive::InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced )
 {
-	static UFunction* pFnInternalCanDoCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalCanDoCustomActionRef { L"Function SFXGameContent.SFXCustomAction_Revive.InternalCanDoCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalCanDoCustomAction )
-		pFnInternalCanDoCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_Revive.InternalCanDoCustomAction" );
+	UFunction* const pFnInternalCanDoCustomAction = pFnInternalCanDoCustomActionRef.Get ( );
 
 	USFXCustomAction_Revive_execInternalCanDoCustomAction_Parms InternalCanDoCustomAction_Parms;
 	InternalCanDoCustomAction_Parms.SyncPawn = SyncPawn;
@@ -1182,14 +1079,11 @@ bool USFXCustomAction_Revive::InternalCanDoCustomAction ( class ABioPawn* SyncPa
 
 
 
-class UClass* USFXCustomAction_Reload::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_Reload::pClassPointer { L"Class SFXGameContent.SFXCustomAction_Reload", &UObject::FindClass };
 
 class UClass* USFXCustomAction_Reload::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_Reload" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_Reload.StopCustomAction
@@ -1198,10 +1092,9 @@ class UClass* USFXCustomAction_Reload::StaticClass()
 
 void USFXCustomAction_Reload::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_Reload.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_Reload.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_Reload_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -1214,10 +1107,9 @@ void USFXCustomAction_Reload::StopCustomAction ( )
 
 void USFXCustomAction_Reload::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_Reload.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_Reload.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_Reload_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -1231,10 +1123,9 @@ void USFXCustomAction_Reload::StartCustomAction ( )
 
 void USFXCustomAction_Reload::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_Reload.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_Reload.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_Reload_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -1249,14 +1140,11 @@ void USFXCustomAction_Reload::eventGetUsedAnimNames ( TArray<struct SFXName>* Us
 
 
 
-class UClass* USFXCustomAction_ActivateWeaponFlashlight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_ActivateWeaponFlashlight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_ActivateWeaponFlashlight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_ActivateWeaponFlashlight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_ActivateWeaponFlashlight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_ActivateWeaponFlashlight.StopCustomAction
@@ -1265,10 +1153,9 @@ class UClass* USFXCustomAction_ActivateWeaponFlashlight::StaticClass()
 
 void USFXCustomAction_ActivateWeaponFlashlight::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_ActivateWeaponFlashlight.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_ActivateWeaponFlashlight.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_ActivateWeaponFlashlight_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -1281,10 +1168,9 @@ void USFXCustomAction_ActivateWeaponFlashlight::StopCustomAction ( )
 
 void USFXCustomAction_ActivateWeaponFlashlight::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_ActivateWeaponFlashlight.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_ActivateWeaponFlashlight.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_ActivateWeaponFlashlight_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -1293,14 +1179,11 @@ void USFXCustomAction_ActivateWeaponFlashlight::StartCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_MantleLookAt::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_MantleLookAt::pClassPointer { L"Class SFXGameContent.SFXCustomAction_MantleLookAt", &UObject::FindClass };
 
 class UClass* USFXCustomAction_MantleLookAt::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_MantleLookAt" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_MantleLookAt.FlinchActionOverride
@@ -1309,10 +1192,9 @@ class UClass* USFXCustomAction_MantleLookAt::StaticClass()
 
 void USFXCustomAction_MantleLookAt::FlinchActionOverride ( )
 {
-	static UFunction* pFnFlinchActionOverride = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFlinchActionOverrideRef { L"Function SFXGameContent.SFXCustomAction_MantleLookAt.FlinchActionOverride", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFlinchActionOverride )
-		pFnFlinchActionOverride = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_MantleLookAt.FlinchActionOverride" );
+	UFunction* const pFnFlinchActionOverride = pFnFlinchActionOverrideRef.Get ( );
 
 	USFXCustomAction_MantleLookAt_execFlinchActionOverride_Parms FlinchActionOverride_Parms;
 
@@ -1326,10 +1208,9 @@ void USFXCustomAction_MantleLookAt::FlinchActionOverride ( )
 
 void USFXCustomAction_MantleLookAt::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_MantleLookAt.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_MantleLookAt.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_MantleLookAt_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -1349,10 +1230,9 @@ void USFXCustomAction_MantleLookAt::eventGetUsedAnimNames ( TArray<struct SFXNam
 
 struct FBodyStance USFXCustomAction_MantleLookAt::GetEndBodyStanceAnim ( )
 {
-	static UFunction* pFnGetEndBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEndBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_MantleLookAt.GetEndBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEndBodyStanceAnim )
-		pFnGetEndBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_MantleLookAt.GetEndBodyStanceAnim" );
+	UFunction* const pFnGetEndBodyStanceAnim = pFnGetEndBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_MantleLookAt_execGetEndBodyStanceAnim_Parms GetEndBodyStanceAnim_Parms;
 
@@ -1368,10 +1248,9 @@ struct FBodyStance USFXCustomAction_MantleLookAt::GetEndBodyStanceAnim ( )
 
 struct FBodyStance USFXCustomAction_MantleLookAt::GetLoopBodyStanceAnim ( )
 {
-	static UFunction* pFnGetLoopBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLoopBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_MantleLookAt.GetLoopBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLoopBodyStanceAnim )
-		pFnGetLoopBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_MantleLookAt.GetLoopBodyStanceAnim" );
+	UFunction* const pFnGetLoopBodyStanceAnim = pFnGetLoopBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_MantleLookAt_execGetLoopBodyStanceAnim_Parms GetLoopBodyStanceAnim_Parms;
 
@@ -1387,10 +1266,9 @@ struct FBodyStance USFXCustomAction_MantleLookAt::GetLoopBodyStanceAnim ( )
 
 struct FBodyStance USFXCustomAction_MantleLookAt::GetStartBodyStanceAnim ( )
 {
-	static UFunction* pFnGetStartBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetStartBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_MantleLookAt.GetStartBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetStartBodyStanceAnim )
-		pFnGetStartBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_MantleLookAt.GetStartBodyStanceAnim" );
+	UFunction* const pFnGetStartBodyStanceAnim = pFnGetStartBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_MantleLookAt_execGetStartBodyStanceAnim_Parms GetStartBodyStanceAnim_Parms;
 
@@ -1401,14 +1279,11 @@ struct FBodyStance USFXCustomAction_MantleLookAt::GetStartBodyStanceAnim ( )
 
 
 
-class UClass* USFXCustomAction_CoverSlipLookAt::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_CoverSlipLookAt::pClassPointer { L"Class SFXGameContent.SFXCustomAction_CoverSlipLookAt", &UObject::FindClass };
 
 class UClass* USFXCustomAction_CoverSlipLookAt::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_CoverSlipLookAt" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.FlinchActionOverride
@@ -1417,10 +1292,9 @@ class UClass* USFXCustomAction_CoverSlipLookAt::StaticClass()
 
 void USFXCustomAction_CoverSlipLookAt::FlinchActionOverride ( )
 {
-	static UFunction* pFnFlinchActionOverride = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFlinchActionOverrideRef { L"Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.FlinchActionOverride", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFlinchActionOverride )
-		pFnFlinchActionOverride = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.FlinchActionOverride" );
+	UFunction* const pFnFlinchActionOverride = pFnFlinchActionOverrideRef.Get ( );
 
 	USFXCustomAction_CoverSlipLookAt_execFlinchActionOverride_Parms FlinchActionOverride_Parms;
 
@@ -1434,10 +1308,9 @@ void USFXCustomAction_CoverSlipLookAt::FlinchActionOverride ( )
 
 void USFXCustomAction_CoverSlipLookAt::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_CoverSlipLookAt_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -1457,10 +1330,9 @@ void USFXCustomAction_CoverSlipLookAt::eventGetUsedAnimNames ( TArray<struct SFX
 
 struct FBodyStance USFXCustomAction_CoverSlipLookAt::GetEndBodyStanceAnim ( )
 {
-	static UFunction* pFnGetEndBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEndBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.GetEndBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEndBodyStanceAnim )
-		pFnGetEndBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.GetEndBodyStanceAnim" );
+	UFunction* const pFnGetEndBodyStanceAnim = pFnGetEndBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_CoverSlipLookAt_execGetEndBodyStanceAnim_Parms GetEndBodyStanceAnim_Parms;
 
@@ -1476,10 +1348,9 @@ struct FBodyStance USFXCustomAction_CoverSlipLookAt::GetEndBodyStanceAnim ( )
 
 struct FBodyStance USFXCustomAction_CoverSlipLookAt::GetLoopBodyStanceAnim ( )
 {
-	static UFunction* pFnGetLoopBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLoopBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.GetLoopBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLoopBodyStanceAnim )
-		pFnGetLoopBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.GetLoopBodyStanceAnim" );
+	UFunction* const pFnGetLoopBodyStanceAnim = pFnGetLoopBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_CoverSlipLookAt_execGetLoopBodyStanceAnim_Parms GetLoopBodyStanceAnim_Parms;
 
@@ -1495,10 +1366,9 @@ struct FBodyStance USFXCustomAction_CoverSlipLookAt::GetLoopBodyStanceAnim ( )
 
 struct FBodyStance USFXCustomAction_CoverSlipLookAt::GetStartBodyStanceAnim ( )
 {
-	static UFunction* pFnGetStartBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetStartBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.GetStartBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetStartBodyStanceAnim )
-		pFnGetStartBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.GetStartBodyStanceAnim" );
+	UFunction* const pFnGetStartBodyStanceAnim = pFnGetStartBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_CoverSlipLookAt_execGetStartBodyStanceAnim_Parms GetStartBodyStanceAnim_Parms;
 
@@ -1509,14 +1379,11 @@ struct FBodyStance USFXCustomAction_CoverSlipLookAt::GetStartBodyStanceAnim ( )
 
 
 
-class UClass* USFXCustomAction_StdCoverSlipLookAt::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StdCoverSlipLookAt::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StdCoverSlipLookAt", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StdCoverSlipLookAt::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StdCoverSlipLookAt" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.FlinchActionOverride
@@ -1525,10 +1392,9 @@ class UClass* USFXCustomAction_StdCoverSlipLookAt::StaticClass()
 
 void USFXCustomAction_StdCoverSlipLookAt::FlinchActionOverride ( )
 {
-	static UFunction* pFnFlinchActionOverride = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFlinchActionOverrideRef { L"Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.FlinchActionOverride", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFlinchActionOverride )
-		pFnFlinchActionOverride = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.FlinchActionOverride" );
+	UFunction* const pFnFlinchActionOverride = pFnFlinchActionOverrideRef.Get ( );
 
 	USFXCustomAction_StdCoverSlipLookAt_execFlinchActionOverride_Parms FlinchActionOverride_Parms;
 
@@ -1542,10 +1408,9 @@ void USFXCustomAction_StdCoverSlipLookAt::FlinchActionOverride ( )
 
 void USFXCustomAction_StdCoverSlipLookAt::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_StdCoverSlipLookAt_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -1565,10 +1430,9 @@ void USFXCustomAction_StdCoverSlipLookAt::eventGetUsedAnimNames ( TArray<struct
 
 struct FBodyStance USFXCustomAction_StdCoverSlipLookAt::GetEndBodyStanceAnim ( )
 {
-	static UFunction* pFnGetEndBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEndBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.GetEndBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEndBodyStanceAnim )
-		pFnGetEndBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.GetEndBodyStanceAnim" );
+	UFunction* const pFnGetEndBodyStanceAnim = pFnGetEndBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_StdCoverSlipLookAt_execGetEndBodyStanceAnim_Parms GetEndBodyStanceAnim_Parms;
 
@@ -1584,10 +1448,9 @@ struct FBodyStance USFXCustomAction_StdCoverSlipLookAt::GetEndBodyStanceAnim ( )
 
 struct FBodyStance USFXCustomAction_StdCoverSlipLookAt::GetLoopBodyStanceAnim ( )
 {
-	static UFunction* pFnGetLoopBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLoopBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.GetLoopBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLoopBodyStanceAnim )
-		pFnGetLoopBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.GetLoopBodyStanceAnim" );
+	UFunction* const pFnGetLoopBodyStanceAnim = pFnGetLoopBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_StdCoverSlipLookAt_execGetLoopBodyStanceAnim_Parms GetLoopBodyStanceAnim_Parms;
 
@@ -1603,10 +1466,9 @@ struct FBodyStance USFXCustomAction_StdCoverSlipLookAt::GetLoopBodyStanceAnim (
 
 struct FBodyStance USFXCustomAction_StdCoverSlipLookAt::GetStartBodyStanceAnim ( )
 {
-	static UFunction* pFnGetStartBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetStartBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.GetStartBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetStartBodyStanceAnim )
-		pFnGetStartBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.GetStartBodyStanceAnim" );
+	UFunction* const pFnGetStartBodyStanceAnim = pFnGetStartBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_StdCoverSlipLookAt_execGetStartBodyStanceAnim_Parms GetStartBodyStanceAnim_Parms;
 
@@ -1617,14 +1479,11 @@ struct FBodyStance USFXCustomAction_StdCoverSlipLookAt::GetStartBodyStanceAnim (
 
 
 
-class UClass* USFXCustomAction_SwatTurnLookAt::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_SwatTurnLookAt::pClassPointer { L"Class SFXGameContent.SFXCustomAction_SwatTurnLookAt", &UObject::FindClass };
 
 class UClass* USFXCustomAction_SwatTurnLookAt::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_SwatTurnLookAt" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.FlinchActionOverride
@@ -1633,10 +1492,9 @@ class UClass* USFXCustomAction_SwatTurnLookAt::StaticClass()
 
 void USFXCustomAction_SwatTurnLookAt::FlinchActionOverride ( )
 {
-	static UFunction* pFnFlinchActionOverride = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFlinchActionOverrideRef { L"Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.FlinchActionOverride", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFlinchActionOverride )
-		pFnFlinchActionOverride = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.FlinchActionOverride" );
+	UFunction* const pFnFlinchActionOverride = pFnFlinchActionOverrideRef.Get ( );
 
 	USFXCustomAction_SwatTurnLookAt_execFlinchActionOverride_Parms FlinchActionOverride_Parms;
 
@@ -1650,10 +1508,9 @@ void USFXCustomAction_SwatTurnLookAt::FlinchActionOverride ( )
 
 void USFXCustomAction_SwatTurnLookAt::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_SwatTurnLookAt_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -1673,10 +1530,9 @@ void USFXCustomAction_SwatTurnLookAt::eventGetUsedAnimNames ( TArray<struct SFXN
 
 struct FBodyStance USFXCustomAction_SwatTurnLookAt::GetEndBodyStanceAnim ( )
 {
-	static UFunction* pFnGetEndBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEndBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.GetEndBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEndBodyStanceAnim )
-		pFnGetEndBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.GetEndBodyStanceAnim" );
+	UFunction* const pFnGetEndBodyStanceAnim = pFnGetEndBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_SwatTurnLookAt_execGetEndBodyStanceAnim_Parms GetEndBodyStanceAnim_Parms;
 
@@ -1692,10 +1548,9 @@ struct FBodyStance USFXCustomAction_SwatTurnLookAt::GetEndBodyStanceAnim ( )
 
 struct FBodyStance USFXCustomAction_SwatTurnLookAt::GetLoopBodyStanceAnim ( )
 {
-	static UFunction* pFnGetLoopBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLoopBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.GetLoopBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLoopBodyStanceAnim )
-		pFnGetLoopBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.GetLoopBodyStanceAnim" );
+	UFunction* const pFnGetLoopBodyStanceAnim = pFnGetLoopBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_SwatTurnLookAt_execGetLoopBodyStanceAnim_Parms GetLoopBodyStanceAnim_Parms;
 
@@ -1711,10 +1566,9 @@ struct FBodyStance USFXCustomAction_SwatTurnLookAt::GetLoopBodyStanceAnim ( )
 
 struct FBodyStance USFXCustomAction_SwatTurnLookAt::GetStartBodyStanceAnim ( )
 {
-	static UFunction* pFnGetStartBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetStartBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.GetStartBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetStartBodyStanceAnim )
-		pFnGetStartBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.GetStartBodyStanceAnim" );
+	UFunction* const pFnGetStartBodyStanceAnim = pFnGetStartBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_SwatTurnLookAt_execGetStartBodyStanceAnim_Parms GetStartBodyStanceAnim_Parms;
 
@@ -1725,14 +1579,11 @@ struct FBodyStance USFXCustomAction_SwatTurnLookAt::GetStartBodyStanceAnim ( )
 
 
 
-class UClass* USFXCustomAction_StdSwatTurnLookAt::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StdSwatTurnLookAt::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StdSwatTurnLookAt", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StdSwatTurnLookAt::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StdSwatTurnLookAt" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.FlinchActionOverride
@@ -1741,10 +1592,9 @@ class UClass* USFXCustomAction_StdSwatTurnLookAt::StaticClass()
 
 void USFXCustomAction_StdSwatTurnLookAt::FlinchActionOverride ( )
 {
-	static UFunction* pFnFlinchActionOverride = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFlinchActionOverrideRef { L"Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.FlinchActionOverride", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFlinchActionOverride )
-		pFnFlinchActionOverride = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.FlinchActionOverride" );
+	UFunction* const pFnFlinchActionOverride = pFnFlinchActionOverrideRef.Get ( );
 
 	USFXCustomAction_StdSwatTurnLookAt_execFlinchActionOverride_Parms FlinchActionOverride_Parms;
 
@@ -1758,10 +1608,9 @@ void USFXCustomAction_StdSwatTurnLookAt::FlinchActionOverride ( )
 
 void USFXCustomAction_StdSwatTurnLookAt::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_StdSwatTurnLookAt_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -1781,10 +1630,9 @@ void USFXCustomAction_StdSwatTurnLookAt::eventGetUsedAnimNames ( TArray<struct S
 
 struct FBodyStance USFXCustomAction_StdSwatTurnLookAt::GetEndBodyStanceAnim ( )
 {
-	static UFunction* pFnGetEndBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEndBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.GetEndBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEndBodyStanceAnim )
-		pFnGetEndBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.GetEndBodyStanceAnim" );
+	UFunction* const pFnGetEndBodyStanceAnim = pFnGetEndBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_StdSwatTurnLookAt_execGetEndBodyStanceAnim_Parms GetEndBodyStanceAnim_Parms;
 
@@ -1800,10 +1648,9 @@ struct FBodyStance USFXCustomAction_StdSwatTurnLookAt::GetEndBodyStanceAnim ( )
 
 struct FBodyStance USFXCustomAction_StdSwatTurnLookAt::GetLoopBodyStanceAnim ( )
 {
-	static UFunction* pFnGetLoopBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLoopBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.GetLoopBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLoopBodyStanceAnim )
-		pFnGetLoopBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.GetLoopBodyStanceAnim" );
+	UFunction* const pFnGetLoopBodyStanceAnim = pFnGetLoopBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_StdSwatTurnLookAt_execGetLoopBodyStanceAnim_Parms GetLoopBodyStanceAnim_Parms;
 
@@ -1819,10 +1666,9 @@ struct FBodyStance USFXCustomAction_StdSwatTurnLookAt::GetLoopBodyStanceAnim ( )
 
 struct FBodyStance USFXCustomAction_StdSwatTurnLookAt::GetStartBodyStanceAnim ( )
 {
-	static UFunction* pFnGetStartBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetStartBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.GetStartBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetStartBodyStanceAnim )
-		pFnGetStartBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.GetStartBodyStanceAnim" );
+	UFunction* const pFnGetStartBodyStanceAnim = pFnGetStartBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_StdSwatTurnLookAt_execGetStartBodyStanceAnim_Parms GetStartBodyStanceAnim_Parms;
 
@@ -1833,14 +1679,11 @@ struct FBodyStance USFXCustomAction_StdSwatTurnLookAt::GetStartBodyStanceAnim (
 
 
 
-class UClass* USFXCustomAction_GapJump::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_GapJump::pClassPointer { L"Class SFXGameContent.SFXCustomAction_GapJump", &UObject::FindClass };
 
 class UClass* USFXCustomAction_GapJump::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_GapJump" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_GapJump.NotifyBump
@@ -1852,10 +1695,9 @@ class UClass* USFXCustomAction_GapJump::StaticClass()
 
 bool USFXCustomAction_GapJump::NotifyBump ( class AActor* Other, struct FVector const& HitNormal )
 {
-	static UFunction* pFnNotifyBump = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyBumpRef { L"Function SFXGameContent.SFXCustomAction_GapJump.NotifyBump", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyBump )
-		pFnNotifyBump = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_GapJump.NotifyBump" );
+	UFunction* const pFnNotifyBump = pFnNotifyBumpRef.Get ( );
 
 	USFXCustomAction_GapJump_execNotifyBump_Parms NotifyBump_Parms;
 	NotifyBump_Parms.Other = Other;
@@ -1872,10 +1714,9 @@ bool USFXCustomAction_GapJump::NotifyBump ( class AActor* Other, struct FVector
 
 void USFXCustomAction_GapJump::EndThisCustomAction ( )
 {
-	static UFunction* pFnEndThisCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndThisCustomActionRef { L"Function SFXGameContent.SFXCustomAction_GapJump.EndThisCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndThisCustomAction )
-		pFnEndThisCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_GapJump.EndThisCustomAction" );
+	UFunction* const pFnEndThisCustomAction = pFnEndThisCustomActionRef.Get ( );
 
 	USFXCustomAction_GapJump_execEndThisCustomAction_Parms EndThisCustomAction_Parms;
 
@@ -1888,10 +1729,9 @@ void USFXCustomAction_GapJump::EndThisCustomAction ( )
 
 void USFXCustomAction_GapJump::RemoveBlockingEndPoints ( )
 {
-	static UFunction* pFnRemoveBlockingEndPoints = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRemoveBlockingEndPointsRef { L"Function SFXGameContent.SFXCustomAction_GapJump.RemoveBlockingEndPoints", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRemoveBlockingEndPoints )
-		pFnRemoveBlockingEndPoints = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_GapJump.RemoveBlockingEndPoints" );
+	UFunction* const pFnRemoveBlockingEndPoints = pFnRemoveBlockingEndPointsRef.Get ( );
 
 	USFXCustomAction_GapJump_execRemoveBlockingEndPoints_Parms RemoveBlockingEndPoints_Parms;
 
@@ -1904,10 +1744,9 @@ void USFXCustomAction_GapJump::RemoveBlockingEndPoints ( )
 
 void USFXCustomAction_GapJump::BlockMoveEndPoints ( )
 {
-	static UFunction* pFnBlockMoveEndPoints = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBlockMoveEndPointsRef { L"Function SFXGameContent.SFXCustomAction_GapJump.BlockMoveEndPoints", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBlockMoveEndPoints )
-		pFnBlockMoveEndPoints = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_GapJump.BlockMoveEndPoints" );
+	UFunction* const pFnBlockMoveEndPoints = pFnBlockMoveEndPointsRef.Get ( );
 
 	USFXCustomAction_GapJump_execBlockMoveEndPoints_Parms BlockMoveEndPoints_Parms;
 
@@ -1923,10 +1762,9 @@ void USFXCustomAction_GapJump::BlockMoveEndPoints ( )
 
 void USFXCustomAction_GapJump::BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime )
 {
-	static UFunction* pFnBodyStanceAnimEndNotification = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBodyStanceAnimEndNotificationRef { L"Function SFXGameContent.SFXCustomAction_GapJump.BodyStanceAnimEndNotification", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBodyStanceAnimEndNotification )
-		pFnBodyStanceAnimEndNotification = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_GapJump.BodyStanceAnimEndNotification" );
+	UFunction* const pFnBodyStanceAnimEndNotification = pFnBodyStanceAnimEndNotificationRef.Get ( );
 
 	USFXCustomAction_GapJump_execBodyStanceAnimEndNotification_Parms BodyStanceAnimEndNotification_Parms;
 	BodyStanceAnimEndNotification_Parms.SeqNode = SeqNode;
@@ -1942,10 +1780,9 @@ void USFXCustomAction_GapJump::BodyStanceAnimEndNotification ( class UAnimNodeSe
 
 void USFXCustomAction_GapJump::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_GapJump.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_GapJump.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_GapJump_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -1958,10 +1795,9 @@ void USFXCustomAction_GapJump::StopCustomAction ( )
 
 void USFXCustomAction_GapJump::StartAnimation ( )
 {
-	static UFunction* pFnStartAnimation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartAnimationRef { L"Function SFXGameContent.SFXCustomAction_GapJump.StartAnimation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartAnimation )
-		pFnStartAnimation = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_GapJump.StartAnimation" );
+	UFunction* const pFnStartAnimation = pFnStartAnimationRef.Get ( );
 
 	USFXCustomAction_GapJump_execStartAnimation_Parms StartAnimation_Parms;
 
@@ -1974,10 +1810,9 @@ void USFXCustomAction_GapJump::StartAnimation ( )
 
 void USFXCustomAction_GapJump::ReachedPrecisePosition ( )
 {
-	static UFunction* pFnReachedPrecisePosition = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReachedPrecisePositionRef { L"Function SFXGameContent.SFXCustomAction_GapJump.ReachedPrecisePosition", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReachedPrecisePosition )
-		pFnReachedPrecisePosition = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_GapJump.ReachedPrecisePosition" );
+	UFunction* const pFnReachedPrecisePosition = pFnReachedPrecisePositionRef.Get ( );
 
 	USFXCustomAction_GapJump_execReachedPrecisePosition_Parms ReachedPrecisePosition_Parms;
 
@@ -1990,10 +1825,9 @@ void USFXCustomAction_GapJump::ReachedPrecisePosition ( )
 
 void USFXCustomAction_GapJump::AlignmentTimeout ( )
 {
-	static UFunction* pFnAlignmentTimeout = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAlignmentTimeoutRef { L"Function SFXGameContent.SFXCustomAction_GapJump.AlignmentTimeout", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAlignmentTimeout )
-		pFnAlignmentTimeout = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_GapJump.AlignmentTimeout" );
+	UFunction* const pFnAlignmentTimeout = pFnAlignmentTimeoutRef.Get ( );
 
 	USFXCustomAction_GapJump_execAlignmentTimeout_Parms AlignmentTimeout_Parms;
 
@@ -2006,10 +1840,9 @@ void USFXCustomAction_GapJump::AlignmentTimeout ( )
 
 void USFXCustomAction_GapJump::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_GapJump.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_GapJump.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_GapJump_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -2023,10 +1856,9 @@ void USFXCustomAction_GapJump::StartCustomAction ( )
 
 void USFXCustomAction_GapJump::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_GapJump.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_GapJump.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_GapJump_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -2041,26 +1873,20 @@ void USFXCustomAction_GapJump::eventGetUsedAnimNames ( TArray<struct SFXName>* U
 
 
 
-class UClass* USFXCustomAction_StandingGapJump::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StandingGapJump::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StandingGapJump", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StandingGapJump::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StandingGapJump" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_JumpDown::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_JumpDown::pClassPointer { L"Class SFXGameContent.SFXCustomAction_JumpDown", &UObject::FindClass };
 
 class UClass* USFXCustomAction_JumpDown::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_JumpDown" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_JumpDown.TickInput
@@ -2071,10 +1897,9 @@ class UClass* USFXCustomAction_JumpDown::StaticClass()
 
 void USFXCustomAction_JumpDown::TickInput ( class UBioPlayerInput* Input, float DeltaTime )
 {
-	static UFunction* pFnTickInput = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickInputRef { L"Function SFXGameContent.SFXCustomAction_JumpDown.TickInput", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTickInput )
-		pFnTickInput = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_JumpDown.TickInput" );
+	UFunction* const pFnTickInput = pFnTickInputRef.Get ( );
 
 	USFXCustomAction_JumpDown_execTickInput_Parms TickInput_Parms;
 	TickInput_Parms.Input = Input;
@@ -2089,10 +1914,9 @@ void USFXCustomAction_JumpDown::TickInput ( class UBioPlayerInput* Input, float
 
 void USFXCustomAction_JumpDown::PlayStartAnimation ( )
 {
-	static UFunction* pFnPlayStartAnimation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayStartAnimationRef { L"Function SFXGameContent.SFXCustomAction_JumpDown.PlayStartAnimation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayStartAnimation )
-		pFnPlayStartAnimation = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_JumpDown.PlayStartAnimation" );
+	UFunction* const pFnPlayStartAnimation = pFnPlayStartAnimationRef.Get ( );
 
 	USFXCustomAction_JumpDown_execPlayStartAnimation_Parms PlayStartAnimation_Parms;
 
@@ -2101,14 +1925,11 @@ void USFXCustomAction_JumpDown::PlayStartAnimation ( )
 
 
 
-class UClass* USFXCustomAction_PlayerMantleOverCover::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerMantleOverCover::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerMantleOverCover", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerMantleOverCover::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerMantleOverCover" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.GetEndAnim
@@ -2118,10 +1939,9 @@ class UClass* USFXCustomAction_PlayerMantleOverCover::StaticClass()
 
 void USFXCustomAction_PlayerMantleOverCover::GetEndAnim ( struct FBodyStance* Stance )
 {
-	static UFunction* pFnGetEndAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetEndAnimRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.GetEndAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetEndAnim )
-		pFnGetEndAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.GetEndAnim" );
+	UFunction* const pFnGetEndAnim = pFnGetEndAnimRef.Get ( );
 
 	USFXCustomAction_PlayerMantleOverCover_execGetEndAnim_Parms GetEndAnim_Parms;
 
@@ -2141,10 +1961,9 @@ void USFXCustomAction_PlayerMantleOverCover::GetEndAnim ( struct FBodyStance* St
 
 void USFXCustomAction_PlayerMantleOverCover::GetLoopAnim ( struct FBodyStance* Stance )
 {
-	static UFunction* pFnGetLoopAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetLoopAnimRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.GetLoopAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetLoopAnim )
-		pFnGetLoopAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.GetLoopAnim" );
+	UFunction* const pFnGetLoopAnim = pFnGetLoopAnimRef.Get ( );
 
 	USFXCustomAction_PlayerMantleOverCover_execGetLoopAnim_Parms GetLoopAnim_Parms;
 
@@ -2164,10 +1983,9 @@ void USFXCustomAction_PlayerMantleOverCover::GetLoopAnim ( struct FBodyStance* S
 
 void USFXCustomAction_PlayerMantleOverCover::GetStartAnim ( struct FBodyStance* Stance )
 {
-	static UFunction* pFnGetStartAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetStartAnimRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.GetStartAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetStartAnim )
-		pFnGetStartAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.GetStartAnim" );
+	UFunction* const pFnGetStartAnim = pFnGetStartAnimRef.Get ( );
 
 	USFXCustomAction_PlayerMantleOverCover_execGetStartAnim_Parms GetStartAnim_Parms;
 
@@ -2187,10 +2005,9 @@ void USFXCustomAction_PlayerMantleOverCover::GetStartAnim ( struct FBodyStance*
 
 void USFXCustomAction_PlayerMantleOverCover::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_PlayerMantleOverCover_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -2212,10 +2029,9 @@ void USFXCustomAction_PlayerMantleOverCover::eventGetUsedAnimNames ( TArray<stru
 
 void USFXCustomAction_PlayerMantleOverCover::BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime )
 {
-	static UFunction* pFnBodyStanceAnimEndNotification = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBodyStanceAnimEndNotificationRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.BodyStanceAnimEndNotification", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBodyStanceAnimEndNotification )
-		pFnBodyStanceAnimEndNotification = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.BodyStanceAnimEndNotification" );
+	UFunction* const pFnBodyStanceAnimEndNotification = pFnBodyStanceAnimEndNotificationRef.Get ( );
 
 	USFXCustomAction_PlayerMantleOverCover_execBodyStanceAnimEndNotification_Parms BodyStanceAnimEndNotification_Parms;
 	BodyStanceAnimEndNotification_Parms.SeqNode = SeqNode;
@@ -2232,10 +2048,9 @@ void USFXCustomAction_PlayerMantleOverCover::BodyStanceAnimEndNotification ( cla
 
 void USFXCustomAction_PlayerMantleOverCover::eventTickCustomAction ( float DeltaTime )
 {
-	static UFunction* pFnTickCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.TickCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTickCustomAction )
-		pFnTickCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.TickCustomAction" );
+	UFunction* const pFnTickCustomAction = pFnTickCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerMantleOverCover_eventTickCustomAction_Parms TickCustomAction_Parms;
 	TickCustomAction_Parms.DeltaTime = DeltaTime;
@@ -2249,10 +2064,9 @@ void USFXCustomAction_PlayerMantleOverCover::eventTickCustomAction ( float Delta
 
 void USFXCustomAction_PlayerMantleOverCover::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerMantleOverCover_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -2265,10 +2079,9 @@ void USFXCustomAction_PlayerMantleOverCover::StopCustomAction ( )
 
 void USFXCustomAction_PlayerMantleOverCover::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerMantleOverCover_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -2277,14 +2090,11 @@ void USFXCustomAction_PlayerMantleOverCover::StartCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_PlayerMantleUp::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerMantleUp::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerMantleUp", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerMantleUp::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerMantleUp" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_PlayerMantleUp.ClientDoCustomAction
@@ -2294,10 +2104,9 @@ class UClass* USFXCustomAction_PlayerMantleUp::StaticClass()
 
 void USFXCustomAction_PlayerMantleUp::ClientDoCustomAction ( unsigned long bForced )
 {
-	static UFunction* pFnClientDoCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.ClientDoCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoCustomAction )
-		pFnClientDoCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.ClientDoCustomAction" );
+	UFunction* const pFnClientDoCustomAction = pFnClientDoCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerMantleUp_execClientDoCustomAction_Parms ClientDoCustomAction_Parms;
 	ClientDoCustomAction_Parms.bForced = bForced;
@@ -2314,10 +2123,9 @@ void USFXCustomAction_PlayerMantleUp::ClientDoCustomAction ( unsigned long bForc
 
 void USFXCustomAction_PlayerMantleUp::ServerStartCustomAction ( int NewAction, class ABioPawn* Sync, int NewPowerAction )
 {
-	static UFunction* pFnServerStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnServerStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.ServerStartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnServerStartCustomAction )
-		pFnServerStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.ServerStartCustomAction" );
+	UFunction* const pFnServerStartCustomAction = pFnServerStartCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerMantleUp_execServerStartCustomAction_Parms ServerStartCustomAction_Parms;
 	ServerStartCustomAction_Parms.NewAction = NewAction;
@@ -2333,10 +2141,9 @@ void USFXCustomAction_PlayerMantleUp::ServerStartCustomAction ( int NewAction, c
 
 void USFXCustomAction_PlayerMantleUp::Replicate ( )
 {
-	static UFunction* pFnReplicate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReplicateRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.Replicate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReplicate )
-		pFnReplicate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.Replicate" );
+	UFunction* const pFnReplicate = pFnReplicateRef.Get ( );
 
 	USFXCustomAction_PlayerMantleUp_execReplicate_Parms Replicate_Parms;
 
@@ -2350,10 +2157,9 @@ void USFXCustomAction_PlayerMantleUp::Replicate ( )
 
 struct FBodyStance USFXCustomAction_PlayerMantleUp::GetBodyStanceAnim ( )
 {
-	static UFunction* pFnGetBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.GetBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetBodyStanceAnim )
-		pFnGetBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.GetBodyStanceAnim" );
+	UFunction* const pFnGetBodyStanceAnim = pFnGetBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_PlayerMantleUp_execGetBodyStanceAnim_Parms GetBodyStanceAnim_Parms;
 
@@ -2368,10 +2174,9 @@ struct FBodyStance USFXCustomAction_PlayerMantleUp::GetBodyStanceAnim ( )
 
 void USFXCustomAction_PlayerMantleUp::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerMantleUp_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -2384,10 +2189,9 @@ void USFXCustomAction_PlayerMantleUp::StopCustomAction ( )
 
 void USFXCustomAction_PlayerMantleUp::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerMantleUp_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -2403,10 +2207,9 @@ void USFXCustomAction_PlayerMantleUp::StartCustomAction ( )
 
 bool USFXCustomAction_PlayerMantleUp::InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced )
 {
-	static UFunction* pFnInternalCanDoCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalCanDoCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.InternalCanDoCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalCanDoCustomAction )
-		pFnInternalCanDoCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.InternalCanDoCustomAction" );
+	UFunction* const pFnInternalCanDoCustomAction = pFnInternalCanDoCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerMantleUp_execInternalCanDoCustomAction_Parms InternalCanDoCustomAction_Parms;
 	InternalCanDoCustomAction_Parms.SyncPawn = SyncPawn;
@@ -2424,10 +2227,9 @@ bool USFXCustomAction_PlayerMantleUp::InternalCanDoCustomAction ( class ABioPawn
 
 void USFXCustomAction_PlayerMantleUp::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_PlayerMantleUp_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -2442,14 +2244,11 @@ void USFXCustomAction_PlayerMantleUp::eventGetUsedAnimNames ( TArray<struct SFXN
 
 
 
-class UClass* USFXCustomAction_SimpleMoveBase::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_SimpleMoveBase::pClassPointer { L"Class SFXGameContent.SFXCustomAction_SimpleMoveBase", &UObject::FindClass };
 
 class UClass* USFXCustomAction_SimpleMoveBase::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_SimpleMoveBase" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_SimpleMoveBase.ClientDoCustomAction
@@ -2459,10 +2258,9 @@ class UClass* USFXCustomAction_SimpleMoveBase::StaticClass()
 
 void USFXCustomAction_SimpleMoveBase::ClientDoCustomAction ( unsigned long bForced )
 {
-	static UFunction* pFnClientDoCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoCustomActionRef { L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.ClientDoCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoCustomAction )
-		pFnClientDoCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.ClientDoCustomAction" );
+	UFunction* const pFnClientDoCustomAction = pFnClientDoCustomActionRef.Get ( );
 
 	USFXCustomAction_SimpleMoveBase_execClientDoCustomAction_Parms ClientDoCustomAction_Parms;
 	ClientDoCustomAction_Parms.bForced = bForced;
@@ -2476,10 +2274,9 @@ void USFXCustomAction_SimpleMoveBase::ClientDoCustomAction ( unsigned long bForc
 
 void USFXCustomAction_SimpleMoveBase::Replicate ( )
 {
-	static UFunction* pFnReplicate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReplicateRef { L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.Replicate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReplicate )
-		pFnReplicate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.Replicate" );
+	UFunction* const pFnReplicate = pFnReplicateRef.Get ( );
 
 	USFXCustomAction_SimpleMoveBase_execReplicate_Parms Replicate_Parms;
 
@@ -2493,10 +2290,9 @@ void USFXCustomAction_SimpleMoveBase::Replicate ( )
 
 bool USFXCustomAction_SimpleMoveBase::CanBeInterrupted ( )
 {
-	static UFunction* pFnCanBeInterrupted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanBeInterruptedRef { L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.CanBeInterrupted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanBeInterrupted )
-		pFnCanBeInterrupted = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.CanBeInterrupted" );
+	UFunction* const pFnCanBeInterrupted = pFnCanBeInterruptedRef.Get ( );
 
 	USFXCustomAction_SimpleMoveBase_execCanBeInterrupted_Parms CanBeInterrupted_Parms;
 
@@ -2511,10 +2307,9 @@ bool USFXCustomAction_SimpleMoveBase::CanBeInterrupted ( )
 
 void USFXCustomAction_SimpleMoveBase::DestTimeout ( )
 {
-	static UFunction* pFnDestTimeout = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDestTimeoutRef { L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.DestTimeout", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDestTimeout )
-		pFnDestTimeout = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.DestTimeout" );
+	UFunction* const pFnDestTimeout = pFnDestTimeoutRef.Get ( );
 
 	USFXCustomAction_SimpleMoveBase_execDestTimeout_Parms DestTimeout_Parms;
 
@@ -2530,10 +2325,9 @@ void USFXCustomAction_SimpleMoveBase::DestTimeout ( )
 
 void USFXCustomAction_SimpleMoveBase::BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime )
 {
-	static UFunction* pFnBodyStanceAnimEndNotification = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBodyStanceAnimEndNotificationRef { L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.BodyStanceAnimEndNotification", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBodyStanceAnimEndNotification )
-		pFnBodyStanceAnimEndNotification = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.BodyStanceAnimEndNotification" );
+	UFunction* const pFnBodyStanceAnimEndNotification = pFnBodyStanceAnimEndNotificationRef.Get ( );
 
 	USFXCustomAction_SimpleMoveBase_execBodyStanceAnimEndNotification_Parms BodyStanceAnimEndNotification_Parms;
 	BodyStanceAnimEndNotification_Parms.SeqNode = SeqNode;
@@ -2549,10 +2343,9 @@ void USFXCustomAction_SimpleMoveBase::BodyStanceAnimEndNotification ( class UAni
 
 void USFXCustomAction_SimpleMoveBase::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_SimpleMoveBase_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -2565,10 +2358,9 @@ void USFXCustomAction_SimpleMoveBase::StopCustomAction ( )
 
 void USFXCustomAction_SimpleMoveBase::PlayStartAnimation ( )
 {
-	static UFunction* pFnPlayStartAnimation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayStartAnimationRef { L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.PlayStartAnimation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayStartAnimation )
-		pFnPlayStartAnimation = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.PlayStartAnimation" );
+	UFunction* const pFnPlayStartAnimation = pFnPlayStartAnimationRef.Get ( );
 
 	USFXCustomAction_SimpleMoveBase_execPlayStartAnimation_Parms PlayStartAnimation_Parms;
 
@@ -2582,10 +2374,9 @@ void USFXCustomAction_SimpleMoveBase::PlayStartAnimation ( )
 
 struct FBodyStance USFXCustomAction_SimpleMoveBase::GetBodyStanceAnim ( )
 {
-	static UFunction* pFnGetBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.GetBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetBodyStanceAnim )
-		pFnGetBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.GetBodyStanceAnim" );
+	UFunction* const pFnGetBodyStanceAnim = pFnGetBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_SimpleMoveBase_execGetBodyStanceAnim_Parms GetBodyStanceAnim_Parms;
 
@@ -2600,10 +2391,9 @@ struct FBodyStance USFXCustomAction_SimpleMoveBase::GetBodyStanceAnim ( )
 
 void USFXCustomAction_SimpleMoveBase::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_SimpleMoveBase_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -2619,10 +2409,9 @@ void USFXCustomAction_SimpleMoveBase::StartCustomAction ( )
 
 bool USFXCustomAction_SimpleMoveBase::InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced )
 {
-	static UFunction* pFnInternalCanDoCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalCanDoCustomActionRef { L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.InternalCanDoCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalCanDoCustomAction )
-		pFnInternalCanDoCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.InternalCanDoCustomAction" );
+	UFunction* const pFnInternalCanDoCustomAction = pFnInternalCanDoCustomActionRef.Get ( );
 
 	USFXCustomAction_SimpleMoveBase_execInternalCanDoCustomAction_Parms InternalCanDoCustomAction_Parms;
 	InternalCanDoCustomAction_Parms.SyncPawn = SyncPawn;
@@ -2639,10 +2428,9 @@ bool USFXCustomAction_SimpleMoveBase::InternalCanDoCustomAction ( class ABioPawn
 
 void USFXCustomAction_SimpleMoveBase::RemoveBlockingEndPoints ( )
 {
-	static UFunction* pFnRemoveBlockingEndPoints = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRemoveBlockingEndPointsRef { L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.RemoveBlockingEndPoints", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRemoveBlockingEndPoints )
-		pFnRemoveBlockingEndPoints = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.RemoveBlockingEndPoints" );
+	UFunction* const pFnRemoveBlockingEndPoints = pFnRemoveBlockingEndPointsRef.Get ( );
 
 	USFXCustomAction_SimpleMoveBase_execRemoveBlockingEndPoints_Parms RemoveBlockingEndPoints_Parms;
 
@@ -2655,10 +2443,9 @@ void USFXCustomAction_SimpleMoveBase::RemoveBlockingEndPoints ( )
 
 void USFXCustomAction_SimpleMoveBase::BlockMoveEndPoints ( )
 {
-	static UFunction* pFnBlockMoveEndPoints = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBlockMoveEndPointsRef { L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.BlockMoveEndPoints", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBlockMoveEndPoints )
-		pFnBlockMoveEndPoints = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.BlockMoveEndPoints" );
+	UFunction* const pFnBlockMoveEndPoints = pFnBlockMoveEndPointsRef.Get ( );
 
 	USFXCustomAction_SimpleMoveBase_execBlockMoveEndPoints_Parms BlockMoveEndPoints_Parms;
 
@@ -2671,10 +2458,9 @@ void USFXCustomAction_SimpleMoveBase::BlockMoveEndPoints ( )
 
 void USFXCustomAction_SimpleMoveBase::eventReachedPrecisePosition ( )
 {
-	static UFunction* pFnReachedPrecisePosition = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReachedPrecisePositionRef { L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.ReachedPrecisePosition", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReachedPrecisePosition )
-		pFnReachedPrecisePosition = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.ReachedPrecisePosition" );
+	UFunction* const pFnReachedPrecisePosition = pFnReachedPrecisePositionRef.Get ( );
 
 	USFXCustomAction_SimpleMoveBase_eventReachedPrecisePosition_Parms ReachedPrecisePosition_Parms;
 
@@ -2688,10 +2474,9 @@ void USFXCustomAction_SimpleMoveBase::eventReachedPrecisePosition ( )
 
 void USFXCustomAction_SimpleMoveBase::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_SimpleMoveBase_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -2706,14 +2491,11 @@ void USFXCustomAction_SimpleMoveBase::eventGetUsedAnimNames ( TArray<struct SFXN
 
 
 
-class UClass* USFXCustomAction_PlayerCoverSlipLeft::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerCoverSlipLeft::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerCoverSlipLeft", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerCoverSlipLeft::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerCoverSlipLeft" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_PlayerCoverSlipLeft.EndThisCustomAction
@@ -2722,10 +2504,9 @@ class UClass* USFXCustomAction_PlayerCoverSlipLeft::StaticClass()
 
 void USFXCustomAction_PlayerCoverSlipLeft::EndThisCustomAction ( )
 {
-	static UFunction* pFnEndThisCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndThisCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipLeft.EndThisCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndThisCustomAction )
-		pFnEndThisCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipLeft.EndThisCustomAction" );
+	UFunction* const pFnEndThisCustomAction = pFnEndThisCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerCoverSlipLeft_execEndThisCustomAction_Parms EndThisCustomAction_Parms;
 
@@ -2738,10 +2519,9 @@ void USFXCustomAction_PlayerCoverSlipLeft::EndThisCustomAction ( )
 
 void USFXCustomAction_PlayerCoverSlipLeft::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipLeft.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipLeft.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerCoverSlipLeft_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -2750,14 +2530,11 @@ void USFXCustomAction_PlayerCoverSlipLeft::StartCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_PlayerCoverSlipLeftStanding::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerCoverSlipLeftStanding::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerCoverSlipLeftStanding", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerCoverSlipLeftStanding::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerCoverSlipLeftStanding" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_PlayerCoverSlipLeftStanding.EndThisCustomAction
@@ -2766,10 +2543,9 @@ class UClass* USFXCustomAction_PlayerCoverSlipLeftStanding::StaticClass()
 
 void USFXCustomAction_PlayerCoverSlipLeftStanding::EndThisCustomAction ( )
 {
-	static UFunction* pFnEndThisCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndThisCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipLeftStanding.EndThisCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndThisCustomAction )
-		pFnEndThisCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipLeftStanding.EndThisCustomAction" );
+	UFunction* const pFnEndThisCustomAction = pFnEndThisCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerCoverSlipLeftStanding_execEndThisCustomAction_Parms EndThisCustomAction_Parms;
 
@@ -2782,10 +2558,9 @@ void USFXCustomAction_PlayerCoverSlipLeftStanding::EndThisCustomAction ( )
 
 void USFXCustomAction_PlayerCoverSlipLeftStanding::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipLeftStanding.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipLeftStanding.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerCoverSlipLeftStanding_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -2794,14 +2569,11 @@ void USFXCustomAction_PlayerCoverSlipLeftStanding::StartCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_PlayerCoverSlipRight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerCoverSlipRight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerCoverSlipRight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerCoverSlipRight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerCoverSlipRight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_PlayerCoverSlipRight.EndThisCustomAction
@@ -2810,10 +2582,9 @@ class UClass* USFXCustomAction_PlayerCoverSlipRight::StaticClass()
 
 void USFXCustomAction_PlayerCoverSlipRight::EndThisCustomAction ( )
 {
-	static UFunction* pFnEndThisCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndThisCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipRight.EndThisCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndThisCustomAction )
-		pFnEndThisCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipRight.EndThisCustomAction" );
+	UFunction* const pFnEndThisCustomAction = pFnEndThisCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerCoverSlipRight_execEndThisCustomAction_Parms EndThisCustomAction_Parms;
 
@@ -2826,10 +2597,9 @@ void USFXCustomAction_PlayerCoverSlipRight::EndThisCustomAction ( )
 
 void USFXCustomAction_PlayerCoverSlipRight::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipRight.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipRight.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerCoverSlipRight_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -2838,14 +2608,11 @@ void USFXCustomAction_PlayerCoverSlipRight::StartCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_PlayerCoverSlipRightStanding::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerCoverSlipRightStanding::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerCoverSlipRightStanding", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerCoverSlipRightStanding::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerCoverSlipRightStanding" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_PlayerCoverSlipRightStanding.EndThisCustomAction
@@ -2854,10 +2621,9 @@ class UClass* USFXCustomAction_PlayerCoverSlipRightStanding::StaticClass()
 
 void USFXCustomAction_PlayerCoverSlipRightStanding::EndThisCustomAction ( )
 {
-	static UFunction* pFnEndThisCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndThisCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipRightStanding.EndThisCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndThisCustomAction )
-		pFnEndThisCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipRightStanding.EndThisCustomAction" );
+	UFunction* const pFnEndThisCustomAction = pFnEndThisCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerCoverSlipRightStanding_execEndThisCustomAction_Parms EndThisCustomAction_Parms;
 
@@ -2870,10 +2636,9 @@ void USFXCustomAction_PlayerCoverSlipRightStanding::EndThisCustomAction ( )
 
 void USFXCustomAction_PlayerCoverSlipRightStanding::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipRightStanding.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipRightStanding.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerCoverSlipRightStanding_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -2882,14 +2647,11 @@ void USFXCustomAction_PlayerCoverSlipRightStanding::StartCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_PlayerLadderClimbUp::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerLadderClimbUp::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerLadderClimbUp", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerLadderClimbUp::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerLadderClimbUp" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.StopCustomAction
@@ -2898,10 +2660,9 @@ class UClass* USFXCustomAction_PlayerLadderClimbUp::StaticClass()
 
 void USFXCustomAction_PlayerLadderClimbUp::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerLadderClimbUp_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -2914,10 +2675,9 @@ void USFXCustomAction_PlayerLadderClimbUp::StopCustomAction ( )
 
 void USFXCustomAction_PlayerLadderClimbUp::PreAlignPawnLocation ( )
 {
-	static UFunction* pFnPreAlignPawnLocation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPreAlignPawnLocationRef { L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.PreAlignPawnLocation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPreAlignPawnLocation )
-		pFnPreAlignPawnLocation = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.PreAlignPawnLocation" );
+	UFunction* const pFnPreAlignPawnLocation = pFnPreAlignPawnLocationRef.Get ( );
 
 	USFXCustomAction_PlayerLadderClimbUp_execPreAlignPawnLocation_Parms PreAlignPawnLocation_Parms;
 
@@ -2931,10 +2691,9 @@ void USFXCustomAction_PlayerLadderClimbUp::PreAlignPawnLocation ( )
 
 void USFXCustomAction_PlayerLadderClimbUp::SetMoveStage ( unsigned char NextStage )
 {
-	static UFunction* pFnSetMoveStage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetMoveStageRef { L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.SetMoveStage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetMoveStage )
-		pFnSetMoveStage = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.SetMoveStage" );
+	UFunction* const pFnSetMoveStage = pFnSetMoveStageRef.Get ( );
 
 	USFXCustomAction_PlayerLadderClimbUp_execSetMoveStage_Parms SetMoveStage_Parms;
 	SetMoveStage_Parms.NextStage = NextStage;
@@ -2949,10 +2708,9 @@ void USFXCustomAction_PlayerLadderClimbUp::SetMoveStage ( unsigned char NextStag
 
 void USFXCustomAction_PlayerLadderClimbUp::TickCustomAction ( float DeltaTime )
 {
-	static UFunction* pFnTickCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.TickCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTickCustomAction )
-		pFnTickCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.TickCustomAction" );
+	UFunction* const pFnTickCustomAction = pFnTickCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerLadderClimbUp_execTickCustomAction_Parms TickCustomAction_Parms;
 	TickCustomAction_Parms.DeltaTime = DeltaTime;
@@ -2967,10 +2725,9 @@ void USFXCustomAction_PlayerLadderClimbUp::TickCustomAction ( float DeltaTime )
 
 void USFXCustomAction_PlayerLadderClimbUp::SyncRotation ( float Alpha )
 {
-	static UFunction* pFnSyncRotation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSyncRotationRef { L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.SyncRotation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSyncRotation )
-		pFnSyncRotation = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.SyncRotation" );
+	UFunction* const pFnSyncRotation = pFnSyncRotationRef.Get ( );
 
 	USFXCustomAction_PlayerLadderClimbUp_execSyncRotation_Parms SyncRotation_Parms;
 	SyncRotation_Parms.Alpha = Alpha;
@@ -2985,10 +2742,9 @@ void USFXCustomAction_PlayerLadderClimbUp::SyncRotation ( float Alpha )
 
 void USFXCustomAction_PlayerLadderClimbUp::SyncJumpEntrance ( float Alpha )
 {
-	static UFunction* pFnSyncJumpEntrance = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSyncJumpEntranceRef { L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.SyncJumpEntrance", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSyncJumpEntrance )
-		pFnSyncJumpEntrance = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.SyncJumpEntrance" );
+	UFunction* const pFnSyncJumpEntrance = pFnSyncJumpEntranceRef.Get ( );
 
 	USFXCustomAction_PlayerLadderClimbUp_execSyncJumpEntrance_Parms SyncJumpEntrance_Parms;
 	SyncJumpEntrance_Parms.Alpha = Alpha;
@@ -3003,10 +2759,9 @@ void USFXCustomAction_PlayerLadderClimbUp::SyncJumpEntrance ( float Alpha )
 
 void USFXCustomAction_PlayerLadderClimbUp::TickAlignment ( float DeltaTime )
 {
-	static UFunction* pFnTickAlignment = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickAlignmentRef { L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.TickAlignment", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTickAlignment )
-		pFnTickAlignment = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.TickAlignment" );
+	UFunction* const pFnTickAlignment = pFnTickAlignmentRef.Get ( );
 
 	USFXCustomAction_PlayerLadderClimbUp_execTickAlignment_Parms TickAlignment_Parms;
 	TickAlignment_Parms.DeltaTime = DeltaTime;
@@ -3020,10 +2775,9 @@ void USFXCustomAction_PlayerLadderClimbUp::TickAlignment ( float DeltaTime )
 
 void USFXCustomAction_PlayerLadderClimbUp::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerLadderClimbUp_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -3038,10 +2792,9 @@ void USFXCustomAction_PlayerLadderClimbUp::StartCustomAction ( )
 
 void USFXCustomAction_PlayerLadderClimbUp::TickInput ( class UBioPlayerInput* Input, float DeltaTime )
 {
-	static UFunction* pFnTickInput = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickInputRef { L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.TickInput", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTickInput )
-		pFnTickInput = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.TickInput" );
+	UFunction* const pFnTickInput = pFnTickInputRef.Get ( );
 
 	USFXCustomAction_PlayerLadderClimbUp_execTickInput_Parms TickInput_Parms;
 	TickInput_Parms.Input = Input;
@@ -3057,10 +2810,9 @@ void USFXCustomAction_PlayerLadderClimbUp::TickInput ( class UBioPlayerInput* In
 
 void USFXCustomAction_PlayerLadderClimbUp::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_PlayerLadderClimbUp_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -3075,14 +2827,11 @@ void USFXCustomAction_PlayerLadderClimbUp::eventGetUsedAnimNames ( TArray<struct
 
 
 
-class UClass* USFXCustomAction_PlayerLadderClimbDown::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerLadderClimbDown::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerLadderClimbDown", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerLadderClimbDown::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerLadderClimbDown" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_PlayerLadderClimbDown.TickInput
@@ -3093,10 +2842,9 @@ class UClass* USFXCustomAction_PlayerLadderClimbDown::StaticClass()
 
 void USFXCustomAction_PlayerLadderClimbDown::TickInput ( class UBioPlayerInput* Input, float DeltaTime )
 {
-	static UFunction* pFnTickInput = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickInputRef { L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbDown.TickInput", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTickInput )
-		pFnTickInput = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbDown.TickInput" );
+	UFunction* const pFnTickInput = pFnTickInputRef.Get ( );
 
 	USFXCustomAction_PlayerLadderClimbDown_execTickInput_Parms TickInput_Parms;
 	TickInput_Parms.Input = Input;
@@ -3107,14 +2855,11 @@ void USFXCustomAction_PlayerLadderClimbDown::TickInput ( class UBioPlayerInput*
 
 
 
-class UClass* USFXCustomAction_PlayerEvadeLeft::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerEvadeLeft::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerEvadeLeft", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerEvadeLeft::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerEvadeLeft" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_PlayerEvadeLeft.RollOverride
@@ -3123,10 +2868,9 @@ class UClass* USFXCustomAction_PlayerEvadeLeft::StaticClass()
 
 void USFXCustomAction_PlayerEvadeLeft::RollOverride ( )
 {
-	static UFunction* pFnRollOverride = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRollOverrideRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeLeft.RollOverride", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRollOverride )
-		pFnRollOverride = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeLeft.RollOverride" );
+	UFunction* const pFnRollOverride = pFnRollOverrideRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeLeft_execRollOverride_Parms RollOverride_Parms;
 
@@ -3139,10 +2883,9 @@ void USFXCustomAction_PlayerEvadeLeft::RollOverride ( )
 
 void USFXCustomAction_PlayerEvadeLeft::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeLeft.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeLeft.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeLeft_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -3158,10 +2901,9 @@ void USFXCustomAction_PlayerEvadeLeft::StartCustomAction ( )
 
 bool USFXCustomAction_PlayerEvadeLeft::InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced )
 {
-	static UFunction* pFnInternalCanDoCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalCanDoCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeLeft.InternalCanDoCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalCanDoCustomAction )
-		pFnInternalCanDoCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeLeft.InternalCanDoCustomAction" );
+	UFunction* const pFnInternalCanDoCustomAction = pFnInternalCanDoCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeLeft_execInternalCanDoCustomAction_Parms InternalCanDoCustomAction_Parms;
 	InternalCanDoCustomAction_Parms.SyncPawn = SyncPawn;
@@ -3174,14 +2916,11 @@ bool USFXCustomAction_PlayerEvadeLeft::InternalCanDoCustomAction ( class ABioPaw
 
 
 
-class UClass* USFXCustomAction_PlayerEvadeRight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerEvadeRight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerEvadeRight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerEvadeRight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerEvadeRight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_PlayerEvadeRight.RollOverride
@@ -3190,10 +2929,9 @@ class UClass* USFXCustomAction_PlayerEvadeRight::StaticClass()
 
 void USFXCustomAction_PlayerEvadeRight::RollOverride ( )
 {
-	static UFunction* pFnRollOverride = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRollOverrideRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeRight.RollOverride", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRollOverride )
-		pFnRollOverride = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeRight.RollOverride" );
+	UFunction* const pFnRollOverride = pFnRollOverrideRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeRight_execRollOverride_Parms RollOverride_Parms;
 
@@ -3206,10 +2944,9 @@ void USFXCustomAction_PlayerEvadeRight::RollOverride ( )
 
 void USFXCustomAction_PlayerEvadeRight::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeRight.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeRight.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeRight_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -3225,10 +2962,9 @@ void USFXCustomAction_PlayerEvadeRight::StartCustomAction ( )
 
 bool USFXCustomAction_PlayerEvadeRight::InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced )
 {
-	static UFunction* pFnInternalCanDoCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalCanDoCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeRight.InternalCanDoCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalCanDoCustomAction )
-		pFnInternalCanDoCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeRight.InternalCanDoCustomAction" );
+	UFunction* const pFnInternalCanDoCustomAction = pFnInternalCanDoCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeRight_execInternalCanDoCustomAction_Parms InternalCanDoCustomAction_Parms;
 	InternalCanDoCustomAction_Parms.SyncPawn = SyncPawn;
@@ -3241,14 +2977,11 @@ bool USFXCustomAction_PlayerEvadeRight::InternalCanDoCustomAction ( class ABioPa
 
 
 
-class UClass* USFXCustomAction_PlayerEvadeForward::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerEvadeForward::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerEvadeForward", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerEvadeForward::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerEvadeForward" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.ClientDoCustomActionImpact
@@ -3263,10 +2996,9 @@ class UClass* USFXCustomAction_PlayerEvadeForward::StaticClass()
 
 void USFXCustomAction_PlayerEvadeForward::ClientDoCustomActionImpact ( class AActor* oActor, int ImpactCount, unsigned long bFirstTarget, struct FVector const& HitLocation, struct FVector const& HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnClientDoCustomActionImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoCustomActionImpactRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.ClientDoCustomActionImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoCustomActionImpact )
-		pFnClientDoCustomActionImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.ClientDoCustomActionImpact" );
+	UFunction* const pFnClientDoCustomActionImpact = pFnClientDoCustomActionImpactRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeForward_execClientDoCustomActionImpact_Parms ClientDoCustomActionImpact_Parms;
 	ClientDoCustomActionImpact_Parms.oActor = oActor;
@@ -3285,10 +3017,9 @@ void USFXCustomAction_PlayerEvadeForward::ClientDoCustomActionImpact ( class AAc
 
 void USFXCustomAction_PlayerEvadeForward::RollOverride ( )
 {
-	static UFunction* pFnRollOverride = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRollOverrideRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.RollOverride", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRollOverride )
-		pFnRollOverride = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.RollOverride" );
+	UFunction* const pFnRollOverride = pFnRollOverrideRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeForward_execRollOverride_Parms RollOverride_Parms;
 
@@ -3301,10 +3032,9 @@ void USFXCustomAction_PlayerEvadeForward::RollOverride ( )
 
 void USFXCustomAction_PlayerEvadeForward::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeForward_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -3317,10 +3047,9 @@ void USFXCustomAction_PlayerEvadeForward::StopCustomAction ( )
 
 void USFXCustomAction_PlayerEvadeForward::TurnOnHitWall ( )
 {
-	static UFunction* pFnTurnOnHitWall = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTurnOnHitWallRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.TurnOnHitWall", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTurnOnHitWall )
-		pFnTurnOnHitWall = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.TurnOnHitWall" );
+	UFunction* const pFnTurnOnHitWall = pFnTurnOnHitWallRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeForward_execTurnOnHitWall_Parms TurnOnHitWall_Parms;
 
@@ -3336,10 +3065,9 @@ void USFXCustomAction_PlayerEvadeForward::TurnOnHitWall ( )
 
 bool USFXCustomAction_PlayerEvadeForward::NotifyHitWall ( struct FVector const& HitNormal, class AActor* Wall )
 {
-	static UFunction* pFnNotifyHitWall = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyHitWallRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.NotifyHitWall", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyHitWall )
-		pFnNotifyHitWall = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.NotifyHitWall" );
+	UFunction* const pFnNotifyHitWall = pFnNotifyHitWallRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeForward_execNotifyHitWall_Parms NotifyHitWall_Parms;
 	memcpy ( &NotifyHitWall_Parms.HitNormal, &HitNormal, 0xC );
@@ -3356,10 +3084,9 @@ bool USFXCustomAction_PlayerEvadeForward::NotifyHitWall ( struct FVector const&
 
 void USFXCustomAction_PlayerEvadeForward::EndThisCustomAction ( )
 {
-	static UFunction* pFnEndThisCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndThisCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.EndThisCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndThisCustomAction )
-		pFnEndThisCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.EndThisCustomAction" );
+	UFunction* const pFnEndThisCustomAction = pFnEndThisCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeForward_execEndThisCustomAction_Parms EndThisCustomAction_Parms;
 
@@ -3374,10 +3101,9 @@ void USFXCustomAction_PlayerEvadeForward::EndThisCustomAction ( )
 
 void USFXCustomAction_PlayerEvadeForward::SyncRotation ( float Alpha, struct FVector const& ToEnd2D )
 {
-	static UFunction* pFnSyncRotation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSyncRotationRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.SyncRotation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSyncRotation )
-		pFnSyncRotation = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.SyncRotation" );
+	UFunction* const pFnSyncRotation = pFnSyncRotationRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeForward_execSyncRotation_Parms SyncRotation_Parms;
 	SyncRotation_Parms.Alpha = Alpha;
@@ -3392,10 +3118,9 @@ void USFXCustomAction_PlayerEvadeForward::SyncRotation ( float Alpha, struct FVe
 
 void USFXCustomAction_PlayerEvadeForward::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeForward_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -3411,10 +3136,9 @@ void USFXCustomAction_PlayerEvadeForward::StartCustomAction ( )
 
 bool USFXCustomAction_PlayerEvadeForward::InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced )
 {
-	static UFunction* pFnInternalCanDoCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalCanDoCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.InternalCanDoCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalCanDoCustomAction )
-		pFnInternalCanDoCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.InternalCanDoCustomAction" );
+	UFunction* const pFnInternalCanDoCustomAction = pFnInternalCanDoCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeForward_execInternalCanDoCustomAction_Parms InternalCanDoCustomAction_Parms;
 	InternalCanDoCustomAction_Parms.SyncPawn = SyncPawn;
@@ -3427,14 +3151,11 @@ bool USFXCustomAction_PlayerEvadeForward::InternalCanDoCustomAction ( class ABio
 
 
 
-class UClass* USFXCustomAction_PlayerEvadeBackwards::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerEvadeBackwards::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerEvadeBackwards", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerEvadeBackwards::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerEvadeBackwards" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.ClientDoCustomActionImpact
@@ -3449,10 +3170,9 @@ class UClass* USFXCustomAction_PlayerEvadeBackwards::StaticClass()
 
 void USFXCustomAction_PlayerEvadeBackwards::ClientDoCustomActionImpact ( class AActor* oActor, int ImpactCount, unsigned long bFirstTarget, struct FVector const& HitLocation, struct FVector const& HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnClientDoCustomActionImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoCustomActionImpactRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.ClientDoCustomActionImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoCustomActionImpact )
-		pFnClientDoCustomActionImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.ClientDoCustomActionImpact" );
+	UFunction* const pFnClientDoCustomActionImpact = pFnClientDoCustomActionImpactRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeBackwards_execClientDoCustomActionImpact_Parms ClientDoCustomActionImpact_Parms;
 	ClientDoCustomActionImpact_Parms.oActor = oActor;
@@ -3471,10 +3191,9 @@ void USFXCustomAction_PlayerEvadeBackwards::ClientDoCustomActionImpact ( class A
 
 void USFXCustomAction_PlayerEvadeBackwards::RollOverride ( )
 {
-	static UFunction* pFnRollOverride = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRollOverrideRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.RollOverride", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRollOverride )
-		pFnRollOverride = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.RollOverride" );
+	UFunction* const pFnRollOverride = pFnRollOverrideRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeBackwards_execRollOverride_Parms RollOverride_Parms;
 
@@ -3487,10 +3206,9 @@ void USFXCustomAction_PlayerEvadeBackwards::RollOverride ( )
 
 void USFXCustomAction_PlayerEvadeBackwards::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeBackwards_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -3503,10 +3221,9 @@ void USFXCustomAction_PlayerEvadeBackwards::StopCustomAction ( )
 
 void USFXCustomAction_PlayerEvadeBackwards::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeBackwards_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -3522,10 +3239,9 @@ void USFXCustomAction_PlayerEvadeBackwards::StartCustomAction ( )
 
 bool USFXCustomAction_PlayerEvadeBackwards::InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced )
 {
-	static UFunction* pFnInternalCanDoCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalCanDoCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.InternalCanDoCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalCanDoCustomAction )
-		pFnInternalCanDoCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.InternalCanDoCustomAction" );
+	UFunction* const pFnInternalCanDoCustomAction = pFnInternalCanDoCustomActionRef.Get ( );
 
 	USFXCustomAction_PlayerEvadeBackwards_execInternalCanDoCustomAction_Parms InternalCanDoCustomAction_Parms;
 	InternalCanDoCustomAction_Parms.SyncPawn = SyncPawn;
@@ -3538,14 +3254,11 @@ bool USFXCustomAction_PlayerEvadeBackwards::InternalCanDoCustomAction ( class AB
 
 
 
-class UClass* USFXCustomAction_MantleMelee::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_MantleMelee::pClassPointer { L"Class SFXGameContent.SFXCustomAction_MantleMelee", &UObject::FindClass };
 
 class UClass* USFXCustomAction_MantleMelee::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_MantleMelee" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_MantleMelee.EndThisCustomAction
@@ -3554,10 +3267,9 @@ class UClass* USFXCustomAction_MantleMelee::StaticClass()
 
 void USFXCustomAction_MantleMelee::EndThisCustomAction ( )
 {
-	static UFunction* pFnEndThisCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndThisCustomActionRef { L"Function SFXGameContent.SFXCustomAction_MantleMelee.EndThisCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndThisCustomAction )
-		pFnEndThisCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_MantleMelee.EndThisCustomAction" );
+	UFunction* const pFnEndThisCustomAction = pFnEndThisCustomActionRef.Get ( );
 
 	USFXCustomAction_MantleMelee_execEndThisCustomAction_Parms EndThisCustomAction_Parms;
 
@@ -3570,10 +3282,9 @@ void USFXCustomAction_MantleMelee::EndThisCustomAction ( )
 
 void USFXCustomAction_MantleMelee::Breakout ( )
 {
-	static UFunction* pFnBreakout = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBreakoutRef { L"Function SFXGameContent.SFXCustomAction_MantleMelee.Breakout", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBreakout )
-		pFnBreakout = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_MantleMelee.Breakout" );
+	UFunction* const pFnBreakout = pFnBreakoutRef.Get ( );
 
 	USFXCustomAction_MantleMelee_execBreakout_Parms Breakout_Parms;
 
@@ -3589,10 +3300,9 @@ void USFXCustomAction_MantleMelee::Breakout ( )
 
 bool USFXCustomAction_MantleMelee::NotifyBump ( class AActor* Other, struct FVector const& HitNormal )
 {
-	static UFunction* pFnNotifyBump = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyBumpRef { L"Function SFXGameContent.SFXCustomAction_MantleMelee.NotifyBump", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyBump )
-		pFnNotifyBump = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_MantleMelee.NotifyBump" );
+	UFunction* const pFnNotifyBump = pFnNotifyBumpRef.Get ( );
 
 	USFXCustomAction_MantleMelee_execNotifyBump_Parms NotifyBump_Parms;
 	NotifyBump_Parms.Other = Other;
@@ -3615,10 +3325,9 @@ bool USFXCustomAction_MantleMelee::NotifyBump ( class AActor* Other, struct FVec
 
 void USFXCustomAction_MantleMelee::ClientDoCustomActionImpact ( class AActor* oActor, int ImpactCount, unsigned long bFirstTarget, struct FVector const& HitLocation, struct FVector const& HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnClientDoCustomActionImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoCustomActionImpactRef { L"Function SFXGameContent.SFXCustomAction_MantleMelee.ClientDoCustomActionImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoCustomActionImpact )
-		pFnClientDoCustomActionImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_MantleMelee.ClientDoCustomActionImpact" );
+	UFunction* const pFnClientDoCustomActionImpact = pFnClientDoCustomActionImpactRef.Get ( );
 
 	USFXCustomAction_MantleMelee_execClientDoCustomActionImpact_Parms ClientDoCustomActionImpact_Parms;
 	ClientDoCustomActionImpact_Parms.oActor = oActor;
@@ -3637,10 +3346,9 @@ void USFXCustomAction_MantleMelee::ClientDoCustomActionImpact ( class AActor* oA
 
 void USFXCustomAction_MantleMelee::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_MantleMelee.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_MantleMelee.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_MantleMelee_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -3653,10 +3361,9 @@ void USFXCustomAction_MantleMelee::StopCustomAction ( )
 
 void USFXCustomAction_MantleMelee::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_MantleMelee.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_MantleMelee.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_MantleMelee_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -3665,14 +3372,11 @@ void USFXCustomAction_MantleMelee::StartCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_SyncCoverGrab::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_SyncCoverGrab::pClassPointer { L"Class SFXGameContent.SFXCustomAction_SyncCoverGrab", &UObject::FindClass };
 
 class UClass* USFXCustomAction_SyncCoverGrab::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_SyncCoverGrab" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_SyncCoverGrab.StopCustomAction
@@ -3681,10 +3385,9 @@ class UClass* USFXCustomAction_SyncCoverGrab::StaticClass()
 
 void USFXCustomAction_SyncCoverGrab::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_SyncCoverGrab_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -3697,10 +3400,9 @@ void USFXCustomAction_SyncCoverGrab::StopCustomAction ( )
 
 void USFXCustomAction_SyncCoverGrab::NonSyncedAction ( )
 {
-	static UFunction* pFnNonSyncedAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNonSyncedActionRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.NonSyncedAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNonSyncedAction )
-		pFnNonSyncedAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.NonSyncedAction" );
+	UFunction* const pFnNonSyncedAction = pFnNonSyncedActionRef.Get ( );
 
 	USFXCustomAction_SyncCoverGrab_execNonSyncedAction_Parms NonSyncedAction_Parms;
 
@@ -3713,10 +3415,9 @@ void USFXCustomAction_SyncCoverGrab::NonSyncedAction ( )
 
 void USFXCustomAction_SyncCoverGrab::SyncAttack ( )
 {
-	static UFunction* pFnSyncAttack = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSyncAttackRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.SyncAttack", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSyncAttack )
-		pFnSyncAttack = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.SyncAttack" );
+	UFunction* const pFnSyncAttack = pFnSyncAttackRef.Get ( );
 
 	USFXCustomAction_SyncCoverGrab_execSyncAttack_Parms SyncAttack_Parms;
 
@@ -3730,10 +3431,9 @@ void USFXCustomAction_SyncCoverGrab::SyncAttack ( )
 
 void USFXCustomAction_SyncCoverGrab::GetVictimAnim ( struct FBodyStance* Stance )
 {
-	static UFunction* pFnGetVictimAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVictimAnimRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.GetVictimAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVictimAnim )
-		pFnGetVictimAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.GetVictimAnim" );
+	UFunction* const pFnGetVictimAnim = pFnGetVictimAnimRef.Get ( );
 
 	USFXCustomAction_SyncCoverGrab_execGetVictimAnim_Parms GetVictimAnim_Parms;
 
@@ -3753,10 +3453,9 @@ void USFXCustomAction_SyncCoverGrab::GetVictimAnim ( struct FBodyStance* Stance
 
 void USFXCustomAction_SyncCoverGrab::GetAttackerAnim ( struct FBodyStance* Stance )
 {
-	static UFunction* pFnGetAttackerAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAttackerAnimRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.GetAttackerAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAttackerAnim )
-		pFnGetAttackerAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.GetAttackerAnim" );
+	UFunction* const pFnGetAttackerAnim = pFnGetAttackerAnimRef.Get ( );
 
 	USFXCustomAction_SyncCoverGrab_execGetAttackerAnim_Parms GetAttackerAnim_Parms;
 
@@ -3776,10 +3475,9 @@ void USFXCustomAction_SyncCoverGrab::GetAttackerAnim ( struct FBodyStance* Stanc
 
 class ABioPawn* USFXCustomAction_SyncCoverGrab::GetVictimPawn ( )
 {
-	static UFunction* pFnGetVictimPawn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVictimPawnRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.GetVictimPawn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVictimPawn )
-		pFnGetVictimPawn = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.GetVictimPawn" );
+	UFunction* const pFnGetVictimPawn = pFnGetVictimPawnRef.Get ( );
 
 	USFXCustomAction_SyncCoverGrab_execGetVictimPawn_Parms GetVictimPawn_Parms;
 
@@ -3794,10 +3492,9 @@ class ABioPawn* USFXCustomAction_SyncCoverGrab::GetVictimPawn ( )
 
 void USFXCustomAction_SyncCoverGrab::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_SyncCoverGrab_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -3811,10 +3508,9 @@ void USFXCustomAction_SyncCoverGrab::StartCustomAction ( )
 
 bool USFXCustomAction_SyncCoverGrab::ShouldPlayMirrorAnim ( )
 {
-	static UFunction* pFnShouldPlayMirrorAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldPlayMirrorAnimRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.ShouldPlayMirrorAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldPlayMirrorAnim )
-		pFnShouldPlayMirrorAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.ShouldPlayMirrorAnim" );
+	UFunction* const pFnShouldPlayMirrorAnim = pFnShouldPlayMirrorAnimRef.Get ( );
 
 	USFXCustomAction_SyncCoverGrab_execShouldPlayMirrorAnim_Parms ShouldPlayMirrorAnim_Parms;
 
@@ -3832,10 +3528,9 @@ bool USFXCustomAction_SyncCoverGrab::ShouldPlayMirrorAnim ( )
 
 bool USFXCustomAction_SyncCoverGrab::VerifyVictimDestIsClear ( class ABioPawn* VictimPawn, struct FVector const& DestinationPos )
 {
-	static UFunction* pFnVerifyVictimDestIsClear = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnVerifyVictimDestIsClearRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.VerifyVictimDestIsClear", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnVerifyVictimDestIsClear )
-		pFnVerifyVictimDestIsClear = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.VerifyVictimDestIsClear" );
+	UFunction* const pFnVerifyVictimDestIsClear = pFnVerifyVictimDestIsClearRef.Get ( );
 
 	USFXCustomAction_SyncCoverGrab_execVerifyVictimDestIsClear_Parms VerifyVictimDestIsClear_Parms;
 	VerifyVictimDestIsClear_Parms.VictimPawn = VictimPawn;
@@ -3855,10 +3550,9 @@ bool USFXCustomAction_SyncCoverGrab::VerifyVictimDestIsClear ( class ABioPawn* V
 
 bool USFXCustomAction_SyncCoverGrab::InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced )
 {
-	static UFunction* pFnInternalCanDoCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalCanDoCustomActionRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.InternalCanDoCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalCanDoCustomAction )
-		pFnInternalCanDoCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.InternalCanDoCustomAction" );
+	UFunction* const pFnInternalCanDoCustomAction = pFnInternalCanDoCustomActionRef.Get ( );
 
 	USFXCustomAction_SyncCoverGrab_execInternalCanDoCustomAction_Parms InternalCanDoCustomAction_Parms;
 	InternalCanDoCustomAction_Parms.SyncPawn = SyncPawn;
@@ -3875,10 +3569,9 @@ bool USFXCustomAction_SyncCoverGrab::InternalCanDoCustomAction ( class ABioPawn*
 
 void USFXCustomAction_SyncCoverGrab::StartMeleeAttack ( )
 {
-	static UFunction* pFnStartMeleeAttack = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartMeleeAttackRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.StartMeleeAttack", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartMeleeAttack )
-		pFnStartMeleeAttack = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.StartMeleeAttack" );
+	UFunction* const pFnStartMeleeAttack = pFnStartMeleeAttackRef.Get ( );
 
 	USFXCustomAction_SyncCoverGrab_execStartMeleeAttack_Parms StartMeleeAttack_Parms;
 
@@ -3887,14 +3580,11 @@ void USFXCustomAction_SyncCoverGrab::StartMeleeAttack ( )
 
 
 
-class UClass* USFXCustomAction_SyncCoverMelee::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_SyncCoverMelee::pClassPointer { L"Class SFXGameContent.SFXCustomAction_SyncCoverMelee", &UObject::FindClass };
 
 class UClass* USFXCustomAction_SyncCoverMelee::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_SyncCoverMelee" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_SyncCoverMelee.MeleeImpact
@@ -3903,10 +3593,9 @@ class UClass* USFXCustomAction_SyncCoverMelee::StaticClass()
 
 void USFXCustomAction_SyncCoverMelee::MeleeImpact ( )
 {
-	static UFunction* pFnMeleeImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMeleeImpactRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverMelee.MeleeImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMeleeImpact )
-		pFnMeleeImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverMelee.MeleeImpact" );
+	UFunction* const pFnMeleeImpact = pFnMeleeImpactRef.Get ( );
 
 	USFXCustomAction_SyncCoverMelee_execMeleeImpact_Parms MeleeImpact_Parms;
 
@@ -3919,10 +3608,9 @@ void USFXCustomAction_SyncCoverMelee::MeleeImpact ( )
 
 void USFXCustomAction_SyncCoverMelee::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverMelee.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverMelee.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_SyncCoverMelee_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -3935,10 +3623,9 @@ void USFXCustomAction_SyncCoverMelee::StopCustomAction ( )
 
 void USFXCustomAction_SyncCoverMelee::EndThisCustomAction ( )
 {
-	static UFunction* pFnEndThisCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndThisCustomActionRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverMelee.EndThisCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndThisCustomAction )
-		pFnEndThisCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverMelee.EndThisCustomAction" );
+	UFunction* const pFnEndThisCustomAction = pFnEndThisCustomActionRef.Get ( );
 
 	USFXCustomAction_SyncCoverMelee_execEndThisCustomAction_Parms EndThisCustomAction_Parms;
 
@@ -3951,10 +3638,9 @@ void USFXCustomAction_SyncCoverMelee::EndThisCustomAction ( )
 
 void USFXCustomAction_SyncCoverMelee::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverMelee.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverMelee.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_SyncCoverMelee_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -3968,10 +3654,9 @@ void USFXCustomAction_SyncCoverMelee::StartCustomAction ( )
 
 void USFXCustomAction_SyncCoverMelee::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_SyncCoverMelee.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_SyncCoverMelee.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_SyncCoverMelee_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -3986,26 +3671,20 @@ void USFXCustomAction_SyncCoverMelee::eventGetUsedAnimNames ( TArray<struct SFXN
 
 
 
-class UClass* USFXCustomAction_StdCoverMeleeLeft::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StdCoverMeleeLeft::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StdCoverMeleeLeft", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StdCoverMeleeLeft::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StdCoverMeleeLeft" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_CoverMeleeLeft::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_CoverMeleeLeft::pClassPointer { L"Class SFXGameContent.SFXCustomAction_CoverMeleeLeft", &UObject::FindClass };
 
 class UClass* USFXCustomAction_CoverMeleeLeft::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_CoverMeleeLeft" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_CoverMeleeLeft.NonSyncedAction
@@ -4014,10 +3693,9 @@ class UClass* USFXCustomAction_CoverMeleeLeft::StaticClass()
 
 void USFXCustomAction_CoverMeleeLeft::NonSyncedAction ( )
 {
-	static UFunction* pFnNonSyncedAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNonSyncedActionRef { L"Function SFXGameContent.SFXCustomAction_CoverMeleeLeft.NonSyncedAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNonSyncedAction )
-		pFnNonSyncedAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_CoverMeleeLeft.NonSyncedAction" );
+	UFunction* const pFnNonSyncedAction = pFnNonSyncedActionRef.Get ( );
 
 	USFXCustomAction_CoverMeleeLeft_execNonSyncedAction_Parms NonSyncedAction_Parms;
 
@@ -4026,14 +3704,11 @@ void USFXCustomAction_CoverMeleeLeft::NonSyncedAction ( )
 
 
 
-class UClass* USFXCustomAction_CoverMeleeRight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_CoverMeleeRight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_CoverMeleeRight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_CoverMeleeRight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_CoverMeleeRight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_CoverMeleeRight.GetVictimPawn
@@ -4043,10 +3718,9 @@ class UClass* USFXCustomAction_CoverMeleeRight::StaticClass()
 
 class ABioPawn* USFXCustomAction_CoverMeleeRight::GetVictimPawn ( )
 {
-	static UFunction* pFnGetVictimPawn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVictimPawnRef { L"Function SFXGameContent.SFXCustomAction_CoverMeleeRight.GetVictimPawn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVictimPawn )
-		pFnGetVictimPawn = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_CoverMeleeRight.GetVictimPawn" );
+	UFunction* const pFnGetVictimPawn = pFnGetVictimPawnRef.Get ( );
 
 	USFXCustomAction_CoverMeleeRight_execGetVictimPawn_Parms GetVictimPawn_Parms;
 
@@ -4062,10 +3736,9 @@ class ABioPawn* USFXCustomAction_CoverMeleeRight::GetVictimPawn ( )
 
 void USFXCustomAction_CoverMeleeRight::GetMeleeImpactParameters ( struct FAreaEffectParameters* ImpactParams )
 {
-	static UFunction* pFnGetMeleeImpactParameters = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetMeleeImpactParametersRef { L"Function SFXGameContent.SFXCustomAction_CoverMeleeRight.GetMeleeImpactParameters", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetMeleeImpactParameters )
-		pFnGetMeleeImpactParameters = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_CoverMeleeRight.GetMeleeImpactParameters" );
+	UFunction* const pFnGetMeleeImpactParameters = pFnGetMeleeImpactParametersRef.Get ( );
 
 	USFXCustomAction_CoverMeleeRight_execGetMeleeImpactParameters_Parms GetMeleeImpactParameters_Parms;
 
@@ -4084,10 +3757,9 @@ void USFXCustomAction_CoverMeleeRight::GetMeleeImpactParameters ( struct FAreaEf
 
 void USFXCustomAction_CoverMeleeRight::NonSyncedAction ( )
 {
-	static UFunction* pFnNonSyncedAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNonSyncedActionRef { L"Function SFXGameContent.SFXCustomAction_CoverMeleeRight.NonSyncedAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNonSyncedAction )
-		pFnNonSyncedAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_CoverMeleeRight.NonSyncedAction" );
+	UFunction* const pFnNonSyncedAction = pFnNonSyncedActionRef.Get ( );
 
 	USFXCustomAction_CoverMeleeRight_execNonSyncedAction_Parms NonSyncedAction_Parms;
 
@@ -4096,38 +3768,29 @@ void USFXCustomAction_CoverMeleeRight::NonSyncedAction ( )
 
 
 
-class UClass* USFXCustomAction_StdCoverMeleeRight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StdCoverMeleeRight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StdCoverMeleeRight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StdCoverMeleeRight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StdCoverMeleeRight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_HvyStdCoverMeleeLeft::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HvyStdCoverMeleeLeft::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HvyStdCoverMeleeLeft", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HvyStdCoverMeleeLeft::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HvyStdCoverMeleeLeft" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_HvyCoverMeleeLeft::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HvyCoverMeleeLeft::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HvyCoverMeleeLeft", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HvyCoverMeleeLeft::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HvyCoverMeleeLeft" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_HvyCoverMeleeLeft.NonSyncedAction
@@ -4136,10 +3799,9 @@ class UClass* USFXCustomAction_HvyCoverMeleeLeft::StaticClass()
 
 void USFXCustomAction_HvyCoverMeleeLeft::NonSyncedAction ( )
 {
-	static UFunction* pFnNonSyncedAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNonSyncedActionRef { L"Function SFXGameContent.SFXCustomAction_HvyCoverMeleeLeft.NonSyncedAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNonSyncedAction )
-		pFnNonSyncedAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HvyCoverMeleeLeft.NonSyncedAction" );
+	UFunction* const pFnNonSyncedAction = pFnNonSyncedActionRef.Get ( );
 
 	USFXCustomAction_HvyCoverMeleeLeft_execNonSyncedAction_Parms NonSyncedAction_Parms;
 
@@ -4148,14 +3810,11 @@ void USFXCustomAction_HvyCoverMeleeLeft::NonSyncedAction ( )
 
 
 
-class UClass* USFXCustomAction_HvyCoverMeleeRight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HvyCoverMeleeRight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HvyCoverMeleeRight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HvyCoverMeleeRight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HvyCoverMeleeRight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_HvyCoverMeleeRight.GetVictimPawn
@@ -4165,10 +3824,9 @@ class UClass* USFXCustomAction_HvyCoverMeleeRight::StaticClass()
 
 class ABioPawn* USFXCustomAction_HvyCoverMeleeRight::GetVictimPawn ( )
 {
-	static UFunction* pFnGetVictimPawn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetVictimPawnRef { L"Function SFXGameContent.SFXCustomAction_HvyCoverMeleeRight.GetVictimPawn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetVictimPawn )
-		pFnGetVictimPawn = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HvyCoverMeleeRight.GetVictimPawn" );
+	UFunction* const pFnGetVictimPawn = pFnGetVictimPawnRef.Get ( );
 
 	USFXCustomAction_HvyCoverMeleeRight_execGetVictimPawn_Parms GetVictimPawn_Parms;
 
@@ -4184,10 +3842,9 @@ class ABioPawn* USFXCustomAction_HvyCoverMeleeRight::GetVictimPawn ( )
 
 void USFXCustomAction_HvyCoverMeleeRight::GetMeleeImpactParameters ( struct FAreaEffectParameters* ImpactParams )
 {
-	static UFunction* pFnGetMeleeImpactParameters = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetMeleeImpactParametersRef { L"Function SFXGameContent.SFXCustomAction_HvyCoverMeleeRight.GetMeleeImpactParameters", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetMeleeImpactParameters )
-		pFnGetMeleeImpactParameters = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HvyCoverMeleeRight.GetMeleeImpactParameters" );
+	UFunction* const pFnGetMeleeImpactParameters = pFnGetMeleeImpactParametersRef.Get ( );
 
 	USFXCustomAction_HvyCoverMeleeRight_execGetMeleeImpactParameters_Parms GetMeleeImpactParameters_Parms;
 
@@ -4206,10 +3863,9 @@ void USFXCustomAction_HvyCoverMeleeRight::GetMeleeImpactParameters ( struct FAre
 
 void USFXCustomAction_HvyCoverMeleeRight::NonSyncedAction ( )
 {
-	static UFunction* pFnNonSyncedAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNonSyncedActionRef { L"Function SFXGameContent.SFXCustomAction_HvyCoverMeleeRight.NonSyncedAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNonSyncedAction )
-		pFnNonSyncedAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HvyCoverMeleeRight.NonSyncedAction" );
+	UFunction* const pFnNonSyncedAction = pFnNonSyncedActionRef.Get ( );
 
 	USFXCustomAction_HvyCoverMeleeRight_execNonSyncedAction_Parms NonSyncedAction_Parms;
 
@@ -4218,26 +3874,20 @@ void USFXCustomAction_HvyCoverMeleeRight::NonSyncedAction ( )
 
 
 
-class UClass* USFXCustomAction_HvyStdCoverMeleeRight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HvyStdCoverMeleeRight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HvyStdCoverMeleeRight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HvyStdCoverMeleeRight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HvyStdCoverMeleeRight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_RifleMeleeOne::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_RifleMeleeOne::pClassPointer { L"Class SFXGameContent.SFXCustomAction_RifleMeleeOne", &UObject::FindClass };
 
 class UClass* USFXCustomAction_RifleMeleeOne::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_RifleMeleeOne" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_RifleMeleeOne.StopMove
@@ -4246,10 +3896,9 @@ class UClass* USFXCustomAction_RifleMeleeOne::StaticClass()
 
 void USFXCustomAction_RifleMeleeOne::StopMove ( )
 {
-	static UFunction* pFnStopMove = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopMoveRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.StopMove", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopMove )
-		pFnStopMove = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.StopMove" );
+	UFunction* const pFnStopMove = pFnStopMoveRef.Get ( );
 
 	USFXCustomAction_RifleMeleeOne_execStopMove_Parms StopMove_Parms;
 
@@ -4268,10 +3917,9 @@ void USFXCustomAction_RifleMeleeOne::StopMove ( )
 
 bool USFXCustomAction_RifleMeleeOne::OnActorImpacted ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnActorImpacted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnActorImpactedRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.OnActorImpacted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnActorImpacted )
-		pFnOnActorImpacted = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.OnActorImpacted" );
+	UFunction* const pFnOnActorImpacted = pFnOnActorImpactedRef.Get ( );
 
 	USFXCustomAction_RifleMeleeOne_execOnActorImpacted_Parms OnActorImpacted_Parms;
 	OnActorImpacted_Parms.Resistance = Resistance;
@@ -4297,10 +3945,9 @@ bool USFXCustomAction_RifleMeleeOne::OnActorImpacted ( unsigned char Resistance,
 
 void USFXCustomAction_RifleMeleeOne::ReplicateImpact ( class ABioPawn* Target, int ImpactCount, unsigned long bFirstTarget, struct FVector const& HitLocation, struct FVector const& HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnReplicateImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReplicateImpactRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.ReplicateImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReplicateImpact )
-		pFnReplicateImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.ReplicateImpact" );
+	UFunction* const pFnReplicateImpact = pFnReplicateImpactRef.Get ( );
 
 	USFXCustomAction_RifleMeleeOne_execReplicateImpact_Parms ReplicateImpact_Parms;
 	ReplicateImpact_Parms.Target = Target;
@@ -4319,10 +3966,9 @@ void USFXCustomAction_RifleMeleeOne::ReplicateImpact ( class ABioPawn* Target, i
 
 void USFXCustomAction_RifleMeleeOne::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_RifleMeleeOne_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -4335,10 +3981,9 @@ void USFXCustomAction_RifleMeleeOne::StopCustomAction ( )
 
 void USFXCustomAction_RifleMeleeOne::EndAction ( )
 {
-	static UFunction* pFnEndAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndActionRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.EndAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndAction )
-		pFnEndAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.EndAction" );
+	UFunction* const pFnEndAction = pFnEndActionRef.Get ( );
 
 	USFXCustomAction_RifleMeleeOne_execEndAction_Parms EndAction_Parms;
 
@@ -4351,10 +3996,9 @@ void USFXCustomAction_RifleMeleeOne::EndAction ( )
 
 void USFXCustomAction_RifleMeleeOne::HeavyMelee ( )
 {
-	static UFunction* pFnHeavyMelee = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHeavyMeleeRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.HeavyMelee", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHeavyMelee )
-		pFnHeavyMelee = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.HeavyMelee" );
+	UFunction* const pFnHeavyMelee = pFnHeavyMeleeRef.Get ( );
 
 	USFXCustomAction_RifleMeleeOne_execHeavyMelee_Parms HeavyMelee_Parms;
 
@@ -4367,10 +4011,9 @@ void USFXCustomAction_RifleMeleeOne::HeavyMelee ( )
 
 void USFXCustomAction_RifleMeleeOne::NoHeavyMelee ( )
 {
-	static UFunction* pFnNoHeavyMelee = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNoHeavyMeleeRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.NoHeavyMelee", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNoHeavyMelee )
-		pFnNoHeavyMelee = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.NoHeavyMelee" );
+	UFunction* const pFnNoHeavyMelee = pFnNoHeavyMeleeRef.Get ( );
 
 	USFXCustomAction_RifleMeleeOne_execNoHeavyMelee_Parms NoHeavyMelee_Parms;
 
@@ -4383,10 +4026,9 @@ void USFXCustomAction_RifleMeleeOne::NoHeavyMelee ( )
 
 void USFXCustomAction_RifleMeleeOne::DoRifleMeleeTwo ( )
 {
-	static UFunction* pFnDoRifleMeleeTwo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoRifleMeleeTwoRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.DoRifleMeleeTwo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoRifleMeleeTwo )
-		pFnDoRifleMeleeTwo = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.DoRifleMeleeTwo" );
+	UFunction* const pFnDoRifleMeleeTwo = pFnDoRifleMeleeTwoRef.Get ( );
 
 	USFXCustomAction_RifleMeleeOne_execDoRifleMeleeTwo_Parms DoRifleMeleeTwo_Parms;
 
@@ -4399,10 +4041,9 @@ void USFXCustomAction_RifleMeleeOne::DoRifleMeleeTwo ( )
 
 void USFXCustomAction_RifleMeleeOne::RifleMeleeSecondary ( )
 {
-	static UFunction* pFnRifleMeleeSecondary = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRifleMeleeSecondaryRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.RifleMeleeSecondary", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRifleMeleeSecondary )
-		pFnRifleMeleeSecondary = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.RifleMeleeSecondary" );
+	UFunction* const pFnRifleMeleeSecondary = pFnRifleMeleeSecondaryRef.Get ( );
 
 	USFXCustomAction_RifleMeleeOne_execRifleMeleeSecondary_Parms RifleMeleeSecondary_Parms;
 
@@ -4415,10 +4056,9 @@ void USFXCustomAction_RifleMeleeOne::RifleMeleeSecondary ( )
 
 void USFXCustomAction_RifleMeleeOne::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_RifleMeleeOne_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -4427,14 +4067,11 @@ void USFXCustomAction_RifleMeleeOne::StartCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_RifleMeleeTwo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_RifleMeleeTwo::pClassPointer { L"Class SFXGameContent.SFXCustomAction_RifleMeleeTwo", &UObject::FindClass };
 
 class UClass* USFXCustomAction_RifleMeleeTwo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_RifleMeleeTwo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.ReplicateImpact
@@ -4449,10 +4086,9 @@ class UClass* USFXCustomAction_RifleMeleeTwo::StaticClass()
 
 void USFXCustomAction_RifleMeleeTwo::ReplicateImpact ( class ABioPawn* Target, int ImpactCount, unsigned long bFirstTarget, struct FVector const& HitLocation, struct FVector const& HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnReplicateImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReplicateImpactRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.ReplicateImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReplicateImpact )
-		pFnReplicateImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.ReplicateImpact" );
+	UFunction* const pFnReplicateImpact = pFnReplicateImpactRef.Get ( );
 
 	USFXCustomAction_RifleMeleeTwo_execReplicateImpact_Parms ReplicateImpact_Parms;
 	ReplicateImpact_Parms.Target = Target;
@@ -4471,10 +4107,9 @@ void USFXCustomAction_RifleMeleeTwo::ReplicateImpact ( class ABioPawn* Target, i
 
 void USFXCustomAction_RifleMeleeTwo::HeavyMelee ( )
 {
-	static UFunction* pFnHeavyMelee = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHeavyMeleeRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.HeavyMelee", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHeavyMelee )
-		pFnHeavyMelee = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.HeavyMelee" );
+	UFunction* const pFnHeavyMelee = pFnHeavyMeleeRef.Get ( );
 
 	USFXCustomAction_RifleMeleeTwo_execHeavyMelee_Parms HeavyMelee_Parms;
 
@@ -4487,10 +4122,9 @@ void USFXCustomAction_RifleMeleeTwo::HeavyMelee ( )
 
 void USFXCustomAction_RifleMeleeTwo::NoHeavyMelee ( )
 {
-	static UFunction* pFnNoHeavyMelee = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNoHeavyMeleeRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.NoHeavyMelee", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNoHeavyMelee )
-		pFnNoHeavyMelee = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.NoHeavyMelee" );
+	UFunction* const pFnNoHeavyMelee = pFnNoHeavyMeleeRef.Get ( );
 
 	USFXCustomAction_RifleMeleeTwo_execNoHeavyMelee_Parms NoHeavyMelee_Parms;
 
@@ -4503,10 +4137,9 @@ void USFXCustomAction_RifleMeleeTwo::NoHeavyMelee ( )
 
 void USFXCustomAction_RifleMeleeTwo::DoRifleMeleeThree ( )
 {
-	static UFunction* pFnDoRifleMeleeThree = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoRifleMeleeThreeRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.DoRifleMeleeThree", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoRifleMeleeThree )
-		pFnDoRifleMeleeThree = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.DoRifleMeleeThree" );
+	UFunction* const pFnDoRifleMeleeThree = pFnDoRifleMeleeThreeRef.Get ( );
 
 	USFXCustomAction_RifleMeleeTwo_execDoRifleMeleeThree_Parms DoRifleMeleeThree_Parms;
 
@@ -4519,10 +4152,9 @@ void USFXCustomAction_RifleMeleeTwo::DoRifleMeleeThree ( )
 
 void USFXCustomAction_RifleMeleeTwo::RifleMeleeThird ( )
 {
-	static UFunction* pFnRifleMeleeThird = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRifleMeleeThirdRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.RifleMeleeThird", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRifleMeleeThird )
-		pFnRifleMeleeThird = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.RifleMeleeThird" );
+	UFunction* const pFnRifleMeleeThird = pFnRifleMeleeThirdRef.Get ( );
 
 	USFXCustomAction_RifleMeleeTwo_execRifleMeleeThird_Parms RifleMeleeThird_Parms;
 
@@ -4531,14 +4163,11 @@ void USFXCustomAction_RifleMeleeTwo::RifleMeleeThird ( )
 
 
 
-class UClass* USFXCustomAction_RifleMeleeThree::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_RifleMeleeThree::pClassPointer { L"Class SFXGameContent.SFXCustomAction_RifleMeleeThree", &UObject::FindClass };
 
 class UClass* USFXCustomAction_RifleMeleeThree::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_RifleMeleeThree" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_RifleMeleeThree.StopCustomAction
@@ -4547,10 +4176,9 @@ class UClass* USFXCustomAction_RifleMeleeThree::StaticClass()
 
 void USFXCustomAction_RifleMeleeThree::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeThree.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeThree.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_RifleMeleeThree_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -4563,10 +4191,9 @@ void USFXCustomAction_RifleMeleeThree::StopCustomAction ( )
 
 void USFXCustomAction_RifleMeleeThree::HeavyMelee ( )
 {
-	static UFunction* pFnHeavyMelee = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHeavyMeleeRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeThree.HeavyMelee", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHeavyMelee )
-		pFnHeavyMelee = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeThree.HeavyMelee" );
+	UFunction* const pFnHeavyMelee = pFnHeavyMeleeRef.Get ( );
 
 	USFXCustomAction_RifleMeleeThree_execHeavyMelee_Parms HeavyMelee_Parms;
 
@@ -4579,10 +4206,9 @@ void USFXCustomAction_RifleMeleeThree::HeavyMelee ( )
 
 void USFXCustomAction_RifleMeleeThree::NoHeavyMelee ( )
 {
-	static UFunction* pFnNoHeavyMelee = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNoHeavyMeleeRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeThree.NoHeavyMelee", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNoHeavyMelee )
-		pFnNoHeavyMelee = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeThree.NoHeavyMelee" );
+	UFunction* const pFnNoHeavyMelee = pFnNoHeavyMeleeRef.Get ( );
 
 	USFXCustomAction_RifleMeleeThree_execNoHeavyMelee_Parms NoHeavyMelee_Parms;
 
@@ -4595,10 +4221,9 @@ void USFXCustomAction_RifleMeleeThree::NoHeavyMelee ( )
 
 void USFXCustomAction_RifleMeleeThree::RifleMeleeThird ( )
 {
-	static UFunction* pFnRifleMeleeThird = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRifleMeleeThirdRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeThree.RifleMeleeThird", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRifleMeleeThird )
-		pFnRifleMeleeThird = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeThree.RifleMeleeThird" );
+	UFunction* const pFnRifleMeleeThird = pFnRifleMeleeThirdRef.Get ( );
 
 	USFXCustomAction_RifleMeleeThree_execRifleMeleeThird_Parms RifleMeleeThird_Parms;
 
@@ -4617,10 +4242,9 @@ void USFXCustomAction_RifleMeleeThree::RifleMeleeThird ( )
 
 void USFXCustomAction_RifleMeleeThree::ReplicateImpact ( class ABioPawn* Target, int ImpactCount, unsigned long bFirstTarget, struct FVector const& HitLocation, struct FVector const& HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnReplicateImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReplicateImpactRef { L"Function SFXGameContent.SFXCustomAction_RifleMeleeThree.ReplicateImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReplicateImpact )
-		pFnReplicateImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_RifleMeleeThree.ReplicateImpact" );
+	UFunction* const pFnReplicateImpact = pFnReplicateImpactRef.Get ( );
 
 	USFXCustomAction_RifleMeleeThree_execReplicateImpact_Parms ReplicateImpact_Parms;
 	ReplicateImpact_Parms.Target = Target;
@@ -4635,14 +4259,11 @@ void USFXCustomAction_RifleMeleeThree::ReplicateImpact ( class ABioPawn* Target,
 
 
 
-class UClass* USFXCustomAction_PistolMeleeOne::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PistolMeleeOne::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PistolMeleeOne", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PistolMeleeOne::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PistolMeleeOne" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_PistolMeleeOne.StopMove
@@ -4651,10 +4272,9 @@ class UClass* USFXCustomAction_PistolMeleeOne::StaticClass()
 
 void USFXCustomAction_PistolMeleeOne::StopMove ( )
 {
-	static UFunction* pFnStopMove = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopMoveRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.StopMove", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopMove )
-		pFnStopMove = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.StopMove" );
+	UFunction* const pFnStopMove = pFnStopMoveRef.Get ( );
 
 	USFXCustomAction_PistolMeleeOne_execStopMove_Parms StopMove_Parms;
 
@@ -4673,10 +4293,9 @@ void USFXCustomAction_PistolMeleeOne::StopMove ( )
 
 bool USFXCustomAction_PistolMeleeOne::OnActorImpacted ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnActorImpacted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnActorImpactedRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.OnActorImpacted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnActorImpacted )
-		pFnOnActorImpacted = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.OnActorImpacted" );
+	UFunction* const pFnOnActorImpacted = pFnOnActorImpactedRef.Get ( );
 
 	USFXCustomAction_PistolMeleeOne_execOnActorImpacted_Parms OnActorImpacted_Parms;
 	OnActorImpacted_Parms.Resistance = Resistance;
@@ -4702,10 +4321,9 @@ bool USFXCustomAction_PistolMeleeOne::OnActorImpacted ( unsigned char Resistance
 
 void USFXCustomAction_PistolMeleeOne::ReplicateImpact ( class ABioPawn* Target, int ImpactCount, unsigned long bFirstTarget, struct FVector const& HitLocation, struct FVector const& HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnReplicateImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReplicateImpactRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.ReplicateImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReplicateImpact )
-		pFnReplicateImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.ReplicateImpact" );
+	UFunction* const pFnReplicateImpact = pFnReplicateImpactRef.Get ( );
 
 	USFXCustomAction_PistolMeleeOne_execReplicateImpact_Parms ReplicateImpact_Parms;
 	ReplicateImpact_Parms.Target = Target;
@@ -4724,10 +4342,9 @@ void USFXCustomAction_PistolMeleeOne::ReplicateImpact ( class ABioPawn* Target,
 
 void USFXCustomAction_PistolMeleeOne::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_PistolMeleeOne_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -4740,10 +4357,9 @@ void USFXCustomAction_PistolMeleeOne::StopCustomAction ( )
 
 void USFXCustomAction_PistolMeleeOne::EndAction ( )
 {
-	static UFunction* pFnEndAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndActionRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.EndAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndAction )
-		pFnEndAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.EndAction" );
+	UFunction* const pFnEndAction = pFnEndActionRef.Get ( );
 
 	USFXCustomAction_PistolMeleeOne_execEndAction_Parms EndAction_Parms;
 
@@ -4756,10 +4372,9 @@ void USFXCustomAction_PistolMeleeOne::EndAction ( )
 
 void USFXCustomAction_PistolMeleeOne::HeavyMelee ( )
 {
-	static UFunction* pFnHeavyMelee = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHeavyMeleeRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.HeavyMelee", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHeavyMelee )
-		pFnHeavyMelee = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.HeavyMelee" );
+	UFunction* const pFnHeavyMelee = pFnHeavyMeleeRef.Get ( );
 
 	USFXCustomAction_PistolMeleeOne_execHeavyMelee_Parms HeavyMelee_Parms;
 
@@ -4772,10 +4387,9 @@ void USFXCustomAction_PistolMeleeOne::HeavyMelee ( )
 
 void USFXCustomAction_PistolMeleeOne::NoHeavyMelee ( )
 {
-	static UFunction* pFnNoHeavyMelee = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNoHeavyMeleeRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.NoHeavyMelee", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNoHeavyMelee )
-		pFnNoHeavyMelee = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.NoHeavyMelee" );
+	UFunction* const pFnNoHeavyMelee = pFnNoHeavyMeleeRef.Get ( );
 
 	USFXCustomAction_PistolMeleeOne_execNoHeavyMelee_Parms NoHeavyMelee_Parms;
 
@@ -4788,10 +4402,9 @@ void USFXCustomAction_PistolMeleeOne::NoHeavyMelee ( )
 
 void USFXCustomAction_PistolMeleeOne::DoPistolMeleeTwo ( )
 {
-	static UFunction* pFnDoPistolMeleeTwo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoPistolMeleeTwoRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.DoPistolMeleeTwo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoPistolMeleeTwo )
-		pFnDoPistolMeleeTwo = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.DoPistolMeleeTwo" );
+	UFunction* const pFnDoPistolMeleeTwo = pFnDoPistolMeleeTwoRef.Get ( );
 
 	USFXCustomAction_PistolMeleeOne_execDoPistolMeleeTwo_Parms DoPistolMeleeTwo_Parms;
 
@@ -4804,10 +4417,9 @@ void USFXCustomAction_PistolMeleeOne::DoPistolMeleeTwo ( )
 
 void USFXCustomAction_PistolMeleeOne::PistolMeleeSecondary ( )
 {
-	static UFunction* pFnPistolMeleeSecondary = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPistolMeleeSecondaryRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.PistolMeleeSecondary", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPistolMeleeSecondary )
-		pFnPistolMeleeSecondary = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.PistolMeleeSecondary" );
+	UFunction* const pFnPistolMeleeSecondary = pFnPistolMeleeSecondaryRef.Get ( );
 
 	USFXCustomAction_PistolMeleeOne_execPistolMeleeSecondary_Parms PistolMeleeSecondary_Parms;
 
@@ -4820,10 +4432,9 @@ void USFXCustomAction_PistolMeleeOne::PistolMeleeSecondary ( )
 
 void USFXCustomAction_PistolMeleeOne::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_PistolMeleeOne_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -4832,14 +4443,11 @@ void USFXCustomAction_PistolMeleeOne::StartCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_PistolMeleeTwo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PistolMeleeTwo::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PistolMeleeTwo", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PistolMeleeTwo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PistolMeleeTwo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.ReplicateImpact
@@ -4854,10 +4462,9 @@ class UClass* USFXCustomAction_PistolMeleeTwo::StaticClass()
 
 void USFXCustomAction_PistolMeleeTwo::ReplicateImpact ( class ABioPawn* Target, int ImpactCount, unsigned long bFirstTarget, struct FVector const& HitLocation, struct FVector const& HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnReplicateImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReplicateImpactRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.ReplicateImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReplicateImpact )
-		pFnReplicateImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.ReplicateImpact" );
+	UFunction* const pFnReplicateImpact = pFnReplicateImpactRef.Get ( );
 
 	USFXCustomAction_PistolMeleeTwo_execReplicateImpact_Parms ReplicateImpact_Parms;
 	ReplicateImpact_Parms.Target = Target;
@@ -4876,10 +4483,9 @@ void USFXCustomAction_PistolMeleeTwo::ReplicateImpact ( class ABioPawn* Target,
 
 void USFXCustomAction_PistolMeleeTwo::HeavyMelee ( )
 {
-	static UFunction* pFnHeavyMelee = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHeavyMeleeRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.HeavyMelee", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHeavyMelee )
-		pFnHeavyMelee = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.HeavyMelee" );
+	UFunction* const pFnHeavyMelee = pFnHeavyMeleeRef.Get ( );
 
 	USFXCustomAction_PistolMeleeTwo_execHeavyMelee_Parms HeavyMelee_Parms;
 
@@ -4892,10 +4498,9 @@ void USFXCustomAction_PistolMeleeTwo::HeavyMelee ( )
 
 void USFXCustomAction_PistolMeleeTwo::NoHeavyMelee ( )
 {
-	static UFunction* pFnNoHeavyMelee = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNoHeavyMeleeRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.NoHeavyMelee", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNoHeavyMelee )
-		pFnNoHeavyMelee = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.NoHeavyMelee" );
+	UFunction* const pFnNoHeavyMelee = pFnNoHeavyMeleeRef.Get ( );
 
 	USFXCustomAction_PistolMeleeTwo_execNoHeavyMelee_Parms NoHeavyMelee_Parms;
 
@@ -4908,10 +4513,9 @@ void USFXCustomAction_PistolMeleeTwo::NoHeavyMelee ( )
 
 void USFXCustomAction_PistolMeleeTwo::DoPistolMeleeThree ( )
 {
-	static UFunction* pFnDoPistolMeleeThree = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoPistolMeleeThreeRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.DoPistolMeleeThree", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoPistolMeleeThree )
-		pFnDoPistolMeleeThree = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.DoPistolMeleeThree" );
+	UFunction* const pFnDoPistolMeleeThree = pFnDoPistolMeleeThreeRef.Get ( );
 
 	USFXCustomAction_PistolMeleeTwo_execDoPistolMeleeThree_Parms DoPistolMeleeThree_Parms;
 
@@ -4924,10 +4528,9 @@ void USFXCustomAction_PistolMeleeTwo::DoPistolMeleeThree ( )
 
 void USFXCustomAction_PistolMeleeTwo::PistolMeleeThird ( )
 {
-	static UFunction* pFnPistolMeleeThird = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPistolMeleeThirdRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.PistolMeleeThird", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPistolMeleeThird )
-		pFnPistolMeleeThird = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.PistolMeleeThird" );
+	UFunction* const pFnPistolMeleeThird = pFnPistolMeleeThirdRef.Get ( );
 
 	USFXCustomAction_PistolMeleeTwo_execPistolMeleeThird_Parms PistolMeleeThird_Parms;
 
@@ -4936,14 +4539,11 @@ void USFXCustomAction_PistolMeleeTwo::PistolMeleeThird ( )
 
 
 
-class UClass* USFXCustomAction_PistolMeleeThree::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PistolMeleeThree::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PistolMeleeThree", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PistolMeleeThree::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PistolMeleeThree" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_PistolMeleeThree.StopCustomAction
@@ -4952,10 +4552,9 @@ class UClass* USFXCustomAction_PistolMeleeThree::StaticClass()
 
 void USFXCustomAction_PistolMeleeThree::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeThree.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeThree.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_PistolMeleeThree_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -4968,10 +4567,9 @@ void USFXCustomAction_PistolMeleeThree::StopCustomAction ( )
 
 void USFXCustomAction_PistolMeleeThree::HeavyMelee ( )
 {
-	static UFunction* pFnHeavyMelee = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHeavyMeleeRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeThree.HeavyMelee", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHeavyMelee )
-		pFnHeavyMelee = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeThree.HeavyMelee" );
+	UFunction* const pFnHeavyMelee = pFnHeavyMeleeRef.Get ( );
 
 	USFXCustomAction_PistolMeleeThree_execHeavyMelee_Parms HeavyMelee_Parms;
 
@@ -4984,10 +4582,9 @@ void USFXCustomAction_PistolMeleeThree::HeavyMelee ( )
 
 void USFXCustomAction_PistolMeleeThree::NoHeavyMelee ( )
 {
-	static UFunction* pFnNoHeavyMelee = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNoHeavyMeleeRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeThree.NoHeavyMelee", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNoHeavyMelee )
-		pFnNoHeavyMelee = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeThree.NoHeavyMelee" );
+	UFunction* const pFnNoHeavyMelee = pFnNoHeavyMeleeRef.Get ( );
 
 	USFXCustomAction_PistolMeleeThree_execNoHeavyMelee_Parms NoHeavyMelee_Parms;
 
@@ -5000,10 +4597,9 @@ void USFXCustomAction_PistolMeleeThree::NoHeavyMelee ( )
 
 void USFXCustomAction_PistolMeleeThree::PistolMeleeThird ( )
 {
-	static UFunction* pFnPistolMeleeThird = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPistolMeleeThirdRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeThree.PistolMeleeThird", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPistolMeleeThird )
-		pFnPistolMeleeThird = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeThree.PistolMeleeThird" );
+	UFunction* const pFnPistolMeleeThird = pFnPistolMeleeThirdRef.Get ( );
 
 	USFXCustomAction_PistolMeleeThree_execPistolMeleeThird_Parms PistolMeleeThird_Parms;
 
@@ -5022,10 +4618,9 @@ void USFXCustomAction_PistolMeleeThree::PistolMeleeThird ( )
 
 void USFXCustomAction_PistolMeleeThree::ReplicateImpact ( class ABioPawn* Target, int ImpactCount, unsigned long bFirstTarget, struct FVector const& HitLocation, struct FVector const& HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnReplicateImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReplicateImpactRef { L"Function SFXGameContent.SFXCustomAction_PistolMeleeThree.ReplicateImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReplicateImpact )
-		pFnReplicateImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_PistolMeleeThree.ReplicateImpact" );
+	UFunction* const pFnReplicateImpact = pFnReplicateImpactRef.Get ( );
 
 	USFXCustomAction_PistolMeleeThree_execReplicateImpact_Parms ReplicateImpact_Parms;
 	ReplicateImpact_Parms.Target = Target;
@@ -5040,170 +4635,128 @@ void USFXCustomAction_PistolMeleeThree::ReplicateImpact ( class ABioPawn* Target
 
 
 
-class UClass* USFXCustomAction_PlayerStandardImpact::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerStandardImpact::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerStandardImpact", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerStandardImpact::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerStandardImpact" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_PlayerStandardImpactForward::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerStandardImpactForward::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerStandardImpactForward", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerStandardImpactForward::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerStandardImpactForward" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_PlayerStandardImpactLeft::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerStandardImpactLeft::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerStandardImpactLeft", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerStandardImpactLeft::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerStandardImpactLeft" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_PlayerStandardImpactRight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerStandardImpactRight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerStandardImpactRight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerStandardImpactRight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerStandardImpactRight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_PlayerMeleed::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerMeleed::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerMeleed", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerMeleed::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerMeleed" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_KnockbackImpactForward::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_KnockbackImpactForward::pClassPointer { L"Class SFXGameContent.SFXCustomAction_KnockbackImpactForward", &UObject::FindClass };
 
 class UClass* USFXCustomAction_KnockbackImpactForward::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_KnockbackImpactForward" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_MeleedLeft::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_MeleedLeft::pClassPointer { L"Class SFXGameContent.SFXCustomAction_MeleedLeft", &UObject::FindClass };
 
 class UClass* USFXCustomAction_MeleedLeft::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_MeleedLeft" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_MeleedRight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_MeleedRight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_MeleedRight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_MeleedRight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_MeleedRight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_KnockbackImpact::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_KnockbackImpact::pClassPointer { L"Class SFXGameContent.SFXCustomAction_KnockbackImpact", &UObject::FindClass };
 
 class UClass* USFXCustomAction_KnockbackImpact::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_KnockbackImpact" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_KnockbackImpactLeft::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_KnockbackImpactLeft::pClassPointer { L"Class SFXGameContent.SFXCustomAction_KnockbackImpactLeft", &UObject::FindClass };
 
 class UClass* USFXCustomAction_KnockbackImpactLeft::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_KnockbackImpactLeft" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_KnockbackImpactRight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_KnockbackImpactRight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_KnockbackImpactRight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_KnockbackImpactRight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_KnockbackImpactRight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_MeleedForward::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_MeleedForward::pClassPointer { L"Class SFXGameContent.SFXCustomAction_MeleedForward", &UObject::FindClass };
 
 class UClass* USFXCustomAction_MeleedForward::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_MeleedForward" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_FlinchLight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_FlinchLight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_FlinchLight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_FlinchLight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_FlinchLight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_FlinchBase::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_FlinchBase::pClassPointer { L"Class SFXGameContent.SFXCustomAction_FlinchBase", &UObject::FindClass };
 
 class UClass* USFXCustomAction_FlinchBase::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_FlinchBase" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_FlinchBase.PlayImpactSound
@@ -5212,10 +4765,9 @@ class UClass* USFXCustomAction_FlinchBase::StaticClass()
 
 void USFXCustomAction_FlinchBase::PlayImpactSound ( )
 {
-	static UFunction* pFnPlayImpactSound = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayImpactSoundRef { L"Function SFXGameContent.SFXCustomAction_FlinchBase.PlayImpactSound", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayImpactSound )
-		pFnPlayImpactSound = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_FlinchBase.PlayImpactSound" );
+	UFunction* const pFnPlayImpactSound = pFnPlayImpactSoundRef.Get ( );
 
 	USFXCustomAction_FlinchBase_execPlayImpactSound_Parms PlayImpactSound_Parms;
 
@@ -5228,10 +4780,9 @@ void USFXCustomAction_FlinchBase::PlayImpactSound ( )
 
 void USFXCustomAction_FlinchBase::PlayWhizSound ( )
 {
-	static UFunction* pFnPlayWhizSound = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayWhizSoundRef { L"Function SFXGameContent.SFXCustomAction_FlinchBase.PlayWhizSound", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayWhizSound )
-		pFnPlayWhizSound = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_FlinchBase.PlayWhizSound" );
+	UFunction* const pFnPlayWhizSound = pFnPlayWhizSoundRef.Get ( );
 
 	USFXCustomAction_FlinchBase_execPlayWhizSound_Parms PlayWhizSound_Parms;
 
@@ -5244,10 +4795,9 @@ void USFXCustomAction_FlinchBase::PlayWhizSound ( )
 
 void USFXCustomAction_FlinchBase::FlinchActionOverride ( )
 {
-	static UFunction* pFnFlinchActionOverride = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFlinchActionOverrideRef { L"Function SFXGameContent.SFXCustomAction_FlinchBase.FlinchActionOverride", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFlinchActionOverride )
-		pFnFlinchActionOverride = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_FlinchBase.FlinchActionOverride" );
+	UFunction* const pFnFlinchActionOverride = pFnFlinchActionOverrideRef.Get ( );
 
 	USFXCustomAction_FlinchBase_execFlinchActionOverride_Parms FlinchActionOverride_Parms;
 
@@ -5260,10 +4810,9 @@ void USFXCustomAction_FlinchBase::FlinchActionOverride ( )
 
 void USFXCustomAction_FlinchBase::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_FlinchBase.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_FlinchBase.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_FlinchBase_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -5276,10 +4825,9 @@ void USFXCustomAction_FlinchBase::StopCustomAction ( )
 
 void USFXCustomAction_FlinchBase::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_FlinchBase.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_FlinchBase.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_FlinchBase_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -5293,10 +4841,9 @@ void USFXCustomAction_FlinchBase::StartCustomAction ( )
 
 struct FBodyStance USFXCustomAction_FlinchBase::GetBodyStanceAnim ( )
 {
-	static UFunction* pFnGetBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_FlinchBase.GetBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetBodyStanceAnim )
-		pFnGetBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_FlinchBase.GetBodyStanceAnim" );
+	UFunction* const pFnGetBodyStanceAnim = pFnGetBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_FlinchBase_execGetBodyStanceAnim_Parms GetBodyStanceAnim_Parms;
 
@@ -5314,10 +4861,9 @@ struct FBodyStance USFXCustomAction_FlinchBase::GetBodyStanceAnim ( )
 
 bool USFXCustomAction_FlinchBase::InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced )
 {
-	static UFunction* pFnInternalCanDoCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalCanDoCustomActionRef { L"Function SFXGameContent.SFXCustomAction_FlinchBase.InternalCanDoCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalCanDoCustomAction )
-		pFnInternalCanDoCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_FlinchBase.InternalCanDoCustomAction" );
+	UFunction* const pFnInternalCanDoCustomAction = pFnInternalCanDoCustomActionRef.Get ( );
 
 	USFXCustomAction_FlinchBase_execInternalCanDoCustomAction_Parms InternalCanDoCustomAction_Parms;
 	InternalCanDoCustomAction_Parms.SyncPawn = SyncPawn;
@@ -5335,10 +4881,9 @@ bool USFXCustomAction_FlinchBase::InternalCanDoCustomAction ( class ABioPawn* Sy
 
 void USFXCustomAction_FlinchBase::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_FlinchBase.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_FlinchBase.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_FlinchBase_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -5353,50 +4898,38 @@ void USFXCustomAction_FlinchBase::eventGetUsedAnimNames ( TArray<struct SFXName>
 
 
 
-class UClass* USFXCustomAction_FlinchHeavy::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_FlinchHeavy::pClassPointer { L"Class SFXGameContent.SFXCustomAction_FlinchHeavy", &UObject::FindClass };
 
 class UClass* USFXCustomAction_FlinchHeavy::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_FlinchHeavy" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_PlayerOnFire::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerOnFire::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerOnFire", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerOnFire::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerOnFire" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCharacterClass_Adept::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCharacterClass_Adept::pClassPointer { L"Class SFXGameContent.SFXCharacterClass_Adept", &UObject::FindClass };
 
 class UClass* USFXCharacterClass_Adept::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCharacterClass_Adept" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerCustomAction_Shockwave::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_Shockwave::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_Shockwave", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_Shockwave::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_Shockwave" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_Shockwave.PopulatePowerStatBarEvolves
@@ -5405,10 +4938,9 @@ class UClass* USFXPowerCustomAction_Shockwave::StaticClass()
 
 void USFXPowerCustomAction_Shockwave::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_Shockwave_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -5424,10 +4956,9 @@ void USFXPowerCustomAction_Shockwave::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_Shockwave::ApplyBonus ( struct SFXName Parameter, class USFXGameEffect* Bonus, unsigned long bRemove )
 {
-	static UFunction* pFnApplyBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.ApplyBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyBonus )
-		pFnApplyBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.ApplyBonus" );
+	UFunction* const pFnApplyBonus = pFnApplyBonusRef.Get ( );
 
 	USFXPowerCustomAction_Shockwave_execApplyBonus_Parms ApplyBonus_Parms;
 	memcpy ( &ApplyBonus_Parms.Parameter, &Parameter, 0x8 );
@@ -5444,10 +4975,9 @@ void USFXPowerCustomAction_Shockwave::ApplyBonus ( struct SFXName Parameter, cla
 
 void USFXPowerCustomAction_Shockwave::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_Shockwave_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -5462,10 +4992,9 @@ void USFXPowerCustomAction_Shockwave::RecalculateAllPowerData ( unsigned long bR
 
 void USFXPowerCustomAction_Shockwave::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_Shockwave_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -5482,10 +5011,9 @@ void USFXPowerCustomAction_Shockwave::EvolvePower ( unsigned char choice )
 
 bool USFXPowerCustomAction_Shockwave::ShouldUsePower ( class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_Shockwave_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Target = Target;
@@ -5510,10 +5038,9 @@ bool USFXPowerCustomAction_Shockwave::ShouldUsePower ( class AActor* Target, FSt
 
 void USFXPowerCustomAction_Shockwave::OnRagdollPhysicsImpact ( class APawn* oPawn, class AActor* oImpactActor, struct FVector const& vImpactDir )
 {
-	static UFunction* pFnOnRagdollPhysicsImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRagdollPhysicsImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.OnRagdollPhysicsImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRagdollPhysicsImpact )
-		pFnOnRagdollPhysicsImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.OnRagdollPhysicsImpact" );
+	UFunction* const pFnOnRagdollPhysicsImpact = pFnOnRagdollPhysicsImpactRef.Get ( );
 
 	USFXPowerCustomAction_Shockwave_execOnRagdollPhysicsImpact_Parms OnRagdollPhysicsImpact_Parms;
 	OnRagdollPhysicsImpact_Parms.oPawn = oPawn;
@@ -5535,10 +5062,9 @@ void USFXPowerCustomAction_Shockwave::OnRagdollPhysicsImpact ( class APawn* oPaw
 
 void USFXPowerCustomAction_Shockwave::ClientDoPowerSubsequentImpact ( class AActor* oActor, int CustomActionReactionType, float Duration, int ImpactCount, float Delay, unsigned long DoCallback )
 {
-	static UFunction* pFnClientDoPowerSubsequentImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoPowerSubsequentImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.ClientDoPowerSubsequentImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoPowerSubsequentImpact )
-		pFnClientDoPowerSubsequentImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.ClientDoPowerSubsequentImpact" );
+	UFunction* const pFnClientDoPowerSubsequentImpact = pFnClientDoPowerSubsequentImpactRef.Get ( );
 
 	USFXPowerCustomAction_Shockwave_execClientDoPowerSubsequentImpact_Parms ClientDoPowerSubsequentImpact_Parms;
 	ClientDoPowerSubsequentImpact_Parms.oActor = oActor;
@@ -5560,10 +5086,9 @@ void USFXPowerCustomAction_Shockwave::ClientDoPowerSubsequentImpact ( class AAct
 
 void USFXPowerCustomAction_Shockwave::DoSubsequentImpact ( class AActor* HitActor, struct FVector const& ImpactLocation, int nImpactCount )
 {
-	static UFunction* pFnDoSubsequentImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoSubsequentImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.DoSubsequentImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoSubsequentImpact )
-		pFnDoSubsequentImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.DoSubsequentImpact" );
+	UFunction* const pFnDoSubsequentImpact = pFnDoSubsequentImpactRef.Get ( );
 
 	USFXPowerCustomAction_Shockwave_execDoSubsequentImpact_Parms DoSubsequentImpact_Parms;
 	DoSubsequentImpact_Parms.HitActor = HitActor;
@@ -5581,10 +5106,9 @@ void USFXPowerCustomAction_Shockwave::DoSubsequentImpact ( class AActor* HitActo
 
 void USFXPowerCustomAction_Shockwave::DoImpact ( struct FVector const& location, struct FRotator const& ProjectileRotation )
 {
-	static UFunction* pFnDoImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.DoImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoImpact )
-		pFnDoImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.DoImpact" );
+	UFunction* const pFnDoImpact = pFnDoImpactRef.Get ( );
 
 	USFXPowerCustomAction_Shockwave_execDoImpact_Parms DoImpact_Parms;
 	memcpy ( &DoImpact_Parms.location, &location, 0xC );
@@ -5603,10 +5127,9 @@ void USFXPowerCustomAction_Shockwave::DoImpact ( struct FVector const& location,
 
 void USFXPowerCustomAction_Shockwave::OnPowerDetonated ( struct FVector const& HitLocation, struct FVector const& HitNormal, class ASFXProjectile_PowerCustomAction* oProjectile, class AActor* HitActor )
 {
-	static UFunction* pFnOnPowerDetonated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowerDetonatedRef { L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.OnPowerDetonated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowerDetonated )
-		pFnOnPowerDetonated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.OnPowerDetonated" );
+	UFunction* const pFnOnPowerDetonated = pFnOnPowerDetonatedRef.Get ( );
 
 	USFXPowerCustomAction_Shockwave_execOnPowerDetonated_Parms OnPowerDetonated_Parms;
 	memcpy ( &OnPowerDetonated_Parms.HitLocation, &HitLocation, 0xC );
@@ -5624,10 +5147,9 @@ void USFXPowerCustomAction_Shockwave::OnPowerDetonated ( struct FVector const& H
 
 class ASFXProjectile_PowerCustomAction* USFXPowerCustomAction_Shockwave::ReleaseProjectilePower ( )
 {
-	static UFunction* pFnReleaseProjectilePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReleaseProjectilePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.ReleaseProjectilePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReleaseProjectilePower )
-		pFnReleaseProjectilePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.ReleaseProjectilePower" );
+	UFunction* const pFnReleaseProjectilePower = pFnReleaseProjectilePowerRef.Get ( );
 
 	USFXPowerCustomAction_Shockwave_execReleaseProjectilePower_Parms ReleaseProjectilePower_Parms;
 
@@ -5638,14 +5160,11 @@ class ASFXProjectile_PowerCustomAction* USFXPowerCustomAction_Shockwave::Release
 
 
 
-class UClass* USFXPowerCustomAction_BioticGrenade::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_BioticGrenade::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_BioticGrenade", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_BioticGrenade::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_BioticGrenade" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.PopulatePowerStatBarEvolves
@@ -5654,10 +5173,9 @@ class UClass* USFXPowerCustomAction_BioticGrenade::StaticClass()
 
 void USFXPowerCustomAction_BioticGrenade::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_BioticGrenade_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -5671,10 +5189,9 @@ void USFXPowerCustomAction_BioticGrenade::PopulatePowerStatBarEvolves ( )
 
 struct FVector USFXPowerCustomAction_BioticGrenade::GetDefaultClientEffectParams ( )
 {
-	static UFunction* pFnGetDefaultClientEffectParams = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDefaultClientEffectParamsRef { L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.GetDefaultClientEffectParams", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDefaultClientEffectParams )
-		pFnGetDefaultClientEffectParams = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.GetDefaultClientEffectParams" );
+	UFunction* const pFnGetDefaultClientEffectParams = pFnGetDefaultClientEffectParamsRef.Get ( );
 
 	USFXPowerCustomAction_BioticGrenade_execGetDefaultClientEffectParams_Parms GetDefaultClientEffectParams_Parms;
 
@@ -5690,10 +5207,9 @@ struct FVector USFXPowerCustomAction_BioticGrenade::GetDefaultClientEffectParams
 
 void USFXPowerCustomAction_BioticGrenade::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_BioticGrenade_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -5707,10 +5223,9 @@ void USFXPowerCustomAction_BioticGrenade::RecalculateAllPowerData ( unsigned lon
 
 void USFXPowerCustomAction_BioticGrenade::ResetPower ( )
 {
-	static UFunction* pFnResetPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResetPowerRef { L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.ResetPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResetPower )
-		pFnResetPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.ResetPower" );
+	UFunction* const pFnResetPower = pFnResetPowerRef.Get ( );
 
 	USFXPowerCustomAction_BioticGrenade_execResetPower_Parms ResetPower_Parms;
 
@@ -5724,10 +5239,9 @@ void USFXPowerCustomAction_BioticGrenade::ResetPower ( )
 
 void USFXPowerCustomAction_BioticGrenade::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_BioticGrenade_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -5747,10 +5261,9 @@ void USFXPowerCustomAction_BioticGrenade::EvolvePower ( unsigned char choice )
 
 bool USFXPowerCustomAction_BioticGrenade::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerCustomAction_BioticGrenade_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -5770,10 +5283,9 @@ bool USFXPowerCustomAction_BioticGrenade::OnImpact ( unsigned char Resistance, c
 
 void USFXPowerCustomAction_BioticGrenade::SpawnChildProjectiles ( )
 {
-	static UFunction* pFnSpawnChildProjectiles = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSpawnChildProjectilesRef { L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.SpawnChildProjectiles", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSpawnChildProjectiles )
-		pFnSpawnChildProjectiles = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.SpawnChildProjectiles" );
+	UFunction* const pFnSpawnChildProjectiles = pFnSpawnChildProjectilesRef.Get ( );
 
 	USFXPowerCustomAction_BioticGrenade_execSpawnChildProjectiles_Parms SpawnChildProjectiles_Parms;
 
@@ -5786,10 +5298,9 @@ void USFXPowerCustomAction_BioticGrenade::SpawnChildProjectiles ( )
 
 void USFXPowerCustomAction_BioticGrenade::ReleasePower ( )
 {
-	static UFunction* pFnReleasePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReleasePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.ReleasePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReleasePower )
-		pFnReleasePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.ReleasePower" );
+	UFunction* const pFnReleasePower = pFnReleasePowerRef.Get ( );
 
 	USFXPowerCustomAction_BioticGrenade_execReleasePower_Parms ReleasePower_Parms;
 
@@ -5802,10 +5313,9 @@ void USFXPowerCustomAction_BioticGrenade::ReleasePower ( )
 
 void USFXPowerCustomAction_BioticGrenade::ApplyGrenadeBonus ( )
 {
-	static UFunction* pFnApplyGrenadeBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyGrenadeBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.ApplyGrenadeBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyGrenadeBonus )
-		pFnApplyGrenadeBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.ApplyGrenadeBonus" );
+	UFunction* const pFnApplyGrenadeBonus = pFnApplyGrenadeBonusRef.Get ( );
 
 	USFXPowerCustomAction_BioticGrenade_execApplyGrenadeBonus_Parms ApplyGrenadeBonus_Parms;
 
@@ -5819,10 +5329,9 @@ void USFXPowerCustomAction_BioticGrenade::ApplyGrenadeBonus ( )
 
 class UClass* USFXPowerCustomAction_BioticGrenade::GetDamageType ( )
 {
-	static UFunction* pFnGetDamageType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDamageTypeRef { L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.GetDamageType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDamageType )
-		pFnGetDamageType = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.GetDamageType" );
+	UFunction* const pFnGetDamageType = pFnGetDamageTypeRef.Get ( );
 
 	USFXPowerCustomAction_BioticGrenade_execGetDamageType_Parms GetDamageType_Parms;
 
@@ -5840,10 +5349,9 @@ class UClass* USFXPowerCustomAction_BioticGrenade::GetDamageType ( )
 
 float USFXPowerCustomAction_BioticGrenade::GetImpactDamage ( class AActor* oImpacted, class UClass** DamageType )
 {
-	static UFunction* pFnGetImpactDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetImpactDamageRef { L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.GetImpactDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetImpactDamage )
-		pFnGetImpactDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.GetImpactDamage" );
+	UFunction* const pFnGetImpactDamage = pFnGetImpactDamageRef.Get ( );
 
 	USFXPowerCustomAction_BioticGrenade_execGetImpactDamage_Parms GetImpactDamage_Parms;
 	GetImpactDamage_Parms.oImpacted = oImpacted;
@@ -5868,10 +5376,9 @@ float USFXPowerCustomAction_BioticGrenade::GetImpactDamage ( class AActor* oImpa
 
 void USFXPowerCustomAction_BioticGrenade::PlayDetonationEffects ( struct FVector const& ImpactLocation, struct FVector const& ImpactNormal, class ASFXProjectile_PowerCustomAction* oProjectile )
 {
-	static UFunction* pFnPlayDetonationEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayDetonationEffectsRef { L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.PlayDetonationEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayDetonationEffects )
-		pFnPlayDetonationEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.PlayDetonationEffects" );
+	UFunction* const pFnPlayDetonationEffects = pFnPlayDetonationEffectsRef.Get ( );
 
 	USFXPowerCustomAction_BioticGrenade_execPlayDetonationEffects_Parms PlayDetonationEffects_Parms;
 	memcpy ( &PlayDetonationEffects_Parms.ImpactLocation, &ImpactLocation, 0xC );
@@ -5883,14 +5390,11 @@ void USFXPowerCustomAction_BioticGrenade::PlayDetonationEffects ( struct FVector
 
 
 
-class UClass* USFXPowerCustomAction_GrenadeBase::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_GrenadeBase::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_GrenadeBase", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_GrenadeBase::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_GrenadeBase" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.GetHUDWheelIconInfo
@@ -5900,10 +5404,9 @@ class UClass* USFXPowerCustomAction_GrenadeBase::StaticClass()
 
 FString USFXPowerCustomAction_GrenadeBase::eventGetHUDWheelIconInfo ( )
 {
-	static UFunction* pFnGetHUDWheelIconInfo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetHUDWheelIconInfoRef { L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.GetHUDWheelIconInfo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetHUDWheelIconInfo )
-		pFnGetHUDWheelIconInfo = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.GetHUDWheelIconInfo" );
+	UFunction* const pFnGetHUDWheelIconInfo = pFnGetHUDWheelIconInfoRef.Get ( );
 
 	USFXPowerCustomAction_GrenadeBase_eventGetHUDWheelIconInfo_Parms GetHUDWheelIconInfo_Parms;
 
@@ -5921,10 +5424,9 @@ FString USFXPowerCustomAction_GrenadeBase::eventGetHUDWheelIconInfo ( )
 
 bool USFXPowerCustomAction_GrenadeBase::eventShouldUsePower ( class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_GrenadeBase_eventShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Target = Target;
@@ -5947,10 +5449,9 @@ bool USFXPowerCustomAction_GrenadeBase::eventShouldUsePower ( class AActor* Targ
 
 int USFXPowerCustomAction_GrenadeBase::GetGrenadeCount ( )
 {
-	static UFunction* pFnGetGrenadeCount = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetGrenadeCountRef { L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.GetGrenadeCount", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetGrenadeCount )
-		pFnGetGrenadeCount = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.GetGrenadeCount" );
+	UFunction* const pFnGetGrenadeCount = pFnGetGrenadeCountRef.Get ( );
 
 	USFXPowerCustomAction_GrenadeBase_execGetGrenadeCount_Parms GetGrenadeCount_Parms;
 
@@ -5966,10 +5467,9 @@ int USFXPowerCustomAction_GrenadeBase::GetGrenadeCount ( )
 
 void USFXPowerCustomAction_GrenadeBase::AdjustGrenadeCount ( int Amount )
 {
-	static UFunction* pFnAdjustGrenadeCount = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAdjustGrenadeCountRef { L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.AdjustGrenadeCount", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAdjustGrenadeCount )
-		pFnAdjustGrenadeCount = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.AdjustGrenadeCount" );
+	UFunction* const pFnAdjustGrenadeCount = pFnAdjustGrenadeCountRef.Get ( );
 
 	USFXPowerCustomAction_GrenadeBase_execAdjustGrenadeCount_Parms AdjustGrenadeCount_Parms;
 	AdjustGrenadeCount_Parms.Amount = Amount;
@@ -5983,10 +5483,9 @@ void USFXPowerCustomAction_GrenadeBase::AdjustGrenadeCount ( int Amount )
 
 void USFXPowerCustomAction_GrenadeBase::ReleasePower ( )
 {
-	static UFunction* pFnReleasePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReleasePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.ReleasePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReleasePower )
-		pFnReleasePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.ReleasePower" );
+	UFunction* const pFnReleasePower = pFnReleasePowerRef.Get ( );
 
 	USFXPowerCustomAction_GrenadeBase_execReleasePower_Parms ReleasePower_Parms;
 
@@ -6001,10 +5500,9 @@ void USFXPowerCustomAction_GrenadeBase::ReleasePower ( )
 
 bool USFXPowerCustomAction_GrenadeBase::CanUsePower ( class AActor* oTarget )
 {
-	static UFunction* pFnCanUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.CanUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanUsePower )
-		pFnCanUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.CanUsePower" );
+	UFunction* const pFnCanUsePower = pFnCanUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_GrenadeBase_execCanUsePower_Parms CanUsePower_Parms;
 	CanUsePower_Parms.oTarget = oTarget;
@@ -6020,10 +5518,9 @@ bool USFXPowerCustomAction_GrenadeBase::CanUsePower ( class AActor* oTarget )
 
 void USFXPowerCustomAction_GrenadeBase::ApplyGrenadeBonus ( )
 {
-	static UFunction* pFnApplyGrenadeBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyGrenadeBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.ApplyGrenadeBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyGrenadeBonus )
-		pFnApplyGrenadeBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.ApplyGrenadeBonus" );
+	UFunction* const pFnApplyGrenadeBonus = pFnApplyGrenadeBonusRef.Get ( );
 
 	USFXPowerCustomAction_GrenadeBase_execApplyGrenadeBonus_Parms ApplyGrenadeBonus_Parms;
 
@@ -6036,10 +5533,9 @@ void USFXPowerCustomAction_GrenadeBase::ApplyGrenadeBonus ( )
 
 void USFXPowerCustomAction_GrenadeBase::ResetPower ( )
 {
-	static UFunction* pFnResetPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResetPowerRef { L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.ResetPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResetPower )
-		pFnResetPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.ResetPower" );
+	UFunction* const pFnResetPower = pFnResetPowerRef.Get ( );
 
 	USFXPowerCustomAction_GrenadeBase_execResetPower_Parms ResetPower_Parms;
 
@@ -6053,10 +5549,9 @@ void USFXPowerCustomAction_GrenadeBase::ResetPower ( )
 
 void USFXPowerCustomAction_GrenadeBase::OnSquadMemberAdded ( class APawn* Pawn )
 {
-	static UFunction* pFnOnSquadMemberAdded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnSquadMemberAddedRef { L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.OnSquadMemberAdded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnSquadMemberAdded )
-		pFnOnSquadMemberAdded = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.OnSquadMemberAdded" );
+	UFunction* const pFnOnSquadMemberAdded = pFnOnSquadMemberAddedRef.Get ( );
 
 	USFXPowerCustomAction_GrenadeBase_execOnSquadMemberAdded_Parms OnSquadMemberAdded_Parms;
 	OnSquadMemberAdded_Parms.Pawn = Pawn;
@@ -6070,10 +5565,9 @@ void USFXPowerCustomAction_GrenadeBase::OnSquadMemberAdded ( class APawn* Pawn )
 
 void USFXPowerCustomAction_GrenadeBase::OnPowerRankIncreased ( )
 {
-	static UFunction* pFnOnPowerRankIncreased = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowerRankIncreasedRef { L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.OnPowerRankIncreased", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowerRankIncreased )
-		pFnOnPowerRankIncreased = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.OnPowerRankIncreased" );
+	UFunction* const pFnOnPowerRankIncreased = pFnOnPowerRankIncreasedRef.Get ( );
 
 	USFXPowerCustomAction_GrenadeBase_execOnPowerRankIncreased_Parms OnPowerRankIncreased_Parms;
 
@@ -6087,10 +5581,9 @@ void USFXPowerCustomAction_GrenadeBase::OnPowerRankIncreased ( )
 
 void USFXPowerCustomAction_GrenadeBase::OnPowerAdded ( class USFXPowerCustomActionBase* Power )
 {
-	static UFunction* pFnOnPowerAdded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowerAddedRef { L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.OnPowerAdded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowerAdded )
-		pFnOnPowerAdded = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.OnPowerAdded" );
+	UFunction* const pFnOnPowerAdded = pFnOnPowerAddedRef.Get ( );
 
 	USFXPowerCustomAction_GrenadeBase_execOnPowerAdded_Parms OnPowerAdded_Parms;
 	OnPowerAdded_Parms.Power = Power;
@@ -6104,10 +5597,9 @@ void USFXPowerCustomAction_GrenadeBase::OnPowerAdded ( class USFXPowerCustomActi
 
 void USFXPowerCustomAction_GrenadeBase::OnPowersLoaded ( )
 {
-	static UFunction* pFnOnPowersLoaded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowersLoadedRef { L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.OnPowersLoaded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowersLoaded )
-		pFnOnPowersLoaded = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.OnPowersLoaded" );
+	UFunction* const pFnOnPowersLoaded = pFnOnPowersLoadedRef.Get ( );
 
 	USFXPowerCustomAction_GrenadeBase_execOnPowersLoaded_Parms OnPowersLoaded_Parms;
 
@@ -6116,14 +5608,11 @@ void USFXPowerCustomAction_GrenadeBase::OnPowersLoaded ( )
 
 
 
-class UClass* USFXPowerCustomAction_Throw::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_Throw::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_Throw", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_Throw::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_Throw" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_Throw.PopulatePowerStatBarEvolves
@@ -6132,10 +5621,9 @@ class UClass* USFXPowerCustomAction_Throw::StaticClass()
 
 void USFXPowerCustomAction_Throw::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_Throw.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Throw.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_Throw_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -6149,10 +5637,9 @@ void USFXPowerCustomAction_Throw::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_Throw::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Throw.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Throw.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_Throw_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -6169,10 +5656,9 @@ void USFXPowerCustomAction_Throw::EvolvePower ( unsigned char choice )
 
 bool USFXPowerCustomAction_Throw::ShouldUsePower ( class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Throw.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Throw.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_Throw_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Target = Target;
@@ -6197,10 +5683,9 @@ bool USFXPowerCustomAction_Throw::ShouldUsePower ( class AActor* Target, FString
 
 void USFXPowerCustomAction_Throw::OnRagdollPhysicsImpact ( class APawn* oPawn, class AActor* oImpactActor, struct FVector const& vImpactDir )
 {
-	static UFunction* pFnOnRagdollPhysicsImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRagdollPhysicsImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Throw.OnRagdollPhysicsImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRagdollPhysicsImpact )
-		pFnOnRagdollPhysicsImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Throw.OnRagdollPhysicsImpact" );
+	UFunction* const pFnOnRagdollPhysicsImpact = pFnOnRagdollPhysicsImpactRef.Get ( );
 
 	USFXPowerCustomAction_Throw_execOnRagdollPhysicsImpact_Parms OnRagdollPhysicsImpact_Parms;
 	OnRagdollPhysicsImpact_Parms.oPawn = oPawn;
@@ -6216,10 +5701,9 @@ void USFXPowerCustomAction_Throw::OnRagdollPhysicsImpact ( class APawn* oPawn, c
 
 void USFXPowerCustomAction_Throw::ResetPower ( )
 {
-	static UFunction* pFnResetPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResetPowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Throw.ResetPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResetPower )
-		pFnResetPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Throw.ResetPower" );
+	UFunction* const pFnResetPower = pFnResetPowerRef.Get ( );
 
 	USFXPowerCustomAction_Throw_execResetPower_Parms ResetPower_Parms;
 
@@ -6238,10 +5722,9 @@ void USFXPowerCustomAction_Throw::ResetPower ( )
 
 bool USFXPowerCustomAction_Throw::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Throw.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Throw.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerCustomAction_Throw_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -6263,10 +5746,9 @@ bool USFXPowerCustomAction_Throw::OnImpact ( unsigned char Resistance, class AAc
 
 float USFXPowerCustomAction_Throw::GetImpactForce ( class AActor* oImpacted )
 {
-	static UFunction* pFnGetImpactForce = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetImpactForceRef { L"Function SFXGameContent.SFXPowerCustomAction_Throw.GetImpactForce", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetImpactForce )
-		pFnGetImpactForce = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Throw.GetImpactForce" );
+	UFunction* const pFnGetImpactForce = pFnGetImpactForceRef.Get ( );
 
 	USFXPowerCustomAction_Throw_execGetImpactForce_Parms GetImpactForce_Parms;
 	GetImpactForce_Parms.oImpacted = oImpacted;
@@ -6278,14 +5760,11 @@ float USFXPowerCustomAction_Throw::GetImpactForce ( class AActor* oImpacted )
 
 
 
-class UClass* USFXPowerCustomAction_MultiProjectile::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_MultiProjectile::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_MultiProjectile", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_MultiProjectile::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_MultiProjectile" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_MultiProjectile.FindSecondTarget
@@ -6294,10 +5773,9 @@ class UClass* USFXPowerCustomAction_MultiProjectile::StaticClass()
 
 void USFXPowerCustomAction_MultiProjectile::FindSecondTarget ( )
 {
-	static UFunction* pFnFindSecondTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnFindSecondTargetRef { L"Function SFXGameContent.SFXPowerCustomAction_MultiProjectile.FindSecondTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnFindSecondTarget )
-		pFnFindSecondTarget = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_MultiProjectile.FindSecondTarget" );
+	UFunction* const pFnFindSecondTarget = pFnFindSecondTargetRef.Get ( );
 
 	USFXPowerCustomAction_MultiProjectile_execFindSecondTarget_Parms FindSecondTarget_Parms;
 
@@ -6310,10 +5788,9 @@ void USFXPowerCustomAction_MultiProjectile::FindSecondTarget ( )
 
 void USFXPowerCustomAction_MultiProjectile::ReleaseSecondProjectile ( )
 {
-	static UFunction* pFnReleaseSecondProjectile = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReleaseSecondProjectileRef { L"Function SFXGameContent.SFXPowerCustomAction_MultiProjectile.ReleaseSecondProjectile", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReleaseSecondProjectile )
-		pFnReleaseSecondProjectile = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_MultiProjectile.ReleaseSecondProjectile" );
+	UFunction* const pFnReleaseSecondProjectile = pFnReleaseSecondProjectileRef.Get ( );
 
 	USFXPowerCustomAction_MultiProjectile_execReleaseSecondProjectile_Parms ReleaseSecondProjectile_Parms;
 
@@ -6326,10 +5803,9 @@ void USFXPowerCustomAction_MultiProjectile::ReleaseSecondProjectile ( )
 
 void USFXPowerCustomAction_MultiProjectile::ReleasePower ( )
 {
-	static UFunction* pFnReleasePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReleasePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_MultiProjectile.ReleasePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReleasePower )
-		pFnReleasePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_MultiProjectile.ReleasePower" );
+	UFunction* const pFnReleasePower = pFnReleasePowerRef.Get ( );
 
 	USFXPowerCustomAction_MultiProjectile_execReleasePower_Parms ReleasePower_Parms;
 
@@ -6338,14 +5814,11 @@ void USFXPowerCustomAction_MultiProjectile::ReleasePower ( )
 
 
 
-class UClass* USFXPowerCustomAction_Pull::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_Pull::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_Pull", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_Pull::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_Pull" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_Pull.PopulatePowerStatBarEvolves
@@ -6354,10 +5827,9 @@ class UClass* USFXPowerCustomAction_Pull::StaticClass()
 
 void USFXPowerCustomAction_Pull::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_Pull.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Pull.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_Pull_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -6373,10 +5845,9 @@ void USFXPowerCustomAction_Pull::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_Pull::ApplyBonus ( struct SFXName Parameter, class USFXGameEffect* Bonus, unsigned long bRemove )
 {
-	static UFunction* pFnApplyBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_Pull.ApplyBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyBonus )
-		pFnApplyBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Pull.ApplyBonus" );
+	UFunction* const pFnApplyBonus = pFnApplyBonusRef.Get ( );
 
 	USFXPowerCustomAction_Pull_execApplyBonus_Parms ApplyBonus_Parms;
 	memcpy ( &ApplyBonus_Parms.Parameter, &Parameter, 0x8 );
@@ -6392,10 +5863,9 @@ void USFXPowerCustomAction_Pull::ApplyBonus ( struct SFXName Parameter, class US
 
 void USFXPowerCustomAction_Pull::ResetPower ( )
 {
-	static UFunction* pFnResetPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResetPowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Pull.ResetPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResetPower )
-		pFnResetPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Pull.ResetPower" );
+	UFunction* const pFnResetPower = pFnResetPowerRef.Get ( );
 
 	USFXPowerCustomAction_Pull_execResetPower_Parms ResetPower_Parms;
 
@@ -6409,10 +5879,9 @@ void USFXPowerCustomAction_Pull::ResetPower ( )
 
 void USFXPowerCustomAction_Pull::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_Pull.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Pull.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_Pull_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -6427,10 +5896,9 @@ void USFXPowerCustomAction_Pull::RecalculateAllPowerData ( unsigned long bReset
 
 void USFXPowerCustomAction_Pull::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Pull.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Pull.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_Pull_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -6447,10 +5915,9 @@ void USFXPowerCustomAction_Pull::EvolvePower ( unsigned char choice )
 
 bool USFXPowerCustomAction_Pull::ShouldUsePower ( class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Pull.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Pull.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_Pull_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Target = Target;
@@ -6475,10 +5942,9 @@ bool USFXPowerCustomAction_Pull::ShouldUsePower ( class AActor* Target, FString*
 
 void USFXPowerCustomAction_Pull::OnRagdollPhysicsImpact ( class APawn* oPawn, class AActor* oImpactActor, struct FVector const& vImpactDir )
 {
-	static UFunction* pFnOnRagdollPhysicsImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRagdollPhysicsImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Pull.OnRagdollPhysicsImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRagdollPhysicsImpact )
-		pFnOnRagdollPhysicsImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Pull.OnRagdollPhysicsImpact" );
+	UFunction* const pFnOnRagdollPhysicsImpact = pFnOnRagdollPhysicsImpactRef.Get ( );
 
 	USFXPowerCustomAction_Pull_execOnRagdollPhysicsImpact_Parms OnRagdollPhysicsImpact_Parms;
 	OnRagdollPhysicsImpact_Parms.oPawn = oPawn;
@@ -6494,10 +5960,9 @@ void USFXPowerCustomAction_Pull::OnRagdollPhysicsImpact ( class APawn* oPawn, cl
 
 void USFXPowerCustomAction_Pull::DropCurrentTargets ( )
 {
-	static UFunction* pFnDropCurrentTargets = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDropCurrentTargetsRef { L"Function SFXGameContent.SFXPowerCustomAction_Pull.DropCurrentTargets", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDropCurrentTargets )
-		pFnDropCurrentTargets = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Pull.DropCurrentTargets" );
+	UFunction* const pFnDropCurrentTargets = pFnDropCurrentTargetsRef.Get ( );
 
 	USFXPowerCustomAction_Pull_execDropCurrentTargets_Parms DropCurrentTargets_Parms;
 
@@ -6516,10 +5981,9 @@ void USFXPowerCustomAction_Pull::DropCurrentTargets ( )
 
 bool USFXPowerCustomAction_Pull::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Pull.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Pull.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerCustomAction_Pull_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -6541,10 +6005,9 @@ bool USFXPowerCustomAction_Pull::OnImpact ( unsigned char Resistance, class AAct
 
 float USFXPowerCustomAction_Pull::GetImpactForce ( class AActor* oImpacted )
 {
-	static UFunction* pFnGetImpactForce = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetImpactForceRef { L"Function SFXGameContent.SFXPowerCustomAction_Pull.GetImpactForce", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetImpactForce )
-		pFnGetImpactForce = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Pull.GetImpactForce" );
+	UFunction* const pFnGetImpactForce = pFnGetImpactForceRef.Get ( );
 
 	USFXPowerCustomAction_Pull_execGetImpactForce_Parms GetImpactForce_Parms;
 	GetImpactForce_Parms.oImpacted = oImpacted;
@@ -6560,10 +6023,9 @@ float USFXPowerCustomAction_Pull::GetImpactForce ( class AActor* oImpacted )
 
 void USFXPowerCustomAction_Pull::StartPower ( )
 {
-	static UFunction* pFnStartPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Pull.StartPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPower )
-		pFnStartPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Pull.StartPower" );
+	UFunction* const pFnStartPower = pFnStartPowerRef.Get ( );
 
 	USFXPowerCustomAction_Pull_execStartPower_Parms StartPower_Parms;
 
@@ -6572,14 +6034,11 @@ void USFXPowerCustomAction_Pull::StartPower ( )
 
 
 
-class UClass* USFXPowerCustomAction_AdeptMeleePassive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_AdeptMeleePassive::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_AdeptMeleePassive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.PopulatePowerStatBarEvolves
@@ -6588,10 +6047,9 @@ class UClass* USFXPowerCustomAction_AdeptMeleePassive::StaticClass()
 
 void USFXPowerCustomAction_AdeptMeleePassive::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_AdeptMeleePassive_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -6607,10 +6065,9 @@ void USFXPowerCustomAction_AdeptMeleePassive::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_AdeptMeleePassive::ApplyBonus ( struct SFXName Parameter, class USFXGameEffect* Bonus, unsigned long bRemove )
 {
-	static UFunction* pFnApplyBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.ApplyBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyBonus )
-		pFnApplyBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.ApplyBonus" );
+	UFunction* const pFnApplyBonus = pFnApplyBonusRef.Get ( );
 
 	USFXPowerCustomAction_AdeptMeleePassive_execApplyBonus_Parms ApplyBonus_Parms;
 	memcpy ( &ApplyBonus_Parms.Parameter, &Parameter, 0x8 );
@@ -6627,10 +6084,9 @@ void USFXPowerCustomAction_AdeptMeleePassive::ApplyBonus ( struct SFXName Parame
 
 void USFXPowerCustomAction_AdeptMeleePassive::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_AdeptMeleePassive_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -6645,10 +6101,9 @@ void USFXPowerCustomAction_AdeptMeleePassive::RecalculateAllPowerData ( unsigned
 
 void USFXPowerCustomAction_AdeptMeleePassive::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_AdeptMeleePassive_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -6663,10 +6118,9 @@ void USFXPowerCustomAction_AdeptMeleePassive::EvolvePower ( unsigned char choice
 
 void USFXPowerCustomAction_AdeptMeleePassive::OnHeavyMeleeKill ( class AActor* oImpacted )
 {
-	static UFunction* pFnOnHeavyMeleeKill = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnHeavyMeleeKillRef { L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.OnHeavyMeleeKill", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnHeavyMeleeKill )
-		pFnOnHeavyMeleeKill = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.OnHeavyMeleeKill" );
+	UFunction* const pFnOnHeavyMeleeKill = pFnOnHeavyMeleeKillRef.Get ( );
 
 	USFXPowerCustomAction_AdeptMeleePassive_execOnHeavyMeleeKill_Parms OnHeavyMeleeKill_Parms;
 	OnHeavyMeleeKill_Parms.oImpacted = oImpacted;
@@ -6680,10 +6134,9 @@ void USFXPowerCustomAction_AdeptMeleePassive::OnHeavyMeleeKill ( class AActor* o
 
 void USFXPowerCustomAction_AdeptMeleePassive::ApplyGlobalBonus ( )
 {
-	static UFunction* pFnApplyGlobalBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyGlobalBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.ApplyGlobalBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyGlobalBonus )
-		pFnApplyGlobalBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.ApplyGlobalBonus" );
+	UFunction* const pFnApplyGlobalBonus = pFnApplyGlobalBonusRef.Get ( );
 
 	USFXPowerCustomAction_AdeptMeleePassive_execApplyGlobalBonus_Parms ApplyGlobalBonus_Parms;
 
@@ -6692,14 +6145,11 @@ void USFXPowerCustomAction_AdeptMeleePassive::ApplyGlobalBonus ( )
 
 
 
-class UClass* USFXPowerCustomAction_Warp::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_Warp::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_Warp", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_Warp::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_Warp" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_Warp.PopulatePowerStatBarEvolves
@@ -6708,10 +6158,9 @@ class UClass* USFXPowerCustomAction_Warp::StaticClass()
 
 void USFXPowerCustomAction_Warp::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_Warp.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Warp.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_Warp_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -6727,10 +6176,9 @@ void USFXPowerCustomAction_Warp::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_Warp::ApplyBonus ( struct SFXName Parameter, class USFXGameEffect* Bonus, unsigned long bRemove )
 {
-	static UFunction* pFnApplyBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_Warp.ApplyBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyBonus )
-		pFnApplyBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Warp.ApplyBonus" );
+	UFunction* const pFnApplyBonus = pFnApplyBonusRef.Get ( );
 
 	USFXPowerCustomAction_Warp_execApplyBonus_Parms ApplyBonus_Parms;
 	memcpy ( &ApplyBonus_Parms.Parameter, &Parameter, 0x8 );
@@ -6747,10 +6195,9 @@ void USFXPowerCustomAction_Warp::ApplyBonus ( struct SFXName Parameter, class US
 
 void USFXPowerCustomAction_Warp::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_Warp.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Warp.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_Warp_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -6765,10 +6212,9 @@ void USFXPowerCustomAction_Warp::RecalculateAllPowerData ( unsigned long bReset
 
 void USFXPowerCustomAction_Warp::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Warp.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Warp.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_Warp_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -6785,10 +6231,9 @@ void USFXPowerCustomAction_Warp::EvolvePower ( unsigned char choice )
 
 bool USFXPowerCustomAction_Warp::ShouldUsePower ( class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Warp.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Warp.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_Warp_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Target = Target;
@@ -6813,10 +6258,9 @@ bool USFXPowerCustomAction_Warp::ShouldUsePower ( class AActor* Target, FString*
 
 void USFXPowerCustomAction_Warp::PlayImpactEffects ( class AActor* oImpacted, struct FVector const& ImpactLocation, struct FVector const& ImpactNormal )
 {
-	static UFunction* pFnPlayImpactEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayImpactEffectsRef { L"Function SFXGameContent.SFXPowerCustomAction_Warp.PlayImpactEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayImpactEffects )
-		pFnPlayImpactEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Warp.PlayImpactEffects" );
+	UFunction* const pFnPlayImpactEffects = pFnPlayImpactEffectsRef.Get ( );
 
 	USFXPowerCustomAction_Warp_execPlayImpactEffects_Parms PlayImpactEffects_Parms;
 	PlayImpactEffects_Parms.oImpacted = oImpacted;
@@ -6838,10 +6282,9 @@ void USFXPowerCustomAction_Warp::PlayImpactEffects ( class AActor* oImpacted, st
 
 bool USFXPowerCustomAction_Warp::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Warp.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Warp.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerCustomAction_Warp_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -6864,10 +6307,9 @@ bool USFXPowerCustomAction_Warp::OnImpact ( unsigned char Resistance, class AAct
 
 float USFXPowerCustomAction_Warp::GetTotalDamage ( class AActor* oImpacted, class UClass** DamageType )
 {
-	static UFunction* pFnGetTotalDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTotalDamageRef { L"Function SFXGameContent.SFXPowerCustomAction_Warp.GetTotalDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTotalDamage )
-		pFnGetTotalDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Warp.GetTotalDamage" );
+	UFunction* const pFnGetTotalDamage = pFnGetTotalDamageRef.Get ( );
 
 	USFXPowerCustomAction_Warp_execGetTotalDamage_Parms GetTotalDamage_Parms;
 	GetTotalDamage_Parms.oImpacted = oImpacted;
@@ -6892,10 +6334,9 @@ float USFXPowerCustomAction_Warp::GetTotalDamage ( class AActor* oImpacted, clas
 
 float USFXPowerCustomAction_Warp::GetImpactDamage ( class AActor* oImpacted, class UClass** DamageType )
 {
-	static UFunction* pFnGetImpactDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetImpactDamageRef { L"Function SFXGameContent.SFXPowerCustomAction_Warp.GetImpactDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetImpactDamage )
-		pFnGetImpactDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Warp.GetImpactDamage" );
+	UFunction* const pFnGetImpactDamage = pFnGetImpactDamageRef.Get ( );
 
 	USFXPowerCustomAction_Warp_execGetImpactDamage_Parms GetImpactDamage_Parms;
 	GetImpactDamage_Parms.oImpacted = oImpacted;
@@ -6913,14 +6354,11 @@ float USFXPowerCustomAction_Warp::GetImpactDamage ( class AActor* oImpacted, cla
 
 
 
-class UClass* USFXPowerCustomAction_Singularity::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_Singularity::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_Singularity", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_Singularity::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_Singularity" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_Singularity.CombatEnded
@@ -6929,10 +6367,9 @@ class UClass* USFXPowerCustomAction_Singularity::StaticClass()
 
 void USFXPowerCustomAction_Singularity::CombatEnded ( )
 {
-	static UFunction* pFnCombatEnded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCombatEndedRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.CombatEnded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCombatEnded )
-		pFnCombatEnded = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.CombatEnded" );
+	UFunction* const pFnCombatEnded = pFnCombatEndedRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execCombatEnded_Parms CombatEnded_Parms;
 
@@ -6945,10 +6382,9 @@ void USFXPowerCustomAction_Singularity::CombatEnded ( )
 
 void USFXPowerCustomAction_Singularity::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -6961,10 +6397,9 @@ void USFXPowerCustomAction_Singularity::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_Singularity::OnOwnerDestroyed ( )
 {
-	static UFunction* pFnOnOwnerDestroyed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnOwnerDestroyedRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnOwnerDestroyed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnOwnerDestroyed )
-		pFnOnOwnerDestroyed = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnOwnerDestroyed" );
+	UFunction* const pFnOnOwnerDestroyed = pFnOnOwnerDestroyedRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execOnOwnerDestroyed_Parms OnOwnerDestroyed_Parms;
 
@@ -6977,10 +6412,9 @@ void USFXPowerCustomAction_Singularity::OnOwnerDestroyed ( )
 
 void USFXPowerCustomAction_Singularity::DoJoinInProgress ( )
 {
-	static UFunction* pFnDoJoinInProgress = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoJoinInProgressRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.DoJoinInProgress", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoJoinInProgress )
-		pFnDoJoinInProgress = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.DoJoinInProgress" );
+	UFunction* const pFnDoJoinInProgress = pFnDoJoinInProgressRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execDoJoinInProgress_Parms DoJoinInProgress_Parms;
 
@@ -6999,10 +6433,9 @@ void USFXPowerCustomAction_Singularity::DoJoinInProgress ( )
 
 void USFXPowerCustomAction_Singularity::ClientDoPowerSubsequentImpact ( class AActor* oActor, int CustomActionReactionType, float Duration, int ImpactCount, float Delay, unsigned long DoCallback )
 {
-	static UFunction* pFnClientDoPowerSubsequentImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoPowerSubsequentImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ClientDoPowerSubsequentImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoPowerSubsequentImpact )
-		pFnClientDoPowerSubsequentImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ClientDoPowerSubsequentImpact" );
+	UFunction* const pFnClientDoPowerSubsequentImpact = pFnClientDoPowerSubsequentImpactRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execClientDoPowerSubsequentImpact_Parms ClientDoPowerSubsequentImpact_Parms;
 	ClientDoPowerSubsequentImpact_Parms.oActor = oActor;
@@ -7024,10 +6457,9 @@ void USFXPowerCustomAction_Singularity::ClientDoPowerSubsequentImpact ( class AA
 
 void USFXPowerCustomAction_Singularity::ApplyBonus ( struct SFXName Parameter, class USFXGameEffect* Bonus, unsigned long bRemove )
 {
-	static UFunction* pFnApplyBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ApplyBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyBonus )
-		pFnApplyBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ApplyBonus" );
+	UFunction* const pFnApplyBonus = pFnApplyBonusRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execApplyBonus_Parms ApplyBonus_Parms;
 	memcpy ( &ApplyBonus_Parms.Parameter, &Parameter, 0x8 );
@@ -7044,10 +6476,9 @@ void USFXPowerCustomAction_Singularity::ApplyBonus ( struct SFXName Parameter, c
 
 void USFXPowerCustomAction_Singularity::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -7062,10 +6493,9 @@ void USFXPowerCustomAction_Singularity::RecalculateAllPowerData ( unsigned long
 
 void USFXPowerCustomAction_Singularity::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -7082,10 +6512,9 @@ void USFXPowerCustomAction_Singularity::EvolvePower ( unsigned char choice )
 
 bool USFXPowerCustomAction_Singularity::ShouldUsePower ( class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Target = Target;
@@ -7107,10 +6536,9 @@ bool USFXPowerCustomAction_Singularity::ShouldUsePower ( class AActor* Target, F
 
 void USFXPowerCustomAction_Singularity::OnPowerRankIncreased ( )
 {
-	static UFunction* pFnOnPowerRankIncreased = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowerRankIncreasedRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnPowerRankIncreased", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowerRankIncreased )
-		pFnOnPowerRankIncreased = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnPowerRankIncreased" );
+	UFunction* const pFnOnPowerRankIncreased = pFnOnPowerRankIncreasedRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execOnPowerRankIncreased_Parms OnPowerRankIncreased_Parms;
 
@@ -7126,10 +6554,9 @@ void USFXPowerCustomAction_Singularity::OnPowerRankIncreased ( )
 
 void USFXPowerCustomAction_Singularity::OnRagdollPhysicsImpact ( class APawn* oPawn, class AActor* oImpactActor, struct FVector const& vImpactDir )
 {
-	static UFunction* pFnOnRagdollPhysicsImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRagdollPhysicsImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnRagdollPhysicsImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRagdollPhysicsImpact )
-		pFnOnRagdollPhysicsImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnRagdollPhysicsImpact" );
+	UFunction* const pFnOnRagdollPhysicsImpact = pFnOnRagdollPhysicsImpactRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execOnRagdollPhysicsImpact_Parms OnRagdollPhysicsImpact_Parms;
 	OnRagdollPhysicsImpact_Parms.oPawn = oPawn;
@@ -7145,10 +6572,9 @@ void USFXPowerCustomAction_Singularity::OnRagdollPhysicsImpact ( class APawn* oP
 
 void USFXPowerCustomAction_Singularity::SpawnSingularityVFX ( )
 {
-	static UFunction* pFnSpawnSingularityVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSpawnSingularityVFXRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.SpawnSingularityVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSpawnSingularityVFX )
-		pFnSpawnSingularityVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.SpawnSingularityVFX" );
+	UFunction* const pFnSpawnSingularityVFX = pFnSpawnSingularityVFXRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execSpawnSingularityVFX_Parms SpawnSingularityVFX_Parms;
 
@@ -7161,10 +6587,9 @@ void USFXPowerCustomAction_Singularity::SpawnSingularityVFX ( )
 
 void USFXPowerCustomAction_Singularity::SpawnSingularity ( )
 {
-	static UFunction* pFnSpawnSingularity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSpawnSingularityRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.SpawnSingularity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSpawnSingularity )
-		pFnSpawnSingularity = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.SpawnSingularity" );
+	UFunction* const pFnSpawnSingularity = pFnSpawnSingularityRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execSpawnSingularity_Parms SpawnSingularity_Parms;
 
@@ -7183,10 +6608,9 @@ void USFXPowerCustomAction_Singularity::SpawnSingularity ( )
 
 bool USFXPowerCustomAction_Singularity::OnExplosionImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnExplosionImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnExplosionImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnExplosionImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnExplosionImpact )
-		pFnOnExplosionImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnExplosionImpact" );
+	UFunction* const pFnOnExplosionImpact = pFnOnExplosionImpactRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execOnExplosionImpact_Parms OnExplosionImpact_Parms;
 	OnExplosionImpact_Parms.Resistance = Resistance;
@@ -7206,10 +6630,9 @@ bool USFXPowerCustomAction_Singularity::OnExplosionImpact ( unsigned char Resist
 
 void USFXPowerCustomAction_Singularity::SingularityExplosion ( )
 {
-	static UFunction* pFnSingularityExplosion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSingularityExplosionRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.SingularityExplosion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSingularityExplosion )
-		pFnSingularityExplosion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.SingularityExplosion" );
+	UFunction* const pFnSingularityExplosion = pFnSingularityExplosionRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execSingularityExplosion_Parms SingularityExplosion_Parms;
 
@@ -7222,10 +6645,9 @@ void USFXPowerCustomAction_Singularity::SingularityExplosion ( )
 
 void USFXPowerCustomAction_Singularity::Internal_TurnOffSingularity ( )
 {
-	static UFunction* pFnInternal_TurnOffSingularity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternal_TurnOffSingularityRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.Internal_TurnOffSingularity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternal_TurnOffSingularity )
-		pFnInternal_TurnOffSingularity = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.Internal_TurnOffSingularity" );
+	UFunction* const pFnInternal_TurnOffSingularity = pFnInternal_TurnOffSingularityRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execInternal_TurnOffSingularity_Parms Internal_TurnOffSingularity_Parms;
 
@@ -7239,10 +6661,9 @@ void USFXPowerCustomAction_Singularity::Internal_TurnOffSingularity ( )
 
 void USFXPowerCustomAction_Singularity::TurnOffSingularity ( unsigned long bDoReplication )
 {
-	static UFunction* pFnTurnOffSingularity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTurnOffSingularityRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.TurnOffSingularity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTurnOffSingularity )
-		pFnTurnOffSingularity = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.TurnOffSingularity" );
+	UFunction* const pFnTurnOffSingularity = pFnTurnOffSingularityRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execTurnOffSingularity_Parms TurnOffSingularity_Parms;
 	TurnOffSingularity_Parms.bDoReplication = bDoReplication;
@@ -7258,10 +6679,9 @@ void USFXPowerCustomAction_Singularity::TurnOffSingularity ( unsigned long bDoRe
 
 bool USFXPowerCustomAction_Singularity::CanPutInSingularity ( class AActor* oActor )
 {
-	static UFunction* pFnCanPutInSingularity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanPutInSingularityRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.CanPutInSingularity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanPutInSingularity )
-		pFnCanPutInSingularity = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.CanPutInSingularity" );
+	UFunction* const pFnCanPutInSingularity = pFnCanPutInSingularityRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execCanPutInSingularity_Parms CanPutInSingularity_Parms;
 	CanPutInSingularity_Parms.oActor = oActor;
@@ -7278,10 +6698,9 @@ bool USFXPowerCustomAction_Singularity::CanPutInSingularity ( class AActor* oAct
 
 void USFXPowerCustomAction_Singularity::OnGameEffectEnded ( class AActor* oActor )
 {
-	static UFunction* pFnOnGameEffectEnded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnGameEffectEndedRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnGameEffectEnded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnGameEffectEnded )
-		pFnOnGameEffectEnded = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnGameEffectEnded" );
+	UFunction* const pFnOnGameEffectEnded = pFnOnGameEffectEndedRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execOnGameEffectEnded_Parms OnGameEffectEnded_Parms;
 	OnGameEffectEnded_Parms.oActor = oActor;
@@ -7297,10 +6716,9 @@ void USFXPowerCustomAction_Singularity::OnGameEffectEnded ( class AActor* oActor
 
 bool USFXPowerCustomAction_Singularity::ImpactNewTarget ( class AActor* oImpacted )
 {
-	static UFunction* pFnImpactNewTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnImpactNewTargetRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ImpactNewTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnImpactNewTarget )
-		pFnImpactNewTarget = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ImpactNewTarget" );
+	UFunction* const pFnImpactNewTarget = pFnImpactNewTargetRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execImpactNewTarget_Parms ImpactNewTarget_Parms;
 	ImpactNewTarget_Parms.oImpacted = oImpacted;
@@ -7318,10 +6736,9 @@ bool USFXPowerCustomAction_Singularity::ImpactNewTarget ( class AActor* oImpacte
 
 bool USFXPowerCustomAction_Singularity::ApplyBioticComboEffect ( class AActor* oTarget )
 {
-	static UFunction* pFnApplyBioticComboEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyBioticComboEffectRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ApplyBioticComboEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyBioticComboEffect )
-		pFnApplyBioticComboEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ApplyBioticComboEffect" );
+	UFunction* const pFnApplyBioticComboEffect = pFnApplyBioticComboEffectRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execApplyBioticComboEffect_Parms ApplyBioticComboEffect_Parms;
 	ApplyBioticComboEffect_Parms.oTarget = oTarget;
@@ -7338,10 +6755,9 @@ bool USFXPowerCustomAction_Singularity::ApplyBioticComboEffect ( class AActor* o
 
 void USFXPowerCustomAction_Singularity::eventTickCustomAction ( float fDeltaTime )
 {
-	static UFunction* pFnTickCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickCustomActionRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.TickCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTickCustomAction )
-		pFnTickCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.TickCustomAction" );
+	UFunction* const pFnTickCustomAction = pFnTickCustomActionRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_eventTickCustomAction_Parms TickCustomAction_Parms;
 	TickCustomAction_Parms.fDeltaTime = fDeltaTime;
@@ -7361,10 +6777,9 @@ void USFXPowerCustomAction_Singularity::eventTickCustomAction ( float fDeltaTime
 
 void USFXPowerCustomAction_Singularity::ClientDoCustomActionImpact ( class AActor* oActor, int ImpactCount, unsigned long bFirstTarget, struct FVector const& HitLocation, struct FVector const& HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnClientDoCustomActionImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoCustomActionImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ClientDoCustomActionImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoCustomActionImpact )
-		pFnClientDoCustomActionImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ClientDoCustomActionImpact" );
+	UFunction* const pFnClientDoCustomActionImpact = pFnClientDoCustomActionImpactRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execClientDoCustomActionImpact_Parms ClientDoCustomActionImpact_Parms;
 	ClientDoCustomActionImpact_Parms.oActor = oActor;
@@ -7387,10 +6802,9 @@ void USFXPowerCustomAction_Singularity::ClientDoCustomActionImpact ( class AActo
 
 void USFXPowerCustomAction_Singularity::OnPowerDetonated ( struct FVector const& HitLocation, struct FVector const& HitNormal, class ASFXProjectile_PowerCustomAction* oProjectile, class AActor* HitActor )
 {
-	static UFunction* pFnOnPowerDetonated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowerDetonatedRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnPowerDetonated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowerDetonated )
-		pFnOnPowerDetonated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnPowerDetonated" );
+	UFunction* const pFnOnPowerDetonated = pFnOnPowerDetonatedRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execOnPowerDetonated_Parms OnPowerDetonated_Parms;
 	memcpy ( &OnPowerDetonated_Parms.HitLocation, &HitLocation, 0xC );
@@ -7407,10 +6821,9 @@ void USFXPowerCustomAction_Singularity::OnPowerDetonated ( struct FVector const&
 
 void USFXPowerCustomAction_Singularity::ReleasePower ( )
 {
-	static UFunction* pFnReleasePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReleasePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ReleasePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReleasePower )
-		pFnReleasePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ReleasePower" );
+	UFunction* const pFnReleasePower = pFnReleasePowerRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execReleasePower_Parms ReleasePower_Parms;
 
@@ -7425,10 +6838,9 @@ void USFXPowerCustomAction_Singularity::ReleasePower ( )
 
 float USFXPowerCustomAction_Singularity::GetImpactForce ( class AActor* oImpacted )
 {
-	static UFunction* pFnGetImpactForce = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetImpactForceRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.GetImpactForce", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetImpactForce )
-		pFnGetImpactForce = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.GetImpactForce" );
+	UFunction* const pFnGetImpactForce = pFnGetImpactForceRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execGetImpactForce_Parms GetImpactForce_Parms;
 	GetImpactForce_Parms.oImpacted = oImpacted;
@@ -7444,10 +6856,9 @@ float USFXPowerCustomAction_Singularity::GetImpactForce ( class AActor* oImpacte
 
 void USFXPowerCustomAction_Singularity::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -7460,10 +6871,9 @@ void USFXPowerCustomAction_Singularity::StartCustomAction ( )
 
 void USFXPowerCustomAction_Singularity::OnPowersLoaded ( )
 {
-	static UFunction* pFnOnPowersLoaded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowersLoadedRef { L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnPowersLoaded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowersLoaded )
-		pFnOnPowersLoaded = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnPowersLoaded" );
+	UFunction* const pFnOnPowersLoaded = pFnOnPowersLoadedRef.Get ( );
 
 	USFXPowerCustomAction_Singularity_execOnPowersLoaded_Parms OnPowersLoaded_Parms;
 
@@ -7472,14 +6882,11 @@ void USFXPowerCustomAction_Singularity::OnPowersLoaded ( )
 
 
 
-class UClass* USFXPowerCustomAction_AdeptPassive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_AdeptPassive::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_AdeptPassive", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_AdeptPassive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_AdeptPassive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.PopulatePowerStatBarEvolves
@@ -7488,10 +6895,9 @@ class UClass* USFXPowerCustomAction_AdeptPassive::StaticClass()
 
 void USFXPowerCustomAction_AdeptPassive::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_AdeptPassive_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -7505,10 +6911,9 @@ void USFXPowerCustomAction_AdeptPassive::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_AdeptPassive::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_AdeptPassive_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -7523,10 +6928,9 @@ void USFXPowerCustomAction_AdeptPassive::RecalculateAllPowerData ( unsigned long
 
 void USFXPowerCustomAction_AdeptPassive::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_AdeptPassive_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -7542,10 +6946,9 @@ void USFXPowerCustomAction_AdeptPassive::EvolvePower ( unsigned char choice )
 
 void USFXPowerCustomAction_AdeptPassive::OnBioticCombo ( class USFXPowerCustomAction* oPower, class ABioPawn* oTarget )
 {
-	static UFunction* pFnOnBioticCombo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnBioticComboRef { L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.OnBioticCombo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnBioticCombo )
-		pFnOnBioticCombo = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.OnBioticCombo" );
+	UFunction* const pFnOnBioticCombo = pFnOnBioticComboRef.Get ( );
 
 	USFXPowerCustomAction_AdeptPassive_execOnBioticCombo_Parms OnBioticCombo_Parms;
 	OnBioticCombo_Parms.oPower = oPower;
@@ -7560,10 +6963,9 @@ void USFXPowerCustomAction_AdeptPassive::OnBioticCombo ( class USFXPowerCustomAc
 
 void USFXPowerCustomAction_AdeptPassive::ResetPower ( )
 {
-	static UFunction* pFnResetPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResetPowerRef { L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.ResetPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResetPower )
-		pFnResetPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.ResetPower" );
+	UFunction* const pFnResetPower = pFnResetPowerRef.Get ( );
 
 	USFXPowerCustomAction_AdeptPassive_execResetPower_Parms ResetPower_Parms;
 
@@ -7576,10 +6978,9 @@ void USFXPowerCustomAction_AdeptPassive::ResetPower ( )
 
 void USFXPowerCustomAction_AdeptPassive::ApplyGlobalBonus ( )
 {
-	static UFunction* pFnApplyGlobalBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyGlobalBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.ApplyGlobalBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyGlobalBonus )
-		pFnApplyGlobalBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.ApplyGlobalBonus" );
+	UFunction* const pFnApplyGlobalBonus = pFnApplyGlobalBonusRef.Get ( );
 
 	USFXPowerCustomAction_AdeptPassive_execApplyGlobalBonus_Parms ApplyGlobalBonus_Parms;
 
@@ -7588,14 +6989,11 @@ void USFXPowerCustomAction_AdeptPassive::ApplyGlobalBonus ( )
 
 
 
-class UClass* USFXPowerCustomAction_Unity::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_Unity::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_Unity", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_Unity::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_Unity" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_Unity.RecalculateAllPowerData
@@ -7605,10 +7003,9 @@ class UClass* USFXPowerCustomAction_Unity::StaticClass()
 
 void USFXPowerCustomAction_Unity::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_Unity.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Unity.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_Unity_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -7623,10 +7020,9 @@ void USFXPowerCustomAction_Unity::RecalculateAllPowerData ( unsigned long bReset
 
 FString USFXPowerCustomAction_Unity::eventGetHUDWheelIconInfo ( )
 {
-	static UFunction* pFnGetHUDWheelIconInfo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetHUDWheelIconInfoRef { L"Function SFXGameContent.SFXPowerCustomAction_Unity.GetHUDWheelIconInfo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetHUDWheelIconInfo )
-		pFnGetHUDWheelIconInfo = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Unity.GetHUDWheelIconInfo" );
+	UFunction* const pFnGetHUDWheelIconInfo = pFnGetHUDWheelIconInfoRef.Get ( );
 
 	USFXPowerCustomAction_Unity_eventGetHUDWheelIconInfo_Parms GetHUDWheelIconInfo_Parms;
 
@@ -7643,10 +7039,9 @@ FString USFXPowerCustomAction_Unity::eventGetHUDWheelIconInfo ( )
 
 int USFXPowerCustomAction_Unity::CountMediGel ( class ABioBaseSquad* oPlayerSquad )
 {
-	static UFunction* pFnCountMediGel = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCountMediGelRef { L"Function SFXGameContent.SFXPowerCustomAction_Unity.CountMediGel", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCountMediGel )
-		pFnCountMediGel = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Unity.CountMediGel" );
+	UFunction* const pFnCountMediGel = pFnCountMediGelRef.Get ( );
 
 	USFXPowerCustomAction_Unity_execCountMediGel_Parms CountMediGel_Parms;
 	CountMediGel_Parms.oPlayerSquad = oPlayerSquad;
@@ -7665,10 +7060,9 @@ int USFXPowerCustomAction_Unity::CountMediGel ( class ABioBaseSquad* oPlayerSqua
 
 bool USFXPowerCustomAction_Unity::eventShouldUsePower ( class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Unity.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Unity.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_Unity_eventShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Target = Target;
@@ -7696,10 +7090,9 @@ bool USFXPowerCustomAction_Unity::eventShouldUsePower ( class AActor* Target, FS
 
 bool USFXPowerCustomAction_Unity::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Unity.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Unity.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerCustomAction_Unity_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -7719,10 +7112,9 @@ bool USFXPowerCustomAction_Unity::OnImpact ( unsigned char Resistance, class AAc
 
 void USFXPowerCustomAction_Unity::StartPower ( )
 {
-	static UFunction* pFnStartPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Unity.StartPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPower )
-		pFnStartPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Unity.StartPower" );
+	UFunction* const pFnStartPower = pFnStartPowerRef.Get ( );
 
 	USFXPowerCustomAction_Unity_execStartPower_Parms StartPower_Parms;
 
@@ -7737,10 +7129,9 @@ void USFXPowerCustomAction_Unity::StartPower ( )
 
 bool USFXPowerCustomAction_Unity::CanUsePower ( class AActor* oTarget )
 {
-	static UFunction* pFnCanUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Unity.CanUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanUsePower )
-		pFnCanUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Unity.CanUsePower" );
+	UFunction* const pFnCanUsePower = pFnCanUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_Unity_execCanUsePower_Parms CanUsePower_Parms;
 	CanUsePower_Parms.oTarget = oTarget;
@@ -7752,14 +7143,11 @@ bool USFXPowerCustomAction_Unity::CanUsePower ( class AActor* oTarget )
 
 
 
-class UClass* USFXCustomAction_AdeptPunch::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_AdeptPunch::pClassPointer { L"Class SFXGameContent.SFXCustomAction_AdeptPunch", &UObject::FindClass };
 
 class UClass* USFXCustomAction_AdeptPunch::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_AdeptPunch" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_AdeptPunch.StopMove
@@ -7768,10 +7156,9 @@ class UClass* USFXCustomAction_AdeptPunch::StaticClass()
 
 void USFXCustomAction_AdeptPunch::StopMove ( )
 {
-	static UFunction* pFnStopMove = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopMoveRef { L"Function SFXGameContent.SFXCustomAction_AdeptPunch.StopMove", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopMove )
-		pFnStopMove = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_AdeptPunch.StopMove" );
+	UFunction* const pFnStopMove = pFnStopMoveRef.Get ( );
 
 	USFXCustomAction_AdeptPunch_execStopMove_Parms StopMove_Parms;
 
@@ -7790,10 +7177,9 @@ void USFXCustomAction_AdeptPunch::StopMove ( )
 
 bool USFXCustomAction_AdeptPunch::OnActorImpacted ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnActorImpacted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnActorImpactedRef { L"Function SFXGameContent.SFXCustomAction_AdeptPunch.OnActorImpacted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnActorImpacted )
-		pFnOnActorImpacted = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_AdeptPunch.OnActorImpacted" );
+	UFunction* const pFnOnActorImpacted = pFnOnActorImpactedRef.Get ( );
 
 	USFXCustomAction_AdeptPunch_execOnActorImpacted_Parms OnActorImpacted_Parms;
 	OnActorImpacted_Parms.Resistance = Resistance;
@@ -7809,62 +7195,47 @@ bool USFXCustomAction_AdeptPunch::OnActorImpacted ( unsigned char Resistance, cl
 
 
 
-class UClass* USFXCustomAction_AdeptSyncCoverGrab::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_AdeptSyncCoverGrab::pClassPointer { L"Class SFXGameContent.SFXCustomAction_AdeptSyncCoverGrab", &UObject::FindClass };
 
 class UClass* USFXCustomAction_AdeptSyncCoverGrab::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_AdeptSyncCoverGrab" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_AdeptHeavyMelee::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_AdeptHeavyMelee::pClassPointer { L"Class SFXGameContent.SFXDamageType_AdeptHeavyMelee", &UObject::FindClass };
 
 class UClass* USFXDamageType_AdeptHeavyMelee::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_AdeptHeavyMelee" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXSeqEvt_PerformedMeleeOverCover::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqEvt_PerformedMeleeOverCover::pClassPointer { L"Class SFXGameContent.SFXSeqEvt_PerformedMeleeOverCover", &UObject::FindClass };
 
 class UClass* USFXSeqEvt_PerformedMeleeOverCover::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqEvt_PerformedMeleeOverCover" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_Meleed::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_Meleed::pClassPointer { L"Class SFXGameContent.SFXCustomAction_Meleed", &UObject::FindClass };
 
 class UClass* USFXCustomAction_Meleed::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_Meleed" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_DisableAI::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_DisableAI::pClassPointer { L"Class SFXGameContent.SFXGameEffect_DisableAI", &UObject::FindClass };
 
 class UClass* USFXGameEffect_DisableAI::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_DisableAI" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_DisableAI.OnRemoved
@@ -7873,10 +7244,9 @@ class UClass* USFXGameEffect_DisableAI::StaticClass()
 
 void USFXGameEffect_DisableAI::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_DisableAI.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_DisableAI.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_DisableAI_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -7889,10 +7259,9 @@ void USFXGameEffect_DisableAI::OnRemoved ( )
 
 void USFXGameEffect_DisableAI::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_DisableAI.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_DisableAI.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_DisableAI_execOnApplied_Parms OnApplied_Parms;
 
@@ -7901,290 +7270,218 @@ void USFXGameEffect_DisableAI::OnApplied ( )
 
 
 
-class UClass* USFXCustomAction_PlayerKnockbackImpact::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerKnockbackImpact::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerKnockbackImpact", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerKnockbackImpact::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerKnockbackImpact" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_PlayerStaggerImpact::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_PlayerStaggerImpact::pClassPointer { L"Class SFXGameContent.SFXCustomAction_PlayerStaggerImpact", &UObject::FindClass };
 
 class UClass* USFXCustomAction_PlayerStaggerImpact::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_PlayerStaggerImpact" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_AdeptHeavyMelee_NoRagdoll::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_AdeptHeavyMelee_NoRagdoll::pClassPointer { L"Class SFXGameContent.SFXDamageType_AdeptHeavyMelee_NoRagdoll", &UObject::FindClass };
 
 class UClass* USFXDamageType_AdeptHeavyMelee_NoRagdoll::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_AdeptHeavyMelee_NoRagdoll" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_BioticExplosion::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_BioticExplosion::pClassPointer { L"Class SFXGameContent.SFXDamageType_BioticExplosion", &UObject::FindClass };
 
 class UClass* USFXDamageType_BioticExplosion::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_BioticExplosion" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_BioticExplosion_NoRagdoll::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_BioticExplosion_NoRagdoll::pClassPointer { L"Class SFXGameContent.SFXDamageType_BioticExplosion_NoRagdoll", &UObject::FindClass };
 
 class UClass* USFXDamageType_BioticExplosion_NoRagdoll::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_BioticExplosion_NoRagdoll" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_BioticGrenade::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_BioticGrenade::pClassPointer { L"Class SFXGameContent.SFXDamageType_BioticGrenade", &UObject::FindClass };
 
 class UClass* USFXDamageType_BioticGrenade::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_BioticGrenade" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_BioticGrenade_NoRagdoll::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_BioticGrenade_NoRagdoll::pClassPointer { L"Class SFXGameContent.SFXDamageType_BioticGrenade_NoRagdoll", &UObject::FindClass };
 
 class UClass* USFXDamageType_BioticGrenade_NoRagdoll::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_BioticGrenade_NoRagdoll" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_CryoExplosion::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_CryoExplosion::pClassPointer { L"Class SFXGameContent.SFXDamageType_CryoExplosion", &UObject::FindClass };
 
 class UClass* USFXDamageType_CryoExplosion::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_CryoExplosion" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_ElectricCombo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_ElectricCombo::pClassPointer { L"Class SFXGameContent.SFXDamageType_ElectricCombo", &UObject::FindClass };
 
 class UClass* USFXDamageType_ElectricCombo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_ElectricCombo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_FireExplosion::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_FireExplosion::pClassPointer { L"Class SFXGameContent.SFXDamageType_FireExplosion", &UObject::FindClass };
 
 class UClass* USFXDamageType_FireExplosion::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_FireExplosion" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Warp::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Warp::pClassPointer { L"Class SFXGameContent.SFXDamageType_Warp", &UObject::FindClass };
 
 class UClass* USFXDamageType_Warp::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Warp" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_ImprovedWarp::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_ImprovedWarp::pClassPointer { L"Class SFXGameContent.SFXDamageType_ImprovedWarp", &UObject::FindClass };
 
 class UClass* USFXDamageType_ImprovedWarp::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_ImprovedWarp" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_WarpDoT::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_WarpDoT::pClassPointer { L"Class SFXGameContent.SFXDamageType_WarpDoT", &UObject::FindClass };
 
 class UClass* USFXDamageType_WarpDoT::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_WarpDoT" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_ImprovedWarpDoT::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_ImprovedWarpDoT::pClassPointer { L"Class SFXGameContent.SFXDamageType_ImprovedWarpDoT", &UObject::FindClass };
 
 class UClass* USFXDamageType_ImprovedWarpDoT::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_ImprovedWarpDoT" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Pull::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Pull::pClassPointer { L"Class SFXGameContent.SFXDamageType_Pull", &UObject::FindClass };
 
 class UClass* USFXDamageType_Pull::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Pull" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Pull_DoT::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Pull_DoT::pClassPointer { L"Class SFXGameContent.SFXDamageType_Pull_DoT", &UObject::FindClass };
 
 class UClass* USFXDamageType_Pull_DoT::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Pull_DoT" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Shockwave::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Shockwave::pClassPointer { L"Class SFXGameContent.SFXDamageType_Shockwave", &UObject::FindClass };
 
 class UClass* USFXDamageType_Shockwave::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Shockwave" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Shockwave_NoRagdoll::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Shockwave_NoRagdoll::pClassPointer { L"Class SFXGameContent.SFXDamageType_Shockwave_NoRagdoll", &UObject::FindClass };
 
 class UClass* USFXDamageType_Shockwave_NoRagdoll::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Shockwave_NoRagdoll" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Singularity::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Singularity::pClassPointer { L"Class SFXGameContent.SFXDamageType_Singularity", &UObject::FindClass };
 
 class UClass* USFXDamageType_Singularity::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Singularity" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Singularity_DoT::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Singularity_DoT::pClassPointer { L"Class SFXGameContent.SFXDamageType_Singularity_DoT", &UObject::FindClass };
 
 class UClass* USFXDamageType_Singularity_DoT::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Singularity_DoT" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Singularity_Explosion::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Singularity_Explosion::pClassPointer { L"Class SFXGameContent.SFXDamageType_Singularity_Explosion", &UObject::FindClass };
 
 class UClass* USFXDamageType_Singularity_Explosion::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Singularity_Explosion" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Singularity_NoRagdoll::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Singularity_NoRagdoll::pClassPointer { L"Class SFXGameContent.SFXDamageType_Singularity_NoRagdoll", &UObject::FindClass };
 
 class UClass* USFXDamageType_Singularity_NoRagdoll::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Singularity_NoRagdoll" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Throw::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Throw::pClassPointer { L"Class SFXGameContent.SFXDamageType_Throw", &UObject::FindClass };
 
 class UClass* USFXDamageType_Throw::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Throw" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_AntiGravity::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_AntiGravity::pClassPointer { L"Class SFXGameContent.SFXGameEffect_AntiGravity", &UObject::FindClass };
 
 class UClass* USFXGameEffect_AntiGravity::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_AntiGravity" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_AntiGravity.OnRemoved
@@ -8193,10 +7490,9 @@ class UClass* USFXGameEffect_AntiGravity::StaticClass()
 
 void USFXGameEffect_AntiGravity::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_AntiGravity.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_AntiGravity.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_AntiGravity_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -8209,10 +7505,9 @@ void USFXGameEffect_AntiGravity::OnRemoved ( )
 
 void USFXGameEffect_AntiGravity::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_AntiGravity.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_AntiGravity.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_AntiGravity_execOnApplied_Parms OnApplied_Parms;
 
@@ -8221,14 +7516,11 @@ void USFXGameEffect_AntiGravity::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_ArmorWeakness::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_ArmorWeakness::pClassPointer { L"Class SFXGameContent.SFXGameEffect_ArmorWeakness", &UObject::FindClass };
 
 class UClass* USFXGameEffect_ArmorWeakness::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_ArmorWeakness" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_ArmorWeakness.OnRemoved
@@ -8237,10 +7529,9 @@ class UClass* USFXGameEffect_ArmorWeakness::StaticClass()
 
 void USFXGameEffect_ArmorWeakness::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_ArmorWeakness.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_ArmorWeakness.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_ArmorWeakness_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -8253,10 +7544,9 @@ void USFXGameEffect_ArmorWeakness::OnRemoved ( )
 
 void USFXGameEffect_ArmorWeakness::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_ArmorWeakness.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_ArmorWeakness.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_ArmorWeakness_execOnApplied_Parms OnApplied_Parms;
 
@@ -8265,14 +7555,11 @@ void USFXGameEffect_ArmorWeakness::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_BioticPowerDamageTakenBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_BioticPowerDamageTakenBonus::pClassPointer { L"Class SFXGameContent.SFXGameEffect_BioticPowerDamageTakenBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_BioticPowerDamageTakenBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_BioticPowerDamageTakenBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_BioticPowerDamageTakenBonus.OnRemoved
@@ -8281,10 +7568,9 @@ class UClass* USFXGameEffect_BioticPowerDamageTakenBonus::StaticClass()
 
 void USFXGameEffect_BioticPowerDamageTakenBonus::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_BioticPowerDamageTakenBonus.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_BioticPowerDamageTakenBonus.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_BioticPowerDamageTakenBonus_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -8297,10 +7583,9 @@ void USFXGameEffect_BioticPowerDamageTakenBonus::OnRemoved ( )
 
 void USFXGameEffect_BioticPowerDamageTakenBonus::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_BioticPowerDamageTakenBonus.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_BioticPowerDamageTakenBonus.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_BioticPowerDamageTakenBonus_execOnApplied_Parms OnApplied_Parms;
 
@@ -8309,14 +7594,11 @@ void USFXGameEffect_BioticPowerDamageTakenBonus::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_CryoFreeze::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_CryoFreeze::pClassPointer { L"Class SFXGameContent.SFXGameEffect_CryoFreeze", &UObject::FindClass };
 
 class UClass* USFXGameEffect_CryoFreeze::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_CryoFreeze" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_CryoFreeze.OnRemoved
@@ -8325,10 +7607,9 @@ class UClass* USFXGameEffect_CryoFreeze::StaticClass()
 
 void USFXGameEffect_CryoFreeze::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_CryoFreeze.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_CryoFreeze.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_CryoFreeze_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -8342,10 +7623,9 @@ void USFXGameEffect_CryoFreeze::OnRemoved ( )
 
 void USFXGameEffect_CryoFreeze::OnUpdate ( float DeltaSeconds )
 {
-	static UFunction* pFnOnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUpdateRef { L"Function SFXGameContent.SFXGameEffect_CryoFreeze.OnUpdate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUpdate )
-		pFnOnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_CryoFreeze.OnUpdate" );
+	UFunction* const pFnOnUpdate = pFnOnUpdateRef.Get ( );
 
 	USFXGameEffect_CryoFreeze_execOnUpdate_Parms OnUpdate_Parms;
 	OnUpdate_Parms.DeltaSeconds = DeltaSeconds;
@@ -8359,10 +7639,9 @@ void USFXGameEffect_CryoFreeze::OnUpdate ( float DeltaSeconds )
 
 void USFXGameEffect_CryoFreeze::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_CryoFreeze.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_CryoFreeze.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_CryoFreeze_execOnApplied_Parms OnApplied_Parms;
 
@@ -8376,10 +7655,9 @@ void USFXGameEffect_CryoFreeze::OnApplied ( )
 
 void USFXGameEffect_CryoFreeze::OnFrozenPawnDied ( class ABioPawn* oPawn )
 {
-	static UFunction* pFnOnFrozenPawnDied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnFrozenPawnDiedRef { L"Function SFXGameContent.SFXGameEffect_CryoFreeze.OnFrozenPawnDied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnFrozenPawnDied )
-		pFnOnFrozenPawnDied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_CryoFreeze.OnFrozenPawnDied" );
+	UFunction* const pFnOnFrozenPawnDied = pFnOnFrozenPawnDiedRef.Get ( );
 
 	USFXGameEffect_CryoFreeze_execOnFrozenPawnDied_Parms OnFrozenPawnDied_Parms;
 	OnFrozenPawnDied_Parms.oPawn = oPawn;
@@ -8389,14 +7667,11 @@ void USFXGameEffect_CryoFreeze::OnFrozenPawnDied ( class ABioPawn* oPawn )
 
 
 
-class UClass* USFXGameEffect_DamageImmunity::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_DamageImmunity::pClassPointer { L"Class SFXGameContent.SFXGameEffect_DamageImmunity", &UObject::FindClass };
 
 class UClass* USFXGameEffect_DamageImmunity::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_DamageImmunity" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_DamageImmunity.OnRemoved
@@ -8405,10 +7680,9 @@ class UClass* USFXGameEffect_DamageImmunity::StaticClass()
 
 void USFXGameEffect_DamageImmunity::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_DamageImmunity.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_DamageImmunity.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_DamageImmunity_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -8421,10 +7695,9 @@ void USFXGameEffect_DamageImmunity::OnRemoved ( )
 
 void USFXGameEffect_DamageImmunity::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_DamageImmunity.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_DamageImmunity.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_DamageImmunity_execOnApplied_Parms OnApplied_Parms;
 
@@ -8433,14 +7706,11 @@ void USFXGameEffect_DamageImmunity::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_DelayedCryoFreeze::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_DelayedCryoFreeze::pClassPointer { L"Class SFXGameContent.SFXGameEffect_DelayedCryoFreeze", &UObject::FindClass };
 
 class UClass* USFXGameEffect_DelayedCryoFreeze::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_DelayedCryoFreeze" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_DelayedCryoFreeze.OnRemoved
@@ -8449,10 +7719,9 @@ class UClass* USFXGameEffect_DelayedCryoFreeze::StaticClass()
 
 void USFXGameEffect_DelayedCryoFreeze::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_DelayedCryoFreeze.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_DelayedCryoFreeze.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_DelayedCryoFreeze_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -8466,10 +7735,9 @@ void USFXGameEffect_DelayedCryoFreeze::OnRemoved ( )
 
 void USFXGameEffect_DelayedCryoFreeze::OnUpdate ( float DeltaSeconds )
 {
-	static UFunction* pFnOnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUpdateRef { L"Function SFXGameContent.SFXGameEffect_DelayedCryoFreeze.OnUpdate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUpdate )
-		pFnOnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_DelayedCryoFreeze.OnUpdate" );
+	UFunction* const pFnOnUpdate = pFnOnUpdateRef.Get ( );
 
 	USFXGameEffect_DelayedCryoFreeze_execOnUpdate_Parms OnUpdate_Parms;
 	OnUpdate_Parms.DeltaSeconds = DeltaSeconds;
@@ -8483,10 +7751,9 @@ void USFXGameEffect_DelayedCryoFreeze::OnUpdate ( float DeltaSeconds )
 
 void USFXGameEffect_DelayedCryoFreeze::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_DelayedCryoFreeze.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_DelayedCryoFreeze.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_DelayedCryoFreeze_execOnApplied_Parms OnApplied_Parms;
 
@@ -8500,10 +7767,9 @@ void USFXGameEffect_DelayedCryoFreeze::OnApplied ( )
 
 void USFXGameEffect_DelayedCryoFreeze::OnFrozenPawnDied ( class ABioPawn* oPawn )
 {
-	static UFunction* pFnOnFrozenPawnDied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnFrozenPawnDiedRef { L"Function SFXGameContent.SFXGameEffect_DelayedCryoFreeze.OnFrozenPawnDied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnFrozenPawnDied )
-		pFnOnFrozenPawnDied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_DelayedCryoFreeze.OnFrozenPawnDied" );
+	UFunction* const pFnOnFrozenPawnDied = pFnOnFrozenPawnDiedRef.Get ( );
 
 	USFXGameEffect_DelayedCryoFreeze_execOnFrozenPawnDied_Parms OnFrozenPawnDied_Parms;
 	OnFrozenPawnDied_Parms.oPawn = oPawn;
@@ -8513,14 +7779,11 @@ void USFXGameEffect_DelayedCryoFreeze::OnFrozenPawnDied ( class ABioPawn* oPawn
 
 
 
-class UClass* USFXGameEffect_PowerCombo_Cryo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_PowerCombo_Cryo::pClassPointer { L"Class SFXGameContent.SFXGameEffect_PowerCombo_Cryo", &UObject::FindClass };
 
 class UClass* USFXGameEffect_PowerCombo_Cryo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_PowerCombo_Cryo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_PowerCombo_Cryo.OnImpact
@@ -8535,10 +7798,9 @@ class UClass* USFXGameEffect_PowerCombo_Cryo::StaticClass()
 
 bool USFXGameEffect_PowerCombo_Cryo::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXGameEffect_PowerCombo_Cryo.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_PowerCombo_Cryo.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXGameEffect_PowerCombo_Cryo_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -8554,14 +7816,11 @@ bool USFXGameEffect_PowerCombo_Cryo::OnImpact ( unsigned char Resistance, class
 
 
 
-class UClass* USFXGameEffect_ElectricComboBeam::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_ElectricComboBeam::pClassPointer { L"Class SFXGameContent.SFXGameEffect_ElectricComboBeam", &UObject::FindClass };
 
 class UClass* USFXGameEffect_ElectricComboBeam::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_ElectricComboBeam" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_ElectricComboBeam.OnRemoved
@@ -8570,10 +7829,9 @@ class UClass* USFXGameEffect_ElectricComboBeam::StaticClass()
 
 void USFXGameEffect_ElectricComboBeam::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_ElectricComboBeam.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_ElectricComboBeam.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_ElectricComboBeam_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -8587,10 +7845,9 @@ void USFXGameEffect_ElectricComboBeam::OnRemoved ( )
 
 void USFXGameEffect_ElectricComboBeam::OnUpdate ( float DeltaSeconds )
 {
-	static UFunction* pFnOnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUpdateRef { L"Function SFXGameContent.SFXGameEffect_ElectricComboBeam.OnUpdate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUpdate )
-		pFnOnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_ElectricComboBeam.OnUpdate" );
+	UFunction* const pFnOnUpdate = pFnOnUpdateRef.Get ( );
 
 	USFXGameEffect_ElectricComboBeam_execOnUpdate_Parms OnUpdate_Parms;
 	OnUpdate_Parms.DeltaSeconds = DeltaSeconds;
@@ -8606,10 +7863,9 @@ void USFXGameEffect_ElectricComboBeam::OnUpdate ( float DeltaSeconds )
 
 void USFXGameEffect_ElectricComboBeam::PlayBeamEffect ( class UParticleSystemComponent* PS, struct FVector const& TargetLocation )
 {
-	static UFunction* pFnPlayBeamEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayBeamEffectRef { L"Function SFXGameContent.SFXGameEffect_ElectricComboBeam.PlayBeamEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayBeamEffect )
-		pFnPlayBeamEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_ElectricComboBeam.PlayBeamEffect" );
+	UFunction* const pFnPlayBeamEffect = pFnPlayBeamEffectRef.Get ( );
 
 	USFXGameEffect_ElectricComboBeam_execPlayBeamEffect_Parms PlayBeamEffect_Parms;
 	PlayBeamEffect_Parms.PS = PS;
@@ -8624,10 +7880,9 @@ void USFXGameEffect_ElectricComboBeam::PlayBeamEffect ( class UParticleSystemCom
 
 void USFXGameEffect_ElectricComboBeam::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_ElectricComboBeam.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_ElectricComboBeam.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_ElectricComboBeam_execOnApplied_Parms OnApplied_Parms;
 
@@ -8636,14 +7891,11 @@ void USFXGameEffect_ElectricComboBeam::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_FireDamageOverTime::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_FireDamageOverTime::pClassPointer { L"Class SFXGameContent.SFXGameEffect_FireDamageOverTime", &UObject::FindClass };
 
 class UClass* USFXGameEffect_FireDamageOverTime::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_FireDamageOverTime" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_FireDamageOverTime.DoDamage
@@ -8652,10 +7904,9 @@ class UClass* USFXGameEffect_FireDamageOverTime::StaticClass()
 
 void USFXGameEffect_FireDamageOverTime::DoDamage ( )
 {
-	static UFunction* pFnDoDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoDamageRef { L"Function SFXGameContent.SFXGameEffect_FireDamageOverTime.DoDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoDamage )
-		pFnDoDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_FireDamageOverTime.DoDamage" );
+	UFunction* const pFnDoDamage = pFnDoDamageRef.Get ( );
 
 	USFXGameEffect_FireDamageOverTime_execDoDamage_Parms DoDamage_Parms;
 
@@ -8670,10 +7921,9 @@ void USFXGameEffect_FireDamageOverTime::DoDamage ( )
 
 void USFXGameEffect_FireDamageOverTime::AddFireDamage ( float AddedDamage, float NewDuration )
 {
-	static UFunction* pFnAddFireDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddFireDamageRef { L"Function SFXGameContent.SFXGameEffect_FireDamageOverTime.AddFireDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddFireDamage )
-		pFnAddFireDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_FireDamageOverTime.AddFireDamage" );
+	UFunction* const pFnAddFireDamage = pFnAddFireDamageRef.Get ( );
 
 	USFXGameEffect_FireDamageOverTime_execAddFireDamage_Parms AddFireDamage_Parms;
 	AddFireDamage_Parms.AddedDamage = AddedDamage;
@@ -8688,10 +7938,9 @@ void USFXGameEffect_FireDamageOverTime::AddFireDamage ( float AddedDamage, float
 
 void USFXGameEffect_FireDamageOverTime::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_FireDamageOverTime.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_FireDamageOverTime.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_FireDamageOverTime_execOnApplied_Parms OnApplied_Parms;
 
@@ -8700,14 +7949,11 @@ void USFXGameEffect_FireDamageOverTime::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_PowerCombo_Fire::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_PowerCombo_Fire::pClassPointer { L"Class SFXGameContent.SFXGameEffect_PowerCombo_Fire", &UObject::FindClass };
 
 class UClass* USFXGameEffect_PowerCombo_Fire::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_PowerCombo_Fire" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_PowerCombo_Fire.OnImpact
@@ -8722,10 +7968,9 @@ class UClass* USFXGameEffect_PowerCombo_Fire::StaticClass()
 
 bool USFXGameEffect_PowerCombo_Fire::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXGameEffect_PowerCombo_Fire.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_PowerCombo_Fire.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXGameEffect_PowerCombo_Fire_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -8748,10 +7993,9 @@ bool USFXGameEffect_PowerCombo_Fire::OnImpact ( unsigned char Resistance, class
 
 void USFXGameEffect_PowerCombo_Fire::OnPowerComboDetonated ( class USFXPowerCustomAction* DetonationPower, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnPowerComboDetonated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowerComboDetonatedRef { L"Function SFXGameContent.SFXGameEffect_PowerCombo_Fire.OnPowerComboDetonated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowerComboDetonated )
-		pFnOnPowerComboDetonated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_PowerCombo_Fire.OnPowerComboDetonated" );
+	UFunction* const pFnOnPowerComboDetonated = pFnOnPowerComboDetonatedRef.Get ( );
 
 	USFXGameEffect_PowerCombo_Fire_execOnPowerComboDetonated_Parms OnPowerComboDetonated_Parms;
 	OnPowerComboDetonated_Parms.DetonationPower = DetonationPower;
@@ -8763,14 +8007,11 @@ void USFXGameEffect_PowerCombo_Fire::OnPowerComboDetonated ( class USFXPowerCust
 
 
 
-class UClass* USFXGameEffect_HealShieldOverTime::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_HealShieldOverTime::pClassPointer { L"Class SFXGameContent.SFXGameEffect_HealShieldOverTime", &UObject::FindClass };
 
 class UClass* USFXGameEffect_HealShieldOverTime::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_HealShieldOverTime" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_HealShieldOverTime.OnUpdate
@@ -8780,10 +8021,9 @@ class UClass* USFXGameEffect_HealShieldOverTime::StaticClass()
 
 void USFXGameEffect_HealShieldOverTime::OnUpdate ( float DeltaSeconds )
 {
-	static UFunction* pFnOnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUpdateRef { L"Function SFXGameContent.SFXGameEffect_HealShieldOverTime.OnUpdate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUpdate )
-		pFnOnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_HealShieldOverTime.OnUpdate" );
+	UFunction* const pFnOnUpdate = pFnOnUpdateRef.Get ( );
 
 	USFXGameEffect_HealShieldOverTime_execOnUpdate_Parms OnUpdate_Parms;
 	OnUpdate_Parms.DeltaSeconds = DeltaSeconds;
@@ -8793,14 +8033,11 @@ void USFXGameEffect_HealShieldOverTime::OnUpdate ( float DeltaSeconds )
 
 
 
-class UClass* USFXGameEffect_MaxGrenadeBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_MaxGrenadeBonus::pClassPointer { L"Class SFXGameContent.SFXGameEffect_MaxGrenadeBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_MaxGrenadeBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_MaxGrenadeBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_MaxGrenadeBonus.OnRemoved
@@ -8809,10 +8046,9 @@ class UClass* USFXGameEffect_MaxGrenadeBonus::StaticClass()
 
 void USFXGameEffect_MaxGrenadeBonus::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_MaxGrenadeBonus.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_MaxGrenadeBonus.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_MaxGrenadeBonus_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -8825,10 +8061,9 @@ void USFXGameEffect_MaxGrenadeBonus::OnRemoved ( )
 
 void USFXGameEffect_MaxGrenadeBonus::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_MaxGrenadeBonus.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_MaxGrenadeBonus.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_MaxGrenadeBonus_execOnApplied_Parms OnApplied_Parms;
 
@@ -8837,14 +8072,11 @@ void USFXGameEffect_MaxGrenadeBonus::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_PowerCombo_Biotic::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_PowerCombo_Biotic::pClassPointer { L"Class SFXGameContent.SFXGameEffect_PowerCombo_Biotic", &UObject::FindClass };
 
 class UClass* USFXGameEffect_PowerCombo_Biotic::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_PowerCombo_Biotic" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_PowerCombo_Biotic.OnPowerComboDetonated
@@ -8856,10 +8088,9 @@ class UClass* USFXGameEffect_PowerCombo_Biotic::StaticClass()
 
 void USFXGameEffect_PowerCombo_Biotic::OnPowerComboDetonated ( class USFXPowerCustomAction* DetonationPower, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnPowerComboDetonated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowerComboDetonatedRef { L"Function SFXGameContent.SFXGameEffect_PowerCombo_Biotic.OnPowerComboDetonated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowerComboDetonated )
-		pFnOnPowerComboDetonated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_PowerCombo_Biotic.OnPowerComboDetonated" );
+	UFunction* const pFnOnPowerComboDetonated = pFnOnPowerComboDetonatedRef.Get ( );
 
 	USFXGameEffect_PowerCombo_Biotic_execOnPowerComboDetonated_Parms OnPowerComboDetonated_Parms;
 	OnPowerComboDetonated_Parms.DetonationPower = DetonationPower;
@@ -8871,62 +8102,47 @@ void USFXGameEffect_PowerCombo_Biotic::OnPowerComboDetonated ( class USFXPowerCu
 
 
 
-class UClass* USFXShake_Power_BioticCombo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXShake_Power_BioticCombo::pClassPointer { L"Class SFXGameContent.SFXShake_Power_BioticCombo", &UObject::FindClass };
 
 class UClass* USFXShake_Power_BioticCombo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXShake_Power_BioticCombo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXRumble_Power_BioticCombo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXRumble_Power_BioticCombo::pClassPointer { L"Class SFXGameContent.SFXRumble_Power_BioticCombo", &UObject::FindClass };
 
 class UClass* USFXRumble_Power_BioticCombo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXRumble_Power_BioticCombo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXShake_Power_CryoCombo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXShake_Power_CryoCombo::pClassPointer { L"Class SFXGameContent.SFXShake_Power_CryoCombo", &UObject::FindClass };
 
 class UClass* USFXShake_Power_CryoCombo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXShake_Power_CryoCombo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXRumble_Power_CryoCombo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXRumble_Power_CryoCombo::pClassPointer { L"Class SFXGameContent.SFXRumble_Power_CryoCombo", &UObject::FindClass };
 
 class UClass* USFXRumble_Power_CryoCombo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXRumble_Power_CryoCombo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_PowerCombo_Electric::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_PowerCombo_Electric::pClassPointer { L"Class SFXGameContent.SFXGameEffect_PowerCombo_Electric", &UObject::FindClass };
 
 class UClass* USFXGameEffect_PowerCombo_Electric::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_PowerCombo_Electric" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_PowerCombo_Electric.OnImpact
@@ -8941,10 +8157,9 @@ class UClass* USFXGameEffect_PowerCombo_Electric::StaticClass()
 
 bool USFXGameEffect_PowerCombo_Electric::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXGameEffect_PowerCombo_Electric.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_PowerCombo_Electric.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXGameEffect_PowerCombo_Electric_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -8960,62 +8175,47 @@ bool USFXGameEffect_PowerCombo_Electric::OnImpact ( unsigned char Resistance, cl
 
 
 
-class UClass* USFXShake_Power_ElectricCombo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXShake_Power_ElectricCombo::pClassPointer { L"Class SFXGameContent.SFXShake_Power_ElectricCombo", &UObject::FindClass };
 
 class UClass* USFXShake_Power_ElectricCombo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXShake_Power_ElectricCombo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXRumble_Power_ElectricCombo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXRumble_Power_ElectricCombo::pClassPointer { L"Class SFXGameContent.SFXRumble_Power_ElectricCombo", &UObject::FindClass };
 
 class UClass* USFXRumble_Power_ElectricCombo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXRumble_Power_ElectricCombo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXShake_Power_FireCombo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXShake_Power_FireCombo::pClassPointer { L"Class SFXGameContent.SFXShake_Power_FireCombo", &UObject::FindClass };
 
 class UClass* USFXShake_Power_FireCombo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXShake_Power_FireCombo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXRumble_Power_FireCombo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXRumble_Power_FireCombo::pClassPointer { L"Class SFXGameContent.SFXRumble_Power_FireCombo", &UObject::FindClass };
 
 class UClass* USFXRumble_Power_FireCombo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXRumble_Power_FireCombo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_Pull::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Pull::pClassPointer { L"Class SFXGameContent.SFXGameEffect_Pull", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Pull::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_Pull" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_Pull.OnRemoved
@@ -9024,10 +8224,9 @@ class UClass* USFXGameEffect_Pull::StaticClass()
 
 void USFXGameEffect_Pull::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_Pull.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Pull.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_Pull_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -9041,10 +8240,9 @@ void USFXGameEffect_Pull::OnRemoved ( )
 
 void USFXGameEffect_Pull::MoveActor ( struct FVector const& vForce )
 {
-	static UFunction* pFnMoveActor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnMoveActorRef { L"Function SFXGameContent.SFXGameEffect_Pull.MoveActor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnMoveActor )
-		pFnMoveActor = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Pull.MoveActor" );
+	UFunction* const pFnMoveActor = pFnMoveActorRef.Get ( );
 
 	USFXGameEffect_Pull_execMoveActor_Parms MoveActor_Parms;
 	memcpy ( &MoveActor_Parms.vForce, &vForce, 0xC );
@@ -9059,10 +8257,9 @@ void USFXGameEffect_Pull::MoveActor ( struct FVector const& vForce )
 
 void USFXGameEffect_Pull::OnUpdate ( float DeltaSeconds )
 {
-	static UFunction* pFnOnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUpdateRef { L"Function SFXGameContent.SFXGameEffect_Pull.OnUpdate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUpdate )
-		pFnOnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Pull.OnUpdate" );
+	UFunction* const pFnOnUpdate = pFnOnUpdateRef.Get ( );
 
 	USFXGameEffect_Pull_execOnUpdate_Parms OnUpdate_Parms;
 	OnUpdate_Parms.DeltaSeconds = DeltaSeconds;
@@ -9076,10 +8273,9 @@ void USFXGameEffect_Pull::OnUpdate ( float DeltaSeconds )
 
 void USFXGameEffect_Pull::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_Pull.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Pull.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_Pull_execOnApplied_Parms OnApplied_Parms;
 
@@ -9088,14 +8284,11 @@ void USFXGameEffect_Pull::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_Ragdoll::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Ragdoll::pClassPointer { L"Class SFXGameContent.SFXGameEffect_Ragdoll", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Ragdoll::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_Ragdoll" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_Ragdoll.OnRemoved
@@ -9104,10 +8297,9 @@ class UClass* USFXGameEffect_Ragdoll::StaticClass()
 
 void USFXGameEffect_Ragdoll::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_Ragdoll.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Ragdoll.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_Ragdoll_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -9120,10 +8312,9 @@ void USFXGameEffect_Ragdoll::OnRemoved ( )
 
 void USFXGameEffect_Ragdoll::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_Ragdoll.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Ragdoll.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_Ragdoll_execOnApplied_Parms OnApplied_Parms;
 
@@ -9132,14 +8323,11 @@ void USFXGameEffect_Ragdoll::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_ShockwaveLift::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_ShockwaveLift::pClassPointer { L"Class SFXGameContent.SFXGameEffect_ShockwaveLift", &UObject::FindClass };
 
 class UClass* USFXGameEffect_ShockwaveLift::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_ShockwaveLift" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_ShockwaveLift.HasOtherGravityEffects
@@ -9149,10 +8337,9 @@ class UClass* USFXGameEffect_ShockwaveLift::StaticClass()
 
 bool USFXGameEffect_ShockwaveLift::HasOtherGravityEffects ( )
 {
-	static UFunction* pFnHasOtherGravityEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHasOtherGravityEffectsRef { L"Function SFXGameContent.SFXGameEffect_ShockwaveLift.HasOtherGravityEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHasOtherGravityEffects )
-		pFnHasOtherGravityEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_ShockwaveLift.HasOtherGravityEffects" );
+	UFunction* const pFnHasOtherGravityEffects = pFnHasOtherGravityEffectsRef.Get ( );
 
 	USFXGameEffect_ShockwaveLift_execHasOtherGravityEffects_Parms HasOtherGravityEffects_Parms;
 
@@ -9167,10 +8354,9 @@ bool USFXGameEffect_ShockwaveLift::HasOtherGravityEffects ( )
 
 void USFXGameEffect_ShockwaveLift::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_ShockwaveLift.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_ShockwaveLift.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_ShockwaveLift_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -9184,10 +8370,9 @@ void USFXGameEffect_ShockwaveLift::OnRemoved ( )
 
 void USFXGameEffect_ShockwaveLift::OnUpdate ( float DeltaSeconds )
 {
-	static UFunction* pFnOnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUpdateRef { L"Function SFXGameContent.SFXGameEffect_ShockwaveLift.OnUpdate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUpdate )
-		pFnOnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_ShockwaveLift.OnUpdate" );
+	UFunction* const pFnOnUpdate = pFnOnUpdateRef.Get ( );
 
 	USFXGameEffect_ShockwaveLift_execOnUpdate_Parms OnUpdate_Parms;
 	OnUpdate_Parms.DeltaSeconds = DeltaSeconds;
@@ -9201,10 +8386,9 @@ void USFXGameEffect_ShockwaveLift::OnUpdate ( float DeltaSeconds )
 
 void USFXGameEffect_ShockwaveLift::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_ShockwaveLift.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_ShockwaveLift.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_ShockwaveLift_execOnApplied_Parms OnApplied_Parms;
 
@@ -9213,14 +8397,11 @@ void USFXGameEffect_ShockwaveLift::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_Singularity::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Singularity::pClassPointer { L"Class SFXGameContent.SFXGameEffect_Singularity", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Singularity::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_Singularity" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_Singularity.OutOfRangeCheck
@@ -9231,10 +8412,9 @@ class UClass* USFXGameEffect_Singularity::StaticClass()
 
 bool USFXGameEffect_Singularity::OutOfRangeCheck ( float Distance )
 {
-	static UFunction* pFnOutOfRangeCheck = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOutOfRangeCheckRef { L"Function SFXGameContent.SFXGameEffect_Singularity.OutOfRangeCheck", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOutOfRangeCheck )
-		pFnOutOfRangeCheck = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Singularity.OutOfRangeCheck" );
+	UFunction* const pFnOutOfRangeCheck = pFnOutOfRangeCheckRef.Get ( );
 
 	USFXGameEffect_Singularity_execOutOfRangeCheck_Parms OutOfRangeCheck_Parms;
 	OutOfRangeCheck_Parms.Distance = Distance;
@@ -9251,10 +8431,9 @@ bool USFXGameEffect_Singularity::OutOfRangeCheck ( float Distance )
 
 bool USFXGameEffect_Singularity::IsStillInSingularity ( )
 {
-	static UFunction* pFnIsStillInSingularity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnIsStillInSingularityRef { L"Function SFXGameContent.SFXGameEffect_Singularity.IsStillInSingularity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnIsStillInSingularity )
-		pFnIsStillInSingularity = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Singularity.IsStillInSingularity" );
+	UFunction* const pFnIsStillInSingularity = pFnIsStillInSingularityRef.Get ( );
 
 	USFXGameEffect_Singularity_execIsStillInSingularity_Parms IsStillInSingularity_Parms;
 
@@ -9269,10 +8448,9 @@ bool USFXGameEffect_Singularity::IsStillInSingularity ( )
 
 void USFXGameEffect_Singularity::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_Singularity.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Singularity.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_Singularity_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -9286,10 +8464,9 @@ void USFXGameEffect_Singularity::OnRemoved ( )
 
 void USFXGameEffect_Singularity::AddForceToActor ( struct FVector const& vForce )
 {
-	static UFunction* pFnAddForceToActor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddForceToActorRef { L"Function SFXGameContent.SFXGameEffect_Singularity.AddForceToActor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddForceToActor )
-		pFnAddForceToActor = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Singularity.AddForceToActor" );
+	UFunction* const pFnAddForceToActor = pFnAddForceToActorRef.Get ( );
 
 	USFXGameEffect_Singularity_execAddForceToActor_Parms AddForceToActor_Parms;
 	memcpy ( &AddForceToActor_Parms.vForce, &vForce, 0xC );
@@ -9303,10 +8480,9 @@ void USFXGameEffect_Singularity::AddForceToActor ( struct FVector const& vForce
 
 void USFXGameEffect_Singularity::InitialMovement ( )
 {
-	static UFunction* pFnInitialMovement = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitialMovementRef { L"Function SFXGameContent.SFXGameEffect_Singularity.InitialMovement", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitialMovement )
-		pFnInitialMovement = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Singularity.InitialMovement" );
+	UFunction* const pFnInitialMovement = pFnInitialMovementRef.Get ( );
 
 	USFXGameEffect_Singularity_execInitialMovement_Parms InitialMovement_Parms;
 
@@ -9319,10 +8495,9 @@ void USFXGameEffect_Singularity::InitialMovement ( )
 
 void USFXGameEffect_Singularity::UpdateActor ( )
 {
-	static UFunction* pFnUpdateActor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdateActorRef { L"Function SFXGameContent.SFXGameEffect_Singularity.UpdateActor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdateActor )
-		pFnUpdateActor = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Singularity.UpdateActor" );
+	UFunction* const pFnUpdateActor = pFnUpdateActorRef.Get ( );
 
 	USFXGameEffect_Singularity_execUpdateActor_Parms UpdateActor_Parms;
 
@@ -9335,10 +8510,9 @@ void USFXGameEffect_Singularity::UpdateActor ( )
 
 void USFXGameEffect_Singularity::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_Singularity.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Singularity.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_Singularity_execOnApplied_Parms OnApplied_Parms;
 
@@ -9347,14 +8521,11 @@ void USFXGameEffect_Singularity::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_Stasis::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Stasis::pClassPointer { L"Class SFXGameContent.SFXGameEffect_Stasis", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Stasis::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_Stasis" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_Stasis.OnRemoved
@@ -9363,10 +8534,9 @@ class UClass* USFXGameEffect_Stasis::StaticClass()
 
 void USFXGameEffect_Stasis::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_Stasis.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Stasis.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_Stasis_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -9379,10 +8549,9 @@ void USFXGameEffect_Stasis::OnRemoved ( )
 
 void USFXGameEffect_Stasis::UnStasisTarget ( )
 {
-	static UFunction* pFnUnStasisTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnStasisTargetRef { L"Function SFXGameContent.SFXGameEffect_Stasis.UnStasisTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnStasisTarget )
-		pFnUnStasisTarget = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Stasis.UnStasisTarget" );
+	UFunction* const pFnUnStasisTarget = pFnUnStasisTargetRef.Get ( );
 
 	USFXGameEffect_Stasis_execUnStasisTarget_Parms UnStasisTarget_Parms;
 
@@ -9396,10 +8565,9 @@ void USFXGameEffect_Stasis::UnStasisTarget ( )
 
 void USFXGameEffect_Stasis::OnUpdate ( float DeltaSeconds )
 {
-	static UFunction* pFnOnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUpdateRef { L"Function SFXGameContent.SFXGameEffect_Stasis.OnUpdate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUpdate )
-		pFnOnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Stasis.OnUpdate" );
+	UFunction* const pFnOnUpdate = pFnOnUpdateRef.Get ( );
 
 	USFXGameEffect_Stasis_execOnUpdate_Parms OnUpdate_Parms;
 	OnUpdate_Parms.DeltaSeconds = DeltaSeconds;
@@ -9414,10 +8582,9 @@ void USFXGameEffect_Stasis::OnUpdate ( float DeltaSeconds )
 
 void USFXGameEffect_Stasis::NullVelocity ( float DeltaSeconds )
 {
-	static UFunction* pFnNullVelocity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNullVelocityRef { L"Function SFXGameContent.SFXGameEffect_Stasis.NullVelocity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNullVelocity )
-		pFnNullVelocity = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Stasis.NullVelocity" );
+	UFunction* const pFnNullVelocity = pFnNullVelocityRef.Get ( );
 
 	USFXGameEffect_Stasis_execNullVelocity_Parms NullVelocity_Parms;
 	NullVelocity_Parms.DeltaSeconds = DeltaSeconds;
@@ -9431,10 +8598,9 @@ void USFXGameEffect_Stasis::NullVelocity ( float DeltaSeconds )
 
 void USFXGameEffect_Stasis::StartCrustVFX ( )
 {
-	static UFunction* pFnStartCrustVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCrustVFXRef { L"Function SFXGameContent.SFXGameEffect_Stasis.StartCrustVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCrustVFX )
-		pFnStartCrustVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Stasis.StartCrustVFX" );
+	UFunction* const pFnStartCrustVFX = pFnStartCrustVFXRef.Get ( );
 
 	USFXGameEffect_Stasis_execStartCrustVFX_Parms StartCrustVFX_Parms;
 
@@ -9447,10 +8613,9 @@ void USFXGameEffect_Stasis::StartCrustVFX ( )
 
 void USFXGameEffect_Stasis::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_Stasis.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_Stasis.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_Stasis_execOnApplied_Parms OnApplied_Parms;
 
@@ -9459,14 +8624,11 @@ void USFXGameEffect_Stasis::OnApplied ( )
 
 
 
-class UClass* USFXPowerCustomAction_Stasis::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_Stasis::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_Stasis", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_Stasis::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_Stasis" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_Stasis.PopulatePowerStatBarEvolves
@@ -9475,10 +8637,9 @@ class UClass* USFXPowerCustomAction_Stasis::StaticClass()
 
 void USFXPowerCustomAction_Stasis::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -9492,10 +8653,9 @@ void USFXPowerCustomAction_Stasis::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_Stasis::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -9510,10 +8670,9 @@ void USFXPowerCustomAction_Stasis::RecalculateAllPowerData ( unsigned long bRese
 
 void USFXPowerCustomAction_Stasis::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -9530,10 +8689,9 @@ void USFXPowerCustomAction_Stasis::EvolvePower ( unsigned char choice )
 
 bool USFXPowerCustomAction_Stasis::ShouldUsePower ( class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Target = Target;
@@ -9556,10 +8714,9 @@ bool USFXPowerCustomAction_Stasis::ShouldUsePower ( class AActor* Target, FStrin
 
 void USFXPowerCustomAction_Stasis::OnGameEffectEnded ( class AActor* oActor )
 {
-	static UFunction* pFnOnGameEffectEnded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnGameEffectEndedRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.OnGameEffectEnded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnGameEffectEnded )
-		pFnOnGameEffectEnded = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.OnGameEffectEnded" );
+	UFunction* const pFnOnGameEffectEnded = pFnOnGameEffectEndedRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execOnGameEffectEnded_Parms OnGameEffectEnded_Parms;
 	OnGameEffectEnded_Parms.oActor = oActor;
@@ -9573,10 +8730,9 @@ void USFXPowerCustomAction_Stasis::OnGameEffectEnded ( class AActor* oActor )
 
 void USFXPowerCustomAction_Stasis::OnOwnerDestroyed ( )
 {
-	static UFunction* pFnOnOwnerDestroyed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnOwnerDestroyedRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.OnOwnerDestroyed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnOwnerDestroyed )
-		pFnOnOwnerDestroyed = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.OnOwnerDestroyed" );
+	UFunction* const pFnOnOwnerDestroyed = pFnOnOwnerDestroyedRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execOnOwnerDestroyed_Parms OnOwnerDestroyed_Parms;
 
@@ -9589,10 +8745,9 @@ void USFXPowerCustomAction_Stasis::OnOwnerDestroyed ( )
 
 void USFXPowerCustomAction_Stasis::DoJoinInProgress ( )
 {
-	static UFunction* pFnDoJoinInProgress = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoJoinInProgressRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.DoJoinInProgress", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoJoinInProgress )
-		pFnDoJoinInProgress = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.DoJoinInProgress" );
+	UFunction* const pFnDoJoinInProgress = pFnDoJoinInProgressRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execDoJoinInProgress_Parms DoJoinInProgress_Parms;
 
@@ -9605,10 +8760,9 @@ void USFXPowerCustomAction_Stasis::DoJoinInProgress ( )
 
 void USFXPowerCustomAction_Stasis::UnStasisCurrentTargets ( )
 {
-	static UFunction* pFnUnStasisCurrentTargets = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnStasisCurrentTargetsRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.UnStasisCurrentTargets", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnStasisCurrentTargets )
-		pFnUnStasisCurrentTargets = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.UnStasisCurrentTargets" );
+	UFunction* const pFnUnStasisCurrentTargets = pFnUnStasisCurrentTargetsRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execUnStasisCurrentTargets_Parms UnStasisCurrentTargets_Parms;
 
@@ -9622,10 +8776,9 @@ void USFXPowerCustomAction_Stasis::UnStasisCurrentTargets ( )
 
 void USFXPowerCustomAction_Stasis::ClientImpactClearEffects ( class AActor* oImpacted )
 {
-	static UFunction* pFnClientImpactClearEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientImpactClearEffectsRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ClientImpactClearEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientImpactClearEffects )
-		pFnClientImpactClearEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ClientImpactClearEffects" );
+	UFunction* const pFnClientImpactClearEffects = pFnClientImpactClearEffectsRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execClientImpactClearEffects_Parms ClientImpactClearEffects_Parms;
 	ClientImpactClearEffects_Parms.oImpacted = oImpacted;
@@ -9641,10 +8794,9 @@ void USFXPowerCustomAction_Stasis::ClientImpactClearEffects ( class AActor* oImp
 
 void USFXPowerCustomAction_Stasis::ImpactStasis ( class AActor* oImpacted, float fDuration )
 {
-	static UFunction* pFnImpactStasis = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnImpactStasisRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ImpactStasis", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnImpactStasis )
-		pFnImpactStasis = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ImpactStasis" );
+	UFunction* const pFnImpactStasis = pFnImpactStasisRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execImpactStasis_Parms ImpactStasis_Parms;
 	ImpactStasis_Parms.oImpacted = oImpacted;
@@ -9660,10 +8812,9 @@ void USFXPowerCustomAction_Stasis::ImpactStasis ( class AActor* oImpacted, float
 
 void USFXPowerCustomAction_Stasis::ImpactPushAway ( class AActor* oImpacted )
 {
-	static UFunction* pFnImpactPushAway = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnImpactPushAwayRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ImpactPushAway", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnImpactPushAway )
-		pFnImpactPushAway = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ImpactPushAway" );
+	UFunction* const pFnImpactPushAway = pFnImpactPushAwayRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execImpactPushAway_Parms ImpactPushAway_Parms;
 	ImpactPushAway_Parms.oImpacted = oImpacted;
@@ -9683,10 +8834,9 @@ void USFXPowerCustomAction_Stasis::ImpactPushAway ( class AActor* oImpacted )
 
 bool USFXPowerCustomAction_Stasis::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -9707,10 +8857,9 @@ bool USFXPowerCustomAction_Stasis::OnImpact ( unsigned char Resistance, class AA
 
 void USFXPowerCustomAction_Stasis::eventTickCustomAction ( float fDeltaTime )
 {
-	static UFunction* pFnTickCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickCustomActionRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.TickCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTickCustomAction )
-		pFnTickCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.TickCustomAction" );
+	UFunction* const pFnTickCustomAction = pFnTickCustomActionRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_eventTickCustomAction_Parms TickCustomAction_Parms;
 	TickCustomAction_Parms.fDeltaTime = fDeltaTime;
@@ -9725,10 +8874,9 @@ void USFXPowerCustomAction_Stasis::eventTickCustomAction ( float fDeltaTime )
 
 void USFXPowerCustomAction_Stasis::ClientEndStasisEffect ( class AActor* oActor )
 {
-	static UFunction* pFnClientEndStasisEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientEndStasisEffectRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ClientEndStasisEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientEndStasisEffect )
-		pFnClientEndStasisEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ClientEndStasisEffect" );
+	UFunction* const pFnClientEndStasisEffect = pFnClientEndStasisEffectRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execClientEndStasisEffect_Parms ClientEndStasisEffect_Parms;
 	ClientEndStasisEffect_Parms.oActor = oActor;
@@ -9748,10 +8896,9 @@ void USFXPowerCustomAction_Stasis::ClientEndStasisEffect ( class AActor* oActor
 
 void USFXPowerCustomAction_Stasis::ClientDoCustomActionImpact ( class AActor* oActor, int ImpactCount, unsigned long bFirstTarget, struct FVector const& HitLocation, struct FVector const& HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnClientDoCustomActionImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoCustomActionImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ClientDoCustomActionImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoCustomActionImpact )
-		pFnClientDoCustomActionImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ClientDoCustomActionImpact" );
+	UFunction* const pFnClientDoCustomActionImpact = pFnClientDoCustomActionImpactRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execClientDoCustomActionImpact_Parms ClientDoCustomActionImpact_Parms;
 	ClientDoCustomActionImpact_Parms.oActor = oActor;
@@ -9776,10 +8923,9 @@ void USFXPowerCustomAction_Stasis::ClientDoCustomActionImpact ( class AActor* oA
 
 void USFXPowerCustomAction_Stasis::ClientDoPowerSubsequentImpact ( class AActor* oActor, int CustomActionReactionType, float Duration, int ImpactCount, float Delay, unsigned long DoCallback )
 {
-	static UFunction* pFnClientDoPowerSubsequentImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoPowerSubsequentImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ClientDoPowerSubsequentImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoPowerSubsequentImpact )
-		pFnClientDoPowerSubsequentImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ClientDoPowerSubsequentImpact" );
+	UFunction* const pFnClientDoPowerSubsequentImpact = pFnClientDoPowerSubsequentImpactRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execClientDoPowerSubsequentImpact_Parms ClientDoPowerSubsequentImpact_Parms;
 	ClientDoPowerSubsequentImpact_Parms.oActor = oActor;
@@ -9799,10 +8945,9 @@ void USFXPowerCustomAction_Stasis::ClientDoPowerSubsequentImpact ( class AActor*
 
 void USFXPowerCustomAction_Stasis::StopStasisBubble ( unsigned long bReplicate )
 {
-	static UFunction* pFnStopStasisBubble = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopStasisBubbleRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.StopStasisBubble", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopStasisBubble )
-		pFnStopStasisBubble = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.StopStasisBubble" );
+	UFunction* const pFnStopStasisBubble = pFnStopStasisBubbleRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execStopStasisBubble_Parms StopStasisBubble_Parms;
 	StopStasisBubble_Parms.bReplicate = bReplicate;
@@ -9816,10 +8961,9 @@ void USFXPowerCustomAction_Stasis::StopStasisBubble ( unsigned long bReplicate )
 
 void USFXPowerCustomAction_Stasis::StartStasisBubbleVFX ( )
 {
-	static UFunction* pFnStartStasisBubbleVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartStasisBubbleVFXRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.StartStasisBubbleVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartStasisBubbleVFX )
-		pFnStartStasisBubbleVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.StartStasisBubbleVFX" );
+	UFunction* const pFnStartStasisBubbleVFX = pFnStartStasisBubbleVFXRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execStartStasisBubbleVFX_Parms StartStasisBubbleVFX_Parms;
 
@@ -9836,10 +8980,9 @@ void USFXPowerCustomAction_Stasis::StartStasisBubbleVFX ( )
 
 void USFXPowerCustomAction_Stasis::OnPowerDetonated ( struct FVector const& HitLocation, struct FVector const& HitNormal, class ASFXProjectile_PowerCustomAction* oProjectile, class AActor* HitActor )
 {
-	static UFunction* pFnOnPowerDetonated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowerDetonatedRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.OnPowerDetonated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowerDetonated )
-		pFnOnPowerDetonated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.OnPowerDetonated" );
+	UFunction* const pFnOnPowerDetonated = pFnOnPowerDetonatedRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execOnPowerDetonated_Parms OnPowerDetonated_Parms;
 	memcpy ( &OnPowerDetonated_Parms.HitLocation, &HitLocation, 0xC );
@@ -9856,10 +8999,9 @@ void USFXPowerCustomAction_Stasis::OnPowerDetonated ( struct FVector const& HitL
 
 void USFXPowerCustomAction_Stasis::StartPowerCooldown ( )
 {
-	static UFunction* pFnStartPowerCooldown = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPowerCooldownRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.StartPowerCooldown", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPowerCooldown )
-		pFnStartPowerCooldown = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.StartPowerCooldown" );
+	UFunction* const pFnStartPowerCooldown = pFnStartPowerCooldownRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execStartPowerCooldown_Parms StartPowerCooldown_Parms;
 
@@ -9872,10 +9014,9 @@ void USFXPowerCustomAction_Stasis::StartPowerCooldown ( )
 
 void USFXPowerCustomAction_Stasis::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXPowerCustomAction_Stasis.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Stasis.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXPowerCustomAction_Stasis_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -9884,14 +9025,11 @@ void USFXPowerCustomAction_Stasis::StartCustomAction ( )
 
 
 
-class UClass* USFXGameEffect_WeaponDamageTakenBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_WeaponDamageTakenBonus::pClassPointer { L"Class SFXGameContent.SFXGameEffect_WeaponDamageTakenBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_WeaponDamageTakenBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_WeaponDamageTakenBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_WeaponDamageTakenBonus.OnRemoved
@@ -9900,10 +9038,9 @@ class UClass* USFXGameEffect_WeaponDamageTakenBonus::StaticClass()
 
 void USFXGameEffect_WeaponDamageTakenBonus::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_WeaponDamageTakenBonus.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_WeaponDamageTakenBonus.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_WeaponDamageTakenBonus_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -9916,10 +9053,9 @@ void USFXGameEffect_WeaponDamageTakenBonus::OnRemoved ( )
 
 void USFXGameEffect_WeaponDamageTakenBonus::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_WeaponDamageTakenBonus.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_WeaponDamageTakenBonus.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_WeaponDamageTakenBonus_execOnApplied_Parms OnApplied_Parms;
 
@@ -9928,14 +9064,11 @@ void USFXGameEffect_WeaponDamageTakenBonus::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_WeightCapacity::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_WeightCapacity::pClassPointer { L"Class SFXGameContent.SFXGameEffect_WeightCapacity", &UObject::FindClass };
 
 class UClass* USFXGameEffect_WeightCapacity::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_WeightCapacity" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_WeightCapacity.OnRemoved
@@ -9944,10 +9077,9 @@ class UClass* USFXGameEffect_WeightCapacity::StaticClass()
 
 void USFXGameEffect_WeightCapacity::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_WeightCapacity.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_WeightCapacity.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_WeightCapacity_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -9960,10 +9092,9 @@ void USFXGameEffect_WeightCapacity::OnRemoved ( )
 
 void USFXGameEffect_WeightCapacity::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_WeightCapacity.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_WeightCapacity.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_WeightCapacity_execOnApplied_Parms OnApplied_Parms;
 
@@ -9972,14 +9103,11 @@ void USFXGameEffect_WeightCapacity::OnApplied ( )
 
 
 
-class UClass* ASFXPlaceable::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXPlaceable::pClassPointer { L"Class SFXGameContent.SFXPlaceable", &UObject::FindClass };
 
 class UClass* ASFXPlaceable::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPlaceable" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPlaceable.ActivatePlaceable
@@ -9988,10 +9116,9 @@ class UClass* ASFXPlaceable::StaticClass()
 
 void ASFXPlaceable::ActivatePlaceable ( )
 {
-	static UFunction* pFnActivatePlaceable = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatePlaceableRef { L"Function SFXGameContent.SFXPlaceable.ActivatePlaceable", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivatePlaceable )
-		pFnActivatePlaceable = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPlaceable.ActivatePlaceable" );
+	UFunction* const pFnActivatePlaceable = pFnActivatePlaceableRef.Get ( );
 
 	ASFXPlaceable_execActivatePlaceable_Parms ActivatePlaceable_Parms;
 
@@ -10004,10 +9131,9 @@ void ASFXPlaceable::ActivatePlaceable ( )
 
 void ASFXPlaceable::DeactivatePlaceable ( )
 {
-	static UFunction* pFnDeactivatePlaceable = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDeactivatePlaceableRef { L"Function SFXGameContent.SFXPlaceable.DeactivatePlaceable", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDeactivatePlaceable )
-		pFnDeactivatePlaceable = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPlaceable.DeactivatePlaceable" );
+	UFunction* const pFnDeactivatePlaceable = pFnDeactivatePlaceableRef.Get ( );
 
 	ASFXPlaceable_execDeactivatePlaceable_Parms DeactivatePlaceable_Parms;
 
@@ -10022,10 +9148,9 @@ void ASFXPlaceable::DeactivatePlaceable ( )
 
 bool ASFXPlaceable::AllowPlaceableDamageEvents ( class AController* EventInstigator )
 {
-	static UFunction* pFnAllowPlaceableDamageEvents = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAllowPlaceableDamageEventsRef { L"Function SFXGameContent.SFXPlaceable.AllowPlaceableDamageEvents", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAllowPlaceableDamageEvents )
-		pFnAllowPlaceableDamageEvents = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPlaceable.AllowPlaceableDamageEvents" );
+	UFunction* const pFnAllowPlaceableDamageEvents = pFnAllowPlaceableDamageEventsRef.Get ( );
 
 	ASFXPlaceable_execAllowPlaceableDamageEvents_Parms AllowPlaceableDamageEvents_Parms;
 	AllowPlaceableDamageEvents_Parms.EventInstigator = EventInstigator;
@@ -10049,10 +9174,9 @@ bool ASFXPlaceable::AllowPlaceableDamageEvents ( class AController* EventInstiga
 
 bool ASFXPlaceable::ImpactWithPower ( unsigned char Resistance, class APawn* Caster, struct FVector const& HitLocation, struct FVector const& HitNormal, float Damage, struct FVector const& Force, class UClass* DamageType )
 {
-	static UFunction* pFnImpactWithPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnImpactWithPowerRef { L"Function SFXGameContent.SFXPlaceable.ImpactWithPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnImpactWithPower )
-		pFnImpactWithPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPlaceable.ImpactWithPower" );
+	UFunction* const pFnImpactWithPower = pFnImpactWithPowerRef.Get ( );
 
 	ASFXPlaceable_execImpactWithPower_Parms ImpactWithPower_Parms;
 	ImpactWithPower_Parms.Resistance = Resistance;
@@ -10078,10 +9202,9 @@ bool ASFXPlaceable::ImpactWithPower ( unsigned char Resistance, class APawn* Cas
 
 void ASFXPlaceable::AreaDamage ( float Damage, float Force, class UClass* DamageType, float ImpactRadius )
 {
-	static UFunction* pFnAreaDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAreaDamageRef { L"Function SFXGameContent.SFXPlaceable.AreaDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAreaDamage )
-		pFnAreaDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPlaceable.AreaDamage" );
+	UFunction* const pFnAreaDamage = pFnAreaDamageRef.Get ( );
 
 	ASFXPlaceable_execAreaDamage_Parms AreaDamage_Parms;
 	AreaDamage_Parms.Damage = Damage;
@@ -10099,10 +9222,9 @@ void ASFXPlaceable::AreaDamage ( float Damage, float Force, class UClass* Damage
 
 void ASFXPlaceable::AreaDamageForActor ( class AActor* HitActor )
 {
-	static UFunction* pFnAreaDamageForActor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAreaDamageForActorRef { L"Function SFXGameContent.SFXPlaceable.AreaDamageForActor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAreaDamageForActor )
-		pFnAreaDamageForActor = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPlaceable.AreaDamageForActor" );
+	UFunction* const pFnAreaDamageForActor = pFnAreaDamageForActorRef.Get ( );
 
 	ASFXPlaceable_execAreaDamageForActor_Parms AreaDamageForActor_Parms;
 	AreaDamageForActor_Parms.HitActor = HitActor;
@@ -10116,10 +9238,9 @@ void ASFXPlaceable::AreaDamageForActor ( class AActor* HitActor )
 
 void ASFXPlaceable::PlaceableDestroyed ( )
 {
-	static UFunction* pFnPlaceableDestroyed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlaceableDestroyedRef { L"Function SFXGameContent.SFXPlaceable.PlaceableDestroyed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlaceableDestroyed )
-		pFnPlaceableDestroyed = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPlaceable.PlaceableDestroyed" );
+	UFunction* const pFnPlaceableDestroyed = pFnPlaceableDestroyedRef.Get ( );
 
 	ASFXPlaceable_execPlaceableDestroyed_Parms PlaceableDestroyed_Parms;
 
@@ -10132,10 +9253,9 @@ void ASFXPlaceable::PlaceableDestroyed ( )
 
 void ASFXPlaceable::ResetPlaceable ( )
 {
-	static UFunction* pFnResetPlaceable = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResetPlaceableRef { L"Function SFXGameContent.SFXPlaceable.ResetPlaceable", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResetPlaceable )
-		pFnResetPlaceable = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPlaceable.ResetPlaceable" );
+	UFunction* const pFnResetPlaceable = pFnResetPlaceableRef.Get ( );
 
 	ASFXPlaceable_execResetPlaceable_Parms ResetPlaceable_Parms;
 
@@ -10149,10 +9269,9 @@ void ASFXPlaceable::ResetPlaceable ( )
 
 void ASFXPlaceable::eventReplicatedEvent ( struct SFXName VarName )
 {
-	static UFunction* pFnReplicatedEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReplicatedEventRef { L"Function SFXGameContent.SFXPlaceable.ReplicatedEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReplicatedEvent )
-		pFnReplicatedEvent = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPlaceable.ReplicatedEvent" );
+	UFunction* const pFnReplicatedEvent = pFnReplicatedEventRef.Get ( );
 
 	ASFXPlaceable_eventReplicatedEvent_Parms ReplicatedEvent_Parms;
 	memcpy ( &ReplicatedEvent_Parms.VarName, &VarName, 0x8 );
@@ -10162,98 +9281,74 @@ void ASFXPlaceable::eventReplicatedEvent ( struct SFXName VarName )
 
 
 
-class UClass* USFXSeqEvt_PlaceableReset::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqEvt_PlaceableReset::pClassPointer { L"Class SFXGameContent.SFXSeqEvt_PlaceableReset", &UObject::FindClass };
 
 class UClass* USFXSeqEvt_PlaceableReset::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqEvt_PlaceableReset" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXSeqEvt_PlaceableDestroyed::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqEvt_PlaceableDestroyed::pClassPointer { L"Class SFXGameContent.SFXSeqEvt_PlaceableDestroyed", &UObject::FindClass };
 
 class UClass* USFXSeqEvt_PlaceableDestroyed::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqEvt_PlaceableDestroyed" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXSeqEvt_PlaceableDeactivated::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqEvt_PlaceableDeactivated::pClassPointer { L"Class SFXGameContent.SFXSeqEvt_PlaceableDeactivated", &UObject::FindClass };
 
 class UClass* USFXSeqEvt_PlaceableDeactivated::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqEvt_PlaceableDeactivated" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXSeqEvt_PlaceableActivated::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqEvt_PlaceableActivated::pClassPointer { L"Class SFXGameContent.SFXSeqEvt_PlaceableActivated", &UObject::FindClass };
 
 class UClass* USFXSeqEvt_PlaceableActivated::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqEvt_PlaceableActivated" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXProjectile_PowerCustomAction_BioticGrenade::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_PowerCustomAction_BioticGrenade::pClassPointer { L"Class SFXGameContent.SFXProjectile_PowerCustomAction_BioticGrenade", &UObject::FindClass };
 
 class UClass* ASFXProjectile_PowerCustomAction_BioticGrenade::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXProjectile_PowerCustomAction_BioticGrenade" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXRumble_Power_FragGrenade::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXRumble_Power_FragGrenade::pClassPointer { L"Class SFXGameContent.SFXRumble_Power_FragGrenade", &UObject::FindClass };
 
 class UClass* USFXRumble_Power_FragGrenade::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXRumble_Power_FragGrenade" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXShake_Power_FragGrenade::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXShake_Power_FragGrenade::pClassPointer { L"Class SFXGameContent.SFXShake_Power_FragGrenade", &UObject::FindClass };
 
 class UClass* USFXShake_Power_FragGrenade::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXShake_Power_FragGrenade" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXProjectile_PowerCustomAction_SuperSeeking::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_PowerCustomAction_SuperSeeking::pClassPointer { L"Class SFXGameContent.SFXProjectile_PowerCustomAction_SuperSeeking", &UObject::FindClass };
 
 class UClass* ASFXProjectile_PowerCustomAction_SuperSeeking::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXProjectile_PowerCustomAction_SuperSeeking" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXProjectile_PowerCustomAction_SuperSeeking.InitializeRotation
@@ -10263,10 +9358,9 @@ class UClass* ASFXProjectile_PowerCustomAction_SuperSeeking::StaticClass()
 
 void ASFXProjectile_PowerCustomAction_SuperSeeking::InitializeRotation ( class APawn* oCasterPawn )
 {
-	static UFunction* pFnInitializeRotation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializeRotationRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_SuperSeeking.InitializeRotation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializeRotation )
-		pFnInitializeRotation = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_SuperSeeking.InitializeRotation" );
+	UFunction* const pFnInitializeRotation = pFnInitializeRotationRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_SuperSeeking_execInitializeRotation_Parms InitializeRotation_Parms;
 	InitializeRotation_Parms.oCasterPawn = oCasterPawn;
@@ -10282,10 +9376,9 @@ void ASFXProjectile_PowerCustomAction_SuperSeeking::InitializeRotation ( class A
 
 void ASFXProjectile_PowerCustomAction_SuperSeeking::TickAimRotation ( float DeltaTime, struct FVector const& SeekVector )
 {
-	static UFunction* pFnTickAimRotation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickAimRotationRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_SuperSeeking.TickAimRotation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTickAimRotation )
-		pFnTickAimRotation = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_SuperSeeking.TickAimRotation" );
+	UFunction* const pFnTickAimRotation = pFnTickAimRotationRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_SuperSeeking_execTickAimRotation_Parms TickAimRotation_Parms;
 	TickAimRotation_Parms.DeltaTime = DeltaTime;
@@ -10296,14 +9389,11 @@ void ASFXProjectile_PowerCustomAction_SuperSeeking::TickAimRotation ( float Delt
 
 
 
-class UClass* ASFXProjectile_PowerCustomAction_Seeking::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_PowerCustomAction_Seeking::pClassPointer { L"Class SFXGameContent.SFXProjectile_PowerCustomAction_Seeking", &UObject::FindClass };
 
 class UClass* ASFXProjectile_PowerCustomAction_Seeking::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXProjectile_PowerCustomAction_Seeking" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.Tick_Prediction
@@ -10313,10 +9403,9 @@ class UClass* ASFXProjectile_PowerCustomAction_Seeking::StaticClass()
 
 void ASFXProjectile_PowerCustomAction_Seeking::Tick_Prediction ( float DeltaTime )
 {
-	static UFunction* pFnTick_Prediction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTick_PredictionRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.Tick_Prediction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTick_Prediction )
-		pFnTick_Prediction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.Tick_Prediction" );
+	UFunction* const pFnTick_Prediction = pFnTick_PredictionRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Seeking_execTick_Prediction_Parms Tick_Prediction_Parms;
 	Tick_Prediction_Parms.DeltaTime = DeltaTime;
@@ -10330,10 +9419,9 @@ void ASFXProjectile_PowerCustomAction_Seeking::Tick_Prediction ( float DeltaTime
 
 void ASFXProjectile_PowerCustomAction_Seeking::Recycle ( )
 {
-	static UFunction* pFnRecycle = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecycleRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.Recycle", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecycle )
-		pFnRecycle = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.Recycle" );
+	UFunction* const pFnRecycle = pFnRecycleRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Seeking_execRecycle_Parms Recycle_Parms;
 
@@ -10347,10 +9435,9 @@ void ASFXProjectile_PowerCustomAction_Seeking::Recycle ( )
 
 void ASFXProjectile_PowerCustomAction_Seeking::InitializeRotation ( class APawn* oCasterPawn )
 {
-	static UFunction* pFnInitializeRotation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializeRotationRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.InitializeRotation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializeRotation )
-		pFnInitializeRotation = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.InitializeRotation" );
+	UFunction* const pFnInitializeRotation = pFnInitializeRotationRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Seeking_execInitializeRotation_Parms InitializeRotation_Parms;
 	InitializeRotation_Parms.oCasterPawn = oCasterPawn;
@@ -10369,10 +9456,9 @@ void ASFXProjectile_PowerCustomAction_Seeking::InitializeRotation ( class APawn*
 
 bool ASFXProjectile_PowerCustomAction_Seeking::InitializePowerProjectile ( class AActor* oCaster, float fTravelSpeed, float fRadius, class USFXPowerCustomAction* oPower )
 {
-	static UFunction* pFnInitializePowerProjectile = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerProjectileRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.InitializePowerProjectile", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerProjectile )
-		pFnInitializePowerProjectile = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.InitializePowerProjectile" );
+	UFunction* const pFnInitializePowerProjectile = pFnInitializePowerProjectileRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Seeking_execInitializePowerProjectile_Parms InitializePowerProjectile_Parms;
 	InitializePowerProjectile_Parms.oCaster = oCaster;
@@ -10394,10 +9480,9 @@ bool ASFXProjectile_PowerCustomAction_Seeking::InitializePowerProjectile ( class
 
 void ASFXProjectile_PowerCustomAction_Seeking::PawnEvadedPower ( class ABioPawn* Pawn, struct SFXName Label, float TimeBeforeImpact )
 {
-	static UFunction* pFnPawnEvadedPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPawnEvadedPowerRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.PawnEvadedPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPawnEvadedPower )
-		pFnPawnEvadedPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.PawnEvadedPower" );
+	UFunction* const pFnPawnEvadedPower = pFnPawnEvadedPowerRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Seeking_execPawnEvadedPower_Parms PawnEvadedPower_Parms;
 	PawnEvadedPower_Parms.Pawn = Pawn;
@@ -10416,10 +9501,9 @@ void ASFXProjectile_PowerCustomAction_Seeking::PawnEvadedPower ( class ABioPawn*
 
 bool ASFXProjectile_PowerCustomAction_Seeking::CanLockOn ( class AActor* Target, class APawn* CasterPawn )
 {
-	static UFunction* pFnCanLockOn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanLockOnRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.CanLockOn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanLockOn )
-		pFnCanLockOn = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.CanLockOn" );
+	UFunction* const pFnCanLockOn = pFnCanLockOnRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Seeking_execCanLockOn_Parms CanLockOn_Parms;
 	CanLockOn_Parms.Target = Target;
@@ -10437,10 +9521,9 @@ bool ASFXProjectile_PowerCustomAction_Seeking::CanLockOn ( class AActor* Target,
 
 void ASFXProjectile_PowerCustomAction_Seeking::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.Tick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTick )
-		pFnTick = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.Tick" );
+	UFunction* const pFnTick = pFnTickRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Seeking_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -10456,10 +9539,9 @@ void ASFXProjectile_PowerCustomAction_Seeking::Tick ( float DeltaTime )
 
 void ASFXProjectile_PowerCustomAction_Seeking::TickAimRotation ( float DeltaTime, struct FVector const& SeekVector )
 {
-	static UFunction* pFnTickAimRotation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickAimRotationRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.TickAimRotation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTickAimRotation )
-		pFnTickAimRotation = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.TickAimRotation" );
+	UFunction* const pFnTickAimRotation = pFnTickAimRotationRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Seeking_execTickAimRotation_Parms TickAimRotation_Parms;
 	TickAimRotation_Parms.DeltaTime = DeltaTime;
@@ -10475,10 +9557,9 @@ void ASFXProjectile_PowerCustomAction_Seeking::TickAimRotation ( float DeltaTime
 
 void ASFXProjectile_PowerCustomAction_Seeking::TickAim ( float DeltaTime )
 {
-	static UFunction* pFnTickAim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickAimRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.TickAim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTickAim )
-		pFnTickAim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.TickAim" );
+	UFunction* const pFnTickAim = pFnTickAimRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Seeking_execTickAim_Parms TickAim_Parms;
 	TickAim_Parms.DeltaTime = DeltaTime;
@@ -10494,10 +9575,9 @@ void ASFXProjectile_PowerCustomAction_Seeking::TickAim ( float DeltaTime )
 
 struct FVector ASFXProjectile_PowerCustomAction_Seeking::GetAimLocation ( class AActor* Target )
 {
-	static UFunction* pFnGetAimLocation = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetAimLocationRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.GetAimLocation", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetAimLocation )
-		pFnGetAimLocation = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.GetAimLocation" );
+	UFunction* const pFnGetAimLocation = pFnGetAimLocationRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Seeking_execGetAimLocation_Parms GetAimLocation_Parms;
 	GetAimLocation_Parms.Target = Target;
@@ -10513,10 +9593,9 @@ struct FVector ASFXProjectile_PowerCustomAction_Seeking::GetAimLocation ( class
 
 void ASFXProjectile_PowerCustomAction_Seeking::Timer ( )
 {
-	static UFunction* pFnTimer = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTimerRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.Timer", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTimer )
-		pFnTimer = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.Timer" );
+	UFunction* const pFnTimer = pFnTimerRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Seeking_execTimer_Parms Timer_Parms;
 
@@ -10530,10 +9609,9 @@ void ASFXProjectile_PowerCustomAction_Seeking::Timer ( )
 
 void ASFXProjectile_PowerCustomAction_Seeking::eventReplicatedEvent ( struct SFXName VarName )
 {
-	static UFunction* pFnReplicatedEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReplicatedEventRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.ReplicatedEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReplicatedEvent )
-		pFnReplicatedEvent = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.ReplicatedEvent" );
+	UFunction* const pFnReplicatedEvent = pFnReplicatedEventRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Seeking_eventReplicatedEvent_Parms ReplicatedEvent_Parms;
 	memcpy ( &ReplicatedEvent_Parms.VarName, &VarName, 0x8 );
@@ -10543,14 +9621,11 @@ void ASFXProjectile_PowerCustomAction_Seeking::eventReplicatedEvent ( struct SFX
 
 
 
-class UClass* ASFXProjectile_PowerCustomAction_Shockwave::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_PowerCustomAction_Shockwave::pClassPointer { L"Class SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave", &UObject::FindClass };
 
 class UClass* ASFXProjectile_PowerCustomAction_Shockwave::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.ReplicateExplode
@@ -10561,10 +9636,9 @@ class UClass* ASFXProjectile_PowerCustomAction_Shockwave::StaticClass()
 
 void ASFXProjectile_PowerCustomAction_Shockwave::ReplicateExplode ( struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnReplicateExplode = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReplicateExplodeRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.ReplicateExplode", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReplicateExplode )
-		pFnReplicateExplode = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.ReplicateExplode" );
+	UFunction* const pFnReplicateExplode = pFnReplicateExplodeRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Shockwave_execReplicateExplode_Parms ReplicateExplode_Parms;
 	memcpy ( &ReplicateExplode_Parms.HitLocation, &HitLocation, 0xC );
@@ -10580,10 +9654,9 @@ void ASFXProjectile_PowerCustomAction_Shockwave::ReplicateExplode ( struct FVect
 
 void ASFXProjectile_PowerCustomAction_Shockwave::Tick ( float DeltaTime )
 {
-	static UFunction* pFnTick = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTickRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.Tick", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTick )
-		pFnTick = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.Tick" );
+	UFunction* const pFnTick = pFnTickRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Shockwave_execTick_Parms Tick_Parms;
 	Tick_Parms.DeltaTime = DeltaTime;
@@ -10602,10 +9675,9 @@ void ASFXProjectile_PowerCustomAction_Shockwave::Tick ( float DeltaTime )
 
 bool ASFXProjectile_PowerCustomAction_Shockwave::InitializePowerProjectile ( class AActor* oCaster, float fTravelSpeed, float fRadius, class USFXPowerCustomAction* oPower )
 {
-	static UFunction* pFnInitializePowerProjectile = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializePowerProjectileRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.InitializePowerProjectile", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitializePowerProjectile )
-		pFnInitializePowerProjectile = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.InitializePowerProjectile" );
+	UFunction* const pFnInitializePowerProjectile = pFnInitializePowerProjectileRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Shockwave_execInitializePowerProjectile_Parms InitializePowerProjectile_Parms;
 	InitializePowerProjectile_Parms.oCaster = oCaster;
@@ -10627,10 +9699,9 @@ bool ASFXProjectile_PowerCustomAction_Shockwave::InitializePowerProjectile ( cla
 
 void ASFXProjectile_PowerCustomAction_Shockwave::ProcessTouch ( class AActor* Other, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnProcessTouch = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnProcessTouchRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.ProcessTouch", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnProcessTouch )
-		pFnProcessTouch = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.ProcessTouch" );
+	UFunction* const pFnProcessTouch = pFnProcessTouchRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Shockwave_execProcessTouch_Parms ProcessTouch_Parms;
 	ProcessTouch_Parms.Other = Other;
@@ -10649,10 +9720,9 @@ void ASFXProjectile_PowerCustomAction_Shockwave::ProcessTouch ( class AActor* Ot
 
 void ASFXProjectile_PowerCustomAction_Shockwave::eventHitWall ( struct FVector const& HitNormal, class AActor* Wall, class UPrimitiveComponent* WallComp )
 {
-	static UFunction* pFnHitWall = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHitWallRef { L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.HitWall", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHitWall )
-		pFnHitWall = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.HitWall" );
+	UFunction* const pFnHitWall = pFnHitWallRef.Get ( );
 
 	ASFXProjectile_PowerCustomAction_Shockwave_eventHitWall_Parms HitWall_Parms;
 	memcpy ( &HitWall_Parms.HitNormal, &HitNormal, 0xC );
@@ -10664,62 +9734,47 @@ void ASFXProjectile_PowerCustomAction_Shockwave::eventHitWall ( struct FVector c
 
 
 
-class UClass* USFXRumble_Power_HeavyImpact::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXRumble_Power_HeavyImpact::pClassPointer { L"Class SFXGameContent.SFXRumble_Power_HeavyImpact", &UObject::FindClass };
 
 class UClass* USFXRumble_Power_HeavyImpact::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXRumble_Power_HeavyImpact" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXShake_Power_Shockwave::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXShake_Power_Shockwave::pClassPointer { L"Class SFXGameContent.SFXShake_Power_Shockwave", &UObject::FindClass };
 
 class UClass* USFXShake_Power_Shockwave::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXShake_Power_Shockwave" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXShake_Power_HeavyImpact::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXShake_Power_HeavyImpact::pClassPointer { L"Class SFXGameContent.SFXShake_Power_HeavyImpact", &UObject::FindClass };
 
 class UClass* USFXShake_Power_HeavyImpact::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXShake_Power_HeavyImpact" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXShield_Biotic_Player::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXShield_Biotic_Player::pClassPointer { L"Class SFXGameContent.SFXShield_Biotic_Player", &UObject::FindClass };
 
 class UClass* ASFXShield_Biotic_Player::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXShield_Biotic_Player" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_ConstraintDmgBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_ConstraintDmgBonus::pClassPointer { L"Class SFXGameContent.SFXGameEffect_ConstraintDmgBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_ConstraintDmgBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_ConstraintDmgBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_ConstraintDmgBonus.OnRemoved
@@ -10728,10 +9783,9 @@ class UClass* USFXGameEffect_ConstraintDmgBonus::StaticClass()
 
 void USFXGameEffect_ConstraintDmgBonus::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_ConstraintDmgBonus.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_ConstraintDmgBonus.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_ConstraintDmgBonus_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -10744,10 +9798,9 @@ void USFXGameEffect_ConstraintDmgBonus::OnRemoved ( )
 
 void USFXGameEffect_ConstraintDmgBonus::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_ConstraintDmgBonus.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_ConstraintDmgBonus.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_ConstraintDmgBonus_execOnApplied_Parms OnApplied_Parms;
 
@@ -10756,86 +9809,65 @@ void USFXGameEffect_ConstraintDmgBonus::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_HealthPercentBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_HealthPercentBonus::pClassPointer { L"Class SFXGameContent.SFXGameEffect_HealthPercentBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_HealthPercentBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_HealthPercentBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_MeleeDamageBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_MeleeDamageBonus::pClassPointer { L"Class SFXGameContent.SFXGameEffect_MeleeDamageBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_MeleeDamageBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_MeleeDamageBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_PartBasedArmor_HealthBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_PartBasedArmor_HealthBonus::pClassPointer { L"Class SFXGameContent.SFXGameEffect_PartBasedArmor_HealthBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_PartBasedArmor_HealthBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_PartBasedArmor_HealthBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_PowerBonus_Cooldown::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_PowerBonus_Cooldown::pClassPointer { L"Class SFXGameContent.SFXGameEffect_PowerBonus_Cooldown", &UObject::FindClass };
 
 class UClass* USFXGameEffect_PowerBonus_Cooldown::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_PowerBonus_Cooldown" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_PowerBonus_Damage::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_PowerBonus_Damage::pClassPointer { L"Class SFXGameContent.SFXGameEffect_PowerBonus_Damage", &UObject::FindClass };
 
 class UClass* USFXGameEffect_PowerBonus_Damage::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_PowerBonus_Damage" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_ShieldPercentBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_ShieldPercentBonus::pClassPointer { L"Class SFXGameContent.SFXGameEffect_ShieldPercentBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_ShieldPercentBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_ShieldPercentBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_SpareAmmo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_SpareAmmo::pClassPointer { L"Class SFXGameContent.SFXGameEffect_SpareAmmo", &UObject::FindClass };
 
 class UClass* USFXGameEffect_SpareAmmo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_SpareAmmo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_SpareAmmo.OnRemoved
@@ -10844,10 +9876,9 @@ class UClass* USFXGameEffect_SpareAmmo::StaticClass()
 
 void USFXGameEffect_SpareAmmo::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_SpareAmmo.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_SpareAmmo.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_SpareAmmo_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -10860,10 +9891,9 @@ void USFXGameEffect_SpareAmmo::OnRemoved ( )
 
 void USFXGameEffect_SpareAmmo::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_SpareAmmo.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_SpareAmmo.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_SpareAmmo_execOnApplied_Parms OnApplied_Parms;
 
@@ -10872,26 +9902,20 @@ void USFXGameEffect_SpareAmmo::OnApplied ( )
 
 
 
-class UClass* USFXDamageType_SniperRifle::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_SniperRifle::pClassPointer { L"Class SFXGameContent.SFXDamageType_SniperRifle", &UObject::FindClass };
 
 class UClass* USFXDamageType_SniperRifle::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_SniperRifle" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGUI_StandardSniperZoomReticle::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGUI_StandardSniperZoomReticle::pClassPointer { L"Class SFXGameContent.SFXGUI_StandardSniperZoomReticle", &UObject::FindClass };
 
 class UClass* USFXGUI_StandardSniperZoomReticle::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGUI_StandardSniperZoomReticle" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.ZoomChanged
@@ -10901,10 +9925,9 @@ class UClass* USFXGUI_StandardSniperZoomReticle::StaticClass()
 
 void USFXGUI_StandardSniperZoomReticle::eventZoomChanged ( int nZoom )
 {
-	static UFunction* pFnZoomChanged = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnZoomChangedRef { L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.ZoomChanged", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnZoomChanged )
-		pFnZoomChanged = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.ZoomChanged" );
+	UFunction* const pFnZoomChanged = pFnZoomChangedRef.Get ( );
 
 	USFXGUI_StandardSniperZoomReticle_eventZoomChanged_Parms ZoomChanged_Parms;
 	ZoomChanged_Parms.nZoom = nZoom;
@@ -10919,10 +9942,9 @@ void USFXGUI_StandardSniperZoomReticle::eventZoomChanged ( int nZoom )
 
 void USFXGUI_StandardSniperZoomReticle::eventWeaponAmmoChanged ( int nAmmo )
 {
-	static UFunction* pFnWeaponAmmoChanged = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnWeaponAmmoChangedRef { L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.WeaponAmmoChanged", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnWeaponAmmoChanged )
-		pFnWeaponAmmoChanged = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.WeaponAmmoChanged" );
+	UFunction* const pFnWeaponAmmoChanged = pFnWeaponAmmoChangedRef.Get ( );
 
 	USFXGUI_StandardSniperZoomReticle_eventWeaponAmmoChanged_Parms WeaponAmmoChanged_Parms;
 	WeaponAmmoChanged_Parms.nAmmo = nAmmo;
@@ -10937,10 +9959,9 @@ void USFXGUI_StandardSniperZoomReticle::eventWeaponAmmoChanged ( int nAmmo )
 
 void USFXGUI_StandardSniperZoomReticle::eventDistanceToTargetChanged ( float fDistance )
 {
-	static UFunction* pFnDistanceToTargetChanged = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDistanceToTargetChangedRef { L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.DistanceToTargetChanged", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDistanceToTargetChanged )
-		pFnDistanceToTargetChanged = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.DistanceToTargetChanged" );
+	UFunction* const pFnDistanceToTargetChanged = pFnDistanceToTargetChangedRef.Get ( );
 
 	USFXGUI_StandardSniperZoomReticle_eventDistanceToTargetChanged_Parms DistanceToTargetChanged_Parms;
 	DistanceToTargetChanged_Parms.fDistance = fDistance;
@@ -10954,10 +9975,9 @@ void USFXGUI_StandardSniperZoomReticle::eventDistanceToTargetChanged ( float fDi
 
 void USFXGUI_StandardSniperZoomReticle::OnReticleLoaded ( )
 {
-	static UFunction* pFnOnReticleLoaded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReticleLoadedRef { L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.OnReticleLoaded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReticleLoaded )
-		pFnOnReticleLoaded = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.OnReticleLoaded" );
+	UFunction* const pFnOnReticleLoaded = pFnOnReticleLoadedRef.Get ( );
 
 	USFXGUI_StandardSniperZoomReticle_execOnReticleLoaded_Parms OnReticleLoaded_Parms;
 
@@ -10971,10 +9991,9 @@ void USFXGUI_StandardSniperZoomReticle::OnReticleLoaded ( )
 
 void USFXGUI_StandardSniperZoomReticle::eventPerformReticleHide ( unsigned long bInstant )
 {
-	static UFunction* pFnPerformReticleHide = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPerformReticleHideRef { L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.PerformReticleHide", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPerformReticleHide )
-		pFnPerformReticleHide = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.PerformReticleHide" );
+	UFunction* const pFnPerformReticleHide = pFnPerformReticleHideRef.Get ( );
 
 	USFXGUI_StandardSniperZoomReticle_eventPerformReticleHide_Parms PerformReticleHide_Parms;
 	PerformReticleHide_Parms.bInstant = bInstant;
@@ -10989,10 +10008,9 @@ void USFXGUI_StandardSniperZoomReticle::eventPerformReticleHide ( unsigned long
 
 void USFXGUI_StandardSniperZoomReticle::eventPerformReticleShow ( unsigned long bInstant )
 {
-	static UFunction* pFnPerformReticleShow = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPerformReticleShowRef { L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.PerformReticleShow", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPerformReticleShow )
-		pFnPerformReticleShow = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.PerformReticleShow" );
+	UFunction* const pFnPerformReticleShow = pFnPerformReticleShowRef.Get ( );
 
 	USFXGUI_StandardSniperZoomReticle_eventPerformReticleShow_Parms PerformReticleShow_Parms;
 	PerformReticleShow_Parms.bInstant = bInstant;
@@ -11002,38 +10020,29 @@ void USFXGUI_StandardSniperZoomReticle::eventPerformReticleShow ( unsigned long
 
 
 
-class UClass* ASFXWeapon_SniperRifle_Mantis::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_SniperRifle_Mantis::pClassPointer { L"Class SFXGameContent.SFXWeapon_SniperRifle_Mantis", &UObject::FindClass };
 
 class UClass* ASFXWeapon_SniperRifle_Mantis::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXWeapon_SniperRifle_Mantis" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_AutoPistol::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_AutoPistol::pClassPointer { L"Class SFXGameContent.SFXDamageType_AutoPistol", &UObject::FindClass };
 
 class UClass* USFXDamageType_AutoPistol::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_AutoPistol" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXWeapon_SMG_Shuriken::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_SMG_Shuriken::pClassPointer { L"Class SFXGameContent.SFXWeapon_SMG_Shuriken", &UObject::FindClass };
 
 class UClass* ASFXWeapon_SMG_Shuriken::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXWeapon_SMG_Shuriken" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXWeapon_SMG_Shuriken.GetWeaponSpecificDecalData
@@ -11045,10 +10054,9 @@ class UClass* ASFXWeapon_SMG_Shuriken::StaticClass()
 
 class UDecalComponent* ASFXWeapon_SMG_Shuriken::GetWeaponSpecificDecalData ( class USFXPhysicalMaterialDecals* DecalEffects, float* FadeTime )
 {
-	static UFunction* pFnGetWeaponSpecificDecalData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificDecalDataRef { L"Function SFXGameContent.SFXWeapon_SMG_Shuriken.GetWeaponSpecificDecalData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificDecalData )
-		pFnGetWeaponSpecificDecalData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_SMG_Shuriken.GetWeaponSpecificDecalData" );
+	UFunction* const pFnGetWeaponSpecificDecalData = pFnGetWeaponSpecificDecalDataRef.Get ( );
 
 	ASFXWeapon_SMG_Shuriken_execGetWeaponSpecificDecalData_Parms GetWeaponSpecificDecalData_Parms;
 	GetWeaponSpecificDecalData_Parms.DecalEffects = DecalEffects;
@@ -11066,14 +10074,11 @@ class UDecalComponent* ASFXWeapon_SMG_Shuriken::GetWeaponSpecificDecalData ( cla
 
 
 
-class UClass* USFXSeqAct_EndObjective::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_EndObjective::pClassPointer { L"Class SFXGameContent.SFXSeqAct_EndObjective", &UObject::FindClass };
 
 class UClass* USFXSeqAct_EndObjective::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_EndObjective" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXSeqAct_EndObjective.GetObjClassVersion
@@ -11083,10 +10088,9 @@ class UClass* USFXSeqAct_EndObjective::StaticClass()
 
 int USFXSeqAct_EndObjective::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContent.SFXSeqAct_EndObjective.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_EndObjective.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USFXSeqAct_EndObjective_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -11101,10 +10105,9 @@ int USFXSeqAct_EndObjective::eventGetObjClassVersion ( )
 
 void USFXSeqAct_EndObjective::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.SFXSeqAct_EndObjective.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_EndObjective.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_EndObjective_execActivated_Parms Activated_Parms;
 
@@ -11113,14 +10116,11 @@ void USFXSeqAct_EndObjective::Activated ( )
 
 
 
-class UClass* USFXSeqAct_SetObjective::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_SetObjective::pClassPointer { L"Class SFXGameContent.SFXSeqAct_SetObjective", &UObject::FindClass };
 
 class UClass* USFXSeqAct_SetObjective::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_SetObjective" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXSeqAct_SetObjective.GetObjClassVersion
@@ -11130,10 +10130,9 @@ class UClass* USFXSeqAct_SetObjective::StaticClass()
 
 int USFXSeqAct_SetObjective::eventGetObjClassVersion ( )
 {
-	static UFunction* pFnGetObjClassVersion = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetObjClassVersionRef { L"Function SFXGameContent.SFXSeqAct_SetObjective.GetObjClassVersion", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetObjClassVersion )
-		pFnGetObjClassVersion = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_SetObjective.GetObjClassVersion" );
+	UFunction* const pFnGetObjClassVersion = pFnGetObjClassVersionRef.Get ( );
 
 	USFXSeqAct_SetObjective_eventGetObjClassVersion_Parms GetObjClassVersion_Parms;
 
@@ -11148,10 +10147,9 @@ int USFXSeqAct_SetObjective::eventGetObjClassVersion ( )
 
 void USFXSeqAct_SetObjective::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.SFXSeqAct_SetObjective.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_SetObjective.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_SetObjective_execActivated_Parms Activated_Parms;
 
@@ -11160,14 +10158,11 @@ void USFXSeqAct_SetObjective::Activated ( )
 
 
 
-class UClass* USFXSeqAct_ToggleTutorialTracking::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXSeqAct_ToggleTutorialTracking::pClassPointer { L"Class SFXGameContent.SFXSeqAct_ToggleTutorialTracking", &UObject::FindClass };
 
 class UClass* USFXSeqAct_ToggleTutorialTracking::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXSeqAct_ToggleTutorialTracking" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXSeqAct_ToggleTutorialTracking.Activated
@@ -11176,10 +10171,9 @@ class UClass* USFXSeqAct_ToggleTutorialTracking::StaticClass()
 
 void USFXSeqAct_ToggleTutorialTracking::Activated ( )
 {
-	static UFunction* pFnActivated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivatedRef { L"Function SFXGameContent.SFXSeqAct_ToggleTutorialTracking.Activated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivated )
-		pFnActivated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXSeqAct_ToggleTutorialTracking.Activated" );
+	UFunction* const pFnActivated = pFnActivatedRef.Get ( );
 
 	USFXSeqAct_ToggleTutorialTracking_execActivated_Parms Activated_Parms;
 
@@ -11188,14 +10182,11 @@ void USFXSeqAct_ToggleTutorialTracking::Activated ( )
 
 
 
-class UClass* ABioPlaypenVolumeAdditive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ABioPlaypenVolumeAdditive::pClassPointer { L"Class SFXGameContent.BioPlaypenVolumeAdditive", &UObject::FindClass };
 
 class UClass* ABioPlaypenVolumeAdditive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.BioPlaypenVolumeAdditive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.BioPlaypenVolumeAdditive.UnTouch
@@ -11205,10 +10196,9 @@ class UClass* ABioPlaypenVolumeAdditive::StaticClass()
 
 void ABioPlaypenVolumeAdditive::eventUnTouch ( class AActor* Other )
 {
-	static UFunction* pFnUnTouch = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUnTouchRef { L"Function SFXGameContent.BioPlaypenVolumeAdditive.UnTouch", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUnTouch )
-		pFnUnTouch = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioPlaypenVolumeAdditive.UnTouch" );
+	UFunction* const pFnUnTouch = pFnUnTouchRef.Get ( );
 
 	ABioPlaypenVolumeAdditive_eventUnTouch_Parms UnTouch_Parms;
 	UnTouch_Parms.Other = Other;
@@ -11226,10 +10216,9 @@ void ABioPlaypenVolumeAdditive::eventUnTouch ( class AActor* Other )
 
 void ABioPlaypenVolumeAdditive::eventTouch ( class AActor* Other, class UPrimitiveComponent* OtherComp, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnTouch = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTouchRef { L"Function SFXGameContent.BioPlaypenVolumeAdditive.Touch", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTouch )
-		pFnTouch = UObject::FindObject< UFunction > ( L"Function SFXGameContent.BioPlaypenVolumeAdditive.Touch" );
+	UFunction* const pFnTouch = pFnTouchRef.Get ( );
 
 	ABioPlaypenVolumeAdditive_eventTouch_Parms Touch_Parms;
 	Touch_Parms.Other = Other;
@@ -11242,14 +10231,11 @@ void ABioPlaypenVolumeAdditive::eventTouch ( class AActor* Other, class UPrimiti
 
 
 
-class UClass* ASFXAI_Trooper::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXAI_Trooper::pClassPointer { L"Class SFXGameContent.SFXAI_Trooper", &UObject::FindClass };
 
 class UClass* ASFXAI_Trooper::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXAI_Trooper" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXAI_Trooper.DrawDifficulty
@@ -11259,10 +10245,9 @@ class UClass* ASFXAI_Trooper::StaticClass()
 
 void ASFXAI_Trooper::DrawDifficulty ( class UBioCheatManager* CM )
 {
-	static UFunction* pFnDrawDifficulty = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDrawDifficultyRef { L"Function SFXGameContent.SFXAI_Trooper.DrawDifficulty", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDrawDifficulty )
-		pFnDrawDifficulty = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXAI_Trooper.DrawDifficulty" );
+	UFunction* const pFnDrawDifficulty = pFnDrawDifficultyRef.Get ( );
 
 	ASFXAI_Trooper_execDrawDifficulty_Parms DrawDifficulty_Parms;
 	DrawDifficulty_Parms.CM = CM;
@@ -11276,10 +10261,9 @@ void ASFXAI_Trooper::DrawDifficulty ( class UBioCheatManager* CM )
 
 void ASFXAI_Trooper::Initialize ( )
 {
-	static UFunction* pFnInitialize = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInitializeRef { L"Function SFXGameContent.SFXAI_Trooper.Initialize", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInitialize )
-		pFnInitialize = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXAI_Trooper.Initialize" );
+	UFunction* const pFnInitialize = pFnInitializeRef.Get ( );
 
 	ASFXAI_Trooper_execInitialize_Parms Initialize_Parms;
 
@@ -11293,10 +10277,9 @@ void ASFXAI_Trooper::Initialize ( )
 
 void ASFXAI_Trooper::OnShouldThrowGrenade ( class USequenceAction* Seq )
 {
-	static UFunction* pFnOnShouldThrowGrenade = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnShouldThrowGrenadeRef { L"Function SFXGameContent.SFXAI_Trooper.OnShouldThrowGrenade", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnShouldThrowGrenade )
-		pFnOnShouldThrowGrenade = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXAI_Trooper.OnShouldThrowGrenade" );
+	UFunction* const pFnOnShouldThrowGrenade = pFnOnShouldThrowGrenadeRef.Get ( );
 
 	ASFXAI_Trooper_execOnShouldThrowGrenade_Parms OnShouldThrowGrenade_Parms;
 	OnShouldThrowGrenade_Parms.Seq = Seq;
@@ -11311,10 +10294,9 @@ void ASFXAI_Trooper::OnShouldThrowGrenade ( class USequenceAction* Seq )
 
 bool ASFXAI_Trooper::ShouldUseGrenade ( )
 {
-	static UFunction* pFnShouldUseGrenade = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUseGrenadeRef { L"Function SFXGameContent.SFXAI_Trooper.ShouldUseGrenade", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUseGrenade )
-		pFnShouldUseGrenade = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXAI_Trooper.ShouldUseGrenade" );
+	UFunction* const pFnShouldUseGrenade = pFnShouldUseGrenadeRef.Get ( );
 
 	ASFXAI_Trooper_execShouldUseGrenade_Parms ShouldUseGrenade_Parms;
 
@@ -11325,26 +10307,20 @@ bool ASFXAI_Trooper::ShouldUseGrenade ( )
 
 
 
-class UClass* USFXAICmd_Base_Trooper::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXAICmd_Base_Trooper::pClassPointer { L"Class SFXGameContent.SFXAICmd_Base_Trooper", &UObject::FindClass };
 
 class UClass* USFXAICmd_Base_Trooper::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXAICmd_Base_Trooper" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXAICmd_Base_Cover::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXAICmd_Base_Cover::pClassPointer { L"Class SFXGameContent.SFXAICmd_Base_Cover", &UObject::FindClass };
 
 class UClass* USFXAICmd_Base_Cover::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXAICmd_Base_Cover" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXAICmd_Base_Cover.NotifyMoodChange
@@ -11354,10 +10330,9 @@ class UClass* USFXAICmd_Base_Cover::StaticClass()
 
 bool USFXAICmd_Base_Cover::NotifyMoodChange ( )
 {
-	static UFunction* pFnNotifyMoodChange = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyMoodChangeRef { L"Function SFXGameContent.SFXAICmd_Base_Cover.NotifyMoodChange", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyMoodChange )
-		pFnNotifyMoodChange = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXAICmd_Base_Cover.NotifyMoodChange" );
+	UFunction* const pFnNotifyMoodChange = pFnNotifyMoodChangeRef.Get ( );
 
 	USFXAICmd_Base_Cover_execNotifyMoodChange_Parms NotifyMoodChange_Parms;
 
@@ -11376,10 +10351,9 @@ bool USFXAICmd_Base_Cover::NotifyMoodChange ( )
 
 void USFXAICmd_Base_Cover::NotifyPendingPowerImpact ( struct SFXName Label, float TimeBeforeImpact, class USFXPowerCustomAction* Power, class ASFXProjectile_PowerCustomAction* Projectile )
 {
-	static UFunction* pFnNotifyPendingPowerImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyPendingPowerImpactRef { L"Function SFXGameContent.SFXAICmd_Base_Cover.NotifyPendingPowerImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyPendingPowerImpact )
-		pFnNotifyPendingPowerImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXAICmd_Base_Cover.NotifyPendingPowerImpact" );
+	UFunction* const pFnNotifyPendingPowerImpact = pFnNotifyPendingPowerImpactRef.Get ( );
 
 	USFXAICmd_Base_Cover_execNotifyPendingPowerImpact_Parms NotifyPendingPowerImpact_Parms;
 	memcpy ( &NotifyPendingPowerImpact_Parms.Label, &Label, 0x8 );
@@ -11401,10 +10375,9 @@ void USFXAICmd_Base_Cover::NotifyPendingPowerImpact ( struct SFXName Label, floa
 
 void USFXAICmd_Base_Cover::NotifyTakeHit ( class AController* instigatedBy, struct FVector const& HitLocation, int Damage, class UClass* DamageType, struct FVector const& Momentum )
 {
-	static UFunction* pFnNotifyTakeHit = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnNotifyTakeHitRef { L"Function SFXGameContent.SFXAICmd_Base_Cover.NotifyTakeHit", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnNotifyTakeHit )
-		pFnNotifyTakeHit = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXAICmd_Base_Cover.NotifyTakeHit" );
+	UFunction* const pFnNotifyTakeHit = pFnNotifyTakeHitRef.Get ( );
 
 	USFXAICmd_Base_Cover_execNotifyTakeHit_Parms NotifyTakeHit_Parms;
 	NotifyTakeHit_Parms.instigatedBy = instigatedBy;
@@ -11423,10 +10396,9 @@ void USFXAICmd_Base_Cover::NotifyTakeHit ( class AController* instigatedBy, stru
 
 bool USFXAICmd_Base_Cover::ShouldAttack ( )
 {
-	static UFunction* pFnShouldAttack = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldAttackRef { L"Function SFXGameContent.SFXAICmd_Base_Cover.ShouldAttack", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldAttack )
-		pFnShouldAttack = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXAICmd_Base_Cover.ShouldAttack" );
+	UFunction* const pFnShouldAttack = pFnShouldAttackRef.Get ( );
 
 	USFXAICmd_Base_Cover_execShouldAttack_Parms ShouldAttack_Parms;
 
@@ -11442,10 +10414,9 @@ bool USFXAICmd_Base_Cover::ShouldAttack ( )
 
 void USFXAICmd_Base_Cover::Resumed ( struct SFXName OldCommandName )
 {
-	static UFunction* pFnResumed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResumedRef { L"Function SFXGameContent.SFXAICmd_Base_Cover.Resumed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResumed )
-		pFnResumed = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXAICmd_Base_Cover.Resumed" );
+	UFunction* const pFnResumed = pFnResumedRef.Get ( );
 
 	USFXAICmd_Base_Cover_execResumed_Parms Resumed_Parms;
 	memcpy ( &Resumed_Parms.OldCommandName, &OldCommandName, 0x8 );
@@ -11459,10 +10430,9 @@ void USFXAICmd_Base_Cover::Resumed ( struct SFXName OldCommandName )
 
 void USFXAICmd_Base_Cover::Pushed ( )
 {
-	static UFunction* pFnPushed = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPushedRef { L"Function SFXGameContent.SFXAICmd_Base_Cover.Pushed", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPushed )
-		pFnPushed = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXAICmd_Base_Cover.Pushed" );
+	UFunction* const pFnPushed = pFnPushedRef.Get ( );
 
 	USFXAICmd_Base_Cover_execPushed_Parms Pushed_Parms;
 
@@ -11471,26 +10441,20 @@ void USFXAICmd_Base_Cover::Pushed ( )
 
 
 
-class UClass* USFXAICmd_Reaction_ShotInCover::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXAICmd_Reaction_ShotInCover::pClassPointer { L"Class SFXGameContent.SFXAICmd_Reaction_ShotInCover", &UObject::FindClass };
 
 class UClass* USFXAICmd_Reaction_ShotInCover::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXAICmd_Reaction_ShotInCover" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXAmmoContainer::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXAmmoContainer::pClassPointer { L"Class SFXGameContent.SFXAmmoContainer", &UObject::FindClass };
 
 class UClass* ASFXAmmoContainer::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXAmmoContainer" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXAmmoContainer.ReplicatedEvent
@@ -11500,10 +10464,9 @@ class UClass* ASFXAmmoContainer::StaticClass()
 
 void ASFXAmmoContainer::eventReplicatedEvent ( struct SFXName VarName )
 {
-	static UFunction* pFnReplicatedEvent = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReplicatedEventRef { L"Function SFXGameContent.SFXAmmoContainer.ReplicatedEvent", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReplicatedEvent )
-		pFnReplicatedEvent = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXAmmoContainer.ReplicatedEvent" );
+	UFunction* const pFnReplicatedEvent = pFnReplicatedEventRef.Get ( );
 
 	ASFXAmmoContainer_eventReplicatedEvent_Parms ReplicatedEvent_Parms;
 	memcpy ( &ReplicatedEvent_Parms.VarName, &VarName, 0x8 );
@@ -11518,10 +10481,9 @@ void ASFXAmmoContainer::eventReplicatedEvent ( struct SFXName VarName )
 
 void ASFXAmmoContainer::GiveTo ( class APawn* P )
 {
-	static UFunction* pFnGiveTo = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGiveToRef { L"Function SFXGameContent.SFXAmmoContainer.GiveTo", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGiveTo )
-		pFnGiveTo = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXAmmoContainer.GiveTo" );
+	UFunction* const pFnGiveTo = pFnGiveToRef.Get ( );
 
 	ASFXAmmoContainer_execGiveTo_Parms GiveTo_Parms;
 	GiveTo_Parms.P = P;
@@ -11535,10 +10497,9 @@ void ASFXAmmoContainer::GiveTo ( class APawn* P )
 
 void ASFXAmmoContainer::StartSleeping ( )
 {
-	static UFunction* pFnStartSleeping = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartSleepingRef { L"Function SFXGameContent.SFXAmmoContainer.StartSleeping", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartSleeping )
-		pFnStartSleeping = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXAmmoContainer.StartSleeping" );
+	UFunction* const pFnStartSleeping = pFnStartSleepingRef.Get ( );
 
 	ASFXAmmoContainer_execStartSleeping_Parms StartSleeping_Parms;
 
@@ -11551,10 +10512,9 @@ void ASFXAmmoContainer::StartSleeping ( )
 
 void ASFXAmmoContainer::SetRespawn ( )
 {
-	static UFunction* pFnSetRespawn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetRespawnRef { L"Function SFXGameContent.SFXAmmoContainer.SetRespawn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetRespawn )
-		pFnSetRespawn = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXAmmoContainer.SetRespawn" );
+	UFunction* const pFnSetRespawn = pFnSetRespawnRef.Get ( );
 
 	ASFXAmmoContainer_execSetRespawn_Parms SetRespawn_Parms;
 
@@ -11567,10 +10527,9 @@ void ASFXAmmoContainer::SetRespawn ( )
 
 void ASFXAmmoContainer::eventSetInitialState ( )
 {
-	static UFunction* pFnSetInitialState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetInitialStateRef { L"Function SFXGameContent.SFXAmmoContainer.SetInitialState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetInitialState )
-		pFnSetInitialState = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXAmmoContainer.SetInitialState" );
+	UFunction* const pFnSetInitialState = pFnSetInitialStateRef.Get ( );
 
 	ASFXAmmoContainer_eventSetInitialState_Parms SetInitialState_Parms;
 
@@ -11579,26 +10538,20 @@ void ASFXAmmoContainer::eventSetInitialState ( )
 
 
 
-class UClass* USFXCustomAction_AILadderClimbDown::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_AILadderClimbDown::pClassPointer { L"Class SFXGameContent.SFXCustomAction_AILadderClimbDown", &UObject::FindClass };
 
 class UClass* USFXCustomAction_AILadderClimbDown::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_AILadderClimbDown" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_AILadderClimbUp::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_AILadderClimbUp::pClassPointer { L"Class SFXGameContent.SFXCustomAction_AILadderClimbUp", &UObject::FindClass };
 
 class UClass* USFXCustomAction_AILadderClimbUp::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_AILadderClimbUp" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_AILadderClimbUp.StopCustomAction
@@ -11607,10 +10560,9 @@ class UClass* USFXCustomAction_AILadderClimbUp::StaticClass()
 
 void USFXCustomAction_AILadderClimbUp::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_AILadderClimbUp.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_AILadderClimbUp.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_AILadderClimbUp_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -11623,10 +10575,9 @@ void USFXCustomAction_AILadderClimbUp::StopCustomAction ( )
 
 void USFXCustomAction_AILadderClimbUp::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_AILadderClimbUp.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_AILadderClimbUp.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_AILadderClimbUp_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -11635,26 +10586,20 @@ void USFXCustomAction_AILadderClimbUp::StartCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_AIMantleOverCover::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_AIMantleOverCover::pClassPointer { L"Class SFXGameContent.SFXCustomAction_AIMantleOverCover", &UObject::FindClass };
 
 class UClass* USFXCustomAction_AIMantleOverCover::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_AIMantleOverCover" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_AIMantleUp::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_AIMantleUp::pClassPointer { L"Class SFXGameContent.SFXCustomAction_AIMantleUp", &UObject::FindClass };
 
 class UClass* USFXCustomAction_AIMantleUp::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_AIMantleUp" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_AIMantleUp.GetBodyStanceAnim
@@ -11664,10 +10609,9 @@ class UClass* USFXCustomAction_AIMantleUp::StaticClass()
 
 struct FBodyStance USFXCustomAction_AIMantleUp::GetBodyStanceAnim ( )
 {
-	static UFunction* pFnGetBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_AIMantleUp.GetBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetBodyStanceAnim )
-		pFnGetBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_AIMantleUp.GetBodyStanceAnim" );
+	UFunction* const pFnGetBodyStanceAnim = pFnGetBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_AIMantleUp_execGetBodyStanceAnim_Parms GetBodyStanceAnim_Parms;
 
@@ -11682,10 +10626,9 @@ struct FBodyStance USFXCustomAction_AIMantleUp::GetBodyStanceAnim ( )
 
 void USFXCustomAction_AIMantleUp::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_AIMantleUp.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_AIMantleUp.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_AIMantleUp_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -11699,10 +10642,9 @@ void USFXCustomAction_AIMantleUp::StartCustomAction ( )
 
 void USFXCustomAction_AIMantleUp::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_AIMantleUp.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_AIMantleUp.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_AIMantleUp_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -11717,50 +10659,38 @@ void USFXCustomAction_AIMantleUp::eventGetUsedAnimNames ( TArray<struct SFXName>
 
 
 
-class UClass* USFXCustomAction_AISwatTurnLeft::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_AISwatTurnLeft::pClassPointer { L"Class SFXGameContent.SFXCustomAction_AISwatTurnLeft", &UObject::FindClass };
 
 class UClass* USFXCustomAction_AISwatTurnLeft::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_AISwatTurnLeft" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_AISwatTurnRight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_AISwatTurnRight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_AISwatTurnRight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_AISwatTurnRight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_AISwatTurnRight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_AnimRagdollSingularity::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_AnimRagdollSingularity::pClassPointer { L"Class SFXGameContent.SFXCustomAction_AnimRagdollSingularity", &UObject::FindClass };
 
 class UClass* USFXCustomAction_AnimRagdollSingularity::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_AnimRagdollSingularity" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_BoostDown::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_BoostDown::pClassPointer { L"Class SFXGameContent.SFXCustomAction_BoostDown", &UObject::FindClass };
 
 class UClass* USFXCustomAction_BoostDown::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_BoostDown" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_BoostDown.SetMoveStage
@@ -11770,10 +10700,9 @@ class UClass* USFXCustomAction_BoostDown::StaticClass()
 
 void USFXCustomAction_BoostDown::SetMoveStage ( unsigned char NextStage )
 {
-	static UFunction* pFnSetMoveStage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetMoveStageRef { L"Function SFXGameContent.SFXCustomAction_BoostDown.SetMoveStage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetMoveStage )
-		pFnSetMoveStage = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_BoostDown.SetMoveStage" );
+	UFunction* const pFnSetMoveStage = pFnSetMoveStageRef.Get ( );
 
 	USFXCustomAction_BoostDown_execSetMoveStage_Parms SetMoveStage_Parms;
 	SetMoveStage_Parms.NextStage = NextStage;
@@ -11787,10 +10716,9 @@ void USFXCustomAction_BoostDown::SetMoveStage ( unsigned char NextStage )
 
 void USFXCustomAction_BoostDown::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_BoostDown.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_BoostDown.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_BoostDown_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -11799,14 +10727,11 @@ void USFXCustomAction_BoostDown::StopCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_BoostUp::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_BoostUp::pClassPointer { L"Class SFXGameContent.SFXCustomAction_BoostUp", &UObject::FindClass };
 
 class UClass* USFXCustomAction_BoostUp::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_BoostUp" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_BoostUp.EndRocketBoots
@@ -11815,10 +10740,9 @@ class UClass* USFXCustomAction_BoostUp::StaticClass()
 
 void USFXCustomAction_BoostUp::EndRocketBoots ( )
 {
-	static UFunction* pFnEndRocketBoots = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEndRocketBootsRef { L"Function SFXGameContent.SFXCustomAction_BoostUp.EndRocketBoots", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEndRocketBoots )
-		pFnEndRocketBoots = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_BoostUp.EndRocketBoots" );
+	UFunction* const pFnEndRocketBoots = pFnEndRocketBootsRef.Get ( );
 
 	USFXCustomAction_BoostUp_execEndRocketBoots_Parms EndRocketBoots_Parms;
 
@@ -11831,10 +10755,9 @@ void USFXCustomAction_BoostUp::EndRocketBoots ( )
 
 void USFXCustomAction_BoostUp::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_BoostUp.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_BoostUp.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_BoostUp_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -11848,10 +10771,9 @@ void USFXCustomAction_BoostUp::StopCustomAction ( )
 
 void USFXCustomAction_BoostUp::SetMoveStage ( unsigned char NextStage )
 {
-	static UFunction* pFnSetMoveStage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetMoveStageRef { L"Function SFXGameContent.SFXCustomAction_BoostUp.SetMoveStage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetMoveStage )
-		pFnSetMoveStage = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_BoostUp.SetMoveStage" );
+	UFunction* const pFnSetMoveStage = pFnSetMoveStageRef.Get ( );
 
 	USFXCustomAction_BoostUp_execSetMoveStage_Parms SetMoveStage_Parms;
 	SetMoveStage_Parms.NextStage = NextStage;
@@ -11861,14 +10783,11 @@ void USFXCustomAction_BoostUp::SetMoveStage ( unsigned char NextStage )
 
 
 
-class UClass* USFXGameEffect_RagdollRocket::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_RagdollRocket::pClassPointer { L"Class SFXGameContent.SFXGameEffect_RagdollRocket", &UObject::FindClass };
 
 class UClass* USFXGameEffect_RagdollRocket::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_RagdollRocket" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_RagdollRocket.HasAntiGravity
@@ -11878,10 +10797,9 @@ class UClass* USFXGameEffect_RagdollRocket::StaticClass()
 
 bool USFXGameEffect_RagdollRocket::HasAntiGravity ( )
 {
-	static UFunction* pFnHasAntiGravity = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnHasAntiGravityRef { L"Function SFXGameContent.SFXGameEffect_RagdollRocket.HasAntiGravity", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnHasAntiGravity )
-		pFnHasAntiGravity = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_RagdollRocket.HasAntiGravity" );
+	UFunction* const pFnHasAntiGravity = pFnHasAntiGravityRef.Get ( );
 
 	USFXGameEffect_RagdollRocket_execHasAntiGravity_Parms HasAntiGravity_Parms;
 
@@ -11897,10 +10815,9 @@ bool USFXGameEffect_RagdollRocket::HasAntiGravity ( )
 
 void USFXGameEffect_RagdollRocket::OnUpdate ( float DeltaSeconds )
 {
-	static UFunction* pFnOnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUpdateRef { L"Function SFXGameContent.SFXGameEffect_RagdollRocket.OnUpdate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUpdate )
-		pFnOnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_RagdollRocket.OnUpdate" );
+	UFunction* const pFnOnUpdate = pFnOnUpdateRef.Get ( );
 
 	USFXGameEffect_RagdollRocket_execOnUpdate_Parms OnUpdate_Parms;
 	OnUpdate_Parms.DeltaSeconds = DeltaSeconds;
@@ -11914,10 +10831,9 @@ void USFXGameEffect_RagdollRocket::OnUpdate ( float DeltaSeconds )
 
 void USFXGameEffect_RagdollRocket::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_RagdollRocket.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_RagdollRocket.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_RagdollRocket_execOnApplied_Parms OnApplied_Parms;
 
@@ -11926,62 +10842,47 @@ void USFXGameEffect_RagdollRocket::OnApplied ( )
 
 
 
-class UClass* USFXCustomAction_CoverSlipLeft::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_CoverSlipLeft::pClassPointer { L"Class SFXGameContent.SFXCustomAction_CoverSlipLeft", &UObject::FindClass };
 
 class UClass* USFXCustomAction_CoverSlipLeft::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_CoverSlipLeft" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_CoverSlipLeftStanding::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_CoverSlipLeftStanding::pClassPointer { L"Class SFXGameContent.SFXCustomAction_CoverSlipLeftStanding", &UObject::FindClass };
 
 class UClass* USFXCustomAction_CoverSlipLeftStanding::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_CoverSlipLeftStanding" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_CoverSlipRight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_CoverSlipRight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_CoverSlipRight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_CoverSlipRight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_CoverSlipRight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_CoverSlipRightStanding::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_CoverSlipRightStanding::pClassPointer { L"Class SFXGameContent.SFXCustomAction_CoverSlipRightStanding", &UObject::FindClass };
 
 class UClass* USFXCustomAction_CoverSlipRightStanding::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_CoverSlipRightStanding" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_DeathReaction::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_DeathReaction::pClassPointer { L"Class SFXGameContent.SFXCustomAction_DeathReaction", &UObject::FindClass };
 
 class UClass* USFXCustomAction_DeathReaction::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_DeathReaction" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_DeathReaction.PlayImpactSound
@@ -11990,10 +10891,9 @@ class UClass* USFXCustomAction_DeathReaction::StaticClass()
 
 void USFXCustomAction_DeathReaction::PlayImpactSound ( )
 {
-	static UFunction* pFnPlayImpactSound = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayImpactSoundRef { L"Function SFXGameContent.SFXCustomAction_DeathReaction.PlayImpactSound", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayImpactSound )
-		pFnPlayImpactSound = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_DeathReaction.PlayImpactSound" );
+	UFunction* const pFnPlayImpactSound = pFnPlayImpactSoundRef.Get ( );
 
 	USFXCustomAction_DeathReaction_execPlayImpactSound_Parms PlayImpactSound_Parms;
 
@@ -12009,10 +10909,9 @@ void USFXCustomAction_DeathReaction::PlayImpactSound ( )
 
 void USFXCustomAction_DeathReaction::BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime )
 {
-	static UFunction* pFnBodyStanceAnimEndNotification = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBodyStanceAnimEndNotificationRef { L"Function SFXGameContent.SFXCustomAction_DeathReaction.BodyStanceAnimEndNotification", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBodyStanceAnimEndNotification )
-		pFnBodyStanceAnimEndNotification = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_DeathReaction.BodyStanceAnimEndNotification" );
+	UFunction* const pFnBodyStanceAnimEndNotification = pFnBodyStanceAnimEndNotificationRef.Get ( );
 
 	USFXCustomAction_DeathReaction_execBodyStanceAnimEndNotification_Parms BodyStanceAnimEndNotification_Parms;
 	BodyStanceAnimEndNotification_Parms.SeqNode = SeqNode;
@@ -12028,10 +10927,9 @@ void USFXCustomAction_DeathReaction::BodyStanceAnimEndNotification ( class UAnim
 
 void USFXCustomAction_DeathReaction::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_DeathReaction.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_DeathReaction.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_DeathReaction_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -12040,26 +10938,20 @@ void USFXCustomAction_DeathReaction::StartCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_DeathReaction_Corkscrew::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_DeathReaction_Corkscrew::pClassPointer { L"Class SFXGameContent.SFXCustomAction_DeathReaction_Corkscrew", &UObject::FindClass };
 
 class UClass* USFXCustomAction_DeathReaction_Corkscrew::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_DeathReaction_Corkscrew" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_DeathReaction_GibHeadshot::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_DeathReaction_GibHeadshot::pClassPointer { L"Class SFXGameContent.SFXCustomAction_DeathReaction_GibHeadshot", &UObject::FindClass };
 
 class UClass* USFXCustomAction_DeathReaction_GibHeadshot::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_DeathReaction_GibHeadshot" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_DeathReaction_GibHeadshot.ActivateImpactEmitter
@@ -12072,10 +10964,9 @@ class UClass* USFXCustomAction_DeathReaction_GibHeadshot::StaticClass()
 
 void USFXCustomAction_DeathReaction_GibHeadshot::ActivateImpactEmitter ( struct FVector const& HitLocation, struct FVector const& HitNormal, struct SFXName BoneName, class UClass* DamageType )
 {
-	static UFunction* pFnActivateImpactEmitter = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivateImpactEmitterRef { L"Function SFXGameContent.SFXCustomAction_DeathReaction_GibHeadshot.ActivateImpactEmitter", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivateImpactEmitter )
-		pFnActivateImpactEmitter = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_DeathReaction_GibHeadshot.ActivateImpactEmitter" );
+	UFunction* const pFnActivateImpactEmitter = pFnActivateImpactEmitterRef.Get ( );
 
 	USFXCustomAction_DeathReaction_GibHeadshot_execActivateImpactEmitter_Parms ActivateImpactEmitter_Parms;
 	memcpy ( &ActivateImpactEmitter_Parms.HitLocation, &HitLocation, 0xC );
@@ -12094,10 +10985,9 @@ void USFXCustomAction_DeathReaction_GibHeadshot::ActivateImpactEmitter ( struct
 
 void USFXCustomAction_DeathReaction_GibHeadshot::PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects )
 {
-	static UFunction* pFnPrecacheVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPrecacheVFXRef { L"Function SFXGameContent.SFXCustomAction_DeathReaction_GibHeadshot.PrecacheVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPrecacheVFX )
-		pFnPrecacheVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_DeathReaction_GibHeadshot.PrecacheVFX" );
+	UFunction* const pFnPrecacheVFX = pFnPrecacheVFXRef.Get ( );
 
 	USFXCustomAction_DeathReaction_GibHeadshot_execPrecacheVFX_Parms PrecacheVFX_Parms;
 	PrecacheVFX_Parms.ObjectPool = ObjectPool;
@@ -12108,14 +10998,11 @@ void USFXCustomAction_DeathReaction_GibHeadshot::PrecacheVFX ( class ASFXObjectP
 
 
 
-class UClass* USFXCustomAction_DeathReaction_GibKnockback::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_DeathReaction_GibKnockback::pClassPointer { L"Class SFXGameContent.SFXCustomAction_DeathReaction_GibKnockback", &UObject::FindClass };
 
 class UClass* USFXCustomAction_DeathReaction_GibKnockback::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_DeathReaction_GibKnockback" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_DeathReaction_GibKnockback.StopAnim
@@ -12124,10 +11011,9 @@ class UClass* USFXCustomAction_DeathReaction_GibKnockback::StaticClass()
 
 void USFXCustomAction_DeathReaction_GibKnockback::StopAnim ( )
 {
-	static UFunction* pFnStopAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopAnimRef { L"Function SFXGameContent.SFXCustomAction_DeathReaction_GibKnockback.StopAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopAnim )
-		pFnStopAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_DeathReaction_GibKnockback.StopAnim" );
+	UFunction* const pFnStopAnim = pFnStopAnimRef.Get ( );
 
 	USFXCustomAction_DeathReaction_GibKnockback_execStopAnim_Parms StopAnim_Parms;
 
@@ -12144,10 +11030,9 @@ void USFXCustomAction_DeathReaction_GibKnockback::StopAnim ( )
 
 void USFXCustomAction_DeathReaction_GibKnockback::ActivateImpactEmitter ( struct FVector const& HitLocation, struct FVector const& HitNormal, struct SFXName BoneName, class UClass* DamageType )
 {
-	static UFunction* pFnActivateImpactEmitter = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivateImpactEmitterRef { L"Function SFXGameContent.SFXCustomAction_DeathReaction_GibKnockback.ActivateImpactEmitter", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivateImpactEmitter )
-		pFnActivateImpactEmitter = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_DeathReaction_GibKnockback.ActivateImpactEmitter" );
+	UFunction* const pFnActivateImpactEmitter = pFnActivateImpactEmitterRef.Get ( );
 
 	USFXCustomAction_DeathReaction_GibKnockback_execActivateImpactEmitter_Parms ActivateImpactEmitter_Parms;
 	memcpy ( &ActivateImpactEmitter_Parms.HitLocation, &HitLocation, 0xC );
@@ -12166,10 +11051,9 @@ void USFXCustomAction_DeathReaction_GibKnockback::ActivateImpactEmitter ( struct
 
 void USFXCustomAction_DeathReaction_GibKnockback::PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects )
 {
-	static UFunction* pFnPrecacheVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPrecacheVFXRef { L"Function SFXGameContent.SFXCustomAction_DeathReaction_GibKnockback.PrecacheVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPrecacheVFX )
-		pFnPrecacheVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_DeathReaction_GibKnockback.PrecacheVFX" );
+	UFunction* const pFnPrecacheVFX = pFnPrecacheVFXRef.Get ( );
 
 	USFXCustomAction_DeathReaction_GibKnockback_execPrecacheVFX_Parms PrecacheVFX_Parms;
 	PrecacheVFX_Parms.ObjectPool = ObjectPool;
@@ -12180,14 +11064,11 @@ void USFXCustomAction_DeathReaction_GibKnockback::PrecacheVFX ( class ASFXObject
 
 
 
-class UClass* USFXCustomAction_DeathReaction_Headshot_Cover::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_DeathReaction_Headshot_Cover::pClassPointer { L"Class SFXGameContent.SFXCustomAction_DeathReaction_Headshot_Cover", &UObject::FindClass };
 
 class UClass* USFXCustomAction_DeathReaction_Headshot_Cover::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_DeathReaction_Headshot_Cover" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_DeathReaction_Headshot_Cover.ActivateImpactEmitter
@@ -12200,10 +11081,9 @@ class UClass* USFXCustomAction_DeathReaction_Headshot_Cover::StaticClass()
 
 void USFXCustomAction_DeathReaction_Headshot_Cover::ActivateImpactEmitter ( struct FVector const& HitLocation, struct FVector const& HitNormal, struct SFXName BoneName, class UClass* DamageType )
 {
-	static UFunction* pFnActivateImpactEmitter = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnActivateImpactEmitterRef { L"Function SFXGameContent.SFXCustomAction_DeathReaction_Headshot_Cover.ActivateImpactEmitter", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnActivateImpactEmitter )
-		pFnActivateImpactEmitter = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_DeathReaction_Headshot_Cover.ActivateImpactEmitter" );
+	UFunction* const pFnActivateImpactEmitter = pFnActivateImpactEmitterRef.Get ( );
 
 	USFXCustomAction_DeathReaction_Headshot_Cover_execActivateImpactEmitter_Parms ActivateImpactEmitter_Parms;
 	memcpy ( &ActivateImpactEmitter_Parms.HitLocation, &HitLocation, 0xC );
@@ -12216,338 +11096,254 @@ void USFXCustomAction_DeathReaction_Headshot_Cover::ActivateImpactEmitter ( stru
 
 
 
-class UClass* USFXCustomAction_DeathReaction_HeavyLeftArm::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_DeathReaction_HeavyLeftArm::pClassPointer { L"Class SFXGameContent.SFXCustomAction_DeathReaction_HeavyLeftArm", &UObject::FindClass };
 
 class UClass* USFXCustomAction_DeathReaction_HeavyLeftArm::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_DeathReaction_HeavyLeftArm" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_DeathReaction_HeavyRightArm::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_DeathReaction_HeavyRightArm::pClassPointer { L"Class SFXGameContent.SFXCustomAction_DeathReaction_HeavyRightArm", &UObject::FindClass };
 
 class UClass* USFXCustomAction_DeathReaction_HeavyRightArm::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_DeathReaction_HeavyRightArm" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_DeathReaction_LeftArm::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_DeathReaction_LeftArm::pClassPointer { L"Class SFXGameContent.SFXCustomAction_DeathReaction_LeftArm", &UObject::FindClass };
 
 class UClass* USFXCustomAction_DeathReaction_LeftArm::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_DeathReaction_LeftArm" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_DeathReaction_LeftLeg::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_DeathReaction_LeftLeg::pClassPointer { L"Class SFXGameContent.SFXCustomAction_DeathReaction_LeftLeg", &UObject::FindClass };
 
 class UClass* USFXCustomAction_DeathReaction_LeftLeg::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_DeathReaction_LeftLeg" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_DeathReaction_RightArm::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_DeathReaction_RightArm::pClassPointer { L"Class SFXGameContent.SFXCustomAction_DeathReaction_RightArm", &UObject::FindClass };
 
 class UClass* USFXCustomAction_DeathReaction_RightArm::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_DeathReaction_RightArm" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_DeathReaction_RightLeg::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_DeathReaction_RightLeg::pClassPointer { L"Class SFXGameContent.SFXCustomAction_DeathReaction_RightLeg", &UObject::FindClass };
 
 class UClass* USFXCustomAction_DeathReaction_RightLeg::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_DeathReaction_RightLeg" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_DeathReaction_Stomach::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_DeathReaction_Stomach::pClassPointer { L"Class SFXGameContent.SFXCustomAction_DeathReaction_Stomach", &UObject::FindClass };
 
 class UClass* USFXCustomAction_DeathReaction_Stomach::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_DeathReaction_Stomach" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_Freezing::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_Freezing::pClassPointer { L"Class SFXGameContent.SFXCustomAction_Freezing", &UObject::FindClass };
 
 class UClass* USFXCustomAction_Freezing::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_Freezing" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_FreezingII::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_FreezingII::pClassPointer { L"Class SFXGameContent.SFXCustomAction_FreezingII", &UObject::FindClass };
 
 class UClass* USFXCustomAction_FreezingII::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_FreezingII" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_FreezingIII::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_FreezingIII::pClassPointer { L"Class SFXGameContent.SFXCustomAction_FreezingIII", &UObject::FindClass };
 
 class UClass* USFXCustomAction_FreezingIII::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_FreezingIII" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_GreatPain::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_GreatPain::pClassPointer { L"Class SFXGameContent.SFXCustomAction_GreatPain", &UObject::FindClass };
 
 class UClass* USFXCustomAction_GreatPain::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_GreatPain" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_GreatPainII::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_GreatPainII::pClassPointer { L"Class SFXGameContent.SFXCustomAction_GreatPainII", &UObject::FindClass };
 
 class UClass* USFXCustomAction_GreatPainII::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_GreatPainII" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_IdleInspectWeapon::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_IdleInspectWeapon::pClassPointer { L"Class SFXGameContent.SFXCustomAction_IdleInspectWeapon", &UObject::FindClass };
 
 class UClass* USFXCustomAction_IdleInspectWeapon::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_IdleInspectWeapon" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_IdleListening::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_IdleListening::pClassPointer { L"Class SFXGameContent.SFXCustomAction_IdleListening", &UObject::FindClass };
 
 class UClass* USFXCustomAction_IdleListening::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_IdleListening" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_IdleListening2::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_IdleListening2::pClassPointer { L"Class SFXGameContent.SFXCustomAction_IdleListening2", &UObject::FindClass };
 
 class UClass* USFXCustomAction_IdleListening2::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_IdleListening2" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_IdleListening3::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_IdleListening3::pClassPointer { L"Class SFXGameContent.SFXCustomAction_IdleListening3", &UObject::FindClass };
 
 class UClass* USFXCustomAction_IdleListening3::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_IdleListening3" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_IdleStandGuard::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_IdleStandGuard::pClassPointer { L"Class SFXGameContent.SFXCustomAction_IdleStandGuard", &UObject::FindClass };
 
 class UClass* USFXCustomAction_IdleStandGuard::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_IdleStandGuard" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_IdleTalking::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_IdleTalking::pClassPointer { L"Class SFXGameContent.SFXCustomAction_IdleTalking", &UObject::FindClass };
 
 class UClass* USFXCustomAction_IdleTalking::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_IdleTalking" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_IdleTalking2::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_IdleTalking2::pClassPointer { L"Class SFXGameContent.SFXCustomAction_IdleTalking2", &UObject::FindClass };
 
 class UClass* USFXCustomAction_IdleTalking2::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_IdleTalking2" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_IdleTalking3::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_IdleTalking3::pClassPointer { L"Class SFXGameContent.SFXCustomAction_IdleTalking3", &UObject::FindClass };
 
 class UClass* USFXCustomAction_IdleTalking3::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_IdleTalking3" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_IdleUseConsole::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_IdleUseConsole::pClassPointer { L"Class SFXGameContent.SFXCustomAction_IdleUseConsole", &UObject::FindClass };
 
 class UClass* USFXCustomAction_IdleUseConsole::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_IdleUseConsole" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_OnFire::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_OnFire::pClassPointer { L"Class SFXGameContent.SFXCustomAction_OnFire", &UObject::FindClass };
 
 class UClass* USFXCustomAction_OnFire::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_OnFire" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_OnFireII::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_OnFireII::pClassPointer { L"Class SFXGameContent.SFXCustomAction_OnFireII", &UObject::FindClass };
 
 class UClass* USFXCustomAction_OnFireII::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_OnFireII" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_RollBackward::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_RollBackward::pClassPointer { L"Class SFXGameContent.SFXCustomAction_RollBackward", &UObject::FindClass };
 
 class UClass* USFXCustomAction_RollBackward::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_RollBackward" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_RollForward::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_RollForward::pClassPointer { L"Class SFXGameContent.SFXCustomAction_RollForward", &UObject::FindClass };
 
 class UClass* USFXCustomAction_RollForward::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_RollForward" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_RollLeft::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_RollLeft::pClassPointer { L"Class SFXGameContent.SFXCustomAction_RollLeft", &UObject::FindClass };
 
 class UClass* USFXCustomAction_RollLeft::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_RollLeft" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_RollRight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_RollRight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_RollRight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_RollRight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_RollRight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_ShieldBreach::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_ShieldBreach::pClassPointer { L"Class SFXGameContent.SFXCustomAction_ShieldBreach", &UObject::FindClass };
 
 class UClass* USFXCustomAction_ShieldBreach::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_ShieldBreach" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_ShieldBreach.StartCustomAction
@@ -12556,10 +11352,9 @@ class UClass* USFXCustomAction_ShieldBreach::StaticClass()
 
 void USFXCustomAction_ShieldBreach::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_ShieldBreach.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_ShieldBreach.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_ShieldBreach_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -12575,10 +11370,9 @@ void USFXCustomAction_ShieldBreach::StartCustomAction ( )
 
 bool USFXCustomAction_ShieldBreach::InternalCanDoCustomAction ( class ABioPawn* SyncPawn, unsigned long bForced )
 {
-	static UFunction* pFnInternalCanDoCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnInternalCanDoCustomActionRef { L"Function SFXGameContent.SFXCustomAction_ShieldBreach.InternalCanDoCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnInternalCanDoCustomAction )
-		pFnInternalCanDoCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_ShieldBreach.InternalCanDoCustomAction" );
+	UFunction* const pFnInternalCanDoCustomAction = pFnInternalCanDoCustomActionRef.Get ( );
 
 	USFXCustomAction_ShieldBreach_execInternalCanDoCustomAction_Parms InternalCanDoCustomAction_Parms;
 	InternalCanDoCustomAction_Parms.SyncPawn = SyncPawn;
@@ -12596,10 +11390,9 @@ bool USFXCustomAction_ShieldBreach::InternalCanDoCustomAction ( class ABioPawn*
 
 void USFXCustomAction_ShieldBreach::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_ShieldBreach.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_ShieldBreach.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_ShieldBreach_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -12614,146 +11407,110 @@ void USFXCustomAction_ShieldBreach::eventGetUsedAnimNames ( TArray<struct SFXNam
 
 
 
-class UClass* USFXCustomAction_StaggerImpact::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StaggerImpact::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StaggerImpact", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StaggerImpact::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StaggerImpact" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_StaggerImpactForward::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StaggerImpactForward::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StaggerImpactForward", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StaggerImpactForward::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StaggerImpactForward" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_StaggerImpactII::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StaggerImpactII::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StaggerImpactII", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StaggerImpactII::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StaggerImpactII" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_StaggerImpactLeft::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StaggerImpactLeft::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StaggerImpactLeft", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StaggerImpactLeft::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StaggerImpactLeft" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_StaggerImpactRight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StaggerImpactRight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StaggerImpactRight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StaggerImpactRight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StaggerImpactRight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_StandardImpact::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StandardImpact::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StandardImpact", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StandardImpact::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StandardImpact" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_StandardImpactForward::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StandardImpactForward::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StandardImpactForward", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StandardImpactForward::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StandardImpactForward" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_StandardImpactII::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StandardImpactII::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StandardImpactII", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StandardImpactII::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StandardImpactII" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_StandardImpactKnee::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StandardImpactKnee::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StandardImpactKnee", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StandardImpactKnee::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StandardImpactKnee" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_StandardImpactLeft::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StandardImpactLeft::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StandardImpactLeft", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StandardImpactLeft::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StandardImpactLeft" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_StandardImpactRight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_StandardImpactRight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_StandardImpactRight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_StandardImpactRight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_StandardImpactRight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_TrooperMelee::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_TrooperMelee::pClassPointer { L"Class SFXGameContent.SFXCustomAction_TrooperMelee", &UObject::FindClass };
 
 class UClass* USFXCustomAction_TrooperMelee::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_TrooperMelee" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_TrooperMelee.ClientDoCustomActionImpact
@@ -12768,10 +11525,9 @@ class UClass* USFXCustomAction_TrooperMelee::StaticClass()
 
 void USFXCustomAction_TrooperMelee::ClientDoCustomActionImpact ( class AActor* oActor, int ImpactCount, unsigned long bFirstTarget, struct FVector const& HitLocation, struct FVector const& HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnClientDoCustomActionImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoCustomActionImpactRef { L"Function SFXGameContent.SFXCustomAction_TrooperMelee.ClientDoCustomActionImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoCustomActionImpact )
-		pFnClientDoCustomActionImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_TrooperMelee.ClientDoCustomActionImpact" );
+	UFunction* const pFnClientDoCustomActionImpact = pFnClientDoCustomActionImpactRef.Get ( );
 
 	USFXCustomAction_TrooperMelee_execClientDoCustomActionImpact_Parms ClientDoCustomActionImpact_Parms;
 	ClientDoCustomActionImpact_Parms.oActor = oActor;
@@ -12786,14 +11542,11 @@ void USFXCustomAction_TrooperMelee::ClientDoCustomActionImpact ( class AActor* o
 
 
 
-class UClass* USFXCustomAction_TrooperStomp::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_TrooperStomp::pClassPointer { L"Class SFXGameContent.SFXCustomAction_TrooperStomp", &UObject::FindClass };
 
 class UClass* USFXCustomAction_TrooperStomp::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_TrooperStomp" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_TrooperStomp.OnTimelineImpact
@@ -12803,10 +11556,9 @@ class UClass* USFXCustomAction_TrooperStomp::StaticClass()
 
 void USFXCustomAction_TrooperStomp::OnTimelineImpact ( class AActor* Target )
 {
-	static UFunction* pFnOnTimelineImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnTimelineImpactRef { L"Function SFXGameContent.SFXCustomAction_TrooperStomp.OnTimelineImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnTimelineImpact )
-		pFnOnTimelineImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_TrooperStomp.OnTimelineImpact" );
+	UFunction* const pFnOnTimelineImpact = pFnOnTimelineImpactRef.Get ( );
 
 	USFXCustomAction_TrooperStomp_execOnTimelineImpact_Parms OnTimelineImpact_Parms;
 	OnTimelineImpact_Parms.Target = Target;
@@ -12826,10 +11578,9 @@ void USFXCustomAction_TrooperStomp::OnTimelineImpact ( class AActor* Target )
 
 void USFXCustomAction_TrooperStomp::ClientDoCustomActionImpact ( class AActor* oActor, int ImpactCount, unsigned long bFirstTarget, struct FVector const& HitLocation, struct FVector const& HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnClientDoCustomActionImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoCustomActionImpactRef { L"Function SFXGameContent.SFXCustomAction_TrooperStomp.ClientDoCustomActionImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoCustomActionImpact )
-		pFnClientDoCustomActionImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_TrooperStomp.ClientDoCustomActionImpact" );
+	UFunction* const pFnClientDoCustomActionImpact = pFnClientDoCustomActionImpactRef.Get ( );
 
 	USFXCustomAction_TrooperStomp_execClientDoCustomActionImpact_Parms ClientDoCustomActionImpact_Parms;
 	ClientDoCustomActionImpact_Parms.oActor = oActor;
@@ -12844,110 +11595,83 @@ void USFXCustomAction_TrooperStomp::ClientDoCustomActionImpact ( class AActor* o
 
 
 
-class UClass* USFXDamageType_EnemyGrenade::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_EnemyGrenade::pClassPointer { L"Class SFXGameContent.SFXDamageType_EnemyGrenade", &UObject::FindClass };
 
 class UClass* USFXDamageType_EnemyGrenade::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_EnemyGrenade" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_SMG_Tempest::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_SMG_Tempest::pClassPointer { L"Class SFXGameContent.SFXDamageType_SMG_Tempest", &UObject::FindClass };
 
 class UClass* USFXDamageType_SMG_Tempest::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_SMG_Tempest" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_TacticalMachinePistol::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_TacticalMachinePistol::pClassPointer { L"Class SFXGameContent.SFXDamageType_TacticalMachinePistol", &UObject::FindClass };
 
 class UClass* USFXDamageType_TacticalMachinePistol::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_TacticalMachinePistol" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXNav_InteractionHenchOmniToolCrouch::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXNav_InteractionHenchOmniToolCrouch::pClassPointer { L"Class SFXGameContent.SFXNav_InteractionHenchOmniToolCrouch", &UObject::FindClass };
 
 class UClass* ASFXNav_InteractionHenchOmniToolCrouch::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXNav_InteractionHenchOmniToolCrouch" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXNav_InteractionInspectWeapon::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXNav_InteractionInspectWeapon::pClassPointer { L"Class SFXGameContent.SFXNav_InteractionInspectWeapon", &UObject::FindClass };
 
 class UClass* ASFXNav_InteractionInspectWeapon::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXNav_InteractionInspectWeapon" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXNav_InteractionStandGuard::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXNav_InteractionStandGuard::pClassPointer { L"Class SFXGameContent.SFXNav_InteractionStandGuard", &UObject::FindClass };
 
 class UClass* ASFXNav_InteractionStandGuard::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXNav_InteractionStandGuard" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXPawn_Trooper::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXPawn_Trooper::pClassPointer { L"Class SFXGameContent.SFXPawn_Trooper", &UObject::FindClass };
 
 class UClass* ASFXPawn_Trooper::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPawn_Trooper" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerCustomAction_CerberusGrenade::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_CerberusGrenade::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_CerberusGrenade", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_CerberusGrenade::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_CerberusGrenade" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerCustomAction_EnemyGrenade::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_EnemyGrenade::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_EnemyGrenade", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_EnemyGrenade::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_EnemyGrenade" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_EnemyGrenade.GetProjectileAttachPoint
@@ -12958,10 +11682,9 @@ class UClass* USFXPowerCustomAction_EnemyGrenade::StaticClass()
 
 bool USFXPowerCustomAction_EnemyGrenade::GetProjectileAttachPoint ( struct FVector* AttachPoint )
 {
-	static UFunction* pFnGetProjectileAttachPoint = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetProjectileAttachPointRef { L"Function SFXGameContent.SFXPowerCustomAction_EnemyGrenade.GetProjectileAttachPoint", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetProjectileAttachPoint )
-		pFnGetProjectileAttachPoint = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_EnemyGrenade.GetProjectileAttachPoint" );
+	UFunction* const pFnGetProjectileAttachPoint = pFnGetProjectileAttachPointRef.Get ( );
 
 	USFXPowerCustomAction_EnemyGrenade_execGetProjectileAttachPoint_Parms GetProjectileAttachPoint_Parms;
 
@@ -12978,50 +11701,38 @@ bool USFXPowerCustomAction_EnemyGrenade::GetProjectileAttachPoint ( struct FVect
 
 
 
-class UClass* ASFXProjectile_PowerCustomAction_CerberusFragGrenade::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_PowerCustomAction_CerberusFragGrenade::pClassPointer { L"Class SFXGameContent.SFXProjectile_PowerCustomAction_CerberusFragGrenade", &UObject::FindClass };
 
 class UClass* ASFXProjectile_PowerCustomAction_CerberusFragGrenade::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXProjectile_PowerCustomAction_CerberusFragGrenade" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXRumble_MeleeHit::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXRumble_MeleeHit::pClassPointer { L"Class SFXGameContent.SFXRumble_MeleeHit", &UObject::FindClass };
 
 class UClass* USFXRumble_MeleeHit::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXRumble_MeleeHit" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXShake_MeleeHit::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXShake_MeleeHit::pClassPointer { L"Class SFXGameContent.SFXShake_MeleeHit", &UObject::FindClass };
 
 class UClass* USFXShake_MeleeHit::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXShake_MeleeHit" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXWeapon_SMG_Hornet::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_SMG_Hornet::pClassPointer { L"Class SFXGameContent.SFXWeapon_SMG_Hornet", &UObject::FindClass };
 
 class UClass* ASFXWeapon_SMG_Hornet::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXWeapon_SMG_Hornet" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXWeapon_SMG_Hornet.GetWeaponSpecificImpactSound
@@ -13032,10 +11743,9 @@ class UClass* ASFXWeapon_SMG_Hornet::StaticClass()
 
 class UWwiseEvent* ASFXWeapon_SMG_Hornet::GetWeaponSpecificImpactSound ( class USFXPhysicalMaterialImpactSounds* ImpactSounds )
 {
-	static UFunction* pFnGetWeaponSpecificImpactSound = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponSpecificImpactSoundRef { L"Function SFXGameContent.SFXWeapon_SMG_Hornet.GetWeaponSpecificImpactSound", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponSpecificImpactSound )
-		pFnGetWeaponSpecificImpactSound = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXWeapon_SMG_Hornet.GetWeaponSpecificImpactSound" );
+	UFunction* const pFnGetWeaponSpecificImpactSound = pFnGetWeaponSpecificImpactSoundRef.Get ( );
 
 	ASFXWeapon_SMG_Hornet_execGetWeaponSpecificImpactSound_Parms GetWeaponSpecificImpactSound_Parms;
 	GetWeaponSpecificImpactSound_Parms.ImpactSounds = ImpactSounds;
@@ -13047,26 +11757,20 @@ class UWwiseEvent* ASFXWeapon_SMG_Hornet::GetWeaponSpecificImpactSound ( class U
 
 
 
-class UClass* ASFXWeapon_AI_Hornet::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_AI_Hornet::pClassPointer { L"Class SFXGameContent.SFXWeapon_AI_Hornet", &UObject::FindClass };
 
 class UClass* ASFXWeapon_AI_Hornet::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXWeapon_AI_Hornet" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_CustomLoopingInteraction::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_CustomLoopingInteraction::pClassPointer { L"Class SFXGameContent.SFXCustomAction_CustomLoopingInteraction", &UObject::FindClass };
 
 class UClass* USFXCustomAction_CustomLoopingInteraction::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_CustomLoopingInteraction" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_CustomLoopingInteraction.StartCustomAction
@@ -13075,10 +11779,9 @@ class UClass* USFXCustomAction_CustomLoopingInteraction::StaticClass()
 
 void USFXCustomAction_CustomLoopingInteraction::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_CustomLoopingInteraction.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_CustomLoopingInteraction.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_CustomLoopingInteraction_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -13087,26 +11790,20 @@ void USFXCustomAction_CustomLoopingInteraction::StartCustomAction ( )
 
 
 
-class UClass* ASFXNav_InteractionHenchCustom::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXNav_InteractionHenchCustom::pClassPointer { L"Class SFXGameContent.SFXNav_InteractionHenchCustom", &UObject::FindClass };
 
 class UClass* ASFXNav_InteractionHenchCustom::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXNav_InteractionHenchCustom" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_HenchBeckonFront::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HenchBeckonFront::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HenchBeckonFront", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HenchBeckonFront::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HenchBeckonFront" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_HenchBeckonFront.CanOverrideMoveWith
@@ -13118,10 +11815,9 @@ class UClass* USFXCustomAction_HenchBeckonFront::StaticClass()
 
 bool USFXCustomAction_HenchBeckonFront::CanOverrideMoveWith ( int OldCustomAction, int NewCustomAction )
 {
-	static UFunction* pFnCanOverrideMoveWith = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanOverrideMoveWithRef { L"Function SFXGameContent.SFXCustomAction_HenchBeckonFront.CanOverrideMoveWith", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanOverrideMoveWith )
-		pFnCanOverrideMoveWith = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchBeckonFront.CanOverrideMoveWith" );
+	UFunction* const pFnCanOverrideMoveWith = pFnCanOverrideMoveWithRef.Get ( );
 
 	USFXCustomAction_HenchBeckonFront_execCanOverrideMoveWith_Parms CanOverrideMoveWith_Parms;
 	CanOverrideMoveWith_Parms.OldCustomAction = OldCustomAction;
@@ -13134,14 +11830,11 @@ bool USFXCustomAction_HenchBeckonFront::CanOverrideMoveWith ( int OldCustomActio
 
 
 
-class UClass* USFXCustomAction_HenchBeckonRear::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HenchBeckonRear::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HenchBeckonRear", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HenchBeckonRear::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HenchBeckonRear" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_HenchBeckonRear.CanOverrideMoveWith
@@ -13153,10 +11846,9 @@ class UClass* USFXCustomAction_HenchBeckonRear::StaticClass()
 
 bool USFXCustomAction_HenchBeckonRear::CanOverrideMoveWith ( int OldCustomAction, int NewCustomAction )
 {
-	static UFunction* pFnCanOverrideMoveWith = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanOverrideMoveWithRef { L"Function SFXGameContent.SFXCustomAction_HenchBeckonRear.CanOverrideMoveWith", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanOverrideMoveWith )
-		pFnCanOverrideMoveWith = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchBeckonRear.CanOverrideMoveWith" );
+	UFunction* const pFnCanOverrideMoveWith = pFnCanOverrideMoveWithRef.Get ( );
 
 	USFXCustomAction_HenchBeckonRear_execCanOverrideMoveWith_Parms CanOverrideMoveWith_Parms;
 	CanOverrideMoveWith_Parms.OldCustomAction = OldCustomAction;
@@ -13169,14 +11861,11 @@ bool USFXCustomAction_HenchBeckonRear::CanOverrideMoveWith ( int OldCustomAction
 
 
 
-class UClass* USFXCustomAction_HenchCrouch::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HenchCrouch::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HenchCrouch", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HenchCrouch::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HenchCrouch" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_HenchCrouch.CanOverrideMoveWith
@@ -13188,10 +11877,9 @@ class UClass* USFXCustomAction_HenchCrouch::StaticClass()
 
 bool USFXCustomAction_HenchCrouch::CanOverrideMoveWith ( int OldCustomAction, int NewCustomAction )
 {
-	static UFunction* pFnCanOverrideMoveWith = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanOverrideMoveWithRef { L"Function SFXGameContent.SFXCustomAction_HenchCrouch.CanOverrideMoveWith", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanOverrideMoveWith )
-		pFnCanOverrideMoveWith = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchCrouch.CanOverrideMoveWith" );
+	UFunction* const pFnCanOverrideMoveWith = pFnCanOverrideMoveWithRef.Get ( );
 
 	USFXCustomAction_HenchCrouch_execCanOverrideMoveWith_Parms CanOverrideMoveWith_Parms;
 	CanOverrideMoveWith_Parms.OldCustomAction = OldCustomAction;
@@ -13208,10 +11896,9 @@ bool USFXCustomAction_HenchCrouch::CanOverrideMoveWith ( int OldCustomAction, in
 
 void USFXCustomAction_HenchCrouch::TriggerEnd ( )
 {
-	static UFunction* pFnTriggerEnd = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTriggerEndRef { L"Function SFXGameContent.SFXCustomAction_HenchCrouch.TriggerEnd", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTriggerEnd )
-		pFnTriggerEnd = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchCrouch.TriggerEnd" );
+	UFunction* const pFnTriggerEnd = pFnTriggerEndRef.Get ( );
 
 	USFXCustomAction_HenchCrouch_execTriggerEnd_Parms TriggerEnd_Parms;
 
@@ -13224,10 +11911,9 @@ void USFXCustomAction_HenchCrouch::TriggerEnd ( )
 
 void USFXCustomAction_HenchCrouch::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_HenchCrouch.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchCrouch.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_HenchCrouch_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -13236,14 +11922,11 @@ void USFXCustomAction_HenchCrouch::StartCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_HenchInteractLow::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HenchInteractLow::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HenchInteractLow", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HenchInteractLow::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HenchInteractLow" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_HenchInteractLow.CanOverrideMoveWith
@@ -13255,10 +11938,9 @@ class UClass* USFXCustomAction_HenchInteractLow::StaticClass()
 
 bool USFXCustomAction_HenchInteractLow::CanOverrideMoveWith ( int OldCustomAction, int NewCustomAction )
 {
-	static UFunction* pFnCanOverrideMoveWith = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanOverrideMoveWithRef { L"Function SFXGameContent.SFXCustomAction_HenchInteractLow.CanOverrideMoveWith", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanOverrideMoveWith )
-		pFnCanOverrideMoveWith = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchInteractLow.CanOverrideMoveWith" );
+	UFunction* const pFnCanOverrideMoveWith = pFnCanOverrideMoveWithRef.Get ( );
 
 	USFXCustomAction_HenchInteractLow_execCanOverrideMoveWith_Parms CanOverrideMoveWith_Parms;
 	CanOverrideMoveWith_Parms.OldCustomAction = OldCustomAction;
@@ -13275,10 +11957,9 @@ bool USFXCustomAction_HenchInteractLow::CanOverrideMoveWith ( int OldCustomActio
 
 void USFXCustomAction_HenchInteractLow::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_HenchInteractLow.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchInteractLow.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_HenchInteractLow_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -13291,10 +11972,9 @@ void USFXCustomAction_HenchInteractLow::StopCustomAction ( )
 
 void USFXCustomAction_HenchInteractLow::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_HenchInteractLow.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchInteractLow.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_HenchInteractLow_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -13303,14 +11983,11 @@ void USFXCustomAction_HenchInteractLow::StartCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_HenchmanMelee::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HenchmanMelee::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HenchmanMelee", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HenchmanMelee::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HenchmanMelee" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_HenchmanMelee.TryNextMelee
@@ -13319,10 +11996,9 @@ class UClass* USFXCustomAction_HenchmanMelee::StaticClass()
 
 void USFXCustomAction_HenchmanMelee::TryNextMelee ( )
 {
-	static UFunction* pFnTryNextMelee = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTryNextMeleeRef { L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.TryNextMelee", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTryNextMelee )
-		pFnTryNextMelee = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.TryNextMelee" );
+	UFunction* const pFnTryNextMelee = pFnTryNextMeleeRef.Get ( );
 
 	USFXCustomAction_HenchmanMelee_execTryNextMelee_Parms TryNextMelee_Parms;
 
@@ -13336,10 +12012,9 @@ void USFXCustomAction_HenchmanMelee::TryNextMelee ( )
 
 bool USFXCustomAction_HenchmanMelee::CanContinueMelee ( )
 {
-	static UFunction* pFnCanContinueMelee = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanContinueMeleeRef { L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.CanContinueMelee", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanContinueMelee )
-		pFnCanContinueMelee = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.CanContinueMelee" );
+	UFunction* const pFnCanContinueMelee = pFnCanContinueMeleeRef.Get ( );
 
 	USFXCustomAction_HenchmanMelee_execCanContinueMelee_Parms CanContinueMelee_Parms;
 
@@ -13357,10 +12032,9 @@ bool USFXCustomAction_HenchmanMelee::CanContinueMelee ( )
 
 void USFXCustomAction_HenchmanMelee::BodyStanceAnimEndNotification ( class UAnimNodeSequence* SeqNode, float PlayedTime, float ExcessTime )
 {
-	static UFunction* pFnBodyStanceAnimEndNotification = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnBodyStanceAnimEndNotificationRef { L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.BodyStanceAnimEndNotification", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnBodyStanceAnimEndNotification )
-		pFnBodyStanceAnimEndNotification = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.BodyStanceAnimEndNotification" );
+	UFunction* const pFnBodyStanceAnimEndNotification = pFnBodyStanceAnimEndNotificationRef.Get ( );
 
 	USFXCustomAction_HenchmanMelee_execBodyStanceAnimEndNotification_Parms BodyStanceAnimEndNotification_Parms;
 	BodyStanceAnimEndNotification_Parms.SeqNode = SeqNode;
@@ -13376,10 +12050,9 @@ void USFXCustomAction_HenchmanMelee::BodyStanceAnimEndNotification ( class UAnim
 
 void USFXCustomAction_HenchmanMelee::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_HenchmanMelee_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -13392,10 +12065,9 @@ void USFXCustomAction_HenchmanMelee::StopCustomAction ( )
 
 void USFXCustomAction_HenchmanMelee::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_HenchmanMelee_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -13410,10 +12082,9 @@ void USFXCustomAction_HenchmanMelee::StartCustomAction ( )
 
 struct FBodyStance USFXCustomAction_HenchmanMelee::GetBodyStanceAnim ( unsigned char Stage )
 {
-	static UFunction* pFnGetBodyStanceAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetBodyStanceAnimRef { L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.GetBodyStanceAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetBodyStanceAnim )
-		pFnGetBodyStanceAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.GetBodyStanceAnim" );
+	UFunction* const pFnGetBodyStanceAnim = pFnGetBodyStanceAnimRef.Get ( );
 
 	USFXCustomAction_HenchmanMelee_execGetBodyStanceAnim_Parms GetBodyStanceAnim_Parms;
 	GetBodyStanceAnim_Parms.Stage = Stage;
@@ -13430,10 +12101,9 @@ struct FBodyStance USFXCustomAction_HenchmanMelee::GetBodyStanceAnim ( unsigned
 
 bool USFXCustomAction_HenchmanMelee::ShouldUsePistolAnim ( )
 {
-	static UFunction* pFnShouldUsePistolAnim = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePistolAnimRef { L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.ShouldUsePistolAnim", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePistolAnim )
-		pFnShouldUsePistolAnim = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.ShouldUsePistolAnim" );
+	UFunction* const pFnShouldUsePistolAnim = pFnShouldUsePistolAnimRef.Get ( );
 
 	USFXCustomAction_HenchmanMelee_execShouldUsePistolAnim_Parms ShouldUsePistolAnim_Parms;
 
@@ -13449,10 +12119,9 @@ bool USFXCustomAction_HenchmanMelee::ShouldUsePistolAnim ( )
 
 void USFXCustomAction_HenchmanMelee::eventGetUsedAnimNames ( TArray<struct SFXName>* UsedAnims )
 {
-	static UFunction* pFnGetUsedAnimNames = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetUsedAnimNamesRef { L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.GetUsedAnimNames", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetUsedAnimNames )
-		pFnGetUsedAnimNames = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.GetUsedAnimNames" );
+	UFunction* const pFnGetUsedAnimNames = pFnGetUsedAnimNamesRef.Get ( );
 
 	USFXCustomAction_HenchmanMelee_eventGetUsedAnimNames_Parms GetUsedAnimNames_Parms;
 
@@ -13467,14 +12136,11 @@ void USFXCustomAction_HenchmanMelee::eventGetUsedAnimNames ( TArray<struct SFXNa
 
 
 
-class UClass* USFXCustomAction_HenchOmniTool::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HenchOmniTool::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HenchOmniTool", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HenchOmniTool::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HenchOmniTool" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_HenchOmniTool.CanOverrideMoveWith
@@ -13486,10 +12152,9 @@ class UClass* USFXCustomAction_HenchOmniTool::StaticClass()
 
 bool USFXCustomAction_HenchOmniTool::CanOverrideMoveWith ( int OldCustomAction, int NewCustomAction )
 {
-	static UFunction* pFnCanOverrideMoveWith = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanOverrideMoveWithRef { L"Function SFXGameContent.SFXCustomAction_HenchOmniTool.CanOverrideMoveWith", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanOverrideMoveWith )
-		pFnCanOverrideMoveWith = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchOmniTool.CanOverrideMoveWith" );
+	UFunction* const pFnCanOverrideMoveWith = pFnCanOverrideMoveWithRef.Get ( );
 
 	USFXCustomAction_HenchOmniTool_execCanOverrideMoveWith_Parms CanOverrideMoveWith_Parms;
 	CanOverrideMoveWith_Parms.OldCustomAction = OldCustomAction;
@@ -13506,10 +12171,9 @@ bool USFXCustomAction_HenchOmniTool::CanOverrideMoveWith ( int OldCustomAction,
 
 void USFXCustomAction_HenchOmniTool::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_HenchOmniTool.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchOmniTool.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_HenchOmniTool_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -13522,10 +12186,9 @@ void USFXCustomAction_HenchOmniTool::StopCustomAction ( )
 
 void USFXCustomAction_HenchOmniTool::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_HenchOmniTool.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchOmniTool.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_HenchOmniTool_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -13534,14 +12197,11 @@ void USFXCustomAction_HenchOmniTool::StartCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_HenchOmniToolCrouch::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HenchOmniToolCrouch::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HenchOmniToolCrouch", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HenchOmniToolCrouch::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HenchOmniToolCrouch" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_HenchOmniToolCrouch.CanOverrideMoveWith
@@ -13553,10 +12213,9 @@ class UClass* USFXCustomAction_HenchOmniToolCrouch::StaticClass()
 
 bool USFXCustomAction_HenchOmniToolCrouch::CanOverrideMoveWith ( int OldCustomAction, int NewCustomAction )
 {
-	static UFunction* pFnCanOverrideMoveWith = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanOverrideMoveWithRef { L"Function SFXGameContent.SFXCustomAction_HenchOmniToolCrouch.CanOverrideMoveWith", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanOverrideMoveWith )
-		pFnCanOverrideMoveWith = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchOmniToolCrouch.CanOverrideMoveWith" );
+	UFunction* const pFnCanOverrideMoveWith = pFnCanOverrideMoveWithRef.Get ( );
 
 	USFXCustomAction_HenchOmniToolCrouch_execCanOverrideMoveWith_Parms CanOverrideMoveWith_Parms;
 	CanOverrideMoveWith_Parms.OldCustomAction = OldCustomAction;
@@ -13573,10 +12232,9 @@ bool USFXCustomAction_HenchOmniToolCrouch::CanOverrideMoveWith ( int OldCustomAc
 
 void USFXCustomAction_HenchOmniToolCrouch::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_HenchOmniToolCrouch.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchOmniToolCrouch.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_HenchOmniToolCrouch_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -13589,10 +12247,9 @@ void USFXCustomAction_HenchOmniToolCrouch::StopCustomAction ( )
 
 void USFXCustomAction_HenchOmniToolCrouch::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXCustomAction_HenchOmniToolCrouch.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchOmniToolCrouch.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXCustomAction_HenchOmniToolCrouch_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -13601,14 +12258,11 @@ void USFXCustomAction_HenchOmniToolCrouch::StartCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_HenchRollBackward::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HenchRollBackward::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HenchRollBackward", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HenchRollBackward::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HenchRollBackward" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_HenchRollBackward.StopCustomAction
@@ -13617,10 +12271,9 @@ class UClass* USFXCustomAction_HenchRollBackward::StaticClass()
 
 void USFXCustomAction_HenchRollBackward::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_HenchRollBackward.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchRollBackward.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_HenchRollBackward_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -13629,14 +12282,11 @@ void USFXCustomAction_HenchRollBackward::StopCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_HenchRollForward::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HenchRollForward::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HenchRollForward", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HenchRollForward::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HenchRollForward" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_HenchRollForward.StopCustomAction
@@ -13645,10 +12295,9 @@ class UClass* USFXCustomAction_HenchRollForward::StaticClass()
 
 void USFXCustomAction_HenchRollForward::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_HenchRollForward.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchRollForward.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_HenchRollForward_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -13657,14 +12306,11 @@ void USFXCustomAction_HenchRollForward::StopCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_HenchRollLeft::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HenchRollLeft::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HenchRollLeft", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HenchRollLeft::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HenchRollLeft" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_HenchRollLeft.StopCustomAction
@@ -13673,10 +12319,9 @@ class UClass* USFXCustomAction_HenchRollLeft::StaticClass()
 
 void USFXCustomAction_HenchRollLeft::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_HenchRollLeft.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchRollLeft.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_HenchRollLeft_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -13685,14 +12330,11 @@ void USFXCustomAction_HenchRollLeft::StopCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_HenchRollRight::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HenchRollRight::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HenchRollRight", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HenchRollRight::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HenchRollRight" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_HenchRollRight.StopCustomAction
@@ -13701,10 +12343,9 @@ class UClass* USFXCustomAction_HenchRollRight::StaticClass()
 
 void USFXCustomAction_HenchRollRight::StopCustomAction ( )
 {
-	static UFunction* pFnStopCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopCustomActionRef { L"Function SFXGameContent.SFXCustomAction_HenchRollRight.StopCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopCustomAction )
-		pFnStopCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchRollRight.StopCustomAction" );
+	UFunction* const pFnStopCustomAction = pFnStopCustomActionRef.Get ( );
 
 	USFXCustomAction_HenchRollRight_execStopCustomAction_Parms StopCustomAction_Parms;
 
@@ -13713,14 +12354,11 @@ void USFXCustomAction_HenchRollRight::StopCustomAction ( )
 
 
 
-class UClass* USFXCustomAction_HenchStandIdle::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HenchStandIdle::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HenchStandIdle", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HenchStandIdle::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HenchStandIdle" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_HenchStandIdle.CanOverrideMoveWith
@@ -13732,10 +12370,9 @@ class UClass* USFXCustomAction_HenchStandIdle::StaticClass()
 
 bool USFXCustomAction_HenchStandIdle::CanOverrideMoveWith ( int OldCustomAction, int NewCustomAction )
 {
-	static UFunction* pFnCanOverrideMoveWith = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanOverrideMoveWithRef { L"Function SFXGameContent.SFXCustomAction_HenchStandIdle.CanOverrideMoveWith", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanOverrideMoveWith )
-		pFnCanOverrideMoveWith = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchStandIdle.CanOverrideMoveWith" );
+	UFunction* const pFnCanOverrideMoveWith = pFnCanOverrideMoveWithRef.Get ( );
 
 	USFXCustomAction_HenchStandIdle_execCanOverrideMoveWith_Parms CanOverrideMoveWith_Parms;
 	CanOverrideMoveWith_Parms.OldCustomAction = OldCustomAction;
@@ -13752,10 +12389,9 @@ bool USFXCustomAction_HenchStandIdle::CanOverrideMoveWith ( int OldCustomAction,
 
 void USFXCustomAction_HenchStandIdle::TriggerEnd ( )
 {
-	static UFunction* pFnTriggerEnd = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTriggerEndRef { L"Function SFXGameContent.SFXCustomAction_HenchStandIdle.TriggerEnd", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTriggerEnd )
-		pFnTriggerEnd = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchStandIdle.TriggerEnd" );
+	UFunction* const pFnTriggerEnd = pFnTriggerEndRef.Get ( );
 
 	USFXCustomAction_HenchStandIdle_execTriggerEnd_Parms TriggerEnd_Parms;
 
@@ -13764,14 +12400,11 @@ void USFXCustomAction_HenchStandIdle::TriggerEnd ( )
 
 
 
-class UClass* USFXCustomAction_HenchStandTyping::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HenchStandTyping::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HenchStandTyping", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HenchStandTyping::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HenchStandTyping" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXCustomAction_HenchStandTyping.CanOverrideMoveWith
@@ -13783,10 +12416,9 @@ class UClass* USFXCustomAction_HenchStandTyping::StaticClass()
 
 bool USFXCustomAction_HenchStandTyping::CanOverrideMoveWith ( int OldCustomAction, int NewCustomAction )
 {
-	static UFunction* pFnCanOverrideMoveWith = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanOverrideMoveWithRef { L"Function SFXGameContent.SFXCustomAction_HenchStandTyping.CanOverrideMoveWith", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanOverrideMoveWith )
-		pFnCanOverrideMoveWith = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXCustomAction_HenchStandTyping.CanOverrideMoveWith" );
+	UFunction* const pFnCanOverrideMoveWith = pFnCanOverrideMoveWithRef.Get ( );
 
 	USFXCustomAction_HenchStandTyping_execCanOverrideMoveWith_Parms CanOverrideMoveWith_Parms;
 	CanOverrideMoveWith_Parms.OldCustomAction = OldCustomAction;
@@ -13799,134 +12431,101 @@ bool USFXCustomAction_HenchStandTyping::CanOverrideMoveWith ( int OldCustomActio
 
 
 
-class UClass* USFXDamageType_BarrierBlast::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_BarrierBlast::pClassPointer { L"Class SFXGameContent.SFXDamageType_BarrierBlast", &UObject::FindClass };
 
 class UClass* USFXDamageType_BarrierBlast::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_BarrierBlast" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_BarrierBlast_NoRagdoll::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_BarrierBlast_NoRagdoll::pClassPointer { L"Class SFXGameContent.SFXDamageType_BarrierBlast_NoRagdoll", &UObject::FindClass };
 
 class UClass* USFXDamageType_BarrierBlast_NoRagdoll::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_BarrierBlast_NoRagdoll" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_CryoFreeze::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_CryoFreeze::pClassPointer { L"Class SFXGameContent.SFXDamageType_CryoFreeze", &UObject::FindClass };
 
 class UClass* USFXDamageType_CryoFreeze::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_CryoFreeze" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_OverloadRobot::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_OverloadRobot::pClassPointer { L"Class SFXGameContent.SFXDamageType_OverloadRobot", &UObject::FindClass };
 
 class UClass* USFXDamageType_OverloadRobot::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_OverloadRobot" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Overload::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Overload::pClassPointer { L"Class SFXGameContent.SFXDamageType_Overload", &UObject::FindClass };
 
 class UClass* USFXDamageType_Overload::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Overload" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_ImprovedOverload::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_ImprovedOverload::pClassPointer { L"Class SFXGameContent.SFXDamageType_ImprovedOverload", &UObject::FindClass };
 
 class UClass* USFXDamageType_ImprovedOverload::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_ImprovedOverload" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_ImprovedOverloadRobot::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_ImprovedOverloadRobot::pClassPointer { L"Class SFXGameContent.SFXDamageType_ImprovedOverloadRobot", &UObject::FindClass };
 
 class UClass* USFXDamageType_ImprovedOverloadRobot::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_ImprovedOverloadRobot" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Overload_Ragdoll::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Overload_Ragdoll::pClassPointer { L"Class SFXGameContent.SFXDamageType_Overload_Ragdoll", &UObject::FindClass };
 
 class UClass* USFXDamageType_Overload_Ragdoll::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Overload_Ragdoll" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Reave::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Reave::pClassPointer { L"Class SFXGameContent.SFXDamageType_Reave", &UObject::FindClass };
 
 class UClass* USFXDamageType_Reave::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Reave" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Reave_Improved::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Reave_Improved::pClassPointer { L"Class SFXGameContent.SFXDamageType_Reave_Improved", &UObject::FindClass };
 
 class UClass* USFXDamageType_Reave_Improved::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Reave_Improved" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_BarrierLift::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_BarrierLift::pClassPointer { L"Class SFXGameContent.SFXGameEffect_BarrierLift", &UObject::FindClass };
 
 class UClass* USFXGameEffect_BarrierLift::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_BarrierLift" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_BarrierLift.OnRemoved
@@ -13935,10 +12534,9 @@ class UClass* USFXGameEffect_BarrierLift::StaticClass()
 
 void USFXGameEffect_BarrierLift::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_BarrierLift.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_BarrierLift.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_BarrierLift_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -13951,10 +12549,9 @@ void USFXGameEffect_BarrierLift::OnRemoved ( )
 
 void USFXGameEffect_BarrierLift::UpdateRagdoll ( )
 {
-	static UFunction* pFnUpdateRagdoll = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdateRagdollRef { L"Function SFXGameContent.SFXGameEffect_BarrierLift.UpdateRagdoll", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdateRagdoll )
-		pFnUpdateRagdoll = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_BarrierLift.UpdateRagdoll" );
+	UFunction* const pFnUpdateRagdoll = pFnUpdateRagdollRef.Get ( );
 
 	USFXGameEffect_BarrierLift_execUpdateRagdoll_Parms UpdateRagdoll_Parms;
 
@@ -13967,10 +12564,9 @@ void USFXGameEffect_BarrierLift::UpdateRagdoll ( )
 
 void USFXGameEffect_BarrierLift::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_BarrierLift.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_BarrierLift.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_BarrierLift_execOnApplied_Parms OnApplied_Parms;
 
@@ -13979,14 +12575,11 @@ void USFXGameEffect_BarrierLift::OnApplied ( )
 
 
 
-class UClass* USFXGameEffect_DefensiveArmor::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_DefensiveArmor::pClassPointer { L"Class SFXGameContent.SFXGameEffect_DefensiveArmor", &UObject::FindClass };
 
 class UClass* USFXGameEffect_DefensiveArmor::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_DefensiveArmor" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_DefensiveArmor.OnRemoved
@@ -13995,10 +12588,9 @@ class UClass* USFXGameEffect_DefensiveArmor::StaticClass()
 
 void USFXGameEffect_DefensiveArmor::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_DefensiveArmor.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_DefensiveArmor.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_DefensiveArmor_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -14011,10 +12603,9 @@ void USFXGameEffect_DefensiveArmor::OnRemoved ( )
 
 void USFXGameEffect_DefensiveArmor::TurnVFXOff ( )
 {
-	static UFunction* pFnTurnVFXOff = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTurnVFXOffRef { L"Function SFXGameContent.SFXGameEffect_DefensiveArmor.TurnVFXOff", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTurnVFXOff )
-		pFnTurnVFXOff = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_DefensiveArmor.TurnVFXOff" );
+	UFunction* const pFnTurnVFXOff = pFnTurnVFXOffRef.Get ( );
 
 	USFXGameEffect_DefensiveArmor_execTurnVFXOff_Parms TurnVFXOff_Parms;
 
@@ -14027,10 +12618,9 @@ void USFXGameEffect_DefensiveArmor::TurnVFXOff ( )
 
 void USFXGameEffect_DefensiveArmor::TurnVFXOn ( )
 {
-	static UFunction* pFnTurnVFXOn = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTurnVFXOnRef { L"Function SFXGameContent.SFXGameEffect_DefensiveArmor.TurnVFXOn", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTurnVFXOn )
-		pFnTurnVFXOn = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_DefensiveArmor.TurnVFXOn" );
+	UFunction* const pFnTurnVFXOn = pFnTurnVFXOnRef.Get ( );
 
 	USFXGameEffect_DefensiveArmor_execTurnVFXOn_Parms TurnVFXOn_Parms;
 
@@ -14044,10 +12634,9 @@ void USFXGameEffect_DefensiveArmor::TurnVFXOn ( )
 
 void USFXGameEffect_DefensiveArmor::OnUpdate ( float DeltaSeconds )
 {
-	static UFunction* pFnOnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUpdateRef { L"Function SFXGameContent.SFXGameEffect_DefensiveArmor.OnUpdate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUpdate )
-		pFnOnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_DefensiveArmor.OnUpdate" );
+	UFunction* const pFnOnUpdate = pFnOnUpdateRef.Get ( );
 
 	USFXGameEffect_DefensiveArmor_execOnUpdate_Parms OnUpdate_Parms;
 	OnUpdate_Parms.DeltaSeconds = DeltaSeconds;
@@ -14061,10 +12650,9 @@ void USFXGameEffect_DefensiveArmor::OnUpdate ( float DeltaSeconds )
 
 void USFXGameEffect_DefensiveArmor::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_DefensiveArmor.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_DefensiveArmor.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_DefensiveArmor_execOnApplied_Parms OnApplied_Parms;
 
@@ -14073,14 +12661,11 @@ void USFXGameEffect_DefensiveArmor::OnApplied ( )
 
 
 
-class UClass* USFXPowerCustomAction_DefensiveShield::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_DefensiveShield::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_DefensiveShield", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_DefensiveShield::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_DefensiveShield" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.RestoreSaveState
@@ -14089,10 +12674,9 @@ class UClass* USFXPowerCustomAction_DefensiveShield::StaticClass()
 
 void USFXPowerCustomAction_DefensiveShield::RestoreSaveState ( )
 {
-	static UFunction* pFnRestoreSaveState = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRestoreSaveStateRef { L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.RestoreSaveState", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRestoreSaveState )
-		pFnRestoreSaveState = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.RestoreSaveState" );
+	UFunction* const pFnRestoreSaveState = pFnRestoreSaveStateRef.Get ( );
 
 	USFXPowerCustomAction_DefensiveShield_execRestoreSaveState_Parms RestoreSaveState_Parms;
 
@@ -14108,10 +12692,9 @@ void USFXPowerCustomAction_DefensiveShield::RestoreSaveState ( )
 
 bool USFXPowerCustomAction_DefensiveShield::eventShouldUsePower ( class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_DefensiveShield_eventShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Target = Target;
@@ -14133,10 +12716,9 @@ bool USFXPowerCustomAction_DefensiveShield::eventShouldUsePower ( class AActor*
 
 void USFXPowerCustomAction_DefensiveShield::DoJoinInProgress ( )
 {
-	static UFunction* pFnDoJoinInProgress = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoJoinInProgressRef { L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.DoJoinInProgress", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoJoinInProgress )
-		pFnDoJoinInProgress = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.DoJoinInProgress" );
+	UFunction* const pFnDoJoinInProgress = pFnDoJoinInProgressRef.Get ( );
 
 	USFXPowerCustomAction_DefensiveShield_execDoJoinInProgress_Parms DoJoinInProgress_Parms;
 
@@ -14151,10 +12733,9 @@ void USFXPowerCustomAction_DefensiveShield::DoJoinInProgress ( )
 
 bool USFXPowerCustomAction_DefensiveShield::CanUsePower ( class AActor* Target )
 {
-	static UFunction* pFnCanUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.CanUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanUsePower )
-		pFnCanUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.CanUsePower" );
+	UFunction* const pFnCanUsePower = pFnCanUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_DefensiveShield_execCanUsePower_Parms CanUsePower_Parms;
 	CanUsePower_Parms.Target = Target;
@@ -14171,10 +12752,9 @@ bool USFXPowerCustomAction_DefensiveShield::CanUsePower ( class AActor* Target )
 
 void USFXPowerCustomAction_DefensiveShield::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_DefensiveShield_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -14188,10 +12768,9 @@ void USFXPowerCustomAction_DefensiveShield::RecalculateAllPowerData ( unsigned l
 
 void USFXPowerCustomAction_DefensiveShield::ResetPower ( )
 {
-	static UFunction* pFnResetPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResetPowerRef { L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.ResetPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResetPower )
-		pFnResetPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.ResetPower" );
+	UFunction* const pFnResetPower = pFnResetPowerRef.Get ( );
 
 	USFXPowerCustomAction_DefensiveShield_execResetPower_Parms ResetPower_Parms;
 
@@ -14210,10 +12789,9 @@ void USFXPowerCustomAction_DefensiveShield::ResetPower ( )
 
 void USFXPowerCustomAction_DefensiveShield::ClientDoPowerSubsequentImpact ( class AActor* oActor, int CustomActionReactionType, float Duration, int ImpactCount, float Delay, unsigned long DoCallback )
 {
-	static UFunction* pFnClientDoPowerSubsequentImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoPowerSubsequentImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.ClientDoPowerSubsequentImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoPowerSubsequentImpact )
-		pFnClientDoPowerSubsequentImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.ClientDoPowerSubsequentImpact" );
+	UFunction* const pFnClientDoPowerSubsequentImpact = pFnClientDoPowerSubsequentImpactRef.Get ( );
 
 	USFXPowerCustomAction_DefensiveShield_execClientDoPowerSubsequentImpact_Parms ClientDoPowerSubsequentImpact_Parms;
 	ClientDoPowerSubsequentImpact_Parms.oActor = oActor;
@@ -14232,10 +12810,9 @@ void USFXPowerCustomAction_DefensiveShield::ClientDoPowerSubsequentImpact ( clas
 
 void USFXPowerCustomAction_DefensiveShield::TryApplyArmor ( )
 {
-	static UFunction* pFnTryApplyArmor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTryApplyArmorRef { L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.TryApplyArmor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTryApplyArmor )
-		pFnTryApplyArmor = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.TryApplyArmor" );
+	UFunction* const pFnTryApplyArmor = pFnTryApplyArmorRef.Get ( );
 
 	USFXPowerCustomAction_DefensiveShield_execTryApplyArmor_Parms TryApplyArmor_Parms;
 
@@ -14249,10 +12826,9 @@ void USFXPowerCustomAction_DefensiveShield::TryApplyArmor ( )
 
 void USFXPowerCustomAction_DefensiveShield::SetupEffect ( class USFXGameEffect_DefensiveArmor* Effect )
 {
-	static UFunction* pFnSetupEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetupEffectRef { L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.SetupEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetupEffect )
-		pFnSetupEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.SetupEffect" );
+	UFunction* const pFnSetupEffect = pFnSetupEffectRef.Get ( );
 
 	USFXPowerCustomAction_DefensiveShield_execSetupEffect_Parms SetupEffect_Parms;
 	SetupEffect_Parms.Effect = Effect;
@@ -14266,10 +12842,9 @@ void USFXPowerCustomAction_DefensiveShield::SetupEffect ( class USFXGameEffect_D
 
 void USFXPowerCustomAction_DefensiveShield::ApplyArmor ( )
 {
-	static UFunction* pFnApplyArmor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyArmorRef { L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.ApplyArmor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyArmor )
-		pFnApplyArmor = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.ApplyArmor" );
+	UFunction* const pFnApplyArmor = pFnApplyArmorRef.Get ( );
 
 	USFXPowerCustomAction_DefensiveShield_execApplyArmor_Parms ApplyArmor_Parms;
 
@@ -14282,10 +12857,9 @@ void USFXPowerCustomAction_DefensiveShield::ApplyArmor ( )
 
 void USFXPowerCustomAction_DefensiveShield::RemoveArmor ( )
 {
-	static UFunction* pFnRemoveArmor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRemoveArmorRef { L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.RemoveArmor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRemoveArmor )
-		pFnRemoveArmor = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.RemoveArmor" );
+	UFunction* const pFnRemoveArmor = pFnRemoveArmorRef.Get ( );
 
 	USFXPowerCustomAction_DefensiveShield_execRemoveArmor_Parms RemoveArmor_Parms;
 
@@ -14304,10 +12878,9 @@ void USFXPowerCustomAction_DefensiveShield::RemoveArmor ( )
 
 bool USFXPowerCustomAction_DefensiveShield::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerCustomAction_DefensiveShield_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -14323,38 +12896,29 @@ bool USFXPowerCustomAction_DefensiveShield::OnImpact ( unsigned char Resistance,
 
 
 
-class UClass* USFXGameEffect_HenchmanArmorBonus_PowerCooldownBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_HenchmanArmorBonus_PowerCooldownBonus::pClassPointer { L"Class SFXGameContent.SFXGameEffect_HenchmanArmorBonus_PowerCooldownBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_HenchmanArmorBonus_PowerCooldownBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_HenchmanArmorBonus_PowerCooldownBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_HenchmanArmorBonus_PowerDamageBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_HenchmanArmorBonus_PowerDamageBonus::pClassPointer { L"Class SFXGameContent.SFXGameEffect_HenchmanArmorBonus_PowerDamageBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_HenchmanArmorBonus_PowerDamageBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_HenchmanArmorBonus_PowerDamageBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_OverloadChain::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_OverloadChain::pClassPointer { L"Class SFXGameContent.SFXGameEffect_OverloadChain", &UObject::FindClass };
 
 class UClass* USFXGameEffect_OverloadChain::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_OverloadChain" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_OverloadChain.OnRemoved
@@ -14363,10 +12927,9 @@ class UClass* USFXGameEffect_OverloadChain::StaticClass()
 
 void USFXGameEffect_OverloadChain::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_OverloadChain.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_OverloadChain.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_OverloadChain_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -14381,10 +12944,9 @@ void USFXGameEffect_OverloadChain::OnRemoved ( )
 
 bool USFXGameEffect_OverloadChain::ImpactAdditionalTarget ( class AActor* oActor )
 {
-	static UFunction* pFnImpactAdditionalTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnImpactAdditionalTargetRef { L"Function SFXGameContent.SFXGameEffect_OverloadChain.ImpactAdditionalTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnImpactAdditionalTarget )
-		pFnImpactAdditionalTarget = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_OverloadChain.ImpactAdditionalTarget" );
+	UFunction* const pFnImpactAdditionalTarget = pFnImpactAdditionalTargetRef.Get ( );
 
 	USFXGameEffect_OverloadChain_execImpactAdditionalTarget_Parms ImpactAdditionalTarget_Parms;
 	ImpactAdditionalTarget_Parms.oActor = oActor;
@@ -14400,10 +12962,9 @@ bool USFXGameEffect_OverloadChain::ImpactAdditionalTarget ( class AActor* oActor
 
 void USFXGameEffect_OverloadChain::SelectAndImpactNextTarget ( )
 {
-	static UFunction* pFnSelectAndImpactNextTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSelectAndImpactNextTargetRef { L"Function SFXGameContent.SFXGameEffect_OverloadChain.SelectAndImpactNextTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSelectAndImpactNextTarget )
-		pFnSelectAndImpactNextTarget = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_OverloadChain.SelectAndImpactNextTarget" );
+	UFunction* const pFnSelectAndImpactNextTarget = pFnSelectAndImpactNextTargetRef.Get ( );
 
 	USFXGameEffect_OverloadChain_execSelectAndImpactNextTarget_Parms SelectAndImpactNextTarget_Parms;
 
@@ -14417,10 +12978,9 @@ void USFXGameEffect_OverloadChain::SelectAndImpactNextTarget ( )
 
 void USFXGameEffect_OverloadChain::OnUpdate ( float DeltaSeconds )
 {
-	static UFunction* pFnOnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUpdateRef { L"Function SFXGameContent.SFXGameEffect_OverloadChain.OnUpdate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUpdate )
-		pFnOnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_OverloadChain.OnUpdate" );
+	UFunction* const pFnOnUpdate = pFnOnUpdateRef.Get ( );
 
 	USFXGameEffect_OverloadChain_execOnUpdate_Parms OnUpdate_Parms;
 	OnUpdate_Parms.DeltaSeconds = DeltaSeconds;
@@ -14436,10 +12996,9 @@ void USFXGameEffect_OverloadChain::OnUpdate ( float DeltaSeconds )
 
 void USFXGameEffect_OverloadChain::PlayBeamEffect ( class UParticleSystemComponent* PS, struct FVector const& TargetLocation )
 {
-	static UFunction* pFnPlayBeamEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayBeamEffectRef { L"Function SFXGameContent.SFXGameEffect_OverloadChain.PlayBeamEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayBeamEffect )
-		pFnPlayBeamEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_OverloadChain.PlayBeamEffect" );
+	UFunction* const pFnPlayBeamEffect = pFnPlayBeamEffectRef.Get ( );
 
 	USFXGameEffect_OverloadChain_execPlayBeamEffect_Parms PlayBeamEffect_Parms;
 	PlayBeamEffect_Parms.PS = PS;
@@ -14454,10 +13013,9 @@ void USFXGameEffect_OverloadChain::PlayBeamEffect ( class UParticleSystemCompone
 
 void USFXGameEffect_OverloadChain::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_OverloadChain.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_OverloadChain.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_OverloadChain_execOnApplied_Parms OnApplied_Parms;
 
@@ -14466,14 +13024,11 @@ void USFXGameEffect_OverloadChain::OnApplied ( )
 
 
 
-class UClass* USFXPowerCustomAction_Overload::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_Overload::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_Overload", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_Overload::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_Overload" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_Overload.PopulatePowerStatBarEvolves
@@ -14482,10 +13037,9 @@ class UClass* USFXPowerCustomAction_Overload::StaticClass()
 
 void USFXPowerCustomAction_Overload::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_Overload.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Overload.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_Overload_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -14501,10 +13055,9 @@ void USFXPowerCustomAction_Overload::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_Overload::ApplyBonus ( struct SFXName Parameter, class USFXGameEffect* Bonus, unsigned long bRemove )
 {
-	static UFunction* pFnApplyBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_Overload.ApplyBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyBonus )
-		pFnApplyBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Overload.ApplyBonus" );
+	UFunction* const pFnApplyBonus = pFnApplyBonusRef.Get ( );
 
 	USFXPowerCustomAction_Overload_execApplyBonus_Parms ApplyBonus_Parms;
 	memcpy ( &ApplyBonus_Parms.Parameter, &Parameter, 0x8 );
@@ -14521,10 +13074,9 @@ void USFXPowerCustomAction_Overload::ApplyBonus ( struct SFXName Parameter, clas
 
 void USFXPowerCustomAction_Overload::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_Overload.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Overload.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_Overload_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -14539,10 +13091,9 @@ void USFXPowerCustomAction_Overload::RecalculateAllPowerData ( unsigned long bRe
 
 void USFXPowerCustomAction_Overload::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Overload.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Overload.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_Overload_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -14559,10 +13110,9 @@ void USFXPowerCustomAction_Overload::EvolvePower ( unsigned char choice )
 
 bool USFXPowerCustomAction_Overload::ShouldUsePower ( class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Overload.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Overload.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_Overload_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Target = Target;
@@ -14590,10 +13140,9 @@ bool USFXPowerCustomAction_Overload::ShouldUsePower ( class AActor* Target, FStr
 
 void USFXPowerCustomAction_Overload::ClientDoPowerSubsequentImpact ( class AActor* oActor, int CustomActionReactionType, float Duration, int ImpactCount, float Delay, unsigned long DoCallback )
 {
-	static UFunction* pFnClientDoPowerSubsequentImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoPowerSubsequentImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Overload.ClientDoPowerSubsequentImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoPowerSubsequentImpact )
-		pFnClientDoPowerSubsequentImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Overload.ClientDoPowerSubsequentImpact" );
+	UFunction* const pFnClientDoPowerSubsequentImpact = pFnClientDoPowerSubsequentImpactRef.Get ( );
 
 	USFXPowerCustomAction_Overload_execClientDoPowerSubsequentImpact_Parms ClientDoPowerSubsequentImpact_Parms;
 	ClientDoPowerSubsequentImpact_Parms.oActor = oActor;
@@ -14613,10 +13162,9 @@ void USFXPowerCustomAction_Overload::ClientDoPowerSubsequentImpact ( class AActo
 
 void USFXPowerCustomAction_Overload::TestAchievement ( class AActor* oTarget )
 {
-	static UFunction* pFnTestAchievement = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTestAchievementRef { L"Function SFXGameContent.SFXPowerCustomAction_Overload.TestAchievement", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTestAchievement )
-		pFnTestAchievement = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Overload.TestAchievement" );
+	UFunction* const pFnTestAchievement = pFnTestAchievementRef.Get ( );
 
 	USFXPowerCustomAction_Overload_execTestAchievement_Parms TestAchievement_Parms;
 	TestAchievement_Parms.oTarget = oTarget;
@@ -14632,10 +13180,9 @@ void USFXPowerCustomAction_Overload::TestAchievement ( class AActor* oTarget )
 
 class USFXGameEffect_OverloadChain* USFXPowerCustomAction_Overload::CreateOverloadChainEffect ( class USFXModule_GameEffectManager* oManager )
 {
-	static UFunction* pFnCreateOverloadChainEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCreateOverloadChainEffectRef { L"Function SFXGameContent.SFXPowerCustomAction_Overload.CreateOverloadChainEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCreateOverloadChainEffect )
-		pFnCreateOverloadChainEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Overload.CreateOverloadChainEffect" );
+	UFunction* const pFnCreateOverloadChainEffect = pFnCreateOverloadChainEffectRef.Get ( );
 
 	USFXPowerCustomAction_Overload_execCreateOverloadChainEffect_Parms CreateOverloadChainEffect_Parms;
 	CreateOverloadChainEffect_Parms.oManager = oManager;
@@ -14657,10 +13204,9 @@ class USFXGameEffect_OverloadChain* USFXPowerCustomAction_Overload::CreateOverlo
 
 bool USFXPowerCustomAction_Overload::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Overload.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Overload.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerCustomAction_Overload_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -14682,10 +13228,9 @@ bool USFXPowerCustomAction_Overload::OnImpact ( unsigned char Resistance, class
 
 float USFXPowerCustomAction_Overload::GetImpactForce ( class AActor* oImpacted )
 {
-	static UFunction* pFnGetImpactForce = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetImpactForceRef { L"Function SFXGameContent.SFXPowerCustomAction_Overload.GetImpactForce", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetImpactForce )
-		pFnGetImpactForce = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Overload.GetImpactForce" );
+	UFunction* const pFnGetImpactForce = pFnGetImpactForceRef.Get ( );
 
 	USFXPowerCustomAction_Overload_execGetImpactForce_Parms GetImpactForce_Parms;
 	GetImpactForce_Parms.oImpacted = oImpacted;
@@ -14704,10 +13249,9 @@ float USFXPowerCustomAction_Overload::GetImpactForce ( class AActor* oImpacted )
 
 float USFXPowerCustomAction_Overload::GetImpactDamage ( class AActor* oImpacted, class UClass** DamageType )
 {
-	static UFunction* pFnGetImpactDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetImpactDamageRef { L"Function SFXGameContent.SFXPowerCustomAction_Overload.GetImpactDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetImpactDamage )
-		pFnGetImpactDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Overload.GetImpactDamage" );
+	UFunction* const pFnGetImpactDamage = pFnGetImpactDamageRef.Get ( );
 
 	USFXPowerCustomAction_Overload_execGetImpactDamage_Parms GetImpactDamage_Parms;
 	GetImpactDamage_Parms.oImpacted = oImpacted;
@@ -14733,10 +13277,9 @@ float USFXPowerCustomAction_Overload::GetImpactDamage ( class AActor* oImpacted,
 
 void USFXPowerCustomAction_Overload::OnPowerDetonated ( struct FVector const& HitLocation, struct FVector const& HitNormal, class ASFXProjectile_PowerCustomAction* oProjectile, class AActor* HitActor )
 {
-	static UFunction* pFnOnPowerDetonated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowerDetonatedRef { L"Function SFXGameContent.SFXPowerCustomAction_Overload.OnPowerDetonated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowerDetonated )
-		pFnOnPowerDetonated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Overload.OnPowerDetonated" );
+	UFunction* const pFnOnPowerDetonated = pFnOnPowerDetonatedRef.Get ( );
 
 	USFXPowerCustomAction_Overload_execOnPowerDetonated_Parms OnPowerDetonated_Parms;
 	memcpy ( &OnPowerDetonated_Parms.HitLocation, &HitLocation, 0xC );
@@ -14749,38 +13292,29 @@ void USFXPowerCustomAction_Overload::OnPowerDetonated ( struct FVector const& Hi
 
 
 
-class UClass* USFXGameEffect_Reave::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_Reave::pClassPointer { L"Class SFXGameContent.SFXGameEffect_Reave", &UObject::FindClass };
 
 class UClass* USFXGameEffect_Reave::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_Reave" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXPawn_Kaidan::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXPawn_Kaidan::pClassPointer { L"Class SFXGameContent.SFXPawn_Kaidan", &UObject::FindClass };
 
 class UClass* ASFXPawn_Kaidan::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPawn_Kaidan" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerCustomAction_Reave::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_Reave::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_Reave", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_Reave::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_Reave" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_Reave.PopulatePowerStatBarEvolves
@@ -14789,10 +13323,9 @@ class UClass* USFXPowerCustomAction_Reave::StaticClass()
 
 void USFXPowerCustomAction_Reave::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_Reave.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Reave.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_Reave_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -14806,10 +13339,9 @@ void USFXPowerCustomAction_Reave::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_Reave::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Reave.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Reave.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_Reave_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -14824,10 +13356,9 @@ void USFXPowerCustomAction_Reave::EvolvePower ( unsigned char choice )
 
 void USFXPowerCustomAction_Reave::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_Reave.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Reave.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_Reave_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -14844,10 +13375,9 @@ void USFXPowerCustomAction_Reave::RecalculateAllPowerData ( unsigned long bReset
 
 bool USFXPowerCustomAction_Reave::ShouldUsePower ( class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Reave.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Reave.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_Reave_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Target = Target;
@@ -14869,10 +13399,9 @@ bool USFXPowerCustomAction_Reave::ShouldUsePower ( class AActor* Target, FString
 
 void USFXPowerCustomAction_Reave::StopSounds ( )
 {
-	static UFunction* pFnStopSounds = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopSoundsRef { L"Function SFXGameContent.SFXPowerCustomAction_Reave.StopSounds", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopSounds )
-		pFnStopSounds = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Reave.StopSounds" );
+	UFunction* const pFnStopSounds = pFnStopSoundsRef.Get ( );
 
 	USFXPowerCustomAction_Reave_execStopSounds_Parms StopSounds_Parms;
 
@@ -14891,10 +13420,9 @@ void USFXPowerCustomAction_Reave::StopSounds ( )
 
 bool USFXPowerCustomAction_Reave::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Reave.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Reave.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerCustomAction_Reave_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -14917,10 +13445,9 @@ bool USFXPowerCustomAction_Reave::OnImpact ( unsigned char Resistance, class AAc
 
 float USFXPowerCustomAction_Reave::GetImpactDamage ( class AActor* oImpacted, class UClass** DamageType )
 {
-	static UFunction* pFnGetImpactDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetImpactDamageRef { L"Function SFXGameContent.SFXPowerCustomAction_Reave.GetImpactDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetImpactDamage )
-		pFnGetImpactDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Reave.GetImpactDamage" );
+	UFunction* const pFnGetImpactDamage = pFnGetImpactDamageRef.Get ( );
 
 	USFXPowerCustomAction_Reave_execGetImpactDamage_Parms GetImpactDamage_Parms;
 	GetImpactDamage_Parms.oImpacted = oImpacted;
@@ -14946,10 +13473,9 @@ float USFXPowerCustomAction_Reave::GetImpactDamage ( class AActor* oImpacted, cl
 
 void USFXPowerCustomAction_Reave::OnPowerDetonated ( struct FVector const& HitLocation, struct FVector const& HitNormal, class ASFXProjectile_PowerCustomAction* oProjectile, class AActor* HitActor )
 {
-	static UFunction* pFnOnPowerDetonated = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowerDetonatedRef { L"Function SFXGameContent.SFXPowerCustomAction_Reave.OnPowerDetonated", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowerDetonated )
-		pFnOnPowerDetonated = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Reave.OnPowerDetonated" );
+	UFunction* const pFnOnPowerDetonated = pFnOnPowerDetonatedRef.Get ( );
 
 	USFXPowerCustomAction_Reave_execOnPowerDetonated_Parms OnPowerDetonated_Parms;
 	memcpy ( &OnPowerDetonated_Parms.HitLocation, &HitLocation, 0xC );
@@ -14962,14 +13488,11 @@ void USFXPowerCustomAction_Reave::OnPowerDetonated ( struct FVector const& HitLo
 
 
 
-class UClass* USFXPowerCustomAction_CryoBlast::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_CryoBlast::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_CryoBlast", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_CryoBlast::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_CryoBlast" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_CryoBlast.PopulatePowerStatBarEvolves
@@ -14978,10 +13501,9 @@ class UClass* USFXPowerCustomAction_CryoBlast::StaticClass()
 
 void USFXPowerCustomAction_CryoBlast::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_CryoBlast_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -14997,10 +13519,9 @@ void USFXPowerCustomAction_CryoBlast::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_CryoBlast::ApplyBonus ( struct SFXName Parameter, class USFXGameEffect* Bonus, unsigned long bRemove )
 {
-	static UFunction* pFnApplyBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.ApplyBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyBonus )
-		pFnApplyBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.ApplyBonus" );
+	UFunction* const pFnApplyBonus = pFnApplyBonusRef.Get ( );
 
 	USFXPowerCustomAction_CryoBlast_execApplyBonus_Parms ApplyBonus_Parms;
 	memcpy ( &ApplyBonus_Parms.Parameter, &Parameter, 0x8 );
@@ -15017,10 +13538,9 @@ void USFXPowerCustomAction_CryoBlast::ApplyBonus ( struct SFXName Parameter, cla
 
 void USFXPowerCustomAction_CryoBlast::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_CryoBlast_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -15035,10 +13555,9 @@ void USFXPowerCustomAction_CryoBlast::EvolvePower ( unsigned char choice )
 
 void USFXPowerCustomAction_CryoBlast::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_CryoBlast_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -15053,10 +13572,9 @@ void USFXPowerCustomAction_CryoBlast::RecalculateAllPowerData ( unsigned long bR
 
 struct FVector USFXPowerCustomAction_CryoBlast::GetDefaultClientEffectParams ( )
 {
-	static UFunction* pFnGetDefaultClientEffectParams = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDefaultClientEffectParamsRef { L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.GetDefaultClientEffectParams", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDefaultClientEffectParams )
-		pFnGetDefaultClientEffectParams = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.GetDefaultClientEffectParams" );
+	UFunction* const pFnGetDefaultClientEffectParams = pFnGetDefaultClientEffectParamsRef.Get ( );
 
 	USFXPowerCustomAction_CryoBlast_execGetDefaultClientEffectParams_Parms GetDefaultClientEffectParams_Parms;
 
@@ -15074,10 +13592,9 @@ struct FVector USFXPowerCustomAction_CryoBlast::GetDefaultClientEffectParams ( )
 
 bool USFXPowerCustomAction_CryoBlast::ShouldUsePower ( class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_CryoBlast_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Target = Target;
@@ -15105,10 +13622,9 @@ bool USFXPowerCustomAction_CryoBlast::ShouldUsePower ( class AActor* Target, FSt
 
 void USFXPowerCustomAction_CryoBlast::ClientDoPowerSubsequentImpact ( class AActor* oActor, int CustomActionReactionType, float Duration, int ImpactCount, float Delay, unsigned long DoCallback )
 {
-	static UFunction* pFnClientDoPowerSubsequentImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoPowerSubsequentImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.ClientDoPowerSubsequentImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoPowerSubsequentImpact )
-		pFnClientDoPowerSubsequentImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.ClientDoPowerSubsequentImpact" );
+	UFunction* const pFnClientDoPowerSubsequentImpact = pFnClientDoPowerSubsequentImpactRef.Get ( );
 
 	USFXPowerCustomAction_CryoBlast_execClientDoPowerSubsequentImpact_Parms ClientDoPowerSubsequentImpact_Parms;
 	ClientDoPowerSubsequentImpact_Parms.oActor = oActor;
@@ -15128,10 +13644,9 @@ void USFXPowerCustomAction_CryoBlast::ClientDoPowerSubsequentImpact ( class AAct
 
 void USFXPowerCustomAction_CryoBlast::OnFrozenPawnDied ( class ABioPawn* oPawn )
 {
-	static UFunction* pFnOnFrozenPawnDied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnFrozenPawnDiedRef { L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.OnFrozenPawnDied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnFrozenPawnDied )
-		pFnOnFrozenPawnDied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.OnFrozenPawnDied" );
+	UFunction* const pFnOnFrozenPawnDied = pFnOnFrozenPawnDiedRef.Get ( );
 
 	USFXPowerCustomAction_CryoBlast_execOnFrozenPawnDied_Parms OnFrozenPawnDied_Parms;
 	OnFrozenPawnDied_Parms.oPawn = oPawn;
@@ -15147,10 +13662,9 @@ void USFXPowerCustomAction_CryoBlast::OnFrozenPawnDied ( class ABioPawn* oPawn )
 
 void USFXPowerCustomAction_CryoBlast::ApplySlowdownEffect ( class ABioPawn* oPawn, float Duration )
 {
-	static UFunction* pFnApplySlowdownEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplySlowdownEffectRef { L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.ApplySlowdownEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplySlowdownEffect )
-		pFnApplySlowdownEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.ApplySlowdownEffect" );
+	UFunction* const pFnApplySlowdownEffect = pFnApplySlowdownEffectRef.Get ( );
 
 	USFXPowerCustomAction_CryoBlast_execApplySlowdownEffect_Parms ApplySlowdownEffect_Parms;
 	ApplySlowdownEffect_Parms.oPawn = oPawn;
@@ -15169,10 +13683,9 @@ void USFXPowerCustomAction_CryoBlast::ApplySlowdownEffect ( class ABioPawn* oPaw
 
 void USFXPowerCustomAction_CryoBlast::ApplyFreezeEffect ( class ABioPawn* oPawn, float Duration, float fDelay, unsigned long bCallbackOnDeath )
 {
-	static UFunction* pFnApplyFreezeEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyFreezeEffectRef { L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.ApplyFreezeEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyFreezeEffect )
-		pFnApplyFreezeEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.ApplyFreezeEffect" );
+	UFunction* const pFnApplyFreezeEffect = pFnApplyFreezeEffectRef.Get ( );
 
 	USFXPowerCustomAction_CryoBlast_execApplyFreezeEffect_Parms ApplyFreezeEffect_Parms;
 	ApplyFreezeEffect_Parms.oPawn = oPawn;
@@ -15195,10 +13708,9 @@ void USFXPowerCustomAction_CryoBlast::ApplyFreezeEffect ( class ABioPawn* oPawn,
 
 bool USFXPowerCustomAction_CryoBlast::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerCustomAction_CryoBlast_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -15214,14 +13726,11 @@ bool USFXPowerCustomAction_CryoBlast::OnImpact ( unsigned char Resistance, class
 
 
 
-class UClass* USFXPowerCustomAction_Barrier::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_Barrier::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_Barrier", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_Barrier::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_Barrier" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_Barrier.PopulatePowerStatBarEvolves
@@ -15230,10 +13739,9 @@ class UClass* USFXPowerCustomAction_Barrier::StaticClass()
 
 void USFXPowerCustomAction_Barrier::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_Barrier.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Barrier.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_Barrier_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -15249,10 +13757,9 @@ void USFXPowerCustomAction_Barrier::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_Barrier::ApplyBonus ( struct SFXName Parameter, class USFXGameEffect* Bonus, unsigned long bRemove )
 {
-	static UFunction* pFnApplyBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_Barrier.ApplyBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyBonus )
-		pFnApplyBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Barrier.ApplyBonus" );
+	UFunction* const pFnApplyBonus = pFnApplyBonusRef.Get ( );
 
 	USFXPowerCustomAction_Barrier_execApplyBonus_Parms ApplyBonus_Parms;
 	memcpy ( &ApplyBonus_Parms.Parameter, &Parameter, 0x8 );
@@ -15269,10 +13776,9 @@ void USFXPowerCustomAction_Barrier::ApplyBonus ( struct SFXName Parameter, class
 
 void USFXPowerCustomAction_Barrier::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Barrier.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Barrier.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_Barrier_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -15287,10 +13793,9 @@ void USFXPowerCustomAction_Barrier::EvolvePower ( unsigned char choice )
 
 void USFXPowerCustomAction_Barrier::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_Barrier.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Barrier.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_Barrier_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -15310,10 +13815,9 @@ void USFXPowerCustomAction_Barrier::RecalculateAllPowerData ( unsigned long bRes
 
 bool USFXPowerCustomAction_Barrier::OnBlastImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnBlastImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnBlastImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Barrier.OnBlastImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnBlastImpact )
-		pFnOnBlastImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Barrier.OnBlastImpact" );
+	UFunction* const pFnOnBlastImpact = pFnOnBlastImpactRef.Get ( );
 
 	USFXPowerCustomAction_Barrier_execOnBlastImpact_Parms OnBlastImpact_Parms;
 	OnBlastImpact_Parms.Resistance = Resistance;
@@ -15339,10 +13843,9 @@ bool USFXPowerCustomAction_Barrier::OnBlastImpact ( unsigned char Resistance, cl
 
 void USFXPowerCustomAction_Barrier::ClientDoPowerSubsequentImpact ( class AActor* oActor, int CustomActionReactionType, float Duration, int ImpactCount, float Delay, unsigned long DoCallback )
 {
-	static UFunction* pFnClientDoPowerSubsequentImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoPowerSubsequentImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Barrier.ClientDoPowerSubsequentImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoPowerSubsequentImpact )
-		pFnClientDoPowerSubsequentImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Barrier.ClientDoPowerSubsequentImpact" );
+	UFunction* const pFnClientDoPowerSubsequentImpact = pFnClientDoPowerSubsequentImpactRef.Get ( );
 
 	USFXPowerCustomAction_Barrier_execClientDoPowerSubsequentImpact_Parms ClientDoPowerSubsequentImpact_Parms;
 	ClientDoPowerSubsequentImpact_Parms.oActor = oActor;
@@ -15361,10 +13864,9 @@ void USFXPowerCustomAction_Barrier::ClientDoPowerSubsequentImpact ( class AActor
 
 void USFXPowerCustomAction_Barrier::DoBlast ( )
 {
-	static UFunction* pFnDoBlast = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoBlastRef { L"Function SFXGameContent.SFXPowerCustomAction_Barrier.DoBlast", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoBlast )
-		pFnDoBlast = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Barrier.DoBlast" );
+	UFunction* const pFnDoBlast = pFnDoBlastRef.Get ( );
 
 	USFXPowerCustomAction_Barrier_execDoBlast_Parms DoBlast_Parms;
 
@@ -15377,10 +13879,9 @@ void USFXPowerCustomAction_Barrier::DoBlast ( )
 
 void USFXPowerCustomAction_Barrier::RemoveArmor ( )
 {
-	static UFunction* pFnRemoveArmor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRemoveArmorRef { L"Function SFXGameContent.SFXPowerCustomAction_Barrier.RemoveArmor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRemoveArmor )
-		pFnRemoveArmor = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Barrier.RemoveArmor" );
+	UFunction* const pFnRemoveArmor = pFnRemoveArmorRef.Get ( );
 
 	USFXPowerCustomAction_Barrier_execRemoveArmor_Parms RemoveArmor_Parms;
 
@@ -15393,10 +13894,9 @@ void USFXPowerCustomAction_Barrier::RemoveArmor ( )
 
 void USFXPowerCustomAction_Barrier::StartPowerCooldown ( )
 {
-	static UFunction* pFnStartPowerCooldown = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPowerCooldownRef { L"Function SFXGameContent.SFXPowerCustomAction_Barrier.StartPowerCooldown", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPowerCooldown )
-		pFnStartPowerCooldown = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Barrier.StartPowerCooldown" );
+	UFunction* const pFnStartPowerCooldown = pFnStartPowerCooldownRef.Get ( );
 
 	USFXPowerCustomAction_Barrier_execStartPowerCooldown_Parms StartPowerCooldown_Parms;
 
@@ -15409,10 +13909,9 @@ void USFXPowerCustomAction_Barrier::StartPowerCooldown ( )
 
 void USFXPowerCustomAction_Barrier::ApplyArmor ( )
 {
-	static UFunction* pFnApplyArmor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyArmorRef { L"Function SFXGameContent.SFXPowerCustomAction_Barrier.ApplyArmor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyArmor )
-		pFnApplyArmor = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Barrier.ApplyArmor" );
+	UFunction* const pFnApplyArmor = pFnApplyArmorRef.Get ( );
 
 	USFXPowerCustomAction_Barrier_execApplyArmor_Parms ApplyArmor_Parms;
 
@@ -15425,10 +13924,9 @@ void USFXPowerCustomAction_Barrier::ApplyArmor ( )
 
 void USFXPowerCustomAction_Barrier::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXPowerCustomAction_Barrier.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Barrier.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXPowerCustomAction_Barrier_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -15437,14 +13935,11 @@ void USFXPowerCustomAction_Barrier::StartCustomAction ( )
 
 
 
-class UClass* USFXPowerCustomAction_KaidenPassive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_KaidenPassive::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_KaidenPassive", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_KaidenPassive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_KaidenPassive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_KaidenPassive.PopulatePowerStatBarEvolves
@@ -15453,10 +13948,9 @@ class UClass* USFXPowerCustomAction_KaidenPassive::StaticClass()
 
 void USFXPowerCustomAction_KaidenPassive::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_KaidenPassive.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_KaidenPassive.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_KaidenPassive_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -15470,10 +13964,9 @@ void USFXPowerCustomAction_KaidenPassive::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_KaidenPassive::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_KaidenPassive.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_KaidenPassive.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_KaidenPassive_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -15487,10 +13980,9 @@ void USFXPowerCustomAction_KaidenPassive::EvolvePower ( unsigned char choice )
 
 void USFXPowerCustomAction_KaidenPassive::ResetPower ( )
 {
-	static UFunction* pFnResetPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResetPowerRef { L"Function SFXGameContent.SFXPowerCustomAction_KaidenPassive.ResetPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResetPower )
-		pFnResetPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_KaidenPassive.ResetPower" );
+	UFunction* const pFnResetPower = pFnResetPowerRef.Get ( );
 
 	USFXPowerCustomAction_KaidenPassive_execResetPower_Parms ResetPower_Parms;
 
@@ -15503,10 +13995,9 @@ void USFXPowerCustomAction_KaidenPassive::ResetPower ( )
 
 void USFXPowerCustomAction_KaidenPassive::ApplyGlobalBonus ( )
 {
-	static UFunction* pFnApplyGlobalBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyGlobalBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_KaidenPassive.ApplyGlobalBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyGlobalBonus )
-		pFnApplyGlobalBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_KaidenPassive.ApplyGlobalBonus" );
+	UFunction* const pFnApplyGlobalBonus = pFnApplyGlobalBonusRef.Get ( );
 
 	USFXPowerCustomAction_KaidenPassive_execApplyGlobalBonus_Parms ApplyGlobalBonus_Parms;
 
@@ -15515,14 +14006,11 @@ void USFXPowerCustomAction_KaidenPassive::ApplyGlobalBonus ( )
 
 
 
-class UClass* USFXPowerCustomAction_HenchmanPassive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_HenchmanPassive::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_HenchmanPassive", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_HenchmanPassive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_HenchmanPassive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_HenchmanPassive.RecalculateAllPowerData
@@ -15532,10 +14020,9 @@ class UClass* USFXPowerCustomAction_HenchmanPassive::StaticClass()
 
 void USFXPowerCustomAction_HenchmanPassive::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_HenchmanPassive.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_HenchmanPassive.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_HenchmanPassive_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -15549,10 +14036,9 @@ void USFXPowerCustomAction_HenchmanPassive::RecalculateAllPowerData ( unsigned l
 
 void USFXPowerCustomAction_HenchmanPassive::ApplyGlobalBonus ( )
 {
-	static UFunction* pFnApplyGlobalBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyGlobalBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_HenchmanPassive.ApplyGlobalBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyGlobalBonus )
-		pFnApplyGlobalBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_HenchmanPassive.ApplyGlobalBonus" );
+	UFunction* const pFnApplyGlobalBonus = pFnApplyGlobalBonusRef.Get ( );
 
 	USFXPowerCustomAction_HenchmanPassive_execApplyGlobalBonus_Parms ApplyGlobalBonus_Parms;
 
@@ -15561,218 +14047,164 @@ void USFXPowerCustomAction_HenchmanPassive::ApplyGlobalBonus ( )
 
 
 
-class UClass* ASFXShield_Energy::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXShield_Energy::pClassPointer { L"Class SFXGameContent.SFXShield_Energy", &UObject::FindClass };
 
 class UClass* ASFXShield_Energy::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXShield_Energy" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXCustomAction_HenchmanHeavyMelee::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXCustomAction_HenchmanHeavyMelee::pClassPointer { L"Class SFXGameContent.SFXCustomAction_HenchmanHeavyMelee", &UObject::FindClass };
 
 class UClass* USFXCustomAction_HenchmanHeavyMelee::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXCustomAction_HenchmanHeavyMelee" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Carnage::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Carnage::pClassPointer { L"Class SFXGameContent.SFXDamageType_Carnage", &UObject::FindClass };
 
 class UClass* USFXDamageType_Carnage::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Carnage" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Carnage_DoT::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Carnage_DoT::pClassPointer { L"Class SFXGameContent.SFXDamageType_Carnage_DoT", &UObject::FindClass };
 
 class UClass* USFXDamageType_Carnage_DoT::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Carnage_DoT" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Carnage_Improved::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Carnage_Improved::pClassPointer { L"Class SFXGameContent.SFXDamageType_Carnage_Improved", &UObject::FindClass };
 
 class UClass* USFXDamageType_Carnage_Improved::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Carnage_Improved" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Carnage_Improved_DoT::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Carnage_Improved_DoT::pClassPointer { L"Class SFXGameContent.SFXDamageType_Carnage_Improved_DoT", &UObject::FindClass };
 
 class UClass* USFXDamageType_Carnage_Improved_DoT::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Carnage_Improved_DoT" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Carnage_Ragdoll::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Carnage_Ragdoll::pClassPointer { L"Class SFXGameContent.SFXDamageType_Carnage_Ragdoll", &UObject::FindClass };
 
 class UClass* USFXDamageType_Carnage_Ragdoll::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Carnage_Ragdoll" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Carnage_Ragdoll_DoT::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Carnage_Ragdoll_DoT::pClassPointer { L"Class SFXGameContent.SFXDamageType_Carnage_Ragdoll_DoT", &UObject::FindClass };
 
 class UClass* USFXDamageType_Carnage_Ragdoll_DoT::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Carnage_Ragdoll_DoT" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Carnage_Ragdoll_Improved::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Carnage_Ragdoll_Improved::pClassPointer { L"Class SFXGameContent.SFXDamageType_Carnage_Ragdoll_Improved", &UObject::FindClass };
 
 class UClass* USFXDamageType_Carnage_Ragdoll_Improved::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Carnage_Ragdoll_Improved" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Carnage_Ragdoll_Improved_DoT::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Carnage_Ragdoll_Improved_DoT::pClassPointer { L"Class SFXGameContent.SFXDamageType_Carnage_Ragdoll_Improved_DoT", &UObject::FindClass };
 
 class UClass* USFXDamageType_Carnage_Ragdoll_Improved_DoT::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Carnage_Ragdoll_Improved_DoT" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_ConcussiveShot::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_ConcussiveShot::pClassPointer { L"Class SFXGameContent.SFXDamageType_ConcussiveShot", &UObject::FindClass };
 
 class UClass* USFXDamageType_ConcussiveShot::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_ConcussiveShot" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_ConcussiveShot_Incendiary::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_ConcussiveShot_Incendiary::pClassPointer { L"Class SFXGameContent.SFXDamageType_ConcussiveShot_Incendiary", &UObject::FindClass };
 
 class UClass* USFXDamageType_ConcussiveShot_Incendiary::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_ConcussiveShot_Incendiary" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_FragGrenade::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_FragGrenade::pClassPointer { L"Class SFXGameContent.SFXDamageType_FragGrenade", &UObject::FindClass };
 
 class UClass* USFXDamageType_FragGrenade::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_FragGrenade" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_FragGrenade_Armor::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_FragGrenade_Armor::pClassPointer { L"Class SFXGameContent.SFXDamageType_FragGrenade_Armor", &UObject::FindClass };
 
 class UClass* USFXDamageType_FragGrenade_Armor::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_FragGrenade_Armor" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_FragGrenade_Shields::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_FragGrenade_Shields::pClassPointer { L"Class SFXGameContent.SFXDamageType_FragGrenade_Shields", &UObject::FindClass };
 
 class UClass* USFXDamageType_FragGrenade_Shields::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_FragGrenade_Shields" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_IncendiaryAmmo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_IncendiaryAmmo::pClassPointer { L"Class SFXGameContent.SFXDamageType_IncendiaryAmmo", &UObject::FindClass };
 
 class UClass* USFXDamageType_IncendiaryAmmo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_IncendiaryAmmo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_IncendiaryAmmoImproved::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_IncendiaryAmmoImproved::pClassPointer { L"Class SFXGameContent.SFXDamageType_IncendiaryAmmoImproved", &UObject::FindClass };
 
 class UClass* USFXDamageType_IncendiaryAmmoImproved::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_IncendiaryAmmoImproved" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_AmmoPower::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_AmmoPower::pClassPointer { L"Class SFXGameContent.SFXGameEffect_AmmoPower", &UObject::FindClass };
 
 class UClass* USFXGameEffect_AmmoPower::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_AmmoPower" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_AmmoPower.OnUpdate
@@ -15782,10 +14214,9 @@ class UClass* USFXGameEffect_AmmoPower::StaticClass()
 
 void USFXGameEffect_AmmoPower::eventOnUpdate ( float DeltaSeconds )
 {
-	static UFunction* pFnOnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnUpdateRef { L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnUpdate", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnUpdate )
-		pFnOnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnUpdate" );
+	UFunction* const pFnOnUpdate = pFnOnUpdateRef.Get ( );
 
 	USFXGameEffect_AmmoPower_eventOnUpdate_Parms OnUpdate_Parms;
 	OnUpdate_Parms.DeltaSeconds = DeltaSeconds;
@@ -15800,10 +14231,9 @@ void USFXGameEffect_AmmoPower::eventOnUpdate ( float DeltaSeconds )
 
 void USFXGameEffect_AmmoPower::OnWeaponUnequip ( class ASFXWeapon* Weapon )
 {
-	static UFunction* pFnOnWeaponUnequip = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnWeaponUnequipRef { L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnWeaponUnequip", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnWeaponUnequip )
-		pFnOnWeaponUnequip = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnWeaponUnequip" );
+	UFunction* const pFnOnWeaponUnequip = pFnOnWeaponUnequipRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execOnWeaponUnequip_Parms OnWeaponUnequip_Parms;
 	OnWeaponUnequip_Parms.Weapon = Weapon;
@@ -15818,10 +14248,9 @@ void USFXGameEffect_AmmoPower::OnWeaponUnequip ( class ASFXWeapon* Weapon )
 
 void USFXGameEffect_AmmoPower::OnWeaponEquip ( class ASFXWeapon* Weapon )
 {
-	static UFunction* pFnOnWeaponEquip = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnWeaponEquipRef { L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnWeaponEquip", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnWeaponEquip )
-		pFnOnWeaponEquip = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnWeaponEquip" );
+	UFunction* const pFnOnWeaponEquip = pFnOnWeaponEquipRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execOnWeaponEquip_Parms OnWeaponEquip_Parms;
 	OnWeaponEquip_Parms.Weapon = Weapon;
@@ -15836,10 +14265,9 @@ void USFXGameEffect_AmmoPower::OnWeaponEquip ( class ASFXWeapon* Weapon )
 
 void USFXGameEffect_AmmoPower::OnWeaponReload ( class ASFXWeapon* Weapon )
 {
-	static UFunction* pFnOnWeaponReload = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnWeaponReloadRef { L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnWeaponReload", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnWeaponReload )
-		pFnOnWeaponReload = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnWeaponReload" );
+	UFunction* const pFnOnWeaponReload = pFnOnWeaponReloadRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execOnWeaponReload_Parms OnWeaponReload_Parms;
 	OnWeaponReload_Parms.Weapon = Weapon;
@@ -15854,10 +14282,9 @@ void USFXGameEffect_AmmoPower::OnWeaponReload ( class ASFXWeapon* Weapon )
 
 float USFXGameEffect_AmmoPower::GetDamageVocProbabilityMod ( )
 {
-	static UFunction* pFnGetDamageVocProbabilityMod = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDamageVocProbabilityModRef { L"Function SFXGameContent.SFXGameEffect_AmmoPower.GetDamageVocProbabilityMod", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDamageVocProbabilityMod )
-		pFnGetDamageVocProbabilityMod = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_AmmoPower.GetDamageVocProbabilityMod" );
+	UFunction* const pFnGetDamageVocProbabilityMod = pFnGetDamageVocProbabilityModRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execGetDamageVocProbabilityMod_Parms GetDamageVocProbabilityMod_Parms;
 
@@ -15874,10 +14301,9 @@ float USFXGameEffect_AmmoPower::GetDamageVocProbabilityMod ( )
 
 void USFXGameEffect_AmmoPower::OnWeaponImpact ( class ASFXWeapon* Weapon, struct FImpactInfo const& Impact )
 {
-	static UFunction* pFnOnWeaponImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnWeaponImpactRef { L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnWeaponImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnWeaponImpact )
-		pFnOnWeaponImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnWeaponImpact" );
+	UFunction* const pFnOnWeaponImpact = pFnOnWeaponImpactRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execOnWeaponImpact_Parms OnWeaponImpact_Parms;
 	OnWeaponImpact_Parms.Weapon = Weapon;
@@ -15892,10 +14318,9 @@ void USFXGameEffect_AmmoPower::OnWeaponImpact ( class ASFXWeapon* Weapon, struct
 
 void USFXGameEffect_AmmoPower::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -15910,10 +14335,9 @@ void USFXGameEffect_AmmoPower::OnRemoved ( )
 
 float USFXGameEffect_AmmoPower::GetBulletsPerSecond ( class ASFXWeapon* Weapon )
 {
-	static UFunction* pFnGetBulletsPerSecond = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetBulletsPerSecondRef { L"Function SFXGameContent.SFXGameEffect_AmmoPower.GetBulletsPerSecond", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetBulletsPerSecond )
-		pFnGetBulletsPerSecond = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_AmmoPower.GetBulletsPerSecond" );
+	UFunction* const pFnGetBulletsPerSecond = pFnGetBulletsPerSecondRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execGetBulletsPerSecond_Parms GetBulletsPerSecond_Parms;
 	GetBulletsPerSecond_Parms.Weapon = Weapon;
@@ -15932,10 +14356,9 @@ float USFXGameEffect_AmmoPower::GetBulletsPerSecond ( class ASFXWeapon* Weapon )
 
 float USFXGameEffect_AmmoPower::GetWeaponDamage ( class ASFXWeapon* Weapon, struct FImpactInfo const& Impact )
 {
-	static UFunction* pFnGetWeaponDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetWeaponDamageRef { L"Function SFXGameContent.SFXGameEffect_AmmoPower.GetWeaponDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetWeaponDamage )
-		pFnGetWeaponDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_AmmoPower.GetWeaponDamage" );
+	UFunction* const pFnGetWeaponDamage = pFnGetWeaponDamageRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execGetWeaponDamage_Parms GetWeaponDamage_Parms;
 	GetWeaponDamage_Parms.Weapon = Weapon;
@@ -15954,10 +14377,9 @@ float USFXGameEffect_AmmoPower::GetWeaponDamage ( class ASFXWeapon* Weapon, stru
 
 class AActor* USFXGameEffect_AmmoPower::GetHitTarget ( struct FImpactInfo const& Impact )
 {
-	static UFunction* pFnGetHitTarget = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetHitTargetRef { L"Function SFXGameContent.SFXGameEffect_AmmoPower.GetHitTarget", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetHitTarget )
-		pFnGetHitTarget = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_AmmoPower.GetHitTarget" );
+	UFunction* const pFnGetHitTarget = pFnGetHitTargetRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execGetHitTarget_Parms GetHitTarget_Parms;
 	memcpy ( &GetHitTarget_Parms.Impact, &Impact, 0x64 );
@@ -15973,10 +14395,9 @@ class AActor* USFXGameEffect_AmmoPower::GetHitTarget ( struct FImpactInfo const&
 
 void USFXGameEffect_AmmoPower::SetupFromWeapon ( )
 {
-	static UFunction* pFnSetupFromWeapon = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetupFromWeaponRef { L"Function SFXGameContent.SFXGameEffect_AmmoPower.SetupFromWeapon", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetupFromWeapon )
-		pFnSetupFromWeapon = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_AmmoPower.SetupFromWeapon" );
+	UFunction* const pFnSetupFromWeapon = pFnSetupFromWeaponRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execSetupFromWeapon_Parms SetupFromWeapon_Parms;
 
@@ -15989,10 +14410,9 @@ void USFXGameEffect_AmmoPower::SetupFromWeapon ( )
 
 void USFXGameEffect_AmmoPower::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_AmmoPower_execOnApplied_Parms OnApplied_Parms;
 
@@ -16001,14 +14421,11 @@ void USFXGameEffect_AmmoPower::OnApplied ( )
 
 
 
-class UClass* USFXPowerCustomAction_AmmoPower::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_AmmoPower::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_AmmoPower", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_AmmoPower::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_AmmoPower" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_AmmoPower.DelayedSetWeaponPower
@@ -16017,10 +14434,9 @@ class UClass* USFXPowerCustomAction_AmmoPower::StaticClass()
 
 void USFXPowerCustomAction_AmmoPower::DelayedSetWeaponPower ( )
 {
-	static UFunction* pFnDelayedSetWeaponPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDelayedSetWeaponPowerRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.DelayedSetWeaponPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDelayedSetWeaponPower )
-		pFnDelayedSetWeaponPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.DelayedSetWeaponPower" );
+	UFunction* const pFnDelayedSetWeaponPower = pFnDelayedSetWeaponPowerRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execDelayedSetWeaponPower_Parms DelayedSetWeaponPower_Parms;
 
@@ -16039,10 +14455,9 @@ void USFXPowerCustomAction_AmmoPower::DelayedSetWeaponPower ( )
 
 void USFXPowerCustomAction_AmmoPower::ClientDoCustomActionImpact ( class AActor* oActor, int ImpactCount, unsigned long bFirstTarget, struct FVector const& HitLocation, struct FVector const& HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnClientDoCustomActionImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoCustomActionImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ClientDoCustomActionImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoCustomActionImpact )
-		pFnClientDoCustomActionImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ClientDoCustomActionImpact" );
+	UFunction* const pFnClientDoCustomActionImpact = pFnClientDoCustomActionImpactRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execClientDoCustomActionImpact_Parms ClientDoCustomActionImpact_Parms;
 	ClientDoCustomActionImpact_Parms.oActor = oActor;
@@ -16061,10 +14476,9 @@ void USFXPowerCustomAction_AmmoPower::ClientDoCustomActionImpact ( class AActor*
 
 void USFXPowerCustomAction_AmmoPower::DoJoinInProgress ( )
 {
-	static UFunction* pFnDoJoinInProgress = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoJoinInProgressRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.DoJoinInProgress", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoJoinInProgress )
-		pFnDoJoinInProgress = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.DoJoinInProgress" );
+	UFunction* const pFnDoJoinInProgress = pFnDoJoinInProgressRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execDoJoinInProgress_Parms DoJoinInProgress_Parms;
 
@@ -16079,10 +14493,9 @@ void USFXPowerCustomAction_AmmoPower::DoJoinInProgress ( )
 
 void USFXPowerCustomAction_AmmoPower::SetupEffect ( class USFXGameEffect_AmmoPower* Effect, class ABioPawn* oPawn )
 {
-	static UFunction* pFnSetupEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetupEffectRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.SetupEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetupEffect )
-		pFnSetupEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.SetupEffect" );
+	UFunction* const pFnSetupEffect = pFnSetupEffectRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execSetupEffect_Parms SetupEffect_Parms;
 	SetupEffect_Parms.Effect = Effect;
@@ -16097,10 +14510,9 @@ void USFXPowerCustomAction_AmmoPower::SetupEffect ( class USFXGameEffect_AmmoPow
 
 void USFXPowerCustomAction_AmmoPower::OnPowerRankIncreased ( )
 {
-	static UFunction* pFnOnPowerRankIncreased = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnPowerRankIncreasedRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.OnPowerRankIncreased", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnPowerRankIncreased )
-		pFnOnPowerRankIncreased = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.OnPowerRankIncreased" );
+	UFunction* const pFnOnPowerRankIncreased = pFnOnPowerRankIncreasedRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execOnPowerRankIncreased_Parms OnPowerRankIncreased_Parms;
 
@@ -16116,10 +14528,9 @@ void USFXPowerCustomAction_AmmoPower::OnPowerRankIncreased ( )
 
 bool USFXPowerCustomAction_AmmoPower::ShouldUsePower ( class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Target = Target;
@@ -16143,10 +14554,9 @@ bool USFXPowerCustomAction_AmmoPower::ShouldUsePower ( class AActor* Target, FSt
 
 void USFXPowerCustomAction_AmmoPower::DoConcussiveShotSpecialImpact ( class AActor* oImpacted, float ImpactEffectDuration )
 {
-	static UFunction* pFnDoConcussiveShotSpecialImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoConcussiveShotSpecialImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.DoConcussiveShotSpecialImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoConcussiveShotSpecialImpact )
-		pFnDoConcussiveShotSpecialImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.DoConcussiveShotSpecialImpact" );
+	UFunction* const pFnDoConcussiveShotSpecialImpact = pFnDoConcussiveShotSpecialImpactRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execDoConcussiveShotSpecialImpact_Parms DoConcussiveShotSpecialImpact_Parms;
 	DoConcussiveShotSpecialImpact_Parms.oImpacted = oImpacted;
@@ -16167,10 +14577,9 @@ void USFXPowerCustomAction_AmmoPower::DoConcussiveShotSpecialImpact ( class AAct
 
 void USFXPowerCustomAction_AmmoPower::ClientDoPowerSubsequentImpact ( class AActor* oActor, int CustomActionReactionType, float Duration, int ImpactCount, float Delay, unsigned long DoCallback )
 {
-	static UFunction* pFnClientDoPowerSubsequentImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoPowerSubsequentImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ClientDoPowerSubsequentImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoPowerSubsequentImpact )
-		pFnClientDoPowerSubsequentImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ClientDoPowerSubsequentImpact" );
+	UFunction* const pFnClientDoPowerSubsequentImpact = pFnClientDoPowerSubsequentImpactRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execClientDoPowerSubsequentImpact_Parms ClientDoPowerSubsequentImpact_Parms;
 	ClientDoPowerSubsequentImpact_Parms.oActor = oActor;
@@ -16191,10 +14600,9 @@ void USFXPowerCustomAction_AmmoPower::ClientDoPowerSubsequentImpact ( class AAct
 
 void USFXPowerCustomAction_AmmoPower::ReplicateConcussiveShotSpecialImpact ( class ABioPawn* oImpacted, float DurationOfEffect )
 {
-	static UFunction* pFnReplicateConcussiveShotSpecialImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReplicateConcussiveShotSpecialImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ReplicateConcussiveShotSpecialImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReplicateConcussiveShotSpecialImpact )
-		pFnReplicateConcussiveShotSpecialImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ReplicateConcussiveShotSpecialImpact" );
+	UFunction* const pFnReplicateConcussiveShotSpecialImpact = pFnReplicateConcussiveShotSpecialImpactRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execReplicateConcussiveShotSpecialImpact_Parms ReplicateConcussiveShotSpecialImpact_Parms;
 	ReplicateConcussiveShotSpecialImpact_Parms.oImpacted = oImpacted;
@@ -16214,10 +14622,9 @@ void USFXPowerCustomAction_AmmoPower::ReplicateConcussiveShotSpecialImpact ( cla
 
 void USFXPowerCustomAction_AmmoPower::ConcussiveShotCustomImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnConcussiveShotCustomImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnConcussiveShotCustomImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ConcussiveShotCustomImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnConcussiveShotCustomImpact )
-		pFnConcussiveShotCustomImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ConcussiveShotCustomImpact" );
+	UFunction* const pFnConcussiveShotCustomImpact = pFnConcussiveShotCustomImpactRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execConcussiveShotCustomImpact_Parms ConcussiveShotCustomImpact_Parms;
 	ConcussiveShotCustomImpact_Parms.Resistance = Resistance;
@@ -16237,10 +14644,9 @@ void USFXPowerCustomAction_AmmoPower::ConcussiveShotCustomImpact ( unsigned char
 
 void USFXPowerCustomAction_AmmoPower::ApplyPowerEffects ( class ABioPawn* oPawn, class ASFXWeapon* oWeapon )
 {
-	static UFunction* pFnApplyPowerEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyPowerEffectsRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ApplyPowerEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyPowerEffects )
-		pFnApplyPowerEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ApplyPowerEffects" );
+	UFunction* const pFnApplyPowerEffects = pFnApplyPowerEffectsRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execApplyPowerEffects_Parms ApplyPowerEffects_Parms;
 	ApplyPowerEffects_Parms.oPawn = oPawn;
@@ -16259,10 +14665,9 @@ void USFXPowerCustomAction_AmmoPower::ApplyPowerEffects ( class ABioPawn* oPawn,
 
 bool USFXPowerCustomAction_AmmoPower::SetWeaponPower ( class ABioPawn* oPawn, class ASFXWeapon* oWeapon, unsigned long bOverrideCurrentPower )
 {
-	static UFunction* pFnSetWeaponPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetWeaponPowerRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.SetWeaponPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetWeaponPower )
-		pFnSetWeaponPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.SetWeaponPower" );
+	UFunction* const pFnSetWeaponPower = pFnSetWeaponPowerRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execSetWeaponPower_Parms SetWeaponPower_Parms;
 	SetWeaponPower_Parms.oPawn = oPawn;
@@ -16280,10 +14685,9 @@ bool USFXPowerCustomAction_AmmoPower::SetWeaponPower ( class ABioPawn* oPawn, cl
 
 void USFXPowerCustomAction_AmmoPower::DeferedSetWeaponPower ( )
 {
-	static UFunction* pFnDeferedSetWeaponPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDeferedSetWeaponPowerRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.DeferedSetWeaponPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDeferedSetWeaponPower )
-		pFnDeferedSetWeaponPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.DeferedSetWeaponPower" );
+	UFunction* const pFnDeferedSetWeaponPower = pFnDeferedSetWeaponPowerRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execDeferedSetWeaponPower_Parms DeferedSetWeaponPower_Parms;
 
@@ -16302,10 +14706,9 @@ void USFXPowerCustomAction_AmmoPower::DeferedSetWeaponPower ( )
 
 bool USFXPowerCustomAction_AmmoPower::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -16327,10 +14730,9 @@ bool USFXPowerCustomAction_AmmoPower::OnImpact ( unsigned char Resistance, class
 
 void USFXPowerCustomAction_AmmoPower::ReloadAmmoPower ( class ABioPawn* Target, class ASFXWeapon* Weapon )
 {
-	static UFunction* pFnReloadAmmoPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReloadAmmoPowerRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ReloadAmmoPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReloadAmmoPower )
-		pFnReloadAmmoPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ReloadAmmoPower" );
+	UFunction* const pFnReloadAmmoPower = pFnReloadAmmoPowerRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execReloadAmmoPower_Parms ReloadAmmoPower_Parms;
 	ReloadAmmoPower_Parms.Target = Target;
@@ -16345,10 +14747,9 @@ void USFXPowerCustomAction_AmmoPower::ReloadAmmoPower ( class ABioPawn* Target,
 
 void USFXPowerCustomAction_AmmoPower::StopOmniTool ( )
 {
-	static UFunction* pFnStopOmniTool = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStopOmniToolRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.StopOmniTool", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStopOmniTool )
-		pFnStopOmniTool = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.StopOmniTool" );
+	UFunction* const pFnStopOmniTool = pFnStopOmniToolRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execStopOmniTool_Parms StopOmniTool_Parms;
 
@@ -16361,10 +14762,9 @@ void USFXPowerCustomAction_AmmoPower::StopOmniTool ( )
 
 void USFXPowerCustomAction_AmmoPower::StartCustomAction ( )
 {
-	static UFunction* pFnStartCustomAction = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartCustomActionRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.StartCustomAction", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartCustomAction )
-		pFnStartCustomAction = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.StartCustomAction" );
+	UFunction* const pFnStartCustomAction = pFnStartCustomActionRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execStartCustomAction_Parms StartCustomAction_Parms;
 
@@ -16379,10 +14779,9 @@ void USFXPowerCustomAction_AmmoPower::StartCustomAction ( )
 
 bool USFXPowerCustomAction_AmmoPower::CanUsePower ( class AActor* oTarget )
 {
-	static UFunction* pFnCanUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnCanUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.CanUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnCanUsePower )
-		pFnCanUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.CanUsePower" );
+	UFunction* const pFnCanUsePower = pFnCanUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execCanUsePower_Parms CanUsePower_Parms;
 	CanUsePower_Parms.oTarget = oTarget;
@@ -16400,10 +14799,9 @@ bool USFXPowerCustomAction_AmmoPower::CanUsePower ( class AActor* oTarget )
 
 void USFXPowerCustomAction_AmmoPower::PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects )
 {
-	static UFunction* pFnPrecacheVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPrecacheVFXRef { L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.PrecacheVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPrecacheVFX )
-		pFnPrecacheVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.PrecacheVFX" );
+	UFunction* const pFnPrecacheVFX = pFnPrecacheVFXRef.Get ( );
 
 	USFXPowerCustomAction_AmmoPower_execPrecacheVFX_Parms PrecacheVFX_Parms;
 	PrecacheVFX_Parms.ObjectPool = ObjectPool;
@@ -16414,50 +14812,38 @@ void USFXPowerCustomAction_AmmoPower::PrecacheVFX ( class ASFXObjectPool* Object
 
 
 
-class UClass* USFXGameEffect_FireDeath::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_FireDeath::pClassPointer { L"Class SFXGameContent.SFXGameEffect_FireDeath", &UObject::FindClass };
 
 class UClass* USFXGameEffect_FireDeath::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_FireDeath" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_HenchmanArmorBonus_HealthBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_HenchmanArmorBonus_HealthBonus::pClassPointer { L"Class SFXGameContent.SFXGameEffect_HenchmanArmorBonus_HealthBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_HenchmanArmorBonus_HealthBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_HenchmanArmorBonus_HealthBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_HenchmanArmorBonus_ShieldBonus::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_HenchmanArmorBonus_ShieldBonus::pClassPointer { L"Class SFXGameContent.SFXGameEffect_HenchmanArmorBonus_ShieldBonus", &UObject::FindClass };
 
 class UClass* USFXGameEffect_HenchmanArmorBonus_ShieldBonus::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_HenchmanArmorBonus_ShieldBonus" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGameEffect_IncendiaryAmmo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_IncendiaryAmmo::pClassPointer { L"Class SFXGameContent.SFXGameEffect_IncendiaryAmmo", &UObject::FindClass };
 
 class UClass* USFXGameEffect_IncendiaryAmmo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_IncendiaryAmmo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.AddGameEffects
@@ -16467,10 +14853,9 @@ class UClass* USFXGameEffect_IncendiaryAmmo::StaticClass()
 
 void USFXGameEffect_IncendiaryAmmo::AddGameEffects ( class AActor* oTarget )
 {
-	static UFunction* pFnAddGameEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnAddGameEffectsRef { L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.AddGameEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnAddGameEffects )
-		pFnAddGameEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.AddGameEffects" );
+	UFunction* const pFnAddGameEffects = pFnAddGameEffectsRef.Get ( );
 
 	USFXGameEffect_IncendiaryAmmo_execAddGameEffects_Parms AddGameEffects_Parms;
 	AddGameEffects_Parms.oTarget = oTarget;
@@ -16485,10 +14870,9 @@ void USFXGameEffect_IncendiaryAmmo::AddGameEffects ( class AActor* oTarget )
 
 float USFXGameEffect_IncendiaryAmmo::GetDamageVocProbabilityMod ( )
 {
-	static UFunction* pFnGetDamageVocProbabilityMod = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDamageVocProbabilityModRef { L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.GetDamageVocProbabilityMod", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDamageVocProbabilityMod )
-		pFnGetDamageVocProbabilityMod = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.GetDamageVocProbabilityMod" );
+	UFunction* const pFnGetDamageVocProbabilityMod = pFnGetDamageVocProbabilityModRef.Get ( );
 
 	USFXGameEffect_IncendiaryAmmo_execGetDamageVocProbabilityMod_Parms GetDamageVocProbabilityMod_Parms;
 
@@ -16505,10 +14889,9 @@ float USFXGameEffect_IncendiaryAmmo::GetDamageVocProbabilityMod ( )
 
 void USFXGameEffect_IncendiaryAmmo::OnWeaponImpact ( class ASFXWeapon* Weapon, struct FImpactInfo const& Impact )
 {
-	static UFunction* pFnOnWeaponImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnWeaponImpactRef { L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.OnWeaponImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnWeaponImpact )
-		pFnOnWeaponImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.OnWeaponImpact" );
+	UFunction* const pFnOnWeaponImpact = pFnOnWeaponImpactRef.Get ( );
 
 	USFXGameEffect_IncendiaryAmmo_execOnWeaponImpact_Parms OnWeaponImpact_Parms;
 	OnWeaponImpact_Parms.Weapon = Weapon;
@@ -16523,10 +14906,9 @@ void USFXGameEffect_IncendiaryAmmo::OnWeaponImpact ( class ASFXWeapon* Weapon, s
 
 void USFXGameEffect_IncendiaryAmmo::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_IncendiaryAmmo_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -16539,10 +14921,9 @@ void USFXGameEffect_IncendiaryAmmo::OnRemoved ( )
 
 void USFXGameEffect_IncendiaryAmmo::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_IncendiaryAmmo_execOnApplied_Parms OnApplied_Parms;
 
@@ -16557,10 +14938,9 @@ void USFXGameEffect_IncendiaryAmmo::OnApplied ( )
 
 void USFXGameEffect_IncendiaryAmmo::PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects )
 {
-	static UFunction* pFnPrecacheVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPrecacheVFXRef { L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.PrecacheVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPrecacheVFX )
-		pFnPrecacheVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.PrecacheVFX" );
+	UFunction* const pFnPrecacheVFX = pFnPrecacheVFXRef.Get ( );
 
 	USFXGameEffect_IncendiaryAmmo_execPrecacheVFX_Parms PrecacheVFX_Parms;
 	PrecacheVFX_Parms.ObjectPool = ObjectPool;
@@ -16571,14 +14951,11 @@ void USFXGameEffect_IncendiaryAmmo::PrecacheVFX ( class ASFXObjectPool* ObjectPo
 
 
 
-class UClass* USFXPowerCustomAction_IncendiaryAmmo::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_IncendiaryAmmo::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_IncendiaryAmmo::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.PopulatePowerStatBarEvolves
@@ -16587,10 +14964,9 @@ class UClass* USFXPowerCustomAction_IncendiaryAmmo::StaticClass()
 
 void USFXPowerCustomAction_IncendiaryAmmo::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -16606,10 +14982,9 @@ void USFXPowerCustomAction_IncendiaryAmmo::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_IncendiaryAmmo::ApplyBonus ( struct SFXName Parameter, class USFXGameEffect* Bonus, unsigned long bRemove )
 {
-	static UFunction* pFnApplyBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ApplyBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyBonus )
-		pFnApplyBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ApplyBonus" );
+	UFunction* const pFnApplyBonus = pFnApplyBonusRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execApplyBonus_Parms ApplyBonus_Parms;
 	memcpy ( &ApplyBonus_Parms.Parameter, &Parameter, 0x8 );
@@ -16626,10 +15001,9 @@ void USFXPowerCustomAction_IncendiaryAmmo::ApplyBonus ( struct SFXName Parameter
 
 void USFXPowerCustomAction_IncendiaryAmmo::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -16643,10 +15017,9 @@ void USFXPowerCustomAction_IncendiaryAmmo::RecalculateAllPowerData ( unsigned lo
 
 void USFXPowerCustomAction_IncendiaryAmmo::ResetPower ( )
 {
-	static UFunction* pFnResetPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResetPowerRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ResetPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResetPower )
-		pFnResetPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ResetPower" );
+	UFunction* const pFnResetPower = pFnResetPowerRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execResetPower_Parms ResetPower_Parms;
 
@@ -16660,10 +15033,9 @@ void USFXPowerCustomAction_IncendiaryAmmo::ResetPower ( )
 
 void USFXPowerCustomAction_IncendiaryAmmo::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -16678,10 +15050,9 @@ void USFXPowerCustomAction_IncendiaryAmmo::EvolvePower ( unsigned char choice )
 
 class USFXGameEffect_IncendiaryAmmo* USFXPowerCustomAction_IncendiaryAmmo::GetIncendiaryAmmoEffect ( )
 {
-	static UFunction* pFnGetIncendiaryAmmoEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetIncendiaryAmmoEffectRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.GetIncendiaryAmmoEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetIncendiaryAmmoEffect )
-		pFnGetIncendiaryAmmoEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.GetIncendiaryAmmoEffect" );
+	UFunction* const pFnGetIncendiaryAmmoEffect = pFnGetIncendiaryAmmoEffectRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execGetIncendiaryAmmoEffect_Parms GetIncendiaryAmmoEffect_Parms;
 
@@ -16702,10 +15073,9 @@ class USFXGameEffect_IncendiaryAmmo* USFXPowerCustomAction_IncendiaryAmmo::GetIn
 
 bool USFXPowerCustomAction_IncendiaryAmmo::OnActorImpacted ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnActorImpacted = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnActorImpactedRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.OnActorImpacted", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnActorImpacted )
-		pFnOnActorImpacted = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.OnActorImpacted" );
+	UFunction* const pFnOnActorImpacted = pFnOnActorImpactedRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execOnActorImpacted_Parms OnActorImpacted_Parms;
 	OnActorImpacted_Parms.Resistance = Resistance;
@@ -16727,10 +15097,9 @@ bool USFXPowerCustomAction_IncendiaryAmmo::OnActorImpacted ( unsigned char Resis
 
 void USFXPowerCustomAction_IncendiaryAmmo::DoConcussiveShotSpecialImpact ( class AActor* oImpacted, float ImpactEffectDuration )
 {
-	static UFunction* pFnDoConcussiveShotSpecialImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoConcussiveShotSpecialImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.DoConcussiveShotSpecialImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoConcussiveShotSpecialImpact )
-		pFnDoConcussiveShotSpecialImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.DoConcussiveShotSpecialImpact" );
+	UFunction* const pFnDoConcussiveShotSpecialImpact = pFnDoConcussiveShotSpecialImpactRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execDoConcussiveShotSpecialImpact_Parms DoConcussiveShotSpecialImpact_Parms;
 	DoConcussiveShotSpecialImpact_Parms.oImpacted = oImpacted;
@@ -16750,10 +15119,9 @@ void USFXPowerCustomAction_IncendiaryAmmo::DoConcussiveShotSpecialImpact ( class
 
 void USFXPowerCustomAction_IncendiaryAmmo::ConcussiveShotCustomImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnConcussiveShotCustomImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnConcussiveShotCustomImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ConcussiveShotCustomImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnConcussiveShotCustomImpact )
-		pFnConcussiveShotCustomImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ConcussiveShotCustomImpact" );
+	UFunction* const pFnConcussiveShotCustomImpact = pFnConcussiveShotCustomImpactRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execConcussiveShotCustomImpact_Parms ConcussiveShotCustomImpact_Parms;
 	ConcussiveShotCustomImpact_Parms.Resistance = Resistance;
@@ -16777,10 +15145,9 @@ void USFXPowerCustomAction_IncendiaryAmmo::ConcussiveShotCustomImpact ( unsigned
 
 void USFXPowerCustomAction_IncendiaryAmmo::ClientDoPowerSubsequentImpact ( class AActor* oActor, int CustomActionReactionType, float Duration, int ImpactCount, float Delay, unsigned long DoCallback )
 {
-	static UFunction* pFnClientDoPowerSubsequentImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoPowerSubsequentImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ClientDoPowerSubsequentImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoPowerSubsequentImpact )
-		pFnClientDoPowerSubsequentImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ClientDoPowerSubsequentImpact" );
+	UFunction* const pFnClientDoPowerSubsequentImpact = pFnClientDoPowerSubsequentImpactRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execClientDoPowerSubsequentImpact_Parms ClientDoPowerSubsequentImpact_Parms;
 	ClientDoPowerSubsequentImpact_Parms.oActor = oActor;
@@ -16805,10 +15172,9 @@ void USFXPowerCustomAction_IncendiaryAmmo::ClientDoPowerSubsequentImpact ( class
 
 void USFXPowerCustomAction_IncendiaryAmmo::ClientDoCustomActionImpact ( class AActor* oActor, int ImpactCount, unsigned long bFirstTarget, struct FVector const& HitLocation, struct FVector const& HitNormal, int CustomActionReactionType )
 {
-	static UFunction* pFnClientDoCustomActionImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnClientDoCustomActionImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ClientDoCustomActionImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnClientDoCustomActionImpact )
-		pFnClientDoCustomActionImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ClientDoCustomActionImpact" );
+	UFunction* const pFnClientDoCustomActionImpact = pFnClientDoCustomActionImpactRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execClientDoCustomActionImpact_Parms ClientDoCustomActionImpact_Parms;
 	ClientDoCustomActionImpact_Parms.oActor = oActor;
@@ -16829,10 +15195,9 @@ void USFXPowerCustomAction_IncendiaryAmmo::ClientDoCustomActionImpact ( class AA
 
 void USFXPowerCustomAction_IncendiaryAmmo::DoEvolvedAoEImpact ( struct FImpactInfo const& Impact, class USFXGameEffect_IncendiaryAmmo* Effect )
 {
-	static UFunction* pFnDoEvolvedAoEImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoEvolvedAoEImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.DoEvolvedAoEImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoEvolvedAoEImpact )
-		pFnDoEvolvedAoEImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.DoEvolvedAoEImpact" );
+	UFunction* const pFnDoEvolvedAoEImpact = pFnDoEvolvedAoEImpactRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execDoEvolvedAoEImpact_Parms DoEvolvedAoEImpact_Parms;
 	memcpy ( &DoEvolvedAoEImpact_Parms.Impact, &Impact, 0x64 );
@@ -16850,10 +15215,9 @@ void USFXPowerCustomAction_IncendiaryAmmo::DoEvolvedAoEImpact ( struct FImpactIn
 
 void USFXPowerCustomAction_IncendiaryAmmo::SpawnRandomImpactVFX ( class ABioPawn* Pawn, class UParticleSystem* ImpactParticleSystem, class AActor* inInstigator )
 {
-	static UFunction* pFnSpawnRandomImpactVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSpawnRandomImpactVFXRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.SpawnRandomImpactVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSpawnRandomImpactVFX )
-		pFnSpawnRandomImpactVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.SpawnRandomImpactVFX" );
+	UFunction* const pFnSpawnRandomImpactVFX = pFnSpawnRandomImpactVFXRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execSpawnRandomImpactVFX_Parms SpawnRandomImpactVFX_Parms;
 	SpawnRandomImpactVFX_Parms.Pawn = Pawn;
@@ -16871,10 +15235,9 @@ void USFXPowerCustomAction_IncendiaryAmmo::SpawnRandomImpactVFX ( class ABioPawn
 
 void USFXPowerCustomAction_IncendiaryAmmo::SetupEffect ( class USFXGameEffect_AmmoPower* Effect, class ABioPawn* oPawn )
 {
-	static UFunction* pFnSetupEffect = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnSetupEffectRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.SetupEffect", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnSetupEffect )
-		pFnSetupEffect = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.SetupEffect" );
+	UFunction* const pFnSetupEffect = pFnSetupEffectRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execSetupEffect_Parms SetupEffect_Parms;
 	SetupEffect_Parms.Effect = Effect;
@@ -16890,10 +15253,9 @@ void USFXPowerCustomAction_IncendiaryAmmo::SetupEffect ( class USFXGameEffect_Am
 
 class UClass* USFXPowerCustomAction_IncendiaryAmmo::GetDamageType ( )
 {
-	static UFunction* pFnGetDamageType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDamageTypeRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.GetDamageType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDamageType )
-		pFnGetDamageType = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.GetDamageType" );
+	UFunction* const pFnGetDamageType = pFnGetDamageTypeRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execGetDamageType_Parms GetDamageType_Parms;
 
@@ -16910,10 +15272,9 @@ class UClass* USFXPowerCustomAction_IncendiaryAmmo::GetDamageType ( )
 
 void USFXPowerCustomAction_IncendiaryAmmo::ApplyPowerEffects ( class ABioPawn* oPawn, class ASFXWeapon* oWeapon )
 {
-	static UFunction* pFnApplyPowerEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyPowerEffectsRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ApplyPowerEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyPowerEffects )
-		pFnApplyPowerEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ApplyPowerEffects" );
+	UFunction* const pFnApplyPowerEffects = pFnApplyPowerEffectsRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execApplyPowerEffects_Parms ApplyPowerEffects_Parms;
 	ApplyPowerEffects_Parms.oPawn = oPawn;
@@ -16930,10 +15291,9 @@ void USFXPowerCustomAction_IncendiaryAmmo::ApplyPowerEffects ( class ABioPawn* o
 
 void USFXPowerCustomAction_IncendiaryAmmo::PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects )
 {
-	static UFunction* pFnPrecacheVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPrecacheVFXRef { L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.PrecacheVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPrecacheVFX )
-		pFnPrecacheVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.PrecacheVFX" );
+	UFunction* const pFnPrecacheVFX = pFnPrecacheVFXRef.Get ( );
 
 	USFXPowerCustomAction_IncendiaryAmmo_execPrecacheVFX_Parms PrecacheVFX_Parms;
 	PrecacheVFX_Parms.ObjectPool = ObjectPool;
@@ -16944,14 +15304,11 @@ void USFXPowerCustomAction_IncendiaryAmmo::PrecacheVFX ( class ASFXObjectPool* O
 
 
 
-class UClass* USFXGameEffect_WeaponVFXChange::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGameEffect_WeaponVFXChange::pClassPointer { L"Class SFXGameContent.SFXGameEffect_WeaponVFXChange", &UObject::FindClass };
 
 class UClass* USFXGameEffect_WeaponVFXChange::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGameEffect_WeaponVFXChange" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGameEffect_WeaponVFXChange.OnRemoved
@@ -16960,10 +15317,9 @@ class UClass* USFXGameEffect_WeaponVFXChange::StaticClass()
 
 void USFXGameEffect_WeaponVFXChange::OnRemoved ( )
 {
-	static UFunction* pFnOnRemoved = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnRemovedRef { L"Function SFXGameContent.SFXGameEffect_WeaponVFXChange.OnRemoved", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnRemoved )
-		pFnOnRemoved = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_WeaponVFXChange.OnRemoved" );
+	UFunction* const pFnOnRemoved = pFnOnRemovedRef.Get ( );
 
 	USFXGameEffect_WeaponVFXChange_execOnRemoved_Parms OnRemoved_Parms;
 
@@ -16976,10 +15332,9 @@ void USFXGameEffect_WeaponVFXChange::OnRemoved ( )
 
 void USFXGameEffect_WeaponVFXChange::OnApplied ( )
 {
-	static UFunction* pFnOnApplied = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnAppliedRef { L"Function SFXGameContent.SFXGameEffect_WeaponVFXChange.OnApplied", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnApplied )
-		pFnOnApplied = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGameEffect_WeaponVFXChange.OnApplied" );
+	UFunction* const pFnOnApplied = pFnOnAppliedRef.Get ( );
 
 	USFXGameEffect_WeaponVFXChange_execOnApplied_Parms OnApplied_Parms;
 
@@ -16988,26 +15343,20 @@ void USFXGameEffect_WeaponVFXChange::OnApplied ( )
 
 
 
-class UClass* ASFXPawn_Marine::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXPawn_Marine::pClassPointer { L"Class SFXGameContent.SFXPawn_Marine", &UObject::FindClass };
 
 class UClass* ASFXPawn_Marine::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPawn_Marine" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXPowerCustomAction_FragGrenade::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_FragGrenade::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_FragGrenade", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_FragGrenade::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_FragGrenade" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_FragGrenade.PopulatePowerStatBarEvolves
@@ -17016,10 +15365,9 @@ class UClass* USFXPowerCustomAction_FragGrenade::StaticClass()
 
 void USFXPowerCustomAction_FragGrenade::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_FragGrenade_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -17033,10 +15381,9 @@ void USFXPowerCustomAction_FragGrenade::PopulatePowerStatBarEvolves ( )
 
 struct FVector USFXPowerCustomAction_FragGrenade::GetDefaultClientEffectParams ( )
 {
-	static UFunction* pFnGetDefaultClientEffectParams = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDefaultClientEffectParamsRef { L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.GetDefaultClientEffectParams", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDefaultClientEffectParams )
-		pFnGetDefaultClientEffectParams = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.GetDefaultClientEffectParams" );
+	UFunction* const pFnGetDefaultClientEffectParams = pFnGetDefaultClientEffectParamsRef.Get ( );
 
 	USFXPowerCustomAction_FragGrenade_execGetDefaultClientEffectParams_Parms GetDefaultClientEffectParams_Parms;
 
@@ -17052,10 +15399,9 @@ struct FVector USFXPowerCustomAction_FragGrenade::GetDefaultClientEffectParams (
 
 void USFXPowerCustomAction_FragGrenade::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_FragGrenade_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -17070,10 +15416,9 @@ void USFXPowerCustomAction_FragGrenade::RecalculateAllPowerData ( unsigned long
 
 void USFXPowerCustomAction_FragGrenade::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_FragGrenade_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -17093,10 +15438,9 @@ void USFXPowerCustomAction_FragGrenade::EvolvePower ( unsigned char choice )
 
 bool USFXPowerCustomAction_FragGrenade::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerCustomAction_FragGrenade_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -17116,10 +15460,9 @@ bool USFXPowerCustomAction_FragGrenade::OnImpact ( unsigned char Resistance, cla
 
 void USFXPowerCustomAction_FragGrenade::ApplyGrenadeBonus ( )
 {
-	static UFunction* pFnApplyGrenadeBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyGrenadeBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.ApplyGrenadeBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyGrenadeBonus )
-		pFnApplyGrenadeBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.ApplyGrenadeBonus" );
+	UFunction* const pFnApplyGrenadeBonus = pFnApplyGrenadeBonusRef.Get ( );
 
 	USFXPowerCustomAction_FragGrenade_execApplyGrenadeBonus_Parms ApplyGrenadeBonus_Parms;
 
@@ -17133,10 +15476,9 @@ void USFXPowerCustomAction_FragGrenade::ApplyGrenadeBonus ( )
 
 class UClass* USFXPowerCustomAction_FragGrenade::GetDamageType ( )
 {
-	static UFunction* pFnGetDamageType = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetDamageTypeRef { L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.GetDamageType", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetDamageType )
-		pFnGetDamageType = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.GetDamageType" );
+	UFunction* const pFnGetDamageType = pFnGetDamageTypeRef.Get ( );
 
 	USFXPowerCustomAction_FragGrenade_execGetDamageType_Parms GetDamageType_Parms;
 
@@ -17154,10 +15496,9 @@ class UClass* USFXPowerCustomAction_FragGrenade::GetDamageType ( )
 
 float USFXPowerCustomAction_FragGrenade::GetImpactDamage ( class AActor* oImpacted, class UClass** DamageType )
 {
-	static UFunction* pFnGetImpactDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetImpactDamageRef { L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.GetImpactDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetImpactDamage )
-		pFnGetImpactDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.GetImpactDamage" );
+	UFunction* const pFnGetImpactDamage = pFnGetImpactDamageRef.Get ( );
 
 	USFXPowerCustomAction_FragGrenade_execGetImpactDamage_Parms GetImpactDamage_Parms;
 	GetImpactDamage_Parms.oImpacted = oImpacted;
@@ -17182,10 +15523,9 @@ float USFXPowerCustomAction_FragGrenade::GetImpactDamage ( class AActor* oImpact
 
 void USFXPowerCustomAction_FragGrenade::PlayDetonationEffects ( struct FVector const& ImpactLocation, struct FVector const& ImpactNormal, class ASFXProjectile_PowerCustomAction* oProjectile )
 {
-	static UFunction* pFnPlayDetonationEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayDetonationEffectsRef { L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.PlayDetonationEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayDetonationEffects )
-		pFnPlayDetonationEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.PlayDetonationEffects" );
+	UFunction* const pFnPlayDetonationEffects = pFnPlayDetonationEffectsRef.Get ( );
 
 	USFXPowerCustomAction_FragGrenade_execPlayDetonationEffects_Parms PlayDetonationEffects_Parms;
 	memcpy ( &PlayDetonationEffects_Parms.ImpactLocation, &ImpactLocation, 0xC );
@@ -17197,14 +15537,11 @@ void USFXPowerCustomAction_FragGrenade::PlayDetonationEffects ( struct FVector c
 
 
 
-class UClass* USFXPowerCustomAction_Carnage::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_Carnage::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_Carnage", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_Carnage::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_Carnage" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_Carnage.PopulatePowerStatBarEvolves
@@ -17213,10 +15550,9 @@ class UClass* USFXPowerCustomAction_Carnage::StaticClass()
 
 void USFXPowerCustomAction_Carnage::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_Carnage.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Carnage.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_Carnage_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -17230,10 +15566,9 @@ void USFXPowerCustomAction_Carnage::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_Carnage::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Carnage.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Carnage.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_Carnage_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -17250,10 +15585,9 @@ void USFXPowerCustomAction_Carnage::EvolvePower ( unsigned char choice )
 
 bool USFXPowerCustomAction_Carnage::ShouldUsePower ( class AActor* Target, FString* sOptionalInfo )
 {
-	static UFunction* pFnShouldUsePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnShouldUsePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Carnage.ShouldUsePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnShouldUsePower )
-		pFnShouldUsePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Carnage.ShouldUsePower" );
+	UFunction* const pFnShouldUsePower = pFnShouldUsePowerRef.Get ( );
 
 	USFXPowerCustomAction_Carnage_execShouldUsePower_Parms ShouldUsePower_Parms;
 	ShouldUsePower_Parms.Target = Target;
@@ -17278,10 +15612,9 @@ bool USFXPowerCustomAction_Carnage::ShouldUsePower ( class AActor* Target, FStri
 
 void USFXPowerCustomAction_Carnage::PlayDetonationEffects ( struct FVector const& ImpactLocation, struct FVector const& ImpactNormal, class ASFXProjectile_PowerCustomAction* oProjectile )
 {
-	static UFunction* pFnPlayDetonationEffects = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPlayDetonationEffectsRef { L"Function SFXGameContent.SFXPowerCustomAction_Carnage.PlayDetonationEffects", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPlayDetonationEffects )
-		pFnPlayDetonationEffects = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Carnage.PlayDetonationEffects" );
+	UFunction* const pFnPlayDetonationEffects = pFnPlayDetonationEffectsRef.Get ( );
 
 	USFXPowerCustomAction_Carnage_execPlayDetonationEffects_Parms PlayDetonationEffects_Parms;
 	memcpy ( &PlayDetonationEffects_Parms.ImpactLocation, &ImpactLocation, 0xC );
@@ -17299,10 +15632,9 @@ void USFXPowerCustomAction_Carnage::PlayDetonationEffects ( struct FVector const
 
 bool USFXPowerCustomAction_Carnage::GetProjectileAttachPoint ( struct FVector* AttachPoint )
 {
-	static UFunction* pFnGetProjectileAttachPoint = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetProjectileAttachPointRef { L"Function SFXGameContent.SFXPowerCustomAction_Carnage.GetProjectileAttachPoint", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetProjectileAttachPoint )
-		pFnGetProjectileAttachPoint = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Carnage.GetProjectileAttachPoint" );
+	UFunction* const pFnGetProjectileAttachPoint = pFnGetProjectileAttachPointRef.Get ( );
 
 	USFXPowerCustomAction_Carnage_execGetProjectileAttachPoint_Parms GetProjectileAttachPoint_Parms;
 
@@ -17323,10 +15655,9 @@ bool USFXPowerCustomAction_Carnage::GetProjectileAttachPoint ( struct FVector* A
 
 void USFXPowerCustomAction_Carnage::ReleasePower ( )
 {
-	static UFunction* pFnReleasePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnReleasePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Carnage.ReleasePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnReleasePower )
-		pFnReleasePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Carnage.ReleasePower" );
+	UFunction* const pFnReleasePower = pFnReleasePowerRef.Get ( );
 
 	USFXPowerCustomAction_Carnage_execReleasePower_Parms ReleasePower_Parms;
 
@@ -17341,10 +15672,9 @@ void USFXPowerCustomAction_Carnage::ReleasePower ( )
 
 void USFXPowerCustomAction_Carnage::PrecacheVFX ( class ASFXObjectPool* ObjectPool, class URvrClientEffectManager* ClientEffects )
 {
-	static UFunction* pFnPrecacheVFX = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPrecacheVFXRef { L"Function SFXGameContent.SFXPowerCustomAction_Carnage.PrecacheVFX", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPrecacheVFX )
-		pFnPrecacheVFX = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Carnage.PrecacheVFX" );
+	UFunction* const pFnPrecacheVFX = pFnPrecacheVFXRef.Get ( );
 
 	USFXPowerCustomAction_Carnage_execPrecacheVFX_Parms PrecacheVFX_Parms;
 	PrecacheVFX_Parms.ObjectPool = ObjectPool;
@@ -17365,10 +15695,9 @@ void USFXPowerCustomAction_Carnage::PrecacheVFX ( class ASFXObjectPool* ObjectPo
 
 bool USFXPowerCustomAction_Carnage::OnImpact ( unsigned char Resistance, class AActor* oImpacted, int nPreviouslyImpacted, struct FVector const& HitLocation, struct FVector const& HitNormal )
 {
-	static UFunction* pFnOnImpact = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnImpactRef { L"Function SFXGameContent.SFXPowerCustomAction_Carnage.OnImpact", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnImpact )
-		pFnOnImpact = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Carnage.OnImpact" );
+	UFunction* const pFnOnImpact = pFnOnImpactRef.Get ( );
 
 	USFXPowerCustomAction_Carnage_execOnImpact_Parms OnImpact_Parms;
 	OnImpact_Parms.Resistance = Resistance;
@@ -17392,10 +15721,9 @@ bool USFXPowerCustomAction_Carnage::OnImpact ( unsigned char Resistance, class A
 
 float USFXPowerCustomAction_Carnage::GetTotalDamage ( class AActor* oImpacted, unsigned long bIsDamageOverTime, class UClass** DamageType )
 {
-	static UFunction* pFnGetTotalDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetTotalDamageRef { L"Function SFXGameContent.SFXPowerCustomAction_Carnage.GetTotalDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetTotalDamage )
-		pFnGetTotalDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Carnage.GetTotalDamage" );
+	UFunction* const pFnGetTotalDamage = pFnGetTotalDamageRef.Get ( );
 
 	USFXPowerCustomAction_Carnage_execGetTotalDamage_Parms GetTotalDamage_Parms;
 	GetTotalDamage_Parms.oImpacted = oImpacted;
@@ -17421,10 +15749,9 @@ float USFXPowerCustomAction_Carnage::GetTotalDamage ( class AActor* oImpacted, u
 
 float USFXPowerCustomAction_Carnage::GetImpactDamage ( class AActor* oImpacted, class UClass** DamageType )
 {
-	static UFunction* pFnGetImpactDamage = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnGetImpactDamageRef { L"Function SFXGameContent.SFXPowerCustomAction_Carnage.GetImpactDamage", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnGetImpactDamage )
-		pFnGetImpactDamage = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Carnage.GetImpactDamage" );
+	UFunction* const pFnGetImpactDamage = pFnGetImpactDamageRef.Get ( );
 
 	USFXPowerCustomAction_Carnage_execGetImpactDamage_Parms GetImpactDamage_Parms;
 	GetImpactDamage_Parms.oImpacted = oImpacted;
@@ -17453,10 +15780,9 @@ float USFXPowerCustomAction_Carnage::GetImpactDamage ( class AActor* oImpacted,
 
 bool USFXPowerCustomAction_Carnage::DoPowerDetonatedForActor ( class AActor* oActor, struct FVector const& HitLocation, struct FVector const& HitNormal, int nImpactCount, unsigned long bFirstTarget, class ASFXProjectile_PowerCustomAction* oProjectile )
 {
-	static UFunction* pFnDoPowerDetonatedForActor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnDoPowerDetonatedForActorRef { L"Function SFXGameContent.SFXPowerCustomAction_Carnage.DoPowerDetonatedForActor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnDoPowerDetonatedForActor )
-		pFnDoPowerDetonatedForActor = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Carnage.DoPowerDetonatedForActor" );
+	UFunction* const pFnDoPowerDetonatedForActor = pFnDoPowerDetonatedForActorRef.Get ( );
 
 	USFXPowerCustomAction_Carnage_execDoPowerDetonatedForActor_Parms DoPowerDetonatedForActor_Parms;
 	DoPowerDetonatedForActor_Parms.oActor = oActor;
@@ -17473,14 +15799,11 @@ bool USFXPowerCustomAction_Carnage::DoPowerDetonatedForActor ( class AActor* oAc
 
 
 
-class UClass* USFXPowerCustomAction_Fortification::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_Fortification::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_Fortification", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_Fortification::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_Fortification" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_Fortification.PopulatePowerStatBarEvolves
@@ -17489,10 +15812,9 @@ class UClass* USFXPowerCustomAction_Fortification::StaticClass()
 
 void USFXPowerCustomAction_Fortification::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_Fortification.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Fortification.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_Fortification_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -17506,10 +15828,9 @@ void USFXPowerCustomAction_Fortification::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_Fortification::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_Fortification.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Fortification.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_Fortification_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -17524,10 +15845,9 @@ void USFXPowerCustomAction_Fortification::EvolvePower ( unsigned char choice )
 
 void USFXPowerCustomAction_Fortification::RecalculateAllPowerData ( unsigned long bReset )
 {
-	static UFunction* pFnRecalculateAllPowerData = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRecalculateAllPowerDataRef { L"Function SFXGameContent.SFXPowerCustomAction_Fortification.RecalculateAllPowerData", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRecalculateAllPowerData )
-		pFnRecalculateAllPowerData = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Fortification.RecalculateAllPowerData" );
+	UFunction* const pFnRecalculateAllPowerData = pFnRecalculateAllPowerDataRef.Get ( );
 
 	USFXPowerCustomAction_Fortification_execRecalculateAllPowerData_Parms RecalculateAllPowerData_Parms;
 	RecalculateAllPowerData_Parms.bReset = bReset;
@@ -17541,10 +15861,9 @@ void USFXPowerCustomAction_Fortification::RecalculateAllPowerData ( unsigned lon
 
 void USFXPowerCustomAction_Fortification::RemoveArmor ( )
 {
-	static UFunction* pFnRemoveArmor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnRemoveArmorRef { L"Function SFXGameContent.SFXPowerCustomAction_Fortification.RemoveArmor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnRemoveArmor )
-		pFnRemoveArmor = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Fortification.RemoveArmor" );
+	UFunction* const pFnRemoveArmor = pFnRemoveArmorRef.Get ( );
 
 	USFXPowerCustomAction_Fortification_execRemoveArmor_Parms RemoveArmor_Parms;
 
@@ -17557,10 +15876,9 @@ void USFXPowerCustomAction_Fortification::RemoveArmor ( )
 
 void USFXPowerCustomAction_Fortification::StartPowerCooldown ( )
 {
-	static UFunction* pFnStartPowerCooldown = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnStartPowerCooldownRef { L"Function SFXGameContent.SFXPowerCustomAction_Fortification.StartPowerCooldown", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnStartPowerCooldown )
-		pFnStartPowerCooldown = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Fortification.StartPowerCooldown" );
+	UFunction* const pFnStartPowerCooldown = pFnStartPowerCooldownRef.Get ( );
 
 	USFXPowerCustomAction_Fortification_execStartPowerCooldown_Parms StartPowerCooldown_Parms;
 
@@ -17573,10 +15891,9 @@ void USFXPowerCustomAction_Fortification::StartPowerCooldown ( )
 
 void USFXPowerCustomAction_Fortification::ApplyArmor ( )
 {
-	static UFunction* pFnApplyArmor = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyArmorRef { L"Function SFXGameContent.SFXPowerCustomAction_Fortification.ApplyArmor", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyArmor )
-		pFnApplyArmor = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_Fortification.ApplyArmor" );
+	UFunction* const pFnApplyArmor = pFnApplyArmorRef.Get ( );
 
 	USFXPowerCustomAction_Fortification_execApplyArmor_Parms ApplyArmor_Parms;
 
@@ -17585,14 +15902,11 @@ void USFXPowerCustomAction_Fortification::ApplyArmor ( )
 
 
 
-class UClass* USFXPowerCustomAction_JimmyPassive::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXPowerCustomAction_JimmyPassive::pClassPointer { L"Class SFXGameContent.SFXPowerCustomAction_JimmyPassive", &UObject::FindClass };
 
 class UClass* USFXPowerCustomAction_JimmyPassive::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXPowerCustomAction_JimmyPassive" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXPowerCustomAction_JimmyPassive.PopulatePowerStatBarEvolves
@@ -17601,10 +15915,9 @@ class UClass* USFXPowerCustomAction_JimmyPassive::StaticClass()
 
 void USFXPowerCustomAction_JimmyPassive::PopulatePowerStatBarEvolves ( )
 {
-	static UFunction* pFnPopulatePowerStatBarEvolves = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPopulatePowerStatBarEvolvesRef { L"Function SFXGameContent.SFXPowerCustomAction_JimmyPassive.PopulatePowerStatBarEvolves", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPopulatePowerStatBarEvolves )
-		pFnPopulatePowerStatBarEvolves = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_JimmyPassive.PopulatePowerStatBarEvolves" );
+	UFunction* const pFnPopulatePowerStatBarEvolves = pFnPopulatePowerStatBarEvolvesRef.Get ( );
 
 	USFXPowerCustomAction_JimmyPassive_execPopulatePowerStatBarEvolves_Parms PopulatePowerStatBarEvolves_Parms;
 
@@ -17618,10 +15931,9 @@ void USFXPowerCustomAction_JimmyPassive::PopulatePowerStatBarEvolves ( )
 
 void USFXPowerCustomAction_JimmyPassive::EvolvePower ( unsigned char choice )
 {
-	static UFunction* pFnEvolvePower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnEvolvePowerRef { L"Function SFXGameContent.SFXPowerCustomAction_JimmyPassive.EvolvePower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnEvolvePower )
-		pFnEvolvePower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_JimmyPassive.EvolvePower" );
+	UFunction* const pFnEvolvePower = pFnEvolvePowerRef.Get ( );
 
 	USFXPowerCustomAction_JimmyPassive_execEvolvePower_Parms EvolvePower_Parms;
 	EvolvePower_Parms.choice = choice;
@@ -17635,10 +15947,9 @@ void USFXPowerCustomAction_JimmyPassive::EvolvePower ( unsigned char choice )
 
 void USFXPowerCustomAction_JimmyPassive::ResetPower ( )
 {
-	static UFunction* pFnResetPower = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResetPowerRef { L"Function SFXGameContent.SFXPowerCustomAction_JimmyPassive.ResetPower", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResetPower )
-		pFnResetPower = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_JimmyPassive.ResetPower" );
+	UFunction* const pFnResetPower = pFnResetPowerRef.Get ( );
 
 	USFXPowerCustomAction_JimmyPassive_execResetPower_Parms ResetPower_Parms;
 
@@ -17651,10 +15962,9 @@ void USFXPowerCustomAction_JimmyPassive::ResetPower ( )
 
 void USFXPowerCustomAction_JimmyPassive::ApplyGlobalBonus ( )
 {
-	static UFunction* pFnApplyGlobalBonus = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnApplyGlobalBonusRef { L"Function SFXGameContent.SFXPowerCustomAction_JimmyPassive.ApplyGlobalBonus", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnApplyGlobalBonus )
-		pFnApplyGlobalBonus = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXPowerCustomAction_JimmyPassive.ApplyGlobalBonus" );
+	UFunction* const pFnApplyGlobalBonus = pFnApplyGlobalBonusRef.Get ( );
 
 	USFXPowerCustomAction_JimmyPassive_execApplyGlobalBonus_Parms ApplyGlobalBonus_Parms;
 
@@ -17663,50 +15973,38 @@ void USFXPowerCustomAction_JimmyPassive::ApplyGlobalBonus ( )
 
 
 
-class UClass* ASFXProjectile_PowerCustomAction_Carnage::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_PowerCustomAction_Carnage::pClassPointer { L"Class SFXGameContent.SFXProjectile_PowerCustomAction_Carnage", &UObject::FindClass };
 
 class UClass* ASFXProjectile_PowerCustomAction_Carnage::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXProjectile_PowerCustomAction_Carnage" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* ASFXProjectile_PowerCustomAction_FragGrenade::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXProjectile_PowerCustomAction_FragGrenade::pClassPointer { L"Class SFXGameContent.SFXProjectile_PowerCustomAction_FragGrenade", &UObject::FindClass };
 
 class UClass* ASFXProjectile_PowerCustomAction_FragGrenade::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXProjectile_PowerCustomAction_FragGrenade" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXDamageType_Shotgun::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXDamageType_Shotgun::pClassPointer { L"Class SFXGameContent.SFXDamageType_Shotgun", &UObject::FindClass };
 
 class UClass* USFXDamageType_Shotgun::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXDamageType_Shotgun" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* USFXGUI_ShotgunReticle::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> USFXGUI_ShotgunReticle::pClassPointer { L"Class SFXGameContent.SFXGUI_ShotgunReticle", &UObject::FindClass };
 
 class UClass* USFXGUI_ShotgunReticle::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXGUI_ShotgunReticle" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 // Function SFXGameContent.SFXGUI_ShotgunReticle.ResetReticle
@@ -17716,10 +16014,9 @@ class UClass* USFXGUI_ShotgunReticle::StaticClass()
 
 void USFXGUI_ShotgunReticle::eventResetReticle ( unsigned long bUnsubscribe )
 {
-	static UFunction* pFnResetReticle = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnResetReticleRef { L"Function SFXGameContent.SFXGUI_ShotgunReticle.ResetReticle", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnResetReticle )
-		pFnResetReticle = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_ShotgunReticle.ResetReticle" );
+	UFunction* const pFnResetReticle = pFnResetReticleRef.Get ( );
 
 	USFXGUI_ShotgunReticle_eventResetReticle_Parms ResetReticle_Parms;
 	ResetReticle_Parms.bUnsubscribe = bUnsubscribe;
@@ -17734,10 +16031,9 @@ void USFXGUI_ShotgunReticle::eventResetReticle ( unsigned long bUnsubscribe )
 
 void USFXGUI_ShotgunReticle::eventTargetCanHitChanged ( unsigned long bInSights )
 {
-	static UFunction* pFnTargetCanHitChanged = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnTargetCanHitChangedRef { L"Function SFXGameContent.SFXGUI_ShotgunReticle.TargetCanHitChanged", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnTargetCanHitChanged )
-		pFnTargetCanHitChanged = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_ShotgunReticle.TargetCanHitChanged" );
+	UFunction* const pFnTargetCanHitChanged = pFnTargetCanHitChangedRef.Get ( );
 
 	USFXGUI_ShotgunReticle_eventTargetCanHitChanged_Parms TargetCanHitChanged_Parms;
 	TargetCanHitChanged_Parms.bInSights = bInSights;
@@ -17752,10 +16048,9 @@ void USFXGUI_ShotgunReticle::eventTargetCanHitChanged ( unsigned long bInSights
 
 void USFXGUI_ShotgunReticle::eventUpdate ( float fDeltaT )
 {
-	static UFunction* pFnUpdate = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnUpdateRef { L"Function SFXGameContent.SFXGUI_ShotgunReticle.Update", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnUpdate )
-		pFnUpdate = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_ShotgunReticle.Update" );
+	UFunction* const pFnUpdate = pFnUpdateRef.Get ( );
 
 	USFXGUI_ShotgunReticle_eventUpdate_Parms Update_Parms;
 	Update_Parms.fDeltaT = fDeltaT;
@@ -17770,10 +16065,9 @@ void USFXGUI_ShotgunReticle::eventUpdate ( float fDeltaT )
 
 void USFXGUI_ShotgunReticle::eventPerformReticleHide ( unsigned long bInstant )
 {
-	static UFunction* pFnPerformReticleHide = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPerformReticleHideRef { L"Function SFXGameContent.SFXGUI_ShotgunReticle.PerformReticleHide", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPerformReticleHide )
-		pFnPerformReticleHide = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_ShotgunReticle.PerformReticleHide" );
+	UFunction* const pFnPerformReticleHide = pFnPerformReticleHideRef.Get ( );
 
 	USFXGUI_ShotgunReticle_eventPerformReticleHide_Parms PerformReticleHide_Parms;
 	PerformReticleHide_Parms.bInstant = bInstant;
@@ -17788,10 +16082,9 @@ void USFXGUI_ShotgunReticle::eventPerformReticleHide ( unsigned long bInstant )
 
 void USFXGUI_ShotgunReticle::eventPerformReticleShow ( unsigned long bInstant )
 {
-	static UFunction* pFnPerformReticleShow = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnPerformReticleShowRef { L"Function SFXGameContent.SFXGUI_ShotgunReticle.PerformReticleShow", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnPerformReticleShow )
-		pFnPerformReticleShow = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_ShotgunReticle.PerformReticleShow" );
+	UFunction* const pFnPerformReticleShow = pFnPerformReticleShowRef.Get ( );
 
 	USFXGUI_ShotgunReticle_eventPerformReticleShow_Parms PerformReticleShow_Parms;
 	PerformReticleShow_Parms.bInstant = bInstant;
@@ -17805,10 +16098,9 @@ void USFXGUI_ShotgunReticle::eventPerformReticleShow ( unsigned long bInstant )
 
 void USFXGUI_ShotgunReticle::OnReticleLoaded ( )
 {
-	static UFunction* pFnOnReticleLoaded = NULL;
+	static ::LESDK::TStaticRef<UFunction> pFnOnReticleLoadedRef { L"Function SFXGameContent.SFXGUI_ShotgunReticle.OnReticleLoaded", &UObject::FindObject< UFunction > };
 
-	if ( ! pFnOnReticleLoaded )
-		pFnOnReticleLoaded = UObject::FindObject< UFunction > ( L"Function SFXGameContent.SFXGUI_ShotgunReticle.OnReticleLoaded" );
+	UFunction* const pFnOnReticleLoaded = pFnOnReticleLoadedRef.Get ( );
 
 	USFXGUI_ShotgunReticle_execOnReticleLoaded_Parms OnReticleLoaded_Parms;
 
@@ -17817,18 +16109,1080 @@ void USFXGUI_ShotgunReticle::OnReticleLoaded ( )
 
 
 
-class UClass* ASFXWeapon_Shotgun_Katana::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> ASFXWeapon_Shotgun_Katana::pClassPointer { L"Class SFXGameContent.SFXWeapon_Shotgun_Katana", &UObject::FindClass };
 
 class UClass* ASFXWeapon_Shotgun_Katana::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class SFXGameContent.SFXWeapon_Shotgun_Katana" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class SFXGameContent.SFXVocalizationManagerSP",
+	L"Class SFXGameContent.SFXGRISP",
+	L"Class SFXGameContent.SFXGameInfoSP",
+	L"Function SFXGameContent.SFXGameInfoSP.AwardItem",
+	L"Function SFXGameContent.SFXGameInfoSP.AwardCredits",
+	L"Function SFXGameContent.SFXGameInfoSP.AwardCreditPercent",
+	L"Function SFXGameContent.SFXGameInfoSP.AwardXP",
+	L"Function SFXGameContent.SFXGameInfoSP.FindPlayerStart",
+	L"Function SFXGameContent.SFXGameInfoSP.PostBeginPlay",
+	L"Class SFXGameContent.SFXDamageType_AssaultRifle",
+	L"Class SFXGameContent.SFXDamageType_HeavyPistol",
+	L"Class SFXGameContent.SFXDamageType_MattockAssaultRifle",
+	L"Class SFXGameContent.SFXGUI_HeavyWeaponReticle",
+	L"Function SFXGameContent.SFXGUI_HeavyWeaponReticle.TargetCanHitChanged",
+	L"Function SFXGameContent.SFXGUI_HeavyWeaponReticle.WeaponAmmoChanged",
+	L"Function SFXGameContent.SFXGUI_HeavyWeaponReticle.OnReticleLoaded",
+	L"Function SFXGameContent.SFXGUI_HeavyWeaponReticle.PerformReticleHide",
+	L"Function SFXGameContent.SFXGUI_HeavyWeaponReticle.PerformReticleShow",
+	L"Class SFXGameContent.SFXSeqAct_GiveStartingConsumables",
+	L"Function SFXGameContent.SFXSeqAct_GiveStartingConsumables.Activated",
+	L"Class SFXGameContent.SFXSeqAct_OpenWeaponSelection",
+	L"Function SFXGameContent.SFXSeqAct_OpenWeaponSelection.OnMovieClosedDelegate",
+	L"Function SFXGameContent.SFXSeqAct_OpenWeaponSelection.UpdateOp",
+	L"Function SFXGameContent.SFXSeqAct_OpenWeaponSelection.Activated",
+	L"Class SFXGameContent.SFXShield_Energy_Player",
+	L"Class SFXGameContent.SFXWeapon_AssaultRifle_Avenger",
+	L"Class SFXGameContent.SFXWeapon_AssaultRifle_Mattock",
+	L"Class SFXGameContent.SFXWeapon_Heavy_Beam_Base",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.GetAdjustedAim",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.PreCalculateAdjustedAim",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.UpdateBeam",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.ProcessInstantHit",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.CalcFireStart",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.StopFire",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.StartFire",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.Tick",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.SpawnImpactEffects",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.GetWeaponSpecificImpactSound",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.GetWeaponSpecificImpactEffect",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.GetWeaponSpecificDecalData",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.StopMuzzleFlashEffect",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.PlayMuzzleFlashEffect",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.StretchDecal",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.SpawnADecal",
+	L"Function SFXGameContent.SFXWeapon_Heavy_Beam_Base.InitDefaultDecalProperties",
+	L"Class SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon",
+	L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.OutOfAmmo",
+	L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.InitDefaultDecalProperties",
+	L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.Tick",
+	L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.GetWeaponSpecificImpactSound",
+	L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.GetWeaponSpecificImpactEffect",
+	L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.StopMuzzleFlashEffect",
+	L"Function SFXGameContent.SFXWeapon_Heavy_LegionDisinfectionWeapon.StopFireSounds",
+	L"Class SFXGameContent.SFXWeapon_Pistol_Predator",
+	L"Function SFXGameContent.SFXWeapon_Pistol_Predator.GetWeaponSpecificDecalData",
+	L"Class SFXGameContent.SFXTreasureDataLive",
+	L"Class SFXGameContent.SFXCharacterClass_Content",
+	L"Class SFXGameContent.SFXCustomAction_Revive",
+	L"Function SFXGameContent.SFXCustomAction_Revive.BodyStanceAnimEndNotification",
+	L"Function SFXGameContent.SFXCustomAction_Revive.Replicate",
+	L"Function SFXGameContent.SFXCustomAction_Revive.ClientDoCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_Revive.CheckFiring",
+	L"Function SFXGameContent.SFXCustomAction_Revive.TickCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_Revive.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_Revive.Resurrect",
+	L"Function SFXGameContent.SFXCustomAction_Revive.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_Revive.InternalCanDoCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_Reload",
+	L"Function SFXGameContent.SFXCustomAction_Reload.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_Reload.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_Reload.GetUsedAnimNames",
+	L"Class SFXGameContent.SFXCustomAction_ActivateWeaponFlashlight",
+	L"Function SFXGameContent.SFXCustomAction_ActivateWeaponFlashlight.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_ActivateWeaponFlashlight.StartCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_MantleLookAt",
+	L"Function SFXGameContent.SFXCustomAction_MantleLookAt.FlinchActionOverride",
+	L"Function SFXGameContent.SFXCustomAction_MantleLookAt.GetUsedAnimNames",
+	L"Function SFXGameContent.SFXCustomAction_MantleLookAt.GetEndBodyStanceAnim",
+	L"Function SFXGameContent.SFXCustomAction_MantleLookAt.GetLoopBodyStanceAnim",
+	L"Function SFXGameContent.SFXCustomAction_MantleLookAt.GetStartBodyStanceAnim",
+	L"Class SFXGameContent.SFXCustomAction_CoverSlipLookAt",
+	L"Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.FlinchActionOverride",
+	L"Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.GetUsedAnimNames",
+	L"Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.GetEndBodyStanceAnim",
+	L"Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.GetLoopBodyStanceAnim",
+	L"Function SFXGameContent.SFXCustomAction_CoverSlipLookAt.GetStartBodyStanceAnim",
+	L"Class SFXGameContent.SFXCustomAction_StdCoverSlipLookAt",
+	L"Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.FlinchActionOverride",
+	L"Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.GetUsedAnimNames",
+	L"Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.GetEndBodyStanceAnim",
+	L"Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.GetLoopBodyStanceAnim",
+	L"Function SFXGameContent.SFXCustomAction_StdCoverSlipLookAt.GetStartBodyStanceAnim",
+	L"Class SFXGameContent.SFXCustomAction_SwatTurnLookAt",
+	L"Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.FlinchActionOverride",
+	L"Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.GetUsedAnimNames",
+	L"Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.GetEndBodyStanceAnim",
+	L"Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.GetLoopBodyStanceAnim",
+	L"Function SFXGameContent.SFXCustomAction_SwatTurnLookAt.GetStartBodyStanceAnim",
+	L"Class SFXGameContent.SFXCustomAction_StdSwatTurnLookAt",
+	L"Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.FlinchActionOverride",
+	L"Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.GetUsedAnimNames",
+	L"Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.GetEndBodyStanceAnim",
+	L"Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.GetLoopBodyStanceAnim",
+	L"Function SFXGameContent.SFXCustomAction_StdSwatTurnLookAt.GetStartBodyStanceAnim",
+	L"Class SFXGameContent.SFXCustomAction_GapJump",
+	L"Function SFXGameContent.SFXCustomAction_GapJump.NotifyBump",
+	L"Function SFXGameContent.SFXCustomAction_GapJump.EndThisCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_GapJump.RemoveBlockingEndPoints",
+	L"Function SFXGameContent.SFXCustomAction_GapJump.BlockMoveEndPoints",
+	L"Function SFXGameContent.SFXCustomAction_GapJump.BodyStanceAnimEndNotification",
+	L"Function SFXGameContent.SFXCustomAction_GapJump.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_GapJump.StartAnimation",
+	L"Function SFXGameContent.SFXCustomAction_GapJump.ReachedPrecisePosition",
+	L"Function SFXGameContent.SFXCustomAction_GapJump.AlignmentTimeout",
+	L"Function SFXGameContent.SFXCustomAction_GapJump.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_GapJump.GetUsedAnimNames",
+	L"Class SFXGameContent.SFXCustomAction_StandingGapJump",
+	L"Class SFXGameContent.SFXCustomAction_JumpDown",
+	L"Function SFXGameContent.SFXCustomAction_JumpDown.TickInput",
+	L"Function SFXGameContent.SFXCustomAction_JumpDown.PlayStartAnimation",
+	L"Class SFXGameContent.SFXCustomAction_PlayerMantleOverCover",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.GetEndAnim",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.GetLoopAnim",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.GetStartAnim",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.GetUsedAnimNames",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.BodyStanceAnimEndNotification",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.TickCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleOverCover.StartCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_PlayerMantleUp",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.ClientDoCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.ServerStartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.Replicate",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.GetBodyStanceAnim",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.InternalCanDoCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerMantleUp.GetUsedAnimNames",
+	L"Class SFXGameContent.SFXCustomAction_SimpleMoveBase",
+	L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.ClientDoCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.Replicate",
+	L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.CanBeInterrupted",
+	L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.DestTimeout",
+	L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.BodyStanceAnimEndNotification",
+	L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.PlayStartAnimation",
+	L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.GetBodyStanceAnim",
+	L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.InternalCanDoCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.RemoveBlockingEndPoints",
+	L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.BlockMoveEndPoints",
+	L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.ReachedPrecisePosition",
+	L"Function SFXGameContent.SFXCustomAction_SimpleMoveBase.GetUsedAnimNames",
+	L"Class SFXGameContent.SFXCustomAction_PlayerCoverSlipLeft",
+	L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipLeft.EndThisCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipLeft.StartCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_PlayerCoverSlipLeftStanding",
+	L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipLeftStanding.EndThisCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipLeftStanding.StartCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_PlayerCoverSlipRight",
+	L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipRight.EndThisCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipRight.StartCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_PlayerCoverSlipRightStanding",
+	L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipRightStanding.EndThisCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerCoverSlipRightStanding.StartCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_PlayerLadderClimbUp",
+	L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.PreAlignPawnLocation",
+	L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.SetMoveStage",
+	L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.TickCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.SyncRotation",
+	L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.SyncJumpEntrance",
+	L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.TickAlignment",
+	L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.TickInput",
+	L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbUp.GetUsedAnimNames",
+	L"Class SFXGameContent.SFXCustomAction_PlayerLadderClimbDown",
+	L"Function SFXGameContent.SFXCustomAction_PlayerLadderClimbDown.TickInput",
+	L"Class SFXGameContent.SFXCustomAction_PlayerEvadeLeft",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeLeft.RollOverride",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeLeft.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeLeft.InternalCanDoCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_PlayerEvadeRight",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeRight.RollOverride",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeRight.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeRight.InternalCanDoCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_PlayerEvadeForward",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.ClientDoCustomActionImpact",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.RollOverride",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.TurnOnHitWall",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.NotifyHitWall",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.EndThisCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.SyncRotation",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeForward.InternalCanDoCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_PlayerEvadeBackwards",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.ClientDoCustomActionImpact",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.RollOverride",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PlayerEvadeBackwards.InternalCanDoCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_MantleMelee",
+	L"Function SFXGameContent.SFXCustomAction_MantleMelee.EndThisCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_MantleMelee.Breakout",
+	L"Function SFXGameContent.SFXCustomAction_MantleMelee.NotifyBump",
+	L"Function SFXGameContent.SFXCustomAction_MantleMelee.ClientDoCustomActionImpact",
+	L"Function SFXGameContent.SFXCustomAction_MantleMelee.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_MantleMelee.StartCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_SyncCoverGrab",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.NonSyncedAction",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.SyncAttack",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.GetVictimAnim",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.GetAttackerAnim",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.GetVictimPawn",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.ShouldPlayMirrorAnim",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.VerifyVictimDestIsClear",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.InternalCanDoCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverGrab.StartMeleeAttack",
+	L"Class SFXGameContent.SFXCustomAction_SyncCoverMelee",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverMelee.MeleeImpact",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverMelee.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverMelee.EndThisCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverMelee.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_SyncCoverMelee.GetUsedAnimNames",
+	L"Class SFXGameContent.SFXCustomAction_StdCoverMeleeLeft",
+	L"Class SFXGameContent.SFXCustomAction_CoverMeleeLeft",
+	L"Function SFXGameContent.SFXCustomAction_CoverMeleeLeft.NonSyncedAction",
+	L"Class SFXGameContent.SFXCustomAction_CoverMeleeRight",
+	L"Function SFXGameContent.SFXCustomAction_CoverMeleeRight.GetVictimPawn",
+	L"Function SFXGameContent.SFXCustomAction_CoverMeleeRight.GetMeleeImpactParameters",
+	L"Function SFXGameContent.SFXCustomAction_CoverMeleeRight.NonSyncedAction",
+	L"Class SFXGameContent.SFXCustomAction_StdCoverMeleeRight",
+	L"Class SFXGameContent.SFXCustomAction_HvyStdCoverMeleeLeft",
+	L"Class SFXGameContent.SFXCustomAction_HvyCoverMeleeLeft",
+	L"Function SFXGameContent.SFXCustomAction_HvyCoverMeleeLeft.NonSyncedAction",
+	L"Class SFXGameContent.SFXCustomAction_HvyCoverMeleeRight",
+	L"Function SFXGameContent.SFXCustomAction_HvyCoverMeleeRight.GetVictimPawn",
+	L"Function SFXGameContent.SFXCustomAction_HvyCoverMeleeRight.GetMeleeImpactParameters",
+	L"Function SFXGameContent.SFXCustomAction_HvyCoverMeleeRight.NonSyncedAction",
+	L"Class SFXGameContent.SFXCustomAction_HvyStdCoverMeleeRight",
+	L"Class SFXGameContent.SFXCustomAction_RifleMeleeOne",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.StopMove",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.OnActorImpacted",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.ReplicateImpact",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.EndAction",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.HeavyMelee",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.NoHeavyMelee",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.DoRifleMeleeTwo",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.RifleMeleeSecondary",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeOne.StartCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_RifleMeleeTwo",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.ReplicateImpact",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.HeavyMelee",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.NoHeavyMelee",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.DoRifleMeleeThree",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeTwo.RifleMeleeThird",
+	L"Class SFXGameContent.SFXCustomAction_RifleMeleeThree",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeThree.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeThree.HeavyMelee",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeThree.NoHeavyMelee",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeThree.RifleMeleeThird",
+	L"Function SFXGameContent.SFXCustomAction_RifleMeleeThree.ReplicateImpact",
+	L"Class SFXGameContent.SFXCustomAction_PistolMeleeOne",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.StopMove",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.OnActorImpacted",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.ReplicateImpact",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.EndAction",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.HeavyMelee",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.NoHeavyMelee",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.DoPistolMeleeTwo",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.PistolMeleeSecondary",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeOne.StartCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_PistolMeleeTwo",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.ReplicateImpact",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.HeavyMelee",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.NoHeavyMelee",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.DoPistolMeleeThree",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeTwo.PistolMeleeThird",
+	L"Class SFXGameContent.SFXCustomAction_PistolMeleeThree",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeThree.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeThree.HeavyMelee",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeThree.NoHeavyMelee",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeThree.PistolMeleeThird",
+	L"Function SFXGameContent.SFXCustomAction_PistolMeleeThree.ReplicateImpact",
+	L"Class SFXGameContent.SFXCustomAction_PlayerStandardImpact",
+	L"Class SFXGameContent.SFXCustomAction_PlayerStandardImpactForward",
+	L"Class SFXGameContent.SFXCustomAction_PlayerStandardImpactLeft",
+	L"Class SFXGameContent.SFXCustomAction_PlayerStandardImpactRight",
+	L"Class SFXGameContent.SFXCustomAction_PlayerMeleed",
+	L"Class SFXGameContent.SFXCustomAction_KnockbackImpactForward",
+	L"Class SFXGameContent.SFXCustomAction_MeleedLeft",
+	L"Class SFXGameContent.SFXCustomAction_MeleedRight",
+	L"Class SFXGameContent.SFXCustomAction_KnockbackImpact",
+	L"Class SFXGameContent.SFXCustomAction_KnockbackImpactLeft",
+	L"Class SFXGameContent.SFXCustomAction_KnockbackImpactRight",
+	L"Class SFXGameContent.SFXCustomAction_MeleedForward",
+	L"Class SFXGameContent.SFXCustomAction_FlinchLight",
+	L"Class SFXGameContent.SFXCustomAction_FlinchBase",
+	L"Function SFXGameContent.SFXCustomAction_FlinchBase.PlayImpactSound",
+	L"Function SFXGameContent.SFXCustomAction_FlinchBase.PlayWhizSound",
+	L"Function SFXGameContent.SFXCustomAction_FlinchBase.FlinchActionOverride",
+	L"Function SFXGameContent.SFXCustomAction_FlinchBase.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_FlinchBase.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_FlinchBase.GetBodyStanceAnim",
+	L"Function SFXGameContent.SFXCustomAction_FlinchBase.InternalCanDoCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_FlinchBase.GetUsedAnimNames",
+	L"Class SFXGameContent.SFXCustomAction_FlinchHeavy",
+	L"Class SFXGameContent.SFXCustomAction_PlayerOnFire",
+	L"Class SFXGameContent.SFXCharacterClass_Adept",
+	L"Class SFXGameContent.SFXPowerCustomAction_Shockwave",
+	L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.ApplyBonus",
+	L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.ShouldUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.OnRagdollPhysicsImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.ClientDoPowerSubsequentImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.DoSubsequentImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.DoImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.OnPowerDetonated",
+	L"Function SFXGameContent.SFXPowerCustomAction_Shockwave.ReleaseProjectilePower",
+	L"Class SFXGameContent.SFXPowerCustomAction_BioticGrenade",
+	L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.GetDefaultClientEffectParams",
+	L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.ResetPower",
+	L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.OnImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.SpawnChildProjectiles",
+	L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.ReleasePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.ApplyGrenadeBonus",
+	L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.GetDamageType",
+	L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.GetImpactDamage",
+	L"Function SFXGameContent.SFXPowerCustomAction_BioticGrenade.PlayDetonationEffects",
+	L"Class SFXGameContent.SFXPowerCustomAction_GrenadeBase",
+	L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.GetHUDWheelIconInfo",
+	L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.ShouldUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.GetGrenadeCount",
+	L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.AdjustGrenadeCount",
+	L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.ReleasePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.CanUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.ApplyGrenadeBonus",
+	L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.ResetPower",
+	L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.OnSquadMemberAdded",
+	L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.OnPowerRankIncreased",
+	L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.OnPowerAdded",
+	L"Function SFXGameContent.SFXPowerCustomAction_GrenadeBase.OnPowersLoaded",
+	L"Class SFXGameContent.SFXPowerCustomAction_Throw",
+	L"Function SFXGameContent.SFXPowerCustomAction_Throw.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_Throw.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Throw.ShouldUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Throw.OnRagdollPhysicsImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Throw.ResetPower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Throw.OnImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Throw.GetImpactForce",
+	L"Class SFXGameContent.SFXPowerCustomAction_MultiProjectile",
+	L"Function SFXGameContent.SFXPowerCustomAction_MultiProjectile.FindSecondTarget",
+	L"Function SFXGameContent.SFXPowerCustomAction_MultiProjectile.ReleaseSecondProjectile",
+	L"Function SFXGameContent.SFXPowerCustomAction_MultiProjectile.ReleasePower",
+	L"Class SFXGameContent.SFXPowerCustomAction_Pull",
+	L"Function SFXGameContent.SFXPowerCustomAction_Pull.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_Pull.ApplyBonus",
+	L"Function SFXGameContent.SFXPowerCustomAction_Pull.ResetPower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Pull.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_Pull.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Pull.ShouldUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Pull.OnRagdollPhysicsImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Pull.DropCurrentTargets",
+	L"Function SFXGameContent.SFXPowerCustomAction_Pull.OnImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Pull.GetImpactForce",
+	L"Function SFXGameContent.SFXPowerCustomAction_Pull.StartPower",
+	L"Class SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive",
+	L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.ApplyBonus",
+	L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.OnHeavyMeleeKill",
+	L"Function SFXGameContent.SFXPowerCustomAction_AdeptMeleePassive.ApplyGlobalBonus",
+	L"Class SFXGameContent.SFXPowerCustomAction_Warp",
+	L"Function SFXGameContent.SFXPowerCustomAction_Warp.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_Warp.ApplyBonus",
+	L"Function SFXGameContent.SFXPowerCustomAction_Warp.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_Warp.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Warp.ShouldUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Warp.PlayImpactEffects",
+	L"Function SFXGameContent.SFXPowerCustomAction_Warp.OnImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Warp.GetTotalDamage",
+	L"Function SFXGameContent.SFXPowerCustomAction_Warp.GetImpactDamage",
+	L"Class SFXGameContent.SFXPowerCustomAction_Singularity",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.CombatEnded",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnOwnerDestroyed",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.DoJoinInProgress",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ClientDoPowerSubsequentImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ApplyBonus",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ShouldUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnPowerRankIncreased",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnRagdollPhysicsImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.SpawnSingularityVFX",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.SpawnSingularity",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnExplosionImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.SingularityExplosion",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.Internal_TurnOffSingularity",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.TurnOffSingularity",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.CanPutInSingularity",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnGameEffectEnded",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ImpactNewTarget",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ApplyBioticComboEffect",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.TickCustomAction",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ClientDoCustomActionImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnPowerDetonated",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.ReleasePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.GetImpactForce",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.StartCustomAction",
+	L"Function SFXGameContent.SFXPowerCustomAction_Singularity.OnPowersLoaded",
+	L"Class SFXGameContent.SFXPowerCustomAction_AdeptPassive",
+	L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.OnBioticCombo",
+	L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.ResetPower",
+	L"Function SFXGameContent.SFXPowerCustomAction_AdeptPassive.ApplyGlobalBonus",
+	L"Class SFXGameContent.SFXPowerCustomAction_Unity",
+	L"Function SFXGameContent.SFXPowerCustomAction_Unity.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_Unity.GetHUDWheelIconInfo",
+	L"Function SFXGameContent.SFXPowerCustomAction_Unity.CountMediGel",
+	L"Function SFXGameContent.SFXPowerCustomAction_Unity.ShouldUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Unity.OnImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Unity.StartPower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Unity.CanUsePower",
+	L"Class SFXGameContent.SFXCustomAction_AdeptPunch",
+	L"Function SFXGameContent.SFXCustomAction_AdeptPunch.StopMove",
+	L"Function SFXGameContent.SFXCustomAction_AdeptPunch.OnActorImpacted",
+	L"Class SFXGameContent.SFXCustomAction_AdeptSyncCoverGrab",
+	L"Class SFXGameContent.SFXDamageType_AdeptHeavyMelee",
+	L"Class SFXGameContent.SFXSeqEvt_PerformedMeleeOverCover",
+	L"Class SFXGameContent.SFXCustomAction_Meleed",
+	L"Class SFXGameContent.SFXGameEffect_DisableAI",
+	L"Function SFXGameContent.SFXGameEffect_DisableAI.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_DisableAI.OnApplied",
+	L"Class SFXGameContent.SFXCustomAction_PlayerKnockbackImpact",
+	L"Class SFXGameContent.SFXCustomAction_PlayerStaggerImpact",
+	L"Class SFXGameContent.SFXDamageType_AdeptHeavyMelee_NoRagdoll",
+	L"Class SFXGameContent.SFXDamageType_BioticExplosion",
+	L"Class SFXGameContent.SFXDamageType_BioticExplosion_NoRagdoll",
+	L"Class SFXGameContent.SFXDamageType_BioticGrenade",
+	L"Class SFXGameContent.SFXDamageType_BioticGrenade_NoRagdoll",
+	L"Class SFXGameContent.SFXDamageType_CryoExplosion",
+	L"Class SFXGameContent.SFXDamageType_ElectricCombo",
+	L"Class SFXGameContent.SFXDamageType_FireExplosion",
+	L"Class SFXGameContent.SFXDamageType_Warp",
+	L"Class SFXGameContent.SFXDamageType_ImprovedWarp",
+	L"Class SFXGameContent.SFXDamageType_WarpDoT",
+	L"Class SFXGameContent.SFXDamageType_ImprovedWarpDoT",
+	L"Class SFXGameContent.SFXDamageType_Pull",
+	L"Class SFXGameContent.SFXDamageType_Pull_DoT",
+	L"Class SFXGameContent.SFXDamageType_Shockwave",
+	L"Class SFXGameContent.SFXDamageType_Shockwave_NoRagdoll",
+	L"Class SFXGameContent.SFXDamageType_Singularity",
+	L"Class SFXGameContent.SFXDamageType_Singularity_DoT",
+	L"Class SFXGameContent.SFXDamageType_Singularity_Explosion",
+	L"Class SFXGameContent.SFXDamageType_Singularity_NoRagdoll",
+	L"Class SFXGameContent.SFXDamageType_Throw",
+	L"Class SFXGameContent.SFXGameEffect_AntiGravity",
+	L"Function SFXGameContent.SFXGameEffect_AntiGravity.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_AntiGravity.OnApplied",
+	L"Class SFXGameContent.SFXGameEffect_ArmorWeakness",
+	L"Function SFXGameContent.SFXGameEffect_ArmorWeakness.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_ArmorWeakness.OnApplied",
+	L"Class SFXGameContent.SFXGameEffect_BioticPowerDamageTakenBonus",
+	L"Function SFXGameContent.SFXGameEffect_BioticPowerDamageTakenBonus.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_BioticPowerDamageTakenBonus.OnApplied",
+	L"Class SFXGameContent.SFXGameEffect_CryoFreeze",
+	L"Function SFXGameContent.SFXGameEffect_CryoFreeze.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_CryoFreeze.OnUpdate",
+	L"Function SFXGameContent.SFXGameEffect_CryoFreeze.OnApplied",
+	L"Function SFXGameContent.SFXGameEffect_CryoFreeze.OnFrozenPawnDied",
+	L"Class SFXGameContent.SFXGameEffect_DamageImmunity",
+	L"Function SFXGameContent.SFXGameEffect_DamageImmunity.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_DamageImmunity.OnApplied",
+	L"Class SFXGameContent.SFXGameEffect_DelayedCryoFreeze",
+	L"Function SFXGameContent.SFXGameEffect_DelayedCryoFreeze.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_DelayedCryoFreeze.OnUpdate",
+	L"Function SFXGameContent.SFXGameEffect_DelayedCryoFreeze.OnApplied",
+	L"Function SFXGameContent.SFXGameEffect_DelayedCryoFreeze.OnFrozenPawnDied",
+	L"Class SFXGameContent.SFXGameEffect_PowerCombo_Cryo",
+	L"Function SFXGameContent.SFXGameEffect_PowerCombo_Cryo.OnImpact",
+	L"Class SFXGameContent.SFXGameEffect_ElectricComboBeam",
+	L"Function SFXGameContent.SFXGameEffect_ElectricComboBeam.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_ElectricComboBeam.OnUpdate",
+	L"Function SFXGameContent.SFXGameEffect_ElectricComboBeam.PlayBeamEffect",
+	L"Function SFXGameContent.SFXGameEffect_ElectricComboBeam.OnApplied",
+	L"Class SFXGameContent.SFXGameEffect_FireDamageOverTime",
+	L"Function SFXGameContent.SFXGameEffect_FireDamageOverTime.DoDamage",
+	L"Function SFXGameContent.SFXGameEffect_FireDamageOverTime.AddFireDamage",
+	L"Function SFXGameContent.SFXGameEffect_FireDamageOverTime.OnApplied",
+	L"Class SFXGameContent.SFXGameEffect_PowerCombo_Fire",
+	L"Function SFXGameContent.SFXGameEffect_PowerCombo_Fire.OnImpact",
+	L"Function SFXGameContent.SFXGameEffect_PowerCombo_Fire.OnPowerComboDetonated",
+	L"Class SFXGameContent.SFXGameEffect_HealShieldOverTime",
+	L"Function SFXGameContent.SFXGameEffect_HealShieldOverTime.OnUpdate",
+	L"Class SFXGameContent.SFXGameEffect_MaxGrenadeBonus",
+	L"Function SFXGameContent.SFXGameEffect_MaxGrenadeBonus.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_MaxGrenadeBonus.OnApplied",
+	L"Class SFXGameContent.SFXGameEffect_PowerCombo_Biotic",
+	L"Function SFXGameContent.SFXGameEffect_PowerCombo_Biotic.OnPowerComboDetonated",
+	L"Class SFXGameContent.SFXShake_Power_BioticCombo",
+	L"Class SFXGameContent.SFXRumble_Power_BioticCombo",
+	L"Class SFXGameContent.SFXShake_Power_CryoCombo",
+	L"Class SFXGameContent.SFXRumble_Power_CryoCombo",
+	L"Class SFXGameContent.SFXGameEffect_PowerCombo_Electric",
+	L"Function SFXGameContent.SFXGameEffect_PowerCombo_Electric.OnImpact",
+	L"Class SFXGameContent.SFXShake_Power_ElectricCombo",
+	L"Class SFXGameContent.SFXRumble_Power_ElectricCombo",
+	L"Class SFXGameContent.SFXShake_Power_FireCombo",
+	L"Class SFXGameContent.SFXRumble_Power_FireCombo",
+	L"Class SFXGameContent.SFXGameEffect_Pull",
+	L"Function SFXGameContent.SFXGameEffect_Pull.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_Pull.MoveActor",
+	L"Function SFXGameContent.SFXGameEffect_Pull.OnUpdate",
+	L"Function SFXGameContent.SFXGameEffect_Pull.OnApplied",
+	L"Class SFXGameContent.SFXGameEffect_Ragdoll",
+	L"Function SFXGameContent.SFXGameEffect_Ragdoll.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_Ragdoll.OnApplied",
+	L"Class SFXGameContent.SFXGameEffect_ShockwaveLift",
+	L"Function SFXGameContent.SFXGameEffect_ShockwaveLift.HasOtherGravityEffects",
+	L"Function SFXGameContent.SFXGameEffect_ShockwaveLift.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_ShockwaveLift.OnUpdate",
+	L"Function SFXGameContent.SFXGameEffect_ShockwaveLift.OnApplied",
+	L"Class SFXGameContent.SFXGameEffect_Singularity",
+	L"Function SFXGameContent.SFXGameEffect_Singularity.OutOfRangeCheck",
+	L"Function SFXGameContent.SFXGameEffect_Singularity.IsStillInSingularity",
+	L"Function SFXGameContent.SFXGameEffect_Singularity.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_Singularity.AddForceToActor",
+	L"Function SFXGameContent.SFXGameEffect_Singularity.InitialMovement",
+	L"Function SFXGameContent.SFXGameEffect_Singularity.UpdateActor",
+	L"Function SFXGameContent.SFXGameEffect_Singularity.OnApplied",
+	L"Class SFXGameContent.SFXGameEffect_Stasis",
+	L"Function SFXGameContent.SFXGameEffect_Stasis.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_Stasis.UnStasisTarget",
+	L"Function SFXGameContent.SFXGameEffect_Stasis.OnUpdate",
+	L"Function SFXGameContent.SFXGameEffect_Stasis.NullVelocity",
+	L"Function SFXGameContent.SFXGameEffect_Stasis.StartCrustVFX",
+	L"Function SFXGameContent.SFXGameEffect_Stasis.OnApplied",
+	L"Class SFXGameContent.SFXPowerCustomAction_Stasis",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ShouldUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.OnGameEffectEnded",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.OnOwnerDestroyed",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.DoJoinInProgress",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.UnStasisCurrentTargets",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ClientImpactClearEffects",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ImpactStasis",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ImpactPushAway",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.OnImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.TickCustomAction",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ClientEndStasisEffect",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ClientDoCustomActionImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.ClientDoPowerSubsequentImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.StopStasisBubble",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.StartStasisBubbleVFX",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.OnPowerDetonated",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.StartPowerCooldown",
+	L"Function SFXGameContent.SFXPowerCustomAction_Stasis.StartCustomAction",
+	L"Class SFXGameContent.SFXGameEffect_WeaponDamageTakenBonus",
+	L"Function SFXGameContent.SFXGameEffect_WeaponDamageTakenBonus.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_WeaponDamageTakenBonus.OnApplied",
+	L"Class SFXGameContent.SFXGameEffect_WeightCapacity",
+	L"Function SFXGameContent.SFXGameEffect_WeightCapacity.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_WeightCapacity.OnApplied",
+	L"Class SFXGameContent.SFXPlaceable",
+	L"Function SFXGameContent.SFXPlaceable.ActivatePlaceable",
+	L"Function SFXGameContent.SFXPlaceable.DeactivatePlaceable",
+	L"Function SFXGameContent.SFXPlaceable.AllowPlaceableDamageEvents",
+	L"Function SFXGameContent.SFXPlaceable.ImpactWithPower",
+	L"Function SFXGameContent.SFXPlaceable.AreaDamage",
+	L"Function SFXGameContent.SFXPlaceable.AreaDamageForActor",
+	L"Function SFXGameContent.SFXPlaceable.PlaceableDestroyed",
+	L"Function SFXGameContent.SFXPlaceable.ResetPlaceable",
+	L"Function SFXGameContent.SFXPlaceable.ReplicatedEvent",
+	L"Class SFXGameContent.SFXSeqEvt_PlaceableReset",
+	L"Class SFXGameContent.SFXSeqEvt_PlaceableDestroyed",
+	L"Class SFXGameContent.SFXSeqEvt_PlaceableDeactivated",
+	L"Class SFXGameContent.SFXSeqEvt_PlaceableActivated",
+	L"Class SFXGameContent.SFXProjectile_PowerCustomAction_BioticGrenade",
+	L"Class SFXGameContent.SFXRumble_Power_FragGrenade",
+	L"Class SFXGameContent.SFXShake_Power_FragGrenade",
+	L"Class SFXGameContent.SFXProjectile_PowerCustomAction_SuperSeeking",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_SuperSeeking.InitializeRotation",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_SuperSeeking.TickAimRotation",
+	L"Class SFXGameContent.SFXProjectile_PowerCustomAction_Seeking",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.Tick_Prediction",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.Recycle",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.InitializeRotation",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.InitializePowerProjectile",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.PawnEvadedPower",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.CanLockOn",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.Tick",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.TickAimRotation",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.TickAim",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.GetAimLocation",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.Timer",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Seeking.ReplicatedEvent",
+	L"Class SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.ReplicateExplode",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.Tick",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.InitializePowerProjectile",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.ProcessTouch",
+	L"Function SFXGameContent.SFXProjectile_PowerCustomAction_Shockwave.HitWall",
+	L"Class SFXGameContent.SFXRumble_Power_HeavyImpact",
+	L"Class SFXGameContent.SFXShake_Power_Shockwave",
+	L"Class SFXGameContent.SFXShake_Power_HeavyImpact",
+	L"Class SFXGameContent.SFXShield_Biotic_Player",
+	L"Class SFXGameContent.SFXGameEffect_ConstraintDmgBonus",
+	L"Function SFXGameContent.SFXGameEffect_ConstraintDmgBonus.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_ConstraintDmgBonus.OnApplied",
+	L"Class SFXGameContent.SFXGameEffect_HealthPercentBonus",
+	L"Class SFXGameContent.SFXGameEffect_MeleeDamageBonus",
+	L"Class SFXGameContent.SFXGameEffect_PartBasedArmor_HealthBonus",
+	L"Class SFXGameContent.SFXGameEffect_PowerBonus_Cooldown",
+	L"Class SFXGameContent.SFXGameEffect_PowerBonus_Damage",
+	L"Class SFXGameContent.SFXGameEffect_ShieldPercentBonus",
+	L"Class SFXGameContent.SFXGameEffect_SpareAmmo",
+	L"Function SFXGameContent.SFXGameEffect_SpareAmmo.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_SpareAmmo.OnApplied",
+	L"Class SFXGameContent.SFXDamageType_SniperRifle",
+	L"Class SFXGameContent.SFXGUI_StandardSniperZoomReticle",
+	L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.ZoomChanged",
+	L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.WeaponAmmoChanged",
+	L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.DistanceToTargetChanged",
+	L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.OnReticleLoaded",
+	L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.PerformReticleHide",
+	L"Function SFXGameContent.SFXGUI_StandardSniperZoomReticle.PerformReticleShow",
+	L"Class SFXGameContent.SFXWeapon_SniperRifle_Mantis",
+	L"Class SFXGameContent.SFXDamageType_AutoPistol",
+	L"Class SFXGameContent.SFXWeapon_SMG_Shuriken",
+	L"Function SFXGameContent.SFXWeapon_SMG_Shuriken.GetWeaponSpecificDecalData",
+	L"Class SFXGameContent.SFXSeqAct_EndObjective",
+	L"Function SFXGameContent.SFXSeqAct_EndObjective.GetObjClassVersion",
+	L"Function SFXGameContent.SFXSeqAct_EndObjective.Activated",
+	L"Class SFXGameContent.SFXSeqAct_SetObjective",
+	L"Function SFXGameContent.SFXSeqAct_SetObjective.GetObjClassVersion",
+	L"Function SFXGameContent.SFXSeqAct_SetObjective.Activated",
+	L"Class SFXGameContent.SFXSeqAct_ToggleTutorialTracking",
+	L"Function SFXGameContent.SFXSeqAct_ToggleTutorialTracking.Activated",
+	L"Class SFXGameContent.BioPlaypenVolumeAdditive",
+	L"Function SFXGameContent.BioPlaypenVolumeAdditive.UnTouch",
+	L"Function SFXGameContent.BioPlaypenVolumeAdditive.Touch",
+	L"Class SFXGameContent.SFXAI_Trooper",
+	L"Function SFXGameContent.SFXAI_Trooper.DrawDifficulty",
+	L"Function SFXGameContent.SFXAI_Trooper.Initialize",
+	L"Function SFXGameContent.SFXAI_Trooper.OnShouldThrowGrenade",
+	L"Function SFXGameContent.SFXAI_Trooper.ShouldUseGrenade",
+	L"Class SFXGameContent.SFXAICmd_Base_Trooper",
+	L"Class SFXGameContent.SFXAICmd_Base_Cover",
+	L"Function SFXGameContent.SFXAICmd_Base_Cover.NotifyMoodChange",
+	L"Function SFXGameContent.SFXAICmd_Base_Cover.NotifyPendingPowerImpact",
+	L"Function SFXGameContent.SFXAICmd_Base_Cover.NotifyTakeHit",
+	L"Function SFXGameContent.SFXAICmd_Base_Cover.ShouldAttack",
+	L"Function SFXGameContent.SFXAICmd_Base_Cover.Resumed",
+	L"Function SFXGameContent.SFXAICmd_Base_Cover.Pushed",
+	L"Class SFXGameContent.SFXAICmd_Reaction_ShotInCover",
+	L"Class SFXGameContent.SFXAmmoContainer",
+	L"Function SFXGameContent.SFXAmmoContainer.ReplicatedEvent",
+	L"Function SFXGameContent.SFXAmmoContainer.GiveTo",
+	L"Function SFXGameContent.SFXAmmoContainer.StartSleeping",
+	L"Function SFXGameContent.SFXAmmoContainer.SetRespawn",
+	L"Function SFXGameContent.SFXAmmoContainer.SetInitialState",
+	L"Class SFXGameContent.SFXCustomAction_AILadderClimbDown",
+	L"Class SFXGameContent.SFXCustomAction_AILadderClimbUp",
+	L"Function SFXGameContent.SFXCustomAction_AILadderClimbUp.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_AILadderClimbUp.StartCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_AIMantleOverCover",
+	L"Class SFXGameContent.SFXCustomAction_AIMantleUp",
+	L"Function SFXGameContent.SFXCustomAction_AIMantleUp.GetBodyStanceAnim",
+	L"Function SFXGameContent.SFXCustomAction_AIMantleUp.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_AIMantleUp.GetUsedAnimNames",
+	L"Class SFXGameContent.SFXCustomAction_AISwatTurnLeft",
+	L"Class SFXGameContent.SFXCustomAction_AISwatTurnRight",
+	L"Class SFXGameContent.SFXCustomAction_AnimRagdollSingularity",
+	L"Class SFXGameContent.SFXCustomAction_BoostDown",
+	L"Function SFXGameContent.SFXCustomAction_BoostDown.SetMoveStage",
+	L"Function SFXGameContent.SFXCustomAction_BoostDown.StopCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_BoostUp",
+	L"Function SFXGameContent.SFXCustomAction_BoostUp.EndRocketBoots",
+	L"Function SFXGameContent.SFXCustomAction_BoostUp.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_BoostUp.SetMoveStage",
+	L"Class SFXGameContent.SFXGameEffect_RagdollRocket",
+	L"Function SFXGameContent.SFXGameEffect_RagdollRocket.HasAntiGravity",
+	L"Function SFXGameContent.SFXGameEffect_RagdollRocket.OnUpdate",
+	L"Function SFXGameContent.SFXGameEffect_RagdollRocket.OnApplied",
+	L"Class SFXGameContent.SFXCustomAction_CoverSlipLeft",
+	L"Class SFXGameContent.SFXCustomAction_CoverSlipLeftStanding",
+	L"Class SFXGameContent.SFXCustomAction_CoverSlipRight",
+	L"Class SFXGameContent.SFXCustomAction_CoverSlipRightStanding",
+	L"Class SFXGameContent.SFXCustomAction_DeathReaction",
+	L"Function SFXGameContent.SFXCustomAction_DeathReaction.PlayImpactSound",
+	L"Function SFXGameContent.SFXCustomAction_DeathReaction.BodyStanceAnimEndNotification",
+	L"Function SFXGameContent.SFXCustomAction_DeathReaction.StartCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_DeathReaction_Corkscrew",
+	L"Class SFXGameContent.SFXCustomAction_DeathReaction_GibHeadshot",
+	L"Function SFXGameContent.SFXCustomAction_DeathReaction_GibHeadshot.ActivateImpactEmitter",
+	L"Function SFXGameContent.SFXCustomAction_DeathReaction_GibHeadshot.PrecacheVFX",
+	L"Class SFXGameContent.SFXCustomAction_DeathReaction_GibKnockback",
+	L"Function SFXGameContent.SFXCustomAction_DeathReaction_GibKnockback.StopAnim",
+	L"Function SFXGameContent.SFXCustomAction_DeathReaction_GibKnockback.ActivateImpactEmitter",
+	L"Function SFXGameContent.SFXCustomAction_DeathReaction_GibKnockback.PrecacheVFX",
+	L"Class SFXGameContent.SFXCustomAction_DeathReaction_Headshot_Cover",
+	L"Function SFXGameContent.SFXCustomAction_DeathReaction_Headshot_Cover.ActivateImpactEmitter",
+	L"Class SFXGameContent.SFXCustomAction_DeathReaction_HeavyLeftArm",
+	L"Class SFXGameContent.SFXCustomAction_DeathReaction_HeavyRightArm",
+	L"Class SFXGameContent.SFXCustomAction_DeathReaction_LeftArm",
+	L"Class SFXGameContent.SFXCustomAction_DeathReaction_LeftLeg",
+	L"Class SFXGameContent.SFXCustomAction_DeathReaction_RightArm",
+	L"Class SFXGameContent.SFXCustomAction_DeathReaction_RightLeg",
+	L"Class SFXGameContent.SFXCustomAction_DeathReaction_Stomach",
+	L"Class SFXGameContent.SFXCustomAction_Freezing",
+	L"Class SFXGameContent.SFXCustomAction_FreezingII",
+	L"Class SFXGameContent.SFXCustomAction_FreezingIII",
+	L"Class SFXGameContent.SFXCustomAction_GreatPain",
+	L"Class SFXGameContent.SFXCustomAction_GreatPainII",
+	L"Class SFXGameContent.SFXCustomAction_IdleInspectWeapon",
+	L"Class SFXGameContent.SFXCustomAction_IdleListening",
+	L"Class SFXGameContent.SFXCustomAction_IdleListening2",
+	L"Class SFXGameContent.SFXCustomAction_IdleListening3",
+	L"Class SFXGameContent.SFXCustomAction_IdleStandGuard",
+	L"Class SFXGameContent.SFXCustomAction_IdleTalking",
+	L"Class SFXGameContent.SFXCustomAction_IdleTalking2",
+	L"Class SFXGameContent.SFXCustomAction_IdleTalking3",
+	L"Class SFXGameContent.SFXCustomAction_IdleUseConsole",
+	L"Class SFXGameContent.SFXCustomAction_OnFire",
+	L"Class SFXGameContent.SFXCustomAction_OnFireII",
+	L"Class SFXGameContent.SFXCustomAction_RollBackward",
+	L"Class SFXGameContent.SFXCustomAction_RollForward",
+	L"Class SFXGameContent.SFXCustomAction_RollLeft",
+	L"Class SFXGameContent.SFXCustomAction_RollRight",
+	L"Class SFXGameContent.SFXCustomAction_ShieldBreach",
+	L"Function SFXGameContent.SFXCustomAction_ShieldBreach.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_ShieldBreach.InternalCanDoCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_ShieldBreach.GetUsedAnimNames",
+	L"Class SFXGameContent.SFXCustomAction_StaggerImpact",
+	L"Class SFXGameContent.SFXCustomAction_StaggerImpactForward",
+	L"Class SFXGameContent.SFXCustomAction_StaggerImpactII",
+	L"Class SFXGameContent.SFXCustomAction_StaggerImpactLeft",
+	L"Class SFXGameContent.SFXCustomAction_StaggerImpactRight",
+	L"Class SFXGameContent.SFXCustomAction_StandardImpact",
+	L"Class SFXGameContent.SFXCustomAction_StandardImpactForward",
+	L"Class SFXGameContent.SFXCustomAction_StandardImpactII",
+	L"Class SFXGameContent.SFXCustomAction_StandardImpactKnee",
+	L"Class SFXGameContent.SFXCustomAction_StandardImpactLeft",
+	L"Class SFXGameContent.SFXCustomAction_StandardImpactRight",
+	L"Class SFXGameContent.SFXCustomAction_TrooperMelee",
+	L"Function SFXGameContent.SFXCustomAction_TrooperMelee.ClientDoCustomActionImpact",
+	L"Class SFXGameContent.SFXCustomAction_TrooperStomp",
+	L"Function SFXGameContent.SFXCustomAction_TrooperStomp.OnTimelineImpact",
+	L"Function SFXGameContent.SFXCustomAction_TrooperStomp.ClientDoCustomActionImpact",
+	L"Class SFXGameContent.SFXDamageType_EnemyGrenade",
+	L"Class SFXGameContent.SFXDamageType_SMG_Tempest",
+	L"Class SFXGameContent.SFXDamageType_TacticalMachinePistol",
+	L"Class SFXGameContent.SFXNav_InteractionHenchOmniToolCrouch",
+	L"Class SFXGameContent.SFXNav_InteractionInspectWeapon",
+	L"Class SFXGameContent.SFXNav_InteractionStandGuard",
+	L"Class SFXGameContent.SFXPawn_Trooper",
+	L"Class SFXGameContent.SFXPowerCustomAction_CerberusGrenade",
+	L"Class SFXGameContent.SFXPowerCustomAction_EnemyGrenade",
+	L"Function SFXGameContent.SFXPowerCustomAction_EnemyGrenade.GetProjectileAttachPoint",
+	L"Class SFXGameContent.SFXProjectile_PowerCustomAction_CerberusFragGrenade",
+	L"Class SFXGameContent.SFXRumble_MeleeHit",
+	L"Class SFXGameContent.SFXShake_MeleeHit",
+	L"Class SFXGameContent.SFXWeapon_SMG_Hornet",
+	L"Function SFXGameContent.SFXWeapon_SMG_Hornet.GetWeaponSpecificImpactSound",
+	L"Class SFXGameContent.SFXWeapon_AI_Hornet",
+	L"Class SFXGameContent.SFXCustomAction_CustomLoopingInteraction",
+	L"Function SFXGameContent.SFXCustomAction_CustomLoopingInteraction.StartCustomAction",
+	L"Class SFXGameContent.SFXNav_InteractionHenchCustom",
+	L"Class SFXGameContent.SFXCustomAction_HenchBeckonFront",
+	L"Function SFXGameContent.SFXCustomAction_HenchBeckonFront.CanOverrideMoveWith",
+	L"Class SFXGameContent.SFXCustomAction_HenchBeckonRear",
+	L"Function SFXGameContent.SFXCustomAction_HenchBeckonRear.CanOverrideMoveWith",
+	L"Class SFXGameContent.SFXCustomAction_HenchCrouch",
+	L"Function SFXGameContent.SFXCustomAction_HenchCrouch.CanOverrideMoveWith",
+	L"Function SFXGameContent.SFXCustomAction_HenchCrouch.TriggerEnd",
+	L"Function SFXGameContent.SFXCustomAction_HenchCrouch.StartCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_HenchInteractLow",
+	L"Function SFXGameContent.SFXCustomAction_HenchInteractLow.CanOverrideMoveWith",
+	L"Function SFXGameContent.SFXCustomAction_HenchInteractLow.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_HenchInteractLow.StartCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_HenchmanMelee",
+	L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.TryNextMelee",
+	L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.CanContinueMelee",
+	L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.BodyStanceAnimEndNotification",
+	L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.StartCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.GetBodyStanceAnim",
+	L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.ShouldUsePistolAnim",
+	L"Function SFXGameContent.SFXCustomAction_HenchmanMelee.GetUsedAnimNames",
+	L"Class SFXGameContent.SFXCustomAction_HenchOmniTool",
+	L"Function SFXGameContent.SFXCustomAction_HenchOmniTool.CanOverrideMoveWith",
+	L"Function SFXGameContent.SFXCustomAction_HenchOmniTool.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_HenchOmniTool.StartCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_HenchOmniToolCrouch",
+	L"Function SFXGameContent.SFXCustomAction_HenchOmniToolCrouch.CanOverrideMoveWith",
+	L"Function SFXGameContent.SFXCustomAction_HenchOmniToolCrouch.StopCustomAction",
+	L"Function SFXGameContent.SFXCustomAction_HenchOmniToolCrouch.StartCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_HenchRollBackward",
+	L"Function SFXGameContent.SFXCustomAction_HenchRollBackward.StopCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_HenchRollForward",
+	L"Function SFXGameContent.SFXCustomAction_HenchRollForward.StopCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_HenchRollLeft",
+	L"Function SFXGameContent.SFXCustomAction_HenchRollLeft.StopCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_HenchRollRight",
+	L"Function SFXGameContent.SFXCustomAction_HenchRollRight.StopCustomAction",
+	L"Class SFXGameContent.SFXCustomAction_HenchStandIdle",
+	L"Function SFXGameContent.SFXCustomAction_HenchStandIdle.CanOverrideMoveWith",
+	L"Function SFXGameContent.SFXCustomAction_HenchStandIdle.TriggerEnd",
+	L"Class SFXGameContent.SFXCustomAction_HenchStandTyping",
+	L"Function SFXGameContent.SFXCustomAction_HenchStandTyping.CanOverrideMoveWith",
+	L"Class SFXGameContent.SFXDamageType_BarrierBlast",
+	L"Class SFXGameContent.SFXDamageType_BarrierBlast_NoRagdoll",
+	L"Class SFXGameContent.SFXDamageType_CryoFreeze",
+	L"Class SFXGameContent.SFXDamageType_OverloadRobot",
+	L"Class SFXGameContent.SFXDamageType_Overload",
+	L"Class SFXGameContent.SFXDamageType_ImprovedOverload",
+	L"Class SFXGameContent.SFXDamageType_ImprovedOverloadRobot",
+	L"Class SFXGameContent.SFXDamageType_Overload_Ragdoll",
+	L"Class SFXGameContent.SFXDamageType_Reave",
+	L"Class SFXGameContent.SFXDamageType_Reave_Improved",
+	L"Class SFXGameContent.SFXGameEffect_BarrierLift",
+	L"Function SFXGameContent.SFXGameEffect_BarrierLift.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_BarrierLift.UpdateRagdoll",
+	L"Function SFXGameContent.SFXGameEffect_BarrierLift.OnApplied",
+	L"Class SFXGameContent.SFXGameEffect_DefensiveArmor",
+	L"Function SFXGameContent.SFXGameEffect_DefensiveArmor.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_DefensiveArmor.TurnVFXOff",
+	L"Function SFXGameContent.SFXGameEffect_DefensiveArmor.TurnVFXOn",
+	L"Function SFXGameContent.SFXGameEffect_DefensiveArmor.OnUpdate",
+	L"Function SFXGameContent.SFXGameEffect_DefensiveArmor.OnApplied",
+	L"Class SFXGameContent.SFXPowerCustomAction_DefensiveShield",
+	L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.RestoreSaveState",
+	L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.ShouldUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.DoJoinInProgress",
+	L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.CanUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.ResetPower",
+	L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.ClientDoPowerSubsequentImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.TryApplyArmor",
+	L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.SetupEffect",
+	L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.ApplyArmor",
+	L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.RemoveArmor",
+	L"Function SFXGameContent.SFXPowerCustomAction_DefensiveShield.OnImpact",
+	L"Class SFXGameContent.SFXGameEffect_HenchmanArmorBonus_PowerCooldownBonus",
+	L"Class SFXGameContent.SFXGameEffect_HenchmanArmorBonus_PowerDamageBonus",
+	L"Class SFXGameContent.SFXGameEffect_OverloadChain",
+	L"Function SFXGameContent.SFXGameEffect_OverloadChain.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_OverloadChain.ImpactAdditionalTarget",
+	L"Function SFXGameContent.SFXGameEffect_OverloadChain.SelectAndImpactNextTarget",
+	L"Function SFXGameContent.SFXGameEffect_OverloadChain.OnUpdate",
+	L"Function SFXGameContent.SFXGameEffect_OverloadChain.PlayBeamEffect",
+	L"Function SFXGameContent.SFXGameEffect_OverloadChain.OnApplied",
+	L"Class SFXGameContent.SFXPowerCustomAction_Overload",
+	L"Function SFXGameContent.SFXPowerCustomAction_Overload.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_Overload.ApplyBonus",
+	L"Function SFXGameContent.SFXPowerCustomAction_Overload.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_Overload.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Overload.ShouldUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Overload.ClientDoPowerSubsequentImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Overload.TestAchievement",
+	L"Function SFXGameContent.SFXPowerCustomAction_Overload.CreateOverloadChainEffect",
+	L"Function SFXGameContent.SFXPowerCustomAction_Overload.OnImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Overload.GetImpactForce",
+	L"Function SFXGameContent.SFXPowerCustomAction_Overload.GetImpactDamage",
+	L"Function SFXGameContent.SFXPowerCustomAction_Overload.OnPowerDetonated",
+	L"Class SFXGameContent.SFXGameEffect_Reave",
+	L"Class SFXGameContent.SFXPawn_Kaidan",
+	L"Class SFXGameContent.SFXPowerCustomAction_Reave",
+	L"Function SFXGameContent.SFXPowerCustomAction_Reave.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_Reave.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Reave.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_Reave.ShouldUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Reave.StopSounds",
+	L"Function SFXGameContent.SFXPowerCustomAction_Reave.OnImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Reave.GetImpactDamage",
+	L"Function SFXGameContent.SFXPowerCustomAction_Reave.OnPowerDetonated",
+	L"Class SFXGameContent.SFXPowerCustomAction_CryoBlast",
+	L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.ApplyBonus",
+	L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.GetDefaultClientEffectParams",
+	L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.ShouldUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.ClientDoPowerSubsequentImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.OnFrozenPawnDied",
+	L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.ApplySlowdownEffect",
+	L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.ApplyFreezeEffect",
+	L"Function SFXGameContent.SFXPowerCustomAction_CryoBlast.OnImpact",
+	L"Class SFXGameContent.SFXPowerCustomAction_Barrier",
+	L"Function SFXGameContent.SFXPowerCustomAction_Barrier.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_Barrier.ApplyBonus",
+	L"Function SFXGameContent.SFXPowerCustomAction_Barrier.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Barrier.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_Barrier.OnBlastImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Barrier.ClientDoPowerSubsequentImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Barrier.DoBlast",
+	L"Function SFXGameContent.SFXPowerCustomAction_Barrier.RemoveArmor",
+	L"Function SFXGameContent.SFXPowerCustomAction_Barrier.StartPowerCooldown",
+	L"Function SFXGameContent.SFXPowerCustomAction_Barrier.ApplyArmor",
+	L"Function SFXGameContent.SFXPowerCustomAction_Barrier.StartCustomAction",
+	L"Class SFXGameContent.SFXPowerCustomAction_KaidenPassive",
+	L"Function SFXGameContent.SFXPowerCustomAction_KaidenPassive.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_KaidenPassive.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_KaidenPassive.ResetPower",
+	L"Function SFXGameContent.SFXPowerCustomAction_KaidenPassive.ApplyGlobalBonus",
+	L"Class SFXGameContent.SFXPowerCustomAction_HenchmanPassive",
+	L"Function SFXGameContent.SFXPowerCustomAction_HenchmanPassive.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_HenchmanPassive.ApplyGlobalBonus",
+	L"Class SFXGameContent.SFXShield_Energy",
+	L"Class SFXGameContent.SFXCustomAction_HenchmanHeavyMelee",
+	L"Class SFXGameContent.SFXDamageType_Carnage",
+	L"Class SFXGameContent.SFXDamageType_Carnage_DoT",
+	L"Class SFXGameContent.SFXDamageType_Carnage_Improved",
+	L"Class SFXGameContent.SFXDamageType_Carnage_Improved_DoT",
+	L"Class SFXGameContent.SFXDamageType_Carnage_Ragdoll",
+	L"Class SFXGameContent.SFXDamageType_Carnage_Ragdoll_DoT",
+	L"Class SFXGameContent.SFXDamageType_Carnage_Ragdoll_Improved",
+	L"Class SFXGameContent.SFXDamageType_Carnage_Ragdoll_Improved_DoT",
+	L"Class SFXGameContent.SFXDamageType_ConcussiveShot",
+	L"Class SFXGameContent.SFXDamageType_ConcussiveShot_Incendiary",
+	L"Class SFXGameContent.SFXDamageType_FragGrenade",
+	L"Class SFXGameContent.SFXDamageType_FragGrenade_Armor",
+	L"Class SFXGameContent.SFXDamageType_FragGrenade_Shields",
+	L"Class SFXGameContent.SFXDamageType_IncendiaryAmmo",
+	L"Class SFXGameContent.SFXDamageType_IncendiaryAmmoImproved",
+	L"Class SFXGameContent.SFXGameEffect_AmmoPower",
+	L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnUpdate",
+	L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnWeaponUnequip",
+	L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnWeaponEquip",
+	L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnWeaponReload",
+	L"Function SFXGameContent.SFXGameEffect_AmmoPower.GetDamageVocProbabilityMod",
+	L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnWeaponImpact",
+	L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_AmmoPower.GetBulletsPerSecond",
+	L"Function SFXGameContent.SFXGameEffect_AmmoPower.GetWeaponDamage",
+	L"Function SFXGameContent.SFXGameEffect_AmmoPower.GetHitTarget",
+	L"Function SFXGameContent.SFXGameEffect_AmmoPower.SetupFromWeapon",
+	L"Function SFXGameContent.SFXGameEffect_AmmoPower.OnApplied",
+	L"Class SFXGameContent.SFXPowerCustomAction_AmmoPower",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.DelayedSetWeaponPower",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ClientDoCustomActionImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.DoJoinInProgress",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.SetupEffect",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.OnPowerRankIncreased",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ShouldUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.DoConcussiveShotSpecialImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ClientDoPowerSubsequentImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ReplicateConcussiveShotSpecialImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ConcussiveShotCustomImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ApplyPowerEffects",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.SetWeaponPower",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.DeferedSetWeaponPower",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.OnImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.ReloadAmmoPower",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.StopOmniTool",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.StartCustomAction",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.CanUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_AmmoPower.PrecacheVFX",
+	L"Class SFXGameContent.SFXGameEffect_FireDeath",
+	L"Class SFXGameContent.SFXGameEffect_HenchmanArmorBonus_HealthBonus",
+	L"Class SFXGameContent.SFXGameEffect_HenchmanArmorBonus_ShieldBonus",
+	L"Class SFXGameContent.SFXGameEffect_IncendiaryAmmo",
+	L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.AddGameEffects",
+	L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.GetDamageVocProbabilityMod",
+	L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.OnWeaponImpact",
+	L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.OnApplied",
+	L"Function SFXGameContent.SFXGameEffect_IncendiaryAmmo.PrecacheVFX",
+	L"Class SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ApplyBonus",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ResetPower",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.GetIncendiaryAmmoEffect",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.OnActorImpacted",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.DoConcussiveShotSpecialImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ConcussiveShotCustomImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ClientDoPowerSubsequentImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ClientDoCustomActionImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.DoEvolvedAoEImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.SpawnRandomImpactVFX",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.SetupEffect",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.GetDamageType",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.ApplyPowerEffects",
+	L"Function SFXGameContent.SFXPowerCustomAction_IncendiaryAmmo.PrecacheVFX",
+	L"Class SFXGameContent.SFXGameEffect_WeaponVFXChange",
+	L"Function SFXGameContent.SFXGameEffect_WeaponVFXChange.OnRemoved",
+	L"Function SFXGameContent.SFXGameEffect_WeaponVFXChange.OnApplied",
+	L"Class SFXGameContent.SFXPawn_Marine",
+	L"Class SFXGameContent.SFXPowerCustomAction_FragGrenade",
+	L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.GetDefaultClientEffectParams",
+	L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.OnImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.ApplyGrenadeBonus",
+	L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.GetDamageType",
+	L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.GetImpactDamage",
+	L"Function SFXGameContent.SFXPowerCustomAction_FragGrenade.PlayDetonationEffects",
+	L"Class SFXGameContent.SFXPowerCustomAction_Carnage",
+	L"Function SFXGameContent.SFXPowerCustomAction_Carnage.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_Carnage.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Carnage.ShouldUsePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Carnage.PlayDetonationEffects",
+	L"Function SFXGameContent.SFXPowerCustomAction_Carnage.GetProjectileAttachPoint",
+	L"Function SFXGameContent.SFXPowerCustomAction_Carnage.ReleasePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Carnage.PrecacheVFX",
+	L"Function SFXGameContent.SFXPowerCustomAction_Carnage.OnImpact",
+	L"Function SFXGameContent.SFXPowerCustomAction_Carnage.GetTotalDamage",
+	L"Function SFXGameContent.SFXPowerCustomAction_Carnage.GetImpactDamage",
+	L"Function SFXGameContent.SFXPowerCustomAction_Carnage.DoPowerDetonatedForActor",
+	L"Class SFXGameContent.SFXPowerCustomAction_Fortification",
+	L"Function SFXGameContent.SFXPowerCustomAction_Fortification.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_Fortification.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_Fortification.RecalculateAllPowerData",
+	L"Function SFXGameContent.SFXPowerCustomAction_Fortification.RemoveArmor",
+	L"Function SFXGameContent.SFXPowerCustomAction_Fortification.StartPowerCooldown",
+	L"Function SFXGameContent.SFXPowerCustomAction_Fortification.ApplyArmor",
+	L"Class SFXGameContent.SFXPowerCustomAction_JimmyPassive",
+	L"Function SFXGameContent.SFXPowerCustomAction_JimmyPassive.PopulatePowerStatBarEvolves",
+	L"Function SFXGameContent.SFXPowerCustomAction_JimmyPassive.EvolvePower",
+	L"Function SFXGameContent.SFXPowerCustomAction_JimmyPassive.ResetPower",
+	L"Function SFXGameContent.SFXPowerCustomAction_JimmyPassive.ApplyGlobalBonus",
+	L"Class SFXGameContent.SFXProjectile_PowerCustomAction_Carnage",
+	L"Class SFXGameContent.SFXProjectile_PowerCustomAction_FragGrenade",
+	L"Class SFXGameContent.SFXDamageType_Shotgun",
+	L"Class SFXGameContent.SFXGUI_ShotgunReticle",
+	L"Function SFXGameContent.SFXGUI_ShotgunReticle.ResetReticle",
+	L"Function SFXGameContent.SFXGUI_ShotgunReticle.TargetCanHitChanged",
+	L"Function SFXGameContent.SFXGUI_ShotgunReticle.Update",
+	L"Function SFXGameContent.SFXGUI_ShotgunReticle.PerformReticleHide",
+	L"Function SFXGameContent.SFXGUI_ShotgunReticle.PerformReticleShow",
+	L"Function SFXGameContent.SFXGUI_ShotgunReticle.OnReticleLoaded",
+	L"Class SFXGameContent.SFXWeapon_Shotgun_Katana",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
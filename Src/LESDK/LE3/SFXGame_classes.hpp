@@ -5603,7 +5603,7 @@ public:
 	TArray<struct FBioHardLinkReference>               References;                                       		// 0x0060 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5632,7 +5632,7 @@ public:
 	unsigned long                                      m_bNotificationIsPaused : 1;                      		// 0x0108 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5682,7 +5682,7 @@ public:
 	float                                              ME2ImportReputationAmount;                        		// 0x0060 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5713,7 +5713,7 @@ public:
 	float                                              MinPlayTime;                                      		// 0x008C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5732,7 +5732,7 @@ public:
 	unsigned long                                      m_bEnableLogging : 1;                             		// 0x0070 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5759,7 +5759,7 @@ public:
 	unsigned long                                      bSubtractive : 1;                                 		// 0x02C4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5776,7 +5776,7 @@ public:
 	class UBio2DA*                                     oPlotTreasureTech2DA;                             		// 0x0070 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5807,7 +5807,7 @@ public:
 	unsigned long                                      m_bDisableAnimation : 1;                          		// 0x009C (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5852,7 +5852,7 @@ public:
 	int                                                m_nCurrentReservationID;                          		// 0x00B8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5902,7 +5902,7 @@ public:
 	unsigned long                                      m_bPlayerOrderedPowerUse : 1;                     		// 0x00E8 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5942,7 +5942,7 @@ public:
 	struct FVector                                     m_vBoundarySize;                                  		// 0x0270 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5961,7 +5961,7 @@ public:
 	unsigned long                                      bCombatExperience : 1;                            		// 0x0108 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5980,7 +5980,7 @@ public:
 	TArray<class UGFxMovieInfo*>                       Movies;                                           		// 0x0080 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -5995,7 +5995,7 @@ public:
 	TArray<class USkeletalMesh*>                       Dependents;                                       		// 0x0424 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6012,7 +6012,7 @@ public:
 	float                                              m_fTimePassed;                                    		// 0x027C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6039,7 +6039,7 @@ public:
 	unsigned long                                      bSaveRequired : 1;                                		// 0x00D8 (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6110,7 +6110,7 @@ class USFXActorFactoryRigidBody : public UActorFactoryRigidBody
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6124,7 +6124,7 @@ class UBioActorFactoryPhysicsActor : public USFXActorFactoryRigidBody
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6140,7 +6140,7 @@ public:
 	class UStaticMeshComponent*                        ZoneMeshComp;                                     		// 0x0280 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6176,7 +6176,7 @@ public:
 	unsigned long                                      bPassThroughDamage : 1;                           		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6199,7 +6199,7 @@ public:
 	struct FScriptDelegate                             __OnAsyncGroupLoaded__Delegate;                   		// 0x0088 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6219,7 +6219,7 @@ public:
 	struct FGuid                                       CombatZoneGuid;                                   		// 0x02B4 (0x0010) [0x0000000000220003]              ( CPF_Edit | CPF_Const | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6234,7 +6234,7 @@ public:
 	class APawn*                                       BlockingPawn;                                     		// 0x00BC (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6248,7 +6248,7 @@ class USFXBoostReachSpec : public USFXCustomReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6262,7 +6262,7 @@ class USFXClimbWallReachSpec : public USFXCustomReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6276,7 +6276,7 @@ class USFXJumpDownReachSpec : public USFXCustomReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6292,7 +6292,7 @@ public:
 	float                                              MovePercentToReachMaxHeight;                      		// 0x00C8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6306,7 +6306,7 @@ class USFXLadderReachSpec : public USFXCustomReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6320,7 +6320,7 @@ class USFXLargeBoostReachSpec : public USFXCustomReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6334,7 +6334,7 @@ class USFXLargeClimbReachSpec : public USFXCustomReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6348,7 +6348,7 @@ class USFXLargeMantleReachSpec : public USFXCustomReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6363,7 +6363,7 @@ public:
 	float                                              LeapHeight;                                       		// 0x00C4 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6377,7 +6377,7 @@ class USFXLeapReachSpecHumanoid : public USFXLeapReachSpecBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6391,7 +6391,7 @@ class USFXLeapReachSpecLarge : public USFXLeapReachSpecBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6444,7 +6444,7 @@ public:
 	unsigned char                                      WoundDamage;                                      		// 0x012D (0x0001) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6461,7 +6461,7 @@ class USFXDamageType_Suicide : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6510,7 +6510,7 @@ public:
 	unsigned char                                      MaxUniquePlayers;                                 		// 0x037C (0x0001) [0x0000000000002020]              ( CPF_Net | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6583,7 +6583,7 @@ public:
 	unsigned char                                      NormalizedDifficulty;                             		// 0x0101 (0x0001) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6614,7 +6614,7 @@ public:
 	unsigned long                                      bPrevBlockedState : 1;                            		// 0x0380 (0x0004) [0x0000000000002002] [0x00000020] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6641,7 +6641,7 @@ public:
 	int                                                ShotCount;                                        		// 0x0288 (0x0004) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6676,7 +6676,7 @@ public:
 	unsigned long                                      bNoEffectCull : 1;                                		// 0x02C0 (0x0004) [0x0000000000000000] [0x00000100] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6789,7 +6789,7 @@ public:
 	unsigned char                                      eNetworkErrorStatus;                              		// 0x0DF1 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -6961,7 +6961,7 @@ public:
 	unsigned char                                      MapObjectLevel;                                   		// 0x00E6 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7026,7 +7026,7 @@ public:
 	unsigned long                                      ExploredCluster : 1;                              		// 0x0140 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7048,7 +7048,7 @@ public:
 	float                                              m_fGalaxyRadius;                                  		// 0x00F8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7084,7 +7084,7 @@ public:
 	unsigned char                                      FeatureTransitionName;                            		// 0x014F (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7127,7 +7127,7 @@ public:
 	unsigned char                                      ReaperControlConditionName;                       		// 0x0156 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7182,7 +7182,7 @@ public:
 	unsigned long                                      m_bShowAsScanned : 1;                             		// 0x0118 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7267,7 +7267,7 @@ public:
 	unsigned char                                      PlanetPlotLabelConditionName;                     		// 0x024F (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7325,7 +7325,7 @@ public:
 	unsigned long                                      NoAppearance : 1;                                 		// 0x00A0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7413,7 +7413,7 @@ public:
 	unsigned long                                      bPerfProto : 1;                                   		// 0x0838 (0x0004) [0x0000000000004000] [0x00000020] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7518,7 +7518,7 @@ public:
 	unsigned char                                      BonusFormula;                                     		// 0x0091 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -7740,7 +7740,7 @@ public:
 	unsigned char                                      m_eCurrentActionIcon;                             		// 0x0DAE (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8064,7 +8064,7 @@ public:
 	unsigned char                                      Priority;                                         		// 0x00D4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8121,7 +8121,7 @@ public:
 	float                                              DeadZone;                                         		// 0x00E8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8170,7 +8170,7 @@ public:
 	unsigned long                                      bRescaling : 1;                                   		// 0x0170 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8210,7 +8210,7 @@ public:
 	unsigned char                                      CurrentMode;                                      		// 0x00A8 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8297,7 +8297,7 @@ public:
 	unsigned char                                      m_nLStickY;                                       		// 0x009E (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8360,7 +8360,7 @@ public:
 	unsigned long                                      bCanPickUpGrenades : 1;                           		// 0x03A4 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8446,7 +8446,7 @@ public:
 	unsigned char                                      PlaybackState;                                    		// 0x011C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8478,7 +8478,7 @@ public:
 	float                                              ShieldScale;                                      		// 0x00B4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8507,7 +8507,7 @@ public:
 	int                                                MaxWeapons;                                       		// 0x0198 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8543,7 +8543,7 @@ public:
 	int                                                ReplicatedArmourStates[ 0xC ];                    		// 0x00D0 (0x0030) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8584,7 +8584,7 @@ public:
 	unsigned long                                      bPlayFootstepSounds : 1;                          		// 0x0098 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8613,7 +8613,7 @@ public:
 	unsigned long                                      m_bInConversation : 1;                            		// 0x00AC (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8635,7 +8635,7 @@ public:
 	unsigned char                                      ReplicatedHealth;                                 		// 0x00AC (0x0001) [0x0000000100002020]              ( CPF_Net | CPF_Transient | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8661,7 +8661,7 @@ public:
 	unsigned long                                      EffectListLocked : 1;                             		// 0x0080 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8705,7 +8705,7 @@ public:
 	unsigned char                                      CurrentState;                                     		// 0x00FC (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8737,7 +8737,7 @@ public:
 	unsigned long                                      bAutoLookAtPlayer : 1;                            		// 0x00B4 (0x0004) [0x0040000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8763,7 +8763,7 @@ public:
 	unsigned long                                      bActive : 1;                                      		// 0x00B0 (0x0004) [0x0000004100000020] [0x00000001] ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8786,7 +8786,7 @@ public:
 	unsigned char                                      MarkerIconType;                                   		// 0x00B4 (0x0001) [0x0000000000000021]              ( CPF_Edit | CPF_Net )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8802,7 +8802,7 @@ public:
 	unsigned long                                      PlayerIsDead : 1;                                 		// 0x00B4 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8820,7 +8820,7 @@ public:
 	unsigned char                                      RadarType;                                        		// 0x0074 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8837,7 +8837,7 @@ public:
 	TArray<struct FBioWoundSpec>                       m_aWounds;                                        		// 0x0080 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8859,7 +8859,7 @@ public:
 	unsigned long                                      bUseWrinkles : 1;                                 		// 0x0094 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8895,7 +8895,7 @@ public:
 	unsigned long                                      bSerializedFromBlaze : 1;                         		// 0x00E4 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8934,7 +8934,7 @@ public:
 	int                                                NumPromotions;                                    		// 0x0080 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8957,7 +8957,7 @@ public:
 	unsigned long                                      bRemovedFromInclusionaryList : 1;                 		// 0x037C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8977,7 +8977,7 @@ public:
 	unsigned long                                      bTopNode : 1;                                     		// 0x0390 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -8992,7 +8992,7 @@ public:
 	class ANavigationPoint*                            ClimbDest;                                        		// 0x0380 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9011,7 +9011,7 @@ public:
 	unsigned long                                      bTopNode : 1;                                     		// 0x0398 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9029,7 +9029,7 @@ public:
 	float                                              JumpDist;                                         		// 0x03A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9049,7 +9049,7 @@ public:
 	unsigned long                                      bDisabled : 1;                                    		// 0x0398 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9070,7 +9070,7 @@ public:
 	float                                              BoostDistZ;                                       		// 0x038C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9086,7 +9086,7 @@ public:
 	struct FVector                                     LandingOffset;                                    		// 0x0390 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9100,7 +9100,7 @@ class ASFXNav_LeapNodeHumanoid : public ASFXNav_LeapNodeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9114,7 +9114,7 @@ class ASFXNav_LeapNodeLarge : public ASFXNav_LeapNodeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9130,7 +9130,7 @@ public:
 	float                                              m_fForcedHeight;                                  		// 0x0378 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9147,7 +9147,7 @@ public:
 	unsigned long                                      m_bIsFinalGoal : 1;                               		// 0x037C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9166,7 +9166,7 @@ public:
 	unsigned long                                      bTopNode : 1;                                     		// 0x037C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9181,7 +9181,7 @@ public:
 	class ANavigationPoint*                            MantleDest;                                       		// 0x0374 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9195,7 +9195,7 @@ class ASFXNav_SpawnEntrance : public APathNode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9212,7 +9212,7 @@ public:
 	class AActor*                                      Target;                                           		// 0x0074 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9233,7 +9233,7 @@ class USFXNuiSpeech_Explore : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9250,7 +9250,7 @@ public:
 	struct FLinearColor                                LineColor;                                        		// 0x0234 (0x0010) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9275,7 +9275,7 @@ public:
 	unsigned long                                      bDebugLogOnCleanup : 1;                           		// 0x037C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9316,7 +9316,7 @@ public:
 	unsigned char                                      UnknownData00[ 0x1C ];                            		// 0x0060 (0x001C) MISSED OFFSET
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9342,7 +9342,7 @@ public:
 	unsigned long                                      bSourceDied : 1;                                  		// 0x02D0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9360,7 +9360,7 @@ public:
 	float                                              RenderDelay;                                      		// 0x0304 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9376,7 +9376,7 @@ public:
 	struct FLinearColor                                HenchmenColour;                                   		// 0x02E4 (0x0010) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9392,7 +9392,7 @@ public:
 	TArray<struct FNavWeight>                          NavWeights;                                       		// 0x0080 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9410,7 +9410,7 @@ public:
 	struct FLightingChannelContainer                   LightingChannels;                                 		// 0x03A8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9432,7 +9432,7 @@ class ASFXRpgPickupFactory : public ASFXPickupFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9458,7 +9458,7 @@ public:
 	unsigned long                                      bStopCustomTicking : 1;                           		// 0x03BC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9495,7 +9495,7 @@ public:
 	unsigned long                                      bStopCustomTicking : 1;                           		// 0x03F4 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9521,7 +9521,7 @@ public:
 	unsigned long                                      bIsDestroyed : 1;                                 		// 0x0314 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9543,7 +9543,7 @@ class ASFXPointOfInterest : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9561,7 +9561,7 @@ public:
 	struct FScriptDelegate                             __OnActorImpacted__Delegate;                      		// 0x0290 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9591,7 +9591,7 @@ public:
 	unsigned char                                      HenchmenHelmetPreference;                         		// 0x0355 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9607,7 +9607,7 @@ public:
 	TArray<struct FBonusPowerUnlockData>               BonusPowerUnlockDataArray;                        		// 0x00C8 (0x0010) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9713,7 +9713,7 @@ public:
 	TArray<class APawn*>                               PawnsToIgnore;                                    		// 0x0270 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9747,7 +9747,7 @@ public:
 	unsigned char                                      CurrentSlotDirection;                             		// 0x013C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9804,7 +9804,7 @@ public:
 	unsigned char                                      ConversationMode;                                 		// 0x04B5 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9846,7 +9846,7 @@ public:
 	TArray<struct FScriptDelegate>                     SaveCommandCompleteDelegates;                     		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -9902,7 +9902,7 @@ public:
 	unsigned long                                      m_bLoadInProgress : 1;                            		// 0x0200 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10003,7 +10003,7 @@ class USFXSelectionLensFlareComponent : public ULensFlareComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10034,7 +10034,7 @@ public:
 	unsigned char                                      m_TargetTipText;                                  		// 0x00C4 (0x0001) [0x0040000004000009]              ( CPF_Edit | CPF_ExportObject | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10059,7 +10059,7 @@ public:
 	unsigned long                                      bPlayUseAnimation : 1;                            		// 0x00DC (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10079,7 +10079,7 @@ public:
 	TArray<struct FAimAssistBox>                       AimAssistRegions;                                 		// 0x00F0 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10096,7 +10096,7 @@ public:
 	struct FGuid                                       UseModuleGUID;                                    		// 0x00E0 (0x0010) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10125,7 +10125,7 @@ public:
 	unsigned long                                      bStopCustomTicking : 1;                           		// 0x0134 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10149,7 +10149,7 @@ public:
 	unsigned long                                      selectable : 1;                                   		// 0x00C8 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10169,7 +10169,7 @@ public:
 	unsigned char                                      TreasureType;                                     		// 0x0100 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10188,7 +10188,7 @@ public:
 	unsigned long                                      bTakeOff : 1;                                     		// 0x011C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10206,7 +10206,7 @@ public:
 	int                                                NumHenchmen;                                      		// 0x0108 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10226,7 +10226,7 @@ public:
 	float                                              SuspensionVariance;                               		// 0x0130 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10245,7 +10245,7 @@ public:
 	unsigned long                                      bActive : 1;                                      		// 0x027C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10265,7 +10265,7 @@ public:
 	TArray<struct FTrilogyUniqueAchievementData>       StaticTrilogyUniqueAchievementData;               		// 0x00D8 (0x0010) [0x0000000000404001]              ( CPF_Edit | CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10288,7 +10288,7 @@ public:
 	TArray<struct FSFXVocalizationEventV2>             VocalizationsV2;                                  		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10312,7 +10312,7 @@ public:
 	unsigned long                                      bAlwaysPlay : 1;                                  		// 0x02AC (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10342,7 +10342,7 @@ public:
 	TArray<class UObject*>                             EnumForType;                                      		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10362,7 +10362,7 @@ public:
 	TArray<struct SFXName>                             m_sRowLabel;                                      		// 0x0158 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10413,7 +10413,7 @@ public:
 	TArray<int>                                        m_lstRowNumbers;                                  		// 0x01C0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10430,7 +10430,7 @@ public:
 	class UBioAnimNodeBlend_TurnInPlace*               ActiveTurnInPlaceNode;                            		// 0x0118 (0x0008) [0x0000000000002002]              ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10446,7 +10446,7 @@ public:
 	class UAnimNode*                                   Parent;                                           		// 0x0078 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10462,7 +10462,7 @@ public:
 	unsigned long                                      bInitialized : 1;                                 		// 0x0070 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10487,7 +10487,7 @@ public:
 	unsigned char                                      AimInput;                                         		// 0x01AC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10522,7 +10522,7 @@ public:
 	unsigned long                                      bTransitioningToIdle : 1;                         		// 0x017C (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10546,7 +10546,7 @@ public:
 	unsigned long                                      m_bShowSlider : 1;                                		// 0x0118 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10561,7 +10561,7 @@ class UBioAnimNodeBlendAdditive : public UBioAnimNodeBlendBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10577,7 +10577,7 @@ public:
 	float                                              BlendOutDuration;                                 		// 0x0120 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10597,7 +10597,7 @@ public:
 	unsigned long                                      bProcessDamage : 1;                               		// 0x0134 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10625,7 +10625,7 @@ public:
 	unsigned long                                      m_bEventTriggered : 1;                            		// 0x0168 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10644,7 +10644,7 @@ public:
 	unsigned long                                      bForceLevelReferenceAngle : 1;                    		// 0x012C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10664,7 +10664,7 @@ public:
 	unsigned long                                      m_bSwitchingLean : 1;                             		// 0x0130 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10684,7 +10684,7 @@ public:
 	unsigned long                                      m_bWasMoving : 1;                                 		// 0x012C (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10702,7 +10702,7 @@ public:
 	unsigned long                                      m_bIsStarting : 1;                                		// 0x0128 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10716,7 +10716,7 @@ class UBioAnimNodeBlendGetUp : public UBioAnimNodeBlendBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10730,7 +10730,7 @@ class UBioAnimNodeBlendMoveStop : public UBioAnimNodeBlendBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10747,7 +10747,7 @@ public:
 	unsigned long                                      m_bBasePoseForEachChild : 1;                      		// 0x0168 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10764,7 +10764,7 @@ public:
 	float                                              m_fBlinkBlendOutTime;                             		// 0x0174 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10781,7 +10781,7 @@ public:
 	TArray<struct FBioChildPinData>                    m_aChildPinData;                                  		// 0x018C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10799,7 +10799,7 @@ public:
 	unsigned long                                      m_bTransIsOneShot : 1;                            		// 0x0134 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10826,7 +10826,7 @@ public:
 	unsigned long                                      m_bUseBlendSpanTime : 1;                          		// 0x0170 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10849,7 +10849,7 @@ public:
 	unsigned long                                      m_bFinishSkidStarted : 1;                         		// 0x0138 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10876,7 +10876,7 @@ public:
 	unsigned char                                      SpeedType;                                        		// 0x0148 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10894,7 +10894,7 @@ public:
 	int                                                m_nActiveChild;                                   		// 0x013C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10914,7 +10914,7 @@ public:
 	unsigned char                                      m_currentState;                                   		// 0x0130 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10932,7 +10932,7 @@ public:
 	unsigned char                                      m_eCurrentAnimNode;                               		// 0x0514 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10955,7 +10955,7 @@ public:
 	unsigned long                                      bUseMirrored : 1;                                 		// 0x013C (0x0004) [0x0000000000002001] [0x00000001] ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10969,7 +10969,7 @@ class UBioAnimNodeBlendByCustomAnim : public UAnimNodeBlend
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -10985,7 +10985,7 @@ public:
 	unsigned long                                      bAdditiveMode : 1;                                		// 0x0120 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11006,7 +11006,7 @@ public:
 	unsigned long                                      CacheUpdated : 1;                                 		// 0x0154 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11023,7 +11023,7 @@ public:
 	float                                              BlendDuration;                                    		// 0x0110 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11039,7 +11039,7 @@ public:
 	unsigned char                                      NotifyActive;                                     		// 0x0120 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11054,7 +11054,7 @@ class UBioAnimNodeBlendByReload : public UAnimNodeBlendList
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11072,7 +11072,7 @@ public:
 	float                                              Storm2IdleBlendDuration;                          		// 0x0128 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11086,7 +11086,7 @@ class UBioAnimNodeBlendByWeaponAction : public UAnimNodeBlendList
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11107,7 +11107,7 @@ public:
 	unsigned long                                      bDisabledIK : 1;                                  		// 0x012C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11126,7 +11126,7 @@ public:
 	unsigned long                                      bRootMotionOverridden : 1;                        		// 0x0124 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11161,7 +11161,7 @@ public:
 	float                                              CurrentRunRate;                                   		// 0x0174 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11183,7 +11183,7 @@ public:
 	unsigned char                                      BoneBlendType;                                    		// 0x016C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11198,7 +11198,7 @@ public:
 	TArray<struct FBioAnimScalarNodeBehaviorDef>       m_aNodeDefinitions;                               		// 0x0060 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11220,7 +11220,7 @@ public:
 	unsigned char                                      AxisDirMode;                                      		// 0x0077 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11236,7 +11236,7 @@ public:
 	float                                              m_fQueryPlayTime;                                 		// 0x0070 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11252,7 +11252,7 @@ public:
 	unsigned char                                      ActionBehavior;                                   		// 0x0078 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11270,7 +11270,7 @@ public:
 	unsigned char                                      CombatBehavior;                                   		// 0x0078 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11303,7 +11303,7 @@ public:
 	unsigned char                                      AxisDirMode;                                      		// 0x0096 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11323,7 +11323,7 @@ public:
 	float                                              DirAngle;                                         		// 0x011C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11338,7 +11338,7 @@ public:
 	int                                                m_nCurrentAnimNode;                               		// 0x011C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11355,7 +11355,7 @@ public:
 	float                                              YawTurnTriggerDegrees;                            		// 0x0128 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11382,7 +11382,7 @@ public:
 	float                                              Aimback2DefaultBlendDuration;                     		// 0x0150 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11401,7 +11401,7 @@ public:
 	unsigned char                                      PendingCoverDirection;                            		// 0x0129 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11418,7 +11418,7 @@ public:
 	float                                              Move2IdleBlendDuration;                           		// 0x0128 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11433,7 +11433,7 @@ public:
 	float                                              BlendTime;                                        		// 0x011C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11466,7 +11466,7 @@ public:
 	unsigned char                                      RootRotationMode;                                 		// 0x013E (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11482,7 +11482,7 @@ public:
 	unsigned char                                      LastCoverAction;                                  		// 0x011C (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11499,7 +11499,7 @@ public:
 	unsigned long                                      m_bCaptureOnRelevant : 1;                         		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11520,7 +11520,7 @@ public:
 	float                                              StopToStartBlendDuration;                         		// 0x0134 (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11548,7 +11548,7 @@ public:
 	float                                              Incline;                                          		// 0x013C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11566,7 +11566,7 @@ public:
 	float                                              WalkSpeed;                                        		// 0x012C (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11591,7 +11591,7 @@ public:
 	unsigned long                                      bOverrideRMR : 1;                                 		// 0x0158 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11610,7 +11610,7 @@ public:
 	unsigned long                                      bOverrideRootMotion : 1;                          		// 0x0138 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11626,7 +11626,7 @@ public:
 	unsigned long                                      bForceChildOnActive : 1;                          		// 0x013C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11648,7 +11648,7 @@ public:
 	unsigned long                                      bRandomizeStartTime : 1;                          		// 0x0178 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11665,7 +11665,7 @@ public:
 	unsigned char                                      BoneAxis;                                         		// 0x0154 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11685,7 +11685,7 @@ public:
 	unsigned long                                      bUseMirrored : 1;                                 		// 0x015C (0x0004) [0x0000000000002001] [0x00000001] ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11701,7 +11701,7 @@ public:
 	unsigned long                                      IsGlobal : 1;                                     		// 0x0068 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11716,7 +11716,7 @@ public:
 	struct SFXName                                     m_nmVisualEffectLabel;                            		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11741,7 +11741,7 @@ public:
 	unsigned long                                      bInvertRoll : 1;                                  		// 0x0130 (0x0004) [0x0000000000000001] [0x00000020] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11757,7 +11757,7 @@ public:
 	unsigned long                                      bSeparateUpDownLimit : 1;                         		// 0x014C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11793,7 +11793,7 @@ public:
 	unsigned char                                      nTransitionType;                                  		// 0x01C6 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11813,7 +11813,7 @@ public:
 	unsigned long                                      bIdle : 1;                                        		// 0x0140 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11834,7 +11834,7 @@ public:
 	int                                                HighestIndex;                                     		// 0x0120 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11849,7 +11849,7 @@ public:
 	float                                              BaseSpeeds[ 0x8 ];                                		// 0x0124 (0x0020) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11870,7 +11870,7 @@ public:
 	unsigned long                                      bPoseCached : 1;                                  		// 0x0180 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11889,7 +11889,7 @@ public:
 	class UWwiseEvent*                                 ExertionEvent;                                    		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11904,7 +11904,7 @@ public:
 	class UAnimSet*                                    AnimSet;                                          		// 0x0060 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -11966,7 +11966,7 @@ public:
 	unsigned char                                      m_PendingDoorState;                               		// 0x03E2 (0x0001) [0x0000000000002020]              ( CPF_Net | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12001,7 +12001,7 @@ class ASFXGoreActor : public ASkeletalMeshActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12020,7 +12020,7 @@ public:
 	int                                                CurrentProfile;                                   		// 0x0124 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12038,7 +12038,7 @@ public:
 	unsigned long                                      bFemale : 1;                                      		// 0x0104 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12061,7 +12061,7 @@ public:
 	unsigned long                                      bLockFoot : 1;                                    		// 0x0150 (0x0004) [0x0000000000002002] [0x00000001] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12087,7 +12087,7 @@ public:
 	unsigned long                                      bLockFoot : 1;                                    		// 0x0154 (0x0004) [0x0000000000002002] [0x00000002] ( CPF_Const | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12111,7 +12111,7 @@ public:
 	unsigned long                                      bHasWrinkles : 1;                                 		// 0x0314 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12139,7 +12139,7 @@ public:
 	unsigned long                                      bHasWrinkles : 1;                                 		// 0x031C (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12168,7 +12168,7 @@ public:
 	unsigned long                                      bCausesPlayerPortArms : 1;                        		// 0x02A8 (0x0004) [0x0040000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12208,7 +12208,7 @@ public:
 	unsigned char                                      ePathNodeGenerator;                               		// 0x02D1 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12230,7 +12230,7 @@ public:
 	unsigned long                                      ValidCurrentTrigger : 1;                          		// 0x007C (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12249,7 +12249,7 @@ public:
 	unsigned char                                      FloorTierIndex;                                   		// 0x008C (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12282,7 +12282,7 @@ public:
 	unsigned char                                      Tier;                                             		// 0x02EC (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12379,7 +12379,7 @@ public:
 	unsigned char                                      m_nJournalSortMethod;                             		// 0x09D7 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12456,7 +12456,7 @@ public:
 	struct FSFXGalaxyTemplates_SystemScanning          ScanningTemplates;                                		// 0x04A8 (0x0040) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12482,7 +12482,7 @@ public:
 	unsigned char                                      m_eOptionalPaneResourceType;                      		// 0x009C (0x0001) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12503,7 +12503,7 @@ public:
 	TArray<struct FSFXChoiceEntryNoStrRef>             lstChoicesNoStrRef;                               		// 0x00A0 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12525,7 +12525,7 @@ public:
 	int                                                srDefaultBButtonText;                             		// 0x00D4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12558,7 +12558,7 @@ public:
 	unsigned char                                      ItemType;                                         		// 0x0240 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12580,7 +12580,7 @@ public:
 	int                                                srDefaultBButtonText;                             		// 0x00D4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12594,7 +12594,7 @@ class USFXGameViewportClient : public UGFxGameViewportClient
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12625,7 +12625,7 @@ public:
 	unsigned char                                      MessageType;                                      		// 0x00B1 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12661,7 +12661,7 @@ public:
 	unsigned long                                      bComputerOpen : 1;                                		// 0x00DC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12756,7 +12756,7 @@ public:
 	unsigned char                                      ScreenLayout;                                     		// 0x02EC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12859,7 +12859,7 @@ public:
 	unsigned char                                      eGameMode;                                        		// 0x0330 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12939,7 +12939,7 @@ public:
 	unsigned char                                      CachedDifficulty;                                 		// 0x0459 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -12986,7 +12986,7 @@ public:
 	unsigned char                                      OptionId;                                         		// 0x0060 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13012,7 +13012,7 @@ public:
 	unsigned char                                      LanguageType;                                     		// 0x007C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13035,7 +13035,7 @@ public:
 	FString                                            CurrentTextLanguage;                              		// 0x0080 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13052,7 +13052,7 @@ class USFXGUI_Option_TextLanguage : public USFXGUI_Option_LanguageBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13087,7 +13087,7 @@ public:
 	unsigned long                                      m_bReticleVisible : 1;                            		// 0x03C0 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13134,7 +13134,7 @@ public:
 	unsigned long                                      m_bSubscribeToImpacts : 1;                        		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000200] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13171,7 +13171,7 @@ public:
 	unsigned long                                      m_fCacheTargetInSights : 1;                       		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13197,7 +13197,7 @@ public:
 	unsigned long                                      bKeyboardVisible : 1;                             		// 0x00A8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13314,7 +13314,7 @@ public:
 	unsigned char                                      m_eLastBrowserWheelSubPage;                       		// 0x0478 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13467,7 +13467,7 @@ class UBioSFHandler_Splash : public USFXGUIMovie
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13497,7 +13497,7 @@ public:
 	unsigned long                                      bWaitingForOrigin : 1;                            		// 0x0328 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13531,7 +13531,7 @@ class USFXGUI_PCSplashScreen : public USFXGUI_SplashScreen
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13575,7 +13575,7 @@ public:
 	unsigned char                                      m_eFlashingCreditState;                           		// 0x0380 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13625,7 +13625,7 @@ public:
 	unsigned long                                      bDestinationRequested : 1;                        		// 0x031C (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13687,7 +13687,7 @@ public:
 	int                                                ViewText;                                         		// 0x03C0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13734,7 +13734,7 @@ public:
 	float                                              StartTime;                                        		// 0x0330 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13796,7 +13796,7 @@ public:
 	unsigned long                                      m_bOpenedFromMainMenu : 1;                        		// 0x03BC (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13841,7 +13841,7 @@ public:
 	float                                              TextStayUpDuration;                               		// 0x030C (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13881,7 +13881,7 @@ public:
 	float                                              ScreenLocationY;                                  		// 0x0318 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -13950,7 +13950,7 @@ public:
 	unsigned long                                      bInNestedStore : 1;                               		// 0x056C (0x0004) [0x0000000000000000] [0x00000200] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14021,7 +14021,7 @@ public:
 	unsigned long                                      bIsScriptLoaded : 1;                              		// 0x0328 (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14056,7 +14056,7 @@ public:
 	unsigned long                                      UnloadOnClose : 1;                                		// 0x0300 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14128,7 +14128,7 @@ public:
 	unsigned char                                      PendingCommand;                                   		// 0x0445 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14240,7 +14240,7 @@ public:
 	FString                                            ReplacementTextureSymbol;                         		// 0x0304 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14272,7 +14272,7 @@ public:
 	unsigned char                                      m_eDisplayMode;                                   		// 0x0350 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14299,7 +14299,7 @@ public:
 	int                                                srCancel;                                         		// 0x0368 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14348,7 +14348,7 @@ public:
 	unsigned long                                      m_bStopScroll : 1;                                		// 0x03B4 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14382,7 +14382,7 @@ public:
 	class USFXGameChoiceGUIData_PRCShop*               m_ChoiceDataNoStrRef;                             		// 0x03C8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14428,7 +14428,7 @@ public:
 	unsigned long                                      m_bEnforcing16x9 : 1;                             		// 0x03E8 (0x0004) [0x0000000000002000] [0x00000040] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14475,7 +14475,7 @@ public:
 	float                                              AccumulationDivisor;                              		// 0x03F8 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14500,7 +14500,7 @@ public:
 	unsigned long                                      m_bCanInvoke : 1;                                 		// 0x03CC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14599,7 +14599,7 @@ public:
 	unsigned long                                      m_bFullCleanupOnClose : 1;                        		// 0x0594 (0x0004) [0x0000000000000000] [0x00002000] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14675,7 +14675,7 @@ public:
 	unsigned long                                      m_bActionTextVisible : 1;                         		// 0x05B4 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14720,7 +14720,7 @@ public:
 	unsigned char                                      m_CerbConnectState;                               		// 0x0380 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14770,7 +14770,7 @@ class UBioSFHandler_PCMainMenu : public UBioSFHandler_MainMenu
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14807,7 +14807,7 @@ public:
 	unsigned long                                      m_bPausedPriorToWeaponChoice : 1;                 		// 0x03A0 (0x0004) [0x0000000000002000] [0x00000200] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14861,7 +14861,7 @@ class UBioSFHandler_PCMessageBox : public UBioSFHandler_MessageBox
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -14947,7 +14947,7 @@ public:
 	unsigned char                                      SelectedGameType;                                 		// 0x0522 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15046,7 +15046,7 @@ public:
 	unsigned long                                      bHeadLookEnabled : 1;                             		// 0x0534 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15089,7 +15089,7 @@ public:
 	int                                                CaptureBindNumber;                                		// 0x04D0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15128,7 +15128,7 @@ public:
 	unsigned long                                      bMessageBoxVisible : 1;                           		// 0x0338 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15157,7 +15157,7 @@ public:
 	unsigned long                                      m_bCanceled : 1;                                  		// 0x039C (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15187,7 +15187,7 @@ public:
 	int                                                m_nConsoleBurnDown;                               		// 0x03C0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15207,7 +15207,7 @@ public:
 	float                                              m_fSpeed;                                         		// 0x03A8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15254,7 +15254,7 @@ public:
 	int                                                m_srConfirmCodeRedemptionText;                    		// 0x0450 (0x0004) [0x0000000000004002]              ( CPF_Const | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15441,7 +15441,7 @@ public:
 	unsigned char                                      m_eCurrentPOIState;                               		// 0x08BD (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15560,7 +15560,7 @@ public:
 	unsigned char                                      CombatAppearance;                                 		// 0x048C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15620,7 +15620,7 @@ public:
 	unsigned long                                      bInitialized : 1;                                 		// 0x037C (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15763,7 +15763,7 @@ public:
 	unsigned char                                      m_ePowerWheelMode;                                		// 0x07FC (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15859,7 +15859,7 @@ public:
 	unsigned char                                      m_ShepardPreviousPhysics;                         		// 0x0C58 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -15945,7 +15945,7 @@ public:
 	unsigned char                                      GuiMode;                                          		// 0x0400 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16028,7 +16028,7 @@ public:
 	unsigned char                                      LoadMode;                                         		// 0x04E0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16086,7 +16086,7 @@ public:
 	unsigned long                                      m_bCanExit : 1;                                   		// 0x03A0 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16115,7 +16115,7 @@ public:
 	int                                                m_nFSHandlerID;                                   		// 0x0060 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16145,7 +16145,7 @@ public:
 	unsigned long                                      AbortRequested : 1;                               		// 0x00D0 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16193,7 +16193,7 @@ public:
 	unsigned char                                      DefaultPawnAimNodeToAttachTo;                     		// 0x01DC (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16230,7 +16230,7 @@ public:
 	float                                              DisplayRange;                                     		// 0x01F4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16248,7 +16248,7 @@ public:
 	unsigned long                                      PreviousHenchmanIsDown : 1;                       		// 0x01E8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16268,7 +16268,7 @@ public:
 	unsigned long                                      ShouldPlaySpawn : 1;                              		// 0x01F0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16297,7 +16297,7 @@ public:
 	unsigned long                                      PreviousPlayerIsDead : 1;                         		// 0x0200 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16342,7 +16342,7 @@ public:
 	unsigned char                                      eDesiredState;                                    		// 0x01BD (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16384,7 +16384,7 @@ public:
 	unsigned long                                      bCooldownActive : 1;                              		// 0x01C0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16411,7 +16411,7 @@ class USFXGUIValue_QuickSlotPowerIcon : public USFXGUIValue_PowerIcon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16436,7 +16436,7 @@ public:
 	unsigned long                                      m_bShowMessage : 1;                               		// 0x0070 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16468,7 +16468,7 @@ public:
 	unsigned long                                      m_bInTransitionOut : 1;                           		// 0x009C (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16488,7 +16488,7 @@ class USFXSF_ReticleCombatObject : public USFXSF_ReticleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16513,7 +16513,7 @@ public:
 	unsigned long                                      m_bDoingActionFlourish : 1;                       		// 0x00D4 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16531,7 +16531,7 @@ public:
 	TArray<struct FSFXWeaponModData>                   m_aMods;                                          		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16562,7 +16562,7 @@ public:
 	unsigned long                                      DataIsLoaded : 1;                                 		// 0x00DC (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16614,7 +16614,7 @@ public:
 	float                                              m_fFocusDistanceTarget;                           		// 0x00C0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16659,7 +16659,7 @@ public:
 	unsigned long                                      bRecenterCancelled : 1;                           		// 0x011C (0x0004) [0x0000000000000000] [0x00000400] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16702,7 +16702,7 @@ public:
 	unsigned long                                      bClampMouse : 1;                                  		// 0x0078 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16717,7 +16717,7 @@ public:
 	float                                              m_fCameraCollisionTestPointRange;                 		// 0x0120 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16731,7 +16731,7 @@ class UBioCameraBehavior : public UBioCameraUtility
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16762,7 +16762,7 @@ public:
 	unsigned long                                      m_bIdleCamEnabled : 1;                            		// 0x0198 (0x0004) [0x0000000000004000] [0x00000002] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16892,7 +16892,7 @@ public:
 	unsigned long                                      m_bCanDoSystemScan : 1;                           		// 0x0520 (0x0004) [0x0000000000002000] [0x00002000] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16947,7 +16947,7 @@ public:
 	struct FScreenShakeStruct                          TestShake;                                        		// 0x0090 (0x0078) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -16983,7 +16983,7 @@ public:
 	unsigned long                                      bUseCameraRotation : 1;                           		// 0x057C (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17046,7 +17046,7 @@ public:
 	unsigned long                                      bUnaware : 1;                                     		// 0x05B0 (0x0004) [0x0000000000002000] [0x00000200] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17153,7 +17153,7 @@ public:
 	unsigned char                                      CombatMood;                                       		// 0x05DC (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17231,7 +17231,7 @@ public:
 	unsigned char                                      CurrentProfile;                                   		// 0x0160 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17806,7 +17806,7 @@ public:
 	unsigned char                                      bWantsToZoom;                                     		// 0x03C8 (0x0001) [0x0000000000000004]              ( CPF_Input )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17856,7 +17856,7 @@ public:
 	unsigned long                                      m_bCurrentSelectionIsCombatTarget : 1;            		// 0x00A4 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17875,7 +17875,7 @@ public:
 	int                                                ConstraintEvaluationPriority;                     		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17892,7 +17892,7 @@ public:
 	TArray<struct FEnemyData>                          Enemies;                                          		// 0x0064 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17908,7 +17908,7 @@ public:
 	struct FVector                                     CombatZoneOrigin;                                 		// 0x0064 (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17924,7 +17924,7 @@ public:
 	TArray<struct FValidEnemyCacheDatum>               ValidEnemyCache;                                  		// 0x0064 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17943,7 +17943,7 @@ public:
 	unsigned long                                      bHardLimits : 1;                                  		// 0x0070 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17964,7 +17964,7 @@ public:
 	unsigned long                                      bIgnoreCoverOutOfRange : 1;                       		// 0x0074 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -17984,7 +17984,7 @@ public:
 	unsigned long                                      bRestrictMaxDistance : 1;                         		// 0x0078 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18004,7 +18004,7 @@ public:
 	unsigned long                                      bHardConstraint : 1;                              		// 0x0078 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18021,7 +18021,7 @@ public:
 	float                                              MaxWeight;                                        		// 0x0074 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18039,7 +18039,7 @@ public:
 	float                                              MaxWeight;                                        		// 0x0078 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18058,7 +18058,7 @@ public:
 	float                                              MaxWeight;                                        		// 0x0080 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18075,7 +18075,7 @@ public:
 	float                                              MaxWeight;                                        		// 0x0074 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18093,7 +18093,7 @@ public:
 	float                                              MaxWeight;                                        		// 0x0074 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18111,7 +18111,7 @@ public:
 	float                                              MaxWeight;                                        		// 0x0078 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18128,7 +18128,7 @@ public:
 	float                                              MaxWeight;                                        		// 0x0068 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18145,7 +18145,7 @@ public:
 	float                                              MaxWeight;                                        		// 0x0078 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18169,7 +18169,7 @@ public:
 	unsigned long                                      bIncludePathCost : 1;                             		// 0x00B0 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18193,7 +18193,7 @@ public:
 	int                                                BestRating;                                       		// 0x00A0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18210,7 +18210,7 @@ public:
 	TArray<struct FSFXAIPerceptionNoise>               Noises;                                           		// 0x0270 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18239,7 +18239,7 @@ public:
 	unsigned long                                      bFlank : 1;                                       		// 0x00B4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18255,7 +18255,7 @@ class USFXPath_AvoidClaimedCover : public UPathConstraint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18272,7 +18272,7 @@ public:
 	class ASFXAI_Core*                                 AI;                                               		// 0x007C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18288,7 +18288,7 @@ class USFXPath_AvoidPlayer : public UPathConstraint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18305,7 +18305,7 @@ public:
 	float                                              fDistAway;                                        		// 0x0074 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18321,7 +18321,7 @@ public:
 	struct FVector                                     CombatZoneOrigin;                                 		// 0x006C (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18337,7 +18337,7 @@ public:
 	unsigned long                                      m_bOnlyAvoidSubtractive : 1;                      		// 0x006C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18373,7 +18373,7 @@ public:
 	unsigned long                                      m_bUsesRubberMouth : 1;                           		// 0x016C (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18479,7 +18479,7 @@ public:
 	unsigned char                                      m_eControllerType;                                		// 0x035C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18514,7 +18514,7 @@ public:
 	unsigned long                                      m_bActivatingConversation : 1;                    		// 0x00E8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18542,7 +18542,7 @@ public:
 	float                                              LastEventDuration;                                		// 0x00A4 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18575,7 +18575,7 @@ public:
 	unsigned long                                      m_bDisableProceduralCameraHeightAdjust : 1;       		// 0x02EC (0x0004) [0x0000000000006000] [0x00000010] ( CPF_Transient | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18654,7 +18654,7 @@ public:
 	unsigned char                                      RandomReactionRolled;                             		// 0x010C (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18730,7 +18730,7 @@ public:
 	unsigned char                                      m_NextAction;                                     		// 0x015D (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18788,7 +18788,7 @@ public:
 	unsigned char                                      EndRMRM;                                          		// 0x018B (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18822,7 +18822,7 @@ public:
 	class ASFXReachSpecPlaceholderCylinder*            PlaceholderCylinder2;                             		// 0x052C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18852,7 +18852,7 @@ public:
 	class ASFXReachSpecPlaceholderCylinder*            BlockingEndCylinder;                              		// 0x019C (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18876,7 +18876,7 @@ public:
 	unsigned long                                      bTimedOut : 1;                                    		// 0x01A8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18897,7 +18897,7 @@ class USFXCustomAction_BoostDownBase : public USFXCustomAction_ReachSpecMove
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18915,7 +18915,7 @@ public:
 	float                                              fClimbSpeed;                                      		// 0x01A4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18937,7 +18937,7 @@ public:
 	float                                              fStopSpeed;                                       		// 0x01B4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18956,7 +18956,7 @@ public:
 	float                                              fClimbDownSpeed;                                  		// 0x01AC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -18977,7 +18977,7 @@ public:
 	float                                              LeapSpeed;                                        		// 0x01C0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19010,7 +19010,7 @@ public:
 	unsigned long                                      bIgnoreCameraHiding : 1;                          		// 0x0140 (0x0004) [0x0000000000000001] [0x00000080] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19105,7 +19105,7 @@ public:
 	unsigned char                                      HenchmanPowerType;                                		// 0x04E1 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19172,7 +19172,7 @@ public:
 	float                                              LifetimeLeft;                                     		// 0x00AC (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19190,7 +19190,7 @@ class UBioDefine : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19234,7 +19234,7 @@ public:
 	unsigned long                                      bDissableTallentNotifications : 1;                		// 0x00F4 (0x0004) [0x0000000000004000] [0x00000010] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19261,7 +19261,7 @@ public:
 	int                                                PS3_Body;                                         		// 0x0068 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19277,7 +19277,7 @@ public:
 	unsigned char                                      MouseSupport;                                     		// 0x0308 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19329,7 +19329,7 @@ public:
 	unsigned char                                      LastReplicatedInitInfoTrigger;                    		// 0x03A8 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19448,7 +19448,7 @@ public:
 	unsigned char                                      LastReplicatedStickInfoTriggerCounter;            		// 0x0518 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19511,7 +19511,7 @@ public:
 	unsigned long                                      ShowPowerAiming : 1;                              		// 0x05C4 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19542,7 +19542,7 @@ class ASFXProjectile_Trajectory : public AProjectile
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19576,7 +19576,7 @@ public:
 	unsigned char                                      ActiveState;                                      		// 0x02C4 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19618,7 +19618,7 @@ public:
 	unsigned char                                      CharacterSlot;                                    		// 0x03C2 (0x0001) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19643,7 +19643,7 @@ public:
 	class UPrimitiveComponent*                         PickupFactoryMesh;                                		// 0x0060 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19659,7 +19659,7 @@ public:
 	int                                                m_nIndex;                                         		// 0x0068 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19674,7 +19674,7 @@ public:
 	TArray<class UBioGestChainNode*>                   m_aChildren;                                      		// 0x006C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19694,7 +19694,7 @@ public:
 	unsigned long                                      m_bGesturePlaying : 1;                            		// 0x00C0 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19730,7 +19730,7 @@ public:
 	struct SFXName                                     m_nmDefaultPerfGroup;                             		// 0x0318 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19750,7 +19750,7 @@ public:
 	class UAnimSet*                                    m_pDefaultPoseSet;                                		// 0x0130 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19776,7 +19776,7 @@ public:
 	unsigned long                                      m_bSuppressDamage : 1;                            		// 0x00B8 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19792,7 +19792,7 @@ public:
 	class UBioGestureRuntimeData*                      m_pRuntimeData;                                   		// 0x0070 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19847,7 +19847,7 @@ public:
 	unsigned long                                      bDesignerHud : 1;                                 		// 0x067C (0x0004) [0x0000000000004000] [0x00000080] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19940,7 +19940,7 @@ public:
 	unsigned char                                      m_DefaultRenderMode;                              		// 0x007C (0x0001) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -19979,7 +19979,7 @@ public:
 	unsigned long                                      m_bLoaded : 1;                                    		// 0x0270 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20025,7 +20025,7 @@ public:
 	unsigned long                                      bShift : 1;                                       		// 0x0270 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20074,7 +20074,7 @@ public:
 	unsigned long                                      m_bSortByName : 1;                                		// 0x010C (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20122,7 +20122,7 @@ public:
 	int                                                m_nGeneration;                                    		// 0x00C0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20142,7 +20142,7 @@ public:
 	int                                                m_iBoneIndex;                                     		// 0x00D0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20157,7 +20157,7 @@ public:
 	FString                                            m_sCommand;                                       		// 0x00C4 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20172,7 +20172,7 @@ public:
 	FString                                            Filename;                                         		// 0x00C4 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20189,7 +20189,7 @@ public:
 	FPointer                                           Base;                                             		// 0x00E4 (0x0008) [0x0000000000001000]              ( CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20207,7 +20207,7 @@ public:
 	class UProperty*                                   m_Property;                                       		// 0x00EC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20229,7 +20229,7 @@ public:
 	unsigned char                                      byteVal;                                          		// 0x010C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20247,7 +20247,7 @@ public:
 	int                                                otherVal;                                         		// 0x00FC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20263,7 +20263,7 @@ public:
 	FString                                            sDisplay;                                         		// 0x00EC (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20278,7 +20278,7 @@ public:
 	FString                                            Filename;                                         		// 0x00C4 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20292,7 +20292,7 @@ class UBioPropertyEditorVolatileNode : public UBioPropertyEditorBaseNode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20319,7 +20319,7 @@ public:
 	unsigned long                                      m_bAllPoseGroupsLoaded : 1;                       		// 0x00A8 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20333,7 +20333,7 @@ class UBioInterpTrackInstMove : public UInterpTrackInstMove
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20348,7 +20348,7 @@ public:
 	struct SFXName                                     FacingController;                                 		// 0x00E0 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20363,7 +20363,7 @@ public:
 	float                                              ResetFloat;                                       		// 0x0060 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20380,7 +20380,7 @@ public:
 	float                                              InterpValue;                                      		// 0x00B8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20394,7 +20394,7 @@ class USFXGameInterpTrack : public UBioInterpTrack
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20414,7 +20414,7 @@ public:
 	TArray<FString>                                    m_aDbgStrings;                                    		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20439,7 +20439,7 @@ public:
 	float                                              m_fDOFDefaultMaxFarBlur;                          		// 0x00C8 (0x0004) [0x0000000000006000]              ( CPF_Transient | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20459,7 +20459,7 @@ public:
 	TArray<struct FBioInterruptTrackData>              m_aInterruptData;                                 		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20479,7 +20479,7 @@ public:
 	TArray<struct FBioSubtitleTrackData>               m_aSubtitleData;                                  		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20499,7 +20499,7 @@ public:
 	TArray<struct FBioCameraSwitchData>                m_aCameras;                                       		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20520,7 +20520,7 @@ public:
 	float                                              m_fJCutOffset;                                    		// 0x00AC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20540,7 +20540,7 @@ public:
 	TArray<struct FRotationModeTrackKey>               EventTrack;                                       		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20560,7 +20560,7 @@ public:
 	unsigned char                                      m_eFindActorMode;                                 		// 0x00B0 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20583,7 +20583,7 @@ public:
 	unsigned char                                      eStartingPose;                                    		// 0x00DD (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20603,7 +20603,7 @@ public:
 	TArray<struct FBioConvLightingData>                m_aLightingKeys;                                  		// 0x00B4 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20623,7 +20623,7 @@ public:
 	TArray<struct FBioLookAtTrackData>                 m_aLookAtKeys;                                    		// 0x00B4 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20643,7 +20643,7 @@ public:
 	TArray<struct FBioPropTrackData>                   m_aPropKeys;                                      		// 0x00B4 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20692,7 +20692,7 @@ public:
 	TArray<struct FBioSetFacingData>                   m_aFacingKeys;                                    		// 0x00B4 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20713,7 +20713,7 @@ public:
 	class UWwiseEventPairObject*                       m_TrackFoleySound;                                		// 0x00C4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20732,7 +20732,7 @@ public:
 	TArray<struct FBioFOVOTrackData>                   m_aFOVOKeys;                                      		// 0x00B4 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20751,7 +20751,7 @@ class USFXGameInterpTrackCustom : public USFXGameInterpTrack
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20771,7 +20771,7 @@ public:
 	class UObject*                                     oEffect;                                          		// 0x00C8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20798,7 +20798,7 @@ public:
 	unsigned long                                      bUseRelativeRotation : 1;                         		// 0x00D8 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20821,7 +20821,7 @@ public:
 	class UObject*                                     m_oEffect;                                        		// 0x00CC (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20842,7 +20842,7 @@ public:
 	class UBioSeqAct_BlackScreen*                      m_BlackScreenSeq;                                 		// 0x00B8 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20861,7 +20861,7 @@ public:
 	TArray<class UBioSeqVar_ObjectFindByTag*>          m_aTarget;                                        		// 0x00A8 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20881,7 +20881,7 @@ public:
 	class UBioSeqAct_ForceLightEnvUpdate*              m_SeqForceUpdateLight;                            		// 0x00A8 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20901,7 +20901,7 @@ public:
 	class UBioSeqAct_SetLightEnvQuality*               m_LightEnvSeq;                                    		// 0x00B8 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20920,7 +20920,7 @@ public:
 	TArray<struct FSFXMoviePlayStateData>              m_aMovieKeyData;                                  		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20940,7 +20940,7 @@ public:
 	unsigned long                                      m_bIgnoreGrowing : 1;                             		// 0x00D4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20958,7 +20958,7 @@ public:
 	class UTextureMovie*                               m_oTextureMovie;                                  		// 0x00B8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20977,7 +20977,7 @@ public:
 	TArray<struct FSFXNearClipTrackData>               m_aNearClipKeyData;                               		// 0x00A8 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -20998,7 +20998,7 @@ public:
 	class ABioPawn*                                    m_Pawn;                                           		// 0x00C0 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21019,7 +21019,7 @@ public:
 	class AActor*                                      m_TargetActor;                                    		// 0x00C8 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21038,7 +21038,7 @@ class USFXInterpTrackToggleAffectedByHitEffects : public USFXInterpTrackToggleBa
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21056,7 +21056,7 @@ class USFXInterpTrackToggleHidden : public USFXInterpTrackToggleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21075,7 +21075,7 @@ public:
 	class UBioSeqAct_ToggleLightEnv*                   m_LightEnvSeq;                                    		// 0x00D0 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21094,7 +21094,7 @@ public:
 	unsigned long                                      m_bUnlockAtEnd : 1;                               		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21112,7 +21112,7 @@ class USFXGameInterpTrackInst : public UBioInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21128,7 +21128,7 @@ public:
 	int                                                m_nCurEffect;                                     		// 0x0068 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21143,7 +21143,7 @@ public:
 	class UBioConversationController*                  m_pConvCont;                                      		// 0x0064 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21157,7 +21157,7 @@ class UBioEvtSysTrackSubtitlesInst : public USFXGameInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21172,7 +21172,7 @@ public:
 	class UBioEvtSysTrackDOF*                          m_pDOFTrack;                                      		// 0x0064 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21187,7 +21187,7 @@ public:
 	class UBioConversationController*                  m_pConvCont;                                      		// 0x0064 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21202,7 +21202,7 @@ public:
 	float                                              LastUpdatePosition;                               		// 0x0064 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21217,7 +21217,7 @@ public:
 	class AActor*                                      m_pActor;                                         		// 0x0064 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21233,7 +21233,7 @@ public:
 	unsigned long                                      m_bBelongsToConversation : 1;                     		// 0x00B4 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21249,7 +21249,7 @@ public:
 	unsigned long                                      ResetLightingData : 1;                            		// 0x00BC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21263,7 +21263,7 @@ class UBioEvtSysTrackLookAtInst : public USFXGameActorInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21280,7 +21280,7 @@ public:
 	unsigned long                                      m_bBelongsToConversation : 1;                     		// 0x00FC (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21298,7 +21298,7 @@ class UBioEvtSysTrackSetFacingInst : public USFXGameActorInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21313,7 +21313,7 @@ public:
 	unsigned long                                      m_bBelongsToConversation : 1;                     		// 0x006C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21328,7 +21328,7 @@ public:
 	TArray<class UBioSeqAct_FaceOnlyVO*>               m_aFOVOObjects;                                   		// 0x006C (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21342,7 +21342,7 @@ class USFXGameInterpTrackInstCustom : public USFXGameInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21358,7 +21358,7 @@ public:
 	unsigned long                                      m_bIsPlaying : 1;                                 		// 0x006C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21373,7 +21373,7 @@ public:
 	struct FMap_Mirror                                 m_mapCachedActors;                                		// 0x0064 (0x0048) [0x0000000000003000]              ( CPF_Native | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21387,7 +21387,7 @@ class USFXInterpTrack_MoveTo : public UInterpTrackMove
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21403,7 +21403,7 @@ public:
 	struct FRotator                                    StartRotation;                                    		// 0x00D8 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21418,7 +21418,7 @@ public:
 	struct SFXName                                     m_nmKismetBoolVarName;                            		// 0x0080 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21438,7 +21438,7 @@ public:
 	unsigned char                                      Variable;                                         		// 0x0097 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21453,7 +21453,7 @@ public:
 	class USFXSceneGroup*                              m_pLinkedScene;                                   		// 0x0080 (0x0008) [0x0000000000020001]              ( CPF_Edit | CPF_EditConst )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21467,7 +21467,7 @@ class USFXSceneShopNodeStart : public USFXSceneShopNode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21481,7 +21481,7 @@ class UBioInterpolator : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21507,7 +21507,7 @@ public:
 	unsigned char                                      RootAnimBoneUpAxis;                               		// 0x0081 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21524,7 +21524,7 @@ public:
 	unsigned long                                      Instant : 1;                                      		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21541,7 +21541,7 @@ public:
 	struct FExpressionInput                            SpecPower;                                        		// 0x00A0 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21558,7 +21558,7 @@ public:
 	struct FExpressionInput                            SpecPower;                                        		// 0x00A0 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21576,7 +21576,7 @@ public:
 	class UTexture2D*                                  GrimeTex;                                         		// 0x0090 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21593,7 +21593,7 @@ public:
 	unsigned long                                      Inverted : 1;                                     		// 0x0084 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21607,7 +21607,7 @@ class UBioMaterialExpressionHalfAngle : public UMaterialExpression
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21626,7 +21626,7 @@ public:
 	int                                                FlipTexCols;                                      		// 0x00AC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21643,7 +21643,7 @@ public:
 	struct FExpressionInput                            SpecPower;                                        		// 0x00A0 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21659,7 +21659,7 @@ public:
 	struct FExpressionInput                            B;                                                		// 0x0080 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21674,7 +21674,7 @@ public:
 	struct FExpressionInput                            Input;                                            		// 0x0060 (0x0020) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21689,7 +21689,7 @@ public:
 	int                                                m_nWoundNumber;                                   		// 0x0060 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21706,7 +21706,7 @@ public:
 	TArray<struct FScalarParameter>                    m_aScalarOverrides;                               		// 0x0080 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21742,7 +21742,7 @@ public:
 	unsigned long                                      m_bDisableBlinksAndNoise : 1;                     		// 0x0174 (0x0004) [0x0040000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21773,7 +21773,7 @@ public:
 	unsigned long                                      bRequiresDynamicUpdates : 1;                      		// 0x00D8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21801,7 +21801,7 @@ public:
 	unsigned long                                      m_bStepped : 1;                                   		// 0x0078 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21817,7 +21817,7 @@ public:
 	TArray<struct FColor>                              m_acColours;                                      		// 0x008C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21831,7 +21831,7 @@ class UBioMorphFaceFESliderHair : public UBioMorphFaceFESliderBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21850,7 +21850,7 @@ public:
 	unsigned long                                      m_bSingle : 1;                                    		// 0x00A4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21866,7 +21866,7 @@ public:
 	TArray<float>                                      m_afValues;                                       		// 0x008C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21882,7 +21882,7 @@ public:
 	TArray<float>                                      m_afValues;                                       		// 0x008C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21898,7 +21898,7 @@ public:
 	TArray<class UTexture*>                            m_atTexture;                                      		// 0x008C (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21912,7 +21912,7 @@ class UBioMorphUtility : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21938,7 +21938,7 @@ public:
 	unsigned long                                      bIsMale : 1;                                      		// 0x01A8 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -21988,7 +21988,7 @@ public:
 	unsigned long                                      PlayerIsMale : 1;                                 		// 0x0194 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22002,7 +22002,7 @@ class UBioEmissionAreaList : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22017,7 +22017,7 @@ public:
 	TArray<struct FBoneListEmissionArea>               m_EmissionAreas;                                  		// 0x0060 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22031,7 +22031,7 @@ class UBioParticleModuleBase : public UParticleModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22050,7 +22050,7 @@ public:
 	unsigned char                                      MultipliedProperty;                               		// 0x0078 (0x0001) [0x000000000200000B]              ( CPF_Edit | CPF_Const | CPF_ExportObject | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22072,7 +22072,7 @@ public:
 	unsigned long                                      m_bDuck : 1;                                      		// 0x0084 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22094,7 +22094,7 @@ public:
 	unsigned long                                      bPlayProgrammaticShake : 1;                       		// 0x0114 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22113,7 +22113,7 @@ public:
 	unsigned long                                      bEnableMultiHitDecal : 1;                         		// 0x016C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22136,7 +22136,7 @@ public:
 	unsigned char                                      m_SpecificationType;                              		// 0x00A4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22158,7 +22158,7 @@ public:
 	unsigned char                                      eOnCollision;                                     		// 0x00E1 (0x0001) [0x0000000002000009]              ( CPF_Edit | CPF_ExportObject | CPF_NoClear )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22172,7 +22172,7 @@ class UBioParticleModuleVelocityWorldSpace : public UParticleModuleVelocity
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22509,7 +22509,7 @@ public:
 	unsigned char                                      m_eGetUpState;                                    		// 0x0E34 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22913,7 +22913,7 @@ public:
 	unsigned long                                      m_bAggressivePathPruning : 1;                     		// 0x05F8 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22933,7 +22933,7 @@ public:
 	float                                              CameraArmScale;                                   		// 0x009C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22950,7 +22950,7 @@ public:
 	TArray<struct FBoneOverrideInfo>                   OverrideInfo;                                     		// 0x0434 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22970,7 +22970,7 @@ public:
 	unsigned long                                      bKinematicUntilMoved : 1;                         		// 0x03A4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -22992,7 +22992,7 @@ public:
 	unsigned long                                      m_bToughPlaceable : 1;                            		// 0x03B0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23011,7 +23011,7 @@ public:
 	float                                              m_fPhysicsSoundLastTimePlayed;                    		// 0x03A4 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23027,7 +23027,7 @@ public:
 	float                                              m_fPhysicsSoundLastTimePlayed;                    		// 0x0294 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23043,7 +23043,7 @@ public:
 	struct FMap_Mirror                                 PageMap;                                          		// 0x00A8 (0x0048) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23058,7 +23058,7 @@ public:
 	struct FMap_Mirror                                 DiscoveredCodex;                                  		// 0x0060 (0x0048) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23159,7 +23159,7 @@ public:
 	int                                                ME3__ME2_Plots_for_ME3__Global__Achievements__ChangedDifficulty;		// 0x0294 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23213,7 +23213,7 @@ public:
 	struct FMap_Mirror                                 OutcomeMapping;                                   		// 0x0060 (0x0048) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23231,7 +23231,7 @@ public:
 	struct FMap_Mirror                                 FloatTaskEvalMap;                                 		// 0x0138 (0x0048) [0x0000000000001002]              ( CPF_Const | CPF_Native )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23247,7 +23247,7 @@ public:
 	int                                                nQuestProgressCounter;                            		// 0x00A8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23266,7 +23266,7 @@ public:
 	TArray<int>                                        GalaxyAtWarFloatVarIDs;                           		// 0x00C8 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23280,7 +23280,7 @@ class UBioConsequenceMap : public UBioStateEventMap
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23346,7 +23346,7 @@ public:
 	unsigned char                                      VocalizationEvent;                                		// 0x019B (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23399,7 +23399,7 @@ public:
 	unsigned long                                      SharedCooldownDisabled : 1;                       		// 0x0108 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23457,7 +23457,7 @@ public:
 	unsigned long                                      bLoop : 1;                                        		// 0x009C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23486,7 +23486,7 @@ public:
 	unsigned long                                      bProjectOnShields : 1;                            		// 0x04B8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23500,7 +23500,7 @@ class ABioVisualEffect : public APrefabInstance
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23518,7 +23518,7 @@ public:
 	class USFXGalaxyMapGameData*                       Data;                                             		// 0x0118 (0x0008) [0x0000000004420009]              ( CPF_Edit | CPF_ExportObject | CPF_EditConst | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23547,7 +23547,7 @@ public:
 	unsigned char                                      m_eResource;                                      		// 0x012C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23562,7 +23562,7 @@ class UBioSeqAct_BlockForTextureStreaming : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23578,7 +23578,7 @@ public:
 	unsigned long                                      m_bCopyHairMesh : 1;                              		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23595,7 +23595,7 @@ public:
 	unsigned char                                      Element;                                          		// 0x0108 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23614,7 +23614,7 @@ public:
 	unsigned long                                      bVisible : 1;                                     		// 0x0118 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23629,7 +23629,7 @@ class UBioSeqAct_EndCurrentConvNode : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23643,7 +23643,7 @@ class UBioSeqAct_ForceLightEnvUpdate : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23658,7 +23658,7 @@ public:
 	unsigned long                                      bBlockOnWait : 1;                                 		// 0x0140 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23673,7 +23673,7 @@ public:
 	int                                                nListIndex;                                       		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23688,7 +23688,7 @@ public:
 	unsigned long                                      bGetFurthest : 1;                                 		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23702,7 +23702,7 @@ class UBioSeqAct_PlayLoadingMovie : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23720,7 +23720,7 @@ public:
 	unsigned char                                      Plot;                                             		// 0x010D (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23737,7 +23737,7 @@ public:
 	unsigned char                                      Conditional;                                      		// 0x0118 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23753,7 +23753,7 @@ public:
 	unsigned char                                      State;                                            		// 0x0114 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23769,7 +23769,7 @@ public:
 	unsigned char                                      Transition;                                       		// 0x0114 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23783,7 +23783,7 @@ class UBioSeqAct_PositionFSActors : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23808,7 +23808,7 @@ public:
 	unsigned char                                      Operation;                                        		// 0x0114 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23827,7 +23827,7 @@ public:
 	unsigned char                                      GestureMode;                                      		// 0x011C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23843,7 +23843,7 @@ public:
 	unsigned char                                      Quality;                                          		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23860,7 +23860,7 @@ public:
 	unsigned long                                      NewValue : 1;                                     		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23880,7 +23880,7 @@ public:
 	int                                                nWeapon;                                          		// 0x0108 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23902,7 +23902,7 @@ public:
 	unsigned char                                      m_CompletionState;                                		// 0x011C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23922,7 +23922,7 @@ public:
 	int                                                m_nConsoleBurnDown;                               		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23942,7 +23942,7 @@ public:
 	float                                              m_fSpeed;                                         		// 0x0128 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23965,7 +23965,7 @@ public:
 	unsigned char                                      m_eEventType;                                     		// 0x0124 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23980,7 +23980,7 @@ public:
 	unsigned long                                      bDelayStopUntilGameHasRendered : 1;               		// 0x010C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -23994,7 +23994,7 @@ class UBioSeqAct_ToggleLightEnv : public USeqAct_Toggle
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24008,7 +24008,7 @@ class UBioSeqEvt_BackgroundStreamingDone : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24024,7 +24024,7 @@ public:
 	FString                                            sEvent;                                           		// 0x0128 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24043,7 +24043,7 @@ public:
 	unsigned char                                      eScriptType;                                      		// 0x013C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24059,7 +24059,7 @@ public:
 	int                                                m_nConvResRefID;                                  		// 0x012C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24073,7 +24073,7 @@ class UBioSeqEvt_ForegroundStreamingDone : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24090,7 +24090,7 @@ public:
 	struct SFXName                                     EventParameter;                                   		// 0x0138 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24104,7 +24104,7 @@ class UBioSeqEvt_OnPlayerActivate : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24120,7 +24120,7 @@ public:
 	unsigned long                                      bHasTargets : 1;                                  		// 0x010C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24138,7 +24138,7 @@ public:
 	unsigned char                                      m_eBlackScreenAction;                             		// 0x0118 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24187,7 +24187,7 @@ public:
 	unsigned char                                      m_eConvLine;                                      		// 0x01C9 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24209,7 +24209,7 @@ public:
 	unsigned long                                      IsComplete : 1;                                   		// 0x0140 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24227,7 +24227,7 @@ public:
 	TArray<unsigned char>                              Platforms;                                        		// 0x0144 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24260,7 +24260,7 @@ public:
 	unsigned char                                      m_eResource;                                      		// 0x0150 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24288,7 +24288,7 @@ public:
 	unsigned long                                      PauseGame : 1;                                    		// 0x013C (0x0004) [0x0000000000000001] [0x00000010] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24333,7 +24333,7 @@ public:
 	unsigned long                                      m_bPlayRequested : 1;                             		// 0x0144 (0x0004) [0x0000000000002000] [0x00000200] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24353,7 +24353,7 @@ public:
 	unsigned long                                      m_bBlackOut : 1;                                  		// 0x0154 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24369,7 +24369,7 @@ public:
 	class USFXGameChoiceGUIData*                       m_ChoiceData;                                     		// 0x00B8 (0x0008) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24385,7 +24385,7 @@ public:
 	unsigned long                                      m_bSearchUniqueTag : 1;                           		// 0x00C0 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24404,7 +24404,7 @@ public:
 	unsigned char                                      State;                                            		// 0x00AA (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24423,7 +24423,7 @@ public:
 	unsigned char                                      Float;                                            		// 0x00AA (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24442,7 +24442,7 @@ public:
 	unsigned char                                      Int;                                              		// 0x00AA (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24460,7 +24460,7 @@ public:
 	unsigned char                                      State;                                            		// 0x009A (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24492,7 +24492,7 @@ public:
 	unsigned char                                      SpawnSelectionType;                               		// 0x016C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24513,7 +24513,7 @@ public:
 	unsigned char                                      TREASURE;                                         		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24529,7 +24529,7 @@ class USFXSeqAct_CharCreateClass : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24544,7 +24544,7 @@ public:
 	struct SFXName                                     m_nmTag;                                          		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24565,7 +24565,7 @@ public:
 	float                                              fDisplayTime;                                     		// 0x0118 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24605,7 +24605,7 @@ public:
 	unsigned char                                      TeamIndex;                                        		// 0x0189 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24626,7 +24626,7 @@ public:
 	unsigned long                                      m_bFirstPass : 1;                                 		// 0x010C (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24651,7 +24651,7 @@ public:
 	unsigned long                                      m_bDone : 1;                                      		// 0x0130 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24669,7 +24669,7 @@ class USFXSeqAct_FreezeLevelStreaming : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24689,7 +24689,7 @@ public:
 	unsigned long                                      m_bSuccess : 1;                                   		// 0x0120 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24715,7 +24715,7 @@ public:
 	unsigned long                                      StreamFromDisc : 1;                               		// 0x0128 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24731,7 +24731,7 @@ public:
 	class AActor*                                      oTargetActor;                                     		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24759,7 +24759,7 @@ public:
 	unsigned long                                      m_bDurationUpdating : 1;                          		// 0x0144 (0x0004) [0x0000000000002000] [0x00000010] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24781,7 +24781,7 @@ public:
 	unsigned long                                      m_bSFXCreatedBeforeStuntActorLocationChange : 1;  		// 0x010C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24807,7 +24807,7 @@ public:
 	unsigned long                                      m_bWasWalkingBefore : 1;                          		// 0x0130 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24828,7 +24828,7 @@ public:
 	unsigned long                                      IsComplete : 1;                                   		// 0x0134 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24843,7 +24843,7 @@ class USFXSeqAct_ReportLevelLoadTime : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24861,7 +24861,7 @@ public:
 	unsigned long                                      m_bReturnToDefaultPose : 1;                       		// 0x0110 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24877,7 +24877,7 @@ public:
 	int                                                Value;                                            		// 0x00FC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24901,7 +24901,7 @@ public:
 	unsigned long                                      bInjuredPawn : 1;                                 		// 0x011C (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24927,7 +24927,7 @@ public:
 	unsigned char                                      ePower;                                           		// 0x0138 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24947,7 +24947,7 @@ public:
 	unsigned long                                      DeferredClose : 1;                                		// 0x0114 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24964,7 +24964,7 @@ public:
 	unsigned long                                      bWaitForUnvisibleAndUnloaded : 1;                 		// 0x010C (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24978,7 +24978,7 @@ class USFXSeqAct_WaitUntilLevelIsLive : public USeqAct_Latent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -24998,7 +24998,7 @@ public:
 	unsigned char                                      m_eEventType;                                     		// 0x0150 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25014,7 +25014,7 @@ public:
 	unsigned long                                      m_bInitialized : 1;                               		// 0x0128 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25031,7 +25031,7 @@ public:
 	unsigned long                                      bSkipTextureStreaming : 1;                        		// 0x0128 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25045,7 +25045,7 @@ class USFXSeqEvt_Touch : public USeqEvent_Touch
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25070,7 +25070,7 @@ public:
 	unsigned long                                      m_bCalculatedTag : 1;                             		// 0x00E0 (0x0004) [0x0000000000002000] [0x00000080] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25085,7 +25085,7 @@ public:
 	struct FGuid                                       MyGuid;                                           		// 0x0094 (0x0010) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25100,7 +25100,7 @@ public:
 	unsigned char                                      TipText;                                          		// 0x0094 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25126,7 +25126,7 @@ public:
 	unsigned long                                      IsInvalid : 1;                                    		// 0x00F0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25171,7 +25171,7 @@ public:
 	unsigned long                                      FastForwardMode : 1;                              		// 0x00B0 (0x0004) [0x0000000000004000] [0x00000004] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25216,7 +25216,7 @@ public:
 	struct SFXName                                     HandlerId;                                        		// 0x0104 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25307,7 +25307,7 @@ public:
 	unsigned char                                      m_LoginUIState;                                   		// 0x0131 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25365,7 +25365,7 @@ public:
 	int                                                iMaxBytesPerStorage;                              		// 0x00AC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25392,7 +25392,7 @@ public:
 	unsigned long                                      bUseOldSavingSystem : 1;                          		// 0x00BC (0x0004) [0x0000000000004000] [0x00000002] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25466,7 +25466,7 @@ public:
 	unsigned long                                      PathingTowardCombatZone : 1;                      		// 0x02B0 (0x0004) [0x0000000000000000] [0x00000010] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25519,7 +25519,7 @@ public:
 	unsigned long                                      m_bEngagedHostileAction : 1;                      		// 0x02E4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25551,7 +25551,7 @@ public:
 	class AInterpActor*                                MyLift;                                           		// 0x0390 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25573,7 +25573,7 @@ public:
 	unsigned long                                      bInited : 1;                                      		// 0x0238 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25588,7 +25588,7 @@ public:
 	struct FSquadTargetData                            m_aSimpleSquadTargets[ 0x3 ];                     		// 0x0060 (0x006C) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25619,7 +25619,7 @@ public:
 	unsigned long                                      bOptOut : 1;                                      		// 0x0138 (0x0004) [0x0000000000000000] [0x00000020] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25696,7 +25696,7 @@ public:
 	unsigned long                                      bSentBugSentryHook : 1;                           		// 0x00F8 (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25738,7 +25738,7 @@ public:
 	unsigned long                                      bForceTightAim : 1;                               		// 0x07DC (0x0004) [0x0000000000000001] [0x00000020] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25838,7 +25838,7 @@ public:
 	unsigned long                                      m_bIsPaused : 1;                                  		// 0x08BC (0x0004) [0x0000000000002000] [0x00000020] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25908,7 +25908,7 @@ public:
 	unsigned long                                      bUnPoweredDriving : 1;                            		// 0x0160 (0x0004) [0x0000000000000000] [0x00000400] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25941,7 +25941,7 @@ public:
 	unsigned char                                      Conditional;                                      		// 0x029E (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25958,7 +25958,7 @@ public:
 	unsigned long                                      bAlwaysReachable : 1;                             		// 0x0374 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25974,7 +25974,7 @@ public:
 	FPointer                                           VfTable_FTickableObject;                          		// 0x0224 (0x0008) [0x0000000000801002]              ( CPF_Const | CPF_Native | CPF_NoExport )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -25990,7 +25990,7 @@ public:
 	unsigned long                                      AlwaysShow : 1;                                   		// 0x0280 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26006,7 +26006,7 @@ class USFXAnimNotify_RaceWwiseEvent : public UAnimNotify_WwiseEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26024,7 +26024,7 @@ public:
 	unsigned long                                      m_bAllowCooldown : 1;                             		// 0x0074 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26041,7 +26041,7 @@ public:
 	unsigned long                                      m_bDestroyOnFinished : 1;                         		// 0x0280 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26064,7 +26064,7 @@ class ARvrClientEffectSpawnable : public ARvrClientEffectActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26100,7 +26100,7 @@ public:
 	unsigned long                                      m_bMultiplayer : 1;                               		// 0x0158 (0x0004) [0x0000000000002000] [0x00000200] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26128,7 +26128,7 @@ public:
 	unsigned long                                      m_bIgnoreAttachedActorHiddenState : 1;            		// 0x0064 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26145,7 +26145,7 @@ public:
 	TArray<class URvrClientEffectModule*>              m_lstModules;                                     		// 0x0068 (0x0010) [0x0000000004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26163,7 +26163,7 @@ public:
 	class URvrClientEffectInterface*                   DefaultEffect;                                    		// 0x0078 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26180,7 +26180,7 @@ public:
 	class URvrClientEffectInterface*                   m_pClientEffect;                                  		// 0x0078 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26196,7 +26196,7 @@ public:
 	TArray<class URvrClientEffectInterface*>           m_aEffects;                                       		// 0x0068 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26222,7 +26222,7 @@ public:
 	unsigned long                                      m_bLogOnCleanup_Debug : 1;                        		// 0x00A0 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26280,7 +26280,7 @@ public:
 	unsigned char                                      m_eActivationSelection;                           		// 0x00AA (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26303,7 +26303,7 @@ public:
 	unsigned char                                      PlaySpace;                                        		// 0x00C8 (0x0001) [0x0000008000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26321,7 +26321,7 @@ public:
 	unsigned char                                      m_eTarget;                                        		// 0x00DC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26339,7 +26339,7 @@ public:
 	unsigned char                                      m_eDPG;                                           		// 0x00B6 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26357,7 +26357,7 @@ public:
 	unsigned long                                      m_bSendTimeParam : 1;                             		// 0x00B4 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26372,7 +26372,7 @@ public:
 	class ULensFlare*                                  m_pLensFlare;                                     		// 0x00AC (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26389,7 +26389,7 @@ public:
 	float                                              m_fRequestStop;                                   		// 0x00B4 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26411,7 +26411,7 @@ public:
 	unsigned long                                      m_bCastCompositeShadow : 1;                       		// 0x0120 (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26440,7 +26440,7 @@ public:
 	unsigned char                                      m_eBoneAxis;                                      		// 0x014F (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26454,7 +26454,7 @@ class URvrCEffectModuleMeta : public URvrClientEffectModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26468,7 +26468,7 @@ class URvrCEffectModuleParameters : public URvrClientEffectModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26488,7 +26488,7 @@ public:
 	unsigned long                                      m_bRenderAsVelocity : 1;                          		// 0x00C4 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26508,7 +26508,7 @@ public:
 	unsigned long                                      m_bInstantiateMaterials : 1;                      		// 0x00D4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26524,7 +26524,7 @@ public:
 	class UWwiseEvent*                                 m_pStopEvent;                                     		// 0x00B4 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26562,7 +26562,7 @@ public:
 	unsigned long                                      m_bInstantiateOtherMaterials : 1;                 		// 0x019C (0x0004) [0x0000000000000001] [0x00000800] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26596,7 +26596,7 @@ public:
 	unsigned long                                      m_bHiddenDueToCapsFail : 1;                       		// 0x009C (0x0004) [0x0000000000002000] [0x00000100] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26610,7 +26610,7 @@ class URvrCEffectModuleCameraShakeInstance : public URvrClientEffectModuleInstan
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26628,7 +26628,7 @@ public:
 	class USkeletalMeshComponent*                      m_pTargetWeapon;                                  		// 0x00A8 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26643,7 +26643,7 @@ public:
 	class UParticleSystemComponent*                    m_pPSysComponent;                                 		// 0x00A0 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26659,7 +26659,7 @@ public:
 	class UPostProcessChain*                           m_pPostProcessInstance;                           		// 0x00A0 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26676,7 +26676,7 @@ public:
 	class ULensFlareComponent*                         m_pLFComponent;                                   		// 0x00A0 (0x0008) [0x0000000004082008]              ( CPF_ExportObject | CPF_Transient | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26694,7 +26694,7 @@ public:
 	unsigned long                                      m_bSoftStopSent : 1;                              		// 0x00AC (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26709,7 +26709,7 @@ public:
 	class ALight*                                      m_pLight;                                         		// 0x00A0 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26725,7 +26725,7 @@ public:
 	struct SFXName                                     m_nmHitBone;                                      		// 0x00AC (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26739,7 +26739,7 @@ class URvrCEffectModuleMetaInstance : public URvrClientEffectModuleInstance
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26753,7 +26753,7 @@ class URvrCEffectModuleParametersInstance : public URvrClientEffectModuleInstanc
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26768,7 +26768,7 @@ public:
 	class URadialBlurComponent*                        m_pRBComponent;                                   		// 0x00A0 (0x0008) [0x0000000004082008]              ( CPF_ExportObject | CPF_Transient | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26783,7 +26783,7 @@ public:
 	class USkeletalMeshComponent*                      m_pSkelMesh;                                      		// 0x00A0 (0x0008) [0x0000000004080008]              ( CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26797,7 +26797,7 @@ class URvrCEffectModuleSoundInstance : public URvrClientEffectModuleInstance
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26818,7 +26818,7 @@ public:
 	float                                              m_fSpawnPotential;                                		// 0x00DC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26832,7 +26832,7 @@ class ARvrClientEffectPointLight : public APointLightMovable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26854,7 +26854,7 @@ public:
 	unsigned long                                      m_bInitialized : 1;                               		// 0x01D0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26878,7 +26878,7 @@ public:
 	struct FVector                                     m_vSpawnParameters;                               		// 0x02A0 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26893,7 +26893,7 @@ class URvrComponentPCNetClientEffects : public UActorComponent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26912,7 +26912,7 @@ public:
 	unsigned char                                      m_eImpactClientEffect;                            		// 0x0060 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26927,7 +26927,7 @@ public:
 	unsigned long                                      bAllowCooldown : 1;                               		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26943,7 +26943,7 @@ public:
 	struct FVector                                     m_vSpawnParameters;                               		// 0x0108 (0x000C) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26961,7 +26961,7 @@ public:
 	unsigned long                                      m_bAllowCooldown : 1;                             		// 0x011C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26979,7 +26979,7 @@ public:
 	unsigned long                                      m_bStopAllMatchingEffects : 1;                    		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -26995,7 +26995,7 @@ public:
 	struct FGuid                                       m_ID;                                             		// 0x006C (0x0010) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27315,7 +27315,7 @@ public:
 	unsigned char                                      RepChargeEffect;                                  		// 0x10C5 (0x0001) [0x0000000100000020]              ( CPF_Net | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27526,7 +27526,7 @@ class USFXSeqEvt_OnStoppedSleeping : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27663,7 +27663,7 @@ public:
 	unsigned char                                      ERootMotionMode;                                  		// 0x07C0 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27829,7 +27829,7 @@ public:
 	unsigned long                                      bCanDropAmmo : 1;                                 		// 0x0FF4 (0x0004) [0x0000000000000000] [0x00080000] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27901,7 +27901,7 @@ public:
 	unsigned char                                      ForcedHelmetState[ 0x4 ];                         		// 0x105C (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27957,7 +27957,7 @@ public:
 	float                                              PowerUseDelay;                                    		// 0x10A0 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -27993,7 +27993,7 @@ class UBioAnimNodeBlendAdditivePower : public UBioAnimNodeBlendAdditive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28007,7 +28007,7 @@ class UBioAnimNodeBlendWeaponEquip : public UAnimNodeBlendBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28021,7 +28021,7 @@ class UBioAnimNodeCameraShake : public UBioAnimNodeBlendAdditive
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28036,7 +28036,7 @@ public:
 	struct SFXName                                     Info;                                             		// 0x0060 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28053,7 +28053,7 @@ public:
 	struct SFXName                                     sMoveToStartPoint;                                		// 0x02BC (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28157,7 +28157,7 @@ public:
 	unsigned char                                      Notoriety;                                        		// 0x1566 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28408,7 +28408,7 @@ public:
 	unsigned char                                      PreviousCombatMood;                               		// 0x082F (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28562,7 +28562,7 @@ class ABioBaseSquadDesign : public ABioBaseSquad
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28576,7 +28576,7 @@ class ABioBaseSquadDesignCombat : public ABioBaseSquadDesign
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28599,7 +28599,7 @@ public:
 	unsigned long                                      bInterpToStart : 1;                               		// 0x0148 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28617,7 +28617,7 @@ public:
 	unsigned long                                      m_bCameraLocked : 1;                              		// 0x0124 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28685,7 +28685,7 @@ public:
 	unsigned long                                      bMouseLock : 1;                                   		// 0x02F8 (0x0004) [0x0000000000002000] [0x00000040] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28745,7 +28745,7 @@ class UBioCameraBehaviorLocked : public UBioCameraBehavior
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28761,7 +28761,7 @@ public:
 	TArray<struct FExtraMeshComponent>                 ExtraMeshComponents;                              		// 0x0080 (0x0010) [0x0000000000482000]              ( CPF_Transient | CPF_Component | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28806,7 +28806,7 @@ public:
 	unsigned char                                      ToolTipText;                                      		// 0x0145 (0x0001) [0x0000000000004002]              ( CPF_Const | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28851,7 +28851,7 @@ public:
 	unsigned long                                      bBrainUsed : 1;                                   		// 0x0124 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28925,7 +28925,7 @@ public:
 	unsigned char                                      HealthType;                                       		// 0x0214 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28971,7 +28971,7 @@ public:
 	unsigned char                                      ClassType;                                        		// 0x022C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29011,7 +29011,7 @@ public:
 	unsigned char                                      ReplicatedShield;                                 		// 0x03E5 (0x0001) [0x0000000100002020]              ( CPF_Net | CPF_Transient | CPF_RepNotify )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29058,7 +29058,7 @@ public:
 	unsigned long                                      bNeedRestoration : 1;                             		// 0x0060 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29111,7 +29111,7 @@ public:
 	unsigned long                                      bHidPlayerForAtlasHack : 1;                       		// 0x0E84 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29201,7 +29201,7 @@ class UBioDynamicLoadInterface : public UInterface
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29216,7 +29216,7 @@ class ASFXPawn_PlayerVanguard : public ASFXPawn_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29230,7 +29230,7 @@ class USFXCustomActionTypes : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29249,7 +29249,7 @@ public:
 	unsigned long                                      bAbortIfChildFailed : 1;                          		// 0x00BC (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29296,7 +29296,7 @@ public:
 	unsigned long                                      bModifyPerception : 1;                            		// 0x0388 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29312,7 +29312,7 @@ public:
 	TArray<struct FVocEventLog>                        PastEvents;                                       		// 0x02B0 (0x0010) [0x0000000000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29332,7 +29332,7 @@ class USFXDamageType_CheatKill : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29346,7 +29346,7 @@ class USFXDamageType_Default : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29361,7 +29361,7 @@ public:
 	unsigned long                                      bTossOnWeaponSwitch : 1;                          		// 0x10C8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29392,7 +29392,7 @@ public:
 	float                                              RecoilBonus;                                      		// 0x01C4 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29427,7 +29427,7 @@ class USFXGameEffect_PassiveWeaponBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29475,7 +29475,7 @@ public:
 	float                                              CurrentAimAssistSoftMargin;                       		// 0x0148 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29513,7 +29513,7 @@ public:
 	int                                                srCanAffordResearch;                              		// 0x009C (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29562,7 +29562,7 @@ public:
 	int                                                LatentFire_CurrentPellet;                         		// 0x1158 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29596,7 +29596,7 @@ public:
 	unsigned char                                      CurrentBleedoutState;                             		// 0x0230 (0x0001) [0x0000000000002001]              ( CPF_Edit | CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29629,7 +29629,7 @@ public:
 	float                                              ScoreReplicationPeriod;                           		// 0x0470 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29688,7 +29688,7 @@ public:
 	unsigned long                                      m_bLastConstrainAspect : 1;                       		// 0x0600 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29734,7 +29734,7 @@ public:
 	unsigned long                                      m_bUsePeriodicCoverCheck : 1;                     		// 0x0898 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29812,7 +29812,7 @@ public:
 	unsigned long                                      PreventSquadPowerUse : 1;                         		// 0x0930 (0x0004) [0x0000000000002000] [0x00002000] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29902,7 +29902,7 @@ public:
 	unsigned long                                      bApplyToWeapons : 1;                              		// 0x00AC (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -29951,7 +29951,7 @@ public:
 	unsigned char                                      m_ePowerTutorialType;                             		// 0x0170 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30021,7 +30021,7 @@ public:
 	int                                                ShotsTillMissTracer;                              		// 0x10C8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30041,7 +30041,7 @@ class ASFXWeapon_Pistol_Base : public ASFXWeapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30058,7 +30058,7 @@ class ASFXWeapon_SMG_Base : public ASFXWeapon
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30081,7 +30081,7 @@ public:
 	float                                              SniperRifleDamagePenalty;                         		// 0x1150 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30113,7 +30113,7 @@ public:
 	unsigned long                                      bDoneCombatVarBarks : 1;                          		// 0x009C (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30135,7 +30135,7 @@ public:
 	TArray<FString>                                    Events;                                           		// 0x0060 (0x0010) [0x0000004000402000]              ( CPF_Transient | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30199,7 +30199,7 @@ public:
 	unsigned char                                      EntryWeaponGroup;                                 		// 0x0411 (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30281,7 +30281,7 @@ public:
 	TArray<struct FArmorTreasureData>                  ArmorTreasure;                                    		// 0x0070 (0x0010) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30314,7 +30314,7 @@ public:
 	unsigned long                                      bDebugHeadLOD : 1;                                		// 0x01DC (0x0004) [0x0000000000000000] [0x00000004] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30404,7 +30404,7 @@ public:
 	float                                              SideContentXP;                                    		// 0x010C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30448,7 +30448,7 @@ public:
 	unsigned long                                      bPlayerDownedInWave : 1;                          		// 0x014C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30488,7 +30488,7 @@ public:
 	unsigned long                                      m_bSupportsPlayerFace : 1;                        		// 0x010C (0x0004) [0x0000000000000001] [0x00000008] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30504,7 +30504,7 @@ class UBioConvNodeTrackDebugInst : public USFXGameInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30518,7 +30518,7 @@ class USFXGameEffect_DamageTakenBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30548,7 +30548,7 @@ public:
 	unsigned char                                      InterpMethod;                                     		// 0x0180 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30573,7 +30573,7 @@ public:
 	struct FVector                                     StartLocation;                                    		// 0x019C (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30592,7 +30592,7 @@ public:
 	struct FScriptDelegate                             __InputHandler__Delegate;                         		// 0x0090 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30621,7 +30621,7 @@ public:
 	unsigned long                                      bPendingTransition : 1;                           		// 0x00C0 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30653,7 +30653,7 @@ public:
 	unsigned long                                      bVelocityChange : 1;                              		// 0x0140 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30687,7 +30687,7 @@ public:
 	unsigned char                                      RootMotionMode;                                   		// 0x0150 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30711,7 +30711,7 @@ public:
 	unsigned long                                      bWelded : 1;                                      		// 0x0110 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30735,7 +30735,7 @@ public:
 	struct FBodyStance                                 BS_CombatActivate;                                		// 0x0110 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30754,7 +30754,7 @@ class USFXAICmd_CombatActivate : public USFXAICmd_CustomAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30778,7 +30778,7 @@ public:
 	unsigned char                                      m_CurrentBodyStance;                              		// 0x014C (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30803,7 +30803,7 @@ public:
 	class ANavigationPoint*                            OriginalAnchor;                                   		// 0x00CC (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30821,7 +30821,7 @@ class UBioCustomAction_CoverClimb : public UBioCustomAction_CoverClimbMantleBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30840,7 +30840,7 @@ public:
 	struct FVector                                     vStartLocation;                                   		// 0x0160 (0x000C) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30860,7 +30860,7 @@ public:
 	float                                              m_fChargeTurnSpeed;                               		// 0x00C8 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30882,7 +30882,7 @@ class UBioDebugMenu : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30896,7 +30896,7 @@ class UBioDeprecated : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30910,7 +30910,7 @@ class ABioDestinationArrow : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30952,7 +30952,7 @@ public:
 	int                                                N7ArmourDescription;                              		// 0x01E4 (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -30971,7 +30971,7 @@ class UBioGUIBox : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31015,7 +31015,7 @@ public:
 	unsigned char                                      bOldIgnoreLookInput;                              		// 0x029D (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31072,7 +31072,7 @@ public:
 	float                                              CoverCamAlign;                                    		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31138,7 +31138,7 @@ public:
 	class USFXCameraMode_MountedGunTightAim*           TightAimCam;                                      		// 0x00F0 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31168,7 +31168,7 @@ public:
 	float                                              InputDelayTightAimExit;                           		// 0x00EC (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31195,7 +31195,7 @@ public:
 	float                                              DisableMoveTime;                                  		// 0x00D8 (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31215,7 +31215,7 @@ public:
 	float                                              DisableMoveTime;                                  		// 0x00D8 (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31235,7 +31235,7 @@ public:
 	unsigned long                                      bCameraEnabled : 1;                               		// 0x00D8 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31257,7 +31257,7 @@ public:
 	float                                              InputDelayTightAimExit;                           		// 0x00E0 (0x0004) [0x0000000000004001]              ( CPF_Edit | CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31280,7 +31280,7 @@ public:
 	class USFXCameraTransition_GalaxyMap*              InstantTransition;                                		// 0x00E0 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31303,7 +31303,7 @@ class USFXGameModeCinematic : public USFXGameModeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31325,7 +31325,7 @@ public:
 	float                                              DeathTransitionTime;                              		// 0x00F8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31353,7 +31353,7 @@ public:
 	unsigned long                                      bLoadingMovie : 1;                                		// 0x00D8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31370,7 +31370,7 @@ class USFXGameModeCheatMenu : public USFXGameModeBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31415,7 +31415,7 @@ public:
 	unsigned long                                      bShowLegend : 1;                                  		// 0x0120 (0x0004) [0x0000000000000000] [0x00000080] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31455,7 +31455,7 @@ public:
 	unsigned char                                      LastLookUpKey;                                    		// 0x00E3 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31506,7 +31506,7 @@ public:
 	class USFXCameraMode_Explore*                      ExploreCam;                                       		// 0x00D8 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31529,7 +31529,7 @@ public:
 	unsigned long                                      bPushing : 1;                                     		// 0x0174 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31557,7 +31557,7 @@ public:
 	class USFXCameraMode_Spectator*                    SpectatorCam;                                     		// 0x00D8 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31579,7 +31579,7 @@ public:
 	float                                              StartBoostTime;                                   		// 0x00E8 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31603,7 +31603,7 @@ public:
 	class UBioCameraBehaviorFree*                      FreeCam;                                          		// 0x00D8 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31619,7 +31619,7 @@ public:
 	class USFXCameraMode_ReplicationDebug*             ReplicationDebugCam;                              		// 0x00D8 (0x0008) [0x0000000004400009]              ( CPF_Edit | CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31635,7 +31635,7 @@ public:
 	TArray<struct SFXName>                             StackedGuis;                                      		// 0x00D8 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31679,7 +31679,7 @@ public:
 	unsigned long                                      bBudgetEnforced : 1;                              		// 0x00C8 (0x0004) [0x0000000000004000] [0x00000040] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31704,7 +31704,7 @@ public:
 	class ABioPawn*                                    m_Pawn;                                           		// 0x0088 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31740,7 +31740,7 @@ public:
 	unsigned long                                      m_bNCOSeen : 1;                                   		// 0x0288 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31754,7 +31754,7 @@ class USFXDefine : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31768,7 +31768,7 @@ class UBioMessageBox : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31782,7 +31782,7 @@ class UBioMetaVFX : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31796,7 +31796,7 @@ class UBioPathPointFactory : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31830,7 +31830,7 @@ public:
 	unsigned long                                      bOnlyOnDeath : 1;                                 		// 0x0144 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31852,7 +31852,7 @@ class USFXPowerCustomAction_PassivePower : public USFXPowerCustomAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31873,7 +31873,7 @@ public:
 	unsigned char                                      Discipline;                                       		// 0x0134 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31887,7 +31887,7 @@ class USFXDamageType_Weapon : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31906,7 +31906,7 @@ public:
 	class USFXPhysicalMaterialPhysics*                 PhysicalMaterialPhysics;                          		// 0x0080 (0x0008) [0x0000000004000001]              ( CPF_Edit | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31920,7 +31920,7 @@ class USFXPhysicalMaterialBase : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31957,7 +31957,7 @@ public:
 	class UWwiseEvent*                                 TireSound;                                        		// 0x0110 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -31987,7 +31987,7 @@ public:
 	unsigned char                                      ERootMotionMode;                                  		// 0x0158 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32013,7 +32013,7 @@ public:
 	unsigned long                                      bForceReplace : 1;                                		// 0x0108 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32028,7 +32028,7 @@ class UBioSeqEvt_OnCastAt : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32043,7 +32043,7 @@ class USFXSeqEvt_Ragdoll : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32057,7 +32057,7 @@ class ASFXKillRagdollVolume : public ATriggerVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32078,7 +32078,7 @@ public:
 	unsigned long                                      bCorpseDestroyed : 1;                             		// 0x00B0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32099,7 +32099,7 @@ public:
 	unsigned long                                      bSendReachedDestinationEvent : 1;                 		// 0x013C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32142,7 +32142,7 @@ public:
 	float                                              HealthRatio;                                      		// 0x02C4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32171,7 +32171,7 @@ class USFXSeqEvt_ImpactedByPower : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32185,7 +32185,7 @@ class USFXDamageType_Power_Fire : public USFXDamageType_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32200,7 +32200,7 @@ class USFXDamageType_Power_Electrocute : public USFXDamageType_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32215,7 +32215,7 @@ class USFXDamageType_Power_Freeze : public USFXDamageType_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32230,7 +32230,7 @@ class USFXDamageType_Melee : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32244,7 +32244,7 @@ class USFXDamageType_SecondMelee : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32258,7 +32258,7 @@ class USFXDamageType_ThirdMelee : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32272,7 +32272,7 @@ class UBioSeqEvt_NotifyLimbDetached : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32320,7 +32320,7 @@ public:
 	class UBioPlanet*                                  CurrentPlanet;                                    		// 0x0250 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32348,7 +32348,7 @@ public:
 	float                                              LandingSiteScale;                                 		// 0x0150 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32374,7 +32374,7 @@ public:
 	unsigned long                                      m_bIsInterrupted : 1;                             		// 0x013C (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32398,7 +32398,7 @@ class USFXDamageType_PowerPhysics : public USFXDamageType
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32426,7 +32426,7 @@ public:
 	unsigned char                                      StartBlendType;                                   		// 0x013D (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32446,7 +32446,7 @@ class USFXCustomAction_MountedGunReload : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32460,7 +32460,7 @@ class USFXCustomAction_EnterMountedGun : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32476,7 +32476,7 @@ class USFXCustomAction_ExitMountedGun : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32492,7 +32492,7 @@ public:
 	int                                                WwiseType;                                        		// 0x0068 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32510,7 +32510,7 @@ public:
 	unsigned long                                      m_bUsePartialPaths : 1;                           		// 0x00C0 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32539,7 +32539,7 @@ public:
 	float                                              m_fRotationTime;                                  		// 0x0128 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32561,7 +32561,7 @@ public:
 	unsigned long                                      bTargetSpecified : 1;                             		// 0x00DC (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32582,7 +32582,7 @@ class USFXAICmd_Fallen : public USFXAICommand
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32602,7 +32602,7 @@ public:
 	unsigned long                                      bFiringWeapon : 1;                                		// 0x00D0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32622,7 +32622,7 @@ class USFXAICmd_ReturnToPlaypen : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32644,7 +32644,7 @@ public:
 	unsigned long                                      bForceShoot : 1;                                  		// 0x00C8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32671,7 +32671,7 @@ class USFXAICmd_Disabled : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32693,7 +32693,7 @@ class USFXAICmd_KismetOrder : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32709,7 +32709,7 @@ public:
 	unsigned long                                      bActorReachable : 1;                              		// 0x00C0 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32733,7 +32733,7 @@ public:
 	class ASFXVehicle_MountedGun*                      MountedGun;                                       		// 0x00F8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32749,7 +32749,7 @@ public:
 	struct FRotator                                    ToTarget;                                         		// 0x00D4 (0x000C) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32768,7 +32768,7 @@ public:
 	unsigned long                                      m_bAllowedToFire : 1;                             		// 0x00C0 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32787,7 +32787,7 @@ class USFXAICmd_CoverUserStuck : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32803,7 +32803,7 @@ class USFXAICmd_Base_Melee : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32820,7 +32820,7 @@ class USFXAICmd_Reaction_Flank : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32834,7 +32834,7 @@ class USFXSeqAct_CoverUserEvade : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32848,7 +32848,7 @@ class USFXAICmd_Berserk : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32863,7 +32863,7 @@ class USFXAICmd_Resurrect : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32884,7 +32884,7 @@ public:
 	unsigned long                                      bCanShoot : 1;                                    		// 0x00DC (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32902,7 +32902,7 @@ public:
 	unsigned long                                      bInitialPlayerOrder : 1;                          		// 0x00E8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32922,7 +32922,7 @@ public:
 	unsigned long                                      m_bMovingToFireTarget : 1;                        		// 0x00C8 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32958,7 +32958,7 @@ class USFXAICmd_Combat_Henchman : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32978,7 +32978,7 @@ class USFXAICmd_MoveAwayFromPlayer : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -32996,7 +32996,7 @@ class USFXGameEffect_PassiveWeaponDamageBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33012,7 +33012,7 @@ class USFXAICmd_ExecuteOrders : public USFXAICommand
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33033,7 +33033,7 @@ class USFXAICmd_ResetHenchman : public USFXAICommand
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33049,7 +33049,7 @@ class USFXAICmd_HenchFollowActor : public USFXAICmd_FollowActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33064,7 +33064,7 @@ class USFXAICmd_MoveToHoldLocation : public USFXAICommand
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33090,7 +33090,7 @@ public:
 	float                                              TargetFOV;                                        		// 0x0154 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33111,7 +33111,7 @@ class USFXCameraMode_PhotoOrbit : public USFXCameraMode_Photo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33141,7 +33141,7 @@ public:
 	unsigned char                                      eVictimRootMotionMode;                            		// 0x01A4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33183,7 +33183,7 @@ public:
 	unsigned long                                      bRightSwatTurn : 1;                               		// 0x021C (0x0004) [0x0000000000000002] [0x00000004] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33211,7 +33211,7 @@ class USFXCustomAction_SwatTurn_Left : public USFXCustomAction_SwatTurn
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33225,7 +33225,7 @@ class USFXCustomAction_SwatTurn_Right : public USFXCustomAction_SwatTurn
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33239,7 +33239,7 @@ class ABioPlayerReplicationInfo : public APlayerReplicationInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33255,7 +33255,7 @@ public:
 	class AActor*                                      Squad;                                            		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33274,7 +33274,7 @@ public:
 	unsigned long                                      TeleportToLeader : 1;                             		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33290,7 +33290,7 @@ class UBioSeqAct_AdjustCostForDiscount : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33311,7 +33311,7 @@ public:
 	unsigned long                                      bForceCinematicDamage : 1;                        		// 0x0114 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33330,7 +33330,7 @@ public:
 	struct SFXName                                     StartPoint;                                       		// 0x0110 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33348,7 +33348,7 @@ public:
 	float                                              fLifeTime;                                        		// 0x0108 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33368,7 +33368,7 @@ public:
 	class UObject*                                     m_oEffect;                                        		// 0x011C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33389,7 +33389,7 @@ public:
 	unsigned long                                      bForceCinematicDamage : 1;                        		// 0x0110 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33405,7 +33405,7 @@ class UBioSeqAct_ClearBrowserWheelStateOverrides : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33420,7 +33420,7 @@ class UBioSeqAct_Deprecated : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33436,7 +33436,7 @@ public:
 	unsigned long                                      bModal : 1;                                       		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33453,7 +33453,7 @@ public:
 	unsigned long                                      bLeftToRight : 1;                                 		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33470,7 +33470,7 @@ public:
 	unsigned long                                      bModalBar : 1;                                    		// 0x00FC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33488,7 +33488,7 @@ public:
 	unsigned long                                      bModalBar : 1;                                    		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33505,7 +33505,7 @@ public:
 	unsigned long                                      bModalCounter : 1;                                		// 0x00FC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33522,7 +33522,7 @@ public:
 	unsigned char                                      Element;                                          		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33541,7 +33541,7 @@ public:
 	unsigned char                                      Element;                                          		// 0x0104 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33559,7 +33559,7 @@ public:
 	unsigned char                                      Element;                                          		// 0x0100 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33576,7 +33576,7 @@ public:
 	unsigned char                                      Element;                                          		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33593,7 +33593,7 @@ public:
 	unsigned long                                      m_bGameOverSignalled : 1;                         		// 0x00FC (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33610,7 +33610,7 @@ public:
 	class AActor*                                      oSquad;                                           		// 0x0100 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33625,7 +33625,7 @@ class UBioSeqAct_HideSniperHudOverlay : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33640,7 +33640,7 @@ class UBioSeqAct_InitLoadingMovie : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33657,7 +33657,7 @@ public:
 	unsigned long                                      m_bInterruptFovoToo : 1;                          		// 0x0108 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33676,7 +33676,7 @@ public:
 	unsigned long                                      m_bCheckForAmbient : 1;                           		// 0x0100 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33691,7 +33691,7 @@ class UBioSeqAct_KillPawn : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33706,7 +33706,7 @@ class UBioSeqAct_NonCombatArea : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33722,7 +33722,7 @@ public:
 	class AActor*                                      mActor;                                           		// 0x00F8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33737,7 +33737,7 @@ class UBioSeqAct_RemoveFromParty : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33753,7 +33753,7 @@ public:
 	float                                              PctHealthRegained;                                		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33769,7 +33769,7 @@ public:
 	unsigned long                                      bSetActive : 1;                                   		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33785,7 +33785,7 @@ public:
 	unsigned long                                      m_bMakeAvailable : 1;                             		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33802,7 +33802,7 @@ public:
 	struct FScriptDelegate                             __BioTimerDelegate__Delegate;                     		// 0x0070 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33821,7 +33821,7 @@ public:
 	TArray<struct FSubPageState>                       PageStates;                                       		// 0x00F8 (0x0010) [0x0000000004400001]              ( CPF_Edit | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33836,7 +33836,7 @@ class UBioSeqAct_SetEnvironmentEffectIntensity : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33852,7 +33852,7 @@ public:
 	unsigned long                                      bForceInstant : 1;                                		// 0x0100 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33868,7 +33868,7 @@ class USFXCameraMode_Explore : public USFXCameraMode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33885,7 +33885,7 @@ public:
 	class AActor*                                      LookAtTarget;                                     		// 0x0108 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33902,7 +33902,7 @@ class UBioSeqAct_ShouldShowSplashSequence : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33931,7 +33931,7 @@ public:
 	unsigned char                                      m_TextAlign;                                      		// 0x0132 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33960,7 +33960,7 @@ public:
 	float                                              fWeight9;                                         		// 0x0144 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -33990,7 +33990,7 @@ public:
 	int                                                nHench2;                                          		// 0x0134 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34008,7 +34008,7 @@ public:
 	unsigned long                                      bEnable : 1;                                      		// 0x00FC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34023,7 +34023,7 @@ class UBioSeqCond_Deprecated : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34038,7 +34038,7 @@ class UBioSeqCond_InCombat : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34053,7 +34053,7 @@ class UBioSeqEvt_Deprecated : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34068,7 +34068,7 @@ class UBioSeqEvt_LoadingScreenClosed : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34086,7 +34086,7 @@ public:
 	unsigned long                                      m_bFromMainMenu : 1;                              		// 0x0340 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34106,7 +34106,7 @@ class UBioSFHandler_SharedIGG : public USFXGUIMovieExtension
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34127,7 +34127,7 @@ public:
 	unsigned long                                      AbleToLoad : 1;                                   		// 0x0340 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34157,7 +34157,7 @@ public:
 	int                                                srText;                                           		// 0x0334 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34172,7 +34172,7 @@ class UBioSFHandler_LoadScreen : public USFXGUIMovieLegacyAdapter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34189,7 +34189,7 @@ class USFXGUI_MainMenu_Message_Text : public USFXGUI_MainMenu_Message
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34207,7 +34207,7 @@ public:
 	class UTexture*                                    ImageReference;                                   		// 0x00C4 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34224,7 +34224,7 @@ class USFXGUI_MainMenu_Message_NetworkImage : public USFXGUI_MainMenu_Message_Im
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34241,7 +34241,7 @@ class ASFXPawn_PlayerNonCombat : public ASFXPawn_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34255,7 +34255,7 @@ class ASFXPawn_PlayerSoldierNonCombat : public ASFXPawn_PlayerNonCombat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34269,7 +34269,7 @@ class ASFXPawn_PlayerSoldier : public ASFXPawn_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34283,7 +34283,7 @@ class ASFXPawn_PlayerInfiltrator : public ASFXPawn_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34297,7 +34297,7 @@ class ASFXPawn_PlayerSentinel : public ASFXPawn_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34311,7 +34311,7 @@ class ASFXPawn_PlayerAdept : public ASFXPawn_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34325,7 +34325,7 @@ class ASFXPawn_PlayerEngineer : public ASFXPawn_Player
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34339,7 +34339,7 @@ class UBioSFHandler_PCAchievement : public UBioSFHandler_Achievement
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34354,7 +34354,7 @@ class UBioSFHandler_PCChoiceGUI : public UBioSFHandler_ChoiceGUI
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34370,7 +34370,7 @@ class UBioSFHandler_PCDesignerUI : public UBioSFHandler_DesignerUI
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34384,7 +34384,7 @@ class UBioSFHandler_PCGameOver : public UBioSFHandler_GameOver
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34400,7 +34400,7 @@ class UBioSFHandler_PCPauseMenu : public UBioSFHandler_BrowserWheel
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34422,7 +34422,7 @@ class UBioSFHandler_SelectCharacter : public USFXGUIMovieLegacyAdapter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34439,7 +34439,7 @@ class UBioSFHandler_SniperOverlay : public USFXGUIMovieLegacyAdapter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34455,7 +34455,7 @@ public:
 	class UBioSimpleDialog*                            Dialog;                                           		// 0x0060 (0x0008) [0x0000004004400008]              ( CPF_ExportObject | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34469,7 +34469,7 @@ class UBioSkillGame_Bypass_PCHandler : public UBioSkillGame_Bypass_Handler
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34483,7 +34483,7 @@ class UBioSkillGame_Decryption_PCHandler : public UBioSkillGame_Decryption_Handl
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34500,7 +34500,7 @@ public:
 	unsigned long                                      m_bClosedIsSkillState : 1;                        		// 0x0070 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34516,7 +34516,7 @@ class UBioSkillMap_Door : public UBioSkillMap
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34530,7 +34530,7 @@ class UBioSkillMap_Test : public UBioSkillMap
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34544,7 +34544,7 @@ class ABioSquadCombat : public ABioBaseSquadDesignCombat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34558,7 +34558,7 @@ class ABioStartLocation : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34572,7 +34572,7 @@ class ABioStartPoint : public ANavigationPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34586,7 +34586,7 @@ class ABioTempNavPoint : public ANavigationPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34603,7 +34603,7 @@ public:
 	unsigned long                                      Touched : 1;                                      		// 0x0280 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34619,7 +34619,7 @@ class UBioTriggerActorFactory : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34636,7 +34636,7 @@ public:
 	unsigned long                                      Touched : 1;                                      		// 0x02B4 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34652,7 +34652,7 @@ class UBioVectorParameterInstTrack : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34666,7 +34666,7 @@ class UBioVectorParameterTrack : public UInterpTrackVectorBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34680,7 +34680,7 @@ class UBioVFXTemplate : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34694,7 +34694,7 @@ class UBioVisualEffectPool : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34708,7 +34708,7 @@ class UBioVisualEffectTrack : public UInterpTrack
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34722,7 +34722,7 @@ class UBioVisualEffectTrackInst : public UInterpTrackInst
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34736,7 +34736,7 @@ class UBioWaypointSetFactory : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34750,7 +34750,7 @@ class ABioWorldInfoTick : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34764,7 +34764,7 @@ class ABioWp_Kismet : public ABioPathPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34778,7 +34778,7 @@ class ADynamicCylindricalForceActor : public ARB_CylindricalForceActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34795,7 +34795,7 @@ public:
 	unsigned long                                      WavesAreLoading : 1;                              		// 0x0284 (0x0004) [0x0000004000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34831,7 +34831,7 @@ class USFXDamageType_CoverMelee : public USFXDamageType_Melee
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34853,7 +34853,7 @@ public:
 	int                                                BonusSquadXP;                                     		// 0x00C4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34886,7 +34886,7 @@ class USFXActorFactoryEnemySpawnPoint : public UActorFactory
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34903,7 +34903,7 @@ public:
 	float                                              Weight;                                           		// 0x0394 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34917,7 +34917,7 @@ class USFXActorFactoryPhysicsAsset : public UActorFactoryPhysicsAsset
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34931,7 +34931,7 @@ class ASFXKAssetSpawnable : public ASFXKAsset
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34949,7 +34949,7 @@ public:
 	unsigned long                                      m_bUnderAttack : 1;                               		// 0x0850 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34967,7 +34967,7 @@ class USFXAICmd_Critter : public USFXAICommand
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34985,7 +34985,7 @@ class ASFXAI_None : public ASFXAI_Core
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -34999,7 +34999,7 @@ class USFXAICmd_None : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35019,7 +35019,7 @@ class ASFXAI_TechDrone : public ASFXAI_Core
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35036,7 +35036,7 @@ class USFXAICmd_Combat_TechDrone : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35055,7 +35055,7 @@ public:
 	unsigned long                                      bHasWarned : 1;                                   		// 0x0830 (0x0004) [0x0000000000000000] [0x00000008] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35071,7 +35071,7 @@ class USFXAICmd_Combat_TechDroneNPC : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35087,7 +35087,7 @@ public:
 	unsigned long                                      bCombatStarted : 1;                               		// 0x00D4 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35106,7 +35106,7 @@ class USFXAICmd_Base_MountedGunner : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35122,7 +35122,7 @@ class USFXAICmd_CA_DamageReaction : public USFXAICmd_CustomAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35139,7 +35139,7 @@ public:
 	float                                              MaxBackAwayDistance;                              		// 0x00CC (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35157,7 +35157,7 @@ class USFXAICmd_Combat_Turret : public USFXAICommand_Base_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35182,7 +35182,7 @@ public:
 	unsigned char                                      CurrentFallback;                                  		// 0x00D8 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35205,7 +35205,7 @@ class USFXAICmd_EnterCover : public USFXAICommand
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35224,7 +35224,7 @@ public:
 	unsigned long                                      bEnteredMountedGun : 1;                           		// 0x00D4 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35241,7 +35241,7 @@ public:
 	class ASFXWeapon*                                  NextWeapon;                                       		// 0x00C0 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35260,7 +35260,7 @@ class USFXAICmd_WaitForAnimatedTransition : public USFXAICommand
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35279,7 +35279,7 @@ public:
 	unsigned long                                      bUnawareAI : 1;                                   		// 0x0128 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35300,7 +35300,7 @@ class ASFXNav_InteractionHenchManual : public ASFXNav_InteractionPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35314,7 +35314,7 @@ class ASFXNav_InteractionHenchCover : public ASFXNav_InteractionPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35329,7 +35329,7 @@ public:
 	class USFXCustomAction_InteractionPointAnim*       InteractionCustomAction;                          		// 0x00C4 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35353,7 +35353,7 @@ public:
 	unsigned long                                      m_bUsePartialPaths : 1;                           		// 0x00D8 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35374,7 +35374,7 @@ public:
 	unsigned long                                      m_bFromBrowserWheel : 1;                          		// 0x0424 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35423,7 +35423,7 @@ public:
 	unsigned char                                      Floor;                                            		// 0x00E4 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35449,7 +35449,7 @@ public:
 	unsigned char                                      ArmorPiece;                                       		// 0x00FC (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35470,7 +35470,7 @@ public:
 	class ULightEnvironmentComponent*                  LightEnvironment;                                 		// 0x0278 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35485,7 +35485,7 @@ class ASFXBlockingVolume_Ledge : public ABlockingVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35502,7 +35502,7 @@ public:
 	unsigned long                                      ReenableMovement : 1;                             		// 0x0134 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35522,7 +35522,7 @@ public:
 	int                                                CurrentOffsetApplied;                             		// 0x0184 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35539,7 +35539,7 @@ public:
 	class UMotionBlurEffect*                           Blur;                                             		// 0x0120 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35555,7 +35555,7 @@ class USFXCameraMode_AdeptPunch : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35574,7 +35574,7 @@ public:
 	float                                              TotalBlendTime;                                   		// 0x013C (0x0004) [0x0000000000000003]              ( CPF_Edit | CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35592,7 +35592,7 @@ class USFXCameraMode_Atlas : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35608,7 +35608,7 @@ public:
 	float                                              FullTurnRecenter;                                 		// 0x012C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35626,7 +35626,7 @@ class USFXCameraMode_Cover : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35641,7 +35641,7 @@ class USFXCameraMode_CoverMeleeLeft : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35656,7 +35656,7 @@ class USFXCameraMode_CoverMeleeRight : public USFXCameraMode_CoverMeleeLeft
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35670,7 +35670,7 @@ class USFXCameraMode_CoverStorm : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35685,7 +35685,7 @@ class USFXCameraMode_CoverStormHigh : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35700,7 +35700,7 @@ class USFXCameraMode_CoverSwatTurnHigh : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35715,7 +35715,7 @@ class USFXCameraMode_CoverSwatTurnLow : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35730,7 +35730,7 @@ class USFXCameraMode_CoverSyncMelee : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35744,7 +35744,7 @@ class USFXCameraMode_CoverSyncMeleeLeft : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35758,7 +35758,7 @@ class USFXCameraMode_CustomAction : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35772,7 +35772,7 @@ class USFXCameraMode_EnterCover : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35788,7 +35788,7 @@ public:
 	float                                              FullTurnRecenter;                                 		// 0x0124 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35806,7 +35806,7 @@ class USFXCameraMode_ForwardRoll : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35820,7 +35820,7 @@ class USFXCameraMode_HipAimCover : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35834,7 +35834,7 @@ class USFXCameraMode_HitReaction : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35860,7 +35860,7 @@ public:
 	float                                              Smoothing;                                        		// 0x01C0 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35899,7 +35899,7 @@ public:
 	unsigned long                                      bRunning : 1;                                     		// 0x01F4 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35916,7 +35916,7 @@ class USFXCameraMode_JumpStart : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35930,7 +35930,7 @@ class USFXCameraMode_KroganMelee : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35944,7 +35944,7 @@ class USFXCameraMode_LadderDown : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35961,7 +35961,7 @@ class USFXCameraMode_LadderUp : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35975,7 +35975,7 @@ class USFXCameraMode_LockOnPawn : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -35991,7 +35991,7 @@ class USFXCameraMode_Melee : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36017,7 +36017,7 @@ public:
 	unsigned long                                      bTryForceLocalSimulation : 1;                     		// 0x0158 (0x0004) [0x0000000000000002] [0x00000008] ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36046,7 +36046,7 @@ public:
 	class UBioCameraZoom*                              ZoomData;                                         		// 0x0128 (0x0008) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36062,7 +36062,7 @@ class USFXCameraMode_MountedGunTightAim : public USFXCameraMode_TightAim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36076,7 +36076,7 @@ class USFXCameraMode_PhotoFree : public USFXCameraMode_Photo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36092,7 +36092,7 @@ class USFXCameraMode_PistolTightAim : public USFXCameraMode_TightAim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36106,7 +36106,7 @@ class USFXCameraMode_ReplicationDebug : public USFXCameraMode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36122,7 +36122,7 @@ class USFXCameraMode_Roll : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36136,7 +36136,7 @@ class USFXCameraMode_SniperAim : public USFXCameraMode_TightAim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36151,7 +36151,7 @@ class USFXCameraMode_Spectator : public USFXCameraMode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36167,7 +36167,7 @@ class USFXCameraMode_SplitScreenCombat : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36181,7 +36181,7 @@ class USFXCameraMode_TightAimCover : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36196,7 +36196,7 @@ class USFXCameraMode_Vehicle : public USFXCameraMode_Combat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36213,7 +36213,7 @@ public:
 	struct FVector                                     StartLocation;                                    		// 0x019C (0x000C) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36285,7 +36285,7 @@ public:
 	unsigned long                                      bCustomCameraMode : 1;                            		// 0x01DC (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36309,7 +36309,7 @@ public:
 	struct FScreenShakeStruct                          TheShake;                                         		// 0x0060 (0x0078) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36328,7 +36328,7 @@ public:
 	unsigned long                                      bScalePlayRate : 1;                               		// 0x0194 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36344,7 +36344,7 @@ class USFXCameraTransition_GalaxyMap : public USFXCameraMode_Interpolate
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36368,7 +36368,7 @@ public:
 	float                                              FirstPhaseLength;                                 		// 0x01E8 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36394,7 +36394,7 @@ public:
 	struct SFXName                                     MeleeKillCategory;                                		// 0x0998 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36411,7 +36411,7 @@ class USFXCustomAction_BackTakeDown : public USFXCustomAction_ClassMelee
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36429,7 +36429,7 @@ public:
 	float                                              HealDuration;                                     		// 0x0164 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36458,7 +36458,7 @@ public:
 	unsigned char                                      StartBlendType;                                   		// 0x0141 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36481,7 +36481,7 @@ class USFXCustomAction_Cover90TurnLeft : public USFXCustomAction_Cover90TurnBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36495,7 +36495,7 @@ class USFXCustomAction_Cover90TurnLeftStanding : public USFXCustomAction_Cover90
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36509,7 +36509,7 @@ class USFXCustomAction_Cover90TurnRight : public USFXCustomAction_Cover90TurnBas
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36523,7 +36523,7 @@ class USFXCustomAction_Cover90TurnRightStanding : public USFXCustomAction_Cover9
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36537,7 +36537,7 @@ class USFXCustomAction_CoverSlipBase : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36558,7 +36558,7 @@ public:
 	unsigned char                                      BlendType;                                        		// 0x012C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36575,7 +36575,7 @@ class USFXCustomAction_ExplosionBack : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36590,7 +36590,7 @@ class USFXCustomAction_ExplosionForward : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36605,7 +36605,7 @@ class USFXCustomAction_ExplosionLeft : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36620,7 +36620,7 @@ class USFXCustomAction_ExplosionRight : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36636,7 +36636,7 @@ public:
 	class UWwiseEvent*                                 CancelSound;                                      		// 0x0140 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36654,7 +36654,7 @@ class USFXCustomAction_HeavyStdCoverMeleeRight : public USFXCustomAction_ClassMe
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36678,7 +36678,7 @@ public:
 	unsigned char                                      BlendType;                                        		// 0x012C (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36708,7 +36708,7 @@ public:
 	unsigned char                                      RootMotionMode;                                   		// 0x0185 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36739,7 +36739,7 @@ public:
 	unsigned char                                      RootMotionMode;                                   		// 0x0155 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36769,7 +36769,7 @@ public:
 	unsigned char                                      InteractionStage;                                 		// 0x0178 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36790,7 +36790,7 @@ public:
 	class URvrClientEffectInterface*                   CE_OmniTool;                                      		// 0x0150 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36807,7 +36807,7 @@ class USFXCustomAction_PlayerEvadeBase : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36832,7 +36832,7 @@ public:
 	int                                                OmniWeaponPlotID;                                 		// 0x01A4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36854,7 +36854,7 @@ public:
 	float                                              OriginalDesiredSpeed;                             		// 0x0094 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36870,7 +36870,7 @@ class USFXDamageType_HeavyMelee : public USFXDamageType_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36902,7 +36902,7 @@ public:
 	unsigned long                                      ApplyBlurEffect : 1;                              		// 0x024C (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36927,7 +36927,7 @@ class USFXCustomAction_ReloadBase : public UBioCustomAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36943,7 +36943,7 @@ public:
 	int                                                RandPercent;                                      		// 0x0150 (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36961,7 +36961,7 @@ class USFXCustomAction_ShieldFace : public USFXCustomAction_SingleAnim
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -36980,7 +36980,7 @@ public:
 	unsigned long                                      bPauseAnimOnStart : 1;                            		// 0x0144 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37008,7 +37008,7 @@ public:
 	float                                              TargetBlendOutTime;                               		// 0x0184 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37047,7 +37047,7 @@ public:
 	unsigned char                                      LoopState;                                        		// 0x01CC (0x0001) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37077,7 +37077,7 @@ public:
 	unsigned long                                      bAffectsFriendlies : 1;                           		// 0x0140 (0x0004) [0x0000000000000001] [0x00000004] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37108,7 +37108,7 @@ public:
 	float                                              InstigatorBlendOutTime;                           		// 0x015C (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37131,7 +37131,7 @@ public:
 	class UWwiseEvent*                                 CancelSound;                                      		// 0x018C (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37155,7 +37155,7 @@ public:
 	float                                              VictimBlendOutTime2;                              		// 0x01FC (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37174,7 +37174,7 @@ public:
 	struct FBodyStance                                 BS_AnimExplore;                                   		// 0x0140 (0x0010) [0x0000000000400001]              ( CPF_Edit | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37190,7 +37190,7 @@ class USFXCustomizationInstance : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37221,7 +37221,7 @@ public:
 	unsigned char                                      CombatAppearance;                                 		// 0x0098 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37236,7 +37236,7 @@ class USFXDamageType_CriticalMelee : public USFXDamageType_Melee
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37250,7 +37250,7 @@ class USFXDamageType_IllusiveManConflict : public USFXDamageType_PowerPhysics
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37264,7 +37264,7 @@ class USFXDamageType_KroganCharge : public USFXDamageType_Default
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37278,7 +37278,7 @@ class USFXDamageType_Power_Control : public USFXDamageType_Power
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37293,7 +37293,7 @@ public:
 	unsigned char                                      AnimatedPowerRagdollType;                         		// 0x0138 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37307,7 +37307,7 @@ class USFXDamageType_Stasis : public USFXDamageType_Power_Control
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37321,7 +37321,7 @@ class ASFXDecalActorSpawnable : public ADecalActorMovable
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37335,7 +37335,7 @@ class USFXSeqEvt_SFXDoorInteraction : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37357,7 +37357,7 @@ public:
 	unsigned long                                      bPooled : 1;                                      		// 0x02A8 (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37390,7 +37390,7 @@ public:
 	unsigned char                                      EquipWeaponToolTip;                               		// 0x02B8 (0x0001) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37414,7 +37414,7 @@ public:
 	unsigned long                                      bPooled : 1;                                      		// 0x0284 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37434,7 +37434,7 @@ class ASFXDynamicPrefabInstance : public APrefabInstance
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37448,7 +37448,7 @@ class ASFXTeamInfo : public ATeamInfo
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37462,7 +37462,7 @@ class ASFXMutator : public AMutator
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37477,7 +37477,7 @@ class ASFXPawn_PlayerAdeptNonCombat : public ASFXPawn_PlayerNonCombat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37491,7 +37491,7 @@ class ASFXPawn_PlayerInfiltratorNonCombat : public ASFXPawn_PlayerNonCombat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37505,7 +37505,7 @@ class ASFXPawn_PlayerEngineerNonCombat : public ASFXPawn_PlayerNonCombat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37519,7 +37519,7 @@ class ASFXPawn_PlayerVanguardNonCombat : public ASFXPawn_PlayerNonCombat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37533,7 +37533,7 @@ class ASFXPawn_PlayerSentinelNonCombat : public ASFXPawn_PlayerNonCombat
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37547,7 +37547,7 @@ class USFXSeqEvt_CombatStarted : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37562,7 +37562,7 @@ class USFXSeqEvt_CombatEnded : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37577,7 +37577,7 @@ class USFXGameChoiceGUIData_HeavyWeapons : public USFXGameChoiceGUIData
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37603,7 +37603,7 @@ public:
 	int                                                m_srResearchErrorCanNotLearn;                     		// 0x00E4 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37617,7 +37617,7 @@ class USFXGameChoiceGUIData_Weapons : public USFXGameChoiceGUIData
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37633,7 +37633,7 @@ public:
 	float                                              DamageInterval;                                   		// 0x009C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37651,7 +37651,7 @@ public:
 	unsigned long                                      bRemoved : 1;                                     		// 0x0094 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37670,7 +37670,7 @@ public:
 	unsigned long                                      bPercentOfMaxHealth : 1;                          		// 0x0094 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37685,7 +37685,7 @@ class USFXGameEffect_HealthRegenPenalty : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37701,7 +37701,7 @@ public:
 	unsigned long                                      bEffectValueIsPercent : 1;                        		// 0x0098 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37718,7 +37718,7 @@ class USFXGameEffect_IgnorePlayerSquad : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37735,7 +37735,7 @@ class USFXGameEffect_PhysicsDamageMultiplier : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37751,7 +37751,7 @@ class USFXGameEffect_PhysicsPower : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37767,7 +37767,7 @@ public:
 	float                                              MaxDetonationRumbleDistance;                      		// 0x006C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37783,7 +37783,7 @@ public:
 	float                                              MaxDetonationShakeDistance;                       		// 0x00DC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37800,7 +37800,7 @@ public:
 	unsigned long                                      bRemoveEffectWhenShieldsDown : 1;                 		// 0x0098 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37818,7 +37818,7 @@ class USFXGameEffect_ShieldRegenBonus : public USFXGameEffect
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37837,7 +37837,7 @@ public:
 	float                                              OwnerCounterScale;                                		// 0x00AC (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37857,7 +37857,7 @@ public:
 	TArray<struct FUniqueArmorEffects>                 Children;                                         		// 0x0094 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37872,7 +37872,7 @@ class USFXGameEffect_WeaponDamageBonus : public USFXGameEffect_PassiveWeaponDama
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37889,7 +37889,7 @@ public:
 	unsigned char                                      CustomActionType;                                 		// 0x00C0 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37906,7 +37906,7 @@ class ASFXGameInfoMP_LobbyUnusedDummy : public ASFXGame
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37920,7 +37920,7 @@ class USFXSeqEvt_LeaveWorld : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37934,7 +37934,7 @@ class USFXSeqEvt_ProtoInputTrap : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37951,7 +37951,7 @@ public:
 	class USFXGAWAssetsHandler*                        GAWHandler;                                       		// 0x05EC (0x0008) [0x0000000004402008]              ( CPF_ExportObject | CPF_Transient | CPF_NeedCtorLink | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37965,7 +37965,7 @@ class USFXGAWReinforcementManagerBase : public UObject
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -37988,7 +37988,7 @@ public:
 	struct FScriptDelegate                             __OnDestroyed__Delegate;                          		// 0x00D0 (0x0010) [0x0000000000400000]              ( CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38027,7 +38027,7 @@ public:
 	unsigned long                                      bShowChildDetails : 1;                            		// 0x0300 (0x0004) [0x0000000000004000] [0x00000002] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38063,7 +38063,7 @@ public:
 	float                                              TimeSinceLastFire;                                		// 0x03EC (0x0004) [0x0000000000002000]              ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38090,7 +38090,7 @@ public:
 	unsigned long                                      m_bGAWRatingsError : 1;                           		// 0x0338 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38124,7 +38124,7 @@ class USFXGUI_MainMenu_RTT_RC_B : public USFXGUIMovieKismet
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38138,7 +38138,7 @@ class USFXGUI_Option_VOLanguage : public USFXGUI_Option_LanguageBase
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38200,7 +38200,7 @@ public:
 	unsigned long                                      m_bCheckingNotifications : 1;                     		// 0x0464 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38280,7 +38280,7 @@ class USFXGUI_PCSquadRecord : public USFXGUI_SquadRecord
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38297,7 +38297,7 @@ class USFXGUI_PCStore : public USFXGUI_Store
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38316,7 +38316,7 @@ public:
 	unsigned long                                      bTappingPromptVisible : 1;                        		// 0x030C (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38366,7 +38366,7 @@ public:
 	unsigned long                                      bNoSelect : 1;                                    		// 0x0358 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38429,7 +38429,7 @@ public:
 	int                                                srInfoExit;                                       		// 0x0118 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38448,7 +38448,7 @@ public:
 	int                                                srWarAssetsTutorialMessage;                       		// 0x031C (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38492,7 +38492,7 @@ public:
 	class UGFxValue*                                   m_oPipLeft;                                       		// 0x00C8 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38512,7 +38512,7 @@ public:
 	float                                              ReticleOpacity;                                   		// 0x00D0 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38527,7 +38527,7 @@ class USFXPowerCustomAction_AmmoPowerBase : public USFXPowerCustomAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38573,7 +38573,7 @@ public:
 	unsigned long                                      m_bMonitorWeaponLoadIn : 1;                       		// 0x0148 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38628,7 +38628,7 @@ class USFXGUIData_TerminalNoSquadSel : public USFXGUIData_Terminal
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38643,7 +38643,7 @@ public:
 	float                                              VisibleDistance;                                  		// 0x00B4 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38657,7 +38657,7 @@ class USFXGUIValue_MarkerObjectiveSP : public USFXGUIValue_MarkerObjective
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38675,7 +38675,7 @@ public:
 	unsigned long                                      DisplayMarkerOnSpawn : 1;                         		// 0x00B8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38703,7 +38703,7 @@ public:
 	class UParticleSystem*                             ParticleBeam;                                     		// 0x00C8 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38747,7 +38747,7 @@ public:
 	class UWwiseEvent*                                 GraalShotgun_Player;                              		// 0x0148 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38789,7 +38789,7 @@ public:
 	float                                              ParticleBeamFadeTime;                             		// 0x0174 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38810,7 +38810,7 @@ public:
 	unsigned long                                      IsActive : 1;                                     		// 0x0090 (0x0004) [0x0000004000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38837,7 +38837,7 @@ class USFXInterpTrackSetEnvEffectIntensity : public USFXGameInterpTrackCustom
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38854,7 +38854,7 @@ public:
 	unsigned char                                      TreasureType;                                     		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38880,7 +38880,7 @@ public:
 	unsigned long                                      bAlreadyMined : 1;                                		// 0x0290 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38895,7 +38895,7 @@ class ASFXMutator_DifficultySpeed : public ASFXMutator
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38915,7 +38915,7 @@ public:
 	unsigned long                                      m_bMaintainVelocity : 1;                          		// 0x037C (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38929,7 +38929,7 @@ class ASFXNav_ActionStationWP : public ASFXNav_WayPoint
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38944,7 +38944,7 @@ class ASFXNav_KaiLengShield : public APathNode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38960,7 +38960,7 @@ public:
 	unsigned char                                      eStance;                                          		// 0x0388 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38976,7 +38976,7 @@ public:
 	unsigned long                                      bClaimed : 1;                                     		// 0x0374 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -38996,7 +38996,7 @@ public:
 	unsigned char                                      SpawnLocation;                                    		// 0x0298 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39018,7 +39018,7 @@ public:
 	unsigned long                                      PerformVisibilityCheckForSpawn : 1;               		// 0x00B4 (0x0004) [0x0000000000004000] [0x00000001] ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39034,7 +39034,7 @@ public:
 	struct FPowerData                                  ParagonRenegadeModifier;                          		// 0x07C4 (0x0034) [0x0000000000404000]              ( CPF_Config | CPF_NeedCtorLink )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39063,7 +39063,7 @@ public:
 	unsigned long                                      bSpeedThresholdFuseSet : 1;                       		// 0x05F0 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39087,7 +39087,7 @@ public:
 	float                                              MaxDetonationRumbleDistance;                      		// 0x006C (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39102,7 +39102,7 @@ public:
 	unsigned char                                      m_eCerberus3DStateChange;                         		// 0x00F8 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39119,7 +39119,7 @@ public:
 	class AActor*                                      Squad;                                            		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39146,7 +39146,7 @@ public:
 	unsigned long                                      m_bTargetInvalidated : 1;                         		// 0x0138 (0x0004) [0x0000000000002000] [0x00000008] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39169,7 +39169,7 @@ public:
 	int                                                PlayedME2VarIndex;                                		// 0x00F8 (0x0004) [0x0000000000000002]              ( CPF_Const )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39193,7 +39193,7 @@ public:
 	unsigned char                                      m_TextAlign;                                      		// 0x0141 (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39213,7 +39213,7 @@ public:
 	int                                                Id;                                               		// 0x0108 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39229,7 +39229,7 @@ class USFXSeqAct_AwardGAWAssetsForLevel : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39244,7 +39244,7 @@ class USFXSeqAct_AwardTreasure : public USFXSeqAct_AwardTreasure_Base
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39260,7 +39260,7 @@ public:
 	int                                                nState;                                           		// 0x00F8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39280,7 +39280,7 @@ public:
 	unsigned char                                      eBehaviour;                                       		// 0x0110 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39295,7 +39295,7 @@ class USFXSeqAct_CharCreateCrust : public USeqAct_Latent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39309,7 +39309,7 @@ class USFXSeqAct_CheckResourceBudget : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39372,7 +39372,7 @@ public:
 	unsigned long                                      m_bAllHenchmen : 1;                               		// 0x0230 (0x0004) [0x0000000000002000] [0x00000002] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39418,7 +39418,7 @@ class USFXSeqAct_CloseGalaxyMap : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39434,7 +39434,7 @@ class USFXSeqAct_DefendActor : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39449,7 +39449,7 @@ class USFXSeqAct_FlushAsyncWork : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39464,7 +39464,7 @@ class USFXSeqAct_ForceCombatOn : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39485,7 +39485,7 @@ public:
 	unsigned char                                      oEventID;                                         		// 0x0110 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39504,7 +39504,7 @@ public:
 	int                                                nPriority;                                        		// 0x0100 (0x0004) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39521,7 +39521,7 @@ public:
 	int                                                nTreasureId;                                      		// 0x0100 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39549,7 +39549,7 @@ public:
 	unsigned char                                      m_TextAlign;                                      		// 0x012D (0x0001) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39570,7 +39570,7 @@ class USFXSeqAct_InitMainMenu : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39585,7 +39585,7 @@ class USFXSeqAct_InterruptCustomAction : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39602,7 +39602,7 @@ public:
 	unsigned long                                      bLinkEnvironment : 1;                             		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39620,7 +39620,7 @@ public:
 	class USeqVar_Bool*                                oCombatTargetBool;                                		// 0x0108 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39636,7 +39636,7 @@ class USFXSeqAct_MainMenu : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39651,7 +39651,7 @@ class USFXSeqAct_MakeLevelLive : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39668,7 +39668,7 @@ public:
 	class AActor*                                      Squad;                                            		// 0x0108 (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39726,7 +39726,7 @@ public:
 	unsigned char                                      InitialResearchMode;                              		// 0x033B (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39779,7 +39779,7 @@ public:
 	unsigned long                                      bForceFireSuccess : 1;                            		// 0x0120 (0x0004) [0x0000000000000000] [0x00000002] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39799,7 +39799,7 @@ public:
 	unsigned char                                      m_DoorType;                                       		// 0x0100 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39819,7 +39819,7 @@ public:
 	unsigned long                                      m_bResetPriorityToDefault : 1;                    		// 0x010C (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39835,7 +39835,7 @@ public:
 	unsigned long                                      bVocState : 1;                                    		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000001] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39853,7 +39853,7 @@ public:
 	unsigned long                                      bCombatTargetable : 1;                            		// 0x00F8 (0x0004) [0x0000000000000001] [0x00000002] ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39874,7 +39874,7 @@ public:
 	unsigned char                                      TreasureType;                                     		// 0x0100 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39890,7 +39890,7 @@ class USFXSeqAct_SetWeaponVisibility : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39906,7 +39906,7 @@ public:
 	unsigned long                                      m_bIsFinished : 1;                                		// 0x0110 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39926,7 +39926,7 @@ public:
 	unsigned char                                      OptionsGUIMode;                                   		// 0x0114 (0x0001) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39951,7 +39951,7 @@ public:
 	unsigned long                                      m_bWasPaused : 1;                                 		// 0x0130 (0x0004) [0x0000000000002000] [0x00000004] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39972,7 +39972,7 @@ class USFXSeqAct_ToggleAutoHints : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -39987,7 +39987,7 @@ class USFXSeqAct_ToggleBlinking : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40002,7 +40002,7 @@ class USFXSeqAct_ToggleInjuredShepardMode : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40017,7 +40017,7 @@ class USFXSeqAct_TogglePrototyping : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40032,7 +40032,7 @@ class USFXSeqAct_UnloadCharacterCreationMovies : public USequenceAction
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40048,7 +40048,7 @@ public:
 	unsigned long                                      bWaitForPlayerSpawn : 1;                          		// 0x010C (0x0004) [0x0000000000002000] [0x00000001] ( CPF_Transient )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40065,7 +40065,7 @@ public:
 	class AActor*                                      Player;                                           		// 0x00DC (0x0008) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40081,7 +40081,7 @@ class USFXSeqCond_HasPlayerStart : public USequenceCondition
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40096,7 +40096,7 @@ class USFXSeqEvt_HordeEnemyKilled : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40110,7 +40110,7 @@ class USFXSeqEvt_HordeWaveEnd : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40124,7 +40124,7 @@ class USFXSeqEvt_HordeWaveStart : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40138,7 +40138,7 @@ class USFXSeqEvt_LeavingStasis : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40152,7 +40152,7 @@ class USFXSeqEvt_Tutorial : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40166,7 +40166,7 @@ class USFXSeqEvt_VehicleMiningFailure : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40180,7 +40180,7 @@ class USFXSeqEvt_VehicleMiningSuccess : public USequenceEvent
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40194,7 +40194,7 @@ class USFXSFHandler_PCAreaMap : public USFXSFHandler_AreaMap
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40210,7 +40210,7 @@ class USFXSFHandler_PCEANetworking : public USFXSFHandler_EANetworking
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40226,7 +40226,7 @@ public:
 	int                                                m_srPOIAction;                                    		// 0x08C0 (0x0004) [0x0000000000004000]              ( CPF_Config )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40242,7 +40242,7 @@ class USFXSFHandler_PCLoad : public USFXSFHandler_Load
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40259,7 +40259,7 @@ public:
 	unsigned long                                      bRotationEnabled : 1;                             		// 0x0490 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40277,7 +40277,7 @@ class USFXSFHandler_PCSave : public USFXSFHandler_Save
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40293,7 +40293,7 @@ class USFXSFHandler_PCSlideshow : public USFXSFHandler_Slideshow
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40307,7 +40307,7 @@ class USFXSFHandler_PS3Achievement : public UBioSFHandler_Achievement
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40321,7 +40321,7 @@ class USFXSFHandler_PS3EANetworking : public USFXSFHandler_EANetworking
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40335,7 +40335,7 @@ class USFXSFHandler_PS3MainMenu : public UBioSFHandler_MainMenu
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40351,7 +40351,7 @@ class USFXSFHandler_PS3NewCharacter : public UBioSFHandler_NewCharacter
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40365,7 +40365,7 @@ class USFXSFHandler_PS3Options : public UBioSFHandler_Options
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40379,7 +40379,7 @@ class USFXSFHandler_PS3Personalization : public USFXSFHandler_Personalization
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40404,7 +40404,7 @@ public:
 	float                                              BreachTimeDilationLength;                         		// 0x04B8 (0x0004) [0x0000000000000001]              ( CPF_Edit )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40425,7 +40425,7 @@ class ASFXSignText : public AActor
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40440,7 +40440,7 @@ class ASFXStealthVolume : public AVolume
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40456,7 +40456,7 @@ class ASFXTracer_Bullet : public ASFXTracer
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40470,7 +40470,7 @@ class ASFXTreasureNode : public ASFXPointOfInterest
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40484,7 +40484,7 @@ class USFXWallRunReachSpec : public USFXCustomReachSpec
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40501,7 +40501,7 @@ public:
 	class ABioWorldInfo*                               BioWorldInfo;                                     		// 0x0288 (0x0008) [0x0000000000000000]              
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40523,7 +40523,7 @@ public:
 	unsigned long                                      bStopCustomTicking : 1;                           		// 0x0100 (0x0004) [0x0000000000000000] [0x00000001] 
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40544,7 +40544,7 @@ public:
 	class ULightEnvironmentComponent*                  LightEnvironment;                                 		// 0x0278 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40561,7 +40561,7 @@ public:
 	class ULightEnvironmentComponent*                  LightEnvironment;                                 		// 0x0278 (0x0008) [0x0000000004080009]              ( CPF_Edit | CPF_ExportObject | CPF_Component | CPF_EditInline )
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40577,7 +40577,7 @@ class USFXWeaponUseModule_BonusWeapon : public USFXWeaponUseModule
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -40593,7 +40593,7 @@ class ASFXWeaponNode_BonusWeapon : public ASFXWeaponNode
 public:
 
 private:
-	static UClass* pClassPointer;
+	static ::LESDK::TStaticRef<UClass> pClassPointer;
 
 public:
 	static UClass* StaticClass();
@@ -28,30 +28,40 @@
 
 
 
-class UClass* UWindowsClient::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UWindowsClient::pClassPointer { L"Class WinDrv.WindowsClient", &UObject::FindClass };
 
 class UClass* UWindowsClient::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WinDrv.WindowsClient" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
-class UClass* UXnaForceFeedbackManager::pClassPointer = NULL;
+::LESDK::TStaticRef<UClass> UXnaForceFeedbackManager::pClassPointer { L"Class WinDrv.XnaForceFeedbackManager", &UObject::FindClass };
 
 class UClass* UXnaForceFeedbackManager::StaticClass()
 	{
-		if ( ! pClassPointer )
-			pClassPointer = UObject::FindClass ( L"Class WinDrv.XnaForceFeedbackManager" );
-
-		return pClassPointer;
+		return pClassPointer.Get ( );
 	};
 
 
 
+/*
+# ========================================================================================= #
+# Static References
+# ========================================================================================= #
+*/
+
+static wchar_t const* const GStaticRefNames[] =
+{
+	L"Class WinDrv.WindowsClient",
+	L"Class WinDrv.XnaForceFeedbackManager",
+};
+
+static ::LESDK::FStaticRefTable GStaticRefTable ( GStaticRefNames );
+
+
+
 #undef LESDK_IN_GENERATED
 
 #ifdef _MSC_VER
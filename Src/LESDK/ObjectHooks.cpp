@@ -0,0 +1,25 @@
+#include "LESDK/Headers.hpp"
+#include "LESDK/Init.hpp"
+#include "LESDK/ObjectHooks.hpp"
+
+
+namespace LESDK {
+
+    // ! Object hooks for the game's own objects.
+    // ========================================
+
+    using FObjectHooks = TObjectHooks<UObject, UClass>;
+
+    static TObjectTracker<UObject, UClass> GObjectTracker{
+        UObject::GObjIndex, UObject::GObjBuckets, UObject::GObjSerials, UObject::GClassHierarchy };
+
+    bool InstallObjectHooks(Initializer& Init, std::optional<Address> const DestroyAt) {
+        LESDK_CHECK(UObject::GObjObjects != nullptr, "object table must be initialized before hooking");
+        return FObjectHooks::Install(Init, GObjectTracker, *UObject::GObjObjects, BUILTIN_STATICALLOCATEOBJECT_PHOOK, DestroyAt);
+    }
+
+    void UninstallObjectHooks(Initializer& Init) {
+        FObjectHooks::Uninstall(Init);
+    }
+
+}
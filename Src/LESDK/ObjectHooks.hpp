@@ -0,0 +1,155 @@
+/**
+ * @file        LESDK/ObjectHooks.hpp
+ * @brief       This file provides optional engine hooks which keep the SDK's object lookup structures current.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <optional>
+
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/ObjectTracker.hpp"
+#include "LESDK/Common/SFXName.hpp"
+#include "LESDK/Common/TArray.hpp"
+#include "LESDK/Init.hpp"
+
+
+namespace LESDK {
+
+    /**
+     * @brief
+     *   Hooks @c UObject::StaticAllocateObject, and optionally a per-object destruction routine,
+     *   and reports every allocated and destroyed object to a @ref TObjectTracker.
+     *
+     * @remarks
+     *   @c StaticAllocateObject is hooked rather than @c StaticConstructObject, since it is where every
+     *   object gets its slot, including objects loaded from packages which are never constructed.
+     *   There is no built-in pattern for a destruction routine, so one must be supplied by the caller
+     *   if destruction events are wanted; it must take the object as its only argument, like
+     *   @c UObject::FinishDestroy. Without it, the tracker only learns of a destroyed object once its
+     *   slot is reused: until then the index, buckets and weak handles keep the destroyed object's
+     *   entries, which is harmless only as long as the engine clears the slot in the table before
+     *   freeing the object, as lookups validate against the table. Code which must notice destroyed
+     *   objects right away, or which reads objects between their destruction and the slot being
+     *   cleared, needs the destruction hook, see @ref HasDestroyHook.
+     *   Only one set of hooks may be installed per object type at a time.
+     *   Templated over the object type for late binding and testing with synthetic objects.
+     */
+    template<class UObjectLike, class UClassLike>
+    class TObjectHooks final {
+    public:
+
+        using TrackerType = TObjectTracker<UObjectLike, UClassLike>;
+
+        using StaticAllocateObjectType = UObjectLike* (*)(UClassLike* Class, UObjectLike* InOuter, SFXName InName, QWORD SetFlags,
+            UObjectLike* Template, void* Error, UObjectLike* Ptr, UObjectLike* SubobjectRoot, void* InstanceGraph);
+        using DestroyObjectType = void (*)(UObjectLike* Object);
+
+        static constexpr char const* k_allocateHookName = "StaticAllocateObject";
+        static constexpr char const* k_destroyHookName = "DestroyObject";
+
+    private:
+
+        static inline std::atomic<TrackerType*>                 s_tracker{ nullptr };
+        static inline std::atomic<StaticAllocateObjectType>     s_allocateOriginal{ nullptr };
+        static inline std::atomic<DestroyObjectType>            s_destroyOriginal{ nullptr };
+        static inline std::atomic<bool>                         s_bDestroyHooked{ false };
+
+    public:
+
+        /**
+         * @brief       Installs the hooks and starts feeding @p Tracker.
+         * @param[in]   Init - Initializer used to resolve addresses and install hooks.
+         * @param[in]   Tracker - Receives allocation and destruction events until @ref Uninstall.
+         * @param[in]   Table - The object table, normally @c UObject::GObjObjects.
+         * @param[in]   AllocateAt - Address of @c StaticAllocateObject, normally @c BUILTIN_STATICALLOCATEOBJECT_PHOOK.
+         * @param[in]   DestroyAt - Address of a destruction routine, if any, see remarks of @ref TObjectHooks.
+         * @return      True if all requested hooks were installed.
+         */
+        static bool Install(Initializer& Init, TrackerType& Tracker, TArray<UObjectLike*> const& Table,
+            Address const AllocateAt, std::optional<Address> const DestroyAt = std::nullopt)
+        {
+            if (s_tracker.load(std::memory_order_acquire) != nullptr)
+                return false;
+            s_tracker.store(&Tracker, std::memory_order_release);
+
+            void* const AllocateTarget = Init.Resolve(AllocateAt);
+            void* const AllocateOriginal = AllocateTarget != nullptr
+                ? Init.InstallHook(k_allocateHookName, AllocateTarget, reinterpret_cast<void*>(&AllocateDetour))
+                : nullptr;
+            if (AllocateOriginal == nullptr) {
+                s_tracker.store(nullptr, std::memory_order_release);
+                return false;
+            }
+            s_allocateOriginal.store(reinterpret_cast<StaticAllocateObjectType>(AllocateOriginal), std::memory_order_release);
+
+            bool bWithDestruction = false;
+            if (DestroyAt.has_value()) {
+                void* const DestroyTarget = Init.Resolve(*DestroyAt);
+                void* const DestroyOriginal = DestroyTarget != nullptr
+                    ? Init.InstallHook(k_destroyHookName, DestroyTarget, reinterpret_cast<void*>(&DestroyDetour))
+                    : nullptr;
+                s_destroyOriginal.store(reinterpret_cast<DestroyObjectType>(DestroyOriginal), std::memory_order_release);
+                bWithDestruction = DestroyOriginal != nullptr;
+                s_bDestroyHooked.store(bWithDestruction, std::memory_order_release);
+            }
+
+            // Objects allocated before the hooks went live are picked up here.
+            Tracker.Start(Table);
+            return !DestroyAt.has_value() || bWithDestruction;
+        }
+
+        /** Uninstalls the hooks, the tracker receives no further events. */
+        static void Uninstall(Initializer& Init) {
+            TrackerType* const Tracker = s_tracker.exchange(nullptr, std::memory_order_acq_rel);
+            if (Tracker == nullptr)
+                return;
+
+            Tracker->Stop();
+            Init.UninstallHook(k_allocateHookName);
+            if (s_bDestroyHooked.exchange(false, std::memory_order_acq_rel))
+                Init.UninstallHook(k_destroyHookName);
+        }
+
+        static bool IsInstalled() noexcept { return s_tracker.load(std::memory_order_acquire) != nullptr; }
+
+        /** Whether destruction events are delivered, otherwise destroyed objects are only noticed on slot reuse. */
+        static bool HasDestroyHook() noexcept { return s_bDestroyHooked.load(std::memory_order_acquire); }
+
+    private:
+
+        static UObjectLike* AllocateDetour(UClassLike* const Class, UObjectLike* const InOuter, SFXName const InName, QWORD const SetFlags,
+            UObjectLike* const Template, void* const Error, UObjectLike* const Ptr, UObjectLike* const SubobjectRoot, void* const InstanceGraph)
+        {
+            UObjectLike* const Object = s_allocateOriginal.load(std::memory_order_acquire)(
+                Class, InOuter, InName, SetFlags, Template, Error, Ptr, SubobjectRoot, InstanceGraph);
+
+            if (TrackerType* const Tracker = s_tracker.load(std::memory_order_acquire))
+                Tracker->OnObjectAllocated(Object);
+            return Object;
+        }
+
+        static void DestroyDetour(UObjectLike* const Object) {
+            if (TrackerType* const Tracker = s_tracker.load(std::memory_order_acquire))
+                Tracker->OnObjectDestroyed(Object);
+            s_destroyOriginal.load(std::memory_order_acquire)(Object);
+        }
+    };
+
+
+    /**
+     * @brief
+     *   Installs @ref TObjectHooks for the game's objects, keeping @c UObject::GObjIndex,
+     *   @c UObject::GObjBuckets and @c UObject::GObjSerials current without rescanning @c UObject::GObjObjects.
+     * @param[in]   Init - Initializer used to resolve addresses and install hooks.
+     * @param[in]   DestroyAt - Address of a destruction routine, if any, see remarks of @ref TObjectHooks.
+     *              Without it, destroyed objects are only evicted once their slot is reused.
+     * @return      True if all requested hooks were installed.
+     */
+    bool InstallObjectHooks(Initializer& Init, std::optional<Address> DestroyAt = std::nullopt);
+
+    /** Uninstalls hooks installed by @ref InstallObjectHooks. */
+    void UninstallObjectHooks(Initializer& Init);
+
+}
@@ -0,0 +1,25 @@
+#include "LESDK/Headers.hpp"
+#include "LESDK/Init.hpp"
+#include "LESDK/ProcessEventHooks.hpp"
+
+
+namespace LESDK {
+
+    // ! Event dispatch for the game's own ProcessEvent.
+    // ========================================
+
+    static FProcessEventDispatcher GProcessEventDispatcher{};
+
+    FProcessEventDispatcher& GetProcessEventDispatcher() {
+        return GProcessEventDispatcher;
+    }
+
+    bool InstallProcessEventHooks(Initializer& Init) {
+        return FProcessEventDispatcher::Install(Init, GProcessEventDispatcher, BUILTIN_PROCESSEVENT_PHOOK);
+    }
+
+    void UninstallProcessEventHooks(Initializer& Init) {
+        FProcessEventDispatcher::Uninstall(Init);
+    }
+
+}
@@ -0,0 +1,481 @@
+/**
+ * @file        LESDK/ProcessEventHooks.hpp
+ * @brief       This file provides a shared ProcessEvent hook which dispatches to handlers registered by function path.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+// #include <vector>
+
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/ObjectIndex.hpp"
+#include "LESDK/Init.hpp"
+
+
+namespace LESDK {
+
+    /**
+     * @brief
+     *   Dispatches script events to handlers registered by function path, e.g.
+     *   "Function SFXGame.BioHUD.PostRender", with a single hash probe per event.
+     *
+     * @remarks
+     *   Paths resolve lazily: while some path has not been seen yet, events whose function name
+     *   matches its last segment are checked against the full path, and matching functions join
+     *   the table. Functions with a matching name but a different path are remembered as misses,
+     *   up to @ref k_maxMisses of them, until a path with the same name is registered.
+     *   The table is an immutable open-addressing snapshot keyed by function pointer and replaced
+     *   on every change, so dispatching takes no locks and does not allocate. Each dispatching thread
+     *   announces the epoch it entered in, in a slot of its own; replaced snapshots are retired with
+     *   the epoch they were replaced in, and freed once every thread still dispatching entered later.
+     *   Handlers may thus unregister from within themselves and the outer dispatch keeps a valid snapshot.
+     *   Templated over the object type for late binding and testing with synthetic objects.
+     */
+    template<class UObjectLike, class UFunctionLike>
+    class TProcessEventDispatcher final {
+    public:
+
+        using ProcessEventType = void (*)(UObjectLike* Object, UFunctionLike* Function, void* Parms, void* Result);
+
+        /** Runs before the event, returning false skips the original and all post handlers. */
+        using FPreHandler = std::function<bool(UObjectLike* Object, UFunctionLike* Function, void* Parms)>;
+        /** Runs after the event, if it was not skipped. */
+        using FPostHandler = std::function<void(UObjectLike* Object, UFunctionLike* Function, void* Parms, void* Result)>;
+
+        static constexpr char const* k_hookName = "ProcessEvent";
+
+        /** Number of functions remembered not to match any path, others are checked again on every call. */
+        static constexpr size_t k_maxMisses = 1024;
+
+    private:
+
+        struct FRegistration {
+            INT                     Handle{ 0 };
+            std::wstring            Path{};
+            /** Hash of the last path segment, see @ref HashNameInstanced. */
+            DWORD                   NameHash{ k_nameHashSeed };
+            FPreHandler             Pre{};
+            FPostHandler            Post{};
+            UFunctionLike const*    Function{ nullptr };
+        };
+
+        struct FBinding {
+            std::vector<FPreHandler>    Pre{};
+            std::vector<FPostHandler>   Post{};
+        };
+
+        struct FSlot {
+            UFunctionLike const*    Function{ nullptr };
+            /** Index into @c FSnapshot::Bindings, or -1 for a function known not to match any path. */
+            INT                     Binding{ -1 };
+        };
+
+        struct FSnapshot {
+            std::vector<FSlot>      Slots{};
+            size_t                  Mask{ 0 };
+            std::vector<FBinding>   Bindings{};
+            /** Sorted name hashes of unresolved paths. */
+            std::vector<DWORD>      PendingHashes{};
+
+            FSlot const* Find(UFunctionLike const* const Function) const noexcept {
+                for (size_t Index = HashFunction(Function) & Mask;; Index = (Index + 1) & Mask) {
+                    FSlot const& Slot = Slots[Index];
+                    if (Slot.Function == Function)
+                        return &Slot;
+                    if (Slot.Function == nullptr)
+                        return nullptr;
+                }
+            }
+        };
+
+        struct FMiss {
+            UFunctionLike const*    Function{ nullptr };
+            DWORD                   NameHash{ 0 };
+        };
+
+        struct FRetired {
+            std::unique_ptr<FSnapshot const>    Snapshot{};
+            QWORD                               Epoch{ 0 };
+        };
+
+        /** Per-thread announcement of the epoch a dispatch started in, zero while not dispatching. */
+        struct FReader {
+            std::atomic<QWORD>      Epoch{ 0 };
+            /** Only touched by the owning thread, dispatches nest when handlers call script. */
+            INT                     Depth{ 0 };
+            std::thread::id         Thread{};
+            FReader*                Next{ nullptr };
+        };
+
+        /** Keeps the calling thread's snapshot from being freed for as long as it lives. */
+        class FReadScope final {
+            FReader& m_reader;
+        public:
+            explicit FReadScope(TProcessEventDispatcher const& Dispatcher) noexcept : m_reader{ Dispatcher.GetReader() } {
+                // Announcing before loading the snapshot pairs with retiring after replacing it in Publish.
+                if (m_reader.Depth++ == 0)
+                    m_reader.Epoch.store(Dispatcher.m_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+            }
+            ~FReadScope() {
+                if (--m_reader.Depth == 0)
+                    m_reader.Epoch.store(0, std::memory_order_release);
+            }
+            FReadScope(FReadScope const&) = delete;
+            FReadScope& operator=(FReadScope const&) = delete;
+        };
+
+        std::vector<std::unique_ptr<FRegistration>>     m_registrations{};
+        std::vector<FMiss>                              m_misses{};
+        std::unique_ptr<FSnapshot const>                m_owned{};
+        std::vector<FRetired>                           m_retired{};
+        std::atomic<FSnapshot const*>                   m_current{ nullptr };
+        std::atomic<QWORD>                              m_epoch{ 1 };
+        mutable std::atomic<FReader*>                   m_readers{ nullptr };
+        QWORD const                                     m_id{ s_lastId.fetch_add(1, std::memory_order_relaxed) + 1 };
+        std::mutex                                      m_mutex{};
+        INT                                             m_lastHandle{ 0 };
+
+        static inline std::atomic<QWORD>                        s_lastId{ 0 };
+        static inline std::atomic<TProcessEventDispatcher*>     s_dispatcher{ nullptr };
+        static inline std::atomic<ProcessEventType>             s_original{ nullptr };
+
+    public:
+
+        TProcessEventDispatcher() {
+            std::scoped_lock const Lock{ m_mutex };
+            Publish();
+        }
+
+        ~TProcessEventDispatcher() noexcept {
+            for (FReader* Reader = m_readers.load(std::memory_order_acquire); Reader != nullptr;)
+                delete std::exchange(Reader, Reader->Next);
+        }
+
+        TProcessEventDispatcher(TProcessEventDispatcher const&) = delete;
+        TProcessEventDispatcher& operator=(TProcessEventDispatcher const&) = delete;
+
+        /**
+         * @brief       Registers @p Handler to run before every call of the function with full name @p Path.
+         * @return      Handle for @ref Remove, or zero if the path is malformed.
+         */
+        INT AddPreHandler(wchar_t const* const Path, FPreHandler Handler) {
+            return Add(Path, std::move(Handler), FPostHandler{});
+        }
+
+        /**
+         * @brief       Registers @p Handler to run after every call of the function with full name @p Path.
+         * @return      Handle for @ref Remove, or zero if the path is malformed.
+         */
+        INT AddPostHandler(wchar_t const* const Path, FPostHandler Handler) {
+            return Add(Path, FPreHandler{}, std::move(Handler));
+        }
+
+        /** Unregisters the handler with @p Handle, returning false if there is none. */
+        bool Remove(INT const Handle) {
+            std::scoped_lock const Lock{ m_mutex };
+            auto const Found = std::ranges::find(m_registrations, Handle, &FRegistration::Handle);
+            if (Found == m_registrations.end())
+                return false;
+            m_registrations.erase(Found);
+            Publish();
+            return true;
+        }
+
+        /** Forgets all resolved functions, e.g. after packages were unloaded and their memory may be reused. */
+        void ResetResolved() {
+            std::scoped_lock const Lock{ m_mutex };
+            for (auto const& Registration : m_registrations)
+                Registration->Function = nullptr;
+            m_misses.clear();
+            Publish();
+        }
+
+        /** Checks whether some handler is registered for @p Function and its path was resolved already. */
+        bool IsHandled(UFunctionLike const* const Function) const {
+            FReadScope const Scope{ *this };
+            FSlot const* const Slot = m_current.load(std::memory_order_seq_cst)->Find(Function);
+            return Slot != nullptr && Slot->Binding >= 0;
+        }
+
+        /** Returns the number of distinct function names among the paths that have not been resolved yet. */
+        INT GetNumPending() const {
+            FReadScope const Scope{ *this };
+            return static_cast<INT>(m_current.load(std::memory_order_seq_cst)->PendingHashes.size());
+        }
+
+        /** Returns the number of functions remembered not to match any path. */
+        INT GetNumMisses() {
+            std::scoped_lock const Lock{ m_mutex };
+            return static_cast<INT>(m_misses.size());
+        }
+
+        /** Frees what can be freed, then returns the number of replaced snapshots some thread may still be reading. */
+        INT GetNumRetired() {
+            std::scoped_lock const Lock{ m_mutex };
+            Reclaim();
+            return static_cast<INT>(m_retired.size());
+        }
+
+        /**
+         * @brief       Runs the handlers for @p Function around a call to @p Original.
+         * @remarks     Called from the @c ProcessEvent detour, but usable with any original for testing.
+         */
+        void Dispatch(UObjectLike* const Object, UFunctionLike* const Function, void* const Parms, void* const Result,
+            ProcessEventType const Original)
+        {
+            FReadScope const Scope{ *this };
+            FSnapshot const* Snapshot = m_current.load(std::memory_order_seq_cst);
+            FSlot const* Slot = Snapshot->Find(Function);
+            if (Slot == nullptr && !Snapshot->PendingHashes.empty() && Function != nullptr
+                && std::ranges::binary_search(Snapshot->PendingHashes, HashNameInstanced(k_nameHashSeed, Function->Name)))
+            {
+                Snapshot = ResolvePending(Function);
+                Slot = Snapshot->Find(Function);
+            }
+
+            if (Slot == nullptr || Slot->Binding < 0) {
+                Original(Object, Function, Parms, Result);
+                return;
+            }
+
+            FBinding const& Binding = Snapshot->Bindings[static_cast<size_t>(Slot->Binding)];
+            bool bCallOriginal = true;
+            for (FPreHandler const& Handler : Binding.Pre)
+                bCallOriginal &= Handler(Object, Function, Parms);
+            if (!bCallOriginal)
+                return;
+
+            Original(Object, Function, Parms, Result);
+            for (FPostHandler const& Handler : Binding.Post)
+                Handler(Object, Function, Parms, Result);
+        }
+
+        /**
+         * @brief       Hooks @c ProcessEvent and starts dispatching events to @p Dispatcher.
+         * @param[in]   Init - Initializer used to resolve addresses and install hooks.
+         * @param[in]   Dispatcher - Receives all events until @ref Uninstall.
+         * @param[in]   At - Address of @c UObject::ProcessEvent, normally @c BUILTIN_PROCESSEVENT_PHOOK.
+         * @return      True if the hook was installed.
+         */
+        static bool Install(Initializer& Init, TProcessEventDispatcher& Dispatcher, Address const At) {
+            TProcessEventDispatcher* Expected = nullptr;
+            if (!s_dispatcher.compare_exchange_strong(Expected, &Dispatcher, std::memory_order_acq_rel))
+                return false;
+
+            void* const Target = Init.Resolve(At);
+            void* const Original = Target != nullptr
+                ? Init.InstallHook(k_hookName, Target, reinterpret_cast<void*>(&ProcessEventDetour))
+                : nullptr;
+            if (Original == nullptr) {
+                s_dispatcher.store(nullptr, std::memory_order_release);
+                return false;
+            }
+
+            s_original.store(reinterpret_cast<ProcessEventType>(Original), std::memory_order_release);
+            return true;
+        }
+
+        /** Uninstalls the hook, events are no longer dispatched. */
+        static void Uninstall(Initializer& Init) {
+            if (s_dispatcher.exchange(nullptr, std::memory_order_acq_rel) != nullptr)
+                Init.UninstallHook(k_hookName);
+        }
+
+        static bool IsInstalled() noexcept { return s_dispatcher.load(std::memory_order_acquire) != nullptr; }
+
+    private:
+
+        static size_t HashFunction(UFunctionLike const* const Function) noexcept {
+            // Objects are at least 16-byte aligned, Fibonacci hashing spreads the remaining bits.
+            return static_cast<size_t>((reinterpret_cast<QWORD>(Function) >> 4) * 0x9E3779B97F4A7C15ull >> 32);
+        }
+
+        static void ProcessEventDetour(UObjectLike* const Object, UFunctionLike* const Function, void* const Parms, void* const Result) {
+            ProcessEventType const Original = s_original.load(std::memory_order_acquire);
+            if (TProcessEventDispatcher* const Dispatcher = s_dispatcher.load(std::memory_order_acquire))
+                Dispatcher->Dispatch(Object, Function, Parms, Result, Original);
+            else
+                Original(Object, Function, Parms, Result);
+        }
+
+        INT Add(wchar_t const* const Path, FPreHandler&& Pre, FPostHandler&& Post) {
+            FObjectPath Parsed{};
+            if (!Parsed.Parse(Path))
+                return 0;
+
+            auto Registration = std::make_unique<FRegistration>();
+            Registration->Path = Path;
+            Registration->Pre = std::move(Pre);
+            Registration->Post = std::move(Post);
+
+            FObjectPathSegment const& Name = Parsed.Segments[Parsed.NumSegments - 1];
+            for (UINT i = 0; i < Name.Length; ++i)
+                Registration->NameHash = HashNameChar(Registration->NameHash, Name.Text[i]);
+
+            std::scoped_lock const Lock{ m_mutex };
+            Registration->Handle = ++m_lastHandle;
+
+            // A function resolved for another registration of the same path is reused.
+            for (auto const& Other : m_registrations) {
+                if (Other->Function != nullptr && Other->Path == Registration->Path) {
+                    Registration->Function = Other->Function;
+                    break;
+                }
+            }
+
+            // The new path may match functions with the same name that were dismissed before.
+            std::erase_if(m_misses, [&](FMiss const& Miss) { return Miss.NameHash == Registration->NameHash; });
+            m_registrations.push_back(std::move(Registration));
+            Publish();
+            return m_lastHandle;
+        }
+
+        FSnapshot const* ResolvePending(UFunctionLike const* const Function) {
+            std::scoped_lock const Lock{ m_mutex };
+
+            // Another thread may have got here first.
+            FSnapshot const* const Current = m_current.load(std::memory_order_relaxed);
+            if (Current->Find(Function) != nullptr)
+                return Current;
+
+            DWORD const NameHash = HashNameInstanced(k_nameHashSeed, Function->Name);
+            bool bResolved = false;
+            for (auto const& Registration : m_registrations) {
+                if (Registration->Function != nullptr || Registration->NameHash != NameHash)
+                    continue;
+
+                FObjectPath Path{};
+                if (Path.Parse(Registration->Path.c_str()) && ObjectMatchesPathText(Function, Path)) {
+                    Registration->Function = Function;
+                    bResolved = true;
+                }
+            }
+
+            if (!bResolved) {
+                // Past the cap, the function keeps coming here instead of growing every snapshot.
+                if (m_misses.size() >= k_maxMisses)
+                    return Current;
+                m_misses.push_back(FMiss{ Function, NameHash });
+            }
+            return Publish();
+        }
+
+        FSnapshot const* Publish() {
+            auto Snapshot = std::make_unique<FSnapshot>();
+
+            std::vector<FSlot> Entries{};
+            for (auto const& Registration : m_registrations) {
+                if (Registration->Function == nullptr) {
+                    Snapshot->PendingHashes.push_back(Registration->NameHash);
+                    continue;
+                }
+
+                auto Found = std::ranges::find(Entries, Registration->Function, &FSlot::Function);
+                if (Found == Entries.end()) {
+                    Snapshot->Bindings.emplace_back();
+                    Found = Entries.insert(Entries.end(), FSlot{ Registration->Function, static_cast<INT>(Snapshot->Bindings.size() - 1) });
+                }
+
+                FBinding& Binding = Snapshot->Bindings[static_cast<size_t>(Found->Binding)];
+                if (Registration->Pre)
+                    Binding.Pre.push_back(Registration->Pre);
+                if (Registration->Post)
+                    Binding.Post.push_back(Registration->Post);
+            }
+            for (FMiss const& Miss : m_misses)
+                Entries.push_back(FSlot{ Miss.Function, -1 });
+
+            std::ranges::sort(Snapshot->PendingHashes);
+            auto const Duplicates = std::ranges::unique(Snapshot->PendingHashes);
+            Snapshot->PendingHashes.erase(Duplicates.begin(), Duplicates.end());
+
+            // At most half full, so that misses end on an empty slot quickly.
+            size_t const Capacity = std::bit_ceil(std::max<size_t>(16, Entries.size() * 2));
+            Snapshot->Slots.resize(Capacity);
+            Snapshot->Mask = Capacity - 1;
+            for (FSlot const& Entry : Entries) {
+                size_t Index = HashFunction(Entry.Function) & Snapshot->Mask;
+                while (Snapshot->Slots[Index].Function != nullptr)
+                    Index = (Index + 1) & Snapshot->Mask;
+                Snapshot->Slots[Index] = Entry;
+            }
+
+            // Threads entering after the epoch moves on can only load the new snapshot.
+            FSnapshot const* const Published = Snapshot.get();
+            m_current.store(Published, std::memory_order_seq_cst);
+            QWORD const Epoch = m_epoch.fetch_add(1, std::memory_order_seq_cst);
+            if (m_owned != nullptr)
+                m_retired.push_back(FRetired{ std::move(m_owned), Epoch });
+            m_owned = std::move(Snapshot);
+
+            Reclaim();
+            return Published;
+        }
+
+        /** Frees retired snapshots no dispatching thread may hold, must be called with the mutex held. */
+        void Reclaim() noexcept {
+            if (m_retired.empty())
+                return;
+
+            QWORD Oldest = ~0ull;
+            for (FReader const* Reader = m_readers.load(std::memory_order_acquire); Reader != nullptr; Reader = Reader->Next) {
+                if (QWORD const Epoch = Reader->Epoch.load(std::memory_order_seq_cst); Epoch != 0)
+                    Oldest = std::min(Oldest, Epoch);
+            }
+
+            // A thread which entered in the epoch a snapshot was replaced in may still hold it.
+            std::erase_if(m_retired, [Oldest](FRetired const& Retired) { return Retired.Epoch < Oldest; });
+        }
+
+        /** Returns the calling thread's reader slot, registering one on its first dispatch. */
+        FReader& GetReader() const {
+            // Dispatchers are told apart by id rather than address, which a later one may reuse.
+            thread_local QWORD t_owner = 0;
+            thread_local FReader* t_reader = nullptr;
+            if (t_owner == m_id)
+                return *t_reader;
+
+            std::thread::id const Thread = std::this_thread::get_id();
+            FReader* Reader = m_readers.load(std::memory_order_acquire);
+            for (; Reader != nullptr && Reader->Thread != Thread; Reader = Reader->Next) {}
+
+            if (Reader == nullptr) {
+                // Slots are only freed with the dispatcher, and are never shared between live threads.
+                Reader = new FReader{};
+                Reader->Thread = Thread;
+                Reader->Next = m_readers.load(std::memory_order_relaxed);
+                while (!m_readers.compare_exchange_weak(Reader->Next, Reader, std::memory_order_acq_rel)) {}
+            }
+
+            t_owner = m_id;
+            t_reader = Reader;
+            return *Reader;
+        }
+    };
+
+
+    /** Dispatcher for the game's own @c ProcessEvent, see @ref InstallProcessEventHooks. */
+    using FProcessEventDispatcher = TProcessEventDispatcher<UObject, UFunction>;
+
+    /** Returns the dispatcher fed by @ref InstallProcessEventHooks, handlers may be registered before installing. */
+    FProcessEventDispatcher& GetProcessEventDispatcher();
+
+    /**
+     * @brief       Hooks @c UObject::ProcessEvent and dispatches events to @ref GetProcessEventDispatcher.
+     * @param[in]   Init - Initializer used to resolve addresses and install hooks.
+     * @return      True if the hook was installed.
+     */
+    bool InstallProcessEventHooks(Initializer& Init);
+
+    /** Uninstalls the hook installed by @ref InstallProcessEventHooks. */
+    void UninstallProcessEventHooks(Initializer& Init);
+
+}
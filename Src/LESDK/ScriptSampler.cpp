@@ -0,0 +1,26 @@
+#include "LESDK/Headers.hpp"
+#include "LESDK/Init.hpp"
+#include "LESDK/ScriptSampler.hpp"
+
+
+namespace LESDK {
+
+    // ! Stack sampling for the game's own script VM.
+    // ========================================
+
+    static FScriptStackSampler GScriptSampler{};
+
+    FScriptStackSampler& GetScriptSampler() {
+        return GScriptSampler;
+    }
+
+    bool InstallScriptSampler(Initializer& Init, INT const SampleEvery) {
+        GScriptSampler.SetSampleEvery(SampleEvery);
+        return FScriptStackSampler::Install(Init, GScriptSampler, BUILTIN_PROCESSINTERNAL_PHOOK, BUILTIN_CALLFUNCTION_PHOOK);
+    }
+
+    void UninstallScriptSampler(Initializer& Init) {
+        FScriptStackSampler::Uninstall(Init);
+    }
+
+}
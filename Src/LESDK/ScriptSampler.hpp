@@ -0,0 +1,345 @@
+/**
+ * @file        LESDK/ScriptSampler.hpp
+ * @brief       This file provides a sampling profiler for script call stacks, exporting collapsed stacks for flame graphs.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+// #include <vector>
+
+#include "LESDK/Common/Core.hpp"
+#include "LESDK/Common/Frame.hpp"
+#include "LESDK/Common/NativeCall.hpp"
+#include "LESDK/Common/SFXName.hpp"
+#include "LESDK/Init.hpp"
+
+
+namespace LESDK {
+
+    // ! Stack aggregation.
+    // ========================================
+
+    /** Appends "Outer.Name" of a script function or state to @p Output, e.g. "BioPawn.Tick". */
+    template<class UStructLike>
+    void AppendScriptFrameName(std::string& Output, UStructLike const* const Node) {
+        auto const AppendName = [&Output](SFXName const& Name) {
+            Output += Name.GetName();
+            if (Name.Number > 0)
+                Output += '_' + std::to_string(Name.Number - 1);
+        };
+
+        if (Node == nullptr) {
+            Output += "None";
+            return;
+        }
+        if (Node->Outer != nullptr) {
+            AppendName(Node->Outer->Name);
+            Output += '.';
+        }
+        AppendName(Node->Name);
+    }
+
+    /**
+     * @brief
+     *   Counts identical script call stacks and writes them in the collapsed format read by
+     *   flame graph tools: frames from the root down, separated by semicolons, then the count.
+     *
+     * @remarks
+     *   Works on plain stack snapshots, so it may be fed synthetic stacks outside of the game.
+     *   Stacks are keyed by function pointer and only named on output.
+     */
+    template<class UStructLike>
+    class TScriptStackAggregator final {
+        std::map<std::vector<UStructLike const*>, QWORD>    m_counts{};
+        QWORD                                               m_numSamples{ 0 };
+
+    public:
+
+        /** Counts one sample of @p LeafFirst, the innermost function first. */
+        void Add(std::span<UStructLike const* const> const LeafFirst, QWORD const Count = 1) {
+            std::vector<UStructLike const*> RootFirst(LeafFirst.rbegin(), LeafFirst.rend());
+            m_counts[std::move(RootFirst)] += Count;
+            m_numSamples += Count;
+        }
+
+        /** Counts one sample of the frame chain starting at @p Frame, see @ref Add. */
+        void AddFrames(FFrame const* Frame, INT const MaxDepth = 64) {
+            std::vector<UStructLike const*> LeafFirst{};
+            for (; Frame != nullptr && static_cast<INT>(LeafFirst.size()) < MaxDepth; Frame = Frame->PreviousFrame)
+                LeafFirst.push_back(reinterpret_cast<UStructLike const*>(Frame->Node));
+            Add(LeafFirst);
+        }
+
+        QWORD GetNumSamples() const noexcept { return m_numSamples; }
+        INT GetNumStacks() const noexcept { return static_cast<INT>(m_counts.size()); }
+
+        void Reset() {
+            m_counts.clear();
+            m_numSamples = 0;
+        }
+
+        /** Formats the counted stacks in collapsed format, one line per distinct stack, sorted by text. */
+        std::string ToCollapsed() const {
+            // Different functions may share a name, so stacks are merged again once named.
+            std::map<std::string, QWORD> Named{};
+            std::string Line{};
+            for (auto const& [Stack, Count] : m_counts) {
+                Line.clear();
+                for (size_t i = 0; i < Stack.size(); ++i) {
+                    if (i != 0)
+                        Line += ';';
+                    AppendScriptFrameName(Line, Stack[i]);
+                }
+                Named[Line] += Count;
+            }
+
+            std::string Output{};
+            for (auto const& [Stack, Count] : Named) {
+                Output += Stack;
+                Output += ' ';
+                Output += std::to_string(Count);
+                Output += '\n';
+            }
+            return Output;
+        }
+
+        /** Writes @ref ToCollapsed to @p Stream, e.g. a file for flamegraph.pl or speedscope. */
+        void Write(std::FILE* const Stream) const {
+            std::string const Text = ToCollapsed();
+            std::fwrite(Text.data(), 1, Text.size(), Stream);
+        }
+    };
+
+
+    // ! Sampling.
+    // ========================================
+
+    /**
+     * @brief
+     *   Samples script call stacks from the VM's @c ProcessInternal and @c CallFunction, every
+     *   @c SampleEvery calls on each thread, into per-thread ring buffers, see @ref Drain.
+     *
+     * @remarks
+     *   The hot path is a thread-local countdown; a sample copies the @c Node of every frame on
+     *   the @c PreviousFrame chain. Each thread owns its ring and publishes samples through
+     *   per-slot sequence numbers, so neither side takes locks; if the ring is not drained in
+     *   time, the oldest samples are overwritten. @c CallFunction only samples native callees,
+     *   which have no frame of their own, as script callees reach @c ProcessInternal anyway.
+     *   Templated over the object type for late binding and testing with synthetic frames.
+     */
+    template<class UStructLike, class UFunctionLike = UFunction>
+    class TScriptStackSampler final {
+    public:
+
+        static constexpr INT k_maxDepth = 64;
+        static constexpr INT k_ringCapacity = 1024;
+
+        using ProcessInternalType = void (*)(UObject* Context, FFrame* Stack, void* Result);
+        using CallFunctionType = void (*)(UObject* Context, FFrame* Stack, void* Result, UFunctionLike* Function);
+
+        static constexpr char const* k_processInternalHookName = "ProcessInternal";
+        static constexpr char const* k_callFunctionHookName = "CallFunction";
+
+    private:
+
+        struct FSample {
+            std::atomic<DWORD>      Sequence{ 0 };
+            INT                     Depth{ 0 };
+            UStructLike const*      LeafFirst[k_maxDepth]{};
+        };
+
+        struct FRing {
+            FSample                 Samples[k_ringCapacity]{};
+            std::atomic<QWORD>      NumWritten{ 0 };
+            QWORD                   NumRead{ 0 };
+            INT                     Countdown{ 0 };
+        };
+
+        /** Ring of the sampler with @c SamplerId on this thread; ids are never reused, unlike addresses. */
+        struct FThreadCache {
+            QWORD                   SamplerId{ 0 };
+            FRing*                  Ring{ nullptr };
+        };
+
+        QWORD const                             m_id{ s_nextId.fetch_add(1, std::memory_order_relaxed) };
+        std::atomic<INT>                        m_sampleEvery;
+        std::vector<std::unique_ptr<FRing>>     m_rings{};
+        mutable std::mutex                      m_mutex{};
+
+        static inline thread_local FThreadCache                 t_cache{};
+        static inline std::atomic<QWORD>                        s_nextId{ 1 };
+        static inline std::atomic<TScriptStackSampler*>         s_sampler{ nullptr };
+        static inline std::atomic<ProcessInternalType>          s_processInternalOriginal{ nullptr };
+        static inline std::atomic<CallFunctionType>             s_callFunctionOriginal{ nullptr };
+
+    public:
+
+        /** Creates a sampler taking one sample every @p SampleEvery calls on each thread. */
+        explicit TScriptStackSampler(INT const SampleEvery = 1000) : m_sampleEvery{ std::max(1, SampleEvery) } {}
+
+        TScriptStackSampler(TScriptStackSampler const&) = delete;
+        TScriptStackSampler& operator=(TScriptStackSampler const&) = delete;
+
+        void SetSampleEvery(INT const SampleEvery) noexcept { m_sampleEvery.store(std::max(1, SampleEvery), std::memory_order_relaxed); }
+        INT GetSampleEvery() const noexcept { return m_sampleEvery.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief       Counts one script call, sampling the stack if it is this thread's turn.
+         * @param[in]   Frame - Innermost frame of the stack.
+         * @param[in]   Callee - Function being entered without a frame of its own, if any.
+         */
+        void OnCall(FFrame const* const Frame, UStructLike const* const Callee = nullptr) {
+            FRing& Ring = GetThreadRing();
+            if (--Ring.Countdown > 0)
+                return;
+            Ring.Countdown = m_sampleEvery.load(std::memory_order_relaxed);
+            Record(Ring, Frame, Callee);
+        }
+
+        /** Moves all samples buffered so far, on all threads, into @p Aggregator and returns their number. */
+        INT Drain(TScriptStackAggregator<UStructLike>& Aggregator) {
+            std::scoped_lock const Lock{ m_mutex };
+
+            INT NumDrained = 0;
+            UStructLike const* Copy[k_maxDepth];
+            for (auto const& Ring : m_rings) {
+                QWORD const NumWritten = Ring->NumWritten.load(std::memory_order_acquire);
+                QWORD NumRead = std::max(Ring->NumRead, NumWritten > k_ringCapacity ? NumWritten - k_ringCapacity : 0);
+
+                for (; NumRead < NumWritten; ++NumRead) {
+                    FSample const& Sample = Ring->Samples[NumRead % k_ringCapacity];
+                    DWORD const Before = Sample.Sequence.load(std::memory_order_acquire);
+                    INT const Depth = std::clamp(Sample.Depth, 0, k_maxDepth);
+                    std::copy_n(Sample.LeafFirst, Depth, Copy);
+                    std::atomic_thread_fence(std::memory_order_acquire);
+
+                    // Skips samples being overwritten right now.
+                    if ((Before & 1) != 0 || Sample.Sequence.load(std::memory_order_relaxed) != Before)
+                        continue;
+                    Aggregator.Add(std::span<UStructLike const* const>{ Copy, static_cast<size_t>(Depth) });
+                    ++NumDrained;
+                }
+                Ring->NumRead = NumRead;
+            }
+            return NumDrained;
+        }
+
+        /**
+         * @brief       Hooks @c ProcessInternal and @c CallFunction and starts sampling into @p Sampler.
+         * @param[in]   Init - Initializer used to resolve addresses and install hooks.
+         * @param[in]   Sampler - Receives samples until @ref Uninstall.
+         * @param[in]   ProcessInternalAt - Normally @c BUILTIN_PROCESSINTERNAL_PHOOK.
+         * @param[in]   CallFunctionAt - Normally @c BUILTIN_CALLFUNCTION_PHOOK.
+         * @return      True if both hooks were installed.
+         */
+        static bool Install(Initializer& Init, TScriptStackSampler& Sampler, Address const ProcessInternalAt, Address const CallFunctionAt) {
+            TScriptStackSampler* Expected = nullptr;
+            if (!s_sampler.compare_exchange_strong(Expected, &Sampler, std::memory_order_acq_rel))
+                return false;
+
+            void* const ProcessInternalTarget = Init.Resolve(ProcessInternalAt);
+            void* const ProcessInternalOriginal = ProcessInternalTarget != nullptr
+                ? Init.InstallHook(k_processInternalHookName, ProcessInternalTarget, reinterpret_cast<void*>(&ProcessInternalDetour))
+                : nullptr;
+            if (ProcessInternalOriginal == nullptr) {
+                s_sampler.store(nullptr, std::memory_order_release);
+                return false;
+            }
+            s_processInternalOriginal.store(reinterpret_cast<ProcessInternalType>(ProcessInternalOriginal), std::memory_order_release);
+
+            void* const CallFunctionTarget = Init.Resolve(CallFunctionAt);
+            void* const CallFunctionOriginal = CallFunctionTarget != nullptr
+                ? Init.InstallHook(k_callFunctionHookName, CallFunctionTarget, reinterpret_cast<void*>(&CallFunctionDetour))
+                : nullptr;
+            if (CallFunctionOriginal == nullptr) {
+                Init.UninstallHook(k_processInternalHookName);
+                s_sampler.store(nullptr, std::memory_order_release);
+                return false;
+            }
+            s_callFunctionOriginal.store(reinterpret_cast<CallFunctionType>(CallFunctionOriginal), std::memory_order_release);
+            return true;
+        }
+
+        /** Uninstalls the hooks, no further samples are taken. */
+        static void Uninstall(Initializer& Init) {
+            if (s_sampler.exchange(nullptr, std::memory_order_acq_rel) == nullptr)
+                return;
+            Init.UninstallHook(k_processInternalHookName);
+            Init.UninstallHook(k_callFunctionHookName);
+        }
+
+        static bool IsInstalled() noexcept { return s_sampler.load(std::memory_order_acquire) != nullptr; }
+
+    private:
+
+        FRing& GetThreadRing() {
+            if (t_cache.SamplerId != m_id) {
+                auto Ring = std::make_unique<FRing>();
+                Ring->Countdown = m_sampleEvery.load(std::memory_order_relaxed);
+                std::scoped_lock const Lock{ m_mutex };
+                t_cache.Ring = m_rings.emplace_back(std::move(Ring)).get();
+                t_cache.SamplerId = m_id;
+            }
+            return *t_cache.Ring;
+        }
+
+        static void Record(FRing& Ring, FFrame const* Frame, UStructLike const* const Callee) noexcept {
+            QWORD const Index = Ring.NumWritten.load(std::memory_order_relaxed);
+            FSample& Sample = Ring.Samples[Index % k_ringCapacity];
+
+            DWORD const Sequence = Sample.Sequence.load(std::memory_order_relaxed);
+            Sample.Sequence.store(Sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            INT Depth = 0;
+            if (Callee != nullptr)
+                Sample.LeafFirst[Depth++] = Callee;
+            for (; Frame != nullptr && Depth < k_maxDepth; Frame = Frame->PreviousFrame)
+                Sample.LeafFirst[Depth++] = reinterpret_cast<UStructLike const*>(Frame->Node);
+            Sample.Depth = Depth;
+
+            Sample.Sequence.store(Sequence + 2, std::memory_order_release);
+            Ring.NumWritten.store(Index + 1, std::memory_order_release);
+        }
+
+        static void ProcessInternalDetour(UObject* const Context, FFrame* const Stack, void* const Result) {
+            if (TScriptStackSampler* const Sampler = s_sampler.load(std::memory_order_acquire))
+                Sampler->OnCall(Stack);
+            s_processInternalOriginal.load(std::memory_order_acquire)(Context, Stack, Result);
+        }
+
+        static void CallFunctionDetour(UObject* const Context, FFrame* const Stack, void* const Result, UFunctionLike* const Function) {
+            TScriptStackSampler* const Sampler = s_sampler.load(std::memory_order_acquire);
+            if (Sampler != nullptr && Function != nullptr && (Function->FunctionFlags & k_funcNative) != 0)
+                Sampler->OnCall(Stack, reinterpret_cast<UStructLike const*>(Function));
+            s_callFunctionOriginal.load(std::memory_order_acquire)(Context, Stack, Result, Function);
+        }
+    };
+
+
+    /** Sampler for the game's own script VM, see @ref InstallScriptSampler. */
+    using FScriptStackSampler = TScriptStackSampler<UStruct, UFunction>;
+    using FScriptStackAggregator = TScriptStackAggregator<UStruct>;
+
+    /** Returns the sampler fed by @ref InstallScriptSampler. */
+    FScriptStackSampler& GetScriptSampler();
+
+    /**
+     * @brief       Hooks the script VM and samples call stacks every @p SampleEvery calls per thread.
+     * @param[in]   Init - Initializer used to resolve addresses and install hooks.
+     * @return      True if the hooks were installed.
+     */
+    bool InstallScriptSampler(Initializer& Init, INT SampleEvery = 1000);
+
+    /** Uninstalls the hooks installed by @ref InstallScriptSampler. */
+    void UninstallScriptSampler(Initializer& Init);
+
+}
@@ -34,6 +34,24 @@ public:
 #include "./Tests.FString.hpp"
 #include "./Tests.TArray.hpp"
 #include "./Tests.TMap.hpp"
+#include "./Tests.ObjectIndex.hpp"
+#include "./Tests.ClassHierarchy.hpp"
+#include "./Tests.ObjectIterator.hpp"
+#include "./Tests.StaticRef.hpp"
+#include "./Tests.WarmUp.hpp"
+#include "./Tests.ObjectHooks.hpp"
+#include "./Tests.WeakObjectPtr.hpp"
+#include "./Tests.BatchFind.hpp"
+#include "./Tests.NativeCall.hpp"
+#include "./Tests.InvokeBatch.hpp"
+#include "./Tests.FunctionHandle.hpp"
+#include "./Tests.DynamicInvoke.hpp"
+#include "./Tests.ProcessEventHooks.hpp"
+#include "./Tests.NativeReplace.hpp"
+#include "./Tests.FrameReader.hpp"
+#include "./Tests.NativeProfiler.hpp"
+#include "./Tests.ScriptSampler.hpp"
+#include "./Tests.InlineArray.hpp"
 
 
 int main(int const argc, char** const argv) {
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "./Utilities.hpp"
+#include "LESDK/Common/BatchFind.hpp"
+
+
+TEST_SUITE("BatchFind") {
+    TEST_CASE("all names are resolved in one pass") {
+        FakeObjectWorld World{};
+
+        FakeObject* const ObjectClass = World.AddClass("Object", nullptr);
+        FakeObject* const FunctionClass = World.AddClass("Function", ObjectClass);
+        FakeObject* const EnginePackage = World.Add("Engine", World.PackageClass);
+        FakeObject* const ActorClass = World.AddClass("Actor", ObjectClass, EnginePackage);
+        FakeObject* const Tick = World.Add("Tick", FunctionClass, ActorClass);
+        FakeObject* const Touch = World.Add("Touch", FunctionClass, ActorClass);
+
+        WCHAR const* const Names[] = {
+            L"Class Engine.Actor",
+            L"Function Engine.Actor.Tick",
+            nullptr,
+            L"Function Engine.Actor.Tick",
+            L"Function Engine.Actor.Bump",
+            L"Class Engine.Actor.Touch",
+            L"Malformed",
+            L"Function Engine.Actor.Touch",
+        };
+
+        FakeObject* Found[std::size(Names)]{};
+        CHECK_EQ(::LESDK::FindObjectsBatch(World.Objects, std::span{ Names }, std::span{ Found }), 4);
+
+        CHECK_EQ(Found[0], ActorClass);
+        CHECK_EQ(Found[1], Tick);
+        CHECK_EQ(Found[2], nullptr);
+        CHECK_EQ(Found[3], Tick);
+        CHECK_EQ(Found[4], nullptr);
+        CHECK_EQ(Found[5], nullptr);
+        CHECK_EQ(Found[6], nullptr);
+        CHECK_EQ(Found[7], Touch);
+    }
+
+    TEST_CASE("the object in the lowest slot wins") {
+        FakeObjectWorld World{};
+
+        FakeObject* const ObjectClass = World.AddClass("Object", nullptr);
+        FakeObject* const First = World.Add("Twin", ObjectClass, World.CorePackage);
+        World.Add("Twin", ObjectClass, World.CorePackage);
+
+        WCHAR const* const Names[] = { L"Object Core.Twin" };
+        FakeObject* Found[1]{};
+        CHECK_EQ(::LESDK::FindObjectsBatch(World.Objects, std::span{ Names }, std::span{ Found }), 1);
+        CHECK_EQ(Found[0], First);
+    }
+
+    TEST_CASE("threaded passes find the same objects") {
+        FakeObjectWorld World{};
+
+        FakeObject* const ObjectClass = World.AddClass("Object", nullptr);
+        INT const NumFillers = ::LESDK::k_batchFindMinSlotsPerThread * 4;
+        for (INT i = 0; i < NumFillers; ++i)
+            World.Add("Filler", ObjectClass, World.CorePackage, i + 1);
+
+        // The same name twice, in the ranges of different threads.
+        FakeObject* const Early = World.Objects(100);
+        World.Add("Filler", ObjectClass, World.CorePackage, Early->Name.Number);
+
+        std::vector<std::wstring> Texts{};
+        for (INT i : { 0, 99, 1000, NumFillers / 2, NumFillers - 1, NumFillers + 10 })
+            Texts.push_back(L"Object Core.Filler_" + std::to_wstring(i));
+        Texts.push_back(L"Object Core.Filler_" + std::to_wstring(Early->Name.Number - 1));
+
+        std::vector<WCHAR const*> Names{};
+        for (std::wstring const& Text : Texts)
+            Names.push_back(Text.c_str());
+
+        std::vector<FakeObject*> Single(Names.size()), Threaded(Names.size());
+        INT const NumSingle = ::LESDK::FindObjectsBatch(World.Objects, std::span<WCHAR const* const>{ Names }, std::span{ Single }, 1);
+        INT const NumThreaded = ::LESDK::FindObjectsBatch(World.Objects, std::span<WCHAR const* const>{ Names }, std::span{ Threaded }, 4);
+
+        CHECK_EQ(NumSingle, 6);
+        CHECK_EQ(NumThreaded, 6);
+        CHECK_EQ(Single, Threaded);
+        CHECK_EQ(Threaded.back(), Early);
+        CHECK_EQ(Threaded[5], nullptr);
+    }
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "doctest.h"
+#include "./Utilities.hpp"
+#include "LESDK/Common/ClassHierarchy.hpp"
+
+
+using FakeClassHierarchy = ::LESDK::TClassHierarchy<FakeObject, FakeObject>;
+
+
+SCENARIO("ClassHierarchy - ancestor checks") {
+    GIVEN("a small class tree") {
+        FakeObjectWorld World{};
+        FakeClassHierarchy Hierarchy{};
+
+        FakeObject* const ObjectClass = World.AddClass("Object", nullptr);
+        FakeObject* const ActorClass = World.AddClass("Actor", ObjectClass);
+        FakeObject* const PawnClass = World.AddClass("Pawn", ActorClass);
+        FakeObject* const PlayerClass = World.AddClass("SFXPawn_Player", PawnClass);
+        FakeObject* const VolumeClass = World.AddClass("Volume", ActorClass);
+        FakeObject* const Player = World.Add("SFXPawn_Player", PlayerClass, World.CorePackage, 1);
+
+        THEN("depths count super classes") {
+            CHECK_EQ(Hierarchy.GetDepth(ObjectClass), 0);
+            CHECK_EQ(Hierarchy.GetDepth(PawnClass), 2);
+            CHECK_EQ(Hierarchy.GetDepth(PlayerClass), 3);
+            CHECK_EQ(Hierarchy.GetDepth(nullptr), -1);
+        }
+
+        THEN("instances are of their class and its ancestors only") {
+            CHECK(Hierarchy.IsA(Player, PlayerClass));
+            CHECK(Hierarchy.IsA(Player, PawnClass));
+            CHECK(Hierarchy.IsA(Player, ActorClass));
+            CHECK(Hierarchy.IsA(Player, ObjectClass));
+            CHECK_FALSE(Hierarchy.IsA(Player, VolumeClass));
+            CHECK_FALSE(Hierarchy.IsA(Player, nullptr));
+            CHECK_FALSE(Hierarchy.IsA(nullptr, ObjectClass));
+        }
+
+        THEN("results agree with walking super fields") {
+            for (FakeObject* const Child : { ObjectClass, ActorClass, PawnClass, PlayerClass, VolumeClass }) {
+                for (FakeObject* const Class : { ObjectClass, ActorClass, PawnClass, PlayerClass, VolumeClass }) {
+                    bool bExpected = false;
+                    for (FakeObject* Super = Child; Super != nullptr; Super = Super->SuperField)
+                        bExpected = bExpected || Super == Class;
+                    CHECK_EQ(Hierarchy.IsChildOf(Child, Class), bExpected);
+                }
+            }
+        }
+
+        WHEN("a class is re-parented after its record was built") {
+            REQUIRE(Hierarchy.IsChildOf(VolumeClass, ActorClass));
+            VolumeClass->SuperField = ObjectClass;
+
+            THEN("the stale record is rebuilt without an invalidation") {
+                CHECK_FALSE(Hierarchy.IsChildOf(VolumeClass, ActorClass));
+                CHECK(Hierarchy.IsChildOf(VolumeClass, ObjectClass));
+                CHECK_EQ(Hierarchy.GetDepth(VolumeClass), 1);
+            }
+        }
+
+        WHEN("an ancestor further up is re-parented after records were built") {
+            REQUIRE(Hierarchy.IsChildOf(PlayerClass, ActorClass));
+            REQUIRE_EQ(Hierarchy.GetDepth(PlayerClass), 3);
+            PawnClass->SuperField = ObjectClass;
+            Hierarchy.Invalidate();
+
+            THEN("records of its descendants are rebuilt once invalidated") {
+                CHECK_FALSE(Hierarchy.IsChildOf(PlayerClass, ActorClass));
+                CHECK(Hierarchy.IsChildOf(PlayerClass, PawnClass));
+                CHECK_EQ(Hierarchy.GetDepth(PlayerClass), 2);
+            }
+        }
+
+        WHEN("a new class appears after records were built") {
+            REQUIRE(Hierarchy.IsA(Player, PawnClass));
+            FakeObject* const SquadClass = World.AddClass("SFXPawn_Henchman", PawnClass);
+            FakeObject* const Henchman = World.Add("SFXPawn_Henchman", SquadClass);
+
+            THEN("it gets its own record") {
+                CHECK(Hierarchy.IsA(Henchman, PawnClass));
+                CHECK_FALSE(Hierarchy.IsA(Henchman, PlayerClass));
+                CHECK_EQ(Hierarchy.GetDepth(SquadClass), 3);
+            }
+        }
+
+        WHEN("the hierarchy is invalidated") {
+            REQUIRE(Hierarchy.IsA(Player, PawnClass));
+            Hierarchy.Invalidate();
+
+            THEN("records are rebuilt on demand") {
+                CHECK(Hierarchy.IsA(Player, PawnClass));
+                CHECK_FALSE(Hierarchy.IsA(Player, VolumeClass));
+            }
+            THEN("records of unchanged classes are refreshed in place") {
+                for (INT i = 0; i < 10; ++i) {
+                    Hierarchy.Invalidate();
+                    CHECK(Hierarchy.IsA(Player, PawnClass));
+                }
+                CHECK_EQ(Hierarchy.GetNumRetired(), 0);
+            }
+            THEN("only records of changed classes are replaced") {
+                REQUIRE_FALSE(Hierarchy.IsChildOf(VolumeClass, PawnClass));
+                VolumeClass->SuperField = PawnClass;
+                CHECK(Hierarchy.IsChildOf(VolumeClass, PawnClass));
+                CHECK(Hierarchy.IsA(Player, PawnClass));
+                CHECK_EQ(Hierarchy.GetNumRetired(), 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,277 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "doctest.h"
+#include "./Utilities.hpp"
+#include "./Tests.NativeCall.hpp"
+#include "LESDK/Common/DynamicInvoke.hpp"
+
+
+namespace DynamicInvokeTests {
+
+    using namespace NativeCallTests;
+
+    using FakeInvoker = ::LESDK::TDynamicInvoker<FakeObject, FakeFunction, FakeProperty>;
+    using Value = FakeInvoker::Value;
+    using EDynamicInvokeError = ::LESDK::EDynamicInvokeError;
+    using EScriptParmKind = ::LESDK::EScriptParmKind;
+
+    // Property classes, so that parameters can be told apart by class name like in the engine.
+    struct FakePropertyClasses final {
+        FakeObject* Int;
+        FakeObject* Bool;
+        FakeObject* Str;
+        FakeObject* Struct;
+
+        explicit FakePropertyClasses(FakeObjectWorld& World)
+            : Int{ World.AddClass("IntProperty", nullptr) }
+            , Bool{ World.AddClass("BoolProperty", nullptr) }
+            , Str{ World.AddClass("StrProperty", nullptr) }
+            , Struct{ World.AddClass("StructProperty", nullptr) }
+        {}
+    };
+
+    struct DecorateParms final {
+        FString         Text;
+        UBOOL           bLoud;
+        FString         Tone;
+        FString         ReturnValue;
+    };
+
+    // Stand-in for a native "string Decorate(string Text, bool bLoud, out string Tone)".
+    struct FakeDecorate final {
+        FakeProperty    Text{ ::LESDK::k_propParm, offsetof(DecorateParms, Text), nullptr, sizeof(FString) };
+        FakeProperty    bLoud{ ::LESDK::k_propParm, offsetof(DecorateParms, bLoud) };
+        FakeProperty    Tone{ ::LESDK::k_propParm | ::LESDK::k_propOutParm, offsetof(DecorateParms, Tone), nullptr, sizeof(FString) };
+        FakeProperty    ReturnValue{ ::LESDK::k_propParm | ::LESDK::k_propOutParm | ::LESDK::k_propReturnParm,
+                            offsetof(DecorateParms, ReturnValue), nullptr, sizeof(FString) };
+        FakeFunction    Function{};
+
+        explicit FakeDecorate(FakePropertyClasses const& Classes) {
+            Text.Class = Classes.Str;
+            bLoud.Class = Classes.Bool;
+            bLoud.BitMask = 0x2;
+            Tone.Class = Classes.Str;
+            ReturnValue.Class = Classes.Str;
+
+            Text.PropertyLinkNext = &bLoud;
+            bLoud.PropertyLinkNext = &Tone;
+            Tone.PropertyLinkNext = &ReturnValue;
+            Function.PropertyLink = &Text;
+            Function.NumParms = 4;
+            Function.ParmsSize = sizeof(DecorateParms);
+            Function.ReturnValueOffset = offsetof(DecorateParms, ReturnValue);
+            Function.Func = reinterpret_cast<void*>(&Exec);
+        }
+
+        static void Exec(UObject* const Context, FFrame* const Stack, void* const Result) {
+            (void)Context;
+            auto* const Parms = reinterpret_cast<DecorateParms*>(Stack->Locals);
+            bool const bIsLoud = (Parms->bLoud & 0x2) != 0;
+
+            Parms->Tone = bIsLoud ? L"loud" : L"quiet";
+            FString& ReturnValue = *static_cast<FString*>(Result);
+            ReturnValue = Parms->Text;
+            if (bIsLoud)
+                ReturnValue.Append(L"!");
+        }
+    };
+
+    inline void SetIntClasses(FakeDivide& Divide, FakePropertyClasses const& Classes) {
+        Divide.A.Class = Classes.Int;
+        Divide.B.Class = Classes.Int;
+        Divide.Remainder.Class = Classes.Int;
+        Divide.ReturnValue.Class = Classes.Int;
+    }
+
+    static std::vector<FakeObject*> GScriptCalls{};
+
+    static void DivideInScript(FakeObject* const Object, UFunction* const Function, void* const Parms) {
+        (void)Function;
+        GScriptCalls.push_back(Object);
+        auto* const Divide = static_cast<DivideParms*>(Parms);
+        Divide->ReturnValue = Divide->A / Divide->B;
+        Divide->Remainder = Divide->A % Divide->B;
+    }
+
+}
+
+
+TEST_SUITE("DynamicInvoke") {
+    using namespace DynamicInvokeTests;
+
+    TEST_CASE("layouts are read from the property chain in declaration order") {
+        FakeObjectWorld World{};
+        FakePropertyClasses const Classes{ World };
+        FakeDecorate Decorate{ Classes };
+        Decorate.Function.PropertyLink = &Decorate.Tone;
+        Decorate.Tone.PropertyLinkNext = &Decorate.ReturnValue;
+        Decorate.ReturnValue.PropertyLinkNext = &Decorate.Text;
+        Decorate.bLoud.PropertyLinkNext = nullptr;
+
+        ::LESDK::FScriptFunctionLayout const Layout = ::LESDK::BuildScriptFunctionLayout<FakeProperty>(&Decorate.Function);
+
+        REQUIRE_EQ(Layout.Parms.size(), 3);
+        CHECK_EQ(Layout.Parms[0].Offset, offsetof(DecorateParms, Text));
+        CHECK_EQ(Layout.Parms[0].Kind, EScriptParmKind::String);
+        CHECK_EQ(Layout.Parms[1].Kind, EScriptParmKind::Bool);
+        CHECK_EQ(Layout.Parms[1].BitMask, 0x2);
+        CHECK_EQ(Layout.Parms[2].Kind, EScriptParmKind::String);
+        CHECK(Layout.Parms[2].IsOut());
+        CHECK(Layout.bHasReturnValue);
+        CHECK(Layout.bHasStrings);
+        CHECK_EQ(Layout.ReturnValue.Offset, offsetof(DecorateParms, ReturnValue));
+        CHECK_EQ(Layout.ParmsSize, sizeof(DecorateParms));
+    }
+
+    TEST_CASE("parameters of unknown class, size, or dimension are opaque") {
+        FakeObjectWorld World{};
+        FakePropertyClasses const Classes{ World };
+
+        FakeProperty Property{ ::LESDK::k_propParm, 0 };
+        CHECK_EQ(::LESDK::ClassifyScriptParm(&Property), EScriptParmKind::Unknown);
+        Property.Class = Classes.Int;
+        CHECK_EQ(::LESDK::ClassifyScriptParm(&Property), EScriptParmKind::Int);
+        Property.ArrayDim = 2;
+        CHECK_EQ(::LESDK::ClassifyScriptParm(&Property), EScriptParmKind::Unknown);
+        Property.ArrayDim = 1;
+        Property.ElementSize = 8;
+        CHECK_EQ(::LESDK::ClassifyScriptParm(&Property), EScriptParmKind::Unknown);
+        Property.Class = Classes.Struct;
+        CHECK_EQ(::LESDK::ClassifyScriptParm(&Property), EScriptParmKind::Unknown);
+    }
+
+    TEST_CASE("natives are called with marshalled arguments and the layout is walked once") {
+        FakeObjectWorld World{};
+        FakePropertyClasses const Classes{ World };
+        FakeObject* const Object = World.Add("Object_0", World.ClassClass);
+        FakeDivide Divide{};
+        SetIntClasses(Divide, Classes);
+        Divide.Function.Func = reinterpret_cast<void*>(&ExecDivide);
+
+        FakeInvoker Invoker{};
+        GNumCalls = 0;
+
+        Value Args[] = { INT{ 47 }, BYTE{ 10 }, Value{} };
+        Value Return{};
+        REQUIRE_EQ(Invoker.Invoke(Object, &Divide.Function, Args, &Return), EDynamicInvokeError::None);
+        CHECK_EQ(Return, Value{ INT{ 4 } });
+        CHECK_EQ(Args[2], Value{ INT{ 7 } });
+        CHECK_EQ(Invoker.NumLayouts(), 1);
+
+        // Cached: breaking the reflection data afterwards does not affect later calls.
+        Divide.Function.PropertyLink = nullptr;
+        Value Again[] = { INT{ 9 }, INT{ 2 } };
+        REQUIRE_EQ(Invoker.Invoke(Object, &Divide.Function, Again, &Return), EDynamicInvokeError::None);
+        CHECK_EQ(Return, Value{ INT{ 4 } });
+        CHECK_EQ(Again[1], Value{ INT{ 2 } });
+        CHECK_EQ(Invoker.NumLayouts(), 1);
+        CHECK_EQ(GNumCalls, 2);
+
+        Invoker.Reset();
+        CHECK_EQ(Invoker.NumLayouts(), 0);
+    }
+
+    TEST_CASE("strings and bools round-trip through the parameter block") {
+        FakeObjectWorld World{};
+        FakePropertyClasses const Classes{ World };
+        FakeObject* const Object = World.Add("Object_0", World.ClassClass);
+        FakeDecorate Decorate{ Classes };
+
+        FakeInvoker Invoker{};
+        Value Return{};
+
+        Value Loud[] = { std::wstring{ L"hello" }, true, Value{} };
+        REQUIRE_EQ(Invoker.Invoke(Object, &Decorate.Function, Loud, &Return), EDynamicInvokeError::None);
+        CHECK_EQ(Return, Value{ std::wstring{ L"hello!" } });
+        CHECK_EQ(Loud[2], Value{ std::wstring{ L"loud" } });
+
+        Value Quiet[] = { std::wstring{ L"hello" }, INT{ 0 }, Value{} };
+        REQUIRE_EQ(Invoker.Invoke(Object, &Decorate.Function, Quiet, &Return), EDynamicInvokeError::None);
+        CHECK_EQ(Return, Value{ std::wstring{ L"hello" } });
+        CHECK_EQ(Quiet[2], Value{ std::wstring{ L"quiet" } });
+    }
+
+    TEST_CASE("script functions go through ProcessEvent") {
+        FakeObjectWorld World{};
+        FakePropertyClasses const Classes{ World };
+        FakeObject* const Object = World.Add("Object_0", World.ClassClass);
+        FakeDivide Divide{};
+        SetIntClasses(Divide, Classes);
+        Divide.Function.FunctionFlags = 0;
+
+        GScriptCalls.clear();
+        FakeObject::GProcessEvent = &DivideInScript;
+
+        FakeInvoker Invoker{};
+        Value Args[] = { INT{ 20 }, INT{ 6 }, Value{} };
+        Value Return{};
+        EDynamicInvokeError const Error = Invoker.Invoke(Object, &Divide.Function, Args, &Return);
+
+        FakeObject::GProcessEvent = nullptr;
+
+        CHECK_EQ(Error, EDynamicInvokeError::None);
+        CHECK_EQ(GScriptCalls, std::vector<FakeObject*>{ Object });
+        CHECK_EQ(Return, Value{ INT{ 3 } });
+        CHECK_EQ(Args[2], Value{ INT{ 2 } });
+    }
+
+    TEST_CASE("bad calls are refused before anything is called") {
+        FakeObjectWorld World{};
+        FakePropertyClasses const Classes{ World };
+        FakeObject* const Object = World.Add("Object_0", World.ClassClass);
+        FakeDivide Divide{};
+        SetIntClasses(Divide, Classes);
+        Divide.Function.Func = reinterpret_cast<void*>(&ExecDivide);
+        FakeInvoker Invoker{};
+        GNumCalls = 0;
+
+        Value Args[] = { INT{ 1 }, INT{ 1 }, Value{} };
+        CHECK_EQ(Invoker.Invoke(nullptr, &Divide.Function, Args), EDynamicInvokeError::NotFound);
+        CHECK_EQ(Invoker.Invoke(Object, static_cast<FakeFunction*>(nullptr), Args), EDynamicInvokeError::NotFound);
+
+        Value TooMany[] = { INT{ 1 }, INT{ 1 }, INT{ 1 }, INT{ 1 } };
+        CHECK_EQ(Invoker.Invoke(Object, &Divide.Function, TooMany), EDynamicInvokeError::NumArgs);
+
+        Value WrongType[] = { std::wstring{ L"1" }, INT{ 1 } };
+        CHECK_EQ(Invoker.Invoke(Object, &Divide.Function, WrongType), EDynamicInvokeError::ArgumentType);
+        Value WrongObject[] = { INT{ 1 }, Object };
+        CHECK_EQ(Invoker.Invoke(Object, &Divide.Function, WrongObject), EDynamicInvokeError::ArgumentType);
+
+        CHECK_EQ(GNumCalls, 0);
+    }
+
+    TEST_CASE("functions with parameters owning memory of unknown kind are refused") {
+        FakeObjectWorld World{};
+        FakePropertyClasses const Classes{ World };
+        FakeObject* const Object = World.Add("Object_0", World.ClassClass);
+        FakeDivide Divide{};
+        SetIntClasses(Divide, Classes);
+        // Stands for an out dynamic array, which the callee would allocate.
+        Divide.Remainder.Class = Classes.Struct;
+        Divide.Remainder.PropertyFlags |= ::LESDK::k_propNeedCtorLink;
+        Divide.Function.Func = reinterpret_cast<void*>(&ExecDivide);
+        FakeInvoker Invoker{};
+        GNumCalls = 0;
+
+        REQUIRE(Invoker.GetLayout(&Divide.Function)->bHasUnsupported);
+        Value Args[] = { INT{ 47 }, INT{ 10 } };
+        CHECK_EQ(Invoker.Invoke(Object, &Divide.Function, Args), EDynamicInvokeError::UnsupportedParm);
+        CHECK_EQ(GNumCalls, 0);
+    }
+
+    TEST_CASE("layouts stay alive across a reset") {
+        FakeObjectWorld World{};
+        FakePropertyClasses const Classes{ World };
+        FakeDivide Divide{};
+        SetIntClasses(Divide, Classes);
+        FakeInvoker Invoker{};
+
+        std::shared_ptr<::LESDK::FScriptFunctionLayout const> const Layout = Invoker.GetLayout(&Divide.Function);
+        Invoker.Reset();
+        CHECK_EQ(Invoker.NumLayouts(), 0);
+        CHECK_EQ(Layout->Parms.size(), 3);
+    }
+}
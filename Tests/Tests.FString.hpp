@@ -52,7 +52,7 @@ SCENARIO("FString - default initialization") {
             String.Reserve(1025);
 
             THEN("capacity increases") {
-                CHECK_EQ(String.Capacity(), 1025);
+                CHECK_GE(String.Capacity(), 1025);
             }
             THEN("length and chars stay the same") {
                 CHECK_EQ(String.Length(), 0);
@@ -253,13 +253,16 @@ SCENARIO("FString - formatting append operations") {
         FString String{};
         String.Reserve(10);
 
-        REQUIRE_EQ(String.Capacity(), 10);
+        // Capacity may be rounded up to what the allocator hands out.
+        auto const Reserved = String.Capacity();
+        REQUIRE_GE(Reserved, 10);
+        REQUIRE_LT(Reserved, 21);
 
         WHEN("a format is appended within reserved range") {
             String.AppendFormat(L"%.1f ms", 16.6f);
 
             THEN("capacity stays the same") {
-                CHECK_EQ(String.Capacity(), 10);
+                CHECK_EQ(String.Capacity(), Reserved);
             }
             THEN("length increases") {
                 CHECK_EQ(String.Length(), 7);
@@ -272,7 +275,7 @@ SCENARIO("FString - formatting append operations") {
                 String.AppendFormat(L" / %.1f frames", 60.f);
 
                 THEN("capacity and length increase") {
-                    CHECK_EQ(String.Capacity(), 21);
+                    CHECK_GE(String.Capacity(), 21);
                     CHECK_EQ(String.Length(), 21);
                 }
                 THEN("chars match what was appended") {
@@ -285,7 +288,7 @@ SCENARIO("FString - formatting append operations") {
             String.AppendFormat(L"Hello, %dst century world!", 21);
 
             THEN("capacity and length increase") {
-                CHECK_EQ(String.Capacity(), 26);
+                CHECK_GE(String.Capacity(), 26);
                 CHECK_EQ(String.Length(), 26);
             }
             THEN("chars match what was appended") {
@@ -346,12 +349,13 @@ SCENARIO("FString - transcoding append operations") {
     GIVEN("a reserved string") {
         FString String{};
         String.Reserve(6);
+        auto const Reserved = String.Capacity();
 
         WHEN("a utf-8 substring within reserved range is appended") {
             String.AppendUtf8("абв");
 
             THEN("capacity stays the same") {
-                CHECK_EQ(String.Capacity(), 6);
+                CHECK_EQ(String.Capacity(), Reserved);
             }
             THEN("length and chars match what was appended") {
                 CHECK_EQ(String.Length(), 3);
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstring>
+#include <vector>
+
+#include "doctest.h"
+#include "./Utilities.hpp"
+#include "./Tests.NativeCall.hpp"
+#include "LESDK/Common/FrameReader.hpp"
+
+
+namespace FrameReaderTests {
+
+    using namespace NativeCallTests;
+
+    using FakeFrameReader = ::LESDK::TFrameReader<FakeProperty>;
+
+    // Assembles argument bytecode the way the script compiler lays it out.
+    struct FakeCode final {
+        std::vector<BYTE> Bytes{};
+
+        FakeCode& Variable(BYTE const Token, FakeProperty const* const Property) {
+            Bytes.push_back(Token);
+            BYTE Operand[sizeof(Property)];
+            std::memcpy(Operand, &Property, sizeof(Property));
+            Bytes.insert(Bytes.end(), std::begin(Operand), std::end(Operand));
+            return *this;
+        }
+
+        FakeCode& IntConst(int const Value) {
+            Bytes.push_back(0x1D);
+            BYTE Operand[sizeof(Value)];
+            std::memcpy(Operand, &Value, sizeof(Value));
+            Bytes.insert(Bytes.end(), std::begin(Operand), std::end(Operand));
+            return *this;
+        }
+
+        FakeCode& End() {
+            Bytes.push_back(::LESDK::k_exEndFunctionParms);
+            return *this;
+        }
+    };
+
+    static int GNumSteps = 0;
+
+    static void ExecIntConst(UObject* const Context, FFrame* const Stack, void* const Result) {
+        (void)Context;
+        ++GNumSteps;
+        std::memcpy(Result, Stack->Code, sizeof(int));
+        Stack->Code += sizeof(int);
+    }
+
+    // EX_True, evaluated by the engine even for plain bool variables.
+    static void ExecTrue(UObject* const Context, FFrame* const Stack, void* const Result) {
+        (void)Context; (void)Stack;
+        ++GNumSteps;
+        *static_cast<UBOOL*>(Result) = TRUE;
+    }
+
+}
+
+
+TEST_SUITE("FrameReader") {
+    using namespace FrameReaderTests;
+
+    TEST_CASE("arguments are read in place or evaluated, in order") {
+        tNative* Natives[256]{};
+        Natives[0x1D] = &ExecIntConst;
+        Natives[0x27] = &ExecTrue;
+        tNative** const PreviousNatives = GNatives;
+        GNatives = Natives;
+        GNumSteps = 0;
+
+        int Locals[4] = { 0, 11, 0, 0 };
+        int Members[4] = { 0, 0, 22, 0 };
+        int OutTarget = 33;
+
+        FakeProperty Local{ ::LESDK::k_propParm, 0x4 };
+        FakeProperty Member{ 0, 0x8 };
+        FakeProperty Out{ ::LESDK::k_propParm | ::LESDK::k_propOutParm, 0xC };
+
+        FFrame::FOutParmRec Record{ reinterpret_cast<UProperty*>(&Out), reinterpret_cast<BYTE*>(&OutTarget), nullptr };
+
+        FakeCode Code{};
+        Code.Variable(::LESDK::k_exLocalVariable, &Local)
+            .Variable(::LESDK::k_exInstanceVariable, &Member)
+            .IntConst(44)
+            .Variable(::LESDK::k_exLocalOutVariable, &Out);
+        Code.Bytes.push_back(0x27);
+        Code.End();
+
+        FFrame Stack{};
+        Stack.Object = reinterpret_cast<UObject*>(Members);
+        Stack.Locals = reinterpret_cast<BYTE*>(Locals);
+        Stack.Code = Code.Bytes.data();
+        Stack.OutParms = &Record;
+
+        FakeFrameReader Reader{ Stack };
+        CHECK_EQ(Reader.Get<int>(), 11);
+        int MemberFallback = 0;
+        int& MemberRef = Reader.GetRef<int>(MemberFallback);
+        CHECK_EQ(&MemberRef, &Members[2]);
+        CHECK_EQ(Reader.Get<int>(), 44);
+        int OutFallback = 0;
+        int& OutRef = Reader.GetRef<int>(OutFallback);
+        CHECK_EQ(&OutRef, &OutTarget);
+        OutRef = 55;
+        CHECK(Reader.Get<bool>());
+        Reader.Finish();
+
+        GNatives = PreviousNatives;
+
+        CHECK_EQ(OutTarget, 55);
+        CHECK_EQ(Stack.Code, Code.Bytes.data() + Code.Bytes.size());
+        // Only the constants went through the VM.
+        CHECK_EQ(GNumSteps, 2);
+    }
+
+    TEST_CASE("expressions without an address are evaluated into the fallback") {
+        tNative* Natives[256]{};
+        Natives[0x1D] = &ExecIntConst;
+        tNative** const PreviousNatives = GNatives;
+        GNatives = Natives;
+
+        FakeCode Code{};
+        Code.IntConst(7).End();
+
+        FFrame Stack{};
+        Stack.Code = Code.Bytes.data();
+
+        FakeFrameReader Reader{ Stack };
+        int Fallback = 0;
+        int& Ref = Reader.GetRef<int>(Fallback);
+        Reader.Finish();
+
+        GNatives = PreviousNatives;
+
+        CHECK_EQ(&Ref, &Fallback);
+        CHECK_EQ(Fallback, 7);
+        CHECK_EQ(Stack.Code, Code.Bytes.data() + Code.Bytes.size());
+    }
+
+    TEST_CASE("strings are copied out of variables, or referenced where they live") {
+        FString Locals[2]{ FString{ L"first" }, FString{ L"second" } };
+        FakeProperty First{ ::LESDK::k_propParm, 0, nullptr, sizeof(FString) };
+        FakeProperty Second{ ::LESDK::k_propParm, sizeof(FString), nullptr, sizeof(FString) };
+
+        FakeCode Code{};
+        Code.Variable(::LESDK::k_exLocalVariable, &First)
+            .Variable(::LESDK::k_exLocalVariable, &Second)
+            .End();
+
+        FFrame Stack{};
+        Stack.Locals = reinterpret_cast<BYTE*>(Locals);
+        Stack.Code = Code.Bytes.data();
+
+        FakeFrameReader Reader{ Stack };
+        FString const Copy = Reader.Get<FString>();
+        FString Unused{};
+        FString& Ref = Reader.GetRef<FString>(Unused);
+        Reader.Finish();
+
+        CHECK_EQ(Copy, FString{ L"first" });
+        CHECK_EQ(&Ref, &Locals[1]);
+    }
+}
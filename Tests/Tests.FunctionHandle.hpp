@@ -0,0 +1,122 @@
+#pragma once
+
+#include "doctest.h"
+#include "./Utilities.hpp"
+#include "./Tests.NativeCall.hpp"
+#include "LESDK/Common/FunctionHandle.hpp"
+
+
+namespace FunctionHandleTests {
+
+    template<class Signature>
+    using FakeFunctionHandle = ::LESDK::TFunctionHandle<Signature, FakeObject, NativeCallTests::FakeFunction>;
+
+    using EFunctionBindError = ::LESDK::EFunctionBindError;
+
+    // Stand-in for a native BYTE Increment(BYTE Value), whose block the engine rounds up to 4 bytes.
+    struct FakeIncrement final {
+        NativeCallTests::FakeProperty   Value{ ::LESDK::k_propParm, 0x0, nullptr, 1 };
+        NativeCallTests::FakeProperty   ReturnValue{ ::LESDK::k_propParm | ::LESDK::k_propOutParm | 0x400, 0x1, nullptr, 1 };
+        NativeCallTests::FakeFunction   Function{};
+
+        FakeIncrement() {
+            Value.PropertyLinkNext = &ReturnValue;
+            Function.PropertyLink = &Value;
+            Function.NumParms = 2;
+            Function.ParmsSize = 4;
+            Function.ReturnValueOffset = 0x1;
+            Function.Script.Add(0x16);
+        }
+    };
+
+    static void ExecIncrement(UObject* const Context, FFrame* const Stack, void* const Result) {
+        (void)Context;
+        auto const* const Function = reinterpret_cast<NativeCallTests::FakeFunction const*>(Stack->Node);
+        *static_cast<BYTE*>(Result) = static_cast<BYTE>(Stack->Locals[0] + 1);
+        // The engine may touch the whole block, padding included.
+        for (INT Offset = 2; Offset < Function->ParmsSize; ++Offset)
+            Stack->Locals[Offset] = 0xCD;
+    }
+
+}
+
+
+TEST_SUITE("FunctionHandle") {
+    using namespace NativeCallTests;
+    using namespace FunctionHandleTests;
+
+    TEST_CASE("a handle binds to a function with a matching layout and calls it") {
+        FakeObjectWorld World{};
+        FakeObject* const Object = World.Add("Object_0", World.ClassClass);
+        FakeDivide Divide{};
+        Divide.Function.Func = reinterpret_cast<void*>(&ExecDivide);
+
+        FakeFunctionHandle<int(int, int, int&)> Handle{};
+        CHECK_FALSE(Handle.IsBound());
+        REQUIRE_EQ(Handle.Bind(&Divide.Function), EFunctionBindError::None);
+        CHECK(Handle.IsBound());
+        CHECK_EQ(Handle.GetFunction(), &Divide.Function);
+
+        GNumCalls = 0;
+        int Remainder = -1;
+        CHECK_EQ(Handle(Object, 47, 10, Remainder), 4);
+        CHECK_EQ(Remainder, 7);
+        CHECK_EQ(Handle(Object, 9, 3, Remainder), 3);
+        CHECK_EQ(Remainder, 0);
+        CHECK_EQ(GNumCalls, 2);
+    }
+
+    TEST_CASE("parameter order in the property chain does not matter") {
+        FakeDivide Divide{};
+        Divide.Function.PropertyLink = &Divide.ReturnValue;
+        Divide.ReturnValue.PropertyLinkNext = &Divide.A;
+        Divide.Remainder.PropertyLinkNext = nullptr;
+
+        FakeFunctionHandle<int(int, int, int&)> Handle{};
+        CHECK_EQ(Handle.Bind(&Divide.Function), EFunctionBindError::None);
+    }
+
+    TEST_CASE("mismatching signatures are refused") {
+        FakeDivide Divide{};
+
+        CHECK_EQ(FakeFunctionHandle<int(int, int, int&)>{}.Bind(nullptr), EFunctionBindError::NotFound);
+        CHECK_EQ(FakeFunctionHandle<int(int, int)>{}.Bind(&Divide.Function), EFunctionBindError::NumParms);
+        CHECK_EQ(FakeFunctionHandle<QWORD(int, int, int&)>{}.Bind(&Divide.Function), EFunctionBindError::ParmsSize);
+        CHECK_EQ(FakeFunctionHandle<void(int, int, int&, int&)>{}.Bind(&Divide.Function), EFunctionBindError::ReturnValueOffset);
+        CHECK_EQ(FakeFunctionHandle<int(int, int, int)>{}.Bind(&Divide.Function), EFunctionBindError::Parameter);
+        CHECK_EQ(FakeFunctionHandle<int(short, short, QWORD)>{}.Bind(&Divide.Function), EFunctionBindError::Parameter);
+
+        FakeFunctionHandle<int(int, int, int&)> Handle{};
+        REQUIRE_EQ(Handle.Bind(&Divide.Function), EFunctionBindError::None);
+        Divide.B.Offset = 0x6;
+        CHECK_EQ(Handle.Bind(&Divide.Function), EFunctionBindError::Parameter);
+        CHECK_FALSE(Handle.IsBound());
+    }
+
+    TEST_CASE("functions whose block is rounded up are called with a block of that size") {
+        FakeObjectWorld World{};
+        FakeObject* const Object = World.Add("Object_0", World.ClassClass);
+        FakeIncrement Increment{};
+        Increment.Function.Func = reinterpret_cast<void*>(&ExecIncrement);
+
+        FakeFunctionHandle<BYTE(BYTE)> Handle{};
+        REQUIRE_EQ(Handle.Bind(&Increment.Function), EFunctionBindError::None);
+        CHECK_EQ(Handle(Object, 41), 42);
+    }
+
+    TEST_CASE("layouts follow 4-byte packing and 32-bit booleans") {
+        using Layout = ::LESDK::Detail::TScriptParmLayout<bool, BYTE, void*, bool&>;
+        constexpr Layout Computed{};
+
+        CHECK_EQ(Layout::k_numParms, 4);
+        CHECK_EQ(Computed.Offsets[0], 0x0);
+        CHECK_EQ(Computed.Offsets[1], 0x4);
+        CHECK_EQ(Computed.Offsets[2], 0xC);
+        CHECK_EQ(Computed.Offsets[3], 0x10);
+        CHECK_EQ(Computed.Sizes[2], 4);
+        CHECK(Computed.bOuts[2]);
+        CHECK(Computed.bOuts[3]);
+        CHECK_FALSE(Computed.bOuts[1]);
+        CHECK_EQ(Computed.ParmsSize, 0x14);
+    }
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "./Utilities.hpp"
+#include "LESDK/Common/InlineArray.hpp"
+
+
+SCENARIO("TInlineArray - inline storage and spilling") {
+
+    GIVEN("an inline array of trivial elements") {
+        TInlineArray<int, 4> Array{ 1, 2, 3 };
+
+        THEN("elements are stored inline") {
+            CHECK(Array.IsInline());
+            CHECK_EQ(Array.Capacity(), 4);
+            CHECK_EQ(Array.AsSpan().size(), 3);
+        }
+
+        WHEN("it is filled past its inline capacity") {
+            Array.Add(4);
+            REQUIRE(Array.IsInline());
+            Array.Add(5);
+            Array.Append(Array.AsSpan());
+
+            THEN("elements spill to the heap, keeping their values") {
+                CHECK_FALSE(Array.IsInline());
+                CHECK_GE(Array.Capacity(), 10);
+                CHECK_EQ(std::vector<int>(Array.begin(), Array.end()), std::vector<int>{ 1, 2, 3, 4, 5, 1, 2, 3, 4, 5 });
+            }
+
+            AND_WHEN("it is moved") {
+                int const* const SpilledData = Array.GetData();
+                TInlineArray<int, 4> Moved{ std::move(Array) };
+
+                THEN("the heap block changes hands") {
+                    CHECK_EQ(Moved.GetData(), SpilledData);
+                    CHECK_EQ(Moved.Count(), 10);
+                    CHECK(Array.IsInline());
+                    CHECK(Array.Empty());
+                }
+            }
+        }
+
+        WHEN("a view is taken") {
+            REQUIRE(Array.IsInline());
+            TArrayView<int> const View = Array.AsView();
+
+            THEN("the elements are moved out of inline storage first") {
+                CHECK_FALSE(Array.IsInline());
+                CHECK_EQ(std::vector<int>(Array.begin(), Array.end()), std::vector<int>{ 1, 2, 3 });
+            }
+            THEN("it refers to the same elements") {
+                CHECK_EQ(View.GetData(), Array.GetData());
+                CHECK_EQ(View.Count(), 3);
+            }
+        }
+    }
+
+    GIVEN("an inline array of non-trivial elements") {
+        Counters Counters{};
+
+        WHEN("it spills and leaves scope") {
+            {
+                TInlineArray<Movable, 2> Array{};
+                Array.Emplace(Counters);
+                Array.Emplace(Counters);
+                Array.Emplace(Counters);
+                Array.Erase(0);
+                TInlineArray<Movable, 2> Copy{ Array };
+            }
+
+            THEN("every element is destroyed exactly once") {
+                CHECK_EQ(Counters.Construct, 3);
+                CHECK_EQ(Counters.Destroy, Counters.Construct + Counters.Copy + Counters.Move);
+            }
+        }
+
+        WHEN("an inline array is moved") {
+            TInlineArray<Movable, 2> Array{};
+            Array.Emplace(Counters);
+            TInlineArray<Movable, 2> Moved{ std::move(Array) };
+
+            THEN("elements are relocated") {
+                CHECK_EQ(Moved.Count(), 1);
+                CHECK(Array.Empty());
+                CHECK_EQ(Counters.Move, 1);
+                CHECK_EQ(Counters.Destroy, 1);
+            }
+        }
+    }
+}
+
+
+SCENARIO("TInlineString - building short strings") {
+
+    GIVEN("an empty inline string") {
+        TInlineString<8> String{};
+
+        THEN("it is empty and null-terminated") {
+            CHECK(String.Empty());
+            CHECK_EQ(String.Length(), 0);
+            CHECK_EQ(std::wstring{ String.Chars() }, L"");
+        }
+
+        WHEN("short text is appended") {
+            String.Append(L"Core").Append(L'.').AppendAnsi("Obj");
+
+            THEN("it stays inline") {
+                CHECK(String.IsInline());
+                CHECK_EQ(String.Length(), 8);
+                CHECK(String.Equals(L"Core.Obj"));
+                CHECK_EQ(std::wstring{ *String }, L"Core.Obj");
+            }
+
+            AND_WHEN("longer text is appended") {
+                String.Append(L"ect.Name");
+
+                THEN("it spills, still null-terminated") {
+                    CHECK_FALSE(String.IsInline());
+                    CHECK_EQ(static_cast<std::wstring_view>(String), L"Core.Object.Name");
+                    CHECK_EQ(String.Chars()[String.Length()], L'\0');
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "./Utilities.hpp"
+#include "./Tests.NativeCall.hpp"
+#include "LESDK/Common/InvokeBatch.hpp"
+
+
+namespace InvokeBatchTests {
+
+    static std::vector<FakeObject*> GScriptCalls{};
+
+    static void RecordScriptCall(FakeObject* const Object, UFunction* const Function, void* const Parms) {
+        (void)Function;
+        auto* const DivideParms = static_cast<NativeCallTests::DivideParms*>(Parms);
+        DivideParms->ReturnValue += 1;
+        GScriptCalls.push_back(Object);
+    }
+
+    struct ShoutParms final {
+        FString         Text;
+        FString         Tone;
+        FString         ReturnValue;
+    };
+
+    // Stand-in for a native "string Shout(string Text, out string Tone)", which reallocates its outputs.
+    struct FakeShout final {
+        static constexpr QWORD k_flags = ::LESDK::k_propParm | ::LESDK::k_propNeedCtorLink;
+
+        FakeObject*                     StrClass;
+        NativeCallTests::FakeProperty   Text{ k_flags, offsetof(ShoutParms, Text), nullptr, sizeof(FString) };
+        NativeCallTests::FakeProperty   Tone{ k_flags | ::LESDK::k_propOutParm, offsetof(ShoutParms, Tone), nullptr, sizeof(FString) };
+        NativeCallTests::FakeProperty   ReturnValue{ k_flags | ::LESDK::k_propOutParm | ::LESDK::k_propReturnParm,
+                                            offsetof(ShoutParms, ReturnValue), nullptr, sizeof(FString) };
+        NativeCallTests::FakeFunction   Function{};
+
+        explicit FakeShout(FakeObjectWorld& World)
+            : StrClass{ World.AddClass("StrProperty", nullptr) }
+        {
+            Text.Class = StrClass;
+            Tone.Class = StrClass;
+            ReturnValue.Class = StrClass;
+            Text.PropertyLinkNext = &Tone;
+            Tone.PropertyLinkNext = &ReturnValue;
+            Function.PropertyLink = &Text;
+            Function.NumParms = 3;
+            Function.ParmsSize = sizeof(ShoutParms);
+            Function.ReturnValueOffset = offsetof(ShoutParms, ReturnValue);
+            Function.Func = reinterpret_cast<void*>(&Exec);
+        }
+
+        static void Exec(UObject* const Context, FFrame* const Stack, void* const Result) {
+            (void)Context;
+            auto* const Parms = reinterpret_cast<ShoutParms*>(Stack->Locals);
+            Parms->Tone.Append(L"loud");
+            FString& ReturnValue = *static_cast<FString*>(Result);
+            ReturnValue = Parms->Text;
+            ReturnValue.Append(L"!");
+        }
+    };
+
+}
+
+
+TEST_SUITE("InvokeBatch") {
+    using namespace NativeCallTests;
+    using namespace InvokeBatchTests;
+
+    TEST_CASE("a native is called on every object with the same inputs") {
+        FakeObjectWorld World{};
+        FakeObject* const First = World.Add("Object_0", World.ClassClass);
+        FakeObject* const Second = World.Add("Object_1", World.ClassClass);
+        FakeDivide Divide{};
+        Divide.Function.Func = reinterpret_cast<void*>(&ExecDivide);
+
+        FakeObject* const Objects[] = { First, nullptr, Second, First };
+        int NumInits = 0;
+        std::vector<std::pair<FakeObject*, int>> Results{};
+
+        GNumCalls = 0;
+        ::LESDK::FInvokeBatchResult const Result = ::LESDK::InvokeBatch(&Divide.Function, std::span<FakeObject* const>{ Objects },
+            [&](void* const Parms) {
+                ++NumInits;
+                auto* const Typed = static_cast<DivideParms*>(Parms);
+                CHECK_EQ(Typed->ReturnValue, 0);
+                Typed->A = 23;
+                Typed->B = 4;
+                Typed->Remainder = -1;
+            },
+            [&](FakeObject* const Object, void* const Parms) {
+                auto* const Typed = static_cast<DivideParms*>(Parms);
+                Results.emplace_back(Object, Typed->ReturnValue);
+                CHECK_EQ(Typed->Remainder, 3);
+                CHECK_EQ(Typed->A, 23);
+                // Clobber outputs, the next call must see them reset.
+                Typed->ReturnValue = 1000;
+                Typed->Remainder = 1000;
+            });
+
+        CHECK_EQ(NumInits, 1);
+        CHECK_EQ(Result.NumCalls, 3);
+        CHECK_EQ(Result.NumNativeCalls, 3);
+        CHECK_EQ(GNumCalls, 3);
+        CHECK_GE(Result.Elapsed.count(), 0);
+
+        std::vector<std::pair<FakeObject*, int>> const Expected{ { First, 5 }, { Second, 5 }, { First, 5 } };
+        CHECK_EQ(Results, Expected);
+    }
+
+    TEST_CASE("script functions go through ProcessEvent") {
+        FakeObjectWorld World{};
+        FakeObject* const First = World.Add("Object_0", World.ClassClass);
+        FakeObject* const Second = World.Add("Object_1", World.ClassClass);
+        FakeDivide Divide{};
+        Divide.Function.FunctionFlags = 0;
+
+        GScriptCalls.clear();
+        FakeObject::GProcessEvent = &RecordScriptCall;
+
+        FakeObject* const Objects[] = { First, Second };
+        std::vector<int> Returns{};
+        ::LESDK::FInvokeBatchResult const Result = ::LESDK::InvokeBatch(&Divide.Function, std::span<FakeObject* const>{ Objects },
+            [](void*) {},
+            [&](FakeObject*, void* const Parms) { Returns.push_back(static_cast<DivideParms*>(Parms)->ReturnValue); });
+
+        FakeObject::GProcessEvent = nullptr;
+
+        CHECK_EQ(Result.NumCalls, 2);
+        CHECK_EQ(Result.NumNativeCalls, 0);
+        CHECK_EQ(GScriptCalls, std::vector<FakeObject*>{ First, Second });
+        CHECK_EQ(Returns, std::vector<int>{ 1, 1 });
+    }
+
+    TEST_CASE("out strings get a fresh parameter block for every call") {
+        FakeObjectWorld World{};
+        FakeObject* const First = World.Add("Object_0", World.ClassClass);
+        FakeObject* const Second = World.Add("Object_1", World.ClassClass);
+        FakeShout Shout{ World };
+
+        FakeObject* const Objects[] = { First, Second, First };
+        int NumInits = 0;
+        std::vector<std::wstring> Results{};
+
+        ::LESDK::FInvokeBatchResult const Result = ::LESDK::InvokeBatch(&Shout.Function, std::span<FakeObject* const>{ Objects },
+            [&](void* const Parms) {
+                ++NumInits;
+                auto* const Typed = static_cast<ShoutParms*>(Parms);
+                CHECK_EQ(Typed->Tone.Length(), 0);
+                Typed->Text = L"hello";
+                Typed->Tone = L"very ";
+            },
+            [&](FakeObject*, void* const Parms) {
+                auto* const Typed = static_cast<ShoutParms*>(Parms);
+                Results.emplace_back(Typed->ReturnValue.Chars());
+                Results.emplace_back(Typed->Tone.Chars());
+            });
+
+        CHECK_FALSE(Result.bRefused);
+        CHECK_EQ(Result.NumCalls, 3);
+        CHECK_EQ(NumInits, 3);
+        std::vector<std::wstring> const Expected{ L"hello!", L"very loud", L"hello!", L"very loud", L"hello!", L"very loud" };
+        CHECK_EQ(Results, Expected);
+    }
+
+    TEST_CASE("functions with other parameters that own memory are refused") {
+        FakeObjectWorld World{};
+        FakeObject* const Object = World.Add("Object_0", World.ClassClass);
+        FakeDivide Divide{};
+        Divide.Function.Func = reinterpret_cast<void*>(&ExecDivide);
+        Divide.Remainder.PropertyFlags |= ::LESDK::k_propNeedCtorLink;
+
+        GNumCalls = 0;
+        int NumInits = 0;
+        FakeObject* const Objects[] = { Object };
+        ::LESDK::FInvokeBatchResult const Result = ::LESDK::InvokeBatch(&Divide.Function, std::span<FakeObject* const>{ Objects },
+            [&](void*) { ++NumInits; });
+
+        CHECK(Result.bRefused);
+        CHECK_EQ(Result.NumCalls, 0);
+        CHECK_EQ(NumInits, 0);
+        CHECK_EQ(GNumCalls, 0);
+    }
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstddef>
+
+#include "doctest.h"
+#include "./Utilities.hpp"
+#include "LESDK/Common/NativeCall.hpp"
+
+
+namespace NativeCallTests {
+
+    struct FakeProperty final {
+        QWORD           PropertyFlags{ 0 };
+        INT             Offset{ 0 };
+        FakeProperty*   PropertyLinkNext{ nullptr };
+        INT             ElementSize{ 4 };
+        INT             ArrayDim{ 1 };
+        FakeObject*     Class{ nullptr };
+        DWORD           BitMask{ 0 };
+    };
+
+    struct FakeFunction final {
+        DWORD           FunctionFlags{ ::LESDK::k_funcNative };
+        short           iNative{ 0 };
+        BYTE            NumParms{ 0 };
+        unsigned short  ParmsSize{ 0 };
+        short           ReturnValueOffset{ -1 };
+        void*           Func{ nullptr };
+        TArray<BYTE>    Script{};
+        FakeProperty*   PropertyLink{ nullptr };
+    };
+
+    struct DivideParms final {
+        int             A;
+        int             B;
+        int             Remainder;
+        int             ReturnValue;
+    };
+
+    // Stand-in for Function Core.Object.Divide(int A, int B, out int Remainder).
+    struct FakeDivide final {
+        FakeProperty    A{ ::LESDK::k_propParm, 0x0 };
+        FakeProperty    B{ ::LESDK::k_propParm, 0x4 };
+        FakeProperty    Remainder{ ::LESDK::k_propParm | ::LESDK::k_propOutParm, 0x8 };
+        FakeProperty    ReturnValue{ ::LESDK::k_propParm | ::LESDK::k_propOutParm | 0x400, 0xC };
+        FakeFunction    Function{};
+
+        FakeDivide() {
+            A.PropertyLinkNext = &B;
+            B.PropertyLinkNext = &Remainder;
+            Remainder.PropertyLinkNext = &ReturnValue;
+            Function.PropertyLink = &A;
+            Function.NumParms = 4;
+            Function.ParmsSize = sizeof(DivideParms);
+            Function.ReturnValueOffset = offsetof(DivideParms, ReturnValue);
+            Function.Script.Add(0x00);
+            Function.Script.Add(0x16);
+        }
+    };
+
+    static FFrame const* GLastFrame = nullptr;
+    static UObject* GLastContext = nullptr;
+    static int GNumCalls = 0;
+
+    static void ExecDivide(UObject* const Context, FFrame* const Stack, void* const Result) {
+        ++GNumCalls;
+        GLastFrame = Stack;
+        GLastContext = Context;
+
+        auto* const Parms = reinterpret_cast<DivideParms*>(Stack->Locals);
+        *static_cast<int*>(Result) = Parms->A / Parms->B;
+
+        // Out parameters are written through their records, like the engine's P_GET_INT_REF.
+        for (FFrame::FOutParmRec* Out = Stack->OutParms; Out != nullptr; Out = Out->NextOutParm) {
+            if (reinterpret_cast<FakeProperty*>(Out->Property)->Offset == offsetof(DivideParms, Remainder))
+                *reinterpret_cast<int*>(Out->PropAddr) = Parms->A % Parms->B;
+        }
+    }
+
+}
+
+
+TEST_SUITE("NativeCall") {
+    using namespace NativeCallTests;
+
+    TEST_CASE("natives are called through a frame over the parameter block") {
+        FakeObjectWorld World{};
+        FakeObject* const Object = World.Add("Object_0", World.ClassClass);
+        FakeDivide Divide{};
+        Divide.Function.Func = reinterpret_cast<void*>(&ExecDivide);
+
+        GNumCalls = 0;
+        DivideParms Parms{ 17, 5, 0, 0 };
+        REQUIRE(::LESDK::CallNativeDirect(Object, &Divide.Function, &Parms));
+
+        CHECK_EQ(GNumCalls, 1);
+        CHECK_EQ(Parms.ReturnValue, 3);
+        CHECK_EQ(Parms.Remainder, 2);
+        CHECK_EQ(GLastContext, reinterpret_cast<UObject*>(Object));
+    }
+
+    TEST_CASE("the frame mirrors what ProcessEvent would build") {
+        FakeObjectWorld World{};
+        FakeObject* const Object = World.Add("Object_0", World.ClassClass);
+        FakeDivide Divide{};
+
+        DivideParms Parms{ 9, 3, 0, 0 };
+        ::LESDK::FNativeFrame const Frame{ Object, &Divide.Function, &Parms };
+
+        CHECK_EQ(Frame.Node, reinterpret_cast<UStruct*>(&Divide.Function));
+        CHECK_EQ(Frame.Object, reinterpret_cast<UObject*>(Object));
+        CHECK_EQ(Frame.Code, Divide.Function.Script.GetData());
+        CHECK_EQ(Frame.Locals, reinterpret_cast<BYTE*>(&Parms));
+        CHECK_EQ(Frame.PreviousFrame, nullptr);
+        CHECK_NE(Frame.Vfptr, nullptr);
+
+        REQUIRE_NE(Frame.OutParms, nullptr);
+        CHECK_EQ(Frame.OutParms->Property, reinterpret_cast<UProperty*>(&Divide.Remainder));
+        CHECK_EQ(Frame.OutParms->PropAddr, reinterpret_cast<BYTE*>(&Parms.Remainder));
+        REQUIRE_NE(Frame.OutParms->NextOutParm, nullptr);
+        CHECK_EQ(Frame.OutParms->NextOutParm->Property, reinterpret_cast<UProperty*>(&Divide.ReturnValue));
+        CHECK_EQ(Frame.OutParms->NextOutParm->NextOutParm, nullptr);
+    }
+
+    TEST_CASE("unbound natives fall back to GNatives") {
+        FakeObjectWorld World{};
+        FakeObject* const Object = World.Add("Object_0", World.ClassClass);
+        FakeDivide Divide{};
+        Divide.Function.iNative = 2;
+
+        tNative* Natives[4]{ nullptr, nullptr, &ExecDivide, nullptr };
+        tNative** const PreviousNatives = GNatives;
+        GNatives = Natives;
+
+        DivideParms Parms{ 8, 2, 0, 0 };
+        CHECK(::LESDK::CallNativeDirect(Object, &Divide.Function, &Parms));
+        CHECK_EQ(Parms.ReturnValue, 4);
+
+        GNatives = PreviousNatives;
+    }
+
+    TEST_CASE("functions that are not natives are refused") {
+        FakeObjectWorld World{};
+        FakeObject* const Object = World.Add("Object_0", World.ClassClass);
+        FakeDivide Divide{};
+        Divide.Function.Func = reinterpret_cast<void*>(&ExecDivide);
+        Divide.Function.FunctionFlags = 0;
+
+        GNumCalls = 0;
+        DivideParms Parms{ 8, 2, 0, 0 };
+        CHECK_FALSE(::LESDK::CallNativeDirect(Object, &Divide.Function, &Parms));
+        CHECK_EQ(::LESDK::GetNativeThunk(&Divide.Function), nullptr);
+        CHECK_EQ(GNumCalls, 0);
+        CHECK_EQ(Parms.ReturnValue, 0);
+    }
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "doctest.h"
+#include "LESDK/Common/NativeProfiler.hpp"
+
+
+namespace NativeProfilerTests {
+
+    using FNativeProfiler = ::LESDK::FNativeProfiler;
+
+    static void ExecIntConst(UObject* const Context, FFrame* const Stack, void* const Result) {
+        (void)Context;
+        std::memcpy(Result, Stack->Code, sizeof(int));
+        Stack->Code += sizeof(int);
+    }
+
+    // A native taking one argument, which is evaluated through the table like the engine does.
+    static void ExecNegate(UObject* const Context, FFrame* const Stack, void* const Result) {
+        int Value = 0;
+        Stack->Step(Context, &Value);
+        *static_cast<int*>(Result) = -Value;
+    }
+
+    static int Run(tNative** const Natives, BYTE* const Code) {
+        FFrame Stack{};
+        Stack.Code = Code;
+        int Result = 0;
+        Natives[*Stack.Code++](nullptr, &Stack, &Result);
+        return Result;
+    }
+
+    static ::LESDK::FNativeSlotStats FindStats(std::vector<::LESDK::FNativeSlotStats> const& Stats, INT const Slot) {
+        for (auto const& Row : Stats) {
+            if (Row.Slot == Slot)
+                return Row;
+        }
+        return {};
+    }
+
+}
+
+
+TEST_SUITE("NativeProfiler") {
+    using namespace NativeProfilerTests;
+
+    TEST_CASE("entries are counted and timed through trampolines") {
+        std::vector<tNative*> Natives(::LESDK::k_numNativeSlots, nullptr);
+        Natives[0x1D] = &ExecIntConst;
+        Natives[0x70] = &ExecNegate;
+        tNative** const PreviousNatives = GNatives;
+        GNatives = Natives.data();
+
+        REQUIRE(FNativeProfiler::Install(Natives.data()));
+        CHECK(FNativeProfiler::IsInstalled());
+        CHECK_FALSE(FNativeProfiler::Install(Natives.data()));
+        FNativeProfiler::Reset();
+
+        CHECK_NE(Natives[0x1D], &ExecIntConst);
+        CHECK_EQ(Natives[0x1E], nullptr);
+
+        // -(5), i.e. a native call with an EX_IntConst argument.
+        BYTE Code[] = { 0x70, 0x1D, 5, 0, 0, 0 };
+        CHECK_EQ(Run(Natives.data(), Code), -5);
+        CHECK_EQ(Run(Natives.data(), Code), -5);
+
+        std::thread Worker{ [&] { CHECK_EQ(Run(Natives.data(), Code), -5); } };
+        Worker.join();
+
+        std::vector<::LESDK::FNativeSlotStats> const Stats = FNativeProfiler::Collect();
+        REQUIRE_EQ(Stats.size(), 2);
+
+        auto const Negate = FindStats(Stats, 0x70);
+        auto const IntConst = FindStats(Stats, 0x1D);
+        CHECK_EQ(Negate.NumCalls, 3);
+        CHECK_EQ(IntConst.NumCalls, 3);
+        CHECK_GE(Negate.TotalTime, IntConst.TotalTime);
+        CHECK_LE(Negate.SelfTime, Negate.TotalTime);
+        CHECK_EQ(IntConst.SelfTime, IntConst.TotalTime);
+
+        FNativeProfiler::Reset();
+        CHECK(FNativeProfiler::Collect().empty());
+
+        FNativeProfiler::Uninstall();
+        GNatives = PreviousNatives;
+
+        CHECK_FALSE(FNativeProfiler::IsInstalled());
+        CHECK_EQ(Natives[0x1D], &ExecIntConst);
+        CHECK_EQ(Natives[0x70], &ExecNegate);
+    }
+}
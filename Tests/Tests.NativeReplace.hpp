@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstddef>
+
+#include "doctest.h"
+#include "./Utilities.hpp"
+#include "./Tests.NativeCall.hpp"
+#include "LESDK/Common/NativeReplace.hpp"
+
+
+namespace NativeReplaceTests {
+
+    using namespace NativeCallTests;
+
+    using FakeNativeReplacements = ::LESDK::TNativeReplacements<FakeObject, FakeFunction>;
+
+    struct AddParms final {
+        int             A;
+        int             B;
+        int             ReturnValue;
+    };
+
+    // Stand-in for a script function "int Add(int A, int B)".
+    struct FakeAdd final {
+        FakeProperty    A{ ::LESDK::k_propParm, 0x0 };
+        FakeProperty    B{ ::LESDK::k_propParm, 0x4 };
+        FakeProperty    ReturnValue{ ::LESDK::k_propParm | ::LESDK::k_propOutParm | ::LESDK::k_propReturnParm, 0x8 };
+        FakeFunction    Function{};
+
+        FakeAdd() {
+            A.PropertyLinkNext = &B;
+            B.PropertyLinkNext = &ReturnValue;
+            Function.FunctionFlags = 0;
+            Function.PropertyLink = &A;
+            Function.NumParms = 3;
+            Function.ParmsSize = sizeof(AddParms);
+            Function.ReturnValueOffset = offsetof(AddParms, ReturnValue);
+            Function.Script.Add(0x04);
+            Function.Script.Add(0x53);
+        }
+    };
+
+    static FakeObject* GLastAddContext = nullptr;
+
+    static int AddImpl(FakeObject* const Context, int const A, int const B) {
+        GLastAddContext = Context;
+        return A + B;
+    }
+
+    static int OtherAddImpl(FakeObject* const Context, int const A, int const B) {
+        (void)Context;
+        return A + B;
+    }
+
+    // EX_IntConst, reads a 4-byte literal from the code stream.
+    static void ExecIntConst(UObject* const Context, FFrame* const Stack, void* const Result) {
+        (void)Context;
+        std::memcpy(Result, Stack->Code, sizeof(int));
+        Stack->Code += sizeof(int);
+    }
+
+}
+
+
+TEST_SUITE("NativeReplace") {
+    using namespace NativeReplaceTests;
+
+    TEST_CASE("replacing makes a function native and restoring puts it back") {
+        FakeAdd Add{};
+        void* const OriginalFunc = reinterpret_cast<void*>(&ExecDivide);
+        Add.Function.Func = OriginalFunc;
+
+        FakeNativeReplacements Replacements{};
+        REQUIRE(Replacements.Replace<&AddImpl>(&Add.Function));
+        CHECK(Replacements.IsReplaced(&Add.Function));
+        CHECK_EQ(Replacements.Num(), 1);
+        CHECK_NE(Add.Function.FunctionFlags & ::LESDK::k_funcNative, 0);
+        CHECK_EQ(Add.Function.Func, reinterpret_cast<void*>(&::LESDK::TNativeThunk<&AddImpl, FakeFunction>::Exec));
+        CHECK_FALSE(Replacements.Replace(&Add.Function, &ExecDivide));
+
+        CHECK(Replacements.Restore(&Add.Function));
+        CHECK_FALSE(Replacements.Restore(&Add.Function));
+        CHECK_EQ(Add.Function.FunctionFlags, 0);
+        CHECK_EQ(Add.Function.Func, OriginalFunc);
+        CHECK_EQ(::LESDK::TNativeThunk<&AddImpl, FakeFunction>::s_function.load(), nullptr);
+    }
+
+    TEST_CASE("functions that can't be replaced are refused") {
+        FakeAdd Add{};
+        FakeAdd Other{};
+        FakeDivide Divide{};
+        FakeNativeReplacements Replacements{};
+
+        CHECK_FALSE(Replacements.Replace<&AddImpl>(static_cast<FakeFunction*>(nullptr)));
+        CHECK_FALSE(Replacements.Replace<&AddImpl>(&Divide.Function));
+
+        Add.Function.iNative = 0x70;
+        CHECK_FALSE(Replacements.Replace<&AddImpl>(&Add.Function));
+        Add.Function.iNative = 0;
+
+        // A typed implementation is bound to one function at a time.
+        REQUIRE(Replacements.Replace<&AddImpl>(&Add.Function));
+        CHECK_FALSE(Replacements.Replace<&AddImpl>(&Other.Function));
+        CHECK(Replacements.Replace<&OtherAddImpl>(&Other.Function));
+        CHECK_EQ(Replacements.Num(), 2);
+    }
+
+    TEST_CASE("replacements are called with the parameters of their own frame") {
+        FakeObjectWorld World{};
+        FakeObject* const Object = World.Add("Object_0", World.ClassClass);
+        FakeAdd Add{};
+        FakeNativeReplacements Replacements{};
+        REQUIRE(Replacements.Replace<&AddImpl>(&Add.Function));
+
+        AddParms Parms{ 40, 2, 0 };
+        REQUIRE(::LESDK::CallNativeDirect(Object, &Add.Function, &Parms));
+        CHECK_EQ(Parms.ReturnValue, 42);
+        CHECK_EQ(GLastAddContext, Object);
+    }
+
+    TEST_CASE("replacements evaluate the arguments of script callers") {
+        FakeObjectWorld World{};
+        FakeObject* const Object = World.Add("Object_0", World.ClassClass);
+        FakeAdd Add{};
+        FakeNativeReplacements Replacements{};
+        REQUIRE(Replacements.Replace<&AddImpl>(&Add.Function));
+
+        tNative* Natives[256]{};
+        Natives[0x1D] = &ExecIntConst;
+        tNative** const PreviousNatives = GNatives;
+        GNatives = Natives;
+
+        // Add(7, 5), as compiled into the caller: two EX_IntConst arguments and EX_EndFunctionParms.
+        BYTE Code[] = { 0x1D, 7, 0, 0, 0, 0x1D, 5, 0, 0, 0, 0x16, 0x04 };
+        FFrame Caller{};
+        Caller.Object = reinterpret_cast<UObject*>(Object);
+        Caller.Code = Code;
+
+        int Result = 0;
+        auto* const Thunk = reinterpret_cast<tNative*>(Add.Function.Func);
+        Thunk(reinterpret_cast<UObject*>(Object), &Caller, &Result);
+        GNatives = PreviousNatives;
+
+        CHECK_EQ(Result, 12);
+        CHECK_EQ(Caller.Code, Code + 11);
+    }
+
+    TEST_CASE("destroying the registry restores everything") {
+        FakeAdd Add{};
+        {
+            FakeNativeReplacements Replacements{};
+            REQUIRE(Replacements.Replace(&Add.Function, &ExecDivide));
+            CHECK_EQ(Add.Function.Func, reinterpret_cast<void*>(&ExecDivide));
+        }
+        CHECK_EQ(Add.Function.FunctionFlags, 0);
+        CHECK_EQ(Add.Function.Func, nullptr);
+    }
+}
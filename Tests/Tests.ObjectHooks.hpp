@@ -0,0 +1,227 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "SPI.h"
+#include "./Utilities.hpp"
+#include "./Tests.ClassHierarchy.hpp"
+#include "./Tests.ObjectIndex.hpp"
+#include "./Tests.ObjectIterator.hpp"
+#include "LESDK/ObjectHooks.hpp"
+
+
+using FakeObjectTracker = ::LESDK::TObjectTracker<FakeObject, FakeObject>;
+using FakeObjectHooks = ::LESDK::TObjectHooks<FakeObject, FakeObject>;
+
+
+namespace ObjectHooksTests {
+
+    // Records hooks instead of patching code, the "original" of every hook is its target.
+    class MockProxyInterface final : public ISharedProxyInterface {
+    public:
+
+        struct FHook {
+            std::string     Name;
+            void*           Target;
+            void*           Detour;
+        };
+
+        std::vector<FHook> Hooks{};
+
+        SPIReturn GetVersion(unsigned long* const outVersionPtr) override { *outVersionPtr = SPI_VERSION_LATEST; return SPIReturn::Success; }
+        SPIReturn GetBuildMode(bool* const outIsRelease) override { *outIsRelease = false; return SPIReturn::Success; }
+        SPIReturn GetHostGame(SPIGameVersion* const outGameVersion) override { *outGameVersion = SPIGameVersion::LE1; return SPIReturn::Success; }
+        SPIReturn FindPattern(void** const outOffsetPtr, char* const combinedPattern) override { (void)combinedPattern; *outOffsetPtr = nullptr; return SPIReturn::FailureGeneric; }
+
+        SPIReturn InstallHook(char const* const name, void* const target, void* const detour, void** const original) override {
+            Hooks.push_back(FHook{ name, target, detour });
+            *original = target;
+            return SPIReturn::Success;
+        }
+
+        SPIReturn UninstallHook(char const* const name) override {
+            for (auto It = Hooks.begin(); It != Hooks.end(); ++It) {
+                if (It->Name == name) {
+                    Hooks.erase(It);
+                    return SPIReturn::Success;
+                }
+            }
+            return SPIReturn::FailureGeneric;
+        }
+
+        void* FindDetour(char const* const name) const {
+            for (FHook const& Hook : Hooks) {
+                if (Hook.Name == name)
+                    return Hook.Detour;
+            }
+            return nullptr;
+        }
+    };
+
+    // Stand-ins for the engine routines, allocating into and removing from the current world.
+    static FakeObjectWorld* GHookWorld = nullptr;
+    static char const* GNextName = nullptr;
+
+    static FakeObject* FakeStaticAllocateObject(FakeObject* const Class, FakeObject* const InOuter, SFXName const InName, QWORD const SetFlags,
+        FakeObject* const Template, void* const Error, FakeObject* const Ptr, FakeObject* const SubobjectRoot, void* const InstanceGraph)
+    {
+        (void)InName; (void)SetFlags; (void)Template; (void)Error; (void)Ptr; (void)SubobjectRoot; (void)InstanceGraph;
+        return GHookWorld->Add(GNextName, Class, InOuter);
+    }
+
+    static void FakeDestroyObject(FakeObject* const Object) {
+        GHookWorld->Remove(Object);
+    }
+
+}
+
+
+SCENARIO("ObjectHooks - keeping lookups current from engine events") {
+    using namespace ObjectHooksTests;
+
+    GIVEN("an index and buckets over a world of objects") {
+        FakeObjectWorld World{};
+        FakeObjectIndex Index{};
+        FakeObjectBuckets Buckets{};
+        FakeObjectTracker Tracker{ Index, Buckets };
+
+        FakeObject* const ObjectClass = World.AddClass("Object", nullptr);
+        FakeObject* const ActorClass = World.AddClass("Actor", ObjectClass);
+        FakeObject* const EnginePackage = World.Add("Engine", World.PackageClass);
+        FakeObject* const Actor = World.Add("Actor_1", ActorClass, EnginePackage);
+
+        Index.Build(World.Objects);
+        Tracker.Start(World.Objects);
+
+        WHEN("objects are allocated and destroyed") {
+            FakeObject* const Spawned = World.Add("Actor_2", ActorClass, EnginePackage);
+            Tracker.OnObjectAllocated(Spawned);
+            Tracker.OnObjectDestroyed(Actor);
+            World.Remove(Actor);
+
+            THEN("lookups see the changes without a rebuild") {
+                CHECK_EQ(Index.Find(World.Objects, L"Actor Engine.Actor_2"), Spawned);
+                CHECK_EQ(Index.Find(World.Objects, L"Actor Engine.Actor_1"), nullptr);
+                CHECK_EQ(Buckets.CountExact(ActorClass), 1);
+                CHECK_EQ(CollectFakeObjects(Buckets, World, ActorClass), SortedFakeObjects({ Spawned }));
+                CHECK_EQ(Tracker.GetNumAllocated(), 1);
+                CHECK_EQ(Tracker.GetNumDestroyed(), 1);
+            }
+        }
+
+        WHEN("a destroyed object's slot is reused without a destruction event") {
+            World.Remove(Actor);
+            FakeObject* const Reused = World.Reuse(Actor, "Actor_3", ActorClass, EnginePackage);
+            Tracker.OnObjectAllocated(Reused);
+
+            THEN("the new object replaces the old one") {
+                CHECK_EQ(Index.Find(World.Objects, L"Actor Engine.Actor_3"), Reused);
+                CHECK_EQ(Index.Find(World.Objects, L"Actor Engine.Actor_1"), nullptr);
+                CHECK_EQ(CollectFakeObjects(Buckets, World, ActorClass), SortedFakeObjects({ Reused }));
+            }
+        }
+
+        WHEN("a destruction event arrives for an object whose slot was already reused") {
+            World.Remove(Actor);
+            FakeObject* const Reused = World.Reuse(Actor, "Actor_3", ActorClass, EnginePackage);
+            Tracker.OnObjectAllocated(Reused);
+            Tracker.OnObjectDestroyed(Actor);
+
+            THEN("the new object is kept") {
+                CHECK_EQ(Index.Find(World.Objects, L"Actor Engine.Actor_3"), Reused);
+                CHECK_EQ(Buckets.CountExact(ActorClass), 1);
+            }
+        }
+
+        WHEN("hooks are installed through a proxy interface") {
+            MockProxyInterface Proxy{};
+            ::LESDK::Initializer Init{ &Proxy, "Tests", nullptr };
+            GHookWorld = &World;
+
+            REQUIRE(FakeObjectHooks::Install(Init, Tracker, World.Objects,
+                ::LESDK::Address::FromAbsolute(reinterpret_cast<void*>(&FakeStaticAllocateObject)),
+                ::LESDK::Address::FromAbsolute(reinterpret_cast<void*>(&FakeDestroyObject))));
+            REQUIRE_EQ(Proxy.Hooks.size(), 2);
+            CHECK(FakeObjectHooks::IsInstalled());
+            CHECK(FakeObjectHooks::HasDestroyHook());
+
+            auto const Allocate = reinterpret_cast<FakeObjectHooks::StaticAllocateObjectType>(Proxy.FindDetour("Tests_StaticAllocateObject"));
+            auto const Destroy = reinterpret_cast<FakeObjectHooks::DestroyObjectType>(Proxy.FindDetour("Tests_DestroyObject"));
+            REQUIRE(Allocate != nullptr);
+            REQUIRE(Destroy != nullptr);
+
+            GNextName = "Actor_4";
+            FakeObject* const Spawned = Allocate(ActorClass, EnginePackage, SFXName{}, 0, nullptr, nullptr, nullptr, nullptr, nullptr);
+            Destroy(Actor);
+
+            THEN("engine calls are forwarded and reported") {
+                CHECK_EQ(World.Objects(static_cast<UINT>(Spawned->ObjectInternalInteger)), Spawned);
+                CHECK_EQ(World.Objects(static_cast<UINT>(Actor->ObjectInternalInteger)), nullptr);
+                CHECK_EQ(Index.Find(World.Objects, L"Actor Engine.Actor_4"), Spawned);
+                CHECK_EQ(CollectFakeObjects(Buckets, World, ActorClass), SortedFakeObjects({ Spawned }));
+            }
+
+            FakeObjectHooks::Uninstall(Init);
+            CHECK_FALSE(FakeObjectHooks::IsInstalled());
+            CHECK_FALSE(FakeObjectHooks::HasDestroyHook());
+            CHECK(Proxy.Hooks.empty());
+            GHookWorld = nullptr;
+        }
+
+        WHEN("hooks are installed without a destruction routine") {
+            MockProxyInterface Proxy{};
+            ::LESDK::Initializer Init{ &Proxy, "Tests", nullptr };
+
+            REQUIRE(FakeObjectHooks::Install(Init, Tracker, World.Objects,
+                ::LESDK::Address::FromAbsolute(reinterpret_cast<void*>(&FakeStaticAllocateObject))));
+
+            THEN("only allocation is hooked, and that is reported") {
+                CHECK_EQ(Proxy.Hooks.size(), 1);
+                CHECK_FALSE(FakeObjectHooks::HasDestroyHook());
+            }
+
+            FakeObjectHooks::Uninstall(Init);
+            CHECK(Proxy.Hooks.empty());
+        }
+    }
+}
+
+
+SCENARIO("ObjectHooks - keeping the class hierarchy current") {
+    GIVEN("a tracker feeding a class hierarchy") {
+        FakeObjectWorld World{};
+        FakeObjectIndex Index{};
+        FakeObjectBuckets Buckets{};
+        ::LESDK::FObjectSerials Serials{};
+        FakeClassHierarchy Hierarchy{};
+        FakeObjectTracker Tracker{ Index, Buckets, Serials, Hierarchy };
+
+        FakeObject* const ObjectClass = World.AddClass("Object", nullptr);
+        FakeObject* const ActorClass = World.AddClass("Actor", ObjectClass);
+        FakeObject* const PawnClass = World.AddClass("Pawn", ActorClass);
+        FakeObject* const PlayerClass = World.AddClass("Player", PawnClass);
+        Tracker.Start(World.Objects);
+        REQUIRE(Hierarchy.IsChildOf(PlayerClass, ActorClass));
+
+        WHEN("a class up the chain is destroyed and another one takes its place") {
+            PawnClass->SuperField = ObjectClass;
+            Tracker.OnObjectDestroyed(PawnClass);
+
+            THEN("records built before are checked again") {
+                CHECK_FALSE(Hierarchy.IsChildOf(PlayerClass, ActorClass));
+                CHECK_EQ(Hierarchy.GetDepth(PlayerClass), 2);
+            }
+        }
+
+        WHEN("an object which is not a class is allocated") {
+            PawnClass->SuperField = ObjectClass;
+            Tracker.OnObjectAllocated(World.Add("Pawn_1", PawnClass));
+
+            THEN("records are left alone") {
+                CHECK(Hierarchy.IsChildOf(PlayerClass, ActorClass));
+            }
+        }
+    }
+}
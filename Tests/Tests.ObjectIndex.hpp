@@ -0,0 +1,230 @@
+#pragma once
+
+#include "doctest.h"
+#include "./Utilities.hpp"
+#include "LESDK/Common/ObjectIndex.hpp"
+
+
+using FakeObjectIndex = ::LESDK::TObjectIndex<FakeObject, FakeObject>;
+
+
+TEST_SUITE("ObjectIndex") {
+    TEST_CASE("object path parsing") {
+        ::LESDK::FObjectPath Path{};
+
+        REQUIRE(Path.Parse(L"Function Engine.Actor.Tick"));
+        CHECK_EQ(std::wstring_view(Path.ClassName.Text, Path.ClassName.Length), L"Function");
+        REQUIRE_EQ(Path.NumSegments, 3);
+        CHECK_EQ(std::wstring_view(Path.Segments[0].Text, Path.Segments[0].Length), L"Engine");
+        CHECK_EQ(std::wstring_view(Path.Segments[1].Text, Path.Segments[1].Length), L"Actor");
+        CHECK_EQ(std::wstring_view(Path.Segments[2].Text, Path.Segments[2].Length), L"Tick");
+
+        ::LESDK::FObjectPath Folded{};
+        REQUIRE(Folded.Parse(L"FUNCTION engine.actor.TICK"));
+        CHECK_EQ(Folded.ClassHash, Path.ClassHash);
+        CHECK_EQ(Folded.PathHash, Path.PathHash);
+
+        CHECK_FALSE(Path.Parse(nullptr));
+        CHECK_FALSE(Path.Parse(L"NoClassName"));
+        CHECK_FALSE(Path.Parse(L" Core.Object"));
+        CHECK_FALSE(Path.Parse(L"Class "));
+        CHECK_FALSE(Path.Parse(L"Class Core..Object"));
+        CHECK_FALSE(Path.Parse(L"Class Core.Object."));
+    }
+
+    TEST_CASE("name text matching respects instance numbers") {
+        FakeNamePool Names{};
+
+        SFXName const Plain = Names.Make("SeqVar_Object");
+        SFXName const Instanced = Names.Make("SeqVar_Object", 4);
+
+        CHECK(::LESDK::NameMatchesText(Plain, L"seqvar_object", 13));
+        CHECK_FALSE(::LESDK::NameMatchesText(Plain, L"SeqVar_Object_3", 15));
+        CHECK(::LESDK::NameMatchesText(Instanced, L"SeqVar_Object_3", 15));
+        CHECK_FALSE(::LESDK::NameMatchesText(Instanced, L"SeqVar_Object_03", 16));
+        CHECK_FALSE(::LESDK::NameMatchesText(Instanced, L"SeqVar_Object", 13));
+
+        CHECK_EQ(::LESDK::HashNameInstanced(::LESDK::k_nameHashSeed, Instanced),
+            [] { ::LESDK::FObjectPath P{}; (void)P.Parse(L"X seqvar_object_3"); return P.PathHash; }());
+    }
+
+    TEST_CASE("lookups by full name") {
+        FakeObjectWorld World{};
+        FakeObjectIndex Index{};
+
+        FakeObject* const ObjectClass = World.AddClass("Object", nullptr);
+        FakeObject* const ActorClass = World.AddClass("Actor", ObjectClass);
+        FakeObject* const FunctionClass = World.AddClass("Function", ObjectClass);
+        FakeObject* const EnginePackage = World.Add("Engine", World.PackageClass);
+        FakeObject* const EngineActor = World.AddClass("Actor", ObjectClass, EnginePackage);
+        FakeObject* const Tick = World.Add("Tick", FunctionClass, EngineActor);
+        FakeObject* const Instanced = World.Add("Actor", ActorClass, EnginePackage, 8);
+
+        CHECK_FALSE(Index.IsBuilt());
+        CHECK_EQ(Index.Find(World.Objects, L"Function Engine.Actor.Tick"), Tick);
+        CHECK(Index.IsBuilt());
+        CHECK_EQ(Index.Num(), static_cast<INT>(World.Objects.Count()));
+
+        CHECK_EQ(Index.Find(World.Objects, L"function ENGINE.actor.tick"), Tick);
+        CHECK_EQ(Index.Find(World.Objects, L"Class Core.Actor"), ActorClass);
+        CHECK_EQ(Index.Find(World.Objects, L"Class Engine.Actor"), EngineActor);
+        CHECK_EQ(Index.Find(World.Objects, L"Actor Engine.Actor_7"), Instanced);
+        CHECK_EQ(Index.Find(World.Objects, L"Class Core.Class"), World.ClassClass);
+        CHECK_EQ(Index.Find(World.Objects, L"Package Core"), World.CorePackage);
+
+        CHECK_EQ(Index.Find(World.Objects, L"Function Engine.Actor.Tick", FunctionClass), Tick);
+        CHECK_EQ(Index.Find(World.Objects, L"Function Engine.Actor.Tick", ObjectClass), Tick);
+        CHECK_EQ(Index.Find(World.Objects, L"Function Engine.Actor.Tick", ActorClass), nullptr);
+
+        CHECK_EQ(Index.Find(World.Objects, L"Class Engine.Actor.Tick"), nullptr);
+        CHECK_EQ(Index.Find(World.Objects, L"Function Actor.Tick"), nullptr);
+        CHECK_EQ(Index.Find(World.Objects, L"Function Core.Engine.Actor.Tick"), nullptr);
+        CHECK_EQ(Index.Find(World.Objects, L"Actor Engine.Actor_8"), nullptr);
+        CHECK_EQ(Index.Find(World.Objects, L"Actor Engine.Actor"), nullptr);
+    }
+
+    TEST_CASE("lookups stay correct as the object table changes") {
+        FakeObjectWorld World{};
+        FakeObjectIndex Index{};
+
+        FakeObject* const ObjectClass = World.AddClass("Object", nullptr);
+        FakeObject* const Package = World.Add("BIOA_NOR", World.PackageClass);
+        FakeObject* const First = World.Add("SeqVar_Object", ObjectClass, Package, 1);
+
+        Index.Build(World.Objects);
+        INT const BuiltCount = Index.Num();
+
+        WHEN("an object is created after the index was built") {
+            FakeObject* const Second = World.Add("SeqVar_Object", ObjectClass, Package, 2);
+
+            THEN("it is found and added to the index") {
+                CHECK_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_1"), Second);
+                CHECK_EQ(Index.Num(), BuiltCount + 1);
+                CHECK_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_1"), Second);
+                CHECK_EQ(Index.Num(), BuiltCount + 1);
+            }
+        }
+
+        WHEN("a path was missed before objects are created") {
+            REQUIRE_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_1"), nullptr);
+            REQUIRE_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_1"), nullptr);
+            FakeObject* const Second = World.Add("SeqVar_Object", ObjectClass, Package, 2);
+
+            THEN("objects the table grew by are found") {
+                CHECK_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_1"), Second);
+            }
+        }
+
+        WHEN("a path was missed before an object reuses a freed slot") {
+            FakeObject* const Other = World.Add("SeqVar_Other", ObjectClass, Package);
+            World.Remove(Other);
+            REQUIRE_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_1"), nullptr);
+            FakeObject* const Reused = World.Reuse(Other, "SeqVar_Object", ObjectClass, Package);
+            Reused->Name = World.Names.Make("SeqVar_Object", 2);
+
+            THEN("the whole table is scanned again and it is found") {
+                CHECK_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_1"), Reused);
+            }
+        }
+
+        WHEN("a path was missed while allocations are tracked") {
+            Index.SetTracked(true);
+            FakeObject* const Other = World.Add("SeqVar_Other", ObjectClass, Package);
+            World.Remove(Other);
+            REQUIRE_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_1"), nullptr);
+            FakeObject* const Reused = World.Reuse(Other, "SeqVar_Object", ObjectClass, Package);
+            Reused->Name = World.Names.Make("SeqVar_Object", 2);
+
+            THEN("the miss is remembered until the allocation is reported") {
+                CHECK_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_1"), nullptr);
+                Index.Add(Reused, Reused->ObjectInternalInteger);
+                CHECK_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_1"), Reused);
+            }
+            THEN("objects the table grew by are still found") {
+                FakeObject* const Grown = World.Add("SeqVar_Object", ObjectClass, Package, 3);
+                CHECK_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_2"), Grown);
+            }
+            THEN("stopping tracking forgets the miss") {
+                Index.SetTracked(false);
+                CHECK_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_1"), Reused);
+            }
+        }
+
+        WHEN("an indexed object is removed from the table") {
+            World.Remove(First);
+
+            THEN("it is no longer returned") {
+                CHECK_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_0"), nullptr);
+            }
+        }
+
+        WHEN("an indexed object is renamed in place") {
+            First->Name = World.Names.Make("SeqVar_Named");
+
+            THEN("only its new name finds it") {
+                CHECK_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_0"), nullptr);
+                CHECK_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Named"), First);
+            }
+        }
+
+        WHEN("the index is reset") {
+            Index.Reset();
+
+            THEN("the next lookup rebuilds it") {
+                CHECK_FALSE(Index.IsBuilt());
+                CHECK_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_0"), First);
+                CHECK(Index.IsBuilt());
+                CHECK_EQ(Index.Num(), BuiltCount);
+            }
+        }
+    }
+
+    TEST_CASE("path names resolve through the name table") {
+        FakeObjectWorld World{ true };
+
+        FakeObject* const ObjectClass = World.AddClass("Object", nullptr);
+        FakeObject* const Package = World.Add("BIOA_NOR", World.PackageClass);
+        FakeObject* const Split = World.Add("SeqVar_Object", ObjectClass, Package, 4);
+        FakeObject* const Unsplit = World.Add("Door_03", ObjectClass, Package);
+
+        ::LESDK::FObjectPath Path{};
+
+        REQUIRE(Path.Parse(L"class core.OBJECT"));
+        REQUIRE(Path.ResolveNames());
+        CHECK(Path.bNamesResolved);
+        CHECK(Path.ClassName.Matches(World.ClassClass->Name));
+        CHECK(Path.Segments[1].Matches(ObjectClass->Name));
+        CHECK(::LESDK::ObjectMatchesPathNames(ObjectClass, Path));
+        CHECK_FALSE(::LESDK::ObjectMatchesPathNames(World.ClassClass, Path));
+
+        REQUIRE(Path.Parse(L"Object BIOA_NOR.SeqVar_Object_3"));
+        REQUIRE(Path.ResolveNames());
+        CHECK(::LESDK::ObjectMatchesPathNames(Split, Path));
+
+        REQUIRE(Path.Parse(L"Object BIOA_NOR.Door_03"));
+        REQUIRE(Path.ResolveNames());
+        CHECK(::LESDK::ObjectMatchesPathNames(Unsplit, Path));
+
+        WHEN("a segment names nothing in the name table") {
+            REQUIRE(Path.Parse(L"Class Core.NoSuchClass"));
+
+            THEN("the path cannot match any object") {
+                CHECK_FALSE(Path.ResolveNames());
+                CHECK_FALSE(Path.bNamesResolved);
+            }
+        }
+
+        WHEN("classes are looked up through the index") {
+            FakeObjectIndex Index{};
+
+            THEN("resolved names find the same objects as text") {
+                CHECK_EQ(Index.Find(World.Objects, L"Class Core.Object"), ObjectClass);
+                CHECK_EQ(Index.Find(World.Objects, L"CLASS CORE.CLASS"), World.ClassClass);
+                CHECK_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.SeqVar_Object_3"), Split);
+                CHECK_EQ(Index.Find(World.Objects, L"Object BIOA_NOR.Door_03"), Unsplit);
+                CHECK_EQ(Index.Find(World.Objects, L"Class Core.NoSuchClass"), nullptr);
+                CHECK_EQ(Index.Find(World.Objects, L"Class BIOA_NOR.Object"), nullptr);
+            }
+        }
+    }
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+#include "doctest.h"
+#include "./Utilities.hpp"
+#include "LESDK/Common/ObjectIterator.hpp"
+
+
+using FakeObjectBuckets = ::LESDK::TObjectBuckets<FakeObject, FakeObject>;
+using FakeObjectIterator = ::LESDK::TObjectIterator<FakeObject, FakeObject, FakeObject>;
+
+static_assert(std::input_iterator<FakeObjectIterator::FRangeIterator>);
+static_assert(std::ranges::input_range<FakeObjectIterator>);
+
+
+static std::vector<FakeObject*> CollectFakeObjects(FakeObjectBuckets& Buckets, FakeObjectWorld& World, FakeObject* const Class) {
+    std::vector<FakeObject*> Result{};
+    for (FakeObject* const Object : FakeObjectIterator{ Buckets, World.Objects, Class })
+        Result.push_back(Object);
+    std::sort(Result.begin(), Result.end());
+    return Result;
+}
+
+static std::vector<FakeObject*> SortedFakeObjects(std::initializer_list<FakeObject*> const Objects) {
+    std::vector<FakeObject*> Result{ Objects };
+    std::sort(Result.begin(), Result.end());
+    return Result;
+}
+
+
+SCENARIO("ObjectIterator - iterating instances of a class") {
+    GIVEN("objects of a few related classes") {
+        FakeObjectWorld World{};
+        FakeObjectBuckets Buckets{};
+
+        FakeObject* const ObjectClass = World.AddClass("Object", nullptr);
+        FakeObject* const ActorClass = World.AddClass("Actor", ObjectClass);
+        FakeObject* const PawnClass = World.AddClass("Pawn", ActorClass);
+        FakeObject* const SequenceClass = World.AddClass("Sequence", ObjectClass);
+
+        FakeObject* const Actor = World.Add("Actor", ActorClass, nullptr, 1);
+        FakeObject* const FirstPawn = World.Add("Pawn", PawnClass, nullptr, 1);
+        FakeObject* const SecondPawn = World.Add("Pawn", PawnClass, nullptr, 2);
+        FakeObject* const Sequence = World.Add("Main_Sequence", SequenceClass);
+
+        THEN("only instances of the class and its subclasses are visited") {
+            CHECK_EQ(CollectFakeObjects(Buckets, World, PawnClass), SortedFakeObjects({ FirstPawn, SecondPawn }));
+            CHECK_EQ(CollectFakeObjects(Buckets, World, ActorClass), SortedFakeObjects({ Actor, FirstPawn, SecondPawn }));
+            CHECK_EQ(CollectFakeObjects(Buckets, World, SequenceClass), SortedFakeObjects({ Sequence }));
+            CHECK_EQ(Buckets.CountExact(PawnClass), 2);
+            CHECK_EQ(Buckets.CountExact(ActorClass), 1);
+        }
+
+        THEN("the explicit iterator interface works as well") {
+            int Count = 0;
+            for (FakeObjectIterator It{ Buckets, World.Objects, ActorClass }; It; ++It) {
+                CHECK(It->IsA(ActorClass));
+                ++Count;
+            }
+            CHECK_EQ(Count, 3);
+        }
+
+        WHEN("objects are destroyed and created between queries") {
+            REQUIRE_EQ(CollectFakeObjects(Buckets, World, PawnClass).size(), 2);
+
+            World.Remove(FirstPawn);
+            FakeObject* const ThirdPawn = World.Add("Pawn", PawnClass, nullptr, 3);
+
+            THEN("buckets are refreshed from the changed slots") {
+                CHECK_EQ(CollectFakeObjects(Buckets, World, PawnClass), SortedFakeObjects({ SecondPawn, ThirdPawn }));
+                CHECK_EQ(Buckets.CountExact(PawnClass), 2);
+            }
+        }
+
+        WHEN("a slot is reused without being reported") {
+            REQUIRE_EQ(CollectFakeObjects(Buckets, World, PawnClass).size(), 2);
+
+            World.Remove(FirstPawn);
+            FakeObject* const Reused = World.Reuse(FirstPawn, "Pawn", PawnClass);
+
+            THEN("validating the returned bucket picks up the new object") {
+                CHECK_EQ(CollectFakeObjects(Buckets, World, PawnClass), SortedFakeObjects({ SecondPawn, Reused }));
+                CHECK_EQ(Buckets.CountExact(PawnClass), 2);
+            }
+        }
+
+        WHEN("a slot of an unrelated class is reused without being reported") {
+            REQUIRE_EQ(CollectFakeObjects(Buckets, World, PawnClass).size(), 2);
+
+            World.Remove(Sequence);
+            FakeObject* const Reused = World.Reuse(Sequence, "Pawn", PawnClass);
+
+            THEN("the new object is found by comparing the table against its shadow") {
+                CHECK_EQ(CollectFakeObjects(Buckets, World, PawnClass), SortedFakeObjects({ FirstPawn, SecondPawn, Reused }));
+                CHECK_EQ(Buckets.CountExact(SequenceClass), 0);
+            }
+        }
+
+        WHEN("objects are destroyed during iteration") {
+            int Visited = 0;
+            FakeObjectIterator It{ Buckets, World.Objects, PawnClass };
+            REQUIRE_EQ(It.Num(), 2);
+            for (; It; ++It) {
+                ++Visited;
+                World.Remove(FirstPawn == *It ? SecondPawn : FirstPawn);
+            }
+
+            THEN("they are skipped") {
+                CHECK_EQ(Visited, 1);
+            }
+        }
+
+        WHEN("changes are reported instead of discovered") {
+            REQUIRE_EQ(CollectFakeObjects(Buckets, World, PawnClass).size(), 2);
+            Buckets.SetTracked(true);
+
+            FakeObject* const ThirdPawn = World.Add("Pawn", PawnClass, nullptr, 3);
+            CHECK_EQ(CollectFakeObjects(Buckets, World, PawnClass).size(), 2);
+
+            Buckets.Add(ThirdPawn, ThirdPawn->ObjectInternalInteger);
+            World.Remove(FirstPawn);
+            Buckets.Remove(FirstPawn->ObjectInternalInteger);
+
+            THEN("the table is not rescanned") {
+                CHECK_EQ(CollectFakeObjects(Buckets, World, PawnClass), SortedFakeObjects({ SecondPawn, ThirdPawn }));
+            }
+        }
+
+        WHEN("only allocations are reported") {
+            REQUIRE_EQ(CollectFakeObjects(Buckets, World, PawnClass).size(), 2);
+            Buckets.SetTracked(true);
+            World.Remove(FirstPawn);
+
+            THEN("destroyed objects are dropped from the buckets they are collected from") {
+                CHECK_EQ(Buckets.CountExact(PawnClass), 2);
+                CHECK_EQ(CollectFakeObjects(Buckets, World, PawnClass), SortedFakeObjects({ SecondPawn }));
+                CHECK_EQ(Buckets.CountExact(PawnClass), 1);
+            }
+        }
+
+        WHEN("a cursor that was advanced is used as a range") {
+            FakeObjectIterator It{ Buckets, World.Objects, ActorClass };
+            REQUIRE(It);
+            FakeObject* const First = *It;
+            ++It;
+
+            std::vector<FakeObject*> Rest{};
+            for (FakeObject* const Object : It)
+                Rest.push_back(Object);
+
+            THEN("the range starts where the cursor is") {
+                CHECK_EQ(Rest.size(), 2);
+                CHECK(std::ranges::find(Rest, First) == Rest.end());
+            }
+        }
+
+        WHEN("a new subclass appears") {
+            REQUIRE_EQ(CollectFakeObjects(Buckets, World, ActorClass).size(), 3);
+            FakeObject* const VolumeClass = World.AddClass("Volume", ActorClass);
+            FakeObject* const Volume = World.Add("Volume", VolumeClass);
+
+            THEN("its instances join the parent's results") {
+                CHECK_EQ(CollectFakeObjects(Buckets, World, ActorClass), SortedFakeObjects({ Actor, FirstPawn, SecondPawn, Volume }));
+            }
+        }
+    }
+}
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "doctest.h"
+#include "./Utilities.hpp"
+#include "./Tests.ObjectHooks.hpp"
+#include "LESDK/ProcessEventHooks.hpp"
+
+
+using FakeProcessEventDispatcher = ::LESDK::TProcessEventDispatcher<FakeObject, FakeObject>;
+
+
+namespace ProcessEventHooksTests {
+
+    static std::vector<std::string> GEvents{};
+
+    static void FakeProcessEvent(FakeObject* const Object, FakeObject* const Function, void* const Parms, void* const Result) {
+        (void)Object; (void)Parms; (void)Result;
+        GEvents.push_back(std::string{ "call " } + Function->Name.GetName());
+    }
+
+}
+
+
+SCENARIO("ProcessEventHooks - dispatching script events by function path") {
+    using namespace ProcessEventHooksTests;
+
+    GIVEN("a world with a few functions and a dispatcher") {
+        FakeObjectWorld World{};
+        FakeObject* const FunctionClass = World.AddClass("Function", nullptr);
+        FakeObject* const ObjectClass = World.AddClass("Object", nullptr);
+        FakeObject* const ActorClass = World.AddClass("Actor", ObjectClass);
+        FakeObject* const ObjectTick = World.Add("Tick", FunctionClass, ObjectClass);
+        FakeObject* const ActorTick = World.Add("Tick", FunctionClass, ActorClass);
+        FakeObject* const ActorTouch = World.Add("Touch", FunctionClass, ActorClass);
+        FakeObject* const Actor = World.Add("Actor_0", ActorClass);
+
+        FakeProcessEventDispatcher Dispatcher{};
+        GEvents.clear();
+
+        INT const PreHandle = Dispatcher.AddPreHandler(L"Function Core.Actor.Tick", [](FakeObject*, FakeObject*, void*) {
+            GEvents.push_back("pre");
+            return true;
+        });
+        INT const PostHandle = Dispatcher.AddPostHandler(L"Function Core.Actor.Tick", [](FakeObject*, FakeObject*, void*, void*) {
+            GEvents.push_back("post");
+        });
+        REQUIRE_NE(PreHandle, 0);
+        REQUIRE_NE(PostHandle, 0);
+        CHECK_EQ(Dispatcher.GetNumPending(), 1);
+
+        WHEN("events are dispatched") {
+            Dispatcher.Dispatch(Actor, ActorTouch, nullptr, nullptr, &FakeProcessEvent);
+            Dispatcher.Dispatch(Actor, ObjectTick, nullptr, nullptr, &FakeProcessEvent);
+            Dispatcher.Dispatch(Actor, ActorTick, nullptr, nullptr, &FakeProcessEvent);
+            Dispatcher.Dispatch(Actor, ActorTick, nullptr, nullptr, &FakeProcessEvent);
+
+            THEN("handlers run around the matching function only, which is resolved on first sight") {
+                std::vector<std::string> const Expected{
+                    "call Touch", "call Tick",
+                    "pre", "call Tick", "post",
+                    "pre", "call Tick", "post",
+                };
+                CHECK_EQ(GEvents, Expected);
+                CHECK(Dispatcher.IsHandled(ActorTick));
+                CHECK_FALSE(Dispatcher.IsHandled(ObjectTick));
+                CHECK_FALSE(Dispatcher.IsHandled(ActorTouch));
+                CHECK_EQ(Dispatcher.GetNumPending(), 0);
+            }
+        }
+
+        WHEN("a pre handler skips the event") {
+            Dispatcher.AddPreHandler(L"Function Core.Actor.Tick", [](FakeObject*, FakeObject*, void*) { return false; });
+            Dispatcher.Dispatch(Actor, ActorTick, nullptr, nullptr, &FakeProcessEvent);
+
+            THEN("all pre handlers run, but neither the original nor post handlers do") {
+                CHECK_EQ(GEvents, std::vector<std::string>{ "pre" });
+            }
+        }
+
+        WHEN("handlers are removed") {
+            Dispatcher.Dispatch(Actor, ActorTick, nullptr, nullptr, &FakeProcessEvent);
+            GEvents.clear();
+            CHECK(Dispatcher.Remove(PreHandle));
+            CHECK_FALSE(Dispatcher.Remove(PreHandle));
+            Dispatcher.Dispatch(Actor, ActorTick, nullptr, nullptr, &FakeProcessEvent);
+            CHECK(Dispatcher.Remove(PostHandle));
+            Dispatcher.Dispatch(Actor, ActorTick, nullptr, nullptr, &FakeProcessEvent);
+
+            THEN("the remaining handlers keep running") {
+                std::vector<std::string> const Expected{ "call Tick", "post", "call Tick" };
+                CHECK_EQ(GEvents, Expected);
+                CHECK_FALSE(Dispatcher.IsHandled(ActorTick));
+            }
+        }
+
+        WHEN("a handler unregisters itself while its event is dispatched") {
+            INT SelfHandle = 0;
+            INT NumRetiredInside = -1;
+            SelfHandle = Dispatcher.AddPostHandler(L"Function Core.Actor.Tick", [&](FakeObject*, FakeObject*, void*, void*) {
+                CHECK(Dispatcher.Remove(SelfHandle));
+                NumRetiredInside = Dispatcher.GetNumRetired();
+                GEvents.push_back("self");
+            });
+            Dispatcher.Dispatch(Actor, ActorTick, nullptr, nullptr, &FakeProcessEvent);
+            Dispatcher.Dispatch(Actor, ActorTick, nullptr, nullptr, &FakeProcessEvent);
+
+            THEN("the replaced snapshot lives until the dispatch is over, and is freed then") {
+                std::vector<std::string> const Expected{
+                    "pre", "call Tick", "post", "self",
+                    "pre", "call Tick", "post",
+                };
+                CHECK_EQ(GEvents, Expected);
+                CHECK_GE(NumRetiredInside, 1);
+                CHECK_EQ(Dispatcher.GetNumRetired(), 0);
+            }
+        }
+
+        WHEN("handlers are added and removed many times outside of dispatch") {
+            for (INT i = 0; i < 100; ++i)
+                Dispatcher.Remove(Dispatcher.AddPreHandler(L"Function Core.Actor.Touch", [](FakeObject*, FakeObject*, void*) { return true; }));
+
+            THEN("replaced snapshots are not kept") {
+                CHECK_EQ(Dispatcher.GetNumRetired(), 0);
+            }
+        }
+
+        WHEN("a path is registered after a function with the same name was dismissed") {
+            Dispatcher.Dispatch(Actor, ObjectTick, nullptr, nullptr, &FakeProcessEvent);
+            Dispatcher.AddPreHandler(L"Function Core.Object.Tick", [](FakeObject*, FakeObject*, void*) {
+                GEvents.push_back("object pre");
+                return true;
+            });
+            GEvents.clear();
+            Dispatcher.Dispatch(Actor, ObjectTick, nullptr, nullptr, &FakeProcessEvent);
+
+            THEN("the function is reconsidered") {
+                CHECK_EQ(Dispatcher.GetNumMisses(), 0);
+                CHECK_EQ(GEvents, std::vector<std::string>{ "object pre", "call Tick" });
+            }
+        }
+
+        WHEN("a path with another name is registered after a function was dismissed") {
+            Dispatcher.Dispatch(Actor, ObjectTick, nullptr, nullptr, &FakeProcessEvent);
+            REQUIRE_EQ(Dispatcher.GetNumMisses(), 1);
+            Dispatcher.AddPreHandler(L"Function Core.Actor.Touch", [](FakeObject*, FakeObject*, void*) { return true; });
+
+            THEN("the dismissed function stays dismissed") {
+                CHECK_EQ(Dispatcher.GetNumMisses(), 1);
+            }
+        }
+
+        WHEN("resolved functions are reset") {
+            Dispatcher.Dispatch(Actor, ActorTick, nullptr, nullptr, &FakeProcessEvent);
+            Dispatcher.ResetResolved();
+
+            THEN("paths are pending again") {
+                CHECK_FALSE(Dispatcher.IsHandled(ActorTick));
+                CHECK_EQ(Dispatcher.GetNumPending(), 1);
+            }
+        }
+
+        WHEN("a malformed path is registered") {
+            THEN("it is refused") {
+                CHECK_EQ(Dispatcher.AddPreHandler(L"Tick", [](FakeObject*, FakeObject*, void*) { return true; }), 0);
+            }
+        }
+
+        WHEN("the hook is installed through a proxy interface") {
+            ObjectHooksTests::MockProxyInterface Proxy{};
+            ::LESDK::Initializer Init{ &Proxy, "Tests", nullptr };
+
+            REQUIRE(FakeProcessEventDispatcher::Install(Init, Dispatcher,
+                ::LESDK::Address::FromAbsolute(reinterpret_cast<void*>(&FakeProcessEvent))));
+            CHECK(FakeProcessEventDispatcher::IsInstalled());
+            CHECK_FALSE(FakeProcessEventDispatcher::Install(Init, Dispatcher,
+                ::LESDK::Address::FromAbsolute(reinterpret_cast<void*>(&FakeProcessEvent))));
+
+            auto const Detour = reinterpret_cast<FakeProcessEventDispatcher::ProcessEventType>(Proxy.FindDetour("Tests_ProcessEvent"));
+            REQUIRE(Detour != nullptr);
+            Detour(Actor, ActorTick, nullptr, nullptr);
+
+            THEN("engine events go through the dispatcher") {
+                std::vector<std::string> const Expected{ "pre", "call Tick", "post" };
+                CHECK_EQ(GEvents, Expected);
+            }
+
+            FakeProcessEventDispatcher::Uninstall(Init);
+            CHECK_FALSE(FakeProcessEventDispatcher::IsInstalled());
+            CHECK(Proxy.Hooks.empty());
+        }
+    }
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "doctest.h"
+#include "./Utilities.hpp"
+#include "./Tests.ObjectHooks.hpp"
+#include "LESDK/ScriptSampler.hpp"
+
+
+namespace ScriptSamplerTests {
+
+    // Minimal UFunction look-alike, named like the engine's functions.
+    struct FakeScriptFunction final {
+        FakeObject*     Outer{ nullptr };
+        SFXName         Name{};
+        DWORD           FunctionFlags{ 0 };
+    };
+
+    using FakeAggregator = ::LESDK::TScriptStackAggregator<FakeScriptFunction>;
+    using FakeSampler = ::LESDK::TScriptStackSampler<FakeScriptFunction, FakeScriptFunction>;
+
+    // A script call stack of synthetic frames, root first.
+    struct FakeStack final {
+        std::vector<FFrame> Frames{};
+
+        FakeStack(std::initializer_list<FakeScriptFunction*> const RootFirst) : Frames(RootFirst.size()) {
+            size_t i = 0;
+            for (FakeScriptFunction* const Function : RootFirst) {
+                Frames[i].Node = reinterpret_cast<UStruct*>(Function);
+                Frames[i].PreviousFrame = i > 0 ? &Frames[i - 1] : nullptr;
+                ++i;
+            }
+        }
+
+        FFrame* Top() { return &Frames.back(); }
+    };
+
+    static std::vector<std::string> GCalls{};
+
+    static void FakeProcessInternal(UObject* const Context, FFrame* const Stack, void* const Result) {
+        (void)Context; (void)Result;
+        GCalls.push_back(std::string{ "process " } + reinterpret_cast<FakeScriptFunction const*>(Stack->Node)->Name.GetName());
+    }
+
+    static void FakeCallFunction(UObject* const Context, FFrame* const Stack, void* const Result, FakeScriptFunction* const Function) {
+        (void)Context; (void)Stack; (void)Result;
+        GCalls.push_back(std::string{ "call " } + Function->Name.GetName());
+    }
+
+}
+
+
+SCENARIO("ScriptSampler - sampling script call stacks into collapsed stacks") {
+    using namespace ScriptSamplerTests;
+
+    GIVEN("a few script functions and native functions") {
+        FakeObjectWorld World{};
+        FakeObject* const PawnClass = World.AddClass("Pawn", nullptr);
+        FakeObject* const ControllerClass = World.AddClass("Controller", nullptr);
+
+        FakeScriptFunction Tick{ PawnClass, World.Names.Make("Tick") };
+        FakeScriptFunction Move{ PawnClass, World.Names.Make("Move") };
+        FakeScriptFunction Think{ ControllerClass, World.Names.Make("Think") };
+        FakeScriptFunction Trace{ ControllerClass, World.Names.Make("Trace"), ::LESDK::k_funcNative };
+        FakeScriptFunction OtherTick{ PawnClass, World.Names.Make("Tick") };
+
+        WHEN("synthetic frame chains are aggregated") {
+            FakeStack Moving{ &Tick, &Move };
+            FakeStack Thinking{ &Tick, &Think };
+            FakeStack Other{ &OtherTick, &Move };
+
+            FakeAggregator Aggregator{};
+            Aggregator.AddFrames(Moving.Top());
+            Aggregator.AddFrames(Moving.Top());
+            Aggregator.AddFrames(Thinking.Top());
+            Aggregator.AddFrames(Other.Top());
+            Aggregator.AddFrames(Moving.Top(), 1);
+
+            THEN("identical stacks are counted together, root first, and named functions are merged") {
+                CHECK_EQ(Aggregator.GetNumSamples(), 5);
+                CHECK_EQ(Aggregator.GetNumStacks(), 4);
+                CHECK_EQ(Aggregator.ToCollapsed(),
+                    "Pawn.Move 1\n"
+                    "Pawn.Tick;Controller.Think 1\n"
+                    "Pawn.Tick;Pawn.Move 3\n");
+            }
+        }
+
+        WHEN("calls are sampled at a rate") {
+            FakeStack Moving{ &Tick, &Move };
+            FakeSampler Sampler{ 3 };
+
+            for (INT i = 0; i < 9; ++i)
+                Sampler.OnCall(Moving.Top());
+            Sampler.OnCall(Moving.Top(), &Trace);
+            Sampler.OnCall(Moving.Top(), &Trace);
+
+            std::thread Worker{ [&] {
+                FakeStack Thinking{ &Tick, &Think };
+                for (INT i = 0; i < 3; ++i)
+                    Sampler.OnCall(Thinking.Top());
+            } };
+            Worker.join();
+
+            FakeAggregator Aggregator{};
+            CHECK_EQ(Sampler.Drain(Aggregator), 4);
+            CHECK_EQ(Sampler.Drain(Aggregator), 0);
+
+            THEN("every Nth call on each thread is recorded") {
+                CHECK_EQ(Aggregator.ToCollapsed(),
+                    "Pawn.Tick;Controller.Think 1\n"
+                    "Pawn.Tick;Pawn.Move 3\n");
+            }
+
+            Sampler.OnCall(Moving.Top(), &Trace);
+            Aggregator.Reset();
+            CHECK_EQ(Sampler.Drain(Aggregator), 1);
+
+            THEN("native callees are recorded as leaves") {
+                CHECK_EQ(Aggregator.ToCollapsed(), "Pawn.Tick;Pawn.Move;Controller.Trace 1\n");
+            }
+        }
+
+        WHEN("the ring buffer is not drained in time") {
+            FakeStack Moving{ &Tick, &Move };
+            FakeSampler Sampler{ 1 };
+            for (INT i = 0; i < FakeSampler::k_ringCapacity + 10; ++i)
+                Sampler.OnCall(Moving.Top());
+
+            THEN("the oldest samples are dropped") {
+                FakeAggregator Aggregator{};
+                CHECK_EQ(Sampler.Drain(Aggregator), FakeSampler::k_ringCapacity);
+            }
+        }
+
+        WHEN("the hooks are installed through a proxy interface") {
+            ObjectHooksTests::MockProxyInterface Proxy{};
+            ::LESDK::Initializer Init{ &Proxy, "Tests", nullptr };
+            FakeSampler Sampler{ 1 };
+            GCalls.clear();
+
+            REQUIRE(FakeSampler::Install(Init, Sampler,
+                ::LESDK::Address::FromAbsolute(reinterpret_cast<void*>(&FakeProcessInternal)),
+                ::LESDK::Address::FromAbsolute(reinterpret_cast<void*>(&FakeCallFunction))));
+            CHECK(FakeSampler::IsInstalled());
+
+            auto const ProcessInternal = reinterpret_cast<FakeSampler::ProcessInternalType>(Proxy.FindDetour("Tests_ProcessInternal"));
+            auto const CallFunction = reinterpret_cast<FakeSampler::CallFunctionType>(Proxy.FindDetour("Tests_CallFunction"));
+            REQUIRE(ProcessInternal != nullptr);
+            REQUIRE(CallFunction != nullptr);
+
+            FakeStack Moving{ &Tick, &Move };
+            CallFunction(nullptr, &Moving.Frames[0], nullptr, &Move);
+            ProcessInternal(nullptr, Moving.Top(), nullptr);
+            CallFunction(nullptr, Moving.Top(), nullptr, &Trace);
+
+            FakeSampler::Uninstall(Init);
+            CHECK_FALSE(FakeSampler::IsInstalled());
+            CHECK(Proxy.Hooks.empty());
+
+            THEN("engine calls reach the originals and script callees are sampled once") {
+                std::vector<std::string> const Expected{ "call Move", "process Move", "call Trace" };
+                CHECK_EQ(GCalls, Expected);
+
+                FakeAggregator Aggregator{};
+                CHECK_EQ(Sampler.Drain(Aggregator), 2);
+                CHECK_EQ(Aggregator.ToCollapsed(),
+                    "Pawn.Tick;Pawn.Move 1\n"
+                    "Pawn.Tick;Pawn.Move;Controller.Trace 1\n");
+            }
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "doctest.h"
+#include "LESDK/Common/StaticRef.hpp"
+
+
+namespace StaticRefTests {
+
+    struct FResolved { int Value; };
+
+    static FResolved GResolved{ 42 };
+    static std::atomic<int> GNumLookups{ 0 };
+    static std::atomic<bool> GAvailable{ true };
+
+    static FResolved* Lookup(wchar_t const* const Name) {
+        (void)Name;
+        GNumLookups.fetch_add(1);
+        // Give concurrent callers time to pile up behind the first lookup.
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+        return GAvailable.load() ? &GResolved : nullptr;
+    }
+
+}
+
+
+TEST_SUITE("StaticRef") {
+    using namespace StaticRefTests;
+
+    TEST_CASE("resolves once and caches the result") {
+        GNumLookups = 0;
+        GAvailable = true;
+        ::LESDK::TStaticRef<FResolved> Ref{ L"Class Core.Resolved", &Lookup };
+
+        CHECK_EQ(Ref.GetIfResolved(), nullptr);
+        CHECK_EQ(Ref.Get(), &GResolved);
+        CHECK_EQ(Ref.Get(), &GResolved);
+        CHECK_EQ(Ref.GetIfResolved(), &GResolved);
+        CHECK_EQ(GNumLookups.load(), 1);
+    }
+
+    TEST_CASE("concurrent first callers share one lookup") {
+        GNumLookups = 0;
+        GAvailable = true;
+        ::LESDK::TStaticRef<FResolved> Ref{ L"Class Core.Resolved", &Lookup };
+
+        std::vector<std::thread> Threads{};
+        std::atomic<int> NumCorrect{ 0 };
+        for (int i = 0; i < 8; ++i) {
+            Threads.emplace_back([&] {
+                if (Ref.Get() == &GResolved)
+                    NumCorrect.fetch_add(1);
+            });
+        }
+        for (std::thread& Thread : Threads)
+            Thread.join();
+
+        CHECK_EQ(NumCorrect.load(), 8);
+        CHECK_EQ(GNumLookups.load(), 1);
+    }
+
+    TEST_CASE("failed lookups are retried on a later call") {
+        GNumLookups = 0;
+        GAvailable = false;
+        ::LESDK::TStaticRef<FResolved> Ref{ L"Class Core.Resolved", &Lookup };
+
+        CHECK_EQ(Ref.Get(), nullptr);
+        CHECK_EQ(Ref.Get(), nullptr);
+        CHECK_EQ(GNumLookups.load(), 2);
+
+        GAvailable = true;
+        CHECK_EQ(Ref.Get(), &GResolved);
+        CHECK_EQ(GNumLookups.load(), 3);
+    }
+}
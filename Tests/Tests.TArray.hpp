@@ -78,8 +78,8 @@ SCENARIO("TArray - trivial elements") {
             THEN("its count is still zero") {
                 CHECK_EQ(Array.Count(), 0);
             }
-            THEN("its capacity matches what was reserved") {
-                CHECK_EQ(Array.Capacity(), 5);
+            THEN("its capacity is what was reserved, rounded up to the allocator bucket") {
+                CHECK_EQ(Array.Capacity(), 8);
             }
             THEN("its data pointer is not null") {
                 CHECK_NE(Array.GetData(), nullptr);
@@ -334,9 +334,9 @@ SCENARIO("TArray - trivial elements") {
         WHEN("bigger number of elements is reserved") {
             Array.Reserve(100);
 
-            THEN("elements are reallocated") {
+            THEN("capacity grows and elements are preserved") {
                 CHECK_GE(Array.Capacity(), 100);
-                CHECK_NE(Array.GetData(), OldData);
+                CHECK(std::equal(Array.begin(), Array.end(), Source.begin()));
             }
             THEN("count stays the same") {
                 CHECK_EQ(Array.Count(), OldCount);
@@ -363,8 +363,9 @@ SCENARIO("TArray - trivial elements") {
                 THEN("capacity decreases") {
                     CHECK_EQ(Array.Capacity(), 5);
                 }
-                THEN("elements are reallocated") {
-                    CHECK_NE(Array.GetData(), OldData);
+                THEN("elements are reallocated, possibly in place") {
+                    REQUIRE_NE(Array.GetData(), nullptr);
+                    CHECK(std::equal(Array.begin(), Array.end(), Source.begin()));
                 }
             }
         }
@@ -555,6 +556,302 @@ SCENARIO("TArray - non-trivial elements") {
 }
 
 
+static_assert(TIsTriviallyRelocatable<int>::value);
+static_assert(TIsTriviallyRelocatable<TArray<int>>::value);
+static_assert(TIsTriviallyRelocatable<FString>::value);
+static_assert(! TIsTriviallyRelocatable<Copyable>::value);
+static_assert(! TIsTriviallyRelocatable<Movable>::value);
+
+SCENARIO("TArray - trivially relocatable elements") {
+
+    GIVEN("an array of strings") {
+        TArray<FString> Array{};
+        Array.Reserve(2);
+        Array.Add(FString{ L"first" });
+        Array.Add(FString{ L"second" });
+
+        WHEN("the array is reallocated") {
+            Array.Reserve(100);
+            Array.Add(FString{ L"third" });
+
+            THEN("the strings are relocated with their buffers intact") {
+                REQUIRE_EQ(Array.Count(), 3);
+                CHECK_EQ(Array(0), FString{ L"first" });
+                CHECK_EQ(Array(1), FString{ L"second" });
+                CHECK_EQ(Array(2), FString{ L"third" });
+            }
+
+            AND_WHEN("the array is shrunk") {
+                Array.Shrink();
+
+                THEN("the strings are still intact") {
+                    CHECK_EQ(Array.Capacity(), 3);
+                    CHECK_EQ(Array(0), FString{ L"first" });
+                    CHECK_EQ(Array(2), FString{ L"third" });
+                }
+            }
+        }
+    }
+
+    GIVEN("an array of arrays") {
+        TArray<TArray<int>> Array{};
+        Array.Add(TArray<int>{ 1, 2, 3 });
+
+        WHEN("the outer array grows") {
+            for (int i = 0; i < 16; ++i)
+                Array.Add(TArray<int>{ i });
+
+            THEN("inner arrays keep their contents") {
+                REQUIRE_EQ(Array.Count(), 17);
+                CHECK_EQ(Array(0).AsVec(), std::vector<int>{ 1, 2, 3 });
+                CHECK_EQ(Array(16).AsVec(), std::vector<int>{ 15 });
+            }
+        }
+    }
+}
+
+
+static_assert(FEngineArrayGrowth::Quantize(1) == 8);
+static_assert(FEngineArrayGrowth::Quantize(68) == 80);
+static_assert(FEngineArrayGrowth::Quantize(40000) == 40960);
+static_assert(FEngineArrayGrowth::Grow(1, 0, sizeof(int)) == 20);
+static_assert(FEngineArrayGrowth::Grow(100, 0, 1) == 160);
+static_assert(FEngineArrayGrowth::Grow(5, 20, sizeof(int)) == 20);
+static_assert(FPowerOfTwoArrayGrowth::Grow(9, 0, sizeof(int)) == 16);
+
+SCENARIO("TArray - growth policies") {
+
+    GIVEN("an array with the engine's growth") {
+        TArray<int> Array{};
+
+        WHEN("elements are added one at a time") {
+            Array.Add(1);
+            auto const FirstCapacity = Array.Capacity();
+            for (int i = 0; i < 100; ++i)
+                Array.Add(i);
+
+            THEN("it grows with the engine's slack, filling allocator buckets") {
+                CHECK_EQ(FirstCapacity, 20);
+                CHECK_GE(Array.Capacity(), 101);
+                CHECK_LT(Array.Capacity(), 101 + 101 / 2 + 16);
+            }
+        }
+
+        WHEN("the array is shrunk within the same allocator bucket") {
+            for (int i = 0; i < 17; ++i)
+                Array.Add(i);
+            REQUIRE_EQ(Array.Capacity(), 20);
+            auto const OldData = Array.GetData();
+            Array.Shrink();
+
+            THEN("nothing is reallocated") {
+                CHECK_EQ(Array.Capacity(), 20);
+                CHECK_EQ(Array.GetData(), OldData);
+            }
+        }
+    }
+
+    GIVEN("an array with power of two growth") {
+        TArray<int, FPowerOfTwoArrayGrowth> Array{};
+
+        WHEN("elements are added one at a time") {
+            for (int i = 0; i < 9; ++i)
+                Array.Add(i);
+
+            THEN("its capacity is the next power of two") {
+                CHECK_EQ(Array.Capacity(), 16);
+                CHECK_EQ(Array.AsVec(), std::vector<int>{ 0, 1, 2, 3, 4, 5, 6, 7, 8 });
+            }
+        }
+    }
+}
+
+
+SCENARIO("TArray - inserting and erasing ranges") {
+
+    GIVEN("an array of trivial elements") {
+        TArray<int> Array{ 1, 2, 3, 4, 5 };
+
+        WHEN("elements are emplaced") {
+            Array.Emplace(6);
+            Array.EmplaceAt(0, 0);
+            Array.EmplaceAt(3, Array(1));
+
+            THEN("they are constructed in place") {
+                CHECK_EQ(Array.AsVec(), std::vector<int>{ 0, 1, 2, 1, 3, 4, 5, 6 });
+            }
+        }
+
+        WHEN("a span is appended") {
+            std::vector<int> const More(100, 7);
+            Array.Append(More);
+
+            THEN("the array grows once to fit it") {
+                CHECK_EQ(Array.Count(), 105);
+                CHECK_EQ(Array.Capacity(), FEngineArrayGrowth::Grow(105, 5, sizeof(int)));
+                CHECK_EQ(Array(104), 7);
+            }
+        }
+
+        WHEN("the array is appended to itself") {
+            Array.Append(Array.AsSpan());
+
+            THEN("the elements are duplicated") {
+                CHECK_EQ(Array.AsVec(), std::vector<int>{ 1, 2, 3, 4, 5, 1, 2, 3, 4, 5 });
+            }
+        }
+
+        WHEN("a range is inserted and erased in the middle") {
+            std::array<int, 3> const Range = { 10, 11, 12 };
+            Array.InsertRange(2, Range.begin(), Range.end());
+            CHECK_EQ(Array.AsVec(), std::vector<int>{ 1, 2, 10, 11, 12, 3, 4, 5 });
+            Array.Erase(1, 3);
+
+            THEN("the tail is shifted back") {
+                CHECK_EQ(Array.AsVec(), std::vector<int>{ 1, 12, 3, 4, 5 });
+            }
+        }
+    }
+
+    GIVEN("an array of non-trivial elements") {
+        Counters Counters{};
+        TArray<Movable> Array{};
+        Array.Reserve(8);
+        for (int i = 0; i < 4; ++i)
+            Array.Emplace(Counters);
+        REQUIRE_EQ(Counters.Construct, 4);
+        REQUIRE_EQ(Counters.Move, 0);
+        Counters.Reset();
+
+        WHEN("an element is inserted in the middle") {
+            Array.EmplaceAt(1, Counters);
+
+            THEN("the tail is relocated by moving, and the new element is constructed once") {
+                CHECK_EQ(Array.Count(), 5);
+                CHECK_EQ(Counters.Construct, 1);
+                CHECK_EQ(Counters.Copy, 0);
+                CHECK_EQ(Counters.Move, 4);
+                CHECK_EQ(Counters.Destroy, 4);
+            }
+        }
+
+        WHEN("elements are erased in the middle") {
+            Array.Erase(1, 2);
+
+            THEN("erased elements are destroyed and the tail is relocated") {
+                CHECK_EQ(Array.Count(), 2);
+                CHECK_EQ(Counters.Copy, 0);
+                CHECK_EQ(Counters.Move, 1);
+                CHECK_EQ(Counters.Destroy, 3);
+            }
+        }
+
+        WHEN("a range is inserted through move iterators") {
+            std::vector<Movable> Source{};
+            Source.reserve(2);
+            Source.emplace_back(Counters);
+            Source.emplace_back(Counters);
+            Counters.Reset();
+
+            Array.InsertRange(Array.Count(), std::make_move_iterator(Source.begin()), std::make_move_iterator(Source.end()));
+
+            THEN("elements are moved rather than copied") {
+                CHECK_EQ(Array.Count(), 6);
+                CHECK_EQ(Counters.Copy, 0);
+                CHECK_EQ(Counters.Move, 2);
+            }
+        }
+    }
+}
+
+
+SCENARIO("TArray - removing many elements") {
+
+    GIVEN("an array of trivial elements") {
+        TArray<int> Array{ 1, 2, 3, 4, 5, 6, 7, 8 };
+
+        WHEN("elements are removed by swapping") {
+            Array.RemoveAtSwap(1);
+            Array.RemoveAtSwap(0, 3);
+
+            THEN("holes are filled from the end") {
+                CHECK_EQ(Array.AsVec(), std::vector<int>{ 5, 6, 7, 4 });
+            }
+        }
+
+        WHEN("the last elements are removed by swapping") {
+            Array.RemoveAtSwap(6, 2);
+
+            THEN("nothing is moved") {
+                CHECK_EQ(Array.AsVec(), std::vector<int>{ 1, 2, 3, 4, 5, 6 });
+            }
+        }
+
+        WHEN("all even elements are removed") {
+            auto const Removed = Array.RemoveAll([](int const Value) { return Value % 2 == 0; });
+
+            THEN("the rest keep their order") {
+                CHECK_EQ(Removed, 4);
+                CHECK_EQ(Array.AsVec(), std::vector<int>{ 1, 3, 5, 7 });
+            }
+        }
+
+        WHEN("all even elements are removed by swapping") {
+            auto const Removed = Array.RemoveAllSwap([](int const Value) { return Value % 2 == 0; });
+
+            THEN("the rest remain, in any order") {
+                CHECK_EQ(Removed, 4);
+                std::vector<int> Rest = Array.AsVec();
+                std::ranges::sort(Rest);
+                CHECK_EQ(Rest, std::vector<int>{ 1, 3, 5, 7 });
+            }
+        }
+
+        WHEN("a sorted array with duplicates is deduplicated") {
+            TArray<int> Sorted{ 1, 1, 2, 3, 3, 3, 4, 5, 5 };
+            auto const Removed = Sorted.Dedupe();
+
+            THEN("each value is kept once") {
+                CHECK_EQ(Removed, 4);
+                CHECK_EQ(Sorted.AsVec(), std::vector<int>{ 1, 2, 3, 4, 5 });
+            }
+        }
+    }
+
+    GIVEN("an array of non-trivial elements") {
+        Counters Counters{};
+        TArray<Movable> Array{};
+        Array.Reserve(6);
+        for (int i = 0; i < 6; ++i)
+            Array.Emplace(Counters);
+        Counters.Reset();
+
+        WHEN("every other element is removed") {
+            int Index = 0;
+            auto const Removed = Array.RemoveAll([&Index](Movable const&) { return Index++ % 2 == 0; });
+
+            THEN("removed elements are destroyed once and kept ones moved at most once") {
+                CHECK_EQ(Removed, 3);
+                CHECK_EQ(Array.Count(), 3);
+                CHECK_EQ(Counters.Copy, 0);
+                CHECK_EQ(Counters.Move, 3);
+                CHECK_EQ(Counters.Destroy, 6);
+            }
+        }
+
+        WHEN("an element is removed by swapping") {
+            Array.RemoveAtSwap(0);
+
+            THEN("only the last element is moved") {
+                CHECK_EQ(Array.Count(), 5);
+                CHECK_EQ(Counters.Move, 1);
+                CHECK_EQ(Counters.Destroy, 2);
+            }
+        }
+    }
+}
+
+
 SCENARIO("TArray - conversion to standard containers") {
     // Some of these tests may leak memory but that's okay.
 
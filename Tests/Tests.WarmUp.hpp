@@ -0,0 +1,83 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+
+#include "doctest.h"
+#include "./Utilities.hpp"
+#include "LESDK/Common/WarmUp.hpp"
+
+
+TEST_SUITE("WarmUp") {
+    TEST_CASE("static reference tables register and unregister themselves") {
+        static wchar_t const* const FirstNames[] = { L"Class Core.Object", L"Function Core.Object.Tick" };
+        static wchar_t const* const SecondNames[] = { L"Class Engine.Actor" };
+
+        auto const IsRegistered = [](::LESDK::FStaticRefTable const* const Wanted) {
+            for (auto const* Table = ::LESDK::FStaticRefTable::GetFirst(); Table != nullptr; Table = Table->GetNext()) {
+                if (Table == Wanted)
+                    return true;
+            }
+            return false;
+        };
+
+        ::LESDK::FStaticRefTable const First{ FirstNames };
+        {
+            ::LESDK::FStaticRefTable const Second{ SecondNames };
+            CHECK(IsRegistered(&First));
+            CHECK(IsRegistered(&Second));
+            CHECK_EQ(Second.Num(), 1);
+            CHECK_EQ(Second.GetNames(), SecondNames);
+        }
+
+        CHECK(IsRegistered(&First));
+        CHECK_EQ(First.Num(), 2);
+    }
+
+    TEST_CASE("registered names are resolved in one pass") {
+        FakeObjectWorld World{};
+        FakeObjectIndex Index{};
+
+        FakeObject* const ObjectClass = World.AddClass("Object", nullptr);
+        FakeObject* const FunctionClass = World.AddClass("Function", ObjectClass);
+        FakeObject* const EnginePackage = World.Add("Engine", World.PackageClass);
+        FakeObject* const ActorClass = World.AddClass("Actor", ObjectClass, EnginePackage);
+        FakeObject* const Tick = World.Add("Tick", FunctionClass, ActorClass);
+        FakeObject* const Touch = World.Add("Touch", FunctionClass, ActorClass);
+
+        WCHAR const* const Names[] = {
+            L"Class Engine.Actor",
+            L"Function Engine.Actor.Tick",
+            L"Function Engine.Actor.Touch",
+            L"Function Engine.Actor.Tick",
+            L"Function Engine.Actor.Bump",
+            L"Class Engine.Actor.Tick",
+            L"Malformed",
+        };
+
+        ::LESDK::FWarmUpResult const Result = ::LESDK::WarmUpObjects(World.Objects, Index, std::span{ Names });
+
+        SUBCASE("duplicates are requested once and misses are reported") {
+            CHECK_EQ(Result.NumRequested, 6);
+            CHECK_EQ(Result.NumResolved, 3);
+            REQUIRE_EQ(Result.Missing.size(), 3);
+            CHECK(std::find(Result.Missing.begin(), Result.Missing.end(), Names[4]) != Result.Missing.end());
+            CHECK(std::find(Result.Missing.begin(), Result.Missing.end(), Names[5]) != Result.Missing.end());
+            CHECK(std::find(Result.Missing.begin(), Result.Missing.end(), Names[6]) != Result.Missing.end());
+        }
+
+        SUBCASE("found objects are served by the index without building it") {
+            CHECK_FALSE(Index.IsBuilt());
+            CHECK_EQ(Index.Num(), 3);
+            CHECK_EQ(Index.Find(World.Objects, L"Class Engine.Actor"), ActorClass);
+            CHECK_EQ(Index.Find(World.Objects, L"Function Engine.Actor.Tick", FunctionClass), Tick);
+            CHECK_EQ(Index.Find(World.Objects, L"Function Engine.Actor.Touch"), Touch);
+            CHECK_FALSE(Index.IsBuilt());
+        }
+
+        SUBCASE("other lookups still work") {
+            CHECK_EQ(Index.Find(World.Objects, L"Package Engine"), EnginePackage);
+            CHECK(Index.IsBuilt());
+        }
+    }
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <type_traits>
+#include <unordered_set>
+
+#include "doctest.h"
+#include "./Utilities.hpp"
+#include "./Tests.ObjectIndex.hpp"
+#include "./Tests.ObjectIterator.hpp"
+#include "./Tests.ObjectHooks.hpp"
+#include "LESDK/Common/WeakObjectPtr.hpp"
+
+
+using FakeWeakObjectPtr = ::LESDK::TWeakObjectPtr<FakeObject, FakeObject>;
+
+static_assert(std::is_trivially_copyable_v<FakeWeakObjectPtr>);
+static_assert(sizeof(FakeWeakObjectPtr) == 16);
+
+
+SCENARIO("WeakObjectPtr - validating handles by slot and serial") {
+    GIVEN("a tracked world of objects") {
+        FakeObjectWorld World{};
+        FakeObjectIndex Index{};
+        FakeObjectBuckets Buckets{};
+        ::LESDK::FObjectSerials Serials{};
+        FakeObjectTracker Tracker{ Index, Buckets, Serials };
+
+        FakeObject* const ObjectClass = World.AddClass("Object", nullptr);
+        FakeObject* const ActorClass = World.AddClass("Actor", ObjectClass);
+        FakeObject* const First = World.Add("Actor_1", ActorClass);
+        FakeObject* const Second = World.Add("Actor_2", ActorClass);
+        Tracker.Start(World.Objects);
+
+        FakeWeakObjectPtr const FirstHandle{ First, Serials };
+        FakeWeakObjectPtr const SecondHandle{ Second, Serials };
+
+        THEN("handles resolve to their objects") {
+            CHECK(FirstHandle.IsSet());
+            CHECK_EQ(FirstHandle.Get(World.Objects, Serials), First);
+            CHECK_EQ(SecondHandle.Get(World.Objects, Serials), Second);
+            CHECK_EQ(FirstHandle.GetSlot(), First->ObjectInternalInteger);
+        }
+
+        THEN("handles to the same object are equal and hash alike") {
+            FakeWeakObjectPtr const Again{ First, Serials };
+            CHECK_EQ(Again, FirstHandle);
+            CHECK_NE(Again, SecondHandle);
+            CHECK_EQ(std::hash<FakeWeakObjectPtr>{}(Again), std::hash<FakeWeakObjectPtr>{}(FirstHandle));
+
+            std::unordered_set<FakeWeakObjectPtr> const Set{ FirstHandle, SecondHandle, Again };
+            CHECK_EQ(Set.size(), 2);
+        }
+
+        THEN("empty handles resolve to nothing") {
+            FakeWeakObjectPtr const Empty{};
+            FakeWeakObjectPtr const FromNull{ nullptr, Serials };
+            CHECK_FALSE(Empty.IsSet());
+            CHECK_EQ(Empty.Get(World.Objects, Serials), nullptr);
+            CHECK_EQ(FromNull, Empty);
+
+            FakeWeakObjectPtr Reset = FirstHandle;
+            Reset.Reset();
+            CHECK_EQ(Reset, Empty);
+        }
+
+        WHEN("an object is destroyed") {
+            Tracker.OnObjectDestroyed(First);
+            World.Remove(First);
+
+            THEN("its handles go stale and others do not") {
+                CHECK_EQ(FirstHandle.Get(World.Objects, Serials), nullptr);
+                CHECK_EQ(SecondHandle.Get(World.Objects, Serials), Second);
+            }
+        }
+
+        WHEN("a slot is reused without a destruction event") {
+            World.Remove(First);
+            FakeObject* const Reused = World.Reuse(First, "Actor_3", ActorClass);
+            Tracker.OnObjectAllocated(Reused);
+
+            THEN("handles to the old object do not resolve to the new one") {
+                CHECK_EQ(FirstHandle.Get(World.Objects, Serials), nullptr);
+
+                FakeWeakObjectPtr const ReusedHandle{ Reused, Serials };
+                CHECK_EQ(ReusedHandle.GetSlot(), FirstHandle.GetSlot());
+                CHECK_NE(ReusedHandle, FirstHandle);
+                CHECK_EQ(ReusedHandle.Get(World.Objects, Serials), Reused);
+            }
+        }
+
+        WHEN("a slot is reused without any object events") {
+            World.Remove(First);
+            FakeObject* const Reused = World.Reuse(First, "Actor_3", ActorClass);
+
+            THEN("handles to the old object still do not resolve to the new one") {
+                REQUIRE_EQ(Reused->ObjectInternalInteger, FirstHandle.GetSlot());
+                CHECK_EQ(Serials.Get(FirstHandle.GetSlot()), FirstHandle.GetSerial());
+                CHECK_EQ(FirstHandle.Get(World.Objects, Serials), nullptr);
+                CHECK_EQ(FakeWeakObjectPtr{ Reused, Serials }.Get(World.Objects, Serials), Reused);
+            }
+        }
+
+        WHEN("tracking stops") {
+            Tracker.Stop();
+
+            THEN("handles go stale and no new ones are made") {
+                CHECK_EQ(FirstHandle.Get(World.Objects, Serials), nullptr);
+                CHECK_FALSE(FakeWeakObjectPtr{ First, Serials }.IsSet());
+            }
+            THEN("restarting does not revive old handles") {
+                Tracker.Start(World.Objects);
+                CHECK_EQ(FirstHandle.Get(World.Objects, Serials), nullptr);
+                CHECK_EQ(FakeWeakObjectPtr{ First, Serials }.Get(World.Objects, Serials), First);
+            }
+        }
+
+        WHEN("a slot lies beyond the table") {
+            FakeObjectWorld Smaller{};
+
+            THEN("the handle does not resolve") {
+                CHECK_EQ(SecondHandle.Get(Smaller.Objects, Serials), nullptr);
+            }
+        }
+    }
+}
+
+SCENARIO("WeakObjectPtr - handles need tracked slots") {
+    GIVEN("serial numbers nothing reports slot reuse to") {
+        FakeObjectWorld World{};
+        ::LESDK::FObjectSerials Serials{};
+
+        FakeObject* const ObjectClass = World.AddClass("Object", nullptr);
+        FakeObject* const Object = World.Add("Object_1", ObjectClass);
+
+        THEN("handles are left unset and never resolve") {
+            FakeWeakObjectPtr const Handle{ Object, Serials };
+            CHECK_FALSE(Handle.IsSet());
+            CHECK_EQ(Handle.Get(World.Objects, Serials), nullptr);
+        }
+    }
+}
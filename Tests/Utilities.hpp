@@ -42,3 +42,184 @@ struct Movable final {
 
 static_assert(std::is_move_constructible_v<Movable>);
 static_assert(std::is_move_assignable_v<Movable>);
+
+
+// ! Synthetic name pool and object table.
+// ========================================
+
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "LESDK/Common/SFXName.hpp"
+#include "LESDK/Common/TArray.hpp"
+
+
+// Single-chunk stand-in for BioWare's name pools, installed into SFXName::GBioNamePools.
+// Optionally also installs a case-insensitive SFXName::GInitMethod over the same pool.
+class FakeNamePool final {
+    std::vector<BYTE> Buffer = std::vector<BYTE>(1 << 16);
+    std::vector<std::pair<std::string, DWORD>> Known{};
+    size_t Cursor = 0;
+    SFXNameEntry const* Pools[2]{};
+    SFXNameEntry const** PreviousPools{ nullptr };
+    SFXName::tInitMethod* PreviousInitMethod{ nullptr };
+
+    static inline FakeNamePool* GCurrent{ nullptr };
+
+public:
+    explicit FakeNamePool(bool const bWithInitMethod = false) {
+        Pools[0] = reinterpret_cast<SFXNameEntry const*>(Buffer.data());
+        PreviousPools = SFXName::GBioNamePools;
+        PreviousInitMethod = SFXName::GInitMethod;
+        SFXName::GBioNamePools = Pools;
+        SFXName::GInitMethod = bWithInitMethod ? &FakeNamePool::InitMethod : nullptr;
+        GCurrent = this;
+        Make("None");
+    }
+
+    ~FakeNamePool() noexcept {
+        SFXName::GBioNamePools = PreviousPools;
+        SFXName::GInitMethod = PreviousInitMethod;
+        GCurrent = nullptr;
+    }
+
+    FakeNamePool(FakeNamePool const&) = delete;
+    FakeNamePool& operator=(FakeNamePool const&) = delete;
+
+    SFXName Make(char const* const Text, INT const Number = 0) {
+        SFXName Name{};
+        Name.Chunk = 0;
+        Name.Number = Number;
+
+        for (auto const& [KnownText, KnownOffset] : Known) {
+            if (KnownText == Text) {
+                Name.Offset = KnownOffset;
+                return Name;
+            }
+        }
+
+        size_t const Length = std::strlen(Text);
+        auto* const Entry = reinterpret_cast<SFXNameEntry*>(Buffer.data() + Cursor);
+        Entry->Index.Offset = 0;
+        Entry->Index.Length = static_cast<DWORD>(Length);
+        Entry->Index.Flags = 0;
+        Entry->HashNext = nullptr;
+        std::memcpy(Entry->AnsiName, Text, Length + 1);
+
+        Name.Offset = static_cast<DWORD>(Cursor);
+        Known.emplace_back(Text, static_cast<DWORD>(Cursor));
+        Cursor += 13 + Length;
+        return Name;
+    }
+
+    // Mimics the engine: "Name_N" splits into "Name" and N + 1 unless N has leading zeros.
+    static void InitMethod(SFXName* const Self, WCHAR const* const InName, INT InNumber,
+        UBOOL const bCreateIfNotFound, UBOOL const bSplitName)
+    {
+        std::string Text{};
+        for (WCHAR const* Char = InName; *Char != L'\0'; ++Char)
+            Text.push_back(static_cast<char>(*Char));
+
+        if (bSplitName && InNumber == 0) {
+            size_t const Underscore = Text.rfind('_');
+            std::string const Digits = Underscore != std::string::npos ? Text.substr(Underscore + 1) : std::string{};
+            bool const bNumeric = !Digits.empty() && Digits.size() < 10
+                && Digits.find_first_not_of("0123456789") == std::string::npos
+                && (Digits.size() == 1 || Digits[0] != '0');
+            if (bNumeric) {
+                InNumber = std::stoi(Digits) + 1;
+                Text.resize(Underscore);
+            }
+        }
+
+        for (auto const& [KnownText, KnownOffset] : GCurrent->Known) {
+            if (KnownText.size() == Text.size() && 0 == _strnicmp(KnownText.c_str(), Text.c_str(), Text.size())) {
+                *Self = GCurrent->Make(KnownText.c_str(), InNumber);
+                return;
+            }
+        }
+
+        *Self = bCreateIfNotFound ? GCurrent->Make(Text.c_str(), InNumber) : GCurrent->Make("None");
+    }
+};
+
+// Minimal UObject look-alike for testing templates that are late-bound to UObject.
+struct FakeObject final {
+    INT             ObjectInternalInteger{ -1 };
+    FakeObject*     Outer{ nullptr };
+    SFXName         Name{};
+    FakeObject*     Class{ nullptr };
+    FakeObject*     SuperField{ nullptr };
+
+    // Test doubles may route script calls through this, see Tests.InvokeBatch.hpp.
+    static inline void (*GProcessEvent)(FakeObject* Object, UFunction* Function, void* Parms) = nullptr;
+
+    void ProcessEvent(UFunction* const Function, void* const Parms, void* const Result = nullptr) {
+        (void)Result;
+        if (GProcessEvent != nullptr)
+            GProcessEvent(this, Function, Parms);
+    }
+
+    bool IsA(FakeObject const* const pClass) const {
+        for (FakeObject const* Super = Class; Super != nullptr; Super = Super->SuperField) {
+            if (Super == pClass)
+                return true;
+        }
+        return false;
+    }
+};
+
+// Owns a name pool, a set of fake objects and a GObjObjects-like table over them.
+struct FakeObjectWorld final {
+    FakeNamePool            Names;
+    std::deque<FakeObject>  Storage{};
+    TArray<FakeObject*>     Objects{};
+
+    FakeObject* ClassClass{ nullptr };
+    FakeObject* PackageClass{ nullptr };
+    FakeObject* CorePackage{ nullptr };
+
+    explicit FakeObjectWorld(bool const bWithInitMethod = false)
+        : Names{ bWithInitMethod }
+    {
+        ClassClass = Add("Class", nullptr);
+        ClassClass->Class = ClassClass;
+        PackageClass = Add("Package", ClassClass);
+        CorePackage = Add("Core", PackageClass);
+        ClassClass->Outer = CorePackage;
+        PackageClass->Outer = CorePackage;
+    }
+
+    FakeObject* Add(char const* const Name, FakeObject* const Class, FakeObject* const Outer = nullptr, INT const Number = 0) {
+        FakeObject& Object = Storage.emplace_back();
+        Object.ObjectInternalInteger = static_cast<INT>(Objects.Count());
+        Object.Outer = Outer;
+        Object.Name = Names.Make(Name, Number);
+        Object.Class = Class;
+        Objects.Add(&Object);
+        return &Object;
+    }
+
+    FakeObject* AddClass(char const* const Name, FakeObject* const Super, FakeObject* const Package = nullptr) {
+        FakeObject* const Class = Add(Name, ClassClass, Package != nullptr ? Package : CorePackage);
+        Class->SuperField = Super;
+        return Class;
+    }
+
+    void Remove(FakeObject* const Object) {
+        Objects(static_cast<UINT>(Object->ObjectInternalInteger)) = nullptr;
+    }
+
+    // Puts a new object into the slot of a removed one, like the engine reusing a free index.
+    FakeObject* Reuse(FakeObject* const Removed, char const* const Name, FakeObject* const Class, FakeObject* const Outer = nullptr) {
+        FakeObject& Object = Storage.emplace_back();
+        Object.ObjectInternalInteger = Removed->ObjectInternalInteger;
+        Object.Outer = Outer;
+        Object.Name = Names.Make(Name);
+        Object.Class = Class;
+        Objects(static_cast<UINT>(Object.ObjectInternalInteger)) = &Object;
+        return &Object;
+    }
+};